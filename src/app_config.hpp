@@ -25,6 +25,10 @@
 #define CHANGE_VOL_INTERVAL_MS 50
 #define HOLDING_BACK_TIME_MS 1000
 #define MAGIC_NUMBER 0xAA55A55A
+#define AUDIO_GAPLESS_TAIL_MS 2000
+#define CONFIG_FLUSH_DELAY_MS 5000
+#define AUDIO_RESUME_SAVE_MS 15000
+#define AUDIO_FADE_MS 2
 
 enum {
     SCREEN_HOME = 0,
@@ -42,6 +46,11 @@ typedef struct {
     uint32_t magic;
     uint8_t volume;
     uint16_t play_index;
+    uint32_t play_offset;        /* Source frame to resume the track from */
+    uint8_t eq_preset;           /* AUDIO_EQ_PRESET_xxx, zero in older layouts is the speaker preset */
+    uint16_t crossfade_ms;       /* Between tracks, 0 for gapless transitions */
+    uint16_t play_speed;         /* Percent, zero in older layouts is normal speed */
+    uint32_t play_key;           /* music_library_key() of the track play_offset belongs to, zero in older layouts */
 } system_config_t;
 
 /******************************************************************************/
@@ -61,7 +70,7 @@ extern system_config_t system_config;
 /******************************************************************************/
 
 /*!
- * @brief  Save configuration to EEPROM
+ * @brief  Save configuration, written to flash once changes settle
  * @param  None
  * @retval None
  */
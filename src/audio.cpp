@@ -13,35 +13,96 @@
 #include <Arduino.h>
 #include <SD.h>
 #include <M5Unified.h>
-#include <vector>
-#include <string>
 #include "app_config.hpp"
+#include "config_journal.hpp"
 #include "lvgl_gui.hpp"
 #include "audio.hpp"
+#include "audio_ring.hpp"
+#include "audio_fade.hpp"
+#include "audio_reader.hpp"
+#include "audio_mixer.hpp"
+#include "audio_eq.hpp"
+#include "audio_loudness.hpp"
+#include "audio_spectrum.hpp"
+#include "clip_cache.hpp"
+#include "music_library.hpp"
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
-
+/* Commands handled by the play task */
+enum {
+    AUDIO_CMD_PLAY = 0,
+    AUDIO_CMD_PAUSE,
+    AUDIO_CMD_NEXT,
+    AUDIO_CMD_PREV,
+    AUDIO_CMD_SEEK,              /* arg: position in ms */
+    AUDIO_CMD_SET_MODE,          /* arg: AUDIO_MODE_*, also sets running */
+    AUDIO_CMD_LIBRARY,           /* A rebuilt library is ready */
+    AUDIO_CMD_EFFECT,            /* ptr: clip, arg: gain, AUDIO_EFFECT_LOOP */
+    AUDIO_CMD_EFFECT_STOP,       /* ptr: clip, NULL for all */
+    AUDIO_CMD_MUSIC_GAIN,        /* arg: gain */
+    AUDIO_CMD_EQ,                /* arg: AUDIO_EQ_PRESET_xxx */
+    AUDIO_CMD_CROSSFADE,         /* arg: length in ms */
+    AUDIO_CMD_SPEED,             /* arg: speed in percent */
+};
+
+#define AUDIO_EFFECT_LOOP 0x10000
+
+/* Blocks rendered by the mixer when no music is playing */
+#define AUDIO_EFFECT_BLOCKS 3
+
+enum {
+    AUDIO_MODE_MUSIC = 0,
+    AUDIO_MODE_SMILE,
+};
+
+typedef struct {
+    const void *ptr;
+    uint32_t arg;
+    uint32_t sent_us;            /* For command latency logging */
+    uint8_t type;
+} audio_command_t;
 
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
 /******************************************************************************/
 
-/* Constants for audio buffer*/
-static constexpr const size_t buf_num = 3;
-static constexpr const size_t buf_size = 1024;
-static uint8_t wav_data[buf_num][buf_size];
+/* Speaker channel used for playback */
+static constexpr const uint8_t AUDIO_CHANNEL = 0;
+
+/* Blocks shared between the SD reader task and the player */
+static audio_ring_t audio_ring;
+static bool pipeline_ready = false;
+static uint16_t track_id_seq = 0;           /* Last id handed to the reader */
+static uint16_t queued_track_id = 0;        /* Id of the track queued for gapless playback, 0 if none */
+static char queued_path[AUDIO_PATH_MAX];    /* Path of the queued track */
+static bool gapless_enabled = true;
+static uint16_t track_gain = AUDIO_LOUDNESS_UNITY;   /* Loudness gain of the track being played */
+static uint16_t next_gain = AUDIO_LOUDNESS_UNITY;    /* Loudness gain of the track queued behind it */
+static uint32_t resume_offset = 0;           /* Source frame to resume the saved track from after boot */
+static uint32_t resume_key = 0;              /* music_library_key() of the track resume_offset belongs to */
+static bool save_position = false;           /* Playback position of this track is persisted */
+static uint32_t track_position = 0;          /* Source frame of the last block submitted */
+static uint32_t position_saved_ms = 0;
+static size_t speaker_queued = 0;            /* Submitted blocks the speaker may still hold */
+static uint32_t speaker_end_us = 0;          /* When the speaker runs out of submitted frames */
+static audio_block_t effect_blocks[AUDIO_EFFECT_BLOCKS];
+static uint8_t effect_next = 0;
+static uint32_t underrun_count = 0;          /* Times the speaker ran dry while playing */
+
+/* Commands from other tasks, everything below is owned by the play task */
+static QueueHandle_t audio_queue = NULL;
+static TaskHandle_t audio_task_handle = NULL;
 
-/* Global flags and states */
 static bool is_running = false;              /* Indicates if music is playing */
-static bool next_track_requested = false;    /* Indicates if the next track is requested */
+static uint8_t audio_mode = AUDIO_MODE_MUSIC;
+static bool track_changed = false;           /* Leave the current track, index or offset changed */
 
-static std::vector<String> music_files;      /* List of .wav files in /music folder */
+static uint32_t track_count = 0;             /* Number of tracks in /music folder */
+static bool library_changed = false;         /* The library task has a new index ready */
 static int current_track_index = 0;          /* Current track index */
-static bool playing_smile = false;
-static bool normal_mode = true;
 
 /******************************************************************************/
 /*                              EXPORTED DATA                                 */
@@ -58,116 +119,527 @@ static bool normal_mode = true;
 /******************************************************************************/
 
 /*!
- * @brief  Load all .wav files from /music directory
+ * @brief  Take the track count of the current library
  */
 static void load_music_files(void) {
-    File dir = SD.open("/music");
-    while (true) {
-        File entry = dir.openNextFile();
-        if (!entry) {
+    track_count = music_library_count();
+#if 0  /* Just for debugging */
+    for (uint32_t i = 0; i < track_count; i++) {
+        Serial.printf("Found music file: %s\r\n", music_library_name(i));
+    }
+#endif
+
+    /* A rebuilt index may have moved the track to resume, follow its file.
+     * Without an index yet the position waits for the rebuild. */
+    if ((resume_offset != 0) && (track_count > 0) && (music_library_key(current_track_index) != resume_key)) {
+        uint32_t i = 0;
+        while ((i < track_count) && (music_library_key(i) != resume_key)) {
+            i++;
+        }
+        if (i < track_count) {
+            current_track_index = i;
+        }
+        else {
+            resume_offset = 0;
+        }
+    }
+
+    if (current_track_index >= (int)track_count) {
+        current_track_index = 0;
+        resume_offset = 0;
+    }
+}
+
+/*!
+ * @brief  Post a command to the play task and wake it
+ */
+static void audio_send(uint8_t type, uint32_t arg, const void *ptr) {
+    audio_command_t command;
+
+    if (audio_queue == NULL) {
+        return;
+    }
+
+    command.ptr = ptr;
+    command.arg = arg;
+    command.sent_us = micros();
+    command.type = type;
+    xQueueSend(audio_queue, &command, portMAX_DELAY);
+
+    /* Also ends a wait for ring blocks */
+    if (audio_task_handle != NULL) {
+        xTaskNotifyGive(audio_task_handle);
+    }
+}
+
+/*!
+ * @brief  Called from the library task once the index was rebuilt
+ */
+static void on_library_changed(void) {
+    audio_send(AUDIO_CMD_LIBRARY, 0, NULL);
+}
+
+/*!
+ * @brief  Move to another track, it starts from the beginning
+ */
+static void audio_change_track(int step) {
+    if (!is_running || (track_count == 0)) {
+        return;
+    }
+
+    current_track_index = (current_track_index + track_count + step) % track_count;
+    resume_offset = 0;
+    track_changed = true;
+
+    /* The track and where it starts change together, the one stopping saves no more */
+    save_position = false;
+    config_journal_lock();
+    system_config.play_index = current_track_index;
+    system_config.play_offset = 0;
+    system_config.play_key = 0;
+    config_journal_unlock();
+    save_configuration();
+}
+
+/*!
+ * @brief  Apply one command to the play task state
+ */
+static void audio_handle_command(const audio_command_t *command) {
+    switch (command->type) {
+    case AUDIO_CMD_PLAY:
+        is_running = true;
+        break;
+
+    case AUDIO_CMD_PAUSE:
+        is_running = false;
+        break;
+
+    case AUDIO_CMD_NEXT:
+        audio_change_track(1);
+        break;
+
+    case AUDIO_CMD_PREV:
+        audio_change_track(-1);
+        break;
+
+    case AUDIO_CMD_SEEK: {
+        /* Restart the current track at the requested position */
+        const music_track_t *track = music_library_track(current_track_index);
+        if ((audio_mode != AUDIO_MODE_MUSIC) || (track == NULL)) {
             break;
         }
+        resume_offset = (uint64_t)command->arg * track->sample_rate / 1000;
+        resume_key = music_library_key(current_track_index);
+        track_changed = true;
+        break;
+    }
 
-        if (!entry.isDirectory()) {
-            String name = entry.name();
-            if (name.endsWith(".wav") || name.endsWith(".WAV")) {
-                music_files.push_back(name);
-            #if 0  /* Just for debugging */
-                Serial.printf("Found music file: %s\r\n", name.c_str());
-            #endif
-            }
+    case AUDIO_CMD_SET_MODE:
+        audio_mode = command->arg;
+        is_running = (command->arg == AUDIO_MODE_SMILE);
+        break;
+
+    case AUDIO_CMD_LIBRARY:
+        library_changed = true;
+        break;
+
+    case AUDIO_CMD_EFFECT:
+        audio_mixer_play((const audio_clip_t *)command->ptr, command->arg & 0xFFFF, command->arg & AUDIO_EFFECT_LOOP);
+        break;
+
+    case AUDIO_CMD_EFFECT_STOP:
+        audio_mixer_stop_clip((const audio_clip_t *)command->ptr);
+        break;
+
+    case AUDIO_CMD_MUSIC_GAIN:
+        audio_mixer_set_music_gain(command->arg);
+        break;
+
+    case AUDIO_CMD_EQ:
+        if (audio_eq_set_preset(command->arg)) {
+            config_journal_lock();
+            system_config.eq_preset = command->arg;
+            config_journal_unlock();
+            save_configuration();
         }
+        break;
+
+    case AUDIO_CMD_CROSSFADE:
+        /* Takes effect from the next track queued */
+        config_journal_lock();
+        system_config.crossfade_ms = (command->arg < AUDIO_CROSSFADE_MAX_MS) ? command->arg : AUDIO_CROSSFADE_MAX_MS;
+        config_journal_unlock();
+        audio_reader_set_crossfade(system_config.crossfade_ms);
+        save_configuration();
+        break;
+
+    case AUDIO_CMD_SPEED:
+        /* Blocks already read keep their speed, the change is heard within the ring length */
+        config_journal_lock();
+        system_config.play_speed = (command->arg < AUDIO_SPEED_MIN) ? AUDIO_SPEED_MIN :
+                                   ((command->arg > AUDIO_SPEED_MAX) ? AUDIO_SPEED_MAX : command->arg);
+        config_journal_unlock();
+        audio_reader_set_speed(system_config.play_speed);
+        save_configuration();
+        break;
 
-        entry.close();
+    default:
+        return;
     }
 
-    dir.close();
+    Serial.printf("Audio command %u handled after %u us\r\n", command->type, (unsigned)(micros() - command->sent_us));
 }
 
 /*!
- * @brief  Play a single WAV file from SD card
+ * @brief  Handle queued commands, waiting up to wait ticks for the first one
  */
-static bool play_single_wav(const char* filename) {
-    File file;
-    file = SD.open(filename);
+static void audio_process_commands(TickType_t wait) {
+    audio_command_t command;
 
-    if (!file) {
-        Serial.println("File is NULL");
-        return false;
+    while (xQueueReceive(audio_queue, &command, wait) == pdTRUE) {
+        audio_handle_command(&command);
+        wait = 0;
     }
+}
 
-    wav_header_t wav_header;
-    file.read((uint8_t*)&wav_header, sizeof(wav_header_t));
+/*!
+ * @brief  Hand blocks the speaker has finished with back to the reader
+ */
+static void playback_reclaim(void) {
+    audio_block_t *block;
 
-    /* Validate WAV format */
-    if (memcmp(wav_header.RIFF, "RIFF", 4) ||
-        memcmp(wav_header.WAVEfmt, "WAVEfmt ", 8) ||
-        wav_header.audiofmt != 1 ||
-        wav_header.bit_per_sample < 8 ||
-        wav_header.bit_per_sample > 16 ||
-        wav_header.channel == 0 || wav_header.channel > 2) {
-        file.close();
+    while ((block = audio_ring_oldest(&audio_ring)) != NULL) {
+        if (block->submitted) {
+            /* The speaker still holds the newest submitted blocks */
+            if (speaker_queued <= M5.Speaker.isPlaying(AUDIO_CHANNEL)) {
+                break;
+            }
+            speaker_queued--;
+        }
 
-        Serial.println("File is invalid WAV formwat");
-        return false;
+        audio_ring_release(&audio_ring);
+        audio_reader_wake();
+    }
+}
+
+/*!
+ * @brief  Wait for a free slot in the speaker queue
+ */
+static void playback_wait_slot(void) {
+    while (M5.Speaker.isPlaying(AUDIO_CHANNEL) >= 2) {
+        playback_reclaim();
+        vTaskDelay(1);
+    }
+}
+
+/*!
+ * @brief  Queue a block on the speaker, it must stay untouched until played
+ */
+static void playback_play(audio_block_t *block) {
+    playback_wait_slot();
+
+    /* Blocks play back to back, an idle speaker starts right away */
+    uint32_t now = micros();
+    uint32_t frames = block->len / (block->channels * (block->bits >> 3));
+    if ((M5.Speaker.isPlaying(AUDIO_CHANNEL) == 0) || ((int32_t)(speaker_end_us - now) < 0)) {
+        speaker_end_us = now;
+    }
+    block->start_us = speaker_end_us;
+    speaker_end_us += (uint64_t)frames * 1000000 / block->sample_rate;
+
+    if (block->bits == 16) {
+        /* Equalize, show and play 16-bit audio */
+        if (block->channels == 1) {
+            audio_eq_process((int16_t *)block->data, block->len >> 1);
+            audio_spectrum_push((const int16_t *)block->data, block->len >> 1);
+        }
+        M5.Speaker.playRaw((const int16_t*)block->data, block->len >> 1, block->sample_rate, block->channels > 1, 1, AUDIO_CHANNEL);
+    }
+    else {
+        /* Play 8-bit audio */
+        M5.Speaker.playRaw((const uint8_t*)block->data, block->len, block->sample_rate, block->channels > 1, 1, AUDIO_CHANNEL);
     }
+}
+
+/*!
+ * @brief  Give an owned block to the speaker
+ */
+static void playback_submit(audio_block_t *block) {
+    if (block->len == 0) {
+        return;
+    }
+
+    playback_play(block);
+    block->submitted = true;
+    speaker_queued++;
+}
 
-    /* Seek to the data chunk */
-    file.seek(offsetof(wav_header_t, audiofmt) + wav_header.fmt_chunk_size);
-    sub_chunk_t sub_chunk;
-    file.read((uint8_t*)&sub_chunk, 8);
+/*!
+ * @brief  Play one block of sound effects alone
+ */
+static void playback_effects(void) {
+    /* With a free slot the speaker holds at most one of these blocks */
+    playback_wait_slot();
+
+    audio_block_t *block = &effect_blocks[effect_next];
+    effect_next = (effect_next + 1) % AUDIO_EFFECT_BLOCKS;
+
+    memset(block->data, 0, AUDIO_BLOCK_SIZE);
+    block->len = AUDIO_BLOCK_SIZE;
+    block->sample_rate = AUDIO_MIXER_RATE;
+    block->channels = 1;
+    block->bits = 16;
+    audio_mixer_render(block);
+    playback_play(block);
+}
+
+/*!
+ * @brief  Play the frames the limiter delays past the end of the stream
+ * @param  Last block of the stream, for its format
+ */
+static void playback_drain(const audio_block_t *last) {
+    playback_wait_slot();
 
-    while (memcmp(sub_chunk.identifier, "data", 4)) {
-        if (!file.seek(sub_chunk.chunk_size, SeekMode::SeekCur)) break;
-        file.read((uint8_t*)&sub_chunk, 8);
+    audio_block_t *block = &effect_blocks[effect_next];
+    effect_next = (effect_next + 1) % AUDIO_EFFECT_BLOCKS;
+
+    block->len = audio_loudness_drain((int16_t *)block->data, AUDIO_BLOCK_SIZE >> 1) << 1;
+    if (block->len == 0) {
+        return;
     }
+    block->sample_rate = last->sample_rate;
+    block->channels = 1;
+    block->bits = 16;
+    audio_mixer_render(block);
+    playback_play(block);
+}
 
-    if (memcmp(sub_chunk.identifier, "data", 4)) {
-        file.close();
-        Serial.println("File chunk error");
-        return false;
+/*!
+ * @brief  Wait for the next command, sound effects keep playing meanwhile
+ */
+static void audio_wait_command(void) {
+    while (audio_mixer_active() && (uxQueueMessagesWaiting(audio_queue) == 0)) {
+        playback_effects();
     }
 
-    /* Start playing audio data */
-    int32_t data_len = sub_chunk.chunk_size;
-    bool flg_16bit = (wav_header.bit_per_sample >> 4);
+    audio_process_commands(portMAX_DELAY);
+}
 
-    size_t idx = 0;
-    while (data_len > 0) {
-        if (next_track_requested) {
-            break;
+/*!
+ * @brief  Let a fade play out and stop the speaker, what follows is silence anyway
+ */
+static void playback_stop(const audio_fade_t *fade) {
+    if (fade->fading) {
+        vTaskDelay(pdMS_TO_TICKS(AUDIO_FADE_MS) + 1);
+    }
+
+    M5.Speaker.stop(AUDIO_CHANNEL);
+    speaker_end_us = micros();
+}
+
+/*!
+ * @brief  Fade out what the speaker is playing, silence the rest and stop it
+ * @param  Current track and its position if none of its blocks were submitted
+ * @retval Source frame of the first frame of the track that was not heard
+ */
+static uint32_t playback_cut(uint16_t track_id, uint32_t position) {
+    audio_fade_t fade = { micros(), 0, 0, false };
+
+    position = audio_fade_cut(&audio_ring, track_id, position, &fade);
+    playback_stop(&fade);
+    return position;
+}
+
+/*!
+ * @brief  Fade out the sound effect blocks the speaker holds and stop it
+ */
+static void playback_cut_effects(void) {
+    audio_fade_t fade = { micros(), 0, 0, false };
+    uint32_t held = M5.Speaker.isPlaying(AUDIO_CHANNEL);
+
+    /* The speaker holds the newest blocks, go through them oldest first */
+    held = (held < AUDIO_EFFECT_BLOCKS) ? held : AUDIO_EFFECT_BLOCKS;
+    for (uint32_t i = 0; i < held; i++) {
+        audio_block_t *block = &effect_blocks[(effect_next + AUDIO_EFFECT_BLOCKS - held + i) % AUDIO_EFFECT_BLOCKS];
+        if (block->len > 0) {
+            audio_fade_block(block, &fade);
         }
+    }
+
+    playback_stop(&fade);
+}
+
+/*!
+ * @brief  Persist the playback position so the track resumes after a power cycle
+ */
+static void playback_save_position(void) {
+    position_saved_ms = millis();
+    if (save_position && (system_config.play_offset != track_position)) {
+        config_journal_lock();
+        system_config.play_offset = track_position;
+        system_config.play_key = music_library_key(current_track_index);
+        config_journal_unlock();
+        save_configuration();
+    }
+}
+
+/*!
+ * @brief  Get a new track id, 0 is never used
+ */
+static uint16_t playback_new_track_id(void) {
+    if (++track_id_seq == 0) {
+        track_id_seq = 1;
+    }
+
+    return track_id_seq;
+}
+
+/*!
+ * @brief  Queue the track to play after the current one for gapless playback
+ */
+static void playback_queue_next(const char *next_filename) {
+    queued_track_id = 0;
+    if (gapless_enabled && (next_filename != NULL)) {
+        queued_track_id = playback_new_track_id();
+        strlcpy(queued_path, next_filename, sizeof(queued_path));
+        audio_reader_queue_next(queued_path, queued_track_id, next_gain);
+    }
+}
+
+/*!
+ * @brief  Play a single WAV file from SD card
+ * @param  File to play, the one to queue behind it for gapless playback, may be NULL,
+ *         source frame to start from and the mode it belongs to
+ */
+static bool play_single_wav(const char* filename, const char *next_filename, uint32_t start_frame, uint8_t mode) {
+    uint16_t track_id;
+    uint32_t underruns = 0;
+    uint32_t submitted_end = start_frame;     /* Source frame after the last block given to the speaker */
+    bool paused = false;
+    bool fade_in = false;
+    bool started = false;
+    bool starving = false;
+    bool ended = false;
+    bool result = true;
+
+    track_position = start_frame;
+    position_saved_ms = millis();
+    if ((queued_track_id != 0) && (start_frame == 0) && !strcmp(queued_path, filename)) {
+        /* Already streaming right behind the previous track */
+        track_id = queued_track_id;
+        started = true;
+    }
+    else {
+        track_id = playback_new_track_id();
+        audio_reader_open(filename, track_id, start_frame, track_gain);
+        audio_loudness_reset();
+    }
+
+    playback_queue_next(next_filename);
+
+    while (!ended) {
+        playback_reclaim();
+        audio_process_commands(0);
 
-        if ((!normal_mode) && (!playing_smile)) {
+        if (track_changed || (audio_mode != mode)) {
             break;
         }
 
         if (!is_running) {
-            M5.delay(10);
-            if (playing_smile) {
-                break;
+            if (!paused) {
+                /* Stop reading, the track is reopened where output stopped */
+                paused = true;
+                track_position = playback_cut(track_id, submitted_end);
+                audio_reader_stop();
+                queued_track_id = 0;
+                playback_save_position();
             }
+
+            /* Sleep until the next command */
+            audio_wait_command();
             continue;
         }
 
-        size_t len = data_len < buf_size ? data_len : buf_size;
-        len = file.read(wav_data[idx], len);
-        data_len -= len;
+        if (paused) {
+            paused = false;
+            fade_in = true;
+            started = false;
+            submitted_end = track_position;
+            track_id = playback_new_track_id();
+            audio_reader_open(filename, track_id, track_position, track_gain);
+            audio_loudness_reset();
+            playback_queue_next(next_filename);
+            continue;
+        }
 
-        if (flg_16bit) {
-            /* Play 16-bit audio */
-            M5.Speaker.playRaw((const int16_t*)wav_data[idx], len >> 1, wav_header.sample_rate, wav_header.channel > 1, 1, 0);
+        audio_block_t *block = audio_ring_read_acquire(&audio_ring);
+        if (block == NULL) {
+            /* Speaker ran dry before the reader caught up */
+            if (started && !starving && (M5.Speaker.isPlaying(AUDIO_CHANNEL) == 0)) {
+                starving = true;
+                underruns++;
+            }
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+            continue;
         }
-        else {
-            /* Play 8-bit audio */
-            M5.Speaker.playRaw((const uint8_t*)wav_data[idx], len, wav_header.sample_rate, wav_header.channel > 1, 1, 0);
+
+        if (block->track_id != track_id) {
+            continue;    /* Stale block of an aborted track, released by playback_reclaim */
         }
 
-        idx = (idx + 1) % buf_num;
+        if ((block->bits == 16) && (block->channels == 1)) {
+            /* Output lags the block by the frames the limiter held, so does its source frame */
+            uint32_t back = audio_block_frame(block, audio_loudness_held()) - block->frame;
+            block->frame = (block->frame > back) ? block->frame - back : 0;
+            block->len = audio_loudness_process((int16_t *)block->data, block->len >> 1, block->gain) << 1;
+        }
+
+        if (fade_in && (block->len > 0)) {
+            uint32_t frames = block->len / (block->channels * (block->bits >> 3));
+            uint32_t ramp = block->sample_rate * AUDIO_FADE_MS / 1000;
+            audio_fade_ramp(block, 0, (ramp < frames) ? ramp : frames, 0, 1, ramp);
+            fade_in = false;
+        }
+
+        audio_mixer_render(block);
+
+        starving = false;
+        started = true;
+        playback_submit(block);
+
+        /* Everything before this block has been handed to the speaker */
+        track_position = block->frame;
+        submitted_end = audio_block_frame(block, block->len / (block->channels * (block->bits >> 3)));
+        if (millis() - position_saved_ms >= AUDIO_RESUME_SAVE_MS) {
+            playback_save_position();
+        }
+
+        if (block->flags & AUDIO_BLOCK_FLAG_END) {
+            ended = true;
+            result = !(block->flags & AUDIO_BLOCK_FLAG_ERROR);
+
+            /* Nothing streams behind this track, play what the limiter still holds */
+            if (queued_track_id == 0) {
+                playback_drain(block);
+            }
+        }
     }
 
-    file.close();
-    Serial.printf("Play file %s success\r\n", filename);
+    if (!ended) {
+        playback_cut(track_id, submitted_end);
+        audio_reader_stop();
+        queued_track_id = 0;
+    }
+
+    underrun_count += underruns;
+    if (!result) {
+        return false;
+    }
+
+    Serial.printf("Play file %s success, underruns %u (total %u)\r\n", filename, underruns, underrun_count);
+    audio_loudness_report();
+    audio_mixer_report();
+    audio_eq_report();
     return true;
 }
 
@@ -176,41 +648,122 @@ static bool play_single_wav(const char* filename) {
  */
 static void play_audio_task(void *arg) {
     while (1) {
-        if (playing_smile) {
-            normal_mode = false;
-            play_single_wav("/smile_sound.wav");
-            continue;
+        audio_process_commands(0);
+
+        /* Pick up a rebuilt library between tracks */
+        if (library_changed) {
+            library_changed = false;
+            if (music_library_apply()) {
+                load_music_files();
+            }
         }
 
-        if (is_running && !music_files.empty()) {
-            normal_mode = true;
-            const String &file_to_play = music_files[current_track_index];
-            Serial.printf("Now playing: %s\r\n", file_to_play.c_str());
-            lvgl_set_song_name(file_to_play.c_str());
-            String full_path = "/music/" + file_to_play;
+        if (is_running && (audio_mode == AUDIO_MODE_SMILE)) {
+            /* Loop the smile sound from RAM, stream it if it is too large */
+            const audio_clip_t *clip = clip_cache_get("/smile_sound.wav");
+            if (clip == NULL) {
+                track_gain = AUDIO_LOUDNESS_UNITY;
+                next_gain = AUDIO_LOUDNESS_UNITY;
+                play_single_wav("/smile_sound.wav", "/smile_sound.wav", 0, AUDIO_MODE_SMILE);
+                continue;
+            }
+
+            audio_mixer_play(clip, AUDIO_MIXER_UNITY, true);
+            while (is_running && (audio_mode == AUDIO_MODE_SMILE)) {
+                audio_wait_command();
+            }
+
+            /* Leave at once, the blocks already queued fade out like music does */
+            audio_mixer_stop_clip(clip);
+            playback_cut_effects();
+            continue;
+        }
 
-            play_single_wav(full_path.c_str());
+        if (is_running && (track_count > 0)) {
+            char full_path[AUDIO_PATH_MAX];
+            char next_path[AUDIO_PATH_MAX];
+            const char *next = next_path;
+            uint32_t offset = resume_offset;
+
+            current_track_index %= track_count;
+            Serial.printf("Now playing: %s\r\n", music_library_name(current_track_index));
+            lvgl_set_song_name(music_library_name(current_track_index));
+            music_library_path(current_track_index, full_path, sizeof(full_path));
+            if (!music_library_path((current_track_index + 1) % track_count, next_path, sizeof(next_path))) {
+                next = NULL;
+            }
 
-            /* If user did not request next manually, go to next automatically */
-            if (!next_track_requested) {
-                current_track_index = (current_track_index + 1) % music_files.size();
-                system_config.play_index = current_track_index;
-                save_configuration();
+            resume_offset = 0;
+            track_changed = false;
+            save_position = true;
+            track_gain = audio_loudness_gain(music_library_track(current_track_index));
+            next_gain = audio_loudness_gain(music_library_track((current_track_index + 1) % track_count));
+            bool played = play_single_wav(full_path, next, offset, AUDIO_MODE_MUSIC);
+            save_position = false;
+
+            if (audio_mode != AUDIO_MODE_MUSIC) {
+                /* Left for smile mode, continue this track when coming back */
+                resume_offset = track_position;
+                resume_key = music_library_key(current_track_index);
+            }
+            else if (!track_changed) {
+                /* If user did not request next manually, go to next automatically */
+                current_track_index = (current_track_index + 1) % track_count;
             }
 
-            next_track_requested = false;
+            /* The track to play next and where it starts, 0 unless seeking or interrupted */
+            config_journal_lock();
+            system_config.play_index = current_track_index;
+            system_config.play_offset = resume_offset;
+            system_config.play_key = resume_offset ? resume_key : 0;
+            config_journal_unlock();
+            save_configuration();
+
+            /* Don't spin over unreadable files */
+            if (!played) {
+                audio_process_commands(pdMS_TO_TICKS(10));
+            }
+            continue;
         }
-        delay(10);
+
+        /* Nothing to play, sleep until the next command */
+        audio_wait_command();
     }
 }
 
+/*!
+ * @brief  Create the ring and the reader task once
+ */
+static void audio_pipeline_init(void) {
+    if (pipeline_ready) {
+        return;
+    }
+
+    audio_queue = xQueueCreate(8, sizeof(audio_command_t));
+    audio_ring_init(&audio_ring);
+    audio_reader_init(&audio_ring, AUDIO_GAPLESS_TAIL_MS);
+    pipeline_ready = true;
+}
+
 /*!
  * @brief  Play splash audio
  */
 void audio_play_splash(void) {
+    audio_pipeline_init();
+
+    /* The play task does not exist yet, this task may use the mixer */
+    const audio_clip_t *clip = clip_cache_get("/hi_shin.wav");
+    if (clip != NULL) {
+        audio_mixer_play(clip, AUDIO_MIXER_UNITY, false);
+        while (audio_mixer_active()) {
+            playback_effects();
+        }
+        return;
+    }
+
     is_running = true;
-    play_single_wav("/hi_shin.wav");
-    // play_single_wav("/funny.wav");
+    play_single_wav("/hi_shin.wav", NULL, 0, AUDIO_MODE_MUSIC);
+    // play_single_wav("/funny.wav", NULL, 0, AUDIO_MODE_MUSIC);
     is_running = false;
 }
 
@@ -218,54 +771,111 @@ void audio_play_splash(void) {
  * @brief  Play smile mode audio
  */
 void audio_set_smile_mode(bool playing) {
-    is_running = playing;
-    playing_smile = playing;
+    audio_send(AUDIO_CMD_SET_MODE, playing ? AUDIO_MODE_SMILE : AUDIO_MODE_MUSIC, NULL);
 }
 
 /*!
  * @brief  Set running state
  */
 void audio_set_running(bool running) {
-    is_running = running;
+    audio_send(running ? AUDIO_CMD_PLAY : AUDIO_CMD_PAUSE, 0, NULL);
+}
+
+/*!
+ * @brief  Enable gapless playback
+ */
+void audio_set_gapless(bool enable) {
+    gapless_enabled = enable;
 }
 
 /*!
  * @brief  Request play next track
  */
 void audio_next_request(void) {
-    if (is_running && !music_files.empty()) {
-        next_track_requested = true;
-        current_track_index = (current_track_index + 1) % music_files.size();
-        Serial.println("Next track requested");
-        system_config.play_index = current_track_index;
-        save_configuration();
-    }
+    Serial.println("Next track requested");
+    audio_send(AUDIO_CMD_NEXT, 0, NULL);
 }
 
 /*!
  * @brief  Request play prev track
  */
 void audio_prev_request(void) {
-    if (is_running && !music_files.empty()) {
-        next_track_requested = true;
-        current_track_index = (current_track_index + music_files.size() - 1) % music_files.size();
-        Serial.println("Prev track requested");
-        system_config.play_index = current_track_index;
-        save_configuration();
-    }
+    Serial.println("Prev track requested");
+    audio_send(AUDIO_CMD_PREV, 0, NULL);
+}
+
+/*!
+ * @brief  Play a sound effect over whatever is playing
+ */
+void audio_play_effect(const audio_clip_t *clip, uint16_t gain, bool loop) {
+    audio_send(AUDIO_CMD_EFFECT, gain | (loop ? AUDIO_EFFECT_LOOP : 0), clip);
+}
+
+/*!
+ * @brief  Stop a sound effect
+ */
+void audio_stop_effect(const audio_clip_t *clip) {
+    audio_send(AUDIO_CMD_EFFECT_STOP, 0, clip);
+}
+
+/*!
+ * @brief  Set the music level under the sound effects
+ */
+void audio_set_music_gain(uint16_t gain) {
+    audio_send(AUDIO_CMD_MUSIC_GAIN, gain, NULL);
+}
+
+/*!
+ * @brief  Request a position in the current track
+ */
+void audio_seek_request(uint32_t position_ms) {
+    audio_send(AUDIO_CMD_SEEK, position_ms, NULL);
+}
+
+/*!
+ * @brief  Select an equalizer preset, it is saved with the configuration
+ */
+void audio_set_eq_preset(uint8_t preset) {
+    audio_send(AUDIO_CMD_EQ, preset, NULL);
+}
+
+/*!
+ * @brief  Set the crossfade between tracks, it is saved with the configuration
+ */
+void audio_set_crossfade(uint32_t ms) {
+    audio_send(AUDIO_CMD_CROSSFADE, ms, NULL);
+}
+
+/*!
+ * @brief  Set the playback speed of music, it is saved with the configuration
+ */
+void audio_set_speed(uint16_t speed) {
+    audio_send(AUDIO_CMD_SPEED, speed, NULL);
 }
 
 /*!
  * @brief  Initialize audio process
  */
 void audio_init(void) {
-    load_music_files();  /* Load all .wav files from /music */
+    audio_pipeline_init();
 
     /* Load the last index */
     if (system_config.magic == MAGIC_NUMBER) {
         current_track_index = system_config.play_index;
+        resume_offset = system_config.play_offset;
+        resume_key = system_config.play_key;
+    }
+    audio_reader_set_crossfade(system_config.crossfade_ms);
+    audio_reader_set_speed(system_config.play_speed ? system_config.play_speed : AUDIO_SPEED_NORMAL);
+    if (!audio_eq_set_preset(system_config.eq_preset)) {
+        audio_eq_set_preset(AUDIO_EQ_PRESET_SPEAKER);
     }
 
+    /* Load all .wav and .flac files from /music, the index is checked against the directory in background */
+    music_library_load();
+    load_music_files();
+    music_library_refresh(on_library_changed);
+
     /* Create audio player task */
-    xTaskCreatePinnedToCore(play_audio_task, "PLAY", 4096, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(play_audio_task, "PLAY", 4096, NULL, 3, &audio_task_handle, 0);
 }
@@ -16,31 +16,15 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdint.h>
+#include "audio_mixer.hpp"
+#include "audio_eq.hpp"
+#include "audio_stretch.hpp"
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
-/* WAV file header structure */
-struct __attribute__((packed)) wav_header_t {
-    char RIFF[4];
-    uint32_t chunk_size;
-    char WAVEfmt[8];
-    uint32_t fmt_chunk_size;
-    uint16_t audiofmt;
-    uint16_t channel;
-    uint32_t sample_rate;
-    uint32_t byte_per_sec;
-    uint16_t block_size;
-    uint16_t bit_per_sample;
-};
-
-/* WAV subchunk structure */
-struct __attribute__((packed)) sub_chunk_t {
-    char identifier[4];
-    uint32_t chunk_size;
-    uint8_t data[1];
-};
+
 
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
@@ -79,6 +63,14 @@ void audio_set_smile_mode(bool playing);
  */
 void audio_set_running(bool running);
 
+/*!
+ * @brief  Enable gapless playback, the next track is opened and pre-read
+ *         AUDIO_GAPLESS_TAIL_MS before the current one ends
+ * @param  Enable
+ * @retval None
+ */
+void audio_set_gapless(bool enable);
+
 /*!
  * @brief  Request play next track
  * @param  None
@@ -93,6 +85,58 @@ void audio_next_request(void);
  */
 void audio_prev_request(void);
 
+/*!
+ * @brief  Play a sound effect over whatever is playing, the clip must stay
+ *         valid until it ends or is stopped
+ * @param  Clip, gain (AUDIO_MIXER_UNITY is 1.0) and whether it repeats
+ * @retval None
+ */
+void audio_play_effect(const audio_clip_t *clip, uint16_t gain, bool loop);
+
+/*!
+ * @brief  Stop a sound effect
+ * @param  Clip, NULL stops all effects
+ * @retval None
+ */
+void audio_stop_effect(const audio_clip_t *clip);
+
+/*!
+ * @brief  Set the music level under the sound effects
+ * @param  Gain, AUDIO_MIXER_UNITY is 1.0
+ * @retval None
+ */
+void audio_set_music_gain(uint16_t gain);
+
+/*!
+ * @brief  Request a position in the current track, ignored outside music mode
+ * @param  Position from the start of the track in ms
+ * @retval None
+ */
+void audio_seek_request(uint32_t position_ms);
+
+/*!
+ * @brief  Select an equalizer preset, it is saved with the configuration
+ * @param  AUDIO_EQ_PRESET_xxx
+ * @retval None
+ */
+void audio_set_eq_preset(uint8_t preset);
+
+/*!
+ * @brief  Set the crossfade between tracks, it is saved with the configuration.
+ *         Needs gapless playback, the card may not allow the full length.
+ * @param  Length in ms, 0 for gapless transitions, at most AUDIO_CROSSFADE_MAX_MS
+ * @retval None
+ */
+void audio_set_crossfade(uint32_t ms);
+
+/*!
+ * @brief  Set the playback speed of music without changing its pitch, it is
+ *         saved with the configuration
+ * @param  Speed in percent, AUDIO_SPEED_MIN to AUDIO_SPEED_MAX
+ * @retval None
+ */
+void audio_set_speed(uint16_t speed);
+
 /*!
  * @brief  Initialize audio process
  * @param  None
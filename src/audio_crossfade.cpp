@@ -0,0 +1,86 @@
+/*
+ *  audio_crossfade.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <math.h>
+#include "audio_crossfade.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static int16_t crossfade_sine[AUDIO_CROSSFADE_STEPS + 1];    /* Q15 quarter sine */
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Build the quarter sine table the gains are read from
+ */
+void audio_crossfade_init(void) {
+    for (int i = 0; i <= AUDIO_CROSSFADE_STEPS; i++) {
+        crossfade_sine[i] = lroundf(sinf((float)M_PI / 2 * i / AUDIO_CROSSFADE_STEPS) * 32767.0f);
+    }
+}
+
+/*!
+ * @brief  Q15 gains of both tracks at a fade position, equal power
+ */
+void audio_crossfade_gains(uint32_t pos, uint32_t len, int32_t *out_gain, int32_t *in_gain) {
+    uint32_t phase = ((uint64_t)pos * AUDIO_CROSSFADE_STEPS << 8) / len;
+    uint32_t index = phase >> 8;
+    int32_t frac = phase & 0xFF;
+    const int16_t *sine = crossfade_sine;
+
+    *in_gain = sine[index] + (((sine[index + 1] - sine[index]) * frac) >> 8);
+    *out_gain = sine[AUDIO_CROSSFADE_STEPS - index] +
+                (((sine[AUDIO_CROSSFADE_STEPS - index - 1] - sine[AUDIO_CROSSFADE_STEPS - index]) * frac) >> 8);
+}
+
+/*!
+ * @brief  Mix the head of the next track into the tail of the current one
+ */
+uint32_t audio_crossfade_mix(audio_crossfade_t *fade, int16_t *out, uint32_t count, int32_t out_scale,
+                             const int16_t *in, uint32_t mixed, int32_t in_scale) {
+    uint32_t total = (count > mixed) ? count : mixed;
+
+    for (uint32_t i = 0; i < total; i++) {
+        int32_t out_gain = 0;
+        int32_t in_gain = 32767;
+
+        if ((i < count) && (fade->pos < fade->len)) {
+            audio_crossfade_gains(fade->pos++, fade->len, &out_gain, &in_gain);
+        }
+
+        int32_t value = (i < count) ? out[i] * ((out_gain * out_scale) >> 15) : 0;
+        value += (i < mixed) ? in[i] * ((in_gain * in_scale) >> 15) : 0;
+        value >>= 15;
+        out[i] = value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : value);
+    }
+    return total;
+}
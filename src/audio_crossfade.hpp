@@ -0,0 +1,73 @@
+/*
+ *  audio_crossfade.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef __AUDIO_CROSSFADE_HPP_
+#define __AUDIO_CROSSFADE_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define AUDIO_CROSSFADE_STEPS 256    /* Segments of the quarter sine table */
+
+/* Equal power fade of the current track into the next */
+typedef struct {
+    uint32_t len;                /* Frames of the running fade, 0 if not fading */
+    uint32_t pos;                /* Frames of the fade already mixed */
+} audio_crossfade_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Build the quarter sine table the gains are read from
+ * @param  None
+ * @retval None
+ */
+void audio_crossfade_init(void);
+
+/*!
+ * @brief  Q15 gains of both tracks at a fade position, equal power
+ * @param  Frame of the fade, fade length and where to put the gains
+ * @retval None
+ */
+void audio_crossfade_gains(uint32_t pos, uint32_t len, int32_t *out_gain, int32_t *in_gain);
+
+/*!
+ * @brief  Mix the head of the next track into the tail of the current one.
+ *         Frames of the current track past the fade are silenced, frames of the
+ *         next track past the end of the current one play at full gain.
+ * @param  Fade state, current track samples in place, their Q15 scale,
+ *         next track samples and their Q15 scale
+ * @retval Frames in the mixed buffer
+ */
+uint32_t audio_crossfade_mix(audio_crossfade_t *fade, int16_t *out, uint32_t count, int32_t out_scale,
+                             const int16_t *in, uint32_t mixed, int32_t in_scale);
+
+/******************************************************************************/
+
+#endif /* __AUDIO_CROSSFADE_HPP_ */
@@ -0,0 +1,392 @@
+/*
+ *  audio_decoder.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include "audio_decoder.hpp"
+#include "audio_normalize.hpp"
+#include "audio_flac.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define IMA_INDEX_MAX 88
+#define MS_DELTA_MIN 16
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static const int8_t ima_index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const int16_t ima_step_table[IMA_INDEX_MAX + 1] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+/* Q8 factor applied to the MS ADPCM delta after each nibble */
+static const int16_t ms_adapt_table[16] = {
+    230, 230, 230, 230, 307, 409, 512, 614, 768, 614, 512, 409, 307, 230, 230, 230
+};
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static inline int16_t rd16(const uint8_t *p) {
+    return (int16_t)(p[0] | (p[1] << 8));
+}
+
+static inline int32_t decoder_saturate(int32_t value) {
+    return value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : value);
+}
+
+/*!
+ * @brief  Uncompressed formats, 8 to 32-bit integer or 32-bit float
+ */
+static bool pcm_open(audio_decoder_t *dec) {
+    const wav_info_t *info = &dec->info;
+
+    if (info->format == WAV_FORMAT_FLOAT) {
+        return info->bits == 32;
+    }
+
+    return (info->bits >= 8) && (info->bits <= 32);
+}
+
+/*!
+ * @brief  Read whole frames and convert them
+ */
+static uint32_t pcm_decode(audio_decoder_t *dec, int16_t *out, uint32_t max) {
+    uint32_t align = dec->info.block_align;
+    uint32_t frames = audio_decoder_remaining(dec);
+
+    if (frames > max) {
+        frames = max;
+    }
+    if (frames > sizeof(dec->raw) / align) {
+        frames = sizeof(dec->raw) / align;
+    }
+
+    size_t len = frames * align;
+    size_t got = dec->source.read(dec->source.ctx, dec->raw, len);
+    if (got != len) {
+        dec->error = true;
+        frames = got / align;
+    }
+
+    normalize_mono16(dec->raw, out, frames, &dec->info);
+    dec->frame += frames;
+    return frames;
+}
+
+/*!
+ * @brief  Continue from any frame with a single seek
+ */
+static bool pcm_seek(audio_decoder_t *dec, uint32_t frame) {
+    if ((frame >= dec->frames) || !dec->source.seek(dec->source.ctx, frame * dec->info.block_align)) {
+        return false;
+    }
+
+    dec->frame = frame;
+    return true;
+}
+
+/*!
+ * @brief  Read the next compressed block, false at the end of the track
+ */
+static bool adpcm_read_block(audio_decoder_t *dec) {
+    uint32_t align = dec->info.block_align;
+
+    if (dec->source.read(dec->source.ctx, dec->raw, align) != align) {
+        dec->error = true;
+        return false;
+    }
+
+    dec->block_frame = 0;
+    return true;
+}
+
+/*!
+ * @brief  Decode frames block by block, the backend handles headers and nibbles.
+ *         Without output the frames are only stepped over.
+ */
+static uint32_t adpcm_decode(audio_decoder_t *dec, int16_t *out, uint32_t max,
+                             bool (*load)(audio_decoder_t *), void (*run)(audio_decoder_t *, int16_t *, uint32_t)) {
+    uint32_t count = 0;
+    uint32_t left = audio_decoder_remaining(dec);
+
+    if (max > left) {
+        max = left;
+    }
+
+    while (count < max) {
+        if ((dec->block_frame >= dec->info.block_frames) && !load(dec)) {
+            break;
+        }
+
+        uint32_t n = dec->info.block_frames - dec->block_frame;
+        if (n > max - count) {
+            n = max - count;
+        }
+
+        run(dec, (out != NULL) ? out + count : NULL, n);
+        dec->block_frame += n;
+        dec->frame += n;
+        count += n;
+    }
+
+    return count;
+}
+
+/*!
+ * @brief  Continue from the block holding a frame, stepping over the frames before it
+ */
+static bool adpcm_seek(audio_decoder_t *dec, uint32_t frame) {
+    uint32_t block = frame / dec->info.block_frames;
+
+    if ((frame >= dec->frames) || !dec->source.seek(dec->source.ctx, block * dec->info.block_align)) {
+        return false;
+    }
+
+    dec->frame = block * dec->info.block_frames;
+    dec->block_frame = dec->info.block_frames;
+    dec->ops->decode(dec, NULL, frame - dec->frame);
+    return true;
+}
+
+/*!
+ * @brief  Start with no block read
+ */
+static bool adpcm_open(audio_decoder_t *dec) {
+    dec->block_frame = dec->info.block_frames;
+    return true;
+}
+
+/*!
+ * @brief  IMA block header: the first sample and the step index of each channel
+ */
+static bool ima_load(audio_decoder_t *dec) {
+    if (!adpcm_read_block(dec)) {
+        return false;
+    }
+
+    for (uint32_t c = 0; c < dec->info.channels; c++) {
+        const uint8_t *header = dec->raw + 4 * c;
+        if (header[2] > IMA_INDEX_MAX) {
+            dec->error = true;
+            return false;
+        }
+        dec->adpcm[c].sample1 = rd16(header);
+        dec->adpcm[c].step = header[2];
+    }
+
+    return true;
+}
+
+/*!
+ * @brief  Apply one IMA nibble to a channel
+ */
+static inline int32_t ima_nibble(audio_adpcm_channel_t *state, uint32_t nibble) {
+    int32_t step = ima_step_table[state->step];
+    int32_t diff = step >> 3;
+
+    if (nibble & 4) {
+        diff += step;
+    }
+    if (nibble & 2) {
+        diff += step >> 1;
+    }
+    if (nibble & 1) {
+        diff += step >> 2;
+    }
+
+    state->sample1 = decoder_saturate((nibble & 8) ? state->sample1 - diff : state->sample1 + diff);
+    state->step += ima_index_table[nibble];
+    state->step = (state->step < 0) ? 0 : ((state->step > IMA_INDEX_MAX) ? IMA_INDEX_MAX : state->step);
+    return state->sample1;
+}
+
+/*!
+ * @brief  IMA frames from the current block position, each channel has its
+ *         own 4 byte groups of 8 samples, low nibble first
+ */
+static void ima_run(audio_decoder_t *dec, int16_t *out, uint32_t frames) {
+    uint32_t channels = dec->info.channels;
+
+    for (uint32_t i = 0; i < frames; i++) {
+        uint32_t k = dec->block_frame + i;
+        int32_t mix = 0;
+
+        if (k == 0) {
+            /* The header sample */
+            for (uint32_t c = 0; c < channels; c++) {
+                mix += dec->adpcm[c].sample1;
+            }
+        }
+        else {
+            uint32_t sample = k - 1;
+            const uint8_t *group = dec->raw + 4 * channels * (1 + (sample >> 3)) + ((sample & 7) >> 1);
+            for (uint32_t c = 0; c < channels; c++) {
+                uint8_t byte = group[4 * c];
+                mix += ima_nibble(&dec->adpcm[c], (sample & 1) ? byte >> 4 : byte & 0x0F);
+            }
+        }
+
+        if (out != NULL) {
+            out[i] = (channels > 1) ? mix >> 1 : mix;
+        }
+    }
+}
+
+static uint32_t ima_decode(audio_decoder_t *dec, int16_t *out, uint32_t max) {
+    return adpcm_decode(dec, out, max, ima_load, ima_run);
+}
+
+/*!
+ * @brief  MS block header: predictor, delta and the first two samples of each channel
+ */
+static bool ms_load(audio_decoder_t *dec) {
+    uint32_t channels = dec->info.channels;
+
+    if (!adpcm_read_block(dec)) {
+        return false;
+    }
+
+    for (uint32_t c = 0; c < channels; c++) {
+        uint8_t predictor = dec->raw[c];
+        if (predictor >= WAV_MS_ADPCM_COEFS) {
+            dec->error = true;
+            return false;
+        }
+
+        audio_adpcm_channel_t *state = &dec->adpcm[c];
+        state->coef1 = wav_ms_adpcm_coefs[predictor][0];
+        state->coef2 = wav_ms_adpcm_coefs[predictor][1];
+        state->step = rd16(dec->raw + channels + 2 * c);
+        state->sample1 = rd16(dec->raw + 3 * channels + 2 * c);
+        state->sample2 = rd16(dec->raw + 5 * channels + 2 * c);
+    }
+
+    return true;
+}
+
+/*!
+ * @brief  Apply one MS nibble to a channel
+ */
+static inline int32_t ms_nibble(audio_adpcm_channel_t *state, uint32_t nibble) {
+    int32_t predicted = (state->sample1 * state->coef1 + state->sample2 * state->coef2) >> 8;
+    int32_t signed_nibble = (nibble & 8) ? (int32_t)nibble - 16 : (int32_t)nibble;
+    int32_t sample = decoder_saturate(predicted + signed_nibble * state->step);
+
+    state->sample2 = state->sample1;
+    state->sample1 = sample;
+    state->step = (ms_adapt_table[nibble] * state->step) >> 8;
+    if (state->step < MS_DELTA_MIN) {
+        state->step = MS_DELTA_MIN;
+    }
+    return sample;
+}
+
+/*!
+ * @brief  MS frames from the current block position, the two header samples
+ *         come first, oldest first, then nibbles interleaved by channel,
+ *         high nibble first
+ */
+static void ms_run(audio_decoder_t *dec, int16_t *out, uint32_t frames) {
+    uint32_t channels = dec->info.channels;
+    const uint8_t *data = dec->raw + 7 * channels;
+
+    for (uint32_t i = 0; i < frames; i++) {
+        uint32_t k = dec->block_frame + i;
+        int32_t mix = 0;
+
+        for (uint32_t c = 0; c < channels; c++) {
+            if (k == 0) {
+                mix += dec->adpcm[c].sample2;
+            }
+            else if (k == 1) {
+                mix += dec->adpcm[c].sample1;
+            }
+            else {
+                uint32_t n = (k - 2) * channels + c;
+                uint8_t byte = data[n >> 1];
+                mix += ms_nibble(&dec->adpcm[c], (n & 1) ? byte & 0x0F : byte >> 4);
+            }
+        }
+
+        if (out != NULL) {
+            out[i] = (channels > 1) ? mix >> 1 : mix;
+        }
+    }
+}
+
+static uint32_t ms_decode(audio_decoder_t *dec, int16_t *out, uint32_t max) {
+    return adpcm_decode(dec, out, max, ms_load, ms_run);
+}
+
+/* Backends by format tag */
+static const audio_decoder_ops_t decoder_backends[] = {
+    { WAV_FORMAT_PCM,       "PCM",       pcm_open,   pcm_decode, pcm_seek,   NULL },
+    { WAV_FORMAT_FLOAT,     "float",     pcm_open,   pcm_decode, pcm_seek,   NULL },
+    { WAV_FORMAT_IMA_ADPCM, "IMA ADPCM", adpcm_open, ima_decode, adpcm_seek, NULL },
+    { WAV_FORMAT_MS_ADPCM,  "MS ADPCM",  adpcm_open, ms_decode,  adpcm_seek, NULL },
+    { WAV_FORMAT_FLAC,      "FLAC",      flac_open,  flac_decode, flac_seek, flac_close },
+};
+
+/******************************************************************************/
+
+/*!
+ * @brief  Choose the backend for a stream and prepare it
+ */
+bool audio_decoder_open(audio_decoder_t *dec, const wav_info_t *info, const audio_source_t *source) {
+    dec->ops = NULL;
+    if ((info->channels == 0) || (info->channels > 2) || (info->block_align == 0) ||
+        (info->block_align > sizeof(dec->raw)) || (info->block_frames == 0)) {
+        return false;
+    }
+
+    dec->info = *info;
+    dec->source = *source;
+    dec->frames = wav_frames(info);
+    dec->frame = 0;
+    dec->block_frame = 0;
+    dec->error = false;
+    dec->state = NULL;
+    for (size_t i = 0; i < sizeof(decoder_backends) / sizeof(decoder_backends[0]); i++) {
+        if (decoder_backends[i].format == info->format) {
+            if (!decoder_backends[i].open(dec)) {
+                return false;
+            }
+            dec->ops = &decoder_backends[i];
+            return true;
+        }
+    }
+
+    return false;
+}
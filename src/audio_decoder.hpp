@@ -0,0 +1,142 @@
+/*
+ *  audio_decoder.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __AUDIO_DECODER_HPP_
+#define __AUDIO_DECODER_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "wav_parser.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Largest file block a decoder holds, a 44.1 kHz stereo ADPCM block fits */
+#ifndef AUDIO_DECODER_RAW
+#define AUDIO_DECODER_RAW 2048
+#endif
+
+/* Where a decoder takes its bytes from, offsets are from the start of the data chunk */
+typedef struct {
+    size_t (*read)(void *ctx, uint8_t *dst, size_t len);
+    bool (*seek)(void *ctx, uint32_t offset);
+    void *ctx;
+} audio_source_t;
+
+typedef struct audio_decoder audio_decoder_t;
+
+/* One backend, chosen by the format tag of the fmt chunk */
+typedef struct {
+    uint16_t format;             /* WAV_FORMAT_xxx */
+    const char *name;
+    bool (*open)(audio_decoder_t *dec);
+    uint32_t (*decode)(audio_decoder_t *dec, int16_t *out, uint32_t max);
+    bool (*seek)(audio_decoder_t *dec, uint32_t frame);
+    void (*close)(audio_decoder_t *dec);
+} audio_decoder_ops_t;
+
+/* Per channel ADPCM state, carried from one nibble to the next */
+typedef struct {
+    int32_t sample1;             /* Last sample, the IMA predictor */
+    int32_t sample2;             /* The one before, MS only */
+    int32_t step;                /* IMA step index or MS delta */
+    int32_t coef1;
+    int32_t coef2;
+} audio_adpcm_channel_t;
+
+/*
+ * Streaming decoder to 16-bit mono. All state lives here, nothing is
+ * allocated while decoding.
+ */
+struct audio_decoder {
+    const audio_decoder_ops_t *ops;
+    wav_info_t info;
+    audio_source_t source;
+    uint32_t frames;             /* Frames in the track */
+    uint32_t frame;              /* Next frame decoded */
+    uint32_t block_frame;        /* Frames of the block in raw decoded so far */
+    bool error;                  /* The source ran short or a block is corrupt, the track ends here */
+    void *state;                 /* Backend memory, allocated on open and released on close */
+    audio_adpcm_channel_t adpcm[2];
+    alignas(4) uint8_t raw[AUDIO_DECODER_RAW];
+};
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Choose the backend for a stream and prepare it, the source must be
+ *         at the start of the data chunk. Backends that read their own
+ *         metadata complete info and frames.
+ * @param  Decoder, stream description and where to read it from
+ * @retval False if no backend handles this format
+ */
+bool audio_decoder_open(audio_decoder_t *dec, const wav_info_t *info, const audio_source_t *source);
+
+/*!
+ * @brief  Decode the next frames as 16-bit mono, stereo is averaged
+ * @param  Decoder, output and the most frames wanted
+ * @retval Frames decoded, 0 at the end of the track or on error
+ */
+static inline uint32_t audio_decoder_decode(audio_decoder_t *dec, int16_t *out, uint32_t max) {
+    return dec->ops->decode(dec, out, max);
+}
+
+/*!
+ * @brief  Continue from a frame, or from the start of the block holding it
+ * @param  Decoder and frame from the start of the track
+ * @retval False if the frame is past the end or the source cannot seek,
+ *         decoding then continues where it was
+ */
+static inline bool audio_decoder_seek(audio_decoder_t *dec, uint32_t frame) {
+    return dec->ops->seek(dec, frame);
+}
+
+/*!
+ * @brief  Release the backend, the source is left to the caller
+ * @param  Decoder
+ * @retval None
+ */
+static inline void audio_decoder_close(audio_decoder_t *dec) {
+    if ((dec->ops != NULL) && (dec->ops->close != NULL)) {
+        dec->ops->close(dec);
+    }
+    dec->ops = NULL;
+}
+
+/*!
+ * @brief  Frames not decoded yet
+ * @param  Decoder
+ * @retval Frame count
+ */
+static inline uint32_t audio_decoder_remaining(const audio_decoder_t *dec) {
+    return (dec->error || (dec->frame >= dec->frames)) ? 0 : dec->frames - dec->frame;
+}
+
+/******************************************************************************/
+
+#endif /* __AUDIO_DECODER_HPP_ */
@@ -0,0 +1,224 @@
+/*
+ *  audio_eq.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <math.h>
+#include "audio_normalize.hpp"
+#include "audio_eq.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define EQ_COEFF_SHIFT 28            /* Q28 coefficients, range +-8 */
+#define EQ_SAMPLE_SHIFT 8            /* Extra fraction bits carried between bands */
+#define EQ_CHUNK 256                 /* Samples filtered per pass */
+
+/* Transposed direct form II biquad, a0 normalized to 1 */
+typedef struct {
+    int32_t b0, b1, b2, a1, a2;
+    int64_t s1, s2;
+} eq_biquad_t;
+
+typedef struct {
+    uint8_t count;
+    audio_eq_band_t bands[AUDIO_EQ_BANDS];
+} eq_preset_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static const eq_preset_t eq_presets[AUDIO_EQ_PRESET_COUNT] = {
+    /* Speaker: nothing below what it can move, less boom, more presence */
+    { 3, { { AUDIO_EQ_HIGHPASS, 0, 150, 7 }, { AUDIO_EQ_PEAK, -3, 300, 10 }, { AUDIO_EQ_PEAK, 4, 3000, 10 } } },
+    /* Flat */
+    { 0, { } },
+    /* Voice */
+    { 3, { { AUDIO_EQ_HIGHPASS, 0, 200, 7 }, { AUDIO_EQ_PEAK, 5, 2500, 8 }, { AUDIO_EQ_LOWPASS, 0, 9000, 7 } } },
+    /* Bright */
+    { 2, { { AUDIO_EQ_HIGHPASS, 0, 150, 7 }, { AUDIO_EQ_HIGHSHELF, 5, 4000, 10 } } },
+};
+
+static eq_biquad_t eq_biquads[AUDIO_EQ_BANDS];
+static uint8_t eq_count = 0;
+static int32_t eq_work[EQ_CHUNK];
+
+/* Cost counters */
+static uint64_t eq_cycles = 0;
+static uint32_t eq_samples = 0;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Compute the coefficients of one band
+ */
+static void eq_design(eq_biquad_t *biquad, const audio_eq_band_t *band) {
+    double w0 = 2.0 * M_PI * band->freq / AUDIO_OUTPUT_RATE;
+    double cosw = cos(w0);
+    double q = band->q10 ? band->q10 / 10.0 : 0.707;
+    double alpha = sin(w0) / (2.0 * q);
+    double a = pow(10.0, band->gain / 40.0);
+    double b0, b1, b2, a0, a1, a2;
+
+    switch (band->type) {
+    case AUDIO_EQ_LOWPASS:
+        b0 = (1.0 - cosw) / 2.0; b1 = 1.0 - cosw; b2 = b0;
+        a0 = 1.0 + alpha; a1 = -2.0 * cosw; a2 = 1.0 - alpha;
+        break;
+
+    case AUDIO_EQ_HIGHPASS:
+        b0 = (1.0 + cosw) / 2.0; b1 = -(1.0 + cosw); b2 = b0;
+        a0 = 1.0 + alpha; a1 = -2.0 * cosw; a2 = 1.0 - alpha;
+        break;
+
+    case AUDIO_EQ_PEAK:
+        b0 = 1.0 + alpha * a; b1 = -2.0 * cosw; b2 = 1.0 - alpha * a;
+        a0 = 1.0 + alpha / a; a1 = -2.0 * cosw; a2 = 1.0 - alpha / a;
+        break;
+
+    case AUDIO_EQ_LOWSHELF:
+    case AUDIO_EQ_HIGHSHELF: {
+        /* q10 is the shelf slope here */
+        double shelf = sin(w0) / 2.0 * sqrt((a + 1.0 / a) * (1.0 / q - 1.0) + 2.0);
+        double root = 2.0 * sqrt(a) * shelf;
+        double sign = (band->type == AUDIO_EQ_LOWSHELF) ? 1.0 : -1.0;
+        b0 = a * ((a + 1.0) - sign * (a - 1.0) * cosw + root);
+        b1 = sign * 2.0 * a * ((a - 1.0) - sign * (a + 1.0) * cosw);
+        b2 = a * ((a + 1.0) - sign * (a - 1.0) * cosw - root);
+        a0 = (a + 1.0) + sign * (a - 1.0) * cosw + root;
+        a1 = -sign * 2.0 * ((a - 1.0) + sign * (a + 1.0) * cosw);
+        a2 = (a + 1.0) + sign * (a - 1.0) * cosw - root;
+        break;
+    }
+
+    default:
+        b0 = 1.0; b1 = 0.0; b2 = 0.0;
+        a0 = 1.0; a1 = 0.0; a2 = 0.0;
+        break;
+    }
+
+    double scale = (double)(1 << EQ_COEFF_SHIFT) / a0;
+    biquad->b0 = lround(b0 * scale);
+    biquad->b1 = lround(b1 * scale);
+    biquad->b2 = lround(b2 * scale);
+    biquad->a1 = lround(a1 * scale);
+    biquad->a2 = lround(a2 * scale);
+    biquad->s1 = 0;
+    biquad->s2 = 0;
+}
+
+/*!
+ * @brief  Run one biquad over a chunk
+ */
+static void eq_biquad_run(eq_biquad_t *biquad, int32_t *data, uint32_t count) {
+    int64_t b0 = biquad->b0, b1 = biquad->b1, b2 = biquad->b2;
+    int64_t a1 = biquad->a1, a2 = biquad->a2;
+    int64_t s1 = biquad->s1, s2 = biquad->s2;
+
+    for (uint32_t i = 0; i < count; i++) {
+        int64_t x = data[i];
+        int64_t y = (b0 * x + s1) >> EQ_COEFF_SHIFT;
+        s1 = b1 * x - a1 * y + s2;
+        s2 = b2 * x - a2 * y;
+        data[i] = y;
+    }
+
+    biquad->s1 = s1;
+    biquad->s2 = s2;
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Set the bands, coefficients are computed here only
+ */
+void audio_eq_set_bands(const audio_eq_band_t *bands, uint8_t count) {
+    if (count > AUDIO_EQ_BANDS) {
+        count = AUDIO_EQ_BANDS;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        eq_design(&eq_biquads[i], &bands[i]);
+    }
+    eq_count = count;
+}
+
+/*!
+ * @brief  Set the bands of a preset
+ */
+bool audio_eq_set_preset(uint8_t preset) {
+    if (preset >= AUDIO_EQ_PRESET_COUNT) {
+        return false;
+    }
+
+    audio_eq_set_bands(eq_presets[preset].bands, eq_presets[preset].count);
+    return true;
+}
+
+/*!
+ * @brief  Filter samples in place
+ */
+void audio_eq_process(int16_t *samples, uint32_t count) {
+    if (eq_count == 0) {
+        return;
+    }
+
+    uint32_t start = ESP.getCycleCount();
+
+    for (uint32_t done = 0; done < count; done += EQ_CHUNK) {
+        uint32_t n = (count - done < EQ_CHUNK) ? count - done : EQ_CHUNK;
+        int16_t *chunk = samples + done;
+
+        for (uint32_t i = 0; i < n; i++) {
+            eq_work[i] = chunk[i] << EQ_SAMPLE_SHIFT;
+        }
+
+        for (uint8_t band = 0; band < eq_count; band++) {
+            eq_biquad_run(&eq_biquads[band], eq_work, n);
+        }
+
+        for (uint32_t i = 0; i < n; i++) {
+            int32_t value = (eq_work[i] + (1 << (EQ_SAMPLE_SHIFT - 1))) >> EQ_SAMPLE_SHIFT;
+            chunk[i] = value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : value);
+        }
+    }
+
+    eq_cycles += ESP.getCycleCount() - start;
+    eq_samples += count;
+}
+
+/*!
+ * @brief  Log the filter cost and reset the counters
+ */
+void audio_eq_report(void) {
+    if ((eq_samples == 0) || (eq_count == 0)) {
+        return;
+    }
+
+    Serial.printf("EQ: %u bands, %u cycles per sample per band\r\n",
+                  eq_count, (uint32_t)(eq_cycles / eq_samples / eq_count));
+    eq_cycles = 0;
+    eq_samples = 0;
+}
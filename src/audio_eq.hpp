@@ -0,0 +1,102 @@
+/*
+ *  audio_eq.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __AUDIO_EQ_HPP_
+#define __AUDIO_EQ_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define AUDIO_EQ_BANDS 5
+
+/* Band filter types, RBJ cookbook biquads */
+enum {
+    AUDIO_EQ_LOWPASS = 0,
+    AUDIO_EQ_HIGHPASS,
+    AUDIO_EQ_PEAK,
+    AUDIO_EQ_LOWSHELF,
+    AUDIO_EQ_HIGHSHELF,
+};
+
+/* Presets, the first one corrects the small built-in speaker */
+enum {
+    AUDIO_EQ_PRESET_SPEAKER = 0,
+    AUDIO_EQ_PRESET_FLAT,
+    AUDIO_EQ_PRESET_VOICE,
+    AUDIO_EQ_PRESET_BRIGHT,
+    AUDIO_EQ_PRESET_COUNT,
+};
+
+typedef struct {
+    uint8_t type;                /* AUDIO_EQ_xxx */
+    int8_t gain;                 /* dB, peak and shelf only */
+    uint16_t freq;               /* Hz */
+    uint8_t q10;                 /* Q or shelf slope, times 10 */
+} audio_eq_band_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*
+ * The equalizer runs at AUDIO_OUTPUT_RATE on 16-bit mono and is owned by the
+ * play task.
+ */
+
+/*!
+ * @brief  Set the bands, coefficients are computed here only
+ * @param  Bands and their count, at most AUDIO_EQ_BANDS are used
+ * @retval None
+ */
+void audio_eq_set_bands(const audio_eq_band_t *bands, uint8_t count);
+
+/*!
+ * @brief  Set the bands of a preset
+ * @param  AUDIO_EQ_PRESET_xxx
+ * @retval False if the preset does not exist
+ */
+bool audio_eq_set_preset(uint8_t preset);
+
+/*!
+ * @brief  Filter samples in place
+ * @param  Samples and their count
+ * @retval None
+ */
+void audio_eq_process(int16_t *samples, uint32_t count);
+
+/*!
+ * @brief  Log the filter cost and reset the counters
+ * @param  None
+ * @retval None
+ */
+void audio_eq_report(void);
+
+/******************************************************************************/
+
+#endif /* __AUDIO_EQ_HPP_ */
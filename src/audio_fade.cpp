@@ -0,0 +1,117 @@
+/*
+ *  audio_fade.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "app_config.hpp"
+#include "audio_fade.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Scale frames of a block by step / ramp, step moving by dir after each frame
+ */
+void audio_fade_ramp(audio_block_t *block, uint32_t from, uint32_t count, uint32_t step, int dir, uint32_t ramp) {
+    uint32_t channels = block->channels;
+
+    for (uint32_t frame = from; frame < from + count; frame++, step += dir) {
+        int32_t gain = ((int64_t)step << 15) / ramp;
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            if (block->bits == 16) {
+                int16_t *sample = (int16_t *)block->data + frame * channels + ch;
+                *sample = (*sample * gain) >> 15;
+            }
+            else {
+                uint8_t *sample = block->data + frame * channels + ch;
+                *sample = (((*sample - 128) * gain) >> 15) + 128;
+            }
+        }
+    }
+}
+
+/*!
+ * @brief  Fade out a queued block from the frame the speaker reads at fade->now
+ */
+uint32_t audio_fade_block(audio_block_t *block, audio_fade_t *fade) {
+    uint32_t frame_size = block->channels * (block->bits >> 3);
+    uint32_t frames = block->len / frame_size;
+    uint32_t from = 0;
+
+    if (!fade->fading) {
+        /* Find the frame the speaker is reading now */
+        int32_t elapsed = fade->now - block->start_us;
+        from = (elapsed > 0) ? (uint64_t)elapsed * block->sample_rate / 1000000 : 0;
+        if (from >= frames) {
+            return frames;
+        }
+
+        fade->ramp = block->sample_rate * AUDIO_FADE_MS / 1000;
+        fade->left = fade->ramp;
+        fade->fading = true;
+    }
+
+    /* Ramp down from the read position, everything behind it is silenced */
+    uint32_t count = (fade->left < frames - from) ? fade->left : frames - from;
+    audio_fade_ramp(block, from, count, fade->left, -1, fade->ramp);
+    memset(block->data + (from + count) * frame_size, (block->bits == 16) ? 0 : 0x80, (frames - from - count) * frame_size);
+    fade->left -= count;
+    return count ? from + count : 0;
+}
+
+/*!
+ * @brief  Fade out the blocks the consumer gave to the speaker
+ */
+uint32_t audio_fade_cut(audio_ring_t *ring, uint16_t track_id, uint32_t position, audio_fade_t *fade) {
+    bool seen = false;
+    audio_block_t *block;
+
+    for (uint32_t i = 0; (block = audio_ring_acquired(ring, i)) != NULL; i++) {
+        if (!block->submitted || (block->len == 0)) {
+            continue;
+        }
+
+        bool current = (block->track_id == track_id);
+        if (current && !seen) {
+            position = block->frame;
+            seen = true;
+        }
+
+        uint32_t heard = audio_fade_block(block, fade);
+        if (current && (heard > 0)) {
+            position = audio_block_frame(block, heard);
+        }
+    }
+
+    return position;
+}
@@ -0,0 +1,74 @@
+/*
+ *  audio_fade.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef __AUDIO_FADE_HPP_
+#define __AUDIO_FADE_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "audio_ring.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Fade out running through the blocks queued on the speaker */
+typedef struct {
+    uint32_t now;                /* When the fade starts */
+    uint32_t ramp;               /* Frames of the whole ramp */
+    uint32_t left;               /* Frames of the ramp not placed yet */
+    bool fading;                 /* Ramp started, the blocks after it are silenced */
+} audio_fade_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Scale frames of a block by step / ramp, step moving by dir after each frame
+ * @param  Block, first frame, frame count, first step, direction and ramp length
+ * @retval None
+ */
+void audio_fade_ramp(audio_block_t *block, uint32_t from, uint32_t count, uint32_t step, int dir, uint32_t ramp);
+
+/*!
+ * @brief  Fade out a queued block from the frame the speaker reads at fade->now,
+ *         the blocks queued after it continue the fade and are silenced past it
+ * @param  Block and the fade state, blocks must come in the order they play
+ * @retval Frames of the block that are heard, 0 if none
+ */
+uint32_t audio_fade_block(audio_block_t *block, audio_fade_t *fade);
+
+/*!
+ * @brief  Fade out the blocks the consumer gave to the speaker
+ * @param  Ring, current track, its position if none of its blocks were submitted
+ *         and the fade state
+ * @retval Source frame of the first frame of the track that is not heard
+ */
+uint32_t audio_fade_cut(audio_ring_t *ring, uint16_t track_id, uint32_t position, audio_fade_t *fade);
+
+/******************************************************************************/
+
+#endif /* __AUDIO_FADE_HPP_ */
@@ -0,0 +1,994 @@
+/*
+ *  audio_flac.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include "audio_flac.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define FLAC_MAX_ORDER 32            /* Longest LPC predictor */
+#define FLAC_MAX_BITS 24             /* Widest sample, side channels take one more bit */
+#define FLAC_CHUNK 256               /* Second channel frames restored at once */
+#define FLAC_STREAMINFO_LEN 34
+#define FLAC_SEEK_SPAN 8192          /* Seeks decode forward once the bisection is this close */
+
+enum {
+    SUBFRAME_CONSTANT = 0,
+    SUBFRAME_VERBATIM,
+    SUBFRAME_FIXED,
+    SUBFRAME_LPC,
+};
+
+enum {
+    ASSIGN_INDEPENDENT = 0,
+    ASSIGN_LEFT_SIDE,
+    ASSIGN_RIGHT_SIDE,
+    ASSIGN_MID_SIDE,
+};
+
+/* Bit reader over the decoder's raw buffer, refilled from the source */
+typedef struct {
+    uint32_t cache;              /* Next bits, most significant first */
+    uint32_t cache_bits;
+    uint32_t raw_pos;            /* Next byte of raw taken into the cache */
+    uint32_t raw_len;
+    uint32_t raw_offset;         /* Source offset of raw[0] */
+    uint32_t fake;               /* Zero bytes cached past the end of the source */
+    uint32_t lag;                /* Last four bytes taken into the cache, the newest lowest */
+    uint32_t crc_skip;           /* Bytes leaving lag before the frame starts */
+    uint16_t crc;                /* Frame CRC-16 of the bytes that left lag */
+    bool eof;                    /* The source ran dry */
+} flac_bits_t;
+
+typedef struct {
+    uint32_t sample;             /* Track frame starting the target frame */
+    uint32_t offset;             /* Bytes from the first frame */
+} flac_seek_point_t;
+
+typedef struct {
+    uint32_t sample;             /* Track frame of the first frame */
+    uint32_t offset;             /* Source offset of the header */
+    uint32_t block_size;
+    uint32_t bits;
+    uint8_t assignment;
+} flac_frame_t;
+
+/* One channel of a frame, decoded in one or several runs */
+typedef struct {
+    int32_t coefs[FLAC_MAX_ORDER];
+    int32_t warm[FLAC_MAX_ORDER];    /* Samples before the first prediction */
+    int32_t value;                   /* Constant subframes */
+    uint32_t block_size;
+    uint32_t bps;                    /* Bits per sample after the wasted bits */
+    uint32_t wasted;
+    uint32_t order;
+    uint32_t shift;
+    uint32_t partition_order;
+    uint32_t param_bits;             /* 4 or 5 bit Rice parameters */
+    uint32_t partition;              /* Next partition to start */
+    uint32_t partition_left;         /* Residuals left in the current one */
+    uint32_t param;
+    bool escaped;                    /* The partition holds raw param bit values */
+    bool wide;                       /* Prediction sums need 64 bits */
+    uint8_t type;
+} flac_subframe_t;
+
+/* Everything a stream needs, allocated once on open */
+typedef struct {
+    flac_bits_t bits;
+    flac_subframe_t sub;
+    uint32_t first_frame;            /* Source offset of the first frame */
+    uint32_t data_end;
+    uint32_t max_block;
+    uint32_t block_len;              /* Frames of the decoded block */
+    uint32_t seek_count;
+    flac_seek_point_t seek[FLAC_SEEK_POINTS];
+    int32_t history[FLAC_MAX_ORDER + FLAC_CHUNK];    /* Second channel, the last frames first */
+    int32_t block[FLAC_MAX_BLOCK];   /* First channel, then the mono mix as int16 */
+} flac_state_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static const uint8_t flac_magic[4] = { 'f', 'L', 'a', 'C' };
+static uint16_t flac_crc16_table[256];
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static inline uint32_t rd16be(const uint8_t *p) {
+    return ((uint32_t)p[0] << 8) | p[1];
+}
+
+static inline uint32_t rd32be(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+/*!
+ * @brief  Fill the stream description from a STREAMINFO block
+ */
+static bool flac_parse_streaminfo(const uint8_t *p, wav_info_t *info, uint32_t *max_block) {
+    uint64_t total = ((uint64_t)(p[13] & 0x0F) << 32) | rd32be(p + 14);
+
+    *max_block = rd16be(p + 2);
+    info->format = WAV_FORMAT_FLAC;
+    info->sample_rate = ((uint32_t)p[10] << 12) | ((uint32_t)p[11] << 4) | (p[12] >> 4);
+    info->channels = ((p[12] >> 1) & 0x07) + 1;
+    info->bits = (((p[12] & 0x01) << 4) | (p[13] >> 4)) + 1;
+    info->valid_bits = info->bits;
+    info->block_align = info->channels * ((info->bits + 7) >> 3);
+    info->block_frames = 1;
+    info->byte_rate = info->sample_rate * info->block_align;
+    info->fact_frames = (total > UINT32_MAX) ? UINT32_MAX : total;
+
+    return (info->sample_rate > 0) && (info->channels <= 2) && (info->bits >= 4) && (info->bits <= FLAC_MAX_BITS) &&
+           (*max_block > 0) && (*max_block <= FLAC_MAX_BLOCK);
+}
+
+/*!
+ * @brief  Continue reading at a source offset
+ */
+static bool flac_position(audio_decoder_t *dec, flac_state_t *st, uint32_t offset) {
+    flac_bits_t *bits = &st->bits;
+
+    if (!dec->source.seek(dec->source.ctx, offset)) {
+        return false;
+    }
+
+    bits->cache = 0;
+    bits->cache_bits = 0;
+    bits->raw_pos = 0;
+    bits->raw_len = 0;
+    bits->raw_offset = offset;
+    bits->fake = 0;
+    bits->eof = false;
+    return true;
+}
+
+/*!
+ * @brief  Source offset of the next whole byte
+ */
+static inline uint32_t flac_tell(const flac_state_t *st) {
+    return st->bits.raw_offset + st->bits.raw_pos + st->bits.fake - (st->bits.cache_bits >> 3);
+}
+
+/*!
+ * @brief  Bits past the end of the source were read
+ */
+static inline bool flac_overrun(const flac_bits_t *bits) {
+    return bits->cache_bits < (bits->fake << 3);
+}
+
+/*!
+ * @brief  Table of the frame CRC-16, polynomial x^16 + x^15 + x^2 + 1
+ */
+static void flac_crc16_init(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint16_t crc = i << 8;
+        for (int j = 0; j < 8; j++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x8005 : crc << 1;
+        }
+        flac_crc16_table[i] = crc;
+    }
+}
+
+static inline uint16_t flac_crc16_byte(uint16_t crc, uint32_t byte) {
+    return (crc << 8) ^ flac_crc16_table[(crc >> 8) ^ byte];
+}
+
+/*!
+ * @brief  Pass a byte taken into the cache through lag, the CRC runs four
+ *         bytes behind so that bytes cached past the frame stay out of it
+ */
+static inline void flac_crc_push(flac_bits_t *bits, uint32_t byte) {
+    uint32_t old = bits->lag >> 24;
+
+    bits->lag = (bits->lag << 8) | byte;
+    if (bits->crc_skip > 0) {
+        bits->crc_skip--;
+    }
+    else {
+        bits->crc = flac_crc16_byte(bits->crc, old);
+    }
+}
+
+/*!
+ * @brief  Start the CRC at the next whole byte, the cached bytes are the newest in lag
+ */
+static inline void flac_crc_begin(flac_bits_t *bits) {
+    bits->crc = 0;
+    bits->crc_skip = 4 - (bits->cache_bits >> 3);
+}
+
+/*!
+ * @brief  CRC up to the next whole byte, adding the bytes of lag not cached any more
+ */
+static inline uint16_t flac_crc_end(const flac_bits_t *bits) {
+    uint16_t crc = bits->crc;
+    uint32_t end = 4 - (bits->cache_bits >> 3);
+
+    for (uint32_t i = bits->crc_skip; i < end; i++) {
+        crc = flac_crc16_byte(crc, (bits->lag >> (24 - (i << 3))) & 0xFF);
+    }
+    return crc;
+}
+
+/*!
+ * @brief  Top up the cache to more than 24 bits
+ */
+static void flac_fill(audio_decoder_t *dec, flac_bits_t *bits) {
+    while (bits->cache_bits <= 24) {
+        if (bits->raw_pos >= bits->raw_len) {
+            size_t got = bits->eof ? 0 : dec->source.read(dec->source.ctx, dec->raw, sizeof(dec->raw));
+            if (got == 0) {
+                /* Zeros from here on, callers check flac_overrun() */
+                bits->eof = true;
+                bits->fake++;
+                bits->cache_bits += 8;
+                flac_crc_push(bits, 0);
+                continue;
+            }
+            bits->raw_offset += bits->raw_len;
+            bits->raw_pos = 0;
+            bits->raw_len = got;
+        }
+
+        uint32_t byte = dec->raw[bits->raw_pos++];
+        bits->cache |= byte << (24 - bits->cache_bits);
+        bits->cache_bits += 8;
+        flac_crc_push(bits, byte);
+    }
+}
+
+/*!
+ * @brief  Read up to 24 bits
+ */
+static inline uint32_t flac_read(audio_decoder_t *dec, flac_bits_t *bits, uint32_t n) {
+    if (n == 0) {
+        return 0;
+    }
+    if (bits->cache_bits < n) {
+        flac_fill(dec, bits);
+    }
+
+    uint32_t value = bits->cache >> (32 - n);
+    bits->cache <<= n;
+    bits->cache_bits -= n;
+    return value;
+}
+
+/*!
+ * @brief  Read up to 32 bits
+ */
+static inline uint32_t flac_read_long(audio_decoder_t *dec, flac_bits_t *bits, uint32_t n) {
+    if (n <= 24) {
+        return flac_read(dec, bits, n);
+    }
+
+    uint32_t high = flac_read(dec, bits, n - 16);
+    return (high << 16) | flac_read(dec, bits, 16);
+}
+
+/*!
+ * @brief  Read a two's complement value of up to 32 bits
+ */
+static inline int32_t flac_read_signed(audio_decoder_t *dec, flac_bits_t *bits, uint32_t n) {
+    if (n == 0) {
+        return 0;
+    }
+
+    return (int32_t)(flac_read_long(dec, bits, n) << (32 - n)) >> (32 - n);
+}
+
+/*!
+ * @brief  Count zero bits up to the next one bit and drop them both
+ */
+static inline uint32_t flac_read_unary(audio_decoder_t *dec, flac_bits_t *bits) {
+    uint32_t count = 0;
+
+    while (1) {
+        if (bits->cache != 0) {
+            uint32_t zeros = __builtin_clz(bits->cache);
+            if (zeros < bits->cache_bits) {
+                bits->cache = (bits->cache << zeros) << 1;    /* zeros may be 31 */
+                bits->cache_bits -= zeros + 1;
+                return count + zeros;
+            }
+        }
+
+        /* Everything cached is zero */
+        count += bits->cache_bits;
+        bits->cache = 0;
+        bits->cache_bits = 0;
+        flac_fill(dec, bits);
+        if (bits->eof && (bits->cache == 0)) {
+            return count;
+        }
+    }
+}
+
+/*!
+ * @brief  Drop bits up to the next byte boundary
+ */
+static inline void flac_align(flac_bits_t *bits) {
+    uint32_t n = bits->cache_bits & 7;
+
+    bits->cache <<= n;
+    bits->cache_bits -= n;
+}
+
+/*!
+ * @brief  Skip bytes, with a seek unless they are buffered already
+ */
+static bool flac_skip(audio_decoder_t *dec, flac_state_t *st, uint32_t len) {
+    flac_bits_t *bits = &st->bits;
+    uint32_t buffered = (bits->cache_bits >> 3) + (bits->raw_len - bits->raw_pos);
+
+    if (len > buffered) {
+        return flac_position(dec, st, flac_tell(st) + len);
+    }
+
+    while (len-- > 0) {
+        flac_read(dec, bits, 8);
+    }
+    return true;
+}
+
+/*!
+ * @brief  CRC-8 of a frame header, polynomial x^8 + x^2 + x + 1
+ */
+static uint8_t flac_crc8(const uint8_t *data, uint32_t len) {
+    uint8_t crc = 0;
+
+    while (len-- > 0) {
+        crc ^= *data++;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+    }
+
+    return crc;
+}
+
+/*!
+ * @brief  Read a frame header at a byte boundary. When scanning, bytes are
+ *         skipped up to the next valid header starting before limit.
+ */
+static bool flac_read_header(audio_decoder_t *dec, flac_state_t *st, flac_frame_t *frame, bool scan, uint32_t limit) {
+    static const uint16_t block_sizes[16] = {
+        0, 192, 576, 1152, 2304, 4608, 0, 0, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768
+    };
+    static const uint8_t sample_bits[8] = { 0, 8, 12, 0, 16, 20, 24, 0 };
+    flac_bits_t *bits = &st->bits;
+    uint8_t header[16];
+    uint32_t byte = 0;
+    bool pending = false;        /* The last byte read may start a sync code */
+
+    flac_align(bits);
+    while (1) {
+        if (!pending) {
+            if (scan && (flac_tell(st) >= limit)) {
+                return false;
+            }
+            byte = flac_read(dec, bits, 8);
+            if (flac_overrun(bits)) {
+                return false;
+            }
+        }
+        pending = false;
+        if (byte != 0xFF) {
+            if (!scan) {
+                return false;
+            }
+            continue;
+        }
+        frame->offset = flac_tell(st) - 1;
+
+        /* Sync code, reserved zero bit and the blocking strategy */
+        byte = flac_read(dec, bits, 8);
+        if ((byte & 0xFE) != 0xF8) {
+            if (!scan) {
+                return false;
+            }
+            pending = true;
+            continue;
+        }
+
+        uint32_t len = 0;
+        header[len++] = 0xFF;
+        header[len++] = byte;
+        header[len++] = flac_read(dec, bits, 8);
+        header[len++] = flac_read(dec, bits, 8);
+        uint32_t size_code = header[2] >> 4;
+        uint32_t rate_code = header[2] & 0x0F;
+        uint32_t assignment = header[3] >> 4;
+        uint32_t bits_code = (header[3] >> 1) & 0x07;
+
+        /* Frame or sample number, UTF-8 coded up to 36 bits */
+        uint32_t lead = flac_read(dec, bits, 8);
+        uint32_t extra = 0;
+        header[len++] = lead;
+        while ((extra < 8) && (lead & (0x80 >> extra))) {
+            extra++;
+        }
+        bool valid = (extra != 1) && (extra < 8);
+        uint64_t number = (extra == 0) ? lead : (lead & (0x7F >> extra));
+        for (uint32_t i = 1; valid && (i < extra); i++) {
+            uint32_t next = flac_read(dec, bits, 8);
+            header[len++] = next;
+            valid = ((next & 0xC0) == 0x80);
+            number = (number << 6) | (next & 0x3F);
+        }
+
+        if (valid) {
+            frame->block_size = block_sizes[size_code];
+            if (size_code == 6) {
+                header[len++] = flac_read(dec, bits, 8);
+                frame->block_size = header[len - 1] + 1;
+            }
+            else if (size_code == 7) {
+                header[len++] = flac_read(dec, bits, 8);
+                header[len++] = flac_read(dec, bits, 8);
+                frame->block_size = rd16be(header + len - 2) + 1;
+            }
+
+            if (rate_code == 12) {
+                header[len++] = flac_read(dec, bits, 8);
+            }
+            else if ((rate_code == 13) || (rate_code == 14)) {
+                header[len++] = flac_read(dec, bits, 8);
+                header[len++] = flac_read(dec, bits, 8);
+            }
+            valid = (flac_read(dec, bits, 8) == flac_crc8(header, len));
+        }
+
+        /* Only what this stream can hold, a false sync in the audio rarely passes */
+        uint64_t sample = (header[1] & 0x01) ? number : number * st->max_block;
+        uint32_t channels = (assignment < 8) ? assignment + 1 : 2;
+        frame->bits = bits_code ? sample_bits[bits_code] : dec->info.bits;
+        frame->assignment = (assignment < 8) ? (uint32_t)ASSIGN_INDEPENDENT : assignment - 7;
+        frame->sample = sample;
+        valid = valid && (size_code != 0) && (rate_code != 15) && !(header[3] & 0x01) &&
+                (assignment <= 10) && (channels == dec->info.channels) && (frame->bits == dec->info.bits) &&
+                (frame->block_size <= st->max_block) && (sample <= UINT32_MAX);
+
+        if (flac_overrun(bits)) {
+            return false;
+        }
+        if (valid || !scan) {
+            return valid;
+        }
+    }
+}
+
+/*!
+ * @brief  Read a subframe header, up to its first residual
+ */
+static bool flac_subframe_begin(audio_decoder_t *dec, flac_state_t *st, flac_subframe_t *sub, uint32_t block_size, uint32_t bps) {
+    flac_bits_t *bits = &st->bits;
+
+    if (flac_read(dec, bits, 1) != 0) {
+        return false;
+    }
+
+    uint32_t type = flac_read(dec, bits, 6);
+    sub->wasted = 0;
+    if (flac_read(dec, bits, 1)) {
+        sub->wasted = flac_read_unary(dec, bits) + 1;
+        if (sub->wasted >= bps) {
+            return false;
+        }
+        bps -= sub->wasted;
+    }
+    sub->bps = bps;
+    sub->block_size = block_size;
+    sub->order = 0;
+
+    if (type == 0) {
+        sub->type = SUBFRAME_CONSTANT;
+        sub->value = flac_read_signed(dec, bits, bps);
+        return true;
+    }
+    if (type == 1) {
+        sub->type = SUBFRAME_VERBATIM;
+        return true;
+    }
+    if ((type >= 8) && (type <= 12)) {
+        sub->type = SUBFRAME_FIXED;
+        sub->order = type - 8;
+    }
+    else if (type >= 32) {
+        sub->type = SUBFRAME_LPC;
+        sub->order = type - 31;
+    }
+    else {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < sub->order; i++) {
+        sub->warm[i] = flac_read_signed(dec, bits, bps);
+    }
+
+    if (sub->type == SUBFRAME_LPC) {
+        uint32_t precision = flac_read(dec, bits, 4) + 1;
+        int32_t shift = flac_read_signed(dec, bits, 5);
+        uint64_t sum = 0;
+        if ((precision > 15) || (shift < 0)) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < sub->order; i++) {
+            sub->coefs[i] = flac_read_signed(dec, bits, precision);
+            sum += (sub->coefs[i] < 0) ? -sub->coefs[i] : sub->coefs[i];
+        }
+        sub->shift = shift;
+
+        /* The sum of products is bounded by the coefficients and the sample width */
+        sub->wide = ((sum << (bps - 1)) > INT32_MAX);
+    }
+
+    /* Residual coding method and partitions */
+    uint32_t method = flac_read(dec, bits, 2);
+    sub->partition_order = flac_read(dec, bits, 4);
+    sub->param_bits = (method == 0) ? 4 : 5;
+    sub->partition = 0;
+    sub->partition_left = 0;
+    return (method <= 1) && ((block_size >> sub->partition_order) >= sub->order) &&
+           ((block_size & ((1u << sub->partition_order) - 1)) == 0);
+}
+
+/*!
+ * @brief  Read residuals, moving on through the partitions
+ */
+static void flac_residual(audio_decoder_t *dec, flac_state_t *st, flac_subframe_t *sub, int32_t *dst, uint32_t count) {
+    flac_bits_t *bits = &st->bits;
+
+    while (count > 0) {
+        if (sub->partition_left == 0) {
+            uint32_t samples = sub->block_size >> sub->partition_order;
+            if (sub->partition == 0) {
+                samples -= sub->order;
+            }
+            sub->partition++;
+            sub->partition_left = samples;
+            sub->param = flac_read(dec, bits, sub->param_bits);
+            sub->escaped = (sub->param == (1u << sub->param_bits) - 1);
+            if (sub->escaped) {
+                sub->param = flac_read(dec, bits, 5);
+            }
+            continue;
+        }
+
+        uint32_t n = (count < sub->partition_left) ? count : sub->partition_left;
+        uint32_t param = sub->param;
+        count -= n;
+        sub->partition_left -= n;
+        if (sub->escaped) {
+            while (n-- > 0) {
+                *dst++ = flac_read_signed(dec, bits, param);
+            }
+            continue;
+        }
+
+        while (n-- > 0) {
+            uint32_t value = (flac_read_unary(dec, bits) << param) | flac_read_long(dec, bits, param);
+            *dst++ = (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+        }
+    }
+}
+
+/*!
+ * @brief  Decode the next frames of a subframe, out[-1] back to out[-order]
+ *         hold the frames before when pos is not 0
+ */
+static void flac_subframe_run(audio_decoder_t *dec, flac_state_t *st, flac_subframe_t *sub, int32_t *out, uint32_t pos, uint32_t count) {
+    int32_t order = sub->order;
+    int32_t n = count;
+    int32_t i = 0;         /* Signed, the predictions look back before out */
+
+    if (sub->type == SUBFRAME_CONSTANT) {
+        for (; i < n; i++) {
+            out[i] = sub->value;
+        }
+        return;
+    }
+    if (sub->type == SUBFRAME_VERBATIM) {
+        for (; i < n; i++) {
+            out[i] = flac_read_signed(dec, &st->bits, sub->bps);
+        }
+        return;
+    }
+
+    for (; ((int32_t)pos + i < order) && (i < n); i++) {
+        out[i] = sub->warm[pos + i];
+    }
+    flac_residual(dec, st, sub, out + i, n - i);
+
+    if (sub->type == SUBFRAME_FIXED) {
+        switch (order) {
+        case 1:
+            for (; i < n; i++) {
+                out[i] += out[i - 1];
+            }
+            break;
+        case 2:
+            for (; i < n; i++) {
+                out[i] += 2 * out[i - 1] - out[i - 2];
+            }
+            break;
+        case 3:
+            for (; i < n; i++) {
+                out[i] += 3 * (out[i - 1] - out[i - 2]) + out[i - 3];
+            }
+            break;
+        case 4:
+            for (; i < n; i++) {
+                out[i] += 4 * (out[i - 1] + out[i - 3]) - 6 * out[i - 2] - out[i - 4];
+            }
+            break;
+        default:
+            break;
+        }
+        return;
+    }
+
+    const int32_t *coefs = sub->coefs;
+    uint32_t shift = sub->shift;
+    if (sub->wide) {
+        for (; i < n; i++) {
+            int64_t sum = 0;
+            for (int32_t j = 0; j < order; j++) {
+                sum += (int64_t)coefs[j] * out[i - 1 - j];
+            }
+            out[i] += (int32_t)(sum >> shift);
+        }
+    }
+    else {
+        for (; i < n; i++) {
+            int32_t sum = 0;
+            for (int32_t j = 0; j < order; j++) {
+                sum += coefs[j] * out[i - 1 - j];
+            }
+            out[i] += sum >> shift;
+        }
+    }
+}
+
+static inline int32_t flac_shl(int32_t value, uint32_t shift) {
+    return (int32_t)((uint32_t)value << shift);
+}
+
+static inline int32_t flac_to16(int32_t value, int32_t shift) {
+    return (shift >= 0) ? value >> shift : flac_shl(value, -shift);
+}
+
+/*!
+ * @brief  Decode the next frame into the mono block, false at the end of the stream
+ */
+static bool flac_next_frame(audio_decoder_t *dec, flac_state_t *st, flac_frame_t *frame) {
+    flac_subframe_t *sub = &st->sub;
+    int16_t *mono = (int16_t *)st->block;
+    int32_t shift = (int32_t)dec->info.bits - 16;
+
+    flac_align(&st->bits);
+    flac_crc_begin(&st->bits);
+    if (!flac_read_header(dec, st, frame, false, 0)) {
+        return false;
+    }
+
+    uint32_t n = frame->block_size;
+    uint32_t bps = frame->bits + (frame->assignment == ASSIGN_RIGHT_SIDE);
+    if (!flac_subframe_begin(dec, st, sub, n, bps)) {
+        return false;
+    }
+    flac_subframe_run(dec, st, sub, st->block, 0, n);
+    uint32_t wasted = sub->wasted;
+
+    if (dec->info.channels == 1) {
+        for (uint32_t i = 0; i < n; i++) {
+            mono[i] = flac_to16(flac_shl(st->block[i], wasted), shift);
+        }
+    }
+    else {
+        /* The second channel is restored in chunks and mixed into the first right away */
+        bps = frame->bits + ((frame->assignment == ASSIGN_LEFT_SIDE) || (frame->assignment == ASSIGN_MID_SIDE));
+        if (!flac_subframe_begin(dec, st, sub, n, bps)) {
+            return false;
+        }
+
+        int32_t *second = st->history + FLAC_MAX_ORDER;
+        for (uint32_t pos = 0; pos < n; pos += FLAC_CHUNK) {
+            uint32_t count = (n - pos < FLAC_CHUNK) ? n - pos : FLAC_CHUNK;
+            flac_subframe_run(dec, st, sub, second, pos, count);
+
+            for (uint32_t i = 0; i < count; i++) {
+                int32_t a = flac_shl(st->block[pos + i], wasted);
+                int32_t b = flac_shl(second[i], sub->wasted);
+                int32_t left = a;
+                int32_t right = b;
+
+                if (frame->assignment == ASSIGN_LEFT_SIDE) {
+                    right = a - b;
+                }
+                else if (frame->assignment == ASSIGN_RIGHT_SIDE) {
+                    left = a + b;
+                }
+                else if (frame->assignment == ASSIGN_MID_SIDE) {
+                    int32_t mid = flac_shl(a, 1) | (b & 1);
+                    left = (mid + b) >> 1;
+                    right = (mid - b) >> 1;
+                }
+
+                /* Overwrites only first channel frames already mixed */
+                mono[pos + i] = (flac_to16(left, shift) + flac_to16(right, shift)) >> 1;
+            }
+            memmove(st->history, st->history + count, FLAC_MAX_ORDER * sizeof(int32_t));
+        }
+    }
+
+    /* Padding and the frame CRC-16, a damaged frame keeps its length but plays silence */
+    flac_align(&st->bits);
+    uint16_t crc = flac_crc_end(&st->bits);
+    uint16_t stored = flac_read(dec, &st->bits, 16);
+    if (flac_overrun(&st->bits)) {
+        return false;
+    }
+    if (stored != crc) {
+        Serial.printf("FLAC frame at %u fails its CRC, muted\r\n", (unsigned)frame->offset);
+        memset(mono, 0, n * sizeof(int16_t));
+    }
+
+    st->block_len = n;
+    return true;
+}
+
+/*!
+ * @brief  Go back to the first frame
+ */
+static bool flac_rewind(audio_decoder_t *dec, flac_state_t *st) {
+    dec->frame = 0;
+    dec->block_frame = 0;
+    st->block_len = 0;
+    return flac_position(dec, st, st->first_frame);
+}
+
+/*!
+ * @brief  Read the metadata blocks up to the first frame
+ */
+static bool flac_read_metadata(audio_decoder_t *dec, flac_state_t *st) {
+    flac_bits_t *bits = &st->bits;
+    uint8_t streaminfo[FLAC_STREAMINFO_LEN];
+    bool have_streaminfo = false;
+    bool last = false;
+
+    for (int i = 0; i < 4; i++) {
+        if (flac_read(dec, bits, 8) != flac_magic[i]) {
+            return false;
+        }
+    }
+
+    while (!last && !flac_overrun(bits)) {
+        uint32_t type = flac_read(dec, bits, 8);
+        uint32_t len = flac_read(dec, bits, 24);
+        last = (type & 0x80) != 0;
+        type &= 0x7F;
+
+        if ((type == 0) && (len == FLAC_STREAMINFO_LEN)) {
+            for (uint32_t i = 0; i < len; i++) {
+                streaminfo[i] = flac_read(dec, bits, 8);
+            }
+            have_streaminfo = flac_parse_streaminfo(streaminfo, &dec->info, &st->max_block);
+            if (!have_streaminfo) {
+                return false;
+            }
+        }
+        else if (type == 3) {
+            /* Seek table, placeholders and points past 32 bits are left out */
+            uint32_t count = len / 18;
+            uint32_t stride = (count + FLAC_SEEK_POINTS - 1) / FLAC_SEEK_POINTS;
+            for (uint32_t i = 0; i < count; i++) {
+                uint32_t sample_high = flac_read_long(dec, bits, 32);
+                uint32_t sample = flac_read_long(dec, bits, 32);
+                uint32_t offset_high = flac_read_long(dec, bits, 32);
+                uint32_t offset = flac_read_long(dec, bits, 32);
+                flac_read(dec, bits, 16);
+                if ((i % stride == 0) && (sample_high == 0) && (offset_high == 0) && (st->seek_count < FLAC_SEEK_POINTS) &&
+                    ((st->seek_count == 0) || (sample > st->seek[st->seek_count - 1].sample))) {
+                    st->seek[st->seek_count].sample = sample;
+                    st->seek[st->seek_count].offset = offset;
+                    st->seek_count++;
+                }
+            }
+            if (!flac_skip(dec, st, len - count * 18)) {
+                return false;
+            }
+        }
+        else if ((type == 127) || !flac_skip(dec, st, len)) {
+            return false;
+        }
+    }
+
+    st->first_frame = flac_tell(st);
+    return have_streaminfo && !flac_overrun(bits);
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Recognize a FLAC file from its first bytes
+ */
+bool flac_probe(const uint8_t *head, size_t len, uint32_t file_size, wav_info_t *info) {
+    uint32_t max_block;
+
+    /* STREAMINFO is always the first metadata block */
+    if ((len < 8 + FLAC_STREAMINFO_LEN) || memcmp(head, flac_magic, sizeof(flac_magic)) ||
+        ((head[4] & 0x7F) != 0) || (((uint32_t)head[5] << 16 | head[6] << 8 | head[7]) != FLAC_STREAMINFO_LEN)) {
+        return false;
+    }
+
+    memset(info, 0, sizeof(wav_info_t));
+    info->data_offset = 0;
+    info->data_size = file_size;
+    return flac_parse_streaminfo(head + 8, info, &max_block);
+}
+
+/*!
+ * @brief  Read the metadata and allocate the block memory
+ */
+bool flac_open(audio_decoder_t *dec) {
+    flac_state_t *st = (flac_state_t *)malloc(sizeof(flac_state_t));
+
+    if (st == NULL) {
+        Serial.printf("FLAC needs %u bytes, free heap %u\r\n", (unsigned)sizeof(flac_state_t), (unsigned)ESP.getFreeHeap());
+        return false;
+    }
+
+    if (flac_crc16_table[1] == 0) {
+        flac_crc16_init();
+    }
+
+    dec->state = st;
+    st->seek_count = 0;
+    st->first_frame = 0;
+    st->data_end = dec->info.data_size;
+    if (!flac_rewind(dec, st) || !flac_read_metadata(dec, st)) {
+        flac_close(dec);
+        return false;
+    }
+
+    /* An unknown length ends with the last frame */
+    dec->frames = dec->info.fact_frames ? dec->info.fact_frames : UINT32_MAX;
+    dec->block_frame = 0;
+    st->block_len = 0;
+    return true;
+}
+
+/*!
+ * @brief  Decode frames, one FLAC frame at a time
+ */
+uint32_t flac_decode(audio_decoder_t *dec, int16_t *out, uint32_t max) {
+    flac_state_t *st = (flac_state_t *)dec->state;
+    uint32_t count = 0;
+    uint32_t left = audio_decoder_remaining(dec);
+
+    if (max > left) {
+        max = left;
+    }
+
+    while (count < max) {
+        if (dec->block_frame >= st->block_len) {
+            flac_frame_t frame;
+            uint32_t start = flac_tell(st);
+            if (!flac_next_frame(dec, st, &frame)) {
+                /* Past the last frame is the end, anything else is damage */
+                if ((dec->info.fact_frames != 0) && (start < st->data_end)) {
+                    dec->error = true;
+                }
+                dec->frames = dec->frame;
+                break;
+            }
+            dec->block_frame = 0;
+        }
+
+        uint32_t n = st->block_len - dec->block_frame;
+        if (n > max - count) {
+            n = max - count;
+        }
+
+        if (out != NULL) {
+            memcpy(out + count, (int16_t *)st->block + dec->block_frame, n * sizeof(int16_t));
+        }
+        dec->block_frame += n;
+        dec->frame += n;
+        count += n;
+    }
+
+    return count;
+}
+
+/*!
+ * @brief  Find the frame holding a track frame through the seek table, then
+ *         by bisection on frame headers, and decode up to it
+ */
+bool flac_seek(audio_decoder_t *dec, uint32_t frame) {
+    flac_state_t *st = (flac_state_t *)dec->state;
+    uint32_t lo = 0;
+    uint32_t hi = st->data_end - st->first_frame;
+    flac_frame_t header;
+
+    if (frame >= dec->frames) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < st->seek_count; i++) {
+        if (st->seek[i].sample <= frame) {
+            lo = st->seek[i].offset;
+        }
+        else {
+            hi = (st->seek[i].offset < hi) ? st->seek[i].offset : hi;
+            break;
+        }
+    }
+
+    /* lo always starts a frame at or before the target */
+    while (hi - lo > FLAC_SEEK_SPAN) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (!flac_position(dec, st, st->first_frame + mid)) {
+            break;
+        }
+
+        if (flac_read_header(dec, st, &header, true, st->first_frame + hi) && (header.sample <= frame)) {
+            lo = header.offset - st->first_frame;
+        }
+        else {
+            hi = mid;
+        }
+    }
+
+    /* Decode forward, a damaged stream starts over from its first frame */
+    dec->block_frame = 0;
+    st->block_len = 0;
+    if (flac_position(dec, st, st->first_frame + lo)) {
+        while (flac_next_frame(dec, st, &header) && (header.sample <= frame)) {
+            if (frame < header.sample + header.block_size) {
+                dec->block_frame = frame - header.sample;
+                dec->frame = frame;
+                return true;
+            }
+        }
+    }
+
+    flac_rewind(dec, st);
+    return false;
+}
+
+/*!
+ * @brief  Release the block memory
+ */
+void flac_close(audio_decoder_t *dec) {
+    free(dec->state);
+    dec->state = NULL;
+}
@@ -0,0 +1,72 @@
+/*
+ *  audio_flac.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __AUDIO_FLAC_HPP_
+#define __AUDIO_FLAC_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "audio_decoder.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Largest block decoded, the streamable subset limit up to 48 kHz */
+#ifndef FLAC_MAX_BLOCK
+#define FLAC_MAX_BLOCK 4608
+#endif
+
+/* Seek table entries kept, longer tables are thinned out evenly */
+#ifndef FLAC_SEEK_POINTS
+#define FLAC_SEEK_POINTS 64
+#endif
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Recognize a FLAC file from its first bytes. The whole file becomes
+ *         the data chunk, its decoder reads the metadata blocks itself.
+ * @param  First bytes of the file, at least the STREAMINFO block, file size
+ *         and the stream description to fill
+ * @retval False if this is not a FLAC file
+ */
+bool flac_probe(const uint8_t *head, size_t len, uint32_t file_size, wav_info_t *info);
+
+/*!
+ * @brief  Decoder backend, used through audio_decoder_open(). The worst case
+ *         memory of FLAC_MAX_BLOCK frames is allocated on open and released
+ *         on close.
+ */
+bool flac_open(audio_decoder_t *dec);
+uint32_t flac_decode(audio_decoder_t *dec, int16_t *out, uint32_t max);
+bool flac_seek(audio_decoder_t *dec, uint32_t frame);
+void flac_close(audio_decoder_t *dec);
+
+/******************************************************************************/
+
+#endif /* __AUDIO_FLAC_HPP_ */
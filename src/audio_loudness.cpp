@@ -0,0 +1,501 @@
+/*
+ *  audio_loudness.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <SD.h>
+#include <math.h>
+#include "wav_parser.hpp"
+#include "audio_decoder.hpp"
+#include "audio_flac.hpp"
+#include "audio_loudness.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define LOUDNESS_CHUNK_FRAMES 1024   /* Frames decoded between yields */
+#define LOUDNESS_COEFF_SHIFT 28      /* Q28 K-weighting coefficients */
+#define LOUDNESS_SAMPLE_SHIFT 8      /* Extra fraction bits through the filter */
+#define LOUDNESS_ENERGY_SHIFT 4      /* Filter output bits dropped before squaring */
+
+/* Histogram of gating block loudness, 0.1 LU bins from the absolute gate up */
+#define LOUDNESS_GATE -70.0
+#define LOUDNESS_BIN_STEP 0.1
+#define LOUDNESS_BINS 750
+
+#define LOUDNESS_GAIN_SHIFT 12       /* Q12 track gain */
+#define LIMITER_UNITY 32768          /* Q15 limiter gain */
+#define LIMITER_RELEASE_SHIFT 11     /* Release time constant of 2048 frames */
+#define LIMITER_QUEUE (2 * AUDIO_LIMITER_LOOKAHEAD)
+
+static_assert((1 << LOUDNESS_GAIN_SHIFT) == AUDIO_LOUDNESS_UNITY, "LOUDNESS_GAIN_SHIFT does not match AUDIO_LOUDNESS_UNITY");
+
+typedef struct {
+    int32_t b0, b1, b2, a1, a2;
+    int64_t s1, s2;
+} loudness_biquad_t;
+
+/* Work memory of one analysis, allocated while it runs */
+typedef struct {
+    uint8_t head[256];           /* Header reads */
+    audio_decoder_t decoder;
+    int16_t mono[LOUDNESS_CHUNK_FRAMES];
+    uint32_t histogram[LOUDNESS_BINS];
+    loudness_biquad_t shelf;
+    loudness_biquad_t highpass;
+    int64_t steps[3];            /* Energy of the last three 100 ms steps */
+    int64_t energy;              /* Energy of the step being filled */
+    uint32_t step_frames;        /* Frames per 100 ms step */
+    uint32_t step_fill;
+    uint32_t steps_seen;
+    uint16_t peak;
+} loudness_work_t;
+
+/* Track file the analysis decodes from */
+typedef struct {
+    File file;
+    uint32_t data_offset;
+} loudness_source_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/* Playback, owned by the play task */
+static int32_t limiter_delay[AUDIO_LIMITER_LOOKAHEAD];
+static int32_t limiter_box[AUDIO_LIMITER_LOOKAHEAD];
+static int32_t limiter_box_sum = 0;
+static int32_t limiter_release = LIMITER_UNITY;
+static uint32_t limiter_pos = 0;
+static uint32_t limiter_held = 0;            /* Frames in the delay line */
+
+/* Sliding minimum of the gain each frame needs, as a monotonic queue */
+static int32_t limiter_queue_gain[LIMITER_QUEUE];
+static uint32_t limiter_queue_pos[LIMITER_QUEUE];
+static uint32_t limiter_head = 0;
+static uint32_t limiter_tail = 0;
+
+/* Cost counters */
+static uint64_t limiter_cycles = 0;
+static uint32_t limiter_samples = 0;
+static uint32_t limiter_reduced = 0;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static inline int16_t loudness_saturate(int32_t value) {
+    return value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : value);
+}
+
+/*!
+ * @brief  Store a biquad normalized to a0 = 1
+ */
+static void loudness_biquad_set(loudness_biquad_t *biquad, const double *b, const double *a) {
+    double scale = (double)(1 << LOUDNESS_COEFF_SHIFT) / a[0];
+
+    biquad->b0 = lround(b[0] * scale);
+    biquad->b1 = lround(b[1] * scale);
+    biquad->b2 = lround(b[2] * scale);
+    biquad->a1 = lround(a[1] * scale);
+    biquad->a2 = lround(a[2] * scale);
+    biquad->s1 = 0;
+    biquad->s2 = 0;
+}
+
+/*!
+ * @brief  K-weighting filters of ITU-R BS.1770 for any sample rate
+ */
+static void loudness_k_weighting(loudness_work_t *work, uint32_t sample_rate) {
+    /* High shelf modelling the head */
+    double k = tan(M_PI * 1681.974450955533 / sample_rate);
+    double q = 0.7071752369554196;
+    double vh = pow(10.0, 3.999843853973347 / 20.0);
+    double vb = pow(vh, 0.4996667741545416);
+    double shelf_b[3] = { vh + vb * k / q + k * k, 2.0 * (k * k - vh), vh - vb * k / q + k * k };
+    double shelf_a[3] = { 1.0 + k / q + k * k, 2.0 * (k * k - 1.0), 1.0 - k / q + k * k };
+    loudness_biquad_set(&work->shelf, shelf_b, shelf_a);
+
+    /* RLB high pass */
+    k = tan(M_PI * 38.13547087602444 / sample_rate);
+    q = 0.5003270373238773;
+    double a0 = 1.0 + k / q + k * k;
+    double highpass_b[3] = { a0, -2.0 * a0, a0 };
+    double highpass_a[3] = { a0, 2.0 * (k * k - 1.0), 1.0 - k / q + k * k };
+    loudness_biquad_set(&work->highpass, highpass_b, highpass_a);
+}
+
+/*!
+ * @brief  Run one biquad over the samples, transposed direct form II
+ */
+static void loudness_biquad_run(loudness_biquad_t *biquad, int32_t *data, uint32_t count) {
+    int64_t b0 = biquad->b0, b1 = biquad->b1, b2 = biquad->b2;
+    int64_t a1 = biquad->a1, a2 = biquad->a2;
+    int64_t s1 = biquad->s1, s2 = biquad->s2;
+
+    for (uint32_t i = 0; i < count; i++) {
+        int64_t x = data[i];
+        int64_t y = (b0 * x + s1) >> LOUDNESS_COEFF_SHIFT;
+        s1 = b1 * x - a1 * y + s2;
+        s2 = b2 * x - a2 * y;
+        data[i] = y;
+    }
+
+    biquad->s1 = s1;
+    biquad->s2 = s2;
+}
+
+/*!
+ * @brief  Add a 400 ms gating block, made of the last four steps, to the histogram
+ */
+static void loudness_gate_block(loudness_work_t *work) {
+    int64_t energy = work->energy + work->steps[0] + work->steps[1] + work->steps[2];
+    double mean = (double)energy / ((double)work->step_frames * 4 * (1ull << (2 * (15 + LOUDNESS_SAMPLE_SHIFT - LOUDNESS_ENERGY_SHIFT))));
+
+    if (mean <= 0.0) {
+        return;
+    }
+
+    double lufs = -0.691 + 10.0 * log10(mean);
+    if (lufs < LOUDNESS_GATE) {
+        return;
+    }
+
+    int bin = (lufs - LOUDNESS_GATE) / LOUDNESS_BIN_STEP;
+    work->histogram[bin < LOUDNESS_BINS ? bin : LOUDNESS_BINS - 1]++;
+}
+
+/*!
+ * @brief  K-weight a chunk of mono frames and gate it every 100 ms
+ */
+static void loudness_feed(loudness_work_t *work, const int16_t *mono, uint32_t frames) {
+    int32_t filtered[64];
+
+    for (uint32_t done = 0; done < frames; done += 64) {
+        uint32_t n = (frames - done < 64) ? frames - done : 64;
+
+        for (uint32_t i = 0; i < n; i++) {
+            int32_t sample = mono[done + i];
+            uint16_t level = sample < 0 ? -sample : sample;
+            if (level > work->peak) {
+                work->peak = level;
+            }
+            filtered[i] = sample << LOUDNESS_SAMPLE_SHIFT;
+        }
+
+        loudness_biquad_run(&work->shelf, filtered, n);
+        loudness_biquad_run(&work->highpass, filtered, n);
+
+        for (uint32_t i = 0; i < n; i++) {
+            int32_t value = filtered[i] >> LOUDNESS_ENERGY_SHIFT;
+            work->energy += (int64_t)value * value;
+
+            if (++work->step_fill == work->step_frames) {
+                if (++work->steps_seen >= 4) {
+                    loudness_gate_block(work);
+                }
+                work->steps[0] = work->steps[1];
+                work->steps[1] = work->steps[2];
+                work->steps[2] = work->energy;
+                work->energy = 0;
+                work->step_fill = 0;
+            }
+        }
+    }
+}
+
+/*!
+ * @brief  Integrated loudness from the histogram, relative gate 10 LU below the absolute gated level
+ * @retval LUFS x 100 or MUSIC_LOUDNESS_NONE if every block was below the absolute gate
+ */
+static int16_t loudness_integrate(const loudness_work_t *work) {
+    double total = 0.0;
+    uint32_t count = 0;
+
+    for (int i = 0; i < LOUDNESS_BINS; i++) {
+        if (work->histogram[i]) {
+            total += work->histogram[i] * pow(10.0, (LOUDNESS_GATE + (i + 0.5) * LOUDNESS_BIN_STEP + 0.691) / 10.0);
+            count += work->histogram[i];
+        }
+    }
+
+    if (count == 0) {
+        return MUSIC_LOUDNESS_NONE;
+    }
+
+    double threshold = -0.691 + 10.0 * log10(total / count) - 10.0;
+    int first = (threshold - LOUDNESS_GATE) / LOUDNESS_BIN_STEP;
+    total = 0.0;
+    count = 0;
+    for (int i = (first > 0) ? first : 0; i < LOUDNESS_BINS; i++) {
+        if (work->histogram[i]) {
+            total += work->histogram[i] * pow(10.0, (LOUDNESS_GATE + (i + 0.5) * LOUDNESS_BIN_STEP + 0.691) / 10.0);
+            count += work->histogram[i];
+        }
+    }
+
+    return lround((-0.691 + 10.0 * log10(total / count)) * 100.0);
+}
+
+/*!
+ * @brief  Decoder source reading the track file
+ */
+static size_t loudness_source_read(void *ctx, uint8_t *dst, size_t len) {
+    int got = ((loudness_source_t *)ctx)->file.read(dst, len);
+    return (got > 0) ? got : 0;
+}
+
+/*!
+ * @brief  Decoder source seeking inside the data chunk
+ */
+static bool loudness_source_seek(void *ctx, uint32_t offset) {
+    loudness_source_t *source = (loudness_source_t *)ctx;
+    return source->file.seek(source->data_offset + offset);
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Measure the integrated loudness and sample peak of a track
+ */
+bool audio_loudness_analyze(const char *path, music_track_t *track) {
+    uint32_t start = millis();
+    wav_parser_t parser;
+    wav_parse_result_t result = WAV_PARSE_NEED_MORE;
+    loudness_source_t source;
+
+    if ((track->channels == 0) || (track->channels > 2) || (track->sample_rate < 8000)) {
+        return false;
+    }
+
+    source.file = SD.open(path);
+    if (!source.file) {
+        return false;
+    }
+
+    loudness_work_t *work = (loudness_work_t *)calloc(1, sizeof(loudness_work_t));
+    if (work == NULL) {
+        source.file.close();
+        return false;
+    }
+
+    /* The decoder needs the whole fmt chunk, the index keeps only part of it */
+    wav_parser_init(&parser);
+    while (result == WAV_PARSE_NEED_MORE) {
+        int len = source.file.read(work->head, sizeof(work->head));
+        if (len <= 0) {
+            break;
+        }
+
+        if ((parser.offset == 0) && flac_probe(work->head, len, source.file.size(), &parser.info)) {
+            result = WAV_PARSE_DONE;
+            break;
+        }
+
+        result = wav_parser_feed(&parser, work->head, len, NULL);
+        uint32_t skip = wav_parser_skip(&parser, sizeof(work->head));
+        if (skip && !source.file.seek(skip, SeekMode::SeekCur)) {
+            break;
+        }
+    }
+
+    wav_info_t *info = &parser.info;
+    if (info->data_size > track->data_size) {
+        info->data_size = track->data_size;
+    }
+    source.data_offset = info->data_offset;
+    audio_source_t input = { loudness_source_read, loudness_source_seek, &source };
+    bool ok = (result == WAV_PARSE_DONE) && source.file.seek(info->data_offset) &&
+              audio_decoder_open(&work->decoder, info, &input);
+    if (ok) {
+        loudness_k_weighting(work, track->sample_rate);
+        work->step_frames = track->sample_rate / 10;
+    }
+
+    while (ok) {
+        uint32_t frames = 0;
+        uint32_t got;
+        while ((frames < LOUDNESS_CHUNK_FRAMES) &&
+               ((got = audio_decoder_decode(&work->decoder, work->mono + frames, LOUDNESS_CHUNK_FRAMES - frames)) > 0)) {
+            frames += got;
+        }
+        if (frames == 0) {
+            ok = !work->decoder.error;
+            break;
+        }
+
+        loudness_feed(work, work->mono, frames);
+
+        /* Let the reader have the card and the core */
+        vTaskDelay(1);
+    }
+    audio_decoder_close(&work->decoder);
+    source.file.close();
+
+    if (ok) {
+        uint32_t elapsed = millis() - start;
+        track->loudness = loudness_integrate(work);
+        track->peak = work->peak;
+        Serial.printf("Loudness %s: %.2f LUFS, peak %u, %u.%u x real time\r\n", path, track->loudness / 100.0f, track->peak,
+                      elapsed ? track->duration_ms / elapsed : 0, elapsed ? track->duration_ms * 10 / elapsed % 10 : 0);
+    }
+
+    free(work);
+    return ok;
+}
+
+/*!
+ * @brief  Gain that brings a track to AUDIO_LOUDNESS_TARGET
+ */
+uint16_t audio_loudness_gain(const music_track_t *track) {
+    int32_t gain_db = 0;
+
+    if ((track != NULL) && (track->loudness != MUSIC_LOUDNESS_UNKNOWN) && (track->loudness != MUSIC_LOUDNESS_NONE)) {
+        gain_db = AUDIO_LOUDNESS_TARGET - track->loudness;
+        if (gain_db > AUDIO_LOUDNESS_MAX_GAIN) {
+            gain_db = AUDIO_LOUDNESS_MAX_GAIN;
+        }
+        else if (gain_db < -AUDIO_LOUDNESS_MAX_GAIN) {
+            gain_db = -AUDIO_LOUDNESS_MAX_GAIN;
+        }
+    }
+
+    return lroundf(powf(10.0f, gain_db / 2000.0f) * AUDIO_LOUDNESS_UNITY);
+}
+
+/*!
+ * @brief  Run one frame through the limiter
+ * @retval Frame leaving the delay line
+ *
+ * Each frame needs the gain that brings it under the ceiling. The minimum of
+ * that over the look-ahead window, released slowly and then averaged over the
+ * window again, is at most the needed gain of the frame leaving the delay line,
+ * so the ceiling holds while the gain moves smoothly.
+ */
+static inline int16_t limiter_step(int32_t x) {
+    int32_t level = x < 0 ? -x : x;
+    int32_t need = (level > AUDIO_LIMITER_CEILING) ? (AUDIO_LIMITER_CEILING << 15) / level : LIMITER_UNITY;
+
+    /* Window of the frame leaving the delay line and the ones after it */
+    while ((limiter_head != limiter_tail) && (limiter_queue_gain[(limiter_tail - 1) % LIMITER_QUEUE] >= need)) {
+        limiter_tail--;
+    }
+    limiter_queue_gain[limiter_tail % LIMITER_QUEUE] = need;
+    limiter_queue_pos[limiter_tail % LIMITER_QUEUE] = limiter_pos;
+    limiter_tail++;
+    if (limiter_pos - limiter_queue_pos[limiter_head % LIMITER_QUEUE] > AUDIO_LIMITER_LOOKAHEAD) {
+        limiter_head++;
+    }
+
+    int32_t floor = limiter_queue_gain[limiter_head % LIMITER_QUEUE];
+    limiter_release = (floor < limiter_release) ? floor : limiter_release + ((floor - limiter_release) >> LIMITER_RELEASE_SHIFT);
+
+    uint32_t slot = limiter_pos % AUDIO_LIMITER_LOOKAHEAD;
+    limiter_box_sum += limiter_release - limiter_box[slot];
+    limiter_box[slot] = limiter_release;
+    int32_t out = limiter_delay[slot];
+    limiter_delay[slot] = x;
+    limiter_pos++;
+
+    int32_t smooth = limiter_box_sum / AUDIO_LIMITER_LOOKAHEAD;
+    if (smooth < LIMITER_UNITY) {
+        limiter_reduced++;
+    }
+    return loudness_saturate(((int64_t)out * smooth) >> 15);
+}
+
+/*!
+ * @brief  Forget the delayed samples
+ */
+void audio_loudness_reset(void) {
+    memset(limiter_delay, 0, sizeof(limiter_delay));
+    for (int i = 0; i < AUDIO_LIMITER_LOOKAHEAD; i++) {
+        limiter_box[i] = LIMITER_UNITY;
+    }
+    limiter_box_sum = LIMITER_UNITY * AUDIO_LIMITER_LOOKAHEAD;
+    limiter_release = LIMITER_UNITY;
+    limiter_head = 0;
+    limiter_tail = 0;
+    limiter_held = 0;
+}
+
+/*!
+ * @brief  Frames the delay line holds
+ */
+uint32_t audio_loudness_held(void) {
+    return limiter_held;
+}
+
+/*!
+ * @brief  Apply a gain and limit peaks in place
+ */
+uint32_t audio_loudness_process(int16_t *samples, uint32_t count, uint16_t gain) {
+    uint32_t start = ESP.getCycleCount();
+    uint32_t written = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        int16_t out = limiter_step((samples[i] * gain) >> LOUDNESS_GAIN_SHIFT);
+
+        /* The delay line fills first, the stream starts without leading silence */
+        if (limiter_held < AUDIO_LIMITER_LOOKAHEAD) {
+            limiter_held++;
+            continue;
+        }
+        samples[written++] = out;
+    }
+
+    limiter_cycles += ESP.getCycleCount() - start;
+    limiter_samples += count;
+    return written;
+}
+
+/*!
+ * @brief  Push the delayed samples out at the end of a stream
+ */
+uint32_t audio_loudness_drain(int16_t *samples, uint32_t count) {
+    uint32_t written = 0;
+
+    while ((written < count) && (limiter_held > 0)) {
+        samples[written++] = limiter_step(0);
+        limiter_held--;
+    }
+
+    if (limiter_held == 0) {
+        audio_loudness_reset();
+    }
+    return written;
+}
+
+/*!
+ * @brief  Log the limiter cost and reset the counters
+ */
+void audio_loudness_report(void) {
+    if (limiter_samples == 0) {
+        return;
+    }
+
+    Serial.printf("Limiter: %u cycles per sample, %u%% of samples limited\r\n",
+                  (uint32_t)(limiter_cycles / limiter_samples), (uint32_t)((uint64_t)limiter_reduced * 100 / limiter_samples));
+    limiter_cycles = 0;
+    limiter_samples = 0;
+    limiter_reduced = 0;
+}
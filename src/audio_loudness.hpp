@@ -0,0 +1,118 @@
+/*
+ *  audio_loudness.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __AUDIO_LOUDNESS_HPP_
+#define __AUDIO_LOUDNESS_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "music_library.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Level every track is brought to, LUFS x 100 */
+#ifndef AUDIO_LOUDNESS_TARGET
+#define AUDIO_LOUDNESS_TARGET -1400
+#endif
+
+/* Largest correction in either direction, dB x 100 */
+#ifndef AUDIO_LOUDNESS_MAX_GAIN
+#define AUDIO_LOUDNESS_MAX_GAIN 1200
+#endif
+
+/* Limiter look-ahead in frames, a power of two, output is delayed by as much */
+#ifndef AUDIO_LIMITER_LOOKAHEAD
+#define AUDIO_LIMITER_LOOKAHEAD 64
+#endif
+
+#define AUDIO_LIMITER_CEILING 31000  /* Peak sample after limiting, about -0.5 dBFS */
+
+#define AUDIO_LOUDNESS_UNITY 4096    /* Q12 gain of 1.0 */
+
+static_assert((AUDIO_LIMITER_LOOKAHEAD & (AUDIO_LIMITER_LOOKAHEAD - 1)) == 0, "AUDIO_LIMITER_LOOKAHEAD must be a power of two");
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Measure the integrated loudness and sample peak of a track, gated
+ *         like EBU R128 on the mono mix that is played. Reads the whole file
+ *         in small chunks, yielding between them.
+ * @param  Path of the file and its metadata, loudness and peak are filled in
+ * @retval False if the file could not be read
+ */
+bool audio_loudness_analyze(const char *path, music_track_t *track);
+
+/*!
+ * @brief  Gain that brings a track to AUDIO_LOUDNESS_TARGET
+ * @param  Track, NULL or a track not analyzed yet plays at unity gain
+ * @retval Q12 gain
+ */
+uint16_t audio_loudness_gain(const music_track_t *track);
+
+/*!
+ * @brief  Forget the delayed samples, for a stream that does not continue the last one
+ * @param  None
+ * @retval None
+ */
+void audio_loudness_reset(void);
+
+/*!
+ * @brief  Frames held in the delay line, output lags input by as many
+ * @param  None
+ * @retval Frame count, AUDIO_LIMITER_LOOKAHEAD once the stream has started
+ */
+uint32_t audio_loudness_held(void);
+
+/*!
+ * @brief  Apply a gain and limit peaks in place, output lags input by
+ *         AUDIO_LIMITER_LOOKAHEAD frames. The first frames after a reset only
+ *         fill the delay line, so no silence is put ahead of the stream.
+ * @param  16-bit mono samples, their count and the Q12 gain
+ * @retval Samples written to the start of the buffer
+ */
+uint32_t audio_loudness_process(int16_t *samples, uint32_t count, uint16_t gain);
+
+/*!
+ * @brief  Push out the samples still delayed when the stream ends, the
+ *         limiter is reset once it is empty
+ * @param  Buffer for 16-bit mono samples and its size in samples
+ * @retval Samples written
+ */
+uint32_t audio_loudness_drain(int16_t *samples, uint32_t count);
+
+/*!
+ * @brief  Log the limiter cost and reset the counters
+ * @param  None
+ * @retval None
+ */
+void audio_loudness_report(void);
+
+/******************************************************************************/
+
+#endif /* __AUDIO_LOUDNESS_HPP_ */
@@ -0,0 +1,274 @@
+/*
+ *  audio_mixer.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include "audio_mixer.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+typedef struct {
+    const audio_clip_t *clip;
+    uint32_t frame;              /* Clip frame being played */
+    uint32_t phase;              /* Q16 position between frame and the next one */
+    uint16_t gain;
+    bool loop;
+    bool active;
+} mixer_voice_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static mixer_voice_t mixer_voices[AUDIO_MIXER_VOICES];
+static uint16_t mixer_music_gain = AUDIO_MIXER_UNITY;
+
+/* 8-bit blocks are mixed at 16-bit here */
+static int16_t mixer_wide[AUDIO_BLOCK_SIZE];
+
+/* Cost counters */
+static uint64_t mixer_cycles = 0;
+static uint32_t mixer_samples = 0;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static inline int16_t mixer_saturate(int32_t value) {
+    if (value > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (value < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return value;
+}
+
+/*!
+ * @brief  Get one clip sample as 16-bit, mapped to an output channel
+ */
+static inline int32_t mixer_sample(const audio_clip_t *clip, uint32_t frame, uint32_t channel, uint32_t channels) {
+    uint32_t index = frame * clip->channels;
+    int32_t a, b;
+
+    if (clip->bits == 16) {
+        const int16_t *data = (const int16_t *)clip->data;
+        a = data[index];
+        b = (clip->channels > 1) ? data[index + 1] : a;
+    }
+    else {
+        a = ((int32_t)clip->data[index] - 128) << 8;
+        b = (clip->channels > 1) ? ((int32_t)clip->data[index + 1] - 128) << 8 : a;
+    }
+
+    /* Mono clips go to every channel, stereo clips are averaged for a mono output */
+    if (channels == 1) {
+        return (a + b) >> 1;
+    }
+    return (channel == 0) ? a : b;
+}
+
+/*!
+ * @brief  Add one voice into 16-bit interleaved samples, stepping through the
+ *         clip at its own rate with linear interpolation
+ */
+static void mixer_voice_render(mixer_voice_t *voice, int16_t *out, uint32_t frames, uint32_t rate, uint32_t channels) {
+    const audio_clip_t *clip = voice->clip;
+    uint32_t step = ((uint64_t)clip->sample_rate << 16) / rate;
+    int32_t gain = voice->gain;
+
+    for (uint32_t i = 0; i < frames; i++) {
+        if (voice->frame >= clip->frames) {
+            if (!voice->loop) {
+                voice->active = false;
+                return;
+            }
+            voice->frame %= clip->frames;
+        }
+
+        /* The last frame interpolates towards the start when looping */
+        uint32_t next = voice->frame + 1;
+        if (next >= clip->frames) {
+            next = voice->loop ? 0 : voice->frame;
+        }
+
+        int32_t frac = voice->phase >> 2;    /* Q14 keeps the product in range */
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            int32_t a = mixer_sample(clip, voice->frame, ch, channels);
+            int32_t b = mixer_sample(clip, next, ch, channels);
+            int32_t sample = a + (((b - a) * frac) >> 14);
+            out[ch] = mixer_saturate(out[ch] + ((sample * gain) >> 8));
+        }
+        out += channels;
+
+        voice->phase += step;
+        voice->frame += voice->phase >> 16;
+        voice->phase &= 0xFFFF;
+    }
+}
+
+/*!
+ * @brief  Scale 16-bit samples by the music gain
+ */
+static void mixer_scale(int16_t *samples, uint32_t count, int32_t gain) {
+    for (uint32_t i = 0; i < count; i++) {
+        samples[i] = mixer_saturate((samples[i] * gain) >> 8);
+    }
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Start a voice playing a clip
+ */
+int audio_mixer_play(const audio_clip_t *clip, uint16_t gain, bool loop) {
+    if ((clip == NULL) || (clip->frames == 0) || (clip->sample_rate == 0) ||
+        ((clip->bits != 8) && (clip->bits != 16)) || (clip->channels < 1) || (clip->channels > 2)) {
+        return -1;
+    }
+
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        mixer_voice_t *voice = &mixer_voices[i];
+        if (!voice->active) {
+            voice->clip = clip;
+            voice->frame = 0;
+            voice->phase = 0;
+            voice->gain = (gain < AUDIO_MIXER_GAIN_MAX) ? gain : AUDIO_MIXER_GAIN_MAX;
+            voice->loop = loop;
+            voice->active = true;
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/*!
+ * @brief  Stop one voice
+ */
+void audio_mixer_stop(int voice) {
+    if ((voice >= 0) && (voice < AUDIO_MIXER_VOICES)) {
+        mixer_voices[voice].active = false;
+    }
+}
+
+/*!
+ * @brief  Stop all voices playing a clip, all voices if clip is NULL
+ */
+void audio_mixer_stop_clip(const audio_clip_t *clip) {
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        if ((clip == NULL) || (mixer_voices[i].clip == clip)) {
+            mixer_voices[i].active = false;
+        }
+    }
+}
+
+/*!
+ * @brief  Set the gain applied to the music stream
+ */
+void audio_mixer_set_music_gain(uint16_t gain) {
+    mixer_music_gain = (gain < AUDIO_MIXER_GAIN_MAX) ? gain : AUDIO_MIXER_GAIN_MAX;
+}
+
+/*!
+ * @brief  Check if any voice is playing
+ */
+bool audio_mixer_active(void) {
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        if (mixer_voices[i].active) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*!
+ * @brief  Check if a voice is playing a clip
+ */
+bool audio_mixer_playing(const audio_clip_t *clip) {
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        if (mixer_voices[i].active && (mixer_voices[i].clip == clip)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*!
+ * @brief  Mix all voices into a block, converting them to its format
+ */
+void audio_mixer_render(audio_block_t *block) {
+    bool active = audio_mixer_active();
+    uint32_t channels = block->channels;
+    uint32_t count = (block->bits == 16) ? (block->len >> 1) : block->len;
+    uint32_t frames = count / channels;
+    int16_t *samples = (int16_t *)block->data;
+
+    /* Untouched music costs nothing */
+    if ((!active && (mixer_music_gain == AUDIO_MIXER_UNITY)) || (frames == 0) || (channels > 2)) {
+        return;
+    }
+
+    uint32_t start = ESP.getCycleCount();
+
+    if (block->bits != 16) {
+        for (uint32_t i = 0; i < count; i++) {
+            mixer_wide[i] = ((int16_t)block->data[i] - 128) << 8;
+        }
+        samples = mixer_wide;
+    }
+
+    if (mixer_music_gain != AUDIO_MIXER_UNITY) {
+        mixer_scale(samples, count, mixer_music_gain);
+    }
+
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        if (mixer_voices[i].active) {
+            mixer_voice_render(&mixer_voices[i], samples, frames, block->sample_rate, channels);
+        }
+    }
+
+    if (block->bits != 16) {
+        for (uint32_t i = 0; i < count; i++) {
+            block->data[i] = (mixer_wide[i] >> 8) + 128;
+        }
+    }
+
+    mixer_cycles += ESP.getCycleCount() - start;
+    mixer_samples += count;
+}
+
+/*!
+ * @brief  Log the mixing cost and reset the counters
+ */
+void audio_mixer_report(void) {
+    if (mixer_samples == 0) {
+        return;
+    }
+
+    Serial.printf("Mixer: %u samples, %u cycles per sample\r\n", mixer_samples, (uint32_t)(mixer_cycles / mixer_samples));
+    mixer_cycles = 0;
+    mixer_samples = 0;
+}
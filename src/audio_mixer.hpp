@@ -0,0 +1,126 @@
+/*
+ *  audio_mixer.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __AUDIO_MIXER_HPP_
+#define __AUDIO_MIXER_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "audio_ring.hpp"
+#include "audio_normalize.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Number of sound effect voices mixed over the music */
+#ifndef AUDIO_MIXER_VOICES
+#define AUDIO_MIXER_VOICES 4
+#endif
+
+/* Output rate when only sound effects are playing, same as music so the speaker is never reconfigured */
+#define AUDIO_MIXER_RATE AUDIO_OUTPUT_RATE
+
+/* Gain is Q8, this is 1.0 */
+#define AUDIO_MIXER_UNITY 256
+#define AUDIO_MIXER_GAIN_MAX (4 * AUDIO_MIXER_UNITY)
+
+/* PCM in memory, 8-bit unsigned or 16-bit signed, interleaved */
+typedef struct {
+    const uint8_t *data;
+    uint32_t frames;
+    uint32_t sample_rate;
+    uint8_t channels;
+    uint8_t bits;
+} audio_clip_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*
+ * The mixer is owned by the play task, none of these may be called from
+ * another task.
+ */
+
+/*!
+ * @brief  Start a voice playing a clip, the clip must stay valid while it plays
+ * @param  Clip, gain and whether it repeats until stopped
+ * @retval Voice number or -1 if all voices are busy
+ */
+int audio_mixer_play(const audio_clip_t *clip, uint16_t gain, bool loop);
+
+/*!
+ * @brief  Stop one voice
+ * @param  Voice number
+ * @retval None
+ */
+void audio_mixer_stop(int voice);
+
+/*!
+ * @brief  Stop all voices playing a clip, all voices if clip is NULL
+ * @param  Clip
+ * @retval None
+ */
+void audio_mixer_stop_clip(const audio_clip_t *clip);
+
+/*!
+ * @brief  Set the gain applied to the music stream
+ * @param  Gain
+ * @retval None
+ */
+void audio_mixer_set_music_gain(uint16_t gain);
+
+/*!
+ * @brief  Check if any voice is playing
+ * @param  None
+ * @retval True if a voice is playing
+ */
+bool audio_mixer_active(void);
+
+/*!
+ * @brief  Check if a voice is playing a clip
+ * @param  Clip
+ * @retval True if the clip is in use
+ */
+bool audio_mixer_playing(const audio_clip_t *clip);
+
+/*!
+ * @brief  Mix all voices into a block, converting them to its format
+ * @param  Block with music or silence, 8 or 16-bit
+ * @retval None
+ */
+void audio_mixer_render(audio_block_t *block);
+
+/*!
+ * @brief  Log the mixing cost and reset the counters
+ * @param  None
+ * @retval None
+ */
+void audio_mixer_report(void);
+
+/******************************************************************************/
+
+#endif /* __AUDIO_MIXER_HPP_ */
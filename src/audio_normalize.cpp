@@ -0,0 +1,258 @@
+/*
+ *  audio_normalize.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <math.h>
+#include "audio_normalize.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Silence kept before the first frame so the filter is centered on it */
+#define RESAMPLER_HISTORY (RESAMPLER_TAPS / 2 - 1)
+
+#define RESAMPLER_PHASE_SHIFT 10     /* Q16 fraction to phase index */
+
+static_assert((0x10000 >> RESAMPLER_PHASE_SHIFT) == RESAMPLER_PHASES, "RESAMPLER_PHASE_SHIFT does not match RESAMPLER_PHASES");
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static inline int16_t normalize_saturate(int32_t value) {
+    return value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : value);
+}
+
+/*!
+ * @brief  32-bit float frames to 16-bit mono
+ */
+static void normalize_float(const uint8_t *src, int16_t *dst, uint32_t frames, uint32_t channels) {
+    for (uint32_t i = 0; i < frames; i++) {
+        float left, right;
+        memcpy(&left, src + i * channels * 4, sizeof(left));
+        right = left;
+        if (channels > 1) {
+            memcpy(&right, src + i * channels * 4 + 4, sizeof(right));
+        }
+
+        float value = (left + right) * 16384.0f;
+        dst[i] = value >= 32767.0f ? 32767 : (value <= -32768.0f ? -32768 : (int16_t)value);
+    }
+}
+
+/*!
+ * @brief  24/32-bit integer frames to 16-bit mono, keeping the two most significant bytes
+ */
+static void normalize_wide(const uint8_t *src, int16_t *dst, uint32_t frames, uint32_t channels, uint32_t bytes) {
+    uint32_t align = channels * bytes;
+
+    /* Little endian, the two most significant bytes are the last ones */
+    src += bytes - 2;
+    if (channels == 1) {
+        for (uint32_t i = 0; i < frames; i++) {
+            dst[i] = (int16_t)(src[i * align] | (src[i * align + 1] << 8));
+        }
+    }
+    else {
+        for (uint32_t i = 0; i < frames; i++) {
+            int32_t left = (int16_t)(src[i * align] | (src[i * align + 1] << 8));
+            int32_t right = (int16_t)(src[i * align + bytes] | (src[i * align + bytes + 1] << 8));
+            dst[i] = (left + right) >> 1;
+        }
+    }
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Convert frames of any supported WAV format to 16-bit mono
+ */
+void normalize_mono16(const uint8_t *src, int16_t *dst, uint32_t frames, const wav_info_t *info) {
+    uint32_t channels = info->channels;
+    uint32_t bytes = info->bits >> 3;
+
+    if (info->format == WAV_FORMAT_FLOAT) {
+        normalize_float(src, dst, frames, channels);
+        return;
+    }
+
+    if (bytes == 1) {
+        /* Unsigned 8-bit */
+        if (channels == 1) {
+            for (uint32_t i = 0; i < frames; i++) {
+                dst[i] = (src[i] - 128) << 8;
+            }
+        }
+        else {
+            for (uint32_t i = 0; i < frames; i++) {
+                dst[i] = (src[2 * i] + src[2 * i + 1] - 256) << 7;
+            }
+        }
+    }
+    else if (bytes == 2) {
+        const int16_t *in = (const int16_t *)src;
+        if (channels == 1) {
+            memcpy(dst, in, frames * sizeof(int16_t));
+        }
+        else {
+            for (uint32_t i = 0; i < frames; i++) {
+                dst[i] = (in[2 * i] + in[2 * i + 1]) >> 1;
+            }
+        }
+    }
+    else {
+        normalize_wide(src, dst, frames, channels, bytes);
+    }
+}
+
+/*!
+ * @brief  Prepare a resampler, the filter cutoff follows the lower of both rates
+ */
+void resampler_init(resampler_t *rs, uint32_t in_rate, uint32_t out_rate) {
+    rs->bypass = (in_rate == out_rate) || (in_rate == 0) || (out_rate == 0);
+    rs->step = rs->bypass ? 0x10000 : ((uint64_t)in_rate << 16) / out_rate;
+    rs->len = RESAMPLER_HISTORY;
+    rs->pos = 0;
+    rs->consumed = 0;
+    memset(rs->buf, 0, RESAMPLER_HISTORY * sizeof(int16_t));
+
+    if (rs->bypass) {
+        return;
+    }
+
+    /* Blackman windowed sinc, cut a little below the lower Nyquist frequency */
+    float cutoff = (in_rate < out_rate ? 1.0f : (float)out_rate / in_rate) * 0.9f;
+    for (int phase = 0; phase <= RESAMPLER_PHASES; phase++) {
+        float taps[RESAMPLER_TAPS];
+        float sum = 0.0f;
+
+        for (int j = 0; j < RESAMPLER_TAPS; j++) {
+            float x = j - RESAMPLER_HISTORY - (float)phase / RESAMPLER_PHASES;
+            float sinc = (x == 0.0f) ? cutoff : sinf((float)M_PI * cutoff * x) / ((float)M_PI * x);
+            float window = 0.42f + 0.5f * cosf(2.0f * (float)M_PI * x / RESAMPLER_TAPS) +
+                           0.08f * cosf(4.0f * (float)M_PI * x / RESAMPLER_TAPS);
+            taps[j] = sinc * window;
+            sum += taps[j];
+        }
+
+        /* Unity gain at DC after rounding, the rounding error goes to the center tap */
+        int32_t total = 0;
+        for (int j = 0; j < RESAMPLER_TAPS; j++) {
+            rs->coeffs[phase][j] = lroundf(taps[j] / sum * 16384.0f);
+            total += rs->coeffs[phase][j];
+        }
+        rs->coeffs[phase][RESAMPLER_HISTORY] += 16384 - total;
+    }
+}
+
+/*!
+ * @brief  Get where to write input frames
+ */
+int16_t *resampler_input(resampler_t *rs, uint32_t *space) {
+    *space = RESAMPLER_TAPS + RESAMPLER_CHUNK - rs->len;
+    return rs->buf + rs->len;
+}
+
+/*!
+ * @brief  Add frames written to the input buffer
+ */
+void resampler_commit(resampler_t *rs, uint32_t frames) {
+    rs->len += frames;
+}
+
+/*!
+ * @brief  Pad the input with silence so the last frames can be output
+ */
+void resampler_flush(resampler_t *rs) {
+    uint32_t space;
+    int16_t *in = resampler_input(rs, &space);
+    uint32_t pad = RESAMPLER_TAPS / 2;
+
+    if (rs->bypass) {
+        return;
+    }
+
+    if (pad > space) {
+        pad = space;
+    }
+    memset(in, 0, pad * sizeof(int16_t));
+    rs->len += pad;
+}
+
+/*!
+ * @brief  Produce output frames from the buffered input
+ */
+uint32_t resampler_output(resampler_t *rs, int16_t *out, uint32_t max) {
+    uint32_t count = 0;
+
+    if (rs->bypass) {
+        uint32_t first = RESAMPLER_HISTORY + (rs->pos >> 16);
+        count = (rs->len > first) ? rs->len - first : 0;
+        if (count > max) {
+            count = max;
+        }
+        memcpy(out, rs->buf + first, count * sizeof(int16_t));
+        rs->pos += count << 16;
+    }
+    else {
+        while (count < max) {
+            uint32_t base = rs->pos >> 16;
+            if (base + RESAMPLER_TAPS > rs->len) {
+                break;
+            }
+
+            /* Filter with the two nearest phases and interpolate between them */
+            uint32_t phase = (rs->pos & 0xFFFF) >> RESAMPLER_PHASE_SHIFT;
+            int32_t frac = rs->pos & ((1 << RESAMPLER_PHASE_SHIFT) - 1);
+            const int16_t *lower = rs->coeffs[phase];
+            const int16_t *upper = rs->coeffs[phase + 1];
+            const int16_t *in = rs->buf + base;
+            int32_t acc0 = 0;
+            int32_t acc1 = 0;
+            for (int j = 0; j < RESAMPLER_TAPS; j++) {
+                acc0 += in[j] * lower[j];
+                acc1 += in[j] * upper[j];
+            }
+
+            int32_t acc = (acc0 >> 14) + (int32_t)(((int64_t)(acc1 - acc0) * frac) >> (14 + RESAMPLER_PHASE_SHIFT));
+            out[count++] = normalize_saturate(acc);
+            rs->pos += rs->step;
+        }
+    }
+
+    /* Drop frames no output needs any more */
+    uint32_t drop = rs->pos >> 16;
+    if (drop > rs->len) {
+        drop = rs->len;
+    }
+    memmove(rs->buf, rs->buf + drop, (rs->len - drop) * sizeof(int16_t));
+    rs->len -= drop;
+    rs->pos -= drop << 16;
+    rs->consumed += drop;
+    return count;
+}
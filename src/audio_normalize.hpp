@@ -0,0 +1,128 @@
+/*
+ *  audio_normalize.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __AUDIO_NORMALIZE_HPP_
+#define __AUDIO_NORMALIZE_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "wav_parser.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Every track is played at this rate, 16-bit mono */
+#ifndef AUDIO_OUTPUT_RATE
+#define AUDIO_OUTPUT_RATE 44100
+#endif
+
+#define RESAMPLER_TAPS 16            /* Filter length, even */
+#define RESAMPLER_PHASES 64          /* Fractional positions with their own filter, interpolated between */
+#define RESAMPLER_CHUNK 512          /* Input frames buffered at most */
+
+/*
+ * Polyphase windowed-sinc resampler for 16-bit mono. Input is written straight
+ * into its buffer, positions are Q16 input frames.
+ */
+typedef struct {
+    int16_t coeffs[RESAMPLER_PHASES + 1][RESAMPLER_TAPS];    /* Q14, each phase sums to 1.0 */
+    int16_t buf[RESAMPLER_TAPS + RESAMPLER_CHUNK];
+    uint32_t len;                /* Frames in buf */
+    uint32_t pos;                /* Q16 buf position of the next output, minus RESAMPLER_TAPS / 2 - 1 */
+    uint32_t step;               /* Q16 input frames per output frame */
+    uint32_t consumed;           /* Input frames dropped from buf */
+    bool bypass;                 /* Same rate, samples are copied */
+} resampler_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Convert frames of any supported WAV format to 16-bit mono,
+ *         8-bit is widened and stereo is averaged
+ * @param  Raw frames, output, frame count and the format of the input
+ * @retval None
+ */
+void normalize_mono16(const uint8_t *src, int16_t *dst, uint32_t frames, const wav_info_t *info);
+
+/*!
+ * @brief  Prepare a resampler, the filter cutoff follows the lower of both rates
+ * @param  Resampler, input and output rates
+ * @retval None
+ */
+void resampler_init(resampler_t *rs, uint32_t in_rate, uint32_t out_rate);
+
+/*!
+ * @brief  Get where to write input frames
+ * @param  Resampler and the number of frames that fit
+ * @retval Input buffer
+ */
+int16_t *resampler_input(resampler_t *rs, uint32_t *space);
+
+/*!
+ * @brief  Add frames written to the input buffer
+ * @param  Resampler and frame count
+ * @retval None
+ */
+void resampler_commit(resampler_t *rs, uint32_t frames);
+
+/*!
+ * @brief  Pad the input with silence so the last frames can be output
+ * @param  Resampler
+ * @retval None
+ */
+void resampler_flush(resampler_t *rs);
+
+/*!
+ * @brief  Produce output frames from the buffered input
+ * @param  Resampler, output and the most frames wanted
+ * @retval Frames produced, fewer than wanted once more input is needed
+ */
+uint32_t resampler_output(resampler_t *rs, int16_t *out, uint32_t max);
+
+/*!
+ * @brief  Input frame the next output frame is taken from
+ * @param  Resampler
+ * @retval Input frames since resampler_init
+ */
+static inline uint32_t resampler_position(const resampler_t *rs) {
+    return rs->consumed + (rs->pos >> 16);
+}
+
+/*!
+ * @brief  Input frames buffered that no output frame was taken from yet
+ * @param  Resampler
+ * @retval Frame count
+ */
+static inline uint32_t resampler_buffered(const resampler_t *rs) {
+    int32_t frames = (int32_t)rs->len - (RESAMPLER_TAPS / 2 - 1) - (int32_t)(rs->pos >> 16);
+    return (frames > 0) ? frames : 0;
+}
+
+/******************************************************************************/
+
+#endif /* __AUDIO_NORMALIZE_HPP_ */
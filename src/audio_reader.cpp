@@ -0,0 +1,641 @@
+/*
+ *  audio_reader.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <SD.h>
+#include <atomic>
+#include "audio_reader.hpp"
+#include "wav_parser.hpp"
+#include "audio_normalize.hpp"
+#include "audio_decoder.hpp"
+#include "audio_flac.hpp"
+#include "audio_stretch.hpp"
+#include "audio_crossfade.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+enum {
+    REQUEST_OPEN = 0,            /* Abort everything and stream a file */
+    REQUEST_NEXT,                /* Stream a file right after the current one */
+    REQUEST_STOP,                /* Abort everything */
+};
+
+/* Time the ring plays for, what a crossfade can borrow from when the card falls behind */
+#define READER_RING_MS ((uint64_t)AUDIO_RING_BLOCKS * (AUDIO_BLOCK_SIZE / 2) * 1000 / AUDIO_OUTPUT_RATE)
+
+typedef struct {
+    char path[AUDIO_PATH_MAX];
+    uint32_t frame;              /* Source frame to start from */
+    uint16_t track_id;
+    uint16_t gain;
+    uint8_t type;
+    TaskHandle_t consumer;
+} reader_request_t;
+
+/* One open file being streamed or prefetched */
+typedef struct {
+    File file;
+    wav_info_t info;
+    uint8_t head_buf[512];       /* Header read, holds the first samples once parsing is done */
+    size_t head_len;
+    size_t head_pos;
+    audio_decoder_t decoder;     /* File samples to 16-bit mono */
+    uint32_t start_frame;        /* Source frame the stream started at */
+    resampler_t resampler;       /* 16-bit mono at the file rate to AUDIO_OUTPUT_RATE */
+    stretch_t stretch;           /* Then to the playback speed */
+    uint64_t cycles;             /* Cost of reading and normalizing, for the log */
+    uint32_t frames;             /* Frames output */
+    uint16_t track_id;
+    uint16_t gain;               /* Q12 loudness gain stamped on the blocks */
+    uint8_t end_flags;
+    bool padded;                 /* All samples are in the resampler */
+    bool flushed;                /* All samples are in the time stretcher */
+    bool active;                 /* Blocks are still owed to the consumer */
+} reader_stream_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static audio_ring_t *reader_ring = NULL;
+static QueueHandle_t reader_queue = NULL;
+static TaskHandle_t reader_task_handle = NULL;
+static uint32_t reader_tail_ms = 0;
+
+/* Current stream and the next one, prefetched near the end of the current */
+static reader_stream_t reader_streams[2];
+
+/* Crossfade, the head of the next stream is mixed into the tail of the current */
+static std::atomic<uint32_t> reader_crossfade_ms(0);
+static int16_t reader_mix[AUDIO_BLOCK_SIZE / 2];
+static uint32_t reader_fade_target = 0;               /* Frames the fade should take, 0 for none */
+static audio_crossfade_t reader_fade = {0, 0};        /* Running fade, len 0 if not fading */
+
+/* Bytes per second the card delivered, averaged over the large reads */
+static uint32_t reader_sd_rate = 0;
+
+/* Playback speed in percent, both streams follow it */
+static std::atomic<uint16_t> reader_speed(AUDIO_SPEED_NORMAL);
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Read raw sample bytes, starting with the ones left over from parsing
+ */
+static size_t reader_read(reader_stream_t *stream, uint8_t *dst, size_t len) {
+    size_t got = 0;
+
+    if (stream->head_pos < stream->head_len) {
+        got = stream->head_len - stream->head_pos;
+        if (got > len) {
+            got = len;
+        }
+
+        memcpy(dst, stream->head_buf + stream->head_pos, got);
+        stream->head_pos += got;
+    }
+
+    if (got < len) {
+        uint32_t start = micros();
+        int n = stream->file.read(dst + got, len - got);
+        uint32_t elapsed = micros() - start;
+        if (n > 0) {
+            got += n;
+        }
+
+        /* Small reads are dominated by call overhead and tell nothing about the card */
+        if ((n >= 512) && (elapsed > 0)) {
+            uint32_t rate = (uint64_t)n * 1000000 / elapsed;
+            reader_sd_rate = reader_sd_rate ? (reader_sd_rate * 7 + rate) / 8 : rate;
+        }
+    }
+
+    return got;
+}
+
+/*!
+ * @brief  Decoder source reading the data chunk of a stream
+ */
+static size_t reader_source_read(void *ctx, uint8_t *dst, size_t len) {
+    return reader_read((reader_stream_t *)ctx, dst, len);
+}
+
+/*!
+ * @brief  Decoder source seeking inside the data chunk, the parse leftover is dropped
+ */
+static bool reader_source_seek(void *ctx, uint32_t offset) {
+    reader_stream_t *stream = (reader_stream_t *)ctx;
+
+    if (!stream->file.seek(stream->info.data_offset + offset)) {
+        return false;
+    }
+
+    stream->head_len = 0;
+    stream->head_pos = 0;
+    return true;
+}
+
+/*!
+ * @brief  Open a WAV file and parse it up to its data chunk
+ */
+static bool reader_open_wav(reader_stream_t *stream, const char *filename) {
+    wav_parser_t parser;
+    wav_parse_result_t result = WAV_PARSE_NEED_MORE;
+    wav_info_t *info = &stream->info;
+    File &file = stream->file;
+
+    file = SD.open(filename);
+
+    if (!file) {
+        Serial.println("File is NULL");
+        return false;
+    }
+
+    /* Parse from sequential reads, bytes past the header are kept as the first samples */
+    wav_parser_init(&parser);
+    stream->head_len = 0;
+    stream->head_pos = 0;
+    while (result == WAV_PARSE_NEED_MORE) {
+        size_t used;
+        int len = file.read(stream->head_buf, sizeof(stream->head_buf));
+        if (len <= 0) {
+            break;
+        }
+
+        /* FLAC has no RIFF header, its decoder reads the metadata from the first byte on */
+        if ((parser.offset == 0) && flac_probe(stream->head_buf, len, file.size(), &parser.info)) {
+            stream->head_len = len;
+            result = WAV_PARSE_DONE;
+            break;
+        }
+
+        result = wav_parser_feed(&parser, stream->head_buf, len, &used);
+        stream->head_len = len;
+        stream->head_pos = used;
+
+        /* Seek over large chunks such as embedded pictures instead of reading them */
+        uint32_t skip = wav_parser_skip(&parser, sizeof(stream->head_buf));
+        if (skip && !file.seek(skip, SeekMode::SeekCur)) {
+            break;
+        }
+    }
+
+    *info = parser.info;
+    if (result == WAV_PARSE_DONE) {
+        /* Truncated files declare more data than they hold */
+        uint32_t file_left = file.size() > info->data_offset ? file.size() - info->data_offset : 0;
+        if (info->data_size > file_left) {
+            info->data_size = file_left - file_left % info->block_align;
+        }
+    }
+
+    audio_source_t source = { reader_source_read, reader_source_seek, stream };
+    if ((result != WAV_PARSE_DONE) || !audio_decoder_open(&stream->decoder, info, &source)) {
+        file.close();
+
+        Serial.println("File is invalid WAV formwat");
+        return false;
+    }
+
+    /* Backends reading their own metadata may know more than the probe */
+    *info = stream->decoder.info;
+    return true;
+}
+
+/*!
+ * @brief  Open a stream for a request, a failed open still owes an error block
+ */
+static void reader_stream_open(reader_stream_t *stream, const reader_request_t *request) {
+    stream->track_id = request->track_id;
+    stream->gain = request->gain;
+    stream->end_flags = AUDIO_BLOCK_FLAG_END;
+    if (!reader_open_wav(stream, request->path)) {
+        stream->end_flags |= AUDIO_BLOCK_FLAG_ERROR;
+        memset(&stream->info, 0, sizeof(stream->info));
+        memset(&stream->decoder, 0, sizeof(stream->decoder));
+        stream->head_len = 0;
+        stream->head_pos = 0;
+    }
+
+    /* Start inside the track, a start past its end plays it from the beginning */
+    stream->start_frame = 0;
+    if ((request->frame > 0) && (stream->decoder.ops != NULL) && audio_decoder_seek(&stream->decoder, request->frame)) {
+        stream->start_frame = request->frame;
+    }
+
+    resampler_init(&stream->resampler, stream->info.sample_rate, AUDIO_OUTPUT_RATE);
+    stretch_init(&stream->stretch);
+    stretch_set_speed(&stream->stretch, reader_speed.load());
+    stream->cycles = 0;
+    stream->frames = 0;
+    stream->padded = false;
+    stream->flushed = false;
+    stream->active = true;
+}
+
+/*!
+ * @brief  Close a stream, dropping whatever it still owes
+ */
+static void reader_stream_close(reader_stream_t *stream) {
+    audio_decoder_close(&stream->decoder);
+    if (stream->file) {
+        stream->file.close();
+    }
+
+    stream->active = false;
+}
+
+/*!
+ * @brief  Decode frames into the resampler, as 16-bit mono
+ */
+static void reader_feed(reader_stream_t *stream) {
+    uint32_t space;
+    int16_t *in = resampler_input(&stream->resampler, &space);
+    uint32_t frames = audio_decoder_decode(&stream->decoder, in, space);
+
+    if (stream->decoder.error && !(stream->end_flags & AUDIO_BLOCK_FLAG_ERROR)) {
+        Serial.println("File read error");
+        stream->end_flags |= AUDIO_BLOCK_FLAG_ERROR;
+    }
+
+    resampler_commit(&stream->resampler, frames);
+}
+
+/*!
+ * @brief  File bytes a stream reads per second, on average for FLAC
+ */
+static uint32_t reader_byte_rate(const reader_stream_t *stream) {
+    const wav_info_t *info = &stream->info;
+
+    /* FLAC blocks vary in size, the file spread over the track is what it reads */
+    if (info->format == WAV_FORMAT_FLAC) {
+        uint32_t frames = stream->decoder.frames;
+        return frames ? (uint64_t)info->data_size * info->sample_rate / frames : 0;
+    }
+
+    return info->block_frames ? (uint64_t)info->sample_rate * info->block_align / info->block_frames : 0;
+}
+
+/*!
+ * @brief  Output frames left in a stream, at AUDIO_OUTPUT_RATE and the playback speed
+ */
+static uint32_t reader_remaining(const reader_stream_t *stream) {
+    const wav_info_t *info = &stream->info;
+
+    if (info->sample_rate == 0) {
+        return 0;
+    }
+
+    uint64_t frames = audio_decoder_remaining(&stream->decoder) + resampler_buffered(&stream->resampler);
+    return stretch_remaining(&stream->stretch, frames * AUDIO_OUTPUT_RATE / info->sample_rate);
+}
+
+/*!
+ * @brief  Produce frames of a stream, fewer than wanted only at its end
+ */
+static uint32_t reader_produce(reader_stream_t *stream, int16_t *out, uint32_t want) {
+    resampler_t *resampler = &stream->resampler;
+    stretch_t *stretch = &stream->stretch;
+    uint32_t count = 0;
+    uint32_t start = ESP.getCycleCount();
+
+    stretch_set_speed(stretch, reader_speed.load());
+    while (1) {
+        count += stretch_output(stretch, out + count, want - count);
+        if ((count == want) || stream->flushed) {
+            break;
+        }
+
+        /* Resample straight into the stretcher, reading more once the resampler runs dry */
+        uint32_t space;
+        int16_t *in = stretch_input(stretch, &space);
+        uint32_t got = resampler_output(resampler, in, space);
+        stretch_commit(stretch, got);
+        if ((got > 0) || (space == 0)) {
+            continue;
+        }
+
+        if (audio_decoder_remaining(&stream->decoder) > 0) {
+            reader_feed(stream);
+        }
+        else if (!stream->padded) {
+            resampler_flush(resampler);
+            stream->padded = true;
+        }
+        else {
+            stretch_flush(stretch);
+            stream->flushed = true;
+        }
+    }
+
+    /* SD reads are counted too, they overlap with the conversion */
+    stream->cycles += ESP.getCycleCount() - start;
+    stream->frames += count;
+    return count;
+}
+
+/*!
+ * @brief  Stamp a block with the source frame its first frame comes from and
+ *         the speed, before filling it. The stretcher holds input beyond the
+ *         resampler position, its own position counts.
+ */
+static void reader_position(const reader_stream_t *stream, audio_block_t *block) {
+    uint16_t speed;
+    uint32_t frame = stretch_position(&stream->stretch, &speed);
+
+    block->frame = stream->start_frame + (uint64_t)frame * stream->info.sample_rate / AUDIO_OUTPUT_RATE;
+    block->speed = speed;
+}
+
+/*!
+ * @brief  Stamp a block with the format and track of a stream
+ */
+static void reader_stamp(const reader_stream_t *stream, audio_block_t *block, uint32_t count) {
+    block->len = count * sizeof(int16_t);
+    block->track_id = stream->track_id;
+    block->gain = stream->gain;
+    block->sample_rate = AUDIO_OUTPUT_RATE;
+    block->source_rate = stream->info.sample_rate;
+    block->channels = 1;
+    block->bits = 16;
+    block->flags = 0;
+}
+
+/*!
+ * @brief  Mark the last block of a stream and close it
+ */
+static void reader_end(reader_stream_t *stream, audio_block_t *block) {
+    block->flags = stream->end_flags;
+    if (stream->frames > 0) {
+        Serial.printf("Stream %s %u Hz -> %u Hz mono, %u cycles per frame, SD %u KB/s\r\n",
+                      stream->decoder.ops->name, stream->info.sample_rate, AUDIO_OUTPUT_RATE, (uint32_t)(stream->cycles / stream->frames), reader_sd_rate / 1024);
+    }
+    if ((stream->stretch.frames > 0) && (stream->stretch.speed != AUDIO_SPEED_NORMAL)) {
+        Serial.printf("Stretch %u%%, %u cycles per frame\r\n",
+                      stream->stretch.speed, (uint32_t)(stream->stretch.cycles / stream->stretch.frames));
+    }
+    reader_stream_close(stream);
+}
+
+/*!
+ * @brief  Fill one block from a stream, always 16-bit mono at AUDIO_OUTPUT_RATE
+ */
+static void reader_fill(reader_stream_t *stream, audio_block_t *block) {
+    uint32_t want = AUDIO_BLOCK_SIZE / sizeof(int16_t);
+
+    reader_position(stream, block);
+    uint32_t count = reader_produce(stream, (int16_t *)block->data, want);
+    reader_stamp(stream, block, count);
+
+    if (stream->flushed && (count < want)) {
+        reader_end(stream, block);
+    }
+}
+
+/*!
+ * @brief  Fill one block of the current track with the head of the next mixed in.
+ *         The block belongs to the current track, which ends with the fade.
+ */
+static void reader_fill_crossfade(reader_stream_t *current, reader_stream_t *next, audio_block_t *block) {
+    int16_t *out = (int16_t *)block->data;
+    uint32_t want = AUDIO_BLOCK_SIZE / sizeof(int16_t);
+
+    reader_position(current, block);
+    uint32_t count = reader_produce(current, out, want);
+    uint32_t mixed = reader_produce(next, reader_mix, want);
+
+    /* Both tracks share the block gain, the quieter one is scaled down to it */
+    uint16_t gain = (current->gain > next->gain) ? current->gain : next->gain;
+    int32_t current_scale = ((int32_t)current->gain << 15) / gain;
+    int32_t next_scale = ((int32_t)next->gain << 15) / gain;
+
+    uint32_t total = audio_crossfade_mix(&reader_fade, out, count, current_scale, reader_mix, mixed, next_scale);
+
+    reader_stamp(current, block, total);
+    block->gain = gain;
+
+    /* Whatever the current track still holds after the fade is silent */
+    if ((reader_fade.pos >= reader_fade.len) || (current->flushed && (count < want))) {
+        reader_end(current, block);
+        reader_fade.len = 0;
+    }
+}
+
+/*!
+ * @brief  Choose the crossfade into a stream that was just opened
+ * @retval Fade length in output frames, 0 for a gapless transition
+ */
+static uint32_t reader_crossfade_frames(const reader_stream_t *current, const reader_stream_t *next) {
+    uint32_t ms = reader_crossfade_ms.load();
+
+    if ((ms == 0) || !next->active || (next->end_flags & AUDIO_BLOCK_FLAG_ERROR)) {
+        return 0;
+    }
+
+    /* Keep a quarter of the card for the library task, borrow from the ring for the rest */
+    uint32_t need = reader_byte_rate(current) + reader_byte_rate(next);
+    uint32_t usable = reader_sd_rate / 4 * 3;
+    if (usable < need) {
+        uint32_t cover = READER_RING_MS * usable / (need - usable);
+        if (ms > cover) {
+            ms = cover;
+        }
+    }
+    Serial.printf("Crossfade %u ms, SD %u KB/s for %u KB/s\r\n", ms, reader_sd_rate / 1024, need / 1024);
+
+    /* The next track must outlast the fade by far */
+    uint32_t frames = (uint64_t)ms * AUDIO_OUTPUT_RATE / 1000;
+    uint32_t limit = reader_remaining(next) / 2;
+    return (frames < limit) ? frames : limit;
+}
+
+/*!
+ * @brief  Task streaming file data into the ring
+ */
+static void reader_task(void *arg) {
+    reader_stream_t *current = &reader_streams[0];
+    reader_stream_t *next = &reader_streams[1];
+    reader_request_t request;
+    reader_request_t pending;
+    TaskHandle_t consumer = NULL;
+    bool has_pending = false;    /* A next track is queued but not opened yet */
+
+    while (1) {
+        /* Block while idle, only poll for a new request while streaming */
+        if (xQueueReceive(reader_queue, &request, current->active ? 0 : portMAX_DELAY) == pdTRUE) {
+            reader_fade_target = 0;
+            reader_fade.len = 0;
+            if (request.type == REQUEST_NEXT) {
+                reader_stream_close(next);
+                consumer = request.consumer;
+                if (current->active) {
+                    pending = request;
+                    has_pending = true;
+                }
+                else {
+                    /* The current track was fully read already */
+                    reader_stream_open(current, &request);
+                }
+            }
+            else {
+                reader_stream_close(current);
+                reader_stream_close(next);
+                has_pending = false;
+                if (request.type == REQUEST_OPEN) {
+                    consumer = request.consumer;
+                    reader_stream_open(current, &request);
+                }
+            }
+        }
+
+        if (!current->active) {
+            continue;
+        }
+
+        /* Open the next track ahead of time once the current one is in its tail */
+        uint32_t remaining = reader_remaining(current);
+        if (has_pending) {
+            uint32_t tail = (uint64_t)(reader_tail_ms + reader_crossfade_ms.load()) * AUDIO_OUTPUT_RATE / 1000;
+            if (remaining <= tail) {
+                reader_stream_open(next, &pending);
+                reader_fade_target = reader_crossfade_frames(current, next);
+                has_pending = false;
+            }
+        }
+
+        /* Start mixing in the next track so both end together */
+        if ((reader_fade_target > 0) && (reader_fade.len == 0) && (remaining <= reader_fade_target)) {
+            reader_fade.len = (remaining > 0) ? remaining : 1;
+            reader_fade.pos = 0;
+            reader_fade_target = 0;
+        }
+
+        audio_block_t *block = audio_ring_write_acquire(reader_ring);
+        if (block == NULL) {
+            /* Ring is full, wait for the consumer to hand blocks back */
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(20));
+            continue;
+        }
+
+        if (reader_fade.len > 0) {
+            reader_fill_crossfade(current, next, block);
+        }
+        else {
+            reader_fill(current, block);
+        }
+
+        /* Continue with the next track in the very next block */
+        if (!current->active) {
+            if (has_pending) {
+                reader_stream_open(next, &pending);
+                has_pending = false;
+            }
+
+            if (next->active) {
+                reader_stream_t *swap = current;
+                current = next;
+                next = swap;
+            }
+        }
+
+        audio_ring_write_commit(reader_ring);
+        xTaskNotifyGive(consumer);
+    }
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Start the SD reader task producing into a ring
+ */
+void audio_reader_init(audio_ring_t *ring, uint32_t tail_ms) {
+    reader_ring = ring;
+    reader_tail_ms = tail_ms;
+    audio_crossfade_init();
+    reader_queue = xQueueCreate(4, sizeof(reader_request_t));
+
+    /* Create reader task, below the player so submitting blocks is never delayed */
+    xTaskCreatePinnedToCore(reader_task, "READER", 4096, NULL, 2, &reader_task_handle, 0);
+}
+
+/*!
+ * @brief  Send a request to the reader task
+ */
+static void reader_send(uint8_t type, const char *path, uint16_t track_id, uint32_t frame, uint16_t gain) {
+    reader_request_t request;
+
+    strlcpy(request.path, path, sizeof(request.path));
+    request.frame = frame;
+    request.track_id = track_id;
+    request.gain = gain;
+    request.type = type;
+    request.consumer = xTaskGetCurrentTaskHandle();
+    xQueueSend(reader_queue, &request, portMAX_DELAY);
+}
+
+/*!
+ * @brief  Stream a WAV file into the ring, aborting the current one
+ */
+void audio_reader_open(const char *path, uint16_t track_id, uint32_t frame, uint16_t gain) {
+    reader_send(REQUEST_OPEN, path, track_id, frame, gain);
+}
+
+/*!
+ * @brief  Queue a WAV file to stream right after the current one
+ */
+void audio_reader_queue_next(const char *path, uint16_t track_id, uint16_t gain) {
+    reader_send(REQUEST_NEXT, path, track_id, 0, gain);
+}
+
+/*!
+ * @brief  Stop streaming the current file and drop the queued one
+ */
+void audio_reader_stop(void) {
+    reader_send(REQUEST_STOP, "", 0, 0, 0);
+}
+
+/*!
+ * @brief  Set the crossfade between queued tracks
+ */
+void audio_reader_set_crossfade(uint32_t ms) {
+    reader_crossfade_ms.store((ms < AUDIO_CROSSFADE_MAX_MS) ? ms : AUDIO_CROSSFADE_MAX_MS);
+}
+
+/*!
+ * @brief  Set the playback speed
+ */
+void audio_reader_set_speed(uint16_t speed) {
+    reader_speed.store((speed < AUDIO_SPEED_MIN) ? AUDIO_SPEED_MIN : ((speed > AUDIO_SPEED_MAX) ? AUDIO_SPEED_MAX : speed));
+}
+
+/*!
+ * @brief  Wake the reader after blocks were released
+ */
+void audio_reader_wake(void) {
+    if (reader_task_handle != NULL) {
+        xTaskNotifyGive(reader_task_handle);
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ *  audio_reader.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __AUDIO_READER_HPP_
+#define __AUDIO_READER_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "audio_ring.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define AUDIO_PATH_MAX 272        /* Directory, a 255 character name and NUL */
+
+/* Longest crossfade between tracks */
+#ifndef AUDIO_CROSSFADE_MAX_MS
+#define AUDIO_CROSSFADE_MAX_MS 10000
+#endif
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Start the SD reader task producing 16-bit mono blocks at
+ *         AUDIO_OUTPUT_RATE into a ring
+ * @param  Ring and how long before the end of a track the next one is opened
+ * @retval None
+ */
+void audio_reader_init(audio_ring_t *ring, uint32_t tail_ms);
+
+/*!
+ * @brief  Stream a WAV file into the ring, aborting the current one.
+ *         The calling task is notified whenever a block is committed.
+ * @param  File path, id stamped on every block of this track, source frame
+ *         to start from and the Q12 loudness gain stamped on its blocks
+ * @retval None
+ */
+void audio_reader_open(const char *path, uint16_t track_id, uint32_t frame, uint16_t gain);
+
+/*!
+ * @brief  Queue a WAV file to stream right after the current one, it is
+ *         opened and pre-read once the current track is in its tail window.
+ *         With a crossfade set, its head is mixed into the blocks of the
+ *         current track.
+ * @param  File path, id stamped on every block of this track and its gain
+ * @retval None
+ */
+void audio_reader_queue_next(const char *path, uint16_t track_id, uint16_t gain);
+
+/*!
+ * @brief  Set the crossfade between queued tracks, it is shortened to what
+ *         the ring can cover when the card is too slow for two streams
+ * @param  Length in ms, 0 for gapless transitions, at most AUDIO_CROSSFADE_MAX_MS
+ * @retval None
+ */
+void audio_reader_set_crossfade(uint32_t ms);
+
+/*!
+ * @brief  Set the playback speed, the pitch is kept. Blocks already in the
+ *         ring play at the speed they were made with.
+ * @param  Speed in percent, AUDIO_SPEED_MIN to AUDIO_SPEED_MAX
+ * @retval None
+ */
+void audio_reader_set_speed(uint16_t speed);
+
+/*!
+ * @brief  Stop streaming the current file and drop the queued one
+ * @param  None
+ * @retval None
+ */
+void audio_reader_stop(void);
+
+/*!
+ * @brief  Wake the reader after blocks were released
+ * @param  None
+ * @retval None
+ */
+void audio_reader_wake(void);
+
+/******************************************************************************/
+
+#endif /* __AUDIO_READER_HPP_ */
@@ -0,0 +1,137 @@
+/*
+ *  audio_ring.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "audio_ring.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define RING_MASK (AUDIO_RING_BLOCKS - 1)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Reset ring, both sides must be idle
+ */
+void audio_ring_init(audio_ring_t *ring) {
+    ring->head.store(0, std::memory_order_relaxed);
+    ring->tail.store(0, std::memory_order_relaxed);
+    ring->read = 0;
+}
+
+/*!
+ * @brief  Get a free block to fill (producer)
+ */
+audio_block_t *audio_ring_write_acquire(audio_ring_t *ring) {
+    uint32_t head = ring->head.load(std::memory_order_relaxed);
+    uint32_t tail = ring->tail.load(std::memory_order_acquire);
+
+    if (head - tail >= AUDIO_RING_BLOCKS) {
+        return NULL;
+    }
+
+    return &ring->blocks[head & RING_MASK];
+}
+
+/*!
+ * @brief  Publish the block returned by audio_ring_write_acquire (producer)
+ */
+void audio_ring_write_commit(audio_ring_t *ring) {
+    uint32_t head = ring->head.load(std::memory_order_relaxed);
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+/*!
+ * @brief  Take ownership of the next filled block (consumer)
+ */
+audio_block_t *audio_ring_read_acquire(audio_ring_t *ring) {
+    uint32_t head = ring->head.load(std::memory_order_acquire);
+
+    if (ring->read == head) {
+        return NULL;
+    }
+
+    audio_block_t *block = &ring->blocks[ring->read & RING_MASK];
+    block->submitted = false;
+    ring->read++;
+    return block;
+}
+
+/*!
+ * @brief  Get the oldest block still owned by the consumer
+ */
+audio_block_t *audio_ring_oldest(audio_ring_t *ring) {
+    uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+
+    if (tail == ring->read) {
+        return NULL;
+    }
+
+    return &ring->blocks[tail & RING_MASK];
+}
+
+/*!
+ * @brief  Get an acquired block by age (consumer)
+ */
+audio_block_t *audio_ring_acquired(audio_ring_t *ring, uint32_t index) {
+    uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+
+    if (index >= ring->read - tail) {
+        return NULL;
+    }
+
+    return &ring->blocks[(tail + index) & RING_MASK];
+}
+
+/*!
+ * @brief  Hand the oldest acquired block back to the producer (consumer)
+ */
+void audio_ring_release(audio_ring_t *ring) {
+    uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+
+    if (tail != ring->read) {
+        ring->tail.store(tail + 1, std::memory_order_release);
+    }
+}
+
+/*!
+ * @brief  Number of blocks acquired but not released yet (consumer)
+ */
+uint32_t audio_ring_in_flight(audio_ring_t *ring) {
+    return ring->read - ring->tail.load(std::memory_order_relaxed);
+}
+
+/*!
+ * @brief  Number of filled blocks not acquired yet (consumer)
+ */
+uint32_t audio_ring_available(audio_ring_t *ring) {
+    return ring->head.load(std::memory_order_acquire) - ring->read;
+}
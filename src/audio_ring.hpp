@@ -0,0 +1,166 @@
+/*
+ *  audio_ring.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __AUDIO_RING_HPP_
+#define __AUDIO_RING_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <atomic>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Size of one PCM block in bytes */
+#ifndef AUDIO_BLOCK_SIZE
+#define AUDIO_BLOCK_SIZE 1024
+#endif
+
+/* Number of blocks in the ring, must be a power of two */
+#ifndef AUDIO_RING_BLOCKS
+#define AUDIO_RING_BLOCKS 8
+#endif
+
+/* Alignment of blocks and indexes, keeps producer and consumer on separate lines */
+#define AUDIO_RING_ALIGN 32
+
+static_assert((AUDIO_RING_BLOCKS & (AUDIO_RING_BLOCKS - 1)) == 0, "AUDIO_RING_BLOCKS must be a power of two");
+
+/* Block flags */
+#define AUDIO_BLOCK_FLAG_END   0x01    /* Last block of a track */
+#define AUDIO_BLOCK_FLAG_ERROR 0x02    /* Track could not be read */
+
+/* One block of PCM data with the format it must be played with */
+typedef struct {
+    alignas(AUDIO_RING_ALIGN) uint8_t data[AUDIO_BLOCK_SIZE];
+    uint32_t sample_rate;
+    uint32_t source_rate;        /* Frame rate of the file */
+    uint32_t frame;              /* Source frame of the first frame */
+    uint32_t start_us;           /* Consumer only: when the speaker starts reading it */
+    uint16_t len;                /* Valid bytes in data */
+    uint16_t track_id;           /* Track this block belongs to */
+    uint16_t gain;               /* Q12 loudness gain applied on playback */
+    uint16_t speed;              /* Source frames per output frame in percent, 0 is 100 */
+    uint8_t channels;
+    uint8_t bits;
+    uint8_t flags;
+    bool submitted;              /* Consumer only: block was given to the speaker */
+} audio_block_t;
+
+/*!
+ * @brief  Source frame of a frame of a block, the file may have another rate
+ *         and play at another speed
+ */
+static inline uint32_t audio_block_frame(const audio_block_t *block, uint32_t frame) {
+    uint64_t frames = block->speed ? (uint64_t)frame * block->speed / 100 : frame;
+    if (block->source_rate) {
+        frames = frames * block->source_rate / block->sample_rate;
+    }
+    return block->frame + frames;
+}
+
+/*
+ * Single producer / single consumer ring of blocks.
+ * Blocks in [tail, head) belong to the consumer, all others to the producer.
+ * The consumer acquires blocks at read and hands them back in order at tail.
+ */
+typedef struct {
+    audio_block_t blocks[AUDIO_RING_BLOCKS];
+    alignas(AUDIO_RING_ALIGN) std::atomic<uint32_t> head;    /* Written by producer */
+    alignas(AUDIO_RING_ALIGN) std::atomic<uint32_t> tail;    /* Written by consumer */
+    uint32_t read;                                           /* Consumer only */
+} audio_ring_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Reset ring, both sides must be idle
+ * @param  Ring
+ * @retval None
+ */
+void audio_ring_init(audio_ring_t *ring);
+
+/*!
+ * @brief  Get a free block to fill (producer)
+ * @param  Ring
+ * @retval Block or NULL if ring is full
+ */
+audio_block_t *audio_ring_write_acquire(audio_ring_t *ring);
+
+/*!
+ * @brief  Publish the block returned by audio_ring_write_acquire (producer)
+ * @param  Ring
+ * @retval None
+ */
+void audio_ring_write_commit(audio_ring_t *ring);
+
+/*!
+ * @brief  Take ownership of the next filled block (consumer)
+ * @param  Ring
+ * @retval Block or NULL if ring is empty
+ */
+audio_block_t *audio_ring_read_acquire(audio_ring_t *ring);
+
+/*!
+ * @brief  Get the oldest block still owned by the consumer
+ * @param  Ring
+ * @retval Block or NULL if nothing is acquired
+ */
+audio_block_t *audio_ring_oldest(audio_ring_t *ring);
+
+/*!
+ * @brief  Get an acquired block by age (consumer)
+ * @param  Ring and index, 0 is the oldest
+ * @retval Block or NULL if fewer blocks are acquired
+ */
+audio_block_t *audio_ring_acquired(audio_ring_t *ring, uint32_t index);
+
+/*!
+ * @brief  Hand the oldest acquired block back to the producer (consumer)
+ * @param  Ring
+ * @retval None
+ */
+void audio_ring_release(audio_ring_t *ring);
+
+/*!
+ * @brief  Number of blocks acquired but not released yet (consumer)
+ * @param  Ring
+ * @retval Block count
+ */
+uint32_t audio_ring_in_flight(audio_ring_t *ring);
+
+/*!
+ * @brief  Number of filled blocks not acquired yet (consumer)
+ * @param  Ring
+ * @retval Block count
+ */
+uint32_t audio_ring_available(audio_ring_t *ring);
+
+/******************************************************************************/
+
+#endif /* __AUDIO_RING_HPP_ */
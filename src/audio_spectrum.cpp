@@ -0,0 +1,236 @@
+/*
+ *  audio_spectrum.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <math.h>
+#include <atomic>
+#include "audio_spectrum.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define SPECTRUM_POINTS (SPECTRUM_FFT_SIZE / 2)    /* Complex points, a power of 4 */
+#define SPECTRUM_INPUT_SHIFT 8                     /* Headroom bits kept below the samples */
+
+static_assert((SPECTRUM_FFT_SIZE & (SPECTRUM_FFT_SIZE - 1)) == 0, "SPECTRUM_FFT_SIZE must be a power of two");
+static_assert((SPECTRUM_POINTS & 0x55555555) == SPECTRUM_POINTS, "SPECTRUM_FFT_SIZE / 2 must be a power of four");
+
+typedef struct {
+    int32_t re;
+    int32_t im;
+} spectrum_complex_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/* Tap, written by the play task */
+static std::atomic<bool> spectrum_enabled(false);
+static std::atomic<uint32_t> spectrum_written(0);
+static int16_t spectrum_ring[SPECTRUM_FFT_SIZE];
+
+/* Analysis, owned by the task calling audio_spectrum_compute */
+static bool spectrum_ready = false;
+static uint32_t spectrum_seen = 0;
+static int16_t spectrum_window[SPECTRUM_FFT_SIZE];      /* Q15 Hann */
+static int16_t spectrum_cos[SPECTRUM_FFT_SIZE];         /* Q15 cos(2 pi k / SPECTRUM_FFT_SIZE) */
+static uint16_t spectrum_edges[SPECTRUM_BARS + 1];      /* First bin of each band */
+static spectrum_complex_t spectrum_data[SPECTRUM_POINTS];
+static uint32_t spectrum_fft_us = 0;
+static uint32_t spectrum_bins_us = 0;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static inline int32_t spectrum_sin(uint32_t k) {
+    return spectrum_cos[(k - SPECTRUM_FFT_SIZE / 4) & (SPECTRUM_FFT_SIZE - 1)];
+}
+
+/*!
+ * @brief  Build the window, twiddles and band edges once
+ */
+static void spectrum_init(void) {
+    for (int i = 0; i < SPECTRUM_FFT_SIZE; i++) {
+        spectrum_window[i] = lroundf((0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / SPECTRUM_FFT_SIZE)) * 32767.0f);
+        spectrum_cos[i] = lroundf(cosf(2.0f * (float)M_PI * i / SPECTRUM_FFT_SIZE) * 32767.0f);
+    }
+
+    /* Log spaced from the first bin up to Nyquist, every band at least one bin wide */
+    for (int i = 0; i <= SPECTRUM_BARS; i++) {
+        uint32_t edge = lroundf(powf(SPECTRUM_POINTS, (float)i / SPECTRUM_BARS));
+        if ((i > 0) && (edge <= spectrum_edges[i - 1])) {
+            edge = spectrum_edges[i - 1] + 1;
+        }
+        spectrum_edges[i] = edge;
+    }
+    spectrum_edges[SPECTRUM_BARS] = SPECTRUM_POINTS;
+    spectrum_ready = true;
+}
+
+/*!
+ * @brief  Multiply by the twiddle W^k = exp(-2 pi i k / SPECTRUM_FFT_SIZE)
+ */
+static inline void spectrum_rotate(spectrum_complex_t *x, int32_t re, int32_t im, uint32_t k) {
+    int32_t c = spectrum_cos[k & (SPECTRUM_FFT_SIZE - 1)];
+    int32_t s = spectrum_sin(k);
+
+    x->re = ((int64_t)re * c + (int64_t)im * s) >> 15;
+    x->im = ((int64_t)im * c - (int64_t)re * s) >> 15;
+}
+
+/*!
+ * @brief  In place radix-4 decimation in frequency FFT of SPECTRUM_POINTS,
+ *         scaled by 1/4 per stage so nothing overflows
+ */
+static void spectrum_fft(spectrum_complex_t *x) {
+    for (uint32_t size = SPECTRUM_POINTS; size >= 4; size >>= 2) {
+        uint32_t quarter = size >> 2;
+        uint32_t step = SPECTRUM_FFT_SIZE / size;
+
+        for (uint32_t base = 0; base < SPECTRUM_POINTS; base += size) {
+            for (uint32_t j = 0; j < quarter; j++) {
+                spectrum_complex_t *p0 = &x[base + j];
+                spectrum_complex_t *p1 = p0 + quarter;
+                spectrum_complex_t *p2 = p1 + quarter;
+                spectrum_complex_t *p3 = p2 + quarter;
+
+                int32_t t0r = (p0->re + p2->re) >> 2, t0i = (p0->im + p2->im) >> 2;
+                int32_t t1r = (p0->re - p2->re) >> 2, t1i = (p0->im - p2->im) >> 2;
+                int32_t t2r = (p1->re + p3->re) >> 2, t2i = (p1->im + p3->im) >> 2;
+                int32_t t3r = (p1->re - p3->re) >> 2, t3i = (p1->im - p3->im) >> 2;
+
+                p0->re = t0r + t2r;
+                p0->im = t0i + t2i;
+                spectrum_rotate(p1, t1r + t3i, t1i - t3r, j * step);
+                spectrum_rotate(p2, t0r - t2r, t0i - t2i, 2 * j * step);
+                spectrum_rotate(p3, t1r - t3i, t1i + t3r, 3 * j * step);
+            }
+        }
+    }
+
+    /* Outputs are in base 4 digit reversed order */
+    for (uint32_t i = 0; i < SPECTRUM_POINTS; i++) {
+        uint32_t r = 0;
+        for (uint32_t n = i, bits = 1; bits < SPECTRUM_POINTS; bits <<= 2, n >>= 2) {
+            r = (r << 2) | (n & 3);
+        }
+        if (r > i) {
+            spectrum_complex_t t = x[i];
+            x[i] = x[r];
+            x[r] = t;
+        }
+    }
+}
+
+/*!
+ * @brief  Power of bin k of the real FFT from the half size complex FFT
+ */
+static inline uint64_t spectrum_power(const spectrum_complex_t *z, uint32_t k) {
+    const spectrum_complex_t *a = &z[k];
+    const spectrum_complex_t *b = &z[(SPECTRUM_POINTS - k) & (SPECTRUM_POINTS - 1)];
+
+    /* Even part (A + B*) / 2, odd part (A - B*) / 2i rotated by W^k */
+    int32_t even_re = (a->re + b->re) >> 1, even_im = (a->im - b->im) >> 1;
+    int32_t diff_re = (a->re - b->re) >> 1, diff_im = (a->im + b->im) >> 1;
+    spectrum_complex_t odd;
+    spectrum_rotate(&odd, diff_im, -diff_re, k);
+
+    int64_t re = even_re + odd.re;
+    int64_t im = even_im + odd.im;
+    return re * re + im * im;
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Start or stop taking samples
+ */
+void audio_spectrum_enable(bool enable) {
+    spectrum_enabled.store(enable);
+}
+
+/*!
+ * @brief  Decimate played samples into the analysis window
+ */
+void audio_spectrum_push(const int16_t *samples, uint32_t count) {
+    if (!spectrum_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    uint32_t written = spectrum_written.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i + 1 < count; i += SPECTRUM_DECIMATE) {
+        spectrum_ring[written++ & (SPECTRUM_FFT_SIZE - 1)] = (samples[i] + samples[i + 1]) >> 1;
+    }
+    spectrum_written.store(written, std::memory_order_release);
+}
+
+/*!
+ * @brief  Compute the band levels of the latest window
+ */
+bool audio_spectrum_compute(uint8_t *levels) {
+    uint32_t written = spectrum_written.load(std::memory_order_acquire);
+
+    if (written == spectrum_seen) {
+        return false;
+    }
+    spectrum_seen = written;
+
+    if (!spectrum_ready) {
+        spectrum_init();
+    }
+
+    /* Oldest sample first, even samples go to the real part and odd ones to the imaginary part */
+    uint32_t start = micros();
+    for (uint32_t i = 0; i < SPECTRUM_POINTS; i++) {
+        int32_t even = spectrum_ring[(written + 2 * i) & (SPECTRUM_FFT_SIZE - 1)];
+        int32_t odd = spectrum_ring[(written + 2 * i + 1) & (SPECTRUM_FFT_SIZE - 1)];
+        spectrum_data[i].re = (even * spectrum_window[2 * i]) >> (15 - SPECTRUM_INPUT_SHIFT);
+        spectrum_data[i].im = (odd * spectrum_window[2 * i + 1]) >> (15 - SPECTRUM_INPUT_SHIFT);
+    }
+    spectrum_fft(spectrum_data);
+
+    uint32_t binned = micros();
+    for (int bar = 0; bar < SPECTRUM_BARS; bar++) {
+        uint64_t power = 0;
+        for (uint32_t k = spectrum_edges[bar]; k < spectrum_edges[bar + 1]; k++) {
+            power += spectrum_power(spectrum_data, k);
+        }
+
+        float db = (power > 0) ? 10.0f * log10f((float)power) : 0.0f;
+        float level = (db - (SPECTRUM_DB_TOP - SPECTRUM_DB_RANGE)) * SPECTRUM_LEVEL_MAX / SPECTRUM_DB_RANGE;
+        levels[bar] = (level <= 0.0f) ? 0 : ((level >= SPECTRUM_LEVEL_MAX) ? SPECTRUM_LEVEL_MAX : (uint8_t)level);
+    }
+
+    spectrum_bins_us = micros() - binned;
+    spectrum_fft_us = binned - start;
+    return true;
+}
+
+/*!
+ * @brief  Cost of the last audio_spectrum_compute
+ */
+void audio_spectrum_cost(uint32_t *fft_us, uint32_t *bins_us) {
+    *fft_us = spectrum_fft_us;
+    *bins_us = spectrum_bins_us;
+}
@@ -0,0 +1,89 @@
+/*
+ *  audio_spectrum.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __AUDIO_SPECTRUM_HPP_
+#define __AUDIO_SPECTRUM_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define SPECTRUM_FFT_SIZE 512        /* Real points, computed as a 256 point complex radix-4 FFT */
+#define SPECTRUM_DECIMATE 2          /* Output rate divider of the tap */
+#define SPECTRUM_BARS 16             /* Log spaced bands */
+#define SPECTRUM_LEVEL_MAX 255
+
+/* Band levels shown, dB of the FFT power */
+#ifndef SPECTRUM_DB_TOP
+#define SPECTRUM_DB_TOP 128
+#endif
+#ifndef SPECTRUM_DB_RANGE
+#define SPECTRUM_DB_RANGE 60
+#endif
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*
+ * The play task feeds the tap, another task computes the bands from the latest
+ * samples. A frame may mix samples of two blocks, which only shows as a frame
+ * of the visualization.
+ */
+
+/*!
+ * @brief  Start or stop taking samples, the tap costs nothing while stopped
+ * @param  Enable
+ * @retval None
+ */
+void audio_spectrum_enable(bool enable);
+
+/*!
+ * @brief  Decimate played samples into the analysis window
+ * @param  16-bit mono samples at AUDIO_OUTPUT_RATE and their count
+ * @retval None
+ */
+void audio_spectrum_push(const int16_t *samples, uint32_t count);
+
+/*!
+ * @brief  Compute the band levels of the latest window
+ * @param  SPECTRUM_BARS levels, 0 to SPECTRUM_LEVEL_MAX
+ * @retval False if no samples arrived since the last call
+ */
+bool audio_spectrum_compute(uint8_t *levels);
+
+/*!
+ * @brief  Cost of the last audio_spectrum_compute
+ * @param  FFT and band binning time in us
+ * @retval None
+ */
+void audio_spectrum_cost(uint32_t *fft_us, uint32_t *bins_us);
+
+/******************************************************************************/
+
+#endif /* __AUDIO_SPECTRUM_HPP_ */
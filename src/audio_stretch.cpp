@@ -0,0 +1,331 @@
+/*
+ *  audio_stretch.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <math.h>
+#include "audio_stretch.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define STRETCH_COARSE 4             /* Lag and sample step of the first search pass */
+#define STRETCH_FINE 2               /* Sample step of the pass refining around the best lag */
+#define STRETCH_SIMILARITY_SHIFT 4   /* Keeps the correlation sums in 32 bits */
+
+static_assert(STRETCH_HOP / STRETCH_FINE * ((INT16_MAX >> STRETCH_SIMILARITY_SHIFT) + 1) *
+              ((INT16_MAX >> STRETCH_SIMILARITY_SHIFT) + 1) <= INT32_MAX, "Correlation sums overflow");
+
+/* Similarity of a candidate segment, compared without floating point */
+typedef struct {
+    int32_t corr;                /* Correlation with the reference */
+    uint32_t energy;             /* Energy of the candidate, plus one */
+} stretch_score_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static int16_t stretch_rise[STRETCH_HOP];    /* Q15 raised cosine, the fall is its complement */
+static bool stretch_ready = false;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Correlation of a candidate segment with the reference and the candidate energy
+ */
+static stretch_score_t stretch_similarity(const int16_t *ref, const int16_t *cand, uint32_t step) {
+    stretch_score_t score = { 0, 1 };    /* Energy is kept non zero */
+
+    for (uint32_t i = 0; i < STRETCH_HOP; i += step) {
+        int32_t a = ref[i] >> STRETCH_SIMILARITY_SHIFT;
+        int32_t b = cand[i] >> STRETCH_SIMILARITY_SHIFT;
+        score.corr += a * b;
+        score.energy += b * b;
+    }
+
+    return score;
+}
+
+/*!
+ * @brief  Compare a * b with c * d, products of up to 96 bits, -1, 0 or 1
+ */
+static int stretch_compare(uint64_t a, uint32_t b, uint64_t c, uint32_t d) {
+    uint64_t ab_lo = (a & 0xFFFFFFFF) * b;
+    uint64_t ab_hi = (a >> 32) * b + (ab_lo >> 32);
+    uint64_t cd_lo = (c & 0xFFFFFFFF) * d;
+    uint64_t cd_hi = (c >> 32) * d + (cd_lo >> 32);
+
+    if (ab_hi != cd_hi) {
+        return (ab_hi < cd_hi) ? -1 : 1;
+    }
+    ab_lo &= 0xFFFFFFFF;
+    cd_lo &= 0xFFFFFFFF;
+    return (ab_lo < cd_lo) ? -1 : (ab_lo > cd_lo);
+}
+
+/*!
+ * @brief  Check if a candidate is more similar than the best one, by their
+ *         normalized correlation corr / sqrt(energy) compared squared with
+ *         its sign kept
+ */
+static bool stretch_better(stretch_score_t score, stretch_score_t best) {
+    if ((score.corr >= 0) != (best.corr >= 0)) {
+        return score.corr >= 0;
+    }
+
+    int cmp = stretch_compare((uint64_t)((int64_t)score.corr * score.corr), best.energy,
+                              (uint64_t)((int64_t)best.corr * best.corr), score.energy);
+    return (score.corr >= 0) ? (cmp > 0) : (cmp < 0);
+}
+
+/*!
+ * @brief  Find the segment near the nominal position that best continues the last one
+ */
+static uint32_t stretch_search(const stretch_t *st, uint32_t nominal) {
+    const int16_t *ref = st->buf + st->next;
+    uint32_t lo = (nominal > STRETCH_SEEK) ? nominal - STRETCH_SEEK : 0;
+    uint32_t hi = nominal + STRETCH_SEEK;
+    uint32_t best = lo;
+    stretch_score_t best_score = stretch_similarity(ref, st->buf + lo, STRETCH_COARSE);
+
+    /* Every few lags on every few samples, then every lag around the best one */
+    for (uint32_t cand = lo + STRETCH_COARSE; cand <= hi; cand += STRETCH_COARSE) {
+        stretch_score_t score = stretch_similarity(ref, st->buf + cand, STRETCH_COARSE);
+        if (stretch_better(score, best_score)) {
+            best_score = score;
+            best = cand;
+        }
+    }
+
+    uint32_t first = (best > lo + STRETCH_COARSE - 1) ? best - (STRETCH_COARSE - 1) : lo;
+    uint32_t last = (best + STRETCH_COARSE - 1 < hi) ? best + (STRETCH_COARSE - 1) : hi;
+    best = first;
+    best_score = stretch_similarity(ref, st->buf + first, STRETCH_FINE);
+    for (uint32_t cand = first + 1; cand <= last; cand++) {
+        stretch_score_t score = stretch_similarity(ref, st->buf + cand, STRETCH_FINE);
+        if (stretch_better(score, best_score)) {
+            best_score = score;
+            best = cand;
+        }
+    }
+
+    return best;
+}
+
+/*!
+ * @brief  Output one segment, false if the input does not reach far enough yet
+ */
+static bool stretch_segment(stretch_t *st) {
+    uint32_t nominal = st->nominal >> 8;
+    bool copy = (st->speed == AUDIO_SPEED_NORMAL);
+    uint32_t need = st->next + STRETCH_HOP;
+
+    if (!copy && (need < nominal + STRETCH_SEEK + STRETCH_HOP)) {
+        need = nominal + STRETCH_SEEK + STRETCH_HOP;
+    }
+    if (st->len < need) {
+        return false;
+    }
+
+    uint32_t start = ESP.getCycleCount();
+    uint32_t cand = st->next;
+    if (copy) {
+        memcpy(st->out, st->buf + cand, STRETCH_HOP * sizeof(int16_t));
+    }
+    else {
+        cand = stretch_search(st, nominal);
+
+        /* Cross from the continuation of the last segment into the new one */
+        const int16_t *fall = st->buf + st->next;
+        const int16_t *rise = st->buf + cand;
+        for (uint32_t i = 0; i < STRETCH_HOP; i++) {
+            int32_t weight = stretch_rise[i];
+            st->out[i] = (fall[i] * (32768 - weight) + rise[i] * weight) >> 15;
+        }
+    }
+    st->out_pos = 0;
+    st->out_len = STRETCH_HOP;
+
+    /* The crossfade starts on the continuation and ends where the new segment
+     * does, the input it crossed in percent of the output is its real speed */
+    int32_t crossed = (int32_t)(cand + STRETCH_HOP) - (int32_t)st->next;
+    st->out_start = st->dropped + st->next;
+    st->out_speed = (crossed > 0) ? crossed * 100 / STRETCH_HOP : 0;
+
+    /* Nominal positions advance by the speed, at normal speed they follow the copy */
+    st->next = cand + STRETCH_HOP;
+    st->nominal = copy ? (st->next << 8) : st->nominal + STRETCH_HOP * 256 * st->speed / 100;
+
+    /* Drop what neither the continuation nor the next search reaches back to */
+    nominal = st->nominal >> 8;
+    uint32_t drop = (nominal > STRETCH_SEEK) ? nominal - STRETCH_SEEK : 0;
+    if (drop > st->next) {
+        drop = st->next;
+    }
+    if (drop > st->len) {
+        drop = st->len;
+    }
+    if (drop > 0) {
+        memmove(st->buf, st->buf + drop, (st->len - drop) * sizeof(int16_t));
+        st->dropped += drop;
+        st->len -= drop;
+        st->next -= drop;
+        st->nominal -= drop << 8;
+    }
+
+    st->cycles += ESP.getCycleCount() - start;
+    st->frames += STRETCH_HOP;
+    return true;
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Prepare a time stretcher
+ */
+void stretch_init(stretch_t *st) {
+    if (!stretch_ready) {
+        for (int i = 0; i < STRETCH_HOP; i++) {
+            float s = sinf((float)M_PI / 2 * (i + 0.5f) / STRETCH_HOP);
+            stretch_rise[i] = lroundf(s * s * 32767.0f);
+        }
+        stretch_ready = true;
+    }
+
+    st->len = 0;
+    st->next = 0;
+    st->nominal = 0;
+    st->out_len = 0;
+    st->out_pos = 0;
+    st->out_start = 0;
+    st->out_speed = AUDIO_SPEED_NORMAL;
+    st->dropped = 0;
+    st->speed = AUDIO_SPEED_NORMAL;
+    st->flushed = false;
+    st->cycles = 0;
+    st->frames = 0;
+}
+
+/*!
+ * @brief  Change the speed, from the next segment on
+ */
+void stretch_set_speed(stretch_t *st, uint16_t speed) {
+    if (speed < AUDIO_SPEED_MIN) {
+        speed = AUDIO_SPEED_MIN;
+    }
+    if (speed > AUDIO_SPEED_MAX) {
+        speed = AUDIO_SPEED_MAX;
+    }
+
+    /* Searches start where the copy stands */
+    if (st->speed == AUDIO_SPEED_NORMAL) {
+        st->nominal = st->next << 8;
+    }
+    st->speed = speed;
+}
+
+/*!
+ * @brief  Get where to write input frames
+ */
+int16_t *stretch_input(stretch_t *st, uint32_t *space) {
+    *space = STRETCH_BUFFER - st->len;
+    return st->buf + st->len;
+}
+
+/*!
+ * @brief  Add frames written to the input buffer
+ */
+void stretch_commit(stretch_t *st, uint32_t frames) {
+    st->len += frames;
+}
+
+/*!
+ * @brief  Mark the end of the input
+ */
+void stretch_flush(stretch_t *st) {
+    st->flushed = true;
+}
+
+/*!
+ * @brief  Produce output frames, one segment of fixed cost at a time
+ */
+uint32_t stretch_output(stretch_t *st, int16_t *out, uint32_t max) {
+    uint32_t count = 0;
+
+    while (count < max) {
+        if (st->out_len > 0) {
+            uint32_t n = (st->out_len < max - count) ? st->out_len : max - count;
+            memcpy(out + count, st->out + st->out_pos, n * sizeof(int16_t));
+            st->out_pos += n;
+            st->out_len -= n;
+            count += n;
+        }
+        else if (stretch_segment(st)) {
+            continue;
+        }
+        else if (st->flushed && (st->next < st->len)) {
+            /* The last partial segment continues at normal speed */
+            uint32_t n = st->len - st->next;
+            if (n > STRETCH_HOP) {
+                n = STRETCH_HOP;
+            }
+            memcpy(st->out, st->buf + st->next, n * sizeof(int16_t));
+            st->out_start = st->dropped + st->next;
+            st->out_speed = AUDIO_SPEED_NORMAL;
+            st->next += n;
+            st->out_pos = 0;
+            st->out_len = n;
+        }
+        else {
+            break;
+        }
+    }
+
+    return count;
+}
+
+/*!
+ * @brief  Input frame the next output frame is taken from
+ */
+uint32_t stretch_position(const stretch_t *st, uint16_t *speed) {
+    if (st->out_len > 0) {
+        *speed = st->out_speed;
+        return st->out_start + st->out_pos * st->out_speed / 100;
+    }
+
+    /* The next segment starts on the continuation of the last one */
+    *speed = st->speed;
+    return st->dropped + st->next;
+}
+
+/*!
+ * @brief  Output frames still to come from the buffered input and more input
+ */
+uint32_t stretch_remaining(const stretch_t *st, uint32_t input) {
+    uint32_t nominal = st->nominal >> 8;
+    uint32_t buffered = (st->len > nominal) ? st->len - nominal : 0;
+
+    return (uint64_t)(input + buffered) * 100 / st->speed + st->out_len;
+}
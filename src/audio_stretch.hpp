@@ -0,0 +1,135 @@
+/*
+ *  audio_stretch.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __AUDIO_STRETCH_HPP_
+#define __AUDIO_STRETCH_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Playback speed in percent */
+#define AUDIO_SPEED_MIN 50
+#define AUDIO_SPEED_NORMAL 100
+#define AUDIO_SPEED_MAX 200
+
+#define STRETCH_HOP 512              /* Output frames per segment, also the overlap */
+#define STRETCH_SEEK 256             /* Furthest a segment is moved from its nominal position */
+
+/* Input held, at least both search margins, the fastest step and one segment */
+#define STRETCH_BUFFER 2304
+
+static_assert(STRETCH_BUFFER > 2 * STRETCH_SEEK + STRETCH_HOP * AUDIO_SPEED_MAX / 100 + STRETCH_HOP, "STRETCH_BUFFER is too small for the fastest speed");
+
+/*
+ * WSOLA time stretcher for 16-bit mono. Each output hop crosses from the
+ * natural continuation of the last segment into the input segment around the
+ * nominal position that resembles it best, so the pitch is kept. Input is
+ * written straight into its buffer, positions are buffer frames.
+ */
+typedef struct {
+    int16_t buf[STRETCH_BUFFER];
+    int16_t out[STRETCH_HOP];
+    uint32_t len;                /* Frames in buf */
+    uint32_t next;               /* Continuation of the last segment */
+    uint32_t nominal;            /* Q8 position the next segment is searched around */
+    uint32_t out_len;            /* Frames of out not taken yet, from out_pos */
+    uint32_t out_pos;
+    uint32_t out_start;          /* Input frame out starts from, counted since stretch_init */
+    uint16_t out_speed;          /* Input crossed by out in percent of its length */
+    uint32_t dropped;            /* Input frames dropped from buf */
+    uint16_t speed;              /* Percent */
+    bool flushed;                /* No more input, the rest is output as is */
+    uint64_t cycles;             /* Cost of the segments, for the log */
+    uint32_t frames;             /* Frames output by segments */
+} stretch_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Prepare a time stretcher, at normal speed samples are copied
+ * @param  Stretcher
+ * @retval None
+ */
+void stretch_init(stretch_t *st);
+
+/*!
+ * @brief  Change the speed, from the next segment on
+ * @param  Stretcher and speed in percent, clamped to AUDIO_SPEED_MIN..AUDIO_SPEED_MAX
+ * @retval None
+ */
+void stretch_set_speed(stretch_t *st, uint16_t speed);
+
+/*!
+ * @brief  Get where to write input frames
+ * @param  Stretcher and the number of frames that fit
+ * @retval Input buffer
+ */
+int16_t *stretch_input(stretch_t *st, uint32_t *space);
+
+/*!
+ * @brief  Add frames written to the input buffer
+ * @param  Stretcher and frame count
+ * @retval None
+ */
+void stretch_commit(stretch_t *st, uint32_t frames);
+
+/*!
+ * @brief  Mark the end of the input, what cannot fill a segment is output as is
+ * @param  Stretcher
+ * @retval None
+ */
+void stretch_flush(stretch_t *st);
+
+/*!
+ * @brief  Produce output frames, one segment of fixed cost at a time
+ * @param  Stretcher, output and the most frames wanted
+ * @retval Frames produced, fewer than wanted once more input is needed
+ */
+uint32_t stretch_output(stretch_t *st, int16_t *out, uint32_t max);
+
+/*!
+ * @brief  Input frame the next output frame is taken from, each output frame
+ *         after it moves on by the speed
+ * @param  Stretcher and where to store the speed in percent
+ * @retval Input frames since stretch_init
+ */
+uint32_t stretch_position(const stretch_t *st, uint16_t *speed);
+
+/*!
+ * @brief  Output frames still to come from the buffered input and more input
+ * @param  Stretcher and input frames not written yet
+ * @retval Frame count
+ */
+uint32_t stretch_remaining(const stretch_t *st, uint32_t input);
+
+/******************************************************************************/
+
+#endif /* __AUDIO_STRETCH_HPP_ */
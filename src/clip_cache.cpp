@@ -0,0 +1,205 @@
+/*
+ *  clip_cache.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <SD.h>
+#include "audio_reader.hpp"
+#include "wav_parser.hpp"
+#include "clip_cache.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+typedef struct {
+    audio_clip_t clip;           /* data is NULL if the entry is free */
+    uint32_t used;               /* Access stamp for LRU */
+    char path[AUDIO_PATH_MAX];
+} clip_entry_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static clip_entry_t clip_entries[CLIP_CACHE_ENTRIES];
+static uint32_t clip_stamp = 0;
+static size_t clip_resident = 0;
+
+/* Statistic counters */
+static uint32_t clip_hits = 0;
+static uint32_t clip_misses = 0;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static size_t clip_bytes(const audio_clip_t *clip) {
+    return clip->frames * clip->channels * (clip->bits >> 3);
+}
+
+/*!
+ * @brief  Drop a clip and give its memory back
+ */
+static void clip_drop(clip_entry_t *entry) {
+    clip_resident -= clip_bytes(&entry->clip);
+    free((void *)entry->clip.data);
+    entry->clip.data = NULL;
+}
+
+/*!
+ * @brief  Drop least recently used clips until size more bytes fit
+ * @retval Free entry or NULL if the clips in the way are playing
+ */
+static clip_entry_t *clip_make_room(size_t size) {
+    while (1) {
+        clip_entry_t *free_entry = NULL;
+        clip_entry_t *oldest = NULL;
+
+        for (int i = 0; i < CLIP_CACHE_ENTRIES; i++) {
+            clip_entry_t *entry = &clip_entries[i];
+            if (entry->clip.data == NULL) {
+                free_entry = entry;
+            }
+            else if (!audio_mixer_playing(&entry->clip) &&
+                     ((oldest == NULL) || ((int32_t)(entry->used - oldest->used) < 0))) {
+                oldest = entry;
+            }
+        }
+
+        if ((free_entry != NULL) && (clip_resident + size <= CLIP_CACHE_BYTES)) {
+            return free_entry;
+        }
+
+        if (oldest == NULL) {
+            return NULL;
+        }
+
+        clip_drop(oldest);
+    }
+}
+
+/*!
+ * @brief  Read the header and samples of a WAV file into a free entry
+ * @retval Entry or NULL if the file can't be cached
+ */
+static clip_entry_t *clip_load(const char *path) {
+    uint8_t buf[256];
+    wav_parser_t parser;
+    wav_parse_result_t result = WAV_PARSE_NEED_MORE;
+    const wav_info_t *info = &parser.info;
+
+    File file = SD.open(path);
+    if (!file) {
+        return NULL;
+    }
+
+    wav_parser_init(&parser);
+    while (result == WAV_PARSE_NEED_MORE) {
+        size_t used;
+        int len = file.read(buf, sizeof(buf));
+        if (len <= 0) {
+            break;
+        }
+
+        result = wav_parser_feed(&parser, buf, len, &used);
+        uint32_t skip = wav_parser_skip(&parser, sizeof(buf));
+        if (skip && !file.seek(skip, SeekMode::SeekCur)) {
+            break;
+        }
+    }
+
+    /* Truncated files declare more data than they hold */
+    uint32_t size = info->data_size;
+    uint32_t file_left = file.size() > info->data_offset ? file.size() - info->data_offset : 0;
+    if ((result == WAV_PARSE_DONE) && (size > file_left)) {
+        size = file_left - file_left % info->block_align;
+    }
+
+    if ((result != WAV_PARSE_DONE) || (info->format != WAV_FORMAT_PCM) ||
+        ((info->bits != 8) && (info->bits != 16)) || (info->channels > 2) ||
+        (size == 0) || (size > CLIP_CACHE_BYTES)) {
+        file.close();
+        return NULL;
+    }
+
+    clip_entry_t *entry = clip_make_room(size);
+    if (entry == NULL) {
+        file.close();
+        return NULL;
+    }
+
+    uint8_t *data = (uint8_t *)malloc(size);
+    bool ok = (data != NULL) && file.seek(info->data_offset) && (file.read(data, size) == size);
+    file.close();
+    if (!ok) {
+        free(data);
+        return NULL;
+    }
+
+    entry->clip.data = data;
+    entry->clip.frames = size / info->block_align;
+    entry->clip.sample_rate = info->sample_rate;
+    entry->clip.channels = info->channels;
+    entry->clip.bits = info->bits;
+    strlcpy(entry->path, path, sizeof(entry->path));
+    clip_resident += size;
+    return entry;
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Get the PCM of a short WAV file, from RAM if it is cached
+ */
+const audio_clip_t *clip_cache_get(const char *path) {
+    clip_stamp++;
+    for (int i = 0; i < CLIP_CACHE_ENTRIES; i++) {
+        clip_entry_t *entry = &clip_entries[i];
+        if ((entry->clip.data != NULL) && !strcmp(entry->path, path)) {
+            entry->used = clip_stamp;
+            clip_hits++;
+            return &entry->clip;
+        }
+    }
+
+    clip_misses++;
+    clip_entry_t *entry = clip_load(path);
+    if (entry == NULL) {
+        Serial.printf("Clip %s not cached\r\n", path);
+        return NULL;
+    }
+
+    entry->used = clip_stamp;
+    clip_cache_report();
+    return &entry->clip;
+}
+
+/*!
+ * @brief  Log hit rate and resident bytes
+ */
+void clip_cache_report(void) {
+    uint32_t total = clip_hits + clip_misses;
+
+    Serial.printf("Clip cache: %u hits %u misses (%u%%), %u of %u bytes resident\r\n",
+                  clip_hits, clip_misses, total ? clip_hits * 100 / total : 0,
+                  clip_resident, CLIP_CACHE_BYTES);
+}
@@ -0,0 +1,70 @@
+/*
+ *  clip_cache.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __CLIP_CACHE_HPP_
+#define __CLIP_CACHE_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "audio_mixer.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* PCM bytes kept in RAM, least recently used clips are dropped first */
+#ifndef CLIP_CACHE_BYTES
+#define CLIP_CACHE_BYTES (64 * 1024)
+#endif
+
+/* Number of clips kept */
+#ifndef CLIP_CACHE_ENTRIES
+#define CLIP_CACHE_ENTRIES 8
+#endif
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Get the PCM of a short 8 or 16-bit WAV file, reading it from SD
+ *         only if it is not cached. Must be called from the task owning the mixer,
+ *         clips still playing are never dropped.
+ * @param  File path
+ * @retval Clip, valid until a later call drops it, or NULL if the file is too
+ *         large or not 8/16-bit PCM
+ */
+const audio_clip_t *clip_cache_get(const char *path);
+
+/*!
+ * @brief  Log hit rate and resident bytes
+ * @param  None
+ * @retval None
+ */
+void clip_cache_report(void);
+
+/******************************************************************************/
+
+#endif /* __CLIP_CACHE_HPP_ */
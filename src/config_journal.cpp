@@ -0,0 +1,279 @@
+/*
+ *  config_journal.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "app_config.hpp"
+#include "crc32.hpp"
+#include "config_journal.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define JOURNAL_SECTOR_SIZE 4096
+#define JOURNAL_MARKER 0x4A43        /* "CJ" */
+#define JOURNAL_ALIGN 16
+
+/*
+ * Record layout: header, payload, CRC-32 of header and payload, then 0xFF
+ * padding up to JOURNAL_ALIGN. Records are appended to the active sector,
+ * the newest valid sequence number wins.
+ */
+typedef struct __attribute__((packed)) {
+    uint16_t marker;
+    uint16_t length;             /* Payload bytes */
+    uint32_t sequence;
+} journal_header_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static const esp_partition_t *journal_part = NULL;
+static uint32_t journal_sectors = 0;
+static uint32_t journal_sector = 0;          /* Sector receiving new records */
+static uint32_t journal_offset = 0;          /* Next free byte in that sector */
+static uint32_t journal_sequence = 0;        /* Sequence of the newest record */
+
+/* The configuration and the dirty state are shared by the play and loop tasks */
+static SemaphoreHandle_t journal_lock = NULL;
+static uint8_t *journal_data = NULL;         /* Configuration being journaled */
+static size_t journal_size = 0;
+static uint8_t journal_written[CONFIG_PAYLOAD_MAX];    /* Last record written or recovered */
+static bool journal_dirty = false;
+static uint32_t journal_dirty_ms = 0;
+
+/* Write cost counters */
+static uint32_t journal_records = 0;
+static uint32_t journal_erases = 0;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static constexpr size_t journal_record_size(size_t length) {
+    return (sizeof(journal_header_t) + length + sizeof(uint32_t) + JOURNAL_ALIGN - 1) & ~(size_t)(JOURNAL_ALIGN - 1);
+}
+
+/*!
+ * @brief  Walk the records of one sector
+ * @retval Offset of the first free byte, JOURNAL_SECTOR_SIZE if the sector is full or damaged
+ */
+static uint32_t journal_scan_sector(uint32_t sector, uint8_t *best, bool *found) {
+    uint8_t record[sizeof(journal_header_t) + CONFIG_PAYLOAD_MAX + sizeof(uint32_t)];
+    journal_header_t *header = (journal_header_t *)record;
+    uint32_t base = sector * JOURNAL_SECTOR_SIZE;
+    uint32_t offset = 0;
+
+    while (offset + sizeof(journal_header_t) <= JOURNAL_SECTOR_SIZE) {
+        if (esp_partition_read(journal_part, base + offset, header, sizeof(journal_header_t)) != ESP_OK) {
+            return JOURNAL_SECTOR_SIZE;
+        }
+
+        /* Erased flash, the rest of the sector is free */
+        if ((header->marker == 0xFFFF) && (header->length == 0xFFFF) && (header->sequence == 0xFFFFFFFF)) {
+            return offset;
+        }
+
+        /* Never append after something that is not a record */
+        size_t size = journal_record_size(header->length);
+        if ((header->marker != JOURNAL_MARKER) || (header->length > CONFIG_PAYLOAD_MAX) ||
+            (offset + size > JOURNAL_SECTOR_SIZE)) {
+            return JOURNAL_SECTOR_SIZE;
+        }
+
+        size_t used = sizeof(journal_header_t) + header->length;
+        uint32_t crc = 0;
+        if (esp_partition_read(journal_part, base + offset, record, used + sizeof(crc)) == ESP_OK) {
+            memcpy(&crc, record + used, sizeof(crc));
+        }
+
+        /* Torn or corrupted records are skipped */
+        if ((crc == crc32(record, used)) &&
+            (!*found || ((int32_t)(header->sequence - journal_sequence) > 0))) {
+            /* Records from older firmware may be shorter, the rest stays zero */
+            memset(best, 0, journal_size);
+            memcpy(best, record + sizeof(journal_header_t), header->length < journal_size ? header->length : journal_size);
+            journal_sequence = header->sequence;
+            journal_sector = sector;
+            *found = true;
+        }
+
+        offset += size;
+    }
+
+    return JOURNAL_SECTOR_SIZE;
+}
+
+/*!
+ * @brief  Append one record, moving to the next sector when the active one is full
+ */
+static bool journal_append(const uint8_t *data, size_t length) {
+    uint8_t record[journal_record_size(CONFIG_PAYLOAD_MAX)];
+    journal_header_t *header = (journal_header_t *)record;
+    size_t size = journal_record_size(length);
+
+    if (journal_offset + size > JOURNAL_SECTOR_SIZE) {
+        /* Older sectors keep their records until they are reused, a cut here loses nothing */
+        uint32_t next = (journal_sector + 1) % journal_sectors;
+        if (esp_partition_erase_range(journal_part, next * JOURNAL_SECTOR_SIZE, JOURNAL_SECTOR_SIZE) != ESP_OK) {
+            return false;
+        }
+
+        journal_sector = next;
+        journal_offset = 0;
+        journal_erases++;
+    }
+
+    memset(record, 0xFF, size);
+    header->marker = JOURNAL_MARKER;
+    header->length = length;
+    header->sequence = journal_sequence + 1;
+    memcpy(record + sizeof(journal_header_t), data, length);
+
+    uint32_t crc = crc32(record, sizeof(journal_header_t) + length);
+    memcpy(record + sizeof(journal_header_t) + length, &crc, sizeof(crc));
+
+    /* Consume the slot even if the write fails, it is never written twice */
+    esp_err_t err = esp_partition_write(journal_part, journal_sector * JOURNAL_SECTOR_SIZE + journal_offset, record, size);
+    journal_offset += size;
+    if (err != ESP_OK) {
+        return false;
+    }
+
+    journal_sequence++;
+    journal_records++;
+    return true;
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Open the journal and recover the newest valid record into data
+ */
+bool config_journal_init(void *data, size_t size) {
+    bool found = false;
+
+    journal_lock = xSemaphoreCreateMutex();
+    journal_data = (uint8_t *)data;
+    journal_size = size < CONFIG_PAYLOAD_MAX ? size : CONFIG_PAYLOAD_MAX;
+    journal_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)CONFIG_PARTITION_SUBTYPE,
+                                            CONFIG_PARTITION_LABEL);
+    if (journal_part == NULL) {
+        Serial.println("Config partition not found");
+        return false;
+    }
+
+    journal_sectors = journal_part->size / JOURNAL_SECTOR_SIZE;
+    journal_sector = journal_sectors - 1;
+    journal_offset = JOURNAL_SECTOR_SIZE;    /* Nothing found: the first write erases sector 0 */
+
+    for (uint32_t sector = 0; sector < journal_sectors; sector++) {
+        bool before = found;
+        uint32_t sequence = journal_sequence;
+        uint32_t end = journal_scan_sector(sector, journal_written, &found);
+
+        /* Keep appending where the newest record is */
+        if (found && (!before || (sequence != journal_sequence))) {
+            journal_offset = end;
+        }
+    }
+
+    if (found) {
+        memcpy(journal_data, journal_written, journal_size);
+        Serial.printf("Config recovered, record %u\r\n", journal_sequence);
+    }
+
+    return found;
+}
+
+/*!
+ * @brief  Lock the configuration before changing it
+ */
+void config_journal_lock(void) {
+    xSemaphoreTake(journal_lock, portMAX_DELAY);
+}
+
+/*!
+ * @brief  Unlock the configuration
+ */
+void config_journal_unlock(void) {
+    xSemaphoreGive(journal_lock);
+}
+
+/*!
+ * @brief  Note that the configuration changed
+ */
+void config_journal_mark_dirty(void) {
+    config_journal_lock();
+    if (!journal_dirty) {
+        journal_dirty_ms = millis();
+        journal_dirty = true;
+    }
+    config_journal_unlock();
+}
+
+/*!
+ * @brief  Write the configuration if it is dirty and the deadline expired
+ */
+void config_journal_poll(void) {
+    config_journal_lock();
+    bool due = journal_dirty && (millis() - journal_dirty_ms >= CONFIG_FLUSH_DELAY_MS);
+    config_journal_unlock();
+
+    if (due) {
+        config_journal_flush();
+    }
+}
+
+/*!
+ * @brief  Write the configuration now if it is dirty
+ */
+void config_journal_flush(void) {
+    uint8_t snapshot[CONFIG_PAYLOAD_MAX];
+
+    /* The record is written outside the lock from a consistent copy */
+    config_journal_lock();
+    bool dirty = journal_dirty;
+    journal_dirty = false;
+    memcpy(snapshot, journal_data, journal_size);
+    config_journal_unlock();
+
+    if (!dirty || (journal_part == NULL)) {
+        return;
+    }
+
+    /* Changes that were undone before the deadline cost nothing */
+    if (!memcmp(snapshot, journal_written, journal_size)) {
+        return;
+    }
+
+    if (!journal_append(snapshot, journal_size)) {
+        Serial.println("Config write failed");
+        return;
+    }
+
+    memcpy(journal_written, snapshot, journal_size);
+    Serial.printf("Save configuration, record %u, %u records %u erases this boot\r\n",
+                  journal_sequence, journal_records, journal_erases);
+}
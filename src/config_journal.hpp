@@ -0,0 +1,92 @@
+/*
+ *  config_journal.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __CONFIG_JOURNAL_HPP_
+#define __CONFIG_JOURNAL_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define CONFIG_PARTITION_LABEL "config"
+#define CONFIG_PARTITION_SUBTYPE 0x40
+#define CONFIG_PAYLOAD_MAX 256
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Open the journal and recover the newest valid record into data.
+ *         Shorter records from older firmware leave the remaining bytes zero.
+ * @param  Configuration to journal and its size
+ * @retval True if a record was recovered
+ */
+bool config_journal_init(void *data, size_t size);
+
+/*!
+ * @brief  Lock the configuration before changing it from any task, fields
+ *         changed together are journaled together. Don't mark it dirty or
+ *         flush it while holding the lock.
+ * @param  None
+ * @retval None
+ */
+void config_journal_lock(void);
+
+/*!
+ * @brief  Unlock the configuration
+ * @param  None
+ * @retval None
+ */
+void config_journal_unlock(void);
+
+/*!
+ * @brief  Note that the configuration changed, it is written once the flush
+ *         deadline expires so bursts of changes cost a single record
+ * @param  None
+ * @retval None
+ */
+void config_journal_mark_dirty(void);
+
+/*!
+ * @brief  Write the configuration if it is dirty and the deadline expired
+ * @param  None
+ * @retval None
+ */
+void config_journal_poll(void);
+
+/*!
+ * @brief  Write the configuration now if it is dirty, e.g. before power off
+ * @param  None
+ * @retval None
+ */
+void config_journal_flush(void);
+
+/******************************************************************************/
+
+#endif /* __CONFIG_JOURNAL_HPP_ */
@@ -0,0 +1,69 @@
+/*
+ *  crc32.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __CRC32_HPP_
+#define __CRC32_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define CRC32_INIT 0xFFFFFFFFu
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Continue a CRC-32 (IEEE 802.3) over more data
+ * @param  Running value, start with CRC32_INIT, data and length
+ * @retval Running value, finish with crc32_final
+ */
+uint32_t crc32_update(uint32_t crc, const void *data, size_t len);
+
+/*!
+ * @brief  Finish a running CRC-32
+ * @param  Running value
+ * @retval CRC-32
+ */
+static inline uint32_t crc32_final(uint32_t crc) {
+    return crc ^ 0xFFFFFFFFu;
+}
+
+/*!
+ * @brief  CRC-32 of a buffer
+ * @param  Data and length
+ * @retval CRC-32
+ */
+static inline uint32_t crc32(const void *data, size_t len) {
+    return crc32_final(crc32_update(CRC32_INIT, data, len));
+}
+
+/******************************************************************************/
+
+#endif /* __CRC32_HPP_ */
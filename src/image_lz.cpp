@@ -0,0 +1,271 @@
+/*
+ *  image_lz.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "image_lz.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define IMAGE_LZ_MIN_MATCH 4
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/* Band cache, one for all images as only the GUI task draws. The owners are
+ * only ever cleared from other tasks, which at worst costs a decode. */
+static const uint8_t *band_image = NULL;     /* Image data the band belongs to */
+static uint32_t band_index = 0;
+static uint8_t band_buf[IMAGE_LZ_MAX_WIDTH * IMAGE_LZ_BAND_LINES];
+
+/* Palette of the last image opened, in display colors */
+static const uint8_t *palette_image = NULL;
+static lv_color_t palette[256];
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static inline uint32_t rd32le(const uint8_t *p) {
+    return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/*!
+ * @brief  Bits per palette index of a compressed image
+ */
+static inline uint32_t image_lz_bits(const image_lz_header_t *header) {
+    return header->bits ? header->bits : 8;
+}
+
+/*!
+ * @brief  Band offsets of a compressed image, NULL if its data is not valid
+ *         or a band lies outside it
+ */
+static const uint8_t *image_lz_offsets(const lv_img_dsc_t *img) {
+    const image_lz_header_t *header = (const image_lz_header_t *)img->data;
+
+    if ((img->header.cf != IMAGE_LZ_CF) || (img->data_size < sizeof(image_lz_header_t)) ||
+        (header->magic != IMAGE_LZ_MAGIC) || (header->colors == 0) || (header->colors > 256) ||
+        (header->band_lines == 0) || (header->band_lines > IMAGE_LZ_BAND_LINES) ||
+        ((image_lz_bits(header) & (image_lz_bits(header) - 1)) != 0) || (image_lz_bits(header) > 8) ||
+        (header->colors > (1U << image_lz_bits(header))) ||
+        (img->header.w == 0) || (img->header.w > IMAGE_LZ_MAX_WIDTH)) {
+        return NULL;
+    }
+
+    uint32_t bands = (img->header.h + header->band_lines - 1) / header->band_lines;
+    uint32_t start = sizeof(image_lz_header_t) + header->colors * 4 + (bands + 1) * 4;
+    const uint8_t *offsets = img->data + sizeof(image_lz_header_t) + header->colors * 4;
+    if ((start > img->data_size) || (rd32le(offsets + bands * 4) > img->data_size - start)) {
+        return NULL;
+    }
+
+    /* Every band must lie inside the data, the files come from the card */
+    for (uint32_t band = 0; band < bands; band++) {
+        if (rd32le(offsets + band * 4) > rd32le(offsets + band * 4 + 4)) {
+            return NULL;
+        }
+    }
+
+    return offsets;
+}
+
+/*!
+ * @brief  Claim compressed images
+ */
+static lv_res_t image_lz_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+    if ((lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) || (image_lz_offsets((const lv_img_dsc_t *)src) == NULL)) {
+        return LV_RES_INV;
+    }
+
+    *header = ((const lv_img_dsc_t *)src)->header;
+    return LV_RES_OK;
+}
+
+/*!
+ * @brief  Prepare the palette, nothing is decoded before the lines are read
+ */
+static lv_res_t image_lz_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)dsc->src;
+
+    if ((dsc->src_type != LV_IMG_SRC_VARIABLE) || (image_lz_offsets(img) == NULL)) {
+        return LV_RES_INV;
+    }
+
+    /* Blue, green, red and alpha, the alpha is not used */
+    if (palette_image != img->data) {
+        const image_lz_header_t *header = (const image_lz_header_t *)img->data;
+        const uint8_t *entry = img->data + sizeof(image_lz_header_t);
+        for (uint32_t i = 0; i < header->colors; i++, entry += 4) {
+            palette[i] = lv_color_make(entry[2], entry[1], entry[0]);
+        }
+        palette_image = img->data;
+    }
+
+    dsc->img_data = NULL;    /* Drawn line by line */
+    return LV_RES_OK;
+}
+
+/*!
+ * @brief  Give LVGL one line, decoding its band unless it is cached
+ */
+static lv_res_t image_lz_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc, lv_coord_t x, lv_coord_t y,
+                                   lv_coord_t len, uint8_t *buf) {
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)dsc->src;
+    const image_lz_header_t *header = (const image_lz_header_t *)img->data;
+    uint32_t bits = image_lz_bits(header);
+    uint32_t stride = (img->header.w * bits + 7) / 8;
+    uint32_t band = y / header->band_lines;
+
+    if ((band_image != img->data) || (band_index != band)) {
+        uint32_t bands = (img->header.h + header->band_lines - 1) / header->band_lines;
+        uint32_t lines = img->header.h - band * header->band_lines;
+        const uint8_t *offsets = img->data + sizeof(image_lz_header_t) + header->colors * 4;
+        const uint8_t *start = offsets + (bands + 1) * 4;
+        uint32_t begin = rd32le(offsets + band * 4);
+        uint32_t end = rd32le(offsets + band * 4 + 4);
+
+        if (lines > header->band_lines) {
+            lines = header->band_lines;
+        }
+
+        band_image = NULL;
+        if ((begin > end) || !image_lz_decode(start + begin, end - begin, band_buf, stride * lines)) {
+            return LV_RES_INV;
+        }
+        band_image = img->data;
+        band_index = band;
+    }
+
+    const uint8_t *indices = band_buf + (y % header->band_lines) * stride;
+    lv_color_t *out = (lv_color_t *)buf;
+    if (bits == 8) {
+        indices += x;
+        for (lv_coord_t i = 0; i < len; i++) {
+            out[i] = palette[indices[i]];
+        }
+    }
+    else {
+        uint32_t mask = (1U << bits) - 1;
+        uint32_t pos = x * bits;
+        for (lv_coord_t i = 0; i < len; i++, pos += bits) {
+            out[i] = palette[(indices[pos >> 3] >> (8 - bits - (pos & 7))) & mask];
+        }
+    }
+
+    return LV_RES_OK;
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Register the LVGL decoder of compressed images
+ */
+void image_lz_init(void) {
+    lv_img_decoder_t *decoder = lv_img_decoder_create();
+
+    lv_img_decoder_set_info_cb(decoder, image_lz_info);
+    lv_img_decoder_set_open_cb(decoder, image_lz_open);
+    lv_img_decoder_set_read_line_cb(decoder, image_lz_read_line);
+}
+
+/*!
+ * @brief  Forget the band and palette cached for an image
+ */
+void image_lz_forget(const uint8_t *data) {
+    if (band_image == data) {
+        band_image = NULL;
+    }
+    if (palette_image == data) {
+        palette_image = NULL;
+    }
+}
+
+/*!
+ * @brief  Expand one LZ4 style block
+ */
+bool image_lz_decode(const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len) {
+    const uint8_t *end = src + src_len;
+    uint8_t *out = dst;
+    uint8_t *out_end = dst + dst_len;
+
+    while (src < end) {
+        uint32_t token = *src++;
+        uint32_t len = token >> 4;
+        uint32_t more = 255;
+
+        /* Literals */
+        while ((len >= 15) && (more == 255)) {
+            if (src >= end) {
+                return false;
+            }
+            more = *src++;
+            len += more;
+        }
+        if ((len > (uint32_t)(end - src)) || (len > (uint32_t)(out_end - out))) {
+            return false;
+        }
+        memcpy(out, src, len);
+        out += len;
+        src += len;
+
+        /* The last sequence has no match */
+        if (src >= end) {
+            break;
+        }
+
+        if (end - src < 2) {
+            return false;
+        }
+        uint32_t offset = src[0] | (src[1] << 8);
+        src += 2;
+        len = (token & 0x0F) + IMAGE_LZ_MIN_MATCH;
+        more = 255;
+        while ((len >= 15 + IMAGE_LZ_MIN_MATCH) && (more == 255)) {
+            if (src >= end) {
+                return false;
+            }
+            more = *src++;
+            len += more;
+        }
+        if ((offset == 0) || (offset > (uint32_t)(out - dst)) || (len > (uint32_t)(out_end - out))) {
+            return false;
+        }
+
+        /* Short offsets repeat a pattern, the copy must go byte by byte */
+        const uint8_t *match = out - offset;
+        if (offset >= len) {
+            memcpy(out, match, len);
+            out += len;
+        }
+        else {
+            while (len-- > 0) {
+                *out++ = *match++;
+            }
+        }
+    }
+
+    return out == out_end;
+}
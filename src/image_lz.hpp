@@ -0,0 +1,91 @@
+/*
+ *  image_lz.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef __IMAGE_LZ_HPP_
+#define __IMAGE_LZ_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Color format of compressed images, written by tools/image_lz.py */
+#define IMAGE_LZ_CF LV_IMG_CF_USER_ENCODED_0
+#define IMAGE_LZ_MAGIC 0x385A4C49    /* "ILZ8" */
+
+/* Widest image and most lines per band, they size the band cache */
+#ifndef IMAGE_LZ_MAX_WIDTH
+#define IMAGE_LZ_MAX_WIDTH 320
+#endif
+#ifndef IMAGE_LZ_BAND_LINES
+#define IMAGE_LZ_BAND_LINES 8
+#endif
+
+/*
+ * Start of the image data, followed by the palette in lv_color32_t, the
+ * offset of every band from the first one plus the end of the last, and the
+ * bands. All fields are little endian. Indices narrower than a byte are
+ * packed first pixel in the high bits, every line starts on a byte.
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t colors;             /* Palette entries, up to 256 */
+    uint8_t band_lines;          /* Lines compressed together */
+    uint8_t bits;                /* Bits per index, 1, 2, 4 or 8, 0 is 8 too */
+} image_lz_header_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Register the LVGL decoder of compressed images, lines are decoded
+ *         while drawing through a single band cache
+ * @param  None
+ * @retval None
+ */
+void image_lz_init(void);
+
+/*!
+ * @brief  Expand one LZ4 style block
+ * @param  Compressed block and its length, output and its exact length
+ * @retval False if the block is corrupt or does not fill the output
+ */
+bool image_lz_decode(const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len);
+
+/*!
+ * @brief  Forget the band and palette cached for an image before its data is
+ *         freed, so an image later read at the same address is decoded afresh.
+ *         The image must not be drawn any more.
+ * @param  Image data
+ * @retval None
+ */
+void image_lz_forget(const uint8_t *data);
+
+/******************************************************************************/
+
+#endif /* __IMAGE_LZ_HPP_ */
@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE1
-#define LV_ATTRIBUTE_IMG_IMAGE1
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE1 uint8_t image1_map[] = {
-  0xb9, 0xc2, 0xf9, 0xff, 	/*Color of index 0*/
-  0xab, 0xc2, 0xfb, 0xff, 	/*Color of index 1*/
-  0xa5, 0xbd, 0xfc, 0xff, 	/*Color of index 2*/
-  0xb8, 0xb9, 0xf8, 0xff, 	/*Color of index 3*/
-  0xaa, 0xb9, 0xf9, 0xff, 	/*Color of index 4*/
-  0xb4, 0xb7, 0xfb, 0xff, 	/*Color of index 5*/
-  0x9a, 0xb2, 0xf4, 0xff, 	/*Color of index 6*/
-  0x94, 0xaa, 0xe8, 0xff, 	/*Color of index 7*/
-  0x88, 0x9c, 0xf8, 0xff, 	/*Color of index 8*/
-  0x75, 0x98, 0xf2, 0xff, 	/*Color of index 9*/
-  0x8a, 0x85, 0xf7, 0xff, 	/*Color of index 10*/
-  0x79, 0x87, 0xef, 0xff, 	/*Color of index 11*/
-  0x66, 0x89, 0xdc, 0xff, 	/*Color of index 12*/
-  0x86, 0x7d, 0xf2, 0xff, 	/*Color of index 13*/
-  0x6c, 0x86, 0xd4, 0xff, 	/*Color of index 14*/
-  0x82, 0x7b, 0xeb, 0xff, 	/*Color of index 15*/
-  0x74, 0x7a, 0xe7, 0xff, 	/*Color of index 16*/
-  0x85, 0x73, 0xee, 0xff, 	/*Color of index 17*/
-  0x55, 0x7d, 0xdb, 0xff, 	/*Color of index 18*/
-  0x7c, 0x75, 0xe8, 0xff, 	/*Color of index 19*/
-  0x78, 0x78, 0xcf, 0xff, 	/*Color of index 20*/
-  0x60, 0x76, 0xcc, 0xff, 	/*Color of index 21*/
-  0x72, 0x6e, 0xe0, 0xff, 	/*Color of index 22*/
-  0x73, 0x75, 0xbb, 0xff, 	/*Color of index 23*/
-  0x61, 0x6e, 0xc0, 0xff, 	/*Color of index 24*/
-  0x79, 0x67, 0xc0, 0xff, 	/*Color of index 25*/
-  0x7e, 0x67, 0xbd, 0xff, 	/*Color of index 26*/
-  0x74, 0x67, 0xbc, 0xff, 	/*Color of index 27*/
-  0x4a, 0x67, 0xc8, 0xff, 	/*Color of index 28*/
-  0x6a, 0x65, 0xbc, 0xff, 	/*Color of index 29*/
-  0x5f, 0x63, 0xb7, 0xff, 	/*Color of index 30*/
-  0x4d, 0x62, 0xb5, 0xff, 	/*Color of index 31*/
-  0x60, 0x5b, 0xa7, 0xff, 	/*Color of index 32*/
-  0x4c, 0x55, 0xad, 0xff, 	/*Color of index 33*/
-  0x33, 0x55, 0xa5, 0xff, 	/*Color of index 34*/
-  0x61, 0x4e, 0x9a, 0xff, 	/*Color of index 35*/
-  0x53, 0x47, 0x8c, 0xff, 	/*Color of index 36*/
-  0x15, 0x1a, 0x39, 0xff, 	/*Color of index 37*/
-  0x12, 0x11, 0x18, 0xff, 	/*Color of index 38*/
-  0x01, 0x0a, 0x24, 0xff, 	/*Color of index 39*/
-  0x09, 0x0b, 0x14, 0xff, 	/*Color of index 40*/
-  0x00, 0x03, 0x1a, 0xff, 	/*Color of index 41*/
-  0x01, 0x04, 0x12, 0xff, 	/*Color of index 42*/
-  0x02, 0x03, 0x0b, 0xff, 	/*Color of index 43*/
-  0xf1, 0xf6, 0xf9, 0xff, 	/*Color of index 44*/
-  0xe0, 0xec, 0xf2, 0xff, 	/*Color of index 45*/
-  0xcf, 0xe9, 0xfd, 0xff, 	/*Color of index 46*/
-  0xc2, 0xe1, 0xfd, 0xff, 	/*Color of index 47*/
-  0xc8, 0xe0, 0xf8, 0xff, 	/*Color of index 48*/
-  0xc9, 0xdf, 0xf4, 0xff, 	/*Color of index 49*/
-  0xc4, 0xdd, 0xf9, 0xff, 	/*Color of index 50*/
-  0xc4, 0xdd, 0xf5, 0xff, 	/*Color of index 51*/
-  0xbb, 0xd9, 0xfb, 0xff, 	/*Color of index 52*/
-  0xca, 0xde, 0xe4, 0xff, 	/*Color of index 53*/
-  0xb2, 0xd8, 0xfc, 0xff, 	/*Color of index 54*/
-  0xbd, 0xd9, 0xf4, 0xff, 	/*Color of index 55*/
-  0xb3, 0xd8, 0xf5, 0xff, 	/*Color of index 56*/
-  0xb8, 0xd5, 0xf8, 0xff, 	/*Color of index 57*/
-  0xac, 0xd5, 0xfc, 0xff, 	/*Color of index 58*/
-  0xb2, 0xd5, 0xf9, 0xff, 	/*Color of index 59*/
-  0xb9, 0xd5, 0xf2, 0xff, 	/*Color of index 60*/
-  0xb3, 0xd2, 0xf4, 0xff, 	/*Color of index 61*/
-  0xac, 0xd2, 0xf5, 0xff, 	/*Color of index 62*/
-  0xa5, 0xd0, 0xfb, 0xff, 	/*Color of index 63*/
-  0xb0, 0xcc, 0xf6, 0xff, 	/*Color of index 64*/
-  0x9c, 0xcb, 0xf8, 0xff, 	/*Color of index 65*/
-  0xae, 0xcc, 0xe9, 0xff, 	/*Color of index 66*/
-  0x88, 0xc5, 0xf1, 0xff, 	/*Color of index 67*/
-  0x92, 0xc1, 0xf7, 0xff, 	/*Color of index 68*/
-  0x76, 0xc5, 0xf3, 0xff, 	/*Color of index 69*/
-  0xa4, 0xc3, 0xe5, 0xff, 	/*Color of index 70*/
-  0xad, 0xc4, 0xdb, 0xff, 	/*Color of index 71*/
-  0x64, 0xbd, 0xfb, 0xff, 	/*Color of index 72*/
-  0x91, 0xbd, 0xe6, 0xff, 	/*Color of index 73*/
-  0x87, 0xb9, 0xee, 0xff, 	/*Color of index 74*/
-  0x5b, 0xba, 0xf8, 0xff, 	/*Color of index 75*/
-  0x64, 0xb9, 0xf2, 0xff, 	/*Color of index 76*/
-  0xa4, 0xbb, 0xd0, 0xff, 	/*Color of index 77*/
-  0x77, 0xb6, 0xee, 0xff, 	/*Color of index 78*/
-  0x83, 0xb3, 0xe4, 0xff, 	/*Color of index 79*/
-  0x5b, 0xb2, 0xf4, 0xff, 	/*Color of index 80*/
-  0x77, 0xb4, 0xdf, 0xff, 	/*Color of index 81*/
-  0x68, 0xb1, 0xe9, 0xff, 	/*Color of index 82*/
-  0x97, 0xb3, 0xd0, 0xff, 	/*Color of index 83*/
-  0x83, 0xac, 0xee, 0xff, 	/*Color of index 84*/
-  0x57, 0xac, 0xf1, 0xff, 	/*Color of index 85*/
-  0x65, 0xa9, 0xea, 0xff, 	/*Color of index 86*/
-  0x77, 0xa6, 0xeb, 0xff, 	/*Color of index 87*/
-  0x75, 0xaa, 0xde, 0xff, 	/*Color of index 88*/
-  0x5b, 0xab, 0xe3, 0xff, 	/*Color of index 89*/
-  0x83, 0xac, 0xd0, 0xff, 	/*Color of index 90*/
-  0x4e, 0xa8, 0xef, 0xff, 	/*Color of index 91*/
-  0x6b, 0xa8, 0xde, 0xff, 	/*Color of index 92*/
-  0x61, 0xa4, 0xe3, 0xff, 	/*Color of index 93*/
-  0x5c, 0xa1, 0xeb, 0xff, 	/*Color of index 94*/
-  0x4b, 0xa1, 0xf0, 0xff, 	/*Color of index 95*/
-  0x98, 0xa9, 0xb8, 0xff, 	/*Color of index 96*/
-  0x52, 0xa1, 0xea, 0xff, 	/*Color of index 97*/
-  0x4c, 0xa0, 0xeb, 0xff, 	/*Color of index 98*/
-  0x44, 0xa2, 0xe5, 0xff, 	/*Color of index 99*/
-  0x6e, 0xa3, 0xd3, 0xff, 	/*Color of index 100*/
-  0x45, 0xa0, 0xea, 0xff, 	/*Color of index 101*/
-  0x44, 0x9e, 0xf0, 0xff, 	/*Color of index 102*/
-  0x4c, 0xa0, 0xe5, 0xff, 	/*Color of index 103*/
-  0x50, 0x9d, 0xeb, 0xff, 	/*Color of index 104*/
-  0x5e, 0x9f, 0xde, 0xff, 	/*Color of index 105*/
-  0x51, 0x9e, 0xe5, 0xff, 	/*Color of index 106*/
-  0x4a, 0x9c, 0xee, 0xff, 	/*Color of index 107*/
-  0x62, 0x9a, 0xeb, 0xff, 	/*Color of index 108*/
-  0x4a, 0x9d, 0xe9, 0xff, 	/*Color of index 109*/
-  0x3c, 0x9d, 0xeb, 0xff, 	/*Color of index 110*/
-  0x45, 0x9b, 0xea, 0xff, 	/*Color of index 111*/
-  0x7e, 0xa0, 0xc3, 0xff, 	/*Color of index 112*/
-  0x4b, 0x9a, 0xe6, 0xff, 	/*Color of index 113*/
-  0x55, 0x9b, 0xdc, 0xff, 	/*Color of index 114*/
-  0x62, 0x99, 0xdd, 0xff, 	/*Color of index 115*/
-  0x43, 0x9a, 0xe4, 0xff, 	/*Color of index 116*/
-  0x6f, 0x95, 0xe2, 0xff, 	/*Color of index 117*/
-  0x4d, 0x98, 0xde, 0xff, 	/*Color of index 118*/
-  0x60, 0x98, 0xd3, 0xff, 	/*Color of index 119*/
-  0x55, 0x93, 0xe5, 0xff, 	/*Color of index 120*/
-  0x63, 0x9b, 0xc4, 0xff, 	/*Color of index 121*/
-  0x87, 0x9d, 0xaf, 0xff, 	/*Color of index 122*/
-  0x6b, 0x98, 0xc9, 0xff, 	/*Color of index 123*/
-  0x4a, 0x94, 0xe0, 0xff, 	/*Color of index 124*/
-  0x44, 0x94, 0xe2, 0xff, 	/*Color of index 125*/
-  0x4a, 0x93, 0xdb, 0xff, 	/*Color of index 126*/
-  0x54, 0x92, 0xda, 0xff, 	/*Color of index 127*/
-  0x44, 0x90, 0xdc, 0xff, 	/*Color of index 128*/
-  0x52, 0x90, 0xd3, 0xff, 	/*Color of index 129*/
-  0x5f, 0x91, 0xc9, 0xff, 	/*Color of index 130*/
-  0x4a, 0x8d, 0xdb, 0xff, 	/*Color of index 131*/
-  0x42, 0x8d, 0xd9, 0xff, 	/*Color of index 132*/
-  0x74, 0x93, 0xb1, 0xff, 	/*Color of index 133*/
-  0x4a, 0x8d, 0xd2, 0xff, 	/*Color of index 134*/
-  0x62, 0x90, 0xbb, 0xff, 	/*Color of index 135*/
-  0x39, 0x8a, 0xda, 0xff, 	/*Color of index 136*/
-  0x54, 0x8c, 0xc9, 0xff, 	/*Color of index 137*/
-  0x45, 0x89, 0xd4, 0xff, 	/*Color of index 138*/
-  0x58, 0x88, 0xd0, 0xff, 	/*Color of index 139*/
-  0x4c, 0x8a, 0xc9, 0xff, 	/*Color of index 140*/
-  0x3b, 0x89, 0xd1, 0xff, 	/*Color of index 141*/
-  0x5a, 0x8a, 0xc2, 0xff, 	/*Color of index 142*/
-  0x44, 0x87, 0xcc, 0xff, 	/*Color of index 143*/
-  0x43, 0x85, 0xd0, 0xff, 	/*Color of index 144*/
-  0x4e, 0x83, 0xd1, 0xff, 	/*Color of index 145*/
-  0x63, 0x8a, 0xae, 0xff, 	/*Color of index 146*/
-  0x3a, 0x82, 0xd2, 0xff, 	/*Color of index 147*/
-  0x4c, 0x82, 0xca, 0xff, 	/*Color of index 148*/
-  0x41, 0x82, 0xca, 0xff, 	/*Color of index 149*/
-  0x55, 0x85, 0xb7, 0xff, 	/*Color of index 150*/
-  0x4a, 0x82, 0xc3, 0xff, 	/*Color of index 151*/
-  0x3c, 0x80, 0xcb, 0xff, 	/*Color of index 152*/
-  0x42, 0x80, 0xc5, 0xff, 	/*Color of index 153*/
-  0x83, 0x89, 0x8b, 0xff, 	/*Color of index 154*/
-  0x37, 0x7d, 0xcb, 0xff, 	/*Color of index 155*/
-  0x44, 0x7c, 0xc9, 0xff, 	/*Color of index 156*/
-  0x58, 0x80, 0xb3, 0xff, 	/*Color of index 157*/
-  0x3a, 0x7c, 0xc5, 0xff, 	/*Color of index 158*/
-  0x5d, 0x81, 0xa7, 0xff, 	/*Color of index 159*/
-  0x47, 0x75, 0xc8, 0xff, 	/*Color of index 160*/
-  0x51, 0x77, 0xb9, 0xff, 	/*Color of index 161*/
-  0x68, 0x7f, 0x95, 0xff, 	/*Color of index 162*/
-  0x43, 0x78, 0xb9, 0xff, 	/*Color of index 163*/
-  0x38, 0x73, 0xc1, 0xff, 	/*Color of index 164*/
-  0x4f, 0x79, 0xa5, 0xff, 	/*Color of index 165*/
-  0x35, 0x73, 0xb7, 0xff, 	/*Color of index 166*/
-  0x68, 0x78, 0x83, 0xff, 	/*Color of index 167*/
-  0x4e, 0x72, 0x98, 0xff, 	/*Color of index 168*/
-  0x38, 0x65, 0xba, 0xff, 	/*Color of index 169*/
-  0x43, 0x6c, 0x96, 0xff, 	/*Color of index 170*/
-  0x2e, 0x66, 0xa5, 0xff, 	/*Color of index 171*/
-  0x4d, 0x6a, 0x87, 0xff, 	/*Color of index 172*/
-  0x63, 0x6c, 0x6e, 0xff, 	/*Color of index 173*/
-  0x41, 0x63, 0x8b, 0xff, 	/*Color of index 174*/
-  0x33, 0x5e, 0x8d, 0xff, 	/*Color of index 175*/
-  0x3f, 0x5e, 0x7f, 0xff, 	/*Color of index 176*/
-  0x50, 0x5e, 0x6c, 0xff, 	/*Color of index 177*/
-  0x1d, 0x52, 0x95, 0xff, 	/*Color of index 178*/
-  0x33, 0x54, 0x7d, 0xff, 	/*Color of index 179*/
-  0x3c, 0x55, 0x6f, 0xff, 	/*Color of index 180*/
-  0x31, 0x4b, 0x6b, 0xff, 	/*Color of index 181*/
-  0x1a, 0x43, 0x7e, 0xff, 	/*Color of index 182*/
-  0x27, 0x45, 0x67, 0xff, 	/*Color of index 183*/
-  0x39, 0x47, 0x53, 0xff, 	/*Color of index 184*/
-  0x27, 0x41, 0x5a, 0xff, 	/*Color of index 185*/
-  0x23, 0x3a, 0x68, 0xff, 	/*Color of index 186*/
-  0x0b, 0x34, 0x6e, 0xff, 	/*Color of index 187*/
-  0x21, 0x39, 0x55, 0xff, 	/*Color of index 188*/
-  0x36, 0x3b, 0x3f, 0xff, 	/*Color of index 189*/
-  0x18, 0x32, 0x54, 0xff, 	/*Color of index 190*/
-  0x27, 0x32, 0x42, 0xff, 	/*Color of index 191*/
-  0x15, 0x2c, 0x4a, 0xff, 	/*Color of index 192*/
-  0x16, 0x28, 0x39, 0xff, 	/*Color of index 193*/
-  0x10, 0x23, 0x45, 0xff, 	/*Color of index 194*/
-  0x0d, 0x21, 0x38, 0xff, 	/*Color of index 195*/
-  0x1b, 0x21, 0x27, 0xff, 	/*Color of index 196*/
-  0x06, 0x19, 0x3d, 0xff, 	/*Color of index 197*/
-  0x07, 0x17, 0x31, 0xff, 	/*Color of index 198*/
-  0x05, 0x14, 0x28, 0xff, 	/*Color of index 199*/
-  0x0e, 0x11, 0x15, 0xff, 	/*Color of index 200*/
-  0x03, 0x0b, 0x1a, 0xff, 	/*Color of index 201*/
-  0x02, 0x09, 0x12, 0xff, 	/*Color of index 202*/
-  0xc9, 0xd2, 0xd2, 0xff, 	/*Color of index 203*/
-  0xbc, 0xc2, 0xc0, 0xff, 	/*Color of index 204*/
-  0xfd, 0xfe, 0xfd, 0xff, 	/*Color of index 205*/
-  0x4d, 0x4e, 0x4d, 0xff, 	/*Color of index 206*/
-  0x0e, 0x14, 0x0e, 0xff, 	/*Color of index 207*/
-  0xb5, 0xb7, 0xb3, 0xff, 	/*Color of index 208*/
-  0xa5, 0xab, 0xa1, 0xff, 	/*Color of index 209*/
-  0x13, 0x17, 0x11, 0xff, 	/*Color of index 210*/
-  0xfd, 0xfd, 0xf0, 0xff, 	/*Color of index 211*/
-  0xfa, 0xf9, 0xdd, 0xff, 	/*Color of index 212*/
-  0xe3, 0xe4, 0xdc, 0xff, 	/*Color of index 213*/
-  0xec, 0xe8, 0xc1, 0xff, 	/*Color of index 214*/
-  0xe4, 0xe1, 0xa6, 0xff, 	/*Color of index 215*/
-  0xcb, 0xce, 0xbc, 0xff, 	/*Color of index 216*/
-  0xcc, 0xc6, 0x97, 0xff, 	/*Color of index 217*/
-  0xcf, 0xc4, 0x65, 0xff, 	/*Color of index 218*/
-  0xad, 0xab, 0x83, 0xff, 	/*Color of index 219*/
-  0x98, 0x97, 0x8d, 0xff, 	/*Color of index 220*/
-  0xaf, 0xa3, 0x4b, 0xff, 	/*Color of index 221*/
-  0x9d, 0x99, 0x67, 0xff, 	/*Color of index 222*/
-  0xcc, 0xb0, 0x06, 0xff, 	/*Color of index 223*/
-  0x9d, 0x90, 0x4b, 0xff, 	/*Color of index 224*/
-  0xb3, 0x9c, 0x16, 0xff, 	/*Color of index 225*/
-  0x9d, 0x90, 0x33, 0xff, 	/*Color of index 226*/
-  0x91, 0x86, 0x39, 0xff, 	/*Color of index 227*/
-  0x75, 0x77, 0x6f, 0xff, 	/*Color of index 228*/
-  0x84, 0x7f, 0x49, 0xff, 	/*Color of index 229*/
-  0x9a, 0x86, 0x27, 0xff, 	/*Color of index 230*/
-  0x8a, 0x79, 0x24, 0xff, 	/*Color of index 231*/
-  0x7d, 0x74, 0x35, 0xff, 	/*Color of index 232*/
-  0x64, 0x63, 0x55, 0xff, 	/*Color of index 233*/
-  0x77, 0x6b, 0x24, 0xff, 	/*Color of index 234*/
-  0x62, 0x58, 0x26, 0xff, 	/*Color of index 235*/
-  0x4c, 0x45, 0x31, 0xff, 	/*Color of index 236*/
-  0x35, 0x31, 0x21, 0xff, 	/*Color of index 237*/
-  0x2e, 0x26, 0x0c, 0xff, 	/*Color of index 238*/
-  0x15, 0x13, 0x0d, 0xff, 	/*Color of index 239*/
-  0x18, 0x12, 0x03, 0xff, 	/*Color of index 240*/
-  0x0a, 0x08, 0x03, 0xff, 	/*Color of index 241*/
-  0x1c, 0x17, 0x13, 0xff, 	/*Color of index 242*/
-  0x1f, 0x15, 0x0b, 0xff, 	/*Color of index 243*/
-  0x18, 0x13, 0x12, 0xff, 	/*Color of index 244*/
-  0x1b, 0x13, 0x0e, 0xff, 	/*Color of index 245*/
-  0x17, 0x0f, 0x0c, 0xff, 	/*Color of index 246*/
-  0x0f, 0x0c, 0x08, 0xff, 	/*Color of index 247*/
-  0x1f, 0x13, 0x12, 0xff, 	/*Color of index 248*/
-  0x16, 0x11, 0x11, 0xff, 	/*Color of index 249*/
-  0x1b, 0x0f, 0x14, 0xff, 	/*Color of index 250*/
-  0x19, 0x13, 0x19, 0xff, 	/*Color of index 251*/
-  0x63, 0x54, 0x7f, 0xff, 	/*Color of index 252*/
-  0x0f, 0x0d, 0x11, 0xff, 	/*Color of index 253*/
-  0x0a, 0x09, 0x0b, 0xff, 	/*Color of index 254*/
-  0x01, 0x00, 0x02, 0xff, 	/*Color of index 255*/
-
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf8, 0xf8, 0xf8, 0xf4, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf6, 0xf8, 0xf7, 0xfa, 0xfb, 0xfa, 0xf8, 0xf8, 0xf5, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf8, 0xfb, 0xfa, 0x28, 0x26, 0xfa, 0xf9, 0xf8, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xfd, 0xfb, 0xc9, 0xca, 0x2a, 0x2a, 0xfd, 0xcf, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xef, 0xf4, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xcf, 0xfd, 0x2b, 0xc8, 0xb5, 0xa7, 0xb1, 0xc7, 0xf1, 0xc8, 0xf4, 0xf4, 0xf4, 0xf4, 0xef, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xd2, 0xd2, 0xd2, 0xf5, 0xd2, 0xf8, 0xf8, 0xf3, 0xf8, 0xf5, 0xf4, 0xd2, 0xf4, 0xf4, 0x26, 0x26, 0xfb, 0xc8, 0xf8, 0xf2, 0xfa, 0xf8, 0xf8, 0xf9, 0xf8, 0xd2, 0xf7, 0x29, 0xc2, 0xaa, 0x51, 0x49, 0x4c, 0x4a, 0x5a, 0xaa, 0xc6, 0xc9, 0xfb, 0xfb, 0xf8, 0xcf, 0xd2, 0xcf, 0xfa, 0xfa, 0xd2, 0xd2, 0xd2, 0xef, 0xf4, 0xf5, 0xf8, 0xf5, 0xf8, 0x26, 0xf4, 0xfb, 0xf4, 0xf4, 0xf5, 0xd2, 0xd2, 0xcf, 0xef, 0xd2, 0xf4, 0xef, 0xf2, 0xd2, 0xf5, 0xef, 0xef, 0xd2, 0xcf, 0xcf, 0xd2, 0xd2, 0xd2, 0xcf, 0xd2, 0xd2, 0x26, 0x26, 0xfa, 0xc8, 0xf4, 0xf4, 0xd2, 0xf3, 0xd2, 0xf3, 0xfa, 0xf8, 0xf9, 0xf5, 0xef, 0xf5, 0xef, 0xf3, 0xd2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf8, 0xf3, 0xf8, 0xf3, 0xf5, 0xd2, 0xf5, 0xf4, 0xfb, 0xfa, 0x26, 0xfb, 0xf2, 0xf9, 0xf3, 0xd2, 0xf3, 0xd2, 0xf5, 0xf4, 0xf9, 0xf4, 0xcf, 0xf4, 0xcf, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xd2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf6, 0xf8, 0xf8, 0xf9, 0xfd, 0x2b, 0x2b, 0xc1, 0xa8, 0x51, 0x43, 0x4e, 0x4c, 0x4c, 0x48, 0x4c, 0x52, 0x79, 0xbc, 0x29, 0xfa, 0xf2, 0xcf, 0xd2, 0xf4, 0xfa, 0xf8, 0xef, 0xd2, 0xf4, 0xd2, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0x26, 0xf9, 0xf4, 0xf8, 0xf8, 0xf9, 0xf5, 0xef, 0xf9, 0xf2, 0xf8, 0xf8, 0xf2, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf5, 0xef, 0xf5, 0xf5, 0xf2, 0xf8, 0xf8, 0xf6, 0xfa, 0xf6, 0xf9, 0xfb, 0xf4, 0xf8, 0xf4, 0xf5, 0xef, 0xf5, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xd2, 0xf5, 0xef, 0xf3, 0xf5, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf8, 0xf3, 0xef, 0xf2, 0xf5, 0xf4, 0xfb, 0xfa, 0x26, 0xf8, 0xf4, 0xf8, 0xf5, 0xf5, 0xf2, 0xef, 0xd2, 0xf4, 0xf9, 0xf9, 0xf4, 0xc8, 0xd2, 0xef, 0xf4, 0xf5, 0xf8, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf8, 0x26, 0xf4, 0xf4, 0xc8, 0xd2, 0xcf, 0xc8, 0xfb, 0xf9, 0xfb, 0xf4, 0xf8, 0xf5, 0xf3, 0xf3, 0xf3, 0xf5, 0xf2, 0xc8, 0xca, 0x29, 0xc3, 0xb7, 0x79, 0x43, 0x43, 0x4e, 0x4c, 0x4c, 0x48, 0x4b, 0x63, 0x59, 0x59, 0x59, 0x51, 0xac, 0x27, 0xc9, 0xfb, 0xf4, 0xd2, 0xef, 0xf4, 0xfa, 0xfa, 0x26, 0xf4, 0x26, 0xd2, 0xcf, 0xd2, 0xd2, 0xef, 0xf3, 0xf8, 0xf8, 0xf8, 0xf8, 0xfa, 0xfa, 0xfb, 0xfb, 0xf9, 0xf4, 0xfa, 0xfe, 0xfe, 0xfe, 0xfe, 0x2b, 0xfe, 0x28, 0xfe, 0x28, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xf8, 0xf8, 0xf3, 0xf6, 0xf8, 0xf8, 0xf4, 0xfb, 0xf4, 0x26, 0xcf, 0xc8, 0xf9, 0xf4, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0x26, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf8, 0xf3, 0xf5, 0xf3, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xfa, 0xfa, 0xf8, 0x26, 0xf4, 0xc8, 0xd2, 0xc8, 0xd2, 0xfa, 0xf4, 0xfa, 0xf4, 0xf4, 0xf8, 0xef, 0xf3, 0xef, 0xca, 0x2b, 0x2a, 0xbc, 0xac, 0x64, 0x43, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b, 0x48, 0x4b, 0x7d, 0x8d, 0x8d, 0x76, 0x59, 0x72, 0x59, 0xa8, 0x27, 0x28, 0xfb, 0xf5, 0xd2, 0x26, 0xfb, 0xfa, 0xfa, 0xf4, 0xf4, 0xcf, 0xd2, 0xcf, 0xd2, 0xf3, 0xf3, 0xf5, 0xf8, 0xfa, 0x26, 0x26, 0x2a, 0x2a, 0xff, 0x2a, 0xc9, 0xc7, 0xc1, 0xbf, 0xbc, 0xb9, 0xb7, 0xb9, 0xb9, 0xbc, 0xbf, 0xc1, 0xc7, 0xc9, 0x2b, 0x2b, 0x2b, 0xf1, 0xfa, 0xf4, 0xfb, 0xf9, 0xfb, 0xfa, 0xfb, 0xf4, 0xcf, 0xcf, 0xd2, 0xf9, 0xf4, 0xfa, 0xfa, 0x26, 0xfa, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xfb, 0x26, 0xf4, 0xf4, 0xf4, 0xd2, 0xf4, 0xfb, 0xf9, 0xd2, 0xf5, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf8, 0xf8, 0xf8, 0xf6, 0xf5, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf8, 0xf8, 0xf8, 0xfb, 0xc8, 0xc8, 0xca, 0xc9, 0xc7, 0xb9, 0xaa, 0x5a, 0x43, 0x45, 0x4c, 0x50, 0x4b, 0x4b, 0x4b, 0x48, 0x4b, 0x5f, 0x80, 0x9b, 0x8d, 0x90, 0x90, 0x78, 0x5b, 0x72, 0x52, 0x79, 0xc6, 0xc9, 0xfa, 0xef, 0xf2, 0xfa, 0xfa, 0xfb, 0xf8, 0xf8, 0xf2, 0xf3, 0xd2, 0xef, 0xf2, 0xef, 0x26, 0x28, 0x2b, 0x29, 0xc6, 0xbc, 0xb4, 0x92, 0x79, 0x51, 0x49, 0x45, 0x45, 0x45, 0x41, 0x45, 0x45, 0x41, 0x45, 0x45, 0x45, 0x49, 0x51, 0x79, 0x92, 0xb0, 0xb8, 0xc3, 0xc7, 0x2a, 0x2a, 0xc8, 0xc8, 0xc8, 0xf4, 0xf8, 0xf5, 0xf5, 0xf8, 0xf8, 0xf4, 0xf9, 0xfb, 0xfd, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xd2, 0xc8, 0xc9, 0xca, 0xc6, 0xc8, 0xc9, 0xc8, 0x26, 0xf5, 0xf8, 0xf3, 0xf8, 0xf8, 0xf8, 0xfa, 0xf4, 0xfa, 0xf4, 0xfa, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xd2, 0xcf, 0xf6, 0xd2, 0xf8, 0xf6, 0xf8, 0xf8, 0xf8, 0xf2, 0xef, 0xca, 0xca, 0xc9, 0xc5, 0xbc, 0xa5, 0x79, 0x52, 0x45, 0x4c, 0x52, 0x4c, 0x4c, 0x4c, 0x4b, 0x4b, 0x4b, 0x55, 0x7d, 0x71, 0x93, 0x91, 0xa0, 0xa9, 0x1f, 0x1c, 0x0c, 0x5e, 0x63, 0x52, 0x87, 0xc0, 0xca, 0xfb, 0xf4, 0x26, 0xf2, 0xf3, 0xf5, 0xf3, 0xf5, 0xf8, 0xf4, 0xf4, 0x28, 0xca, 0xca, 0xc1, 0xac, 0x92, 0x5a, 0x43, 0x45, 0x45, 0x45, 0x45, 0x48, 0x4c, 0x48, 0x48, 0x4b, 0x48, 0x48, 0x4b, 0x48, 0x48, 0x48, 0x48, 0x45, 0x45, 0x45, 0x45, 0x4a, 0x51, 0x79, 0x9f, 0xb8, 0xc3, 0xca, 0x28, 0xfe, 0xf8, 0xf8, 0xf2, 0xf8, 0xf6, 0xf2, 0xf7, 0xd2, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xef, 0xf2, 0xf3, 0xf3, 0xf2, 0xef, 0xc8, 0x28, 0xc9, 0xbc, 0xa5, 0x70, 0x87, 0xb9, 0xc9, 0xca, 0xf2, 0xf0, 0xf2, 0xf8, 0xfd, 0xfa, 0xf2, 0xf4, 0xfb, 0xf9, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xcf, 0xd2, 0xf2, 0xcf, 0xc8, 0x26, 0x26, 0xca, 0xca, 0xca, 0xc9, 0xbf, 0xb0, 0x92, 0x51, 0x45, 0x48, 0x4e, 0x50, 0x50, 0x4b, 0x4b, 0x4b, 0x48, 0x4b, 0x50, 0x5b, 0x74, 0x74, 0x5e, 0x8a, 0x12, 0x15, 0x21, 0x21, 0x21, 0x21, 0x1f, 0x12, 0x73, 0x63, 0x51, 0x64, 0xc3, 0x29, 0xfa, 0xd2, 0xd2, 0xef, 0xf2, 0xf2, 0xf9, 0xc8, 0x2a, 0xc9, 0xbe, 0xac, 0x5a, 0x43, 0x43, 0x45, 0x45, 0x4b, 0x45, 0x4b, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4b, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x45, 0x45, 0x41, 0x49, 0x85, 0xb4, 0xc3, 0xca, 0x2a, 0x28, 0xfd, 0xf2, 0xf4, 0xd2, 0xd2, 0xd2, 0xef, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf5, 0xf5, 0xc8, 0x28, 0xc9, 0xbc, 0x85, 0x4a, 0x4e, 0x52, 0x45, 0x43, 0x79, 0xbc, 0xfe, 0xfb, 0xf4, 0x26, 0xfb, 0xf2, 0xfb, 0xfa, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xc8, 0xd2, 0xc9, 0xc9, 0xc9, 0x27, 0xc0, 0xb9, 0xa5, 0x64, 0x45, 0x4a, 0x4c, 0x52, 0x55, 0x4b, 0x50, 0x4b, 0x4b, 0x4b, 0x4b, 0x55, 0x5b, 0x61, 0x71, 0x76, 0x6d, 0x71, 0x83, 0x12, 0xa1, 0x21, 0x20, 0x1e, 0x19, 0x19, 0x1d, 0x1e, 0x15, 0x6c, 0x72, 0x59, 0x79, 0xc2, 0xc9, 0xf2, 0xf4, 0xf2, 0xd2, 0xca, 0xc9, 0xc3, 0xb3, 0x64, 0x43, 0x45, 0x45, 0x4c, 0x45, 0x48, 0x48, 0x4b, 0x50, 0x50, 0x50, 0x55, 0x55, 0x55, 0x5e, 0x5b, 0x5b, 0x5e, 0x5b, 0x5b, 0x55, 0x55, 0x50, 0x50, 0x50, 0x4b, 0x4b, 0x4b, 0x4b, 0x48, 0x48, 0x48, 0x4c, 0x45, 0x45, 0x43, 0x43, 0x92, 0xb5, 0x25, 0xc9, 0xc9, 0xfb, 0xf2, 0xef, 0xcf, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xef, 0xf2, 0x28, 0xc9, 0xc0, 0x9f, 0x51, 0x5c, 0x59, 0x59, 0x50, 0x4c, 0x4c, 0x45, 0x49, 0xa5, 0xc3, 0xc9, 0xc9, 0xfb, 0x28, 0xf9, 0xfb, 0xf4, 0xf5, 0xd2, 0xf5, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfe, 0x2b, 0x2a, 0xc3, 0xb9, 0xa8, 0x79, 0x51, 0x41, 0x48, 0x4c, 0x52, 0x4b, 0x4c, 0x48, 0x48, 0x4b, 0x4b, 0x4c, 0x55, 0x59, 0x63, 0x63, 0x74, 0x6d, 0x6f, 0x6b, 0x71, 0x7d, 0x8a, 0xa1, 0x21, 0x1e, 0x19, 0x1a, 0x1a, 0x1d, 0x19, 0x19, 0x1d, 0x1c, 0x72, 0x67, 0x5c, 0x87, 0xc6, 0xfe, 0xfb, 0xca, 0xff, 0xc0, 0xa8, 0x51, 0x3f, 0x48, 0x48, 0x48, 0x4b, 0x4b, 0x50, 0x55, 0x5b, 0x5e, 0x61, 0x63, 0x65, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x63, 0x65, 0x63, 0x63, 0x5b, 0x55, 0x50, 0x4b, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x45, 0x45, 0x51, 0xa8, 0xbf, 0x2a, 0x2b, 0xf6, 0xf2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xfb, 0xca, 0xc9, 0xac, 0x70, 0x56, 0x76, 0x74, 0x76, 0x72, 0x63, 0x4b, 0x4b, 0x4b, 0x4c, 0x45, 0x51, 0xb0, 0xc4, 0x2b, 0x26, 0x26, 0xf9, 0xf8, 0xf5, 0xf3, 0xd2, 0xf5, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xfb, 0xf6, 0xf3, 0xf3, 0xf5, 0x26, 0xc9, 0x2a, 0x27, 0xbe, 0xae, 0x79, 0x51, 0x45, 0x45, 0x4c, 0x4c, 0x50, 0x4b, 0x4b, 0x48, 0x4b, 0x48, 0x50, 0x50, 0x5b, 0x63, 0x67, 0x67, 0x76, 0x74, 0x67, 0x6f, 0x6f, 0x5f, 0x7c, 0x78, 0x8b, 0xa1, 0x21, 0x18, 0x1b, 0x1a, 0x19, 0x1a, 0x19, 0x19, 0x19, 0x1a, 0x1d, 0x1e, 0x75, 0x5d, 0x69, 0x96, 0xc7, 0x29, 0xbc, 0x9f, 0x43, 0x41, 0x48, 0x4b, 0x4b, 0x5b, 0x5b, 0x5b, 0x65, 0x65, 0x65, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x65, 0x63, 0x61, 0x63, 0x63, 0x63, 0x61, 0x63, 0x61, 0x63, 0x61, 0x63, 0x61, 0x63, 0x5f, 0x63, 0x67, 0x63, 0x6d, 0x6d, 0x62, 0x5b, 0x50, 0x50, 0x48, 0x48, 0x48, 0x48, 0x43, 0x49, 0x79, 0xb9, 0xc7, 0x2b, 0xfb, 0xf2, 0xf4, 0xd2, 0xd2, 0xd2, 0xf5, 0xf2, 0xf8, 0xc9, 0x29, 0xbc, 0x87, 0x64, 0x77, 0x81, 0x86, 0x7f, 0x86, 0xa1, 0x9e, 0x7e, 0x48, 0x48, 0x4b, 0x4c, 0x48, 0x43, 0x51, 0xae, 0xc3, 0x2a, 0xc9, 0xc8, 0xf2, 0xf0, 0xf3, 0xc8, 0xd2, 0xf9, 0xf9, 0xfa, 0xf4, 0xfa, 0x26, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf4, 0xf4, 0xef, 0xd2, 0xf3, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf4, 0xf2, 0xf0, 0xf3, 0x28, 0x2b, 0xc7, 0xb0, 0x79, 0x4e, 0x45, 0x48, 0x4c, 0x4c, 0x50, 0x4b, 0x48, 0x48, 0x4b, 0x4b, 0x55, 0x55, 0x63, 0x63, 0x67, 0x74, 0x67, 0x74, 0x6a, 0x6d, 0x68, 0x6d, 0x74, 0x65, 0x71, 0x7c, 0x75, 0x94, 0x21, 0x18, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1e, 0x1e, 0x5e, 0x61, 0x59, 0xb0, 0xa5, 0x43, 0x45, 0x48, 0x50, 0x50, 0x63, 0x62, 0x65, 0x62, 0x65, 0x61, 0x5f, 0x61, 0x62, 0x61, 0x5f, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x62, 0x62, 0x5f, 0x61, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x6f, 0x62, 0x5b, 0x52, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x79, 0xb9, 0x2b, 0x2a, 0xd2, 0xd2, 0xcf, 0xef, 0xf2, 0xf5, 0xf9, 0x27, 0xb3, 0x58, 0x77, 0x81, 0x86, 0x81, 0x7f, 0x8b, 0x18, 0x1f, 0xa0, 0x97, 0x61, 0x4b, 0x48, 0x48, 0x4c, 0x4c, 0x48, 0x45, 0x58, 0xb0, 0x27, 0x2a, 0xfd, 0xfb, 0xf5, 0xcf, 0xf4, 0xf4, 0xf4, 0xfb, 0xf8, 0xfb, 0xf4, 0xfb, 0xfa, 0xf8, 0xfa, 0xf4, 0xfa, 0xef, 0xf4, 0xef, 0xcf, 0xef, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf8, 0xf5, 0x26, 0xca, 0xc3, 0x9f, 0x43, 0x43, 0x45, 0x4e, 0x4c, 0x4c, 0x4b, 0x4b, 0x4b, 0x55, 0x55, 0x5b, 0x67, 0x65, 0x67, 0x74, 0x6d, 0x67, 0x67, 0x63, 0x6d, 0x67, 0x6d, 0x6a, 0x71, 0x6a, 0x65, 0x6d, 0x7d, 0x6c, 0x9c, 0x20, 0x18, 0x1d, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1d, 0x19, 0x19, 0x19, 0x19, 0x1f, 0xa9, 0x5e, 0x50, 0x45, 0x45, 0x4c, 0x50, 0x61, 0x62, 0x6d, 0x6b, 0x5f, 0x62, 0x5f, 0x61, 0x62, 0x62, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x63, 0x63, 0x5b, 0x50, 0x4b, 0x48, 0x45, 0x45, 0x43, 0x79, 0xbc, 0x29, 0x28, 0xf2, 0xfb, 0x26, 0xc9, 0xc3, 0x92, 0x5c, 0x8e, 0x86, 0x8a, 0x7f, 0x0c, 0xa1, 0x1e, 0x18, 0x18, 0x18, 0x9c, 0x97, 0x74, 0x50, 0x4b, 0x4b, 0x48, 0x4b, 0x4c, 0x48, 0x45, 0x43, 0x9f, 0xc0, 0x27, 0xca, 0xfd, 0x26, 0xf2, 0xf5, 0xf8, 0xf5, 0xf3, 0xf3, 0xd2, 0xef, 0xc8, 0x26, 0xf9, 0xc8, 0xfa, 0xfa, 0xfa, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf5, 0xf4, 0xc9, 0xb9, 0x51, 0x45, 0x4c, 0x4c, 0x4b, 0x4c, 0x50, 0x55, 0x55, 0x5b, 0x63, 0x67, 0x6a, 0x71, 0x6d, 0x6d, 0x65, 0x6d, 0x6d, 0x6d, 0x6f, 0x6d, 0x6d, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x65, 0x76, 0x7c, 0x7f, 0x20, 0x1e, 0x18, 0x1b, 0x1b, 0x1a, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x1d, 0x18, 0x1f, 0xa9, 0x52, 0x48, 0x48, 0x50, 0x65, 0x63, 0x5f, 0x5f, 0x6b, 0x6b, 0x6b, 0x62, 0x61, 0x5b, 0x62, 0x62, 0x62, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x5b, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x65, 0x63, 0x55, 0x4c, 0x48, 0x45, 0x45, 0x49, 0xac, 0xc7, 0xc9, 0xc9, 0x27, 0xb9, 0x79, 0x82, 0x86, 0x86, 0x7e, 0x7f, 0x91, 0x1c, 0x1e, 0x1e, 0x20, 0x1f, 0x1e, 0x18, 0x90, 0x8d, 0x63, 0x63, 0x55, 0x4b, 0x4b, 0x4b, 0x4b, 0x4c, 0x4c, 0x49, 0x4c, 0x79, 0xb9, 0xc7, 0x2b, 0x2a, 0xfd, 0xf2, 0xf5, 0xf3, 0xf3, 0xf3, 0xcf, 0xc8, 0xcf, 0xc8, 0xf4, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0x2b, 0xae, 0x4c, 0x48, 0x4b, 0x55, 0x55, 0x65, 0x68, 0x74, 0x74, 0x63, 0x74, 0x6d, 0x67, 0x67, 0x6d, 0x6d, 0x6f, 0x71, 0x6f, 0x6d, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x65, 0x6a, 0x6d, 0x67, 0x71, 0x76, 0x78, 0x18, 0x1e, 0x1b, 0x1b, 0x1a, 0x1a, 0x19, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x1f, 0x12, 0x4e, 0x4b, 0x5b, 0x6e, 0x74, 0x5b, 0x5f, 0x66, 0x66, 0x5f, 0x5f, 0x6b, 0x61, 0x5f, 0x62, 0x62, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5f, 0x61, 0x62, 0x61, 0x65, 0x65, 0x5f, 0x5b, 0x5f, 0x63, 0x5b, 0x50, 0x48, 0x48, 0x3f, 0x5a, 0xbc, 0xc5, 0xa8, 0x64, 0x8c, 0x8d, 0x86, 0x80, 0x8b, 0xa0, 0x21, 0x21, 0x23, 0x23, 0x21, 0x21, 0x1e, 0x1f, 0x15, 0x90, 0x76, 0x63, 0x63, 0x5b, 0x5b, 0x4b, 0x50, 0x4b, 0x4c, 0x48, 0x4c, 0x4b, 0x43, 0x51, 0xac, 0xbe, 0xc9, 0x2a, 0xc8, 0xf4, 0xf5, 0xf3, 0xf5, 0xd2, 0xf5, 0xf8, 0xf9, 0xf8, 0xfa, 0xfa, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xef, 0xf7, 0xbc, 0x45, 0x50, 0x5b, 0x68, 0x6f, 0x6b, 0x6b, 0x6f, 0x65, 0x6f, 0x6e, 0x65, 0x67, 0x6d, 0x67, 0x6d, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x6e, 0x6d, 0x6d, 0x62, 0x6d, 0x76, 0x7f, 0x0e, 0x1f, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x19, 0x1a, 0x19, 0x1b, 0x1a, 0x1a, 0x19, 0x1d, 0x1f, 0x0c, 0x50, 0x50, 0x5f, 0x65, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x61, 0x6a, 0x68, 0x68, 0x66, 0x66, 0x5f, 0x65, 0x5f, 0x65, 0x5b, 0x50, 0x48, 0x45, 0x49, 0x79, 0x77, 0x8c, 0x8b, 0x91, 0x0c, 0x12, 0x1f, 0x21, 0x21, 0x21, 0x1e, 0x19, 0x19, 0x1d, 0x1e, 0x1e, 0x18, 0x91, 0x8a, 0x65, 0x67, 0x63, 0x63, 0x63, 0x55, 0x4b, 0x4b, 0x48, 0x4c, 0x48, 0x4c, 0x45, 0x45, 0x51, 0x87, 0xb7, 0xc3, 0x2b, 0xc9, 0xfa, 0xfb, 0xf5, 0xf6, 0xf3, 0xf3, 0xf5, 0xf6, 0xfb, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xf7, 0xc6, 0x79, 0x55, 0x6f, 0x7d, 0x71, 0x6c, 0x6b, 0x6b, 0x6d, 0x65, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6d, 0x6d, 0x71, 0x6b, 0x71, 0x6b, 0x6d, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6a, 0x74, 0x7f, 0x73, 0x1f, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x19, 0x1b, 0x1a, 0x1a, 0x1d, 0x1e, 0x75, 0x48, 0x5f, 0x74, 0x65, 0x65, 0x68, 0x61, 0x5e, 0x61, 0x61, 0x61, 0x63, 0x5b, 0x63, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x68, 0x61, 0x68, 0x68, 0x68, 0x68, 0x5f, 0x68, 0x5f, 0x68, 0x6b, 0x6d, 0x50, 0x4b, 0x45, 0x4b, 0x77, 0x99, 0x8b, 0x0c, 0x18, 0x21, 0x21, 0x21, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x1a, 0x1d, 0x1e, 0x12, 0x8b, 0x74, 0x61, 0x63, 0x61, 0x63, 0x63, 0x63, 0x59, 0x50, 0x4b, 0x48, 0x48, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x5a, 0xaa, 0xbc, 0x29, 0x2b, 0xc8, 0xf2, 0xf5, 0xf2, 0xf3, 0xf2, 0xf5, 0xc8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xca, 0xb5, 0x58, 0x6b, 0x66, 0x62, 0x6a, 0x71, 0x6b, 0x6b, 0x6d, 0x6d, 0x6d, 0x6f, 0x6d, 0x6d, 0x6d, 0x65, 0x6d, 0x71, 0x6d, 0x6d, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x68, 0x76, 0x76, 0x81, 0x8b, 0x20, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x1b, 0x19, 0x1d, 0x1e, 0x18, 0x5e, 0x54, 0x6f, 0x6d, 0x65, 0x5f, 0x62, 0x61, 0x61, 0x61, 0x68, 0x61, 0x61, 0x61, 0x63, 0x5f, 0x62, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x68, 0x62, 0x61, 0x62, 0x61, 0x68, 0x62, 0x68, 0x62, 0x68, 0x5b, 0x74, 0x63, 0x50, 0x4b, 0x48, 0x72, 0x94, 0x1f, 0x21, 0x21, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1a, 0x1d, 0x18, 0x8b, 0x84, 0x61, 0x6d, 0x62, 0x61, 0x61, 0x67, 0x65, 0x63, 0x63, 0x50, 0x50, 0x48, 0x48, 0x48, 0x4b, 0x4c, 0x4c, 0x43, 0x52, 0x7b, 0xb3, 0xc7, 0xc9, 0x28, 0xd2, 0xc8, 0xef, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x2a, 0xa5, 0x56, 0x66, 0x74, 0x63, 0x69, 0x6a, 0x66, 0x66, 0x67, 0x6d, 0x6a, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x6b, 0x71, 0x68, 0x7c, 0x7e, 0x7f, 0xa1, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x1b, 0x1e, 0xa1, 0x09, 0x56, 0x74, 0x63, 0x5f, 0x68, 0x68, 0x62, 0x65, 0x62, 0x61, 0x68, 0x61, 0x62, 0x62, 0x5f, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x62, 0x65, 0x65, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x63, 0x67, 0x62, 0x65, 0x71, 0x5b, 0x52, 0x48, 0x77, 0x22, 0x1f, 0x17, 0x1b, 0x1a, 0x1a, 0x1a, 0x19, 0x1d, 0x1b, 0x1b, 0x1a, 0x1a, 0x1b, 0x1e, 0x91, 0x8a, 0x6a, 0x6d, 0x6b, 0x6b, 0x66, 0x6b, 0x5b, 0x5f, 0x6d, 0x65, 0x63, 0x61, 0x50, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x4c, 0x4c, 0x51, 0xae, 0xc3, 0x2a, 0xfd, 0xfd, 0xfa, 0xfb, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0x27, 0x7b, 0x61, 0x5f, 0x6e, 0x6a, 0x63, 0x63, 0x6e, 0x6f, 0x6d, 0x6a, 0x6d, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x71, 0x62, 0x71, 0x76, 0x86, 0x0c, 0x18, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x1d, 0x1d, 0x15, 0x5e, 0x5e, 0x71, 0x6d, 0x6d, 0x62, 0x6d, 0x68, 0x68, 0x5f, 0x65, 0x5f, 0x62, 0x5f, 0x68, 0x5f, 0x62, 0x5f, 0x61, 0x62, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x65, 0x5f, 0x63, 0x61, 0x63, 0x61, 0x62, 0x61, 0x62, 0x67, 0x61, 0x67, 0x6d, 0x62, 0x71, 0x5b, 0x55, 0x48, 0x69, 0x18, 0x18, 0x19, 0x1a, 0x1b, 0x1b, 0x1b, 0x19, 0x1a, 0x1b, 0x1a, 0x1a, 0x1b, 0x1e, 0x15, 0x86, 0x7e, 0x5b, 0x6b, 0x62, 0x6b, 0x62, 0x6b, 0x65, 0x65, 0x6d, 0x62, 0x68, 0x71, 0x67, 0x5b, 0x4b, 0x48, 0x48, 0x48, 0x4b, 0x4c, 0x4c, 0x45, 0x43, 0x92, 0xbc, 0xc9, 0xc9, 0xfa, 0x26, 0xf4, 0xd2, 0xf5, 0xf4, 0xf9, 0x26, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xfe, 0xc6, 0x73, 0x63, 0x65, 0x68, 0x71, 0x67, 0x6e, 0x6f, 0x6f, 0x6d, 0x6f, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6f, 0x67, 0x74, 0x80, 0x76, 0x14, 0x18, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x1d, 0x1d, 0x18, 0x5e, 0x5f, 0x6d, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x65, 0x61, 0x61, 0x62, 0x61, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x61, 0x5b, 0x50, 0x6a, 0x1e, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x19, 0x19, 0x1a, 0x1a, 0x1b, 0x18, 0x8b, 0x84, 0x61, 0x61, 0x62, 0x62, 0x62, 0x6d, 0x68, 0x6b, 0x6b, 0x6b, 0x62, 0x68, 0x6d, 0x67, 0x67, 0x5b, 0x50, 0x4b, 0x45, 0x48, 0x48, 0x4c, 0x4c, 0x4c, 0x45, 0xa8, 0xc6, 0xca, 0xc8, 0xd2, 0xf0, 0xf3, 0xf8, 0xf4, 0x26, 0xf4, 0xf8, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xfd, 0xc6, 0x5d, 0x67, 0x6e, 0x71, 0x6c, 0x67, 0x6e, 0x6d, 0x6f, 0x71, 0x6d, 0x6d, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x7d, 0x84, 0x7f, 0x15, 0x1d, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x1e, 0x15, 0x08, 0x5e, 0x68, 0x6d, 0x68, 0x5f, 0x68, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x65, 0x7d, 0x5b, 0x56, 0x75, 0x1e, 0x18, 0x1a, 0x19, 0x1a, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x1e, 0x8b, 0x83, 0x74, 0x61, 0x62, 0x62, 0x68, 0x6d, 0x6b, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6d, 0x6d, 0x61, 0x63, 0x67, 0x63, 0x63, 0x50, 0x50, 0x48, 0x4b, 0x48, 0x52, 0x43, 0x49, 0xc0, 0xca, 0xc8, 0xf9, 0xf2, 0xf5, 0xfa, 0xfb, 0xfa, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xc5, 0x64, 0x63, 0x6e, 0x6b, 0x71, 0x6d, 0x6d, 0x6f, 0x68, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x7d, 0x80, 0x86, 0x0c, 0x18, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1d, 0x18, 0x09, 0x5e, 0x71, 0x71, 0x62, 0x68, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x65, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x61, 0x65, 0x62, 0x62, 0x67, 0x71, 0x62, 0x57, 0x7f, 0x1e, 0x19, 0x1a, 0x1a, 0x1b, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x1a, 0x18, 0x15, 0x86, 0x76, 0x61, 0x68, 0x61, 0x62, 0x6d, 0x62, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6d, 0x62, 0x63, 0x67, 0x63, 0x63, 0x63, 0x5b, 0x50, 0x4b, 0x45, 0x4c, 0x45, 0x5a, 0xbe, 0xc9, 0xd2, 0xf5, 0xf8, 0xf8, 0x26, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xfd, 0xc6, 0x64, 0x63, 0x63, 0x6b, 0x6c, 0x71, 0x63, 0x71, 0x68, 0x71, 0x6d, 0x71, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x7e, 0x8d, 0x7f, 0x0e, 0x1e, 0x19, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1d, 0x1b, 0x75, 0x6c, 0x6d, 0x68, 0x68, 0x68, 0x6d, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x65, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x65, 0x6d, 0x61, 0x67, 0x65, 0x5e, 0x0e, 0x1d, 0x1a, 0x1a, 0x19, 0x1b, 0x19, 0x1a, 0x19, 0x1a, 0x19, 0x1d, 0xa1, 0x8b, 0x80, 0x61, 0x62, 0x68, 0x62, 0x68, 0x6b, 0x62, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x62, 0x6d, 0x6d, 0x6d, 0x65, 0x63, 0x65, 0x63, 0x6e, 0x63, 0x5b, 0x4b, 0x4c, 0x45, 0x58, 0xc6, 0xc8, 0xc8, 0xf8, 0xf4, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xc7, 0x79, 0x59, 0x6e, 0x6b, 0x71, 0x67, 0x6d, 0x68, 0x68, 0x6d, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x6f, 0x6d, 0x6d, 0x71, 0x6d, 0x74, 0x80, 0x8a, 0x7f, 0x15, 0x18, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x1d, 0x0c, 0x5e, 0x68, 0x65, 0x62, 0x6d, 0x68, 0x6d, 0x68, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x6d, 0x61, 0x74, 0x63, 0x5b, 0x6c, 0x15, 0x1a, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1a, 0x1b, 0x18, 0x91, 0x7f, 0x68, 0x61, 0x68, 0x62, 0x68, 0x6d, 0x68, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6f, 0x6d, 0x6d, 0x62, 0x65, 0x65, 0x65, 0x6e, 0x65, 0x6e, 0x5b, 0x50, 0x45, 0xa8, 0xc9, 0xc8, 0xf8, 0xf8, 0xf9, 0xf9, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0x29, 0x87, 0x59, 0x6e, 0x6d, 0x6c, 0x6d, 0x65, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x6f, 0x6d, 0x62, 0x80, 0x84, 0x86, 0x0c, 0x17, 0x1b, 0x1a, 0x1a, 0x17, 0x1a, 0x1a, 0x19, 0x1e, 0x15, 0x57, 0x6c, 0x68, 0x63, 0x6f, 0x68, 0x62, 0x68, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x5b, 0x62, 0x5b, 0x62, 0x5b, 0x62, 0x5b, 0x62, 0x5b, 0x62, 0x5b, 0x62, 0x5b, 0x62, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x65, 0x6d, 0x62, 0x62, 0x65, 0x62, 0x6d, 0x65, 0x6e, 0x67, 0x5e, 0x75, 0x18, 0x19, 0x1d, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1a, 0x1b, 0x18, 0x0e, 0x86, 0x71, 0x68, 0x68, 0x61, 0x68, 0x6b, 0x68, 0x6b, 0x68, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6d, 0x6b, 0x6b, 0x6d, 0x68, 0x6d, 0x66, 0x65, 0x66, 0x65, 0x6f, 0x6f, 0x56, 0x51, 0xc3, 0x28, 0xf8, 0xfa, 0xf8, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0x2a, 0xa5, 0x59, 0x6e, 0x6f, 0x6b, 0x65, 0x67, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x6f, 0x62, 0x6d, 0x71, 0x68, 0x6d, 0x84, 0x84, 0x83, 0x0e, 0x1e, 0x1a, 0x1a, 0x1a, 0x19, 0x1a, 0x1a, 0x18, 0x18, 0x6c, 0x6c, 0x68, 0x62, 0x62, 0x6d, 0x68, 0x68, 0x68, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x65, 0x6d, 0x6d, 0x74, 0x71, 0x6c, 0x0c, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1a, 0x18, 0x15, 0x8b, 0x7c, 0x61, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x6d, 0x68, 0x6b, 0x6d, 0x6f, 0x6b, 0x6d, 0x6f, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6b, 0x5f, 0x66, 0x65, 0x74, 0x52, 0xb5, 0xca, 0xf8, 0xf5, 0xfa, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0x29, 0xb3, 0x52, 0x6e, 0x71, 0x6b, 0x6d, 0x63, 0x65, 0x71, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x6d, 0x6d, 0x6f, 0x7d, 0x84, 0x8d, 0x7f, 0x15, 0x1b, 0x1a, 0x1a, 0x1a, 0x17, 0x1a, 0x1a, 0x18, 0x0c, 0x5d, 0x6a, 0x61, 0x71, 0x71, 0x68, 0x68, 0x68, 0x6d, 0x68, 0x6b, 0x62, 0x62, 0x6b, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x5b, 0x62, 0x5b, 0x62, 0x5b, 0x62, 0x5b, 0x62, 0x5b, 0x61, 0x5b, 0x62, 0x61, 0x65, 0x61, 0x65, 0x61, 0x65, 0x61, 0x65, 0x61, 0x65, 0x61, 0x65, 0x61, 0x65, 0x61, 0x65, 0x61, 0x65, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x65, 0x6d, 0x62, 0x65, 0x62, 0x65, 0x65, 0x65, 0x6d, 0x6a, 0x71, 0x62, 0x5e, 0x15, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1a, 0x19, 0x1b, 0x15, 0x8b, 0x7d, 0x71, 0x5e, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x6d, 0x62, 0x6d, 0x62, 0x62, 0x6d, 0x6d, 0x6f, 0x65, 0x65, 0x65, 0x65, 0x6d, 0x65, 0x62, 0x65, 0x6d, 0x6f, 0x65, 0x59, 0xaa, 0x2a, 0xf8, 0xf8, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0x2b, 0xbe, 0x5c, 0x6d, 0x6b, 0x6b, 0x6d, 0x65, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x62, 0x71, 0x84, 0x80, 0x86, 0x0c, 0x15, 0x19, 0x1a, 0x1a, 0x1a, 0x1b, 0x1a, 0x18, 0x15, 0x57, 0x71, 0x65, 0x6d, 0x68, 0x61, 0x68, 0x6d, 0x62, 0x67, 0x61, 0x67, 0x61, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x63, 0x63, 0x5b, 0x61, 0x67, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x62, 0x5f, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x62, 0x5f, 0x61, 0x62, 0x61, 0x67, 0x61, 0x67, 0x61, 0x63, 0x63, 0x63, 0x67, 0x67, 0x67, 0x6a, 0x68, 0x62, 0x65, 0x62, 0x61, 0x68, 0x62, 0x71, 0x71, 0x75, 0x18, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1a, 0x19, 0x1b, 0x18, 0x8b, 0x83, 0x61, 0x6d, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6d, 0x6d, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6d, 0x6e, 0x65, 0x65, 0x65, 0x6d, 0x65, 0x6f, 0x65, 0x65, 0x6e, 0x52, 0xaa, 0x2a, 0xf8, 0xf6, 0xf8, 0xf9, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xc6, 0x7b, 0x6b, 0x6b, 0x6b, 0x71, 0x67, 0x62, 0x74, 0x65, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x6d, 0x6d, 0x66, 0x6f, 0x6b, 0x6d, 0x62, 0x71, 0x68, 0x76, 0x84, 0x86, 0x86, 0x8b, 0x1d, 0x1b, 0x1a, 0x1a, 0x1a, 0x17, 0x1d, 0x15, 0x75, 0x68, 0x68, 0x62, 0x6d, 0x68, 0x68, 0x6d, 0x6b, 0x6d, 0x67, 0x5d, 0x67, 0x67, 0x67, 0x62, 0x62, 0x68, 0x6a, 0x5b, 0x63, 0x63, 0x63, 0x63, 0x61, 0x62, 0x61, 0x61, 0x61, 0x61, 0x5f, 0x61, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x5f, 0x63, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x63, 0x5b, 0x63, 0x67, 0x67, 0x6a, 0x68, 0x68, 0x6d, 0x62, 0x65, 0x65, 0x65, 0x6d, 0x71, 0x78, 0x6c, 0x0c, 0x1d, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x18, 0x18, 0x8b, 0x8a, 0x61, 0x62, 0x62, 0x6d, 0x71, 0x68, 0x6d, 0x65, 0x68, 0x6f, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x62, 0x62, 0x62, 0x6d, 0x66, 0x56, 0xaa, 0x2a, 0xfb, 0xf8, 0xf9, 0x26, 0xfa, 0x26, 0xf5, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xef, 0xf9, 0xca, 0xaf, 0x56, 0x6b, 0x6f, 0x71, 0x6a, 0x62, 0x6f, 0x65, 0x6d, 0x6d, 0x65, 0x6d, 0x6d, 0x6d, 0x68, 0x6d, 0x6f, 0x6b, 0x6f, 0x6d, 0x6f, 0x6a, 0x68, 0x84, 0x7e, 0x8d, 0x7f, 0x94, 0x1d, 0x19, 0x1a, 0x1a, 0x1a, 0x1b, 0x18, 0x0e, 0x5e, 0x68, 0x62, 0x6d, 0x62, 0x68, 0x62, 0x62, 0x6a, 0x67, 0x62, 0x62, 0x6d, 0x5f, 0x6b, 0x5f, 0x6f, 0x56, 0x55, 0x56, 0x54, 0x56, 0x54, 0x55, 0x5b, 0x65, 0x61, 0x5b, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x5f, 0x68, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x62, 0x62, 0x62, 0x61, 0x61, 0x62, 0x62, 0x62, 0x5f, 0x5f, 0x5f, 0x6b, 0x68, 0x6b, 0x68, 0x6b, 0x65, 0x65, 0x63, 0x63, 0x63, 0x62, 0x65, 0x65, 0x6f, 0x68, 0x71, 0x6c, 0x78, 0x15, 0x19, 0x19, 0x19, 0x1a, 0x1a, 0x19, 0x1b, 0x1d, 0x8b, 0x8a, 0x62, 0x67, 0x62, 0x68, 0x68, 0x68, 0x6d, 0x6d, 0x6f, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x65, 0x68, 0x65, 0x6f, 0x52, 0xb0, 0x2a, 0xf6, 0xf9, 0xf4, 0xc8, 0xfa, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xc9, 0xc0, 0x77, 0x5e, 0x68, 0x62, 0x6f, 0x6d, 0x6d, 0x6d, 0x65, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x71, 0x62, 0x7c, 0x84, 0x84, 0x86, 0x7f, 0x15, 0x1e, 0x19, 0x1a, 0x1a, 0x19, 0x18, 0x15, 0x75, 0x5e, 0x6d, 0x65, 0x62, 0x68, 0x68, 0x62, 0x6a, 0x67, 0x6d, 0x62, 0x66, 0x66, 0x6b, 0x71, 0x5b, 0x56, 0x77, 0xaa, 0x24, 0xba, 0xb6, 0xb3, 0x97, 0x58, 0x55, 0x61, 0x61, 0x61, 0x61, 0x5f, 0x61, 0x5f, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x61, 0x61, 0x67, 0x61, 0x62, 0x5f, 0x66, 0x66, 0x66, 0x66, 0x5f, 0x6b, 0x6b, 0x6b, 0x66, 0x66, 0x65, 0x63, 0x63, 0x63, 0x61, 0x65, 0x6d, 0x65, 0x6d, 0x68, 0x68, 0x6c, 0x0e, 0x19, 0x18, 0x19, 0x19, 0x1a, 0x19, 0x1b, 0x18, 0x15, 0x8a, 0x71, 0x67, 0x62, 0x6d, 0x68, 0x71, 0x68, 0x65, 0x68, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x50, 0xb5, 0x29, 0xf8, 0xf5, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf2, 0x28, 0x27, 0x9d, 0x86, 0x7c, 0x68, 0x6d, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x62, 0x7c, 0x8d, 0x84, 0x83, 0x8b, 0x18, 0x1d, 0x1a, 0x1a, 0x1a, 0x19, 0x1b, 0x0c, 0x6c, 0x6d, 0x62, 0x65, 0x6d, 0x68, 0x68, 0x62, 0x67, 0x67, 0x6b, 0x66, 0x66, 0x6b, 0x62, 0x54, 0x82, 0xba, 0x27, 0xff, 0xff, 0x2b, 0x2b, 0x2a, 0x29, 0xc0, 0x87, 0x55, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x5f, 0x68, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5e, 0x5e, 0x56, 0x61, 0x5f, 0x6b, 0x66, 0x6b, 0x6b, 0x67, 0x67, 0x61, 0x62, 0x62, 0x65, 0x6f, 0x65, 0x68, 0x71, 0x6b, 0x75, 0x15, 0x19, 0x19, 0x1a, 0x1a, 0x19, 0x1b, 0x1b, 0x15, 0x90, 0x76, 0x67, 0x62, 0x6d, 0x68, 0x68, 0x6d, 0x6d, 0x6f, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x67, 0x56, 0xbe, 0xca, 0xf4, 0xf4, 0xcf, 0xef, 0xf5, 0xf5, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0x2b, 0xb0, 0x8e, 0x8f, 0x7d, 0x6b, 0x6f, 0x62, 0x6d, 0x6d, 0x71, 0x6f, 0x6d, 0x6d, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x6d, 0x6d, 0x61, 0x71, 0x8d, 0x80, 0x8d, 0x8b, 0x8b, 0x1e, 0x1d, 0x1a, 0x1a, 0x19, 0x1d, 0x15, 0x6c, 0x5e, 0x65, 0x5f, 0x63, 0x68, 0x68, 0x68, 0x62, 0x6d, 0x65, 0x6b, 0x66, 0x66, 0x5e, 0x56, 0x9f, 0xc6, 0x2b, 0x29, 0xc3, 0xb7, 0xb5, 0xb5, 0xba, 0xc0, 0xc5, 0xc5, 0x8d, 0x5b, 0x5b, 0x62, 0x62, 0x61, 0x5f, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x65, 0x62, 0x65, 0x61, 0x5d, 0x69, 0x51, 0x64, 0x79, 0x87, 0x64, 0x5c, 0x56, 0x6a, 0x5e, 0x5e, 0x68, 0x6a, 0x68, 0x67, 0x62, 0x6d, 0x65, 0x6d, 0x65, 0x6f, 0x71, 0x6c, 0x0e, 0x1d, 0x19, 0x1a, 0x1a, 0x19, 0x1b, 0x1b, 0x15, 0x94, 0x7c, 0x61, 0x65, 0x67, 0x68, 0x71, 0x68, 0x6d, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x67, 0x5c, 0xc7, 0xc9, 0xf2, 0xf5, 0xd2, 0xef, 0xd2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xca, 0xbf, 0x8e, 0x97, 0x93, 0x80, 0x68, 0x71, 0x71, 0x6d, 0x68, 0x71, 0x6d, 0x6f, 0x71, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x6a, 0x62, 0x7e, 0x84, 0x86, 0x8d, 0x0c, 0x94, 0x1d, 0x1a, 0x1a, 0x1b, 0x1b, 0x18, 0x0c, 0x5e, 0x62, 0x65, 0x63, 0x62, 0x6d, 0x68, 0x68, 0x62, 0x65, 0x66, 0x66, 0x6b, 0x61, 0x56, 0x87, 0x29, 0x2b, 0xb9, 0x92, 0x4f, 0x58, 0x52, 0x52, 0x59, 0x58, 0x73, 0x97, 0x7e, 0x61, 0x61, 0x6a, 0x5f, 0x62, 0x62, 0x62, 0x5f, 0x68, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x62, 0x65, 0x5f, 0x5f, 0x61, 0x67, 0x5c, 0x5c, 0xb7, 0xc5, 0x29, 0x27, 0x27, 0xbc, 0xa5, 0x4a, 0x5d, 0x6a, 0x5f, 0x5f, 0x62, 0x68, 0x6d, 0x62, 0x6d, 0x62, 0x6b, 0x6d, 0x6b, 0x71, 0x75, 0x18, 0x19, 0x1a, 0x1a, 0x19, 0x1b, 0x1a, 0x18, 0x91, 0x83, 0x61, 0x62, 0x6d, 0x68, 0x68, 0x6d, 0x6d, 0x6b, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x5d, 0x96, 0x27, 0xfd, 0xf5, 0xf4, 0xef, 0xd2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf4, 0xfb, 0x29, 0xa8, 0x8e, 0x93, 0x9b, 0x8d, 0x6a, 0x68, 0x71, 0x71, 0x71, 0x68, 0x71, 0x6d, 0x6d, 0x6d, 0x65, 0x6d, 0x67, 0x62, 0x76, 0x84, 0x86, 0x84, 0x86, 0x0c, 0x1f, 0x20, 0x1b, 0x1a, 0x1a, 0x18, 0xa1, 0x6c, 0x5e, 0x62, 0x65, 0x5f, 0x65, 0x68, 0x68, 0x68, 0x65, 0x66, 0x66, 0x66, 0x61, 0x5b, 0x77, 0xc5, 0xbe, 0x87, 0x4f, 0x5b, 0x71, 0x5f, 0x6e, 0x66, 0x6e, 0x7d, 0x68, 0x5e, 0x61, 0x61, 0x61, 0x5b, 0x61, 0x62, 0x5f, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x61, 0x66, 0x65, 0x6e, 0x62, 0x68, 0x5d, 0xb6, 0x29, 0xc6, 0xc6, 0x27, 0x27, 0x29, 0x2a, 0xc0, 0x7b, 0x59, 0x74, 0x65, 0x65, 0x6a, 0x62, 0x6d, 0x6d, 0x62, 0x6d, 0x6d, 0x6f, 0x6d, 0x5e, 0x15, 0x19, 0x19, 0x1a, 0x19, 0x1b, 0x1a, 0x18, 0x91, 0x8a, 0x67, 0x65, 0x67, 0x68, 0x68, 0x68, 0x6d, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x5c, 0xb5, 0x29, 0xfb, 0xf8, 0xf3, 0xd2, 0xf4, 0xd2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0x28, 0xb7, 0x82, 0x98, 0x93, 0x99, 0x9b, 0x84, 0x7c, 0x68, 0x71, 0x6d, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x61, 0x71, 0x80, 0x8d, 0x86, 0x8d, 0x8a, 0x8b, 0x1f, 0x20, 0x23, 0x24, 0x20, 0x1f, 0x7f, 0x5e, 0x6a, 0x62, 0x65, 0x65, 0x61, 0x68, 0x6a, 0x68, 0x65, 0x6d, 0x66, 0x62, 0x61, 0x5d, 0xa6, 0xa3, 0x59, 0x52, 0x67, 0x65, 0x65, 0x66, 0x66, 0x6f, 0x6b, 0x66, 0x6d, 0x6d, 0x61, 0x5b, 0x67, 0x61, 0x6d, 0x61, 0x62, 0x62, 0x5f, 0x68, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x5f, 0x61, 0x5f, 0x62, 0x62, 0x5f, 0x62, 0x61, 0x63, 0x61, 0x62, 0x5f, 0x71, 0x81, 0x81, 0x77, 0x7b, 0x7b, 0x9d, 0xb5, 0xc7, 0x2b, 0xc5, 0x7b, 0x50, 0x74, 0x62, 0x6d, 0x62, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x71, 0x65, 0x68, 0x0e, 0x19, 0x1a, 0x19, 0x1b, 0x1b, 0x1a, 0x1b, 0x94, 0x8a, 0x71, 0x65, 0x65, 0x71, 0x68, 0x68, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x61, 0x77, 0xc2, 0x28, 0xf8, 0xf8, 0xf3, 0xc8, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xfb, 0xf8, 0xc8, 0x27, 0x96, 0x98, 0x98, 0x99, 0x95, 0x9b, 0x93, 0x80, 0x71, 0x68, 0x68, 0x6d, 0x71, 0x6d, 0x6d, 0x71, 0x76, 0x8d, 0x8d, 0x84, 0x8f, 0x8d, 0x86, 0x18, 0x20, 0x23, 0x24, 0x24, 0xba, 0x18, 0x5c, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x68, 0x68, 0x68, 0x65, 0x65, 0x6d, 0x61, 0x67, 0x61, 0x59, 0x55, 0x62, 0x66, 0x63, 0x63, 0x63, 0x61, 0x78, 0x6c, 0x76, 0x76, 0x7e, 0x76, 0x7e, 0x80, 0x76, 0x6d, 0x61, 0x5f, 0x62, 0x62, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x5f, 0x61, 0x67, 0x6a, 0x74, 0x7d, 0x71, 0x7d, 0x6a, 0x73, 0x6a, 0x6d, 0x5d, 0x4e, 0x5a, 0xb0, 0x27, 0x27, 0x0c, 0x57, 0x6d, 0x62, 0x6d, 0x68, 0x68, 0x62, 0x68, 0x68, 0x6f, 0x65, 0x71, 0x75, 0x18, 0x19, 0x19, 0x18, 0x1b, 0x1a, 0x18, 0x15, 0x90, 0x76, 0x62, 0x6d, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x66, 0x6d, 0x6d, 0x5b, 0xa8, 0x2a, 0xfb, 0xf8, 0xf8, 0xf5, 0xf4, 0xc8, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf4, 0xf3, 0xf9, 0xc9, 0xb3, 0x89, 0x99, 0x97, 0x99, 0x99, 0x99, 0x95, 0x95, 0x7e, 0x76, 0x6a, 0x61, 0x6a, 0x71, 0x81, 0x8c, 0x8f, 0x95, 0x8a, 0x98, 0x8f, 0x7f, 0x21, 0x21, 0x23, 0x24, 0x24, 0xba, 0x8e, 0x56, 0x6b, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x67, 0x61, 0x61, 0x61, 0x61, 0x67, 0x67, 0x67, 0x76, 0x76, 0x7e, 0x76, 0x7e, 0x7e, 0x7e, 0x7c, 0x7d, 0x80, 0x80, 0x7d, 0x61, 0x5f, 0x6a, 0x5f, 0x68, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x5f, 0x62, 0x68, 0x71, 0x74, 0x80, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x71, 0x71, 0x74, 0x6f, 0x76, 0x6a, 0x5d, 0x8a, 0xc5, 0xbe, 0x57, 0x5e, 0x62, 0x62, 0x6d, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x65, 0x6f, 0x09, 0x15, 0x19, 0x19, 0x1a, 0x1a, 0x1b, 0x1b, 0x97, 0x9c, 0x7c, 0x65, 0x6b, 0x6f, 0x68, 0x71, 0x6d, 0x6b, 0x71, 0x6b, 0x6b, 0x6f, 0x6b, 0x6d, 0x6b, 0x6f, 0x6d, 0x67, 0x6a, 0x6d, 0x6b, 0x6f, 0x6b, 0x5e, 0x5c, 0xbf, 0xfe, 0xf2, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xfb, 0xf5, 0xf5, 0xc9, 0xc5, 0x8e, 0x99, 0x94, 0x95, 0x94, 0x95, 0x99, 0x9e, 0x98, 0x95, 0x8d, 0x8a, 0x8d, 0x95, 0x95, 0x97, 0x97, 0x90, 0x98, 0x8a, 0x8f, 0x97, 0x1e, 0x20, 0x24, 0x23, 0xba, 0xbe, 0x5d, 0x5d, 0x6b, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x61, 0x67, 0x61, 0x67, 0x67, 0x67, 0x74, 0x76, 0x7d, 0x7c, 0x76, 0x7c, 0x7e, 0x7e, 0x80, 0x7c, 0x7e, 0x7d, 0x80, 0x80, 0x7d, 0x61, 0x5b, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x68, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x61, 0x68, 0x74, 0x7d, 0x7d, 0x74, 0x7d, 0x7d, 0x7d, 0x74, 0x76, 0x74, 0x71, 0x74, 0x7d, 0x6f, 0x71, 0x73, 0x5e, 0x5e, 0xb6, 0xab, 0x61, 0x62, 0x68, 0x6d, 0x68, 0x65, 0x68, 0x65, 0x68, 0x65, 0x71, 0x6c, 0x0e, 0x1d, 0x19, 0x1b, 0x1b, 0x1a, 0x18, 0xa1, 0x94, 0x8a, 0x5f, 0x6f, 0x6b, 0x71, 0x68, 0x6d, 0x71, 0x6b, 0x71, 0x6d, 0x6d, 0x6d, 0x6f, 0x65, 0x6d, 0x6f, 0x6a, 0x6d, 0x71, 0x6f, 0x66, 0x68, 0x69, 0xa5, 0xc9, 0xf4, 0xf4, 0xfd, 0xf9, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0x26, 0xf3, 0xf3, 0xd2, 0x29, 0xaf, 0x89, 0x95, 0x95, 0x95, 0x95, 0x95, 0x99, 0x98, 0x98, 0x95, 0x98, 0x98, 0x95, 0x8f, 0x8f, 0x8f, 0x93, 0x9b, 0x93, 0x97, 0x8e, 0xc0, 0x24, 0xfc, 0xfc, 0x25, 0xba, 0x58, 0x6a, 0x5f, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x67, 0x61, 0x63, 0x67, 0x74, 0x71, 0x74, 0x74, 0x7d, 0x7c, 0x7d, 0x7c, 0x80, 0x7c, 0x7c, 0x80, 0x7c, 0x80, 0x7d, 0x80, 0x7c, 0x5f, 0x61, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x68, 0x7d, 0x7d, 0x80, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x74, 0x7c, 0x74, 0x7d, 0x74, 0x71, 0x71, 0x71, 0x68, 0x73, 0x6a, 0x9e, 0x71, 0x6d, 0x6d, 0x62, 0x6d, 0x68, 0x6d, 0x68, 0x62, 0x6d, 0x6f, 0x6c, 0x75, 0x1d, 0x1b, 0x1a, 0x1a, 0x1b, 0x1b, 0xa1, 0x91, 0x95, 0x62, 0x68, 0x6b, 0x68, 0x68, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6f, 0x6b, 0x6f, 0x6d, 0x6f, 0x71, 0x71, 0x71, 0x6b, 0x6b, 0x81, 0x77, 0xbe, 0xc9, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0x26, 0xf8, 0xf3, 0xf5, 0xc9, 0xc2, 0x82, 0x98, 0x98, 0x99, 0x95, 0x95, 0x95, 0x95, 0x94, 0x9c, 0x94, 0x9c, 0x95, 0x95, 0x97, 0x95, 0x98, 0x93, 0x95, 0x89, 0xab, 0x29, 0x26, 0xc7, 0x25, 0x2a, 0xaf, 0x58, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x63, 0x67, 0x67, 0x67, 0x74, 0x71, 0x7d, 0x71, 0x7c, 0x7d, 0x7c, 0x7d, 0x7e, 0x80, 0x7c, 0x7c, 0x7c, 0x80, 0x80, 0x80, 0x80, 0x76, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x71, 0x71, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x76, 0x7d, 0x7c, 0x76, 0x7d, 0x71, 0x7d, 0x71, 0x74, 0x7c, 0x68, 0x71, 0x61, 0x68, 0x68, 0x6d, 0x6d, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x62, 0x6f, 0x6d, 0x6c, 0x09, 0x18, 0x1d, 0x1a, 0x1a, 0x20, 0x20, 0xa1, 0x94, 0x98, 0x7d, 0x62, 0x71, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x68, 0x6d, 0x71, 0x71, 0x90, 0x97, 0x96, 0xc7, 0xc8, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0x26, 0xf5, 0xf3, 0xf3, 0xf4, 0x27, 0xae, 0x8b, 0x94, 0x95, 0x99, 0x95, 0x9c, 0x95, 0x9c, 0x94, 0x9c, 0x95, 0x95, 0x97, 0x95, 0x90, 0x9b, 0x90, 0x94, 0x8e, 0xc2, 0x26, 0xfb, 0xf5, 0xfb, 0x29, 0xa5, 0x56, 0x67, 0x65, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x68, 0x62, 0x62, 0x6a, 0x65, 0x67, 0x63, 0x6a, 0x71, 0x71, 0x71, 0x7c, 0x71, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x80, 0x80, 0x7c, 0x80, 0x80, 0x7d, 0x80, 0x68, 0x62, 0x6d, 0x68, 0x62, 0x68, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x68, 0x62, 0x6d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x71, 0x7c, 0x76, 0x7d, 0x7c, 0x7c, 0x74, 0x71, 0x7c, 0x6f, 0x7d, 0x6b, 0x7d, 0x6b, 0x6f, 0x71, 0x6d, 0x68, 0x6d, 0x62, 0x6d, 0x68, 0x6d, 0x71, 0x5f, 0x71, 0x5e, 0x15, 0x1e, 0x1a, 0x20, 0x20, 0x24, 0x18, 0x94, 0x9e, 0x7e, 0x68, 0x68, 0x68, 0x62, 0x6d, 0x68, 0x6d, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x71, 0x84, 0x90, 0x9e, 0x95, 0x87, 0xb7, 0xca, 0x26, 0xf4, 0xfb, 0xf6, 0xfb, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf4, 0xf3, 0xf3, 0xf2, 0xca, 0xc0, 0x82, 0x99, 0x99, 0x95, 0x94, 0x99, 0x94, 0x98, 0x94, 0x9c, 0x94, 0x95, 0x95, 0x97, 0x98, 0x90, 0x98, 0x89, 0xaa, 0x27, 0xfb, 0xf2, 0xf2, 0xd2, 0xc9, 0x87, 0x5d, 0x61, 0x65, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x68, 0x62, 0x6a, 0x6d, 0x61, 0x61, 0x67, 0x76, 0x7e, 0x83, 0x83, 0x83, 0x8a, 0x80, 0x7e, 0x80, 0x7c, 0x7c, 0x7e, 0x80, 0x7e, 0x80, 0x7c, 0x7e, 0x80, 0x80, 0x7d, 0x62, 0x6d, 0x6d, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x68, 0x62, 0x68, 0x71, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x71, 0x7c, 0x71, 0x71, 0x71, 0x6f, 0x7d, 0x6f, 0x6b, 0x6d, 0x71, 0x6d, 0x6d, 0x6d, 0x68, 0x62, 0x62, 0x62, 0x6b, 0x68, 0x71, 0x6c, 0x0c, 0x1f, 0x20, 0x23, 0x23, 0x23, 0xa1, 0x94, 0x94, 0x8d, 0x62, 0x68, 0x71, 0x71, 0x6a, 0x62, 0x68, 0x71, 0x68, 0x62, 0x5e, 0x71, 0x71, 0x7c, 0x88, 0x9b, 0x9b, 0x98, 0x98, 0x97, 0x96, 0xc6, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf9, 0xfb, 0xf4, 0xf8, 0xf3, 0xf9, 0x29, 0xae, 0x8e, 0x95, 0x99, 0x99, 0x99, 0x95, 0x9c, 0x98, 0x95, 0x98, 0x95, 0x97, 0x95, 0x98, 0x9c, 0x8c, 0x7b, 0xc6, 0xc8, 0x26, 0xf2, 0xd2, 0xd2, 0xc7, 0x5c, 0x5e, 0x62, 0x67, 0x61, 0x6d, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6a, 0x68, 0x61, 0x6a, 0x61, 0x76, 0x86, 0x8d, 0x8f, 0x90, 0x90, 0x95, 0x90, 0x95, 0x95, 0x90, 0x8a, 0x83, 0x7e, 0x78, 0x80, 0x7c, 0x80, 0x80, 0x80, 0x80, 0x80, 0x68, 0x5f, 0x62, 0x62, 0x68, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x71, 0x80, 0x7d, 0x80, 0x7c, 0x7c, 0x7c, 0x7c, 0x80, 0x7c, 0x80, 0x84, 0x84, 0x8a, 0x84, 0x8a, 0x8a, 0x83, 0x83, 0x80, 0x7c, 0x71, 0x71, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x68, 0x6d, 0x62, 0x62, 0x68, 0x62, 0x68, 0x66, 0x74, 0x5f, 0x73, 0x21, 0x23, 0x23, 0x23, 0x23, 0x20, 0x8b, 0x98, 0x9e, 0x6a, 0x68, 0x68, 0x6a, 0x62, 0x68, 0x68, 0x68, 0x71, 0x80, 0x84, 0x90, 0x9b, 0x9e, 0x9b, 0x95, 0x95, 0x95, 0x97, 0x89, 0xb5, 0xca, 0xf2, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf4, 0x26, 0x26, 0xf9, 0xf2, 0xf5, 0x28, 0xc2, 0x8e, 0x99, 0x99, 0x99, 0x94, 0x98, 0x95, 0x98, 0x98, 0x95, 0x95, 0x99, 0x95, 0x99, 0x99, 0x82, 0xae, 0x2a, 0xf2, 0xfb, 0xf4, 0xd2, 0xcf, 0xc0, 0x57, 0x6c, 0x71, 0x67, 0x62, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x6d, 0x5f, 0x62, 0x71, 0x5e, 0x5e, 0x7e, 0x8a, 0x95, 0x8f, 0x8a, 0x8b, 0x8f, 0x91, 0x8f, 0x8a, 0x8f, 0x90, 0x95, 0x8f, 0x83, 0x80, 0x78, 0x7c, 0x7c, 0x80, 0x80, 0x7e, 0x84, 0x74, 0x62, 0x62, 0x6d, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x68, 0x68, 0x7d, 0x80, 0x7d, 0x7c, 0x80, 0x7c, 0x80, 0x7c, 0x83, 0x83, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x84, 0x7c, 0x71, 0x62, 0x71, 0x6f, 0x71, 0x6d, 0x6d, 0x6d, 0x62, 0x68, 0x62, 0x62, 0x68, 0x68, 0x65, 0x63, 0x5e, 0x20, 0x23, 0x23, 0x23, 0x23, 0xab, 0x0e, 0x9e, 0x9e, 0x88, 0x5e, 0x6d, 0x61, 0x71, 0x7c, 0x7e, 0x8a, 0x98, 0x9b, 0x9b, 0x9c, 0x98, 0x98, 0x98, 0x95, 0x95, 0x99, 0x94, 0x8e, 0xc6, 0xc9, 0xf0, 0xf8, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0x26, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf8, 0x26, 0x26, 0x26, 0xf5, 0xf2, 0xf4, 0x2a, 0xb3, 0x8b, 0x9c, 0x99, 0x98, 0x95, 0x98, 0x98, 0x98, 0x98, 0x95, 0x95, 0x95, 0x94, 0x90, 0x9d, 0xc5, 0xcf, 0xf8, 0x26, 0xfb, 0xd2, 0xc8, 0xb5, 0x5d, 0x68, 0x71, 0x67, 0x62, 0x6d, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x61, 0x6a, 0x83, 0x98, 0x94, 0x90, 0x8b, 0x7f, 0x82, 0x7f, 0x82, 0x81, 0x77, 0x81, 0x81, 0x89, 0x8f, 0x98, 0x8a, 0x83, 0x80, 0x80, 0x80, 0x80, 0x7c, 0x80, 0x80, 0x68, 0x62, 0x68, 0x5f, 0x62, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x61, 0x62, 0x71, 0x80, 0x7d, 0x7c, 0x80, 0x7c, 0x7c, 0x80, 0x8a, 0x8a, 0x84, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x8a, 0x90, 0x8a, 0x8a, 0x84, 0x7e, 0x6a, 0x6d, 0x6d, 0x6d, 0x68, 0x6d, 0x62, 0x68, 0x62, 0x68, 0x68, 0x6b, 0x65, 0x5f, 0x5d, 0x1f, 0x23, 0x23, 0xfc, 0x24, 0x24, 0x8b, 0x94, 0x9e, 0x93, 0x7e, 0x84, 0x8d, 0x98, 0x98, 0x9b, 0x9b, 0x98, 0x95, 0x98, 0x95, 0x9c, 0x98, 0x99, 0x99, 0x99, 0x97, 0x89, 0xaf, 0x29, 0x26, 0xf3, 0xf5, 0xfb, 0xf4, 0xfb, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0xc7, 0x9d, 0x94, 0x9b, 0x98, 0x98, 0x97, 0x95, 0x93, 0x9b, 0x90, 0x98, 0x94, 0x99, 0x82, 0xb7, 0xc9, 0xd2, 0xf3, 0xd2, 0xf2, 0xf9, 0xc9, 0xaf, 0x56, 0x6d, 0x6b, 0x6a, 0x6b, 0x68, 0x6d, 0x6d, 0x67, 0x62, 0x67, 0x5f, 0x6f, 0x62, 0x61, 0x56, 0x81, 0x97, 0x94, 0x8b, 0x82, 0x96, 0xa8, 0xb4, 0xb9, 0xbf, 0xc0, 0xb9, 0xb4, 0xaa, 0x96, 0x82, 0x8b, 0x95, 0x86, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x80, 0x71, 0x5f, 0x68, 0x5f, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x68, 0x7c, 0x80, 0x7d, 0x7c, 0x80, 0x80, 0x83, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x81, 0x81, 0x7f, 0x81, 0x7f, 0x81, 0x7f, 0x8a, 0x90, 0x88, 0x93, 0x8a, 0x8f, 0x76, 0x61, 0x6a, 0x6d, 0x61, 0x65, 0x62, 0x62, 0x62, 0x62, 0x65, 0x6b, 0x6b, 0x61, 0x56, 0xaf, 0xc3, 0x25, 0xfb, 0xc6, 0xc6, 0x96, 0x94, 0x98, 0x99, 0x97, 0x99, 0x98, 0x9b, 0x95, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x95, 0x97, 0x94, 0x98, 0x95, 0x96, 0xc3, 0x28, 0xfa, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0x2a, 0xba, 0x82, 0x9e, 0x93, 0x95, 0x97, 0x97, 0x98, 0x93, 0x9e, 0x90, 0x94, 0x8e, 0xa5, 0x29, 0xc8, 0xf2, 0xf3, 0xcf, 0xf2, 0xfb, 0x27, 0xa5, 0x59, 0x6e, 0x6d, 0x68, 0x68, 0x6b, 0x68, 0x6d, 0x62, 0x62, 0x62, 0x6d, 0x6d, 0x61, 0x72, 0xab, 0x9d, 0x82, 0x8e, 0xaa, 0xbe, 0xc7, 0x29, 0x2b, 0x2b, 0xca, 0x2b, 0x2b, 0x29, 0x29, 0xc6, 0xb7, 0x9d, 0x82, 0x97, 0x86, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x83, 0x71, 0x5f, 0x62, 0x62, 0x65, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5e, 0x6a, 0x80, 0x7c, 0x80, 0x80, 0x78, 0x8a, 0x83, 0x8a, 0x83, 0x8a, 0x73, 0x77, 0x8e, 0x9d, 0xaa, 0xaa, 0xaa, 0xa5, 0x9d, 0x82, 0x77, 0x86, 0x95, 0x90, 0x90, 0x90, 0x71, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x65, 0x6b, 0x6c, 0x68, 0x52, 0xae, 0x29, 0xfa, 0xfb, 0xfb, 0x29, 0xaa, 0x97, 0x98, 0x99, 0x99, 0x97, 0x98, 0x98, 0x99, 0x95, 0x99, 0x95, 0x99, 0x95, 0x99, 0x95, 0x99, 0x99, 0x95, 0x9e, 0x81, 0xb0, 0x2a, 0xf2, 0xf8, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xc9, 0xae, 0x8e, 0x99, 0x95, 0x95, 0x95, 0x94, 0x98, 0x90, 0x95, 0x96, 0x9d, 0x25, 0x27, 0xfb, 0xd2, 0xcf, 0xd2, 0xef, 0x26, 0x27, 0x87, 0x67, 0x65, 0x6d, 0x68, 0x68, 0x68, 0x6d, 0x62, 0x62, 0x71, 0x61, 0x68, 0x68, 0x68, 0x73, 0xc5, 0x9d, 0xac, 0xc2, 0x29, 0x2a, 0xff, 0xff, 0x2a, 0xfd, 0xc8, 0xd2, 0xc8, 0xff, 0xca, 0x29, 0x29, 0xc6, 0xb3, 0x8e, 0x8c, 0x8d, 0x80, 0x80, 0x80, 0x84, 0x80, 0x7c, 0x62, 0x68, 0x5f, 0x6d, 0x5f, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x68, 0x7c, 0x7c, 0x80, 0x7d, 0x83, 0x84, 0x83, 0x8f, 0x86, 0x77, 0x8e, 0xb3, 0xbe, 0xc6, 0x27, 0xc9, 0x29, 0xca, 0x29, 0x27, 0xc2, 0xb5, 0xa5, 0x82, 0x8c, 0x93, 0x9b, 0x84, 0x62, 0x62, 0x74, 0x6b, 0x66, 0x6b, 0x62, 0x62, 0x65, 0x6d, 0x6b, 0x68, 0x52, 0xaa, 0xc9, 0xfb, 0xfb, 0xd2, 0xc7, 0xbe, 0x8e, 0x98, 0x9c, 0x95, 0x99, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x95, 0x99, 0x95, 0x9c, 0x8f, 0x96, 0xc6, 0xc8, 0xf2, 0xf2, 0xfa, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xfe, 0xc1, 0x87, 0x8f, 0x9c, 0x95, 0x98, 0x95, 0x95, 0x98, 0x97, 0x82, 0xb7, 0x29, 0xd2, 0xc8, 0xf9, 0xd2, 0xf2, 0xf4, 0x28, 0xc3, 0x7b, 0x67, 0x6d, 0x65, 0x68, 0x6a, 0x6d, 0x62, 0x6d, 0x66, 0x5e, 0x5f, 0xa6, 0x6c, 0x5d, 0x5d, 0xb7, 0x25, 0x28, 0xff, 0xff, 0xff, 0xbd, 0x9a, 0xcc, 0xcb, 0x2d, 0xd5, 0xcb, 0xd0, 0xa7, 0xed, 0xff, 0x29, 0x2b, 0xba, 0x9d, 0x86, 0x88, 0x83, 0x80, 0x83, 0x84, 0x83, 0x62, 0x6d, 0x62, 0x65, 0x62, 0x62, 0x68, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x62, 0x6a, 0x7c, 0x80, 0x7d, 0x80, 0x8a, 0x86, 0x86, 0x77, 0x7b, 0xaf, 0xc5, 0x29, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xca, 0x27, 0xb9, 0x97, 0x81, 0x93, 0x8a, 0x6a, 0x5b, 0x5f, 0x66, 0x5f, 0x66, 0x62, 0x62, 0x63, 0x6b, 0x68, 0x68, 0x55, 0xa5, 0x27, 0x26, 0xf2, 0xf2, 0xf2, 0x27, 0xa8, 0x8c, 0x98, 0x9b, 0x99, 0x95, 0x99, 0x95, 0x99, 0x95, 0x99, 0x95, 0x99, 0x95, 0x99, 0x98, 0x98, 0x98, 0x8e, 0xb0, 0x2a, 0xd2, 0xf6, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0x2b, 0xb5, 0x82, 0x98, 0x98, 0x9c, 0x95, 0x99, 0x97, 0x82, 0xb5, 0x2a, 0x26, 0xf2, 0xf4, 0xd2, 0xc8, 0xf4, 0xfb, 0xca, 0xbe, 0x64, 0x62, 0x6d, 0x6d, 0x6a, 0x61, 0x62, 0x6d, 0x6b, 0x62, 0x68, 0x57, 0xab, 0xb6, 0x64, 0xa8, 0xc6, 0xfe, 0xff, 0xf1, 0xce, 0xcb, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd8, 0xec, 0xca, 0x29, 0xc5, 0x8c, 0x8b, 0x84, 0x83, 0x80, 0x84, 0x84, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x71, 0x80, 0x80, 0x7c, 0x83, 0x7e, 0x81, 0x7b, 0x96, 0xc5, 0xff, 0x2a, 0xc1, 0xce, 0xdc, 0xd1, 0xcc, 0xcc, 0xd0, 0x9a, 0xe9, 0xc4, 0xf1, 0x2b, 0x2b, 0x27, 0xb3, 0x89, 0x8e, 0x7f, 0x8f, 0x68, 0x5f, 0x6b, 0x66, 0x62, 0x62, 0x65, 0x62, 0x6b, 0x68, 0x55, 0x9f, 0x29, 0xfb, 0xfb, 0xf5, 0xf2, 0xca, 0xba, 0x8e, 0x9c, 0x98, 0x9b, 0x97, 0x99, 0x95, 0x99, 0x95, 0x99, 0x95, 0x99, 0x95, 0x99, 0x95, 0x9b, 0x94, 0x9f, 0xc6, 0xd2, 0xf5, 0xf2, 0xf6, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xfb, 0x27, 0xaa, 0x81, 0x9c, 0x90, 0xa3, 0x97, 0x7b, 0xae, 0x29, 0x26, 0xf8, 0xf5, 0xf5, 0xd2, 0xc8, 0xf2, 0x26, 0xca, 0xb5, 0x5c, 0x6a, 0x6b, 0x6d, 0x67, 0x61, 0x67, 0x65, 0x6b, 0x5f, 0x5e, 0x5d, 0x0c, 0xc2, 0xc2, 0xc6, 0x2b, 0xff, 0xf7, 0xd0, 0xcd, 0xcd, 0x2c, 0x2c, 0xd3, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd3, 0x9a, 0x2b, 0x29, 0xba, 0x77, 0x7f, 0x84, 0x83, 0x84, 0x84, 0x71, 0x62, 0x6d, 0x65, 0x62, 0x62, 0x68, 0x5f, 0x62, 0x5f, 0x62, 0x5f, 0x68, 0x62, 0x6d, 0x6d, 0x71, 0x80, 0x7c, 0x84, 0x86, 0x81, 0x64, 0x9f, 0xc6, 0x2b, 0xbd, 0xdc, 0xd5, 0xd3, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd5, 0xdc, 0xf2, 0xff, 0x2a, 0x29, 0xbc, 0x64, 0xb3, 0xbb, 0x5e, 0x68, 0x5f, 0x6b, 0x5f, 0x6d, 0x63, 0x62, 0x68, 0x62, 0x55, 0x96, 0x27, 0xfb, 0xf2, 0xf2, 0xf2, 0x28, 0xc7, 0x9d, 0x8f, 0x95, 0x98, 0x99, 0x99, 0x97, 0x95, 0x99, 0x95, 0x99, 0x8f, 0x99, 0x99, 0x98, 0x95, 0x82, 0xb5, 0x2a, 0xf2, 0xf3, 0xf5, 0xf4, 0x26, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xfd, 0x26, 0x27, 0xae, 0x89, 0x96, 0x82, 0x85, 0xbc, 0x29, 0x26, 0x26, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0xfa, 0x26, 0x2a, 0xaa, 0x59, 0x68, 0x6f, 0x68, 0x67, 0x67, 0x67, 0x6d, 0x5f, 0x6d, 0xb2, 0x81, 0x53, 0xaa, 0x2a, 0xff, 0xf1, 0xbd, 0xd5, 0xcd, 0x2c, 0x2c, 0xcd, 0xd3, 0xd3, 0xd6, 0xd0, 0xdc, 0xe4, 0x9a, 0xd1, 0xcb, 0xd3, 0xcd, 0xcd, 0xd0, 0xc4, 0x29, 0xae, 0x77, 0x86, 0x80, 0x84, 0x80, 0x71, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x68, 0x62, 0x7d, 0x80, 0x80, 0x80, 0x81, 0x77, 0x87, 0x2a, 0xc4, 0xd0, 0xd3, 0xcd, 0xcd, 0xd3, 0xcd, 0xcd, 0xcd, 0x2c, 0x2c, 0x2c, 0x2c, 0xcd, 0xcd, 0xcd, 0x9a, 0xf1, 0x2b, 0xff, 0xc6, 0xc2, 0x7b, 0x69, 0x69, 0x5f, 0x71, 0x5f, 0x62, 0x5b, 0x62, 0x5f, 0x6b, 0x55, 0x87, 0x27, 0xfa, 0xfb, 0xf2, 0xf5, 0xfb, 0x2a, 0xb9, 0x8e, 0x97, 0x95, 0x95, 0x97, 0x98, 0x99, 0x95, 0x99, 0x95, 0x99, 0x98, 0x99, 0x99, 0x97, 0xa5, 0xc9, 0xfb, 0xf5, 0xf4, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xf2, 0xf6, 0x28, 0x27, 0xb7, 0xac, 0xb0, 0xc0, 0x2a, 0xc8, 0xfb, 0xf9, 0xf8, 0xf5, 0xf4, 0xf4, 0xf4, 0xf8, 0x26, 0xc9, 0x96, 0x5d, 0x71, 0x6b, 0x68, 0x67, 0x6a, 0x67, 0x66, 0x65, 0x5f, 0xab, 0xbb, 0xac, 0xbc, 0xff, 0x2b, 0xf2, 0xd5, 0xcd, 0x2c, 0x2c, 0xcd, 0xd3, 0xd8, 0xde, 0xe5, 0xeb, 0xee, 0xee, 0xf2, 0xee, 0xed, 0xe9, 0xd8, 0xcd, 0xcd, 0xd1, 0x2a, 0xc0, 0x7b, 0x81, 0x80, 0x80, 0x84, 0x71, 0x62, 0x62, 0x65, 0x62, 0x62, 0x68, 0x62, 0x5f, 0x62, 0x5f, 0x68, 0x62, 0x6d, 0x5f, 0x6d, 0x7d, 0x80, 0x80, 0x80, 0x7f, 0x7b, 0xc0, 0xbf, 0xd8, 0x2c, 0xd4, 0xcc, 0xdb, 0xdc, 0xdc, 0xd1, 0xcb, 0x2d, 0xcd, 0xcd, 0x2c, 0x2c, 0xcd, 0xcd, 0xcd, 0xd1, 0xf2, 0xff, 0x2b, 0xc6, 0x92, 0x7b, 0x52, 0x9e, 0x71, 0x61, 0x61, 0x63, 0x61, 0x6b, 0x5f, 0x5b, 0x79, 0x27, 0xfb, 0xf2, 0x26, 0x26, 0xf2, 0xfb, 0x27, 0x9f, 0x97, 0x99, 0x8f, 0x95, 0x95, 0x95, 0x95, 0x95, 0x98, 0x99, 0x95, 0x99, 0x8f, 0x82, 0xc0, 0xc9, 0xf2, 0xf4, 0xf4, 0x26, 0xd2, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xc8, 0xf3, 0xf0, 0xf3, 0xfb, 0x2b, 0x29, 0xca, 0xfe, 0xef, 0xf4, 0xf4, 0xfb, 0xf8, 0xf4, 0xf4, 0xf4, 0xd2, 0xfa, 0x26, 0xc6, 0x79, 0x5d, 0x6f, 0x6b, 0x68, 0x67, 0x67, 0x67, 0x62, 0x6f, 0x6d, 0x56, 0x7b, 0xc6, 0x2b, 0xca, 0xf7, 0xcc, 0xcd, 0x2c, 0x2c, 0xcd, 0xd6, 0xde, 0xe7, 0xe8, 0xeb, 0xee, 0xee, 0xee, 0xf3, 0xd2, 0xf3, 0xf3, 0xc4, 0xad, 0xd4, 0xcd, 0xe4, 0x27, 0xa5, 0x7e, 0x84, 0x80, 0x84, 0x7d, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x5f, 0x62, 0x62, 0x62, 0x6d, 0x68, 0x6d, 0x62, 0x62, 0x84, 0x80, 0x88, 0x7f, 0x69, 0xb3, 0xc7, 0xd5, 0xd5, 0xe4, 0xc4, 0xf7, 0xf7, 0xf1, 0xf0, 0xf0, 0xee, 0xec, 0xe4, 0xd0, 0xd3, 0xcd, 0xcd, 0x2c, 0x2c, 0xcd, 0xcc, 0xf2, 0xf1, 0xff, 0x29, 0x9f, 0xab, 0xab, 0x62, 0x5b, 0x6a, 0x63, 0x61, 0x5f, 0x6b, 0x5b, 0x79, 0xc6, 0xfa, 0xf2, 0xfb, 0xc9, 0xfb, 0xf2, 0x28, 0xbe, 0x8e, 0x8f, 0x99, 0x95, 0x95, 0x95, 0x95, 0x95, 0x99, 0x99, 0x98, 0x95, 0x8c, 0xb0, 0x29, 0xc8, 0xf5, 0xf2, 0x26, 0x26, 0xcf, 0xf3, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf5, 0xf3, 0xf5, 0xf5, 0x26, 0xf9, 0xcf, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf8, 0xc8, 0xc0, 0x69, 0x71, 0x6b, 0x6d, 0x6d, 0x67, 0x63, 0x62, 0x6b, 0x65, 0x88, 0x77, 0x64, 0xc7, 0x2b, 0xff, 0xe4, 0xcd, 0x2c, 0x2c, 0xd3, 0xd6, 0xe8, 0xea, 0xe7, 0xe0, 0xeb, 0xee, 0xed, 0xfb, 0xe9, 0xcc, 0xd8, 0xe4, 0xf0, 0xf7, 0xed, 0xd0, 0xd5, 0xbd, 0xb4, 0x77, 0x88, 0x80, 0x84, 0x71, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x68, 0x68, 0x84, 0x7d, 0x80, 0x73, 0x8e, 0xc6, 0x60, 0xcc, 0xed, 0xf1, 0xf7, 0xcf, 0xf1, 0xd2, 0xed, 0xec, 0xed, 0xee, 0xed, 0xec, 0xe5, 0xd9, 0xd3, 0xd3, 0x2c, 0xcd, 0xcd, 0xd1, 0xf1, 0x28, 0xff, 0xc1, 0xc5, 0x89, 0x55, 0x5f, 0x61, 0x61, 0x62, 0x68, 0x63, 0x5b, 0x64, 0xc6, 0xfa, 0xf2, 0xcf, 0xfb, 0xf8, 0xf5, 0xfb, 0xc9, 0xae, 0x89, 0x95, 0x95, 0x95, 0x94, 0x95, 0x94, 0x98, 0x97, 0x9c, 0x8e, 0xa1, 0xc7, 0xc8, 0xf4, 0xf4, 0xf4, 0xc8, 0xf4, 0xf4, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xca, 0xb5, 0x5d, 0x71, 0x6f, 0x6d, 0x6d, 0x62, 0x63, 0x62, 0x71, 0x66, 0x88, 0x86, 0xae, 0x29, 0x28, 0xd2, 0xd5, 0xcd, 0x2c, 0xcd, 0xd6, 0xe8, 0xea, 0xe7, 0xe0, 0xdd, 0xe0, 0xed, 0xf3, 0xad, 0xcd, 0xcd, 0xcd, 0x2c, 0xf3, 0xf7, 0xf1, 0xcf, 0xd8, 0xdc, 0xbc, 0x79, 0x80, 0x80, 0x84, 0x71, 0x62, 0x6d, 0x62, 0x6b, 0x68, 0x6b, 0x68, 0x62, 0x62, 0x62, 0x62, 0x61, 0x68, 0x61, 0x71, 0x80, 0x80, 0x80, 0x69, 0xb5, 0xa7, 0xcc, 0xf3, 0xf1, 0xf1, 0xfe, 0xbd, 0xe9, 0xbd, 0xf1, 0xce, 0xe9, 0xe9, 0xed, 0xee, 0xeb, 0xe8, 0xde, 0xd3, 0xcd, 0x2c, 0xcd, 0xcd, 0xce, 0xff, 0xf1, 0xff, 0xa5, 0x4e, 0x5b, 0x6b, 0x7d, 0x62, 0x68, 0x5f, 0x62, 0x59, 0x64, 0xc6, 0xfa, 0xf2, 0xd2, 0xfb, 0xf4, 0xf2, 0xd2, 0x28, 0xc7, 0x87, 0x97, 0x8f, 0x8f, 0x95, 0x95, 0x98, 0x9c, 0x8f, 0x9d, 0x77, 0xbe, 0xfe, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0x29, 0xa8, 0x56, 0x6d, 0x6f, 0x6d, 0x6d, 0x67, 0x6e, 0x62, 0x71, 0x5f, 0x63, 0x8c, 0xc0, 0x2a, 0xf1, 0xad, 0xcd, 0x2c, 0xd3, 0xcd, 0xe8, 0xeb, 0xe3, 0xdd, 0xe0, 0xe9, 0xeb, 0xed, 0xff, 0xd0, 0xcd, 0xcd, 0xcd, 0xd5, 0xf6, 0xff, 0xf6, 0xff, 0xec, 0xd0, 0xb8, 0x8e, 0x83, 0x80, 0x80, 0x71, 0x62, 0x6b, 0x62, 0x62, 0x68, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x68, 0x71, 0x80, 0x83, 0x72, 0x7b, 0xb9, 0xd0, 0xed, 0xff, 0xf7, 0xed, 0xcb, 0xcd, 0xcd, 0xcd, 0x9a, 0xff, 0xf6, 0xee, 0xed, 0xec, 0xeb, 0xe8, 0xe8, 0xdb, 0xd3, 0x2c, 0xcd, 0xcd, 0xcb, 0xf6, 0xf7, 0xff, 0xa8, 0xab, 0xa4, 0x8d, 0x61, 0x61, 0x5f, 0x62, 0x61, 0x63, 0x5c, 0xc2, 0x28, 0xd2, 0xd2, 0xf4, 0xf4, 0xf3, 0xf4, 0xd2, 0x29, 0xbe, 0x82, 0x97, 0x95, 0x90, 0x98, 0x93, 0x95, 0x97, 0x87, 0xb0, 0x29, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xc7, 0x8e, 0x5d, 0x6f, 0x6d, 0x6d, 0x62, 0x6d, 0x63, 0x6d, 0x68, 0x62, 0x5b, 0x82, 0xc5, 0x29, 0xff, 0xd0, 0xcd, 0x2c, 0xd3, 0xd8, 0xeb, 0xe7, 0xea, 0xe8, 0xec, 0xee, 0xf0, 0xf1, 0xff, 0xb8, 0xcd, 0xcd, 0xcd, 0xe4, 0xff, 0xfe, 0xfe, 0xf6, 0xff, 0xdc, 0xad, 0x9d, 0x7f, 0x7e, 0x80, 0x6d, 0x62, 0x62, 0x62, 0x6b, 0x68, 0x6b, 0x68, 0x62, 0x62, 0x62, 0x62, 0x61, 0x68, 0x61, 0x71, 0x83, 0x78, 0x72, 0xa5, 0x9a, 0xb1, 0xff, 0xf7, 0xff, 0xad, 0xcd, 0x2c, 0xcd, 0xcd, 0xd5, 0xf3, 0xf6, 0xf1, 0xdc, 0xd5, 0xdb, 0xea, 0xe3, 0xe8, 0xd9, 0xcd, 0xcd, 0x2c, 0xcd, 0xbd, 0xf1, 0xff, 0xc6, 0xb6, 0x80, 0x5b, 0x61, 0x61, 0x61, 0x61, 0x62, 0x63, 0x51, 0xc0, 0x28, 0xf5, 0xd2, 0xc8, 0xf4, 0xf4, 0xf5, 0xfb, 0x26, 0x29, 0xb5, 0x7b, 0x8c, 0x95, 0x93, 0x98, 0x98, 0x82, 0xa5, 0xc7, 0xc8, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xca, 0xc0, 0x5c, 0x71, 0x6b, 0x6d, 0x6d, 0x6a, 0x62, 0x63, 0x6d, 0x68, 0x67, 0x5b, 0x79, 0xc5, 0xff, 0xee, 0x2c, 0x2c, 0xcd, 0xd4, 0xe7, 0xea, 0xe7, 0xea, 0xee, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0x2b, 0xfb, 0xce, 0xc4, 0xff, 0xfe, 0xfd, 0xfe, 0xf7, 0xff, 0xb8, 0x9a, 0xa5, 0x7f, 0x7e, 0x80, 0x68, 0x62, 0x62, 0x62, 0x5f, 0x68, 0x68, 0x62, 0x62, 0x62, 0x6d, 0x61, 0x5f, 0x62, 0x68, 0x68, 0x88, 0x78, 0x64, 0xac, 0xd1, 0xf7, 0xf1, 0xf6, 0xff, 0xc4, 0xd5, 0xcd, 0xcd, 0xcd, 0x9a, 0xff, 0xf7, 0xff, 0x9a, 0xcd, 0xd4, 0xe3, 0xe6, 0xe2, 0xe8, 0xd4, 0xcd, 0x2c, 0xcd, 0xdc, 0xff, 0xff, 0xb9, 0x52, 0x5e, 0x61, 0x6a, 0x63, 0x61, 0x68, 0x61, 0x63, 0x52, 0xbe, 0xc9, 0xef, 0xd2, 0xc8, 0xd2, 0xf5, 0xf5, 0xf5, 0x26, 0x26, 0x2b, 0xb4, 0x8e, 0x82, 0x97, 0x99, 0x82, 0x9d, 0xc6, 0xf1, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xc9, 0xb3, 0x58, 0x6d, 0x6d, 0x65, 0x6d, 0x6a, 0x6d, 0x65, 0x67, 0x68, 0x61, 0x63, 0x64, 0xc5, 0xff, 0xed, 0xcd, 0x2c, 0xcd, 0xd6, 0xea, 0xe7, 0xe6, 0xeb, 0xf1, 0xf7, 0xf1, 0xf1, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xfe, 0x2a, 0xfe, 0xff, 0xee, 0x9a, 0x9f, 0x81, 0x7f, 0x7d, 0x6a, 0x5f, 0x62, 0x62, 0x62, 0x5f, 0x68, 0x68, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x68, 0x71, 0x83, 0x78, 0x7b, 0x9a, 0xe4, 0xf1, 0xf1, 0xf1, 0xfe, 0xff, 0xce, 0x2c, 0xcd, 0xcb, 0xf0, 0xf1, 0xf1, 0xff, 0xf3, 0xdc, 0xd3, 0xdd, 0xe7, 0xe2, 0xe7, 0xd9, 0xcd, 0x2c, 0xcd, 0xcc, 0xff, 0xff, 0xbc, 0x5c, 0x5e, 0x65, 0x61, 0x63, 0x61, 0x61, 0x68, 0x63, 0x4e, 0xb7, 0xc9, 0xf9, 0xd2, 0xd2, 0xf4, 0xd2, 0xf5, 0xf8, 0xf9, 0xfa, 0x26, 0x29, 0xbc, 0x9d, 0x7b, 0x7b, 0xaa, 0xc2, 0x2a, 0xf5, 0xf3, 0xf3, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0x27, 0x87, 0x5d, 0x71, 0x6f, 0x6d, 0x6d, 0x6a, 0x6d, 0x63, 0x61, 0x68, 0x61, 0x63, 0x64, 0xc2, 0xff, 0xce, 0xcd, 0x2c, 0xcd, 0xd9, 0xea, 0xe7, 0xe6, 0xed, 0xff, 0xf1, 0xf7, 0xfe, 0xf1, 0xfe, 0xfe, 0xfe, 0xf1, 0xfe, 0xf1, 0xfe, 0xfe, 0xfe, 0xf7, 0xf1, 0xfd, 0xa7, 0x96, 0x77, 0x7c, 0x7c, 0x68, 0x62, 0x62, 0x62, 0x5f, 0x61, 0x6b, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5f, 0x61, 0x71, 0x80, 0x71, 0x92, 0x7a, 0xed, 0xf1, 0xf1, 0xfe, 0x2b, 0xf1, 0xff, 0xff, 0xc4, 0xff, 0x2b, 0xf1, 0xf7, 0xf7, 0xff, 0xf1, 0xf1, 0xe8, 0xe2, 0xe6, 0xe6, 0xde, 0xd3, 0x2c, 0xcd, 0xd5, 0xf1, 0xff, 0xbc, 0x5c, 0x61, 0x68, 0x67, 0x63, 0x63, 0x6c, 0x68, 0x65, 0x52, 0xaf, 0xc9, 0xf2, 0xef, 0xf4, 0xef, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0x26, 0x29, 0xc7, 0xc2, 0x25, 0x29, 0x29, 0xfb, 0xf8, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0xc0, 0x64, 0x76, 0x65, 0x6e, 0x6d, 0x67, 0x6a, 0x6d, 0x67, 0x67, 0x68, 0x61, 0x63, 0x52, 0xbe, 0xff, 0xce, 0xcd, 0x2c, 0xcd, 0xdb, 0xea, 0xe7, 0xe6, 0xee, 0xf1, 0x2a, 0xfe, 0xf1, 0xfe, 0xf1, 0xfe, 0xf1, 0xfe, 0xfe, 0xf1, 0xf7, 0xfe, 0x2a, 0xfe, 0xf1, 0xf1, 0xa2, 0x92, 0x72, 0x7e, 0x71, 0x62, 0x61, 0x5f, 0x62, 0x62, 0x68, 0x68, 0x5f, 0x61, 0x62, 0x61, 0x62, 0x61, 0x61, 0x68, 0x71, 0x7d, 0x76, 0x85, 0xdc, 0xd2, 0xf1, 0xfe, 0x2a, 0xfe, 0xfe, 0xf1, 0xf1, 0xff, 0xf7, 0xf1, 0xfe, 0xf1, 0xfe, 0xfe, 0xfe, 0xff, 0xec, 0xe3, 0xe2, 0xe3, 0xe3, 0xd4, 0xcd, 0xcd, 0xd5, 0xfe, 0xff, 0xb5, 0x56, 0x61, 0x65, 0x61, 0x63, 0x5b, 0x6a, 0x68, 0x5f, 0x59, 0xa5, 0x2a, 0xfb, 0xef, 0xd2, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf9, 0xc8, 0xfd, 0xc8, 0x26, 0xfb, 0xf9, 0xf8, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xaa, 0x5c, 0x6a, 0x6b, 0x6f, 0x6f, 0x62, 0x6a, 0x6a, 0x63, 0x67, 0x5e, 0x62, 0x67, 0x52, 0xb5, 0x2b, 0xce, 0xcd, 0xcd, 0xcd, 0xdb, 0xea, 0xe7, 0xe3, 0xee, 0x2b, 0x2a, 0xf1, 0xfe, 0xf1, 0xfe, 0xf1, 0xfe, 0xfe, 0xfe, 0xfe, 0xf7, 0xfe, 0xfe, 0xfe, 0xf1, 0xfe, 0x9a, 0x96, 0x72, 0x7c, 0x68, 0x62, 0x62, 0x5f, 0x62, 0x5f, 0x5f, 0x68, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x5e, 0x71, 0x71, 0x76, 0x70, 0xa7, 0xf1, 0xf1, 0x2a, 0x2a, 0xfe, 0xf7, 0xfe, 0xf1, 0xf7, 0xfe, 0xfe, 0xfe, 0xf1, 0xfe, 0x2b, 0xfe, 0xf1, 0xee, 0xe0, 0xe2, 0xe3, 0xe5, 0xd6, 0xcd, 0xcd, 0xd5, 0xf7, 0xff, 0xac, 0x52, 0x6b, 0x65, 0x5f, 0x63, 0x63, 0x6c, 0x6b, 0x63, 0x55, 0x87, 0x27, 0xf9, 0xf3, 0xd2, 0xf5, 0xcf, 0xd2, 0xf4, 0xd2, 0xef, 0xd2, 0xf3, 0xd2, 0xf0, 0xf3, 0xf0, 0xf3, 0xef, 0xd2, 0xfb, 0xc8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0x26, 0xf9, 0xf5, 0xf5, 0xf4, 0xc8, 0xc7, 0x69, 0x5d, 0x6a, 0x6f, 0x65, 0x6d, 0x62, 0x67, 0x6d, 0x62, 0x6a, 0x62, 0x62, 0x63, 0x52, 0xa5, 0xff, 0xbd, 0xcd, 0xd3, 0xcd, 0xdb, 0xea, 0xe7, 0xe2, 0xed, 0xf1, 0x2a, 0xfe, 0xfe, 0xf1, 0xf7, 0xf7, 0xf7, 0xf1, 0xf7, 0xfe, 0xf1, 0xf7, 0xf7, 0xf1, 0xf1, 0xf2, 0x85, 0x79, 0x69, 0x76, 0x5f, 0x5f, 0x62, 0x5f, 0x62, 0x68, 0x6a, 0x68, 0x61, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x6a, 0x74, 0x72, 0x70, 0xe4, 0xf1, 0xf1, 0x2a, 0xfe, 0x2b, 0xf1, 0xf1, 0xfe, 0xf1, 0xf1, 0xf1, 0xfe, 0xf1, 0xfe, 0xfe, 0xfe, 0xf1, 0xee, 0xe0, 0xe3, 0xe2, 0xe8, 0xd6, 0x2c, 0xcd, 0x35, 0xff, 0xff, 0x92, 0x56, 0x65, 0x66, 0x63, 0x5b, 0x67, 0x5e, 0x6b, 0x5f, 0x63, 0x59, 0xc6, 0xc8, 0xf5, 0xf3, 0xf4, 0xf4, 0xd2, 0xc8, 0xd2, 0xf9, 0xf4, 0xf4, 0xf3, 0xd2, 0xf3, 0xd2, 0xf5, 0xef, 0xf4, 0xc8, 0xd2, 0x26, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0x26, 0xfa, 0xf9, 0xf3, 0xf2, 0xfd, 0xc9, 0xbc, 0x55, 0x74, 0x6a, 0x67, 0x6d, 0x67, 0x6d, 0x62, 0x65, 0x68, 0x62, 0x61, 0x62, 0x5f, 0x59, 0x64, 0x2a, 0xed, 0xcd, 0xd3, 0xcd, 0xd9, 0xea, 0xe6, 0xe6, 0xeb, 0xff, 0xfe, 0x2b, 0xfe, 0xf1, 0xf7, 0xf7, 0xf7, 0xf7, 0xfe, 0xfe, 0x28, 0xfe, 0xf7, 0xf0, 0xff, 0xbd, 0x60, 0x79, 0x69, 0x6a, 0x62, 0x6a, 0x6a, 0x6a, 0x69, 0x61, 0x69, 0x5d, 0x72, 0x6a, 0x69, 0x6a, 0x6a, 0x5e, 0x61, 0x56, 0x6a, 0x76, 0x69, 0x70, 0x9a, 0xf1, 0xf1, 0xfe, 0x2b, 0xfe, 0xf1, 0xfe, 0xf1, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xf1, 0xf7, 0xed, 0xe0, 0xe6, 0xe2, 0xe3, 0xd6, 0xcd, 0xcd, 0xd0, 0xff, 0xc9, 0x64, 0x5d, 0x66, 0x65, 0x61, 0x67, 0x62, 0x61, 0x6b, 0x5f, 0x66, 0x4e, 0xbe, 0xfd, 0xf5, 0xf4, 0xf5, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf9, 0xf8, 0xf5, 0xc8, 0xc9, 0x9f, 0x5e, 0x6a, 0x6d, 0x61, 0x67, 0x62, 0x67, 0x65, 0x62, 0x61, 0x67, 0x67, 0x65, 0x63, 0x61, 0x4e, 0xbc, 0x26, 0xd5, 0xcd, 0xd3, 0xd6, 0xea, 0xe7, 0xe6, 0xe8, 0xf0, 0xf1, 0x2a, 0xfe, 0xfe, 0xf1, 0xf7, 0xfe, 0xf7, 0xfe, 0xfe, 0x2b, 0xf6, 0xf1, 0xf1, 0xff, 0xa7, 0x70, 0x64, 0x64, 0x69, 0x58, 0x4e, 0x44, 0x41, 0x3f, 0x41, 0x3f, 0x3f, 0x3f, 0x41, 0x43, 0x4a, 0x4e, 0x5c, 0x5d, 0x72, 0x5d, 0x6a, 0x69, 0x70, 0xd1, 0xc4, 0xf1, 0xf1, 0xfe, 0x2b, 0xf1, 0xf1, 0xf7, 0xf1, 0xf7, 0xf1, 0xf7, 0xf1, 0xfe, 0xf1, 0xf7, 0xff, 0xeb, 0xe0, 0xe2, 0xe2, 0xe5, 0xd4, 0xd3, 0xcd, 0x9a, 0xff, 0xbc, 0x4f, 0x6a, 0x6b, 0x62, 0x63, 0x61, 0x61, 0x68, 0x68, 0x5f, 0x6f, 0x52, 0xae, 0xca, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xfa, 0xf3, 0xc8, 0x26, 0xc3, 0x64, 0x67, 0x6d, 0x67, 0x61, 0x65, 0x6a, 0x63, 0x61, 0x67, 0x5b, 0x61, 0x63, 0x67, 0x65, 0x67, 0x52, 0xaa, 0x29, 0xcc, 0xcd, 0x2c, 0xd4, 0xe5, 0xe6, 0xe3, 0xe2, 0xed, 0xff, 0xfe, 0xfe, 0xfe, 0xca, 0x2a, 0xfe, 0xfe, 0xfe, 0xfe, 0xf7, 0xff, 0xf7, 0xff, 0xc4, 0x7a, 0x70, 0x58, 0x4e, 0x3f, 0x3a, 0x36, 0x3a, 0x3f, 0x3a, 0x3a, 0x3e, 0x3f, 0x3e, 0x3b, 0x3e, 0x3a, 0x3f, 0x41, 0x44, 0x4e, 0x56, 0x76, 0x69, 0x70, 0xd0, 0xec, 0xf1, 0xf7, 0xf1, 0xfe, 0xf7, 0xf7, 0xf1, 0xf7, 0xf1, 0xfe, 0xf1, 0xf7, 0xf7, 0xfe, 0xf7, 0xff, 0xe5, 0xe2, 0xe2, 0xe2, 0xde, 0xd4, 0xcd, 0xcd, 0xe9, 0xff, 0xac, 0x56, 0x6b, 0x6b, 0x62, 0x5d, 0x63, 0x62, 0x61, 0x62, 0x5f, 0x5f, 0x5d, 0x87, 0x27, 0xc8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xef, 0xf4, 0xc8, 0xf8, 0xf9, 0xfb, 0x2b, 0xae, 0x5c, 0x6a, 0x6d, 0x67, 0x62, 0x5b, 0x5b, 0x5b, 0x50, 0x50, 0x50, 0x4c, 0x50, 0x55, 0x63, 0x5b, 0x5d, 0x58, 0xc0, 0xac, 0xcd, 0xd3, 0xd3, 0xdb, 0xe7, 0xe7, 0xe2, 0xe3, 0xee, 0xf1, 0xf7, 0xfe, 0x2a, 0xfe, 0x2a, 0xfe, 0xf7, 0xf1, 0xf0, 0xf1, 0xf1, 0xf7, 0x7a, 0x4d, 0x42, 0x36, 0x36, 0x3f, 0x36, 0x3a, 0x3b, 0x36, 0x3e, 0x3a, 0x3e, 0x36, 0x3b, 0x3e, 0x3b, 0x3f, 0x3a, 0x3a, 0x3a, 0x3f, 0x41, 0x44, 0x4e, 0x5a, 0x60, 0xdc, 0xf1, 0xf7, 0xf7, 0xfe, 0xfe, 0xf7, 0xf7, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf1, 0xf7, 0xf1, 0xee, 0xdd, 0xe3, 0xe2, 0xe3, 0xd9, 0xd3, 0xcd, 0xd5, 0x26, 0xc5, 0x64, 0x5e, 0x6b, 0x66, 0x62, 0x5d, 0x61, 0x61, 0x61, 0x61, 0x6b, 0x65, 0x61, 0x58, 0xbe, 0xc9, 0xf4, 0xfb, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xcf, 0xf4, 0xfa, 0xf4, 0xfa, 0x26, 0x29, 0x87, 0x5d, 0x67, 0x6d, 0x67, 0x61, 0x55, 0x50, 0x50, 0x50, 0x4b, 0x50, 0x4b, 0x4c, 0x50, 0x50, 0x6d, 0x56, 0x56, 0xa5, 0xc6, 0xd5, 0xcd, 0xd4, 0xd4, 0xe8, 0xe6, 0xe6, 0xe2, 0xe8, 0xee, 0xf1, 0xf7, 0xf1, 0xfe, 0xf6, 0xf7, 0xf7, 0xf0, 0xf1, 0xf1, 0xd2, 0x9a, 0xcc, 0x3c, 0x33, 0x3a, 0x3a, 0x3a, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x41, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x41, 0x3f, 0x41, 0x42, 0x47, 0xd0, 0xec, 0xff, 0xf0, 0xf1, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xf7, 0xf1, 0xf0, 0xe8, 0xe0, 0xe2, 0xe6, 0xe0, 0xd6, 0xcd, 0xcd, 0xd1, 0xff, 0xae, 0x56, 0x5f, 0x66, 0x5f, 0x62, 0x5d, 0x63, 0x67, 0x61, 0x61, 0x62, 0x5f, 0x67, 0x52, 0xaf, 0x29, 0xd2, 0xfb, 0xf4, 0xfb, 0xfa, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xcf, 0xf4, 0xc8, 0xf8, 0x26, 0xc9, 0xc0, 0x5d, 0x67, 0x6d, 0x6d, 0x63, 0x55, 0x50, 0x50, 0x4c, 0x50, 0x4c, 0x50, 0x4c, 0x4c, 0x4c, 0x50, 0x55, 0x61, 0x56, 0x4e, 0xb5, 0xac, 0xcd, 0x2c, 0xd3, 0xd9, 0xea, 0xe2, 0xe6, 0xe2, 0xe5, 0xeb, 0xf3, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf7, 0xee, 0xce, 0xd1, 0x35, 0x37, 0x33, 0x3e, 0x3e, 0x3e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3a, 0x3b, 0x36, 0x3b, 0x3a, 0x3a, 0x3a, 0x3f, 0x3e, 0x40, 0x3e, 0x42, 0x42, 0x3f, 0x41, 0x41, 0x42, 0x47, 0xd1, 0xed, 0xf1, 0xf7, 0xf7, 0xf1, 0xfe, 0xfe, 0xfe, 0xfe, 0xf7, 0xf0, 0xf1, 0xf1, 0xeb, 0xe0, 0xe2, 0xe2, 0xe3, 0xdb, 0xcd, 0x2c, 0xcd, 0xbd, 0xc6, 0x51, 0x6a, 0x5f, 0x6b, 0x61, 0x61, 0x63, 0x61, 0x61, 0x61, 0x61, 0x62, 0x66, 0x65, 0x56, 0x77, 0x27, 0xfb, 0xc8, 0xfb, 0xf9, 0xf8, 0xf4, 0xf8, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xcf, 0xf9, 0xf4, 0xfa, 0xfb, 0x29, 0xb3, 0x52, 0x6f, 0x62, 0x65, 0x6a, 0x5b, 0x55, 0x4b, 0x50, 0x4c, 0x50, 0x4c, 0x4c, 0x4c, 0x4e, 0x48, 0x50, 0x61, 0x6a, 0x52, 0x58, 0xb3, 0x60, 0xcd, 0x2c, 0xd4, 0xde, 0xe8, 0xe2, 0xe6, 0xe2, 0xe3, 0xe2, 0xe8, 0xea, 0xeb, 0xeb, 0xeb, 0xe9, 0x9a, 0xd1, 0x2d, 0x3c, 0x38, 0x3e, 0x3e, 0x38, 0x3e, 0x3e, 0x3e, 0x3b, 0x36, 0x3c, 0x46, 0x4d, 0x53, 0x53, 0x53, 0x4d, 0x47, 0x42, 0x38, 0x37, 0x38, 0x42, 0x3e, 0x42, 0x42, 0x41, 0x3f, 0x3c, 0x47, 0x7a, 0xec, 0xf0, 0xf1, 0xf1, 0xf7, 0xf7, 0xf6, 0xf0, 0xf7, 0xf0, 0xf3, 0xeb, 0xe0, 0xe2, 0xe2, 0xe2, 0xde, 0xd5, 0x2c, 0xcd, 0xcc, 0xc7, 0xa5, 0x56, 0x71, 0x5f, 0x61, 0x61, 0x63, 0x61, 0x63, 0x61, 0x67, 0x5d, 0x62, 0x5f, 0x66, 0x61, 0x52, 0xbe, 0xca, 0x26, 0xfa, 0xfb, 0xfa, 0xf8, 0xf8, 0xef, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xc8, 0xf9, 0xfa, 0xfa, 0x27, 0x9f, 0x61, 0x66, 0x6e, 0x62, 0x67, 0x67, 0x5b, 0x50, 0x4c, 0x4c, 0x4c, 0x4b, 0x4c, 0x52, 0x4c, 0x4c, 0x50, 0x55, 0x55, 0x69, 0x59, 0x64, 0xaf, 0x46, 0x2c, 0x2c, 0xd3, 0xde, 0xe7, 0xe6, 0xe2, 0xe6, 0xe6, 0xe2, 0xe2, 0xe0, 0xe5, 0xe5, 0xdb, 0x35, 0x31, 0x3c, 0x3b, 0x3a, 0x41, 0x3a, 0x41, 0x40, 0x2f, 0x37, 0x7a, 0xac, 0xb8, 0xc1, 0xc4, 0xcf, 0xcf, 0xd2, 0xd2, 0xc1, 0xbd, 0xb1, 0xa2, 0x49, 0x34, 0x36, 0x42, 0x3e, 0x41, 0x41, 0x41, 0x33, 0x35, 0xdb, 0xe9, 0xed, 0xee, 0xf0, 0xf1, 0xf0, 0xf0, 0xee, 0xeb, 0xe5, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xd7, 0xcd, 0x2c, 0x2c, 0xb1, 0xae, 0x52, 0x6a, 0x6e, 0x61, 0x63, 0x5d, 0x63, 0x5f, 0x65, 0x63, 0x5d, 0x67, 0x61, 0x5f, 0x5f, 0x62, 0x56, 0xaa, 0x2b, 0xfb, 0x28, 0xfb, 0xfa, 0xf8, 0xf8, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xef, 0xf8, 0xf4, 0x28, 0xc2, 0x64, 0x6b, 0x66, 0x71, 0x61, 0x62, 0x63, 0x63, 0x5d, 0x50, 0x4c, 0x4e, 0x4e, 0x4e, 0x4a, 0x4e, 0x4e, 0x4a, 0x50, 0x54, 0x52, 0x56, 0x59, 0x58, 0x7b, 0x3e, 0x2e, 0x2d, 0xd3, 0xd9, 0xe0, 0xe3, 0xe2, 0xe3, 0xe3, 0xe5, 0xe5, 0xdb, 0x35, 0xd5, 0x3c, 0x37, 0x3b, 0x36, 0x3f, 0x3f, 0x3f, 0x34, 0x3c, 0xa2, 0xc1, 0xca, 0xf1, 0xfe, 0xed, 0xce, 0xe9, 0xe9, 0xe4, 0xe9, 0xe9, 0xb8, 0xed, 0xc7, 0xc8, 0xb9, 0x92, 0x42, 0x37, 0x40, 0x41, 0x3f, 0x3f, 0x35, 0x31, 0xd0, 0xde, 0xe9, 0xe8, 0xeb, 0xea, 0xe8, 0xe5, 0xe3, 0xe3, 0xe2, 0xe2, 0xe3, 0xdd, 0xd7, 0xcd, 0x2c, 0x2d, 0x7a, 0xa8, 0x58, 0x77, 0x5e, 0x61, 0x61, 0x67, 0x5d, 0x63, 0x5f, 0x65, 0x65, 0x61, 0x5e, 0x61, 0x6e, 0x5f, 0x5f, 0x68, 0x79, 0xc6, 0xc9, 0xfb, 0xf8, 0xfa, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf3, 0xf4, 0xca, 0xba, 0x5d, 0x6d, 0x6b, 0x68, 0x68, 0x6d, 0x65, 0x63, 0x67, 0x5d, 0x4a, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x44, 0x4a, 0x44, 0x41, 0x3f, 0x3e, 0x42, 0x3c, 0x35, 0x2d, 0xd8, 0xd0, 0xd1, 0xd0, 0xcc, 0x35, 0x2e, 0x35, 0x36, 0x36, 0x3b, 0x38, 0x3b, 0x3f, 0x3a, 0x2f, 0x47, 0xbd, 0xff, 0xff, 0xc4, 0x9a, 0xd5, 0x2c, 0xd3, 0xd3, 0xd3, 0xd4, 0xd5, 0xd4, 0xd5, 0xd5, 0xd0, 0xe4, 0xf2, 0xff, 0xbd, 0x60, 0x2f, 0x40, 0x41, 0x3f, 0x3f, 0x3d, 0x2f, 0x42, 0xdb, 0xe5, 0xe8, 0xe8, 0xe7, 0xe7, 0xe6, 0xe3, 0xe3, 0xde, 0xdb, 0xd6, 0x2d, 0xd5, 0x32, 0x53, 0x0e, 0x53, 0x57, 0x54, 0x57, 0x57, 0x5d, 0x5e, 0x72, 0x6d, 0x62, 0x5f, 0x5f, 0x5f, 0x5f, 0x68, 0x61, 0x62, 0x65, 0x5f, 0x59, 0xb7, 0xca, 0x26, 0xf0, 0xf8, 0xcf, 0xfb, 0xcf, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xfb, 0xf4, 0xf8, 0xf3, 0xf9, 0x29, 0xae, 0x56, 0x62, 0x6b, 0x65, 0x6d, 0x65, 0x6a, 0x6a, 0x54, 0x44, 0x02, 0x04, 0x04, 0x05, 0x02, 0x03, 0x02, 0x05, 0x04, 0x04, 0x05, 0x02, 0x04, 0x4a, 0x04, 0x44, 0x3a, 0x38, 0x33, 0x38, 0x35, 0x35, 0x2d, 0x35, 0x2d, 0x35, 0x35, 0x38, 0x36, 0x3a, 0x3a, 0x36, 0x3b, 0x3b, 0x3a, 0x3a, 0x37, 0xc1, 0xff, 0x28, 0xcf, 0xfb, 0xec, 0xce, 0xe9, 0xe4, 0x9a, 0xdc, 0xd1, 0xd0, 0xd8, 0xcb, 0xd4, 0xcd, 0xcd, 0xd5, 0xa7, 0x2a, 0x2b, 0x92, 0x37, 0x40, 0x3a, 0x36, 0x3d, 0x3c, 0x31, 0xd5, 0x35, 0xd0, 0xde, 0xdc, 0xde, 0xdb, 0xdb, 0xd8, 0x35, 0xd5, 0x3c, 0xcb, 0x3c, 0x40, 0x40, 0x34, 0x3f, 0x40, 0x3f, 0x01, 0x41, 0x44, 0x44, 0x44, 0x4e, 0x5d, 0x69, 0x68, 0x61, 0x5e, 0x62, 0x62, 0x6d, 0x65, 0x6b, 0x59, 0xa5, 0x2a, 0xfb, 0xf6, 0xf8, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf3, 0xf4, 0x29, 0x9f, 0x5d, 0x6d, 0x66, 0x6e, 0x63, 0x71, 0x5d, 0x4e, 0x02, 0x02, 0x03, 0x03, 0x03, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x4f, 0x01, 0x41, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x38, 0x38, 0x3e, 0x36, 0x3a, 0x3a, 0x3a, 0x38, 0x38, 0x3e, 0x2f, 0x7a, 0x2b, 0xfe, 0xfe, 0xf7, 0xfe, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf7, 0xf8, 0xed, 0xce, 0xce, 0xbd, 0xc4, 0xf2, 0xfd, 0xca, 0x26, 0x4d, 0x36, 0x3e, 0x3f, 0x3b, 0x34, 0x37, 0x37, 0x31, 0x35, 0x31, 0xcb, 0x35, 0xcb, 0x35, 0x35, 0x37, 0x3c, 0x3c, 0x39, 0x40, 0x40, 0x39, 0x40, 0x40, 0x40, 0x00, 0x40, 0x00, 0x40, 0x01, 0x41, 0x01, 0x01, 0x4a, 0x57, 0x69, 0x5e, 0x61, 0x65, 0x6d, 0x6b, 0x6b, 0x5d, 0x79, 0xc7, 0xc8, 0xf8, 0xf5, 0xd2, 0xc8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xfb, 0xf4, 0xf5, 0xf5, 0xc8, 0xc7, 0x87, 0x5d, 0x6d, 0x6e, 0x63, 0x6a, 0x5d, 0x06, 0x01, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x04, 0x06, 0x4a, 0x41, 0x36, 0x36, 0x36, 0x38, 0x36, 0x34, 0x36, 0x2f, 0x36, 0x3a, 0x3a, 0x3a, 0x36, 0x38, 0x3b, 0x38, 0x2f, 0xa2, 0xff, 0xef, 0xfd, 0xfd, 0xf7, 0xf7, 0xfe, 0xf6, 0xfe, 0xf7, 0xfe, 0xfa, 0xf7, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf7, 0xfd, 0xff, 0xa2, 0x34, 0x3b, 0x3a, 0x36, 0x38, 0x36, 0x36, 0x3a, 0x34, 0x37, 0x39, 0x34, 0x34, 0x3b, 0x3b, 0x3f, 0x3a, 0x39, 0x40, 0x00, 0x40, 0x01, 0x40, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x54, 0x69, 0x67, 0x6d, 0x65, 0x6b, 0x6b, 0x61, 0x59, 0xbe, 0x2a, 0xf2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0x28, 0xc6, 0x64, 0x69, 0x6f, 0x6f, 0x6a, 0x72, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x03, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x03, 0x03, 0x04, 0x05, 0x02, 0x04, 0x06, 0x06, 0x01, 0x36, 0x3a, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x38, 0x3b, 0x2f, 0xa2, 0x2b, 0xf7, 0xf7, 0xf7, 0xfd, 0xfd, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xf7, 0xfe, 0xf7, 0xf7, 0xf4, 0xff, 0xb1, 0x2f, 0x3e, 0x3a, 0x3b, 0x36, 0x36, 0x36, 0x36, 0x36, 0x34, 0x36, 0x39, 0x36, 0x3a, 0x3a, 0x3b, 0x3d, 0x40, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x4a, 0x69, 0x6a, 0x6d, 0x66, 0x6b, 0x74, 0x52, 0xb3, 0xca, 0xfb, 0xf3, 0xf4, 0xd2, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf5, 0xd2, 0xfd, 0xc2, 0x64, 0x6a, 0x62, 0x6e, 0x73, 0x6c, 0x02, 0x03, 0x03, 0x03, 0x00, 0x04, 0x02, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x02, 0x03, 0x04, 0x05, 0x04, 0x05, 0x06, 0x06, 0x40, 0x36, 0x34, 0x36, 0x37, 0x34, 0x37, 0x39, 0x38, 0x3b, 0x3a, 0x36, 0x38, 0x38, 0x3e, 0x2f, 0x7a, 0x2b, 0xf7, 0xfd, 0xf7, 0xfd, 0xf7, 0xfd, 0xfe, 0xfe, 0x28, 0xfe, 0x28, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfd, 0xfe, 0xf7, 0xf6, 0xf6, 0xff, 0xa2, 0x2f, 0x3e, 0x3e, 0x36, 0x36, 0x34, 0x36, 0x34, 0x34, 0x34, 0x36, 0x34, 0x36, 0x3b, 0x3b, 0x38, 0x3d, 0x3d, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x54, 0x5e, 0x6a, 0x6b, 0x6f, 0x6f, 0x5b, 0xa5, 0x27, 0xf9, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf9, 0xef, 0xf4, 0xca, 0xc0, 0x58, 0x72, 0x65, 0x6f, 0x78, 0x57, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x05, 0x05, 0x04, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x00, 0x34, 0x34, 0x39, 0x34, 0x36, 0x34, 0x38, 0x38, 0x3b, 0x3a, 0x3a, 0x38, 0x36, 0x36, 0x36, 0x3d, 0xc4, 0x2b, 0xf6, 0xfe, 0xfd, 0xf7, 0xfd, 0xf7, 0xfe, 0xf7, 0xfe, 0xf7, 0xfe, 0xfd, 0xfe, 0xf7, 0xf7, 0xfe, 0xf7, 0xfe, 0xcf, 0xfe, 0x26, 0x42, 0x37, 0x3a, 0x3a, 0x3b, 0x34, 0x38, 0x37, 0x38, 0x37, 0x36, 0x37, 0x38, 0x34, 0x38, 0x3c, 0x3c, 0x42, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x57, 0x76, 0x6d, 0x6f, 0x6e, 0x62, 0x82, 0xc7, 0xfa, 0xf4, 0xf5, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xcf, 0xf4, 0xd2, 0xca, 0xbe, 0x5c, 0x6a, 0x74, 0x6f, 0x7c, 0x6c, 0x44, 0x04, 0x00, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x01, 0x34, 0x34, 0x34, 0x36, 0x36, 0x36, 0x36, 0x38, 0x36, 0x3a, 0x36, 0x38, 0x36, 0x3e, 0x3a, 0x2e, 0xa7, 0xff, 0xf7, 0xfd, 0xf7, 0xfd, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xfd, 0xf7, 0xfd, 0xfe, 0xf7, 0xfe, 0xff, 0xa7, 0x2f, 0x3d, 0x3b, 0x3a, 0x39, 0x39, 0x34, 0x36, 0x36, 0x36, 0x36, 0x3b, 0x39, 0x39, 0x39, 0x3d, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x02, 0x06, 0x73, 0x6d, 0x6e, 0x6e, 0x74, 0x64, 0xc2, 0xfd, 0xf8, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xef, 0xf4, 0xca, 0xbe, 0x5c, 0x72, 0x74, 0x6f, 0x71, 0x76, 0x44, 0x02, 0x04, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x04, 0x06, 0x46, 0x34, 0x34, 0x36, 0x38, 0x36, 0x36, 0x36, 0x3a, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x36, 0x3a, 0x3b, 0x30, 0xb5, 0xff, 0x28, 0xf7, 0xfd, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xfe, 0xfd, 0xfe, 0xff, 0xb8, 0x2e, 0x37, 0x3b, 0x3b, 0x3b, 0x39, 0x39, 0x39, 0x38, 0x36, 0x3b, 0x36, 0x3b, 0x39, 0x39, 0x39, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x6c, 0x6a, 0x63, 0x6e, 0x6e, 0x5c, 0xbc, 0xfe, 0xf4, 0xf5, 0xf4, 0xf5, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xc8, 0xf8, 0xf3, 0x28, 0xc0, 0x69, 0x74, 0x6f, 0x74, 0x74, 0x71, 0x54, 0x02, 0x05, 0x05, 0x03, 0x03, 0x03, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x03, 0x04, 0x05, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x06, 0x01, 0x34, 0x39, 0x37, 0x37, 0x37, 0x2f, 0x42, 0x3b, 0x3a, 0x3b, 0x3b, 0x3b, 0x36, 0x3e, 0x3b, 0x3e, 0x2f, 0x3d, 0xc3, 0xff, 0x28, 0xfe, 0xf7, 0xf7, 0xf7, 0xfd, 0xf7, 0xfd, 0xf7, 0xf7, 0xf1, 0xf1, 0xcf, 0xf1, 0x2b, 0xff, 0xbc, 0x40, 0x34, 0x3e, 0x39, 0x3b, 0x39, 0x3b, 0x39, 0x3b, 0x3a, 0x36, 0x3a, 0x36, 0x3a, 0x34, 0x3d, 0x39, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x02, 0x02, 0x69, 0x6a, 0x6f, 0x6e, 0x6f, 0x58, 0xb7, 0xfe, 0xf8, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0x26, 0xf5, 0xf5, 0xfd, 0xc3, 0x77, 0x6a, 0x6f, 0x7d, 0x67, 0x7e, 0x73, 0x06, 0x02, 0x05, 0x05, 0x03, 0x03, 0x03, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x03, 0x05, 0x06, 0x05, 0x04, 0x40, 0x36, 0x34, 0x38, 0x3c, 0x4d, 0x5a, 0x2f, 0x36, 0x36, 0x3b, 0x3b, 0x3b, 0x3b, 0x36, 0x3e, 0x36, 0x41, 0x2f, 0x30, 0xb1, 0xff, 0xca, 0xfe, 0xfd, 0xf7, 0xf1, 0xfe, 0xf7, 0xfe, 0xf7, 0xf9, 0xfd, 0xf1, 0xff, 0xca, 0xb4, 0x2e, 0x32, 0x3e, 0x34, 0x40, 0x39, 0x3b, 0x39, 0x3d, 0x36, 0x3b, 0x3b, 0x36, 0x39, 0x34, 0x40, 0x34, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x01, 0x44, 0x73, 0x6a, 0x6d, 0x6e, 0x7d, 0x52, 0xb5, 0xfe, 0xf4, 0xf8, 0xf5, 0xf5, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0x26, 0xf5, 0xf2, 0x28, 0xc7, 0x7b, 0x7f, 0x88, 0x71, 0x71, 0x76, 0x72, 0x6c, 0x06, 0x02, 0x04, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x05, 0x05, 0x05, 0x06, 0x04, 0x34, 0x36, 0x39, 0x39, 0x3c, 0x85, 0xac, 0x2f, 0x39, 0x3e, 0x36, 0x3b, 0x36, 0x3b, 0x3b, 0x3b, 0x3b, 0x36, 0x3b, 0x37, 0x2f, 0xa2, 0xc7, 0xff, 0xff, 0x28, 0xc8, 0xfe, 0xfe, 0x28, 0xfd, 0x2b, 0xff, 0x2b, 0xc4, 0x7a, 0x31, 0x37, 0x3b, 0x3d, 0x3b, 0x39, 0x3b, 0x3d, 0x39, 0x3b, 0x38, 0x3a, 0x38, 0x3b, 0x36, 0x3b, 0x3b, 0x34, 0x49, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x4a, 0x73, 0x6a, 0x6f, 0x6f, 0x6e, 0x58, 0xb5, 0xca, 0xf4, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf8, 0xf9, 0xc8, 0x27, 0x9d, 0x97, 0x8a, 0x78, 0x7d, 0x6a, 0x76, 0x76, 0x69, 0x54, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x06, 0x3d, 0x39, 0x39, 0x3b, 0x39, 0x34, 0x37, 0xb7, 0x42, 0x34, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3e, 0x36, 0x3e, 0x3b, 0x3b, 0x3b, 0x39, 0x2e, 0x3c, 0xa7, 0xc3, 0xff, 0xff, 0x2b, 0xca, 0xff, 0xff, 0x28, 0xbc, 0x7a, 0x32, 0x2e, 0x39, 0x39, 0x3e, 0x34, 0x3b, 0x3d, 0x38, 0x3b, 0x3b, 0x3b, 0x3b, 0x3d, 0x34, 0x34, 0x39, 0x3b, 0x34, 0x36, 0x40, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x02, 0x57, 0x72, 0x68, 0x74, 0x66, 0x6f, 0x5c, 0xb7, 0xca, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0x26, 0x2a, 0xb0, 0xab, 0x8a, 0x78, 0x80, 0x76, 0x71, 0x76, 0x76, 0x73, 0x57, 0x06, 0x02, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x06, 0x07, 0x40, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x2f, 0xa2, 0xa8, 0x32, 0x39, 0x3b, 0x36, 0x36, 0x3e, 0x3b, 0x3b, 0x3b, 0x36, 0x3b, 0x3e, 0x36, 0x3e, 0x32, 0x30, 0x42, 0x7a, 0xb8, 0x26, 0xc9, 0xb8, 0xa2, 0x4d, 0x30, 0x2f, 0x37, 0x3b, 0x38, 0x3d, 0x3b, 0x3b, 0x3e, 0x3b, 0x3d, 0x38, 0x3b, 0x39, 0x3e, 0x32, 0x46, 0x53, 0x2f, 0x3b, 0x36, 0x3a, 0x39, 0x49, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x54, 0x73, 0x76, 0x71, 0x6f, 0x6e, 0x6e, 0x5c, 0xb9, 0xfe, 0xfb, 0xf8, 0x26, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0x26, 0xca, 0xbf, 0xba, 0x97, 0x83, 0x83, 0x80, 0x7c, 0x76, 0x6d, 0x76, 0x7f, 0x75, 0x75, 0x06, 0x06, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x54, 0x57, 0x75, 0x75, 0x01, 0x34, 0x36, 0x39, 0x39, 0x3b, 0x39, 0x34, 0x46, 0xc0, 0x3d, 0x37, 0x3b, 0x36, 0x40, 0x36, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3a, 0x3a, 0x3b, 0x3b, 0x34, 0x37, 0x2e, 0x2e, 0xb4, 0x53, 0x2e, 0x2e, 0x2f, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x39, 0x3b, 0x39, 0x34, 0x3b, 0x3d, 0x3b, 0x3c, 0x2f, 0x92, 0xa8, 0x2e, 0x3b, 0x3b, 0x36, 0x34, 0x40, 0x07, 0x02, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x01, 0x01, 0x06, 0x73, 0x6c, 0x71, 0x71, 0x6f, 0x74, 0x74, 0x64, 0xc0, 0xfe, 0xfb, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf5, 0xc8, 0xf4, 0xf9, 0xf9, 0x26, 0xc7, 0xa1, 0x7f, 0x8a, 0x8a, 0x84, 0x7d, 0x76, 0x71, 0x72, 0x78, 0x73, 0x0c, 0x75, 0x75, 0x09, 0x57, 0x57, 0x08, 0x57, 0x08, 0x57, 0x6c, 0x75, 0x73, 0x7f, 0x75, 0x7f, 0x4a, 0x2f, 0x38, 0x39, 0x39, 0x3b, 0x3b, 0x39, 0x32, 0xac, 0xb0, 0x2e, 0x36, 0x3e, 0x36, 0x3e, 0x3b, 0x3a, 0x38, 0x3a, 0x38, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3d, 0x3c, 0x3c, 0xac, 0x47, 0x37, 0x3d, 0x3d, 0x39, 0x3b, 0x3b, 0x3b, 0x38, 0x3b, 0x39, 0x3b, 0x39, 0x3b, 0x3d, 0x3d, 0x39, 0x3e, 0x3c, 0x3c, 0xbf, 0x42, 0x32, 0x38, 0x3a, 0x36, 0x3a, 0x3a, 0x73, 0x0c, 0x02, 0x02, 0x01, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x02, 0x57, 0x73, 0x7c, 0x76, 0x6f, 0x7d, 0x74, 0x6f, 0x74, 0x79, 0xc6, 0xc8, 0xf5, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xc8, 0xf4, 0xf3, 0xcf, 0xc9, 0xaa, 0x77, 0x91, 0x8a, 0x90, 0x80, 0x7c, 0x7c, 0x71, 0x71, 0x78, 0x76, 0x7c, 0x76, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x0c, 0x78, 0x76, 0x76, 0x7c, 0x7c, 0x7f, 0x58, 0x3a, 0x36, 0x39, 0x39, 0x3b, 0x39, 0x3b, 0x34, 0x42, 0xc1, 0x60, 0x2f, 0x3a, 0x3b, 0x3e, 0x36, 0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x3c, 0x3b, 0x3b, 0x3a, 0x3b, 0x39, 0x32, 0xac, 0x42, 0x34, 0x3b, 0x3b, 0x3a, 0x3b, 0x3a, 0x3b, 0x38, 0x3b, 0x39, 0x3b, 0x39, 0x3b, 0x3d, 0x3b, 0x40, 0x3b, 0x2e, 0xb0, 0xac, 0x32, 0x34, 0x38, 0x3a, 0x36, 0x36, 0x41, 0x7f, 0x81, 0x7f, 0x73, 0x06, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x06, 0x57, 0x73, 0x78, 0x76, 0x7d, 0x6f, 0x6f, 0x6f, 0x7d, 0x6f, 0x67, 0x96, 0xc7, 0xf9, 0xf5, 0xf8, 0xf5, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xc8, 0xf4, 0xf9, 0xf3, 0xf5, 0xca, 0xb7, 0x82, 0x93, 0x91, 0x93, 0x8a, 0x83, 0x7c, 0x7c, 0x71, 0x7d, 0x71, 0x74, 0x71, 0x71, 0x71, 0x71, 0x7c, 0x71, 0x78, 0x71, 0x78, 0x80, 0x7d, 0x7d, 0x7c, 0x7c, 0x82, 0x41, 0x36, 0x39, 0x39, 0x39, 0x3b, 0x39, 0x39, 0x2f, 0x7a, 0xc5, 0x46, 0x2f, 0x40, 0x3b, 0x3e, 0x3b, 0x3a, 0x3b, 0x38, 0x39, 0x38, 0x38, 0x3a, 0x3b, 0x3a, 0x3b, 0x37, 0xac, 0x3e, 0x36, 0x3b, 0x3f, 0x3b, 0x3a, 0x3b, 0x38, 0x3c, 0x38, 0x3d, 0x3b, 0x3b, 0x3d, 0x3e, 0x39, 0x38, 0x2f, 0xa7, 0xbc, 0x32, 0x30, 0x3c, 0x38, 0x36, 0x3a, 0x36, 0x58, 0x80, 0x7e, 0x7f, 0x76, 0x81, 0x77, 0x75, 0x57, 0x54, 0x07, 0x54, 0x06, 0x54, 0x54, 0x57, 0x73, 0x75, 0x7f, 0x7f, 0x78, 0x71, 0x78, 0x6f, 0x7d, 0x6f, 0x74, 0x98, 0x76, 0x59, 0xb0, 0x2a, 0xf2, 0xf3, 0xf5, 0xf2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf8, 0xf5, 0xf8, 0xfb, 0x28, 0x25, 0x92, 0x91, 0x93, 0x8a, 0x93, 0x90, 0x7c, 0x76, 0x76, 0x72, 0x71, 0x76, 0x71, 0x76, 0x7d, 0x76, 0x7c, 0x76, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x78, 0x81, 0x56, 0x34, 0x34, 0x39, 0x34, 0x39, 0x39, 0x39, 0x34, 0x2f, 0xb4, 0xbf, 0x32, 0x32, 0x3b, 0x36, 0x3a, 0x38, 0x38, 0x38, 0x38, 0x3d, 0x3b, 0x3e, 0x3b, 0x36, 0x3c, 0x32, 0xb9, 0x47, 0x34, 0x38, 0x34, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3b, 0x3f, 0x3f, 0x3f, 0x3b, 0x36, 0x3e, 0x2e, 0x60, 0xc6, 0x49, 0x34, 0x3c, 0x3c, 0x37, 0x34, 0x3a, 0x41, 0x81, 0x7e, 0x7e, 0x7c, 0x7c, 0x78, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x83, 0x7f, 0x83, 0x7f, 0x7e, 0x7c, 0x7c, 0x7c, 0x7d, 0x78, 0x71, 0x78, 0x6e, 0x74, 0x80, 0xb2, 0x77, 0x51, 0xc0, 0xc9, 0xfa, 0xd2, 0xd2, 0xcf, 0xfa, 0xfa, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xc8, 0xf4, 0xf5, 0xf5, 0xf5, 0xc8, 0x26, 0x2a, 0xbc, 0x77, 0x95, 0x90, 0x93, 0x93, 0x93, 0x80, 0x7f, 0x76, 0x76, 0x76, 0x76, 0x7c, 0x76, 0x7c, 0x76, 0x7c, 0x76, 0x7c, 0x7c, 0x78, 0x7c, 0x7d, 0x7c, 0x7c, 0x81, 0x73, 0x41, 0x36, 0x39, 0x39, 0x3d, 0x39, 0x39, 0x37, 0x39, 0x2e, 0xbf, 0xc4, 0x3c, 0x2f, 0x38, 0x38, 0x3b, 0x36, 0x39, 0x3a, 0x36, 0x36, 0x3a, 0x3b, 0x38, 0x2f, 0x4d, 0x29, 0xa2, 0x2e, 0x38, 0x3c, 0x3b, 0x36, 0x3e, 0x3b, 0x3b, 0x3b, 0x3a, 0x3b, 0x3a, 0x42, 0x38, 0x2e, 0xa2, 0x27, 0x4d, 0x2f, 0x40, 0x32, 0x3c, 0x33, 0x3a, 0x36, 0x69, 0x7f, 0x7e, 0x7c, 0x7e, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x78, 0x7c, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x74, 0x7d, 0x78, 0x78, 0x7d, 0x74, 0x84, 0x8f, 0xb6, 0x87, 0x85, 0x29, 0xfa, 0xfa, 0xef, 0xd2, 0xd2, 0xfb, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xc8, 0xf4, 0xf9, 0xf5, 0xf5, 0xf2, 0xfd, 0xc7, 0x2a, 0xa8, 0x82, 0x99, 0x90, 0x93, 0x93, 0x88, 0x84, 0x72, 0x76, 0x7c, 0x76, 0x7c, 0x7c, 0x76, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7e, 0x7f, 0x81, 0x64, 0x36, 0x34, 0x3b, 0x39, 0x39, 0x3d, 0x34, 0x38, 0x32, 0xcb, 0xc3, 0xfb, 0x7a, 0x31, 0x2e, 0x3d, 0x39, 0x39, 0x3d, 0x3b, 0x3b, 0x3b, 0x38, 0x2f, 0x3c, 0xbf, 0x2b, 0x25, 0x4d, 0x2e, 0x34, 0x38, 0x3b, 0x3a, 0x3f, 0x3a, 0x3f, 0x3e, 0x3e, 0x37, 0x2f, 0x3c, 0xa7, 0x29, 0x70, 0x30, 0x34, 0x34, 0x3d, 0x34, 0x34, 0x36, 0x4a, 0x81, 0x7f, 0x7e, 0x7c, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x78, 0x6b, 0x78, 0x88, 0x8f, 0x96, 0xc2, 0x87, 0xb4, 0x2b, 0xfa, 0xf8, 0xf5, 0xd2, 0xcf, 0xfb, 0xf8, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xc8, 0xcf, 0xf4, 0xf5, 0xef, 0xf2, 0xf2, 0xfd, 0xfd, 0xc5, 0x9f, 0x8e, 0x98, 0x93, 0x93, 0x93, 0x90, 0x86, 0x7e, 0x7c, 0x7c, 0x76, 0x7c, 0x7c, 0x76, 0x7c, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x7f, 0x7f, 0x89, 0x44, 0x36, 0x3f, 0x34, 0x39, 0x34, 0x3d, 0x39, 0x38, 0x30, 0x42, 0xc8, 0xff, 0xbd, 0xdc, 0x42, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x42, 0xa2, 0xc4, 0xff, 0x26, 0xff, 0xc3, 0x60, 0x2e, 0x2e, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2e, 0x2e, 0x35, 0x7a, 0xc4, 0x2b, 0x4d, 0x2e, 0x39, 0x3d, 0x39, 0x32, 0x39, 0x3a, 0x3f, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7d, 0x76, 0x76, 0x78, 0x7d, 0x80, 0x8d, 0x81, 0xb0, 0x27, 0xa2, 0xc8, 0x26, 0xfd, 0xf8, 0xef, 0xd2, 0xd2, 0xf4, 0xfa, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xd2, 0xf9, 0xef, 0xef, 0xf3, 0xcf, 0xf2, 0xd2, 0x28, 0xbf, 0x87, 0x89, 0x98, 0x93, 0x93, 0x93, 0x99, 0x84, 0x7e, 0x7c, 0x7c, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x78, 0x7c, 0x7c, 0x7c, 0x7e, 0x7c, 0x7e, 0x7f, 0x81, 0x7b, 0x41, 0x36, 0x3a, 0x39, 0x39, 0x39, 0x34, 0x36, 0x34, 0x2e, 0x60, 0xc8, 0xff, 0xff, 0xfd, 0xbf, 0xb4, 0xb1, 0xb1, 0xb1, 0xbd, 0xc8, 0xff, 0x2b, 0xcf, 0xf1, 0xf9, 0xff, 0xfe, 0xbd, 0xa7, 0x7a, 0x60, 0x60, 0x60, 0x85, 0xa7, 0xb8, 0xc7, 0xff, 0x26, 0x60, 0x2e, 0x36, 0x3b, 0x37, 0x39, 0x36, 0x3b, 0x36, 0x56, 0x89, 0x7c, 0x80, 0x7e, 0x7c, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x76, 0x78, 0x71, 0x88, 0x9b, 0x8f, 0x79, 0xc1, 0xc4, 0xce, 0xfe, 0xd2, 0xfa, 0xf3, 0xf8, 0xef, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xcf, 0xf4, 0xef, 0xf5, 0xd2, 0xf5, 0xf4, 0xef, 0xc8, 0x2b, 0xb7, 0x7b, 0x94, 0x95, 0x98, 0x90, 0x8a, 0x90, 0x8d, 0x83, 0x7e, 0x76, 0x7f, 0x7c, 0x7f, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x76, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x86, 0x5c, 0x3a, 0x3a, 0x39, 0x34, 0x39, 0x34, 0x3b, 0x40, 0x40, 0x2e, 0xa7, 0xff, 0xcf, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0xf1, 0xfe, 0x2b, 0xfe, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0x2b, 0x2b, 0x2b, 0xca, 0x4d, 0x2e, 0x3b, 0x3a, 0x2f, 0x39, 0x34, 0x36, 0x36, 0x4a, 0x89, 0x7e, 0x7c, 0x80, 0x7c, 0x7e, 0x7c, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x76, 0x71, 0x76, 0x8d, 0x98, 0x8d, 0x82, 0xa5, 0xc9, 0xc4, 0xf7, 0xcf, 0xf4, 0xf5, 0xf8, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xef, 0xf2, 0x2a, 0xb7, 0x7b, 0x8e, 0x8c, 0x90, 0x95, 0x90, 0x90, 0x90, 0x8a, 0x7f, 0x80, 0x7f, 0x7c, 0x7f, 0x7c, 0x7e, 0x7c, 0x76, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x7e, 0x81, 0x8c, 0x4a, 0x36, 0x3a, 0x39, 0x34, 0x39, 0x36, 0x3f, 0x39, 0x34, 0x30, 0xbf, 0xff, 0xfd, 0xf7, 0xfd, 0xca, 0x2a, 0x2a, 0x29, 0x29, 0x27, 0x27, 0x25, 0x25, 0x25, 0xc6, 0x29, 0x29, 0x2a, 0x28, 0xca, 0xf7, 0xf7, 0xf6, 0xfd, 0x2b, 0xc9, 0x60, 0x2e, 0x38, 0x36, 0x38, 0x3a, 0x32, 0x3e, 0x3a, 0x41, 0x86, 0x7f, 0x7e, 0x7c, 0x80, 0x7c, 0x7e, 0x7c, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0x7e, 0x90, 0x98, 0x8d, 0x96, 0x85, 0xc0, 0xf1, 0xf6, 0xd2, 0xf3, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf6, 0xfb, 0xca, 0xb9, 0x7b, 0x89, 0x99, 0x8a, 0x90, 0x90, 0x8a, 0x90, 0x90, 0x83, 0x78, 0x76, 0x7c, 0x80, 0x7c, 0x7e, 0x7e, 0x76, 0x7e, 0x7e, 0x7c, 0x7c, 0x7d, 0x7e, 0x86, 0x82, 0x41, 0x32, 0x34, 0x39, 0x36, 0x39, 0x34, 0x3d, 0x39, 0x30, 0x4d, 0xc9, 0x2b, 0xfd, 0xff, 0x2a, 0x29, 0x25, 0xba, 0x20, 0x1b, 0x14, 0x14, 0x14, 0x14, 0x1a, 0x20, 0xbb, 0x29, 0x2a, 0x2b, 0x28, 0xfd, 0xf6, 0xfe, 0xff, 0x85, 0x2e, 0x34, 0x36, 0x38, 0x38, 0x38, 0x3b, 0x36, 0x3f, 0x73, 0x81, 0x76, 0x7e, 0x7c, 0x7e, 0x7c, 0x7e, 0x7c, 0x80, 0x7c, 0x7c, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x78, 0x7e, 0x78, 0x68, 0x83, 0x93, 0x98, 0x8d, 0x96, 0x64, 0xb0, 0x2b, 0xfb, 0xf2, 0xef, 0xf8, 0xf4, 0xf9, 0xfb, 0xfb, 0xfa, 0xf8, 0xd2, 0xf5, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf5, 0xf9, 0xf4, 0xf9, 0xfb, 0xf4, 0x26, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xfb, 0x29, 0xc0, 0x96, 0x89, 0x95, 0x90, 0x90, 0x90, 0x90, 0x93, 0x95, 0x90, 0x83, 0x7f, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x7d, 0x7e, 0x76, 0x8e, 0x7b, 0x3b, 0x36, 0x34, 0x39, 0x36, 0x37, 0x3c, 0x32, 0x3e, 0x2e, 0x70, 0x27, 0x27, 0xbf, 0x23, 0x17, 0x0b, 0x0f, 0x14, 0x13, 0x16, 0x16, 0x16, 0x11, 0x16, 0x16, 0x14, 0x14, 0x24, 0xc2, 0x29, 0x2a, 0x2b, 0xf7, 0x7a, 0x2e, 0x34, 0x3a, 0x3a, 0x34, 0x30, 0x3c, 0x36, 0x36, 0x5c, 0x89, 0x76, 0x83, 0x7c, 0x80, 0x7e, 0x7e, 0x7c, 0x7e, 0x7c, 0x80, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x71, 0x7f, 0x90, 0x98, 0x9b, 0x93, 0x8f, 0x79, 0xae, 0x2b, 0x26, 0xf9, 0xd2, 0xf2, 0xf5, 0xf4, 0x26, 0xc8, 0x26, 0xfa, 0xfb, 0xf5, 0xd2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf2, 0xf8, 0xf4, 0xf4, 0xc8, 0xc9, 0xc6, 0x9f, 0x7b, 0x8d, 0x9b, 0x90, 0x93, 0x91, 0x91, 0x98, 0x8d, 0x8d, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x78, 0x78, 0x80, 0x7e, 0x7e, 0x81, 0x89, 0x58, 0x36, 0x3b, 0x38, 0x37, 0x39, 0x38, 0x3a, 0x3d, 0x3f, 0x31, 0x07, 0xa8, 0x17, 0x0e, 0x10, 0x14, 0x13, 0x11, 0x16, 0x11, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x16, 0x14, 0x17, 0x23, 0xc5, 0x27, 0x85, 0x2e, 0x34, 0x3a, 0x3a, 0x3a, 0x38, 0x3c, 0x32, 0x36, 0x4a, 0x89, 0x7f, 0x80, 0x7c, 0x7e, 0x7e, 0x7e, 0x7c, 0x7e, 0x7c, 0x7e, 0x7c, 0x78, 0x7d, 0x78, 0x7d, 0x71, 0x7d, 0x7e, 0x7f, 0x76, 0x81, 0x95, 0x99, 0x98, 0x90, 0x9e, 0x7b, 0xa5, 0xc9, 0xfd, 0xf8, 0xf4, 0xfb, 0xf4, 0xf8, 0xf4, 0xf4, 0xf8, 0x26, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf5, 0xf2, 0x26, 0xc9, 0x27, 0xb4, 0x82, 0x86, 0x95, 0x98, 0x91, 0x93, 0x90, 0x93, 0x8f, 0x8f, 0x8f, 0x81, 0x7e, 0x81, 0x7e, 0x7f, 0x83, 0x83, 0x7c, 0x7e, 0x7e, 0x80, 0x80, 0x97, 0x4a, 0x36, 0x38, 0x3c, 0x36, 0x39, 0x3b, 0x3b, 0x3b, 0x3f, 0x32, 0x06, 0x0e, 0x14, 0x16, 0x13, 0x16, 0x16, 0x11, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x17, 0x17, 0x46, 0x2e, 0x34, 0x34, 0x3a, 0x3a, 0x3a, 0x34, 0x34, 0x32, 0x4a, 0x87, 0x81, 0x72, 0x7e, 0x7e, 0x7c, 0x7e, 0x76, 0x7f, 0x7c, 0x7f, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x83, 0x76, 0x76, 0x7e, 0x8f, 0x9e, 0x99, 0x90, 0x98, 0x97, 0x77, 0xae, 0x27, 0xfd, 0xf4, 0xf3, 0xfa, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf9, 0xc7, 0xc9, 0x29, 0xbe, 0x9d, 0x82, 0x8c, 0x8f, 0x93, 0x8d, 0x90, 0x91, 0x91, 0x94, 0x99, 0x8f, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x7e, 0x81, 0x89, 0x41, 0x36, 0x36, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x39, 0x40, 0x34, 0x03, 0x0e, 0x15, 0x14, 0x13, 0x11, 0x16, 0x11, 0x16, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1b, 0x0e, 0x00, 0x34, 0x37, 0x34, 0x39, 0x34, 0x34, 0x34, 0x3a, 0x36, 0x41, 0x77, 0x86, 0x72, 0x84, 0x7d, 0x7e, 0x76, 0x7e, 0x7e, 0x76, 0x7e, 0x7c, 0x7e, 0x7c, 0x7c, 0x7d, 0x78, 0x71, 0x72, 0x7e, 0x86, 0x95, 0x9b, 0x93, 0x98, 0x95, 0x95, 0x77, 0xb0, 0x27, 0xc9, 0xd2, 0xf5, 0xf5, 0xf2, 0x26, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf4, 0xf4, 0xf5, 0xf5, 0xf2, 0xfb, 0x26, 0xc9, 0x29, 0xc7, 0xb4, 0x79, 0x89, 0x8c, 0x8f, 0x93, 0x12, 0x95, 0x91, 0x8a, 0x91, 0x98, 0x8c, 0x86, 0x81, 0x7e, 0x7e, 0x80, 0x7c, 0x80, 0x7e, 0x7f, 0x82, 0x82, 0x41, 0x36, 0x34, 0x39, 0x38, 0x38, 0x3c, 0x3e, 0x39, 0x40, 0x34, 0x40, 0x07, 0x14, 0x15, 0x16, 0x14, 0x13, 0x13, 0x13, 0x16, 0x10, 0x16, 0x16, 0x18, 0x14, 0x07, 0x34, 0x34, 0x39, 0x34, 0x3d, 0x32, 0x37, 0x34, 0x3b, 0x36, 0x3a, 0x82, 0x81, 0x7f, 0x86, 0x7c, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7c, 0x7e, 0x7c, 0x7c, 0x7c, 0x76, 0x7d, 0x7c, 0x81, 0x8f, 0x9e, 0x9b, 0x93, 0x98, 0x99, 0x8c, 0x89, 0xb7, 0x29, 0xc9, 0xfb, 0xf4, 0xf3, 0xf3, 0xf4, 0xfb, 0x26, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf8, 0xf6, 0xf9, 0xf4, 0x26, 0xfb, 0x28, 0xca, 0xc3, 0xa8, 0x82, 0x8c, 0x99, 0x90, 0x93, 0x91, 0x90, 0x93, 0x90, 0x93, 0x90, 0x8f, 0x86, 0x81, 0x7c, 0x80, 0x7c, 0x7e, 0x7e, 0x86, 0x8c, 0x77, 0x41, 0x34, 0x36, 0x3b, 0x38, 0x38, 0x38, 0x3d, 0x39, 0x3d, 0x39, 0x34, 0x40, 0x07, 0x0c, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x08, 0x40, 0x39, 0x39, 0x39, 0x3b, 0x3a, 0x39, 0x37, 0x3c, 0x38, 0x36, 0x3f, 0x77, 0x81, 0x7e, 0x7e, 0x7d, 0x80, 0x7d, 0x7e, 0x7e, 0x76, 0x7e, 0x7c, 0x7d, 0x7e, 0x7c, 0x7e, 0x7c, 0x76, 0x80, 0x8d, 0x9b, 0x9e, 0x93, 0x9b, 0x98, 0x99, 0x7b, 0xa5, 0xc2, 0x2a, 0x26, 0xf6, 0xf2, 0xf3, 0xf3, 0xf5, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf4, 0xf4, 0xf8, 0xf5, 0xf8, 0xf3, 0xf4, 0xf4, 0xd2, 0xd2, 0xc8, 0xc9, 0x29, 0xbc, 0x9d, 0x77, 0x81, 0x95, 0x98, 0x93, 0x93, 0x93, 0x93, 0x93, 0x90, 0x94, 0x90, 0x90, 0x84, 0x83, 0x83, 0x8a, 0x8c, 0x81, 0x97, 0x77, 0x3f, 0x36, 0x36, 0x36, 0x38, 0x38, 0x38, 0x3d, 0x3d, 0x39, 0x39, 0x39, 0x34, 0x39, 0x40, 0x06, 0x07, 0x07, 0x07, 0x06, 0x01, 0x3f, 0x34, 0x3b, 0x3b, 0x38, 0x38, 0x38, 0x3a, 0x36, 0x36, 0x39, 0x2f, 0x3a, 0x77, 0x81, 0x7e, 0x7e, 0x7c, 0x80, 0x7c, 0x7d, 0x7c, 0x7e, 0x7e, 0x76, 0x7e, 0x76, 0x7d, 0x7e, 0x7c, 0x7e, 0x84, 0x98, 0x9e, 0x98, 0x93, 0x9b, 0x95, 0x89, 0x7b, 0xb4, 0xc7, 0xfe, 0xf4, 0xd2, 0xf8, 0xf3, 0xf3, 0xf3, 0xf2, 0xef, 0xfb, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf4, 0xd2, 0xcf, 0xf8, 0xfa, 0xfb, 0x29, 0x29, 0xbc, 0xa8, 0x82, 0x89, 0x8f, 0x95, 0x90, 0x93, 0x93, 0x91, 0x91, 0x95, 0x95, 0x90, 0x90, 0x8f, 0x8a, 0x90, 0x86, 0x8f, 0x97, 0x82, 0x43, 0x36, 0x3a, 0x3b, 0x3e, 0x39, 0x38, 0x3d, 0x38, 0x38, 0x3b, 0x3b, 0x3b, 0x3b, 0x36, 0x34, 0x36, 0x36, 0x36, 0x36, 0x3b, 0x3b, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x3e, 0x3a, 0x34, 0x43, 0x77, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x76, 0x7e, 0x76, 0x7e, 0x7e, 0x7c, 0x7c, 0x76, 0x84, 0x95, 0x99, 0x99, 0x95, 0x99, 0x95, 0x89, 0x82, 0xae, 0xc3, 0xff, 0xc8, 0xf5, 0xf2, 0xf8, 0xf5, 0xf8, 0xf5, 0xf2, 0xef, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf8, 0xfb, 0x26, 0x2a, 0xc7, 0xbc, 0xa5, 0x7b, 0x82, 0x94, 0x90, 0x90, 0x90, 0x95, 0x8f, 0x90, 0x8f, 0x8a, 0x8a, 0x8c, 0x90, 0x86, 0x8a, 0x86, 0x97, 0x8e, 0x4a, 0x36, 0x36, 0x36, 0x3d, 0x3b, 0x39, 0x3b, 0x38, 0x3b, 0x38, 0x3b, 0x3b, 0x3e, 0x3b, 0x3e, 0x3a, 0x40, 0x36, 0x3b, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x3e, 0x36, 0x36, 0x44, 0x81, 0x86, 0x7f, 0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x76, 0x7e, 0x7e, 0x76, 0x7e, 0x76, 0x7c, 0x84, 0x8f, 0x98, 0x99, 0x98, 0x9e, 0x8f, 0x89, 0x7b, 0xa8, 0xbc, 0x2a, 0xca, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xf5, 0xd2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xd2, 0xcf, 0xcf, 0xd2, 0xf2, 0xfa, 0x28, 0x29, 0xc2, 0xae, 0x87, 0x81, 0x8c, 0x8f, 0x8c, 0x8f, 0x8f, 0x94, 0x90, 0x8c, 0x8a, 0x8f, 0x90, 0x90, 0x90, 0x8c, 0x8f, 0x97, 0x77, 0x41, 0x36, 0x34, 0x40, 0x3d, 0x3a, 0x3f, 0x3a, 0x3b, 0x3a, 0x38, 0x36, 0x38, 0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x38, 0x38, 0x3b, 0x3b, 0x3a, 0x39, 0x36, 0x3f, 0x5c, 0x86, 0x80, 0x7c, 0x84, 0x7e, 0x7f, 0x7e, 0x77, 0x7e, 0x7f, 0x7e, 0x7e, 0x76, 0x7c, 0x7c, 0x84, 0x90, 0x9b, 0x9e, 0x9e, 0x99, 0x97, 0x7f, 0x8c, 0xae, 0xc2, 0x2a, 0xfe, 0xf2, 0xf5, 0xcf, 0xfb, 0x26, 0xfb, 0xfa, 0x26, 0x26, 0x26, 0x26, 0xd2, 0xf4, 0xf3, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xcf, 0xd2, 0xef, 0xf5, 0xf8, 0xfa, 0xfb, 0xc9, 0x27, 0xc5, 0xb0, 0x9f, 0x7b, 0x89, 0x8c, 0x90, 0x8f, 0x90, 0x8f, 0x90, 0x8a, 0x8a, 0x90, 0x8a, 0x90, 0x8a, 0x8c, 0x94, 0x89, 0x58, 0x3a, 0x36, 0x3a, 0x3f, 0x3b, 0x3a, 0x3b, 0x3e, 0x3b, 0x38, 0x38, 0x37, 0x3a, 0x3b, 0x3b, 0x36, 0x34, 0x38, 0x3b, 0x3b, 0x36, 0x3f, 0x44, 0x77, 0x86, 0x7f, 0x7e, 0x83, 0x7c, 0x7e, 0x7e, 0x81, 0x7e, 0x76, 0x7e, 0x7e, 0x76, 0x7d, 0x7c, 0x88, 0x9b, 0x98, 0x9e, 0x99, 0x8e, 0x82, 0x92, 0xb3, 0x25, 0xc9, 0xfe, 0xd2, 0xc8, 0xf5, 0xf5, 0xf4, 0xf4, 0x26, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0x26, 0xfd, 0x2b, 0x26, 0xbe, 0xaa, 0x97, 0x9c, 0x90, 0x90, 0x8a, 0x8a, 0x8f, 0x90, 0x8a, 0x90, 0x8a, 0x91, 0x8a, 0x8a, 0x86, 0x97, 0x8c, 0x58, 0x41, 0x36, 0x36, 0x36, 0x36, 0x3b, 0x3b, 0x3b, 0x38, 0x3b, 0x39, 0x3a, 0x36, 0x3b, 0x36, 0x36, 0x36, 0x3f, 0x49, 0x69, 0x8a, 0x83, 0x7f, 0x83, 0x7e, 0x7e, 0x7e, 0x7c, 0x7e, 0x76, 0x7e, 0x81, 0x76, 0x7c, 0x76, 0x8a, 0x8a, 0x9e, 0x8f, 0x81, 0x82, 0x87, 0xaa, 0xb9, 0x29, 0x2b, 0x26, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf8, 0xf4, 0xf4, 0xf4, 0xf2, 0xc8, 0xc9, 0x29, 0xb6, 0x99, 0x90, 0x99, 0x95, 0x95, 0x95, 0x90, 0x90, 0x8a, 0x91, 0x8a, 0x91, 0x8a, 0x91, 0x8c, 0x89, 0x8e, 0x8e, 0x7b, 0x58, 0x41, 0x3f, 0x36, 0x3a, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x41, 0x4a, 0x52, 0x77, 0x86, 0x86, 0x7f, 0x83, 0x86, 0x7c, 0x7f, 0x7e, 0x7e, 0x7e, 0x7c, 0x7f, 0x7e, 0x7e, 0x7f, 0x81, 0x8e, 0x8e, 0x87, 0x87, 0x9f, 0xae, 0xb9, 0xc3, 0x29, 0x2a, 0x28, 0xfb, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf8, 0xf3, 0xf3, 0xf3, 0xfd, 0x29, 0xaf, 0x8a, 0x8a, 0x90, 0x90, 0x95, 0x95, 0x95, 0x95, 0x90, 0x8b, 0x8a, 0x90, 0x8a, 0x8a, 0x8a, 0x8f, 0x8c, 0x89, 0x8c, 0x8e, 0x8e, 0x82, 0x77, 0x64, 0x58, 0x58, 0x58, 0x58, 0x64, 0x64, 0x7b, 0x81, 0x89, 0x8a, 0x80, 0x80, 0x84, 0x83, 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x83, 0x7f, 0x80, 0x7f, 0x83, 0x89, 0x97, 0xa5, 0xae, 0xb7, 0xc1, 0xc7, 0xca, 0xca, 0x28, 0xfd, 0x26, 0xf2, 0xf5, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf3, 0xf3, 0xf3, 0x28, 0xc6, 0x96, 0x94, 0x98, 0x95, 0x95, 0x95, 0x90, 0x90, 0x94, 0x90, 0x99, 0x95, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x86, 0x86, 0x8a, 0x8a, 0x8f, 0x8f, 0x8f, 0x97, 0x8f, 0x8c, 0x8c, 0x8c, 0x8c, 0x86, 0x86, 0x81, 0x86, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x80, 0x81, 0x7e, 0x83, 0x86, 0x83, 0x8f, 0x93, 0xa4, 0xab, 0xab, 0xbb, 0x29, 0x29, 0xfe, 0xf6, 0xef, 0xf5, 0xef, 0xf4, 0xd2, 0xf8, 0xf4, 0xf8, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0x26, 0x26, 0xf3, 0xf3, 0xf4, 0xca, 0xbc, 0x82, 0x98, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x90, 0x91, 0x90, 0x95, 0x98, 0x98, 0x98, 0x95, 0x95, 0x95, 0x90, 0x90, 0x90, 0x8a, 0x8d, 0x8f, 0x8f, 0x8f, 0x86, 0x8a, 0x84, 0x86, 0x81, 0x81, 0x81, 0x81, 0x83, 0x84, 0x84, 0x86, 0x8d, 0x90, 0x98, 0x99, 0x9c, 0x9e, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa8, 0xc5, 0xc8, 0xf2, 0xf3, 0xf3, 0xf2, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x26, 0x26, 0x26, 0xf4, 0xf9, 0xc8, 0x29, 0xae, 0x81, 0x94, 0x98, 0x94, 0x98, 0x94, 0x95, 0x95, 0x95, 0x94, 0x99, 0x94, 0x90, 0x90, 0x8a, 0x93, 0x95, 0x95, 0x95, 0x8f, 0x8f, 0x90, 0x8c, 0x8f, 0x8c, 0x97, 0x89, 0x89, 0x8c, 0x8f, 0x8c, 0x97, 0x97, 0x97, 0x99, 0xa3, 0x9e, 0xa3, 0x9b, 0x9e, 0x9e, 0x9b, 0x95, 0x98, 0x94, 0x9c, 0x94, 0x95, 0x90, 0x95, 0x99, 0x82, 0xae, 0x2b, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf4, 0x26, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf4, 0xf4, 0xef, 0x26, 0x27, 0x9d, 0x94, 0x98, 0x90, 0x95, 0x95, 0x95, 0x95, 0x95, 0x98, 0x95, 0x94, 0x95, 0x98, 0x98, 0x95, 0x90, 0x95, 0x8c, 0x9e, 0xa8, 0xa1, 0xa5, 0xa1, 0xa5, 0xa5, 0x9f, 0xa5, 0xa5, 0x9f, 0xa5, 0xa5, 0xa5, 0xa5, 0xa6, 0xa5, 0x99, 0x97, 0x98, 0x95, 0x98, 0x98, 0x99, 0x9c, 0x99, 0x9c, 0x98, 0x99, 0x9e, 0x9e, 0x9b, 0x98, 0x99, 0x87, 0xc6, 0xfd, 0xf2, 0xf4, 0xf4, 0xf4, 0xfb, 0xf9, 0xf4, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xca, 0xbe, 0x8e, 0x95, 0x95, 0x98, 0x95, 0x95, 0x98, 0x98, 0x95, 0x98, 0x95, 0x9c, 0x90, 0x94, 0x90, 0x95, 0x8f, 0x8f, 0x8c, 0xa3, 0xae, 0xb0, 0xae, 0xb0, 0xb4, 0xa8, 0x47, 0xb0, 0xb1, 0xb0, 0xb1, 0xb0, 0xac, 0xa8, 0xa8, 0xa1, 0x99, 0x95, 0x9c, 0x9e, 0x99, 0x98, 0x9c, 0x95, 0x98, 0x95, 0x95, 0x95, 0x97, 0x98, 0x9b, 0x9b, 0x99, 0x8e, 0xb0, 0x28, 0xd2, 0x26, 0xf4, 0xfb, 0xf9, 0xfb, 0xf4, 0xf8, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf2, 0xf9, 0xf2, 0xf5, 0xd2, 0x2a, 0xb4, 0x8b, 0x90, 0x95, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x99, 0x93, 0x95, 0x93, 0x98, 0x98, 0x94, 0x94, 0x8c, 0x97, 0xb0, 0xac, 0xac, 0xad, 0xad, 0xdc, 0x2d, 0x9a, 0xb1, 0xe9, 0xb1, 0xe9, 0xa7, 0xac, 0xa5, 0x9d, 0x94, 0x93, 0x98, 0x95, 0x95, 0x99, 0x99, 0x9c, 0x99, 0x98, 0x98, 0x99, 0x9c, 0x99, 0x9b, 0x9b, 0x99, 0x99, 0x92, 0xc3, 0xc9, 0x26, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xc8, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xc8, 0x26, 0xf4, 0xf6, 0xca, 0xa8, 0x8f, 0x98, 0x95, 0x8f, 0x94, 0x8f, 0x94, 0x95, 0x94, 0x95, 0x95, 0x90, 0x98, 0x91, 0x93, 0x91, 0x91, 0x95, 0x91, 0x97, 0xb3, 0xb0, 0xb1, 0xad, 0xd9, 0xd7, 0xd9, 0xd9, 0xdb, 0xe9, 0xe9, 0xad, 0xe4, 0xac, 0xa5, 0x9d, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x95, 0x99, 0x98, 0x99, 0x9b, 0x98, 0x9c, 0x98, 0x99, 0x9b, 0x95, 0x99, 0x8e, 0xb0, 0x29, 0xfb, 0xf2, 0xf5, 0xf5, 0xd2, 0x26, 0xd2, 0xcf, 0xf3, 0xf3, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xf5, 0x26, 0xf4, 0xf4, 0xfd, 0xc7, 0x92, 0x91, 0x98, 0x8f, 0x95, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x8f, 0x94, 0x95, 0x94, 0x94, 0x94, 0x97, 0x8c, 0x8b, 0xb0, 0xfc, 0xe9, 0xd7, 0xda, 0xe1, 0xe1, 0xe1, 0xdd, 0xd9, 0xdc, 0xe9, 0xad, 0xac, 0xa5, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9c, 0x9c, 0x9c, 0x99, 0x98, 0x9b, 0x98, 0x96, 0x96, 0xc7, 0xc8, 0xf5, 0xf2, 0xf5, 0xf4, 0x26, 0xc8, 0xd2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0x28, 0xc1, 0x82, 0x97, 0x93, 0x94, 0x95, 0x90, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x97, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x97, 0x89, 0xac, 0xce, 0xd8, 0xd7, 0xe1, 0xdf, 0xdf, 0xdf, 0xdf, 0xdd, 0xd6, 0xde, 0xb1, 0xa8, 0x15, 0x97, 0x94, 0x97, 0x97, 0x9c, 0x94, 0x9c, 0x99, 0x9c, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x95, 0x8f, 0x8e, 0xb7, 0x2a, 0xf8, 0xf3, 0xf3, 0xf9, 0x26, 0xfb, 0xf9, 0xf2, 0xf5, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf8, 0xf4, 0xf4, 0x29, 0xb7, 0x7b, 0x98, 0x95, 0x93, 0x95, 0x98, 0x95, 0x98, 0x98, 0x98, 0x98, 0x95, 0x8f, 0x94, 0x95, 0x95, 0x95, 0x95, 0x8f, 0x95, 0x8c, 0xa7, 0x9a, 0xd3, 0xda, 0xe1, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xda, 0xd4, 0x9a, 0xa8, 0x94, 0x9c, 0x98, 0x8f, 0x99, 0x98, 0x9e, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x98, 0x98, 0x9b, 0x97, 0x97, 0x9f, 0xc7, 0xfb, 0xf8, 0xf3, 0xf8, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf5, 0xf8, 0xfa, 0xc9, 0xae, 0x82, 0x93, 0x93, 0x90, 0x90, 0x8a, 0x83, 0x80, 0x78, 0x76, 0x6c, 0x71, 0x6c, 0x71, 0x78, 0x80, 0x83, 0x84, 0x95, 0x9e, 0x99, 0xa8, 0xcc, 0xd3, 0xda, 0xe1, 0xdf, 0xdf, 0xdf, 0xe1, 0xdf, 0xe1, 0xd4, 0xcb, 0x64, 0x78, 0x6b, 0x6f, 0x6b, 0x7c, 0x71, 0x76, 0x7c, 0x7e, 0x80, 0x86, 0x8f, 0x9e, 0x9e, 0x9e, 0x99, 0x99, 0x95, 0x98, 0x93, 0x9b, 0x97, 0x8e, 0xbf, 0xca, 0xf5, 0xf5, 0xf2, 0xf8, 0x26, 0xfb, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf9, 0xf5, 0xf3, 0xc9, 0xc7, 0x9d, 0x86, 0x84, 0x80, 0x71, 0x71, 0x68, 0x68, 0x5e, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x6b, 0x6b, 0x5f, 0x5f, 0x61, 0x5e, 0x5d, 0x77, 0x92, 0x53, 0xd3, 0xd9, 0xe1, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd6, 0xd5, 0x79, 0x69, 0x74, 0x6a, 0x6b, 0x5e, 0x61, 0x61, 0x63, 0x5b, 0x5b, 0x5b, 0x62, 0x61, 0x6a, 0x80, 0x8f, 0x9e, 0x9e, 0x93, 0x9b, 0x9b, 0x99, 0x82, 0xb3, 0xc9, 0xf4, 0xf8, 0xf3, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf3, 0xf5, 0x28, 0xc2, 0x82, 0x76, 0x68, 0x6b, 0x5f, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x5e, 0x69, 0x57, 0x4f, 0x00, 0x47, 0x2d, 0xd6, 0xe2, 0xe1, 0xdf, 0xdf, 0xdf, 0xe1, 0xdd, 0xd4, 0xcb, 0x49, 0x49, 0x5c, 0x69, 0x72, 0x73, 0x6a, 0x69, 0x61, 0x67, 0x65, 0x65, 0x62, 0x68, 0x6b, 0x62, 0x61, 0x76, 0x8a, 0x9b, 0x9b, 0x93, 0x95, 0x8c, 0x9f, 0xc7, 0xc9, 0xf2, 0xf3, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf3, 0xf3, 0x2a, 0xb5, 0x5d, 0x61, 0x6b, 0x6f, 0x6f, 0x6b, 0x6e, 0x6b, 0x6e, 0x6f, 0x6f, 0x66, 0x62, 0x6b, 0x6d, 0x6d, 0x67, 0x72, 0x69, 0x4a, 0x36, 0x2f, 0x2e, 0x31, 0xcb, 0xd4, 0xd6, 0xe1, 0xe6, 0xe1, 0xe1, 0xdd, 0xd7, 0xd5, 0x42, 0x2e, 0x2f, 0x2e, 0x38, 0x40, 0x54, 0x69, 0x72, 0x67, 0x67, 0x6d, 0x6f, 0x6b, 0x6b, 0x6b, 0x6e, 0x68, 0x6a, 0x6c, 0x6b, 0x83, 0x93, 0x99, 0x94, 0x87, 0xbe, 0x28, 0xf2, 0xf3, 0xf2, 0xf5, 0xf4, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xf4, 0xf3, 0xf5, 0xca, 0xaa, 0x5e, 0x6b, 0x6f, 0x6d, 0x6f, 0x65, 0x6b, 0x6f, 0x62, 0x66, 0x65, 0x6b, 0x6e, 0x66, 0x67, 0x6a, 0x69, 0x5c, 0x41, 0x2f, 0x32, 0x32, 0x2f, 0x2f, 0x35, 0xcb, 0xd4, 0xd4, 0xd7, 0xd9, 0xd7, 0xd4, 0xd4, 0xcc, 0x31, 0x30, 0x30, 0x31, 0x2f, 0x32, 0x32, 0x41, 0x54, 0x69, 0x6a, 0x61, 0x62, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x68, 0x71, 0x71, 0x6b, 0x71, 0x84, 0x95, 0x82, 0xb3, 0xca, 0xd2, 0xf3, 0xef, 0xf4, 0xd2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xc8, 0xf4, 0xf9, 0xf4, 0xfa, 0xf4, 0xfa, 0xfa, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf4, 0xf3, 0xf4, 0x2a, 0x77, 0x66, 0x6b, 0x71, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x65, 0x6b, 0x6e, 0x63, 0x77, 0x5a, 0x3b, 0x2f, 0x2f, 0x2f, 0x30, 0x32, 0x30, 0x30, 0x30, 0xcc, 0x35, 0x2c, 0xcd, 0xd3, 0x35, 0x4d, 0x31, 0x31, 0x30, 0x30, 0x30, 0x32, 0x32, 0x2f, 0x2f, 0x36, 0x49, 0x73, 0x6a, 0x68, 0x6d, 0x68, 0x6f, 0x6d, 0x6d, 0x6d, 0x68, 0x68, 0x71, 0x68, 0x71, 0x7d, 0x8a, 0xa6, 0xc9, 0xf4, 0xf3, 0xf2, 0xc8, 0xd2, 0xcf, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf5, 0xf7, 0xc6, 0x56, 0x68, 0x66, 0x74, 0x61, 0x6d, 0x62, 0x6d, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x66, 0x6a, 0x51, 0x36, 0x2f, 0x32, 0x2f, 0x30, 0x31, 0x30, 0x30, 0x33, 0x30, 0x2e, 0xcb, 0x4d, 0xcc, 0xcc, 0x47, 0x35, 0x2e, 0x2d, 0x31, 0x30, 0x30, 0x2f, 0x2f, 0x32, 0x30, 0x2f, 0x36, 0x4a, 0x72, 0x6a, 0x61, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x74, 0x6b, 0x62, 0x71, 0x7b, 0xc3, 0xc8, 0xf5, 0xf4, 0xf4, 0xf4, 0xd2, 0xf8, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xef, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf5, 0xca, 0xbc, 0x56, 0x6f, 0x66, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x71, 0x72, 0x41, 0x2f, 0x2f, 0x32, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x35, 0x2d, 0x35, 0x2d, 0x31, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x34, 0x2f, 0x3a, 0x5c, 0x72, 0x67, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x6f, 0x6d, 0x71, 0x6f, 0x68, 0x5c, 0xb7, 0x28, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf8, 0xf9, 0xf5, 0xf9, 0xf5, 0xef, 0xf5, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0x2a, 0xae, 0x56, 0x68, 0x6f, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x72, 0x54, 0x2f, 0x32, 0x30, 0x30, 0x33, 0x30, 0x31, 0x31, 0x32, 0x30, 0x30, 0x31, 0x2e, 0x30, 0x33, 0x31, 0x30, 0x2e, 0x33, 0x2e, 0x37, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x30, 0x34, 0x34, 0x41, 0x69, 0x67, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x71, 0x74, 0x6d, 0x6d, 0x5d, 0xa5, 0xc9, 0xfb, 0xf5, 0xf8, 0xf5, 0xf8, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xfb, 0xf8, 0xf4, 0xf4, 0xf4, 0xef, 0xef, 0xef, 0xef, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xef, 0xc8, 0x27, 0xa5, 0x5d, 0x6b, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x61, 0x73, 0x41, 0x2f, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x31, 0x32, 0x32, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x32, 0x32, 0x3a, 0x58, 0x69, 0x67, 0x65, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x71, 0x6f, 0x6d, 0x66, 0x72, 0x87, 0xc6, 0x26, 0xf8, 0xf3, 0xf8, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0xfb, 0xc8, 0xf4, 0xf9, 0xf2, 0xd2, 0xf5, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xef, 0xc9, 0xc5, 0x82, 0x5e, 0x6d, 0x6d, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x6a, 0x69, 0x3b, 0x32, 0x31, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x32, 0x30, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x32, 0x32, 0x36, 0x4f, 0x5d, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x6d, 0x6d, 0x6d, 0x6f, 0x74, 0x62, 0x69, 0xb9, 0xca, 0xf2, 0xf3, 0xf5, 0xfa, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xca, 0xca, 0xff, 0xfe, 0xf2, 0xf9, 0xf2, 0xef, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf3, 0xf4, 0xca, 0xbe, 0x77, 0x6a, 0x6d, 0x6d, 0x65, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x6a, 0x5c, 0x2f, 0x32, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0x30, 0x2f, 0x32, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0x33, 0x32, 0x2f, 0x44, 0x72, 0x62, 0x65, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x6f, 0x6d, 0x71, 0x6f, 0x5f, 0x6d, 0x69, 0xaf, 0x2a, 0xf5, 0xf3, 0xf5, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0x2b, 0xc7, 0xe4, 0x9a, 0xbd, 0xfe, 0xd2, 0xf9, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf3, 0xf2, 0x2b, 0xaf, 0x81, 0x6a, 0x62, 0x6d, 0x67, 0x65, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x74, 0x58, 0x2f, 0x34, 0x31, 0x31, 0x31, 0x32, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x32, 0x30, 0x32, 0x32, 0x32, 0x2f, 0x33, 0x31, 0x33, 0x32, 0x3f, 0x72, 0x68, 0x66, 0x71, 0x68, 0x6d, 0x6d, 0x6f, 0x71, 0x6f, 0x71, 0x6d, 0x6f, 0x66, 0x69, 0x96, 0x2a, 0xf4, 0xf3, 0xf3, 0x26, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xef, 0xf4, 0xf9, 0xf5, 0xc8, 0xf6, 0x2a, 0xad, 0x35, 0x2e, 0x2c, 0x2c, 0xbf, 0xfd, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf3, 0xf5, 0x29, 0xa5, 0x86, 0x61, 0x6d, 0x6d, 0x65, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x76, 0x4e, 0x2f, 0x31, 0x31, 0x31, 0x30, 0x32, 0x32, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x32, 0x30, 0x32, 0x30, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x34, 0x3e, 0x7f, 0x62, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x6b, 0x76, 0x77, 0xc1, 0xf6, 0xf3, 0xf2, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xd2, 0xf5, 0xf3, 0xf6, 0xf2, 0xfd, 0x2b, 0xa2, 0x2d, 0x2e, 0x33, 0x31, 0x2c, 0xa2, 0x2b, 0xfa, 0xfa, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf9, 0x27, 0x96, 0x8a, 0x62, 0x68, 0x6d, 0x61, 0x65, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x76, 0x51, 0x34, 0x2f, 0x33, 0x30, 0x30, 0x32, 0x30, 0x31, 0x30, 0x32, 0x30, 0x32, 0x30, 0x30, 0x32, 0x31, 0x32, 0x30, 0x32, 0x32, 0x30, 0x32, 0x30, 0x30, 0x30, 0x30, 0x32, 0x34, 0x30, 0x30, 0x31, 0x32, 0x40, 0x77, 0x6d, 0x65, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x6b, 0x71, 0x81, 0xb4, 0xc9, 0xf5, 0xfb, 0xfa, 0x26, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0x26, 0xff, 0x85, 0x2d, 0x31, 0x31, 0x31, 0x33, 0x2e, 0x7a, 0x2b, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xfd, 0xc0, 0x82, 0x90, 0x6b, 0x68, 0x65, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x6a, 0x58, 0x2f, 0x30, 0x31, 0x30, 0x32, 0x32, 0x30, 0x31, 0x30, 0x30, 0x32, 0x30, 0x32, 0x32, 0x30, 0x30, 0x30, 0x32, 0x30, 0x30, 0x30, 0x32, 0x30, 0x30, 0x30, 0x30, 0x32, 0x32, 0x30, 0x33, 0x30, 0x32, 0x40, 0x82, 0x61, 0x66, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x6d, 0x68, 0x6f, 0x6d, 0x80, 0x92, 0xc7, 0xfb, 0xf8, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xfe, 0xbd, 0x2c, 0x2f, 0x31, 0x33, 0x31, 0x2f, 0x2e, 0x4d, 0x28, 0xc8, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x28, 0xb7, 0x77, 0x93, 0x71, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x71, 0x58, 0x36, 0x2f, 0x31, 0x31, 0x30, 0x32, 0x30, 0x31, 0x30, 0x32, 0x30, 0x30, 0x30, 0x30, 0x32, 0x30, 0x32, 0x30, 0x32, 0x30, 0x32, 0x30, 0x32, 0x30, 0x32, 0x30, 0x32, 0x32, 0x33, 0x31, 0x31, 0x32, 0x40, 0x89, 0x61, 0x65, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x6f, 0x6f, 0x8d, 0x82, 0xb7, 0x2b, 0xf4, 0xf8, 0xf8, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xfa, 0xf8, 0xf8, 0xf4, 0xfd, 0xc4, 0x42, 0x2e, 0x33, 0x35, 0x33, 0x31, 0x38, 0x2e, 0x31, 0xbf, 0xf9, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xc8, 0xc9, 0xa8, 0x81, 0x8d, 0x7c, 0x5f, 0x6a, 0x65, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x62, 0x71, 0x64, 0x36, 0x32, 0x30, 0x31, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0x30, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x31, 0x31, 0x32, 0x32, 0x41, 0x77, 0x61, 0x6f, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x6d, 0x6a, 0x6b, 0x6b, 0x93, 0x81, 0x96, 0xc9, 0xf9, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf8, 0xf8, 0xfa, 0xf9, 0x2b, 0xad, 0x2c, 0x37, 0x31, 0x33, 0x2f, 0x38, 0x2f, 0x2f, 0x2e, 0xb8, 0xf7, 0xf8, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x28, 0xc7, 0x96, 0x89, 0x93, 0x7d, 0x61, 0x6d, 0x62, 0x65, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x73, 0x36, 0x32, 0x30, 0x31, 0x32, 0x32, 0x32, 0x33, 0x32, 0x32, 0x30, 0x32, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x31, 0x32, 0x33, 0x31, 0x31, 0x32, 0x32, 0x43, 0x73, 0x61, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x6f, 0x93, 0x88, 0x7b, 0xbc, 0x28, 0xf3, 0xf8, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf8, 0xfa, 0xf2, 0xc8, 0xca, 0x4d, 0x2e, 0x33, 0x2f, 0x31, 0x33, 0x38, 0x34, 0x2f, 0x2e, 0xa7, 0xff, 0xf3, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc9, 0xc0, 0x7b, 0x86, 0x93, 0x84, 0x61, 0x62, 0x61, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x6d, 0x61, 0x73, 0x41, 0x32, 0x30, 0x31, 0x32, 0x32, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x33, 0x33, 0x2f, 0x36, 0x51, 0x5d, 0x61, 0x6d, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x71, 0x6b, 0x7d, 0x93, 0x8d, 0x7e, 0xa8, 0xc9, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf5, 0xf6, 0xf2, 0x28, 0xc1, 0x2e, 0x31, 0x33, 0x38, 0x37, 0x32, 0x36, 0x36, 0x3a, 0x2f, 0x85, 0xff, 0xf8, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x2a, 0xb5, 0x69, 0x8f, 0x93, 0x88, 0x68, 0x67, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x76, 0x4e, 0x2f, 0x30, 0x33, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x30, 0x31, 0x32, 0x33, 0x2f, 0x33, 0x32, 0x32, 0x3f, 0x72, 0x55, 0x5f, 0x6b, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x68, 0x7d, 0x93, 0x93, 0x86, 0x77, 0xc2, 0xc8, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf5, 0xf8, 0xf4, 0xc8, 0x2b, 0xb1, 0x2e, 0x33, 0x32, 0x32, 0x32, 0x34, 0x43, 0x3f, 0x2f, 0x2f, 0x60, 0xff, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x29, 0xaa, 0x73, 0x88, 0x93, 0x88, 0x71, 0x62, 0x67, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6a, 0x59, 0x36, 0x30, 0x33, 0x31, 0x34, 0x32, 0x32, 0x32, 0x30, 0x32, 0x30, 0x32, 0x31, 0x32, 0x31, 0x30, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x32, 0x32, 0x33, 0x32, 0x33, 0x32, 0x32, 0x34, 0x51, 0x81, 0x5b, 0x6b, 0x6f, 0x6d, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x66, 0x6b, 0x68, 0x7e, 0x98, 0x8d, 0x84, 0x77, 0xb0, 0x29, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf2, 0xc8, 0xc9, 0xa2, 0x2e, 0x37, 0x37, 0x34, 0x36, 0x41, 0x58, 0x51, 0x48, 0x3a, 0x53, 0xff, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0x27, 0x96, 0x77, 0x90, 0x93, 0x93, 0x71, 0x67, 0x67, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x72, 0x43, 0x32, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x33, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x30, 0x32, 0x31, 0x32, 0x31, 0x32, 0x32, 0x34, 0x32, 0x44, 0x64, 0x67, 0x65, 0x6b, 0x6b, 0x6b, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x66, 0x6b, 0x7e, 0x9e, 0x8d, 0x84, 0x86, 0x89, 0xc5, 0xc8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xfa, 0xfb, 0x28, 0x7a, 0x2e, 0x3c, 0x33, 0x33, 0x3f, 0x56, 0x52, 0x55, 0x55, 0x4c, 0x58, 0xff, 0xf2, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf2, 0xf4, 0xc8, 0xfd, 0xc5, 0x82, 0x7f, 0x8d, 0x93, 0x90, 0x7c, 0x61, 0x67, 0x62, 0x6d, 0x62, 0x6d, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x6b, 0x66, 0x67, 0x69, 0x43, 0x2f, 0x32, 0x32, 0x30, 0x33, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x30, 0x33, 0x31, 0x31, 0x32, 0x32, 0x33, 0x31, 0x31, 0x31, 0x2f, 0x33, 0x33, 0x34, 0x3f, 0x4f, 0x76, 0x67, 0x65, 0x66, 0x6d, 0x6d, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x62, 0x8a, 0x98, 0x93, 0x8d, 0x84, 0x77, 0xb6, 0xca, 0xf5, 0xf3, 0xf6, 0xf2, 0x26, 0x26, 0xfb, 0xf8, 0xf4, 0xfa, 0x26, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xf8, 0xfa, 0x26, 0x70, 0x32, 0x34, 0x34, 0x38, 0x50, 0x56, 0x50, 0x5b, 0x55, 0x50, 0x51, 0x2a, 0xf9, 0xf9, 0xf4, 0xf4, 0xf5, 0xf8, 0xf4, 0xf9, 0xfb, 0xca, 0xc0, 0x73, 0x81, 0x86, 0x8f, 0x90, 0x83, 0x68, 0x6d, 0x65, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x66, 0x61, 0x6a, 0x69, 0x49, 0x34, 0x39, 0x33, 0x30, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x31, 0x31, 0x2f, 0x32, 0x31, 0x31, 0x31, 0x31, 0x3e, 0x42, 0x2f, 0x36, 0x44, 0x76, 0x67, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x63, 0x68, 0x90, 0x93, 0x98, 0x84, 0x84, 0x86, 0x97, 0xc7, 0xfb, 0xef, 0xf5, 0xf4, 0xfb, 0x26, 0x26, 0xf8, 0xf8, 0xf4, 0xf8, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xd2, 0xfb, 0xf8, 0x28, 0xc4, 0x70, 0x36, 0x36, 0x36, 0x43, 0x56, 0x55, 0x55, 0x5b, 0x55, 0x50, 0x4a, 0xc3, 0xfd, 0x26, 0xf9, 0xf2, 0xf4, 0xf8, 0xf9, 0xc8, 0xfb, 0x28, 0xba, 0x72, 0x86, 0x95, 0x90, 0x8a, 0x8a, 0x71, 0x63, 0x62, 0x6d, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x6b, 0x62, 0x65, 0x61, 0x67, 0x5d, 0x69, 0x43, 0x36, 0x42, 0x30, 0x30, 0x30, 0x30, 0x32, 0x31, 0x32, 0x30, 0x32, 0x32, 0x31, 0x33, 0x33, 0x32, 0x31, 0x31, 0x31, 0x34, 0x42, 0x41, 0x36, 0x4a, 0x72, 0x6a, 0x67, 0x65, 0x66, 0x67, 0x62, 0x68, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x65, 0x6a, 0x93, 0x93, 0x9b, 0x80, 0x86, 0x8f, 0x81, 0xbe, 0x2a, 0xfb, 0xf5, 0xf3, 0xf4, 0x26, 0xf4, 0xf5, 0xf8, 0xf8, 0xf4, 0xf8, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xcf, 0xf8, 0xfe, 0xc1, 0x79, 0x41, 0x3a, 0x3f, 0x52, 0x55, 0x50, 0x55, 0x55, 0x50, 0x55, 0x45, 0xb0, 0xca, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xfe, 0xb0, 0x73, 0x86, 0x95, 0x93, 0x8a, 0x90, 0x71, 0x62, 0x65, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x65, 0x62, 0x65, 0x61, 0x69, 0x5c, 0x49, 0x32, 0x37, 0x31, 0x30, 0x31, 0x32, 0x31, 0x32, 0x32, 0x32, 0x31, 0x31, 0x32, 0x32, 0x32, 0x31, 0x30, 0x36, 0x49, 0x43, 0x4e, 0x77, 0x63, 0x61, 0x65, 0x62, 0x6d, 0x67, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x6f, 0x6d, 0x6d, 0x6d, 0x65, 0x71, 0x9e, 0x90, 0x9b, 0x8a, 0x84, 0x95, 0x81, 0xae, 0x27, 0x26, 0xf4, 0xf3, 0xf8, 0xf3, 0xf8, 0xf5, 0xf8, 0xf3, 0xf8, 0xf3, 0xf8, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0x28, 0xc1, 0x79, 0x4e, 0x3f, 0x4c, 0x59, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x55, 0x4c, 0x87, 0xc9, 0xc7, 0xf4, 0xc8, 0xf4, 0xc8, 0xd2, 0x26, 0xd2, 0xfd, 0xaa, 0x78, 0x86, 0x95, 0x90, 0x90, 0x90, 0x7c, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x6d, 0x62, 0x61, 0x63, 0x61, 0x66, 0x66, 0x5f, 0x6a, 0x72, 0x58, 0x3a, 0x3c, 0x42, 0x2e, 0x31, 0x30, 0x33, 0x30, 0x32, 0x32, 0x31, 0x33, 0x32, 0x32, 0x33, 0x33, 0x2f, 0x41, 0x4f, 0x56, 0x67, 0x67, 0x62, 0x65, 0x5f, 0x65, 0x6d, 0x6a, 0x62, 0x6d, 0x6d, 0x62, 0x6d, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x65, 0x76, 0x9e, 0x90, 0x9b, 0x8a, 0x84, 0xa4, 0x98, 0xa5, 0xc5, 0xc9, 0xd2, 0xf3, 0xf3, 0xf2, 0xf5, 0xf3, 0xf2, 0xf8, 0xf5, 0xf8, 0xf3, 0xf3, 0xf4, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf9, 0xd2, 0xf9, 0xfa, 0xc6, 0x79, 0x69, 0x4e, 0x56, 0x55, 0x55, 0x50, 0x5b, 0x55, 0x5b, 0x50, 0x5b, 0x51, 0xc2, 0x2b, 0x2a, 0xca, 0x2a, 0xca, 0x2b, 0x2b, 0xc8, 0xca, 0xa5, 0x7f, 0x84, 0x9e, 0x8a, 0x91, 0x8a, 0x83, 0x62, 0x65, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x67, 0x62, 0x66, 0x66, 0x66, 0x5f, 0x5d, 0x72, 0x4f, 0x3b, 0x53, 0x2f, 0x32, 0x31, 0x31, 0x31, 0x32, 0x32, 0x33, 0x30, 0x32, 0x32, 0x32, 0x37, 0x32, 0x4a, 0x5d, 0x74, 0x62, 0x6d, 0x6e, 0x66, 0x6e, 0x6d, 0x62, 0x68, 0x68, 0x6d, 0x62, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6b, 0x62, 0x62, 0x84, 0x98, 0x90, 0x8f, 0x8f, 0x80, 0xa4, 0x9b, 0x96, 0xbe, 0x29, 0x2b, 0x2b, 0xf1, 0x2b, 0xf9, 0xcf, 0xfd, 0xf2, 0xf4, 0xf2, 0xf3, 0xf5, 0xf5, 0xf9, 0xf9, 0x26, 0xf5, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xcf, 0xf2, 0xf8, 0x28, 0xc6, 0x79, 0x5d, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x55, 0x55, 0x4e, 0xab, 0xb3, 0xa2, 0x79, 0x87, 0x92, 0xa8, 0xb0, 0xbe, 0xc7, 0xa3, 0x78, 0x90, 0x9e, 0x90, 0x8b, 0x90, 0x8a, 0x6f, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x67, 0x62, 0x66, 0x66, 0x66, 0x66, 0x61, 0x71, 0x72, 0x4a, 0x49, 0x39, 0x32, 0x33, 0x31, 0x33, 0x32, 0x32, 0x33, 0x33, 0x32, 0x32, 0x34, 0x2f, 0x3f, 0x58, 0x7e, 0x5f, 0x6b, 0x66, 0x6b, 0x65, 0x65, 0x6b, 0x6d, 0x68, 0x68, 0x6d, 0x6d, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x6d, 0x65, 0x8d, 0x95, 0x8f, 0x8f, 0x98, 0x74, 0xa4, 0xa4, 0x95, 0xa5, 0xaa, 0xa2, 0xa5, 0xac, 0xb9, 0xc6, 0xc9, 0xc9, 0x26, 0x26, 0xf9, 0xf8, 0xf5, 0xf5, 0xf4, 0xfa, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf8, 0xfa, 0xc7, 0x96, 0x69, 0x5e, 0x56, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x50, 0x88, 0x69, 0x52, 0x56, 0x5d, 0x56, 0x56, 0x52, 0x56, 0x58, 0x82, 0x86, 0x83, 0x8a, 0x9e, 0x90, 0x86, 0x91, 0x8a, 0x74, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x62, 0x6d, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x6b, 0x68, 0x6f, 0x69, 0x58, 0x41, 0x2f, 0x32, 0x32, 0x31, 0x32, 0x32, 0x33, 0x33, 0x37, 0x34, 0x32, 0x2f, 0x49, 0x5d, 0x7d, 0x5f, 0x6b, 0x6b, 0x6d, 0x66, 0x62, 0x65, 0x68, 0x6b, 0x68, 0x6d, 0x62, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x62, 0x74, 0x8d, 0x95, 0x94, 0x8f, 0x8f, 0x7c, 0xa4, 0x88, 0x6a, 0x56, 0x52, 0x59, 0x56, 0x56, 0x5c, 0x5c, 0xa8, 0xc3, 0x2a, 0xc8, 0xc8, 0xf6, 0xf5, 0xf8, 0xf9, 0xfa, 0x26, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xfa, 0x26, 0x29, 0xa8, 0x73, 0x5e, 0x56, 0x50, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x66, 0x88, 0x6b, 0x61, 0x6b, 0x5f, 0x66, 0x66, 0x7d, 0x6f, 0x5f, 0x6f, 0x61, 0x68, 0x83, 0x93, 0xa4, 0x90, 0x8b, 0x8a, 0x90, 0x7d, 0x65, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x68, 0x62, 0x6a, 0x61, 0x6a, 0x61, 0x6b, 0x66, 0x6b, 0x6c, 0x64, 0x4f, 0x34, 0x32, 0x31, 0x31, 0x31, 0x32, 0x33, 0x37, 0x32, 0x34, 0x32, 0x3a, 0x5a, 0x76, 0x5f, 0x6f, 0x68, 0x6b, 0x68, 0x62, 0x6d, 0x68, 0x6d, 0x68, 0x6b, 0x6d, 0x68, 0x6b, 0x62, 0x6b, 0x6d, 0x6d, 0x6d, 0x68, 0x74, 0x98, 0x8f, 0x94, 0x8f, 0x8f, 0x7d, 0x80, 0x68, 0x6d, 0x6f, 0x6f, 0x6f, 0x5f, 0x66, 0x66, 0x6a, 0x52, 0x5a, 0xb5, 0x29, 0x26, 0xf4, 0xf8, 0xf6, 0xf8, 0xfa, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf5, 0xf8, 0xca, 0xb3, 0x72, 0x73, 0x56, 0x56, 0x52, 0x50, 0x56, 0x55, 0x66, 0x88, 0x6e, 0x5f, 0x62, 0x6f, 0x6b, 0x6f, 0x66, 0x66, 0x66, 0x6f, 0x6f, 0x6f, 0x71, 0x83, 0x98, 0xa4, 0x8a, 0x8a, 0x8a, 0x90, 0x84, 0x62, 0x6d, 0x6d, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x62, 0x6d, 0x62, 0x62, 0x61, 0x62, 0x67, 0x68, 0x62, 0x6b, 0x5f, 0x67, 0x69, 0x58, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x39, 0x2f, 0x49, 0x5d, 0x7e, 0x5f, 0x6f, 0x68, 0x68, 0x6d, 0x6d, 0x68, 0x6d, 0x6d, 0x62, 0x6d, 0x68, 0x6d, 0x6d, 0x65, 0x6d, 0x6e, 0x61, 0x6d, 0x62, 0x7e, 0x9e, 0x8f, 0x95, 0x8f, 0x98, 0x71, 0x68, 0x6b, 0x62, 0x65, 0x6d, 0x66, 0x66, 0x6e, 0x66, 0x65, 0x6a, 0x5d, 0x4f, 0xb7, 0x29, 0x27, 0xf3, 0xf8, 0xf5, 0xf4, 0xfb, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xd2, 0xf3, 0xd2, 0x28, 0xc0, 0x77, 0x9e, 0x6a, 0x52, 0x55, 0x52, 0x4b, 0x55, 0x88, 0x74, 0x65, 0x65, 0x65, 0x62, 0x6d, 0x6d, 0x68, 0x6d, 0x71, 0x71, 0x71, 0x71, 0x71, 0x7e, 0x9b, 0x9e, 0x90, 0x8a, 0x8d, 0x8f, 0x8d, 0x6a, 0x6f, 0x62, 0x6d, 0x62, 0x68, 0x6d, 0x68, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x72, 0x58, 0x40, 0x2f, 0x32, 0x30, 0x32, 0x34, 0x32, 0x32, 0x39, 0x2f, 0x3a, 0x58, 0x72, 0x68, 0x66, 0x6f, 0x6d, 0x6d, 0x6d, 0x68, 0x6d, 0x62, 0x6d, 0x68, 0x6d, 0x68, 0x62, 0x62, 0x65, 0x65, 0x6f, 0x65, 0x6d, 0x61, 0x8d, 0x99, 0x90, 0x8f, 0x93, 0x98, 0x71, 0x6d, 0x67, 0x65, 0x62, 0x65, 0x67, 0x65, 0x6d, 0x67, 0x6d, 0x6d, 0x67, 0x6a, 0x4e, 0xb6, 0x29, 0xfa, 0xf3, 0xf2, 0xc8, 0xcf, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0x26, 0xf2, 0xf3, 0xc8, 0xc7, 0x8e, 0x81, 0x8d, 0x68, 0x56, 0x56, 0x55, 0x71, 0x8d, 0x65, 0x5f, 0x65, 0x65, 0x6d, 0x68, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x71, 0x68, 0x80, 0x9b, 0x9e, 0x98, 0x8a, 0x8f, 0x8d, 0x86, 0x74, 0x68, 0x6d, 0x6d, 0x62, 0x6d, 0x68, 0x6d, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x6a, 0x64, 0x46, 0x2f, 0x32, 0x32, 0x34, 0x32, 0x3c, 0x30, 0x3c, 0x32, 0x41, 0x58, 0x76, 0x68, 0x66, 0x6b, 0x6d, 0x62, 0x68, 0x62, 0x68, 0x6d, 0x68, 0x65, 0x68, 0x68, 0x65, 0x6d, 0x6d, 0x65, 0x6d, 0x6d, 0x5f, 0x68, 0x95, 0x95, 0x8d, 0x90, 0x95, 0x93, 0x6d, 0x6d, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x6d, 0x65, 0x6d, 0x63, 0x67, 0x5d, 0x64, 0xc3, 0xc9, 0xf8, 0xf5, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xc8, 0xf4, 0xf3, 0xcf, 0x2a, 0xaa, 0x72, 0x88, 0x88, 0x61, 0x5d, 0x61, 0x80, 0x74, 0x5f, 0x6d, 0x5f, 0x65, 0x6d, 0x68, 0x6d, 0x62, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x76, 0x9b, 0x9b, 0x98, 0x90, 0x8a, 0x8d, 0x8f, 0x7e, 0x65, 0x68, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x67, 0x73, 0x4f, 0x2f, 0x32, 0x37, 0x32, 0x37, 0x37, 0x33, 0x34, 0x3f, 0x4f, 0x5d, 0x72, 0x6f, 0x66, 0x66, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x62, 0x6d, 0x68, 0x6d, 0x68, 0x62, 0x62, 0x65, 0x62, 0x65, 0x6d, 0x62, 0x7c, 0x98, 0x8f, 0x90, 0x8f, 0x9b, 0x8d, 0x61, 0x6d, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x6d, 0x6d, 0x65, 0x6d, 0x66, 0x62, 0x61, 0x56, 0xa5, 0xc9, 0xfd, 0xef, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0x26, 0xfb, 0xf2, 0xf5, 0xca, 0xbc, 0x64, 0x88, 0x93, 0x8d, 0x61, 0x76, 0x84, 0x65, 0x5f, 0x65, 0x6d, 0x62, 0x6d, 0x6d, 0x68, 0x6d, 0x68, 0x62, 0x6f, 0x68, 0x6f, 0x68, 0x7c, 0x9b, 0x98, 0x9e, 0x90, 0x8a, 0x8f, 0x8f, 0x80, 0x68, 0x6d, 0x62, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x68, 0x62, 0x65, 0x6a, 0x69, 0x58, 0x34, 0x34, 0x32, 0x34, 0x37, 0x32, 0x37, 0x32, 0x44, 0x64, 0x7f, 0x68, 0x6f, 0x66, 0x6f, 0x6d, 0x62, 0x68, 0x62, 0x68, 0x6d, 0x68, 0x62, 0x68, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x68, 0x84, 0x99, 0x8f, 0x95, 0x90, 0x9e, 0x8a, 0x5f, 0x6a, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x6d, 0x65, 0x62, 0x6d, 0x65, 0x66, 0x6f, 0x6a, 0x58, 0xbc, 0x2a, 0xf2, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf5, 0xfb, 0x26, 0x26, 0xf5, 0xf4, 0xef, 0x27, 0x92, 0x80, 0x80, 0x8d, 0x86, 0x84, 0x7d, 0x62, 0x6b, 0x62, 0x62, 0x61, 0x6d, 0x68, 0x6d, 0x62, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x68, 0x76, 0x9b, 0x98, 0x9b, 0x99, 0x8a, 0x90, 0x8a, 0x8d, 0x6d, 0x5f, 0x6d, 0x62, 0x68, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x6d, 0x6d, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x34, 0x34, 0x32, 0x37, 0x37, 0x34, 0x36, 0x64, 0x73, 0x7e, 0x68, 0x6b, 0x66, 0x6b, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x62, 0x68, 0x6d, 0x62, 0x6b, 0x62, 0x62, 0x65, 0x62, 0x6d, 0x71, 0x68, 0x93, 0x95, 0x8f, 0x8a, 0x98, 0x9e, 0x84, 0x68, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x65, 0x6f, 0x6e, 0x66, 0x6d, 0x56, 0xaa, 0x2a, 0xfb, 0xf2, 0xf6, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xfb, 0xfb, 0xfa, 0xf4, 0xf2, 0xca, 0xbc, 0x69, 0x8a, 0x84, 0x88, 0x93, 0x6f, 0x5f, 0x66, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x68, 0x6d, 0x68, 0x62, 0x6f, 0x68, 0x71, 0x6d, 0x71, 0x9b, 0x98, 0x98, 0x98, 0x90, 0x8f, 0x8a, 0x8d, 0x71, 0x62, 0x68, 0x6d, 0x6d, 0x62, 0x68, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x6d, 0x6f, 0x62, 0x67, 0x69, 0x41, 0x34, 0x34, 0x3c, 0x37, 0x34, 0x36, 0x4a, 0x73, 0x7e, 0x7d, 0x6b, 0x6b, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x68, 0x62, 0x6d, 0x68, 0x62, 0x6d, 0x65, 0x6d, 0x71, 0x68, 0x71, 0x93, 0x95, 0x8d, 0x95, 0x98, 0x9e, 0x84, 0x68, 0x61, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x6d, 0x6e, 0x66, 0x5b, 0x79, 0xc7, 0x28, 0xfa, 0xf8, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf4, 0x26, 0xf4, 0xf4, 0xc8, 0x2a, 0x87, 0x77, 0x84, 0x8d, 0x88, 0x5f, 0x6d, 0x6b, 0x62, 0x62, 0x67, 0x68, 0x6d, 0x6d, 0x62, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x71, 0x71, 0x98, 0x98, 0x98, 0x9e, 0x95, 0x8a, 0x8f, 0x8d, 0x7d, 0x68, 0x6d, 0x68, 0x6d, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x68, 0x6f, 0x61, 0x63, 0x69, 0x4a, 0x34, 0x32, 0x37, 0x37, 0x34, 0x36, 0x7b, 0x7f, 0x83, 0x7d, 0x6b, 0x6d, 0x61, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x62, 0x68, 0x6d, 0x68, 0x6d, 0x62, 0x65, 0x62, 0x6d, 0x68, 0x68, 0x83, 0x98, 0x90, 0x8f, 0x95, 0x98, 0x9e, 0x84, 0x61, 0x61, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65, 0x6a, 0x67, 0x66, 0x6e, 0x67, 0x5c, 0xc2, 0x28, 0xf8, 0xf8, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf8, 0xf8, 0xfa, 0x26, 0x26, 0xf4, 0xf4, 0xca, 0xc2, 0x82, 0x84, 0x9b, 0x80, 0x5f, 0x66, 0x5f, 0x6d, 0x62, 0x61, 0x62, 0x6d, 0x6b, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6f, 0x71, 0x6d, 0x93, 0x98, 0x98, 0x9c, 0x98, 0x8a, 0x8c, 0x93, 0x80, 0x62, 0x6d, 0x6d, 0x6d, 0x62, 0x68, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x6d, 0x6b, 0x6d, 0x63, 0x5d, 0x51, 0x39, 0x34, 0x3c, 0x37, 0x36, 0x4a, 0x8c, 0x7f, 0x88, 0x6b, 0x6b, 0x68, 0x67, 0x6a, 0x6d, 0x62, 0x6d, 0x62, 0x6d, 0x6d, 0x6d, 0x62, 0x6b, 0x62, 0x6d, 0x62, 0x6d, 0x6d, 0x71, 0x5e, 0x88, 0x98, 0x90, 0x8f, 0x98, 0x9e, 0x98, 0x84, 0x61, 0x5f, 0x61, 0x65, 0x62, 0x65, 0x65, 0x65, 0x65, 0x62, 0x6d, 0x65, 0x67, 0x6a, 0x6e, 0x6e, 0x65, 0x52, 0xb7, 0x28, 0xfa, 0xf6, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf5, 0xf8, 0xf8, 0x26, 0xfb, 0xf4, 0xf9, 0xfb, 0x2b, 0xb5, 0x69, 0x9e, 0x7d, 0x66, 0x6b, 0x66, 0x68, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6a, 0x6a, 0x8d, 0x93, 0x95, 0x9b, 0x99, 0x8a, 0x8a, 0x8f, 0x84, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x68, 0x6d, 0x6b, 0x63, 0x69, 0x5c, 0x39, 0x37, 0x3c, 0x37, 0x3f, 0x7f, 0x86, 0x8a, 0x84, 0x6b, 0x6b, 0x62, 0x68, 0x6d, 0x68, 0x68, 0x68, 0x68, 0x68, 0x62, 0x68, 0x68, 0x6d, 0x62, 0x62, 0x6d, 0x62, 0x68, 0x62, 0x68, 0x90, 0x98, 0x8d, 0x8f, 0x9e, 0x9e, 0x9e, 0x7c, 0x61, 0x61, 0x62, 0x62, 0x62, 0x68, 0x61, 0x62, 0x62, 0x65, 0x62, 0x61, 0x67, 0x63, 0x6d, 0x6e, 0x63, 0x59, 0xb3, 0x2a, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf8, 0xf4, 0xf4, 0xf4, 0xf7, 0xf2, 0xf7, 0xf1, 0xae, 0x89, 0x7c, 0x66, 0x66, 0x66, 0x62, 0x68, 0x61, 0x62, 0x61, 0x6d, 0x62, 0x62, 0x6d, 0x6d, 0x6d, 0x6a, 0x6d, 0x6a, 0x8d, 0x9b, 0x93, 0x95, 0x9b, 0x94, 0x8a, 0x8f, 0x8a, 0x6a, 0x6a, 0x62, 0x62, 0x62, 0x68, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x6d, 0x6b, 0x6b, 0x65, 0x67, 0x64, 0x40, 0x37, 0x3d, 0x32, 0x56, 0x91, 0x83, 0x8a, 0x7d, 0x68, 0x6b, 0x6b, 0x6b, 0x5f, 0x68, 0x62, 0x68, 0x62, 0x68, 0x68, 0x6d, 0x62, 0x68, 0x65, 0x68, 0x65, 0x62, 0x62, 0x61, 0x76, 0x93, 0x99, 0x8d, 0x8f, 0x9e, 0x9c, 0x9e, 0x7c, 0x5b, 0x67, 0x61, 0x65, 0x62, 0x62, 0x68, 0x62, 0x62, 0x63, 0x61, 0x6a, 0x63, 0x65, 0x6b, 0x6f, 0x63, 0x59, 0xb0, 0x29, 0xf9, 0xcf, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0x28, 0xc6, 0xab, 0x72, 0x5f, 0x66, 0x5f, 0x68, 0x62, 0x68, 0x62, 0x62, 0x62, 0x6b, 0x62, 0x68, 0x6d, 0x6d, 0x6d, 0x68, 0x6a, 0x84, 0x98, 0x93, 0x98, 0x9b, 0x98, 0x91, 0x8a, 0x8a, 0x7c, 0x5e, 0x6d, 0x61, 0x6b, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x68, 0x65, 0x68, 0x62, 0x6f, 0x65, 0x72, 0x72, 0x46, 0x39, 0x38, 0x40, 0x86, 0x90, 0x83, 0x8d, 0x71, 0x6d, 0x68, 0x6b, 0x6b, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x62, 0x68, 0x68, 0x6d, 0x62, 0x65, 0x68, 0x65, 0x68, 0x61, 0x7c, 0x95, 0x90, 0x8f, 0x9c, 0xa3, 0x9c, 0x9b, 0x76, 0x5f, 0x63, 0x62, 0x65, 0x65, 0x61, 0x68, 0x62, 0x5f, 0x63, 0x62, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x63, 0x59, 0xae, 0xca, 0xf6, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf8, 0xf4, 0xf2, 0xf6, 0xf2, 0xf9, 0xf4, 0xc8, 0xc9, 0xc5, 0x69, 0x5e, 0x66, 0x68, 0x62, 0x68, 0x5f, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x6d, 0x68, 0x6f, 0x68, 0x7c, 0x9b, 0x93, 0x98, 0x9b, 0x9e, 0x93, 0x8a, 0x90, 0x7c, 0x61, 0x61, 0x62, 0x62, 0x68, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x6d, 0x61, 0x6b, 0x65, 0x62, 0x69, 0x4a, 0x3b, 0x3a, 0x64, 0x91, 0x8a, 0x8a, 0x8a, 0x62, 0x6b, 0x6d, 0x62, 0x68, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x62, 0x62, 0x6d, 0x62, 0x68, 0x8a, 0x98, 0x90, 0x95, 0x9e, 0x9c, 0x9c, 0x9e, 0x74, 0x5b, 0x5f, 0x65, 0x65, 0x65, 0x62, 0x68, 0x62, 0x63, 0x65, 0x62, 0x68, 0x65, 0x65, 0x68, 0x6f, 0x6e, 0x52, 0xb0, 0x29, 0xf9, 0xd2, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xd2, 0xf9, 0xf2, 0xc9, 0x27, 0x82, 0x5e, 0x62, 0x62, 0x68, 0x62, 0x6b, 0x5f, 0x6b, 0x68, 0x61, 0x5f, 0x61, 0x68, 0x62, 0x6b, 0x71, 0x68, 0x7c, 0x9b, 0x98, 0x9b, 0x9b, 0x9b, 0x9b, 0x8a, 0x90, 0x7e, 0x61, 0x68, 0x61, 0x6b, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x68, 0x6d, 0x5f, 0x6d, 0x69, 0x54, 0x3f, 0x44, 0x8c, 0x8a, 0x8a, 0x93, 0x84, 0x68, 0x68, 0x6d, 0x68, 0x68, 0x62, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6d, 0x6d, 0x6d, 0x62, 0x68, 0x68, 0x8d, 0x95, 0x8a, 0x98, 0xa0, 0x9c, 0x9c, 0x9e, 0x74, 0x5b, 0x65, 0x5f, 0x65, 0x63, 0x61, 0x61, 0x65, 0x5f, 0x65, 0x65, 0x68, 0x63, 0x65, 0x68, 0x6f, 0x63, 0x59, 0xb0, 0x2a, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf8, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xc8, 0x27, 0x96, 0x5d, 0x62, 0x6b, 0x62, 0x5f, 0x5f, 0x5f, 0x5f, 0x61, 0x68, 0x7e, 0x5e, 0x5b, 0x68, 0x6b, 0x5f, 0x6c, 0x71, 0x95, 0x9b, 0x9e, 0x90, 0x9e, 0x9b, 0x90, 0x90, 0x84, 0x61, 0x68, 0x62, 0x62, 0x68, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x71, 0x68, 0x65, 0x6f, 0x72, 0x5c, 0x02, 0x7f, 0x90, 0x8a, 0x8a, 0x90, 0x7d, 0x68, 0x6d, 0x62, 0x62, 0x68, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x68, 0x6d, 0x6d, 0x61, 0x71, 0x90, 0x95, 0x90, 0xa0, 0x9e, 0xa0, 0xa3, 0x8f, 0x67, 0x5b, 0x65, 0x66, 0x63, 0x5b, 0x5e, 0x5e, 0x62, 0x62, 0x65, 0x5f, 0x6b, 0x65, 0x65, 0x68, 0x6f, 0x74, 0x52, 0xb3, 0x2a, 0xf2, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xf4, 0xf5, 0x2a, 0xa8, 0x56, 0x62, 0x68, 0x5f, 0x62, 0x5f, 0x5f, 0x5e, 0x76, 0xa6, 0xab, 0xa6, 0x72, 0x61, 0x68, 0x71, 0x68, 0x71, 0x8a, 0x8c, 0x86, 0x9e, 0x98, 0x9b, 0x93, 0x8f, 0x84, 0x5e, 0x6d, 0x61, 0x6b, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x6d, 0x62, 0x6a, 0x68, 0x66, 0x71, 0x78, 0x5d, 0x57, 0x8b, 0x8a, 0x93, 0x8a, 0x93, 0x7c, 0x68, 0x62, 0x68, 0x61, 0x68, 0x61, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x68, 0x6d, 0x68, 0x6d, 0x61, 0x7c, 0x90, 0x90, 0x90, 0x9e, 0xa0, 0xa4, 0x81, 0x69, 0x61, 0x67, 0x5f, 0x68, 0x5e, 0x8a, 0xab, 0xa4, 0x5e, 0x62, 0x5f, 0x65, 0x6b, 0x65, 0x67, 0x68, 0x71, 0x63, 0x56, 0xb5, 0x29, 0xf9, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf8, 0xf4, 0xf2, 0xf4, 0xf4, 0xd2, 0x26, 0xf5, 0xf4, 0x2a, 0xaf, 0x57, 0x5f, 0x6b, 0x5f, 0x62, 0x5f, 0x5e, 0x62, 0x9e, 0xa6, 0xa6, 0xab, 0x95, 0x5e, 0x61, 0x5e, 0x90, 0xa6, 0xa6, 0xa6, 0x99, 0x7f, 0x9e, 0x9b, 0xa4, 0x8d, 0x8a, 0x61, 0x62, 0x62, 0x62, 0x68, 0x62, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x62, 0x62, 0x62, 0x6a, 0x68, 0x6f, 0x6d, 0x72, 0x69, 0x57, 0x8b, 0x84, 0x93, 0x8a, 0x93, 0x7d, 0x68, 0x62, 0x68, 0x61, 0x68, 0x68, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x68, 0x68, 0x6d, 0x61, 0x7c, 0x95, 0x8a, 0x94, 0xa4, 0xa3, 0x73, 0xa3, 0xb2, 0x8c, 0x63, 0x5e, 0x5f, 0x8b, 0xb2, 0x22, 0x22, 0x6a, 0x5e, 0x66, 0x68, 0x6b, 0x65, 0x65, 0x68, 0x6b, 0x74, 0x52, 0xba, 0x28, 0xfa, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xf4, 0xf8, 0x29, 0xb7, 0x56, 0x68, 0x5f, 0x5f, 0x5f, 0x5f, 0x5b, 0x76, 0x99, 0x97, 0xab, 0xa6, 0xab, 0x56, 0x71, 0x61, 0xa9, 0xab, 0xa3, 0xb2, 0xbb, 0xb2, 0x76, 0x90, 0x9e, 0x95, 0x84, 0x68, 0x61, 0x62, 0x68, 0x62, 0x6d, 0x68, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6d, 0x6d, 0x62, 0x68, 0x6f, 0x62, 0x66, 0x73, 0x73, 0x57, 0x94, 0x9c, 0x93, 0x88, 0x93, 0x7c, 0x68, 0x62, 0x68, 0x61, 0x6a, 0x61, 0x62, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x62, 0x68, 0x68, 0x6d, 0x6a, 0x68, 0x80, 0x95, 0x8a, 0xa6, 0xa4, 0x73, 0xb2, 0xbb, 0xaf, 0x99, 0x5d, 0x6a, 0x78, 0xb2, 0x21, 0xab, 0x22, 0x6c, 0x5e, 0x62, 0x6b, 0x5f, 0x5f, 0x65, 0x6c, 0x6f, 0x67, 0x59, 0xc0, 0xc9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xd2, 0xf9, 0xf4, 0xf3, 0xca, 0xbe, 0x5e, 0x68, 0x5f, 0x5f, 0x5f, 0x5f, 0x55, 0x86, 0x95, 0x89, 0xab, 0xab, 0xab, 0x5e, 0x76, 0x78, 0xa4, 0xa4, 0x99, 0x97, 0xb6, 0xb6, 0xb2, 0x73, 0x8f, 0x95, 0x8a, 0x6a, 0x6a, 0x62, 0x6d, 0x5f, 0x62, 0x62, 0x62, 0x67, 0x6d, 0x62, 0x61, 0x67, 0x62, 0x6a, 0x67, 0x6a, 0x68, 0x6f, 0x61, 0x6a, 0x73, 0x57, 0x99, 0x9c, 0x93, 0x91, 0x93, 0x78, 0x62, 0x61, 0x61, 0x6a, 0x61, 0x6a, 0x62, 0x61, 0x61, 0x62, 0x62, 0x61, 0x62, 0x62, 0x68, 0x6b, 0x68, 0x6b, 0x71, 0x68, 0x83, 0x90, 0x9c, 0xa4, 0x73, 0xab, 0xba, 0xb6, 0xaf, 0xa6, 0x59, 0x56, 0xa9, 0x22, 0x22, 0x22, 0x1f, 0x6c, 0x6c, 0x5f, 0x6c, 0x83, 0x83, 0x68, 0x68, 0x6f, 0x65, 0x64, 0xc2, 0x2a, 0xf2, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf3, 0xfe, 0xc5, 0x77, 0x61, 0x66, 0x5f, 0x88, 0x8a, 0x5b, 0x63, 0xa6, 0x8c, 0xa6, 0xab, 0xa6, 0x72, 0x71, 0x71, 0x83, 0x88, 0x7f, 0x83, 0xb2, 0xb6, 0xb6, 0xaa, 0x5d, 0x8c, 0x86, 0x67, 0x61, 0x62, 0x62, 0x65, 0x71, 0x6d, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x61, 0x68, 0x6a, 0x61, 0x67, 0x62, 0x68, 0x69, 0x77, 0x54, 0x94, 0x9c, 0xa0, 0x93, 0x93, 0x78, 0x5e, 0x61, 0x61, 0x61, 0x61, 0x63, 0x5d, 0x63, 0x61, 0x67, 0x67, 0x6a, 0x61, 0x67, 0x62, 0x6b, 0x5f, 0x6b, 0x68, 0x71, 0x83, 0x90, 0xa0, 0x7f, 0xab, 0xbb, 0xb5, 0xba, 0xb6, 0xb2, 0x5e, 0x6c, 0x75, 0x57, 0x57, 0x22, 0xb2, 0x57, 0x5e, 0x6c, 0xa4, 0x1c, 0x22, 0x0c, 0x5f, 0x6f, 0x5b, 0x79, 0xc7, 0xc8, 0xf2, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xd2, 0x27, 0x96, 0x5e, 0x6f, 0x65, 0x9e, 0xa4, 0x76, 0x5b, 0x76, 0x7f, 0x57, 0x75, 0x57, 0x08, 0x78, 0x78, 0x6c, 0x6b, 0x78, 0x7f, 0x91, 0x22, 0xb6, 0xab, 0x72, 0x8a, 0x80, 0x5f, 0x6d, 0x65, 0x6d, 0x6a, 0x61, 0x61, 0x6a, 0x6a, 0x61, 0x61, 0x62, 0x62, 0x62, 0x66, 0x6d, 0x62, 0x6d, 0x6b, 0x68, 0x69, 0x73, 0x54, 0x94, 0xa0, 0xa0, 0x9b, 0x91, 0x71, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x5f, 0x61, 0x63, 0x6a, 0x61, 0x61, 0x6a, 0x61, 0x61, 0x62, 0x6d, 0x6d, 0x62, 0x68, 0x88, 0x90, 0x84, 0x6a, 0xab, 0xb6, 0xba, 0xaa, 0xab, 0x81, 0x5e, 0x09, 0x57, 0x08, 0x09, 0x09, 0x0b, 0x09, 0x09, 0x9b, 0x1c, 0x1f, 0xa9, 0xa0, 0x5f, 0x6b, 0x5d, 0x96, 0xc9, 0xc8, 0xd2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf3, 0x26, 0x29, 0xaa, 0x52, 0x71, 0x74, 0xa6, 0xa6, 0x8a, 0x09, 0x54, 0x54, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x78, 0x78, 0x80, 0x83, 0x86, 0x98, 0x8f, 0x88, 0x93, 0x71, 0x5f, 0x68, 0x6a, 0x6a, 0x6a, 0x72, 0x72, 0x69, 0x76, 0x72, 0x71, 0x61, 0x62, 0x62, 0x66, 0x66, 0x6d, 0x6d, 0x66, 0x68, 0x6a, 0x77, 0x57, 0x97, 0xa4, 0xa4, 0x9c, 0x93, 0x68, 0x5f, 0x62, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x6d, 0x68, 0x6a, 0x6a, 0x6a, 0x69, 0x6a, 0x69, 0x72, 0x72, 0x72, 0x67, 0x67, 0x8d, 0x8d, 0x71, 0x71, 0x72, 0xb2, 0xb6, 0x82, 0x82, 0x6c, 0x6c, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x54, 0x09, 0x21, 0xa9, 0x1f, 0x1c, 0xa9, 0x68, 0x6b, 0x52, 0xaa, 0x29, 0xd2, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf9, 0x2a, 0xba, 0x58, 0x6a, 0x67, 0xb2, 0xab, 0x0c, 0x09, 0x09, 0x0a, 0x0b, 0x0f, 0x0f, 0x0d, 0x0b, 0x0b, 0x09, 0x78, 0x78, 0x83, 0x83, 0x91, 0x8a, 0x90, 0x93, 0x88, 0x6c, 0x76, 0x5d, 0x59, 0x4e, 0x43, 0x41, 0x44, 0x44, 0x44, 0x4e, 0x56, 0x5d, 0x6a, 0x6a, 0x67, 0x6a, 0x68, 0x68, 0x66, 0x6b, 0x6a, 0x73, 0x58, 0xa1, 0xa1, 0xa4, 0xa4, 0x93, 0x68, 0x61, 0x6b, 0x62, 0x62, 0x61, 0x61, 0x69, 0x5e, 0x69, 0x56, 0x5c, 0x54, 0x4a, 0x4a, 0x4a, 0x4a, 0x4e, 0x5c, 0x69, 0x72, 0x86, 0x8d, 0x7d, 0x74, 0x76, 0x8c, 0x97, 0x8e, 0x91, 0x09, 0x09, 0x09, 0x0b, 0x0f, 0x10, 0x0f, 0x0b, 0x0a, 0x09, 0x0b, 0x21, 0x21, 0xa9, 0xa9, 0x5f, 0x5e, 0x52, 0xb5, 0x2a, 0xf4, 0xf2, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xfb, 0x28, 0xc3, 0x58, 0x72, 0x5b, 0xb6, 0xbb, 0x0b, 0x09, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x11, 0x0f, 0x0b, 0x0b, 0x0b, 0x78, 0x12, 0x83, 0x91, 0x9b, 0x9e, 0x7f, 0x73, 0x5d, 0x41, 0x36, 0x36, 0x36, 0x34, 0x34, 0x34, 0x36, 0x36, 0x3a, 0x41, 0x4a, 0x5c, 0x69, 0x72, 0x6a, 0x68, 0x6b, 0x62, 0x71, 0x77, 0x54, 0xa3, 0x18, 0xa6, 0x99, 0x8a, 0x5e, 0x5f, 0x61, 0x68, 0x5e, 0x6a, 0x73, 0x5c, 0x4f, 0x44, 0x41, 0x3f, 0x3a, 0x36, 0x36, 0x36, 0x36, 0x3a, 0x3a, 0x41, 0x51, 0x77, 0x99, 0x8d, 0x76, 0x8a, 0x9e, 0x97, 0x94, 0x91, 0x09, 0x0b, 0x10, 0x10, 0x10, 0x0d, 0x0f, 0x0d, 0x0b, 0x10, 0x0a, 0x0c, 0x21, 0xb2, 0xa0, 0x5e, 0x5e, 0x5c, 0xbe, 0x28, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf8, 0xfa, 0xc7, 0x92, 0x6a, 0x5e, 0x8f, 0x8e, 0x09, 0x0a, 0x0d, 0x0a, 0x0a, 0x0d, 0x0d, 0x11, 0x0d, 0x11, 0x13, 0x10, 0x12, 0x12, 0x12, 0x12, 0x12, 0xa4, 0x0c, 0x77, 0x4a, 0x2f, 0x36, 0x32, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x3b, 0x36, 0x36, 0x36, 0x43, 0x5a, 0x69, 0x69, 0x68, 0x6d, 0x5e, 0x72, 0x54, 0xa1, 0x1f, 0x89, 0x56, 0x69, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x58, 0x41, 0x3f, 0x34, 0x36, 0x3b, 0x36, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x39, 0x39, 0x3a, 0x34, 0x3f, 0x77, 0xa3, 0x81, 0x93, 0x9e, 0x8f, 0x9c, 0x0c, 0x0b, 0x10, 0x10, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x16, 0x0b, 0x08, 0x75, 0x6b, 0x5e, 0x5e, 0x79, 0xc7, 0x26, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xf4, 0xf4, 0x29, 0xaa, 0x5d, 0x68, 0x72, 0x07, 0x08, 0x16, 0x0a, 0x0d, 0x11, 0x0d, 0x11, 0x0f, 0x11, 0x11, 0x11, 0x10, 0x16, 0x12, 0x12, 0x12, 0xa0, 0xa0, 0x81, 0x4f, 0x34, 0x3b, 0x37, 0x37, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x36, 0x3b, 0x36, 0x3a, 0x4a, 0x73, 0x6a, 0x5e, 0x72, 0x69, 0x54, 0xa1, 0x1f, 0x69, 0x4e, 0x56, 0x5d, 0x5d, 0x5d, 0x5c, 0x44, 0x3a, 0x34, 0x36, 0x3b, 0x3c, 0x39, 0x3c, 0x3c, 0x37, 0x3c, 0x39, 0x3d, 0x3d, 0x39, 0x39, 0x3b, 0x36, 0x41, 0x82, 0x94, 0x90, 0x95, 0x95, 0x95, 0x12, 0x0b, 0x13, 0x0f, 0x0d, 0x0f, 0x11, 0x10, 0x13, 0x11, 0x0d, 0x13, 0x0b, 0x08, 0x57, 0x6c, 0x5e, 0x56, 0x9d, 0x29, 0xf4, 0xfa, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xd2, 0xf3, 0xca, 0xba, 0x5e, 0x6b, 0x6c, 0x54, 0x08, 0x11, 0x13, 0x11, 0x0d, 0x11, 0x0d, 0x11, 0x13, 0x11, 0x11, 0x0f, 0x12, 0xa0, 0x12, 0x9b, 0xa0, 0x90, 0x73, 0x3d, 0x34, 0x34, 0x32, 0x37, 0x33, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x34, 0x39, 0x34, 0x3b, 0x3a, 0x41, 0x5d, 0x72, 0x67, 0x69, 0x54, 0xa1, 0x1f, 0x4a, 0x4e, 0x4e, 0x56, 0x5d, 0x52, 0x3a, 0x36, 0x39, 0x38, 0x3c, 0x34, 0x38, 0x3d, 0x39, 0x39, 0x39, 0x3c, 0x39, 0x3c, 0x3c, 0x3c, 0x37, 0x3c, 0x3a, 0x3a, 0x54, 0xa3, 0x90, 0x98, 0x95, 0x9c, 0x12, 0x10, 0x13, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x11, 0x11, 0x0d, 0x16, 0x0a, 0x08, 0x6c, 0x6b, 0x5e, 0x56, 0xb5, 0xc9, 0xfb, 0xf8, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xc8, 0xf5, 0xf2, 0x28, 0xc5, 0x73, 0x71, 0x78, 0x07, 0x08, 0x0a, 0x13, 0x16, 0x11, 0x0d, 0x11, 0x13, 0x13, 0x11, 0x11, 0x10, 0x16, 0xa0, 0x12, 0x9c, 0xa4, 0x86, 0x54, 0x3a, 0x34, 0x34, 0x37, 0x37, 0x34, 0x34, 0x39, 0x36, 0x39, 0x36, 0x39, 0x36, 0x39, 0x39, 0x3d, 0x39, 0x39, 0x3a, 0x36, 0x44, 0x56, 0x77, 0x69, 0x4a, 0x9d, 0xa1, 0x44, 0x4a, 0x4e, 0x58, 0x4f, 0x41, 0x41, 0x42, 0x42, 0x3d, 0x38, 0x3d, 0x3d, 0x36, 0x39, 0x3b, 0x3d, 0x3b, 0x39, 0x3b, 0x37, 0x3c, 0x3c, 0x3c, 0x3b, 0x36, 0x49, 0xa3, 0x94, 0x95, 0x95, 0x9c, 0x12, 0x10, 0x13, 0x0f, 0x0f, 0x13, 0x0f, 0x10, 0x10, 0x0d, 0x16, 0x11, 0x0a, 0x0b, 0x12, 0x5b, 0x73, 0x52, 0xc2, 0x29, 0xfa, 0xf2, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xd2, 0xf8, 0xfa, 0x26, 0x29, 0x9f, 0x59, 0x73, 0x78, 0x0d, 0x0f, 0x0f, 0x13, 0x13, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xa0, 0x91, 0x98, 0xa3, 0x86, 0x4f, 0x34, 0x34, 0x39, 0x37, 0x33, 0x3c, 0x32, 0x3d, 0x32, 0x34, 0x39, 0x34, 0x39, 0x3d, 0x34, 0x34, 0x34, 0x3d, 0x37, 0x37, 0x36, 0x3f, 0x64, 0x77, 0x49, 0x96, 0x92, 0x44, 0x43, 0x4f, 0x46, 0x34, 0x3d, 0x3d, 0x40, 0x40, 0x3e, 0x3c, 0x38, 0x3d, 0x3c, 0x3d, 0x38, 0x3d, 0x3d, 0x34, 0x3c, 0x39, 0x3b, 0x3c, 0x3c, 0x3c, 0x36, 0x44, 0x8e, 0xa3, 0x91, 0x95, 0x91, 0x15, 0x12, 0x0f, 0x11, 0x11, 0x11, 0x13, 0x13, 0x0f, 0x13, 0x13, 0x0a, 0x0a, 0x16, 0x12, 0x5f, 0x5d, 0x85, 0x29, 0xc7, 0xc8, 0xf8, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 
-  0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf8, 0x26, 0xca, 0xb7, 0x64, 0x6c, 0x78, 0x14, 0x0f, 0x13, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x16, 0xa0, 0x9c, 0x9c, 0xa6, 0x81, 0x4a, 0x34, 0x38, 0x34, 0x37, 0x33, 0x3c, 0x32, 0x70, 0x3d, 0x34, 0x39, 0x39, 0x39, 0x34, 0x3d, 0x53, 0x3c, 0x34, 0x3c, 0x34, 0x3b, 0x36, 0x41, 0x64, 0x4e, 0x5a, 0x77, 0x41, 0x4a, 0x3a, 0x34, 0x38, 0x3c, 0x39, 0x3d, 0x3a, 0x46, 0x3d, 0x3c, 0x3c, 0x34, 0x3d, 0x3d, 0x39, 0x40, 0x46, 0x34, 0x39, 0x3b, 0x3d, 0x37, 0x3d, 0x2f, 0x49, 0x89, 0xa6, 0x8b, 0x9c, 0x91, 0xa0, 0x12, 0x10, 0x0f, 0x11, 0x11, 0x11, 0x16, 0x13, 0x13, 0x0a, 0x0b, 0x0a, 0x21, 0x88, 0x5e, 0x58, 0xae, 0x29, 0xc8, 0x26, 0xf5, 0xf8, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xd2, 0xf4, 0xf8, 0xf5, 0xc9, 0xc3, 0x79, 0x73, 0x5e, 0x1c, 0x13, 0x0f, 0x16, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x10, 0x1c, 0xa0, 0x9c, 0x9c, 0xa4, 0x8b, 0x54, 0x3b, 0x36, 0x34, 0x37, 0x3c, 0x3c, 0x2f, 0x70, 0x42, 0x34, 0x34, 0x39, 0x39, 0x34, 0x40, 0x92, 0x39, 0x34, 0x34, 0x34, 0x39, 0x3b, 0x34, 0x49, 0x58, 0x41, 0x44, 0x4a, 0x44, 0x3a, 0x3a, 0x39, 0x3d, 0x3c, 0x3d, 0x34, 0x53, 0x42, 0x34, 0x3c, 0x39, 0x3d, 0x39, 0x39, 0x53, 0x49, 0x3c, 0x39, 0x3b, 0x39, 0x3c, 0x3c, 0x36, 0x4f, 0x89, 0xa6, 0x8b, 0x98, 0x9c, 0xa0, 0x15, 0x10, 0x10, 0x11, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x0d, 0x0a, 0x16, 0x22, 0x0b, 0x5f, 0x58, 0xc0, 0xca, 0xd2, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xf4, 0xf3, 0xf3, 0xef, 0xc9, 0xb3, 0x57, 0x78, 0x0b, 0x1f, 0x16, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x15, 0xa0, 0x12, 0xa0, 0x9c, 0xa4, 0x91, 0x77, 0x40, 0x34, 0x37, 0x34, 0x37, 0x33, 0x34, 0x53, 0x53, 0x2f, 0x39, 0x34, 0x39, 0x39, 0x37, 0x9f, 0x42, 0x34, 0x39, 0x39, 0x34, 0x37, 0x39, 0x36, 0x5a, 0x4e, 0x44, 0x4a, 0x41, 0x3a, 0x3d, 0x3b, 0x3c, 0x3d, 0x34, 0x3a, 0x70, 0x3d, 0x38, 0x3d, 0x34, 0x3d, 0x34, 0x40, 0x70, 0x3d, 0x34, 0x3b, 0x3b, 0x3d, 0x39, 0x3c, 0x3b, 0x64, 0x8e, 0xa4, 0x99, 0x9c, 0x94, 0xa0, 0xa0, 0x15, 0x0b, 0x10, 0x0d, 0x0f, 0x0d, 0x11, 0x0d, 0x0d, 0x16, 0x21, 0x1c, 0x5b, 0x5e, 0xa5, 0xc9, 0xd2, 0xd2, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf5, 0xf3, 0xf3, 0xf0, 0x26, 0xc7, 0x58, 0x69, 0x7f, 0x0c, 0xa9, 0x1c, 0x13, 0x0d, 0x11, 0x10, 0x10, 0x16, 0xa0, 0x15, 0xa0, 0xa0, 0xa0, 0x9c, 0xa0, 0xa0, 0x82, 0x49, 0x2f, 0x3e, 0x34, 0x3c, 0x39, 0x32, 0x46, 0x70, 0x2f, 0x3d, 0x34, 0x3d, 0x3d, 0x32, 0x85, 0x53, 0x2f, 0x36, 0x39, 0x3c, 0x3c, 0x3c, 0x3d, 0x44, 0x77, 0x44, 0x4a, 0x3e, 0x36, 0x3e, 0x3d, 0x3d, 0x3c, 0x3b, 0x39, 0x92, 0x37, 0x34, 0x3d, 0x39, 0x39, 0x39, 0x46, 0x7b, 0x32, 0x34, 0x39, 0x3e, 0x3b, 0x38, 0x39, 0x42, 0x64, 0x97, 0xa6, 0x94, 0x99, 0x9c, 0xa0, 0xa0, 0x1c, 0x15, 0x10, 0x0b, 0x10, 0x0a, 0x0d, 0x10, 0x16, 0xa9, 0xa9, 0x78, 0x6c, 0x50, 0xbe, 0xc9, 0xd2, 0xf3, 0xef, 0xd2, 0xc8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 
-  0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xef, 0xf3, 0xf2, 0x28, 0x29, 0xb7, 0x5a, 0x57, 0x8c, 0x12, 0x1c, 0x1c, 0x1c, 0x1c, 0x16, 0x1c, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x94, 0xa9, 0xa1, 0x5a, 0x49, 0x2f, 0x37, 0x39, 0x37, 0x3b, 0x3c, 0x92, 0x34, 0x39, 0x39, 0x39, 0x34, 0x34, 0x53, 0x92, 0x34, 0x3b, 0x39, 0x39, 0x3c, 0x3d, 0x36, 0x3b, 0x82, 0x4f, 0x49, 0x36, 0x3e, 0x3e, 0x39, 0x3b, 0x3d, 0x39, 0x5a, 0x5a, 0x2f, 0x39, 0x3d, 0x39, 0x3d, 0x34, 0x70, 0x5a, 0x34, 0x3d, 0x3b, 0x3a, 0x3d, 0x3d, 0x2e, 0x7b, 0x4f, 0xab, 0x9c, 0x99, 0x97, 0x9c, 0xa1, 0x9c, 0x9c, 0x1c, 0xa9, 0x1c, 0xa9, 0x1c, 0xa9, 0x1f, 0xa9, 0xa9, 0x83, 0x56, 0x73, 0xa8, 0x29, 0xc8, 0xf3, 0xf3, 0xf4, 0xf4, 0x26, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xef, 0xcf, 0xef, 0xf6, 0xf2, 0x28, 0xc9, 0xae, 0x51, 0x64, 0x8b, 0xa4, 0xa0, 0x1c, 0xa0, 0x1c, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c, 0xa0, 0x9c, 0x94, 0xab, 0x92, 0x5a, 0x3c, 0x34, 0x3c, 0x34, 0x3d, 0x34, 0x85, 0x3d, 0x32, 0x3d, 0x3c, 0x39, 0x39, 0x34, 0xa8, 0x3c, 0x39, 0x3d, 0x3b, 0x3d, 0x3b, 0x3a, 0x3a, 0x79, 0x64, 0x49, 0x3c, 0x3e, 0x3b, 0x3e, 0x40, 0x39, 0x39, 0x9f, 0x39, 0x34, 0x3d, 0x39, 0x3d, 0x39, 0x2f, 0x9f, 0x49, 0x34, 0x39, 0x3b, 0x3f, 0x3d, 0x34, 0x46, 0x70, 0x82, 0xab, 0x94, 0xa3, 0x9c, 0x99, 0x9c, 0xa1, 0xa0, 0xa0, 0x15, 0xa4, 0xa0, 0xa4, 0x1c, 0xa4, 0x1c, 0x81, 0x73, 0x69, 0x92, 0xc5, 0x26, 0xfd, 0xf2, 0xf4, 0xc8, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 
-  0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf8, 0xc8, 0xd2, 0xcf, 0x26, 0xfa, 0xfd, 0xc8, 0xfe, 0xb4, 0x58, 0x64, 0x7f, 0xa0, 0xa0, 0xa0, 0xa0, 0xa1, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c, 0xab, 0x96, 0xa8, 0x5a, 0x5a, 0x3d, 0x34, 0x34, 0x34, 0x36, 0x53, 0x70, 0x34, 0x39, 0x39, 0x39, 0x3d, 0x2f, 0x70, 0x70, 0x34, 0x39, 0x3d, 0x3f, 0x3a, 0x41, 0x3a, 0x70, 0xae, 0x53, 0x34, 0x36, 0x42, 0x3b, 0x3e, 0x39, 0x49, 0x85, 0x2f, 0x3d, 0x39, 0x39, 0x3d, 0x34, 0x46, 0x9f, 0x40, 0x39, 0x39, 0x40, 0x3a, 0x36, 0x42, 0x70, 0x70, 0xab, 0xa3, 0x99, 0x9c, 0x99, 0x9c, 0xa3, 0xa4, 0xa3, 0xa0, 0xa4, 0x9e, 0xa3, 0xa4, 0xa4, 0x9c, 0x81, 0x73, 0x77, 0x9d, 0xc6, 0x28, 0xfd, 0xf2, 0xf6, 0xfb, 0x26, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xfa, 0xf5, 0xc8, 0xc8, 0xfb, 0xfa, 0xf8, 0xd2, 0xcf, 0x29, 0xbe, 0x96, 0x7b, 0x73, 0x8a, 0x9c, 0xa6, 0xa1, 0x9c, 0xa0, 0xa0, 0x9c, 0xa0, 0x9c, 0xa6, 0xa6, 0x8c, 0x64, 0xa5, 0xc0, 0x53, 0x5a, 0x3c, 0x34, 0x39, 0x32, 0x40, 0x9f, 0x32, 0x3d, 0x39, 0x3d, 0x3d, 0x34, 0x42, 0xa8, 0x2f, 0x3d, 0x3a, 0x3f, 0x3f, 0x3f, 0x2f, 0xa8, 0xc6, 0xb0, 0x3c, 0x32, 0x3e, 0x3d, 0x40, 0x34, 0x85, 0x46, 0x36, 0x3d, 0x3b, 0x40, 0x3e, 0x3b, 0x70, 0x87, 0x32, 0x3a, 0x39, 0x3a, 0x36, 0x3d, 0x53, 0x9f, 0xb7, 0xa5, 0x97, 0x8c, 0x8b, 0x97, 0xa3, 0x99, 0xa3, 0xa0, 0xa3, 0xa4, 0xa3, 0xa3, 0x94, 0x81, 0x73, 0x82, 0x7b, 0xaf, 0xc5, 0xc9, 0xfa, 0xf8, 0xf8, 0xfb, 0x26, 0x26, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 
-  0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xcf, 0xf4, 0xf4, 0xf9, 0xf2, 0xf9, 0xd2, 0xc8, 0x2a, 0x26, 0xb5, 0x9f, 0x7b, 0x64, 0x77, 0x8b, 0x94, 0xa3, 0xa3, 0xa3, 0xa3, 0x9d, 0x96, 0x7b, 0x87, 0xac, 0xbf, 0x2b, 0xbf, 0xa2, 0x4d, 0x42, 0x42, 0x3e, 0x32, 0x9f, 0x53, 0x2f, 0x40, 0x3b, 0x3b, 0x3e, 0x34, 0x92, 0x70, 0x36, 0x3f, 0x36, 0x36, 0x2f, 0x60, 0xc4, 0xca, 0xca, 0xbf, 0x60, 0x33, 0x2f, 0x34, 0x40, 0x87, 0x3f, 0x3a, 0x3a, 0x3f, 0x3f, 0x36, 0x01, 0xaa, 0x5a, 0x3a, 0x40, 0x3f, 0x40, 0x42, 0x4d, 0xb1, 0xc9, 0xca, 0xbc, 0xa8, 0x9d, 0x9d, 0x96, 0x8e, 0x8e, 0x89, 0x8c, 0x8b, 0x7f, 0x8b, 0x81, 0x82, 0x7b, 0x87, 0xac, 0xc1, 0xca, 0x28, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0x28, 0x2b, 0xc9, 0xc2, 0xb9, 0xaf, 0xaa, 0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xac, 0xb0, 0xbe, 0xc6, 0x29, 0xfd, 0x28, 0x28, 0xca, 0xbf, 0xa2, 0x53, 0x4d, 0x47, 0x70, 0xac, 0x42, 0x3c, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x9f, 0x42, 0x42, 0x47, 0x7a, 0xb8, 0xc9, 0xcf, 0xd2, 0xfb, 0xca, 0xc9, 0xbf, 0xa7, 0x7a, 0xa2, 0x53, 0x46, 0x3c, 0x3d, 0x32, 0x34, 0x3c, 0x92, 0x92, 0x3d, 0x46, 0x46, 0x53, 0x60, 0xb1, 0xc4, 0x2b, 0x28, 0x26, 0xc9, 0x28, 0xc3, 0xb7, 0xae, 0xaa, 0xa8, 0xa5, 0xa5, 0x9d, 0xa5, 0xa5, 0xa5, 0xae, 0xbc, 0xc6, 0xca, 0xca, 0xc8, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf2, 0xf2, 0x28, 0x28, 0x29, 0x29, 0x27, 0x27, 0x27, 0xc7, 0x27, 0xc9, 0x29, 0xc9, 0xca, 0xc9, 0x26, 0xf8, 0xf4, 0xf9, 0xf9, 0xfe, 0x2b, 0xc8, 0xc4, 0xbf, 0xbf, 0xc0, 0xce, 0xb0, 0xa7, 0xa2, 0xa7, 0xac, 0xb4, 0xbd, 0xc1, 0xc1, 0xc9, 0x2b, 0xfe, 0xcf, 0xd2, 0xf3, 0xf9, 0xf4, 0xf2, 0xfe, 0xff, 0x2a, 0xc9, 0xc4, 0xc1, 0xb8, 0xb4, 0xad, 0xb1, 0xb4, 0xbf, 0xb8, 0xbc, 0xbd, 0xbf, 0xc4, 0x2a, 0x2b, 0xfd, 0xf6, 0xd2, 0xf4, 0xc8, 0xc8, 0xc9, 0x2a, 0x29, 0x26, 0xc6, 0x25, 0xc3, 0xc6, 0x25, 0xc7, 0x29, 0x2a, 0x2a, 0xca, 0xc8, 0xd2, 0xf5, 0xf0, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf9, 0xf8, 0xf9, 0xf4, 0xf4, 0xf9, 0xc8, 0xc8, 0xfd, 0xc8, 0xc8, 0xf4, 0x26, 0xfa, 0xfb, 0xf4, 0xf5, 0xf8, 0xf5, 0xf6, 0xf2, 0xef, 0xf6, 0xcf, 0xf7, 0x28, 0x28, 0x2b, 0x28, 0xff, 0x2b, 0xff, 0x2b, 0x2b, 0xf1, 0xf7, 0xfe, 0xd2, 0xc8, 0xd2, 0xef, 0xf5, 0xf3, 0xf2, 0xf6, 0xf8, 0xf2, 0xf2, 0xf4, 0xf4, 0xfd, 0xf9, 0x2b, 0xf1, 0x2b, 0xf1, 0x2b, 0xf7, 0xfe, 0xf7, 0xfe, 0xfe, 0xfd, 0xf2, 0xef, 0xf3, 0xf2, 0xf3, 0xf5, 0xd2, 0xf4, 0xf4, 0xf9, 0xf4, 0x26, 0xf6, 0xfd, 0xf7, 0xfd, 0xcf, 0xfd, 0xf4, 0xc8, 0xf4, 0xf9, 0xf5, 0xf5, 0xf3, 0xf2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf5, 0xf4, 0xf6, 0xf2, 0xf8, 0xef, 0xf5, 0xf5, 0xf5, 0xf3, 0xf9, 0xf5, 0xf2, 0xf8, 0xfa, 0xf8, 0xf8, 0xf8, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xd2, 0xf5, 0xef, 0xf4, 0x26, 0xd2, 0xfb, 0xf4, 0xf9, 0xc8, 0xf4, 0xc8, 0xd2, 0xf4, 0xf4, 0xf2, 0xf6, 0xf4, 0xd2, 0xf4, 0xf4, 0xf5, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf9, 0xf4, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf9, 0xf4, 0xf5, 0xf5, 0xf3, 0xf3, 0xef, 0xf2, 0xfb, 0xf4, 0xf8, 0xf2, 0xf6, 0xf5, 0xef, 0xf5, 0xd2, 0xf3, 0xef, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf2, 0xf9, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xc8, 0x26, 0xc8, 0xf4, 0xf9, 0xef, 0xf4, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfb, 0x26, 0xfb, 0xc8, 0xfb, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf5, 0xf8, 0xf5, 0xf4, 0xf4, 0xef, 0xd2, 0xef, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xf4, 0xf4, 0xfb, 0x26, 0xfb, 0xc8, 0xfb, 0x26, 0xf4, 0x26, 0xf4, 0xfa, 0xfb, 0xf9, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xc8, 0xfb, 0x26, 0xf4, 0xf9, 0xf8, 0xf9, 0xf5, 0xf5, 0xf5, 0xef, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf9, 0xc8, 0xf9, 0x26, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xef, 0x26, 0xc8, 0x26, 0xf9, 0xc8, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf9, 0xfb, 0x26, 0xfb, 0xc8, 0xfb, 0xc8, 0x26, 0xc8, 0xf4, 0xc8, 0xf4, 0xf5, 0xf5, 0xf8, 0xf5, 0xf5, 0xef, 0xf5, 0xf4, 0xef, 0xfb, 0x26, 0xf4, 0xf4, 0xf4, 0xd2, 0xc8, 0x26, 0x26, 0x26, 0xf4, 0xc8, 0xf4, 0x26, 0x26, 0x26, 0xfb, 0xfa, 0x26, 0xf4, 0x26, 0xf4, 0x26, 0xf4, 0x26, 0xf4, 0x26, 0xf4, 0x26, 0xf4, 0xf4, 0x26, 0xf4, 0xc8, 0xfb, 0x26, 0x26, 0xf9, 0xf4, 0xfa, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf5, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0x26, 0xf4, 0x26, 0xc8, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xfa, 0xf4, 0xf9, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0x26, 0xf4, 0xf4, 0xef, 0xd2, 0xf5, 0xd2, 0xf4, 0x26, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf9, 0x26, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x26, 0xf4, 0x26, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf5, 0xf5, 0xf5, 0xef, 0xf4, 0xef, 0xf4, 0xc8, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xcf, 0xf4, 0xf5, 0xf5, 0xf8, 0xf4, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0x26, 0xf4, 0xf9, 0xf4, 0xc8, 0xf4, 0xf4, 0xf4, 0xd2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf8, 0xd2, 0xf5, 0xf3, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xef, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xfa, 0xf9, 0xfa, 0xf4, 0xf9, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd2, 0xf4, 0xd2, 0xf4, 0xf4, 0xf4, 0xf5, 0xd2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xef, 0xf4, 0xef, 0xf4, 0xf4, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xef, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-};
-
-const lv_img_dsc_t image1 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image1_map,
-};
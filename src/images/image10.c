@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE10
-#define LV_ATTRIBUTE_IMG_IMAGE10
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE10 uint8_t image10_map[] = {
-  0xe9, 0xec, 0xfd, 0xff, 	/*Color of index 0*/
-  0xe2, 0xe8, 0xfd, 0xff, 	/*Color of index 1*/
-  0xdb, 0xe3, 0xfe, 0xff, 	/*Color of index 2*/
-  0xd8, 0xdc, 0xfd, 0xff, 	/*Color of index 3*/
-  0xcd, 0xd4, 0xfb, 0xff, 	/*Color of index 4*/
-  0xd9, 0xd9, 0xde, 0xff, 	/*Color of index 5*/
-  0xc4, 0xca, 0xfa, 0xff, 	/*Color of index 6*/
-  0xba, 0xc1, 0xf8, 0xff, 	/*Color of index 7*/
-  0xc2, 0xc3, 0xe7, 0xff, 	/*Color of index 8*/
-  0xae, 0xb2, 0xf6, 0xff, 	/*Color of index 9*/
-  0xba, 0xba, 0xbd, 0xff, 	/*Color of index 10*/
-  0xab, 0xaf, 0xe7, 0xff, 	/*Color of index 11*/
-  0xaf, 0xb3, 0xd3, 0xff, 	/*Color of index 12*/
-  0x9e, 0xa1, 0xeb, 0xff, 	/*Color of index 13*/
-  0x8f, 0x95, 0xea, 0xff, 	/*Color of index 14*/
-  0xa4, 0xa3, 0xa8, 0xff, 	/*Color of index 15*/
-  0x90, 0x95, 0xd7, 0xff, 	/*Color of index 16*/
-  0x95, 0x98, 0xc4, 0xff, 	/*Color of index 17*/
-  0x82, 0x85, 0xe9, 0xff, 	/*Color of index 18*/
-  0x7c, 0x81, 0xd7, 0xff, 	/*Color of index 19*/
-  0x83, 0x85, 0xc5, 0xff, 	/*Color of index 20*/
-  0x86, 0x87, 0x9b, 0xff, 	/*Color of index 21*/
-  0x72, 0x72, 0xe1, 0xff, 	/*Color of index 22*/
-  0x70, 0x76, 0xd0, 0xff, 	/*Color of index 23*/
-  0x68, 0x69, 0xf3, 0xff, 	/*Color of index 24*/
-  0x6c, 0x72, 0xaf, 0xff, 	/*Color of index 25*/
-  0x63, 0x64, 0xd5, 0xff, 	/*Color of index 26*/
-  0x66, 0x69, 0xc1, 0xff, 	/*Color of index 27*/
-  0x58, 0x5a, 0xd5, 0xff, 	/*Color of index 28*/
-  0x5a, 0x5d, 0xc4, 0xff, 	/*Color of index 29*/
-  0x69, 0x6b, 0x8a, 0xff, 	/*Color of index 30*/
-  0x5c, 0x5c, 0xb1, 0xff, 	/*Color of index 31*/
-  0x51, 0x54, 0xc3, 0xff, 	/*Color of index 32*/
-  0x4b, 0x4a, 0xd2, 0xff, 	/*Color of index 33*/
-  0x56, 0x5a, 0x90, 0xff, 	/*Color of index 34*/
-  0x43, 0x42, 0xe2, 0xff, 	/*Color of index 35*/
-  0x49, 0x4b, 0xbf, 0xff, 	/*Color of index 36*/
-  0x63, 0x60, 0x6c, 0xff, 	/*Color of index 37*/
-  0x40, 0x43, 0xd1, 0xff, 	/*Color of index 38*/
-  0x4c, 0x4b, 0xad, 0xff, 	/*Color of index 39*/
-  0x37, 0x3a, 0xe4, 0xff, 	/*Color of index 40*/
-  0x41, 0x43, 0xbf, 0xff, 	/*Color of index 41*/
-  0x3e, 0x3b, 0xd7, 0xff, 	/*Color of index 42*/
-  0x31, 0x33, 0xf2, 0xff, 	/*Color of index 43*/
-  0x36, 0x3c, 0xcd, 0xff, 	/*Color of index 44*/
-  0x37, 0x32, 0xe6, 0xff, 	/*Color of index 45*/
-  0x2f, 0x35, 0xdc, 0xff, 	/*Color of index 46*/
-  0x3d, 0x40, 0xae, 0xff, 	/*Color of index 47*/
-  0x28, 0x2d, 0xf4, 0xff, 	/*Color of index 48*/
-  0x3c, 0x3b, 0xbd, 0xff, 	/*Color of index 49*/
-  0x3c, 0x37, 0xca, 0xff, 	/*Color of index 50*/
-  0x32, 0x2f, 0xe7, 0xff, 	/*Color of index 51*/
-  0x28, 0x2d, 0xeb, 0xff, 	/*Color of index 52*/
-  0x38, 0x31, 0xd8, 0xff, 	/*Color of index 53*/
-  0x44, 0x44, 0x93, 0xff, 	/*Color of index 54*/
-  0x21, 0x28, 0xfb, 0xff, 	/*Color of index 55*/
-  0x2c, 0x27, 0xf9, 0xff, 	/*Color of index 56*/
-  0x2a, 0x2e, 0xe1, 0xff, 	/*Color of index 57*/
-  0x1a, 0x2a, 0xf3, 0xff, 	/*Color of index 58*/
-  0x4d, 0x4f, 0x64, 0xff, 	/*Color of index 59*/
-  0x22, 0x29, 0xf2, 0xff, 	/*Color of index 60*/
-  0x1d, 0x27, 0xfa, 0xff, 	/*Color of index 61*/
-  0x30, 0x32, 0xce, 0xff, 	/*Color of index 62*/
-  0x23, 0x2a, 0xeb, 0xff, 	/*Color of index 63*/
-  0x20, 0x25, 0xfa, 0xff, 	/*Color of index 64*/
-  0x1d, 0x25, 0xfa, 0xff, 	/*Color of index 65*/
-  0x24, 0x2b, 0xe3, 0xff, 	/*Color of index 66*/
-  0x1a, 0x29, 0xec, 0xff, 	/*Color of index 67*/
-  0x1a, 0x2b, 0xe4, 0xff, 	/*Color of index 68*/
-  0x30, 0x34, 0xbe, 0xff, 	/*Color of index 69*/
-  0x3b, 0x36, 0xb3, 0xff, 	/*Color of index 70*/
-  0x18, 0x23, 0xfc, 0xff, 	/*Color of index 71*/
-  0x3a, 0x31, 0xbf, 0xff, 	/*Color of index 72*/
-  0x23, 0x2a, 0xdd, 0xff, 	/*Color of index 73*/
-  0x22, 0x23, 0xf4, 0xff, 	/*Color of index 74*/
-  0x24, 0x2d, 0xd1, 0xff, 	/*Color of index 75*/
-  0x1a, 0x24, 0xf2, 0xff, 	/*Color of index 76*/
-  0x30, 0x2a, 0xd6, 0xff, 	/*Color of index 77*/
-  0x3d, 0x36, 0xa6, 0xff, 	/*Color of index 78*/
-  0x24, 0x23, 0xeb, 0xff, 	/*Color of index 79*/
-  0x1a, 0x24, 0xeb, 0xff, 	/*Color of index 80*/
-  0x21, 0x1d, 0xfc, 0xff, 	/*Color of index 81*/
-  0x32, 0x35, 0xa5, 0xff, 	/*Color of index 82*/
-  0x17, 0x20, 0xf2, 0xff, 	/*Color of index 83*/
-  0x1a, 0x1c, 0xfc, 0xff, 	/*Color of index 84*/
-  0x1b, 0x23, 0xe4, 0xff, 	/*Color of index 85*/
-  0x1e, 0x25, 0xdc, 0xff, 	/*Color of index 86*/
-  0x31, 0x2f, 0xb3, 0xff, 	/*Color of index 87*/
-  0x24, 0x22, 0xe3, 0xff, 	/*Color of index 88*/
-  0x23, 0x1d, 0xf3, 0xff, 	/*Color of index 89*/
-  0x2f, 0x2b, 0xbe, 0xff, 	/*Color of index 90*/
-  0x33, 0x34, 0x9a, 0xff, 	/*Color of index 91*/
-  0x23, 0x29, 0xc2, 0xff, 	/*Color of index 92*/
-  0x18, 0x1b, 0xf3, 0xff, 	/*Color of index 93*/
-  0x1c, 0x24, 0xd2, 0xff, 	/*Color of index 94*/
-  0x23, 0x1c, 0xea, 0xff, 	/*Color of index 95*/
-  0x28, 0x25, 0xca, 0xff, 	/*Color of index 96*/
-  0x2a, 0x21, 0xd6, 0xff, 	/*Color of index 97*/
-  0x1b, 0x1d, 0xe6, 0xff, 	/*Color of index 98*/
-  0x20, 0x20, 0xda, 0xff, 	/*Color of index 99*/
-  0x35, 0x34, 0x8e, 0xff, 	/*Color of index 100*/
-  0x3b, 0x3c, 0x6f, 0xff, 	/*Color of index 101*/
-  0x24, 0x2b, 0xaf, 0xff, 	/*Color of index 102*/
-  0x23, 0x22, 0xcb, 0xff, 	/*Color of index 103*/
-  0x22, 0x20, 0xd1, 0xff, 	/*Color of index 104*/
-  0x1b, 0x22, 0xca, 0xff, 	/*Color of index 105*/
-  0x1d, 0x24, 0xc2, 0xff, 	/*Color of index 106*/
-  0x2a, 0x23, 0xc0, 0xff, 	/*Color of index 107*/
-  0x22, 0x25, 0xba, 0xff, 	/*Color of index 108*/
-  0x41, 0x40, 0x53, 0xff, 	/*Color of index 109*/
-  0x2e, 0x29, 0xa6, 0xff, 	/*Color of index 110*/
-  0x21, 0x21, 0xc4, 0xff, 	/*Color of index 111*/
-  0x14, 0x17, 0xe8, 0xff, 	/*Color of index 112*/
-  0x13, 0x1b, 0xd8, 0xff, 	/*Color of index 113*/
-  0x22, 0x1d, 0xcc, 0xff, 	/*Color of index 114*/
-  0x1d, 0x1a, 0xd6, 0xff, 	/*Color of index 115*/
-  0x2c, 0x28, 0x97, 0xff, 	/*Color of index 116*/
-  0x18, 0x1a, 0xcb, 0xff, 	/*Color of index 117*/
-  0x1e, 0x1f, 0xb4, 0xff, 	/*Color of index 118*/
-  0x2d, 0x2b, 0x85, 0xff, 	/*Color of index 119*/
-  0x1b, 0x18, 0xc0, 0xff, 	/*Color of index 120*/
-  0x2b, 0x2c, 0x71, 0xff, 	/*Color of index 121*/
-  0x1f, 0x1c, 0xa5, 0xff, 	/*Color of index 122*/
-  0x23, 0x20, 0x95, 0xff, 	/*Color of index 123*/
-  0x24, 0x23, 0x87, 0xff, 	/*Color of index 124*/
-  0x35, 0x31, 0x41, 0xff, 	/*Color of index 125*/
-  0x23, 0x21, 0x78, 0xff, 	/*Color of index 126*/
-  0x2b, 0x29, 0x53, 0xff, 	/*Color of index 127*/
-  0x1c, 0x18, 0x88, 0xff, 	/*Color of index 128*/
-  0x21, 0x1e, 0x66, 0xff, 	/*Color of index 129*/
-  0x19, 0x18, 0x75, 0xff, 	/*Color of index 130*/
-  0x23, 0x20, 0x3b, 0xff, 	/*Color of index 131*/
-  0x16, 0x14, 0x67, 0xff, 	/*Color of index 132*/
-  0x19, 0x19, 0x52, 0xff, 	/*Color of index 133*/
-  0x11, 0x0e, 0x5c, 0xff, 	/*Color of index 134*/
-  0x12, 0x11, 0x4f, 0xff, 	/*Color of index 135*/
-  0x0a, 0x09, 0x66, 0xff, 	/*Color of index 136*/
-  0x0a, 0x0a, 0x4f, 0xff, 	/*Color of index 137*/
-  0x0b, 0x0a, 0x43, 0xff, 	/*Color of index 138*/
-  0x10, 0x0d, 0x34, 0xff, 	/*Color of index 139*/
-  0x06, 0x03, 0x51, 0xff, 	/*Color of index 140*/
-  0x08, 0x07, 0x34, 0xff, 	/*Color of index 141*/
-  0x03, 0x02, 0x3f, 0xff, 	/*Color of index 142*/
-  0x02, 0x00, 0x33, 0xff, 	/*Color of index 143*/
-  0x02, 0x00, 0x2a, 0xff, 	/*Color of index 144*/
-  0x08, 0x04, 0x1a, 0xff, 	/*Color of index 145*/
-  0x01, 0x00, 0x23, 0xff, 	/*Color of index 146*/
-  0x01, 0x00, 0x1a, 0xff, 	/*Color of index 147*/
-  0x02, 0x00, 0x12, 0xff, 	/*Color of index 148*/
-  0x02, 0x02, 0x0a, 0xff, 	/*Color of index 149*/
-  0xf4, 0xf8, 0xfc, 0xff, 	/*Color of index 150*/
-  0xeb, 0xf2, 0xfd, 0xff, 	/*Color of index 151*/
-  0xec, 0xf2, 0xf1, 0xff, 	/*Color of index 152*/
-  0xfd, 0xfe, 0xfd, 0xff, 	/*Color of index 153*/
-  0x05, 0x09, 0x01, 0xff, 	/*Color of index 154*/
-  0xfd, 0xfd, 0xf1, 0xff, 	/*Color of index 155*/
-  0xf7, 0xf8, 0xf2, 0xff, 	/*Color of index 156*/
-  0xfc, 0xfb, 0xe0, 0xff, 	/*Color of index 157*/
-  0xf5, 0xf2, 0xea, 0xff, 	/*Color of index 158*/
-  0xfa, 0xf4, 0xcd, 0xff, 	/*Color of index 159*/
-  0xed, 0xeb, 0xe0, 0xff, 	/*Color of index 160*/
-  0xe5, 0xe3, 0xde, 0xff, 	/*Color of index 161*/
-  0xf1, 0xe6, 0xc0, 0xff, 	/*Color of index 162*/
-  0xd5, 0xd4, 0xce, 0xff, 	/*Color of index 163*/
-  0xe6, 0xd8, 0xae, 0xff, 	/*Color of index 164*/
-  0xdf, 0xce, 0x9b, 0xff, 	/*Color of index 165*/
-  0xc3, 0xc2, 0xbe, 0xff, 	/*Color of index 166*/
-  0xd1, 0xc0, 0x95, 0xff, 	/*Color of index 167*/
-  0xd0, 0xbc, 0x7e, 0xff, 	/*Color of index 168*/
-  0xd9, 0xbd, 0x70, 0xff, 	/*Color of index 169*/
-  0xd0, 0xbc, 0x67, 0xff, 	/*Color of index 170*/
-  0xab, 0xa9, 0x9b, 0xff, 	/*Color of index 171*/
-  0xcc, 0xb1, 0x6f, 0xff, 	/*Color of index 172*/
-  0xcd, 0xaf, 0x61, 0xff, 	/*Color of index 173*/
-  0xcf, 0xb2, 0x55, 0xff, 	/*Color of index 174*/
-  0xc1, 0xa7, 0x69, 0xff, 	/*Color of index 175*/
-  0xca, 0xab, 0x53, 0xff, 	/*Color of index 176*/
-  0xcb, 0xa9, 0x59, 0xff, 	/*Color of index 177*/
-  0xd1, 0xab, 0x4d, 0xff, 	/*Color of index 178*/
-  0xc9, 0xab, 0x4c, 0xff, 	/*Color of index 179*/
-  0xc8, 0xa5, 0x50, 0xff, 	/*Color of index 180*/
-  0xb2, 0x9d, 0x65, 0xff, 	/*Color of index 181*/
-  0xc6, 0xa3, 0x43, 0xff, 	/*Color of index 182*/
-  0xb9, 0x9d, 0x4f, 0xff, 	/*Color of index 183*/
-  0x13, 0x11, 0x00, 0xff, 	/*Color of index 184*/
-  0x0e, 0x0f, 0x01, 0xff, 	/*Color of index 185*/
-  0x0f, 0x0c, 0x02, 0xff, 	/*Color of index 186*/
-  0xf7, 0xf4, 0xf1, 0xff, 	/*Color of index 187*/
-  0xee, 0xec, 0xea, 0xff, 	/*Color of index 188*/
-  0xbb, 0xb6, 0xaf, 0xff, 	/*Color of index 189*/
-  0xd1, 0xab, 0x53, 0xff, 	/*Color of index 190*/
-  0x97, 0x94, 0x8e, 0xff, 	/*Color of index 191*/
-  0xc4, 0xa0, 0x51, 0xff, 	/*Color of index 192*/
-  0xb8, 0x9a, 0x58, 0xff, 	/*Color of index 193*/
-  0x8d, 0x87, 0x85, 0xff, 	/*Color of index 194*/
-  0xb6, 0x93, 0x4c, 0xff, 	/*Color of index 195*/
-  0xa2, 0x8c, 0x5c, 0xff, 	/*Color of index 196*/
-  0xb0, 0x8c, 0x42, 0xff, 	/*Color of index 197*/
-  0x81, 0x7c, 0x7b, 0xff, 	/*Color of index 198*/
-  0x79, 0x74, 0x71, 0xff, 	/*Color of index 199*/
-  0xa5, 0x7f, 0x3c, 0xff, 	/*Color of index 200*/
-  0x91, 0x7b, 0x4e, 0xff, 	/*Color of index 201*/
-  0x82, 0x6f, 0x4d, 0xff, 	/*Color of index 202*/
-  0x95, 0x70, 0x2e, 0xff, 	/*Color of index 203*/
-  0x69, 0x65, 0x5f, 0xff, 	/*Color of index 204*/
-  0x7e, 0x68, 0x3b, 0xff, 	/*Color of index 205*/
-  0x61, 0x5a, 0x57, 0xff, 	/*Color of index 206*/
-  0x76, 0x5f, 0x37, 0xff, 	/*Color of index 207*/
-  0x86, 0x61, 0x29, 0xff, 	/*Color of index 208*/
-  0x87, 0x61, 0x22, 0xff, 	/*Color of index 209*/
-  0x86, 0x5b, 0x33, 0xff, 	/*Color of index 210*/
-  0x86, 0x5d, 0x29, 0xff, 	/*Color of index 211*/
-  0x83, 0x5c, 0x25, 0xff, 	/*Color of index 212*/
-  0x84, 0x5a, 0x2b, 0xff, 	/*Color of index 213*/
-  0x81, 0x5d, 0x1a, 0xff, 	/*Color of index 214*/
-  0x83, 0x56, 0x2b, 0xff, 	/*Color of index 215*/
-  0x6b, 0x54, 0x34, 0xff, 	/*Color of index 216*/
-  0x52, 0x4e, 0x4c, 0xff, 	/*Color of index 217*/
-  0x7d, 0x57, 0x1e, 0xff, 	/*Color of index 218*/
-  0x56, 0x4a, 0x3d, 0xff, 	/*Color of index 219*/
-  0x5f, 0x49, 0x25, 0xff, 	/*Color of index 220*/
-  0x45, 0x3f, 0x3c, 0xff, 	/*Color of index 221*/
-  0x4a, 0x3b, 0x20, 0xff, 	/*Color of index 222*/
-  0x36, 0x2f, 0x2e, 0xff, 	/*Color of index 223*/
-  0x39, 0x2b, 0x20, 0xff, 	/*Color of index 224*/
-  0x40, 0x2e, 0x11, 0xff, 	/*Color of index 225*/
-  0x2a, 0x25, 0x23, 0xff, 	/*Color of index 226*/
-  0x2c, 0x1f, 0x0e, 0xff, 	/*Color of index 227*/
-  0x2d, 0x1b, 0x04, 0xff, 	/*Color of index 228*/
-  0x1b, 0x13, 0x0a, 0xff, 	/*Color of index 229*/
-  0x14, 0x0f, 0x0b, 0xff, 	/*Color of index 230*/
-  0x1b, 0x10, 0x03, 0xff, 	/*Color of index 231*/
-  0x1d, 0x0c, 0x01, 0xff, 	/*Color of index 232*/
-  0x13, 0x0a, 0x05, 0xff, 	/*Color of index 233*/
-  0x17, 0x0a, 0x02, 0xff, 	/*Color of index 234*/
-  0x71, 0x6c, 0x6d, 0xff, 	/*Color of index 235*/
-  0x1a, 0x13, 0x13, 0xff, 	/*Color of index 236*/
-  0x16, 0x0a, 0x0a, 0xff, 	/*Color of index 237*/
-  0x10, 0x0a, 0x0a, 0xff, 	/*Color of index 238*/
-  0x13, 0x09, 0x09, 0xff, 	/*Color of index 239*/
-  0x13, 0x06, 0x0b, 0xff, 	/*Color of index 240*/
-  0x19, 0x05, 0x0b, 0xff, 	/*Color of index 241*/
-  0x10, 0x05, 0x04, 0xff, 	/*Color of index 242*/
-  0x0b, 0x02, 0x01, 0xff, 	/*Color of index 243*/
-  0x02, 0x00, 0x00, 0xff, 	/*Color of index 244*/
-  0xcd, 0xca, 0xcd, 0xff, 	/*Color of index 245*/
-  0xaf, 0xac, 0xae, 0xff, 	/*Color of index 246*/
-  0x21, 0x1d, 0x1f, 0xff, 	/*Color of index 247*/
-  0x14, 0x0a, 0x10, 0xff, 	/*Color of index 248*/
-  0x19, 0x03, 0x12, 0xff, 	/*Color of index 249*/
-  0x13, 0x04, 0x10, 0xff, 	/*Color of index 250*/
-  0x0b, 0x03, 0x09, 0xff, 	/*Color of index 251*/
-  0x9c, 0x99, 0x9e, 0xff, 	/*Color of index 252*/
-  0x18, 0x13, 0x1f, 0xff, 	/*Color of index 253*/
-  0x16, 0x05, 0x1d, 0xff, 	/*Color of index 254*/
-  0x0a, 0x05, 0x11, 0xff, 	/*Color of index 255*/
-
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf2, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xed, 0xed, 0xef, 0xef, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf2, 0xf0, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf2, 0xe6, 0xe9, 0xed, 0xee, 0xed, 0xef, 0xf1, 0xf0, 0xef, 0xef, 0xef, 0xe9, 0xf0, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xe9, 0xed, 0xe9, 0xe9, 0xf2, 0xef, 0xf2, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf2, 0xf0, 0xf0, 0xe9, 0xed, 0xba, 0xed, 0xe9, 0xed, 0xef, 0xef, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf0, 0xfa, 0xf0, 0xee, 0xe9, 0xba, 0xba, 0xba, 0xe6, 0xf0, 0x91, 0xf9, 0xf9, 0xf0, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xfd, 0xf7, 0xf7, 0xe2, 0xf7, 0xec, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf8, 0xfb, 0xf8, 0xfa, 0xf9, 0xfa, 0xfa, 0xf0, 0xf8, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xe9, 0xe9, 0xe6, 0xe9, 0xed, 0xed, 0xf2, 0xed, 0xe9, 0xe9, 0xba, 0xba, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xe6, 0xf7, 0xe2, 0xe2, 0xe0, 0xe2, 0xf7, 0xe6, 0x95, 0xf4, 0xf4, 0xf4, 0xba, 0xba, 0xb9, 0xba, 0xf2, 0xef, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xba, 0xb9, 0x9a, 0xf2, 0xf0, 0xf0, 0xf2, 0xf4, 0xf3, 0xf7, 0xdd, 0xeb, 0xbf, 0x0a, 0xf5, 0x05, 0xa1, 0xbc, 0xa1, 0xa1, 0x05, 0xf5, 0xbd, 0xbf, 0xcc, 0xdd, 0xba, 0xf3, 0x9a, 0xf3, 0xe9, 0xe9, 0xef, 0xed, 0xef, 0xed, 0xe6, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xf0, 0xed, 0xee, 0xe9, 0xed, 0xf2, 0xe9, 0xed, 0xf2, 0xf8, 0xf8, 0x95, 0xf3, 0xf4, 0xe6, 0xe0, 0xce, 0xc2, 0xab, 0xa6, 0xa3, 0xa1, 0xbc, 0x98, 0x98, 0xbc, 0xa0, 0xa3, 0xa6, 0xfc, 0xeb, 0xd9, 0xfd, 0xf3, 0xf4, 0xf3, 0xe7, 0xe6, 0xe9, 0xed, 0xed, 0xf0, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xe9, 0xea, 0xef, 0xf0, 0xf0, 0xee, 0xf2, 0xe9, 0xef, 0xfb, 0xf4, 0x9a, 0xb8, 0xdb, 0xbf, 0xa3, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xbc, 0xa3, 0xc2, 0xdd, 0xb9, 0xf4, 0x9a, 0xb8, 0xba, 0xba, 0xe9, 0xfb, 0xec, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xef, 0xed, 0xed, 0xe9, 0xe9, 0xe6, 0xed, 0xf0, 0xf8, 0xf0, 0xf4, 0x95, 0xe2, 0x25, 0x0a, 0xbc, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xbb, 0x08, 0xfc, 0x6d, 0xe6, 0xf4, 0xf4, 0xe5, 0x9a, 0xba, 0xe9, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xba, 0xb9, 0xe9, 0xf0, 0xfa, 0xfa, 0xf0, 0xf2, 0xf4, 0xf3, 0x6d, 0xbf, 0xa1, 0x99, 0x99, 0x99, 0x96, 0x97, 0x96, 0x9c, 0x9b, 0x9b, 0x96, 0x96, 0x97, 0x97, 0x01, 0x02, 0x03, 0x03, 0x02, 0x00, 0x96, 0x99, 0x99, 0xf5, 0x15, 0xe2, 0x9a, 0x9a, 0xea, 0xe9, 0xf2, 0xf2, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xef, 0xe9, 0xed, 0xef, 0xed, 0xf8, 0xfa, 0xfb, 0xf8, 0xd9, 0x0a, 0x96, 0x99, 0x97, 0x02, 0x04, 0x06, 0x06, 0x04, 0x06, 0x02, 0x03, 0x00, 0x00, 0x97, 0x97, 0x98, 0x96, 0x9c, 0x9b, 0x96, 0x99, 0x99, 0x99, 0xbc, 0xbf, 0xdd, 0xf4, 0xf3, 0x9a, 0x9a, 0xe9, 0xee, 0xf0, 0xef, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xba, 0xb9, 0xe9, 0xf0, 0xfa, 0xfa, 0xfb, 0xf3, 0xdd, 0xf6, 0xbb, 0x99, 0x99, 0x96, 0x96, 0x96, 0x98, 0x99, 0x99, 0x96, 0x00, 0x03, 0x07, 0x09, 0x12, 0x16, 0x1a, 0x1c, 0x1c, 0x20, 0x1d, 0x1d, 0x17, 0x16, 0x0d, 0x07, 0x02, 0x04, 0x15, 0xdf, 0xf3, 0xef, 0xe6, 0xf2, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe6, 0xfb, 0xee, 0xfe, 0xfd, 0xfc, 0x03, 0x06, 0x0d, 0x13, 0x1a, 0x1c, 0x21, 0x21, 0x26, 0x26, 0x21, 0x21, 0x1a, 0x16, 0x0e, 0x07, 0x04, 0x97, 0x96, 0x96, 0x9b, 0x9b, 0x9b, 0x9b, 0x98, 0x99, 0x99, 0xbc, 0x0f, 0xdf, 0xf4, 0xf3, 0x9a, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xed, 0xee, 0xf2, 0xf8, 0xba, 0xba, 0xee, 0xfb, 0x95, 0xf4, 0xdf, 0xa6, 0x99, 0x99, 0x9c, 0x97, 0x96, 0x00, 0x97, 0x96, 0x97, 0x04, 0x09, 0x13, 0x1c, 0x45, 0x6c, 0x6a, 0x4b, 0x5e, 0x39, 0x49, 0x42, 0x2d, 0x2e, 0x3e, 0x2c, 0x2c, 0x32, 0x4e, 0x27, 0x19, 0x0c, 0x15, 0xe2, 0xf4, 0xf1, 0xe6, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf3, 0xfd, 0xfb, 0xfd, 0x15, 0x0b, 0x1d, 0x31, 0x48, 0x5a, 0x61, 0x4d, 0x58, 0x3f, 0x58, 0x4f, 0x58, 0x63, 0x63, 0x63, 0x67, 0x76, 0x45, 0x1a, 0x10, 0x09, 0x02, 0x96, 0x9b, 0x96, 0x96, 0x98, 0x96, 0x96, 0x99, 0x99, 0xbd, 0xe2, 0xf4, 0xf4, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xed, 0xe6, 0xf2, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xe6, 0xef, 0xef, 0xef, 0xee, 0xf2, 0xfb, 0xf3, 0x95, 0xec, 0xfc, 0xbb, 0x99, 0x9c, 0x9c, 0x97, 0xbb, 0x97, 0x97, 0x00, 0x09, 0x17, 0x24, 0x5c, 0x68, 0x42, 0x3a, 0x30, 0x43, 0x30, 0x30, 0x3c, 0x30, 0x30, 0x28, 0x2e, 0x23, 0x2c, 0x29, 0x4e, 0x64, 0x79, 0x8b, 0x93, 0xff, 0xfa, 0xf0, 0xf8, 0xfa, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xfb, 0xfb, 0xf9, 0xf7, 0x83, 0x77, 0x4e, 0x24, 0x26, 0x2a, 0x4d, 0x49, 0x42, 0x4f, 0x50, 0x3f, 0x3f, 0x4f, 0x62, 0x55, 0x30, 0x56, 0x68, 0x6f, 0x3e, 0x21, 0x12, 0x06, 0x01, 0x96, 0x97, 0x98, 0x9c, 0x9b, 0x9c, 0x99, 0xbc, 0xbf, 0xe6, 0xf4, 0xf3, 0xee, 0xee, 0xe6, 0xf2, 0xf2, 0xf2, 0xed, 0xed, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xef, 0xf2, 0xed, 0xed, 0xf3, 0xef, 0x95, 0xf4, 0x25, 0x05, 0x99, 0xbb, 0x98, 0x98, 0x01, 0x96, 0x97, 0x04, 0x0d, 0x24, 0x57, 0x4d, 0x3f, 0x3c, 0x37, 0x3d, 0x47, 0x4c, 0x3a, 0x3a, 0x43, 0x44, 0x28, 0x2c, 0x26, 0x31, 0x74, 0x7c, 0x89, 0x8d, 0x93, 0x94, 0x94, 0xff, 0xf8, 0xee, 0xfa, 0xf8, 0xf9, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xe9, 0xed, 0xe6, 0xf3, 0xf8, 0xf0, 0xfa, 0x94, 0x95, 0x95, 0x92, 0x87, 0x7e, 0x52, 0x32, 0x2e, 0x4d, 0x56, 0x58, 0x58, 0x4f, 0x3c, 0x40, 0x54, 0x54, 0x47, 0x59, 0x5f, 0x4f, 0x68, 0x48, 0x1c, 0x09, 0x01, 0x99, 0x9b, 0x98, 0x9b, 0x96, 0x96, 0x99, 0xa1, 0xce, 0xf4, 0xf4, 0xef, 0xf2, 0xf2, 0xec, 0xed, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xec, 0xf3, 0xe6, 0xed, 0xf4, 0xec, 0x0f, 0x99, 0x96, 0x98, 0x96, 0x00, 0x97, 0x00, 0x06, 0x12, 0x31, 0x6f, 0x35, 0x30, 0x59, 0x40, 0x41, 0x4c, 0x43, 0x34, 0x3a, 0x30, 0x39, 0x2e, 0x2c, 0x20, 0x77, 0x89, 0x8e, 0x90, 0x93, 0xff, 0xee, 0xee, 0xee, 0xee, 0x9a, 0xef, 0xed, 0xf8, 0xfb, 0xfb, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xef, 0xed, 0xed, 0xe9, 0xe9, 0xe6, 0xf8, 0xf3, 0xf8, 0xf3, 0xb9, 0xe6, 0xee, 0x94, 0x92, 0x8f, 0x88, 0x7b, 0x5a, 0x35, 0x2d, 0x30, 0x4a, 0x59, 0x51, 0x54, 0x54, 0x4c, 0x50, 0x49, 0x49, 0x58, 0x3c, 0x4d, 0x76, 0x24, 0x0d, 0x04, 0x96, 0x96, 0x01, 0x96, 0x99, 0x98, 0x99, 0xbf, 0xec, 0xf4, 0xe6, 0xf8, 0xf2, 0xef, 0xed, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xed, 0xed, 0xef, 0xf3, 0xef, 0xf2, 0xe6, 0xf4, 0xdf, 0xf5, 0x99, 0xbb, 0x98, 0xbb, 0x96, 0x97, 0x03, 0x0d, 0x29, 0x5c, 0x50, 0x3f, 0x53, 0x4c, 0x37, 0x41, 0x3d, 0x3a, 0x3a, 0x43, 0x3a, 0x34, 0x28, 0x26, 0x1a, 0x64, 0x90, 0x93, 0xff, 0xf3, 0xe6, 0xef, 0xee, 0xf8, 0xee, 0xef, 0xef, 0xef, 0xe9, 0xba, 0xba, 0xe5, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xef, 0xe9, 0xe6, 0xf3, 0xe6, 0xed, 0xf2, 0xed, 0xed, 0xed, 0xf2, 0xe9, 0xf8, 0x91, 0x93, 0x90, 0x8e, 0x88, 0x80, 0x7a, 0x3e, 0x35, 0x56, 0x4f, 0x50, 0x53, 0x4a, 0x4c, 0x3f, 0x4c, 0x43, 0x3c, 0x3f, 0x49, 0x6f, 0x21, 0x0e, 0x03, 0x99, 0x96, 0xbc, 0x99, 0x98, 0x99, 0xa6, 0xdf, 0xf4, 0xef, 0xef, 0xf2, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xef, 0xef, 0xee, 0xf0, 0xee, 0xf0, 0xf4, 0xce, 0xbc, 0x99, 0x98, 0xbb, 0x97, 0x97, 0x01, 0x09, 0x24, 0x6c, 0x4d, 0x4c, 0x3d, 0x3d, 0x43, 0x3a, 0x50, 0x3a, 0x53, 0x47, 0x47, 0x51, 0x34, 0x28, 0x7a, 0x8c, 0x85, 0x92, 0x94, 0xf8, 0xe8, 0xe7, 0xe8, 0xed, 0xf1, 0xfa, 0xf0, 0xf1, 0xf0, 0xef, 0xe6, 0xba, 0xba, 0xb9, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xef, 0xe9, 0xe9, 0xe9, 0xe9, 0xf2, 0xee, 0xf1, 0xf9, 0xf1, 0xf1, 0xea, 0xe7, 0xb9, 0xb9, 0xb9, 0x9a, 0x95, 0x95, 0x90, 0x8e, 0x5b, 0x26, 0x49, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x43, 0x43, 0x4c, 0x51, 0x51, 0x38, 0x61, 0x72, 0x24, 0x0e, 0x01, 0x99, 0x98, 0x98, 0xbb, 0x99, 0x98, 0xd9, 0xf4, 0xf2, 0xe9, 0xe6, 0xef, 0xf0, 0xed, 0xed, 0xef, 0xf0, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xf1, 0xf0, 0xed, 0xe9, 0xfb, 0xf8, 0x95, 0xf4, 0xcc, 0xbc, 0x99, 0x98, 0x9c, 0x98, 0x99, 0x03, 0x12, 0x2c, 0x63, 0x30, 0x4c, 0x51, 0x51, 0x47, 0x43, 0x43, 0x43, 0x53, 0x47, 0x51, 0x37, 0x40, 0x28, 0x4e, 0x8c, 0x92, 0x95, 0xf0, 0xf0, 0xf1, 0xef, 0xe8, 0xe7, 0xe9, 0xef, 0xef, 0xe9, 0xef, 0xe9, 0xed, 0xe9, 0xed, 0xba, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xe9, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xba, 0xe9, 0xe9, 0xba, 0xee, 0x93, 0x88, 0x32, 0x33, 0x5f, 0x5d, 0x3d, 0x4c, 0x50, 0x3f, 0x43, 0x51, 0x54, 0x51, 0x40, 0x40, 0x4f, 0x58, 0x5c, 0x17, 0x07, 0x97, 0x97, 0xbc, 0x9c, 0x9b, 0xbc, 0xcc, 0xf4, 0xba, 0xb9, 0xe6, 0xf0, 0xef, 0xf0, 0xf8, 0xf1, 0xed, 0xed, 0xef, 0xe9, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf8, 0xf0, 0xf2, 0xed, 0x9a, 0xf0, 0xf4, 0x95, 0xc6, 0x99, 0x99, 0xbc, 0x97, 0x00, 0x97, 0x06, 0x1d, 0x6c, 0x56, 0x30, 0x53, 0x3d, 0x37, 0x47, 0x40, 0x4c, 0x3a, 0x3a, 0x3d, 0x30, 0x58, 0x42, 0x28, 0x24, 0x89, 0x92, 0xf8, 0xe6, 0xb9, 0xef, 0xfa, 0xfa, 0xef, 0xba, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf0, 0xef, 0xef, 0xf0, 0xef, 0xe9, 0xe9, 0xe9, 0xef, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xba, 0xe7, 0xff, 0x90, 0x82, 0x21, 0x28, 0x2d, 0x3f, 0x4c, 0x3d, 0x3c, 0x3c, 0x47, 0x47, 0x4a, 0x3c, 0x38, 0x51, 0x40, 0x4a, 0x6a, 0x57, 0x0e, 0x02, 0x96, 0x9c, 0x98, 0x99, 0x96, 0xeb, 0xf4, 0x9a, 0xef, 0xee, 0xf0, 0xed, 0xf0, 0xed, 0xed, 0xef, 0xed, 0xee, 0xe9, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xfb, 0xec, 0xef, 0xe9, 0x9a, 0xf4, 0xc7, 0x99, 0x98, 0x98, 0x97, 0x00, 0x00, 0x09, 0x20, 0x6f, 0x42, 0x3c, 0x3c, 0x3c, 0x3a, 0x50, 0x4c, 0x41, 0x47, 0x47, 0x40, 0x34, 0x2e, 0x21, 0x21, 0x27, 0x7e, 0x93, 0x91, 0xb9, 0xb9, 0xb9, 0xf1, 0xfa, 0xf1, 0xf8, 0xba, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xef, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xef, 0xea, 0xba, 0xed, 0x93, 0x90, 0x81, 0x82, 0x29, 0x39, 0x4f, 0x47, 0x40, 0x4a, 0x40, 0x40, 0x43, 0x42, 0x43, 0x40, 0x51, 0x51, 0x38, 0x58, 0x6b, 0x1a, 0x04, 0x96, 0x98, 0x00, 0x97, 0x99, 0xeb, 0xf4, 0xba, 0xf2, 0xe6, 0xe6, 0xf2, 0xe6, 0xf1, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xf0, 0xf2, 0xf2, 0x9a, 0xf4, 0xcc, 0x99, 0xbb, 0x98, 0x98, 0x97, 0x01, 0x0d, 0x5a, 0x72, 0x38, 0x4a, 0x40, 0x3c, 0x3a, 0x3a, 0x43, 0x43, 0x3d, 0x51, 0x40, 0x3f, 0x2a, 0x31, 0x84, 0x86, 0x8b, 0x93, 0x95, 0xb9, 0xb9, 0xb8, 0xea, 0xed, 0xfa, 0xfa, 0xed, 0xe9, 0xe9, 0xf0, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xe9, 0xe9, 0xea, 0xba, 0xf3, 0x95, 0x93, 0x8c, 0x46, 0x2b, 0x51, 0x51, 0x40, 0x40, 0x3a, 0x34, 0x44, 0x30, 0x51, 0x54, 0x51, 0x51, 0x40, 0x4f, 0x5c, 0x24, 0x0b, 0x97, 0x01, 0x98, 0x97, 0x99, 0xce, 0xf4, 0xe6, 0xe6, 0xf3, 0xe6, 0xef, 0xe9, 0xed, 0xef, 0xee, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf8, 0xf3, 0xef, 0xf4, 0xcc, 0x9b, 0x9c, 0xbc, 0x96, 0x01, 0x01, 0x0e, 0x45, 0x49, 0x4a, 0x51, 0x37, 0x3d, 0x3a, 0x55, 0x4c, 0x3a, 0x43, 0x4c, 0x3d, 0x34, 0x2a, 0x24, 0x87, 0x93, 0x94, 0x91, 0xee, 0xe6, 0x9a, 0xb8, 0xba, 0xed, 0xf1, 0xfa, 0xf8, 0xef, 0xb9, 0xf0, 0xef, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xea, 0xea, 0xb8, 0xe7, 0xb9, 0xf8, 0x93, 0x88, 0x32, 0x2b, 0x38, 0x38, 0x38, 0x3f, 0x34, 0x34, 0x30, 0x3a, 0x40, 0x40, 0x40, 0x37, 0x51, 0x37, 0x62, 0x32, 0x12, 0x02, 0x96, 0x98, 0x99, 0x01, 0xdd, 0xf4, 0xe6, 0x9a, 0xe6, 0xf2, 0xed, 0xed, 0xef, 0xef, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xf0, 0xf4, 0xdf, 0x9c, 0x9b, 0x9e, 0x97, 0x01, 0x00, 0x0e, 0x45, 0x4b, 0x3c, 0x47, 0x40, 0x3d, 0x43, 0x34, 0x3a, 0x41, 0x3d, 0x43, 0x43, 0x2d, 0x2c, 0x2f, 0x79, 0x93, 0xf8, 0xee, 0xee, 0xee, 0xed, 0xba, 0xe8, 0xf2, 0xf8, 0xfa, 0xfa, 0xf0, 0xe9, 0xba, 0xee, 0xfb, 0xed, 0xee, 0xe6, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xed, 0xe6, 0xf3, 0xf2, 0xee, 0xf2, 0xe6, 0xf2, 0xee, 0xf2, 0xef, 0xe9, 0xe8, 0xe8, 0xe8, 0xee, 0x91, 0x8f, 0x74, 0x21, 0x2a, 0x4d, 0x2e, 0x23, 0x44, 0x30, 0x3d, 0x37, 0x30, 0x43, 0x44, 0x3a, 0x47, 0x51, 0x51, 0x4f, 0x5c, 0x10, 0x01, 0x96, 0x00, 0x96, 0xa3, 0xec, 0xf4, 0xe9, 0xe9, 0xba, 0xed, 0xe9, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xe6, 0xf4, 0xe2, 0x05, 0x9b, 0x9c, 0xbc, 0x97, 0x03, 0x0e, 0x5a, 0x44, 0x3f, 0x3d, 0x40, 0x3a, 0x43, 0x44, 0x3a, 0x43, 0x41, 0x47, 0x50, 0x28, 0x45, 0x88, 0x92, 0x95, 0xf3, 0xe5, 0xba, 0xea, 0xf0, 0xed, 0xfa, 0xf8, 0xfa, 0xf1, 0xfa, 0xed, 0xed, 0xe9, 0xba, 0xf2, 0xec, 0xf3, 0xf8, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xef, 0xf2, 0xef, 0xf8, 0xef, 0xf4, 0xe6, 0xed, 0xee, 0xef, 0xf0, 0xf2, 0xee, 0xe6, 0xef, 0xef, 0xf1, 0xf1, 0xea, 0xf1, 0xfa, 0x93, 0x8a, 0x79, 0x84, 0x8e, 0x8e, 0x7b, 0x23, 0x43, 0x40, 0x47, 0x3d, 0x3a, 0x34, 0x3a, 0x3d, 0x47, 0x54, 0x41, 0x42, 0x6c, 0x1b, 0x02, 0x97, 0x96, 0x96, 0xbd, 0xf4, 0x9a, 0xe9, 0xb9, 0xe9, 0xed, 0xef, 0xed, 0xf8, 0xef, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xe6, 0xf3, 0xf4, 0x0f, 0x99, 0x98, 0xbc, 0x97, 0x02, 0x09, 0x66, 0x39, 0x3c, 0x3c, 0x3a, 0x3a, 0x3a, 0x44, 0x34, 0x44, 0x3c, 0x3d, 0x59, 0x28, 0x3e, 0x89, 0x92, 0xec, 0xe6, 0xe5, 0xea, 0xea, 0xef, 0xed, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf8, 0xed, 0xef, 0xf2, 0xf2, 0xed, 0xfb, 0xec, 0xfb, 0xef, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xee, 0xf0, 0xef, 0xf2, 0xf3, 0xec, 0xf8, 0xef, 0xf3, 0xf8, 0xf3, 0xe6, 0xf0, 0xf3, 0xe9, 0xf0, 0xf1, 0xf9, 0xf1, 0xf1, 0xf8, 0xff, 0x95, 0x92, 0x93, 0xf8, 0x91, 0x8e, 0x6e, 0x2b, 0x40, 0x47, 0x41, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x4c, 0x41, 0x4c, 0x2b, 0x6a, 0x16, 0x03, 0x97, 0x97, 0x99, 0x3b, 0xf4, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xf8, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xe9, 0xf4, 0xc7, 0x99, 0x97, 0x00, 0x97, 0x01, 0x07, 0x76, 0x33, 0x4a, 0x47, 0x4a, 0x3a, 0x34, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3c, 0x42, 0x32, 0x82, 0x92, 0x9a, 0x9a, 0xe8, 0xf1, 0xfb, 0xed, 0xe7, 0xef, 0xef, 0xf0, 0xf8, 0xf0, 0xed, 0xed, 0xef, 0xf0, 0xf0, 0xf8, 0xf8, 0xef, 0xf4, 0xdf, 0xdf, 0xfb, 0xed, 0xee, 0xef, 0xf8, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xf2, 0xef, 0xf8, 0xe6, 0xf8, 0xf4, 0xef, 0xe6, 0xf2, 0xf0, 0xf0, 0xf2, 0xe6, 0xba, 0xe9, 0xfb, 0xf1, 0xf0, 0xef, 0xf3, 0xe7, 0xf0, 0xee, 0xe7, 0x9a, 0x9a, 0x93, 0x80, 0x28, 0x38, 0x40, 0x40, 0x3d, 0x47, 0x40, 0x40, 0x3f, 0x43, 0x3a, 0x47, 0x54, 0x38, 0x6f, 0x1a, 0x03, 0x00, 0x00, 0x98, 0xdf, 0xf4, 0xe6, 0xe9, 0xe9, 0xed, 0xef, 0xf8, 0xef, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xf4, 0xe2, 0x05, 0x96, 0x01, 0x00, 0x97, 0x04, 0x20, 0x3e, 0x4a, 0x51, 0x47, 0x3c, 0x43, 0x3a, 0x3d, 0x47, 0x51, 0x47, 0x3c, 0x3f, 0x23, 0x7a, 0x8e, 0xff, 0xe4, 0xe7, 0xf8, 0xfe, 0xfe, 0xf8, 0xba, 0xba, 0xe9, 0xe9, 0xef, 0xe6, 0xe9, 0x9a, 0xf2, 0xf2, 0xf9, 0xf9, 0xf3, 0xf3, 0xe2, 0xa6, 0xdf, 0xf3, 0xf8, 0xf0, 0xf8, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf2, 0xf7, 0xbd, 0xbf, 0xec, 0xf3, 0xf3, 0xef, 0xf4, 0xe6, 0xf3, 0xba, 0xba, 0xf2, 0xf2, 0xea, 0xb9, 0xea, 0xba, 0xea, 0xf2, 0xf2, 0xe7, 0xba, 0x93, 0x7e, 0x23, 0x30, 0x37, 0x30, 0x37, 0x47, 0x38, 0x38, 0x3f, 0x3a, 0x3a, 0x47, 0x40, 0x47, 0x2b, 0x6f, 0x16, 0x03, 0x00, 0x97, 0xbf, 0xf4, 0xf2, 0xed, 0xe9, 0xed, 0xef, 0xf0, 0xef, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xf4, 0xfc, 0x99, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x5c, 0x34, 0x5d, 0x47, 0x4a, 0x4c, 0x3a, 0x3c, 0x47, 0x47, 0x47, 0x51, 0x3c, 0x39, 0x26, 0x88, 0x90, 0xe6, 0xb9, 0xe5, 0xf1, 0xf9, 0xf9, 0xf8, 0xb8, 0xe5, 0xba, 0xed, 0xf3, 0xf4, 0x9a, 0xb9, 0xb9, 0xdf, 0xdf, 0x94, 0x8b, 0x1e, 0x08, 0xf6, 0xf4, 0xef, 0xef, 0xef, 0xf0, 0xfa, 0xf8, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xe9, 0xf2, 0x95, 0x1e, 0x00, 0x08, 0xf7, 0x7d, 0xa1, 0x25, 0xf3, 0xe6, 0xf2, 0xf3, 0xf4, 0xba, 0xf2, 0xb8, 0xb8, 0xb8, 0xba, 0xe8, 0xf2, 0xed, 0xf2, 0x94, 0x84, 0x31, 0x2b, 0x2b, 0x3a, 0x3a, 0x37, 0x3d, 0x38, 0x3c, 0x3d, 0x3d, 0x3d, 0x47, 0x47, 0x4a, 0x3f, 0x5e, 0x12, 0x02, 0x97, 0x99, 0xdf, 0xf3, 0xe9, 0xba, 0xe9, 0xee, 0xf0, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xed, 0xef, 0xed, 0xf2, 0xee, 0xf2, 0xf4, 0xdf, 0x9f, 0x97, 0x00, 0x98, 0x97, 0x0d, 0x69, 0x30, 0x4c, 0x37, 0x4a, 0x3c, 0x3c, 0x3d, 0x47, 0x47, 0x3d, 0x4c, 0x3c, 0x34, 0x49, 0x57, 0x8e, 0x92, 0xf8, 0xe5, 0xe8, 0xf8, 0xf8, 0xf1, 0xf2, 0xe5, 0xba, 0xfd, 0xf3, 0x7d, 0xc2, 0xdf, 0xf4, 0xf4, 0xfc, 0x11, 0x83, 0x0d, 0x06, 0x08, 0x7d, 0xf4, 0xe5, 0xe8, 0xf1, 0xf8, 0xfa, 0xff, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xba, 0xb9, 0x94, 0x79, 0x1f, 0x0e, 0x10, 0x0b, 0x99, 0x11, 0xeb, 0xf3, 0xfb, 0xf3, 0xc6, 0xbd, 0x9a, 0xf2, 0xb8, 0xe5, 0xb9, 0xba, 0xe6, 0xf0, 0xec, 0xf4, 0x1e, 0x1d, 0x5c, 0x2b, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x4c, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x40, 0x4a, 0x4b, 0x0e, 0x02, 0x99, 0xf6, 0xed, 0x9a, 0xb9, 0xb9, 0xef, 0xfa, 0xef, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xee, 0xef, 0xed, 0xed, 0xed, 0xf3, 0xec, 0xf3, 0xf4, 0xab, 0x9c, 0x98, 0x00, 0x00, 0x07, 0x29, 0x56, 0x3d, 0x53, 0x37, 0x4c, 0x4c, 0x3d, 0x41, 0x41, 0x3d, 0x4c, 0x3a, 0x30, 0x49, 0x75, 0x24, 0x36, 0x95, 0x95, 0xb8, 0xe5, 0xed, 0xec, 0x95, 0xe2, 0x9a, 0xb9, 0xf4, 0x6d, 0xbc, 0x03, 0x8b, 0x83, 0x3b, 0x06, 0x06, 0x16, 0x16, 0x1b, 0x22, 0x93, 0xef, 0xea, 0xba, 0xed, 0xf0, 0xf8, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xee, 0x93, 0x87, 0x27, 0x48, 0x1c, 0x1d, 0x1d, 0x79, 0x03, 0x05, 0xfc, 0xf6, 0x99, 0x99, 0xc7, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xfb, 0xf0, 0xba, 0xf4, 0xc6, 0x03, 0x66, 0x5e, 0x2b, 0x37, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x4c, 0x3d, 0x4c, 0x3d, 0x41, 0x40, 0x44, 0x26, 0x06, 0x01, 0xbb, 0x7d, 0xba, 0x9a, 0xe6, 0xfb, 0xf8, 0xf0, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xee, 0xed, 0xf2, 0xef, 0xee, 0xf4, 0xf7, 0x98, 0x9c, 0xbc, 0x00, 0x02, 0x1c, 0x4b, 0x30, 0x4c, 0x51, 0x5d, 0x38, 0x3d, 0x3a, 0x3d, 0x4c, 0x41, 0x3c, 0x3c, 0x56, 0x73, 0x75, 0x7a, 0x03, 0x11, 0x6d, 0x94, 0xff, 0x91, 0x93, 0x15, 0x97, 0x3b, 0x91, 0x6d, 0x04, 0x03, 0x0d, 0x1b, 0x17, 0x16, 0x1a, 0x3e, 0x5a, 0x4e, 0x1f, 0x8e, 0x93, 0xec, 0xf0, 0xe8, 0xef, 0xed, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xee, 0xf8, 0x94, 0x92, 0x4e, 0x2a, 0x61, 0x4d, 0x57, 0x6e, 0x24, 0x0e, 0x06, 0x09, 0x0b, 0x01, 0x00, 0x1e, 0x95, 0x6d, 0xfc, 0x25, 0xfb, 0xf4, 0xf2, 0xf4, 0xc7, 0x99, 0x17, 0x7a, 0x55, 0x30, 0x38, 0x40, 0x40, 0x41, 0x3d, 0x47, 0x3d, 0x3d, 0x41, 0x3d, 0x40, 0x4a, 0x30, 0x69, 0x1a, 0x03, 0x96, 0xfc, 0xf4, 0xee, 0xf0, 0xf8, 0xf1, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xef, 0xed, 0xed, 0xf2, 0xe6, 0xf2, 0xf4, 0xcc, 0x99, 0x98, 0xbc, 0x97, 0x09, 0x4d, 0x42, 0x4c, 0x3d, 0x37, 0x59, 0x37, 0x4c, 0x3d, 0x3d, 0x3c, 0x3c, 0x3c, 0x56, 0x73, 0x72, 0x67, 0x76, 0x1b, 0x07, 0x14, 0x85, 0x85, 0x79, 0x7e, 0x0d, 0x0d, 0x0d, 0x19, 0x17, 0x17, 0x27, 0x2f, 0x46, 0x45, 0x5a, 0x5c, 0x61, 0x4d, 0x24, 0x64, 0x90, 0x8d, 0xfb, 0xed, 0xef, 0xef, 0xe9, 0xee, 0xe9, 0xef, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xe6, 0xff, 0x89, 0x21, 0x33, 0x58, 0x39, 0x5a, 0x45, 0x6a, 0x45, 0x66, 0x52, 0x0e, 0x02, 0x01, 0x0c, 0x00, 0x99, 0x96, 0x3b, 0xf7, 0xf7, 0xd9, 0xa6, 0x96, 0x1b, 0x76, 0x72, 0x4f, 0x38, 0x38, 0x40, 0x40, 0x41, 0x41, 0x47, 0x41, 0x3d, 0x41, 0x3d, 0x40, 0x3d, 0x43, 0x3e, 0x0d, 0x96, 0x05, 0xec, 0x9a, 0xfa, 0xf8, 0xf2, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xef, 0xfb, 0xee, 0xf4, 0xa6, 0x96, 0xbc, 0x98, 0x03, 0x1c, 0x5f, 0x3d, 0x4c, 0x4c, 0x47, 0x38, 0x4a, 0x3d, 0x3d, 0x4c, 0x3c, 0x3f, 0x42, 0x63, 0x68, 0x60, 0x72, 0x6f, 0x78, 0x76, 0x7a, 0x31, 0x57, 0x57, 0x5a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x78, 0x4b, 0x6a, 0x69, 0x5c, 0x6a, 0x3e, 0x32, 0x27, 0x8f, 0x92, 0xff, 0xed, 0xed, 0xed, 0xef, 0xed, 0xe9, 0xee, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xb8, 0xb9, 0xb9, 0x94, 0x7e, 0x21, 0x4d, 0x5e, 0x44, 0x5e, 0x49, 0x56, 0x56, 0x60, 0x6a, 0x24, 0x16, 0x0d, 0x0b, 0x07, 0x04, 0x02, 0x01, 0x97, 0x99, 0x99, 0x07, 0x52, 0x6c, 0x5e, 0x75, 0x39, 0x38, 0x37, 0x40, 0x41, 0x47, 0x41, 0x47, 0x41, 0x3d, 0x4c, 0x41, 0x4a, 0x37, 0x58, 0x2a, 0x02, 0x99, 0xce, 0xf4, 0xf8, 0xf0, 0xe7, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xed, 0xed, 0xf2, 0xef, 0xf3, 0xe2, 0xa1, 0xbb, 0xa1, 0x96, 0x0b, 0x32, 0x54, 0x47, 0x3d, 0x43, 0x4a, 0x3f, 0x3c, 0x4c, 0x4c, 0x30, 0x3c, 0x56, 0x63, 0x72, 0x68, 0x67, 0x67, 0x72, 0x72, 0x72, 0x6f, 0x6b, 0x6b, 0x6f, 0x72, 0x72, 0x67, 0x6f, 0x67, 0x61, 0x67, 0x68, 0x68, 0x69, 0x5e, 0x4b, 0x5a, 0x45, 0x24, 0x87, 0x91, 0xff, 0xe6, 0xe9, 0xba, 0xea, 0xef, 0xed, 0xee, 0xed, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xe6, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xf2, 0xee, 0xed, 0xf2, 0xef, 0xef, 0xe9, 0xe7, 0xea, 0xb9, 0xee, 0x92, 0x36, 0x2c, 0x61, 0x62, 0x43, 0x56, 0x56, 0x61, 0x60, 0x60, 0x6a, 0x76, 0x5a, 0x45, 0x31, 0x29, 0x0e, 0x04, 0x04, 0x04, 0x09, 0x20, 0x6c, 0x6a, 0x5e, 0x69, 0x6f, 0x42, 0x4a, 0x37, 0x40, 0x3d, 0x3d, 0x47, 0x3d, 0x41, 0x40, 0x3d, 0x47, 0x54, 0x30, 0x67, 0x09, 0x96, 0xfc, 0xf4, 0xf0, 0xea, 0xba, 0xe9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xf4, 0xce, 0x96, 0x9e, 0x01, 0x00, 0x17, 0x4b, 0x51, 0x47, 0x3a, 0x34, 0x3c, 0x3f, 0x3c, 0x3d, 0x3c, 0x50, 0x42, 0x68, 0x68, 0x67, 0x67, 0x67, 0x6f, 0x68, 0x72, 0x69, 0x72, 0x69, 0x72, 0x72, 0x72, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5e, 0x5e, 0x56, 0x69, 0x5c, 0x57, 0x24, 0x7e, 0x94, 0x95, 0xba, 0xb8, 0xba, 0xea, 0xef, 0xed, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xed, 0xe6, 0xf2, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xed, 0xed, 0xf3, 0xef, 0xee, 0xed, 0xf3, 0xed, 0xe6, 0xee, 0xf2, 0xf2, 0xef, 0xee, 0xed, 0xef, 0xf1, 0xf1, 0xf1, 0xee, 0x9a, 0x8d, 0x2f, 0x23, 0x70, 0x59, 0x4f, 0x61, 0x56, 0x63, 0x61, 0x56, 0x56, 0x68, 0x5e, 0x75, 0x69, 0x76, 0x52, 0x29, 0x57, 0x76, 0x6f, 0x5e, 0x63, 0x69, 0x6a, 0x6c, 0x73, 0x4f, 0x3c, 0x3c, 0x41, 0x3d, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x51, 0x37, 0x5e, 0x1a, 0x02, 0xa3, 0xe3, 0xf2, 0xba, 0xe7, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xee, 0xef, 0xed, 0xed, 0xef, 0xf3, 0xf4, 0xc2, 0x9c, 0xbc, 0x01, 0x06, 0x29, 0x49, 0x3d, 0x40, 0x3c, 0x3f, 0x3f, 0x4c, 0x3c, 0x3f, 0x3c, 0x49, 0x63, 0x72, 0x67, 0x60, 0x67, 0x72, 0x67, 0x69, 0x6a, 0x69, 0x6f, 0x69, 0x6f, 0x69, 0x6a, 0x69, 0x6f, 0x69, 0x67, 0x6a, 0x6a, 0x69, 0x69, 0x69, 0x69, 0x5c, 0x29, 0x7e, 0x8f, 0x95, 0xb9, 0xb8, 0xb8, 0xba, 0xe8, 0xed, 0xf0, 0xf0, 0xef, 0xba, 0xe6, 0xed, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xed, 0xe6, 0xed, 0xed, 0xe6, 0xf0, 0xf2, 0xf0, 0xe6, 0xed, 0xf2, 0xf2, 0xef, 0xf2, 0xf9, 0xf9, 0xf9, 0xef, 0xe9, 0x95, 0x86, 0x32, 0x33, 0x5f, 0x58, 0x5f, 0x58, 0x5f, 0x63, 0x62, 0x63, 0x63, 0x63, 0x49, 0x5e, 0x4b, 0x76, 0x76, 0x6f, 0x67, 0x72, 0x63, 0x71, 0x5e, 0x6a, 0x5c, 0x69, 0x71, 0x4f, 0x3c, 0x3d, 0x41, 0x3d, 0x47, 0x3d, 0x3d, 0x3d, 0x37, 0x37, 0x47, 0x30, 0x45, 0x09, 0xbc, 0x7d, 0xf4, 0xba, 0xba, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xf0, 0xf4, 0x0f, 0x9c, 0xbc, 0x00, 0x0e, 0x4b, 0x3c, 0x37, 0x40, 0x3c, 0x3f, 0x3a, 0x4c, 0x3d, 0x30, 0x3f, 0x56, 0x68, 0x69, 0x60, 0x67, 0x60, 0x67, 0x67, 0x6f, 0x5c, 0x6a, 0x67, 0x69, 0x69, 0x69, 0x6a, 0x6a, 0x6a, 0x69, 0x6f, 0x60, 0x6a, 0x5c, 0x5c, 0x6a, 0x5c, 0x29, 0x77, 0x8f, 0x93, 0xf8, 0xf8, 0xea, 0x9a, 0xe7, 0xe9, 0xef, 0xf0, 0xe9, 0xf2, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xef, 0xef, 0xef, 0xfa, 0xfa, 0xf1, 0xf1, 0xef, 0xfb, 0x93, 0x86, 0x26, 0x2d, 0x63, 0x5f, 0x62, 0x5f, 0x62, 0x58, 0x71, 0x56, 0x75, 0x69, 0x6a, 0x69, 0x4b, 0x4d, 0x72, 0x68, 0x68, 0x68, 0x5e, 0x68, 0x67, 0x6f, 0x5e, 0x72, 0x71, 0x3f, 0x3c, 0x3d, 0x3d, 0x41, 0x41, 0x40, 0x3d, 0x3d, 0x30, 0x5d, 0x2b, 0x5e, 0x16, 0x97, 0xd9, 0xf4, 0xba, 0xfb, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xee, 0xef, 0xed, 0xed, 0xef, 0xef, 0xf4, 0xf6, 0x9c, 0x00, 0x02, 0x1c, 0x3f, 0x38, 0x30, 0x3c, 0x38, 0x4a, 0x3c, 0x47, 0x3d, 0x3f, 0x63, 0x68, 0x5e, 0x60, 0x60, 0x60, 0x6f, 0x67, 0x72, 0x60, 0x6a, 0x67, 0x68, 0x68, 0x68, 0x69, 0x60, 0x69, 0x69, 0x72, 0x72, 0x72, 0x67, 0x6a, 0x6a, 0x5c, 0x45, 0x74, 0x8f, 0x91, 0xe7, 0x94, 0xf9, 0xfb, 0xed, 0xe6, 0xf1, 0xf4, 0xf4, 0xf2, 0xe3, 0xde, 0xd9, 0xdd, 0xdf, 0xf7, 0xf2, 0xf4, 0xf2, 0xef, 0xef, 0xf2, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xef, 0xf4, 0xf3, 0xec, 0xd9, 0xc7, 0xbf, 0xbf, 0xc2, 0xce, 0xdf, 0xf2, 0xf3, 0xf3, 0xb9, 0xb9, 0xba, 0xea, 0xf2, 0xf0, 0xff, 0x94, 0x85, 0x31, 0x3e, 0x4b, 0x5e, 0x5e, 0x56, 0x63, 0x63, 0x63, 0x63, 0x68, 0x63, 0x63, 0x63, 0x75, 0x67, 0x60, 0x6f, 0x6a, 0x69, 0x67, 0x68, 0x61, 0x67, 0x69, 0x68, 0x71, 0x50, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x40, 0x37, 0x3d, 0x3d, 0x3f, 0x23, 0x04, 0x25, 0xf4, 0xee, 0x91, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xf2, 0xee, 0xf4, 0xf6, 0x96, 0xbc, 0x06, 0x2c, 0x34, 0x37, 0x3c, 0x3c, 0x38, 0x40, 0x4c, 0x3d, 0x3c, 0x63, 0x68, 0x68, 0x60, 0x67, 0x67, 0x60, 0x67, 0x67, 0x69, 0x69, 0x5c, 0x69, 0x67, 0x67, 0x68, 0x67, 0x72, 0x68, 0x72, 0x73, 0x63, 0x68, 0x67, 0x60, 0x6c, 0x31, 0x74, 0x8e, 0x93, 0xee, 0xb8, 0xef, 0xf0, 0xfb, 0xef, 0xf3, 0xf4, 0xec, 0xc6, 0xbd, 0xa1, 0x9b, 0x9c, 0x9b, 0xbb, 0x05, 0xbd, 0xce, 0xf4, 0xf4, 0xf3, 0xe6, 0xf2, 0xed, 0xf2, 0xf0, 0xe6, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xf2, 0xf2, 0xed, 0xe6, 0xf2, 0xf4, 0xec, 0xbf, 0xa3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xbc, 0xbd, 0xcc, 0xf4, 0xf4, 0xb9, 0xb8, 0xf2, 0xed, 0xfb, 0xba, 0x95, 0x93, 0x85, 0x2f, 0x4b, 0x60, 0x4b, 0x60, 0x56, 0x56, 0x62, 0x63, 0x63, 0x72, 0x63, 0x63, 0x61, 0x68, 0x60, 0x60, 0x60, 0x69, 0x67, 0x72, 0x67, 0x72, 0x5e, 0x68, 0x71, 0x63, 0x4f, 0x3c, 0x3d, 0x41, 0x3d, 0x3d, 0x3c, 0x3a, 0x37, 0x47, 0x37, 0x35, 0x09, 0xc7, 0xf4, 0xe6, 0xff, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xe9, 0xe9, 0xee, 0xf2, 0xf4, 0x0f, 0xbb, 0x01, 0x0e, 0x2c, 0x3f, 0x30, 0x41, 0x3c, 0x40, 0x4a, 0x4a, 0x3f, 0x56, 0x67, 0x68, 0x5e, 0x68, 0x5e, 0x67, 0x68, 0x67, 0x67, 0x67, 0x6a, 0x6a, 0x69, 0x60, 0x67, 0x72, 0x61, 0x72, 0x61, 0x72, 0x73, 0x75, 0x5e, 0x78, 0x48, 0x46, 0x7c, 0x8f, 0x93, 0xf8, 0xba, 0x9a, 0xe6, 0xf0, 0xee, 0xf4, 0xec, 0xbf, 0x9e, 0x99, 0x9b, 0x9c, 0x9d, 0x9e, 0x9d, 0x9c, 0x9b, 0x9b, 0x99, 0xbc, 0xd9, 0xf3, 0xf4, 0xe6, 0xef, 0xed, 0xe6, 0xf3, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf3, 0xed, 0xe6, 0xee, 0xe9, 0xee, 0xf4, 0xc6, 0x9e, 0x99, 0x9b, 0x9c, 0x9e, 0x9e, 0x9e, 0x9e, 0xbb, 0x9c, 0x99, 0x99, 0xa1, 0xcc, 0xf4, 0xf4, 0xe7, 0xe9, 0xea, 0xfb, 0xf8, 0xfb, 0x95, 0x89, 0x57, 0x32, 0x6b, 0x5e, 0x5e, 0x71, 0x63, 0x63, 0x61, 0x61, 0x68, 0x5e, 0x68, 0x5e, 0x63, 0x5e, 0x68, 0x69, 0x69, 0x60, 0x6a, 0x5e, 0x67, 0x68, 0x68, 0x68, 0x63, 0x58, 0x34, 0x3c, 0x3d, 0x41, 0x3c, 0x3c, 0x3d, 0x3d, 0x47, 0x49, 0x12, 0x22, 0xf4, 0xb9, 0xe9, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xe9, 0xee, 0xe9, 0xe6, 0xf3, 0xf4, 0xbf, 0x96, 0x02, 0x16, 0x4b, 0x3c, 0x37, 0x4c, 0x30, 0x4a, 0x38, 0x38, 0x56, 0x5e, 0x67, 0x5e, 0x60, 0x5e, 0x60, 0x68, 0x67, 0x67, 0x67, 0x67, 0x5e, 0x68, 0x68, 0x68, 0x72, 0x68, 0x67, 0x67, 0x6f, 0x5c, 0x6a, 0x60, 0x6a, 0x57, 0x2f, 0x81, 0x90, 0x91, 0xff, 0xe6, 0xf2, 0xe9, 0xef, 0xef, 0xf4, 0xdf, 0x05, 0x9c, 0x9b, 0xbb, 0xa0, 0x9e, 0xa0, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xbb, 0x9b, 0xbb, 0xbf, 0xf4, 0xf2, 0xed, 0xf2, 0xf0, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xe9, 0xf8, 0xf2, 0xe9, 0xf2, 0x9a, 0xfc, 0x9c, 0x9b, 0xbb, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xbb, 0x9c, 0xbb, 0xbb, 0x99, 0x9b, 0xc2, 0xe6, 0xf3, 0xea, 0xe6, 0xf3, 0xf8, 0xf8, 0xfb, 0x93, 0x89, 0x4e, 0x35, 0x61, 0x58, 0x56, 0x5e, 0x5e, 0x61, 0x63, 0x61, 0x5e, 0x67, 0x5e, 0x60, 0x67, 0x67, 0x67, 0x68, 0x67, 0x68, 0x67, 0x5e, 0x67, 0x68, 0x68, 0x68, 0x63, 0x43, 0x30, 0x3a, 0x3d, 0x37, 0x37, 0x3a, 0x3a, 0x37, 0x3f, 0x1c, 0x79, 0x95, 0xe9, 0xba, 0xed, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xe9, 0xee, 0xe9, 0xee, 0xf4, 0xd9, 0x99, 0x04, 0x1a, 0x5e, 0x30, 0x40, 0x37, 0x4c, 0x30, 0x3c, 0x58, 0x5e, 0x60, 0x60, 0x67, 0x67, 0x67, 0x5e, 0x67, 0x5e, 0x67, 0x5e, 0x67, 0x67, 0x72, 0x72, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x5c, 0x5c, 0x66, 0x66, 0x46, 0x5b, 0x89, 0x94, 0xee, 0xb9, 0xb9, 0xf3, 0xf0, 0xf0, 0xfb, 0xf4, 0xeb, 0xbb, 0x9c, 0xbb, 0xbb, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa0, 0x9e, 0x9c, 0x9e, 0xbb, 0x9c, 0x99, 0xab, 0xfb, 0xf3, 0xec, 0xf3, 0xec, 0xf2, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xf2, 0xef, 0xed, 0xe6, 0xf8, 0xf3, 0xbf, 0x99, 0x9b, 0xbb, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xbb, 0x9c, 0x9e, 0xbc, 0x9b, 0xbb, 0x9c, 0xbb, 0x99, 0xbd, 0xba, 0xf2, 0xe9, 0xf2, 0xf2, 0xfb, 0xfb, 0xf8, 0x93, 0x8f, 0x6e, 0x35, 0x61, 0x61, 0x60, 0x5e, 0x5e, 0x63, 0x63, 0x68, 0x60, 0x60, 0x60, 0x60, 0x67, 0x68, 0x61, 0x68, 0x61, 0x68, 0x67, 0x67, 0x68, 0x5e, 0x68, 0x63, 0x71, 0x50, 0x30, 0x37, 0x51, 0x37, 0x3a, 0x44, 0x3a, 0x3f, 0x23, 0x7e, 0x94, 0xed, 0xe8, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xee, 0xe9, 0xee, 0xf2, 0xe9, 0xfb, 0xf7, 0x05, 0x03, 0x1c, 0x56, 0x37, 0x47, 0x41, 0x3c, 0x3f, 0x4f, 0x68, 0x60, 0x5c, 0x5e, 0x60, 0x60, 0x67, 0x60, 0x68, 0x67, 0x5e, 0x67, 0x68, 0x60, 0x6b, 0x60, 0x72, 0x68, 0x68, 0x69, 0x69, 0x6a, 0x6c, 0x66, 0x46, 0x7e, 0x8f, 0x93, 0xee, 0xb9, 0xb8, 0xb9, 0xba, 0xf0, 0xfa, 0xf4, 0xd9, 0x9b, 0x9e, 0xbb, 0x9e, 0xbb, 0x9e, 0x9e, 0x9e, 0x9c, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xbb, 0x9e, 0xbb, 0xbb, 0x99, 0xc2, 0xf4, 0xed, 0xf2, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xed, 0xf2, 0xf0, 0xe6, 0xf4, 0xeb, 0x9c, 0x99, 0x9e, 0x9e, 0xbb, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xbb, 0xbb, 0xbb, 0x9c, 0x96, 0xbc, 0x99, 0xc2, 0xf4, 0xf3, 0xef, 0xee, 0xef, 0xf0, 0xf2, 0x9a, 0x93, 0x8e, 0x80, 0x31, 0x4d, 0x60, 0x5e, 0x5e, 0x68, 0x73, 0x61, 0x61, 0x68, 0x67, 0x60, 0x60, 0x67, 0x61, 0x73, 0x61, 0x68, 0x5e, 0x67, 0x67, 0x67, 0x5e, 0x68, 0x73, 0x63, 0x43, 0x30, 0x51, 0x47, 0x3a, 0x3a, 0x3a, 0x30, 0x21, 0x84, 0x94, 0xed, 0xe8, 0xe9, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xe9, 0xee, 0xe6, 0xf2, 0xee, 0xf4, 0xfc, 0x01, 0x18, 0x4d, 0x40, 0x37, 0x41, 0x30, 0x56, 0x61, 0x68, 0x5c, 0x5c, 0x60, 0x60, 0x67, 0x60, 0x60, 0x67, 0x67, 0x67, 0x68, 0x67, 0x60, 0x6b, 0x60, 0x69, 0x5e, 0x69, 0x69, 0x6a, 0x5a, 0x57, 0x6e, 0x84, 0x92, 0x92, 0xf8, 0x9a, 0xb8, 0xb8, 0xba, 0xe8, 0xf0, 0xfb, 0xe0, 0xbc, 0x99, 0x9e, 0xbc, 0xbb, 0x9e, 0x9e, 0xbb, 0x9e, 0x9e, 0x9e, 0x9e, 0xbb, 0x9c, 0xbb, 0x9e, 0x9e, 0xbb, 0x9c, 0x9c, 0x9c, 0xdd, 0xf4, 0xe6, 0xef, 0xf2, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xef, 0xed, 0xed, 0xf3, 0xe6, 0x9e, 0x99, 0xbc, 0x9e, 0x9c, 0x9e, 0x9e, 0x9e, 0x9e, 0xbc, 0xbc, 0xbc, 0xbb, 0xbb, 0xbb, 0x9c, 0xbb, 0xbb, 0xbb, 0x99, 0x99, 0xd9, 0xf4, 0xe6, 0xf2, 0xe9, 0xef, 0xe9, 0xe9, 0xef, 0x94, 0x92, 0x82, 0x57, 0x3e, 0x60, 0x61, 0x69, 0x63, 0x73, 0x73, 0x61, 0x5e, 0x67, 0x5e, 0x67, 0x61, 0x61, 0x73, 0x61, 0x69, 0x60, 0x67, 0x5e, 0x67, 0x68, 0x5e, 0x63, 0x63, 0x3f, 0x51, 0x38, 0x3d, 0x3a, 0x3a, 0x2d, 0x21, 0x8a, 0xff, 0xf3, 0xea, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xe9, 0xee, 0xe9, 0xee, 0xf2, 0xe6, 0xfb, 0xec, 0x02, 0x0e, 0x3e, 0x34, 0x30, 0x43, 0x56, 0x63, 0x68, 0x61, 0x5c, 0x5c, 0x60, 0x60, 0x60, 0x5e, 0x60, 0x67, 0x60, 0x67, 0x67, 0x60, 0x67, 0x60, 0x69, 0x69, 0x69, 0x6a, 0x6c, 0x57, 0x5b, 0x80, 0x8e, 0x93, 0xfa, 0xf0, 0xf0, 0xed, 0xe8, 0xf2, 0xe9, 0xed, 0xf2, 0xf3, 0xbd, 0x99, 0x9e, 0x9c, 0x9e, 0xbb, 0x9c, 0xbb, 0x9e, 0xbb, 0x9c, 0x99, 0x99, 0x9c, 0x9c, 0x9b, 0x99, 0x9e, 0xbb, 0xbb, 0x9c, 0x99, 0xf6, 0xf3, 0xee, 0xf2, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xe6, 0xf2, 0xf0, 0xc6, 0x99, 0xbc, 0x9c, 0xbc, 0x9c, 0x9c, 0x9b, 0x99, 0x9c, 0x99, 0xbb, 0xbc, 0x9c, 0x99, 0xbb, 0xbb, 0x98, 0xbb, 0xbb, 0xbb, 0x99, 0xf5, 0xec, 0xf2, 0xef, 0xe9, 0xe9, 0xe8, 0xea, 0xba, 0xef, 0xff, 0x92, 0x8a, 0x74, 0x48, 0x48, 0x4d, 0x72, 0x5f, 0x63, 0x63, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x5e, 0x67, 0x5e, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x63, 0x73, 0x38, 0x40, 0x3d, 0x30, 0x34, 0x23, 0x7e, 0x91, 0x9a, 0xe8, 0xed, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xef, 0xef, 0xe9, 0xe9, 0xe9, 0xe6, 0xf8, 0xf2, 0x95, 0x1e, 0x07, 0x26, 0x35, 0x30, 0x49, 0x5e, 0x5e, 0x61, 0x60, 0x5c, 0x60, 0x60, 0x5e, 0x60, 0x67, 0x60, 0x69, 0x60, 0x60, 0x60, 0x69, 0x75, 0x63, 0x56, 0x67, 0x6a, 0x45, 0x52, 0x77, 0x8a, 0x92, 0x93, 0xf0, 0xb9, 0xed, 0xed, 0xf9, 0xf9, 0xf9, 0xf8, 0xf2, 0xf3, 0xdd, 0x99, 0x9c, 0x9e, 0x9b, 0x9c, 0x9e, 0x9c, 0xbb, 0xbb, 0x99, 0x9b, 0x9c, 0xf6, 0xcc, 0xcc, 0xc2, 0xa6, 0x9b, 0x99, 0x9e, 0x9e, 0x9c, 0x99, 0x7d, 0xf3, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf3, 0xf7, 0x05, 0x9e, 0xbb, 0xbc, 0x99, 0x99, 0xa1, 0xfc, 0xc7, 0xce, 0xcc, 0xbf, 0x9e, 0x99, 0x96, 0x99, 0xbb, 0xbb, 0x96, 0xbb, 0x96, 0xbc, 0x99, 0xcc, 0xf4, 0xee, 0xf2, 0xea, 0xe9, 0xe8, 0xea, 0xef, 0xf0, 0xff, 0x94, 0x90, 0x86, 0x6e, 0x48, 0x4d, 0x60, 0x68, 0x72, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x60, 0x68, 0x69, 0x5e, 0x67, 0x5e, 0x67, 0x68, 0x68, 0x68, 0x63, 0x68, 0x5f, 0x30, 0x30, 0x42, 0x28, 0x52, 0x8f, 0x9a, 0xb8, 0xb8, 0xfb, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xef, 0xef, 0xe9, 0xee, 0xf2, 0xe6, 0xee, 0xec, 0xff, 0xfb, 0x19, 0x12, 0x45, 0x67, 0x6a, 0x4b, 0x60, 0x61, 0x68, 0x60, 0x60, 0x67, 0x5e, 0x60, 0x5e, 0x60, 0x67, 0x6a, 0x60, 0x5c, 0x60, 0x60, 0x72, 0x6f, 0x5a, 0x4e, 0x77, 0x87, 0x92, 0x95, 0xed, 0xe7, 0xb8, 0xe8, 0xe9, 0xed, 0xf9, 0xf9, 0xf9, 0xf9, 0xf2, 0xe6, 0xbd, 0x99, 0x9e, 0x9c, 0x9e, 0x9c, 0x9b, 0x9e, 0x9c, 0x99, 0x99, 0x99, 0x99, 0xdd, 0xf4, 0xf4, 0xf4, 0xf4, 0xdd, 0xa6, 0x9b, 0xbb, 0x9e, 0x99, 0xbf, 0xf4, 0xed, 0xf2, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf3, 0xd9, 0x9c, 0xa1, 0xbb, 0x9e, 0xa0, 0xeb, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf2, 0x0a, 0x99, 0x96, 0x99, 0xbb, 0x99, 0x9b, 0xbc, 0x99, 0x9c, 0x99, 0xf5, 0xf4, 0xe6, 0xf2, 0xe9, 0xea, 0xb9, 0xef, 0xfa, 0xf1, 0xef, 0xb9, 0x9a, 0x94, 0x8f, 0x82, 0x6e, 0x57, 0x45, 0x5a, 0x5c, 0x69, 0x5e, 0x5e, 0x5e, 0x60, 0x69, 0x5e, 0x68, 0x5e, 0x68, 0x60, 0x68, 0x60, 0x72, 0x61, 0x72, 0x63, 0x68, 0x67, 0x2c, 0x21, 0x6e, 0x8c, 0xff, 0x9a, 0xb8, 0xba, 0xf8, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xe9, 0xf0, 0xba, 0xef, 0xe9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0x36, 0x5b, 0x5a, 0x5c, 0x3e, 0x60, 0x56, 0x68, 0x5e, 0x69, 0x61, 0x67, 0x5e, 0x67, 0x67, 0x60, 0x60, 0x6a, 0x6a, 0x5c, 0x5c, 0x31, 0x46, 0x64, 0x86, 0x90, 0x94, 0xff, 0xe6, 0xb9, 0xba, 0xba, 0xb9, 0xe9, 0xed, 0xf1, 0xf9, 0xf8, 0xf8, 0xf4, 0xe2, 0xa1, 0x9b, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x99, 0x99, 0x96, 0x99, 0xbc, 0xe2, 0xf3, 0xee, 0xf2, 0xf2, 0xf4, 0xec, 0xab, 0x99, 0x9e, 0x96, 0xa6, 0xf3, 0xf3, 0xe6, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xf4, 0xbf, 0xbb, 0xbb, 0xa0, 0x99, 0xcc, 0xf4, 0xe6, 0xec, 0xe9, 0xf3, 0xec, 0xf4, 0xdf, 0xa1, 0x99, 0x99, 0x99, 0x96, 0xbb, 0x9c, 0x9c, 0x96, 0x99, 0x96, 0xec, 0xf3, 0xf1, 0xe8, 0xf2, 0xba, 0xef, 0xf0, 0xf0, 0xea, 0xe8, 0xba, 0xe6, 0x94, 0x92, 0x8e, 0x81, 0x5b, 0x2f, 0x48, 0x3e, 0x60, 0x5e, 0x5e, 0x67, 0x60, 0x5e, 0x5e, 0x63, 0x60, 0x61, 0x67, 0x61, 0x68, 0x68, 0x61, 0x68, 0x72, 0x45, 0x2f, 0x77, 0x8f, 0x93, 0xfa, 0xde, 0xe2, 0xf4, 0x95, 0xee, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xef, 0xef, 0xe9, 0xf2, 0xf3, 0xc6, 0xf5, 0x0f, 0xeb, 0xfd, 0xf4, 0x92, 0x8c, 0x6e, 0x31, 0x5a, 0x5c, 0x68, 0x63, 0x5e, 0x5e, 0x68, 0x61, 0x68, 0x5e, 0x60, 0x6a, 0x5c, 0x5a, 0x5c, 0x45, 0x52, 0x81, 0x8e, 0x92, 0x94, 0x91, 0xe6, 0xf2, 0xe9, 0xb9, 0xba, 0xe9, 0xed, 0xed, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xf3, 0xdd, 0x99, 0x9b, 0x9e, 0x9e, 0x9b, 0x9c, 0x9c, 0x9e, 0x9e, 0x99, 0x99, 0xf5, 0xe2, 0xf4, 0xe6, 0xee, 0x9a, 0xf2, 0xe9, 0xf4, 0xf3, 0xf5, 0x99, 0x96, 0xa1, 0xec, 0xf2, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf3, 0xf6, 0x96, 0xa0, 0x96, 0xab, 0xf4, 0x9a, 0xf2, 0xf3, 0xf2, 0xf2, 0xef, 0xf2, 0xf4, 0xdf, 0x0a, 0x99, 0x97, 0x9b, 0x9b, 0x9b, 0x9c, 0xbb, 0x96, 0x99, 0x6d, 0xf3, 0xf2, 0xf2, 0xf8, 0xee, 0xee, 0xe9, 0xea, 0xea, 0xe8, 0xed, 0xf2, 0xe6, 0xb8, 0xfb, 0x92, 0x8f, 0x86, 0x7b, 0x48, 0x3e, 0x4d, 0x60, 0x60, 0x60, 0x61, 0x5e, 0x61, 0x5e, 0x68, 0x61, 0x68, 0x72, 0x61, 0x72, 0x68, 0x32, 0x6e, 0x87, 0x93, 0x94, 0x6d, 0xf5, 0x99, 0x9e, 0xc7, 0xf4, 0xf0, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xe9, 0xe6, 0xf0, 0xfe, 0xfb, 0xe9, 0xbd, 0x9b, 0x99, 0x97, 0x03, 0x14, 0x81, 0x92, 0x90, 0x8d, 0x81, 0x36, 0x31, 0x48, 0x69, 0x5e, 0x5e, 0x63, 0x61, 0x60, 0x60, 0x5a, 0x57, 0x2f, 0x4e, 0x77, 0x86, 0x8d, 0x91, 0xff, 0xff, 0xf8, 0xf0, 0xef, 0xef, 0xe9, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xed, 0xe9, 0xef, 0xe6, 0xf4, 0xce, 0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0xbb, 0x9b, 0x99, 0xfc, 0xd9, 0xdd, 0xe6, 0xf4, 0xf0, 0xf2, 0xfb, 0xef, 0xf2, 0xee, 0xf2, 0xf4, 0xd9, 0xbb, 0x99, 0xa1, 0xe2, 0xf3, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xf2, 0xf3, 0xbd, 0x99, 0xa1, 0x99, 0xd9, 0xf4, 0x9a, 0xf2, 0xf2, 0xf0, 0xf3, 0xf2, 0xf0, 0xf2, 0xf4, 0xf2, 0xdf, 0xc2, 0x99, 0x9c, 0x9c, 0x9c, 0x96, 0x9c, 0x99, 0xce, 0xf4, 0xf0, 0xf2, 0xed, 0xee, 0xef, 0xe9, 0xed, 0xe9, 0xf1, 0xed, 0xed, 0xe9, 0xba, 0xee, 0xee, 0xff, 0x93, 0x90, 0x8a, 0x7e, 0x64, 0x2f, 0x31, 0x46, 0x5a, 0x4b, 0x60, 0x60, 0x68, 0x60, 0x61, 0x60, 0x5a, 0x31, 0x4e, 0x82, 0x8e, 0x90, 0x94, 0x22, 0x03, 0x97, 0x96, 0xbb, 0x99, 0xc2, 0xf4, 0xe9, 0xfb, 0xf8, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xed, 0xf1, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xe9, 0xba, 0xfb, 0xfe, 0xf1, 0xbf, 0x9b, 0x98, 0x02, 0x24, 0x6e, 0x45, 0x24, 0x4e, 0x87, 0x90, 0x91, 0x8d, 0x79, 0x52, 0x2f, 0x31, 0x45, 0x45, 0x45, 0x46, 0x57, 0x64, 0x7e, 0x85, 0x8f, 0x93, 0x91, 0xff, 0xe9, 0xef, 0xed, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xf0, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xf3, 0xce, 0x99, 0xbb, 0x9c, 0xbb, 0x9c, 0x9c, 0x9c, 0x99, 0xce, 0xf4, 0xf4, 0xf4, 0xef, 0xf2, 0xf2, 0xef, 0xf2, 0xee, 0xf2, 0xee, 0xf4, 0xf7, 0xa3, 0x99, 0xbc, 0xf7, 0xf2, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf2, 0xe6, 0xf2, 0xa6, 0xbb, 0xbc, 0xbc, 0xf7, 0xf4, 0x9a, 0xf2, 0xf2, 0xf3, 0xf2, 0xfb, 0xf3, 0xf2, 0xfb, 0xf3, 0xf4, 0xdd, 0x99, 0x96, 0x9c, 0x96, 0x9c, 0x96, 0x99, 0xcc, 0xf4, 0xe9, 0xef, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xe9, 0xba, 0xba, 0xee, 0xf0, 0xff, 0x94, 0x90, 0x8e, 0x86, 0x7c, 0x77, 0x6e, 0x52, 0x46, 0x45, 0x57, 0x57, 0x52, 0x77, 0x84, 0x89, 0x90, 0x92, 0x86, 0x36, 0x2f, 0x5b, 0x1d, 0x0b, 0x96, 0xbc, 0x99, 0xdd, 0xf4, 0xf1, 0xf9, 0xf8, 0xf0, 0xe6, 0xba, 0xef, 0xed, 0xf1, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xb9, 0xf8, 0xf3, 0x6d, 0x9e, 0x96, 0x06, 0x27, 0x76, 0x3e, 0x60, 0x5e, 0x3e, 0x32, 0x74, 0x88, 0x8f, 0x8f, 0x8f, 0x8a, 0x87, 0x89, 0x87, 0x87, 0x8a, 0x8d, 0x92, 0x93, 0x93, 0xff, 0xf8, 0xee, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xef, 0xef, 0xed, 0xf3, 0xd9, 0x99, 0x9c, 0xbb, 0x9c, 0x9c, 0x9c, 0x9c, 0x96, 0xdb, 0xf4, 0xf2, 0xee, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xee, 0xf4, 0xee, 0x9a, 0xf3, 0x0f, 0x99, 0xa1, 0xf7, 0xf2, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xe9, 0xf4, 0xbd, 0xbc, 0x9e, 0xbc, 0xf2, 0xf3, 0xf2, 0x9a, 0xfb, 0xf2, 0xfb, 0xf2, 0xf0, 0xf3, 0xf2, 0xe6, 0xf4, 0xf7, 0x99, 0x99, 0x9c, 0x96, 0x9c, 0x96, 0x99, 0xce, 0xf4, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xf1, 0xed, 0xed, 0xee, 0xff, 0xff, 0x91, 0x92, 0x92, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8e, 0x8f, 0x8f, 0x92, 0x92, 0x8c, 0x77, 0x45, 0x3e, 0x58, 0x5f, 0x75, 0x76, 0x13, 0x00, 0x99, 0xbd, 0xf3, 0xef, 0xf2, 0xf1, 0xee, 0xee, 0xba, 0xf8, 0xf1, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf2, 0xe6, 0xf2, 0xf2, 0x0a, 0x99, 0x00, 0x1d, 0x6f, 0x33, 0x4f, 0x62, 0x3c, 0x62, 0x5f, 0x2d, 0x5a, 0x82, 0x90, 0x92, 0xff, 0x94, 0xf8, 0x95, 0xf3, 0x95, 0x95, 0xee, 0xee, 0xee, 0xba, 0xea, 0xb8, 0xe9, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf3, 0xf3, 0xdd, 0x99, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0x96, 0xdd, 0xf4, 0xee, 0xf4, 0xef, 0xf2, 0xef, 0xf0, 0xf2, 0xef, 0xf2, 0xf3, 0xef, 0xf4, 0xbf, 0x99, 0xa3, 0xee, 0xf3, 0xf0, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0x9a, 0xf4, 0xfc, 0x9c, 0xbc, 0xa0, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xef, 0xf4, 0xee, 0xf4, 0xf7, 0x99, 0x96, 0x9c, 0x96, 0x9c, 0x99, 0x99, 0xd9, 0xf4, 0xf0, 0xe6, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xed, 0xe9, 0xf0, 0xfb, 0xfa, 0xff, 0x9a, 0x9a, 0x95, 0x95, 0xff, 0x95, 0x9a, 0xee, 0x95, 0x90, 0x87, 0x2f, 0x45, 0x35, 0x70, 0x54, 0x54, 0x51, 0x58, 0x7a, 0x10, 0x96, 0x98, 0xe0, 0xf3, 0xf1, 0xed, 0xee, 0xee, 0xee, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe6, 0xf4, 0xdd, 0x9c, 0x97, 0x0d, 0x6c, 0x30, 0x70, 0x54, 0x62, 0x53, 0x53, 0x5f, 0x5f, 0x4d, 0x26, 0x7c, 0x8f, 0x91, 0xf8, 0xea, 0xb9, 0xb8, 0xba, 0xba, 0xed, 0xe9, 0xed, 0xed, 0xed, 0xf2, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xed, 0xed, 0xef, 0xf3, 0xe2, 0xa0, 0x99, 0x9c, 0x9b, 0x9c, 0x9c, 0x99, 0x99, 0xce, 0xf4, 0x9a, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xee, 0xf2, 0x9a, 0xf4, 0xf3, 0x0f, 0x99, 0xfc, 0xf4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xee, 0xf4, 0xcc, 0xbb, 0xa1, 0xbc, 0xe2, 0xf4, 0x9a, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xf2, 0xf0, 0xf2, 0xfb, 0xf4, 0x7d, 0x99, 0x99, 0x9c, 0x96, 0x9c, 0x99, 0x96, 0xf7, 0xf2, 0xed, 0xef, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf8, 0xf9, 0xf8, 0xed, 0xea, 0xe9, 0xea, 0xba, 0xe7, 0xe7, 0xe9, 0xb9, 0xb9, 0xef, 0xf2, 0xf2, 0xea, 0xba, 0xff, 0x92, 0x7e, 0x29, 0x4b, 0x49, 0x62, 0x40, 0x54, 0x54, 0x5d, 0x4f, 0x4b, 0x52, 0x09, 0x99, 0xeb, 0xf4, 0xe9, 0xe8, 0xe6, 0xe9, 0xee, 0xee, 0xf0, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xf0, 0xf4, 0xeb, 0x99, 0x02, 0x20, 0x42, 0x70, 0x40, 0x5d, 0x4c, 0x55, 0x55, 0x55, 0x62, 0x55, 0x5e, 0x2c, 0x7c, 0x92, 0xf8, 0xea, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf8, 0xf1, 0xfb, 0xf9, 0xf8, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf2, 0xe9, 0xf5, 0x9b, 0x9c, 0xbb, 0x9b, 0x9c, 0x9b, 0x99, 0xc6, 0xf4, 0xf3, 0xee, 0xf2, 0xf0, 0xf2, 0xef, 0xf3, 0xf3, 0xf3, 0xec, 0xf4, 0xee, 0xf5, 0x99, 0xcc, 0xf4, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xe9, 0xf4, 0xdf, 0xbc, 0xa1, 0x9c, 0xdd, 0xf4, 0xf2, 0xee, 0xf2, 0xf2, 0xf2, 0xf0, 0xee, 0xf3, 0xf2, 0x9a, 0xf4, 0xcc, 0x99, 0x9b, 0x96, 0x9c, 0x9c, 0x99, 0xa1, 0xf4, 0xef, 0xe6, 0xf2, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xfa, 0xef, 0xef, 0xe8, 0xb9, 0xe7, 0xba, 0xea, 0xba, 0xea, 0xe9, 0xed, 0xf1, 0xf9, 0xf1, 0xf2, 0xf0, 0x93, 0x7e, 0x29, 0x4d, 0x5f, 0x4a, 0x53, 0x62, 0x53, 0x53, 0x62, 0x42, 0x49, 0x5c, 0x1c, 0x99, 0xfc, 0xf4, 0xe8, 0xba, 0xe9, 0xee, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xee, 0xff, 0x9a, 0xab, 0x99, 0x07, 0x45, 0x4f, 0x54, 0x54, 0x4c, 0x4f, 0x53, 0x58, 0x49, 0x56, 0x55, 0x53, 0x58, 0x32, 0x8c, 0x94, 0xed, 0xfa, 0xf0, 0xf8, 0xfa, 0xfa, 0xf0, 0xff, 0xf8, 0xfa, 0xfa, 0xf8, 0xef, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xef, 0xed, 0xef, 0xe6, 0xf3, 0xc6, 0x99, 0x9b, 0x9e, 0x9b, 0xbb, 0x9b, 0x99, 0xa6, 0xee, 0xf4, 0xf3, 0xf3, 0xef, 0xf3, 0xf2, 0xee, 0xe6, 0xf3, 0xee, 0xf4, 0xd9, 0x99, 0x05, 0xec, 0xf2, 0xf3, 0xef, 0xf2, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xf2, 0xee, 0xf3, 0xfc, 0x9c, 0xbb, 0xfc, 0xf4, 0xe9, 0xf3, 0xf2, 0xef, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xf4, 0xee, 0xf5, 0x99, 0xbb, 0x96, 0xbb, 0x96, 0x99, 0xbf, 0xf4, 0xee, 0xed, 0xf2, 0xe6, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xba, 0xee, 0xba, 0xe9, 0xe9, 0xe9, 0xed, 0xf0, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0x92, 0x87, 0x26, 0x49, 0x51, 0x54, 0x54, 0x59, 0x50, 0x55, 0x43, 0x50, 0x4f, 0x42, 0x58, 0x5c, 0x03, 0x0a, 0xf4, 0xb9, 0xea, 0xe7, 0xef, 0xee, 0xf0, 0xe9, 0xed, 0xe9, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xf0, 0x95, 0xe6, 0x0a, 0x99, 0x0e, 0x6a, 0x50, 0x47, 0x4c, 0x50, 0x4f, 0x59, 0x4f, 0x56, 0x44, 0x62, 0x54, 0x5f, 0x2e, 0x7e, 0x94, 0xe6, 0xfa, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xe9, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xe9, 0xf2, 0xe0, 0x9b, 0x9b, 0x9c, 0x9c, 0x9b, 0x9e, 0x99, 0x9c, 0xce, 0xf4, 0xf3, 0xef, 0xf2, 0xf2, 0xf0, 0xf2, 0xee, 0xf2, 0xf2, 0xf4, 0xf6, 0x99, 0xc7, 0xf3, 0xf2, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xed, 0x9a, 0xf4, 0xdf, 0x99, 0xbc, 0xa0, 0xe2, 0xf4, 0xee, 0xf2, 0xf2, 0xe9, 0xee, 0xf2, 0xe6, 0xf3, 0xf4, 0xc6, 0xbb, 0x99, 0x9c, 0x96, 0xbb, 0x9b, 0x98, 0xdd, 0xf4, 0xef, 0xed, 0xef, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xba, 0xee, 0xba, 0xba, 0xee, 0xba, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xff, 0xfa, 0xf0, 0xf0, 0xfa, 0x93, 0x8f, 0x5b, 0x2a, 0x4f, 0x51, 0x54, 0x54, 0x5d, 0x59, 0x53, 0x59, 0x4a, 0x59, 0x4f, 0x4f, 0x60, 0x0b, 0x0c, 0xf4, 0xe7, 0xe8, 0xba, 0xf0, 0xf8, 0xee, 0xe9, 0xe9, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xf2, 0xef, 0xf0, 0xec, 0xa3, 0x00, 0x16, 0x75, 0x3c, 0x53, 0x43, 0x55, 0x59, 0x51, 0x59, 0x58, 0x55, 0x53, 0x5d, 0x54, 0x4d, 0x2f, 0x92, 0xf8, 0xf0, 0xe6, 0xe9, 0xb9, 0xba, 0xb9, 0xba, 0xb9, 0xba, 0xba, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xed, 0xef, 0xed, 0xe9, 0xef, 0xf4, 0x0f, 0x9b, 0x9b, 0x9c, 0x9c, 0x9b, 0xbb, 0x9b, 0xbb, 0xdd, 0xf4, 0xf4, 0xf2, 0xee, 0xf2, 0xee, 0xef, 0xf3, 0xf4, 0xeb, 0x99, 0xa3, 0xee, 0xf3, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf3, 0xee, 0xe6, 0xf4, 0xc2, 0x9c, 0xbb, 0xa6, 0xf7, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xee, 0xf4, 0xce, 0x9b, 0x99, 0xbc, 0x96, 0xbb, 0x96, 0x99, 0xf6, 0xf4, 0xe6, 0xf2, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xba, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xef, 0xf8, 0xfa, 0xef, 0xba, 0xb9, 0xee, 0x93, 0x84, 0x26, 0x49, 0x4c, 0x5d, 0x54, 0x59, 0x51, 0x53, 0x51, 0x54, 0x54, 0x51, 0x59, 0x4f, 0x5e, 0x10, 0x08, 0xf4, 0xba, 0xe7, 0xe9, 0xef, 0xff, 0xef, 0xe9, 0xe7, 0xef, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xf2, 0xf3, 0xec, 0xa3, 0x01, 0x21, 0x63, 0x4a, 0x4c, 0x50, 0x4f, 0x59, 0x53, 0x4f, 0x50, 0x50, 0x53, 0x5d, 0x3c, 0x69, 0x24, 0x89, 0x93, 0xee, 0xba, 0xba, 0xb9, 0xba, 0xb9, 0xba, 0xe9, 0xee, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xed, 0xf2, 0xe6, 0xef, 0xe9, 0xf2, 0xe3, 0xa1, 0x9b, 0x9c, 0x9b, 0x9c, 0xbb, 0xbb, 0xbb, 0xbc, 0xc6, 0xec, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xec, 0xbf, 0x99, 0xbb, 0xdd, 0xf4, 0xe6, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf2, 0xe6, 0xe9, 0xf2, 0xf3, 0xec, 0xa6, 0xbc, 0x9c, 0xa3, 0xcc, 0xec, 0xf2, 0xf3, 0xf3, 0xf2, 0xe2, 0xbf, 0x96, 0x9e, 0xbb, 0x9c, 0x9c, 0x98, 0x99, 0xbc, 0xdf, 0xf4, 0xee, 0xf2, 0xee, 0xf0, 0xe6, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xe9, 0xee, 0xef, 0xef, 0xef, 0xed, 0xed, 0xe9, 0xed, 0xea, 0xfa, 0xf1, 0xba, 0xb9, 0xee, 0x92, 0x52, 0x2a, 0x58, 0x3c, 0x53, 0x4c, 0x4c, 0x50, 0x4f, 0x53, 0x51, 0x51, 0x51, 0x4c, 0x3f, 0x5e, 0x14, 0x0d, 0xf4, 0xe9, 0xe7, 0xe9, 0xf8, 0xfa, 0xee, 0xe8, 0xba, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xef, 0xe9, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xf0, 0xe9, 0xf2, 0xe5, 0xf5, 0x04, 0x32, 0x4f, 0x4a, 0x4c, 0x4f, 0x59, 0x59, 0x43, 0x50, 0x50, 0x53, 0x53, 0x53, 0x62, 0x4d, 0x29, 0x88, 0x90, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xed, 0xed, 0xf0, 0xfa, 0xfa, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xf2, 0xe6, 0xf3, 0xce, 0x99, 0x9e, 0x9b, 0x9e, 0x9e, 0xa0, 0x9c, 0xbb, 0x99, 0x05, 0xbf, 0xcc, 0xd9, 0xce, 0xbf, 0xa3, 0x99, 0x99, 0xcc, 0xf4, 0xee, 0xef, 0xf3, 0xe6, 0xef, 0xed, 0xef, 0xef, 0xef, 0xe9, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0x9a, 0xe6, 0xf2, 0xf4, 0xdf, 0x9c, 0xbb, 0x9c, 0xbb, 0xa1, 0xf6, 0xbf, 0xfc, 0xbd, 0x9e, 0x99, 0xbc, 0x9e, 0x9e, 0xbb, 0xbb, 0x9c, 0x99, 0xc6, 0xf4, 0xee, 0xef, 0xe6, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf0, 0xe9, 0xea, 0xea, 0xe8, 0xe7, 0xf9, 0xf1, 0xba, 0xb8, 0xff, 0x8f, 0x45, 0x2d, 0x38, 0x5d, 0x50, 0x50, 0x44, 0x43, 0x44, 0x43, 0x43, 0x50, 0x4c, 0x50, 0x43, 0x5e, 0x17, 0x14, 0xf3, 0xee, 0xea, 0xe9, 0xfa, 0xf8, 0xef, 0xba, 0xe7, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xef, 0xf8, 0xfa, 0xf0, 0xe6, 0xba, 0xea, 0xf0, 0xf1, 0xf8, 0xe8, 0xb8, 0xe9, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xea, 0xff, 0xf6, 0x04, 0x32, 0x3f, 0x4c, 0x4c, 0x4c, 0x59, 0x59, 0x44, 0x59, 0x54, 0x54, 0x50, 0x43, 0x4f, 0x5f, 0x2a, 0x7e, 0x93, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xe6, 0xf3, 0xc2, 0x9b, 0x9e, 0x9e, 0x9e, 0x9c, 0x9d, 0xa0, 0x9e, 0x9b, 0x99, 0x99, 0x9b, 0x9b, 0xbb, 0x9b, 0xa1, 0xc7, 0xf4, 0xed, 0xe9, 0xf3, 0xe6, 0xea, 0xed, 0xf0, 0xef, 0xf8, 0xba, 0xba, 0xba, 0xf0, 0xef, 0xed, 0xed, 0xf2, 0xee, 0xe9, 0xe9, 0xee, 0xba, 0xed, 0xe9, 0xef, 0xe9, 0xed, 0xe9, 0xe6, 0xba, 0xee, 0xba, 0xee, 0xf9, 0xf9, 0xfb, 0xf0, 0x9a, 0xfb, 0xf4, 0xd9, 0xf5, 0xbc, 0x9e, 0xa0, 0x9e, 0x9d, 0x9b, 0x9e, 0xbc, 0xa1, 0xbc, 0x98, 0xbc, 0xbc, 0xbc, 0x99, 0xc2, 0xf4, 0xee, 0xee, 0xed, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xef, 0xe9, 0xed, 0xfb, 0xf0, 0xed, 0xea, 0x93, 0x87, 0x31, 0x39, 0x50, 0x4f, 0x4f, 0x4c, 0x4c, 0x4c, 0x47, 0x53, 0x4a, 0x50, 0x43, 0x50, 0x43, 0x55, 0x16, 0x1f, 0xf4, 0xb9, 0xea, 0xed, 0xf0, 0xef, 0xed, 0xe9, 0xef, 0xf1, 0xed, 0xb9, 0xb8, 0xb9, 0xe6, 0xfb, 0xe6, 0xf0, 0xea, 0xe7, 0xba, 0xe9, 0xee, 0xf0, 0xef, 0xee, 0xe9, 0xe9, 0xef, 0xed, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xfa, 0xf0, 0xee, 0xf3, 0xe5, 0xba, 0xe6, 0xf0, 0xef, 0xe5, 0xe6, 0xea, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xf2, 0xf3, 0x15, 0x04, 0x3e, 0x42, 0x4c, 0x43, 0x43, 0x59, 0x4f, 0x42, 0x5d, 0x51, 0x54, 0x44, 0x56, 0x53, 0x5f, 0x2a, 0x81, 0x93, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xf3, 0xe6, 0xed, 0xc2, 0x99, 0x9b, 0x9e, 0x9e, 0xa0, 0x9d, 0x9e, 0xa0, 0xa0, 0xa0, 0xbc, 0xbc, 0x9e, 0xa1, 0xdd, 0xf3, 0xef, 0xf2, 0xfb, 0xed, 0xef, 0xe6, 0xed, 0xf0, 0xfa, 0xfb, 0xfb, 0x9a, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xba, 0x9a, 0xf0, 0x95, 0xfd, 0xe2, 0xeb, 0xa1, 0xa0, 0xa0, 0xa1, 0xa1, 0xa0, 0xa0, 0x9e, 0xbc, 0xa0, 0xa1, 0x9c, 0x99, 0xc2, 0xed, 0xf3, 0xec, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xfb, 0xe8, 0xf1, 0x93, 0x86, 0x26, 0x44, 0x50, 0x4a, 0x4f, 0x4f, 0x4c, 0x53, 0x47, 0x4c, 0x4c, 0x43, 0x43, 0x43, 0x4c, 0x56, 0x1a, 0x64, 0xf3, 0xba, 0xb8, 0xed, 0xf0, 0xed, 0xe9, 0xe9, 0xed, 0xfa, 0xed, 0xba, 0xb9, 0xba, 0xee, 0xec, 0xfb, 0xed, 0x9a, 0xea, 0xb9, 0xed, 0xef, 0xf0, 0xee, 0xee, 0xba, 0xe9, 0xe9, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xef, 0xf8, 0xf0, 0xe5, 0xe5, 0xf4, 0xf0, 0xf4, 0xe6, 0xe9, 0xf1, 0xf9, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xe9, 0xb9, 0xf4, 0x25, 0x04, 0x45, 0x43, 0x3a, 0x43, 0x43, 0x4f, 0x4f, 0x58, 0x53, 0x59, 0x50, 0x44, 0x44, 0x59, 0x59, 0x2a, 0x81, 0xff, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xef, 0xf8, 0xef, 0xf4, 0xf2, 0xcc, 0xa1, 0x9c, 0x9d, 0x9e, 0x9e, 0xa0, 0x9e, 0x9e, 0x9e, 0x9e, 0xa1, 0x9e, 0x05, 0xf7, 0xf4, 0xf8, 0xf7, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xfb, 0xe6, 0xec, 0xf7, 0xdf, 0xdd, 0xce, 0xeb, 0xc7, 0xbf, 0xbf, 0x0f, 0x0f, 0x0f, 0xf6, 0xf6, 0x0f, 0xfc, 0xbf, 0xbf, 0xc6, 0xc7, 0xce, 0xdb, 0xdf, 0xe0, 0xf7, 0xee, 0xf4, 0xf4, 0xf4, 0xf3, 0xc2, 0xed, 0xe8, 0xa6, 0xa0, 0xa0, 0xa0, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1, 0x9c, 0x9d, 0xf5, 0xce, 0xf4, 0xf2, 0xe6, 0xf3, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xf8, 0xf0, 0xea, 0xf2, 0x94, 0x84, 0x2a, 0x50, 0x53, 0x40, 0x4f, 0x4f, 0x43, 0x4c, 0x4c, 0x4c, 0x43, 0x43, 0x43, 0x3c, 0x50, 0x4f, 0x1a, 0x85, 0xff, 0xba, 0xe8, 0xf1, 0xf8, 0xee, 0xe9, 0xed, 0xef, 0xed, 0xf0, 0xed, 0xf0, 0xf8, 0xf0, 0xee, 0xee, 0x9a, 0xe5, 0x9a, 0xe9, 0xee, 0xf0, 0xee, 0xef, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xf0, 0xf8, 0xf3, 0xb9, 0xfe, 0x15, 0x7d, 0xf4, 0xb8, 0xf1, 0xfe, 0xfa, 0xe9, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xb8, 0xf4, 0x7d, 0x06, 0x2c, 0x56, 0x4c, 0x3a, 0x44, 0x50, 0x3f, 0x55, 0x4a, 0x4f, 0x43, 0x49, 0x50, 0x5d, 0x51, 0x26, 0x85, 0xff, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xef, 0xed, 0xf2, 0xe6, 0xf2, 0xf3, 0xdf, 0xab, 0xbc, 0x9b, 0x9e, 0x9b, 0x9d, 0x9d, 0x9d, 0x9b, 0x9d, 0x9e, 0x99, 0xc7, 0xf4, 0xf7, 0xf6, 0x0f, 0xc2, 0xc2, 0xc6, 0xc2, 0xbf, 0xfc, 0xbd, 0xa6, 0x05, 0xa1, 0xbc, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x9b, 0x9c, 0xa1, 0x05, 0xa6, 0x0f, 0xc2, 0xc7, 0xc6, 0xcc, 0xe7, 0xe3, 0xbd, 0x9e, 0x9e, 0xa1, 0xa0, 0x9e, 0x9b, 0x9d, 0xa0, 0xa4, 0xc2, 0xe0, 0xf4, 0xef, 0xed, 0xf2, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xf8, 0xf2, 0xba, 0xe8, 0x94, 0x86, 0x23, 0x53, 0x51, 0x47, 0x50, 0x43, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4c, 0x3d, 0x34, 0x1d, 0x8b, 0xee, 0xb8, 0xea, 0xf0, 0xf0, 0xef, 0xe9, 0xed, 0xed, 0xee, 0xee, 0xf9, 0xfa, 0xf9, 0xf2, 0xf2, 0xe6, 0xc6, 0xfd, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xe6, 0xe5, 0x94, 0x85, 0x1b, 0x03, 0xd9, 0x9a, 0xe8, 0xfe, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xb9, 0xba, 0xf8, 0x0d, 0x21, 0x58, 0x47, 0x4c, 0x43, 0x50, 0x4f, 0x59, 0x53, 0x4f, 0x49, 0x49, 0x50, 0x54, 0x4a, 0x32, 0x85, 0x95, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xed, 0xe9, 0xf2, 0xf4, 0xe2, 0xce, 0xbf, 0xf6, 0xa6, 0xa6, 0xbd, 0xab, 0xc2, 0xce, 0xde, 0xe2, 0xba, 0xf4, 0xc7, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0xbb, 0x96, 0xbb, 0x96, 0x99, 0x99, 0x99, 0x99, 0x99, 0xe0, 0xba, 0x9a, 0xb8, 0xc7, 0xab, 0xbd, 0xbd, 0xab, 0xbf, 0xeb, 0xdb, 0xe5, 0xf4, 0xf3, 0xee, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xff, 0xf0, 0xb8, 0xea, 0x94, 0x86, 0x35, 0x4a, 0x54, 0x53, 0x43, 0x4f, 0x4c, 0x50, 0x43, 0x43, 0x43, 0x4c, 0x4c, 0x4c, 0x3c, 0x2b, 0x36, 0x92, 0xee, 0xb8, 0xf2, 0xf8, 0xf0, 0xee, 0xe9, 0xef, 0xef, 0xee, 0xf0, 0xfa, 0xf9, 0xed, 0xf3, 0x95, 0xa6, 0x14, 0x79, 0x85, 0x94, 0xf8, 0xee, 0xee, 0xed, 0xe9, 0xef, 0xef, 0xed, 0xe9, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xed, 0xea, 0xba, 0x92, 0x4e, 0x46, 0x1b, 0x97, 0xeb, 0xf4, 0xf1, 0xed, 0xf0, 0xee, 0xf3, 0xec, 0xf3, 0xee, 0xef, 0xee, 0xf0, 0xee, 0xf3, 0xb9, 0x95, 0x19, 0x1c, 0x58, 0x4a, 0x47, 0x50, 0x4a, 0x59, 0x59, 0x59, 0x4f, 0x49, 0x44, 0x53, 0x5d, 0x59, 0x31, 0x8a, 0x95, 0xe6, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xf2, 0xee, 0xef, 0xee, 0xf2, 0xee, 0xf2, 0xf4, 0xf3, 0xf3, 0xba, 0xec, 0xee, 0xe6, 0xf3, 0xf4, 0xf4, 0xff, 0xcc, 0xd9, 0xf4, 0xe5, 0xa3, 0x9b, 0x96, 0x96, 0x97, 0x97, 0x96, 0x96, 0x96, 0x00, 0x97, 0x00, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x06, 0x07, 0x06, 0x06, 0x04, 0x04, 0x03, 0x03, 0x01, 0x00, 0x97, 0x96, 0x96, 0x96, 0x97, 0x97, 0x99, 0xa3, 0xf1, 0xfd, 0xce, 0x83, 0xf4, 0xf3, 0xf4, 0xea, 0xea, 0xea, 0xf3, 0xf4, 0xf2, 0xef, 0xf2, 0xed, 0xee, 0xf2, 0xee, 0xf2, 0xe6, 0xef, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xe8, 0xb8, 0x94, 0x8c, 0x32, 0x4f, 0x4a, 0x4c, 0x50, 0x4c, 0x4a, 0x4c, 0x43, 0x4c, 0x4c, 0x47, 0x5d, 0x4c, 0x30, 0x23, 0x81, 0x94, 0x9a, 0xe7, 0xe9, 0xf1, 0xf8, 0xe9, 0xba, 0xed, 0xf8, 0xef, 0xf8, 0xed, 0xf2, 0xe7, 0xf3, 0xc2, 0x06, 0x64, 0x1c, 0x64, 0x94, 0xff, 0xf0, 0xb9, 0xe9, 0xed, 0xf0, 0xed, 0xef, 0xe9, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf2, 0xef, 0xf0, 0xef, 0xef, 0xea, 0xba, 0x95, 0x8d, 0x57, 0x2d, 0x78, 0x10, 0x9b, 0xcc, 0xf4, 0xf2, 0xee, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xee, 0xf8, 0xf4, 0x81, 0x1a, 0x61, 0x40, 0x53, 0x5d, 0x4c, 0x51, 0x54, 0x59, 0x4f, 0x4f, 0x55, 0x4a, 0x59, 0x2d, 0x74, 0x8f, 0xf8, 0xed, 0xef, 0xf0, 0xe6, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xee, 0xf2, 0xe9, 0xee, 0xf2, 0xef, 0xf3, 0xfb, 0xfb, 0xf4, 0xf2, 0x7d, 0xc2, 0xa3, 0x99, 0xa3, 0xf2, 0xf4, 0xce, 0x99, 0x97, 0x02, 0x03, 0x06, 0x06, 0x09, 0x0d, 0x0e, 0x12, 0x16, 0x1a, 0x1c, 0x24, 0x24, 0x29, 0x29, 0x29, 0x31, 0x45, 0x31, 0x31, 0x31, 0x31, 0x29, 0x29, 0x24, 0x1d, 0x1a, 0x16, 0x13, 0x0d, 0x09, 0x06, 0x04, 0x02, 0x99, 0x1e, 0xf4, 0xf7, 0x02, 0x05, 0xbd, 0xc7, 0xdf, 0xf3, 0xf4, 0xf4, 0xf2, 0xed, 0xf1, 0xfb, 0xfa, 0xf2, 0xf2, 0xef, 0xf2, 0xe6, 0xee, 0xef, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xf8, 0xef, 0xba, 0xea, 0x94, 0x90, 0x46, 0x2a, 0x58, 0x50, 0x4c, 0x4a, 0x59, 0x4a, 0x4c, 0x4c, 0x3d, 0x5d, 0x4a, 0x3f, 0x39, 0x26, 0x8f, 0x95, 0xe6, 0xe8, 0xf1, 0xf8, 0xfa, 0xba, 0xe9, 0xed, 0xfa, 0xf8, 0xef, 0xe5, 0xba, 0xf4, 0xc7, 0x00, 0x1f, 0x48, 0x2d, 0x31, 0xfe, 0x91, 0xf2, 0xe6, 0xba, 0xed, 0xf0, 0xf8, 0xed, 0xba, 0xe9, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xea, 0xea, 0x94, 0x8e, 0x3e, 0x42, 0x4f, 0x52, 0x0d, 0x9b, 0xc7, 0xf4, 0xef, 0xf3, 0xed, 0xe6, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xff, 0xee, 0xf3, 0x91, 0x4e, 0x2a, 0x5f, 0x4a, 0x4a, 0x5d, 0x59, 0x51, 0x59, 0x59, 0x4f, 0x4f, 0x55, 0x4d, 0x32, 0x84, 0x93, 0xff, 0xed, 0xed, 0xef, 0xed, 0xf0, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xef, 0xed, 0xf8, 0xef, 0xee, 0xf2, 0xf2, 0xf4, 0xea, 0xe2, 0xc7, 0xf5, 0x9b, 0x99, 0x9c, 0x96, 0x99, 0xce, 0xf4, 0x91, 0x14, 0x17, 0x1c, 0x26, 0x2c, 0x45, 0x5a, 0x6c, 0x6b, 0x72, 0x68, 0x63, 0x63, 0x49, 0x4f, 0x56, 0x4f, 0x55, 0x50, 0x42, 0x50, 0x3f, 0x55, 0x55, 0x55, 0x49, 0x63, 0x63, 0x5e, 0x68, 0x68, 0x6f, 0x6a, 0x5c, 0x29, 0x1a, 0x11, 0xfd, 0x95, 0x25, 0x97, 0x97, 0x96, 0x99, 0x9c, 0xa6, 0xc6, 0xdd, 0xee, 0xf4, 0xfb, 0xf9, 0xf9, 0xef, 0xee, 0xe6, 0xf2, 0xf2, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xea, 0xe8, 0xe6, 0xf8, 0x93, 0x84, 0x24, 0x60, 0x34, 0x4c, 0x59, 0x51, 0x4c, 0x4c, 0x53, 0x54, 0x47, 0x4f, 0x39, 0x26, 0x7c, 0x93, 0xf8, 0xb8, 0xea, 0xed, 0xf9, 0xf0, 0xba, 0xba, 0xf1, 0xf9, 0xfa, 0xe9, 0xb9, 0x9a, 0xdb, 0x97, 0x10, 0x76, 0x2d, 0x38, 0x26, 0x8b, 0x91, 0x9a, 0xe6, 0xba, 0xef, 0xf1, 0xfa, 0xef, 0xe9, 0xe9, 0xef, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xf1, 0xf1, 0x94, 0x89, 0x31, 0x50, 0x4c, 0x69, 0x2f, 0x04, 0x97, 0xdb, 0xf4, 0xe6, 0xf2, 0xf0, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf9, 0xba, 0xe6, 0x95, 0x84, 0x26, 0x4d, 0x62, 0x3c, 0x59, 0x59, 0x53, 0x59, 0x4f, 0x4f, 0x58, 0x42, 0x45, 0x52, 0x8f, 0xf4, 0xf2, 0xf0, 0xef, 0xf2, 0xed, 0xe6, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xfb, 0xef, 0xf4, 0xf3, 0xdf, 0xab, 0xa2, 0x9b, 0x9b, 0x9b, 0x96, 0x98, 0x96, 0x99, 0x0c, 0x91, 0x94, 0x87, 0x2f, 0x60, 0x68, 0x3f, 0x44, 0x42, 0x3f, 0x38, 0x38, 0x40, 0x51, 0x40, 0x51, 0x40, 0x51, 0x47, 0x40, 0x40, 0x47, 0x51, 0x51, 0x47, 0x51, 0x40, 0x40, 0x47, 0x4a, 0x51, 0x4c, 0x51, 0x54, 0x5d, 0x5d, 0x60, 0x57, 0x79, 0x90, 0x95, 0xf6, 0x96, 0x02, 0x01, 0x01, 0x00, 0x96, 0x96, 0x98, 0xf6, 0xce, 0xec, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf3, 0xed, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xea, 0xed, 0xe6, 0xfb, 0xf4, 0x95, 0x90, 0x64, 0x31, 0x39, 0x5d, 0x59, 0x4f, 0x4a, 0x50, 0x41, 0x5d, 0x38, 0x58, 0x26, 0x2f, 0x8e, 0x91, 0xe6, 0xe8, 0xe7, 0xf1, 0xfa, 0xf0, 0xb9, 0xe9, 0xf0, 0xf9, 0xf1, 0xe9, 0x9a, 0xe2, 0x05, 0x07, 0x46, 0x35, 0x34, 0x30, 0x31, 0x87, 0x94, 0xfb, 0xb8, 0xea, 0xed, 0xfa, 0xfa, 0xef, 0xb9, 0xe9, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf1, 0xf9, 0x94, 0x8a, 0x2f, 0x44, 0x53, 0x47, 0x78, 0x24, 0x02, 0x96, 0xdd, 0xf4, 0xe6, 0xed, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xfa, 0xb9, 0xb8, 0xba, 0x90, 0x7b, 0x2e, 0x42, 0x62, 0x4f, 0x4a, 0x55, 0x55, 0x5f, 0x5f, 0x58, 0x60, 0x27, 0x8e, 0xf7, 0xce, 0xe0, 0xf2, 0xf3, 0xed, 0xed, 0xf2, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf2, 0xfb, 0xf3, 0xf4, 0xec, 0x25, 0xa6, 0x99, 0x99, 0x96, 0x97, 0x96, 0x00, 0x02, 0x04, 0x0e, 0x17, 0x1b, 0x79, 0x94, 0x8e, 0x46, 0x2d, 0x3c, 0x53, 0x4c, 0x3d, 0x41, 0x51, 0x51, 0x51, 0x51, 0x47, 0x40, 0x40, 0x40, 0x47, 0x47, 0x51, 0x47, 0x47, 0x51, 0x47, 0x51, 0x54, 0x59, 0x41, 0x47, 0x41, 0x47, 0x47, 0x47, 0x54, 0x47, 0x42, 0x2c, 0x88, 0x8f, 0x8a, 0x22, 0x1a, 0x0d, 0x07, 0x03, 0x02, 0x00, 0x97, 0x97, 0x99, 0x99, 0xbb, 0xab, 0xdb, 0xf0, 0xf3, 0xf3, 0xed, 0xf2, 0xee, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe9, 0xea, 0xf4, 0xf4, 0xe2, 0xd9, 0xec, 0x90, 0x27, 0x49, 0x59, 0x4a, 0x4f, 0x55, 0x50, 0x53, 0x40, 0x4f, 0x35, 0x29, 0x85, 0x93, 0xff, 0xba, 0xea, 0xe8, 0xf9, 0xf9, 0xf0, 0xba, 0xb9, 0xf1, 0xf9, 0xf8, 0xf2, 0x9a, 0x05, 0x97, 0x31, 0x49, 0x4f, 0x3c, 0x49, 0x24, 0x8a, 0x94, 0x9a, 0xba, 0xb8, 0xed, 0xf1, 0xf9, 0xee, 0xe9, 0xba, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf1, 0xf9, 0x94, 0x8a, 0x2f, 0x2e, 0x47, 0x5d, 0x4f, 0x6c, 0x17, 0x96, 0xf5, 0xf7, 0xf3, 0xef, 0xe6, 0xef, 0xe9, 0xe9, 0xef, 0xf0, 0xfa, 0xb8, 0xb8, 0xb9, 0xfe, 0x8c, 0x6e, 0x23, 0x4d, 0x42, 0x58, 0x56, 0x58, 0x4f, 0x58, 0x4d, 0x31, 0x8a, 0x8b, 0xa3, 0x99, 0x05, 0xbf, 0xe0, 0xf4, 0xf3, 0xef, 0xef, 0xed, 0xf0, 0xed, 0xe9, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xe9, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xe9, 0xe9, 0xef, 0xe9, 0xef, 0xed, 0xee, 0xf2, 0xf4, 0xf4, 0xec, 0xc7, 0x05, 0x99, 0x99, 0x96, 0x00, 0x97, 0x03, 0x06, 0x0e, 0x1d, 0x2c, 0x45, 0x6f, 0x2e, 0x52, 0xfd, 0x90, 0x82, 0x23, 0x50, 0x3d, 0x3d, 0x3d, 0x41, 0x47, 0x47, 0x3d, 0x4a, 0x4a, 0x41, 0x4a, 0x41, 0x40, 0x4c, 0x3d, 0x4c, 0x40, 0x4a, 0x40, 0x4a, 0x4c, 0x41, 0x4c, 0x41, 0x4c, 0x4c, 0x4c, 0x4c, 0x53, 0x3f, 0x3e, 0x29, 0x8e, 0x8e, 0x84, 0x48, 0x6b, 0x67, 0x2f, 0x1f, 0x13, 0x07, 0x03, 0x01, 0x96, 0xbb, 0x9c, 0x99, 0xbb, 0xa6, 0xd9, 0xe9, 0xf4, 0xf3, 0xf0, 0xed, 0xed, 0xed, 0xe9, 0xe9, 0xed, 0xed, 0xed, 0xe9, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xe9, 0xba, 0xe9, 0xee, 0xf0, 0xef, 0xed, 0xe9, 0xf3, 0xf3, 0xe2, 0xfc, 0xbc, 0x99, 0x0a, 0x83, 0x8c, 0x32, 0x2b, 0x3f, 0x55, 0x42, 0x50, 0x4f, 0x4f, 0x39, 0x21, 0x7e, 0x92, 0xff, 0xee, 0xea, 0xe7, 0xea, 0xf1, 0xf9, 0xee, 0xe6, 0xe9, 0xf8, 0xf9, 0xf1, 0xf3, 0xbf, 0x99, 0x17, 0x5c, 0x4f, 0x53, 0x55, 0x2e, 0x2f, 0x87, 0x93, 0xee, 0xba, 0xe7, 0xed, 0xfa, 0xfa, 0xef, 0xba, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xe9, 0xef, 0xe9, 0xe9, 0xef, 0xf1, 0xed, 0x9a, 0x8e, 0x45, 0x43, 0x43, 0x4c, 0x43, 0x50, 0x6c, 0x0e, 0x99, 0xa6, 0x9a, 0xe7, 0xe9, 0xe6, 0xb8, 0xb9, 0xf2, 0xf9, 0xf8, 0xee, 0xba, 0xba, 0xee, 0x94, 0x90, 0x81, 0x5b, 0x29, 0x32, 0x2e, 0x35, 0x35, 0x48, 0x77, 0x8a, 0x95, 0xf7, 0x15, 0x06, 0x97, 0x99, 0x99, 0xbf, 0xe0, 0xf4, 0xfb, 0xfb, 0xfa, 0xee, 0x9a, 0xba, 0xba, 0xe9, 0xef, 0xe9, 0xba, 0xba, 0xea, 0xe9, 0xf0, 0xf9, 0xfa, 0xef, 0xf0, 0xee, 0xee, 0xba, 0x9a, 0x9a, 0xea, 0xe7, 0xe9, 0xf2, 0xf4, 0xf4, 0xdf, 0x0f, 0x98, 0x99, 0x96, 0x00, 0x96, 0x02, 0x0d, 0x16, 0x21, 0x5e, 0x71, 0x4c, 0x4a, 0x4c, 0x4f, 0x30, 0x2c, 0x8b, 0x90, 0x92, 0x4e, 0x28, 0x4a, 0x47, 0x3d, 0x3a, 0x3d, 0x4c, 0x40, 0x41, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x4a, 0x41, 0x41, 0x41, 0x43, 0x3a, 0x39, 0x20, 0x65, 0x94, 0x90, 0x7a, 0x42, 0x4a, 0x43, 0x55, 0x56, 0x78, 0x78, 0x2c, 0x1a, 0x0d, 0x06, 0x97, 0x00, 0x97, 0x99, 0x99, 0xa0, 0xc6, 0xf7, 0xf3, 0xfb, 0xf1, 0x9a, 0xb8, 0xb9, 0xf2, 0xed, 0xe7, 0xf2, 0xe7, 0xe9, 0xe9, 0xf0, 0xf1, 0xf9, 0xfa, 0xff, 0xba, 0xb8, 0xb8, 0xb9, 0x95, 0xfa, 0xfe, 0xfb, 0xf3, 0xf7, 0xab, 0x99, 0x99, 0x99, 0x99, 0x06, 0x22, 0x90, 0x8c, 0x7c, 0x31, 0x2e, 0x2d, 0x33, 0x33, 0x2a, 0x36, 0x85, 0x9a, 0xf9, 0xfe, 0xf8, 0xef, 0xba, 0xe7, 0xba, 0xe9, 0xf8, 0xee, 0xff, 0xf8, 0xef, 0xf4, 0x25, 0x99, 0x0d, 0x66, 0x39, 0x50, 0x3c, 0x50, 0x39, 0x29, 0x8a, 0x93, 0xee, 0xb9, 0xb9, 0xed, 0xf1, 0xfa, 0xed, 0xba, 0xba, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xf0, 0xee, 0x9a, 0x8f, 0x5a, 0x34, 0x50, 0x43, 0x4c, 0x55, 0x49, 0x2f, 0x06, 0x99, 0xeb, 0xf3, 0xe7, 0xe9, 0xee, 0xe6, 0xf1, 0xf1, 0xf0, 0xee, 0xed, 0xe9, 0xe9, 0xf8, 0x94, 0x90, 0x8e, 0x8c, 0x84, 0x84, 0x84, 0x86, 0x8c, 0x8e, 0x90, 0x89, 0x64, 0x4e, 0x46, 0x1d, 0x07, 0x00, 0x99, 0x98, 0xc6, 0xe4, 0xf4, 0xf3, 0xf0, 0xf8, 0xf0, 0xef, 0xf0, 0xf0, 0xef, 0xe9, 0xe9, 0xba, 0xe9, 0xf0, 0xf0, 0xba, 0xba, 0xba, 0xe9, 0xee, 0xff, 0xee, 0xf8, 0xe6, 0xf3, 0xf4, 0xfb, 0xdd, 0xbd, 0x98, 0x99, 0x96, 0x97, 0x02, 0x09, 0x16, 0x29, 0x5a, 0x3e, 0x4d, 0x42, 0x3c, 0x3d, 0x41, 0x4c, 0x3c, 0x30, 0x48, 0x8d, 0x93, 0x94, 0x87, 0x29, 0x23, 0x4c, 0x3a, 0x3d, 0x47, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x41, 0x40, 0x47, 0x40, 0x47, 0x4a, 0x47, 0x3a, 0x43, 0x39, 0x82, 0x91, 0xe5, 0x93, 0x80, 0x33, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x68, 0x67, 0x6c, 0x31, 0x1d, 0x0d, 0x04, 0x97, 0x97, 0x97, 0x9b, 0xa0, 0xc2, 0xf7, 0xf4, 0xfb, 0x95, 0xf8, 0xed, 0xef, 0xef, 0xe6, 0xf2, 0xef, 0xe9, 0xef, 0xf0, 0xef, 0xfa, 0xee, 0xba, 0xb9, 0xb9, 0xee, 0xf2, 0x94, 0xf2, 0x95, 0xca, 0xa0, 0x99, 0x96, 0x96, 0x06, 0x1b, 0x5b, 0x74, 0x88, 0x8f, 0x8f, 0x8a, 0x84, 0x81, 0x82, 0x82, 0x86, 0x90, 0x9a, 0xb9, 0xe6, 0xf9, 0xf0, 0xed, 0xe9, 0xba, 0xba, 0xef, 0xe6, 0xfb, 0xf8, 0x9a, 0xf3, 0xdf, 0x98, 0x02, 0x52, 0x3e, 0x43, 0x53, 0x4c, 0x44, 0x39, 0x29, 0x8a, 0x93, 0xee, 0xb8, 0xe8, 0xed, 0xfa, 0xf9, 0xee, 0xba, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xf0, 0xe9, 0xba, 0x8f, 0x6e, 0x2d, 0x43, 0x53, 0x4c, 0x53, 0x49, 0x6a, 0x1d, 0x00, 0x9e, 0xdb, 0xf4, 0xf8, 0x91, 0xfb, 0xf0, 0xe7, 0xf0, 0xf1, 0xef, 0xed, 0xed, 0xef, 0xf0, 0x94, 0x92, 0x92, 0x91, 0x95, 0xee, 0x91, 0x91, 0x8e, 0x88, 0x26, 0x28, 0x33, 0x34, 0x4d, 0x5a, 0x1a, 0x04, 0x99, 0x99, 0xa1, 0xcc, 0x9a, 0xf4, 0xff, 0xfa, 0xf1, 0xfa, 0xfa, 0xf0, 0xf0, 0xef, 0xe9, 0xe9, 0xe9, 0xef, 0xb9, 0xb8, 0xba, 0xe9, 0xf0, 0xf8, 0xfa, 0xfb, 0xf4, 0xf4, 0xd9, 0xa6, 0x99, 0x99, 0x99, 0x97, 0x07, 0x13, 0x26, 0x5c, 0x73, 0x3f, 0x42, 0x42, 0x3f, 0x3c, 0x40, 0x41, 0x41, 0x4c, 0x3c, 0x30, 0x5a, 0x8e, 0x91, 0xee, 0xff, 0x8e, 0x7a, 0x39, 0x34, 0x37, 0x47, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x4a, 0x41, 0x40, 0x53, 0x30, 0x35, 0x8e, 0x94, 0xb8, 0x95, 0x80, 0x33, 0x4a, 0x47, 0x47, 0x54, 0x54, 0x40, 0x40, 0x3c, 0x3f, 0x56, 0x67, 0x6f, 0x48, 0x16, 0x09, 0x01, 0x99, 0x9c, 0x9b, 0xa0, 0xbf, 0xfd, 0x95, 0x95, 0xf0, 0xed, 0xf3, 0xf2, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xe9, 0xee, 0xf0, 0xee, 0xfa, 0xef, 0xf8, 0xf4, 0xe3, 0xab, 0x99, 0x99, 0x99, 0x02, 0x13, 0x57, 0x4d, 0x4d, 0x3e, 0x46, 0x84, 0x8e, 0x93, 0xee, 0xee, 0x95, 0x94, 0x94, 0xf8, 0xb9, 0xb9, 0xf0, 0xfa, 0xee, 0xee, 0xed, 0xe9, 0xed, 0xe9, 0xf0, 0xed, 0xe6, 0x9a, 0xe6, 0xa3, 0x96, 0x1d, 0x45, 0x55, 0x54, 0x54, 0x4c, 0x55, 0x2e, 0x2f, 0x8a, 0x94, 0xee, 0xb9, 0xb9, 0xed, 0xf1, 0xf8, 0xf0, 0xba, 0xe9, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xf0, 0xee, 0xb9, 0x92, 0x7b, 0x2d, 0x50, 0x4c, 0x53, 0x53, 0x58, 0x42, 0x76, 0x12, 0x96, 0xa1, 0xba, 0xf3, 0xfe, 0xfe, 0xf8, 0xba, 0xf1, 0xf8, 0xf1, 0xf1, 0xf1, 0xe6, 0xed, 0xe9, 0xee, 0xee, 0xee, 0xe9, 0xe6, 0xf8, 0x93, 0x82, 0x32, 0x33, 0x4a, 0x40, 0x55, 0x4f, 0x58, 0x60, 0x2f, 0x17, 0x02, 0x99, 0x96, 0x0a, 0xdf, 0xf4, 0xf0, 0xf0, 0xfa, 0xed, 0xfa, 0xf0, 0xf0, 0xee, 0xe9, 0xba, 0xba, 0xba, 0xba, 0xea, 0xef, 0xf1, 0xf1, 0xf3, 0xf4, 0xdd, 0xa6, 0x96, 0x99, 0x97, 0x02, 0x0b, 0x1c, 0x45, 0x69, 0x63, 0x4c, 0x53, 0x54, 0x4a, 0x51, 0x51, 0x40, 0x37, 0x3d, 0x3d, 0x3c, 0x3c, 0x3c, 0x2e, 0x86, 0x92, 0x9a, 0xe5, 0x93, 0x88, 0x2e, 0x3f, 0x40, 0x51, 0x47, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x3d, 0x40, 0x3f, 0x2e, 0x8c, 0x94, 0xee, 0x92, 0x7b, 0x33, 0x4a, 0x47, 0x53, 0x47, 0x47, 0x5d, 0x54, 0x5d, 0x54, 0x4a, 0x4c, 0x50, 0x43, 0x72, 0x6c, 0x20, 0x0e, 0x02, 0x97, 0x96, 0x99, 0xa1, 0xc7, 0xf2, 0xf4, 0xf2, 0xee, 0xee, 0xf2, 0xf0, 0xee, 0xee, 0x9a, 0xba, 0x9a, 0xee, 0xf0, 0xfa, 0xf9, 0xf1, 0xf4, 0xd9, 0xa0, 0x99, 0x99, 0x97, 0x0d, 0x20, 0x45, 0x4d, 0x4f, 0x59, 0x30, 0x60, 0x45, 0x74, 0x8e, 0x91, 0x9a, 0xb8, 0xe8, 0xf8, 0xff, 0xee, 0xe6, 0xf8, 0x91, 0xee, 0xee, 0xf0, 0xed, 0xf0, 0xef, 0xe7, 0xf2, 0x9a, 0xf4, 0xfc, 0x99, 0x0d, 0x6e, 0x61, 0x47, 0x54, 0x54, 0x53, 0x44, 0x2e, 0x52, 0x90, 0x93, 0xee, 0xb9, 0xe8, 0xed, 0xfa, 0xf0, 0xed, 0xba, 0xe9, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xf1, 0xef, 0xe6, 0x94, 0x7e, 0x2e, 0x58, 0x53, 0x53, 0x53, 0x5f, 0x62, 0x49, 0x6c, 0x06, 0x99, 0xc6, 0xea, 0xfb, 0xfe, 0xfb, 0xba, 0xe9, 0xed, 0xed, 0xf1, 0xed, 0xf1, 0xea, 0xe8, 0xe5, 0xb8, 0xba, 0xf1, 0xf1, 0x90, 0x81, 0x24, 0x39, 0x30, 0x53, 0x3a, 0x44, 0x34, 0x4a, 0x42, 0x6f, 0x57, 0x24, 0x0d, 0x00, 0x96, 0x98, 0xeb, 0xf4, 0xf3, 0xef, 0xe9, 0xef, 0xf0, 0xf1, 0xf0, 0xef, 0xe9, 0xba, 0xf0, 0xfa, 0xfa, 0xed, 0xf3, 0xf4, 0xf7, 0xbf, 0x96, 0x99, 0x99, 0x03, 0x0d, 0x20, 0x5a, 0x67, 0x4f, 0x4a, 0x47, 0x53, 0x4c, 0x3a, 0x51, 0x51, 0x54, 0x47, 0x53, 0x3a, 0x3d, 0x3c, 0x3d, 0x3c, 0x34, 0x7a, 0x8f, 0x94, 0xff, 0x90, 0x7a, 0x28, 0x3c, 0x37, 0x54, 0x3d, 0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x41, 0x40, 0x37, 0x40, 0x40, 0x37, 0x37, 0x4f, 0x2d, 0x7b, 0x8e, 0x93, 0x8e, 0x48, 0x4f, 0x38, 0x51, 0x4c, 0x43, 0x53, 0x4c, 0x3d, 0x3d, 0x47, 0x53, 0x53, 0x53, 0x4c, 0x53, 0x4f, 0x5e, 0x6c, 0x29, 0x12, 0x03, 0x97, 0x99, 0x99, 0xa6, 0xdd, 0xf4, 0xf3, 0xe6, 0xef, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xba, 0xef, 0xfa, 0xf9, 0xfb, 0xf4, 0xcc, 0x9d, 0x99, 0x99, 0x04, 0x16, 0x45, 0x5c, 0x35, 0x44, 0x3c, 0x4a, 0x5f, 0x30, 0x49, 0x3e, 0x6e, 0x86, 0xfe, 0xed, 0xed, 0xf9, 0xf9, 0xf8, 0xf8, 0xfb, 0xf8, 0xef, 0xee, 0xed, 0xfa, 0xed, 0xf1, 0xe6, 0xe7, 0xf4, 0xcc, 0x99, 0x03, 0x2f, 0x6b, 0x4a, 0x5d, 0x54, 0x5d, 0x53, 0x58, 0x28, 0x5b, 0x93, 0xff, 0xee, 0xba, 0xba, 0xef, 0xed, 0xf8, 0xef, 0xee, 0xe9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xf0, 0xf2, 0xe9, 0x95, 0x89, 0x26, 0x4f, 0x53, 0x53, 0x53, 0x53, 0x50, 0x62, 0x61, 0x21, 0x03, 0x98, 0xde, 0xf3, 0xed, 0xef, 0xb9, 0xb9, 0xba, 0xe9, 0xed, 0xf1, 0xed, 0xed, 0xe9, 0xb9, 0xb9, 0xe7, 0xed, 0xf9, 0x85, 0x24, 0x3e, 0x42, 0x41, 0x54, 0x53, 0x4c, 0x50, 0x43, 0x43, 0x50, 0x4f, 0x61, 0x6b, 0x1c, 0x09, 0x97, 0x99, 0xa6, 0xf2, 0xf2, 0xba, 0xba, 0xea, 0xf0, 0xec, 0xf0, 0xee, 0xba, 0xff, 0xfa, 0xee, 0xf4, 0xe3, 0xc6, 0x9e, 0x99, 0x00, 0x02, 0x0e, 0x26, 0x5e, 0x5e, 0x42, 0x3f, 0x3f, 0x4c, 0x4c, 0x4c, 0x3d, 0x47, 0x47, 0x47, 0x47, 0x3a, 0x3a, 0x3a, 0x43, 0x4c, 0x4c, 0x51, 0x38, 0x42, 0x7b, 0x8c, 0x86, 0x74, 0x2d, 0x38, 0x47, 0x3d, 0x3d, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3a, 0x34, 0x2e, 0x45, 0x6e, 0x76, 0x34, 0x38, 0x47, 0x53, 0x3c, 0x43, 0x3a, 0x3c, 0x4c, 0x4c, 0x4c, 0x4c, 0x3d, 0x43, 0x47, 0x47, 0x51, 0x47, 0x59, 0x58, 0x75, 0x31, 0x17, 0x03, 0x99, 0x9b, 0x9b, 0xab, 0xe2, 0xf4, 0xf2, 0xef, 0xed, 0xee, 0xf2, 0xee, 0xf2, 0xf2, 0xf0, 0xfb, 0xf3, 0xbf, 0x99, 0x99, 0x01, 0x09, 0x29, 0x68, 0x3c, 0x34, 0x39, 0x44, 0x43, 0x3a, 0x4c, 0x5d, 0x4a, 0x4f, 0x28, 0x4e, 0x92, 0xed, 0xea, 0xe8, 0xf0, 0xe8, 0xb9, 0xe8, 0xba, 0xb9, 0xee, 0xf0, 0xf9, 0xf1, 0xed, 0xba, 0xf3, 0xf7, 0xbc, 0x99, 0x1a, 0x6c, 0x4f, 0x59, 0x70, 0x50, 0x5d, 0x4f, 0x4f, 0x2e, 0x7c, 0x94, 0xff, 0xee, 0xee, 0xe9, 0xed, 0xef, 0xef, 0xef, 0xba, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xf1, 0xf0, 0xe9, 0xfb, 0x8d, 0x31, 0x58, 0x4a, 0x4c, 0x62, 0x54, 0x55, 0x43, 0x62, 0x60, 0x12, 0x99, 0xab, 0xf4, 0xe7, 0xee, 0xee, 0xb9, 0xb9, 0xba, 0xee, 0xee, 0xfa, 0xf8, 0xef, 0xee, 0xba, 0xba, 0xea, 0x94, 0x8e, 0x46, 0x2a, 0x50, 0x4a, 0x47, 0x51, 0x51, 0x4c, 0x50, 0x50, 0x4c, 0x4f, 0x4a, 0x58, 0x60, 0x29, 0x10, 0x01, 0x99, 0xf5, 0xe2, 0x9a, 0xb9, 0xb8, 0xe6, 0xf3, 0xfa, 0xee, 0xf2, 0xee, 0x95, 0xf4, 0xdd, 0xa6, 0x9b, 0x96, 0x00, 0x0d, 0x20, 0x45, 0x55, 0x43, 0x3a, 0x43, 0x43, 0x4c, 0x43, 0x4c, 0x47, 0x53, 0x47, 0x41, 0x4c, 0x3a, 0x43, 0x43, 0x43, 0x4c, 0x41, 0x4a, 0x47, 0x54, 0x40, 0x28, 0x31, 0x45, 0x28, 0x38, 0x51, 0x40, 0x3d, 0x3a, 0x3d, 0x3d, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x41, 0x40, 0x40, 0x40, 0x41, 0x40, 0x37, 0x40, 0x40, 0x40, 0x3d, 0x3a, 0x3a, 0x42, 0x39, 0x2d, 0x30, 0x38, 0x47, 0x47, 0x41, 0x4c, 0x4a, 0x4a, 0x4a, 0x40, 0x4a, 0x4c, 0x4c, 0x4c, 0x43, 0x4c, 0x47, 0x47, 0x47, 0x54, 0x51, 0x38, 0x73, 0x76, 0x27, 0x0e, 0x01, 0x96, 0x99, 0x05, 0xeb, 0xf4, 0xf3, 0xf2, 0xed, 0xec, 0xf8, 0xf8, 0xed, 0xf8, 0xf3, 0xc2, 0x99, 0x99, 0x97, 0x12, 0x29, 0x58, 0x4f, 0x40, 0x43, 0x43, 0x44, 0x43, 0x43, 0x53, 0x4c, 0x40, 0x4f, 0x2a, 0x80, 0x93, 0xb9, 0xba, 0xe8, 0xed, 0xe8, 0xb8, 0xe7, 0xe8, 0xba, 0xee, 0xf8, 0xf9, 0xf0, 0xed, 0xe7, 0xf3, 0xc6, 0x99, 0x07, 0x7a, 0x58, 0x59, 0x53, 0x43, 0x44, 0x55, 0x4a, 0x58, 0x2e, 0x84, 0x95, 0xf8, 0xee, 0xee, 0xe9, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe9, 0xed, 0xf2, 0xef, 0xe9, 0xef, 0xe9, 0xf9, 0xfb, 0xea, 0x9a, 0x92, 0x74, 0x33, 0x4f, 0x3a, 0x62, 0x5d, 0x50, 0x4c, 0x5d, 0x58, 0x6c, 0x06, 0x99, 0xce, 0x9a, 0xba, 0xf0, 0xb9, 0xb9, 0xba, 0xee, 0xee, 0xf8, 0xf0, 0xff, 0xf8, 0xee, 0xef, 0xe6, 0x94, 0x8e, 0x80, 0x23, 0x39, 0x4a, 0x59, 0x4a, 0x59, 0x53, 0x4c, 0x4c, 0x50, 0x4c, 0x4f, 0x3f, 0x61, 0x4b, 0x76, 0x1a, 0x07, 0x99, 0x98, 0xdd, 0x9a, 0x9a, 0xef, 0xf8, 0xff, 0xf0, 0xee, 0xf4, 0xe3, 0xab, 0x99, 0x99, 0x97, 0x0d, 0x20, 0x67, 0x58, 0x4a, 0x3a, 0x3a, 0x3a, 0x47, 0x41, 0x47, 0x51, 0x47, 0x4a, 0x40, 0x4a, 0x43, 0x3a, 0x43, 0x3a, 0x43, 0x43, 0x3a, 0x4c, 0x47, 0x51, 0x47, 0x54, 0x4c, 0x42, 0x30, 0x51, 0x54, 0x51, 0x47, 0x3a, 0x3a, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x37, 0x40, 0x41, 0x3d, 0x3d, 0x3d, 0x37, 0x41, 0x40, 0x40, 0x51, 0x51, 0x47, 0x3d, 0x51, 0x51, 0x51, 0x47, 0x51, 0x47, 0x47, 0x47, 0x4a, 0x47, 0x41, 0x4c, 0x3a, 0x4c, 0x4c, 0x4c, 0x5d, 0x38, 0x30, 0x73, 0x78, 0x29, 0x0d, 0x03, 0x97, 0x99, 0x0a, 0xdd, 0xf4, 0xf1, 0xf3, 0xfd, 0xf3, 0xe6, 0xf4, 0xf6, 0x99, 0x96, 0x04, 0x17, 0x45, 0x49, 0x38, 0x4a, 0x3c, 0x50, 0x43, 0x43, 0x4c, 0x53, 0x4c, 0x3f, 0x56, 0x2e, 0x29, 0x89, 0xff, 0xe5, 0xb8, 0xef, 0xef, 0xe9, 0xe8, 0xea, 0xed, 0xba, 0xee, 0xfa, 0xf9, 0xed, 0xe8, 0xf4, 0x6d, 0x97, 0x03, 0x24, 0x56, 0x4a, 0x5d, 0x43, 0x56, 0x49, 0x50, 0x59, 0x42, 0x31, 0x8e, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xed, 0xe9, 0xed, 0xe9, 0xef, 0xef, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xfa, 0xf1, 0xe9, 0xb9, 0x94, 0x82, 0x2d, 0x4f, 0x43, 0x55, 0x5d, 0x59, 0x70, 0x41, 0x50, 0x68, 0x1c, 0x00, 0xf5, 0xb8, 0xe9, 0xe6, 0xee, 0xba, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xed, 0xf9, 0x91, 0x90, 0x8c, 0x31, 0x2e, 0x4f, 0x4a, 0x4a, 0x4f, 0x4f, 0x53, 0x4c, 0x50, 0x43, 0x43, 0x55, 0x3c, 0x42, 0x49, 0x72, 0x45, 0x0d, 0x00, 0xbc, 0xdd, 0x9a, 0xe9, 0xf0, 0xf8, 0x95, 0xf3, 0xce, 0xa1, 0x99, 0x97, 0x06, 0x13, 0x3e, 0x5e, 0x3c, 0x4a, 0x51, 0x34, 0x44, 0x3a, 0x41, 0x47, 0x51, 0x51, 0x47, 0x51, 0x3c, 0x3c, 0x4c, 0x3a, 0x4c, 0x3c, 0x4c, 0x3d, 0x4c, 0x41, 0x47, 0x41, 0x47, 0x47, 0x37, 0x3c, 0x40, 0x51, 0x51, 0x47, 0x3a, 0x3a, 0x40, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x41, 0x40, 0x40, 0x40, 0x41, 0x40, 0x37, 0x40, 0x40, 0x3d, 0x47, 0x47, 0x3d, 0x3d, 0x3d, 0x51, 0x54, 0x47, 0x47, 0x3d, 0x41, 0x47, 0x47, 0x51, 0x47, 0x47, 0x47, 0x40, 0x47, 0x47, 0x4a, 0x47, 0x41, 0x4c, 0x43, 0x43, 0x50, 0x37, 0x53, 0x51, 0x4a, 0x51, 0x56, 0x57, 0x1c, 0x07, 0x00, 0x99, 0xbc, 0xeb, 0xf2, 0xf3, 0xf9, 0xf1, 0xf3, 0xce, 0x99, 0x96, 0x07, 0x1a, 0x5c, 0x42, 0x4f, 0x40, 0x3c, 0x43, 0x43, 0x43, 0x4c, 0x47, 0x4a, 0x40, 0x42, 0x4b, 0x26, 0x7e, 0x92, 0xfd, 0x9a, 0xf8, 0xfa, 0xff, 0xee, 0xee, 0xf9, 0xf9, 0xed, 0xee, 0xf0, 0xf0, 0xed, 0xe9, 0xf4, 0x0a, 0x99, 0x13, 0x66, 0x55, 0x5d, 0x54, 0x62, 0x44, 0x56, 0x5d, 0x59, 0x35, 0x5b, 0x93, 0xba, 0xee, 0xef, 0xf0, 0xee, 0xee, 0xe9, 0xe9, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xe9, 0xef, 0xf2, 0xef, 0xe9, 0xef, 0xfa, 0xf9, 0xf2, 0xb8, 0x95, 0x8c, 0x4d, 0x3c, 0x56, 0x44, 0x5d, 0x51, 0x59, 0x47, 0x71, 0x43, 0x5a, 0x0e, 0x99, 0xce, 0xf4, 0xf8, 0xed, 0xed, 0xed, 0xe9, 0xe9, 0xba, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xf2, 0xed, 0xee, 0x93, 0x7e, 0x32, 0x4a, 0x51, 0x59, 0x43, 0x50, 0x4a, 0x4a, 0x50, 0x43, 0x50, 0x4c, 0x41, 0x5f, 0x4c, 0x3f, 0x61, 0x5a, 0x17, 0x97, 0x1e, 0xf4, 0xee, 0xf0, 0xf4, 0xec, 0xf6, 0x9b, 0x96, 0x00, 0x0d, 0x2c, 0x69, 0x50, 0x4c, 0x41, 0x54, 0x30, 0x47, 0x47, 0x40, 0x47, 0x40, 0x40, 0x3d, 0x40, 0x3c, 0x3d, 0x4a, 0x47, 0x4a, 0x47, 0x40, 0x47, 0x41, 0x40, 0x47, 0x3d, 0x3d, 0x41, 0x37, 0x4c, 0x4f, 0x40, 0x37, 0x47, 0x3a, 0x34, 0x3f, 0x38, 0x51, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x51, 0x47, 0x38, 0x3a, 0x30, 0x37, 0x37, 0x37, 0x37, 0x4a, 0x47, 0x4c, 0x47, 0x4c, 0x3d, 0x3d, 0x4c, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x51, 0x4a, 0x3c, 0x43, 0x3a, 0x4c, 0x47, 0x41, 0x47, 0x4c, 0x4a, 0x43, 0x69, 0x45, 0x10, 0x00, 0x99, 0x99, 0xbd, 0xf7, 0xf4, 0xe9, 0xf2, 0x25, 0x96, 0x0b, 0x29, 0x69, 0x3c, 0x40, 0x4a, 0x3f, 0x43, 0x3f, 0x43, 0x3f, 0x50, 0x50, 0x4a, 0x3f, 0x39, 0x2e, 0x66, 0x8e, 0x94, 0xba, 0xe8, 0xf8, 0xf0, 0xf8, 0xb9, 0xba, 0xed, 0xfa, 0xba, 0xed, 0xfa, 0xed, 0xe9, 0xf4, 0xd9, 0x96, 0x06, 0x46, 0x60, 0x44, 0x47, 0x3d, 0x71, 0x44, 0x55, 0x51, 0x5d, 0x2a, 0x85, 0x9a, 0xba, 0xe9, 0xf8, 0xf0, 0xee, 0xed, 0xba, 0xe9, 0xef, 0xed, 0xef, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xef, 0xe9, 0xf0, 0xef, 0xf2, 0xb8, 0x9a, 0x8f, 0x7b, 0x33, 0x42, 0x50, 0x53, 0x51, 0x5d, 0x53, 0x4c, 0x4c, 0x73, 0x29, 0x02, 0xa6, 0xf8, 0xf2, 0xed, 0xf1, 0xed, 0xea, 0xe9, 0xe8, 0xba, 0xea, 0xed, 0xe9, 0xf1, 0xe8, 0xe5, 0xb9, 0x9a, 0x8f, 0x74, 0x2d, 0x4f, 0x51, 0x4a, 0x53, 0x4f, 0x50, 0x4c, 0x50, 0x4c, 0x5d, 0x4c, 0x41, 0x50, 0x62, 0x55, 0x4d, 0x4e, 0x65, 0x95, 0xe6, 0xf3, 0xf4, 0xeb, 0xa1, 0x99, 0x97, 0x06, 0x17, 0x5a, 0x39, 0x40, 0x41, 0x47, 0x47, 0x3a, 0x4c, 0x51, 0x51, 0x51, 0x40, 0x50, 0x3c, 0x3f, 0x3c, 0x41, 0x41, 0x47, 0x40, 0x47, 0x40, 0x51, 0x47, 0x40, 0x41, 0x3d, 0x41, 0x3a, 0x41, 0x47, 0x4c, 0x3c, 0x47, 0x59, 0x3d, 0x3a, 0x44, 0x30, 0x51, 0x38, 0x47, 0x37, 0x3d, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x3d, 0x40, 0x40, 0x51, 0x37, 0x3c, 0x3a, 0x3c, 0x3d, 0x4c, 0x3d, 0x4a, 0x37, 0x3a, 0x3a, 0x3a, 0x3a, 0x4c, 0x3a, 0x3d, 0x4c, 0x3d, 0x4c, 0x40, 0x51, 0x40, 0x4a, 0x4c, 0x3c, 0x4c, 0x3d, 0x3d, 0x4c, 0x3c, 0x3d, 0x47, 0x37, 0x4b, 0x76, 0x1f, 0x09, 0x96, 0x99, 0x05, 0xde, 0x95, 0xf3, 0xfb, 0x65, 0x1f, 0x45, 0x42, 0x40, 0x47, 0x4a, 0x44, 0x3f, 0x34, 0x3f, 0x50, 0x53, 0x4a, 0x4f, 0x49, 0x2a, 0x57, 0x8c, 0x92, 0xe6, 0xea, 0xe7, 0xed, 0xf0, 0xba, 0xb9, 0xb9, 0xe9, 0xed, 0xef, 0xee, 0xf0, 0xed, 0xea, 0x9a, 0xa6, 0x97, 0x13, 0x78, 0x39, 0x4f, 0x62, 0x4c, 0x50, 0x43, 0x59, 0x51, 0x5f, 0x31, 0x90, 0xb9, 0xee, 0xe9, 0xef, 0xf0, 0xed, 0xef, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xe9, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xba, 0xee, 0xee, 0xf0, 0xba, 0x94, 0x8a, 0x32, 0x3f, 0x53, 0x53, 0x53, 0x4c, 0x53, 0x54, 0x54, 0x55, 0x4b, 0x12, 0x02, 0x3b, 0xf3, 0xed, 0xed, 0xed, 0xe9, 0xea, 0xe9, 0xe9, 0xed, 0xef, 0xf8, 0xe9, 0xb9, 0xe8, 0xb9, 0xee, 0x93, 0x90, 0x5b, 0x2a, 0x58, 0x51, 0x51, 0x4a, 0x4c, 0x5f, 0x53, 0x4a, 0x4c, 0x53, 0x50, 0x55, 0x50, 0x3f, 0x4b, 0x36, 0x91, 0xf2, 0xf3, 0xec, 0xfc, 0x99, 0x97, 0x96, 0x0d, 0x21, 0x6a, 0x39, 0x3c, 0x40, 0x51, 0x47, 0x47, 0x3d, 0x3a, 0x3d, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x41, 0x3d, 0x3d, 0x41, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x3d, 0x37, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x40, 0x40, 0x41, 0x40, 0x40, 0x40, 0x3d, 0x4c, 0x3d, 0x4c, 0x3d, 0x4c, 0x3d, 0x53, 0x47, 0x3d, 0x4c, 0x43, 0x69, 0x6c, 0x13, 0x00, 0x96, 0xbc, 0xdb, 0xfb, 0xff, 0x93, 0x81, 0x29, 0x2e, 0x4f, 0x4a, 0x40, 0x3c, 0x39, 0x49, 0x50, 0x47, 0x51, 0x54, 0x3c, 0x2a, 0x5b, 0x8a, 0x93, 0xf8, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xf0, 0xee, 0xed, 0xf1, 0xe8, 0xf4, 0xdb, 0x99, 0x09, 0x46, 0x58, 0x59, 0x59, 0x50, 0x55, 0x44, 0x59, 0x54, 0x59, 0x2d, 0x7e, 0x92, 0xee, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xba, 0xee, 0xf0, 0xef, 0xe9, 0xff, 0x93, 0x74, 0x35, 0x55, 0x47, 0x53, 0x53, 0x53, 0x53, 0x50, 0x55, 0x4b, 0x45, 0x04, 0xf6, 0xe9, 0xf2, 0xed, 0xef, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xef, 0xf0, 0xef, 0xe9, 0xba, 0xba, 0xe9, 0xff, 0x92, 0x8f, 0x7c, 0x26, 0x4d, 0x56, 0x4f, 0x43, 0x40, 0x4a, 0x5d, 0x5d, 0x59, 0x3c, 0x43, 0x49, 0x2a, 0x5b, 0x8f, 0xff, 0xf4, 0xdf, 0xa3, 0x99, 0x00, 0x02, 0x1a, 0x5c, 0x5e, 0x2e, 0x30, 0x40, 0x51, 0x47, 0x47, 0x3d, 0x3a, 0x3a, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x41, 0x41, 0x3d, 0x41, 0x41, 0x40, 0x41, 0x41, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x47, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x40, 0x40, 0x41, 0x3d, 0x3d, 0x40, 0x40, 0x4a, 0x41, 0x4a, 0x41, 0x4a, 0x3d, 0x4c, 0x3d, 0x3d, 0x4c, 0x34, 0x4b, 0x66, 0x27, 0x07, 0x00, 0x99, 0xeb, 0xf4, 0x94, 0x92, 0x84, 0x31, 0x2e, 0x3f, 0x38, 0x41, 0x4c, 0x37, 0x4a, 0x53, 0x4f, 0x28, 0x2c, 0x7c, 0x8e, 0x93, 0xf8, 0xee, 0xe6, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xf8, 0xfb, 0xe7, 0xf2, 0xf3, 0x0a, 0x96, 0x1f, 0x66, 0x4f, 0x4a, 0x4f, 0x4f, 0x43, 0x50, 0x53, 0x5f, 0x42, 0x48, 0x89, 0x94, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xe9, 0xed, 0xed, 0xed, 0xe9, 0xef, 0xee, 0xee, 0xef, 0xea, 0xef, 0xff, 0x93, 0x89, 0x46, 0x2d, 0x62, 0x4c, 0x59, 0x4a, 0x4f, 0x44, 0x56, 0x49, 0x67, 0x12, 0x03, 0xe3, 0xf2, 0xef, 0xed, 0xe9, 0xe9, 0xed, 0xba, 0xed, 0xef, 0xf8, 0xf0, 0xf8, 0xed, 0xe9, 0xb9, 0xee, 0xff, 0x92, 0x8f, 0x82, 0x2f, 0x26, 0x39, 0x58, 0x62, 0x53, 0x51, 0x53, 0x3d, 0x58, 0x49, 0x28, 0x74, 0x8f, 0x94, 0x95, 0xdd, 0x05, 0x99, 0x96, 0x09, 0x24, 0x72, 0x34, 0x30, 0x37, 0x38, 0x40, 0x37, 0x51, 0x47, 0x41, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41, 0x41, 0x40, 0x41, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41, 0x40, 0x47, 0x41, 0x40, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x37, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x3d, 0x4c, 0x41, 0x41, 0x40, 0x47, 0x43, 0x3a, 0x43, 0x4c, 0x4c, 0x3c, 0x3f, 0x35, 0x57, 0x46, 0x0d, 0x01, 0x99, 0xc2, 0xf4, 0x94, 0x90, 0x86, 0x31, 0x35, 0x3f, 0x53, 0x5d, 0x5d, 0x3c, 0x28, 0x26, 0x52, 0x84, 0x8f, 0x93, 0xf8, 0xed, 0xe6, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf8, 0xee, 0xe8, 0xf3, 0xe2, 0x01, 0x09, 0x66, 0x2e, 0x4f, 0x4f, 0x4f, 0x50, 0x53, 0x53, 0x50, 0x3f, 0x2a, 0x7c, 0x90, 0xff, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xee, 0xf0, 0xe9, 0xe9, 0xf1, 0xf0, 0xff, 0x94, 0x81, 0x2c, 0x34, 0x4a, 0x4a, 0x54, 0x4a, 0x43, 0x44, 0x4f, 0x5f, 0x48, 0x04, 0xcc, 0xf4, 0xf0, 0xed, 0xee, 0xed, 0xe9, 0xed, 0xe9, 0xef, 0xf0, 0xf8, 0xff, 0xf0, 0xee, 0xb9, 0xb9, 0xb8, 0x95, 0x91, 0x92, 0x8a, 0x7e, 0x45, 0x32, 0x28, 0x34, 0x55, 0x55, 0x56, 0x3e, 0x26, 0x80, 0x8f, 0xf8, 0xf4, 0xc2, 0x9c, 0x96, 0x03, 0x17, 0x57, 0x39, 0x38, 0x51, 0x51, 0x47, 0x40, 0x40, 0x47, 0x37, 0x37, 0x3a, 0x37, 0x3c, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x40, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x41, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41, 0x40, 0x41, 0x40, 0x41, 0x3d, 0x41, 0x40, 0x41, 0x41, 0x4c, 0x41, 0x40, 0x4c, 0x3f, 0x43, 0x4c, 0x47, 0x53, 0x53, 0x3c, 0x58, 0x35, 0x6f, 0x17, 0x03, 0x99, 0xfc, 0xea, 0xf3, 0x93, 0x8e, 0x46, 0x2c, 0x39, 0x28, 0x28, 0x2c, 0x5b, 0x84, 0x8d, 0x94, 0xfb, 0xec, 0xf1, 0xf8, 0xf8, 0xe6, 0xed, 0xed, 0xef, 0xed, 0xed, 0xef, 0xef, 0xed, 0xef, 0xfb, 0xe6, 0xea, 0xf4, 0x15, 0x02, 0x1c, 0x6a, 0x3f, 0x55, 0x50, 0x50, 0x53, 0x53, 0x54, 0x50, 0x3e, 0x46, 0x8a, 0x93, 0xe5, 0xea, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xea, 0xea, 0xf0, 0xf1, 0x9a, 0x9a, 0x92, 0x5b, 0x2a, 0x49, 0x4a, 0x54, 0x54, 0x4c, 0x43, 0x53, 0x59, 0x61, 0x0e, 0x15, 0x95, 0xf0, 0xef, 0xee, 0xed, 0xef, 0xe9, 0xed, 0xed, 0xf0, 0xf0, 0xff, 0xf8, 0xee, 0xe8, 0xb8, 0xba, 0xb9, 0xe6, 0xff, 0x93, 0x90, 0x88, 0x82, 0x57, 0x32, 0x2e, 0x2c, 0x32, 0x2f, 0x82, 0x8f, 0x94, 0xf3, 0xc2, 0x9b, 0x97, 0x04, 0x20, 0x5c, 0x3f, 0x40, 0x38, 0x47, 0x47, 0x51, 0x47, 0x40, 0x37, 0x37, 0x3c, 0x37, 0x3c, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x41, 0x40, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x40, 0x41, 0x4a, 0x47, 0x40, 0x47, 0x40, 0x4c, 0x43, 0x3a, 0x41, 0x47, 0x54, 0x47, 0x3d, 0x4a, 0x4c, 0x56, 0x6c, 0x1b, 0x06, 0x99, 0xf6, 0xe7, 0xf3, 0x93, 0x8a, 0x7c, 0x29, 0x66, 0x7e, 0x86, 0x8e, 0x91, 0xff, 0xe6, 0xf8, 0xf1, 0xfe, 0xf9, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xf8, 0xe9, 0xb9, 0xf2, 0xf5, 0x0d, 0x6b, 0x4f, 0x53, 0x43, 0x43, 0x50, 0x53, 0x54, 0x53, 0x44, 0x2c, 0x7e, 0x93, 0xf0, 0xf1, 0xea, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xef, 0xea, 0xe9, 0xf1, 0xf0, 0xea, 0xb8, 0x95, 0x8e, 0x48, 0x2c, 0x3f, 0x54, 0x54, 0x51, 0x4c, 0x53, 0x47, 0x5f, 0x21, 0x17, 0xfd, 0x95, 0xf0, 0xee, 0xe6, 0xf2, 0xe9, 0xed, 0xed, 0xed, 0xf8, 0xf0, 0xee, 0xe9, 0xb9, 0xe8, 0xb8, 0xe7, 0xed, 0xf8, 0xfa, 0xfe, 0x93, 0x92, 0x8e, 0x8c, 0x88, 0x77, 0x64, 0x87, 0x93, 0x94, 0xf4, 0xab, 0x99, 0x96, 0x0b, 0x29, 0x4b, 0x3c, 0x40, 0x41, 0x3d, 0x3d, 0x40, 0x3d, 0x37, 0x3a, 0x3c, 0x3a, 0x37, 0x37, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x4c, 0x4a, 0x41, 0x47, 0x47, 0x47, 0x54, 0x3d, 0x4c, 0x3c, 0x44, 0x5c, 0x29, 0x07, 0x99, 0x0a, 0xe4, 0xf3, 0xff, 0x92, 0x8e, 0x90, 0x92, 0x91, 0xf8, 0xf8, 0xed, 0xed, 0xe6, 0xed, 0xf8, 0xf8, 0xf8, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf2, 0xf0, 0xe9, 0x9a, 0xe2, 0x00, 0x1c, 0x68, 0x51, 0x47, 0x4c, 0x44, 0x53, 0x4a, 0x54, 0x4c, 0x2e, 0x52, 0x8d, 0x94, 0xe6, 0xf1, 0xf1, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xf0, 0xe9, 0xe9, 0xea, 0xef, 0xe9, 0xba, 0xb8, 0x9a, 0x92, 0x8c, 0x52, 0x2a, 0x59, 0x54, 0x54, 0x3a, 0x47, 0x54, 0x4f, 0x39, 0x1f, 0x8b, 0xf8, 0xf8, 0xf0, 0xe6, 0xee, 0xe9, 0xe9, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xba, 0xe8, 0xba, 0xe8, 0xed, 0xef, 0xf8, 0xf9, 0xef, 0xe6, 0xee, 0x91, 0x92, 0x90, 0x90, 0x92, 0x94, 0xf4, 0xe5, 0xab, 0x99, 0x00, 0x12, 0x48, 0x4b, 0x3f, 0x3d, 0x47, 0x3d, 0x3a, 0x3a, 0x37, 0x3a, 0x3a, 0x30, 0x3a, 0x30, 0x3c, 0x40, 0x40, 0x40, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x3d, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x4a, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3a, 0x4c, 0x43, 0x53, 0x30, 0x69, 0x31, 0x0d, 0x96, 0x0a, 0xec, 0xf3, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xed, 0xed, 0xe8, 0xe6, 0xb9, 0xb9, 0xb9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xf2, 0xed, 0xe6, 0xef, 0xe5, 0xf4, 0xd9, 0x09, 0x57, 0x56, 0x47, 0x47, 0x50, 0x50, 0x4f, 0x53, 0x4a, 0x4d, 0x26, 0x89, 0x92, 0xee, 0xed, 0xf1, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xea, 0xea, 0x9a, 0xe6, 0x94, 0x93, 0x89, 0x52, 0x23, 0x4f, 0x3c, 0x50, 0x47, 0x5d, 0x3a, 0x4d, 0x46, 0x8b, 0xfb, 0x95, 0xf0, 0xfb, 0xed, 0xee, 0xed, 0xed, 0xef, 0xf0, 0xe9, 0xee, 0xe9, 0xee, 0xe9, 0xe6, 0xed, 0xed, 0xf9, 0xf8, 0xed, 0xba, 0xb8, 0xe6, 0xe6, 0xf8, 0xff, 0xfd, 0xf4, 0xba, 0xab, 0x99, 0x00, 0x12, 0x78, 0x4f, 0x30, 0x3c, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x30, 0x3a, 0x3f, 0x3a, 0x3d, 0x37, 0x41, 0x47, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x47, 0x40, 0x40, 0x40, 0x47, 0x40, 0x47, 0x40, 0x47, 0x40, 0x47, 0x47, 0x40, 0x47, 0x41, 0x4c, 0x4c, 0x4c, 0x3a, 0x4c, 0x3a, 0x5d, 0x3a, 0x5e, 0x31, 0x0e, 0x00, 0x0a, 0xee, 0xf4, 0xe9, 0xed, 0xf8, 0xf8, 0xf1, 0xf8, 0xed, 0xe6, 0xe7, 0xb8, 0xb8, 0xb8, 0xb9, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xe9, 0xe5, 0xf4, 0x6d, 0x14, 0x57, 0x39, 0x4a, 0x47, 0x50, 0x50, 0x50, 0x58, 0x35, 0x21, 0x82, 0x92, 0xff, 0xe6, 0xf2, 0xf1, 0xf1, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xef, 0xed, 0xe9, 0xe9, 0xef, 0xf0, 0xea, 0xba, 0xea, 0xf0, 0xf0, 0xf0, 0xe9, 0x93, 0x8e, 0x77, 0x29, 0x2c, 0x33, 0x3a, 0x53, 0x42, 0x3e, 0x2f, 0x8b, 0xff, 0xf8, 0x95, 0xf4, 0xf3, 0xf3, 0xf2, 0xef, 0xed, 0xef, 0xed, 0xba, 0xed, 0xe9, 0xee, 0xed, 0xed, 0xf8, 0xed, 0xf8, 0xed, 0xe7, 0xe8, 0xea, 0xe8, 0xed, 0xe5, 0xf4, 0xfd, 0x0f, 0x99, 0x02, 0x1b, 0x76, 0x38, 0x38, 0x4a, 0x43, 0x3d, 0x47, 0x3d, 0x37, 0x3a, 0x37, 0x37, 0x3a, 0x37, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x40, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x47, 0x40, 0x40, 0x40, 0x40, 0x40, 0x47, 0x47, 0x40, 0x40, 0x3d, 0x4c, 0x3d, 0x3d, 0x4c, 0x3d, 0x3d, 0x47, 0x47, 0x40, 0x56, 0x6a, 0x13, 0x01, 0xf6, 0xee, 0xf2, 0xef, 0xf1, 0xf8, 0xf8, 0xf8, 0xed, 0xed, 0xe6, 0xb9, 0xb8, 0xb8, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xf2, 0xf3, 0xf3, 0x95, 0x91, 0x85, 0x31, 0x2e, 0x50, 0x4c, 0x4c, 0x4f, 0x55, 0x35, 0x26, 0x7e, 0x90, 0xff, 0xe6, 0x9a, 0xe9, 0xf8, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xed, 0xba, 0xe9, 0xf0, 0xee, 0xba, 0xba, 0xea, 0xf9, 0x94, 0xea, 0xb8, 0xff, 0x91, 0x93, 0x81, 0x2f, 0x28, 0x30, 0x3c, 0x56, 0x21, 0x64, 0x95, 0xeb, 0xf6, 0xc6, 0xd9, 0xdf, 0xec, 0xf2, 0xf4, 0xf4, 0xf3, 0xf2, 0xef, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xe9, 0xee, 0xf0, 0xee, 0xe6, 0xe7, 0xe5, 0xf2, 0xed, 0xfc, 0x99, 0x02, 0x13, 0x76, 0x34, 0x37, 0x37, 0x3c, 0x4c, 0x47, 0x51, 0x47, 0x3a, 0x37, 0x40, 0x40, 0x47, 0x40, 0x47, 0x3d, 0x47, 0x37, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x47, 0x40, 0x41, 0x40, 0x47, 0x40, 0x47, 0x40, 0x47, 0x47, 0x40, 0x40, 0x41, 0x40, 0x40, 0x3c, 0x40, 0x40, 0x40, 0x47, 0x38, 0x3c, 0x51, 0x54, 0x47, 0x42, 0x66, 0x17, 0x01, 0xf6, 0xf4, 0xf2, 0xee, 0xee, 0xe6, 0xe6, 0xe6, 0xed, 0xed, 0xf8, 0xf9, 0xf9, 0xf8, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf2, 0xf3, 0xf4, 0xf4, 0xef, 0xdf, 0xd9, 0xcc, 0x83, 0x8e, 0x52, 0x3e, 0x3f, 0x50, 0x53, 0x3c, 0x34, 0x3e, 0x7c, 0x90, 0xff, 0xba, 0xb9, 0xe8, 0x9a, 0xe6, 0xfb, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xb9, 0xb9, 0xb8, 0xe9, 0xf1, 0xef, 0xb9, 0xee, 0xf2, 0xe9, 0xba, 0xf0, 0xf9, 0xf9, 0xea, 0xe8, 0xf0, 0xfa, 0xf8, 0x94, 0x90, 0x86, 0x74, 0x2f, 0x20, 0x27, 0x86, 0x89, 0x65, 0x14, 0x0e, 0x06, 0x02, 0x01, 0x05, 0xf6, 0xc6, 0xdd, 0xe3, 0xf4, 0xf3, 0xed, 0xed, 0xba, 0xe9, 0x9a, 0xe5, 0xe9, 0xf8, 0xe6, 0xe9, 0xec, 0xf1, 0xf3, 0xed, 0x0f, 0x99, 0x02, 0x1d, 0x76, 0x3a, 0x30, 0x5d, 0x3d, 0x3a, 0x37, 0x47, 0x47, 0x40, 0x3a, 0x3c, 0x37, 0x3d, 0x47, 0x3d, 0x37, 0x40, 0x30, 0x3a, 0x2b, 0x3a, 0x38, 0x40, 0x37, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x37, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x41, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x40, 0x41, 0x3d, 0x3a, 0x3c, 0x40, 0x40, 0x47, 0x37, 0x3d, 0x47, 0x40, 0x47, 0x41, 0x37, 0x40, 0x40, 0x38, 0x38, 0x40, 0x59, 0x40, 0x37, 0x47, 0x47, 0x47, 0x47, 0x37, 0x51, 0x40, 0x4c, 0x3d, 0x4a, 0x47, 0x4a, 0x4a, 0x40, 0x47, 0x47, 0x41, 0x44, 0x76, 0x1d, 0x02, 0xfc, 0x95, 0xee, 0xf8, 0xed, 0xb9, 0xb8, 0xb9, 0xf8, 0xf9, 0xfe, 0xf1, 0xf1, 0xe6, 0xed, 0xe9, 0xf3, 0xf4, 0xe6, 0xdd, 0xc7, 0x0a, 0xa0, 0x99, 0x99, 0x97, 0x14, 0x8e, 0x88, 0x66, 0x26, 0x2a, 0x2e, 0x32, 0x74, 0x84, 0x90, 0x93, 0xee, 0xea, 0xea, 0xe6, 0xef, 0xff, 0xfb, 0xee, 0xee, 0xf0, 0xf8, 0xf0, 0xea, 0xb9, 0xe9, 0xe9, 0xf0, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xf1, 0xb9, 0xb8, 0xb8, 0xba, 0xfe, 0xf1, 0xf2, 0xe9, 0xba, 0xee, 0x9a, 0xee, 0xef, 0xf0, 0xf1, 0xef, 0xf1, 0xef, 0xf0, 0xfa, 0xfa, 0x94, 0x91, 0x8b, 0x85, 0x8b, 0x81, 0x2f, 0x46, 0x66, 0x45, 0x5a, 0x2f, 0x1b, 0x14, 0x06, 0x00, 0xbb, 0x05, 0xc2, 0xdf, 0xfb, 0xf3, 0xf3, 0xe3, 0xb9, 0xe9, 0xf0, 0xe9, 0xe6, 0xe5, 0xe9, 0xf1, 0xfb, 0x15, 0x99, 0x02, 0x17, 0x6c, 0x30, 0x41, 0x47, 0x41, 0x41, 0x41, 0x3d, 0x40, 0x37, 0x3d, 0x37, 0x30, 0x43, 0x30, 0x3a, 0x47, 0x3a, 0x30, 0x2d, 0x28, 0x28, 0x23, 0x28, 0x2b, 0x3c, 0x37, 0x3a, 0x3a, 0x34, 0x34, 0x3a, 0x3d, 0x47, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x40, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x47, 0x3d, 0x3a, 0x34, 0x40, 0x51, 0x40, 0x3d, 0x47, 0x47, 0x40, 0x40, 0x3a, 0x3c, 0x2b, 0x2d, 0x2d, 0x35, 0x28, 0x2b, 0x2b, 0x3a, 0x3d, 0x3d, 0x3d, 0x51, 0x40, 0x54, 0x47, 0x3d, 0x43, 0x3a, 0x40, 0x51, 0x47, 0x4a, 0x4c, 0x3a, 0x4a, 0x4a, 0x34, 0x5a, 0x1d, 0x03, 0x15, 0xf4, 0xfa, 0xf9, 0xe5, 0xb8, 0x9a, 0xec, 0xff, 0xf8, 0xe8, 0xe5, 0xf3, 0xf3, 0x9a, 0xdd, 0xc6, 0xa3, 0x98, 0x99, 0x03, 0x0b, 0x1b, 0x27, 0x4e, 0x52, 0x7c, 0x8c, 0x88, 0x77, 0x64, 0x80, 0x86, 0x92, 0x94, 0x91, 0xf8, 0xef, 0xef, 0xef, 0xf2, 0xf0, 0xfa, 0xee, 0xe6, 0xee, 0xff, 0xf9, 0xef, 0xba, 0xb9, 0xb9, 0xed, 0xf1, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf1, 0xfa, 0x95, 0xf4, 0x9a, 0xf2, 0xf1, 0xf9, 0xf8, 0xf0, 0xe9, 0xba, 0xe8, 0xb9, 0xba, 0xe9, 0xef, 0xf0, 0xef, 0xea, 0xef, 0xe9, 0xfa, 0xf8, 0x94, 0x93, 0x93, 0x94, 0x64, 0x2a, 0x3f, 0x2b, 0x58, 0x49, 0x4d, 0x5a, 0x5a, 0x6e, 0x57, 0x1d, 0x0d, 0x04, 0x96, 0xf5, 0x25, 0xe6, 0xf4, 0xb9, 0xe7, 0xe5, 0xed, 0xba, 0xfb, 0xfa, 0xf4, 0xc2, 0x99, 0x00, 0x1b, 0x76, 0x34, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x37, 0x3d, 0x37, 0x40, 0x3d, 0x3d, 0x37, 0x3a, 0x3a, 0x34, 0x23, 0x2c, 0x6e, 0x80, 0x88, 0x82, 0x80, 0x46, 0x23, 0x28, 0x30, 0x30, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x37, 0x40, 0x3d, 0x37, 0x3d, 0x41, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x41, 0x3d, 0x47, 0x3a, 0x3f, 0x40, 0x51, 0x40, 0x3a, 0x41, 0x47, 0x51, 0x34, 0x2e, 0x32, 0x74, 0x86, 0x8a, 0x8a, 0x86, 0x82, 0x45, 0x2a, 0x2d, 0x3a, 0x40, 0x40, 0x51, 0x47, 0x47, 0x3a, 0x3a, 0x3c, 0x40, 0x47, 0x4a, 0x3d, 0x3a, 0x4c, 0x47, 0x51, 0x4a, 0x39, 0x6c, 0x1d, 0x03, 0x25, 0xf3, 0xea, 0xf1, 0xe6, 0xe6, 0xe6, 0xba, 0xe7, 0xf3, 0xf3, 0xdf, 0xbf, 0xa1, 0x99, 0x00, 0x0b, 0x1a, 0x32, 0x6b, 0x78, 0x4d, 0x2d, 0x2d, 0x28, 0x26, 0x77, 0x90, 0x94, 0x95, 0x91, 0x94, 0xfb, 0xe6, 0xe6, 0xba, 0xe8, 0xba, 0xea, 0xba, 0xe9, 0xef, 0x9a, 0x9a, 0xe6, 0xea, 0xf1, 0xed, 0xf0, 0xee, 0xe6, 0xf3, 0xea, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf0, 0xf9, 0x6d, 0x3b, 0x83, 0xf8, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xea, 0xe9, 0xba, 0xba, 0xba, 0xea, 0xba, 0xe8, 0xe9, 0xef, 0xfb, 0xf8, 0x91, 0x95, 0x8a, 0x48, 0x2d, 0x42, 0x4f, 0x42, 0x34, 0x39, 0x4b, 0x39, 0x67, 0x4d, 0x6e, 0x2f, 0x27, 0x13, 0x08, 0x08, 0x25, 0xf7, 0xf4, 0xf8, 0xf8, 0xf8, 0xfe, 0xf4, 0xd9, 0x96, 0x00, 0x17, 0x76, 0x2b, 0x4f, 0x37, 0x40, 0x3d, 0x3d, 0x3d, 0x41, 0x37, 0x41, 0x40, 0x3d, 0x37, 0x54, 0x37, 0x3d, 0x39, 0x26, 0x66, 0x8c, 0x8f, 0x92, 0x92, 0x93, 0x93, 0x8f, 0x82, 0x2c, 0x2d, 0x37, 0x40, 0x47, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x41, 0x40, 0x37, 0x41, 0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41, 0x41, 0x3d, 0x47, 0x3a, 0x3a, 0x40, 0x51, 0x37, 0x3d, 0x3d, 0x54, 0x43, 0x23, 0x57, 0x8c, 0x90, 0xff, 0x9a, 0x9a, 0x9a, 0x93, 0x8e, 0x80, 0x26, 0x2e, 0x43, 0x38, 0x47, 0x40, 0x3d, 0x3d, 0x3a, 0x3d, 0x40, 0x40, 0x40, 0x3c, 0x3c, 0x3a, 0x47, 0x40, 0x51, 0x4a, 0x33, 0x5c, 0x1d, 0x04, 0x3b, 0xf3, 0xed, 0xf9, 0xf9, 0xe6, 0xb9, 0x9a, 0xd9, 0x0a, 0x97, 0x03, 0x0b, 0x1f, 0x2f, 0x57, 0x5a, 0x33, 0x33, 0x38, 0x30, 0x47, 0x51, 0x33, 0x26, 0x77, 0xff, 0xb8, 0x9a, 0xf8, 0xfb, 0xba, 0xba, 0xba, 0xe8, 0xe7, 0xea, 0xe8, 0xea, 0xea, 0xea, 0xe6, 0xe8, 0xe8, 0xe7, 0xe8, 0xe6, 0xfb, 0x95, 0x95, 0xec, 0xdf, 0xe6, 0xef, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf0, 0x94, 0x6d, 0x10, 0x0d, 0x0b, 0xfc, 0xcc, 0xde, 0xf2, 0xf3, 0xf3, 0xf1, 0xf9, 0xf1, 0xef, 0xba, 0xb9, 0xe8, 0xba, 0xe8, 0xba, 0xe8, 0xba, 0xef, 0xee, 0xff, 0xe6, 0x93, 0x88, 0x24, 0x2c, 0x35, 0x33, 0x55, 0x55, 0x49, 0x44, 0x49, 0x49, 0x42, 0x4d, 0x6b, 0x6e, 0x74, 0x36, 0x19, 0x11, 0x7f, 0xfa, 0xf8, 0xf0, 0xf4, 0x7d, 0x05, 0x00, 0x11, 0x57, 0x34, 0x5d, 0x37, 0x47, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x47, 0x47, 0x44, 0x23, 0x7c, 0x8e, 0x93, 0x95, 0xf1, 0xe6, 0xe9, 0x9a, 0xfd, 0x93, 0x88, 0x32, 0x2b, 0x40, 0x40, 0x47, 0x3d, 0x3a, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x47, 0x3d, 0x37, 0x40, 0x47, 0x4c, 0x3a, 0x3d, 0x37, 0x28, 0x6e, 0x8e, 0x92, 0x91, 0xba, 0xb8, 0xb8, 0xb9, 0xf8, 0x91, 0x90, 0x84, 0x3e, 0x28, 0x37, 0x40, 0x47, 0x3d, 0x3a, 0x3c, 0x37, 0x37, 0x40, 0x40, 0x40, 0x3a, 0x3a, 0x3d, 0x51, 0x47, 0x51, 0x40, 0x3f, 0x6c, 0x1b, 0x04, 0xe2, 0xfb, 0xf9, 0xfe, 0xf4, 0xdd, 0x0a, 0x01, 0x0d, 0x1f, 0x2f, 0x57, 0x5a, 0x35, 0x33, 0x33, 0x2d, 0x39, 0x2e, 0x44, 0x30, 0x30, 0x28, 0x57, 0x8f, 0x95, 0xb8, 0xe8, 0xfe, 0xf9, 0xee, 0xe9, 0xe6, 0xf8, 0xf2, 0xf1, 0xf1, 0xf1, 0xef, 0xef, 0xf2, 0xf9, 0xe7, 0xe7, 0xf4, 0xf4, 0xf7, 0x65, 0x15, 0x08, 0xf6, 0xfd, 0xf2, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xe9, 0xee, 0x94, 0x64, 0x27, 0x1d, 0x13, 0x04, 0x97, 0x05, 0x0f, 0xd9, 0xec, 0xf3, 0xf3, 0xf2, 0xed, 0xf0, 0xba, 0xea, 0xe9, 0xea, 0xba, 0xe7, 0xf2, 0xe6, 0xf2, 0xee, 0xff, 0x95, 0x87, 0x36, 0x26, 0x35, 0x2b, 0x3f, 0x55, 0x44, 0x4b, 0x44, 0x49, 0x44, 0x39, 0x4d, 0x4b, 0x48, 0x7b, 0x64, 0x1e, 0x7f, 0xf3, 0xe9, 0xf3, 0xa6, 0x99, 0x10, 0x66, 0x2e, 0x3c, 0x3d, 0x54, 0x47, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x40, 0x4a, 0x28, 0x74, 0x8e, 0x94, 0xee, 0xe8, 0xea, 0xea, 0xe8, 0xb8, 0x9a, 0x91, 0x92, 0x80, 0x3e, 0x30, 0x40, 0x3d, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x47, 0x3d, 0x3d, 0x47, 0x51, 0x37, 0x30, 0x53, 0x30, 0x3e, 0x89, 0x93, 0xf0, 0xff, 0xf0, 0xef, 0xed, 0xf1, 0xf0, 0xff, 0x95, 0x8f, 0x80, 0x23, 0x50, 0x47, 0x37, 0x3a, 0x3a, 0x40, 0x40, 0x37, 0x40, 0x40, 0x40, 0x3c, 0x3a, 0x41, 0x47, 0x54, 0x47, 0x40, 0x51, 0x2b, 0x66, 0x1b, 0x08, 0xf7, 0xf9, 0xff, 0x7f, 0x0b, 0x19, 0x2f, 0x74, 0x45, 0x3e, 0x35, 0x34, 0x30, 0x4f, 0x44, 0x2e, 0x4b, 0x28, 0x2e, 0x2e, 0x26, 0x46, 0x8c, 0x93, 0xf8, 0xed, 0xed, 0xf1, 0xf9, 0xf0, 0xf8, 0xfb, 0xf9, 0xf9, 0xf9, 0xf1, 0xf1, 0xef, 0xef, 0xfa, 0xfb, 0xf3, 0xe5, 0xcc, 0x0f, 0x03, 0x07, 0x0d, 0x19, 0x65, 0x95, 0xe9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xba, 0xb9, 0x95, 0x84, 0x21, 0x2c, 0x2c, 0x2f, 0x16, 0x0b, 0x96, 0x99, 0xa3, 0xb5, 0xe0, 0xf3, 0xf3, 0xf9, 0xf8, 0xe6, 0xea, 0xe6, 0xe7, 0xf2, 0xea, 0xe9, 0xef, 0xee, 0xee, 0xe6, 0x94, 0x8a, 0x74, 0x32, 0x28, 0x33, 0x42, 0x63, 0x50, 0x39, 0x44, 0x4b, 0x49, 0x58, 0x56, 0x55, 0x45, 0x57, 0x65, 0x83, 0xee, 0xba, 0xd9, 0x99, 0x07, 0x66, 0x4b, 0x30, 0x3d, 0x3d, 0x47, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x37, 0x2d, 0x2c, 0x86, 0x93, 0x95, 0xba, 0xba, 0x9a, 0xea, 0x9a, 0xe7, 0xf3, 0xed, 0x94, 0x8e, 0x66, 0x23, 0x4c, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x41, 0x37, 0x51, 0x3d, 0x3a, 0x3a, 0x40, 0x2b, 0x6c, 0x90, 0xee, 0xe9, 0xef, 0xf9, 0xf9, 0xf9, 0xf9, 0xf0, 0xf2, 0xba, 0x94, 0x8c, 0x2c, 0x38, 0x37, 0x3a, 0x3a, 0x37, 0x40, 0x47, 0x37, 0x47, 0x40, 0x40, 0x3d, 0x3a, 0x3a, 0x3d, 0x47, 0x47, 0x3d, 0x47, 0x30, 0x44, 0x57, 0x12, 0x15, 0x95, 0xfe, 0x85, 0x52, 0x57, 0x45, 0x2e, 0x39, 0x39, 0x42, 0x39, 0x34, 0x34, 0x44, 0x3a, 0x44, 0x44, 0x28, 0x21, 0x52, 0x8c, 0x92, 0xfe, 0xf0, 0xed, 0xea, 0xb9, 0xe9, 0xfb, 0xf8, 0xfb, 0xf9, 0xf8, 0xf1, 0xed, 0xf2, 0xf3, 0xf4, 0xf4, 0x7d, 0xbf, 0x05, 0x96, 0x06, 0x12, 0x20, 0x27, 0x27, 0x8d, 0x94, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xba, 0xb9, 0xff, 0x92, 0x74, 0x23, 0x28, 0x3a, 0x56, 0x3e, 0x24, 0x10, 0x01, 0x99, 0x99, 0xa3, 0xce, 0xec, 0xf4, 0xf3, 0xf8, 0xed, 0xf2, 0xed, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xff, 0x93, 0x90, 0x8c, 0x7c, 0x57, 0x32, 0x28, 0x33, 0x56, 0x3e, 0x4b, 0x49, 0x5f, 0x54, 0x54, 0x5f, 0x60, 0x52, 0x89, 0xf8, 0xee, 0xa6, 0x03, 0x27, 0x63, 0x37, 0x47, 0x3a, 0x3a, 0x3a, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x43, 0x2e, 0x5b, 0x8f, 0xff, 0xba, 0xb9, 0x9a, 0xf0, 0x95, 0xff, 0xfa, 0xf0, 0xea, 0xfb, 0x93, 0x7e, 0x2a, 0x30, 0x3d, 0x3d, 0x37, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x37, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x40, 0x47, 0x41, 0x3a, 0x3a, 0x40, 0x33, 0x80, 0x93, 0xb9, 0xb9, 0xe9, 0xe9, 0xf0, 0xf0, 0xf2, 0xef, 0xba, 0xb9, 0x95, 0x8e, 0x66, 0x30, 0x37, 0x3d, 0x43, 0x3c, 0x51, 0x40, 0x3d, 0x37, 0x47, 0x40, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x47, 0x34, 0x66, 0x10, 0x3b, 0xf4, 0x81, 0x32, 0x61, 0x43, 0x55, 0x42, 0x34, 0x34, 0x34, 0x34, 0x42, 0x34, 0x28, 0x2b, 0x28, 0x57, 0x84, 0x8e, 0x94, 0xf8, 0xf8, 0xf0, 0xed, 0xb9, 0xb8, 0xb8, 0xe7, 0xea, 0xe6, 0xe8, 0xe9, 0xb9, 0xf3, 0x9a, 0xf7, 0xc7, 0xf5, 0x96, 0x97, 0x09, 0x1a, 0x2e, 0x69, 0x4b, 0x20, 0x85, 0x93, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xb9, 0x9a, 0x93, 0x8e, 0x21, 0x28, 0x30, 0x4f, 0x55, 0x4b, 0x66, 0x27, 0x10, 0x03, 0x99, 0x99, 0xa3, 0xeb, 0xec, 0xf4, 0xf2, 0xe9, 0xed, 0xe9, 0xef, 0xe9, 0xf0, 0xef, 0xf2, 0xfb, 0xf8, 0x91, 0x91, 0x92, 0x8d, 0x84, 0x74, 0x48, 0x32, 0x2a, 0x2a, 0x35, 0x58, 0x59, 0x59, 0x70, 0x61, 0x2f, 0x8c, 0x93, 0xe2, 0x08, 0x1b, 0x5c, 0x30, 0x47, 0x3d, 0x3a, 0x3a, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x3d, 0x30, 0x2a, 0x7b, 0x90, 0xee, 0x9a, 0xba, 0x9a, 0x95, 0xff, 0x94, 0x94, 0xf1, 0xf2, 0xe8, 0x93, 0x82, 0x2c, 0x3a, 0x3d, 0x41, 0x30, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x37, 0x40, 0x40, 0x40, 0x3d, 0x41, 0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x3a, 0x40, 0x40, 0x51, 0x3d, 0x3a, 0x3a, 0x38, 0x42, 0x82, 0x94, 0xba, 0xb9, 0xba, 0xba, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xee, 0x90, 0x6e, 0x2b, 0x3d, 0x3a, 0x34, 0x40, 0x40, 0x51, 0x3a, 0x3d, 0x40, 0x40, 0x40, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x47, 0x37, 0x49, 0x27, 0x19, 0x92, 0x87, 0x29, 0x56, 0x4f, 0x42, 0x39, 0x42, 0x34, 0x42, 0x33, 0x2a, 0x2a, 0x46, 0x7b, 0x84, 0x8e, 0x90, 0xff, 0xee, 0x9a, 0xe9, 0xf8, 0xf0, 0xee, 0xb9, 0xb9, 0xba, 0xb9, 0xb8, 0xb8, 0x9a, 0xf4, 0xe2, 0x15, 0x05, 0x99, 0x00, 0x09, 0x1b, 0x31, 0x4b, 0x4f, 0x30, 0x2e, 0x2f, 0x8d, 0xff, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xea, 0xee, 0x94, 0x82, 0x23, 0x42, 0x30, 0x3c, 0x4a, 0x40, 0x71, 0x78, 0x31, 0x13, 0x03, 0x99, 0x99, 0xa3, 0xeb, 0xee, 0xf4, 0xea, 0xea, 0xe9, 0xe9, 0xef, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xba, 0xe6, 0x9a, 0x94, 0x93, 0x8f, 0x86, 0x80, 0x74, 0x4e, 0x46, 0x32, 0x3e, 0x2a, 0x31, 0x7c, 0x90, 0x91, 0x65, 0x19, 0x48, 0x39, 0x37, 0x3d, 0x3d, 0x3a, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x40, 0x37, 0x3d, 0x3d, 0x3a, 0x28, 0x80, 0x90, 0xfa, 0xf2, 0xb9, 0xf2, 0xee, 0xfb, 0xf0, 0xff, 0xf8, 0xf2, 0xea, 0x93, 0x82, 0x28, 0x3d, 0x3d, 0x41, 0x30, 0x41, 0x41, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x41, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x41, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3c, 0x3a, 0x40, 0x47, 0x3d, 0x44, 0x3a, 0x40, 0x2d, 0x84, 0x95, 0xee, 0xe9, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xba, 0xba, 0xe9, 0xf2, 0x93, 0x7a, 0x2b, 0x47, 0x3a, 0x3a, 0x38, 0x51, 0x51, 0x3a, 0x3a, 0x3c, 0x3d, 0x40, 0x40, 0x40, 0x3c, 0x3a, 0x3a, 0x3d, 0x41, 0x3d, 0x47, 0x41, 0x3c, 0x3e, 0x20, 0x83, 0x8d, 0x27, 0x31, 0x4f, 0x2e, 0x2a, 0x2a, 0x2a, 0x48, 0x57, 0x7c, 0x86, 0x8d, 0x93, 0x94, 0xfa, 0xf0, 0xe6, 0xba, 0xe7, 0xba, 0xee, 0xf0, 0xfa, 0xf9, 0xf8, 0xe8, 0xe9, 0xba, 0xf4, 0xe2, 0x0f, 0x00, 0x99, 0x03, 0x0e, 0x24, 0x52, 0x6a, 0x56, 0x38, 0x4c, 0x49, 0x26, 0x84, 0x93, 0xf0, 0xe6, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xfa, 0xf9, 0xe8, 0xe8, 0xea, 0x8f, 0x7c, 0x28, 0x49, 0x4f, 0x47, 0x53, 0x54, 0x3a, 0x5e, 0x66, 0x46, 0x10, 0x03, 0x99, 0x99, 0xa6, 0xd9, 0xf4, 0xea, 0xba, 0xe9, 0xe9, 0xe9, 0xf2, 0xe6, 0xef, 0xfb, 0xe9, 0xf2, 0xba, 0xe6, 0xee, 0xfa, 0x93, 0x92, 0x90, 0x90, 0x8b, 0x87, 0x85, 0x81, 0x85, 0xfe, 0x95, 0xf8, 0x85, 0x74, 0x2d, 0x2b, 0x3a, 0x3a, 0x3a, 0x37, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x2d, 0x7b, 0x8f, 0xfb, 0xea, 0xea, 0xba, 0xf2, 0xea, 0xea, 0xff, 0xba, 0xba, 0xea, 0x92, 0x80, 0x2b, 0x47, 0x47, 0x4a, 0x3c, 0x40, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x37, 0x3d, 0x40, 0x3d, 0x41, 0x40, 0x41, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x3a, 0x3c, 0x47, 0x47, 0x3a, 0x3a, 0x30, 0x51, 0x2d, 0x82, 0x95, 0xed, 0xee, 0xf0, 0xee, 0xfb, 0xee, 0xfb, 0xf0, 0xf0, 0xe9, 0xfb, 0xfe, 0x57, 0x38, 0x47, 0x3a, 0x43, 0x38, 0x51, 0x51, 0x3a, 0x3f, 0x3a, 0x3c, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x40, 0x47, 0x47, 0x41, 0x3a, 0x4c, 0x38, 0x2d, 0x57, 0x8c, 0x91, 0x65, 0x4e, 0x5c, 0x45, 0x6e, 0x7c, 0x82, 0x8a, 0x90, 0x93, 0xfb, 0xf0, 0xed, 0xed, 0xe8, 0xf2, 0xf1, 0xf8, 0xee, 0xba, 0xb9, 0xe9, 0xed, 0xf9, 0xf9, 0xf0, 0xf3, 0xee, 0xc7, 0xa1, 0x99, 0x03, 0x12, 0x29, 0x48, 0x60, 0x4f, 0x38, 0x4a, 0x53, 0x56, 0x26, 0x77, 0x90, 0xfe, 0xf9, 0xf1, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xfa, 0xed, 0xea, 0xf2, 0xff, 0x90, 0x46, 0x39, 0x2d, 0x55, 0x4c, 0x53, 0x54, 0x4c, 0x4f, 0x67, 0x76, 0x52, 0x10, 0x02, 0x99, 0x9b, 0xbf, 0xb8, 0xf3, 0xf2, 0xf8, 0xf0, 0xe9, 0xf2, 0xf8, 0xea, 0xe8, 0xb9, 0xb8, 0xb9, 0xf0, 0xfa, 0xf9, 0xf9, 0xfa, 0xfb, 0x95, 0x95, 0x94, 0x94, 0x94, 0xff, 0xef, 0xfb, 0x8b, 0x81, 0x6e, 0x28, 0x2b, 0x3a, 0x37, 0x47, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x3d, 0x3a, 0x2e, 0x57, 0x8f, 0xfe, 0xea, 0xe8, 0xba, 0xea, 0xef, 0xfb, 0xf1, 0xed, 0xea, 0xee, 0x90, 0x7b, 0x28, 0x47, 0x47, 0x37, 0x3c, 0x3d, 0x41, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x41, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x41, 0x37, 0x41, 0x37, 0x41, 0x37, 0x41, 0x37, 0x41, 0x37, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x4a, 0x28, 0x80, 0x92, 0xee, 0xf0, 0xf2, 0xee, 0xf0, 0xf8, 0xfb, 0xf0, 0xf8, 0xf0, 0x94, 0x8c, 0x32, 0x30, 0x40, 0x47, 0x37, 0x41, 0x40, 0x40, 0x41, 0x3d, 0x40, 0x40, 0x40, 0x41, 0x3d, 0x3d, 0x4c, 0x3d, 0x3d, 0x40, 0x37, 0x4c, 0x30, 0x2b, 0x3e, 0x80, 0x90, 0x94, 0x94, 0x8d, 0x8a, 0x8e, 0x8f, 0x92, 0x93, 0x93, 0xff, 0xf0, 0xf0, 0xed, 0xed, 0xea, 0xf1, 0xed, 0xf9, 0xfa, 0xfa, 0xe9, 0xe5, 0xba, 0xe5, 0xba, 0xf2, 0x95, 0xdd, 0xf5, 0x99, 0x00, 0x13, 0x29, 0x6c, 0x35, 0x49, 0x39, 0x42, 0x5f, 0x51, 0x4f, 0x28, 0x2f, 0x8f, 0x95, 0xf8, 0xf1, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xed, 0xed, 0xef, 0xf0, 0xf2, 0xef, 0xef, 0x8c, 0x45, 0x2e, 0x39, 0x50, 0x3d, 0x53, 0x53, 0x4f, 0x62, 0x58, 0x56, 0x76, 0x46, 0x0b, 0x97, 0x99, 0xa3, 0xdf, 0xf3, 0xf1, 0xf8, 0xf8, 0xf8, 0xf9, 0xfb, 0xed, 0xba, 0xb9, 0xba, 0xf0, 0xfa, 0xf0, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xe9, 0xef, 0xef, 0xf0, 0xf1, 0xfb, 0xfa, 0x85, 0x82, 0x7a, 0x23, 0x30, 0x3d, 0x37, 0x30, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x47, 0x2b, 0x39, 0x2c, 0x8c, 0x92, 0xf0, 0xba, 0xe7, 0xba, 0xfb, 0xfa, 0xf9, 0xf3, 0xf8, 0x95, 0x89, 0x31, 0x34, 0x51, 0x47, 0x3d, 0x3a, 0x3d, 0x40, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x40, 0x41, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x37, 0x3a, 0x3a, 0x3d, 0x54, 0x40, 0x4a, 0x28, 0x45, 0x8e, 0x95, 0xba, 0xee, 0xe9, 0xf2, 0xe9, 0xed, 0xe6, 0xf3, 0xf3, 0x8f, 0x7b, 0x2a, 0x30, 0x51, 0x47, 0x47, 0x3d, 0x3a, 0x3d, 0x47, 0x40, 0x51, 0x40, 0x40, 0x3d, 0x3d, 0x37, 0x37, 0x37, 0x3a, 0x3d, 0x47, 0x30, 0x30, 0x6f, 0x6e, 0x81, 0x93, 0xff, 0xf0, 0x95, 0xf9, 0xfb, 0xf1, 0xf0, 0xf1, 0xef, 0xf0, 0xef, 0xef, 0xe9, 0xef, 0xe9, 0xf1, 0xed, 0xed, 0xee, 0xe9, 0xf0, 0xf2, 0xe5, 0x9a, 0x9a, 0xec, 0x15, 0x99, 0x00, 0x0d, 0x24, 0x45, 0x5e, 0x3f, 0x3c, 0x4f, 0x44, 0x39, 0x50, 0x4f, 0x2d, 0x45, 0x89, 0x94, 0xe6, 0xe6, 0xf1, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xed, 0xef, 0xef, 0xf0, 0x92, 0x86, 0x29, 0x42, 0x4a, 0x70, 0x53, 0x50, 0x55, 0x4f, 0x5f, 0x58, 0x3f, 0x75, 0x78, 0x24, 0x06, 0x99, 0x99, 0xcc, 0xf4, 0xf2, 0xee, 0x94, 0xf9, 0xfe, 0xfb, 0xfa, 0xee, 0xee, 0xba, 0xe8, 0xba, 0xe9, 0xee, 0xe9, 0xba, 0xe9, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xe9, 0x95, 0xfe, 0x79, 0x80, 0x5e, 0x2b, 0x30, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x3d, 0x47, 0x4c, 0x28, 0x7b, 0x8e, 0x94, 0xf2, 0xea, 0xe8, 0xea, 0xf2, 0xf2, 0xf1, 0x91, 0x90, 0x80, 0x2e, 0x38, 0x47, 0x47, 0x3d, 0x3a, 0x40, 0x41, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x40, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x40, 0x37, 0x3a, 0x30, 0x3a, 0x47, 0x47, 0x40, 0x2d, 0x2c, 0x88, 0x94, 0x9a, 0xee, 0xba, 0xba, 0xba, 0x9a, 0xe9, 0xff, 0x9a, 0x89, 0x45, 0x28, 0x3c, 0x51, 0x40, 0x47, 0x3a, 0x3a, 0x3d, 0x40, 0x51, 0x37, 0x47, 0x40, 0x3d, 0x3d, 0x3d, 0x37, 0x37, 0x3d, 0x4c, 0x3d, 0x2b, 0x71, 0x76, 0x74, 0x8e, 0x91, 0x9a, 0xee, 0xf0, 0xfa, 0xba, 0xba, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xef, 0xfa, 0xed, 0xb9, 0xb8, 0xb8, 0xe6, 0xf9, 0xf9, 0xfb, 0xe2, 0xf5, 0x99, 0x06, 0x1d, 0x5a, 0x5e, 0x50, 0x3c, 0x3d, 0x59, 0x4a, 0x4a, 0x4f, 0x58, 0x39, 0x31, 0x84, 0x93, 0xee, 0xb9, 0xe9, 0xed, 0xf1, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf8, 0xed, 0xf0, 0xf2, 0xfb, 0x93, 0x8c, 0x32, 0x4d, 0x38, 0x4f, 0x50, 0x50, 0x53, 0x59, 0x53, 0x70, 0x51, 0x5f, 0x75, 0x76, 0x17, 0x03, 0x99, 0xab, 0x9a, 0xb9, 0xb8, 0xba, 0xfb, 0xfa, 0xfe, 0xee, 0xba, 0xb8, 0xb8, 0xe7, 0xef, 0xfa, 0xee, 0xf0, 0xee, 0xba, 0xe9, 0xb9, 0xba, 0xb9, 0xb9, 0xf1, 0x94, 0x87, 0x74, 0x80, 0x5e, 0x2b, 0x37, 0x3d, 0x30, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x37, 0x3d, 0x47, 0x37, 0x30, 0x2a, 0x80, 0x8e, 0x92, 0x94, 0xf3, 0xfb, 0xf1, 0xee, 0x91, 0x8f, 0x80, 0x28, 0x38, 0x47, 0x51, 0x47, 0x3d, 0x3a, 0x3d, 0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x41, 0x41, 0x41, 0x40, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x37, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x37, 0x3f, 0x39, 0x45, 0x82, 0x8f, 0x93, 0x9a, 0xb9, 0x9a, 0xb9, 0x91, 0x92, 0x88, 0x52, 0x28, 0x34, 0x38, 0x37, 0x47, 0x3d, 0x3a, 0x3c, 0x37, 0x51, 0x40, 0x40, 0x40, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x4c, 0x3d, 0x30, 0x30, 0x71, 0x78, 0x46, 0x81, 0x93, 0xee, 0xe7, 0xb9, 0xe9, 0xf2, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xba, 0xba, 0xee, 0xef, 0xef, 0xf0, 0xf9, 0xef, 0xb8, 0xb8, 0xb8, 0xea, 0xfe, 0xfb, 0x7f, 0x01, 0x00, 0x13, 0x57, 0x35, 0x4a, 0x51, 0x47, 0x41, 0x53, 0x4c, 0x51, 0x51, 0x4f, 0x2d, 0x31, 0x89, 0x93, 0xe6, 0xb8, 0xba, 0xe9, 0xf8, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xe6, 0xfb, 0x92, 0x89, 0x48, 0x35, 0x3f, 0x4f, 0x53, 0x53, 0x53, 0x62, 0x4c, 0x62, 0x62, 0x4f, 0x67, 0x7a, 0x27, 0x07, 0x99, 0xf6, 0xb9, 0xb8, 0xb8, 0xe7, 0xf8, 0xfb, 0xfa, 0xba, 0xb9, 0xe8, 0xea, 0xfa, 0xfa, 0xfa, 0xfa, 0xf0, 0xfa, 0xee, 0xf0, 0xf0, 0xee, 0xea, 0xea, 0xf0, 0x92, 0x81, 0x7b, 0x7a, 0x49, 0x2b, 0x30, 0x47, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x54, 0x54, 0x53, 0x2b, 0x2c, 0x74, 0x8c, 0x8e, 0x92, 0x93, 0x93, 0x93, 0x8e, 0x74, 0x2e, 0x30, 0x51, 0x47, 0x47, 0x3d, 0x3d, 0x3a, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x37, 0x3c, 0x30, 0x3a, 0x3a, 0x37, 0x3d, 0x3d, 0x43, 0x28, 0x4b, 0x80, 0x8c, 0x90, 0x94, 0x95, 0x93, 0x8e, 0x80, 0x60, 0x28, 0x34, 0x3c, 0x40, 0x37, 0x3d, 0x3d, 0x3a, 0x3c, 0x40, 0x40, 0x40, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3a, 0x37, 0x30, 0x37, 0x63, 0x78, 0x6c, 0x74, 0x8e, 0x91, 0xba, 0xb8, 0xe8, 0xea, 0xe9, 0xba, 0xba, 0xba, 0xe9, 0xee, 0xf0, 0xef, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xee, 0xee, 0xb8, 0xba, 0xf2, 0xe2, 0x08, 0x01, 0x1d, 0x46, 0x3e, 0x42, 0x38, 0x54, 0x47, 0x53, 0x50, 0x4c, 0x4a, 0x59, 0x33, 0x57, 0x84, 0x94, 0x9a, 0xb9, 0xb9, 0xe7, 0xed, 0xf0, 0xef, 0xef, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xea, 0xea, 0xf0, 0x93, 0x8f, 0x5b, 0x32, 0x33, 0x62, 0x62, 0x50, 0x50, 0x55, 0x44, 0x44, 0x71, 0x43, 0x55, 0x60, 0x80, 0x14, 0x97, 0x0f, 0xf4, 0xba, 0xea, 0xf1, 0xf9, 0xf9, 0xfa, 0xf1, 0xf9, 0xf9, 0xf1, 0xf1, 0xf1, 0xfa, 0xf1, 0xfb, 0xfa, 0xfa, 0xf8, 0xfa, 0xed, 0xe8, 0xed, 0x94, 0x8d, 0x77, 0x7b, 0x7a, 0x49, 0x2b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x37, 0x47, 0x51, 0x38, 0x3a, 0x39, 0x23, 0x26, 0x46, 0x7b, 0x7b, 0x7c, 0x52, 0x24, 0x28, 0x30, 0x51, 0x47, 0x3d, 0x3a, 0x3a, 0x3d, 0x47, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x41, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x40, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x37, 0x47, 0x37, 0x37, 0x53, 0x37, 0x2b, 0x2e, 0x6e, 0x7b, 0x7c, 0x6e, 0x48, 0x2b, 0x30, 0x40, 0x40, 0x37, 0x40, 0x41, 0x3d, 0x3c, 0x3a, 0x3c, 0x38, 0x51, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3a, 0x53, 0x30, 0x3c, 0x73, 0x78, 0x78, 0x57, 0x84, 0x92, 0xf8, 0xe8, 0xba, 0xea, 0xe9, 0xe6, 0xfa, 0xf0, 0xfa, 0xfb, 0xfa, 0xf1, 0xfa, 0xf9, 0xf1, 0xf9, 0xf1, 0xed, 0xf1, 0xfe, 0xfa, 0xef, 0xe5, 0xb9, 0x08, 0x04, 0x46, 0x5a, 0x34, 0x3f, 0x30, 0x50, 0x4c, 0x43, 0x44, 0x34, 0x49, 0x49, 0x2e, 0x6e, 0x8c, 0x93, 0xba, 0xe7, 0xe7, 0xea, 0xed, 0xf0, 0xe9, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xea, 0xe8, 0xe9, 0xff, 0x93, 0x8f, 0x82, 0x26, 0x2e, 0x42, 0x4f, 0x62, 0x4f, 0x62, 0x55, 0x50, 0x53, 0x62, 0x55, 0x4b, 0x7a, 0x1a, 0x09, 0xfd, 0xf7, 0xe3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf1, 0xf9, 0xf9, 0xf2, 0xe7, 0xe8, 0xe8, 0xf2, 0xed, 0xf1, 0xf1, 0xf1, 0xfa, 0xf1, 0xe8, 0xea, 0xf9, 0x93, 0x85, 0x64, 0x7a, 0x76, 0x42, 0x2b, 0x30, 0x30, 0x37, 0x37, 0x37, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x40, 0x40, 0x37, 0x3a, 0x3a, 0x2b, 0x2e, 0x28, 0x28, 0x2a, 0x2e, 0x34, 0x40, 0x51, 0x47, 0x3d, 0x3a, 0x44, 0x3a, 0x3d, 0x47, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x37, 0x40, 0x40, 0x40, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x47, 0x3d, 0x3d, 0x3a, 0x3f, 0x34, 0x34, 0x2d, 0x33, 0x33, 0x30, 0x3c, 0x3a, 0x47, 0x40, 0x47, 0x40, 0x41, 0x3d, 0x3a, 0x3c, 0x3c, 0x40, 0x40, 0x40, 0x3d, 0x41, 0x3d, 0x37, 0x3d, 0x3c, 0x3c, 0x34, 0x71, 0x75, 0x78, 0x57, 0x80, 0x8e, 0x93, 0xf0, 0xea, 0xe8, 0xea, 0xef, 0xf0, 0xf1, 0xfb, 0xf9, 0xed, 0xf1, 0xf0, 0xf1, 0xea, 0xed, 0xed, 0xe8, 0xea, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0x3b, 0x0d, 0x24, 0x4b, 0x30, 0x37, 0x4c, 0x50, 0x43, 0x43, 0x3c, 0x4f, 0x49, 0x3e, 0x45, 0x7c, 0x8e, 0x93, 0xee, 0xb9, 0xea, 0xe8, 0xf9, 0xf9, 0xf0, 0xba, 0xe9, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf0, 0xef, 0xef, 0xe8, 0xe8, 0xef, 0xfa, 0xff, 0x91, 0x93, 0x87, 0x5b, 0x2a, 0x4d, 0x5f, 0x70, 0x54, 0x54, 0x54, 0x70, 0x4c, 0x71, 0x56, 0x5f, 0x78, 0x6e, 0x8b, 0xfc, 0x9b, 0xbd, 0xc6, 0xd9, 0xe0, 0xe4, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf2, 0xf2, 0xea, 0xe8, 0xe7, 0xea, 0xea, 0xe7, 0xea, 0xf3, 0xf8, 0xfa, 0x93, 0x79, 0x77, 0x6e, 0x78, 0x42, 0x2b, 0x2b, 0x3a, 0x30, 0x37, 0x37, 0x47, 0x3d, 0x3d, 0x37, 0x37, 0x30, 0x3c, 0x3c, 0x3d, 0x3d, 0x3a, 0x47, 0x3d, 0x47, 0x3d, 0x41, 0x40, 0x40, 0x51, 0x51, 0x47, 0x3a, 0x34, 0x44, 0x34, 0x40, 0x47, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x37, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x40, 0x37, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x47, 0x47, 0x3d, 0x3a, 0x3a, 0x3a, 0x3c, 0x40, 0x38, 0x40, 0x3d, 0x3d, 0x3a, 0x3d, 0x40, 0x47, 0x41, 0x3d, 0x3a, 0x40, 0x3c, 0x3d, 0x38, 0x40, 0x4a, 0x37, 0x37, 0x37, 0x4c, 0x3c, 0x30, 0x34, 0x75, 0x75, 0x78, 0x6e, 0x74, 0x8c, 0x93, 0xfe, 0xed, 0xed, 0xf2, 0xf0, 0xef, 0xf8, 0xed, 0xf2, 0xea, 0xea, 0xf2, 0xe8, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xe3, 0xdd, 0xc7, 0xbd, 0x83, 0x79, 0x2f, 0x35, 0x37, 0x47, 0x51, 0x40, 0x30, 0x3c, 0x4a, 0x5f, 0x38, 0x2a, 0x57, 0x86, 0x90, 0x94, 0xee, 0xb8, 0xba, 0xe7, 0xf9, 0xf9, 0xf9, 0xf0, 0xb9, 0xe9, 0xef, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xb9, 0xe8, 0xef, 0xfa, 0xfa, 0xee, 0x9a, 0x94, 0x8f, 0x84, 0x48, 0x2a, 0x4d, 0x5f, 0x70, 0x54, 0x70, 0x4f, 0x55, 0x58, 0x70, 0x73, 0x46, 0x8d, 0xc6, 0x99, 0x99, 0x99, 0x96, 0x9e, 0xa2, 0xa6, 0x0f, 0xc2, 0xeb, 0x6d, 0xdf, 0xe6, 0xee, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf0, 0xe6, 0xf2, 0xf2, 0xfa, 0x8d, 0x79, 0x74, 0x7a, 0x78, 0x5e, 0x33, 0x2b, 0x30, 0x30, 0x37, 0x3d, 0x3d, 0x3d, 0x41, 0x40, 0x3c, 0x3c, 0x37, 0x3d, 0x3d, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x51, 0x51, 0x47, 0x47, 0x3d, 0x3a, 0x43, 0x34, 0x3a, 0x40, 0x40, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x37, 0x40, 0x40, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3a, 0x3d, 0x3d, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x41, 0x47, 0x3d, 0x3d, 0x3a, 0x3a, 0x34, 0x3a, 0x3a, 0x3a, 0x3d, 0x47, 0x47, 0x41, 0x37, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x41, 0x3d, 0x3a, 0x37, 0x37, 0x37, 0x40, 0x30, 0x30, 0x34, 0x75, 0x78, 0x6f, 0x76, 0x52, 0x86, 0x8d, 0x91, 0xf8, 0xef, 0xf1, 0xf1, 0xf8, 0xf0, 0xf2, 0xf2, 0xf3, 0xf3, 0xf4, 0xf3, 0xef, 0xf7, 0xdd, 0xeb, 0xbf, 0xf6, 0xf5, 0xa1, 0x9c, 0x99, 0x00, 0x83, 0x86, 0x29, 0x35, 0x37, 0x40, 0x37, 0x55, 0x58, 0x42, 0x33, 0x35, 0x48, 0x80, 0x8e, 0x92, 0xff, 0xee, 0xba, 0xba, 0x9a, 0xed, 0xf8, 0xf9, 0xfa, 0xf8, 0xe9, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf0, 0xef, 0xed, 0xe9, 0xba, 0xef, 0xf0, 0xef, 0xe9, 0xe9, 0xe6, 0x91, 0x90, 0x8e, 0x7c, 0x48, 0x2a, 0x2d, 0x61, 0x5f, 0x58, 0x70, 0x55, 0x70, 0x58, 0x46, 0x8a, 0xf7, 0x3b, 0x22, 0x1b, 0x14, 0x11, 0x0c, 0x08, 0x04, 0x03, 0x03, 0x01, 0x03, 0x05, 0x0c, 0xfc, 0xc6, 0xd9, 0xdf, 0xf8, 0xf4, 0xf4, 0xf3, 0xe8, 0xf2, 0xfa, 0x8a, 0x77, 0x6e, 0x76, 0x78, 0x56, 0x33, 0x2b, 0x3a, 0x37, 0x3d, 0x47, 0x47, 0x41, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x47, 0x3d, 0x41, 0x41, 0x47, 0x3d, 0x40, 0x47, 0x47, 0x47, 0x47, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x37, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x40, 0x37, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x40, 0x47, 0x47, 0x40, 0x3d, 0x3d, 0x3c, 0x3d, 0x40, 0x40, 0x40, 0x3d, 0x3a, 0x3a, 0x43, 0x3a, 0x3d, 0x40, 0x40, 0x40, 0x3d, 0x3c, 0x3c, 0x3c, 0x3d, 0x40, 0x47, 0x3d, 0x3d, 0x3a, 0x3c, 0x37, 0x4a, 0x37, 0x38, 0x3c, 0x73, 0x75, 0x6f, 0x78, 0x5a, 0x7e, 0x92, 0x94, 0xec, 0xea, 0xea, 0xed, 0xf1, 0xf3, 0xf4, 0xf4, 0xec, 0xdf, 0xd9, 0xc7, 0x0f, 0xf5, 0xbc, 0x96, 0x96, 0x00, 0x01, 0x04, 0x08, 0x0b, 0x11, 0x65, 0x8f, 0x8e, 0x27, 0x26, 0x34, 0x30, 0x42, 0x2b, 0x2d, 0x2a, 0x48, 0x7c, 0x8c, 0x93, 0x93, 0xff, 0xf0, 0xea, 0xef, 0xe6, 0xee, 0xf2, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xf0, 0xed, 0xee, 0xee, 0xba, 0xe9, 0xea, 0xe9, 0xef, 0xf0, 0xff, 0xee, 0x95, 0x92, 0x8e, 0x87, 0x64, 0x46, 0x2a, 0x33, 0x58, 0x56, 0x49, 0x45, 0x46, 0x8c, 0x90, 0x79, 0x46, 0x72, 0x72, 0x76, 0x6e, 0x7a, 0x76, 0x6e, 0x4e, 0x2f, 0x20, 0x1b, 0x17, 0x11, 0x0d, 0x08, 0x0b, 0x0c, 0x15, 0x25, 0xfd, 0xf2, 0xef, 0xf0, 0x93, 0x87, 0x74, 0x6e, 0x78, 0x78, 0x68, 0x34, 0x2b, 0x3a, 0x3d, 0x3d, 0x47, 0x40, 0x41, 0x3d, 0x47, 0x37, 0x47, 0x37, 0x40, 0x40, 0x38, 0x37, 0x3c, 0x3c, 0x37, 0x3d, 0x3a, 0x3d, 0x3d, 0x47, 0x47, 0x47, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x41, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x37, 0x40, 0x40, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x41, 0x40, 0x41, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3a, 0x3d, 0x47, 0x47, 0x51, 0x40, 0x40, 0x3c, 0x3c, 0x3d, 0x3c, 0x38, 0x4a, 0x38, 0x47, 0x41, 0x47, 0x47, 0x40, 0x40, 0x38, 0x40, 0x3c, 0x3a, 0x3c, 0x3c, 0x40, 0x40, 0x47, 0x40, 0x3d, 0x3a, 0x30, 0x4c, 0x40, 0x38, 0x3c, 0x73, 0x75, 0x75, 0x76, 0x6c, 0x7b, 0x8e, 0xff, 0xff, 0xb9, 0xe9, 0xef, 0xfb, 0xfb, 0xfd, 0x25, 0xf6, 0x05, 0x02, 0x03, 0x04, 0x0b, 0x10, 0x14, 0x1b, 0x1f, 0x27, 0x2f, 0x52, 0x66, 0x6e, 0x6e, 0x77, 0x8a, 0x93, 0x87, 0x36, 0x2a, 0x2e, 0x2c, 0x45, 0x7a, 0x84, 0x8c, 0x94, 0x9a, 0xba, 0xba, 0xed, 0xf1, 0xf1, 0xf8, 0xf0, 0xf0, 0xee, 0xb9, 0xb9, 0xba, 0xee, 0xf0, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xe9, 0xe9, 0xed, 0xf0, 0xf0, 0xef, 0xf2, 0xee, 0xff, 0x94, 0x93, 0x90, 0x8a, 0x84, 0x7c, 0x6e, 0x4e, 0x57, 0x5b, 0x81, 0x8f, 0x86, 0x27, 0x2e, 0x33, 0x3c, 0x3f, 0x42, 0x3f, 0x42, 0x39, 0x49, 0x4d, 0x60, 0x60, 0x6c, 0x76, 0x7a, 0x7b, 0x57, 0x2f, 0x1f, 0x13, 0x1b, 0x87, 0x94, 0xe6, 0xba, 0x94, 0x85, 0x5b, 0x6e, 0x78, 0x78, 0x67, 0x2e, 0x2b, 0x30, 0x3d, 0x47, 0x37, 0x47, 0x41, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x3c, 0x37, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x40, 0x37, 0x40, 0x41, 0x40, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x37, 0x3c, 0x3c, 0x3c, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3c, 0x34, 0x38, 0x59, 0x70, 0x78, 0x69, 0x76, 0x76, 0x4e, 0x8c, 0x91, 0xf8, 0xef, 0x91, 0x93, 0x8d, 0x85, 0x65, 0x10, 0x0b, 0x14, 0x1b, 0x24, 0x52, 0x66, 0x66, 0x5a, 0x6a, 0x5c, 0x4b, 0x2e, 0x5c, 0x2e, 0x4b, 0x2b, 0x35, 0x24, 0x79, 0x93, 0x95, 0x8d, 0x86, 0x86, 0x8a, 0x8d, 0x90, 0x92, 0xff, 0xff, 0xee, 0xb9, 0xba, 0xe9, 0xef, 0xed, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xba, 0xe6, 0xea, 0xfb, 0x95, 0x94, 0x94, 0x92, 0x90, 0x8f, 0x90, 0xfa, 0x90, 0x79, 0x2f, 0x45, 0x49, 0x44, 0x50, 0x3c, 0x3f, 0x3f, 0x44, 0x39, 0x44, 0x34, 0x34, 0x2b, 0x2b, 0x34, 0x2b, 0x33, 0x2e, 0x45, 0x6f, 0x6c, 0x31, 0x82, 0x90, 0x94, 0x91, 0x92, 0x81, 0x4e, 0x6e, 0x6b, 0x76, 0x75, 0x4b, 0x2b, 0x34, 0x3c, 0x47, 0x51, 0x40, 0x3d, 0x40, 0x40, 0x41, 0x40, 0x3d, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x41, 0x40, 0x40, 0x40, 0x37, 0x40, 0x40, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x37, 0x40, 0x3c, 0x40, 0x40, 0x40, 0x4a, 0x40, 0x30, 0x34, 0x58, 0x72, 0x72, 0x78, 0x6a, 0x76, 0x4e, 0x86, 0xf9, 0x91, 0x91, 0x90, 0x87, 0x64, 0x24, 0x1c, 0x21, 0x5a, 0x7a, 0x60, 0x4b, 0x56, 0x39, 0x2b, 0x3c, 0x3c, 0x3c, 0x30, 0x44, 0x44, 0x34, 0x3a, 0x3a, 0x4a, 0x2d, 0x29, 0x79, 0xee, 0xe5, 0x9a, 0xf9, 0x93, 0xf9, 0xfb, 0xfb, 0xfb, 0xf8, 0xee, 0xee, 0xee, 0xba, 0xb9, 0xe9, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xba, 0xea, 0xba, 0xe6, 0xef, 0xee, 0xff, 0xff, 0xff, 0x91, 0xff, 0xf8, 0xfb, 0x92, 0x7e, 0x2f, 0x26, 0x3e, 0x39, 0x49, 0x42, 0x39, 0x2e, 0x4b, 0x39, 0x44, 0x34, 0x44, 0x34, 0x3f, 0x44, 0x34, 0x44, 0x2e, 0x2d, 0x42, 0x35, 0x26, 0x7b, 0x8e, 0x8f, 0x92, 0x92, 0x79, 0x5b, 0x6e, 0x78, 0x75, 0x72, 0x44, 0x28, 0x34, 0x3d, 0x51, 0x41, 0x3d, 0x3d, 0x40, 0x47, 0x41, 0x40, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x41, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x37, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x40, 0x40, 0x3d, 0x40, 0x37, 0x3c, 0x40, 0x3c, 0x37, 0x3c, 0x55, 0x69, 0x76, 0x76, 0x6f, 0x6b, 0x6e, 0x7e, 0x90, 0x92, 0x90, 0x88, 0x5b, 0x24, 0x26, 0x35, 0x56, 0x63, 0x3c, 0x38, 0x4f, 0x4c, 0x37, 0x40, 0x4a, 0x51, 0x5d, 0x4a, 0x3c, 0x43, 0x34, 0x44, 0x3f, 0x3f, 0x2d, 0x23, 0x64, 0x8d, 0xf4, 0xb8, 0xb9, 0xb9, 0xf8, 0xfb, 0xff, 0xf8, 0xff, 0xee, 0xee, 0xee, 0xe9, 0xee, 0xba, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xea, 0xe9, 0xea, 0xea, 0xe8, 0xe9, 0xba, 0xe7, 0xba, 0xe7, 0xba, 0xb9, 0xe9, 0xff, 0x93, 0x8a, 0x74, 0x2f, 0x2c, 0x26, 0x32, 0x2e, 0x3f, 0x34, 0x43, 0x3f, 0x43, 0x3f, 0x43, 0x44, 0x44, 0x44, 0x34, 0x44, 0x44, 0x30, 0x30, 0x49, 0x32, 0x6e, 0x8e, 0x92, 0x95, 0x94, 0x79, 0x2f, 0x76, 0x72, 0x75, 0x75, 0x4b, 0x39, 0x30, 0x47, 0x3d, 0x47, 0x41, 0x47, 0x41, 0x41, 0x3d, 0x40, 0x40, 0x37, 0x37, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x41, 0x41, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x40, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x3d, 0x41, 0x41, 0x3d, 0x40, 0x3c, 0x4c, 0x3c, 0x3c, 0x30, 0x3c, 0x55, 0x75, 0x6a, 0x66, 0x6a, 0x76, 0x5a, 0x7e, 0x93, 0x92, 0x90, 0x80, 0x3e, 0x28, 0x5e, 0x55, 0x43, 0x3c, 0x3a, 0x50, 0x55, 0x3a, 0x4c, 0x3a, 0x41, 0x41, 0x47, 0x37, 0x47, 0x51, 0x4a, 0x40, 0x30, 0x28, 0x23, 0x46, 0x80, 0x8f, 0x93, 0xe6, 0xb8, 0xb9, 0xb9, 0xb9, 0xed, 0xf8, 0xef, 0xee, 0xef, 0xef, 0xee, 0xe9, 0xba, 0xe6, 0xe9, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xf8, 0xf1, 0xfa, 0xf0, 0xf0, 0xf0, 0xf2, 0xe9, 0xe9, 0xe9, 0xea, 0xb8, 0xb8, 0xfb, 0xf8, 0x92, 0x92, 0x8e, 0x84, 0x74, 0x4e, 0x26, 0x2d, 0x2d, 0x33, 0x33, 0x42, 0x3f, 0x34, 0x44, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x56, 0x2a, 0x74, 0x87, 0x94, 0x95, 0x8b, 0x79, 0x46, 0x76, 0x72, 0x78, 0x75, 0x5e, 0x3f, 0x37, 0x3d, 0x3d, 0x3d, 0x41, 0x47, 0x47, 0x40, 0x47, 0x40, 0x40, 0x37, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x3d, 0x40, 0x47, 0x3d, 0x40, 0x3d, 0x37, 0x50, 0x3c, 0x34, 0x43, 0x63, 0x75, 0x75, 0x69, 0x6a, 0x6b, 0x57, 0x7e, 0x90, 0x90, 0x8f, 0x7c, 0x2c, 0x49, 0x44, 0x44, 0x43, 0x3a, 0x53, 0x47, 0x3d, 0x3d, 0x4c, 0x43, 0x34, 0x34, 0x43, 0x4f, 0x3f, 0x3f, 0x42, 0x2b, 0x2d, 0x35, 0x5b, 0x81, 0x8e, 0x92, 0x91, 0xff, 0xf8, 0xf0, 0xe6, 0xea, 0xe6, 0xe9, 0xe9, 0xee, 0xf2, 0xe9, 0xee, 0xe9, 0xee, 0xee, 0xe9, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfa, 0xff, 0xf8, 0xfa, 0xf8, 0xfa, 0xf8, 0xf1, 0xf1, 0xf8, 0xed, 0xba, 0xe8, 0xe7, 0xef, 0xf1, 0xfe, 0x93, 0x92, 0x90, 0x8e, 0x86, 0x80, 0x74, 0x31, 0x26, 0x26, 0x23, 0x28, 0x28, 0x2d, 0x39, 0x3f, 0x34, 0x44, 0x44, 0x56, 0x55, 0x55, 0x63, 0x35, 0x52, 0x8c, 0x90, 0x93, 0x8e, 0x64, 0x46, 0x76, 0x72, 0x75, 0x71, 0x63, 0x42, 0x30, 0x37, 0x3d, 0x47, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x40, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x37, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x41, 0x40, 0x40, 0x3d, 0x3d, 0x3c, 0x34, 0x34, 0x56, 0x63, 0x75, 0x72, 0x67, 0x75, 0x72, 0x6c, 0x77, 0x8e, 0x92, 0x8e, 0x74, 0x23, 0x44, 0x44, 0x43, 0x50, 0x53, 0x53, 0x53, 0x4c, 0x4c, 0x43, 0x3a, 0x39, 0x2e, 0x28, 0x28, 0x26, 0x26, 0x29, 0x46, 0x74, 0x82, 0x86, 0x90, 0x93, 0xff, 0x9a, 0xba, 0xf0, 0xf8, 0xf9, 0xfe, 0xf8, 0xf0, 0xba, 0xba, 0xba, 0xe6, 0xba, 0xed, 0xe9, 0xed, 0xba, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xba, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf0, 0xf8, 0xfa, 0xf0, 0xf8, 0xe9, 0xed, 0xea, 0xea, 0xea, 0xef, 0xf1, 0xff, 0x91, 0x93, 0x94, 0x94, 0x93, 0x90, 0x8e, 0x86, 0x7e, 0x7b, 0x6e, 0x45, 0x2c, 0x2a, 0x35, 0x2a, 0x2c, 0x2c, 0x2e, 0x42, 0x42, 0x73, 0x48, 0x31, 0x81, 0x93, 0x94, 0x8a, 0x79, 0x46, 0x6f, 0x75, 0x73, 0x75, 0x69, 0x42, 0x3a, 0x30, 0x3c, 0x41, 0x40, 0x41, 0x40, 0x40, 0x40, 0x40, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x37, 0x3c, 0x34, 0x3f, 0x56, 0x68, 0x75, 0x69, 0x72, 0x72, 0x72, 0x5c, 0x74, 0x8f, 0x93, 0x8d, 0x5b, 0x2c, 0x4b, 0x63, 0x63, 0x58, 0x42, 0x42, 0x39, 0x28, 0x2e, 0x2c, 0x2c, 0x2c, 0x2c, 0x48, 0x66, 0x7b, 0x82, 0x86, 0x8d, 0x90, 0x94, 0x95, 0x95, 0xff, 0xee, 0xb8, 0xb8, 0xb9, 0xe6, 0xf9, 0xfe, 0xf9, 0xfa, 0xed, 0xe9, 0xe7, 0xed, 0xea, 0xe6, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xb9, 0xb8, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xf1, 0xed, 0xe9, 0xe8, 0xe8, 0xe9, 0xe9, 0xee, 0xee, 0xe6, 0xb9, 0xb9, 0x9a, 0xfb, 0x91, 0x93, 0x90, 0x8f, 0x8e, 0x89, 0x86, 0x80, 0x82, 0x7c, 0x64, 0x5b, 0x57, 0x2c, 0x32, 0x2c, 0x29, 0x27, 0x6d, 0x8b, 0xf4, 0x8d, 0x64, 0x57, 0x67, 0x78, 0x72, 0x6c, 0x75, 0x49, 0x30, 0x2b, 0x3c, 0x4c, 0x4a, 0x47, 0x4a, 0x47, 0x37, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x37, 0x40, 0x40, 0x40, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x40, 0x3c, 0x3c, 0x3c, 0x3f, 0x3f, 0x68, 0x72, 0x75, 0x69, 0x72, 0x6f, 0x78, 0x48, 0x7b, 0x8d, 0x94, 0xfe, 0x36, 0x20, 0x26, 0x26, 0x23, 0x23, 0x2a, 0x32, 0x45, 0x46, 0x74, 0x77, 0x79, 0x81, 0x85, 0x89, 0x8e, 0x8e, 0x8f, 0x92, 0x93, 0x91, 0x9a, 0xba, 0xb8, 0xb9, 0xed, 0xee, 0xba, 0xb8, 0xe8, 0xe8, 0xed, 0xed, 0xed, 0xed, 0xe7, 0xe6, 0xe9, 0xe9, 0xe6, 0xe9, 0xe9, 0xee, 0xed, 0xe9, 0xed, 0xe9, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xb9, 0xb8, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xba, 0xba, 0xe9, 0xf8, 0xf1, 0xef, 0xed, 0xe9, 0xee, 0xba, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xb8, 0xe6, 0xb9, 0xf3, 0xee, 0xee, 0xba, 0x9a, 0x9a, 0x95, 0x94, 0x94, 0x94, 0x93, 0x93, 0x90, 0x8d, 0x8e, 0x8d, 0x8e, 0x8b, 0x83, 0xf7, 0xee, 0xff, 0x90, 0x79, 0x4e, 0x6c, 0x76, 0x5c, 0x6f, 0x69, 0x5e, 0x56, 0x34, 0x30, 0x3c, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x41, 0x3d, 0x37, 0x37, 0x37, 0x40, 0x3d, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x41, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x37, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x40, 0x3d, 0x3c, 0x30, 0x3f, 0x58, 0x75, 0x75, 0x72, 0x6f, 0x6f, 0x6f, 0x6b, 0x31, 0x7c, 0x90, 0xff, 0xec, 0x6d, 0x79, 0x84, 0x84, 0x89, 0x8d, 0x8d, 0x90, 0x90, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0xff, 0x95, 0xee, 0xee, 0xf8, 0xf8, 0xef, 0xf8, 0xf8, 0xef, 0xf0, 0xf1, 0xf0, 0xf1, 0xef, 0xef, 0xe7, 0xba, 0xe7, 0xba, 0xe7, 0xe9, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xe9, 0xe9, 0xef, 0xf0, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xf0, 0xed, 0xf2, 0xf1, 0xf2, 0xed, 0xee, 0xe9, 0xba, 0xe7, 0x9a, 0xba, 0xe9, 0xe9, 0xee, 0xff, 0xff, 0xff, 0x94, 0xff, 0x91, 0xff, 0x94, 0xf9, 0xff, 0xf3, 0xb9, 0x94, 0x90, 0x81, 0x52, 0x66, 0x6b, 0x76, 0x6f, 0x78, 0x72, 0x56, 0x3f, 0x3c, 0x3c, 0x37, 0x3d, 0x47, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x37, 0x3d, 0x40, 0x3d, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x37, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x3d, 0x37, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x3d, 0x3c, 0x3f, 0x55, 0x63, 0x73, 0x75, 0x72, 0x72, 0x6f, 0x6f, 0x6b, 0x46, 0x79, 0x8d, 0xff, 0xf0, 0xf8, 0x91, 0x95, 0x91, 0x94, 0x93, 0xfa, 0x9a, 0xee, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xf8, 0xba, 0xba, 0xba, 0xe6, 0xba, 0xef, 0xef, 0xed, 0xfa, 0xf8, 0xfa, 0xed, 0xef, 0xf1, 0xfa, 0xf0, 0xed, 0xe7, 0xb9, 0xe8, 0xed, 0xed, 0xf8, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xf9, 0xf9, 0xf1, 0xf9, 0xf1, 0xf0, 0xf1, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xff, 0xee, 0xf0, 0xf8, 0xf1, 0xed, 0xed, 0xed, 0xef, 0xf1, 0xfa, 0xfa, 0xf1, 0xfa, 0xf1, 0xed, 0xea, 0xba, 0xe9, 0xf0, 0xf0, 0xfa, 0xf1, 0xef, 0xed, 0xe9, 0xf0, 0xf8, 0xfa, 0xf0, 0xe9, 0x9a, 0xb9, 0xff, 0x92, 0x81, 0x52, 0x57, 0x76, 0x6a, 0x6f, 0x78, 0x75, 0x75, 0x58, 0x3f, 0x37, 0x40, 0x47, 0x40, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x40, 0x3d, 0x37, 0x3a, 0x37, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x37, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x37, 0x40, 0x40, 0x40, 0x3d, 0x4a, 0x37, 0x3c, 0x3c, 0x56, 0x68, 0x75, 0x75, 0x72, 0x6f, 0x6f, 0x76, 0x5a, 0x48, 0x7e, 0x92, 0x95, 0xec, 0xf8, 0xfa, 0xf8, 0xe6, 0xb9, 0xe8, 0xf1, 0xf8, 0xf8, 0xf0, 0xf8, 0xf0, 0xee, 0xf8, 0xef, 0xef, 0xf0, 0xea, 0xed, 0xea, 0xea, 0xe8, 0xed, 0xed, 0xed, 0xf0, 0xf0, 0xf0, 0xef, 0xe7, 0xe8, 0xf0, 0xf8, 0xf0, 0xee, 0xe7, 0xe9, 0xed, 0xf8, 0xfa, 0xed, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xf0, 0xed, 0xef, 0xe9, 0xe9, 0xef, 0xee, 0xf0, 0xf0, 0xf0, 0xf8, 0xf1, 0xf0, 0xed, 0xe8, 0xb9, 0xea, 0xef, 0xf1, 0xf0, 0xf1, 0xef, 0xea, 0xea, 0xea, 0xf1, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xed, 0xf1, 0xf0, 0xf9, 0xf1, 0xf1, 0xe9, 0xea, 0x9a, 0xfb, 0xff, 0x93, 0x87, 0x36, 0x57, 0x6f, 0x6a, 0x6b, 0x76, 0x78, 0x6b, 0x72, 0x58, 0x4a, 0x40, 0x40, 0x3d, 0x47, 0x47, 0x47, 0x47, 0x40, 0x3d, 0x3a, 0x3f, 0x3a, 0x40, 0x40, 0x40, 0x40, 0x47, 0x40, 0x41, 0x40, 0x3d, 0x41, 0x37, 0x41, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x37, 0x37, 0x3d, 0x37, 0x37, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x3d, 0x3c, 0x3d, 0x40, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3c, 0x38, 0x37, 0x40, 0x51, 0x47, 0x40, 0x40, 0x3f, 0x3f, 0x68, 0x6b, 0x6b, 0x6b, 0x6c, 0x6f, 0x76, 0x5a, 0x66, 0x2f, 0x7e, 0x90, 0x9a, 0xe6, 0xee, 0xe6, 0xf8, 0xee, 0xe6, 0xba, 0xe6, 0xef, 0xf0, 0xed, 0xf0, 0xee, 0xef, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xea, 0xb8, 0xb9, 0xba, 0xba, 0xe9, 0xf0, 0xfa, 0xf8, 0xee, 0xba, 0xb9, 0xe9, 0xef, 0xed, 0xef, 0xf0, 0xed, 0xef, 0xed, 0xef, 0xef, 0xf0, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xed, 0xee, 0xef, 0xe9, 0xed, 0xef, 0xed, 0xef, 0xed, 0xf0, 0xef, 0xf1, 0xed, 0xef, 0xe9, 0xef, 0xf0, 0xf0, 0xfa, 0xf0, 0xf0, 0xed, 0xba, 0xe7, 0xe9, 0xf9, 0xf9, 0xf0, 0xf0, 0xef, 0xe9, 0xe9, 0xe9, 0xf2, 0xea, 0xe9, 0xba, 0xe9, 0xee, 0xfb, 0xff, 0xff, 0x94, 0x93, 0xff, 0x8b, 0x64, 0x52, 0x57, 0x76, 0x6f, 0x6b, 0x76, 0x6c, 0x6a, 0x61, 0x3c, 0x3c, 0x37, 0x37, 0x37, 0x40, 0x47, 0x41, 0x3d, 0x3d, 0x3a, 0x3a, 0x3d, 0x40, 0x41, 0x40, 0x40, 0x37, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x40, 0x3d, 0x37, 0x40, 0x40, 0x41, 0x3d, 0x41, 0x3d, 0x37, 0x3d, 0x40, 0x47, 0x40, 0x40, 0x30, 0x30, 0x63, 0x75, 0x6f, 0x6c, 0x78, 0x72, 0x73, 0x72, 0x72, 0x66, 0x2f, 0x84, 0x90, 0x93, 0xee, 0xee, 0xee, 0xee, 0x95, 0x95, 0xff, 0xff, 0xff, 0xff, 0xec, 0xe5, 0x9a, 0xea, 0xba, 0xe6, 0xe9, 0xe9, 0xe9, 0xf0, 0xef, 0xf0, 0xed, 0xe6, 0xed, 0xed, 0xf8, 0xf0, 0xef, 0xe9, 0xb8, 0xb8, 0xef, 0xef, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xef, 0xfa, 0xfa, 0xfa, 0xfa, 0xf0, 0xf8, 0xf8, 0xf0, 0xee, 0xf0, 0xed, 0xf9, 0xf1, 0xf1, 0xf0, 0xf0, 0xee, 0xf8, 0xee, 0xfb, 0xee, 0x9a, 0xee, 0x94, 0x92, 0x90, 0x8f, 0x8e, 0x8a, 0x8a, 0x92, 0x93, 0x8d, 0x65, 0x52, 0x66, 0x6a, 0x6a, 0x6a, 0x6c, 0x76, 0x76, 0x6f, 0x56, 0x3f, 0x34, 0x30, 0x3c, 0x3c, 0x40, 0x3d, 0x47, 0x47, 0x47, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x37, 0x3d, 0x37, 0x3a, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41, 0x3d, 0x3a, 0x3a, 0x3c, 0x3c, 0x34, 0x49, 0x68, 0x78, 0x6f, 0x6c, 0x66, 0x6a, 0x73, 0x73, 0x73, 0x5a, 0x5b, 0x8c, 0x90, 0x8f, 0x87, 0x84, 0x86, 0x87, 0x89, 0x8a, 0x8d, 0x8f, 0x90, 0x90, 0x93, 0x94, 0x95, 0xee, 0xf8, 0xfb, 0xf0, 0xee, 0xf8, 0xef, 0xed, 0xf0, 0xf9, 0xfe, 0xed, 0xf8, 0xed, 0xef, 0xf0, 0xed, 0xef, 0xe8, 0xb9, 0xef, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xef, 0xed, 0xef, 0xef, 0xe9, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xee, 0xff, 0xff, 0x94, 0xfa, 0xea, 0xef, 0xfb, 0x95, 0x95, 0x95, 0x93, 0x93, 0x92, 0x90, 0x8a, 0x85, 0x81, 0x77, 0x5b, 0x52, 0x4e, 0x2f, 0x5b, 0x7e, 0x8c, 0x93, 0x90, 0x7e, 0x2f, 0x66, 0x6a, 0x69, 0x6f, 0x6a, 0x6c, 0x76, 0x75, 0x68, 0x56, 0x39, 0x34, 0x34, 0x37, 0x40, 0x47, 0x51, 0x47, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x37, 0x3a, 0x37, 0x3a, 0x37, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x37, 0x3d, 0x40, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x40, 0x47, 0x40, 0x47, 0x40, 0x40, 0x40, 0x47, 0x40, 0x40, 0x47, 0x3d, 0x4c, 0x3a, 0x3a, 0x34, 0x44, 0x5e, 0x75, 0x6f, 0x60, 0x6b, 0x76, 0x66, 0x76, 0x78, 0x67, 0x48, 0x5b, 0x8f, 0x90, 0x8f, 0x81, 0x31, 0x4d, 0x4d, 0x6b, 0x5a, 0x57, 0x6e, 0x5b, 0x77, 0x79, 0x7e, 0x7f, 0x8a, 0x90, 0x93, 0x93, 0x93, 0x95, 0x95, 0x95, 0xf2, 0xf8, 0xfa, 0xfa, 0xed, 0xe9, 0xe9, 0xed, 0xed, 0xf1, 0xed, 0xf1, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xe9, 0xe9, 0xba, 0xed, 0xba, 0xee, 0xed, 0xf0, 0xf0, 0xe9, 0xba, 0xba, 0xb9, 0xba, 0x9a, 0x95, 0xf4, 0xf4, 0xf4, 0xff, 0xf7, 0x7f, 0x65, 0x36, 0x27, 0x5b, 0x46, 0x31, 0x31, 0x3e, 0x3e, 0x5c, 0x6b, 0x6b, 0x78, 0x76, 0x6b, 0x3e, 0x6c, 0x80, 0x8e, 0x92, 0x89, 0x64, 0x46, 0x69, 0x73, 0x73, 0x6f, 0x6c, 0x6f, 0x75, 0x75, 0x72, 0x56, 0x39, 0x34, 0x37, 0x40, 0x47, 0x47, 0x47, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x47, 0x40, 0x47, 0x40, 0x47, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x30, 0x3f, 0x42, 0x5e, 0x69, 0x69, 0x6a, 0x60, 0x6b, 0x6f, 0x6f, 0x69, 0x6c, 0x57, 0x4e, 0x85, 0x92, 0x92, 0x8a, 0x5b, 0x32, 0x72, 0x73, 0x70, 0x61, 0x73, 0x63, 0x72, 0x61, 0x67, 0x61, 0x4b, 0x3e, 0x29, 0x21, 0x29, 0x2f, 0x36, 0x65, 0x65, 0x83, 0xfd, 0xf4, 0xf4, 0xf4, 0xf4, 0x9a, 0xba, 0xb9, 0xf0, 0xf9, 0xf9, 0xf9, 0xf9, 0xed, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf1, 0xed, 0xed, 0xef, 0xe9, 0xe6, 0xba, 0xe6, 0xef, 0xe6, 0xfb, 0xf9, 0xf8, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0x9a, 0xf7, 0xd9, 0xc6, 0x11, 0x0c, 0x09, 0x0d, 0x16, 0x1c, 0x26, 0x3e, 0x4d, 0x61, 0x68, 0x63, 0x68, 0x5e, 0x68, 0x69, 0x69, 0x6f, 0x78, 0x78, 0x6b, 0x57, 0x77, 0x8a, 0x95, 0x8d, 0x79, 0x46, 0x60, 0x72, 0x67, 0x6a, 0x72, 0x72, 0x72, 0x78, 0x69, 0x68, 0x56, 0x3f, 0x30, 0x37, 0x40, 0x37, 0x41, 0x41, 0x47, 0x3d, 0x40, 0x40, 0x40, 0x37, 0x40, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x37, 0x37, 0x37, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x40, 0x4c, 0x38, 0x30, 0x37, 0x30, 0x58, 0x63, 0x68, 0x69, 0x75, 0x6a, 0x67, 0x5c, 0x78, 0x6f, 0x72, 0x72, 0x48, 0x5b, 0x87, 0x93, 0xff, 0x85, 0x64, 0x48, 0x72, 0x73, 0x75, 0x72, 0x71, 0x63, 0x73, 0x62, 0x73, 0x71, 0x63, 0x70, 0x73, 0x73, 0x68, 0x4b, 0x32, 0x29, 0x1c, 0x13, 0x0d, 0x0b, 0x0c, 0x11, 0x25, 0x7d, 0xec, 0x9a, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xed, 0xef, 0xf3, 0xec, 0xee, 0xf2, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xf0, 0xed, 0xef, 0xef, 0xe9, 0xe9, 0xba, 0xe6, 0xf2, 0xee, 0xf8, 0xf3, 0xf4, 0xec, 0xdf, 0xc7, 0xfc, 0xf5, 0x97, 0x99, 0x02, 0x07, 0x12, 0x1c, 0x45, 0x5a, 0x5c, 0x56, 0x63, 0x63, 0x62, 0x62, 0x62, 0x55, 0x71, 0x71, 0x71, 0x73, 0x75, 0x72, 0x5c, 0x5a, 0x57, 0x4e, 0x27, 0x6d, 0xfd, 0x9a, 0xf4, 0x85, 0x64, 0x46, 0x6c, 0x6f, 0x60, 0x6f, 0x6f, 0x60, 0x72, 0x78, 0x69, 0x68, 0x56, 0x39, 0x34, 0x3d, 0x3d, 0x3d, 0x40, 0x47, 0x40, 0x40, 0x40, 0x40, 0x40, 0x37, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x3c, 0x37, 0x3c, 0x37, 0x4a, 0x40, 0x40, 0x40, 0x37, 0x37, 0x37, 0x40, 0x3d, 0x3c, 0x40, 0x30, 0x2b, 0x30, 0x3f, 0x58, 0x63, 0x67, 0x67, 0x67, 0x67, 0x6a, 0x6f, 0x6a, 0x6f, 0x6c, 0x6b, 0x5a, 0x48, 0x7e, 0x90, 0xf3, 0xb9, 0xfd, 0x7f, 0x36, 0x48, 0x4b, 0x60, 0x5c, 0x5c, 0x6a, 0x69, 0x69, 0x75, 0x71, 0x55, 0x62, 0x71, 0x62, 0x70, 0x62, 0x62, 0x58, 0x49, 0x4b, 0x5c, 0x66, 0x31, 0x24, 0x17, 0x0d, 0x02, 0x01, 0x04, 0x0a, 0x15, 0xc7, 0x25, 0xf2, 0xf2, 0xe6, 0xed, 0xf2, 0xef, 0xed, 0xed, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xf1, 0xe9, 0xed, 0xba, 0xe6, 0xe9, 0x95, 0xf8, 0xff, 0x95, 0xe3, 0xbf, 0x05, 0x98, 0x99, 0x96, 0x03, 0x09, 0x16, 0x20, 0x2a, 0x39, 0x49, 0x42, 0x55, 0x55, 0x55, 0x43, 0x50, 0x55, 0x63, 0x5e, 0x71, 0x71, 0x73, 0x70, 0x73, 0x68, 0x4d, 0x46, 0x6e, 0x77, 0x81, 0x8d, 0x93, 0xff, 0xe7, 0xb8, 0xf3, 0x91, 0x79, 0x52, 0x45, 0x6c, 0x5a, 0x60, 0x76, 0x60, 0x60, 0x67, 0x75, 0x6f, 0x5e, 0x5e, 0x3f, 0x3c, 0x30, 0x38, 0x3c, 0x40, 0x40, 0x47, 0x40, 0x47, 0x47, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x37, 0x30, 0x37, 0x37, 0x3c, 0x40, 0x3c, 0x30, 0x30, 0x30, 0x2b, 0x3f, 0x42, 0x63, 0x68, 0x68, 0x68, 0x6b, 0x6f, 0x6b, 0x60, 0x60, 0x6a, 0x6c, 0x6c, 0x66, 0x57, 0x5b, 0x85, 0x93, 0xff, 0xb9, 0xb9, 0x9a, 0x91, 0x8e, 0x89, 0x84, 0x7c, 0x57, 0x45, 0x45, 0x5a, 0x5c, 0x5c, 0x69, 0x69, 0x68, 0x63, 0x71, 0x56, 0x55, 0x55, 0x55, 0x55, 0x4f, 0x3f, 0x2b, 0x39, 0x56, 0x48, 0x48, 0x52, 0x20, 0x14, 0x07, 0x96, 0x97, 0x99, 0xab, 0xe5, 0xf3, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xf1, 0xf0, 0xed, 0xe9, 0xed, 0xf2, 0xe6, 0xf8, 0x91, 0x95, 0x6d, 0x05, 0x96, 0x01, 0x06, 0x0e, 0x1a, 0x2c, 0x35, 0x49, 0x33, 0x3f, 0x38, 0x3c, 0x38, 0x37, 0x4a, 0x3c, 0x4f, 0x56, 0x5e, 0x5e, 0x5e, 0x60, 0x5e, 0x4d, 0x4d, 0x48, 0x5a, 0x7b, 0x84, 0x8e, 0x8f, 0x95, 0xe6, 0xfd, 0x91, 0xfa, 0xe5, 0xba, 0xf4, 0x92, 0x89, 0x74, 0x2f, 0x57, 0x57, 0x5c, 0x6b, 0x72, 0x67, 0x67, 0x69, 0x6a, 0x6f, 0x75, 0x73, 0x63, 0x42, 0x3f, 0x30, 0x30, 0x37, 0x40, 0x41, 0x40, 0x37, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x3d, 0x37, 0x3d, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x40, 0x3c, 0x3c, 0x3c, 0x37, 0x3c, 0x40, 0x3c, 0x40, 0x3d, 0x3c, 0x30, 0x34, 0x34, 0x42, 0x56, 0x68, 0x68, 0x69, 0x67, 0x67, 0x5c, 0x5c, 0x6a, 0x60, 0x6f, 0x5c, 0x6b, 0x66, 0x4e, 0x2f, 0x81, 0x8f, 0x95, 0x95, 0x95, 0x95, 0x95, 0xee, 0xff, 0x9a, 0xff, 0xff, 0x91, 0x8f, 0x8a, 0x81, 0x7c, 0x5b, 0x48, 0x48, 0x4d, 0x68, 0x63, 0x69, 0x6a, 0x5e, 0x5e, 0x58, 0x4f, 0x4c, 0x4f, 0x4a, 0x4a, 0x3c, 0x58, 0x42, 0x39, 0x3e, 0x5c, 0x66, 0x24, 0x13, 0x0c, 0x96, 0xa6, 0xfb, 0xf3, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xf0, 0xed, 0xed, 0xba, 0xee, 0xee, 0x94, 0x95, 0xfd, 0x11, 0x12, 0x1c, 0x1c, 0x31, 0x4b, 0x35, 0x39, 0x34, 0x2b, 0x34, 0x30, 0x34, 0x3c, 0x3c, 0x3c, 0x3c, 0x43, 0x4f, 0x56, 0x49, 0x4d, 0x3e, 0x45, 0x57, 0x74, 0x82, 0x8a, 0x8d, 0x93, 0x94, 0xff, 0xfa, 0xe6, 0x9a, 0x94, 0xfe, 0x92, 0x92, 0x92, 0x91, 0x94, 0x94, 0x90, 0x82, 0x5b, 0x31, 0x57, 0x60, 0x6f, 0x72, 0x72, 0x60, 0x6b, 0x6a, 0x6f, 0x6f, 0x75, 0x72, 0x75, 0x56, 0x55, 0x50, 0x3c, 0x3a, 0x37, 0x3d, 0x37, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x40, 0x37, 0x40, 0x37, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x37, 0x40, 0x3d, 0x40, 0x37, 0x3d, 0x40, 0x3c, 0x37, 0x37, 0x37, 0x30, 0x37, 0x30, 0x3f, 0x56, 0x56, 0x75, 0x72, 0x69, 0x60, 0x60, 0x5c, 0x6b, 0x5c, 0x5c, 0x5c, 0x6a, 0x69, 0x6b, 0x6c, 0x46, 0x64, 0x8a, 0x90, 0x93, 0x92, 0x8d, 0x86, 0x8a, 0x8e, 0x92, 0x95, 0x95, 0xba, 0xfb, 0xee, 0xef, 0x94, 0x94, 0x92, 0x8f, 0x89, 0x88, 0x7c, 0x6e, 0x46, 0x45, 0x3e, 0x4b, 0x5e, 0x63, 0x56, 0x58, 0x3f, 0x34, 0x44, 0x49, 0x30, 0x4f, 0x43, 0x34, 0x42, 0x39, 0x6a, 0x48, 0x6e, 0x1f, 0x14, 0xec, 0xf3, 0xf3, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xe8, 0xba, 0xe9, 0xe6, 0xf4, 0xfd, 0x6d, 0x90, 0x27, 0x24, 0x45, 0x4d, 0x39, 0x2b, 0x2b, 0x30, 0x30, 0x3a, 0x2b, 0x34, 0x2b, 0x34, 0x28, 0x34, 0x39, 0x2e, 0x2a, 0x2a, 0x2c, 0x57, 0x7b, 0x84, 0x8e, 0x92, 0x91, 0x95, 0x9a, 0xf2, 0xba, 0xee, 0xe9, 0xfb, 0x94, 0x90, 0x8a, 0x84, 0x82, 0x77, 0x7e, 0x87, 0x8e, 0x93, 0x90, 0x8c, 0x7e, 0x52, 0x31, 0x5a, 0x60, 0x60, 0x72, 0x6f, 0x60, 0x76, 0x60, 0x5c, 0x6a, 0x69, 0x69, 0x75, 0x5e, 0x63, 0x4f, 0x3f, 0x3c, 0x3c, 0x3c, 0x30, 0x30, 0x37, 0x30, 0x37, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x38, 0x3c, 0x30, 0x30, 0x3c, 0x30, 0x3f, 0x3c, 0x55, 0x4f, 0x62, 0x62, 0x73, 0x68, 0x72, 0x69, 0x60, 0x60, 0x5c, 0x5c, 0x5c, 0x6a, 0x6c, 0x5c, 0x5c, 0x6a, 0x5a, 0x45, 0x4e, 0x84, 0x8e, 0x92, 0x93, 0x8a, 0x80, 0x52, 0x5a, 0x48, 0x7b, 0x82, 0x87, 0x90, 0x91, 0x93, 0xf9, 0xf2, 0xe7, 0xf2, 0xfb, 0x94, 0x94, 0x92, 0x92, 0x90, 0x8a, 0x81, 0x7b, 0x46, 0x31, 0x2a, 0x26, 0x35, 0x3e, 0x49, 0x39, 0x42, 0x50, 0x43, 0x4c, 0x43, 0x3d, 0x4c, 0x38, 0x4d, 0x32, 0x2f, 0x84, 0x94, 0xfd, 0xec, 0xf4, 0xba, 0xf2, 0xef, 0xf8, 0xf0, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xe6, 0xe6, 0xb8, 0xba, 0xee, 0x95, 0xd9, 0x02, 0x10, 0x80, 0x88, 0x88, 0x31, 0x1c, 0x23, 0x28, 0x34, 0x30, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x28, 0x2c, 0x31, 0x2f, 0x5b, 0x7c, 0x81, 0x8a, 0x92, 0x94, 0xfb, 0xee, 0xed, 0xba, 0xf2, 0xee, 0x91, 0x93, 0x93, 0x8d, 0x86, 0x7c, 0x6e, 0x45, 0x4b, 0x6a, 0x5c, 0x5c, 0x46, 0x74, 0x7e, 0x91, 0x94, 0x95, 0x87, 0x79, 0x52, 0x46, 0x5c, 0x60, 0x67, 0x69, 0x60, 0x60, 0x6c, 0x5c, 0x5c, 0x6c, 0x5c, 0x6f, 0x72, 0x72, 0x75, 0x68, 0x63, 0x56, 0x42, 0x42, 0x3f, 0x34, 0x3c, 0x30, 0x30, 0x30, 0x3c, 0x30, 0x37, 0x30, 0x37, 0x30, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x40, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x34, 0x39, 0x42, 0x49, 0x49, 0x5e, 0x68, 0x67, 0x69, 0x69, 0x67, 0x61, 0x68, 0x67, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x5c, 0x6c, 0x4b, 0x66, 0x5a, 0x46, 0x74, 0x81, 0x8f, 0x94, 0x94, 0x8b, 0x79, 0x57, 0x67, 0x71, 0x68, 0x71, 0x49, 0x4b, 0x3e, 0x57, 0x7b, 0x84, 0x8a, 0x93, 0x94, 0xff, 0xb9, 0xee, 0xf2, 0xff, 0xf8, 0x95, 0x9a, 0x95, 0x94, 0x90, 0x8a, 0x81, 0x77, 0x52, 0x2f, 0x2c, 0x2a, 0x35, 0x2d, 0x2d, 0x34, 0x44, 0x3a, 0x4f, 0x5f, 0x4d, 0x2c, 0x77, 0x8f, 0x8f, 0x65, 0xa3, 0xdd, 0xf4, 0xee, 0xfa, 0xf9, 0xfa, 0xe6, 0xea, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xf2, 0xe6, 0xf2, 0xf4, 0xeb, 0x00, 0x0b, 0x5b, 0x31, 0x6c, 0x88, 0x8c, 0x74, 0x31, 0x21, 0x23, 0x21, 0x23, 0x26, 0x32, 0x31, 0x4e, 0x74, 0x82, 0x89, 0x8a, 0x8e, 0x90, 0x93, 0x94, 0x95, 0xf0, 0xee, 0xf0, 0xf8, 0xf0, 0xee, 0x95, 0x94, 0x8d, 0x84, 0x74, 0x46, 0x48, 0x5c, 0x6a, 0x75, 0x75, 0x6a, 0x6c, 0x52, 0x4e, 0x65, 0xfd, 0xfb, 0x94, 0x94, 0x92, 0x87, 0x77, 0x52, 0x45, 0x6b, 0x67, 0x6f, 0x6f, 0x60, 0x5e, 0x6f, 0x69, 0x69, 0x6f, 0x60, 0x6b, 0x60, 0x6f, 0x72, 0x72, 0x72, 0x75, 0x68, 0x63, 0x63, 0x56, 0x42, 0x55, 0x3c, 0x4f, 0x3c, 0x3c, 0x3c, 0x38, 0x30, 0x38, 0x3c, 0x38, 0x3f, 0x3f, 0x3f, 0x3f, 0x42, 0x3f, 0x49, 0x58, 0x56, 0x56, 0x63, 0x63, 0x73, 0x63, 0x72, 0x68, 0x67, 0x60, 0x5c, 0x5c, 0x5c, 0x6a, 0x60, 0x6a, 0x6f, 0x6a, 0x60, 0x60, 0x67, 0x60, 0x5c, 0x5c, 0x57, 0x52, 0x52, 0x7e, 0x8a, 0x95, 0xf4, 0xb9, 0x95, 0x8b, 0x79, 0x36, 0x48, 0x45, 0x6a, 0x69, 0x75, 0x63, 0x69, 0x60, 0x48, 0x5a, 0x52, 0x80, 0x86, 0x8f, 0x92, 0xfb, 0xb9, 0xb9, 0xb8, 0x9a, 0xf0, 0xee, 0xef, 0xff, 0x94, 0x93, 0x93, 0x8d, 0x8e, 0x84, 0x7e, 0x74, 0x6e, 0x66, 0x46, 0x45, 0x2c, 0x2e, 0x35, 0x29, 0x6e, 0x8e, 0x8c, 0x5b, 0x64, 0x0c, 0x96, 0xd9, 0xf3, 0xf0, 0xfa, 0xed, 0xea, 0xe7, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe9, 0xef, 0xef, 0xf0, 0x95, 0xc6, 0x99, 0x0d, 0x7a, 0x4d, 0x35, 0x32, 0x45, 0x8e, 0x90, 0x8f, 0x85, 0x84, 0x84, 0x87, 0x8b, 0x8a, 0x90, 0x93, 0x94, 0x94, 0x93, 0x94, 0x94, 0x95, 0xee, 0xe5, 0xb8, 0xb8, 0xee, 0xee, 0xff, 0x93, 0x93, 0x8a, 0x79, 0x2f, 0x32, 0x61, 0x72, 0x68, 0x75, 0x73, 0x73, 0x73, 0x48, 0x57, 0x79, 0x8b, 0x93, 0xfb, 0xf0, 0x94, 0x93, 0x93, 0x93, 0x90, 0x8a, 0x7e, 0x4e, 0x46, 0x5a, 0x6c, 0x6f, 0x72, 0x71, 0x73, 0x71, 0x69, 0x69, 0x5c, 0x6c, 0x6a, 0x6a, 0x6a, 0x6a, 0x60, 0x69, 0x6f, 0x6f, 0x6f, 0x78, 0x75, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x68, 0x68, 0x68, 0x68, 0x68, 0x60, 0x60, 0x60, 0x5c, 0x6c, 0x5c, 0x66, 0x5c, 0x5c, 0x67, 0x60, 0x67, 0x6b, 0x6b, 0x57, 0x4e, 0x64, 0x81, 0x90, 0x93, 0x94, 0x93, 0x91, 0x91, 0x91, 0x94, 0x91, 0x8f, 0x85, 0x7e, 0x52, 0x57, 0x4d, 0x63, 0x73, 0x71, 0x71, 0x56, 0x4b, 0x3e, 0x32, 0x5a, 0x80, 0x8c, 0x93, 0x9a, 0xba, 0xe8, 0xe6, 0xe8, 0xb9, 0xe8, 0xe6, 0xee, 0xf8, 0xff, 0xff, 0x94, 0x94, 0x94, 0x90, 0x92, 0x8f, 0x8e, 0x89, 0x88, 0x84, 0x86, 0x8e, 0x88, 0x57, 0x3e, 0x32, 0x4e, 0x07, 0x99, 0x3b, 0xf3, 0xb9, 0xe9, 0xba, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xf1, 0xf4, 0x25, 0x99, 0x04, 0x6e, 0x4d, 0x59, 0x3f, 0x39, 0x31, 0x8c, 0x91, 0xee, 0x93, 0x92, 0x93, 0xff, 0xee, 0x95, 0xf0, 0xf2, 0xf0, 0xef, 0xf8, 0xe6, 0xed, 0xe9, 0xba, 0xb8, 0xb9, 0x9a, 0xe6, 0xff, 0x95, 0x8a, 0x79, 0x31, 0x5a, 0x5e, 0x63, 0x73, 0x71, 0x71, 0x73, 0x73, 0x68, 0x6b, 0x7b, 0x88, 0x92, 0x93, 0xee, 0xff, 0x94, 0x8f, 0x85, 0x84, 0x8f, 0x90, 0x93, 0x92, 0x8e, 0x81, 0x5b, 0x4e, 0x45, 0x5a, 0x72, 0x68, 0x73, 0x68, 0x68, 0x69, 0x6a, 0x6a, 0x6b, 0x60, 0x5c, 0x60, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x72, 0x72, 0x68, 0x72, 0x68, 0x75, 0x67, 0x68, 0x5e, 0x60, 0x67, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x6f, 0x5c, 0x5c, 0x6a, 0x5c, 0x6b, 0x5a, 0x57, 0x4e, 0x77, 0x86, 0x90, 0x94, 0x93, 0x92, 0x8a, 0x7e, 0x64, 0x64, 0x8c, 0x92, 0xff, 0x95, 0x95, 0x93, 0x8a, 0x82, 0x57, 0x5a, 0x56, 0x63, 0x71, 0x70, 0x71, 0x5e, 0x5e, 0x5e, 0x35, 0x32, 0x77, 0x8c, 0x91, 0xfa, 0xf2, 0xe8, 0xe7, 0xe8, 0xe7, 0xea, 0xba, 0xf2, 0x9a, 0x9a, 0xba, 0xe6, 0xf8, 0xee, 0xb9, 0xff, 0x92, 0x92, 0x93, 0x94, 0x8a, 0x2f, 0x35, 0x4f, 0x4f, 0x6b, 0x21, 0x00, 0xa1, 0xdd, 0xf4, 0xb8, 0xba, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xed, 0xf1, 0xf3, 0xdf, 0x99, 0x01, 0x27, 0x4b, 0x59, 0x51, 0x70, 0x58, 0x2a, 0x8a, 0x9a, 0xb8, 0xed, 0xf9, 0xf1, 0xb9, 0xb8, 0xb8, 0xea, 0xe8, 0xe8, 0xed, 0xf1, 0xf1, 0xed, 0xea, 0xea, 0xe9, 0xba, 0xf8, 0x95, 0x94, 0x79, 0x2f, 0x3e, 0x70, 0x5d, 0x70, 0x70, 0x63, 0x71, 0x68, 0x61, 0x5a, 0x80, 0x88, 0x90, 0x92, 0x93, 0xe6, 0xff, 0x94, 0x89, 0x4e, 0x48, 0x48, 0x6e, 0x81, 0x8a, 0x93, 0x94, 0x94, 0x8d, 0x87, 0x77, 0x36, 0x46, 0x5a, 0x5c, 0x72, 0x68, 0x72, 0x68, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x67, 0x6f, 0x67, 0x6f, 0x67, 0x6a, 0x5c, 0x5c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6b, 0x6a, 0x60, 0x6a, 0x60, 0x5c, 0x6f, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x6a, 0x5c, 0x67, 0x60, 0x67, 0x61, 0x72, 0x67, 0x5c, 0x45, 0x48, 0x57, 0x57, 0x77, 0x84, 0x8f, 0x92, 0x93, 0x93, 0x8f, 0x87, 0x77, 0x46, 0x4d, 0x61, 0x61, 0x32, 0x82, 0x90, 0x95, 0xee, 0xff, 0x94, 0x92, 0x8e, 0x84, 0x6e, 0x3e, 0x49, 0x5e, 0x55, 0x5e, 0x56, 0x56, 0x56, 0x73, 0x33, 0x2a, 0x5b, 0x86, 0x93, 0x94, 0xfa, 0xf2, 0xf1, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xb9, 0xb9, 0xba, 0xb8, 0xb8, 0xb8, 0xfa, 0xf9, 0xe6, 0x9a, 0x8b, 0x46, 0x4a, 0x53, 0x5d, 0x3f, 0x78, 0x12, 0x99, 0xf5, 0xe4, 0x9a, 0xef, 0xf8, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xf2, 0xe6, 0xef, 0xef, 0xee, 0xed, 0xfa, 0xec, 0x0a, 0x99, 0x10, 0x76, 0x33, 0x59, 0x59, 0x5d, 0x34, 0x48, 0x8a, 0x9a, 0xe4, 0xe8, 0xf9, 0xf1, 0xb8, 0xb8, 0xe8, 0xef, 0xba, 0xee, 0xf1, 0xf1, 0xed, 0xed, 0xf2, 0xed, 0xf1, 0xf9, 0x94, 0x87, 0x36, 0x26, 0x73, 0x5f, 0x70, 0x5d, 0x70, 0x71, 0x71, 0x69, 0x32, 0x74, 0x88, 0x92, 0xfe, 0xfb, 0xf8, 0xff, 0x93, 0x92, 0x7e, 0x24, 0x48, 0x61, 0x73, 0x60, 0x57, 0x5b, 0x79, 0x8a, 0x90, 0x93, 0x93, 0x93, 0x8f, 0x85, 0x64, 0x5b, 0x46, 0x5a, 0x6b, 0x60, 0x6f, 0x6b, 0x6f, 0x6f, 0x67, 0x6f, 0x72, 0x67, 0x67, 0x72, 0x6f, 0x6a, 0x6a, 0x6f, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c, 0x6a, 0x6c, 0x5c, 0x6c, 0x5c, 0x6c, 0x5c, 0x6c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x4b, 0x5c, 0x5c, 0x5c, 0x6b, 0x5c, 0x60, 0x5a, 0x46, 0x52, 0x74, 0x84, 0x8e, 0x90, 0x91, 0x91, 0x93, 0x8b, 0x81, 0x76, 0x5a, 0x6c, 0x6b, 0x69, 0x73, 0x5f, 0x68, 0x26, 0x4e, 0x86, 0x93, 0x91, 0xff, 0xff, 0xfb, 0x93, 0x90, 0x86, 0x74, 0x45, 0x5e, 0x44, 0x63, 0x69, 0x56, 0x55, 0x58, 0x73, 0x35, 0x26, 0x74, 0x87, 0x92, 0x91, 0xff, 0xe6, 0xf1, 0xf1, 0xf8, 0xf1, 0xe9, 0xe9, 0xef, 0xea, 0xb8, 0xe7, 0xf1, 0xf1, 0xe8, 0xb9, 0x93, 0x6e, 0x30, 0x53, 0x5d, 0x4f, 0x61, 0x46, 0x07, 0x99, 0xc7, 0xf4, 0xfb, 0xf8, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xf0, 0xed, 0xee, 0xf2, 0xef, 0xf4, 0xc6, 0x99, 0x04, 0x5b, 0x49, 0x4f, 0x53, 0x50, 0x50, 0x2d, 0x6e, 0x90, 0xb9, 0xb8, 0xea, 0xf9, 0xf1, 0xea, 0xe8, 0xf0, 0xf8, 0xb9, 0xee, 0xf8, 0xee, 0xef, 0xe8, 0xe7, 0xe6, 0x95, 0x93, 0x36, 0x1a, 0x2a, 0x61, 0x4a, 0x70, 0x70, 0x71, 0x56, 0x71, 0x4d, 0x48, 0x84, 0x8f, 0x94, 0xe9, 0xba, 0xe7, 0xf2, 0x91, 0x8f, 0x64, 0x24, 0x4b, 0x78, 0x58, 0x62, 0x73, 0x5e, 0x6c, 0x57, 0x46, 0x74, 0x8b, 0x93, 0x91, 0xff, 0x94, 0x93, 0x8b, 0x81, 0x77, 0x4e, 0x46, 0x57, 0x5a, 0x5a, 0x6b, 0x6c, 0x6b, 0x6b, 0x6f, 0x6f, 0x67, 0x67, 0x67, 0x67, 0x72, 0x6f, 0x75, 0x67, 0x72, 0x75, 0x72, 0x68, 0x6f, 0x6a, 0x6f, 0x5c, 0x6a, 0x5c, 0x6a, 0x5c, 0x5c, 0x5c, 0x5c, 0x4b, 0x67, 0x6f, 0x6c, 0x5a, 0x45, 0x46, 0x29, 0x2f, 0x5b, 0x7c, 0x87, 0x8a, 0x90, 0x93, 0xff, 0xba, 0x9a, 0xf4, 0x83, 0x65, 0x57, 0x61, 0x73, 0x72, 0x6f, 0x5e, 0x71, 0x55, 0x73, 0x68, 0x2d, 0x29, 0x77, 0x90, 0x94, 0xe6, 0xb8, 0xb9, 0xee, 0x94, 0x90, 0x84, 0x57, 0x60, 0x5e, 0x55, 0x62, 0x71, 0x70, 0x44, 0x56, 0x5e, 0x23, 0x20, 0x65, 0x92, 0xff, 0xe6, 0xf2, 0xfb, 0xfb, 0xf8, 0xf2, 0xba, 0xfa, 0xef, 0xe8, 0xef, 0xf9, 0xf1, 0xb9, 0xb9, 0x93, 0x80, 0x39, 0x43, 0x50, 0x4c, 0x63, 0x6c, 0x17, 0x97, 0xa1, 0xe2, 0xfb, 0xfa, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf2, 0xef, 0xf2, 0xe6, 0xf3, 0xfd, 0xbb, 0x97, 0x1b, 0x5c, 0x4a, 0x5d, 0x3c, 0x49, 0x49, 0x2a, 0x84, 0x93, 0xee, 0xb8, 0xf1, 0xfa, 0xf8, 0xef, 0xee, 0xf9, 0xff, 0xb9, 0xee, 0xee, 0xee, 0xb9, 0xb8, 0xba, 0xf4, 0x83, 0x10, 0x18, 0x33, 0x73, 0x58, 0x73, 0x62, 0x56, 0x5e, 0x5c, 0x48, 0x80, 0x8e, 0x90, 0x91, 0xe6, 0xb8, 0xb8, 0xb9, 0x94, 0x89, 0x2f, 0x26, 0x78, 0x63, 0x49, 0x69, 0x71, 0x56, 0x71, 0x56, 0x68, 0x72, 0x48, 0x8b, 0xf9, 0xfb, 0xf8, 0xe9, 0xf2, 0xf0, 0x95, 0x93, 0x8d, 0x87, 0x7c, 0x77, 0x4e, 0x4e, 0x4e, 0x57, 0x57, 0x57, 0x6c, 0x76, 0x6c, 0x60, 0x6f, 0x67, 0x72, 0x67, 0x72, 0x67, 0x72, 0x72, 0x67, 0x68, 0x61, 0x68, 0x68, 0x67, 0x67, 0x60, 0x67, 0x6b, 0x6b, 0x6f, 0x6b, 0x48, 0x48, 0x31, 0x4e, 0x64, 0x79, 0x85, 0x8b, 0x90, 0x94, 0xff, 0xf0, 0xf8, 0xf8, 0xba, 0xba, 0xb8, 0xff, 0x90, 0x81, 0x48, 0x73, 0x73, 0x63, 0x5e, 0x69, 0x5e, 0x5e, 0x55, 0x42, 0x73, 0x61, 0x21, 0x2f, 0x89, 0x94, 0x9a, 0xb9, 0xb8, 0xba, 0xfa, 0x93, 0x8f, 0x7c, 0x31, 0x61, 0x4f, 0x5d, 0x50, 0x55, 0x56, 0x44, 0x5e, 0x45, 0x17, 0x10, 0x83, 0xf4, 0x9a, 0xe6, 0xf0, 0xed, 0x9a, 0xb9, 0xfa, 0xf0, 0xf0, 0xfa, 0xf9, 0xf9, 0xe8, 0x9a, 0x93, 0x8c, 0x3e, 0x4b, 0x62, 0x4c, 0x4f, 0x5e, 0x57, 0x0d, 0x99, 0x15, 0xf3, 0xfb, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xf4, 0xc6, 0x99, 0x09, 0x66, 0x63, 0x59, 0x5d, 0x3c, 0x5e, 0x2e, 0x52, 0x92, 0x91, 0xf2, 0xed, 0xe9, 0xf0, 0xee, 0xee, 0xed, 0xfa, 0xee, 0xb9, 0xee, 0xee, 0xe9, 0xb8, 0xb9, 0xf4, 0x6d, 0x07, 0x12, 0x72, 0x5d, 0x5f, 0x63, 0x56, 0x56, 0x68, 0x3e, 0x57, 0x84, 0x8f, 0x92, 0xf8, 0xee, 0xba, 0xb8, 0xe5, 0x93, 0x8a, 0x20, 0x35, 0x75, 0x38, 0x71, 0x5e, 0x5e, 0x4b, 0x71, 0x62, 0x73, 0x61, 0x60, 0x80, 0x95, 0x91, 0xf8, 0xed, 0xf2, 0xe6, 0xef, 0xef, 0xf0, 0xf0, 0x94, 0x92, 0x8f, 0x8a, 0x85, 0x79, 0x77, 0x64, 0x4e, 0x2f, 0x2f, 0x46, 0x57, 0x57, 0x57, 0x66, 0x5a, 0x6c, 0x6c, 0x6b, 0x5a, 0x6b, 0x60, 0x60, 0x60, 0x60, 0x5a, 0x5a, 0x48, 0x48, 0x48, 0x32, 0x31, 0x4e, 0x5b, 0x7c, 0x84, 0x8a, 0x8f, 0x93, 0x93, 0xff, 0xff, 0x9a, 0xe7, 0xba, 0xf2, 0xf2, 0xe7, 0xb8, 0xb9, 0xe6, 0x93, 0x8e, 0x74, 0x5a, 0x75, 0x68, 0x58, 0x62, 0x55, 0x63, 0x68, 0x56, 0x58, 0x49, 0x73, 0x23, 0x24, 0x85, 0x91, 0xf8, 0xba, 0x9a, 0xf2, 0xf0, 0xfb, 0x93, 0x89, 0x48, 0x35, 0x4f, 0x62, 0x55, 0x44, 0x49, 0x44, 0x2e, 0x5c, 0x13, 0x06, 0xce, 0xf4, 0xf2, 0xf2, 0xf2, 0xb9, 0xb9, 0xe9, 0xee, 0xf0, 0xfa, 0xf9, 0xf1, 0xed, 0xef, 0x91, 0x8f, 0x5b, 0x4b, 0x55, 0x53, 0x53, 0x50, 0x4b, 0x20, 0x01, 0x01, 0xe6, 0xf2, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xf2, 0xe6, 0xf2, 0xec, 0xf4, 0xe0, 0x9e, 0x00, 0x20, 0x72, 0x59, 0x47, 0x5d, 0x4a, 0x56, 0x2c, 0x89, 0xff, 0xe9, 0xf8, 0xf2, 0xe6, 0xba, 0xb9, 0xb9, 0xba, 0xe8, 0xed, 0xef, 0xfa, 0xfa, 0xf0, 0xf3, 0xf4, 0xc6, 0x03, 0x16, 0x72, 0x61, 0x4f, 0x4c, 0x5d, 0x5d, 0x71, 0x4b, 0x7b, 0x8e, 0x93, 0xf8, 0xed, 0xea, 0xe9, 0xe6, 0xf8, 0x94, 0x85, 0x1c, 0x4b, 0x63, 0x51, 0x70, 0x5f, 0x56, 0x5e, 0x5e, 0x62, 0x62, 0x73, 0x45, 0x64, 0x90, 0xb9, 0xb9, 0x9a, 0xf3, 0xf0, 0xf9, 0xfa, 0xf8, 0xed, 0xef, 0x9a, 0xe6, 0xef, 0x95, 0x95, 0x93, 0x92, 0x8f, 0x8a, 0x87, 0x84, 0x7e, 0x77, 0x64, 0x64, 0x5b, 0x36, 0x5b, 0x4e, 0x4e, 0x4e, 0x52, 0x5b, 0x5b, 0x5b, 0x64, 0x64, 0x77, 0x79, 0x81, 0x85, 0x8c, 0x8f, 0x90, 0x94, 0x94, 0x94, 0xff, 0xf8, 0xf8, 0xf2, 0xba, 0xe9, 0xe8, 0xba, 0xed, 0xf8, 0xfe, 0xf9, 0xea, 0xe8, 0xba, 0xff, 0x93, 0x8c, 0x74, 0x2c, 0x75, 0x5f, 0x5f, 0x70, 0x58, 0x42, 0x63, 0x62, 0x5f, 0x4a, 0x73, 0x32, 0x1a, 0x81, 0x92, 0x91, 0xf8, 0xf2, 0xf2, 0xf2, 0xed, 0x95, 0x90, 0x7e, 0x26, 0x39, 0x62, 0x5d, 0x70, 0x59, 0x5d, 0x4a, 0x6c, 0x13, 0x02, 0xbf, 0x95, 0xf1, 0xf8, 0xfb, 0xba, 0xb9, 0xba, 0xe9, 0xff, 0xf0, 0xed, 0xf2, 0xf1, 0xfa, 0x93, 0x85, 0x2e, 0x4f, 0x5f, 0x54, 0x5d, 0x55, 0x6c, 0x0d, 0x99, 0xc7, 0xf3, 0xe9, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xf0, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xec, 0xf2, 0xec, 0xf4, 0xc6, 0x99, 0x09, 0x5a, 0x4a, 0x50, 0x62, 0x5d, 0x59, 0x4d, 0x52, 0x92, 0xe6, 0xf2, 0xed, 0xf0, 0xe8, 0xba, 0xb9, 0xba, 0xba, 0xe9, 0xea, 0xf1, 0xed, 0xf1, 0xf0, 0xba, 0x15, 0x02, 0x12, 0x5c, 0x5f, 0x3a, 0x63, 0x70, 0x51, 0x5f, 0x35, 0x82, 0x8f, 0xff, 0xf8, 0xf1, 0xe6, 0xb8, 0xb8, 0xba, 0x93, 0x86, 0x21, 0x2a, 0x75, 0x50, 0x62, 0x5f, 0x5f, 0x73, 0x63, 0x63, 0x62, 0x63, 0x4d, 0x46, 0x85, 0xff, 0xb9, 0xb9, 0xe9, 0xf8, 0xf0, 0xf0, 0xfa, 0xf1, 0xf0, 0xed, 0xe9, 0xea, 0xba, 0xe9, 0xf8, 0xf8, 0xff, 0x94, 0x93, 0x93, 0x92, 0x93, 0x92, 0x92, 0x8d, 0x8d, 0x8d, 0x8b, 0x8a, 0x8b, 0x8a, 0x8a, 0x8b, 0x8b, 0x8d, 0x8d, 0x91, 0x92, 0x93, 0x93, 0x93, 0x94, 0x94, 0xff, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xe9, 0xef, 0xe9, 0xed, 0xe9, 0xba, 0xed, 0xfa, 0xf9, 0xf1, 0xf0, 0xe7, 0xba, 0xed, 0xff, 0x91, 0x89, 0x46, 0x60, 0x70, 0x5f, 0x63, 0x58, 0x58, 0x5f, 0x4f, 0x5f, 0x51, 0x5f, 0x73, 0x35, 0x1c, 0x77, 0x94, 0xee, 0xe9, 0xf1, 0xf9, 0xf0, 0xf0, 0x9a, 0x91, 0x85, 0x57, 0x2d, 0x59, 0x51, 0x59, 0x54, 0x53, 0x4b, 0x57, 0x12, 0x03, 0x15, 0xf2, 0xf2, 0xba, 0xe6, 0xe8, 0xba, 0xba, 0xef, 0xef, 0xed, 0xf1, 0xed, 0xfa, 0xf2, 0x90, 0x57, 0x42, 0x5d, 0x5d, 0x53, 0x53, 0x68, 0x1a, 0x97, 0xf5, 0xe6, 0xef, 0xf0, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf0, 0xf8, 0xe9, 0xb9, 0xba, 0xe6, 0xf2, 0xee, 0xf3, 0xf3, 0xf5, 0x99, 0x16, 0x73, 0x47, 0x55, 0x44, 0x56, 0x59, 0x3e, 0x85, 0x9a, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xf2, 0xf8, 0xf2, 0xf2, 0xf3, 0xf6, 0x97, 0x0e, 0x5a, 0x58, 0x54, 0x5d, 0x43, 0x62, 0x4f, 0x5a, 0x82, 0x92, 0x9a, 0xb9, 0xb8, 0xf8, 0xfb, 0xe5, 0xb8, 0xf4, 0x86, 0x21, 0x2b, 0x58, 0x56, 0x56, 0x55, 0x56, 0x58, 0x62, 0x62, 0x55, 0x63, 0x61, 0x3e, 0x7c, 0x93, 0x9a, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xed, 0xe9, 0xef, 0xf0, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xed, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xf0, 0x93, 0x84, 0x48, 0x61, 0x63, 0x55, 0x55, 0x55, 0x62, 0x58, 0x5f, 0x70, 0x4f, 0x4f, 0x73, 0x39, 0x1c, 0x7f, 0xee, 0xe6, 0xf9, 0xfe, 0xf9, 0xf2, 0xba, 0xba, 0x94, 0x89, 0x6e, 0x28, 0x58, 0x50, 0x50, 0x50, 0x3a, 0x71, 0x5c, 0x16, 0x02, 0xf6, 0xf3, 0xe8, 0xf0, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xff, 0x7e, 0x35, 0x70, 0x54, 0x55, 0x62, 0x58, 0x6b, 0x09, 0x96, 0xd9, 0xf4, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xf1, 0xed, 0xe9, 0xe9, 0xba, 0xe9, 0xef, 0xf0, 0xf4, 0xdd, 0x9c, 0x01, 0x29, 0x56, 0x5d, 0x44, 0x44, 0x63, 0x33, 0x7a, 0x8f, 0xe6, 0xef, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xef, 0xed, 0xee, 0xf9, 0xfe, 0xfa, 0xff, 0xfc, 0x97, 0x0d, 0x4d, 0x5f, 0x51, 0x54, 0x54, 0x62, 0x42, 0x48, 0x88, 0x90, 0x91, 0xf8, 0xe6, 0xf2, 0xfa, 0xf8, 0xee, 0x9a, 0x8b, 0x1d, 0x23, 0x5f, 0x58, 0x58, 0x55, 0x62, 0x58, 0x56, 0x56, 0x55, 0x58, 0x55, 0x5a, 0x52, 0x8d, 0x91, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xf8, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xef, 0xee, 0xff, 0x90, 0x7e, 0x35, 0x73, 0x62, 0x62, 0x56, 0x58, 0x58, 0x4f, 0x62, 0x62, 0x4f, 0x5d, 0x73, 0x2e, 0x1b, 0x8b, 0xff, 0xf9, 0xf9, 0xef, 0xf2, 0xe9, 0xf2, 0x94, 0x93, 0x8c, 0x6e, 0x2e, 0x49, 0x58, 0x4f, 0x40, 0x4a, 0x56, 0x5a, 0x13, 0x01, 0xc6, 0x95, 0x91, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xef, 0xfb, 0x8c, 0x5a, 0x59, 0x70, 0x43, 0x55, 0x62, 0x72, 0x1a, 0x99, 0xbf, 0xf4, 0xef, 0xed, 0xf2, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xe9, 0xe9, 0xee, 0xf2, 0xe6, 0xf4, 0xc7, 0x99, 0x09, 0x66, 0x56, 0x54, 0x53, 0x43, 0x5e, 0x23, 0x8c, 0x92, 0xb9, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xef, 0xf8, 0xfb, 0xf4, 0x15, 0x97, 0x09, 0x23, 0x61, 0x40, 0x70, 0x40, 0x51, 0x4f, 0x32, 0x82, 0x91, 0x91, 0xe6, 0xf8, 0xfa, 0xfa, 0xef, 0xfa, 0xff, 0x90, 0x1b, 0x21, 0x61, 0x5f, 0x4f, 0x55, 0x62, 0x5f, 0x62, 0x55, 0x56, 0x56, 0x58, 0x4d, 0x29, 0x87, 0x94, 0xe6, 0xf8, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xf0, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0x95, 0x8f, 0x74, 0x35, 0x5f, 0x62, 0x56, 0x56, 0x56, 0x4f, 0x56, 0x63, 0x58, 0x5f, 0x51, 0x70, 0x26, 0x1f, 0x92, 0xf8, 0xe6, 0xb8, 0xea, 0xfa, 0xf9, 0xff, 0xff, 0x95, 0x8e, 0x52, 0x28, 0x4d, 0x4a, 0x4f, 0x53, 0x34, 0x4b, 0x52, 0x13, 0x02, 0x3b, 0xf4, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xef, 0xf0, 0x92, 0x80, 0x33, 0x5d, 0x50, 0x44, 0x62, 0x5f, 0x48, 0x01, 0xa3, 0xf4, 0xed, 0xef, 0xf2, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xe9, 0xe9, 0xe6, 0xf3, 0xfb, 0xf6, 0x96, 0x13, 0x5c, 0x58, 0x53, 0x53, 0x58, 0x3e, 0x74, 0x90, 0xfd, 0x9a, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xea, 0x95, 0xdd, 0x01, 0x07, 0x21, 0x69, 0x3c, 0x59, 0x53, 0x4f, 0x4f, 0x35, 0x80, 0x93, 0x9a, 0xb8, 0xed, 0xfb, 0xf9, 0xfa, 0xf8, 0xf8, 0x94, 0x1f, 0x1a, 0x61, 0x4a, 0x4c, 0x55, 0x58, 0x62, 0x59, 0x62, 0x55, 0x56, 0x56, 0x61, 0x32, 0x7e, 0x93, 0xe5, 0xf2, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xe9, 0xf0, 0xef, 0xe9, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xe6, 0xf2, 0xb9, 0xff, 0x8e, 0x6e, 0x4d, 0x63, 0x56, 0x56, 0x62, 0x62, 0x58, 0x49, 0x5f, 0x70, 0x54, 0x51, 0x75, 0x1c, 0x36, 0x92, 0xe5, 0xb8, 0xf0, 0xf9, 0xf9, 0xf2, 0xb9, 0xb8, 0x94, 0x89, 0x48, 0x4d, 0x4f, 0x4f, 0x50, 0x50, 0x56, 0x35, 0x6c, 0x13, 0x0c, 0xf4, 0xef, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0x94, 0x8c, 0x5a, 0x62, 0x55, 0x50, 0x62, 0x5d, 0x78, 0x0b, 0xbb, 0xf7, 0xf2, 0xed, 0xf2, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xed, 0xe9, 0xe6, 0xf2, 0xf8, 0x05, 0x02, 0x1c, 0x6a, 0x42, 0x70, 0x40, 0x63, 0x2c, 0x89, 0x92, 0xf2, 0xe6, 0xe9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xb8, 0x9a, 0xfc, 0x06, 0x1c, 0x5e, 0x3c, 0x4c, 0x53, 0x3c, 0x58, 0x28, 0x80, 0x8e, 0x95, 0xe5, 0xb8, 0xb9, 0xf9, 0xf9, 0xf0, 0xee, 0xf4, 0x79, 0x0e, 0x35, 0x4f, 0x4a, 0x50, 0x55, 0x44, 0x58, 0x5f, 0x62, 0x50, 0x62, 0x58, 0x35, 0x52, 0x8e, 0x95, 0xba, 0xe9, 0xf1, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xee, 0xee, 0xe6, 0xee, 0xee, 0xee, 0xe9, 0xee, 0xee, 0xe9, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe6, 0xe7, 0xee, 0x94, 0x86, 0x57, 0x4d, 0x61, 0x5f, 0x5d, 0x5f, 0x62, 0x58, 0x63, 0x59, 0x5d, 0x54, 0x59, 0x72, 0x16, 0x8a, 0xee, 0xb8, 0xf0, 0xf9, 0xf9, 0xef, 0xb8, 0xb9, 0xee, 0x93, 0x82, 0x35, 0x5f, 0x59, 0x53, 0x50, 0x3a, 0x4f, 0x61, 0x46, 0x14, 0xe2, 0x9a, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0x92, 0x7b, 0x2e, 0x62, 0x53, 0x53, 0x53, 0x78, 0x13, 0x97, 0xdd, 0xf4, 0xec, 0xf3, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xb9, 0xed, 0xef, 0xf0, 0xf0, 0xe9, 0xe5, 0x95, 0xdf, 0x00, 0x06, 0x32, 0x56, 0x3f, 0x53, 0x5f, 0x2a, 0x7c, 0x90, 0xee, 0xba, 0xba, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf8, 0x11, 0x1c, 0x60, 0x51, 0x54, 0x51, 0x51, 0x4f, 0x33, 0x7b, 0x90, 0x93, 0xf8, 0xe9, 0xe8, 0xef, 0xe9, 0xf0, 0xe9, 0xe9, 0x94, 0x14, 0x18, 0x61, 0x5d, 0x53, 0x50, 0x44, 0x56, 0x58, 0x5f, 0x55, 0x4c, 0x5f, 0x33, 0x46, 0x89, 0x94, 0xff, 0xf1, 0xed, 0xea, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xed, 0xe9, 0xe9, 0xed, 0xe9, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf1, 0xfa, 0xee, 0xff, 0x94, 0x8a, 0x46, 0x35, 0x70, 0x59, 0x70, 0x5f, 0x5f, 0x58, 0x58, 0x59, 0x5d, 0x51, 0x62, 0x32, 0x20, 0x92, 0xef, 0xf0, 0xf9, 0xf1, 0xf2, 0xe8, 0xb8, 0xf2, 0x94, 0x90, 0x6e, 0x2b, 0x59, 0x51, 0x53, 0x5d, 0x4f, 0x33, 0x31, 0x79, 0xf4, 0xee, 0xef, 0xe6, 0xf2, 0xee, 0xe6, 0xef, 0xee, 0xee, 0xee, 0xf0, 0xf8, 0xfb, 0x8f, 0x46, 0x43, 0x53, 0x5d, 0x50, 0x63, 0x27, 0x03, 0xcc, 0xf4, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xb9, 0xe6, 0xf0, 0xf8, 0xf1, 0xf2, 0xba, 0xf4, 0x6d, 0x96, 0x09, 0x5c, 0x3f, 0x55, 0x62, 0x4d, 0x32, 0x89, 0x93, 0xe6, 0x9a, 0xe6, 0xef, 0xef, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0x94, 0x7f, 0x1b, 0x21, 0x63, 0x59, 0x59, 0x58, 0x2a, 0x7a, 0x90, 0xfb, 0xf8, 0xfe, 0xfb, 0xfa, 0xe9, 0xea, 0xba, 0xe9, 0xf3, 0x7f, 0x07, 0x2a, 0x58, 0x4a, 0x53, 0x55, 0x50, 0x55, 0x58, 0x42, 0x58, 0x58, 0x5f, 0x35, 0x7e, 0x92, 0xff, 0xfa, 0xfa, 0xf1, 0xea, 0xf0, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xf9, 0xf9, 0xf9, 0xee, 0xb9, 0x95, 0x84, 0x48, 0x58, 0x5f, 0x59, 0x5d, 0x5f, 0x58, 0x56, 0x56, 0x53, 0x5d, 0x5f, 0x4d, 0x1c, 0x87, 0xfa, 0xfa, 0xef, 0xed, 0xe8, 0xe9, 0xed, 0xf0, 0xfb, 0x94, 0x8a, 0x6e, 0x2a, 0x4f, 0x33, 0x2e, 0x2c, 0x5a, 0x8c, 0x90, 0xf8, 0xed, 0xed, 0xee, 0xed, 0xf2, 0xf2, 0xee, 0xed, 0xee, 0xed, 0xef, 0xfa, 0xe6, 0x93, 0x82, 0x35, 0x62, 0x5d, 0x43, 0x5e, 0x31, 0x07, 0xc6, 0xf4, 0xed, 0xee, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xb8, 0xe9, 0xed, 0xfa, 0xfa, 0xe9, 0x9a, 0xf4, 0x25, 0x99, 0x13, 0x60, 0x50, 0x4f, 0x56, 0x2a, 0x7c, 0x92, 0xf8, 0xba, 0xea, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xfa, 0xff, 0x94, 0x8b, 0x64, 0x24, 0x32, 0x2a, 0x31, 0x82, 0x92, 0xe6, 0xb8, 0xef, 0xfb, 0xf9, 0xf8, 0xef, 0xea, 0xba, 0xee, 0xf4, 0x22, 0x0d, 0x35, 0x4f, 0x59, 0x55, 0x50, 0x50, 0x4f, 0x58, 0x56, 0x56, 0x61, 0x2a, 0x74, 0x90, 0xff, 0xef, 0xf0, 0xfa, 0xef, 0xea, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xef, 0x91, 0xfa, 0xed, 0xb9, 0xb9, 0x93, 0x84, 0x32, 0x4d, 0x61, 0x5f, 0x5f, 0x4f, 0x58, 0x56, 0x55, 0x5d, 0x4f, 0x63, 0x21, 0x79, 0xf8, 0xff, 0xe9, 0xe9, 0xea, 0xed, 0xf0, 0xf1, 0xf8, 0xf3, 0x9a, 0x8b, 0x82, 0x74, 0x7b, 0x7e, 0x84, 0x8c, 0x82, 0x7f, 0xf3, 0xed, 0xe6, 0xf2, 0xf2, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xee, 0xf8, 0xee, 0xfb, 0x8f, 0x57, 0x42, 0x50, 0x55, 0x4b, 0x60, 0x0d, 0xc2, 0xf4, 0xef, 0xef, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xb9, 0xe6, 0xfa, 0xf9, 0xfa, 0xe9, 0xba, 0xf4, 0x25, 0x99, 0x17, 0x60, 0x4a, 0x62, 0x42, 0x31, 0x89, 0xff, 0xe6, 0xe9, 0xe6, 0xf2, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xec, 0x7d, 0xfd, 0x93, 0x8c, 0x82, 0x77, 0x87, 0x94, 0xee, 0xb9, 0xba, 0x9a, 0xf8, 0xfa, 0xf0, 0xef, 0xba, 0xee, 0xef, 0x95, 0x19, 0x18, 0x39, 0x5f, 0x5f, 0x3c, 0x5f, 0x59, 0x5d, 0x4f, 0x49, 0x58, 0x35, 0x4e, 0x8e, 0xff, 0xee, 0xe9, 0xea, 0xe9, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xb9, 0xee, 0xef, 0xef, 0xed, 0xe6, 0xff, 0x93, 0x84, 0x46, 0x3e, 0x56, 0x5f, 0x59, 0x5f, 0x56, 0x3f, 0x62, 0x5f, 0x5e, 0x21, 0x79, 0xf0, 0xf8, 0xee, 0xe9, 0xe9, 0xe9, 0xf2, 0xef, 0xe9, 0xe9, 0xb9, 0xb9, 0x93, 0x90, 0x90, 0x90, 0x84, 0x7a, 0x24, 0x0d, 0xdb, 0x95, 0xf2, 0xe6, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xfb, 0xfe, 0x91, 0x84, 0x3e, 0x3f, 0x55, 0x56, 0x60, 0x12, 0xc2, 0xf4, 0xf2, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xb8, 0xba, 0xf8, 0xf9, 0xf1, 0xf2, 0xba, 0xf4, 0x25, 0x96, 0x1f, 0x6a, 0x53, 0x5f, 0x2d, 0x7c, 0x90, 0xee, 0xf2, 0xe6, 0xf0, 0xef, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0x95, 0xbf, 0x01, 0x11, 0x7f, 0x8e, 0x92, 0x92, 0x94, 0xf8, 0xe9, 0xe9, 0xba, 0xed, 0xed, 0xe6, 0xe9, 0xba, 0xef, 0xef, 0x94, 0xff, 0x5b, 0x18, 0x49, 0x4f, 0x4f, 0x4f, 0x59, 0x54, 0x51, 0x59, 0x56, 0x2d, 0x48, 0x8a, 0x94, 0xee, 0xea, 0xba, 0xe8, 0xb9, 0xe9, 0xee, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xef, 0xf0, 0xed, 0xe9, 0xed, 0xba, 0xed, 0xba, 0xed, 0xba, 0xed, 0xe9, 0xe9, 0xe9, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xba, 0xb9, 0xb9, 0xba, 0xf9, 0xf9, 0xf1, 0x9a, 0xe6, 0x92, 0x88, 0x66, 0x2e, 0x58, 0x59, 0x59, 0x4f, 0x55, 0x55, 0x30, 0x2e, 0x46, 0x8a, 0xee, 0xe6, 0xee, 0xee, 0xe9, 0xe9, 0xe7, 0xe8, 0xe9, 0xef, 0xf0, 0xfe, 0xf9, 0xf9, 0x94, 0x87, 0x32, 0x38, 0x58, 0x16, 0x04, 0xf7, 0xf3, 0xf2, 0xed, 0xf2, 0xed, 0xef, 0xed, 0xef, 0xed, 0xba, 0x9a, 0xfa, 0xfe, 0xf9, 0x8f, 0x6e, 0x39, 0x53, 0x49, 0x73, 0x12, 0xc6, 0xf3, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xba, 0xe6, 0xee, 0xfa, 0xfa, 0xed, 0xe8, 0xf4, 0xce, 0x00, 0x20, 0x5e, 0x55, 0x56, 0x48, 0x8c, 0x95, 0xb9, 0xba, 0xee, 0xee, 0xef, 0xed, 0xef, 0xe9, 0xba, 0xed, 0xef, 0xf8, 0xf1, 0xf8, 0xf4, 0xcc, 0x02, 0x06, 0x24, 0x5a, 0x7a, 0x8a, 0x94, 0xe6, 0xf2, 0xed, 0xef, 0xed, 0xee, 0xe9, 0xe9, 0xe9, 0xef, 0xef, 0xee, 0xf0, 0xff, 0x8e, 0x24, 0x26, 0x4d, 0x33, 0x61, 0x4f, 0x59, 0x5f, 0x42, 0x2c, 0x4e, 0x87, 0x93, 0xff, 0xee, 0xe9, 0xe9, 0xba, 0xe9, 0xee, 0xf0, 0xf0, 0xe9, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xe9, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xb9, 0xba, 0xed, 0xef, 0xf1, 0xf0, 0xe6, 0xe9, 0xff, 0x94, 0x8d, 0x84, 0x6e, 0x48, 0x3e, 0x3e, 0x3e, 0x5a, 0x74, 0x86, 0x8d, 0xff, 0xee, 0xee, 0xf0, 0xee, 0xba, 0xb9, 0xb8, 0xba, 0xe9, 0xf0, 0xf8, 0xf0, 0xf0, 0xf1, 0xff, 0x86, 0x2d, 0x59, 0x3f, 0x32, 0x09, 0x15, 0xf4, 0xb8, 0xe9, 0xf9, 0xf8, 0xe9, 0xba, 0xef, 0xef, 0xed, 0xb9, 0xef, 0xf9, 0x91, 0x93, 0x85, 0x32, 0x4f, 0x59, 0x75, 0x16, 0xc7, 0xf3, 0xf2, 0xed, 0xe6, 0xe9, 0xef, 0xed, 0xe9, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf8, 0xba, 0xee, 0xba, 0xf8, 0xf0, 0xf1, 0xb9, 0xf3, 0x6d, 0x02, 0x24, 0x5e, 0x56, 0x35, 0x80, 0x90, 0xee, 0xb8, 0xba, 0xee, 0xee, 0xed, 0xf1, 0xef, 0xe6, 0xb9, 0xe9, 0xef, 0xf9, 0xfb, 0xf2, 0xee, 0x0a, 0x01, 0x12, 0x6a, 0x58, 0x4d, 0x87, 0x9a, 0xed, 0xea, 0xf8, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xf8, 0x94, 0x89, 0x77, 0x46, 0x32, 0x26, 0x2a, 0x2a, 0x23, 0x45, 0x74, 0x8b, 0x95, 0xfe, 0xf8, 0xf2, 0xee, 0xba, 0xe9, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xe9, 0xf0, 0xef, 0xe9, 0xf0, 0xf9, 0x90, 0x8f, 0x89, 0x82, 0x84, 0x8c, 0x8c, 0x90, 0x93, 0xe6, 0xe6, 0xf8, 0xf8, 0xee, 0xf3, 0xe6, 0xb9, 0xe8, 0xba, 0xed, 0xf0, 0xef, 0xef, 0xe7, 0xe9, 0x95, 0x88, 0x38, 0x4a, 0x39, 0x4b, 0x16, 0x06, 0xf7, 0xb9, 0xe9, 0xfe, 0xf9, 0xe9, 0xb8, 0xef, 0xed, 0xef, 0xe8, 0xba, 0xfa, 0xfe, 0x94, 0x8d, 0x5b, 0x58, 0x54, 0x5e, 0x17, 0x25, 0xf4, 0xef, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xe9, 0xba, 0xf0, 0xff, 0xf1, 0xe8, 0x9a, 0xe2, 0x03, 0x29, 0x5e, 0x4b, 0x31, 0x8e, 0x92, 0xed, 0xba, 0xb9, 0xee, 0xee, 0xef, 0xf1, 0xed, 0xe9, 0xba, 0xee, 0xf2, 0xed, 0xf8, 0xf4, 0xd9, 0x97, 0x06, 0x24, 0x3e, 0x3c, 0x2e, 0x85, 0xff, 0xba, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xef, 0xf0, 0xed, 0xef, 0xf0, 0xff, 0x92, 0x8f, 0x89, 0x86, 0x82, 0x7e, 0x84, 0x8a, 0x90, 0x94, 0xfe, 0xf8, 0xfb, 0xee, 0x9a, 0xee, 0xba, 0xef, 0xf0, 0xf0, 0xf0, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xf9, 0xf9, 0xfe, 0x95, 0x95, 0x94, 0x93, 0x93, 0x93, 0x95, 0xf4, 0xf2, 0xe5, 0xef, 0xec, 0xef, 0xf2, 0xe9, 0xba, 0xe9, 0xed, 0xef, 0xfa, 0xef, 0xea, 0xe9, 0xff, 0x8c, 0x30, 0x30, 0x3f, 0x39, 0x26, 0x06, 0xeb, 0xf4, 0xe5, 0xf9, 0xfa, 0xba, 0xb9, 0xef, 0xf0, 0xed, 0xe8, 0xe9, 0xf8, 0xff, 0xff, 0x93, 0x84, 0x4d, 0x38, 0x69, 0x17, 0x6d, 0xf3, 0xed, 0xef, 0xe9, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xe9, 0xf0, 0xf8, 0xfa, 0xe7, 0xf3, 0xfd, 0x06, 0x24, 0x69, 0x2c, 0x7e, 0x92, 0xff, 0xf8, 0xe9, 0xe9, 0xef, 0xed, 0xf0, 0xf1, 0xed, 0xee, 0xba, 0xe9, 0xea, 0xf1, 0xed, 0xf4, 0xf6, 0x97, 0x0e, 0x45, 0x2d, 0x4f, 0x2d, 0x85, 0x95, 0xed, 0xea, 0xed, 0xed, 0xba, 0xed, 0xe9, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe7, 0xe8, 0xf8, 0x91, 0x8f, 0x8f, 0x8f, 0x90, 0x93, 0x94, 0xfa, 0xfa, 0xff, 0x95, 0xfb, 0xe6, 0xe9, 0xba, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xf0, 0xf1, 0xe9, 0xb9, 0xb9, 0xee, 0x94, 0x8d, 0x85, 0x6d, 0x83, 0xf4, 0xe6, 0xea, 0xf2, 0xed, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xea, 0xea, 0xff, 0x8c, 0x33, 0x38, 0x43, 0x39, 0x4b, 0x09, 0x0f, 0xf4, 0xe6, 0xfe, 0xfa, 0xea, 0xb9, 0xef, 0xed, 0xed, 0xe9, 0xed, 0xf0, 0xf8, 0xee, 0x95, 0x8e, 0x5a, 0x33, 0x5c, 0x17, 0x7d, 0xf3, 0xf0, 0xe9, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xba, 0xee, 0xfa, 0xf8, 0xf0, 0xba, 0x94, 0x11, 0x20, 0x60, 0x52, 0x8f, 0xff, 0xee, 0xed, 0xef, 0xe9, 0xe9, 0xf0, 0xf9, 0xed, 0xf0, 0xef, 0xe9, 0xe9, 0xe7, 0xf2, 0xf3, 0xec, 0xbc, 0x03, 0x1c, 0x4b, 0x44, 0x3d, 0x28, 0x81, 0xf4, 0xe6, 0xea, 0xed, 0xed, 0xe9, 0xee, 0xe9, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xee, 0xef, 0xe7, 0xea, 0xf4, 0x8d, 0x86, 0x88, 0x8c, 0x8e, 0x94, 0xf8, 0xf1, 0xef, 0xf0, 0xee, 0xe6, 0xe9, 0xba, 0xe9, 0xe9, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xe9, 0xe8, 0xe7, 0xe7, 0xff, 0x90, 0x84, 0x5b, 0x27, 0x04, 0x01, 0xeb, 0xf3, 0xe6, 0xe7, 0xed, 0xf2, 0xf0, 0xf8, 0xf0, 0xed, 0xe9, 0xf0, 0xf1, 0xed, 0xea, 0xfb, 0x89, 0x33, 0x30, 0x53, 0x4c, 0x68, 0x12, 0x08, 0x9a, 0xf4, 0xf8, 0xf8, 0xe9, 0xb9, 0xef, 0xf0, 0xed, 0xf0, 0xed, 0xe9, 0xee, 0xba, 0xe6, 0x92, 0x80, 0x32, 0x57, 0x19, 0xec, 0xf0, 0xf2, 0xee, 0xe6, 0xe9, 0xed, 0xba, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf1, 0xed, 0xba, 0xed, 0xfa, 0xf9, 0xf2, 0xe6, 0x95, 0x1e, 0x1d, 0x32, 0x84, 0x93, 0xba, 0xe7, 0xf1, 0xf0, 0xed, 0xea, 0xed, 0xf1, 0xed, 0xef, 0xee, 0xee, 0xba, 0xea, 0xe7, 0xf4, 0xd9, 0x01, 0x07, 0x2c, 0x2e, 0x30, 0x30, 0x2e, 0x85, 0x95, 0xe6, 0xe6, 0xef, 0xed, 0xba, 0xee, 0xe9, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xe6, 0xf2, 0xf1, 0xec, 0x22, 0x36, 0x7a, 0x5a, 0x6c, 0x7c, 0x8f, 0xf9, 0xe8, 0xe6, 0xf2, 0xe9, 0x9a, 0xe9, 0xba, 0xe9, 0xe9, 0xf0, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xb9, 0xb8, 0xf2, 0xfa, 0x8f, 0x7a, 0x4d, 0x42, 0x6b, 0x20, 0x03, 0x99, 0xce, 0xf3, 0xe9, 0xea, 0xf8, 0xf1, 0xfa, 0xf1, 0xee, 0xe9, 0xf0, 0xf1, 0xea, 0xef, 0xfb, 0x89, 0x2d, 0x3c, 0x47, 0x3d, 0x62, 0x1a, 0x06, 0xf7, 0x9a, 0xf9, 0xf1, 0xba, 0xba, 0xf0, 0xed, 0xf0, 0xf0, 0xee, 0xe9, 0xee, 0xba, 0xb9, 0xff, 0x8c, 0x46, 0x2f, 0x22, 0xf4, 0xef, 0xef, 0xe6, 0xe9, 0xe6, 0xba, 0xe9, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xed, 0xea, 0xee, 0xf8, 0xfa, 0xf8, 0xe9, 0x95, 0x7f, 0x1b, 0x5b, 0x8f, 0xff, 0xb8, 0xb8, 0xef, 0xf0, 0xed, 0xe9, 0xed, 0xf1, 0xed, 0xf0, 0xef, 0xee, 0xe9, 0xe8, 0xb8, 0xf4, 0x1e, 0x97, 0x0e, 0x39, 0x43, 0x3a, 0x30, 0x28, 0x87, 0x95, 0xed, 0xea, 0xef, 0xee, 0xe6, 0xe9, 0xee, 0xe9, 0xee, 0xf2, 0xee, 0xef, 0xec, 0xf3, 0xec, 0x08, 0x02, 0x26, 0x3f, 0x5f, 0x58, 0x3e, 0x84, 0x92, 0xf8, 0xe9, 0xee, 0xba, 0xe9, 0xba, 0xe9, 0xe9, 0xed, 0xef, 0xed, 0xf0, 0xed, 0xef, 0xef, 0xf2, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xe6, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe6, 0xed, 0xe6, 0xe9, 0xed, 0xe8, 0xe6, 0xe9, 0xe9, 0xe9, 0xed, 0xe6, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xba, 0xb9, 0xf0, 0x90, 0x80, 0x33, 0x51, 0x54, 0x4c, 0x6c, 0x13, 0x02, 0xbc, 0xe2, 0xf3, 0xe9, 0xef, 0xf0, 0xf9, 0xfa, 0xed, 0xba, 0xed, 0xf1, 0xf2, 0xf1, 0xf2, 0x8c, 0x2e, 0x30, 0x41, 0x47, 0x4a, 0x26, 0x06, 0x83, 0x9a, 0xfa, 0xed, 0xe9, 0xe6, 0xf0, 0xf0, 0xed, 0xff, 0xe9, 0xba, 0xe9, 0xba, 0xba, 0xe6, 0x90, 0x7e, 0x1f, 0x65, 0xf4, 0xf8, 0xef, 0xe9, 0xee, 0xba, 0xee, 0xba, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xf9, 0xf1, 0xb9, 0xba, 0xff, 0xf9, 0xf8, 0xf2, 0xee, 0x91, 0x22, 0x81, 0x93, 0xee, 0xe7, 0xe7, 0xe9, 0xef, 0xed, 0xef, 0xed, 0xf1, 0xef, 0xed, 0xfa, 0xf8, 0xe9, 0xba, 0xba, 0xf4, 0xfc, 0x01, 0x1a, 0x34, 0x3a, 0x30, 0x3a, 0x2a, 0x8a, 0xfb, 0xed, 0xef, 0xef, 0xed, 0xe9, 0xee, 0xe9, 0xef, 0xef, 0xed, 0xef, 0xf8, 0xf2, 0x95, 0xc6, 0x97, 0x1c, 0x61, 0x53, 0x47, 0x53, 0x34, 0x66, 0x89, 0x95, 0xee, 0xba, 0xef, 0xba, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf0, 0xed, 0xed, 0xef, 0xed, 0xef, 0xf2, 0xed, 0xed, 0xed, 0xed, 0xf2, 0xef, 0xed, 0xef, 0xef, 0xf0, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xef, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xea, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xed, 0xe9, 0xed, 0xe6, 0xe6, 0xf2, 0xf2, 0xf2, 0xef, 0xe9, 0xef, 0xf2, 0xef, 0xe9, 0xef, 0xe9, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xba, 0x95, 0x91, 0x88, 0x31, 0x4f, 0x54, 0x54, 0x53, 0x5e, 0x48, 0x0d, 0x99, 0x0f, 0xf4, 0xe6, 0xea, 0xf8, 0xf9, 0xf0, 0xef, 0xba, 0xe9, 0xf2, 0xea, 0xf0, 0xfb, 0x8c, 0x2d, 0x3f, 0x47, 0x47, 0x53, 0x2e, 0x09, 0x7d, 0xf3, 0xf8, 0xed, 0xba, 0xba, 0xfa, 0xf8, 0xf0, 0xf8, 0xba, 0xb9, 0xe9, 0xef, 0xb9, 0xe9, 0x91, 0x8d, 0x22, 0xfe, 0xf0, 0xef, 0xef, 0xed, 0xba, 0xed, 0xe9, 0xed, 0xe9, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xef, 0xf9, 0xed, 0xe9, 0xb9, 0xff, 0xf8, 0xfb, 0xe7, 0xf2, 0x94, 0x7f, 0xfe, 0x94, 0xf8, 0xea, 0xea, 0xba, 0xe9, 0xee, 0xef, 0xed, 0xea, 0xe8, 0xf0, 0xf0, 0xff, 0xed, 0xea, 0xba, 0xf4, 0x11, 0x04, 0x24, 0x3a, 0x30, 0x3a, 0x34, 0x2a, 0x8b, 0x95, 0xed, 0xed, 0xf0, 0xee, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xf0, 0xef, 0xf2, 0xf8, 0x05, 0x0d, 0x4b, 0x2b, 0x47, 0x3a, 0x47, 0x4a, 0x35, 0x74, 0x93, 0xff, 0xe9, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf1, 0xef, 0xf1, 0xf2, 0xef, 0xf2, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xe6, 0xe6, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xe6, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xea, 0xed, 0xe8, 0xed, 0xea, 0xf2, 0xea, 0xed, 0xe6, 0xed, 0xe9, 0xf2, 0xed, 0xe6, 0xed, 0xef, 0xef, 0xe9, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0x91, 0x92, 0x74, 0x2c, 0x55, 0x53, 0x53, 0x53, 0x34, 0x68, 0x1c, 0x03, 0x97, 0xf7, 0x9a, 0xba, 0xed, 0xfa, 0xf8, 0xf1, 0xba, 0xb9, 0xba, 0xf1, 0xf1, 0xff, 0x8c, 0x2d, 0x34, 0x3d, 0x47, 0x54, 0x35, 0x09, 0x7f, 0x9a, 0xf8, 0xef, 0xe8, 0xee, 0xf0, 0xfa, 0xed, 0xff, 0xb9, 0xba, 0xed, 0xf1, 0xe5, 0x9a, 0xef, 0xfe, 0xfd, 0x91, 0xf0, 0xf8, 0xf0, 0xe9, 0xe9, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xfa, 0xf8, 0xb9, 0xb9, 0xf0, 0xf8, 0xfb, 0xe7, 0xf2, 0xec, 0x95, 0xb9, 0xee, 0xf8, 0xf9, 0xed, 0xe8, 0xb9, 0xee, 0xf0, 0xe9, 0xe8, 0xba, 0xed, 0xfa, 0xfa, 0xef, 0xe7, 0xf3, 0x9a, 0x11, 0x09, 0x2c, 0x30, 0x3a, 0x34, 0x2d, 0x2c, 0x8d, 0xef, 0xed, 0xed, 0xfb, 0xee, 0xe9, 0xed, 0xe9, 0xef, 0xef, 0xef, 0xef, 0xfb, 0xf3, 0x25, 0x03, 0x24, 0x4f, 0x51, 0x3a, 0x44, 0x3a, 0x54, 0x59, 0x32, 0x86, 0xfb, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf2, 0xef, 0xf2, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xe9, 0xf2, 0xf2, 0xf2, 0xe9, 0xef, 0xe9, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf2, 0xfa, 0x92, 0x87, 0x2c, 0x49, 0x4c, 0x4c, 0x53, 0x62, 0x3c, 0x62, 0x76, 0x10, 0x99, 0x25, 0x9a, 0xb8, 0xe9, 0xf1, 0xf1, 0xed, 0xba, 0xb9, 0xb9, 0xea, 0xfa, 0x91, 0x8c, 0x33, 0x34, 0x4c, 0x47, 0x53, 0x3f, 0x0d, 0x7d, 0x95, 0xee, 0xe9, 0xba, 0xe9, 0xfa, 0xf1, 0xee, 0xf8, 0xb9, 0xb9, 0xf1, 0xf9, 0xf2, 0xe4, 0xe9, 0xf0, 0xff, 0xee, 0xf0, 0xed, 0xef, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xfa, 0xf0, 0xb9, 0xba, 0xee, 0xfa, 0xf8, 0xe8, 0xb9, 0xf8, 0xee, 0xb9, 0xee, 0xf9, 0xf9, 0xef, 0xb8, 0xba, 0xee, 0xee, 0xed, 0xe8, 0xe7, 0xef, 0xfa, 0xf8, 0xf1, 0xe9, 0x9a, 0x95, 0x11, 0x0d, 0x2c, 0x3a, 0x30, 0x2b, 0x28, 0x57, 0x90, 0xf2, 0xed, 0xef, 0xfb, 0xee, 0xe9, 0xed, 0xed, 0xef, 0xed, 0xf0, 0xed, 0xed, 0xf4, 0xf6, 0x0d, 0x5c, 0x38, 0x51, 0x30, 0x2e, 0x43, 0x51, 0x54, 0x33, 0x74, 0x94, 0xf0, 0xf0, 0xf0, 0xfb, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xed, 0xe6, 0xf7, 0xf7, 0xe0, 0x7d, 0xdd, 0xdd, 0xdb, 0xd9, 0xce, 0xce, 0xeb, 0xcc, 0xc7, 0xc7, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc6, 0xc6, 0xc6, 0xc7, 0xc7, 0xc7, 0xeb, 0xcc, 0xcc, 0xce, 0xce, 0xd9, 0xd9, 0xdd, 0xdd, 0xdf, 0xe2, 0xf7, 0xec, 0xe9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf9, 0x92, 0x7c, 0x2a, 0x50, 0x54, 0x54, 0x59, 0x4a, 0x59, 0x53, 0x4d, 0x1f, 0x04, 0x0f, 0x9a, 0xb9, 0xba, 0xf8, 0xf1, 0xed, 0xe9, 0xb9, 0xb9, 0xe9, 0xfa, 0xfe, 0x8c, 0x33, 0x3f, 0x4c, 0x41, 0x53, 0x42, 0x0e, 0x85, 0x9a, 0xfb, 0xe6, 0xea, 0xed, 0xff, 0xf8, 0xef, 0xee, 0xb9, 0xb9, 0xf1, 0xf9, 0xed, 0xea, 0xe8, 0xef, 0xe9, 0xe6, 0xf0, 0xf8, 0xef, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xba, 0xef, 0xef, 0xfa, 0xed, 0xed, 0xe9, 0xef, 0xef, 0xed, 0xba, 0xba, 0xee, 0xff, 0xf0, 0xf0, 0xf1, 0xf8, 0xf4, 0x14, 0x12, 0x2e, 0x34, 0x3d, 0x3a, 0x2b, 0x5b, 0x8d, 0xfa, 0xed, 0xed, 0xba, 0xb8, 0xea, 0xef, 0xf0, 0xef, 0xf0, 0xf8, 0xba, 0x9a, 0xe6, 0x03, 0x1c, 0x42, 0x38, 0x51, 0x40, 0x4c, 0x3a, 0x4a, 0x4a, 0x4f, 0x23, 0x8b, 0xf2, 0xfb, 0xf1, 0xe8, 0xec, 0xe3, 0x83, 0xdf, 0xdb, 0xd8, 0x25, 0xc6, 0xc2, 0xfc, 0xf6, 0xa6, 0xf5, 0x05, 0xbc, 0xbc, 0x98, 0x9c, 0x96, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0xbb, 0x9e, 0xbc, 0xa1, 0x05, 0xf5, 0x0a, 0xf6, 0xfc, 0xbf, 0xc6, 0xeb, 0xce, 0xdb, 0xdf, 0xe0, 0xf7, 0xec, 0xf8, 0x91, 0x8c, 0x29, 0x4d, 0x4a, 0x54, 0x54, 0x53, 0x4f, 0x4a, 0x51, 0x3f, 0x57, 0x0d, 0x0c, 0xe6, 0xf2, 0xf1, 0xf1, 0xed, 0xe9, 0xea, 0xba, 0xb8, 0xea, 0xed, 0xfe, 0x8c, 0x35, 0x3c, 0x4c, 0x47, 0x51, 0x34, 0x12, 0xfd, 0x9a, 0xe6, 0xed, 0xef, 0xee, 0xff, 0xe9, 0xb9, 0xe9, 0xe9, 0xe9, 0xf0, 0xed, 0xed, 0xef, 0xed, 0xf0, 0xf8, 0xf0, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xb9, 0xee, 0xff, 0xed, 0xed, 0xf9, 0xf8, 0xf4, 0x1e, 0x12, 0x39, 0x44, 0x37, 0x3d, 0x28, 0x5b, 0x90, 0xf0, 0xed, 0xea, 0xe6, 0xba, 0xe7, 0xf0, 0xee, 0xf0, 0xed, 0xf1, 0xe5, 0x9a, 0x7d, 0x06, 0x2a, 0x43, 0x30, 0x37, 0x40, 0x40, 0x37, 0x3c, 0x43, 0x4f, 0x2b, 0x81, 0x25, 0xf6, 0xf6, 0xa6, 0xa4, 0xa3, 0xa1, 0xbc, 0x9e, 0x9d, 0x99, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x99, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x99, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x9b, 0x9e, 0xa2, 0x05, 0xf5, 0xf5, 0x65, 0x82, 0x2c, 0x56, 0x59, 0x51, 0x5d, 0x4c, 0x50, 0x4c, 0x59, 0x38, 0x6c, 0x17, 0x0a, 0xf7, 0xf3, 0xfa, 0xf0, 0xef, 0xe9, 0xf0, 0xb9, 0xe6, 0xf2, 0xed, 0x91, 0x8c, 0x35, 0x4c, 0x4c, 0x4a, 0x51, 0x2d, 0x13, 0x92, 0x9a, 0xef, 0xed, 0xea, 0xf8, 0xf0, 0xb9, 0xb9, 0xe7, 0xe9, 0xe9, 0xed, 0xe9, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xee, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xba, 0xee, 0xee, 0xee, 0xe9, 0xed, 0xf1, 0xfd, 0xf4, 0x22, 0x16, 0x2e, 0x3a, 0x3d, 0x3d, 0x28, 0x77, 0x90, 0xf1, 0xed, 0xed, 0xe9, 0xba, 0xea, 0xed, 0xe6, 0xe9, 0xf0, 0xf1, 0xba, 0x95, 0x25, 0x0d, 0x4b, 0x3c, 0x3d, 0x40, 0x47, 0x41, 0x3c, 0x3c, 0x43, 0x3c, 0x34, 0x4e, 0x79, 0x99, 0x99, 0x9d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa4, 0xa2, 0xa4, 0xa2, 0xa2, 0xa2, 0xa2, 0x9f, 0x9f, 0x9f, 0x9d, 0x9d, 0x9d, 0x9d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x99, 0xa6, 0x8a, 0x45, 0x35, 0x38, 0x59, 0x54, 0x53, 0x50, 0x44, 0x4f, 0x50, 0x59, 0x4d, 0x20, 0x0c, 0xf7, 0xf3, 0xed, 0xed, 0xea, 0xea, 0xed, 0xe6, 0xf8, 0xf1, 0xf1, 0x91, 0x8c, 0x35, 0x3f, 0x53, 0x4c, 0x4a, 0x2d, 0x1b, 0x95, 0xba, 0xf2, 0xf1, 0xed, 0xee, 0xf0, 0xee, 0xb9, 0xe9, 0xe9, 0xe9, 0xba, 0xe9, 0xe9, 0xe9, 0xe9, 0xed, 0xba, 0xe9, 0xed, 0xef, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xba, 0xef, 0xee, 0xba, 0xe8, 0xf8, 0xf0, 0x95, 0x79, 0x12, 0x34, 0x43, 0x47, 0x37, 0x28, 0x77, 0x93, 0xed, 0xe8, 0xf1, 0xf8, 0xe9, 0xe9, 0xef, 0xe9, 0xba, 0xe9, 0xf0, 0xf2, 0xf4, 0x19, 0x16, 0x58, 0x3d, 0x41, 0x47, 0x41, 0x3d, 0x3a, 0x43, 0x3f, 0x4a, 0x4f, 0x2a, 0x88, 0x0f, 0x99, 0x9d, 0x9f, 0x9f, 0xa2, 0xa4, 0xa4, 0xa5, 0xa5, 0xa7, 0xa8, 0xa7, 0xac, 0xac, 0xaf, 0xaf, 0xb5, 0xaf, 0xb5, 0xc1, 0xb5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb5, 0xc1, 0xb5, 0xb5, 0xaf, 0xaf, 0xad, 0xaa, 0xa8, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xf6, 0xdf, 0x82, 0x28, 0x73, 0x38, 0x54, 0x51, 0x4c, 0x50, 0x44, 0x43, 0x4c, 0x5d, 0x4f, 0x24, 0x11, 0xe6, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf0, 0xfb, 0xf9, 0xed, 0x91, 0x8c, 0x4b, 0x3c, 0x4c, 0x4c, 0x51, 0x23, 0x27, 0x95, 0xe6, 0xf1, 0xf1, 0xed, 0xef, 0xfa, 0xee, 0xb9, 0xe9, 0xee, 0xba, 0xed, 0xba, 0xe9, 0xb9, 0xea, 0xb8, 0xba, 0xe9, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xf0, 0xe9, 0xb8, 0xe8, 0xef, 0xff, 0x95, 0x7f, 0x12, 0x2e, 0x3c, 0x47, 0x30, 0x2a, 0x7e, 0x91, 0xea, 0xed, 0xed, 0xf8, 0xee, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x95, 0x22, 0x1c, 0x50, 0x47, 0x47, 0x41, 0x47, 0x3a, 0x3c, 0x43, 0x3c, 0x4a, 0x59, 0x42, 0x5a, 0x83, 0xbf, 0xb5, 0xaf, 0xc1, 0xb7, 0xb7, 0xc1, 0xc4, 0xc3, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xc0, 0xb4, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4, 0xb1, 0xb1, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb1, 0xbe, 0xb1, 0xbe, 0xbe, 0xb1, 0xbe, 0xb1, 0xbe, 0xb1, 0xbe, 0xb1, 0xbe, 0xb1, 0xbe, 0xb1, 0xb4, 0xb1, 0xb1, 0xb1, 0xb0, 0xb1, 0xb0, 0xb1, 0xb1, 0xb4, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4, 0xc0, 0xc0, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0xc1, 0xc3, 0xb5, 0xc3, 0xb7, 0xc1, 0xb5, 0x7d, 0x90, 0x29, 0x58, 0x38, 0x5d, 0x51, 0x53, 0x50, 0x55, 0x43, 0x50, 0x4a, 0x54, 0x3c, 0x21, 0x1e, 0xe2, 0xdb, 0xe0, 0xe3, 0xe5, 0xe8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0x94, 0x89, 0x39, 0x4c, 0x47, 0x5d, 0x38, 0x23, 0x79, 0xff, 0xe9, 0xed, 0xf1, 0xef, 0xed, 0xff, 0xf8, 0xe9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe9, 0xe9, 0xb9, 0xe9, 0xe7, 0xba, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xf0, 0xed, 0xf1, 0xe9, 0xb9, 0xb8, 0xef, 0xf0, 0xf8, 0x8d, 0x16, 0x2a, 0x43, 0x40, 0x30, 0x23, 0x81, 0x94, 0xe6, 0xea, 0xf3, 0xf3, 0xf4, 0x9a, 0xfd, 0xe0, 0xd9, 0xcc, 0xbf, 0x0a, 0x6d, 0x85, 0x23, 0x3f, 0x41, 0x47, 0x47, 0x3d, 0x3d, 0x43, 0x43, 0x50, 0x4a, 0x59, 0x4a, 0x23, 0x84, 0xe2, 0xb5, 0xb7, 0xb4, 0xb4, 0xc0, 0xb4, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xc0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb0, 0xb4, 0xb2, 0xb2, 0xb4, 0xb2, 0xb6, 0xbe, 0xb2, 0xb2, 0xb2, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xbe, 0xb2, 0xbe, 0xb2, 0xbe, 0xb2, 0xb4, 0xb2, 0xb4, 0xb2, 0xb4, 0xae, 0xb3, 0xb2, 0xb0, 0xb3, 0xb4, 0xb3, 0xb4, 0xb2, 0xb3, 0xb4, 0xb3, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xc0, 0xb4, 0xb4, 0xb4, 0xb6, 0xb4, 0xc0, 0xb4, 0xb3, 0xb6, 0xaf, 0xc9, 0x8f, 0x77, 0x28, 0x55, 0x38, 0x5d, 0x4a, 0x53, 0x4c, 0x50, 0x50, 0x41, 0x53, 0x54, 0x5f, 0x31, 0x83, 0xcc, 0x9d, 0x9f, 0xa2, 0xa5, 0xa7, 0xab, 0xbf, 0xc4, 0xeb, 0xcd, 0xfd, 0x8c, 0x49, 0x4a, 0x54, 0x47, 0x53, 0x1c, 0x85, 0xee, 0x9a, 0xf8, 0xf1, 0xe9, 0xed, 0xf8, 0xff, 0xe9, 0xff, 0xf0, 0xf0, 0xef, 0xee, 0xe6, 0xed, 0xed, 0xe9, 0xe9, 0xe9, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xf2, 0xed, 0xed, 0xed, 0xf8, 0xe6, 0xb8, 0xba, 0xec, 0xff, 0xec, 0xff, 0x1f, 0x26, 0x34, 0x30, 0x3f, 0x23, 0x84, 0xff, 0xf3, 0xf3, 0xf7, 0xdb, 0xc2, 0xf6, 0xf5, 0xa0, 0x9c, 0x9b, 0x99, 0x99, 0xc2, 0x8f, 0x29, 0x34, 0x3c, 0x41, 0x41, 0x3d, 0x4c, 0x50, 0x43, 0x4f, 0x4a, 0x4a, 0x4a, 0x4d, 0x46, 0x8a, 0xca, 0xad, 0xb6, 0xb4, 0xc0, 0xb2, 0xb6, 0xb4, 0xb4, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xb2, 0xb4, 0xb2, 0xb3, 0xb2, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb2, 0xbe, 0xbe, 0xbe, 0xbe, 0xb2, 0xb4, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb4, 0xb3, 0xb3, 0xb2, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xc0, 0xc0, 0xc0, 0xb3, 0xb6, 0xb3, 0xb3, 0xc1, 0xf7, 0x84, 0x3e, 0x44, 0x50, 0x50, 0x50, 0x4c, 0x4c, 0x4c, 0x4c, 0x4a, 0x47, 0x51, 0x51, 0x56, 0x24, 0xfd, 0xcf, 0xa4, 0xa2, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9d, 0xce, 0x8e, 0x39, 0x54, 0x54, 0x5d, 0x4f, 0x29, 0x92, 0x9a, 0xea, 0xe8, 0xf2, 0xe7, 0x9a, 0xf0, 0xec, 0xe5, 0xf0, 0xf8, 0xe6, 0xf0, 0xf1, 0xfb, 0xf2, 0xf0, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf2, 0xed, 0xed, 0xed, 0xf2, 0xf1, 0xf0, 0xb9, 0xb8, 0xba, 0xfb, 0xf8, 0xf4, 0xf4, 0x7f, 0x1a, 0x2e, 0x43, 0x34, 0x2c, 0x86, 0xfd, 0xab, 0xa1, 0x9b, 0x99, 0x99, 0x9b, 0x99, 0x9b, 0x9d, 0x9b, 0x9b, 0x9b, 0xbf, 0xf4, 0x74, 0x2a, 0x44, 0x34, 0x3c, 0x4a, 0x4c, 0x4c, 0x4c, 0x4c, 0x4a, 0x4a, 0x4f, 0x3f, 0x35, 0x4e, 0xff, 0xc9, 0xad, 0xb6, 0xc0, 0xb6, 0xb6, 0xb2, 0xc0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xbe, 0xb4, 0xbe, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb1, 0xbe, 0xb1, 0xbe, 0xb4, 0xbe, 0xb4, 0xbe, 0xb4, 0xbe, 0xb4, 0xb1, 0xb4, 0xbe, 0xb4, 0xb0, 0xb4, 0xb0, 0xb4, 0xb0, 0xb0, 0xb0, 0xbe, 0xb0, 0xb0, 0xb0, 0xb3, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xc0, 0xc0, 0xb4, 0xb6, 0xb3, 0xaf, 0xde, 0x8f, 0x31, 0x3f, 0x4f, 0x50, 0x43, 0x50, 0x50, 0x4c, 0x4a, 0x40, 0x4a, 0x51, 0x4a, 0x59, 0x5a, 0x36, 0xf4, 0xcf, 0xaf, 0xaf, 0xac, 0xa8, 0xa8, 0xa5, 0xa5, 0xa4, 0xa5, 0xa5, 0xdb, 0x8c, 0x61, 0x40, 0x5d, 0x55, 0x2d, 0x79, 0xf7, 0xde, 0xe1, 0xe4, 0xe8, 0xe8, 0xb9, 0xe8, 0xba, 0xf2, 0xe8, 0xea, 0xf1, 0xea, 0xed, 0xe6, 0xe6, 0xf8, 0xf1, 0xfb, 0xf1, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf2, 0xef, 0xe6, 0xe6, 0xed, 0xf0, 0x9a, 0x9a, 0xf4, 0xf4, 0xf8, 0xe2, 0xde, 0x91, 0x27, 0x23, 0x49, 0x2b, 0x2a, 0x89, 0x7d, 0x99, 0x9b, 0x9d, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9f, 0xa4, 0xac, 0xaf, 0xc9, 0xe4, 0x8e, 0x31, 0x2e, 0x39, 0x3f, 0x53, 0x4a, 0x53, 0x3c, 0x50, 0x4a, 0x4a, 0x4f, 0x38, 0x63, 0x23, 0x86, 0xf7, 0xc4, 0xb1, 0xb6, 0xb2, 0xb6, 0xc0, 0xb4, 0xc0, 0xb4, 0xc0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbe, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb0, 0xb4, 0xb0, 0xb0, 0xb4, 0xb0, 0xb4, 0xb4, 0xb4, 0xb4, 0xc0, 0xc0, 0xb4, 0xb6, 0xb4, 0xaf, 0xcc, 0x90, 0x5b, 0x2d, 0x4f, 0x47, 0x43, 0x43, 0x4c, 0x43, 0x4c, 0x4a, 0x53, 0x38, 0x30, 0x4f, 0x61, 0x29, 0x87, 0xe1, 0xc3, 0xb4, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xb7, 0xb4, 0xb1, 0xad, 0xdb, 0x8c, 0x4d, 0x51, 0x55, 0x39, 0x29, 0x8f, 0xc9, 0xa8, 0xac, 0xc4, 0xc1, 0xc9, 0xcd, 0xde, 0xe4, 0xe4, 0xea, 0xea, 0xe8, 0xe8, 0xe8, 0xea, 0xe8, 0xe6, 0xed, 0xef, 0xf8, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xf2, 0xed, 0xe6, 0xf1, 0xf3, 0xf3, 0xf4, 0xf4, 0xec, 0xdf, 0xcc, 0xfc, 0xf5, 0x9b, 0x99, 0xc7, 0x8c, 0x21, 0x34, 0x28, 0x2a, 0x89, 0x7d, 0xbb, 0x9b, 0x9d, 0x9d, 0x9f, 0xa5, 0xa8, 0xc4, 0xc5, 0xc8, 0xc8, 0xc5, 0xb4, 0xdc, 0xfb, 0x80, 0x45, 0x39, 0x56, 0x38, 0x4a, 0x51, 0x4c, 0x4a, 0x4c, 0x50, 0x4c, 0x50, 0x37, 0x55, 0x26, 0x8a, 0xde, 0xb4, 0xb3, 0xb7, 0xb1, 0xc0, 0xb6, 0xc0, 0xb4, 0xb6, 0xb4, 0xc0, 0xb4, 0xc0, 0xb4, 0xc0, 0xb4, 0xc0, 0xb4, 0xc0, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbe, 0xb1, 0xbe, 0xb1, 0xae, 0xb1, 0xae, 0xb1, 0xbe, 0xb0, 0xbe, 0xb1, 0xbe, 0xbe, 0xb4, 0xb3, 0xb4, 0xb0, 0xb4, 0xb0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb1, 0xc9, 0xfe, 0x7c, 0x35, 0x34, 0x59, 0x37, 0x4c, 0x4c, 0x4c, 0x4a, 0x4a, 0x4a, 0x4a, 0x3c, 0x42, 0x56, 0x3e, 0x7c, 0x95, 0xcd, 0xb0, 0xb4, 0xc0, 0xb4, 0xb4, 0xb4, 0xb7, 0xc0, 0xb6, 0xc1, 0xc0, 0xce, 0x8e, 0x4d, 0x59, 0x39, 0x45, 0x80, 0xf7, 0xb5, 0xaa, 0xb3, 0xa9, 0xac, 0xaa, 0xaa, 0xa9, 0xac, 0xb5, 0xc9, 0xcf, 0xde, 0xe3, 0xe7, 0xf2, 0xf3, 0xf2, 0xed, 0xed, 0xf0, 0xef, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xef, 0xe9, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xe7, 0xed, 0xef, 0xf2, 0xf3, 0xf3, 0xf4, 0xef, 0xe2, 0xd9, 0xc2, 0x0a, 0xa1, 0x9c, 0x99, 0x99, 0x99, 0x9d, 0x9d, 0xa5, 0x8d, 0x6e, 0x2a, 0x33, 0x2a, 0x86, 0x7d, 0x9b, 0xa2, 0xa7, 0xb5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc5, 0xc3, 0xc3, 0xb6, 0xb6, 0xb4, 0xe5, 0x8e, 0x74, 0x45, 0x60, 0x3c, 0x4a, 0x53, 0x4a, 0x4c, 0x3c, 0x4f, 0x50, 0x4c, 0x47, 0x53, 0x33, 0x52, 0xf8, 0xd6, 0xb3, 0xb4, 0xb5, 0xb4, 0xc0, 0xb4, 0xc0, 0xc0, 0xb4, 0xc0, 0xb4, 0xc0, 0xb4, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xb7, 0xc1, 0xb7, 0xc1, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xb4, 0xc0, 0xc0, 0xc0, 0xb7, 0xb4, 0xb3, 0xb1, 0xc4, 0x83, 0x84, 0x2a, 0x33, 0x4c, 0x38, 0x53, 0x3c, 0x4a, 0x43, 0x4a, 0x4c, 0x38, 0x30, 0x42, 0x69, 0x3e, 0x4e, 0x90, 0xe0, 0xaf, 0xb0, 0xb6, 0xb6, 0xb4, 0xb6, 0xc0, 0xb4, 0xc0, 0xb7, 0xc0, 0xb1, 0xce, 0x8e, 0x35, 0x58, 0x2c, 0x5b, 0x90, 0xcf, 0xaa, 0xae, 0xae, 0xb1, 0xbe, 0xb3, 0xae, 0xb1, 0xad, 0xad, 0xac, 0xac, 0xac, 0xaf, 0xc4, 0xcd, 0xdc, 0xe4, 0xe7, 0xea, 0xf2, 0xea, 0xed, 0xed, 0xef, 0xee, 0xed, 0xee, 0xf2, 0xed, 0xe9, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf0, 0xf0, 0xed, 0xf2, 0xed, 0xe7, 0xf2, 0xe9, 0xe6, 0xed, 0xea, 0xea, 0xf2, 0xf4, 0xf4, 0xed, 0xdf, 0xcc, 0xfc, 0xf5, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0xa2, 0xa5, 0xa8, 0xaf, 0xb5, 0xcf, 0x8a, 0x24, 0x4d, 0x23, 0x86, 0xe3, 0xc1, 0xc8, 0xc8, 0xc5, 0xc5, 0xc5, 0xb6, 0xc3, 0xc3, 0xc3, 0xc0, 0xc0, 0xc1, 0xc1, 0xd0, 0xef, 0x8b, 0x64, 0x57, 0x75, 0x4c, 0x40, 0x37, 0x4a, 0x58, 0x3f, 0x3f, 0x43, 0x53, 0x51, 0x51, 0x2e, 0x79, 0xb8, 0xcb, 0xc5, 0xc5, 0xc8, 0xc9, 0xc8, 0xcb, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xd0, 0xd0, 0xd3, 0xd0, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xda, 0xd7, 0xda, 0xd7, 0xda, 0xd7, 0xda, 0xd7, 0xda, 0xd7, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd4, 0xda, 0xd4, 0xd6, 0xd4, 0xd6, 0xd4, 0xd1, 0xd0, 0xd1, 0xd0, 0xd0, 0xd1, 0xcb, 0xd1, 0xcd, 0xdf, 0x8c, 0x48, 0x2d, 0x34, 0x3f, 0x3d, 0x4a, 0x3c, 0x3f, 0x3c, 0x3f, 0x34, 0x3f, 0x49, 0x78, 0x45, 0x52, 0x8a, 0xe7, 0xca, 0xac, 0xb1, 0xbe, 0xb4, 0xb6, 0xc0, 0xc0, 0xc0, 0xc1, 0xc0, 0xb6, 0xad, 0xce, 0x8e, 0x4d, 0x35, 0x46, 0x8b, 0xe4, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xb0, 0xb0, 0xad, 0xb0, 0xad, 0xae, 0xaa, 0xac, 0xaf, 0xc5, 0xd8, 0xe1, 0xf1, 0xf3, 0xf3, 0xed, 0xff, 0xfb, 0xee, 0xee, 0xe5, 0xea, 0xe7, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xf0, 0xf2, 0xed, 0xed, 0xed, 0xe9, 0xe9, 0xf3, 0xf4, 0xf3, 0xba, 0xdf, 0xcc, 0xf6, 0x05, 0x96, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x9b, 0xa2, 0xa4, 0xa7, 0xaf, 0xaf, 0xc0, 0xb7, 0xb3, 0xb2, 0xac, 0xe0, 0x81, 0x23, 0x26, 0x88, 0xf7, 0xc3, 0xb6, 0xb6, 0xc3, 0xc5, 0xb6, 0xc5, 0xb6, 0xc0, 0xc0, 0xc5, 0xc8, 0xcb, 0xd4, 0xd0, 0xdc, 0xf8, 0x8d, 0x64, 0x5a, 0x78, 0x71, 0x55, 0x3f, 0x4f, 0x3c, 0x4f, 0x50, 0x4a, 0x51, 0x51, 0x4f, 0x26, 0x85, 0xec, 0xd2, 0xd7, 0xd7, 0xd3, 0xd1, 0xd6, 0xd6, 0xd4, 0xd7, 0xd7, 0xd7, 0xd4, 0xd4, 0xd7, 0xd5, 0xd7, 0xd4, 0xd7, 0xd7, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd7, 0xd5, 0xd4, 0xd5, 0xd4, 0xd5, 0xd4, 0xd4, 0xda, 0xd4, 0xd6, 0xd4, 0xda, 0xd6, 0xd3, 0xde, 0x90, 0x4e, 0x23, 0x34, 0x34, 0x3c, 0x3d, 0x4a, 0x4c, 0x4f, 0x30, 0x3c, 0x4f, 0x75, 0x78, 0x57, 0x5b, 0x8c, 0xfb, 0xd7, 0xcd, 0xd4, 0xc8, 0xc5, 0xb7, 0xb4, 0xb1, 0xc0, 0xc1, 0xc1, 0xc0, 0xb6, 0xad, 0xd8, 0x8a, 0x4e, 0x29, 0x89, 0xf2, 0xc4, 0xaa, 0xae, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xae, 0xae, 0xb0, 0xb0, 0xac, 0xad, 0xac, 0xb5, 0xc4, 0xdc, 0xe4, 0xf2, 0xea, 0xe6, 0xf2, 0xe6, 0xe9, 0xe9, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xf2, 0xef, 0xe6, 0xe6, 0xed, 0xf3, 0xf4, 0xf4, 0xf4, 0xdf, 0xc6, 0xbd, 0x98, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x9b, 0x9d, 0xa2, 0xa5, 0xa8, 0xaf, 0xb7, 0xb4, 0xb1, 0xb3, 0xae, 0xb3, 0xb3, 0xb3, 0xaa, 0xc9, 0xfe, 0x27, 0x21, 0x84, 0x83, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xc0, 0xbe, 0xb7, 0xc8, 0xcb, 0xd1, 0xda, 0xda, 0xd6, 0xd4, 0xcd, 0xdc, 0xf9, 0x8f, 0x64, 0x46, 0x6c, 0x78, 0x71, 0x56, 0x4f, 0x3c, 0x38, 0x3f, 0x4a, 0x4c, 0x3c, 0x4d, 0x29, 0x89, 0xdf, 0xd2, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd4, 0xd7, 0xd7, 0xd2, 0xd7, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 0xd3, 0xd4, 0xd3, 0xd4, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xd4, 0xd4, 0xd1, 0xda, 0xcd, 0xfd, 0x7e, 0x29, 0x35, 0x3f, 0x3c, 0x4a, 0x40, 0x38, 0x3c, 0x30, 0x62, 0x71, 0x75, 0x72, 0x57, 0x5b, 0x8a, 0x91, 0xdb, 0xcd, 0xd5, 0xd0, 0xd6, 0xd1, 0xd1, 0xcb, 0xc5, 0xc1, 0xb1, 0xb1, 0xb4, 0xb7, 0xad, 0xca, 0x8b, 0x36, 0x79, 0x94, 0xd8, 0xa8, 0xae, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xae, 0xb0, 0xb0, 0xb1, 0xb1, 0xad, 0xaf, 0xac, 0xac, 0xb5, 0xd8, 0xe4, 0xf3, 0xf2, 0xe8, 0xfb, 0xf8, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xed, 0xef, 0xe6, 0xed, 0xf2, 0xf4, 0xf4, 0xf8, 0xdb, 0xbf, 0x05, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x9b, 0x9f, 0xa4, 0xa7, 0xb5, 0xc1, 0xb7, 0xb6, 0xb3, 0xae, 0xb3, 0xb3, 0xb3, 0xb3, 0xae, 0xb3, 0xae, 0xb3, 0xaa, 0xca, 0x8d, 0x1f, 0x7e, 0x83, 0xaf, 0xb6, 0xb6, 0xb4, 0xb7, 0xc5, 0xcb, 0xd6, 0xd6, 0xd6, 0xd1, 0xd0, 0xd4, 0xd4, 0xd0, 0xd1, 0xd2, 0xd2, 0xec, 0x94, 0x85, 0x5b, 0x2f, 0x5c, 0x78, 0x71, 0x73, 0x73, 0x61, 0x4b, 0x2e, 0x42, 0x2b, 0x4d, 0x4e, 0x87, 0xde, 0xcd, 0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0xd2, 0xd2, 0xd7, 0xd2, 0xd7, 0xd5, 0xd7, 0xd3, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xcd, 0xf7, 0x81, 0x29, 0x28, 0x42, 0x3c, 0x37, 0x38, 0x38, 0x34, 0x4f, 0x73, 0x78, 0x75, 0x5a, 0x6e, 0x7e, 0x92, 0xed, 0xd8, 0xcf, 0xcf, 0xd4, 0xd0, 0xd3, 0xd1, 0xd1, 0xd1, 0xd6, 0xd1, 0xcb, 0xc5, 0xb4, 0xb4, 0xaf, 0xca, 0xf7, 0x7d, 0x95, 0xdb, 0xa8, 0xae, 0xae, 0xad, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xbe, 0xbe, 0xae, 0xbe, 0xae, 0xb0, 0xb4, 0xb0, 0xb0, 0xb1, 0xae, 0xb0, 0xb4, 0xad, 0xac, 0xaf, 0xd7, 0xe8, 0xea, 0xf1, 0xff, 0xf8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xe9, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xed, 0xf2, 0xf2, 0xf4, 0xf7, 0xeb, 0x0a, 0x98, 0x99, 0x99, 0x9b, 0x99, 0x9b, 0x9b, 0x9d, 0xa2, 0xa7, 0xaf, 0xb5, 0xb7, 0xb4, 0xb4, 0xb0, 0xb3, 0xb3, 0xb4, 0xb3, 0xb0, 0xb0, 0xb3, 0xb3, 0xb2, 0xb3, 0xb3, 0xae, 0xad, 0xdb, 0x83, 0x85, 0xe0, 0xaf, 0xb2, 0xb3, 0xc5, 0xcb, 0xd6, 0xd6, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd4, 0xd0, 0xd4, 0xd1, 0xd6, 0xd2, 0xd2, 0xe0, 0xf1, 0x8b, 0x79, 0x5b, 0x45, 0x5c, 0x78, 0x73, 0x78, 0x69, 0x6a, 0x69, 0x3c, 0x58, 0x26, 0x65, 0xf7, 0xd8, 0xcf, 0xd4, 0xd4, 0xd0, 0xd4, 0xd5, 0xd7, 0xd2, 0xd7, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd7, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xcf, 0xdc, 0x8e, 0x46, 0x33, 0x34, 0x30, 0x30, 0x30, 0x4a, 0x61, 0x73, 0x78, 0x72, 0x5a, 0x57, 0x77, 0x86, 0xfe, 0xfd, 0xd8, 0xcd, 0xd1, 0xd0, 0xcd, 0xd4, 0xd0, 0xd2, 0xd5, 0xd3, 0xd0, 0xd1, 0xd6, 0xd1, 0xcb, 0xc5, 0xaf, 0xc4, 0xe3, 0xe8, 0xde, 0xaf, 0xad, 0xae, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xae, 0xb0, 0xb0, 0xb1, 0xbe, 0xb0, 0xbe, 0xbe, 0xae, 0xbe, 0xae, 0xb0, 0xb0, 0xb3, 0xae, 0xae, 0xb2, 0xbe, 0xad, 0xac, 0xcd, 0xf2, 0xf2, 0xfa, 0xfb, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xe6, 0xf2, 0xf2, 0xf2, 0xe2, 0xc2, 0xbc, 0x99, 0x99, 0x99, 0x9c, 0x9b, 0x9b, 0x9d, 0x9f, 0xa7, 0xaf, 0xc4, 0xc1, 0xb5, 0xb4, 0xb1, 0xb3, 0xb3, 0xb2, 0xbe, 0xbe, 0xb4, 0xb4, 0xbe, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb3, 0xa8, 0xde, 0xf1, 0xdb, 0xa9, 0xb6, 0xcb, 0xda, 0xd4, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd4, 0xd3, 0xd0, 0xd3, 0xd0, 0xd1, 0xd1, 0xd4, 0xd0, 0xcf, 0xdc, 0xe3, 0xff, 0x8d, 0x81, 0x5b, 0x48, 0x60, 0x60, 0x6f, 0x76, 0x75, 0x78, 0x70, 0x61, 0x46, 0x79, 0xe0, 0xd8, 0xcf, 0xda, 0xd0, 0xd3, 0xd5, 0xd5, 0xd5, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd7, 0xd2, 0xd8, 0xfd, 0x64, 0x23, 0x38, 0x2b, 0x34, 0x56, 0x75, 0x78, 0x6b, 0x5a, 0x48, 0x4e, 0x77, 0x85, 0x93, 0xf8, 0xdf, 0xcf, 0xd2, 0xd1, 0xd0, 0xd6, 0xd1, 0xd5, 0xd2, 0xd2, 0xd2, 0xd3, 0xd3, 0xd4, 0xd1, 0xd1, 0xda, 0xda, 0xca, 0xc4, 0xe1, 0xe1, 0xb5, 0xa9, 0xb2, 0xae, 0xae, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xbe, 0xb0, 0xbe, 0xae, 0xbe, 0xbe, 0xb3, 0xb2, 0xb2, 0xae, 0xb2, 0xb3, 0xb2, 0xae, 0xb2, 0xbe, 0xaf, 0xac, 0xde, 0xf2, 0xe6, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xe9, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xee, 0xef, 0xf4, 0xec, 0xc6, 0xa1, 0x99, 0x99, 0x99, 0xbb, 0x9e, 0x9d, 0x9b, 0xa2, 0xa8, 0xaf, 0xc0, 0xc0, 0xb1, 0xbe, 0xb3, 0xb2, 0xb3, 0xb2, 0xb3, 0xb3, 0xb2, 0xbe, 0xb2, 0xb0, 0xb4, 0xbe, 0xb1, 0xbe, 0xb1, 0xb1, 0xb4, 0xae, 0xb6, 0xb0, 0xac, 0xdc, 0xd1, 0xa9, 0xc8, 0xd6, 0xd0, 0xd2, 0xd1, 0xd0, 0xd1, 0xd0, 0xd4, 0xd0, 0xd0, 0xd3, 0xd3, 0xd3, 0xd1, 0xd1, 0xd1, 0xd0, 0xd1, 0xcd, 0xd0, 0xdb, 0xf7, 0xfe, 0x90, 0x87, 0x82, 0x74, 0x57, 0x57, 0x5a, 0x60, 0x75, 0x78, 0x6b, 0x27, 0x7d, 0xde, 0xd2, 0xcf, 0xd5, 0xd4, 0xd3, 0xd3, 0xd4, 0xd1, 0xd1, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd2, 0xd2, 0xd0, 0xe0, 0x83, 0x2f, 0x35, 0x61, 0x61, 0x78, 0x76, 0x57, 0x46, 0x5b, 0x77, 0x7e, 0x8a, 0x93, 0xec, 0xe1, 0xcf, 0xcf, 0xd0, 0xd5, 0xd4, 0xd4, 0xd0, 0xd0, 0xd3, 0xd5, 0xd2, 0xd5, 0xd2, 0xd4, 0xd3, 0xd4, 0xd0, 0xda, 0xd7, 0xd7, 0xdc, 0xdc, 0xc5, 0xaa, 0xb0, 0xb2, 0xae, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xae, 0xb0, 0xb0, 0xbe, 0xae, 0xbe, 0xb0, 0xbe, 0xb0, 0xbe, 0xb2, 0xb0, 0xb2, 0xb2, 0xb0, 0xb3, 0xb2, 0xbe, 0xbe, 0xb1, 0xac, 0xdc, 0xe7, 0x9a, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xef, 0xec, 0xf6, 0x99, 0x99, 0x9c, 0x9c, 0xbb, 0x9b, 0x9b, 0x9d, 0xa5, 0xb5, 0xc1, 0xc0, 0xbe, 0xbe, 0xb6, 0xb2, 0xb2, 0xb3, 0xb4, 0xb3, 0xb2, 0xb3, 0xb3, 0xb3, 0xae, 0xb3, 0xb3, 0xb3, 0xb2, 0xb0, 0xb2, 0xb2, 0xae, 0xb6, 0xaa, 0xb3, 0xb0, 0xae, 0xb1, 0xaa, 0xd6, 0xd6, 0xd2, 0xda, 0xd0, 0xd1, 0xd3, 0xd0, 0xd0, 0xd3, 0xd3, 0xd3, 0xd1, 0xd3, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd6, 0xd0, 0xd0, 0xd2, 0xdb, 0xde, 0xe5, 0xfb, 0x91, 0x8f, 0x87, 0x84, 0x7c, 0x6e, 0x57, 0x57, 0x4e, 0xdd, 0xe3, 0xd8, 0xd7, 0xd0, 0xd4, 0xd3, 0xd4, 0xd1, 0xd1, 0xd1, 0xd5, 0xd2, 0xd3, 0xd2, 0xd3, 0xd2, 0xd3, 0xd2, 0xd3, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd2, 0xd7, 0xe8, 0x7f, 0x27, 0x4e, 0x57, 0x6e, 0x74, 0x7c, 0x81, 0x8a, 0x8d, 0x92, 0xfe, 0xf7, 0xde, 0xd8, 0xcd, 0xd0, 0xd6, 0xd5, 0xd0, 0xd5, 0xd3, 0xd1, 0xd0, 0xd3, 0xd3, 0xd3, 0xd2, 0xd3, 0xd5, 0xd4, 0xd4, 0xd7, 0xd2, 0xd2, 0xd3, 0xda, 0xda, 0xac, 0xad, 0xb4, 0xbe, 0xb2, 0xae, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xbe, 0xb0, 0xbe, 0xb2, 0xb2, 0xb2, 0xb0, 0xbe, 0xbe, 0xad, 0xb1, 0xaf, 0xaf, 0xe3, 0xba, 0xba, 0xe9, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xe9, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf2, 0xec, 0xf2, 0xf4, 0xcc, 0x99, 0x9c, 0x9c, 0x99, 0x96, 0x9c, 0x9b, 0x9f, 0xac, 0xc1, 0xb4, 0xb0, 0xbe, 0xb2, 0xb4, 0xb2, 0xb2, 0xb2, 0xb3, 0xb2, 0xb4, 0xb4, 0xb0, 0xb4, 0xb4, 0xb7, 0xb0, 0xb0, 0xb0, 0xae, 0xb3, 0xae, 0xb3, 0xb2, 0xb4, 0xb2, 0xb3, 0xae, 0xb3, 0xae, 0xc0, 0xd0, 0xd4, 0xd0, 0xd3, 0xd0, 0xd0, 0xd3, 0xd3, 0xd1, 0xd0, 0xd4, 0xd1, 0xd0, 0xd4, 0xd1, 0xd4, 0xd3, 0xd3, 0xd3, 0xd1, 0xd1, 0xd1, 0xd0, 0xd2, 0xd2, 0xcd, 0xd1, 0xdc, 0xe1, 0xf7, 0xf8, 0xfe, 0xfa, 0xfe, 0x8b, 0x8b, 0xf1, 0xe1, 0xcd, 0xd2, 0xd0, 0xd4, 0xd3, 0xd5, 0xd3, 0xd4, 0xd0, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd3, 0xd2, 0xd3, 0xd2, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd4, 0xd3, 0xd4, 0xd3, 0xd3, 0xd5, 0xd2, 0xd5, 0xd2, 0xd7, 0xe4, 0xfe, 0xfe, 0x91, 0xfe, 0x90, 0xfe, 0xf9, 0xf8, 0xf7, 0xe0, 0xdd, 0xd8, 0xcf, 0xcd, 0xd0, 0xd1, 0xd4, 0xd0, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd0, 0xd0, 0xd1, 0xd3, 0xd3, 0xd4, 0xd5, 0xd2, 0xd7, 0xda, 0xda, 0xda, 0xc3, 0xad, 0xb1, 0xb1, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xbe, 0xb0, 0xbe, 0xb3, 0xb1, 0xae, 0xc0, 0xb1, 0xaf, 0xaf, 0xd8, 0xf3, 0xe8, 0xe9, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xf2, 0xf2, 0xdd, 0x98, 0x99, 0x9c, 0x96, 0x9c, 0x9c, 0x99, 0xa5, 0xb5, 0xb1, 0xb6, 0xb2, 0xb1, 0xb4, 0xb4, 0xb2, 0xb4, 0xb3, 0xb3, 0xb4, 0xb0, 0xb4, 0xc0, 0xb5, 0xa8, 0xaf, 0xac, 0xc0, 0xb7, 0xb1, 0xb0, 0xb0, 0xbe, 0xb3, 0xb0, 0xc0, 0xae, 0xb3, 0xb3, 0xbe, 0xaf, 0xca, 0xd7, 0xd6, 0xd1, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xd1, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd3, 0xd5, 0xd3, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd3, 0xd0, 0xd1, 0xd0, 0xd2, 0xce, 0xd8, 0xdc, 0xde, 0xde, 0xe0, 0xdc, 0xd2, 0xd5, 0xda, 0xd1, 0xd1, 0xd5, 0xd2, 0xd7, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd3, 0xd2, 0xd3, 0xd2, 0xd3, 0xd2, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd0, 0xd4, 0xd0, 0xd4, 0xd3, 0xd5, 0xd4, 0xd2, 0xd7, 0xd2, 0xdc, 0xdf, 0xe1, 0xde, 0xde, 0xde, 0xdd, 0xd8, 0xcf, 0xd0, 0xd2, 0xd2, 0xd2, 0xd5, 0xd4, 0xd7, 0xd2, 0xd2, 0xd2, 0xd7, 0xd6, 0xd1, 0xd1, 0xd2, 0xd3, 0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0xd4, 0xd3, 0xd7, 0xd7, 0xd2, 0xda, 0xd6, 0xc3, 0xae, 0xb1, 0xb4, 0xb1, 0xb1, 0xb3, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb3, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbe, 0xb2, 0xb3, 0xae, 0xad, 0xac, 0xaf, 0xdc, 0xea, 0xea, 0xed, 0xf0, 0xf8, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xf2, 0xf4, 0xd9, 0xbc, 0x99, 0x9c, 0x96, 0x99, 0x9d, 0xa2, 0xaf, 0xc1, 0xae, 0xb2, 0xb0, 0xb1, 0xb4, 0xb4, 0xb3, 0xb0, 0xb3, 0xb3, 0xb4, 0xb4, 0xaf, 0xa2, 0x9b, 0x9d, 0x9d, 0x9f, 0xa7, 0xaf, 0xb5, 0xb1, 0xb1, 0xb3, 0xb3, 0xb0, 0xb4, 0xae, 0xb3, 0xb3, 0xc1, 0xac, 0xc1, 0xd6, 0xd6, 0xd4, 0xd0, 0xd0, 0xd1, 0xd3, 0xd1, 0xd3, 0xd0, 0xd3, 0xd3, 0xd4, 0xd3, 0xd3, 0xd2, 0xd0, 0xd3, 0xd1, 0xd1, 0xd1, 0xd1, 0xd3, 0xd2, 0xd2, 0xd1, 0xd0, 0xd2, 0xd7, 0xd7, 0xd0, 0xd1, 0xd0, 0xd0, 0xd2, 0xd8, 0xd0, 0xd0, 0xda, 0xd3, 0xd5, 0xd7, 0xd2, 0xd7, 0xd2, 0xd7, 0xd3, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd3, 0xd2, 0xd3, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd3, 0xd3, 0xd5, 0xd3, 0xd3, 0xd3, 0xd5, 0xd3, 0xd3, 0xd4, 0xd0, 0xd4, 0xd3, 0xd4, 0xd3, 0xd7, 0xd3, 0xd7, 0xd7, 0xd2, 0xcf, 0xcf, 0xd1, 0xd1, 0xd0, 0xd2, 0xd5, 0xd1, 0xd1, 0xd3, 0xd0, 0xd0, 0xd0, 0xd5, 0xd5, 0xd7, 0xd2, 0xd7, 0xd2, 0xd2, 0xd1, 0xd4, 0xd0, 0xd5, 0xd4, 0xd0, 0xd0, 0xd1, 0xd3, 0xd4, 0xd5, 0xd5, 0xd7, 0xda, 0xd1, 0xb6, 0xae, 0xb0, 0xb1, 0xb1, 0xb1, 0xb0, 0xae, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb3, 0xb3, 0xb0, 0xb0, 0xb0, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xac, 0xad, 0xb5, 0xcf, 0xe4, 0xf3, 0xea, 0xe6, 0xf2, 0xf8, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xf2, 0xef, 0xef, 0xf3, 0xdd, 0xa6, 0x99, 0x99, 0x9b, 0x9e, 0x9d, 0x9f, 0xa8, 0xb5, 0xc1, 0xb7, 0xb3, 0xb3, 0xae, 0xb3, 0xb3, 0xb3, 0xb0, 0xb2, 0xb4, 0xa8, 0x9b, 0x99, 0x9d, 0x9b, 0x9d, 0x9d, 0xa5, 0xaf, 0xc0, 0xb0, 0xb3, 0xb3, 0xb0, 0xb3, 0xb4, 0xb3, 0xb1, 0xb4, 0xb4, 0xad, 0xb4, 0xc5, 0xd1, 0xda, 0xda, 0xd0, 0xd1, 0xd7, 0xd4, 0xd7, 0xd5, 0xd2, 0xd3, 0xd3, 0xd5, 0xd4, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xd1, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd7, 0xd5, 0xd7, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd2, 0xd2, 0xd7, 0xd2, 0xd7, 0xd2, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd3, 0xd4, 0xd3, 0xd3, 0xd4, 0xd0, 0xd3, 0xd4, 0xd3, 0xd4, 0xd3, 0xd4, 0xd3, 0xd4, 0xd3, 0xd3, 0xd3, 0xd4, 0xd5, 0xd4, 0xd4, 0xd5, 0xd5, 0xd5, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd5, 0xd2, 0xd5, 0xd0, 0xd0, 0xd0, 0xd4, 0xd4, 0xd5, 0xd0, 0xd0, 0xd7, 0xda, 0xd1, 0xc5, 0xb1, 0xaf, 0xb1, 0xb4, 0xb1, 0xb0, 0xb1, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xb0, 0xb1, 0xb0, 0xbe, 0xae, 0xb0, 0xb3, 0xb2, 0xb2, 0xae, 0xb2, 0xb4, 0xb3, 0xb4, 0xae, 0xb0, 0xaa, 0xac, 0xc4, 0xdb, 0xe4, 0xea, 0xea, 0xe8, 0xe9, 0xe9, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xf4, 0xf3, 0xdd, 0xf6, 0xbc, 0x99, 0x9b, 0x9b, 0x9d, 0xa2, 0xa5, 0xa8, 0xb5, 0xb7, 0xb7, 0xb4, 0xb0, 0xb3, 0xb0, 0xb4, 0xb4, 0xa9, 0x9f, 0x9d, 0x9d, 0x9f, 0x9d, 0x9f, 0xa4, 0xb0, 0xc0, 0xb3, 0xb4, 0xb3, 0xb0, 0xb0, 0xb0, 0xb1, 0xb4, 0xb1, 0xc0, 0xc0, 0xb1, 0xad, 0xc0, 0xc5, 0xcb, 0xd6, 0xda, 0xd6, 0xd0, 0xd0, 0xd0, 0xd7, 0xd1, 0xd1, 0xd1, 0xd0, 0xd1, 0xd1, 0xd0, 0xd1, 0xd0, 0xd1, 0xd0, 0xd5, 0xd3, 0xd5, 0xd3, 0xd2, 0xd5, 0xd5, 0xd2, 0xd7, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 0xd3, 0xd4, 0xd4, 0xd3, 0xd4, 0xd5, 0xd7, 0xd7, 0xd2, 0xd7, 0xd5, 0xd7, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd1, 0xd0, 0xd3, 0xd4, 0xd4, 0xd0, 0xd0, 0xd2, 0xd0, 0xd5, 0xd0, 0xcd, 0xd1, 0xda, 0xda, 0xd1, 0xc3, 0xb1, 0xad, 0xb0, 0xb0, 0xb4, 0xb0, 0xb0, 0xb3, 0xb0, 0xb3, 0xbe, 0xae, 0xb3, 0xb0, 0xb0, 0xb0, 0xae, 0xbe, 0xb0, 0xb0, 0xb2, 0xb0, 0xbe, 0xb3, 0xb4, 0xb0, 0xad, 0xac, 0xac, 0xac, 0xb5, 0xd4, 0xe1, 0xe8, 0xf2, 0xe8, 0xe8, 0xf2, 0xed, 0xee, 0xe9, 0xee, 0xba, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xe6, 0xed, 0xed, 0xf2, 0xed, 0xf2, 0xf3, 0x95, 0xdf, 0xc7, 0xbd, 0x9e, 0x9b, 0x9b, 0x9b, 0x9d, 0xa2, 0xa4, 0xa7, 0xac, 0xb5, 0xc1, 0xb7, 0xc0, 0xc0, 0xb1, 0xb1, 0xa5, 0xa5, 0xa7, 0xa9, 0xa5, 0xb7, 0xb7, 0xb4, 0xb6, 0xb6, 0xb4, 0xb0, 0xbe, 0xb1, 0xbe, 0xb4, 0xbe, 0xb4, 0xbe, 0xb4, 0xb1, 0xb1, 0xaf, 0xb4, 0xc3, 0xc8, 0xcb, 0xd6, 0xd6, 0xda, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd4, 0xd0, 0xd4, 0xd0, 0xd4, 0xd0, 0xd3, 0xd3, 0xd0, 0xd5, 0xd0, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd7, 0xd5, 0xd5, 0xd7, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd4, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd4, 0xd4, 0xd4, 0xd0, 0xd3, 0xd0, 0xd3, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd1, 0xd0, 0xd0, 0xd5, 0xd3, 0xda, 0xda, 0xda, 0xcb, 0xc8, 0xb7, 0xb0, 0xad, 0xb3, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb2, 0xae, 0xb2, 0xb2, 0xae, 0xb3, 0xb3, 0xb4, 0xb3, 0xad, 0xb0, 0xb1, 0xac, 0xac, 0xac, 0xb5, 0xc4, 0xcf, 0xe1, 0xe4, 0xe8, 0xea, 0xe8, 0xe8, 0xea, 0xed, 0xe7, 0xed, 0xe9, 0xed, 0xee, 0xba, 0xe9, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xed, 0xed, 0xee, 0xf2, 0xf2, 0xe6, 0xf0, 0xfb, 0x95, 0xf4, 0x95, 0xe0, 0xcc, 0xbf, 0xa3, 0xa0, 0x99, 0x99, 0x9b, 0x9d, 0x9f, 0xa2, 0xa5, 0xa7, 0xaa, 0xaf, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7, 0xc3, 0xb0, 0xb4, 0xb2, 0xbe, 0xbe, 0xb1, 0xb1, 0xbe, 0xb1, 0xbe, 0xbe, 0xb4, 0xb4, 0xb2, 0xbe, 0xbe, 0xb4, 0xb0, 0xb0, 0xb1, 0xae, 0xc0, 0xb7, 0xc8, 0xcb, 0xd1, 0xd6, 0xda, 0xd6, 0xd4, 0xd0, 0xd0, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd1, 0xd0, 0xd1, 0xd0, 0xd4, 0xd0, 0xd5, 0xd4, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd7, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd4, 0xd5, 0xd4, 0xd5, 0xd4, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd3, 0xd4, 0xd4, 0xd1, 0xd4, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd5, 0xd3, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd1, 0xd4, 0xd6, 0xda, 0xda, 0xd0, 0xcb, 0xc8, 0xb7, 0xb4, 0xae, 0xae, 0xb3, 0xb3, 0xb3, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xae, 0xb3, 0xb3, 0xb2, 0xb0, 0xb0, 0xad, 0xad, 0xaa, 0xac, 0xac, 0xaf, 0xb5, 0xc9, 0xcd, 0xde, 0xe3, 0xe8, 0xea, 0xf3, 0xf3, 0xf1, 0xea, 0xe9, 0xea, 0xed, 0xe9, 0xf2, 0xed, 0xed, 0xef, 0xe9, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xe8, 0xe9, 0xe9, 0xee, 0xfb, 0xee, 0xfb, 0xf4, 0xf4, 0xf3, 0xec, 0xdf, 0xd9, 0xc7, 0xab, 0xa6, 0xa2, 0x9d, 0x9d, 0x9d, 0x9d, 0x9f, 0xa2, 0xa4, 0xa5, 0xa8, 0xa8, 0xac, 0xaf, 0xb1, 0xb1, 0xbe, 0xb1, 0xb1, 0xb1, 0xb0, 0xb1, 0xb0, 0xb1, 0xb3, 0xb2, 0xb3, 0xb3, 0xb3, 0xb2, 0xae, 0xb3, 0xb2, 0xae, 0xbe, 0xae, 0xae, 0xae, 0xb2, 0xc1, 0xc5, 0xc8, 0xcb, 0xd0, 0xd4, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd0, 0xd4, 0xd0, 0xd0, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd2, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd7, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd0, 0xd4, 0xd0, 0xd3, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd4, 0xd7, 0xd4, 0xd2, 0xcb, 0xc8, 0xc3, 0xc0, 0xad, 0xbe, 0xad, 0xb0, 0xae, 0xb0, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb2, 0xb3, 0xb3, 0xb4, 0xb1, 0xb0, 0xb1, 0xb0, 0xad, 0xad, 0xaa, 0xac, 0xaf, 0xaf, 0xc3, 0xc9, 0xcd, 0xdc, 0xe1, 0xe4, 0xe7, 0xf2, 0xe8, 0xea, 0xea, 0xea, 0xf1, 0xed, 0xef, 0xf0, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xed, 0xe9, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xe7, 0xea, 0xba, 0xe9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xe6, 0xe2, 0xdd, 0xce, 0xc4, 0xfc, 0xa7, 0xa5, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa5, 0xa5, 0xa8, 0xa9, 0xac, 0xad, 0xad, 0xb1, 0xb1, 0xc0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb2, 0xb0, 0xb2, 0xbe, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xad, 0xac, 0xad, 0xad, 0xc0, 0xc1, 0xc5, 0xcb, 0xcb, 0xd6, 0xd1, 0xda, 0xd7, 0xda, 0xd7, 0xd7, 0xd5, 0xd7, 0xd7, 0xd7, 0xd2, 0xd2, 0xd5, 0xd3, 0xd5, 0xd4, 0xd5, 0xd4, 0xd3, 0xd4, 0xd3, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd3, 0xd3, 0xd5, 0xd5, 0xd3, 0xd5, 0xd4, 0xd5, 0xd4, 0xd7, 0xd2, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xda, 0xd5, 0xd4, 0xd3, 0xd0, 0xcb, 0xc8, 0xc1, 0xaf, 0xaf, 0xad, 0xae, 0xae, 0xbe, 0xb0, 0xbe, 0xb0, 0xb4, 0xb4, 0xb1, 0xb4, 0xb1, 0xb1, 0xb1, 0xad, 0xaf, 0xad, 0xac, 0xac, 0xac, 0xac, 0xb5, 0xb5, 0xc4, 0xca, 0xd5, 0xde, 0xe1, 0xe5, 0xe7, 0xea, 0xf2, 0xea, 0xea, 0xf2, 0xe8, 0xba, 0xe8, 0xe9, 0xe9, 0xee, 0xe9, 0xee, 0xee, 0xf0, 0xf8, 0xf8, 0xef, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xe8, 0xb9, 0xe8, 0xba, 0xba, 0xe9, 0xef, 0xee, 0xe9, 0xef, 0xee, 0xb9, 0xee, 0x9a, 0xee, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xe6, 0xe0, 0xdd, 0xce, 0xca, 0xc4, 0xb5, 0xaf, 0xac, 0xac, 0xac, 0xa8, 0xac, 0xa8, 0xac, 0xac, 0xac, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb0, 0xad, 0xb1, 0xb1, 0xbe, 0xbe, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xaa, 0xae, 0xaa, 0xaa, 0xaa, 0xae, 0xb6, 0xc3, 0xc5, 0xc8, 0xcb, 0xcb, 0xd1, 0xd1, 0xd1, 0xd1, 0xd6, 0xd6, 0xda, 0xda, 0xda, 0xd4, 0xda, 0xd4, 0xda, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd4, 0xd7, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd4, 0xd3, 0xd4, 0xd4, 0xd4, 0xd5, 0xd4, 0xd5, 0xd4, 0xd3, 0xd3, 0xd3, 0xd5, 0xd4, 0xd4, 0xda, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd7, 0xda, 0xd7, 0xda, 0xd7, 0xda, 0xd3, 0xd0, 0xcd, 0xcb, 0xcb, 0xc8, 0xc3, 0xc3, 0xc0, 0xb1, 0xad, 0xa9, 0xaa, 0xad, 0xb1, 0xbe, 0xae, 0xae, 0xb0, 0xae, 0xb1, 0xad, 0xad, 0xaf, 0xac, 0xaf, 0xaf, 0xaf, 0xb5, 0xb5, 0xc4, 0xc9, 0xc9, 0xcf, 0xd8, 0xde, 0xe1, 0xe3, 0xe8, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xe9, 0xf0, 0xef, 0xf0, 0xf0, 0xf8, 0xee, 0xed, 0xee, 0xe6, 0xba, 0xb9, 0xb9, 0xb9, 0xba, 0xf8, 0xf0, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xf1, 0xef, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xef, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xe9, 0xe7, 0xe9, 0xba, 0xed, 0xba, 0xe9, 0xe9, 0xe9, 0xef, 0xe9, 0xba, 0xe6, 0xe6, 0xee, 0xee, 0xff, 0xef, 0xf0, 0xf8, 0xf0, 0xf8, 0xfb, 0xfb, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xe9, 0xe5, 0xec, 0xe3, 0xe0, 0xde, 0xdc, 0xcf, 0xcd, 0xc9, 0xc9, 0xc4, 0xb5, 0xb5, 0xaf, 0xac, 0xac, 0xac, 0xaf, 0xac, 0xac, 0xac, 0xa9, 0xac, 0xa9, 0xaa, 0xae, 0xaa, 0xae, 0xaa, 0xaa, 0xae, 0xae, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xae, 0xae, 0xae, 0xb3, 0xb6, 0xc5, 0xc5, 0xc8, 0xc8, 0xcb, 0xcb, 0xcb, 0xd0, 0xd1, 0xd1, 0xd6, 0xd6, 0xd6, 0xd4, 0xd6, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd6, 0xda, 0xd6, 0xda, 0xd6, 0xda, 0xd6, 0xd4, 0xda, 0xd6, 0xda, 0xd4, 0xda, 0xd4, 0xd6, 0xda, 0xda, 0xda, 0xd4, 0xd6, 0xd4, 0xd4, 0xd4, 0xd0, 0xd4, 0xd0, 0xd0, 0xd0, 0xcb, 0xd0, 0xcb, 0xcb, 0xc8, 0xc8, 0xc5, 0xc3, 0xb7, 0xc0, 0xb1, 0xb1, 0xad, 0xac, 0xad, 0xad, 0xaa, 0xaa, 0xad, 0xaa, 0xad, 0xad, 0xaa, 0xaa, 0xaa, 0xac, 0xaa, 0xad, 0xaf, 0xaf, 0xaf, 0xc4, 0xc4, 0xc9, 0xcd, 0xd8, 0xde, 0xe1, 0xe1, 0xe4, 0xe5, 0xe8, 0xea, 0xf2, 0xf2, 0xe8, 0xea, 0xe8, 0xf2, 0xea, 0xf2, 0xed, 0xef, 0xf0, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xf0, 0xf0, 0xee, 0xef, 0xba, 0xba, 0xb9, 0xb9, 0xb9, 0xb9, 0xf0, 0xf8, 0xef, 0xee, 0xed, 0xe9, 0xef, 0xed, 0xef, 0xef, 0xf0, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xf8, 0xf0, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xf2, 0xe9, 0xed, 0xee, 0xf0, 0xef, 0xee, 0xee, 0xe9, 0xe9, 0x9a, 0xf0, 0xee, 0xee, 0xef, 0xef, 0xe6, 0xe6, 0xea, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xea, 0xe8, 0xe4, 0xe3, 0xe1, 0xdd, 0xdc, 0xd8, 0xd8, 0xcd, 0xca, 0xc9, 0xc4, 0xc4, 0xc1, 0xb5, 0xaf, 0xaf, 0xa8, 0xa9, 0xa8, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaa, 0xaa, 0xaa, 0xa9, 0xaa, 0xa9, 0xa9, 0xa8, 0xa8, 0xa9, 0xa8, 0xa9, 0xac, 0xac, 0xac, 0xaf, 0xaf, 0xb1, 0xb5, 0xc0, 0xc1, 0xb7, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xc0, 0xb5, 0xc0, 0xb5, 0xaf, 0xac, 0xaf, 0xac, 0xaf, 0xac, 0xac, 0xa8, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xaa, 0xa9, 0xac, 0xac, 0xaf, 0xb5, 0xb5, 0xc3, 0xc4, 0xc9, 0xcd, 0xd0, 0xd8, 0xde, 0xde, 0xe3, 0xe7, 0xea, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xed, 0xe9, 0xfb, 0xed, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xf8, 0xf0, 0xf8, 0xf0, 0xef, 0xee, 0xed, 0xee, 0xef, 0xee, 0xed, 0xee, 0xee, 0xee, 0xef, 0xf8, 0xef, 0xef, 0xed, 0xba, 0xe9, 0xee, 0xef, 0xf8, 0xf0, 0xf0, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xfa, 0xfa, 0xf8, 0xfa, 0xf1, 0xed, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xef, 0xf1, 0xef, 0xed, 0xf0, 0xf8, 0xe6, 0xe6, 0xb9, 0xb9, 0xb8, 0xe6, 0xba, 0x9a, 0xba, 0xe6, 0xf2, 0xf2, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xba, 0xea, 0xea, 0xf3, 0xf2, 0xf2, 0x9a, 0xea, 0xba, 0xba, 0xe8, 0xe7, 0xe7, 0xe5, 0xe4, 0xe3, 0xe3, 0xe1, 0xe1, 0xde, 0xdc, 0xd8, 0xcf, 0xcd, 0xca, 0xc4, 0xc4, 0xb5, 0xb5, 0xb5, 0xaf, 0xaf, 0xac, 0xac, 0xaa, 0xac, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xac, 0xa9, 0xa9, 0xac, 0xa9, 0xac, 0xac, 0xa9, 0xac, 0xa9, 0xac, 0xac, 0xac, 0xa8, 0xac, 0xac, 0xaf, 0xaf, 0xb5, 0xb5, 0xc4, 0xc4, 0xc9, 0xc9, 0xca, 0xcf, 0xd8, 0xdc, 0xde, 0xde, 0xe1, 0xe3, 0xe3, 0xe5, 0xe7, 0xe7, 0xe8, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xea, 0xe6, 0xe6, 0xe8, 0xe9, 0xe9, 0xe6, 0xba, 0xe9, 0x9a, 0xe9, 0xba, 0xe6, 0xee, 0xf8, 0xf8, 0xee, 0xf0, 0xed, 0xf0, 0xed, 0xed, 0xf2, 0xef, 0xef, 0xed, 0xe9, 0xe9, 0xef, 0xe9, 0xe9, 0xe9, 0xed, 0xef, 0xed, 0xf0, 0xf8, 0xf0, 0xfa, 0xf8, 0xfa, 0xef, 0xf0, 0xed, 0xe9, 0xe9, 0xb9, 0xef, 0xee, 0xee, 0xff, 0xf8, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xfa, 0xf8, 0xf1, 0xf8, 0xf0, 0xf1, 0xef, 0xef, 0xef, 0xed, 0xf0, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xf2, 0xe9, 0xba, 0xe7, 0xb9, 0xba, 0xba, 0xe6, 0xe9, 0xe9, 0xe6, 0xf8, 0xf0, 0xf0, 0xfa, 0xf8, 0xfa, 0xf8, 0xf0, 0xf8, 0xfa, 0xf8, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xee, 0xed, 0xe6, 0xe9, 0xe8, 0xba, 0xe8, 0xba, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf2, 0xea, 0xe7, 0xe7, 0xe4, 0xe4, 0xe1, 0xe1, 0xde, 0xde, 0xde, 0xdc, 0xdc, 0xd8, 0xd8, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xca, 0xc9, 0xca, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xca, 0xca, 0xcd, 0xcd, 0xcd, 0xcf, 0xcf, 0xcf, 0xd8, 0xd8, 0xdc, 0xde, 0xde, 0xe1, 0xde, 0xe1, 0xe1, 0xe4, 0xe4, 0xe4, 0xe7, 0xe8, 0xea, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xea, 0xea, 0xf2, 0xea, 0xed, 0xed, 0xed, 0xf1, 0xef, 0xf0, 0xf0, 0xf2, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xee, 0xf0, 0xee, 0xf8, 0xee, 0xed, 0xf0, 0xef, 0xef, 0xed, 0xe9, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xef, 0xed, 0xf0, 0xf0, 0xf8, 0xf0, 0xf0, 0xef, 0xed, 0xe9, 0xed, 0xe9, 0xee, 0xef, 0xee, 0xf8, 0xee, 0xee, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xed, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xf3, 0xf3, 0xf2, 0x9a, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xf2, 0xf0, 0xf2, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xee, 0xe9, 0xef, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xf0, 0xef, 0xf0, 0xe9, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xe8, 0xe6, 0xe8, 0xe9, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe8, 0xe8, 0xea, 0xe8, 0xba, 0xea, 0xe6, 0xe8, 0xe6, 0xe8, 0xba, 0xea, 0xea, 0xe9, 0xea, 0xef, 0xed, 0xee, 0xed, 0xf8, 0xed, 0xee, 0xed, 0xf8, 0xed, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xf2, 0xe9, 0xf2, 0xe9, 0xf2, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xea, 0xea, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xea, 0xf2, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xf2, 0xe9, 0xf2, 0xef, 0xf2, 0xe9, 0xf2, 0xef, 0xf2, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xed, 0xef, 0xed, 0xf2, 0xef, 0xf2, 0xef, 0xef, 0xed, 0xed, 0xed, 0xe9, 0xef, 0xe9, 0xf2, 0xf2, 0xe9, 0xf0, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xef, 0xed, 0xed, 0xed, 0xef, 0xe9, 0xef, 0xe9, 0xef, 0xef, 0xef, 0xe9, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xf0, 0xee, 0xef, 0xf0, 0xe9, 0xf0, 0xe9, 0xf0, 0xe9, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xed, 0xef, 0xed, 0xef, 0xed, 0xf0, 0xed, 0xf0, 0xef, 0xef, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xe9, 0xf0, 0xef, 0xf2, 0xee, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xf0, 0xee, 0xf0, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xef, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xed, 0xe9, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xed, 0xef, 0xed, 0xe9, 0xef, 0xe9, 0xef, 0xef, 0xe9, 0xef, 0xef, 0xe9, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xe9, 0xe9, 0xed, 0xe9, 0xe6, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xea, 0xed, 0xe9, 0xed, 0xe9, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe9, 0xef, 0xef, 0xe9, 0xed, 0xed, 0xed, 0xe9, 0xed, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xe9, 0xed, 0xef, 0xed, 0xe9, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 
-};
-
-const lv_img_dsc_t image10 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image10_map,
-};
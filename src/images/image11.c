@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE11
-#define LV_ATTRIBUTE_IMG_IMAGE11
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE11 uint8_t image11_map[] = {
-  0xe7, 0xeb, 0xfb, 0xff, 	/*Color of index 0*/
-  0xda, 0xe3, 0xfd, 0xff, 	/*Color of index 1*/
-  0xcf, 0xd5, 0xfa, 0xff, 	/*Color of index 2*/
-  0xc0, 0xc6, 0xf9, 0xff, 	/*Color of index 3*/
-  0xc2, 0xc0, 0xe1, 0xff, 	/*Color of index 4*/
-  0xac, 0xb3, 0xfa, 0xff, 	/*Color of index 5*/
-  0xa6, 0xad, 0xea, 0xff, 	/*Color of index 6*/
-  0xb7, 0xb7, 0xbf, 0xff, 	/*Color of index 7*/
-  0x94, 0x9c, 0xf8, 0xff, 	/*Color of index 8*/
-  0x96, 0x9b, 0xe5, 0xff, 	/*Color of index 9*/
-  0x83, 0x87, 0xec, 0xff, 	/*Color of index 10*/
-  0x92, 0x95, 0xb5, 0xff, 	/*Color of index 11*/
-  0x7a, 0x82, 0xcf, 0xff, 	/*Color of index 12*/
-  0x72, 0x75, 0xdf, 0xff, 	/*Color of index 13*/
-  0x7b, 0x7b, 0xb2, 0xff, 	/*Color of index 14*/
-  0x63, 0x69, 0xf0, 0xff, 	/*Color of index 15*/
-  0x66, 0x68, 0xda, 0xff, 	/*Color of index 16*/
-  0x65, 0x68, 0xc3, 0xff, 	/*Color of index 17*/
-  0x59, 0x5c, 0xdd, 0xff, 	/*Color of index 18*/
-  0x4c, 0x52, 0xec, 0xff, 	/*Color of index 19*/
-  0x5b, 0x61, 0xa5, 0xff, 	/*Color of index 20*/
-  0x57, 0x58, 0xc1, 0xff, 	/*Color of index 21*/
-  0x4d, 0x4c, 0xd7, 0xff, 	/*Color of index 22*/
-  0x60, 0x5f, 0x81, 0xff, 	/*Color of index 23*/
-  0x3d, 0x44, 0xe4, 0xff, 	/*Color of index 24*/
-  0x49, 0x4b, 0xc8, 0xff, 	/*Color of index 25*/
-  0x4b, 0x4c, 0xb6, 0xff, 	/*Color of index 26*/
-  0x48, 0x3f, 0xde, 0xff, 	/*Color of index 27*/
-  0x3d, 0x42, 0xd5, 0xff, 	/*Color of index 28*/
-  0x38, 0x3a, 0xed, 0xff, 	/*Color of index 29*/
-  0x41, 0x43, 0xc8, 0xff, 	/*Color of index 30*/
-  0x37, 0x3c, 0xdc, 0xff, 	/*Color of index 31*/
-  0x3a, 0x38, 0xe2, 0xff, 	/*Color of index 32*/
-  0x38, 0x3c, 0xd1, 0xff, 	/*Color of index 33*/
-  0x3f, 0x42, 0xb8, 0xff, 	/*Color of index 34*/
-  0x2b, 0x32, 0xf4, 0xff, 	/*Color of index 35*/
-  0x47, 0x47, 0xa3, 0xff, 	/*Color of index 36*/
-  0x2f, 0x34, 0xeb, 0xff, 	/*Color of index 37*/
-  0x3d, 0x3c, 0xc7, 0xff, 	/*Color of index 38*/
-  0x32, 0x34, 0xe2, 0xff, 	/*Color of index 39*/
-  0x2e, 0x37, 0xd6, 0xff, 	/*Color of index 40*/
-  0x33, 0x3b, 0xc5, 0xff, 	/*Color of index 41*/
-  0x3c, 0x35, 0xd6, 0xff, 	/*Color of index 42*/
-  0x2c, 0x30, 0xe4, 0xff, 	/*Color of index 43*/
-  0x23, 0x2e, 0xed, 0xff, 	/*Color of index 44*/
-  0x38, 0x3b, 0xba, 0xff, 	/*Color of index 45*/
-  0x21, 0x2b, 0xf4, 0xff, 	/*Color of index 46*/
-  0x2c, 0x2a, 0xf3, 0xff, 	/*Color of index 47*/
-  0x15, 0x2c, 0xf4, 0xff, 	/*Color of index 48*/
-  0x12, 0x2e, 0xec, 0xff, 	/*Color of index 49*/
-  0x21, 0x28, 0xfa, 0xff, 	/*Color of index 50*/
-  0x3a, 0x34, 0xc8, 0xff, 	/*Color of index 51*/
-  0x1a, 0x28, 0xf9, 0xff, 	/*Color of index 52*/
-  0x31, 0x30, 0xd6, 0xff, 	/*Color of index 53*/
-  0x2d, 0x35, 0xc6, 0xff, 	/*Color of index 54*/
-  0x1c, 0x29, 0xf3, 0xff, 	/*Color of index 55*/
-  0x2a, 0x25, 0xfb, 0xff, 	/*Color of index 56*/
-  0x1e, 0x2d, 0xe3, 0xff, 	/*Color of index 57*/
-  0x47, 0x43, 0x8b, 0xff, 	/*Color of index 58*/
-  0x38, 0x3b, 0xa9, 0xff, 	/*Color of index 59*/
-  0x2b, 0x29, 0xe9, 0xff, 	/*Color of index 60*/
-  0x1f, 0x25, 0xfa, 0xff, 	/*Color of index 61*/
-  0x1b, 0x29, 0xeb, 0xff, 	/*Color of index 62*/
-  0x1c, 0x25, 0xf4, 0xff, 	/*Color of index 63*/
-  0x1d, 0x23, 0xfa, 0xff, 	/*Color of index 64*/
-  0x15, 0x23, 0xfc, 0xff, 	/*Color of index 65*/
-  0x2e, 0x34, 0xb7, 0xff, 	/*Color of index 66*/
-  0x22, 0x23, 0xf4, 0xff, 	/*Color of index 67*/
-  0x30, 0x2f, 0xc6, 0xff, 	/*Color of index 68*/
-  0x2b, 0x2a, 0xd6, 0xff, 	/*Color of index 69*/
-  0x23, 0x1e, 0xfd, 0xff, 	/*Color of index 70*/
-  0x15, 0x22, 0xf4, 0xff, 	/*Color of index 71*/
-  0x34, 0x31, 0xb7, 0xff, 	/*Color of index 72*/
-  0x20, 0x29, 0xd8, 0xff, 	/*Color of index 73*/
-  0x1a, 0x1e, 0xfd, 0xff, 	/*Color of index 74*/
-  0x23, 0x22, 0xeb, 0xff, 	/*Color of index 75*/
-  0x19, 0x22, 0xeb, 0xff, 	/*Color of index 76*/
-  0x1c, 0x24, 0xde, 0xff, 	/*Color of index 77*/
-  0x2b, 0x33, 0xa5, 0xff, 	/*Color of index 78*/
-  0x1c, 0x1d, 0xf3, 0xff, 	/*Color of index 79*/
-  0x23, 0x21, 0xe3, 0xff, 	/*Color of index 80*/
-  0x26, 0x28, 0xca, 0xff, 	/*Color of index 81*/
-  0x43, 0x42, 0x68, 0xff, 	/*Color of index 82*/
-  0x16, 0x19, 0xfd, 0xff, 	/*Color of index 83*/
-  0x24, 0x24, 0xd3, 0xff, 	/*Color of index 84*/
-  0x24, 0x21, 0xdb, 0xff, 	/*Color of index 85*/
-  0x32, 0x33, 0x96, 0xff, 	/*Color of index 86*/
-  0x31, 0x2e, 0xa6, 0xff, 	/*Color of index 87*/
-  0x29, 0x2a, 0xb6, 0xff, 	/*Color of index 88*/
-  0x1c, 0x23, 0xc7, 0xff, 	/*Color of index 89*/
-  0x1b, 0x1f, 0xd4, 0xff, 	/*Color of index 90*/
-  0x1a, 0x1a, 0xdf, 0xff, 	/*Color of index 91*/
-  0x27, 0x28, 0xa7, 0xff, 	/*Color of index 92*/
-  0x33, 0x32, 0x7b, 0xff, 	/*Color of index 93*/
-  0x26, 0x28, 0x9b, 0xff, 	/*Color of index 94*/
-  0x2a, 0x2b, 0x8d, 0xff, 	/*Color of index 95*/
-  0x21, 0x23, 0x90, 0xff, 	/*Color of index 96*/
-  0x16, 0x18, 0xb8, 0xff, 	/*Color of index 97*/
-  0x26, 0x26, 0x7c, 0xff, 	/*Color of index 98*/
-  0x36, 0x2e, 0x58, 0xff, 	/*Color of index 99*/
-  0x19, 0x19, 0xa3, 0xff, 	/*Color of index 100*/
-  0x23, 0x1d, 0x8c, 0xff, 	/*Color of index 101*/
-  0x1d, 0x21, 0x7e, 0xff, 	/*Color of index 102*/
-  0x22, 0x25, 0x69, 0xff, 	/*Color of index 103*/
-  0x19, 0x1a, 0x86, 0xff, 	/*Color of index 104*/
-  0x1c, 0x1a, 0x7b, 0xff, 	/*Color of index 105*/
-  0x25, 0x22, 0x55, 0xff, 	/*Color of index 106*/
-  0x19, 0x19, 0x6f, 0xff, 	/*Color of index 107*/
-  0x16, 0x19, 0x60, 0xff, 	/*Color of index 108*/
-  0x0b, 0x0c, 0x89, 0xff, 	/*Color of index 109*/
-  0x11, 0x10, 0x76, 0xff, 	/*Color of index 110*/
-  0x12, 0x11, 0x6a, 0xff, 	/*Color of index 111*/
-  0x12, 0x11, 0x5d, 0xff, 	/*Color of index 112*/
-  0x14, 0x14, 0x4f, 0xff, 	/*Color of index 113*/
-  0x21, 0x19, 0x38, 0xff, 	/*Color of index 114*/
-  0x0c, 0x0c, 0x5e, 0xff, 	/*Color of index 115*/
-  0x11, 0x11, 0x3b, 0xff, 	/*Color of index 116*/
-  0x0a, 0x0a, 0x4f, 0xff, 	/*Color of index 117*/
-  0x05, 0x04, 0x5e, 0xff, 	/*Color of index 118*/
-  0x16, 0x14, 0x1e, 0xff, 	/*Color of index 119*/
-  0x0a, 0x08, 0x3e, 0xff, 	/*Color of index 120*/
-  0x04, 0x03, 0x4c, 0xff, 	/*Color of index 121*/
-  0x02, 0x02, 0x43, 0xff, 	/*Color of index 122*/
-  0x01, 0x01, 0x3a, 0xff, 	/*Color of index 123*/
-  0x02, 0x01, 0x32, 0xff, 	/*Color of index 124*/
-  0x01, 0x01, 0x2b, 0xff, 	/*Color of index 125*/
-  0x01, 0x00, 0x23, 0xff, 	/*Color of index 126*/
-  0x01, 0x00, 0x1a, 0xff, 	/*Color of index 127*/
-  0x02, 0x00, 0x12, 0xff, 	/*Color of index 128*/
-  0x02, 0x02, 0x0a, 0xff, 	/*Color of index 129*/
-  0xf4, 0xf6, 0xf9, 0xff, 	/*Color of index 130*/
-  0xea, 0xf2, 0xfb, 0xff, 	/*Color of index 131*/
-  0xfd, 0xfe, 0xfd, 0xff, 	/*Color of index 132*/
-  0x05, 0x0a, 0x02, 0xff, 	/*Color of index 133*/
-  0xfd, 0xfc, 0xf3, 0xff, 	/*Color of index 134*/
-  0xfb, 0xfa, 0xe8, 0xff, 	/*Color of index 135*/
-  0xfa, 0xf8, 0xd7, 0xff, 	/*Color of index 136*/
-  0xf7, 0xf2, 0xe5, 0xff, 	/*Color of index 137*/
-  0xf1, 0xea, 0xd7, 0xff, 	/*Color of index 138*/
-  0xfc, 0xf2, 0xb8, 0xff, 	/*Color of index 139*/
-  0xec, 0xe4, 0xce, 0xff, 	/*Color of index 140*/
-  0xf2, 0xe4, 0xae, 0xff, 	/*Color of index 141*/
-  0xdc, 0xd6, 0xc7, 0xff, 	/*Color of index 142*/
-  0xea, 0xd7, 0x9c, 0xff, 	/*Color of index 143*/
-  0xe0, 0xcc, 0x8b, 0xff, 	/*Color of index 144*/
-  0xd5, 0xc0, 0x85, 0xff, 	/*Color of index 145*/
-  0xd9, 0xc1, 0x75, 0xff, 	/*Color of index 146*/
-  0xb7, 0xb1, 0x9e, 0xff, 	/*Color of index 147*/
-  0xd8, 0xbd, 0x68, 0xff, 	/*Color of index 148*/
-  0xd3, 0xb9, 0x76, 0xff, 	/*Color of index 149*/
-  0xcb, 0xb3, 0x76, 0xff, 	/*Color of index 150*/
-  0xd4, 0xb8, 0x60, 0xff, 	/*Color of index 151*/
-  0xd0, 0xb4, 0x6a, 0xff, 	/*Color of index 152*/
-  0xcc, 0xb2, 0x64, 0xff, 	/*Color of index 153*/
-  0xd7, 0xb6, 0x51, 0xff, 	/*Color of index 154*/
-  0xd3, 0xb4, 0x59, 0xff, 	/*Color of index 155*/
-  0xce, 0xb0, 0x5b, 0xff, 	/*Color of index 156*/
-  0xd1, 0xb1, 0x53, 0xff, 	/*Color of index 157*/
-  0xc6, 0xb3, 0x4f, 0xff, 	/*Color of index 158*/
-  0xd2, 0xb2, 0x4c, 0xff, 	/*Color of index 159*/
-  0xcc, 0xb0, 0x54, 0xff, 	/*Color of index 160*/
-  0xcd, 0xb4, 0x43, 0xff, 	/*Color of index 161*/
-  0xd1, 0xad, 0x54, 0xff, 	/*Color of index 162*/
-  0xcc, 0xac, 0x58, 0xff, 	/*Color of index 163*/
-  0xac, 0xa1, 0x83, 0xff, 	/*Color of index 164*/
-  0xcc, 0xae, 0x4c, 0xff, 	/*Color of index 165*/
-  0xc4, 0xaa, 0x5c, 0xff, 	/*Color of index 166*/
-  0xcc, 0xab, 0x53, 0xff, 	/*Color of index 167*/
-  0xc8, 0xa7, 0x51, 0xff, 	/*Color of index 168*/
-  0xbe, 0xa3, 0x5a, 0xff, 	/*Color of index 169*/
-  0xb3, 0x9a, 0x54, 0xff, 	/*Color of index 170*/
-  0xa9, 0x91, 0x52, 0xff, 	/*Color of index 171*/
-  0xa2, 0x84, 0x39, 0xff, 	/*Color of index 172*/
-  0x0c, 0x10, 0x00, 0xff, 	/*Color of index 173*/
-  0x12, 0x0f, 0x01, 0xff, 	/*Color of index 174*/
-  0xed, 0xea, 0xe6, 0xff, 	/*Color of index 175*/
-  0xde, 0xd9, 0xd7, 0xff, 	/*Color of index 176*/
-  0xca, 0xc9, 0xc8, 0xff, 	/*Color of index 177*/
-  0xcb, 0xc5, 0xb7, 0xff, 	/*Color of index 178*/
-  0xce, 0xbf, 0x9c, 0xff, 	/*Color of index 179*/
-  0xbb, 0xaa, 0x83, 0xff, 	/*Color of index 180*/
-  0xc8, 0xa9, 0x79, 0xff, 	/*Color of index 181*/
-  0xa5, 0xa0, 0x9b, 0xff, 	/*Color of index 182*/
-  0xc6, 0xaa, 0x6d, 0xff, 	/*Color of index 183*/
-  0xcb, 0xab, 0x62, 0xff, 	/*Color of index 184*/
-  0xd1, 0xaa, 0x5c, 0xff, 	/*Color of index 185*/
-  0xb9, 0xa1, 0x6d, 0xff, 	/*Color of index 186*/
-  0x94, 0x90, 0x8c, 0xff, 	/*Color of index 187*/
-  0xab, 0x95, 0x68, 0xff, 	/*Color of index 188*/
-  0x9d, 0x88, 0x60, 0xff, 	/*Color of index 189*/
-  0x88, 0x7f, 0x6f, 0xff, 	/*Color of index 190*/
-  0x9e, 0x85, 0x50, 0xff, 	/*Color of index 191*/
-  0x92, 0x7c, 0x50, 0xff, 	/*Color of index 192*/
-  0x88, 0x73, 0x4f, 0xff, 	/*Color of index 193*/
-  0x96, 0x75, 0x38, 0xff, 	/*Color of index 194*/
-  0x73, 0x69, 0x55, 0xff, 	/*Color of index 195*/
-  0x87, 0x6b, 0x3e, 0xff, 	/*Color of index 196*/
-  0x95, 0x6f, 0x25, 0xff, 	/*Color of index 197*/
-  0x69, 0x60, 0x5d, 0xff, 	/*Color of index 198*/
-  0x7b, 0x62, 0x38, 0xff, 	/*Color of index 199*/
-  0x8d, 0x62, 0x24, 0xff, 	/*Color of index 200*/
-  0x84, 0x5e, 0x32, 0xff, 	/*Color of index 201*/
-  0x60, 0x57, 0x50, 0xff, 	/*Color of index 202*/
-  0x79, 0x58, 0x34, 0xff, 	/*Color of index 203*/
-  0x87, 0x5a, 0x24, 0xff, 	/*Color of index 204*/
-  0x82, 0x58, 0x29, 0xff, 	/*Color of index 205*/
-  0x64, 0x55, 0x3d, 0xff, 	/*Color of index 206*/
-  0x82, 0x5c, 0x1a, 0xff, 	/*Color of index 207*/
-  0x82, 0x57, 0x25, 0xff, 	/*Color of index 208*/
-  0x85, 0x52, 0x34, 0xff, 	/*Color of index 209*/
-  0x7b, 0x55, 0x2b, 0xff, 	/*Color of index 210*/
-  0x7d, 0x54, 0x23, 0xff, 	/*Color of index 211*/
-  0x6e, 0x51, 0x2c, 0xff, 	/*Color of index 212*/
-  0x7c, 0x50, 0x1b, 0xff, 	/*Color of index 213*/
-  0x63, 0x4a, 0x2a, 0xff, 	/*Color of index 214*/
-  0x48, 0x41, 0x3f, 0xff, 	/*Color of index 215*/
-  0x5d, 0x42, 0x23, 0xff, 	/*Color of index 216*/
-  0x48, 0x3e, 0x2d, 0xff, 	/*Color of index 217*/
-  0x52, 0x3a, 0x1d, 0xff, 	/*Color of index 218*/
-  0x4a, 0x34, 0x18, 0xff, 	/*Color of index 219*/
-  0x39, 0x2d, 0x21, 0xff, 	/*Color of index 220*/
-  0x42, 0x2b, 0x10, 0xff, 	/*Color of index 221*/
-  0x2c, 0x26, 0x23, 0xff, 	/*Color of index 222*/
-  0x38, 0x23, 0x0d, 0xff, 	/*Color of index 223*/
-  0x30, 0x1a, 0x06, 0xff, 	/*Color of index 224*/
-  0x1d, 0x16, 0x10, 0xff, 	/*Color of index 225*/
-  0x29, 0x13, 0x03, 0xff, 	/*Color of index 226*/
-  0x1a, 0x10, 0x02, 0xff, 	/*Color of index 227*/
-  0x15, 0x0e, 0x0a, 0xff, 	/*Color of index 228*/
-  0x1f, 0x0d, 0x01, 0xff, 	/*Color of index 229*/
-  0x0f, 0x0b, 0x03, 0xff, 	/*Color of index 230*/
-  0x19, 0x0a, 0x02, 0xff, 	/*Color of index 231*/
-  0x13, 0x0a, 0x04, 0xff, 	/*Color of index 232*/
-  0x19, 0x05, 0x00, 0xff, 	/*Color of index 233*/
-  0x12, 0x04, 0x01, 0xff, 	/*Color of index 234*/
-  0xb1, 0xae, 0xaf, 0xff, 	/*Color of index 235*/
-  0x81, 0x7c, 0x7e, 0xff, 	/*Color of index 236*/
-  0x77, 0x6e, 0x6d, 0xff, 	/*Color of index 237*/
-  0x52, 0x4c, 0x4d, 0xff, 	/*Color of index 238*/
-  0x39, 0x34, 0x35, 0xff, 	/*Color of index 239*/
-  0x25, 0x1e, 0x1f, 0xff, 	/*Color of index 240*/
-  0x16, 0x0a, 0x09, 0xff, 	/*Color of index 241*/
-  0x13, 0x09, 0x09, 0xff, 	/*Color of index 242*/
-  0x0d, 0x08, 0x0a, 0xff, 	/*Color of index 243*/
-  0x13, 0x06, 0x0b, 0xff, 	/*Color of index 244*/
-  0x19, 0x05, 0x0b, 0xff, 	/*Color of index 245*/
-  0x0b, 0x02, 0x01, 0xff, 	/*Color of index 246*/
-  0x03, 0x00, 0x00, 0xff, 	/*Color of index 247*/
-  0x11, 0x0a, 0x10, 0xff, 	/*Color of index 248*/
-  0x17, 0x08, 0x10, 0xff, 	/*Color of index 249*/
-  0x15, 0x04, 0x10, 0xff, 	/*Color of index 250*/
-  0x0c, 0x03, 0x0a, 0xff, 	/*Color of index 251*/
-  0x4a, 0x3b, 0x55, 0xff, 	/*Color of index 252*/
-  0x2c, 0x22, 0x38, 0xff, 	/*Color of index 253*/
-  0x0a, 0x05, 0x11, 0xff, 	/*Color of index 254*/
-  0x0f, 0x02, 0x19, 0xff, 	/*Color of index 255*/
-
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xe7, 0xf1, 0xae, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf8, 0xf1, 0xf3, 0xf2, 0xe4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xe4, 0xf8, 0xf1, 0xf3, 0xf1, 0xf9, 0xf2, 0xf2, 0xf1, 0xf1, 0xe8, 0xe4, 0xe8, 0xea, 0xe4, 0xf3, 0xe4, 0xf2, 0xe4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xe4, 0xf2, 0xf1, 0xf3, 0xea, 0xf3, 0xf2, 0xe4, 0xf3, 0xe4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf4, 0xe4, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xe4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf8, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xe4, 0xf4, 0xf2, 0xf2, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf8, 0xe8, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xe4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xea, 0xf7, 0xf7, 0xe1, 0xef, 0xca, 0xec, 0xbb, 0xbb, 0xec, 0xee, 0xe1, 0xfb, 0xe4, 0xf6, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf7, 0xe1, 0xdc, 0xd7, 0xee, 0xd7, 0xef, 0xe1, 0xf7, 0xf7, 0xf7, 0xf3, 0xea, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xe4, 0xf7, 0xf7, 0x77, 0xca, 0xb6, 0xb0, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xaf, 0xd7, 0xf6, 0xe4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf7, 0xd7, 0xb6, 0xaf, 0x82, 0x84, 0x84, 0x84, 0x89, 0xaf, 0xeb, 0xed, 0xde, 0xf7, 0xf7, 0xf6, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf1, 0xf6, 0xf7, 0xde, 0xbb, 0xb0, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x83, 0x00, 0x01, 0x07, 0xec, 0x77, 0xf1, 0xf3, 0xe4, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf7, 0xb6, 0x84, 0x82, 0x84, 0x82, 0x84, 0x82, 0x84, 0x82, 0x84, 0x84, 0x82, 0xb1, 0xed, 0xe4, 0xf7, 0xea, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xfb, 0xf3, 0xf7, 0xe1, 0xec, 0xaf, 0x84, 0x84, 0x86, 0x86, 0x84, 0x84, 0x03, 0x06, 0x0d, 0x15, 0x5d, 0x74, 0xf7, 0xfb, 0xf1, 0xf4, 0xf9, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xe8, 0xf4, 0xf9, 0xfa, 0xf9, 0xfd, 0x5d, 0x15, 0x10, 0x09, 0x05, 0x00, 0x84, 0x82, 0x84, 0x82, 0x84, 0x82, 0xb0, 0xc6, 0xf7, 0xf7, 0xf2, 0xe4, 0x85, 0xe4, 0xe6, 0xe4, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf8, 0xf2, 0xfb, 0xf2, 0xe6, 0xf7, 0xfb, 0xed, 0x82, 0x84, 0x84, 0x82, 0x82, 0x00, 0x03, 0x0a, 0x19, 0x44, 0x59, 0x61, 0x76, 0x7b, 0xfe, 0xf3, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xe6, 0xe8, 0x80, 0x70, 0x65, 0x61, 0x61, 0x64, 0x5c, 0x1e, 0x0a, 0x02, 0x83, 0x84, 0x82, 0x82, 0x84, 0xb1, 0xca, 0xf7, 0xf7, 0xf3, 0xe8, 0xe4, 0xe6, 0xf2, 0xe6, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3, 0xe8, 0xf2, 0xe4, 0xea, 0xf7, 0xde, 0x07, 0x82, 0x84, 0x82, 0x84, 0x84, 0x05, 0x0f, 0x45, 0x5b, 0x4f, 0x4f, 0x4c, 0x1c, 0x15, 0x7c, 0xf8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x85, 0xad, 0xad, 0xf6, 0x6c, 0x22, 0x49, 0x5b, 0x5b, 0x50, 0x5b, 0x59, 0x3b, 0x0c, 0x02, 0x83, 0x83, 0x82, 0x84, 0x82, 0xb6, 0xf8, 0xf7, 0xf4, 0xf3, 0xf2, 0xf2, 0xe8, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf8, 0xe8, 0xf2, 0xe4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf8, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf8, 0xf2, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xe8, 0xe8, 0xea, 0xe4, 0xf7, 0xf6, 0xc3, 0x87, 0x84, 0x00, 0x82, 0x83, 0x03, 0x10, 0x51, 0x55, 0x4f, 0x46, 0x53, 0x46, 0x4b, 0x10, 0x0c, 0xfe, 0xfe, 0xf9, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0x85, 0xe4, 0xe6, 0x81, 0x7e, 0x15, 0x0f, 0x1d, 0x3d, 0x53, 0x47, 0x4c, 0x3e, 0x5a, 0x59, 0x10, 0x03, 0x00, 0x82, 0x86, 0x84, 0xaf, 0xee, 0xf7, 0xf6, 0xf2, 0xe8, 0xe8, 0xe8, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf3, 0xe6, 0x85, 0xf7, 0x81, 0xbb, 0x84, 0x86, 0x00, 0x82, 0x01, 0x09, 0x36, 0x54, 0x4b, 0x4c, 0x37, 0x47, 0x4a, 0x43, 0x13, 0x3a, 0x74, 0xf8, 0xfb, 0xfa, 0xe8, 0xf1, 0xe8, 0xe4, 0xe6, 0xe6, 0xe6, 0xf3, 0xf8, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xfe, 0xfe, 0x81, 0xf4, 0x7f, 0x17, 0x08, 0x0f, 0x1d, 0x3e, 0x31, 0x47, 0x4a, 0x53, 0x4f, 0x5b, 0x1e, 0x0a, 0x00, 0x83, 0x82, 0x82, 0x84, 0xec, 0xf6, 0xf6, 0xf4, 0xe8, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf8, 0xf1, 0xf8, 0xf2, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf2, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xe4, 0xe6, 0xf7, 0xe1, 0xeb, 0x84, 0x82, 0x83, 0x83, 0x02, 0x12, 0x51, 0x50, 0x43, 0x4a, 0x3f, 0x30, 0x3f, 0x37, 0x13, 0x0f, 0x74, 0xf7, 0xe6, 0xf5, 0xfa, 0xe4, 0xfb, 0xe8, 0xe4, 0xe8, 0xe8, 0xe4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xfe, 0xfa, 0xf4, 0xf4, 0xea, 0x81, 0x7c, 0x5f, 0x1e, 0x28, 0x3e, 0x3f, 0x4a, 0x53, 0x53, 0x43, 0x54, 0x61, 0x12, 0x05, 0x84, 0x00, 0x84, 0x84, 0xeb, 0xe8, 0xf7, 0xf2, 0xf9, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xe6, 0xf6, 0x85, 0x77, 0xb1, 0x84, 0x00, 0x00, 0x00, 0x06, 0x2a, 0x5a, 0x43, 0x43, 0x34, 0x41, 0x41, 0x53, 0x38, 0x43, 0x12, 0x62, 0x81, 0xe4, 0xe5, 0xf5, 0xfb, 0xf8, 0xfb, 0xe4, 0xf6, 0xe4, 0xe6, 0xf1, 0xf2, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xe8, 0xe4, 0xe4, 0xe7, 0xe9, 0xfb, 0x7e, 0x62, 0x0f, 0x18, 0x4d, 0x4c, 0x4f, 0x41, 0x4f, 0x3e, 0x47, 0x5b, 0x36, 0x09, 0x01, 0x01, 0x82, 0x84, 0x07, 0xf0, 0xfb, 0xfa, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xfb, 0xf1, 0xe4, 0xf7, 0xe1, 0xb1, 0x84, 0x00, 0x00, 0x00, 0x08, 0x51, 0x50, 0x46, 0x38, 0x3d, 0x37, 0x40, 0x4a, 0x53, 0x40, 0x27, 0x76, 0x7b, 0xfa, 0xea, 0xe8, 0xe9, 0xfd, 0xf8, 0xfe, 0xf3, 0xf3, 0xe4, 0xe6, 0xf1, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xae, 0xea, 0xf3, 0xf7, 0xe4, 0xe5, 0xea, 0x80, 0x11, 0x03, 0x08, 0x18, 0x4b, 0x41, 0x53, 0x53, 0x53, 0x47, 0x53, 0x5a, 0x58, 0x0d, 0x01, 0x01, 0x83, 0x84, 0x8e, 0xf8, 0xf7, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xe4, 0xf6, 0xf6, 0xe1, 0xb0, 0x84, 0x00, 0x00, 0x01, 0x0d, 0x5a, 0x50, 0x3d, 0x4a, 0x4a, 0x4a, 0x41, 0x3d, 0x40, 0x32, 0x18, 0x0f, 0x75, 0xfe, 0xf3, 0xe4, 0xf2, 0x81, 0xed, 0x17, 0x7f, 0xf8, 0xf3, 0xe6, 0xf1, 0xe7, 0xf9, 0xf5, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfb, 0xfe, 0x0b, 0x7d, 0x81, 0xe9, 0xe3, 0xf7, 0x17, 0x06, 0x05, 0x13, 0x49, 0x53, 0x53, 0x4a, 0x4a, 0x4f, 0x4f, 0x53, 0x53, 0x5a, 0x19, 0x02, 0x83, 0x89, 0x84, 0x8e, 0xde, 0xf7, 0xf2, 0xf3, 0xf4, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf4, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf4, 0xf1, 0xf4, 0xe6, 0xf6, 0xb1, 0x84, 0x00, 0x83, 0x00, 0x11, 0x51, 0x4f, 0x41, 0x46, 0x40, 0x41, 0x4a, 0x40, 0x32, 0x2c, 0x21, 0x1e, 0x14, 0x77, 0xf3, 0xae, 0xf2, 0xfe, 0xfe, 0x17, 0x0c, 0x77, 0x80, 0xe4, 0xf3, 0xe8, 0xf1, 0xf1, 0xf5, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0x80, 0x63, 0x03, 0x72, 0x7f, 0xf4, 0xe8, 0x85, 0x81, 0x74, 0x6c, 0x16, 0x39, 0x40, 0x53, 0x4a, 0x4a, 0x4f, 0x53, 0x46, 0x53, 0x4f, 0x59, 0x19, 0x03, 0x82, 0xaf, 0x84, 0x07, 0xf8, 0xf7, 0xf1, 0xf3, 0xf2, 0xe8, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xe8, 0xf3, 0xf2, 0xf1, 0xf5, 0xf5, 0xf5, 0xf1, 0xf9, 0xf3, 0xf3, 0x85, 0xeb, 0x84, 0x83, 0x83, 0x01, 0x12, 0x5b, 0x47, 0x41, 0x53, 0x53, 0x40, 0x43, 0x38, 0x40, 0x3e, 0x16, 0x3a, 0x7e, 0x7e, 0x81, 0x81, 0xf1, 0xf4, 0xff, 0x81, 0x14, 0x0a, 0x6c, 0x85, 0xe3, 0xf2, 0xf2, 0xe8, 0xe6, 0xf4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xe8, 0xf2, 0xf3, 0xf8, 0xfb, 0xff, 0x14, 0x06, 0x52, 0x81, 0xff, 0xf3, 0xad, 0x85, 0x80, 0x81, 0x71, 0x18, 0x5b, 0x4a, 0x4a, 0x46, 0x46, 0x46, 0x53, 0x46, 0x53, 0x53, 0x5b, 0x42, 0x05, 0x83, 0x00, 0x84, 0xeb, 0x81, 0x81, 0xf8, 0xf2, 0xae, 0xae, 0xe4, 0xf4, 0xf9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xf1, 0xf5, 0xf2, 0xfb, 0xf9, 0xf7, 0xec, 0x86, 0x82, 0x00, 0x01, 0x12, 0x59, 0x43, 0x3f, 0x41, 0x4a, 0x4a, 0x3d, 0x3f, 0x40, 0x46, 0x35, 0x08, 0x17, 0x7f, 0x80, 0xfe, 0xe4, 0xe6, 0xe4, 0x81, 0xff, 0x24, 0x0d, 0x67, 0x85, 0xf3, 0xe4, 0xf4, 0xe6, 0xe4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf9, 0xf1, 0xe8, 0xe4, 0xf2, 0xe6, 0xf2, 0xf3, 0xfb, 0x78, 0x14, 0x14, 0x74, 0x81, 0xf9, 0xf2, 0xad, 0xad, 0xfe, 0xf7, 0x63, 0x08, 0x0f, 0x4c, 0x37, 0x43, 0x3f, 0x47, 0x40, 0x4a, 0x4a, 0x4f, 0x4c, 0x54, 0x29, 0x06, 0x00, 0x83, 0x84, 0xec, 0xf7, 0xf7, 0xe4, 0xe6, 0xe5, 0xe8, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xe6, 0xf2, 0xf2, 0xf2, 0xf1, 0xfb, 0xf1, 0xf9, 0xf8, 0xf7, 0xd7, 0x84, 0x82, 0x83, 0x00, 0x0d, 0x5b, 0x46, 0x30, 0x4c, 0x40, 0x4a, 0x41, 0x34, 0x41, 0x38, 0x50, 0x0f, 0x01, 0x04, 0xff, 0x7f, 0xff, 0xf3, 0xe3, 0x85, 0xfd, 0x7e, 0x22, 0x12, 0x3a, 0x80, 0xe8, 0xf9, 0xf1, 0xe6, 0xe6, 0xf9, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xe8, 0xf1, 0xe6, 0xf2, 0xf2, 0xf3, 0xfb, 0x74, 0x11, 0x3b, 0x7b, 0xe8, 0xe5, 0xe7, 0x85, 0xe4, 0xf6, 0x81, 0x07, 0x01, 0x05, 0x28, 0x3c, 0x40, 0x43, 0x3f, 0x3f, 0x4a, 0x3e, 0x3e, 0x47, 0x46, 0x5b, 0x51, 0x03, 0x83, 0xaf, 0x84, 0xee, 0xf7, 0xe8, 0xe8, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf8, 0xf2, 0xf3, 0xf9, 0xf2, 0xf3, 0xf9, 0xf2, 0xf8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf1, 0xf9, 0xf2, 0xf6, 0xf0, 0xb1, 0x82, 0x00, 0x83, 0x0a, 0x51, 0x53, 0x46, 0x47, 0x34, 0x46, 0x41, 0x37, 0x30, 0x34, 0x3f, 0x45, 0x15, 0xeb, 0xec, 0xf3, 0x7f, 0xfe, 0xf6, 0xe3, 0xf6, 0x0b, 0x06, 0x19, 0x18, 0x24, 0x80, 0xf8, 0xf4, 0xf1, 0xf1, 0xe6, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf9, 0xf1, 0xf1, 0xf1, 0xe4, 0xf3, 0xf2, 0xf3, 0xfb, 0x71, 0x0f, 0x36, 0x76, 0xf7, 0xe3, 0xe7, 0xe4, 0xad, 0xf4, 0x81, 0x0b, 0x06, 0x14, 0x36, 0x3c, 0x46, 0x4a, 0x41, 0x4a, 0x47, 0x37, 0x3e, 0x41, 0x46, 0x53, 0x50, 0x22, 0x03, 0x82, 0x83, 0x89, 0xe1, 0xea, 0xf2, 0xf1, 0xf2, 0xe8, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf8, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf8, 0xf7, 0xb6, 0x84, 0x83, 0x83, 0x05, 0x42, 0x50, 0x40, 0x4a, 0x41, 0x53, 0x46, 0x3d, 0x30, 0x30, 0x30, 0x50, 0x26, 0x75, 0x80, 0xf7, 0xf6, 0xff, 0x80, 0xf1, 0x85, 0xde, 0x02, 0x08, 0x27, 0x18, 0x22, 0x7f, 0xf8, 0xf4, 0xf2, 0xe6, 0xe6, 0xf9, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf4, 0xf2, 0xf1, 0xe6, 0xf1, 0xe8, 0xf1, 0xf3, 0xf9, 0xf7, 0x67, 0x16, 0x1f, 0x2d, 0xee, 0xe7, 0xe8, 0x85, 0xe1, 0xf9, 0xff, 0x80, 0x81, 0x7e, 0x4e, 0x2b, 0x53, 0x53, 0x40, 0x4a, 0x40, 0x3f, 0x3e, 0x41, 0x53, 0x53, 0x4f, 0x51, 0x19, 0x01, 0x00, 0x82, 0xeb, 0xf7, 0xf2, 0xf4, 0xf4, 0xe8, 0xe4, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf8, 0xf2, 0xf8, 0xf2, 0xf2, 0xf3, 0xf8, 0xf2, 0xf8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf2, 0xfb, 0xf7, 0xef, 0x82, 0x83, 0x83, 0x03, 0x29, 0x5b, 0x37, 0x3e, 0x30, 0x53, 0x53, 0x46, 0x3f, 0x31, 0x37, 0x2c, 0x0a, 0x15, 0x80, 0xf7, 0x85, 0xe8, 0xfb, 0xfa, 0xf2, 0x85, 0x81, 0x0e, 0x12, 0x3c, 0x1d, 0x22, 0x7f, 0xfe, 0xf4, 0xf1, 0xe6, 0xae, 0xf4, 0xf8, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf9, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xf3, 0x81, 0x6c, 0x0f, 0x3e, 0x1c, 0x03, 0xf8, 0x81, 0xe4, 0x85, 0xf1, 0xfa, 0xf6, 0xe6, 0xf7, 0x3a, 0x0a, 0x23, 0x38, 0x47, 0x41, 0x4a, 0x41, 0x41, 0x47, 0x41, 0x4a, 0x47, 0x3f, 0x49, 0x10, 0x01, 0x00, 0x82, 0xc6, 0xf7, 0xf4, 0xf8, 0xe4, 0xe6, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf9, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xe8, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xfb, 0xf7, 0xeb, 0x84, 0x00, 0x00, 0x10, 0x5a, 0x40, 0x34, 0x39, 0x31, 0x4a, 0x53, 0x46, 0x34, 0x37, 0x3e, 0x1d, 0x05, 0x02, 0x77, 0xf6, 0xe6, 0xea, 0xfb, 0xf3, 0xf4, 0x81, 0x7e, 0x4e, 0x27, 0x23, 0x1d, 0x22, 0x7e, 0xfe, 0xf2, 0xf1, 0xae, 0xf1, 0xf3, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xe6, 0xf1, 0xf1, 0xe6, 0xf8, 0xf3, 0xf6, 0x67, 0x13, 0x3e, 0x49, 0x24, 0x6a, 0xfd, 0x85, 0xe3, 0xf1, 0xf8, 0xe3, 0xad, 0x85, 0x07, 0x00, 0x21, 0x39, 0x37, 0x3d, 0x40, 0x4a, 0x41, 0x41, 0x3f, 0x37, 0x3f, 0x40, 0x53, 0x58, 0x09, 0x01, 0x83, 0xaf, 0xf7, 0xf4, 0xf4, 0xe8, 0xe4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf9, 0xf1, 0xf2, 0xf2, 0xf2, 0xf9, 0xf1, 0xf9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf4, 0xf4, 0xf7, 0xee, 0x82, 0x00, 0x83, 0x0c, 0x59, 0x43, 0x4a, 0x41, 0x31, 0x37, 0x46, 0x46, 0x41, 0x34, 0x37, 0x3e, 0x18, 0x02, 0x04, 0xe4, 0x81, 0xfb, 0xf3, 0xf3, 0xf3, 0xf7, 0x17, 0x05, 0x16, 0x2c, 0x34, 0x23, 0x19, 0x7f, 0xfe, 0xf2, 0xe7, 0xae, 0xe6, 0xf9, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf9, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xf3, 0x81, 0x67, 0x0f, 0x4c, 0x3e, 0x1c, 0x05, 0x0e, 0xf7, 0xad, 0xf5, 0xf2, 0xae, 0xe3, 0xe6, 0xb1, 0x83, 0x12, 0x49, 0x2f, 0x46, 0x3d, 0x40, 0x4a, 0x40, 0x47, 0x34, 0x40, 0x4a, 0x46, 0x50, 0x36, 0x03, 0x01, 0x84, 0xed, 0xf7, 0xf8, 0xf8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf9, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf7, 0xeb, 0x84, 0x83, 0x02, 0x36, 0x4b, 0x46, 0x41, 0x41, 0x41, 0x38, 0x43, 0x40, 0x41, 0x3d, 0x3f, 0x2f, 0x21, 0x14, 0xef, 0xf7, 0xfa, 0xff, 0xfb, 0x85, 0x85, 0x81, 0x04, 0x09, 0x45, 0x30, 0x34, 0x23, 0x22, 0x7e, 0xfb, 0xe4, 0xe7, 0xae, 0xe6, 0xfe, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf1, 0xe8, 0xf2, 0xe4, 0xf2, 0xf8, 0xf7, 0x62, 0x12, 0x4c, 0x30, 0x2b, 0x1e, 0x7a, 0x85, 0xe6, 0xfa, 0xfe, 0xf9, 0xe7, 0xea, 0xde, 0x5d, 0x22, 0x25, 0x46, 0x38, 0x3d, 0x40, 0x3d, 0x41, 0x40, 0x4a, 0x40, 0x43, 0x3f, 0x43, 0x49, 0x15, 0x00, 0x82, 0x8e, 0xf8, 0xfb, 0xf8, 0xea, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xfa, 0xf9, 0xae, 0xae, 0xf4, 0x81, 0xd7, 0x84, 0x83, 0x01, 0x12, 0x5a, 0x2e, 0x4a, 0x41, 0x40, 0x40, 0x40, 0x38, 0x3f, 0x3d, 0x40, 0x32, 0x2c, 0x2d, 0x81, 0xf7, 0x85, 0xff, 0xfe, 0xfb, 0xe4, 0x81, 0x7e, 0x15, 0x51, 0x2c, 0x32, 0x34, 0x23, 0x19, 0x7f, 0xf8, 0xf4, 0xf1, 0xe6, 0xe4, 0xf4, 0xf1, 0xe7, 0xe6, 0xe4, 0xf3, 0xf9, 0xfa, 0xfa, 0xf5, 0xf4, 0xff, 0xfa, 0xad, 0xe6, 0xfe, 0xfa, 0xae, 0xe5, 0xf2, 0xf5, 0xe6, 0xf4, 0xfa, 0xe6, 0xae, 0xf2, 0xf9, 0xe6, 0xe8, 0xfa, 0xfa, 0xe8, 0xae, 0xe7, 0xfa, 0xff, 0xfa, 0xf1, 0xae, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0x6a, 0x0f, 0x3c, 0x41, 0x32, 0x1d, 0x0a, 0x74, 0x81, 0xe3, 0xf1, 0xf1, 0xe9, 0xe5, 0x81, 0x7f, 0x5f, 0x1f, 0x4a, 0x40, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x43, 0x40, 0x2f, 0x59, 0x09, 0x83, 0x84, 0xed, 0xf7, 0xe4, 0xe4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xff, 0xf9, 0xad, 0xad, 0xf4, 0x81, 0xb6, 0x84, 0x83, 0x06, 0x49, 0x3e, 0x3e, 0x32, 0x4a, 0x40, 0x3d, 0x3d, 0x34, 0x3d, 0x3d, 0x3d, 0x3d, 0x25, 0x33, 0x7d, 0x85, 0xe6, 0xfb, 0xf3, 0xe6, 0xf7, 0x80, 0x67, 0x21, 0x39, 0x34, 0x3d, 0x32, 0x31, 0x22, 0x7f, 0xf8, 0xf4, 0xf9, 0xe6, 0xe8, 0xf1, 0xf5, 0xe4, 0xe6, 0xad, 0xf2, 0xfa, 0xfa, 0xf5, 0xf2, 0xf2, 0xfa, 0xfe, 0xad, 0xad, 0xfe, 0xff, 0xad, 0xea, 0xf9, 0xf2, 0xe7, 0xf5, 0xff, 0xae, 0xad, 0xfe, 0xff, 0xe8, 0xe8, 0xfa, 0xf4, 0xe7, 0xae, 0xe7, 0xf9, 0xfa, 0xfa, 0xe8, 0xe7, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0x71, 0x0d, 0x50, 0x40, 0x3f, 0x25, 0x0f, 0x24, 0x7f, 0xf3, 0xf1, 0xf1, 0xe5, 0xe3, 0xf1, 0x7f, 0x56, 0x13, 0x31, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x47, 0x40, 0x4d, 0x19, 0x03, 0x82, 0xb0, 0x81, 0xf7, 0xe4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xe4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xfa, 0xf1, 0xae, 0xe6, 0xf7, 0xf0, 0x89, 0x82, 0x01, 0x19, 0x49, 0x30, 0x4c, 0x3d, 0x32, 0x40, 0x3d, 0x3d, 0x32, 0x3d, 0x41, 0x34, 0x34, 0x2f, 0x16, 0x79, 0x81, 0xe6, 0xf6, 0xe6, 0xf7, 0xf0, 0x0e, 0x0e, 0x27, 0x31, 0x3d, 0x34, 0x32, 0x23, 0x22, 0x7f, 0xf8, 0xf5, 0xf4, 0xe4, 0xe6, 0xf1, 0xf5, 0xf1, 0xe6, 0xe4, 0xe6, 0xf1, 0xe9, 0xe7, 0xe7, 0xae, 0xf2, 0xf4, 0xae, 0xae, 0xfe, 0xfe, 0x81, 0xff, 0x80, 0xf2, 0xe8, 0xf2, 0xfa, 0xe8, 0xad, 0x7f, 0x74, 0xfb, 0xf3, 0xe7, 0xe8, 0xe8, 0xf2, 0xe6, 0xe6, 0xe8, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf6, 0x72, 0x0d, 0x3c, 0x46, 0x41, 0x25, 0x13, 0x12, 0x6c, 0x7f, 0x81, 0xf7, 0xe3, 0xe8, 0xf3, 0x80, 0x0b, 0x05, 0x18, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x41, 0x4a, 0x2f, 0x59, 0x0d, 0x83, 0x82, 0xd7, 0xf7, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf7, 0xed, 0x84, 0x00, 0x06, 0x51, 0x2c, 0x32, 0x2e, 0x47, 0x3d, 0x3d, 0x3d, 0x34, 0x37, 0x3d, 0x41, 0x30, 0x18, 0x1d, 0x0f, 0x75, 0x81, 0x85, 0xad, 0xe7, 0xde, 0xaf, 0x83, 0x16, 0x39, 0x34, 0x34, 0x3f, 0x34, 0x23, 0x4e, 0x7e, 0xfa, 0xf4, 0xf4, 0xe4, 0xe6, 0xf1, 0xf5, 0xf9, 0xf3, 0xe6, 0xe6, 0xe7, 0xe7, 0xae, 0xe6, 0xad, 0xe5, 0xf2, 0xe7, 0xe6, 0xf3, 0x80, 0x72, 0x3a, 0x7d, 0xfe, 0xe8, 0xe7, 0xff, 0xe6, 0x81, 0x6a, 0x14, 0x74, 0xfe, 0xae, 0xae, 0xe8, 0xf3, 0xf2, 0x85, 0xae, 0xe6, 0xf5, 0xfa, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0x78, 0x0a, 0x2b, 0x40, 0x41, 0x30, 0x18, 0x13, 0x0f, 0x1a, 0x14, 0x72, 0x85, 0xe4, 0xf6, 0x81, 0x0b, 0x01, 0x0f, 0x4c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x4a, 0x40, 0x3c, 0x45, 0x03, 0x84, 0xb6, 0xf6, 0xfa, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf2, 0xe4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xe5, 0xe8, 0xfb, 0xfe, 0x85, 0xb2, 0x84, 0x01, 0x15, 0x50, 0x2e, 0x47, 0x32, 0x40, 0x32, 0x34, 0x3d, 0x34, 0x37, 0x32, 0x4a, 0x1d, 0x0f, 0x0a, 0x10, 0x7f, 0xfe, 0xe6, 0x85, 0xf7, 0xec, 0x84, 0x08, 0x36, 0x2e, 0x41, 0x41, 0x2e, 0x2e, 0x1d, 0x5e, 0x7f, 0xf4, 0xf9, 0xf3, 0xe6, 0xae, 0xe7, 0xf1, 0xf1, 0xf2, 0xe4, 0xf2, 0xe6, 0xe7, 0xf4, 0x81, 0x81, 0xae, 0xf2, 0xe7, 0xe8, 0xf2, 0x81, 0x71, 0x15, 0x71, 0x80, 0xe8, 0xe7, 0xfa, 0xf3, 0x81, 0x62, 0x15, 0x7d, 0x80, 0xf2, 0xae, 0xae, 0xf3, 0xfe, 0x81, 0xf6, 0xe6, 0xfa, 0xfa, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xfb, 0x77, 0x0a, 0x35, 0x32, 0x41, 0x30, 0x23, 0x2f, 0x1d, 0x13, 0x0d, 0x77, 0xe4, 0x85, 0xf8, 0xf6, 0xd9, 0xeb, 0x0a, 0x25, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x41, 0x41, 0x3d, 0x46, 0x5b, 0x0d, 0x82, 0xaf, 0x77, 0xfb, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xe3, 0xae, 0xff, 0x81, 0xef, 0x87, 0x82, 0x06, 0x51, 0x38, 0x32, 0x32, 0x34, 0x34, 0x32, 0x34, 0x3d, 0x37, 0x34, 0x40, 0x32, 0x29, 0x1a, 0x52, 0x7d, 0xf3, 0xe6, 0xe6, 0xea, 0x81, 0xfd, 0x06, 0x2d, 0x39, 0x3d, 0x40, 0x3d, 0x2e, 0x3f, 0x1d, 0x66, 0x7f, 0xe4, 0xf9, 0xf4, 0xe4, 0xe6, 0xe7, 0xe7, 0xe8, 0xe4, 0xf3, 0xf1, 0xf2, 0xfa, 0xff, 0x6a, 0x74, 0xfb, 0xfb, 0xf1, 0xf2, 0xf3, 0xfb, 0x78, 0x19, 0x6b, 0x7e, 0xe8, 0xe7, 0xf5, 0xf3, 0x7f, 0x56, 0x1a, 0x7c, 0x7f, 0xff, 0xea, 0xad, 0x81, 0x7e, 0x71, 0x6a, 0x80, 0xf9, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0x7f, 0x0e, 0x18, 0x37, 0x34, 0x34, 0x34, 0x3d, 0x40, 0x25, 0x61, 0x7c, 0xfe, 0xf3, 0xf5, 0xe6, 0x85, 0x80, 0x6e, 0x54, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x34, 0x3f, 0x41, 0x46, 0x46, 0x29, 0x03, 0x84, 0xc6, 0xf7, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xe6, 0xe4, 0xfa, 0xf7, 0xc3, 0x84, 0x00, 0x10, 0x45, 0x40, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x34, 0x34, 0x32, 0x46, 0x32, 0x36, 0x73, 0x7e, 0x80, 0x85, 0xae, 0xf6, 0x7f, 0x7d, 0x79, 0x4e, 0x28, 0x2c, 0x3d, 0x40, 0x3d, 0x34, 0x2c, 0x1f, 0x6b, 0x81, 0xf1, 0xf1, 0xf3, 0xe6, 0xae, 0xf1, 0xe5, 0xae, 0xf2, 0xf3, 0xf2, 0xfb, 0xf9, 0x7e, 0x3a, 0x3a, 0x7e, 0x80, 0xe8, 0xf1, 0xf5, 0xf6, 0x7b, 0x26, 0x5f, 0x7c, 0xe8, 0xe7, 0xf5, 0xf3, 0x7f, 0x3b, 0x19, 0x7c, 0x80, 0xff, 0xf3, 0xad, 0xfe, 0x7b, 0x1a, 0x3a, 0x80, 0xfb, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf7, 0x14, 0x0f, 0x50, 0x30, 0x34, 0x3d, 0x40, 0x40, 0x32, 0x20, 0x66, 0x7d, 0x80, 0xfa, 0xfb, 0xe1, 0x7f, 0x6d, 0x55, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x37, 0x37, 0x3d, 0x4a, 0x40, 0x51, 0x0c, 0x84, 0xbb, 0xf7, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe8, 0xe7, 0xe4, 0x80, 0xf7, 0xeb, 0x84, 0x03, 0x33, 0x2f, 0x41, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x34, 0x38, 0x3f, 0x27, 0x2d, 0x76, 0x7e, 0x81, 0x85, 0x7f, 0x7a, 0x65, 0x21, 0x28, 0x2c, 0x3f, 0x38, 0x40, 0x3d, 0x34, 0x2c, 0x1c, 0x75, 0x81, 0xe5, 0xf1, 0xf3, 0xe4, 0xe8, 0xe7, 0xe7, 0xe7, 0xf3, 0xf8, 0xf2, 0xe8, 0xf9, 0x7f, 0x62, 0x15, 0x6f, 0x80, 0xf3, 0xfb, 0xf4, 0xe6, 0x7d, 0x3b, 0x2d, 0x7b, 0xfb, 0xe7, 0xe7, 0xf3, 0x7e, 0x2d, 0x22, 0x7d, 0xf4, 0xff, 0xe4, 0x85, 0x7e, 0x69, 0x15, 0x71, 0x81, 0xe4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf7, 0x52, 0x0a, 0x4d, 0x23, 0x34, 0x32, 0x46, 0x3d, 0x3d, 0x2e, 0x18, 0x56, 0x7b, 0x7e, 0xff, 0x7f, 0x79, 0x35, 0x23, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x37, 0x34, 0x41, 0x4a, 0x3d, 0x49, 0x29, 0x02, 0xb1, 0xe4, 0xea, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe3, 0xf4, 0xfb, 0xf3, 0x8e, 0x83, 0x09, 0x54, 0x2e, 0x41, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x3d, 0x2c, 0x25, 0x33, 0x6f, 0x7f, 0x7f, 0x7c, 0x5e, 0x20, 0x39, 0x30, 0x30, 0x41, 0x3d, 0x38, 0x43, 0x34, 0x2c, 0x26, 0x7a, 0xf3, 0xe3, 0xe7, 0xf2, 0xe6, 0xae, 0xf1, 0xe7, 0xf1, 0xf9, 0xfe, 0xe8, 0xe6, 0xe8, 0x7f, 0x7b, 0x1a, 0x48, 0x7e, 0x85, 0xfb, 0xfa, 0xae, 0xfe, 0x5c, 0x1e, 0x7a, 0xfe, 0xe5, 0xe9, 0xf3, 0x7d, 0x22, 0x2d, 0x7e, 0xea, 0xf2, 0x85, 0x85, 0x7b, 0x1e, 0x57, 0x7b, 0x85, 0xae, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x85, 0x77, 0x05, 0x27, 0x2c, 0x32, 0x32, 0x40, 0x32, 0x32, 0x41, 0x3e, 0x16, 0x6b, 0x7e, 0x7e, 0x73, 0x48, 0x2f, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x37, 0x40, 0x41, 0x41, 0x34, 0x2e, 0x54, 0x09, 0x83, 0xde, 0xf7, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe4, 0xf2, 0xfe, 0xe1, 0x86, 0x00, 0x10, 0x55, 0x32, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x40, 0x32, 0x41, 0x40, 0x38, 0x2f, 0x35, 0x69, 0x7a, 0x5f, 0x1c, 0x3e, 0x34, 0x41, 0x41, 0x32, 0x43, 0x43, 0x3d, 0x3f, 0x23, 0x3b, 0x7c, 0xe6, 0xe3, 0xe8, 0xf3, 0xe4, 0xe6, 0xf1, 0xf1, 0xf2, 0xf3, 0xf8, 0xe6, 0xe7, 0xe6, 0xfe, 0x7f, 0x5f, 0x26, 0x6c, 0x81, 0xf9, 0xfa, 0x85, 0xfe, 0x65, 0x16, 0x70, 0x81, 0xe7, 0xe7, 0x85, 0x7c, 0x1e, 0x42, 0x80, 0xe8, 0xe5, 0x85, 0x81, 0x6b, 0x16, 0x66, 0x7f, 0x85, 0xe8, 0xf1, 0xf3, 0xf1, 0xe8, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xad, 0x81, 0x05, 0x13, 0x3c, 0x32, 0x32, 0x32, 0x32, 0x34, 0x41, 0x3d, 0x2b, 0x48, 0x69, 0x66, 0x29, 0x20, 0x3d, 0x3d, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x46, 0x41, 0x41, 0x34, 0x3f, 0x4b, 0x12, 0x83, 0xc6, 0xf7, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe6, 0xf1, 0xf6, 0xd9, 0x84, 0x03, 0x27, 0x43, 0x2e, 0x3f, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x2f, 0x23, 0x23, 0x23, 0x2c, 0x31, 0x3f, 0x40, 0x3f, 0x39, 0x3e, 0x2e, 0x4a, 0x2e, 0x1b, 0x62, 0x7e, 0xf8, 0xe8, 0xe4, 0xf9, 0xf9, 0xf2, 0xae, 0xfe, 0xfe, 0x85, 0x85, 0xf3, 0xfa, 0xf5, 0xf9, 0x81, 0x74, 0x44, 0x4e, 0x7d, 0x7e, 0xff, 0xe5, 0x85, 0x6b, 0x13, 0x6b, 0x80, 0xf5, 0xe5, 0xfb, 0x7a, 0x16, 0x57, 0x80, 0xea, 0xff, 0xad, 0x81, 0x3b, 0x16, 0x7d, 0x81, 0xfe, 0xf5, 0xf5, 0xf3, 0x85, 0xf6, 0xad, 0xe8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf7, 0x0e, 0x08, 0x55, 0x2e, 0x30, 0x31, 0x2e, 0x40, 0x3d, 0x32, 0x32, 0x2e, 0x23, 0x2e, 0x2e, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x34, 0x40, 0x41, 0x3d, 0x38, 0x2a, 0x02, 0xbb, 0xf7, 0xe4, 0xf4, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xe3, 0xf5, 0x81, 0xc3, 0x84, 0x05, 0x54, 0x43, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x40, 0x32, 0x3d, 0x32, 0x34, 0x2e, 0x37, 0x2e, 0x31, 0x34, 0x38, 0x3f, 0x2c, 0x2c, 0x47, 0x32, 0x4b, 0x1b, 0x71, 0x7f, 0xf8, 0xae, 0xe5, 0xf9, 0xfa, 0xf2, 0xe6, 0xe4, 0x63, 0x6a, 0x7d, 0x81, 0xe6, 0xf5, 0xfa, 0xf8, 0x7f, 0x57, 0x29, 0x6c, 0x7f, 0xfa, 0xf1, 0x85, 0x73, 0x13, 0x60, 0x80, 0xf5, 0xe7, 0x81, 0x79, 0x16, 0x5e, 0x81, 0xf2, 0xfa, 0x85, 0x74, 0x26, 0x48, 0x7f, 0xfe, 0x85, 0xe9, 0xfa, 0x80, 0x72, 0x77, 0xf3, 0xe8, 0xf4, 0xf4, 0xf4, 0xe8, 0xf8, 0xf6, 0x52, 0x03, 0x35, 0x32, 0x30, 0x30, 0x2e, 0x38, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x40, 0x3f, 0x37, 0x40, 0x41, 0x3d, 0x40, 0x45, 0x05, 0x07, 0xf7, 0xf3, 0xf4, 0xf2, 0xf9, 0xf1, 0xf1, 0xf2, 0xe6, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe8, 0xf9, 0xf7, 0xbb, 0x84, 0x0a, 0x5a, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x2e, 0x2e, 0x2e, 0x2e, 0x3e, 0x3d, 0x4a, 0x32, 0x3e, 0x30, 0x41, 0x3d, 0x2c, 0x2d, 0x7c, 0xff, 0xe6, 0xe6, 0xe7, 0xf9, 0xf9, 0xf4, 0xae, 0x81, 0x63, 0x12, 0x3b, 0x7c, 0x85, 0xae, 0xfb, 0xfb, 0x80, 0x75, 0x1e, 0x3b, 0x7d, 0xff, 0xf9, 0xf3, 0x75, 0x18, 0x4e, 0x7e, 0xf5, 0xe5, 0xfb, 0x75, 0x16, 0x60, 0xf7, 0xf2, 0xfa, 0x80, 0x60, 0x1b, 0x6f, 0x81, 0x80, 0xad, 0x85, 0x7f, 0x67, 0x0e, 0x72, 0x81, 0xf3, 0xf2, 0xf2, 0xf2, 0xe8, 0xfb, 0xf8, 0x77, 0x04, 0x12, 0x3f, 0x34, 0x34, 0x34, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x2e, 0x37, 0x40, 0x41, 0x3d, 0x40, 0x55, 0x0a, 0xb0, 0xf3, 0xfb, 0xf3, 0xf2, 0xf1, 0xf9, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xe4, 0xf2, 0xe8, 0xf8, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf9, 0x81, 0xb6, 0x00, 0x10, 0x50, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0x37, 0x32, 0x2e, 0x30, 0x3d, 0x40, 0x40, 0x37, 0x34, 0x3d, 0x47, 0x27, 0x5e, 0x7f, 0x77, 0xe6, 0xe6, 0xe3, 0xf1, 0xf9, 0xf2, 0xe6, 0x80, 0x7d, 0x57, 0x16, 0x5f, 0x7d, 0xf6, 0xe3, 0xf1, 0xfa, 0x7d, 0x57, 0x22, 0x70, 0x80, 0xf5, 0xfb, 0x78, 0x21, 0x29, 0x7c, 0xfa, 0xf9, 0x81, 0x6f, 0x16, 0x68, 0x81, 0xf2, 0xf6, 0x7c, 0x36, 0x33, 0x7b, 0xe9, 0xfb, 0xad, 0x81, 0x71, 0x15, 0x5d, 0x7f, 0xf8, 0x85, 0xf2, 0xe8, 0xe8, 0xe8, 0xf9, 0xfb, 0xf6, 0x0e, 0x08, 0x49, 0x32, 0x41, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x34, 0x3d, 0x37, 0x37, 0x40, 0x41, 0x34, 0x38, 0x55, 0x0d, 0x02, 0x77, 0xf6, 0xf8, 0xf4, 0xf9, 0xf2, 0xf1, 0xf2, 0xe6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfa, 0xf6, 0xeb, 0x01, 0x26, 0x37, 0x32, 0x40, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x37, 0x37, 0x3d, 0x46, 0x3d, 0x34, 0x47, 0x41, 0x3c, 0x1c, 0x70, 0xff, 0xf3, 0xe8, 0xe3, 0xe6, 0xf1, 0xf4, 0xf2, 0xf2, 0xff, 0x7f, 0x7d, 0x56, 0x13, 0x5c, 0x7f, 0xad, 0xae, 0xff, 0xfa, 0x6f, 0x19, 0x4e, 0x7d, 0xf9, 0xfb, 0x7b, 0x28, 0x19, 0x79, 0xff, 0xf5, 0x7f, 0x6b, 0x16, 0x6e, 0x81, 0xf3, 0x81, 0x69, 0x18, 0x5e, 0x80, 0xe5, 0xea, 0x7f, 0x75, 0x15, 0x3a, 0x7c, 0xf8, 0xfe, 0xae, 0xe6, 0xe8, 0xf2, 0xf1, 0xfa, 0xf9, 0xf6, 0xef, 0x02, 0x21, 0x43, 0x32, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x34, 0x37, 0x37, 0x40, 0x41, 0x34, 0x32, 0x50, 0x16, 0x02, 0xde, 0xf7, 0xe4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0x07, 0x03, 0x28, 0x43, 0x34, 0x34, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3f, 0x3d, 0x3d, 0x37, 0x3d, 0x40, 0x3d, 0x34, 0x41, 0x32, 0x2b, 0x2d, 0x7c, 0xf3, 0xe4, 0xe8, 0xae, 0xe7, 0xf1, 0xf2, 0xf9, 0xe8, 0xfe, 0xad, 0xf6, 0x7a, 0x33, 0x1b, 0x62, 0x81, 0xe4, 0xfa, 0xfa, 0x7c, 0x3b, 0x29, 0x73, 0x80, 0xfa, 0x7b, 0x42, 0x18, 0x6f, 0xff, 0xfa, 0x7f, 0x60, 0x1c, 0x6e, 0x81, 0x80, 0x7e, 0x58, 0x18, 0x6c, 0xf6, 0xe7, 0xfb, 0x7b, 0x3b, 0x1a, 0x71, 0x7f, 0xf8, 0x85, 0xae, 0xe6, 0xf1, 0xf1, 0xf4, 0xf9, 0xf9, 0xe8, 0x85, 0x04, 0x0d, 0x4d, 0x32, 0x3d, 0x2e, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3f, 0x34, 0x37, 0x32, 0x40, 0x41, 0x2e, 0x40, 0x4b, 0x1c, 0x02, 0xef, 0xf6, 0xf8, 0xf4, 0xf1, 0xf4, 0xf1, 0xf2, 0xe6, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf9, 0xf4, 0xf2, 0xb1, 0x05, 0x35, 0x40, 0x2e, 0x34, 0x40, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x34, 0x34, 0x2e, 0x1b, 0x62, 0x80, 0xf2, 0xe8, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xe3, 0xad, 0xad, 0x81, 0x76, 0x1e, 0x19, 0x6c, 0x80, 0xf8, 0xfe, 0x80, 0x62, 0x18, 0x56, 0x7f, 0xff, 0x7d, 0x58, 0x18, 0x65, 0x7e, 0xfa, 0x7d, 0x5e, 0x1c, 0x73, 0x81, 0x80, 0x75, 0x2a, 0x19, 0xfe, 0x85, 0xfe, 0x7e, 0x60, 0x16, 0x62, 0x81, 0xf8, 0x85, 0xad, 0xae, 0xe8, 0xf1, 0xf9, 0xf9, 0xf3, 0xf4, 0xe7, 0xf7, 0xed, 0x05, 0x21, 0x3f, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x34, 0x37, 0x3d, 0x46, 0x3d, 0x30, 0x34, 0x43, 0x28, 0x03, 0xfc, 0xf7, 0xf1, 0xf2, 0xf9, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf4, 0xf4, 0xf3, 0xb1, 0x08, 0x49, 0x3d, 0x37, 0x37, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x34, 0x37, 0x34, 0x4b, 0x1e, 0x78, 0x85, 0xe8, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xae, 0xe6, 0xe3, 0xf2, 0x7f, 0x6f, 0x16, 0x22, 0x70, 0x80, 0xf8, 0x81, 0x78, 0x1c, 0x1e, 0x73, 0x7f, 0x7f, 0x5e, 0x1d, 0x58, 0x7d, 0xff, 0x7b, 0x4e, 0x1f, 0x76, 0x81, 0x7e, 0x68, 0x20, 0x4e, 0x80, 0xfe, 0x7d, 0x6b, 0x16, 0x57, 0x7d, 0x81, 0xe4, 0xe6, 0xe3, 0xea, 0xf1, 0xfa, 0xf2, 0xf2, 0xe8, 0xe8, 0xf9, 0x85, 0x77, 0x02, 0x10, 0x3c, 0x23, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3f, 0x3d, 0x32, 0x40, 0x40, 0x40, 0x30, 0x32, 0x3f, 0x45, 0x05, 0xd7, 0xf7, 0xf8, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xe6, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0x85, 0xb1, 0x0a, 0x3c, 0x40, 0x30, 0x2e, 0x40, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x3f, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x30, 0x37, 0x23, 0x60, 0x7e, 0xae, 0xe7, 0xf2, 0xf9, 0xfa, 0xf9, 0xf2, 0xe6, 0xf1, 0xf9, 0xf4, 0xf1, 0xe9, 0xe7, 0xe4, 0x7e, 0x57, 0x16, 0x22, 0x7c, 0xfe, 0x85, 0x7c, 0x48, 0x1c, 0x5e, 0x7f, 0x81, 0x65, 0x23, 0x44, 0x78, 0xff, 0x7a, 0x2d, 0x1f, 0x73, 0x81, 0x7d, 0x51, 0x2a, 0x6b, 0x80, 0x7f, 0x73, 0x29, 0x1e, 0x71, 0x81, 0xf1, 0xe8, 0xe8, 0xe4, 0xf5, 0xfa, 0xf9, 0xf2, 0xe4, 0xad, 0xf2, 0xf9, 0xf9, 0xf7, 0xbb, 0x05, 0x35, 0x2e, 0x2e, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x40, 0x34, 0x34, 0x40, 0x46, 0x40, 0x31, 0x34, 0x3d, 0x49, 0x05, 0xfc, 0xf7, 0xf2, 0xf2, 0xf1, 0xf9, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0x81, 0x07, 0x0a, 0x4d, 0x40, 0x37, 0x37, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x40, 0x32, 0x34, 0x37, 0x47, 0x3d, 0x3e, 0x1b, 0x79, 0xfe, 0xae, 0xf1, 0xf1, 0xf9, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xfa, 0xf9, 0xe3, 0x85, 0xf3, 0x7d, 0x4e, 0x16, 0x4e, 0x7c, 0xfe, 0xfa, 0x62, 0x28, 0x35, 0x7b, 0x85, 0x6e, 0x25, 0x28, 0x75, 0x80, 0x75, 0x21, 0x2a, 0x79, 0x81, 0x73, 0x2a, 0x26, 0x79, 0x7f, 0x7b, 0x35, 0x1c, 0x66, 0x7e, 0xe4, 0xf8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf9, 0xf4, 0xf1, 0xe6, 0xe6, 0xf2, 0xfa, 0xf9, 0xf6, 0xf0, 0x01, 0x10, 0x4d, 0x32, 0x32, 0x2e, 0x2e, 0x2e, 0x34, 0x38, 0x3d, 0x32, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x34, 0x3d, 0x32, 0x40, 0x40, 0x3d, 0x31, 0x34, 0x3f, 0x49, 0x08, 0xef, 0xf7, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xe8, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xe3, 0xe8, 0x81, 0xeb, 0x0a, 0x45, 0x40, 0x3d, 0x30, 0x2e, 0x3f, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x3f, 0x30, 0x32, 0x41, 0x1d, 0x5e, 0x7e, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf9, 0xf4, 0xf9, 0xae, 0xad, 0x81, 0x71, 0x19, 0x18, 0x5f, 0x7f, 0xf5, 0x78, 0x1f, 0x30, 0x6b, 0x81, 0x76, 0x27, 0x1f, 0x6f, 0x7f, 0x75, 0x1b, 0x44, 0x75, 0x7f, 0x65, 0x1f, 0x5c, 0x7c, 0x7f, 0x5f, 0x25, 0x36, 0x7c, 0xe6, 0xf9, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf4, 0xf9, 0xf4, 0xe6, 0x85, 0xbb, 0x05, 0x35, 0x34, 0x32, 0x2e, 0x2c, 0x30, 0x2e, 0x38, 0x38, 0x3d, 0x30, 0x34, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x34, 0x37, 0x3d, 0x40, 0x32, 0x31, 0x37, 0x32, 0x54, 0x08, 0xef, 0xf7, 0xe4, 0xf3, 0xe4, 0xf2, 0xf1, 0xe8, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe6, 0xf2, 0x81, 0x0b, 0x0a, 0x49, 0x40, 0x41, 0x2e, 0x37, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x34, 0x3f, 0x34, 0x3f, 0x2c, 0x26, 0x75, 0x80, 0xf8, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf9, 0xf2, 0xe7, 0xad, 0xf3, 0x7e, 0x69, 0x16, 0x16, 0x6f, 0xff, 0x7f, 0x44, 0x2f, 0x48, 0x7b, 0x75, 0x36, 0x25, 0x64, 0x7e, 0x6f, 0x20, 0x33, 0x7a, 0x78, 0x44, 0x1d, 0x6e, 0x7d, 0x69, 0x21, 0x1f, 0x6f, 0xff, 0xfe, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xe7, 0xf1, 0xfa, 0xf4, 0xe4, 0xf6, 0x77, 0x03, 0x0f, 0x3c, 0x32, 0x32, 0x30, 0x2e, 0x32, 0x3d, 0x38, 0x32, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x37, 0x3d, 0x40, 0x32, 0x31, 0x34, 0x40, 0x45, 0x08, 0xde, 0xf7, 0xe4, 0xf2, 0xe4, 0xf2, 0xf1, 0xf2, 0xe8, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe8, 0xf4, 0xf7, 0xec, 0x09, 0x45, 0x40, 0x3d, 0x34, 0x2e, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3f, 0x34, 0x4a, 0x2c, 0x1c, 0x62, 0x7e, 0xfe, 0xe3, 0xe7, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe6, 0xe4, 0xf4, 0xf9, 0xf1, 0xe8, 0xf8, 0x7f, 0x7c, 0x3b, 0x18, 0x26, 0x78, 0x7e, 0x68, 0x23, 0x2b, 0x6e, 0x7a, 0x2d, 0x23, 0x59, 0x7b, 0x6d, 0x27, 0x48, 0x7a, 0x6d, 0x2a, 0x2b, 0x76, 0x79, 0x21, 0x25, 0x4e, 0x7c, 0xfe, 0xf9, 0xf3, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xf9, 0xfe, 0xf1, 0xe8, 0xf7, 0x17, 0x03, 0x36, 0x38, 0x32, 0x32, 0x30, 0x32, 0x32, 0x38, 0x3d, 0x32, 0x34, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x37, 0x3d, 0x40, 0x3d, 0x30, 0x3d, 0x38, 0x35, 0x0c, 0xf0, 0xf7, 0xe4, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe7, 0xfb, 0xf3, 0x52, 0x06, 0x35, 0x40, 0x32, 0x34, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x34, 0x30, 0x41, 0x4a, 0x27, 0x22, 0x7e, 0x80, 0xf8, 0xea, 0xe5, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xae, 0xf4, 0xf2, 0xf5, 0xe8, 0xf2, 0xfe, 0x7f, 0x70, 0x1b, 0x1d, 0x3b, 0x7e, 0x73, 0x20, 0x23, 0x61, 0x7a, 0x3b, 0x2f, 0x3c, 0x76, 0x64, 0x25, 0x57, 0x79, 0x58, 0x2f, 0x51, 0x76, 0x5c, 0x25, 0x23, 0x75, 0xfb, 0xf9, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xe5, 0xae, 0xf9, 0xfa, 0xfa, 0xe8, 0xfb, 0x77, 0x06, 0x0a, 0x50, 0x32, 0x32, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x3d, 0x3d, 0x37, 0x32, 0x40, 0x40, 0x34, 0x3d, 0x43, 0x35, 0x0e, 0x85, 0xf3, 0xf8, 0xf1, 0xf4, 0xf2, 0xf1, 0xe8, 0xe4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xe8, 0xf9, 0x81, 0xef, 0x05, 0x44, 0x32, 0x3d, 0x34, 0x32, 0x3f, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3f, 0x32, 0x32, 0x32, 0x40, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x37, 0x40, 0x38, 0x1f, 0x6c, 0x81, 0xf8, 0xf4, 0xf1, 0xe7, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xe4, 0xae, 0xf1, 0xf9, 0xf1, 0xf1, 0xe8, 0xf3, 0xf4, 0x7e, 0x5e, 0x1d, 0x18, 0x6b, 0x7a, 0x33, 0x2b, 0x27, 0x79, 0x5c, 0x2e, 0x3c, 0x6d, 0x61, 0x2c, 0x57, 0x76, 0x3c, 0x3c, 0x5c, 0x6d, 0x2c, 0x3e, 0x44, 0x7e, 0xf8, 0xf1, 0xf1, 0xe7, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xae, 0xe7, 0xf3, 0xfa, 0xf9, 0xf5, 0xe4, 0xf7, 0xfd, 0x03, 0x13, 0x50, 0x2e, 0x34, 0x32, 0x34, 0x2f, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x34, 0x32, 0x40, 0x40, 0x3f, 0x3d, 0x2f, 0x42, 0x14, 0xf7, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xe6, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xfb, 0xf8, 0x06, 0x33, 0x2f, 0x32, 0x2e, 0x32, 0x32, 0x3f, 0x3d, 0x3f, 0x3d, 0x3f, 0x3d, 0x3f, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x3f, 0x3d, 0x3f, 0x3d, 0x3d, 0x3f, 0x37, 0x37, 0x1d, 0x65, 0x7d, 0xf3, 0xf2, 0xf9, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xe6, 0xe6, 0xf2, 0xf2, 0xf5, 0xe9, 0xf2, 0xe8, 0xf2, 0x81, 0x75, 0x18, 0x1d, 0x36, 0x76, 0x57, 0x27, 0x25, 0x6d, 0x5c, 0x2f, 0x3c, 0x6d, 0x61, 0x1d, 0x64, 0x6d, 0x2b, 0x23, 0x6d, 0x61, 0x32, 0x2b, 0x6f, 0x80, 0xf9, 0xf9, 0xe7, 0xe3, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xe7, 0xe7, 0xf8, 0xfe, 0xf4, 0xf1, 0xf1, 0xe4, 0xf7, 0x17, 0x08, 0x44, 0x23, 0x23, 0x41, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x3d, 0x3d, 0x3f, 0x32, 0x3d, 0x41, 0x34, 0x38, 0x3c, 0x22, 0x52, 0xf6, 0xf2, 0xf2, 0xf2, 0xf5, 0xf1, 0xf1, 0xe8, 0xe4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf7, 0x0b, 0x16, 0x3c, 0x2e, 0x2e, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3f, 0x32, 0x32, 0x32, 0x40, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3c, 0x28, 0x57, 0x7b, 0x80, 0xf9, 0xf5, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xe6, 0xe8, 0xf2, 0xe8, 0xf2, 0xf4, 0xf2, 0xe7, 0xf3, 0x7f, 0x2d, 0x27, 0x20, 0x64, 0x64, 0x1f, 0x25, 0x61, 0x61, 0x2e, 0x3c, 0x61, 0x4d, 0x2e, 0x61, 0x64, 0x2f, 0x31, 0x61, 0x3c, 0x53, 0x48, 0x7d, 0xe4, 0xf9, 0xf8, 0xe4, 0xe5, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe7, 0xf1, 0xf2, 0xf8, 0xf2, 0xf1, 0xe7, 0xe4, 0xea, 0x81, 0x14, 0x0a, 0x35, 0x2c, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x41, 0x32, 0x37, 0x3d, 0x3d, 0x34, 0x43, 0x20, 0x5f, 0xfe, 0xf3, 0xf2, 0xf9, 0xf2, 0xf5, 0xf1, 0xf1, 0xf1, 0xe6, 0xe4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe8, 0xf2, 0xe4, 0xf7, 0x17, 0x10, 0x4d, 0x2e, 0x2e, 0x32, 0x3f, 0x3d, 0x3f, 0x3d, 0x3f, 0x3d, 0x3f, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x23, 0x2d, 0x75, 0x80, 0xf9, 0xf5, 0xf1, 0xf1, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf2, 0xe6, 0xe8, 0xe7, 0xf1, 0xf4, 0xf4, 0xf2, 0xe8, 0xf7, 0x24, 0x20, 0x2f, 0x2c, 0x61, 0x25, 0x2c, 0x50, 0x4b, 0x3f, 0x2b, 0x39, 0x30, 0x43, 0x4b, 0x55, 0x2e, 0x31, 0x39, 0x3d, 0x23, 0x69, 0xf4, 0xe3, 0xf8, 0xfe, 0xf1, 0xe5, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xe7, 0xf8, 0xf3, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf3, 0x81, 0x0c, 0x0f, 0x3e, 0x32, 0x3d, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x40, 0x3d, 0x37, 0x32, 0x41, 0x37, 0x43, 0x20, 0x67, 0x85, 0xf4, 0xf1, 0xf1, 0xf5, 0xf4, 0xf1, 0xe8, 0xe4, 0xe6, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xe7, 0x85, 0x77, 0x0d, 0x3c, 0x2c, 0x2e, 0x34, 0x32, 0x3f, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3f, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x35, 0x76, 0xfe, 0xad, 0xe7, 0xf5, 0xf5, 0xae, 0xad, 0xe4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xea, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xea, 0x85, 0xf2, 0xf4, 0xf4, 0xf2, 0xf7, 0xef, 0x06, 0x26, 0x43, 0x38, 0x2e, 0x23, 0x43, 0x38, 0x43, 0x32, 0x3c, 0x3e, 0x2e, 0x4a, 0x38, 0x38, 0x2f, 0x31, 0x41, 0x3f, 0x28, 0x7a, 0xe4, 0xe2, 0xf8, 0xf8, 0xf8, 0xe7, 0xea, 0xea, 0xea, 0xf4, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf5, 0xf2, 0xe4, 0xf3, 0xe6, 0xf1, 0xf1, 0xf5, 0xf2, 0x85, 0x7e, 0x15, 0x1d, 0x32, 0x3d, 0x32, 0x2e, 0x2e, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x3d, 0x32, 0x4a, 0x32, 0x3f, 0x34, 0x3d, 0x3f, 0x2f, 0x21, 0x7a, 0x85, 0xf4, 0xf2, 0xf9, 0xe8, 0xf5, 0xf1, 0xf2, 0xe8, 0xf2, 0xe8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xe6, 0xf2, 0xf4, 0xe6, 0x80, 0x14, 0x16, 0x2f, 0x3d, 0x34, 0x34, 0x34, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x3f, 0x34, 0x3d, 0x3d, 0x40, 0x43, 0x37, 0x2f, 0x2c, 0x20, 0x6f, 0x7f, 0xfe, 0xe6, 0xe9, 0xf1, 0xe7, 0xe6, 0xf2, 0xe6, 0xf4, 0xe4, 0xf3, 0xf3, 0xf7, 0xe4, 0xd7, 0xbe, 0xbb, 0xbb, 0xbb, 0xee, 0xde, 0xf6, 0xf6, 0xea, 0xf8, 0xf1, 0xf7, 0xfc, 0x02, 0x1a, 0x3c, 0x4a, 0x32, 0x2c, 0x37, 0x40, 0x40, 0x3f, 0x3e, 0x3f, 0x3d, 0x3f, 0x43, 0x43, 0x47, 0x41, 0x4a, 0x25, 0x5f, 0x7e, 0x77, 0xf9, 0xf8, 0xf7, 0xf6, 0xe7, 0xe1, 0xe1, 0xe1, 0xe4, 0xf7, 0xf6, 0xea, 0xf8, 0xf2, 0xf2, 0xe4, 0xea, 0xe4, 0xe4, 0xf1, 0xf2, 0xf1, 0xf2, 0xae, 0xad, 0x81, 0x73, 0x16, 0x1d, 0x2e, 0x32, 0x32, 0x37, 0x2e, 0x32, 0x32, 0x34, 0x34, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x38, 0x32, 0x41, 0x34, 0x3f, 0x20, 0x5e, 0x7e, 0xe8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xe8, 0xf3, 0xf4, 0xe8, 0xf6, 0xfd, 0x10, 0x45, 0x3d, 0x41, 0x41, 0x3d, 0x3d, 0x32, 0x32, 0x3f, 0x32, 0x3d, 0x3d, 0x3d, 0x3f, 0x2e, 0x37, 0x34, 0x40, 0x3f, 0x2b, 0x1e, 0x6e, 0x80, 0xfb, 0xf9, 0xf3, 0xf2, 0xe8, 0xf1, 0xe8, 0xf1, 0xf8, 0xf1, 0xfb, 0xf7, 0xe1, 0xec, 0xb0, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0xeb, 0xee, 0xf7, 0xf6, 0xf3, 0xf6, 0xfd, 0x00, 0x1a, 0x2b, 0x40, 0x2e, 0x2c, 0x3f, 0x3d, 0x3d, 0x3e, 0x3d, 0x43, 0x3f, 0x37, 0x3e, 0x3f, 0x43, 0x4a, 0x40, 0x28, 0x75, 0xfe, 0xf9, 0xfb, 0xe7, 0xca, 0xb6, 0x8e, 0x8c, 0x89, 0x8c, 0x8e, 0xb6, 0xca, 0xe4, 0xf7, 0xe4, 0xe8, 0xae, 0xe4, 0xe8, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xae, 0xe4, 0x81, 0x75, 0x1e, 0x25, 0x38, 0x3d, 0x2e, 0x37, 0x38, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x2f, 0x3c, 0x38, 0x43, 0x3d, 0x41, 0x41, 0x23, 0x21, 0x79, 0xfb, 0xe4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xe8, 0xf2, 0xf3, 0x7e, 0x3a, 0x16, 0x2c, 0x32, 0x40, 0x40, 0x3d, 0x40, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x40, 0x3d, 0x37, 0x31, 0x34, 0x47, 0x23, 0x1c, 0x71, 0xfe, 0xf3, 0xf8, 0xf2, 0xf3, 0xf2, 0xe6, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf7, 0xca, 0xb0, 0x84, 0x86, 0x89, 0x89, 0x89, 0x8a, 0x87, 0x8a, 0x89, 0x84, 0x86, 0xb6, 0xe1, 0xf7, 0xf4, 0xf7, 0x01, 0x14, 0x3c, 0x38, 0x32, 0x2c, 0x32, 0x40, 0x3f, 0x37, 0x3f, 0x3d, 0x3f, 0x43, 0x43, 0x43, 0x47, 0x46, 0x2c, 0x5c, 0x7c, 0xf8, 0xfb, 0xd7, 0x93, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x86, 0x86, 0x84, 0x8e, 0xca, 0xf3, 0xea, 0xe4, 0xe8, 0xe4, 0xe8, 0xf1, 0xf1, 0xf2, 0xe4, 0xf5, 0xfa, 0xf4, 0xe4, 0x80, 0x73, 0x21, 0x23, 0x40, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x3f, 0x32, 0x3f, 0x37, 0x3e, 0x34, 0x40, 0x41, 0x43, 0x1f, 0x65, 0x7e, 0xe6, 0xe3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xe7, 0xf2, 0xfa, 0x81, 0x74, 0x11, 0x26, 0x38, 0x3d, 0x38, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x32, 0x3f, 0x3d, 0x40, 0x41, 0x41, 0x41, 0x23, 0x28, 0x6f, 0x80, 0xad, 0xe6, 0xf8, 0xf6, 0xf1, 0xe6, 0xf1, 0xf2, 0xf2, 0xf9, 0xf4, 0xf7, 0xed, 0x84, 0x86, 0x89, 0x87, 0x89, 0x88, 0x89, 0x88, 0x89, 0x88, 0x89, 0x8a, 0x89, 0x84, 0xb2, 0xe1, 0xf7, 0xf7, 0x0b, 0x0c, 0x5a, 0x32, 0x32, 0x2c, 0x3d, 0x3d, 0x34, 0x37, 0x3f, 0x3f, 0x43, 0x40, 0x43, 0x40, 0x40, 0x43, 0x1f, 0x6f, 0x7e, 0xf6, 0xc6, 0xaf, 0x89, 0x8c, 0x89, 0x8a, 0x89, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x86, 0x84, 0x93, 0xf1, 0xf6, 0xe4, 0xe8, 0xf1, 0xe6, 0xf2, 0xf1, 0xf2, 0xf4, 0xfa, 0xf9, 0xe7, 0x85, 0x7f, 0x73, 0x21, 0x1d, 0x41, 0x32, 0x3d, 0x2e, 0x37, 0x2e, 0x30, 0x3f, 0x40, 0x46, 0x46, 0x41, 0x34, 0x4a, 0x38, 0x2b, 0x3b, 0x7b, 0x81, 0xae, 0xe3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xe5, 0xf5, 0xf4, 0xfb, 0x85, 0x6a, 0x15, 0x2b, 0x3c, 0x2c, 0x37, 0x32, 0x34, 0x32, 0x34, 0x37, 0x2c, 0x34, 0x41, 0x40, 0x40, 0x25, 0x42, 0x79, 0x7f, 0xfe, 0xf2, 0xe8, 0xe6, 0xe8, 0xe4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf7, 0xbb, 0x84, 0x82, 0x86, 0x89, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x89, 0x88, 0x8a, 0x89, 0x8a, 0x87, 0x8e, 0xe4, 0xf7, 0xca, 0x0c, 0x59, 0x32, 0x2e, 0x2e, 0x3d, 0x3f, 0x3f, 0x43, 0x37, 0x37, 0x3f, 0x40, 0x46, 0x40, 0x43, 0x2c, 0x57, 0x7b, 0xf7, 0xbe, 0x8a, 0xb0, 0x8c, 0x88, 0x89, 0x89, 0x87, 0x87, 0x87, 0x89, 0x89, 0x89, 0x89, 0x89, 0x84, 0xb1, 0xf0, 0xf6, 0xe8, 0xe4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xea, 0xf1, 0xf2, 0xf4, 0x81, 0x70, 0x3b, 0x1d, 0x38, 0x46, 0x3d, 0x34, 0x2c, 0x3e, 0x37, 0x41, 0x4a, 0x4a, 0x41, 0x41, 0x3d, 0x25, 0x1e, 0x78, 0xfe, 0xae, 0xae, 0xe7, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xe4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf8, 0xf1, 0xe7, 0xf1, 0xf5, 0xe6, 0xad, 0x85, 0x62, 0x16, 0x25, 0x3c, 0x2e, 0x32, 0x41, 0x41, 0x32, 0x34, 0x2e, 0x37, 0x37, 0x4b, 0x18, 0x57, 0x75, 0xfb, 0xfe, 0xf9, 0xff, 0xe8, 0xe8, 0xe6, 0xf1, 0xe8, 0xf2, 0xf4, 0xf8, 0xf7, 0xee, 0x82, 0x84, 0x89, 0x86, 0x89, 0x87, 0x87, 0x88, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x89, 0x8a, 0x89, 0x89, 0x86, 0xbb, 0xf7, 0x77, 0x0c, 0x58, 0x40, 0x32, 0x37, 0x3d, 0x3f, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x40, 0x46, 0x4f, 0x2f, 0x2b, 0x62, 0x80, 0xdc, 0x8c, 0x8e, 0x8a, 0x8a, 0x87, 0x86, 0x84, 0x84, 0x84, 0x86, 0x87, 0x89, 0x89, 0x89, 0x89, 0x89, 0x84, 0xb2, 0xf6, 0x85, 0xe4, 0xe6, 0xf2, 0xf2, 0xf2, 0xe6, 0xad, 0xf3, 0xf2, 0xf5, 0xf1, 0xf3, 0x80, 0x7a, 0x3b, 0x1d, 0x38, 0x3d, 0x4a, 0x34, 0x34, 0x34, 0x3f, 0x34, 0x34, 0x41, 0x3f, 0x2f, 0x1e, 0x6b, 0x80, 0xae, 0xae, 0xfa, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xe7, 0xf1, 0xf5, 0xe3, 0x85, 0xf8, 0x80, 0x69, 0x58, 0x1d, 0x2b, 0x4b, 0x32, 0x32, 0x3d, 0x3f, 0x3e, 0x39, 0x1f, 0x22, 0x66, 0x7e, 0x81, 0xf9, 0xe7, 0xe4, 0xe8, 0xe8, 0xae, 0xe8, 0xe8, 0xf2, 0xf8, 0xe4, 0xf7, 0xf0, 0xaf, 0x84, 0x89, 0x86, 0x87, 0x86, 0x89, 0x8a, 0x8a, 0x87, 0x8e, 0xa4, 0xb6, 0xb2, 0x8a, 0x86, 0x8a, 0x8a, 0x8a, 0x86, 0xd7, 0x85, 0x14, 0x59, 0x2f, 0x3d, 0x3d, 0x40, 0x37, 0x3f, 0x43, 0x37, 0x3e, 0x3f, 0x41, 0x38, 0x4f, 0x3c, 0x28, 0x78, 0xfe, 0x93, 0x8a, 0x8e, 0x89, 0x86, 0x88, 0x07, 0xc3, 0xed, 0xbe, 0xb1, 0x84, 0x84, 0x87, 0xaf, 0x89, 0x89, 0x89, 0x84, 0xbb, 0xea, 0xe8, 0xe4, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xad, 0xe6, 0xae, 0xe7, 0xe4, 0xff, 0xff, 0x7f, 0x67, 0x22, 0x1c, 0x25, 0x38, 0x40, 0x46, 0x3d, 0x3e, 0x39, 0x2b, 0x20, 0x26, 0x79, 0x7f, 0xe6, 0xae, 0xf1, 0xff, 0xff, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xe4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe6, 0xf1, 0xf2, 0xf1, 0xe7, 0xe7, 0xe4, 0xf8, 0xfe, 0x7e, 0x79, 0x60, 0x1e, 0x18, 0x20, 0x1d, 0x20, 0x20, 0x1b, 0x29, 0x60, 0x76, 0x7c, 0x7b, 0x74, 0x7f, 0xfe, 0xe8, 0xae, 0xe5, 0xe6, 0xe8, 0xf2, 0xf3, 0xea, 0xf8, 0xf7, 0xec, 0x84, 0x87, 0x84, 0x87, 0x89, 0x89, 0x8a, 0x89, 0x84, 0xb1, 0xe0, 0xf6, 0xe8, 0xe5, 0xdc, 0xbb, 0x87, 0x89, 0x89, 0x86, 0xeb, 0xf7, 0x52, 0x29, 0x2f, 0x3d, 0x32, 0x40, 0x37, 0x3f, 0x40, 0x37, 0x3e, 0x3f, 0x40, 0x40, 0x43, 0x27, 0x36, 0x7e, 0xd9, 0x89, 0x8e, 0x8a, 0x84, 0x8e, 0xd9, 0xae, 0xf6, 0xf7, 0xf7, 0xf0, 0xb2, 0x84, 0x86, 0x82, 0xaf, 0x89, 0x82, 0x8a, 0x84, 0xef, 0xea, 0xe8, 0xf2, 0xf1, 0xf1, 0xf2, 0xfe, 0x85, 0xae, 0xe6, 0xe8, 0xf4, 0xfe, 0x80, 0x80, 0x80, 0x78, 0x62, 0x22, 0x1f, 0x1d, 0x23, 0x25, 0x27, 0x2a, 0x26, 0x60, 0x7a, 0x7e, 0xfb, 0xf1, 0xe8, 0xf9, 0xfa, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xae, 0xe6, 0xf4, 0xf2, 0xe3, 0xe7, 0xfa, 0x80, 0xf1, 0xad, 0xf8, 0x7f, 0x7c, 0x6c, 0x66, 0x65, 0x65, 0x6b, 0x79, 0x7b, 0x7c, 0x76, 0x64, 0x36, 0x19, 0x6c, 0x7f, 0xe8, 0xe5, 0xe7, 0xe7, 0xf2, 0xf2, 0xf4, 0xe4, 0xf6, 0xe1, 0x8a, 0x84, 0x87, 0x89, 0x86, 0x87, 0xaf, 0x89, 0x86, 0x84, 0x93, 0xf7, 0xea, 0xe8, 0xe8, 0xea, 0xf6, 0xee, 0x89, 0x8a, 0x89, 0x89, 0x85, 0x71, 0x29, 0x2f, 0x3d, 0x40, 0x40, 0x37, 0x3f, 0x46, 0x37, 0x3e, 0x37, 0x40, 0x40, 0x2f, 0x28, 0x64, 0x81, 0xbb, 0x8a, 0xaf, 0xaf, 0xec, 0xde, 0x85, 0xf6, 0xfb, 0xe4, 0xe8, 0x81, 0xb2, 0x84, 0x84, 0x86, 0x83, 0x89, 0x89, 0x89, 0x84, 0xb6, 0xf7, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xfa, 0xfa, 0xf3, 0xe4, 0xad, 0xf6, 0x72, 0x0b, 0x5d, 0x7b, 0x7c, 0x7b, 0x73, 0x69, 0x66, 0x60, 0x69, 0x6b, 0x7b, 0x7f, 0xfe, 0xf3, 0xf3, 0xfa, 0xfa, 0xf4, 0xe4, 0xe7, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xe4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf2, 0xe8, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xe6, 0xe4, 0xf4, 0xf1, 0xe7, 0xe8, 0xfa, 0xfa, 0xf1, 0xad, 0xe3, 0x85, 0x7e, 0x7b, 0x7b, 0x7a, 0x7b, 0x7a, 0x79, 0x70, 0x56, 0x2a, 0x2f, 0x43, 0x2c, 0x2d, 0x73, 0x81, 0xe7, 0xe7, 0xe8, 0xf2, 0xf2, 0xf4, 0xf2, 0xf6, 0xee, 0x86, 0x87, 0x86, 0x86, 0x87, 0x89, 0x89, 0xaf, 0x84, 0x84, 0xb6, 0xf7, 0xf8, 0xf2, 0xf2, 0xf1, 0xe8, 0xf7, 0xc3, 0x86, 0x8c, 0x84, 0xef, 0x7d, 0x2d, 0x23, 0x3d, 0x32, 0x40, 0x37, 0x3d, 0x40, 0x3f, 0x3e, 0x37, 0x3d, 0x40, 0x2f, 0x1f, 0x69, 0xfe, 0x8e, 0x89, 0xb2, 0xe1, 0xf7, 0x85, 0xe1, 0xf0, 0xf0, 0xe4, 0xde, 0xe1, 0xeb, 0x84, 0x84, 0x84, 0x86, 0xaf, 0x89, 0x82, 0x89, 0xaf, 0xe4, 0xe8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf5, 0xfa, 0xff, 0xfa, 0xe6, 0x85, 0xf0, 0x07, 0x05, 0x12, 0x57, 0x5c, 0x73, 0x79, 0x7b, 0x7c, 0x7c, 0x7b, 0x7b, 0x7d, 0xfe, 0x85, 0xae, 0xe8, 0xff, 0xff, 0xf9, 0xae, 0xae, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf9, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xe8, 0xe7, 0xe4, 0xae, 0xae, 0xae, 0xe4, 0xe6, 0xae, 0xad, 0xad, 0xae, 0xe6, 0xf1, 0xf9, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf3, 0xe5, 0xad, 0x74, 0x3a, 0x5c, 0x61, 0x64, 0x58, 0x58, 0x1f, 0x1d, 0x2c, 0x43, 0x46, 0x46, 0x43, 0x23, 0x64, 0x7d, 0xe6, 0xae, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf7, 0xbe, 0x84, 0x82, 0x87, 0x87, 0x89, 0x89, 0x86, 0xbb, 0xd7, 0xef, 0xfb, 0xea, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0x81, 0xe5, 0x07, 0x89, 0x84, 0xc6, 0x7f, 0x57, 0x3c, 0x2e, 0x3f, 0x40, 0x3f, 0x43, 0x46, 0x3c, 0x37, 0x3e, 0x37, 0x41, 0x46, 0x1f, 0x75, 0xfd, 0x8c, 0x86, 0xd7, 0xf7, 0xe8, 0xfb, 0x85, 0xe1, 0xdc, 0xda, 0xef, 0xf6, 0xea, 0xed, 0x82, 0x86, 0x86, 0x89, 0x89, 0x87, 0x89, 0x84, 0xef, 0xf6, 0xe8, 0xf1, 0xf2, 0xf1, 0xe8, 0xf2, 0xf3, 0xf3, 0xf2, 0xf7, 0x0b, 0x02, 0x0a, 0x51, 0x45, 0x45, 0x35, 0x44, 0x58, 0x5c, 0x5c, 0x64, 0x48, 0x56, 0x7c, 0xfe, 0xe3, 0xae, 0xf1, 0xfe, 0xfa, 0xe4, 0xe7, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf4, 0xf9, 0xf2, 0xf2, 0xe6, 0xf2, 0xae, 0xe6, 0xe6, 0xe8, 0xf4, 0xf9, 0xfa, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf8, 0xf8, 0xf9, 0xfe, 0xf9, 0xf3, 0xf1, 0xf2, 0xe8, 0xe4, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xfb, 0x7d, 0x57, 0x45, 0x45, 0x3c, 0x35, 0x3c, 0x4b, 0x4c, 0x3f, 0x46, 0x46, 0x4f, 0x43, 0x3c, 0x1b, 0x75, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf7, 0xbb, 0x84, 0x87, 0x82, 0x87, 0x89, 0x88, 0x87, 0xd9, 0xf6, 0xf7, 0xf3, 0xf3, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf7, 0xca, 0x87, 0x84, 0xbe, 0x80, 0x58, 0x2b, 0x32, 0x37, 0x3d, 0x3f, 0x38, 0x40, 0x37, 0x3e, 0x3f, 0x37, 0x47, 0x38, 0x21, 0x7a, 0xd7, 0xaf, 0x8c, 0xea, 0xea, 0xf6, 0xf3, 0xf6, 0x85, 0xae, 0xe4, 0xf6, 0xae, 0xf7, 0xf7, 0xd7, 0x89, 0x84, 0x87, 0xaf, 0x89, 0x89, 0x86, 0xca, 0xf6, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf3, 0x85, 0xe4, 0xf7, 0xfc, 0x01, 0x05, 0x21, 0x49, 0x4f, 0x4b, 0x4b, 0x50, 0x45, 0x45, 0x45, 0x45, 0x35, 0x56, 0x7d, 0xfe, 0xe6, 0xe3, 0xf2, 0xf9, 0xfe, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xae, 0xae, 0xae, 0xe6, 0xae, 0xe4, 0xe6, 0xe6, 0xf2, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf9, 0xf4, 0xfa, 0xff, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xf2, 0xf2, 0xe8, 0xe8, 0xe8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf4, 0xfa, 0x7c, 0x5e, 0x35, 0x4b, 0x4b, 0x43, 0x43, 0x38, 0x4f, 0x4b, 0x4f, 0x4f, 0x4c, 0x43, 0x3f, 0x27, 0x5f, 0x7e, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf7, 0xb6, 0x84, 0x87, 0x86, 0x87, 0x89, 0x87, 0x8e, 0xe4, 0xea, 0xe4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf4, 0xf9, 0xf6, 0xf2, 0xf6, 0xde, 0xaf, 0x84, 0xbe, 0x80, 0x58, 0x3c, 0x2e, 0x3f, 0x3d, 0x43, 0x43, 0x40, 0x3c, 0x3f, 0x3d, 0x47, 0x40, 0x38, 0x21, 0x7b, 0xd7, 0x89, 0x93, 0xf7, 0xe6, 0xea, 0xf3, 0xfb, 0xe6, 0xe6, 0xe8, 0xea, 0xf4, 0xf2, 0xfb, 0xf7, 0xb6, 0x84, 0x86, 0xaf, 0x89, 0x89, 0x86, 0xc6, 0xf6, 0xf1, 0xe8, 0xf9, 0xf2, 0xe4, 0xea, 0xf2, 0xe6, 0xfb, 0xeb, 0x03, 0x0a, 0x59, 0x3c, 0x4f, 0x4f, 0x4f, 0x5b, 0x4f, 0x4b, 0x4b, 0x50, 0x3c, 0x5f, 0x7e, 0xfe, 0xe3, 0xe3, 0xf2, 0xf8, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe6, 0xe6, 0xae, 0xad, 0xad, 0xad, 0xae, 0xae, 0xe6, 0xf2, 0xf2, 0xfa, 0xf5, 0xf9, 0xf4, 0xf9, 0xf2, 0xf1, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf3, 0xe8, 0xe6, 0xe6, 0xe8, 0xf2, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xfa, 0xfa, 0xfa, 0xf1, 0xf2, 0xae, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xe8, 0xe8, 0x7f, 0x70, 0x21, 0x55, 0x5b, 0x4f, 0x4f, 0x4a, 0x47, 0x4f, 0x46, 0x43, 0x3e, 0x3f, 0x43, 0x4b, 0x26, 0x75, 0xfe, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xf7, 0xbb, 0x84, 0x87, 0x82, 0x87, 0x8a, 0x87, 0xb2, 0xe4, 0xe6, 0xf1, 0xfb, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf8, 0xf4, 0xf7, 0xe4, 0xb0, 0x84, 0xc3, 0x7e, 0x58, 0x2c, 0x37, 0x37, 0x40, 0x43, 0x40, 0x3f, 0x3e, 0x3d, 0x40, 0x40, 0x40, 0x38, 0x33, 0x7a, 0xef, 0x87, 0xb6, 0xea, 0xea, 0xf2, 0xfb, 0xfb, 0xea, 0x85, 0xea, 0xe4, 0xf3, 0xf3, 0xf8, 0xf7, 0xec, 0x84, 0x86, 0xaf, 0x89, 0x89, 0x84, 0xca, 0xf6, 0xf2, 0xf1, 0xf2, 0xf4, 0xf9, 0xf4, 0xe6, 0xf7, 0xd7, 0x02, 0x05, 0x12, 0x50, 0x50, 0x4c, 0x50, 0x4b, 0x4b, 0x4f, 0x5b, 0x4f, 0x50, 0x2b, 0x6c, 0x7f, 0xf8, 0xe8, 0xe8, 0xe8, 0xf3, 0xf8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf8, 0xf3, 0xe4, 0xe6, 0xae, 0xae, 0xf1, 0xf1, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf1, 0xf2, 0xe8, 0xe6, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf8, 0xea, 0xf2, 0xe6, 0xe8, 0xae, 0xe6, 0xe6, 0xe7, 0xe7, 0xe5, 0xe8, 0xe7, 0xf9, 0xf9, 0xf5, 0xf9, 0xf2, 0xe6, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xe6, 0xae, 0xfb, 0x7b, 0x1a, 0x44, 0x4d, 0x50, 0x37, 0x4c, 0x3f, 0x4f, 0x43, 0x43, 0x3e, 0x3e, 0x4a, 0x43, 0x20, 0x68, 0x80, 0xf2, 0xf2, 0xf1, 0xf1, 0xe8, 0xf6, 0xbe, 0x84, 0x89, 0x87, 0x89, 0x8a, 0x87, 0xb2, 0xae, 0xe7, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xea, 0xf3, 0xe6, 0xf8, 0x8c, 0x84, 0xd7, 0x7e, 0x33, 0x2f, 0x37, 0x37, 0x40, 0x3d, 0x3f, 0x3e, 0x37, 0x40, 0x46, 0x3d, 0x38, 0x38, 0x2a, 0x7a, 0xef, 0xaf, 0x93, 0xf7, 0xad, 0xf6, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xfb, 0xf3, 0xf8, 0xf3, 0xf7, 0xed, 0x84, 0x89, 0x89, 0x89, 0x89, 0x86, 0xd7, 0xf6, 0xf1, 0xf1, 0xf4, 0xf1, 0xf5, 0xf2, 0xe4, 0xf7, 0x0e, 0x02, 0x08, 0x1f, 0x5b, 0x4c, 0x49, 0x49, 0x4d, 0x4d, 0x5b, 0x4c, 0x4d, 0x49, 0x28, 0x71, 0x80, 0xfb, 0xe4, 0xe8, 0xe4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xff, 0xff, 0xfe, 0xf1, 0xe6, 0xe8, 0xe8, 0xf9, 0xf9, 0xf4, 0xf1, 0xf1, 0xf5, 0xf1, 0xf1, 0xf2, 0xe8, 0xf2, 0xe4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xea, 0xe4, 0xfb, 0xf3, 0xfb, 0xf3, 0x85, 0xe4, 0xae, 0xe3, 0xad, 0xe3, 0xe6, 0xe7, 0xe7, 0xf5, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xe6, 0xe3, 0x85, 0x80, 0x5d, 0x26, 0x45, 0x4c, 0x3f, 0x4c, 0x3f, 0x43, 0x46, 0x3e, 0x3e, 0x4c, 0x41, 0x53, 0x25, 0x5c, 0x7f, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf7, 0xca, 0x86, 0x87, 0x89, 0x87, 0x8c, 0x89, 0x8c, 0xe1, 0xe8, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf8, 0xf4, 0xf8, 0xe4, 0xf7, 0xde, 0x86, 0x82, 0xad, 0x7a, 0x1b, 0x40, 0x37, 0x37, 0x3f, 0x40, 0x3d, 0x37, 0x3c, 0x46, 0x40, 0x40, 0x32, 0x38, 0x2a, 0x6f, 0x77, 0xb0, 0x8e, 0xf6, 0xe6, 0xea, 0xfb, 0xf6, 0xf8, 0xea, 0xf3, 0xf3, 0xfb, 0xf3, 0xfb, 0xf7, 0xbb, 0x84, 0x86, 0x8a, 0xaf, 0x89, 0x86, 0xe1, 0xea, 0xf1, 0xf1, 0xf2, 0xf9, 0xf5, 0xf5, 0xe7, 0xf3, 0x07, 0x05, 0x0f, 0x49, 0x4f, 0x4c, 0x4d, 0x49, 0x4d, 0x3e, 0x4c, 0x4f, 0x4d, 0x49, 0x36, 0x78, 0x80, 0xf4, 0xf1, 0xf1, 0xe6, 0xe4, 0xf3, 0xf1, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf8, 0xf9, 0xf9, 0xf2, 0xf1, 0xe8, 0xe4, 0xf1, 0xf3, 0x80, 0xfe, 0x81, 0xfb, 0xf4, 0xe1, 0xea, 0xe4, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfe, 0xfe, 0x7d, 0x7d, 0x7c, 0x7d, 0x7f, 0x81, 0xf8, 0xe6, 0x85, 0xe6, 0xe7, 0xf1, 0xe7, 0xf1, 0xf2, 0xf8, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xe4, 0xf4, 0x80, 0x75, 0x19, 0x54, 0x4f, 0x4f, 0x3f, 0x43, 0x47, 0x40, 0x4b, 0x3e, 0x3f, 0x4a, 0x46, 0x3c, 0x42, 0x7f, 0xf3, 0xf2, 0xf2, 0xf2, 0xe5, 0xf6, 0xdc, 0xaf, 0x89, 0x87, 0x89, 0x8a, 0x8a, 0x87, 0xca, 0xf7, 0xe8, 0xf2, 0xe8, 0xf2, 0xf2, 0xf4, 0xf8, 0xea, 0xf4, 0xf7, 0xed, 0x84, 0x07, 0xf7, 0x73, 0x20, 0x40, 0x34, 0x3e, 0x3d, 0x40, 0x3d, 0x37, 0x3d, 0x40, 0x46, 0x37, 0x3d, 0x38, 0x23, 0x68, 0x81, 0x07, 0x86, 0xf0, 0xf6, 0xe6, 0xf3, 0xfb, 0xea, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf6, 0xf6, 0xb2, 0x84, 0x89, 0x8a, 0xaf, 0x87, 0x8e, 0xf6, 0xe8, 0xf2, 0xf1, 0xf4, 0xf1, 0xf4, 0xf2, 0xf6, 0x72, 0x03, 0x08, 0x13, 0x5a, 0x4f, 0x4f, 0x50, 0x4c, 0x50, 0x4c, 0x4f, 0x4f, 0x4b, 0x45, 0x4e, 0x7e, 0xf4, 0xfa, 0xf5, 0xf1, 0xe4, 0xe6, 0xe4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe3, 0xe6, 0xe8, 0xf2, 0xfe, 0xfe, 0x7f, 0x7f, 0x7d, 0x7c, 0x78, 0x7d, 0x7f, 0xfe, 0xe8, 0xe6, 0xf1, 0xf3, 0xf8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf8, 0x7f, 0x52, 0x1a, 0x1a, 0x19, 0x22, 0x56, 0x6f, 0x7b, 0x7f, 0x80, 0xfe, 0xf8, 0xe8, 0xe7, 0xe4, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfa, 0xfb, 0xf9, 0x7f, 0x3b, 0x29, 0x4c, 0x4c, 0x4b, 0x43, 0x3f, 0x4f, 0x37, 0x3e, 0x3f, 0x53, 0x46, 0x3c, 0x2d, 0x7e, 0xf3, 0xf3, 0xf8, 0xf1, 0xf4, 0xe7, 0xf7, 0x93, 0x86, 0x89, 0x89, 0x8c, 0x8c, 0x88, 0xb2, 0xe7, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf7, 0xf0, 0x8e, 0x86, 0xc6, 0xf7, 0x62, 0x2b, 0x46, 0x34, 0x3e, 0x34, 0x40, 0x3d, 0x3f, 0x37, 0x46, 0x3d, 0x3e, 0x37, 0x4a, 0x2f, 0x48, 0x80, 0xec, 0x84, 0xbb, 0xf7, 0xf6, 0xf2, 0xf3, 0xea, 0x85, 0xf3, 0x85, 0xf3, 0xf3, 0xf7, 0xd7, 0x84, 0x87, 0x8a, 0x8a, 0xaf, 0x86, 0xec, 0xf7, 0xe8, 0xf1, 0xf1, 0xf1, 0xf4, 0xf3, 0xe4, 0xf6, 0x63, 0x05, 0x08, 0x28, 0x4d, 0x50, 0x4f, 0x4f, 0x50, 0x4c, 0x4c, 0x4f, 0x4f, 0x55, 0x29, 0x60, 0x81, 0xf3, 0xf9, 0xfb, 0xf1, 0xe6, 0xe6, 0xe4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xad, 0xe6, 0xfe, 0x7e, 0x7d, 0x75, 0x5f, 0x24, 0x1a, 0x15, 0x16, 0x15, 0x6a, 0x7f, 0xf8, 0xe6, 0xae, 0xf2, 0xf2, 0xf4, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0x81, 0x78, 0x14, 0x22, 0x61, 0x61, 0x3c, 0x1d, 0x1f, 0x2d, 0x66, 0x78, 0x7f, 0x80, 0xf1, 0xe6, 0xe5, 0xae, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf9, 0xf3, 0xe7, 0xae, 0x81, 0x71, 0x19, 0x49, 0x4d, 0x3c, 0x4d, 0x47, 0x40, 0x4b, 0x3e, 0x3d, 0x53, 0x46, 0x2b, 0x42, 0x7e, 0xf3, 0xf8, 0xf2, 0xf2, 0xe5, 0xe4, 0xf7, 0xee, 0x87, 0x89, 0x89, 0x8a, 0x8c, 0x8a, 0x87, 0xb6, 0xe4, 0xf7, 0xf1, 0xea, 0xf2, 0xf3, 0xf4, 0xfb, 0xea, 0xeb, 0x84, 0xb2, 0x77, 0xff, 0x3b, 0x2f, 0x46, 0x40, 0x31, 0x3f, 0x40, 0x40, 0x3d, 0x3d, 0x38, 0x40, 0x31, 0x34, 0x40, 0x43, 0x1f, 0x7d, 0xfd, 0xb0, 0x89, 0xc6, 0xf7, 0xf7, 0xea, 0xe6, 0xea, 0xe6, 0xf3, 0xf3, 0xf6, 0xe4, 0xb2, 0x86, 0x89, 0x8c, 0x8a, 0x89, 0xb0, 0xdf, 0xe8, 0xf1, 0xe8, 0xf1, 0xf4, 0xf3, 0xe8, 0xf2, 0xfb, 0x52, 0x05, 0x0a, 0x49, 0x4d, 0x55, 0x50, 0x50, 0x4d, 0x4d, 0x4d, 0x50, 0x55, 0x45, 0x3b, 0x75, 0x81, 0xf2, 0xfa, 0xf5, 0xf9, 0xe6, 0xae, 0xe6, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0x85, 0xf8, 0x7d, 0x70, 0x57, 0x1c, 0x20, 0x2c, 0x4d, 0x4b, 0x2b, 0x16, 0x56, 0x7d, 0xfe, 0xe6, 0xae, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0x81, 0x7f, 0x5f, 0x61, 0x61, 0x5b, 0x23, 0x40, 0x38, 0x2f, 0x1b, 0x29, 0x69, 0x7d, 0x7f, 0xe4, 0xae, 0xea, 0xf2, 0xf1, 0xe6, 0xe8, 0xe8, 0xf2, 0xe6, 0xe8, 0xe6, 0xf9, 0xf4, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xae, 0xe7, 0xe6, 0x7e, 0x24, 0x29, 0x54, 0x4b, 0x3e, 0x3c, 0x4f, 0x46, 0x46, 0x40, 0x53, 0x40, 0x35, 0x56, 0x7f, 0xf8, 0xf3, 0xae, 0xe6, 0xf2, 0xe8, 0xe4, 0xe6, 0xb3, 0x87, 0x8a, 0x8a, 0x8c, 0x8c, 0x8c, 0x87, 0xb3, 0xd9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf0, 0x93, 0x86, 0x86, 0xca, 0xf7, 0x5d, 0x26, 0x2f, 0x41, 0x34, 0x37, 0x3d, 0x3d, 0x40, 0x3d, 0x3f, 0x40, 0x3d, 0x37, 0x37, 0x41, 0x40, 0x25, 0x62, 0x81, 0xbb, 0x87, 0x89, 0xca, 0x80, 0xf7, 0xf6, 0xf6, 0xf7, 0xf6, 0xf7, 0xea, 0xb6, 0x84, 0x89, 0x8a, 0x8c, 0x8c, 0x84, 0xbe, 0xf7, 0xe6, 0xae, 0xae, 0xae, 0xe8, 0xf1, 0xe4, 0xfb, 0xfb, 0x52, 0x06, 0x0f, 0x49, 0x5b, 0x4f, 0x50, 0x45, 0x4d, 0x4d, 0x4c, 0x4c, 0x54, 0x29, 0x5d, 0x7d, 0xf3, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xe6, 0xe4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf9, 0xf2, 0xf2, 0xf2, 0xf9, 0xea, 0xf2, 0xae, 0xe4, 0xfe, 0x7c, 0x5e, 0x1c, 0x23, 0x38, 0x38, 0x23, 0x5b, 0x61, 0x61, 0x44, 0x6a, 0x7f, 0xe8, 0xf1, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xae, 0x80, 0x6f, 0x2a, 0x3c, 0x30, 0x3f, 0x40, 0x46, 0x38, 0x3f, 0x3e, 0x1d, 0x48, 0x73, 0x80, 0xf3, 0xe1, 0xf5, 0xf1, 0xe5, 0xe8, 0xf1, 0xf2, 0xe6, 0xe4, 0xe6, 0xf9, 0xfa, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe8, 0xe8, 0xe8, 0xf4, 0x81, 0x78, 0x11, 0x44, 0x4f, 0x4c, 0x4d, 0x4f, 0x46, 0x43, 0x47, 0x4a, 0x4f, 0x20, 0x69, 0x7f, 0xfe, 0xae, 0xad, 0xad, 0xe4, 0xfb, 0xf1, 0xf7, 0xde, 0x8c, 0x87, 0x8a, 0x8c, 0x8e, 0x8c, 0x8c, 0x88, 0x87, 0x8e, 0x93, 0xbe, 0xbb, 0x8e, 0x87, 0x89, 0x89, 0x93, 0xf7, 0xf8, 0x0d, 0x2c, 0x32, 0x41, 0x31, 0x37, 0x3d, 0x40, 0x43, 0x34, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x40, 0x2f, 0x36, 0x7a, 0x80, 0x8c, 0x8a, 0x82, 0x04, 0xed, 0xd7, 0xdb, 0xdc, 0xdc, 0xec, 0x8c, 0x86, 0x89, 0x8c, 0x8e, 0x8c, 0x89, 0x93, 0xf7, 0xe4, 0xe6, 0xe6, 0xae, 0xae, 0xf1, 0xe8, 0xae, 0xfa, 0xfb, 0x63, 0x06, 0x12, 0x5b, 0x4f, 0x50, 0x55, 0x49, 0x50, 0x4f, 0x4f, 0x3e, 0x58, 0x3b, 0x78, 0x7f, 0xf4, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf9, 0xf2, 0xf2, 0xe4, 0xe4, 0xf3, 0x80, 0x75, 0x1e, 0x1f, 0x41, 0x41, 0x4a, 0x46, 0x3f, 0x2c, 0x30, 0x54, 0x5e, 0x7c, 0xf3, 0xe5, 0xf1, 0xf4, 0xf9, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0x81, 0x6c, 0x1e, 0x3c, 0x46, 0x40, 0x3f, 0x37, 0x43, 0x2e, 0x4b, 0x2f, 0x2b, 0x1c, 0x70, 0x7f, 0xf3, 0xf8, 0xf4, 0xf2, 0xf9, 0xf4, 0xf8, 0xf2, 0xe6, 0xf1, 0xe4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe6, 0xf2, 0xe8, 0xf2, 0xfe, 0x7e, 0x5f, 0x16, 0x5a, 0x4b, 0x4b, 0x43, 0x3c, 0x4d, 0x37, 0x41, 0x46, 0x2a, 0x76, 0xff, 0xfa, 0xae, 0xae, 0xae, 0xe6, 0xf1, 0xf4, 0xe4, 0xf6, 0xc6, 0x89, 0x8a, 0x8a, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x88, 0x89, 0x87, 0x87, 0x8a, 0x8c, 0x8a, 0x8e, 0xde, 0xf7, 0xed, 0x0d, 0x49, 0x3d, 0x34, 0x30, 0x3f, 0x3d, 0x43, 0x3d, 0x3d, 0x3d, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x20, 0x60, 0x7f, 0xee, 0x88, 0x8a, 0x8c, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x86, 0x87, 0x8a, 0x8c, 0x8c, 0x8c, 0x88, 0xb3, 0xf0, 0xe3, 0xfb, 0xf2, 0xe8, 0xe8, 0xf2, 0xf4, 0xf4, 0xe8, 0xf2, 0xfb, 0x78, 0x0d, 0x28, 0x4f, 0x5b, 0x49, 0x54, 0x50, 0x4f, 0x4f, 0x50, 0x5a, 0x1e, 0x62, 0x80, 0xf8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe6, 0xf1, 0xf4, 0xfa, 0xf1, 0xe3, 0x85, 0xfe, 0x7f, 0x70, 0x2a, 0x20, 0x3e, 0x23, 0x47, 0x40, 0x38, 0x43, 0x34, 0x2e, 0x18, 0x22, 0x74, 0xfb, 0xf2, 0xf1, 0xf2, 0xf2, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xfe, 0xff, 0x5f, 0x1d, 0x46, 0x40, 0x37, 0x39, 0x37, 0x43, 0x40, 0x46, 0x46, 0x4b, 0x1b, 0x5e, 0x7d, 0x81, 0xf2, 0xf9, 0xf4, 0xf9, 0xf9, 0xf5, 0xf1, 0xf2, 0xe8, 0xe6, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf4, 0xfe, 0x7d, 0x24, 0x16, 0x55, 0x5b, 0x50, 0x49, 0x31, 0x37, 0x4f, 0x2b, 0x68, 0x7e, 0xf3, 0xe7, 0xae, 0xe7, 0xf1, 0xf9, 0xfa, 0xf4, 0xf2, 0xea, 0xea, 0xee, 0x87, 0x8a, 0x8a, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0xaf, 0x8c, 0xde, 0xf7, 0xf0, 0x01, 0x42, 0x2c, 0x41, 0x34, 0x37, 0x3f, 0x3d, 0x40, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x4b, 0x1d, 0x6e, 0x81, 0xef, 0x88, 0x88, 0x8c, 0x8c, 0x8c, 0x8a, 0x8a, 0x8a, 0x8d, 0x8c, 0x8d, 0x8c, 0x88, 0xa4, 0xe1, 0xf6, 0xf3, 0xf2, 0xf9, 0xfa, 0xf2, 0xf2, 0xf5, 0xf4, 0xe5, 0xe9, 0xf5, 0x81, 0x3a, 0x1f, 0x5b, 0x53, 0x54, 0x4d, 0x4f, 0x5b, 0x50, 0x51, 0x26, 0x62, 0x7e, 0xf8, 0x85, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xae, 0xae, 0xf9, 0xfa, 0xe7, 0xe6, 0xe4, 0x7e, 0x6b, 0x20, 0x38, 0x46, 0x34, 0x47, 0x37, 0x3f, 0x40, 0x3d, 0x53, 0x23, 0x33, 0x6e, 0x7e, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xfb, 0xf9, 0x80, 0x7d, 0x5e, 0x25, 0x2f, 0x37, 0x37, 0x41, 0x46, 0x46, 0x40, 0x3f, 0x40, 0x38, 0x25, 0x60, 0x7d, 0x81, 0xf3, 0xf8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xae, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf2, 0xe9, 0xe4, 0xfb, 0x7f, 0x7c, 0x24, 0x19, 0x2b, 0x55, 0x5b, 0x4b, 0x4c, 0x39, 0x2d, 0x7c, 0xe6, 0xae, 0xae, 0xf1, 0xf4, 0xfa, 0xfa, 0xfa, 0xe4, 0xe3, 0xe3, 0xe4, 0xf7, 0xd7, 0xb2, 0x89, 0x89, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8a, 0x89, 0x88, 0xb2, 0xdc, 0xf6, 0xf7, 0xeb, 0x03, 0x58, 0x2f, 0x40, 0x34, 0x37, 0x3d, 0x40, 0x3d, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x34, 0x40, 0x46, 0x2f, 0x28, 0x73, 0x80, 0xde, 0xa4, 0x88, 0x89, 0x8a, 0x8c, 0x8c, 0x8c, 0x8c, 0x8a, 0x8a, 0x8e, 0xc3, 0xe6, 0x85, 0xe3, 0xf2, 0xf9, 0xfa, 0xf1, 0xf2, 0xe7, 0xf2, 0xf2, 0xe3, 0xe8, 0x85, 0x81, 0x74, 0x3b, 0x5b, 0x5b, 0x5b, 0x50, 0x55, 0x49, 0x44, 0x2d, 0x5f, 0x7c, 0xfe, 0xe4, 0xad, 0xe6, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0x7f, 0x6b, 0x21, 0x2f, 0x46, 0x53, 0x41, 0x34, 0x37, 0x43, 0x38, 0x32, 0x3d, 0x1d, 0x69, 0x7b, 0x7f, 0xf9, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf4, 0x80, 0x7d, 0x66, 0x1b, 0x43, 0x41, 0x41, 0x53, 0x4a, 0x37, 0x31, 0x34, 0x4a, 0x38, 0x1f, 0x56, 0x7e, 0xfe, 0xf3, 0xe3, 0xe7, 0xf1, 0xf1, 0xf2, 0xf1, 0xe6, 0xe6, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xe8, 0xe8, 0xae, 0xf8, 0xfe, 0x7e, 0x67, 0x22, 0x16, 0x2a, 0x3c, 0x2a, 0x3b, 0x6c, 0xfe, 0x81, 0x81, 0x80, 0xfe, 0xfa, 0xf9, 0xf5, 0xe4, 0xe9, 0xe3, 0xe4, 0xf8, 0xe4, 0xf7, 0xe7, 0xca, 0x93, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x8a, 0xb2, 0xc3, 0xe3, 0xea, 0xf7, 0xed, 0x84, 0x0c, 0x45, 0x37, 0x41, 0x37, 0x37, 0x38, 0x40, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x40, 0x4a, 0x3c, 0x35, 0x6e, 0x81, 0xf7, 0xd9, 0xbe, 0xb2, 0x8e, 0x8c, 0x8c, 0xb2, 0x93, 0xc3, 0xae, 0xf7, 0xe6, 0xe6, 0xe6, 0xf9, 0xf4, 0xf4, 0xe7, 0xe6, 0xe3, 0xe6, 0xe6, 0xf3, 0x80, 0x78, 0x7f, 0x7e, 0x71, 0x3b, 0x51, 0x45, 0x44, 0x42, 0x2d, 0x3b, 0x6c, 0x7d, 0x80, 0xf8, 0xae, 0xad, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf9, 0xf2, 0xe7, 0xae, 0xf3, 0x7e, 0x6f, 0x1c, 0x3c, 0x41, 0x41, 0x41, 0x3f, 0x40, 0x40, 0x3d, 0x43, 0x2c, 0x1d, 0x65, 0x7e, 0x7f, 0xfa, 0xe8, 0xe7, 0xe4, 0xf2, 0xf9, 0xf9, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xe8, 0xf4, 0xf3, 0x85, 0x7f, 0x60, 0x25, 0x46, 0x4a, 0x46, 0x3d, 0x37, 0x37, 0x3f, 0x30, 0x43, 0x3c, 0x20, 0x60, 0x7e, 0xf8, 0x85, 0xe1, 0xe7, 0xf1, 0xf5, 0xf3, 0xe4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xe7, 0xae, 0xe8, 0xf3, 0xff, 0x80, 0x7d, 0x71, 0x69, 0x65, 0x6b, 0x74, 0x7f, 0x7e, 0x7a, 0x66, 0x62, 0x7c, 0xff, 0xad, 0xe3, 0xad, 0xe7, 0xf9, 0xfa, 0xe4, 0xf1, 0xf1, 0xe8, 0xf6, 0xe8, 0xde, 0xd6, 0xc6, 0xc3, 0xca, 0xdc, 0xe2, 0xf7, 0xe9, 0xf7, 0xc6, 0x84, 0x00, 0x10, 0x4d, 0x38, 0x41, 0x37, 0x37, 0x3d, 0x40, 0x32, 0x34, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x41, 0x4f, 0x2f, 0x35, 0x68, 0x7b, 0x81, 0xf7, 0xfb, 0xf0, 0xde, 0xde, 0xe1, 0xea, 0xf7, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf1, 0xe6, 0xae, 0x85, 0xe6, 0xfe, 0x7e, 0x6b, 0x1a, 0x62, 0x7c, 0x7f, 0x72, 0x5d, 0x62, 0x62, 0x67, 0x71, 0x7c, 0xff, 0xfe, 0xf1, 0xf1, 0xe6, 0xae, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf9, 0xfb, 0xe6, 0x85, 0x7f, 0x6f, 0x2a, 0x2f, 0x3f, 0x34, 0x31, 0x3e, 0x30, 0x40, 0x40, 0x38, 0x3f, 0x1f, 0x5e, 0x7c, 0xf3, 0xe6, 0xe6, 0xe5, 0xae, 0xe6, 0xe6, 0xf4, 0xfa, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf2, 0xf3, 0xe7, 0xad, 0x85, 0x7c, 0x58, 0x2f, 0x38, 0x2e, 0x3f, 0x41, 0x4a, 0x41, 0x3e, 0x39, 0x2c, 0x43, 0x1d, 0x6b, 0x7d, 0xf3, 0xad, 0xe7, 0xe7, 0xf2, 0xf8, 0xe6, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf9, 0xf2, 0xf1, 0xe7, 0xe3, 0xe8, 0xf8, 0xf1, 0xf3, 0x81, 0x7f, 0x7e, 0xfe, 0xfb, 0xfa, 0x6b, 0x26, 0x20, 0x1c, 0x57, 0x7d, 0xfe, 0xad, 0xe2, 0xf1, 0xff, 0xff, 0xf8, 0xe4, 0xe4, 0xf1, 0xf2, 0xe8, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xea, 0xea, 0xae, 0xea, 0xde, 0x83, 0x84, 0x02, 0x1c, 0x3c, 0x4a, 0x32, 0x37, 0x2e, 0x38, 0x40, 0x3d, 0x34, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x34, 0x47, 0x3d, 0x32, 0x4f, 0x43, 0x2a, 0x5c, 0x6f, 0x7a, 0x7f, 0xfb, 0xfb, 0xf6, 0xea, 0xe4, 0xe6, 0xf4, 0xf3, 0xf4, 0xf8, 0xf4, 0xf2, 0xe7, 0xe6, 0xe3, 0x85, 0xfe, 0x7f, 0x7c, 0x66, 0x18, 0x2a, 0x1e, 0x3a, 0x77, 0x81, 0x85, 0xf8, 0xfe, 0x7e, 0x80, 0x81, 0xf3, 0xf1, 0xe8, 0xe8, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xfb, 0xf8, 0xf3, 0x7f, 0x75, 0x33, 0x2f, 0x38, 0x4a, 0x37, 0x31, 0x3e, 0x3e, 0x3d, 0x4a, 0x47, 0x20, 0x2d, 0x7b, 0xfe, 0xad, 0xae, 0xe7, 0xe7, 0xe7, 0xe6, 0xf2, 0xf9, 0xfa, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe6, 0xf2, 0xe7, 0xe7, 0xe6, 0xfe, 0x78, 0x1c, 0x2b, 0x3e, 0x3f, 0x4a, 0x53, 0x46, 0x32, 0x3e, 0x37, 0x41, 0x43, 0x1c, 0x6e, 0x7f, 0xf8, 0xae, 0xf1, 0xf1, 0xf1, 0xe6, 0xe4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe6, 0xf1, 0xf4, 0xf9, 0xf4, 0xe7, 0xae, 0xe8, 0xf1, 0xf4, 0xe8, 0xae, 0x85, 0xf2, 0xf4, 0xe3, 0xf6, 0x6a, 0x16, 0x23, 0x23, 0x1f, 0x48, 0x7a, 0x80, 0xe6, 0xe4, 0xf5, 0xf9, 0xe8, 0xf1, 0xe4, 0xf1, 0xf1, 0xf1, 0xf1, 0xe4, 0xf5, 0xe4, 0xf9, 0xf1, 0xf1, 0xe8, 0xf3, 0xb6, 0x84, 0x84, 0x04, 0x51, 0x2e, 0x4a, 0x32, 0x37, 0x2e, 0x40, 0x40, 0x34, 0x34, 0x3d, 0x40, 0x3d, 0x3f, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x47, 0x40, 0x40, 0x40, 0x43, 0x55, 0x28, 0x1e, 0x73, 0x80, 0xfb, 0xf8, 0x85, 0xe8, 0xe6, 0xe4, 0xf2, 0xf4, 0xf2, 0xf2, 0xe8, 0xe7, 0xe7, 0xe6, 0xfe, 0x7d, 0x7a, 0x57, 0x1f, 0x4d, 0x3c, 0x16, 0x5d, 0x80, 0xf1, 0xf9, 0x85, 0xf8, 0xf4, 0xf2, 0xe4, 0xe4, 0xae, 0xe8, 0xf1, 0xf2, 0xf9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xe7, 0xe4, 0x80, 0x7a, 0x36, 0x2b, 0x46, 0x4a, 0x4f, 0x32, 0x40, 0x3f, 0x3f, 0x37, 0x3f, 0x30, 0x21, 0x70, 0x81, 0xe6, 0xae, 0xe9, 0xf5, 0xf5, 0xf1, 0xf1, 0xe6, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xe7, 0xf5, 0xf5, 0xf2, 0xf3, 0x80, 0x66, 0x1f, 0x2c, 0x40, 0x46, 0x46, 0x46, 0x46, 0x40, 0x34, 0x34, 0x32, 0x3c, 0x1c, 0x7a, 0x80, 0xe8, 0xe7, 0xf4, 0xe4, 0xe6, 0xe4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xae, 0xf1, 0xf4, 0xf9, 0xf2, 0xf1, 0xe7, 0xe6, 0xf2, 0xf9, 0xf4, 0xad, 0xae, 0xf1, 0xf5, 0xe5, 0x85, 0xfe, 0x62, 0x18, 0x34, 0x2f, 0x25, 0x58, 0x7a, 0x7f, 0xe4, 0xe3, 0xe6, 0xae, 0xf3, 0xe4, 0xf2, 0xf2, 0xf4, 0xf8, 0xf5, 0xf9, 0xf9, 0xf8, 0xf4, 0xe4, 0xf7, 0xef, 0x84, 0x82, 0x84, 0x0c, 0x45, 0x3d, 0x41, 0x41, 0x2e, 0x37, 0x38, 0x40, 0x3d, 0x34, 0x3d, 0x3f, 0x3d, 0x3d, 0x3f, 0x32, 0x3d, 0x3d, 0x3f, 0x4a, 0x38, 0x4c, 0x3f, 0x40, 0x40, 0x3d, 0x3c, 0x35, 0x57, 0x7f, 0xfe, 0xe4, 0xf2, 0xae, 0xae, 0x85, 0xf3, 0xf2, 0xf2, 0xf1, 0xe8, 0xe7, 0xe6, 0xf3, 0x7f, 0x79, 0x57, 0x2a, 0x4c, 0x37, 0x1f, 0x4e, 0x7e, 0xfe, 0xfa, 0xfa, 0xff, 0xf5, 0xf1, 0xf5, 0xe8, 0xe5, 0xe8, 0xe4, 0xf2, 0xf3, 0xf5, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xae, 0x85, 0x7c, 0x60, 0x20, 0x43, 0x3d, 0x4a, 0x38, 0x46, 0x46, 0x46, 0x43, 0x40, 0x31, 0x1d, 0x60, 0x7c, 0xf2, 0xe7, 0xea, 0xfa, 0xfa, 0xfa, 0xf4, 0xf2, 0xae, 0xe8, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf1, 0xf2, 0xf2, 0xe6, 0xe6, 0xad, 0xe6, 0xf3, 0xf3, 0xf4, 0xf2, 0xe7, 0xe5, 0xe4, 0xf7, 0xfe, 0x7e, 0x5d, 0x27, 0x40, 0x53, 0x41, 0x34, 0x3f, 0x3d, 0x4a, 0x41, 0x34, 0x3f, 0x2c, 0x3b, 0x7c, 0xf3, 0xe9, 0xfa, 0xf5, 0xad, 0xe6, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xe4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0x81, 0x67, 0x1c, 0x2f, 0x46, 0x38, 0x44, 0x75, 0x80, 0xae, 0xe3, 0xad, 0xe4, 0xfe, 0x80, 0xe4, 0xad, 0xe3, 0xe7, 0xfa, 0xf9, 0xe7, 0xf8, 0xf1, 0x81, 0x0b, 0x84, 0x87, 0x83, 0x16, 0x4b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x34, 0x3d, 0x32, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x1d, 0x6f, 0x80, 0xe3, 0xe9, 0xf5, 0xae, 0x85, 0xe8, 0xe5, 0xf2, 0xf4, 0xea, 0xf1, 0xfe, 0x7e, 0x75, 0x29, 0x2b, 0x46, 0x4f, 0x20, 0x4e, 0x7f, 0xf8, 0xf9, 0xf5, 0xf9, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xe8, 0xf8, 0xf3, 0xe4, 0xf4, 0xf1, 0xf1, 0xf2, 0xf3, 0x7f, 0x68, 0x20, 0x43, 0x3f, 0x3d, 0x37, 0x3f, 0x43, 0x43, 0x46, 0x4a, 0x41, 0x2b, 0x3b, 0x7c, 0xfe, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xe8, 0xe6, 0xae, 0xae, 0xe8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf8, 0xf4, 0xf8, 0xf2, 0xe6, 0xe6, 0xe6, 0xf3, 0xf3, 0xfe, 0xe8, 0xe6, 0xe7, 0xe8, 0xf3, 0xff, 0x80, 0x78, 0x21, 0x3f, 0x41, 0x4a, 0x37, 0x37, 0x40, 0x4a, 0x41, 0x34, 0x40, 0x37, 0x21, 0x62, 0x7f, 0xfa, 0xf9, 0xfa, 0xad, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xfb, 0x7e, 0x66, 0x1b, 0x43, 0x40, 0x27, 0x42, 0x78, 0x80, 0xe4, 0xe6, 0xf8, 0xff, 0xf9, 0xf2, 0xae, 0xad, 0xe3, 0xe7, 0xe7, 0xe4, 0xf3, 0xe6, 0xfd, 0x82, 0x87, 0x87, 0x02, 0x54, 0x40, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x40, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x3d, 0x34, 0x3d, 0x47, 0x2f, 0x5c, 0x7e, 0xe9, 0xf5, 0xf9, 0x85, 0x85, 0xfe, 0xe7, 0xe7, 0xea, 0xe4, 0xf8, 0x7f, 0x75, 0x2d, 0x45, 0x3e, 0x4b, 0x25, 0x57, 0x7b, 0x80, 0xf1, 0xf2, 0xf9, 0xf4, 0xe6, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xe4, 0xf3, 0xf1, 0xf1, 0xf1, 0xea, 0xf3, 0x7f, 0x79, 0x1e, 0x2b, 0x40, 0x4a, 0x34, 0x3f, 0x43, 0x43, 0x38, 0x40, 0x4a, 0x47, 0x1f, 0x6b, 0x80, 0xf3, 0xf5, 0xf5, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xe8, 0xe8, 0xe8, 0xe8, 0xf4, 0xf2, 0xf2, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf9, 0xf4, 0xfa, 0xf2, 0xf2, 0xe8, 0xf2, 0xf2, 0xf3, 0xf2, 0xe8, 0xf1, 0xe7, 0xf4, 0xf4, 0xfe, 0xff, 0x7f, 0x60, 0x27, 0x2e, 0x4a, 0x3f, 0x3f, 0x40, 0x4a, 0x34, 0x41, 0x46, 0x32, 0x2b, 0x1c, 0x75, 0x7e, 0xf9, 0xf5, 0xf2, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xff, 0x7f, 0x6b, 0x19, 0x39, 0x3e, 0x2c, 0x48, 0x76, 0x80, 0xf9, 0xf9, 0xf4, 0xf9, 0xf2, 0xe8, 0xe6, 0xad, 0xad, 0xe6, 0xf9, 0xe4, 0xf7, 0xbb, 0x84, 0x87, 0x84, 0x06, 0x55, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x47, 0x3f, 0x21, 0x75, 0x81, 0xff, 0xfb, 0xf8, 0xf3, 0xfe, 0xf9, 0xe9, 0xe5, 0xe6, 0x80, 0x75, 0x33, 0x3c, 0x4b, 0x3e, 0x28, 0x5e, 0x7b, 0x7f, 0xe4, 0xe6, 0xe7, 0xfa, 0xf9, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xe4, 0xe8, 0xe7, 0xe7, 0xf8, 0xfe, 0x7b, 0x57, 0x20, 0x4b, 0x4a, 0x41, 0x41, 0x40, 0x40, 0x46, 0x43, 0x40, 0x40, 0x2b, 0x48, 0x7c, 0xfe, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf2, 0xf5, 0xfa, 0xfa, 0xf4, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf9, 0xf4, 0xf8, 0xf4, 0xf8, 0xf4, 0xf4, 0xf2, 0xe8, 0xe8, 0xe6, 0xe6, 0xf5, 0xf2, 0xf5, 0xf9, 0xfa, 0xf3, 0x81, 0x79, 0x29, 0x3c, 0x3d, 0x40, 0x3f, 0x46, 0x4a, 0x3f, 0x34, 0x46, 0x40, 0x3f, 0x25, 0x48, 0x7b, 0xf3, 0xf1, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf8, 0x81, 0x6c, 0x22, 0x2e, 0x43, 0x3c, 0x33, 0x73, 0x7f, 0xfe, 0xe3, 0xe8, 0xe5, 0xf4, 0xf8, 0xfe, 0xad, 0xf8, 0xf1, 0x85, 0xe1, 0xaf, 0x84, 0x82, 0x00, 0x0d, 0x5b, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x40, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x40, 0x32, 0x3d, 0x40, 0x4c, 0x27, 0x66, 0x7e, 0xff, 0xf4, 0x85, 0xf3, 0xfe, 0xfa, 0xe7, 0xf2, 0x80, 0x75, 0x36, 0x3c, 0x4f, 0x4b, 0x28, 0x60, 0x7c, 0x80, 0x85, 0xad, 0xe5, 0xf1, 0xf4, 0xfa, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xe8, 0xe3, 0xe7, 0xf1, 0xfe, 0xfe, 0x6d, 0x1b, 0x50, 0x40, 0x4a, 0x41, 0x41, 0x40, 0x46, 0x46, 0x43, 0x40, 0x3c, 0x1f, 0x6f, 0x7f, 0xf2, 0xf4, 0xe4, 0xea, 0xf2, 0xe8, 0xf2, 0xf2, 0xf4, 0xf4, 0xf5, 0xf5, 0xfa, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xe8, 0xf1, 0xf2, 0xf4, 0xf4, 0xe7, 0xe7, 0xae, 0xe6, 0xe8, 0xf4, 0xf5, 0xf5, 0xf9, 0xf1, 0xea, 0xe4, 0x7e, 0x5e, 0x20, 0x40, 0x4f, 0x3d, 0x40, 0x4a, 0x34, 0x3f, 0x40, 0x46, 0x32, 0x4f, 0x1d, 0x6b, 0x81, 0xae, 0xf5, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf1, 0xe8, 0xad, 0x80, 0x79, 0x36, 0x23, 0x50, 0x37, 0x33, 0x6f, 0x7f, 0xf3, 0xad, 0xe3, 0xf1, 0xfa, 0xff, 0xfe, 0xfe, 0xf1, 0xf7, 0xca, 0x84, 0x87, 0x82, 0x02, 0x2d, 0x38, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3f, 0x3d, 0x3d, 0x3d, 0x4f, 0x2c, 0x29, 0x7c, 0x80, 0xae, 0xe6, 0xad, 0xe6, 0xf3, 0xfe, 0x7f, 0x73, 0x42, 0x39, 0x4f, 0x4c, 0x2a, 0x5e, 0x7c, 0xfe, 0xe4, 0xe3, 0xe5, 0xe3, 0xf5, 0xf9, 0xf3, 0xf2, 0xe6, 0xf8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xe8, 0xe3, 0xe7, 0xf1, 0x7f, 0x7b, 0x21, 0x4b, 0x32, 0x46, 0x4a, 0x41, 0x3f, 0x3d, 0x40, 0x40, 0x3f, 0x47, 0x3c, 0x2d, 0x7c, 0xfe, 0xea, 0xf1, 0xe8, 0xf3, 0xf4, 0xf2, 0xf2, 0xe7, 0xe7, 0xe8, 0xf2, 0xe7, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xe6, 0xae, 0xe6, 0xe4, 0xf4, 0xf4, 0xf1, 0xe3, 0xae, 0xe6, 0xf1, 0xf1, 0xf4, 0xf9, 0xf5, 0xf1, 0xe5, 0xe6, 0x81, 0x6b, 0x2a, 0x38, 0x32, 0x3d, 0x46, 0x40, 0x3f, 0x32, 0x40, 0x3d, 0x4a, 0x46, 0x2c, 0x22, 0x7e, 0xf3, 0xe9, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xe8, 0xf3, 0xfe, 0x7a, 0x57, 0x27, 0x4c, 0x37, 0x2b, 0x60, 0x7c, 0xf3, 0xe4, 0xe4, 0xf9, 0xf1, 0xf9, 0xfa, 0xf2, 0xf7, 0x93, 0x84, 0x82, 0x82, 0x06, 0x45, 0x38, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x40, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x4c, 0x20, 0x79, 0xf8, 0xae, 0xe3, 0xe6, 0xe6, 0xfb, 0x7d, 0x6e, 0x28, 0x3c, 0x4f, 0x49, 0x29, 0x6b, 0x7e, 0xff, 0xfa, 0xe7, 0xf1, 0xe7, 0xf1, 0xf1, 0xf4, 0xf2, 0xe4, 0xe6, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf8, 0xf4, 0xae, 0xe7, 0xe3, 0xfe, 0x7c, 0x62, 0x27, 0x3d, 0x40, 0x40, 0x34, 0x47, 0x3e, 0x3f, 0x43, 0x40, 0x3f, 0x43, 0x2b, 0x65, 0x80, 0xe8, 0xe7, 0xf4, 0xe6, 0xe6, 0xfa, 0xf3, 0xe8, 0xe6, 0xe6, 0xae, 0xe8, 0xe3, 0xe8, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xe8, 0xae, 0xae, 0xae, 0xea, 0xfe, 0xf9, 0xfb, 0xad, 0xae, 0xe6, 0xf1, 0xf2, 0xf9, 0xf1, 0xf1, 0xf2, 0xe7, 0xae, 0x81, 0x75, 0x20, 0x43, 0x40, 0x3d, 0x3d, 0x40, 0x3d, 0x3f, 0x3f, 0x3d, 0x40, 0x46, 0x32, 0x1c, 0x6c, 0xfe, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xfe, 0xf3, 0xf4, 0xe7, 0xf5, 0xfa, 0x7b, 0x57, 0x1d, 0x4f, 0x46, 0x3c, 0x5e, 0x79, 0x80, 0xfe, 0xae, 0xe8, 0xe3, 0xf1, 0xf7, 0xf0, 0x8c, 0x84, 0x89, 0x82, 0x0a, 0x5a, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x4f, 0x1d, 0x69, 0xfe, 0xe6, 0xe7, 0xf8, 0x81, 0x7f, 0x66, 0x21, 0x50, 0x4f, 0x50, 0x26, 0x6c, 0x7f, 0xf8, 0xf5, 0xf1, 0xfa, 0xf1, 0xf5, 0xf5, 0xf9, 0xf2, 0xe8, 0xe6, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf1, 0xe3, 0xe8, 0x7f, 0x75, 0x26, 0x3e, 0x40, 0x40, 0x3f, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x47, 0x40, 0x27, 0x6f, 0x80, 0xae, 0xf5, 0xfa, 0xe6, 0xe6, 0xfa, 0xf4, 0xf1, 0xe6, 0xae, 0xae, 0xe6, 0xe6, 0xf3, 0xe8, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xe8, 0xae, 0xe6, 0xf9, 0x74, 0x7e, 0xff, 0xe4, 0xe6, 0xf2, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0x80, 0x75, 0x20, 0x46, 0x41, 0x37, 0x3d, 0x40, 0x40, 0x32, 0x3f, 0x3d, 0x46, 0x46, 0x3f, 0x23, 0x2d, 0x7b, 0x85, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf8, 0xfb, 0xf9, 0xe9, 0xe5, 0xe8, 0x81, 0x7c, 0x69, 0x1f, 0x4f, 0x4f, 0x25, 0x44, 0x69, 0x7c, 0x80, 0xe4, 0xae, 0xf4, 0xf7, 0xca, 0x84, 0x83, 0x83, 0x00, 0x16, 0x4b, 0x34, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3f, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3f, 0x3d, 0x3f, 0x3d, 0x32, 0x4f, 0x2f, 0x4e, 0x7e, 0xf6, 0xff, 0x7d, 0x73, 0x4e, 0x28, 0x4d, 0x50, 0x35, 0x42, 0x75, 0x80, 0xe4, 0xe9, 0xe5, 0xf4, 0xf9, 0xfa, 0xf9, 0xf3, 0xf1, 0xe8, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe4, 0xe8, 0xf8, 0xf4, 0xf2, 0xae, 0xf3, 0x7d, 0x60, 0x1d, 0x40, 0x3d, 0x3f, 0x3f, 0x3f, 0x43, 0x3d, 0x43, 0x37, 0x37, 0x3f, 0x40, 0x1d, 0x76, 0xf3, 0xe7, 0xfa, 0xff, 0xe8, 0xae, 0xf4, 0xf2, 0xe6, 0xf2, 0xf3, 0xfe, 0xf8, 0x7f, 0xff, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xfa, 0xf4, 0xe6, 0xf3, 0x7f, 0x3a, 0xfc, 0x7e, 0xf3, 0xfe, 0xf1, 0xf1, 0xe6, 0xae, 0xae, 0xe6, 0xf1, 0xf3, 0xf3, 0x81, 0x6f, 0x20, 0x46, 0x41, 0x37, 0x3f, 0x3d, 0x46, 0x3d, 0x34, 0x46, 0x46, 0x38, 0x40, 0x3d, 0x20, 0x73, 0x81, 0xae, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf2, 0xf4, 0xe8, 0xae, 0xe6, 0xf8, 0x7f, 0x7d, 0x69, 0x28, 0x2b, 0x50, 0x4b, 0x35, 0x5e, 0x75, 0x80, 0xfe, 0xfb, 0xf7, 0xa4, 0x82, 0x82, 0x83, 0x02, 0x26, 0x3e, 0x2e, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3f, 0x32, 0x3f, 0x32, 0x3d, 0x34, 0x3d, 0x3d, 0x3d, 0x34, 0x3d, 0x32, 0x34, 0x34, 0x4f, 0x2d, 0x78, 0x81, 0x7c, 0x6e, 0x26, 0x2b, 0x4f, 0x4f, 0x35, 0x58, 0x75, 0x7f, 0xf3, 0x85, 0xe1, 0xf3, 0xe8, 0xf3, 0xf8, 0xf3, 0xf8, 0xe6, 0xe4, 0xf3, 0xf9, 0xf9, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe8, 0xe6, 0xf2, 0xfa, 0xf1, 0xe8, 0xfe, 0x7b, 0x36, 0x3f, 0x41, 0x3f, 0x3f, 0x37, 0x43, 0x3d, 0x46, 0x3d, 0x3d, 0x37, 0x32, 0x46, 0x25, 0x6f, 0x81, 0xad, 0xff, 0xff, 0xf1, 0xae, 0xe8, 0xe8, 0xf2, 0xf3, 0x81, 0xff, 0x7f, 0x5d, 0x3a, 0xfa, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf9, 0xf4, 0xf9, 0xe8, 0xf3, 0x80, 0x5d, 0x15, 0x24, 0x75, 0x7f, 0xfa, 0xff, 0xf9, 0xea, 0xe6, 0xe6, 0xe4, 0xf4, 0xff, 0x7d, 0x57, 0x27, 0x3f, 0x41, 0x37, 0x3d, 0x40, 0x3d, 0x3f, 0x34, 0x40, 0x46, 0x40, 0x38, 0x53, 0x23, 0x5e, 0xfe, 0xfe, 0xf9, 0xf4, 0xfa, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf9, 0xf1, 0xe8, 0xf1, 0xe4, 0xe4, 0xe6, 0xe6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf8, 0xf4, 0xf4, 0xf4, 0xfe, 0xf4, 0xe7, 0xe7, 0xe6, 0xe6, 0xf3, 0x85, 0xf3, 0xfa, 0xf5, 0x80, 0x6c, 0x2d, 0x2b, 0x4f, 0x43, 0x27, 0x2d, 0x69, 0x7b, 0xff, 0xf7, 0xb0, 0x82, 0x00, 0x82, 0x06, 0x51, 0x2e, 0x30, 0x34, 0x32, 0x3d, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x40, 0x40, 0x3f, 0x3f, 0x43, 0x40, 0x43, 0x40, 0x46, 0x40, 0x46, 0x40, 0x2e, 0x43, 0x26, 0x75, 0x7b, 0x56, 0x1b, 0x3c, 0x4a, 0x3c, 0x27, 0x65, 0x7b, 0x7f, 0xfe, 0xf4, 0xf9, 0xfb, 0xf2, 0xae, 0xae, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xf9, 0xf5, 0xf9, 0xe6, 0xf2, 0xe8, 0xe8, 0xe8, 0xf3, 0xf3, 0xf2, 0xf1, 0xe4, 0xf9, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf4, 0xf1, 0xe7, 0xe7, 0xf9, 0xf9, 0xf5, 0xf3, 0x80, 0x66, 0x1f, 0x32, 0x41, 0x40, 0x3d, 0x43, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3f, 0x3f, 0x47, 0x25, 0x4e, 0x78, 0x80, 0xff, 0xff, 0xe7, 0xad, 0xe6, 0xe8, 0xf3, 0x81, 0x80, 0x75, 0x24, 0x11, 0x3a, 0x80, 0xe8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe8, 0xf1, 0xf2, 0xe6, 0xad, 0xfe, 0x70, 0x1c, 0x45, 0x1c, 0x3b, 0x6c, 0x78, 0x7d, 0x7e, 0xff, 0x80, 0x80, 0x7f, 0x7c, 0x64, 0x1d, 0x49, 0x43, 0x3f, 0x40, 0x40, 0x40, 0x43, 0x3f, 0x3f, 0x40, 0x40, 0x40, 0x41, 0x46, 0x43, 0x2d, 0x7b, 0xff, 0xfe, 0xfa, 0xff, 0xe3, 0xe4, 0xfa, 0xe8, 0xe8, 0xfa, 0xf3, 0xf2, 0xe9, 0xe7, 0xe5, 0xe6, 0xe4, 0xf3, 0xf2, 0xf9, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf8, 0xf8, 0xfe, 0xf8, 0xf3, 0xe6, 0xe8, 0xe6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0x7f, 0x7a, 0x57, 0x27, 0x4c, 0x4c, 0x39, 0x26, 0x5e, 0x7e, 0x81, 0x00, 0x82, 0xaf, 0x83, 0x0a, 0x49, 0x34, 0x34, 0x23, 0x32, 0x32, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x4a, 0x3d, 0x3f, 0x3d, 0x3f, 0x32, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x32, 0x32, 0x3d, 0x3d, 0x38, 0x3d, 0x38, 0x38, 0x32, 0x2e, 0x50, 0x44, 0x6e, 0x60, 0x21, 0x2c, 0x3f, 0x2f, 0x48, 0x69, 0x7d, 0x7f, 0xf8, 0xf3, 0xfa, 0xfa, 0xfa, 0xf5, 0xe4, 0xe6, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xe7, 0xf1, 0xf2, 0xf3, 0xf3, 0xe8, 0xe6, 0xe6, 0xf3, 0xfb, 0xf4, 0xe7, 0xf1, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xe9, 0xf2, 0xe5, 0xe5, 0xf4, 0xfe, 0xf5, 0xfa, 0x7c, 0x4e, 0x31, 0x38, 0x4a, 0x3d, 0x40, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x37, 0x3e, 0x39, 0x28, 0x48, 0x73, 0x7a, 0x7f, 0x80, 0xfe, 0x7f, 0x7f, 0xff, 0x74, 0x5d, 0x29, 0x1f, 0x1e, 0x67, 0xf6, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe4, 0xe8, 0xf2, 0xf1, 0xe6, 0xf3, 0x78, 0x1e, 0x44, 0x59, 0x29, 0x19, 0x19, 0x19, 0x56, 0x5f, 0x62, 0x60, 0x3b, 0x1e, 0x13, 0x27, 0x50, 0x3e, 0x43, 0x40, 0x40, 0x40, 0x3f, 0x34, 0x3f, 0x40, 0x40, 0x3f, 0x3d, 0x4a, 0x43, 0x21, 0x6b, 0x81, 0xe7, 0xae, 0xf2, 0xad, 0xad, 0xf3, 0xae, 0xad, 0xf1, 0xfe, 0xf4, 0xf1, 0xf5, 0xf1, 0xf4, 0xf8, 0xfa, 0xfa, 0xf5, 0xf2, 0xf1, 0xe8, 0xe6, 0xae, 0xad, 0xad, 0xad, 0xad, 0xf3, 0xfa, 0xfe, 0xfa, 0xf4, 0xfa, 0xf3, 0xfa, 0xf3, 0xf1, 0xe6, 0xfb, 0x7b, 0x6e, 0x36, 0x27, 0x49, 0x55, 0x1d, 0x78, 0xdc, 0x84, 0x86, 0x89, 0x00, 0x12, 0x4b, 0x4a, 0x41, 0x40, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0x37, 0x32, 0x2e, 0x2e, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2e, 0x37, 0x37, 0x3f, 0x3d, 0x3d, 0x3d, 0x37, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x34, 0x2c, 0x51, 0x6d, 0x64, 0x1d, 0x4b, 0x25, 0x42, 0x75, 0x7f, 0xfe, 0x85, 0xae, 0xae, 0xe8, 0xe8, 0xe6, 0xe7, 0xfe, 0xf9, 0xf4, 0xf9, 0xf2, 0xf2, 0xf2, 0xf1, 0xe8, 0xf2, 0xfa, 0xfa, 0xf5, 0xf5, 0xf1, 0xf3, 0xf9, 0xf5, 0xf2, 0xe8, 0xae, 0xae, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xae, 0xe7, 0xe9, 0xf3, 0xf3, 0xe8, 0xfb, 0x75, 0x21, 0x23, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x4a, 0x4a, 0x4f, 0x43, 0x2b, 0x18, 0x1e, 0x15, 0x1a, 0x1a, 0x1a, 0x15, 0x12, 0x15, 0x1c, 0x49, 0x49, 0x26, 0x78, 0xfe, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xe6, 0xf9, 0xfa, 0xe8, 0xe6, 0x7f, 0x5f, 0x26, 0x49, 0x59, 0x49, 0x54, 0x35, 0x18, 0x18, 0x13, 0x18, 0x1d, 0x23, 0x39, 0x5a, 0x4b, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x43, 0x43, 0x40, 0x40, 0x40, 0x3f, 0x41, 0x41, 0x46, 0x2b, 0x5e, 0x80, 0xae, 0xae, 0x80, 0xfe, 0x80, 0x7f, 0x7f, 0xf3, 0x80, 0xf8, 0xf3, 0xf2, 0xe8, 0xf1, 0xf3, 0xf3, 0xf1, 0xe5, 0xf1, 0xf4, 0xf4, 0xf8, 0xf2, 0xf2, 0xf1, 0xe8, 0xf1, 0xae, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xe8, 0xe6, 0xe6, 0xae, 0xae, 0xe5, 0xe3, 0xf4, 0x7f, 0x7a, 0x68, 0x29, 0x45, 0x3c, 0x73, 0xec, 0x82, 0x89, 0x83, 0x03, 0x2a, 0x2f, 0x38, 0x23, 0x2b, 0x25, 0x2b, 0x27, 0x27, 0x28, 0x28, 0x28, 0x36, 0x28, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x28, 0x35, 0x27, 0x27, 0x25, 0x2c, 0x2c, 0x2e, 0x32, 0x34, 0x34, 0x41, 0x41, 0x34, 0x2e, 0x45, 0x61, 0x61, 0x1b, 0x20, 0x65, 0x7e, 0x81, 0xf8, 0xe4, 0xae, 0xae, 0xe7, 0xe6, 0xe8, 0xad, 0xae, 0xf2, 0xf2, 0xf9, 0xf3, 0xf2, 0xf9, 0xf4, 0xf9, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf1, 0xe7, 0xe4, 0xf2, 0xfa, 0xf8, 0xf3, 0x80, 0x81, 0xff, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0xff, 0xfe, 0xfe, 0xf3, 0xff, 0x66, 0x1f, 0x3f, 0x38, 0x32, 0x3f, 0x34, 0x34, 0x3f, 0x3f, 0x3f, 0x34, 0x3f, 0x3d, 0x4a, 0x46, 0x40, 0x46, 0x4f, 0x4b, 0x3c, 0x49, 0x45, 0x44, 0x45, 0x54, 0x61, 0x5b, 0x5a, 0x5b, 0x39, 0x60, 0x7c, 0xfe, 0xe8, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xe4, 0xe6, 0xfa, 0xfa, 0xf1, 0xe7, 0x81, 0x71, 0x1e, 0x4d, 0x4d, 0x4d, 0x55, 0x5b, 0x5b, 0x5a, 0x5a, 0x50, 0x5b, 0x5b, 0x5b, 0x50, 0x3c, 0x43, 0x43, 0x40, 0x40, 0x43, 0x3f, 0x43, 0x40, 0x46, 0x40, 0x37, 0x3f, 0x41, 0x4a, 0x37, 0x44, 0x7a, 0x81, 0x7e, 0x73, 0x73, 0x70, 0x6f, 0x6f, 0x75, 0x75, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x80, 0xfe, 0xe6, 0xae, 0xe3, 0xf3, 0xf8, 0xf4, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf4, 0xf1, 0xf2, 0xe8, 0xe8, 0xe8, 0xe8, 0xae, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xf8, 0x80, 0x7d, 0x79, 0x5e, 0x21, 0x70, 0x06, 0x82, 0x89, 0x84, 0x03, 0x22, 0x2a, 0x44, 0x48, 0x5f, 0x65, 0x6b, 0x6f, 0x73, 0x73, 0x79, 0x75, 0x7a, 0x7a, 0x7a, 0x78, 0x7a, 0x7a, 0x78, 0x79, 0x75, 0x75, 0x75, 0x70, 0x6f, 0x66, 0x5e, 0x48, 0x33, 0x27, 0x2f, 0x23, 0x23, 0x2c, 0x2f, 0x4b, 0x61, 0x58, 0x1a, 0x73, 0x7f, 0xe3, 0xe4, 0xe9, 0xea, 0xe5, 0xe7, 0xf2, 0xf4, 0xf3, 0xf3, 0xe6, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xe7, 0xe7, 0xf4, 0xf5, 0xf4, 0xae, 0xe6, 0xfb, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x79, 0x6f, 0x6f, 0x6f, 0x6f, 0x73, 0x79, 0x7b, 0x7f, 0x80, 0x7c, 0x57, 0x23, 0x3d, 0x32, 0x3d, 0x34, 0x3d, 0x3f, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x41, 0x4f, 0x41, 0x4f, 0x40, 0x47, 0x4c, 0x5b, 0x5b, 0x5a, 0x5b, 0x5b, 0x4f, 0x5b, 0x5b, 0x4d, 0x29, 0x70, 0x80, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe6, 0xf8, 0xfa, 0xf5, 0xe5, 0xae, 0x80, 0x62, 0x27, 0x55, 0x55, 0x55, 0x5b, 0x50, 0x55, 0x55, 0x54, 0x50, 0x50, 0x50, 0x50, 0x4c, 0x4f, 0x3d, 0x40, 0x40, 0x43, 0x3d, 0x43, 0x40, 0x46, 0x38, 0x3f, 0x3e, 0x41, 0x4a, 0x40, 0x25, 0x68, 0x7d, 0x62, 0x1b, 0x1b, 0x1d, 0x20, 0x25, 0x1f, 0x21, 0x1e, 0x2d, 0x4e, 0x65, 0x68, 0x6f, 0x76, 0x7d, 0xfe, 0x85, 0xf3, 0x85, 0xf8, 0xfe, 0xfa, 0xfa, 0xf9, 0xf9, 0xf5, 0xf1, 0xf5, 0xf2, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xfa, 0xf9, 0xfa, 0xf5, 0xf1, 0xe9, 0xf1, 0xf9, 0x7f, 0x7f, 0x78, 0x63, 0xaf, 0x84, 0xaf, 0x07, 0xca, 0x75, 0x78, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x75, 0x79, 0x79, 0x79, 0x79, 0x75, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7b, 0x7a, 0x73, 0x6b, 0x5f, 0x48, 0x2a, 0x33, 0x3b, 0x7a, 0x7e, 0x80, 0xe4, 0xe3, 0xe6, 0xf4, 0xf9, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf2, 0xf2, 0xe9, 0xf1, 0xf1, 0xe7, 0xe8, 0xae, 0xe6, 0xe6, 0xae, 0xf2, 0xfe, 0xfe, 0x7f, 0x7e, 0x7e, 0x81, 0xfe, 0x71, 0x66, 0x5c, 0x44, 0x33, 0x1b, 0x1b, 0x20, 0x1d, 0x1d, 0x1d, 0x20, 0x1b, 0x1e, 0x3b, 0x67, 0x79, 0x44, 0x2f, 0x41, 0x34, 0x3f, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x3d, 0x3e, 0x37, 0x37, 0x4c, 0x3f, 0x3e, 0x50, 0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x4d, 0x36, 0x5f, 0x80, 0xe4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xe4, 0xf3, 0xf4, 0xf9, 0xf5, 0xe7, 0xae, 0x81, 0x78, 0x2d, 0x35, 0x4d, 0x55, 0x50, 0x50, 0x55, 0x49, 0x54, 0x49, 0x4d, 0x4d, 0x4b, 0x4b, 0x4b, 0x47, 0x43, 0x43, 0x3f, 0x43, 0x43, 0x38, 0x46, 0x38, 0x3e, 0x3e, 0x41, 0x4a, 0x46, 0x2f, 0x58, 0x7a, 0x60, 0x3c, 0x38, 0x3c, 0x40, 0x46, 0x37, 0x3c, 0x38, 0x2f, 0x25, 0x27, 0x27, 0x35, 0x26, 0x5f, 0x78, 0x7f, 0x74, 0x7e, 0x7f, 0x7f, 0xfe, 0xfe, 0xf6, 0xe8, 0xe6, 0xf1, 0xf4, 0xf4, 0xf8, 0xf4, 0xfa, 0xf9, 0xf5, 0xfa, 0xf5, 0xfe, 0xf4, 0xf5, 0xf1, 0xf5, 0xf2, 0xf1, 0xf3, 0xf7, 0xf0, 0xeb, 0xc3, 0xef, 0xf3, 0x80, 0x80, 0x7c, 0x75, 0x6e, 0x65, 0x64, 0x5c, 0x48, 0x48, 0x36, 0x33, 0x33, 0x2a, 0x33, 0x2a, 0x33, 0x2a, 0x33, 0x35, 0x33, 0x44, 0x44, 0x44, 0x57, 0x57, 0x60, 0x69, 0x6b, 0x75, 0x78, 0x7c, 0x7d, 0x7d, 0x79, 0x75, 0x6f, 0x52, 0xf8, 0xf3, 0xf9, 0xfa, 0xe7, 0xe6, 0xe6, 0xf4, 0xf4, 0xf5, 0xf5, 0xf1, 0xf1, 0xe7, 0xf4, 0xf2, 0xf1, 0xf3, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0x81, 0x7e, 0x7c, 0x75, 0x73, 0x69, 0x5f, 0x7c, 0x71, 0x1a, 0x1d, 0x25, 0x25, 0x2f, 0x3c, 0x3f, 0x43, 0x43, 0x43, 0x40, 0x46, 0x38, 0x39, 0x1c, 0x3b, 0x76, 0x45, 0x34, 0x41, 0x2e, 0x3d, 0x40, 0x3d, 0x3d, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x3f, 0x3f, 0x3f, 0x4b, 0x4b, 0x5b, 0x5a, 0x55, 0x5a, 0x5a, 0x55, 0x5a, 0x5b, 0x54, 0x3b, 0x75, 0xfa, 0xf5, 0xe8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xfa, 0xf9, 0xe6, 0xe6, 0x81, 0x6f, 0x2d, 0x54, 0x49, 0x5b, 0x5b, 0x4c, 0x4d, 0x4d, 0x49, 0x4d, 0x4d, 0x50, 0x4c, 0x4c, 0x43, 0x3f, 0x3d, 0x43, 0x38, 0x3c, 0x3f, 0x43, 0x46, 0x3c, 0x3e, 0x37, 0x4a, 0x40, 0x2f, 0x26, 0x76, 0x60, 0x2c, 0x40, 0x30, 0x41, 0x4a, 0x40, 0x3e, 0x53, 0x46, 0x3d, 0x37, 0x3d, 0x4c, 0x20, 0x19, 0x78, 0x73, 0x26, 0x48, 0x57, 0x60, 0x6b, 0x73, 0x78, 0x7d, 0x7e, 0xfe, 0x80, 0x81, 0x81, 0xf3, 0xf3, 0xe6, 0xe6, 0xe6, 0xae, 0xad, 0x85, 0xf2, 0xf4, 0xf5, 0xf5, 0xf5, 0xf1, 0xe5, 0xe6, 0xf7, 0xf7, 0xff, 0x6c, 0x66, 0x4e, 0x22, 0x1f, 0x1d, 0x23, 0x1d, 0x23, 0x23, 0x34, 0x32, 0x3d, 0x3d, 0x4a, 0x3d, 0x3d, 0x32, 0x34, 0x32, 0x2e, 0x32, 0x34, 0x2e, 0x32, 0x32, 0x3d, 0x32, 0x23, 0x1d, 0x20, 0x21, 0x48, 0x5c, 0x68, 0x76, 0x7b, 0x7f, 0xf7, 0xad, 0xf8, 0xff, 0xff, 0xff, 0xae, 0xad, 0xe6, 0xf2, 0xf2, 0xe7, 0xae, 0xe7, 0xf2, 0xf8, 0x85, 0x85, 0xf3, 0x7f, 0x7d, 0x7b, 0x76, 0x6e, 0x65, 0x58, 0x44, 0x1e, 0x1f, 0x1d, 0x1b, 0x76, 0x76, 0x1d, 0x46, 0x3d, 0x37, 0x37, 0x47, 0x40, 0x40, 0x41, 0x41, 0x41, 0x4a, 0x53, 0x4a, 0x2c, 0x36, 0x76, 0x35, 0x23, 0x34, 0x2e, 0x32, 0x3d, 0x3d, 0x3d, 0x38, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x4a, 0x4f, 0x4f, 0x4f, 0x5b, 0x50, 0x5b, 0x5b, 0x5a, 0x55, 0x5a, 0x5a, 0x54, 0x33, 0x6f, 0x7f, 0xf9, 0xfa, 0xf9, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf8, 0xe8, 0xe6, 0xf9, 0xfa, 0xf8, 0xad, 0xe6, 0x7e, 0x6b, 0x21, 0x51, 0x54, 0x3e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x4d, 0x4d, 0x3e, 0x3f, 0x4c, 0x43, 0x43, 0x38, 0x37, 0x2f, 0x38, 0x43, 0x3c, 0x39, 0x37, 0x40, 0x3d, 0x3c, 0x29, 0x73, 0x68, 0x25, 0x3d, 0x31, 0x3f, 0x4a, 0x3d, 0x3e, 0x3d, 0x3f, 0x3e, 0x3e, 0x37, 0x41, 0x39, 0x1e, 0x79, 0x6e, 0x23, 0x23, 0x2b, 0x25, 0x27, 0x28, 0x36, 0x42, 0x5e, 0x66, 0x6c, 0x75, 0x7b, 0x7e, 0x7f, 0x80, 0xf3, 0xf3, 0x85, 0xf3, 0xe6, 0xf2, 0xf2, 0xf4, 0xf9, 0xf1, 0xf4, 0xfa, 0xfa, 0x77, 0xec, 0x04, 0x08, 0x2a, 0x1d, 0x23, 0x38, 0x46, 0x23, 0x31, 0x31, 0x30, 0x37, 0x30, 0x30, 0x34, 0x30, 0x34, 0x41, 0x34, 0x41, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x41, 0x4a, 0x3d, 0x41, 0x3d, 0x3f, 0x37, 0x2e, 0x2c, 0x2b, 0x2d, 0x48, 0x6c, 0x7d, 0xf8, 0xfa, 0xff, 0xff, 0xf4, 0xae, 0xe6, 0xf4, 0xf4, 0xf4, 0xf2, 0xf3, 0x80, 0x7e, 0x7e, 0x7e, 0x78, 0x71, 0x6b, 0x5e, 0x42, 0x2a, 0x25, 0x2f, 0x2f, 0x2b, 0x31, 0x30, 0x38, 0x20, 0x6e, 0x73, 0x1f, 0x46, 0x47, 0x37, 0x3f, 0x3f, 0x34, 0x47, 0x34, 0x3f, 0x37, 0x3d, 0x46, 0x41, 0x2c, 0x44, 0x76, 0x48, 0x2b, 0x3e, 0x2f, 0x4b, 0x37, 0x3c, 0x37, 0x3e, 0x3f, 0x3c, 0x3f, 0x3c, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x50, 0x5b, 0x5b, 0x50, 0x55, 0x5b, 0x55, 0x5a, 0x59, 0x35, 0x65, 0x7e, 0xf8, 0xfb, 0xf9, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf5, 0xae, 0xae, 0xf8, 0xff, 0xfe, 0xae, 0xae, 0xea, 0x7d, 0x60, 0x2d, 0x44, 0x54, 0x55, 0x50, 0x55, 0x50, 0x50, 0x55, 0x39, 0x4d, 0x3e, 0x4b, 0x2e, 0x43, 0x43, 0x4f, 0x4b, 0x4d, 0x4b, 0x4f, 0x50, 0x4d, 0x4d, 0x4f, 0x5b, 0x49, 0x33, 0x76, 0x68, 0x23, 0x43, 0x39, 0x37, 0x53, 0x38, 0x3e, 0x43, 0x3f, 0x3e, 0x37, 0x53, 0x41, 0x43, 0x20, 0x79, 0x6d, 0x23, 0x31, 0x37, 0x2e, 0x34, 0x3d, 0x2e, 0x23, 0x23, 0x1d, 0x25, 0x1f, 0x33, 0x42, 0x60, 0x6b, 0x71, 0x7c, 0x7e, 0x81, 0xfb, 0xfb, 0xf3, 0xe6, 0xf3, 0xf1, 0xf9, 0xfa, 0xf8, 0x07, 0x84, 0x84, 0x09, 0x45, 0x23, 0x30, 0x2e, 0x34, 0x3d, 0x40, 0x38, 0x3d, 0x32, 0x3d, 0x38, 0x3f, 0x32, 0x40, 0x40, 0x46, 0x3d, 0x40, 0x40, 0x3d, 0x3f, 0x43, 0x3f, 0x32, 0x32, 0x3d, 0x3d, 0x40, 0x40, 0x3d, 0x40, 0x41, 0x32, 0x38, 0x2f, 0x1d, 0x3b, 0x7e, 0xf1, 0xe7, 0xe7, 0xad, 0xe6, 0xf5, 0xfa, 0xff, 0x80, 0x80, 0x7e, 0x71, 0x6b, 0x5e, 0x58, 0x28, 0x21, 0x20, 0x1f, 0x25, 0x25, 0x2c, 0x2c, 0x2e, 0x3d, 0x31, 0x34, 0x34, 0x20, 0x6b, 0x7c, 0x1e, 0x34, 0x3d, 0x41, 0x34, 0x3d, 0x40, 0x40, 0x3f, 0x3f, 0x37, 0x3f, 0x2f, 0x3f, 0x25, 0x44, 0x76, 0x57, 0x44, 0x5a, 0x50, 0x55, 0x4d, 0x5a, 0x4d, 0x55, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x50, 0x50, 0x55, 0x55, 0x55, 0x4d, 0x4d, 0x5a, 0x5a, 0x4d, 0x5a, 0x51, 0x29, 0x65, 0x7a, 0xfe, 0xad, 0xe3, 0xf3, 0xf8, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xf3, 0xf4, 0xf9, 0xe8, 0xe8, 0xf1, 0x81, 0xff, 0x62, 0x26, 0x45, 0x50, 0x3c, 0x50, 0x4d, 0x4b, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x55, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x5a, 0x54, 0x5b, 0x5b, 0x55, 0x55, 0x33, 0x6f, 0x70, 0x20, 0x46, 0x37, 0x37, 0x46, 0x43, 0x27, 0x3c, 0x2c, 0x3f, 0x4a, 0x41, 0x46, 0x2e, 0x44, 0x76, 0x64, 0x31, 0x2c, 0x30, 0x34, 0x34, 0x34, 0x34, 0x34, 0x30, 0x3d, 0x32, 0x32, 0x2e, 0x25, 0x1d, 0x18, 0x1f, 0x36, 0x58, 0x65, 0x6f, 0x74, 0x7e, 0x81, 0xfe, 0xfe, 0xe9, 0xf6, 0xd7, 0x82, 0x89, 0x84, 0x0d, 0x39, 0x2c, 0x34, 0x32, 0x32, 0x3d, 0x38, 0x40, 0x3d, 0x38, 0x3d, 0x32, 0x38, 0x3d, 0x3d, 0x38, 0x3d, 0x3d, 0x38, 0x3d, 0x43, 0x3d, 0x3d, 0x3d, 0x3d, 0x43, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x40, 0x41, 0x4a, 0x41, 0x43, 0x20, 0x7a, 0xf4, 0xe5, 0xe4, 0x81, 0x80, 0x7e, 0x78, 0x73, 0x65, 0x4e, 0x42, 0x21, 0x1f, 0x27, 0x23, 0x2e, 0x3f, 0x3e, 0x37, 0x31, 0x37, 0x31, 0x30, 0x3d, 0x34, 0x31, 0x31, 0x34, 0x25, 0x60, 0x7b, 0x3b, 0x2c, 0x4a, 0x38, 0x40, 0x40, 0x32, 0x3d, 0x3f, 0x43, 0x43, 0x37, 0x3e, 0x40, 0x2c, 0x44, 0x76, 0x5c, 0x55, 0x50, 0x54, 0x54, 0x4d, 0x4d, 0x4d, 0x55, 0x4d, 0x55, 0x4d, 0x55, 0x54, 0x51, 0x54, 0x49, 0x5b, 0x50, 0x5b, 0x4d, 0x4d, 0x5a, 0x55, 0x5a, 0x29, 0x62, 0x7c, 0x7f, 0xf8, 0xe3, 0xae, 0xae, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf3, 0xf2, 0xf4, 0xe8, 0xf1, 0xf3, 0x7f, 0x62, 0x1e, 0x45, 0x4d, 0x5b, 0x39, 0x54, 0x4d, 0x49, 0x4d, 0x54, 0x54, 0x54, 0x5a, 0x54, 0x55, 0x54, 0x54, 0x51, 0x51, 0x51, 0x54, 0x54, 0x5a, 0x54, 0x51, 0x33, 0x75, 0x75, 0x26, 0x43, 0x3e, 0x37, 0x4a, 0x46, 0x49, 0x3e, 0x37, 0x4a, 0x4a, 0x4a, 0x43, 0x2a, 0x58, 0x79, 0x59, 0x23, 0x34, 0x3d, 0x40, 0x40, 0x40, 0x3d, 0x2e, 0x2e, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x34, 0x34, 0x30, 0x2e, 0x32, 0x23, 0x1f, 0x29, 0x4e, 0x68, 0x6e, 0x7a, 0x7e, 0xf7, 0xed, 0x84, 0x00, 0x82, 0x10, 0x3c, 0x2e, 0x34, 0x3d, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x41, 0x30, 0x43, 0x1d, 0x73, 0x80, 0x80, 0x7c, 0x75, 0x68, 0x4e, 0x29, 0x28, 0x25, 0x2f, 0x32, 0x32, 0x30, 0x34, 0x3d, 0x38, 0x32, 0x32, 0x32, 0x38, 0x3f, 0x2f, 0x3f, 0x38, 0x3d, 0x30, 0x31, 0x34, 0x23, 0x5e, 0x7a, 0x48, 0x2c, 0x38, 0x47, 0x3d, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x4b, 0x3f, 0x3e, 0x41, 0x2b, 0x22, 0x7a, 0x60, 0x45, 0x50, 0x51, 0x51, 0x4d, 0x54, 0x54, 0x49, 0x54, 0x54, 0x54, 0x4d, 0x54, 0x51, 0x54, 0x54, 0x4d, 0x4d, 0x4d, 0x55, 0x55, 0x55, 0x5a, 0x2a, 0x62, 0x7d, 0xf3, 0xf3, 0xf2, 0xfa, 0xe8, 0xe5, 0xe8, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xfa, 0xfe, 0xfe, 0x80, 0x71, 0x4e, 0x2a, 0x55, 0x50, 0x4d, 0x49, 0x51, 0x49, 0x51, 0x54, 0x54, 0x54, 0x54, 0x55, 0x54, 0x54, 0x54, 0x51, 0x51, 0x54, 0x54, 0x54, 0x59, 0x44, 0x3b, 0x78, 0x7f, 0x60, 0x1d, 0x39, 0x4c, 0x4a, 0x53, 0x40, 0x32, 0x41, 0x41, 0x40, 0x3e, 0x20, 0x22, 0x6b, 0x7c, 0x56, 0x1d, 0x1d, 0x25, 0x1d, 0x23, 0x1d, 0x1d, 0x20, 0x20, 0x1f, 0x20, 0x1d, 0x20, 0x1d, 0x25, 0x1d, 0x23, 0x25, 0x25, 0x25, 0x2b, 0x23, 0x23, 0x38, 0x2f, 0x20, 0x56, 0x7d, 0xb6, 0x84, 0x83, 0x83, 0x10, 0x3c, 0x30, 0x32, 0x40, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x47, 0x2c, 0x2c, 0x39, 0x1b, 0x6b, 0x7f, 0x6c, 0x48, 0x28, 0x25, 0x2e, 0x3e, 0x37, 0x23, 0x2e, 0x23, 0x23, 0x2f, 0x2b, 0x20, 0x20, 0x2a, 0x27, 0x2a, 0x20, 0x2a, 0x20, 0x2a, 0x27, 0x27, 0x1f, 0x1f, 0x25, 0x1b, 0x57, 0x7b, 0x68, 0x20, 0x2c, 0x3e, 0x3e, 0x3f, 0x3f, 0x34, 0x41, 0x3f, 0x3f, 0x3e, 0x43, 0x3c, 0x1c, 0x5d, 0x7f, 0x67, 0x33, 0x54, 0x49, 0x51, 0x45, 0x51, 0x45, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x54, 0x54, 0x49, 0x59, 0x54, 0x59, 0x45, 0x48, 0x6b, 0x7c, 0xfe, 0x85, 0xe4, 0xf4, 0xf9, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf8, 0xfb, 0xf3, 0x85, 0x80, 0x74, 0x56, 0x33, 0x54, 0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x51, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x5a, 0x54, 0x51, 0x44, 0x56, 0x7e, 0x7f, 0x7a, 0x58, 0x1f, 0x25, 0x41, 0x53, 0x40, 0x41, 0x3f, 0x37, 0x25, 0x21, 0x2d, 0x6c, 0x7d, 0xff, 0x71, 0x69, 0x66, 0x60, 0x60, 0x68, 0x68, 0x69, 0x6e, 0x6b, 0x6b, 0x6c, 0x6f, 0x6b, 0x6e, 0x68, 0x68, 0x65, 0x5c, 0x5c, 0x42, 0x29, 0x28, 0x25, 0x23, 0x23, 0x33, 0x24, 0x7d, 0x07, 0x84, 0x82, 0x00, 0x12, 0x3c, 0x2e, 0x34, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x32, 0x2c, 0x3e, 0x20, 0x5f, 0x7e, 0x6b, 0x1e, 0x2b, 0x2b, 0x2b, 0x27, 0x35, 0x36, 0x58, 0x5c, 0x5e, 0x65, 0x68, 0x6f, 0x6f, 0x6f, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x6f, 0x70, 0x6f, 0x6e, 0x69, 0xfd, 0x7f, 0x7c, 0x5f, 0x27, 0x1d, 0x23, 0x3f, 0x40, 0x4a, 0x4a, 0x41, 0x47, 0x43, 0x2b, 0x20, 0x65, 0x7d, 0xf7, 0x71, 0x2d, 0x55, 0x4d, 0x49, 0x54, 0x45, 0x54, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x5b, 0x55, 0x55, 0x54, 0x51, 0x58, 0x29, 0x58, 0x6b, 0x7f, 0x81, 0xad, 0xad, 0xe6, 0xf9, 0xfa, 0xfa, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xe6, 0xae, 0xe6, 0xf2, 0xf1, 0x81, 0x7e, 0x70, 0x2d, 0x35, 0x50, 0x55, 0x55, 0x55, 0x5a, 0x54, 0x51, 0x51, 0x51, 0x51, 0x55, 0x54, 0x59, 0x54, 0x54, 0x59, 0x54, 0x58, 0x26, 0x70, 0x80, 0xad, 0xfe, 0x7b, 0x6f, 0x56, 0x29, 0x2a, 0x1b, 0x21, 0x21, 0x2d, 0x5e, 0x6b, 0x7c, 0x7f, 0xfe, 0xe4, 0xf6, 0xf7, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0xf6, 0x81, 0xf7, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7b, 0x7a, 0x73, 0x6a, 0x6a, 0xf8, 0xb1, 0x84, 0x83, 0x00, 0x12, 0x3e, 0x2e, 0x34, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x46, 0x4a, 0x38, 0x23, 0x5f, 0x7d, 0x72, 0x56, 0x60, 0x66, 0x6b, 0x75, 0x7c, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0xfb, 0xfb, 0xfe, 0xf6, 0x81, 0xf6, 0xf3, 0xf6, 0x85, 0xf6, 0xfb, 0x81, 0x85, 0x81, 0x80, 0x81, 0x85, 0xe0, 0x85, 0x7f, 0x79, 0x6d, 0x58, 0x21, 0x20, 0x25, 0x27, 0x27, 0x27, 0x21, 0x57, 0x76, 0x7e, 0xf3, 0xad, 0x7f, 0x68, 0x54, 0x39, 0x54, 0x45, 0x54, 0x45, 0x4d, 0x55, 0x4d, 0x55, 0x4d, 0x55, 0x54, 0x55, 0x50, 0x5b, 0x55, 0x44, 0x42, 0x62, 0x7c, 0x80, 0xe4, 0xad, 0xad, 0xae, 0xe8, 0xf9, 0xfa, 0xf8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xe4, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xae, 0xae, 0xf2, 0xf5, 0xf9, 0xf1, 0xf8, 0x80, 0x78, 0x60, 0x44, 0x45, 0x51, 0x54, 0x54, 0x54, 0x54, 0x54, 0x59, 0x54, 0x51, 0x51, 0x51, 0x51, 0x59, 0x51, 0x58, 0x36, 0x65, 0x7b, 0x85, 0xe1, 0xad, 0xf3, 0xfe, 0xfe, 0x7c, 0x78, 0x75, 0x75, 0x79, 0x7b, 0x7d, 0x7f, 0x80, 0xf8, 0xf3, 0xe8, 0xe6, 0xe4, 0xe6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xe6, 0xe6, 0x85, 0xe6, 0xf3, 0xe6, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xfa, 0xfa, 0xfa, 0xf3, 0xf4, 0xfb, 0x80, 0xff, 0x81, 0xfe, 0xb0, 0x84, 0x83, 0x00, 0x16, 0x3c, 0x34, 0x34, 0x40, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x41, 0x4a, 0x32, 0x5e, 0x7e, 0xf8, 0x7f, 0x7f, 0x7e, 0xff, 0xff, 0xfa, 0xf2, 0xae, 0xe7, 0xe5, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf1, 0xe8, 0xe8, 0xe8, 0xe7, 0xe6, 0xf1, 0xe7, 0xe4, 0xf3, 0xfe, 0xf5, 0xe7, 0xad, 0xe8, 0xff, 0x7f, 0x7f, 0x7c, 0x75, 0x6f, 0x62, 0x5f, 0x62, 0x6b, 0x74, 0x7e, 0xfe, 0xf8, 0xad, 0xe4, 0x7f, 0x76, 0x44, 0x49, 0x44, 0x49, 0x51, 0x49, 0x45, 0x49, 0x54, 0x49, 0x49, 0x54, 0x49, 0x54, 0x54, 0x54, 0x33, 0x5c, 0x75, 0x7d, 0x81, 0xf3, 0xe6, 0xe4, 0xe6, 0xf1, 0xf2, 0xfa, 0xf9, 0xf2, 0xe8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xe8, 0xe7, 0xf5, 0xf5, 0xff, 0xff, 0x81, 0x80, 0x75, 0x5f, 0x22, 0x2d, 0x44, 0x51, 0x54, 0x55, 0x5a, 0x4d, 0x54, 0x49, 0x51, 0x49, 0x49, 0x54, 0x59, 0x51, 0x6d, 0x79, 0x7f, 0x85, 0xad, 0xe6, 0xe6, 0xad, 0xe6, 0xea, 0xea, 0xfa, 0xf6, 0xf4, 0xf3, 0xe4, 0xe6, 0xe6, 0xe6, 0xf2, 0xe8, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf4, 0xe8, 0xf2, 0xf2, 0xfa, 0xfa, 0xfb, 0xf5, 0xf4, 0xf2, 0xf2, 0xf2, 0xe8, 0xe8, 0xe7, 0xe7, 0xe7, 0xe8, 0xf2, 0xf4, 0xf9, 0x81, 0xfa, 0xb0, 0x84, 0x83, 0x00, 0x16, 0x2f, 0x34, 0x34, 0x40, 0x2e, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x34, 0x46, 0x2f, 0x5c, 0x7e, 0xf2, 0xf2, 0xe6, 0xf4, 0xfa, 0xf5, 0xe8, 0xf1, 0xe6, 0xf2, 0xf8, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xfa, 0xfa, 0xfa, 0xf4, 0xe9, 0xfa, 0xfa, 0xae, 0xe3, 0xe8, 0xf6, 0x80, 0x7f, 0x80, 0x80, 0x80, 0xf8, 0x85, 0xf3, 0xf4, 0xfb, 0x7e, 0x73, 0x58, 0x44, 0x49, 0x49, 0x4d, 0x4d, 0x4d, 0x50, 0x50, 0x4d, 0x5a, 0x49, 0x51, 0x49, 0x44, 0x29, 0x5c, 0x73, 0x7c, 0xff, 0xfb, 0xf1, 0xf1, 0xf8, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf2, 0xe8, 0xe4, 0xe8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf9, 0xe6, 0xe3, 0xe6, 0xf9, 0xff, 0xfe, 0xe4, 0xad, 0x81, 0x7e, 0x78, 0x67, 0x3b, 0x3b, 0x33, 0x44, 0x51, 0x54, 0x54, 0x54, 0x5a, 0x5a, 0x55, 0x5b, 0x55, 0x51, 0x33, 0x48, 0x5d, 0x72, 0xf8, 0xff, 0xfa, 0xfa, 0xf2, 0xf5, 0xf5, 0xe5, 0xe5, 0xe7, 0xe5, 0xe6, 0xe7, 0xe8, 0xf2, 0xe8, 0xf2, 0xe7, 0xe8, 0xe7, 0xe8, 0xe7, 0xe8, 0xe8, 0xe8, 0xe9, 0xf4, 0xf4, 0xf5, 0xf4, 0xf2, 0xf2, 0xe7, 0xe8, 0xe7, 0xae, 0xae, 0xe6, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xe6, 0xb0, 0x84, 0x83, 0x01, 0x1e, 0x37, 0x34, 0x34, 0x41, 0x2e, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x37, 0x39, 0x31, 0x40, 0x2f, 0x57, 0x7f, 0xe7, 0xe7, 0xe7, 0xe6, 0xf1, 0xe6, 0xe8, 0xe6, 0xe6, 0xf3, 0xfe, 0xfe, 0xfe, 0xf9, 0xf5, 0xf9, 0xf5, 0xf4, 0xf2, 0xf5, 0xe8, 0xf5, 0xe7, 0xf1, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf5, 0xfa, 0xe9, 0xe5, 0xe7, 0xf2, 0xfa, 0xf4, 0xfa, 0xf9, 0xf1, 0xf9, 0xf9, 0xfa, 0xff, 0x71, 0x62, 0x26, 0x33, 0x3c, 0x45, 0x4b, 0x50, 0x50, 0x50, 0x50, 0x55, 0x55, 0x35, 0x35, 0x33, 0x48, 0x60, 0x70, 0x7d, 0xff, 0xf3, 0xf1, 0xf9, 0xe9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf1, 0xf2, 0xf1, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf9, 0xf3, 0xf1, 0xe8, 0xe6, 0xf2, 0xf3, 0xf1, 0xe8, 0xe4, 0xae, 0xf3, 0xfe, 0x7e, 0x7c, 0x70, 0x6b, 0x56, 0x3b, 0x3b, 0x33, 0x26, 0x33, 0x21, 0x35, 0x2a, 0x2a, 0x33, 0x22, 0x19, 0x14, 0x63, 0xf8, 0xff, 0xff, 0xfe, 0xf2, 0xf2, 0xfa, 0xf4, 0xf2, 0xf3, 0xf2, 0xf9, 0xf4, 0xf2, 0xe8, 0xe8, 0xe8, 0xf1, 0xe8, 0xe6, 0xe8, 0xe6, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xf3, 0xe8, 0xf4, 0xe8, 0xf4, 0xe8, 0xf4, 0xe8, 0x85, 0xe8, 0xf3, 0xf4, 0xf3, 0xe9, 0xe6, 0xf6, 0xe4, 0xb0, 0x86, 0x83, 0x01, 0x1c, 0x2f, 0x34, 0x34, 0x40, 0x2e, 0x3d, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x2e, 0x32, 0x40, 0x23, 0x56, 0x7f, 0xf1, 0xf4, 0xf3, 0xe6, 0xe8, 0xe8, 0xf3, 0xe6, 0xf3, 0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 0xf3, 0xe8, 0xf2, 0xe8, 0xe8, 0xea, 0xe8, 0xea, 0xe6, 0xe8, 0xe8, 0xf5, 0xe8, 0xe7, 0x85, 0xe8, 0xe8, 0xe9, 0xf1, 0xfb, 0xf4, 0xf4, 0xf4, 0xf8, 0xf4, 0xfb, 0xf1, 0xf5, 0xfa, 0xf9, 0xff, 0x6a, 0x24, 0x22, 0x1e, 0x1b, 0x1f, 0x2a, 0x21, 0x1f, 0x2a, 0x2a, 0x33, 0x2d, 0x57, 0x65, 0x6b, 0x7a, 0x7e, 0x7f, 0xf8, 0xe8, 0xae, 0xe5, 0xe7, 0xf9, 0xf1, 0xf2, 0xf9, 0xf2, 0xf2, 0xf1, 0xe8, 0xe6, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xe8, 0xf1, 0xfa, 0xf8, 0xf3, 0xae, 0xe6, 0xae, 0xf9, 0xfa, 0xe7, 0xe7, 0xfa, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0x7e, 0x74, 0x75, 0x71, 0x71, 0x6c, 0x6b, 0x6b, 0x6b, 0x6c, 0x6c, 0x74, 0x7c, 0xf7, 0xe6, 0xe8, 0xfb, 0xf3, 0xad, 0xad, 0xfb, 0xf8, 0xfe, 0xff, 0xfb, 0xfe, 0xf4, 0xfe, 0xf4, 0xf3, 0xf4, 0xfb, 0xfe, 0xfe, 0xfe, 0xfb, 0x81, 0xfb, 0x80, 0xfb, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0x80, 0x80, 0xfb, 0xfb, 0xf4, 0xf5, 0xf6, 0xf9, 0xb0, 0x82, 0x83, 0x01, 0x1e, 0x3e, 0x34, 0x34, 0x34, 0x34, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x46, 0x46, 0x40, 0x4a, 0x23, 0x56, 0xfe, 0x85, 0xfe, 0xfe, 0x80, 0x80, 0x80, 0xfb, 0x80, 0xfb, 0xfb, 0xfb, 0xf6, 0xf6, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x85, 0x80, 0xf4, 0xfb, 0xe6, 0xf3, 0xf4, 0xf4, 0xe8, 0xf8, 0xf3, 0xf2, 0xe4, 0x85, 0xe6, 0xe6, 0xe3, 0xf2, 0xe7, 0xe7, 0xe3, 0xad, 0xf7, 0x7f, 0x78, 0x71, 0x70, 0x6b, 0x6b, 0x6c, 0x6f, 0x70, 0x70, 0x78, 0x7b, 0x7e, 0x7f, 0xfe, 0xf3, 0xf3, 0xf2, 0xea, 0xf1, 0xe7, 0xf2, 0xe8, 0xe4, 0xe8, 0xf1, 0xf2, 0xf1, 0xe6, 0xae, 0xae, 0xe8, 0xf2, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xe8, 0xf2, 0xf1, 0xf1, 0xe3, 0xf5, 0x77, 0x74, 0x7f, 0x7f, 0xf3, 0xf8, 0xfa, 0x80, 0xf3, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0xfa, 0xf4, 0xf4, 0xf1, 0xf3, 0xe6, 0xf3, 0xe6, 0x85, 0xf9, 0xfa, 0xfa, 0xe6, 0x85, 0x80, 0x7f, 0xff, 0xfe, 0x80, 0x7f, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x78, 0x78, 0x78, 0x75, 0x71, 0x71, 0x6c, 0x6c, 0x70, 0x70, 0x70, 0x73, 0x71, 0x75, 0x74, 0x78, 0x7b, 0x7c, 0x7d, 0xfb, 0xe7, 0xb0, 0x82, 0x00, 0x01, 0x1e, 0x2b, 0x30, 0x30, 0x30, 0x32, 0x3d, 0x40, 0x41, 0x3d, 0x32, 0x43, 0x3e, 0x37, 0x3c, 0x34, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x40, 0x41, 0x40, 0x34, 0x2e, 0x3f, 0x3f, 0x40, 0x46, 0x46, 0x46, 0x46, 0x38, 0x41, 0x2e, 0x32, 0x20, 0x4e, 0x7d, 0x7f, 0x7e, 0x7e, 0x78, 0x71, 0x70, 0x6c, 0x6c, 0x70, 0x6c, 0x6c, 0x6c, 0x6b, 0x6c, 0x6c, 0x6c, 0x70, 0x73, 0x71, 0x75, 0x71, 0x78, 0x74, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0xff, 0xff, 0x81, 0x81, 0x85, 0xe6, 0xe6, 0xe8, 0xe8, 0xe8, 0xf4, 0xfb, 0xf5, 0xe4, 0xe9, 0xe8, 0xe6, 0xf8, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xfa, 0xf3, 0xf3, 0x85, 0xe4, 0x81, 0x81, 0x77, 0x77, 0xfa, 0xf9, 0xf4, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0x80, 0x6a, 0x63, 0x7b, 0x7e, 0x80, 0xf8, 0xe6, 0x85, 0xe4, 0xf3, 0xf4, 0xf3, 0xf8, 0xf1, 0xae, 0xe7, 0xe5, 0xe7, 0xae, 0xe5, 0xae, 0x85, 0xf3, 0xf8, 0xfe, 0x81, 0x85, 0x7f, 0x7e, 0x7c, 0x78, 0x70, 0x6b, 0x67, 0xfe, 0x7e, 0x62, 0x56, 0x2d, 0x26, 0x21, 0x1c, 0x1c, 0x1f, 0x1b, 0x1f, 0x1c, 0x18, 0x1f, 0x1f, 0x20, 0x1d, 0x1f, 0x1d, 0x1d, 0x1d, 0x1f, 0x1c, 0x1c, 0x1c, 0x1e, 0x22, 0x6a, 0x7e, 0xb0, 0x86, 0x89, 0x01, 0x21, 0x4b, 0x41, 0x40, 0x40, 0x40, 0x3d, 0x34, 0x34, 0x3d, 0x34, 0x32, 0x32, 0x3d, 0x32, 0x2e, 0x2c, 0x23, 0x31, 0x23, 0x31, 0x23, 0x31, 0x2c, 0x31, 0x37, 0x37, 0x2e, 0x2e, 0x2e, 0x30, 0x2c, 0x30, 0x2c, 0x34, 0x41, 0x34, 0x3d, 0x2f, 0x4e, 0x7c, 0x70, 0x57, 0x33, 0x2a, 0x20, 0x1f, 0x1f, 0x20, 0x18, 0x1d, 0x1d, 0x25, 0x20, 0x25, 0x1d, 0x1d, 0x1d, 0x1d, 0x20, 0x1b, 0x21, 0x1c, 0x1f, 0x1b, 0x2a, 0x2a, 0x2d, 0x4e, 0x6b, 0x7c, 0x67, 0x67, 0x70, 0x78, 0x7e, 0x7f, 0x80, 0x81, 0x85, 0xad, 0xad, 0xe6, 0xf9, 0xf4, 0xf1, 0xf2, 0xe7, 0xe6, 0xe4, 0xe4, 0xf2, 0xe4, 0xe4, 0xe8, 0xf1, 0xe7, 0xf1, 0xea, 0xe4, 0xe6, 0xf3, 0x7f, 0x74, 0xef, 0x72, 0xfb, 0xfa, 0xf2, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf8, 0xfb, 0xf8, 0xff, 0x6a, 0x3a, 0x62, 0x79, 0x7e, 0x7f, 0x80, 0x80, 0xfe, 0xfe, 0xf8, 0xf3, 0xe6, 0xe8, 0xae, 0xad, 0xad, 0xe6, 0x85, 0xf3, 0x81, 0x80, 0x7f, 0x7e, 0x7b, 0x7a, 0x69, 0x60, 0x48, 0x44, 0x28, 0x2a, 0x19, 0x71, 0x7b, 0x19, 0x1c, 0x35, 0x2c, 0x2e, 0x2e, 0x37, 0x32, 0x34, 0x34, 0x41, 0x47, 0x34, 0x32, 0x30, 0x2e, 0x2e, 0x23, 0x23, 0x23, 0x1d, 0x18, 0x1c, 0x16, 0x1e, 0x15, 0x5d, 0x7e, 0x8e, 0x87, 0x83, 0x02, 0x2a, 0x46, 0x46, 0x3d, 0x38, 0x38, 0x37, 0x3c, 0x23, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x28, 0x36, 0x36, 0x33, 0x36, 0x33, 0x29, 0x26, 0x26, 0x21, 0x20, 0x25, 0x27, 0x25, 0x25, 0x1d, 0x1d, 0x23, 0x31, 0x30, 0x32, 0x41, 0x46, 0x23, 0x57, 0x7c, 0x6c, 0x2d, 0x2a, 0x27, 0x1d, 0x20, 0x1d, 0x25, 0x1d, 0x25, 0x25, 0x23, 0x23, 0x2e, 0x32, 0x2f, 0x32, 0x2e, 0x2e, 0x23, 0x2c, 0x25, 0x2e, 0x38, 0x2f, 0x2f, 0x23, 0x18, 0x5e, 0x7a, 0x3b, 0x1c, 0x21, 0x33, 0x57, 0x68, 0x6f, 0x7c, 0x7d, 0x80, 0x80, 0x80, 0xff, 0xff, 0xfe, 0xfa, 0xf3, 0xf1, 0xe6, 0xe4, 0xe6, 0xf1, 0xf1, 0xe8, 0xe6, 0xe6, 0x85, 0xf8, 0x80, 0x7f, 0x7c, 0x6a, 0x52, 0x74, 0x80, 0xfa, 0xf9, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xf3, 0xad, 0x85, 0x81, 0x6a, 0x1a, 0x24, 0x4e, 0x68, 0x6f, 0x75, 0x7b, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7d, 0x7b, 0x75, 0x6f, 0x60, 0x4e, 0x2d, 0x21, 0x20, 0x2b, 0x39, 0x2e, 0x4a, 0x4a, 0x1d, 0x6b, 0x79, 0x28, 0x35, 0x34, 0x4a, 0x4a, 0x41, 0x41, 0x41, 0x41, 0x3f, 0x34, 0x2e, 0x23, 0x25, 0x1f, 0x36, 0x42, 0x5c, 0x5c, 0x65, 0x66, 0x6b, 0x6c, 0x70, 0x75, 0x74, 0x7e, 0x85, 0xb1, 0x84, 0x00, 0x02, 0x1b, 0x4b, 0x23, 0x25, 0x2a, 0x33, 0x48, 0x5c, 0x64, 0x68, 0x6e, 0x73, 0x76, 0x79, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x76, 0x6f, 0x6e, 0x68, 0x65, 0x64, 0x58, 0x29, 0x1c, 0x1f, 0x1d, 0x2f, 0x2f, 0x57, 0x7e, 0x6a, 0x5d, 0x5f, 0x60, 0x5f, 0x60, 0x5e, 0x5e, 0x57, 0x4e, 0x42, 0x22, 0x1e, 0x18, 0x18, 0x1d, 0x27, 0x31, 0x23, 0x34, 0x34, 0x41, 0x34, 0x30, 0x2e, 0x32, 0x41, 0x31, 0x4e, 0x7a, 0x5c, 0x2b, 0x47, 0x38, 0x23, 0x25, 0x20, 0x21, 0x2d, 0x5e, 0x69, 0x6f, 0x79, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0xff, 0xff, 0x7f, 0x7e, 0x7d, 0x7b, 0x79, 0x76, 0x65, 0x24, 0x3a, 0x7d, 0xff, 0xff, 0xf1, 0xe8, 0xe8, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf9, 0xe6, 0xe3, 0xe3, 0xae, 0xff, 0x75, 0x1e, 0x1f, 0x28, 0x33, 0x21, 0x4e, 0x3b, 0x5f, 0x5f, 0x66, 0x65, 0x65, 0x60, 0x5e, 0x57, 0x48, 0x26, 0x1f, 0x2a, 0x27, 0x2b, 0x3c, 0x4b, 0x2e, 0x3e, 0x31, 0x30, 0x41, 0x40, 0x25, 0x6e, 0x76, 0x28, 0x3e, 0x32, 0x41, 0x41, 0x2e, 0x2c, 0x27, 0x28, 0x21, 0x42, 0x5c, 0x68, 0x6f, 0x79, 0x7b, 0x7d, 0x7f, 0x80, 0xfe, 0x81, 0x85, 0xfe, 0xfe, 0xff, 0x80, 0xf9, 0xf7, 0xb1, 0x82, 0x84, 0x00, 0x1a, 0x4e, 0x5c, 0x69, 0x73, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x78, 0x78, 0x75, 0x79, 0x75, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a, 0x75, 0x6f, 0x5f, 0x48, 0x19, 0x5d, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7d, 0x7d, 0x7b, 0x78, 0x75, 0x66, 0x56, 0x2d, 0x29, 0x1f, 0x25, 0x23, 0x2e, 0x30, 0x31, 0x39, 0x34, 0x41, 0x23, 0x5e, 0x7a, 0x5c, 0x34, 0x3d, 0x41, 0x3d, 0x3d, 0x2f, 0x2f, 0x2f, 0x2b, 0x25, 0x2a, 0x1e, 0x2d, 0x4e, 0x5e, 0x60, 0x68, 0x69, 0x69, 0x66, 0x69, 0x68, 0x65, 0x5e, 0x5c, 0x48, 0x33, 0x26, 0x26, 0x65, 0x7c, 0x7f, 0xff, 0xf8, 0xe8, 0xe8, 0xe3, 0xe8, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xe7, 0xe5, 0xf3, 0x80, 0x79, 0x5e, 0x1f, 0x27, 0x35, 0x39, 0x2b, 0x2b, 0x27, 0x25, 0x1f, 0x1f, 0x20, 0x27, 0x2b, 0x3c, 0x3c, 0x4b, 0x3f, 0x40, 0x47, 0x40, 0x3f, 0x3f, 0x3e, 0x31, 0x31, 0x41, 0x47, 0x18, 0x70, 0x76, 0x2b, 0x3c, 0x3c, 0x2f, 0x1d, 0x33, 0x48, 0x5e, 0x69, 0x78, 0x7c, 0x7f, 0x7f, 0xfe, 0xfb, 0xe8, 0xae, 0xe3, 0xe3, 0xae, 0xe5, 0xe7, 0xe7, 0xf5, 0xfa, 0xf9, 0xfa, 0xf6, 0x07, 0x84, 0x8c, 0xbe, 0x72, 0x7d, 0x7d, 0x7e, 0x7c, 0x7a, 0x73, 0x6f, 0x66, 0x60, 0x57, 0x57, 0x33, 0x33, 0x33, 0x2a, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x35, 0x36, 0x36, 0x57, 0x57, 0x5e, 0x5f, 0x62, 0x6c, 0x75, 0x7b, 0x7d, 0x7d, 0x80, 0x7c, 0x75, 0x74, 0xfa, 0xfa, 0xff, 0x85, 0xe6, 0xf2, 0xf2, 0xf4, 0xf4, 0xfa, 0xfb, 0xfa, 0xff, 0x80, 0xfe, 0x80, 0x80, 0x7e, 0x7a, 0x6f, 0x66, 0x5c, 0x22, 0x20, 0x1d, 0x23, 0x2f, 0x4a, 0x23, 0x5e, 0x7a, 0x5c, 0x2e, 0x37, 0x3e, 0x30, 0x3f, 0x3f, 0x34, 0x3f, 0x2f, 0x4b, 0x2c, 0x49, 0x39, 0x2b, 0x39, 0x27, 0x27, 0x20, 0x20, 0x28, 0x27, 0x2b, 0x3c, 0x4b, 0x3c, 0x3c, 0x1c, 0x3b, 0x6e, 0x7d, 0xff, 0xf3, 0xe4, 0xe6, 0xae, 0xae, 0xe7, 0xf1, 0xf9, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe7, 0xf5, 0xff, 0xff, 0xfa, 0xe8, 0xe4, 0x81, 0x7e, 0x71, 0x4e, 0x21, 0x45, 0x4f, 0x46, 0x53, 0x4f, 0x3e, 0x39, 0x3e, 0x3e, 0x3f, 0x3f, 0x37, 0x47, 0x37, 0x47, 0x37, 0x3f, 0x3e, 0x4a, 0x4a, 0x4a, 0x41, 0x41, 0x43, 0x1b, 0x71, 0x7b, 0x22, 0x22, 0x57, 0x60, 0x6f, 0x78, 0x7d, 0xff, 0xfb, 0x85, 0x85, 0xad, 0xe6, 0xf3, 0xf1, 0xf4, 0xf9, 0xf5, 0xf5, 0xf9, 0xfa, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf5, 0xf6, 0xc6, 0xca, 0xf7, 0xf7, 0x7d, 0x75, 0x68, 0x5e, 0x48, 0x2a, 0x1d, 0x25, 0x25, 0x23, 0x2e, 0x2e, 0x38, 0x40, 0x38, 0x3d, 0x2e, 0x2e, 0x2e, 0x2e, 0x37, 0x3e, 0x37, 0x2e, 0x2e, 0x2e, 0x32, 0x2e, 0x23, 0x25, 0x2b, 0x27, 0x1f, 0x2a, 0x45, 0x5c, 0x69, 0x75, 0x7d, 0xff, 0xf1, 0xf5, 0xfa, 0xe8, 0xe6, 0xe8, 0xe6, 0xf2, 0xe8, 0xf2, 0xf3, 0xf4, 0xf4, 0xf2, 0xf4, 0xf1, 0xf4, 0xfb, 0xfb, 0x81, 0x80, 0x7f, 0x7f, 0x70, 0x68, 0x5e, 0x33, 0x21, 0x1c, 0x5f, 0x7a, 0x5c, 0x3c, 0x4b, 0x3e, 0x3f, 0x40, 0x41, 0x40, 0x40, 0x47, 0x37, 0x4c, 0x30, 0x47, 0x47, 0x41, 0x47, 0x47, 0x47, 0x3f, 0x4f, 0x47, 0x4f, 0x47, 0x4b, 0x2b, 0x36, 0x66, 0x7d, 0x81, 0xad, 0xad, 0xad, 0xae, 0xae, 0xae, 0xe5, 0xf1, 0xf3, 0xf9, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe4, 0xf2, 0xfa, 0xff, 0xfa, 0xf9, 0xf6, 0xe3, 0xad, 0x81, 0x7c, 0x6c, 0x2d, 0x1b, 0x3c, 0x2f, 0x2f, 0x39, 0x49, 0x39, 0x3e, 0x31, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x46, 0x46, 0x38, 0x2f, 0x1d, 0x2a, 0x48, 0x78, 0x7e, 0x72, 0x78, 0x7d, 0x7e, 0x7f, 0xf3, 0x85, 0xe5, 0xe3, 0xad, 0xad, 0xad, 0xe6, 0xf3, 0xf3, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xfe, 0xf8, 0xf2, 0xe6, 0xad, 0xe4, 0x85, 0x80, 0xf7, 0xd7, 0x0b, 0x24, 0x33, 0x20, 0x23, 0x38, 0x46, 0x34, 0x34, 0x34, 0x34, 0x37, 0x30, 0x3e, 0x30, 0x31, 0x3f, 0x38, 0x46, 0x38, 0x46, 0x38, 0x38, 0x38, 0x38, 0x46, 0x34, 0x30, 0x34, 0x47, 0x47, 0x3d, 0x43, 0x38, 0x38, 0x46, 0x46, 0x1d, 0x22, 0x5f, 0xff, 0xe8, 0xe7, 0xf5, 0xe7, 0xad, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xf4, 0xfa, 0xff, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfe, 0xfa, 0x80, 0x80, 0x7f, 0x7c, 0x75, 0x6c, 0x6c, 0x7c, 0x56, 0x1e, 0x1d, 0x25, 0x2f, 0x43, 0x40, 0x46, 0x41, 0x43, 0x47, 0x3f, 0x47, 0x41, 0x41, 0x41, 0x41, 0x4a, 0x4f, 0x4f, 0x37, 0x4c, 0x2b, 0x27, 0x36, 0x5e, 0x75, 0x7d, 0x85, 0xad, 0xad, 0xad, 0xae, 0xe6, 0xe7, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xae, 0xad, 0xae, 0xae, 0xfb, 0xf9, 0xf4, 0xf4, 0xe8, 0xe4, 0x81, 0x80, 0x74, 0x5d, 0x3b, 0x21, 0x20, 0x25, 0x25, 0x2c, 0x39, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x2c, 0x2b, 0x27, 0x20, 0x35, 0x3b, 0x56, 0x71, 0x7a, 0x7e, 0xfe, 0xfa, 0xfb, 0xfb, 0xfe, 0xfe, 0xf3, 0x85, 0xe6, 0xf3, 0xf4, 0xf9, 0xf9, 0xf4, 0xf3, 0xf1, 0xe6, 0xf1, 0xae, 0xe6, 0xae, 0xe8, 0xf2, 0xf2, 0xf2, 0xe6, 0xe4, 0xae, 0xe6, 0xf3, 0xf6, 0xb6, 0x84, 0x82, 0x12, 0x45, 0x37, 0x34, 0x34, 0x40, 0x46, 0x46, 0x40, 0x40, 0x43, 0x47, 0x3f, 0x37, 0x3f, 0x34, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3f, 0x3d, 0x40, 0x32, 0x4a, 0x41, 0x3d, 0x40, 0x43, 0x3e, 0x27, 0x1b, 0x7a, 0x81, 0xe5, 0xfb, 0xf3, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe7, 0xf1, 0xe8, 0xf1, 0xe8, 0xe8, 0xae, 0xe6, 0xe4, 0xea, 0xf3, 0xf4, 0xf3, 0xe3, 0xf5, 0xf4, 0x81, 0x81, 0x80, 0xff, 0x7c, 0x74, 0x69, 0x5c, 0x36, 0x2a, 0x25, 0x23, 0x2e, 0x37, 0x37, 0x3e, 0x47, 0x43, 0x43, 0x43, 0x4c, 0x3c, 0x2c, 0x27, 0x2b, 0x42, 0x5e, 0x70, 0x7a, 0x7f, 0xfe, 0xfb, 0xf2, 0xe4, 0xe6, 0xe4, 0xe6, 0xf9, 0xfa, 0xfa, 0xfa, 0xf4, 0xe8, 0xae, 0xe6, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe7, 0xf9, 0xf1, 0xf3, 0xf3, 0xf2, 0xf1, 0xe7, 0xe4, 0xe6, 0xad, 0xad, 0xad, 0xad, 0xe8, 0xfa, 0xfa, 0xf9, 0xea, 0xe8, 0xe6, 0xe6, 0x81, 0x80, 0x7d, 0x71, 0x69, 0x60, 0x48, 0x36, 0x21, 0x1c, 0x1f, 0x1b, 0x1b, 0x21, 0x44, 0x58, 0x5f, 0x6b, 0x70, 0x7c, 0xfe, 0x81, 0xfb, 0xfe, 0xf1, 0xf1, 0xf1, 0xf9, 0xfb, 0xf4, 0xf8, 0xf8, 0xf8, 0xfe, 0xfa, 0xfa, 0xf9, 0xf9, 0xf1, 0xf1, 0xe6, 0xe6, 0xae, 0xae, 0xae, 0xe7, 0xf1, 0xf1, 0xf1, 0xe8, 0xe4, 0xe8, 0xf8, 0xfe, 0xf2, 0xb2, 0x00, 0x00, 0x0d, 0x54, 0x32, 0x34, 0x30, 0x47, 0x40, 0x46, 0x40, 0x46, 0x3d, 0x38, 0x40, 0x46, 0x40, 0x40, 0x34, 0x3f, 0x34, 0x3f, 0x34, 0x34, 0x34, 0x3f, 0x34, 0x46, 0x3d, 0x46, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x32, 0x34, 0x47, 0x30, 0x2e, 0x33, 0x7a, 0xfe, 0xf1, 0xfa, 0xf3, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf2, 0xf5, 0xf5, 0xe7, 0xae, 0xe6, 0xad, 0xae, 0xae, 0xe6, 0xae, 0xe4, 0xf2, 0xf1, 0xf1, 0xf5, 0xf2, 0xe4, 0x85, 0xf3, 0xf9, 0xfb, 0x81, 0x7f, 0x7d, 0x7b, 0x6f, 0x66, 0x57, 0x42, 0x29, 0x21, 0x21, 0x27, 0x20, 0x20, 0x2a, 0x2a, 0x33, 0x57, 0x60, 0x6e, 0x79, 0x7c, 0x7e, 0x80, 0xf9, 0xf4, 0xf1, 0xf5, 0xfa, 0xfa, 0xf4, 0xf2, 0xfa, 0xf4, 0xfa, 0xfa, 0xf9, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xf5, 0xf1, 0xfb, 0xf8, 0xf8, 0xf3, 0xf1, 0xe7, 0xe7, 0xe6, 0xe4, 0xe6, 0xae, 0xe6, 0xe6, 0xf1, 0xe8, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf9, 0xfb, 0x81, 0xfb, 0xfb, 0x7e, 0x7c, 0x78, 0x75, 0x75, 0x75, 0x75, 0x78, 0x7b, 0x7e, 0x80, 0xf6, 0xfb, 0xfb, 0xf9, 0xf2, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf6, 0xeb, 0x00, 0x00, 0x0c, 0x45, 0x3d, 0x40, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3f, 0x30, 0x4a, 0x2f, 0x33, 0x7b, 0xfe, 0xe8, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe6, 0x85, 0xf3, 0x81, 0x80, 0x7f, 0x7d, 0x78, 0x71, 0x73, 0x6e, 0x6f, 0x6f, 0x70, 0x75, 0x78, 0x7e, 0x80, 0x81, 0xf3, 0xfb, 0xf3, 0xf2, 0xf4, 0xf1, 0xf4, 0xf2, 0xf5, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf5, 0xf1, 0xf4, 0xf8, 0xfa, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf8, 0xf2, 0xe4, 0xe4, 0xf3, 0xea, 0xe4, 0xf1, 0xe8, 0xe8, 0xf2, 0xe8, 0xe8, 0xe4, 0xe8, 0xf1, 0xe6, 0xf1, 0xe6, 0xe8, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xfb, 0xe6, 0x85, 0xf3, 0x81, 0xfe, 0xfe, 0x81, 0x81, 0x85, 0xf3, 0xf4, 0xfa, 0xf9, 0xf4, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf7, 0xb6, 0x00, 0x00, 0x09, 0x51, 0x40, 0x40, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x34, 0x3f, 0x3d, 0x2f, 0x36, 0x7c, 0xfb, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xfe, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xf3, 0x85, 0xae, 0xad, 0xe6, 0xf2, 0xf1, 0xe8, 0xe8, 0xf2, 0xe8, 0xe8, 0xe8, 0xe8, 0xf2, 0xf2, 0xe7, 0xf2, 0xe7, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xe4, 0xfb, 0xf7, 0xf7, 0xf7, 0xf6, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xe8, 0xe6, 0xe8, 0xe6, 0xe8, 0xae, 0xe8, 0xe8, 0xe8, 0xe4, 0xe6, 0xe6, 0xe6, 0xf1, 0xe6, 0xf3, 0xe8, 0xe6, 0xae, 0xe6, 0xe4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf6, 0xbb, 0x82, 0x00, 0x06, 0x45, 0x3d, 0x40, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x40, 0x37, 0x34, 0x3d, 0x25, 0x48, 0x7e, 0xf4, 0xe7, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf5, 0xf4, 0xf5, 0xf2, 0xf4, 0xf2, 0xf1, 0xe4, 0xe6, 0xad, 0xe6, 0xe6, 0xe8, 0xf2, 0xf2, 0xf1, 0xae, 0xe7, 0xae, 0xe7, 0xe6, 0xe8, 0xe8, 0xe6, 0xf3, 0xe6, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xe8, 0xf1, 0xe8, 0xe7, 0xae, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xe8, 0xf6, 0xe1, 0xc0, 0xb4, 0xbc, 0xce, 0xe7, 0xf6, 0xf8, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf1, 0xe8, 0xe6, 0xe8, 0xe8, 0xe6, 0xe8, 0xe8, 0xe8, 0xe4, 0xe6, 0xe8, 0xe6, 0xe8, 0xf4, 0xfa, 0xfa, 0xfa, 0xff, 0xfa, 0xfa, 0xf4, 0xf1, 0xe8, 0xe6, 0xe8, 0xe6, 0xf1, 0xe4, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf7, 0xec, 0x82, 0x00, 0x04, 0x36, 0x43, 0x40, 0x3f, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x34, 0x3d, 0x34, 0x40, 0x3d, 0x34, 0x40, 0x3d, 0x34, 0x40, 0x34, 0x40, 0x34, 0x40, 0x34, 0x40, 0x34, 0x40, 0x34, 0x3f, 0x32, 0x2b, 0x5e, 0x7f, 0xf3, 0xf1, 0xf4, 0xe6, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf2, 0xf2, 0xe7, 0xe8, 0xe7, 0xae, 0xe5, 0xe6, 0xe7, 0xf1, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xe9, 0xe7, 0xe7, 0xe8, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xe8, 0xe7, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0x85, 0xdf, 0xb3, 0x8d, 0x8f, 0x8f, 0x8d, 0xb3, 0xdc, 0xf7, 0xf1, 0xea, 0xf5, 0xf8, 0xf9, 0xf2, 0xf2, 0xe8, 0xe8, 0xe4, 0xf1, 0xf2, 0xf2, 0xf1, 0xe8, 0xf1, 0xe4, 0xe4, 0xe8, 0xf1, 0xf1, 0xf4, 0xf2, 0xfa, 0xf5, 0xf4, 0xf4, 0xf2, 0xf1, 0xae, 0xe4, 0xe6, 0xe4, 0xe6, 0xf2, 0xf2, 0xf2, 0xf8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf7, 0xc6, 0x84, 0x83, 0x03, 0x33, 0x37, 0x3f, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x40, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x34, 0x37, 0x32, 0x35, 0x60, 0x80, 0xf2, 0xe7, 0xf2, 0xf3, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xe8, 0xe8, 0xe4, 0xe6, 0xe7, 0xae, 0xe7, 0xf1, 0xf1, 0xf5, 0xf9, 0xfa, 0xfa, 0xf9, 0xf4, 0xf2, 0xf1, 0xe7, 0xf1, 0xf9, 0xf3, 0xf4, 0xf3, 0xf3, 0xf1, 0xf4, 0xf2, 0xf8, 0xfb, 0xf8, 0xfb, 0xf9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xe4, 0xf2, 0xf2, 0xe7, 0x95, 0x91, 0xa6, 0xb9, 0x9c, 0xb8, 0x90, 0x8d, 0xc7, 0xf6, 0xe1, 0xf1, 0xea, 0xf2, 0xf5, 0xf1, 0xe6, 0xae, 0xe8, 0xfb, 0xf1, 0xf9, 0xf2, 0xf9, 0xea, 0xfb, 0xf1, 0xf1, 0xe6, 0xae, 0xae, 0xe6, 0xae, 0xe6, 0xe6, 0xae, 0xae, 0xae, 0xae, 0xae, 0xe6, 0xae, 0xe8, 0xe4, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xe4, 0xf2, 0xf1, 0xf3, 0xf7, 0xd7, 0x84, 0xaf, 0x01, 0x1e, 0x3c, 0x2e, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x34, 0x3f, 0x23, 0x44, 0x6f, 0x81, 0xe7, 0xf1, 0xf4, 0xe6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xe6, 0xe6, 0xe6, 0xe4, 0xe6, 0xf2, 0xf2, 0xf3, 0xf9, 0xf2, 0xe8, 0xf1, 0xe6, 0xe8, 0xae, 0xae, 0xae, 0xad, 0xad, 0xe7, 0xf5, 0xf9, 0xf4, 0xfa, 0xf8, 0xf5, 0xea, 0xf6, 0xe9, 0xe9, 0xea, 0xe4, 0xfb, 0x77, 0xfe, 0xfa, 0xf9, 0xf5, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf7, 0xd8, 0x90, 0xa6, 0xb9, 0x97, 0x9d, 0xb9, 0xa8, 0x91, 0x8f, 0xdc, 0xea, 0xe5, 0xf5, 0xe4, 0xf3, 0xf1, 0xf1, 0xe6, 0xe4, 0xe4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf5, 0xf2, 0xe8, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xae, 0xe8, 0xe6, 0xf1, 0xe8, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf8, 0xf1, 0xf1, 0xf2, 0xf6, 0x77, 0x84, 0xaf, 0x01, 0x19, 0x3c, 0x2e, 0x37, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x34, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3f, 0x23, 0x48, 0x75, 0xf3, 0xe7, 0xe7, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xe6, 0xe4, 0xe6, 0xf2, 0xf3, 0xf3, 0xf3, 0xf8, 0xfe, 0xf9, 0xf2, 0xf2, 0xf2, 0xf1, 0xe6, 0xe6, 0xae, 0xad, 0xad, 0xf1, 0xf5, 0xf9, 0xf4, 0xf9, 0xf1, 0xea, 0xe2, 0xda, 0xdd, 0xe2, 0xf6, 0xe9, 0xe8, 0xf4, 0xfe, 0xf9, 0xfa, 0xfa, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xf4, 0xe4, 0xf7, 0xc0, 0x94, 0x99, 0x9b, 0xa7, 0xa0, 0x9b, 0x9b, 0xa3, 0x94, 0xb4, 0xe3, 0xe5, 0xe7, 0xe9, 0xf9, 0xe8, 0xf2, 0xae, 0xe6, 0xe7, 0xae, 0xf6, 0xf7, 0xea, 0xea, 0xe4, 0xe8, 0xea, 0xf8, 0xf4, 0xf9, 0xf2, 0xf8, 0xf2, 0xf9, 0xf2, 0xf9, 0xf4, 0xf1, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe4, 0xf2, 0xf2, 0xf3, 0xf7, 0xaf, 0x89, 0x00, 0x10, 0x5a, 0x2e, 0x37, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x25, 0x58, 0x78, 0xe6, 0xe7, 0xf5, 0xf4, 0xe6, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf9, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xf8, 0xf3, 0xf8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xe9, 0xd8, 0xa4, 0x91, 0x8d, 0x8f, 0xbc, 0xdf, 0xe6, 0xe6, 0xf1, 0xf2, 0xf4, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xc0, 0x94, 0xa3, 0x99, 0x9c, 0x97, 0xa0, 0x9c, 0x9b, 0xb8, 0x91, 0xdb, 0xea, 0xe3, 0xf2, 0xf1, 0xf2, 0xf1, 0xe6, 0xae, 0xae, 0xe1, 0xce, 0xce, 0xdd, 0xea, 0xe9, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe7, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf8, 0xf1, 0xf2, 0xf2, 0xf3, 0xf7, 0xb2, 0x87, 0x00, 0x0a, 0x5a, 0x37, 0x3f, 0x41, 0x40, 0x3f, 0x40, 0x40, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x3d, 0x3f, 0x3d, 0x3f, 0x3d, 0x3f, 0x3d, 0x3f, 0x40, 0x3d, 0x3d, 0x3d, 0x34, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3c, 0x57, 0x7c, 0xe6, 0xe5, 0xe7, 0xf2, 0xf3, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf9, 0xf5, 0xf4, 0xf5, 0xf2, 0xf1, 0xe7, 0xf1, 0xae, 0xe8, 0xe8, 0xe6, 0xe8, 0xe6, 0xe8, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xe6, 0xe6, 0xae, 0xe5, 0xe1, 0xbf, 0xc2, 0xc8, 0xa9, 0x8f, 0x8b, 0x91, 0xe0, 0xe3, 0xe6, 0xe4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xea, 0xbd, 0x94, 0xb9, 0xb9, 0xb8, 0xb9, 0xb9, 0x9c, 0x9d, 0xa0, 0x90, 0xc7, 0xe8, 0xf5, 0xfa, 0xe6, 0xe4, 0xe6, 0xe4, 0xe9, 0xdd, 0x95, 0x91, 0x90, 0x90, 0xc0, 0xe9, 0xe7, 0xf3, 0xf2, 0xf1, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xe7, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xea, 0xf7, 0xec, 0x86, 0x83, 0x06, 0x51, 0x34, 0x53, 0x40, 0x3f, 0x37, 0x30, 0x2e, 0x2e, 0x2c, 0x2f, 0x2c, 0x23, 0x23, 0x25, 0x23, 0x23, 0x25, 0x23, 0x25, 0x23, 0x25, 0x23, 0x32, 0x32, 0x34, 0x40, 0x3f, 0x3d, 0x32, 0x3d, 0x38, 0x40, 0x32, 0x3c, 0x60, 0x80, 0xf3, 0xf2, 0xf2, 0xe8, 0xf4, 0xfa, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf9, 0xf1, 0xf9, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xf2, 0xf2, 0xf2, 0xe6, 0xe4, 0xe6, 0xae, 0xf2, 0xf9, 0xf4, 0xf1, 0xae, 0xf1, 0xe3, 0xe7, 0xdb, 0xc2, 0xd5, 0xcf, 0xc8, 0xaa, 0x8f, 0x8b, 0xab, 0xe6, 0xe7, 0xfb, 0xf9, 0xe8, 0xe6, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf6, 0xc0, 0x97, 0x9c, 0x9c, 0xb9, 0x9c, 0xb9, 0x9c, 0x9c, 0x9e, 0x94, 0xab, 0xe9, 0xfa, 0xfe, 0xe8, 0xad, 0xe7, 0xf5, 0xea, 0xab, 0x98, 0xa7, 0x9d, 0x99, 0x8f, 0xc0, 0xea, 0xe4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe4, 0xf6, 0xd7, 0x82, 0xaf, 0x03, 0x29, 0x3c, 0x23, 0x25, 0x27, 0x25, 0x35, 0x35, 0x44, 0x44, 0x48, 0x58, 0x5c, 0x5e, 0x5e, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x4e, 0x4e, 0x42, 0x29, 0x28, 0x20, 0x25, 0x23, 0x23, 0x46, 0x46, 0x40, 0x2e, 0x2b, 0x6c, 0x81, 0xf3, 0xfa, 0xe8, 0xae, 0xf9, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf8, 0xf1, 0xf3, 0xe6, 0xe6, 0xe6, 0xe6, 0xf2, 0xf2, 0xe6, 0xe4, 0xf1, 0xe7, 0xe7, 0xdd, 0xc7, 0xcf, 0xcf, 0xd5, 0xd5, 0xc5, 0x92, 0x90, 0xdf, 0xea, 0xfa, 0xf4, 0xe4, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xe4, 0xf7, 0xc7, 0x95, 0xa8, 0x9c, 0xa7, 0xa2, 0xa2, 0xa2, 0x9c, 0x9c, 0x99, 0xba, 0xe7, 0xf5, 0xfa, 0xf3, 0xe6, 0xae, 0xea, 0xe0, 0x96, 0xa6, 0xa3, 0x9d, 0xa3, 0x98, 0xb3, 0xdd, 0x85, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0x85, 0x85, 0xf0, 0xaf, 0x00, 0x01, 0x11, 0x42, 0x57, 0x60, 0x66, 0x6e, 0x73, 0x76, 0x79, 0x7b, 0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7b, 0x7b, 0x7a, 0x6f, 0x69, 0x5c, 0x44, 0x18, 0x1d, 0x27, 0x20, 0x33, 0x7a, 0xfb, 0xe4, 0xf5, 0xf2, 0xae, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf1, 0xe8, 0xf1, 0xe6, 0xe4, 0xf1, 0xf1, 0xe9, 0xdd, 0xcc, 0xd5, 0xcc, 0xd5, 0xd0, 0xd5, 0xc5, 0x96, 0xdd, 0xea, 0xfa, 0xf4, 0xe6, 0xe4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf6, 0xdd, 0x95, 0xb8, 0xa3, 0x9a, 0xa5, 0x9f, 0x9d, 0xb9, 0xb9, 0xa6, 0x96, 0xdf, 0xf6, 0xf9, 0xf3, 0xe8, 0xe8, 0xf6, 0xd9, 0xb8, 0xb8, 0xa8, 0x9f, 0xa7, 0xa6, 0x90, 0xc7, 0xea, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xe4, 0xea, 0xf6, 0xeb, 0x84, 0x00, 0x3a, 0x7a, 0x7a, 0x7c, 0x7c, 0x7b, 0x7b, 0x75, 0x75, 0x6c, 0x6c, 0x6b, 0x66, 0x66, 0x60, 0x66, 0x60, 0x60, 0x60, 0x68, 0x69, 0x6e, 0x6e, 0x71, 0x78, 0x78, 0x7b, 0x7c, 0x7c, 0x7b, 0x78, 0x67, 0x56, 0x22, 0x24, 0x7e, 0xfb, 0xf2, 0xf4, 0xf2, 0xe6, 0xe8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe8, 0xe7, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xe8, 0xe5, 0xe6, 0xf2, 0xf1, 0xf5, 0xe7, 0xe0, 0xcb, 0xd5, 0xd3, 0xcc, 0xcc, 0xd5, 0xcf, 0xc2, 0xe0, 0xe9, 0xfb, 0xf9, 0xe6, 0xe6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xea, 0xe4, 0xf6, 0xbf, 0x96, 0xa3, 0xa5, 0x9a, 0x9f, 0x9d, 0xb9, 0xb8, 0xa3, 0x95, 0xda, 0xe9, 0xf5, 0xf2, 0xe4, 0xe8, 0xf6, 0xd6, 0x98, 0xa8, 0xa2, 0xa5, 0x9f, 0x9c, 0x95, 0xc0, 0xea, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xf7, 0xed, 0x07, 0xde, 0x7f, 0x78, 0x6f, 0x60, 0x58, 0x58, 0x28, 0x21, 0x1f, 0x27, 0x25, 0x25, 0x25, 0x1d, 0x20, 0x27, 0x27, 0x27, 0x27, 0x20, 0x27, 0x27, 0x27, 0x21, 0x28, 0x36, 0x48, 0x5c, 0x69, 0x76, 0x7a, 0x7c, 0x7b, 0x70, 0x5d, 0x81, 0xf2, 0xe7, 0xf5, 0xf3, 0xe6, 0xe6, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xae, 0xf1, 0xf1, 0xf9, 0xf5, 0xf9, 0xf4, 0xf1, 0xf3, 0xe4, 0xf1, 0xf8, 0xf1, 0xe9, 0xe5, 0xd4, 0xd3, 0xcd, 0xd0, 0xd5, 0xcc, 0xd0, 0xc9, 0xe3, 0xe9, 0xfa, 0xf3, 0xf1, 0xe6, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xe4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xe7, 0xdf, 0xb5, 0xa6, 0x9b, 0xa5, 0x9f, 0xa7, 0xb9, 0xb8, 0xb9, 0x95, 0xc7, 0xe7, 0xe7, 0xf8, 0xf3, 0xf1, 0xf7, 0xc7, 0x97, 0xa7, 0xa8, 0x9f, 0xa5, 0xa5, 0x92, 0xc0, 0xe9, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xe4, 0xf3, 0xe4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf9, 0xf6, 0xf1, 0xf6, 0x85, 0xed, 0x01, 0x14, 0x26, 0x1d, 0x32, 0x23, 0x32, 0x32, 0x34, 0x32, 0x30, 0x32, 0x30, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x41, 0x40, 0x40, 0x38, 0x2f, 0x2f, 0x1d, 0x20, 0x61, 0x6d, 0x7c, 0x80, 0xf8, 0xe9, 0xe7, 0xe8, 0xf4, 0xf3, 0xae, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xe4, 0xea, 0xf8, 0xf4, 0xf8, 0xf3, 0xf3, 0xf3, 0xf2, 0xe8, 0xf9, 0xfa, 0xf1, 0xe7, 0xdd, 0xd2, 0xcd, 0xcc, 0xcc, 0xcc, 0xc9, 0xd6, 0xe5, 0xf1, 0xf2, 0xf8, 0xe6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe7, 0xea, 0xd6, 0x95, 0xa9, 0x9b, 0xa2, 0xa2, 0x9c, 0xb9, 0x9c, 0x99, 0xba, 0xe9, 0xe5, 0xf4, 0xf1, 0xe4, 0xea, 0xc7, 0x97, 0xa7, 0xa7, 0xa2, 0x9f, 0xa5, 0x92, 0xc1, 0xea, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfa, 0xf5, 0xe8, 0xf7, 0xbe, 0x84, 0x84, 0x0c, 0x5a, 0x32, 0x32, 0x38, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x32, 0x34, 0x3d, 0x34, 0x41, 0x34, 0x41, 0x34, 0x41, 0x34, 0x41, 0x3d, 0x40, 0x40, 0x3d, 0x3d, 0x37, 0x3e, 0x39, 0x1d, 0x29, 0x6a, 0x7f, 0xf2, 0xf4, 0xe5, 0xe6, 0xf3, 0xfe, 0xae, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe4, 0xe8, 0xe8, 0xea, 0xe3, 0xf6, 0xf6, 0xe4, 0xf8, 0x81, 0xe4, 0xf1, 0xf4, 0xf9, 0xf5, 0xe7, 0xe2, 0xd2, 0xc9, 0xd0, 0xcc, 0xcd, 0xcb, 0xda, 0xe9, 0xe7, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xfb, 0xe4, 0xf6, 0xce, 0x96, 0xb8, 0xb9, 0x9c, 0xa8, 0xa2, 0xa7, 0x97, 0x95, 0xdd, 0xe7, 0xf1, 0xf3, 0xe4, 0xf6, 0xc7, 0x97, 0xa2, 0xa8, 0xa2, 0xa5, 0x9e, 0x91, 0xd4, 0xf6, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf9, 0xf4, 0xe8, 0x85, 0xee, 0x82, 0x83, 0x06, 0x51, 0x3d, 0x2f, 0x23, 0x2f, 0x2e, 0x38, 0x40, 0x3d, 0x46, 0x46, 0x40, 0x40, 0x38, 0x3d, 0x38, 0x40, 0x40, 0x40, 0x40, 0x40, 0x38, 0x46, 0x38, 0x40, 0x3d, 0x47, 0x30, 0x31, 0x31, 0x1c, 0x5d, 0x80, 0xf2, 0xf1, 0xe7, 0xae, 0xf4, 0xfa, 0xae, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xe5, 0xc3, 0xb4, 0xbc, 0xda, 0xf6, 0xe4, 0xf8, 0xe8, 0xe7, 0xf2, 0xfa, 0xf1, 0xe9, 0xdf, 0xc9, 0xcd, 0xcd, 0xcc, 0xcb, 0xcb, 0xe0, 0xe9, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf8, 0xfe, 0xf1, 0xe9, 0xd4, 0xb7, 0x98, 0xa3, 0xa3, 0xa2, 0x9a, 0xa7, 0x98, 0xbc, 0xe3, 0xe8, 0xf2, 0xe6, 0x85, 0xd4, 0x9a, 0xa0, 0xa8, 0xa2, 0xa5, 0x9d, 0x99, 0xdf, 0xfa, 0xf9, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xea, 0xf1, 0x85, 0xf3, 0xf8, 0xb0, 0x86, 0x02, 0x1e, 0x2f, 0x2c, 0x2e, 0x2e, 0x2e, 0x37, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x3d, 0x40, 0x46, 0x3d, 0x40, 0x37, 0x3f, 0x1f, 0x6c, 0x7f, 0xf4, 0xf9, 0xe7, 0xad, 0xf4, 0xfe, 0xe7, 0xe6, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf4, 0xe8, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe7, 0xe5, 0xd1, 0xc1, 0xbf, 0x8f, 0x8d, 0xcb, 0xe9, 0xe4, 0xe5, 0xe5, 0xf2, 0xf9, 0xf2, 0xea, 0xdb, 0xc9, 0xcd, 0xcc, 0xcc, 0xc9, 0xd6, 0xea, 0xf1, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfb, 0xfe, 0xf9, 0xe7, 0xe9, 0xdf, 0xab, 0x96, 0x99, 0x9c, 0xa2, 0x9b, 0xb8, 0x95, 0xc4, 0xf7, 0xe6, 0xe5, 0x85, 0xc7, 0x97, 0xa0, 0xa8, 0xa7, 0xa7, 0x94, 0xc0, 0xe9, 0xfa, 0xfb, 0xe4, 0xe8, 0xf2, 0xe8, 0xf2, 0xf2, 0xf1, 0xf8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe4, 0xe8, 0xf1, 0xf1, 0xe8, 0xf2, 0xe8, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xe8, 0xf3, 0xfe, 0x80, 0xbb, 0x86, 0x83, 0x11, 0x45, 0x32, 0x34, 0x3d, 0x3d, 0x34, 0x37, 0x37, 0x30, 0x34, 0x37, 0x32, 0x34, 0x32, 0x34, 0x3d, 0x3f, 0x3f, 0x34, 0x3f, 0x31, 0x37, 0x34, 0x3d, 0x40, 0x46, 0x46, 0x38, 0x46, 0x20, 0x75, 0xfe, 0xfb, 0xf5, 0xae, 0xae, 0xf3, 0xfa, 0xe8, 0xe8, 0xf2, 0xe4, 0xea, 0xf6, 0xf6, 0xe7, 0xf1, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xea, 0xdf, 0xc7, 0xcf, 0xd5, 0xc5, 0x90, 0x90, 0xdb, 0xea, 0xe3, 0xe8, 0xf1, 0xf3, 0xe7, 0xe3, 0xd4, 0xcb, 0xcd, 0xcc, 0xc9, 0xcb, 0xdf, 0xe9, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xda, 0xbd, 0xb5, 0x98, 0xb9, 0x9d, 0x97, 0x92, 0xd8, 0xe8, 0xea, 0xe2, 0xab, 0xb9, 0xa5, 0x9f, 0xa5, 0x99, 0xba, 0xe2, 0xea, 0xe4, 0xe4, 0x85, 0xea, 0xe6, 0xe8, 0xe8, 0xf1, 0xea, 0xf8, 0xf4, 0xf4, 0xf9, 0xf1, 0xf2, 0xf1, 0xf1, 0xe8, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe8, 0xf1, 0xe8, 0xe8, 0xe7, 0xe4, 0xe6, 0xe6, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe6, 0xf1, 0xe8, 0xf1, 0xf2, 0xf2, 0xe8, 0xf3, 0xfb, 0xf6, 0xef, 0x86, 0x82, 0x09, 0x51, 0x2e, 0x32, 0x3d, 0x3d, 0x3d, 0x34, 0x3d, 0x41, 0x4a, 0x41, 0x38, 0x40, 0x38, 0x3d, 0x3d, 0x40, 0x38, 0x40, 0x38, 0x41, 0x3d, 0x40, 0x46, 0x40, 0x41, 0x30, 0x3e, 0x2e, 0x48, 0xff, 0xfa, 0xf9, 0xe8, 0xe8, 0xe3, 0xe8, 0xf1, 0xf2, 0xf9, 0xf6, 0xe7, 0xe0, 0xd8, 0xd6, 0xe3, 0xe9, 0xf2, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfb, 0xe4, 0xf2, 0xf4, 0xf1, 0xf1, 0xf1, 0xe7, 0xe7, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe9, 0xdf, 0xcb, 0xd2, 0xd5, 0xd5, 0xc2, 0x96, 0xce, 0xe9, 0xf1, 0xe4, 0xf2, 0xe5, 0xe9, 0xda, 0xc7, 0xcd, 0xcc, 0xcc, 0xcb, 0xda, 0xe9, 0xe7, 0xe4, 0xf3, 0xf2, 0xf2, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf3, 0xe4, 0xf1, 0xe8, 0xe9, 0xe2, 0xce, 0xa9, 0x95, 0x9b, 0xa2, 0x98, 0x99, 0xd8, 0xe0, 0xc1, 0xb7, 0xa8, 0xa5, 0xa5, 0xa5, 0x95, 0xd4, 0xf6, 0xe4, 0xf3, 0xf2, 0xfb, 0xe4, 0xe4, 0xea, 0xe8, 0xe8, 0xf8, 0xf1, 0xfa, 0xf2, 0xf1, 0xf5, 0xf2, 0xf1, 0xe6, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xf8, 0xf2, 0xea, 0xf2, 0xf2, 0xe4, 0xf2, 0xf2, 0xf3, 0xf1, 0xe6, 0xf2, 0xf2, 0xf1, 0xe6, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe6, 0xfa, 0xfb, 0xe8, 0xb2, 0x82, 0x03, 0x51, 0x38, 0x46, 0x46, 0x46, 0x3d, 0x38, 0x37, 0x32, 0x38, 0x3d, 0x3d, 0x34, 0x3d, 0x41, 0x40, 0x40, 0x41, 0x40, 0x41, 0x3f, 0x3d, 0x38, 0x46, 0x38, 0x40, 0x3d, 0x2f, 0x2f, 0x5c, 0xfa, 0xfa, 0xf4, 0xf1, 0xe8, 0xe5, 0xe8, 0xf1, 0xf9, 0xf2, 0xe4, 0xe3, 0xc7, 0x8f, 0x8f, 0xc0, 0xe8, 0xe9, 0xf8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe7, 0xe0, 0xcb, 0xd5, 0xcf, 0xd5, 0xc8, 0xbc, 0xcb, 0xe5, 0xe5, 0xf3, 0xe2, 0xf6, 0xdf, 0xcb, 0xd2, 0xc9, 0xcd, 0xc9, 0xd4, 0xe9, 0xe7, 0xe8, 0xf2, 0xf3, 0xf8, 0xf2, 0xe8, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf1, 0xf1, 0xf1, 0xf3, 0xe4, 0xe4, 0xe7, 0xe5, 0xe9, 0xe2, 0xc0, 0x94, 0x9c, 0x9d, 0x98, 0x94, 0xa6, 0x97, 0xa3, 0xa2, 0xa5, 0xa7, 0x99, 0xbf, 0xe7, 0xe9, 0xf1, 0xf4, 0xfe, 0xf8, 0xf4, 0xf2, 0xe7, 0xea, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xfb, 0xf2, 0xf8, 0xf2, 0xf4, 0xf2, 0xfa, 0xf8, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xfa, 0xf6, 0xc3, 0x82, 0x00, 0x19, 0x39, 0x2c, 0x2e, 0x2e, 0x2e, 0x2c, 0x2c, 0x3c, 0x2e, 0x3f, 0x30, 0x34, 0x34, 0x34, 0x34, 0x34, 0x41, 0x34, 0x41, 0x37, 0x3d, 0x40, 0x37, 0x3e, 0x34, 0x46, 0x4b, 0x1b, 0x75, 0xff, 0xf9, 0xfb, 0xe4, 0xe8, 0xe6, 0xf1, 0xf1, 0xf2, 0xf1, 0xea, 0xe0, 0xc4, 0xac, 0xab, 0x96, 0xcb, 0xea, 0xe7, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf8, 0xf3, 0xf3, 0xe4, 0xf3, 0xf3, 0xf3, 0xf8, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe5, 0xd6, 0xd4, 0xd3, 0xd5, 0xcf, 0xc2, 0xc4, 0xdf, 0xe7, 0xe5, 0xe9, 0xdd, 0xcb, 0xcd, 0xc9, 0xd2, 0xcd, 0xd1, 0xe0, 0xe9, 0xe7, 0xf1, 0xfb, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xe7, 0xf1, 0xf2, 0xf8, 0xf3, 0xe8, 0xe4, 0xae, 0xe5, 0xae, 0xe2, 0xc2, 0x92, 0xa2, 0x97, 0x9a, 0x9b, 0x9e, 0xa5, 0xa8, 0xa0, 0xa6, 0x98, 0xdb, 0xe9, 0xf1, 0xfb, 0xf9, 0x80, 0xf9, 0xf1, 0xe9, 0xe7, 0xdf, 0xce, 0xd9, 0xe2, 0xf6, 0xe8, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xe6, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf8, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf9, 0xf4, 0xf1, 0xf4, 0xf2, 0xf9, 0xf2, 0xf2, 0xf2, 0xf1, 0xe8, 0xf9, 0xf1, 0xe6, 0xf3, 0xf4, 0xea, 0xdf, 0xaf, 0x83, 0x0c, 0x49, 0x31, 0x30, 0x30, 0x34, 0x37, 0x32, 0x32, 0x46, 0x38, 0x34, 0x34, 0x34, 0x3d, 0x34, 0x40, 0x41, 0x40, 0x41, 0x3d, 0x4a, 0x4a, 0x34, 0x31, 0x34, 0x4a, 0x2f, 0x3b, 0x7c, 0xfa, 0xf9, 0xf4, 0xf1, 0xe8, 0xe5, 0xe8, 0xf1, 0xf4, 0xe4, 0xea, 0xdd, 0xc8, 0xc8, 0xc5, 0xc2, 0xbc, 0xdf, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf3, 0xfb, 0xea, 0xea, 0xe7, 0xe8, 0xf3, 0xf8, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe4, 0xe9, 0xdd, 0xd4, 0xd3, 0xd5, 0xcc, 0xc8, 0xc7, 0xd2, 0xdd, 0xe0, 0xdb, 0xcb, 0xcc, 0xc9, 0xcc, 0xcb, 0xc7, 0xdf, 0xe9, 0xf1, 0xf2, 0xf4, 0xf4, 0xf8, 0xf4, 0xf1, 0xe7, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xe4, 0xf3, 0xe8, 0xf1, 0xf3, 0xe6, 0xea, 0xc0, 0x92, 0xa2, 0x9a, 0x9a, 0xa1, 0x9e, 0x9f, 0x9c, 0xb7, 0xbf, 0xea, 0xe5, 0xf9, 0xf5, 0xfa, 0xf9, 0xea, 0xf1, 0xe5, 0xbd, 0x8d, 0x8b, 0x88, 0x8d, 0xce, 0xf7, 0xe7, 0xe4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xe6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xae, 0xf6, 0xd9, 0xc1, 0xc1, 0xce, 0xea, 0xf6, 0xe4, 0xf4, 0xf4, 0xf1, 0xf4, 0xf9, 0xf4, 0xf2, 0xe8, 0xe4, 0xf2, 0xf9, 0xe6, 0xf2, 0xf4, 0xf1, 0xf7, 0xb6, 0x84, 0x05, 0x39, 0x2c, 0x23, 0x2e, 0x23, 0x23, 0x25, 0x20, 0x25, 0x20, 0x1f, 0x1f, 0x1f, 0x20, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x23, 0x38, 0x40, 0x30, 0x31, 0x31, 0x53, 0x23, 0x60, 0xfe, 0xfe, 0xf5, 0xf1, 0xe8, 0xe8, 0xe8, 0xf1, 0xf1, 0xf1, 0xfb, 0xe8, 0xdd, 0xc4, 0xc8, 0xc8, 0xc5, 0xbf, 0xc1, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xea, 0xe2, 0xd6, 0xc3, 0xc7, 0xe2, 0xea, 0xf1, 0xf8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe5, 0xe7, 0xd8, 0xcb, 0xd5, 0xd0, 0xd0, 0xd0, 0xcc, 0xcb, 0xcb, 0xc9, 0xc8, 0xcc, 0xcc, 0xcd, 0xcb, 0xdc, 0xe9, 0xf4, 0xf5, 0xf2, 0xfb, 0xf4, 0xf2, 0xf2, 0xf1, 0xf1, 0xe7, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe7, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf1, 0xfe, 0xf9, 0xe7, 0xe0, 0xbf, 0x94, 0x9d, 0x9a, 0x9f, 0x9f, 0x9f, 0xa3, 0x96, 0xd8, 0xe9, 0xf1, 0xf1, 0xf9, 0xfa, 0xe4, 0xe7, 0xe2, 0xbd, 0x91, 0x91, 0x92, 0x90, 0x8d, 0x8d, 0xd7, 0xf6, 0xe8, 0xf1, 0xf4, 0xf4, 0xf4, 0xf2, 0xe8, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xe8, 0xe6, 0xe7, 0xc3, 0x90, 0xb3, 0x8f, 0x8f, 0x8f, 0xcb, 0xea, 0xf1, 0xf1, 0xf2, 0xf9, 0xf9, 0xf4, 0xf2, 0xf1, 0xe6, 0xf9, 0xf2, 0xae, 0xe6, 0xf9, 0xea, 0xe6, 0xd7, 0x82, 0x01, 0x15, 0x42, 0x44, 0x58, 0x5c, 0x68, 0x66, 0x6f, 0x73, 0x75, 0x75, 0x79, 0x75, 0x79, 0x75, 0x76, 0x70, 0x6b, 0x66, 0x57, 0x44, 0x35, 0x21, 0x1e, 0x1d, 0x2f, 0x27, 0x79, 0xfe, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xfe, 0xf5, 0xdf, 0xc8, 0xc8, 0xc8, 0xc8, 0xc2, 0xbe, 0xe2, 0xea, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xe7, 0xe2, 0xcb, 0xc0, 0xc4, 0xbd, 0xbd, 0xdf, 0xe7, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xe8, 0xe7, 0xe2, 0xd8, 0xcb, 0xd2, 0xd0, 0xc8, 0xcc, 0xcd, 0xcb, 0xcd, 0xcc, 0xcc, 0xcc, 0xc9, 0xda, 0xe7, 0xe8, 0xf4, 0xf2, 0xf4, 0xf9, 0xf3, 0xf9, 0xf2, 0xf1, 0xe7, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf8, 0xf8, 0x81, 0xf8, 0xea, 0xdf, 0x95, 0x9b, 0x9b, 0x9a, 0xa5, 0x9f, 0xa6, 0xbc, 0xe2, 0xe7, 0xf1, 0xe4, 0xf9, 0xf9, 0xe7, 0xf6, 0xc4, 0x95, 0x9c, 0x9b, 0x9b, 0x94, 0x99, 0x8b, 0xa4, 0xea, 0xf6, 0xf1, 0xf2, 0xf2, 0xf4, 0xe8, 0xe6, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xe5, 0xda, 0x91, 0xb7, 0x98, 0x99, 0x96, 0x90, 0x8b, 0xc0, 0xf6, 0xe7, 0xf1, 0xf5, 0xf4, 0xf2, 0xf9, 0xe6, 0xe4, 0xf4, 0xf1, 0xe6, 0xe6, 0xf9, 0xf9, 0xf6, 0xe0, 0xb6, 0x17, 0x72, 0x7e, 0x7c, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7b, 0x75, 0x6c, 0x6b, 0x5c, 0x62, 0x7e, 0xe4, 0xe8, 0xf2, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf1, 0xf2, 0xf9, 0xfb, 0xe0, 0xc7, 0xcc, 0xc8, 0xcc, 0xc9, 0xbf, 0xdc, 0xea, 0xf4, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xe9, 0xdd, 0xc4, 0xd5, 0xc5, 0xc8, 0xbf, 0xc4, 0xe9, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xe7, 0xe5, 0xd8, 0xcb, 0xcd, 0xcd, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc9, 0xd6, 0xe2, 0xf6, 0xf1, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xfe, 0xe4, 0xf6, 0xc2, 0x95, 0x9b, 0x9d, 0x9a, 0x9f, 0x98, 0xc4, 0xf6, 0xe4, 0xf1, 0xe6, 0xf1, 0xf1, 0xe9, 0xdf, 0x91, 0xa9, 0x9b, 0x9e, 0x9a, 0x9b, 0xa3, 0x90, 0xb3, 0xea, 0xe3, 0xea, 0xf2, 0xf4, 0xf4, 0xf2, 0xe6, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xe7, 0xf7, 0xbd, 0x96, 0xb8, 0xa0, 0x9d, 0x97, 0x99, 0x92, 0x8d, 0xd6, 0xe9, 0xe7, 0xe4, 0xf4, 0xf4, 0xf3, 0xf1, 0xe6, 0xf9, 0xf2, 0xad, 0xe4, 0xfa, 0xfa, 0xe5, 0x85, 0xf6, 0xf7, 0x81, 0x74, 0x71, 0x6b, 0x68, 0x5e, 0x57, 0x48, 0x26, 0x26, 0x21, 0x21, 0x21, 0x26, 0x21, 0x2d, 0x44, 0x5c, 0x5c, 0x67, 0x6c, 0x70, 0x7a, 0x7c, 0x7d, 0x7d, 0xff, 0xe7, 0xe3, 0xe8, 0xf1, 0xe7, 0xf2, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf8, 0xe9, 0xe5, 0xd1, 0xc9, 0xcc, 0xc8, 0xc8, 0xc0, 0xd8, 0xf6, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xe9, 0xd6, 0xcd, 0xc8, 0xc8, 0xcf, 0xc2, 0xc1, 0xe2, 0xea, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xf2, 0xe8, 0xf1, 0xe7, 0xe7, 0xda, 0xc9, 0xcd, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xd2, 0xcb, 0xe0, 0xea, 0xe8, 0xf2, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xe7, 0xf1, 0xe7, 0xf1, 0xf1, 0xf1, 0xe5, 0xe4, 0xe4, 0x81, 0xe6, 0xdb, 0xb8, 0x97, 0x9d, 0x9a, 0xa1, 0x92, 0xda, 0xea, 0xf9, 0xe4, 0xe4, 0xae, 0xf1, 0xe9, 0xc3, 0xb7, 0xb8, 0x9d, 0x9a, 0x9a, 0x9d, 0x97, 0x91, 0x93, 0xf6, 0xe8, 0xe4, 0xf5, 0xf4, 0xf2, 0xf3, 0xe6, 0xe8, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xe8, 0xe9, 0xbc, 0xba, 0xa8, 0x9d, 0x9f, 0xa5, 0x9b, 0x99, 0x91, 0xa4, 0xae, 0xe9, 0xe7, 0xf1, 0xf9, 0xf2, 0xf1, 0xae, 0xf9, 0xe8, 0xae, 0xe6, 0xfe, 0xf9, 0xf5, 0xe7, 0xf7, 0x52, 0x0e, 0x1a, 0x1a, 0x18, 0x18, 0x1d, 0x1d, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x23, 0x1d, 0x2c, 0x25, 0x27, 0x27, 0x44, 0x58, 0x6e, 0x7b, 0x7f, 0xe4, 0xe4, 0xe5, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe7, 0xe7, 0xe5, 0xd6, 0xc9, 0xc8, 0xcc, 0xc8, 0xc2, 0xd2, 0xe8, 0xf4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xe7, 0xcb, 0xd5, 0xc8, 0xcf, 0xc8, 0xc8, 0xc1, 0xe2, 0xf9, 0xe4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf2, 0xe4, 0xea, 0xf1, 0xe7, 0xe7, 0xda, 0xc9, 0xd0, 0xd0, 0xd0, 0xd2, 0xd1, 0xcb, 0xdc, 0xe9, 0xe7, 0xe4, 0xe8, 0xe8, 0xe8, 0xe7, 0xe8, 0xe7, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xe7, 0xf1, 0xe7, 0xe8, 0xe5, 0xe7, 0xf3, 0xe4, 0xe8, 0xe7, 0xbf, 0x98, 0x9a, 0x9a, 0xa5, 0x95, 0xe2, 0xe6, 0xf2, 0xe6, 0xe6, 0xf1, 0xf2, 0xe5, 0xbd, 0x96, 0xa8, 0x9d, 0x9d, 0xa2, 0x97, 0x9c, 0x90, 0xc0, 0xea, 0xea, 0xf2, 0xf4, 0xf3, 0xf3, 0xf2, 0xea, 0xf9, 0xf9, 0xf4, 0xf4, 0xf3, 0xe4, 0xf2, 0xf1, 0xf2, 0xf1, 0xe9, 0xc4, 0x96, 0xa7, 0xa5, 0x9f, 0xa2, 0xa7, 0xa0, 0xb8, 0x91, 0xdd, 0xe7, 0xf1, 0xf5, 0xf1, 0xf4, 0xf2, 0xfa, 0xfe, 0xf4, 0xe6, 0xf1, 0xf9, 0xfa, 0xf3, 0xe8, 0xde, 0x84, 0x83, 0x22, 0x1f, 0x1d, 0x23, 0x23, 0x23, 0x23, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x2e, 0x30, 0x34, 0x30, 0x32, 0x41, 0x32, 0x32, 0x32, 0x16, 0x56, 0x7f, 0xf3, 0xe4, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xe4, 0xf1, 0xe5, 0xda, 0xc7, 0xcd, 0xcc, 0xc8, 0xc8, 0xc9, 0xe5, 0xe7, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xe0, 0xd2, 0xc9, 0xd5, 0xcf, 0xcf, 0xc9, 0xc7, 0xe2, 0xea, 0xf1, 0xe8, 0xf1, 0xe6, 0xf8, 0xf3, 0xf3, 0xf5, 0xe4, 0xe7, 0xe5, 0xf1, 0xf1, 0xf5, 0xe4, 0xe9, 0xe2, 0xd6, 0xc9, 0xd0, 0xcc, 0xcd, 0xce, 0xd6, 0xe7, 0xe8, 0xf1, 0xe8, 0xf2, 0xf8, 0xf2, 0xe8, 0xf1, 0xf2, 0xf4, 0xfa, 0xfe, 0xf8, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xae, 0xf1, 0xe8, 0xf1, 0xf2, 0xf5, 0xf2, 0xea, 0xd6, 0x96, 0x9a, 0x9a, 0x9d, 0x96, 0xe2, 0xad, 0xe4, 0xe8, 0xe5, 0xf2, 0xf3, 0xe6, 0xab, 0xb7, 0xa7, 0x9b, 0x9d, 0x9c, 0x9c, 0x99, 0x90, 0xd9, 0x85, 0xe8, 0xf3, 0xf3, 0xf3, 0xe8, 0xf2, 0xf4, 0xfb, 0xfa, 0xf4, 0xf2, 0xe4, 0xf3, 0xe6, 0xe4, 0xf2, 0xf1, 0xe9, 0xd8, 0xb7, 0xa0, 0xa5, 0xa2, 0xa2, 0xb9, 0x9b, 0x97, 0x96, 0xd9, 0xe9, 0xf5, 0xf5, 0xe4, 0xf4, 0xf1, 0xfa, 0xf9, 0xea, 0xe4, 0xe7, 0xf8, 0xf8, 0xfe, 0xfb, 0xe9, 0xb0, 0x84, 0x19, 0x25, 0x23, 0x23, 0x30, 0x23, 0x23, 0x32, 0x23, 0x32, 0x23, 0x30, 0x2e, 0x2e, 0x32, 0x2e, 0x32, 0x32, 0x38, 0x2e, 0x30, 0x34, 0x41, 0x25, 0x3b, 0x7f, 0xe4, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xe4, 0xe7, 0xdb, 0xc7, 0xcc, 0xcc, 0xcc, 0xc8, 0xc4, 0xe2, 0xe7, 0xe8, 0xf2, 0xf3, 0xf8, 0xf2, 0xf2, 0xe8, 0xdf, 0xcb, 0xd0, 0xd0, 0xcf, 0xcc, 0xcd, 0xcb, 0xe7, 0xe7, 0xf5, 0xe7, 0xe4, 0x85, 0xf3, 0xf3, 0xfe, 0xe8, 0xea, 0xe3, 0xe5, 0xe7, 0xf2, 0xf4, 0xf4, 0xf5, 0xe5, 0xda, 0xc9, 0xd0, 0xcc, 0xcb, 0xc7, 0xe0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf3, 0xea, 0xf6, 0xf6, 0xf5, 0xf9, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xf5, 0xf1, 0xf5, 0xe8, 0xe2, 0xba, 0x9b, 0x9f, 0x9b, 0x95, 0xe3, 0x85, 0xf1, 0xf2, 0xf5, 0xf2, 0xf2, 0xf6, 0xc3, 0x99, 0x9c, 0x9a, 0x9f, 0x9c, 0xb8, 0x92, 0xbf, 0xe6, 0xe9, 0xf9, 0xfb, 0xf9, 0xe8, 0xea, 0xf6, 0xea, 0xea, 0xf6, 0xe8, 0xe7, 0xf3, 0xe4, 0xf3, 0xf2, 0xf2, 0xf1, 0xe9, 0xe9, 0xc7, 0x98, 0xa3, 0xa3, 0xb9, 0xb9, 0xa0, 0xa6, 0x92, 0xd8, 0xe9, 0xf8, 0xfb, 0xe4, 0xe6, 0xe3, 0xe7, 0xf6, 0xe5, 0xf6, 0xe7, 0xae, 0xf2, 0xf3, 0xf3, 0xf7, 0xbb, 0x84, 0x10, 0x2f, 0x23, 0x30, 0x32, 0x32, 0x23, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x38, 0x2e, 0x34, 0x41, 0x46, 0x1d, 0x5e, 0x7e, 0xf8, 0xf4, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf2, 0xf2, 0xf2, 0xe7, 0xe0, 0xc7, 0xcd, 0xc8, 0xcc, 0xc8, 0xc7, 0xe0, 0xe7, 0xe7, 0xf3, 0xe4, 0xf8, 0xe8, 0xf1, 0xea, 0xdb, 0xc9, 0xd3, 0xcc, 0xcc, 0xcc, 0xcb, 0xd6, 0xf6, 0xf1, 0xf1, 0xe8, 0xe5, 0xe7, 0xf6, 0xf6, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xf2, 0xf9, 0xfe, 0xf9, 0xf1, 0xe7, 0xd8, 0xc9, 0xd0, 0xcc, 0xcb, 0xd8, 0xea, 0xe7, 0xf2, 0xf2, 0xe7, 0xe4, 0xe9, 0xe2, 0xd8, 0xc1, 0xcb, 0xdd, 0xe9, 0xe7, 0xe7, 0xe4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf1, 0xf2, 0xf2, 0xe4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf9, 0xf4, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xe8, 0xf1, 0xf1, 0xf1, 0xe7, 0xe9, 0xc4, 0x94, 0xa2, 0x9a, 0x95, 0xdd, 0xea, 0xf8, 0xfa, 0xf1, 0xf2, 0xe8, 0xe9, 0xdd, 0x96, 0x9c, 0xa5, 0x9a, 0xa2, 0x98, 0x96, 0xdf, 0x85, 0xf4, 0xfb, 0xf4, 0xf1, 0xf6, 0xdf, 0xc1, 0x93, 0xb3, 0xc0, 0xdf, 0xf6, 0xe5, 0xe8, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xe7, 0xe5, 0xc4, 0x99, 0xb8, 0xb9, 0xb9, 0x9c, 0xa2, 0x95, 0xd8, 0x85, 0xf4, 0xfe, 0xf8, 0xe6, 0xe5, 0xe7, 0xc4, 0xbd, 0xc4, 0xdd, 0xe7, 0xe5, 0xea, 0xf8, 0xf7, 0xee, 0x86, 0x0a, 0x20, 0x32, 0x32, 0x32, 0x32, 0x23, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x38, 0x3d, 0x3d, 0x40, 0x38, 0x3d, 0x2f, 0x34, 0x34, 0x3d, 0x20, 0x69, 0x80, 0xf9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xe7, 0xe2, 0xc7, 0xcc, 0xcd, 0xcc, 0xc8, 0xc7, 0xe0, 0xe8, 0xf1, 0xf2, 0xf8, 0xe4, 0xf2, 0xe3, 0xe7, 0xd8, 0xcc, 0xd0, 0xd0, 0xd0, 0xd5, 0xcb, 0xda, 0xf6, 0xf1, 0xf9, 0xe7, 0xea, 0xdf, 0xd6, 0xd9, 0xe9, 0xf4, 0xe4, 0xf8, 0xf3, 0xf8, 0xfe, 0xf9, 0xf4, 0xe7, 0xe0, 0xd2, 0xc9, 0xd3, 0xcd, 0xcb, 0xe0, 0xe9, 0xf1, 0xf1, 0xf2, 0xf1, 0xe7, 0xe2, 0xcb, 0xba, 0x91, 0x90, 0x91, 0xc4, 0xe2, 0xe6, 0xe5, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf4, 0xf1, 0xf2, 0xf9, 0xf2, 0xf1, 0xe8, 0xf2, 0xf1, 0xe7, 0xf1, 0xf1, 0xe8, 0xe8, 0xdb, 0xb7, 0x9d, 0x9d, 0x94, 0xd8, 0xe9, 0xf9, 0xfa, 0xf4, 0xf1, 0xae, 0xf5, 0xf6, 0xbc, 0x97, 0x9f, 0x9a, 0x99, 0x95, 0xc4, 0xf6, 0xe7, 0xf4, 0xf4, 0xf5, 0xea, 0xdf, 0x91, 0x8d, 0x90, 0x91, 0x8f, 0x91, 0xd6, 0xf6, 0xe7, 0xe7, 0xf1, 0xe8, 0xe6, 0xf3, 0xe8, 0xe5, 0xe3, 0xc7, 0xb5, 0xa6, 0xb8, 0xa2, 0x9c, 0x95, 0xda, 0xea, 0xfe, 0xf8, 0xfe, 0xae, 0xea, 0xd4, 0x91, 0x95, 0x95, 0x95, 0xd8, 0xe9, 0xe6, 0xf2, 0xe9, 0xf0, 0x8c, 0x06, 0x26, 0x23, 0x23, 0x34, 0x23, 0x31, 0x23, 0x30, 0x23, 0x30, 0x23, 0x2e, 0x30, 0x2e, 0x2e, 0x34, 0x32, 0x37, 0x2e, 0x30, 0x34, 0x2f, 0x1e, 0x75, 0xf3, 0xae, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf8, 0xf3, 0xe5, 0xe2, 0xc9, 0xcd, 0xcc, 0xcd, 0xc8, 0xc7, 0xdf, 0xe9, 0xf1, 0xf3, 0xf8, 0xf1, 0xe8, 0xe5, 0xe5, 0xd2, 0xcc, 0xcc, 0xd5, 0xd0, 0xd2, 0xd1, 0xe2, 0xf1, 0xf4, 0xf9, 0xea, 0xdf, 0xc4, 0xbd, 0xb3, 0xdc, 0xea, 0xf3, 0xf3, 0xfe, 0xf8, 0xfe, 0xf4, 0xf2, 0xe9, 0xd8, 0xd2, 0xcc, 0xcd, 0xc9, 0xda, 0xe7, 0xe5, 0xe8, 0xf1, 0xf1, 0xe7, 0xe7, 0xda, 0xc0, 0xcf, 0xc5, 0xaa, 0xa7, 0x98, 0xc7, 0xf6, 0xe5, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xe4, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xe8, 0xf2, 0xe7, 0xf2, 0xe8, 0xe5, 0xe3, 0xbf, 0x98, 0x9d, 0x94, 0xc4, 0xe5, 0xfb, 0xf9, 0xf9, 0xf2, 0xe7, 0xf9, 0xf6, 0xc7, 0x92, 0x9f, 0x9a, 0x9c, 0xb5, 0xdf, 0xe8, 0xe6, 0xe8, 0xf4, 0xe7, 0xe5, 0xbc, 0x90, 0xb8, 0x9c, 0xa3, 0xb8, 0x98, 0x91, 0xc1, 0xe2, 0xe7, 0xe7, 0xe4, 0xe6, 0xf8, 0xe4, 0xf1, 0xe5, 0xe7, 0xbf, 0xb7, 0xb9, 0x9b, 0xb9, 0x95, 0xd8, 0xea, 0xf3, 0xfe, 0xfe, 0xe8, 0xe0, 0x96, 0x99, 0x9b, 0x9c, 0x98, 0x96, 0xdf, 0xe8, 0xe8, 0xf6, 0xea, 0x93, 0x02, 0x1a, 0x25, 0x32, 0x32, 0x30, 0x30, 0x30, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x34, 0x34, 0x2c, 0x22, 0x7c, 0xad, 0xad, 0xae, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf1, 0xe7, 0xe2, 0xcb, 0xc9, 0xcc, 0xcc, 0xcc, 0xc9, 0xdf, 0xea, 0xe4, 0xf2, 0xf8, 0xf3, 0xe3, 0xe9, 0xdf, 0xcb, 0xd0, 0xcc, 0xd0, 0xd2, 0xc9, 0xdc, 0xe9, 0xf1, 0xfa, 0xf9, 0xe5, 0xcb, 0xd2, 0xd5, 0xc0, 0xc0, 0xfb, 0xf1, 0xf3, 0xf4, 0xfb, 0xf8, 0xf1, 0xe9, 0xdd, 0xcb, 0xd3, 0xcd, 0xcd, 0xc7, 0xe0, 0xe2, 0xe8, 0xf2, 0xf2, 0xf2, 0xe9, 0xe2, 0xc9, 0xc8, 0xc8, 0xcf, 0xc5, 0xac, 0xaa, 0xbc, 0xe2, 0xe9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf2, 0xea, 0xe8, 0xf3, 0xf2, 0xe8, 0xe7, 0xf2, 0xf1, 0xe6, 0xe8, 0xcb, 0x98, 0x9d, 0xb9, 0xba, 0xe2, 0xe5, 0xf4, 0x81, 0xf1, 0xe3, 0xf5, 0xf6, 0xc7, 0x97, 0x9f, 0x9b, 0x98, 0xc0, 0xe5, 0x85, 0xe6, 0xe8, 0xe7, 0xea, 0xdf, 0x96, 0x9c, 0x9b, 0x9d, 0x9d, 0x99, 0xa3, 0xb7, 0x95, 0xbc, 0xe5, 0xe5, 0xea, 0xae, 0xe4, 0xf3, 0xf1, 0xe7, 0xe9, 0xda, 0xb7, 0xa6, 0x9b, 0xa9, 0x92, 0xc7, 0xf6, 0xe7, 0xf8, 0xf2, 0xf6, 0xcb, 0x95, 0x9c, 0x9b, 0x9b, 0x9c, 0x96, 0xcb, 0xea, 0xe8, 0xe8, 0xf7, 0xec, 0x00, 0x1a, 0x25, 0x23, 0x32, 0x23, 0x32, 0x23, 0x32, 0x23, 0x32, 0x23, 0x32, 0x32, 0x32, 0x38, 0x3d, 0x38, 0x38, 0x3d, 0x41, 0x3d, 0x2e, 0x5c, 0x7d, 0x85, 0xae, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf3, 0xf8, 0xe7, 0xe5, 0xc9, 0xcd, 0xcc, 0xcc, 0xcc, 0xc7, 0xdf, 0xe9, 0xe7, 0xf8, 0xf2, 0xf1, 0xe7, 0xe9, 0xd8, 0xcc, 0xd5, 0xd0, 0xd3, 0xd1, 0xd6, 0xe2, 0xe9, 0xf2, 0xf8, 0xe9, 0xf0, 0xcb, 0xd5, 0xd5, 0xd0, 0xbd, 0xe0, 0xea, 0xe7, 0xf1, 0xf1, 0xe9, 0xea, 0xe0, 0xd6, 0xcb, 0xd3, 0xd0, 0xcb, 0xd2, 0xe5, 0xe5, 0xe7, 0xf2, 0xf2, 0xe8, 0xe7, 0xe2, 0xc9, 0xc9, 0xc8, 0xc8, 0xc5, 0xc5, 0xac, 0xbc, 0xdf, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xe4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xe8, 0xf2, 0xe8, 0xf1, 0xe8, 0xe7, 0xe3, 0xf1, 0xf2, 0xf2, 0xe8, 0xe7, 0xf2, 0xf1, 0xea, 0xe8, 0xe0, 0xb7, 0x9c, 0xa8, 0x98, 0xd3, 0xf6, 0xe4, 0xf8, 0xf2, 0xe7, 0xf1, 0xf6, 0xc4, 0x98, 0x9b, 0x9b, 0x91, 0xda, 0xf7, 0xf2, 0xe6, 0xe8, 0xe8, 0xe7, 0xdf, 0xb7, 0x99, 0x9a, 0x9f, 0x9b, 0xa7, 0xa7, 0x9c, 0xa6, 0x95, 0xab, 0xe2, 0xe2, 0xf1, 0xe3, 0xf1, 0xf9, 0xf8, 0xe5, 0xe0, 0xaa, 0x9c, 0xa2, 0x9b, 0xb8, 0x95, 0xcd, 0xe3, 0xe7, 0xe9, 0xe0, 0xba, 0x98, 0x9b, 0x9d, 0x9d, 0x9c, 0x98, 0xbf, 0xf7, 0xe7, 0xf1, 0xf6, 0xef, 0x82, 0x11, 0x21, 0x23, 0x1d, 0x1d, 0x1f, 0x1d, 0x21, 0x29, 0x36, 0x36, 0x36, 0x29, 0x29, 0x21, 0x1c, 0x1c, 0x25, 0x25, 0x2c, 0x23, 0x25, 0x6b, 0x7e, 0xf3, 0xf8, 0xfa, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf8, 0xf8, 0xe9, 0xe2, 0xcb, 0xcd, 0xcc, 0xcd, 0xcc, 0xc9, 0xdf, 0xe9, 0xf1, 0xf8, 0xf2, 0xe4, 0xe5, 0xe5, 0xcb, 0xd3, 0xcc, 0xd3, 0xcb, 0xd4, 0xdf, 0xe9, 0xe5, 0xf3, 0xf4, 0xea, 0xdb, 0xd4, 0xd5, 0xcf, 0xd5, 0xc9, 0xd6, 0xe2, 0xe9, 0xe9, 0xe5, 0xe5, 0xdd, 0xd4, 0xcb, 0xd0, 0xd5, 0xd0, 0xcb, 0xd8, 0xf6, 0xe5, 0xf3, 0xe4, 0xf2, 0xf1, 0xe7, 0xe0, 0xc7, 0xc8, 0xc9, 0xc8, 0xc5, 0xc5, 0xc2, 0xbf, 0xde, 0xe9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xf6, 0xf7, 0xf6, 0xe6, 0xf3, 0xf2, 0xe7, 0xe8, 0xe8, 0xf3, 0xf2, 0xe6, 0xe7, 0xc0, 0x98, 0xa2, 0x99, 0xa9, 0xe5, 0x85, 0xf3, 0xf4, 0xf1, 0xe7, 0xf6, 0xbf, 0x94, 0x9d, 0x99, 0xba, 0xe0, 0xea, 0xf3, 0xe8, 0xe8, 0xf4, 0xe9, 0xe0, 0xba, 0x98, 0xa7, 0x9b, 0xa2, 0x9c, 0x9c, 0x9d, 0x9b, 0xa6, 0x95, 0xc1, 0xf6, 0xe7, 0xe3, 0xe3, 0xf8, 0xf9, 0xe8, 0xe0, 0xaa, 0x97, 0xa7, 0x9b, 0xa8, 0x97, 0x98, 0xac, 0xdd, 0xe0, 0xc9, 0x98, 0xa7, 0x9b, 0x9d, 0x9d, 0x9d, 0x96, 0xc0, 0xe9, 0xe3, 0xe8, 0xf5, 0xfa, 0x86, 0x0e, 0x22, 0x21, 0x57, 0x66, 0x6e, 0x76, 0x79, 0x78, 0x78, 0x7b, 0x7b, 0x7a, 0x78, 0x75, 0x71, 0x6c, 0x5e, 0x57, 0x29, 0x21, 0x16, 0x7b, 0x81, 0xe3, 0xf2, 0xfa, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf3, 0xf8, 0xe9, 0xe2, 0xcb, 0xc9, 0xd0, 0xcc, 0xcc, 0xc9, 0xdf, 0xe7, 0xf1, 0xf8, 0xf3, 0xf2, 0xe5, 0xdd, 0xcb, 0xd3, 0xcc, 0xd3, 0xcb, 0xdb, 0xe5, 0xe5, 0xf1, 0xe8, 0xf4, 0xe9, 0xdc, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd6, 0xd8, 0xd8, 0xd8, 0xd6, 0xd2, 0xcd, 0xd3, 0xd3, 0xd3, 0xd0, 0xcb, 0xdd, 0xe9, 0xe5, 0xf2, 0xf8, 0xf2, 0xe8, 0xe5, 0xe2, 0xc8, 0xc8, 0xc9, 0xc9, 0xc8, 0xc5, 0xc2, 0xbf, 0xe2, 0xea, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xe8, 0xe7, 0xea, 0xe3, 0xce, 0xc3, 0xce, 0xe1, 0xf7, 0x85, 0xe7, 0xe8, 0xe8, 0xf2, 0xe4, 0xe6, 0xe7, 0xda, 0xb9, 0xa3, 0x9b, 0x95, 0xc7, 0xae, 0xf7, 0xe4, 0xf5, 0xe7, 0xe5, 0x96, 0x99, 0xa7, 0x98, 0xc4, 0xe9, 0x85, 0xf3, 0xf3, 0xf4, 0xf4, 0xe9, 0xe7, 0xd2, 0x95, 0x99, 0xb9, 0x9c, 0xb9, 0x9c, 0x9f, 0xa5, 0x9a, 0xa6, 0x91, 0xc7, 0xe5, 0xe5, 0xe5, 0xf1, 0xf9, 0xea, 0xdb, 0x96, 0xa7, 0x9a, 0xa5, 0x9d, 0xa0, 0xa5, 0x94, 0x98, 0xb7, 0x96, 0x9c, 0x9b, 0x9e, 0x9c, 0x9d, 0xb9, 0x98, 0xc4, 0xea, 0xe4, 0xe8, 0xf1, 0xf6, 0xb2, 0xec, 0x78, 0x7a, 0x7e, 0x7f, 0x7e, 0x7c, 0x7a, 0x75, 0x73, 0x70, 0x70, 0x73, 0x75, 0x79, 0x7a, 0x7b, 0x7e, 0x7d, 0x79, 0x6b, 0x5d, 0x81, 0xae, 0xe2, 0xe3, 0xf5, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf8, 0xe9, 0xe0, 0xc9, 0xcd, 0xcd, 0xcd, 0xd0, 0xcb, 0xdf, 0xea, 0xf1, 0xf8, 0xf2, 0xe4, 0xe5, 0xcb, 0xd2, 0xd0, 0xd3, 0xcb, 0xda, 0xe5, 0xe5, 0xe5, 0xe8, 0xe4, 0xf1, 0xe7, 0xe0, 0xd4, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd2, 0xcd, 0xd1, 0xcd, 0xcd, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd0, 0xcb, 0xdf, 0xe5, 0xe7, 0xe8, 0xf3, 0xf2, 0xe9, 0xe7, 0xe2, 0xcf, 0xc4, 0xc9, 0xc9, 0xc5, 0xc2, 0xc2, 0xc4, 0xe9, 0xf5, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xf3, 0xe4, 0xe9, 0xdc, 0x91, 0x8d, 0x8f, 0x8d, 0xb3, 0xc7, 0xe7, 0xe6, 0xe8, 0xe4, 0xf3, 0xf2, 0xe4, 0xea, 0xe2, 0xaa, 0x99, 0xa7, 0x9b, 0x99, 0xd8, 0xf6, 0xe4, 0xfb, 0xe9, 0xd4, 0x92, 0xa8, 0x99, 0xb7, 0xda, 0xea, 0xf4, 0xf3, 0xe7, 0xe7, 0xf3, 0xf3, 0xe6, 0xe3, 0xc0, 0x95, 0xb9, 0x99, 0xb9, 0xa2, 0x9d, 0x9d, 0xb9, 0xb9, 0xba, 0x95, 0xbf, 0xdd, 0xe7, 0xe5, 0xe5, 0xdf, 0xaa, 0x98, 0xa7, 0x9b, 0x9d, 0xa0, 0xa2, 0xa0, 0xa3, 0x9c, 0xa3, 0xb9, 0xa3, 0x9d, 0xb9, 0x9d, 0x9c, 0xa0, 0x95, 0xd4, 0xea, 0xf1, 0xf8, 0xf5, 0xf5, 0xda, 0xe1, 0x7f, 0x79, 0x70, 0x5f, 0x4e, 0x2a, 0x20, 0x1f, 0x20, 0x20, 0x1d, 0x27, 0x20, 0x27, 0x45, 0x51, 0x5e, 0x69, 0x76, 0x7d, 0x7f, 0xe4, 0xe4, 0xe8, 0xf2, 0xae, 0xe3, 0xe7, 0xe4, 0xe4, 0xf2, 0xf2, 0xf2, 0xf9, 0xf5, 0xf9, 0xe8, 0xe7, 0xdd, 0xc7, 0xcc, 0xcc, 0xcc, 0xcd, 0xc9, 0xdf, 0xea, 0xf9, 0xe4, 0xf1, 0xe9, 0xda, 0xcb, 0xd3, 0xd2, 0xd2, 0xd4, 0xe0, 0xe5, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf5, 0xe5, 0xdd, 0xd4, 0xd5, 0xd5, 0xd5, 0xd3, 0xd2, 0xd3, 0xd0, 0xd3, 0xd3, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd3, 0xce, 0xe4, 0xe7, 0xe7, 0xf1, 0xe9, 0xe8, 0xf1, 0xf2, 0xe9, 0xda, 0xc4, 0xc9, 0xc5, 0xc5, 0xc5, 0xc0, 0xd6, 0xf6, 0xe4, 0xae, 0xf9, 0xf5, 0xf9, 0xf2, 0xf2, 0xe6, 0xf1, 0xf5, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf6, 0xe4, 0xea, 0xe7, 0xb3, 0x8f, 0xb8, 0x98, 0xa6, 0x95, 0x8f, 0xa4, 0xe2, 0xe6, 0xf1, 0xe8, 0xf2, 0xf1, 0xe8, 0xf6, 0xc7, 0x98, 0x9b, 0xa5, 0x97, 0xb8, 0xd8, 0xf6, 0xf6, 0xdb, 0x96, 0xa8, 0x9b, 0x9c, 0xba, 0xe0, 0xea, 0xf5, 0xf3, 0xe7, 0xe8, 0xf2, 0xf3, 0xf2, 0xea, 0xe2, 0xc2, 0x95, 0xb8, 0x99, 0xb9, 0x9f, 0xa2, 0xa2, 0xb8, 0xb9, 0xb9, 0x95, 0xb7, 0xbd, 0xc1, 0xbf, 0xa9, 0x98, 0xb8, 0xa7, 0x9d, 0x9c, 0xa3, 0x9c, 0xa3, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0x9c, 0x9c, 0x9c, 0xa0, 0x9c, 0x98, 0xda, 0xea, 0xe7, 0xe8, 0xe4, 0xe7, 0xf6, 0x74, 0x65, 0x2a, 0x1f, 0x18, 0x18, 0x2e, 0x32, 0x2e, 0x30, 0x32, 0x2e, 0x32, 0x32, 0x23, 0x2e, 0x23, 0x25, 0x1d, 0x35, 0x60, 0x7c, 0xae, 0xe9, 0xf1, 0xe4, 0xf1, 0xe7, 0xe4, 0xe9, 0xf3, 0xf2, 0xf2, 0xf9, 0xf2, 0xe7, 0xf2, 0xe4, 0xe5, 0xda, 0xc8, 0xcc, 0xcc, 0xcc, 0xcd, 0xcb, 0xdb, 0xe9, 0xe4, 0xf1, 0xe9, 0xdf, 0xd1, 0xcd, 0xd1, 0xd4, 0xd1, 0xdd, 0xe9, 0xe7, 0xf2, 0xf2, 0xf9, 0xf2, 0xf1, 0xf2, 0xe9, 0xe5, 0xdb, 0xcd, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xd0, 0xd3, 0xd3, 0xd0, 0xd0, 0xd0, 0xd0, 0xd4, 0xe2, 0xe9, 0xe5, 0xe7, 0xea, 0xe1, 0xf6, 0xf8, 0xf1, 0xe5, 0xcb, 0xc4, 0xc5, 0xc2, 0xc2, 0xc1, 0xe2, 0xf6, 0xe4, 0xe6, 0xf1, 0xfa, 0xf5, 0xf2, 0xe4, 0xe6, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xe7, 0xd9, 0x8f, 0x98, 0x97, 0xa0, 0x97, 0x99, 0xa6, 0x90, 0x91, 0xdf, 0xea, 0xe5, 0xe8, 0xf4, 0xf1, 0xe7, 0xdf, 0xb7, 0xb9, 0x9a, 0xa7, 0x98, 0xb7, 0xc0, 0xc4, 0xba, 0xb8, 0xa6, 0xa0, 0xa3, 0xaa, 0xe2, 0xe9, 0xf4, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xe8, 0xe3, 0xe7, 0xe7, 0xc7, 0xb7, 0x98, 0x9c, 0xa0, 0x9d, 0x9b, 0xa8, 0xb9, 0xa0, 0xa7, 0xa6, 0x99, 0xa3, 0x99, 0xb8, 0xa7, 0xa6, 0x9c, 0xb9, 0xa3, 0xa0, 0xa3, 0xa0, 0x9c, 0xa0, 0xa3, 0xa0, 0xa3, 0x9c, 0xb9, 0xa3, 0xa0, 0x9e, 0x99, 0xc8, 0xe5, 0xe9, 0xe7, 0xea, 0xad, 0xfb, 0x0c, 0x1b, 0x23, 0x32, 0x23, 0x2c, 0x38, 0x34, 0x23, 0x30, 0x23, 0x30, 0x30, 0x23, 0x30, 0x30, 0x30, 0x32, 0x38, 0x38, 0x33, 0x7a, 0xda, 0xdd, 0xe2, 0xe9, 0xf2, 0xf5, 0xf9, 0xf9, 0xf2, 0xf8, 0xf2, 0xe8, 0xe5, 0xe6, 0xf1, 0xf1, 0xe7, 0xd8, 0xc9, 0xcc, 0xcc, 0xcc, 0xcd, 0xc9, 0xd8, 0xe2, 0xe9, 0xe5, 0xe2, 0xd4, 0xcb, 0xd2, 0xd5, 0xcb, 0xda, 0xe9, 0xe5, 0xea, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xe7, 0xea, 0xe2, 0xdd, 0xd6, 0xd4, 0xd3, 0xd3, 0xcd, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcd, 0xd6, 0xe5, 0xe5, 0xe7, 0xf2, 0xf2, 0xf9, 0xe4, 0xe8, 0xe9, 0xdd, 0xc4, 0xc8, 0xc4, 0xc8, 0xc0, 0xda, 0xe9, 0xe4, 0xf3, 0xe6, 0xf1, 0xf5, 0xf1, 0xf3, 0xe6, 0xe6, 0xf1, 0xf5, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf8, 0xf1, 0xf2, 0xf3, 0xea, 0xe9, 0xc7, 0x91, 0x9b, 0x9e, 0x9a, 0x9a, 0x9c, 0x9b, 0xa3, 0x92, 0x95, 0xdd, 0xea, 0xe8, 0xe4, 0xf9, 0xf1, 0xe9, 0xc0, 0xb8, 0x9c, 0xa5, 0xa7, 0xa3, 0xb8, 0x98, 0xa9, 0xa9, 0x9d, 0xa5, 0x9c, 0xb7, 0xd8, 0xea, 0xe9, 0xfb, 0xf2, 0xf3, 0xf2, 0xf4, 0xf1, 0xe7, 0xe3, 0xe9, 0xe6, 0xd6, 0xb7, 0x99, 0x9c, 0x9a, 0xa7, 0x9d, 0x9b, 0xa8, 0xa5, 0x9e, 0x9e, 0x9e, 0xa0, 0xa5, 0x9c, 0xa3, 0xa6, 0xb9, 0xa3, 0x9c, 0xa0, 0x9c, 0xa3, 0x9c, 0xa3, 0xa3, 0xa0, 0x9c, 0xb9, 0xa3, 0xa0, 0xa0, 0x9c, 0xb8, 0xbf, 0xcb, 0xd4, 0xcb, 0xbd, 0x77, 0x3a, 0x12, 0x38, 0x32, 0x34, 0x34, 0x41, 0x32, 0x30, 0x30, 0x34, 0x34, 0x32, 0x34, 0x34, 0x2e, 0x34, 0x40, 0x4a, 0x38, 0x58, 0x7d, 0xd8, 0xc7, 0xd6, 0xdf, 0xe9, 0xf5, 0xf5, 0xf9, 0xf9, 0xf2, 0xf2, 0xe6, 0xae, 0xae, 0xf1, 0xf1, 0xe2, 0xd6, 0xc9, 0xcd, 0xcc, 0xcc, 0xcd, 0xcd, 0xc9, 0xda, 0xe0, 0xdf, 0xd4, 0xc7, 0xd5, 0xd2, 0xd3, 0xd4, 0xe1, 0xe9, 0xe4, 0xf2, 0xf8, 0xf2, 0xf2, 0xf1, 0xe7, 0xf1, 0xe4, 0xf1, 0xe7, 0xea, 0xe0, 0xdb, 0xd4, 0xd2, 0xd3, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd0, 0xd0, 0xd0, 0xcc, 0xd6, 0xe5, 0xe5, 0xe7, 0xf2, 0xf3, 0xe4, 0xea, 0xe9, 0xda, 0xc8, 0xc2, 0xc8, 0xc4, 0xc4, 0xc9, 0xe9, 0xe5, 0xf6, 0xe4, 0xf3, 0xe6, 0xe7, 0xe7, 0xf1, 0xe4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xe4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf6, 0xd8, 0x90, 0x97, 0x9a, 0x9a, 0x9a, 0x9d, 0x9a, 0x9f, 0x9c, 0x92, 0x91, 0xdb, 0xf6, 0xe5, 0xf4, 0xf2, 0xe7, 0xdd, 0x96, 0xb9, 0x9b, 0xa7, 0xa7, 0xa2, 0xa8, 0xa2, 0x9d, 0xa8, 0xa5, 0xa7, 0xa6, 0xb7, 0xe0, 0xea, 0xe7, 0xf3, 0xf3, 0xf4, 0xf1, 0xe8, 0xf4, 0xe3, 0xe4, 0xe8, 0xf6, 0xd2, 0xb7, 0xa6, 0x9c, 0xa0, 0x9c, 0xa2, 0x9d, 0x9d, 0x9f, 0xa5, 0x9d, 0xa5, 0x9c, 0xa2, 0xa3, 0xa2, 0xb8, 0xa7, 0x9c, 0xa2, 0x9c, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0x9c, 0xa6, 0xa3, 0xa0, 0xa5, 0xa0, 0x99, 0x99, 0x95, 0x94, 0x95, 0x92, 0xd9, 0xf8, 0x0d, 0x28, 0x23, 0x34, 0x30, 0x41, 0x34, 0x38, 0x40, 0x38, 0x40, 0x38, 0x46, 0x38, 0x46, 0x38, 0x34, 0x2e, 0x27, 0x62, 0xf7, 0xda, 0xcc, 0xc9, 0xd1, 0xd8, 0xe0, 0xea, 0xe5, 0xe4, 0xe8, 0xf2, 0xe4, 0xf2, 0xe7, 0xe4, 0xea, 0xdc, 0xcb, 0xcb, 0xcc, 0xcc, 0xcc, 0xcd, 0xd0, 0xcc, 0xcd, 0xcb, 0xcb, 0xcb, 0xd3, 0xcc, 0xd5, 0xc9, 0xdb, 0xea, 0xf1, 0xea, 0xe4, 0xf3, 0xf2, 0xf2, 0xe7, 0xf1, 0xe4, 0xf2, 0xf3, 0xf3, 0xe4, 0xe7, 0xe9, 0xda, 0xc9, 0xd3, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd0, 0xd0, 0xd0, 0xcd, 0xd8, 0xe5, 0xe5, 0xf2, 0xf1, 0xe8, 0xf6, 0xdf, 0xd2, 0xc4, 0xc5, 0xc5, 0xc8, 0xc1, 0xcb, 0xe2, 0xe9, 0xf3, 0xe4, 0xf3, 0xae, 0xe7, 0xe7, 0xe7, 0xe6, 0xe4, 0xe6, 0xf8, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe6, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xe5, 0xe3, 0x96, 0x97, 0x9e, 0x9f, 0x9a, 0xa2, 0x9a, 0x9a, 0x9a, 0x9c, 0x98, 0xb5, 0xd6, 0xf6, 0xe5, 0xf2, 0xe4, 0xea, 0xbc, 0x98, 0xa6, 0xa7, 0xa7, 0xa2, 0x9f, 0xa2, 0xa5, 0xa2, 0xa5, 0xa3, 0xa6, 0xb7, 0xbc, 0xe0, 0xea, 0xe8, 0xea, 0xe4, 0xea, 0xf2, 0xe7, 0xf2, 0xe8, 0xf3, 0xe9, 0xe2, 0xbf, 0x96, 0xa6, 0xa3, 0xb9, 0xa3, 0x9c, 0xa2, 0xa3, 0xa3, 0xa2, 0x9c, 0xa2, 0xa3, 0xa3, 0xa3, 0xa0, 0xa3, 0xa0, 0x9c, 0xa0, 0x9c, 0x9c, 0x9c, 0xa0, 0x9c, 0xa2, 0xa3, 0xa6, 0xa0, 0x9e, 0xa0, 0xa3, 0xa6, 0xb8, 0xa3, 0xa0, 0x92, 0xda, 0xe1, 0x67, 0x12, 0x2c, 0x32, 0x34, 0x31, 0x31, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x38, 0x32, 0x41, 0x2e, 0x1c, 0x71, 0x85, 0xd3, 0xcb, 0xd1, 0xd2, 0xc7, 0xd4, 0xdb, 0xe5, 0xe9, 0xe3, 0xf1, 0xf2, 0xf1, 0xf4, 0xe4, 0xe9, 0xda, 0xcb, 0xcb, 0xcc, 0xcc, 0xcc, 0xd0, 0xd0, 0xcc, 0xcc, 0xcb, 0xcd, 0xd2, 0xd3, 0xcc, 0xd3, 0xcd, 0xe2, 0xe7, 0xe8, 0xf1, 0xe8, 0xf2, 0xe8, 0xe8, 0xe8, 0xe7, 0xe8, 0xf2, 0xe4, 0xf8, 0xf2, 0xea, 0xe5, 0xd4, 0xcd, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd0, 0xd0, 0xd0, 0xc9, 0xda, 0xe8, 0xea, 0xe4, 0xf6, 0xe5, 0xda, 0xc7, 0xc8, 0xc8, 0xc5, 0xc8, 0xc4, 0xc9, 0xe0, 0xf5, 0xe9, 0xf1, 0xf2, 0xe6, 0xe7, 0xe3, 0xdd, 0xdf, 0xe7, 0xea, 0xf3, 0xf2, 0xe4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xe6, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xe4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xe7, 0xf6, 0xda, 0xb7, 0x92, 0xa3, 0xb8, 0x9c, 0x9f, 0x9f, 0x9f, 0x9b, 0x9c, 0x95, 0x96, 0xc1, 0xe0, 0xea, 0xe5, 0xf6, 0xcf, 0x99, 0xa3, 0xa6, 0xa6, 0xa7, 0xa2, 0xa5, 0xa5, 0xa7, 0xb9, 0xa7, 0xa7, 0xa6, 0x98, 0xba, 0xe2, 0xe7, 0xe3, 0xea, 0xf1, 0xe4, 0xf2, 0xf1, 0xf1, 0xe4, 0xe2, 0xe9, 0xc4, 0x98, 0xb8, 0xa3, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xa2, 0xa0, 0xa2, 0xa0, 0x9c, 0xa3, 0x9c, 0xa2, 0x9c, 0xa2, 0x9c, 0xa0, 0x9c, 0xa3, 0xa3, 0xa0, 0xa5, 0xa0, 0xa0, 0xb9, 0xa3, 0x9d, 0xa2, 0x94, 0xdd, 0xd7, 0x7f, 0x3b, 0x16, 0x2f, 0x30, 0x1d, 0x31, 0x30, 0x34, 0x30, 0x34, 0x34, 0x34, 0x30, 0x37, 0x34, 0x46, 0x2f, 0x58, 0x7e, 0xe0, 0xc7, 0xd1, 0xd1, 0xcf, 0xcf, 0xc9, 0xc9, 0xd6, 0xdf, 0xe9, 0xe7, 0xe5, 0xf9, 0xe4, 0xe9, 0xe2, 0xcb, 0xcb, 0xd2, 0xcd, 0xcc, 0xd0, 0xd0, 0xd0, 0xcc, 0xcc, 0xd0, 0xcb, 0xcc, 0xd3, 0xcc, 0xd0, 0xd5, 0xe2, 0xe9, 0xe9, 0xe7, 0xe5, 0xe7, 0xe7, 0xea, 0xe7, 0xf2, 0xe8, 0xf1, 0xe8, 0xf1, 0xe9, 0xe5, 0xda, 0xcb, 0xd2, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd0, 0xd0, 0xc9, 0xda, 0xae, 0xe7, 0xe8, 0xe0, 0xcb, 0xc7, 0xc8, 0xc8, 0xc8, 0xc8, 0xc4, 0xcb, 0xe2, 0xe5, 0xe9, 0xf2, 0xf4, 0xe4, 0xe5, 0xe2, 0xc0, 0x91, 0x8f, 0xbd, 0xe9, 0xe4, 0xea, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe6, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xe6, 0xfb, 0xe4, 0xf6, 0xdb, 0xba, 0x95, 0xb7, 0xb8, 0xa6, 0xa3, 0x9b, 0xa0, 0xa3, 0x9c, 0x98, 0x95, 0xaa, 0xc4, 0xdd, 0xdf, 0xc8, 0x99, 0x9c, 0xa6, 0xa3, 0xa3, 0xa7, 0xa2, 0xa0, 0xb9, 0xa7, 0xb9, 0xa5, 0xa0, 0xa8, 0x96, 0xab, 0xdf, 0xea, 0xe2, 0xea, 0xf1, 0xf2, 0xe4, 0xe5, 0xe5, 0xe9, 0xe5, 0xc2, 0x99, 0x9b, 0x9c, 0xa3, 0xb9, 0xb9, 0xa3, 0xb8, 0xb9, 0xb9, 0xb9, 0xa3, 0xa3, 0xa3, 0xa2, 0xa2, 0xa0, 0xa3, 0xa0, 0x9c, 0xa0, 0x9c, 0xa0, 0x9c, 0xa2, 0x9c, 0xa3, 0xa0, 0xa7, 0x9e, 0xa0, 0xa3, 0xb9, 0xa3, 0x9d, 0xa3, 0x95, 0xfd, 0x52, 0x70, 0x7c, 0x66, 0x16, 0x1b, 0x1d, 0x25, 0x30, 0x23, 0x2e, 0x32, 0x2e, 0x2e, 0x23, 0x23, 0x2e, 0x1d, 0x20, 0x69, 0x80, 0xd6, 0xcd, 0xd1, 0xd1, 0xcc, 0xcf, 0xcf, 0xd0, 0xc7, 0xd2, 0xdb, 0xe5, 0xe9, 0xe5, 0xe9, 0xe2, 0xd8, 0xcb, 0xcd, 0xcd, 0xcc, 0xcc, 0xcd, 0xcd, 0xd0, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xd0, 0xcc, 0xcc, 0xd4, 0xdb, 0xe0, 0xda, 0xda, 0xe5, 0xe7, 0xe3, 0xe4, 0xe8, 0xf2, 0xe8, 0xe8, 0xe7, 0xe7, 0xe7, 0xda, 0xc9, 0xd2, 0xcd, 0xd0, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd0, 0xd0, 0xd0, 0xcc, 0xd8, 0xea, 0xe2, 0xdb, 0xc9, 0xc7, 0xc8, 0xcd, 0xc8, 0xc9, 0xc7, 0xda, 0xe2, 0xea, 0xea, 0xf2, 0xf1, 0xe8, 0xe9, 0xea, 0xc7, 0x96, 0xb9, 0xc2, 0xbc, 0xdc, 0xea, 0xf1, 0xe8, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xe6, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xe4, 0x85, 0xf8, 0xf4, 0xf5, 0xea, 0xe0, 0xd6, 0xab, 0xb5, 0x95, 0x98, 0x99, 0x9d, 0x97, 0x9b, 0x9b, 0xa3, 0x98, 0x95, 0x96, 0xa3, 0x97, 0xa2, 0xa7, 0xa7, 0xa6, 0xa3, 0xa2, 0xa5, 0xa2, 0xa6, 0xb9, 0xa3, 0xa5, 0xa5, 0x9e, 0xa8, 0x96, 0xba, 0xdf, 0xf6, 0xe6, 0xf3, 0xf6, 0xf6, 0xea, 0xe2, 0xdf, 0xc9, 0xb8, 0x9b, 0xa5, 0x9f, 0xa2, 0x9c, 0xa3, 0x9c, 0xa7, 0x9c, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9c, 0x9c, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9c, 0xa0, 0xa3, 0xa2, 0x9e, 0xa5, 0xa0, 0xa3, 0xa6, 0xb9, 0x9c, 0x9e, 0x92, 0xf0, 0x5f, 0x22, 0x73, 0x7e, 0x7b, 0x6b, 0x60, 0x57, 0x42, 0x2d, 0x2d, 0x2d, 0x33, 0x2d, 0x42, 0x58, 0x5e, 0x66, 0x75, 0x7e, 0xe1, 0xcd, 0xcf, 0xcc, 0xcd, 0xd2, 0xd0, 0xcc, 0xd0, 0xd3, 0xcb, 0xc7, 0xd4, 0xdb, 0xe0, 0xdf, 0xd8, 0xc9, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xd2, 0xcc, 0xcd, 0xd2, 0xcb, 0xd0, 0xd0, 0xd0, 0xd0, 0xd2, 0xcd, 0xc7, 0xcb, 0xc7, 0xd6, 0xe2, 0xe9, 0xe8, 0xf1, 0xe6, 0xe8, 0xe8, 0xe9, 0xe0, 0xd6, 0xc9, 0xd2, 0xcd, 0xd3, 0xcd, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd3, 0xd0, 0xcd, 0xd2, 0xda, 0xd8, 0xc8, 0xcc, 0xcc, 0xcc, 0xc9, 0xc7, 0xcb, 0xdf, 0xea, 0xe5, 0xe6, 0xe4, 0xe6, 0xe8, 0xf1, 0xe9, 0xe0, 0xba, 0xac, 0xcf, 0xc5, 0xc8, 0xd8, 0xe9, 0xf2, 0xe7, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xe4, 0xf3, 0xf8, 0xfb, 0xf2, 0xe7, 0xea, 0xe7, 0xe0, 0xd8, 0xc4, 0xab, 0xba, 0xa6, 0x98, 0x94, 0x98, 0x99, 0xb8, 0x99, 0xa2, 0x9d, 0x9f, 0xa2, 0xa2, 0xa3, 0xa8, 0xb9, 0xa7, 0xa0, 0xb9, 0xb9, 0xa3, 0x9d, 0x9f, 0xa5, 0xa2, 0xb9, 0xb7, 0xb7, 0xc7, 0xdf, 0xe0, 0xdf, 0xd8, 0xc7, 0xbc, 0xb8, 0xb7, 0x97, 0xa8, 0x9a, 0x9e, 0xa2, 0xa0, 0xa3, 0xa3, 0xa0, 0x9e, 0xa0, 0xa0, 0xa0, 0xa2, 0xa3, 0xa2, 0xa2, 0xa0, 0xa2, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa3, 0xa0, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa3, 0xa3, 0x9c, 0x9e, 0x94, 0xf0, 0x5e, 0x2a, 0x1c, 0x3b, 0x73, 0x76, 0x79, 0x79, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7a, 0x7b, 0x75, 0x7f, 0xdc, 0xc7, 0xcf, 0xcf, 0xcd, 0xd2, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xd2, 0xcb, 0xc9, 0xcb, 0xc9, 0xc9, 0xcd, 0xcd, 0xcc, 0xcc, 0xc8, 0xd0, 0xcc, 0xcd, 0xcc, 0xd2, 0xcd, 0xd1, 0xd2, 0xcd, 0xcd, 0xd3, 0xcd, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xcb, 0xcb, 0xdb, 0xe2, 0xea, 0xe9, 0xe8, 0xe2, 0xda, 0xcb, 0xcb, 0xd1, 0xcd, 0xd0, 0xcd, 0xcc, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd0, 0xd0, 0xd0, 0xcd, 0xcd, 0xcd, 0xc8, 0xc8, 0xcf, 0xcc, 0xc7, 0xcb, 0xd8, 0xe7, 0xe9, 0xf5, 0xf2, 0xf3, 0xf3, 0xf3, 0xe8, 0xe9, 0xe2, 0xcb, 0xc8, 0xcf, 0xcf, 0xcf, 0xc2, 0xdf, 0xf1, 0xe9, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xe8, 0xe8, 0xea, 0xea, 0xf6, 0xea, 0xe1, 0xdd, 0xd8, 0xc7, 0xc0, 0xba, 0x95, 0x94, 0x9b, 0xa8, 0xa5, 0xa8, 0xa7, 0xa7, 0xb8, 0xa6, 0xa7, 0xa7, 0xa3, 0xa7, 0xa3, 0xa7, 0xa7, 0xa7, 0xa3, 0xa3, 0xa3, 0xa6, 0x98, 0x98, 0xa9, 0xb8, 0x98, 0x94, 0xa3, 0xa3, 0xa3, 0xa7, 0xa3, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9e, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c, 0xa2, 0xa0, 0x9d, 0xa0, 0xa0, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0xa3, 0x9c, 0xa3, 0xa2, 0xb9, 0xb9, 0xb9, 0xb9, 0x9d, 0xa0, 0xa5, 0xb8, 0x9e, 0x94, 0xf8, 0x5c, 0x23, 0x23, 0x25, 0x1d, 0x20, 0x45, 0x58, 0x5c, 0x5e, 0x5e, 0x5e, 0x60, 0x5e, 0x5e, 0x5c, 0x5c, 0x59, 0x1e, 0x62, 0x77, 0xcb, 0xcd, 0xd0, 0xd0, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcf, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd2, 0xcd, 0xd2, 0xcd, 0xd3, 0xcd, 0xd0, 0xd2, 0xd2, 0xd1, 0xc9, 0xd4, 0xda, 0xda, 0xd8, 0xcd, 0xc9, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xcd, 0xcd, 0xcd, 0xd0, 0xcd, 0xd2, 0xcc, 0xcc, 0xcc, 0xc8, 0xcb, 0xdd, 0xf6, 0xf4, 0xf2, 0xf2, 0xf8, 0xf8, 0xf8, 0xf4, 0xe7, 0xe9, 0xe0, 0xd5, 0xcc, 0xcf, 0xcf, 0xc9, 0xc7, 0xe2, 0xe7, 0xf5, 0xf9, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf8, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf2, 0xe7, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xe8, 0xe7, 0xe6, 0xe8, 0xea, 0xe7, 0xe2, 0xdb, 0xc4, 0xba, 0x98, 0xb8, 0x9c, 0xa2, 0xa8, 0xa7, 0xa7, 0xa3, 0xa3, 0xa7, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa7, 0xa7, 0xa7, 0xa3, 0xb9, 0xa6, 0xb8, 0xa3, 0xa8, 0xa3, 0xa3, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xa0, 0x9e, 0xa3, 0xb8, 0xa3, 0x9c, 0x9f, 0x9e, 0xa1, 0x97, 0xb7, 0x7e, 0x26, 0x37, 0x2e, 0x23, 0x3c, 0x2c, 0x25, 0x1d, 0x23, 0x25, 0x23, 0x25, 0x1d, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1f, 0x1e, 0x79, 0xfc, 0xcc, 0xc8, 0xcf, 0xd1, 0xd1, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd1, 0xcd, 0xd1, 0xcd, 0xd1, 0xd1, 0xd2, 0xd1, 0xcd, 0xcf, 0xcf, 0xcf, 0xcc, 0xcc, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcd, 0xcd, 0xd2, 0xcb, 0xc9, 0xcb, 0xcc, 0xc9, 0xd0, 0xd3, 0xd2, 0xd0, 0xcd, 0xd2, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd0, 0xcd, 0xd3, 0xd0, 0xd0, 0xd0, 0xc9, 0xd2, 0xe0, 0xea, 0xf1, 0xf1, 0xe7, 0xe7, 0xe7, 0xea, 0xe7, 0xe7, 0xe2, 0xdf, 0xd6, 0xcd, 0xd0, 0xd3, 0xc9, 0xc7, 0xda, 0xea, 0xe5, 0xf2, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf2, 0xe8, 0xf2, 0xf2, 0xe8, 0xf2, 0xe8, 0xf2, 0xf8, 0xf8, 0xf8, 0xf1, 0xe8, 0xe8, 0xe3, 0xae, 0xe6, 0xe7, 0xe9, 0xe0, 0xc1, 0xba, 0x96, 0xa6, 0x9c, 0xa5, 0xa5, 0xa2, 0xa7, 0xa2, 0xa3, 0xa2, 0xa3, 0xa7, 0xa3, 0xa7, 0xa3, 0xa7, 0x9c, 0xa8, 0xa6, 0xb9, 0xa6, 0xa3, 0x9c, 0xa7, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa7, 0xb9, 0xb9, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xb8, 0xb9, 0xb8, 0xa3, 0xb9, 0xa3, 0xb9, 0xa3, 0xb9, 0xa3, 0xb9, 0xa3, 0xa1, 0x9e, 0x9e, 0xa6, 0xb8, 0xa3, 0xa2, 0x9d, 0xa7, 0x94, 0xc3, 0x79, 0x1f, 0x2e, 0x30, 0x2e, 0x2f, 0x2f, 0x23, 0x2e, 0x38, 0x32, 0x2f, 0x32, 0x32, 0x32, 0x32, 0x38, 0x38, 0x30, 0x2f, 0x25, 0x65, 0x7d, 0xc7, 0xc5, 0xcf, 0xd1, 0xd1, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xd1, 0xcd, 0xd1, 0xcd, 0xd2, 0xcd, 0xd1, 0xd0, 0xc9, 0xcf, 0xcd, 0xcf, 0xcd, 0xcc, 0xd0, 0xd0, 0xd0, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xd0, 0xd0, 0xd0, 0xd2, 0xd0, 0xcd, 0xd0, 0xd3, 0xcd, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xcd, 0xd0, 0xcc, 0xcd, 0xd3, 0xcb, 0xcb, 0xe0, 0xe5, 0xe5, 0xe9, 0xe7, 0xe7, 0xe7, 0xe0, 0xdb, 0xd6, 0xd2, 0xd6, 0xd2, 0xcb, 0xd3, 0xcc, 0xd3, 0xc7, 0xd8, 0xe3, 0xe9, 0xe4, 0xf1, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf8, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xe8, 0xf2, 0xf1, 0xf2, 0xe8, 0xf4, 0xe8, 0xf2, 0xf2, 0xf4, 0xfb, 0xf4, 0xf3, 0xf8, 0xe4, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf5, 0xea, 0xdf, 0xc1, 0xb7, 0xa6, 0xa7, 0xa5, 0xa7, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa7, 0xa7, 0xa7, 0xa3, 0xa7, 0xa8, 0xa3, 0xa8, 0xa7, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9c, 0x9d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9c, 0xa0, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa0, 0x9c, 0xa3, 0x9c, 0x9c, 0xa6, 0x98, 0xbc, 0x78, 0x57, 0x25, 0x2e, 0x30, 0x2e, 0x32, 0x32, 0x34, 0x30, 0x30, 0x30, 0x30, 0x23, 0x30, 0x2e, 0x30, 0x32, 0x30, 0x30, 0x3d, 0x46, 0x2f, 0x6e, 0xf0, 0xc7, 0xcf, 0xcc, 0xd1, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcc, 0xcd, 0xcf, 0xc9, 0xcf, 0xcd, 0xcc, 0xcc, 0xcc, 0xcd, 0xd1, 0xd1, 0xd1, 0xcb, 0xd1, 0xd0, 0xd2, 0xd0, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xcc, 0xcc, 0xd0, 0xd0, 0xd0, 0xd3, 0xd3, 0xd2, 0xcd, 0xd0, 0xcd, 0xd0, 0xd2, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd0, 0xcc, 0xd0, 0xd2, 0xcb, 0xdc, 0xe7, 0xe5, 0xf1, 0xe5, 0xe5, 0xdd, 0xd4, 0xc9, 0xc9, 0xc8, 0xcc, 0xcc, 0xcd, 0xd3, 0xd3, 0xd3, 0xc7, 0xd9, 0xe7, 0xf5, 0xf2, 0xf8, 0xf1, 0xe6, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe9, 0xf2, 0xe8, 0xf2, 0xf1, 0xe8, 0xf2, 0xf2, 0xe8, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf8, 0xf2, 0xf8, 0xf1, 0xf1, 0xe8, 0xe9, 0xe3, 0xd4, 0xb7, 0xa6, 0xa3, 0xa7, 0xa7, 0xa3, 0xa7, 0xa3, 0xa7, 0xa3, 0xa7, 0xa3, 0xa7, 0xa0, 0xa7, 0xa7, 0xa7, 0xa0, 0xa7, 0xa0, 0xa2, 0xa0, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb8, 0xa6, 0xa6, 0x9e, 0x9e, 0x9e, 0x9e, 0xa0, 0x9c, 0x9c, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9e, 0xa0, 0xb9, 0xba, 0xb9, 0xb9, 0x9f, 0xa5, 0x97, 0xb8, 0x91, 0xd7, 0x6f, 0x1b, 0x2f, 0x30, 0x30, 0x30, 0x32, 0x40, 0x3d, 0x32, 0x30, 0x2e, 0x34, 0x30, 0x32, 0x30, 0x32, 0x34, 0x34, 0x30, 0x41, 0x38, 0x38, 0x44, 0x7a, 0xdc, 0xc7, 0xd0, 0xcc, 0xcb, 0xcb, 0xcb, 0xd2, 0xcd, 0xcb, 0xcd, 0xcb, 0xcb, 0xcd, 0xcc, 0xc9, 0xcc, 0xcb, 0xcc, 0xcd, 0xcd, 0xcc, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xcd, 0xd0, 0xcd, 0xd2, 0xcd, 0xd2, 0xd0, 0xd0, 0xd0, 0xcc, 0xd3, 0xd0, 0xcc, 0xd0, 0xd0, 0xd2, 0xd0, 0xcd, 0xd3, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcc, 0xcf, 0xcb, 0xd4, 0xe5, 0xe4, 0xe5, 0xe9, 0xe5, 0xd6, 0xc9, 0xc9, 0xcc, 0xcf, 0xcc, 0xcf, 0xd0, 0xd0, 0xd2, 0xc9, 0xd4, 0xdb, 0xe2, 0xe9, 0xf9, 0xfa, 0xf4, 0xe6, 0xe4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xe7, 0xf1, 0xe7, 0xf1, 0xe7, 0xf1, 0xf1, 0xe8, 0xf2, 0xe8, 0xf2, 0xe6, 0xf2, 0xe6, 0xe5, 0xe9, 0xd6, 0x96, 0xa9, 0xa3, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa2, 0xa2, 0xa0, 0xa2, 0xa7, 0xa3, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa7, 0xa3, 0xa3, 0xa3, 0x9c, 0xb9, 0x9c, 0x9c, 0xa3, 0xa3, 0x9c, 0xa3, 0xb8, 0xb9, 0xb9, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xb9, 0xb9, 0xa8, 0xb7, 0xba, 0xb9, 0xa2, 0xa1, 0xa1, 0x9e, 0x96, 0xee, 0x74, 0x33, 0x23, 0x40, 0x32, 0x30, 0x30, 0x3d, 0x41, 0x32, 0x30, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x34, 0x30, 0x41, 0x40, 0x23, 0x44, 0x79, 0xfd, 0xc7, 0xc9, 0xcd, 0xd1, 0xd3, 0xcc, 0xcc, 0xc8, 0xcd, 0xcd, 0xd1, 0xd0, 0xd1, 0xd0, 0xcd, 0xcd, 0xd2, 0xd0, 0xd2, 0xcd, 0xcd, 0xcc, 0xcc, 0xcf, 0xcf, 0xcc, 0xcc, 0xd0, 0xd2, 0xcb, 0xd2, 0xd2, 0xd2, 0xd2, 0xcd, 0xd2, 0xcd, 0xd0, 0xd0, 0xd3, 0xcd, 0xd0, 0xd0, 0xd3, 0xd3, 0xcd, 0xd0, 0xcd, 0xd2, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd3, 0xcc, 0xcb, 0xda, 0xe5, 0xe2, 0xe9, 0xe0, 0xd1, 0xc7, 0xd1, 0xcc, 0xd3, 0xcc, 0xcc, 0xcc, 0xcc, 0xc9, 0xd4, 0xda, 0xe0, 0xe9, 0xe9, 0xf8, 0xf9, 0xfe, 0xf8, 0xf2, 0xe6, 0xe6, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xe8, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xe8, 0xf2, 0xe8, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xe7, 0xe7, 0xe7, 0xe5, 0xf1, 0xe7, 0xe7, 0xf1, 0xe7, 0xe4, 0xae, 0xf3, 0xe4, 0xf3, 0xae, 0xe5, 0xe2, 0xbf, 0x98, 0xb9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa3, 0xa3, 0xa7, 0xa2, 0xa7, 0xa0, 0xa2, 0xa7, 0xa3, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0x9f, 0x9a, 0x9d, 0xa3, 0xb8, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0x96, 0xb5, 0x96, 0x96, 0x94, 0x98, 0x96, 0xbb, 0x63, 0x73, 0x2d, 0x25, 0x40, 0x3d, 0x32, 0x30, 0x34, 0x41, 0x3d, 0x2c, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x38, 0x3d, 0x3d, 0x3d, 0x34, 0x30, 0x34, 0x34, 0x3d, 0x2b, 0x35, 0x75, 0x72, 0xd7, 0xd1, 0xcb, 0xc9, 0xc9, 0xcc, 0xc9, 0xcd, 0xc9, 0xcb, 0xcb, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xcb, 0xd1, 0xcb, 0xc8, 0xcf, 0xcf, 0xcf, 0xcf, 0xc8, 0xcc, 0xd3, 0xd2, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd3, 0xd2, 0xd3, 0xd1, 0xcd, 0xd0, 0xd2, 0xd0, 0xd2, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcf, 0xd0, 0xcd, 0xd8, 0xe5, 0xe5, 0xe0, 0xd1, 0xcb, 0xd2, 0xcd, 0xcd, 0xcd, 0xd2, 0xcd, 0xcb, 0xd6, 0xdb, 0xe2, 0xe7, 0xe7, 0xe4, 0xf1, 0xf8, 0xf4, 0xf8, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xe8, 0xf1, 0xe6, 0xe7, 0xf1, 0xf3, 0xf8, 0xf2, 0xe7, 0xe9, 0xac, 0xb9, 0xa7, 0xa7, 0xa7, 0xa3, 0xa7, 0xa3, 0xa7, 0xa3, 0xa7, 0xa7, 0xb9, 0xa7, 0xa3, 0xa2, 0xa7, 0xa2, 0xa7, 0xb9, 0xa7, 0xb9, 0xa7, 0xa3, 0xa3, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0x9f, 0x9f, 0x98, 0xb5, 0xbe, 0xc6, 0xca, 0x52, 0xfc, 0xfc, 0x63, 0xfc, 0x63, 0xfc, 0xfc, 0xfc, 0xfc, 0x52, 0xee, 0xca, 0xca, 0xca, 0xee, 0xfc, 0x6a, 0x73, 0x64, 0x35, 0x2f, 0x3d, 0x40, 0x38, 0x32, 0x2c, 0x30, 0x32, 0x34, 0x1d, 0x25, 0x23, 0x2e, 0x2e, 0x2e, 0x32, 0x2e, 0x32, 0x2e, 0x2e, 0x3d, 0x34, 0x37, 0x34, 0x34, 0x38, 0x2f, 0x1f, 0x60, 0x75, 0xfd, 0x72, 0xfd, 0xfd, 0xde, 0xfd, 0xde, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6a, 0x72, 0x6a, 0xef, 0xd7, 0xc3, 0xcb, 0xd4, 0xd5, 0xd5, 0xcf, 0xd5, 0xcf, 0xd3, 0xcf, 0xd0, 0xcc, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd2, 0xd0, 0xcd, 0xcd, 0xcd, 0xd0, 0xd2, 0xd0, 0xd2, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd0, 0xc9, 0xcd, 0xd6, 0xd6, 0xcd, 0xc9, 0xcc, 0xcc, 0xd0, 0xd0, 0xc9, 0xcb, 0xd8, 0xdd, 0xe7, 0xea, 0xe7, 0xf1, 0xe7, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf5, 0xfe, 0xf4, 0xea, 0xe0, 0xc4, 0xb8, 0x9d, 0xa7, 0xa7, 0xa7, 0xa7, 0xa3, 0xa7, 0xa7, 0xa7, 0xa3, 0xa8, 0xb9, 0xb9, 0xa7, 0xa2, 0xa7, 0xa2, 0xa7, 0xb9, 0xb9, 0xa3, 0xa3, 0xa3, 0xa3, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xb7, 0xa4, 0xee, 0x63, 0x5d, 0x42, 0x48, 0x36, 0x36, 0x36, 0x28, 0x28, 0x28, 0x28, 0x36, 0x36, 0x42, 0x44, 0x58, 0x58, 0x5c, 0x58, 0x58, 0x51, 0x33, 0x35, 0x2b, 0x2e, 0x41, 0x34, 0x40, 0x40, 0x32, 0x2c, 0x32, 0x40, 0x30, 0x35, 0x49, 0x23, 0x2e, 0x2e, 0x32, 0x32, 0x32, 0x2e, 0x2e, 0x2e, 0x40, 0x40, 0x34, 0x34, 0x34, 0x41, 0x40, 0x3f, 0x23, 0x1d, 0x20, 0x2a, 0x36, 0x36, 0x42, 0x44, 0x36, 0x33, 0x28, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x36, 0x33, 0x48, 0x58, 0x65, 0x6f, 0x63, 0xec, 0xa4, 0xab, 0xac, 0xac, 0xc5, 0xc5, 0xc8, 0xcf, 0xcf, 0xd3, 0xcf, 0xd3, 0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0xd3, 0xd3, 0xcd, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd0, 0xd0, 0xcd, 0xd0, 0xcd, 0xd0, 0xd0, 0xd0, 0xcc, 0xcc, 0xd3, 0xd0, 0xc9, 0xc8, 0xcc, 0xcc, 0xcf, 0xcc, 0xcc, 0xcd, 0xda, 0xe0, 0xe9, 0xf6, 0xf2, 0xf8, 0xf1, 0xf5, 0xfa, 0xf4, 0xe4, 0xe4, 0xe4, 0xae, 0xf1, 0xf4, 0xf9, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf8, 0xf4, 0xf8, 0xf2, 0xf8, 0xf2, 0xf2, 0xf2, 0xf1, 0xfe, 0xff, 0xf9, 0xf4, 0xe9, 0xdf, 0xbf, 0x96, 0xb9, 0xa7, 0xa7, 0xa7, 0xa2, 0xa7, 0xa7, 0xa7, 0xa7, 0xa3, 0xa7, 0xa8, 0xb9, 0xa6, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xb8, 0xb9, 0xb8, 0xa9, 0xa8, 0xaa, 0xab, 0xac, 0xac, 0xc5, 0xc5, 0xc8, 0xca, 0x7d, 0x67, 0x21, 0x20, 0x2b, 0x2c, 0x2c, 0x30, 0x32, 0x37, 0x2e, 0x37, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x2c, 0x2c, 0x2e, 0x2f, 0x38, 0x2f, 0x43, 0x2f, 0x3f, 0x34, 0x34, 0x34, 0x40, 0x46, 0x38, 0x2e, 0x32, 0x32, 0x1d, 0x68, 0x6d, 0x1d, 0x2e, 0x25, 0x31, 0x32, 0x2f, 0x23, 0x59, 0x49, 0x34, 0x3f, 0x2e, 0x38, 0x46, 0x46, 0x34, 0x30, 0x32, 0x47, 0x3d, 0x2e, 0x32, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x37, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x37, 0x2e, 0x2e, 0x2e, 0x2e, 0x27, 0x25, 0x25, 0x51, 0x69, 0xfc, 0xb3, 0x90, 0x94, 0x9a, 0x97, 0x97, 0x99, 0xa7, 0xa7, 0xa8, 0xaa, 0xab, 0xac, 0xc2, 0xc5, 0xc8, 0xcf, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd0, 0xd3, 0xd0, 0xd0, 0xcd, 0xcd, 0xd2, 0xcd, 0xd2, 0xcd, 0xcd, 0xcd, 0xcc, 0xd0, 0xcc, 0xcc, 0xcd, 0xc9, 0xc7, 0xd6, 0xe0, 0xe5, 0xe9, 0xf1, 0xf9, 0xf4, 0xf8, 0xf8, 0xf3, 0xf9, 0xf1, 0xf1, 0xe4, 0xe8, 0xf2, 0xf2, 0xf1, 0xf5, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe7, 0xf8, 0x81, 0xe4, 0xe7, 0xda, 0xb8, 0x98, 0xa7, 0xa8, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa6, 0xa8, 0xa8, 0xa8, 0xaa, 0xab, 0xab, 0xac, 0xac, 0xac, 0xc2, 0xc2, 0xc5, 0xc4, 0xc5, 0xc5, 0xac, 0xac, 0xac, 0xab, 0xa8, 0xb7, 0xbe, 0x7c, 0x5e, 0x1b, 0x2f, 0x38, 0x34, 0x37, 0x32, 0x40, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x34, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x41, 0x34, 0x3d, 0x38, 0x38, 0x32, 0x32, 0x2f, 0x26, 0x75, 0x75, 0x1b, 0x2e, 0x25, 0x31, 0x34, 0x38, 0x29, 0x73, 0x60, 0x1d, 0x3e, 0x3e, 0x38, 0x46, 0x4a, 0x34, 0x2c, 0x3f, 0x38, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x40, 0x34, 0x3e, 0x4f, 0x46, 0x38, 0x27, 0x56, 0x72, 0xbc, 0x95, 0x97, 0x9a, 0x9c, 0x99, 0x9b, 0x9f, 0x9b, 0x9b, 0x97, 0x97, 0x94, 0x94, 0x94, 0x98, 0x97, 0xb8, 0xa9, 0xab, 0xac, 0xc2, 0xc5, 0xc8, 0xcf, 0xd3, 0xd3, 0xd5, 0xd0, 0xcd, 0xcd, 0xd3, 0xd3, 0xcc, 0xcc, 0xcc, 0xcc, 0xc9, 0xc9, 0xd4, 0xe0, 0xe9, 0xe9, 0xe5, 0xf9, 0xf1, 0xf4, 0xf3, 0xf2, 0xf3, 0xe8, 0xf1, 0xe8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf9, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xe8, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe8, 0xe7, 0xe7, 0xf1, 0xe7, 0xe8, 0xe8, 0xf1, 0xe8, 0xe2, 0xe5, 0xdb, 0xa9, 0x92, 0x9b, 0xa3, 0xa0, 0xa8, 0xaa, 0xaa, 0xab, 0xac, 0xab, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xaa, 0xaa, 0xa8, 0xa8, 0xa3, 0x9d, 0x99, 0x97, 0x98, 0x97, 0x9a, 0x98, 0x99, 0xb9, 0x95, 0xbd, 0x72, 0x56, 0x1c, 0x2b, 0x38, 0x3d, 0x3d, 0x37, 0x2e, 0x3d, 0x3d, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x32, 0x3d, 0x34, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x32, 0x30, 0x2c, 0x34, 0x4a, 0x27, 0x65, 0xee, 0x52, 0x65, 0x2f, 0x30, 0x30, 0x41, 0x23, 0x42, 0x74, 0x78, 0x2b, 0x23, 0x39, 0x30, 0x2e, 0x40, 0x40, 0x3d, 0x34, 0x32, 0x40, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x47, 0x47, 0x3d, 0x32, 0x2f, 0x27, 0x56, 0x72, 0xb5, 0x98, 0x9d, 0x94, 0x9d, 0x9b, 0x9b, 0x9b, 0x9c, 0xa2, 0x9c, 0xa5, 0xa0, 0x9d, 0x9d, 0x99, 0x9b, 0x99, 0x99, 0x98, 0x98, 0x98, 0x99, 0xa9, 0xab, 0xac, 0xc5, 0xc8, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcc, 0xcc, 0xc9, 0xd8, 0xe2, 0xe9, 0xe7, 0xf1, 0xf2, 0xf4, 0xf8, 0xf1, 0xf5, 0xf1, 0xe7, 0xf1, 0xe8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xe8, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 
-  0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xe7, 0xae, 0xe4, 0xae, 0xe8, 0xe6, 0xf2, 0xe6, 0xf3, 0xe5, 0xea, 0xdf, 0xbc, 0xaa, 0xac, 0xac, 0xac, 0xac, 0xab, 0xa9, 0xb7, 0x96, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x90, 0x92, 0x92, 0x94, 0x97, 0x9b, 0x9c, 0x9b, 0x9c, 0x9c, 0xa3, 0xa3, 0x9f, 0x9e, 0x9e, 0xa7, 0x9e, 0x99, 0xba, 0x78, 0x56, 0x1d, 0x3c, 0x38, 0x46, 0x46, 0x34, 0x2e, 0x37, 0x38, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x46, 0x30, 0x25, 0x30, 0x34, 0x32, 0x26, 0x7c, 0xbc, 0xba, 0x79, 0x2a, 0x23, 0x34, 0x30, 0x36, 0x78, 0xbb, 0xdc, 0x6d, 0x20, 0x31, 0x31, 0x31, 0x34, 0x38, 0x46, 0x32, 0x37, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x41, 0x34, 0x37, 0x41, 0x4a, 0x46, 0x25, 0x5e, 0xfd, 0xa4, 0x98, 0xa0, 0x9a, 0xa2, 0x9b, 0xb9, 0xa2, 0xa0, 0x9b, 0x9d, 0x9e, 0x9b, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0x9b, 0x9b, 0x97, 0x94, 0x94, 0x92, 0x94, 0xb8, 0xa8, 0xab, 0xac, 0xc5, 0xc5, 0xcf, 0xcc, 0xd2, 0xe0, 0xe9, 0xe9, 0xe6, 0xf2, 0xe4, 0xf4, 0xe4, 0xf5, 0xe7, 0xf1, 0xe7, 0xe7, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf9, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xe4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xae, 0xe7, 0xae, 0xf2, 0xe4, 0xf3, 0xea, 0xf7, 0xf7, 0xf6, 0xe1, 0xca, 0xa4, 0xb4, 0x91, 0x8f, 0x8d, 0x8d, 0x8b, 0x8b, 0x8b, 0x8b, 0x8d, 0x8d, 0x8f, 0x90, 0x97, 0x98, 0x9c, 0xa2, 0xa2, 0x9c, 0xa0, 0x9c, 0xa7, 0xa0, 0xa0, 0x9b, 0x9e, 0x9e, 0xa0, 0xa2, 0xa5, 0xa0, 0x96, 0xef, 0x5f, 0x35, 0x38, 0x43, 0x46, 0x40, 0x41, 0x2e, 0x37, 0x37, 0x3d, 0x3d, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x3d, 0x34, 0x34, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x46, 0x37, 0x31, 0x30, 0x34, 0x1d, 0x6b, 0xd9, 0x97, 0x95, 0xd7, 0x69, 0x2a, 0x1f, 0x28, 0x73, 0xd7, 0x95, 0xc0, 0x7c, 0x33, 0x27, 0x30, 0x31, 0x34, 0x46, 0x46, 0x40, 0x34, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x40, 0x3d, 0x3d, 0x3d, 0x40, 0x41, 0x3d, 0x3e, 0x3f, 0x4a, 0x53, 0x46, 0x20, 0x5f, 0xef, 0x96, 0x9c, 0x9a, 0x9d, 0xb9, 0x9c, 0x9c, 0x9a, 0xa0, 0xa0, 0x9d, 0x9d, 0x9d, 0x9d, 0x9b, 0x9a, 0x9d, 0x9e, 0x9b, 0x9d, 0x9b, 0x9d, 0x97, 0x9b, 0x9b, 0x97, 0x94, 0x92, 0x94, 0x94, 0x94, 0x97, 0x99, 0xa9, 0xab, 0xc0, 0xd6, 0xe0, 0xe7, 0xea, 0xe8, 0xe9, 0xe7, 0xf1, 0xf1, 0xf5, 0xf1, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf1, 0xea, 0xf2, 0xf3, 0xf7, 0xf7, 0xf7, 0xde, 0xc6, 0xeb, 0xb0, 0x87, 0x87, 0x87, 0x87, 0x88, 0x8b, 0x8d, 0x8f, 0x91, 0x95, 0xb8, 0xa6, 0xa6, 0xa8, 0xa6, 0xb9, 0xb9, 0xa3, 0x9b, 0xa0, 0x9d, 0x9d, 0x9d, 0x9d, 0xa0, 0xa0, 0xa2, 0x9e, 0x9d, 0xa2, 0x9c, 0xa2, 0x94, 0xc1, 0x71, 0x27, 0x32, 0x40, 0x38, 0x41, 0x3d, 0x34, 0x37, 0x2e, 0x3d, 0x38, 0x3d, 0x34, 0x32, 0x34, 0x32, 0x34, 0x32, 0x34, 0x32, 0x34, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x3d, 0x3f, 0x30, 0x34, 0x23, 0x2d, 0x77, 0xab, 0x94, 0x9a, 0xb5, 0xfd, 0x70, 0x6b, 0x75, 0xd7, 0xba, 0x97, 0x95, 0xd8, 0x70, 0x18, 0x41, 0x41, 0x3d, 0x38, 0x46, 0x41, 0x34, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x4a, 0x3d, 0x3f, 0x34, 0x41, 0x53, 0x4a, 0x4b, 0x27, 0x69, 0xc6, 0x96, 0x9a, 0x9d, 0xb9, 0xb9, 0x9d, 0x9e, 0x9d, 0x9c, 0x9c, 0x9c, 0x9c, 0xa0, 0xa0, 0xa0, 0x9c, 0x9d, 0xa0, 0x9d, 0x9b, 0x9b, 0x97, 0x94, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x94, 0x95, 0x95, 0xb8, 0xbc, 0xd4, 0xdd, 0xe5, 0xea, 0xea, 0xe7, 0xf2, 0xf4, 0xf2, 0xe7, 0xe4, 0xe8, 0xf2, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf1, 0xf3, 0xf1, 0xe4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe4, 0xf4, 0xf1, 0xe4, 0xf3, 0xf2, 0xf6, 0xf7, 0xfb, 0xef, 0xec, 0x07, 0x89, 0x86, 0x86, 0x87, 0x87, 0x88, 0x8d, 0x90, 0x92, 0xb8, 0xa9, 0xa9, 0xa8, 0xa9, 0xa3, 0xb8, 0x9c, 0x9c, 0x9c, 0x9d, 0x9d, 0x9b, 0x9d, 0x9d, 0x9d, 0xa0, 0x9d, 0xa0, 0x9d, 0xa0, 0xa0, 0x9e, 0xa0, 0xb9, 0xb9, 0x9c, 0xb7, 0xfc, 0x56, 0x2f, 0x53, 0x3d, 0x34, 0x37, 0x37, 0x37, 0x2e, 0x34, 0x3d, 0x40, 0x40, 0x32, 0x34, 0x32, 0x34, 0x32, 0x34, 0x32, 0x34, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x43, 0x32, 0x34, 0x2e, 0x1c, 0x78, 0xc3, 0x94, 0xa2, 0x9f, 0x94, 0xba, 0xed, 0xc1, 0xbd, 0xb5, 0x97, 0x9d, 0x9c, 0x98, 0xf0, 0x65, 0x23, 0x3d, 0x3d, 0x40, 0x38, 0x41, 0x34, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x46, 0x38, 0x38, 0x43, 0x3f, 0x37, 0x47, 0x3d, 0x46, 0x44, 0x74, 0xbc, 0x9a, 0x9a, 0xb9, 0x9c, 0x9b, 0x9e, 0x9c, 0xa3, 0x9c, 0xa3, 0xa3, 0x9c, 0xa3, 0x9c, 0xa2, 0x9c, 0xa2, 0xa0, 0x9b, 0x9b, 0x97, 0x94, 0x97, 0x97, 0x97, 0x97, 0x9b, 0x97, 0x97, 0x9b, 0x9b, 0x9a, 0xa0, 0x9a, 0x9b, 0x97, 0x99, 0x95, 0x95, 0xbc, 0xc4, 0xdb, 0xea, 0xea, 0xf3, 0xe8, 0xe8, 0xe4, 0xe7, 0xe4, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe4, 0xf4, 0xf2, 0xf6, 0xf7, 0x77, 0xc6, 0xb2, 0xaf, 0x84, 0x86, 0x87, 0x87, 0x88, 0x8d, 0x91, 0xb7, 0xa9, 0xa9, 0xa8, 0xa8, 0xa5, 0xa5, 0xa7, 0xa2, 0xa3, 0xa2, 0xa7, 0xa2, 0x9d, 0x9d, 0xa2, 0xa2, 0x9d, 0xa0, 0x9d, 0x9d, 0x9d, 0xa2, 0xa0, 0xa2, 0xa0, 0xa0, 0xa0, 0xb9, 0xb9, 0x9c, 0xbc, 0x74, 0x26, 0x40, 0x4a, 0x34, 0x37, 0x2e, 0x3e, 0x2e, 0x37, 0x32, 0x32, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x34, 0x3c, 0x18, 0x62, 0xf0, 0x96, 0x9d, 0x9b, 0x9f, 0x9e, 0xb8, 0x98, 0x96, 0x98, 0x9f, 0x9f, 0xa7, 0x9b, 0x97, 0xbc, 0x7e, 0x1e, 0x25, 0x2f, 0x32, 0x37, 0x34, 0x41, 0x32, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x38, 0x37, 0x3e, 0x37, 0x40, 0x46, 0x2f, 0x6f, 0xca, 0x94, 0x9a, 0xb9, 0x9c, 0x9e, 0x9a, 0xb9, 0x9c, 0xa3, 0x9c, 0x9c, 0xa3, 0x9c, 0x9c, 0xa0, 0x9c, 0xa0, 0x9c, 0xa2, 0xa7, 0xa2, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9e, 0x9a, 0x9e, 0x9a, 0x9b, 0x9c, 0x99, 0x94, 0x95, 0x96, 0xc0, 0xda, 0xf6, 0xea, 0xe3, 0xe3, 0xea, 0xe4, 0xf1, 0xe8, 0xf1, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xfb, 0xe4, 0xf7, 0xdc, 0xeb, 0x86, 0x84, 0x84, 0x86, 0x87, 0x88, 0x8d, 0x91, 0xaa, 0xaa, 0xa8, 0xa8, 0xa7, 0xa7, 0xa7, 0xa8, 0xa7, 0xa3, 0xa2, 0xa0, 0xa2, 0xa0, 0x9b, 0xa0, 0xa3, 0xa0, 0xa2, 0xa0, 0x9c, 0x9d, 0x9c, 0xa2, 0x9c, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa0, 0x9d, 0x9d, 0x97, 0xbd, 0x70, 0x2a, 0x43, 0x3d, 0x40, 0x3d, 0x32, 0x37, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x32, 0x32, 0x34, 0x3d, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x34, 0x3f, 0x1d, 0x56, 0x77, 0xbc, 0x98, 0x9c, 0x9a, 0xa7, 0x9d, 0xa2, 0x9e, 0x9d, 0x9f, 0x9f, 0x9d, 0x9d, 0x9e, 0x9a, 0x97, 0xbd, 0xff, 0x22, 0x2b, 0x30, 0x2e, 0x34, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x38, 0x40, 0x40, 0x41, 0x34, 0x34, 0x3f, 0x43, 0x44, 0xde, 0x94, 0x9a, 0xb9, 0x9b, 0x9e, 0x9e, 0xb8, 0x9d, 0x9d, 0x9d, 0xa0, 0x9d, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9d, 0x9d, 0x9d, 0x9a, 0x9b, 0x9a, 0x9d, 0x9a, 0x9d, 0x9d, 0x9d, 0x9d, 0x9b, 0x9c, 0x9b, 0x9b, 0x9c, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9c, 0x99, 0x95, 0x91, 0xab, 0xda, 0xf7, 0xe8, 0xe4, 0xe7, 0xe8, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe4, 0xf7, 0xed, 0xaf, 0x84, 0x84, 0x87, 0x87, 0x87, 0x8d, 0x96, 0xa9, 0xa9, 0xb9, 0xa8, 0xa8, 0xa8, 0xa8, 0xb9, 0xa8, 0xa9, 0xb9, 0xb9, 0xa3, 0xa0, 0xa0, 0xa0, 0xa7, 0xa0, 0xa0, 0xa3, 0x9c, 0xa3, 0xa2, 0x9d, 0xa2, 0x9c, 0x9d, 0xa0, 0xa2, 0xa0, 0xa2, 0xa0, 0xa0, 0x9d, 0x9f, 0x97, 0xbd, 0x73, 0x2a, 0x4b, 0x39, 0x3d, 0x38, 0x3d, 0x3d, 0x38, 0x3d, 0x38, 0x32, 0x2e, 0x2e, 0x3d, 0x32, 0x34, 0x32, 0x32, 0x32, 0x34, 0x32, 0x32, 0x32, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x34, 0x25, 0x2d, 0x7d, 0xc0, 0x98, 0xb9, 0xa0, 0x9e, 0x9d, 0xb9, 0x9d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9d, 0xa0, 0x9d, 0xa3, 0xa1, 0x92, 0xce, 0x78, 0x18, 0x2c, 0x30, 0x2e, 0x34, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x40, 0x3d, 0x34, 0x3d, 0x40, 0x40, 0x46, 0x41, 0x41, 0x37, 0x2c, 0x32, 0x51, 0x72, 0x9e, 0x9a, 0x9c, 0x9c, 0x9e, 0x9b, 0xb9, 0x9d, 0x9e, 0x9d, 0x9e, 0x9d, 0x9e, 0x9d, 0x9d, 0xa0, 0x9d, 0x9d, 0x9f, 0x9d, 0x9f, 0x9f, 0x9f, 0x9a, 0x9e, 0x9d, 0xa0, 0xa0, 0xa7, 0x9c, 0x9b, 0x9c, 0x99, 0x9c, 0xb8, 0xa3, 0x9c, 0x9b, 0x9b, 0x9a, 0x97, 0x97, 0x9c, 0x97, 0x95, 0xb5, 0xdc, 0xea, 0xe7, 0xe8, 0xf1, 0xe8, 0xf1, 0xf2, 0xe8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf6, 0xec, 0x84, 0x84, 0x82, 0x86, 0x86, 0x8b, 0x92, 0xa8, 0xa8, 0xa5, 0xa8, 0xa8, 0xa9, 0xb9, 0xa8, 0xa7, 0xa5, 0xa8, 0xa2, 0xb9, 0xa9, 0xa9, 0xa6, 0xa6, 0xa0, 0xa0, 0x9b, 0xa2, 0x9c, 0xb9, 0xb8, 0x9d, 0xa2, 0x9c, 0x9d, 0xa2, 0x9d, 0x9d, 0x9d, 0x9d, 0xa3, 0xa3, 0xa0, 0xa1, 0x9e, 0xb5, 0x70, 0x33, 0x2b, 0x31, 0x3e, 0x3d, 0x38, 0x38, 0x38, 0x3d, 0x3d, 0x32, 0x37, 0x34, 0x3d, 0x41, 0x32, 0x41, 0x32, 0x3d, 0x32, 0x32, 0x34, 0x3d, 0x3d, 0x34, 0x37, 0x37, 0x32, 0x3d, 0x40, 0x32, 0x37, 0x1f, 0x3b, 0x7e, 0xc1, 0x98, 0x9d, 0xa2, 0xa2, 0x9a, 0x9f, 0xa2, 0x9d, 0xa0, 0xa0, 0xa0, 0xa2, 0xa2, 0xa2, 0xa0, 0xb9, 0x9a, 0xa1, 0x94, 0xc7, 0x7a, 0x19, 0x2b, 0x2c, 0x31, 0x2e, 0x32, 0x38, 0x46, 0x46, 0x38, 0x40, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x4a, 0x3d, 0x34, 0x34, 0x34, 0x3d, 0x41, 0x4a, 0x4a, 0x38, 0x3f, 0x2f, 0x3d, 0x32, 0x3f, 0x37, 0x2e, 0x48, 0xf0, 0x99, 0x9b, 0xb9, 0x9c, 0xa1, 0x9f, 0xb9, 0xb9, 0x9d, 0x9d, 0x9d, 0x9f, 0x9d, 0x9f, 0x9d, 0x9d, 0x9b, 0xa6, 0xa8, 0x9a, 0x9a, 0xa1, 0x9a, 0xa7, 0x92, 0x8f, 0x8b, 0x8d, 0x97, 0x9c, 0x9d, 0x9b, 0x9d, 0x9b, 0x9c, 0x99, 0x9c, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x99, 0xa2, 0x91, 0xc3, 0xe8, 0xe3, 0xe4, 0xf4, 0xf2, 0xf1, 0xe8, 0xe4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xea, 0xf8, 0xb6, 0x84, 0x84, 0x82, 0x86, 0x8c, 0x96, 0xa9, 0xa5, 0xa5, 0xa5, 0xa7, 0xa8, 0xa8, 0xa5, 0xa8, 0xa5, 0xa7, 0xa8, 0xa8, 0xa6, 0x98, 0x8f, 0x8d, 0x8f, 0x92, 0xa7, 0xa2, 0x9c, 0xa0, 0x9c, 0xa3, 0x9c, 0x9c, 0xa2, 0x9d, 0x9d, 0xa0, 0xa2, 0xa0, 0x9d, 0xa3, 0xa3, 0x9c, 0xa1, 0x9e, 0x98, 0xfc, 0x5f, 0x2b, 0x37, 0x41, 0x40, 0x3d, 0x3d, 0x32, 0x3d, 0x32, 0x32, 0x3d, 0x32, 0x30, 0x2e, 0x37, 0x32, 0x34, 0x38, 0x3d, 0x3d, 0x38, 0x40, 0x41, 0x32, 0x37, 0x32, 0x3d, 0x3d, 0x43, 0x3f, 0x20, 0x57, 0x7c, 0xca, 0x96, 0x9d, 0x9d, 0x9c, 0x9d, 0x9e, 0x9d, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0x9d, 0xa3, 0x9e, 0x9a, 0x9e, 0x95, 0xee, 0x79, 0x19, 0x35, 0x2c, 0x3d, 0x3d, 0x46, 0x32, 0x2e, 0x3c, 0x37, 0x32, 0x46, 0x37, 0x2e, 0x3d, 0x3d, 0x3d, 0x34, 0x37, 0x37, 0x34, 0x3d, 0x40, 0x3d, 0x37, 0x37, 0x3d, 0x40, 0x4a, 0x41, 0x34, 0x2c, 0x60, 0xd7, 0x97, 0xa2, 0xb8, 0xa0, 0x9a, 0x9f, 0xb9, 0xb9, 0x9c, 0xa3, 0x9d, 0xa2, 0xa7, 0xa2, 0xa7, 0xa3, 0xa8, 0x95, 0x92, 0xa7, 0x9f, 0x9a, 0xa0, 0xa5, 0x8b, 0x8b, 0x8b, 0x8b, 0x92, 0xa6, 0x9b, 0x9d, 0x9b, 0x9b, 0x9b, 0x9c, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x99, 0x98, 0x96, 0xda, 0xe7, 0xe7, 0xf5, 0xf1, 0xf4, 0xf2, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf6, 0xe1, 0xb1, 0x84, 0x84, 0x86, 0x88, 0xb4, 0xaa, 0xa9, 0xa8, 0xa8, 0xa8, 0xa5, 0xa8, 0xa5, 0xa8, 0xa5, 0xa8, 0xa0, 0xa9, 0x90, 0x88, 0x88, 0x88, 0x88, 0x8b, 0x98, 0xb9, 0x9d, 0xa2, 0xa0, 0xa0, 0x9c, 0xa3, 0x9c, 0x9c, 0x9c, 0xa3, 0x9c, 0xa3, 0x9c, 0xa3, 0xa2, 0xa3, 0xa0, 0xa0, 0x97, 0xbd, 0x72, 0x2a, 0x43, 0x41, 0x41, 0x30, 0x30, 0x31, 0x2c, 0x30, 0x34, 0x3d, 0x32, 0x2c, 0x2c, 0x2e, 0x2e, 0x32, 0x3d, 0x3d, 0x38, 0x3d, 0x40, 0x40, 0x40, 0x41, 0x40, 0x4a, 0x32, 0x2c, 0x18, 0x65, 0x7d, 0xc1, 0xb5, 0x9a, 0x9f, 0x9f, 0xa2, 0xa3, 0x9d, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x9e, 0xa8, 0x9d, 0x9d, 0xa5, 0x98, 0xc3, 0x7d, 0x22, 0x20, 0x38, 0x40, 0x3d, 0x3d, 0x2e, 0x31, 0x2c, 0x37, 0x32, 0x37, 0x2f, 0x32, 0x3d, 0x3d, 0x2e, 0x2e, 0x37, 0x32, 0x3d, 0x2c, 0x3e, 0x2e, 0x34, 0x4a, 0x4a, 0x4a, 0x41, 0x32, 0x1f, 0x78, 0xbd, 0x97, 0x9d, 0xb9, 0xb9, 0x9e, 0x9a, 0xb9, 0xb9, 0xb9, 0x9c, 0xb9, 0x9c, 0x9c, 0xa3, 0xa9, 0xa6, 0xaa, 0x8d, 0x8b, 0xa3, 0xa3, 0xa5, 0xa0, 0xa9, 0x8f, 0x8b, 0x8b, 0x8d, 0x99, 0xa6, 0x9b, 0x9b, 0x9a, 0x9b, 0x9e, 0x9b, 0x9b, 0x9b, 0x9d, 0x9b, 0x9c, 0xb8, 0x99, 0x95, 0xb7, 0xd4, 0xf6, 0xe5, 0xe5, 0xf4, 0xf1, 0xf9, 0xf2, 0xe6, 0xe4, 0xe6, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xe4, 0xf6, 0xfb, 0xca, 0xb2, 0x86, 0x86, 0x87, 0x8d, 0xb5, 0xa9, 0xaa, 0xa9, 0xa8, 0xa8, 0xa8, 0xa5, 0xa8, 0xa3, 0xa6, 0xaa, 0x8b, 0x88, 0x88, 0x88, 0x88, 0x8b, 0x99, 0xb9, 0x9d, 0x9d, 0x9f, 0x9d, 0xa0, 0x9c, 0xa0, 0xa0, 0xa0, 0x9c, 0xa3, 0xa3, 0xa3, 0x9c, 0x9d, 0xa0, 0xb9, 0xa3, 0xa7, 0x94, 0xc1, 0x6b, 0x2a, 0x2c, 0x3e, 0x2c, 0x31, 0x2c, 0x30, 0x30, 0x34, 0x34, 0x34, 0x3d, 0x32, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x34, 0x32, 0x32, 0x3d, 0x40, 0x4a, 0x4a, 0x46, 0x25, 0x2d, 0x70, 0xfd, 0xbd, 0x98, 0x9d, 0x9f, 0x9f, 0xa5, 0xa0, 0xa0, 0xa2, 0xa5, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa7, 0x9e, 0x9b, 0xa8, 0xa7, 0x9a, 0xa1, 0x94, 0xc0, 0x74, 0x65, 0x21, 0x20, 0x2f, 0x41, 0x3d, 0x41, 0x37, 0x37, 0x2c, 0x37, 0x34, 0x40, 0x40, 0x3d, 0x3d, 0x3f, 0x32, 0x3d, 0x40, 0x2e, 0x3e, 0x34, 0x41, 0x41, 0x41, 0x40, 0x2c, 0x1f, 0x65, 0xd7, 0x96, 0xa1, 0x9b, 0xb9, 0x9c, 0x9e, 0x9e, 0x9c, 0xa3, 0x9c, 0xb9, 0xa2, 0x9c, 0xa8, 0x99, 0x92, 0x90, 0x90, 0x91, 0x98, 0xa6, 0x9c, 0xa7, 0x9d, 0xa7, 0x9c, 0x92, 0x92, 0xb8, 0xa6, 0x99, 0x9d, 0x9b, 0x9a, 0x9e, 0x9b, 0x9b, 0x9b, 0xa3, 0x97, 0x99, 0x98, 0x95, 0xbc, 0xc4, 0xe0, 0xe9, 0xe7, 0xf2, 0xf5, 0xfb, 0xf9, 0xf4, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xe4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf6, 0xe4, 0xf6, 0xf7, 0x85, 0xd9, 0xbb, 0x8e, 0x86, 0x86, 0x88, 0x8f, 0x95, 0xa9, 0xaa, 0xaa, 0xaa, 0xa9, 0xa9, 0xa9, 0xa9, 0x96, 0x8d, 0x8d, 0x8d, 0x90, 0x95, 0xb8, 0xa3, 0x9d, 0xa2, 0x9f, 0x9f, 0x9d, 0x9e, 0xa0, 0xa0, 0xa0, 0xa2, 0xa0, 0xa3, 0xa0, 0xa2, 0xa0, 0x9f, 0xa3, 0xb9, 0xa2, 0x9e, 0x98, 0xc6, 0x6f, 0x33, 0x1f, 0x25, 0x3c, 0x32, 0x3d, 0x40, 0x41, 0x34, 0x32, 0x32, 0x40, 0x41, 0x41, 0x41, 0x41, 0x34, 0x34, 0x30, 0x37, 0x37, 0x3d, 0x32, 0x32, 0x1d, 0x5c, 0x74, 0xd9, 0xba, 0x9b, 0xa7, 0x9a, 0xa1, 0xa1, 0x9d, 0xa0, 0xa0, 0xa5, 0xa2, 0xa2, 0xa0, 0xa7, 0xa0, 0xa7, 0xa0, 0xa7, 0xa0, 0xa5, 0x9e, 0xa5, 0xb8, 0xa7, 0xa5, 0xa1, 0xa1, 0x98, 0xbc, 0xef, 0x78, 0x3a, 0x1b, 0x2b, 0x38, 0x41, 0x41, 0x34, 0x3e, 0x34, 0x34, 0x41, 0x4a, 0x3d, 0x32, 0x32, 0x3d, 0x41, 0x46, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x2f, 0x20, 0x19, 0x66, 0xfc, 0xba, 0x99, 0xa1, 0xa2, 0xb9, 0x9c, 0x9e, 0x9a, 0xa0, 0x9d, 0xa2, 0x9d, 0xa0, 0xa2, 0xa3, 0x90, 0x88, 0x8b, 0x88, 0x8b, 0x94, 0xa3, 0x9b, 0x9f, 0xa5, 0x9d, 0x9d, 0xa7, 0xa7, 0x9c, 0x97, 0x9d, 0x9b, 0x9d, 0x9c, 0x9b, 0x99, 0x9c, 0x98, 0x95, 0x95, 0xb7, 0xbf, 0xd4, 0xe0, 0xea, 0xea, 0xe7, 0xf1, 0xf5, 0xf1, 0xf4, 0xf9, 0xf2, 0xf2, 0xe6, 0xe4, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0x85, 0xf7, 0xf7, 0xf7, 0xde, 0xc6, 0xb6, 0x8e, 0x88, 0x88, 0x88, 0x8c, 0x8f, 0x91, 0xb5, 0xba, 0xba, 0xaa, 0xab, 0xaa, 0xaa, 0xaa, 0xa9, 0xa7, 0xa3, 0xa2, 0x9d, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xa2, 0xa5, 0x9e, 0xa5, 0xb9, 0xb9, 0x9f, 0xa5, 0x94, 0xbd, 0x63, 0x62, 0x57, 0x2a, 0x25, 0x2f, 0x23, 0x1d, 0x1f, 0x21, 0x28, 0x1d, 0x1d, 0x23, 0x34, 0x32, 0x34, 0x34, 0x23, 0x2f, 0x2c, 0x1f, 0x1c, 0x56, 0x71, 0xfd, 0xc0, 0x97, 0x9a, 0x9e, 0x9f, 0x9f, 0x9f, 0xa0, 0x9e, 0xa0, 0x9d, 0x9f, 0xa5, 0xa0, 0xa7, 0xa2, 0xa7, 0xa2, 0xa7, 0xa2, 0xa7, 0xa0, 0xa5, 0xa0, 0xa7, 0xb9, 0xa2, 0x9d, 0x9d, 0x9e, 0x9b, 0x94, 0xc0, 0xde, 0x71, 0x57, 0x1b, 0x25, 0x23, 0x2f, 0x38, 0x30, 0x34, 0x34, 0x23, 0x37, 0x25, 0x25, 0x25, 0x23, 0x32, 0x23, 0x2e, 0x2c, 0x25, 0x20, 0x2d, 0x5d, 0x63, 0xc3, 0xb5, 0xa6, 0x9f, 0x9f, 0x9d, 0x9c, 0xa2, 0xa0, 0x9e, 0xa0, 0xa5, 0x9e, 0x9a, 0x9d, 0x9e, 0xa0, 0x9a, 0x90, 0x90, 0x92, 0x94, 0x9b, 0x9b, 0x9d, 0x9f, 0x9f, 0x9a, 0x9f, 0x9a, 0x9a, 0x9a, 0x9d, 0x9d, 0x9b, 0x98, 0x98, 0x96, 0x96, 0xb5, 0xbc, 0xc4, 0xda, 0xe0, 0xf6, 0xf6, 0x85, 0xe6, 0xf8, 0xf3, 0xf9, 0xf2, 0xf9, 0xf9, 0xf2, 0xf9, 0xf2, 0xf1, 0xe6, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf9, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf8, 0x81, 0x81, 0xf7, 0xf7, 0xae, 0xdc, 0xca, 0xbe, 0xb4, 0xb1, 0x8c, 0x88, 0x88, 0x88, 0x8b, 0x8d, 0x8f, 0x91, 0x92, 0xb8, 0xa9, 0xa9, 0xa9, 0xa9, 0xb9, 0xb9, 0x9c, 0xa0, 0xa0, 0x9d, 0x9d, 0xa2, 0x9d, 0x9d, 0xa2, 0xa2, 0x9d, 0x9e, 0xa5, 0xa6, 0xa9, 0xa2, 0x9f, 0xa1, 0x9e, 0xb4, 0xed, 0xfc, 0x62, 0x62, 0x65, 0x65, 0x62, 0x67, 0x6a, 0x67, 0x6c, 0x5f, 0x2d, 0x21, 0x1f, 0x1d, 0x20, 0x27, 0x35, 0x48, 0x66, 0x72, 0xde, 0xc7, 0xba, 0x97, 0x9d, 0xa1, 0x9e, 0x9e, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0x9f, 0xa2, 0xa2, 0xa7, 0xa2, 0xa7, 0xa2, 0xa7, 0xa2, 0xa7, 0xa2, 0xa0, 0xa5, 0xa7, 0xa7, 0xb9, 0xb9, 0xb9, 0xa2, 0xa1, 0xa1, 0x99, 0xb7, 0xca, 0xf0, 0x75, 0x62, 0x57, 0x2a, 0x1d, 0x1f, 0x1c, 0x1c, 0x1c, 0x1e, 0x57, 0x57, 0x4e, 0x2d, 0x26, 0x35, 0x33, 0x58, 0x5e, 0x69, 0x63, 0xee, 0xbd, 0x99, 0xa8, 0xa5, 0xa5, 0x9d, 0xa2, 0x9c, 0x9d, 0x9d, 0x9b, 0xa0, 0x9d, 0x9a, 0x9e, 0x9a, 0xa0, 0xa0, 0xa6, 0xa7, 0xa9, 0x9c, 0xa0, 0xa0, 0xa0, 0xa0, 0x9b, 0x9b, 0x9d, 0x9b, 0x9b, 0x97, 0x94, 0x94, 0x92, 0x95, 0xb7, 0xbc, 0xc1, 0xd6, 0xdd, 0xe2, 0x85, 0xe7, 0xe6, 0xe8, 0xf1, 0xf8, 0xf3, 0xf8, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xe4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf9, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf8, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf3, 0xf6, 0xf7, 0xf7, 0xf7, 0xf6, 0xe4, 0xdf, 0xd9, 0xc7, 0xbe, 0xa4, 0xb3, 0xb2, 0x8d, 0x8a, 0x8b, 0x8d, 0x8f, 0x90, 0x91, 0x95, 0xb7, 0xb8, 0xb8, 0xa6, 0xa6, 0xa3, 0xa8, 0xa7, 0xa2, 0xa0, 0xa7, 0xa0, 0xa0, 0xa0, 0xa2, 0xa8, 0xa7, 0xa1, 0xa1, 0xa1, 0x9a, 0x98, 0xba, 0xbd, 0xbe, 0xc0, 0xc0, 0xab, 0xbc, 0xb7, 0xbd, 0xef, 0x72, 0x78, 0x71, 0x71, 0x70, 0x71, 0x6a, 0xfd, 0xce, 0xbf, 0x94, 0x94, 0xa1, 0x9a, 0xa5, 0xa2, 0x9e, 0xa0, 0xa2, 0xb9, 0xa3, 0xa7, 0x9e, 0xa5, 0x9f, 0xa2, 0xa7, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa7, 0xa7, 0xa0, 0x9f, 0xa5, 0xb9, 0xa9, 0xb9, 0x9d, 0xa1, 0xa1, 0x9a, 0xa3, 0x9c, 0x96, 0xc0, 0xce, 0xf0, 0x78, 0x79, 0x75, 0x6a, 0x71, 0x6a, 0x63, 0xc6, 0xee, 0xef, 0xef, 0xfd, 0x63, 0x63, 0xfc, 0xc3, 0xbe, 0xbc, 0xb7, 0x9c, 0xa1, 0xa1, 0xa5, 0xa2, 0xa3, 0x9c, 0x9d, 0x9d, 0x9d, 0x9c, 0x9c, 0xa0, 0xa0, 0x9b, 0x9d, 0x9d, 0xa0, 0x9c, 0x99, 0xa6, 0x99, 0x99, 0x98, 0x95, 0x95, 0x91, 0x91, 0x91, 0x95, 0x96, 0xbc, 0xc0, 0xc7, 0xd6, 0xdf, 0xe2, 0xe9, 0xf6, 0xea, 0xe9, 0xe8, 0xe7, 0xf1, 0xf4, 0xf4, 0xf3, 0xf2, 0xf8, 0xe6, 0xf3, 0xe6, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf1, 0xea, 0xf1, 0xe8, 0xf1, 0xe6, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0x85, 0xf1, 0xe2, 0xde, 0xdb, 0xd7, 0xc7, 0xed, 0xbc, 0xa4, 0x96, 0x91, 0x91, 0x91, 0x91, 0x92, 0x95, 0x92, 0x98, 0x98, 0x9b, 0x9b, 0x99, 0xa6, 0x9e, 0xa1, 0x9d, 0xb9, 0xa8, 0xa5, 0x9f, 0x9e, 0xa5, 0x9e, 0x9b, 0x9b, 0x97, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x95, 0xba, 0xc0, 0xc0, 0xc0, 0xbd, 0xaa, 0xa9, 0x99, 0x97, 0xa1, 0x9a, 0xa1, 0x9a, 0xa8, 0xa2, 0xa0, 0x9f, 0xa5, 0xb9, 0xa2, 0xb9, 0xa5, 0x9d, 0x9e, 0xa2, 0xa7, 0xa2, 0xa2, 0xa5, 0xa2, 0xa5, 0xa2, 0xa5, 0xa2, 0xa2, 0xa7, 0xa2, 0xa5, 0x9f, 0xa5, 0xa2, 0xa7, 0xa7, 0x9e, 0x9f, 0x9a, 0x9f, 0x9d, 0x9f, 0x9a, 0x9b, 0xa6, 0xab, 0xbf, 0xc3, 0xc1, 0xc1, 0xbf, 0xba, 0xb8, 0x99, 0x9b, 0xb8, 0xb7, 0xaa, 0x99, 0x9c, 0x9b, 0xa5, 0x9f, 0xa8, 0xa5, 0xa1, 0x9f, 0xa5, 0xb9, 0xa6, 0xa3, 0xa0, 0x9f, 0x9d, 0x9b, 0x99, 0x97, 0x97, 0x97, 0x94, 0x94, 0x92, 0x94, 0x95, 0x92, 0x95, 0x96, 0xb7, 0xab, 0xc0, 0xc7, 0xd4, 0xda, 0xdb, 0xe1, 0xe0, 0xae, 0xf6, 0xea, 0xe6, 0xe8, 0xe6, 0xe4, 0xe4, 0xe6, 0xf1, 0xf2, 0xf4, 0xf1, 0xf9, 0xf1, 0xf1, 0xe7, 0xe3, 0xe7, 0xe4, 0xe6, 0xae, 0xf2, 0xe6, 0xe6, 0xe4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf9, 0xe8, 0xf8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe8, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf5, 0xe4, 0xe8, 0xe4, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf4, 0xf8, 0xf3, 0xe4, 0xf8, 0xf3, 0xf3, 0xf4, 0xfb, 0xfb, 0xf7, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xe6, 0xae, 0xe0, 0xdd, 0xda, 0xd8, 0xce, 0xc7, 0xc1, 0xbf, 0xbf, 0xbc, 0xbc, 0xba, 0xb7, 0x99, 0x99, 0xb5, 0x96, 0x96, 0x98, 0x98, 0x94, 0x97, 0x97, 0x97, 0x97, 0x9a, 0x97, 0x9a, 0x9a, 0x9a, 0x9a, 0x94, 0x94, 0x92, 0x94, 0x9a, 0x94, 0x9a, 0x9a, 0xa1, 0x9a, 0x9f, 0x9a, 0xa2, 0x9d, 0xa0, 0x9e, 0x9d, 0xa2, 0xa2, 0xb9, 0xa2, 0x9d, 0x9e, 0xa0, 0xa3, 0xa0, 0xa7, 0xa7, 0xa7, 0xa7, 0xa2, 0xa7, 0xa2, 0xa7, 0xa2, 0xa7, 0xa2, 0x9d, 0xa5, 0x9e, 0xa5, 0xa0, 0xa0, 0xa3, 0xa0, 0xa1, 0x9f, 0x9f, 0xa1, 0x9a, 0x9a, 0x9a, 0x9a, 0x97, 0x94, 0x97, 0x99, 0x94, 0x9a, 0x9a, 0xa1, 0x9a, 0x9a, 0x9a, 0x94, 0x9a, 0x9a, 0xa1, 0x9a, 0x9a, 0x97, 0x9b, 0x9b, 0x97, 0x98, 0x96, 0x96, 0x95, 0x92, 0x95, 0x96, 0xb7, 0xba, 0xbc, 0xbc, 0xbf, 0xc1, 0xc2, 0xcb, 0xd2, 0xd6, 0xda, 0xdf, 0xe0, 0xe5, 0xe7, 0xe9, 0xea, 0xea, 0xf6, 0xe9, 0xae, 0xea, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf8, 0xe6, 0xf8, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf5, 0xf2, 0xe7, 0xe7, 0xe5, 0xe6, 0xe8, 0xe6, 0xf1, 0xe6, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xea, 0xea, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 0xea, 0xe9, 0xe5, 0xe2, 0xe2, 0xe0, 0xdf, 0xdd, 0xdb, 0xda, 0xd8, 0xd4, 0xd4, 0xc7, 0xc4, 0xc2, 0xc0, 0xac, 0xbf, 0xab, 0xaa, 0xaa, 0xa9, 0xa9, 0xa9, 0xa6, 0xa0, 0x99, 0x9e, 0x97, 0x99, 0x97, 0x97, 0x94, 0x99, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x98, 0x98, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x97, 0x98, 0x99, 0x98, 0x97, 0x94, 0x97, 0x99, 0x9c, 0x99, 0x99, 0xa6, 0xa6, 0xa6, 0xa6, 0xa9, 0xa9, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xbf, 0xac, 0xc1, 0xc2, 0xc4, 0xc7, 0xcb, 0xd4, 0xd8, 0xda, 0xdd, 0xdf, 0xdf, 0xe2, 0xe2, 0xe5, 0xe6, 0xea, 0xea, 0xf7, 0xea, 0xea, 0xf6, 0xea, 0xea, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf2, 0xf1, 0xf1, 0xe7, 0xf2, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe8, 0xe6, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf6, 0xea, 0xea, 0xe8, 0xe9, 0xe9, 0xe5, 0xe5, 0xe2, 0xe2, 0xe0, 0xe0, 0xdf, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xd8, 0xd8, 0xd6, 0xd6, 0xd4, 0xd4, 0xd2, 0xcd, 0xcb, 0xc9, 0xc9, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc9, 0xc7, 0xcd, 0xcb, 0xd2, 0xd2, 0xd4, 0xd4, 0xd6, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xda, 0xda, 0xdb, 0xdb, 0xdd, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe2, 0xe2, 0xe2, 0xe5, 0xe5, 0xe7, 0xe9, 0xea, 0xea, 0xf6, 0xea, 0xf6, 0xf6, 0xea, 0x85, 0x85, 0xe8, 0xe6, 0xe9, 0xe7, 0xea, 0xe7, 0xe7, 0xe8, 0xe3, 0xe8, 0xae, 0xe7, 0xe8, 0xe8, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe8, 0xf2, 0xe8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf3, 0xf9, 0xf3, 0xf2, 0xf3, 0xe8, 0xe8, 0xf1, 0xe4, 0xfa, 0xfa, 0xff, 0xfa, 0xfa, 0xfa, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf4, 0xf4, 0xf2, 0xf2, 0xe8, 0xf4, 0xea, 0xfb, 0xea, 0xf5, 0xf6, 0xfb, 0xf6, 0xfb, 0xf6, 0xea, 0xf6, 0xea, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xea, 0xea, 0xea, 0xf6, 0xea, 0xf6, 0xea, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xea, 0xea, 0xea, 0xea, 0xf6, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xea, 0xf5, 0xf4, 0xf5, 0xfb, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf2, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xe3, 0xf1, 0xe6, 0xe8, 0xe6, 0xf1, 0xf2, 0xf2, 0xf2, 0xe8, 0xe8, 0xe8, 0xf2, 0xe8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xe4, 0xf3, 0xe8, 0xf8, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf8, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xfb, 0xfb, 0xf4, 0xf3, 0xf2, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf4, 0xfe, 0xf8, 0xfe, 0xf8, 0xf8, 0xf8, 0xf1, 0xf3, 0xea, 0xf3, 0xf4, 0xf3, 0xfb, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf9, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xea, 0xf4, 0xf1, 0xf8, 0xf1, 0xf8, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xe8, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xfb, 0xfe, 0xfa, 0xf8, 0xf8, 0xf3, 0xf3, 0xfb, 0xf8, 0xf3, 0xf8, 0xf3, 0xf8, 0xf1, 0xf1, 0xe8, 0xf2, 0xf2, 0xf1, 0xf5, 0xf2, 0xf9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xe4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf9, 0xf4, 0xf9, 0xf8, 0xae, 0xe6, 0xae, 0xe6, 0xae, 0xe6, 0xe6, 0xe6, 0xe8, 0xe4, 0xe4, 0xe8, 0xe4, 0xe8, 0xe6, 0xe6, 0xe6, 0xe4, 0xe4, 0xae, 0xe4, 0xae, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe4, 0xf4, 0xf9, 0xf3, 0xf9, 0xf8, 0xf2, 0xf3, 0xf9, 0xf3, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf9, 0xf2, 0xf8, 0xf8, 0xf9, 0xf8, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xae, 0xe6, 0xae, 0xe6, 0xae, 0xae, 0xae, 0xe6, 0xae, 0xe6, 0xe6, 0xe6, 0xe6, 0xae, 0xe8, 0xe6, 0xae, 0xe6, 0xe4, 0xae, 0xe6, 0xae, 0xe6, 0xae, 0xe4, 0xe6, 0xe8, 0xe6, 0xf3, 0xfb, 0xf9, 0xf8, 0xf8, 0xf8, 0xf2, 0xf2, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xe4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xe7, 0xf1, 0xe7, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf5, 0xf1, 0xe7, 0xae, 0xe7, 0xf1, 0xe8, 0xf1, 0xe7, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xf2, 0xf2, 0xe8, 0xf2, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xe4, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xe8, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf1, 0xf4, 0xf8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xe4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf4, 0xf2, 0xf1, 0xf1, 0xe7, 0xf1, 0xe7, 0xf1, 0xe7, 0xf1, 0xf1, 0xf2, 0xf9, 0xf5, 0xf9, 0xf2, 0xf9, 0xf5, 0xf9, 0xf9, 0xf4, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf5, 0xe6, 0xe7, 0xe4, 0xe7, 0xae, 0xe7, 0xe8, 0xe7, 0xe8, 0xe7, 0xe6, 0xe7, 0xae, 0xf1, 0xe5, 0xe6, 0xe5, 0xe8, 0xe5, 0xe8, 0xe5, 0xe8, 0xe5, 0xe6, 0xe7, 0xe5, 0xe6, 0xe7, 0xf1, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf4, 0xf9, 0xf5, 0xf9, 0xf2, 0xf9, 0xf4, 0xf9, 0xf2, 0xf9, 0xe7, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe7, 0xf1, 0xe7, 0xf9, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf9, 0xf1, 0xf9, 0xf1, 0xf9, 0xf1, 0xf9, 0xf1, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xe8, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xfa, 0xf5, 0xf2, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf9, 0xf4, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf4, 0xf9, 0xfa, 0xf5, 0xf9, 0xf4, 0xf9, 0xf4, 0xf1, 0xe6, 0xf1, 0xe8, 0xf2, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf2, 0xf1, 0xe6, 0xf1, 0xe8, 0xf2, 0xf2, 0xf1, 0xe6, 0xf1, 0xe6, 0xf2, 0xf1, 0xe6, 0xf1, 0xe8, 0xf1, 0xf2, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xfa, 0xf4, 0xf9, 0xf3, 0xf9, 0xf3, 0xf4, 0xf3, 0xf2, 0xf1, 0xf1, 0xe7, 0xf1, 0xe7, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xe6, 0xe4, 0xe6, 0xe8, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf4, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf8, 0xf2, 0xe4, 0xf3, 0xe4, 0xf3, 0xf2, 0xf2, 0xf2, 0xe6, 0xe4, 0xe6, 0xe8, 0xe6, 0xe4, 0xe6, 0xf1, 0xe6, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xe8, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf8, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xae, 0xe8, 0xe6, 0xe6, 0xe4, 0xe6, 0xf2, 0xe6, 0xe6, 0xe4, 0xe6, 0xae, 0xe6, 0xf1, 0xe6, 0xe4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xe6, 0xf1, 0xe6, 0xe6, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe8, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xe8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xf1, 0xf2, 0xf2, 0xf2, 0xe6, 0xf1, 0xe8, 0xf2, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-};
-
-const lv_img_dsc_t image11 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image11_map,
-};
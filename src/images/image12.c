@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE12
-#define LV_ATTRIBUTE_IMG_IMAGE12
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE12 uint8_t image12_map[] = {
-  0xf6, 0xf8, 0xfb, 0xff, 	/*Color of index 0*/
-  0xfe, 0xfe, 0xfd, 0xff, 	/*Color of index 1*/
-  0xfc, 0xfc, 0xf5, 0xff, 	/*Color of index 2*/
-  0xfe, 0xfe, 0xed, 0xff, 	/*Color of index 3*/
-  0xf8, 0xf8, 0xf6, 0xff, 	/*Color of index 4*/
-  0xfe, 0xfd, 0xe3, 0xff, 	/*Color of index 5*/
-  0xfe, 0xfa, 0xd8, 0xff, 	/*Color of index 6*/
-  0xf6, 0xf1, 0xe3, 0xff, 	/*Color of index 7*/
-  0xf9, 0xf3, 0xd6, 0xff, 	/*Color of index 8*/
-  0xfc, 0xf5, 0xc6, 0xff, 	/*Color of index 9*/
-  0xf2, 0xec, 0xd5, 0xff, 	/*Color of index 10*/
-  0xf3, 0xeb, 0xc8, 0xff, 	/*Color of index 11*/
-  0xfb, 0xee, 0xb7, 0xff, 	/*Color of index 12*/
-  0xeb, 0xe3, 0xcc, 0xff, 	/*Color of index 13*/
-  0xf0, 0xe3, 0xbe, 0xff, 	/*Color of index 14*/
-  0xe3, 0xdd, 0xcd, 0xff, 	/*Color of index 15*/
-  0xed, 0xde, 0xb2, 0xff, 	/*Color of index 16*/
-  0xf4, 0xe1, 0xa5, 0xff, 	/*Color of index 17*/
-  0xe1, 0xd7, 0xbf, 0xff, 	/*Color of index 18*/
-  0xea, 0xd9, 0xa7, 0xff, 	/*Color of index 19*/
-  0xe2, 0xd4, 0xb2, 0xff, 	/*Color of index 20*/
-  0xe9, 0xd6, 0x9b, 0xff, 	/*Color of index 21*/
-  0xe3, 0xd2, 0xa8, 0xff, 	/*Color of index 22*/
-  0xd6, 0xcc, 0xb4, 0xff, 	/*Color of index 23*/
-  0xea, 0xd2, 0x8e, 0xff, 	/*Color of index 24*/
-  0xdf, 0xcd, 0x9e, 0xff, 	/*Color of index 25*/
-  0xe2, 0xcb, 0x92, 0xff, 	/*Color of index 26*/
-  0xe6, 0xcc, 0x81, 0xff, 	/*Color of index 27*/
-  0xdc, 0xc5, 0x8d, 0xff, 	/*Color of index 28*/
-  0xe2, 0xc8, 0x7b, 0xff, 	/*Color of index 29*/
-  0xd4, 0xc1, 0x8e, 0xff, 	/*Color of index 30*/
-  0xdb, 0xc3, 0x82, 0xff, 	/*Color of index 31*/
-  0xe5, 0xc6, 0x72, 0xff, 	/*Color of index 32*/
-  0xdc, 0xc3, 0x7a, 0xff, 	/*Color of index 33*/
-  0xbf, 0xb8, 0xa7, 0xff, 	/*Color of index 34*/
-  0xe1, 0xc2, 0x74, 0xff, 	/*Color of index 35*/
-  0xdb, 0xc0, 0x74, 0xff, 	/*Color of index 36*/
-  0xd4, 0xbc, 0x83, 0xff, 	/*Color of index 37*/
-  0xd5, 0xbe, 0x7b, 0xff, 	/*Color of index 38*/
-  0xde, 0xc1, 0x6b, 0xff, 	/*Color of index 39*/
-  0xdc, 0xbb, 0x6a, 0xff, 	/*Color of index 40*/
-  0xc7, 0xb5, 0x85, 0xff, 	/*Color of index 41*/
-  0xd3, 0xb9, 0x73, 0xff, 	/*Color of index 42*/
-  0xdb, 0xba, 0x63, 0xff, 	/*Color of index 43*/
-  0xd6, 0xb8, 0x6a, 0xff, 	/*Color of index 44*/
-  0xdb, 0xba, 0x5b, 0xff, 	/*Color of index 45*/
-  0xcf, 0xb4, 0x73, 0xff, 	/*Color of index 46*/
-  0xd4, 0xb7, 0x62, 0xff, 	/*Color of index 47*/
-  0xd3, 0xb8, 0x5c, 0xff, 	/*Color of index 48*/
-  0xd2, 0xb4, 0x69, 0xff, 	/*Color of index 49*/
-  0xcc, 0xb1, 0x6b, 0xff, 	/*Color of index 50*/
-  0xc2, 0xad, 0x7a, 0xff, 	/*Color of index 51*/
-  0xd6, 0xb4, 0x5b, 0xff, 	/*Color of index 52*/
-  0xd3, 0xb2, 0x61, 0xff, 	/*Color of index 53*/
-  0xcb, 0xb1, 0x63, 0xff, 	/*Color of index 54*/
-  0xd8, 0xb4, 0x53, 0xff, 	/*Color of index 55*/
-  0xd4, 0xb1, 0x5d, 0xff, 	/*Color of index 56*/
-  0xc2, 0xac, 0x73, 0xff, 	/*Color of index 57*/
-  0xcd, 0xb1, 0x5b, 0xff, 	/*Color of index 58*/
-  0xd1, 0xb1, 0x55, 0xff, 	/*Color of index 59*/
-  0xca, 0xab, 0x61, 0xff, 	/*Color of index 60*/
-  0xc1, 0xa8, 0x6b, 0xff, 	/*Color of index 61*/
-  0xd0, 0xac, 0x53, 0xff, 	/*Color of index 62*/
-  0xcb, 0xaa, 0x59, 0xff, 	/*Color of index 63*/
-  0xc2, 0xa8, 0x62, 0xff, 	/*Color of index 64*/
-  0xcf, 0xab, 0x4e, 0xff, 	/*Color of index 65*/
-  0xbc, 0xa4, 0x6b, 0xff, 	/*Color of index 66*/
-  0xcb, 0xa9, 0x54, 0xff, 	/*Color of index 67*/
-  0xc4, 0xa6, 0x5a, 0xff, 	/*Color of index 68*/
-  0xba, 0xa1, 0x63, 0xff, 	/*Color of index 69*/
-  0xcc, 0xa6, 0x4c, 0xff, 	/*Color of index 70*/
-  0xc5, 0xa4, 0x52, 0xff, 	/*Color of index 71*/
-  0xb4, 0x9d, 0x62, 0xff, 	/*Color of index 72*/
-  0xbf, 0xa0, 0x4f, 0xff, 	/*Color of index 73*/
-  0xb3, 0x9b, 0x5c, 0xff, 	/*Color of index 74*/
-  0xb4, 0x9c, 0x45, 0xff, 	/*Color of index 75*/
-  0xf7, 0xf5, 0xf3, 0xff, 	/*Color of index 76*/
-  0xf4, 0xf2, 0xf0, 0xff, 	/*Color of index 77*/
-  0xf0, 0xec, 0xeb, 0xff, 	/*Color of index 78*/
-  0xea, 0xe8, 0xe5, 0xff, 	/*Color of index 79*/
-  0xe7, 0xe4, 0xe1, 0xff, 	/*Color of index 80*/
-  0xe2, 0xde, 0xdc, 0xff, 	/*Color of index 81*/
-  0xdc, 0xd9, 0xd6, 0xff, 	/*Color of index 82*/
-  0xd6, 0xd2, 0xd0, 0xff, 	/*Color of index 83*/
-  0xce, 0xcb, 0xc9, 0xff, 	/*Color of index 84*/
-  0xc7, 0xc3, 0xc1, 0xff, 	/*Color of index 85*/
-  0xc8, 0xc1, 0xb5, 0xff, 	/*Color of index 86*/
-  0xd1, 0xc4, 0xa6, 0xff, 	/*Color of index 87*/
-  0xe5, 0xc9, 0x89, 0xff, 	/*Color of index 88*/
-  0xd5, 0xc3, 0x99, 0xff, 	/*Color of index 89*/
-  0xbe, 0xbb, 0xb8, 0xff, 	/*Color of index 90*/
-  0xe2, 0xc3, 0x81, 0xff, 	/*Color of index 91*/
-  0xe5, 0xc4, 0x7a, 0xff, 	/*Color of index 92*/
-  0xe2, 0xc2, 0x7a, 0xff, 	/*Color of index 93*/
-  0xb7, 0xb3, 0xb2, 0xff, 	/*Color of index 94*/
-  0xcf, 0xbb, 0x8d, 0xff, 	/*Color of index 95*/
-  0xe0, 0xbd, 0x7b, 0xff, 	/*Color of index 96*/
-  0xd9, 0xbb, 0x7a, 0xff, 	/*Color of index 97*/
-  0xdc, 0xbc, 0x72, 0xff, 	/*Color of index 98*/
-  0xc1, 0xb3, 0x97, 0xff, 	/*Color of index 99*/
-  0xb0, 0xac, 0xaa, 0xff, 	/*Color of index 100*/
-  0xca, 0xb2, 0x7c, 0xff, 	/*Color of index 101*/
-  0xb3, 0xaa, 0x98, 0xff, 	/*Color of index 102*/
-  0xd9, 0xb4, 0x68, 0xff, 	/*Color of index 103*/
-  0xd9, 0xb4, 0x62, 0xff, 	/*Color of index 104*/
-  0xa7, 0xa3, 0xa1, 0xff, 	/*Color of index 105*/
-  0xbd, 0xa9, 0x84, 0xff, 	/*Color of index 106*/
-  0xd3, 0xaf, 0x62, 0xff, 	/*Color of index 107*/
-  0xc9, 0xac, 0x6a, 0xff, 	/*Color of index 108*/
-  0xac, 0xa3, 0x92, 0xff, 	/*Color of index 109*/
-  0xd1, 0xac, 0x59, 0xff, 	/*Color of index 110*/
-  0xbc, 0xa4, 0x76, 0xff, 	/*Color of index 111*/
-  0xae, 0x9f, 0x83, 0xff, 	/*Color of index 112*/
-  0x9f, 0x9a, 0x98, 0xff, 	/*Color of index 113*/
-  0xc9, 0xa4, 0x5a, 0xff, 	/*Color of index 114*/
-  0xca, 0xa5, 0x55, 0xff, 	/*Color of index 115*/
-  0xb1, 0x9e, 0x75, 0xff, 	/*Color of index 116*/
-  0x98, 0x93, 0x92, 0xff, 	/*Color of index 117*/
-  0xbe, 0x9f, 0x5a, 0xff, 	/*Color of index 118*/
-  0xb4, 0x9a, 0x69, 0xff, 	/*Color of index 119*/
-  0xa6, 0x95, 0x76, 0xff, 	/*Color of index 120*/
-  0x93, 0x8e, 0x8a, 0xff, 	/*Color of index 121*/
-  0xbc, 0x9a, 0x52, 0xff, 	/*Color of index 122*/
-  0xa9, 0x93, 0x69, 0xff, 	/*Color of index 123*/
-  0xb3, 0x95, 0x5c, 0xff, 	/*Color of index 124*/
-  0xbd, 0x99, 0x47, 0xff, 	/*Color of index 125*/
-  0xa9, 0x90, 0x5e, 0xff, 	/*Color of index 126*/
-  0x9a, 0x8b, 0x6f, 0xff, 	/*Color of index 127*/
-  0xb2, 0x91, 0x52, 0xff, 	/*Color of index 128*/
-  0xb8, 0x94, 0x45, 0xff, 	/*Color of index 129*/
-  0x89, 0x84, 0x83, 0xff, 	/*Color of index 130*/
-  0xb1, 0x8f, 0x4b, 0xff, 	/*Color of index 131*/
-  0xa2, 0x8b, 0x5c, 0xff, 	/*Color of index 132*/
-  0xb3, 0x8f, 0x41, 0xff, 	/*Color of index 133*/
-  0x8a, 0x83, 0x76, 0xff, 	/*Color of index 134*/
-  0xa3, 0x89, 0x52, 0xff, 	/*Color of index 135*/
-  0xb8, 0x8d, 0x39, 0xff, 	/*Color of index 136*/
-  0x9c, 0x84, 0x5d, 0xff, 	/*Color of index 137*/
-  0xac, 0x88, 0x43, 0xff, 	/*Color of index 138*/
-  0xb1, 0x88, 0x3b, 0xff, 	/*Color of index 139*/
-  0x7f, 0x7a, 0x79, 0xff, 	/*Color of index 140*/
-  0x9b, 0x81, 0x4f, 0xff, 	/*Color of index 141*/
-  0x8f, 0x7c, 0x5b, 0xff, 	/*Color of index 142*/
-  0x93, 0x7b, 0x4e, 0xff, 	/*Color of index 143*/
-  0x81, 0x75, 0x68, 0xff, 	/*Color of index 144*/
-  0x76, 0x72, 0x71, 0xff, 	/*Color of index 145*/
-  0x98, 0x7a, 0x43, 0xff, 	/*Color of index 146*/
-  0xa1, 0x7c, 0x35, 0xff, 	/*Color of index 147*/
-  0x8a, 0x73, 0x52, 0xff, 	/*Color of index 148*/
-  0x91, 0x73, 0x43, 0xff, 	/*Color of index 149*/
-  0x6f, 0x6b, 0x69, 0xff, 	/*Color of index 150*/
-  0x84, 0x70, 0x4b, 0xff, 	/*Color of index 151*/
-  0x98, 0x73, 0x31, 0xff, 	/*Color of index 152*/
-  0x74, 0x6a, 0x5a, 0xff, 	/*Color of index 153*/
-  0x89, 0x6e, 0x44, 0xff, 	/*Color of index 154*/
-  0x8e, 0x6f, 0x3a, 0xff, 	/*Color of index 155*/
-  0x9a, 0x71, 0x29, 0xff, 	/*Color of index 156*/
-  0x92, 0x70, 0x2c, 0xff, 	/*Color of index 157*/
-  0x91, 0x6d, 0x31, 0xff, 	/*Color of index 158*/
-  0x68, 0x63, 0x60, 0xff, 	/*Color of index 159*/
-  0x83, 0x69, 0x3e, 0xff, 	/*Color of index 160*/
-  0x7a, 0x65, 0x46, 0xff, 	/*Color of index 161*/
-  0x8d, 0x69, 0x32, 0xff, 	/*Color of index 162*/
-  0x91, 0x6a, 0x2c, 0xff, 	/*Color of index 163*/
-  0x8d, 0x6a, 0x27, 0xff, 	/*Color of index 164*/
-  0x61, 0x5c, 0x5b, 0xff, 	/*Color of index 165*/
-  0x8c, 0x64, 0x30, 0xff, 	/*Color of index 166*/
-  0x7a, 0x62, 0x3b, 0xff, 	/*Color of index 167*/
-  0x8b, 0x64, 0x2b, 0xff, 	/*Color of index 168*/
-  0x79, 0x61, 0x32, 0xff, 	/*Color of index 169*/
-  0x6d, 0x5c, 0x45, 0xff, 	/*Color of index 170*/
-  0x88, 0x63, 0x22, 0xff, 	/*Color of index 171*/
-  0x60, 0x58, 0x51, 0xff, 	/*Color of index 172*/
-  0x97, 0x61, 0x1f, 0xff, 	/*Color of index 173*/
-  0x7a, 0x5b, 0x34, 0xff, 	/*Color of index 174*/
-  0x82, 0x5c, 0x2a, 0xff, 	/*Color of index 175*/
-  0x6f, 0x59, 0x39, 0xff, 	/*Color of index 176*/
-  0x58, 0x53, 0x52, 0xff, 	/*Color of index 177*/
-  0x5f, 0x54, 0x44, 0xff, 	/*Color of index 178*/
-  0x84, 0x5a, 0x20, 0xff, 	/*Color of index 179*/
-  0x8f, 0x5a, 0x1a, 0xff, 	/*Color of index 180*/
-  0x66, 0x54, 0x3c, 0xff, 	/*Color of index 181*/
-  0x7b, 0x55, 0x31, 0xff, 	/*Color of index 182*/
-  0x73, 0x55, 0x2e, 0xff, 	/*Color of index 183*/
-  0x6a, 0x53, 0x33, 0xff, 	/*Color of index 184*/
-  0x7c, 0x53, 0x29, 0xff, 	/*Color of index 185*/
-  0x87, 0x55, 0x16, 0xff, 	/*Color of index 186*/
-  0x81, 0x52, 0x22, 0xff, 	/*Color of index 187*/
-  0x7b, 0x52, 0x23, 0xff, 	/*Color of index 188*/
-  0x75, 0x50, 0x2b, 0xff, 	/*Color of index 189*/
-  0x50, 0x4b, 0x48, 0xff, 	/*Color of index 190*/
-  0x81, 0x52, 0x1c, 0xff, 	/*Color of index 191*/
-  0x6a, 0x50, 0x2a, 0xff, 	/*Color of index 192*/
-  0x7b, 0x4e, 0x23, 0xff, 	/*Color of index 193*/
-  0x63, 0x4c, 0x2e, 0xff, 	/*Color of index 194*/
-  0x7c, 0x4f, 0x19, 0xff, 	/*Color of index 195*/
-  0x72, 0x4b, 0x24, 0xff, 	/*Color of index 196*/
-  0x57, 0x48, 0x35, 0xff, 	/*Color of index 197*/
-  0x72, 0x4d, 0x19, 0xff, 	/*Color of index 198*/
-  0x48, 0x43, 0x42, 0xff, 	/*Color of index 199*/
-  0x63, 0x47, 0x22, 0xff, 	/*Color of index 200*/
-  0x5a, 0x44, 0x2a, 0xff, 	/*Color of index 201*/
-  0x43, 0x3d, 0x3c, 0xff, 	/*Color of index 202*/
-  0x6a, 0x42, 0x18, 0xff, 	/*Color of index 203*/
-  0x58, 0x41, 0x21, 0xff, 	/*Color of index 204*/
-  0x4a, 0x3c, 0x2d, 0xff, 	/*Color of index 205*/
-  0x59, 0x3d, 0x1c, 0xff, 	/*Color of index 206*/
-  0x4d, 0x3b, 0x20, 0xff, 	/*Color of index 207*/
-  0x3c, 0x36, 0x34, 0xff, 	/*Color of index 208*/
-  0x52, 0x38, 0x1c, 0xff, 	/*Color of index 209*/
-  0x57, 0x37, 0x0f, 0xff, 	/*Color of index 210*/
-  0x35, 0x31, 0x2e, 0xff, 	/*Color of index 211*/
-  0x48, 0x33, 0x1c, 0xff, 	/*Color of index 212*/
-  0x47, 0x31, 0x14, 0xff, 	/*Color of index 213*/
-  0x32, 0x2a, 0x27, 0xff, 	/*Color of index 214*/
-  0x44, 0x2b, 0x13, 0xff, 	/*Color of index 215*/
-  0x4e, 0x2c, 0x0a, 0xff, 	/*Color of index 216*/
-  0x2a, 0x25, 0x23, 0xff, 	/*Color of index 217*/
-  0x3b, 0x28, 0x12, 0xff, 	/*Color of index 218*/
-  0x45, 0x26, 0x07, 0xff, 	/*Color of index 219*/
-  0x35, 0x23, 0x14, 0xff, 	/*Color of index 220*/
-  0x27, 0x1f, 0x1c, 0xff, 	/*Color of index 221*/
-  0x37, 0x22, 0x0b, 0xff, 	/*Color of index 222*/
-  0x22, 0x1c, 0x1b, 0xff, 	/*Color of index 223*/
-  0x39, 0x21, 0x01, 0xff, 	/*Color of index 224*/
-  0x34, 0x1b, 0x08, 0xff, 	/*Color of index 225*/
-  0x1c, 0x18, 0x16, 0xff, 	/*Color of index 226*/
-  0x28, 0x19, 0x07, 0xff, 	/*Color of index 227*/
-  0x19, 0x13, 0x12, 0xff, 	/*Color of index 228*/
-  0x25, 0x14, 0x09, 0xff, 	/*Color of index 229*/
-  0x24, 0x13, 0x02, 0xff, 	/*Color of index 230*/
-  0x2c, 0x11, 0x01, 0xff, 	/*Color of index 231*/
-  0x15, 0x0f, 0x0c, 0xff, 	/*Color of index 232*/
-  0x1d, 0x0f, 0x02, 0xff, 	/*Color of index 233*/
-  0x13, 0x0e, 0x03, 0xff, 	/*Color of index 234*/
-  0x21, 0x0b, 0x00, 0xff, 	/*Color of index 235*/
-  0x17, 0x0b, 0x02, 0xff, 	/*Color of index 236*/
-  0x13, 0x0a, 0x05, 0xff, 	/*Color of index 237*/
-  0x0e, 0x08, 0x05, 0xff, 	/*Color of index 238*/
-  0x08, 0x06, 0x04, 0xff, 	/*Color of index 239*/
-  0x10, 0x05, 0x03, 0xff, 	/*Color of index 240*/
-  0x18, 0x05, 0x00, 0xff, 	/*Color of index 241*/
-  0x17, 0x0d, 0x0d, 0xff, 	/*Color of index 242*/
-  0x15, 0x0a, 0x0a, 0xff, 	/*Color of index 243*/
-  0x13, 0x09, 0x09, 0xff, 	/*Color of index 244*/
-  0x0f, 0x09, 0x09, 0xff, 	/*Color of index 245*/
-  0x12, 0x06, 0x08, 0xff, 	/*Color of index 246*/
-  0x16, 0x04, 0x0b, 0xff, 	/*Color of index 247*/
-  0x0c, 0x02, 0x01, 0xff, 	/*Color of index 248*/
-  0x02, 0x00, 0x00, 0xff, 	/*Color of index 249*/
-  0xf9, 0xf6, 0xf9, 0xff, 	/*Color of index 250*/
-  0x12, 0x08, 0x0f, 0xff, 	/*Color of index 251*/
-  0x12, 0x05, 0x10, 0xff, 	/*Color of index 252*/
-  0x0c, 0x05, 0x0a, 0xff, 	/*Color of index 253*/
-  0x0c, 0x09, 0x0f, 0xff, 	/*Color of index 254*/
-  0x08, 0x06, 0x0b, 0xff, 	/*Color of index 255*/
-
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xee, 0xf6, 0xf0, 0xf6, 0xf0, 0xf6, 0xee, 0xf6, 0xf5, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xf2, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf0, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf8, 0xf0, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf6, 0xf3, 0xf3, 0xf5, 0xf4, 0xf3, 0xf5, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf2, 0xf2, 0xef, 0xf3, 0xf4, 0xf2, 0xf6, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xe8, 0xd9, 0xca, 0xa5, 0x8c, 0x82, 0x75, 0x71, 0x69, 0x64, 0x69, 0x69, 0x71, 0x75, 0x79, 0x8c, 0xa5, 0xc7, 0xd6, 0xe4, 0xf8, 0xf9, 0xf9, 0xf9, 0xf5, 0xf6, 0xe8, 0xf2, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf6, 0xf4, 0xf4, 0xf3, 0xee, 0xf9, 0xf9, 0xf5, 0xd9, 0xb1, 0x8c, 0x69, 0x54, 0x50, 0xfa, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x50, 0x55, 0x75, 0x9f, 0xd0, 0xe4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf5, 0xf4, 0xf6, 0xf0, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf0, 0xf9, 0xf9, 0xf2, 0xb1, 0x82, 0x54, 0x4e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x4c, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4d, 0x53, 0x69, 0xbe, 0xe2, 0xf9, 0xf9, 0xf8, 0xf3, 0xf3, 0xf0, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf9, 0xf9, 0xdf, 0x96, 0x55, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0x04, 0x04, 0x4d, 0x00, 0x01, 0x02, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x5a, 0x9f, 0xdd, 0xf9, 0xf9, 0xf2, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xfe, 0xfe, 0xf3, 0xf4, 0xf3, 0xf6, 0xf2, 0xf2, 0xf6, 0xe8, 0xed, 0xf5, 0xf9, 0xf9, 0xd9, 0x71, 0x50, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x02, 0x00, 0x00, 0x00, 0x04, 0x02, 0x02, 0x04, 0x04, 0x04, 0x00, 0xfa, 0x01, 0x01, 0x01, 0x4f, 0x79, 0xd6, 0xf9, 0xf9, 0xf0, 0xf5, 0xf3, 0xf5, 0xf4, 0xf6, 0xf6, 0xf3, 0xf4, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xfe, 0xfe, 0xf4, 0xf3, 0xf1, 0xf2, 0xf0, 0xf2, 0xfb, 0xed, 0xf9, 0xef, 0xbe, 0x54, 0x01, 0x01, 0x01, 0x02, 0x4c, 0x00, 0x00, 0x02, 0x03, 0x02, 0x03, 0x01, 0x03, 0x03, 0x05, 0x05, 0x06, 0x08, 0x08, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x04, 0x00, 0x04, 0x04, 0x04, 0x02, 0x04, 0xfa, 0x01, 0x01, 0x5a, 0xbe, 0xf9, 0xf9, 0xf5, 0xfd, 0xf4, 0xf3, 0xe8, 0xf4, 0xf0, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xfe, 0xfb, 0xf3, 0xf4, 0xed, 0xf3, 0xf6, 0xf6, 0xf9, 0xf8, 0xc7, 0x55, 0x01, 0x01, 0x00, 0x00, 0x4c, 0x01, 0x01, 0x03, 0x03, 0x05, 0x08, 0x0b, 0x0e, 0x13, 0x59, 0x29, 0x65, 0x65, 0x39, 0x39, 0x3d, 0x3d, 0x42, 0x3d, 0x39, 0x39, 0x33, 0x65, 0x5f, 0x59, 0x16, 0x0b, 0x08, 0x05, 0x05, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x04, 0x00, 0x01, 0x01, 0x5e, 0xd0, 0xf9, 0xf9, 0xf4, 0xf4, 0xf6, 0xf3, 0xe8, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf0, 0xf5, 0xf9, 0xd0, 0x5e, 0x01, 0x01, 0xfa, 0xfa, 0x04, 0x01, 0x00, 0x01, 0x03, 0x0c, 0x15, 0x1f, 0x39, 0x3d, 0x76, 0x45, 0x3c, 0x3c, 0x3a, 0x6e, 0x3a, 0x38, 0x36, 0x35, 0x35, 0x35, 0x3a, 0x6e, 0x36, 0x3f, 0x40, 0x3c, 0x40, 0x45, 0x42, 0x2e, 0x1c, 0x14, 0x0a, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x02, 0x00, 0x04, 0xfa, 0x4c, 0xfa, 0x00, 0x00, 0x01, 0x01, 0x75, 0xdd, 0xf9, 0xf8, 0xf2, 0xef, 0xf4, 0xf4, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xed, 0xf4, 0xed, 0xf2, 0xf9, 0xe4, 0x82, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0x03, 0x08, 0x14, 0x5f, 0x6c, 0x40, 0x42, 0x6c, 0x6c, 0x68, 0x38, 0x37, 0x3a, 0x37, 0x34, 0x37, 0x34, 0x37, 0x37, 0x3b, 0x37, 0x37, 0x34, 0x3b, 0x34, 0x34, 0x34, 0x38, 0x6b, 0x38, 0x3c, 0x6b, 0x40, 0x6c, 0x65, 0x15, 0x0b, 0x05, 0x02, 0x00, 0xfa, 0xfa, 0x00, 0x00, 0x01, 0x00, 0xfa, 0xfa, 0x00, 0x01, 0x01, 0x4e, 0x8c, 0xf5, 0xf9, 0xf3, 0xf5, 0xf5, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf5, 0xf3, 0xed, 0xf3, 0xee, 0xf4, 0xf9, 0xd9, 0x52, 0x01, 0x01, 0x00, 0x01, 0x02, 0x02, 0x03, 0x08, 0x1a, 0x33, 0x40, 0x40, 0x35, 0x45, 0x45, 0x3d, 0x40, 0x38, 0x3b, 0x2d, 0x37, 0x34, 0x3b, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x34, 0x37, 0x34, 0x3b, 0x34, 0x38, 0x38, 0x38, 0x34, 0x3b, 0x3e, 0x44, 0x40, 0x5f, 0x0e, 0x02, 0x01, 0xfa, 0x00, 0x02, 0x01, 0x04, 0x00, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x5a, 0xd3, 0xf9, 0xf3, 0xf5, 0xf3, 0xf6, 0xf2, 0xf0, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf4, 0xf4, 0xf4, 0xf6, 0xe8, 0xf0, 0xef, 0xf9, 0x82, 0x00, 0x01, 0x02, 0x4c, 0x02, 0x01, 0x03, 0x0b, 0x1c, 0x3d, 0x3c, 0x34, 0x2d, 0x3a, 0x2e, 0x13, 0x0b, 0x08, 0x10, 0x2c, 0x34, 0x3b, 0x2b, 0x38, 0x6b, 0x6b, 0x38, 0x6b, 0x38, 0x6b, 0x6b, 0x6b, 0x38, 0x38, 0x34, 0x3a, 0x34, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x35, 0x38, 0x38, 0x6b, 0x40, 0x76, 0x65, 0x13, 0x06, 0x03, 0x03, 0x02, 0x04, 0x01, 0x00, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x01, 0x9f, 0xf9, 0xf8, 0xf6, 0xe8, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf9, 0xfe, 0x75, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x06, 0x19, 0x33, 0x6c, 0x36, 0x34, 0x34, 0x37, 0x68, 0x11, 0x03, 0x03, 0x02, 0x05, 0x0c, 0x3a, 0x30, 0x34, 0x6b, 0x35, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x38, 0x35, 0x38, 0x35, 0x3a, 0x35, 0x3a, 0x35, 0x3a, 0x67, 0x6c, 0x6b, 0x6b, 0x68, 0x38, 0x2f, 0x40, 0x49, 0x1f, 0x0b, 0x03, 0x03, 0x02, 0x4c, 0x02, 0x00, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x00, 0x75, 0xf9, 0xef, 0xf0, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf5, 0xf9, 0xe2, 0x55, 0x01, 0x01, 0x4c, 0x01, 0x03, 0x03, 0x16, 0x2e, 0x40, 0x32, 0x35, 0x68, 0x68, 0x68, 0x38, 0x2e, 0x06, 0x02, 0x00, 0x01, 0x02, 0x0c, 0x44, 0x68, 0x6b, 0x35, 0x38, 0x68, 0x38, 0x35, 0x34, 0x38, 0x35, 0x34, 0x35, 0x6b, 0x6b, 0x38, 0x6b, 0x38, 0x35, 0x38, 0x38, 0x38, 0x6b, 0x6b, 0x6b, 0x68, 0x34, 0x68, 0x6e, 0x3a, 0x40, 0x4a, 0x77, 0x59, 0x08, 0x02, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x4d, 0x04, 0x01, 0x01, 0x5a, 0xe4, 0xf9, 0xf2, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf6, 0xf3, 0xf4, 0xf9, 0xe4, 0x54, 0x01, 0x00, 0x4c, 0x02, 0x03, 0x07, 0x63, 0x6c, 0x3f, 0x6c, 0x3c, 0x2a, 0x67, 0x3c, 0x6b, 0x32, 0x6c, 0x0e, 0x01, 0x01, 0x02, 0x03, 0x1e, 0x36, 0x3a, 0x6b, 0x38, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x38, 0x6b, 0x6b, 0x35, 0x38, 0x6b, 0x34, 0x38, 0x38, 0x34, 0x3a, 0x34, 0x34, 0x34, 0x38, 0x6b, 0x18, 0x0e, 0x10, 0x29, 0x78, 0x63, 0x0a, 0x02, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x04, 0x01, 0x55, 0xe4, 0xf8, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xfb, 0xf3, 0xf6, 0xf3, 0xf1, 0xf4, 0xf0, 0xf0, 0xdf, 0x53, 0x01, 0x00, 0x01, 0x02, 0x05, 0x10, 0x6c, 0x3c, 0x3b, 0x3f, 0x5f, 0x4e, 0x01, 0x03, 0x13, 0x36, 0x38, 0x6b, 0x33, 0x10, 0x09, 0x0c, 0x58, 0x3c, 0x6b, 0x6b, 0x6b, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35, 0x34, 0x38, 0x38, 0x6b, 0x38, 0x38, 0x34, 0x3c, 0x15, 0x03, 0x03, 0x01, 0x05, 0x59, 0x42, 0x6f, 0x10, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x04, 0xfa, 0x02, 0x04, 0x01, 0x53, 0xe2, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfe, 0xf4, 0xfb, 0xf3, 0xf3, 0xf6, 0xf6, 0xf8, 0xe2, 0x52, 0x01, 0x01, 0x01, 0x01, 0x06, 0x19, 0x72, 0x3f, 0x6e, 0x46, 0x1d, 0x03, 0x01, 0x00, 0x01, 0x06, 0x26, 0x6e, 0x6b, 0x40, 0x40, 0x6c, 0x3c, 0x40, 0x67, 0x6b, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x38, 0x34, 0x35, 0x34, 0x38, 0x35, 0x38, 0x35, 0x38, 0x38, 0x34, 0x3a, 0x32, 0x0c, 0x05, 0x02, 0x01, 0x03, 0x06, 0x33, 0x6c, 0x42, 0x59, 0x03, 0x02, 0x00, 0x00, 0x00, 0xfa, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x5a, 0xf3, 0xf6, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xfb, 0xf3, 0xf6, 0xf9, 0xf2, 0x5e, 0x01, 0xfa, 0x01, 0x01, 0x06, 0x33, 0x40, 0x3a, 0x37, 0x37, 0x6e, 0x11, 0x02, 0x00, 0x01, 0x03, 0x06, 0x1f, 0x3c, 0x35, 0x36, 0x36, 0x3f, 0x3a, 0x2f, 0x34, 0x34, 0x34, 0x34, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x34, 0x38, 0x38, 0x34, 0x34, 0x34, 0x34, 0x36, 0x40, 0x0b, 0x02, 0xfa, 0xfa, 0x02, 0x05, 0x6c, 0x2b, 0x30, 0x3f, 0x1e, 0x05, 0x01, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x01, 0x64, 0xf9, 0xf5, 0xf2, 0xee, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xfd, 0xf9, 0x55, 0x01, 0xfa, 0xfa, 0x01, 0x0e, 0x29, 0x40, 0x68, 0x3b, 0x37, 0x37, 0x44, 0x10, 0x03, 0x02, 0x01, 0x03, 0x09, 0x6c, 0x36, 0x6b, 0x3b, 0x3b, 0x30, 0x3e, 0x34, 0x34, 0x34, 0x37, 0x34, 0x3a, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x35, 0x38, 0x35, 0x3a, 0x30, 0x3a, 0x30, 0x36, 0x3d, 0x1c, 0x05, 0x02, 0x01, 0x03, 0x10, 0x6c, 0x2d, 0x37, 0x37, 0x40, 0x29, 0x0a, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x04, 0x4c, 0x01, 0x82, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xec, 0xf6, 0xf3, 0xfb, 0xfd, 0xf9, 0x82, 0x01, 0x00, 0x02, 0x01, 0x0b, 0x65, 0x6e, 0x35, 0x3b, 0x35, 0x3b, 0x3e, 0x40, 0x25, 0x05, 0x02, 0x03, 0x05, 0x25, 0x3c, 0x68, 0x34, 0x34, 0x6e, 0x34, 0x3b, 0x38, 0x3a, 0x34, 0x35, 0x3a, 0x38, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38, 0x30, 0x38, 0x36, 0x36, 0x45, 0x1e, 0x10, 0x0b, 0x16, 0x39, 0x67, 0x2d, 0x37, 0x2b, 0x32, 0x3d, 0x65, 0x06, 0x03, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x4d, 0xb1, 0xf9, 0xf5, 0xf3, 0xf6, 0xf5, 0xf2, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf4, 0xec, 0xed, 0xf4, 0xf3, 0xf9, 0x9f, 0x01, 0x00, 0x02, 0x03, 0x09, 0x32, 0x6e, 0x2d, 0x68, 0x44, 0x65, 0x25, 0x65, 0x45, 0x40, 0x65, 0x1a, 0x1c, 0x2e, 0x3c, 0x35, 0x37, 0x38, 0x38, 0x38, 0x38, 0x6b, 0x38, 0x38, 0x6b, 0x6b, 0x6b, 0x38, 0x38, 0x38, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x6b, 0x6b, 0x6b, 0x34, 0x38, 0x35, 0x3a, 0x40, 0x44, 0x3a, 0x36, 0x2c, 0x40, 0x65, 0x39, 0x6f, 0x6c, 0x36, 0x2a, 0x08, 0x03, 0x03, 0x00, 0xfa, 0x00, 0xfa, 0x04, 0x04, 0x4c, 0x01, 0x04, 0xdd, 0xf9, 0xf5, 0xf3, 0xf2, 0xf0, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xed, 0xf3, 0xf8, 0xdd, 0x4f, 0x01, 0x02, 0x02, 0x08, 0x26, 0x3f, 0x2d, 0x37, 0x3f, 0x25, 0x08, 0x05, 0x05, 0x18, 0x32, 0x36, 0x40, 0x36, 0x3c, 0x35, 0x68, 0x3e, 0x34, 0x6b, 0x38, 0x6b, 0x38, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x38, 0x35, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x35, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x6b, 0x6b, 0x6b, 0x6b, 0x38, 0x34, 0x34, 0x34, 0x37, 0x30, 0x3a, 0x30, 0x6b, 0x19, 0x0b, 0x0a, 0x16, 0x3d, 0x30, 0x3a, 0x5f, 0x05, 0x03, 0x04, 0xfa, 0xfa, 0x00, 0x00, 0x04, 0x04, 0x00, 0x01, 0x5a, 0xf8, 0xef, 0xf5, 0xf0, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xec, 0xf3, 0xed, 0xf8, 0x5e, 0x01, 0x02, 0x03, 0x03, 0x29, 0x36, 0x2b, 0x2d, 0x37, 0x1c, 0x06, 0x01, 0x02, 0x02, 0x06, 0x36, 0x31, 0x34, 0x35, 0x34, 0x6e, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x6b, 0x34, 0x38, 0x34, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x38, 0x6b, 0x6b, 0x38, 0x38, 0x38, 0x34, 0x37, 0x2d, 0x37, 0x2d, 0x3c, 0x1f, 0x06, 0x02, 0x02, 0x03, 0x10, 0x36, 0x2f, 0x42, 0x19, 0x05, 0x02, 0xfa, 0x00, 0xfa, 0x00, 0x04, 0x04, 0x04, 0x01, 0x01, 0x82, 0xf9, 0xe8, 0xf6, 0xe4, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xec, 0xf9, 0xa5, 0x01, 0x01, 0x03, 0x03, 0x17, 0x6f, 0x31, 0x37, 0x37, 0x6e, 0x15, 0x02, 0x00, 0x01, 0x01, 0x0c, 0x32, 0x2f, 0x3a, 0x3b, 0x68, 0x35, 0x35, 0x6b, 0x3a, 0x3a, 0x3a, 0x34, 0x3b, 0x3a, 0x34, 0x37, 0x34, 0x37, 0x38, 0x38, 0x35, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x38, 0x38, 0x34, 0x35, 0x35, 0x6b, 0x6b, 0x6b, 0x35, 0x38, 0x68, 0x6b, 0x3c, 0x19, 0x03, 0x03, 0x02, 0x03, 0x06, 0x2e, 0x31, 0x32, 0x39, 0x0e, 0x02, 0xfa, 0xfa, 0xfa, 0x00, 0xfa, 0x01, 0x4d, 0x4c, 0x01, 0x04, 0xd0, 0xf9, 0xee, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf0, 0xe2, 0x51, 0x01, 0xfa, 0x02, 0x0c, 0x65, 0x39, 0x6f, 0x32, 0x34, 0x2d, 0x65, 0x0b, 0x03, 0x01, 0x06, 0x25, 0x36, 0x6b, 0x34, 0x68, 0x3b, 0x6b, 0x6e, 0x6b, 0x35, 0x3a, 0x3a, 0x3a, 0x34, 0x38, 0x34, 0x34, 0x34, 0x34, 0x38, 0x38, 0x38, 0x34, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x3a, 0x35, 0x36, 0x35, 0x38, 0x35, 0x68, 0x68, 0x6b, 0x6c, 0x5f, 0x05, 0x03, 0x02, 0x03, 0x05, 0x25, 0x32, 0x31, 0x32, 0x65, 0x05, 0x02, 0x00, 0x00, 0xfa, 0x02, 0x4c, 0x00, 0x02, 0x00, 0x01, 0x55, 0xf8, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xfb, 0xf7, 0xf9, 0x78, 0x01, 0xfa, 0x00, 0x05, 0x21, 0x3a, 0x3d, 0x12, 0x0c, 0x2f, 0x30, 0x6b, 0x2e, 0x11, 0x13, 0x2a, 0x36, 0x35, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x68, 0x38, 0x35, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x35, 0x35, 0x6b, 0x35, 0x38, 0x35, 0x34, 0x30, 0x34, 0x30, 0x35, 0x31, 0x39, 0x10, 0x03, 0x03, 0x05, 0x10, 0x3d, 0x2c, 0x2f, 0x2c, 0x6c, 0x10, 0x03, 0x02, 0x00, 0x4c, 0x02, 0x04, 0x02, 0x00, 0x02, 0x00, 0x01, 0x9f, 0xf9, 0xee, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf8, 0xe4, 0x04, 0x01, 0x00, 0x01, 0x0e, 0x36, 0x3d, 0x19, 0x03, 0x15, 0x2f, 0x27, 0x2b, 0x3d, 0x6c, 0x6c, 0x36, 0x2f, 0x35, 0x35, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x6b, 0x6b, 0x38, 0x38, 0x35, 0x34, 0x34, 0x30, 0x34, 0x30, 0x2d, 0x36, 0x2e, 0x13, 0x0c, 0x15, 0x26, 0x2c, 0x2f, 0x2f, 0x31, 0x32, 0x29, 0x05, 0x02, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x04, 0x00, 0x04, 0x01, 0x53, 0xf2, 0xf9, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf8, 0x79, 0x01, 0x00, 0x02, 0x05, 0x39, 0x2e, 0x33, 0x03, 0x06, 0x25, 0x30, 0x30, 0x30, 0x67, 0x67, 0x2c, 0x2f, 0x34, 0x68, 0x34, 0x34, 0x35, 0x3a, 0x3a, 0x38, 0x3a, 0x3a, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35, 0x38, 0x35, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x35, 0x38, 0x35, 0x34, 0x35, 0x3a, 0x30, 0x68, 0x30, 0x2d, 0x37, 0x2b, 0x36, 0x3c, 0x36, 0x3c, 0x2f, 0x2f, 0x2f, 0x2b, 0x2f, 0x31, 0x3d, 0x14, 0x01, 0x4c, 0x01, 0x4c, 0x00, 0x02, 0x00, 0x02, 0x04, 0x04, 0x01, 0x82, 0xf9, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf0, 0xdf, 0x50, 0x01, 0x00, 0x02, 0x13, 0x36, 0x39, 0x0e, 0x02, 0x19, 0x6c, 0x2f, 0x2d, 0x2b, 0x2b, 0x35, 0x2f, 0x2d, 0x30, 0x37, 0x30, 0x38, 0x34, 0x3a, 0x38, 0x3a, 0x3a, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x38, 0x34, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x34, 0x3a, 0x34, 0x35, 0x30, 0x35, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x62, 0x67, 0x67, 0x2c, 0x2f, 0x2b, 0x35, 0x2e, 0x29, 0x03, 0x04, 0x01, 0xfa, 0x00, 0x04, 0x04, 0x02, 0xfa, 0x02, 0x01, 0x51, 0xf3, 0xf9, 0xf3, 0xf5, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xee, 0xf3, 0xf0, 0xf2, 0xf9, 0x82, 0x01, 0x00, 0x02, 0x08, 0x2e, 0x36, 0x1e, 0x03, 0x0e, 0x65, 0x2e, 0x2c, 0x2d, 0x2d, 0x34, 0x2b, 0x30, 0x30, 0x37, 0x2d, 0x34, 0x34, 0x38, 0x3a, 0x3a, 0x34, 0x34, 0x3b, 0x38, 0x3a, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x38, 0x35, 0x3a, 0x35, 0x3a, 0x35, 0x3a, 0x35, 0x2f, 0x35, 0x34, 0x68, 0x6b, 0x68, 0x68, 0x67, 0x67, 0x68, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x32, 0x39, 0x0d, 0x02, 0x01, 0x4d, 0x01, 0x04, 0x00, 0x04, 0x04, 0x4c, 0xfa, 0x01, 0x96, 0xf9, 0xf4, 0xf4, 0xf5, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xf6, 0xf4, 0xf9, 0x07, 0x01, 0xfa, 0x01, 0x15, 0x36, 0x3f, 0x0c, 0x06, 0x5f, 0x2e, 0x31, 0x2f, 0x2b, 0x30, 0x2b, 0x68, 0x2b, 0x67, 0x2f, 0x35, 0x67, 0x2c, 0x32, 0x2c, 0x32, 0x6e, 0x35, 0x38, 0x68, 0x38, 0x38, 0x38, 0x6e, 0x35, 0x38, 0x38, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x34, 0x34, 0x35, 0x34, 0x35, 0x34, 0x38, 0x35, 0x35, 0x2f, 0x30, 0x2d, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x30, 0x2b, 0x31, 0x2b, 0x2b, 0x67, 0x3d, 0x57, 0x05, 0x01, 0x4c, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x53, 0xf5, 0xf6, 0xf0, 0xe4, 0xf0, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf6, 0xf2, 0xf9, 0xb1, 0x01, 0x00, 0x01, 0x05, 0x2e, 0x3a, 0x2e, 0x06, 0x13, 0x39, 0x2c, 0x2c, 0x67, 0x2b, 0x2b, 0x2f, 0x35, 0x32, 0x2e, 0x2e, 0x7c, 0x8f, 0x9b, 0x95, 0x8f, 0x4a, 0x2e, 0x6c, 0x67, 0x38, 0x38, 0x38, 0x38, 0x34, 0x38, 0x34, 0x35, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x38, 0x34, 0x34, 0x34, 0x38, 0x3a, 0x35, 0x2f, 0x38, 0x2f, 0x30, 0x27, 0x2b, 0x36, 0x40, 0x3c, 0x2c, 0x27, 0x2b, 0x2f, 0x31, 0x68, 0x34, 0x2b, 0x32, 0x65, 0x08, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x4c, 0x01, 0xb1, 0xf9, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf0, 0xf6, 0xf4, 0x55, 0x01, 0x01, 0x01, 0x0e, 0x36, 0x6c, 0x60, 0x0b, 0x2a, 0x2b, 0x2b, 0x2f, 0x67, 0x2c, 0x68, 0x31, 0x62, 0x32, 0x8d, 0x97, 0x78, 0x57, 0x12, 0x17, 0x63, 0x8e, 0xae, 0x84, 0x6c, 0x6b, 0x34, 0x38, 0x6e, 0x38, 0x35, 0x38, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x38, 0x34, 0x3a, 0x34, 0x35, 0x34, 0x35, 0x35, 0x68, 0x28, 0x45, 0x8d, 0x8d, 0x78, 0x7b, 0x78, 0x8d, 0x8d, 0x48, 0x32, 0x2a, 0x67, 0x34, 0x2b, 0x67, 0x33, 0x12, 0x03, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfa, 0x04, 0x01, 0x53, 0xf9, 0xf4, 0xf3, 0xe4, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf3, 0xf9, 0xc7, 0x00, 0x01, 0x00, 0x02, 0x13, 0x3f, 0x67, 0x65, 0x65, 0x27, 0x2d, 0x2b, 0x2b, 0x67, 0x2c, 0x2f, 0x62, 0x3d, 0xa9, 0x6f, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0a, 0x78, 0xa9, 0x6b, 0x2f, 0x68, 0x38, 0x38, 0x38, 0x34, 0x38, 0x34, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x38, 0x34, 0x34, 0x30, 0x38, 0x34, 0x35, 0x3a, 0x28, 0x36, 0xb3, 0x8d, 0x56, 0x05, 0x01, 0x01, 0x01, 0x4c, 0x0f, 0x70, 0x97, 0x3d, 0x62, 0x38, 0x2d, 0x2c, 0x3d, 0x19, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x4c, 0x04, 0x04, 0xfa, 0x01, 0xdd, 0xf9, 0xf3, 0xf6, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf9, 0x64, 0x01, 0x00, 0x01, 0x05, 0x26, 0x36, 0x2b, 0x67, 0x67, 0x2f, 0x2f, 0x2c, 0x68, 0x2b, 0x68, 0x2a, 0x33, 0xa7, 0x12, 0x01, 0x01, 0x50, 0x5a, 0x5e, 0x51, 0x01, 0x01, 0x01, 0x01, 0x0f, 0xa9, 0x33, 0x3c, 0x68, 0x38, 0x68, 0x6b, 0x35, 0x38, 0x35, 0x34, 0x35, 0x38, 0x35, 0x34, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x34, 0x3a, 0x34, 0x6b, 0x38, 0x6b, 0x2a, 0x77, 0xb8, 0x54, 0x01, 0x01, 0x4f, 0x54, 0x52, 0x4d, 0x01, 0x01, 0x01, 0x07, 0x8e, 0x74, 0x2e, 0x67, 0x68, 0x2c, 0x65, 0x08, 0x01, 0xfa, 0x04, 0xfa, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01, 0x71, 0xf9, 0xf2, 0xf5, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xef, 0xdd, 0x4c, 0x01, 0x00, 0x03, 0x08, 0x2e, 0x2f, 0x2f, 0x2b, 0x2f, 0x2f, 0x2c, 0x2f, 0x68, 0x2b, 0x67, 0x61, 0xa0, 0x12, 0x01, 0x07, 0xa5, 0xdf, 0xf9, 0xf9, 0xe8, 0xa5, 0x01, 0x01, 0x00, 0x01, 0x17, 0x9a, 0x61, 0x38, 0x68, 0x35, 0x38, 0x6b, 0x38, 0x3a, 0x35, 0x34, 0x35, 0x3a, 0x35, 0x34, 0x35, 0x34, 0x35, 0x38, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x38, 0x3a, 0x30, 0x38, 0x38, 0x6b, 0x36, 0x2a, 0xb8, 0x12, 0x01, 0x52, 0xb1, 0xe2, 0xef, 0xfe, 0xdd, 0x71, 0x01, 0x01, 0x02, 0x05, 0x89, 0x33, 0x67, 0x68, 0x2b, 0x39, 0x0e, 0x02, 0x00, 0xfa, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x4f, 0xdd, 0xf9, 0xf2, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf9, 0x82, 0x01, 0x01, 0x00, 0x01, 0x0c, 0x3d, 0x2b, 0x2b, 0x2f, 0x2c, 0x2f, 0x2b, 0x36, 0x28, 0x34, 0x62, 0x80, 0x74, 0x01, 0x50, 0xd9, 0xf9, 0xf9, 0xf4, 0xf5, 0xf9, 0xf9, 0xbe, 0x4f, 0x01, 0x01, 0x01, 0x6f, 0x77, 0x6b, 0x35, 0x35, 0x35, 0x38, 0x38, 0x38, 0x34, 0x35, 0x34, 0x35, 0x34, 0x35, 0x34, 0x35, 0x34, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x3a, 0x34, 0x38, 0x38, 0x2e, 0xa9, 0x17, 0x01, 0x75, 0xf9, 0xf9, 0xfe, 0xee, 0xef, 0xf9, 0xf9, 0xd3, 0x50, 0x01, 0x02, 0x0d, 0x8d, 0x60, 0x67, 0x28, 0x6c, 0x19, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x79, 0xf9, 0xf2, 0xf5, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf0, 0xe2, 0x51, 0x01, 0x00, 0x02, 0x02, 0x13, 0x6c, 0x28, 0x2f, 0x2b, 0x2f, 0x2b, 0x2f, 0x2f, 0x28, 0x68, 0x2a, 0x8f, 0x0a, 0x01, 0x9f, 0xf9, 0xf8, 0xf4, 0xee, 0xef, 0xf5, 0xf5, 0xf9, 0xd9, 0xb1, 0x5e, 0x01, 0x12, 0x8d, 0x62, 0x35, 0x35, 0x35, 0x38, 0x38, 0x34, 0x35, 0x34, 0x35, 0x34, 0x35, 0x34, 0x35, 0x34, 0x35, 0x38, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x38, 0x38, 0x3a, 0x34, 0x34, 0x38, 0x35, 0x45, 0x8f, 0x01, 0x5a, 0xf9, 0xf9, 0xf5, 0xef, 0xf5, 0xef, 0xf5, 0xf8, 0xf9, 0xdd, 0x54, 0x01, 0x03, 0x6a, 0x6c, 0x67, 0x28, 0x39, 0x29, 0x05, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfa, 0x01, 0x4f, 0xe8, 0xf9, 0xf2, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xf3, 0xf3, 0xf5, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf9, 0x8c, 0x01, 0x01, 0x04, 0x02, 0x05, 0x59, 0x6b, 0x28, 0x2b, 0x2b, 0x2f, 0x2b, 0x2f, 0x2f, 0x2b, 0x28, 0x45, 0x77, 0x01, 0x5e, 0xf9, 0xff, 0xf6, 0xf5, 0xf0, 0xf6, 0xee, 0xef, 0xf3, 0xf9, 0xf9, 0xf8, 0x54, 0x03, 0x8f, 0x61, 0x31, 0x35, 0x35, 0x38, 0x38, 0x38, 0x35, 0x3a, 0x35, 0x38, 0x34, 0x35, 0x34, 0x35, 0x34, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x34, 0x34, 0x67, 0x8d, 0x6a, 0x01, 0xd6, 0xf9, 0xfe, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf5, 0xf9, 0xdf, 0x50, 0x01, 0x12, 0x7e, 0x62, 0x2f, 0x2a, 0x6f, 0x0b, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x01, 0x8c, 0xf9, 0xf5, 0xf5, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf2, 0xf5, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf6, 0xee, 0xe2, 0x51, 0x01, 0x00, 0x02, 0x02, 0x06, 0x65, 0x6b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x30, 0x2b, 0x2b, 0x36, 0x7c, 0x63, 0x01, 0xb1, 0xf9, 0xfd, 0xf0, 0xf6, 0xf0, 0xfd, 0xf0, 0xfd, 0xee, 0xee, 0xee, 0xf9, 0x9f, 0x02, 0x89, 0x2a, 0x31, 0x35, 0x35, 0x38, 0x38, 0x38, 0x35, 0x34, 0x35, 0x34, 0x35, 0x34, 0x35, 0x34, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x34, 0x38, 0x35, 0x6b, 0x34, 0x34, 0x2c, 0x92, 0x12, 0x5e, 0xf9, 0xfe, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf6, 0xf5, 0xee, 0xef, 0xf9, 0x8c, 0x01, 0x0a, 0x7c, 0x2a, 0x28, 0x2c, 0x39, 0x16, 0x03, 0x02, 0x02, 0x04, 0x04, 0x04, 0x00, 0xfa, 0xfa, 0x00, 0xfa, 0x01, 0x50, 0xd9, 0xf8, 0xf5, 0xe8, 0xf3, 0xf4, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf4, 0xef, 0xe4, 0xf9, 0x8c, 0x01, 0x04, 0x04, 0x02, 0x03, 0x09, 0x3d, 0x2c, 0x68, 0x2d, 0x2f, 0x2b, 0x30, 0x30, 0x2b, 0x2f, 0x2a, 0x87, 0x17, 0x01, 0xd9, 0xf9, 0xfd, 0xf6, 0xf0, 0xf6, 0xf0, 0xf0, 0xf6, 0xee, 0xee, 0xee, 0xf9, 0xe2, 0x02, 0x7b, 0x32, 0x35, 0x2f, 0x35, 0x35, 0x38, 0x38, 0x34, 0x35, 0x34, 0x35, 0x34, 0x35, 0x34, 0x35, 0x34, 0x38, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34, 0x35, 0x38, 0x35, 0x6b, 0x34, 0x37, 0x2c, 0x8f, 0x0a, 0x91, 0xf9, 0xff, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf9, 0xd3, 0x01, 0x07, 0x77, 0x2e, 0x2b, 0x2c, 0x6c, 0x1e, 0x03, 0x4c, 0x02, 0x02, 0x4c, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x4c, 0x01, 0x79, 0xf9, 0xf3, 0xf5, 0xf3, 0xee, 0xe8, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xee, 0xf2, 0xf4, 0xf9, 0xca, 0x00, 0x02, 0x04, 0x01, 0x02, 0x03, 0x14, 0x48, 0x68, 0x2b, 0x2f, 0x2b, 0x30, 0x2b, 0x2d, 0x30, 0x68, 0x2a, 0x8d, 0x0f, 0x01, 0xe2, 0xf8, 0xf6, 0xf0, 0xf6, 0xf0, 0xf6, 0xf0, 0xee, 0xfd, 0xf5, 0xee, 0xfd, 0xf9, 0x07, 0x7e, 0x2a, 0x2f, 0x34, 0x35, 0x6b, 0x38, 0x38, 0x35, 0x34, 0x35, 0x38, 0x35, 0x34, 0x35, 0x34, 0x35, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38, 0x35, 0x34, 0x38, 0x35, 0x6b, 0x34, 0x37, 0x28, 0x8f, 0x07, 0xa5, 0xf9, 0xef, 0xee, 0xf6, 0xf0, 0xfd, 0xf0, 0xf6, 0xfd, 0xf6, 0xf6, 0xef, 0xff, 0x4d, 0x0d, 0x77, 0x62, 0x2b, 0x2b, 0x32, 0x65, 0x0d, 0x02, 0x4d, 0x02, 0x04, 0x02, 0xfa, 0x00, 0x00, 0x00, 0x04, 0x04, 0xfa, 0x01, 0xc7, 0xf9, 0xe8, 0xf3, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf9, 0xee, 0xf5, 0x64, 0x01, 0xfa, 0x4c, 0x00, 0x01, 0x05, 0x5f, 0x6c, 0x28, 0x68, 0x2d, 0x2f, 0x30, 0x30, 0x30, 0x2b, 0x35, 0x2c, 0x84, 0x12, 0x01, 0xd3, 0xf9, 0xec, 0xf0, 0xee, 0xf0, 0xf6, 0xf0, 0xf6, 0xf6, 0xee, 0xef, 0xf8, 0xfd, 0x0a, 0x7e, 0x2c, 0x6e, 0x2f, 0x34, 0x6b, 0x6b, 0x38, 0x34, 0x35, 0x3a, 0x35, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x38, 0x38, 0x38, 0x34, 0x38, 0x34, 0x38, 0x38, 0x38, 0x6b, 0x6b, 0x34, 0x37, 0x2c, 0x8d, 0x53, 0x91, 0xf9, 0xea, 0xef, 0xf0, 0xef, 0xf6, 0xef, 0xf6, 0xee, 0xf0, 0xf6, 0xf8, 0xf9, 0x4e, 0x0f, 0x77, 0x67, 0x28, 0x30, 0x2a, 0x39, 0x57, 0x01, 0x02, 0x02, 0x04, 0x02, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0x4c, 0x02, 0x01, 0x54, 0xf8, 0xef, 0xf5, 0xf5, 0xf2, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf6, 0xf5, 0xf2, 0xef, 0xf9, 0x75, 0x01, 0x4c, 0x4c, 0x02, 0x02, 0x02, 0x0e, 0x42, 0x2c, 0x18, 0x38, 0x2f, 0x2f, 0x30, 0x30, 0x30, 0x34, 0x2f, 0x31, 0x7e, 0x17, 0x01, 0xa5, 0xf9, 0xf0, 0xf7, 0xf7, 0xf6, 0xf0, 0xee, 0xed, 0xee, 0xf5, 0xfb, 0xf8, 0xdd, 0x0f, 0x77, 0x2c, 0x68, 0x30, 0x35, 0x6b, 0x35, 0x6b, 0x36, 0x38, 0x38, 0x34, 0x35, 0x6b, 0x35, 0x36, 0x35, 0x34, 0x35, 0x35, 0x6b, 0x6b, 0x6b, 0x38, 0x34, 0x35, 0x35, 0x6b, 0x34, 0x34, 0x30, 0x7b, 0x5f, 0x69, 0xf9, 0xf9, 0xf5, 0xf6, 0xf0, 0xef, 0xec, 0xed, 0xee, 0xee, 0xfd, 0xf9, 0xe2, 0x03, 0x17, 0x3d, 0x2e, 0x2b, 0x2b, 0x2c, 0x32, 0x6f, 0x07, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x04, 0xfa, 0xfa, 0x4c, 0x01, 0x79, 0xf9, 0xf5, 0xef, 0xf5, 0xf3, 0xf6, 0xf2, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf5, 0xf0, 0xf2, 0xef, 0xf9, 0x9f, 0x01, 0x01, 0x02, 0x02, 0x04, 0x02, 0x01, 0x60, 0x6c, 0x60, 0x1b, 0x35, 0x68, 0x2f, 0x30, 0x30, 0x34, 0x68, 0x30, 0x2b, 0x4a, 0x19, 0x01, 0x5e, 0xfd, 0xef, 0xf7, 0xf7, 0xf7, 0xf0, 0xed, 0xea, 0xea, 0xff, 0xfd, 0xf9, 0x99, 0x0e, 0x42, 0x36, 0x2f, 0x3a, 0x38, 0x6b, 0x38, 0x6b, 0x6b, 0x38, 0x34, 0x34, 0x38, 0x6b, 0x36, 0x36, 0x3a, 0x30, 0x34, 0x32, 0x6c, 0x32, 0x6b, 0x35, 0x34, 0x34, 0x3a, 0x35, 0x38, 0x34, 0x38, 0x36, 0x7e, 0x0f, 0xe2, 0xf9, 0xf9, 0xef, 0xed, 0xec, 0xee, 0xea, 0xf2, 0xf4, 0xfb, 0xf9, 0xbe, 0x01, 0x29, 0x2e, 0x31, 0x67, 0x67, 0x2c, 0x2b, 0x3d, 0x16, 0x05, 0x04, 0xfa, 0x00, 0x00, 0x00, 0x02, 0x03, 0xfa, 0x00, 0xfa, 0x00, 0x00, 0x01, 0x96, 0xf9, 0xe8, 0xed, 0xf2, 0xf3, 0xf4, 0xf0, 0xf2, 0xf4, 0xf3, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xef, 0xf9, 0x96, 0x01, 0x04, 0x00, 0x01, 0x04, 0x03, 0x02, 0x0b, 0x45, 0x6b, 0x62, 0x24, 0x36, 0x2f, 0x30, 0x2b, 0x30, 0x68, 0x68, 0x30, 0x2b, 0x3c, 0x29, 0x05, 0x01, 0xb1, 0xf9, 0xf4, 0xf6, 0xf0, 0xed, 0xef, 0xff, 0xf5, 0xfd, 0xfd, 0xf2, 0x0a, 0x1e, 0x39, 0x3a, 0x3a, 0x38, 0x38, 0x6b, 0x35, 0x36, 0x6b, 0x35, 0x37, 0x34, 0x38, 0x6b, 0x6b, 0x3a, 0x34, 0x30, 0x34, 0x35, 0x35, 0x6b, 0x38, 0x34, 0x34, 0x38, 0x35, 0x38, 0x38, 0x34, 0x35, 0x32, 0x87, 0x14, 0x8c, 0xf9, 0xee, 0xed, 0xef, 0xf8, 0xee, 0xee, 0xee, 0xf5, 0xf9, 0xef, 0x54, 0x08, 0x6f, 0x2a, 0x67, 0x2c, 0x67, 0x2c, 0x2f, 0x2e, 0x6f, 0x0e, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfa, 0xfa, 0xfa, 0xfa, 0x4c, 0x01, 0x01, 0x9f, 0xf9, 0xef, 0xf0, 0xf2, 0xf4, 0xf4, 0xf3, 0xf6, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf2, 0xef, 0xf2, 0xf9, 0xa5, 0x01, 0x04, 0x01, 0xfa, 0x01, 0x04, 0x02, 0x05, 0x63, 0x35, 0x2c, 0x35, 0x35, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x2f, 0x68, 0x35, 0x30, 0x2f, 0x3d, 0x0e, 0x01, 0x52, 0xdd, 0xf9, 0xef, 0xee, 0xff, 0xff, 0xfb, 0xfd, 0xfd, 0xf8, 0x5e, 0x0b, 0x45, 0x32, 0x34, 0x34, 0x38, 0x35, 0x35, 0x3a, 0x35, 0x6b, 0x34, 0x34, 0x30, 0x38, 0x6b, 0x35, 0x34, 0x37, 0x35, 0x35, 0x34, 0x34, 0x30, 0x34, 0x3a, 0x38, 0x35, 0x6b, 0x3a, 0x35, 0x34, 0x38, 0x6b, 0x2e, 0x7e, 0x08, 0xb2, 0xf9, 0xf9, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x79, 0x02, 0x29, 0x39, 0x2c, 0x28, 0x67, 0x67, 0x2f, 0x2c, 0x2c, 0x39, 0x29, 0x06, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0x00, 0x4c, 0x04, 0x01, 0x82, 0xf9, 0xef, 0xf2, 0xf8, 0xf3, 0xf4, 0xf3, 0xf3, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf3, 0xf5, 0xf8, 0xf9, 0x8c, 0x03, 0x04, 0x02, 0xfa, 0x00, 0x01, 0x02, 0x03, 0x16, 0x39, 0x2f, 0x2f, 0x30, 0x2f, 0x2b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x36, 0x34, 0x30, 0x34, 0x3c, 0x29, 0x05, 0x01, 0x53, 0xbe, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xe2, 0x22, 0x05, 0x3d, 0x2e, 0x35, 0x30, 0x30, 0x38, 0x6b, 0x35, 0x35, 0x38, 0x35, 0x3a, 0x30, 0x3a, 0x6b, 0x6b, 0x38, 0x34, 0x37, 0x68, 0x6b, 0x30, 0x37, 0x30, 0x3a, 0x34, 0x38, 0x6b, 0x36, 0x35, 0x38, 0x38, 0x34, 0x35, 0x36, 0x39, 0x3d, 0x06, 0x8e, 0xea, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xea, 0x71, 0x01, 0x10, 0x42, 0x2a, 0x2c, 0x68, 0x2c, 0x67, 0x2c, 0x2f, 0x67, 0x2c, 0x42, 0x59, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x04, 0xfa, 0x02, 0x04, 0x4c, 0x04, 0x4c, 0x01, 0x82, 0xef, 0xf9, 0xf5, 0xf4, 0xf6, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf5, 0xf4, 0xee, 0xf3, 0xf6, 0xf3, 0xf6, 0xf3, 0xf9, 0xf2, 0x71, 0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x03, 0x08, 0x39, 0x32, 0x30, 0x2d, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x2f, 0x2f, 0x35, 0x2f, 0x34, 0x30, 0x2b, 0x47, 0x1c, 0x06, 0x02, 0x02, 0x53, 0x79, 0x9f, 0xb1, 0xa5, 0x63, 0x06, 0x09, 0x3d, 0x6c, 0x67, 0x30, 0x37, 0x34, 0x38, 0x6b, 0x35, 0x3a, 0x3a, 0x34, 0x34, 0x3b, 0x2c, 0x31, 0x32, 0x6b, 0x38, 0x37, 0x6b, 0x35, 0x30, 0x30, 0x30, 0x34, 0x31, 0x3c, 0x67, 0x6e, 0x3a, 0x35, 0x34, 0x34, 0x38, 0x67, 0x36, 0x3d, 0x3d, 0x0b, 0x0b, 0x6d, 0xa5, 0xbe, 0xa5, 0x79, 0x50, 0x03, 0x14, 0x42, 0x2e, 0x67, 0x2b, 0x68, 0x67, 0x67, 0x2c, 0x2f, 0x2f, 0x2b, 0x31, 0x3d, 0x59, 0x05, 0x03, 0x04, 0x00, 0x00, 0x00, 0x04, 0x01, 0x04, 0x04, 0x04, 0x04, 0x00, 0x02, 0x01, 0x54, 0xd9, 0xf9, 0xee, 0xf3, 0xf4, 0xf0, 0xe4, 0xf6, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xee, 0xf6, 0xf4, 0xf4, 0xef, 0xf3, 0xef, 0xf3, 0xf9, 0xe2, 0x5e, 0x01, 0x04, 0x02, 0x02, 0x4c, 0x00, 0x02, 0x04, 0x05, 0x1e, 0x6c, 0x28, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x68, 0x2d, 0x34, 0x2f, 0x40, 0x65, 0x0b, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 0x06, 0x19, 0x40, 0x36, 0x31, 0x34, 0x34, 0x37, 0x34, 0x35, 0x6b, 0x36, 0x34, 0x34, 0x3a, 0x3a, 0x2f, 0x93, 0x83, 0x2e, 0x6c, 0x2b, 0x68, 0x3c, 0x6b, 0x3b, 0x37, 0x3a, 0x32, 0x32, 0x62, 0x3c, 0x2f, 0x30, 0x3a, 0x34, 0x38, 0x38, 0x34, 0x67, 0x35, 0x3c, 0x45, 0x1e, 0x0b, 0x03, 0x01, 0x01, 0x03, 0x0a, 0x5f, 0x45, 0x6c, 0x67, 0x2b, 0x68, 0x2b, 0x67, 0x67, 0x2c, 0x2f, 0x2b, 0x68, 0x67, 0x6c, 0x39, 0x59, 0x05, 0x03, 0x04, 0x01, 0x02, 0x04, 0x02, 0x4c, 0x02, 0x02, 0xfa, 0x02, 0xfa, 0x01, 0x01, 0x51, 0xca, 0xf9, 0xef, 0xf3, 0xf2, 0xf0, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf8, 0xe4, 0xf9, 0xc7, 0x4d, 0x01, 0x04, 0x00, 0x4d, 0x02, 0x02, 0x02, 0x03, 0x03, 0x19, 0x6c, 0x2f, 0x34, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x35, 0x68, 0x68, 0x30, 0x2d, 0x30, 0x40, 0x42, 0x33, 0x5f, 0x13, 0x14, 0x1c, 0x5f, 0x3c, 0x36, 0x30, 0x36, 0x68, 0x34, 0x30, 0x34, 0x3a, 0x6b, 0x6b, 0x35, 0x34, 0x3a, 0x34, 0x34, 0x2c, 0x9b, 0xe1, 0x33, 0x65, 0x6c, 0x31, 0x6c, 0x67, 0x3a, 0x36, 0x32, 0x29, 0xbd, 0xce, 0x28, 0x3a, 0x3a, 0x2f, 0x34, 0x34, 0x68, 0x34, 0x35, 0x30, 0x2f, 0x31, 0x40, 0x45, 0x42, 0x33, 0x29, 0x33, 0x3d, 0x40, 0x2e, 0x6b, 0x35, 0x2f, 0x2f, 0x67, 0x67, 0x67, 0x31, 0x2f, 0x2f, 0x38, 0x68, 0x2c, 0x31, 0x45, 0x29, 0x0b, 0x03, 0x03, 0x03, 0x04, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x4c, 0x4d, 0x01, 0x01, 0x91, 0xf9, 0xf5, 0xee, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xee, 0xf4, 0xf4, 0xf4, 0xf4, 0xef, 0xf5, 0xf9, 0x9f, 0x4e, 0x01, 0x00, 0x04, 0x4c, 0x04, 0x01, 0x4c, 0x03, 0x03, 0x10, 0x39, 0x31, 0x34, 0x2d, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x34, 0x2f, 0x2f, 0x2f, 0x30, 0x30, 0x68, 0x32, 0x31, 0x30, 0x37, 0x30, 0x30, 0x6b, 0x3c, 0x40, 0x40, 0x3c, 0x6c, 0x40, 0x36, 0x36, 0x35, 0x2f, 0x68, 0x34, 0x30, 0x34, 0x35, 0x6b, 0x6b, 0x35, 0x34, 0x2d, 0x3b, 0x3f, 0x2a, 0x92, 0xf1, 0xcc, 0x6a, 0x61, 0x2a, 0x2e, 0x6b, 0x3a, 0x24, 0x25, 0xa1, 0xf1, 0xd7, 0x36, 0x30, 0x30, 0x34, 0x2f, 0x35, 0x34, 0x38, 0x34, 0x34, 0x30, 0x34, 0x3a, 0x3a, 0x36, 0x32, 0x3c, 0x3c, 0x36, 0x6b, 0x38, 0x31, 0x35, 0x68, 0x68, 0x67, 0x32, 0x31, 0x2f, 0x2f, 0x68, 0x67, 0x6b, 0x38, 0x67, 0x2f, 0x6c, 0x33, 0x10, 0x05, 0x02, 0x02, 0x4c, 0x02, 0x04, 0x02, 0xfa, 0x02, 0xfa, 0x01, 0x4c, 0x4c, 0x01, 0x01, 0x96, 0xf9, 0xf4, 0xf3, 0xf6, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf9, 0x91, 0x01, 0x01, 0x04, 0x4d, 0x02, 0x04, 0xfa, 0x04, 0x02, 0x03, 0x10, 0x6f, 0x32, 0x35, 0x2d, 0x2d, 0x2f, 0x31, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x2f, 0x34, 0x30, 0x30, 0x2f, 0x32, 0x31, 0x30, 0x2d, 0x2d, 0x2d, 0x34, 0x2d, 0x2d, 0x30, 0x30, 0x3b, 0x30, 0x38, 0x35, 0x67, 0x6b, 0x68, 0x35, 0x30, 0x3a, 0x35, 0x36, 0x6b, 0x35, 0x34, 0x3b, 0x68, 0x38, 0x32, 0x42, 0xc8, 0xf8, 0xe7, 0xa7, 0x7c, 0x6c, 0x2e, 0x36, 0x80, 0xcc, 0xf1, 0xe7, 0x7e, 0x31, 0x30, 0x30, 0x2f, 0x30, 0x68, 0x34, 0x68, 0x30, 0x30, 0x30, 0x2d, 0x37, 0x2d, 0x30, 0x3b, 0x30, 0x34, 0x3b, 0x38, 0x38, 0x35, 0x6b, 0x34, 0x2f, 0x67, 0x67, 0x32, 0x2f, 0x2f, 0x68, 0x67, 0x35, 0x68, 0x34, 0x68, 0x6b, 0x32, 0x3d, 0x29, 0x0f, 0x03, 0x02, 0x02, 0x02, 0x04, 0x04, 0x00, 0x04, 0x4d, 0x4c, 0x4d, 0x00, 0x02, 0x01, 0x91, 0xf9, 0xf5, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfe, 0xf5, 0xf4, 0xea, 0xec, 0xf4, 0xf7, 0xf6, 0xf4, 0xf0, 0xf8, 0x82, 0x01, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x04, 0x03, 0x06, 0x18, 0x31, 0x36, 0x35, 0x2f, 0x2d, 0x2d, 0x2b, 0x2d, 0x2f, 0x2f, 0x2f, 0x30, 0x34, 0x30, 0x2d, 0x2f, 0x35, 0x67, 0x2c, 0x68, 0x2f, 0x3a, 0x3c, 0x76, 0x4a, 0x3c, 0x3a, 0x3b, 0x38, 0x3b, 0x38, 0x34, 0x6b, 0x6b, 0x32, 0x35, 0x35, 0x35, 0x35, 0x35, 0x6b, 0x3a, 0x3a, 0x3b, 0x3a, 0x43, 0x47, 0x85, 0x7a, 0x40, 0xaf, 0xe7, 0xf8, 0xef, 0xe5, 0xe0, 0xe3, 0xec, 0xf8, 0xd1, 0x87, 0x3c, 0x4b, 0x46, 0x43, 0x43, 0x6e, 0x3b, 0x3a, 0x3b, 0x3b, 0x37, 0x37, 0x38, 0x3c, 0x6e, 0x3f, 0x3a, 0x47, 0x43, 0x44, 0x73, 0x72, 0x76, 0x3f, 0x3c, 0x2f, 0x2f, 0x2f, 0x67, 0x35, 0x67, 0x68, 0x67, 0x35, 0x68, 0x68, 0x68, 0x2f, 0x68, 0x68, 0x3a, 0x6c, 0x26, 0x0e, 0x06, 0x03, 0x03, 0x01, 0x04, 0xfa, 0x00, 0xfa, 0x00, 0x04, 0x4c, 0x01, 0x01, 0xcd, 0xef, 0xec, 0xf4, 0xfb, 0xf3, 0xf4, 0xfb, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfb, 0xfb, 0xed, 0xea, 0xea, 0xf4, 0xf2, 0xfc, 0xf3, 0xf9, 0x96, 0x01, 0x01, 0x05, 0x03, 0x03, 0x03, 0x05, 0x05, 0x0b, 0x19, 0x33, 0x3a, 0x2f, 0x2f, 0x31, 0x35, 0x2b, 0x2d, 0x30, 0x2f, 0x30, 0x2f, 0x2f, 0x34, 0x2b, 0x2b, 0x2b, 0x2f, 0x35, 0x6b, 0x43, 0x47, 0x7d, 0x8a, 0x48, 0xc4, 0xd4, 0x48, 0x7a, 0x80, 0x81, 0x7d, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x8a, 0x81, 0x81, 0x81, 0x81, 0x76, 0x7e, 0xcc, 0xdd, 0xea, 0xee, 0xe5, 0xdc, 0xa1, 0x77, 0x45, 0x49, 0x46, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x4b, 0x4b, 0x7d, 0x7a, 0x7a, 0x4a, 0x45, 0x4a, 0x8a, 0x3c, 0x44, 0x35, 0x2c, 0x67, 0x67, 0x67, 0x2f, 0x67, 0x35, 0x35, 0x68, 0x34, 0x2f, 0x2d, 0x2f, 0x30, 0x6b, 0x40, 0x25, 0x14, 0x08, 0x03, 0x01, 0x02, 0x02, 0xfa, 0x04, 0xfa, 0x04, 0x04, 0x02, 0x4f, 0xdd, 0xf8, 0xf3, 0xf6, 0xfb, 0xf6, 0xf3, 0xf4, 0xf3, 0xfb, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfb, 0xf5, 0xed, 0xea, 0xf3, 0xf6, 0xf7, 0xf3, 0xf9, 0x9f, 0x01, 0x02, 0x02, 0x05, 0x08, 0x0b, 0x13, 0x1c, 0x65, 0x39, 0x39, 0x31, 0x28, 0x30, 0x31, 0x67, 0x32, 0x32, 0x31, 0x2c, 0x2f, 0x2f, 0x2c, 0x2f, 0x2c, 0x35, 0x3f, 0x47, 0x49, 0x81, 0x81, 0x85, 0x85, 0x8a, 0x48, 0x9b, 0xe3, 0xf1, 0xd5, 0x8d, 0x45, 0x80, 0x83, 0x83, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x88, 0x81, 0x85, 0x81, 0x83, 0x83, 0x80, 0x80, 0x7c, 0x45, 0x7f, 0xa1, 0xdf, 0xf1, 0xdf, 0xaa, 0x78, 0x77, 0x48, 0x7a, 0x4b, 0x49, 0x7d, 0x7a, 0x7d, 0x7a, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7d, 0x7d, 0x7d, 0x49, 0x7d, 0x7a, 0x49, 0x7a, 0x7a, 0x45, 0x84, 0xd8, 0xeb, 0xa9, 0x48, 0x80, 0x83, 0x81, 0x49, 0x3f, 0x3c, 0x31, 0x2c, 0x2c, 0x31, 0x2c, 0x35, 0x31, 0x35, 0x35, 0x2b, 0x32, 0x3c, 0x42, 0x42, 0x5f, 0x14, 0x08, 0x03, 0x02, 0x02, 0x4c, 0x02, 0x4c, 0x4d, 0x01, 0x5a, 0xf9, 0xf8, 0xf4, 0xf6, 0xfb, 0xf4, 0xfb, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfb, 0xf4, 0xed, 0xea, 0xed, 0xff, 0xfb, 0xf9, 0xdf, 0x4f, 0x02, 0x03, 0x0d, 0x19, 0x29, 0x32, 0x32, 0x31, 0x2c, 0x67, 0x2c, 0x2f, 0x30, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2c, 0x2c, 0x2c, 0x36, 0x3f, 0x44, 0x49, 0x81, 0x85, 0x85, 0x85, 0x81, 0x81, 0x85, 0x80, 0x4a, 0x84, 0xe6, 0xec, 0xe9, 0xec, 0xe6, 0xa7, 0x74, 0x4a, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x85, 0x81, 0x85, 0x81, 0x81, 0x81, 0x81, 0x4b, 0x81, 0x80, 0x80, 0x45, 0x8d, 0xcc, 0xf1, 0xf1, 0xf0, 0xf2, 0xdd, 0xf1, 0xe7, 0xb7, 0x80, 0x6c, 0x76, 0x4b, 0x7d, 0x4b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x80, 0x42, 0x48, 0x9a, 0xde, 0xec, 0xec, 0xe9, 0xb0, 0x77, 0x80, 0x8a, 0x88, 0x8b, 0x83, 0x81, 0x7a, 0x49, 0x40, 0x3c, 0x36, 0x31, 0x31, 0x28, 0x2f, 0x28, 0x2c, 0x35, 0x6c, 0x76, 0x48, 0x39, 0x1e, 0x12, 0x05, 0x02, 0x03, 0x4c, 0x4c, 0x00, 0x01, 0xca, 0xf9, 0xf6, 0xf4, 0xf4, 0xf3, 0xf3, 0xf6, 0xf3, 0xf3, 0xfb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf4, 0xf3, 0xf5, 0xea, 0xf5, 0xf3, 0xfd, 0xf8, 0x6d, 0x03, 0x09, 0x1e, 0x65, 0x2e, 0x2a, 0x28, 0x2c, 0x2b, 0x2b, 0x27, 0x28, 0x2b, 0x27, 0x28, 0x2c, 0x2f, 0x67, 0x6e, 0x47, 0x49, 0x7d, 0x7d, 0x81, 0x85, 0x85, 0x81, 0x7d, 0x81, 0x81, 0x81, 0x85, 0x80, 0x4a, 0x97, 0xe9, 0xec, 0xed, 0xf4, 0xea, 0xec, 0xf8, 0xda, 0x94, 0x77, 0x7c, 0x83, 0x83, 0x81, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x83, 0x8a, 0x83, 0x88, 0x4b, 0x4b, 0x4a, 0x8f, 0xd1, 0xf1, 0xf1, 0xdc, 0xf2, 0xf0, 0xf8, 0xaa, 0xa1, 0xd5, 0xf1, 0xe7, 0xcc, 0x8f, 0x3d, 0x44, 0x47, 0x4b, 0x4b, 0x49, 0x4b, 0x4b, 0x4b, 0x4b, 0x7d, 0x81, 0x7d, 0x80, 0x4a, 0x77, 0x7e, 0x9a, 0xdb, 0xf8, 0xee, 0xec, 0xec, 0xf1, 0xf8, 0xc9, 0x7b, 0x80, 0x85, 0x8a, 0x8b, 0x8b, 0x8b, 0x85, 0x88, 0x85, 0x85, 0x83, 0x81, 0x7d, 0x7d, 0x46, 0x73, 0x3e, 0x6e, 0x38, 0x73, 0x44, 0x48, 0x7c, 0x6f, 0x59, 0x0b, 0x05, 0x03, 0x4c, 0x01, 0x55, 0xf8, 0xf0, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xfb, 0xf3, 0xed, 0xf5, 0xf5, 0xf5, 0xf8, 0xe1, 0x0a, 0x09, 0x1f, 0x2e, 0x62, 0x2c, 0x28, 0x28, 0x28, 0x27, 0x28, 0x6e, 0x49, 0x81, 0x3c, 0x44, 0x76, 0x4b, 0x4b, 0x4b, 0x4b, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x81, 0x81, 0x81, 0x83, 0x81, 0x83, 0x80, 0x45, 0xa1, 0xe6, 0xec, 0xed, 0xf4, 0xfb, 0xf5, 0xed, 0xed, 0xf1, 0xe6, 0xcf, 0x87, 0x77, 0x4a, 0x83, 0x80, 0x85, 0x87, 0x80, 0x83, 0x87, 0x83, 0x87, 0x80, 0x7c, 0x7a, 0x8f, 0xcf, 0xea, 0xec, 0xda, 0xc2, 0x99, 0xe1, 0xef, 0xec, 0xcc, 0x97, 0x9a, 0xb7, 0xd8, 0xeb, 0xeb, 0xd1, 0xa0, 0x7e, 0x42, 0x45, 0x4a, 0x47, 0x4b, 0x49, 0x4b, 0x76, 0x7c, 0x48, 0x77, 0x8e, 0xb0, 0xda, 0xf1, 0xed, 0xf1, 0xea, 0xf5, 0xfb, 0xf6, 0xf3, 0xf1, 0xce, 0x84, 0x80, 0x83, 0x83, 0x85, 0x8a, 0x81, 0x85, 0x85, 0x85, 0x85, 0x85, 0x8a, 0x81, 0x83, 0x81, 0x85, 0x49, 0x6b, 0x6e, 0x47, 0x73, 0x44, 0x72, 0x4a, 0x45, 0x59, 0x0b, 0x05, 0x03, 0x4d, 0xd6, 0xf8, 0xed, 0xf3, 0xed, 0xf3, 0xf6, 0xf3, 0xf4, 0xfb, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xed, 0xed, 0xf3, 0xf3, 0xf9, 0xaa, 0x0c, 0x1f, 0x2b, 0x27, 0x27, 0x2b, 0x27, 0x27, 0x2f, 0x44, 0x83, 0x81, 0x8a, 0x87, 0xaf, 0x77, 0x45, 0x45, 0x4b, 0x4b, 0x49, 0x81, 0x81, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7c, 0x48, 0x89, 0xd7, 0xf8, 0xec, 0xed, 0xf4, 0xfb, 0xf5, 0xfb, 0xf5, 0xf6, 0xea, 0xec, 0xf0, 0xf8, 0xd5, 0xa7, 0x89, 0x80, 0x77, 0x7e, 0x7c, 0x7e, 0x7c, 0x84, 0x84, 0xa0, 0xc2, 0xe1, 0xf8, 0xf0, 0xd7, 0xb7, 0x95, 0x95, 0xa0, 0xe0, 0xee, 0xef, 0xd1, 0xa0, 0xa2, 0x9b, 0x95, 0xae, 0xd1, 0xeb, 0xf8, 0xf1, 0xde, 0xc5, 0xa7, 0x8f, 0x8e, 0x87, 0x8d, 0x97, 0xa7, 0xcf, 0xda, 0xf1, 0xf9, 0xf0, 0xed, 0xe8, 0xe8, 0xfb, 0xfe, 0xfb, 0xfb, 0xf7, 0xe9, 0xf8, 0xde, 0x97, 0x7b, 0x8a, 0x8a, 0x8a, 0x85, 0x85, 0x85, 0x81, 0x83, 0x83, 0x7a, 0x83, 0x83, 0x80, 0x4a, 0x92, 0x9e, 0x32, 0x44, 0x43, 0x49, 0x47, 0x43, 0x49, 0x7a, 0x45, 0x16, 0x09, 0x03, 0x90, 0xf9, 0xec, 0xed, 0xed, 0xf3, 0xf3, 0xf7, 0xfb, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf5, 0xf5, 0xed, 0xed, 0xf8, 0x94, 0x15, 0x62, 0x24, 0x2b, 0x28, 0x28, 0x34, 0x7d, 0x81, 0x85, 0x85, 0x83, 0x4a, 0x9a, 0xf1, 0xda, 0xa1, 0x7e, 0x42, 0x45, 0x7c, 0x4a, 0x7c, 0x80, 0x80, 0x4b, 0x7c, 0x83, 0x7b, 0x7c, 0x8e, 0xcc, 0xe9, 0xe9, 0xec, 0xf3, 0xfb, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf5, 0xf5, 0xec, 0xe8, 0xec, 0xf0, 0xde, 0xd5, 0xc8, 0xc4, 0xc0, 0xc8, 0xd5, 0xdb, 0xe7, 0xe7, 0xe7, 0xe1, 0xd1, 0xa1, 0x9a, 0x9b, 0x9d, 0x9b, 0xa2, 0xe3, 0xea, 0xf8, 0xda, 0xa2, 0x9e, 0x9e, 0xa2, 0x9a, 0x94, 0xa1, 0xb5, 0xd4, 0xe1, 0xe7, 0xf1, 0xeb, 0xe9, 0xe9, 0xe3, 0xe6, 0xea, 0xec, 0xf8, 0xed, 0xed, 0xf2, 0xee, 0xee, 0xed, 0xf4, 0xf6, 0xf3, 0xf5, 0xe8, 0xee, 0xe9, 0xf8, 0xe9, 0xc2, 0x89, 0x77, 0x87, 0x8a, 0x83, 0x83, 0x8a, 0x80, 0x80, 0x80, 0x7e, 0x7b, 0x7f, 0x8e, 0xde, 0xe7, 0x7e, 0x6c, 0x76, 0x46, 0x49, 0x49, 0x46, 0x47, 0x76, 0x48, 0x5f, 0x09, 0x66, 0xf9, 0xea, 0xed, 0xf3, 0xf3, 0xf4, 0xfb, 0xf6, 0xfb, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xea, 0xf3, 0xf1, 0xf1, 0x94, 0x62, 0x27, 0x2c, 0x32, 0x44, 0x81, 0x88, 0x85, 0x85, 0x81, 0x81, 0x7a, 0x8d, 0xe1, 0xf1, 0xf0, 0xf8, 0xe6, 0xd4, 0xb0, 0x94, 0x7b, 0x77, 0x45, 0x45, 0x48, 0x4a, 0x87, 0xa7, 0xd4, 0xec, 0xf1, 0xec, 0xf0, 0xfd, 0xfb, 0xfc, 0xf4, 0xf4, 0xec, 0xed, 0xf3, 0xf3, 0xfe, 0xff, 0xfe, 0xee, 0xf3, 0xed, 0xf1, 0xe5, 0xde, 0xde, 0xec, 0xeb, 0xe3, 0xd5, 0xcf, 0xb8, 0xa7, 0x95, 0x8f, 0xa2, 0xa3, 0xa3, 0x98, 0xa6, 0xb0, 0xe9, 0xfd, 0xf0, 0xe6, 0xa7, 0x9d, 0x9c, 0x9d, 0x9d, 0x9b, 0xa2, 0x9b, 0x92, 0x95, 0xa0, 0xa7, 0xb8, 0xcf, 0xe7, 0xb5, 0xcd, 0xed, 0xe9, 0xf1, 0xf2, 0xf6, 0xed, 0xf3, 0xea, 0xed, 0xf3, 0xf3, 0xed, 0xea, 0xee, 0xed, 0xf3, 0xf2, 0xf7, 0xf8, 0xde, 0xb8, 0x89, 0x7b, 0x4a, 0x48, 0x48, 0x77, 0x77, 0x7c, 0x8d, 0xaa, 0xda, 0xf8, 0xf1, 0xf0, 0xd7, 0x7c, 0x6c, 0x49, 0x47, 0x46, 0x49, 0x46, 0x76, 0x72, 0x48, 0x1c, 0x66, 0xf8, 0xea, 0xec, 0xed, 0xed, 0xf3, 0xf7, 0xfb, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfe, 0xf3, 0xf5, 0xf5, 0xe9, 0xf8, 0x9a, 0x32, 0x47, 0x7a, 0x81, 0x85, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7a, 0x7e, 0xe0, 0xf0, 0xf2, 0xfb, 0xf4, 0xec, 0xf1, 0xf1, 0xf1, 0xeb, 0xe3, 0xda, 0xda, 0xdb, 0xe3, 0xe6, 0xf0, 0xec, 0xec, 0xea, 0xec, 0xed, 0xf4, 0xfd, 0xf3, 0xf4, 0xf3, 0xec, 0xf3, 0xf3, 0xe8, 0xf5, 0xf6, 0xff, 0xfb, 0xef, 0xf2, 0xf0, 0xc8, 0x8e, 0x97, 0xde, 0xc8, 0x8f, 0x9a, 0x9a, 0xa0, 0x9d, 0x9d, 0xab, 0x9d, 0x9c, 0xa3, 0xa3, 0xa0, 0xb5, 0xf1, 0xfc, 0xfd, 0xeb, 0xb7, 0x98, 0x98, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9e, 0x9b, 0x9b, 0xa1, 0xe7, 0xaa, 0xaa, 0xf8, 0xe9, 0xf3, 0xf4, 0xf3, 0xf3, 0xec, 0xf3, 0xec, 0xfb, 0xed, 0xec, 0xea, 0xea, 0xf2, 0xef, 0xfd, 0xf5, 0xf3, 0xf1, 0xec, 0xe0, 0xda, 0xcc, 0xc9, 0xc9, 0xce, 0xd5, 0xe1, 0xeb, 0xf1, 0xf0, 0xf6, 0xf3, 0xe9, 0xf8, 0xd7, 0x77, 0x72, 0x76, 0x49, 0x46, 0x46, 0x46, 0x49, 0x72, 0x61, 0x78, 0xf9, 0xed, 0xed, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xfc, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xfe, 0xf4, 0xec, 0xf8, 0xcc, 0x39, 0x4a, 0x7d, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x48, 0x89, 0xda, 0xf8, 0xed, 0xf2, 0xf4, 0xed, 0xf3, 0xed, 0xf4, 0xed, 0xec, 0xef, 0xef, 0xef, 0xef, 0xcf, 0xa7, 0xdc, 0xf8, 0xea, 0xed, 0xed, 0xed, 0xed, 0xec, 0xf3, 0xed, 0xf3, 0xed, 0xfb, 0xf6, 0xed, 0xea, 0xec, 0xf6, 0xfb, 0xf6, 0xee, 0xe9, 0xb9, 0x94, 0xb7, 0xe7, 0xae, 0xa2, 0xa3, 0xa4, 0xa2, 0xa2, 0xa3, 0x9e, 0xa3, 0x9d, 0xa3, 0x9e, 0x9a, 0xb8, 0xf1, 0xf6, 0xf4, 0xf8, 0xc2, 0x95, 0x9d, 0x9c, 0x9d, 0x9b, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x98, 0x9e, 0xa2, 0xe1, 0xc5, 0xa1, 0xeb, 0xea, 0xf5, 0xf5, 0xf3, 0xec, 0xf4, 0xf3, 0xfb, 0xfb, 0xf4, 0xea, 0xed, 0xf3, 0xf4, 0xff, 0xea, 0xea, 0xeb, 0xe7, 0xb8, 0xc0, 0xe3, 0xef, 0xf9, 0xf8, 0xf9, 0xf8, 0xee, 0xf4, 0xf4, 0xed, 0xe8, 0xed, 0xea, 0xed, 0xf9, 0xd1, 0x7b, 0x6c, 0x7d, 0x46, 0x46, 0x46, 0x49, 0x72, 0x62, 0xa5, 0xf9, 0xf3, 0xf2, 0xf6, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xed, 0xf3, 0xf5, 0xfb, 0xf5, 0xf2, 0xeb, 0xf1, 0xa7, 0x42, 0x76, 0x7a, 0x83, 0x80, 0x81, 0x7a, 0x4a, 0xa9, 0xeb, 0xf8, 0xf6, 0xe8, 0xf6, 0xed, 0xf3, 0xed, 0xf4, 0xf4, 0xed, 0xec, 0xed, 0xff, 0xee, 0xf0, 0xc9, 0x89, 0x94, 0xda, 0xf8, 0xf4, 0xf4, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf3, 0xf6, 0xfb, 0xed, 0xea, 0xed, 0xf2, 0xf6, 0xf3, 0xee, 0xe6, 0x9a, 0x95, 0xc9, 0xe6, 0xa0, 0xa2, 0xa3, 0x9e, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0x95, 0xc9, 0xed, 0xee, 0xf6, 0xf8, 0xd1, 0x95, 0x9e, 0x9c, 0x98, 0x9d, 0x9b, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9b, 0xe0, 0xcd, 0x97, 0xe5, 0xec, 0xf2, 0xf2, 0xf4, 0xed, 0xeb, 0xfb, 0xf6, 0xfb, 0xf4, 0xed, 0xed, 0xf4, 0xfb, 0xfb, 0xe8, 0xea, 0xec, 0xd1, 0x7f, 0xa7, 0xe6, 0xee, 0xf6, 0xfb, 0xf4, 0xed, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xed, 0xf4, 0xe8, 0xe8, 0xf8, 0xe1, 0x97, 0x3d, 0x3d, 0x73, 0x44, 0x45, 0x2e, 0x7b, 0xe5, 0xf0, 0xf2, 0xf0, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf4, 0xf5, 0xfe, 0xfb, 0xef, 0xe9, 0xf1, 0xe6, 0xb0, 0x7c, 0x7b, 0x77, 0x77, 0x7e, 0x92, 0xd1, 0xec, 0xf1, 0xf2, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xed, 0xf3, 0xf4, 0xfe, 0xee, 0xee, 0xe1, 0x8f, 0x8e, 0xa7, 0xf1, 0xf6, 0xf4, 0xf6, 0xf4, 0xf3, 0xed, 0xf3, 0xed, 0xed, 0xf4, 0xf4, 0xed, 0xea, 0xed, 0xf4, 0xf7, 0xf3, 0xf8, 0xde, 0x95, 0x95, 0xd5, 0xe0, 0xa0, 0xa2, 0xa3, 0xa3, 0xa2, 0xa3, 0x9e, 0xa2, 0xa3, 0xa3, 0xa3, 0x9e, 0x9a, 0xcf, 0xf1, 0xf4, 0xf2, 0xf8, 0xd7, 0x95, 0x9e, 0x9c, 0x9c, 0x9b, 0x9e, 0xa3, 0x9b, 0x9e, 0x9e, 0x9e, 0x9e, 0x9b, 0xde, 0xd4, 0x94, 0xde, 0xf0, 0xf5, 0xf5, 0xf4, 0xed, 0xf3, 0xf4, 0xfb, 0xf4, 0xf3, 0xed, 0xf3, 0xfb, 0xfb, 0xfb, 0xed, 0xef, 0xeb, 0x94, 0x8f, 0xcf, 0xec, 0xf3, 0xfb, 0xfb, 0xed, 0xea, 0xed, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xfd, 0xf3, 0xed, 0xf0, 0xf1, 0xd5, 0xa7, 0x84, 0x7c, 0x7f, 0x97, 0xe1, 0xf8, 0xf2, 0xf4, 0xf6, 0xf2, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xed, 0xf3, 0xf5, 0xf5, 0xf5, 0xf3, 0xe9, 0xe9, 0xf0, 0xe3, 0xd4, 0xcc, 0xd4, 0xe1, 0xee, 0xf8, 0xec, 0xfc, 0xf3, 0xf6, 0xed, 0xf3, 0xf2, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xfb, 0xf5, 0xf4, 0xec, 0xeb, 0xc2, 0x84, 0x7e, 0xda, 0xf1, 0xf6, 0xf4, 0xf6, 0xf3, 0xf4, 0xf3, 0xed, 0xed, 0xf4, 0xf6, 0xed, 0xec, 0xee, 0xf4, 0xf4, 0xf3, 0xf1, 0xd4, 0x8f, 0xa0, 0xe1, 0xd5, 0xa0, 0xa2, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa3, 0x9e, 0xa4, 0x9e, 0x9a, 0xd1, 0xf0, 0xed, 0xf6, 0xf1, 0xde, 0x9a, 0x9b, 0x9c, 0x9e, 0x9d, 0x9b, 0x9e, 0x9e, 0xa2, 0x9e, 0x9d, 0x9e, 0x95, 0xd8, 0xdc, 0x94, 0xd4, 0xec, 0xed, 0xfe, 0xf4, 0xf3, 0xec, 0xf3, 0xf3, 0xf4, 0xf4, 0xed, 0xf3, 0xfb, 0xfc, 0xf7, 0xf6, 0xec, 0xd5, 0x84, 0x97, 0xeb, 0xeb, 0xf7, 0xfb, 0xf6, 0xea, 0xea, 0xec, 0xf3, 0xed, 0xf3, 0xfc, 0xf6, 0xfb, 0xf3, 0xfe, 0xf3, 0xf0, 0xf0, 0xec, 0xf9, 0xf1, 0xea, 0xf0, 0xf9, 0xee, 0xf2, 0xf3, 0xf3, 0xf4, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xfe, 0xf3, 0xee, 0xf4, 0xed, 0xec, 0xea, 0xee, 0xf0, 0xec, 0xe9, 0xe9, 0xe9, 0xf6, 0xfb, 0xfc, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf4, 0xed, 0xf4, 0xed, 0xfb, 0xf6, 0xfb, 0xf6, 0xec, 0xec, 0xdc, 0x8f, 0x87, 0xa7, 0xf6, 0xeb, 0xed, 0xf2, 0xf6, 0xf5, 0xed, 0xf4, 0xec, 0xf6, 0xf4, 0xee, 0xea, 0xed, 0xf4, 0xf2, 0xec, 0xf8, 0xc2, 0x95, 0xa7, 0xe3, 0xd5, 0x9a, 0xa2, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa3, 0xa3, 0xa2, 0x95, 0xd7, 0xf1, 0xf6, 0xed, 0xee, 0xe5, 0xa0, 0x9b, 0x9d, 0x9d, 0x9e, 0x9e, 0xa3, 0x9b, 0x9e, 0x9e, 0x9e, 0x9e, 0x95, 0xd5, 0xe1, 0x94, 0xc8, 0xee, 0xed, 0xf3, 0xf4, 0xed, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xea, 0xf5, 0xfb, 0xfc, 0xfb, 0xf1, 0xe9, 0x97, 0x87, 0xc2, 0xf1, 0xf3, 0xfb, 0xf7, 0xf5, 0xec, 0xea, 0xec, 0xf6, 0xf3, 0xfb, 0xf6, 0xfc, 0xf6, 0xfe, 0xf3, 0xf0, 0xe9, 0xac, 0xd0, 0xf1, 0xea, 0xed, 0xec, 0xf4, 0xf4, 0xf6, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xea, 0xed, 0xf3, 0xed, 0xe5, 0x99, 0xdd, 0xf3, 0xfc, 0xfb, 0xed, 0xed, 0xf4, 0xf4, 0xf3, 0xed, 0xf6, 0xed, 0xf4, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xa1, 0x8d, 0x84, 0xd4, 0xf8, 0xec, 0xf2, 0xf3, 0xf5, 0xf5, 0xed, 0xed, 0xf4, 0xf4, 0xed, 0xed, 0xee, 0xf6, 0xf4, 0xed, 0xeb, 0xb0, 0x95, 0xa7, 0xe7, 0xd1, 0x9a, 0xa2, 0xa3, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0x9e, 0xa3, 0x95, 0xda, 0xf1, 0xf4, 0xf4, 0xf1, 0xe9, 0xa7, 0x9b, 0x98, 0x9e, 0x9d, 0x9b, 0x9e, 0x9e, 0xa2, 0x9e, 0x9d, 0x9e, 0x95, 0xd5, 0xe3, 0x97, 0xb7, 0xf0, 0xed, 0xfe, 0xfb, 0xf4, 0xed, 0xf3, 0xf5, 0xf3, 0xf4, 0xed, 0xf3, 0xf6, 0xfb, 0xf7, 0xf8, 0xc9, 0x8d, 0x89, 0xe1, 0xf1, 0xf7, 0xfb, 0xf6, 0xed, 0xea, 0xec, 0xed, 0xed, 0xf4, 0xf6, 0xf2, 0xf7, 0xf2, 0xee, 0xed, 0xf8, 0xb2, 0x7f, 0xe4, 0xed, 0xec, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf6, 0xfc, 0xf6, 0xed, 0xf5, 0xf3, 0xee, 0xe5, 0x79, 0x90, 0xf8, 0xf2, 0xf6, 0xf3, 0xf3, 0xf3, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xf5, 0xf4, 0xec, 0xed, 0xf6, 0xf2, 0xf8, 0xda, 0x8f, 0x89, 0x97, 0xf1, 0xe9, 0xec, 0xed, 0xf5, 0xf5, 0xed, 0xec, 0xf6, 0xf4, 0xed, 0xed, 0xf5, 0xf6, 0xf6, 0xf1, 0xe3, 0xa1, 0x95, 0xc0, 0xeb, 0xce, 0x9a, 0xa2, 0xa3, 0xa3, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa3, 0xa2, 0x9a, 0xde, 0xf1, 0xf6, 0xed, 0xee, 0xeb, 0xb8, 0x95, 0x9e, 0x9d, 0x9e, 0x98, 0xa3, 0x9b, 0x9e, 0x9e, 0x9e, 0x9e, 0x9b, 0xce, 0xe6, 0x97, 0xa7, 0xe9, 0xee, 0xf4, 0xfb, 0xed, 0xf4, 0xea, 0xf3, 0xf4, 0xf3, 0xea, 0xf3, 0xf6, 0xf2, 0xf1, 0xe7, 0x97, 0x7e, 0xc2, 0xf1, 0xf7, 0xfb, 0xf6, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xf4, 0xf4, 0xf7, 0xf3, 0xee, 0xe9, 0xee, 0xd4, 0x70, 0xaa, 0xf1, 0xe9, 0xf6, 0xf3, 0xed, 0xf3, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfb, 0xf6, 0xfb, 0xf3, 0xed, 0xed, 0xf4, 0xf6, 0xfb, 0xf6, 0xed, 0xed, 0xf4, 0xed, 0xee, 0xaa, 0x66, 0xd4, 0xf8, 0xec, 0xf4, 0xed, 0xf3, 0xf4, 0xf3, 0xed, 0xf4, 0xf6, 0xed, 0xf5, 0xed, 0xec, 0xf4, 0xf7, 0xfc, 0xfe, 0xf1, 0x9a, 0x8d, 0x89, 0xd7, 0xf0, 0xea, 0xee, 0xf5, 0xf5, 0xed, 0xed, 0xf4, 0xf4, 0xed, 0xea, 0xf5, 0xf3, 0xf4, 0xf1, 0xde, 0x9a, 0x9a, 0xc8, 0xeb, 0xce, 0xa0, 0xa2, 0xa3, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0x9e, 0x9a, 0xe1, 0xf1, 0xed, 0xf6, 0xf1, 0xec, 0xc9, 0x95, 0x98, 0x9e, 0x98, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0x9d, 0x98, 0x95, 0xcc, 0xeb, 0xa0, 0x9a, 0xe6, 0xf8, 0xfd, 0xf4, 0xf3, 0xed, 0xed, 0xf5, 0xf3, 0xf4, 0xf5, 0xf5, 0xf5, 0xf3, 0xf8, 0xcc, 0x89, 0x7e, 0xe9, 0xec, 0xf7, 0xfb, 0xf6, 0xea, 0xed, 0xed, 0xfc, 0xed, 0xed, 0xf5, 0xf4, 0xfd, 0xe8, 0xf1, 0xec, 0xec, 0x78, 0x74, 0xe1, 0xf1, 0xee, 0xf3, 0xfe, 0xf3, 0xf3, 0xec, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfb, 0xfb, 0xf4, 0xf3, 0xec, 0xec, 0xf4, 0xf6, 0xfc, 0xf7, 0xed, 0xf4, 0xf6, 0xea, 0xee, 0xde, 0x78, 0x78, 0xe6, 0xf1, 0xf4, 0xf3, 0xed, 0xf3, 0xed, 0xf6, 0xed, 0xf4, 0xed, 0xed, 0xea, 0xec, 0xeb, 0xfe, 0xfc, 0xff, 0xee, 0xe1, 0x84, 0x8d, 0x97, 0xec, 0xe9, 0xed, 0xf5, 0xf5, 0xf4, 0xec, 0xf4, 0xf4, 0xed, 0xed, 0xf5, 0xf4, 0xf6, 0xf1, 0xd7, 0x9a, 0xa6, 0xc8, 0xe7, 0xd5, 0x9a, 0xa3, 0x9e, 0xa3, 0xa3, 0xa2, 0xa2, 0xa6, 0xa2, 0xa3, 0xa3, 0x9e, 0xa0, 0xe3, 0xec, 0xf6, 0xed, 0xf0, 0xf0, 0xce, 0x95, 0x9e, 0x98, 0x9d, 0x9b, 0xa3, 0x9b, 0x9e, 0x9e, 0x9e, 0x9e, 0x95, 0xc8, 0xeb, 0xa7, 0x8f, 0xe3, 0xee, 0xfb, 0xfb, 0xed, 0xf3, 0xea, 0xf3, 0xf4, 0xf3, 0xed, 0xf5, 0xf4, 0xf1, 0xe5, 0x8e, 0x7e, 0xc8, 0xf8, 0xf2, 0xfc, 0xfb, 0xed, 0xea, 0xec, 0xf6, 0xfc, 0xea, 0xed, 0xf5, 0xf5, 0xf6, 0xed, 0xe9, 0xee, 0x97, 0x59, 0xc2, 0xf1, 0xec, 0xed, 0xfe, 0xfe, 0xfe, 0xf4, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf4, 0xf4, 0xfb, 0xed, 0xf4, 0xf4, 0xf3, 0xed, 0xef, 0xa1, 0x63, 0xaa, 0xf8, 0xf7, 0xf3, 0xf4, 0xec, 0xec, 0xed, 0xf4, 0xf6, 0xf3, 0xf4, 0xed, 0xf4, 0xf6, 0xfb, 0xfd, 0xf2, 0xf0, 0xf1, 0xaa, 0x87, 0x84, 0xd7, 0xf8, 0xf3, 0xfe, 0xff, 0xed, 0xea, 0xee, 0xf3, 0xed, 0xed, 0xf5, 0xf6, 0xf4, 0xeb, 0xd1, 0x95, 0xb3, 0xb7, 0xe7, 0xd7, 0x9a, 0x9e, 0x9d, 0xa4, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0x9e, 0xa0, 0xe6, 0xec, 0xf6, 0xf6, 0xee, 0xf1, 0xd5, 0x95, 0x98, 0x98, 0x9e, 0x98, 0x9e, 0x9e, 0x9e, 0x9e, 0x9d, 0x98, 0x9b, 0xc2, 0xf8, 0xa0, 0x8f, 0xda, 0xec, 0xfd, 0xfe, 0xf4, 0xf3, 0xed, 0xec, 0xec, 0xf3, 0xfc, 0xfc, 0xf5, 0xf8, 0xb8, 0x7b, 0x89, 0xe6, 0xee, 0xed, 0xf4, 0xf4, 0xed, 0xed, 0xed, 0xf4, 0xf4, 0xea, 0xea, 0xf5, 0xfb, 0xf7, 0xf4, 0xf1, 0xd1, 0x5f, 0x7f, 0xe5, 0xf0, 0xed, 0xf0, 0xf3, 0xf5, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfb, 0xf4, 0xfe, 0xea, 0xef, 0xe5, 0x70, 0x6a, 0xdc, 0xf6, 0xf4, 0xf3, 0xea, 0xf3, 0xed, 0xf6, 0xf4, 0xf7, 0xf4, 0xf6, 0xf4, 0xf4, 0xed, 0xf6, 0xf4, 0xf3, 0xf9, 0xda, 0x87, 0x89, 0xa1, 0xf1, 0xf6, 0xfd, 0xfe, 0xed, 0xea, 0xed, 0xf5, 0xed, 0xed, 0xee, 0xfb, 0xed, 0xec, 0xcc, 0x92, 0xd2, 0xa7, 0xe7, 0xdb, 0xa0, 0x9d, 0x9d, 0x9e, 0xa2, 0xa2, 0xa2, 0x9e, 0xa2, 0xa3, 0x9e, 0x9e, 0xa7, 0xe3, 0xf0, 0xf4, 0xf6, 0xf4, 0xf0, 0xd7, 0x95, 0x9e, 0x98, 0x9e, 0x98, 0x9e, 0x9e, 0x9b, 0x9e, 0x98, 0xa3, 0x95, 0xb8, 0xf8, 0xa9, 0x8d, 0xd1, 0xec, 0xed, 0xfe, 0xfe, 0xf4, 0xec, 0xe9, 0xe6, 0xfc, 0xfc, 0xfc, 0xec, 0xe3, 0x84, 0x77, 0xce, 0xf8, 0xf4, 0xed, 0xed, 0xed, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xea, 0xea, 0xf5, 0xf6, 0xf4, 0xf1, 0xeb, 0x63, 0x59, 0xde, 0xf9, 0xf3, 0xf3, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xfb, 0xf6, 0xf2, 0xed, 0xee, 0xb5, 0x5f, 0x86, 0xf8, 0xed, 0xec, 0xf6, 0xf3, 0xf4, 0xf4, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf3, 0xf4, 0xfb, 0xec, 0xa1, 0x84, 0x89, 0xde, 0xec, 0xed, 0xff, 0xf5, 0xea, 0xee, 0xf5, 0xed, 0xed, 0xf6, 0xf5, 0xee, 0xf1, 0xb0, 0x92, 0xd8, 0xa9, 0xe1, 0xe1, 0xa0, 0x9d, 0x9d, 0xa4, 0xa2, 0xa2, 0x9e, 0xa2, 0xa2, 0x9e, 0xa3, 0x9e, 0xa0, 0xe7, 0xee, 0xf6, 0xf6, 0xf5, 0xf0, 0xde, 0x95, 0x98, 0x98, 0x9d, 0x98, 0x9b, 0x9e, 0x9e, 0x9e, 0x98, 0xa3, 0x95, 0xb8, 0xf9, 0xb7, 0x8d, 0xc2, 0xf0, 0xed, 0xfb, 0xf5, 0xf3, 0xf4, 0xec, 0xed, 0xef, 0xfc, 0xfb, 0xf8, 0xb8, 0x74, 0x8e, 0xe6, 0xf1, 0xed, 0xf4, 0xed, 0xf3, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xed, 0xed, 0xed, 0xed, 0xec, 0xf1, 0x90, 0x57, 0x94, 0xf8, 0xf3, 0xf3, 0xf6, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfb, 0xf3, 0xfe, 0xf5, 0xea, 0xee, 0xe9, 0x70, 0x57, 0xd5, 0xec, 0xec, 0xed, 0xf7, 0xf6, 0xf5, 0xed, 0xec, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf0, 0xf0, 0xf0, 0xd7, 0x7b, 0x7b, 0xc0, 0xf0, 0xea, 0xed, 0xf6, 0xf4, 0xf5, 0xf5, 0xed, 0xed, 0xf4, 0xf6, 0xf0, 0xe9, 0x8e, 0x92, 0xd8, 0xbd, 0xce, 0xe7, 0xa9, 0x9b, 0x9d, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0x9e, 0x9b, 0xa7, 0xe9, 0xed, 0xee, 0xf4, 0xed, 0xed, 0xe1, 0xa0, 0x98, 0x98, 0x98, 0x98, 0x9e, 0x9e, 0x9e, 0x9d, 0x9d, 0x9e, 0x95, 0xc2, 0xf8, 0xc0, 0x7e, 0xa7, 0xf1, 0xec, 0xf5, 0xfb, 0xf4, 0xf3, 0xed, 0xfe, 0xf2, 0xfd, 0xf1, 0xe6, 0x77, 0x74, 0xc9, 0xf8, 0xee, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf5, 0xf5, 0xf5, 0xed, 0xe9, 0xf9, 0xb2, 0x22, 0x66, 0xe9, 0xec, 0xf6, 0xf4, 0xf3, 0xf6, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf4, 0xf3, 0xf5, 0xed, 0xea, 0xf8, 0xb2, 0x63, 0x70, 0xe9, 0xec, 0xf6, 0xfb, 0xf7, 0xf5, 0xea, 0xea, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf6, 0xf2, 0xf6, 0xe9, 0xf1, 0x8e, 0x7b, 0x84, 0xe9, 0xea, 0xed, 0xf4, 0xf6, 0xf4, 0xf5, 0xed, 0xed, 0xf4, 0xf5, 0xf0, 0xe3, 0x78, 0x8f, 0xdb, 0xcb, 0xb0, 0xf1, 0xb9, 0x95, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xeb, 0xee, 0xed, 0xf4, 0xf4, 0xf0, 0xe3, 0xa0, 0x92, 0x98, 0x98, 0x9d, 0x9e, 0x98, 0x9e, 0x98, 0x9d, 0x98, 0x9a, 0xc2, 0xf9, 0xc0, 0x45, 0x94, 0xeb, 0xe9, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xfe, 0xfe, 0xf0, 0xf1, 0xb8, 0x6a, 0x89, 0xf0, 0xf5, 0xf5, 0xed, 0xf5, 0xed, 0xf5, 0xed, 0xf5, 0xed, 0xf5, 0xed, 0xfc, 0xf5, 0xec, 0xee, 0xe1, 0x63, 0x17, 0xcd, 0xf8, 0xf4, 0xf0, 0xf4, 0xf6, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xfb, 0xf3, 0xf3, 0xf5, 0xea, 0xf0, 0xed, 0xe9, 0x70, 0x59, 0xb5, 0xf8, 0xed, 0xfb, 0xfc, 0xf5, 0xed, 0xea, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf8, 0xc9, 0x74, 0x6a, 0xd5, 0xec, 0xee, 0xf3, 0xf7, 0xf5, 0xf5, 0xed, 0xed, 0xf6, 0xee, 0xfd, 0xda, 0x63, 0x8d, 0xe0, 0xd1, 0xa1, 0xeb, 0xce, 0x95, 0x9e, 0x9e, 0xa3, 0x9e, 0xa2, 0x9e, 0xa2, 0x9e, 0xa3, 0x9b, 0xa7, 0xeb, 0xec, 0xed, 0xed, 0xf4, 0xee, 0xe7, 0xa0, 0x98, 0x9d, 0x98, 0x98, 0x98, 0x9e, 0x98, 0x9d, 0x9d, 0x98, 0x9a, 0xcf, 0xf9, 0xc8, 0x33, 0x89, 0xec, 0xec, 0xf3, 0xf4, 0xfb, 0xf4, 0xfb, 0xfe, 0xff, 0xec, 0xe3, 0x74, 0x29, 0xc9, 0xf0, 0xff, 0xfe, 0xf5, 0xed, 0xf5, 0xed, 0xf5, 0xed, 0xf5, 0xed, 0xf5, 0xfb, 0xf5, 0xec, 0xef, 0x8e, 0x12, 0x70, 0xf8, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfb, 0xf4, 0xf3, 0xf3, 0xee, 0xf3, 0xed, 0xed, 0xf9, 0xc9, 0x14, 0x63, 0xec, 0xf8, 0xf3, 0xf6, 0xf4, 0xed, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xec, 0xec, 0x74, 0x59, 0x8e, 0xf8, 0xed, 0xf6, 0xf3, 0xf6, 0xf5, 0xed, 0xed, 0xf4, 0xf6, 0xf8, 0xcd, 0x57, 0x89, 0xdb, 0xdb, 0x94, 0xe1, 0xe1, 0x95, 0x9b, 0xa2, 0x98, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0xa3, 0x9b, 0xae, 0xeb, 0xed, 0xec, 0xf4, 0xf4, 0xf1, 0xe9, 0xa7, 0x92, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9e, 0x98, 0x9e, 0x93, 0xa0, 0xc9, 0xf9, 0xc0, 0x16, 0x78, 0xe9, 0xec, 0xed, 0xfb, 0xed, 0xf3, 0xf4, 0xfc, 0xef, 0xf9, 0xa1, 0x57, 0x7b, 0xe7, 0xf0, 0xfe, 0xf2, 0xee, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xfd, 0xf3, 0xf9, 0xcd, 0x12, 0x57, 0xd6, 0xf8, 0xf2, 0xfd, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf2, 0xf0, 0xf5, 0xf0, 0xf2, 0xf9, 0x22, 0x0d, 0xb2, 0xf8, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xee, 0xe8, 0xf8, 0xa1, 0x12, 0x63, 0xe8, 0xee, 0xf6, 0xf3, 0xf5, 0xf5, 0xed, 0xed, 0xf4, 0xf5, 0xf8, 0xb2, 0x16, 0x89, 0xe1, 0xde, 0x94, 0xdb, 0xeb, 0xb6, 0x9b, 0x9b, 0xa4, 0x9e, 0xa2, 0x9b, 0xa2, 0x9d, 0x9e, 0x9b, 0xa9, 0xec, 0xec, 0xec, 0xed, 0xf4, 0xed, 0xeb, 0xae, 0x92, 0x9d, 0x93, 0x98, 0x98, 0x98, 0x98, 0x9d, 0x98, 0xa4, 0x89, 0xc5, 0xf9, 0xb8, 0x08, 0x70, 0xe9, 0xec, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xfc, 0xee, 0xee, 0x63, 0x14, 0xaa, 0xf1, 0xf3, 0xfe, 0xff, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf5, 0xf0, 0xf8, 0x70, 0x0d, 0x86, 0xf1, 0xee, 0xf5, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xfb, 0xed, 0xf3, 0xf4, 0xf8, 0xf2, 0xf5, 0xfd, 0xf9, 0xb2, 0x0f, 0x56, 0xe8, 0xee, 0xec, 0xf6, 0xf7, 0xf7, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xef, 0xee, 0xdc, 0x17, 0x0d, 0xbe, 0xf9, 0xf5, 0xf3, 0xf5, 0xf5, 0xed, 0xed, 0xf4, 0xfb, 0xf9, 0x90, 0x14, 0x74, 0xe7, 0xe7, 0xaa, 0x94, 0xd4, 0xc2, 0xa0, 0x9b, 0xa3, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0xa3, 0x9b, 0xae, 0xeb, 0xec, 0xea, 0xed, 0xed, 0xf6, 0xeb, 0xb6, 0x92, 0x98, 0x93, 0x9d, 0x98, 0x98, 0x98, 0x98, 0x98, 0xc6, 0x1c, 0xcd, 0xf9, 0xaa, 0x03, 0x66, 0xe8, 0xf0, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xf8, 0xb5, 0x08, 0x57, 0xe5, 0xf1, 0xf6, 0xf2, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf4, 0xed, 0xf0, 0xbe, 0x0d, 0x53, 0xe1, 0xf0, 0xed, 0xef, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf2, 0xf6, 0xf5, 0xf6, 0xee, 0xf2, 0x56, 0x0a, 0xac, 0xf9, 0xec, 0xf3, 0xf7, 0xfb, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xef, 0xec, 0xec, 0x66, 0x4e, 0x82, 0xf9, 0xf3, 0xed, 0xf5, 0xf5, 0xed, 0xf4, 0xf3, 0xef, 0xf8, 0x90, 0x0d, 0x6a, 0xf1, 0xe1, 0xb5, 0x78, 0xd4, 0xa7, 0x89, 0xa8, 0x9d, 0x9d, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x9b, 0xae, 0xec, 0xea, 0xec, 0xed, 0xf4, 0xed, 0xf1, 0xb6, 0x92, 0x93, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0xa4, 0xab, 0x0e, 0xd6, 0xf9, 0x9f, 0x01, 0x64, 0xe8, 0xee, 0xf3, 0xf4, 0xf3, 0xf3, 0xed, 0xf0, 0xec, 0x66, 0x05, 0x79, 0xf8, 0xec, 0xf4, 0xf5, 0xf5, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xed, 0xf4, 0xf4, 0xed, 0xee, 0xf8, 0x22, 0x4e, 0x86, 0xf8, 0xe9, 0xf5, 0xe8, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf6, 0xf5, 0xf4, 0xf9, 0x96, 0x01, 0x5a, 0xf9, 0xed, 0xee, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xed, 0xee, 0xe8, 0xf9, 0x91, 0x02, 0x52, 0xf8, 0xee, 0xec, 0xf5, 0xf5, 0xf6, 0xf4, 0xf4, 0xf4, 0xf8, 0x86, 0x08, 0x64, 0xf8, 0xe5, 0xc5, 0x63, 0xd7, 0xd1, 0x6a, 0x92, 0xa4, 0x9c, 0x9d, 0xa3, 0x98, 0x9e, 0x9e, 0x9b, 0xae, 0xf1, 0xea, 0xed, 0xf4, 0xf5, 0xf4, 0xf1, 0xb7, 0x92, 0x98, 0x93, 0x98, 0x95, 0x98, 0x93, 0x9c, 0xa4, 0x7e, 0x0b, 0xdf, 0xf9, 0x96, 0x01, 0x55, 0xf2, 0xf0, 0xf3, 0xf4, 0xed, 0xed, 0xf4, 0xf8, 0xd0, 0x07, 0x4e, 0xbe, 0xf9, 0xed, 0xec, 0xed, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xbe, 0x01, 0x51, 0xd9, 0xf0, 0xf4, 0xed, 0xed, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xee, 0xf6, 0xf0, 0xf0, 0xe4, 0x4f, 0x07, 0xca, 0xf8, 0xee, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf6, 0xed, 0xed, 0xec, 0xf9, 0xcd, 0x02, 0x02, 0xd6, 0xf9, 0xea, 0xf5, 0xf4, 0xf5, 0xf6, 0xf4, 0xee, 0xf8, 0x75, 0x05, 0x56, 0xf8, 0xec, 0xd4, 0x17, 0xcc, 0xd7, 0x6a, 0x32, 0x8b, 0xa4, 0x9d, 0x9d, 0x9b, 0x9e, 0x9e, 0x9b, 0xb7, 0xec, 0xec, 0xec, 0xf4, 0xf6, 0xed, 0xf1, 0xbd, 0x92, 0x93, 0x93, 0x98, 0x93, 0x9c, 0x9c, 0x85, 0x83, 0x1a, 0x14, 0xe9, 0xf9, 0x91, 0x01, 0x55, 0xe8, 0xf0, 0xed, 0xed, 0xf4, 0xed, 0xee, 0xf9, 0x79, 0x01, 0x53, 0xe4, 0xf0, 0xed, 0xea, 0xec, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf3, 0xf6, 0xed, 0x5a, 0x01, 0x79, 0xf9, 0xed, 0xed, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xf4, 0xf4, 0xfd, 0xf9, 0x64, 0x02, 0x75, 0xf8, 0xf0, 0xf3, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xee, 0xed, 0xee, 0xf8, 0xe4, 0x50, 0x01, 0xac, 0xf9, 0xed, 0xf6, 0xf5, 0xf4, 0xf6, 0xf6, 0xf2, 0xf9, 0x70, 0x02, 0x17, 0xf8, 0xf1, 0xe5, 0x0f, 0xaa, 0xeb, 0x77, 0x1e, 0x28, 0x81, 0x98, 0xa4, 0xa4, 0x9b, 0x9e, 0x9b, 0xb7, 0xf1, 0xea, 0xed, 0xed, 0xf5, 0xed, 0xf1, 0xb7, 0x92, 0x93, 0x9c, 0x9c, 0x9c, 0x8b, 0x49, 0x3a, 0x45, 0x11, 0x22, 0xe9, 0xf9, 0x82, 0x01, 0x54, 0xf2, 0xf8, 0xed, 0xf4, 0xed, 0xf4, 0xee, 0xef, 0x50, 0x01, 0x79, 0xf8, 0xf0, 0xed, 0xed, 0xf3, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf4, 0xf6, 0xf9, 0xc7, 0x01, 0x4d, 0xd0, 0xf9, 0xf3, 0xf3, 0xf4, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xee, 0xf6, 0xf3, 0xf8, 0xf8, 0xbe, 0x4c, 0x0f, 0xdf, 0xf9, 0xf3, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xee, 0xee, 0xed, 0xf0, 0xf9, 0x5a, 0x01, 0x71, 0xf0, 0xef, 0xf4, 0xf5, 0xf5, 0xf4, 0xf4, 0xf3, 0xf9, 0x69, 0x02, 0x54, 0xf8, 0xf1, 0xf8, 0x17, 0x78, 0xe7, 0x8e, 0x5b, 0x2c, 0x1d, 0x2c, 0x4a, 0x98, 0xa4, 0x9e, 0x9b, 0xc0, 0xec, 0xee, 0xec, 0xf4, 0xf5, 0xed, 0xf1, 0xae, 0x80, 0x8a, 0x81, 0x49, 0x43, 0x3b, 0x35, 0x3f, 0x2a, 0x09, 0x7f, 0xec, 0xf9, 0x79, 0x01, 0x54, 0xf5, 0xf0, 0xf4, 0xed, 0xf4, 0xed, 0xf9, 0xbe, 0x01, 0x01, 0xca, 0xf9, 0xed, 0xed, 0xf3, 0xec, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf3, 0xf5, 0xf4, 0xee, 0xf9, 0x5a, 0x01, 0x64, 0xf8, 0xed, 0xf3, 0xed, 0xf4, 0xf4, 0xf3, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xf5, 0xf9, 0xdf, 0x0f, 0x04, 0xbe, 0xf9, 0xf4, 0xf6, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xed, 0xf2, 0xef, 0xf9, 0x75, 0x01, 0x55, 0xed, 0xf0, 0xed, 0xf4, 0xf4, 0xf5, 0xf6, 0xee, 0xf9, 0x6d, 0x01, 0x0f, 0xf8, 0xed, 0xf9, 0x66, 0x12, 0xde, 0xa0, 0x25, 0x62, 0x2c, 0x62, 0x60, 0x2a, 0x4a, 0x98, 0xa2, 0xc8, 0xec, 0xee, 0xf4, 0xed, 0xf5, 0xed, 0xf1, 0xa0, 0x2e, 0x6b, 0x68, 0x38, 0x3b, 0x3a, 0x34, 0x49, 0x1a, 0x06, 0x97, 0xf8, 0xf9, 0x71, 0x01, 0x55, 0xf3, 0xef, 0xed, 0xf5, 0xed, 0xee, 0xf9, 0x79, 0x01, 0x4d, 0xe4, 0xf0, 0xed, 0xed, 0xed, 0xf3, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf8, 0xf3, 0xf3, 0xf0, 0xf5, 0x01, 0x01, 0xb1, 0xf9, 0xf5, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf3, 0xf0, 0xee, 0xf9, 0x79, 0x01, 0x6d, 0xf9, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf3, 0xed, 0xf9, 0x91, 0x01, 0x51, 0xd9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf3, 0xf6, 0xf6, 0xf9, 0x69, 0x01, 0x52, 0xf0, 0xf1, 0xf9, 0x8e, 0x0a, 0xc5, 0xbd, 0x25, 0x24, 0x2a, 0x62, 0x26, 0x62, 0x5d, 0x5c, 0x33, 0xc0, 0xf8, 0xe8, 0xed, 0xed, 0xee, 0xea, 0xf1, 0x95, 0x2e, 0x6e, 0x35, 0x3b, 0x3b, 0x34, 0x3a, 0x3c, 0x11, 0x09, 0xcd, 0xec, 0xf9, 0x64, 0x01, 0x55, 0xef, 0xee, 0xee, 0xed, 0xf3, 0xee, 0xee, 0x53, 0x01, 0x55, 0xf9, 0xee, 0xf3, 0xf3, 0xf3, 0xed, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf2, 0xee, 0xf6, 0xf9, 0x8c, 0x01, 0x50, 0xf8, 0xf0, 0xe8, 0xf4, 0xed, 0xf4, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf3, 0xf9, 0xbe, 0x01, 0x52, 0xe4, 0xf0, 0xf7, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf9, 0xbe, 0x00, 0xfa, 0xca, 0xf8, 0xee, 0xf4, 0xf4, 0xf5, 0xfb, 0xef, 0xf9, 0x69, 0x01, 0x52, 0xf4, 0xf0, 0xf9, 0xbe, 0x06, 0x90, 0xd2, 0x25, 0x24, 0x62, 0x62, 0x2a, 0x2a, 0x24, 0x2a, 0x58, 0x94, 0xf0, 0xef, 0xed, 0xed, 0xf5, 0xee, 0xec, 0x8d, 0x31, 0x38, 0x34, 0x3b, 0x30, 0x34, 0x3c, 0x2a, 0x0e, 0x0e, 0xe5, 0xee, 0xf8, 0x5e, 0x01, 0x56, 0xfd, 0xf0, 0xee, 0xed, 0xf4, 0xee, 0xdd, 0x4e, 0x01, 0x82, 0xf9, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf3, 0xf4, 0x54, 0x01, 0x69, 0xf9, 0xf5, 0xee, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xee, 0xf8, 0xe4, 0x50, 0x02, 0xb1, 0xf9, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf3, 0xf9, 0xd3, 0x4d, 0x01, 0xa5, 0xf9, 0xed, 0xf4, 0xf4, 0xf4, 0xff, 0xf6, 0xf9, 0x64, 0x01, 0x51, 0xf6, 0xf0, 0xef, 0xda, 0x0f, 0x63, 0xd8, 0x65, 0x21, 0x62, 0x24, 0x62, 0x62, 0x24, 0x23, 0x1c, 0xa7, 0xf8, 0xf2, 0xed, 0xed, 0xee, 0xec, 0xe6, 0x7e, 0x2c, 0x38, 0x2d, 0x3b, 0x68, 0x6e, 0x6c, 0x58, 0x0c, 0x57, 0xf0, 0xf1, 0xf8, 0x54, 0x01, 0x5a, 0xf8, 0xf0, 0xee, 0xf4, 0xed, 0xf9, 0xb1, 0x01, 0x4c, 0xc7, 0xf9, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf9, 0xca, 0x04, 0x01, 0xca, 0xf9, 0xee, 0xed, 0xf4, 0xed, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xf3, 0xee, 0xf2, 0xf6, 0xf3, 0xf0, 0xf9, 0x5e, 0x01, 0x75, 0xf9, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf8, 0xdd, 0x51, 0x01, 0x91, 0xf9, 0xf4, 0xf6, 0xf3, 0xf5, 0xfb, 0xf5, 0xf9, 0x64, 0x01, 0x51, 0xff, 0xed, 0xf8, 0xe5, 0x56, 0x17, 0xd8, 0x33, 0x5d, 0x62, 0x62, 0x24, 0x24, 0x24, 0x2a, 0x1f, 0xa7, 0xf8, 0xff, 0xed, 0xed, 0xf5, 0xee, 0xe6, 0x77, 0x2c, 0x38, 0x30, 0x34, 0x34, 0x6b, 0x6c, 0x11, 0x10, 0x70, 0xf8, 0xee, 0xf1, 0x53, 0x01, 0x5e, 0xf8, 0xf0, 0xf2, 0xf0, 0xf4, 0xf9, 0x79, 0x01, 0x50, 0xdf, 0xf8, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf9, 0x75, 0x01, 0x52, 0xe8, 0xf0, 0xed, 0xf5, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf6, 0xee, 0xf2, 0xf0, 0xf9, 0x8c, 0x01, 0x54, 0xef, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf0, 0xe4, 0x53, 0x01, 0x79, 0xf9, 0xee, 0xf6, 0xf4, 0xf4, 0xee, 0xf5, 0xf9, 0x5e, 0x01, 0x51, 0xee, 0xee, 0xec, 0xf0, 0x66, 0x0d, 0xd5, 0x42, 0x5b, 0x62, 0x26, 0x24, 0x24, 0x24, 0x24, 0x1c, 0xb8, 0xf0, 0xed, 0xf4, 0xed, 0xed, 0xee, 0xe3, 0x42, 0x2c, 0x68, 0x34, 0x2b, 0x35, 0x3c, 0x21, 0x11, 0x10, 0x99, 0xf8, 0xed, 0xf5, 0x52, 0x01, 0x5e, 0xf9, 0xf0, 0xf4, 0xee, 0xf4, 0xf9, 0x5a, 0x01, 0x55, 0xf6, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf6, 0xf2, 0xef, 0xf9, 0x52, 0x01, 0x71, 0xf9, 0xf4, 0xf5, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xee, 0xf6, 0xf3, 0xf5, 0xf9, 0xc7, 0xfa, 0x01, 0xdd, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf0, 0xf2, 0x55, 0x01, 0x69, 0xf9, 0xee, 0xf6, 0xf6, 0xf4, 0xed, 0xed, 0xef, 0x5a, 0x01, 0x53, 0xef, 0xee, 0xe9, 0xf9, 0x86, 0x0a, 0xcf, 0x77, 0x5b, 0x61, 0x61, 0x62, 0x24, 0x27, 0x61, 0x1c, 0xc5, 0xf0, 0xee, 0xf3, 0xee, 0xed, 0xec, 0xd7, 0x65, 0x67, 0x2b, 0x38, 0x28, 0x35, 0x36, 0x18, 0x11, 0x17, 0xc9, 0xf8, 0xf3, 0xf3, 0x51, 0x01, 0x5e, 0xf9, 0xf4, 0xf4, 0xf6, 0xee, 0xf2, 0x51, 0x01, 0x71, 0xf9, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xef, 0xf9, 0xd6, 0x4d, 0x01, 0xbe, 0xf9, 0xf3, 0xf4, 0xf4, 0xee, 0xf3, 0xf4, 0xf3, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf9, 0xdf, 0x4f, 0x01, 0xbe, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf6, 0xee, 0x5e, 0x01, 0x64, 0xf9, 0xf0, 0xf6, 0xf4, 0xf4, 0xed, 0xee, 0xed, 0x55, 0x01, 0x54, 0xef, 0xf0, 0xea, 0xf8, 0xac, 0x05, 0xcf, 0x77, 0x5b, 0x5d, 0x61, 0x24, 0x24, 0x24, 0x26, 0x1c, 0xcf, 0xf8, 0xee, 0xed, 0xf6, 0xea, 0xf0, 0xcf, 0x61, 0x31, 0x2b, 0x2f, 0x2b, 0x31, 0x28, 0x11, 0x15, 0x57, 0xe1, 0xf7, 0xf5, 0xe8, 0x50, 0x01, 0x64, 0xf9, 0xf4, 0xf0, 0xf5, 0xf8, 0xd9, 0x4c, 0x01, 0x91, 0xf9, 0xf5, 0xf2, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0x9f, 0x01, 0x01, 0xf2, 0xf0, 0xf3, 0xf4, 0xf0, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf6, 0xf3, 0xf4, 0xf4, 0xee, 0xf0, 0xef, 0x55, 0x01, 0x82, 0xf9, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf6, 0xf8, 0x69, 0x01, 0x55, 0xf9, 0xf6, 0xf0, 0xf4, 0xf4, 0xed, 0xee, 0xe8, 0x53, 0x01, 0x5a, 0xf9, 0xef, 0xec, 0xf8, 0xcd, 0x0f, 0xd4, 0x77, 0x5d, 0x60, 0x26, 0x23, 0x24, 0x23, 0x5d, 0x1e, 0xd7, 0xee, 0xed, 0xf4, 0xf3, 0xea, 0xf0, 0xa9, 0x25, 0x2c, 0x68, 0x2b, 0x68, 0x31, 0x1b, 0x11, 0x11, 0x78, 0xf1, 0xf4, 0xf8, 0xe2, 0x4f, 0x01, 0x64, 0xf9, 0xf6, 0xf0, 0xf5, 0xf9, 0xb1, 0x4d, 0x01, 0xb1, 0xf9, 0xf6, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xee, 0xf9, 0x71, 0x01, 0x52, 0xf9, 0xf6, 0xf0, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf2, 0xf5, 0xf4, 0xee, 0xf4, 0xf4, 0xf6, 0xf6, 0xf5, 0xf9, 0x69, 0x01, 0x64, 0xf9, 0xf6, 0xf4, 0xf5, 0xf6, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xee, 0xf8, 0x69, 0x01, 0x55, 0xf9, 0xf0, 0xf6, 0xf4, 0xf4, 0xed, 0xf0, 0xe2, 0x51, 0x01, 0x64, 0xf9, 0xed, 0xec, 0xf0, 0xdf, 0x22, 0xde, 0x6f, 0x5b, 0x24, 0x21, 0x24, 0x23, 0x24, 0x1f, 0x29, 0xde, 0xec, 0xf6, 0xed, 0xe8, 0xec, 0xec, 0x8d, 0x60, 0x28, 0x68, 0x2b, 0x31, 0x2b, 0x15, 0x18, 0x0e, 0x94, 0xf8, 0xf2, 0xf0, 0xe2, 0x4f, 0x01, 0x64, 0xf9, 0xf0, 0xf0, 0xf6, 0xf9, 0x91, 0x4c, 0x01, 0xd3, 0xf9, 0xf2, 0xf5, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xfd, 0xef, 0x54, 0x01, 0x71, 0xf9, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf9, 0x82, 0x01, 0x52, 0xe4, 0xf8, 0xf5, 0xf3, 0xf3, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf5, 0xf5, 0xf9, 0x69, 0x01, 0x53, 0xf9, 0xf0, 0xf4, 0xf6, 0xee, 0xee, 0xf8, 0xd6, 0x4f, 0x01, 0x71, 0xf9, 0xf3, 0xed, 0xf1, 0xec, 0xd3, 0xe6, 0x65, 0x60, 0x5d, 0x24, 0x21, 0x23, 0x5d, 0x1c, 0x6f, 0xe3, 0xf8, 0xf5, 0xf4, 0xe8, 0xf1, 0xe3, 0x42, 0x62, 0x2f, 0x2b, 0x2c, 0x31, 0x24, 0x11, 0x18, 0x10, 0xcf, 0xf8, 0xfb, 0xf0, 0xe4, 0x50, 0x01, 0x64, 0xf8, 0xf8, 0xf6, 0xee, 0xf9, 0x79, 0xfa, 0x04, 0xe2, 0xf8, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf9, 0xdd, 0x50, 0x01, 0xa5, 0xf9, 0xf4, 0xf5, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf9, 0x9f, 0x01, 0x4e, 0xd6, 0xf9, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf6, 0xf8, 0x69, 0x01, 0x54, 0xf9, 0xf0, 0xf4, 0xf4, 0xf6, 0xed, 0xf9, 0xca, 0x4c, 0x01, 0x8c, 0xf9, 0xed, 0xed, 0xf3, 0xee, 0xf1, 0xe6, 0x5f, 0x5d, 0x21, 0x21, 0x23, 0x21, 0x60, 0x1c, 0x77, 0xe9, 0xee, 0xf2, 0xf6, 0xe9, 0xef, 0xd5, 0x25, 0x2c, 0x2b, 0x2b, 0x2c, 0x35, 0x18, 0x18, 0x15, 0x59, 0xe5, 0xf8, 0xf6, 0xfd, 0xe5, 0x50, 0x01, 0x5e, 0xf9, 0xf0, 0xf4, 0xf4, 0xf9, 0x69, 0x04, 0x4e, 0xf5, 0xf8, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf9, 0xbe, 0xfa, 0x4c, 0xd0, 0xf8, 0xf4, 0xf4, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfb, 0xf4, 0xf3, 0xfb, 0xf4, 0xf3, 0xfb, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf9, 0xc7, 0x01, 0x01, 0xc7, 0xf9, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf6, 0xf9, 0x64, 0x01, 0x54, 0xf9, 0xf6, 0xf4, 0xf6, 0xf4, 0xee, 0xf9, 0xa5, 0x03, 0x01, 0x9f, 0xf9, 0xed, 0xf4, 0xf4, 0xf3, 0xf0, 0xda, 0x5f, 0x5c, 0x23, 0x21, 0x20, 0x21, 0x5d, 0x1a, 0x89, 0xf8, 0xea, 0xfe, 0xf3, 0xed, 0xf8, 0xa9, 0x1f, 0x28, 0x2b, 0x2b, 0x31, 0x2a, 0x18, 0x58, 0x15, 0x78, 0xf8, 0xf6, 0xf7, 0xee, 0xe8, 0x51, 0x01, 0x5a, 0xf8, 0xf6, 0xee, 0xf6, 0xf9, 0x5e, 0x01, 0x51, 0xf9, 0xef, 0xf3, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf9, 0x91, 0x01, 0x51, 0xe2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf9, 0xd9, 0x4d, 0x01, 0x9f, 0xf9, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xee, 0xf0, 0x64, 0x01, 0x55, 0xf9, 0xf0, 0xf4, 0xf4, 0xf6, 0xed, 0xf9, 0x82, 0x01, 0x01, 0xca, 0xf9, 0xed, 0xf4, 0xf3, 0xf7, 0xf8, 0xcd, 0x1c, 0x21, 0x23, 0x1d, 0x21, 0x21, 0x5b, 0x1a, 0xa7, 0xf8, 0xe8, 0xee, 0xf2, 0xec, 0xe9, 0x7b, 0x26, 0x2b, 0x2b, 0x28, 0x62, 0x5b, 0x1b, 0x58, 0x15, 0xb8, 0xf8, 0xf4, 0xfd, 0xf0, 0xed, 0x53, 0x01, 0x55, 0xf5, 0xf0, 0xf6, 0xf8, 0xf8, 0x5a, 0x01, 0x54, 0xf9, 0xf3, 0xf5, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf9, 0x71, 0x01, 0x55, 0xef, 0xf6, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfb, 0xf3, 0xf4, 0xfb, 0xf3, 0xf4, 0xfb, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf8, 0xe4, 0x50, 0x01, 0x8c, 0xf9, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf6, 0xef, 0x5e, 0x01, 0x55, 0xf9, 0xf0, 0xf4, 0xf6, 0xee, 0xee, 0xf9, 0x69, 0x01, 0x4d, 0xdd, 0xef, 0xed, 0xf4, 0xf6, 0xf3, 0xf8, 0xaa, 0x19, 0x62, 0x1d, 0x21, 0x20, 0x21, 0x5b, 0x1a, 0xcc, 0xf8, 0xec, 0xf5, 0xf3, 0xf1, 0xde, 0x29, 0x61, 0x28, 0x27, 0x2b, 0x24, 0x58, 0x5c, 0x58, 0x1e, 0xdc, 0xf0, 0xf3, 0xf7, 0xf0, 0xf8, 0x53, 0x01, 0x54, 0xfe, 0xf8, 0xf4, 0xf8, 0xf9, 0x54, 0x02, 0x55, 0xf9, 0xf3, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf6, 0xf9, 0x5a, 0x01, 0x71, 0xf9, 0xf4, 0xf4, 0xf4, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xed, 0xec, 0xed, 0xf3, 0xf3, 0xf4, 0xee, 0xe8, 0xee, 0xea, 0xed, 0xf3, 0xf4, 0xfc, 0xf4, 0xed, 0xec, 0xf4, 0xfc, 0xfb, 0xf4, 0xf4, 0xf4, 0xf5, 0xee, 0xee, 0x53, 0x01, 0x75, 0xf9, 0xf4, 0xf3, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xef, 0xf5, 0x55, 0x01, 0x64, 0xf9, 0xf6, 0xf4, 0xf6, 0xf5, 0xef, 0xf9, 0x53, 0x01, 0x53, 0xed, 0xf1, 0xf4, 0xf6, 0xf4, 0xf0, 0xf0, 0x7f, 0x1a, 0x1f, 0x5b, 0x25, 0x5d, 0x5c, 0x5b, 0x1e, 0xda, 0xec, 0xf0, 0xf3, 0xf3, 0xf0, 0xa9, 0x58, 0x28, 0x28, 0x28, 0x62, 0x24, 0x23, 0x23, 0x1a, 0x7b, 0xee, 0xea, 0xf0, 0xed, 0xf8, 0xf9, 0x55, 0x01, 0x52, 0xe4, 0xf8, 0xf0, 0xf0, 0xf8, 0x53, 0x01, 0x5e, 0xf9, 0xee, 0xf2, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf5, 0xf0, 0xef, 0x53, 0x01, 0x91, 0xf9, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf5, 0xf5, 0xfb, 0xf5, 0xf3, 0xf3, 0xf6, 0xed, 0xee, 0xea, 0xed, 0xf4, 0xfb, 0xfb, 0xf4, 0xed, 0xec, 0xf4, 0xfb, 0xf7, 0xf4, 0xf4, 0xf4, 0xf5, 0xf6, 0xef, 0x55, 0x01, 0x64, 0xf9, 0xf6, 0xf3, 0xf6, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0xef, 0xe8, 0x53, 0x01, 0x64, 0xf9, 0xf6, 0xf4, 0xf6, 0xf5, 0xf9, 0xe8, 0x4f, 0x01, 0x5e, 0xf8, 0xf0, 0xf3, 0xf4, 0xf5, 0xf0, 0xe3, 0x6a, 0x1a, 0x21, 0x21, 0x5b, 0x1d, 0x5c, 0x58, 0x39, 0xe6, 0xee, 0xec, 0xf3, 0xed, 0xf1, 0x77, 0x26, 0x27, 0x28, 0x28, 0x62, 0x24, 0x23, 0x23, 0x1a, 0xb5, 0xf8, 0xea, 0xf0, 0xec, 0xf0, 0xf9, 0x64, 0x01, 0x51, 0xdf, 0xf8, 0xf0, 0xfd, 0xf9, 0x53, 0x01, 0x64, 0xf9, 0xf0, 0xf2, 0xee, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf8, 0xe2, 0x51, 0x01, 0xa5, 0xf9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfe, 0xfe, 0xfe, 0xfe, 0xf4, 0xee, 0xf1, 0xef, 0xec, 0xea, 0xea, 0xf5, 0xfb, 0xfb, 0xf3, 0xea, 0xea, 0xed, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xee, 0xf9, 0x5e, 0x01, 0x55, 0xf9, 0xf6, 0xf3, 0xee, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xef, 0xe2, 0x51, 0x01, 0x75, 0xf9, 0xf4, 0xf6, 0xf4, 0xf5, 0xf9, 0xd3, 0x01, 0x01, 0x8c, 0xf9, 0xf6, 0xf4, 0xf3, 0xed, 0xf8, 0xb8, 0x19, 0x26, 0x1b, 0x1d, 0x5b, 0x5c, 0x5d, 0x18, 0x8e, 0xec, 0xec, 0xe8, 0xf4, 0xf1, 0xd5, 0x1a, 0x62, 0x28, 0x28, 0x62, 0x62, 0x24, 0x24, 0x5b, 0x29, 0xe3, 0xee, 0xee, 0xec, 0xed, 0xf0, 0xf9, 0x75, 0x01, 0x50, 0xd9, 0xf9, 0xf6, 0xf0, 0xf8, 0x53, 0x01, 0x64, 0xf9, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf9, 0xd6, 0x4d, 0x01, 0xd0, 0xf9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xfe, 0xfe, 0xfe, 0xed, 0xf1, 0xf1, 0xe6, 0xe3, 0xec, 0xf0, 0xea, 0xed, 0xfe, 0xf4, 0xf5, 0xea, 0xea, 0xec, 0xf3, 0xf6, 0xf3, 0xf4, 0xf4, 0xf4, 0xee, 0xf9, 0x69, 0x01, 0x53, 0xf9, 0xf6, 0xf3, 0xf6, 0xf3, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf9, 0xd3, 0x4e, 0x01, 0x8c, 0xf9, 0xf6, 0xf6, 0xf3, 0xf5, 0xf9, 0x9f, 0x01, 0x01, 0xbe, 0xf8, 0xfb, 0xf6, 0xf3, 0xec, 0xec, 0x7b, 0x1a, 0x5b, 0x1d, 0x5c, 0x1d, 0x1d, 0x5c, 0x1a, 0xb8, 0xf0, 0xee, 0xf3, 0xed, 0xec, 0x97, 0x58, 0x24, 0x27, 0x28, 0x62, 0x28, 0x24, 0x62, 0x5b, 0x8e, 0xf1, 0xea, 0xed, 0xed, 0xed, 0xf6, 0xf9, 0x91, 0x01, 0x4d, 0xd0, 0xf8, 0xee, 0xf6, 0xf8, 0x53, 0x01, 0x69, 0xf9, 0xf3, 0xf5, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf9, 0xca, 0xfa, 0x01, 0xd9, 0xf9, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xff, 0xf5, 0xea, 0xf1, 0xda, 0xa1, 0x74, 0x5f, 0x6a, 0xd1, 0xf8, 0xed, 0xf3, 0xfd, 0xf5, 0xed, 0xea, 0xed, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xee, 0xf9, 0x71, 0x01, 0x50, 0xf9, 0xf6, 0xf5, 0xee, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf5, 0xf2, 0xf9, 0xc7, 0x00, 0x01, 0xa5, 0xf9, 0xf0, 0xf2, 0xf3, 0xee, 0xf9, 0x71, 0x01, 0x04, 0xdf, 0xf8, 0xfb, 0xf5, 0xe9, 0xf8, 0xce, 0x19, 0x1f, 0x1d, 0x20, 0x1b, 0x5c, 0x1d, 0x58, 0x1e, 0xda, 0xee, 0xf4, 0xee, 0xec, 0xdb, 0x29, 0x26, 0x27, 0x28, 0x27, 0x62, 0x62, 0x24, 0x61, 0x1e, 0xd4, 0xec, 0xed, 0xf6, 0xed, 0xed, 0xee, 0xf9, 0xb1, 0x01, 0x00, 0xbe, 0xf9, 0xf3, 0xf6, 0xef, 0x53, 0x01, 0x64, 0xf9, 0xf2, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xb1, 0x02, 0x04, 0xe8, 0xef, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xe8, 0xe9, 0xeb, 0xda, 0xa6, 0xa2, 0xaf, 0xa6, 0x7e, 0x29, 0xc5, 0xf8, 0xf4, 0xf6, 0xf5, 0xea, 0xed, 0xec, 0xf4, 0xf6, 0xf3, 0xf4, 0xf4, 0xf4, 0xee, 0xf9, 0x75, 0x01, 0x4f, 0xf9, 0xef, 0xf4, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf0, 0xf5, 0xf9, 0x9f, 0x01, 0x01, 0xc7, 0xf9, 0xf6, 0xf4, 0xf0, 0xef, 0xe4, 0x53, 0x01, 0x53, 0xf8, 0xfd, 0xfd, 0xf0, 0xec, 0xe9, 0x7b, 0x1a, 0x5b, 0x1d, 0x1d, 0x1b, 0x5c, 0x1b, 0x1a, 0x6f, 0xea, 0xee, 0xe8, 0xf0, 0xf8, 0xa0, 0x1f, 0x62, 0x27, 0x27, 0x62, 0x62, 0x5d, 0x23, 0x1f, 0x78, 0xf1, 0xec, 0xf5, 0xf4, 0xf3, 0xed, 0xf6, 0xf9, 0xd0, 0x01, 0x01, 0x96, 0xf9, 0xf4, 0xf6, 0xf9, 0x54, 0x01, 0x5e, 0xf9, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xee, 0xf4, 0xf9, 0x96, 0x01, 0x4e, 0xef, 0xf5, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xeb, 0xe6, 0xaf, 0xaf, 0xba, 0xba, 0xba, 0xc3, 0xa6, 0x78, 0xe1, 0xf8, 0xf2, 0xf3, 0xee, 0xea, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf9, 0x75, 0x01, 0x4e, 0xf9, 0xf0, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf0, 0xf5, 0xf9, 0x79, 0x01, 0x4f, 0xd6, 0xf9, 0xf2, 0xf6, 0xf4, 0xf9, 0xca, 0xfa, 0x01, 0x79, 0xf9, 0xf3, 0xfd, 0xec, 0xf8, 0xb0, 0x1a, 0x5b, 0x5c, 0x1d, 0x1d, 0x1d, 0x1d, 0x58, 0x1a, 0x8e, 0xf8, 0xe8, 0xf3, 0xe9, 0xf8, 0x25, 0x21, 0x62, 0x27, 0x27, 0x60, 0x2a, 0x26, 0x2c, 0x1a, 0xb8, 0xf8, 0xed, 0xfd, 0xf3, 0xf6, 0xed, 0xf6, 0xf8, 0xdd, 0x4d, 0x01, 0x79, 0xf9, 0xf4, 0xf8, 0xf9, 0x55, 0x01, 0x55, 0xf9, 0xf4, 0xf3, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf5, 0xf9, 0x8c, 0x01, 0x52, 0xf8, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xec, 0xeb, 0xcc, 0xae, 0xba, 0xba, 0xb3, 0xba, 0xb3, 0xc1, 0xa7, 0xb8, 0xeb, 0xf7, 0xee, 0xed, 0xed, 0xf5, 0xf7, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf9, 0x79, 0x01, 0x4d, 0xf9, 0xf0, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf3, 0xfd, 0xf9, 0x5e, 0x01, 0x53, 0xe4, 0xf8, 0xf4, 0xf6, 0xf3, 0xf9, 0x82, 0x01, 0x01, 0xb1, 0xf9, 0xf5, 0xf4, 0xed, 0xe6, 0x1e, 0x58, 0x21, 0x1d, 0x1d, 0x1d, 0x1b, 0x1f, 0x58, 0x16, 0xc2, 0xf9, 0xe8, 0xee, 0xf1, 0xc2, 0x1a, 0x2c, 0x24, 0x27, 0x62, 0x61, 0x60, 0x61, 0x5b, 0x39, 0xe5, 0xec, 0xf5, 0xfb, 0xf4, 0xf3, 0xed, 0xf7, 0xef, 0xfe, 0x52, 0x01, 0x5e, 0xf9, 0xf4, 0xef, 0xf9, 0x5e, 0x01, 0x51, 0xf9, 0xee, 0xf3, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xee, 0xf4, 0xf9, 0x79, 0x01, 0x54, 0xf9, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xed, 0xe9, 0xc2, 0xb7, 0xb3, 0xb3, 0xba, 0xbf, 0xbc, 0xaf, 0xb9, 0xb6, 0xe5, 0xf1, 0xed, 0xf5, 0xed, 0xf6, 0xfb, 0xf6, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf9, 0x79, 0x01, 0x4d, 0xf9, 0xf0, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf9, 0xef, 0x52, 0x01, 0x5e, 0xf8, 0xf0, 0xf0, 0xf4, 0xf8, 0xf9, 0x55, 0x01, 0x50, 0xdf, 0xef, 0xf6, 0xf0, 0xf1, 0x8e, 0x19, 0x5b, 0x5c, 0x1d, 0x1d, 0x1f, 0x1d, 0x1d, 0x18, 0x09, 0xc5, 0xf9, 0xf5, 0xec, 0xf6, 0x7b, 0x21, 0x24, 0x27, 0x24, 0x24, 0x61, 0x25, 0x61, 0x1b, 0xa0, 0xf1, 0xec, 0xfb, 0xfe, 0xf7, 0xf3, 0xf4, 0xf3, 0xff, 0xf8, 0x5e, 0x01, 0x53, 0xf9, 0xf0, 0xf4, 0xf9, 0x69, 0x01, 0x4e, 0xf8, 0xef, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf5, 0xf9, 0x75, 0x01, 0x5a, 0xf9, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf5, 0xf3, 0xf4, 0xf4, 0xf4, 0xed, 0xf4, 0xf3, 0xf3, 0xf4, 0xec, 0xda, 0xb6, 0xbc, 0xb3, 0xba, 0xaf, 0xbc, 0xb9, 0xbc, 0xaf, 0xb6, 0xe1, 0xf6, 0xed, 0xf4, 0xed, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xee, 0xf9, 0x75, 0x01, 0x4d, 0xf9, 0xf6, 0xee, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf6, 0xf4, 0xf8, 0xd9, 0x01, 0x01, 0x8c, 0xf9, 0xf6, 0xf6, 0xf6, 0xf9, 0xd9, 0x01, 0x01, 0x71, 0xf9, 0xf3, 0xed, 0xf8, 0x9a, 0x16, 0x5d, 0x5b, 0x1d, 0x1d, 0x1d, 0x1d, 0x1f, 0x1e, 0x0b, 0x01, 0x9f, 0xf9, 0xf3, 0xec, 0xd1, 0x1e, 0x60, 0x24, 0x21, 0x24, 0x24, 0x62, 0x60, 0x25, 0x59, 0xe3, 0xed, 0xee, 0xf2, 0xfd, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf9, 0x82, 0x01, 0x4d, 0xf3, 0xf8, 0xf5, 0xf9, 0x82, 0x01, 0x01, 0xe2, 0xf9, 0xf3, 0xf3, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xee, 0xf4, 0xf9, 0x69, 0x01, 0x69, 0xf9, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf7, 0xf3, 0xf3, 0xec, 0xf3, 0xea, 0xf5, 0xea, 0xed, 0xf3, 0xed, 0xed, 0xed, 0xf3, 0xed, 0xf3, 0xf4, 0xec, 0xd7, 0xb6, 0xb3, 0xba, 0xb3, 0xbb, 0xbc, 0xb3, 0xbb, 0xbb, 0xae, 0xe1, 0xec, 0xee, 0xed, 0xed, 0xed, 0xf5, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xee, 0xf9, 0x71, 0x01, 0x4f, 0xf9, 0xf6, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf6, 0xef, 0xf9, 0xa5, 0x01, 0x01, 0xc7, 0xf9, 0xf8, 0xf0, 0xf0, 0xf9, 0x91, 0x01, 0x01, 0xbe, 0xf8, 0xf6, 0xf8, 0xd1, 0x1e, 0x1c, 0x5b, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1f, 0x5f, 0x08, 0x01, 0x91, 0xf9, 0xf3, 0xf8, 0x8d, 0x5b, 0x24, 0x24, 0x26, 0x23, 0x62, 0x23, 0x60, 0x5f, 0x7b, 0xf8, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf9, 0xb1, 0x01, 0x01, 0xd3, 0xf9, 0xf5, 0xf8, 0x9f, 0x01, 0x01, 0xd3, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf5, 0xf9, 0x5e, 0x01, 0x69, 0xf9, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf7, 0xf3, 0xf5, 0xf5, 0xfe, 0xf5, 0xf5, 0xf5, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xec, 0xd5, 0xb6, 0xbb, 0xb3, 0xbb, 0xbb, 0xb3, 0xbc, 0xb3, 0xbc, 0xb6, 0xe3, 0xf3, 0xee, 0xf4, 0xec, 0xee, 0xf5, 0xf5, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0x69, 0x01, 0x51, 0xf9, 0xee, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf2, 0xf9, 0x69, 0x01, 0x00, 0xf4, 0xf8, 0xf6, 0xf0, 0xf4, 0xe4, 0x52, 0x01, 0x50, 0xf8, 0xee, 0xec, 0xde, 0x29, 0x1a, 0x5b, 0x5b, 0x1d, 0x1d, 0x20, 0x1d, 0x21, 0x1f, 0x1e, 0x08, 0x01, 0x8c, 0xf9, 0xf2, 0xeb, 0x25, 0x26, 0x23, 0x26, 0x24, 0x26, 0x24, 0x5c, 0x24, 0x59, 0xc9, 0xf8, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xd9, 0x04, 0x01, 0x9f, 0xf9, 0xf5, 0xf9, 0xc7, 0x04, 0x01, 0xa5, 0xf9, 0xef, 0xf6, 0xf5, 0xf4, 0xf4, 0xf4, 0xf6, 0xf3, 0xee, 0xf6, 0xf9, 0x5e, 0x01, 0x71, 0xf9, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xfb, 0xf3, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf3, 0xf4, 0xed, 0xf1, 0xd4, 0xb7, 0xb3, 0xbb, 0xb3, 0xbb, 0xbc, 0xb3, 0xbf, 0xb6, 0xc0, 0xe5, 0xed, 0xf4, 0xed, 0xec, 0xed, 0xf5, 0xf5, 0xf4, 0xf4, 0xf5, 0xf6, 0xf5, 0xf9, 0x5a, 0x01, 0x53, 0xf9, 0xf6, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf9, 0xe2, 0x51, 0x01, 0x55, 0xf9, 0xef, 0xf4, 0xed, 0xf9, 0xa5, 0x01, 0x01, 0x82, 0xf9, 0xe9, 0xf1, 0x78, 0x18, 0x1f, 0x1f, 0x1d, 0x1d, 0x20, 0x1d, 0x21, 0x1d, 0x1f, 0x5f, 0x05, 0x01, 0x82, 0xf9, 0xf8, 0xcc, 0x1c, 0x24, 0x24, 0x24, 0x26, 0x24, 0x23, 0x24, 0x60, 0x29, 0xde, 0xec, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xef, 0xf5, 0x53, 0x01, 0x71, 0xf9, 0xf8, 0xef, 0xd6, 0x4d, 0x01, 0x82, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf6, 0xf3, 0xf6, 0xef, 0xf9, 0x55, 0x01, 0x75, 0xf9, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xfb, 0xfb, 0xfe, 0xfb, 0xf5, 0xfe, 0xed, 0xf5, 0xf3, 0xfe, 0xf3, 0xf5, 0xf3, 0xf3, 0xed, 0xf1, 0xcf, 0xb8, 0xbb, 0xb3, 0xbb, 0xbb, 0xb3, 0xbc, 0xbb, 0xb7, 0xc9, 0xe9, 0xf0, 0xf5, 0xed, 0xed, 0xed, 0xf5, 0xf5, 0xf4, 0xf4, 0xf5, 0xf4, 0xef, 0xee, 0x54, 0x01, 0x5a, 0xf9, 0xf5, 0xf3, 0xee, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xee, 0xf3, 0xf9, 0xac, 0x01, 0x01, 0x82, 0xf9, 0xf4, 0xf6, 0xee, 0xf9, 0x54, 0x01, 0x4e, 0xd6, 0xf6, 0xf8, 0xa1, 0x19, 0x1d, 0x1f, 0x1d, 0x20, 0x20, 0x1d, 0x21, 0x1d, 0x1f, 0x1f, 0x29, 0x08, 0x01, 0x79, 0xf9, 0xf8, 0x97, 0x58, 0x24, 0x62, 0x24, 0x24, 0x24, 0x23, 0x62, 0x58, 0x84, 0xee, 0xed, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xef, 0xf9, 0x69, 0x01, 0x53, 0xe8, 0xef, 0xf9, 0xe8, 0x51, 0x01, 0x5e, 0xf9, 0xf5, 0xee, 0xf5, 0xf4, 0xf4, 0xf4, 0xf6, 0xf3, 0xf4, 0xf0, 0xf9, 0x5a, 0x01, 0x79, 0xf9, 0xf6, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xf3, 0xf5, 0xfb, 0xf3, 0xf6, 0xf3, 0xed, 0xea, 0xec, 0xee, 0xed, 0xf5, 0xf5, 0xf5, 0xf3, 0xf3, 0xed, 0xea, 0xd7, 0xae, 0xb9, 0xb3, 0xb3, 0xb9, 0xbc, 0xbc, 0xbc, 0xb0, 0xd7, 0xf0, 0xf5, 0xf3, 0xed, 0xec, 0xed, 0xf5, 0xf5, 0xf4, 0xf4, 0xf5, 0xf4, 0xef, 0xe4, 0x51, 0x01, 0x69, 0xf9, 0xf4, 0xf5, 0xf2, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf2, 0xf0, 0xf9, 0x5a, 0x01, 0x4e, 0xd3, 0xf9, 0xee, 0xf3, 0xf9, 0xb1, 0x01, 0x01, 0x75, 0xf7, 0xf8, 0xcc, 0x1a, 0x58, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x23, 0x1d, 0x21, 0x21, 0x1c, 0x7f, 0x07, 0x01, 0x75, 0xf9, 0xed, 0x6f, 0x5b, 0x23, 0x24, 0x24, 0x24, 0x24, 0x27, 0x60, 0x18, 0xb0, 0xf8, 0xf2, 0xf4, 0xf5, 0xf3, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0x96, 0x01, 0x4d, 0xca, 0xf9, 0xf2, 0xf9, 0x5e, 0x01, 0x52, 0xe2, 0xef, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf3, 0xf6, 0xf5, 0xee, 0xf9, 0x5a, 0x01, 0x75, 0xf9, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xf3, 0xf4, 0xf4, 0xec, 0xf1, 0xf8, 0xf8, 0xf1, 0xe9, 0xec, 0xee, 0xf5, 0xf5, 0xf3, 0xf3, 0xed, 0xf1, 0xd4, 0xb7, 0xb3, 0xbb, 0xbb, 0xbc, 0xc1, 0xa9, 0xbc, 0xc2, 0xe5, 0xf0, 0xe8, 0xf5, 0xec, 0xed, 0xed, 0xf5, 0xf5, 0xf4, 0xf4, 0xf5, 0xf4, 0xf9, 0xd6, 0x4e, 0x01, 0x79, 0xf9, 0xf5, 0xf3, 0xf3, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xd6, 0x4d, 0x01, 0x5e, 0xef, 0xf6, 0xfd, 0xf8, 0xf9, 0x55, 0x01, 0x01, 0xd0, 0xf9, 0xe6, 0x29, 0x18, 0x26, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x21, 0x21, 0x21, 0x1d, 0x1e, 0x94, 0x03, 0x01, 0x71, 0xf9, 0xe3, 0x33, 0x1f, 0x23, 0x24, 0x24, 0x24, 0x24, 0x23, 0x24, 0x1a, 0xd4, 0xf8, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf9, 0xca, 0x4d, 0x01, 0x91, 0xf9, 0xef, 0xf9, 0x8c, 0x01, 0x4c, 0xca, 0xf9, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf6, 0xf3, 0xef, 0xf9, 0x5a, 0x01, 0x71, 0xf9, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xec, 0xf1, 0xe7, 0xc5, 0x8f, 0xa7, 0xd1, 0xf1, 0xec, 0xec, 0xf3, 0xf5, 0xf3, 0xf3, 0xf4, 0xf1, 0xd4, 0xb6, 0xb3, 0xb3, 0xb9, 0xbc, 0xae, 0xc4, 0xae, 0xdc, 0xf1, 0xef, 0xf2, 0xee, 0xed, 0xec, 0xed, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf5, 0xf9, 0xb1, 0x01, 0x01, 0xb1, 0xf9, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf2, 0xf9, 0x71, 0x01, 0x01, 0xb1, 0xf9, 0xef, 0xf3, 0xf9, 0xa5, 0x01, 0x01, 0x5a, 0xf9, 0xf8, 0x74, 0x1a, 0x24, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x5c, 0x1d, 0x21, 0x21, 0x1b, 0x6a, 0xc5, 0x03, 0x01, 0x69, 0xf9, 0xd7, 0x5f, 0x5d, 0x27, 0x60, 0x24, 0x24, 0x23, 0x24, 0x5c, 0x1a, 0xe6, 0xf3, 0xfd, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xe8, 0xef, 0xf3, 0x54, 0x01, 0x5a, 0xf9, 0xf5, 0xf9, 0xd0, 0x01, 0x01, 0x82, 0xf9, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf6, 0xf6, 0xf4, 0xf6, 0xf9, 0x5a, 0x01, 0x69, 0xf9, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xed, 0xf3, 0xf1, 0xe5, 0x97, 0x77, 0x95, 0xaf, 0x9a, 0xb8, 0xe7, 0xec, 0xed, 0xf3, 0xf5, 0xf4, 0xed, 0xeb, 0xce, 0xb7, 0xb3, 0xbb, 0xb3, 0xbd, 0xbd, 0xae, 0xd1, 0xf1, 0xed, 0xf5, 0xff, 0xf5, 0xec, 0xec, 0xed, 0xf5, 0xf5, 0xf4, 0xf4, 0xf5, 0xf4, 0xf9, 0x8c, 0x01, 0x4c, 0xd0, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf9, 0xd9, 0x4d, 0x01, 0x50, 0xff, 0xef, 0xf6, 0xef, 0xf8, 0x53, 0x01, 0x04, 0xc7, 0xf9, 0xc2, 0x15, 0x1f, 0x5c, 0x20, 0x1d, 0x21, 0x5c, 0x5c, 0x21, 0x5b, 0x21, 0x1d, 0x21, 0x7e, 0xcd, 0x04, 0x01, 0x69, 0xf9, 0xd4, 0x1e, 0x60, 0x20, 0x62, 0x23, 0x26, 0x24, 0x27, 0x5d, 0x1e, 0xeb, 0xf6, 0xfb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xef, 0xf9, 0x75, 0x01, 0x4f, 0xf2, 0xf9, 0xf0, 0xe4, 0x50, 0x01, 0x54, 0xf9, 0xef, 0xf4, 0xf5, 0xf4, 0xf4, 0xf6, 0xf6, 0xf3, 0xef, 0xf9, 0x64, 0x01, 0x5e, 0xf9, 0xf5, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfb, 0xec, 0xf1, 0xc2, 0x8d, 0xcb, 0xba, 0xba, 0xc1, 0xa7, 0xb8, 0xeb, 0xed, 0xf4, 0xf3, 0xf3, 0xf6, 0xe7, 0xc2, 0xb9, 0xb3, 0xbf, 0xb9, 0xb7, 0xb8, 0xd7, 0xf1, 0xe9, 0xed, 0xf2, 0xff, 0xed, 0xed, 0xec, 0xed, 0xf6, 0xf5, 0xf4, 0xf4, 0xf5, 0xee, 0xf9, 0x5a, 0x01, 0x52, 0xe4, 0xf0, 0xf3, 0xf6, 0xf4, 0xf4, 0xf5, 0xf3, 0xf6, 0xf6, 0xf9, 0x71, 0x01, 0x04, 0x91, 0xf9, 0xf5, 0xf5, 0xf9, 0x8c, 0x01, 0x01, 0x69, 0xf9, 0xda, 0x29, 0x1b, 0x23, 0x1d, 0x23, 0x1d, 0x21, 0x5b, 0x5b, 0x5b, 0x21, 0x21, 0x1b, 0x2e, 0xa1, 0xd9, 0x4e, 0x01, 0x64, 0xf9, 0xd4, 0x5f, 0x5d, 0x20, 0x60, 0x24, 0x24, 0x24, 0x21, 0x5d, 0x39, 0xec, 0xf7, 0xfe, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf2, 0xf9, 0xc7, 0x01, 0x01, 0xc7, 0xf9, 0xf5, 0xf9, 0x71, 0x01, 0x01, 0xe4, 0xef, 0xf5, 0xf4, 0xf5, 0xf3, 0xf4, 0xf6, 0xf3, 0xef, 0xf9, 0x69, 0x01, 0x5a, 0xf9, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfb, 0xfb, 0xf0, 0xe5, 0xa7, 0xaf, 0xbf, 0xbf, 0xbc, 0xb3, 0xc6, 0xb6, 0xc9, 0xf1, 0xe9, 0xed, 0xe8, 0xee, 0xde, 0xb6, 0xbc, 0xb9, 0xbc, 0xb7, 0xb8, 0xd7, 0xf1, 0xf6, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xed, 0xf4, 0xed, 0xf4, 0xf6, 0xf6, 0xf3, 0xee, 0xef, 0xe4, 0x51, 0x01, 0x64, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf3, 0xee, 0xf8, 0xd3, 0x4e, 0x01, 0x52, 0xe8, 0xf8, 0xf6, 0xf9, 0xe4, 0x4d, 0x01, 0x00, 0xdd, 0xf8, 0x8f, 0x1b, 0x1d, 0x1d, 0x5c, 0x1d, 0x21, 0x1d, 0x25, 0x5b, 0x60, 0x1d, 0x21, 0x25, 0x74, 0xd4, 0xdf, 0x4f, 0x01, 0x5a, 0xf9, 0xd4, 0x1c, 0x23, 0x27, 0x27, 0x24, 0x24, 0x24, 0x24, 0x58, 0x39, 0xf1, 0xf0, 0xfb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xe8, 0x4e, 0x01, 0x82, 0xf9, 0xee, 0xf9, 0xac, 0x01, 0x01, 0x9f, 0xf9, 0xee, 0xf2, 0xf6, 0xf3, 0xf6, 0xf4, 0xf6, 0xf4, 0xf9, 0x71, 0x01, 0x54, 0xf8, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xff, 0xf5, 0xf0, 0xe1, 0xae, 0xb9, 0xbf, 0xbb, 0xc3, 0xbf, 0xbb, 0xc1, 0xb0, 0xd7, 0xf1, 0xe6, 0xec, 0xf1, 0xc8, 0xb6, 0xc1, 0xbc, 0xbd, 0xb7, 0xd1, 0xf8, 0xf2, 0xf6, 0xf4, 0xed, 0xf6, 0xed, 0xf4, 0xf6, 0xed, 0xf6, 0xed, 0xf4, 0xf3, 0xf4, 0xf5, 0xf9, 0xbe, 0x01, 0x01, 0x9f, 0xf9, 0xf6, 0xf4, 0xf4, 0xf4, 0xf3, 0xf6, 0xef, 0xf2, 0xf9, 0x5a, 0x01, 0x01, 0xa5, 0xf9, 0xf4, 0xf4, 0xf9, 0x71, 0x01, 0x01, 0x82, 0xf9, 0xdb, 0x1a, 0x1b, 0x1d, 0x1d, 0x5d, 0x1f, 0x20, 0x1f, 0x5b, 0x5b, 0x5d, 0x1d, 0x1d, 0x42, 0x7b, 0xf1, 0xf2, 0x52, 0x01, 0x54, 0xf9, 0xda, 0x5f, 0x20, 0x20, 0x24, 0x24, 0x24, 0x60, 0x24, 0x1f, 0x29, 0xec, 0xfb, 0xfd, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf0, 0xf3, 0xf9, 0x5e, 0x01, 0x53, 0xe8, 0xef, 0xee, 0xfe, 0x4f, 0x01, 0x55, 0xef, 0xef, 0xf6, 0xf4, 0xf6, 0xf6, 0xee, 0xf6, 0xf5, 0xf9, 0x82, 0x01, 0x51, 0xf2, 0xee, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xee, 0xe1, 0xae, 0xc1, 0xbf, 0xbb, 0xbb, 0xbf, 0xc1, 0xc1, 0xc4, 0xb8, 0xe1, 0xf1, 0xeb, 0xd4, 0xbd, 0xc1, 0xb9, 0xb9, 0xb6, 0xcc, 0xf1, 0xec, 0xf3, 0xf6, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xf4, 0xf6, 0xf4, 0xf5, 0xf9, 0x69, 0x04, 0x01, 0xdf, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xee, 0xf3, 0xf9, 0xa5, 0x01, 0x01, 0x55, 0xf8, 0xf5, 0xf3, 0xf9, 0x9f, 0x01, 0x01, 0x52, 0xef, 0xf1, 0x8f, 0x19, 0x5d, 0x21, 0x21, 0x21, 0x5c, 0x21, 0x1d, 0x5b, 0x5d, 0x1d, 0x21, 0x65, 0x33, 0xcd, 0xf8, 0xf8, 0x55, 0x01, 0x52, 0xee, 0xe3, 0x29, 0x5c, 0x27, 0x27, 0x21, 0x24, 0x24, 0x62, 0x1f, 0x1e, 0xec, 0xf6, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf5, 0xf9, 0x9f, 0x04, 0x01, 0xbe, 0xf9, 0xf8, 0xf9, 0x75, 0x01, 0x04, 0xbe, 0xf9, 0xf3, 0xf0, 0xf3, 0xf6, 0xf4, 0xf6, 0xf4, 0xf9, 0x96, 0x01, 0x4d, 0xe4, 0xef, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf1, 0xe3, 0xbd, 0xc1, 0xbf, 0xbf, 0xbb, 0xc3, 0xc1, 0xc1, 0xbd, 0xbd, 0xc8, 0xe7, 0xd7, 0xbd, 0xb9, 0xbb, 0xc1, 0xb9, 0xc2, 0xe6, 0xeb, 0xf0, 0xee, 0xfb, 0xed, 0xf6, 0xed, 0xf6, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf3, 0xf3, 0xf0, 0xf8, 0xe2, 0x4e, 0x01, 0x5a, 0xef, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xfd, 0xf8, 0xdd, 0x4f, 0x01, 0x01, 0xca, 0xf9, 0xf4, 0xf9, 0xf8, 0x4d, 0x01, 0x01, 0xb1, 0xf9, 0xd7, 0x1e, 0x5b, 0x21, 0x21, 0x21, 0x21, 0x5b, 0x5d, 0x5b, 0x5d, 0x5c, 0x21, 0x58, 0x48, 0x70, 0xe9, 0xf4, 0xf8, 0x71, 0x01, 0x4f, 0xe2, 0xec, 0x6a, 0x21, 0x27, 0x24, 0x24, 0x24, 0x60, 0x24, 0x26, 0x15, 0xe3, 0xf0, 0xfb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf6, 0xf0, 0xdd, 0x4f, 0x01, 0x71, 0xf9, 0xef, 0xf9, 0xca, 0x04, 0x01, 0x64, 0xf9, 0xf3, 0xf2, 0xf6, 0xf4, 0xee, 0xf6, 0xf4, 0xf9, 0xbe, 0x00, 0x01, 0xd6, 0xf8, 0xf3, 0xf5, 0xf3, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf0, 0xeb, 0xbd, 0xb9, 0xbb, 0xc3, 0xc1, 0xbb, 0xb9, 0xc1, 0xc1, 0xc4, 0xb9, 0xb9, 0xb6, 0xb6, 0xc1, 0xbb, 0xbd, 0xbd, 0xe1, 0xeb, 0xf0, 0xea, 0xf3, 0xf3, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xf0, 0xf2, 0xf4, 0xf9, 0x91, 0x01, 0x01, 0xa5, 0xf9, 0xf4, 0xf4, 0xf3, 0xf6, 0xef, 0xf4, 0xf5, 0xf9, 0x54, 0x01, 0x01, 0x79, 0xf9, 0xf3, 0xef, 0xf0, 0x64, 0x01, 0x01, 0x71, 0xf9, 0xf8, 0x89, 0x19, 0x5d, 0x5d, 0x21, 0x21, 0x21, 0x5d, 0x5b, 0x5d, 0x5c, 0x1d, 0x1b, 0x48, 0x59, 0xca, 0xf0, 0xf6, 0xf8, 0x96, 0x01, 0x4c, 0xd3, 0xf8, 0x7b, 0x5b, 0x23, 0x24, 0x24, 0x24, 0x62, 0x24, 0x26, 0x0c, 0xcf, 0xf8, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf2, 0xf5, 0xf8, 0x64, 0x01, 0x4e, 0xf5, 0xef, 0xf0, 0xf8, 0x69, 0x01, 0x01, 0xd3, 0xf9, 0xf3, 0xf0, 0xf3, 0xf4, 0xf4, 0xf5, 0xf9, 0xd6, 0x4f, 0x01, 0xbe, 0xf9, 0xf4, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xec, 0xd1, 0xb6, 0xc3, 0xc1, 0xbc, 0xc1, 0xc1, 0xbb, 0xc1, 0xbb, 0xc1, 0xbb, 0xc1, 0xbc, 0xbb, 0xb9, 0xb6, 0xcf, 0xeb, 0xed, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf4, 0xed, 0xf4, 0xf0, 0xf4, 0xf9, 0xe4, 0x52, 0x01, 0x51, 0xe4, 0xf0, 0xf0, 0xf6, 0xf5, 0xf0, 0xf2, 0xef, 0xf9, 0x91, 0x01, 0x01, 0x51, 0xe4, 0xef, 0xf5, 0xf9, 0x96, 0x01, 0x01, 0x4f, 0xe8, 0xf9, 0xe6, 0x5f, 0x5c, 0x5c, 0x5d, 0x1f, 0x21, 0x21, 0x5c, 0x60, 0x1d, 0x23, 0x1d, 0x1f, 0x6f, 0x66, 0xec, 0xfd, 0xf2, 0xf8, 0xbe, 0x01, 0x01, 0xc7, 0xf9, 0x94, 0x1c, 0x24, 0x24, 0x62, 0x24, 0x62, 0x62, 0x2a, 0x11, 0x7f, 0xf9, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf9, 0x9f, 0x01, 0x01, 0xc7, 0xf8, 0xf6, 0xf9, 0xca, 0x01, 0x01, 0x69, 0xf9, 0xef, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0x52, 0x01, 0x8c, 0xf9, 0xf4, 0xf5, 0xf3, 0xf3, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xfb, 0xf1, 0xe3, 0xb6, 0xc4, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xbf, 0xc1, 0xbf, 0xbb, 0xc1, 0xb9, 0xbc, 0xc2, 0xe7, 0xf1, 0xf2, 0xf3, 0xed, 0xec, 0xec, 0xf3, 0xed, 0xf3, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf6, 0xe8, 0xf8, 0xf9, 0x79, 0x01, 0x01, 0x96, 0xf9, 0xf3, 0xf6, 0xf3, 0xf8, 0xf3, 0xee, 0xf9, 0xa5, 0x01, 0x01, 0x01, 0xd9, 0xf9, 0xee, 0xf9, 0xd6, 0x01, 0x01, 0x01, 0xbe, 0xf9, 0xf8, 0xb0, 0x1a, 0x5c, 0x20, 0x5c, 0x5d, 0x1f, 0x21, 0x5c, 0x60, 0x5c, 0x1d, 0x1f, 0x48, 0x12, 0xc5, 0xf9, 0xf3, 0xed, 0xf8, 0xd9, 0x01, 0x01, 0x96, 0xf9, 0xcd, 0x58, 0x61, 0x24, 0x24, 0x24, 0x24, 0x24, 0x62, 0x1a, 0x0d, 0xdc, 0xfd, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xdf, 0x4d, 0x01, 0x69, 0xf9, 0xf4, 0xf4, 0xf9, 0x5e, 0x01, 0x01, 0xb1, 0xf9, 0xf2, 0xf0, 0xf4, 0xf4, 0xf5, 0xf5, 0xf9, 0x5e, 0x01, 0x5a, 0xf9, 0xf6, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfb, 0xfe, 0xf4, 0xeb, 0xd5, 0xae, 0xbd, 0xc1, 0xbd, 0xc1, 0xbc, 0xbf, 0xbb, 0xc3, 0xbb, 0xbc, 0xbc, 0xb9, 0xb6, 0xd4, 0xf1, 0xf3, 0xfd, 0xf3, 0xed, 0xe9, 0xec, 0xf3, 0xf3, 0xf4, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf0, 0xf9, 0xdf, 0xfa, 0x01, 0x51, 0xe2, 0xf9, 0xf2, 0xf6, 0xf0, 0xf5, 0xf5, 0xf9, 0xd3, 0x4d, 0x01, 0x01, 0x82, 0xf9, 0xf6, 0xf5, 0xe4, 0x53, 0x01, 0x01, 0x91, 0xf8, 0xf4, 0xf1, 0x89, 0x58, 0x20, 0x20, 0x5c, 0x25, 0x5b, 0x21, 0x5c, 0x5d, 0x21, 0x1d, 0x2a, 0x6a, 0x56, 0xf6, 0xf8, 0xe8, 0xf8, 0xf1, 0xe8, 0x4d, 0x01, 0x82, 0xf9, 0xe6, 0x25, 0x26, 0x24, 0x62, 0x24, 0x62, 0x24, 0x24, 0x29, 0x06, 0x86, 0xf9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xee, 0xf9, 0x55, 0x02, 0x4e, 0xf2, 0xf8, 0xf4, 0xf8, 0xd3, 0x4e, 0x01, 0x53, 0xe8, 0xf8, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf9, 0x79, 0x01, 0x51, 0xe2, 0xf8, 0xee, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xfe, 0xfe, 0xf5, 0xec, 0xeb, 0xcb, 0xb6, 0xbc, 0xc4, 0xbc, 0xbc, 0xbf, 0xbf, 0xbf, 0xbc, 0xbc, 0xbd, 0xbc, 0xb7, 0xe7, 0xeb, 0xfb, 0xfb, 0xfe, 0xf1, 0xec, 0xe9, 0xf0, 0xf3, 0xed, 0xf4, 0xf6, 0xed, 0xf4, 0xed, 0xf4, 0xf8, 0xef, 0x5e, 0x01, 0x01, 0x96, 0xf9, 0xf4, 0xf6, 0xf0, 0xf2, 0xee, 0xf9, 0xdf, 0x51, 0x01, 0x01, 0x69, 0xf5, 0xf9, 0xf0, 0xf9, 0x64, 0x01, 0x01, 0x5a, 0xf9, 0xef, 0xf3, 0xe9, 0x6a, 0x5c, 0x20, 0x20, 0x23, 0x5b, 0x25, 0x5c, 0x20, 0x21, 0x1d, 0x1d, 0x45, 0x0e, 0xbe, 0xf8, 0xf4, 0xea, 0xec, 0xec, 0xf9, 0x54, 0x01, 0x5e, 0xf8, 0xf8, 0x84, 0x5b, 0x24, 0x26, 0x24, 0x24, 0x24, 0x21, 0x39, 0x10, 0x4d, 0xe8, 0xf0, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf9, 0x82, 0x01, 0x01, 0xc7, 0xf8, 0xf7, 0xee, 0xf9, 0x82, 0x01, 0x01, 0x75, 0xf9, 0xee, 0xf4, 0xf4, 0xf5, 0xf5, 0xf9, 0xbe, 0x01, 0x01, 0xca, 0xf8, 0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xfb, 0xfe, 0xf7, 0xf3, 0xeb, 0xe7, 0xcf, 0xb8, 0xb9, 0xbc, 0xc3, 0xbf, 0xbb, 0xc1, 0xc1, 0xbc, 0xbf, 0xb7, 0xcc, 0xec, 0xf4, 0xf3, 0xf3, 0xf1, 0xd4, 0xc2, 0xb8, 0xcf, 0xed, 0xec, 0xf0, 0xf4, 0xf4, 0xed, 0xf3, 0xf6, 0xf9, 0x91, 0x01, 0x00, 0x54, 0xf9, 0xee, 0xf3, 0xf6, 0xf3, 0xee, 0xef, 0xe2, 0x54, 0x01, 0x01, 0x53, 0xf5, 0xef, 0xef, 0xfd, 0x71, 0x01, 0x01, 0x55, 0xe2, 0xf9, 0xf3, 0xf0, 0xde, 0x1e, 0x1f, 0x20, 0x20, 0x5c, 0x5d, 0x21, 0x21, 0x21, 0x1d, 0x21, 0x29, 0x6a, 0x57, 0xf1, 0xf0, 0xf2, 0xec, 0xf3, 0xf0, 0xf9, 0x64, 0x01, 0x52, 0xe5, 0xf8, 0xcc, 0x5f, 0x23, 0x28, 0x61, 0x60, 0x24, 0x27, 0x21, 0x29, 0x03, 0x71, 0xf9, 0xf6, 0xf3, 0xed, 0xed, 0xec, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf9, 0xca, 0x4d, 0x01, 0x71, 0xf9, 0xf3, 0xf0, 0xf8, 0xf3, 0x51, 0x00, 0x01, 0xbe, 0xf9, 0xf5, 0xf5, 0xf4, 0xf2, 0xf8, 0xe2, 0x4e, 0x01, 0x79, 0xf9, 0xed, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xfc, 0xfc, 0xf6, 0xeb, 0xf1, 0xed, 0xc9, 0xbd, 0xbc, 0xb3, 0xbf, 0xbc, 0xc1, 0xbd, 0xbb, 0xba, 0xb7, 0xd7, 0xec, 0xf3, 0xf4, 0xf1, 0xd1, 0xae, 0xc4, 0xbd, 0x94, 0xeb, 0xec, 0xf3, 0xf3, 0xf4, 0xeb, 0xf2, 0xf9, 0xd9, 0x4c, 0x01, 0x04, 0xd0, 0xf9, 0xf6, 0xf4, 0xf3, 0xf4, 0xf9, 0xef, 0x54, 0x01, 0x01, 0x50, 0xd9, 0xf8, 0xe8, 0xf9, 0x8c, 0x01, 0x01, 0x50, 0xe2, 0xf9, 0xe4, 0xf0, 0xee, 0xce, 0x18, 0x25, 0x21, 0x5c, 0x20, 0x21, 0x21, 0x21, 0x21, 0x20, 0x25, 0x6f, 0x17, 0x90, 0xf9, 0xec, 0xed, 0xf7, 0xf3, 0xf1, 0xf9, 0x8c, 0x01, 0x4c, 0xd3, 0xf9, 0xe9, 0x74, 0x24, 0x5c, 0x2e, 0x60, 0x62, 0x27, 0x24, 0x2e, 0x14, 0x01, 0xc7, 0xf9, 0xf2, 0xf0, 0xe9, 0xec, 0xed, 0xf3, 0xf4, 0xf4, 0xee, 0xf4, 0xf4, 0xf6, 0xf8, 0xe4, 0x52, 0x01, 0x54, 0xf9, 0xf6, 0xf4, 0xf6, 0xf9, 0xa5, 0x01, 0x02, 0x52, 0xe4, 0xf9, 0xef, 0xf4, 0xf4, 0xf6, 0xf8, 0x5a, 0x01, 0x52, 0xf9, 0xf5, 0xee, 0xee, 0xf3, 0xed, 0xed, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xed, 0xfb, 0xfe, 0xfc, 0xf5, 0xf0, 0xec, 0xed, 0xf8, 0xf8, 0xd4, 0xb7, 0xc6, 0xb3, 0xc1, 0xbd, 0xc1, 0xbb, 0xbf, 0xb7, 0xde, 0xec, 0xe9, 0xeb, 0xe1, 0xa1, 0xcb, 0xc4, 0xc4, 0x94, 0xe9, 0xed, 0xf4, 0xf7, 0xed, 0xf3, 0xf9, 0xdf, 0x51, 0x00, 0x01, 0x9f, 0xf9, 0xf5, 0xf3, 0xf4, 0xf6, 0xf8, 0xe4, 0x55, 0x01, 0x01, 0x4f, 0xd9, 0xf9, 0xf5, 0xf9, 0x75, 0x01, 0x01, 0x52, 0xdd, 0xf9, 0xe8, 0xee, 0xf5, 0xf8, 0xb0, 0x18, 0x1f, 0x5c, 0x21, 0x21, 0x23, 0x21, 0x21, 0x21, 0x24, 0x1f, 0x74, 0x17, 0xe6, 0xee, 0xe6, 0xf6, 0xf7, 0xf7, 0xed, 0xf9, 0xc7, 0x00, 0x01, 0xb1, 0xf1, 0xf1, 0xd4, 0x18, 0x2a, 0x5d, 0x28, 0x23, 0x27, 0x26, 0x2a, 0x33, 0x06, 0x4f, 0xe8, 0xf0, 0xed, 0xf3, 0xf4, 0xf3, 0xed, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf2, 0xf9, 0x69, 0x01, 0x04, 0xd6, 0xf9, 0xf3, 0xf0, 0xf6, 0xf9, 0x75, 0x01, 0x01, 0x5a, 0xf9, 0xf5, 0xf6, 0xf4, 0xf4, 0xf9, 0x9f, 0x01, 0x01, 0xd6, 0xf9, 0xf2, 0xef, 0xed, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xfb, 0xfd, 0xfe, 0xed, 0xea, 0xf1, 0xed, 0xfd, 0xfc, 0xeb, 0xcf, 0xb7, 0xbc, 0xbb, 0xbb, 0xc1, 0xb9, 0xbc, 0xb9, 0xe1, 0xeb, 0xeb, 0xe1, 0xb5, 0xbd, 0xc4, 0xcb, 0xbd, 0x8e, 0xe7, 0xe9, 0xf8, 0xf3, 0xf3, 0xf8, 0xf9, 0x55, 0x01, 0x01, 0x5e, 0xf9, 0xee, 0xf6, 0xee, 0xf8, 0xf6, 0xf9, 0x55, 0x01, 0x01, 0xfa, 0xca, 0xf9, 0xee, 0xf9, 0x96, 0x01, 0x01, 0x4e, 0xd6, 0xf9, 0xf3, 0xf8, 0xe8, 0xed, 0xf8, 0xa0, 0x1a, 0x5b, 0x1f, 0x23, 0x5c, 0x23, 0x21, 0x5d, 0x21, 0x1d, 0x2e, 0x5f, 0x7f, 0xf9, 0xea, 0xed, 0xed, 0xf7, 0xf3, 0xed, 0xf8, 0xd6, 0x4e, 0x01, 0x8c, 0xf9, 0xe9, 0xf8, 0x7e, 0x58, 0x5c, 0x28, 0x27, 0x23, 0x2e, 0x26, 0x2a, 0x1a, 0x01, 0x6d, 0xf9, 0xf3, 0xfc, 0xf4, 0xfb, 0xed, 0xed, 0xee, 0xf4, 0xf4, 0xf4, 0xf6, 0xf2, 0xf9, 0x91, 0x01, 0x01, 0xa5, 0xf9, 0xf4, 0xf6, 0xf0, 0xf8, 0xe8, 0x52, 0x01, 0x01, 0x96, 0xf9, 0xef, 0xf6, 0xf3, 0xf8, 0xdd, 0x01, 0x01, 0x82, 0xf9, 0xf2, 0xee, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfc, 0xfd, 0xea, 0xe9, 0xda, 0xde, 0xf8, 0xfd, 0xfc, 0xfd, 0xf0, 0xd1, 0xb7, 0xbb, 0xbb, 0xbb, 0xbd, 0xc1, 0xae, 0xcb, 0xe1, 0xe1, 0xb5, 0xb6, 0xcb, 0xbb, 0xc6, 0xaf, 0x94, 0xeb, 0xf1, 0xf2, 0xf5, 0xf9, 0xe8, 0x54, 0x01, 0x01, 0x5e, 0xee, 0xee, 0xf5, 0xf5, 0xf6, 0xef, 0xf2, 0x64, 0x01, 0x02, 0x4e, 0xca, 0xf9, 0xf5, 0xf9, 0x8c, 0x01, 0x01, 0x51, 0xdd, 0xf9, 0xf3, 0xf3, 0xe8, 0xed, 0xee, 0xf8, 0x8e, 0x18, 0x26, 0x21, 0x5c, 0x5d, 0x23, 0x21, 0x21, 0x21, 0x1d, 0x3d, 0x16, 0xd6, 0xf0, 0xea, 0xee, 0xf3, 0xf6, 0xf4, 0xee, 0xee, 0xfe, 0x54, 0x01, 0x64, 0xf8, 0xf3, 0xf1, 0xe1, 0x6f, 0x21, 0x20, 0x27, 0x62, 0x60, 0x62, 0x27, 0x6c, 0x10, 0x01, 0x90, 0xf9, 0xfc, 0xfc, 0xfe, 0xea, 0xea, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xd9, 0x01, 0x01, 0x71, 0xf9, 0xef, 0xf4, 0xf8, 0xf2, 0xf8, 0xd9, 0x4d, 0x02, 0x01, 0xb1, 0xf9, 0xf3, 0xef, 0xf6, 0xf9, 0x64, 0x01, 0x4e, 0xd9, 0xf9, 0xe8, 0xed, 0xed, 0xf3, 0xf4, 0xed, 0xf3, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf1, 0xe3, 0xa9, 0x8f, 0x8d, 0xd1, 0xf1, 0xf6, 0xfe, 0xf8, 0xe9, 0xd1, 0xaf, 0xbc, 0xbc, 0xb9, 0xbd, 0xbc, 0xb9, 0xbd, 0xc2, 0xb6, 0xc4, 0xbb, 0xc3, 0xc1, 0xaf, 0x94, 0xe7, 0xf1, 0xf6, 0xf9, 0xe2, 0x5a, 0x01, 0x01, 0x53, 0xe2, 0xf9, 0xf2, 0xef, 0xe8, 0xf5, 0xf9, 0x69, 0x01, 0x01, 0x01, 0xb1, 0xf9, 0xf8, 0xf9, 0x8c, 0x01, 0x01, 0x51, 0xd6, 0xf8, 0xf5, 0xe8, 0xee, 0xed, 0xed, 0xea, 0xf8, 0x7e, 0x58, 0x25, 0x5b, 0x5d, 0x23, 0x5d, 0x5c, 0x21, 0x24, 0x1b, 0x42, 0x57, 0xf1, 0xee, 0xea, 0xe8, 0xee, 0xf3, 0xf4, 0xed, 0xee, 0xf9, 0x64, 0x01, 0x52, 0xfb, 0xf0, 0xf3, 0xf1, 0xc2, 0x1f, 0x20, 0x27, 0x60, 0x61, 0x62, 0x27, 0x30, 0x29, 0x06, 0x07, 0xbe, 0xf9, 0xfb, 0xfb, 0xee, 0xe8, 0xee, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf0, 0xf8, 0x4f, 0x01, 0x54, 0xf9, 0xf8, 0xf4, 0xf6, 0xee, 0xf4, 0xf9, 0x9f, 0x01, 0xfa, 0x4d, 0xdf, 0xf9, 0xf5, 0xee, 0xf9, 0xc7, 0x01, 0x01, 0x82, 0xf9, 0xf3, 0xee, 0xf4, 0xed, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xeb, 0xd5, 0x9b, 0xb3, 0xba, 0x9a, 0xd7, 0xf8, 0xf5, 0xe8, 0xf8, 0xeb, 0xc8, 0xaf, 0xc1, 0xbc, 0xbd, 0xbb, 0xb9, 0xb9, 0xbd, 0xc4, 0xc1, 0xc1, 0xc3, 0xbf, 0xaf, 0x94, 0xeb, 0xed, 0xf9, 0xd3, 0x51, 0x01, 0x01, 0x54, 0xe4, 0xf9, 0xe4, 0xf0, 0xf5, 0xee, 0xef, 0x69, 0x01, 0x02, 0x04, 0x96, 0xf9, 0xf9, 0xf9, 0x75, 0x01, 0x01, 0x53, 0xf2, 0xf9, 0xe4, 0xf8, 0xe8, 0xf0, 0xed, 0xec, 0xed, 0xf9, 0x74, 0x58, 0x60, 0x5b, 0x5d, 0x5d, 0x5d, 0x21, 0x24, 0x21, 0x5c, 0x65, 0x78, 0xf9, 0xf3, 0xf5, 0xed, 0xf3, 0xf6, 0xf4, 0xf3, 0xed, 0xf9, 0x8c, 0x01, 0x4e, 0xd9, 0xf0, 0xfb, 0xf1, 0xf8, 0x8d, 0x58, 0x62, 0x62, 0x62, 0x27, 0x27, 0x20, 0x2e, 0x1e, 0x05, 0x07, 0xdd, 0xf9, 0xf2, 0xe8, 0xee, 0xf3, 0xf6, 0xf4, 0xf6, 0xf3, 0xf6, 0xf3, 0xf9, 0x5a, 0x01, 0x4f, 0xf5, 0xef, 0xf6, 0xf4, 0xf2, 0xf8, 0xf5, 0xf9, 0x8c, 0x01, 0x01, 0x52, 0xdf, 0xf9, 0xf2, 0xee, 0xf9, 0x64, 0x01, 0x02, 0xdf, 0xf8, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xec, 0xeb, 0xd2, 0xaf, 0xba, 0xb4, 0xb3, 0xa2, 0xe5, 0xea, 0xee, 0xed, 0xf1, 0xe7, 0xc4, 0xb7, 0xbb, 0xb9, 0xbf, 0xbb, 0xbc, 0xbd, 0xc4, 0xc1, 0xbf, 0xbf, 0xc3, 0xae, 0x94, 0xf1, 0xf8, 0x82, 0x4d, 0x01, 0x01, 0x5a, 0xf2, 0xf9, 0xf3, 0xf0, 0xf3, 0xef, 0xf9, 0x69, 0x01, 0x01, 0x01, 0xa5, 0xf9, 0xef, 0xe8, 0x69, 0x01, 0x01, 0x64, 0xe2, 0xf9, 0xe8, 0xee, 0xe8, 0xf6, 0xed, 0xf3, 0xec, 0xed, 0xf1, 0x39, 0x58, 0x1f, 0x60, 0x5b, 0x5d, 0x5d, 0x5c, 0x23, 0x21, 0x1d, 0x33, 0xaa, 0xf8, 0xf3, 0xf5, 0xf3, 0xed, 0xf3, 0xf3, 0xed, 0xf5, 0xf9, 0xac, 0x01, 0x01, 0xc7, 0xf8, 0xf3, 0xf3, 0xec, 0xe9, 0x7b, 0x58, 0x62, 0x62, 0x23, 0x27, 0x27, 0x2c, 0x2e, 0x19, 0x02, 0x56, 0xe4, 0xf0, 0xf5, 0xf2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf2, 0xf9, 0x79, 0x01, 0x01, 0xd6, 0xf9, 0xf4, 0xf6, 0xf6, 0xf2, 0xf5, 0xee, 0xf9, 0x64, 0x01, 0x01, 0x55, 0xf2, 0xf9, 0xef, 0xf0, 0xdf, 0x01, 0x01, 0x64, 0xf9, 0xf3, 0xee, 0xed, 0xf4, 0xed, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xec, 0xd5, 0xbb, 0xba, 0xba, 0xba, 0xa8, 0xa9, 0xea, 0xee, 0xf2, 0xf0, 0xf0, 0xce, 0xaf, 0xb9, 0xbb, 0xbf, 0xbb, 0xb9, 0xc4, 0xc1, 0xc1, 0xbf, 0xc3, 0xbc, 0xaf, 0xa1, 0xcf, 0x5a, 0x01, 0x01, 0x01, 0x69, 0xf4, 0xf9, 0xf3, 0xf2, 0xf2, 0xf6, 0xf9, 0x79, 0x01, 0x04, 0x01, 0x91, 0xf9, 0xf9, 0xf2, 0x5a, 0x01, 0x01, 0x69, 0xf9, 0xf8, 0xee, 0xf3, 0xf3, 0xf3, 0xed, 0xed, 0xe9, 0xf0, 0xec, 0xf3, 0x65, 0x58, 0x60, 0x5b, 0x5b, 0x5d, 0x5d, 0x23, 0x24, 0x23, 0x5b, 0x33, 0xcf, 0xf0, 0xf4, 0xfe, 0xf5, 0xf3, 0xed, 0xf3, 0xf6, 0xee, 0xf9, 0xca, 0x01, 0x01, 0x9f, 0xf9, 0xe8, 0xee, 0xf4, 0xf1, 0xe1, 0x65, 0x1d, 0x27, 0x28, 0x60, 0x62, 0x23, 0x2e, 0x61, 0x0e, 0x02, 0x6d, 0xf9, 0xf6, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf0, 0xf9, 0x96, 0x01, 0x01, 0xbe, 0xf9, 0xf3, 0xf3, 0xf0, 0xf0, 0xf6, 0xf5, 0xf8, 0xe4, 0x55, 0x01, 0x01, 0x64, 0xef, 0xf8, 0xf0, 0xf9, 0x71, 0x01, 0x01, 0xac, 0xf9, 0xf4, 0xee, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xee, 0xee, 0xde, 0xb9, 0xba, 0xba, 0xba, 0xb3, 0x9b, 0xc2, 0xec, 0xf8, 0xf2, 0xcf, 0xb8, 0xbc, 0xbc, 0xbb, 0xbb, 0xbb, 0xbc, 0xbd, 0xc1, 0xc3, 0xbb, 0xc3, 0xc6, 0xc0, 0x63, 0x03, 0x01, 0x01, 0x4f, 0xb1, 0xf9, 0xf8, 0xf2, 0xf4, 0xf6, 0xf3, 0xf9, 0x82, 0x01, 0x00, 0x01, 0xa5, 0xf9, 0xf9, 0xd6, 0x51, 0x01, 0x01, 0x91, 0xf8, 0xef, 0xf2, 0xe8, 0xed, 0xf2, 0xf0, 0xea, 0xf3, 0xed, 0xed, 0xf1, 0xe5, 0x29, 0x5b, 0x1f, 0x5b, 0x5d, 0x60, 0x5b, 0x5d, 0x5d, 0x23, 0x1d, 0x33, 0xd7, 0xf8, 0xf6, 0xf5, 0xf3, 0xed, 0xf3, 0xf4, 0xf3, 0xf3, 0xf9, 0xd6, 0x4c, 0x01, 0x82, 0xf9, 0xed, 0xea, 0xff, 0xf2, 0xf1, 0xd7, 0x6c, 0x1b, 0x2c, 0x60, 0x62, 0x28, 0x23, 0x2e, 0x29, 0x09, 0x01, 0x90, 0xf9, 0xfb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xed, 0xf8, 0xbe, 0x02, 0x01, 0x96, 0xf9, 0xf5, 0xf4, 0xf6, 0xf6, 0xf3, 0xf5, 0xf4, 0xf8, 0xf3, 0x52, 0x01, 0x01, 0x64, 0xf9, 0xf8, 0xf8, 0xe4, 0x55, 0x01, 0x4e, 0xd9, 0xf9, 0xee, 0xee, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf5, 0xeb, 0xe7, 0xc4, 0xc1, 0xba, 0xba, 0xb4, 0xb3, 0xa0, 0xce, 0xe1, 0xce, 0xb6, 0xbd, 0xc4, 0xc1, 0xbf, 0xbf, 0xb9, 0xbd, 0xbd, 0xc1, 0xbb, 0xba, 0xc6, 0xc8, 0x22, 0x02, 0x01, 0x01, 0x71, 0xd6, 0xf9, 0xf8, 0xed, 0xed, 0xe8, 0xef, 0xf9, 0x8c, 0x01, 0x01, 0x01, 0x91, 0xf9, 0xf9, 0xca, 0x53, 0x01, 0x01, 0x96, 0xf9, 0xf0, 0xf4, 0xed, 0xed, 0xec, 0xea, 0xec, 0xf4, 0xf3, 0xf7, 0xf3, 0xec, 0xe1, 0x25, 0x1d, 0x1f, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x60, 0x23, 0x1f, 0x33, 0xdc, 0xf0, 0xed, 0xfe, 0xea, 0xed, 0xed, 0xf3, 0xf5, 0xf3, 0xf9, 0xdf, 0x4f, 0x01, 0x71, 0xf9, 0xf3, 0xec, 0xed, 0xf4, 0xf6, 0xf8, 0xcf, 0x25, 0x60, 0x27, 0x62, 0x28, 0x62, 0x28, 0x2e, 0x1c, 0x06, 0x07, 0xc7, 0xf9, 0xf5, 0xea, 0xed, 0xec, 0xf3, 0xed, 0xed, 0xef, 0xd0, 0x01, 0x01, 0x82, 0xf9, 0xf4, 0xf6, 0xf4, 0xf4, 0xf5, 0xf6, 0xf2, 0xf6, 0xf9, 0xd3, 0x51, 0x01, 0x01, 0x69, 0xf9, 0xf9, 0xf9, 0xc7, 0x01, 0x01, 0x5a, 0xf9, 0xf8, 0xf5, 0xf2, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf6, 0xe8, 0xf5, 0xf5, 0xf4, 0xf2, 0xf6, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xe9, 0xeb, 0xe0, 0xbd, 0xbb, 0xbf, 0xba, 0xbf, 0xbb, 0xab, 0xbf, 0xbc, 0xbc, 0xc4, 0xc4, 0xc1, 0xbb, 0xbf, 0xbf, 0xc4, 0xc4, 0xc1, 0xc1, 0xd2, 0xa0, 0x0d, 0x01, 0x01, 0x64, 0xd6, 0xf9, 0xf9, 0xee, 0xed, 0xf3, 0xee, 0xef, 0xf9, 0x96, 0x01, 0x01, 0x01, 0xbe, 0xf9, 0xf9, 0xc7, 0x01, 0x01, 0x4c, 0xbe, 0xf9, 0xed, 0xf3, 0xed, 0xf3, 0xf4, 0xec, 0xed, 0xea, 0xf4, 0xfb, 0xf7, 0xe4, 0xf8, 0xb5, 0x1c, 0x1d, 0x21, 0x21, 0x21, 0x5d, 0x5d, 0x5d, 0x60, 0x5d, 0x1d, 0x29, 0xd5, 0xf0, 0xe8, 0xf5, 0xed, 0xed, 0xf3, 0xf3, 0xf6, 0xf5, 0xf8, 0xe4, 0x51, 0x01, 0x64, 0xf9, 0xee, 0xed, 0xed, 0xf4, 0xf4, 0xf6, 0xf8, 0xd5, 0x1c, 0x2c, 0x23, 0x28, 0x27, 0x28, 0x62, 0x2e, 0x1c, 0x03, 0x50, 0xe4, 0xf8, 0xf5, 0xed, 0xf2, 0xf1, 0xed, 0xee, 0xf8, 0xd6, 0x4d, 0x01, 0x79, 0xf9, 0xf6, 0xf6, 0xf6, 0xf3, 0xf4, 0xf4, 0xf8, 0xf2, 0xf8, 0xf9, 0xdd, 0x51, 0x04, 0x01, 0x69, 0xef, 0xf9, 0xf9, 0x8c, 0x01, 0x01, 0x69, 0xf8, 0xf5, 0xf8, 0xe8, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xe8, 0xf9, 0xf9, 0xef, 0xf9, 0xf9, 0xe4, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf3, 0xec, 0xeb, 0xdb, 0xbd, 0xc6, 0xb4, 0xbf, 0xba, 0xbc, 0xba, 0xc6, 0xbd, 0xbd, 0xb6, 0xbd, 0xbc, 0xc3, 0xc3, 0xb9, 0xbd, 0xc4, 0xd1, 0x7b, 0x07, 0x01, 0x54, 0xa5, 0xf8, 0xef, 0xee, 0xf3, 0xef, 0xee, 0xee, 0xe8, 0xf9, 0xa5, 0x01, 0x01, 0x00, 0xac, 0xf9, 0xf9, 0xc7, 0x4e, 0x01, 0x02, 0xc7, 0xf9, 0xee, 0xed, 0xf3, 0xf4, 0xed, 0xf4, 0xf3, 0xec, 0xed, 0xf4, 0xf3, 0xf7, 0xec, 0xe6, 0x57, 0x2e, 0x58, 0x24, 0x5b, 0x5c, 0x5b, 0x5c, 0x60, 0x5d, 0x60, 0x21, 0x25, 0xcf, 0xf8, 0xf2, 0xf5, 0xea, 0xed, 0xed, 0xf2, 0xf0, 0xf6, 0xee, 0xf5, 0x52, 0x01, 0x5e, 0xf8, 0xf6, 0xec, 0xf4, 0xf4, 0xf6, 0xf4, 0xeb, 0xf8, 0xae, 0x1c, 0x62, 0x62, 0x28, 0x27, 0x28, 0x62, 0x29, 0x0e, 0x05, 0x69, 0xf9, 0xf3, 0xf0, 0xf2, 0xed, 0xf2, 0xed, 0xef, 0xdf, 0x4e, 0x01, 0x69, 0xf9, 0xf6, 0xf4, 0xf6, 0xf4, 0xf4, 0xf5, 0xf2, 0xf8, 0xe8, 0xf0, 0xf9, 0xd3, 0x4f, 0x04, 0x01, 0x69, 0xf9, 0xef, 0xf9, 0x64, 0x01, 0x01, 0x82, 0xf9, 0xe8, 0xef, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf7, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xee, 0xf6, 0xf9, 0xca, 0x64, 0x52, 0x64, 0xd6, 0xf8, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf6, 0xed, 0xf3, 0xec, 0xe1, 0xc4, 0xbb, 0xc3, 0xc3, 0xba, 0xba, 0xc3, 0xcb, 0xd2, 0xdb, 0xd5, 0xc4, 0xc3, 0xbb, 0xc4, 0xd2, 0xb8, 0x63, 0x01, 0x04, 0x8c, 0xfc, 0xf9, 0xee, 0xee, 0xee, 0xef, 0xf3, 0xef, 0xf2, 0xf9, 0xca, 0x01, 0x01, 0x02, 0xa5, 0xf9, 0xf9, 0xca, 0x01, 0x01, 0x4d, 0xc7, 0xf9, 0xe8, 0xee, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf4, 0xf3, 0xed, 0xf3, 0xf2, 0xf3, 0xf9, 0x7f, 0x09, 0x48, 0x1d, 0x5d, 0x21, 0x24, 0x5c, 0x5d, 0x5d, 0x60, 0x23, 0x21, 0x25, 0xb8, 0xf8, 0xf4, 0xf5, 0xed, 0xed, 0xf4, 0xf4, 0xf4, 0xee, 0xf5, 0xf5, 0x52, 0x01, 0x5a, 0xf9, 0xf6, 0xf4, 0xf4, 0xf6, 0xfb, 0xf3, 0xf2, 0xe9, 0xf8, 0xa7, 0x1c, 0x24, 0x27, 0x28, 0x27, 0x67, 0x2a, 0x5f, 0x08, 0x05, 0xb1, 0xf8, 0xf4, 0xe4, 0xf0, 0xf3, 0xe8, 0xee, 0xe8, 0x4e, 0x01, 0x69, 0xf9, 0xf3, 0xf4, 0xf6, 0xf3, 0xf4, 0xf5, 0xf4, 0xf6, 0xf0, 0xf4, 0xf0, 0xf9, 0xd0, 0x4f, 0x01, 0x01, 0x82, 0xf9, 0xf9, 0xf5, 0x55, 0x01, 0x01, 0x8c, 0xf9, 0xee, 0xf5, 0xf5, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xe8, 0xf9, 0xe2, 0x4d, 0x01, 0x01, 0x01, 0x52, 0xf2, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xfe, 0xf5, 0xee, 0xf1, 0xe3, 0xcb, 0xbb, 0xba, 0xc3, 0xc3, 0xba, 0xd8, 0xeb, 0xe1, 0xd8, 0xc8, 0xc4, 0xcb, 0xcc, 0x97, 0x0b, 0x01, 0x56, 0xd3, 0xf8, 0xf8, 0xef, 0xf6, 0xf5, 0xf6, 0xef, 0xee, 0xee, 0xf9, 0xd3, 0x50, 0x01, 0x01, 0x9f, 0xf9, 0xf9, 0xc7, 0xfa, 0x01, 0x01, 0xd3, 0xf9, 0xe8, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf6, 0xfb, 0xf4, 0xf3, 0xf5, 0xf6, 0xf8, 0xb5, 0x05, 0x13, 0x8a, 0x5c, 0x24, 0x5c, 0x5d, 0x5c, 0x5d, 0x5d, 0x23, 0x5d, 0x20, 0x1e, 0xa1, 0xf8, 0xed, 0xf5, 0xea, 0xed, 0xf4, 0xf4, 0xf3, 0xf4, 0xef, 0xf5, 0x52, 0x01, 0x5a, 0xf9, 0xf4, 0xed, 0xf4, 0xf4, 0xfb, 0xfd, 0xf3, 0xea, 0xec, 0xec, 0x8f, 0x21, 0x62, 0x2b, 0x27, 0x28, 0x24, 0x2e, 0x16, 0x05, 0x12, 0xf3, 0xf1, 0xf4, 0xf6, 0xf4, 0xf3, 0xee, 0xea, 0x4f, 0x01, 0x69, 0xf9, 0xf2, 0xf4, 0xf6, 0xf4, 0xf4, 0xf5, 0xf3, 0xf4, 0xf2, 0xf0, 0xf3, 0xf0, 0xf9, 0xd3, 0x4d, 0x01, 0x01, 0x8c, 0xf9, 0xf9, 0xdf, 0x54, 0x04, 0x01, 0x75, 0xf9, 0xef, 0xf3, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf9, 0xd0, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xbe, 0xf8, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xfe, 0xff, 0xfe, 0xec, 0xeb, 0xe7, 0xd2, 0xc1, 0xbf, 0xc3, 0xc3, 0xd8, 0xe1, 0xce, 0xcc, 0xd1, 0xd7, 0xb5, 0x63, 0x03, 0x03, 0x66, 0xea, 0xf8, 0xec, 0xf1, 0xf4, 0xee, 0xf4, 0xee, 0xf3, 0xee, 0xef, 0xf8, 0x54, 0x01, 0x01, 0x79, 0xf9, 0xf9, 0xd6, 0x4f, 0x01, 0xfa, 0xc7, 0xf9, 0xee, 0xee, 0xf3, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xf7, 0xf4, 0xee, 0xe8, 0xf9, 0xe5, 0x0a, 0x06, 0x7a, 0x93, 0x28, 0x5d, 0x5c, 0x23, 0x5c, 0x23, 0x23, 0x5d, 0x23, 0x24, 0x58, 0x89, 0xf8, 0xed, 0xf4, 0xed, 0xed, 0xf3, 0xf0, 0xf2, 0xf5, 0xef, 0xe4, 0x52, 0x01, 0x5e, 0xf9, 0xf4, 0xf4, 0xf4, 0xfb, 0xf5, 0xfb, 0xf3, 0xf3, 0xec, 0xee, 0xe3, 0x4a, 0x1f, 0x2c, 0x27, 0x2d, 0x27, 0x2e, 0x5b, 0x0b, 0x08, 0x90, 0xf8, 0xed, 0xf3, 0xf4, 0xf3, 0xef, 0xea, 0x50, 0x01, 0x69, 0xf9, 0xf2, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf2, 0xf9, 0xbe, 0x4c, 0x01, 0x01, 0xc7, 0xf9, 0xf9, 0xd9, 0x53, 0x01, 0x01, 0x82, 0xf9, 0xef, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xee, 0xef, 0xdd, 0x01, 0x01, 0x04, 0x01, 0x01, 0x9f, 0xf9, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xf4, 0xfb, 0xfe, 0xf3, 0xf3, 0xec, 0xeb, 0xeb, 0xd8, 0xce, 0xc6, 0xcb, 0xce, 0xdb, 0xd7, 0xd7, 0xb6, 0x6d, 0x03, 0x03, 0x0a, 0x8e, 0xd7, 0xf8, 0xe9, 0xeb, 0xec, 0xf6, 0xf6, 0xf6, 0xfd, 0xf0, 0xff, 0xf9, 0x69, 0x01, 0x01, 0x75, 0xf9, 0xf9, 0xe4, 0x52, 0x01, 0x01, 0xca, 0xf9, 0xee, 0xee, 0xf3, 0xed, 0xf3, 0xed, 0xed, 0xf4, 0xed, 0xf6, 0xf6, 0xe8, 0xee, 0xee, 0xe3, 0x56, 0x05, 0x2e, 0x93, 0x8b, 0x72, 0x5c, 0x24, 0x24, 0x5d, 0x24, 0x5d, 0x23, 0x23, 0x27, 0x58, 0x74, 0xf8, 0xed, 0xf5, 0xea, 0xf3, 0xf3, 0xf3, 0xf2, 0xf6, 0xef, 0xe2, 0x4f, 0x01, 0x69, 0xf9, 0xf4, 0xed, 0xf4, 0xed, 0xf3, 0xf5, 0xf4, 0xed, 0xf4, 0xec, 0xf0, 0xde, 0x25, 0x2e, 0x27, 0x2b, 0x2b, 0x28, 0x2e, 0x15, 0x0a, 0x0d, 0xe3, 0xf1, 0xf3, 0xf4, 0xf5, 0xf0, 0xe8, 0x4f, 0x01, 0x69, 0xf9, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf6, 0xf6, 0xf4, 0xf4, 0xf3, 0xef, 0xf2, 0xf9, 0xca, 0x04, 0x01, 0x4c, 0xca, 0xf9, 0xf9, 0xdf, 0x54, 0x01, 0x01, 0x71, 0xef, 0xef, 0xf5, 0xf3, 0xf5, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf9, 0xf9, 0x75, 0x01, 0x01, 0x01, 0xfa, 0xd9, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf4, 0xee, 0xf2, 0xed, 0xed, 0xf0, 0xf1, 0xf8, 0xa1, 0x97, 0xb0, 0xd8, 0xd7, 0xaa, 0x6d, 0x08, 0x01, 0x05, 0x29, 0xae, 0xb0, 0xd4, 0xf8, 0xed, 0xed, 0xee, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf9, 0xbe, 0x01, 0x01, 0x51, 0xee, 0xf8, 0xf9, 0x75, 0x01, 0x01, 0x8c, 0xf9, 0xef, 0xed, 0xf6, 0xed, 0xf3, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf3, 0xfb, 0xf8, 0xea, 0xf9, 0x6d, 0x01, 0x1e, 0x8a, 0x88, 0x85, 0x81, 0x5c, 0x23, 0x5d, 0x23, 0x23, 0x23, 0x23, 0x23, 0x27, 0x5b, 0x63, 0xeb, 0xf1, 0xed, 0xed, 0xed, 0xf4, 0xf4, 0xf2, 0xf5, 0xf8, 0xdd, 0x4d, 0x01, 0x71, 0xf9, 0xf4, 0xed, 0xf5, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf3, 0xed, 0xec, 0xec, 0xa1, 0x1c, 0x35, 0x20, 0x2d, 0x27, 0x31, 0x58, 0x0e, 0x06, 0x99, 0xf9, 0xed, 0xed, 0xf5, 0xef, 0xe2, 0x4f, 0x01, 0x71, 0xf9, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xf4, 0xf6, 0xf3, 0xf4, 0xf6, 0xf4, 0xf6, 0xf9, 0x91, 0x01, 0x01, 0x53, 0xe4, 0xf9, 0xf9, 0xd9, 0x55, 0x01, 0x01, 0x64, 0xf2, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xee, 0xf2, 0xef, 0xef, 0x75, 0x01, 0x4d, 0x9f, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xec, 0xec, 0xec, 0xf0, 0xfe, 0xf9, 0xe4, 0x69, 0x07, 0x0f, 0x08, 0x22, 0x0a, 0x01, 0x01, 0x07, 0x29, 0xa9, 0xc6, 0x9e, 0xae, 0xe7, 0xf1, 0xfb, 0xea, 0xef, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xdf, 0x4e, 0x01, 0x50, 0xdf, 0xf8, 0xf9, 0x96, 0x01, 0x01, 0x79, 0xf9, 0xef, 0xf2, 0xee, 0xf6, 0xed, 0xf3, 0xf3, 0xee, 0xf4, 0xed, 0xed, 0xf6, 0xf4, 0xe8, 0xf9, 0x7f, 0x01, 0x16, 0x92, 0x8b, 0x88, 0x88, 0x8a, 0x6b, 0x5c, 0x23, 0x24, 0x23, 0x23, 0x23, 0x23, 0x20, 0x60, 0x59, 0xdc, 0xf0, 0xf3, 0xea, 0xf5, 0xf3, 0xf6, 0xf3, 0xf5, 0xf9, 0xd0, 0x01, 0x01, 0x8c, 0xf9, 0xf4, 0xf5, 0xea, 0xed, 0xea, 0xea, 0xec, 0xec, 0xec, 0xf3, 0xee, 0xed, 0xe6, 0x6f, 0x60, 0x2d, 0x27, 0x28, 0x2c, 0x2a, 0x11, 0x0b, 0x57, 0xe9, 0xec, 0xee, 0xf5, 0xee, 0xdd, 0x4c, 0x01, 0x82, 0xf9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xee, 0xf3, 0xf3, 0xf5, 0xf9, 0x96, 0x01, 0x01, 0x5a, 0xf8, 0xef, 0xf9, 0xef, 0x69, 0x01, 0x01, 0x51, 0xca, 0xf9, 0xf0, 0xf5, 0xee, 0xf6, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf6, 0xf6, 0xf4, 0xf5, 0xf9, 0xd9, 0xe2, 0xf9, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xec, 0xf6, 0xf4, 0xea, 0xf8, 0xe5, 0x7f, 0x64, 0x12, 0x50, 0x07, 0x01, 0x03, 0x0e, 0x74, 0x9a, 0xc6, 0xb3, 0xab, 0xa6, 0xc0, 0xeb, 0xf3, 0xf7, 0xf5, 0xf5, 0xee, 0xf2, 0xf0, 0xf6, 0xf9, 0x71, 0x01, 0x01, 0xac, 0xf9, 0xef, 0xe8, 0x4d, 0x01, 0x52, 0xe4, 0xf8, 0xe8, 0xee, 0xf4, 0xf6, 0xf4, 0xf4, 0xed, 0xf3, 0xee, 0xee, 0xed, 0xf3, 0xf5, 0xf9, 0xaa, 0x03, 0x10, 0x8d, 0x8a, 0x8a, 0x88, 0x88, 0x85, 0x47, 0x5d, 0x1d, 0x20, 0x20, 0x23, 0x21, 0x62, 0x20, 0x60, 0x1a, 0xc9, 0xf8, 0xed, 0xfe, 0xed, 0xf4, 0xf3, 0xf3, 0xf6, 0xf9, 0xb1, 0x01, 0x01, 0x9f, 0xf9, 0xf3, 0xed, 0xf5, 0xed, 0xed, 0xec, 0xed, 0xed, 0xed, 0xf3, 0xf4, 0xf2, 0xf1, 0x95, 0x5b, 0x28, 0x2b, 0x2b, 0x28, 0x28, 0x1a, 0x11, 0x0e, 0xcf, 0xef, 0xed, 0xf3, 0xef, 0xd3, 0x4c, 0x01, 0x82, 0xf9, 0xf5, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf6, 0xf4, 0xf4, 0xf3, 0xf6, 0xef, 0xf8, 0x64, 0x01, 0x01, 0x82, 0xf9, 0xee, 0xf9, 0xf5, 0x79, 0x00, 0x01, 0x4d, 0xb1, 0xf9, 0xf9, 0xf2, 0xef, 0xf6, 0xf3, 0xf3, 0xf4, 0xf3, 0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xf3, 0xf0, 0xe8, 0xf0, 0xf8, 0xf9, 0xf0, 0xf3, 0xf6, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xff, 0xf5, 0xee, 0xe7, 0x9a, 0x42, 0xc2, 0x78, 0x4d, 0x5a, 0x79, 0xa1, 0xbc, 0xc3, 0xbb, 0xb4, 0xad, 0xa8, 0xa1, 0xd1, 0xf1, 0xf0, 0xed, 0xee, 0xee, 0xf2, 0xef, 0xf2, 0xf9, 0xd3, 0x01, 0x01, 0x69, 0xef, 0xf5, 0xf8, 0x75, 0x01, 0x01, 0xc7, 0xf9, 0xf0, 0xea, 0xed, 0xf6, 0xf4, 0xf5, 0xed, 0xf5, 0xed, 0xe8, 0xe8, 0xf0, 0xf2, 0xf9, 0xd0, 0x08, 0x09, 0x8a, 0x8b, 0x8b, 0x8a, 0x8b, 0x81, 0x88, 0x8a, 0x2e, 0x1d, 0x27, 0x20, 0x20, 0x60, 0x5b, 0x23, 0x5d, 0x58, 0x9a, 0xf1, 0xfd, 0xfe, 0xf6, 0xec, 0xf2, 0xf0, 0xf5, 0xf9, 0x8c, 0x01, 0x01, 0xbe, 0xf9, 0xf4, 0xed, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xed, 0xf6, 0xf6, 0xf1, 0xc0, 0x5b, 0x28, 0x28, 0x28, 0x28, 0x28, 0x21, 0x11, 0x0b, 0xa1, 0xf8, 0xf4, 0xf2, 0xf9, 0xbe, 0x02, 0x01, 0x9f, 0xf9, 0xf5, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xee, 0xf3, 0xf3, 0xf8, 0xf2, 0x55, 0x01, 0x01, 0x9f, 0xf9, 0xf5, 0xf8, 0xf9, 0xac, 0x4f, 0x01, 0x01, 0x5a, 0xe2, 0xf9, 0xee, 0xf3, 0xf3, 0xf4, 0xf6, 0xf6, 0xf6, 0xf4, 0xf3, 0xf6, 0xf6, 0xf3, 0xf6, 0xf0, 0xf9, 0xf0, 0x82, 0x79, 0xf9, 0xf2, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf3, 0xed, 0xf3, 0xf5, 0xf8, 0xd1, 0x42, 0x8d, 0x92, 0xaa, 0x9f, 0xd6, 0xc2, 0xae, 0xb3, 0xb3, 0xad, 0xad, 0xad, 0xaf, 0xa0, 0xe1, 0xf0, 0xed, 0xf6, 0xed, 0xf4, 0xef, 0xf2, 0xef, 0xef, 0x69, 0x01, 0x4f, 0xd9, 0xf9, 0xf5, 0xca, 0x04, 0x01, 0x69, 0xf9, 0xf3, 0xe8, 0xea, 0xee, 0xf4, 0xf4, 0xf4, 0xed, 0xf5, 0xed, 0xee, 0xed, 0xf3, 0xee, 0xea, 0x12, 0x08, 0x80, 0x8a, 0x8b, 0x88, 0x8b, 0x85, 0x88, 0x81, 0x83, 0x87, 0x60, 0x1f, 0x27, 0x20, 0x24, 0x24, 0x62, 0x5c, 0x5b, 0x7b, 0xec, 0xed, 0xff, 0xf5, 0xed, 0xec, 0xf6, 0xee, 0xf9, 0x64, 0x01, 0x4d, 0xd9, 0xf6, 0xf4, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xed, 0xfb, 0xf5, 0xec, 0xcc, 0x5d, 0x28, 0x2c, 0x28, 0x2b, 0x28, 0x28, 0x11, 0x10, 0x78, 0xf8, 0xee, 0xf2, 0xf9, 0x96, 0x04, 0x01, 0xc7, 0xf9, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf6, 0xf9, 0xd0, 0x4e, 0x01, 0x4d, 0xe2, 0xf9, 0xf5, 0xf2, 0xf9, 0xd9, 0x64, 0x01, 0x01, 0x51, 0x8c, 0xf2, 0xf9, 0xf8, 0xf0, 0xf4, 0xf3, 0xf2, 0xf4, 0xf0, 0xf3, 0xf3, 0xf3, 0xf0, 0xf0, 0xf6, 0x71, 0x01, 0xa5, 0xf8, 0xf0, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xe8, 0xed, 0xf8, 0x9a, 0x8d, 0x93, 0x8d, 0xb8, 0xd1, 0xd6, 0xcc, 0xa9, 0xba, 0xad, 0xb4, 0xb4, 0xaf, 0xa6, 0xaa, 0xe9, 0xf0, 0xf6, 0xf6, 0xf6, 0xf6, 0xee, 0xe8, 0xf9, 0xd0, 0x4c, 0x01, 0x8c, 0xf9, 0xe2, 0xf9, 0x5a, 0x01, 0x4c, 0xd3, 0xf9, 0xed, 0xf0, 0xed, 0xed, 0xec, 0xed, 0xed, 0xed, 0xee, 0xe8, 0xf3, 0xed, 0xf2, 0xf9, 0x70, 0x03, 0x7e, 0x93, 0x8b, 0x88, 0x88, 0x88, 0x85, 0x8b, 0x83, 0x7c, 0xc0, 0xce, 0x1e, 0x1f, 0x62, 0x23, 0x20, 0x24, 0x5d, 0x60, 0x6a, 0xde, 0xef, 0xf5, 0xf4, 0xed, 0xf4, 0xf5, 0xf8, 0xe2, 0x53, 0x01, 0x51, 0xe8, 0xf8, 0xf3, 0xf4, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xfe, 0xfd, 0xf1, 0xc8, 0x5b, 0x2c, 0x2c, 0x2b, 0x28, 0x2b, 0x62, 0x18, 0x0e, 0x63, 0xf9, 0xf3, 0xf5, 0xf9, 0x79, 0x04, 0x01, 0xd9, 0xf8, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf6, 0xf4, 0xf9, 0x9f, 0x00, 0x01, 0x5a, 0xf9, 0xef, 0xee, 0xf5, 0xef, 0xf9, 0xa5, 0x50, 0x01, 0x01, 0x52, 0x96, 0xe4, 0xf9, 0xf8, 0xf9, 0xf8, 0xef, 0xf5, 0xef, 0xf8, 0xf8, 0xf9, 0xf6, 0x55, 0x01, 0x69, 0xf0, 0xf6, 0xf6, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf5, 0xf3, 0xed, 0xed, 0xec, 0xf1, 0xa0, 0x93, 0x9c, 0x9e, 0xcb, 0xf6, 0xeb, 0xe1, 0xb6, 0xb3, 0xb3, 0xba, 0xaf, 0xb4, 0xa7, 0xc8, 0xf8, 0xec, 0xff, 0xee, 0xff, 0xee, 0xf3, 0xf8, 0xf9, 0x69, 0x01, 0x51, 0xdf, 0xef, 0xee, 0xd9, 0x01, 0x01, 0x71, 0xf9, 0xf3, 0xe8, 0xed, 0xec, 0xed, 0xec, 0xec, 0xea, 0xed, 0xf5, 0xef, 0xf4, 0xf3, 0xf8, 0xb2, 0x05, 0x39, 0x92, 0x85, 0x8b, 0x88, 0x88, 0x88, 0x85, 0x83, 0x7c, 0xb8, 0xeb, 0xf0, 0xb0, 0x1a, 0x61, 0x27, 0x23, 0x23, 0x62, 0x60, 0x1e, 0xcf, 0xf8, 0xee, 0xf5, 0xf6, 0xed, 0xf4, 0xf9, 0xd3, 0x4d, 0x01, 0x5a, 0xf9, 0xf6, 0xee, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xed, 0xfb, 0xfe, 0xf1, 0xae, 0x5b, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x5b, 0x11, 0x57, 0xf1, 0xed, 0xf2, 0xf9, 0x5e, 0x02, 0x4e, 0xee, 0xfd, 0xf4, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf3, 0xf2, 0xf0, 0xf5, 0xf9, 0x5e, 0x4c, 0x01, 0x96, 0xf9, 0xf5, 0xf5, 0xf8, 0xf2, 0xf9, 0xef, 0x75, 0x50, 0x01, 0x01, 0x4e, 0x69, 0xac, 0xd9, 0xe4, 0xef, 0xf9, 0xf8, 0xf2, 0xdf, 0x91, 0x50, 0x01, 0x69, 0xf2, 0xf9, 0xf3, 0xf2, 0xee, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xea, 0xec, 0xec, 0xe6, 0xaf, 0x9c, 0xa4, 0x9b, 0xde, 0xf1, 0xf2, 0xeb, 0xcf, 0xb9, 0xb3, 0xbb, 0xb3, 0xaf, 0xa7, 0xd4, 0xf1, 0xee, 0xf5, 0xf5, 0xf4, 0xf5, 0xed, 0xef, 0xf8, 0x01, 0x01, 0x75, 0xf9, 0xe8, 0xf9, 0x82, 0x01, 0x01, 0xd0, 0xf9, 0xe8, 0xee, 0xed, 0xea, 0xec, 0xea, 0xed, 0xea, 0xed, 0xf3, 0xf3, 0xf2, 0xf1, 0xf9, 0x0f, 0x13, 0x92, 0x8a, 0x88, 0x88, 0x88, 0x8b, 0x8b, 0x80, 0x7c, 0xc4, 0xf1, 0xe9, 0xee, 0xee, 0x70, 0x5b, 0x23, 0x27, 0x23, 0x60, 0x5d, 0x1e, 0xa7, 0xf8, 0xed, 0xf4, 0xf3, 0xf2, 0xf3, 0xf9, 0xb1, 0x00, 0x01, 0x82, 0xf9, 0xf3, 0xf0, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf5, 0xf5, 0xec, 0x8f, 0x5b, 0x67, 0x2c, 0x28, 0x2b, 0x28, 0x2b, 0x21, 0x11, 0x19, 0xe6, 0xed, 0xfd, 0xf9, 0x53, 0x01, 0x53, 0xf9, 0xf4, 0xf5, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf3, 0xf9, 0xd0, 0x4e, 0x00, 0x50, 0xf9, 0xf9, 0xf2, 0xef, 0xee, 0xef, 0xf8, 0xf9, 0xdd, 0x71, 0x4d, 0x01, 0x01, 0x01, 0x4e, 0x53, 0x55, 0x5a, 0x5a, 0x54, 0x4e, 0x01, 0xfa, 0x96, 0xf8, 0xf8, 0xf3, 0xee, 0xfd, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xea, 0xee, 0xea, 0xec, 0xe1, 0xaf, 0xad, 0xad, 0xa3, 0xe1, 0xf1, 0xf7, 0xf0, 0xe5, 0xb7, 0xbd, 0xb9, 0xb9, 0xaf, 0xa7, 0xde, 0xec, 0xee, 0xf4, 0xf5, 0xf6, 0xed, 0xed, 0xf9, 0xbe, 0x01, 0x02, 0xd0, 0xf9, 0xe8, 0xe8, 0x51, 0x01, 0x53, 0xf9, 0xee, 0xee, 0xea, 0xf3, 0xec, 0xea, 0xec, 0xea, 0xed, 0xf3, 0xf5, 0xf2, 0xf0, 0xf8, 0xac, 0x05, 0x7c, 0x93, 0x8b, 0x88, 0x8b, 0x8b, 0x8a, 0x7c, 0x8d, 0xd7, 0xf1, 0xec, 0xec, 0xea, 0xf8, 0xd4, 0x29, 0x60, 0x20, 0x24, 0x62, 0x62, 0x1c, 0x89, 0xf8, 0xea, 0xf5, 0xf3, 0xf8, 0xf2, 0xf9, 0x82, 0x01, 0x01, 0xb1, 0xf9, 0xf5, 0xf4, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xed, 0xf6, 0xe8, 0xe9, 0x39, 0x62, 0x2c, 0x2b, 0x2c, 0x2b, 0x28, 0x2b, 0x27, 0x15, 0x16, 0xe9, 0xed, 0xf0, 0xdf, 0x4d, 0x01, 0x71, 0xf9, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf2, 0xf9, 0x8c, 0x01, 0x01, 0x8c, 0xf9, 0xf0, 0xf3, 0xf6, 0xf3, 0xf5, 0xf6, 0xf8, 0xf9, 0xf9, 0xb1, 0x64, 0x52, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x82, 0xe2, 0xf9, 0xef, 0xf4, 0xf5, 0xf4, 0xf4, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xec, 0xea, 0xf1, 0xe1, 0xbb, 0xb4, 0xad, 0x9b, 0xde, 0xf6, 0xfc, 0xf3, 0xf8, 0xcc, 0xbd, 0xbd, 0xbc, 0xb3, 0xa7, 0xde, 0xf1, 0xed, 0xf5, 0xf6, 0xed, 0xf4, 0xea, 0xf9, 0x69, 0x01, 0x53, 0xee, 0xed, 0xf8, 0xca, 0x01, 0x01, 0x79, 0xf9, 0xf5, 0xed, 0xf3, 0xea, 0xed, 0xec, 0xea, 0xea, 0xed, 0xf3, 0xf5, 0xf1, 0xee, 0xf1, 0x22, 0x16, 0x93, 0x8b, 0x8b, 0x88, 0x8b, 0x8b, 0x7e, 0x8f, 0xe1, 0xf1, 0xf1, 0xe9, 0xef, 0xf6, 0xf3, 0xf8, 0x8e, 0x1f, 0x21, 0x62, 0x62, 0x62, 0x1f, 0x42, 0xec, 0xee, 0xee, 0xf4, 0xf6, 0xe8, 0xf9, 0x5e, 0x01, 0x4e, 0xd9, 0xf9, 0xf6, 0xf3, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf4, 0xea, 0xf0, 0xc8, 0x25, 0x67, 0x68, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x27, 0x1a, 0x19, 0xe6, 0xec, 0xf9, 0xc7, 0x01, 0x01, 0x96, 0xf9, 0xf5, 0xe8, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf4, 0xf4, 0xf6, 0xf5, 0xf8, 0x50, 0x4c, 0x53, 0xe8, 0xf9, 0xf3, 0xee, 0xf0, 0xe8, 0xf8, 0xf6, 0xf2, 0xef, 0xf9, 0xf9, 0xe2, 0xca, 0xb1, 0x96, 0x96, 0xa5, 0xbe, 0xe2, 0xf9, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xec, 0xed, 0xec, 0xec, 0xda, 0xc1, 0xba, 0xba, 0xa3, 0xce, 0xf1, 0xfc, 0xf6, 0xf1, 0xe1, 0xbd, 0xbd, 0xbb, 0xaf, 0xae, 0xce, 0xf8, 0xed, 0xf4, 0xed, 0xec, 0xed, 0xef, 0xe4, 0x0f, 0x01, 0x71, 0xf9, 0xe8, 0xf9, 0x86, 0x01, 0x01, 0xd0, 0xef, 0xee, 0xe8, 0xed, 0xed, 0xea, 0xed, 0xed, 0xf3, 0xf3, 0xf5, 0xfb, 0xed, 0xf0, 0xd6, 0x08, 0x7b, 0x8b, 0x85, 0x8b, 0x8b, 0x8b, 0x77, 0xae, 0xeb, 0xf1, 0xf7, 0xf7, 0xf3, 0xed, 0xf0, 0xf7, 0xf1, 0xeb, 0x29, 0x26, 0x61, 0x24, 0x23, 0x61, 0x29, 0xe3, 0xea, 0xee, 0xf3, 0xf4, 0xf8, 0xf2, 0x4d, 0x01, 0x54, 0xef, 0xf5, 0xf4, 0xf4, 0xed, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xed, 0xf4, 0xf4, 0xec, 0xec, 0x7b, 0x24, 0x68, 0x30, 0x2b, 0x2f, 0x2c, 0x2c, 0x2b, 0x27, 0x1b, 0x59, 0xec, 0xe9, 0xf9, 0x82, 0x01, 0x4d, 0xd3, 0xf0, 0xef, 0xf2, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf4, 0xf4, 0xf6, 0xf6, 0xf9, 0x91, 0x02, 0xfa, 0xa5, 0xf9, 0xf0, 0xf3, 0xf6, 0xf0, 0xe4, 0xf4, 0xf0, 0xf2, 0xee, 0xf5, 0xee, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xec, 0xec, 0xf1, 0xe5, 0xc9, 0xcb, 0xba, 0xb4, 0xb4, 0xae, 0xe5, 0xf8, 0xf4, 0xeb, 0xeb, 0xce, 0xae, 0xbf, 0xbc, 0xaf, 0xaa, 0xe3, 0xf1, 0xed, 0xed, 0xed, 0xec, 0xed, 0xd3, 0x02, 0x4d, 0x99, 0xf9, 0xea, 0xf9, 0x5e, 0x01, 0x4f, 0xdd, 0xef, 0xf5, 0xed, 0xf3, 0xed, 0xec, 0xed, 0xed, 0xed, 0xf3, 0xf5, 0xf2, 0xf6, 0xf8, 0x99, 0x08, 0x92, 0x8b, 0x8b, 0x8b, 0x8b, 0x7c, 0xa6, 0xeb, 0xec, 0xf3, 0xfc, 0xfc, 0xf6, 0xed, 0xf6, 0xf3, 0xf3, 0xf0, 0xb8, 0x1c, 0x61, 0x62, 0x62, 0x60, 0x25, 0xda, 0xec, 0xf4, 0xf2, 0xf3, 0xf9, 0xd0, 0x01, 0x01, 0x69, 0xf9, 0xf6, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf4, 0xf3, 0xed, 0xf8, 0xcc, 0x1e, 0x31, 0x2b, 0x30, 0x2f, 0x2c, 0x2c, 0x2c, 0x2d, 0x2b, 0x18, 0x33, 0xf0, 0xec, 0xf9, 0x5a, 0x01, 0x52, 0xf6, 0xee, 0xf3, 0xf6, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xee, 0xf3, 0xf6, 0xf4, 0xf5, 0xf5, 0xf6, 0xf4, 0xf2, 0xf6, 0xef, 0xe2, 0x51, 0x02, 0x5a, 0xf9, 0xf6, 0xf5, 0xf2, 0xf6, 0xf6, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf6, 0xf2, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xec, 0xea, 0xeb, 0xf1, 0xcf, 0xa1, 0xd2, 0xba, 0xba, 0xba, 0xaf, 0xbd, 0xf1, 0xf4, 0xf6, 0xf1, 0xe1, 0xb6, 0xb9, 0xb3, 0xc1, 0xaf, 0xbd, 0xe1, 0xf1, 0xea, 0xfb, 0xf5, 0xf9, 0xac, 0x01, 0x07, 0xd3, 0xf9, 0xf3, 0xf9, 0x53, 0x01, 0x53, 0xe8, 0xef, 0xee, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf4, 0xed, 0xec, 0xf3, 0xee, 0xfb, 0xf9, 0x66, 0x15, 0x93, 0x88, 0x8b, 0x8a, 0x7c, 0xae, 0xe7, 0xec, 0xed, 0xfb, 0xfc, 0xf4, 0xf6, 0xed, 0xf3, 0xed, 0xe9, 0xf0, 0xea, 0x70, 0x5b, 0x60, 0x28, 0x5b, 0x5f, 0xd4, 0xed, 0xe9, 0xf8, 0xf8, 0xf1, 0x86, 0x01, 0x01, 0x96, 0xf9, 0xf7, 0xfb, 0xf3, 0xfb, 0xec, 0xed, 0xea, 0xf4, 0xf3, 0xf7, 0xe9, 0xf3, 0xe6, 0x48, 0x2a, 0x31, 0x67, 0x68, 0x2c, 0x2f, 0x67, 0x2c, 0x2d, 0x2b, 0x1a, 0x7f, 0xf8, 0xf0, 0xdf, 0x51, 0x01, 0x69, 0xf9, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf9, 0x79, 0x01, 0x4e, 0xd9, 0xf8, 0xee, 0xf3, 0xee, 0xed, 0xf3, 0xed, 0xee, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xee, 0xf4, 0xed, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xec, 0xf0, 0xd7, 0x9a, 0xcb, 0xcb, 0xb4, 0xbf, 0xbb, 0xae, 0xc9, 0xf1, 0xf7, 0xf2, 0xf1, 0xcc, 0xb7, 0xbc, 0xb3, 0xb9, 0xb6, 0xb7, 0xde, 0xf1, 0xf3, 0xf3, 0xf9, 0x86, 0x02, 0x53, 0xe5, 0xf0, 0xf0, 0xf8, 0x51, 0x01, 0x5a, 0xf9, 0xe8, 0xf4, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xfb, 0xed, 0xea, 0xea, 0xf5, 0xfd, 0xf8, 0x12, 0x65, 0x8b, 0x88, 0x8b, 0x87, 0xa0, 0xeb, 0xec, 0xe6, 0xed, 0xff, 0xf6, 0xf4, 0xf7, 0xed, 0xed, 0xed, 0xea, 0xec, 0xf9, 0xc5, 0x1a, 0x2f, 0x23, 0x28, 0x1a, 0xd1, 0xec, 0xe5, 0xa1, 0x6a, 0x78, 0x17, 0x03, 0x02, 0x99, 0xd9, 0xf1, 0xf1, 0xf3, 0xf4, 0xf4, 0xea, 0xea, 0xed, 0xf3, 0xf3, 0xec, 0xf8, 0xa9, 0x21, 0x31, 0x31, 0x68, 0x2c, 0x68, 0x2c, 0x67, 0x2c, 0x2d, 0x2b, 0x1c, 0xb5, 0xf8, 0xf9, 0xac, 0x01, 0x01, 0xbe, 0xf8, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf0, 0xf6, 0xf8, 0xd0, 0x01, 0x02, 0x91, 0xf9, 0xed, 0xf0, 0xf4, 0xf4, 0xed, 0xed, 0xf3, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf4, 0xed, 0xed, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xed, 0xec, 0xf4, 0xec, 0xf1, 0xdc, 0xce, 0xd8, 0xbb, 0xbf, 0xbb, 0xbb, 0xa7, 0xd4, 0xf8, 0xeb, 0xf1, 0xde, 0xb6, 0xbc, 0xbc, 0xbc, 0xbc, 0xb6, 0xc2, 0xda, 0xf1, 0xe9, 0xf9, 0x70, 0x03, 0x56, 0xf2, 0xee, 0xf8, 0xf5, 0x50, 0x01, 0x69, 0xf9, 0xed, 0xf4, 0xf3, 0xed, 0xf3, 0xed, 0xf4, 0xf4, 0xf3, 0xea, 0xed, 0xf2, 0xfd, 0xf8, 0x0b, 0x42, 0x8b, 0x88, 0x83, 0x8f, 0xe7, 0xeb, 0xe9, 0xec, 0xee, 0xf3, 0xfb, 0xf4, 0xf4, 0xf4, 0xed, 0xed, 0xec, 0xea, 0xee, 0xe6, 0x61, 0x62, 0x20, 0x28, 0x1d, 0xc8, 0x9a, 0x1e, 0x15, 0x1a, 0x6a, 0x0d, 0x01, 0x0a, 0x14, 0x13, 0x7f, 0xf1, 0xf1, 0xf3, 0xed, 0xed, 0xea, 0xf3, 0xf6, 0xf3, 0xeb, 0xe1, 0x29, 0x31, 0x32, 0x68, 0x68, 0x38, 0x2f, 0x2f, 0x2f, 0x2c, 0x2b, 0x24, 0x5f, 0xde, 0xf6, 0xf9, 0x71, 0x01, 0x04, 0xe2, 0xf6, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xee, 0xf8, 0xf9, 0x50, 0x02, 0x64, 0xf9, 0xed, 0xf6, 0xed, 0xf6, 0xed, 0xf5, 0xed, 0xf4, 0xed, 0xf3, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xed, 0xf4, 0xed, 0xf1, 0xf1, 0xde, 0xc4, 0xbb, 0xbb, 0xb3, 0xb9, 0xb6, 0xd4, 0xf1, 0xf1, 0xec, 0xcc, 0xb6, 0xbc, 0xb9, 0xb9, 0xbc, 0xb6, 0xc2, 0xd1, 0xe7, 0xf8, 0x63, 0x03, 0x66, 0xf8, 0xed, 0xf8, 0xfd, 0x51, 0x01, 0x75, 0xf9, 0xf0, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf4, 0xf4, 0xf3, 0xea, 0xea, 0xf5, 0xf0, 0xe4, 0x0b, 0x42, 0x8b, 0x88, 0x87, 0xdb, 0xf1, 0xed, 0xed, 0xed, 0xe8, 0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xed, 0xed, 0xec, 0xee, 0xec, 0xec, 0x95, 0x1b, 0x27, 0x27, 0x27, 0x26, 0x15, 0x1f, 0x21, 0x1b, 0x29, 0x08, 0x02, 0x0e, 0x59, 0x1d, 0x0c, 0x97, 0xf1, 0xf4, 0xed, 0xed, 0xea, 0xf0, 0xf2, 0xed, 0xeb, 0x89, 0x25, 0x36, 0x35, 0x3a, 0x2f, 0x2f, 0x68, 0x2f, 0x67, 0x2f, 0x2c, 0x1d, 0x94, 0xf1, 0xee, 0xef, 0x4f, 0x01, 0x69, 0xf9, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf2, 0xf6, 0xf4, 0xf9, 0x69, 0x01, 0x50, 0xe4, 0xf8, 0xf3, 0xf6, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xed, 0xf4, 0xed, 0xed, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xed, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xed, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xed, 0xe9, 0xf0, 0xde, 0xc4, 0xbb, 0xb3, 0xb4, 0xaf, 0xb6, 0xe1, 0xf1, 0xf8, 0xde, 0xae, 0xb9, 0xbc, 0xbb, 0xb9, 0xc1, 0xb6, 0xbd, 0xce, 0xe0, 0x63, 0x03, 0x6d, 0xf0, 0xef, 0xed, 0xf9, 0x52, 0x01, 0x82, 0xf9, 0xf3, 0xee, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf4, 0xf3, 0xea, 0xec, 0xe8, 0xf9, 0xdd, 0x0b, 0x42, 0x93, 0x49, 0xb9, 0xeb, 0xf6, 0xe8, 0xff, 0xe8, 0xee, 0xec, 0xf3, 0xf4, 0xf4, 0xf4, 0xed, 0xed, 0xee, 0xec, 0xed, 0xf0, 0xc9, 0x58, 0x23, 0x20, 0x27, 0x1b, 0x21, 0x1d, 0x1d, 0x20, 0x5f, 0x03, 0x4d, 0x57, 0x1a, 0x18, 0x1b, 0x19, 0xe1, 0xf6, 0xec, 0xea, 0xed, 0xf2, 0xec, 0xf1, 0xd5, 0x65, 0x6c, 0x3a, 0x31, 0x2f, 0x3b, 0x2b, 0x30, 0x2f, 0x2f, 0x2f, 0x2e, 0x1e, 0xd5, 0xf0, 0xf8, 0xd0, 0x01, 0x01, 0x9f, 0xf8, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xf2, 0xf5, 0xf5, 0xee, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xef, 0xf9, 0x9f, 0x01, 0x4d, 0xd3, 0xf8, 0xf6, 0xed, 0xf6, 0xed, 0xf5, 0xed, 0xee, 0xee, 0xee, 0xed, 0xf5, 0xed, 0xee, 0xee, 0xed, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf6, 0xf5, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xed, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xed, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xfe, 0xf3, 0xff, 0xf5, 0xf6, 0xf4, 0xf1, 0xde, 0xb9, 0xaf, 0xb4, 0xbb, 0xb6, 0xb6, 0xde, 0xf1, 0xeb, 0xcc, 0xb6, 0xb9, 0xbb, 0xbb, 0xbb, 0xc1, 0xc1, 0xbd, 0xce, 0x5f, 0x06, 0x6d, 0xf8, 0xee, 0xf5, 0xf9, 0x55, 0x01, 0x91, 0xf9, 0xed, 0xf2, 0xf3, 0xed, 0xf3, 0xed, 0xf5, 0xf4, 0xf3, 0xea, 0xea, 0xf5, 0xf8, 0xd6, 0x09, 0x6c, 0x8b, 0x87, 0xe7, 0xec, 0xf2, 0xff, 0xfe, 0xf5, 0xf3, 0xec, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xed, 0xf3, 0xed, 0xec, 0xe9, 0x1e, 0x5d, 0x20, 0x20, 0x5c, 0x5b, 0x1d, 0x20, 0x2a, 0x19, 0x02, 0x53, 0x57, 0x18, 0x18, 0x1b, 0x14, 0xb5, 0xf8, 0xed, 0xed, 0xed, 0xf4, 0xeb, 0xf8, 0x8d, 0x2e, 0x35, 0x36, 0x35, 0x34, 0x2b, 0x34, 0x30, 0x35, 0x2c, 0x31, 0x1f, 0x94, 0xf1, 0xea, 0xf9, 0x79, 0x01, 0x4d, 0xf2, 0xf0, 0xf6, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf4, 0xf5, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf3, 0xf5, 0xf6, 0xf4, 0xf9, 0xd3, 0x04, 0x01, 0xa5, 0xf9, 0xf4, 0xed, 0xf4, 0xed, 0xee, 0xf2, 0xef, 0xf2, 0xf3, 0xee, 0xee, 0xee, 0xf2, 0xf3, 0xee, 0xf3, 0xef, 0xf2, 0xf9, 0xf9, 0xf9, 0xf9, 0xee, 0xf4, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xed, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf1, 0xd7, 0xb9, 0xb3, 0xbb, 0xc1, 0xb6, 0xb8, 0xe3, 0xf1, 0xdb, 0xbd, 0xb9, 0xbb, 0xbb, 0xbb, 0xbb, 0xc1, 0xc4, 0xcb, 0x29, 0x08, 0x63, 0xef, 0xf0, 0xee, 0xf9, 0x71, 0x01, 0xa5, 0xf9, 0xed, 0xf6, 0xf3, 0xf4, 0xed, 0xf3, 0xed, 0xfb, 0xed, 0xea, 0xec, 0xe8, 0xf9, 0xd6, 0x09, 0x76, 0x7a, 0xc0, 0xeb, 0xec, 0xfb, 0xfe, 0xfe, 0xf5, 0xed, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf6, 0xf8, 0x6f, 0x58, 0x23, 0x20, 0x5b, 0x5d, 0x5b, 0x1d, 0x2e, 0x0b, 0x03, 0x17, 0x59, 0x58, 0x1b, 0x18, 0x16, 0xaa, 0xf8, 0xed, 0xed, 0xed, 0xf3, 0xed, 0xe7, 0x65, 0x36, 0x2f, 0x35, 0x35, 0x35, 0x2f, 0x68, 0x38, 0x2f, 0x31, 0x2a, 0x33, 0xdc, 0xee, 0xec, 0xe4, 0x53, 0x01, 0x64, 0xf9, 0xf6, 0xf3, 0xf4, 0xf4, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf8, 0xdf, 0x51, 0x01, 0x8c, 0xf9, 0xed, 0xf6, 0xf4, 0xed, 0xf5, 0xee, 0xf3, 0xed, 0xed, 0xee, 0xf3, 0xed, 0xee, 0xee, 0xed, 0xfd, 0xe8, 0xf9, 0xd6, 0x8c, 0x79, 0xb1, 0xf8, 0xf5, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xed, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xed, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xed, 0xf4, 0xf3, 0xf4, 0xf4, 0xf5, 0xf5, 0xfb, 0xf1, 0xeb, 0xd2, 0xaf, 0xbb, 0xb9, 0xc1, 0xb6, 0xc1, 0xe7, 0xeb, 0xc4, 0xb9, 0xbc, 0xc3, 0xbb, 0xbb, 0xc1, 0xc6, 0xcb, 0x65, 0x0e, 0x57, 0xf3, 0xef, 0xed, 0xf9, 0x91, 0x01, 0xca, 0xf9, 0xf2, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf4, 0xf3, 0xec, 0xea, 0xed, 0xfd, 0xd4, 0x08, 0x44, 0x7c, 0xe0, 0xec, 0xeb, 0xfb, 0xf6, 0xf3, 0xed, 0xf3, 0xf3, 0xf6, 0xed, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf8, 0x94, 0x18, 0x20, 0x20, 0x5c, 0x60, 0x21, 0x5d, 0x33, 0x05, 0x0b, 0x5f, 0x1c, 0x18, 0x1b, 0x58, 0x19, 0xa7, 0xf8, 0xf4, 0xed, 0xf3, 0xf2, 0xf8, 0xcc, 0x61, 0x68, 0x3b, 0x6b, 0x35, 0x68, 0x38, 0x68, 0x35, 0x31, 0x32, 0x21, 0xb0, 0xf8, 0xe6, 0xf9, 0xa5, 0x01, 0x01, 0xb1, 0xf8, 0xf7, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf6, 0xf4, 0xf0, 0xef, 0x53, 0x01, 0x79, 0xf9, 0xed, 0xf4, 0xee, 0xf4, 0xed, 0xed, 0xee, 0xee, 0xf2, 0xee, 0xf8, 0xf8, 0xf0, 0xf3, 0xed, 0xf2, 0xf8, 0xdf, 0x4e, 0x01, 0x01, 0x01, 0x91, 0xf9, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xed, 0xed, 0xec, 0xed, 0xec, 0xed, 0xed, 0xed, 0xfd, 0xfb, 0xf1, 0xe6, 0xce, 0xaf, 0xc1, 0xbb, 0xc1, 0xb3, 0xbd, 0xe1, 0xd8, 0xb6, 0xbb, 0xc1, 0xbb, 0xc1, 0xc1, 0xc1, 0xcb, 0x65, 0x14, 0x14, 0xdd, 0xef, 0xed, 0xf9, 0x79, 0x01, 0xe2, 0xef, 0xed, 0xf4, 0xf6, 0xf3, 0xed, 0xf3, 0xed, 0xfb, 0xf4, 0xec, 0xea, 0xf5, 0xf9, 0xd6, 0x06, 0x2f, 0x8d, 0xe9, 0xeb, 0xf6, 0xf3, 0xeb, 0xec, 0xea, 0xf4, 0xfb, 0xf4, 0xed, 0xf6, 0xf3, 0xf6, 0xf3, 0xf4, 0xf4, 0xfb, 0xed, 0xf8, 0x97, 0x18, 0x20, 0x20, 0x1d, 0x21, 0x5b, 0x24, 0x5f, 0x05, 0x16, 0x1c, 0x18, 0x1b, 0x58, 0x58, 0x16, 0xc8, 0xf0, 0xec, 0xf3, 0xf3, 0xf3, 0xf1, 0x94, 0x2e, 0x37, 0x34, 0x38, 0x6b, 0x35, 0x35, 0x6b, 0x35, 0x31, 0x62, 0x83, 0xe6, 0xe9, 0xf5, 0xf9, 0x64, 0x01, 0x50, 0xe2, 0xf8, 0xf6, 0xf3, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xf4, 0xf6, 0xf3, 0xf4, 0xf6, 0xf4, 0xf0, 0xf9, 0x55, 0x01, 0x69, 0xf9, 0xf6, 0xed, 0xf6, 0xed, 0xf5, 0xed, 0xee, 0xf2, 0xf8, 0xf9, 0xe4, 0xd6, 0xe2, 0xf9, 0xf0, 0xef, 0xef, 0x96, 0x01, 0x01, 0x04, 0x01, 0x5a, 0xef, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xec, 0xe9, 0xf1, 0xf1, 0xeb, 0xf0, 0xee, 0xf2, 0xf5, 0xe9, 0xf1, 0xe1, 0xbd, 0xbd, 0xbb, 0xbb, 0xbb, 0xb7, 0xc4, 0xc4, 0xb9, 0xc1, 0xbb, 0xc1, 0xbb, 0xbc, 0xbc, 0xcb, 0x33, 0x19, 0x12, 0xaa, 0xf9, 0xf9, 0xf9, 0x52, 0x54, 0xf9, 0xf8, 0xe8, 0xf2, 0xec, 0xec, 0xed, 0xed, 0xf5, 0xf3, 0xf3, 0xea, 0xed, 0xf5, 0xf9, 0xd6, 0x09, 0x26, 0x9b, 0xf8, 0xf2, 0xeb, 0xf3, 0xf3, 0xec, 0xed, 0xed, 0xf4, 0xf3, 0xf6, 0xe8, 0xf6, 0xed, 0xf2, 0xf3, 0xf2, 0xf6, 0xf4, 0xf8, 0x8f, 0x18, 0x20, 0x20, 0x20, 0x21, 0x21, 0x2a, 0x13, 0x0b, 0x1c, 0x18, 0x1b, 0x1b, 0x18, 0x1a, 0x1c, 0xda, 0xec, 0xf3, 0xf2, 0xf3, 0xf6, 0xe5, 0x77, 0x32, 0x38, 0x34, 0x36, 0x6b, 0x6b, 0x38, 0x34, 0x38, 0x2c, 0x61, 0xd5, 0xe9, 0xed, 0xee, 0xe2, 0x04, 0x01, 0x71, 0xf8, 0xf6, 0xf3, 0xf0, 0xed, 0xf2, 0xf4, 0xed, 0xf3, 0xf4, 0xed, 0xf3, 0xf4, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf5, 0xf3, 0xee, 0xf4, 0xf5, 0xf6, 0xf9, 0x5a, 0x01, 0x69, 0xf8, 0xed, 0xf6, 0xf4, 0xf4, 0xee, 0xf3, 0xed, 0xee, 0xf9, 0x86, 0x51, 0x04, 0x50, 0x82, 0xf9, 0xef, 0xf8, 0x82, 0x01, 0x02, 0x04, 0x01, 0x69, 0xf9, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xeb, 0xf1, 0xdb, 0xcf, 0xe5, 0xeb, 0xf2, 0xf0, 0xea, 0xe5, 0xea, 0xf1, 0xdb, 0xb6, 0xbd, 0xbb, 0xbb, 0xbb, 0xb9, 0xb9, 0xbc, 0xb9, 0xbc, 0xbc, 0xb9, 0xbc, 0xb9, 0xcb, 0x6f, 0x16, 0x59, 0x70, 0xeb, 0xc5, 0x0f, 0x01, 0xac, 0xff, 0xee, 0xed, 0xeb, 0xeb, 0xec, 0xf3, 0xed, 0xf5, 0xea, 0xec, 0xed, 0xf3, 0xff, 0xfd, 0xe5, 0x08, 0x18, 0xa0, 0xf8, 0xea, 0xf5, 0xf2, 0xf4, 0xf4, 0xf3, 0xec, 0xea, 0xf4, 0xf4, 0xf0, 0xf0, 0xea, 0xf3, 0xec, 0xf4, 0xf4, 0xf3, 0xf8, 0x8e, 0x1a, 0x5c, 0x20, 0x23, 0x1d, 0x26, 0x1f, 0x0c, 0x16, 0x1c, 0x1b, 0x1b, 0x1b, 0x58, 0x19, 0x70, 0xea, 0xe9, 0xf3, 0xf2, 0xf5, 0xec, 0xd5, 0x65, 0x6c, 0x35, 0x36, 0x3a, 0x36, 0x6b, 0x68, 0x3b, 0x30, 0x2a, 0xa7, 0xf1, 0xec, 0xf2, 0xf9, 0x91, 0x01, 0x01, 0xd0, 0xf9, 0xf3, 0xf6, 0xe8, 0xec, 0xf0, 0xec, 0xf3, 0xec, 0xed, 0xec, 0xec, 0xf4, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf5, 0xf4, 0xf6, 0xf3, 0xee, 0xf9, 0x5a, 0x01, 0x69, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf0, 0xee, 0xf9, 0x91, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8c, 0xef, 0xf9, 0xd3, 0x4c, 0x01, 0x01, 0x4f, 0xd6, 0xef, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf1, 0xd5, 0x94, 0x89, 0x7b, 0xd7, 0xf8, 0xea, 0xf5, 0xf6, 0xec, 0xf3, 0xeb, 0xcc, 0xb6, 0xbc, 0xba, 0xbb, 0xbc, 0xb9, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0x6f, 0x16, 0x84, 0x59, 0x70, 0x0d, 0x05, 0x22, 0xee, 0xef, 0xed, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xed, 0xf5, 0xea, 0xed, 0xec, 0xfb, 0xf4, 0xfd, 0xf0, 0x0b, 0x15, 0x95, 0xee, 0xea, 0xf2, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf6, 0xf3, 0xf0, 0xf3, 0xed, 0xf6, 0xf2, 0xf0, 0xf9, 0x89, 0x1a, 0x5c, 0x20, 0x21, 0x21, 0x21, 0x18, 0x15, 0x1c, 0x58, 0x1b, 0x1b, 0x18, 0x1a, 0x13, 0x8e, 0xf1, 0xe9, 0xf2, 0xf5, 0xf3, 0xf8, 0xb0, 0x2e, 0x35, 0x38, 0x3a, 0x35, 0x6b, 0x6b, 0x6b, 0x38, 0x2c, 0x48, 0xe1, 0xf2, 0xf4, 0xe4, 0xee, 0x54, 0x01, 0x52, 0xf9, 0xf4, 0xf8, 0xec, 0xf0, 0xf0, 0xe4, 0xee, 0xed, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf2, 0xf4, 0xf4, 0xf3, 0xee, 0xf5, 0xf5, 0xee, 0xef, 0x53, 0x01, 0x75, 0xf9, 0xf6, 0xf4, 0xf4, 0xf4, 0xee, 0xf2, 0xf8, 0xf5, 0x56, 0x01, 0x01, 0x02, 0x01, 0x01, 0x53, 0xf9, 0xee, 0xf9, 0xa5, 0x5a, 0x64, 0xca, 0xf9, 0xf2, 0xee, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xeb, 0xb8, 0xc4, 0xd2, 0xc4, 0x9a, 0xb6, 0xeb, 0xf6, 0xfb, 0xf2, 0xfb, 0xf1, 0xe1, 0xb8, 0xb3, 0xbc, 0xb3, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xb9, 0xbc, 0xb9, 0xbc, 0xcb, 0x6f, 0x13, 0xa7, 0x92, 0x7b, 0x77, 0xa1, 0xe7, 0xf1, 0xe9, 0xe9, 0xf3, 0xf4, 0xf6, 0xfb, 0xf4, 0xf4, 0xec, 0xf3, 0xec, 0xed, 0xf3, 0xf5, 0xf5, 0xf9, 0x16, 0x0c, 0x7b, 0xf1, 0xe9, 0xe9, 0xed, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf8, 0xf2, 0xf8, 0xf0, 0xf0, 0xf2, 0xf3, 0xf6, 0xf4, 0xf8, 0x7b, 0x1a, 0x1d, 0x23, 0x20, 0x1f, 0x1f, 0x5b, 0x58, 0x1c, 0x58, 0x1b, 0x1b, 0x1d, 0x58, 0x13, 0xd7, 0xf0, 0xe9, 0xf2, 0xf3, 0xf2, 0xf8, 0x8f, 0x2e, 0x35, 0x34, 0x34, 0x38, 0x6b, 0x6b, 0x6b, 0x32, 0x60, 0xd7, 0xf1, 0xfb, 0xf2, 0xf9, 0xb1, 0x01, 0x01, 0x96, 0xf9, 0xf2, 0xf2, 0xf8, 0xf6, 0xf3, 0xf0, 0xf4, 0xf4, 0xf3, 0xed, 0xf3, 0xed, 0xf4, 0xed, 0xf4, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf4, 0xf5, 0xf4, 0xf6, 0xf3, 0xef, 0xe2, 0x51, 0x01, 0x96, 0xf9, 0xf0, 0xf4, 0xf6, 0xf4, 0xf6, 0xef, 0xf9, 0xdf, 0x51, 0x01, 0x01, 0x02, 0x01, 0x01, 0x54, 0xf9, 0xf6, 0xef, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xec, 0xf8, 0xcf, 0xb7, 0xc6, 0xc3, 0xc6, 0xaf, 0xb6, 0xdc, 0xeb, 0xf7, 0xf3, 0xf2, 0xec, 0xcc, 0xb7, 0xc3, 0xbc, 0xbc, 0xbc, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0x74, 0x11, 0xa9, 0x9b, 0xa6, 0xa2, 0xa2, 0x95, 0xc8, 0xe9, 0xf1, 0xf0, 0xf2, 0xfe, 0xfb, 0xfb, 0xf3, 0xed, 0xed, 0xed, 0xec, 0xf3, 0xf4, 0xfe, 0xf9, 0x70, 0x09, 0x5f, 0xe5, 0xeb, 0xed, 0xeb, 0xf3, 0xf4, 0xfb, 0xf4, 0xf4, 0xf3, 0xf2, 0xf8, 0xe2, 0xc7, 0xe5, 0xf8, 0xf2, 0xf6, 0xf2, 0xf8, 0x6f, 0x58, 0x5c, 0x20, 0x21, 0x5b, 0x21, 0x5b, 0x1f, 0x1f, 0x58, 0x1d, 0x1b, 0x58, 0x1a, 0x5f, 0xe9, 0xeb, 0xe9, 0xf2, 0xf3, 0xea, 0xeb, 0x7e, 0x6b, 0x38, 0x2d, 0x3b, 0x34, 0x38, 0x6b, 0x6b, 0x2e, 0x92, 0xf1, 0xe2, 0xfb, 0xf2, 0xf8, 0x5e, 0x01, 0x52, 0xdf, 0xf6, 0xf0, 0xf6, 0xd6, 0xf2, 0xf3, 0xf4, 0xe8, 0xf6, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf4, 0xf5, 0xf3, 0xee, 0xf5, 0xf5, 0xf8, 0xd3, 0x04, 0x01, 0xca, 0xf9, 0xf4, 0xf4, 0xf6, 0xee, 0xf5, 0xee, 0xf5, 0xf8, 0x5a, 0x01, 0x01, 0x01, 0x02, 0x01, 0x91, 0xf9, 0xf2, 0xf8, 0xf6, 0xf3, 0xf3, 0xf4, 0xf0, 0xf2, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xeb, 0xe6, 0xc4, 0xb7, 0xc6, 0xc3, 0xbb, 0xb3, 0xa7, 0xcb, 0xe1, 0xeb, 0xeb, 0xeb, 0xdb, 0xbd, 0xbb, 0xbc, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xb9, 0xbc, 0xbc, 0xb9, 0xcb, 0x7b, 0x10, 0xab, 0x95, 0x98, 0x98, 0x9e, 0x93, 0x92, 0xa0, 0xd7, 0xf1, 0xee, 0xfd, 0xfe, 0xf4, 0xed, 0xec, 0xf2, 0xed, 0xed, 0xec, 0xf3, 0xf2, 0xf9, 0xaa, 0x06, 0x0b, 0xc9, 0xf1, 0xeb, 0xec, 0xf4, 0xf3, 0xf2, 0xf6, 0xf3, 0xf2, 0xf8, 0xe4, 0x55, 0x01, 0x96, 0xf9, 0xed, 0xf4, 0xec, 0xf1, 0x29, 0x1c, 0x1d, 0x1d, 0x1d, 0x21, 0x1f, 0x5b, 0x1d, 0x5b, 0x1d, 0x1d, 0x1b, 0x5b, 0x19, 0x89, 0xf0, 0xeb, 0xe8, 0xe9, 0xf2, 0xec, 0xe3, 0x77, 0x31, 0x38, 0x3b, 0x34, 0x3b, 0x34, 0x38, 0x2c, 0x80, 0xe0, 0xec, 0xf2, 0xe4, 0xff, 0xd0, 0x01, 0x01, 0x8c, 0xf9, 0xf3, 0xf6, 0x8c, 0x01, 0x82, 0xf8, 0xf6, 0xf3, 0xf3, 0xed, 0xf6, 0xf3, 0xf3, 0xf6, 0xf3, 0xf2, 0xed, 0xf6, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf5, 0xf6, 0xee, 0xf9, 0x96, 0x01, 0x52, 0xf3, 0xee, 0xf6, 0xf6, 0xee, 0xf8, 0xf9, 0xf9, 0xef, 0xf8, 0xd0, 0x4d, 0x01, 0x01, 0x01, 0x71, 0xf8, 0xf0, 0xf6, 0xf4, 0xf3, 0xf6, 0xf6, 0xf3, 0xf4, 0xf6, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xec, 0xec, 0xec, 0xe1, 0xc8, 0xb6, 0xbb, 0xc4, 0xc3, 0xc3, 0xaf, 0xae, 0xce, 0xe1, 0xe7, 0xe7, 0xcb, 0xc1, 0xbb, 0xb9, 0xbc, 0xbc, 0xb9, 0xbc, 0xbc, 0xbc, 0xbc, 0xb9, 0xcb, 0x89, 0x0c, 0xa9, 0x98, 0x98, 0x98, 0x9c, 0x98, 0x98, 0x9b, 0x95, 0xcf, 0xeb, 0xf2, 0xf0, 0xf3, 0xed, 0xed, 0xf4, 0xf3, 0xeb, 0xec, 0xf5, 0xf5, 0xed, 0xe2, 0x0e, 0x08, 0x66, 0xf8, 0xeb, 0xf3, 0xeb, 0xf2, 0xf4, 0xf4, 0xf2, 0xf0, 0xf8, 0x75, 0x01, 0x01, 0x66, 0xf9, 0xe9, 0xed, 0xec, 0xe3, 0x1e, 0x5b, 0x5c, 0x23, 0x1d, 0x1f, 0x5c, 0x5b, 0x1d, 0x5b, 0x1d, 0x1d, 0x5b, 0x1f, 0x19, 0xd4, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xe3, 0x42, 0x3d, 0x3c, 0x3c, 0x36, 0x36, 0x3a, 0x3a, 0x24, 0xa9, 0xf1, 0xe3, 0xe8, 0xe8, 0xef, 0x64, 0x02, 0x4d, 0xdd, 0xf8, 0xf8, 0x96, 0x01, 0x02, 0x8c, 0xf9, 0xe8, 0xee, 0xed, 0xf6, 0xed, 0xed, 0xf0, 0xee, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf6, 0xf5, 0xf3, 0xf5, 0xf9, 0x54, 0x01, 0x79, 0xf9, 0xf6, 0xee, 0xf6, 0xf8, 0xdd, 0x96, 0xb1, 0xf5, 0xf8, 0xf9, 0xdd, 0xb1, 0xb1, 0xd0, 0xf9, 0xf0, 0xf6, 0xf6, 0xf6, 0xf0, 0xf6, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xee, 0xe9, 0xec, 0xf1, 0xe9, 0xd7, 0xc2, 0xb6, 0xbc, 0xba, 0xc3, 0xbc, 0xaf, 0xbd, 0xcb, 0xd8, 0xc4, 0xc4, 0xb9, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc1, 0xc8, 0x95, 0x09, 0xab, 0x9b, 0x98, 0x9c, 0x9c, 0x98, 0x9d, 0x98, 0x9b, 0x8f, 0xc2, 0xf1, 0xf1, 0xe9, 0xf2, 0xe8, 0xf7, 0xf3, 0xec, 0xec, 0xf3, 0xf5, 0xe8, 0xf8, 0x78, 0x02, 0x08, 0xc5, 0xf9, 0xf1, 0xee, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf0, 0x56, 0x63, 0x54, 0x22, 0xf9, 0xf9, 0xf9, 0xf9, 0xd7, 0x1a, 0x58, 0x23, 0x1d, 0x21, 0x21, 0x5b, 0x5c, 0x5b, 0x5c, 0x1d, 0x5b, 0x21, 0x15, 0x19, 0x94, 0x99, 0x9f, 0xaa, 0xa5, 0xb2, 0xc5, 0xb2, 0x6f, 0x42, 0x6c, 0x48, 0x40, 0x45, 0x40, 0x40, 0x39, 0x95, 0xf0, 0xf9, 0xf0, 0xf9, 0xbe, 0x03, 0x01, 0x75, 0xf9, 0xe8, 0xf8, 0x9f, 0xac, 0xd3, 0xf9, 0xf8, 0xf8, 0xec, 0xee, 0xec, 0xed, 0xec, 0xed, 0xea, 0xf4, 0xf3, 0xf3, 0xed, 0xf3, 0xed, 0xf4, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xee, 0xf2, 0xf9, 0xd6, 0x01, 0x00, 0xdd, 0xf9, 0xf6, 0xf4, 0xf8, 0xf5, 0x55, 0x01, 0x01, 0x9f, 0xf9, 0xf2, 0xf9, 0xf9, 0xf9, 0xf0, 0xf0, 0xf4, 0xf8, 0xf9, 0xf9, 0xf8, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf5, 0xee, 0xe8, 0xec, 0xf1, 0xe7, 0xd7, 0xc9, 0xbd, 0xc4, 0xc1, 0xc1, 0xc1, 0xaf, 0xb9, 0xc1, 0xc4, 0xc1, 0xbc, 0xbc, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xc8, 0xae, 0x09, 0x92, 0x9e, 0x9c, 0x98, 0x9c, 0x98, 0x98, 0x98, 0x98, 0x9b, 0x92, 0xae, 0xeb, 0xeb, 0xee, 0xe8, 0xf6, 0xf2, 0xeb, 0xf1, 0xec, 0xf9, 0xf9, 0xf9, 0xe2, 0x0a, 0x03, 0x50, 0xac, 0xdd, 0xe2, 0xdd, 0xd9, 0xcd, 0xac, 0x79, 0x12, 0x56, 0x17, 0x17, 0x12, 0x22, 0x6d, 0x6d, 0x6d, 0x57, 0x1a, 0x1f, 0x5c, 0x1d, 0x21, 0x21, 0x5b, 0x5d, 0x5c, 0x5b, 0x5c, 0x1f, 0x21, 0x13, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x08, 0x09, 0x0b, 0x0b, 0x0d, 0x0c, 0x10, 0x10, 0x0d, 0x17, 0x79, 0xac, 0xb2, 0x0f, 0x02, 0x02, 0x0f, 0x53, 0x0d, 0x55, 0x6d, 0x86, 0x99, 0xb2, 0xca, 0xd6, 0xe5, 0xed, 0xf8, 0xf9, 0xf9, 0xf8, 0xf8, 0xf0, 0xf0, 0xf3, 0xed, 0xf6, 0xed, 0xf6, 0xf6, 0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xef, 0x5a, 0x01, 0x82, 0xf9, 0xf0, 0xf3, 0xf0, 0xf8, 0xdd, 0x4d, 0x01, 0x01, 0xa5, 0xf9, 0xed, 0xf4, 0xed, 0xf0, 0xf3, 0xf0, 0xf0, 0xe4, 0x5e, 0x53, 0xd3, 0xf9, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xfd, 0xf2, 0xfd, 0xf3, 0xf2, 0xf4, 0xeb, 0xe7, 0xda, 0xc9, 0xc4, 0xc1, 0xc1, 0xbf, 0xc1, 0xbc, 0xc6, 0xbc, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xbd, 0xc8, 0x0e, 0x39, 0xa6, 0x98, 0x98, 0x9c, 0x98, 0x9c, 0x93, 0x9c, 0x98, 0x98, 0x8f, 0xce, 0xec, 0xec, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xe8, 0xd0, 0xbe, 0x8c, 0x78, 0x4f, 0x03, 0x03, 0x04, 0x07, 0x51, 0x50, 0x07, 0x4d, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x02, 0x06, 0x15, 0x61, 0x5c, 0x23, 0x21, 0x1f, 0x5d, 0x5c, 0x5b, 0x5c, 0x5b, 0x1d, 0x1f, 0x1a, 0x10, 0x0e, 0x0d, 0x50, 0x0d, 0x0d, 0x50, 0x0a, 0x50, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x08, 0x08, 0x06, 0x05, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x07, 0x4c, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x07, 0x53, 0x22, 0x6d, 0x86, 0x9f, 0xcd, 0xd9, 0xf6, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf0, 0xf0, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf5, 0xf9, 0x8c, 0x01, 0x51, 0xf2, 0xef, 0xf6, 0xf6, 0xf2, 0xf8, 0xf2, 0x79, 0x55, 0x91, 0xf8, 0xf5, 0xf5, 0xf4, 0xe8, 0xf4, 0xed, 0xf6, 0xf8, 0xd0, 0x01, 0x01, 0x82, 0xf8, 0xf4, 0xf5, 0xf5, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf6, 0xf4, 0xf6, 0xf1, 0xf1, 0xe7, 0xdc, 0xce, 0xc9, 0xbd, 0xc4, 0xbd, 0xc4, 0xbd, 0xc4, 0xc4, 0xbc, 0xc1, 0xbc, 0xc1, 0xc1, 0xc4, 0xbd, 0xce, 0x89, 0x08, 0x9a, 0xa0, 0x9b, 0x98, 0x98, 0x9c, 0x9c, 0x93, 0x9c, 0x98, 0x93, 0x95, 0xe6, 0xd6, 0xb1, 0x79, 0x5e, 0x51, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x09, 0x06, 0x05, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x10, 0x15, 0x18, 0x1a, 0x1c, 0x1c, 0x1e, 0x1f, 0x5b, 0x5b, 0x1d, 0x5c, 0x1d, 0x5d, 0x5d, 0x5c, 0x5d, 0x5c, 0x5b, 0x5c, 0x5b, 0x5c, 0x24, 0x7a, 0x4a, 0x76, 0x7a, 0x76, 0x76, 0x4a, 0x76, 0x76, 0x76, 0x72, 0x76, 0x76, 0x76, 0x48, 0x72, 0x76, 0x72, 0x42, 0x42, 0x77, 0x65, 0x09, 0x0c, 0x21, 0x48, 0x44, 0x45, 0x40, 0x40, 0x6c, 0x32, 0x2a, 0x1a, 0x0e, 0x08, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x07, 0x17, 0x66, 0x86, 0xac, 0xd3, 0xe4, 0xef, 0xf9, 0xf9, 0xf9, 0xfd, 0xf9, 0xf9, 0x91, 0x01, 0x4d, 0xe4, 0xf9, 0xf3, 0xf0, 0xee, 0xff, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xff, 0xf4, 0xf6, 0xf3, 0xf4, 0xed, 0xf3, 0xed, 0xf1, 0xf7, 0xc5, 0x91, 0xdf, 0xf0, 0xf5, 0xea, 0xed, 0xea, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xea, 0xf3, 0xec, 0xeb, 0xe7, 0xe1, 0xd1, 0xc9, 0xbd, 0xc4, 0xc1, 0xc1, 0xbb, 0xbb, 0xc3, 0xc1, 0xc6, 0xbc, 0xbc, 0xbc, 0xc4, 0xc4, 0x06, 0x5f, 0xb7, 0x9e, 0x98, 0x9c, 0x93, 0x9d, 0xa3, 0x9c, 0x98, 0x9b, 0xa9, 0x7f, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x06, 0x0e, 0x14, 0x19, 0x1f, 0x33, 0x59, 0x59, 0x16, 0x19, 0x15, 0x19, 0x16, 0x7f, 0xc8, 0x39, 0x31, 0x2c, 0x28, 0x2a, 0x2e, 0x60, 0x1f, 0x23, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5d, 0x5c, 0x1d, 0x62, 0x44, 0x3f, 0x3f, 0x73, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x3f, 0x6b, 0x40, 0x40, 0x61, 0x3c, 0x44, 0x6e, 0x3c, 0x3f, 0x3c, 0x44, 0x44, 0x47, 0x44, 0x72, 0x76, 0x42, 0x59, 0x12, 0x08, 0x17, 0x57, 0x10, 0x0d, 0x0b, 0x06, 0x05, 0x03, 0x03, 0x03, 0x07, 0x0f, 0x54, 0x6d, 0x96, 0xbe, 0xd6, 0xbe, 0x5e, 0x01, 0x02, 0x99, 0xe3, 0xe5, 0xf8, 0xf8, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf6, 0xf4, 0xf6, 0xf6, 0xf3, 0xf2, 0xe8, 0xf2, 0xf3, 0xf4, 0xed, 0xed, 0xf8, 0xf9, 0xf8, 0xf6, 0xf3, 0xed, 0xea, 0xea, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xea, 0xed, 0xea, 0xec, 0xeb, 0xeb, 0xe7, 0xda, 0xcc, 0xc1, 0xc1, 0xc6, 0xc1, 0xc3, 0xc1, 0xbc, 0xc1, 0xc4, 0xbc, 0xc1, 0xd2, 0xa0, 0x06, 0x5f, 0xa2, 0xab, 0xa4, 0xa8, 0xa2, 0x9b, 0xaf, 0xb7, 0x9a, 0x57, 0x02, 0x02, 0x04, 0x03, 0x06, 0x0e, 0x16, 0x5f, 0x39, 0x3d, 0x45, 0x4a, 0x76, 0x18, 0x32, 0x39, 0x6c, 0x6c, 0x3c, 0x6c, 0x25, 0x8d, 0xe3, 0xe0, 0x2a, 0x24, 0x2b, 0x28, 0x27, 0x24, 0x27, 0x23, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5d, 0x5c, 0x5d, 0x5d, 0x5c, 0x5c, 0x5d, 0x1b, 0x6b, 0x44, 0x3f, 0x72, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x6e, 0x3f, 0x3c, 0x6e, 0x6e, 0x6e, 0x3b, 0x34, 0x3b, 0x3a, 0x3a, 0x3f, 0x44, 0x6e, 0x6b, 0x3a, 0x3f, 0x3a, 0x6e, 0x6e, 0x3f, 0x6b, 0x6e, 0x73, 0x3c, 0x3c, 0x45, 0x48, 0x1f, 0x09, 0x59, 0x7e, 0x77, 0x42, 0x45, 0x42, 0x39, 0x1e, 0x15, 0x10, 0x06, 0x05, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x16, 0x0e, 0x06, 0x0b, 0x14, 0x22, 0x78, 0x99, 0xc5, 0xdc, 0xe6, 0xf1, 0xf8, 0xf8, 0xf0, 0xec, 0xf0, 0xec, 0xed, 0xea, 0xed, 0xef, 0xf5, 0xfe, 0xff, 0xf2, 0xfb, 0xf5, 0xf3, 0xec, 0xe9, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf5, 0xf5, 0xea, 0xf2, 0xec, 0xe8, 0xe9, 0xec, 0xec, 0xe7, 0xd8, 0xc8, 0xc4, 0xc4, 0xc4, 0xc8, 0xce, 0xce, 0xd1, 0xd1, 0xc2, 0xb5, 0x7f, 0x0f, 0x03, 0x0a, 0x5f, 0x78, 0x84, 0x89, 0x7b, 0x70, 0x17, 0x07, 0x03, 0x03, 0x05, 0x0d, 0x1f, 0x2e, 0x76, 0x76, 0x44, 0x3c, 0x3f, 0x3f, 0x3e, 0x47, 0x20, 0x5c, 0x38, 0x2c, 0x2b, 0x2b, 0x67, 0x5b, 0xce, 0xe0, 0xdb, 0x45, 0x24, 0x27, 0x23, 0x23, 0x28, 0x27, 0x20, 0x5c, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x23, 0x5b, 0x5d, 0x5c, 0x24, 0x72, 0x3f, 0x44, 0x73, 0x3f, 0x44, 0x43, 0x44, 0x73, 0x3f, 0x44, 0x3f, 0x3f, 0x3f, 0x3f, 0x3b, 0x6e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x6e, 0x3f, 0x6e, 0x6e, 0x3f, 0x3f, 0x3f, 0x6e, 0x3f, 0x6e, 0x6e, 0x3e, 0x43, 0x43, 0x6e, 0x7a, 0x3c, 0x0c, 0x11, 0x76, 0x40, 0x72, 0x44, 0x73, 0x47, 0x76, 0x76, 0x76, 0x3d, 0x5f, 0x13, 0x0b, 0x0b, 0x0e, 0x29, 0x39, 0x77, 0x40, 0x2e, 0x25, 0x19, 0x11, 0x0c, 0x0c, 0x0c, 0x0e, 0x1a, 0x89, 0xb0, 0xcc, 0xde, 0xe3, 0xec, 0xec, 0xf0, 0xf0, 0xf8, 0xee, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xf4, 0xf4, 0xf3, 0xec, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xed, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf5, 0xf6, 0xe8, 0xf4, 0xf4, 0xf2, 0xe8, 0xf3, 0xf3, 0xe9, 0xf1, 0xe1, 0xd4, 0xd5, 0xd5, 0xcc, 0xaa, 0x7f, 0x66, 0x54, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x03, 0x06, 0x10, 0x33, 0x42, 0x47, 0x43, 0x3f, 0x6e, 0x3e, 0x41, 0x3e, 0x3e, 0x37, 0x43, 0x38, 0x18, 0x28, 0x2d, 0x2d, 0x2d, 0x62, 0x39, 0xe0, 0xdb, 0xd8, 0xc6, 0x87, 0x80, 0x4a, 0x2e, 0x1f, 0x23, 0x24, 0x24, 0x5d, 0x23, 0x5d, 0x23, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x1d, 0x5d, 0x1d, 0x67, 0x44, 0x3f, 0x3f, 0x3f, 0x3f, 0x43, 0x3f, 0x43, 0x3f, 0x43, 0x43, 0x3f, 0x43, 0x3f, 0x3f, 0x3f, 0x3f, 0x6e, 0x3b, 0x3b, 0x3e, 0x3b, 0x3b, 0x3e, 0x3e, 0x6e, 0x6e, 0x6e, 0x6e, 0x3e, 0x6e, 0x6e, 0x6e, 0x6e, 0x43, 0x6e, 0x37, 0x3e, 0x3b, 0x41, 0x3f, 0x44, 0x09, 0x1d, 0x47, 0x3e, 0x6e, 0x3e, 0x43, 0x43, 0x3f, 0x3f, 0x73, 0x4a, 0x7c, 0x76, 0x4a, 0x7a, 0x40, 0x76, 0x3a, 0x73, 0x3f, 0x72, 0x76, 0x72, 0x44, 0x6c, 0x31, 0x61, 0x5b, 0x18, 0x18, 0x58, 0x25, 0x3d, 0x7e, 0x95, 0xc0, 0xd7, 0xe6, 0xec, 0xf9, 0xf8, 0xf8, 0xee, 0xf5, 0xf3, 0xfb, 0xfb, 0xfc, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf2, 0xf4, 0xf4, 0xf3, 0xfb, 0xf6, 0xf2, 0xf6, 0xf6, 0xf8, 0xf8, 0xfd, 0xe2, 0xd0, 0x96, 0x66, 0x53, 0x07, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x0d, 0x0f, 0x17, 0x0d, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x0a, 0x19, 0x65, 0x4a, 0x3e, 0x3e, 0x6e, 0x3e, 0x3e, 0x3b, 0x3e, 0x3b, 0x3e, 0x37, 0x41, 0x3e, 0x7a, 0x20, 0x18, 0x2d, 0x27, 0x2d, 0x5c, 0x87, 0xe1, 0xda, 0xd7, 0xd7, 0xe0, 0xdb, 0xdb, 0xd2, 0xcb, 0x9b, 0x2e, 0x62, 0x5c, 0x5d, 0x5d, 0x5c, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c, 0x5c, 0x1d, 0x24, 0x3f, 0x44, 0x3f, 0x44, 0x3f, 0x3f, 0x43, 0x73, 0x43, 0x73, 0x3f, 0x3f, 0x43, 0x3f, 0x43, 0x44, 0x32, 0x62, 0x3a, 0x3a, 0x6e, 0x3b, 0x6e, 0x3e, 0x6e, 0x6e, 0x6e, 0x3e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x3f, 0x6e, 0x3e, 0x41, 0x41, 0x3b, 0x3f, 0x44, 0x2a, 0x09, 0x41, 0x73, 0x3b, 0x41, 0x3e, 0x3e, 0x3e, 0x3e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x43, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x43, 0x43, 0x41, 0x44, 0x43, 0x43, 0x43, 0x43, 0x3e, 0x3a, 0x6b, 0x32, 0x2e, 0x2e, 0x61, 0x42, 0x8d, 0xa7, 0xcf, 0xde, 0xec, 0xf1, 0xf8, 0xf5, 0xff, 0xfc, 0xfe, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf2, 0xf6, 0xf3, 0xf3, 0xf7, 0xf2, 0xf7, 0xf1, 0xf9, 0xf9, 0xf4, 0xd0, 0x8c, 0x64, 0x52, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0a, 0x0d, 0x19, 0x1e, 0x65, 0x3d, 0x45, 0x48, 0x6f, 0x16, 0x09, 0x0a, 0x57, 0x12, 0x0b, 0x74, 0x45, 0x44, 0x3b, 0x37, 0x41, 0x3b, 0x3f, 0x3b, 0x3f, 0x3e, 0x3e, 0x38, 0x3e, 0x3e, 0x6e, 0x72, 0x72, 0x18, 0x1b, 0x3a, 0x27, 0x1f, 0x9e, 0xe1, 0xda, 0xd6, 0xd7, 0xd5, 0xd4, 0xd5, 0xda, 0xd7, 0xe0, 0xc6, 0x1b, 0x2a, 0x1b, 0x24, 0x5d, 0x5c, 0x1d, 0x5c, 0x5d, 0x23, 0x1d, 0x1d, 0x6b, 0x3f, 0x44, 0x3f, 0x3f, 0x43, 0x3f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3f, 0x43, 0x3f, 0x3f, 0x18, 0x11, 0x62, 0x44, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x3e, 0x6e, 0x6e, 0x6e, 0x6e, 0x3c, 0x3f, 0x6e, 0x3b, 0x3e, 0x38, 0x47, 0x40, 0x49, 0x11, 0x62, 0x47, 0x3f, 0x3e, 0x6e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x43, 0x41, 0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3e, 0x41, 0x3e, 0x3e, 0x41, 0x3b, 0x41, 0x3b, 0x3e, 0x6e, 0x3b, 0x44, 0x3f, 0x6b, 0x32, 0x67, 0x32, 0x42, 0x92, 0xc2, 0xe3, 0xf9, 0xef, 0xf5, 0xf4, 0xf0, 0xf2, 0xf6, 0xf2, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xf0, 0xf2, 0xf4, 0xf3, 0xf6, 0xf8, 0xf8, 0xdd, 0x96, 0x64, 0x4e, 0x01, 0x01, 0x01, 0x01, 0x02, 0x05, 0x0a, 0x14, 0x1e, 0x33, 0x6f, 0x48, 0x44, 0x73, 0x3e, 0x3b, 0x3b, 0x38, 0x6e, 0x49, 0x76, 0x65, 0x0e, 0x09, 0x58, 0x44, 0x36, 0x3b, 0x3e, 0x41, 0x37, 0x3f, 0x6e, 0x3f, 0x6e, 0x6e, 0x6e, 0x43, 0x38, 0x6b, 0x3f, 0x6c, 0x76, 0x40, 0x18, 0x1b, 0x35, 0x58, 0xaf, 0xe0, 0xd7, 0xd7, 0xd5, 0xd7, 0xd7, 0xd7, 0xd4, 0xd8, 0xd2, 0xe0, 0xcb, 0x1b, 0x67, 0x1b, 0x5c, 0x5c, 0x5d, 0x5d, 0x5c, 0x1b, 0x5c, 0x68, 0x44, 0x73, 0x3f, 0x43, 0x3f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3f, 0x3e, 0x43, 0x3e, 0x43, 0x3f, 0x60, 0x1b, 0x68, 0x3f, 0x6e, 0x6e, 0x6e, 0x6e, 0x3f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x3f, 0x3f, 0x6e, 0x3f, 0x6e, 0x43, 0x3a, 0x43, 0x35, 0x44, 0x24, 0x15, 0x43, 0x3f, 0x6e, 0x41, 0x3e, 0x3e, 0x3b, 0x3e, 0x3e, 0x41, 0x3e, 0x3e, 0x41, 0x43, 0x41, 0x43, 0x3e, 0x41, 0x41, 0x43, 0x41, 0x43, 0x41, 0x3e, 0x41, 0x3e, 0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3e, 0x3e, 0x46, 0x46, 0x43, 0x43, 0x3f, 0x6b, 0x32, 0x2e, 0x3d, 0x97, 0xd5, 0xec, 0xf8, 0xe4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf8, 0xf9, 0xf8, 0xbe, 0x69, 0x50, 0x01, 0x01, 0x02, 0x02, 0x01, 0x03, 0x0e, 0x19, 0x5f, 0x6c, 0x45, 0x72, 0x72, 0x3f, 0x3c, 0x3f, 0x6e, 0x6e, 0x37, 0x37, 0x37, 0x3e, 0x67, 0x3c, 0x45, 0x13, 0x1d, 0x3c, 0x6e, 0x6e, 0x6e, 0x6e, 0x3c, 0x40, 0x6e, 0x3e, 0x3f, 0x6e, 0x3f, 0x6b, 0x6b, 0x6e, 0x49, 0x7d, 0x93, 0x98, 0xa4, 0x8a, 0x1b, 0x5c, 0x2a, 0x8a, 0xd8, 0xe0, 0xe0, 0xdb, 0xd8, 0xdb, 0xdb, 0xe1, 0xdb, 0xdb, 0xc6, 0x9c, 0x31, 0x24, 0x5d, 0x1b, 0x5c, 0x1d, 0x5c, 0x1d, 0x5c, 0x31, 0x3f, 0x44, 0x3f, 0x43, 0x3f, 0x43, 0x3f, 0x3f, 0x43, 0x43, 0x43, 0x43, 0x3f, 0x3e, 0x3f, 0x43, 0x3f, 0x43, 0x3f, 0x6e, 0x43, 0x3b, 0x3e, 0x3b, 0x6e, 0x6e, 0x6e, 0x6e, 0x3f, 0x6e, 0x3f, 0x6e, 0x3f, 0x6e, 0x3f, 0x6e, 0x6e, 0x6e, 0x3e, 0x6e, 0x3f, 0x6e, 0x6e, 0x6e, 0x3e, 0x43, 0x2f, 0x18, 0x44, 0x73, 0x6e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x3e, 0x41, 0x43, 0x43, 0x43, 0x73, 0x72, 0x73, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3e, 0x41, 0x3e, 0x3e, 0x43, 0x3e, 0x43, 0x41, 0x46, 0x3e, 0x3e, 0x3e, 0x3e, 0x6e, 0x3e, 0x43, 0x3e, 0x3a, 0x36, 0x32, 0x3d, 0xa0, 0xe3, 0xf8, 0xf6, 0xf2, 0xf6, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf0, 0xf2, 0xf9, 0xf2, 0x8c, 0x52, 0x01, 0x01, 0x01, 0x05, 0x03, 0x05, 0x0e, 0x5f, 0x3d, 0x45, 0x45, 0x72, 0x44, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x36, 0x6e, 0x35, 0x3a, 0x34, 0x34, 0x3f, 0x38, 0x35, 0x47, 0x6e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3f, 0x40, 0x3c, 0x3f, 0x6e, 0x6e, 0x3e, 0x43, 0x38, 0x3f, 0x93, 0xa4, 0xad, 0xab, 0xa3, 0xa4, 0xab, 0xad, 0x80, 0x67, 0x2a, 0x6c, 0x80, 0x92, 0x9e, 0xa8, 0xa8, 0xa0, 0x95, 0x8d, 0x40, 0x40, 0x31, 0x72, 0x40, 0x3c, 0x2c, 0x5b, 0x5c, 0x62, 0x6b, 0x44, 0x73, 0x44, 0x43, 0x44, 0x3f, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x43, 0x3f, 0x43, 0x3f, 0x43, 0x3f, 0x43, 0x6e, 0x3e, 0x3b, 0x3b, 0x3e, 0x3b, 0x3e, 0x3b, 0x6e, 0x3a, 0x6e, 0x3a, 0x6e, 0x3a, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x3e, 0x3b, 0x43, 0x6e, 0x6e, 0x43, 0x6e, 0x3e, 0x3e, 0x6e, 0x36, 0x6e, 0x6e, 0x43, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x43, 0x43, 0x73, 0x3f, 0x73, 0x3f, 0x41, 0x3e, 0x43, 0x43, 0x43, 0x47, 0x47, 0x44, 0x49, 0x3f, 0x3e, 0x43, 0x3e, 0x3f, 0x3b, 0x43, 0x3e, 0x3e, 0x43, 0x6e, 0x43, 0x3e, 0x41, 0x41, 0x3e, 0x3a, 0x38, 0x2c, 0x78, 0xd9, 0xf1, 0xed, 0xf4, 0xf6, 0xfb, 0xf4, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf9, 0xa5, 0x53, 0x01, 0x01, 0x01, 0x04, 0x04, 0x03, 0x08, 0x25, 0x40, 0x47, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3f, 0x3c, 0x72, 0x3c, 0x3f, 0x3f, 0x44, 0x44, 0x32, 0x32, 0x40, 0x6b, 0x30, 0x37, 0x3e, 0x6e, 0x6e, 0x6e, 0x3e, 0x6e, 0x3e, 0x3e, 0x3b, 0x3e, 0x6e, 0x3f, 0x3e, 0x3e, 0x3b, 0x3a, 0x93, 0xab, 0xa4, 0xa2, 0xa6, 0xa6, 0xa2, 0xa6, 0xa4, 0xab, 0xa4, 0x93, 0x81, 0x76, 0x72, 0x3c, 0x32, 0x2c, 0x67, 0x32, 0x6b, 0x3c, 0x3c, 0x40, 0x3c, 0x3c, 0x3c, 0x6c, 0x3c, 0x3c, 0x6b, 0x6c, 0x3c, 0x6b, 0x3c, 0x6b, 0x3c, 0x3c, 0x3f, 0x3c, 0x44, 0x3c, 0x44, 0x3c, 0x3f, 0x40, 0x3f, 0x40, 0x3f, 0x40, 0x3f, 0x3f, 0x3e, 0x6e, 0x3e, 0x6e, 0x3b, 0x6e, 0x3b, 0x6e, 0x3b, 0x6e, 0x3a, 0x6e, 0x3a, 0x6e, 0x3a, 0x3c, 0x3a, 0x3c, 0x3a, 0x6e, 0x6e, 0x38, 0x34, 0x38, 0x68, 0x68, 0x35, 0x43, 0x88, 0x47, 0x3f, 0x3b, 0x6e, 0x43, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x43, 0x41, 0x3e, 0x43, 0x43, 0x43, 0x43, 0x73, 0x41, 0x41, 0x41, 0x41, 0x43, 0x44, 0x3c, 0x15, 0x13, 0x1f, 0x47, 0x41, 0x3e, 0x46, 0x3e, 0x3f, 0x43, 0x3f, 0x43, 0x3f, 0x73, 0x3f, 0x3e, 0x3b, 0x37, 0x41, 0x3e, 0x3f, 0x40, 0x25, 0xc5, 0xf8, 0xec, 0xf3, 0xfb, 0xfb, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf3, 0xf9, 0x55, 0x01, 0x04, 0x01, 0x4c, 0x02, 0x03, 0x0b, 0x29, 0x48, 0x3f, 0x6e, 0x3e, 0x43, 0x6e, 0x43, 0x3e, 0x3f, 0x6e, 0x6e, 0x6e, 0x3f, 0x44, 0x18, 0x0c, 0x0c, 0x09, 0x11, 0x31, 0x3f, 0x3b, 0x3b, 0x6e, 0x6e, 0x6e, 0x6e, 0x3e, 0x6e, 0x6e, 0x3e, 0x6e, 0x3f, 0x3f, 0x6e, 0x6e, 0x3a, 0x47, 0xab, 0xa4, 0xa6, 0xa6, 0xa6, 0xa2, 0xa6, 0xa3, 0xa3, 0xa3, 0xa4, 0xab, 0xab, 0xab, 0xab, 0xa4, 0xa4, 0xa4, 0x9d, 0x9d, 0x98, 0x98, 0x98, 0x98, 0x98, 0x93, 0x93, 0x93, 0x93, 0x8d, 0x8b, 0x8a, 0x8a, 0x83, 0x83, 0x81, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x47, 0x76, 0x73, 0x72, 0x3f, 0x6e, 0x3c, 0x6e, 0x44, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x72, 0x76, 0x7a, 0x81, 0x81, 0x8b, 0x93, 0x93, 0xba, 0x93, 0x2d, 0x3b, 0x43, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3f, 0x3e, 0x3f, 0x43, 0x43, 0x43, 0x73, 0x3f, 0x43, 0x43, 0x41, 0x3e, 0x43, 0x44, 0x3c, 0x0c, 0x09, 0x0c, 0x09, 0x18, 0x49, 0x43, 0x3f, 0x43, 0x3e, 0x43, 0x3e, 0x43, 0x3e, 0x6e, 0x3b, 0x3b, 0x3b, 0x41, 0x34, 0x3f, 0x3c, 0x2e, 0x7b, 0xe3, 0xeb, 0xee, 0xf4, 0xfb, 0xf4, 0xfb, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xee, 0xf2, 0xf8, 0xd9, 0x5e, 0x01, 0x01, 0x03, 0x4c, 0x05, 0x0b, 0x5f, 0x48, 0x32, 0x3f, 0x6e, 0x6e, 0x3e, 0x43, 0x41, 0x3e, 0x3e, 0x3e, 0x41, 0x43, 0x31, 0x09, 0x06, 0x09, 0x0c, 0x0c, 0x0c, 0x1b, 0x3f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x6e, 0x3f, 0x3f, 0x6e, 0x3f, 0xab, 0xaf, 0xa6, 0xa6, 0xa3, 0xa3, 0xa6, 0xa3, 0xa8, 0xa8, 0xa8, 0xa8, 0xa3, 0xa3, 0xa3, 0xa8, 0xa4, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa4, 0xa8, 0xa8, 0xa8, 0xa8, 0xab, 0xab, 0xab, 0xa8, 0xab, 0xab, 0xab, 0xa8, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa4, 0xab, 0xab, 0xab, 0xab, 0xb3, 0xab, 0xb3, 0xab, 0xb3, 0xab, 0xb3, 0xab, 0xb3, 0xab, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xba, 0xb4, 0xc3, 0x93, 0x38, 0x3e, 0x41, 0x3e, 0x3b, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x43, 0x3f, 0x43, 0x3f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x73, 0x3f, 0x44, 0x44, 0x3c, 0x09, 0x0c, 0x09, 0x0c, 0x18, 0x49, 0x3f, 0x43, 0x43, 0x43, 0x3e, 0x41, 0x3e, 0x41, 0x3e, 0x43, 0x41, 0x3b, 0x3e, 0x3c, 0x6c, 0x39, 0x9b, 0xde, 0xf8, 0xe9, 0xf3, 0xf4, 0xf6, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf4, 0xf5, 0xf8, 0xf9, 0xa5, 0x56, 0x02, 0x01, 0x03, 0x05, 0x0b, 0x25, 0x45, 0x7a, 0x76, 0x47, 0x44, 0x3f, 0x6e, 0x6e, 0x3e, 0x3e, 0x37, 0x43, 0x40, 0x18, 0x11, 0x09, 0x09, 0x09, 0x11, 0x23, 0x3f, 0x3a, 0x3b, 0x3e, 0x3b, 0x3e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x3f, 0x6e, 0x6e, 0x3e, 0x3f, 0x3c, 0x83, 0xab, 0xb3, 0xa8, 0xa3, 0xa8, 0xa3, 0xa6, 0xa3, 0xa6, 0xa2, 0xa2, 0xa6, 0xa6, 0xa2, 0xa2, 0xa6, 0xa2, 0xa8, 0xa6, 0xa8, 0xa6, 0xa8, 0xa2, 0xa3, 0xa8, 0xa3, 0xa8, 0xa8, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa6, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaf, 0xab, 0xaf, 0xaf, 0xaf, 0xaf, 0xab, 0xaf, 0xa8, 0xaf, 0xa8, 0xaf, 0xa8, 0xa8, 0xaf, 0xab, 0xb3, 0xab, 0xa4, 0x81, 0x6c, 0x73, 0x3b, 0x3b, 0x3e, 0x3e, 0x41, 0x3e, 0x3e, 0x3e, 0x3e, 0x43, 0x43, 0x43, 0x3f, 0x43, 0x43, 0x41, 0x3e, 0x41, 0x43, 0x43, 0x43, 0x73, 0x44, 0x76, 0x2f, 0x15, 0x18, 0x24, 0x44, 0x73, 0x43, 0x47, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x43, 0x43, 0x3a, 0x36, 0x31, 0x32, 0x48, 0x9a, 0xd5, 0xf1, 0xf1, 0xeb, 0xf0, 0xf3, 0xf4, 0xf2, 0xf5, 0xed, 0xed, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf4, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf9, 0xf9, 0xdd, 0x96, 0x22, 0x0d, 0x03, 0x03, 0x05, 0x0e, 0x1a, 0x29, 0x42, 0x45, 0x45, 0x76, 0x76, 0x44, 0x73, 0x44, 0x72, 0x76, 0x48, 0x40, 0x32, 0x31, 0x36, 0x73, 0x38, 0x3b, 0x3b, 0x3b, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x6e, 0x43, 0x3b, 0x41, 0x3b, 0x3e, 0x3e, 0x3e, 0x6b, 0x72, 0x93, 0xa3, 0xab, 0xa4, 0xa8, 0xa3, 0xa3, 0xa8, 0xa6, 0xa2, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0xa6, 0xa6, 0xa2, 0xa6, 0xa2, 0xa2, 0xa8, 0xa6, 0xa2, 0xa6, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xaf, 0xa6, 0xa6, 0xa6, 0xa6, 0xaf, 0xa6, 0xa6, 0xa6, 0xaf, 0xaf, 0xa8, 0xaf, 0xa8, 0xaf, 0xa8, 0xb3, 0xab, 0xb3, 0xa4, 0x93, 0x81, 0x3c, 0x3c, 0x73, 0x43, 0x41, 0x3e, 0x41, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3e, 0x3e, 0x3e, 0x47, 0x4b, 0x49, 0x49, 0x41, 0x3e, 0x41, 0x3e, 0x43, 0x3f, 0x44, 0x3c, 0x32, 0x6c, 0x39, 0x48, 0x87, 0xa9, 0xcf, 0xe6, 0xf8, 0xf1, 0xec, 0xf6, 0xed, 0xf6, 0xf3, 0xf5, 0xf3, 0xf3, 0xed, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf4, 0xf6, 0xee, 0xf6, 0xee, 0xfd, 0xef, 0xef, 0xf9, 0xef, 0xd6, 0xb2, 0x70, 0x56, 0x0a, 0x05, 0x03, 0x05, 0x09, 0x10, 0x19, 0x5f, 0x65, 0x39, 0x39, 0x72, 0x76, 0x7a, 0x4a, 0x76, 0x45, 0x72, 0x6e, 0x6e, 0x3b, 0x6e, 0x3e, 0x6e, 0x3e, 0x3e, 0x3e, 0x6e, 0x3e, 0x3e, 0x41, 0x3b, 0x3b, 0x41, 0x3b, 0x3e, 0x3e, 0x38, 0x38, 0x47, 0x85, 0x98, 0xab, 0xab, 0xab, 0xab, 0xa8, 0xa3, 0x9e, 0xa2, 0xa2, 0xa6, 0xa2, 0xa8, 0xa2, 0xa6, 0xa2, 0xa6, 0xa2, 0xa2, 0xa8, 0xa8, 0xa8, 0xa8, 0xa2, 0xa8, 0xa2, 0xa8, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xaf, 0xa6, 0xaf, 0xa6, 0xaf, 0xa6, 0xaf, 0xa6, 0xa8, 0xaf, 0xa8, 0xb3, 0xb3, 0xb3, 0xab, 0x93, 0x8b, 0x72, 0x6b, 0x6b, 0x3e, 0x3e, 0x6e, 0x3e, 0x3e, 0x41, 0x3e, 0x3e, 0x3e, 0x3e, 0x43, 0x3e, 0x3e, 0x41, 0x3e, 0x41, 0x3e, 0x41, 0x3e, 0x41, 0x41, 0x41, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x47, 0x43, 0x3a, 0x3b, 0x41, 0x30, 0x30, 0x2c, 0x32, 0x3d, 0x45, 0x8d, 0xa0, 0xc8, 0xda, 0xe6, 0xee, 0xf0, 0xea, 0xed, 0xfe, 0xfc, 0xfb, 0xf3, 0xf3, 0xf4, 0xfb, 0xf5, 0xed, 0xed, 0xed, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfb, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfb, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf6, 0xf2, 0xfe, 0xfd, 0xff, 0xf2, 0xf8, 0xf9, 0xf9, 0xf9, 0xed, 0xd9, 0xc5, 0x99, 0x75, 0x22, 0x12, 0x0a, 0x06, 0x05, 0x06, 0x06, 0x09, 0x09, 0x10, 0x13, 0x1a, 0x25, 0x2e, 0x40, 0x40, 0x44, 0x3c, 0x44, 0x3f, 0x3c, 0x6e, 0x43, 0x3f, 0x6e, 0x3e, 0x3b, 0x3b, 0x3b, 0x3e, 0x3b, 0x34, 0x3e, 0x3e, 0x6e, 0x6b, 0x31, 0x6e, 0x49, 0x8a, 0x8b, 0x98, 0xa4, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa8, 0xa4, 0xa8, 0xa4, 0xa8, 0xa4, 0xa8, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa3, 0xa8, 0xa3, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaf, 0xab, 0xaf, 0xab, 0xaf, 0xab, 0xaf, 0xb3, 0xab, 0xb3, 0xab, 0xab, 0x9d, 0x93, 0x85, 0x7a, 0x3f, 0x34, 0x68, 0x6e, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x3e, 0x6e, 0x6e, 0x6e, 0x43, 0x3e, 0x3f, 0x3e, 0x3f, 0x3e, 0x3e, 0x43, 0x43, 0x43, 0x3f, 0x73, 0x44, 0x3f, 0x44, 0x44, 0x73, 0x3f, 0x36, 0x3c, 0x36, 0x31, 0x2a, 0x2e, 0x6c, 0x40, 0x4a, 0x87, 0x95, 0xc0, 0xce, 0xde, 0xe9, 0xf1, 0xf8, 0xf9, 0xf8, 0xec, 0xea, 0xed, 0xf5, 0xfe, 0xfe, 0xfe, 0xf4, 0xf3, 0xf4, 0xf4, 0xf5, 0xf3, 0xf4, 0xf3, 0xf3, 0xfb, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfb, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf6, 0xf6, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xfd, 0xfd, 0xf8, 0xf9, 0xf8, 0xf8, 0xf1, 0xe5, 0xdd, 0xd3, 0xc5, 0x99, 0x8e, 0x78, 0x66, 0x17, 0x12, 0x0d, 0x0b, 0x0e, 0x0e, 0x13, 0x19, 0x1a, 0x25, 0x25, 0x2e, 0x39, 0x6c, 0x3c, 0x6c, 0x3f, 0x3c, 0x3f, 0x3c, 0x43, 0x3f, 0x43, 0x3a, 0x3b, 0x3a, 0x3e, 0x3a, 0x6e, 0x3a, 0x38, 0x3a, 0x38, 0x3f, 0x47, 0x7a, 0x81, 0x8a, 0x8b, 0x98, 0x98, 0x9c, 0x9d, 0xa4, 0xa4, 0xa4, 0xab, 0xa4, 0xab, 0xa4, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa4, 0xab, 0xa4, 0xab, 0xa4, 0xab, 0xa4, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa4, 0xa4, 0xa4, 0xab, 0xa4, 0xa4, 0x9c, 0x9d, 0x98, 0x98, 0x93, 0x93, 0x8a, 0x8a, 0x80, 0x7a, 0x47, 0x3c, 0x6e, 0x2f, 0x35, 0x38, 0x38, 0x6e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x43, 0x41, 0x43, 0x43, 0x3f, 0x43, 0x6e, 0x43, 0x3f, 0x3f, 0x3a, 0x6e, 0x3c, 0x6b, 0x36, 0x32, 0x32, 0x32, 0x39, 0x2e, 0x33, 0x2e, 0x65, 0x3d, 0x42, 0x77, 0x8d, 0x94, 0xae, 0xc9, 0xd1, 0xda, 0xe6, 0xec, 0xec, 0xf1, 0xf0, 0xf0, 0xec, 0xf3, 0xed, 0xf3, 0xed, 0xf4, 0xf5, 0xf5, 0xf3, 0xf5, 0xf5, 0xf5, 0xf3, 0xf4, 0xf4, 0xf5, 0xea, 0xf5, 0xf5, 0xf4, 0xf3, 0xf6, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf4, 0xf6, 0xf6, 0xf6, 0xfb, 0xfb, 0xfb, 0xf6, 0xfb, 0xf3, 0xf6, 0xf0, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xea, 0xe4, 0xdc, 0xd0, 0xc5, 0xaa, 0x97, 0x8e, 0x7b, 0x74, 0x39, 0x29, 0x25, 0x1c, 0x1c, 0x58, 0x58, 0x58, 0x5b, 0x21, 0x5d, 0x24, 0x28, 0x2c, 0x2f, 0x2f, 0x30, 0x2f, 0x2f, 0x2f, 0x2f, 0x34, 0x2b, 0x2b, 0x2c, 0x28, 0x28, 0x28, 0x27, 0x27, 0x28, 0x28, 0x2b, 0x2c, 0x31, 0x31, 0x32, 0x6b, 0x32, 0x3c, 0x6b, 0x40, 0x3c, 0x44, 0x72, 0x72, 0x72, 0x72, 0x72, 0x76, 0x76, 0x76, 0x76, 0x72, 0x72, 0x44, 0x76, 0x72, 0x72, 0x44, 0x72, 0x40, 0x3c, 0x36, 0x6b, 0x31, 0x31, 0x2c, 0x2c, 0x2a, 0x28, 0x62, 0x2c, 0x2c, 0x2c, 0x2f, 0x67, 0x34, 0x3a, 0x34, 0x3b, 0x34, 0x34, 0x38, 0x38, 0x68, 0x68, 0x2f, 0x67, 0x2b, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x2c, 0x2f, 0x35, 0x3f, 0x3f, 0x4a, 0x80, 0x87, 0x92, 0x95, 0xa0, 0xb0, 0xc2, 0xcc, 0xd5, 0xde, 0xe3, 0xe6, 0xf1, 0xf1, 0xf0, 0xf8, 0xf8, 0xf8, 0xf7, 0xfc, 0xf7, 0xf7, 0xf7, 0xfb, 0xf3, 0xf6, 0xfd, 0xf4, 0xf3, 0xf7, 0xf6, 0xf4, 0xf3, 0xed, 0xea, 0xe9, 0xea, 0xea, 0xf3, 0xed, 0xed, 0xf5, 0xf5, 0xf3, 0xf6, 0xfb, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 
-  0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf5, 0xfe, 0xf5, 0xf5, 0xff, 0xef, 0xef, 0xf9, 0xf8, 0xf9, 0xf9, 0xf8, 0xef, 0xf0, 0xed, 0xea, 0xe6, 0xe2, 0xe1, 0xda, 0xd5, 0xcf, 0xc9, 0xb8, 0xaa, 0xa1, 0x94, 0x8e, 0x89, 0x84, 0x7e, 0x7c, 0x77, 0x42, 0x6f, 0x3d, 0x33, 0x33, 0x2e, 0x2e, 0x2a, 0x26, 0x61, 0x26, 0x21, 0x21, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x23, 0x27, 0x24, 0x62, 0x24, 0x27, 0x62, 0x62, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x62, 0x24, 0x2a, 0x65, 0x2e, 0x2e, 0x32, 0x39, 0x32, 0x3d, 0x40, 0x42, 0x48, 0x77, 0x7e, 0x84, 0x8d, 0x8f, 0x97, 0xa1, 0xae, 0xb5, 0xc2, 0xcc, 0xd4, 0xd7, 0xda, 0xde, 0xde, 0xe3, 0xe6, 0xe9, 0xec, 0xec, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xf1, 0xee, 0xf1, 0xed, 0xed, 0xf3, 0xed, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xfb, 0xf3, 0xf4, 0xfb, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xed, 0xed, 0xed, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf6, 0xf6, 0xf0, 0xf6, 0xfd, 0xf0, 0xef, 0xee, 0xf0, 0xef, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf1, 0xec, 0xec, 0xe9, 0xec, 0xe9, 0xe6, 0xe3, 0xe1, 0xde, 0xde, 0xda, 0xd5, 0xd4, 0xcf, 0xcc, 0xc8, 0xc2, 0xc0, 0xb7, 0xaf, 0xa9, 0xa9, 0xa0, 0xa0, 0x95, 0x95, 0x92, 0x8d, 0x8d, 0x87, 0x87, 0x7e, 0x87, 0x84, 0x84, 0x7e, 0x7e, 0x7e, 0x87, 0x7e, 0x87, 0x84, 0x87, 0x87, 0x8d, 0x8f, 0x8f, 0x9a, 0xa0, 0xa7, 0xa9, 0xa9, 0xb7, 0xc0, 0xc8, 0xc8, 0xcc, 0xd1, 0xd4, 0xd7, 0xda, 0xdb, 0xe1, 0xe1, 0xe6, 0xe7, 0xe9, 0xec, 0xec, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf8, 0xf8, 0xf9, 0xf8, 0xf8, 0xef, 0xf0, 0xf0, 0xf0, 0xec, 0xed, 0xf6, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xec, 0xec, 0xec, 0xec, 0xe9, 0xee, 0xec, 0xec, 0xe9, 0xea, 0xe9, 0xea, 0xec, 0xec, 0xea, 0xe9, 0xee, 0xec, 0xf8, 0xf0, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf1, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf1, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf1, 0xf0, 0xf6, 0xf0, 0xf1, 0xf6, 0xeb, 0xf3, 0xec, 0xec, 0xec, 0xed, 0xec, 0xee, 0xed, 0xf6, 0xf6, 0xf3, 0xe9, 0xf3, 0xec, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf3, 0xf3, 0xed, 0xf4, 0xec, 0xf3, 0xed, 0xf6, 0xf6, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf3, 0xf5, 0xf2, 0xfb, 0xfc, 0xfc, 0xfc, 0xf7, 0xfc, 0xfc, 0xfc, 0xfc, 0xf7, 0xfc, 0xf7, 0xfc, 0xf7, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf7, 0xfb, 0xf7, 0xfc, 0xf7, 0xfb, 0xfc, 0xf7, 0xf7, 0xf7, 0xf7, 0xfc, 0xf7, 0xfb, 0xfc, 0xf7, 0xfb, 0xf7, 0xfc, 0xfc, 0xf7, 0xfc, 0xfc, 0xfb, 0xfb, 0xf7, 0xfb, 0xf7, 0xfc, 0xf7, 0xf6, 0xf6, 0xfb, 0xf3, 0xf3, 0xfb, 0xf4, 0xfb, 0xf6, 0xed, 0xed, 0xee, 0xf4, 0xf5, 0xf4, 0xfb, 0xfc, 0xfb, 0xf6, 0xf6, 0xed, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xee, 0xf4, 0xf5, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xee, 0xf6, 0xf4, 0xf4, 0xf6, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xfb, 0xf6, 0xfd, 0xfb, 0xfb, 0xff, 0xfb, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xee, 0xf5, 0xf5, 0xf5, 0xed, 0xea, 0xf5, 0xea, 0xf5, 0xee, 0xee, 0xee, 0xed, 0xf5, 0xee, 0xee, 0xed, 0xed, 0xea, 0xf5, 0xea, 0xee, 0xea, 0xee, 0xea, 0xed, 0xed, 0xee, 0xed, 0xea, 0xf5, 0xea, 0xe8, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xfe, 0xf3, 0xfe, 0xf3, 0xfb, 0xf5, 0xfb, 0xff, 0xfb, 0xf6, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf6, 0xf3, 0xf6, 0xf3, 0xf6, 0xf3, 0xf6, 0xf4, 0xf6, 0xf3, 0xf6, 0xf3, 0xec, 0xea, 0xec, 0xea, 0xec, 0xea, 0xec, 0xea, 0xea, 0xec, 0xea, 0xec, 0xea, 0xea, 0xea, 0xec, 0xea, 0xec, 0xec, 0xea, 0xea, 0xec, 0xea, 0xec, 0xea, 0xea, 0xea, 0xea, 0xea, 0xec, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xec, 0xea, 0xec, 0xea, 0xea, 0xea, 0xea, 0xea, 0xec, 0xea, 0xec, 0xed, 0xf4, 0xf3, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf6, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf3, 0xf3, 0xec, 0xf3, 0xec, 0xf3, 0xf3, 0xed, 0xf3, 0xf3, 0xed, 0xed, 0xed, 0xf4, 0xf6, 0xed, 0xf6, 0xf4, 0xf6, 0xf4, 0xf3, 0xf4, 0xf6, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf6, 0xed, 0xf6, 0xf4, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf4, 0xf6, 0xed, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf3, 0xf6, 0xf4, 0xf6, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf6, 0xf3, 0xf3, 0xec, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xec, 0xf3, 0xed, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xed, 0xf3, 0xed, 0xf3, 0xec, 0xf3, 0xed, 0xf3, 0xed, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xfb, 0xfc, 0xf7, 0xfc, 0xf7, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xf7, 0xfc, 0xf7, 0xfc, 0xf7, 0xfc, 0xf7, 0xfb, 0xf7, 0xfc, 0xf7, 0xfb, 0xf7, 0xfc, 0xf6, 0xfc, 0xf7, 0xfc, 0xf7, 0xfc, 0xfc, 0xf7, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xf3, 0xf4, 0xf4, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xed, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xed, 0xed, 0xf4, 0xf4, 0xf4, 0xf6, 0xfb, 0xf4, 0xfb, 0xf4, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf4, 0xf4, 0xf6, 0xf6, 0xf3, 0xf6, 0xf6, 0xf4, 0xf4, 0xf6, 0xf6, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0xf6, 0xf6, 0xf4, 0xf5, 0xf5, 0xfb, 0xf5, 0xf4, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf6, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xed, 0xea, 0xed, 0xea, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf5, 0xea, 0xed, 0xea, 0xed, 0xea, 0xed, 0xea, 0xed, 0xea, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf5, 0xed, 0xf5, 0xf3, 0xee, 0xe8, 0xed, 0xf5, 0xea, 0xed, 0xea, 0xed, 0xea, 0xed, 0xea, 0xed, 0xea, 0xed, 0xfe, 0xf5, 0xfe, 0xf5, 0xfe, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xed, 0xea, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xea, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-};
-
-const lv_img_dsc_t image12 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image12_map,
-};
@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE13
-#define LV_ATTRIBUTE_IMG_IMAGE13
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE13 uint8_t image13_map[] = {
-  0xe1, 0xe3, 0xf8, 0xff, 	/*Color of index 0*/
-  0xa1, 0xb9, 0xf6, 0xff, 	/*Color of index 1*/
-  0xc1, 0xc3, 0xc8, 0xff, 	/*Color of index 2*/
-  0xac, 0xb8, 0xe3, 0xff, 	/*Color of index 3*/
-  0xb4, 0xb4, 0xb8, 0xff, 	/*Color of index 4*/
-  0x88, 0x9e, 0xf5, 0xff, 	/*Color of index 5*/
-  0x90, 0xa0, 0xc9, 0xff, 	/*Color of index 6*/
-  0x84, 0x99, 0xe4, 0xff, 	/*Color of index 7*/
-  0x75, 0x90, 0xda, 0xff, 	/*Color of index 8*/
-  0x86, 0x8c, 0xcb, 0xff, 	/*Color of index 9*/
-  0x56, 0x82, 0xee, 0xff, 	/*Color of index 10*/
-  0x64, 0x80, 0xcf, 0xff, 	/*Color of index 11*/
-  0x68, 0x7c, 0xba, 0xff, 	/*Color of index 12*/
-  0x40, 0x6f, 0xef, 0xff, 	/*Color of index 13*/
-  0x53, 0x70, 0xde, 0xff, 	/*Color of index 14*/
-  0x75, 0x7f, 0x99, 0xff, 	/*Color of index 15*/
-  0x6b, 0x67, 0xeb, 0xff, 	/*Color of index 16*/
-  0x35, 0x68, 0xf3, 0xff, 	/*Color of index 17*/
-  0x30, 0x66, 0xfb, 0xff, 	/*Color of index 18*/
-  0x35, 0x68, 0xe9, 0xff, 	/*Color of index 19*/
-  0x22, 0x62, 0xfd, 0xff, 	/*Color of index 20*/
-  0x40, 0x68, 0xde, 0xff, 	/*Color of index 21*/
-  0x2c, 0x61, 0xfb, 0xff, 	/*Color of index 22*/
-  0x44, 0x6a, 0xd0, 0xff, 	/*Color of index 23*/
-  0x2d, 0x61, 0xf1, 0xff, 	/*Color of index 24*/
-  0x38, 0x61, 0xdd, 0xff, 	/*Color of index 25*/
-  0x4a, 0x68, 0xbb, 0xff, 	/*Color of index 26*/
-  0x60, 0x6e, 0x9c, 0xff, 	/*Color of index 27*/
-  0x60, 0x60, 0xc2, 0xff, 	/*Color of index 28*/
-  0x36, 0x61, 0xc8, 0xff, 	/*Color of index 29*/
-  0x21, 0x50, 0xf9, 0xff, 	/*Color of index 30*/
-  0x27, 0x55, 0xdd, 0xff, 	/*Color of index 31*/
-  0x4b, 0x4d, 0xea, 0xff, 	/*Color of index 32*/
-  0x50, 0x60, 0xa7, 0xff, 	/*Color of index 33*/
-  0x53, 0x5d, 0x8f, 0xff, 	/*Color of index 34*/
-  0x62, 0x61, 0x78, 0xff, 	/*Color of index 35*/
-  0x2e, 0x51, 0xb5, 0xff, 	/*Color of index 36*/
-  0x48, 0x48, 0xc8, 0xff, 	/*Color of index 37*/
-  0x4e, 0x4a, 0xaf, 0xff, 	/*Color of index 38*/
-  0x53, 0x4e, 0x9a, 0xff, 	/*Color of index 39*/
-  0x16, 0x47, 0xbd, 0xff, 	/*Color of index 40*/
-  0x34, 0x4d, 0x96, 0xff, 	/*Color of index 41*/
-  0x3f, 0x50, 0x7d, 0xff, 	/*Color of index 42*/
-  0x3e, 0x31, 0xd9, 0xff, 	/*Color of index 43*/
-  0x26, 0x43, 0x9a, 0xff, 	/*Color of index 44*/
-  0x1b, 0x3b, 0xb2, 0xff, 	/*Color of index 45*/
-  0x26, 0x2d, 0xdd, 0xff, 	/*Color of index 46*/
-  0x39, 0x30, 0xc9, 0xff, 	/*Color of index 47*/
-  0x37, 0x34, 0xb5, 0xff, 	/*Color of index 48*/
-  0x49, 0x47, 0x61, 0xff, 	/*Color of index 49*/
-  0x24, 0x3e, 0x7e, 0xff, 	/*Color of index 50*/
-  0x2b, 0x2a, 0xbd, 0xff, 	/*Color of index 51*/
-  0x3b, 0x33, 0x98, 0xff, 	/*Color of index 52*/
-  0x26, 0x1c, 0xe9, 0xff, 	/*Color of index 53*/
-  0x28, 0x1f, 0xd7, 0xff, 	/*Color of index 54*/
-  0x2b, 0x21, 0xc7, 0xff, 	/*Color of index 55*/
-  0x12, 0x33, 0x8f, 0xff, 	/*Color of index 56*/
-  0x2a, 0x2e, 0x94, 0xff, 	/*Color of index 57*/
-  0x1e, 0x13, 0xf0, 0xff, 	/*Color of index 58*/
-  0x1b, 0x16, 0xe2, 0xff, 	/*Color of index 59*/
-  0x29, 0x22, 0xb4, 0xff, 	/*Color of index 60*/
-  0x22, 0x18, 0xd7, 0xff, 	/*Color of index 61*/
-  0x3b, 0x34, 0x70, 0xff, 	/*Color of index 62*/
-  0x10, 0x12, 0xed, 0xff, 	/*Color of index 63*/
-  0x20, 0x1b, 0xc8, 0xff, 	/*Color of index 64*/
-  0x1c, 0x14, 0xd6, 0xff, 	/*Color of index 65*/
-  0x1e, 0x1b, 0xbc, 0xff, 	/*Color of index 66*/
-  0x16, 0x0f, 0xe3, 0xff, 	/*Color of index 67*/
-  0x13, 0x12, 0xd6, 0xff, 	/*Color of index 68*/
-  0x1d, 0x2c, 0x75, 0xff, 	/*Color of index 69*/
-  0x1d, 0x09, 0xe9, 0xff, 	/*Color of index 70*/
-  0x13, 0x08, 0xef, 0xff, 	/*Color of index 71*/
-  0x14, 0x15, 0xc1, 0xff, 	/*Color of index 72*/
-  0x24, 0x1e, 0x9c, 0xff, 	/*Color of index 73*/
-  0x1d, 0x11, 0xc9, 0xff, 	/*Color of index 74*/
-  0x1b, 0x0c, 0xd7, 0xff, 	/*Color of index 75*/
-  0x1b, 0x18, 0xae, 0xff, 	/*Color of index 76*/
-  0x23, 0x20, 0x85, 0xff, 	/*Color of index 77*/
-  0x10, 0x08, 0xdb, 0xff, 	/*Color of index 78*/
-  0x11, 0x0d, 0xaf, 0xff, 	/*Color of index 79*/
-  0x18, 0x20, 0x6c, 0xff, 	/*Color of index 80*/
-  0x15, 0x12, 0x9c, 0xff, 	/*Color of index 81*/
-  0x0b, 0x07, 0xc2, 0xff, 	/*Color of index 82*/
-  0x19, 0x15, 0x85, 0xff, 	/*Color of index 83*/
-  0x23, 0x1e, 0x52, 0xff, 	/*Color of index 84*/
-  0x09, 0x05, 0xa2, 0xff, 	/*Color of index 85*/
-  0x0b, 0x14, 0x6c, 0xff, 	/*Color of index 86*/
-  0x0b, 0x0c, 0x83, 0xff, 	/*Color of index 87*/
-  0x07, 0x06, 0x91, 0xff, 	/*Color of index 88*/
-  0x12, 0x15, 0x58, 0xff, 	/*Color of index 89*/
-  0x1f, 0x1e, 0x33, 0xff, 	/*Color of index 90*/
-  0x14, 0x0f, 0x69, 0xff, 	/*Color of index 91*/
-  0x0b, 0x15, 0x4b, 0xff, 	/*Color of index 92*/
-  0x03, 0x02, 0x81, 0xff, 	/*Color of index 93*/
-  0x04, 0x03, 0x69, 0xff, 	/*Color of index 94*/
-  0x08, 0x0d, 0x3a, 0xff, 	/*Color of index 95*/
-  0x06, 0x05, 0x53, 0xff, 	/*Color of index 96*/
-  0x0c, 0x0b, 0x21, 0xff, 	/*Color of index 97*/
-  0x02, 0x01, 0x39, 0xff, 	/*Color of index 98*/
-  0x01, 0x01, 0x28, 0xff, 	/*Color of index 99*/
-  0x01, 0x00, 0x1a, 0xff, 	/*Color of index 100*/
-  0x03, 0x00, 0x0e, 0xff, 	/*Color of index 101*/
-  0xe9, 0xfa, 0xfd, 0xff, 	/*Color of index 102*/
-  0xf4, 0xf7, 0xfc, 0xff, 	/*Color of index 103*/
-  0xe9, 0xf1, 0xfc, 0xff, 	/*Color of index 104*/
-  0xd5, 0xec, 0xfd, 0xff, 	/*Color of index 105*/
-  0xce, 0xde, 0xfc, 0xff, 	/*Color of index 106*/
-  0xbb, 0xdf, 0xfc, 0xff, 	/*Color of index 107*/
-  0xcb, 0xd4, 0xe8, 0xff, 	/*Color of index 108*/
-  0xb8, 0xd1, 0xf7, 0xff, 	/*Color of index 109*/
-  0xa9, 0xca, 0xf8, 0xff, 	/*Color of index 110*/
-  0xb8, 0xc6, 0xe3, 0xff, 	/*Color of index 111*/
-  0x9a, 0xc2, 0xf9, 0xff, 	/*Color of index 112*/
-  0x89, 0xb2, 0xf8, 0xff, 	/*Color of index 113*/
-  0x9a, 0xb4, 0xe4, 0xff, 	/*Color of index 114*/
-  0xa8, 0xb5, 0xce, 0xff, 	/*Color of index 115*/
-  0x8f, 0xac, 0xe5, 0xff, 	/*Color of index 116*/
-  0x74, 0xa6, 0xf7, 0xff, 	/*Color of index 117*/
-  0x75, 0xa0, 0xe2, 0xff, 	/*Color of index 118*/
-  0x70, 0x99, 0xf2, 0xff, 	/*Color of index 119*/
-  0x63, 0x94, 0xf4, 0xff, 	/*Color of index 120*/
-  0x57, 0x8a, 0xf2, 0xff, 	/*Color of index 121*/
-  0x78, 0x90, 0xc1, 0xff, 	/*Color of index 122*/
-  0x5b, 0x8a, 0xdd, 0xff, 	/*Color of index 123*/
-  0x95, 0x97, 0x9a, 0xff, 	/*Color of index 124*/
-  0x44, 0x7c, 0xef, 0xff, 	/*Color of index 125*/
-  0x54, 0x7f, 0xdf, 0xff, 	/*Color of index 126*/
-  0x35, 0x74, 0xfa, 0xff, 	/*Color of index 127*/
-  0x4f, 0x7c, 0xcd, 0xff, 	/*Color of index 128*/
-  0x37, 0x74, 0xef, 0xff, 	/*Color of index 129*/
-  0x46, 0x77, 0xdf, 0xff, 	/*Color of index 130*/
-  0x1c, 0x74, 0xf7, 0xff, 	/*Color of index 131*/
-  0x28, 0x73, 0xf4, 0xff, 	/*Color of index 132*/
-  0x28, 0x75, 0xec, 0xff, 	/*Color of index 133*/
-  0x27, 0x71, 0xf9, 0xff, 	/*Color of index 134*/
-  0x25, 0x71, 0xf5, 0xff, 	/*Color of index 135*/
-  0x24, 0x6b, 0xfc, 0xff, 	/*Color of index 136*/
-  0x25, 0x6d, 0xf4, 0xff, 	/*Color of index 137*/
-  0x19, 0x6c, 0xfb, 0xff, 	/*Color of index 138*/
-  0x38, 0x6f, 0xe4, 0xff, 	/*Color of index 139*/
-  0x2a, 0x69, 0xfb, 0xff, 	/*Color of index 140*/
-  0x47, 0x74, 0xcc, 0xff, 	/*Color of index 141*/
-  0x2c, 0x6a, 0xf3, 0xff, 	/*Color of index 142*/
-  0x38, 0x6e, 0xd6, 0xff, 	/*Color of index 143*/
-  0x2c, 0x6b, 0xdf, 0xff, 	/*Color of index 144*/
-  0x22, 0x62, 0xf4, 0xff, 	/*Color of index 145*/
-  0x28, 0x60, 0xdf, 0xff, 	/*Color of index 146*/
-  0x36, 0x5a, 0xad, 0xff, 	/*Color of index 147*/
-  0x1e, 0x2f, 0x54, 0xff, 	/*Color of index 148*/
-  0xe2, 0xe3, 0xe3, 0xff, 	/*Color of index 149*/
-  0xfd, 0xfe, 0xfd, 0xff, 	/*Color of index 150*/
-  0x06, 0x0b, 0x01, 0xff, 	/*Color of index 151*/
-  0xfc, 0xfd, 0xe8, 0xff, 	/*Color of index 152*/
-  0xfa, 0xf9, 0xf3, 0xff, 	/*Color of index 153*/
-  0xf7, 0xf3, 0xe8, 0xff, 	/*Color of index 154*/
-  0xfc, 0xf3, 0xd1, 0xff, 	/*Color of index 155*/
-  0xec, 0xec, 0xe8, 0xff, 	/*Color of index 156*/
-  0xe5, 0xd7, 0xa9, 0xff, 	/*Color of index 157*/
-  0xe2, 0xcc, 0x8d, 0xff, 	/*Color of index 158*/
-  0xd8, 0xc3, 0x8e, 0xff, 	/*Color of index 159*/
-  0xd5, 0xbc, 0x7c, 0xff, 	/*Color of index 160*/
-  0xd3, 0xb8, 0x6c, 0xff, 	/*Color of index 161*/
-  0xd2, 0xb3, 0x62, 0xff, 	/*Color of index 162*/
-  0xd2, 0xb3, 0x54, 0xff, 	/*Color of index 163*/
-  0xcc, 0xad, 0x61, 0xff, 	/*Color of index 164*/
-  0xc4, 0xaa, 0x6b, 0xff, 	/*Color of index 165*/
-  0xce, 0xad, 0x59, 0xff, 	/*Color of index 166*/
-  0xd0, 0xac, 0x56, 0xff, 	/*Color of index 167*/
-  0xcb, 0xac, 0x54, 0xff, 	/*Color of index 168*/
-  0xca, 0xad, 0x4c, 0xff, 	/*Color of index 169*/
-  0xc6, 0xa3, 0x46, 0xff, 	/*Color of index 170*/
-  0x11, 0x0f, 0x01, 0xff, 	/*Color of index 171*/
-  0x0c, 0x0a, 0x04, 0xff, 	/*Color of index 172*/
-  0xf5, 0xf4, 0xf3, 0xff, 	/*Color of index 173*/
-  0xe5, 0xde, 0xd6, 0xff, 	/*Color of index 174*/
-  0xe8, 0xda, 0xbf, 0xff, 	/*Color of index 175*/
-  0xd4, 0xce, 0xc5, 0xff, 	/*Color of index 176*/
-  0xc2, 0xb6, 0x9e, 0xff, 	/*Color of index 177*/
-  0xc8, 0xb1, 0x7f, 0xff, 	/*Color of index 178*/
-  0xac, 0xa8, 0xa4, 0xff, 	/*Color of index 179*/
-  0xcc, 0xb0, 0x6f, 0xff, 	/*Color of index 180*/
-  0xac, 0x9e, 0x87, 0xff, 	/*Color of index 181*/
-  0xbd, 0xa1, 0x6a, 0xff, 	/*Color of index 182*/
-  0xc7, 0xa4, 0x58, 0xff, 	/*Color of index 183*/
-  0xb2, 0x9b, 0x66, 0xff, 	/*Color of index 184*/
-  0xbc, 0x98, 0x54, 0xff, 	/*Color of index 185*/
-  0xa8, 0x90, 0x60, 0xff, 	/*Color of index 186*/
-  0x8a, 0x88, 0x85, 0xff, 	/*Color of index 187*/
-  0xae, 0x8b, 0x4e, 0xff, 	/*Color of index 188*/
-  0x93, 0x82, 0x64, 0xff, 	/*Color of index 189*/
-  0xab, 0x84, 0x3f, 0xff, 	/*Color of index 190*/
-  0x97, 0x7e, 0x4e, 0xff, 	/*Color of index 191*/
-  0xa0, 0x79, 0x39, 0xff, 	/*Color of index 192*/
-  0x89, 0x70, 0x4b, 0xff, 	/*Color of index 193*/
-  0x91, 0x72, 0x3c, 0xff, 	/*Color of index 194*/
-  0x6e, 0x68, 0x63, 0xff, 	/*Color of index 195*/
-  0x8b, 0x68, 0x39, 0xff, 	/*Color of index 196*/
-  0x82, 0x61, 0x3a, 0xff, 	/*Color of index 197*/
-  0x8c, 0x64, 0x2b, 0xff, 	/*Color of index 198*/
-  0x8a, 0x61, 0x21, 0xff, 	/*Color of index 199*/
-  0x71, 0x5c, 0x3a, 0xff, 	/*Color of index 200*/
-  0x83, 0x5c, 0x32, 0xff, 	/*Color of index 201*/
-  0x8b, 0x5c, 0x29, 0xff, 	/*Color of index 202*/
-  0x84, 0x5c, 0x29, 0xff, 	/*Color of index 203*/
-  0x79, 0x58, 0x37, 0xff, 	/*Color of index 204*/
-  0x8b, 0x5b, 0x22, 0xff, 	/*Color of index 205*/
-  0x5c, 0x51, 0x4f, 0xff, 	/*Color of index 206*/
-  0x8e, 0x54, 0x32, 0xff, 	/*Color of index 207*/
-  0x81, 0x5a, 0x22, 0xff, 	/*Color of index 208*/
-  0x7d, 0x56, 0x29, 0xff, 	/*Color of index 209*/
-  0x83, 0x54, 0x29, 0xff, 	/*Color of index 210*/
-  0x70, 0x51, 0x34, 0xff, 	/*Color of index 211*/
-  0x82, 0x54, 0x22, 0xff, 	/*Color of index 212*/
-  0x70, 0x53, 0x2a, 0xff, 	/*Color of index 213*/
-  0x7b, 0x51, 0x23, 0xff, 	/*Color of index 214*/
-  0x7c, 0x52, 0x1a, 0xff, 	/*Color of index 215*/
-  0x71, 0x4b, 0x27, 0xff, 	/*Color of index 216*/
-  0x61, 0x48, 0x34, 0xff, 	/*Color of index 217*/
-  0x74, 0x4c, 0x19, 0xff, 	/*Color of index 218*/
-  0x4b, 0x44, 0x40, 0xff, 	/*Color of index 219*/
-  0x63, 0x47, 0x25, 0xff, 	/*Color of index 220*/
-  0x5b, 0x42, 0x25, 0xff, 	/*Color of index 221*/
-  0x54, 0x3a, 0x1d, 0xff, 	/*Color of index 222*/
-  0x3a, 0x33, 0x2d, 0xff, 	/*Color of index 223*/
-  0x4a, 0x33, 0x16, 0xff, 	/*Color of index 224*/
-  0x41, 0x2b, 0x12, 0xff, 	/*Color of index 225*/
-  0x2f, 0x27, 0x25, 0xff, 	/*Color of index 226*/
-  0x39, 0x23, 0x0c, 0xff, 	/*Color of index 227*/
-  0x1f, 0x1b, 0x19, 0xff, 	/*Color of index 228*/
-  0x30, 0x1b, 0x07, 0xff, 	/*Color of index 229*/
-  0x1e, 0x11, 0x0d, 0xff, 	/*Color of index 230*/
-  0x15, 0x0f, 0x0b, 0xff, 	/*Color of index 231*/
-  0x1d, 0x10, 0x02, 0xff, 	/*Color of index 232*/
-  0x24, 0x0f, 0x01, 0xff, 	/*Color of index 233*/
-  0x13, 0x0a, 0x04, 0xff, 	/*Color of index 234*/
-  0x1a, 0x0a, 0x01, 0xff, 	/*Color of index 235*/
-  0x18, 0x05, 0x00, 0xff, 	/*Color of index 236*/
-  0x11, 0x05, 0x02, 0xff, 	/*Color of index 237*/
-  0x78, 0x75, 0x75, 0xff, 	/*Color of index 238*/
-  0x42, 0x38, 0x3c, 0xff, 	/*Color of index 239*/
-  0x14, 0x0b, 0x0e, 0xff, 	/*Color of index 240*/
-  0x18, 0x09, 0x09, 0xff, 	/*Color of index 241*/
-  0x13, 0x09, 0x09, 0xff, 	/*Color of index 242*/
-  0x0d, 0x08, 0x0a, 0xff, 	/*Color of index 243*/
-  0x13, 0x06, 0x0a, 0xff, 	/*Color of index 244*/
-  0x0c, 0x02, 0x02, 0xff, 	/*Color of index 245*/
-  0x03, 0x00, 0x00, 0xff, 	/*Color of index 246*/
-  0xd6, 0xd2, 0xd4, 0xff, 	/*Color of index 247*/
-  0x5f, 0x5d, 0x5f, 0xff, 	/*Color of index 248*/
-  0x18, 0x07, 0x11, 0xff, 	/*Color of index 249*/
-  0x14, 0x03, 0x10, 0xff, 	/*Color of index 250*/
-  0x0b, 0x04, 0x0a, 0xff, 	/*Color of index 251*/
-  0x4b, 0x46, 0x4c, 0xff, 	/*Color of index 252*/
-  0x35, 0x29, 0x3b, 0xff, 	/*Color of index 253*/
-  0x23, 0x15, 0x37, 0xff, 	/*Color of index 254*/
-  0x0b, 0x06, 0x11, 0xff, 	/*Color of index 255*/
-
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xed, 0xab, 0xea, 0xf4, 0xf4, 0xf1, 0xf0, 0xed, 0xe7, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xe7, 0xf1, 0xf4, 0xf2, 0xed, 0xf0, 0xed, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf4, 0xf0, 0xe7, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xed, 0xf2, 0xf3, 0xf4, 0xf2, 0xe7, 0xac, 0xea, 0xe7, 0xf0, 0xf4, 0xf3, 0x97, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xed, 0xfa, 0xe6, 0xf0, 0xf2, 0xe7, 0xf3, 0xf4, 0xf0, 0xf4, 0xf4, 0xf1, 0xf2, 0xf0, 0xe7, 0xed, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xed, 0xf0, 0xf0, 0xac, 0xf3, 0xf0, 0xf6, 0xf6, 0xfb, 0xf6, 0xf5, 0xea, 0xea, 0xf2, 0xf0, 0xf3, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf4, 0xed, 0xe7, 0xf3, 0xe7, 0xf3, 0xf6, 0xf5, 0xf0, 0xe7, 0xf4, 0xf5, 0xed, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xe7, 0xfb, 0xed, 0xf3, 0xf6, 0xe2, 0xc3, 0xb3, 0x02, 0xb3, 0xdb, 0xf6, 0xab, 0xf1, 0xf9, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xea, 0xf4, 0xe7, 0xf3, 0xf6, 0xed, 0xe2, 0xdb, 0xef, 0xe6, 0xf6, 0xf6, 0xf0, 0xed, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf5, 0xf2, 0xe7, 0xf0, 0xee, 0xad, 0x96, 0x96, 0x96, 0x96, 0x95, 0xe1, 0xfb, 0x97, 0xf9, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xe7, 0xed, 0xe7, 0xea, 0xf6, 0xdb, 0x02, 0x96, 0x96, 0x96, 0xad, 0x04, 0xdb, 0xf6, 0xed, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf6, 0x7c, 0x96, 0x96, 0x96, 0x99, 0x67, 0x99, 0x96, 0xee, 0xf6, 0xe7, 0xf1, 0xf4, 0xe7, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xe7, 0xac, 0xed, 0xf3, 0x95, 0x96, 0x96, 0x99, 0x96, 0x96, 0x96, 0x67, 0xb3, 0xf6, 0xac, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf5, 0xe2, 0x9c, 0x96, 0x98, 0x98, 0x99, 0x98, 0x67, 0x67, 0x02, 0x23, 0xf6, 0xe6, 0xed, 0xf3, 0xf0, 0xed, 0xf3, 0xe7, 0xf2, 0xf0, 0xf2, 0xf0, 0xac, 0xea, 0xf2, 0xf6, 0xbb, 0x96, 0x96, 0x67, 0x96, 0x99, 0x96, 0x96, 0x96, 0x96, 0x04, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xed, 0xf3, 0xe6, 0xf7, 0x96, 0x66, 0x99, 0x98, 0x99, 0x68, 0x00, 0x21, 0x72, 0x23, 0xf6, 0xea, 0xf5, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe7, 0xf6, 0xe2, 0x00, 0x67, 0x96, 0x67, 0x96, 0x99, 0x96, 0x99, 0x96, 0x96, 0x96, 0xfc, 0xf6, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xed, 0xf6, 0xc3, 0x96, 0x67, 0x99, 0x98, 0x98, 0x67, 0x6d, 0x3c, 0x1c, 0x68, 0xc3, 0xfb, 0xea, 0xf0, 0xed, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xed, 0xf6, 0x04, 0x96, 0xad, 0x95, 0x96, 0x67, 0x99, 0x99, 0x66, 0x99, 0x96, 0xad, 0xef, 0xf6, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf3, 0xf2, 0xfb, 0xed, 0x7c, 0x96, 0x96, 0x98, 0x96, 0x6d, 0x1c, 0x4f, 0x42, 0x01, 0x96, 0xbb, 0xf2, 0xf6, 0xe7, 0xf4, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xed, 0xf5, 0xee, 0x96, 0x96, 0x73, 0xf8, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xbb, 0xf5, 0xac, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xfb, 0xf6, 0x7c, 0x96, 0x01, 0x08, 0x30, 0x4f, 0x52, 0x55, 0x2b, 0x6e, 0x96, 0x04, 0xef, 0xf6, 0xf5, 0xab, 0xf5, 0xf5, 0xf5, 0xf6, 0xe7, 0xbb, 0x96, 0x68, 0x00, 0x1c, 0x62, 0x73, 0x67, 0x67, 0x66, 0x68, 0x96, 0xb1, 0xf6, 0xed, 0xf2, 0xac, 0xf9, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xac, 0xfb, 0x22, 0x33, 0x48, 0x52, 0x41, 0x4f, 0x55, 0x48, 0x25, 0x08, 0x68, 0x68, 0x04, 0xf8, 0xef, 0xe4, 0xfe, 0xef, 0xee, 0xae, 0x67, 0x68, 0x74, 0x20, 0x33, 0x5e, 0x45, 0x1c, 0x0b, 0x08, 0x08, 0xbb, 0xab, 0xf5, 0xf1, 0xf2, 0xea, 0xff, 0xf1, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf5, 0x54, 0x2f, 0x48, 0x4b, 0x44, 0x4f, 0x55, 0x36, 0x42, 0x3c, 0x26, 0x05, 0x00, 0x67, 0x00, 0x95, 0x95, 0x68, 0x96, 0x6a, 0x05, 0x1c, 0x37, 0x37, 0x37, 0x58, 0x33, 0x3c, 0x3c, 0x30, 0x1c, 0x5a, 0xfb, 0xf2, 0xf9, 0xf2, 0xea, 0xf9, 0xea, 0xea, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xe7, 0xf5, 0x5f, 0x2b, 0x4b, 0x4e, 0x41, 0x4f, 0x55, 0x3d, 0x3d, 0x3d, 0x41, 0x48, 0x37, 0x20, 0x08, 0x03, 0x01, 0x06, 0x0b, 0x33, 0x40, 0x40, 0x36, 0x3d, 0x36, 0x58, 0x36, 0x35, 0x35, 0x2b, 0x30, 0x64, 0xf0, 0xfa, 0xf9, 0xf2, 0xf2, 0xf2, 0xea, 0xab, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf3, 0xf0, 0xf2, 0xf3, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf3, 0xf0, 0x63, 0x2f, 0x41, 0x4e, 0x4b, 0x4c, 0x55, 0x4a, 0x3a, 0x3a, 0x44, 0x3b, 0x44, 0x4a, 0x42, 0x39, 0x45, 0x5e, 0x3c, 0x3d, 0x3d, 0x3b, 0x35, 0x2e, 0x4c, 0x58, 0x3d, 0x35, 0x3b, 0x2e, 0x53, 0x63, 0xf0, 0xfa, 0xfa, 0xf0, 0xea, 0xf2, 0xea, 0xeb, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xf3, 0x65, 0x30, 0x3b, 0x4e, 0x52, 0x4c, 0x58, 0x40, 0x3a, 0x47, 0x3f, 0x3b, 0x43, 0x43, 0x37, 0x49, 0x56, 0x49, 0x3d, 0x43, 0x35, 0x3a, 0x40, 0x33, 0x53, 0x51, 0x36, 0x44, 0x35, 0x37, 0x56, 0x64, 0x97, 0xf4, 0xf0, 0xea, 0xf2, 0xf4, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xf0, 0xf3, 0xf0, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xf2, 0xea, 0x65, 0x39, 0x36, 0x4e, 0x4a, 0x48, 0x58, 0x42, 0x46, 0x3f, 0x44, 0x3b, 0x43, 0x41, 0x40, 0x49, 0x5e, 0x37, 0x43, 0x46, 0x3b, 0x43, 0x36, 0x33, 0x57, 0x4c, 0x36, 0x41, 0x3b, 0x37, 0x56, 0x65, 0xab, 0xea, 0xf1, 0xea, 0xea, 0xff, 0xf4, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf6, 0x50, 0x37, 0x4e, 0x4b, 0x48, 0x58, 0x4c, 0x3b, 0x41, 0x41, 0x4b, 0x41, 0x3d, 0x3c, 0x58, 0x49, 0x37, 0x46, 0x47, 0x43, 0x43, 0x37, 0x51, 0x58, 0x40, 0x41, 0x4b, 0x43, 0x36, 0x56, 0xfb, 0xab, 0xea, 0xea, 0xeb, 0xac, 0xf9, 0xfa, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf6, 0x59, 0x33, 0x4e, 0x4b, 0x4b, 0x55, 0x51, 0x40, 0x41, 0x41, 0x44, 0x41, 0x40, 0x4c, 0x5d, 0x3c, 0x41, 0x4b, 0x43, 0x43, 0x41, 0x40, 0x5d, 0x48, 0x41, 0x4b, 0x4a, 0x43, 0x3d, 0x4d, 0x64, 0xe7, 0xed, 0xf1, 0xea, 0xea, 0xff, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xfa, 0x65, 0x5c, 0x33, 0x4e, 0x4e, 0x46, 0x55, 0x51, 0x40, 0x44, 0x44, 0x46, 0x4b, 0x42, 0x58, 0x51, 0x37, 0x4b, 0x3b, 0x44, 0x41, 0x3d, 0x51, 0x58, 0x3d, 0x4b, 0x44, 0x40, 0x4b, 0x4b, 0x3c, 0x63, 0xff, 0xfa, 0xf9, 0xea, 0xea, 0xf4, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf9, 0xfa, 0xf4, 0xff, 0xf3, 0xf3, 0xf3, 0xe7, 0xac, 0xea, 0xf1, 0xf5, 0x5c, 0x37, 0x4e, 0x4b, 0x4e, 0x4a, 0x57, 0x37, 0x44, 0x4e, 0x46, 0x4a, 0x4c, 0x5d, 0x3c, 0x44, 0x4e, 0x43, 0x4b, 0x44, 0x33, 0x5e, 0x4c, 0x4b, 0x46, 0x4a, 0x48, 0x44, 0x43, 0x3c, 0x60, 0x64, 0xff, 0xf2, 0xeb, 0xea, 0xea, 0xab, 0xea, 0xff, 0xf3, 0xea, 0xab, 0xea, 0xab, 0xf4, 0xf4, 0xf4, 0xf0, 0xf3, 0xe7, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf9, 0xf9, 0xf9, 0xf4, 0xff, 0xe7, 0xf3, 0xfb, 0xed, 0xea, 0xe8, 0xed, 0x60, 0x36, 0x43, 0x4a, 0x4b, 0x44, 0x57, 0x42, 0x44, 0x43, 0x4e, 0x40, 0x51, 0x57, 0x42, 0x4b, 0x46, 0x41, 0x4b, 0x40, 0x57, 0x57, 0x33, 0x46, 0x46, 0x4b, 0x44, 0x4b, 0x4b, 0x40, 0x53, 0x62, 0xff, 0xea, 0xea, 0xf1, 0xf4, 0xea, 0xf2, 0xff, 0xf3, 0xab, 0xea, 0xe8, 0xf1, 0xf4, 0xf0, 0xf1, 0xf6, 0xf6, 0xac, 0xf3, 0xf4, 0xe6, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xea, 0xab, 0xab, 0xac, 0xab, 0xf3, 0xed, 0xf0, 0xf9, 0xfa, 0xfb, 0x65, 0x5b, 0x40, 0x4b, 0x4a, 0x4e, 0x4a, 0x5d, 0x41, 0x41, 0x4e, 0x4b, 0x40, 0x55, 0x4f, 0x43, 0x4e, 0x43, 0x48, 0x33, 0x4c, 0x5d, 0x3c, 0x40, 0x4b, 0x4e, 0x43, 0x4b, 0x4b, 0x4b, 0x41, 0x49, 0x60, 0x65, 0xf3, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xab, 0xea, 0xea, 0xf4, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xdb, 0xf8, 0xe4, 0xf3, 0xea, 0xf2, 0xf4, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xab, 0xea, 0xab, 0xab, 0xeb, 0xed, 0xf5, 0xf6, 0xf6, 0xf6, 0x65, 0xf6, 0x50, 0x37, 0x48, 0x42, 0x40, 0x4a, 0x5d, 0x4a, 0x4e, 0x4e, 0x4b, 0x4f, 0x58, 0x42, 0x4b, 0x46, 0x4e, 0x42, 0x3c, 0x5d, 0x55, 0x40, 0x4a, 0x44, 0x4b, 0x4b, 0x4b, 0x41, 0x4b, 0x4b, 0x37, 0x4d, 0x62, 0x65, 0xf1, 0xf1, 0xfa, 0xfa, 0xfa, 0xea, 0xeb, 0xeb, 0xf4, 0xfa, 0xfa, 0x65, 0xe6, 0xbb, 0x96, 0x96, 0xae, 0xef, 0xf3, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfb, 0xf9, 0xf6, 0xf6, 0xea, 0xe2, 0xce, 0xc3, 0xee, 0xbb, 0xee, 0x2a, 0x50, 0x57, 0x58, 0x5d, 0x58, 0x51, 0x5e, 0x3c, 0x4a, 0x4b, 0x42, 0x5d, 0x51, 0x4c, 0x44, 0x4e, 0x4b, 0x40, 0x57, 0x5d, 0x42, 0x43, 0x46, 0x44, 0x44, 0x4a, 0x41, 0x4a, 0x52, 0x4e, 0x4a, 0x36, 0x53, 0x62, 0xf5, 0xab, 0xab, 0xeb, 0xf2, 0xfa, 0xeb, 0xea, 0xab, 0xe7, 0xf5, 0xf3, 0x02, 0x96, 0x96, 0x99, 0x96, 0xae, 0xe6, 0xf5, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xac, 0xf4, 0xfb, 0xf5, 0xfd, 0xbb, 0x02, 0xad, 0x96, 0x66, 0x66, 0x69, 0x6b, 0x6d, 0x76, 0x13, 0x24, 0x24, 0x2c, 0x4d, 0x60, 0x57, 0x51, 0x4c, 0x49, 0x5e, 0x3c, 0x4c, 0x4b, 0x4e, 0x3d, 0x4f, 0x5e, 0x4c, 0x36, 0x46, 0x47, 0x4e, 0x48, 0x37, 0x42, 0x55, 0x4a, 0x4b, 0x4b, 0x4b, 0x42, 0x49, 0x5f, 0x64, 0xf3, 0x97, 0xfb, 0xfa, 0xfa, 0xea, 0x97, 0xf6, 0xf0, 0xb3, 0x96, 0xad, 0x67, 0x99, 0x96, 0x96, 0xfc, 0xf5, 0xf4, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xac, 0xf0, 0xf3, 0xf6, 0xe2, 0xb3, 0x9c, 0x96, 0x96, 0x66, 0x6b, 0x70, 0x76, 0x7b, 0x82, 0x82, 0x85, 0x7d, 0x7d, 0x79, 0x0a, 0x79, 0x7b, 0x93, 0x2d, 0x56, 0x5e, 0x60, 0x30, 0x48, 0x4b, 0x4a, 0x37, 0x57, 0x58, 0x37, 0x3d, 0x4e, 0x47, 0x43, 0x48, 0x33, 0x58, 0x48, 0x4a, 0x43, 0x44, 0x4b, 0x41, 0x3d, 0x37, 0x49, 0x60, 0x63, 0x64, 0x65, 0x64, 0x65, 0x64, 0x5a, 0x06, 0x96, 0x96, 0x99, 0x98, 0xad, 0xad, 0x96, 0xce, 0xf5, 0xf4, 0xf2, 0xf2, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xac, 0xf3, 0xe7, 0xbb, 0x99, 0x96, 0x96, 0x66, 0x6d, 0x76, 0x7e, 0x8b, 0x90, 0x81, 0x86, 0x7f, 0x88, 0x88, 0x86, 0x89, 0x7d, 0x8b, 0x81, 0x7d, 0x79, 0x7d, 0x21, 0x38, 0x57, 0x51, 0x4c, 0x33, 0x57, 0x5d, 0x37, 0x41, 0x43, 0x43, 0x4e, 0x3d, 0x37, 0x5d, 0x4c, 0x40, 0x44, 0x4e, 0x4e, 0x44, 0x4e, 0x47, 0x46, 0x3a, 0x2b, 0x26, 0x2c, 0x31, 0x54, 0x5e, 0x39, 0x25, 0x25, 0x0b, 0x69, 0x99, 0x98, 0xad, 0x96, 0x95, 0xe6, 0xf5, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf3, 0xf6, 0xe7, 0x02, 0x99, 0x96, 0x66, 0x69, 0x72, 0x7e, 0x8b, 0x89, 0x86, 0x86, 0x8c, 0x88, 0x8c, 0x88, 0x88, 0x88, 0x7f, 0x12, 0x8e, 0x7f, 0x87, 0x8c, 0x81, 0x7d, 0x78, 0x17, 0x2c, 0x5b, 0x56, 0x5e, 0x3c, 0x48, 0x44, 0x44, 0x43, 0x40, 0x42, 0x58, 0x48, 0x48, 0x41, 0x4b, 0x44, 0x4b, 0x4e, 0x43, 0x47, 0x46, 0x35, 0x36, 0x3c, 0x4d, 0x5b, 0x53, 0x3c, 0x36, 0x36, 0x36, 0x4c, 0x03, 0x96, 0x99, 0x96, 0x96, 0xc3, 0xf6, 0xf0, 0xf4, 0xf2, 0xf2, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf6, 0xdf, 0xae, 0x96, 0x96, 0x69, 0x6d, 0x7b, 0x8f, 0x85, 0x86, 0x8a, 0x86, 0x86, 0x84, 0x84, 0x83, 0x86, 0x83, 0x86, 0x14, 0x7f, 0x7f, 0x88, 0x86, 0x83, 0x85, 0x85, 0x8b, 0x7f, 0x79, 0x0a, 0x2a, 0x60, 0x4d, 0x33, 0x36, 0x4e, 0x41, 0x3c, 0x57, 0x49, 0x4b, 0x46, 0x4e, 0x4a, 0x4b, 0x4e, 0x47, 0x47, 0x41, 0x33, 0x4d, 0x5e, 0x5e, 0x51, 0x42, 0x3d, 0x35, 0x3a, 0x3a, 0x46, 0x2b, 0x3c, 0x0c, 0x68, 0xf7, 0xfc, 0xf6, 0xf0, 0xed, 0xf4, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xab, 0xf3, 0xfb, 0xf3, 0xae, 0x96, 0x66, 0x67, 0x6e, 0x7e, 0x82, 0x84, 0x88, 0x86, 0x88, 0x88, 0x86, 0x86, 0x83, 0x84, 0x83, 0x84, 0x86, 0x7f, 0x86, 0x87, 0x86, 0x83, 0x83, 0x83, 0x7f, 0x87, 0x7f, 0x11, 0x0a, 0x7b, 0x80, 0x38, 0x5d, 0x4c, 0x37, 0x37, 0x51, 0x53, 0x42, 0x43, 0x47, 0x43, 0x44, 0x4b, 0x46, 0x46, 0x4a, 0x3c, 0x56, 0x60, 0x57, 0x42, 0x41, 0x46, 0x46, 0x46, 0x3f, 0x35, 0x43, 0x52, 0x55, 0x30, 0x1b, 0xe4, 0xf6, 0xed, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xfa, 0xe7, 0x97, 0xab, 0x65, 0x04, 0x96, 0x9a, 0x66, 0x6e, 0x82, 0x81, 0x88, 0x86, 0x8a, 0x88, 0x86, 0x86, 0x88, 0x8a, 0x86, 0x8a, 0x86, 0x86, 0x87, 0x84, 0x84, 0x84, 0x87, 0x83, 0x86, 0x86, 0x86, 0x86, 0x86, 0x89, 0x84, 0x8b, 0x84, 0x79, 0x1d, 0x50, 0x56, 0x50, 0x57, 0x37, 0x4b, 0x47, 0x4e, 0x3b, 0x4b, 0x46, 0x52, 0x37, 0x53, 0x5e, 0x5e, 0x49, 0x37, 0x4b, 0x46, 0x4b, 0x4b, 0x3b, 0x48, 0x4f, 0x52, 0x4a, 0x2b, 0x34, 0x63, 0xf5, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0x97, 0xf6, 0xee, 0x96, 0xad, 0x66, 0x6b, 0x7b, 0x8b, 0x7f, 0x86, 0x88, 0x88, 0x7f, 0x0d, 0x81, 0x81, 0x7f, 0x7f, 0x89, 0x7f, 0x86, 0x83, 0x87, 0x8a, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x7f, 0x8e, 0x7f, 0x7d, 0x85, 0x7d, 0x78, 0x2a, 0x63, 0x45, 0x37, 0x3b, 0x4b, 0x43, 0x4e, 0x4e, 0x40, 0x3c, 0x57, 0x5e, 0x58, 0x3c, 0x41, 0x4b, 0x4e, 0x4b, 0x42, 0x40, 0x4f, 0x55, 0x48, 0x36, 0x35, 0x2f, 0x60, 0xff, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xfa, 0xea, 0x97, 0xe4, 0xad, 0x96, 0x68, 0x69, 0x08, 0x82, 0x7f, 0x86, 0x88, 0x86, 0x7f, 0x7d, 0x82, 0x8d, 0x1d, 0x1d, 0x1d, 0x0e, 0x81, 0x85, 0x83, 0x83, 0x83, 0x86, 0x8c, 0x7f, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x7f, 0x84, 0x89, 0x81, 0x8b, 0x80, 0x76, 0x7a, 0x50, 0x53, 0x33, 0x4b, 0x4b, 0x4b, 0x37, 0x4d, 0x5e, 0x5e, 0x48, 0x4a, 0x46, 0x4b, 0x4b, 0x40, 0x4c, 0x51, 0x58, 0x48, 0x36, 0x3d, 0x36, 0x2b, 0x5b, 0x64, 0x97, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xfb, 0xf5, 0xb3, 0x96, 0x69, 0x69, 0x71, 0x8d, 0x86, 0x88, 0x88, 0x7f, 0x81, 0x17, 0x29, 0x29, 0x22, 0x0c, 0x7a, 0x7b, 0x0c, 0x1a, 0x1d, 0x7d, 0x85, 0x7f, 0x86, 0x86, 0x8c, 0x86, 0x84, 0x83, 0x86, 0x86, 0x88, 0x86, 0x89, 0x7f, 0x7f, 0x85, 0x85, 0x13, 0x79, 0x74, 0x2a, 0x5b, 0x37, 0x37, 0x3c, 0x56, 0x5e, 0x51, 0x40, 0x4e, 0x46, 0x46, 0x4b, 0x48, 0x51, 0x58, 0x4f, 0x4b, 0x46, 0x46, 0x3d, 0x33, 0x53, 0x64, 0xe7, 0xab, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xac, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf6, 0xef, 0x96, 0x67, 0x68, 0x6b, 0x7e, 0x84, 0x8a, 0x88, 0x7f, 0x81, 0x2c, 0x29, 0x06, 0x6c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x72, 0x93, 0x17, 0x81, 0x7f, 0x86, 0x83, 0x83, 0x83, 0x84, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x84, 0x83, 0x12, 0x11, 0x0a, 0x72, 0x1b, 0x60, 0x39, 0x5e, 0x57, 0x4c, 0x40, 0x4b, 0x4e, 0x41, 0x4a, 0x4f, 0x58, 0x55, 0x48, 0x3d, 0x46, 0x47, 0x46, 0x36, 0x45, 0x64, 0xe7, 0xf2, 0xf9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xac, 0xed, 0xf6, 0x04, 0x96, 0x68, 0x66, 0x75, 0x8b, 0x86, 0x88, 0x7f, 0x17, 0x2c, 0x06, 0x68, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x66, 0x96, 0x9c, 0x2a, 0x09, 0x7b, 0x82, 0x85, 0x83, 0x83, 0x84, 0x84, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x8a, 0x86, 0x0d, 0x0d, 0x82, 0x70, 0x7c, 0x5f, 0x4d, 0x37, 0x46, 0x4e, 0x4a, 0x37, 0x4c, 0x58, 0x55, 0x48, 0x3b, 0x3b, 0x4b, 0x4b, 0x3d, 0x37, 0x5b, 0x62, 0x97, 0x97, 0xf0, 0xfa, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf3, 0xf6, 0xe2, 0xad, 0x67, 0x66, 0x69, 0x80, 0x0d, 0x88, 0x8a, 0x82, 0x29, 0x06, 0x66, 0x96, 0xad, 0x96, 0x96, 0x98, 0x96, 0x98, 0x98, 0x9c, 0xef, 0xf5, 0x54, 0x1b, 0x78, 0x7b, 0x85, 0x85, 0x83, 0x84, 0x84, 0x86, 0x86, 0x86, 0x86, 0x7f, 0x86, 0x83, 0x83, 0x85, 0x81, 0x8c, 0x0d, 0x80, 0x72, 0x06, 0x53, 0x4a, 0x4b, 0x4a, 0x3c, 0x58, 0x58, 0x4f, 0x4a, 0x4a, 0x4b, 0x4b, 0x36, 0x3c, 0x53, 0x5e, 0x60, 0x5f, 0xff, 0xf3, 0xfa, 0xfa, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xf6, 0xee, 0x96, 0x68, 0x68, 0x6d, 0x8f, 0x7f, 0x86, 0x81, 0x29, 0x72, 0x66, 0x96, 0x99, 0x96, 0x96, 0x96, 0x99, 0x96, 0x96, 0x96, 0x9b, 0xbb, 0xdf, 0xc3, 0x23, 0x94, 0x08, 0x80, 0x7d, 0x84, 0x7f, 0x84, 0x86, 0x86, 0x7f, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x83, 0x7f, 0x7f, 0x85, 0x82, 0x76, 0x05, 0x4d, 0x3c, 0x49, 0x5d, 0x55, 0x4f, 0x4b, 0x4a, 0x41, 0x42, 0x3c, 0x58, 0x5e, 0x60, 0x4d, 0x30, 0x4d, 0x63, 0x61, 0xed, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf5, 0x97, 0xf7, 0x67, 0x68, 0x66, 0x74, 0x8f, 0x7f, 0x86, 0x90, 0x0c, 0x66, 0x67, 0x99, 0x99, 0x99, 0x96, 0x96, 0x96, 0xf7, 0xbb, 0xbb, 0xbb, 0x9c, 0x98, 0x96, 0x96, 0x1b, 0x94, 0x74, 0x82, 0x83, 0x7f, 0x84, 0x7f, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x83, 0x7f, 0x83, 0x83, 0x83, 0x89, 0x8c, 0x15, 0x74, 0x06, 0x5e, 0x57, 0x55, 0x4a, 0x4a, 0x4a, 0x48, 0x51, 0x58, 0x5e, 0x5d, 0x53, 0x3c, 0x40, 0x3d, 0x42, 0x60, 0x65, 0xea, 0xab, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf0, 0xf6, 0xe2, 0x96, 0x67, 0x68, 0x69, 0x7b, 0x85, 0x8c, 0x7f, 0x1d, 0x6f, 0x66, 0x99, 0x96, 0x99, 0x96, 0x96, 0x04, 0xdb, 0xe6, 0xfa, 0xf5, 0xf5, 0xdb, 0x96, 0x96, 0x96, 0xad, 0xef, 0x6a, 0x0b, 0x7d, 0x86, 0x7f, 0x83, 0x84, 0x84, 0x7f, 0x84, 0x84, 0x84, 0x7f, 0x86, 0x83, 0x83, 0x83, 0x86, 0x88, 0x11, 0x8d, 0x74, 0x06, 0x5e, 0x49, 0x42, 0x4f, 0x58, 0x5d, 0x58, 0x58, 0x4c, 0x42, 0x37, 0x44, 0x46, 0x46, 0x3d, 0x49, 0x63, 0x97, 0xab, 0xea, 0xf4, 0xf1, 0xfb, 0xf1, 0xf9, 0xed, 0xf9, 0xf0, 0xfb, 0xf3, 0xf2, 0xed, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf3, 0xf2, 0xf6, 0x23, 0x96, 0x67, 0x68, 0x6e, 0x80, 0x83, 0x8c, 0x13, 0x0c, 0x69, 0x96, 0x67, 0x99, 0x96, 0x9c, 0xce, 0xf6, 0xf6, 0xfb, 0xf1, 0xe7, 0xed, 0xf5, 0x04, 0x96, 0x96, 0x96, 0xee, 0xf7, 0x74, 0x82, 0x7f, 0x86, 0x7f, 0x85, 0x84, 0x86, 0x86, 0x83, 0x83, 0x86, 0x7f, 0x86, 0x84, 0x7f, 0x83, 0x7f, 0x87, 0x87, 0x8f, 0x01, 0x0c, 0x60, 0x5d, 0x5d, 0x51, 0x4c, 0x42, 0x40, 0x40, 0x43, 0x44, 0x44, 0x44, 0x3b, 0x3b, 0x3c, 0x53, 0x63, 0xf3, 0xed, 0xf0, 0xe6, 0xec, 0xf9, 0xf1, 0xf9, 0xf5, 0xf6, 0xf6, 0xf6, 0xac, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xe6, 0xf6, 0xf3, 0x04, 0x96, 0x67, 0x67, 0x74, 0x8d, 0x83, 0x86, 0x19, 0x76, 0x96, 0x67, 0x96, 0x96, 0x9c, 0xe2, 0xf5, 0xf5, 0xf3, 0xf5, 0xf3, 0xed, 0xf4, 0xed, 0xe6, 0xb0, 0x96, 0x96, 0xe2, 0xbb, 0x6f, 0x82, 0x81, 0x86, 0x83, 0x85, 0x83, 0x86, 0x88, 0x7f, 0x83, 0x7f, 0x83, 0x7f, 0x86, 0x84, 0x7f, 0x83, 0x86, 0x87, 0x8b, 0x8d, 0x6d, 0x22, 0x5e, 0x3c, 0x40, 0x40, 0x40, 0x44, 0x44, 0x44, 0x48, 0x44, 0x44, 0x46, 0x46, 0x43, 0x37, 0x51, 0x63, 0xf3, 0xac, 0xed, 0xe7, 0xab, 0xf5, 0xe9, 0xee, 0xb3, 0x04, 0xc3, 0xf6, 0xf0, 0xf5, 0xe7, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf3, 0xf0, 0xf6, 0xe2, 0xad, 0x99, 0x67, 0x68, 0x7b, 0x85, 0x83, 0x8c, 0x15, 0x03, 0x66, 0xad, 0x96, 0x7c, 0xe6, 0xf6, 0xf5, 0xf0, 0xed, 0xf3, 0xf4, 0xf2, 0xf4, 0xf3, 0xf5, 0x65, 0xdf, 0xe2, 0xf6, 0xf8, 0x6d, 0x8d, 0x7d, 0x86, 0x83, 0x83, 0x86, 0x86, 0x86, 0x84, 0x85, 0x86, 0x84, 0x7f, 0x83, 0x7f, 0x83, 0x7f, 0x84, 0x86, 0x86, 0x0d, 0x82, 0x6d, 0x2a, 0x4d, 0x3b, 0x4e, 0x44, 0x3b, 0x4e, 0x46, 0x4b, 0x44, 0x41, 0x4b, 0x3b, 0x4b, 0x37, 0x2b, 0x39, 0x5f, 0x64, 0x64, 0xf6, 0xf5, 0xfc, 0x9b, 0x96, 0x96, 0x96, 0x96, 0xb3, 0xf6, 0xf0, 0xf3, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xe7, 0xf4, 0xac, 0xf6, 0xee, 0x96, 0x99, 0x66, 0x6b, 0x80, 0x85, 0x83, 0x88, 0x17, 0x6d, 0x66, 0x96, 0x9c, 0xe6, 0xf6, 0xf2, 0xf4, 0xed, 0xf0, 0xf2, 0xf0, 0xf5, 0xf0, 0xfb, 0xf2, 0xf6, 0xf5, 0xf5, 0xf6, 0xdf, 0x6d, 0x80, 0x7d, 0x86, 0x84, 0x83, 0x83, 0x86, 0x86, 0x7f, 0x85, 0x7f, 0x83, 0x7f, 0x84, 0x86, 0x84, 0x7f, 0x83, 0x7f, 0x89, 0x11, 0x0d, 0x7b, 0x6e, 0x45, 0x40, 0x3a, 0x43, 0x44, 0x4b, 0x46, 0x4b, 0x3d, 0x40, 0x37, 0x36, 0x37, 0x3c, 0x57, 0x53, 0x56, 0x5e, 0x59, 0x5c, 0x94, 0xf7, 0x96, 0x96, 0x96, 0x67, 0xad, 0x96, 0xc3, 0xf6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf4, 0xf0, 0xac, 0xfb, 0xae, 0x96, 0x99, 0x67, 0x70, 0x90, 0x7d, 0x8a, 0x7f, 0x17, 0x6b, 0x96, 0x96, 0xb3, 0xf6, 0xf5, 0xf4, 0xf0, 0xf0, 0xf5, 0xf3, 0xfb, 0xff, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf3, 0xf6, 0xef, 0x00, 0x80, 0x7d, 0x86, 0x83, 0x83, 0x86, 0x88, 0x86, 0x81, 0x85, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x7f, 0x88, 0x91, 0x92, 0x74, 0x06, 0x5e, 0x48, 0x44, 0x40, 0x3c, 0x36, 0x37, 0x3c, 0x49, 0x51, 0x5d, 0x5d, 0x58, 0x4c, 0x3c, 0x2e, 0x2b, 0x2b, 0x25, 0x26, 0x73, 0x96, 0x99, 0x67, 0x96, 0x96, 0x96, 0xf7, 0xf3, 0xed, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf5, 0xfb, 0xdb, 0x96, 0x99, 0x67, 0x69, 0x77, 0x90, 0x83, 0x83, 0x12, 0x17, 0x6d, 0x66, 0x96, 0xbb, 0xf6, 0xfb, 0xf2, 0xf4, 0xf4, 0xf3, 0xf4, 0xfb, 0xff, 0xf4, 0xf3, 0xf4, 0xf1, 0xf5, 0xf4, 0xf6, 0xf8, 0x69, 0x80, 0x81, 0x7f, 0x83, 0x83, 0x83, 0x86, 0x7f, 0x84, 0x81, 0x83, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x88, 0x8c, 0x89, 0x84, 0x8d, 0x01, 0x22, 0x53, 0x2f, 0x30, 0x49, 0x57, 0x5d, 0x5e, 0x5e, 0x57, 0x4c, 0x42, 0x2e, 0x36, 0x35, 0x35, 0x35, 0x35, 0x2f, 0x25, 0x74, 0x67, 0x96, 0x99, 0x96, 0x99, 0x67, 0x99, 0xe2, 0xf6, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xe7, 0xfb, 0x97, 0x02, 0x96, 0x68, 0x66, 0x6d, 0x8f, 0x85, 0x83, 0x86, 0x8c, 0x1d, 0x6d, 0x66, 0x96, 0xee, 0xf6, 0xed, 0xf4, 0xf4, 0xf4, 0xf2, 0xf3, 0xff, 0xfb, 0xf4, 0xf4, 0xea, 0xf0, 0xf4, 0xf3, 0xf6, 0xbb, 0x6b, 0x82, 0x81, 0x7f, 0x83, 0x85, 0x86, 0x86, 0x88, 0x84, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x86, 0x88, 0x85, 0x7f, 0x15, 0x0b, 0x00, 0x2a, 0x5b, 0x5e, 0x5e, 0x5d, 0x57, 0x49, 0x42, 0x33, 0x36, 0x35, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x35, 0x36, 0x25, 0x6d, 0x96, 0x98, 0x98, 0x98, 0x99, 0x96, 0x96, 0xe4, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf3, 0xf6, 0xc3, 0x96, 0x66, 0x67, 0x68, 0x76, 0x8b, 0x84, 0x87, 0x8a, 0x8c, 0x15, 0x72, 0x66, 0x96, 0xbb, 0xf6, 0xfb, 0xed, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xea, 0xf4, 0xed, 0xf0, 0xff, 0xf6, 0x73, 0x72, 0x90, 0x7f, 0x88, 0x84, 0x85, 0x84, 0x86, 0x8c, 0x7f, 0x83, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x7f, 0x87, 0x89, 0x7f, 0x15, 0x74, 0x73, 0x5f, 0x4d, 0x3c, 0x37, 0x37, 0x3d, 0x36, 0x3b, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x35, 0x35, 0x3a, 0x35, 0x25, 0x6a, 0x68, 0x98, 0x98, 0x98, 0x99, 0x99, 0x95, 0xe6, 0xf5, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xfb, 0xac, 0xad, 0x96, 0x66, 0x68, 0x6d, 0x80, 0x8b, 0x88, 0x87, 0x88, 0x12, 0x8b, 0x76, 0x66, 0x96, 0xb3, 0xf6, 0xf3, 0xf4, 0xf2, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xea, 0xeb, 0xf0, 0xf0, 0xf6, 0xff, 0x6c, 0x0b, 0x84, 0x7f, 0x86, 0x84, 0x85, 0x81, 0x86, 0x88, 0x8a, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x83, 0x83, 0x86, 0x8c, 0x86, 0x90, 0x8d, 0x6f, 0x21, 0x53, 0x2f, 0x41, 0x3b, 0x3a, 0x47, 0x3a, 0x46, 0x3f, 0x35, 0x3a, 0x35, 0x35, 0x3f, 0x35, 0x3a, 0x2f, 0x0e, 0x96, 0x96, 0x96, 0x99, 0x96, 0x96, 0xbb, 0xf6, 0xe7, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xf4, 0xf0, 0xf4, 0xf0, 0xf5, 0xf3, 0x02, 0x96, 0x96, 0x66, 0x6b, 0x7b, 0x8f, 0x81, 0x86, 0x86, 0x88, 0x8c, 0x13, 0x7b, 0x6a, 0x96, 0xae, 0xf6, 0xf5, 0xfb, 0xfa, 0xff, 0xf4, 0x97, 0xac, 0xf3, 0xf3, 0xf3, 0xf3, 0xea, 0xfb, 0x65, 0x23, 0x72, 0x80, 0x83, 0x86, 0x86, 0x84, 0x85, 0x81, 0x86, 0x88, 0x86, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x86, 0x84, 0x84, 0x88, 0x8c, 0x86, 0x83, 0x19, 0x08, 0x6a, 0x5b, 0x39, 0x36, 0x36, 0x3b, 0x35, 0x3b, 0x35, 0x36, 0x36, 0x36, 0x36, 0x3d, 0x3d, 0x3f, 0x43, 0x40, 0x49, 0x0f, 0x6c, 0x9c, 0x00, 0xae, 0xee, 0xf6, 0xf0, 0xed, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf4, 0xf9, 0xf2, 0xf1, 0xf0, 0xea, 0xea, 0xab, 0xeb, 0xe8, 0xe6, 0xf4, 0xf3, 0x65, 0xf5, 0xbb, 0x96, 0x66, 0x66, 0x68, 0x78, 0x90, 0x81, 0x84, 0x86, 0x84, 0x87, 0x81, 0x85, 0x82, 0x6e, 0x67, 0x96, 0xdf, 0xf5, 0x61, 0x64, 0x64, 0xf3, 0x97, 0xe8, 0xac, 0x65, 0xff, 0x65, 0xfb, 0x97, 0xff, 0x03, 0x7b, 0x82, 0x86, 0x86, 0x86, 0x84, 0x84, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x87, 0x7f, 0x83, 0x7f, 0x84, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x8e, 0x15, 0x6d, 0x0f, 0x5f, 0x51, 0x51, 0x4f, 0x55, 0x51, 0x57, 0x57, 0x58, 0x58, 0x55, 0x55, 0x55, 0x4f, 0x52, 0x42, 0x49, 0x54, 0xfc, 0xef, 0xef, 0xe6, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf5, 0xf0, 0xf2, 0xf5, 0x7c, 0x96, 0x96, 0x69, 0x66, 0x08, 0x8f, 0x85, 0x84, 0x87, 0x87, 0x83, 0x84, 0x84, 0x87, 0x90, 0x7b, 0x00, 0x66, 0x02, 0xab, 0xed, 0xf0, 0xff, 0xf5, 0xea, 0x97, 0xe7, 0xfb, 0xf0, 0xea, 0xab, 0xf6, 0x0f, 0x72, 0x90, 0x81, 0x86, 0x84, 0x84, 0x86, 0x86, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0x84, 0x86, 0x86, 0x84, 0x86, 0x84, 0x86, 0x86, 0x89, 0x86, 0x84, 0x8a, 0x86, 0x86, 0x8b, 0x07, 0x00, 0x54, 0x5d, 0x58, 0x55, 0x4f, 0x55, 0x4f, 0x4c, 0x4c, 0x40, 0x48, 0x3d, 0x36, 0x40, 0x33, 0x51, 0x62, 0x64, 0xf5, 0xf5, 0x65, 0xf4, 0xe7, 0xf0, 0xed, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xf3, 0xf2, 0xff, 0xf3, 0xf9, 0xff, 0xe6, 0xf6, 0xe7, 0xb3, 0x96, 0x99, 0x66, 0x69, 0x76, 0x8f, 0x85, 0x81, 0x89, 0x87, 0x86, 0x87, 0x87, 0x84, 0x81, 0x85, 0x17, 0x71, 0x68, 0x99, 0xbb, 0xf6, 0xed, 0xea, 0xf9, 0xed, 0xfb, 0xe7, 0xf5, 0xf4, 0xeb, 0xf6, 0xf8, 0x6d, 0x8d, 0x84, 0x86, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x86, 0x87, 0x84, 0x86, 0x8a, 0x8e, 0x8b, 0x80, 0x00, 0x7a, 0x49, 0x33, 0x37, 0x36, 0x36, 0x36, 0x37, 0x37, 0x40, 0x36, 0x4a, 0x48, 0x4f, 0x3c, 0x60, 0x63, 0xf9, 0xe7, 0xac, 0xac, 0xed, 0xf2, 0xf2, 0xe7, 0xed, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xac, 0xf2, 0xac, 0xf0, 0xf2, 0xf2, 0xf9, 0xff, 0xfb, 0xf6, 0xef, 0x95, 0x96, 0x99, 0x96, 0x69, 0x7b, 0x90, 0x87, 0x84, 0x84, 0x7f, 0x83, 0x89, 0x8a, 0x87, 0x87, 0x84, 0x84, 0x86, 0x15, 0x71, 0x66, 0x66, 0xbd, 0xf6, 0xf6, 0xed, 0xfb, 0xe7, 0xed, 0xf0, 0xf5, 0xf6, 0xc3, 0x6a, 0x0b, 0x82, 0x8a, 0x86, 0x86, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x87, 0x86, 0x87, 0x86, 0x86, 0x86, 0x83, 0x86, 0x8a, 0x86, 0x13, 0x17, 0x6e, 0x6d, 0x53, 0x49, 0x52, 0x52, 0x4e, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x44, 0x37, 0x56, 0x64, 0xe7, 0xf1, 0xed, 0xea, 0xab, 0xf3, 0xf1, 0xf3, 0xf4, 0xe6, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xea, 0xea, 0xab, 0xed, 0xf5, 0xe7, 0xb5, 0x99, 0x96, 0x66, 0x68, 0x6d, 0x7b, 0x8f, 0x81, 0x88, 0x89, 0x84, 0x84, 0x8a, 0x86, 0x83, 0x86, 0x86, 0x84, 0x84, 0x89, 0x89, 0x8d, 0x01, 0x69, 0x68, 0x73, 0xfc, 0xff, 0xf6, 0xf6, 0xf6, 0x65, 0xe4, 0x06, 0x6a, 0x0b, 0x8d, 0x84, 0x8a, 0x86, 0x84, 0x86, 0x84, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x86, 0x84, 0x86, 0x84, 0x86, 0x87, 0x86, 0x84, 0x86, 0x86, 0x88, 0x87, 0x84, 0x8a, 0x86, 0x8a, 0x81, 0x8f, 0x07, 0x69, 0x26, 0x49, 0x36, 0x43, 0x47, 0x46, 0x43, 0x3b, 0x44, 0x35, 0x3b, 0x3d, 0x3c, 0x62, 0xf0, 0xab, 0xeb, 0xf4, 0xe7, 0xab, 0xe7, 0xfb, 0xe7, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xe7, 0xf0, 0xf2, 0xf3, 0xf2, 0xf0, 0xf2, 0xed, 0xf0, 0xf2, 0xf2, 0xed, 0xf4, 0xac, 0xf0, 0xfa, 0xf4, 0xf4, 0xec, 0xe8, 0xed, 0xf6, 0xea, 0xee, 0xae, 0x96, 0x96, 0x68, 0x69, 0x75, 0x8d, 0x85, 0x8b, 0x87, 0x86, 0x86, 0x84, 0x86, 0x86, 0x86, 0x86, 0x86, 0x83, 0x86, 0x83, 0x83, 0x83, 0x85, 0x8d, 0x08, 0x6e, 0x68, 0x66, 0x6f, 0x7c, 0xee, 0xbb, 0x73, 0x00, 0x70, 0x80, 0x82, 0x85, 0x84, 0x86, 0x88, 0x84, 0x84, 0x84, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x84, 0x86, 0x84, 0x86, 0x88, 0x87, 0x87, 0x87, 0x8a, 0x86, 0x89, 0x8b, 0x80, 0x69, 0x09, 0x49, 0x42, 0x3b, 0x3f, 0x47, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x36, 0x53, 0x63, 0xeb, 0xe8, 0xf1, 0xfa, 0xf3, 0xab, 0xac, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xac, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xed, 0xf2, 0xf2, 0xf1, 0xf3, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xe7, 0xf3, 0xf5, 0xfb, 0xf4, 0xf5, 0xec, 0xf3, 0xdd, 0xbb, 0x9c, 0x96, 0x96, 0x67, 0x68, 0x6e, 0x7b, 0x90, 0x85, 0x85, 0x83, 0x81, 0x89, 0x84, 0x83, 0x84, 0x83, 0x86, 0x83, 0x86, 0x84, 0x86, 0x84, 0x83, 0x85, 0x7d, 0x8b, 0x15, 0x8d, 0x7e, 0x74, 0x70, 0x6b, 0x6b, 0x6d, 0x01, 0x0b, 0x15, 0x81, 0x83, 0x84, 0x87, 0x81, 0x84, 0x84, 0x86, 0x84, 0x86, 0x87, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x87, 0x86, 0x84, 0x86, 0x87, 0x86, 0x87, 0x87, 0x86, 0x88, 0x86, 0x87, 0x86, 0x8a, 0x88, 0x88, 0x8b, 0x82, 0x70, 0x6d, 0x39, 0x42, 0x44, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3d, 0x42, 0x60, 0x64, 0xeb, 0xab, 0xf9, 0xfa, 0xf0, 0xac, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf6, 0xe4, 0xfc, 0xc3, 0xee, 0xf8, 0xdf, 0xe4, 0xf6, 0xf6, 0xf6, 0xf6, 0xfb, 0xe2, 0xdb, 0x7c, 0xb0, 0x96, 0x96, 0x96, 0x66, 0x66, 0x6b, 0x07, 0x8d, 0x90, 0x85, 0x83, 0x83, 0x84, 0x84, 0x87, 0x84, 0x86, 0x84, 0x84, 0x84, 0x86, 0x84, 0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x8e, 0x7f, 0x81, 0x8b, 0x8f, 0x8d, 0x17, 0x8d, 0x1a, 0x8d, 0x8b, 0x81, 0x87, 0x83, 0x83, 0x84, 0x81, 0x84, 0x86, 0x84, 0x84, 0x84, 0x87, 0x87, 0x84, 0x86, 0x84, 0x87, 0x84, 0x86, 0x84, 0x86, 0x84, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x81, 0x8f, 0x75, 0x68, 0x27, 0x49, 0x40, 0x44, 0x43, 0x44, 0x43, 0x44, 0x43, 0x40, 0x53, 0x62, 0xf0, 0xe8, 0xf1, 0xf4, 0xff, 0xf2, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xed, 0xed, 0xee, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xad, 0x95, 0x95, 0x95, 0x99, 0x96, 0x96, 0x96, 0x96, 0x67, 0x66, 0x6a, 0x6d, 0x76, 0x1d, 0x90, 0x81, 0x87, 0x81, 0x89, 0x85, 0x85, 0x84, 0x87, 0x86, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0x84, 0x84, 0x7f, 0x7f, 0x88, 0x86, 0x83, 0x83, 0x83, 0x7f, 0x8e, 0x86, 0x83, 0x89, 0x0d, 0x7f, 0x86, 0x8a, 0x83, 0x87, 0x85, 0x84, 0x84, 0x86, 0x84, 0x86, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x86, 0x84, 0x86, 0x86, 0x87, 0x89, 0x87, 0x89, 0x87, 0x89, 0x88, 0x8c, 0x87, 0x89, 0x88, 0x88, 0x88, 0x89, 0x90, 0x08, 0x67, 0x0c, 0x57, 0x42, 0x36, 0x3d, 0x3d, 0x3d, 0x3b, 0x3b, 0x2f, 0x60, 0x65, 0xab, 0xf1, 0xff, 0xff, 0xf3, 0xe7, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xea, 0xf1, 0xf6, 0xbb, 0x96, 0x96, 0x67, 0x96, 0x67, 0x67, 0x67, 0x67, 0x66, 0x96, 0x67, 0x96, 0x66, 0x99, 0x66, 0x67, 0x66, 0x6a, 0x6e, 0x07, 0x8d, 0x8d, 0x84, 0x84, 0x87, 0x84, 0x84, 0x85, 0x85, 0x84, 0x84, 0x86, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0x89, 0x88, 0x86, 0x86, 0x83, 0x83, 0x83, 0x88, 0x12, 0x8a, 0x8a, 0x86, 0x86, 0x87, 0x84, 0x86, 0x83, 0x87, 0x84, 0x84, 0x86, 0x84, 0x84, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x86, 0x84, 0x87, 0x86, 0x87, 0x86, 0x87, 0x89, 0x86, 0x89, 0x88, 0x88, 0x86, 0x89, 0x86, 0x88, 0x14, 0x88, 0x8e, 0x90, 0x7e, 0x67, 0x06, 0x5e, 0x58, 0x55, 0x52, 0x4f, 0x52, 0x4a, 0x4a, 0x4c, 0x62, 0xf0, 0xab, 0xf1, 0xf9, 0xff, 0xe7, 0xac, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xea, 0xf1, 0xff, 0xff, 0xeb, 0xe9, 0xf6, 0xdb, 0x96, 0x96, 0x9c, 0x04, 0x0f, 0x73, 0x6c, 0x66, 0x68, 0x68, 0x69, 0x68, 0x69, 0x00, 0x69, 0x69, 0x6e, 0x76, 0x0a, 0x92, 0x91, 0x83, 0x89, 0x87, 0x87, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0x86, 0x84, 0x84, 0x84, 0x86, 0x86, 0x88, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x83, 0x87, 0x84, 0x84, 0x84, 0x86, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x84, 0x87, 0x87, 0x84, 0x85, 0x87, 0x83, 0x87, 0x8a, 0x86, 0x88, 0x88, 0x88, 0x88, 0x86, 0x89, 0x86, 0x89, 0x89, 0x86, 0x89, 0x88, 0x8e, 0x81, 0x6a, 0xf7, 0x53, 0x33, 0x48, 0x4c, 0x55, 0x51, 0x55, 0x55, 0x57, 0x62, 0x65, 0xe7, 0xf9, 0xf4, 0xf2, 0xf3, 0xf0, 0xff, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xea, 0xff, 0xf9, 0xf1, 0xeb, 0xe7, 0x04, 0x66, 0x6c, 0x31, 0x61, 0x54, 0x5c, 0x45, 0x0c, 0x72, 0x70, 0x70, 0x72, 0x74, 0x75, 0x7b, 0x80, 0x80, 0x8f, 0x8f, 0x86, 0x81, 0x87, 0x85, 0x87, 0x87, 0x84, 0x84, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0x84, 0x84, 0x85, 0x84, 0x84, 0x86, 0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 0x84, 0x84, 0x86, 0x84, 0x87, 0x84, 0x84, 0x87, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x87, 0x86, 0x87, 0x86, 0x89, 0x84, 0x86, 0x87, 0x84, 0x87, 0x86, 0x87, 0x86, 0x84, 0x85, 0x87, 0x87, 0x87, 0x84, 0x8b, 0x90, 0x92, 0x7f, 0x88, 0x86, 0x86, 0x88, 0x89, 0x88, 0x86, 0x89, 0x89, 0x88, 0x90, 0x6d, 0x00, 0x39, 0x40, 0x36, 0x37, 0x36, 0x37, 0x40, 0x37, 0x3c, 0x21, 0xfd, 0xf5, 0xec, 0xf1, 0xed, 0xac, 0xf3, 0xf3, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xea, 0xf1, 0xff, 0xff, 0xf1, 0xf6, 0xef, 0x68, 0x72, 0x2a, 0x63, 0x80, 0x78, 0x7e, 0x2c, 0x38, 0x38, 0x1d, 0x8d, 0x8f, 0x90, 0x92, 0x8b, 0x85, 0x85, 0x85, 0x86, 0x0d, 0x89, 0x8b, 0x82, 0x87, 0x87, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x86, 0x86, 0x86, 0x84, 0x87, 0x84, 0x84, 0x84, 0x87, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x87, 0x84, 0x86, 0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x89, 0x86, 0x8a, 0x87, 0x82, 0x7e, 0x50, 0x82, 0x87, 0x86, 0x88, 0x86, 0x86, 0x89, 0x89, 0x88, 0x86, 0x89, 0x8c, 0x8f, 0x6d, 0x67, 0x34, 0x48, 0x3f, 0x3b, 0x3b, 0x36, 0x36, 0x3d, 0x48, 0x01, 0x66, 0xbb, 0xe8, 0xf6, 0xe6, 0xac, 0xab, 0xab, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xff, 0xff, 0xf9, 0xf6, 0x23, 0x6d, 0x80, 0x93, 0x45, 0x8f, 0x82, 0x90, 0x7d, 0x83, 0x7d, 0x83, 0x85, 0x86, 0x84, 0x7f, 0x84, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x86, 0x87, 0x8e, 0x87, 0x87, 0x87, 0x84, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0x84, 0x84, 0x84, 0x85, 0x83, 0x85, 0x85, 0x85, 0x83, 0x86, 0x84, 0x84, 0x86, 0x84, 0x87, 0x84, 0x87, 0x84, 0x87, 0x86, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x87, 0x84, 0x84, 0x84, 0x84, 0x87, 0x86, 0x86, 0x86, 0x88, 0x86, 0x88, 0x88, 0x8a, 0x8a, 0x81, 0x80, 0x21, 0x59, 0x78, 0x90, 0x83, 0x86, 0x86, 0x8a, 0x89, 0x88, 0x87, 0x88, 0x89, 0x88, 0x90, 0x03, 0x66, 0x26, 0x4a, 0x3f, 0x43, 0x3a, 0x3f, 0x3b, 0x3f, 0x40, 0x05, 0x68, 0x96, 0xaf, 0xfc, 0xf6, 0xe7, 0xab, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xea, 0xe7, 0xff, 0xff, 0xf3, 0xf6, 0x0f, 0x71, 0x7e, 0x1d, 0x60, 0x2d, 0x7d, 0x86, 0x88, 0x86, 0x83, 0x83, 0x8a, 0x8a, 0x88, 0x89, 0x84, 0x87, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x7f, 0x89, 0x87, 0x84, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x86, 0x7f, 0x83, 0x85, 0x83, 0x83, 0x86, 0x86, 0x86, 0x84, 0x86, 0x84, 0x87, 0x87, 0x86, 0x84, 0x87, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x87, 0x86, 0x84, 0x84, 0x84, 0x84, 0x87, 0x86, 0x86, 0x86, 0x88, 0x86, 0x88, 0x88, 0x88, 0x8a, 0x7d, 0x80, 0x5c, 0x2a, 0x75, 0x89, 0x8a, 0x86, 0x86, 0x86, 0x89, 0x89, 0x86, 0x87, 0x88, 0x8e, 0x90, 0x72, 0x67, 0x26, 0x48, 0x44, 0x3a, 0x46, 0x3f, 0x3f, 0x3a, 0x43, 0x08, 0x66, 0x98, 0x96, 0x9c, 0xfc, 0xf6, 0xe8, 0xab, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xf3, 0xff, 0xf9, 0xf6, 0x1b, 0x76, 0x7d, 0x90, 0x49, 0x90, 0x84, 0x86, 0x89, 0x86, 0x86, 0x83, 0x86, 0x8a, 0x8a, 0x87, 0x89, 0x89, 0x88, 0x89, 0x89, 0x87, 0x8e, 0x81, 0x1f, 0x92, 0x83, 0x84, 0x84, 0x7f, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x86, 0x8a, 0x86, 0x87, 0x84, 0x87, 0x86, 0x8c, 0x8a, 0x84, 0x84, 0x84, 0x86, 0x87, 0x84, 0x87, 0x84, 0x86, 0x86, 0x87, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x87, 0x84, 0x84, 0x87, 0x87, 0x86, 0x86, 0x86, 0x89, 0x86, 0x86, 0x88, 0x88, 0x88, 0x87, 0x7e, 0x45, 0x64, 0x76, 0x7b, 0x83, 0x8a, 0x86, 0x86, 0x8a, 0x89, 0x88, 0x89, 0x88, 0x89, 0x88, 0x92, 0x75, 0x67, 0x26, 0x3c, 0x36, 0x36, 0x43, 0x35, 0x3f, 0x35, 0x3d, 0x08, 0x68, 0x66, 0x99, 0x96, 0x96, 0xfc, 0xf6, 0xf1, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xea, 0xab, 0xff, 0xff, 0xf2, 0xf6, 0x2a, 0x75, 0x85, 0x84, 0x85, 0x7d, 0x85, 0x7f, 0x88, 0x83, 0x87, 0x83, 0x89, 0x86, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x85, 0x8b, 0x82, 0x82, 0x38, 0x4d, 0x84, 0x7f, 0x84, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x85, 0x83, 0x86, 0x86, 0x8e, 0x81, 0x7d, 0x81, 0x7f, 0x8c, 0x86, 0x84, 0x84, 0x84, 0x84, 0x87, 0x87, 0x86, 0x84, 0x87, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x87, 0x86, 0x87, 0x87, 0x86, 0x84, 0x89, 0x86, 0x86, 0x86, 0x89, 0x8e, 0x89, 0x81, 0x82, 0x29, 0x63, 0x94, 0x71, 0x0a, 0x8a, 0x8a, 0x86, 0x86, 0x86, 0x89, 0x86, 0x89, 0x87, 0x8c, 0x89, 0x13, 0x07, 0x68, 0x26, 0x4c, 0x37, 0x36, 0x3d, 0x2e, 0x2e, 0x36, 0x33, 0x05, 0x96, 0x99, 0x67, 0x67, 0x96, 0xb3, 0xf6, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xf0, 0xf3, 0xf1, 0xf6, 0x94, 0x76, 0x85, 0x81, 0x84, 0x85, 0x87, 0x87, 0x8a, 0x7f, 0x83, 0x85, 0x83, 0x89, 0x87, 0x8a, 0x8a, 0x8a, 0x8e, 0x82, 0x7e, 0x93, 0x60, 0x4d, 0x7e, 0x7f, 0x83, 0x84, 0x7f, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x83, 0x84, 0x7f, 0x82, 0x7e, 0x80, 0x29, 0x24, 0x0a, 0x0d, 0x83, 0x87, 0x87, 0x7f, 0x84, 0x86, 0x84, 0x86, 0x86, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x86, 0x84, 0x89, 0x89, 0x81, 0x7d, 0x0b, 0x32, 0x63, 0x63, 0x0c, 0x77, 0x85, 0x8e, 0x8a, 0x86, 0x86, 0x8a, 0x89, 0x88, 0x86, 0x88, 0x89, 0x8c, 0x92, 0x75, 0x68, 0x26, 0x55, 0x4f, 0x55, 0x52, 0x51, 0x49, 0x34, 0x39, 0x31, 0x06, 0x99, 0x96, 0x96, 0x96, 0xbb, 0xf6, 0xf9, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xea, 0xe7, 0xf3, 0xff, 0xe9, 0xf6, 0x5a, 0x7b, 0x79, 0x83, 0x85, 0x83, 0x83, 0x86, 0x8a, 0x83, 0x83, 0x83, 0x85, 0x87, 0x8a, 0x83, 0x8a, 0x81, 0x7d, 0x8d, 0x45, 0x62, 0x38, 0x0a, 0x7d, 0x7f, 0x7f, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0x84, 0x83, 0x85, 0x81, 0x7f, 0x7d, 0x7e, 0x1a, 0x94, 0x63, 0x63, 0x21, 0x0a, 0x84, 0x84, 0x84, 0x83, 0x84, 0x87, 0x87, 0x86, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x87, 0x84, 0x86, 0x87, 0x84, 0x88, 0x86, 0x8a, 0x86, 0x86, 0x86, 0x87, 0x89, 0x84, 0x84, 0x81, 0x8d, 0x3e, 0x61, 0x65, 0x94, 0x74, 0x0a, 0x90, 0x86, 0x86, 0x86, 0x86, 0x86, 0x89, 0x86, 0x89, 0x89, 0x89, 0x88, 0x90, 0x76, 0x68, 0x26, 0x42, 0x44, 0x40, 0x2f, 0x5e, 0x62, 0x64, 0x63, 0x65, 0xed, 0xdf, 0x04, 0x9c, 0xb1, 0xe5, 0xf4, 0xfa, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xab, 0xf2, 0xf2, 0xeb, 0xe7, 0x65, 0x29, 0x78, 0x85, 0x84, 0x83, 0x83, 0x8a, 0x83, 0x8a, 0x8a, 0x83, 0x83, 0x89, 0x85, 0x85, 0x82, 0x7e, 0x93, 0x60, 0x5f, 0x24, 0x78, 0x7f, 0x8c, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x84, 0x81, 0x7f, 0x7d, 0x79, 0x82, 0x17, 0x2c, 0x59, 0x64, 0xf6, 0xf3, 0xff, 0x61, 0x1d, 0x7d, 0x83, 0x81, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x84, 0x87, 0x84, 0x86, 0x86, 0x86, 0x87, 0x86, 0x86, 0x86, 0x88, 0x88, 0x88, 0x86, 0x86, 0x0d, 0x81, 0x79, 0x8b, 0x93, 0x5c, 0x65, 0xf6, 0xe7, 0x73, 0x71, 0x81, 0x92, 0x7f, 0x89, 0x86, 0x89, 0x88, 0x89, 0x88, 0x89, 0x88, 0x89, 0x8c, 0x92, 0x72, 0x69, 0x30, 0x42, 0x3b, 0x41, 0x33, 0x60, 0xff, 0xf3, 0xf0, 0xac, 0xea, 0xf5, 0xf5, 0xe2, 0xab, 0x97, 0xf0, 0xfa, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xea, 0xea, 0xea, 0xf1, 0xeb, 0xf1, 0xfb, 0x5f, 0x7e, 0x78, 0x7f, 0x83, 0x8a, 0x83, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x85, 0x85, 0x7e, 0x8d, 0x45, 0x64, 0x5c, 0x1a, 0x0a, 0x84, 0x86, 0x86, 0x83, 0x83, 0x83, 0x85, 0x7d, 0x7d, 0x7e, 0x7e, 0x17, 0x29, 0x3e, 0xfe, 0x64, 0x65, 0xfb, 0xf3, 0xf0, 0xf2, 0xf3, 0xfb, 0x63, 0x93, 0x7b, 0x7d, 0x84, 0x88, 0x86, 0x88, 0x89, 0x81, 0x85, 0x85, 0x84, 0x88, 0x86, 0x88, 0x88, 0x8c, 0x86, 0x8e, 0x8c, 0x88, 0x88, 0x7f, 0x0d, 0x0d, 0x0d, 0x1c, 0x32, 0x61, 0x64, 0x65, 0xf6, 0xdb, 0x6c, 0x6d, 0x79, 0x1f, 0x91, 0x83, 0x89, 0x87, 0x88, 0x8c, 0x8c, 0x86, 0x89, 0x87, 0x89, 0x8e, 0x19, 0x03, 0x6a, 0x30, 0x44, 0x43, 0x3b, 0x37, 0x5f, 0xac, 0xeb, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf5, 0xea, 0xea, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe7, 0xf2, 0xeb, 0xf1, 0xeb, 0xf3, 0x65, 0x5c, 0x1a, 0x79, 0x79, 0x7d, 0x83, 0x83, 0x83, 0x86, 0x81, 0x0a, 0x0a, 0x8d, 0x29, 0x62, 0x64, 0x50, 0x80, 0x7e, 0x83, 0x7f, 0x86, 0x86, 0x7f, 0x7f, 0x79, 0x7d, 0x80, 0x93, 0x32, 0x5c, 0x61, 0x63, 0x65, 0x65, 0xff, 0xf0, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xff, 0x65, 0x94, 0x0b, 0x0a, 0x81, 0x7f, 0x86, 0x89, 0x89, 0x87, 0x86, 0x8a, 0x86, 0x8a, 0x88, 0x88, 0x89, 0x7f, 0x81, 0x7d, 0x7d, 0x7b, 0x8d, 0x93, 0x2c, 0x5c, 0x5f, 0xf6, 0xf0, 0x97, 0xf6, 0xf8, 0x9c, 0x96, 0x07, 0x19, 0x1f, 0x88, 0x86, 0x89, 0x8a, 0x88, 0x8c, 0x8c, 0x88, 0x86, 0x89, 0x89, 0x8c, 0x19, 0x6f, 0x6d, 0x49, 0x44, 0x43, 0x3b, 0x3c, 0x63, 0xf2, 0xeb, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xf0, 0xf1, 0xf1, 0xf1, 0xea, 0xe7, 0xfb, 0x64, 0x54, 0x32, 0x21, 0x8d, 0x80, 0x8d, 0x1a, 0x1a, 0x2c, 0x94, 0x5f, 0x65, 0x63, 0x32, 0x78, 0x85, 0x86, 0x84, 0x84, 0x85, 0x7d, 0x7e, 0x0e, 0x29, 0x45, 0x62, 0x64, 0x65, 0x97, 0x97, 0xab, 0xff, 0xff, 0xf3, 0xff, 0xe7, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xeb, 0xe8, 0x65, 0xff, 0x32, 0x1a, 0x8d, 0x7d, 0x7d, 0x81, 0x84, 0x7f, 0x86, 0x86, 0x84, 0x7f, 0x7d, 0x7d, 0x7e, 0x8d, 0x1a, 0x2a, 0x94, 0xe4, 0x97, 0xf6, 0xac, 0x65, 0xf3, 0xf6, 0x97, 0x7c, 0x96, 0x96, 0x74, 0x93, 0x28, 0x7f, 0x8c, 0x12, 0x88, 0x87, 0x88, 0x88, 0x8c, 0x88, 0x8a, 0x8a, 0x8c, 0x8c, 0x13, 0x00, 0x72, 0x4c, 0x3d, 0x3f, 0x37, 0x49, 0x64, 0xe7, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf9, 0xf1, 0xf1, 0xeb, 0xab, 0xe7, 0xf3, 0x65, 0x63, 0x63, 0x5f, 0x5f, 0x5f, 0x5f, 0x63, 0x64, 0x64, 0x65, 0x65, 0x2a, 0x0a, 0x84, 0x8a, 0x8a, 0x86, 0x7d, 0x0a, 0x8d, 0x32, 0x5c, 0x63, 0x64, 0xff, 0xff, 0xac, 0xab, 0xe8, 0xab, 0xe7, 0xf0, 0xf0, 0xf2, 0xf1, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xe8, 0xec, 0xe6, 0xff, 0x65, 0x63, 0x54, 0x32, 0x93, 0x1a, 0x8d, 0x0e, 0x82, 0x8d, 0x8d, 0x1a, 0x93, 0x29, 0x45, 0x5c, 0x63, 0x64, 0xf6, 0xac, 0xab, 0xab, 0xab, 0xab, 0xf6, 0xe6, 0x04, 0x96, 0x96, 0x6d, 0x21, 0x17, 0x8b, 0x81, 0x8e, 0x7f, 0x12, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x88, 0x18, 0x7e, 0x68, 0x09, 0x4c, 0x3b, 0x3b, 0x2e, 0x50, 0x64, 0xf0, 0xf9, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf9, 0xfa, 0xf0, 0xea, 0xab, 0xeb, 0xeb, 0xe6, 0xf4, 0xfb, 0xff, 0xff, 0xfb, 0xed, 0xfb, 0xf3, 0x61, 0x64, 0x2a, 0x78, 0x90, 0x83, 0x8a, 0x7f, 0x7e, 0x80, 0x32, 0x62, 0xf6, 0xf5, 0xac, 0xf2, 0xf3, 0xf1, 0xeb, 0xf1, 0xe9, 0xf1, 0xeb, 0xf4, 0xea, 0xf1, 0xea, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xff, 0xf0, 0xfb, 0xf3, 0xf0, 0xf3, 0x65, 0xf6, 0xfb, 0x64, 0x61, 0x5f, 0x5f, 0x5f, 0x61, 0x64, 0x65, 0xf6, 0xf6, 0xf5, 0xff, 0xff, 0xf0, 0xf2, 0xe7, 0xea, 0xea, 0xf6, 0xef, 0xf7, 0x96, 0x66, 0x6d, 0x1a, 0x28, 0x28, 0x8f, 0x90, 0x81, 0x0d, 0x7f, 0x81, 0x84, 0x0d, 0x89, 0x88, 0x91, 0x8c, 0x0d, 0x13, 0x05, 0x68, 0x93, 0x42, 0x3f, 0x3b, 0x33, 0x50, 0xf6, 0xf2, 0xf9, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xeb, 0xf1, 0xfa, 0xf9, 0xff, 0xea, 0xe7, 0xac, 0xea, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xe7, 0xed, 0xe7, 0xff, 0x65, 0x2a, 0x7b, 0x85, 0x86, 0x8a, 0x81, 0x7e, 0x1b, 0x5c, 0x65, 0x64, 0xab, 0xab, 0xab, 0xab, 0xea, 0xf2, 0xf1, 0xf9, 0xfa, 0xfa, 0xf1, 0xeb, 0xea, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xac, 0xf2, 0xea, 0xeb, 0xf1, 0xf2, 0xf4, 0xf3, 0xf5, 0xac, 0xf5, 0xf3, 0xfb, 0xed, 0xf1, 0xf1, 0xeb, 0xf1, 0xf4, 0xf9, 0xfa, 0xf9, 0xfa, 0xf6, 0xce, 0x9c, 0x96, 0x96, 0x6a, 0x0b, 0x1d, 0x1f, 0x2d, 0x28, 0x28, 0x28, 0x28, 0x1f, 0x92, 0x90, 0x81, 0x7f, 0x7f, 0x86, 0x7f, 0x81, 0x8d, 0x6e, 0x6d, 0x2c, 0x40, 0x3f, 0x3b, 0x30, 0x5c, 0xf6, 0xf0, 0xf9, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xea, 0xe9, 0xf1, 0xf9, 0xfa, 0xff, 0xf3, 0xf3, 0xf0, 0xff, 0xf3, 0xea, 0xac, 0xf2, 0xf0, 0xeb, 0xac, 0xe7, 0x65, 0x2a, 0x7b, 0x8a, 0x8a, 0x87, 0x7d, 0x80, 0x3e, 0x65, 0xf5, 0xf3, 0xf3, 0xac, 0xf2, 0xac, 0xf2, 0xf3, 0xf0, 0xf3, 0xf3, 0xf9, 0xf2, 0xf1, 0xeb, 0xea, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xff, 0xf3, 0xf3, 0xab, 0xea, 0xe8, 0xea, 0xf2, 0xf0, 0xf3, 0xea, 0xab, 0xea, 0xac, 0xea, 0xf2, 0xf1, 0xf4, 0xf4, 0xfa, 0xe7, 0xeb, 0xf0, 0xf9, 0x65, 0xf5, 0xbb, 0x96, 0x96, 0x66, 0x6a, 0x08, 0x24, 0x1f, 0x7f, 0x86, 0x85, 0x8f, 0x90, 0x24, 0x1f, 0x28, 0x2d, 0x28, 0x28, 0x1f, 0x1f, 0x19, 0x17, 0x08, 0x69, 0x09, 0x30, 0x2e, 0x35, 0x35, 0x33, 0x5f, 0xf3, 0xf0, 0xf5, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xab, 0xf1, 0xf4, 0xf9, 0xf3, 0xe7, 0xac, 0xf0, 0xff, 0xff, 0xac, 0xf0, 0xf3, 0xf4, 0xf4, 0xea, 0xff, 0x2a, 0x08, 0x90, 0x89, 0x8b, 0x0a, 0x93, 0x5a, 0x65, 0xfb, 0xe6, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf0, 0xf3, 0xe7, 0xac, 0xe7, 0xea, 0xf1, 0xf1, 0xf2, 0xf3, 0xf3, 0xf0, 0xf2, 0xf2, 0xea, 0xe8, 0xeb, 0xab, 0xeb, 0xab, 0xf2, 0xe7, 0xf3, 0xff, 0xff, 0xf3, 0xac, 0xf0, 0xac, 0xf0, 0xf3, 0xff, 0xff, 0xfa, 0xfa, 0xed, 0xe5, 0xf6, 0xf5, 0xe2, 0x04, 0x96, 0x66, 0x66, 0x68, 0x76, 0x1d, 0x1f, 0x8c, 0x16, 0x12, 0x8e, 0x0d, 0x8b, 0x84, 0x8e, 0x11, 0x0d, 0x90, 0x92, 0x1f, 0x1f, 0x28, 0x2c, 0x06, 0x68, 0x2c, 0x51, 0x48, 0x3f, 0x35, 0x33, 0x62, 0xfb, 0xed, 0xea, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xea, 0xf0, 0xf4, 0xf1, 0xf1, 0xeb, 0xab, 0xf2, 0xf4, 0xf9, 0xea, 0xf9, 0xfa, 0xf9, 0xf9, 0xf6, 0x31, 0x0b, 0x1f, 0x18, 0x7f, 0x7e, 0x32, 0x64, 0x65, 0xff, 0xf0, 0xfb, 0xf1, 0xe7, 0xf9, 0xf4, 0xf9, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xf1, 0xf3, 0xf3, 0xff, 0xf0, 0xff, 0xf1, 0xea, 0xf1, 0xeb, 0xe9, 0xea, 0xea, 0xf2, 0xac, 0xf3, 0xf0, 0xff, 0xf2, 0xf0, 0xf2, 0xf4, 0xf0, 0xac, 0xf3, 0xac, 0xf2, 0xf3, 0xf0, 0xac, 0xf6, 0xf6, 0xce, 0x95, 0x96, 0x99, 0x66, 0x68, 0x74, 0x93, 0x1f, 0x8e, 0x89, 0x8a, 0x8c, 0x12, 0x12, 0x12, 0x8e, 0x88, 0x12, 0x8e, 0x11, 0x86, 0x88, 0x7f, 0x0d, 0x80, 0x69, 0x6f, 0x57, 0x37, 0x40, 0x3b, 0x3a, 0x3c, 0x63, 0xfa, 0xe7, 0xab, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xac, 0xf3, 0xf1, 0xf1, 0xeb, 0xe9, 0xe9, 0xeb, 0xf1, 0xf4, 0xf1, 0xf4, 0xf9, 0xfa, 0xf9, 0xfa, 0xfe, 0x21, 0x17, 0x15, 0x2c, 0x5f, 0x65, 0xf0, 0xed, 0xf0, 0xff, 0xff, 0xf0, 0xf1, 0xeb, 0xea, 0xea, 0xea, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xff, 0xf3, 0xff, 0xf2, 0xf2, 0xf1, 0xeb, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xf0, 0xac, 0xea, 0xeb, 0xeb, 0xf1, 0xf9, 0xf1, 0xf1, 0xea, 0xab, 0xea, 0xea, 0xeb, 0xab, 0xf6, 0xe4, 0xb3, 0x96, 0x96, 0x9a, 0x66, 0x68, 0x76, 0x1c, 0x1f, 0x18, 0x89, 0x8e, 0x91, 0x12, 0x16, 0x16, 0x16, 0x14, 0x88, 0x8c, 0x12, 0x8e, 0x12, 0x8c, 0x12, 0x15, 0x07, 0x69, 0x1b, 0x4f, 0x40, 0x2e, 0x3b, 0x3f, 0x2f, 0x45, 0x61, 0xf6, 0x97, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xea, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf9, 0xf1, 0xf0, 0xf5, 0x61, 0xfe, 0x61, 0xff, 0x65, 0xf0, 0xf2, 0xf2, 0xf0, 0xf3, 0xf0, 0xf2, 0xf2, 0xea, 0xf1, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf0, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xea, 0xab, 0xab, 0xeb, 0xf1, 0xed, 0xac, 0xf6, 0xef, 0xf7, 0x96, 0xad, 0x9a, 0x67, 0x68, 0x70, 0x17, 0x1f, 0x18, 0x8c, 0x12, 0x8c, 0x8c, 0x12, 0x12, 0x12, 0x14, 0x88, 0x8c, 0x8c, 0x12, 0x16, 0x16, 0x14, 0x90, 0x82, 0x6e, 0x6f, 0x4d, 0x4a, 0x36, 0x3d, 0x3b, 0x3f, 0x36, 0x1c, 0x73, 0xf8, 0xf6, 0xf6, 0xf0, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf9, 0xf4, 0xf5, 0xfb, 0xf1, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xe7, 0xac, 0xac, 0xed, 0xf0, 0xf4, 0xe2, 0x04, 0x96, 0x96, 0xad, 0x9a, 0x66, 0x66, 0x72, 0x80, 0x1f, 0x92, 0x88, 0x12, 0x14, 0x12, 0x12, 0x12, 0x12, 0x8c, 0x8c, 0x8c, 0x14, 0x8c, 0x8c, 0x12, 0x14, 0x12, 0x90, 0x76, 0x69, 0x1c, 0x58, 0x3b, 0x3b, 0x3f, 0x3f, 0x3a, 0x40, 0x0b, 0x96, 0x96, 0xb0, 0xdb, 0xf6, 0xf3, 0xf2, 0xe7, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf9, 0xf2, 0xf2, 0xf0, 0xf4, 0xfa, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xeb, 0xac, 0xe7, 0xf3, 0xf9, 0xf5, 0xfa, 0xbb, 0x96, 0x96, 0xad, 0x9c, 0x66, 0x69, 0x6e, 0x80, 0x1d, 0x18, 0x16, 0x14, 0x14, 0x88, 0x14, 0x12, 0x8c, 0x12, 0x8c, 0x8c, 0x88, 0x12, 0x16, 0x8c, 0x89, 0x8c, 0x11, 0x17, 0x6e, 0x6f, 0x53, 0x40, 0x3b, 0x3f, 0x3f, 0x3f, 0x3a, 0x40, 0x09, 0x96, 0x96, 0x96, 0xad, 0xfc, 0xf5, 0xf2, 0xf3, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf0, 0xf4, 0xf9, 0xf0, 0xfb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xe9, 0xf0, 0xf3, 0xff, 0xf6, 0x5a, 0x04, 0xbb, 0xce, 0xb5, 0x96, 0x96, 0x67, 0x01, 0x8d, 0x1d, 0x92, 0x8c, 0x12, 0x14, 0x88, 0x14, 0x8c, 0x8c, 0x14, 0x8c, 0x8c, 0x88, 0x8c, 0x12, 0x16, 0x88, 0x8a, 0x89, 0x13, 0x74, 0x69, 0x22, 0x30, 0x2f, 0x35, 0x2e, 0x3f, 0x3f, 0x3f, 0x30, 0x70, 0x99, 0x67, 0x67, 0x96, 0xb3, 0xf5, 0xed, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xac, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xeb, 0xf1, 0xf2, 0xff, 0xf6, 0xe4, 0x04, 0x96, 0x96, 0x02, 0xf8, 0xdb, 0x7c, 0x03, 0x0b, 0x1d, 0x1f, 0x11, 0x91, 0x8a, 0x88, 0x88, 0x14, 0x8c, 0x14, 0x8c, 0x12, 0x8c, 0x8c, 0x88, 0x8c, 0x12, 0x88, 0x8a, 0x8e, 0x82, 0x00, 0x0f, 0x64, 0x50, 0x49, 0x28, 0x2b, 0x2e, 0x35, 0x37, 0x1c, 0x00, 0x96, 0x67, 0x68, 0x96, 0xbb, 0xf5, 0xf2, 0xf3, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf0, 0xac, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf0, 0xf6, 0xe4, 0xb0, 0x96, 0x98, 0x99, 0x96, 0x96, 0xf8, 0x64, 0x5f, 0x2c, 0x0e, 0x10, 0x0d, 0x12, 0x87, 0x8a, 0x91, 0x88, 0x14, 0x88, 0x8c, 0x14, 0x88, 0x8c, 0x8c, 0x8e, 0x86, 0x14, 0x14, 0x0d, 0x74, 0x6f, 0xe4, 0x65, 0x64, 0x63, 0x60, 0x50, 0x30, 0x25, 0x25, 0x03, 0x96, 0x98, 0xad, 0x67, 0x96, 0xef, 0xf3, 0xf2, 0xed, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf4, 0x65, 0xe2, 0x95, 0x96, 0x98, 0x98, 0x99, 0x66, 0x72, 0x1a, 0x22, 0x45, 0x62, 0x50, 0x17, 0x0a, 0x11, 0x88, 0x91, 0x8e, 0x8e, 0x8e, 0x12, 0x14, 0x8c, 0x8c, 0x12, 0x88, 0x13, 0x81, 0x16, 0x12, 0x7e, 0x6b, 0xfc, 0xf6, 0xf9, 0xab, 0xab, 0x65, 0x64, 0x63, 0x59, 0x07, 0x96, 0x98, 0x98, 0x96, 0x96, 0xbb, 0xf6, 0xf3, 0xed, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe7, 0xf6, 0xe2, 0x6c, 0x96, 0x9a, 0x98, 0xad, 0x66, 0x6e, 0x1a, 0x13, 0x0e, 0x8d, 0x1a, 0x94, 0x60, 0x38, 0x0a, 0x7d, 0x7f, 0x13, 0x8e, 0x89, 0x8c, 0x8c, 0x8c, 0x88, 0x8c, 0x8c, 0x87, 0x8b, 0x12, 0x18, 0x01, 0x73, 0xf5, 0xf9, 0xfa, 0xab, 0xab, 0xe6, 0xf5, 0xf0, 0x65, 0xfe, 0x02, 0x96, 0x96, 0x9c, 0x23, 0xf3, 0xf3, 0xed, 0xe6, 0xf3, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf9, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf6, 0xdf, 0x96, 0x67, 0x99, 0x99, 0x99, 0x66, 0x6e, 0x1d, 0x18, 0x18, 0x11, 0x8b, 0x8b, 0x7d, 0x17, 0x38, 0x5e, 0x2c, 0x7e, 0x7d, 0x81, 0x11, 0x8e, 0x8c, 0x8c, 0x8c, 0x8c, 0x88, 0x8c, 0x8c, 0x11, 0x7b, 0x00, 0xe2, 0xf5, 0xfb, 0xf9, 0xed, 0xea, 0xf1, 0xab, 0xab, 0xac, 0x65, 0xf0, 0xf8, 0xce, 0x97, 0xf6, 0xf5, 0xe7, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xdb, 0x95, 0x96, 0x67, 0xad, 0x9a, 0x96, 0x6a, 0x8d, 0x19, 0x12, 0x18, 0x88, 0x91, 0x12, 0x8e, 0x13, 0x82, 0x1a, 0x32, 0x50, 0x28, 0x0a, 0x7f, 0x0d, 0x88, 0x8c, 0x88, 0x88, 0x88, 0x12, 0x14, 0x0e, 0x70, 0x0f, 0xf6, 0xab, 0xf4, 0xfa, 0xfa, 0xfa, 0xf2, 0xab, 0xab, 0x97, 0xff, 0xfa, 0xf5, 0xf6, 0xac, 0xff, 0xf3, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xe7, 0xf4, 0xe7, 0xf6, 0xdb, 0x9a, 0x96, 0x9a, 0xad, 0x9a, 0x67, 0x69, 0x80, 0x19, 0x16, 0x16, 0x12, 0x12, 0x16, 0x12, 0x16, 0x11, 0x12, 0x0d, 0x8e, 0x15, 0x2d, 0x4d, 0x24, 0x7e, 0x0a, 0x81, 0x8e, 0x89, 0x8c, 0x88, 0x13, 0x78, 0x6c, 0xf6, 0xea, 0xeb, 0xf9, 0xf9, 0xfb, 0xf9, 0xf3, 0xf2, 0x97, 0xf2, 0xf0, 0xf3, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xfb, 0xf1, 0xf6, 0xdb, 0x95, 0x96, 0xad, 0x99, 0x98, 0x67, 0x69, 0x08, 0x1d, 0x11, 0x16, 0x12, 0x12, 0x91, 0x12, 0x12, 0x91, 0x12, 0x91, 0x12, 0x12, 0x11, 0x82, 0x8f, 0x2c, 0x38, 0x2c, 0x82, 0x79, 0x81, 0x81, 0x0d, 0x82, 0x6e, 0x06, 0xab, 0xf6, 0xed, 0xf0, 0x65, 0xf2, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xe6, 0xf6, 0xdf, 0x9c, 0x96, 0x68, 0x96, 0x9a, 0xad, 0x66, 0x07, 0x1d, 0x0d, 0x18, 0x0d, 0x18, 0x12, 0x12, 0x11, 0x12, 0x12, 0x18, 0x12, 0x12, 0x12, 0x8e, 0x11, 0x13, 0x7d, 0x8b, 0x24, 0x49, 0x38, 0x17, 0x79, 0x7e, 0x76, 0x03, 0x02, 0x66, 0xbd, 0xf6, 0xf5, 0xf0, 0xf2, 0xea, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf3, 0xf2, 0xf6, 0xef, 0x95, 0x96, 0x99, 0x68, 0xad, 0x67, 0x66, 0x72, 0x17, 0x18, 0x16, 0x16, 0x89, 0x13, 0x12, 0x91, 0x12, 0x12, 0x91, 0x12, 0x12, 0x91, 0x12, 0x8c, 0x8c, 0x8e, 0x13, 0x15, 0x8b, 0x7d, 0x1d, 0x4d, 0x45, 0x0c, 0x6a, 0x73, 0x96, 0x96, 0x96, 0x7c, 0xf0, 0xfb, 0xf1, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf6, 0xe4, 0xf7, 0x96, 0x67, 0xad, 0xad, 0x68, 0x66, 0x6d, 0x1a, 0x92, 0x12, 0x14, 0x8c, 0x13, 0x8e, 0x12, 0x12, 0x12, 0x91, 0x12, 0x91, 0x12, 0x12, 0x12, 0x8c, 0x14, 0x8c, 0x11, 0x88, 0x0d, 0x11, 0x82, 0x0e, 0x8d, 0x0c, 0x0f, 0x6c, 0x96, 0x99, 0x96, 0x96, 0xc3, 0xf6, 0xe6, 0xec, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf0, 0xac, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf0, 0xf5, 0xf2, 0xf7, 0x96, 0x96, 0x9a, 0xad, 0xad, 0x96, 0x6a, 0x7e, 0x92, 0x12, 0x14, 0x8c, 0x91, 0x12, 0x91, 0x8c, 0x12, 0x8c, 0x12, 0x8c, 0x12, 0x8c, 0x12, 0x8c, 0x12, 0x88, 0x14, 0x12, 0x14, 0x8c, 0x8c, 0x13, 0x82, 0x05, 0x06, 0xac, 0xf6, 0xee, 0x99, 0x96, 0x96, 0xce, 0xf6, 0xe7, 0xeb, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xed, 0xea, 0x7c, 0x96, 0x67, 0x9c, 0x96, 0x66, 0x96, 0x66, 0x07, 0x19, 0x12, 0x91, 0x89, 0x8e, 0x8e, 0x14, 0x12, 0x12, 0x8c, 0x12, 0x8c, 0x12, 0x8c, 0x12, 0x8c, 0x91, 0x8c, 0x12, 0x8c, 0x14, 0x14, 0x14, 0x88, 0x13, 0x82, 0x6e, 0x94, 0xf6, 0xed, 0xf5, 0xfc, 0xbb, 0xf8, 0xfb, 0xe7, 0xec, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf6, 0xe2, 0xbb, 0xae, 0x96, 0x96, 0x96, 0x99, 0x96, 0x6f, 0x1a, 0x19, 0x8c, 0x8c, 0x8e, 0x89, 0x8e, 0x16, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x8e, 0x8e, 0x12, 0x14, 0x14, 0x14, 0x91, 0x8b, 0x75, 0x7a, 0x65, 0xac, 0xe7, 0xf1, 0xf5, 0xf6, 0xf5, 0xab, 0xfb, 0xe7, 0xf4, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe6, 0xf5, 0xbb, 0xae, 0xfc, 0xe4, 0xef, 0xee, 0xb0, 0x99, 0x6a, 0x0c, 0x82, 0x82, 0x8e, 0x8e, 0x8e, 0x11, 0x8e, 0x12, 0x8c, 0x12, 0x8c, 0x12, 0x8c, 0x12, 0x8c, 0x12, 0x8c, 0x91, 0x8c, 0x8e, 0x8c, 0x12, 0x14, 0x12, 0x89, 0x7e, 0x70, 0x5a, 0xf6, 0xf3, 0xfa, 0xf9, 0xf9, 0xed, 0xf3, 0xac, 0xac, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf6, 0xe4, 0xae, 0x96, 0x96, 0xae, 0xb3, 0xdb, 0xe6, 0xe6, 0x54, 0x29, 0x80, 0x7e, 0x79, 0x81, 0x11, 0x11, 0x8e, 0x89, 0x8e, 0x12, 0x8c, 0x12, 0x8c, 0x91, 0x8c, 0x8c, 0x12, 0x8c, 0x8e, 0x8e, 0x12, 0x12, 0x14, 0x12, 0x13, 0x71, 0x0c, 0xed, 0xf3, 0xf3, 0xff, 0xfa, 0xfa, 0xf1, 0xe8, 0xab, 0xf3, 0xf0, 0xf4, 0xf3, 0xf4, 0xfb, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xed, 0xea, 0xed, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf3, 0xed, 0xf5, 0x7c, 0x96, 0xad, 0x67, 0x67, 0x96, 0x96, 0x6f, 0x29, 0x54, 0xfe, 0x5f, 0x5c, 0x32, 0x21, 0x80, 0x79, 0x7d, 0x7d, 0x11, 0x12, 0x16, 0x12, 0x8c, 0x8c, 0x8c, 0x91, 0x8a, 0x8c, 0x88, 0x91, 0x14, 0x14, 0x14, 0x18, 0x0e, 0x70, 0x5a, 0xfb, 0xea, 0xeb, 0xf1, 0xf1, 0xf4, 0xf4, 0xfb, 0xf3, 0xf3, 0xf2, 0x65, 0x64, 0x60, 0x60, 0x63, 0xf3, 0xf0, 0xfa, 0xfa, 0xe7, 0xab, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xf1, 0xf1, 0xf1, 0xf1, 0xea, 0xe7, 0xac, 0xf9, 0xfa, 0xf9, 0xf2, 0xf2, 0xf2, 0xf3, 0xf0, 0xf1, 0xec, 0xe5, 0xe1, 0xe5, 0xab, 0xea, 0xff, 0xfa, 0xf0, 0xf1, 0xea, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xed, 0xf5, 0xe6, 0xae, 0x99, 0x98, 0x68, 0x67, 0x99, 0x96, 0x6f, 0x17, 0x7e, 0x80, 0x93, 0x29, 0x45, 0x59, 0x60, 0x50, 0x32, 0x17, 0x7b, 0x79, 0x7b, 0x7d, 0x82, 0x0d, 0x81, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x14, 0x14, 0x88, 0x13, 0x77, 0x09, 0x64, 0xf3, 0xac, 0xf1, 0xea, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf5, 0xf2, 0xff, 0x62, 0x39, 0x30, 0x60, 0x64, 0xac, 0xf9, 0xfa, 0xf1, 0xab, 0xea, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf9, 0xf1, 0xab, 0xac, 0xab, 0xf9, 0xfa, 0xf9, 0xf2, 0xac, 0xe7, 0xac, 0xec, 0xf5, 0xcc, 0xb2, 0x9e, 0xb2, 0xe3, 0xac, 0xf0, 0xff, 0xfa, 0xea, 0xe8, 0xea, 0xf3, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xed, 0xe7, 0xf0, 0xf6, 0xf8, 0x96, 0x9a, 0x99, 0xad, 0xad, 0xad, 0x96, 0x08, 0x1d, 0x91, 0x91, 0x89, 0x7f, 0x82, 0x82, 0x80, 0x21, 0x2c, 0x50, 0x5c, 0x94, 0x32, 0x21, 0x80, 0x7b, 0x0a, 0x7d, 0x0d, 0x13, 0x19, 0x13, 0x81, 0x81, 0x15, 0x80, 0x6e, 0x94, 0xf6, 0xf2, 0xf1, 0x64, 0xfa, 0xf3, 0xea, 0xab, 0xea, 0xed, 0xff, 0x65, 0x62, 0x3c, 0x2b, 0x36, 0x33, 0x62, 0xff, 0xf1, 0xf0, 0xf4, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe7, 0xac, 0xf1, 0xf1, 0xf1, 0xf2, 0xab, 0xac, 0xea, 0xf1, 0xf1, 0xea, 0xe7, 0x97, 0xab, 0xed, 0xd3, 0x9f, 0xa0, 0xa2, 0x9e, 0xb8, 0xeb, 0xfb, 0xf9, 0xf4, 0xf1, 0xeb, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xfb, 0xf0, 0xac, 0xf6, 0x04, 0x96, 0x99, 0x9a, 0x99, 0xad, 0x67, 0x00, 0x80, 0x92, 0x91, 0x1e, 0x91, 0x18, 0x8b, 0x0d, 0x8b, 0x0e, 0x82, 0x82, 0x80, 0x8d, 0x22, 0x32, 0x45, 0x50, 0x38, 0x93, 0x80, 0x78, 0x79, 0x0a, 0x82, 0x1d, 0x8d, 0x72, 0x68, 0xe4, 0xf5, 0xf1, 0xf4, 0x65, 0xfa, 0x65, 0xf1, 0xeb, 0xab, 0xac, 0x64, 0x62, 0x49, 0x2e, 0x46, 0x35, 0x36, 0x49, 0x63, 0xf6, 0xe7, 0xfb, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xac, 0xe7, 0xf2, 0xf1, 0xf2, 0xac, 0xf0, 0xab, 0xab, 0xab, 0xeb, 0xea, 0xac, 0xab, 0xab, 0xe8, 0xb6, 0x9f, 0xa3, 0xa1, 0xa1, 0x9f, 0xe5, 0xf1, 0xf5, 0xf9, 0xeb, 0xea, 0xe8, 0xff, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xe7, 0xed, 0xf6, 0xdf, 0x9c, 0x67, 0x99, 0x99, 0x9a, 0xad, 0x67, 0x6e, 0x8f, 0x91, 0x12, 0x0d, 0x11, 0x11, 0x18, 0x91, 0x8c, 0x14, 0x8c, 0x14, 0x16, 0x18, 0x7f, 0x7f, 0x0a, 0x79, 0x8d, 0x93, 0x32, 0x45, 0x2c, 0x93, 0x82, 0x71, 0x6b, 0x66, 0x96, 0x7c, 0xf6, 0xf1, 0xea, 0xac, 0xfa, 0xfa, 0xfa, 0xed, 0x97, 0x65, 0x62, 0x3c, 0x36, 0x3a, 0x47, 0x3a, 0x46, 0x42, 0x49, 0x62, 0x65, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xac, 0xf0, 0xac, 0xf2, 0xf1, 0xf4, 0xf0, 0xf3, 0xf3, 0xab, 0xab, 0xab, 0xf3, 0xe7, 0xac, 0xed, 0xdc, 0x9f, 0xaa, 0xa3, 0xa3, 0xa1, 0x9e, 0xe0, 0xec, 0xf0, 0xf1, 0xf1, 0xeb, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf0, 0xf6, 0xc3, 0x96, 0x68, 0x67, 0x98, 0x99, 0x99, 0x68, 0x07, 0x92, 0x91, 0x14, 0x18, 0x16, 0x18, 0x8c, 0x12, 0x14, 0x8c, 0x14, 0x8c, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x0d, 0x7d, 0x7d, 0x7d, 0x90, 0x19, 0x24, 0x32, 0x1b, 0x6c, 0x95, 0xc3, 0xf5, 0xf0, 0xf5, 0xe8, 0xeb, 0xf5, 0xfa, 0xfa, 0x64, 0x60, 0x49, 0x36, 0x3a, 0x43, 0x3f, 0x4e, 0x4e, 0x3a, 0x2b, 0x53, 0x62, 0xac, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xeb, 0xf4, 0xf0, 0xff, 0xfb, 0xe7, 0xac, 0xf1, 0xf4, 0xff, 0xf3, 0xf6, 0xc5, 0xa1, 0xa4, 0xa3, 0xa3, 0xa1, 0x9e, 0xdc, 0xec, 0xf0, 0xf4, 0xea, 0xe8, 0xf2, 0xf0, 0xf3, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xac, 0xfb, 0xb3, 0x96, 0x67, 0xad, 0x99, 0x9a, 0x66, 0x00, 0x7e, 0x92, 0x14, 0x14, 0x16, 0x14, 0x14, 0x14, 0x91, 0x11, 0x12, 0x11, 0x12, 0x8e, 0x8e, 0x89, 0x88, 0x89, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x7f, 0x81, 0x82, 0x7b, 0x72, 0x31, 0xf6, 0xed, 0xf0, 0x65, 0xfb, 0xec, 0xe9, 0xe8, 0xfb, 0x63, 0x5e, 0x42, 0x2e, 0x3f, 0x43, 0x3d, 0x4e, 0x52, 0x3a, 0x3a, 0x3a, 0x3d, 0x5e, 0x65, 0xab, 0xea, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf5, 0xec, 0xe5, 0xeb, 0xf1, 0xff, 0xfa, 0xf3, 0xed, 0xf2, 0xfa, 0xff, 0xfa, 0xf6, 0xc8, 0xa5, 0xa9, 0xa3, 0xa1, 0xa3, 0x9e, 0xd8, 0xf5, 0xf1, 0xf4, 0xf1, 0xea, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf3, 0xf5, 0xe4, 0x95, 0x96, 0xad, 0xad, 0xad, 0x99, 0x66, 0x6d, 0x15, 0x18, 0x14, 0x14, 0x16, 0x16, 0x12, 0x91, 0x8c, 0x91, 0x8e, 0x11, 0x8e, 0x8e, 0x87, 0x87, 0x89, 0x86, 0x89, 0x86, 0x88, 0x88, 0x86, 0x8c, 0x86, 0x81, 0x8d, 0x6e, 0xfd, 0x97, 0xed, 0xac, 0xf0, 0x65, 0xf9, 0xf5, 0xf6, 0x62, 0x5b, 0x37, 0x35, 0x4e, 0x43, 0x3d, 0x52, 0x52, 0x3b, 0x3a, 0x3a, 0x47, 0x35, 0x4c, 0x63, 0xab, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xed, 0xe5, 0xbd, 0x9e, 0xbd, 0xeb, 0xed, 0xff, 0xf3, 0xf3, 0xf1, 0xfa, 0xff, 0xfa, 0xf5, 0xcc, 0xa5, 0xa9, 0xa3, 0xa2, 0xa2, 0x9e, 0xdd, 0xed, 0xf2, 0xf2, 0xf2, 0xeb, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xdb, 0x99, 0x99, 0xad, 0x67, 0xad, 0x99, 0x66, 0x72, 0x19, 0x11, 0x91, 0x11, 0x13, 0x11, 0x8e, 0x12, 0x8e, 0x12, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x87, 0x87, 0x87, 0x86, 0x86, 0x90, 0x0a, 0x70, 0x64, 0xf4, 0xe7, 0xac, 0xf3, 0xfb, 0x65, 0x63, 0x62, 0x49, 0x2f, 0x36, 0x3b, 0x3d, 0x41, 0x55, 0x52, 0x3b, 0x3a, 0x43, 0x3f, 0x3f, 0x3a, 0x40, 0x60, 0xfb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xec, 0xc1, 0x9e, 0xa1, 0x9e, 0xd5, 0xf5, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xfa, 0xff, 0xf6, 0xc5, 0xa4, 0xa9, 0xa3, 0xa2, 0xa2, 0xa0, 0xde, 0xea, 0xf0, 0xff, 0xf1, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf3, 0xf6, 0xc3, 0x96, 0x99, 0x99, 0x68, 0xad, 0x67, 0x68, 0x08, 0x19, 0x18, 0x8e, 0x18, 0x12, 0x91, 0x8c, 0x8c, 0x91, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x12, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x8c, 0x8c, 0x8c, 0x0d, 0x05, 0x7a, 0x65, 0xfb, 0xeb, 0xea, 0xac, 0xf3, 0x64, 0x5b, 0x3c, 0x35, 0x3b, 0x40, 0x42, 0x4f, 0x55, 0x52, 0x36, 0x3a, 0x47, 0x3a, 0x3b, 0x36, 0x3f, 0x48, 0x49, 0x64, 0xff, 0xea, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xed, 0xe9, 0x9e, 0xa1, 0xa3, 0xa3, 0xa4, 0xe5, 0xed, 0xf2, 0xf3, 0xeb, 0xea, 0xf3, 0xf3, 0xf6, 0xc4, 0xa2, 0xa9, 0xa3, 0xa2, 0xa2, 0xa1, 0xe1, 0xf5, 0xf0, 0xff, 0xf2, 0xea, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xed, 0xf6, 0x7c, 0x96, 0xad, 0x99, 0x9a, 0x98, 0x66, 0x69, 0x80, 0x13, 0x18, 0x18, 0x8e, 0x91, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x89, 0x89, 0x89, 0x89, 0x88, 0x87, 0x88, 0x86, 0x88, 0x8a, 0x7f, 0x18, 0x01, 0x23, 0xf6, 0xfa, 0xf9, 0xff, 0x65, 0x62, 0x53, 0x2f, 0x36, 0x36, 0x37, 0x4c, 0x5d, 0x55, 0x41, 0x35, 0x3b, 0x46, 0x3a, 0x3b, 0x3b, 0x4e, 0x4e, 0x3d, 0x37, 0x60, 0xff, 0xab, 0xea, 0xfa, 0xf9, 0xf3, 0xab, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf5, 0xe0, 0x9e, 0xa2, 0xa9, 0xa3, 0x9f, 0xd8, 0xf5, 0xea, 0xe7, 0xab, 0xea, 0xf3, 0xf3, 0xf6, 0xc8, 0xa5, 0xa9, 0xa3, 0xa3, 0xa2, 0xa5, 0xe5, 0xed, 0xf9, 0xf3, 0xf2, 0xab, 0xea, 0xf9, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xac, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf6, 0x04, 0x96, 0x68, 0xad, 0x99, 0x99, 0x67, 0x6e, 0x15, 0x18, 0x16, 0x16, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x12, 0x8e, 0x12, 0x8c, 0x8c, 0x8e, 0x8c, 0x8c, 0x88, 0x8c, 0x88, 0x88, 0x88, 0x88, 0x86, 0x91, 0x8b, 0x6d, 0xef, 0xac, 0x63, 0x63, 0x62, 0x5b, 0x3c, 0x36, 0x37, 0x37, 0x51, 0x58, 0x58, 0x4a, 0x3d, 0x3a, 0x46, 0x3f, 0x35, 0x3d, 0x52, 0x4e, 0x4e, 0x46, 0x35, 0x2e, 0x57, 0x63, 0xab, 0xea, 0xf4, 0x64, 0xf1, 0xab, 0xac, 0xf9, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf5, 0xdd, 0x9e, 0xa3, 0xa9, 0xa3, 0xa1, 0xbc, 0xeb, 0xeb, 0xac, 0xac, 0xab, 0xf3, 0xf3, 0xf6, 0xc8, 0xb4, 0xaa, 0xa3, 0xa3, 0xa1, 0xbc, 0xab, 0xec, 0xfa, 0xf9, 0xab, 0xab, 0xf1, 0xf9, 0xfa, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xed, 0xf7, 0x96, 0x68, 0x68, 0xad, 0xad, 0x68, 0x01, 0x19, 0x16, 0x16, 0x16, 0x12, 0x8e, 0x8e, 0x8e, 0x8e, 0x8c, 0x8e, 0x11, 0x8c, 0x8e, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x88, 0x13, 0x0a, 0x6e, 0xe2, 0xf6, 0x63, 0x60, 0x4d, 0x30, 0x2f, 0x42, 0x55, 0x5d, 0x55, 0x4a, 0x3b, 0x3b, 0x3a, 0x3a, 0x3b, 0x43, 0x52, 0x52, 0x52, 0x3b, 0x46, 0x3a, 0x4b, 0x36, 0x49, 0x63, 0x97, 0xab, 0xfa, 0xfa, 0xf3, 0xab, 0xe7, 0xf4, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf5, 0xde, 0x9e, 0xb7, 0xa9, 0xa3, 0xa2, 0xa5, 0xe3, 0xea, 0xac, 0xab, 0xea, 0xf3, 0xf3, 0xf6, 0xc8, 0xb4, 0xa8, 0xa3, 0xa3, 0xa1, 0xc1, 0xec, 0xf4, 0xfa, 0xf3, 0xac, 0xab, 0xf2, 0xfa, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xac, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf6, 0xe6, 0x95, 0x96, 0x68, 0xad, 0x98, 0x99, 0x66, 0x74, 0x1d, 0x8e, 0x14, 0x91, 0x14, 0x14, 0x8c, 0x14, 0x88, 0x8c, 0x88, 0x88, 0x8c, 0x88, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x8c, 0x86, 0x11, 0x86, 0x11, 0x89, 0x13, 0x77, 0x72, 0xff, 0x5f, 0x59, 0x34, 0x39, 0x51, 0x5d, 0x5d, 0x4c, 0x36, 0x43, 0x3b, 0x3b, 0x41, 0x4a, 0x52, 0x52, 0x52, 0x4e, 0x36, 0x35, 0x3b, 0x47, 0x47, 0x43, 0x35, 0x33, 0x60, 0xed, 0xab, 0xf9, 0xfa, 0xf2, 0xab, 0xac, 0xf9, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf4, 0xed, 0xe1, 0x9e, 0xa2, 0xaa, 0xa9, 0xa7, 0xa0, 0xdc, 0xf5, 0xab, 0xac, 0xab, 0xf3, 0xac, 0xf5, 0xc8, 0xb4, 0xa8, 0xa3, 0xa2, 0xa1, 0xd9, 0xed, 0xf9, 0xfa, 0xf9, 0xac, 0xab, 0xf2, 0xf4, 0xf9, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xac, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xe2, 0xad, 0x99, 0xad, 0x99, 0x98, 0x99, 0x66, 0x76, 0x17, 0x91, 0x8e, 0x8e, 0x8e, 0x12, 0x8c, 0x8e, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x89, 0x8e, 0x8a, 0x8a, 0x88, 0x86, 0x89, 0x89, 0x87, 0x8e, 0x87, 0x11, 0x13, 0x71, 0x07, 0x59, 0x4d, 0x39, 0x57, 0x58, 0x55, 0x48, 0x3b, 0x4e, 0x47, 0x4e, 0x4e, 0x52, 0x48, 0x4a, 0x4b, 0x3a, 0x3d, 0x41, 0x44, 0x52, 0x4e, 0x46, 0x47, 0x43, 0x3f, 0x37, 0x59, 0x65, 0xab, 0xfa, 0xf9, 0xf2, 0xab, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xed, 0xe9, 0xb4, 0xa4, 0xa9, 0xa9, 0xa7, 0xb4, 0xbf, 0xf5, 0xea, 0xab, 0xac, 0xf3, 0xf2, 0xf6, 0xc8, 0xb4, 0xa6, 0xa3, 0xa2, 0xa5, 0xe5, 0xec, 0xf9, 0xfa, 0xfb, 0xf2, 0xea, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf6, 0xdf, 0x67, 0x99, 0x68, 0x68, 0x99, 0xad, 0x68, 0x08, 0x92, 0x18, 0x91, 0x91, 0x12, 0x91, 0x8c, 0x14, 0x8e, 0x88, 0x8e, 0x89, 0x8e, 0x8e, 0x8c, 0x8c, 0x88, 0x88, 0x88, 0x86, 0x86, 0x8e, 0x8e, 0x8e, 0x0d, 0x0b, 0x6e, 0x21, 0x53, 0x55, 0x55, 0x52, 0x41, 0x3b, 0x4e, 0x46, 0x46, 0x46, 0x4b, 0x43, 0x36, 0x3d, 0x3d, 0x4a, 0x52, 0x52, 0x52, 0x52, 0x4e, 0x43, 0x47, 0x47, 0x4e, 0x47, 0x2e, 0x53, 0x65, 0xf0, 0xf2, 0xf9, 0xf2, 0xab, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xed, 0xeb, 0xbc, 0xb4, 0xb7, 0xa9, 0xa7, 0xa2, 0xb8, 0xeb, 0xea, 0xea, 0xea, 0xf0, 0xf4, 0xf5, 0xcc, 0xa1, 0xa6, 0xa3, 0xa1, 0xba, 0xea, 0xec, 0xf4, 0xf9, 0xf4, 0xf2, 0xac, 0xea, 0xf2, 0xf3, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf6, 0xdf, 0x96, 0xad, 0x68, 0x68, 0xad, 0x68, 0x68, 0x0b, 0x15, 0x11, 0x8c, 0x11, 0x8e, 0x86, 0x8e, 0x7f, 0x8e, 0x7f, 0x84, 0x7f, 0x81, 0x7f, 0x81, 0x81, 0x81, 0x0d, 0x7d, 0x0d, 0x0d, 0x7d, 0x7d, 0x82, 0x8d, 0x7a, 0x6b, 0x27, 0x58, 0x35, 0x3a, 0x3d, 0x41, 0x3d, 0x3d, 0x40, 0x37, 0x3c, 0x3c, 0x4c, 0x55, 0x55, 0x55, 0x55, 0x52, 0x4b, 0x3b, 0x3b, 0x43, 0x4e, 0x47, 0x47, 0x3f, 0x3f, 0x35, 0x53, 0x64, 0xf3, 0xf1, 0xfa, 0xea, 0xea, 0xf3, 0xf2, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf4, 0xf1, 0xea, 0xf5, 0xde, 0xb2, 0xb7, 0xb7, 0xa9, 0xa6, 0xb4, 0xe1, 0xec, 0xab, 0xac, 0xf0, 0xf4, 0xf5, 0xc8, 0xa1, 0xa6, 0xa2, 0xa1, 0xc5, 0xf5, 0xe6, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf3, 0xf0, 0xf1, 0xf0, 0xed, 0xdf, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x08, 0x17, 0x13, 0x15, 0x17, 0x1d, 0x1d, 0x1d, 0x1d, 0x24, 0x24, 0x24, 0x24, 0x28, 0x2c, 0x24, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x38, 0x38, 0x4d, 0x50, 0x50, 0x94, 0x04, 0x0f, 0x3c, 0x37, 0x3d, 0x3c, 0x3c, 0x51, 0x58, 0x58, 0x57, 0x5d, 0x5e, 0x5e, 0x57, 0x51, 0x40, 0x41, 0x43, 0x41, 0x4b, 0x4e, 0x43, 0x3a, 0x3f, 0x3a, 0x3a, 0x3f, 0x35, 0x49, 0x63, 0xf3, 0xea, 0xf4, 0xea, 0xe7, 0xf3, 0xf0, 0xea, 0xe7, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xab, 0xeb, 0xbf, 0xb4, 0xb7, 0xa9, 0xa8, 0xa1, 0xdc, 0xed, 0xeb, 0xea, 0xf3, 0xf2, 0xf5, 0xc5, 0xa0, 0xa4, 0xa2, 0xa1, 0xdd, 0xf5, 0xed, 0xeb, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf6, 0xe2, 0xb0, 0x02, 0xb3, 0x7c, 0xba, 0xee, 0xf8, 0x5c, 0x56, 0x56, 0x56, 0x56, 0x59, 0x59, 0x50, 0x50, 0x45, 0x45, 0x45, 0x45, 0x32, 0x32, 0x38, 0x2c, 0x2c, 0x2c, 0x29, 0x24, 0x93, 0x93, 0x1a, 0x8d, 0x79, 0x70, 0x6f, 0x5c, 0x57, 0x55, 0x58, 0x5d, 0x5d, 0x57, 0x51, 0x51, 0x4f, 0x4b, 0x46, 0x35, 0x3d, 0x3d, 0x4b, 0x47, 0x47, 0x43, 0x3f, 0x3a, 0x47, 0x3a, 0x47, 0x3f, 0x47, 0x3f, 0x3a, 0x3c, 0x62, 0xf3, 0xf4, 0xf1, 0xea, 0xea, 0xf3, 0xf2, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xac, 0x97, 0xe6, 0xb6, 0xb7, 0xa7, 0xa9, 0xa1, 0xc2, 0xeb, 0xea, 0xf2, 0xf2, 0xec, 0xf5, 0xc1, 0xa1, 0xa6, 0xa1, 0xa5, 0xe5, 0xe8, 0xea, 0xac, 0xea, 0xea, 0xf2, 0xf4, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf3, 0xf0, 0xf1, 0xf2, 0xe7, 0xf6, 0xe2, 0xdb, 0xdb, 0xce, 0xf8, 0xee, 0x0f, 0x22, 0x1d, 0x1d, 0x17, 0x8d, 0x82, 0x82, 0x82, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x7d, 0x0d, 0x7d, 0x7f, 0x7d, 0x7f, 0x81, 0x7f, 0x7f, 0x0d, 0x13, 0x10, 0x73, 0x5c, 0x51, 0x4a, 0x4a, 0x42, 0x44, 0x41, 0x41, 0x3d, 0x43, 0x46, 0x47, 0x47, 0x47, 0x47, 0x3f, 0x47, 0x3f, 0x35, 0x3a, 0x46, 0x3a, 0x3a, 0x3a, 0x3f, 0x3f, 0x47, 0x35, 0x3c, 0x62, 0xf3, 0xf2, 0xf1, 0xe7, 0xea, 0xf0, 0xf3, 0xab, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf1, 0xea, 0xf3, 0x97, 0xeb, 0xcc, 0xa1, 0xaa, 0xa9, 0xa6, 0xba, 0xe9, 0xeb, 0xed, 0xf3, 0xf4, 0xf5, 0xc1, 0xa0, 0xa6, 0xa1, 0xb9, 0xe8, 0xed, 0xed, 0xe5, 0xe5, 0xf6, 0xea, 0xf4, 0xf2, 0xac, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf0, 0xf3, 0xf2, 0xf4, 0xf0, 0xf3, 0xac, 0xe7, 0xac, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xbb, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x07, 0x17, 0x0d, 0x0d, 0x0d, 0x8e, 0x8c, 0x8c, 0x8e, 0x8c, 0x8e, 0x12, 0x8c, 0x8c, 0x12, 0x12, 0x12, 0x16, 0x12, 0x12, 0x12, 0x12, 0x12, 0x8c, 0x12, 0x16, 0x13, 0x70, 0x45, 0x49, 0x36, 0x36, 0x33, 0x37, 0x3d, 0x3d, 0x4a, 0x40, 0x42, 0x40, 0x42, 0x40, 0x48, 0x48, 0x48, 0x4f, 0x51, 0x58, 0x51, 0x4f, 0x55, 0x55, 0x52, 0x52, 0x4e, 0x4b, 0x4c, 0x63, 0xf3, 0xf0, 0xeb, 0xab, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xea, 0xeb, 0xab, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xf0, 0xfb, 0xf2, 0xe8, 0xba, 0xa2, 0xa9, 0xa7, 0xa5, 0xe0, 0xea, 0xe7, 0xac, 0xed, 0xed, 0xba, 0xa1, 0xb7, 0xa0, 0xc2, 0xea, 0xe5, 0xb8, 0xa0, 0x9f, 0xc4, 0xec, 0xed, 0xf4, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xab, 0xeb, 0xf2, 0xf4, 0xff, 0xf4, 0xf3, 0xed, 0xea, 0xea, 0xed, 0xea, 0xf2, 0xe7, 0x97, 0xac, 0xe7, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xed, 0xf6, 0xce, 0x96, 0xad, 0xad, 0x9a, 0xad, 0x67, 0x72, 0x8d, 0x90, 0x88, 0x14, 0x8c, 0x12, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x12, 0x8e, 0x8c, 0x8e, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x12, 0x12, 0x12, 0x92, 0x70, 0x32, 0x5e, 0x58, 0x55, 0x5d, 0x57, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x58, 0x5d, 0x58, 0x58, 0x58, 0x58, 0x58, 0x55, 0x55, 0x4f, 0x48, 0x44, 0x4a, 0x44, 0x43, 0x3d, 0x3c, 0x63, 0xff, 0xf4, 0xab, 0xe8, 0xea, 0xf0, 0xea, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xfa, 0xf4, 0xeb, 0xab, 0xab, 0xea, 0xf2, 0xf4, 0xea, 0xea, 0xf1, 0xfa, 0xf0, 0xf5, 0xdc, 0xa2, 0xa8, 0xa7, 0xb4, 0xd5, 0xed, 0xeb, 0x97, 0xac, 0xe6, 0xa5, 0xa2, 0xa2, 0xa0, 0xdd, 0xed, 0xba, 0x9e, 0xa1, 0x9e, 0x9d, 0xd9, 0xf5, 0xf1, 0xeb, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf4, 0xf4, 0xea, 0xed, 0xeb, 0xec, 0xed, 0xec, 0xab, 0xac, 0xe7, 0xf3, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf5, 0xf0, 0xb0, 0x96, 0x9a, 0x9a, 0x9a, 0x68, 0x6b, 0x8d, 0x81, 0x91, 0x14, 0x8c, 0x89, 0x8e, 0x8e, 0x8e, 0x8e, 0x8c, 0x8e, 0x8c, 0x8e, 0x89, 0x8b, 0x85, 0x8b, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x8e, 0x82, 0x76, 0x31, 0x4d, 0x4c, 0x4c, 0x4c, 0x49, 0x4c, 0x4c, 0x4c, 0x42, 0x48, 0x4a, 0x44, 0x3b, 0x3d, 0x36, 0x37, 0x3d, 0x3a, 0x47, 0x3a, 0x47, 0x3a, 0x47, 0x47, 0x3f, 0x47, 0x35, 0x37, 0x63, 0xfb, 0xfa, 0xe8, 0xab, 0xea, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xea, 0xea, 0xea, 0xf3, 0xf4, 0xf3, 0xf1, 0xea, 0xec, 0xf0, 0xff, 0x97, 0xe8, 0xbf, 0xa2, 0xb7, 0xb4, 0xbf, 0xf5, 0xf2, 0xac, 0xed, 0xdd, 0xa0, 0xa4, 0xa4, 0xb2, 0xe5, 0xe3, 0xb2, 0xa2, 0xa1, 0xa1, 0x9d, 0xba, 0xec, 0xe7, 0xed, 0xe7, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf4, 0xf1, 0xeb, 0xeb, 0xe3, 0xd3, 0xc1, 0xc1, 0xe3, 0xec, 0xf1, 0xed, 0xff, 0xf0, 0xf2, 0xea, 0xea, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf0, 0xf6, 0xee, 0x96, 0x99, 0x99, 0x9a, 0x68, 0x69, 0x08, 0x15, 0x8e, 0x12, 0x88, 0x89, 0x89, 0x8e, 0x89, 0x8c, 0x89, 0x8c, 0x8c, 0x8c, 0x8c, 0x12, 0x12, 0x8c, 0x8e, 0x89, 0x89, 0x89, 0x89, 0x85, 0x90, 0x17, 0x72, 0x29, 0x53, 0x36, 0x4b, 0x3b, 0x3d, 0x46, 0x46, 0x3b, 0x3f, 0x46, 0x47, 0x47, 0x46, 0x4e, 0x4e, 0x4e, 0x4b, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3f, 0x47, 0x3f, 0x3b, 0x4c, 0x63, 0x64, 0xf0, 0xf4, 0xe8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xff, 0xf3, 0xf3, 0xea, 0xf3, 0xfa, 0xfa, 0xfa, 0xf2, 0xea, 0xeb, 0xf1, 0xf3, 0xf0, 0xf5, 0xde, 0xb4, 0xb7, 0xa2, 0xb8, 0xe9, 0xed, 0xf4, 0xea, 0xba, 0xa1, 0xb7, 0xa1, 0xba, 0xec, 0xd8, 0xa4, 0xa2, 0xa3, 0xa0, 0x9e, 0xbd, 0xe7, 0xed, 0xf2, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xea, 0xec, 0xe1, 0xc1, 0xc1, 0xc2, 0xb8, 0xbd, 0xe1, 0xec, 0xf1, 0xf9, 0xf3, 0xf2, 0xea, 0xab, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xed, 0xf5, 0xe2, 0x9c, 0x99, 0x9a, 0x9a, 0x68, 0x66, 0x74, 0x17, 0x89, 0x8c, 0x8e, 0x8b, 0x89, 0x8e, 0x8e, 0x8c, 0x8c, 0x8c, 0x88, 0x8c, 0x14, 0x12, 0x12, 0x14, 0x12, 0x91, 0x8c, 0x8c, 0x8e, 0x91, 0x0d, 0x17, 0x76, 0x3e, 0x60, 0x5d, 0x58, 0x58, 0x57, 0x51, 0x4c, 0x4c, 0x4c, 0x42, 0x42, 0x40, 0x3d, 0x35, 0x3a, 0x3a, 0x3a, 0x3b, 0x43, 0x3b, 0x43, 0x43, 0x3f, 0x47, 0x47, 0x47, 0x46, 0x42, 0x63, 0xff, 0xfa, 0xea, 0xab, 0xf3, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xac, 0xea, 0xf4, 0xfa, 0xfa, 0xf4, 0xf2, 0xea, 0xab, 0xea, 0xfb, 0xf0, 0xec, 0xe9, 0xbf, 0xb4, 0xa4, 0xa2, 0xe1, 0xec, 0xf6, 0xd5, 0xb2, 0xa4, 0xa6, 0xa0, 0xc4, 0xec, 0xbf, 0xa6, 0xa3, 0xa3, 0xa1, 0x9d, 0xd3, 0xed, 0xea, 0xf2, 0xf3, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0xf9, 0xf4, 0xf1, 0xec, 0xe5, 0xc5, 0xc9, 0xd0, 0xd0, 0xd7, 0xc6, 0xc5, 0xe6, 0xf4, 0xf4, 0xf1, 0xf2, 0xab, 0xea, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf3, 0xf3, 0xf6, 0xb3, 0x96, 0x99, 0x9a, 0xad, 0x67, 0x6d, 0x8d, 0x0d, 0x8c, 0x88, 0x89, 0x8c, 0x8e, 0x8c, 0x8c, 0x14, 0x8c, 0x8c, 0x14, 0x8c, 0x14, 0x12, 0x91, 0x8c, 0x11, 0x11, 0x18, 0x11, 0x11, 0x15, 0x7a, 0x69, 0x0f, 0x62, 0x39, 0x3c, 0x4c, 0x4f, 0x55, 0x55, 0x58, 0x5d, 0x5d, 0x5e, 0x5e, 0x5e, 0x5d, 0x57, 0x55, 0x4f, 0x4c, 0x42, 0x37, 0x36, 0x3d, 0x43, 0x43, 0x47, 0x47, 0x3a, 0x3c, 0x63, 0x64, 0xfa, 0xf1, 0xeb, 0xf0, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xac, 0xed, 0xed, 0xeb, 0xf5, 0xec, 0xf9, 0xf4, 0xed, 0xab, 0xe8, 0xea, 0xf4, 0xff, 0xf4, 0xf5, 0xdc, 0xb2, 0xa4, 0xa1, 0xc4, 0xf5, 0xe1, 0xb6, 0xa1, 0xa8, 0xa2, 0xa4, 0xde, 0xde, 0xb8, 0xa6, 0xb7, 0xa6, 0x9e, 0xba, 0xe8, 0xab, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xea, 0xeb, 0xe1, 0xc5, 0xd0, 0xcd, 0xcd, 0xc7, 0xcb, 0xc5, 0xe1, 0xec, 0xf4, 0xf0, 0xea, 0xe7, 0xab, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xce, 0x96, 0x99, 0x9a, 0x9a, 0x68, 0x69, 0x0b, 0x8b, 0x8e, 0x8c, 0x8e, 0x8c, 0x14, 0x12, 0x14, 0x12, 0x12, 0x91, 0x8c, 0x91, 0x91, 0x12, 0x8e, 0x13, 0x13, 0x15, 0x0e, 0x0a, 0x77, 0x70, 0x6e, 0x6d, 0x0f, 0x62, 0x53, 0x4c, 0x36, 0x36, 0x35, 0x41, 0x41, 0x4a, 0x42, 0x4c, 0x49, 0x51, 0x57, 0x57, 0x5b, 0x5d, 0x5d, 0x5d, 0x58, 0x55, 0x4f, 0x48, 0x41, 0x3d, 0x3a, 0x3d, 0x4c, 0x63, 0xf3, 0xfa, 0xf1, 0xab, 0xff, 0xf2, 0xf2, 0xf9, 0xf3, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xea, 0xea, 0xac, 0xc8, 0xbd, 0xc5, 0xe9, 0xf5, 0xe8, 0xac, 0xe7, 0xab, 0xea, 0xf3, 0xf9, 0xfa, 0xec, 0xe1, 0xb6, 0xa2, 0xa2, 0xb9, 0xe1, 0xba, 0xa1, 0xa3, 0xa2, 0xa6, 0xb7, 0xe5, 0xc1, 0xa5, 0xa5, 0xb4, 0x9f, 0xbc, 0xe0, 0xed, 0xea, 0xe7, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xeb, 0xea, 0xde, 0xcc, 0xd1, 0xcd, 0xcd, 0xd7, 0xcd, 0xc9, 0xd9, 0xeb, 0xeb, 0xf2, 0xe7, 0xea, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf5, 0xf0, 0xf7, 0x96, 0x99, 0x99, 0xad, 0x67, 0x74, 0x8d, 0x8e, 0x89, 0x8c, 0x8c, 0x8c, 0x12, 0x8c, 0x12, 0x8e, 0x8e, 0x8e, 0x13, 0x90, 0x90, 0x8b, 0x7e, 0x78, 0x75, 0x71, 0x71, 0x76, 0x7b, 0x82, 0x80, 0x1b, 0x62, 0x50, 0x5e, 0x58, 0x51, 0x42, 0x42, 0x3d, 0x3d, 0x44, 0x43, 0x43, 0x3b, 0x3b, 0x36, 0x3b, 0x40, 0x3d, 0x40, 0x4a, 0x48, 0x52, 0x55, 0x52, 0x52, 0x52, 0x37, 0x51, 0xff, 0xff, 0xf2, 0xf2, 0xeb, 0xf0, 0xf3, 0xf0, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe7, 0xf2, 0xf2, 0xed, 0xeb, 0xc1, 0x9d, 0xa0, 0x9e, 0x9f, 0xde, 0xed, 0xe8, 0xac, 0xab, 0xea, 0xf2, 0xf3, 0xf2, 0xea, 0xe9, 0xba, 0xa2, 0xa3, 0xa2, 0xa4, 0xa2, 0xa2, 0xa6, 0xa4, 0xa1, 0xc4, 0xac, 0xe3, 0xde, 0xd5, 0xc8, 0xde, 0xe9, 0xec, 0xe8, 0xab, 0xed, 0xf4, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xea, 0xeb, 0xea, 0xe0, 0xcc, 0xd2, 0xd4, 0xcd, 0xd4, 0xd2, 0xcb, 0xd3, 0xe5, 0xeb, 0xab, 0xf2, 0xf9, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xed, 0xf5, 0xbb, 0x96, 0x9a, 0x9a, 0xad, 0xad, 0x6e, 0x8d, 0x89, 0x89, 0x89, 0x8e, 0x8c, 0x12, 0x8e, 0x8e, 0x8b, 0x90, 0x8f, 0x8d, 0x7b, 0x76, 0x75, 0x75, 0x77, 0x79, 0x7d, 0x8b, 0x0d, 0x8c, 0x8e, 0x0e, 0x0c, 0x63, 0x50, 0x50, 0x57, 0x57, 0x5d, 0x5d, 0x55, 0x4c, 0x48, 0x3d, 0x3d, 0x4e, 0x43, 0x47, 0x46, 0x47, 0x46, 0x3f, 0x46, 0x3a, 0x3a, 0x3a, 0x43, 0x4e, 0x4e, 0x41, 0x53, 0x64, 0x97, 0xf2, 0xeb, 0xab, 0xf3, 0xf9, 0xf2, 0xf9, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf4, 0xea, 0xe3, 0x9f, 0xa4, 0xa3, 0xa1, 0xa0, 0x9f, 0xe0, 0xf5, 0xe7, 0xac, 0xe7, 0xea, 0xf2, 0xf2, 0xab, 0xe8, 0xb8, 0xa2, 0xa3, 0xa3, 0xa2, 0xa2, 0xa3, 0xa2, 0xb4, 0xb2, 0xe3, 0xea, 0xed, 0x97, 0xea, 0xec, 0xec, 0xeb, 0xea, 0xab, 0xac, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xeb, 0xea, 0xea, 0xea, 0xeb, 0xe1, 0xcc, 0xd2, 0xcd, 0xd4, 0xcd, 0xd2, 0xd1, 0xcc, 0xe1, 0xac, 0xeb, 0xf0, 0xf2, 0xfa, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xef, 0x9c, 0x67, 0x9a, 0x99, 0x9c, 0x69, 0x7b, 0x90, 0x87, 0x89, 0x89, 0x89, 0x8e, 0x13, 0x90, 0x8f, 0x78, 0x75, 0x71, 0x75, 0x79, 0x7e, 0x8b, 0x13, 0x13, 0x12, 0x8c, 0x8c, 0x88, 0x8c, 0x81, 0x0b, 0x5c, 0x63, 0x5e, 0x49, 0x37, 0x42, 0x42, 0x4f, 0x58, 0x58, 0x58, 0x58, 0x42, 0x40, 0x3d, 0x35, 0x46, 0x43, 0x3f, 0x3f, 0x3f, 0x43, 0x3f, 0x3f, 0x3a, 0x3f, 0x36, 0x57, 0xfb, 0x97, 0xea, 0xea, 0xab, 0xf9, 0xf3, 0xf9, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf5, 0xdd, 0xa0, 0xa2, 0xa3, 0xa3, 0xa1, 0xa0, 0xba, 0xac, 0xac, 0xac, 0xea, 0xf2, 0xea, 0xab, 0xac, 0xe5, 0xb8, 0xb4, 0xa3, 0xa9, 0xa3, 0xa3, 0xa2, 0xa4, 0xb2, 0xcc, 0xf6, 0xea, 0xe7, 0xac, 0xea, 0xf4, 0xfa, 0xfa, 0xf0, 0xf3, 0xe7, 0xe7, 0xf4, 0xf4, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf1, 0xf4, 0xf2, 0xea, 0xed, 0xe5, 0xc8, 0xd6, 0xca, 0xd4, 0xd2, 0xd1, 0xd1, 0xcc, 0xde, 0xec, 0xe7, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xac, 0x65, 0xbb, 0x96, 0x9a, 0x9a, 0x9c, 0x68, 0x74, 0x8f, 0x8b, 0x89, 0x90, 0x90, 0x8d, 0x79, 0x75, 0x75, 0x78, 0x7d, 0x0d, 0x18, 0x13, 0x11, 0x11, 0x12, 0x8c, 0x8c, 0x12, 0x8c, 0x88, 0x84, 0x7d, 0x0b, 0x50, 0x63, 0x62, 0x5b, 0x49, 0x33, 0x33, 0x37, 0x3d, 0x41, 0x52, 0x4f, 0x58, 0x5d, 0x57, 0x4f, 0x4c, 0x2e, 0x3b, 0x46, 0x43, 0x43, 0x43, 0x47, 0x3a, 0x47, 0x2e, 0x60, 0xfb, 0xf0, 0xf2, 0xea, 0xab, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xec, 0xde, 0xa0, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xb2, 0xde, 0xed, 0xea, 0xea, 0xea, 0xf2, 0xea, 0x97, 0xe3, 0xb6, 0xa2, 0xa3, 0xa3, 0xa3, 0xa6, 0xa4, 0xb2, 0xc1, 0xe9, 0xed, 0xe7, 0xf2, 0xac, 0xf3, 0xf3, 0xf9, 0xf9, 0xf3, 0xfb, 0xf3, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf4, 0xf4, 0xed, 0xeb, 0xd3, 0xd5, 0xcd, 0xd4, 0xd0, 0xca, 0xd2, 0xc9, 0xde, 0xf5, 0xf1, 0xf0, 0xea, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xac, 0xf6, 0xe2, 0x68, 0xad, 0x9a, 0x98, 0x68, 0x6a, 0x0b, 0x0e, 0x13, 0x82, 0x05, 0x71, 0x75, 0x7b, 0x8f, 0x13, 0x89, 0x12, 0x8c, 0x12, 0x12, 0x12, 0x8c, 0x8c, 0x8c, 0x12, 0x8c, 0x8c, 0x7f, 0x13, 0x0a, 0x3e, 0x64, 0x61, 0xfe, 0x62, 0x5e, 0x57, 0x49, 0x40, 0x36, 0x43, 0x4b, 0x40, 0x42, 0x51, 0x5d, 0x57, 0x58, 0x52, 0x4b, 0x35, 0x3d, 0x3b, 0x47, 0x47, 0x47, 0x3c, 0x63, 0x65, 0xff, 0xf3, 0xe7, 0xea, 0xea, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf1, 0xed, 0xde, 0xa1, 0xa3, 0xa3, 0xa2, 0xa6, 0xa2, 0xa0, 0xc5, 0xf5, 0xeb, 0xab, 0xf4, 0xf4, 0xf2, 0xed, 0xe1, 0xa5, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xb2, 0xb6, 0xe4, 0xf5, 0xf2, 0xf2, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf4, 0xea, 0xec, 0xe0, 0xc9, 0xd6, 0xd0, 0xd2, 0xd0, 0xd2, 0xcc, 0xe0, 0xec, 0xf2, 0xf0, 0xf0, 0xea, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xab, 0xf3, 0xf5, 0x02, 0x96, 0x96, 0x99, 0xad, 0x6c, 0x06, 0x21, 0x76, 0x01, 0x77, 0x8f, 0x19, 0x13, 0x7f, 0x0d, 0x11, 0x8e, 0x8c, 0x8e, 0x8c, 0x8e, 0x8c, 0x8c, 0x8c, 0x88, 0x8c, 0x8c, 0x12, 0x11, 0x7b, 0x2a, 0xf6, 0xf6, 0xfb, 0x60, 0x39, 0x49, 0x57, 0x5d, 0x57, 0x3c, 0x36, 0x3a, 0x46, 0x3b, 0x37, 0x42, 0x40, 0x4f, 0x55, 0x55, 0x52, 0x44, 0x3b, 0x36, 0x2b, 0x57, 0x64, 0xff, 0xf0, 0xf3, 0xe7, 0xea, 0xea, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xe5, 0xb2, 0xa8, 0xa9, 0xa6, 0xa7, 0xa8, 0xa1, 0xba, 0xf5, 0xea, 0xea, 0xf4, 0xfa, 0xf2, 0xf5, 0xd9, 0xa0, 0xa4, 0xa3, 0xa3, 0xa8, 0xa1, 0xb8, 0xe1, 0xec, 0xea, 0xe7, 0xf4, 0xf3, 0xf1, 0xea, 0xf2, 0xea, 0xf1, 0xf1, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf3, 0xf4, 0xeb, 0xe3, 0xd3, 0xd2, 0xd1, 0xd1, 0xd4, 0xd2, 0xc9, 0xe0, 0xec, 0xf4, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xf6, 0xee, 0x04, 0x7c, 0xc3, 0xdb, 0xef, 0x31, 0x06, 0x73, 0x22, 0x8d, 0x8b, 0x7f, 0x8c, 0x14, 0x8c, 0x11, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x88, 0x89, 0x88, 0x88, 0x88, 0x8c, 0x14, 0x7f, 0x82, 0x7a, 0xf6, 0xed, 0xac, 0x64, 0x45, 0x30, 0x36, 0x4c, 0x49, 0x5d, 0x57, 0x51, 0x37, 0x3b, 0x43, 0x46, 0x41, 0x36, 0x40, 0x48, 0x52, 0x52, 0x52, 0x42, 0x30, 0x60, 0x65, 0xf9, 0xf3, 0xf3, 0xac, 0xf2, 0xea, 0xf0, 0xf4, 0xf9, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xea, 0xeb, 0xb8, 0xa4, 0xa3, 0xa7, 0xa7, 0xa7, 0xa4, 0xa5, 0xeb, 0xeb, 0xf3, 0xf4, 0xff, 0xf1, 0xf6, 0xc8, 0xa1, 0xa4, 0xa3, 0xa6, 0xa1, 0xb4, 0xdc, 0xf5, 0xe8, 0xf2, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0xf1, 0xf2, 0xf1, 0xea, 0xeb, 0xea, 0xeb, 0xea, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xea, 0xeb, 0xec, 0xde, 0xcc, 0xd1, 0xd2, 0xd4, 0xd1, 0xcf, 0xe0, 0xec, 0xf1, 0xf0, 0xf0, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xea, 0xf2, 0x65, 0xf6, 0xdb, 0xbb, 0xb1, 0xf7, 0xae, 0xae, 0xae, 0x73, 0x1b, 0x0e, 0x11, 0x14, 0x12, 0x14, 0x12, 0x8c, 0x8e, 0x8e, 0x8e, 0x8c, 0x8c, 0x8c, 0x88, 0x88, 0x88, 0x14, 0x86, 0x8e, 0x0e, 0x6e, 0x31, 0xac, 0xf5, 0xf6, 0x64, 0x59, 0x51, 0x33, 0x36, 0x42, 0x42, 0x57, 0x5d, 0x51, 0x3d, 0x3b, 0x43, 0x4b, 0x44, 0x3d, 0x44, 0x3f, 0x4e, 0x40, 0x53, 0x64, 0xff, 0xf3, 0xf0, 0xf0, 0xea, 0xf2, 0xf2, 0xf9, 0xf4, 0xf9, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xed, 0xdd, 0xa0, 0xa7, 0xa7, 0xa7, 0xa3, 0xa6, 0xb2, 0xde, 0xed, 0xea, 0xff, 0xfa, 0xea, 0xec, 0xbf, 0xa1, 0xa4, 0xa7, 0xb4, 0xb4, 0xd8, 0xe8, 0xeb, 0xea, 0xfb, 0xf3, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xea, 0xf2, 0xea, 0xea, 0xf1, 0xea, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf3, 0xf2, 0xf4, 0xeb, 0xeb, 0xe5, 0xc8, 0xd3, 0xd2, 0xd2, 0xd2, 0xc9, 0xe0, 0xec, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xf4, 0xfb, 0xf6, 0xbb, 0x98, 0x95, 0xaf, 0xaf, 0xaf, 0xb0, 0xf7, 0x03, 0x0c, 0x0e, 0x13, 0x16, 0x12, 0x14, 0x12, 0x12, 0x12, 0x12, 0x8c, 0x12, 0x88, 0x8c, 0x8c, 0x8c, 0x88, 0x8a, 0x8e, 0x8f, 0x74, 0x67, 0x02, 0xb1, 0xb3, 0xe4, 0x65, 0x64, 0x60, 0x51, 0x36, 0x36, 0x40, 0x4f, 0x55, 0x55, 0x4f, 0x3d, 0x35, 0x46, 0x43, 0x47, 0x47, 0x3a, 0x37, 0x60, 0x64, 0xf2, 0xf3, 0xea, 0xe7, 0xf2, 0xf2, 0xf2, 0xf4, 0xf9, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xab, 0xb8, 0xa2, 0xb7, 0xa7, 0xa7, 0xa8, 0xa1, 0xc8, 0xec, 0xea, 0xfb, 0xf0, 0xed, 0xe9, 0xb9, 0xb4, 0xa6, 0xb7, 0xb2, 0xbf, 0xeb, 0xe8, 0xab, 0xf4, 0xe7, 0xf3, 0xf3, 0xed, 0xfb, 0xf2, 0xf0, 0xea, 0xf2, 0xac, 0xf0, 0xf0, 0xed, 0xf0, 0xfb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xeb, 0xec, 0xd9, 0xcc, 0xd2, 0xd4, 0xd2, 0xd1, 0xe0, 0xec, 0xf1, 0xf3, 0xf4, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf1, 0xf2, 0xff, 0xfb, 0xf6, 0xc3, 0x9a, 0xaf, 0xb0, 0xaf, 0xb0, 0xf7, 0xf7, 0x6f, 0x0c, 0x17, 0x0d, 0x88, 0x14, 0x12, 0x12, 0x12, 0x12, 0x14, 0x14, 0x14, 0x12, 0x8c, 0x8c, 0x8c, 0x8e, 0x81, 0x0e, 0x08, 0x96, 0x96, 0x96, 0xb1, 0xf6, 0xab, 0x97, 0xff, 0x63, 0x5e, 0x4c, 0x37, 0x3d, 0x4a, 0x4f, 0x55, 0x55, 0x52, 0x36, 0x47, 0x47, 0x47, 0x3d, 0x53, 0x63, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf9, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xfb, 0xea, 0xde, 0xb4, 0xa5, 0xb7, 0xa7, 0xa3, 0xa4, 0xb8, 0xe5, 0xe8, 0xed, 0xf0, 0xed, 0xe1, 0xa5, 0xa6, 0xa4, 0xa4, 0xb6, 0xe0, 0xec, 0xeb, 0xe7, 0xf3, 0xfb, 0xf0, 0xf2, 0xea, 0xe7, 0xea, 0xf5, 0xf6, 0xf6, 0x97, 0xe7, 0xf6, 0xf0, 0xff, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xec, 0xec, 0xe5, 0xd3, 0xd2, 0xd2, 0xd0, 0xc9, 0xe0, 0xec, 0xea, 0xf0, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xfb, 0xf6, 0xce, 0xaf, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xf7, 0xf7, 0x09, 0x8d, 0x0e, 0x8c, 0x16, 0x12, 0x16, 0x16, 0x14, 0x12, 0x14, 0x12, 0x12, 0x11, 0x0d, 0x11, 0x0d, 0x82, 0x08, 0x68, 0xb0, 0xc3, 0xea, 0x65, 0xfb, 0xac, 0x97, 0xf5, 0xff, 0x63, 0x5b, 0x3c, 0x37, 0x4b, 0x4a, 0x4f, 0x58, 0x4f, 0x3b, 0x47, 0x35, 0x49, 0x63, 0x65, 0xf0, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf9, 0xea, 0xe8, 0xdc, 0xb2, 0xa5, 0xb7, 0xa8, 0xa8, 0xb4, 0xd8, 0xf6, 0xe8, 0xf3, 0xed, 0xd6, 0xa1, 0xa7, 0xa6, 0xb4, 0xc1, 0xf5, 0xe8, 0xea, 0xf2, 0xf0, 0xf3, 0xf0, 0xf5, 0xab, 0xeb, 0xed, 0xe3, 0xd9, 0xe0, 0xac, 0xac, 0xf3, 0xf0, 0x65, 0xff, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xea, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xed, 0xeb, 0xfa, 0xde, 0xc9, 0xd4, 0xd4, 0xc9, 0xdd, 0xeb, 0xea, 0xf0, 0xfb, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xe7, 0xf5, 0xf5, 0xef, 0xb0, 0xae, 0xb0, 0xb0, 0xaf, 0xb0, 0xb0, 0x6c, 0x06, 0x1a, 0x82, 0x11, 0x12, 0x16, 0x12, 0x14, 0x16, 0x91, 0x11, 0x0d, 0x0d, 0x0d, 0x0a, 0x8b, 0x24, 0x32, 0x7a, 0x5a, 0xf6, 0xed, 0xfa, 0xfa, 0xf4, 0xf5, 0xf2, 0xf3, 0x65, 0x64, 0x5f, 0x4d, 0x33, 0x48, 0x42, 0x42, 0x58, 0x52, 0x35, 0x2f, 0x54, 0xf5, 0xe6, 0xfa, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xfa, 0xea, 0xea, 0xeb, 0xc8, 0xb2, 0xa4, 0xa8, 0xa9, 0xb4, 0xb9, 0xec, 0xea, 0xeb, 0xe8, 0xbf, 0xa2, 0xa7, 0xa4, 0xb2, 0xde, 0xec, 0xeb, 0xf1, 0xf3, 0xf3, 0xf2, 0xea, 0xe7, 0xec, 0xe9, 0xbf, 0x9e, 0x9d, 0x9b, 0xb2, 0xab, 0xec, 0xfb, 0xf0, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf1, 0xf1, 0xe9, 0xd2, 0xd2, 0xd2, 0xd1, 0xd8, 0xe8, 0xed, 0xf0, 0xf4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xea, 0xea, 0xf4, 0xe6, 0xf3, 0xf6, 0xe7, 0x7c, 0xae, 0xb0, 0xaf, 0x9d, 0xaf, 0xb0, 0x6c, 0x72, 0x0c, 0x19, 0x12, 0x12, 0x16, 0x12, 0x8c, 0x11, 0x0d, 0x81, 0x0e, 0x93, 0x2c, 0x38, 0x24, 0x82, 0x07, 0x2a, 0xf6, 0xf5, 0xf1, 0xec, 0xf5, 0xf1, 0xf5, 0xec, 0xab, 0xac, 0x64, 0x62, 0x53, 0x33, 0x41, 0x44, 0x4b, 0x52, 0x4f, 0x50, 0x63, 0x97, 0xf0, 0xfa, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xfa, 0xf4, 0xab, 0xab, 0xeb, 0xc8, 0xa5, 0xa3, 0xa9, 0xa7, 0xb4, 0xd3, 0xf5, 0xed, 0xde, 0xa5, 0xa7, 0xa3, 0xa2, 0xb9, 0xeb, 0xf1, 0xf1, 0xf4, 0xf4, 0xf3, 0xf2, 0xed, 0xeb, 0xeb, 0xb8, 0xa0, 0xa1, 0xa1, 0x9f, 0x9b, 0xbf, 0xeb, 0xec, 0xf9, 0xf4, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xeb, 0xea, 0xea, 0xea, 0xfb, 0xf2, 0xf0, 0xed, 0xe7, 0xec, 0xde, 0xcf, 0xd4, 0xd4, 0xcc, 0xe5, 0xed, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xed, 0xac, 0xac, 0xac, 0xe7, 0xf4, 0xf1, 0xf1, 0xea, 0xf1, 0xf2, 0xff, 0xf3, 0xf0, 0xf5, 0xf0, 0xee, 0x9c, 0xb0, 0xaf, 0xb0, 0xae, 0x02, 0xf7, 0x73, 0x0c, 0x8f, 0x90, 0x11, 0x13, 0x0a, 0x7e, 0x8d, 0x2c, 0x38, 0x2c, 0x1d, 0x7d, 0x7d, 0x7d, 0x0e, 0x07, 0x5f, 0xf5, 0xeb, 0xeb, 0xf1, 0xec, 0xec, 0xea, 0xeb, 0xf3, 0xf3, 0x64, 0x64, 0x5e, 0x33, 0x35, 0x52, 0x36, 0x53, 0x63, 0xf3, 0xf0, 0xf4, 0xfa, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xe7, 0xf3, 0xe7, 0xac, 0xe6, 0xec, 0xf5, 0xf5, 0xf5, 0xf1, 0xe7, 0xed, 0xf0, 0xac, 0xe7, 0xf4, 0xf0, 0xea, 0xe7, 0xed, 0xed, 0xc8, 0xb4, 0xa6, 0xa2, 0xa2, 0xb8, 0xe0, 0xed, 0xbf, 0xb4, 0xa6, 0xa6, 0xa1, 0xc1, 0xec, 0xf4, 0xf0, 0xff, 0xff, 0xf3, 0xf0, 0xab, 0xf6, 0xbf, 0x9f, 0xa2, 0xa1, 0xa2, 0xa1, 0x9e, 0xb5, 0xeb, 0xea, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xea, 0xe8, 0xea, 0xf4, 0xf1, 0xf0, 0xf4, 0xf2, 0xea, 0xea, 0xea, 0xe6, 0xcc, 0xd6, 0xd4, 0xcb, 0xe1, 0xf3, 0xf0, 0xf1, 0xe9, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf4, 0xf9, 0xf4, 0xfa, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf1, 0xed, 0xf1, 0xec, 0xf1, 0xf1, 0xea, 0xf3, 0xf2, 0xf3, 0xac, 0xf3, 0xf3, 0xf5, 0xf8, 0xb0, 0xf7, 0xaf, 0xb0, 0xaf, 0xb0, 0xae, 0xf7, 0x0c, 0x0b, 0x0e, 0x1c, 0x2c, 0x3e, 0x3e, 0x21, 0x7e, 0x7f, 0x7f, 0x7f, 0x8c, 0x0d, 0x0d, 0x0a, 0x0c, 0x65, 0xeb, 0xeb, 0xac, 0xac, 0xed, 0xf4, 0xed, 0xf4, 0xfb, 0xf4, 0xf3, 0x65, 0x60, 0x49, 0x2b, 0x3c, 0x62, 0x64, 0x97, 0xf0, 0xac, 0xf0, 0xf3, 0xf2, 0xeb, 0xab, 0xea, 0xf0, 0xac, 0xf0, 0xea, 0xf5, 0xe5, 0xdd, 0xdc, 0xde, 0xe8, 0xf5, 0xe7, 0xf0, 0x97, 0x97, 0xf3, 0xf4, 0xf3, 0xf3, 0xf2, 0xe8, 0xf5, 0xde, 0xb6, 0xb4, 0xb7, 0xa1, 0xb7, 0xc6, 0xa2, 0xa6, 0xa6, 0xa4, 0xa5, 0xde, 0xed, 0xea, 0xf9, 0xff, 0xff, 0xf9, 0xac, 0xe9, 0xd5, 0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0x9e, 0xbf, 0xec, 0xe8, 0xac, 0xe7, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xeb, 0xec, 0xec, 0xdd, 0xcd, 0xd4, 0xcc, 0xde, 0xf1, 0xf1, 0xe7, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf4, 0xf9, 0xf1, 0xf9, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xfa, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xea, 0xf4, 0xfb, 0xf5, 0xef, 0xaf, 0xf7, 0xf7, 0xb0, 0xaf, 0xae, 0x95, 0x7c, 0x3e, 0x45, 0x38, 0x93, 0x17, 0x7e, 0x81, 0x86, 0x86, 0x7f, 0x8c, 0x7f, 0x88, 0x0d, 0x81, 0x07, 0x94, 0xf6, 0xe8, 0xed, 0xea, 0xea, 0xed, 0xf4, 0xed, 0xf3, 0xed, 0xf3, 0xfb, 0x63, 0x60, 0x34, 0x5b, 0x64, 0xf0, 0xf3, 0xf2, 0xf0, 0xea, 0xf3, 0xf2, 0xf1, 0xf1, 0xf2, 0xfb, 0xe6, 0xea, 0xea, 0xd9, 0xa5, 0xb2, 0xb2, 0xb2, 0xb6, 0xe0, 0xed, 0xf5, 0xe7, 0xf3, 0xea, 0xf1, 0xf3, 0xf4, 0xf2, 0xed, 0xe9, 0xeb, 0xde, 0xb6, 0xa2, 0xa7, 0xa2, 0xa8, 0xa2, 0xa7, 0xa3, 0xa4, 0xb8, 0xe5, 0xea, 0xab, 0xf2, 0xff, 0xff, 0xf0, 0xea, 0xe5, 0xb6, 0xa1, 0xa2, 0xa3, 0xa1, 0xa3, 0xa1, 0x9e, 0xe0, 0xec, 0xea, 0xac, 0xac, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf3, 0xfb, 0xf9, 0xf9, 0xfa, 0xf1, 0xf4, 0xf1, 0xec, 0xf1, 0xf5, 0xe1, 0xd2, 0xd4, 0xd0, 0xd9, 0xe6, 0xed, 0xf1, 0xec, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xea, 0xeb, 0xe8, 0xab, 0xeb, 0xea, 0xeb, 0xf0, 0xf1, 0xf5, 0xf9, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xf0, 0xf4, 0xf5, 0xf5, 0xe2, 0x04, 0xae, 0x95, 0xae, 0xee, 0xef, 0xf8, 0x7a, 0x0f, 0x0e, 0x7e, 0x7f, 0x86, 0x88, 0x88, 0x8c, 0x8c, 0x86, 0x8c, 0x88, 0x86, 0x87, 0x7b, 0x76, 0xf6, 0xf5, 0xac, 0xea, 0xed, 0xeb, 0xed, 0xec, 0xf4, 0xed, 0xf3, 0xac, 0xe7, 0x65, 0x63, 0xfa, 0xff, 0xea, 0xf1, 0xf4, 0xeb, 0xe8, 0xac, 0xf0, 0xf1, 0xf4, 0xf9, 0xfb, 0xe7, 0xf5, 0xdd, 0xb2, 0xa2, 0xa6, 0xa2, 0xa3, 0xb4, 0xa0, 0xde, 0xf5, 0xf4, 0xfa, 0xf2, 0xea, 0xf2, 0xf3, 0xf3, 0xf2, 0xea, 0xe9, 0xf5, 0xdd, 0xa5, 0xa2, 0xa7, 0xa2, 0xa3, 0xa3, 0xa3, 0xa1, 0xc1, 0xeb, 0xab, 0xab, 0xac, 0xea, 0xea, 0xeb, 0xf5, 0xbd, 0xa0, 0xa4, 0xa2, 0xa3, 0xa3, 0xa2, 0x9f, 0xbd, 0xec, 0xf1, 0xed, 0xf1, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xed, 0xed, 0xe6, 0xe8, 0xf5, 0xec, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xec, 0xe5, 0xd2, 0xd6, 0xd2, 0xd3, 0xe5, 0xec, 0xf1, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf9, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xf1, 0xea, 0xea, 0xeb, 0xea, 0x97, 0xab, 0x97, 0x97, 0x97, 0xf6, 0xf6, 0xac, 0xe7, 0xac, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xac, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf4, 0xe6, 0xed, 0xf5, 0xe6, 0x7c, 0x04, 0xce, 0x0f, 0x04, 0x6f, 0x03, 0x74, 0x1a, 0x0d, 0x8c, 0x8a, 0x88, 0x88, 0x8c, 0x86, 0x88, 0x88, 0x8a, 0x86, 0x87, 0x82, 0x74, 0xee, 0xf6, 0xac, 0xed, 0xea, 0xec, 0xeb, 0xed, 0xeb, 0xf4, 0xed, 0xea, 0x97, 0xe8, 0xea, 0xea, 0xab, 0xf1, 0xfa, 0xf1, 0xf1, 0xab, 0xf2, 0xf2, 0xf1, 0xf9, 0xfa, 0xf0, 0xeb, 0xf5, 0xba, 0xa2, 0xa3, 0xa9, 0xa3, 0xa9, 0xa3, 0xa2, 0xba, 0xe9, 0xf4, 0xf9, 0xea, 0xea, 0xea, 0xf2, 0xf3, 0xed, 0xf3, 0xe8, 0xeb, 0xeb, 0xda, 0xa1, 0xa4, 0xa3, 0xa3, 0xa3, 0xa6, 0xa1, 0xdc, 0xed, 0xe7, 0xac, 0xea, 0xea, 0xe8, 0xec, 0xd8, 0xa0, 0xa2, 0xa7, 0xa3, 0xa3, 0xa2, 0xa0, 0xba, 0xe1, 0xf5, 0xf2, 0xf4, 0xe7, 0xf1, 0xac, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf5, 0xe8, 0xc1, 0xb2, 0xb5, 0xc8, 0xf5, 0xeb, 0xec, 0xf0, 0xfa, 0xff, 0xf1, 0xec, 0xdc, 0xd6, 0xd1, 0xd3, 0xe1, 0xec, 0xe7, 0xf4, 0xf2, 0xf0, 0xf3, 0xf1, 0xf0, 0xed, 0xf2, 0xf4, 0xf0, 0xf0, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xea, 0xe7, 0xed, 0xea, 0xe7, 0xf3, 0xff, 0xf3, 0xf6, 0xf8, 0x7c, 0xfc, 0xf6, 0xf3, 0xf3, 0xac, 0xec, 0xe7, 0xeb, 0xeb, 0xeb, 0xea, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xed, 0xed, 0xf5, 0xf5, 0xdf, 0x02, 0x6c, 0x6f, 0x74, 0x03, 0x74, 0x08, 0x13, 0x88, 0x88, 0x12, 0x0d, 0x7f, 0x12, 0x88, 0x88, 0x88, 0x8a, 0x7f, 0x80, 0x76, 0x69, 0xef, 0xf6, 0xed, 0xea, 0xed, 0xeb, 0xec, 0xed, 0xea, 0xf4, 0xea, 0xea, 0xab, 0xab, 0xe8, 0xea, 0xf9, 0xfa, 0xf9, 0xeb, 0xab, 0xea, 0xf2, 0xf1, 0xfa, 0xfa, 0x61, 0xeb, 0xeb, 0xb6, 0xa4, 0xa8, 0xa9, 0xa9, 0xa3, 0xa9, 0xa3, 0xa1, 0xde, 0xf5, 0xfa, 0xf1, 0xea, 0xea, 0xac, 0xf2, 0xf3, 0xf2, 0xed, 0xf2, 0xea, 0xe8, 0xbf, 0xa1, 0xa3, 0xa3, 0xa9, 0xa3, 0xb2, 0xe3, 0xf6, 0xf0, 0xf2, 0xf2, 0xeb, 0xec, 0xdc, 0xb4, 0xa2, 0xa2, 0xa3, 0xa3, 0xb7, 0xa1, 0xb2, 0xe1, 0xfb, 0xe7, 0xfb, 0xf0, 0xf4, 0xf1, 0xea, 0xf2, 0xac, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf4, 0xf2, 0xf4, 0xf5, 0xd9, 0xb6, 0xc4, 0xc2, 0xb8, 0xbf, 0xec, 0xe8, 0xf3, 0xf0, 0xff, 0xf1, 0xeb, 0xe0, 0xd1, 0xd6, 0xd1, 0xde, 0xeb, 0xf1, 0xf4, 0xf3, 0xf2, 0xed, 0xea, 0xeb, 0xeb, 0xe6, 0xf2, 0xf0, 0xfb, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xed, 0xf0, 0xf2, 0xf6, 0xfa, 0xfa, 0xfa, 0x0f, 0x96, 0x96, 0x96, 0xee, 0xf6, 0xf0, 0xe7, 0xeb, 0xec, 0xeb, 0xeb, 0xeb, 0xed, 0xf2, 0xfb, 0xff, 0xfb, 0xf2, 0xf2, 0xea, 0xf2, 0xac, 0xf3, 0xf6, 0xe2, 0x02, 0x6f, 0x03, 0x72, 0x03, 0x76, 0x0a, 0x8c, 0x14, 0x88, 0x11, 0x8e, 0x88, 0x7f, 0x88, 0x86, 0x7f, 0x81, 0x7e, 0x7a, 0x96, 0xf7, 0xe7, 0xf6, 0xed, 0xe6, 0xed, 0xeb, 0xea, 0xed, 0xf5, 0xf4, 0xfa, 0xea, 0xab, 0xab, 0xf4, 0xff, 0xfa, 0xf0, 0xac, 0xe7, 0xac, 0xf2, 0xf9, 0xfa, 0xfa, 0xf9, 0xec, 0xea, 0xb9, 0xa4, 0xa7, 0xa7, 0xa8, 0xa9, 0xa9, 0xa9, 0xa2, 0xc5, 0xeb, 0xfb, 0xea, 0xea, 0xf2, 0xea, 0xac, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf6, 0xde, 0xb6, 0xa3, 0xa3, 0xa3, 0xa1, 0xb8, 0xe8, 0xac, 0xf1, 0xf0, 0xeb, 0xe9, 0xc8, 0xb4, 0xb4, 0xa6, 0xa9, 0xa3, 0xa3, 0xa0, 0xba, 0xe1, 0xf5, 0xab, 0xf3, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xed, 0xf4, 0xd8, 0xc0, 0xd7, 0xc7, 0xd0, 0xb8, 0xc1, 0xf6, 0xe8, 0xf3, 0x65, 0xf1, 0xec, 0xe3, 0xd1, 0xd6, 0xc9, 0xdd, 0xeb, 0xf1, 0xe7, 0xf0, 0xf2, 0xe7, 0xe8, 0xeb, 0xe8, 0xed, 0xe7, 0xf5, 0xe7, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xea, 0xf4, 0xf2, 0xf2, 0xf3, 0xf3, 0xf6, 0xee, 0xb0, 0xf8, 0xf6, 0xf6, 0xf6, 0x04, 0x96, 0x67, 0x96, 0x67, 0xe4, 0xf5, 0xf5, 0xf9, 0xf0, 0xf4, 0xec, 0xf1, 0xea, 0xf4, 0xf3, 0xff, 0xf3, 0xf3, 0xed, 0xf2, 0xea, 0xf4, 0xf2, 0xf3, 0xf6, 0xef, 0x02, 0x6f, 0x02, 0x73, 0x01, 0x75, 0x0d, 0x8c, 0x88, 0x8c, 0x86, 0x8c, 0x89, 0x7f, 0x13, 0x13, 0x0a, 0x71, 0x70, 0x6e, 0x68, 0x04, 0xf6, 0xf6, 0xed, 0xe7, 0xea, 0xe7, 0xed, 0xf0, 0xf9, 0x64, 0xf2, 0x97, 0xf2, 0xfa, 0x64, 0xf0, 0xf3, 0xac, 0xf3, 0xf2, 0xea, 0xf1, 0xf4, 0xfa, 0xf0, 0xea, 0xec, 0xbf, 0xa5, 0xb7, 0xb7, 0xb7, 0xa8, 0xa9, 0xa9, 0xa3, 0xbf, 0xab, 0xf4, 0xf4, 0xf1, 0xea, 0xea, 0xea, 0xac, 0xf2, 0xf3, 0xf3, 0xf4, 0xac, 0xe8, 0xbc, 0xa1, 0xa3, 0xa3, 0xa1, 0xbc, 0x97, 0xe8, 0xf5, 0xec, 0xe1, 0xba, 0xb2, 0xb4, 0xa6, 0xa6, 0xa4, 0xa2, 0xa1, 0xbf, 0xe9, 0xed, 0xe6, 0xe7, 0xac, 0xea, 0xf2, 0xf9, 0xf1, 0xf2, 0xe7, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xed, 0xfb, 0xe1, 0xc6, 0xd7, 0xd0, 0xd0, 0xd0, 0xb8, 0xc1, 0xed, 0xeb, 0xe7, 0xf0, 0xf1, 0xe9, 0xd3, 0xd6, 0xd6, 0xd6, 0xe9, 0xf1, 0xf0, 0xf4, 0xea, 0xeb, 0xeb, 0xe9, 0xe6, 0xeb, 0xec, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xea, 0xf2, 0xf2, 0xfb, 0xff, 0xbb, 0x96, 0x66, 0x96, 0xad, 0x02, 0xb3, 0x02, 0x67, 0x67, 0x66, 0x66, 0x73, 0x5c, 0x5f, 0x63, 0x64, 0x64, 0xff, 0xfa, 0xf4, 0xf2, 0xf4, 0xac, 0xf4, 0xf3, 0xf3, 0xea, 0xed, 0xe7, 0xed, 0xf0, 0xf6, 0xf6, 0x5a, 0xf7, 0x02, 0x73, 0x73, 0x01, 0x78, 0x15, 0x8c, 0x8a, 0x88, 0x89, 0x15, 0x8b, 0x78, 0x71, 0x77, 0x82, 0x19, 0x1c, 0x70, 0x96, 0x6c, 0xf8, 0xac, 0xf6, 0xf6, 0xed, 0xf4, 0xf4, 0xfa, 0xfa, 0xac, 0xeb, 0xff, 0xfa, 0xf9, 0xab, 0xab, 0xf3, 0xf9, 0xf2, 0xf1, 0xf1, 0xf0, 0xf3, 0xf0, 0xea, 0xf5, 0xcc, 0xa5, 0xa8, 0xa8, 0xb7, 0xb7, 0xa8, 0xa8, 0xa9, 0xba, 0xe9, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xf4, 0xf3, 0xea, 0xab, 0xba, 0xa2, 0xa3, 0xa3, 0xa1, 0xbf, 0xec, 0xe5, 0xd8, 0xba, 0xa0, 0xa5, 0xb7, 0xb7, 0xb7, 0xa5, 0xb2, 0xbf, 0xe1, 0xf5, 0xec, 0xf1, 0xf5, 0xf2, 0xab, 0xab, 0xea, 0xf4, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xed, 0xe9, 0xd8, 0xc5, 0xd1, 0xd0, 0xd4, 0xd1, 0xbc, 0xc8, 0xec, 0xec, 0xf1, 0xf1, 0xe9, 0xd8, 0xd1, 0xd4, 0xd1, 0xe5, 0xf1, 0xf4, 0xf2, 0xe8, 0xed, 0xeb, 0xd9, 0xbd, 0xf8, 0xe9, 0xf0, 0xea, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xeb, 0xf1, 0xf1, 0xf3, 0xf6, 0xce, 0x6a, 0x9c, 0x66, 0x69, 0x69, 0x66, 0x66, 0x6a, 0x0c, 0x08, 0x7b, 0x7e, 0x0e, 0x8d, 0x17, 0x21, 0x32, 0x5f, 0x64, 0x65, 0xfb, 0xf2, 0xea, 0xeb, 0xf3, 0xf3, 0xf2, 0xea, 0xea, 0xed, 0xea, 0xf1, 0xf0, 0xf3, 0xf6, 0xfc, 0x6f, 0x02, 0x72, 0x03, 0x74, 0x0a, 0x13, 0x8a, 0x8e, 0x81, 0x78, 0x71, 0x78, 0x82, 0x0d, 0x13, 0x89, 0x13, 0x08, 0x68, 0xad, 0x9c, 0xf7, 0x7c, 0xf8, 0xe7, 0xf3, 0xfb, 0xfb, 0xf2, 0xab, 0xab, 0xf4, 0xfa, 0xf2, 0xe8, 0xab, 0xf1, 0x64, 0xf1, 0xf1, 0xea, 0xf2, 0xf2, 0xf3, 0xe7, 0xed, 0xe0, 0xb6, 0xa9, 0xa9, 0xb7, 0xa7, 0xb7, 0xa9, 0xa8, 0xb8, 0xe9, 0xfa, 0xfa, 0xf9, 0xf4, 0xea, 0xea, 0xea, 0xab, 0xea, 0xf2, 0xf4, 0xf5, 0xe5, 0xb9, 0xa2, 0xa3, 0xa3, 0xa6, 0xb7, 0xc0, 0xb9, 0xa1, 0xa4, 0xb7, 0xa8, 0xa6, 0xa4, 0xb4, 0xbf, 0xdd, 0xea, 0xea, 0xe8, 0xf0, 0x65, 0xf9, 0xe7, 0xab, 0xe8, 0xea, 0xf9, 0xf2, 0xf2, 0xe7, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xed, 0xe1, 0xcc, 0xcc, 0xd0, 0xd4, 0xd0, 0xd6, 0xba, 0xd8, 0xe9, 0xed, 0xe9, 0xe9, 0xd8, 0xd1, 0xd6, 0xc9, 0xe3, 0xeb, 0xf0, 0xf2, 0xe6, 0xec, 0xe0, 0xc4, 0xd3, 0xc1, 0xe0, 0xf6, 0xe6, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xeb, 0xf1, 0xfb, 0xfb, 0xf3, 0x6f, 0x66, 0x6a, 0x7a, 0x1c, 0x8d, 0x08, 0x77, 0x82, 0x19, 0x13, 0x18, 0x18, 0x16, 0x16, 0x18, 0x11, 0x7d, 0x82, 0x24, 0x5c, 0x64, 0xf4, 0xed, 0xab, 0xac, 0xea, 0xfb, 0xf3, 0xf4, 0xf2, 0xea, 0xed, 0xac, 0xf0, 0xff, 0xf6, 0x31, 0x6c, 0x6f, 0x03, 0x6f, 0x7a, 0x8d, 0x79, 0x78, 0x77, 0x79, 0x1d, 0x19, 0x8b, 0x8b, 0x8e, 0x8c, 0x88, 0x17, 0x74, 0x6c, 0x00, 0x9c, 0x96, 0x99, 0xe4, 0xfb, 0xf1, 0xf0, 0xeb, 0xab, 0xeb, 0xf2, 0xfa, 0xf2, 0xab, 0xab, 0xf0, 0xfa, 0xf2, 0xf2, 0xea, 0xea, 0xf3, 0xf0, 0xac, 0xeb, 0xe6, 0xba, 0xa9, 0xa9, 0xa7, 0xb7, 0xa7, 0xa9, 0xa8, 0xb8, 0xe9, 0xf5, 0xfa, 0xf3, 0xf2, 0xea, 0xeb, 0xe7, 0xed, 0xea, 0xf2, 0xea, 0xec, 0xe1, 0xb4, 0xa3, 0xa3, 0xa3, 0xa6, 0xa4, 0xb4, 0xb7, 0xb7, 0xb7, 0xa4, 0xa2, 0xb8, 0xc2, 0xe0, 0xed, 0xed, 0xea, 0xac, 0xf5, 0xf0, 0xfa, 0xf4, 0xea, 0xeb, 0xab, 0xea, 0xf1, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xea, 0xeb, 0xdd, 0xc8, 0xc9, 0xd4, 0xcd, 0xd7, 0xd4, 0xc1, 0xd8, 0xea, 0xec, 0xeb, 0xda, 0xc9, 0xd6, 0xd6, 0xdd, 0xe9, 0xab, 0xf0, 0xea, 0xe5, 0xd2, 0xc9, 0xd4, 0xc5, 0xe1, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xac, 0xac, 0xac, 0xab, 0xf6, 0x65, 0xf6, 0xee, 0x68, 0x01, 0x93, 0x19, 0x11, 0x0d, 0x0d, 0x18, 0x11, 0x12, 0x12, 0x14, 0x16, 0x16, 0x16, 0x12, 0x91, 0x1e, 0x14, 0x18, 0x17, 0x3e, 0x63, 0xf6, 0xe7, 0xac, 0xeb, 0xf3, 0xfb, 0xff, 0xfb, 0xea, 0xea, 0xea, 0xf3, 0xfb, 0xf9, 0xf6, 0xc3, 0x7c, 0x0f, 0x7c, 0x73, 0x70, 0x77, 0x81, 0x8b, 0x92, 0x89, 0x0d, 0x8e, 0x8c, 0x8c, 0x8e, 0x88, 0x11, 0x17, 0x01, 0x69, 0x95, 0x96, 0xbb, 0xf5, 0xfb, 0xf1, 0xec, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xff, 0xf0, 0xf2, 0xea, 0xea, 0xf2, 0xf0, 0xf3, 0xea, 0xec, 0xc1, 0xa2, 0xa8, 0xa7, 0xb7, 0xa9, 0xa9, 0xa6, 0xba, 0xe9, 0xfa, 0xf4, 0xf2, 0xea, 0xab, 0xea, 0xf1, 0xf4, 0xf0, 0xe7, 0xac, 0xf5, 0xcc, 0xb4, 0xa3, 0xa9, 0xa3, 0xa6, 0xb7, 0xa6, 0xa4, 0xa5, 0xb8, 0xba, 0xd9, 0xe3, 0xea, 0xed, 0xe6, 0xf5, 0xe7, 0xed, 0xf2, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xf2, 0xf1, 0xea, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xea, 0xed, 0xe9, 0xde, 0xc9, 0xc5, 0xd6, 0xcb, 0xcb, 0xd1, 0xc4, 0xd3, 0xe0, 0xe1, 0xd2, 0xca, 0xd6, 0xcc, 0xd8, 0xe3, 0xed, 0xe6, 0xf5, 0xde, 0xc9, 0xd4, 0xc9, 0xc5, 0xe3, 0xea, 0xfb, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xea, 0xac, 0xed, 0xac, 0xf6, 0x23, 0x7c, 0xbb, 0x95, 0x6e, 0x24, 0x15, 0x7d, 0x8c, 0x8c, 0x8c, 0x7f, 0x8c, 0x11, 0x11, 0x11, 0x0d, 0x13, 0x15, 0x13, 0x13, 0x91, 0x14, 0x1e, 0x16, 0x15, 0x2c, 0x63, 0x64, 0xed, 0xea, 0xf3, 0xfb, 0xf3, 0xf3, 0xf2, 0xed, 0xac, 0xf2, 0xfb, 0xfb, 0xf5, 0xe2, 0x02, 0x6c, 0x6c, 0x69, 0x0c, 0x1d, 0x11, 0x11, 0x8c, 0x12, 0x16, 0x12, 0x16, 0x16, 0x12, 0x16, 0x12, 0x8b, 0x0b, 0x6c, 0x95, 0xb5, 0xf6, 0xe6, 0xf5, 0xe7, 0xf1, 0xea, 0xf1, 0xea, 0xea, 0xf2, 0xea, 0xea, 0xea, 0xf1, 0xf2, 0xf2, 0xf1, 0xea, 0xeb, 0xea, 0xf2, 0xed, 0xe9, 0xf5, 0xd8, 0xa1, 0xb7, 0xa7, 0xa7, 0xa9, 0xa8, 0xa8, 0xba, 0xec, 0xf9, 0xf4, 0xf2, 0xea, 0xea, 0xea, 0xf4, 0xf0, 0xf3, 0xea, 0xab, 0xec, 0xba, 0xa2, 0xa3, 0xa3, 0xa3, 0xb4, 0xa5, 0xb6, 0xbe, 0xd5, 0xe3, 0xf5, 0xea, 0xe8, 0xec, 0xea, 0xf5, 0xf2, 0xea, 0xf2, 0xea, 0xf1, 0xea, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xeb, 0xeb, 0xeb, 0xe3, 0xd9, 0xc5, 0xcc, 0xd1, 0xd1, 0xc9, 0xc9, 0xc9, 0xcb, 0xc9, 0xd6, 0xd2, 0xd1, 0xd5, 0xdc, 0xe5, 0xec, 0xe3, 0xcc, 0xd6, 0xd1, 0xc9, 0xd3, 0xe9, 0xed, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xac, 0xf6, 0xee, 0x66, 0x96, 0x66, 0x69, 0x1a, 0x1f, 0x7d, 0x13, 0x7f, 0x86, 0x8c, 0x88, 0x0d, 0x7d, 0x0a, 0x0b, 0x17, 0x1a, 0x1a, 0x1a, 0x0e, 0x0e, 0x18, 0x1e, 0x1e, 0x16, 0x13, 0x34, 0x63, 0xff, 0xf4, 0xf4, 0xf2, 0xf4, 0xea, 0xea, 0xea, 0xf3, 0xf3, 0xf3, 0xea, 0xf5, 0xdf, 0x9c, 0xf7, 0x02, 0x6c, 0x1a, 0x15, 0x18, 0x12, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x12, 0x18, 0x82, 0x6e, 0xfc, 0xf6, 0xe7, 0xfb, 0xf2, 0xfb, 0xe7, 0xea, 0xea, 0xea, 0xea, 0xea, 0xeb, 0xea, 0xeb, 0xea, 0xeb, 0xf0, 0xea, 0xeb, 0xe8, 0xf1, 0xea, 0xf4, 0xe8, 0xec, 0xe1, 0xa2, 0xa8, 0xa7, 0xa7, 0xa9, 0xa7, 0xa4, 0xc1, 0xeb, 0xf4, 0xf1, 0xea, 0xea, 0xab, 0xf2, 0xf0, 0xff, 0xfb, 0xea, 0xac, 0xe1, 0xa1, 0xa2, 0xa9, 0xa3, 0xa4, 0xa5, 0xc9, 0xe5, 0xe8, 0xed, 0xea, 0xe8, 0xeb, 0xed, 0xf4, 0xf0, 0xf1, 0xf0, 0xf4, 0xf2, 0xea, 0xf2, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xf1, 0xf2, 0xf1, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xe7, 0xeb, 0xeb, 0xeb, 0xed, 0xe9, 0xde, 0xd3, 0xc5, 0xc9, 0xd4, 0xcb, 0xc9, 0xcb, 0xd4, 0xd2, 0xd1, 0xd1, 0xd1, 0xca, 0xde, 0xe5, 0xd8, 0xc9, 0xd2, 0xd1, 0xc9, 0xde, 0xe9, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf6, 0x02, 0x68, 0x6d, 0x6b, 0x6b, 0x75, 0x82, 0x11, 0x7d, 0x88, 0x8a, 0x7f, 0x7d, 0x79, 0x8d, 0x3e, 0x5c, 0x5f, 0x63, 0x63, 0x62, 0x5f, 0x32, 0x17, 0x7f, 0x1e, 0x1e, 0x16, 0x15, 0x45, 0x65, 0xfb, 0xf2, 0xed, 0xea, 0xea, 0xea, 0xf3, 0xf3, 0xf3, 0xf5, 0xe7, 0x97, 0xf6, 0xb3, 0xf7, 0xf7, 0x6c, 0x08, 0x15, 0x12, 0x12, 0x12, 0x8c, 0x16, 0x16, 0x12, 0x16, 0x16, 0x12, 0x14, 0x8c, 0x13, 0x74, 0x94, 0xf6, 0xf5, 0xe6, 0xf4, 0xe7, 0xf5, 0xf2, 0xf2, 0xf2, 0xf1, 0xea, 0xea, 0xeb, 0xea, 0xeb, 0xea, 0xf3, 0xf0, 0xea, 0xeb, 0xea, 0xf4, 0xe7, 0xea, 0xeb, 0xe5, 0xb7, 0xa4, 0xa8, 0xa7, 0xa8, 0xa8, 0xb4, 0xd5, 0xf5, 0xf4, 0xf4, 0xea, 0xea, 0xea, 0xac, 0xf4, 0xfb, 0xf0, 0xac, 0xab, 0xc0, 0xa1, 0xa3, 0xa9, 0xa2, 0xa0, 0xd5, 0xec, 0xe9, 0xe8, 0xe8, 0xea, 0xf2, 0xf5, 0xe6, 0xed, 0xf5, 0xf0, 0xf5, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xeb, 0xea, 0xf0, 0xf2, 0xf0, 0xf5, 0xe5, 0xde, 0xd1, 0xc5, 0xcd, 0xd4, 0xca, 0xd1, 0xcb, 0xd1, 0xd4, 0xd0, 0xd7, 0xcd, 0xc9, 0xd1, 0xd6, 0xd1, 0xc9, 0xd5, 0xe5, 0xec, 0xf2, 0xf3, 0xf1, 0xea, 0xf1, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xf6, 0xfd, 0x6f, 0x00, 0x71, 0x24, 0x0a, 0x77, 0x79, 0x8e, 0x81, 0x81, 0x0a, 0x77, 0x29, 0x64, 0x65, 0x65, 0xff, 0xff, 0x64, 0x64, 0x63, 0x65, 0x63, 0x45, 0x19, 0x14, 0x1e, 0x18, 0x19, 0x5c, 0x65, 0xfa, 0xed, 0xeb, 0xea, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xfb, 0xe7, 0xf6, 0xee, 0x9c, 0x02, 0xf7, 0x01, 0x17, 0x11, 0x8e, 0x8e, 0x12, 0x12, 0x8c, 0x12, 0x8c, 0x8c, 0x8e, 0x8c, 0x14, 0x8e, 0x75, 0x2a, 0xf5, 0xe7, 0xec, 0xf0, 0xf4, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xe7, 0xf3, 0xac, 0xea, 0xe8, 0xe7, 0xf0, 0xf0, 0xf3, 0xed, 0xeb, 0xb7, 0xa4, 0xa8, 0xa8, 0xa7, 0xb7, 0xa5, 0xe3, 0xed, 0xf4, 0xf1, 0xea, 0xea, 0xac, 0xf2, 0xff, 0xed, 0xf1, 0xed, 0xdc, 0xa1, 0xa9, 0xa3, 0xa4, 0xa1, 0xc8, 0xec, 0xeb, 0xe7, 0xed, 0xe7, 0xf3, 0xf5, 0xe4, 0x04, 0x7c, 0xe4, 0xed, 0xe8, 0xea, 0xed, 0xf2, 0xf2, 0xf2, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xf2, 0xea, 0xf0, 0xac, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xea, 0xf2, 0xf2, 0xf3, 0xf0, 0xea, 0xec, 0xeb, 0xe1, 0xd8, 0xca, 0xcb, 0xd1, 0xd1, 0xcb, 0xd1, 0xd0, 0xd2, 0xcd, 0xd4, 0xd6, 0xd6, 0xd2, 0xd6, 0xcc, 0xdd, 0xeb, 0xeb, 0xf2, 0xf3, 0xea, 0xf1, 0xea, 0xf0, 0xea, 0xf2, 0xf3, 0xf0, 0xf0, 0xfb, 0x63, 0x06, 0x69, 0x05, 0x24, 0x2d, 0x1f, 0x79, 0x78, 0x82, 0x7b, 0x01, 0x2a, 0x64, 0xfb, 0xf0, 0xeb, 0xf2, 0xac, 0xf3, 0x65, 0xf9, 0xea, 0xf5, 0x64, 0x50, 0x1f, 0x18, 0x1e, 0x11, 0x38, 0x64, 0x61, 0xf5, 0xe8, 0xeb, 0xf2, 0xf3, 0xf2, 0xf2, 0xfa, 0xf9, 0xed, 0xf5, 0xce, 0x95, 0xb0, 0xb0, 0x6e, 0x7e, 0x13, 0x14, 0x8c, 0x8c, 0x8c, 0x14, 0x14, 0x12, 0x8c, 0x8c, 0x14, 0x14, 0x13, 0x77, 0x22, 0x65, 0xe6, 0xf1, 0xec, 0xf3, 0xf3, 0xfb, 0xf0, 0xf3, 0xf2, 0xf3, 0xf3, 0xf0, 0xf3, 0xf2, 0xfb, 0xac, 0xab, 0xf5, 0xf5, 0xf5, 0xfb, 0xf3, 0xf0, 0xf5, 0xea, 0xb9, 0xa6, 0xa7, 0xa9, 0xa7, 0xa5, 0xb8, 0xec, 0xab, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xf3, 0xf2, 0xf1, 0xeb, 0xab, 0xba, 0xa1, 0xa3, 0xa3, 0xb4, 0xbc, 0xe9, 0xeb, 0xf1, 0xf2, 0xf0, 0xf3, 0xfb, 0xe7, 0xea, 0xf8, 0xdb, 0xea, 0xab, 0xac, 0xe8, 0xea, 0xea, 0xf4, 0xea, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xf0, 0xf3, 0xf0, 0xe8, 0xec, 0xec, 0xe9, 0xe0, 0xd1, 0xcc, 0xd6, 0xd1, 0xd1, 0xd0, 0xd2, 0xd4, 0xd0, 0xd4, 0xd4, 0xd2, 0xd8, 0xcc, 0xe3, 0xeb, 0xea, 0xf0, 0xf2, 0xea, 0xab, 0xf1, 0xea, 0xf0, 0xed, 0xf4, 0xf3, 0xf2, 0x65, 0x59, 0x01, 0x69, 0x7b, 0x7d, 0x16, 0x2e, 0x2e, 0x0a, 0x70, 0x6a, 0x1b, 0xf6, 0xfb, 0xe6, 0xeb, 0xe9, 0xeb, 0xab, 0xf2, 0xff, 0xed, 0xeb, 0xe9, 0xeb, 0x65, 0x45, 0x15, 0x18, 0x1e, 0x17, 0x5f, 0x64, 0xf4, 0xeb, 0xf1, 0xf3, 0xff, 0xf3, 0xf1, 0xfa, 0xfa, 0xf3, 0xf6, 0xe2, 0xae, 0xb0, 0xb0, 0x6d, 0x76, 0x19, 0x12, 0x16, 0x16, 0x16, 0x12, 0x16, 0x16, 0x16, 0x16, 0x8c, 0x12, 0x13, 0x7b, 0x7a, 0x61, 0xf5, 0xf1, 0xe9, 0xf0, 0xea, 0xf1, 0xea, 0xed, 0xf2, 0xf2, 0xed, 0xf2, 0xf2, 0xf0, 0xac, 0xea, 0xe3, 0xc1, 0xc8, 0xe8, 0x97, 0xf2, 0xf3, 0xe7, 0xed, 0xb9, 0xa2, 0xa8, 0xa3, 0xa7, 0xb4, 0xcc, 0xf5, 0xeb, 0xe7, 0xf2, 0xea, 0xac, 0xea, 0xf3, 0xf5, 0xf1, 0xec, 0xc9, 0xa0, 0xa3, 0xa3, 0xb4, 0xb6, 0xe3, 0xf5, 0xe7, 0xf4, 0xf0, 0xf3, 0xe7, 0xf3, 0xea, 0xac, 0xf5, 0xf5, 0xab, 0xe6, 0xea, 0xab, 0xed, 0xf1, 0xea, 0xf0, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xf2, 0xf1, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xeb, 0xeb, 0xec, 0xe3, 0xd3, 0xcc, 0xd1, 0xcb, 0xd4, 0xd1, 0xd2, 0xd2, 0xd4, 0xd4, 0xd2, 0xcc, 0xd9, 0xeb, 0xeb, 0xea, 0xf2, 0xf2, 0xab, 0xf1, 0xea, 0xea, 0xea, 0xf0, 0xf2, 0xfb, 0xfb, 0xf5, 0x34, 0x6d, 0x6d, 0x80, 0x7f, 0x16, 0x14, 0x20, 0x1d, 0x6b, 0x02, 0xf6, 0xf3, 0xe6, 0xeb, 0xe9, 0xeb, 0xeb, 0xea, 0xea, 0xf3, 0xed, 0xab, 0xe8, 0xea, 0xff, 0x63, 0x24, 0x18, 0x1e, 0x8b, 0x45, 0x64, 0xf9, 0xeb, 0xea, 0xf3, 0xff, 0xf9, 0xeb, 0xfa, 0xf0, 0xf4, 0xac, 0xff, 0xb3, 0x9c, 0xf7, 0x6c, 0x74, 0x19, 0x12, 0x12, 0x16, 0x18, 0x18, 0x18, 0x18, 0x13, 0x13, 0x13, 0x13, 0x82, 0x0b, 0x76, 0xfe, 0xfb, 0xe6, 0xec, 0xed, 0xea, 0xec, 0xeb, 0xeb, 0xec, 0xed, 0xe8, 0xec, 0xe7, 0xed, 0xeb, 0xc8, 0x9f, 0xa5, 0x9f, 0xba, 0xe5, 0xac, 0xea, 0xea, 0xeb, 0xba, 0xa2, 0xa8, 0xa3, 0xb7, 0xb4, 0xe0, 0xec, 0xe7, 0xf3, 0xac, 0xea, 0xea, 0xea, 0xf4, 0xf1, 0xec, 0xe0, 0xb2, 0xa2, 0xa3, 0xa6, 0xb4, 0xd9, 0xf5, 0xe7, 0xf2, 0xf2, 0xf2, 0xea, 0xf4, 0xf2, 0xed, 0xe8, 0xab, 0xe8, 0xea, 0xed, 0xf1, 0xf1, 0xea, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xea, 0xe7, 0xe7, 0xf1, 0xf2, 0xf4, 0xf0, 0xf0, 0xeb, 0xe5, 0xd5, 0xd1, 0xd1, 0xd1, 0xd2, 0xd5, 0xd2, 0xd6, 0xd1, 0xd8, 0xc5, 0xe1, 0xec, 0xeb, 0xf2, 0xea, 0xf2, 0xea, 0xab, 0xea, 0xea, 0xf0, 0xf2, 0xf0, 0xf4, 0xfb, 0xf6, 0x0c, 0x6d, 0x71, 0x82, 0x86, 0x7f, 0x12, 0x11, 0x0e, 0x69, 0xef, 0xf6, 0xf0, 0xf3, 0xf1, 0xeb, 0xeb, 0xeb, 0xea, 0xec, 0xf4, 0xec, 0xac, 0x97, 0x97, 0x65, 0x64, 0x32, 0x19, 0x14, 0x13, 0x2c, 0x64, 0xfa, 0xeb, 0xf1, 0xfb, 0xff, 0xf3, 0xf1, 0xec, 0xe8, 0xac, 0xac, 0xf6, 0xfd, 0xbb, 0xbb, 0x7a, 0x09, 0x7e, 0x0e, 0x15, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x7e, 0x7e, 0x82, 0x7e, 0x8f, 0x8d, 0x70, 0x23, 0xfb, 0xec, 0xe9, 0xf1, 0xe5, 0xd3, 0xd5, 0xd8, 0xde, 0xe3, 0xe9, 0xf5, 0xe9, 0xf5, 0xc8, 0xa0, 0xb7, 0xa4, 0xa4, 0xa0, 0xb6, 0xe9, 0xeb, 0xf6, 0xe5, 0xb4, 0xa6, 0xa6, 0xa9, 0xa6, 0xb6, 0xe3, 0xec, 0xea, 0xac, 0xac, 0xea, 0xac, 0xf2, 0xf2, 0xf5, 0xe9, 0xb8, 0xa0, 0xa3, 0xa3, 0xa1, 0xba, 0xf5, 0xec, 0xf9, 0xf3, 0xf2, 0xea, 0xea, 0xea, 0xf1, 0xf1, 0xf1, 0xed, 0xf1, 0xf2, 0xf0, 0xfa, 0xfa, 0xf4, 0xed, 0xed, 0xf2, 0xea, 0xf1, 0xf2, 0xf1, 0xea, 0xf1, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xea, 0xf4, 0xf2, 0xf2, 0xf0, 0xf4, 0xe7, 0xeb, 0xe3, 0xd5, 0xd1, 0xd1, 0xd2, 0xd3, 0xd2, 0xd4, 0xd1, 0xd8, 0xc8, 0xe5, 0xeb, 0xf4, 0xea, 0xf1, 0xea, 0xe8, 0xea, 0xf2, 0xf2, 0xf2, 0xed, 0xf2, 0xf3, 0xff, 0x65, 0x74, 0x6d, 0x7b, 0x0d, 0x8c, 0x88, 0x7f, 0x7d, 0x71, 0x7c, 0xf6, 0xf3, 0xf0, 0xf2, 0xf0, 0xf2, 0xac, 0xf2, 0xea, 0xf4, 0xf5, 0xed, 0xfb, 0xac, 0xac, 0xff, 0x64, 0x34, 0x11, 0x1e, 0x13, 0x24, 0x64, 0xfa, 0xeb, 0xea, 0xf3, 0xff, 0xf2, 0xeb, 0xe9, 0xeb, 0xab, 0xf3, 0xf0, 0x61, 0xf8, 0x31, 0x31, 0x34, 0x24, 0x24, 0x15, 0x78, 0x77, 0x05, 0x75, 0x75, 0x71, 0x71, 0x71, 0x70, 0x6e, 0x6d, 0x6d, 0x6b, 0xfc, 0xf5, 0xec, 0xe3, 0xc5, 0xd1, 0xd2, 0xd6, 0xd2, 0xcc, 0xd8, 0xe3, 0xe5, 0xe1, 0xb2, 0xa4, 0xa7, 0xa7, 0xa7, 0xa4, 0xb4, 0xa5, 0xc4, 0xda, 0xba, 0xb4, 0xb7, 0xa3, 0xa9, 0xa4, 0xb8, 0xe5, 0xeb, 0xf3, 0xf0, 0xf3, 0xf0, 0xf3, 0xea, 0xeb, 0xec, 0xc1, 0xb2, 0xa4, 0xa3, 0xa2, 0xb4, 0xe1, 0xec, 0xf0, 0xf3, 0xac, 0xac, 0xab, 0xeb, 0xf4, 0xf4, 0xf1, 0xea, 0xf1, 0xed, 0xf1, 0xfb, 0xf9, 0x65, 0xf6, 0xea, 0xf6, 0xf6, 0xea, 0xf2, 0xea, 0xf2, 0xf1, 0xf1, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf4, 0xf9, 0xf0, 0xf4, 0xf0, 0xfb, 0xf3, 0xf0, 0xf0, 0xeb, 0xf1, 0xeb, 0xeb, 0xeb, 0xeb, 0xe1, 0xd3, 0xcc, 0xd6, 0xd2, 0xd4, 0xd2, 0xd4, 0xd1, 0xcc, 0xeb, 0xeb, 0xf4, 0xf4, 0xea, 0xeb, 0xea, 0xea, 0xff, 0xff, 0xf4, 0xf5, 0xf6, 0xf6, 0xf6, 0x5a, 0x6a, 0x70, 0x81, 0x7f, 0x8c, 0x7f, 0x12, 0x0a, 0x6e, 0x31, 0xf5, 0xeb, 0xf1, 0xf9, 0xf9, 0xf0, 0xf5, 0xf6, 0xf6, 0x65, 0xfa, 0xf0, 0xea, 0xac, 0xea, 0xfb, 0x63, 0x26, 0x92, 0x1e, 0x81, 0x2c, 0x64, 0xfa, 0xe8, 0xea, 0xac, 0xf3, 0x97, 0xe8, 0xec, 0xe9, 0xff, 0xf3, 0xf6, 0xbb, 0x9c, 0x6c, 0x01, 0x08, 0x7f, 0x7f, 0x11, 0x1f, 0x1e, 0x1f, 0x1e, 0x92, 0x18, 0x18, 0x19, 0x7d, 0x7b, 0x6e, 0x69, 0x68, 0x00, 0xe4, 0xf5, 0xde, 0xc6, 0xd4, 0xd7, 0xd4, 0xd4, 0xd2, 0xcf, 0xd8, 0xde, 0xda, 0xb2, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0xa2, 0xa1, 0xa2, 0xa7, 0xa6, 0xa6, 0xa7, 0xa4, 0xb8, 0xe3, 0xeb, 0xed, 0x64, 0xff, 0xff, 0xf3, 0xe8, 0xed, 0xdd, 0xa0, 0xa2, 0xa6, 0xa3, 0xa1, 0xc2, 0xec, 0xec, 0xf5, 0xea, 0xab, 0xab, 0xea, 0xf9, 0xf0, 0xf1, 0xf4, 0xea, 0xf1, 0xed, 0xf4, 0xf1, 0xf6, 0xdf, 0x7c, 0x04, 0x7c, 0xef, 0xf6, 0xac, 0xf2, 0xea, 0xe7, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xed, 0xf4, 0xea, 0xe7, 0xe7, 0xf5, 0xeb, 0xe6, 0xf1, 0xeb, 0xec, 0xe6, 0xec, 0xeb, 0xde, 0xcc, 0xd2, 0xd4, 0xd4, 0xd2, 0xd1, 0xd5, 0xd3, 0xeb, 0xf4, 0xf4, 0xf1, 0xea, 0xeb, 0xeb, 0xf2, 0xf9, 0xfb, 0xf5, 0xdf, 0x04, 0xae, 0x1b, 0x1b, 0x69, 0x07, 0x8b, 0x7f, 0x7f, 0x8c, 0x8e, 0x79, 0x6e, 0xf6, 0xeb, 0xab, 0xf2, 0xf4, 0xff, 0xff, 0x61, 0x22, 0x22, 0x5c, 0x64, 0xfb, 0xfb, 0xed, 0xff, 0x64, 0x59, 0x19, 0x18, 0x1e, 0x82, 0x50, 0x64, 0xf4, 0xeb, 0xea, 0xf3, 0xf3, 0xf3, 0xeb, 0xeb, 0xf1, 0xf3, 0xff, 0xe4, 0xf7, 0xb0, 0x6f, 0x01, 0x7e, 0x19, 0x18, 0x18, 0x11, 0x16, 0x11, 0x16, 0x18, 0x18, 0x18, 0x18, 0x92, 0x17, 0x08, 0x69, 0x03, 0x6c, 0xb0, 0xdf, 0xde, 0xd5, 0xd4, 0xd7, 0xcd, 0xd7, 0xd6, 0xd8, 0xd6, 0xe3, 0xd6, 0xa0, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa8, 0xa7, 0xa7, 0xa7, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xb4, 0xda, 0xf5, 0xe7, 0xe6, 0xfb, 0xea, 0xe6, 0xed, 0xe0, 0xb2, 0xb4, 0xa8, 0xa2, 0xa3, 0xa1, 0xe5, 0xe5, 0xde, 0xdd, 0xd9, 0xe3, 0xe8, 0xab, 0xf2, 0xf4, 0xea, 0xea, 0xf2, 0xeb, 0xf0, 0xea, 0xf6, 0xc3, 0x96, 0x96, 0x96, 0x96, 0x96, 0xee, 0xf6, 0xac, 0xf0, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xea, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xac, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xe8, 0xeb, 0xf5, 0xec, 0xeb, 0xe6, 0xec, 0xf0, 0xf1, 0xea, 0xf0, 0xe8, 0xf1, 0xec, 0xe5, 0xd3, 0xd2, 0xd2, 0xd6, 0xd4, 0xd1, 0xd1, 0xd8, 0xed, 0xf1, 0xf4, 0xf4, 0xf2, 0xea, 0xea, 0xf4, 0xf0, 0xf3, 0xf5, 0xb0, 0x96, 0x68, 0x00, 0x01, 0x6b, 0x78, 0x8b, 0x89, 0x7f, 0x8c, 0x7f, 0x78, 0x74, 0xf6, 0xab, 0xab, 0xf2, 0xf2, 0xff, 0x65, 0x54, 0x08, 0x0a, 0x1c, 0x60, 0xff, 0x65, 0x64, 0x64, 0x5b, 0x25, 0x18, 0x1e, 0x18, 0x1d, 0x5f, 0x64, 0xf1, 0xeb, 0xeb, 0xf3, 0xff, 0xf3, 0xea, 0xeb, 0xf4, 0xf3, 0xf6, 0xce, 0xae, 0xb0, 0x6f, 0x71, 0x0e, 0x18, 0x12, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x12, 0x12, 0x16, 0x16, 0x15, 0x71, 0x73, 0xfe, 0xee, 0x96, 0xce, 0xe9, 0xd8, 0xd1, 0xd4, 0xd7, 0xd4, 0xd6, 0xd8, 0xd1, 0xe0, 0xc2, 0xa1, 0xa6, 0xa6, 0xa7, 0xa6, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa6, 0xa6, 0xa6, 0xa7, 0xa8, 0xa6, 0xa4, 0xa5, 0xe0, 0xec, 0xed, 0xeb, 0xeb, 0xec, 0xe3, 0xb6, 0xb4, 0xa4, 0xa6, 0xa3, 0xa3, 0xaa, 0xc6, 0xb4, 0x9f, 0x9f, 0x9d, 0x9f, 0xd5, 0xf5, 0xe6, 0xed, 0xf2, 0xf4, 0xf1, 0xf1, 0xf1, 0xf5, 0xdf, 0x9c, 0x96, 0xad, 0x99, 0x99, 0x96, 0xae, 0xdf, 0xf6, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xac, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xac, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xe8, 0xec, 0xe0, 0xbf, 0xc1, 0xe1, 0xec, 0xe8, 0xf5, 0xf2, 0xf1, 0xf1, 0xfb, 0xea, 0xf1, 0xeb, 0xe1, 0xcc, 0xd4, 0xd4, 0xd6, 0xd1, 0xcc, 0xdc, 0xec, 0xec, 0xf9, 0xf3, 0xf2, 0xea, 0xf1, 0xfa, 0xf3, 0xfb, 0x97, 0xf7, 0x9a, 0x6d, 0x21, 0x7b, 0x6d, 0x08, 0x90, 0x7f, 0x8e, 0x0d, 0x0d, 0x08, 0x7a, 0xf6, 0xab, 0xf0, 0xea, 0xea, 0xf2, 0x65, 0x5f, 0x80, 0x20, 0x16, 0x15, 0x45, 0x60, 0x59, 0x4d, 0x1f, 0x1e, 0x1e, 0x1f, 0x0d, 0x45, 0x64, 0xfa, 0xf1, 0xeb, 0xf1, 0xf3, 0xff, 0xf3, 0xf1, 0xf4, 0xf9, 0xf3, 0xf6, 0x7c, 0xae, 0x02, 0x6f, 0x07, 0x15, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x13, 0x01, 0x0f, 0x65, 0xef, 0xfd, 0xf6, 0xe6, 0xe3, 0xd5, 0xd1, 0xd7, 0xd4, 0xd7, 0xd6, 0xda, 0xda, 0xbc, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa8, 0xa4, 0xa7, 0xa6, 0xa7, 0xa8, 0xa8, 0xa4, 0xa1, 0xc2, 0xde, 0xe5, 0xe3, 0xc4, 0xa5, 0xb4, 0xa4, 0xa4, 0xa3, 0xa9, 0xa3, 0xa1, 0xa1, 0xa1, 0xb7, 0xb4, 0xa8, 0xa0, 0xa0, 0xe8, 0xf5, 0xea, 0xf2, 0xea, 0xf1, 0xea, 0xf1, 0xf6, 0xc3, 0x96, 0x9a, 0x99, 0xad, 0xad, 0xad, 0x96, 0xc3, 0xf6, 0xea, 0xf2, 0xea, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xea, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xe7, 0xed, 0xe1, 0xc1, 0xbf, 0xbf, 0xbf, 0xde, 0xec, 0xe6, 0xed, 0xf2, 0xf2, 0xf2, 0xf0, 0xe7, 0xec, 0xe5, 0xcf, 0xd1, 0xd2, 0xd2, 0xd5, 0xd1, 0xd5, 0xec, 0xeb, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf9, 0xac, 0xf5, 0xee, 0x9c, 0x6f, 0x1c, 0x1c, 0x08, 0x75, 0x81, 0x13, 0x11, 0x0d, 0x13, 0x77, 0x7a, 0xf6, 0xf2, 0xf4, 0xf1, 0xeb, 0xf1, 0xf3, 0x63, 0x21, 0x0d, 0x1e, 0x1e, 0x19, 0x1f, 0x19, 0x20, 0x1e, 0x1e, 0x1e, 0x19, 0x26, 0x63, 0x65, 0xf9, 0xed, 0xeb, 0xec, 0xf4, 0xfb, 0xf9, 0xf4, 0xfb, 0xf0, 0xed, 0xf5, 0xee, 0xae, 0xf7, 0x01, 0x7b, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x14, 0x82, 0x6d, 0x31, 0x65, 0xf5, 0xf6, 0xf1, 0xed, 0xe8, 0xdc, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xda, 0xb9, 0xa2, 0xa7, 0xa8, 0xa6, 0xa8, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xb7, 0xa6, 0xa7, 0xa8, 0xa3, 0xa8, 0xa6, 0xa4, 0xa1, 0xa2, 0xb7, 0xa5, 0xb4, 0xa4, 0xa4, 0xa4, 0xa9, 0xa3, 0xa3, 0xa3, 0xa9, 0xa3, 0xa2, 0xa7, 0xa3, 0xa2, 0xa2, 0xb4, 0xe5, 0xac, 0xea, 0xf2, 0xed, 0xf1, 0xf1, 0xf1, 0xf6, 0xee, 0x99, 0xad, 0x99, 0xad, 0xad, 0xad, 0x96, 0xc3, 0xf6, 0xed, 0xe7, 0xed, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xea, 0xea, 0xe1, 0xc5, 0xda, 0xd7, 0xca, 0xc5, 0xde, 0xf5, 0xf1, 0xe9, 0xf4, 0xf2, 0xf1, 0xf0, 0xe9, 0xec, 0xdd, 0xc9, 0xd6, 0xd6, 0xd1, 0xd1, 0xcc, 0xe9, 0xec, 0xf5, 0xf1, 0xf5, 0xea, 0xf4, 0xf9, 0xf3, 0xf0, 0xab, 0xf6, 0xfc, 0x22, 0x1c, 0x7e, 0x08, 0x70, 0x78, 0x7f, 0x0d, 0x11, 0x0d, 0x77, 0x09, 0xf5, 0xf9, 0xf9, 0xf1, 0xf1, 0xeb, 0xf3, 0x65, 0x5c, 0x7e, 0x19, 0x1e, 0x2e, 0x1e, 0x20, 0x1e, 0x1e, 0x1e, 0x18, 0x29, 0x62, 0xff, 0xf3, 0xf0, 0xec, 0xe6, 0xf0, 0xe6, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xed, 0xe6, 0xe0, 0xb3, 0x6c, 0x03, 0x0e, 0x13, 0x16, 0x14, 0x16, 0x14, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x18, 0x78, 0x6d, 0x61, 0xed, 0xea, 0xf1, 0xab, 0xac, 0xe9, 0xe0, 0xd1, 0xd4, 0xd7, 0xd4, 0xd6, 0xd7, 0xd7, 0xbe, 0xa2, 0xa7, 0xa6, 0xa7, 0xa6, 0xa6, 0xa7, 0xa8, 0xa6, 0xa8, 0xa7, 0xa6, 0xa6, 0xa7, 0xa7, 0xa8, 0xa3, 0xa8, 0xa8, 0xa7, 0xa6, 0xa4, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa3, 0xa8, 0xa3, 0xa9, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa5, 0xe8, 0xed, 0xea, 0xf2, 0xed, 0xf2, 0xec, 0xf1, 0xf6, 0xce, 0x96, 0x9a, 0x99, 0x9c, 0x99, 0xad, 0x96, 0xdb, 0xf6, 0xf2, 0xea, 0xf2, 0xea, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xea, 0xed, 0xe3, 0xd3, 0xda, 0xd4, 0xd7, 0xd1, 0xc5, 0xde, 0xeb, 0xeb, 0xeb, 0xe7, 0xf1, 0xf2, 0xe8, 0xeb, 0xe1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xc9, 0xe1, 0xec, 0xf1, 0xec, 0xf2, 0xea, 0xf4, 0xf4, 0xf9, 0xea, 0xe7, 0xab, 0x65, 0x65, 0x93, 0x05, 0x6a, 0x75, 0x19, 0x1f, 0x18, 0x20, 0x92, 0x1d, 0x07, 0xfa, 0xfa, 0xf9, 0xfa, 0xeb, 0xeb, 0xeb, 0xe7, 0x64, 0x50, 0x21, 0x16, 0x1e, 0x1e, 0x2b, 0x1e, 0x20, 0x92, 0x2c, 0x62, 0x65, 0xf4, 0xf4, 0xea, 0xf0, 0xec, 0xf4, 0xf5, 0xf1, 0xe6, 0xea, 0xf4, 0xf0, 0xf5, 0xc3, 0xf7, 0xce, 0x06, 0x05, 0x1d, 0x11, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x18, 0x90, 0x01, 0x7a, 0xf6, 0xe7, 0xeb, 0xe7, 0xe8, 0xab, 0xeb, 0xe0, 0xd1, 0xd6, 0xd4, 0xd6, 0xd6, 0xd6, 0xda, 0xc0, 0xa2, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa6, 0xa6, 0xa7, 0xa6, 0xa7, 0xa8, 0xa7, 0xa6, 0xa7, 0xa3, 0xa7, 0xa9, 0xa3, 0xa8, 0xa8, 0xa7, 0xa6, 0xa6, 0xa6, 0xa3, 0xa7, 0xa7, 0xa3, 0xa7, 0xa3, 0xa6, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xbf, 0xf5, 0xea, 0xf2, 0xed, 0xf2, 0xed, 0xf1, 0xed, 0xf1, 0xe4, 0xb0, 0x96, 0xad, 0x96, 0xad, 0x96, 0xb3, 0xe6, 0xf3, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xeb, 0xe8, 0xdd, 0xcc, 0xda, 0xd6, 0xd6, 0xd5, 0xc9, 0xdd, 0xe9, 0xeb, 0xec, 0xf1, 0xf0, 0xeb, 0xeb, 0xe5, 0xd3, 0xd1, 0xd2, 0xd1, 0xd4, 0xc9, 0xd3, 0xe5, 0xec, 0xf1, 0xf5, 0xe7, 0xea, 0xf4, 0xf2, 0xf0, 0xf1, 0xac, 0xf0, 0x64, 0x21, 0x05, 0x6a, 0x7b, 0x15, 0x11, 0x11, 0x16, 0x12, 0x19, 0x07, 0x2a, 0xf6, 0xf9, 0xf0, 0xf4, 0xeb, 0xea, 0xf0, 0xe7, 0x65, 0x5f, 0x2c, 0x25, 0x15, 0x10, 0x19, 0x93, 0x45, 0x64, 0x65, 0xf9, 0xeb, 0xe7, 0xed, 0xf2, 0xf6, 0xf6, 0xf5, 0xeb, 0xed, 0xed, 0xea, 0xf6, 0xe1, 0xae, 0xae, 0x00, 0x22, 0x1a, 0x15, 0x11, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x7e, 0x6e, 0x31, 0xf6, 0xe8, 0xeb, 0xf1, 0xea, 0xeb, 0xeb, 0xde, 0xd1, 0xda, 0xd2, 0xda, 0xd2, 0xda, 0xd7, 0xc7, 0xa2, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa8, 0xa3, 0xa9, 0xa3, 0xa8, 0xa3, 0xa7, 0xa3, 0xa7, 0xa3, 0xa6, 0xa7, 0xa6, 0xa6, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xb6, 0xe3, 0xf5, 0xf2, 0xed, 0xea, 0xf4, 0xea, 0xf1, 0xea, 0xf1, 0xf6, 0xef, 0xae, 0x96, 0x96, 0x99, 0x04, 0xe7, 0xf5, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe7, 0xec, 0xe5, 0xdd, 0xd1, 0xd5, 0xd0, 0xd6, 0xd6, 0xc9, 0xd8, 0xe5, 0xeb, 0xe8, 0xf2, 0xeb, 0xeb, 0xe5, 0xd8, 0xc9, 0xd6, 0xcd, 0xd0, 0xcb, 0xcc, 0xcc, 0xe2, 0xec, 0xe9, 0xea, 0xea, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xf0, 0x64, 0x2a, 0x71, 0x6a, 0x7b, 0x90, 0x11, 0x12, 0x12, 0x12, 0x18, 0x1a, 0x6f, 0xce, 0xf6, 0xf2, 0xf4, 0xf2, 0xea, 0xac, 0xed, 0xf3, 0xfb, 0xf6, 0x63, 0x5c, 0x5c, 0x5f, 0x63, 0xf6, 0xac, 0xe7, 0xf4, 0xf1, 0xed, 0xf2, 0xf3, 0xf8, 0xc3, 0xe2, 0xf5, 0xdf, 0xde, 0xf6, 0xe2, 0xb0, 0x96, 0xad, 0x6c, 0x76, 0x93, 0x7d, 0x13, 0x11, 0x91, 0x12, 0x16, 0x16, 0x16, 0x16, 0x12, 0x12, 0x16, 0x15, 0x71, 0x73, 0x61, 0xed, 0xf0, 0xf1, 0xf4, 0xf1, 0xeb, 0xe9, 0xd8, 0xd2, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xda, 0xd0, 0xb7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa3, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa3, 0xa3, 0xa2, 0xb4, 0xde, 0xf5, 0xf1, 0xf1, 0xf3, 0xea, 0xf4, 0xed, 0xf1, 0xed, 0xf1, 0xac, 0xf6, 0xe7, 0xdb, 0xdb, 0xe2, 0xf6, 0xf2, 0xac, 0xf2, 0xac, 0xf0, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xea, 0xf1, 0xf5, 0xe9, 0xec, 0xe5, 0xdc, 0xd3, 0xd6, 0xd6, 0xd4, 0xd4, 0xcc, 0xcc, 0xe3, 0xf5, 0xe7, 0xec, 0xe9, 0xe5, 0xd3, 0xd2, 0xd4, 0xd4, 0xd0, 0xd0, 0xd5, 0xcc, 0xcc, 0xdd, 0xeb, 0xeb, 0xec, 0xf2, 0xf9, 0xf4, 0xf9, 0xf1, 0xff, 0xff, 0x32, 0x05, 0x69, 0x76, 0x90, 0x8e, 0x16, 0x14, 0x14, 0x8e, 0x15, 0x72, 0x9c, 0xe2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xea, 0xea, 0xed, 0xab, 0xed, 0x65, 0x64, 0x64, 0xf5, 0xab, 0xe8, 0xeb, 0xf4, 0xf1, 0xed, 0xf6, 0xf8, 0x96, 0x96, 0xae, 0xb3, 0x9d, 0xaf, 0xb5, 0xb0, 0x98, 0x99, 0x67, 0x74, 0x8d, 0x7d, 0x15, 0x7f, 0x0d, 0x13, 0x18, 0x18, 0x12, 0x18, 0x12, 0x16, 0x16, 0x13, 0x7d, 0x69, 0x22, 0xf6, 0xe6, 0xf1, 0xf1, 0xf4, 0xf1, 0xeb, 0xe5, 0xcc, 0xd8, 0xd2, 0xda, 0xcf, 0xda, 0xd5, 0xda, 0xda, 0xb9, 0xa6, 0xa6, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa8, 0xa3, 0xa8, 0xa3, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa6, 0xa8, 0xa1, 0xb4, 0xd8, 0xec, 0xec, 0xf2, 0xf4, 0xf4, 0xf2, 0xea, 0xeb, 0xeb, 0xea, 0xf4, 0xf1, 0xf5, 0xe7, 0xf6, 0xf6, 0xf6, 0xe7, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf2, 0xf1, 0xf6, 0xf5, 0xed, 0xed, 0xe6, 0xf1, 0xf1, 0xe9, 0xf5, 0xe3, 0xd9, 0xd1, 0xd1, 0xd7, 0xd0, 0xd0, 0xc9, 0xdd, 0xe3, 0xe9, 0xeb, 0xdc, 0xcf, 0xd3, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd6, 0xd1, 0xc5, 0xca, 0xde, 0xe9, 0xfa, 0xec, 0xf9, 0xfa, 0xfb, 0xe7, 0x64, 0x45, 0x1c, 0x69, 0x70, 0x15, 0x8b, 0x8c, 0x12, 0x16, 0x16, 0x19, 0x74, 0x69, 0xf7, 0xee, 0xce, 0xc3, 0xb5, 0xfc, 0xed, 0xf5, 0xeb, 0xed, 0xf5, 0xf6, 0xf9, 0xf3, 0xed, 0xf6, 0xf5, 0xf5, 0xf6, 0xf4, 0xf5, 0xe6, 0x02, 0x98, 0x98, 0x98, 0x98, 0xa5, 0xba, 0x9d, 0x9b, 0x99, 0x00, 0x77, 0x17, 0x13, 0x11, 0x12, 0x16, 0x0d, 0x79, 0x7d, 0x15, 0x15, 0x11, 0x16, 0x16, 0x16, 0x8f, 0x70, 0x6c, 0x61, 0xf0, 0xeb, 0xe9, 0xec, 0xe7, 0xec, 0xe9, 0xd9, 0xd4, 0xd6, 0xd6, 0xd6, 0xda, 0xd1, 0xda, 0xd1, 0xda, 0xbf, 0xa6, 0xa4, 0xa7, 0xa8, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa6, 0xa6, 0xa6, 0xa7, 0xa6, 0xa9, 0xa3, 0xa2, 0xb6, 0xde, 0xf5, 0xec, 0xf1, 0xea, 0xea, 0xf4, 0xf5, 0xf5, 0xed, 0xac, 0xec, 0xf1, 0xf0, 0xf1, 0xac, 0xea, 0xf1, 0xf1, 0xea, 0xf2, 0xea, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xe7, 0xf5, 0xce, 0xb5, 0xb5, 0xdb, 0xec, 0xeb, 0xe6, 0xf1, 0xf1, 0xeb, 0xe9, 0xe0, 0xd5, 0xd1, 0xd4, 0xd6, 0xd1, 0xcc, 0xcc, 0xde, 0xde, 0xd3, 0xd2, 0xd1, 0xd4, 0xd1, 0xd0, 0xd1, 0xd0, 0xd1, 0xd1, 0xd4, 0xd0, 0xc5, 0xd3, 0xe0, 0xe9, 0xed, 0xf1, 0xf0, 0xe7, 0x65, 0x4d, 0x2f, 0x70, 0x70, 0x0e, 0x8b, 0x8e, 0x8c, 0x16, 0x16, 0x13, 0x7e, 0x6b, 0x66, 0x99, 0x96, 0x9b, 0x96, 0xae, 0xfc, 0xe6, 0xe6, 0xe9, 0xdb, 0xce, 0xf0, 0xf6, 0xe4, 0xd9, 0xdb, 0xde, 0xbb, 0xb5, 0xb5, 0xb1, 0xba, 0x9d, 0x98, 0x98, 0x98, 0x98, 0x9b, 0x98, 0x96, 0x6a, 0x07, 0x8f, 0x0d, 0x8e, 0x8c, 0x11, 0x12, 0x11, 0x11, 0x0a, 0x78, 0x79, 0x82, 0x15, 0x17, 0x17, 0x71, 0x69, 0x1b, 0xf6, 0xac, 0xe5, 0xec, 0xe7, 0xfa, 0xec, 0xe2, 0xd3, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xca, 0xa4, 0xa7, 0xa6, 0xa6, 0xa8, 0xa3, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa3, 0xa2, 0xa5, 0xe0, 0xec, 0xec, 0xf4, 0xf0, 0xed, 0xe8, 0xf5, 0xe3, 0xd3, 0xc1, 0xd9, 0xe8, 0xf1, 0xf5, 0xf1, 0xe7, 0xea, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xea, 0xf1, 0xea, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf6, 0xce, 0x96, 0xad, 0x98, 0x9c, 0xce, 0xf6, 0xf0, 0xe7, 0xf1, 0xf1, 0xeb, 0xec, 0xe5, 0xde, 0xd1, 0xc9, 0xd6, 0xd6, 0xd1, 0xc9, 0xd2, 0xd2, 0xd4, 0xd6, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd4, 0xcb, 0xd1, 0xd1, 0xd4, 0xcb, 0xc6, 0xd0, 0xe0, 0xe9, 0xeb, 0xea, 0xff, 0x5b, 0x33, 0x1c, 0x6e, 0x78, 0x8b, 0x81, 0x12, 0x8c, 0x11, 0x7f, 0x19, 0x0b, 0x6d, 0x68, 0x95, 0x9c, 0x9a, 0x9c, 0xaf, 0xf7, 0xb1, 0xb1, 0x9d, 0x98, 0xb1, 0xd3, 0xaf, 0x9b, 0xb2, 0xba, 0x9b, 0xaf, 0x9d, 0x9d, 0xb2, 0xbf, 0x9d, 0xb1, 0xbb, 0x9b, 0x99, 0x68, 0x01, 0x0b, 0x17, 0x11, 0x8e, 0x8c, 0x89, 0x8c, 0x8e, 0x12, 0x12, 0x13, 0x90, 0x0a, 0x75, 0x71, 0x6f, 0x6d, 0x66, 0x6d, 0xfe, 0x65, 0xfb, 0xed, 0xe7, 0xf1, 0xf5, 0xe5, 0xd8, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xb9, 0xa2, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa4, 0xcb, 0xf6, 0xe8, 0xfb, 0xf9, 0xf4, 0xea, 0xec, 0xbf, 0x9d, 0x9b, 0xa0, 0x9d, 0xb6, 0xe5, 0xec, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xac, 0xea, 0xf2, 0xf6, 0xb5, 0x96, 0x95, 0xaf, 0x9a, 0xb1, 0xf6, 0xe7, 0xf4, 0xf0, 0xf1, 0xf1, 0xe7, 0xeb, 0xe9, 0xe3, 0xdc, 0xc5, 0xd2, 0xd6, 0xd4, 0xd4, 0xd7, 0xcd, 0xd6, 0xd0, 0xd1, 0xd1, 0xd4, 0xd1, 0xd1, 0xd6, 0xd1, 0xd0, 0xd1, 0xcb, 0xd7, 0xcb, 0xc8, 0xd8, 0xe3, 0xe8, 0xf6, 0x60, 0x39, 0x30, 0x71, 0x70, 0x82, 0x0d, 0x7f, 0x7f, 0x11, 0x7f, 0x12, 0x8f, 0x1a, 0x70, 0x69, 0x95, 0x9a, 0xae, 0xb0, 0x9d, 0x9d, 0xa0, 0xb1, 0x9d, 0x9d, 0x9b, 0x9d, 0x9e, 0x9e, 0xb6, 0x9e, 0x9e, 0x9f, 0x9e, 0x9f, 0xba, 0xb1, 0xb3, 0xee, 0x73, 0x69, 0x74, 0x8d, 0x15, 0x7f, 0x14, 0x8c, 0x14, 0x88, 0x8e, 0x8e, 0x8c, 0x8e, 0x8e, 0x0d, 0x11, 0x15, 0x80, 0x69, 0x66, 0x96, 0x74, 0x39, 0x26, 0x3e, 0x5f, 0x64, 0xf5, 0xe5, 0xde, 0xc7, 0xd7, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xc0, 0xa2, 0xa7, 0xa7, 0xa3, 0xa8, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa3, 0xa8, 0xb4, 0xda, 0xed, 0xf2, 0xfb, 0xf0, 0xed, 0xeb, 0xbf, 0x9b, 0xa1, 0xa9, 0xa8, 0xb7, 0xa0, 0xb8, 0xeb, 0xeb, 0xeb, 0xea, 0xf2, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xea, 0xea, 0xea, 0xf2, 0xf6, 0xdb, 0x99, 0x98, 0x96, 0xae, 0xce, 0xf6, 0xe7, 0xf2, 0xe7, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xeb, 0xe9, 0xe0, 0xd3, 0xca, 0xd4, 0xd4, 0xcd, 0xd4, 0xd4, 0xd1, 0xd2, 0xd1, 0xd2, 0xd1, 0xd1, 0xd1, 0xd4, 0xd2, 0xd1, 0xd3, 0xd2, 0xd1, 0xd1, 0xcc, 0xc4, 0xe0, 0xe5, 0x5f, 0x53, 0x4d, 0x8d, 0x6b, 0x78, 0x13, 0x8c, 0x8c, 0x89, 0x12, 0x16, 0x12, 0x13, 0x17, 0x74, 0x69, 0x66, 0x95, 0x9d, 0x9e, 0x9f, 0x9f, 0x9e, 0x9f, 0x9d, 0xaf, 0x9b, 0xa0, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0xb1, 0x9a, 0x68, 0x6b, 0x06, 0x6d, 0x7b, 0x90, 0x0d, 0x16, 0x8c, 0x14, 0x88, 0x8c, 0x8c, 0x11, 0x8e, 0x89, 0x89, 0x12, 0x11, 0x0e, 0x0b, 0x6f, 0x6d, 0x03, 0x27, 0x58, 0x25, 0x10, 0x1c, 0x5c, 0xf6, 0xe1, 0xc7, 0xd7, 0xd4, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd6, 0xda, 0xd0, 0xa6, 0xa4, 0xa6, 0xa7, 0xa8, 0xa6, 0xa8, 0xa6, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa2, 0xc2, 0xea, 0xea, 0xed, 0xeb, 0xf5, 0xc1, 0x9e, 0xa6, 0xa9, 0xa8, 0xa8, 0xa6, 0xb7, 0x9e, 0xc1, 0xe8, 0xeb, 0xeb, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xab, 0xf2, 0xea, 0xf1, 0xf6, 0xdf, 0xee, 0xc3, 0xef, 0x97, 0xeb, 0xe8, 0xec, 0xeb, 0xf4, 0xeb, 0xf0, 0xe7, 0xf0, 0xf0, 0xf1, 0xe9, 0xe3, 0xd3, 0xd5, 0xd6, 0xd1, 0xd6, 0xd1, 0xd4, 0xd1, 0xd2, 0xd0, 0xd1, 0xd1, 0xd2, 0xd1, 0xd1, 0xd2, 0xcf, 0xd2, 0xd1, 0xd2, 0xcf, 0xd1, 0xc5, 0xdb, 0x63, 0x5e, 0x56, 0x74, 0x6b, 0x7e, 0x11, 0x12, 0x12, 0x86, 0x8c, 0x12, 0x12, 0x13, 0x7d, 0x01, 0x74, 0x06, 0x6c, 0xad, 0xae, 0x9b, 0x9d, 0xaf, 0xaf, 0xb0, 0xaf, 0x9b, 0xaf, 0x9e, 0x9d, 0x9d, 0x9d, 0xb0, 0x9d, 0x9c, 0x66, 0x00, 0x71, 0x0b, 0x8f, 0x75, 0x75, 0x8f, 0x81, 0x8e, 0x14, 0x12, 0x14, 0x8c, 0x12, 0x12, 0x11, 0x86, 0x16, 0x12, 0x15, 0x76, 0x6e, 0x01, 0x39, 0x5d, 0x5d, 0x3c, 0x2b, 0x20, 0x10, 0x21, 0xf0, 0xd5, 0xcf, 0xd9, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xd6, 0xd7, 0xda, 0xb9, 0xa4, 0xa6, 0xa6, 0xa6, 0xa7, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa1, 0xc4, 0xe3, 0xe9, 0xeb, 0xcb, 0xa0, 0xa6, 0xb7, 0xa8, 0xa8, 0xa7, 0xa8, 0xa8, 0xa6, 0xa0, 0xba, 0xe0, 0xeb, 0xf2, 0xf2, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xea, 0xf0, 0xf2, 0xe6, 0xf4, 0xf6, 0xf5, 0xf6, 0xf5, 0xe8, 0xe8, 0xeb, 0xe5, 0xe5, 0xe5, 0xe9, 0xec, 0xe8, 0xe6, 0xf0, 0xf0, 0xf1, 0xe9, 0xe5, 0xd3, 0xcc, 0xd8, 0xd1, 0xd5, 0xd2, 0xd4, 0xd1, 0xd2, 0xd1, 0xd4, 0xd1, 0xd4, 0xd1, 0xd2, 0xd0, 0xd0, 0xcd, 0xd4, 0xd2, 0xcf, 0xc8, 0x5a, 0x60, 0x5d, 0x08, 0x74, 0x1a, 0x7b, 0x1f, 0x12, 0x12, 0x16, 0x8c, 0x8c, 0x81, 0x81, 0x71, 0x75, 0x1d, 0x93, 0x0b, 0x74, 0x00, 0xad, 0xad, 0x98, 0x96, 0x99, 0x95, 0xad, 0x9a, 0x99, 0x9a, 0x9a, 0xad, 0x9a, 0x66, 0x6a, 0x03, 0x7b, 0x17, 0x13, 0x90, 0x81, 0x75, 0x78, 0x90, 0x7f, 0x12, 0x12, 0x8c, 0x12, 0x12, 0x12, 0x16, 0x8c, 0x16, 0x0d, 0x78, 0x6b, 0x6b, 0x2c, 0x58, 0x4f, 0x55, 0x58, 0x2e, 0x2b, 0x10, 0x27, 0xdf, 0xda, 0xd7, 0xd8, 0xdd, 0xd6, 0xd7, 0xd6, 0xd4, 0xd4, 0xda, 0xd7, 0xd6, 0xd4, 0xd4, 0xd7, 0xc6, 0xa1, 0xa7, 0xa2, 0xa7, 0xa6, 0xa6, 0xa6, 0xa7, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa9, 0xa8, 0xb7, 0xb4, 0xb6, 0xbf, 0xc6, 0xa5, 0xa7, 0xb7, 0xa3, 0xb7, 0xa7, 0xa7, 0xa7, 0xa9, 0xa8, 0xa1, 0xa0, 0xb8, 0xab, 0xed, 0xf2, 0xed, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf1, 0xfb, 0xf0, 0xf1, 0xf4, 0xf1, 0xeb, 0xeb, 0xe1, 0xd9, 0xcc, 0xd3, 0xd8, 0xdd, 0xe1, 0xe5, 0xeb, 0xf1, 0xf1, 0xe7, 0xeb, 0xec, 0xe3, 0xd9, 0xd8, 0xc9, 0xd6, 0xd4, 0xd2, 0xd4, 0xd1, 0xd4, 0xd1, 0xd2, 0xd1, 0xd2, 0xd0, 0xd0, 0xc7, 0xd0, 0xcd, 0xd2, 0xc9, 0xdd, 0xfa, 0x34, 0x20, 0x05, 0x53, 0x5d, 0x05, 0x78, 0x19, 0x12, 0x12, 0x8c, 0x8e, 0x90, 0x71, 0x78, 0x1f, 0x92, 0x13, 0x19, 0x1d, 0x1c, 0x74, 0x68, 0x6d, 0x70, 0x72, 0x05, 0x01, 0x70, 0x6e, 0x01, 0x72, 0x6d, 0x69, 0x7a, 0x0c, 0x1d, 0x13, 0x16, 0x12, 0x12, 0x92, 0x85, 0x75, 0x7d, 0x13, 0x8e, 0x8e, 0x8c, 0x8e, 0x8c, 0x12, 0x12, 0x11, 0x0d, 0x75, 0x6d, 0x6b, 0x0c, 0x60, 0x49, 0x3c, 0x4f, 0x51, 0x42, 0x30, 0x1c, 0x23, 0xba, 0xbe, 0xbe, 0xc0, 0xc0, 0xc4, 0xc6, 0xcb, 0xd0, 0xd0, 0xd4, 0xd7, 0xd7, 0xda, 0xda, 0xd7, 0xd7, 0xb7, 0xb7, 0xa7, 0xa7, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa8, 0xa7, 0xa4, 0xa2, 0xa1, 0xa6, 0xa9, 0xa3, 0xa9, 0xa8, 0xa7, 0xa7, 0xa7, 0xa3, 0xa3, 0xb7, 0xa0, 0xbd, 0xeb, 0xf4, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xea, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf9, 0xf4, 0xf9, 0xf4, 0xf1, 0xf0, 0xeb, 0xe3, 0xd3, 0xd8, 0xda, 0xda, 0xd6, 0xcb, 0xd1, 0xdd, 0xe1, 0xeb, 0xeb, 0xe7, 0xf1, 0xe8, 0xeb, 0xe1, 0xcc, 0xda, 0xd6, 0xd4, 0xd4, 0xd2, 0xd4, 0xd2, 0xd1, 0xd4, 0xd2, 0xd4, 0xd2, 0xd1, 0xd0, 0xcd, 0xd0, 0xd2, 0xcf, 0xd3, 0xfa, 0x39, 0x20, 0x4a, 0x55, 0x4f, 0x24, 0x6e, 0x81, 0x0d, 0x16, 0x16, 0x18, 0x78, 0x75, 0x90, 0x92, 0x16, 0x1e, 0x16, 0x18, 0x1d, 0x77, 0x76, 0x7e, 0x17, 0x15, 0x15, 0x15, 0x0e, 0x17, 0x17, 0x1d, 0x0c, 0x6b, 0x0b, 0x1d, 0x0d, 0x16, 0x16, 0x1e, 0x16, 0x11, 0x1d, 0x75, 0x78, 0x7f, 0x11, 0x8c, 0x89, 0x89, 0x89, 0x88, 0x8e, 0x8b, 0x75, 0x6e, 0x6b, 0x72, 0x45, 0x60, 0x60, 0x50, 0x34, 0x34, 0x34, 0x22, 0x23, 0xc1, 0xbf, 0xbe, 0xbe, 0xbe, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbe, 0xbf, 0xc0, 0xc0, 0xc2, 0xc0, 0xc7, 0xbe, 0xa4, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa3, 0xb7, 0xa8, 0xa6, 0xa8, 0xa7, 0xb7, 0xa9, 0xa8, 0xa8, 0xa9, 0xa9, 0xa8, 0xa7, 0xa7, 0xa8, 0xa9, 0xa0, 0xba, 0xe3, 0xed, 0xea, 0xf4, 0xea, 0xf4, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf9, 0xf1, 0xf9, 0xf1, 0xf4, 0xf1, 0xe0, 0xd3, 0xdc, 0xd6, 0xd7, 0xda, 0xda, 0xda, 0xd6, 0xd5, 0xde, 0xe5, 0xeb, 0xe9, 0xe6, 0xe9, 0xe5, 0xde, 0xc9, 0xd4, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd1, 0xd2, 0xd0, 0xd2, 0xd1, 0xcf, 0xd1, 0xd1, 0xd4, 0xca, 0xd0, 0xcc, 0xdd, 0x5f, 0x53, 0x4f, 0x4b, 0x4a, 0x55, 0x78, 0x71, 0x15, 0x16, 0x16, 0x86, 0x75, 0x7d, 0x1f, 0x16, 0x1e, 0x14, 0x1e, 0x18, 0x8b, 0x71, 0x82, 0x90, 0x11, 0x12, 0x12, 0x12, 0x8c, 0x11, 0x8c, 0x11, 0x17, 0x01, 0x71, 0x19, 0x12, 0x1e, 0x16, 0x16, 0x16, 0x12, 0x13, 0x8b, 0x78, 0x0a, 0x0d, 0x89, 0x89, 0x88, 0x86, 0x88, 0x8b, 0x76, 0x6b, 0x6b, 0x01, 0x30, 0x26, 0x45, 0xfa, 0xfd, 0x23, 0x23, 0xf8, 0xc5, 0xc8, 0xcb, 0xd4, 0xca, 0xd0, 0xc7, 0xc7, 0xcb, 0xd0, 0xc6, 0xc6, 0xc6, 0xc2, 0xc0, 0xbf, 0xbe, 0xbe, 0xbc, 0xb9, 0xbc, 0xb7, 0xa4, 0xa6, 0xa7, 0xa7, 0xa7, 0xa3, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa8, 0xa6, 0xa6, 0xa7, 0xa9, 0xa7, 0xa8, 0xa8, 0xa8, 0xa9, 0xa3, 0xa9, 0xa8, 0xa6, 0xa7, 0xa6, 0xa0, 0xc2, 0xe9, 0xf5, 0xf1, 0xf2, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xea, 0xf2, 0xf1, 0xf1, 0xf1, 0xeb, 0xde, 0xd8, 0xd8, 0xda, 0xda, 0xd7, 0xda, 0xd7, 0xda, 0xd5, 0xd8, 0xdc, 0xe0, 0xe9, 0xe9, 0xe9, 0xeb, 0xe1, 0xcc, 0xd8, 0xd4, 0xd6, 0xd1, 0xd2, 0xcb, 0xd4, 0xd1, 0xd2, 0xd4, 0xd2, 0xd2, 0xd2, 0xd2, 0xcd, 0xd6, 0xcb, 0xd1, 0xcc, 0xdd, 0xe4, 0x5b, 0x49, 0x44, 0x48, 0x53, 0x01, 0x05, 0x1f, 0x18, 0x79, 0x0a, 0x1e, 0x90, 0x14, 0x1e, 0x1e, 0x16, 0x1f, 0x0a, 0x78, 0x18, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x19, 0x79, 0x70, 0x82, 0x16, 0x16, 0x16, 0x14, 0x16, 0x16, 0x16, 0x18, 0x7d, 0x75, 0x7d, 0x85, 0x12, 0x86, 0x12, 0x13, 0x76, 0x6b, 0x6b, 0x71, 0x28, 0x2e, 0x30, 0x3e, 0xdf, 0xd5, 0xd8, 0xd8, 0xd6, 0xd1, 0xcb, 0xd0, 0xcb, 0xca, 0xcb, 0xd0, 0xd0, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcd, 0xc7, 0xcd, 0xc6, 0xc0, 0xb7, 0xa4, 0xa3, 0xa7, 0xa7, 0xa7, 0xa3, 0xa3, 0xa3, 0xa7, 0xa8, 0xa3, 0xa6, 0xa3, 0xa7, 0xa7, 0xa8, 0xa9, 0xa7, 0xa8, 0xa7, 0xa7, 0xa7, 0xa6, 0xb7, 0xa4, 0xb7, 0xa6, 0xa8, 0xa6, 0xa6, 0xa8, 0xa7, 0xa8, 0xa8, 0xa8, 0xa9, 0xa9, 0xa8, 0xa6, 0xa5, 0xb4, 0xc1, 0xec, 0xed, 0xf0, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf4, 0xe9, 0xde, 0xd8, 0xd6, 0xda, 0xda, 0xda, 0xd7, 0xda, 0xda, 0xda, 0xd6, 0xd8, 0xd3, 0xde, 0xe1, 0xe5, 0xe9, 0xe0, 0xcc, 0xd8, 0xd2, 0xd6, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd0, 0xd4, 0xd0, 0xd0, 0xd1, 0xcc, 0xcc, 0xcf, 0xfe, 0x4d, 0x33, 0x4c, 0x51, 0x30, 0x6d, 0x80, 0x7d, 0x77, 0x18, 0x18, 0x8e, 0x91, 0x16, 0x1e, 0x16, 0x15, 0x78, 0x0a, 0x18, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x18, 0x82, 0x70, 0x77, 0x20, 0x16, 0x11, 0x91, 0x16, 0x16, 0x16, 0x18, 0x8e, 0x79, 0x75, 0x81, 0x89, 0x13, 0x82, 0x75, 0x6d, 0x6a, 0x07, 0x2d, 0x42, 0x2b, 0x34, 0xef, 0xc8, 0xc6, 0xc6, 0xc6, 0xcb, 0xc6, 0xcb, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd1, 0xcb, 0xcb, 0xcb, 0xcd, 0xd0, 0xc7, 0xcd, 0xca, 0xcd, 0xc6, 0xd0, 0xd1, 0xcb, 0xc2, 0xc0, 0xa7, 0xa2, 0xa2, 0xa2, 0xa6, 0xa6, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa6, 0xa6, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa6, 0xa8, 0xa8, 0xa8, 0xa8, 0xa3, 0xa9, 0xa9, 0xa8, 0xb4, 0xc4, 0xe9, 0xeb, 0xe8, 0xf3, 0xe7, 0xea, 0xea, 0xe7, 0xea, 0xf1, 0xea, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xea, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf3, 0xf2, 0xf2, 0xf0, 0xf4, 0xeb, 0xe1, 0xd5, 0xd8, 0xda, 0xda, 0xda, 0xda, 0xd8, 0xd8, 0xd8, 0xd8, 0xda, 0xd8, 0xd3, 0xd8, 0xdc, 0xdd, 0xd6, 0xd6, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd1, 0xd3, 0xd3, 0xef, 0x3e, 0x49, 0x4c, 0x53, 0x93, 0x69, 0x76, 0x8f, 0x18, 0x16, 0x11, 0x91, 0x16, 0x1e, 0x11, 0x15, 0x75, 0x0e, 0x11, 0x11, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x17, 0x71, 0x71, 0x8f, 0x18, 0x18, 0x16, 0x16, 0x16, 0x11, 0x8c, 0x12, 0x18, 0x75, 0x75, 0x82, 0x80, 0x71, 0x6b, 0x6b, 0x0b, 0x30, 0x33, 0x28, 0x34, 0x31, 0xcf, 0xc5, 0xc7, 0xc6, 0xcb, 0xc6, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xca, 0xcd, 0xca, 0xcd, 0xca, 0xcd, 0xca, 0xca, 0xca, 0xca, 0xcb, 0xd1, 0xb8, 0xaf, 0x9e, 0xbc, 0xd0, 0xc0, 0xbe, 0xbc, 0xb7, 0xa4, 0xa2, 0xa2, 0xa4, 0xa2, 0xa6, 0xa7, 0xa6, 0xa2, 0xa8, 0xa8, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa8, 0xa8, 0xa8, 0xa6, 0xa8, 0xa8, 0xa8, 0xa6, 0xa8, 0xa6, 0xa9, 0xa9, 0xa8, 0xa2, 0xc4, 0xab, 0xe9, 0xe8, 0xea, 0xea, 0xea, 0xf1, 0xeb, 0xf1, 0xeb, 0xf1, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf3, 0xf4, 0xf2, 0xf4, 0xeb, 0xe5, 0xdd, 0xd6, 0xd8, 0xd6, 0xda, 0xd8, 0xda, 0xd8, 0xd8, 0xda, 0xd6, 0xda, 0xdc, 0xd8, 0xd6, 0xd1, 0xd4, 0xd7, 0xd7, 0xd6, 0xd6, 0xd6, 0xd7, 0xd6, 0xda, 0xd6, 0xda, 0xd6, 0xd7, 0xd7, 0xd7, 0xd0, 0xc7, 0xc7, 0xc6, 0xc6, 0xc4, 0xc4, 0xc4, 0xc4, 0xc1, 0xef, 0x3e, 0x49, 0x51, 0x45, 0x69, 0x6b, 0x1d, 0x11, 0x12, 0x13, 0x12, 0x16, 0x16, 0x19, 0x0a, 0x75, 0x8b, 0x0d, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x76, 0x70, 0x7e, 0x19, 0x16, 0x16, 0x1e, 0x16, 0x12, 0x16, 0x16, 0x92, 0x0a, 0x71, 0x70, 0x70, 0x6b, 0x6b, 0x1b, 0x50, 0x53, 0x34, 0x45, 0xfc, 0xcc, 0xca, 0xc7, 0xc6, 0xc7, 0xc9, 0xc6, 0xcb, 0xc6, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xcd, 0xca, 0xcd, 0xca, 0xcb, 0xca, 0xca, 0xca, 0xca, 0xca, 0xd1, 0xb2, 0x98, 0x98, 0x98, 0x9b, 0xc4, 0xc7, 0xd4, 0xd0, 0xc7, 0xc6, 0xc0, 0xbc, 0xb9, 0xa4, 0xa2, 0xa1, 0xa2, 0xa7, 0xa6, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa8, 0xa8, 0xa3, 0xa8, 0xa3, 0xa8, 0xa3, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa6, 0xa8, 0xa9, 0xa2, 0xa2, 0xbf, 0xe9, 0xe8, 0xea, 0xf1, 0xf0, 0xf9, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xeb, 0xea, 0xeb, 0xeb, 0xeb, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf0, 0xf3, 0xf0, 0xf0, 0xf2, 0xea, 0xeb, 0xe5, 0xdd, 0xd3, 0xda, 0xd8, 0xda, 0xd8, 0xda, 0xda, 0xd6, 0xd7, 0xd6, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd7, 0xd0, 0xcd, 0xc7, 0xc4, 0xc2, 0xc2, 0xc0, 0xbf, 0xbe, 0xbc, 0xbc, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbc, 0xb9, 0xbc, 0xbe, 0xc5, 0x54, 0x34, 0x56, 0x1b, 0x68, 0x70, 0x75, 0x12, 0x18, 0x8e, 0x91, 0x16, 0x16, 0x13, 0x77, 0x79, 0x13, 0x12, 0x8c, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x16, 0x11, 0x80, 0x70, 0x77, 0x90, 0x16, 0x1e, 0x16, 0x16, 0x16, 0x16, 0x18, 0x15, 0x80, 0x70, 0x6b, 0x6b, 0x70, 0x21, 0x5e, 0x5f, 0x61, 0xef, 0xd9, 0xc8, 0xc7, 0xc7, 0xc7, 0xcb, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xcd, 0xcd, 0xcb, 0xd6, 0xd1, 0xd5, 0xd2, 0xd6, 0xd1, 0xcb, 0xc4, 0x9b, 0x9b, 0x9b, 0x9b, 0x98, 0xbc, 0xc9, 0xc6, 0xc9, 0xd0, 0xcd, 0xd7, 0xd0, 0xd0, 0xc7, 0xc6, 0xbe, 0xbc, 0xb7, 0xa4, 0xa2, 0xa4, 0xa4, 0xa8, 0xa7, 0xa7, 0xa6, 0xa9, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa3, 0xa6, 0xa8, 0xa8, 0xa8, 0xa7, 0xb7, 0xb7, 0xb8, 0xe5, 0xec, 0xf1, 0xf0, 0xfa, 0xf9, 0xfa, 0xf4, 0xf1, 0xf9, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xea, 0xf1, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf3, 0xfb, 0xf2, 0xf3, 0xea, 0xe7, 0xf0, 0xf4, 0xf1, 0xe3, 0xde, 0xd8, 0xd8, 0xda, 0xda, 0xda, 0xda, 0xde, 0xda, 0xda, 0xd4, 0xca, 0xc6, 0xc4, 0xbe, 0xbe, 0xbc, 0xbc, 0xb9, 0xb9, 0xb7, 0xb6, 0xb7, 0xb6, 0xb7, 0xb8, 0xb7, 0xb8, 0xb9, 0xbc, 0xbc, 0xbe, 0xbe, 0xc0, 0xc2, 0xc2, 0xc6, 0xc6, 0xc6, 0xc5, 0xef, 0xfd, 0x94, 0x6c, 0x6d, 0x24, 0x77, 0x79, 0x0d, 0x8e, 0x8e, 0x12, 0x18, 0x8b, 0x75, 0x81, 0x12, 0x8c, 0x8c, 0x8c, 0x8c, 0x12, 0x12, 0x8c, 0x12, 0x12, 0x16, 0x16, 0x16, 0x8f, 0x75, 0x71, 0x8f, 0x1e, 0x16, 0x1e, 0x12, 0x18, 0x92, 0x82, 0x77, 0x6e, 0x6d, 0x6d, 0x7a, 0x21, 0x10, 0x10, 0x2a, 0xdb, 0xc5, 0xc7, 0xc6, 0xc7, 0xc7, 0xc7, 0xca, 0xcf, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xc6, 0xcb, 0xd5, 0xc4, 0x9f, 0x9f, 0x9d, 0xb6, 0xc4, 0xd1, 0xd0, 0x9f, 0x98, 0x98, 0x98, 0x98, 0xc4, 0xc6, 0xca, 0xca, 0xcb, 0xca, 0xcb, 0xcd, 0xd0, 0xcd, 0xd0, 0xd7, 0xc7, 0xc7, 0xc6, 0xbe, 0xb9, 0xb7, 0xb4, 0xa2, 0xa2, 0xa6, 0xa6, 0xa6, 0xa3, 0xa3, 0xa3, 0xa8, 0xa8, 0xa8, 0xa6, 0xa8, 0xa6, 0xa6, 0xa7, 0xa4, 0xbe, 0xe3, 0xe5, 0xeb, 0xf5, 0xf5, 0xec, 0xeb, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf3, 0xf0, 0xf3, 0xf0, 0xe6, 0xeb, 0xeb, 0xeb, 0xf2, 0xf5, 0xec, 0xe9, 0xe3, 0xde, 0xda, 0xda, 0xd0, 0xc6, 0xc0, 0xc0, 0xbc, 0xb9, 0xb9, 0xb8, 0xb7, 0xb6, 0xb7, 0xb9, 0xb9, 0xb9, 0xbc, 0xbc, 0xbe, 0xc0, 0xc0, 0xc0, 0xc6, 0xc2, 0xc7, 0xc7, 0xc6, 0xc7, 0xc7, 0xd0, 0xcd, 0xcd, 0xcd, 0xc7, 0xc7, 0xc7, 0xc5, 0xcf, 0xe4, 0x7c, 0x96, 0x07, 0x4c, 0x42, 0x7f, 0x78, 0x7d, 0x18, 0x11, 0x18, 0x7e, 0x75, 0x8b, 0x12, 0x8c, 0x8c, 0x88, 0x8c, 0x88, 0x8c, 0x8c, 0x88, 0x8c, 0x88, 0x16, 0x12, 0x13, 0x7b, 0x6d, 0x79, 0x92, 0x16, 0x1f, 0x8b, 0x82, 0x71, 0x6e, 0x6b, 0x01, 0x0b, 0x34, 0x38, 0x4d, 0x5d, 0x26, 0x27, 0xc8, 0xc7, 0xc7, 0xcf, 0xc9, 0xc7, 0xc7, 0xcf, 0xcf, 0xca, 0xcb, 0xcb, 0xc6, 0xcb, 0xcb, 0xc6, 0xcb, 0xcb, 0xcb, 0xc7, 0xd0, 0xc5, 0xaf, 0x98, 0x98, 0x98, 0x98, 0x9b, 0xc4, 0xc7, 0xd1, 0xb6, 0x9d, 0x9f, 0xba, 0xc6, 0xca, 0xca, 0xca, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xc7, 0xd0, 0xc7, 0xd0, 0xd0, 0xd7, 0xc7, 0xc6, 0xbe, 0xb9, 0xb7, 0xa2, 0xa2, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa7, 0xa8, 0xa6, 0xa8, 0xb7, 0xa3, 0xa9, 0xa1, 0xb7, 0xb9, 0xbf, 0xbf, 0xc9, 0xdc, 0xe1, 0xe9, 0xed, 0xec, 0xea, 0xeb, 0xea, 0xf0, 0xf3, 0xfb, 0xf3, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf0, 0xf4, 0xf1, 0xea, 0xeb, 0xe8, 0xeb, 0xec, 0xe9, 0xe0, 0xd8, 0xc4, 0xc2, 0xbe, 0xbe, 0xb9, 0xb9, 0xb8, 0xb9, 0xb6, 0xb6, 0xbc, 0xbc, 0xbe, 0xc0, 0xc2, 0xc6, 0xc6, 0xc6, 0xc7, 0xc7, 0xc7, 0xd0, 0xc7, 0xd0, 0xc7, 0xc7, 0xc7, 0xcd, 0xca, 0xc7, 0xcb, 0xc7, 0xc6, 0xc7, 0xc7, 0xca, 0xc7, 0xc7, 0xc9, 0xc9, 0xc5, 0xe0, 0xc8, 0x6c, 0x08, 0x4f, 0x4f, 0x48, 0x19, 0x78, 0x79, 0x11, 0x17, 0x78, 0x71, 0x8f, 0x13, 0x7f, 0x0d, 0x7f, 0x8e, 0x7f, 0x11, 0x86, 0x0d, 0x8e, 0x11, 0x8e, 0x18, 0x13, 0x7e, 0x6e, 0x76, 0x1d, 0x15, 0x7b, 0x71, 0x6e, 0x6e, 0x71, 0x1a, 0x3e, 0x62, 0x4d, 0x39, 0x30, 0x5b, 0x5b, 0x3e, 0xce, 0xca, 0xca, 0xcf, 0xcc, 0xc7, 0xc7, 0xca, 0xcf, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xd1, 0xbf, 0x9b, 0x98, 0x9b, 0x9a, 0x9b, 0x98, 0xbf, 0xc7, 0xc6, 0xcc, 0xd3, 0xc8, 0xd5, 0xd1, 0xd1, 0xca, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xc7, 0xd0, 0xd0, 0xc6, 0xc6, 0xbc, 0xb9, 0xa4, 0xa2, 0xb4, 0xa6, 0xa4, 0xb7, 0xa7, 0xa6, 0xa6, 0xa3, 0xa3, 0xa9, 0xa9, 0xb9, 0xaa, 0xb9, 0xb9, 0xbc, 0xbe, 0xbf, 0xd5, 0xe1, 0xe5, 0xeb, 0xed, 0xe8, 0xea, 0xe7, 0xf3, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xec, 0xf5, 0xeb, 0xe1, 0xc1, 0xbc, 0xb6, 0xb7, 0xb7, 0xb7, 0xb9, 0xb7, 0xb9, 0xb9, 0xbe, 0xc0, 0xc6, 0xc7, 0xcd, 0xcd, 0xd4, 0xd4, 0xd4, 0xd0, 0xca, 0xcb, 0xcb, 0xcb, 0xd0, 0xca, 0xc7, 0xcb, 0xca, 0xcb, 0xca, 0xca, 0xca, 0xc6, 0xc6, 0xc6, 0xcb, 0xcb, 0xc6, 0xc7, 0xc6, 0xc7, 0xc6, 0xc9, 0xc4, 0xca, 0xe5, 0xfe, 0x39, 0x42, 0x35, 0x42, 0x4c, 0x33, 0x0e, 0x05, 0x78, 0x70, 0x72, 0x80, 0x8d, 0x8b, 0x90, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x13, 0x13, 0x13, 0x8f, 0x8b, 0x19, 0x1a, 0x73, 0x6d, 0x01, 0x6d, 0x69, 0x69, 0x72, 0x1a, 0x2d, 0x60, 0x63, 0x64, 0x4d, 0x2f, 0x2f, 0x54, 0xfe, 0xef, 0xc5, 0xcf, 0xca, 0xca, 0xca, 0xcb, 0xc7, 0xc9, 0xca, 0xcb, 0xcb, 0xcb, 0xc6, 0xcb, 0xc6, 0xcb, 0xcb, 0xcb, 0xd0, 0xc7, 0xda, 0xba, 0x9a, 0x9a, 0x9c, 0x9a, 0x9a, 0x98, 0xc1, 0xc7, 0xcb, 0xc5, 0xb5, 0xaf, 0xaf, 0xa5, 0xc5, 0xd4, 0xd1, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xd0, 0xd0, 0xd0, 0xc6, 0xc2, 0xbc, 0xb7, 0xa4, 0xa1, 0xa2, 0xa6, 0xa3, 0xa1, 0xa2, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbc, 0xbc, 0xb9, 0xbc, 0xc2, 0xdc, 0xe3, 0xeb, 0xec, 0xeb, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xec, 0xe8, 0xdc, 0xba, 0xb6, 0xa5, 0xa8, 0xb9, 0xaa, 0xb9, 0xaa, 0xbc, 0xbe, 0xc6, 0xd4, 0xd0, 0xd4, 0xd0, 0xcb, 0xd0, 0xd0, 0xcb, 0xc7, 0xcb, 0xcb, 0xcb, 0xca, 0xcb, 0xca, 0xc9, 0xcb, 0xc9, 0xc9, 0xca, 0xc9, 0xca, 0xca, 0xca, 0xca, 0xcb, 0xcb, 0xcb, 0xc7, 0xcb, 0xca, 0xca, 0xc7, 0xc7, 0xd0, 0xc6, 0xcf, 0xd3, 0x61, 0x60, 0x51, 0x4c, 0x4f, 0x58, 0x51, 0x51, 0x39, 0x09, 0x6b, 0x6b, 0x6d, 0x01, 0x75, 0x75, 0x77, 0x77, 0x79, 0x7b, 0x0a, 0x7b, 0x0a, 0x78, 0x77, 0x05, 0x71, 0x70, 0x6b, 0x69, 0x6b, 0x6b, 0x6e, 0x02, 0x06, 0x29, 0x39, 0x60, 0xac, 0xab, 0x54, 0x53, 0x49, 0x5f, 0xe0, 0xcc, 0xc8, 0xc9, 0xc6, 0xcd, 0xc7, 0xc7, 0xcb, 0xcb, 0xc9, 0xcb, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xca, 0xc7, 0xd1, 0xc5, 0xae, 0x98, 0x98, 0x9a, 0x98, 0xb2, 0xd5, 0xc6, 0xc9, 0x9d, 0x98, 0x98, 0x98, 0x98, 0x9f, 0xd6, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc9, 0xc9, 0xd1, 0xc9, 0xd1, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcd, 0xd0, 0xd0, 0xd7, 0xc7, 0xc6, 0xc0, 0xb9, 0xa6, 0xa2, 0xb7, 0xc6, 0xd0, 0xcd, 0xcd, 0xcd, 0xcd, 0xc7, 0xc6, 0xc6, 0xc6, 0xc0, 0xc0, 0xbe, 0xbc, 0xbf, 0xd3, 0xe5, 0xeb, 0xeb, 0xea, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xea, 0xeb, 0xe1, 0xbd, 0xb4, 0xa7, 0xa9, 0xaa, 0xb9, 0xb9, 0xb7, 0xbc, 0xc0, 0xc7, 0xd4, 0xd7, 0xd0, 0xd1, 0xd2, 0xd2, 0xcd, 0xc7, 0xd0, 0xc7, 0xd0, 0xc7, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xcb, 0xc7, 0xca, 0xca, 0xca, 0xca, 0xcb, 0xc6, 0xcb, 0xc6, 0xcb, 0xca, 0xc6, 0xca, 0xc6, 0xc7, 0xc7, 0xc6, 0xc9, 0xd3, 0xfe, 0xfe, 0x5b, 0x60, 0x5b, 0x4d, 0x53, 0x50, 0x73, 0x7c, 0xb2, 0x73, 0x02, 0x6e, 0x6d, 0x69, 0x69, 0x66, 0x69, 0x69, 0x68, 0x68, 0x67, 0x68, 0x68, 0x6b, 0xf7, 0x72, 0x7a, 0x29, 0x07, 0x0c, 0x94, 0x1b, 0x7a, 0xfc, 0xef, 0xe0, 0xd9, 0xfd, 0x54, 0xfe, 0xfd, 0xd3, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xcb, 0xca, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xc6, 0xcb, 0xcb, 0xcb, 0xc6, 0xcb, 0xcb, 0xc7, 0xc9, 0xd5, 0xc1, 0xb2, 0x9d, 0x9f, 0xb8, 0xcf, 0xcc, 0xd4, 0xb2, 0x98, 0x99, 0x98, 0x99, 0x98, 0x96, 0xc5, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xcb, 0xca, 0xcb, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xc7, 0xd0, 0xd0, 0xd0, 0xd7, 0xc7, 0xc6, 0xcb, 0xcb, 0xd0, 0xcb, 0xcd, 0xc7, 0xca, 0xca, 0xd0, 0xca, 0xc6, 0xcb, 0xcb, 0xc6, 0xc2, 0xc0, 0xc2, 0xc1, 0xe5, 0xeb, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xeb, 0xab, 0xc5, 0xa0, 0xa5, 0xaa, 0xaa, 0xa8, 0xaa, 0xb9, 0xbe, 0xc7, 0xd7, 0xd4, 0xd0, 0xd1, 0xd2, 0xd2, 0xd6, 0xd2, 0xd4, 0xd7, 0xd0, 0xc7, 0xd7, 0xcb, 0xca, 0xc9, 0xca, 0xcb, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc6, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xca, 0xc6, 0xca, 0xc7, 0xca, 0xca, 0xc7, 0xc7, 0xc6, 0xc9, 0xcc, 0xef, 0xfd, 0xef, 0x31, 0x3e, 0x54, 0x73, 0x95, 0x0f, 0x23, 0x21, 0x26, 0x27, 0x21, 0x21, 0x22, 0x27, 0x26, 0x27, 0x27, 0x23, 0xee, 0xce, 0xfc, 0x31, 0x22, 0x38, 0x5e, 0x5b, 0x10, 0x10, 0x3c, 0x5c, 0x31, 0xce, 0xcf, 0xc9, 0xcc, 0xcc, 0xce, 0xd3, 0xcf, 0xc5, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xcb, 0xd4, 0xd5, 0xd5, 0xdc, 0xd5, 0xd5, 0xd7, 0xd4, 0xc6, 0xc9, 0xd1, 0xaf, 0x98, 0x9a, 0x9a, 0xad, 0x98, 0x98, 0xc4, 0xd6, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xcb, 0xd0, 0xcb, 0xc7, 0xcb, 0xd0, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc7, 0xcb, 0xcb, 0xca, 0xc6, 0xc7, 0xc7, 0xc6, 0xc6, 0xc1, 0xd3, 0xec, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xed, 0xed, 0xe5, 0xbd, 0xa0, 0xb6, 0xa8, 0xb9, 0xaa, 0xbe, 0xd0, 0xd7, 0xc7, 0xd0, 0xd0, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd0, 0xc2, 0xbe, 0xbc, 0xbc, 0xc0, 0xc6, 0xd0, 0xc9, 0xc9, 0xcb, 0xc9, 0xcb, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc6, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xc7, 0xd0, 0xc5, 0xcc, 0xce, 0xcc, 0xce, 0xd9, 0xef, 0x96, 0x6a, 0x2a, 0x5b, 0x53, 0x51, 0x4d, 0x4d, 0x34, 0x57, 0x57, 0x51, 0x53, 0x60, 0x5a, 0xc8, 0xd9, 0xdb, 0x23, 0x1c, 0x53, 0x5e, 0x56, 0x15, 0x20, 0x2e, 0x49, 0xfd, 0xd9, 0xcc, 0xcf, 0xd2, 0xcc, 0xcc, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd4, 0xc4, 0xb5, 0xaf, 0xb1, 0xc8, 0xcb, 0xc6, 0xc4, 0xca, 0xc9, 0xd6, 0x9b, 0x98, 0x9a, 0x99, 0x9a, 0x99, 0x98, 0xc8, 0xc9, 0xcb, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc7, 0xcb, 0xc7, 0xcb, 0xc7, 0xc7, 0xc7, 0xca, 0xc7, 0xca, 0xca, 0xc6, 0xcd, 0xc7, 0xc7, 0xc6, 0xc1, 0xd9, 0xec, 0xe9, 0xf3, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xea, 0xed, 0xeb, 0xdc, 0xb8, 0xb6, 0xa4, 0xb7, 0xaa, 0xbc, 0xc6, 0xd7, 0xd7, 0xd4, 0xd4, 0xd1, 0xd4, 0xd1, 0xd0, 0xcb, 0xb9, 0xa4, 0xb6, 0xb7, 0xa5, 0xbc, 0xd0, 0xcb, 0xcb, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xcd, 0xc7, 0xc7, 0xc7, 0xc7, 0xd0, 0xcd, 0xc6, 0xd1, 0xdf, 0xf7, 0x6f, 0x5b, 0x5b, 0x53, 0x49, 0x3e, 0x3e, 0x3e, 0x5e, 0x49, 0x3c, 0x4d, 0x60, 0xdb, 0xc8, 0xd0, 0xd3, 0xcc, 0x27, 0x4d, 0x60, 0x56, 0x10, 0x20, 0x20, 0x5b, 0xfd, 0xcc, 0xcf, 0xd4, 0xcd, 0xcb, 0xd0, 0xc7, 0xc7, 0xc7, 0xd1, 0xcb, 0xd1, 0xcb, 0xd1, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd7, 0xb1, 0x98, 0x98, 0x98, 0xaf, 0xc4, 0xc9, 0xcd, 0xca, 0xc6, 0xd5, 0xb2, 0x98, 0x98, 0x98, 0x96, 0x98, 0xb5, 0xd8, 0xd1, 0xca, 0xcd, 0xca, 0xcb, 0xca, 0xcb, 0xca, 0xcb, 0xca, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc7, 0xca, 0xc7, 0xca, 0xc7, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc6, 0xc7, 0xc6, 0xc6, 0xc4, 0xc4, 0xde, 0xe9, 0xec, 0xe7, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf9, 0xf2, 0xed, 0xea, 0xe8, 0xed, 0xe5, 0xdc, 0xbf, 0xb8, 0xb6, 0xb6, 0xb8, 0xbc, 0xc0, 0xd0, 0xd7, 0xd7, 0xd7, 0xd0, 0xd0, 0xd7, 0xbe, 0xb7, 0xb7, 0xbc, 0xbe, 0xc6, 0xc7, 0xcb, 0xca, 0xcb, 0xca, 0xcb, 0xca, 0xc7, 0xca, 0xc7, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xc7, 0xc7, 0xc7, 0xcb, 0xcd, 0xcd, 0xd1, 0xdc, 0xfd, 0x54, 0x54, 0x59, 0x31, 0x31, 0xd3, 0xd3, 0xfc, 0xfe, 0x3e, 0x4d, 0x54, 0xfe, 0xce, 0xcb, 0xcb, 0xcd, 0xd1, 0xc5, 0xfd, 0x62, 0x54, 0x1c, 0x1c, 0x34, 0x62, 0xdc, 0xcc, 0xcf, 0xcd, 0xcd, 0xca, 0xd0, 0xc7, 0xc7, 0xc7, 0xd1, 0xcb, 0xcb, 0xcb, 0xd1, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xcb, 0xd0, 0xd5, 0xaf, 0x98, 0x9a, 0x9a, 0x98, 0xba, 0xd4, 0xcb, 0xc6, 0xca, 0xcb, 0xc5, 0xb1, 0xaf, 0x9b, 0xae, 0xb5, 0xd1, 0xc9, 0xcb, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcd, 0xca, 0xcd, 0xca, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xc7, 0xcb, 0xca, 0xd0, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc9, 0xc9, 0xc4, 0xc5, 0xc9, 0xda, 0xe5, 0xe9, 0xeb, 0xf1, 0xed, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xea, 0xeb, 0xeb, 0xed, 0xe9, 0xe9, 0xdd, 0xc5, 0xbd, 0xb8, 0xb6, 0xb6, 0xb9, 0xbe, 0xc4, 0xc7, 0xd0, 0xd0, 0xd0, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xca, 0xc6, 0xc7, 0xc6, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc6, 0xca, 0xc6, 0xca, 0xc6, 0xca, 0xc6, 0xca, 0xc6, 0xca, 0xc7, 0xc7, 0xca, 0xcf, 0xca, 0xca, 0xcd, 0xc7, 0xcd, 0xcd, 0xcd, 0xd2, 0xca, 0xcc, 0xd3, 0xef, 0xfc, 0xdb, 0xd3, 0xc7, 0xc7, 0xc7, 0xc9, 0xd9, 0xfd, 0xe2, 0xfd, 0xdb, 0xcf, 0xcf, 0xcf, 0xc7, 0xc7, 0xc4, 0xd9, 0xe5, 0xfa, 0xfe, 0x62, 0xf0, 0xdd, 0xcc, 0xcc, 0xd0, 0xd0, 0xcd, 0xd0, 0xcb, 0xd0, 0xcd, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd6, 0xb5, 0x98, 0x98, 0x98, 0xaf, 0xc4, 0xd0, 0xca, 0xc6, 0xca, 0xca, 0xcd, 0xd1, 0xd1, 0xd1, 0xd1, 0xd6, 0xd1, 0xcb, 0xcd, 0xcd, 0xd0, 0xcd, 0xcb, 0xca, 0xcb, 0xca, 0xcb, 0xca, 0xcb, 0xcd, 0xc7, 0xc7, 0xc7, 0xc7, 0xcd, 0xca, 0xcd, 0xca, 0xca, 0xcd, 0xc7, 0xcd, 0xc6, 0xca, 0xc6, 0xca, 0xcb, 0xca, 0xcb, 0xcb, 0xc9, 0xcb, 0xcb, 0xc9, 0xc9, 0xc5, 0xc5, 0xc5, 0xc4, 0xc5, 0xcc, 0xdd, 0xe0, 0xe9, 0xeb, 0xeb, 0xeb, 0xf2, 0xff, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xea, 0xeb, 0xf1, 0xec, 0xec, 0xeb, 0xe5, 0xe3, 0xdd, 0xc4, 0xbf, 0xb9, 0xb6, 0xb8, 0xb8, 0xbc, 0xc0, 0xc2, 0xc6, 0xc6, 0xc7, 0xc7, 0xc7, 0xca, 0xc7, 0xca, 0xca, 0xcd, 0xca, 0xc7, 0xca, 0xc7, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc6, 0xca, 0xc6, 0xc7, 0xc7, 0xca, 0xca, 0xcf, 0xca, 0xca, 0xca, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xc7, 0xcb, 0xcc, 0xcf, 0xcf, 0xca, 0xcd, 0xcd, 0xd0, 0xcf, 0xc9, 0xcc, 0xc8, 0xc8, 0xcc, 0xc9, 0xd2, 0xcf, 0xcf, 0xc7, 0xd0, 0xcc, 0xd3, 0xdd, 0xde, 0xef, 0xd2, 0xc5, 0xd1, 0xd0, 0xd1, 0xd0, 0xd1, 0xcb, 0xd1, 0xcf, 0xd1, 0xc9, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd1, 0xc5, 0xbd, 0xb1, 0xb5, 0xc4, 0xcc, 0xca, 0xc6, 0xd0, 0xc6, 0xc7, 0xca, 0xcd, 0xd1, 0xcb, 0xd2, 0xcb, 0xcd, 0xcd, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xcb, 0xca, 0xc7, 0xca, 0xcd, 0xca, 0xcd, 0xca, 0xc7, 0xca, 0xc6, 0xca, 0xc6, 0xca, 0xc6, 0xca, 0xcb, 0xcb, 0xc9, 0xc9, 0xc9, 0xc5, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xcc, 0xcc, 0xdc, 0xde, 0xe1, 0xe5, 0xe8, 0xeb, 0xed, 0xeb, 0xeb, 0xf2, 0xf3, 0xff, 0xff, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0xec, 0xed, 0xeb, 0xeb, 0xeb, 0xe8, 0xe8, 0xe5, 0xe0, 0xdd, 0xcc, 0xc1, 0xbd, 0xba, 0xba, 0xba, 0xba, 0xbc, 0xbf, 0xc2, 0xc2, 0xc4, 0xc6, 0xcb, 0xca, 0xca, 0xca, 0xca, 0xcd, 0xcb, 0xcb, 0xcb, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xcb, 0xc6, 0xc7, 0xca, 0xca, 0xc9, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcf, 0xcf, 0xcd, 0xc7, 0xc7, 0xc7, 0xc7, 0xd2, 0xca, 0xd2, 0xcd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd1, 0xcb, 0xcb, 0xcd, 0xcf, 0xcf, 0xca, 0xd2, 0xcf, 0xd3, 0xcf, 0xcb, 0xcf, 0xcf, 0xcb, 0xd0, 0xd0, 0xd1, 0xcb, 0xd1, 0xcb, 0xd1, 0xc9, 0xd1, 0xc9, 0xd2, 0xcb, 0xcb, 0xd1, 0xcb, 0xd1, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd1, 0xd5, 0xd8, 0xd8, 0xcc, 0xca, 0xc6, 0xc6, 0xd0, 0xc6, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xd1, 0xcb, 0xc9, 0xcb, 0xc9, 0xcb, 0xc9, 0xcb, 0xcb, 0xd1, 0xd0, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc9, 0xc5, 0xc4, 0xc5, 0xc1, 0xc5, 0xc5, 0xcc, 0xd5, 0xd9, 0xdd, 0xde, 0xe1, 0xe3, 0xe5, 0xe9, 0xec, 0xeb, 0xeb, 0xeb, 0xea, 0xeb, 0xe7, 0xf2, 0xf0, 0xf2, 0xff, 0xf2, 0xff, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xea, 0xea, 0xf1, 0xea, 0xf1, 0xf2, 0xf1, 0xf4, 0xf4, 0xf3, 0xe7, 0xe7, 0xe7, 0xea, 0xab, 0xea, 0xea, 0xea, 0xea, 0xeb, 0xea, 0xeb, 0xeb, 0xe9, 0xe5, 0xe1, 0xdd, 0xd3, 0xc8, 0xc1, 0xc1, 0xc1, 0xbf, 0xc1, 0xc1, 0xc2, 0xc1, 0xc4, 0xc4, 0xc4, 0xc6, 0xc6, 0xc6, 0xcb, 0xcb, 0xcb, 0xc6, 0xcb, 0xc6, 0xca, 0xca, 0xca, 0xca, 0xcb, 0xc7, 0xc7, 0xc7, 0xcd, 0xcb, 0xd0, 0xcb, 0xcd, 0xc7, 0xcd, 0xcd, 0xcd, 0xca, 0xcf, 0xd2, 0xcf, 0xd2, 0xcf, 0xcf, 0xd2, 0xd1, 0xc7, 0xcb, 0xca, 0xd4, 0xca, 0xd4, 0xcd, 0xcf, 0xcf, 0xd2, 0xc7, 0xd0, 0xcf, 0xd1, 0xcd, 0xd2, 0xd0, 0xd1, 0xd1, 0xd1, 0xcd, 0xcd, 0xcd, 0xcb, 0xd1, 0xd0, 0xd1, 0xcb, 0xd1, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xcd, 0xca, 0xc6, 0xc9, 0xc5, 0xc9, 0xc6, 0xcd, 0xca, 0xc6, 0xcb, 0xcb, 0xca, 0xca, 0xca, 0xd2, 0xca, 0xd2, 0xcd, 0xd1, 0xd0, 0xc9, 0xcb, 0xc9, 0xcb, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc6, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc5, 0xd3, 0xd3, 0xd3, 0xd9, 0xdc, 0xdd, 0xe0, 0xe1, 0xe5, 0xe5, 0xe8, 0xe8, 0xf1, 0xec, 0xec, 0xf5, 0xec, 0xeb, 0xf1, 0xe8, 0xe7, 0xf1, 0xed, 0xf2, 0xea, 0xea, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xac, 0xac, 0xf3, 0xac, 0xf2, 0xf0, 0xf2, 0xff, 0xf4, 0xf9, 0xac, 0xea, 0xac, 0xea, 0xea, 0xeb, 0xed, 0xed, 0xed, 0xeb, 0xeb, 0xe9, 0xe5, 0xe5, 0xe1, 0xe1, 0xe0, 0xde, 0xdc, 0xd8, 0xd0, 0xcb, 0xc6, 0xc4, 0xc2, 0xc2, 0xc4, 0xc2, 0xc4, 0xc4, 0xc4, 0xc4, 0xc5, 0xc6, 0xc6, 0xc7, 0xc7, 0xc7, 0xc7, 0xcb, 0xc7, 0xd0, 0xcb, 0xcf, 0xcf, 0xcf, 0xcf, 0xd1, 0xcb, 0xcb, 0xd0, 0xc7, 0xd4, 0xd2, 0xcf, 0xca, 0xd0, 0xd0, 0xd4, 0xca, 0xd4, 0xc7, 0xcd, 0xd2, 0xd2, 0xd4, 0xd0, 0xd1, 0xd2, 0xd1, 0xcd, 0xcd, 0xcf, 0xd1, 0xd2, 0xcb, 0xcd, 0xc7, 0xcd, 0xcd, 0xd0, 0xcb, 0xd1, 0xd0, 0xd1, 0xcb, 0xd1, 0xcb, 0xcb, 0xd1, 0xcb, 0xcb, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xcd, 0xd4, 0xc9, 0xd2, 0xc9, 0xca, 0xca, 0xc6, 0xc9, 0xc9, 0xc9, 0xc5, 0xc9, 0xc9, 0xc9, 0xc5, 0xc4, 0xc5, 0xc4, 0xc5, 0xc4, 0xc4, 0xc5, 0xc5, 0xc5, 0xc9, 0xcb, 0xd5, 0xda, 0xdc, 0xde, 0xde, 0xe0, 0xe1, 0xe3, 0xe3, 0xe5, 0xe5, 0xe9, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xed, 0xea, 0xea, 0xea, 0xeb, 0xeb, 0xe9, 0xf1, 0xea, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xea, 0xea, 0xea, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xeb, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xea, 0xf2, 0xea, 0xea, 0xed, 0xea, 0xf5, 0xec, 0xed, 0xec, 0xed, 0xec, 0xf5, 0xec, 0xeb, 0xeb, 0xeb, 0xe9, 0xe5, 0xe5, 0xe3, 0xe1, 0xe1, 0xe0, 0xde, 0xdd, 0xdd, 0xdc, 0xd5, 0xd3, 0xd3, 0xcc, 0xcc, 0xc9, 0xcc, 0xcc, 0xcc, 0xcc, 0xc9, 0xcc, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xcb, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xcc, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc9, 0xc5, 0xc9, 0xc5, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xcc, 0xcc, 0xd3, 0xd3, 0xd9, 0xd9, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xe1, 0xe1, 0xe3, 0xe5, 0xe6, 0xe8, 0xe8, 0xeb, 0xea, 0xed, 0xec, 0xed, 0xec, 0xea, 0xed, 0xed, 0xea, 0xed, 0xed, 0xea, 0xed, 0xf1, 0xf1, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xeb, 0xeb, 0xea, 0xeb, 0xe8, 0xea, 0xea, 0xea, 0xea, 0xed, 0xe9, 0xeb, 0xeb, 0xec, 0xec, 0xeb, 0xeb, 0xeb, 0xe9, 0xe8, 0xe9, 0xe9, 0xe5, 0xe5, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xde, 0xdd, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdc, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xdd, 0xde, 0xde, 0xde, 0xe0, 0xe1, 0xe0, 0xe1, 0xe1, 0xe3, 0xe3, 0xe3, 0xe3, 0xe5, 0xe5, 0xe6, 0xe6, 0xe9, 0xe9, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xed, 0xeb, 0xed, 0xeb, 0xed, 0xeb, 0xed, 0xea, 0xea, 0xeb, 0xea, 0xec, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xea, 0xf1, 0xf1, 0xea, 0xf2, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xea, 0xeb, 0xea, 0xeb, 0xea, 0xeb, 0xe7, 0xeb, 0xe7, 0xeb, 0xe9, 0xeb, 0xeb, 0xec, 0xeb, 0xec, 0xeb, 0xeb, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xeb, 0xec, 0xeb, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xeb, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xeb, 0xec, 0xeb, 0xeb, 0xeb, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xec, 0xec, 0xed, 0xec, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xeb, 0xec, 0xeb, 0xf5, 0xec, 0xec, 0xeb, 0xeb, 0xec, 0xf1, 0xeb, 0xe6, 0xeb, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xeb, 0xf0, 0xeb, 0xf0, 0xea, 0xf1, 0xea, 0xf1, 0xea, 0xea, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xea, 0xf2, 0xf2, 0xf1, 0xea, 0xf1, 0xe7, 0xf1, 0xea, 0xf2, 0xf0, 0xf0, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf3, 0xf4, 0xf2, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf1, 0xea, 0xf1, 0xea, 0xf1, 0xf1, 0xf1, 0xed, 0xed, 0xf1, 0xf1, 0xe7, 0xf1, 0xe7, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xea, 0xf4, 0xea, 0xf4, 0xea, 0xf1, 0xf2, 0xf1, 0xea, 0xf1, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xed, 0xea, 0xea, 0xe7, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf9, 0xf1, 0xf4, 0xf1, 0xf0, 0xf0, 0xf1, 0xf4, 0xf1, 0xf9, 0xf0, 0xed, 0xf4, 0xea, 0xf1, 0xea, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xac, 0xf0, 0xf2, 0xf0, 0xac, 0xf0, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xac, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xed, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xf0, 0xf3, 0xf0, 0xf0, 0xf0, 0xf3, 0xf0, 0xf3, 0xf3, 0xf4, 0xf3, 0xf0, 0xf4, 0xf2, 0xf3, 0xf0, 0xf3, 0xf3, 0xf0, 0xf3, 0xf0, 0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3, 0xf0, 0xf3, 0xf0, 0xf3, 0xf0, 0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xf3, 0xf9, 0xf3, 0xf3, 0xf9, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf1, 0xf9, 0xf2, 0xf9, 0xf4, 0xf2, 0xf4, 0xf2, 0xf1, 0xf4, 0xea, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xac, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf3, 0xf0, 0xf3, 0xf0, 0xf3, 0xf2, 0xf3, 0xf0, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xf0, 0xac, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xac, 0xf0, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xea, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xea, 0xf1, 0xf1, 0xf1, 0xf1, 0xea, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xea, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xea, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xea, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xea, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xea, 0xea, 0xac, 0xea, 0xac, 0xea, 0xab, 0xf2, 0xac, 0xea, 0xac, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-};
-
-const lv_img_dsc_t image13 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image13_map,
-};
@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE14
-#define LV_ATTRIBUTE_IMG_IMAGE14
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE14 uint8_t image14_map[] = {
-  0xee, 0xf1, 0xfd, 0xff, 	/*Color of index 0*/
-  0xdd, 0xe3, 0xfb, 0xff, 	/*Color of index 1*/
-  0xd6, 0xda, 0xfc, 0xff, 	/*Color of index 2*/
-  0xc9, 0xd2, 0xfc, 0xff, 	/*Color of index 3*/
-  0xd8, 0xd6, 0xdd, 0xff, 	/*Color of index 4*/
-  0xbe, 0xc5, 0xfa, 0xff, 	/*Color of index 5*/
-  0xbf, 0xbf, 0xe1, 0xff, 	/*Color of index 6*/
-  0xb2, 0xb8, 0xf5, 0xff, 	/*Color of index 7*/
-  0xb0, 0xb3, 0xe3, 0xff, 	/*Color of index 8*/
-  0xa2, 0xab, 0xf2, 0xff, 	/*Color of index 9*/
-  0xb1, 0xae, 0xcd, 0xff, 	/*Color of index 10*/
-  0x94, 0x9d, 0xf8, 0xff, 	/*Color of index 11*/
-  0x96, 0x9e, 0xe6, 0xff, 	/*Color of index 12*/
-  0x9e, 0x9f, 0xc7, 0xff, 	/*Color of index 13*/
-  0x81, 0x88, 0xf7, 0xff, 	/*Color of index 14*/
-  0x93, 0x94, 0xc2, 0xff, 	/*Color of index 15*/
-  0x81, 0x8a, 0xe3, 0xff, 	/*Color of index 16*/
-  0x6d, 0x7a, 0xf7, 0xff, 	/*Color of index 17*/
-  0x76, 0x7d, 0xdd, 0xff, 	/*Color of index 18*/
-  0x7a, 0x7f, 0xc3, 0xff, 	/*Color of index 19*/
-  0x7f, 0x7d, 0x9d, 0xff, 	/*Color of index 20*/
-  0x67, 0x6c, 0xdc, 0xff, 	/*Color of index 21*/
-  0x62, 0x66, 0xf1, 0xff, 	/*Color of index 22*/
-  0x6b, 0x6b, 0xc4, 0xff, 	/*Color of index 23*/
-  0x65, 0x6a, 0xac, 0xff, 	/*Color of index 24*/
-  0x54, 0x58, 0xdb, 0xff, 	/*Color of index 25*/
-  0x4c, 0x52, 0xee, 0xff, 	/*Color of index 26*/
-  0x70, 0x6d, 0x78, 0xff, 	/*Color of index 27*/
-  0x61, 0x66, 0x93, 0xff, 	/*Color of index 28*/
-  0x52, 0x56, 0xc9, 0xff, 	/*Color of index 29*/
-  0x41, 0x44, 0xec, 0xff, 	/*Color of index 30*/
-  0x4c, 0x49, 0xd7, 0xff, 	/*Color of index 31*/
-  0x46, 0x4b, 0xc6, 0xff, 	/*Color of index 32*/
-  0x3f, 0x43, 0xd7, 0xff, 	/*Color of index 33*/
-  0x4d, 0x4c, 0xad, 0xff, 	/*Color of index 34*/
-  0x34, 0x3a, 0xee, 0xff, 	/*Color of index 35*/
-  0x37, 0x3c, 0xe3, 0xff, 	/*Color of index 36*/
-  0x52, 0x51, 0x8f, 0xff, 	/*Color of index 37*/
-  0x42, 0x40, 0xc5, 0xff, 	/*Color of index 38*/
-  0x35, 0x3b, 0xda, 0xff, 	/*Color of index 39*/
-  0x40, 0x39, 0xda, 0xff, 	/*Color of index 40*/
-  0x38, 0x3c, 0xd2, 0xff, 	/*Color of index 41*/
-  0x2e, 0x34, 0xee, 0xff, 	/*Color of index 42*/
-  0x31, 0x31, 0xf7, 0xff, 	/*Color of index 43*/
-  0x38, 0x3d, 0xca, 0xff, 	/*Color of index 44*/
-  0x2c, 0x36, 0xe1, 0xff, 	/*Color of index 45*/
-  0x37, 0x34, 0xdf, 0xff, 	/*Color of index 46*/
-  0x22, 0x31, 0xee, 0xff, 	/*Color of index 47*/
-  0x28, 0x2c, 0xfa, 0xff, 	/*Color of index 48*/
-  0x32, 0x30, 0xe9, 0xff, 	/*Color of index 49*/
-  0x37, 0x3c, 0xbe, 0xff, 	/*Color of index 50*/
-  0x42, 0x3f, 0xb0, 0xff, 	/*Color of index 51*/
-  0x51, 0x4f, 0x6d, 0xff, 	/*Color of index 52*/
-  0x2a, 0x2b, 0xf2, 0xff, 	/*Color of index 53*/
-  0x2f, 0x35, 0xce, 0xff, 	/*Color of index 54*/
-  0x24, 0x29, 0xfa, 0xff, 	/*Color of index 55*/
-  0x21, 0x2a, 0xf3, 0xff, 	/*Color of index 56*/
-  0x34, 0x31, 0xd3, 0xff, 	/*Color of index 57*/
-  0x36, 0x3b, 0xb0, 0xff, 	/*Color of index 58*/
-  0x1a, 0x2b, 0xed, 0xff, 	/*Color of index 59*/
-  0x2d, 0x36, 0xc1, 0xff, 	/*Color of index 60*/
-  0x1c, 0x27, 0xf9, 0xff, 	/*Color of index 61*/
-  0x26, 0x2a, 0xeb, 0xff, 	/*Color of index 62*/
-  0x1c, 0x28, 0xf3, 0xff, 	/*Color of index 63*/
-  0x38, 0x34, 0xbf, 0xff, 	/*Color of index 64*/
-  0x24, 0x2c, 0xe0, 0xff, 	/*Color of index 65*/
-  0x20, 0x24, 0xfb, 0xff, 	/*Color of index 66*/
-  0x33, 0x2b, 0xdc, 0xff, 	/*Color of index 67*/
-  0x15, 0x27, 0xf3, 0xff, 	/*Color of index 68*/
-  0x1d, 0x24, 0xf9, 0xff, 	/*Color of index 69*/
-  0x29, 0x24, 0xf4, 0xff, 	/*Color of index 70*/
-  0x14, 0x24, 0xfb, 0xff, 	/*Color of index 71*/
-  0x33, 0x2f, 0xca, 0xff, 	/*Color of index 72*/
-  0x25, 0x21, 0xfd, 0xff, 	/*Color of index 73*/
-  0x29, 0x29, 0xdf, 0xff, 	/*Color of index 74*/
-  0x1c, 0x24, 0xf4, 0xff, 	/*Color of index 75*/
-  0x1b, 0x29, 0xe1, 0xff, 	/*Color of index 76*/
-  0x3b, 0x3a, 0x9b, 0xff, 	/*Color of index 77*/
-  0x21, 0x22, 0xf4, 0xff, 	/*Color of index 78*/
-  0x2d, 0x34, 0xae, 0xff, 	/*Color of index 79*/
-  0x34, 0x31, 0xb5, 0xff, 	/*Color of index 80*/
-  0x29, 0x2a, 0xcf, 0xff, 	/*Color of index 81*/
-  0x18, 0x23, 0xeb, 0xff, 	/*Color of index 82*/
-  0x24, 0x22, 0xea, 0xff, 	/*Color of index 83*/
-  0x22, 0x1c, 0xfd, 0xff, 	/*Color of index 84*/
-  0x1b, 0x1d, 0xfb, 0xff, 	/*Color of index 85*/
-  0x14, 0x1d, 0xfb, 0xff, 	/*Color of index 86*/
-  0x19, 0x28, 0xd1, 0xff, 	/*Color of index 87*/
-  0x19, 0x23, 0xe0, 0xff, 	/*Color of index 88*/
-  0x33, 0x2a, 0xbf, 0xff, 	/*Color of index 89*/
-  0x3d, 0x3c, 0x7f, 0xff, 	/*Color of index 90*/
-  0x25, 0x2b, 0xbf, 0xff, 	/*Color of index 91*/
-  0x1b, 0x1d, 0xf0, 0xff, 	/*Color of index 92*/
-  0x23, 0x20, 0xe3, 0xff, 	/*Color of index 93*/
-  0x33, 0x2f, 0xab, 0xff, 	/*Color of index 94*/
-  0x2a, 0x33, 0x9a, 0xff, 	/*Color of index 95*/
-  0x23, 0x22, 0xd3, 0xff, 	/*Color of index 96*/
-  0x31, 0x2f, 0xa2, 0xff, 	/*Color of index 97*/
-  0x23, 0x24, 0xcb, 0xff, 	/*Color of index 98*/
-  0x22, 0x1f, 0xda, 0xff, 	/*Color of index 99*/
-  0x19, 0x20, 0xd3, 0xff, 	/*Color of index 100*/
-  0x41, 0x3f, 0x5c, 0xff, 	/*Color of index 101*/
-  0x27, 0x29, 0xad, 0xff, 	/*Color of index 102*/
-  0x13, 0x17, 0xef, 0xff, 	/*Color of index 103*/
-  0x32, 0x2e, 0x95, 0xff, 	/*Color of index 104*/
-  0x25, 0x22, 0xbf, 0xff, 	/*Color of index 105*/
-  0x19, 0x18, 0xe4, 0xff, 	/*Color of index 106*/
-  0x1b, 0x1d, 0xcb, 0xff, 	/*Color of index 107*/
-  0x19, 0x20, 0xc0, 0xff, 	/*Color of index 108*/
-  0x32, 0x30, 0x80, 0xff, 	/*Color of index 109*/
-  0x1b, 0x18, 0xd8, 0xff, 	/*Color of index 110*/
-  0x29, 0x26, 0x9f, 0xff, 	/*Color of index 111*/
-  0x29, 0x2b, 0x89, 0xff, 	/*Color of index 112*/
-  0x26, 0x25, 0x93, 0xff, 	/*Color of index 113*/
-  0x34, 0x30, 0x5e, 0xff, 	/*Color of index 114*/
-  0x1b, 0x19, 0xb0, 0xff, 	/*Color of index 115*/
-  0x21, 0x23, 0x86, 0xff, 	/*Color of index 116*/
-  0x12, 0x10, 0xc5, 0xff, 	/*Color of index 117*/
-  0x1d, 0x1c, 0x96, 0xff, 	/*Color of index 118*/
-  0x21, 0x24, 0x78, 0xff, 	/*Color of index 119*/
-  0x1f, 0x1c, 0x84, 0xff, 	/*Color of index 120*/
-  0x28, 0x2c, 0x49, 0xff, 	/*Color of index 121*/
-  0x1e, 0x21, 0x63, 0xff, 	/*Color of index 122*/
-  0x1d, 0x1b, 0x75, 0xff, 	/*Color of index 123*/
-  0x11, 0x11, 0x88, 0xff, 	/*Color of index 124*/
-  0x09, 0x07, 0xa9, 0xff, 	/*Color of index 125*/
-  0x16, 0x16, 0x6b, 0xff, 	/*Color of index 126*/
-  0x14, 0x13, 0x74, 0xff, 	/*Color of index 127*/
-  0x19, 0x19, 0x5e, 0xff, 	/*Color of index 128*/
-  0x23, 0x1e, 0x39, 0xff, 	/*Color of index 129*/
-  0x11, 0x11, 0x5f, 0xff, 	/*Color of index 130*/
-  0x12, 0x12, 0x50, 0xff, 	/*Color of index 131*/
-  0x0b, 0x0a, 0x68, 0xff, 	/*Color of index 132*/
-  0x0b, 0x0a, 0x59, 0xff, 	/*Color of index 133*/
-  0x0b, 0x0b, 0x4e, 0xff, 	/*Color of index 134*/
-  0x11, 0x0e, 0x37, 0xff, 	/*Color of index 135*/
-  0x0a, 0x0b, 0x43, 0xff, 	/*Color of index 136*/
-  0x05, 0x04, 0x4f, 0xff, 	/*Color of index 137*/
-  0x12, 0x0e, 0x28, 0xff, 	/*Color of index 138*/
-  0x08, 0x07, 0x38, 0xff, 	/*Color of index 139*/
-  0x03, 0x03, 0x43, 0xff, 	/*Color of index 140*/
-  0x02, 0x01, 0x3b, 0xff, 	/*Color of index 141*/
-  0x08, 0x06, 0x26, 0xff, 	/*Color of index 142*/
-  0x01, 0x01, 0x32, 0xff, 	/*Color of index 143*/
-  0x00, 0x00, 0x2b, 0xff, 	/*Color of index 144*/
-  0x00, 0x00, 0x23, 0xff, 	/*Color of index 145*/
-  0x00, 0x00, 0x1a, 0xff, 	/*Color of index 146*/
-  0x01, 0x00, 0x13, 0xff, 	/*Color of index 147*/
-  0x02, 0x00, 0x0b, 0xff, 	/*Color of index 148*/
-  0xf0, 0xf9, 0xfc, 0xff, 	/*Color of index 149*/
-  0xe2, 0xed, 0xfd, 0xff, 	/*Color of index 150*/
-  0x04, 0x08, 0x0a, 0xff, 	/*Color of index 151*/
-  0xfd, 0xfe, 0xfd, 0xff, 	/*Color of index 152*/
-  0x04, 0x08, 0x01, 0xff, 	/*Color of index 153*/
-  0xfc, 0xfc, 0xf1, 0xff, 	/*Color of index 154*/
-  0xfa, 0xf9, 0xe9, 0xff, 	/*Color of index 155*/
-  0xf3, 0xf4, 0xee, 0xff, 	/*Color of index 156*/
-  0xfb, 0xf8, 0xd7, 0xff, 	/*Color of index 157*/
-  0xf7, 0xf3, 0xe3, 0xff, 	/*Color of index 158*/
-  0xf2, 0xeb, 0xd7, 0xff, 	/*Color of index 159*/
-  0xf8, 0xf0, 0xba, 0xff, 	/*Color of index 160*/
-  0xe9, 0xe0, 0xc3, 0xff, 	/*Color of index 161*/
-  0xef, 0xdf, 0xa5, 0xff, 	/*Color of index 162*/
-  0xd7, 0xd4, 0xc4, 0xff, 	/*Color of index 163*/
-  0xe2, 0xd0, 0x98, 0xff, 	/*Color of index 164*/
-  0xc5, 0xc3, 0xba, 0xff, 	/*Color of index 165*/
-  0xd0, 0xc0, 0x93, 0xff, 	/*Color of index 166*/
-  0xdd, 0xc4, 0x7b, 0xff, 	/*Color of index 167*/
-  0xb9, 0xb5, 0xa7, 0xff, 	/*Color of index 168*/
-  0xd1, 0xb8, 0x76, 0xff, 	/*Color of index 169*/
-  0xd6, 0xbb, 0x66, 0xff, 	/*Color of index 170*/
-  0xcb, 0xb4, 0x67, 0xff, 	/*Color of index 171*/
-  0xd1, 0xb1, 0x5b, 0xff, 	/*Color of index 172*/
-  0xd2, 0xb3, 0x53, 0xff, 	/*Color of index 173*/
-  0xcc, 0xb0, 0x53, 0xff, 	/*Color of index 174*/
-  0xd1, 0xb1, 0x4c, 0xff, 	/*Color of index 175*/
-  0xd1, 0xad, 0x54, 0xff, 	/*Color of index 176*/
-  0xcb, 0xac, 0x59, 0xff, 	/*Color of index 177*/
-  0xcd, 0xad, 0x54, 0xff, 	/*Color of index 178*/
-  0xcc, 0xae, 0x4d, 0xff, 	/*Color of index 179*/
-  0xc3, 0xaa, 0x54, 0xff, 	/*Color of index 180*/
-  0xca, 0xa8, 0x48, 0xff, 	/*Color of index 181*/
-  0xc3, 0xa3, 0x55, 0xff, 	/*Color of index 182*/
-  0xb4, 0x9e, 0x50, 0xff, 	/*Color of index 183*/
-  0x6a, 0x68, 0x63, 0xff, 	/*Color of index 184*/
-  0x14, 0x0f, 0x01, 0xff, 	/*Color of index 185*/
-  0x0c, 0x0f, 0x00, 0xff, 	/*Color of index 186*/
-  0x0e, 0x0b, 0x03, 0xff, 	/*Color of index 187*/
-  0xe6, 0xe2, 0xdc, 0xff, 	/*Color of index 188*/
-  0xab, 0xa8, 0xa5, 0xff, 	/*Color of index 189*/
-  0xd4, 0xb2, 0x65, 0xff, 	/*Color of index 190*/
-  0xc7, 0xae, 0x75, 0xff, 	/*Color of index 191*/
-  0xce, 0xab, 0x62, 0xff, 	/*Color of index 192*/
-  0xd1, 0xac, 0x58, 0xff, 	/*Color of index 193*/
-  0xa7, 0x9e, 0x8e, 0xff, 	/*Color of index 194*/
-  0xc0, 0xa5, 0x67, 0xff, 	/*Color of index 195*/
-  0xb3, 0x99, 0x65, 0xff, 	/*Color of index 196*/
-  0x95, 0x91, 0x8a, 0xff, 	/*Color of index 197*/
-  0xba, 0x97, 0x4f, 0xff, 	/*Color of index 198*/
-  0xb2, 0x91, 0x4c, 0xff, 	/*Color of index 199*/
-  0xa5, 0x8b, 0x56, 0xff, 	/*Color of index 200*/
-  0xae, 0x87, 0x41, 0xff, 	/*Color of index 201*/
-  0x84, 0x7c, 0x6b, 0xff, 	/*Color of index 202*/
-  0x96, 0x7e, 0x53, 0xff, 	/*Color of index 203*/
-  0x9b, 0x7b, 0x3b, 0xff, 	/*Color of index 204*/
-  0x89, 0x71, 0x4a, 0xff, 	/*Color of index 205*/
-  0x8c, 0x6d, 0x43, 0xff, 	/*Color of index 206*/
-  0x91, 0x6b, 0x2b, 0xff, 	/*Color of index 207*/
-  0x7a, 0x63, 0x3b, 0xff, 	/*Color of index 208*/
-  0x8e, 0x61, 0x2c, 0xff, 	/*Color of index 209*/
-  0x8a, 0x60, 0x26, 0xff, 	/*Color of index 210*/
-  0x90, 0x62, 0x1a, 0xff, 	/*Color of index 211*/
-  0x88, 0x5d, 0x2b, 0xff, 	/*Color of index 212*/
-  0x78, 0x5a, 0x33, 0xff, 	/*Color of index 213*/
-  0x85, 0x5a, 0x2b, 0xff, 	/*Color of index 214*/
-  0x57, 0x52, 0x4e, 0xff, 	/*Color of index 215*/
-  0x84, 0x59, 0x24, 0xff, 	/*Color of index 216*/
-  0x81, 0x58, 0x1d, 0xff, 	/*Color of index 217*/
-  0x68, 0x53, 0x2c, 0xff, 	/*Color of index 218*/
-  0x5f, 0x49, 0x27, 0xff, 	/*Color of index 219*/
-  0x47, 0x42, 0x3e, 0xff, 	/*Color of index 220*/
-  0x50, 0x3c, 0x1d, 0xff, 	/*Color of index 221*/
-  0x32, 0x2c, 0x2b, 0xff, 	/*Color of index 222*/
-  0x43, 0x30, 0x12, 0xff, 	/*Color of index 223*/
-  0x3a, 0x29, 0x1b, 0xff, 	/*Color of index 224*/
-  0x28, 0x23, 0x21, 0xff, 	/*Color of index 225*/
-  0x39, 0x23, 0x0e, 0xff, 	/*Color of index 226*/
-  0x2e, 0x19, 0x08, 0xff, 	/*Color of index 227*/
-  0x1c, 0x15, 0x10, 0xff, 	/*Color of index 228*/
-  0x15, 0x0f, 0x0a, 0xff, 	/*Color of index 229*/
-  0x20, 0x0e, 0x01, 0xff, 	/*Color of index 230*/
-  0x18, 0x0b, 0x02, 0xff, 	/*Color of index 231*/
-  0x13, 0x0a, 0x04, 0xff, 	/*Color of index 232*/
-  0x18, 0x05, 0x01, 0xff, 	/*Color of index 233*/
-  0x0a, 0x02, 0x01, 0xff, 	/*Color of index 234*/
-  0x85, 0x81, 0x82, 0xff, 	/*Color of index 235*/
-  0x3a, 0x33, 0x35, 0xff, 	/*Color of index 236*/
-  0x16, 0x0a, 0x0a, 0xff, 	/*Color of index 237*/
-  0x13, 0x09, 0x09, 0xff, 	/*Color of index 238*/
-  0x0d, 0x08, 0x0a, 0xff, 	/*Color of index 239*/
-  0x13, 0x06, 0x0b, 0xff, 	/*Color of index 240*/
-  0x19, 0x05, 0x0b, 0xff, 	/*Color of index 241*/
-  0x10, 0x05, 0x04, 0xff, 	/*Color of index 242*/
-  0x02, 0x00, 0x00, 0xff, 	/*Color of index 243*/
-  0xec, 0xea, 0xec, 0xff, 	/*Color of index 244*/
-  0xb5, 0xb2, 0xb5, 0xff, 	/*Color of index 245*/
-  0x19, 0x0d, 0x1a, 0xff, 	/*Color of index 246*/
-  0x12, 0x0a, 0x10, 0xff, 	/*Color of index 247*/
-  0x14, 0x04, 0x11, 0xff, 	/*Color of index 248*/
-  0x0b, 0x04, 0x0a, 0xff, 	/*Color of index 249*/
-  0xc8, 0xc7, 0xca, 0xff, 	/*Color of index 250*/
-  0xa2, 0x9f, 0xa3, 0xff, 	/*Color of index 251*/
-  0x95, 0x8f, 0x9f, 0xff, 	/*Color of index 252*/
-  0x1f, 0x19, 0x22, 0xff, 	/*Color of index 253*/
-  0x0c, 0x04, 0x19, 0xff, 	/*Color of index 254*/
-  0x09, 0x04, 0x11, 0xff, 	/*Color of index 255*/
-
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf0, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf0, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xf7, 0xef, 0xee, 0xe8, 0xf1, 0xed, 0xf0, 0xed, 0xee, 0xed, 0xf2, 0xed, 0xee, 0xee, 0xf0, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xe7, 0xe8, 0xe8, 0xed, 0xee, 0xed, 0xe7, 0xe7, 0xe5, 0xf1, 0xee, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xf0, 0xf7, 0xef, 0xed, 0xe7, 0xe7, 0xed, 0xf0, 0xf0, 0xf2, 0xe5, 0xe7, 0xed, 0xe8, 0xee, 0xef, 0xf0, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xe8, 0xee, 0xf8, 0xef, 0xee, 0xb9, 0xb9, 0xe7, 0xee, 0xef, 0xbb, 0xb9, 0xe7, 0xe6, 0xed, 0xf8, 0xee, 0xf7, 0xbb, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf0, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xf7, 0xef, 0xee, 0xe5, 0xe7, 0xe8, 0xe8, 0x97, 0xf7, 0xef, 0xef, 0xef, 0xe8, 0xee, 0xe8, 0xe8, 0xe7, 0xe8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xf7, 0xe8, 0xb9, 0xba, 0xe8, 0xee, 0xf7, 0xf7, 0xee, 0xe5, 0xf0, 0xf0, 0xf8, 0xf0, 0xb9, 0xe8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xee, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xf7, 0xf8, 0xee, 0xed, 0xe7, 0xef, 0xbb, 0xf3, 0x94, 0x94, 0x94, 0xf3, 0xff, 0xef, 0xef, 0xbb, 0xe7, 0xb9, 0xe7, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xf0, 0xf0, 0xed, 0xe8, 0xb9, 0xba, 0xe5, 0xf0, 0xff, 0x94, 0xf3, 0xf3, 0xf3, 0x94, 0xf9, 0xed, 0xe7, 0xe7, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xf7, 0xee, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf7, 0xef, 0xed, 0xe7, 0xed, 0xff, 0x93, 0x34, 0x0d, 0x06, 0x0a, 0x14, 0x81, 0x93, 0xff, 0xf0, 0xe7, 0xe7, 0xe7, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf7, 0xee, 0xbb, 0xb9, 0xbb, 0x97, 0x93, 0x8e, 0x34, 0x0d, 0x06, 0x0a, 0x1c, 0x8a, 0xf3, 0xe5, 0xe8, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xf7, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xf7, 0xee, 0xf7, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xe5, 0xee, 0xe6, 0xf1, 0xf8, 0x92, 0x18, 0x07, 0x07, 0x0a, 0x02, 0x00, 0x03, 0x34, 0x94, 0xff, 0xf0, 0xe7, 0xe7, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf0, 0xed, 0xe8, 0xba, 0xf7, 0x93, 0x8a, 0x0f, 0x02, 0x03, 0x06, 0x03, 0x96, 0x06, 0x81, 0xf3, 0xed, 0xf2, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xbb, 0xbb, 0xe7, 0xf7, 0x94, 0x1c, 0x0b, 0x13, 0x25, 0x81, 0x87, 0x34, 0x08, 0x00, 0x34, 0x93, 0xff, 0xf0, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xe5, 0xea, 0xf6, 0x91, 0x18, 0x05, 0x13, 0x87, 0x8e, 0x8a, 0x14, 0x02, 0x06, 0xfd, 0xff, 0xe8, 0xf0, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xb9, 0xe9, 0xf9, 0x87, 0x09, 0x18, 0x72, 0x8e, 0x81, 0xf7, 0x94, 0x81, 0x08, 0x06, 0x87, 0x94, 0xff, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xff, 0x93, 0x72, 0x0c, 0x13, 0x8e, 0x92, 0xf9, 0xff, 0x94, 0x1b, 0x00, 0x1c, 0xf3, 0xef, 0xf2, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xef, 0xe5, 0xee, 0x94, 0x34, 0x0c, 0x25, 0x93, 0xe6, 0xe3, 0xe9, 0xe5, 0xf3, 0x65, 0x00, 0x34, 0x94, 0xf0, 0xef, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xed, 0xf0, 0xed, 0xee, 0xff, 0x91, 0x18, 0x0b, 0x80, 0x94, 0xf7, 0xe6, 0xe3, 0xe6, 0xea, 0x04, 0x06, 0xf3, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xf9, 0xff, 0x1c, 0x08, 0x79, 0xf3, 0xe3, 0xe9, 0xe7, 0xe9, 0xef, 0xf8, 0x96, 0x14, 0x94, 0x97, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xbb, 0xe8, 0xed, 0xf0, 0xed, 0x94, 0x8b, 0x17, 0x0b, 0x91, 0xf8, 0xed, 0xe6, 0xe2, 0xe2, 0xf9, 0xeb, 0x04, 0x94, 0xf2, 0xf2, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xe7, 0xed, 0xfe, 0x92, 0x1c, 0x04, 0x79, 0xb9, 0xf2, 0xe9, 0xf8, 0xe8, 0xbb, 0xf3, 0x01, 0xfc, 0x93, 0x97, 0x99, 0xed, 0xe8, 0xed, 0xe8, 0xed, 0xe8, 0xed, 0xe8, 0xe8, 0xba, 0xba, 0xf8, 0xf8, 0xe5, 0x99, 0x88, 0x17, 0x0c, 0x92, 0xf1, 0xf7, 0xed, 0xe5, 0xe8, 0xf3, 0xb8, 0xbc, 0xf3, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xed, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf2, 0xf7, 0x94, 0x65, 0x00, 0x1b, 0xf3, 0xb9, 0xf2, 0xe5, 0x99, 0xbb, 0xef, 0x00, 0x18, 0x94, 0xff, 0xee, 0xe8, 0xed, 0xe8, 0xed, 0xe8, 0xed, 0xe8, 0xee, 0xe5, 0xbb, 0xb9, 0xf8, 0xf8, 0xb9, 0xf2, 0x8b, 0x1d, 0x09, 0x81, 0xea, 0xe8, 0xe5, 0xe7, 0xe5, 0xea, 0xfb, 0xbd, 0xf3, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xee, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xf1, 0xbb, 0xf3, 0xfd, 0x02, 0x04, 0xfe, 0xea, 0xbb, 0xf2, 0xb9, 0xf3, 0x1b, 0x95, 0x34, 0x94, 0xef, 0xe8, 0xed, 0xed, 0xed, 0xed, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xed, 0xe8, 0xf0, 0xed, 0xe7, 0xe5, 0x91, 0x22, 0x10, 0xfc, 0xf3, 0xf3, 0xea, 0xbb, 0xf3, 0xde, 0x00, 0x65, 0xea, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xf8, 0xee, 0xb9, 0xba, 0xf3, 0x14, 0x01, 0x04, 0xd7, 0xf2, 0xf3, 0xf3, 0xeb, 0x95, 0x0f, 0x8e, 0x93, 0xf2, 0xbb, 0xed, 0xbb, 0xed, 0xe8, 0xee, 0xe8, 0xf2, 0xe8, 0xf2, 0xed, 0xf0, 0xed, 0xed, 0xba, 0xbb, 0x92, 0x7a, 0x22, 0x05, 0xfa, 0x65, 0xe1, 0xe1, 0x1b, 0xf4, 0xeb, 0x94, 0xf7, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xed, 0xed, 0xee, 0xee, 0xee, 0xef, 0xf8, 0xee, 0xba, 0xb9, 0x99, 0x8a, 0x0f, 0x02, 0x00, 0xfa, 0x06, 0xfa, 0x01, 0x08, 0x79, 0x93, 0xf7, 0xe7, 0xb9, 0xe8, 0xee, 0xbb, 0xee, 0xbb, 0xef, 0xe8, 0xef, 0xe8, 0xf0, 0xed, 0xf1, 0xe7, 0xe7, 0xef, 0x93, 0x8f, 0x5a, 0x25, 0x0c, 0x01, 0x02, 0xbc, 0x00, 0xbd, 0xf8, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xf2, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf2, 0xed, 0xed, 0xf2, 0xef, 0xee, 0xed, 0xed, 0xed, 0xf0, 0xf0, 0xb9, 0xb9, 0xbb, 0x94, 0x8a, 0x18, 0x0d, 0x08, 0x0d, 0x0a, 0x14, 0x79, 0x93, 0x94, 0xee, 0xbb, 0xe6, 0xef, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xf7, 0xf0, 0xe7, 0xb9, 0xee, 0xef, 0xf7, 0x93, 0x8c, 0x4d, 0x22, 0x17, 0x0d, 0x0d, 0xeb, 0xe4, 0xf3, 0xef, 0xf0, 0xf2, 0xee, 0xf2, 0xef, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xf0, 0xe8, 0xe8, 0xef, 0x93, 0x87, 0x5a, 0x25, 0x1c, 0x5a, 0x92, 0x92, 0xf8, 0xf7, 0xe5, 0xe9, 0xbb, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xf7, 0xe8, 0xe7, 0xf0, 0xf8, 0xba, 0xbb, 0x92, 0x89, 0x7c, 0x5a, 0x5a, 0x65, 0xf8, 0xf3, 0xe5, 0xed, 0xe8, 0xee, 0xef, 0xee, 0xf2, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xf3, 0xf2, 0xed, 0xee, 0xee, 0xef, 0xbb, 0xef, 0xf8, 0xf8, 0xed, 0x99, 0xff, 0x8d, 0x4d, 0x7e, 0x94, 0x93, 0x93, 0xf0, 0xe7, 0xe8, 0xe9, 0xf7, 0xf0, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xbb, 0xee, 0xbb, 0xe7, 0xfe, 0xf8, 0xba, 0xb9, 0xfe, 0x8c, 0x77, 0x6d, 0x91, 0x94, 0x97, 0xe5, 0xf2, 0xee, 0xf9, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf2, 0xf2, 0xef, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xf3, 0xee, 0xde, 0xe1, 0xea, 0xef, 0xee, 0xee, 0xba, 0xee, 0xf8, 0xf8, 0xf1, 0xb9, 0x97, 0x90, 0x71, 0x4d, 0xfe, 0xfe, 0xef, 0xe9, 0xe6, 0xb9, 0xee, 0xf8, 0xf8, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xba, 0xed, 0xbb, 0xf7, 0xf8, 0xf8, 0xb9, 0xb9, 0xef, 0x8c, 0x4d, 0x7a, 0x93, 0xfe, 0x97, 0xea, 0xef, 0xf0, 0xed, 0xf2, 0xee, 0xf2, 0xee, 0xea, 0xea, 0xe5, 0xef, 0xea, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xf3, 0xe1, 0xf5, 0x9c, 0x95, 0xd7, 0xea, 0xee, 0xef, 0xba, 0xef, 0xf8, 0xf8, 0xf1, 0xba, 0xbb, 0x92, 0x7e, 0x22, 0x8d, 0x99, 0xe5, 0xf1, 0xe8, 0xbb, 0xf0, 0xf0, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xee, 0xe8, 0xb9, 0xbb, 0xfe, 0xfe, 0xee, 0xb9, 0xf2, 0xff, 0x99, 0x84, 0x33, 0x87, 0x97, 0xba, 0xee, 0xf0, 0xf8, 0xe8, 0xed, 0xf2, 0xee, 0xee, 0xea, 0xe4, 0xc5, 0x04, 0xa5, 0xdc, 0xea, 0xee, 0xef, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf2, 0xf2, 0xea, 0xbd, 0x98, 0x9c, 0x9c, 0x98, 0xdc, 0xf3, 0xee, 0xbb, 0xee, 0xff, 0xf8, 0xe8, 0xe7, 0x99, 0x93, 0x8b, 0x33, 0x7b, 0xf3, 0xe7, 0xf1, 0xee, 0xbb, 0xf0, 0xee, 0xe7, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xe8, 0xb9, 0xb9, 0xfe, 0xfe, 0xe8, 0xb9, 0xf0, 0xfe, 0x94, 0x76, 0x33, 0x90, 0xef, 0xb9, 0xee, 0xff, 0xf0, 0xee, 0xe7, 0xed, 0xf0, 0xee, 0xf3, 0xfa, 0x98, 0x9a, 0x98, 0x95, 0xe0, 0x94, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xf9, 0xe8, 0x04, 0x9c, 0x9c, 0xf4, 0x95, 0xb8, 0xf3, 0xed, 0xbb, 0xbb, 0xf8, 0xf1, 0xe8, 0xb9, 0xbb, 0xff, 0x90, 0x70, 0x4d, 0x93, 0xf2, 0xf0, 0xe8, 0xb9, 0xef, 0xf1, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xe8, 0xee, 0xef, 0xee, 0xee, 0xe7, 0xee, 0xff, 0x90, 0x33, 0x68, 0x92, 0xee, 0xbb, 0xee, 0xf0, 0xf8, 0xe8, 0xee, 0xf2, 0xee, 0xea, 0xde, 0x95, 0x9c, 0xbc, 0xf4, 0x98, 0xdc, 0xea, 0xed, 0xf2, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xee, 0xf3, 0xfb, 0x98, 0xbc, 0xf4, 0x98, 0xdc, 0xea, 0xef, 0xe5, 0xef, 0xf0, 0xf0, 0xe8, 0xb9, 0xbb, 0x97, 0x92, 0x84, 0x33, 0x87, 0x94, 0xee, 0xb9, 0xe7, 0xee, 0xf8, 0xf0, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xf7, 0xbb, 0xba, 0xe8, 0xee, 0xe5, 0x93, 0x85, 0x20, 0x83, 0x91, 0xef, 0xb9, 0xe8, 0xff, 0xf0, 0xee, 0xe8, 0xee, 0xed, 0xea, 0xe1, 0x9c, 0xf4, 0x04, 0xf4, 0xbc, 0xfd, 0xea, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xef, 0xee, 0xea, 0xde, 0xfa, 0x9c, 0xf4, 0xeb, 0xf9, 0xed, 0xf0, 0xe8, 0xee, 0xf0, 0xee, 0xe8, 0xb9, 0xbb, 0xef, 0x94, 0x8b, 0x4d, 0x80, 0x92, 0xef, 0xe7, 0xb9, 0xe8, 0xf8, 0xf0, 0xee, 0xbb, 0xee, 0xbb, 0xee, 0xbb, 0xee, 0xbb, 0xee, 0xee, 0xf0, 0xba, 0xb9, 0xe8, 0xf8, 0xbb, 0x91, 0x78, 0x22, 0x88, 0xfe, 0xe8, 0xbb, 0xe8, 0xef, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xee, 0xea, 0xb8, 0xbc, 0x9c, 0xbc, 0xd7, 0xea, 0xef, 0xe5, 0xf2, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xf3, 0xe4, 0xdc, 0xec, 0xf3, 0xef, 0xe8, 0xee, 0xed, 0xef, 0xf0, 0xee, 0xe8, 0xbb, 0xe7, 0xef, 0xef, 0x90, 0x6d, 0x5a, 0x92, 0xf7, 0xbb, 0xe7, 0xe7, 0xf8, 0xf0, 0xee, 0xe8, 0xee, 0xee, 0xe8, 0xee, 0xbb, 0xee, 0xee, 0xf0, 0xf0, 0xba, 0xb9, 0xbb, 0xf8, 0xf9, 0x8f, 0x50, 0x6d, 0x91, 0xfe, 0xee, 0xe7, 0xe8, 0xef, 0xef, 0xee, 0xe8, 0xee, 0xee, 0xee, 0xef, 0xea, 0xe1, 0xd7, 0xe1, 0xea, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xf9, 0xea, 0xea, 0xe5, 0xf2, 0xf7, 0xee, 0xef, 0xbb, 0xee, 0xe8, 0xee, 0xee, 0xee, 0xef, 0xee, 0x94, 0x80, 0x33, 0x8f, 0x97, 0xee, 0xe7, 0xe7, 0xef, 0xef, 0xee, 0xe8, 0xed, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xe8, 0xee, 0xef, 0xbb, 0xb9, 0xe8, 0xf7, 0x93, 0x82, 0x20, 0x83, 0x93, 0xf0, 0xed, 0xbb, 0xbb, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xea, 0xf3, 0xea, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xea, 0xed, 0xef, 0xee, 0xef, 0xed, 0xed, 0xee, 0xed, 0xe8, 0xbb, 0xbb, 0xef, 0xf0, 0xf0, 0xf0, 0xee, 0x97, 0x8b, 0x22, 0x8b, 0x93, 0xf0, 0xee, 0xe7, 0xe8, 0xef, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xf0, 0xf0, 0xe8, 0xe5, 0x92, 0x78, 0x33, 0x8f, 0xff, 0xf0, 0xed, 0xe7, 0xbb, 0xbb, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xee, 0xe5, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xbb, 0xee, 0xef, 0xf2, 0xed, 0xed, 0xee, 0xbb, 0xe8, 0xbb, 0xee, 0xf8, 0xf8, 0xf8, 0xe8, 0xba, 0x92, 0x4d, 0x7a, 0x93, 0xf0, 0xf1, 0xe6, 0xbb, 0xef, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xbb, 0xe8, 0xfe, 0xf8, 0xb9, 0x99, 0x8f, 0x3a, 0x5f, 0x93, 0xef, 0xed, 0xe9, 0xe8, 0xbb, 0xef, 0xee, 0xf1, 0xf0, 0xee, 0xee, 0xee, 0xed, 0xed, 0xe5, 0xf2, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xed, 0xe8, 0xed, 0xef, 0xf0, 0xee, 0xf0, 0xbb, 0x94, 0x7b, 0x4d, 0x91, 0x92, 0xf1, 0xb9, 0xbb, 0xfe, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xba, 0xf0, 0xf1, 0xf1, 0xbb, 0x97, 0x89, 0x26, 0x7b, 0xf3, 0xf0, 0xee, 0xee, 0xe8, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xe8, 0xf9, 0x86, 0x33, 0x87, 0x91, 0xed, 0xb9, 0xee, 0xff, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xee, 0xe8, 0xba, 0xf1, 0xf1, 0xee, 0xba, 0x92, 0x77, 0x40, 0x88, 0xf9, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xf1, 0xed, 0xee, 0xed, 0xee, 0xee, 0xe8, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xf2, 0xee, 0xff, 0x90, 0x22, 0x7a, 0x93, 0xf8, 0xb9, 0xbb, 0xff, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xe8, 0xee, 0xee, 0xe8, 0xed, 0xe7, 0x99, 0x90, 0x4f, 0x61, 0x90, 0xf2, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xf1, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe7, 0xed, 0xe8, 0xed, 0xe8, 0xee, 0xe8, 0xee, 0xbb, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0x92, 0x6d, 0x4d, 0x93, 0xf8, 0xe8, 0xe8, 0xef, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xff, 0xe7, 0xe7, 0xbb, 0x97, 0x8c, 0x26, 0x7b, 0x93, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xf1, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xed, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xee, 0xed, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xff, 0x94, 0x7a, 0x20, 0x92, 0xff, 0xef, 0xee, 0xee, 0xe8, 0xee, 0xbb, 0xee, 0xbb, 0xee, 0xbb, 0xee, 0xee, 0xff, 0xb9, 0xe8, 0xe7, 0xff, 0x7e, 0x1f, 0x88, 0xff, 0xbb, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xe5, 0xf2, 0xed, 0xed, 0xe8, 0xed, 0xf2, 0xef, 0xe5, 0xf2, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xf7, 0xf9, 0x97, 0x8b, 0x1d, 0x87, 0x92, 0xff, 0xe8, 0xed, 0xee, 0xbb, 0xee, 0xbb, 0xee, 0xbb, 0xee, 0xe8, 0xef, 0xff, 0xb9, 0xe7, 0xef, 0x92, 0x68, 0x32, 0x90, 0xbb, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf2, 0xee, 0xf0, 0xf2, 0xed, 0xf2, 0xf2, 0xf2, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf7, 0xee, 0xef, 0xef, 0xea, 0xf9, 0xea, 0xf3, 0xea, 0xed, 0xf2, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf9, 0xf0, 0x99, 0x92, 0x4d, 0x6d, 0x92, 0xef, 0xee, 0xe8, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xef, 0xf2, 0xed, 0xf9, 0x8d, 0x3a, 0x68, 0x93, 0xbb, 0xe8, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xf3, 0xee, 0xea, 0xe5, 0xed, 0xef, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xf3, 0xf3, 0xf3, 0xf9, 0xe5, 0xfd, 0xde, 0xe1, 0xe1, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf9, 0xf7, 0xbb, 0x93, 0x6d, 0x3a, 0x92, 0x97, 0xed, 0xe9, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xba, 0xf0, 0xf8, 0x93, 0x85, 0x22, 0x7b, 0x93, 0xe7, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xf0, 0xea, 0xea, 0x99, 0xf3, 0xf3, 0xf3, 0xea, 0xf2, 0xee, 0xed, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf3, 0xf3, 0xde, 0xb8, 0xf5, 0xfa, 0x95, 0x98, 0x98, 0x98, 0xf5, 0xf2, 0xf2, 0xee, 0xed, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf9, 0xbb, 0x94, 0x83, 0x21, 0x8e, 0xbb, 0xee, 0xf1, 0xe8, 0xee, 0xee, 0xe8, 0xee, 0xe8, 0xee, 0xe8, 0xbb, 0xb9, 0xfe, 0xf8, 0x91, 0x7b, 0x33, 0x87, 0x93, 0xe7, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xea, 0xde, 0xfa, 0xbc, 0xfa, 0xbd, 0xb8, 0xde, 0xef, 0xf3, 0xf3, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xed, 0xf0, 0xf0, 0xef, 0xe5, 0x99, 0xf3, 0xe7, 0x65, 0xbd, 0xf4, 0x98, 0x98, 0x98, 0x95, 0x00, 0x06, 0x34, 0xe5, 0xf2, 0xf7, 0xf0, 0xf0, 0xee, 0xe7, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf9, 0xef, 0x97, 0x90, 0x1f, 0x82, 0x99, 0xe8, 0xf1, 0xed, 0xbb, 0xee, 0xe8, 0xee, 0xe8, 0xe8, 0xee, 0xbb, 0xba, 0xed, 0xf9, 0x90, 0x61, 0x3a, 0x8e, 0xee, 0xe9, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xe8, 0xe8, 0xf2, 0xef, 0xf0, 0xee, 0xea, 0xfd, 0xf5, 0x04, 0x00, 0x98, 0x98, 0x9c, 0xa5, 0xca, 0xfd, 0xea, 0xea, 0xbb, 0xbb, 0xef, 0xf7, 0xf7, 0xed, 0xe7, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xed, 0xf0, 0xf7, 0xf7, 0xf3, 0xf3, 0xd7, 0xfa, 0x98, 0x98, 0x95, 0x95, 0x96, 0x05, 0x12, 0x25, 0x8f, 0xea, 0x99, 0xbb, 0x97, 0xfe, 0xf1, 0xe4, 0xe9, 0xe7, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf0, 0x99, 0x92, 0x33, 0x74, 0x97, 0xba, 0xf1, 0xed, 0xbb, 0xed, 0xbb, 0xed, 0xbb, 0xee, 0xbb, 0xee, 0xef, 0xb9, 0xe8, 0x8d, 0x32, 0x68, 0x92, 0xe7, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xe8, 0xe8, 0xef, 0xf7, 0x97, 0xf0, 0xf1, 0xea, 0x94, 0x81, 0x25, 0x10, 0x07, 0x95, 0x95, 0x98, 0x00, 0xf5, 0xe1, 0xf3, 0xf2, 0xef, 0xef, 0xee, 0xe5, 0xe8, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf1, 0xf8, 0xee, 0xba, 0xf3, 0xde, 0xf5, 0x95, 0x98, 0x95, 0x95, 0x02, 0x09, 0x19, 0x48, 0x59, 0x7f, 0x92, 0xe5, 0xba, 0xe8, 0xf9, 0xf0, 0xf9, 0xe9, 0xed, 0xe8, 0xf7, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf7, 0xed, 0xee, 0xef, 0x93, 0x61, 0x4d, 0x94, 0xb9, 0xf8, 0xed, 0xe8, 0xee, 0xed, 0xe8, 0xee, 0xe8, 0xee, 0xee, 0xf9, 0xe6, 0x94, 0x86, 0x20, 0x7b, 0x92, 0xe6, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xed, 0xed, 0xf0, 0xf9, 0xff, 0xef, 0xf0, 0xe8, 0xf7, 0xff, 0x92, 0x8c, 0x26, 0x21, 0x15, 0x07, 0x02, 0x00, 0x9a, 0x95, 0xfc, 0xf6, 0xf3, 0xbb, 0xb9, 0xf9, 0xf7, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf8, 0xf2, 0xf3, 0xb8, 0xbc, 0x95, 0x00, 0x95, 0x96, 0x07, 0x20, 0x57, 0x6a, 0x5c, 0x28, 0x74, 0x8e, 0xba, 0xf2, 0xe5, 0xee, 0xf9, 0xe4, 0xfd, 0xe8, 0xef, 0xe5, 0xf0, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xee, 0x93, 0x7b, 0x22, 0x92, 0xbb, 0xf8, 0xee, 0xe8, 0xed, 0xbb, 0xed, 0xbb, 0xee, 0xe8, 0xee, 0xf9, 0xbb, 0x94, 0x7e, 0x1d, 0x85, 0x92, 0xf1, 0xf2, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xe7, 0xf2, 0xff, 0x8a, 0x1b, 0x92, 0xef, 0xf9, 0xe8, 0xee, 0x97, 0x92, 0x89, 0x1e, 0x3e, 0x31, 0x21, 0x12, 0x05, 0x95, 0x96, 0x98, 0x04, 0xec, 0xea, 0xe8, 0xf7, 0xf0, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0x99, 0xf7, 0xc5, 0x98, 0x98, 0x95, 0x96, 0x05, 0x1d, 0x6c, 0x53, 0x42, 0x49, 0x23, 0x3a, 0x7a, 0x92, 0xf8, 0xf2, 0xee, 0xf2, 0xf3, 0xec, 0x01, 0x8a, 0xff, 0xf0, 0xe8, 0xf0, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xe8, 0xed, 0x94, 0x84, 0x22, 0x87, 0xf9, 0xf8, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf7, 0xf2, 0x92, 0x74, 0x22, 0x8c, 0x93, 0xf1, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xef, 0xe8, 0xe8, 0xf8, 0x92, 0x18, 0x0d, 0x92, 0x97, 0xea, 0xee, 0xea, 0xef, 0x94, 0x80, 0x19, 0x2b, 0x37, 0x3b, 0x41, 0x2c, 0x12, 0x02, 0x96, 0x98, 0x98, 0xca, 0xf3, 0xf9, 0xe5, 0xee, 0xee, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xf2, 0xe5, 0xf2, 0xee, 0x99, 0xf3, 0xbd, 0x98, 0x95, 0x9c, 0x00, 0x0c, 0x36, 0x63, 0x46, 0x4e, 0x49, 0x35, 0x32, 0x88, 0x94, 0xff, 0xf8, 0xf8, 0xee, 0xe8, 0xf3, 0x79, 0x05, 0x25, 0xff, 0xef, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xe8, 0xee, 0xff, 0x8d, 0x22, 0x83, 0xf9, 0xf8, 0xed, 0xed, 0xee, 0xee, 0xed, 0xef, 0xee, 0xed, 0xed, 0xf7, 0xef, 0x90, 0x5f, 0x4d, 0x8b, 0xf8, 0xf8, 0xed, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xe7, 0x93, 0x7a, 0x10, 0x17, 0x90, 0x94, 0x99, 0xee, 0xef, 0xe8, 0xf9, 0xf6, 0x4d, 0x21, 0x2b, 0x42, 0x30, 0x58, 0x63, 0x15, 0x05, 0x95, 0x95, 0x98, 0xeb, 0xf3, 0xea, 0xee, 0xef, 0xee, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xbb, 0x94, 0xf5, 0x98, 0x95, 0x95, 0x03, 0x17, 0x69, 0x53, 0x54, 0x42, 0x46, 0x46, 0x27, 0x85, 0x93, 0xba, 0xe7, 0xf1, 0xf1, 0xf2, 0xf9, 0x94, 0x5a, 0x22, 0x13, 0x83, 0xff, 0xf2, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xf2, 0xef, 0xee, 0xe7, 0xf0, 0xbb, 0x90, 0x4d, 0x72, 0xff, 0xf0, 0xf2, 0xef, 0xf2, 0xf9, 0xf2, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0x8d, 0x3a, 0x77, 0x93, 0xf1, 0xf8, 0xbb, 0xee, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0x91, 0x26, 0x19, 0x3a, 0x0d, 0x34, 0xf3, 0xf2, 0xf2, 0xf2, 0xe7, 0xf3, 0x93, 0x84, 0x23, 0x30, 0x49, 0x49, 0x42, 0x6e, 0x3c, 0x09, 0x96, 0x95, 0x98, 0xf5, 0x94, 0xf2, 0xf2, 0xe5, 0xf2, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xef, 0x99, 0xf3, 0xfb, 0x98, 0x00, 0x00, 0x07, 0x1d, 0x64, 0x4e, 0x49, 0x42, 0x38, 0x53, 0x2e, 0x20, 0x7a, 0xea, 0xbb, 0xbb, 0xe9, 0xf2, 0xf7, 0xf3, 0x65, 0x05, 0x19, 0x19, 0x70, 0x94, 0xe5, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xe9, 0xed, 0xbb, 0x92, 0x5a, 0x5a, 0xf3, 0xf3, 0xf3, 0xef, 0xe5, 0xe5, 0xf7, 0xea, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0x89, 0x33, 0x7e, 0x99, 0xed, 0xf8, 0xbb, 0xe5, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x94, 0x83, 0x19, 0x23, 0x16, 0x07, 0x34, 0xf3, 0xf9, 0xbb, 0xe9, 0xf2, 0xe9, 0x94, 0x90, 0x26, 0x2b, 0x49, 0x37, 0x55, 0x37, 0x6e, 0x48, 0x0c, 0x96, 0x00, 0x98, 0xbd, 0xf7, 0xf2, 0xf0, 0xf2, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xf0, 0xe8, 0xef, 0xee, 0xf3, 0xeb, 0x98, 0x95, 0x96, 0x05, 0x51, 0x58, 0x54, 0x42, 0x46, 0x4b, 0x4b, 0x2a, 0x21, 0x18, 0x65, 0xf3, 0xba, 0xbb, 0xf9, 0xf7, 0xea, 0xea, 0x0f, 0x0b, 0x24, 0x1a, 0x33, 0x93, 0xf2, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf9, 0xee, 0xe7, 0xf1, 0xba, 0x94, 0x82, 0x25, 0x34, 0xc2, 0xfa, 0xbc, 0xf4, 0xf4, 0xbc, 0xbc, 0xfa, 0xbd, 0xeb, 0xdc, 0xea, 0x89, 0x50, 0x86, 0xba, 0xe6, 0xf8, 0xba, 0xbb, 0xee, 0xee, 0xee, 0xed, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0x94, 0x5f, 0x1e, 0x38, 0x1a, 0x4d, 0x8a, 0xf2, 0xf7, 0x99, 0xbb, 0xf8, 0x94, 0x94, 0x87, 0x19, 0x2a, 0x30, 0x37, 0x3d, 0x49, 0x42, 0x52, 0x6b, 0x12, 0x96, 0x95, 0x98, 0xfb, 0xf3, 0xea, 0xe5, 0xef, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xe8, 0xf0, 0xf7, 0xf3, 0xd7, 0x98, 0x9c, 0x95, 0x09, 0x59, 0x4e, 0x54, 0x37, 0x5c, 0x37, 0x4b, 0x55, 0x23, 0x15, 0x14, 0x8a, 0x99, 0xbb, 0x99, 0xff, 0xf9, 0xef, 0x94, 0x83, 0x4f, 0x23, 0x23, 0x1f, 0x8e, 0xf7, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xf0, 0xe8, 0xe7, 0xf1, 0xea, 0x97, 0x25, 0x01, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x04, 0x14, 0x5f, 0x91, 0x99, 0xe7, 0xf8, 0xf7, 0xbb, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf9, 0x90, 0x22, 0x2a, 0x30, 0x23, 0x0b, 0x65, 0xf3, 0xf9, 0xbb, 0xbb, 0x93, 0xf8, 0x94, 0x81, 0x10, 0x1a, 0x2b, 0x3d, 0x37, 0x47, 0x47, 0x55, 0x5c, 0x6b, 0x12, 0x96, 0x9a, 0x98, 0xca, 0xf3, 0xf2, 0xf7, 0xf0, 0xe7, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xb9, 0xee, 0xf8, 0xff, 0xe4, 0xa1, 0x98, 0x96, 0x05, 0x3c, 0x4a, 0x45, 0x42, 0x44, 0x3f, 0x3d, 0x49, 0x47, 0x1f, 0x17, 0x14, 0xfd, 0x94, 0xef, 0xf2, 0xf9, 0xf9, 0xea, 0x81, 0x0d, 0x15, 0x23, 0x2f, 0x1e, 0x82, 0x93, 0xbb, 0xbb, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xed, 0xe8, 0xed, 0xe8, 0xe5, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xe8, 0xed, 0xe8, 0xed, 0xbb, 0xed, 0xe8, 0xe8, 0xe5, 0xe7, 0x94, 0xde, 0xfa, 0x98, 0x98, 0x98, 0x95, 0x00, 0x96, 0x96, 0x01, 0x96, 0x96, 0x95, 0x95, 0x98, 0x98, 0x98, 0x98, 0xf4, 0xc5, 0x94, 0xf0, 0xf7, 0xfe, 0xf7, 0xe8, 0xe8, 0xe8, 0xed, 0xe8, 0xe8, 0xee, 0xee, 0xf0, 0xf1, 0xf0, 0xf1, 0xee, 0xf1, 0xee, 0xf0, 0xf0, 0xf1, 0xe8, 0xee, 0xef, 0xef, 0xee, 0xe7, 0xe8, 0xed, 0x94, 0x83, 0x1f, 0x2b, 0x30, 0x4c, 0x15, 0x13, 0x93, 0xf8, 0xf8, 0xef, 0xbb, 0xef, 0xf9, 0x91, 0x79, 0x22, 0x1e, 0x37, 0x42, 0x47, 0x49, 0x55, 0x54, 0x53, 0x69, 0x10, 0x96, 0x95, 0x9a, 0xdc, 0xf3, 0xf8, 0xf1, 0xb9, 0xb9, 0xf8, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xea, 0xb9, 0xe8, 0xf8, 0xf3, 0xa8, 0x98, 0x00, 0x05, 0x2c, 0x60, 0x42, 0x49, 0x56, 0x3f, 0x3b, 0x37, 0x42, 0x2b, 0x4f, 0x91, 0xf3, 0xf9, 0xf1, 0xf2, 0xe8, 0xf8, 0xe8, 0xf3, 0xfc, 0x98, 0x0e, 0x4c, 0x30, 0x1e, 0x77, 0xfe, 0xbb, 0xe5, 0xef, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xe8, 0xed, 0xe8, 0xee, 0xe8, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xed, 0xe8, 0xed, 0xf0, 0xf0, 0xf3, 0x1b, 0x9c, 0x98, 0x00, 0x03, 0x0b, 0x15, 0x16, 0x1f, 0x2c, 0x29, 0x21, 0x1f, 0x19, 0x11, 0x10, 0x05, 0x02, 0x96, 0x95, 0x98, 0xa5, 0xb9, 0xbb, 0xe5, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xf0, 0xee, 0xf0, 0xe7, 0xf0, 0xef, 0xef, 0xe5, 0xe8, 0xe8, 0xf0, 0x93, 0x74, 0x1e, 0x30, 0x49, 0x3b, 0x32, 0x96, 0xfc, 0xea, 0xf2, 0xee, 0xbb, 0xee, 0xf8, 0xf9, 0x94, 0x90, 0x66, 0x23, 0x3d, 0x3d, 0x45, 0x49, 0x49, 0x49, 0x60, 0x6c, 0x0b, 0x96, 0x98, 0xa1, 0x99, 0xf8, 0xf8, 0xb9, 0xb9, 0xee, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xe8, 0xed, 0xf3, 0xdc, 0x9a, 0x95, 0x02, 0x19, 0x63, 0x37, 0x49, 0x54, 0x47, 0x3f, 0x3b, 0x3d, 0x46, 0x24, 0x7e, 0xfe, 0xea, 0xe8, 0xe9, 0xe9, 0xe9, 0xf8, 0xe5, 0xea, 0x0d, 0x01, 0x19, 0x2f, 0x30, 0x2a, 0x4d, 0x91, 0xbb, 0xef, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xed, 0xe8, 0xee, 0xed, 0xe8, 0xed, 0xe8, 0xe8, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xf8, 0x94, 0xdc, 0x9a, 0x98, 0x03, 0x12, 0x21, 0x4c, 0x52, 0x3e, 0x4c, 0x3e, 0x3e, 0x52, 0x3e, 0x4c, 0x58, 0x4c, 0x36, 0x19, 0x09, 0x03, 0x96, 0x98, 0xeb, 0xea, 0xe6, 0xe8, 0xed, 0xe8, 0xed, 0xe8, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xef, 0xef, 0xed, 0xe7, 0xf0, 0xf9, 0x92, 0x66, 0x23, 0x30, 0x49, 0x30, 0x39, 0x09, 0x0a, 0xde, 0xea, 0xba, 0xe8, 0xf9, 0xf1, 0xf2, 0xba, 0x93, 0x77, 0x23, 0x38, 0x3f, 0x45, 0x42, 0x54, 0x54, 0x42, 0x63, 0x39, 0x07, 0x95, 0x98, 0xca, 0xf3, 0xf1, 0xee, 0xe8, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xe5, 0xf0, 0xea, 0xe4, 0xa3, 0x9a, 0x96, 0x15, 0x63, 0x42, 0x54, 0x49, 0x56, 0x42, 0x44, 0x38, 0x42, 0x46, 0x1a, 0x7e, 0xf9, 0xb9, 0xe8, 0xe9, 0xe8, 0xe8, 0xf9, 0x99, 0xf3, 0x65, 0x0b, 0x27, 0x44, 0x3d, 0x2f, 0x26, 0x8b, 0xef, 0xee, 0xf7, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xbb, 0xe8, 0xe8, 0xbb, 0xe8, 0xbb, 0xe8, 0xbb, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf6, 0x0a, 0x95, 0x0c, 0x4f, 0x43, 0x2d, 0x2f, 0x2f, 0x3b, 0x30, 0x30, 0x3d, 0x30, 0x44, 0x3d, 0x3b, 0x3b, 0x44, 0x4c, 0x1e, 0x24, 0x19, 0x0b, 0x02, 0x81, 0xe7, 0xe7, 0xf7, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xee, 0xe8, 0xe8, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xe7, 0xee, 0xef, 0xef, 0xe8, 0xee, 0xf2, 0xff, 0x91, 0x36, 0x2b, 0x3d, 0x42, 0x37, 0x53, 0x15, 0x03, 0xde, 0x99, 0xbb, 0xe8, 0xf8, 0xf1, 0xe7, 0xba, 0xff, 0x18, 0x1e, 0x2f, 0x37, 0x3f, 0x42, 0x56, 0x49, 0x55, 0x49, 0x6a, 0x40, 0x02, 0x95, 0x9b, 0xde, 0xf3, 0xf8, 0xed, 0xb9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xf0, 0xf3, 0xca, 0x9b, 0x95, 0x09, 0x51, 0x53, 0x45, 0x47, 0x47, 0x3d, 0x44, 0x3b, 0x4b, 0x42, 0x49, 0x1a, 0x0c, 0x79, 0xea, 0xe8, 0xe8, 0xbb, 0x99, 0xee, 0x99, 0x8e, 0x6d, 0x1f, 0x2d, 0x37, 0x42, 0x38, 0x2c, 0x83, 0xf9, 0xef, 0xef, 0xed, 0xe8, 0xed, 0xee, 0xee, 0xf7, 0xbb, 0xf2, 0xe5, 0xe5, 0x99, 0xf2, 0xf3, 0xf3, 0xf2, 0xea, 0xf2, 0xf3, 0xf3, 0xea, 0xe5, 0xee, 0xf7, 0xef, 0xba, 0xec, 0x03, 0x10, 0x3a, 0x40, 0x6f, 0x4f, 0x21, 0x2f, 0x3d, 0x3d, 0x47, 0x3d, 0x47, 0x3d, 0x3d, 0x47, 0x3d, 0x44, 0x23, 0x21, 0x2e, 0x27, 0x40, 0x19, 0x17, 0xfe, 0xed, 0xee, 0xed, 0xef, 0xf2, 0xf3, 0xf3, 0xf3, 0xea, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xe8, 0xed, 0xf2, 0xee, 0xee, 0xe8, 0xee, 0xef, 0xee, 0xf2, 0xee, 0xf9, 0xff, 0x8f, 0x27, 0x2f, 0x37, 0x3d, 0x49, 0x4e, 0x2e, 0x33, 0x86, 0xf7, 0xea, 0xed, 0xea, 0xf8, 0xe7, 0x99, 0xfd, 0x09, 0x1a, 0x3e, 0x3f, 0x38, 0x45, 0x3d, 0x55, 0x47, 0x49, 0x4e, 0x62, 0x15, 0x96, 0x98, 0xc5, 0xf3, 0xf8, 0xf7, 0xbb, 0xe5, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe7, 0xee, 0xf9, 0xf3, 0x04, 0x95, 0x01, 0x20, 0x53, 0x49, 0x3f, 0x3f, 0x3f, 0x3f, 0x38, 0x3f, 0x3d, 0x49, 0x55, 0x1a, 0x05, 0x1c, 0xf3, 0xef, 0xef, 0x99, 0xba, 0x97, 0xf7, 0x80, 0x15, 0x27, 0x35, 0x3d, 0x42, 0x4b, 0x24, 0x7e, 0xf9, 0xf7, 0xef, 0xed, 0xed, 0xe8, 0xee, 0xf0, 0xee, 0xee, 0xe5, 0xe8, 0xf3, 0xea, 0xdc, 0xc5, 0xa5, 0xa3, 0x9f, 0xa3, 0xf5, 0xeb, 0xde, 0xf3, 0xef, 0xe8, 0xe4, 0xf3, 0x1c, 0x0e, 0x39, 0x50, 0x84, 0x90, 0x91, 0x78, 0x23, 0x42, 0x37, 0x42, 0x42, 0x42, 0x49, 0x49, 0x42, 0x49, 0x2b, 0x26, 0x7f, 0x84, 0x84, 0x33, 0x32, 0x20, 0x7b, 0xef, 0xed, 0xed, 0xea, 0xea, 0xec, 0xeb, 0xa8, 0xfa, 0xa3, 0xa5, 0xc2, 0xb8, 0xe4, 0xf3, 0xea, 0xe5, 0xf0, 0xf2, 0xe8, 0xee, 0xef, 0xef, 0xed, 0xee, 0xf8, 0x93, 0x88, 0x27, 0x2f, 0x38, 0x37, 0x42, 0x49, 0x46, 0x59, 0x0e, 0x02, 0x34, 0xf3, 0xf7, 0xf9, 0xf1, 0xf2, 0x8e, 0x13, 0x11, 0x2b, 0x3f, 0x3d, 0x3d, 0x3d, 0x3f, 0x44, 0x45, 0x45, 0x53, 0x48, 0x0b, 0x98, 0x96, 0xe1, 0x94, 0xed, 0xb9, 0xe8, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xf0, 0xf3, 0xd7, 0x98, 0x00, 0x10, 0x62, 0x37, 0x4b, 0x3f, 0x3b, 0x38, 0x3b, 0x4b, 0x3d, 0x45, 0x49, 0x3f, 0x2a, 0x18, 0x8a, 0xf2, 0xf9, 0xf9, 0xe5, 0x99, 0xe1, 0x06, 0x12, 0x29, 0x2f, 0x3d, 0x37, 0x49, 0x3d, 0x24, 0x74, 0x94, 0xff, 0xf7, 0xed, 0xe7, 0xed, 0xee, 0xee, 0xef, 0xee, 0xea, 0xea, 0xdc, 0xa5, 0x9a, 0x9a, 0x9b, 0x9a, 0x9c, 0x9b, 0x9b, 0x9a, 0x9a, 0xc5, 0xe4, 0xea, 0xef, 0xea, 0x22, 0x1a, 0x26, 0x82, 0x90, 0xf8, 0xf9, 0x8d, 0x48, 0x30, 0x42, 0x37, 0x37, 0x42, 0x37, 0x42, 0x42, 0x42, 0x2f, 0x77, 0x93, 0x93, 0x93, 0x88, 0x33, 0x21, 0x77, 0x93, 0xbb, 0xf2, 0xe1, 0xbd, 0x9e, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x98, 0x9b, 0xc5, 0xde, 0xf3, 0xee, 0xee, 0xe8, 0xee, 0xef, 0xee, 0xe8, 0xf1, 0xff, 0x92, 0x83, 0x24, 0x2f, 0x38, 0x42, 0x47, 0x49, 0x46, 0x3e, 0x39, 0x20, 0x5a, 0x94, 0xba, 0xe9, 0xf1, 0xf1, 0x94, 0x8b, 0x7c, 0x31, 0x30, 0x42, 0x45, 0x3d, 0x3b, 0x3f, 0x4b, 0x4b, 0x3d, 0x58, 0x1f, 0x03, 0x98, 0xeb, 0xf3, 0xf0, 0xb9, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xea, 0xf5, 0x98, 0x01, 0x51, 0x53, 0x45, 0x44, 0x3d, 0x3d, 0x3f, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x2f, 0x66, 0x8f, 0xff, 0xf2, 0xed, 0xf8, 0xf9, 0x94, 0xfd, 0x05, 0x15, 0x4a, 0x42, 0x3d, 0x3d, 0x42, 0x42, 0x23, 0x71, 0x94, 0xf8, 0xf7, 0xee, 0xed, 0xe7, 0xed, 0xee, 0xf7, 0xea, 0xea, 0xeb, 0x98, 0x9a, 0x9c, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x98, 0x04, 0xe2, 0xf3, 0x92, 0x20, 0x19, 0x4d, 0x92, 0x91, 0xf8, 0xe8, 0x92, 0x66, 0x2b, 0x2f, 0x38, 0x3e, 0x38, 0x38, 0x38, 0x38, 0x42, 0x31, 0x86, 0xea, 0xe8, 0x99, 0x93, 0x70, 0x29, 0x74, 0x94, 0xf3, 0xdc, 0xbc, 0x9a, 0x9b, 0x9b, 0x9e, 0x9b, 0x9b, 0x9b, 0x9e, 0x9b, 0x9a, 0x98, 0x9c, 0xd7, 0xf3, 0xf2, 0xee, 0xee, 0xef, 0xee, 0xed, 0xed, 0x93, 0x92, 0x7a, 0x24, 0x37, 0x42, 0x42, 0x42, 0x3d, 0x3f, 0x38, 0x3f, 0x43, 0x15, 0x8a, 0xba, 0xba, 0xed, 0xf1, 0xf8, 0x94, 0x7e, 0x2d, 0x38, 0x49, 0x49, 0x42, 0x3d, 0x4b, 0x42, 0x55, 0x45, 0x49, 0x6e, 0x10, 0x98, 0xf4, 0xbb, 0xea, 0xe5, 0xf2, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xea, 0xf9, 0xe1, 0x95, 0x00, 0x10, 0x6b, 0x42, 0x3d, 0x44, 0x49, 0x49, 0x42, 0x49, 0x49, 0x49, 0x42, 0x3f, 0x3e, 0x32, 0x8f, 0x99, 0xe9, 0xe9, 0xf1, 0xf9, 0x93, 0x91, 0x33, 0x2d, 0x38, 0x45, 0x47, 0x3d, 0x49, 0x30, 0x2f, 0x61, 0x94, 0xfe, 0xee, 0xf2, 0xe7, 0xee, 0xee, 0xee, 0xf9, 0xe5, 0xbd, 0x98, 0x9b, 0x9c, 0x9b, 0x9b, 0x9b, 0x9e, 0x9e, 0x9d, 0x9e, 0x9f, 0x9e, 0x9e, 0x9a, 0xbc, 0xde, 0xf3, 0x4d, 0x19, 0x77, 0x91, 0xf8, 0xe7, 0xb9, 0x92, 0x5b, 0x30, 0x37, 0x3d, 0x3d, 0x3d, 0x47, 0x42, 0x47, 0x42, 0x2d, 0x85, 0xf2, 0xf1, 0xf9, 0x93, 0x78, 0x20, 0x77, 0xea, 0xd7, 0x98, 0x9b, 0x9e, 0x9b, 0x9e, 0x9b, 0x9b, 0x9d, 0x9a, 0x9b, 0x9b, 0x9c, 0x9c, 0x98, 0x98, 0xc5, 0xf3, 0xf2, 0xee, 0xef, 0xee, 0xe8, 0xf1, 0xfe, 0x92, 0x80, 0x23, 0x49, 0x42, 0x49, 0x47, 0x3f, 0x3b, 0x38, 0x42, 0x46, 0x40, 0x91, 0xba, 0xbb, 0xe9, 0xf1, 0xf7, 0x99, 0x7a, 0x23, 0x35, 0x42, 0x49, 0x49, 0x49, 0x42, 0x54, 0x49, 0x47, 0x55, 0x4e, 0x2c, 0x03, 0x98, 0xd7, 0xea, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf8, 0xf3, 0xb8, 0x98, 0x03, 0x21, 0x52, 0x42, 0x49, 0x49, 0x45, 0x42, 0x45, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x37, 0x31, 0x89, 0x94, 0xe7, 0xe9, 0xf1, 0xf9, 0x8f, 0x6f, 0x4c, 0x3e, 0x3d, 0x4b, 0x47, 0x42, 0x42, 0x4e, 0x2b, 0x4f, 0x92, 0xf8, 0xee, 0xe8, 0xed, 0xe8, 0xf0, 0xf7, 0xf3, 0xeb, 0x98, 0x9a, 0x9c, 0x9c, 0x9e, 0x9c, 0x9e, 0x9c, 0x9b, 0x98, 0x98, 0x98, 0x9a, 0x9e, 0xf4, 0x98, 0xa8, 0xf3, 0x70, 0x1a, 0x61, 0x92, 0xf2, 0xe7, 0xea, 0x86, 0x27, 0x37, 0x47, 0x37, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x3d, 0x2e, 0x7b, 0x93, 0xef, 0x99, 0x93, 0x77, 0x20, 0x81, 0xe1, 0x9f, 0x9a, 0x9e, 0x9b, 0x9e, 0x9a, 0x9a, 0x9a, 0x9b, 0x9e, 0x9a, 0x9b, 0x9b, 0x9c, 0x9b, 0x9a, 0x98, 0xb8, 0xf3, 0xe5, 0xf2, 0xe5, 0xe7, 0xe9, 0xff, 0x92, 0x80, 0x24, 0x3f, 0x3d, 0x42, 0x3d, 0x3f, 0x38, 0x44, 0x42, 0x2f, 0x36, 0x89, 0x92, 0x99, 0xf1, 0xf8, 0x91, 0x91, 0x6f, 0x30, 0x37, 0x42, 0x42, 0x42, 0x45, 0x45, 0x42, 0x45, 0x38, 0x55, 0x56, 0x57, 0x10, 0x98, 0xfb, 0xf3, 0xbb, 0xe8, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xf3, 0xa3, 0x98, 0x0c, 0x57, 0x44, 0x47, 0x4e, 0x42, 0x45, 0x3d, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x37, 0x46, 0x4f, 0x8d, 0xef, 0xe9, 0xf2, 0x90, 0x71, 0x1e, 0x3f, 0x42, 0x3f, 0x3f, 0x42, 0x47, 0x42, 0x45, 0x2b, 0x50, 0x92, 0xff, 0xee, 0xe7, 0xe8, 0xed, 0xef, 0xea, 0xdc, 0x98, 0x9a, 0x9b, 0x9c, 0x9a, 0x9c, 0x9a, 0x9c, 0x9a, 0xbc, 0xc5, 0xb8, 0xeb, 0xa5, 0x98, 0x98, 0x9e, 0x98, 0xdc, 0x89, 0x1f, 0x2c, 0x8c, 0x92, 0xfe, 0x8d, 0x5e, 0x2a, 0x42, 0x37, 0x42, 0x3d, 0x42, 0x45, 0x45, 0x45, 0x42, 0x2f, 0x5b, 0x8c, 0x91, 0x92, 0x8d, 0x3a, 0x33, 0x90, 0xa5, 0x9a, 0x9e, 0x9a, 0x9a, 0x9a, 0xa5, 0xa8, 0xa5, 0x9e, 0x9e, 0x9f, 0x9c, 0x9a, 0x9a, 0x9c, 0x9b, 0x9c, 0x98, 0xdc, 0xf3, 0xee, 0xe5, 0xe8, 0xe9, 0xf8, 0x92, 0x80, 0x24, 0x3d, 0x3d, 0x42, 0x45, 0x3f, 0x38, 0x4b, 0x45, 0x3f, 0x23, 0x2c, 0x78, 0x92, 0xf2, 0xf2, 0x91, 0x82, 0x24, 0x37, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x42, 0x3d, 0x46, 0x4b, 0x49, 0x56, 0x4c, 0x20, 0x05, 0xf4, 0xf6, 0xba, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0x94, 0xe5, 0xbc, 0x95, 0x1d, 0x4a, 0x45, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x38, 0x2e, 0x78, 0x94, 0xba, 0x94, 0x78, 0x28, 0x3b, 0x37, 0x45, 0x3f, 0x3d, 0x47, 0x42, 0x42, 0x4e, 0x2f, 0x50, 0x93, 0xfe, 0xee, 0xe8, 0xe9, 0xee, 0xf2, 0xef, 0xa5, 0x98, 0x9a, 0x9c, 0x9a, 0x9c, 0x9a, 0x9c, 0x9c, 0xa3, 0xe1, 0xf3, 0xea, 0xf3, 0xef, 0xb8, 0xbc, 0x98, 0x9a, 0xbd, 0x90, 0x2c, 0x21, 0x3c, 0x82, 0x7f, 0x4f, 0x1e, 0x47, 0x37, 0x42, 0x37, 0x42, 0x3d, 0x42, 0x45, 0x3d, 0x42, 0x42, 0x2d, 0x50, 0x78, 0x7f, 0x6f, 0x1f, 0x71, 0x87, 0x9a, 0x9a, 0x9e, 0x9a, 0xa8, 0xec, 0xbb, 0x99, 0xea, 0xec, 0xa5, 0x9e, 0xa3, 0x9b, 0x98, 0x9b, 0x9c, 0x9c, 0x98, 0xa5, 0xf3, 0xbb, 0xf2, 0xe7, 0xe9, 0xf8, 0x92, 0x80, 0x2d, 0x37, 0x45, 0x42, 0x42, 0x3f, 0x3f, 0x3f, 0x42, 0x37, 0x45, 0x31, 0x21, 0x8b, 0x97, 0x99, 0x8f, 0x50, 0x31, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x45, 0x3d, 0x42, 0x45, 0x3d, 0x56, 0x47, 0x3d, 0x5b, 0x0c, 0x95, 0xdc, 0x99, 0xe8, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xea, 0xdc, 0x98, 0x01, 0x59, 0x38, 0x42, 0x45, 0x37, 0x42, 0x45, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x37, 0x46, 0x48, 0x8d, 0x94, 0x7a, 0x28, 0x37, 0x3d, 0x45, 0x45, 0x3f, 0x3d, 0x3d, 0x56, 0x45, 0x4b, 0x2b, 0x4f, 0x93, 0xff, 0xee, 0xe8, 0xed, 0xed, 0xf3, 0xd7, 0x98, 0x9c, 0x9b, 0x9c, 0x9a, 0x9c, 0x9a, 0x9c, 0x98, 0x98, 0xde, 0xf3, 0xe5, 0xf2, 0xee, 0xf3, 0xe4, 0xfa, 0x98, 0x9b, 0xfe, 0x3a, 0x2d, 0x23, 0x27, 0x1e, 0x2d, 0x3d, 0x42, 0x37, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x45, 0x45, 0x42, 0x55, 0x46, 0x2d, 0x24, 0x2d, 0x1e, 0x27, 0x85, 0x34, 0x98, 0x9c, 0x9a, 0xc5, 0xf3, 0x99, 0xe5, 0xe8, 0xbb, 0xf3, 0xe0, 0x9c, 0x9c, 0x9a, 0x9a, 0x98, 0x9a, 0x9c, 0x9e, 0x98, 0xd7, 0xf3, 0xe5, 0xe9, 0xee, 0xf8, 0x92, 0x88, 0x24, 0x3d, 0x42, 0x42, 0x42, 0x45, 0x3f, 0x3f, 0x45, 0x45, 0x49, 0x54, 0x2b, 0x4f, 0x90, 0x94, 0x74, 0x2e, 0x49, 0x42, 0x42, 0x45, 0x45, 0x3d, 0x42, 0x42, 0x45, 0x42, 0x49, 0x4e, 0x42, 0x42, 0x5d, 0x1d, 0x95, 0xeb, 0xf3, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf3, 0x1b, 0x98, 0x09, 0x6b, 0x46, 0x49, 0x3d, 0x3d, 0x3d, 0x42, 0x42, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x44, 0x42, 0x2a, 0x76, 0x84, 0x32, 0x23, 0x54, 0x37, 0x47, 0x42, 0x45, 0x3f, 0x3d, 0x42, 0x42, 0x4b, 0x2f, 0x4f, 0x93, 0xf8, 0xef, 0xe8, 0xe9, 0xf7, 0xf3, 0xfb, 0x9a, 0x9a, 0x9c, 0x9a, 0x9c, 0x9c, 0x9a, 0x9c, 0x98, 0xbc, 0xe4, 0xea, 0xf2, 0xf7, 0x99, 0xf0, 0xf3, 0xe4, 0x04, 0x98, 0x65, 0x7f, 0x23, 0x3d, 0x30, 0x3b, 0x35, 0x47, 0x49, 0x3d, 0x42, 0x37, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x55, 0x37, 0x38, 0x3e, 0x38, 0x2f, 0x21, 0x90, 0xeb, 0x98, 0x9a, 0xb8, 0xf3, 0xbb, 0xbb, 0xe5, 0xe4, 0xe7, 0x99, 0xf2, 0xfa, 0x98, 0x9a, 0x9a, 0x9a, 0x9c, 0x9a, 0xf4, 0x9a, 0xa8, 0xea, 0xf2, 0xe7, 0xf1, 0xf9, 0x93, 0x87, 0x2d, 0x37, 0x42, 0x42, 0x42, 0x3d, 0x4b, 0x3f, 0x42, 0x45, 0x42, 0x55, 0x49, 0x29, 0x76, 0x84, 0x21, 0x3e, 0x37, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x45, 0x3d, 0x45, 0x42, 0x49, 0x3d, 0x3d, 0x55, 0x49, 0x51, 0x05, 0xfa, 0xf3, 0xe5, 0xef, 0xed, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xea, 0xc5, 0x00, 0x12, 0x63, 0x42, 0x49, 0x3f, 0x3d, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3f, 0x2f, 0x2a, 0x4c, 0x2b, 0x42, 0x3d, 0x47, 0x3d, 0x42, 0x3d, 0x3d, 0x42, 0x47, 0x45, 0x3f, 0x2b, 0x61, 0x93, 0xff, 0xee, 0xe8, 0xed, 0xf0, 0xf3, 0xbc, 0x9a, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0xf4, 0xd7, 0xb8, 0xec, 0xf3, 0xef, 0xef, 0xef, 0xf7, 0xf2, 0xf2, 0xf3, 0xdc, 0x98, 0x1b, 0x85, 0x23, 0x42, 0x3d, 0x30, 0x38, 0x42, 0x42, 0x37, 0x42, 0x3d, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x35, 0x3d, 0x47, 0x2f, 0x3c, 0x93, 0xc2, 0x98, 0xc5, 0xf3, 0xea, 0xbb, 0xf2, 0xe8, 0xf2, 0xe8, 0xe8, 0xbb, 0xec, 0x9c, 0x98, 0x9a, 0x9b, 0x9a, 0x9b, 0x9e, 0x9e, 0x9e, 0xe5, 0xea, 0xed, 0xe9, 0xf1, 0x93, 0x90, 0x28, 0x35, 0x42, 0x42, 0x49, 0x3d, 0x3f, 0x45, 0x42, 0x4b, 0x3d, 0x42, 0x3d, 0x46, 0x31, 0x4a, 0x2a, 0x46, 0x37, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x42, 0x42, 0x45, 0x42, 0x42, 0x4b, 0x3d, 0x54, 0x49, 0x6e, 0x0c, 0x00, 0xea, 0xf2, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf3, 0xf5, 0x96, 0x20, 0x52, 0x49, 0x42, 0x38, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x2f, 0x3b, 0x4e, 0x49, 0x54, 0x3d, 0x3d, 0x3d, 0x47, 0x42, 0x45, 0x3d, 0x3d, 0x42, 0x45, 0x52, 0x2a, 0x61, 0x94, 0xf7, 0xf2, 0xed, 0xed, 0xf2, 0xf2, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0x9b, 0x98, 0xc2, 0xf3, 0xf3, 0xf3, 0xee, 0xef, 0xe8, 0xef, 0xe8, 0xef, 0x99, 0xef, 0xea, 0xbc, 0xfc, 0x8d, 0x1e, 0x42, 0x37, 0x38, 0x38, 0x37, 0x3d, 0x37, 0x42, 0x42, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x46, 0x3e, 0x38, 0x49, 0x2b, 0x5f, 0x94, 0xc2, 0x9c, 0xe1, 0xea, 0xbb, 0xee, 0xe8, 0xf2, 0xe8, 0xf2, 0xf2, 0xf2, 0xf3, 0xe1, 0xc2, 0x9a, 0x9c, 0x9b, 0x9a, 0x9f, 0x9e, 0x98, 0xec, 0xf3, 0xed, 0xf1, 0xee, 0x94, 0x92, 0x36, 0x31, 0x46, 0x37, 0x56, 0x3d, 0x45, 0x3d, 0x42, 0x46, 0x38, 0x3f, 0x3d, 0x42, 0x54, 0x37, 0x49, 0x4b, 0x30, 0x45, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x3d, 0x46, 0x49, 0x42, 0x58, 0x1d, 0x95, 0xe1, 0xea, 0xed, 0xed, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xea, 0xfa, 0x02, 0x32, 0x38, 0x49, 0x38, 0x38, 0x42, 0x47, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x4b, 0x2f, 0x37, 0x42, 0x55, 0x3d, 0x38, 0x3d, 0x42, 0x42, 0x3d, 0x3d, 0x47, 0x42, 0x4b, 0x3d, 0x23, 0x76, 0x94, 0xff, 0xef, 0xe7, 0xee, 0xf1, 0xe4, 0x9a, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x98, 0xec, 0xf3, 0xf7, 0xe5, 0x99, 0xe8, 0xef, 0xee, 0x99, 0xef, 0xee, 0xea, 0xf3, 0xf5, 0xfb, 0x90, 0x1f, 0x37, 0x3d, 0x2f, 0x38, 0x42, 0x37, 0x3d, 0x42, 0x3d, 0x45, 0x42, 0x3d, 0x42, 0x42, 0x3d, 0x3d, 0x37, 0x3e, 0x3f, 0x49, 0x30, 0x5f, 0x94, 0xbd, 0xa5, 0xbb, 0xea, 0xee, 0xea, 0xe8, 0xf2, 0xf2, 0xf2, 0xe8, 0xee, 0xf2, 0xea, 0xe5, 0x9c, 0x9a, 0x9b, 0x9c, 0x9e, 0x9f, 0x98, 0xdc, 0xf3, 0xed, 0xf1, 0xf1, 0xf9, 0x92, 0x66, 0x2a, 0x3e, 0x37, 0x45, 0x3d, 0x3d, 0x45, 0x49, 0x42, 0x46, 0x3f, 0x44, 0x3d, 0x49, 0x49, 0x49, 0x30, 0x3f, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x42, 0x45, 0x42, 0x45, 0x3d, 0x45, 0x42, 0x45, 0x45, 0x38, 0x36, 0x02, 0xdc, 0xea, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xf2, 0xed, 0x04, 0x05, 0x3c, 0x3b, 0x42, 0x3f, 0x3e, 0x3d, 0x47, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x49, 0x49, 0x3f, 0x4b, 0x3d, 0x3d, 0x37, 0x42, 0x37, 0x49, 0x42, 0x42, 0x3d, 0x45, 0x47, 0x3d, 0x4b, 0x2f, 0x78, 0xf3, 0xf7, 0xf2, 0xe5, 0xed, 0xf2, 0xee, 0x9a, 0x9b, 0x9b, 0x9b, 0x9f, 0x9c, 0x9c, 0xea, 0xbb, 0xf2, 0x97, 0xf2, 0xbb, 0xe8, 0x99, 0xee, 0xbb, 0x99, 0xed, 0xf3, 0xf5, 0xfb, 0x8e, 0x20, 0x30, 0x37, 0x30, 0x3d, 0x42, 0x42, 0x37, 0x42, 0x42, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x47, 0x47, 0x38, 0x38, 0x49, 0x30, 0x4f, 0x94, 0xfb, 0x0a, 0xea, 0xf2, 0xee, 0xef, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf7, 0xf2, 0xea, 0xe4, 0x9c, 0x9a, 0x9c, 0x9b, 0x9f, 0x9e, 0x9a, 0xdc, 0xf3, 0xee, 0xf1, 0xe8, 0xf1, 0x93, 0x7c, 0x23, 0x31, 0x3d, 0x3d, 0x47, 0x3d, 0x42, 0x42, 0x54, 0x49, 0x49, 0x44, 0x38, 0x3b, 0x4e, 0x37, 0x4b, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x3f, 0x42, 0x49, 0x3f, 0x3f, 0x38, 0x51, 0x09, 0x1b, 0xf3, 0xed, 0xed, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xea, 0xf6, 0xbc, 0x09, 0x48, 0x4b, 0x37, 0x3f, 0x37, 0x47, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x49, 0x42, 0x37, 0x3d, 0x3d, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x42, 0x42, 0x3d, 0x3b, 0x55, 0x49, 0x27, 0x80, 0x94, 0xef, 0xf0, 0xed, 0xed, 0xea, 0xe8, 0x9c, 0x9b, 0x9b, 0x9b, 0x9f, 0x9e, 0x9e, 0x99, 0xea, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xf7, 0x99, 0xea, 0xfa, 0xfc, 0x90, 0x1e, 0x30, 0x2f, 0x2f, 0x3d, 0x49, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x3d, 0x3d, 0x42, 0x3d, 0x38, 0x38, 0x2f, 0x66, 0x91, 0xfc, 0xa3, 0xbb, 0xf9, 0xea, 0xf2, 0xee, 0xf2, 0xe8, 0xf2, 0xf2, 0xee, 0xf7, 0xf3, 0xec, 0x98, 0x9c, 0x9c, 0x9b, 0x9f, 0x9d, 0x9a, 0xe1, 0xea, 0xed, 0xed, 0xf0, 0xee, 0x93, 0x82, 0x29, 0x2f, 0x44, 0x38, 0x45, 0x49, 0x49, 0x3d, 0x42, 0x49, 0x45, 0x3d, 0x3f, 0x3d, 0x3f, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x45, 0x42, 0x42, 0x45, 0x45, 0x3d, 0x45, 0x42, 0x45, 0x3f, 0x4c, 0x11, 0xfc, 0xf3, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xee, 0xee, 0xea, 0xe4, 0x02, 0x09, 0x4a, 0x4e, 0x38, 0x3d, 0x45, 0x38, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x42, 0x38, 0x3f, 0x42, 0x49, 0x38, 0x3b, 0x42, 0x54, 0x2c, 0x8b, 0xf2, 0xf0, 0xee, 0xee, 0xed, 0xe8, 0xf3, 0xa3, 0x9a, 0x9b, 0x9e, 0x9f, 0x9e, 0x9a, 0xe1, 0xea, 0x99, 0xf9, 0xe8, 0xf2, 0xef, 0xf2, 0xef, 0xf9, 0xf2, 0xea, 0xe4, 0x9c, 0xeb, 0x8d, 0x24, 0x37, 0x2f, 0x2f, 0x49, 0x42, 0x37, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x37, 0x3f, 0x42, 0x42, 0x38, 0x3b, 0x2a, 0x48, 0x8f, 0xca, 0x9c, 0xde, 0xea, 0xee, 0xf0, 0xf2, 0xee, 0xf2, 0xbb, 0xee, 0xe8, 0xf2, 0xf3, 0xeb, 0x98, 0x9c, 0x9b, 0x9e, 0x9f, 0x9e, 0xbc, 0xe7, 0xe8, 0xf2, 0xed, 0xf0, 0xee, 0xf2, 0x8c, 0x40, 0x2a, 0x44, 0x3b, 0x3d, 0x54, 0x49, 0x44, 0x3f, 0x45, 0x42, 0x45, 0x42, 0x37, 0x42, 0x37, 0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x3b, 0x47, 0x49, 0x49, 0x3d, 0x4c, 0x19, 0xfb, 0xf3, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xf2, 0xef, 0xee, 0xea, 0xf6, 0xbc, 0x0c, 0x60, 0x45, 0x38, 0x3d, 0x42, 0x3f, 0x3d, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x49, 0x49, 0x3f, 0x3b, 0x49, 0x49, 0x4f, 0x90, 0xf0, 0xf0, 0xee, 0xf0, 0xe8, 0xed, 0xf3, 0xc5, 0x9a, 0x9b, 0x9e, 0x9f, 0x9f, 0x9a, 0xeb, 0xf3, 0xf2, 0x99, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xf7, 0xf3, 0xb8, 0x98, 0x65, 0x86, 0x1e, 0x42, 0x38, 0x38, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x45, 0x38, 0x42, 0x42, 0x3d, 0x38, 0x2a, 0x36, 0x90, 0xd7, 0x98, 0xc5, 0xf3, 0xed, 0xf2, 0xf2, 0xe8, 0xf2, 0x99, 0xee, 0x99, 0xf9, 0xe5, 0x04, 0x9c, 0x9b, 0x9e, 0x9f, 0x9f, 0x9a, 0xc2, 0xea, 0xe7, 0xee, 0xed, 0xee, 0xf1, 0xf9, 0x90, 0x68, 0x2a, 0x47, 0x3d, 0x45, 0x42, 0x49, 0x3d, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x37, 0x3d, 0x45, 0x42, 0x42, 0x3d, 0x45, 0x42, 0x45, 0x42, 0x42, 0x42, 0x44, 0x3d, 0x55, 0x49, 0x3d, 0x52, 0x1f, 0x0d, 0xea, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xed, 0xea, 0xf7, 0x02, 0x0c, 0x63, 0x37, 0x3f, 0x3d, 0x42, 0x38, 0x3d, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x49, 0x42, 0x3d, 0x3f, 0x42, 0x2b, 0x71, 0x92, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xee, 0xea, 0xec, 0x9c, 0x9b, 0x9e, 0x9f, 0x9f, 0x9f, 0x9e, 0xde, 0xf3, 0xe8, 0xf2, 0xef, 0xf2, 0xbb, 0xea, 0xe5, 0xf3, 0xe5, 0xfa, 0x9a, 0xfd, 0x80, 0x23, 0x46, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x38, 0x47, 0x49, 0x47, 0x3d, 0x35, 0x28, 0x8c, 0xe1, 0x9f, 0xf4, 0xdc, 0xf3, 0xe9, 0xe8, 0xf2, 0xbb, 0xef, 0xf2, 0xef, 0xf3, 0xca, 0x98, 0x9c, 0x9b, 0x9e, 0x9f, 0x9d, 0x9a, 0xd7, 0xea, 0xf2, 0xee, 0xf0, 0xee, 0xf2, 0xee, 0x93, 0x7e, 0x2a, 0x42, 0x47, 0x42, 0x46, 0x3d, 0x45, 0x45, 0x45, 0x42, 0x45, 0x3d, 0x42, 0x45, 0x45, 0x45, 0x42, 0x45, 0x3d, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x3b, 0x47, 0x49, 0x49, 0x47, 0x44, 0x5b, 0x0d, 0xea, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xea, 0xf7, 0xfa, 0x0c, 0x63, 0x42, 0x38, 0x3d, 0x42, 0x38, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x3d, 0x42, 0x49, 0x49, 0x3d, 0x37, 0x46, 0x1e, 0x82, 0x93, 0xef, 0xee, 0xee, 0xef, 0xe8, 0xee, 0xe8, 0xf3, 0xc2, 0x98, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xe1, 0xf3, 0xea, 0xf2, 0xbb, 0xbb, 0xe7, 0xf3, 0xee, 0xa8, 0x98, 0xbd, 0x94, 0x70, 0x23, 0x37, 0x42, 0x3d, 0x3d, 0x44, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x3d, 0x3f, 0x42, 0x47, 0x42, 0x4b, 0x37, 0x24, 0x7b, 0xf3, 0xa8, 0xbc, 0xbc, 0xdc, 0xf3, 0xea, 0xbb, 0xe8, 0x99, 0xea, 0xf3, 0xd7, 0x9c, 0x9c, 0x9e, 0x9e, 0x9f, 0x9f, 0x9b, 0xa5, 0xe8, 0xe9, 0xe5, 0xf0, 0xed, 0xee, 0xf0, 0xee, 0xf2, 0x88, 0x28, 0x42, 0x55, 0x42, 0x3b, 0x3f, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x45, 0x42, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x3d, 0x45, 0x42, 0x42, 0x45, 0x42, 0x42, 0x44, 0x3d, 0x55, 0x49, 0x56, 0x3d, 0x59, 0x0f, 0x94, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xee, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0x94, 0x06, 0x0c, 0x4a, 0x37, 0x3f, 0x3d, 0x42, 0x3f, 0x3d, 0x42, 0x45, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x42, 0x49, 0x42, 0x3d, 0x3d, 0x3e, 0x26, 0x8f, 0xff, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xe5, 0xf3, 0xe1, 0x9c, 0x9b, 0x9b, 0xa1, 0x9f, 0x9f, 0x9f, 0xa3, 0xd7, 0xea, 0xf3, 0xf3, 0xf3, 0xf3, 0xec, 0xa8, 0x9c, 0x95, 0xec, 0x91, 0x4f, 0x23, 0x55, 0x42, 0x42, 0x38, 0x38, 0x47, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3f, 0x47, 0x49, 0x42, 0x47, 0x3d, 0x2a, 0x71, 0x94, 0xd7, 0xbc, 0xbc, 0x9f, 0xca, 0xe7, 0xf3, 0xf3, 0xf3, 0xf3, 0xb8, 0x9e, 0x9b, 0x9e, 0x9f, 0x9f, 0x9f, 0x9e, 0x9a, 0xd7, 0xea, 0xe8, 0xee, 0xed, 0xee, 0xf0, 0xed, 0xee, 0xbb, 0x92, 0x66, 0x2b, 0x54, 0x42, 0x3f, 0x3b, 0x42, 0x42, 0x45, 0x42, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x3d, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x3f, 0x3d, 0x49, 0x49, 0x47, 0x37, 0x62, 0x14, 0xf8, 0xe8, 0xed, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xf2, 0xea, 0xfb, 0x09, 0x43, 0x42, 0x38, 0x3d, 0x45, 0x3d, 0x3d, 0x45, 0x42, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x47, 0x49, 0x3d, 0x3d, 0x49, 0x2d, 0x68, 0x93, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf2, 0xd7, 0x9a, 0x9e, 0x9e, 0xbc, 0xa1, 0xbc, 0x9f, 0x9e, 0xbc, 0xbd, 0xc5, 0xc2, 0xa3, 0x9b, 0xbc, 0x98, 0xeb, 0xf3, 0x82, 0x26, 0x3e, 0x42, 0x49, 0x3d, 0x2f, 0x3f, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x3d, 0x3d, 0x42, 0x49, 0x3d, 0x45, 0x42, 0x30, 0x3c, 0x89, 0xf3, 0xfb, 0xbc, 0xbc, 0x9a, 0x9d, 0xa5, 0xeb, 0xc2, 0x9f, 0x9a, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9a, 0xca, 0xea, 0xe8, 0xed, 0xee, 0xf0, 0xed, 0xed, 0xed, 0xe7, 0xbb, 0x94, 0x7e, 0x28, 0x42, 0x42, 0x3b, 0x3b, 0x45, 0x42, 0x45, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x3d, 0x45, 0x42, 0x42, 0x45, 0x49, 0x42, 0x44, 0x3d, 0x49, 0x49, 0x47, 0x44, 0x48, 0x25, 0xea, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf3, 0xc5, 0x07, 0x51, 0x3d, 0x3b, 0x3d, 0x42, 0x3d, 0x3d, 0x42, 0x45, 0x3d, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x3f, 0x3d, 0x49, 0x28, 0x80, 0xf3, 0xed, 0xe8, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xe5, 0xee, 0xea, 0xeb, 0x9a, 0x9e, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0x9f, 0x9f, 0x9d, 0x9f, 0x9f, 0xbc, 0x9a, 0xf5, 0xf7, 0x90, 0x78, 0x24, 0x2b, 0x37, 0x49, 0x3d, 0x3e, 0x38, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x42, 0x42, 0x3d, 0x44, 0x3d, 0x55, 0x2e, 0x78, 0x94, 0xe4, 0x04, 0x9f, 0xa1, 0x9e, 0x9d, 0x9a, 0x9a, 0x9b, 0x9e, 0x9d, 0x9f, 0xa1, 0xa1, 0x9f, 0x9a, 0xbd, 0x99, 0xe9, 0xbb, 0xf0, 0xf2, 0xed, 0xee, 0xf0, 0xed, 0xed, 0xe8, 0xea, 0x8b, 0x3a, 0x30, 0x42, 0x44, 0x3b, 0x46, 0x45, 0x42, 0x42, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x3d, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x49, 0x3f, 0x3d, 0x49, 0x42, 0x3d, 0x44, 0x21, 0x72, 0xea, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xf3, 0xd7, 0x05, 0x39, 0x35, 0x3b, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x47, 0x42, 0x38, 0x37, 0x42, 0x5b, 0x8f, 0xba, 0xb9, 0xe8, 0xed, 0xe8, 0xed, 0xef, 0xed, 0xed, 0xf9, 0xee, 0xbb, 0xea, 0xb8, 0x9e, 0x9b, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x9f, 0x9a, 0xbd, 0xf9, 0x94, 0x1c, 0x73, 0x31, 0x3f, 0x30, 0x42, 0x37, 0x2d, 0x38, 0x49, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x49, 0x46, 0x38, 0x3f, 0x47, 0x49, 0x2f, 0x36, 0x8a, 0x94, 0xe4, 0xa8, 0x9e, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa0, 0x9a, 0x9d, 0xca, 0x99, 0xf2, 0xe7, 0xee, 0xe5, 0xf0, 0xf0, 0xed, 0xed, 0xed, 0xe8, 0xed, 0xef, 0x93, 0x7b, 0x2a, 0x47, 0x3d, 0x3b, 0x38, 0x45, 0x45, 0x45, 0x42, 0x45, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x42, 0x45, 0x42, 0x42, 0x45, 0x49, 0x42, 0x3d, 0x44, 0x49, 0x45, 0x47, 0x2f, 0x1e, 0x87, 0xf0, 0xee, 0xef, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xf0, 0xea, 0xec, 0x05, 0x21, 0x4b, 0x38, 0x3b, 0x38, 0x3d, 0x49, 0x3d, 0x45, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x42, 0x3d, 0x42, 0x37, 0x42, 0x3d, 0x42, 0x37, 0x42, 0x3d, 0x47, 0x3d, 0x2b, 0x78, 0x93, 0xe5, 0xf2, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf2, 0xed, 0xee, 0xed, 0xed, 0xe8, 0xf3, 0xdc, 0xa8, 0x9e, 0x9b, 0x9e, 0x9e, 0x9f, 0xf4, 0xf4, 0x9a, 0x9f, 0xca, 0xba, 0x92, 0x81, 0x19, 0x60, 0x37, 0x37, 0x3d, 0x3d, 0x37, 0x3b, 0x38, 0x3d, 0x3d, 0x3d, 0x42, 0x3d, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x42, 0x3d, 0x38, 0x38, 0x47, 0x3d, 0x38, 0x24, 0x74, 0x91, 0x94, 0xef, 0xca, 0xa3, 0x9e, 0x9f, 0x9f, 0xa1, 0x9d, 0x9f, 0x9b, 0x9e, 0xbd, 0xdb, 0x94, 0xea, 0xed, 0xee, 0xe5, 0xf0, 0xed, 0xf0, 0xed, 0xee, 0xed, 0xed, 0xf0, 0xe7, 0xf9, 0x88, 0x27, 0x35, 0x47, 0x3d, 0x3e, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x45, 0x45, 0x3d, 0x45, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x3d, 0x45, 0x45, 0x45, 0x3d, 0x45, 0x42, 0x42, 0x4b, 0x38, 0x1f, 0xfe, 0xf9, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xbb, 0xf3, 0x08, 0x19, 0x35, 0x47, 0x2f, 0x2f, 0x46, 0x49, 0x42, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x46, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x35, 0x38, 0x47, 0x47, 0x37, 0x32, 0x90, 0xef, 0xed, 0xf0, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xe5, 0xe8, 0xea, 0xf3, 0xdc, 0x1b, 0xbd, 0xa8, 0xa5, 0xc2, 0xfc, 0xd7, 0xe1, 0xf3, 0x94, 0x88, 0x1f, 0x41, 0x3f, 0x3e, 0x38, 0x38, 0x38, 0x38, 0x37, 0x3d, 0x3d, 0x4b, 0x3d, 0x3d, 0x45, 0x3d, 0x47, 0x42, 0x47, 0x42, 0x47, 0x42, 0x47, 0x49, 0x47, 0x42, 0x42, 0x45, 0x37, 0x28, 0x76, 0x90, 0x94, 0xf3, 0xe1, 0xd7, 0xc5, 0xc2, 0xa8, 0xc2, 0xc5, 0xb8, 0xe2, 0xea, 0xf3, 0xed, 0xf0, 0xf7, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xbb, 0xe8, 0xef, 0x92, 0x71, 0x2d, 0x47, 0x45, 0x38, 0x38, 0x3d, 0x3f, 0x37, 0x3f, 0x3d, 0x4b, 0x3d, 0x42, 0x45, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x45, 0x3d, 0x44, 0x45, 0x42, 0x4b, 0x42, 0x49, 0x31, 0x3a, 0x94, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xf0, 0xe8, 0xf3, 0x14, 0x12, 0x3e, 0x42, 0x44, 0x3b, 0x3f, 0x49, 0x3d, 0x3d, 0x37, 0x3d, 0x3d, 0x42, 0x3d, 0x42, 0x37, 0x3d, 0x3d, 0x37, 0x3d, 0x42, 0x37, 0x42, 0x42, 0x42, 0x37, 0x4b, 0x47, 0x3f, 0x24, 0x7b, 0x92, 0xee, 0xe8, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xf2, 0xe5, 0xf2, 0xed, 0xea, 0xea, 0xea, 0xf2, 0xbb, 0x99, 0xea, 0xe9, 0xbb, 0xff, 0x8b, 0x2c, 0x3e, 0x53, 0x41, 0x41, 0x2f, 0x3e, 0x35, 0x37, 0x42, 0x37, 0x49, 0x38, 0x46, 0x3f, 0x46, 0x4b, 0x46, 0x46, 0x46, 0x4e, 0x49, 0x49, 0x49, 0x54, 0x54, 0x54, 0x49, 0x49, 0x49, 0x3e, 0x24, 0x78, 0x8f, 0x94, 0xea, 0xf3, 0xf2, 0x99, 0xbb, 0xe8, 0xf3, 0xf3, 0xf2, 0xe5, 0xed, 0xe5, 0xf7, 0xf2, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xbb, 0xb9, 0xe8, 0xff, 0x89, 0x3c, 0x2a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x4b, 0x3d, 0x3d, 0x3d, 0x3d, 0x45, 0x3d, 0x45, 0x3d, 0x45, 0x3d, 0x45, 0x3d, 0x45, 0x3d, 0x3f, 0x38, 0x3d, 0x45, 0x42, 0x24, 0x7b, 0xf9, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xf2, 0xea, 0x72, 0x0c, 0x57, 0x37, 0x47, 0x3d, 0x38, 0x3f, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x37, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x47, 0x47, 0x47, 0x2d, 0x33, 0x8f, 0xff, 0xf2, 0xe4, 0xe7, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xf2, 0xed, 0xe5, 0xf2, 0xee, 0xe8, 0xee, 0xe8, 0xe7, 0xbb, 0xba, 0x97, 0x8b, 0x4f, 0x2e, 0x4e, 0x45, 0x44, 0x45, 0x37, 0x45, 0x37, 0x42, 0x46, 0x42, 0x46, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x45, 0x4b, 0x4b, 0x4b, 0x46, 0x46, 0x46, 0x46, 0x3d, 0x4b, 0x3f, 0x3f, 0x3b, 0x2f, 0x3b, 0x28, 0x68, 0x8f, 0x94, 0xbb, 0xf3, 0x97, 0xf9, 0xe8, 0xf2, 0xe7, 0xe8, 0xf2, 0xed, 0xf1, 0xe5, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0x99, 0xb9, 0xe7, 0xed, 0x90, 0x74, 0x24, 0x38, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x3d, 0x4b, 0x45, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x45, 0x42, 0x3b, 0x3b, 0x47, 0x42, 0x3b, 0x26, 0x88, 0xf0, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xf2, 0xf2, 0x97, 0x0d, 0x21, 0x4a, 0x55, 0x47, 0x3b, 0x3b, 0x3d, 0x42, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x47, 0x47, 0x37, 0x21, 0x83, 0xff, 0xf8, 0xf7, 0xe7, 0xba, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xe5, 0xed, 0xed, 0xee, 0xf8, 0xf8, 0xf9, 0x92, 0x8f, 0x32, 0x39, 0x3e, 0x52, 0x47, 0x47, 0x47, 0x3d, 0x3d, 0x38, 0x30, 0x2b, 0x2b, 0x2f, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x31, 0x2d, 0x2d, 0x2f, 0x2f, 0x3f, 0x4b, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x2e, 0x33, 0x8d, 0xff, 0xe5, 0x97, 0x97, 0xf2, 0xed, 0xf7, 0xed, 0xed, 0xed, 0xe5, 0xf0, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xe5, 0xe7, 0xb9, 0xf8, 0x8d, 0x40, 0x2a, 0x47, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x4b, 0x3f, 0x3d, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x49, 0x3f, 0x3b, 0x47, 0x47, 0x31, 0x5f, 0x92, 0xed, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe7, 0xee, 0xf3, 0x25, 0x12, 0x43, 0x42, 0x3d, 0x44, 0x2f, 0x37, 0x45, 0x37, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x47, 0x47, 0x2a, 0x61, 0x91, 0xe8, 0xf8, 0xf8, 0xe8, 0xb9, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xf1, 0xe5, 0xff, 0x8f, 0x74, 0x2e, 0x53, 0x4e, 0x52, 0x3b, 0x38, 0x2f, 0x23, 0x24, 0x2c, 0x3c, 0x4f, 0x71, 0x74, 0x7b, 0x7e, 0x7f, 0x82, 0x84, 0x7f, 0x7f, 0x7b, 0x78, 0x71, 0x5f, 0x4f, 0x3c, 0x36, 0x2a, 0x23, 0x2b, 0x37, 0x42, 0x54, 0x54, 0x54, 0x1e, 0x70, 0x91, 0x99, 0xbb, 0xe6, 0xf8, 0xed, 0xf0, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xf7, 0xef, 0xe6, 0xe7, 0xf8, 0x92, 0x78, 0x24, 0x37, 0x45, 0x37, 0x42, 0x37, 0x42, 0x42, 0x42, 0x3d, 0x3d, 0x3f, 0x45, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x45, 0x42, 0x54, 0x3d, 0x44, 0x3d, 0x45, 0x24, 0x83, 0xfe, 0xf1, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xe8, 0xe7, 0xef, 0xf3, 0x0f, 0x26, 0x3e, 0x49, 0x3b, 0x3b, 0x3d, 0x3d, 0x3d, 0x37, 0x45, 0x3d, 0x45, 0x3d, 0x45, 0x3d, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x45, 0x45, 0x3d, 0x30, 0x4c, 0x2c, 0x8d, 0x93, 0xed, 0xf8, 0xf8, 0xf7, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe5, 0xf1, 0x93, 0x80, 0x1f, 0x43, 0x35, 0x2e, 0x2c, 0x40, 0x61, 0x71, 0x7f, 0x86, 0x8c, 0x90, 0x93, 0x93, 0x92, 0x90, 0x90, 0x90, 0x8b, 0x8b, 0x8b, 0x8b, 0x8f, 0x8b, 0x8f, 0x8f, 0x8f, 0x8c, 0x89, 0x85, 0x7f, 0x78, 0x4d, 0x40, 0x36, 0x2a, 0x2b, 0x41, 0x20, 0x82, 0xfe, 0xf8, 0xe5, 0xf0, 0xed, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0xf8, 0x8f, 0x6f, 0x24, 0x35, 0x38, 0x3d, 0x4e, 0x42, 0x42, 0x42, 0x3d, 0x38, 0x3d, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x54, 0x49, 0x3d, 0x3d, 0x2d, 0x6f, 0x8f, 0x94, 0xf7, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xe4, 0xea, 0x93, 0x34, 0x17, 0x43, 0x46, 0x37, 0x3b, 0x42, 0x3d, 0x37, 0x3d, 0x3d, 0x45, 0x3d, 0x45, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x45, 0x3d, 0x45, 0x3f, 0x3b, 0x1f, 0x7e, 0x92, 0xf1, 0xed, 0xf8, 0xf8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xf0, 0xee, 0xf0, 0xed, 0xf0, 0xed, 0xf1, 0xf8, 0xf8, 0x90, 0x25, 0x22, 0x32, 0x6f, 0x78, 0x84, 0x8f, 0x91, 0x91, 0x90, 0x8d, 0x86, 0x7e, 0x74, 0x68, 0x61, 0x5e, 0x4f, 0x3c, 0x32, 0x3c, 0x32, 0x3c, 0x3c, 0x50, 0x50, 0x59, 0x6f, 0x78, 0x7f, 0x84, 0x8c, 0x8f, 0x8f, 0x8d, 0x82, 0x78, 0x4f, 0x26, 0x20, 0x4d, 0x8f, 0x8e, 0xf8, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xf8, 0xf0, 0xe7, 0xed, 0x93, 0x89, 0x40, 0x24, 0x3b, 0x38, 0x3f, 0x45, 0x42, 0x42, 0x3d, 0x3d, 0x3f, 0x45, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x55, 0x49, 0x47, 0x3e, 0x26, 0x82, 0x92, 0xf7, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xb9, 0xf2, 0xf0, 0xff, 0x94, 0x1c, 0x1f, 0x53, 0x45, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x45, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x3d, 0x45, 0x45, 0x3d, 0x24, 0x7b, 0x93, 0xe8, 0xed, 0xf8, 0xf7, 0xba, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xf1, 0xf8, 0x8a, 0x65, 0x83, 0x8f, 0x90, 0x8f, 0x8d, 0x83, 0x7b, 0x6d, 0x3a, 0x26, 0x21, 0x23, 0x31, 0x2b, 0x37, 0x30, 0x30, 0x37, 0x3d, 0x4e, 0x45, 0x42, 0x42, 0x37, 0x46, 0x3e, 0x35, 0x31, 0x2e, 0x28, 0x3c, 0x66, 0x78, 0x89, 0x8d, 0x91, 0x90, 0x8c, 0x80, 0x5a, 0x8a, 0xff, 0xe8, 0xe8, 0xe8, 0xed, 0xe8, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xe6, 0xe8, 0xf7, 0xff, 0xb9, 0xe7, 0xe8, 0x93, 0x85, 0x36, 0x2f, 0x4c, 0x3f, 0x3d, 0x42, 0x3d, 0x37, 0x3f, 0x3d, 0x4b, 0x3d, 0x42, 0x45, 0x45, 0x3d, 0x42, 0x45, 0x4b, 0x38, 0x47, 0x42, 0x27, 0x70, 0x92, 0xf8, 0xed, 0xb9, 0xe8, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xb9, 0xf8, 0xf7, 0xf9, 0x8a, 0x1d, 0x2e, 0x37, 0x49, 0x42, 0x42, 0x42, 0x42, 0x45, 0x3d, 0x45, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x4e, 0x38, 0x3e, 0x2f, 0x76, 0x91, 0xf7, 0xb9, 0xe8, 0xef, 0x97, 0xba, 0xe8, 0xee, 0xee, 0xee, 0xed, 0xbb, 0xed, 0xbb, 0xed, 0xe8, 0xee, 0xf7, 0xf0, 0xed, 0xf0, 0xee, 0xed, 0xee, 0xed, 0xed, 0xb9, 0xed, 0x97, 0x92, 0x91, 0x86, 0x7b, 0x4d, 0x26, 0x23, 0x23, 0x2a, 0x2b, 0x2a, 0x35, 0x2f, 0x2b, 0x2f, 0x2b, 0x2d, 0x2d, 0x2e, 0x31, 0x2d, 0x41, 0x31, 0x41, 0x2d, 0x41, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3e, 0x2f, 0x35, 0x28, 0x32, 0x6f, 0x82, 0x8c, 0x8f, 0x92, 0xe5, 0xba, 0xb9, 0xed, 0xe7, 0xb9, 0xe8, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xed, 0xe8, 0xe8, 0xe8, 0xe8, 0xee, 0xed, 0xee, 0xee, 0xe6, 0xe8, 0xf7, 0xef, 0xb9, 0xb9, 0xb9, 0xff, 0x92, 0x7f, 0x27, 0x2f, 0x35, 0x3f, 0x3d, 0x42, 0x45, 0x37, 0x3f, 0x42, 0x3d, 0x3d, 0x46, 0x3d, 0x4b, 0x3d, 0x45, 0x3d, 0x38, 0x4e, 0x2a, 0x5e, 0x8f, 0xf8, 0xed, 0xf2, 0xe4, 0xe8, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xbb, 0xb9, 0xee, 0xee, 0xee, 0xea, 0x83, 0x1d, 0x3e, 0x54, 0x55, 0x55, 0x49, 0x42, 0x46, 0x46, 0x3d, 0x45, 0x3d, 0x37, 0x47, 0x47, 0x49, 0x55, 0x37, 0x4a, 0x21, 0x7b, 0x90, 0xf9, 0xf7, 0xe8, 0xed, 0xbb, 0xe5, 0xbb, 0xed, 0xf1, 0xf8, 0xed, 0xee, 0xbb, 0xb9, 0xba, 0xbb, 0xbb, 0xed, 0xf0, 0xf8, 0xed, 0xf1, 0xee, 0xe5, 0xe5, 0xba, 0xba, 0x99, 0x94, 0x8e, 0x7b, 0x4f, 0x21, 0x1e, 0x2f, 0x2f, 0x30, 0x2b, 0x2a, 0x23, 0x27, 0x3c, 0x40, 0x66, 0x76, 0x76, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x76, 0x76, 0x66, 0x5b, 0x36, 0x2d, 0x2d, 0x2f, 0x2a, 0x52, 0x35, 0x3b, 0x2f, 0x2d, 0x66, 0x77, 0x8f, 0xff, 0x94, 0xf1, 0xed, 0xe7, 0xb9, 0xe5, 0x97, 0xf7, 0xf0, 0xee, 0xee, 0xba, 0xb9, 0xba, 0xb9, 0xed, 0xed, 0xf7, 0xed, 0xf8, 0xf0, 0xed, 0xbb, 0xe8, 0xf0, 0xf0, 0xf9, 0xf9, 0x92, 0x82, 0x21, 0x31, 0x3f, 0x3f, 0x3d, 0x45, 0x38, 0x46, 0x42, 0x42, 0x46, 0x3f, 0x46, 0x3f, 0x3d, 0x3d, 0x47, 0x55, 0x2a, 0x3a, 0x88, 0x94, 0xed, 0xed, 0xed, 0xef, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xbb, 0xee, 0xed, 0xf1, 0xed, 0xe8, 0x93, 0x83, 0x20, 0x2d, 0x3e, 0x38, 0x38, 0x4b, 0x42, 0x47, 0x42, 0x47, 0x42, 0x54, 0x49, 0x47, 0x47, 0x3d, 0x2f, 0x40, 0x82, 0x93, 0xff, 0xee, 0xee, 0xed, 0xe8, 0xe5, 0x97, 0xed, 0xee, 0xed, 0xed, 0xee, 0xe8, 0xed, 0xee, 0xee, 0xed, 0xf0, 0xf7, 0xbb, 0xe7, 0xe8, 0xf1, 0xed, 0xf8, 0xf9, 0x94, 0xfe, 0x87, 0x4d, 0x20, 0x1e, 0x2b, 0x37, 0x35, 0x23, 0x24, 0x2c, 0x50, 0x6f, 0x7e, 0x85, 0x8f, 0x91, 0x92, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x92, 0x93, 0x92, 0xf3, 0x94, 0x94, 0x91, 0x90, 0x89, 0x7e, 0x78, 0x61, 0x36, 0x2e, 0x31, 0x35, 0x58, 0x31, 0x27, 0x32, 0x71, 0x86, 0x92, 0x93, 0xf7, 0xf9, 0xf1, 0xf1, 0xe8, 0xb9, 0xb9, 0xf0, 0xed, 0xe8, 0xb9, 0xed, 0xed, 0xf7, 0xe7, 0xe5, 0xf0, 0xf7, 0xed, 0xe8, 0xee, 0xf0, 0xf0, 0xee, 0xed, 0x99, 0x94, 0x85, 0x2c, 0x2b, 0x37, 0x38, 0x38, 0x42, 0x55, 0x47, 0x42, 0x47, 0x45, 0x47, 0x3f, 0x3f, 0x3b, 0x2f, 0x2d, 0x4f, 0x85, 0x92, 0xf7, 0xe8, 0xed, 0xf0, 0xf7, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xf0, 0xf8, 0xe7, 0xe6, 0x97, 0x92, 0x83, 0x20, 0x2e, 0x2f, 0x3e, 0x3d, 0x47, 0x42, 0x47, 0x3d, 0x3f, 0x49, 0x49, 0x54, 0x37, 0x23, 0x3a, 0x88, 0x92, 0x92, 0xff, 0xef, 0xed, 0xe7, 0xe7, 0xee, 0xef, 0xee, 0xee, 0xe7, 0xb9, 0xe8, 0xed, 0xee, 0xf0, 0xf8, 0xf8, 0xf8, 0xf0, 0xe6, 0xb9, 0xb9, 0xe8, 0xf7, 0x94, 0x91, 0x8b, 0x5a, 0x19, 0x1e, 0x23, 0x30, 0x30, 0x2b, 0x1e, 0x40, 0x76, 0x83, 0x8f, 0x91, 0x92, 0x93, 0x93, 0x93, 0x92, 0x92, 0x8b, 0x88, 0x88, 0x83, 0x88, 0x83, 0x83, 0x83, 0x88, 0x87, 0x8e, 0x8e, 0x92, 0x93, 0x92, 0x92, 0x92, 0x91, 0x90, 0x85, 0x78, 0x32, 0x28, 0x2b, 0x49, 0x46, 0x3e, 0x2a, 0x2c, 0x70, 0x8d, 0x92, 0xf8, 0xf1, 0xf1, 0xe6, 0xb9, 0xb9, 0xf8, 0xf8, 0xed, 0xee, 0xf0, 0xf7, 0xed, 0xb9, 0xb9, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xe8, 0xe7, 0xef, 0xf3, 0x94, 0x8b, 0x36, 0x2a, 0x30, 0x3d, 0x49, 0x47, 0x38, 0x3d, 0x47, 0x56, 0x42, 0x47, 0x4e, 0x46, 0x24, 0x3a, 0x88, 0x91, 0xf9, 0xee, 0xed, 0xf1, 0xf7, 0xf0, 0xf7, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf7, 0xbb, 0xef, 0xf8, 0xf1, 0xed, 0xe7, 0xb9, 0xef, 0x94, 0x8b, 0x61, 0x21, 0x2e, 0x46, 0x42, 0x55, 0x42, 0x46, 0x38, 0x41, 0x31, 0x2a, 0x40, 0x7b, 0x92, 0x92, 0x7a, 0x4d, 0x8f, 0x97, 0xed, 0xe7, 0xed, 0xf0, 0xf8, 0xef, 0xed, 0xbb, 0xb9, 0xe8, 0xed, 0xf1, 0xf7, 0xf1, 0xed, 0xf1, 0xed, 0xf1, 0xed, 0xbb, 0x97, 0x94, 0x83, 0x4d, 0x1a, 0x1a, 0x30, 0x30, 0x2a, 0x21, 0x20, 0x74, 0x86, 0x8f, 0x91, 0x92, 0x91, 0x8e, 0x83, 0x7b, 0x61, 0x4f, 0x48, 0x28, 0x2e, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x24, 0x24, 0x28, 0x31, 0x2e, 0x39, 0x59, 0x5e, 0x74, 0x7e, 0x86, 0x8f, 0x93, 0x93, 0x90, 0x85, 0x6f, 0x29, 0x2a, 0x38, 0x56, 0x44, 0x23, 0x29, 0x77, 0x8b, 0x93, 0xf1, 0xf1, 0xee, 0xed, 0xed, 0xed, 0xe8, 0xf1, 0xf7, 0xf1, 0xf7, 0xb9, 0xb9, 0xb9, 0xed, 0xf0, 0xf0, 0xf1, 0xed, 0xe8, 0xe7, 0xe8, 0x91, 0x7a, 0x79, 0x93, 0x90, 0x74, 0x28, 0x2a, 0x3e, 0x31, 0x3e, 0x45, 0x49, 0x42, 0x55, 0x46, 0x24, 0x39, 0x78, 0x91, 0x94, 0xef, 0xe5, 0xe9, 0xed, 0xf0, 0xf7, 0xef, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xbb, 0xf7, 0xee, 0xf8, 0xf1, 0xe7, 0xed, 0xe8, 0xf7, 0xff, 0x90, 0x7e, 0x33, 0x21, 0x2e, 0x35, 0x35, 0x31, 0x31, 0x1e, 0x32, 0x74, 0x8c, 0x90, 0x8d, 0x74, 0x21, 0x27, 0x74, 0x93, 0xff, 0xe6, 0xe7, 0xf1, 0xf8, 0xf7, 0xee, 0xb9, 0xee, 0xe8, 0xed, 0xee, 0xf1, 0xed, 0xe9, 0xb9, 0xe7, 0xf8, 0xf8, 0x92, 0x90, 0x6d, 0x1d, 0x1a, 0x23, 0x2b, 0x2b, 0x1e, 0x26, 0x77, 0x8b, 0x92, 0x92, 0x90, 0x86, 0x7b, 0x66, 0x32, 0x29, 0x27, 0x2d, 0x2b, 0x37, 0x42, 0x42, 0x3d, 0x3d, 0x3d, 0x3d, 0x4b, 0x45, 0x3d, 0x3d, 0x45, 0x55, 0x49, 0x3d, 0x35, 0x31, 0x2d, 0x29, 0x3c, 0x66, 0x74, 0x83, 0x90, 0x92, 0x91, 0x88, 0x74, 0x21, 0x31, 0x49, 0x54, 0x3e, 0x1f, 0x33, 0x80, 0x90, 0x92, 0xf8, 0xed, 0xe7, 0xe7, 0xe6, 0xe7, 0xed, 0xf1, 0xed, 0xe8, 0xba, 0xb9, 0xe8, 0xf7, 0xf1, 0xee, 0xed, 0xe8, 0xed, 0xf7, 0x8c, 0x40, 0x3a, 0x78, 0x91, 0x91, 0x82, 0x3a, 0x1f, 0x28, 0x2a, 0x31, 0x3e, 0x2a, 0x24, 0x26, 0x74, 0x86, 0x91, 0xff, 0xf7, 0xe8, 0xe8, 0xed, 0xf1, 0xf0, 0xee, 0xba, 0xed, 0xee, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xbb, 0xee, 0xed, 0xed, 0xf1, 0xed, 0xf1, 0xf1, 0xed, 0xed, 0x94, 0x92, 0x85, 0x77, 0x68, 0x68, 0x71, 0x74, 0x84, 0x8d, 0x92, 0x91, 0x82, 0x48, 0x2b, 0x37, 0x38, 0x2c, 0x88, 0x91, 0xee, 0xe9, 0xed, 0xf8, 0xf8, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xe7, 0xe6, 0xe8, 0xb9, 0xe5, 0x99, 0xfe, 0x91, 0x7b, 0x1d, 0x1a, 0x1e, 0x23, 0x23, 0x1e, 0x33, 0x77, 0x8f, 0x92, 0x92, 0x8b, 0x7e, 0x61, 0x32, 0x2a, 0x37, 0x37, 0x45, 0x42, 0x42, 0x47, 0x3d, 0x47, 0x47, 0x47, 0x49, 0x47, 0x42, 0x47, 0x42, 0x47, 0x42, 0x47, 0x44, 0x44, 0x45, 0x44, 0x4b, 0x4e, 0x4e, 0x42, 0x46, 0x35, 0x2e, 0x32, 0x77, 0x8b, 0x92, 0x92, 0x8d, 0x77, 0x29, 0x2b, 0x2f, 0x2f, 0x2f, 0x21, 0x3c, 0x89, 0x91, 0xff, 0xe5, 0xba, 0xb9, 0xb9, 0xe9, 0xed, 0xf0, 0xed, 0xee, 0xba, 0xed, 0xf0, 0xf0, 0xee, 0xe8, 0xee, 0xff, 0x92, 0x66, 0x2a, 0x30, 0x31, 0x66, 0x8c, 0x93, 0x91, 0x85, 0x71, 0x61, 0x4f, 0x61, 0x70, 0x82, 0x87, 0xff, 0x99, 0xbb, 0xf7, 0xf1, 0xed, 0xed, 0xed, 0xf0, 0xf7, 0xbb, 0xb9, 0xbb, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xbb, 0xed, 0xe8, 0xed, 0xf0, 0xf1, 0xf0, 0xf1, 0xf7, 0xf1, 0xf8, 0xf6, 0x94, 0x93, 0x8e, 0x92, 0x91, 0x91, 0x90, 0x8d, 0x85, 0x5f, 0x21, 0x3b, 0x49, 0x54, 0x49, 0x23, 0x76, 0x90, 0xf8, 0xb9, 0xee, 0xf0, 0xf7, 0xef, 0xee, 0xf7, 0xf0, 0xe8, 0xe7, 0xe7, 0xed, 0xf9, 0xff, 0x92, 0x8b, 0x4d, 0x19, 0x23, 0x2b, 0x30, 0x1e, 0x20, 0x77, 0x8e, 0xf3, 0x91, 0x89, 0x78, 0x40, 0x2e, 0x31, 0x3b, 0x3d, 0x49, 0x49, 0x49, 0x42, 0x42, 0x46, 0x3f, 0x3e, 0x38, 0x4e, 0x42, 0x4e, 0x49, 0x46, 0x49, 0x4e, 0x42, 0x46, 0x45, 0x3f, 0x45, 0x49, 0x49, 0x49, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x31, 0x36, 0x74, 0x89, 0x92, 0xf3, 0x8b, 0x71, 0x2c, 0x2d, 0x3d, 0x3d, 0x2a, 0x32, 0x77, 0x92, 0x92, 0xef, 0xe5, 0xb9, 0xe6, 0xe8, 0xee, 0xee, 0xef, 0xb9, 0xee, 0xf0, 0xed, 0xe8, 0xb9, 0x97, 0x91, 0x83, 0x2e, 0x4b, 0x37, 0x49, 0x35, 0x48, 0x77, 0x8f, 0x90, 0x90, 0x91, 0x8e, 0x8e, 0x93, 0xff, 0x94, 0x99, 0xe5, 0xb9, 0xf8, 0xed, 0xed, 0xe8, 0xf1, 0xf0, 0xf0, 0xee, 0xb9, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xe8, 0xb9, 0xbb, 0xed, 0xef, 0xed, 0xe8, 0xee, 0xf8, 0xf0, 0xf2, 0xed, 0xef, 0xff, 0x8e, 0x8f, 0x86, 0x7b, 0x5e, 0x24, 0x2b, 0x44, 0x3f, 0x3f, 0x42, 0x49, 0x49, 0x36, 0x85, 0xff, 0xb9, 0xe7, 0xf7, 0xf9, 0xed, 0xef, 0xef, 0xed, 0xe7, 0xe6, 0xe8, 0xf9, 0x8e, 0x91, 0x7a, 0x20, 0x1a, 0x23, 0x2b, 0x23, 0x1e, 0x61, 0x8d, 0x93, 0xbb, 0x92, 0x7a, 0x26, 0x24, 0x46, 0x49, 0x42, 0x45, 0x46, 0x38, 0x3f, 0x37, 0x4e, 0x49, 0x3d, 0x46, 0x3f, 0x46, 0x42, 0x4e, 0x49, 0x4e, 0x42, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x54, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0x4b, 0x42, 0x55, 0x54, 0x54, 0x31, 0x1d, 0x83, 0x97, 0xf3, 0x93, 0x86, 0x4f, 0x1e, 0x46, 0x37, 0x2d, 0x21, 0x5f, 0x8d, 0x91, 0xfe, 0xe8, 0xb9, 0xe7, 0xee, 0xed, 0xef, 0xe8, 0xed, 0xf1, 0xf1, 0xbb, 0xe5, 0x94, 0x8f, 0x68, 0x31, 0x3d, 0x38, 0x42, 0x49, 0x49, 0x2e, 0x4f, 0x74, 0x89, 0x8d, 0x91, 0x93, 0xf9, 0xee, 0xe5, 0xed, 0xf0, 0xff, 0xf0, 0xed, 0xbb, 0xb9, 0xbb, 0xf7, 0xf0, 0xed, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xf0, 0xed, 0xbb, 0xb9, 0xba, 0xbb, 0xba, 0xbb, 0xba, 0xba, 0xb9, 0xb9, 0xe9, 0xf8, 0x8b, 0x4d, 0x26, 0x2e, 0x23, 0x2b, 0x4b, 0x37, 0x49, 0x42, 0x3f, 0x3b, 0x3f, 0x47, 0x35, 0x71, 0x93, 0xbb, 0xe6, 0xee, 0xf7, 0xef, 0xee, 0xf7, 0xee, 0xb9, 0xe7, 0xef, 0x92, 0x8f, 0x68, 0x1f, 0x2b, 0x2f, 0x2a, 0x24, 0x26, 0x82, 0x90, 0xfe, 0x94, 0x93, 0x90, 0x70, 0x27, 0x44, 0x47, 0x47, 0x44, 0x3e, 0x3d, 0x47, 0x42, 0x47, 0x55, 0x42, 0x49, 0x42, 0x42, 0x45, 0x3d, 0x47, 0x3d, 0x45, 0x47, 0x45, 0x47, 0x3d, 0x4b, 0x3d, 0x45, 0x3d, 0x4b, 0x44, 0x44, 0x44, 0x44, 0x44, 0x52, 0x3b, 0x47, 0x56, 0x3d, 0x4a, 0x2c, 0x85, 0x8f, 0x93, 0xff, 0x93, 0x90, 0x78, 0x28, 0x43, 0x30, 0x44, 0x23, 0x32, 0x82, 0x91, 0xf7, 0xee, 0xe7, 0xe7, 0xee, 0xee, 0xed, 0xee, 0xf7, 0xe7, 0xb9, 0x99, 0xfe, 0x82, 0x1f, 0x39, 0x2f, 0x42, 0x42, 0x49, 0x37, 0x42, 0x35, 0x2e, 0x36, 0x48, 0x6f, 0x70, 0x87, 0xf1, 0xe8, 0xe8, 0x97, 0xef, 0xed, 0xba, 0xb9, 0xba, 0xbb, 0xef, 0xf0, 0xf0, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xbb, 0xed, 0xee, 0xee, 0xed, 0xbb, 0xe7, 0xee, 0xf7, 0xee, 0xf2, 0x91, 0x4d, 0x2a, 0x42, 0x42, 0x3d, 0x42, 0x42, 0x49, 0x42, 0x49, 0x4b, 0x3b, 0x47, 0x42, 0x60, 0x85, 0xf9, 0xe7, 0xed, 0xf8, 0x97, 0xf7, 0xf9, 0xed, 0xed, 0xf9, 0xff, 0x89, 0x3a, 0x1e, 0x23, 0x30, 0x2b, 0x1e, 0x61, 0x8d, 0x94, 0x94, 0x8c, 0x71, 0x8b, 0x91, 0x8d, 0x2c, 0x35, 0x47, 0x47, 0x2f, 0x46, 0x4b, 0x42, 0x45, 0x42, 0x42, 0x42, 0x45, 0x42, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x45, 0x45, 0x45, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x45, 0x4b, 0x46, 0x4e, 0x47, 0x47, 0x44, 0x27, 0x6f, 0x8f, 0x93, 0x7a, 0x77, 0x90, 0x94, 0x93, 0x83, 0x32, 0x23, 0x3d, 0x3d, 0x2e, 0x29, 0x7e, 0x92, 0xf7, 0xe7, 0xe7, 0x97, 0xf7, 0xfe, 0xf1, 0xe5, 0xb9, 0xba, 0x97, 0x8f, 0x32, 0x31, 0x2f, 0x30, 0x49, 0x49, 0x55, 0x49, 0x4e, 0x3d, 0x35, 0x58, 0x6b, 0x6b, 0x5e, 0x8f, 0xf2, 0xb9, 0xe8, 0xf7, 0xbb, 0xee, 0xee, 0xed, 0xbb, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xb9, 0xf0, 0xf8, 0xf0, 0xed, 0x93, 0x82, 0x24, 0x42, 0x47, 0x37, 0x3b, 0x38, 0x3d, 0x42, 0x49, 0x45, 0x4b, 0x4b, 0x5c, 0x5c, 0x2c, 0x88, 0xff, 0xf1, 0xf8, 0xed, 0x99, 0xed, 0xf0, 0xf2, 0x92, 0x83, 0x20, 0x1e, 0x2f, 0x37, 0x23, 0x29, 0x7e, 0x91, 0x94, 0x90, 0x7e, 0x2c, 0x1e, 0x4d, 0x8d, 0x90, 0x84, 0x29, 0x3f, 0x3d, 0x47, 0x3f, 0x46, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x5c, 0x3d, 0x47, 0x3e, 0x4f, 0x8c, 0x91, 0x8d, 0x1d, 0x24, 0x50, 0x84, 0x91, 0x93, 0x91, 0x5f, 0x24, 0x49, 0x42, 0x2a, 0x2c, 0x74, 0x93, 0xf0, 0xe8, 0xed, 0xf0, 0xf8, 0xef, 0xba, 0xb9, 0xf7, 0x92, 0x5f, 0x27, 0x2b, 0x44, 0x3d, 0x3d, 0x49, 0x49, 0x42, 0x4b, 0x38, 0x52, 0x5d, 0x75, 0x48, 0x7f, 0x92, 0xe7, 0xb9, 0xe8, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xe7, 0xee, 0xf7, 0xee, 0xe5, 0x93, 0x8d, 0x40, 0x35, 0x30, 0x3b, 0x38, 0x3f, 0x3f, 0x45, 0x45, 0x49, 0x4e, 0x38, 0x5c, 0x67, 0x2d, 0x4f, 0x8f, 0x92, 0xf8, 0xf2, 0xe6, 0xf2, 0xed, 0x92, 0x83, 0x20, 0x23, 0x2f, 0x30, 0x2a, 0x40, 0x82, 0x92, 0x93, 0x8f, 0x6f, 0x28, 0x2f, 0x41, 0x27, 0x78, 0x90, 0x90, 0x70, 0x23, 0x55, 0x55, 0x3f, 0x3f, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x47, 0x49, 0x4e, 0x24, 0x7e, 0x92, 0x8f, 0x71, 0x2d, 0x3e, 0x35, 0x2e, 0x78, 0x91, 0x94, 0x8f, 0x78, 0x1e, 0x3d, 0x5c, 0x2a, 0x21, 0x77, 0x91, 0xf0, 0xe7, 0xe9, 0xe6, 0xe7, 0xbb, 0xf7, 0x91, 0x7e, 0x1f, 0x41, 0x30, 0x3d, 0x38, 0x3d, 0x3d, 0x3d, 0x4b, 0x37, 0x52, 0x5c, 0x6a, 0x60, 0x3a, 0x8c, 0xff, 0xee, 0xe7, 0xb9, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xb9, 0xee, 0xee, 0xee, 0xe6, 0xef, 0x91, 0x7f, 0x36, 0x2f, 0x38, 0x38, 0x3f, 0x3f, 0x3f, 0x45, 0x45, 0x49, 0x3e, 0x6a, 0x42, 0x3d, 0x2d, 0x4f, 0x88, 0x93, 0xb9, 0xe8, 0xed, 0x93, 0x80, 0x20, 0x23, 0x47, 0x30, 0x24, 0x4f, 0x8e, 0x93, 0x92, 0x85, 0x32, 0x2a, 0x30, 0x47, 0x3d, 0x38, 0x28, 0x82, 0x93, 0x92, 0x32, 0x2b, 0x54, 0x3d, 0x44, 0x42, 0x42, 0x45, 0x45, 0x42, 0x45, 0x42, 0x42, 0x45, 0x4e, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x47, 0x47, 0x55, 0x23, 0x71, 0x91, 0x93, 0x7f, 0x24, 0x45, 0x47, 0x42, 0x49, 0x2a, 0x61, 0x8c, 0x92, 0x92, 0x7e, 0x29, 0x2a, 0x4b, 0x37, 0x21, 0x71, 0x91, 0xf8, 0xe7, 0xe7, 0xb9, 0xed, 0x92, 0x7e, 0x2c, 0x31, 0x30, 0x47, 0x3d, 0x3d, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x5c, 0x6a, 0x63, 0x39, 0x80, 0x92, 0xed, 0xef, 0xed, 0xe7, 0xbb, 0xf7, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xe8, 0xed, 0xef, 0xe7, 0xb9, 0xee, 0xfe, 0x8b, 0x61, 0x4a, 0x30, 0x42, 0x45, 0x3d, 0x3f, 0x4b, 0x4e, 0x49, 0x5c, 0x5c, 0x47, 0x47, 0x38, 0x24, 0x68, 0x91, 0xb9, 0xe5, 0xff, 0x83, 0x20, 0x23, 0x56, 0x30, 0x2a, 0x68, 0x8b, 0x99, 0x91, 0x78, 0x28, 0x31, 0x3d, 0x44, 0x37, 0x47, 0x47, 0x3e, 0x3a, 0x8f, 0x94, 0x80, 0x28, 0x4e, 0x30, 0x4b, 0x45, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x3d, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x47, 0x47, 0x46, 0x40, 0x8b, 0x92, 0x8d, 0x2c, 0x35, 0x3d, 0x47, 0x47, 0x3d, 0x46, 0x31, 0x48, 0x86, 0x93, 0x94, 0x7e, 0x2c, 0x35, 0x42, 0x47, 0x1e, 0x74, 0x91, 0xf8, 0xb9, 0xe7, 0x97, 0x8e, 0x20, 0x2d, 0x37, 0x47, 0x3d, 0x3d, 0x42, 0x44, 0x3b, 0x3f, 0x3f, 0x5c, 0x5d, 0x6a, 0x43, 0x59, 0x90, 0x99, 0xbb, 0xed, 0xed, 0xe7, 0xe7, 0xef, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xe8, 0xed, 0xbb, 0xed, 0xbb, 0xe6, 0xe9, 0xf8, 0x92, 0x82, 0x59, 0x46, 0x35, 0x49, 0x42, 0x3d, 0x38, 0x4b, 0x5c, 0x54, 0x49, 0x3f, 0x44, 0x44, 0x2a, 0x6f, 0x90, 0xbb, 0x99, 0x86, 0x20, 0x23, 0x3d, 0x37, 0x31, 0x6f, 0x91, 0xff, 0x90, 0x70, 0x24, 0x46, 0x49, 0x47, 0x3f, 0x47, 0x42, 0x47, 0x45, 0x2d, 0x74, 0x91, 0x91, 0x70, 0x24, 0x30, 0x47, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x42, 0x45, 0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x28, 0x7e, 0x94, 0x90, 0x76, 0x30, 0x38, 0x3d, 0x42, 0x38, 0x38, 0x3d, 0x42, 0x35, 0x40, 0x80, 0x93, 0x94, 0x83, 0x29, 0x46, 0x42, 0x3d, 0x21, 0x74, 0x90, 0xff, 0xe8, 0x94, 0x8e, 0x33, 0x2a, 0x47, 0x49, 0x3d, 0x42, 0x47, 0x4b, 0x44, 0x3f, 0x5c, 0x5c, 0x5d, 0x60, 0x48, 0x7f, 0x94, 0xba, 0xb9, 0xed, 0xf1, 0xe7, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xf7, 0xbb, 0xed, 0xe8, 0xe7, 0xee, 0xff, 0x91, 0x7f, 0x59, 0x4a, 0x37, 0x45, 0x3d, 0x3b, 0x53, 0x5c, 0x54, 0x49, 0x44, 0x3b, 0x4c, 0x29, 0x89, 0x91, 0xf9, 0x8f, 0x20, 0x24, 0x38, 0x30, 0x2e, 0x6f, 0x8d, 0x92, 0x8f, 0x5b, 0x2e, 0x4c, 0x30, 0x3d, 0x45, 0x42, 0x42, 0x49, 0x47, 0x3d, 0x4e, 0x28, 0x7f, 0x91, 0x8f, 0x3a, 0x2e, 0x3f, 0x42, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x3d, 0x52, 0x2d, 0x6f, 0x90, 0x93, 0x7e, 0x2a, 0x49, 0x3d, 0x38, 0x42, 0x38, 0x3b, 0x3b, 0x4b, 0x38, 0x31, 0x27, 0x7f, 0x92, 0x91, 0x85, 0x29, 0x30, 0x47, 0x2f, 0x21, 0x78, 0x90, 0x92, 0xf7, 0x94, 0x78, 0x27, 0x3d, 0x3d, 0x35, 0x42, 0x42, 0x35, 0x52, 0x5d, 0x6a, 0x5d, 0x62, 0x2c, 0x7b, 0x91, 0xff, 0xb9, 0xe7, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xed, 0xed, 0xf7, 0x97, 0x91, 0x70, 0x40, 0x5d, 0x37, 0x38, 0x3f, 0x52, 0x46, 0x54, 0x45, 0x4b, 0x52, 0x24, 0x78, 0x91, 0xfe, 0x91, 0x61, 0x1e, 0x38, 0x2f, 0x24, 0x4d, 0x8f, 0x91, 0x8d, 0x4f, 0x30, 0x37, 0x35, 0x52, 0x44, 0x47, 0x42, 0x42, 0x3d, 0x3e, 0x47, 0x55, 0x37, 0x36, 0x8c, 0x92, 0x85, 0x26, 0x2a, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x31, 0x32, 0x8b, 0x92, 0x8c, 0x3c, 0x35, 0x37, 0x47, 0x3d, 0x42, 0x3d, 0x3f, 0x38, 0x44, 0x3f, 0x3f, 0x46, 0x24, 0x7b, 0x91, 0x91, 0x82, 0x21, 0x3b, 0x3d, 0x3b, 0x24, 0x78, 0x92, 0xff, 0xf2, 0x8c, 0x5e, 0x2b, 0x38, 0x4a, 0x3f, 0x53, 0x4c, 0x64, 0x6e, 0x6a, 0x60, 0x2c, 0x70, 0x90, 0xf9, 0xf7, 0xf0, 0xed, 0xe7, 0xed, 0xf1, 0xf0, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xf1, 0xf7, 0xef, 0xf7, 0xed, 0xf2, 0xee, 0x99, 0xbb, 0xba, 0x92, 0x74, 0x39, 0x5d, 0x3b, 0x52, 0x4e, 0x49, 0x3d, 0x44, 0x56, 0x35, 0x69, 0x8f, 0xba, 0xf3, 0x77, 0x1e, 0x37, 0x37, 0x23, 0x61, 0x90, 0xf9, 0x90, 0x32, 0x2a, 0x46, 0x4e, 0x4b, 0x42, 0x42, 0x49, 0x47, 0x3d, 0x3b, 0x38, 0x4b, 0x47, 0x55, 0x35, 0x4f, 0x8b, 0x92, 0x7e, 0x24, 0x37, 0x3d, 0x42, 0x3d, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x42, 0x39, 0x7f, 0xff, 0x91, 0x6f, 0x2a, 0x38, 0x38, 0x3d, 0x49, 0x3d, 0x3d, 0x3d, 0x42, 0x55, 0x54, 0x49, 0x42, 0x3e, 0x24, 0x7b, 0x92, 0x94, 0x7b, 0x24, 0x42, 0x49, 0x35, 0x2c, 0x80, 0xf3, 0xb9, 0x92, 0x7f, 0x2d, 0x31, 0x31, 0x4a, 0x5d, 0x57, 0x64, 0x60, 0x63, 0x39, 0x71, 0x8d, 0x97, 0xba, 0xf8, 0xf8, 0xf1, 0xe6, 0xed, 0xf8, 0xf0, 0xe8, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xbb, 0xba, 0xff, 0x90, 0x6f, 0x40, 0x60, 0x31, 0x3b, 0x37, 0x52, 0x35, 0x4c, 0x39, 0x84, 0x91, 0x94, 0x8b, 0x1d, 0x2d, 0x2f, 0x30, 0x29, 0x86, 0x97, 0x92, 0x5f, 0x2d, 0x42, 0x3d, 0x45, 0x42, 0x42, 0x47, 0x42, 0x47, 0x45, 0x3f, 0x2f, 0x44, 0x47, 0x55, 0x49, 0x2e, 0x71, 0x91, 0x91, 0x78, 0x23, 0x2a, 0x2a, 0x2f, 0x2f, 0x2a, 0x2b, 0x2b, 0x2b, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x35, 0x30, 0x35, 0x23, 0x76, 0x90, 0xff, 0x7a, 0x1e, 0x46, 0x30, 0x3b, 0x42, 0x47, 0x42, 0x3d, 0x3d, 0x42, 0x55, 0x42, 0x49, 0x3d, 0x37, 0x3e, 0x29, 0x7e, 0x92, 0x90, 0x71, 0x2b, 0x42, 0x47, 0x41, 0x32, 0x8d, 0xf9, 0x94, 0x90, 0x78, 0x73, 0x6c, 0x62, 0x6b, 0x64, 0x64, 0x64, 0x48, 0x4f, 0x8b, 0xff, 0xba, 0xb9, 0xf0, 0xf8, 0xf0, 0xe7, 0xee, 0xf0, 0xf0, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xe8, 0xed, 0x93, 0x8f, 0x7b, 0x50, 0x62, 0x58, 0x6a, 0x5c, 0x75, 0x59, 0x7f, 0x91, 0x92, 0x91, 0x33, 0x24, 0x2f, 0x2f, 0x2e, 0x7b, 0x92, 0x92, 0x70, 0x27, 0x37, 0x54, 0x42, 0x3d, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x44, 0x3b, 0x3d, 0x54, 0x42, 0x3f, 0x38, 0x2d, 0x7f, 0x93, 0x90, 0x7a, 0x4d, 0x71, 0x71, 0x74, 0x77, 0x7b, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x7e, 0x7b, 0x78, 0x74, 0x76, 0x71, 0x5f, 0x68, 0x90, 0x91, 0x88, 0x32, 0x2b, 0x49, 0x46, 0x38, 0x42, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x4b, 0x2b, 0x3c, 0x82, 0x92, 0x8e, 0x40, 0x2d, 0x44, 0x37, 0x41, 0x68, 0x90, 0xf8, 0xf8, 0x8b, 0x71, 0x5b, 0x6b, 0x6b, 0x62, 0x62, 0x3c, 0x68, 0x8d, 0x93, 0xb9, 0xe7, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xf7, 0x93, 0x90, 0x7b, 0x32, 0x6b, 0x6e, 0x6a, 0x75, 0x6f, 0x8d, 0x93, 0x92, 0x7a, 0x1f, 0x2f, 0x37, 0x23, 0x6f, 0x90, 0x90, 0x85, 0x21, 0x38, 0x49, 0x54, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x3d, 0x45, 0x54, 0x42, 0x3b, 0x41, 0x2f, 0x48, 0x83, 0xf3, 0xff, 0x92, 0x92, 0x91, 0x93, 0x93, 0x94, 0x94, 0x94, 0x93, 0x94, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x91, 0x91, 0x90, 0x91, 0x93, 0x97, 0x94, 0x90, 0x61, 0x23, 0x37, 0x37, 0x30, 0x38, 0x42, 0x47, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x49, 0x45, 0x23, 0x66, 0x8f, 0x91, 0x86, 0x21, 0x44, 0x42, 0x35, 0x26, 0x7b, 0x93, 0xfe, 0x91, 0x74, 0x50, 0x6b, 0x6b, 0x48, 0x3a, 0x70, 0x8f, 0x93, 0xf7, 0xf2, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xe8, 0xb9, 0xba, 0x97, 0x92, 0x85, 0x50, 0x60, 0x75, 0x59, 0x82, 0x94, 0x97, 0x90, 0x20, 0x2a, 0x42, 0x35, 0x32, 0x8b, 0xff, 0x8b, 0x26, 0x31, 0x42, 0x49, 0x49, 0x42, 0x3d, 0x45, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x45, 0x49, 0x49, 0x54, 0x47, 0x44, 0x2f, 0x46, 0x24, 0x6d, 0x97, 0xf3, 0x92, 0x8b, 0x8c, 0x85, 0x86, 0x83, 0x82, 0x83, 0x7e, 0x7e, 0x7e, 0x7e, 0x7b, 0x7e, 0x7b, 0x7e, 0x7b, 0x7e, 0x7e, 0x82, 0x84, 0x82, 0x85, 0x86, 0x8e, 0x94, 0x99, 0x8e, 0x1f, 0x37, 0x47, 0x37, 0x3b, 0x38, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x49, 0x49, 0x54, 0x23, 0x70, 0x91, 0x92, 0x78, 0x2a, 0x5c, 0x38, 0x41, 0x26, 0x8d, 0xff, 0x93, 0x83, 0x5e, 0x69, 0x48, 0x61, 0x80, 0x93, 0x97, 0xba, 0xbb, 0xed, 0xf9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xf0, 0xe8, 0xe8, 0xb9, 0xb9, 0xff, 0x90, 0x8c, 0x78, 0x5e, 0x74, 0x8e, 0xf9, 0x92, 0x70, 0x24, 0x46, 0x3d, 0x1e, 0x83, 0x92, 0x92, 0x5f, 0x23, 0x3d, 0x3d, 0x3f, 0x37, 0x45, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x49, 0x42, 0x42, 0x47, 0x47, 0x44, 0x23, 0x66, 0x8b, 0x93, 0x88, 0x5f, 0x32, 0x29, 0x28, 0x23, 0x2e, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x24, 0x24, 0x2d, 0x2a, 0x43, 0x24, 0x2c, 0x61, 0x89, 0x93, 0x92, 0x74, 0x31, 0x42, 0x47, 0x30, 0x3b, 0x3d, 0x49, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x3d, 0x3d, 0x47, 0x47, 0x42, 0x29, 0x80, 0x93, 0x8d, 0x40, 0x2a, 0x47, 0x46, 0x2d, 0x70, 0x92, 0x93, 0x8b, 0x6d, 0x5e, 0x7b, 0x8c, 0x92, 0xef, 0xb9, 0xb9, 0xe7, 0xf9, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xe8, 0xe7, 0xe8, 0xee, 0xee, 0xff, 0xff, 0x92, 0x8b, 0x87, 0x94, 0x94, 0x86, 0x28, 0x37, 0x3d, 0x2f, 0x4f, 0x93, 0x91, 0x7e, 0x1e, 0x42, 0x3d, 0x3d, 0x2f, 0x38, 0x45, 0x42, 0x45, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x45, 0x45, 0x3d, 0x3d, 0x47, 0x56, 0x49, 0x28, 0x86, 0x92, 0x8d, 0x5f, 0x21, 0x2d, 0x35, 0x37, 0x42, 0x3d, 0x49, 0x42, 0x49, 0x49, 0x49, 0x49, 0x49, 0x42, 0x49, 0x42, 0x49, 0x47, 0x42, 0x42, 0x42, 0x3d, 0x37, 0x2f, 0x27, 0x66, 0x90, 0x92, 0x8b, 0x3a, 0x30, 0x47, 0x3d, 0x3b, 0x37, 0x49, 0x3d, 0x42, 0x47, 0x42, 0x47, 0x42, 0x47, 0x42, 0x44, 0x2f, 0x2f, 0x30, 0x3d, 0x2f, 0x3a, 0x8f, 0x92, 0x80, 0x29, 0x3f, 0x42, 0x4e, 0x20, 0x88, 0xff, 0x93, 0x80, 0x88, 0x91, 0x93, 0xf0, 0xe7, 0xe7, 0xe7, 0xe7, 0xf0, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xed, 0xef, 0xee, 0xee, 0xed, 0xee, 0xee, 0xe7, 0xee, 0xf0, 0xf1, 0xf1, 0xf0, 0xee, 0xbb, 0xba, 0xef, 0x97, 0xf7, 0x91, 0x61, 0x2b, 0x49, 0x38, 0x20, 0x86, 0x92, 0x89, 0x29, 0x46, 0x54, 0x47, 0x3d, 0x44, 0x3d, 0x45, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x45, 0x47, 0x44, 0x44, 0x44, 0x42, 0x2b, 0x7b, 0x94, 0x91, 0x76, 0x31, 0x3e, 0x42, 0x49, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x45, 0x45, 0x45, 0x45, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x49, 0x49, 0x42, 0x49, 0x49, 0x49, 0x4e, 0x2f, 0x1e, 0x6f, 0x90, 0x94, 0x83, 0x27, 0x37, 0x37, 0x2f, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x3d, 0x44, 0x44, 0x47, 0x47, 0x49, 0x23, 0x74, 0x8f, 0x90, 0x61, 0x24, 0x4b, 0x55, 0x27, 0x5f, 0x92, 0xfe, 0x93, 0xf9, 0x99, 0xbb, 0xef, 0xf1, 0xf1, 0xf1, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xf2, 0xf7, 0xe5, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xbb, 0xe8, 0xee, 0xf0, 0xf0, 0xf1, 0xe7, 0xb9, 0xba, 0xba, 0xbb, 0x93, 0x88, 0x29, 0x42, 0x47, 0x2d, 0x68, 0x91, 0x94, 0x4d, 0x1f, 0x23, 0x2a, 0x35, 0x38, 0x3d, 0x42, 0x42, 0x45, 0x45, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x45, 0x45, 0x47, 0x3b, 0x38, 0x31, 0x50, 0x8d, 0xfe, 0x89, 0x28, 0x49, 0x54, 0x49, 0x54, 0x49, 0x4b, 0x37, 0x4b, 0x37, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x38, 0x3f, 0x3f, 0x3d, 0x49, 0x49, 0x49, 0x42, 0x49, 0x49, 0x49, 0x46, 0x53, 0x24, 0x7b, 0x91, 0x92, 0x6f, 0x23, 0x44, 0x30, 0x37, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x37, 0x49, 0x37, 0x30, 0x2e, 0x1f, 0x82, 0x91, 0x85, 0x2c, 0x3e, 0x55, 0x31, 0x26, 0x8f, 0xff, 0xf0, 0xbb, 0xba, 0xb9, 0xf2, 0xed, 0xf1, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xea, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xea, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xbb, 0xee, 0xbb, 0xe7, 0xe8, 0xe8, 0xee, 0xee, 0xf0, 0xbb, 0xe5, 0x94, 0x77, 0x27, 0x3d, 0x3f, 0x21, 0x86, 0x94, 0xf9, 0x81, 0x82, 0x77, 0x4d, 0x3c, 0x23, 0x30, 0x35, 0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x42, 0x45, 0x42, 0x49, 0x42, 0x3d, 0x38, 0x2c, 0x8b, 0x93, 0x8c, 0x50, 0x23, 0x49, 0x42, 0x42, 0x3d, 0x44, 0x3f, 0x44, 0x42, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x42, 0x3d, 0x42, 0x42, 0x38, 0x38, 0x3b, 0x37, 0x47, 0x49, 0x42, 0x37, 0x46, 0x28, 0x85, 0x91, 0x8d, 0x32, 0x2a, 0x37, 0x42, 0x49, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x47, 0x42, 0x37, 0x2a, 0x2b, 0x2e, 0x40, 0x5f, 0x70, 0x7a, 0x87, 0xf9, 0x91, 0x70, 0x23, 0x4b, 0x4e, 0x24, 0x7b, 0x93, 0xb9, 0xe6, 0xed, 0xf0, 0xef, 0xf2, 0xef, 0xe8, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xef, 0xea, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf8, 0xf7, 0xbb, 0xe7, 0xbb, 0xee, 0xf7, 0xef, 0xe8, 0xf9, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xdc, 0xfc, 0xc2, 0x1b, 0xd7, 0xde, 0xe5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xef, 0xfe, 0xe8, 0xbb, 0xe9, 0xed, 0xed, 0xf2, 0xf0, 0xfe, 0xf7, 0xea, 0x91, 0x3a, 0x2a, 0x47, 0x2f, 0x4f, 0x91, 0x97, 0xf3, 0x93, 0x92, 0x91, 0x8f, 0x89, 0x7f, 0x6f, 0x40, 0x2a, 0x35, 0x38, 0x37, 0x3d, 0x44, 0x4b, 0x42, 0x55, 0x49, 0x42, 0x49, 0x2e, 0x77, 0x94, 0x91, 0x76, 0x2d, 0x3f, 0x3d, 0x37, 0x47, 0x3d, 0x3d, 0x44, 0x42, 0x47, 0x49, 0x42, 0x49, 0x49, 0x49, 0x42, 0x49, 0x42, 0x49, 0x42, 0x37, 0x3f, 0x3b, 0x3b, 0x38, 0x3d, 0x37, 0x47, 0x45, 0x45, 0x31, 0x50, 0x8d, 0x91, 0x7b, 0x24, 0x49, 0x47, 0x3d, 0x38, 0x3d, 0x37, 0x47, 0x3d, 0x3d, 0x23, 0x2a, 0x36, 0x61, 0x78, 0x84, 0x8c, 0x90, 0x92, 0x92, 0x94, 0xba, 0x92, 0x83, 0x27, 0x45, 0x4e, 0x2e, 0x61, 0x92, 0xbb, 0xf1, 0xf8, 0xf0, 0xbb, 0xba, 0xbb, 0xf8, 0xf8, 0xf0, 0xee, 0xef, 0xf9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xe4, 0xed, 0xf9, 0xea, 0x94, 0xf9, 0xef, 0xed, 0xed, 0xee, 0xef, 0xee, 0xee, 0xbb, 0xe8, 0xbb, 0xed, 0xee, 0xf7, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xf0, 0xfe, 0xf8, 0xe7, 0xb9, 0xb9, 0xee, 0xf8, 0xef, 0xf3, 0xf3, 0xe4, 0xd7, 0xc5, 0xfc, 0xf6, 0x14, 0x02, 0x03, 0x95, 0x95, 0x98, 0x9c, 0xfa, 0xfb, 0xb8, 0xec, 0xe5, 0xf3, 0xf3, 0x99, 0xb9, 0xe6, 0xf8, 0xee, 0xb9, 0xba, 0xfe, 0xf1, 0xf2, 0x8f, 0x36, 0x37, 0x54, 0x2e, 0x7b, 0x94, 0x91, 0x80, 0x80, 0x83, 0x89, 0x91, 0x91, 0x93, 0x93, 0x90, 0x82, 0x6f, 0x48, 0x2a, 0x2a, 0x3b, 0x3f, 0x45, 0x42, 0x47, 0x37, 0x35, 0x61, 0x90, 0x93, 0x7e, 0x2d, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x45, 0x45, 0x42, 0x45, 0x42, 0x45, 0x45, 0x45, 0x3d, 0x45, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x24, 0x78, 0x91, 0x90, 0x5e, 0x31, 0x2b, 0x47, 0x38, 0x30, 0x3b, 0x2a, 0x24, 0x2c, 0x71, 0x84, 0x8c, 0x92, 0x93, 0x92, 0x91, 0x8d, 0x86, 0x85, 0x7a, 0x86, 0xff, 0x91, 0x3c, 0x30, 0x44, 0x3e, 0x2c, 0x8b, 0x97, 0xf2, 0xf8, 0xf0, 0xba, 0xb9, 0xb9, 0xf8, 0x93, 0xf3, 0xf3, 0xf3, 0xde, 0xdc, 0x1b, 0xfc, 0x0d, 0xfa, 0x03, 0x01, 0x14, 0xff, 0x72, 0x65, 0xfd, 0xf3, 0xf3, 0xea, 0xf7, 0xed, 0xbb, 0xf9, 0xe5, 0xef, 0xb9, 0xb9, 0xee, 0xf8, 0xf7, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xed, 0xf0, 0xf0, 0xf0, 0xf3, 0xf3, 0xdc, 0xbd, 0x9f, 0x98, 0x98, 0x03, 0x7a, 0x7b, 0x26, 0x29, 0x1d, 0x17, 0x0b, 0x05, 0x01, 0x96, 0x95, 0x95, 0x04, 0xbd, 0x1b, 0xe1, 0xba, 0xf3, 0xfe, 0xf7, 0xba, 0xba, 0xe6, 0xe9, 0xf9, 0x83, 0x24, 0x4e, 0x42, 0x36, 0x86, 0x92, 0x82, 0x1e, 0x24, 0x28, 0x2c, 0x5f, 0x77, 0x88, 0x90, 0x91, 0x94, 0x92, 0x8c, 0x7f, 0x5e, 0x36, 0x24, 0x44, 0x47, 0x47, 0x4a, 0x21, 0x8c, 0x93, 0x8c, 0x3a, 0x35, 0x30, 0x49, 0x37, 0x42, 0x45, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x42, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x37, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x49, 0x35, 0x26, 0x83, 0x91, 0x89, 0x29, 0x2f, 0x30, 0x30, 0x2a, 0x39, 0x6f, 0x82, 0x8d, 0x92, 0x93, 0x93, 0x90, 0x88, 0x80, 0x70, 0x50, 0x28, 0x43, 0x23, 0x48, 0x90, 0x93, 0x76, 0x23, 0x3f, 0x53, 0x27, 0x83, 0x99, 0xb9, 0xe8, 0xe5, 0x97, 0x99, 0xf3, 0xf6, 0x81, 0xb8, 0xfb, 0xfa, 0x01, 0x01, 0x02, 0x03, 0x05, 0x09, 0x10, 0x17, 0x5a, 0x86, 0x06, 0x96, 0xbc, 0xa5, 0xb8, 0xe1, 0xea, 0xf9, 0xf7, 0xf7, 0xf9, 0xef, 0xe8, 0xee, 0xe8, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xe8, 0xf9, 0xfe, 0xf9, 0xf3, 0xec, 0xf5, 0x98, 0x98, 0x98, 0x01, 0x12, 0x33, 0x7f, 0x7c, 0x27, 0x4b, 0x44, 0x4a, 0x51, 0x48, 0x1f, 0x15, 0x12, 0x09, 0x05, 0x96, 0x00, 0x96, 0xfa, 0x1c, 0x86, 0x90, 0x93, 0xba, 0xe6, 0xe7, 0x93, 0x7b, 0x23, 0x4e, 0x4c, 0x40, 0x8f, 0x90, 0x6f, 0x37, 0x46, 0x30, 0x35, 0x23, 0x21, 0x21, 0x4f, 0x71, 0x87, 0x91, 0x92, 0x91, 0x91, 0x86, 0x78, 0x36, 0x23, 0x2f, 0x21, 0x7e, 0x91, 0x91, 0x5f, 0x2f, 0x3d, 0x54, 0x37, 0x42, 0x37, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x42, 0x3d, 0x42, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x47, 0x49, 0x2d, 0x4d, 0x90, 0x91, 0x77, 0x1f, 0x26, 0x4f, 0x7b, 0x8c, 0x91, 0x92, 0x92, 0x90, 0x88, 0x77, 0x66, 0x26, 0x21, 0x27, 0x2f, 0x46, 0x37, 0x49, 0x31, 0x8c, 0x92, 0x7e, 0x27, 0x3b, 0x42, 0x24, 0x7a, 0x94, 0xba, 0x99, 0x93, 0x87, 0x1c, 0xfc, 0x06, 0x03, 0x01, 0x03, 0x05, 0x0b, 0x12, 0x19, 0x21, 0x51, 0x63, 0x53, 0x2e, 0x76, 0x84, 0x10, 0x03, 0x96, 0x95, 0x98, 0x9a, 0xeb, 0xe1, 0xf3, 0x94, 0xf9, 0xf6, 0xee, 0xed, 0xe8, 0xb9, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xe8, 0xbb, 0xe8, 0xf8, 0xf3, 0xde, 0xc2, 0x98, 0x95, 0x00, 0x02, 0x10, 0x32, 0x62, 0x43, 0x76, 0x84, 0x29, 0x3e, 0x3f, 0x3d, 0x4b, 0x52, 0x52, 0x4c, 0x57, 0x64, 0x39, 0x27, 0x15, 0x0e, 0x0e, 0x16, 0x29, 0x59, 0x7b, 0x8f, 0xf8, 0xed, 0x93, 0x78, 0x2b, 0x4b, 0x2d, 0x5f, 0x90, 0x8b, 0x32, 0x2b, 0x3f, 0x45, 0x42, 0x37, 0x3f, 0x30, 0x30, 0x30, 0x21, 0x3c, 0x78, 0x86, 0x91, 0x92, 0x91, 0x8f, 0x7e, 0x4d, 0x6d, 0x91, 0x90, 0x7e, 0x23, 0x3d, 0x49, 0x4e, 0x37, 0x37, 0x42, 0x45, 0x45, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x47, 0x49, 0x37, 0x21, 0x7b, 0x91, 0x8f, 0x7a, 0x8b, 0x92, 0x94, 0x92, 0x90, 0x83, 0x78, 0x3c, 0x23, 0x2b, 0x42, 0x42, 0x45, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x23, 0x80, 0x93, 0x8c, 0x32, 0x38, 0x49, 0x2a, 0x77, 0xf9, 0x97, 0x90, 0x33, 0x16, 0x0e, 0x0b, 0x0b, 0x11, 0x16, 0x21, 0x51, 0x63, 0x5d, 0x4e, 0x4e, 0x55, 0x4e, 0x55, 0x37, 0x73, 0x7d, 0x50, 0x19, 0x09, 0x02, 0x01, 0x00, 0x98, 0x98, 0xc5, 0xe1, 0xf3, 0xf2, 0xf8, 0xf7, 0xee, 0xbb, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xef, 0xed, 0xf2, 0xee, 0xee, 0xef, 0xbb, 0xea, 0xf3, 0xd7, 0xbc, 0x9a, 0x9c, 0x95, 0x07, 0x19, 0x62, 0x58, 0x49, 0x3e, 0x76, 0x89, 0x32, 0x36, 0x3b, 0x3b, 0x44, 0x3b, 0x4b, 0x52, 0x3f, 0x4c, 0x4c, 0x4c, 0x6c, 0x6c, 0x64, 0x6e, 0x52, 0x53, 0x28, 0x74, 0x91, 0xf7, 0x92, 0x74, 0x30, 0x52, 0x2d, 0x5f, 0x91, 0x8b, 0x32, 0x38, 0x37, 0x42, 0x47, 0x42, 0x3d, 0x42, 0x42, 0x49, 0x3d, 0x35, 0x23, 0x36, 0x5e, 0x82, 0x90, 0x93, 0xea, 0x8e, 0x91, 0x92, 0x85, 0x2c, 0x42, 0x54, 0x56, 0x37, 0x44, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x47, 0x42, 0x2a, 0x32, 0x88, 0x92, 0xf9, 0x93, 0xfe, 0x90, 0x80, 0x4d, 0x32, 0x24, 0x30, 0x47, 0x55, 0x49, 0x49, 0x42, 0x42, 0x47, 0x49, 0x47, 0x3f, 0x23, 0x77, 0x93, 0x8b, 0x3a, 0x3b, 0x49, 0x23, 0x77, 0x94, 0x92, 0x7b, 0x1e, 0x3e, 0x4a, 0x24, 0x21, 0x2a, 0x4c, 0x3e, 0x35, 0x3f, 0x4e, 0x49, 0x56, 0x47, 0x55, 0x44, 0x41, 0x76, 0x7d, 0x62, 0x62, 0x48, 0x15, 0x02, 0x96, 0x00, 0x9c, 0x98, 0x9f, 0xd7, 0x99, 0xea, 0xf8, 0xf7, 0xbb, 0xbb, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf2, 0xef, 0xed, 0xf2, 0xed, 0xf9, 0xef, 0xbd, 0x98, 0x9c, 0x95, 0x01, 0x10, 0x69, 0x64, 0x44, 0x5c, 0x5c, 0x2e, 0x74, 0x92, 0x7e, 0x33, 0x21, 0x41, 0x53, 0x58, 0x52, 0x44, 0x58, 0x52, 0x4c, 0x41, 0x41, 0x52, 0x52, 0x4b, 0x56, 0x67, 0x53, 0x50, 0x8c, 0xfe, 0x93, 0x74, 0x35, 0x52, 0x36, 0x68, 0x90, 0x8b, 0x32, 0x38, 0x3d, 0x42, 0x37, 0x3d, 0x38, 0x3b, 0x3e, 0x38, 0x46, 0x42, 0x47, 0x37, 0x3d, 0x1e, 0x2c, 0x7e, 0x8f, 0xf8, 0x97, 0x87, 0x33, 0x3e, 0x54, 0x54, 0x42, 0x3b, 0x3f, 0x42, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x45, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x37, 0x3d, 0x37, 0x3d, 0x38, 0x38, 0x47, 0x42, 0x49, 0x21, 0x68, 0x92, 0x97, 0x8d, 0x76, 0x36, 0x24, 0x2f, 0x3d, 0x47, 0x47, 0x49, 0x49, 0x3d, 0x38, 0x38, 0x3d, 0x42, 0x47, 0x37, 0x3f, 0x23, 0x70, 0x93, 0x8f, 0x61, 0x30, 0x49, 0x24, 0x7a, 0x94, 0x90, 0x5f, 0x2a, 0x45, 0x44, 0x2d, 0x2f, 0x3f, 0x47, 0x4b, 0x4c, 0x4b, 0x4b, 0x56, 0x56, 0x46, 0x3e, 0x4a, 0x27, 0x84, 0x7c, 0x43, 0x6a, 0x67, 0x75, 0x2c, 0x10, 0x01, 0x96, 0x9c, 0x9a, 0x98, 0xa8, 0xfd, 0xf3, 0xff, 0xe5, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xf2, 0xe5, 0xea, 0xef, 0xf5, 0x95, 0x00, 0x96, 0x02, 0x1d, 0x5b, 0x5d, 0x3f, 0x5c, 0x4c, 0x31, 0x66, 0x8f, 0xff, 0x90, 0x85, 0x6f, 0x39, 0x2e, 0x4a, 0x5d, 0x53, 0x53, 0x58, 0x58, 0x58, 0x4c, 0x58, 0x5d, 0x58, 0x6a, 0x5c, 0x6a, 0x59, 0x82, 0xff, 0x94, 0x7b, 0x31, 0x53, 0x41, 0x68, 0x90, 0x8b, 0x3a, 0x2f, 0x3e, 0x37, 0x3d, 0x3d, 0x38, 0x3f, 0x38, 0x46, 0x49, 0x46, 0x38, 0x3d, 0x44, 0x30, 0x2f, 0x23, 0x73, 0x91, 0x94, 0x87, 0x20, 0x3e, 0x54, 0x54, 0x3d, 0x44, 0x3d, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x37, 0x42, 0x37, 0x3d, 0x38, 0x3d, 0x3d, 0x37, 0x21, 0x7b, 0x92, 0x91, 0x61, 0x2f, 0x2f, 0x47, 0x47, 0x56, 0x47, 0x54, 0x49, 0x49, 0x37, 0x3d, 0x38, 0x3f, 0x3d, 0x42, 0x37, 0x3b, 0x23, 0x68, 0x93, 0x8f, 0x5e, 0x2b, 0x4b, 0x29, 0x7a, 0x94, 0x8c, 0x3a, 0x41, 0x3f, 0x2f, 0x2f, 0x4c, 0x52, 0x4b, 0x5c, 0x52, 0x5c, 0x5c, 0x4e, 0x46, 0x4a, 0x28, 0x59, 0x84, 0x8f, 0x7f, 0x39, 0x6a, 0x67, 0x67, 0x62, 0x73, 0x12, 0x05, 0x00, 0x96, 0x9c, 0x98, 0x04, 0x81, 0xea, 0xf7, 0xbb, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xea, 0xf7, 0xa5, 0x98, 0xf4, 0x96, 0x07, 0x20, 0x6e, 0x5c, 0x5c, 0x55, 0x5c, 0x39, 0x36, 0x89, 0x97, 0xe3, 0xf9, 0xfe, 0x8f, 0x89, 0x70, 0x32, 0x29, 0x43, 0x53, 0x53, 0x5c, 0x5d, 0x6a, 0x6a, 0x6a, 0x6e, 0x6e, 0x6a, 0x67, 0x60, 0x7e, 0xfe, 0x94, 0x82, 0x2e, 0x53, 0x41, 0x5e, 0x90, 0x90, 0x5f, 0x2f, 0x38, 0x3d, 0x3d, 0x47, 0x3d, 0x3d, 0x42, 0x42, 0x3d, 0x38, 0x3b, 0x3f, 0x42, 0x42, 0x55, 0x2f, 0x2d, 0x85, 0x90, 0x91, 0x71, 0x31, 0x49, 0x47, 0x3f, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x45, 0x45, 0x45, 0x45, 0x3d, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x37, 0x3d, 0x37, 0x3d, 0x42, 0x2a, 0x61, 0x90, 0x90, 0x78, 0x23, 0x44, 0x4b, 0x42, 0x42, 0x49, 0x49, 0x42, 0x3d, 0x3d, 0x42, 0x3d, 0x3d, 0x47, 0x42, 0x47, 0x42, 0x3f, 0x23, 0x70, 0x92, 0x8d, 0x50, 0x35, 0x3b, 0x20, 0x87, 0xfe, 0x86, 0x40, 0x2e, 0x52, 0x64, 0x64, 0x6a, 0x67, 0x5c, 0x5c, 0x5c, 0x5c, 0x4e, 0x53, 0x2e, 0x50, 0x7e, 0x90, 0x92, 0xf9, 0x8d, 0x61, 0x4a, 0x67, 0x67, 0x6a, 0x58, 0x75, 0x40, 0x09, 0x96, 0x00, 0x9c, 0x98, 0x01, 0xdc, 0xf3, 0xe5, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xee, 0xf2, 0xea, 0xf5, 0x9c, 0xf4, 0x96, 0x08, 0x40, 0x6e, 0x54, 0x67, 0x56, 0x54, 0x5c, 0x36, 0x7f, 0x91, 0xb9, 0xb9, 0xb9, 0xf0, 0x97, 0xff, 0x91, 0x8f, 0x7e, 0x68, 0x50, 0x39, 0x39, 0x60, 0x53, 0x5d, 0x5d, 0x63, 0x6e, 0x6a, 0x6a, 0x63, 0x76, 0x90, 0xf0, 0x8b, 0x36, 0x3e, 0x5d, 0x4f, 0x8f, 0x92, 0x70, 0x2b, 0x3d, 0x49, 0x47, 0x37, 0x3d, 0x42, 0x3d, 0x3d, 0x3d, 0x44, 0x37, 0x45, 0x49, 0x49, 0x37, 0x3b, 0x24, 0x4f, 0x8c, 0x91, 0x83, 0x28, 0x4b, 0x47, 0x47, 0x42, 0x46, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x45, 0x42, 0x49, 0x42, 0x42, 0x45, 0x42, 0x45, 0x3d, 0x42, 0x42, 0x37, 0x3d, 0x42, 0x3d, 0x3d, 0x42, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x42, 0x30, 0x27, 0x85, 0x92, 0x85, 0x48, 0x46, 0x3d, 0x37, 0x4e, 0x46, 0x46, 0x37, 0x44, 0x44, 0x44, 0x3d, 0x42, 0x3d, 0x42, 0x49, 0x42, 0x49, 0x3d, 0x2a, 0x70, 0x93, 0x8c, 0x2c, 0x53, 0x2f, 0x3a, 0x8e, 0x92, 0x7b, 0x48, 0x6b, 0x75, 0x58, 0x58, 0x53, 0x6a, 0x5c, 0x5d, 0x53, 0x43, 0x51, 0x66, 0x7f, 0x8f, 0x94, 0xba, 0xb9, 0xed, 0x92, 0x89, 0x5b, 0x4a, 0x67, 0x67, 0x67, 0x5d, 0x63, 0x66, 0x12, 0x01, 0x00, 0xf4, 0x95, 0xf4, 0xe1, 0xf3, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xe8, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xbb, 0xee, 0xef, 0xef, 0xe5, 0xee, 0xf3, 0x1b, 0x9a, 0x96, 0x96, 0x09, 0x40, 0x6e, 0x5c, 0x56, 0x56, 0x5c, 0x5c, 0x28, 0x78, 0x91, 0xef, 0xe8, 0xe7, 0xf0, 0xe8, 0xee, 0xf0, 0xf0, 0xf9, 0x93, 0x92, 0x90, 0x86, 0x80, 0x74, 0x66, 0x59, 0x48, 0x39, 0x43, 0x51, 0x60, 0x5b, 0x73, 0x89, 0xff, 0x92, 0x70, 0x31, 0x53, 0x3a, 0x88, 0x94, 0x7e, 0x23, 0x3d, 0x56, 0x30, 0x3e, 0x35, 0x49, 0x42, 0x44, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x44, 0x23, 0x74, 0x90, 0x91, 0x78, 0x2a, 0x44, 0x47, 0x4e, 0x3d, 0x47, 0x44, 0x3d, 0x3d, 0x45, 0x49, 0x49, 0x54, 0x49, 0x3d, 0x46, 0x3d, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x46, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x44, 0x3b, 0x38, 0x3d, 0x3d, 0x2d, 0x70, 0x91, 0x90, 0x6f, 0x2b, 0x42, 0x42, 0x45, 0x42, 0x42, 0x42, 0x45, 0x42, 0x3d, 0x3d, 0x42, 0x47, 0x42, 0x49, 0x49, 0x49, 0x37, 0x3b, 0x24, 0x7a, 0x93, 0x85, 0x2c, 0x2f, 0x24, 0x74, 0x91, 0xf8, 0x74, 0x6f, 0x69, 0x39, 0x51, 0x41, 0x43, 0x2e, 0x39, 0x59, 0x6f, 0x7c, 0x85, 0x91, 0x93, 0xf0, 0xed, 0xbb, 0xed, 0xee, 0xf2, 0x93, 0x83, 0x59, 0x5c, 0x67, 0x67, 0x57, 0x6a, 0x5d, 0x6b, 0x1d, 0x03, 0x00, 0x9c, 0x98, 0x06, 0xf7, 0xef, 0xff, 0xe5, 0xbb, 0xbb, 0xba, 0xe7, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xe8, 0xf3, 0xec, 0xbc, 0x00, 0x00, 0x08, 0x40, 0x6e, 0x42, 0x5c, 0x52, 0x52, 0x5c, 0x2e, 0x78, 0x8d, 0x97, 0xe5, 0xe7, 0xf1, 0xf1, 0xee, 0xbb, 0xb9, 0xb9, 0xbb, 0xb9, 0xe8, 0xff, 0xff, 0x91, 0x91, 0x92, 0x90, 0x8b, 0x86, 0x82, 0x7e, 0x78, 0x78, 0x78, 0x8e, 0xe7, 0x99, 0x86, 0x36, 0x5d, 0x5b, 0x7b, 0x92, 0x8c, 0x2c, 0x38, 0x42, 0x47, 0x3e, 0x46, 0x49, 0x42, 0x3d, 0x3d, 0x42, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x3d, 0x3b, 0x29, 0x84, 0x90, 0x8f, 0x4f, 0x2d, 0x3d, 0x49, 0x49, 0x54, 0x49, 0x49, 0x4b, 0x46, 0x3f, 0x46, 0x3d, 0x45, 0x3d, 0x47, 0x3d, 0x3d, 0x3d, 0x45, 0x3d, 0x3d, 0x3d, 0x38, 0x35, 0x3f, 0x46, 0x3d, 0x37, 0x3d, 0x37, 0x37, 0x3d, 0x3d, 0x3e, 0x32, 0x8b, 0x91, 0x7e, 0x2e, 0x30, 0x55, 0x3d, 0x42, 0x3d, 0x45, 0x3d, 0x42, 0x45, 0x42, 0x42, 0x45, 0x42, 0x45, 0x3f, 0x3f, 0x55, 0x42, 0x46, 0x24, 0x88, 0x90, 0x76, 0x43, 0x2f, 0x29, 0x86, 0x94, 0xe5, 0x79, 0x7a, 0x6d, 0x77, 0x77, 0x77, 0x7b, 0x83, 0x89, 0x90, 0x91, 0xff, 0xf9, 0x99, 0xe7, 0xbb, 0xe8, 0xed, 0xf0, 0xf1, 0xe5, 0x97, 0x92, 0x85, 0x59, 0x4a, 0x6a, 0x5c, 0x4c, 0x52, 0x5d, 0x6b, 0x26, 0x09, 0x95, 0xf4, 0x9a, 0xc5, 0xf3, 0xef, 0xf9, 0xee, 0xbb, 0xe7, 0xe8, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xe8, 0xbb, 0xf3, 0xbd, 0x95, 0xf4, 0x03, 0x33, 0x62, 0x42, 0x67, 0x56, 0x58, 0x4a, 0x2e, 0x76, 0x8f, 0x93, 0xe5, 0xba, 0xe7, 0xf0, 0xf8, 0xee, 0xe8, 0xe7, 0xb9, 0xb9, 0xba, 0xb9, 0xbb, 0xef, 0xff, 0xf7, 0xb9, 0xba, 0xf2, 0x94, 0xf8, 0x92, 0xfe, 0x92, 0xfe, 0xf1, 0xb9, 0x99, 0x90, 0x6f, 0x43, 0x51, 0x6f, 0x91, 0x91, 0x5f, 0x2d, 0x49, 0x42, 0x37, 0x38, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x42, 0x35, 0x3e, 0x48, 0x8c, 0x94, 0x83, 0x33, 0x3e, 0x42, 0x49, 0x49, 0x49, 0x37, 0x46, 0x3b, 0x38, 0x3b, 0x3b, 0x38, 0x3d, 0x3d, 0x3d, 0x45, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x42, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x30, 0x24, 0x7e, 0x94, 0x8f, 0x50, 0x46, 0x42, 0x4b, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x45, 0x42, 0x42, 0x44, 0x2f, 0x3b, 0x42, 0x54, 0x2b, 0x5b, 0x90, 0x8f, 0x69, 0x46, 0x2f, 0x4f, 0x93, 0xba, 0xba, 0xf8, 0xf8, 0x94, 0xfe, 0x92, 0x93, 0x94, 0xf9, 0x99, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xb9, 0xb9, 0xed, 0xf7, 0xf0, 0xf0, 0xbb, 0xe5, 0x97, 0x92, 0x89, 0x59, 0x43, 0x5c, 0x6a, 0x52, 0x5c, 0x5c, 0x60, 0x50, 0x03, 0x95, 0x9b, 0x9b, 0xde, 0x99, 0xf2, 0xe5, 0xee, 0xbb, 0xf0, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xe8, 0xf3, 0xdc, 0x98, 0x96, 0x03, 0x20, 0x64, 0x4c, 0x56, 0x56, 0x56, 0x60, 0x26, 0x7f, 0x8e, 0x97, 0xe5, 0xba, 0xb9, 0xe8, 0xf1, 0xee, 0xee, 0xe8, 0xf0, 0xf0, 0xee, 0xe7, 0xe8, 0xf2, 0xed, 0xf0, 0xf9, 0xf0, 0xf0, 0xf0, 0xf8, 0xf8, 0x94, 0xed, 0xf9, 0xbb, 0xe8, 0xe7, 0xed, 0x93, 0x83, 0x3c, 0x51, 0x40, 0x8b, 0x94, 0x83, 0x21, 0x46, 0x49, 0x47, 0x38, 0x38, 0x42, 0x49, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x37, 0x3d, 0x3d, 0x37, 0x49, 0x49, 0x2b, 0x71, 0x90, 0x94, 0x80, 0x26, 0x38, 0x3d, 0x47, 0x3d, 0x44, 0x3d, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3d, 0x46, 0x3d, 0x46, 0x37, 0x45, 0x42, 0x37, 0x45, 0x47, 0x47, 0x47, 0x47, 0x42, 0x3d, 0x37, 0x2f, 0x38, 0x2f, 0x24, 0x74, 0x91, 0x92, 0x70, 0x2a, 0x54, 0x42, 0x37, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x45, 0x3d, 0x46, 0x42, 0x44, 0x3b, 0x3b, 0x47, 0x54, 0x24, 0x82, 0x93, 0x86, 0x43, 0x4e, 0x2d, 0x82, 0xea, 0xbb, 0xf7, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0x97, 0xff, 0xbb, 0xbb, 0xb9, 0xbb, 0xbb, 0xed, 0xe8, 0xee, 0xee, 0xed, 0xe7, 0xed, 0xef, 0xef, 0xe8, 0xb9, 0xbb, 0x97, 0x8d, 0x76, 0x2e, 0x4a, 0x5c, 0x56, 0x56, 0x4b, 0x51, 0x3a, 0x06, 0x95, 0x95, 0xa5, 0xe8, 0xf2, 0xf0, 0xf0, 0xf8, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xe9, 0xbb, 0xbd, 0x95, 0x96, 0x17, 0x6e, 0x55, 0x45, 0x52, 0x5c, 0x35, 0x48, 0x7f, 0x91, 0xf7, 0x99, 0xe5, 0xe7, 0xe8, 0xed, 0xf0, 0xf0, 0xb9, 0xee, 0xf8, 0xf8, 0xf1, 0xf9, 0xf0, 0xee, 0xf0, 0xf1, 0xee, 0xf0, 0xef, 0xf8, 0xef, 0xf8, 0xf7, 0xff, 0xef, 0xef, 0xe8, 0xed, 0xf0, 0xf9, 0x8f, 0x68, 0x43, 0x3c, 0x77, 0xfe, 0x90, 0x4d, 0x2a, 0x55, 0x3d, 0x44, 0x3f, 0x42, 0x49, 0x3d, 0x45, 0x37, 0x3d, 0x3d, 0x45, 0x3d, 0x42, 0x3d, 0x49, 0x42, 0x47, 0x39, 0x7b, 0x93, 0x92, 0x70, 0x1e, 0x3b, 0x3d, 0x44, 0x3d, 0x3d, 0x3d, 0x3d, 0x37, 0x42, 0x30, 0x30, 0x2f, 0x30, 0x2f, 0x38, 0x2f, 0x2f, 0x35, 0x2f, 0x2f, 0x2f, 0x30, 0x38, 0x38, 0x38, 0x3b, 0x3b, 0x2f, 0x24, 0x32, 0x8d, 0x91, 0x82, 0x28, 0x3d, 0x42, 0x4b, 0x3f, 0x45, 0x42, 0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x46, 0x3f, 0x42, 0x47, 0x44, 0x47, 0x49, 0x35, 0x33, 0x91, 0x93, 0x6d, 0x41, 0x58, 0x3c, 0x90, 0xe7, 0xe6, 0xf7, 0xf7, 0xef, 0xf7, 0x97, 0xf7, 0xff, 0xf7, 0x97, 0xf7, 0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xed, 0xed, 0xe7, 0xbb, 0xbb, 0xf0, 0xf1, 0xe8, 0xe6, 0xb9, 0xff, 0x90, 0x7c, 0x51, 0x41, 0x52, 0x56, 0x52, 0x52, 0x3c, 0x26, 0x03, 0x00, 0x9a, 0xd7, 0xf3, 0xee, 0xf0, 0xf8, 0xf0, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xef, 0xe8, 0xf2, 0xed, 0xf1, 0xea, 0xec, 0x9c, 0x96, 0x0c, 0x66, 0x54, 0x54, 0x67, 0x3e, 0x39, 0x50, 0x89, 0x91, 0xe8, 0xf2, 0xed, 0xf1, 0xf0, 0xf0, 0xf1, 0xf0, 0xe8, 0xe7, 0xb9, 0xf1, 0xf2, 0xf0, 0xe5, 0xe7, 0xe8, 0xe7, 0xe8, 0xe8, 0xe7, 0xe7, 0xe7, 0xf2, 0xed, 0xe8, 0xed, 0xed, 0xed, 0xbb, 0xb9, 0xed, 0xba, 0x94, 0x82, 0x28, 0x60, 0x50, 0x89, 0x91, 0x82, 0x26, 0x2b, 0x45, 0x3d, 0x3b, 0x42, 0x49, 0x37, 0x3d, 0x3d, 0x37, 0x45, 0x3d, 0x45, 0x3d, 0x45, 0x4e, 0x45, 0x37, 0x38, 0x2e, 0x84, 0x91, 0x91, 0x70, 0x21, 0x24, 0x27, 0x27, 0x29, 0x48, 0x40, 0x40, 0x50, 0x5e, 0x4f, 0x5e, 0x4f, 0x66, 0x4f, 0x66, 0x4f, 0x4f, 0x50, 0x32, 0x32, 0x29, 0x27, 0x24, 0x2a, 0x2a, 0x2b, 0x38, 0x2c, 0x86, 0x93, 0x88, 0x39, 0x49, 0x49, 0x44, 0x3b, 0x3f, 0x42, 0x45, 0x3d, 0x42, 0x45, 0x45, 0x45, 0x45, 0x3d, 0x3e, 0x45, 0x49, 0x47, 0x49, 0x30, 0x2c, 0x83, 0xf3, 0x86, 0x3c, 0x57, 0x24, 0x85, 0x92, 0xe6, 0xb9, 0xe5, 0xed, 0xb9, 0xe5, 0xbb, 0xbb, 0xe5, 0xee, 0xee, 0xee, 0xf2, 0xf0, 0xf8, 0xf8, 0xf8, 0xf7, 0xf0, 0xe5, 0xe7, 0xb9, 0xbb, 0xf0, 0xf8, 0xf8, 0xe7, 0xe6, 0xba, 0xf9, 0x91, 0x85, 0x5e, 0x36, 0x41, 0x56, 0x55, 0x5c, 0x62, 0x19, 0x02, 0x98, 0xfa, 0xf3, 0xe8, 0xf1, 0xf8, 0xf8, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xe7, 0xed, 0xf8, 0xea, 0xeb, 0x95, 0x03, 0x33, 0x53, 0x4e, 0x55, 0x4a, 0x28, 0x71, 0x88, 0x92, 0xef, 0xe8, 0xed, 0xf1, 0xf0, 0xf8, 0xf8, 0xf0, 0xee, 0xe7, 0xe7, 0xe7, 0xe7, 0xb9, 0xe7, 0xb9, 0xbb, 0xbb, 0xba, 0xbb, 0xe5, 0xe9, 0xf1, 0xe9, 0xe8, 0xe9, 0xe8, 0xe8, 0xe7, 0xbb, 0x99, 0xf9, 0xef, 0xe5, 0x97, 0x90, 0x5e, 0x43, 0x5d, 0x6f, 0x91, 0x8f, 0x61, 0x36, 0x38, 0x3d, 0x3f, 0x42, 0x42, 0x42, 0x3d, 0x37, 0x3d, 0x3d, 0x45, 0x3d, 0x45, 0x3d, 0x42, 0x44, 0x44, 0x47, 0x35, 0x59, 0x85, 0x91, 0x8d, 0x7a, 0x7b, 0x82, 0x85, 0x89, 0x8c, 0x8b, 0x8f, 0x91, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8d, 0x8c, 0x84, 0x84, 0x78, 0x76, 0x59, 0x26, 0x7e, 0x91, 0x8e, 0x68, 0x35, 0x54, 0x49, 0x3b, 0x3e, 0x3d, 0x45, 0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4e, 0x3f, 0x3f, 0x45, 0x49, 0x37, 0x62, 0x68, 0x8e, 0x91, 0x6f, 0x41, 0x2d, 0x66, 0x90, 0xff, 0x94, 0x93, 0xf8, 0xf7, 0xe8, 0xe7, 0xbb, 0xe7, 0xe7, 0xe7, 0xe7, 0xe8, 0xe7, 0xb9, 0xba, 0xbb, 0xbb, 0xbb, 0xee, 0xee, 0xf0, 0xe8, 0xbb, 0xf0, 0xf8, 0xf8, 0xed, 0xe7, 0xb9, 0xb9, 0x97, 0x94, 0x8f, 0x77, 0x2c, 0x3e, 0x4e, 0x4e, 0x3e, 0x5b, 0x0b, 0x95, 0x00, 0xdc, 0xea, 0xee, 0xf8, 0xf0, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xb9, 0xf2, 0xf0, 0xf0, 0x04, 0x98, 0x13, 0x57, 0x54, 0x5c, 0x31, 0x40, 0x7b, 0x91, 0x94, 0xf1, 0xe5, 0xf0, 0xe7, 0xe8, 0xf1, 0xf0, 0xef, 0xee, 0xbb, 0xe8, 0xee, 0xe8, 0xe7, 0xe8, 0xe8, 0xf9, 0xea, 0x94, 0xf3, 0x94, 0xf3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x8e, 0x8e, 0x8e, 0x87, 0x88, 0x87, 0x94, 0xef, 0x93, 0x82, 0x29, 0x63, 0x39, 0x86, 0x91, 0x8b, 0x26, 0x31, 0x3d, 0x3d, 0x3d, 0x42, 0x3d, 0x3d, 0x3d, 0x3d, 0x45, 0x3d, 0x3d, 0x3d, 0x45, 0x37, 0x4b, 0x47, 0x47, 0x47, 0x31, 0x50, 0x83, 0x92, 0x93, 0x92, 0x92, 0x92, 0x91, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8f, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92, 0x91, 0x92, 0x90, 0xfe, 0x92, 0x6d, 0x26, 0x44, 0x54, 0x42, 0x38, 0x45, 0x42, 0x45, 0x3d, 0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x42, 0x45, 0x2f, 0x3e, 0x4e, 0x6e, 0x3a, 0x8b, 0x92, 0x85, 0x43, 0x4c, 0x3c, 0x83, 0x93, 0x91, 0x80, 0x7b, 0x82, 0x86, 0x8b, 0x8b, 0x91, 0xfe, 0x94, 0x94, 0x94, 0x94, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x99, 0xf3, 0xf2, 0xf9, 0xf0, 0xed, 0xee, 0xf0, 0xee, 0xee, 0xe8, 0xe8, 0xf2, 0xed, 0xed, 0x97, 0x92, 0x86, 0x3a, 0x2e, 0x35, 0x52, 0x3b, 0x32, 0x03, 0x95, 0xc5, 0xf3, 0xbb, 0xf1, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xf0, 0xe8, 0xbb, 0xf2, 0xf9, 0xdc, 0x95, 0x01, 0x33, 0x51, 0x54, 0x35, 0x66, 0x86, 0x93, 0xe7, 0xed, 0xf8, 0xf1, 0xed, 0xe7, 0xe7, 0xe8, 0xee, 0xef, 0xbb, 0xb9, 0xee, 0xf1, 0xf9, 0x94, 0x94, 0xfe, 0x8a, 0x83, 0x79, 0x72, 0x5a, 0x25, 0x25, 0x1c, 0x18, 0x17, 0x17, 0x15, 0x15, 0x16, 0x16, 0x16, 0x16, 0x17, 0x7a, 0x93, 0xff, 0x8e, 0x70, 0x39, 0x51, 0x4d, 0x8b, 0x92, 0x7b, 0x2e, 0x38, 0x3d, 0x37, 0x42, 0x42, 0x3d, 0x37, 0x42, 0x3d, 0x45, 0x42, 0x45, 0x3d, 0x45, 0x45, 0x47, 0x44, 0x3b, 0x41, 0x28, 0x82, 0xf7, 0xff, 0x8f, 0x86, 0x7b, 0x74, 0x5e, 0x66, 0x5b, 0x48, 0x36, 0x3c, 0x3c, 0x36, 0x3c, 0x2c, 0x3c, 0x2c, 0x36, 0x2c, 0x48, 0x3c, 0x50, 0x6f, 0x74, 0x7e, 0x83, 0x90, 0x91, 0xf8, 0x91, 0x6d, 0x2c, 0x2f, 0x3b, 0x46, 0x4e, 0x49, 0x49, 0x45, 0x45, 0x3d, 0x45, 0x45, 0x45, 0x45, 0x45, 0x42, 0x3d, 0x41, 0x57, 0x6e, 0x59, 0x77, 0x93, 0x8f, 0x59, 0x4a, 0x27, 0x77, 0x92, 0xf8, 0x80, 0x29, 0x2d, 0x21, 0x1f, 0x19, 0x19, 0x19, 0x17, 0x18, 0x18, 0x1c, 0x25, 0x25, 0x5a, 0x34, 0x65, 0x65, 0xec, 0x79, 0xfd, 0x8e, 0xf8, 0xea, 0xe8, 0xbb, 0xbb, 0xbb, 0xef, 0xf8, 0xf0, 0xf1, 0xf2, 0xe7, 0xba, 0x93, 0x8f, 0x78, 0x29, 0x2d, 0x3f, 0x5b, 0x12, 0x96, 0xbc, 0x99, 0xbb, 0xf0, 0xf0, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xee, 0xf0, 0xf8, 0xee, 0xf3, 0xc5, 0x95, 0x0c, 0x66, 0x41, 0x31, 0x78, 0x90, 0x92, 0xf9, 0xe8, 0xee, 0xee, 0xf0, 0xef, 0xee, 0xee, 0xf0, 0xf8, 0xee, 0x99, 0xf3, 0xf3, 0x94, 0x72, 0x1c, 0x13, 0x0f, 0x0c, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0e, 0x11, 0x11, 0x16, 0x1a, 0x1a, 0x1e, 0x23, 0x35, 0x53, 0x4a, 0x43, 0x3a, 0x86, 0x94, 0x99, 0x87, 0x29, 0x63, 0x39, 0x74, 0x90, 0x90, 0x70, 0x27, 0x53, 0x37, 0x42, 0x3d, 0x42, 0x49, 0x49, 0x42, 0x46, 0x3d, 0x45, 0x42, 0x49, 0x42, 0x3b, 0x3b, 0x23, 0x50, 0x82, 0x92, 0xff, 0x89, 0x73, 0x29, 0x2e, 0x2a, 0x2b, 0x35, 0x30, 0x38, 0x38, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x2f, 0x2f, 0x35, 0x2a, 0x2a, 0x2e, 0x29, 0x5b, 0x7c, 0x8f, 0xfe, 0x91, 0x83, 0x5f, 0x1e, 0x3b, 0x42, 0x47, 0x56, 0x49, 0x4b, 0x3b, 0x38, 0x47, 0x47, 0x55, 0x45, 0x3e, 0x39, 0x62, 0x6b, 0x6b, 0x61, 0x8b, 0x92, 0x7b, 0x23, 0x53, 0x26, 0x8a, 0x94, 0x8d, 0x66, 0x2f, 0x5c, 0x4e, 0x53, 0x3f, 0x31, 0x23, 0x1e, 0x1e, 0x1a, 0x16, 0x16, 0x11, 0x11, 0x11, 0x0e, 0x10, 0x0e, 0x0c, 0x0b, 0x0c, 0x0f, 0xdc, 0xf3, 0xf3, 0xf3, 0xe5, 0xed, 0xf8, 0xf7, 0xe7, 0xb9, 0xe8, 0xed, 0xef, 0xf9, 0x92, 0x83, 0x61, 0x21, 0x2e, 0x40, 0x05, 0x98, 0xde, 0xf3, 0xee, 0xf0, 0xed, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf1, 0xe7, 0xea, 0xfa, 0x02, 0x18, 0x33, 0x61, 0x89, 0x91, 0xff, 0xf7, 0xf9, 0xee, 0xe8, 0xe8, 0xee, 0xef, 0xed, 0xf9, 0xf8, 0xf3, 0xbb, 0xe0, 0xeb, 0x34, 0xf9, 0x18, 0x0b, 0x11, 0x11, 0x1a, 0x1e, 0x23, 0x23, 0x2f, 0x4c, 0x52, 0x53, 0x5d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x52, 0x58, 0x51, 0x5e, 0x8d, 0x97, 0x93, 0x77, 0x39, 0x60, 0x39, 0x78, 0x90, 0x90, 0x4d, 0x39, 0x5c, 0x3d, 0x42, 0x3f, 0x3f, 0x3f, 0x46, 0x42, 0x49, 0x45, 0x4b, 0x45, 0x37, 0x3b, 0x27, 0x71, 0x8f, 0x91, 0x8f, 0x7e, 0x2c, 0x2a, 0x3e, 0x46, 0x46, 0x42, 0x49, 0x42, 0x47, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x42, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x49, 0x37, 0x46, 0x3e, 0x2a, 0x23, 0x3a, 0x7f, 0x8f, 0x90, 0x8f, 0x82, 0x33, 0x2d, 0x3e, 0x42, 0x42, 0x3d, 0x44, 0x44, 0x44, 0x3d, 0x38, 0x4a, 0x57, 0x6c, 0x6b, 0x6b, 0x59, 0x82, 0x92, 0x83, 0x2c, 0x6a, 0x28, 0x7e, 0x93, 0x92, 0x71, 0x41, 0x67, 0x5c, 0x5c, 0x5c, 0x4e, 0x56, 0x55, 0x67, 0x4b, 0x5c, 0x6a, 0x67, 0x5c, 0x6a, 0x58, 0x58, 0x4c, 0x41, 0x58, 0x39, 0x28, 0x15, 0x79, 0x81, 0xeb, 0xdc, 0xb9, 0xf3, 0xf8, 0xf8, 0xe7, 0xba, 0xe8, 0xef, 0xee, 0xee, 0x97, 0x93, 0x8f, 0x7f, 0x50, 0x26, 0x13, 0x98, 0xb8, 0xf3, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xee, 0xee, 0xe8, 0xe5, 0xe8, 0xe5, 0x04, 0x06, 0x4d, 0x80, 0x8d, 0x93, 0xfe, 0xff, 0xf8, 0xf2, 0xe5, 0xe8, 0xe8, 0xee, 0xf0, 0xe5, 0xf2, 0x94, 0xe1, 0xa8, 0x9b, 0x95, 0x07, 0x92, 0x80, 0x1f, 0x41, 0x53, 0x42, 0x46, 0x42, 0x46, 0x46, 0x46, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x55, 0x5c, 0x5c, 0x4e, 0x5c, 0x52, 0x5d, 0x51, 0x71, 0x91, 0x92, 0x90, 0x5f, 0x51, 0x53, 0x43, 0x83, 0xf3, 0x87, 0x33, 0x4a, 0x52, 0x5c, 0x3f, 0x3e, 0x3b, 0x38, 0x45, 0x49, 0x4b, 0x3f, 0x3b, 0x3b, 0x2e, 0x78, 0x91, 0x92, 0x8f, 0x76, 0x36, 0x41, 0x3e, 0x3e, 0x49, 0x55, 0x49, 0x55, 0x49, 0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x49, 0x42, 0x49, 0x42, 0x30, 0x3e, 0x3e, 0x2d, 0x27, 0x6f, 0x89, 0x90, 0x92, 0x90, 0x68, 0x20, 0x2f, 0x4b, 0x47, 0x42, 0x47, 0x38, 0x3e, 0x4a, 0x62, 0x6c, 0x62, 0x75, 0x59, 0x77, 0x91, 0x90, 0x4f, 0x39, 0x3e, 0x5f, 0x91, 0x91, 0x89, 0x39, 0x6a, 0x67, 0x67, 0x4b, 0x5c, 0x5c, 0x5c, 0x4b, 0x5c, 0x67, 0x67, 0x67, 0x42, 0x49, 0x49, 0x49, 0x4e, 0x55, 0x55, 0x55, 0x4e, 0x58, 0x5b, 0x8d, 0x5a, 0x02, 0x95, 0xa5, 0xb8, 0x94, 0xea, 0xe7, 0xe8, 0xef, 0xf0, 0xee, 0xe8, 0x99, 0xf7, 0x93, 0x91, 0x89, 0x77, 0x25, 0x00, 0xca, 0xf3, 0xf0, 0xf0, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xbb, 0xe8, 0xe5, 0x0a, 0x72, 0x8f, 0x93, 0x97, 0xb9, 0xbb, 0xf0, 0xe5, 0xed, 0xe9, 0xe7, 0xee, 0xf0, 0xee, 0xea, 0xea, 0xfc, 0x98, 0x98, 0x98, 0x0b, 0x1d, 0x70, 0x8f, 0x5f, 0x24, 0x38, 0x55, 0x47, 0x37, 0x3f, 0x46, 0x49, 0x3f, 0x3f, 0x3f, 0x4b, 0x4b, 0x5c, 0x4e, 0x5c, 0x55, 0x55, 0x67, 0x52, 0x5c, 0x5d, 0x28, 0x7b, 0x92, 0x97, 0x91, 0x32, 0x5d, 0x53, 0x3a, 0x87, 0x94, 0x89, 0x32, 0x36, 0x5d, 0x58, 0x4c, 0x4c, 0x3f, 0x4b, 0x4b, 0x4b, 0x52, 0x2f, 0x36, 0x7f, 0x92, 0xf2, 0x8b, 0x6f, 0x2b, 0x45, 0x37, 0x4b, 0x45, 0x45, 0x49, 0x49, 0x49, 0x56, 0x49, 0x42, 0x45, 0x45, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x47, 0x49, 0x49, 0x42, 0x49, 0x42, 0x4b, 0x3d, 0x3b, 0x44, 0x2a, 0x28, 0x78, 0x8f, 0x92, 0x92, 0x86, 0x33, 0x27, 0x31, 0x30, 0x30, 0x53, 0x57, 0x6c, 0x69, 0x6b, 0x6b, 0x59, 0x6d, 0x91, 0x8f, 0x71, 0x31, 0x60, 0x32, 0x8e, 0x94, 0x8b, 0x61, 0x5d, 0x67, 0x67, 0x5c, 0x67, 0x5c, 0x52, 0x6a, 0x6a, 0x6a, 0x52, 0x44, 0x2f, 0x3b, 0x3f, 0x46, 0x4b, 0x42, 0x56, 0x42, 0x56, 0x44, 0x2d, 0x73, 0x89, 0x68, 0x33, 0x09, 0x95, 0x98, 0xbc, 0xd7, 0xea, 0xf2, 0xee, 0xf0, 0xf0, 0xe8, 0xe7, 0xba, 0xb9, 0x97, 0xfe, 0x91, 0x8e, 0xb8, 0xb8, 0xf3, 0xf1, 0xf0, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xbb, 0xe8, 0xf0, 0xe4, 0xfe, 0x93, 0xf7, 0x99, 0xe3, 0x99, 0xed, 0xf2, 0xe8, 0xe7, 0xf2, 0xed, 0xee, 0xea, 0xf2, 0xbd, 0x98, 0x98, 0x00, 0x09, 0x3c, 0x43, 0x4f, 0x85, 0x80, 0x20, 0x4c, 0x49, 0x47, 0x44, 0x2f, 0x44, 0x42, 0x3f, 0x44, 0x52, 0x4b, 0x4e, 0x4e, 0x55, 0x5c, 0x54, 0x5c, 0x3e, 0x51, 0x39, 0x51, 0x50, 0x72, 0xfe, 0xe8, 0xf9, 0x82, 0x32, 0x58, 0x39, 0x3a, 0x8d, 0x91, 0x83, 0x33, 0x48, 0x58, 0x5d, 0x5c, 0x52, 0x4c, 0x3f, 0x53, 0x38, 0x29, 0x7f, 0x90, 0x93, 0x87, 0x4f, 0x2d, 0x55, 0x37, 0x42, 0x4b, 0x47, 0x42, 0x56, 0x47, 0x49, 0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x42, 0x49, 0x47, 0x55, 0x42, 0x3d, 0x3d, 0x3f, 0x30, 0x4b, 0x31, 0x2e, 0x50, 0x7f, 0x90, 0x92, 0x8b, 0x68, 0x21, 0x43, 0x63, 0x6e, 0x6b, 0x6c, 0x62, 0x6b, 0x59, 0x68, 0x8e, 0x92, 0x71, 0x4a, 0x3e, 0x40, 0x83, 0x99, 0xf2, 0x81, 0x68, 0x48, 0x4a, 0x51, 0x41, 0x63, 0x5c, 0x6a, 0x6a, 0x6a, 0x52, 0x3f, 0x3e, 0x44, 0x3b, 0x52, 0x3d, 0x4b, 0x45, 0x47, 0x55, 0x3f, 0x4c, 0x21, 0x7c, 0x85, 0x36, 0x5d, 0x69, 0x10, 0x96, 0x9c, 0x98, 0xeb, 0xed, 0xea, 0xee, 0xf1, 0xed, 0xe7, 0xe8, 0xe7, 0xbb, 0xf9, 0xf6, 0xea, 0xef, 0xee, 0xf2, 0xf8, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf2, 0xe8, 0xf2, 0xf2, 0xf7, 0xf0, 0xed, 0xe9, 0xee, 0xe8, 0xed, 0xe7, 0xe8, 0xe9, 0xe5, 0xf9, 0xea, 0xbd, 0x98, 0x95, 0x95, 0x10, 0x5b, 0x5d, 0x5d, 0x2f, 0x76, 0x91, 0x61, 0x1e, 0x2b, 0x37, 0x3b, 0x3b, 0x3f, 0x49, 0x49, 0x42, 0x42, 0x38, 0x46, 0x31, 0x2a, 0x2e, 0x43, 0x48, 0x6f, 0x70, 0x7e, 0x86, 0x8f, 0x92, 0xed, 0xbb, 0xf9, 0x94, 0x7a, 0x20, 0x60, 0x3e, 0x5e, 0x8d, 0x93, 0x88, 0x3a, 0x48, 0x5d, 0x4e, 0x6a, 0x58, 0x62, 0x3e, 0x31, 0x78, 0x91, 0x92, 0x83, 0x40, 0x2f, 0x44, 0x45, 0x4e, 0x42, 0x44, 0x3d, 0x3d, 0x3d, 0x3d, 0x45, 0x3d, 0x4b, 0x45, 0x42, 0x42, 0x45, 0x42, 0x3d, 0x45, 0x45, 0x45, 0x3d, 0x4b, 0x3d, 0x3d, 0x45, 0x42, 0x3d, 0x3d, 0x47, 0x3d, 0x42, 0x4e, 0x3f, 0x3d, 0x45, 0x35, 0x24, 0x71, 0x8d, 0x92, 0x90, 0x77, 0x5e, 0x69, 0x6c, 0x6b, 0x6b, 0x6b, 0x59, 0x68, 0x87, 0x92, 0x7b, 0x2d, 0x3b, 0x3c, 0x7a, 0xff, 0xe7, 0xba, 0xf9, 0x91, 0x89, 0x85, 0x77, 0x70, 0x5e, 0x59, 0x62, 0x2e, 0x28, 0x2a, 0x31, 0x35, 0x46, 0x4e, 0x45, 0x4e, 0x4b, 0x4e, 0x54, 0x53, 0x46, 0x28, 0x5b, 0x84, 0x76, 0x46, 0x67, 0x54, 0x73, 0x17, 0x02, 0x96, 0x98, 0xf5, 0xed, 0xea, 0xe5, 0xf1, 0xf8, 0xf1, 0xf1, 0xe8, 0xb9, 0xbb, 0xe8, 0xe8, 0xee, 0xf8, 0xf0, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xef, 0xef, 0xe8, 0xe7, 0xb9, 0xbb, 0xed, 0xf8, 0xf8, 0xf1, 0xe8, 0xe8, 0xf1, 0xee, 0xf2, 0xed, 0xf3, 0xc5, 0x98, 0x00, 0x96, 0x0c, 0x5b, 0x58, 0x4e, 0x4e, 0x53, 0x40, 0x8e, 0x8d, 0x78, 0x40, 0x2c, 0x2c, 0x29, 0x29, 0x2d, 0x2e, 0x43, 0x48, 0x59, 0x4f, 0x71, 0x7b, 0x80, 0x86, 0x8c, 0x90, 0x94, 0x97, 0x97, 0xf7, 0xbb, 0xe5, 0x91, 0x87, 0x91, 0x94, 0x77, 0x27, 0x46, 0x39, 0x4d, 0x90, 0x91, 0x86, 0x4f, 0x59, 0x5d, 0x58, 0x4a, 0x57, 0x39, 0x66, 0x90, 0x92, 0x86, 0x48, 0x30, 0x56, 0x44, 0x3b, 0x46, 0x49, 0x44, 0x3d, 0x3d, 0x3d, 0x4b, 0x3d, 0x3f, 0x3f, 0x3d, 0x45, 0x3d, 0x42, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x4b, 0x38, 0x4b, 0x3f, 0x3d, 0x3f, 0x45, 0x3f, 0x45, 0x49, 0x49, 0x3d, 0x44, 0x44, 0x47, 0x4b, 0x28, 0x50, 0x89, 0x92, 0x8f, 0x77, 0x4f, 0x69, 0x69, 0x6c, 0x5b, 0x71, 0x8b, 0x91, 0x7f, 0x39, 0x41, 0x36, 0x77, 0x91, 0x8e, 0xfe, 0xea, 0xbb, 0x97, 0x97, 0x97, 0x99, 0x94, 0x8f, 0x8b, 0x88, 0x80, 0x7b, 0x78, 0x66, 0x59, 0x59, 0x43, 0x43, 0x39, 0x39, 0x36, 0x36, 0x48, 0x66, 0x76, 0x89, 0x89, 0x50, 0x58, 0x54, 0x67, 0x53, 0x75, 0x20, 0x05, 0x9c, 0x98, 0xf5, 0xe4, 0xea, 0xee, 0xf8, 0xf8, 0xf8, 0xf1, 0xe7, 0xb9, 0xed, 0xee, 0xf0, 0xed, 0xed, 0xee, 0xe8, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf1, 0xed, 0xe8, 0xba, 0xbb, 0xf0, 0xf8, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xe4, 0xf3, 0xdc, 0x98, 0x95, 0x96, 0x0c, 0x5b, 0x58, 0x4e, 0x55, 0x5c, 0x41, 0x4f, 0xf7, 0x93, 0x92, 0x90, 0x8b, 0x86, 0x82, 0x83, 0x82, 0x89, 0x89, 0x8c, 0x8f, 0x90, 0x93, 0xff, 0x97, 0x97, 0xef, 0xef, 0xba, 0xba, 0xee, 0x97, 0x94, 0x8b, 0x5f, 0x20, 0x82, 0x91, 0x93, 0x71, 0x2e, 0x4c, 0x2c, 0x68, 0x8c, 0x91, 0x86, 0x4d, 0x40, 0x63, 0x63, 0x43, 0x3a, 0x83, 0x92, 0x8b, 0x32, 0x2b, 0x55, 0x55, 0x3d, 0x3f, 0x45, 0x45, 0x45, 0x45, 0x42, 0x3d, 0x3d, 0x45, 0x45, 0x42, 0x45, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x45, 0x42, 0x45, 0x3d, 0x4b, 0x3d, 0x4b, 0x3d, 0x4b, 0x3d, 0x3d, 0x45, 0x49, 0x49, 0x45, 0x44, 0x44, 0x3f, 0x35, 0x43, 0x62, 0x61, 0x88, 0x91, 0x8f, 0x6d, 0x66, 0x59, 0x66, 0x61, 0x8d, 0x90, 0x7f, 0x28, 0x63, 0x32, 0x6d, 0x92, 0x91, 0x80, 0x6d, 0x8c, 0x93, 0x94, 0xff, 0xbb, 0xba, 0xba, 0x97, 0x97, 0x99, 0xf3, 0x94, 0x92, 0x91, 0x8f, 0x8c, 0x8c, 0x89, 0x85, 0x83, 0x83, 0x86, 0x8b, 0x8d, 0xfe, 0x93, 0x8b, 0x66, 0x43, 0x6a, 0x5c, 0x5c, 0x4e, 0x6b, 0x26, 0x02, 0x96, 0x98, 0xfb, 0xf3, 0xef, 0xf8, 0xf8, 0xf8, 0xe7, 0xed, 0xe8, 0xf0, 0xf7, 0xee, 0xee, 0xed, 0xbb, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xf0, 0xbb, 0xba, 0xe7, 0xf1, 0xf1, 0xf0, 0xed, 0xba, 0xba, 0xe7, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf3, 0xde, 0xbc, 0x98, 0x95, 0x08, 0x69, 0x53, 0x52, 0x52, 0x56, 0x53, 0x29, 0x82, 0xff, 0xf9, 0xbb, 0xee, 0xf0, 0xff, 0x93, 0x93, 0xff, 0xea, 0xf2, 0xf2, 0xf2, 0xee, 0xed, 0xf0, 0xf1, 0xf1, 0xf0, 0xe5, 0xed, 0x93, 0x91, 0x87, 0x5a, 0x20, 0x2a, 0x5c, 0x3c, 0x85, 0xfe, 0x91, 0x71, 0x29, 0x57, 0x28, 0x5e, 0x8f, 0x94, 0x8e, 0x5f, 0x36, 0x6a, 0x43, 0x7b, 0xff, 0x8f, 0x68, 0x24, 0x2f, 0x3d, 0x49, 0x54, 0x54, 0x44, 0x44, 0x49, 0x49, 0x42, 0x49, 0x42, 0x49, 0x42, 0x42, 0x42, 0x45, 0x45, 0x42, 0x45, 0x42, 0x42, 0x42, 0x45, 0x42, 0x42, 0x42, 0x45, 0x42, 0x45, 0x42, 0x46, 0x42, 0x42, 0x3f, 0x44, 0x42, 0x49, 0x42, 0x3e, 0x51, 0x75, 0x60, 0x59, 0x4d, 0x88, 0x91, 0x89, 0x33, 0x5e, 0x71, 0x8f, 0x90, 0x74, 0x27, 0x6a, 0x39, 0x6d, 0x91, 0x91, 0x86, 0x4d, 0x43, 0x26, 0x4d, 0x80, 0x90, 0xfe, 0xe9, 0xe5, 0xf7, 0xef, 0xed, 0xf7, 0xe5, 0xf0, 0xed, 0xee, 0xef, 0xf2, 0xf9, 0xf8, 0xf9, 0xf9, 0x97, 0xf9, 0xf7, 0x97, 0xb9, 0xf9, 0x84, 0x36, 0x4c, 0x52, 0x52, 0x5c, 0x52, 0x6b, 0x1d, 0x03, 0xf4, 0x98, 0xca, 0xf3, 0xee, 0xff, 0xed, 0xe8, 0xe7, 0xed, 0xf8, 0xf0, 0xf7, 0xbb, 0xb9, 0xbb, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xbb, 0xed, 0xed, 0xf1, 0xf7, 0xbb, 0xee, 0xba, 0xed, 0xf9, 0xf7, 0xe8, 0xed, 0xf8, 0xf3, 0xbd, 0x98, 0x00, 0x05, 0x26, 0x60, 0x58, 0x52, 0x52, 0x5c, 0x3e, 0x4d, 0x91, 0xff, 0xf7, 0xbb, 0xbb, 0xe8, 0xf0, 0xf8, 0xf8, 0xef, 0xbb, 0xba, 0xe8, 0xe7, 0xf1, 0xe7, 0xf1, 0xf1, 0xf6, 0xf0, 0xf9, 0x93, 0x88, 0x4d, 0x1f, 0x29, 0x4a, 0x5c, 0x67, 0x4a, 0x4f, 0x86, 0x92, 0x90, 0x68, 0x21, 0x4a, 0x28, 0x5f, 0x8b, 0x94, 0x8e, 0x68, 0x43, 0x51, 0x8c, 0x93, 0x82, 0x59, 0x62, 0x4c, 0x38, 0x42, 0x55, 0x47, 0x44, 0x44, 0x45, 0x45, 0x42, 0x3d, 0x45, 0x3d, 0x45, 0x42, 0x45, 0x42, 0x3d, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x49, 0x42, 0x42, 0x42, 0x49, 0x42, 0x47, 0x49, 0x42, 0x3b, 0x3b, 0x35, 0x3e, 0x43, 0x62, 0x69, 0x51, 0x63, 0x60, 0x50, 0x4d, 0x8f, 0xff, 0x5a, 0x5a, 0x8d, 0x8d, 0x74, 0x36, 0x4a, 0x39, 0x33, 0x91, 0x94, 0x8b, 0x5f, 0x57, 0x6e, 0x6e, 0x39, 0x1f, 0x20, 0x6d, 0x8f, 0x93, 0x94, 0xea, 0xed, 0xed, 0xf1, 0xe5, 0xed, 0xee, 0xba, 0xbb, 0xee, 0xf8, 0xe8, 0xb9, 0xb9, 0xbb, 0xef, 0xf8, 0xff, 0xfe, 0x92, 0x76, 0x2e, 0x6a, 0x52, 0x5c, 0x5c, 0x5d, 0x51, 0x19, 0x96, 0x00, 0x9f, 0xe4, 0x94, 0xe5, 0xef, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xee, 0xe8, 0xed, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf7, 0xf0, 0xb9, 0xf2, 0xf9, 0xdc, 0x98, 0x95, 0x02, 0x19, 0x6e, 0x58, 0x41, 0x58, 0x52, 0x3e, 0x40, 0x86, 0xff, 0xf7, 0xee, 0xef, 0xe8, 0xef, 0xe8, 0xf9, 0xf0, 0xff, 0xbb, 0xef, 0xee, 0xf0, 0xe7, 0xe8, 0xe5, 0xf3, 0x94, 0x8a, 0x72, 0x18, 0x16, 0x1e, 0x58, 0x4b, 0x52, 0x58, 0x58, 0x67, 0x60, 0x40, 0x82, 0x93, 0x92, 0x77, 0x21, 0x5d, 0x2a, 0x3a, 0x8b, 0x93, 0x90, 0x6d, 0x4d, 0x91, 0x8e, 0x6f, 0x48, 0x69, 0x62, 0x58, 0x38, 0x37, 0x3d, 0x4e, 0x4b, 0x4b, 0x47, 0x4b, 0x45, 0x3d, 0x45, 0x45, 0x3d, 0x42, 0x45, 0x45, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x49, 0x49, 0x49, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x38, 0x3e, 0x63, 0x60, 0x6b, 0x62, 0x62, 0x62, 0x62, 0x64, 0x60, 0x4f, 0x6d, 0x93, 0x94, 0x94, 0x89, 0x76, 0x2e, 0x4c, 0x29, 0x4d, 0x91, 0x93, 0x8b, 0x5f, 0x5b, 0x67, 0x4c, 0x58, 0x63, 0x63, 0x60, 0x1f, 0x15, 0x18, 0x5a, 0x81, 0x92, 0xf3, 0xf9, 0xe8, 0xe8, 0xe5, 0xed, 0xe5, 0xf7, 0xf8, 0xf2, 0xe7, 0xb9, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0x99, 0x8f, 0x6f, 0x31, 0x5c, 0x56, 0x5c, 0x52, 0x5d, 0x62, 0x10, 0x95, 0x98, 0xfc, 0xea, 0x97, 0xba, 0xef, 0xf0, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xf7, 0xf2, 0xe5, 0xf8, 0xea, 0xf5, 0x9a, 0x96, 0x10, 0x6b, 0x3e, 0x4c, 0x58, 0x47, 0x5c, 0x27, 0x7b, 0x91, 0xfe, 0xef, 0xee, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xf0, 0xe9, 0xed, 0xe9, 0xed, 0xf0, 0xf3, 0xf3, 0xf7, 0x79, 0x1c, 0x10, 0x11, 0x19, 0x39, 0x4c, 0x38, 0x52, 0x58, 0x58, 0x5d, 0x5c, 0x6a, 0x28, 0x22, 0xfd, 0x99, 0x93, 0x6f, 0x31, 0x4e, 0x31, 0x33, 0x86, 0x92, 0x8e, 0x81, 0x93, 0x83, 0x3a, 0x6c, 0x62, 0x6b, 0x6b, 0x63, 0x4a, 0x3f, 0x42, 0x45, 0x55, 0x45, 0x42, 0x42, 0x49, 0x47, 0x49, 0x47, 0x49, 0x3d, 0x42, 0x45, 0x42, 0x45, 0x42, 0x42, 0x42, 0x45, 0x49, 0x42, 0x42, 0x42, 0x4b, 0x4b, 0x35, 0x38, 0x38, 0x53, 0x5d, 0x64, 0x63, 0x60, 0x60, 0x60, 0x62, 0x5b, 0x62, 0x62, 0x32, 0x6d, 0x91, 0x93, 0x8b, 0x68, 0x29, 0x5d, 0x28, 0x33, 0x8e, 0xbb, 0x8e, 0x5a, 0x40, 0x51, 0x57, 0x57, 0x57, 0x4c, 0x4c, 0x58, 0x60, 0x51, 0x32, 0x16, 0x12, 0x13, 0x25, 0x81, 0xf3, 0xf3, 0xf2, 0xe7, 0xf1, 0xf7, 0xbb, 0xe5, 0xee, 0xee, 0xf0, 0xf0, 0xe8, 0xba, 0xba, 0xf7, 0x93, 0x89, 0x3c, 0x4c, 0x52, 0x52, 0x58, 0x4e, 0x64, 0x20, 0x05, 0x95, 0xbc, 0xfd, 0x99, 0xe5, 0xf2, 0xf7, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xb9, 0xed, 0xf9, 0x94, 0xec, 0x9a, 0x9c, 0x03, 0x40, 0x5d, 0x6a, 0x3b, 0x52, 0x67, 0x31, 0x68, 0x91, 0xfe, 0xff, 0xe8, 0xed, 0xef, 0xf0, 0xf0, 0xf2, 0xe7, 0xbb, 0xb9, 0xe9, 0xea, 0xf3, 0xfe, 0x79, 0x14, 0x0c, 0x09, 0x15, 0x21, 0x63, 0x58, 0x41, 0x3b, 0x58, 0x52, 0x5c, 0x5c, 0x5c, 0x51, 0x48, 0x78, 0x8b, 0xe5, 0x99, 0xf3, 0x8f, 0x78, 0x23, 0x3e, 0x2a, 0x48, 0x7e, 0x94, 0x99, 0x94, 0x81, 0x3a, 0x5b, 0x64, 0x60, 0x6b, 0x69, 0x69, 0x60, 0x5d, 0x46, 0x46, 0x37, 0x4e, 0x4e, 0x49, 0x49, 0x47, 0x55, 0x42, 0x49, 0x45, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x46, 0x38, 0x35, 0x3e, 0x4a, 0x63, 0x6a, 0x63, 0x51, 0x5b, 0x57, 0x63, 0x63, 0x60, 0x62, 0x59, 0x32, 0x68, 0x8d, 0x91, 0x85, 0x33, 0x48, 0x4a, 0x1e, 0x68, 0x91, 0x99, 0xba, 0xf7, 0x88, 0x74, 0x50, 0x3c, 0x4c, 0x58, 0x57, 0x4c, 0x4c, 0x4c, 0x4c, 0x5d, 0x6e, 0x51, 0x20, 0x0e, 0x09, 0x0c, 0x14, 0xec, 0xf6, 0xf3, 0xf3, 0x99, 0xbb, 0xbb, 0xf0, 0xf8, 0xf8, 0xf0, 0xb9, 0xb9, 0xf0, 0xbb, 0xff, 0x82, 0x36, 0x4a, 0x4c, 0x52, 0x55, 0x4b, 0x6c, 0x13, 0x96, 0x98, 0xb8, 0x99, 0xba, 0xf7, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xbb, 0xed, 0xf8, 0xf3, 0xeb, 0x95, 0x96, 0x12, 0x6b, 0x4b, 0x52, 0x5c, 0x5c, 0x4a, 0x3c, 0x8d, 0xff, 0xe5, 0xee, 0xbb, 0xee, 0xee, 0xf0, 0xf0, 0xee, 0xe8, 0xf2, 0x99, 0xf3, 0x65, 0x1c, 0x08, 0x0b, 0x12, 0x1f, 0x39, 0x52, 0x3f, 0x44, 0x44, 0x44, 0x52, 0x5c, 0x52, 0x5d, 0x53, 0x48, 0x78, 0x8c, 0xfe, 0xff, 0xfe, 0x8b, 0x8b, 0x93, 0x92, 0x77, 0x21, 0x31, 0x38, 0x28, 0x78, 0x91, 0xff, 0xfe, 0x70, 0x3c, 0x62, 0x6b, 0x63, 0x5b, 0x5b, 0x5b, 0x62, 0x64, 0x5d, 0x53, 0x3e, 0x46, 0x3f, 0x3d, 0x42, 0x42, 0x45, 0x3d, 0x45, 0x45, 0x45, 0x45, 0x45, 0x42, 0x3d, 0x3d, 0x3d, 0x3d, 0x3e, 0x3f, 0x4a, 0x58, 0x60, 0x64, 0x60, 0x60, 0x60, 0x5b, 0x3c, 0x5b, 0x60, 0x63, 0x63, 0x51, 0x50, 0x77, 0x90, 0x90, 0x82, 0x40, 0x5d, 0x43, 0x1e, 0x74, 0x8e, 0x93, 0x92, 0x8e, 0xfe, 0x92, 0x91, 0x8b, 0x7b, 0x50, 0x36, 0x41, 0x57, 0x4c, 0x4c, 0x44, 0x58, 0x53, 0x57, 0x57, 0x62, 0x5b, 0x1f, 0x0e, 0x07, 0x06, 0x0f, 0xb8, 0xec, 0x99, 0x99, 0xbb, 0xf1, 0xf8, 0xf8, 0xf8, 0xf1, 0xf1, 0xb9, 0xbb, 0x92, 0x74, 0x36, 0x53, 0x5c, 0x56, 0x5c, 0x58, 0x32, 0x05, 0x95, 0xf5, 0xf3, 0xe8, 0xf0, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xb9, 0xe8, 0xf8, 0xf3, 0xf5, 0x9a, 0x02, 0x32, 0x6a, 0x52, 0x44, 0x5c, 0x5c, 0x2c, 0x7e, 0x93, 0xf7, 0xe8, 0xb9, 0xee, 0xef, 0xee, 0xee, 0xf2, 0xe5, 0xf3, 0xfd, 0xeb, 0x0c, 0x09, 0x0e, 0x19, 0x3c, 0x41, 0x41, 0x45, 0x49, 0x38, 0x3b, 0x56, 0x55, 0x54, 0x54, 0x4a, 0x2c, 0x70, 0x89, 0x92, 0xf7, 0x99, 0x8e, 0x7b, 0x26, 0x33, 0x80, 0x93, 0x94, 0x80, 0x21, 0x30, 0x3d, 0x28, 0x6f, 0x90, 0x93, 0x90, 0x77, 0x32, 0x62, 0x62, 0x57, 0x5b, 0x62, 0x62, 0x60, 0x60, 0x64, 0x60, 0x4a, 0x3e, 0x3e, 0x3e, 0x38, 0x38, 0x30, 0x38, 0x30, 0x38, 0x30, 0x35, 0x37, 0x35, 0x38, 0x3e, 0x52, 0x58, 0x63, 0x64, 0x60, 0x62, 0x62, 0x62, 0x60, 0x51, 0x5b, 0x6c, 0x57, 0x60, 0x60, 0x40, 0x3a, 0x86, 0x90, 0x90, 0x7b, 0x32, 0x31, 0x53, 0x1f, 0x78, 0xfe, 0x92, 0x87, 0x70, 0x68, 0x83, 0x8b, 0x93, 0x92, 0x92, 0x8d, 0x7b, 0x3a, 0x2e, 0x52, 0x5c, 0x52, 0x58, 0x57, 0x4c, 0x58, 0x58, 0x5d, 0x64, 0x6b, 0x5b, 0x1d, 0x10, 0x09, 0x07, 0x05, 0xdc, 0x94, 0xe7, 0xf2, 0xf1, 0xf8, 0xf8, 0xf1, 0xee, 0xe8, 0x97, 0x90, 0x6f, 0x3e, 0x55, 0x56, 0x56, 0x52, 0x62, 0x10, 0x00, 0xbc, 0xf3, 0xe8, 0xf0, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xe7, 0xee, 0xf8, 0x94, 0xa3, 0x95, 0x0c, 0x5b, 0x5c, 0x52, 0x58, 0x53, 0x2e, 0x7b, 0x91, 0xf7, 0xef, 0xe9, 0xb9, 0xef, 0xee, 0xe8, 0xee, 0xe5, 0xf3, 0xf6, 0xf5, 0x06, 0x1d, 0x48, 0x57, 0x4c, 0x3b, 0x2f, 0x3b, 0x3e, 0x35, 0x3f, 0x52, 0x37, 0x46, 0x3e, 0x39, 0x71, 0x8c, 0x93, 0xf7, 0xfe, 0x93, 0x80, 0x3a, 0x24, 0x46, 0x3e, 0x3c, 0x74, 0x92, 0x92, 0x82, 0x32, 0x24, 0x3e, 0x28, 0x40, 0x82, 0x92, 0x92, 0x83, 0x3a, 0x4f, 0x57, 0x57, 0x63, 0x6e, 0x51, 0x62, 0x62, 0x62, 0x6b, 0x6b, 0x64, 0x63, 0x57, 0x58, 0x4c, 0x53, 0x4c, 0x53, 0x4c, 0x58, 0x58, 0x63, 0x63, 0x6e, 0x64, 0x64, 0x64, 0x60, 0x60, 0x57, 0x62, 0x51, 0x62, 0x60, 0x58, 0x63, 0x6e, 0x59, 0x4f, 0x77, 0x8f, 0x90, 0x8c, 0x6f, 0x29, 0x4a, 0x21, 0x26, 0x88, 0x93, 0x92, 0x84, 0x5e, 0x48, 0x51, 0x59, 0x61, 0x7b, 0x8b, 0x91, 0xf8, 0x94, 0x8d, 0x7f, 0x50, 0x39, 0x57, 0x4c, 0x57, 0x53, 0x6a, 0x5c, 0x5d, 0x58, 0x57, 0x64, 0x64, 0x6b, 0x6e, 0x59, 0x33, 0x07, 0xe4, 0xbb, 0xe7, 0xb9, 0xe7, 0xf2, 0xf0, 0xf1, 0xf0, 0xbb, 0xff, 0x8c, 0x51, 0x5d, 0x3f, 0x5c, 0x42, 0x64, 0x26, 0x02, 0x95, 0xe4, 0xe9, 0xef, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xe7, 0xf0, 0xf0, 0xbb, 0x04, 0x95, 0x15, 0x6b, 0x3f, 0x52, 0x58, 0x2e, 0x5e, 0x8f, 0x97, 0xe5, 0xf2, 0xe5, 0xf2, 0xf7, 0xf0, 0xe8, 0xe7, 0xe8, 0x94, 0x65, 0x0a, 0x25, 0x1d, 0x39, 0x41, 0x2b, 0x47, 0x38, 0x2f, 0x41, 0x41, 0x3e, 0x31, 0x2e, 0x40, 0x68, 0x88, 0x91, 0xff, 0xe5, 0xff, 0x90, 0x70, 0x26, 0x2e, 0x4e, 0x4e, 0x5c, 0x31, 0x27, 0x74, 0x8f, 0x93, 0x88, 0x5f, 0x21, 0x41, 0x28, 0x21, 0x77, 0x91, 0x91, 0x8b, 0x5f, 0x3a, 0x62, 0x6b, 0x5d, 0x60, 0x69, 0x51, 0x62, 0x62, 0x62, 0x62, 0x6b, 0x62, 0x6b, 0x64, 0x6b, 0x6b, 0x6b, 0x64, 0x60, 0x64, 0x64, 0x64, 0x62, 0x60, 0x60, 0x60, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x62, 0x6e, 0x63, 0x48, 0x61, 0x80, 0x90, 0x92, 0x86, 0x6f, 0x2e, 0x43, 0x21, 0x5f, 0x87, 0x92, 0xff, 0x86, 0x48, 0x43, 0x6b, 0x5d, 0x5d, 0x63, 0x48, 0x61, 0x7e, 0x91, 0x93, 0xfe, 0xfe, 0x8f, 0x7a, 0x3a, 0x36, 0x63, 0x6a, 0x5d, 0x5d, 0x58, 0x58, 0x64, 0x58, 0x58, 0x67, 0x6e, 0x63, 0x40, 0x13, 0x1c, 0xf3, 0xb9, 0xe7, 0xb9, 0xb9, 0xee, 0xf8, 0xf1, 0xb9, 0xee, 0x92, 0x7c, 0x28, 0x58, 0x3f, 0x56, 0x4e, 0x5b, 0x05, 0x98, 0xe1, 0xf2, 0xe8, 0xbb, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xf0, 0xf0, 0xba, 0x04, 0x96, 0x21, 0x63, 0x4c, 0x52, 0x3e, 0x4f, 0x86, 0x92, 0xed, 0xe7, 0xb9, 0xf0, 0xfe, 0xff, 0xf0, 0xe8, 0xba, 0xbb, 0x94, 0x0f, 0x10, 0x80, 0x77, 0x33, 0x29, 0x3e, 0x30, 0x2f, 0x2a, 0x24, 0x27, 0x2c, 0x6f, 0x7e, 0x8b, 0x94, 0x97, 0xee, 0xf7, 0xf1, 0x8b, 0x3a, 0x29, 0x4a, 0x44, 0x52, 0x52, 0x4c, 0x58, 0x58, 0x2d, 0x74, 0x92, 0xea, 0x92, 0x74, 0x36, 0x23, 0x31, 0x23, 0x4f, 0x88, 0x93, 0x94, 0x7e, 0x3a, 0x5b, 0x5b, 0x69, 0x57, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x51, 0x62, 0x62, 0x62, 0x62, 0x57, 0x62, 0x60, 0x60, 0x60, 0x57, 0x64, 0x51, 0x50, 0x77, 0x8e, 0x93, 0x8d, 0x7f, 0x28, 0x3b, 0x43, 0x2c, 0x77, 0x92, 0xff, 0xfe, 0x86, 0x26, 0x63, 0x63, 0x63, 0x63, 0x6e, 0x63, 0x63, 0x4a, 0x39, 0x4d, 0x88, 0x93, 0xbb, 0xb9, 0xf3, 0x90, 0x7e, 0x5e, 0x48, 0x48, 0x57, 0x60, 0x5d, 0x5d, 0x6a, 0x6a, 0x63, 0x51, 0x3c, 0x84, 0x91, 0x14, 0x1b, 0xf3, 0xf0, 0xed, 0xef, 0xef, 0xbb, 0xe7, 0xe7, 0xe8, 0xf7, 0x91, 0x74, 0x31, 0x4c, 0x5c, 0x49, 0x6c, 0x10, 0x98, 0xde, 0xea, 0xb9, 0xbb, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xf7, 0xf2, 0xf3, 0xfa, 0x01, 0x26, 0x64, 0x5c, 0x5d, 0x28, 0x7e, 0x92, 0xef, 0xe5, 0xe8, 0xed, 0xf8, 0xfe, 0xf8, 0xed, 0xe5, 0xe9, 0xf3, 0xfb, 0x05, 0x4d, 0x20, 0x85, 0x83, 0x5a, 0x4f, 0x3a, 0x32, 0x5f, 0x76, 0x82, 0x8c, 0x92, 0x92, 0xff, 0x97, 0xe8, 0xe5, 0xea, 0x8a, 0x22, 0x36, 0x43, 0x52, 0x5c, 0x3b, 0x57, 0x41, 0x41, 0x58, 0x3f, 0x50, 0x82, 0xf1, 0xf8, 0x92, 0x85, 0x4f, 0x21, 0x2a, 0x41, 0x32, 0x82, 0x91, 0x92, 0x8b, 0x6d, 0x32, 0x3c, 0x62, 0x5b, 0x62, 0x69, 0x62, 0x62, 0x62, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x51, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x60, 0x48, 0x3a, 0x70, 0x86, 0x93, 0x92, 0x8b, 0x6f, 0x43, 0x31, 0x27, 0x4f, 0x86, 0x93, 0xea, 0xff, 0x8c, 0x5e, 0x60, 0x6e, 0x63, 0x64, 0x60, 0x64, 0x5d, 0x5d, 0x63, 0x41, 0x4d, 0x82, 0x8c, 0x8e, 0x99, 0xba, 0xf0, 0x92, 0x8d, 0x82, 0x78, 0x66, 0x48, 0x48, 0x4a, 0x43, 0x48, 0x39, 0x5e, 0x7e, 0x89, 0x74, 0x22, 0x05, 0x81, 0xea, 0xf7, 0xf9, 0xef, 0xee, 0xe7, 0xf1, 0xe7, 0xbb, 0x97, 0x8d, 0x40, 0x4a, 0x42, 0x55, 0x6b, 0x17, 0x98, 0xec, 0xea, 0xed, 0xbb, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xe5, 0xe8, 0xf3, 0x0a, 0x96, 0x33, 0x51, 0x54, 0x43, 0x71, 0x90, 0xff, 0xba, 0xe8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xb9, 0xe8, 0xea, 0xb8, 0x98, 0x09, 0x4a, 0x31, 0x69, 0x91, 0xf3, 0xf7, 0x90, 0xff, 0x93, 0x94, 0xea, 0xe7, 0xbb, 0xf7, 0xf7, 0xbb, 0xe6, 0xf3, 0x65, 0x6d, 0x84, 0x66, 0x39, 0x6a, 0x6a, 0x5d, 0x57, 0x57, 0x63, 0x6e, 0x6e, 0x73, 0x68, 0x8e, 0xf0, 0xf2, 0x94, 0x8f, 0x7a, 0x2c, 0x23, 0x46, 0x23, 0x6f, 0x91, 0xf3, 0x91, 0x85, 0x61, 0x3c, 0x3c, 0x5b, 0x6b, 0x62, 0x60, 0x6b, 0x6b, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x60, 0x60, 0x64, 0x60, 0x60, 0x60, 0x62, 0x48, 0x40, 0x40, 0x74, 0x86, 0x92, 0x93, 0x8f, 0x7f, 0x40, 0x43, 0x2e, 0x2c, 0x7b, 0x90, 0xf3, 0xb9, 0xb9, 0x94, 0x85, 0x3a, 0x60, 0x6e, 0x63, 0x6e, 0x64, 0x53, 0x6e, 0x64, 0x48, 0x66, 0x85, 0x84, 0x1f, 0x78, 0x93, 0xba, 0xe7, 0xf7, 0xff, 0x94, 0x93, 0x90, 0x8b, 0x88, 0x7f, 0x7b, 0x7b, 0x7e, 0x8d, 0x8f, 0x6f, 0x2a, 0x51, 0x10, 0x0f, 0xf3, 0xe8, 0xf7, 0xe7, 0xf1, 0xf8, 0xf0, 0xbb, 0xba, 0x97, 0x93, 0x80, 0x39, 0x38, 0x44, 0x5d, 0x21, 0x00, 0xde, 0xea, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xf3, 0xeb, 0x02, 0x20, 0x6c, 0x41, 0x59, 0x8c, 0x91, 0xbb, 0xba, 0xb9, 0xf1, 0xf0, 0xee, 0xef, 0xf9, 0xb9, 0xe8, 0xfd, 0xbc, 0x96, 0x1d, 0x43, 0x3e, 0x28, 0x83, 0x92, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xee, 0xe5, 0xf2, 0xf9, 0xf9, 0xef, 0xf3, 0x1b, 0x01, 0x17, 0x76, 0x84, 0x76, 0x32, 0x51, 0x60, 0x6a, 0x6a, 0x6a, 0x6e, 0x5b, 0x33, 0x80, 0x94, 0xe8, 0xb9, 0xf7, 0x93, 0x90, 0x85, 0x50, 0x28, 0x53, 0x31, 0x32, 0x7f, 0x91, 0x91, 0x8f, 0x82, 0x71, 0x50, 0x48, 0x60, 0x62, 0x57, 0x57, 0x57, 0x64, 0x64, 0x64, 0x60, 0x57, 0x60, 0x57, 0x60, 0x57, 0x51, 0x62, 0x51, 0x60, 0x51, 0x40, 0x5e, 0x77, 0x86, 0x90, 0x91, 0x8f, 0x84, 0x66, 0x51, 0x43, 0x26, 0x61, 0x89, 0x91, 0xfe, 0xf8, 0xe9, 0xf1, 0xf8, 0x91, 0x86, 0x33, 0x3c, 0x60, 0x63, 0x63, 0x6b, 0x48, 0x3a, 0x78, 0x89, 0x7c, 0x39, 0x2e, 0x1f, 0x7a, 0x93, 0xe5, 0xe8, 0xef, 0xb9, 0xbb, 0x93, 0x99, 0x97, 0x93, 0x93, 0x94, 0x93, 0x8d, 0x78, 0x23, 0x46, 0x3e, 0x26, 0x03, 0xde, 0xea, 0xed, 0xb9, 0xf0, 0xf8, 0xf8, 0xe8, 0xbb, 0xbb, 0xfe, 0x90, 0x76, 0x24, 0x3b, 0x5c, 0x36, 0x02, 0xe1, 0xf9, 0xf1, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xe8, 0xe5, 0xf2, 0xf7, 0xf3, 0x34, 0x02, 0x2c, 0x62, 0x2c, 0x82, 0x91, 0xff, 0xba, 0xb9, 0xe7, 0xee, 0xee, 0xba, 0xe7, 0xee, 0xb9, 0xf3, 0xfc, 0x95, 0x07, 0x50, 0x35, 0x46, 0x31, 0x70, 0x91, 0xfe, 0xff, 0xed, 0xef, 0xf9, 0xed, 0xf2, 0xf7, 0xff, 0xf7, 0xf3, 0xd7, 0x00, 0x05, 0x16, 0x3c, 0x66, 0x84, 0x84, 0x66, 0x36, 0x5d, 0x5d, 0x51, 0x2c, 0x6d, 0x88, 0x92, 0x97, 0xb9, 0xb9, 0xbb, 0xf8, 0x93, 0x91, 0x8d, 0x71, 0x1e, 0x35, 0x46, 0x2e, 0x61, 0x88, 0x92, 0x93, 0x91, 0x86, 0x7f, 0x6f, 0x50, 0x3c, 0x3c, 0x3c, 0x51, 0x48, 0x51, 0x51, 0x51, 0x51, 0x39, 0x51, 0x48, 0x40, 0x3a, 0x40, 0x61, 0x74, 0x85, 0x8f, 0x93, 0x94, 0x90, 0x85, 0x71, 0x3c, 0x4a, 0x43, 0x28, 0x7f, 0x90, 0xf9, 0xf0, 0xea, 0xf7, 0xf1, 0xf8, 0xf8, 0xfe, 0x93, 0x91, 0x77, 0x3a, 0x40, 0x36, 0x40, 0x6f, 0x89, 0x89, 0x76, 0x31, 0x35, 0x3e, 0x43, 0x16, 0x80, 0xea, 0xb9, 0xbb, 0xe7, 0xed, 0xf7, 0xba, 0xba, 0xf0, 0xf0, 0xbb, 0x94, 0x7f, 0x24, 0x55, 0x54, 0x4b, 0x48, 0x09, 0xfb, 0xf3, 0xb9, 0xb9, 0xe8, 0xf8, 0xf8, 0xf0, 0xbb, 0xef, 0xf7, 0x92, 0x8c, 0x3a, 0x31, 0x49, 0x51, 0x05, 0xe5, 0xee, 0xe9, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xf7, 0xf8, 0x99, 0xe1, 0x05, 0x29, 0x48, 0x77, 0x91, 0xff, 0xbb, 0xb9, 0xe7, 0xe8, 0xf0, 0xee, 0xbb, 0xb9, 0xf0, 0xf2, 0xe4, 0x95, 0x96, 0x15, 0x62, 0x4b, 0x5c, 0x3f, 0x4f, 0x89, 0xff, 0xf1, 0xb9, 0xe8, 0xf2, 0xbb, 0xee, 0xf1, 0xf0, 0xf3, 0xe1, 0x96, 0x03, 0x0e, 0x16, 0x5d, 0x63, 0x69, 0x7c, 0x84, 0x7c, 0x66, 0x4f, 0x77, 0x80, 0x92, 0xfe, 0x97, 0xe5, 0xba, 0xb9, 0xe7, 0xe8, 0xf1, 0xf1, 0xf9, 0x93, 0x82, 0x3a, 0x23, 0x31, 0x2e, 0x2c, 0x70, 0x83, 0x8f, 0x91, 0x92, 0x92, 0x90, 0x88, 0x82, 0x7b, 0x77, 0x74, 0x70, 0x6d, 0x70, 0x6d, 0x74, 0x77, 0x77, 0x82, 0x83, 0x8b, 0x91, 0x93, 0x92, 0x91, 0x8d, 0x80, 0x66, 0x39, 0x36, 0x3c, 0x26, 0x71, 0x89, 0x93, 0xf2, 0xb9, 0xe7, 0xe7, 0xf1, 0xf1, 0xf8, 0xed, 0xf2, 0xe7, 0xee, 0x91, 0x8f, 0x80, 0x7a, 0x86, 0x8c, 0x84, 0x6b, 0x31, 0x54, 0x4e, 0x46, 0x2b, 0x1e, 0x15, 0xfe, 0xba, 0xe7, 0xed, 0xf8, 0xf8, 0xf2, 0xee, 0xf8, 0xf1, 0x93, 0x8d, 0x2c, 0x3e, 0x55, 0x56, 0x55, 0x4a, 0x1d, 0x02, 0xec, 0xf2, 0xba, 0xbb, 0xf0, 0xf8, 0xf0, 0xe8, 0xe8, 0x99, 0xf0, 0x93, 0x82, 0x36, 0x55, 0x2e, 0x09, 0xf3, 0xee, 0xed, 0xe8, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xee, 0xee, 0xb9, 0xef, 0xf8, 0xbb, 0x97, 0x0a, 0x1f, 0x50, 0x8f, 0x97, 0xe8, 0xed, 0xe7, 0xed, 0xf1, 0xf0, 0xf0, 0xe8, 0xe8, 0xe7, 0xf3, 0x1b, 0x98, 0x05, 0x59, 0x3e, 0x5c, 0x56, 0x45, 0x36, 0x7f, 0x94, 0xe8, 0xe6, 0xe7, 0xbb, 0xe8, 0xee, 0xf2, 0xe7, 0xf3, 0xc5, 0x95, 0x09, 0x0e, 0x16, 0x53, 0x67, 0x6e, 0x51, 0x6f, 0x7f, 0x8d, 0x8f, 0x93, 0xf9, 0xf0, 0xf7, 0xbb, 0xe5, 0xbb, 0xb9, 0xe7, 0xe7, 0xed, 0xb9, 0xbb, 0xbb, 0x93, 0x8f, 0x78, 0x39, 0x23, 0x31, 0x23, 0x27, 0x4f, 0x7b, 0x88, 0x91, 0x93, 0x93, 0xfe, 0x93, 0x92, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x92, 0x8e, 0x85, 0x71, 0x59, 0x2e, 0x2b, 0x3e, 0x1f, 0x4f, 0x83, 0x91, 0x93, 0xef, 0xbb, 0xb9, 0xe7, 0xe7, 0xe8, 0xbb, 0xef, 0xe5, 0xe7, 0xbb, 0xe7, 0xff, 0xf2, 0x99, 0x94, 0x90, 0x84, 0x51, 0x31, 0x54, 0x49, 0x4b, 0x38, 0x30, 0x2b, 0x16, 0x5a, 0xf3, 0xe8, 0xed, 0xf8, 0xe8, 0xba, 0xe8, 0xed, 0xee, 0xff, 0x85, 0x39, 0x4b, 0x47, 0x56, 0x49, 0x3e, 0x3c, 0x05, 0xfb, 0xf3, 0xba, 0xbb, 0xf0, 0xf8, 0xf1, 0xee, 0xe7, 0xe8, 0xe8, 0xba, 0x91, 0x6f, 0x46, 0x21, 0x13, 0xf3, 0xed, 0xe6, 0xe8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xbb, 0xf0, 0xf8, 0xe8, 0xf3, 0x1c, 0x17, 0x89, 0xfe, 0xbb, 0xed, 0xee, 0xed, 0xf0, 0xf8, 0xf8, 0xf0, 0xf0, 0xef, 0xed, 0xe5, 0xa3, 0x95, 0x10, 0x6e, 0x4e, 0x5c, 0x47, 0x44, 0x31, 0x76, 0x92, 0xb9, 0xe7, 0xbb, 0xe7, 0xef, 0xe8, 0xe7, 0xea, 0xdc, 0x01, 0x03, 0x10, 0x11, 0x1a, 0x6a, 0x67, 0x67, 0x6e, 0x5b, 0x6d, 0x92, 0xe5, 0xed, 0xf1, 0xe6, 0xe7, 0xe5, 0xee, 0xee, 0xf0, 0xed, 0xf1, 0xe7, 0xee, 0xbb, 0xef, 0xf1, 0xf9, 0x93, 0x8f, 0x7f, 0x5b, 0x43, 0x2b, 0x23, 0x23, 0x21, 0x32, 0x61, 0x74, 0x7e, 0x82, 0x86, 0x86, 0x89, 0x89, 0x8c, 0x89, 0x86, 0x86, 0x86, 0x7f, 0x78, 0x71, 0x50, 0x27, 0x23, 0x31, 0x30, 0x30, 0x27, 0x4f, 0x85, 0x91, 0xff, 0xe9, 0xe8, 0xe8, 0x97, 0xff, 0xf0, 0xef, 0xbb, 0xba, 0xba, 0xbb, 0xbb, 0xee, 0xf0, 0xf1, 0xe7, 0xe7, 0xee, 0x90, 0x74, 0x2e, 0x4a, 0x52, 0x44, 0x52, 0x2f, 0x30, 0x2b, 0x1e, 0x10, 0x87, 0xf9, 0xbb, 0xb9, 0xba, 0xba, 0xb9, 0xee, 0xba, 0x94, 0x84, 0x2e, 0x44, 0x44, 0x47, 0x47, 0x4b, 0x62, 0x12, 0x01, 0xf7, 0x99, 0xbb, 0xee, 0xf0, 0xed, 0xf1, 0xe8, 0xe7, 0xb9, 0xe7, 0x94, 0x8c, 0x50, 0x1d, 0x5a, 0xbb, 0xf2, 0xe5, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xe7, 0xed, 0xf1, 0xf2, 0x94, 0xde, 0x25, 0x92, 0xf7, 0xe7, 0xee, 0xed, 0xf0, 0xed, 0xf0, 0xee, 0xee, 0xef, 0xf1, 0xf3, 0xec, 0x9c, 0x01, 0x1d, 0x6a, 0x54, 0x4b, 0x5c, 0x44, 0x46, 0x50, 0x91, 0xbb, 0xbb, 0xe8, 0xe8, 0xf2, 0xee, 0xb9, 0xf3, 0xbd, 0x02, 0x07, 0x10, 0x11, 0x1e, 0x64, 0x6a, 0x6a, 0x6a, 0x50, 0x7b, 0x94, 0xe7, 0xed, 0xf1, 0xe5, 0xb9, 0xed, 0xed, 0xf1, 0xed, 0xf1, 0xed, 0xed, 0xbb, 0xf0, 0xf8, 0xf1, 0xf1, 0xf0, 0xff, 0x92, 0x8f, 0x84, 0x76, 0x40, 0x24, 0x2a, 0x2b, 0x2f, 0x2a, 0x2d, 0x2d, 0x27, 0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x36, 0x36, 0x24, 0x2a, 0x2a, 0x30, 0x2b, 0x2f, 0x24, 0x36, 0x66, 0x83, 0x90, 0xfe, 0xfe, 0xe9, 0xe7, 0xe9, 0xf9, 0xff, 0xff, 0xf7, 0xf0, 0xbb, 0xbb, 0xbb, 0xbb, 0xee, 0xef, 0xf1, 0xf1, 0xe7, 0xe7, 0xf1, 0x90, 0x84, 0x40, 0x57, 0x41, 0x52, 0x44, 0x30, 0x2b, 0x2b, 0x23, 0x11, 0x5a, 0x94, 0xe5, 0xba, 0xba, 0xba, 0xee, 0xf8, 0xbb, 0xff, 0x84, 0x31, 0x44, 0x3b, 0x4b, 0x42, 0x56, 0x3b, 0x19, 0x01, 0xec, 0xf3, 0xed, 0xe8, 0xee, 0xee, 0xf0, 0xee, 0xe8, 0xe7, 0xb9, 0xf2, 0x91, 0x85, 0x18, 0xe1, 0xf2, 0xf1, 0xee, 0xe8, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xf1, 0xf1, 0xf0, 0xff, 0xf6, 0x97, 0xf1, 0xed, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xb9, 0xe8, 0xee, 0xf7, 0xf3, 0x1b, 0x95, 0x05, 0x3c, 0x54, 0x54, 0x4b, 0x3b, 0x52, 0x53, 0x39, 0x90, 0x99, 0x97, 0x97, 0xe8, 0xf0, 0xf2, 0xea, 0xdc, 0x01, 0x03, 0x10, 0x11, 0x11, 0x58, 0x64, 0x6e, 0x6a, 0x6a, 0x59, 0x84, 0xff, 0x97, 0xe6, 0xed, 0xe7, 0xe5, 0xe8, 0xed, 0xed, 0xf1, 0xed, 0xe8, 0xe8, 0xed, 0xf1, 0xee, 0xee, 0xe8, 0xbb, 0xbb, 0xe8, 0xf2, 0x94, 0x93, 0x90, 0x82, 0x6f, 0x36, 0x23, 0x2a, 0x2f, 0x38, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x37, 0x38, 0x37, 0x3b, 0x2a, 0x23, 0x24, 0x29, 0x61, 0x7e, 0x87, 0x92, 0xea, 0xf2, 0xf2, 0xf9, 0xe8, 0xe8, 0xe8, 0xee, 0xf8, 0xf0, 0xef, 0xef, 0xee, 0xf0, 0xee, 0xf1, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xe8, 0xe8, 0xfe, 0x8f, 0x6f, 0x43, 0x5c, 0x4b, 0x4e, 0x37, 0x30, 0x2a, 0x2f, 0x1a, 0x12, 0x8e, 0xff, 0xf7, 0xbb, 0xe5, 0xf8, 0xfe, 0xe7, 0x97, 0x84, 0x31, 0x55, 0x52, 0x46, 0x47, 0x49, 0x67, 0x29, 0x05, 0xb8, 0x94, 0xe8, 0xed, 0xe6, 0xe7, 0xee, 0xf1, 0xef, 0xef, 0xf1, 0xe6, 0x97, 0x92, 0x81, 0xe5, 0xe9, 0xf7, 0xf9, 0xe5, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xe7, 0xee, 0xf1, 0xf8, 0x99, 0xe5, 0xb9, 0xee, 0xed, 0xee, 0xee, 0xee, 0xe8, 0xb9, 0xbb, 0xb9, 0xf0, 0xe8, 0x94, 0xeb, 0x95, 0x08, 0x5b, 0x54, 0x54, 0x58, 0x3b, 0x58, 0x4e, 0x28, 0x8b, 0x99, 0x97, 0x97, 0xe8, 0xf0, 0xef, 0xea, 0xfb, 0x02, 0x07, 0x0e, 0x16, 0x23, 0x75, 0x6a, 0x6a, 0x6e, 0x63, 0x66, 0x86, 0xff, 0xe5, 0xbb, 0xee, 0xb9, 0xb9, 0xe7, 0xed, 0xed, 0xed, 0xe8, 0xee, 0xbb, 0xf1, 0xe7, 0xe7, 0xbb, 0xba, 0xbb, 0xe8, 0xe7, 0xe7, 0xe6, 0xb9, 0xf9, 0x93, 0x91, 0x8c, 0x84, 0x71, 0x4f, 0x40, 0x27, 0x27, 0x27, 0x24, 0x27, 0x24, 0x36, 0x2e, 0x36, 0x32, 0x61, 0x77, 0x82, 0x8f, 0x92, 0x94, 0xf2, 0xe8, 0xe9, 0xed, 0xed, 0xee, 0xbb, 0xba, 0xbb, 0xe7, 0xf1, 0xe8, 0xbb, 0xee, 0xf1, 0xf1, 0xf8, 0xf1, 0xee, 0xe7, 0xbb, 0x97, 0xbb, 0xbb, 0xb9, 0x99, 0x92, 0x7f, 0x4a, 0x67, 0x5c, 0x49, 0x37, 0x2b, 0x2f, 0x23, 0x23, 0x11, 0x7a, 0xff, 0xe5, 0xed, 0xed, 0xf8, 0xf1, 0xb9, 0x99, 0x82, 0x31, 0x55, 0x4e, 0x4b, 0x56, 0x56, 0x47, 0x51, 0x09, 0x14, 0xf3, 0xed, 0xe7, 0xb9, 0xe7, 0xee, 0xf0, 0xef, 0xf0, 0xf1, 0xe8, 0xe5, 0x97, 0xbb, 0xe7, 0xe7, 0xf1, 0xef, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xf3, 0xfc, 0x95, 0x0c, 0x51, 0x55, 0x5c, 0x3b, 0x5d, 0x44, 0x4e, 0x28, 0x88, 0x97, 0xf9, 0xee, 0xe8, 0xe8, 0xea, 0xdc, 0x04, 0x03, 0x0e, 0x16, 0x31, 0x75, 0x67, 0x6a, 0x6a, 0x6e, 0x5b, 0x70, 0x90, 0xee, 0xe7, 0xed, 0xf8, 0xb9, 0xe5, 0xb9, 0xe5, 0xe8, 0xee, 0xed, 0xef, 0xf7, 0xf0, 0xef, 0xee, 0xbb, 0xe8, 0xe5, 0xe8, 0xed, 0xe9, 0xee, 0xed, 0xf7, 0xf7, 0xf8, 0xff, 0x94, 0x94, 0xf9, 0x93, 0x8f, 0x8b, 0x83, 0x88, 0x83, 0x86, 0x86, 0x8d, 0x8f, 0x93, 0xf3, 0xf3, 0xea, 0xe4, 0xe3, 0x99, 0xbb, 0xbb, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0x99, 0xee, 0xef, 0xee, 0xe7, 0xe8, 0xf1, 0xf1, 0xf8, 0xed, 0xe9, 0xe7, 0xe7, 0xbb, 0xee, 0xe7, 0xe7, 0xf9, 0x92, 0x89, 0x66, 0x60, 0x63, 0x5c, 0x35, 0x2a, 0x23, 0x2f, 0x23, 0x16, 0x25, 0x94, 0xe7, 0xf7, 0xf0, 0xed, 0xed, 0xed, 0x97, 0x85, 0x31, 0x4b, 0x56, 0x45, 0x44, 0x47, 0x3d, 0x60, 0x0e, 0x14, 0x94, 0xe8, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xf0, 0xe8, 0xee, 0xee, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xe8, 0xf3, 0xfc, 0x00, 0x0c, 0x5b, 0x4e, 0x55, 0x4c, 0x53, 0x52, 0x4e, 0x28, 0x86, 0x97, 0xef, 0xf2, 0xe7, 0xee, 0xf3, 0xb8, 0x00, 0x07, 0x1d, 0x73, 0x75, 0x6a, 0x6e, 0x6e, 0x67, 0x6e, 0x51, 0x78, 0x90, 0xf8, 0xe6, 0xb9, 0xb9, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xe5, 0xe9, 0xf2, 0xe9, 0xea, 0xea, 0xf2, 0xf2, 0xe8, 0xe7, 0xed, 0xee, 0xed, 0xed, 0xe8, 0xed, 0xee, 0xee, 0xed, 0xe9, 0xe4, 0xe0, 0xe6, 0xb9, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xe9, 0xe7, 0xb9, 0xe2, 0xdf, 0xd0, 0xca, 0xe0, 0x99, 0xf2, 0xbb, 0xe8, 0xe8, 0xe8, 0xf2, 0xef, 0xee, 0xf0, 0xed, 0xee, 0xe8, 0xe8, 0xf2, 0xf2, 0xf7, 0xf9, 0xf7, 0xed, 0xef, 0xbb, 0xef, 0xf1, 0xf8, 0xf1, 0xe5, 0xef, 0x90, 0x7f, 0x59, 0x6b, 0x6e, 0x6a, 0x5d, 0x3b, 0x52, 0x23, 0x1d, 0x65, 0x99, 0xe5, 0xed, 0xf8, 0xe7, 0xed, 0xed, 0x94, 0x85, 0x2e, 0x4b, 0x45, 0x56, 0x4b, 0x47, 0x45, 0x5d, 0x0e, 0x14, 0xea, 0xee, 0xf0, 0xee, 0xed, 0xf0, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xf3, 0x14, 0x00, 0x0c, 0x5b, 0x55, 0x4b, 0x52, 0x53, 0x44, 0x5c, 0x28, 0x83, 0x97, 0xef, 0xee, 0xe7, 0xe8, 0xf9, 0xfd, 0x34, 0x25, 0x7c, 0x6b, 0x6a, 0x67, 0x6e, 0x67, 0x6a, 0x6e, 0x48, 0x84, 0x90, 0xf0, 0xb9, 0xb9, 0xba, 0xf7, 0xf7, 0xf0, 0xf7, 0xed, 0xe7, 0xea, 0xea, 0xe3, 0xdd, 0xda, 0xd0, 0xdb, 0xdd, 0xea, 0xea, 0xe8, 0xf2, 0xe5, 0xe6, 0xe5, 0xe7, 0xe5, 0xe8, 0xe6, 0xe8, 0xe0, 0xc4, 0xb7, 0xc7, 0xc9, 0xcc, 0xcc, 0xcc, 0xcc, 0xc9, 0xc9, 0xc6, 0xc3, 0xc0, 0xa9, 0xcd, 0xe9, 0xed, 0xf2, 0xf0, 0xbb, 0xba, 0xbb, 0xef, 0xee, 0xf0, 0xee, 0xea, 0xf3, 0xf3, 0x99, 0xbb, 0xf3, 0xf3, 0xf2, 0xf7, 0xf9, 0xf7, 0x99, 0xb9, 0xf0, 0xf8, 0xf8, 0xe7, 0xba, 0x93, 0x85, 0x48, 0x64, 0x6a, 0x67, 0x67, 0x6e, 0x58, 0x73, 0x8c, 0x99, 0xb9, 0xb9, 0xf7, 0xf8, 0xe7, 0xed, 0xed, 0x97, 0x85, 0x31, 0x52, 0x55, 0x45, 0x4b, 0x47, 0x56, 0x58, 0x11, 0x1c, 0x94, 0xe7, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xbb, 0xf2, 0x34, 0x00, 0x09, 0x3c, 0x5c, 0x55, 0x52, 0x4e, 0x52, 0x4e, 0x28, 0x83, 0x97, 0xef, 0xf2, 0xe7, 0xef, 0xbb, 0xbb, 0xf3, 0x8d, 0x5e, 0x6e, 0x67, 0x67, 0x67, 0x67, 0x6e, 0x51, 0x71, 0x90, 0xed, 0xb9, 0xb9, 0xe5, 0xe5, 0xee, 0xf7, 0xed, 0xf1, 0xe9, 0xe9, 0xdb, 0xc3, 0xa2, 0xa0, 0xa0, 0xa0, 0x9d, 0x9d, 0xa2, 0xca, 0xe7, 0xe8, 0xe7, 0xed, 0xe7, 0xe5, 0xe7, 0xb9, 0xe6, 0xe7, 0xe6, 0xc8, 0xac, 0xb2, 0xac, 0xac, 0xbe, 0xac, 0xac, 0xac, 0xac, 0xac, 0xb5, 0xbe, 0xc0, 0xe2, 0xe7, 0xed, 0xf0, 0xf0, 0xbb, 0xba, 0xbb, 0xee, 0xe8, 0xe9, 0xea, 0xe0, 0xcd, 0xa6, 0xa1, 0xa0, 0xa3, 0xca, 0xe4, 0xf3, 0xe5, 0x97, 0xef, 0xe7, 0xf1, 0xf8, 0xf1, 0xb9, 0xba, 0xff, 0x8f, 0x68, 0x48, 0x60, 0x6e, 0x6a, 0x63, 0x48, 0x78, 0x87, 0xe6, 0xb9, 0xe5, 0xed, 0xf8, 0xe6, 0xed, 0xf7, 0x94, 0x85, 0x2e, 0x3f, 0x55, 0x47, 0x56, 0x47, 0x56, 0x53, 0x0e, 0x5a, 0xea, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xef, 0xe5, 0xf3, 0x65, 0x00, 0x07, 0x40, 0x53, 0x4e, 0x4b, 0x5c, 0x4b, 0x5c, 0x28, 0x83, 0xf9, 0x97, 0xee, 0xe7, 0xe8, 0x99, 0xbb, 0xe4, 0x72, 0x7f, 0x48, 0x6a, 0x67, 0x6a, 0x6e, 0x39, 0x5e, 0x88, 0xf9, 0xba, 0xe3, 0xb9, 0xee, 0xf8, 0xee, 0xe8, 0xe6, 0xe9, 0xe2, 0xc4, 0xa4, 0xa4, 0xa7, 0xaa, 0xaa, 0xaa, 0xa7, 0xa7, 0xa2, 0x9d, 0xa6, 0xe3, 0xe8, 0xe7, 0xee, 0xe5, 0xed, 0xed, 0xe7, 0xe6, 0xe6, 0xce, 0xac, 0xc1, 0xb6, 0xb6, 0xc1, 0xc1, 0xb6, 0xc1, 0xb6, 0xaf, 0xb0, 0xc1, 0xc6, 0xe6, 0xe7, 0x99, 0xef, 0xf2, 0xbb, 0x97, 0xef, 0xe8, 0xea, 0xe3, 0xcb, 0xa2, 0xa0, 0xa2, 0xa2, 0xa2, 0xa0, 0x9d, 0xa6, 0xe4, 0xe7, 0xee, 0xf7, 0xf8, 0xf8, 0xf8, 0xed, 0xbb, 0xbb, 0xff, 0x92, 0x88, 0x61, 0x26, 0x40, 0x40, 0x50, 0x71, 0x83, 0xf5, 0xec, 0xe9, 0xb9, 0xf7, 0xf8, 0xe7, 0xed, 0xed, 0x97, 0x89, 0x31, 0x52, 0x49, 0x56, 0x45, 0x47, 0x56, 0x3e, 0x0e, 0x72, 0x94, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xea, 0xfd, 0x04, 0x03, 0x20, 0x53, 0x5c, 0x53, 0x55, 0x52, 0x5c, 0x28, 0x83, 0x94, 0xee, 0xf2, 0xe8, 0xee, 0x99, 0xe9, 0xe0, 0xc5, 0x8a, 0x70, 0x32, 0x50, 0x6f, 0x70, 0x84, 0x8d, 0x90, 0x92, 0xff, 0x94, 0xf0, 0xee, 0xed, 0xe5, 0xe7, 0xe7, 0xdb, 0xa7, 0xa7, 0xaa, 0xaf, 0xad, 0xaf, 0xaf, 0xaf, 0xb3, 0xb4, 0xb6, 0xab, 0xa2, 0xa4, 0xe3, 0xe7, 0xed, 0xf7, 0xf1, 0xed, 0xed, 0xe6, 0xea, 0xd5, 0xbe, 0xb1, 0xb4, 0xc1, 0xb4, 0xb2, 0xb4, 0xb1, 0xb4, 0xc1, 0xc1, 0xbf, 0xce, 0xea, 0xef, 0x97, 0x97, 0xba, 0xf9, 0xee, 0xe7, 0xf2, 0xd5, 0xa4, 0xa4, 0xab, 0xae, 0xae, 0xb4, 0xb4, 0xab, 0xaa, 0xa2, 0xbf, 0xf2, 0xe7, 0xf0, 0xf8, 0xf7, 0x97, 0x94, 0x91, 0x8c, 0x83, 0x8b, 0x91, 0x8f, 0x8c, 0x8c, 0x8d, 0x8f, 0xf9, 0xde, 0x9d, 0xdc, 0xea, 0xbb, 0xed, 0xf8, 0xe6, 0xed, 0xee, 0xff, 0x89, 0x2e, 0x3f, 0x55, 0x55, 0x45, 0x56, 0x5c, 0x2a, 0x0e, 0x87, 0xea, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xed, 0x94, 0xbd, 0x01, 0x19, 0x4a, 0x52, 0x4b, 0x4e, 0x4b, 0x5c, 0x28, 0x83, 0x97, 0xef, 0xee, 0xe7, 0xe8, 0xf0, 0xe9, 0xe2, 0xbf, 0xe3, 0x8f, 0x86, 0x89, 0x8c, 0x8f, 0x8d, 0x8d, 0x86, 0x6d, 0x70, 0x8c, 0x8f, 0xfe, 0xed, 0xe5, 0xe6, 0xdf, 0xa9, 0xaa, 0xb3, 0xaa, 0xaf, 0xad, 0xad, 0xad, 0xaf, 0xad, 0xaf, 0xad, 0xb4, 0xb1, 0xa4, 0xc8, 0xea, 0xe6, 0xf1, 0xed, 0xf8, 0xed, 0xe5, 0xea, 0xdd, 0xaa, 0xb4, 0xb2, 0xae, 0xb3, 0xb3, 0xae, 0xb4, 0xae, 0xb4, 0xb6, 0xa9, 0xdb, 0xea, 0xef, 0x97, 0xbb, 0xbb, 0xe7, 0xe8, 0xe7, 0xce, 0xa6, 0xb1, 0xae, 0xb3, 0xad, 0xae, 0xae, 0xaf, 0xb5, 0xb3, 0xb4, 0xa6, 0xdf, 0xf2, 0xe7, 0xba, 0xba, 0x94, 0x8e, 0x70, 0x50, 0x40, 0x6f, 0x78, 0x82, 0x88, 0x8c, 0x8c, 0x88, 0x97, 0xdf, 0xa0, 0xdb, 0x99, 0xe7, 0xf7, 0xf8, 0xe5, 0xe7, 0xf7, 0x97, 0x89, 0x31, 0x4b, 0x55, 0x55, 0x45, 0x4b, 0x67, 0x1a, 0x12, 0x92, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xbb, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xe5, 0xf3, 0xb8, 0x96, 0x10, 0x6e, 0x3f, 0x52, 0x55, 0x4b, 0x5c, 0x28, 0x83, 0xf9, 0xef, 0xf2, 0xe7, 0xef, 0xf0, 0xea, 0xdf, 0xbf, 0xe2, 0x92, 0x85, 0x84, 0x84, 0x77, 0x70, 0x71, 0x66, 0x59, 0x39, 0x21, 0x71, 0x8f, 0xfe, 0xed, 0xe6, 0xc8, 0xaa, 0xad, 0xad, 0xaf, 0xac, 0xac, 0xae, 0xae, 0xad, 0xae, 0xaf, 0xb4, 0xb2, 0xb1, 0xb0, 0xa6, 0xe2, 0xe7, 0xe6, 0xed, 0xed, 0xf0, 0xe5, 0xf2, 0xdf, 0xac, 0xb1, 0xae, 0xae, 0xb2, 0xb3, 0xb2, 0xae, 0xb2, 0xac, 0xc1, 0xbf, 0xdd, 0xe9, 0xf7, 0xff, 0xee, 0xe7, 0xe6, 0xe9, 0xc8, 0xa9, 0xae, 0xad, 0xaf, 0xb2, 0xae, 0xb0, 0xb0, 0xaf, 0xb3, 0xb3, 0xb2, 0xa9, 0xdd, 0xf2, 0xbb, 0x99, 0x93, 0x7a, 0x33, 0x2e, 0x6b, 0x6e, 0x73, 0x7d, 0x7c, 0x7c, 0x76, 0x66, 0x3a, 0x87, 0xdf, 0xa0, 0xda, 0xf2, 0xbb, 0xed, 0xf8, 0xe6, 0xed, 0xee, 0xff, 0x89, 0x2e, 0x4b, 0x55, 0x55, 0x4b, 0x52, 0x6a, 0x16, 0x22, 0xf3, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xf2, 0xea, 0xfd, 0x01, 0x09, 0x60, 0x4c, 0x46, 0x5c, 0x4b, 0x4e, 0x28, 0x83, 0x97, 0xef, 0xe8, 0xe8, 0xe8, 0xff, 0xf2, 0xdf, 0xbf, 0xfd, 0x83, 0x1f, 0x48, 0x39, 0x73, 0x73, 0x73, 0x75, 0x7d, 0x75, 0x64, 0x2c, 0x3a, 0x83, 0xf8, 0xe0, 0xc3, 0xac, 0xad, 0xad, 0xad, 0xad, 0xc0, 0xc0, 0xc1, 0xc1, 0xb0, 0xb0, 0xb0, 0xad, 0xb0, 0xc1, 0xab, 0xdf, 0xe7, 0xe6, 0xe5, 0xed, 0xed, 0xbb, 0xbb, 0xe3, 0xc0, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb1, 0xb1, 0xaf, 0xac, 0xc3, 0xdd, 0xf2, 0xf0, 0xff, 0xed, 0xe9, 0xe6, 0xd0, 0xa9, 0xae, 0xad, 0xaf, 0xaf, 0xb0, 0xc1, 0xc1, 0xb0, 0xaf, 0xaf, 0xaf, 0xb4, 0xa9, 0xe2, 0xba, 0xfe, 0x8b, 0x4d, 0x1f, 0x4a, 0x6e, 0x6b, 0x7d, 0x7c, 0x7d, 0x73, 0x35, 0x2f, 0x37, 0x31, 0x84, 0xde, 0xa1, 0xdb, 0xea, 0xb9, 0xf7, 0xf8, 0xe5, 0xe7, 0xf7, 0x97, 0x89, 0x31, 0x4b, 0x55, 0x49, 0x4b, 0x53, 0x58, 0x11, 0x72, 0x99, 0xee, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xed, 0xf3, 0xf5, 0x03, 0x3c, 0x53, 0x4e, 0x5c, 0x54, 0x5c, 0x2d, 0x80, 0xf9, 0xe9, 0xe8, 0xbb, 0xbb, 0xf9, 0xbb, 0xdd, 0xa9, 0xe3, 0x80, 0x24, 0x35, 0x35, 0x43, 0x6e, 0x7d, 0x7d, 0x75, 0x7d, 0x73, 0x73, 0x40, 0x40, 0x89, 0xbb, 0xc7, 0xaa, 0xad, 0xac, 0xad, 0xad, 0xaf, 0xac, 0xc1, 0xac, 0xb0, 0xb0, 0xb0, 0xb0, 0xc1, 0xae, 0xbf, 0xdb, 0xe6, 0xe6, 0xe7, 0xe5, 0xb9, 0xe5, 0xbb, 0xe6, 0xc3, 0xc0, 0xc0, 0xc1, 0xb2, 0xb0, 0xb1, 0xc1, 0xb1, 0xc1, 0xb1, 0xbf, 0xdd, 0xea, 0xed, 0xf8, 0xf1, 0xea, 0xdb, 0xaa, 0xb1, 0xac, 0xaf, 0xaf, 0xaf, 0xb0, 0xb0, 0xb0, 0xaf, 0xaf, 0xaf, 0xae, 0xae, 0xbf, 0xb9, 0xff, 0x8b, 0x40, 0x21, 0x69, 0x6b, 0x7d, 0x7d, 0x7d, 0x7d, 0x73, 0x49, 0x38, 0x44, 0x42, 0x35, 0x84, 0xde, 0xa2, 0xdb, 0xf2, 0xe6, 0xed, 0xf8, 0xba, 0xed, 0xe7, 0xf0, 0x89, 0x2e, 0x52, 0x4b, 0x5c, 0x55, 0x5c, 0x2e, 0x15, 0x8e, 0xb9, 0xed, 0xf8, 0xf8, 0xf9, 0xe5, 0xba, 0xba, 0xed, 0xf8, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xed, 0xf7, 0xee, 0xf7, 0xed, 0xf1, 0xea, 0xdc, 0x96, 0x19, 0x58, 0x54, 0x46, 0x54, 0x4b, 0x36, 0x80, 0xf8, 0xe9, 0xe8, 0xff, 0xef, 0xff, 0xea, 0xdb, 0xa7, 0xe0, 0x8c, 0x21, 0x35, 0x3e, 0x3e, 0x3e, 0x31, 0x60, 0x73, 0x7d, 0x7d, 0x7d, 0x7d, 0x48, 0x33, 0x90, 0xdd, 0xaa, 0xac, 0xac, 0xb0, 0xad, 0xae, 0xad, 0xac, 0xb0, 0xb0, 0xae, 0xb0, 0xb2, 0xb0, 0xb0, 0xab, 0xd5, 0xf2, 0xe6, 0xee, 0xed, 0xe8, 0xe8, 0xf2, 0xe3, 0xb6, 0xc0, 0xb1, 0xae, 0xae, 0xae, 0xb2, 0xb1, 0xb1, 0xc1, 0xb1, 0xab, 0xce, 0xe6, 0xe9, 0xe6, 0xea, 0xe3, 0xc0, 0xbe, 0xc1, 0xac, 0xb5, 0xae, 0xae, 0xb3, 0xae, 0xaf, 0xb0, 0xb3, 0xae, 0xaf, 0xab, 0xc7, 0xea, 0x91, 0x68, 0x69, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x75, 0x75, 0x63, 0x49, 0x4b, 0x44, 0x47, 0x2e, 0x85, 0xdb, 0xa4, 0xdd, 0xea, 0xe6, 0xf1, 0xf8, 0xba, 0xe8, 0xf1, 0xf1, 0x89, 0x2d, 0x3b, 0x52, 0x56, 0x4b, 0x64, 0x16, 0x72, 0x94, 0xe7, 0xe7, 0xe7, 0xf8, 0xf7, 0xef, 0xb9, 0xba, 0xbb, 0xf7, 0xf0, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xf0, 0xed, 0xf0, 0xee, 0xed, 0xef, 0xf0, 0xee, 0xef, 0xef, 0xf1, 0xf1, 0xbb, 0x08, 0x10, 0x60, 0x42, 0x67, 0x46, 0x58, 0x27, 0x80, 0xf8, 0xe9, 0xf1, 0xff, 0xf8, 0xf8, 0xe9, 0xda, 0xa7, 0xdd, 0x91, 0x1f, 0x2d, 0x38, 0x38, 0x3e, 0x53, 0x4a, 0x43, 0x43, 0x6b, 0x7d, 0x7d, 0x7d, 0x59, 0x70, 0x94, 0xc4, 0xbe, 0xad, 0xad, 0xac, 0xb1, 0xac, 0xb0, 0xac, 0xb0, 0xb0, 0xb0, 0xb0, 0xae, 0xb0, 0xa9, 0xce, 0xe9, 0xe5, 0xf7, 0xff, 0xe5, 0xed, 0xe9, 0xe2, 0xa9, 0xc0, 0xb1, 0xb1, 0xae, 0xb2, 0xb2, 0xb1, 0xc1, 0xb0, 0xb2, 0xb1, 0xab, 0xd0, 0xdf, 0xe3, 0xda, 0xc4, 0xbe, 0xc0, 0xc1, 0xb0, 0xad, 0xae, 0xaf, 0xb0, 0xae, 0xb0, 0xb0, 0xc1, 0xb2, 0xb3, 0xac, 0xc3, 0xf3, 0x80, 0x66, 0x7d, 0x7d, 0x75, 0x7d, 0x6b, 0x5d, 0x60, 0x6e, 0x3e, 0x49, 0x4b, 0x47, 0x45, 0x43, 0x8c, 0xda, 0xa4, 0xe0, 0xe9, 0xed, 0xf1, 0xfe, 0xba, 0xed, 0xf1, 0xff, 0x89, 0x2d, 0x52, 0x56, 0x5c, 0x3e, 0x5b, 0x17, 0xfe, 0xe6, 0xdd, 0xdf, 0xe6, 0xe9, 0xed, 0xee, 0xe8, 0xbb, 0xee, 0xef, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf7, 0xed, 0xe7, 0xea, 0x65, 0x07, 0x6c, 0x46, 0x47, 0x4e, 0x58, 0x27, 0x7b, 0x93, 0xe9, 0xe8, 0xf8, 0xf1, 0xea, 0xe9, 0xcf, 0xa7, 0xcd, 0xf3, 0x5f, 0x23, 0x3f, 0x45, 0x4b, 0x3e, 0x53, 0x53, 0x4a, 0x4a, 0x31, 0x31, 0x58, 0x60, 0x24, 0x84, 0xec, 0xbf, 0xad, 0xad, 0xc1, 0xac, 0xc1, 0xae, 0xb0, 0xb2, 0xb2, 0xb2, 0xb0, 0xb0, 0xb2, 0xc0, 0xc4, 0xe3, 0xed, 0xf7, 0xf7, 0xe5, 0xe9, 0xe6, 0xce, 0xbe, 0xb6, 0xb1, 0xae, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb3, 0xad, 0xad, 0xae, 0xab, 0xa9, 0xa9, 0xaa, 0xab, 0xb2, 0xac, 0xb4, 0xc1, 0xb0, 0xb0, 0xae, 0xb3, 0xae, 0xb3, 0xc1, 0xb1, 0xc1, 0xb0, 0xac, 0xc8, 0x92, 0x76, 0x7d, 0x75, 0x75, 0x63, 0x3e, 0x53, 0x5d, 0x6e, 0x5c, 0x35, 0x4e, 0x47, 0x56, 0x45, 0x59, 0x92, 0xcc, 0xa9, 0xe2, 0xf2, 0xe6, 0xf1, 0xf8, 0xba, 0xef, 0xf1, 0xf8, 0x89, 0x2f, 0x4b, 0x47, 0x5c, 0x6c, 0x1d, 0xe1, 0xe2, 0xcc, 0xcf, 0xcf, 0xd0, 0xdf, 0xe9, 0xf1, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0x99, 0xed, 0xe6, 0xe9, 0xe9, 0x0c, 0x33, 0x4c, 0x45, 0x4e, 0x52, 0x2d, 0x7b, 0xf8, 0xe7, 0xe7, 0xea, 0xe9, 0xe2, 0xce, 0xb1, 0xb3, 0xc3, 0xf2, 0x7e, 0x1f, 0x47, 0x49, 0x4b, 0x4b, 0x4b, 0x3f, 0x53, 0x3f, 0x53, 0x58, 0x35, 0x2f, 0x2b, 0x48, 0x8d, 0xc8, 0xad, 0xad, 0xae, 0xb2, 0xae, 0xb0, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xb0, 0xb4, 0xa9, 0xda, 0xe9, 0xe8, 0xe5, 0xe7, 0xe7, 0xdb, 0xbf, 0xc0, 0xb1, 0xc1, 0xb4, 0xae, 0xb2, 0xb1, 0xb2, 0xb1, 0xb0, 0xae, 0xae, 0xad, 0xb1, 0xac, 0xc0, 0xb2, 0xaf, 0xb2, 0xc1, 0xac, 0xac, 0xae, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xae, 0xb0, 0xb0, 0xb0, 0xaa, 0xdb, 0x8c, 0x69, 0x6a, 0x5d, 0x53, 0x53, 0x5d, 0x5c, 0x6a, 0x5c, 0x37, 0x4e, 0x4e, 0x56, 0x4e, 0x38, 0x68, 0x94, 0xb7, 0xc3, 0xe6, 0xe9, 0xe7, 0xe7, 0xed, 0xb9, 0xb9, 0xf1, 0xff, 0x89, 0x31, 0x56, 0x55, 0x53, 0x36, 0x65, 0xba, 0xcc, 0xd1, 0xd3, 0xd3, 0xcf, 0xd5, 0xe2, 0xe9, 0xf1, 0xef, 0xed, 0xbb, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xed, 0xe7, 0xe7, 0xe5, 0xe7, 0xe9, 0xe3, 0xdf, 0xe0, 0xec, 0x6d, 0x66, 0x35, 0x53, 0x45, 0x3e, 0x78, 0x93, 0xe9, 0xe3, 0xdd, 0xc8, 0xab, 0xaa, 0xad, 0xb3, 0xab, 0xda, 0x90, 0x32, 0x30, 0x42, 0x4b, 0x4e, 0x5c, 0x52, 0x4e, 0x4b, 0x3f, 0x46, 0x52, 0x30, 0x3d, 0x23, 0x74, 0xde, 0xaa, 0xaf, 0xad, 0xaf, 0xae, 0xb0, 0xb2, 0xb2, 0xb2, 0xb0, 0xac, 0xb2, 0xb0, 0xad, 0xc1, 0xbf, 0xda, 0xe3, 0xe6, 0xdf, 0xcc, 0xa9, 0xc0, 0xb4, 0xc1, 0xb1, 0xb2, 0xb1, 0xae, 0xac, 0xae, 0xb1, 0xc1, 0xc1, 0xae, 0xae, 0xb2, 0xb1, 0xc1, 0xb0, 0xad, 0xb3, 0xc1, 0xb2, 0xc1, 0xb2, 0xb0, 0xae, 0xae, 0xb2, 0xad, 0xb3, 0xaf, 0xad, 0xad, 0xc3, 0xfd, 0x74, 0x43, 0x5c, 0x5c, 0x5c, 0x53, 0x5c, 0x6a, 0x5c, 0x4e, 0x42, 0x5c, 0x4e, 0x4e, 0x52, 0x28, 0x89, 0xb9, 0xaa, 0xb4, 0xe2, 0xe6, 0xe6, 0xe9, 0xe9, 0xb9, 0xe7, 0xe9, 0xea, 0x86, 0x2d, 0x56, 0x46, 0x62, 0x4d, 0xf8, 0xd5, 0xcf, 0xd3, 0xd3, 0xd3, 0xd3, 0xd1, 0xda, 0xf1, 0xe9, 0xf8, 0xee, 0xbb, 0xed, 0xee, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xef, 0xf7, 0xee, 0xed, 0xee, 0xe7, 0xe5, 0xe9, 0xe6, 0xe6, 0xdd, 0xd5, 0xd5, 0xd5, 0xdb, 0xfd, 0x7b, 0x39, 0x46, 0x5c, 0x3e, 0x76, 0xf8, 0xda, 0xb7, 0xaa, 0xaa, 0xad, 0xaf, 0xad, 0xad, 0xac, 0xc3, 0xf2, 0x7e, 0x1e, 0x53, 0x46, 0x3f, 0x4b, 0x5c, 0x5c, 0x52, 0x46, 0x3f, 0x53, 0x52, 0x37, 0x30, 0x1f, 0x88, 0xcb, 0xbe, 0xaf, 0xad, 0xb2, 0xc1, 0xae, 0xb0, 0xb0, 0xac, 0xb0, 0xae, 0xc1, 0xaf, 0xae, 0xbe, 0xc3, 0xc3, 0xc8, 0xb1, 0xab, 0xb4, 0xb1, 0xb1, 0xae, 0xb2, 0xac, 0xb2, 0xac, 0xb2, 0xac, 0xb1, 0xc0, 0xb1, 0xae, 0xae, 0xae, 0xc1, 0xc1, 0xb0, 0xb0, 0xae, 0xb2, 0xb0, 0xb2, 0xc1, 0xc1, 0xb0, 0xb0, 0xb2, 0xae, 0xaf, 0xaf, 0xaf, 0xaa, 0xb8, 0x90, 0x26, 0x58, 0x4e, 0x5c, 0x46, 0x5c, 0x6a, 0x5c, 0x42, 0x4e, 0x4e, 0x5c, 0x5c, 0x5c, 0x43, 0x3a, 0x94, 0xda, 0xaa, 0xac, 0xc3, 0xc8, 0xc8, 0xc8, 0xcb, 0xc9, 0xcd, 0xce, 0xdb, 0x87, 0x39, 0x4b, 0x43, 0x33, 0x8b, 0xdd, 0xcf, 0xd3, 0xd3, 0xd8, 0xd3, 0xd3, 0xd2, 0xd0, 0xe2, 0xe9, 0xf0, 0xee, 0xba, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xe7, 0xe7, 0xe7, 0xe9, 0xe3, 0xdb, 0xd2, 0xd5, 0xd6, 0xd6, 0xd1, 0xd5, 0x91, 0x5e, 0x31, 0x52, 0x4a, 0x68, 0x81, 0xa9, 0xa7, 0xae, 0xac, 0xaf, 0xad, 0xae, 0xc1, 0xb0, 0xaa, 0xdb, 0x93, 0x3a, 0x24, 0x53, 0x35, 0x3f, 0x4b, 0x52, 0x5c, 0x52, 0x53, 0x46, 0x5d, 0x52, 0x30, 0x1e, 0x4f, 0xec, 0xbf, 0xae, 0xaf, 0xb2, 0xb0, 0xb0, 0xb0, 0xb2, 0xb0, 0xae, 0xac, 0xb0, 0xae, 0xae, 0xb4, 0xc0, 0xc0, 0xbe, 0xac, 0xb4, 0xae, 0xb1, 0xae, 0xc1, 0xac, 0xb1, 0xac, 0xb2, 0xac, 0xb2, 0xac, 0xc0, 0xb1, 0xae, 0xaf, 0xae, 0xc1, 0xb1, 0xc1, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xc1, 0xc1, 0xb2, 0xb0, 0xae, 0xb4, 0xac, 0xaf, 0xaf, 0xa9, 0x81, 0x78, 0x31, 0x52, 0x5c, 0x53, 0x4e, 0x6a, 0x5c, 0x46, 0x4b, 0x4e, 0x4b, 0x4e, 0x54, 0x53, 0x2c, 0x85, 0xe8, 0xc6, 0xaa, 0xaf, 0xaa, 0xac, 0xaa, 0xbe, 0xa9, 0xaa, 0xaa, 0xa9, 0xc3, 0x81, 0x5b, 0x58, 0x26, 0x83, 0xe0, 0xcc, 0xd3, 0xd3, 0xd2, 0xd8, 0xd3, 0xd2, 0xd3, 0xd1, 0xdf, 0xe9, 0xf1, 0xee, 0xbb, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf7, 0xef, 0xed, 0xed, 0xed, 0xe7, 0xe7, 0xe4, 0xdb, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd3, 0xd1, 0xdc, 0x89, 0x48, 0x2f, 0x4a, 0x4d, 0x81, 0xa9, 0xae, 0xad, 0xaf, 0xad, 0xae, 0xc0, 0xc0, 0xad, 0xad, 0xb7, 0xe5, 0x86, 0x2c, 0x35, 0x3e, 0x3e, 0x46, 0x3f, 0x4e, 0x53, 0x53, 0x53, 0x46, 0x58, 0x44, 0x30, 0x1a, 0x7e, 0xcb, 0xab, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb0, 0xac, 0xb0, 0xb0, 0xb0, 0xae, 0xae, 0xc1, 0xc1, 0xc1, 0xb0, 0xaf, 0xb3, 0xac, 0xb1, 0xad, 0xae, 0xae, 0xae, 0xb1, 0xae, 0xb1, 0xae, 0xb1, 0xb1, 0xb2, 0xad, 0xaf, 0xae, 0xae, 0xb1, 0xb1, 0xb1, 0xaf, 0xb0, 0xae, 0xc1, 0xc1, 0xb1, 0xc1, 0xb0, 0xb3, 0xc0, 0xac, 0xaf, 0xaa, 0xcb, 0x89, 0x36, 0x4e, 0x4e, 0x3e, 0x4e, 0x6a, 0x5d, 0x46, 0x3f, 0x53, 0x3f, 0x52, 0x53, 0x54, 0x3e, 0x76, 0x93, 0xd0, 0xa9, 0xad, 0xaf, 0xad, 0xad, 0xad, 0xc1, 0xad, 0xad, 0xad, 0xbe, 0xbf, 0xdc, 0x66, 0x39, 0x77, 0xf6, 0xcd, 0xd3, 0xd3, 0xd3, 0xd2, 0xd4, 0xd6, 0xd3, 0xd2, 0xcf, 0xdf, 0xe9, 0xf0, 0xed, 0xbb, 0xe8, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xe9, 0xe7, 0xdd, 0xd0, 0xd9, 0xd9, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd0, 0xfd, 0x83, 0x21, 0x39, 0x61, 0xde, 0xbf, 0xbe, 0xac, 0xad, 0xad, 0xae, 0xc0, 0xc1, 0xb0, 0xaf, 0xaa, 0xd0, 0xf3, 0x77, 0x1e, 0x4a, 0x3e, 0x4b, 0x44, 0x4b, 0x53, 0x5d, 0x5d, 0x5d, 0x41, 0x58, 0x37, 0x23, 0x4d, 0x65, 0xab, 0xc1, 0xb0, 0xc1, 0xb1, 0xb2, 0xae, 0xc1, 0xc1, 0xb0, 0xc1, 0xac, 0xb2, 0xc1, 0xc1, 0xc1, 0xb0, 0xb0, 0xb0, 0xb2, 0xb1, 0xae, 0xc1, 0xac, 0xc1, 0xc1, 0xc1, 0xc1, 0xac, 0xc1, 0xb1, 0xc1, 0xae, 0xae, 0xae, 0xb0, 0xb1, 0xac, 0xb1, 0xb0, 0xae, 0xb3, 0xaf, 0xae, 0xb2, 0xb1, 0xb0, 0xae, 0xb3, 0xad, 0xaf, 0xaa, 0xec, 0x68, 0x2a, 0x4e, 0x42, 0x53, 0x67, 0x5c, 0x45, 0x46, 0x4b, 0x46, 0x4e, 0x53, 0x52, 0x53, 0x48, 0x8c, 0xf3, 0xbf, 0xac, 0xad, 0xad, 0xaf, 0xad, 0xaf, 0xc1, 0xc1, 0xad, 0xaf, 0xad, 0xc0, 0xd7, 0x6d, 0x4d, 0x91, 0xd5, 0xcc, 0xd3, 0xd3, 0xd1, 0xd8, 0xd1, 0xd8, 0xd1, 0xd4, 0xd0, 0xdf, 0xe9, 0xed, 0xf0, 0xef, 0xed, 0xbb, 0xed, 0xbb, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xed, 0xef, 0xf7, 0xe8, 0xe3, 0xd6, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd9, 0xd1, 0xd1, 0xe6, 0x78, 0x1f, 0x70, 0xec, 0xa9, 0xc0, 0xc1, 0xad, 0xad, 0xc1, 0xc0, 0xc1, 0xad, 0xaf, 0xad, 0xa9, 0xe2, 0x94, 0x71, 0x1f, 0x4a, 0x3d, 0x47, 0x47, 0x46, 0x53, 0x53, 0x52, 0x4a, 0x60, 0x4e, 0x30, 0x21, 0x80, 0xc5, 0xbe, 0xc1, 0xc1, 0xae, 0xb2, 0xb1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb0, 0xac, 0xc1, 0xb0, 0xac, 0xc1, 0xac, 0xc1, 0xc1, 0xac, 0xc1, 0xb0, 0xc1, 0xc1, 0xb0, 0xac, 0xb0, 0xc1, 0xac, 0xb0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb0, 0xc1, 0xb0, 0xb1, 0xb0, 0xae, 0xae, 0xae, 0xb1, 0xb1, 0xb1, 0xae, 0xad, 0xaf, 0xaa, 0xca, 0x86, 0x1e, 0x52, 0x30, 0x53, 0x67, 0x55, 0x4e, 0x46, 0x3f, 0x46, 0x5c, 0x4e, 0x5c, 0x4a, 0x48, 0x84, 0xea, 0xcd, 0xaa, 0xad, 0xac, 0xac, 0xad, 0xad, 0xac, 0xc0, 0xac, 0xaf, 0xaf, 0xaf, 0xbf, 0xc4, 0xfd, 0x8e, 0xdd, 0xcb, 0xd3, 0xd3, 0xd4, 0xd6, 0xd4, 0xd2, 0xd3, 0xcf, 0xd6, 0xd0, 0xe3, 0xe7, 0xe8, 0xf0, 0xf7, 0xe8, 0xe5, 0xbb, 0xed, 0xe8, 0xbb, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xe8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xf0, 0xf7, 0xe9, 0xe2, 0xd5, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd1, 0xd7, 0x90, 0x33, 0x6d, 0xdc, 0xaa, 0xc0, 0xc1, 0xad, 0xaf, 0xac, 0xb1, 0xc0, 0xad, 0xaf, 0xad, 0xab, 0xc8, 0xe4, 0x90, 0x70, 0x21, 0x3e, 0x42, 0x45, 0x4b, 0x46, 0x46, 0x5c, 0x5c, 0x5d, 0x5d, 0x4e, 0x1e, 0x3a, 0xdc, 0xbf, 0xb0, 0xb0, 0xb0, 0xae, 0xb0, 0xc1, 0xc1, 0xc1, 0xae, 0xb0, 0xc1, 0xac, 0xc1, 0xc1, 0xb0, 0xc1, 0xb0, 0xac, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xb0, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xb1, 0xc1, 0xb1, 0xc1, 0xb1, 0xc1, 0xb1, 0xc1, 0xb0, 0xb0, 0xb4, 0xbf, 0xec, 0x5e, 0x31, 0x35, 0x4c, 0x6a, 0x54, 0x46, 0x3e, 0x52, 0x4b, 0x4e, 0x47, 0x5d, 0x41, 0x2d, 0x7e, 0x93, 0xdd, 0xa9, 0xad, 0xad, 0xac, 0xac, 0xad, 0xad, 0xad, 0xc1, 0xc0, 0xad, 0xaf, 0xaf, 0xb1, 0xbf, 0xe3, 0xe9, 0xcd, 0xd1, 0xd2, 0xd1, 0xd6, 0xd1, 0xd3, 0xd3, 0xd3, 0xd2, 0xd1, 0xda, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xed, 0xee, 0xee, 0xed, 0xbb, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xe8, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xef, 0xee, 0xf0, 0xed, 0xed, 0xed, 0xe9, 0xe2, 0xd6, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd6, 0xd9, 0xd4, 0xd8, 0xce, 0xde, 0x87, 0x65, 0xda, 0xa7, 0xc1, 0xc1, 0xad, 0xad, 0xb2, 0xc0, 0xc0, 0xc1, 0xad, 0xb5, 0xad, 0xbf, 0xc8, 0xe7, 0x93, 0x7b, 0x28, 0x31, 0x4b, 0x4b, 0x52, 0x4e, 0x45, 0x5c, 0x4a, 0x58, 0x6a, 0x46, 0x1e, 0x72, 0xca, 0xbe, 0xb0, 0xaf, 0xaf, 0xb0, 0xc1, 0xc0, 0xb1, 0xae, 0xae, 0xc1, 0xc1, 0xac, 0xb0, 0xac, 0xc1, 0xac, 0xc1, 0xb0, 0xc1, 0xb0, 0xc1, 0xb0, 0xc1, 0xb0, 0xc1, 0xac, 0xc1, 0xac, 0xb0, 0xc1, 0xb0, 0xc1, 0xb0, 0xc1, 0xb0, 0xc1, 0xb2, 0xb1, 0xb1, 0xc0, 0xc0, 0xc0, 0xc1, 0xae, 0xb0, 0xc1, 0xbf, 0xcd, 0x7a, 0x1e, 0x49, 0x53, 0x6b, 0x2f, 0x54, 0x3e, 0x53, 0x3f, 0x4b, 0x45, 0x3e, 0x41, 0x36, 0x7f, 0xf3, 0xe2, 0xa9, 0xaa, 0xad, 0xad, 0xac, 0xac, 0xae, 0xad, 0xad, 0xac, 0xc1, 0xac, 0xad, 0xad, 0xb1, 0xa9, 0xd5, 0xdb, 0xcc, 0xd3, 0xd1, 0xd4, 0xd4, 0xd1, 0xd3, 0xcf, 0xd3, 0xd1, 0xd4, 0xe2, 0xe9, 0xe7, 0xed, 0xb9, 0xb9, 0xed, 0xf0, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xed, 0xe8, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xee, 0xed, 0xee, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xf0, 0xf7, 0xee, 0xed, 0xf1, 0xf0, 0xe8, 0xe3, 0xdb, 0xd8, 0xd9, 0xd8, 0xd8, 0xd8, 0xd9, 0xd8, 0xd8, 0xd8, 0xd2, 0xd3, 0xce, 0xfd, 0xe3, 0xc9, 0xaa, 0xb0, 0xac, 0xae, 0xad, 0xae, 0xc0, 0xc0, 0xc1, 0xb0, 0xad, 0xb3, 0xb0, 0xaa, 0xcb, 0xe3, 0xfe, 0x82, 0x33, 0x28, 0x2d, 0x4b, 0x44, 0x4c, 0x4e, 0x6a, 0x52, 0x58, 0x52, 0x31, 0x4d, 0x65, 0xbf, 0xc0, 0xb0, 0xaf, 0xb0, 0xc1, 0xb1, 0xb1, 0xae, 0xae, 0xc1, 0xac, 0xc1, 0xb1, 0xb0, 0xb1, 0xb0, 0xac, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xae, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xac, 0xb2, 0xb1, 0xae, 0xae, 0xae, 0xc1, 0xb1, 0xc0, 0xb0, 0xb0, 0xb0, 0xad, 0xc1, 0xc3, 0x81, 0x22, 0x2f, 0x5c, 0x5d, 0x41, 0x3b, 0x4b, 0x49, 0x4e, 0x4e, 0x52, 0x3e, 0x39, 0x3a, 0x86, 0x92, 0xdf, 0xc3, 0xaa, 0xaf, 0xad, 0xad, 0xac, 0xae, 0xad, 0xaf, 0xad, 0xae, 0xc0, 0xc1, 0xae, 0xaf, 0xae, 0xc1, 0xb7, 0xc9, 0xd3, 0xcf, 0xd3, 0xcf, 0xd1, 0xcf, 0xd3, 0xcf, 0xcf, 0xd1, 0xdd, 0xe9, 0xf1, 0xf8, 0xf0, 0xee, 0xb9, 0xf7, 0xed, 0xf0, 0xee, 0xee, 0xee, 0xed, 0xbb, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xf7, 0xf7, 0xed, 0xf1, 0xee, 0xf1, 0xe5, 0xe9, 0xdd, 0xd6, 0xdb, 0xd9, 0xda, 0xd9, 0xd9, 0xd2, 0xd9, 0xd9, 0xd9, 0xd9, 0xcc, 0xc8, 0xe2, 0xb6, 0xad, 0xad, 0xc1, 0xac, 0xae, 0xac, 0xc1, 0xc0, 0xc1, 0xb0, 0xad, 0xaf, 0xaf, 0xb0, 0xaa, 0xc8, 0xe2, 0xea, 0x90, 0x74, 0x20, 0x23, 0x31, 0x41, 0x46, 0x49, 0x67, 0x52, 0x52, 0x52, 0x27, 0x71, 0x1b, 0xc3, 0xbe, 0xb0, 0xaf, 0xc1, 0xc0, 0xac, 0xae, 0xae, 0xb2, 0xb1, 0xb2, 0xac, 0xb1, 0xac, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xac, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xc1, 0xb1, 0xb2, 0xaf, 0xaf, 0xb2, 0xc1, 0xb0, 0xb3, 0xaf, 0xae, 0xb4, 0xa9, 0xd7, 0x68, 0x1e, 0x52, 0x5c, 0x45, 0x49, 0x4e, 0x45, 0x54, 0x42, 0x3f, 0x31, 0x29, 0x71, 0x8f, 0xea, 0xdf, 0xc3, 0xaa, 0xac, 0xc1, 0xad, 0xac, 0xac, 0xad, 0xad, 0xaf, 0xad, 0xae, 0xac, 0xc1, 0xac, 0xb0, 0xae, 0xae, 0xc1, 0xcc, 0xc9, 0xc9, 0xc7, 0xc6, 0xc6, 0xc7, 0xc7, 0xc7, 0xcc, 0xdf, 0xe9, 0xf1, 0xf8, 0xf8, 0xfe, 0xf7, 0xef, 0xf2, 0xf1, 0xf0, 0xed, 0xee, 0xed, 0xed, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xf0, 0xf2, 0xee, 0xe7, 0xed, 0xee, 0xea, 0xe9, 0xe6, 0xdd, 0xda, 0xdb, 0xdb, 0xd9, 0xda, 0xd9, 0xcf, 0xcc, 0xc6, 0xaf, 0xbe, 0xbe, 0xb1, 0xab, 0xaf, 0xc1, 0xac, 0xb1, 0xae, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xb0, 0xb0, 0xaf, 0xad, 0xb6, 0xbe, 0xc0, 0xda, 0xe6, 0xf9, 0x8d, 0x6f, 0x40, 0x21, 0x2a, 0x46, 0x37, 0x5c, 0x52, 0x6a, 0x5d, 0x63, 0x6d, 0xeb, 0xbf, 0xc1, 0xaf, 0xc1, 0xb1, 0xb1, 0xac, 0xae, 0xc1, 0xac, 0xc1, 0xc1, 0xb0, 0xc1, 0xb0, 0xac, 0xb0, 0xac, 0xb0, 0xac, 0xb0, 0xac, 0xb0, 0xac, 0xc1, 0xb0, 0xac, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xb2, 0xc1, 0xc1, 0xaf, 0xaf, 0xae, 0xb0, 0xb3, 0xaf, 0xb3, 0xb1, 0xbf, 0xb8, 0x7a, 0x1a, 0x54, 0x67, 0x44, 0x49, 0x54, 0x54, 0x4c, 0x35, 0x43, 0x2c, 0x61, 0x89, 0x92, 0xe9, 0xd1, 0xaa, 0xab, 0xac, 0xc0, 0xc1, 0xc1, 0xac, 0xad, 0xae, 0xaf, 0xad, 0xaf, 0xae, 0xae, 0xac, 0xb0, 0xad, 0xb0, 0xaf, 0xc1, 0xb6, 0xac, 0xb5, 0xb3, 0xb3, 0xad, 0xaa, 0xbf, 0xa7, 0xcb, 0xe9, 0xe6, 0xe9, 0xe9, 0xf1, 0xf0, 0xee, 0xe5, 0xed, 0xe5, 0xe7, 0xed, 0xed, 0xe8, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xf2, 0xee, 0xed, 0xed, 0xef, 0xf2, 0xea, 0xf3, 0xf3, 0xf3, 0xf9, 0xe3, 0xdc, 0xcd, 0xc5, 0xa6, 0xa3, 0xa4, 0xa7, 0xa7, 0xa7, 0xaa, 0xaa, 0xac, 0xac, 0xb4, 0xaa, 0xb2, 0xac, 0xac, 0xb1, 0xac, 0xb1, 0xac, 0xb0, 0xad, 0xb0, 0xb0, 0xb1, 0xb0, 0xae, 0xc1, 0xc1, 0xc0, 0xac, 0xab, 0xc7, 0xdf, 0xea, 0x92, 0x8c, 0x78, 0x33, 0x21, 0x1e, 0x31, 0x23, 0x43, 0x3e, 0x4a, 0x3a, 0x65, 0xc2, 0xc1, 0xad, 0xae, 0xc0, 0xb1, 0xc1, 0xb0, 0xc1, 0xc1, 0xac, 0xb0, 0xac, 0xc1, 0xac, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb0, 0xc1, 0xac, 0xc1, 0xb0, 0xc1, 0xb0, 0xc1, 0xb2, 0xc1, 0xc1, 0xb2, 0xaf, 0xaf, 0xb0, 0xc1, 0xaf, 0xaf, 0xae, 0xc0, 0xc5, 0x81, 0x1f, 0x46, 0x67, 0x4b, 0x4c, 0x3e, 0x46, 0x23, 0x21, 0x32, 0x71, 0x86, 0x92, 0xea, 0xe2, 0xc4, 0xaa, 0xad, 0xac, 0xc1, 0xc1, 0xc1, 0xac, 0xad, 0xae, 0xad, 0xae, 0xb0, 0xae, 0xae, 0xaf, 0xae, 0xb2, 0xc1, 0xb2, 0xb2, 0xb5, 0xb6, 0xb6, 0xc6, 0xab, 0xa7, 0xb1, 0xb4, 0xbe, 0xa9, 0xa9, 0xc4, 0xcb, 0xda, 0xe2, 0xe6, 0xea, 0xea, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf2, 0xea, 0xf3, 0xea, 0xe5, 0xec, 0xd7, 0xc5, 0xf5, 0xf4, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x9d, 0x9d, 0xa2, 0xa4, 0xaa, 0xb2, 0xac, 0xc1, 0xbe, 0xad, 0xb3, 0xac, 0xb1, 0xc1, 0xc1, 0xb1, 0xc1, 0xac, 0xaf, 0xad, 0xad, 0xae, 0xb1, 0xb1, 0xb1, 0xac, 0xb2, 0xc1, 0xc1, 0xc1, 0xbe, 0xaa, 0xc8, 0xdd, 0xe4, 0x92, 0x93, 0x8a, 0x7a, 0x71, 0x50, 0x26, 0x20, 0x21, 0x21, 0x22, 0x1b, 0xbe, 0xb5, 0xad, 0xac, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb0, 0xc1, 0xac, 0xc1, 0xb0, 0xc1, 0xac, 0xc1, 0xac, 0xc1, 0xc1, 0xb0, 0xc1, 0xc1, 0xc1, 0xc1, 0xac, 0xc1, 0xb2, 0xc1, 0xc1, 0xb2, 0xb1, 0xc0, 0xc1, 0xae, 0xaf, 0xb4, 0xc2, 0xec, 0x22, 0x23, 0x4a, 0x2b, 0x28, 0x2c, 0x32, 0x4f, 0x78, 0x83, 0x90, 0xf3, 0xe8, 0xdf, 0xc7, 0xaa, 0xbe, 0xae, 0xad, 0xad, 0xad, 0xac, 0xac, 0xae, 0xae, 0xad, 0xae, 0xc1, 0xc1, 0xc1, 0xaf, 0xaf, 0xaf, 0xb3, 0xb1, 0xb1, 0xb6, 0xb5, 0xb5, 0xb7, 0xa9, 0x9d, 0x9d, 0xa0, 0xaa, 0xae, 0xac, 0xa9, 0xbe, 0xa7, 0xa7, 0xa7, 0xa9, 0xc4, 0xce, 0xdb, 0xe3, 0xe6, 0xe9, 0xf2, 0xe7, 0xe8, 0xed, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xf0, 0xf1, 0xee, 0xed, 0xf3, 0xf3, 0xea, 0xfd, 0xb8, 0xfb, 0xa3, 0x9c, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9d, 0x9f, 0xa4, 0xa6, 0xbf, 0xc3, 0xc0, 0xb4, 0xb4, 0xad, 0xad, 0xc1, 0xb4, 0xac, 0xae, 0xac, 0xb1, 0xac, 0xac, 0xc1, 0xc0, 0xc1, 0xb0, 0xad, 0xae, 0xac, 0xb1, 0xac, 0xb1, 0xb1, 0xad, 0xb4, 0xc1, 0xb0, 0xac, 0xac, 0xaa, 0xab, 0xc8, 0xd7, 0xe2, 0xba, 0xf3, 0x91, 0x8d, 0x8c, 0x85, 0x82, 0x7b, 0x72, 0xec, 0xbe, 0xad, 0xaf, 0xae, 0xac, 0xc1, 0xb0, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xb0, 0xb2, 0xac, 0xb2, 0xb0, 0xb2, 0xb2, 0xc1, 0xae, 0xc1, 0xae, 0xc1, 0xae, 0xb0, 0xb2, 0xb2, 0xb0, 0xb2, 0xb0, 0xb1, 0xc1, 0xc1, 0xb0, 0xaf, 0xb3, 0xab, 0xcb, 0xe1, 0x25, 0x32, 0x5e, 0x71, 0x7b, 0x82, 0x8c, 0x92, 0x93, 0xea, 0xe3, 0xda, 0xc7, 0xaa, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xae, 0xad, 0xae, 0xae, 0xc1, 0xc0, 0xc1, 0xb0, 0xae, 0xaf, 0xae, 0xb2, 0xb1, 0xb1, 0xb6, 0xb5, 0xb3, 0xb7, 0xa2, 0x9b, 0xa0, 0x9d, 0xa0, 0xaa, 0xaa, 0xad, 0xaa, 0xad, 0xad, 0xaa, 0xaa, 0xa9, 0xa7, 0xa9, 0xbf, 0xc8, 0xd5, 0xe2, 0xe9, 0xea, 0xe8, 0xed, 0xf8, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xe5, 0xf0, 0xee, 0xe5, 0xf0, 0xf0, 0xf8, 0xea, 0xf3, 0xec, 0xca, 0xa3, 0x9a, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x9d, 0xa1, 0xa4, 0xa9, 0xc3, 0xb6, 0xb4, 0xb3, 0xb4, 0xc1, 0xc1, 0xc1, 0xad, 0xb0, 0xb3, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xac, 0xb0, 0xae, 0xac, 0xb0, 0xc1, 0xc1, 0xc1, 0xb0, 0xb0, 0xae, 0xad, 0xb0, 0xae, 0xac, 0xb0, 0xb0, 0xac, 0xb0, 0xb0, 0xb2, 0xae, 0xaa, 0xa9, 0xa9, 0xc4, 0xce, 0xda, 0xdf, 0xe3, 0xe3, 0xe6, 0xe6, 0xe3, 0xd4, 0xbf, 0xae, 0xaf, 0xaf, 0xaf, 0xad, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb2, 0xac, 0xae, 0xac, 0xae, 0xb2, 0xae, 0xac, 0xae, 0xb1, 0xae, 0xb2, 0xae, 0xc1, 0xae, 0xb2, 0xb2, 0xb2, 0xac, 0xae, 0xb2, 0xb2, 0xb1, 0xb1, 0xb0, 0xaf, 0xb3, 0xae, 0xc0, 0xc3, 0xdd, 0xe9, 0x94, 0xea, 0xea, 0xe9, 0xe3, 0xe2, 0xdb, 0xce, 0xc4, 0xaa, 0xa7, 0xaa, 0xad, 0xaa, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb0, 0xae, 0xac, 0xc1, 0xac, 0xc1, 0xc1, 0xb0, 0xaf, 0xad, 0xb0, 0xae, 0xb1, 0xb1, 0xb6, 0xb4, 0xb5, 0xb5, 0xb7, 0xa4, 0x9d, 0x9f, 0x9f, 0xa2, 0xbe, 0xb3, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xac, 0xac, 0xbe, 0xaa, 0xaa, 0xa7, 0xa9, 0xc4, 0xd5, 0xe3, 0xea, 0xf1, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf2, 0xed, 0xef, 0xed, 0xea, 0xf3, 0xec, 0xbd, 0x9a, 0x98, 0x98, 0x9a, 0x9a, 0x9b, 0x9d, 0xa1, 0xa4, 0xab, 0xc3, 0xb4, 0xb1, 0xc0, 0xb4, 0xb4, 0xb1, 0xb2, 0xaf, 0xad, 0xaf, 0xb0, 0xc1, 0xc1, 0xb0, 0xac, 0xb0, 0xac, 0xb0, 0xac, 0xae, 0xac, 0xad, 0xc1, 0xb0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xac, 0xc1, 0xc1, 0xc1, 0xb1, 0xc1, 0xc1, 0xac, 0xc1, 0xbe, 0xad, 0xaa, 0xad, 0xaa, 0xaa, 0xab, 0xc0, 0xc3, 0xc4, 0xc4, 0xc4, 0xc4, 0xa9, 0xbe, 0xbe, 0xac, 0xac, 0xbe, 0xbe, 0xc0, 0xac, 0xc0, 0xac, 0xc0, 0xac, 0xac, 0xac, 0xbe, 0xac, 0xbe, 0xbe, 0xbe, 0xac, 0xbe, 0xac, 0xbe, 0xac, 0xbe, 0xac, 0xbe, 0xac, 0xac, 0xbe, 0xac, 0xbe, 0xc0, 0xac, 0xc0, 0xbe, 0xac, 0xac, 0xc1, 0xbe, 0xc3, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xc8, 0xc8, 0xb7, 0xb6, 0xb4, 0xae, 0xae, 0xc1, 0xb0, 0xbe, 0xac, 0xac, 0xaa, 0xaa, 0xaa, 0xad, 0xb0, 0xac, 0xad, 0xad, 0xb0, 0xae, 0xb0, 0xb2, 0xb0, 0xae, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xab, 0xa0, 0x9d, 0xa0, 0xbf, 0xb2, 0xaf, 0xb2, 0xac, 0xac, 0xad, 0xac, 0xad, 0xac, 0xac, 0xac, 0xae, 0xb1, 0xc0, 0xc0, 0xab, 0xa9, 0xc4, 0xdb, 0xea, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xee, 0xee, 0xf3, 0xe4, 0xc2, 0x98, 0x98, 0x95, 0x9a, 0x9a, 0x9a, 0x9e, 0xa4, 0xa7, 0xb6, 0xb7, 0xb4, 0xae, 0xb4, 0xae, 0xae, 0xb0, 0xc0, 0xc1, 0xac, 0xb3, 0xb5, 0xae, 0xb1, 0xc0, 0xc0, 0xc1, 0xae, 0xb0, 0xae, 0xb0, 0xac, 0xb0, 0xac, 0xb0, 0xb0, 0xae, 0xb0, 0xae, 0xc1, 0xb0, 0xc1, 0xc1, 0xac, 0xc0, 0xbe, 0xbe, 0xbe, 0xc0, 0xc3, 0xb7, 0xc7, 0xcc, 0xcc, 0xcc, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xc9, 0xc9, 0xc9, 0xc8, 0xc8, 0xc7, 0xc7, 0xc6, 0xc7, 0xc7, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc7, 0xc6, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc9, 0xc9, 0xc9, 0xcc, 0xcb, 0xce, 0xcc, 0xcf, 0xcf, 0xcf, 0xcf, 0xd3, 0xd3, 0xd3, 0xd9, 0xd3, 0xd9, 0xd9, 0xd3, 0xcf, 0xcc, 0xc9, 0xc6, 0xc1, 0xbe, 0xad, 0xbe, 0xad, 0xac, 0xae, 0xb2, 0xaf, 0xb3, 0xb2, 0xb2, 0xb2, 0xb0, 0xae, 0xb3, 0xb0, 0xb5, 0xb5, 0xb0, 0xb0, 0xb5, 0xb7, 0xb2, 0xab, 0xb6, 0xb7, 0xaf, 0xaf, 0xb1, 0xb6, 0xb1, 0xac, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xc0, 0xc0, 0xc0, 0xc1, 0xac, 0xb3, 0xab, 0xa7, 0xd0, 0xe6, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe8, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xf2, 0xea, 0xdc, 0xbc, 0x98, 0x9a, 0x95, 0x95, 0x9a, 0x9e, 0xa2, 0xbf, 0xc3, 0xb6, 0xb1, 0xc1, 0xb4, 0xc1, 0xac, 0xc0, 0xc1, 0xb6, 0xc1, 0xb1, 0xb6, 0xab, 0xa9, 0xab, 0xc3, 0xc3, 0xc0, 0xc1, 0xae, 0xb0, 0xb2, 0xb0, 0xae, 0xac, 0xae, 0xac, 0xb0, 0xae, 0xb0, 0xc1, 0xc1, 0xc0, 0xc0, 0xc0, 0xb6, 0xc6, 0xc8, 0xcc, 0xcf, 0xd2, 0xd8, 0xd3, 0xd8, 0xd3, 0xd8, 0xd6, 0xd4, 0xd4, 0xd6, 0xd6, 0xd4, 0xd4, 0xd6, 0xd1, 0xd3, 0xd3, 0xd3, 0xd8, 0xd8, 0xd6, 0xd6, 0xd8, 0xd4, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd9, 0xd3, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd9, 0xd2, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd4, 0xd4, 0xd6, 0xd8, 0xd6, 0xd2, 0xd4, 0xd2, 0xd2, 0xd9, 0xd9, 0xd9, 0xd2, 0xd3, 0xcc, 0xc6, 0xb6, 0xac, 0xc1, 0xae, 0xb3, 0xb3, 0xb3, 0xb2, 0xb2, 0xb3, 0xb0, 0xb2, 0xb0, 0xb6, 0xb4, 0xb7, 0xb6, 0xb4, 0xb3, 0xb5, 0xb5, 0xb0, 0xb3, 0xb3, 0xb5, 0xb6, 0xa9, 0xc0, 0xb4, 0xac, 0xae, 0xae, 0xad, 0xae, 0xb0, 0xc1, 0xac, 0xad, 0xad, 0xad, 0xad, 0xc0, 0xbf, 0xdf, 0xea, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf2, 0xee, 0xed, 0xf3, 0xfb, 0x98, 0x9a, 0x95, 0x98, 0x9a, 0x9b, 0xa6, 0xc4, 0xb4, 0xc1, 0xb6, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb6, 0xc0, 0xc1, 0xb0, 0xb6, 0xa9, 0x9d, 0x9b, 0x9d, 0xa2, 0xc0, 0xb2, 0xb0, 0xac, 0xb2, 0xae, 0xb0, 0xb2, 0xac, 0xb0, 0xb2, 0xae, 0xac, 0xac, 0xbe, 0xc0, 0xc6, 0xc9, 0xcf, 0xd1, 0xd2, 0xd9, 0xd8, 0xd8, 0xd2, 0xd1, 0xd4, 0xd1, 0xd2, 0xd1, 0xd4, 0xd5, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd1, 0xd1, 0xd2, 0xd2, 0xd1, 0xd4, 0xd1, 0xd6, 0xd4, 0xd4, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd2, 0xd2, 0xd4, 0xd6, 0xd6, 0xd4, 0xd1, 0xd2, 0xd2, 0xd4, 0xd6, 0xd4, 0xd4, 0xd6, 0xd6, 0xd6, 0xd6, 0xd4, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd4, 0xd6, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xcf, 0xc9, 0xbe, 0xb1, 0xae, 0xb0, 0xb3, 0xb3, 0xb0, 0xb2, 0xb4, 0xc3, 0xc0, 0xa4, 0xa4, 0xa7, 0xb7, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xae, 0xa4, 0xa0, 0xa2, 0xac, 0xb1, 0xae, 0xac, 0xae, 0xb0, 0xad, 0xb3, 0xaf, 0xaf, 0xaf, 0xad, 0xb3, 0xa9, 0xc4, 0xe3, 0xf0, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xf7, 0xf2, 0xef, 0xea, 0xe1, 0xa5, 0x98, 0x98, 0x95, 0x9a, 0x9a, 0xa6, 0xb7, 0xb4, 0xb2, 0xc1, 0xb3, 0xb0, 0xb3, 0xb3, 0xb0, 0xad, 0xb0, 0xb0, 0xaf, 0xb7, 0xa4, 0x98, 0x9b, 0x9a, 0x9d, 0xab, 0xae, 0xad, 0xb0, 0xac, 0xb0, 0xac, 0xae, 0xb0, 0xb2, 0xad, 0xc0, 0xc1, 0xc6, 0xcf, 0xd3, 0xd9, 0xd9, 0xd8, 0xd2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd1, 0xd2, 0xd1, 0xd3, 0xd2, 0xd3, 0xd3, 0xd3, 0xd2, 0xd4, 0xd4, 0xd1, 0xd6, 0xd4, 0xd4, 0xd2, 0xd2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd2, 0xd4, 0xd4, 0xd6, 0xd6, 0xd6, 0xd1, 0xd8, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xda, 0xd9, 0xd9, 0xd9, 0xc6, 0xb1, 0xb0, 0xaf, 0xb0, 0xb3, 0xb1, 0xb6, 0xbf, 0x9d, 0x9d, 0x9d, 0x9b, 0xa7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xae, 0xa0, 0xa0, 0xa0, 0xaa, 0xb1, 0xac, 0xae, 0xb0, 0xac, 0xaf, 0xaf, 0xad, 0xae, 0xac, 0xac, 0xa9, 0xc8, 0xe3, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf3, 0xed, 0xeb, 0xbc, 0x98, 0x98, 0x9a, 0x9d, 0xa0, 0xbf, 0xb7, 0xb7, 0xb6, 0xae, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xaf, 0xad, 0xb6, 0xa9, 0x9d, 0x9d, 0x9b, 0xa2, 0xac, 0xb3, 0xae, 0xac, 0xae, 0xac, 0xb0, 0xb0, 0xac, 0xad, 0xac, 0xb6, 0xcf, 0xd3, 0xd3, 0xd8, 0xd2, 0xd4, 0xd2, 0xd6, 0xd6, 0xd1, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd1, 0xd4, 0xd1, 0xd4, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd4, 0xd4, 0xd4, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xd6, 0xda, 0xd8, 0xd9, 0xd9, 0xc7, 0xad, 0xb3, 0xb3, 0xb3, 0xc1, 0xb7, 0xa4, 0x9d, 0xa0, 0xa1, 0x9d, 0xa4, 0xb5, 0xb3, 0xb5, 0xb5, 0xb6, 0xb5, 0xb4, 0xaa, 0xa7, 0xa7, 0xb2, 0xac, 0xac, 0xb1, 0xb1, 0xb4, 0xad, 0xae, 0xc0, 0xa9, 0xbf, 0xc4, 0xda, 0xe6, 0xe9, 0xf1, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xf2, 0xed, 0xf2, 0xf3, 0xea, 0xdc, 0xfb, 0xbc, 0x98, 0x98, 0x98, 0x9d, 0xa1, 0xbf, 0xc3, 0xc3, 0xb7, 0xb6, 0xb4, 0xc0, 0xc1, 0xc1, 0xc0, 0xc0, 0xc3, 0xbf, 0xac, 0xc0, 0xb2, 0xac, 0xb0, 0xb0, 0xac, 0xb0, 0xac, 0xb0, 0xac, 0xb2, 0xb0, 0xcf, 0xd8, 0xd1, 0xd2, 0xd1, 0xd4, 0xd4, 0xd6, 0xd4, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd4, 0xd1, 0xd4, 0xd1, 0xd4, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd2, 0xd2, 0xd2, 0xd4, 0xd4, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd6, 0xd4, 0xd4, 0xd2, 0xd2, 0xd4, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd9, 0xd9, 0xcf, 0xb6, 0xac, 0xb2, 0xb0, 0xb0, 0xb3, 0xb2, 0xb2, 0xa2, 0xa0, 0xa0, 0xa4, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb5, 0xb7, 0xb5, 0xae, 0xae, 0xb1, 0xb0, 0xbe, 0xaa, 0xaa, 0xa9, 0xc3, 0xce, 0xdd, 0xe6, 0xea, 0xe7, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 
-  0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xf2, 0xee, 0xee, 0xf2, 0xe8, 0xe8, 0xf2, 0xea, 0xea, 0xf7, 0xec, 0xeb, 0xa5, 0xf4, 0x98, 0x98, 0x9a, 0x9f, 0xa2, 0xa6, 0xc3, 0xc4, 0xc4, 0xb6, 0xc3, 0xb4, 0xac, 0xae, 0xb4, 0xb1, 0xc1, 0xc1, 0xac, 0xb0, 0xac, 0xae, 0xae, 0xb0, 0xae, 0xad, 0xad, 0xb7, 0xcf, 0xd4, 0xd4, 0xd8, 0xd1, 0xd4, 0xd1, 0xd5, 0xd4, 0xd4, 0xd2, 0xd4, 0xd4, 0xd1, 0xd4, 0xd1, 0xd4, 0xd2, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd1, 0xd4, 0xd1, 0xd4, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd6, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd6, 0xd6, 0xd4, 0xd2, 0xd2, 0xd2, 0xd4, 0xd6, 0xd6, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd2, 0xd2, 0xd2, 0xd8, 0xd2, 0xd6, 0xd2, 0xd6, 0xd2, 0xd8, 0xd8, 0xd6, 0xd2, 0xd8, 0xd9, 0xd8, 0xd9, 0xd4, 0xc7, 0xb1, 0xb1, 0xb4, 0xb2, 0xb3, 0xb3, 0xaf, 0xaf, 0xb0, 0xb5, 0xb4, 0xb6, 0xb6, 0xb6, 0xb3, 0xb5, 0xb5, 0xb5, 0xb6, 0xb5, 0xb3, 0xb6, 0xb0, 0xac, 0xbe, 0xab, 0xaa, 0xbf, 0xc0, 0xc8, 0xcf, 0xdd, 0xe3, 0xe9, 0xe9, 0xe9, 0xe8, 0xbb, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 
-  0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xef, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xf0, 0xf2, 0xf2, 0xf3, 0xf3, 0xed, 0xde, 0xb8, 0xc5, 0xa5, 0xbc, 0x9a, 0x98, 0x9b, 0x9f, 0xa1, 0xa6, 0xa6, 0xbf, 0xbf, 0xc3, 0xb6, 0xb6, 0xb6, 0xb6, 0xb4, 0xb1, 0xb2, 0xb2, 0xad, 0xad, 0xad, 0xad, 0xaa, 0xbf, 0xb6, 0xcc, 0xcf, 0xd2, 0xd8, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd2, 0xd1, 0xd1, 0xd4, 0xd1, 0xd4, 0xd1, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd4, 0xd6, 0xd4, 0xd4, 0xd4, 0xd6, 0xd6, 0xd4, 0xd4, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xd2, 0xd8, 0xd9, 0xd9, 0xd8, 0xcf, 0xcc, 0xc6, 0xbe, 0xc0, 0xc0, 0xc1, 0xb0, 0xaf, 0xb3, 0xad, 0xaf, 0xae, 0xb3, 0xb2, 0xb3, 0xb0, 0xb5, 0xb5, 0xb5, 0xb0, 0xb0, 0xc1, 0xaa, 0xab, 0xaa, 0xbf, 0xbf, 0xc4, 0xc8, 0xd0, 0xdb, 0xdf, 0xe6, 0xea, 0xea, 0xea, 0xe9, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 
-  0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xf2, 0xea, 0xf3, 0xf3, 0xea, 0xb9, 0xe0, 0xdc, 0xca, 0xc5, 0xa8, 0xa3, 0xa1, 0x9f, 0xa0, 0xa0, 0xa0, 0xa4, 0xa4, 0xa7, 0xa9, 0xbf, 0xc3, 0xc0, 0xc3, 0xb6, 0xb1, 0xac, 0xac, 0xad, 0xaa, 0xaa, 0xaa, 0xbe, 0xb6, 0xc9, 0xcc, 0xcf, 0xd1, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd4, 0xd4, 0xd4, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd8, 0xd8, 0xd6, 0xd1, 0xcc, 0xc7, 0xb5, 0xb1, 0xaa, 0xad, 0xb0, 0xaf, 0xb3, 0xaf, 0xb2, 0xb1, 0xb1, 0xac, 0xb1, 0xac, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xa9, 0xc0, 0xc3, 0xc4, 0xc4, 0xcc, 0xd0, 0xdb, 0xdf, 0xe3, 0xe6, 0xe7, 0xe9, 0xe8, 0xf2, 0xe9, 0xe8, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 
-  0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xef, 0xed, 0xed, 0xed, 0xf0, 0xed, 0xe5, 0xe8, 0xea, 0xea, 0xf3, 0xf3, 0xf3, 0xf3, 0xe8, 0xe4, 0xdf, 0xdc, 0xd0, 0xca, 0xc4, 0xa8, 0xa6, 0xa3, 0xa2, 0xa3, 0xa2, 0xa4, 0xa4, 0xa6, 0xa6, 0xaa, 0xa7, 0xaa, 0xaa, 0xac, 0xaa, 0xaa, 0xaa, 0xac, 0xc1, 0xc3, 0xc6, 0xc9, 0xcc, 0xcc, 0xcf, 0xd2, 0xd3, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd8, 0xd2, 0xd8, 0xd2, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xcf, 0xcf, 0xcc, 0xc7, 0xb6, 0xc0, 0xc0, 0xac, 0xad, 0xae, 0xad, 0xad, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0xa9, 0xa9, 0xa9, 0xbf, 0xc3, 0xc3, 0xc8, 0xcb, 0xcd, 0xd5, 0xdd, 0xe0, 0xe2, 0xe3, 0xe7, 0xea, 0xea, 0xf2, 0xf2, 0xbb, 0xe7, 0xb9, 0xe8, 0xbb, 0xed, 0xf7, 0xf7, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xed, 0xe5, 0xef, 0xf2, 0xef, 0xed, 0xef, 0xef, 0xf9, 0xea, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xea, 0xe9, 0xe5, 0xe2, 0xe0, 0xec, 0xdb, 0xd0, 0xb8, 0xcb, 0xc8, 0xc8, 0xc4, 0xc3, 0xbf, 0xbf, 0xbf, 0xa9, 0xa9, 0xa9, 0xaa, 0xa7, 0xaa, 0xa9, 0xaa, 0xab, 0xc0, 0xc3, 0xc6, 0xc8, 0xc9, 0xcc, 0xce, 0xcf, 0xce, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd4, 0xd8, 0xd4, 0xd8, 0xd4, 0xd4, 0xd8, 0xd4, 0xd8, 0xd4, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd1, 0xd1, 0xd4, 0xd4, 0xd1, 0xcf, 0xce, 0xce, 0xcc, 0xc8, 0xc4, 0xc4, 0xc0, 0xab, 0xab, 0xa9, 0xaa, 0xa9, 0xab, 0xab, 0xc0, 0xc3, 0xc3, 0xc4, 0xc4, 0xc8, 0xcb, 0xcc, 0xd0, 0xd2, 0xdb, 0xdd, 0xdf, 0xe2, 0xe3, 0xe3, 0xe7, 0xe7, 0xe9, 0xea, 0xea, 0xf2, 0xe8, 0xf2, 0xf2, 0xee, 0xef, 0xf0, 0xef, 0xee, 0xbb, 0xf7, 0xef, 0xef, 0xf7, 0xef, 0xf7, 0xff, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf7, 0xf2, 0xf7, 0xed, 0xef, 0xed, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf7, 0xef, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xf2, 0xea, 0xf3, 0xe9, 0xea, 0xf2, 0xe7, 0xed, 0xe6, 0xe4, 0xe3, 0xe0, 0xe0, 0xdf, 0xdd, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xd0, 0xd0, 0xd0, 0xcd, 0xcd, 0xcd, 0xcb, 0xcb, 0xc8, 0xcb, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcd, 0xcd, 0xcd, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xcd, 0xcd, 0xcb, 0xcb, 0xcb, 0xcd, 0xcb, 0xcd, 0xce, 0xce, 0xd5, 0xd5, 0xda, 0xdb, 0xdb, 0xdd, 0xdd, 0xdf, 0xdf, 0xe2, 0xe3, 0xe6, 0xe6, 0xe7, 0xe7, 0xe9, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xe7, 0xe8, 0xe8, 0xe7, 0xe8, 0xe8, 0xed, 0xe8, 0xe8, 0xee, 0xee, 0xf7, 0xef, 0xff, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xef, 0xf7, 0xef, 0xf7, 0xf0, 0xf7, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xbb, 0xed, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf7, 0xf0, 0xed, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xed, 0xef, 0xef, 0xee, 0xef, 0xe8, 0xbb, 0xe8, 0xb9, 0xe8, 0xef, 0xf8, 0xf8, 0xf0, 0xf0, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xe9, 0xe8, 0xf2, 0xf2, 0xe8, 0xf2, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe6, 0xe3, 0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe9, 0xe7, 0xea, 0xea, 0xea, 0xe9, 0xea, 0xea, 0xea, 0xf3, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xea, 0xe9, 0xe8, 0xe8, 0xee, 0xee, 0xef, 0xef, 0xef, 0xf7, 0xee, 0xe7, 0xe8, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf7, 0xef, 0xe7, 0xe5, 0xbb, 0xed, 0xe8, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xe7, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe8, 0xee, 0xed, 0xed, 0xf0, 0xee, 0xf0, 0xed, 0xe8, 0xe7, 0xe8, 0xed, 0xe8, 0xee, 0xee, 0xed, 0xee, 0xe8, 0xef, 0xe8, 0xef, 0xee, 0xbb, 0xe5, 0xbb, 0xbb, 0xed, 0xef, 0xef, 0xee, 0xef, 0xe5, 0xbb, 0xed, 0xb9, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xb9, 0xbb, 0xb9, 0xe8, 0xb9, 0xbb, 0xe7, 0xbb, 0xe8, 0xe8, 0xe7, 0xe8, 0xe7, 0xe7, 0xe9, 0xe8, 0xf2, 0xe9, 0xe8, 0xe8, 0xe7, 0xe8, 0xe7, 0xe9, 0xe8, 0xe9, 0xe8, 0xe9, 0xe8, 0xe9, 0xe8, 0xe9, 0xe8, 0xe9, 0xe8, 0xe9, 0xe8, 0xe9, 0xe8, 0xe9, 0xe8, 0xe7, 0xe8, 0xe7, 0xe8, 0xe9, 0xe8, 0xe7, 0xe9, 0xe8, 0xe8, 0xe9, 0xe8, 0xe9, 0xe8, 0xe8, 0xe8, 0xe7, 0xe8, 0xe8, 0xe7, 0xe8, 0xe7, 0xe7, 0xe8, 0xe8, 0xee, 0xe8, 0xee, 0xed, 0xee, 0xed, 0xee, 0xf7, 0xbb, 0xba, 0xbb, 0xbb, 0xba, 0xee, 0xbb, 0xef, 0xef, 0xee, 0xf7, 0xee, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xef, 0xb9, 0xe7, 0xe7, 0xe8, 0xe8, 0xed, 0xe7, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe8, 0xed, 0xe7, 0xed, 0xe7, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xed, 0xe8, 0xed, 0xe8, 0xe8, 0xed, 0xee, 0xe8, 0xee, 0xe8, 0xed, 0xbb, 0xed, 0xbb, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xbb, 0xed, 0xbb, 0xed, 0xbb, 0xe8, 0xe7, 0xe8, 0xe8, 0xe8, 0xb9, 0xb9, 0xbb, 0xb9, 0xbb, 0xb9, 0xb9, 0xba, 0xbb, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xf0, 0xee, 0xf2, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xf2, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xba, 0xb9, 0xba, 0xbb, 0xba, 0xe5, 0xbb, 0xe5, 0xbb, 0xe5, 0xbb, 0xb9, 0xbb, 0xe5, 0xbb, 0xe5, 0xbb, 0xed, 0xee, 0xf0, 0xf0, 0xed, 0xef, 0xee, 0xee, 0xee, 0xbb, 0xed, 0xe8, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xe8, 0xed, 0xe8, 0xed, 0xe8, 0xed, 0xe8, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xe8, 0xed, 0xe7, 0xee, 0xb9, 0xef, 0xbb, 0xf7, 0xbb, 0xf7, 0xbb, 0xed, 0xbb, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xf0, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xf1, 0xed, 0xf1, 0xf1, 0xed, 0xf1, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xed, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xed, 0xee, 0xed, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xf7, 0xed, 0xee, 0xf7, 0xed, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xf0, 0xed, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xee, 0xed, 0xf0, 0xf1, 0xf0, 0xf0, 0xf2, 0xee, 0xee, 0xf2, 0xee, 0xf0, 0xf0, 0xf7, 0xf0, 0xf0, 0xee, 0xef, 0xed, 0xf0, 0xee, 0xee, 0xed, 0xf1, 0xed, 0xf1, 0xf7, 0xf0, 0xf0, 0xed, 0xbb, 0xe5, 0xbb, 0xb9, 0xbb, 0xf7, 0xef, 0xf7, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xf7, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xed, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xf0, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xe8, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 
-  0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 
-  0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xed, 0xee, 0xed, 
-};
-
-const lv_img_dsc_t image14 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image14_map,
-};
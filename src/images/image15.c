@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE15
-#define LV_ATTRIBUTE_IMG_IMAGE15
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE15 uint8_t image15_map[] = {
-  0xfc, 0xfc, 0xfc, 0xff, 	/*Color of index 0*/
-  0x02, 0x02, 0x02, 0xff, 	/*Color of index 1*/
-  0xe7, 0xe3, 0xf9, 0xff, 	/*Color of index 2*/
-  0xd4, 0xde, 0xfb, 0xff, 	/*Color of index 3*/
-  0xd2, 0xcf, 0xf8, 0xff, 	/*Color of index 4*/
-  0xc5, 0xce, 0xe7, 0xff, 	/*Color of index 5*/
-  0xc0, 0xc0, 0xf7, 0xff, 	/*Color of index 6*/
-  0xb4, 0xb0, 0xf3, 0xff, 	/*Color of index 7*/
-  0xb6, 0xb6, 0xd1, 0xff, 	/*Color of index 8*/
-  0xa1, 0xa2, 0xf0, 0xff, 	/*Color of index 9*/
-  0xad, 0xa6, 0xd5, 0xff, 	/*Color of index 10*/
-  0x6e, 0x92, 0xf8, 0xff, 	/*Color of index 11*/
-  0x94, 0x90, 0xde, 0xff, 	/*Color of index 12*/
-  0x92, 0x8f, 0xc1, 0xff, 	/*Color of index 13*/
-  0x65, 0x7b, 0xf7, 0xff, 	/*Color of index 14*/
-  0x81, 0x7c, 0xdb, 0xff, 	/*Color of index 15*/
-  0x72, 0x80, 0xc9, 0xff, 	/*Color of index 16*/
-  0x70, 0x6b, 0xdb, 0xff, 	/*Color of index 17*/
-  0x5a, 0x64, 0xf7, 0xff, 	/*Color of index 18*/
-  0x72, 0x6e, 0xc3, 0xff, 	/*Color of index 19*/
-  0x4a, 0x5b, 0xf8, 0xff, 	/*Color of index 20*/
-  0x51, 0x5f, 0xe2, 0xff, 	/*Color of index 21*/
-  0x50, 0x51, 0xfb, 0xff, 	/*Color of index 22*/
-  0x61, 0x5d, 0xca, 0xff, 	/*Color of index 23*/
-  0x6b, 0x64, 0xaa, 0xff, 	/*Color of index 24*/
-  0x47, 0x4c, 0xf9, 0xff, 	/*Color of index 25*/
-  0x4f, 0x4e, 0xe6, 0xff, 	/*Color of index 26*/
-  0x70, 0x65, 0x8d, 0xff, 	/*Color of index 27*/
-  0x3c, 0x47, 0xfa, 0xff, 	/*Color of index 28*/
-  0x31, 0x4e, 0xe3, 0xff, 	/*Color of index 29*/
-  0x46, 0x42, 0xf9, 0xff, 	/*Color of index 30*/
-  0x0c, 0x4a, 0xf0, 0xff, 	/*Color of index 31*/
-  0x67, 0x68, 0x6c, 0xff, 	/*Color of index 32*/
-  0x52, 0x4d, 0xcd, 0xff, 	/*Color of index 33*/
-  0x4e, 0x4d, 0xb6, 0xff, 	/*Color of index 34*/
-  0x42, 0x39, 0xf9, 0xff, 	/*Color of index 35*/
-  0x44, 0x3d, 0xe8, 0xff, 	/*Color of index 36*/
-  0x26, 0x46, 0xce, 0xff, 	/*Color of index 37*/
-  0x4b, 0x40, 0xce, 0xff, 	/*Color of index 38*/
-  0x55, 0x4e, 0x98, 0xff, 	/*Color of index 39*/
-  0x3a, 0x34, 0xf5, 0xff, 	/*Color of index 40*/
-  0x0a, 0x43, 0xd1, 0xff, 	/*Color of index 41*/
-  0x40, 0x38, 0xd9, 0xff, 	/*Color of index 42*/
-  0x37, 0x32, 0xe9, 0xff, 	/*Color of index 43*/
-  0x44, 0x3f, 0xb5, 0xff, 	/*Color of index 44*/
-  0x4d, 0x4e, 0x7e, 0xff, 	/*Color of index 45*/
-  0x36, 0x2b, 0xf5, 0xff, 	/*Color of index 46*/
-  0x40, 0x35, 0xc4, 0xff, 	/*Color of index 47*/
-  0x12, 0x3d, 0xb4, 0xff, 	/*Color of index 48*/
-  0x34, 0x24, 0xfb, 0xff, 	/*Color of index 49*/
-  0x37, 0x2b, 0xdd, 0xff, 	/*Color of index 50*/
-  0x3f, 0x3d, 0x9d, 0xff, 	/*Color of index 51*/
-  0x30, 0x25, 0xeb, 0xff, 	/*Color of index 52*/
-  0x39, 0x2c, 0xca, 0xff, 	/*Color of index 53*/
-  0x2a, 0x26, 0xdf, 0xff, 	/*Color of index 54*/
-  0x2a, 0x20, 0xf3, 0xff, 	/*Color of index 55*/
-  0x29, 0x1c, 0xfc, 0xff, 	/*Color of index 56*/
-  0x2b, 0x20, 0xea, 0xff, 	/*Color of index 57*/
-  0x38, 0x2f, 0xb1, 0xff, 	/*Color of index 58*/
-  0x23, 0x1d, 0xf4, 0xff, 	/*Color of index 59*/
-  0x23, 0x1a, 0xfc, 0xff, 	/*Color of index 60*/
-  0x2a, 0x26, 0xcd, 0xff, 	/*Color of index 61*/
-  0x23, 0x1d, 0xe9, 0xff, 	/*Color of index 62*/
-  0x19, 0x21, 0xde, 0xff, 	/*Color of index 63*/
-  0x25, 0x1e, 0xe1, 0xff, 	/*Color of index 64*/
-  0x2d, 0x18, 0xf2, 0xff, 	/*Color of index 65*/
-  0x23, 0x14, 0xfd, 0xff, 	/*Color of index 66*/
-  0x0c, 0x25, 0xca, 0xff, 	/*Color of index 67*/
-  0x3d, 0x37, 0x7c, 0xff, 	/*Color of index 68*/
-  0x38, 0x2e, 0x9b, 0xff, 	/*Color of index 69*/
-  0x22, 0x1e, 0xd3, 0xff, 	/*Color of index 70*/
-  0x28, 0x18, 0xe0, 0xff, 	/*Color of index 71*/
-  0x35, 0x22, 0xb4, 0xff, 	/*Color of index 72*/
-  0x22, 0x11, 0xed, 0xff, 	/*Color of index 73*/
-  0x06, 0x2c, 0x9b, 0xff, 	/*Color of index 74*/
-  0x08, 0x24, 0xb5, 0xff, 	/*Color of index 75*/
-  0x22, 0x1c, 0xc5, 0xff, 	/*Color of index 76*/
-  0x2a, 0x18, 0xcf, 0xff, 	/*Color of index 77*/
-  0x26, 0x1d, 0xb6, 0xff, 	/*Color of index 78*/
-  0x32, 0x2a, 0x84, 0xff, 	/*Color of index 79*/
-  0x20, 0x11, 0xde, 0xff, 	/*Color of index 80*/
-  0x26, 0x22, 0x9b, 0xff, 	/*Color of index 81*/
-  0x20, 0x13, 0xce, 0xff, 	/*Color of index 82*/
-  0x31, 0x1e, 0x96, 0xff, 	/*Color of index 83*/
-  0x3b, 0x23, 0x7e, 0xff, 	/*Color of index 84*/
-  0x1e, 0x25, 0x7d, 0xff, 	/*Color of index 85*/
-  0x21, 0x12, 0xb6, 0xff, 	/*Color of index 86*/
-  0x31, 0x26, 0x63, 0xff, 	/*Color of index 87*/
-  0x16, 0x09, 0xcc, 0xff, 	/*Color of index 88*/
-  0x28, 0x18, 0x7d, 0xff, 	/*Color of index 89*/
-  0x1a, 0x0f, 0x9c, 0xff, 	/*Color of index 90*/
-  0x2a, 0x20, 0x4c, 0xff, 	/*Color of index 91*/
-  0x12, 0x03, 0xb4, 0xff, 	/*Color of index 92*/
-  0x23, 0x16, 0x65, 0xff, 	/*Color of index 93*/
-  0x1a, 0x0e, 0x7d, 0xff, 	/*Color of index 94*/
-  0x13, 0x0c, 0x63, 0xff, 	/*Color of index 95*/
-  0x1c, 0x0e, 0x4a, 0xff, 	/*Color of index 96*/
-  0x0c, 0x04, 0x4c, 0xff, 	/*Color of index 97*/
-  0x07, 0x01, 0x37, 0xff, 	/*Color of index 98*/
-  0x07, 0x00, 0x27, 0xff, 	/*Color of index 99*/
-  0x03, 0x00, 0x18, 0xff, 	/*Color of index 100*/
-  0x02, 0x00, 0x0b, 0xff, 	/*Color of index 101*/
-  0x91, 0xe3, 0xf7, 0xff, 	/*Color of index 102*/
-  0x6b, 0xe0, 0xf8, 0xff, 	/*Color of index 103*/
-  0xa9, 0xdc, 0xec, 0xff, 	/*Color of index 104*/
-  0x56, 0xdc, 0xfa, 0xff, 	/*Color of index 105*/
-  0x36, 0xdd, 0xfa, 0xff, 	/*Color of index 106*/
-  0x44, 0xd7, 0xfc, 0xff, 	/*Color of index 107*/
-  0x19, 0xd8, 0xfb, 0xff, 	/*Color of index 108*/
-  0x33, 0xcc, 0xfc, 0xff, 	/*Color of index 109*/
-  0x6f, 0xcd, 0xdb, 0xff, 	/*Color of index 110*/
-  0x6c, 0xc1, 0xf0, 0xff, 	/*Color of index 111*/
-  0x2c, 0xc0, 0xf5, 0xff, 	/*Color of index 112*/
-  0x87, 0xb6, 0xf0, 0xff, 	/*Color of index 113*/
-  0x49, 0xb9, 0xfa, 0xff, 	/*Color of index 114*/
-  0x48, 0xb9, 0xe2, 0xff, 	/*Color of index 115*/
-  0x10, 0xb9, 0xe8, 0xff, 	/*Color of index 116*/
-  0x6d, 0xb8, 0xc2, 0xff, 	/*Color of index 117*/
-  0x8c, 0xac, 0xd4, 0xff, 	/*Color of index 118*/
-  0x35, 0xa7, 0xf8, 0xff, 	/*Color of index 119*/
-  0x5d, 0xa2, 0xe8, 0xff, 	/*Color of index 120*/
-  0x26, 0xa5, 0xd7, 0xff, 	/*Color of index 121*/
-  0x43, 0x92, 0xee, 0xff, 	/*Color of index 122*/
-  0x6c, 0xa1, 0xa7, 0xff, 	/*Color of index 123*/
-  0x4d, 0x8f, 0xdd, 0xff, 	/*Color of index 124*/
-  0x14, 0x96, 0xd2, 0xff, 	/*Color of index 125*/
-  0x1c, 0x8b, 0xf1, 0xff, 	/*Color of index 126*/
-  0x2b, 0x83, 0xf2, 0xff, 	/*Color of index 127*/
-  0x55, 0x8e, 0xa1, 0xff, 	/*Color of index 128*/
-  0x32, 0x81, 0xd7, 0xff, 	/*Color of index 129*/
-  0x46, 0x84, 0xbf, 0xff, 	/*Color of index 130*/
-  0x16, 0x76, 0xee, 0xff, 	/*Color of index 131*/
-  0x2d, 0x6a, 0xec, 0xff, 	/*Color of index 132*/
-  0x2f, 0x6e, 0xcf, 0xff, 	/*Color of index 133*/
-  0x4b, 0x75, 0x98, 0xff, 	/*Color of index 134*/
-  0x15, 0x5f, 0xcc, 0xff, 	/*Color of index 135*/
-  0x27, 0x5d, 0xa7, 0xff, 	/*Color of index 136*/
-  0x1a, 0x36, 0x61, 0xff, 	/*Color of index 137*/
-  0xf8, 0xfa, 0xfa, 0xff, 	/*Color of index 138*/
-  0xd4, 0xf6, 0xf9, 0xff, 	/*Color of index 139*/
-  0xaa, 0xf5, 0xf9, 0xff, 	/*Color of index 140*/
-  0xa9, 0xdd, 0xca, 0xff, 	/*Color of index 141*/
-  0xbf, 0xce, 0xcd, 0xff, 	/*Color of index 142*/
-  0x92, 0xb1, 0xaa, 0xff, 	/*Color of index 143*/
-  0x04, 0x08, 0x00, 0xff, 	/*Color of index 144*/
-  0xfa, 0xf9, 0xf2, 0xff, 	/*Color of index 145*/
-  0xf9, 0xf4, 0xe0, 0xff, 	/*Color of index 146*/
-  0xe9, 0xe7, 0xce, 0xff, 	/*Color of index 147*/
-  0xf7, 0xf3, 0xec, 0xff, 	/*Color of index 148*/
-  0xee, 0xeb, 0xe6, 0xff, 	/*Color of index 149*/
-  0xee, 0xe6, 0xda, 0xff, 	/*Color of index 150*/
-  0xeb, 0xe3, 0xda, 0xff, 	/*Color of index 151*/
-  0xea, 0xe3, 0xd4, 0xff, 	/*Color of index 152*/
-  0xe7, 0xdf, 0xd9, 0xff, 	/*Color of index 153*/
-  0xe6, 0xde, 0xd1, 0xff, 	/*Color of index 154*/
-  0xe1, 0xd7, 0xc7, 0xff, 	/*Color of index 155*/
-  0xd8, 0xd3, 0xd0, 0xff, 	/*Color of index 156*/
-  0xd8, 0xce, 0xc2, 0xff, 	/*Color of index 157*/
-  0xd5, 0xca, 0xba, 0xff, 	/*Color of index 158*/
-  0xd2, 0xc5, 0xb6, 0xff, 	/*Color of index 159*/
-  0xc9, 0xc1, 0xb7, 0xff, 	/*Color of index 160*/
-  0xcf, 0xbf, 0xaa, 0xff, 	/*Color of index 161*/
-  0xc7, 0xbb, 0xb0, 0xff, 	/*Color of index 162*/
-  0xcb, 0xbc, 0xab, 0xff, 	/*Color of index 163*/
-  0xc9, 0xbc, 0xa2, 0xff, 	/*Color of index 164*/
-  0xc6, 0xb9, 0xa9, 0xff, 	/*Color of index 165*/
-  0xc1, 0xb5, 0xab, 0xff, 	/*Color of index 166*/
-  0xc0, 0xb2, 0x9f, 0xff, 	/*Color of index 167*/
-  0xd1, 0xb8, 0x83, 0xff, 	/*Color of index 168*/
-  0xc9, 0xb4, 0x90, 0xff, 	/*Color of index 169*/
-  0xbb, 0xae, 0x9d, 0xff, 	/*Color of index 170*/
-  0xb5, 0xaa, 0x9c, 0xff, 	/*Color of index 171*/
-  0xbe, 0xaa, 0x90, 0xff, 	/*Color of index 172*/
-  0xaa, 0xa5, 0x9e, 0xff, 	/*Color of index 173*/
-  0xb5, 0xa4, 0x8f, 0xff, 	/*Color of index 174*/
-  0xbf, 0xa6, 0x7f, 0xff, 	/*Color of index 175*/
-  0xaa, 0xa1, 0x93, 0xff, 	/*Color of index 176*/
-  0xb0, 0x9f, 0x7f, 0xff, 	/*Color of index 177*/
-  0xaa, 0x9a, 0x8b, 0xff, 	/*Color of index 178*/
-  0xb0, 0x9b, 0x7f, 0xff, 	/*Color of index 179*/
-  0xab, 0x99, 0x81, 0xff, 	/*Color of index 180*/
-  0x9f, 0x95, 0x8c, 0xff, 	/*Color of index 181*/
-  0xa5, 0x94, 0x80, 0xff, 	/*Color of index 182*/
-  0xaf, 0x96, 0x6f, 0xff, 	/*Color of index 183*/
-  0x9b, 0x91, 0x7d, 0xff, 	/*Color of index 184*/
-  0x9c, 0x8c, 0x7e, 0xff, 	/*Color of index 185*/
-  0x8f, 0x86, 0x7d, 0xff, 	/*Color of index 186*/
-  0x9b, 0x88, 0x72, 0xff, 	/*Color of index 187*/
-  0x9e, 0x88, 0x67, 0xff, 	/*Color of index 188*/
-  0x90, 0x81, 0x6e, 0xff, 	/*Color of index 189*/
-  0x90, 0x7d, 0x6c, 0xff, 	/*Color of index 190*/
-  0x9a, 0x80, 0x52, 0xff, 	/*Color of index 191*/
-  0x86, 0x78, 0x6b, 0xff, 	/*Color of index 192*/
-  0x8e, 0x7a, 0x5f, 0xff, 	/*Color of index 193*/
-  0x77, 0x71, 0x6d, 0xff, 	/*Color of index 194*/
-  0x82, 0x72, 0x5f, 0xff, 	/*Color of index 195*/
-  0x77, 0x6b, 0x60, 0xff, 	/*Color of index 196*/
-  0x82, 0x6d, 0x52, 0xff, 	/*Color of index 197*/
-  0x8f, 0x6e, 0x30, 0xff, 	/*Color of index 198*/
-  0x78, 0x66, 0x52, 0xff, 	/*Color of index 199*/
-  0xa2, 0x70, 0x1c, 0xff, 	/*Color of index 200*/
-  0x65, 0x60, 0x5e, 0xff, 	/*Color of index 201*/
-  0x77, 0x64, 0x45, 0xff, 	/*Color of index 202*/
-  0xa6, 0x6e, 0x10, 0xff, 	/*Color of index 203*/
-  0x6d, 0x5c, 0x4c, 0xff, 	/*Color of index 204*/
-  0x71, 0x5c, 0x41, 0xff, 	/*Color of index 205*/
-  0x8e, 0x64, 0x13, 0xff, 	/*Color of index 206*/
-  0x6c, 0x58, 0x3d, 0xff, 	/*Color of index 207*/
-  0x9a, 0x61, 0x0f, 0xff, 	/*Color of index 208*/
-  0x5d, 0x54, 0x4f, 0xff, 	/*Color of index 209*/
-  0x7d, 0x58, 0x2b, 0xff, 	/*Color of index 210*/
-  0x66, 0x52, 0x3c, 0xff, 	/*Color of index 211*/
-  0x8a, 0x57, 0x1e, 0xff, 	/*Color of index 212*/
-  0x8b, 0x58, 0x0e, 0xff, 	/*Color of index 213*/
-  0x80, 0x56, 0x14, 0xff, 	/*Color of index 214*/
-  0x64, 0x4b, 0x3e, 0xff, 	/*Color of index 215*/
-  0x52, 0x48, 0x40, 0xff, 	/*Color of index 216*/
-  0x6f, 0x4d, 0x1c, 0xff, 	/*Color of index 217*/
-  0x77, 0x4e, 0x09, 0xff, 	/*Color of index 218*/
-  0x63, 0x45, 0x2e, 0xff, 	/*Color of index 219*/
-  0x76, 0x47, 0x0e, 0xff, 	/*Color of index 220*/
-  0x53, 0x3e, 0x2d, 0xff, 	/*Color of index 221*/
-  0x64, 0x41, 0x14, 0xff, 	/*Color of index 222*/
-  0x69, 0x40, 0x0a, 0xff, 	/*Color of index 223*/
-  0x6a, 0x41, 0x05, 0xff, 	/*Color of index 224*/
-  0x5a, 0x3b, 0x17, 0xff, 	/*Color of index 225*/
-  0x43, 0x35, 0x30, 0xff, 	/*Color of index 226*/
-  0x64, 0x3d, 0x07, 0xff, 	/*Color of index 227*/
-  0x4c, 0x35, 0x20, 0xff, 	/*Color of index 228*/
-  0x54, 0x32, 0x10, 0xff, 	/*Color of index 229*/
-  0x3e, 0x2b, 0x21, 0xff, 	/*Color of index 230*/
-  0x2d, 0x22, 0x1b, 0xff, 	/*Color of index 231*/
-  0x3c, 0x22, 0x11, 0xff, 	/*Color of index 232*/
-  0x23, 0x19, 0x11, 0xff, 	/*Color of index 233*/
-  0x24, 0x15, 0x09, 0xff, 	/*Color of index 234*/
-  0x19, 0x12, 0x0b, 0xff, 	/*Color of index 235*/
-  0x12, 0x0a, 0x06, 0xff, 	/*Color of index 236*/
-  0x07, 0x04, 0x02, 0xff, 	/*Color of index 237*/
-  0x46, 0x3d, 0x41, 0xff, 	/*Color of index 238*/
-  0x26, 0x19, 0x1d, 0xff, 	/*Color of index 239*/
-  0x1c, 0x13, 0x13, 0xff, 	/*Color of index 240*/
-  0xe7, 0xe0, 0xe4, 0xff, 	/*Color of index 241*/
-  0xc2, 0xbc, 0xbf, 0xff, 	/*Color of index 242*/
-  0x87, 0x79, 0x84, 0xff, 	/*Color of index 243*/
-  0x42, 0x24, 0x3a, 0xff, 	/*Color of index 244*/
-  0x09, 0x07, 0x08, 0xff, 	/*Color of index 245*/
-  0xf7, 0xf6, 0xf9, 0xff, 	/*Color of index 246*/
-  0xdd, 0xd8, 0xe4, 0xff, 	/*Color of index 247*/
-  0xae, 0xab, 0xb3, 0xff, 	/*Color of index 248*/
-  0x9d, 0x95, 0x9e, 0xff, 	/*Color of index 249*/
-  0x8f, 0x84, 0xa0, 0xff, 	/*Color of index 250*/
-  0x55, 0x4b, 0x65, 0xff, 	/*Color of index 251*/
-  0x47, 0x33, 0x62, 0xff, 	/*Color of index 252*/
-  0x2b, 0x22, 0x2e, 0xff, 	/*Color of index 253*/
-  0x18, 0x09, 0x30, 0xff, 	/*Color of index 254*/
-  0x15, 0x08, 0x1b, 0xff, 	/*Color of index 255*/
-
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x90, 0x01, 0x90, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x90, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0x65, 0x01, 0xf5, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x90, 0x01, 0x90, 0x01, 0x90, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x90, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x90, 0x01, 0x90, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x90, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0x65, 0x01, 0xf5, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xf5, 0x01, 0xed, 0xed, 0x01, 0x90, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x90, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x65, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xf5, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xec, 0xec, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xf5, 0xed, 0x01, 0xf5, 0x01, 0x01, 0x01, 0xf5, 0xed, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xed, 0xed, 0xf5, 0xf5, 0x01, 0xf5, 0xed, 0x01, 0xed, 0xf5, 0xed, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0xf5, 0xf5, 0xf5, 0x01, 0x90, 0xec, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xf5, 0xed, 0xed, 0x90, 0xed, 0xed, 0xed, 0x01, 0x01, 0xf5, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xf5, 0xed, 0x01, 0xed, 0x90, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0xf5, 0x65, 0xf5, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xed, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0xed, 0x01, 0x01, 0xf5, 0x01, 0xf5, 0xed, 0xed, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x01, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x90, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xed, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x90, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xf5, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0x90, 0x01, 0x01, 0x90, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xf5, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x65, 0x01, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xf5, 0x01, 0x01, 0xed, 0xe7, 0xe2, 0xd8, 0xd8, 0xe2, 0xe7, 0x90, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xf5, 0x01, 0xed, 0xf5, 0x01, 0x01, 0xec, 0xee, 0xc9, 0xc2, 0xba, 0xc0, 0xc2, 0xd8, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xec, 0x01, 0x01, 0x01, 0xeb, 0xec, 0xe9, 0xef, 0xeb, 0x01, 0x01, 0x01, 0x01, 0xec, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xec, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x90, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0xf5, 0x65, 0x65, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0xf5, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x01, 0x65, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xd1, 0xb5, 0xaa, 0xa2, 0xa0, 0x9e, 0xa0, 0xaa, 0xc0, 0xe2, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0xb8, 0x9e, 0x9b, 0x98, 0x98, 0x9b, 0x9a, 0x9d, 0xb0, 0xe2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0xed, 0xed, 0x01, 0x01, 0xe2, 0xc9, 0xb9, 0xad, 0xf8, 0xaa, 0xf9, 0xc2, 0xe6, 0xed, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xed, 0xe2, 0xc9, 0xc2, 0xb8, 0xb5, 0xb8, 0xc2, 0xe2, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0x01, 0x01, 0xec, 0xe2, 0xd8, 0xc9, 0xd1, 0xd8, 0xe6, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xeb, 0xe9, 0xea, 0xeb, 0xeb, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x64, 0x65, 0x64, 0x65, 0x65, 0x65, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x64, 0x64, 0xff, 0xff, 0xff, 0xff, 0x64, 0xff, 0x65, 0x65, 0x01, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xfd, 0xba, 0x9d, 0x9c, 0x9d, 0x9d, 0x9e, 0x9e, 0x9e, 0x9d, 0x9d, 0xb0, 0xd8, 0xed, 0x01, 0xec, 0x01, 0xec, 0x01, 0x01, 0xee, 0xaa, 0x96, 0x97, 0x9b, 0x9a, 0x9b, 0x9b, 0x9a, 0x96, 0x96, 0xad, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xed, 0x01, 0xed, 0xc9, 0x9f, 0x9b, 0x9c, 0x99, 0x9d, 0x9c, 0x98, 0x9c, 0xad, 0xd1, 0xec, 0x01, 0x01, 0xed, 0xed, 0x01, 0xec, 0xf5, 0x01, 0xf0, 0xc2, 0xa0, 0x9c, 0x9c, 0x99, 0x9b, 0x9d, 0x9c, 0xa6, 0xc4, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0xd1, 0xad, 0xa0, 0xa0, 0x9c, 0x9b, 0x9c, 0xa0, 0xb5, 0xd8, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xe6, 0xc9, 0xb5, 0xad, 0xae, 0xf9, 0xba, 0xc9, 0xfd, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe7, 0xe2, 0xd8, 0xd1, 0xd1, 0xd1, 0xe2, 0xe9, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0xfe, 0x5b, 0x89, 0x89, 0x89, 0x89, 0x89, 0xfd, 0xfd, 0xee, 0xd1, 0xc9, 0xc9, 0xd1, 0xd1, 0xd1, 0xd1, 0xd8, 0xfb, 0xfc, 0xfc, 0x57, 0xfc, 0x4f, 0xfc, 0xfc, 0xfc, 0xfc, 0xe2, 0xe2, 0xe4, 0xe4, 0xe6, 0xe6, 0xe6, 0xe6, 0xdd, 0xd1, 0xd1, 0xd1, 0xd1, 0xfb, 0xd8, 0x89, 0xee, 0x89, 0x2d, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x88, 0xfb, 0x5b, 0xff, 0x65, 0x01, 0x01, 0x01, 0x01, 0xec, 0x01, 0x01, 0xed, 0x01, 0xe9, 0xb9, 0x9c, 0x9b, 0x9e, 0x9e, 0xa1, 0x9f, 0xa4, 0xa1, 0xa1, 0x9e, 0x9a, 0xb0, 0xe6, 0x01, 0xed, 0x01, 0xec, 0x01, 0xe6, 0xa6, 0x95, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x96, 0xb5, 0xe7, 0x01, 0x01, 0x01, 0x01, 0xec, 0x01, 0xed, 0xbe, 0x9e, 0x9b, 0x9c, 0x9b, 0x9d, 0x9c, 0x9d, 0x9c, 0x9b, 0x9a, 0xad, 0xd8, 0xf5, 0x01, 0xec, 0x01, 0xed, 0xec, 0x01, 0xe9, 0xba, 0x99, 0x9a, 0x9e, 0x9a, 0x9e, 0x9b, 0x9d, 0x9d, 0x9a, 0xa2, 0xc2, 0xe9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xc0, 0x9e, 0x9c, 0x9b, 0x9d, 0x9c, 0x9b, 0x9d, 0x9b, 0x96, 0xa0, 0xc7, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe2, 0xb2, 0x9d, 0x9b, 0x9e, 0x9e, 0x9e, 0x9e, 0x8e, 0xad, 0xd1, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xef, 0xc9, 0xb0, 0xa0, 0xa0, 0x9e, 0x9d, 0xa0, 0xa0, 0xb5, 0xd1, 0xf0, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0xed, 0xed, 0xed, 0x01, 0x65, 0x65, 0x63, 0x89, 0x88, 0x82, 0x7c, 0x7c, 0x7c, 0x7a, 0x82, 0x82, 0x86, 0x6e, 0x68, 0xf7, 0xf7, 0xf7, 0x9c, 0x8e, 0x08, 0x08, 0x07, 0x13, 0x22, 0x21, 0x26, 0x21, 0x21, 0x26, 0x18, 0x27, 0xc9, 0xc7, 0xd2, 0xd2, 0xd2, 0xd2, 0xd7, 0xd7, 0xb0, 0x93, 0x95, 0x98, 0x97, 0xf1, 0x02, 0x05, 0x80, 0x82, 0x79, 0x78, 0x78, 0x7a, 0x7a, 0x7a, 0x7f, 0x7a, 0x7f, 0x82, 0x88, 0xfd, 0x65, 0xed, 0xed, 0x01, 0xe9, 0x01, 0xed, 0xed, 0xed, 0xcc, 0x9d, 0x9b, 0x9e, 0x9e, 0x9e, 0x9e, 0xa1, 0x9f, 0xa1, 0x9f, 0xa3, 0x9f, 0x9d, 0xc9, 0xec, 0xed, 0xed, 0xed, 0x01, 0xb5, 0x96, 0x9a, 0x9b, 0x9b, 0x93, 0x9b, 0x9a, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0xc3, 0xec, 0x01, 0xed, 0x01, 0x01, 0x01, 0xcf, 0x99, 0x9f, 0x9d, 0x9b, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9e, 0xb0, 0xe2, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0xc2, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9e, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9f, 0x20, 0xec, 0x01, 0x01, 0x65, 0x01, 0x01, 0xc9, 0x9d, 0x9a, 0xa0, 0x9d, 0x9f, 0x9e, 0x9d, 0x9f, 0x9c, 0x9d, 0x9b, 0x9d, 0xc2, 0xe9, 0x01, 0xed, 0xed, 0xed, 0x90, 0x01, 0xe6, 0xb2, 0x9a, 0xa0, 0x9d, 0x9f, 0xa3, 0x9f, 0xa1, 0x9e, 0x9e, 0xa6, 0xc9, 0xec, 0x01, 0x01, 0x01, 0xf5, 0xed, 0xed, 0xe2, 0xb5, 0xa0, 0x9d, 0x9d, 0x9d, 0x9d, 0x9e, 0x9d, 0x9d, 0x9d, 0xa0, 0xbe, 0xea, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xf5, 0x64, 0x62, 0x2d, 0x7a, 0x78, 0x7a, 0x7a, 0x7f, 0x81, 0x7e, 0x7e, 0x81, 0x82, 0x71, 0x68, 0x8e, 0x9c, 0x9e, 0x8e, 0x8e, 0x8e, 0x08, 0x13, 0x45, 0x35, 0x32, 0x32, 0x31, 0x32, 0x32, 0x2f, 0x33, 0xfc, 0xdb, 0xdc, 0xd4, 0xdc, 0xdb, 0xdb, 0xe6, 0xbe, 0x9a, 0x95, 0x95, 0xf1, 0x02, 0x02, 0x06, 0x7c, 0x7c, 0x78, 0x7e, 0x7a, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7c, 0x86, 0x5b, 0x01, 0x65, 0xec, 0x01, 0xf5, 0xed, 0x01, 0xe7, 0xad, 0x9b, 0x9e, 0x9f, 0x9e, 0x9e, 0x9e, 0x9f, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0x9d, 0xb6, 0xef, 0x01, 0xec, 0x01, 0xd8, 0x9c, 0x98, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9e, 0x9a, 0x9b, 0xa7, 0xd8, 0x01, 0xed, 0x90, 0x01, 0xe6, 0xab, 0x9b, 0x9f, 0x9d, 0x9d, 0x9e, 0x9d, 0x9b, 0x9b, 0x9d, 0x9b, 0x9e, 0x9d, 0xa0, 0xc2, 0xf5, 0xed, 0x01, 0xec, 0x01, 0xe6, 0xa5, 0x9d, 0x9e, 0x9e, 0x9b, 0x9f, 0x9d, 0x9d, 0x9d, 0x9d, 0x9e, 0x9e, 0x9d, 0xb0, 0xee, 0xed, 0x01, 0xed, 0x01, 0xfd, 0xa2, 0x9b, 0xa2, 0x9e, 0x9b, 0xa2, 0x9f, 0x9d, 0x9f, 0x9b, 0x9e, 0xa2, 0x9b, 0x9f, 0xc2, 0xeb, 0x01, 0x01, 0xed, 0xed, 0xec, 0xbd, 0x9c, 0x9e, 0xa7, 0x9e, 0x9f, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0x9b, 0xab, 0xd8, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xb5, 0x9e, 0x9e, 0x9e, 0x9f, 0x9e, 0x9f, 0x9f, 0x9e, 0x9d, 0xa2, 0x9c, 0x9d, 0xc2, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0x90, 0xed, 0x90, 0xed, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xf5, 0x65, 0x64, 0x89, 0x7c, 0x7a, 0x81, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x83, 0x7f, 0x85, 0x80, 0x71, 0x8e, 0x8e, 0x9e, 0x8e, 0xa2, 0xf7, 0x0a, 0x33, 0x5a, 0x32, 0x41, 0x41, 0x41, 0x41, 0x41, 0x35, 0x53, 0xf4, 0xf4, 0xde, 0xdb, 0xdc, 0xdb, 0xdb, 0xe6, 0xc4, 0x9d, 0xf1, 0xf7, 0x04, 0x03, 0x04, 0x0c, 0x82, 0x7a, 0x7e, 0x83, 0x7f, 0x7f, 0x7f, 0x7f, 0x83, 0x83, 0x83, 0x7f, 0x7f, 0x7c, 0x86, 0x63, 0x64, 0xff, 0x65, 0xf5, 0x01, 0x65, 0xd8, 0x99, 0xf7, 0x9c, 0x9c, 0x9c, 0x9d, 0x9c, 0x9e, 0x9d, 0xa0, 0x9f, 0x9d, 0xa1, 0xab, 0xbd, 0xe2, 0xe9, 0xea, 0x01, 0xb2, 0x91, 0x9b, 0x9b, 0x93, 0x93, 0x98, 0x9a, 0x9a, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0xb5, 0xf0, 0xec, 0xed, 0x01, 0xc0, 0x9a, 0xa1, 0x9d, 0x9d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0xa2, 0xa6, 0xb0, 0xe7, 0x01, 0xec, 0xed, 0xed, 0xc2, 0x9b, 0x9e, 0x9e, 0xa1, 0x9e, 0x9e, 0x9d, 0x9e, 0x9d, 0x9e, 0x9d, 0x9f, 0x9d, 0xa0, 0xc4, 0xeb, 0xed, 0xec, 0x01, 0xc4, 0x9a, 0x9e, 0xa0, 0x9f, 0x9d, 0x9f, 0x9d, 0x9d, 0x9f, 0x9d, 0x9d, 0xa5, 0x9e, 0x9b, 0xad, 0xdd, 0x01, 0xec, 0x90, 0x01, 0xd8, 0xa2, 0x9e, 0xa0, 0x9e, 0x9b, 0x9d, 0x9e, 0x9f, 0xa1, 0xa4, 0xa2, 0x9e, 0x9d, 0xb9, 0xec, 0x01, 0x01, 0x01, 0xe7, 0xf3, 0x9f, 0x9e, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9d, 0x9e, 0x9f, 0xa0, 0xa0, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0xed, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x65, 0xfe, 0x82, 0x78, 0x81, 0x83, 0x7f, 0x83, 0x83, 0x83, 0x7e, 0x83, 0x83, 0x83, 0x88, 0x71, 0x8e, 0x8e, 0x9e, 0x9e, 0xa0, 0x8d, 0x0c, 0x55, 0x5c, 0x34, 0x41, 0x49, 0x42, 0x41, 0x39, 0x35, 0x54, 0x57, 0xe5, 0xdb, 0xdc, 0xdc, 0xdc, 0xdb, 0xe5, 0xd7, 0x9f, 0x99, 0x9c, 0x02, 0x03, 0x05, 0x82, 0x81, 0x7a, 0x7e, 0x7f, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x81, 0x0b, 0x89, 0x63, 0x01, 0x01, 0x01, 0x01, 0x01, 0xd1, 0xf2, 0xa6, 0xad, 0xad, 0xb0, 0xab, 0xad, 0xab, 0xad, 0xb0, 0xad, 0xab, 0xb8, 0xd8, 0xdd, 0xe6, 0xe4, 0x90, 0xec, 0xb8, 0xa3, 0xae, 0xaa, 0xa7, 0xa4, 0xaa, 0xaa, 0xad, 0xb0, 0xb0, 0xb2, 0xb2, 0xb2, 0xb0, 0xa6, 0xb5, 0xe6, 0xeb, 0x01, 0xeb, 0xb0, 0x9f, 0xa5, 0x9f, 0x9e, 0x9d, 0x9e, 0x9d, 0x9d, 0x9b, 0x9b, 0x9b, 0x9a, 0x9f, 0xf2, 0xa6, 0xee, 0xed, 0xec, 0x01, 0xe7, 0xa5, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x98, 0x9e, 0x9b, 0x9e, 0x9b, 0x9e, 0x9d, 0x9d, 0x9d, 0xc0, 0xf0, 0x90, 0xed, 0x01, 0xaa, 0x9d, 0x9f, 0x9d, 0x9f, 0xa1, 0x9d, 0x9e, 0x9f, 0xa1, 0x9f, 0x9e, 0x9f, 0x9f, 0x9f, 0x9e, 0xb5, 0xef, 0xed, 0xed, 0xec, 0xbd, 0xa0, 0xa5, 0x9f, 0x9e, 0xa1, 0x9e, 0x9b, 0x9e, 0xa1, 0xa1, 0xa1, 0xa3, 0xa0, 0xa6, 0xe2, 0x01, 0xed, 0xed, 0xd8, 0xaa, 0x9e, 0x9e, 0x9e, 0x9e, 0x9d, 0x9e, 0x9d, 0x9e, 0x9d, 0xa0, 0x9b, 0xa0, 0x9e, 0x9d, 0xb0, 0xe7, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0xed, 0x90, 0x90, 0x90, 0x90, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x89, 0x78, 0x7c, 0x83, 0x7e, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7f, 0x88, 0x76, 0x8e, 0x8d, 0x9e, 0x9b, 0x8d, 0xf7, 0x0d, 0x59, 0x5c, 0x41, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x35, 0x54, 0xf4, 0xe4, 0xe0, 0xe0, 0xe0, 0xda, 0xdc, 0xe5, 0xe1, 0xaa, 0x98, 0x8d, 0x95, 0x02, 0x75, 0x13, 0x79, 0x7a, 0x7e, 0x7e, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7f, 0x83, 0x83, 0x7f, 0x7c, 0x63, 0xfe, 0xd8, 0xb5, 0xba, 0xba, 0xb0, 0xb5, 0xb0, 0xab, 0xad, 0xab, 0xab, 0xaa, 0xab, 0xa4, 0x8f, 0xaa, 0xaa, 0xb2, 0xc2, 0xc3, 0xc2, 0xbd, 0xc2, 0xcc, 0xb8, 0xc0, 0xbd, 0xba, 0xc0, 0xba, 0xbd, 0xbe, 0xc0, 0xc0, 0xc0, 0xc2, 0xc2, 0xbe, 0xf3, 0xbd, 0xf3, 0xc4, 0xd8, 0xe2, 0xd8, 0xc4, 0xc4, 0xc3, 0xc3, 0xc3, 0xc0, 0xc3, 0xc3, 0xc3, 0xc0, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xbd, 0xe2, 0xed, 0x01, 0x01, 0xe6, 0xb8, 0xb9, 0xb8, 0xbd, 0xb2, 0xb6, 0xb8, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xae, 0xad, 0xc7, 0xea, 0xed, 0x01, 0x01, 0xa6, 0x96, 0x9b, 0x9a, 0x9a, 0x9b, 0x98, 0x98, 0x98, 0x92, 0x98, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0xad, 0xd8, 0x01, 0x01, 0xe9, 0xb5, 0x9e, 0x9e, 0x9d, 0x9e, 0x9f, 0x9b, 0x93, 0x9e, 0xa4, 0xa7, 0x9f, 0xa3, 0xa0, 0x9e, 0xd1, 0x01, 0x01, 0xeb, 0xc0, 0x9e, 0x9e, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9e, 0x9f, 0x9e, 0xa0, 0x9f, 0x9e, 0x9d, 0xa6, 0xa0, 0xd8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x64, 0x2d, 0x7c, 0x85, 0x83, 0x83, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x87, 0x82, 0x68, 0x8e, 0x8e, 0x9e, 0x8d, 0x8e, 0x0c, 0x55, 0x5c, 0x39, 0x49, 0x42, 0x42, 0x49, 0x47, 0x48, 0x53, 0xf4, 0xf4, 0xdf, 0xdf, 0xdc, 0xdc, 0xdc, 0xe5, 0xe5, 0xae, 0x9b, 0x99, 0x03, 0x68, 0x76, 0x82, 0x7c, 0x7e, 0x7e, 0x83, 0x83, 0x83, 0x7e, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7f, 0x87, 0x7c, 0x5d, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x92, 0x91, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x91, 0x91, 0x91, 0x00, 0x91, 0x92, 0x91, 0x91, 0x95, 0x92, 0x94, 0x92, 0x94, 0x94, 0x94, 0xf6, 0x91, 0x95, 0x95, 0x95, 0x96, 0x94, 0x92, 0x95, 0x92, 0x96, 0x93, 0x96, 0x98, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9e, 0x9e, 0x9f, 0xa2, 0xab, 0xa6, 0xa0, 0xaa, 0xab, 0xad, 0xae, 0xb2, 0xb2, 0xb6, 0xb9, 0xb0, 0xb4, 0xb9, 0xbd, 0xbb, 0xbd, 0xba, 0xbe, 0xbd, 0xc0, 0xc3, 0xd1, 0xdd, 0xdd, 0xe7, 0xe8, 0xc3, 0xbd, 0xc3, 0xc5, 0xc0, 0xbe, 0xc3, 0xbe, 0xbe, 0xbb, 0xbd, 0xc0, 0xc1, 0xba, 0xb8, 0xb6, 0xb9, 0xc9, 0xd8, 0xe9, 0xe7, 0xbd, 0xa0, 0x9f, 0x9e, 0x9b, 0x9b, 0x93, 0x9b, 0x9b, 0xa1, 0xa1, 0x9d, 0x9d, 0x9b, 0x9d, 0xc0, 0x01, 0x01, 0xe7, 0xb2, 0x9a, 0x9d, 0x9b, 0x9a, 0x9a, 0x93, 0x9a, 0x93, 0x98, 0x9a, 0x9a, 0x96, 0x9a, 0x9e, 0x9d, 0x9a, 0xc0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0xf5, 0x01, 0x64, 0x86, 0x81, 0x7c, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x7f, 0x88, 0x82, 0x05, 0x8e, 0x8e, 0xa0, 0x8e, 0x68, 0x76, 0x55, 0x5a, 0x34, 0x41, 0x49, 0x49, 0x50, 0x58, 0x48, 0x53, 0xf4, 0xf4, 0xe1, 0xe3, 0xdc, 0xdc, 0xe5, 0xe5, 0xe8, 0xb6, 0xf2, 0x8e, 0x02, 0x04, 0x76, 0x82, 0x81, 0x7f, 0x7f, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x81, 0x44, 0x00, 0x91, 0x91, 0x00, 0x00, 0x91, 0x91, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x9b, 0x9b, 0x9b, 0x9d, 0x9e, 0x9e, 0xa1, 0xa5, 0xa3, 0xa7, 0xaa, 0xaa, 0xa7, 0xb2, 0xb8, 0xb8, 0xba, 0xb9, 0xbd, 0xbb, 0xc3, 0xc9, 0xca, 0xc4, 0xc7, 0xc3, 0xc1, 0xc3, 0xc3, 0xc1, 0xcc, 0xc5, 0xc7, 0xcc, 0xc3, 0xc9, 0xdd, 0xe9, 0xeb, 0xe7, 0xdd, 0xd7, 0xcc, 0xc7, 0xc7, 0xc5, 0xc7, 0xc5, 0xc4, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc4, 0xc7, 0xd8, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x65, 0x86, 0x7c, 0x81, 0x87, 0x7f, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x30, 0x86, 0x06, 0x05, 0x05, 0x8e, 0x08, 0x68, 0x07, 0x4a, 0x5f, 0x3d, 0x32, 0x39, 0x47, 0x4d, 0x48, 0x48, 0x54, 0x60, 0xf4, 0xe5, 0xe5, 0xe1, 0xe5, 0xe5, 0xe5, 0xea, 0xd7, 0xa0, 0xf2, 0x08, 0x68, 0x76, 0x88, 0x82, 0x7e, 0x81, 0x7f, 0x7f, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x87, 0x60, 0xfa, 0x9a, 0x9f, 0xab, 0xf8, 0xab, 0xad, 0xb0, 0xb0, 0xb2, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb0, 0xae, 0xab, 0xaa, 0xac, 0xaa, 0xa7, 0xa7, 0xa7, 0xa7, 0xab, 0xaa, 0xa7, 0xa7, 0xa5, 0xa7, 0xa6, 0xa2, 0xa2, 0xa2, 0x9f, 0xa1, 0x9f, 0x9e, 0x9e, 0x9e, 0x9f, 0x9e, 0x9e, 0x9d, 0x9b, 0x9b, 0x9b, 0x98, 0x98, 0x96, 0x92, 0x92, 0x92, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x91, 0x91, 0x92, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x92, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x92, 0x94, 0x92, 0x92, 0x92, 0x98, 0x9a, 0x9a, 0x9b, 0x9b, 0x9d, 0x9d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9e, 0x9d, 0x9b, 0x9d, 0x9f, 0xa1, 0xa3, 0xa5, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa2, 0xa1, 0xa0, 0xaa, 0xb0, 0xa7, 0xb2, 0xc4, 0xeb, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0x65, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x64, 0x64, 0x64, 0x44, 0x85, 0x0e, 0x7e, 0x84, 0x83, 0x83, 0x84, 0x83, 0x85, 0x83, 0x7f, 0x7f, 0x88, 0x88, 0x78, 0x0c, 0x0c, 0x76, 0x76, 0x76, 0x71, 0x13, 0x5a, 0x5a, 0x56, 0x48, 0x35, 0x48, 0x3a, 0x45, 0x54, 0xf4, 0xf4, 0xf4, 0xe6, 0xe5, 0xe6, 0xe8, 0xf4, 0xea, 0xd1, 0xa6, 0x08, 0x8e, 0x04, 0x76, 0x86, 0x82, 0x7c, 0x81, 0x81, 0x81, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x87, 0x84, 0x29, 0x87, 0x88, 0x89, 0xfb, 0xb9, 0xbe, 0xb5, 0xb9, 0xb9, 0xb9, 0xb9, 0xb5, 0xb5, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb5, 0xb9, 0xba, 0xbd, 0xbe, 0xc0, 0xbd, 0xbd, 0xb9, 0xb2, 0xb2, 0xb8, 0xb6, 0xb9, 0xb6, 0xb6, 0xb8, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xba, 0xb9, 0xb8, 0xbb, 0xb8, 0xbc, 0xb8, 0xbc, 0xbb, 0xbb, 0xba, 0xbb, 0xb9, 0xb9, 0xb9, 0xb9, 0xbb, 0xba, 0xbb, 0xba, 0xbb, 0xba, 0xbb, 0xb9, 0xb9, 0xb6, 0xb6, 0xb8, 0xb6, 0xb2, 0xb2, 0xb2, 0xb0, 0xb2, 0xb0, 0xb0, 0xb0, 0xae, 0xab, 0xac, 0xab, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9d, 0x9e, 0x9d, 0x9d, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x98, 0x98, 0x98, 0x93, 0x92, 0x96, 0x92, 0x96, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x92, 0x92, 0x91, 0x92, 0x95, 0x9a, 0xcc, 0x01, 0xec, 0xeb, 0x01, 0x90, 0xf5, 0x01, 0xed, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xec, 0xed, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x65, 0x01, 0x65, 0x65, 0x63, 0x63, 0x61, 0x5f, 0x4a, 0x30, 0x87, 0x84, 0x84, 0x84, 0x83, 0x84, 0x84, 0x85, 0x84, 0x87, 0x88, 0x30, 0x27, 0x33, 0x22, 0x44, 0x4a, 0x89, 0x33, 0x88, 0x3a, 0x5e, 0x5a, 0x5e, 0x5a, 0x5e, 0x5e, 0x5e, 0x60, 0x60, 0xf4, 0xfd, 0xf4, 0xf4, 0xef, 0xf4, 0xef, 0xff, 0xfd, 0xfb, 0x20, 0x2d, 0x86, 0x1b, 0x88, 0x88, 0x85, 0x85, 0x85, 0x81, 0x0f, 0x85, 0x81, 0x85, 0x85, 0x85, 0x84, 0x85, 0x85, 0x82, 0x82, 0x80, 0xf9, 0xab, 0xa7, 0xad, 0xad, 0xb0, 0xb0, 0xb0, 0xab, 0xab, 0xa7, 0xa6, 0xa7, 0xa7, 0xab, 0xab, 0xad, 0xad, 0xad, 0xf9, 0xb5, 0xf9, 0xf9, 0xad, 0xf9, 0xb2, 0xf9, 0xb2, 0xb2, 0xb0, 0xb0, 0xb0, 0xb5, 0xb2, 0xb2, 0xb0, 0xb0, 0xb2, 0xb4, 0xb2, 0xb4, 0xb4, 0xb1, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb6, 0xb6, 0xb5, 0xb4, 0xb5, 0xb6, 0xb5, 0xb6, 0xb2, 0xb5, 0xb6, 0xb5, 0xb2, 0xb2, 0xb5, 0xb4, 0xb5, 0xb2, 0xb4, 0xb2, 0xb2, 0xb5, 0xb6, 0xb5, 0xb8, 0xb6, 0xb8, 0xb8, 0xbb, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbe, 0xbd, 0xbd, 0xbd, 0xbd, 0xbb, 0xba, 0xbb, 0xb9, 0xb8, 0xb8, 0xb5, 0xb6, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xae, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xac, 0xab, 0xac, 0xab, 0xab, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xad, 0xb0, 0xae, 0xad, 0xae, 0xab, 0xaa, 0xa6, 0xa2, 0xad, 0xe7, 0x01, 0x01, 0xeb, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0x01, 0x01, 0x01, 0x65, 0x65, 0x64, 0x64, 0x64, 0x63, 0x63, 0xfe, 0x60, 0x5b, 0x55, 0x4f, 0x22, 0x33, 0x25, 0x30, 0x29, 0x25, 0x29, 0x1d, 0x1d, 0x87, 0x1d, 0x87, 0x25, 0x87, 0x87, 0x22, 0x2c, 0x30, 0x3a, 0x30, 0x33, 0x30, 0x4a, 0x3a, 0x30, 0x4e, 0x4b, 0x5a, 0x5a, 0x5c, 0x5e, 0x5a, 0x5e, 0x54, 0x5d, 0x57, 0x57, 0x57, 0x54, 0x54, 0x54, 0x60, 0x5d, 0x5d, 0x5d, 0x5d, 0x55, 0x55, 0x33, 0x33, 0x30, 0x88, 0x17, 0x87, 0x11, 0x81, 0x11, 0x7c, 0x0e, 0x7c, 0x0b, 0x7a, 0x0c, 0x78, 0x76, 0x08, 0x7b, 0x8f, 0xf8, 0xad, 0xad, 0xf9, 0xad, 0xad, 0xf8, 0xa2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x08, 0x0a, 0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x08, 0x0a, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xab, 0xa7, 0xa7, 0xa7, 0xac, 0xa7, 0xac, 0xa7, 0xae, 0xb8, 0xb8, 0xb2, 0xb8, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb8, 0xb8, 0xb6, 0xb8, 0xb8, 0xb8, 0xb9, 0xb8, 0xb8, 0xbb, 0xba, 0xbb, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbb, 0xba, 0xb9, 0xba, 0xb9, 0xb2, 0xab, 0xab, 0xab, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb2, 0xb5, 0xb2, 0xb5, 0xb2, 0xb5, 0xb4, 0xb5, 0xb8, 0xb8, 0xb8, 0xb9, 0xb9, 0xba, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xba, 0xbb, 0xba, 0xb9, 0xbb, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbb, 0xb9, 0xb9, 0xba, 0xba, 0xbd, 0xba, 0xc0, 0xbe, 0xba, 0xb9, 0xb9, 0xee, 0xed, 0x01, 0x01, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0x01, 0x01, 0x65, 0x64, 0x63, 0x63, 0x61, 0x5d, 0x55, 0x45, 0x27, 0x17, 0x17, 0x11, 0x0e, 0x0e, 0x12, 0x12, 0x12, 0x14, 0x84, 0x12, 0x84, 0x14, 0x12, 0x12, 0x12, 0x84, 0x14, 0x12, 0x0e, 0x14, 0x12, 0x14, 0x14, 0x14, 0x84, 0x15, 0x15, 0x19, 0x1a, 0x19, 0x1a, 0x1e, 0x24, 0x24, 0x24, 0x26, 0x26, 0x26, 0x2c, 0x26, 0x2c, 0x26, 0x26, 0x2f, 0x26, 0x26, 0x2c, 0x30, 0x26, 0x26, 0x26, 0x26, 0x1d, 0x15, 0x1d, 0x1d, 0x15, 0x15, 0x0f, 0x81, 0x11, 0x81, 0x0e, 0x0f, 0x10, 0x7c, 0x0c, 0x10, 0x0d, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x08, 0x0a, 0x08, 0x0a, 0x08, 0x0a, 0x07, 0x0a, 0x0c, 0x0c, 0x0f, 0x0f, 0x11, 0x11, 0x11, 0x17, 0x0f, 0x0f, 0x0c, 0x0c, 0x09, 0x0a, 0x08, 0xf2, 0x9c, 0xf2, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9e, 0x9e, 0xa6, 0xba, 0xb5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xae, 0xae, 0xb0, 0xb2, 0xab, 0xab, 0xab, 0xaa, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xae, 0xab, 0xab, 0xae, 0xb0, 0xb0, 0x9b, 0x92, 0x92, 0x94, 0x92, 0x94, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x95, 0x92, 0x95, 0x92, 0x96, 0x95, 0x96, 0x92, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x98, 0x96, 0x93, 0x96, 0x93, 0x96, 0x93, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x97, 0x97, 0x97, 0x99, 0x9a, 0x9a, 0x99, 0x9d, 0xbd, 0xe2, 0x90, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x64, 0x64, 0x60, 0x57, 0x45, 0x33, 0x21, 0x15, 0x12, 0x14, 0x12, 0x12, 0x12, 0x1a, 0x14, 0x1a, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x19, 0x14, 0x16, 0x19, 0x19, 0x16, 0x19, 0x14, 0x1d, 0x14, 0x16, 0x1e, 0x19, 0x1c, 0x19, 0x19, 0x19, 0x1e, 0x19, 0x1e, 0x1a, 0x1a, 0x1d, 0x1a, 0x1a, 0x24, 0x1e, 0x2a, 0x24, 0x24, 0x24, 0x24, 0x2a, 0x24, 0x24, 0x24, 0x1a, 0x1d, 0x1a, 0x15, 0x1a, 0x15, 0x21, 0x17, 0x1d, 0x1a, 0x1d, 0x1d, 0x21, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x11, 0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x11, 0x17, 0x11, 0x17, 0x17, 0x22, 0x21, 0x2c, 0x2f, 0x2f, 0x35, 0x3d, 0x3d, 0x4c, 0x3d, 0x3d, 0x3a, 0x2f, 0x2c, 0x22, 0x17, 0x0d, 0x08, 0xf7, 0xf7, 0xf7, 0x9b, 0x9b, 0x9b, 0x93, 0x9a, 0x9a, 0xa0, 0xba, 0xf9, 0xaa, 0xaa, 0xa7, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xa7, 0xaa, 0xa7, 0xa7, 0xa7, 0xaa, 0xaa, 0xae, 0xb2, 0xae, 0xa7, 0xa5, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xaa, 0xab, 0xb0, 0xb0, 0xb2, 0xb9, 0xb5, 0x9d, 0x92, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x97, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x96, 0x95, 0x95, 0x95, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x96, 0x96, 0x92, 0x96, 0x92, 0x95, 0x96, 0x92, 0x96, 0x95, 0x96, 0x95, 0x95, 0x95, 0x95, 0x92, 0x95, 0x92, 0x95, 0x94, 0x95, 0x91, 0x91, 0xa0, 0xc0, 0xe6, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x65, 0x64, 0x63, 0x60, 0x44, 0x22, 0x21, 0x11, 0x12, 0x12, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x14, 0x14, 0x14, 0x14, 0x16, 0x14, 0x14, 0x16, 0x14, 0x16, 0x14, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x19, 0x19, 0x1e, 0x19, 0x1c, 0x16, 0x1d, 0x19, 0x1e, 0x1e, 0x1e, 0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x19, 0x19, 0x1d, 0x19, 0x1d, 0x19, 0x19, 0x1c, 0x19, 0x19, 0x1c, 0x1c, 0x16, 0x19, 0x1e, 0x1a, 0x16, 0x16, 0x14, 0x14, 0x1a, 0x14, 0x1a, 0x14, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x1a, 0x15, 0x1a, 0x19, 0x19, 0x19, 0x1a, 0x1a, 0x14, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x24, 0x24, 0x2a, 0x2a, 0x2b, 0x2b, 0x32, 0x34, 0x39, 0x37, 0x31, 0x41, 0x34, 0x34, 0x36, 0x3d, 0x3d, 0x3a, 0x33, 0x13, 0x08, 0x04, 0x9b, 0x9c, 0x9a, 0x9b, 0x9a, 0x9b, 0x9b, 0x9f, 0xba, 0xf9, 0xaa, 0xa7, 0xab, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xb2, 0xb2, 0xb6, 0xb2, 0xaa, 0xae, 0xb2, 0xae, 0xa3, 0xa5, 0xaa, 0xaa, 0xab, 0xaa, 0xab, 0xaa, 0xab, 0xaa, 0xab, 0xab, 0xae, 0xae, 0xb0, 0xb2, 0xb2, 0xb9, 0xb2, 0x9c, 0x95, 0x98, 0x97, 0x97, 0x98, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x98, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x98, 0x97, 0x98, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x97, 0x96, 0x98, 0x96, 0x96, 0x93, 0x98, 0x93, 0x96, 0x93, 0x97, 0x98, 0x97, 0x98, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x98, 0x95, 0x95, 0x97, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x94, 0x94, 0x94, 0xf8, 0xd8, 0xf5, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x90, 0x90, 0x01, 0xf5, 0x65, 0x01, 0xec, 0x01, 0x65, 0x64, 0x60, 0x55, 0x22, 0x15, 0x12, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x16, 0x19, 0x16, 0x19, 0x16, 0x16, 0x19, 0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x16, 0x19, 0x16, 0x19, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1e, 0x19, 0x1e, 0x16, 0x16, 0x15, 0x16, 0x16, 0x16, 0x16, 0x1e, 0x19, 0x1e, 0x24, 0x23, 0x2b, 0x2e, 0x2e, 0x34, 0x34, 0x39, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x39, 0x39, 0x36, 0x32, 0x3d, 0x2c, 0x0f, 0x06, 0xf7, 0x9a, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0x9f, 0xba, 0xf9, 0xa6, 0xae, 0xbb, 0xc5, 0xc3, 0xc1, 0xc1, 0xc3, 0xc1, 0xc1, 0xc1, 0xc3, 0xc3, 0xc7, 0xc4, 0xb8, 0xb2, 0xb4, 0xaa, 0xa1, 0xb1, 0xb8, 0xbe, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xbd, 0xbb, 0xbb, 0xc1, 0xbd, 0xb6, 0xb2, 0xb6, 0xb9, 0xb5, 0x9b, 0x95, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x96, 0x98, 0x96, 0x98, 0x96, 0x98, 0x96, 0x93, 0x97, 0x97, 0x99, 0x97, 0xf1, 0x97, 0xf1, 0x96, 0x97, 0x96, 0x96, 0x96, 0xf1, 0x96, 0xf1, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x96, 0x96, 0x97, 0x95, 0x96, 0x95, 0x95, 0x96, 0x96, 0x97, 0x94, 0x94, 0xa6, 0xd1, 0xed, 0x01, 0xed, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x01, 0x90, 0x90, 0x01, 0x64, 0x65, 0x01, 0x90, 0x01, 0x64, 0x5d, 0x33, 0x21, 0x15, 0x16, 0x19, 0x19, 0x19, 0x16, 0x16, 0x16, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x16, 0x14, 0x14, 0x14, 0x14, 0x16, 0x14, 0x16, 0x14, 0x16, 0x14, 0x16, 0x14, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x19, 0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x19, 0x19, 0x19, 0x16, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x16, 0x19, 0x16, 0x19, 0x19, 0x19, 0x16, 0x19, 0x19, 0x16, 0x16, 0x16, 0x19, 0x1e, 0x1e, 0x28, 0x23, 0x2e, 0x2b, 0x34, 0x39, 0x39, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x41, 0x3c, 0x38, 0x38, 0x37, 0x37, 0x39, 0x39, 0x32, 0x21, 0x0a, 0xf7, 0x9b, 0x9a, 0x9b, 0x9b, 0x9a, 0x9b, 0x9f, 0xba, 0xb5, 0xaa, 0xb6, 0xca, 0xdb, 0xcf, 0xcd, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xcd, 0xcf, 0xc0, 0xbb, 0xb2, 0xa4, 0xa7, 0xc1, 0xcd, 0xcf, 0xd3, 0xd3, 0xd3, 0xcf, 0xcf, 0xcd, 0xc1, 0xc1, 0xc3, 0xc5, 0xc3, 0xbe, 0xbb, 0xba, 0xb6, 0x9d, 0x95, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0xf1, 0x96, 0x97, 0x96, 0x96, 0x96, 0x97, 0xf1, 0xf1, 0x97, 0x97, 0x96, 0x96, 0x93, 0x96, 0x96, 0x93, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x96, 0x95, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x95, 0x94, 0xa6, 0xe2, 0x01, 0x01, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x90, 0x90, 0x01, 0x65, 0x65, 0xed, 0x01, 0x64, 0x60, 0x33, 0x15, 0x1a, 0x1a, 0x19, 0x19, 0x16, 0x16, 0x16, 0x14, 0x14, 0x14, 0x14, 0x16, 0x14, 0x14, 0x14, 0x16, 0x14, 0x16, 0x16, 0x14, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x19, 0x16, 0x19, 0x19, 0x1a, 0x19, 0x1e, 0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x19, 0x1e, 0x19, 0x1e, 0x19, 0x16, 0x19, 0x19, 0x19, 0x19, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16, 0x19, 0x19, 0x1e, 0x23, 0x23, 0x2e, 0x31, 0x37, 0x3b, 0x3b, 0x39, 0x3b, 0x3e, 0x3e, 0x3b, 0x41, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x3c, 0x41, 0x3b, 0x37, 0x37, 0x37, 0x36, 0x2c, 0x10, 0x05, 0x9a, 0x9b, 0x9c, 0x9a, 0x9b, 0x9b, 0xa1, 0xba, 0xf9, 0xaa, 0xbb, 0xcf, 0xd3, 0xcf, 0xcf, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xca, 0xc7, 0xbd, 0xbd, 0xb6, 0xa4, 0xac, 0xca, 0xd3, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xc1, 0xbe, 0xbc, 0xbe, 0xc3, 0xbd, 0xbd, 0xb8, 0x9b, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x96, 0x97, 0x97, 0xf1, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x92, 0x95, 0xf3, 0xec, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0x01, 0xf5, 0x65, 0x63, 0x45, 0x21, 0x1a, 0x19, 0x1e, 0x1e, 0x19, 0x16, 0x16, 0x14, 0x14, 0x1a, 0x14, 0x19, 0x16, 0x1c, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x23, 0x1e, 0x23, 0x1e, 0x23, 0x23, 0x23, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1c, 0x1e, 0x1c, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x16, 0x19, 0x16, 0x16, 0x16, 0x19, 0x1c, 0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x23, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1c, 0x1e, 0x1e, 0x1e, 0x19, 0x1e, 0x19, 0x19, 0x1e, 0x16, 0x19, 0x16, 0x19, 0x16, 0x19, 0x19, 0x1e, 0x1e, 0x24, 0x2b, 0x2b, 0x32, 0x39, 0x41, 0x41, 0x41, 0x42, 0x41, 0x3b, 0x37, 0x37, 0x39, 0x37, 0x3b, 0x3b, 0x38, 0x3b, 0x38, 0x37, 0x3b, 0x37, 0x3b, 0x37, 0x3b, 0x37, 0x38, 0x3b, 0x38, 0x37, 0x37, 0x37, 0x34, 0x3a, 0x13, 0x08, 0xf7, 0x9c, 0x9b, 0x9c, 0x9b, 0x9b, 0xa1, 0xba, 0xb5, 0xab, 0xbb, 0xcf, 0xcf, 0xca, 0xd3, 0xd2, 0xcd, 0xca, 0xcd, 0xca, 0xca, 0xc7, 0xca, 0xc3, 0xba, 0xbd, 0xb6, 0xa5, 0xb1, 0xcc, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcf, 0xcf, 0xcf, 0xd3, 0xcd, 0xc5, 0xb8, 0xb6, 0xbd, 0xc0, 0xbe, 0xb9, 0x9d, 0x95, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x96, 0x97, 0x96, 0x93, 0x93, 0x93, 0x93, 0x96, 0x93, 0x96, 0x96, 0x93, 0x96, 0x93, 0x96, 0x98, 0x96, 0x97, 0x96, 0xf1, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x94, 0x9f, 0xee, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x01, 0x01, 0xff, 0x61, 0x21, 0x1a, 0x1e, 0x1e, 0x1e, 0x19, 0x1e, 0x1c, 0x1e, 0x1c, 0x24, 0x1c, 0x24, 0x28, 0x2e, 0x2b, 0x34, 0x32, 0x34, 0x32, 0x39, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x34, 0x32, 0x2b, 0x2b, 0x2b, 0x28, 0x24, 0x23, 0x24, 0x1e, 0x19, 0x1e, 0x19, 0x19, 0x19, 0x19, 0x1c, 0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1c, 0x1e, 0x19, 0x1e, 0x19, 0x16, 0x19, 0x16, 0x1e, 0x1e, 0x23, 0x28, 0x2b, 0x32, 0x36, 0x3f, 0x36, 0x46, 0x3e, 0x3e, 0x3b, 0x3b, 0x41, 0x3b, 0x38, 0x37, 0x39, 0x39, 0x39, 0x3f, 0x39, 0x39, 0x3b, 0x38, 0x41, 0x38, 0x3b, 0x3b, 0x3b, 0x37, 0x3b, 0x37, 0x37, 0x3b, 0x37, 0x3b, 0x38, 0x41, 0x34, 0x2f, 0x22, 0x08, 0xf7, 0xf7, 0x9c, 0x9a, 0x9b, 0x9b, 0xa5, 0xbd, 0xb5, 0xab, 0xbd, 0xd3, 0xd3, 0xca, 0xd3, 0xcf, 0xca, 0xcf, 0xcd, 0xcd, 0xca, 0xca, 0xca, 0xc5, 0xbd, 0xbe, 0xb4, 0xa7, 0xb4, 0xcd, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xcd, 0xc1, 0xb6, 0xbd, 0xc1, 0xc0, 0xb9, 0x9b, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x97, 0x97, 0x96, 0x98, 0x96, 0x93, 0x93, 0x93, 0x96, 0x96, 0x96, 0x96, 0x93, 0x93, 0x93, 0x93, 0x93, 0x96, 0x96, 0x97, 0x97, 0x96, 0x96, 0x96, 0x93, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x97, 0x97, 0x99, 0x97, 0x99, 0x97, 0x97, 0x97, 0x95, 0x94, 0xc2, 0xf5, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0x62, 0x55, 0x16, 0x23, 0x24, 0x23, 0x1e, 0x23, 0x23, 0x28, 0x2e, 0x2e, 0x32, 0x34, 0x36, 0x36, 0x3f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x36, 0x32, 0x36, 0x36, 0x32, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x34, 0x32, 0x2e, 0x2b, 0x28, 0x28, 0x23, 0x1e, 0x1e, 0x1e, 0x1c, 0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x19, 0x19, 0x19, 0x19, 0x24, 0x2b, 0x34, 0x40, 0x39, 0x47, 0x41, 0x3e, 0x41, 0x3e, 0x3b, 0x37, 0x3b, 0x3e, 0x3b, 0x3b, 0x3b, 0x3e, 0x3e, 0x3e, 0x3f, 0x36, 0x39, 0x34, 0x3b, 0x37, 0x3c, 0x3b, 0x3c, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x3b, 0x37, 0x38, 0x41, 0x38, 0x41, 0x31, 0x35, 0x22, 0x0c, 0x05, 0x9c, 0x9c, 0x9c, 0x9a, 0x9d, 0xa5, 0xbe, 0xb5, 0xaa, 0xbb, 0xcd, 0xd3, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xca, 0xc3, 0xba, 0xbd, 0xb6, 0xaa, 0xb6, 0xcd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcc, 0xbe, 0xb6, 0xbb, 0xc0, 0xc0, 0xb8, 0x9d, 0x95, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0xf1, 0x97, 0x97, 0x96, 0x93, 0x93, 0x96, 0x93, 0xf1, 0xf1, 0x03, 0xf1, 0xf1, 0x96, 0x96, 0x96, 0xf1, 0xf1, 0xf1, 0xf1, 0x03, 0x97, 0xf1, 0x93, 0x93, 0x93, 0x96, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x97, 0x98, 0x97, 0x98, 0x97, 0x97, 0x97, 0x94, 0xad, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0xed, 0x01, 0x65, 0x65, 0x65, 0x01, 0x90, 0x65, 0x62, 0x21, 0x1e, 0x28, 0x23, 0x23, 0x2e, 0x2e, 0x31, 0x37, 0x41, 0x47, 0x39, 0x32, 0x36, 0x32, 0x32, 0x35, 0x35, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2a, 0x2f, 0x26, 0x2f, 0x26, 0x2f, 0x26, 0x26, 0x2f, 0x26, 0x2f, 0x2a, 0x35, 0x2a, 0x35, 0x35, 0x32, 0x35, 0x32, 0x32, 0x3d, 0x32, 0x46, 0x40, 0x47, 0x40, 0x34, 0x34, 0x2e, 0x28, 0x23, 0x1e, 0x1e, 0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x23, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x32, 0x36, 0x40, 0x40, 0x47, 0x3e, 0x41, 0x3c, 0x41, 0x42, 0x3c, 0x42, 0x42, 0x49, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x40, 0x39, 0x3f, 0x34, 0x3f, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x3c, 0x38, 0x3b, 0x3e, 0x37, 0x39, 0x39, 0x37, 0x41, 0x38, 0x42, 0x3c, 0x37, 0x32, 0x3a, 0x10, 0x04, 0x05, 0x9c, 0x99, 0x9b, 0x9d, 0xa6, 0xbe, 0xb8, 0xae, 0xbc, 0xcf, 0xd3, 0xca, 0xcf, 0xd2, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xc7, 0xc5, 0xba, 0xbd, 0xb8, 0xaa, 0xb4, 0xcd, 0xd3, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xcf, 0xcf, 0xcf, 0xc3, 0xb6, 0xbb, 0xc0, 0xc3, 0xb9, 0x9d, 0x96, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x97, 0x97, 0x97, 0x97, 0x93, 0x96, 0x93, 0x97, 0x95, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x95, 0x96, 0x93, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x98, 0x97, 0x97, 0x98, 0x97, 0x96, 0x96, 0x97, 0x91, 0xf2, 0xe2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x90, 0x01, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0x64, 0x5d, 0x14, 0x2e, 0x23, 0x28, 0x2b, 0x32, 0x3f, 0x4d, 0x32, 0x32, 0x32, 0x35, 0x2f, 0x3a, 0x45, 0x45, 0x4f, 0x54, 0x54, 0x59, 0x59, 0x59, 0x5d, 0x5d, 0x5d, 0x5f, 0x5d, 0x5d, 0x59, 0x57, 0x59, 0x54, 0x54, 0x54, 0x4f, 0x45, 0x45, 0x3a, 0x2c, 0x2c, 0x2f, 0x2c, 0x26, 0x26, 0x26, 0x2a, 0x2a, 0x35, 0x32, 0x32, 0x36, 0x3d, 0x3d, 0x32, 0x24, 0x24, 0x1e, 0x19, 0x23, 0x23, 0x1e, 0x1e, 0x1e, 0x1e, 0x23, 0x1e, 0x23, 0x1e, 0x23, 0x1e, 0x1e, 0x28, 0x34, 0x40, 0x3e, 0x3e, 0x3e, 0x50, 0x3b, 0x41, 0x41, 0x49, 0x41, 0x3c, 0x41, 0x3b, 0x41, 0x3e, 0x40, 0x40, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x40, 0x39, 0x39, 0x37, 0x3c, 0x3c, 0x42, 0x37, 0x37, 0x3b, 0x38, 0x3b, 0x3c, 0x37, 0x37, 0x34, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x32, 0x2f, 0x13, 0x06, 0xf7, 0x9c, 0x9c, 0x9b, 0x9c, 0xab, 0xc0, 0xb5, 0xae, 0xbd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xc3, 0xbb, 0xbd, 0xb6, 0xaa, 0xb6, 0xcd, 0xd3, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xcf, 0xc3, 0xb6, 0xbb, 0xc0, 0xbe, 0xb9, 0x9e, 0x95, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x96, 0x97, 0x97, 0x97, 0x96, 0x96, 0x97, 0x94, 0x04, 0x0d, 0x0c, 0x0f, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x0f, 0x0f, 0x0d, 0x04, 0xf1, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x98, 0x97, 0x96, 0x97, 0x97, 0x97, 0x95, 0x99, 0xd8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x90, 0xed, 0x65, 0x65, 0x64, 0x01, 0x01, 0x65, 0x63, 0x51, 0x1a, 0x2e, 0x2e, 0x32, 0x3d, 0x32, 0x26, 0x2f, 0x3a, 0x53, 0x59, 0x5d, 0x60, 0x61, 0xfe, 0x63, 0x63, 0x64, 0x64, 0xff, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x64, 0x65, 0xff, 0x65, 0xff, 0x64, 0x65, 0x63, 0xff, 0x63, 0xfe, 0x63, 0xfe, 0x62, 0x60, 0x61, 0x5d, 0x5d, 0x54, 0x45, 0x45, 0x2f, 0x2c, 0x26, 0x26, 0x2f, 0x2f, 0x2f, 0x4c, 0x3d, 0x34, 0x28, 0x23, 0x23, 0x1e, 0x1e, 0x1e, 0x1e, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2e, 0x39, 0x40, 0x49, 0x3c, 0x49, 0x42, 0x49, 0x41, 0x41, 0x47, 0x40, 0x40, 0x40, 0x36, 0x36, 0x36, 0x36, 0x32, 0x35, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x36, 0x34, 0x41, 0x41, 0x41, 0x3e, 0x39, 0x3b, 0x3b, 0x3c, 0x38, 0x3b, 0x37, 0x37, 0x34, 0x37, 0x37, 0x38, 0x38, 0x42, 0x37, 0x34, 0x35, 0x17, 0x07, 0x05, 0xf7, 0x9c, 0x9b, 0x9c, 0xad, 0xc0, 0xb4, 0xae, 0xbe, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xca, 0xc3, 0xba, 0xbd, 0xb8, 0xac, 0xb8, 0xcd, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xc1, 0xb6, 0xbb, 0xc0, 0xbe, 0xba, 0x9e, 0x95, 0x96, 0x96, 0x96, 0x97, 0x96, 0x98, 0x96, 0x98, 0x96, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x93, 0x96, 0x97, 0x97, 0x97, 0x97, 0x9a, 0xf7, 0x02, 0x08, 0x33, 0x2c, 0x35, 0x3d, 0x36, 0x36, 0x32, 0x3d, 0x32, 0x40, 0x36, 0x46, 0x35, 0x3a, 0x17, 0x07, 0x03, 0xf1, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x98, 0x96, 0x98, 0x96, 0x98, 0x97, 0x97, 0x97, 0x92, 0xf1, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0x64, 0x62, 0x2c, 0x24, 0x32, 0x2b, 0x3d, 0x2a, 0x3a, 0x4f, 0x5d, 0xfe, 0x64, 0xff, 0xec, 0xea, 0xe8, 0xe8, 0xe5, 0xe1, 0xde, 0xde, 0xde, 0xd9, 0xd9, 0xd9, 0xd9, 0xd2, 0xd4, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xdb, 0xde, 0xe1, 0xe1, 0xe6, 0xe8, 0xe6, 0xef, 0xef, 0xff, 0xff, 0xff, 0x64, 0xff, 0x63, 0xfe, 0x61, 0x5f, 0x59, 0x54, 0x45, 0x2c, 0x2f, 0x26, 0x36, 0x41, 0x31, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x34, 0x47, 0x47, 0x47, 0x41, 0x42, 0x49, 0x49, 0x49, 0x36, 0x36, 0x35, 0x35, 0x35, 0x3a, 0x3a, 0x45, 0x3a, 0x45, 0x4f, 0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x45, 0x48, 0x3a, 0x35, 0x32, 0x36, 0x34, 0x36, 0x40, 0x39, 0x41, 0x38, 0x38, 0x3c, 0x37, 0x37, 0x34, 0x39, 0x37, 0x38, 0x38, 0x42, 0x3c, 0x34, 0x3d, 0x21, 0x09, 0xf7, 0xf7, 0x9b, 0x9c, 0x9c, 0xad, 0xc0, 0xb5, 0xac, 0xbe, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcc, 0xc3, 0xbb, 0xbd, 0xb6, 0xaa, 0xb8, 0xcd, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xc3, 0xb6, 0xbb, 0xbe, 0xc0, 0xb9, 0x9e, 0x95, 0x96, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x93, 0x93, 0x97, 0x97, 0x97, 0x97, 0x97, 0xf1, 0x02, 0x07, 0x45, 0x3d, 0x40, 0x37, 0x41, 0x41, 0x41, 0x41, 0x39, 0x41, 0x41, 0x39, 0x40, 0x35, 0x17, 0x06, 0x02, 0xf1, 0xf1, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x96, 0x97, 0x97, 0x96, 0x98, 0x96, 0x98, 0x97, 0x98, 0x96, 0x98, 0x98, 0x97, 0x95, 0x96, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x64, 0x61, 0x21, 0x2a, 0x2a, 0x26, 0x3a, 0x59, 0x62, 0x63, 0xeb, 0xe8, 0xe3, 0xdc, 0xd6, 0xd4, 0xc6, 0xc8, 0xc6, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc6, 0xce, 0xc6, 0xce, 0xce, 0xd2, 0xd2, 0xd2, 0xd9, 0xdb, 0xe1, 0xe1, 0xe4, 0xe7, 0xe8, 0xff, 0xff, 0xff, 0x62, 0xfe, 0x61, 0x5d, 0x48, 0x2a, 0x32, 0x37, 0x2e, 0x28, 0x23, 0x23, 0x23, 0x23, 0x28, 0x23, 0x28, 0x31, 0x3e, 0x50, 0x50, 0x47, 0x49, 0x49, 0x41, 0x39, 0x32, 0x35, 0x48, 0x45, 0x4f, 0x54, 0x57, 0x60, 0x60, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x63, 0x61, 0x5f, 0x5e, 0x53, 0x2f, 0x2f, 0x32, 0x36, 0x37, 0x38, 0x38, 0x3c, 0x37, 0x3b, 0x34, 0x34, 0x37, 0x3b, 0x38, 0x42, 0x3b, 0x31, 0x3d, 0x26, 0x0c, 0x05, 0xf7, 0x9b, 0x9c, 0x9d, 0xad, 0xc2, 0xb6, 0xac, 0xbe, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xcd, 0xc3, 0xba, 0xbd, 0xb6, 0xac, 0xb8, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xc3, 0xb4, 0xbb, 0xbe, 0xc1, 0xba, 0x9e, 0x96, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x93, 0x96, 0x97, 0x97, 0x97, 0x97, 0x99, 0xf1, 0x02, 0x09, 0x3a, 0x3d, 0x31, 0x31, 0x42, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x31, 0x39, 0x35, 0x17, 0x06, 0x02, 0xf1, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x97, 0x96, 0x98, 0x96, 0x98, 0x97, 0x93, 0x97, 0x98, 0x96, 0x98, 0x94, 0x97, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x65, 0x65, 0x65, 0x01, 0x90, 0x01, 0x63, 0x5f, 0x1a, 0x2a, 0x2c, 0x45, 0x61, 0xff, 0xef, 0xdb, 0xd2, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xce, 0xd0, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xc8, 0xce, 0xc6, 0xce, 0xce, 0xca, 0xd2, 0xd3, 0xdb, 0xe4, 0xf4, 0xef, 0xfe, 0x62, 0x59, 0x35, 0x32, 0x32, 0x2e, 0x28, 0x23, 0x23, 0x28, 0x23, 0x23, 0x2e, 0x39, 0x50, 0x3e, 0x41, 0x47, 0x47, 0x3d, 0x3d, 0x3a, 0x53, 0x5d, 0x60, 0xfe, 0x63, 0xed, 0xf5, 0xec, 0xeb, 0xea, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xf0, 0xff, 0xff, 0xfe, 0x5d, 0x3a, 0x35, 0x2b, 0x39, 0x41, 0x3c, 0x3c, 0x38, 0x37, 0x34, 0x37, 0x34, 0x3b, 0x38, 0x3c, 0x38, 0x37, 0x36, 0x2f, 0x0c, 0x04, 0x9a, 0x9c, 0x9a, 0x9c, 0xb0, 0xc2, 0xb4, 0xae, 0xbd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xc3, 0xb9, 0xbe, 0xb5, 0xaa, 0xb8, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xc3, 0xb6, 0xbb, 0xbe, 0xc0, 0xba, 0x9e, 0x95, 0x98, 0x97, 0x99, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x93, 0x96, 0x97, 0xf1, 0x97, 0x97, 0x97, 0xf1, 0x02, 0x09, 0x2f, 0x40, 0x42, 0x3c, 0x3c, 0x38, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x36, 0x35, 0x17, 0x06, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x96, 0x97, 0x97, 0x96, 0x97, 0x93, 0x96, 0x98, 0x96, 0x98, 0x96, 0x96, 0x97, 0x95, 0x96, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0x65, 0x90, 0x90, 0x01, 0x62, 0x53, 0x24, 0x2a, 0x45, 0x60, 0xea, 0xe4, 0xc6, 0xc6, 0xc8, 0xc8, 0xc8, 0xcb, 0xc8, 0xcb, 0xcb, 0xcb, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xcb, 0xc8, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xcb, 0xcb, 0xd0, 0xcb, 0xce, 0xcb, 0xce, 0xce, 0xd0, 0xce, 0xce, 0xd0, 0xce, 0xd4, 0xc6, 0xd4, 0xc6, 0xd2, 0xdd, 0xfd, 0x62, 0x5f, 0x3a, 0x32, 0x2e, 0x2e, 0x23, 0x23, 0x23, 0x23, 0x2e, 0x34, 0x49, 0x47, 0x49, 0x3e, 0x49, 0x3d, 0x3a, 0x54, 0x61, 0x62, 0x63, 0xff, 0xe8, 0xe5, 0xe5, 0xe3, 0xde, 0xde, 0xd9, 0xd9, 0xd4, 0xd9, 0xd4, 0xd9, 0xd4, 0xd4, 0xd4, 0xd6, 0xd2, 0xd2, 0xd7, 0xe4, 0xef, 0x63, 0x5e, 0x35, 0x32, 0x39, 0x3c, 0x3c, 0x3c, 0x3c, 0x3b, 0x34, 0x34, 0x34, 0x37, 0x37, 0x3c, 0x31, 0x37, 0x32, 0x2f, 0x0f, 0x04, 0x9c, 0x9b, 0x9c, 0x9d, 0xf9, 0xc2, 0xb8, 0xac, 0xc1, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcd, 0xc3, 0xb9, 0xbe, 0xb6, 0xa7, 0xbb, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xc3, 0xb4, 0xbb, 0xbe, 0xc0, 0xbd, 0x9f, 0x96, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x96, 0x96, 0x93, 0x96, 0x97, 0xf1, 0x97, 0x97, 0x98, 0xf7, 0x02, 0x09, 0x2f, 0x34, 0x42, 0x42, 0x38, 0x38, 0x3b, 0x37, 0x38, 0x38, 0x3c, 0x38, 0x39, 0x35, 0x17, 0x06, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x98, 0x96, 0x93, 0x96, 0x93, 0x96, 0x98, 0x96, 0x95, 0x95, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x65, 0x65, 0x64, 0x01, 0x90, 0x90, 0x90, 0x62, 0x2f, 0x2a, 0x2f, 0x59, 0xeb, 0xdc, 0xc8, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xcb, 0xc8, 0xc8, 0xc8, 0xcb, 0xc8, 0xcb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xd0, 0xd0, 0xd0, 0xd0, 0xcb, 0xd0, 0xd0, 0xd0, 0xcb, 0xd0, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xcb, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xce, 0xd2, 0xdb, 0xef, 0xfe, 0x5d, 0x2f, 0x2e, 0x28, 0x23, 0x28, 0x23, 0x28, 0x2e, 0x37, 0x47, 0x50, 0x50, 0x49, 0x47, 0x48, 0x60, 0xfe, 0xef, 0xe2, 0xdb, 0xd9, 0xd6, 0xd4, 0xce, 0xce, 0xd4, 0xd0, 0xd4, 0xd4, 0xd4, 0xd0, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd2, 0xdb, 0xef, 0x61, 0x5a, 0x35, 0x34, 0x38, 0x38, 0x42, 0x3c, 0x37, 0x37, 0x3f, 0x37, 0x34, 0x3b, 0x3b, 0x38, 0x3b, 0x34, 0x2f, 0x0f, 0x05, 0x9c, 0x9c, 0x9a, 0x8e, 0xad, 0xc4, 0xb6, 0xae, 0xbd, 0xd3, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcf, 0xcd, 0xc3, 0xb9, 0xbd, 0xb5, 0xaa, 0xb8, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xc3, 0xb6, 0xbb, 0xbd, 0xc0, 0xbd, 0x9e, 0x96, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x98, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x93, 0x96, 0x97, 0x97, 0x97, 0x96, 0x98, 0x99, 0x02, 0x07, 0x3a, 0x3f, 0x3c, 0x42, 0x3c, 0x3c, 0x3b, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3b, 0x3d, 0x17, 0x06, 0xf1, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x98, 0x96, 0x98, 0x96, 0x93, 0x96, 0x98, 0x96, 0x98, 0x95, 0x96, 0xd1, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x65, 0x65, 0x65, 0x65, 0x90, 0x90, 0x65, 0x61, 0x2f, 0x2a, 0x33, 0xfe, 0xe5, 0xc8, 0xc8, 0xc8, 0xcb, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xc8, 0xcb, 0xc8, 0xcb, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xce, 0xc8, 0xce, 0xc8, 0xc8, 0xce, 0xc8, 0xce, 0xd0, 0xd0, 0xcb, 0xd0, 0xcb, 0xd0, 0xcb, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xd0, 0xce, 0xcb, 0xd0, 0xcb, 0xd0, 0xd0, 0xd0, 0xce, 0xce, 0xce, 0xd9, 0xe1, 0xef, 0x62, 0x5a, 0x2b, 0x28, 0x23, 0x23, 0x23, 0x23, 0x2e, 0x50, 0x49, 0x41, 0x4d, 0x46, 0x53, 0x60, 0xef, 0xe1, 0xd3, 0xd2, 0xd2, 0xce, 0xce, 0xd0, 0xd5, 0xd0, 0xd0, 0xd5, 0xd5, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd0, 0xd5, 0xd6, 0xd6, 0xd4, 0xd4, 0xe1, 0xfe, 0x5f, 0x3a, 0x32, 0x41, 0x38, 0x38, 0x3c, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x37, 0x3b, 0x31, 0x3b, 0x36, 0x35, 0x11, 0x06, 0xf7, 0x9b, 0x9b, 0x9d, 0xb5, 0xc2, 0xb5, 0xac, 0xc1, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xc1, 0xb9, 0xbe, 0xb4, 0xa7, 0xbb, 0xd3, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xcf, 0xc5, 0xb6, 0xb9, 0xbe, 0xc3, 0xba, 0xa0, 0x96, 0x96, 0x99, 0x98, 0xf1, 0x97, 0x98, 0x96, 0x93, 0x96, 0xf1, 0x99, 0x96, 0x98, 0x93, 0x96, 0x98, 0x96, 0x95, 0x96, 0x99, 0x99, 0x96, 0x96, 0x96, 0x97, 0xf1, 0x02, 0x07, 0x35, 0x34, 0x3c, 0x3c, 0x38, 0x38, 0x37, 0x37, 0x3c, 0x3c, 0x42, 0x42, 0x41, 0x32, 0x17, 0x06, 0x02, 0x97, 0x96, 0x96, 0x93, 0x95, 0x95, 0xf1, 0x94, 0xf7, 0x95, 0x96, 0x99, 0x96, 0x93, 0x93, 0x96, 0x97, 0x97, 0x96, 0x97, 0x96, 0x96, 0x96, 0x98, 0x95, 0x95, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0x01, 0x65, 0x64, 0x01, 0x01, 0x90, 0x01, 0x5f, 0x2f, 0x2f, 0x44, 0xea, 0xd9, 0xc8, 0xc8, 0xc8, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xce, 0xce, 0xcb, 0xce, 0xce, 0xd0, 0xce, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcb, 0xce, 0xd0, 0xd0, 0xd0, 0xd0, 0xce, 0xce, 0xd4, 0xd5, 0xdc, 0xdc, 0xe7, 0x63, 0x5a, 0x32, 0x23, 0x2b, 0x1e, 0x24, 0x23, 0x39, 0x50, 0x49, 0x3e, 0x4c, 0x3a, 0x59, 0xf0, 0xe3, 0xd4, 0xce, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd0, 0xd5, 0xd0, 0xd5, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd0, 0xd6, 0xd5, 0xd9, 0xe8, 0x62, 0x54, 0x32, 0x40, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x37, 0x39, 0x35, 0x11, 0x06, 0xf7, 0x9b, 0x9a, 0x9b, 0xb8, 0xc2, 0xb2, 0xac, 0xc1, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcf, 0xc1, 0xb9, 0xbe, 0xb2, 0xaa, 0xbb, 0xd3, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xc5, 0xb6, 0xb8, 0xc0, 0xc0, 0xbd, 0x9f, 0x96, 0x96, 0x99, 0x97, 0xf1, 0xf1, 0x98, 0x93, 0x96, 0x97, 0xf1, 0xf7, 0x96, 0x98, 0x93, 0x93, 0x99, 0xf1, 0x95, 0xf1, 0xf1, 0x95, 0x98, 0x93, 0x98, 0x99, 0x99, 0x02, 0x06, 0x35, 0x3f, 0x3b, 0x3c, 0x38, 0x3b, 0x37, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3b, 0x3d, 0x17, 0x06, 0xf1, 0x95, 0x93, 0x93, 0x94, 0xf1, 0x8b, 0xf7, 0xf8, 0x02, 0xf1, 0xf1, 0x99, 0x96, 0x93, 0x93, 0x96, 0x97, 0x96, 0x97, 0x97, 0x97, 0x96, 0x96, 0x99, 0x95, 0x96, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0xed, 0x65, 0x65, 0x65, 0x65, 0xed, 0x90, 0x65, 0x59, 0x26, 0x3a, 0x57, 0xea, 0xd4, 0xc8, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xcb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xcb, 0xc8, 0xce, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xce, 0xd0, 0xce, 0xcb, 0xce, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xce, 0xd0, 0xd0, 0xd0, 0xd0, 0xcb, 0xce, 0xce, 0xd4, 0xda, 0xdc, 0xdc, 0xe6, 0x63, 0x5e, 0x2b, 0x23, 0x24, 0x23, 0x23, 0x23, 0x39, 0x50, 0x49, 0x50, 0x3d, 0x53, 0x60, 0xf4, 0xd4, 0xd2, 0xd4, 0xd5, 0xd5, 0xd0, 0xd5, 0xd0, 0xd5, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xe6, 0xfe, 0x59, 0x35, 0x34, 0x38, 0x3c, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x3b, 0x31, 0x37, 0x36, 0x32, 0x17, 0x06, 0xf7, 0x9a, 0x9b, 0x8e, 0xb5, 0xc4, 0xb2, 0xac, 0xc1, 0xd3, 0xcd, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xc1, 0xb9, 0xbe, 0xb4, 0xa7, 0xbb, 0xd3, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xc5, 0xb6, 0xb9, 0xbe, 0xc3, 0xba, 0xa0, 0x96, 0x96, 0x99, 0x99, 0xf1, 0x99, 0x96, 0x93, 0x93, 0x97, 0xf1, 0x99, 0x96, 0x98, 0x93, 0x96, 0x99, 0x02, 0x08, 0x0d, 0x06, 0x03, 0xf1, 0x96, 0x97, 0x99, 0x99, 0x02, 0x06, 0x3a, 0x34, 0x3c, 0x38, 0x38, 0x38, 0x3b, 0x37, 0x3c, 0x42, 0x3c, 0x38, 0x3e, 0x3d, 0x17, 0x06, 0x94, 0x96, 0x96, 0xf1, 0x02, 0x02, 0x06, 0x18, 0x1b, 0xf6, 0xf7, 0x99, 0x97, 0x93, 0x95, 0x98, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x97, 0x95, 0x95, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0x01, 0x65, 0x64, 0x01, 0xed, 0x01, 0x64, 0x55, 0x21, 0x45, 0x60, 0xe8, 0xc6, 0xc8, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xce, 0xd5, 0xd5, 0xdc, 0xda, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xd5, 0xd5, 0xd4, 0xd0, 0xce, 0xd0, 0xce, 0xd0, 0xd0, 0xd0, 0xd0, 0xce, 0xd0, 0xce, 0xce, 0xd0, 0xd0, 0xd0, 0xd0, 0xce, 0xce, 0xd6, 0xe0, 0xe0, 0xdc, 0xe6, 0x63, 0x5e, 0x32, 0x1e, 0x23, 0x23, 0x24, 0x28, 0x47, 0x49, 0x50, 0x50, 0x35, 0x59, 0x60, 0xe6, 0xd2, 0xce, 0xd4, 0xd5, 0xd5, 0xd0, 0xd5, 0xd5, 0xd0, 0xd5, 0xd5, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xe4, 0x63, 0x5d, 0x35, 0x2e, 0x41, 0x38, 0x3b, 0x37, 0x38, 0x38, 0x3b, 0x37, 0x3b, 0x37, 0x37, 0x3b, 0x34, 0x35, 0x17, 0x06, 0xf7, 0x9c, 0x9a, 0x9d, 0xb8, 0xc2, 0xb2, 0xac, 0xc1, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xcf, 0xcf, 0xc1, 0xb9, 0xbe, 0xb2, 0xa7, 0xbb, 0xcf, 0xd3, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xc5, 0xb6, 0xb8, 0xbe, 0xc0, 0xbd, 0xa0, 0x96, 0x96, 0x99, 0x97, 0xf1, 0xf1, 0x98, 0x93, 0x93, 0x96, 0x99, 0xf1, 0x97, 0x98, 0x93, 0x96, 0xf1, 0x02, 0x0d, 0x45, 0x22, 0x07, 0x03, 0xf7, 0xf1, 0x96, 0x99, 0x95, 0x06, 0x3a, 0x39, 0x38, 0x3c, 0x3c, 0x38, 0x38, 0x3b, 0x38, 0x3c, 0x3c, 0x3c, 0x39, 0x35, 0x17, 0x04, 0xf1, 0xf1, 0xf1, 0x02, 0x02, 0x07, 0x22, 0x4f, 0x33, 0x06, 0xf6, 0x99, 0x96, 0x98, 0x96, 0x99, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x97, 0x95, 0x96, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x65, 0x65, 0x65, 0x65, 0x01, 0x01, 0x63, 0x45, 0x21, 0x53, 0x62, 0xe1, 0xc6, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xce, 0xd4, 0xd6, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdc, 0xe0, 0xe0, 0xda, 0xd6, 0xd5, 0xd4, 0xd0, 0xce, 0xce, 0xce, 0xd0, 0xce, 0xd0, 0xce, 0xd0, 0xd0, 0xd0, 0xd0, 0xce, 0xce, 0xd4, 0xda, 0xe0, 0xe0, 0xd9, 0xe6, 0x63, 0x5e, 0x2a, 0x1e, 0x24, 0x23, 0x23, 0x2e, 0x50, 0x49, 0x49, 0x52, 0x3a, 0x59, 0xfe, 0xdb, 0xd4, 0xd4, 0xd5, 0xd6, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xdd, 0xff, 0x5f, 0x35, 0x36, 0x3e, 0x31, 0x3b, 0x37, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x32, 0x17, 0x07, 0xf7, 0x9b, 0x9b, 0x8e, 0xb8, 0xc4, 0xb2, 0xac, 0xc1, 0xd3, 0xcd, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xcd, 0xc1, 0xb9, 0xbe, 0xb4, 0xa7, 0xbb, 0xd3, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xc5, 0xb6, 0xb8, 0xbe, 0xc0, 0xbd, 0xa0, 0x96, 0x97, 0x97, 0x99, 0xf1, 0xf1, 0x98, 0x96, 0x93, 0x98, 0xf1, 0x96, 0x96, 0x9a, 0x96, 0x99, 0x02, 0x04, 0x11, 0x5a, 0x48, 0x26, 0x09, 0x03, 0x03, 0xf7, 0x99, 0x95, 0x06, 0x3a, 0x34, 0x42, 0x3c, 0x42, 0x3c, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3b, 0x34, 0x35, 0x17, 0x06, 0x03, 0xf1, 0x02, 0x03, 0x09, 0x26, 0x4c, 0x35, 0x51, 0x10, 0xf6, 0x95, 0x93, 0x96, 0x99, 0xf1, 0xf1, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x97, 0x95, 0x95, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0x01, 0x01, 0x01, 0x62, 0x33, 0x21, 0x54, 0xfe, 0xdb, 0xc8, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xcb, 0xc8, 0xc8, 0xc8, 0xce, 0xd4, 0xdc, 0xdc, 0xe0, 0xe3, 0xe3, 0xe0, 0xe3, 0xe0, 0xdf, 0xdc, 0xdf, 0xdc, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xce, 0xce, 0xd0, 0xd5, 0xce, 0xce, 0xd0, 0xd0, 0xd0, 0xd0, 0xce, 0xda, 0xda, 0xe0, 0xe0, 0xdc, 0xe6, 0x63, 0x5e, 0x24, 0x1e, 0x28, 0x23, 0x23, 0x2e, 0x50, 0x49, 0x50, 0x46, 0x51, 0x5d, 0xe7, 0xd3, 0xd6, 0xd6, 0xd5, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xde, 0xff, 0x60, 0x48, 0x32, 0x3e, 0x31, 0x37, 0x3b, 0x37, 0x38, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x34, 0x35, 0x17, 0x07, 0xf7, 0x9c, 0x9b, 0x9d, 0xb9, 0xc2, 0xb2, 0xac, 0xc1, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcf, 0xc1, 0xb9, 0xbe, 0xb2, 0xa7, 0xbb, 0xcf, 0xd3, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xc5, 0xb6, 0xb6, 0xbe, 0xc3, 0xbd, 0xa0, 0x96, 0x96, 0x99, 0x97, 0xf1, 0x99, 0x97, 0x93, 0x93, 0x97, 0x99, 0x97, 0x96, 0x98, 0x93, 0xf1, 0x03, 0x09, 0x2c, 0x40, 0x2e, 0x56, 0x2f, 0x0c, 0x04, 0x03, 0xf7, 0x95, 0x06, 0x3a, 0x39, 0x42, 0x42, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x3c, 0x3c, 0x3b, 0x34, 0x3d, 0x17, 0x06, 0x02, 0x02, 0x04, 0x0c, 0x35, 0x40, 0x2e, 0x39, 0x35, 0x33, 0x04, 0xf1, 0x95, 0x96, 0x99, 0xf1, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x99, 0x95, 0x96, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x65, 0x65, 0x65, 0x65, 0x01, 0x64, 0x60, 0x22, 0x2c, 0x59, 0xff, 0xd2, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xcb, 0xc8, 0xc8, 0xc8, 0xce, 0xd5, 0xda, 0xe0, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xce, 0xce, 0xd0, 0xd4, 0xd0, 0xd0, 0xd0, 0xce, 0xda, 0xe0, 0xdc, 0xdc, 0xde, 0xe7, 0x63, 0x53, 0x24, 0x1e, 0x2b, 0x23, 0x23, 0x31, 0x50, 0x50, 0x50, 0x3d, 0x53, 0x60, 0xe4, 0xd2, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xdb, 0xf0, 0x61, 0x45, 0x2b, 0x3e, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x32, 0x21, 0x07, 0xf7, 0x9c, 0x9b, 0x8e, 0xb9, 0xc4, 0xb2, 0xac, 0xc1, 0xd3, 0xcd, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xc1, 0xb9, 0xbe, 0xb4, 0xa7, 0xbb, 0xd3, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xc5, 0xb6, 0xb6, 0xbd, 0xc0, 0xbd, 0xa0, 0x97, 0x97, 0x97, 0x99, 0xf1, 0xf1, 0x98, 0x96, 0x93, 0x97, 0x97, 0x99, 0x96, 0x98, 0x97, 0x03, 0x04, 0x13, 0x4e, 0x39, 0x41, 0x31, 0x46, 0x4e, 0x11, 0x06, 0x04, 0x03, 0x06, 0x35, 0x34, 0x42, 0x42, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3b, 0x3d, 0x1a, 0x07, 0x04, 0x09, 0x11, 0x3a, 0x32, 0x37, 0x38, 0x31, 0x40, 0x51, 0x10, 0x03, 0xf1, 0x96, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x97, 0x95, 0x95, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x65, 0x65, 0x01, 0x01, 0x65, 0x64, 0x5d, 0x22, 0x2c, 0x5b, 0xff, 0xd4, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xcb, 0xc8, 0xc8, 0xce, 0xd5, 0xda, 0xe0, 0xe3, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xd5, 0xd5, 0xce, 0xce, 0xd0, 0xd5, 0xd0, 0xd5, 0xd5, 0xe0, 0xe0, 0xda, 0xe0, 0xde, 0xe7, 0x63, 0x53, 0x1a, 0x1e, 0x2b, 0x1e, 0x23, 0x31, 0x50, 0x49, 0x52, 0x4c, 0x54, 0xfe, 0xdb, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd5, 0xd6, 0xd6, 0xde, 0xe9, 0x62, 0x48, 0x2a, 0x34, 0x3b, 0x37, 0x37, 0x38, 0x38, 0x37, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x2e, 0x35, 0x17, 0x07, 0x04, 0x9b, 0x9c, 0x9d, 0xba, 0xc2, 0xb2, 0xac, 0xc1, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcf, 0xc1, 0xb9, 0xbe, 0xb2, 0xa7, 0xbb, 0xcf, 0xd3, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xc7, 0xb6, 0xb6, 0xbd, 0xc3, 0xbd, 0xa2, 0x96, 0x97, 0x99, 0x97, 0xf1, 0x99, 0x96, 0x93, 0x93, 0x97, 0x97, 0x99, 0x96, 0x98, 0xf1, 0x03, 0x07, 0x22, 0x4c, 0x31, 0x3c, 0x3c, 0x34, 0x4c, 0x48, 0x17, 0x09, 0x04, 0x06, 0x3d, 0x39, 0x42, 0x42, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x38, 0x3b, 0x47, 0x1a, 0x0e, 0x0f, 0x21, 0x3a, 0x3d, 0x40, 0x31, 0x38, 0x42, 0x39, 0x3d, 0x33, 0x06, 0x02, 0xf1, 0x96, 0x98, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x97, 0x95, 0x96, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x65, 0x65, 0x01, 0x01, 0x65, 0x64, 0x4f, 0x33, 0x22, 0x62, 0xe8, 0xc6, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xc8, 0xce, 0xd5, 0xda, 0xe0, 0xe3, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda, 0xce, 0xd4, 0xd5, 0xd5, 0xd5, 0xda, 0xe0, 0xdc, 0xe0, 0xdc, 0xde, 0xef, 0x63, 0x53, 0x16, 0x24, 0x23, 0x23, 0x23, 0x39, 0x50, 0x47, 0x50, 0x3a, 0x59, 0xef, 0xdb, 0xce, 0xd6, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xda, 0xd9, 0xe9, 0x62, 0x45, 0x32, 0x34, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x37, 0x34, 0x37, 0x37, 0x37, 0x34, 0x32, 0x21, 0x07, 0xf7, 0x9c, 0x9b, 0x8e, 0xba, 0xc3, 0xb2, 0xac, 0xc1, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcf, 0xc1, 0xb9, 0xc0, 0xb3, 0xa7, 0xbb, 0xd3, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xc7, 0xb8, 0xb4, 0xbe, 0xc0, 0xbe, 0xa2, 0x96, 0x99, 0x98, 0x99, 0xf1, 0x97, 0x98, 0x96, 0x93, 0x96, 0x99, 0x97, 0x96, 0x99, 0xf7, 0x03, 0x0f, 0x48, 0x32, 0x34, 0x38, 0x3c, 0x3b, 0x37, 0x36, 0x56, 0x26, 0x0b, 0x07, 0x46, 0x37, 0x42, 0x3c, 0x38, 0x38, 0x3b, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3b, 0x34, 0x23, 0x35, 0x3d, 0x36, 0x36, 0x37, 0x38, 0x42, 0x38, 0x37, 0x3d, 0x4b, 0x0f, 0x03, 0xf1, 0x93, 0x93, 0x97, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x97, 0x96, 0x95, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x65, 0x65, 0x01, 0x01, 0x65, 0x63, 0x45, 0x2c, 0x33, 0xfe, 0xe5, 0xce, 0xc8, 0xcb, 0xcb, 0xc8, 0xc8, 0xcb, 0xce, 0xda, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdc, 0xda, 0xda, 0xd4, 0xd0, 0xd5, 0xda, 0xe0, 0xe0, 0xdf, 0xdc, 0xdf, 0xde, 0xef, 0x63, 0x45, 0x1a, 0x23, 0x24, 0x1e, 0x28, 0x37, 0x50, 0x50, 0x4d, 0x48, 0x5d, 0xef, 0xd9, 0xce, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xd5, 0xd6, 0xd6, 0xd4, 0xd6, 0xda, 0xdc, 0xda, 0xde, 0xe8, 0x62, 0x53, 0x2a, 0x39, 0x34, 0x37, 0x37, 0x37, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x32, 0x21, 0x07, 0x04, 0x9c, 0x9a, 0x9e, 0xba, 0xc2, 0xb1, 0xac, 0xc1, 0xcf, 0xcf, 0xca, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcf, 0xc1, 0xb9, 0xbe, 0xb2, 0xa7, 0xbb, 0xd3, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xc7, 0xb6, 0xb4, 0xbe, 0xc0, 0xbe, 0xa5, 0x96, 0x97, 0x98, 0x99, 0x99, 0x97, 0x96, 0x93, 0x93, 0x97, 0x99, 0x97, 0x97, 0xf1, 0x03, 0x06, 0x2c, 0x3d, 0x32, 0x34, 0x38, 0x3c, 0x3c, 0x3b, 0x41, 0x34, 0x4c, 0x48, 0x16, 0x2e, 0x41, 0x42, 0x38, 0x38, 0x3b, 0x38, 0x38, 0x38, 0x3c, 0x42, 0x42, 0x38, 0x3c, 0x41, 0x40, 0x34, 0x34, 0x39, 0x37, 0x37, 0x38, 0x38, 0x38, 0x37, 0x3e, 0x3d, 0x22, 0x07, 0xf6, 0x99, 0x93, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x97, 0x96, 0x95, 0xd1, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x65, 0x01, 0x01, 0x01, 0x65, 0x62, 0x33, 0x21, 0x44, 0xff, 0xe1, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xce, 0xd5, 0xda, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xdf, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xda, 0xd4, 0xd5, 0xda, 0xe0, 0xdf, 0xdf, 0xdf, 0xdc, 0xe1, 0xf0, 0x62, 0x3a, 0x1e, 0x1e, 0x28, 0x1e, 0x28, 0x47, 0x50, 0x47, 0x4d, 0x48, 0x5d, 0xef, 0xd2, 0xce, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd4, 0xd6, 0xd4, 0xd6, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xd9, 0xe8, 0xfe, 0x53, 0x32, 0x36, 0x37, 0x37, 0x37, 0x38, 0x38, 0x37, 0x37, 0x34, 0x37, 0x37, 0x37, 0x34, 0x32, 0x21, 0x09, 0xf7, 0x9c, 0x9c, 0x8e, 0xba, 0xc3, 0xb2, 0xac, 0xc1, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xc1, 0xb9, 0xc1, 0xb2, 0xa7, 0xbb, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcd, 0xc7, 0xb8, 0xb4, 0xbe, 0xc0, 0xbe, 0xa5, 0x96, 0x98, 0x99, 0x97, 0x99, 0x97, 0x93, 0x96, 0x93, 0x97, 0x97, 0x99, 0xf1, 0xf1, 0x03, 0x0c, 0x4e, 0x3f, 0x2e, 0x34, 0x38, 0x3c, 0x3c, 0x3c, 0x42, 0x3b, 0x41, 0x46, 0x36, 0x31, 0x3c, 0x3c, 0x3b, 0x38, 0x3b, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x42, 0x3c, 0x42, 0x3c, 0x38, 0x41, 0x37, 0x38, 0x38, 0x3b, 0x37, 0x3b, 0x38, 0x3b, 0x37, 0x36, 0x48, 0x0f, 0x03, 0x97, 0x93, 0x96, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x97, 0x95, 0x96, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x65, 0x01, 0x90, 0x01, 0x65, 0x61, 0x2c, 0x22, 0x4f, 0xf5, 0xd9, 0xc8, 0xcb, 0xcb, 0xc8, 0xd0, 0xda, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xe3, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xdc, 0xda, 0xda, 0xe0, 0xe0, 0xe0, 0xde, 0xe3, 0xde, 0xe1, 0xf0, 0x62, 0x2c, 0x24, 0x1e, 0x28, 0x1e, 0x2e, 0x47, 0x50, 0x4d, 0x4d, 0x48, 0x60, 0xf4, 0xd6, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd4, 0xd4, 0xd4, 0xd6, 0xd6, 0xda, 0xdc, 0xdc, 0xe0, 0xe0, 0xdc, 0xdc, 0xdc, 0xe6, 0x63, 0x53, 0x2a, 0x34, 0x34, 0x37, 0x37, 0x38, 0x38, 0x37, 0x37, 0x37, 0x34, 0x37, 0x31, 0x34, 0x32, 0x21, 0x07, 0x04, 0xf7, 0x9b, 0x9e, 0xba, 0xc2, 0xae, 0xae, 0xbe, 0xcf, 0xcf, 0xca, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xc1, 0xb9, 0xbe, 0xb2, 0xa7, 0xbb, 0xd3, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcd, 0xc7, 0xb6, 0xb4, 0xbd, 0xc0, 0xbe, 0xa2, 0x97, 0x99, 0x97, 0x99, 0x97, 0x99, 0x98, 0x93, 0x98, 0x97, 0x99, 0x97, 0x99, 0x02, 0x03, 0x2c, 0x4c, 0x2e, 0x3b, 0x37, 0x3c, 0x3c, 0x3b, 0x3c, 0x3c, 0x42, 0x38, 0x34, 0x49, 0x41, 0x42, 0x3c, 0x38, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x42, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x3c, 0x3c, 0x38, 0x37, 0x38, 0x3b, 0x38, 0x38, 0x39, 0x3d, 0x22, 0x06, 0x02, 0x97, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x97, 0x95, 0x95, 0xd1, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0x90, 0x90, 0x65, 0x5f, 0x2c, 0x2c, 0x55, 0xec, 0xd4, 0xcb, 0xcb, 0xc8, 0xd0, 0xd5, 0xda, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe3, 0xdf, 0xe0, 0xdc, 0xe0, 0xe0, 0xdf, 0xe1, 0xdf, 0xde, 0xe5, 0xff, 0x62, 0x26, 0x24, 0x23, 0x28, 0x1c, 0x2e, 0x52, 0x47, 0x52, 0x3d, 0x53, 0x60, 0xf4, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd6, 0xd4, 0xd6, 0xd6, 0xdc, 0xdc, 0xe0, 0xdc, 0xdf, 0xdc, 0xdc, 0xe0, 0xde, 0xdc, 0xe6, 0x63, 0x53, 0x2a, 0x39, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x34, 0x37, 0x34, 0x31, 0x37, 0x34, 0x32, 0x21, 0x09, 0x04, 0x9c, 0xf7, 0xa0, 0xba, 0xc3, 0xb0, 0xac, 0xc1, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc1, 0xb9, 0xc1, 0xb2, 0xa7, 0xbb, 0xd3, 0xcd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcd, 0xc7, 0xb6, 0xb2, 0xbe, 0xc0, 0xbd, 0xa6, 0x96, 0x9a, 0x97, 0x97, 0x99, 0x98, 0x98, 0x93, 0x98, 0x99, 0x99, 0x99, 0xf1, 0xf1, 0x07, 0x51, 0x32, 0x31, 0x42, 0x38, 0x3c, 0x3c, 0x37, 0x3b, 0x3c, 0x3c, 0x38, 0x38, 0x3b, 0x3c, 0x42, 0x3c, 0x31, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x42, 0x3c, 0x38, 0x42, 0x38, 0x42, 0x37, 0x38, 0x3c, 0x38, 0x3c, 0x3e, 0x2b, 0x3a, 0x0f, 0x03, 0x02, 0xf1, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x98, 0x95, 0x95, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x90, 0xed, 0x65, 0x5d, 0x26, 0x2c, 0x54, 0xec, 0xce, 0xc8, 0xcb, 0xce, 0xd5, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xe3, 0xe3, 0xe3, 0xe0, 0xdf, 0xe3, 0xe0, 0xdc, 0xe0, 0xde, 0xe3, 0xe1, 0xde, 0xe4, 0xff, 0x61, 0x21, 0x24, 0x23, 0x28, 0x1e, 0x2b, 0x58, 0x4d, 0x52, 0x4d, 0x53, 0x61, 0xe2, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd9, 0xda, 0xdc, 0xdc, 0xdc, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xdc, 0xde, 0xdc, 0xd9, 0xe6, 0xfe, 0x59, 0x2b, 0x36, 0x37, 0x37, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x34, 0x31, 0x37, 0x34, 0x32, 0x21, 0x07, 0x04, 0xf7, 0x9c, 0x9e, 0xba, 0xc2, 0xb2, 0xac, 0xc1, 0xcf, 0xcf, 0xca, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc1, 0xb9, 0xbe, 0xb2, 0xa7, 0xbb, 0xd3, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcd, 0xc7, 0xb6, 0xb4, 0xbd, 0xc0, 0xbe, 0xa5, 0x96, 0x99, 0x98, 0x97, 0x97, 0x98, 0x98, 0x93, 0x98, 0x98, 0x99, 0xf1, 0xf1, 0x02, 0x13, 0x51, 0x2e, 0x38, 0x42, 0x38, 0x42, 0x38, 0x37, 0x37, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x42, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x37, 0x38, 0x3b, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x36, 0x3a, 0x22, 0x04, 0x02, 0xf1, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x97, 0x95, 0x95, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x65, 0x65, 0x65, 0x90, 0x90, 0x65, 0x55, 0x26, 0x2c, 0x60, 0xe6, 0xce, 0xcb, 0xcb, 0xce, 0xda, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xe0, 0xdf, 0xe3, 0xe3, 0xe0, 0xe0, 0xe0, 0xde, 0xe3, 0xdf, 0xde, 0xe5, 0xff, 0x60, 0x26, 0x23, 0x23, 0x28, 0x1e, 0x34, 0x52, 0x47, 0x4d, 0x4c, 0x53, 0xfe, 0xdd, 0xd4, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xd5, 0xd6, 0xd6, 0xdc, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xdc, 0xdc, 0xe4, 0x63, 0x59, 0x2f, 0x34, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x31, 0x37, 0x34, 0x36, 0x21, 0x09, 0x04, 0x9c, 0x9a, 0xa0, 0xba, 0xc3, 0xae, 0xac, 0xc1, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xbe, 0xb9, 0xc1, 0xb2, 0xa7, 0xbb, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc7, 0xb6, 0xb2, 0xbd, 0xc0, 0xbd, 0xa6, 0x97, 0x98, 0x99, 0x97, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x02, 0x06, 0x27, 0x2f, 0x3e, 0x42, 0x42, 0x31, 0x38, 0x38, 0x3b, 0x31, 0x38, 0x42, 0x3c, 0x38, 0x38, 0x42, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3b, 0x3c, 0x38, 0x38, 0x42, 0x42, 0x38, 0x38, 0x37, 0x3b, 0x3c, 0x3c, 0x42, 0x3c, 0x2e, 0x3d, 0x2c, 0x0c, 0x03, 0xf1, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x97, 0x95, 0x95, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x64, 0x01, 0xf5, 0xed, 0x64, 0x4f, 0x26, 0x2c, 0xfe, 0xe1, 0xce, 0xc8, 0xce, 0xd4, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xdf, 0xe3, 0xdf, 0xe0, 0xe0, 0xe3, 0xdf, 0xdf, 0xde, 0xe6, 0x64, 0x5f, 0x1a, 0x24, 0x28, 0x23, 0x28, 0x36, 0x52, 0x50, 0x50, 0x48, 0x59, 0xfe, 0xdb, 0xd4, 0xd6, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xda, 0xda, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xe0, 0xdc, 0xde, 0xe4, 0xff, 0x59, 0x2f, 0x34, 0x37, 0x38, 0x37, 0x37, 0x34, 0x37, 0x31, 0x37, 0x37, 0x37, 0x37, 0x34, 0x32, 0x21, 0x09, 0xf7, 0xf7, 0x9c, 0x9d, 0xc0, 0xc0, 0xb0, 0xac, 0xbe, 0xcf, 0xcd, 0xca, 0xcf, 0xca, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xcf, 0xcd, 0xc1, 0xb6, 0xc0, 0xb2, 0xa7, 0xbb, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc7, 0xb6, 0xb4, 0xbd, 0xc0, 0xbd, 0xa6, 0x97, 0x99, 0x96, 0x99, 0x99, 0x99, 0x97, 0x98, 0x93, 0x98, 0x98, 0x9a, 0x02, 0x0c, 0x51, 0x2a, 0x2e, 0x38, 0x31, 0x31, 0x41, 0x42, 0x3c, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x41, 0x37, 0x2e, 0x3e, 0x3b, 0x3c, 0x3c, 0x49, 0x31, 0x32, 0x53, 0x18, 0x04, 0xf1, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x96, 0x97, 0x95, 0x95, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0x65, 0x65, 0x65, 0x90, 0x01, 0x64, 0x45, 0x26, 0x2c, 0x62, 0xe3, 0xc8, 0xce, 0xc8, 0xda, 0xe0, 0xe0, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xdf, 0xe0, 0xe0, 0xdf, 0xdf, 0xe0, 0xdf, 0xe7, 0xff, 0x5e, 0x26, 0x23, 0x28, 0x23, 0x24, 0x36, 0x4d, 0x50, 0x47, 0x4d, 0x59, 0xfe, 0xdb, 0xd2, 0xd5, 0xd6, 0xda, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xd6, 0xdc, 0xda, 0xdc, 0xdc, 0xe0, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdc, 0xdf, 0xdc, 0xdf, 0xe0, 0xdc, 0xdc, 0xdc, 0xe4, 0xff, 0x59, 0x2f, 0x32, 0x37, 0x3b, 0x37, 0x37, 0x34, 0x39, 0x31, 0x37, 0x37, 0x31, 0x37, 0x31, 0x3d, 0x21, 0x09, 0x04, 0x9c, 0x9c, 0x9e, 0xbe, 0xc0, 0xae, 0xaa, 0xc1, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xbe, 0xb6, 0xc0, 0xb2, 0xa7, 0xbc, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xca, 0xb6, 0xb2, 0xbd, 0xc0, 0xbd, 0xa6, 0x98, 0x97, 0x97, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x93, 0x98, 0xf1, 0x02, 0x0c, 0x4f, 0x3a, 0x2b, 0x34, 0x49, 0x3b, 0x37, 0x31, 0x38, 0x42, 0x42, 0x42, 0x38, 0x38, 0x3b, 0x38, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x42, 0x3c, 0x31, 0x3b, 0x49, 0x42, 0x2e, 0x38, 0x3e, 0x52, 0x48, 0x22, 0x0c, 0xf7, 0xf1, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x98, 0x95, 0x95, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0xed, 0x01, 0x62, 0x33, 0x26, 0x33, 0x63, 0xdc, 0xce, 0xc8, 0xd5, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xdf, 0xe1, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xe0, 0xde, 0xe8, 0x63, 0x59, 0x1a, 0x24, 0x28, 0x23, 0x28, 0x3d, 0x52, 0x50, 0x52, 0x48, 0x59, 0xef, 0xd7, 0xd4, 0xd4, 0xd6, 0xd4, 0xd6, 0xd6, 0xda, 0xd6, 0xdc, 0xda, 0xdf, 0xdc, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xe0, 0xdc, 0xde, 0xe4, 0x64, 0x54, 0x35, 0x32, 0x38, 0x37, 0x38, 0x39, 0x34, 0x37, 0x31, 0x37, 0x37, 0x37, 0x37, 0x34, 0x36, 0x21, 0x09, 0xf7, 0xf7, 0x9b, 0x9e, 0xf3, 0xc3, 0xad, 0xac, 0xbe, 0xcf, 0xcd, 0xca, 0xcd, 0xca, 0xcd, 0xcd, 0xcd, 0xca, 0xcd, 0xcd, 0xcd, 0xc1, 0xb6, 0xc0, 0xb4, 0xa7, 0xbc, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc7, 0xb6, 0xb3, 0xbd, 0xc0, 0xbe, 0xa6, 0x98, 0x97, 0x97, 0x99, 0x98, 0x97, 0x98, 0x9a, 0x93, 0x98, 0x98, 0x9a, 0x02, 0xf6, 0x09, 0x2c, 0x5a, 0x32, 0x28, 0x2e, 0x38, 0x42, 0x3c, 0x31, 0x38, 0x38, 0x38, 0x37, 0x38, 0x3b, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x42, 0x42, 0x38, 0x42, 0x42, 0x3c, 0x31, 0x3e, 0x52, 0x48, 0x15, 0x09, 0x03, 0x02, 0x95, 0xf1, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x96, 0x97, 0x95, 0x95, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x65, 0x65, 0x01, 0xed, 0x01, 0x60, 0x2c, 0x1a, 0x54, 0x63, 0xd9, 0xce, 0xc8, 0xda, 0xe0, 0xe0, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xdf, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xde, 0xe9, 0x63, 0x53, 0x26, 0x23, 0x28, 0x23, 0x2b, 0x46, 0x52, 0x50, 0x47, 0x48, 0x5f, 0xf4, 0xdb, 0xd6, 0xda, 0xda, 0xda, 0xe0, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdc, 0xe0, 0xdc, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdc, 0xdf, 0xdc, 0xdf, 0xe0, 0xdc, 0xe0, 0xd9, 0xe5, 0xff, 0x5d, 0x2f, 0x34, 0x37, 0x38, 0x37, 0x37, 0x34, 0x39, 0x31, 0x37, 0x37, 0x37, 0x37, 0x31, 0x3d, 0x21, 0x09, 0x04, 0x9c, 0x9a, 0xa0, 0xc0, 0xc0, 0xad, 0xac, 0xbd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xcd, 0xcd, 0xbe, 0xb6, 0xc0, 0xb2, 0xa7, 0xbd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xb8, 0xb2, 0xbd, 0xc0, 0xbe, 0xa6, 0x98, 0x99, 0x96, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9a, 0xf6, 0x9c, 0x05, 0x02, 0x03, 0x09, 0x2c, 0x4c, 0x3f, 0x37, 0x31, 0x3b, 0x3c, 0x31, 0x38, 0x3b, 0x38, 0x3b, 0x38, 0x38, 0x42, 0x42, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x42, 0x42, 0x42, 0x31, 0x38, 0x56, 0x26, 0x0c, 0x03, 0xf6, 0x95, 0xf1, 0x99, 0x97, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x98, 0x95, 0x95, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x65, 0x65, 0x01, 0x64, 0x5b, 0x2c, 0x26, 0x54, 0xff, 0xd9, 0xce, 0xce, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xdf, 0xe3, 0xdf, 0xe0, 0xe0, 0xdf, 0xdf, 0xde, 0xe1, 0xe9, 0x62, 0x45, 0x1a, 0x24, 0x28, 0x23, 0x2e, 0x46, 0x52, 0x50, 0x4d, 0x48, 0x5f, 0xf4, 0xde, 0xd9, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdc, 0xde, 0xdc, 0xe3, 0xdf, 0xe3, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xe0, 0xdc, 0xde, 0xe4, 0x64, 0x59, 0x2f, 0x36, 0x37, 0x3b, 0x37, 0x37, 0x34, 0x37, 0x31, 0x37, 0x37, 0x31, 0x37, 0x34, 0x32, 0x21, 0x09, 0xf7, 0x9c, 0x9c, 0xa0, 0xc0, 0xc0, 0xab, 0xac, 0xbd, 0xcf, 0xcd, 0xca, 0xcd, 0xca, 0xcd, 0xcd, 0xcd, 0xca, 0xcd, 0xcd, 0xcd, 0xbe, 0xb8, 0xc0, 0xb6, 0xa7, 0xbc, 0xcf, 0xcd, 0xcd, 0xca, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xc7, 0xb8, 0xb1, 0xbd, 0xc0, 0xc0, 0xa6, 0x9a, 0x97, 0x97, 0x98, 0x98, 0x93, 0x98, 0x98, 0x99, 0x98, 0x99, 0x9b, 0xf1, 0xf1, 0x02, 0x04, 0x03, 0x07, 0x11, 0x3d, 0x46, 0x2b, 0x2e, 0x50, 0x3b, 0x3b, 0x38, 0x3b, 0x3c, 0x38, 0x42, 0x38, 0x42, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x31, 0x3b, 0x49, 0x38, 0x31, 0x58, 0x4d, 0x15, 0x07, 0xf6, 0x94, 0x8e, 0x9a, 0xf1, 0xf1, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x97, 0x95, 0x95, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xed, 0x01, 0x01, 0x64, 0x5d, 0x22, 0x26, 0x5d, 0xff, 0xd2, 0xd6, 0xd5, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xde, 0xe0, 0xe0, 0xe0, 0xdf, 0xe3, 0xdc, 0xe1, 0xeb, 0x62, 0x3a, 0x26, 0x23, 0x28, 0x23, 0x2e, 0x4d, 0x52, 0x50, 0x4d, 0x48, 0x5f, 0xf4, 0xdb, 0xdc, 0xe0, 0xdf, 0xdf, 0xdf, 0xdc, 0xdc, 0xdc, 0xdf, 0xdc, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xdf, 0xdc, 0xdf, 0xde, 0xdf, 0xdc, 0xdf, 0xdc, 0xdf, 0xe0, 0xdc, 0xdc, 0xdc, 0xe4, 0xff, 0x5d, 0x35, 0x32, 0x37, 0x38, 0x37, 0x37, 0x34, 0x39, 0x31, 0x37, 0x37, 0x37, 0x37, 0x34, 0x3d, 0x21, 0x09, 0x05, 0xf7, 0x9a, 0xa0, 0xc0, 0xc0, 0xae, 0xaa, 0xc1, 0xcd, 0xcd, 0xca, 0xcd, 0xcd, 0xca, 0xcd, 0xca, 0xcd, 0xca, 0xcd, 0xcd, 0xbe, 0xb6, 0xc0, 0xb4, 0xaa, 0xbd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xb6, 0xb2, 0xbd, 0xc3, 0xbe, 0xa6, 0x98, 0x97, 0x97, 0x98, 0x98, 0x93, 0x98, 0x98, 0x97, 0x99, 0x97, 0x99, 0x95, 0x93, 0xf7, 0x9d, 0x02, 0x02, 0x03, 0x09, 0x21, 0x4e, 0x3d, 0x28, 0x31, 0x3b, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x3c, 0x3e, 0x34, 0x2e, 0x46, 0x3d, 0x0f, 0x06, 0x02, 0xf7, 0x95, 0x94, 0x95, 0x97, 0xf1, 0xf1, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x98, 0x95, 0x95, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x65, 0x64, 0x55, 0x2c, 0x21, 0x60, 0xef, 0xd4, 0xd5, 0xda, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xdf, 0xe3, 0xe0, 0xe0, 0xe0, 0xdf, 0xe3, 0xde, 0xe1, 0xf0, 0x62, 0x3a, 0x1a, 0x24, 0x28, 0x23, 0x2e, 0x52, 0x52, 0x4d, 0x4d, 0x48, 0x60, 0xf4, 0xd9, 0xdc, 0xdf, 0xdf, 0xde, 0xdf, 0xe3, 0xdf, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xe0, 0xdc, 0xde, 0xe4, 0x64, 0x59, 0x3a, 0x34, 0x37, 0x3b, 0x37, 0x37, 0x34, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x32, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xa0, 0xc2, 0xbe, 0xad, 0xac, 0xbd, 0xd3, 0xcf, 0xcd, 0xcd, 0xca, 0xcd, 0xcd, 0xca, 0xcd, 0xca, 0xcd, 0xcd, 0xbd, 0xb6, 0xc0, 0xb6, 0xa7, 0xbc, 0xcf, 0xcd, 0xcd, 0xca, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xcd, 0xcf, 0xc7, 0xb8, 0xb1, 0xbd, 0xc0, 0xc0, 0xa7, 0x99, 0x98, 0x97, 0x98, 0x93, 0x93, 0x98, 0x97, 0x99, 0x99, 0x97, 0x98, 0x98, 0x9a, 0x92, 0x92, 0x98, 0x9b, 0x02, 0x03, 0x06, 0x0f, 0x35, 0x46, 0x3e, 0x3c, 0x3c, 0x3c, 0x42, 0x3c, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x34, 0x3d, 0x2c, 0x09, 0x03, 0xf6, 0xf7, 0x95, 0x97, 0x9c, 0x97, 0x95, 0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x97, 0x95, 0x95, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0x01, 0xed, 0x01, 0x65, 0x62, 0x55, 0x21, 0x26, 0x60, 0xe6, 0xd9, 0xda, 0xe3, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe3, 0xdf, 0xe0, 0xe0, 0xe0, 0xdf, 0xde, 0xe3, 0xe4, 0xff, 0x61, 0x2f, 0x24, 0x2b, 0x23, 0x23, 0x39, 0x52, 0x4d, 0x4d, 0x4d, 0x53, 0x61, 0xe2, 0xdb, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xe0, 0xde, 0xe5, 0xff, 0x5d, 0x2f, 0x36, 0x3b, 0x3b, 0x38, 0x39, 0x34, 0x37, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xa2, 0xc4, 0xc0, 0xab, 0xaa, 0xbc, 0xd3, 0xd3, 0xd3, 0xd3, 0xcf, 0xd3, 0xcf, 0xcf, 0xd3, 0xcf, 0xd3, 0xd3, 0xc1, 0xb2, 0xc0, 0xb8, 0xa7, 0xbb, 0xd3, 0xd3, 0xd3, 0xcf, 0xd3, 0xcf, 0xd3, 0xd3, 0xd3, 0xd3, 0xcd, 0xdb, 0xc7, 0xbb, 0xb2, 0xbd, 0xc3, 0xbe, 0xa6, 0x96, 0x96, 0x99, 0x98, 0x98, 0x93, 0x98, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x98, 0x99, 0x02, 0x04, 0x09, 0x2a, 0x47, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x38, 0x3b, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x47, 0x19, 0x09, 0xf6, 0x8b, 0x99, 0x99, 0xf1, 0xf1, 0xf1, 0x97, 0x96, 0x96, 0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x97, 0x96, 0x96, 0x94, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x65, 0x62, 0x51, 0x21, 0x2c, 0x60, 0xe8, 0xd9, 0xda, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe3, 0xdf, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xde, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xde, 0xe4, 0xec, 0x5f, 0x2f, 0x24, 0x24, 0x28, 0x23, 0x39, 0x52, 0x4d, 0x4d, 0x4d, 0x53, 0x60, 0xe2, 0xde, 0xdc, 0xdf, 0xde, 0xe1, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xe3, 0xdf, 0xe3, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdc, 0xe0, 0xdc, 0xe6, 0xff, 0x5e, 0x2f, 0x36, 0x3b, 0x3b, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x32, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xa6, 0xc4, 0xbd, 0xab, 0xa4, 0xac, 0xb1, 0xae, 0xb3, 0xb8, 0xb4, 0xb8, 0xbb, 0xbb, 0xbc, 0xbd, 0xbc, 0xbb, 0xb4, 0xb0, 0xbe, 0xb8, 0xaa, 0xb1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc3, 0xc1, 0xc5, 0xc1, 0xc1, 0xc5, 0xc1, 0xb4, 0xb2, 0xbb, 0xc3, 0xbe, 0xa6, 0x98, 0x97, 0x99, 0x99, 0x93, 0x98, 0x98, 0x97, 0x99, 0x99, 0x97, 0x96, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x98, 0xf7, 0x03, 0x09, 0x16, 0x49, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x38, 0x37, 0x3b, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x42, 0x41, 0x3d, 0x11, 0x04, 0x03, 0x96, 0x95, 0x99, 0x99, 0x99, 0x96, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x97, 0x97, 0x95, 0x95, 0xc9, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0x01, 0x90, 0x01, 0x65, 0x61, 0x3a, 0x26, 0x2c, 0xfe, 0xe6, 0xdc, 0xda, 0xe3, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xe3, 0xdf, 0xe0, 0xe0, 0xe0, 0xe3, 0xde, 0xde, 0xe5, 0x64, 0x5f, 0x2f, 0x1a, 0x2b, 0x23, 0x28, 0x47, 0x50, 0x4d, 0x4d, 0x4d, 0x5e, 0x60, 0xe2, 0xdb, 0xdc, 0xdf, 0xdf, 0xde, 0xdf, 0xe1, 0xe3, 0xe3, 0xe3, 0xdf, 0xe3, 0xe3, 0xe3, 0xe3, 0xde, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdc, 0xde, 0xe5, 0xff, 0x5d, 0x2f, 0x36, 0x41, 0x3b, 0x38, 0x39, 0x34, 0x39, 0x31, 0x3b, 0x37, 0x37, 0x37, 0x34, 0x3d, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xa6, 0xc2, 0xc0, 0xaa, 0xa7, 0xa9, 0xa1, 0x9e, 0xa1, 0xa1, 0x9f, 0xa1, 0x9e, 0x9f, 0x9f, 0xa1, 0xa1, 0xa4, 0xa7, 0xab, 0xbe, 0xbb, 0xae, 0xa4, 0xa1, 0x9e, 0xa1, 0xa1, 0xa1, 0xa1, 0xa4, 0xa1, 0xa4, 0xa4, 0xa1, 0xa7, 0xa4, 0xa7, 0xb4, 0xbe, 0xc3, 0xbe, 0xa7, 0x99, 0x97, 0x99, 0x98, 0x98, 0x98, 0x99, 0x97, 0x99, 0x99, 0x98, 0x98, 0x93, 0x93, 0x93, 0x93, 0x96, 0x97, 0x99, 0x95, 0x04, 0x09, 0x21, 0x4d, 0x37, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x38, 0x37, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x42, 0x42, 0x3c, 0x39, 0x3d, 0x21, 0x09, 0x8b, 0xf1, 0x96, 0x93, 0x93, 0x98, 0x97, 0x96, 0x99, 0x97, 0x97, 0x96, 0x97, 0x97, 0x98, 0x97, 0x97, 0x96, 0x94, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0x90, 0xed, 0x65, 0x5f, 0x3a, 0x1a, 0x45, 0xfe, 0xe5, 0xe0, 0xda, 0xe3, 0xdf, 0xe0, 0xe0, 0xdc, 0xe0, 0xe0, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xde, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xde, 0xe6, 0x65, 0x5d, 0x2a, 0x24, 0x24, 0x28, 0x2e, 0x41, 0x52, 0x4d, 0x4d, 0x48, 0x5e, 0x60, 0xdd, 0xde, 0xe0, 0xdf, 0xe1, 0xe3, 0xe1, 0xdf, 0xe1, 0xde, 0xde, 0xe3, 0xde, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdc, 0xe0, 0xdc, 0xe6, 0xff, 0x5e, 0x2f, 0x36, 0x3b, 0x3b, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xa2, 0xc4, 0xc0, 0xb0, 0xa7, 0xa9, 0xa7, 0xa4, 0xa9, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa4, 0xa9, 0xa7, 0xac, 0xbd, 0xb8, 0xaa, 0xa4, 0xa4, 0xa4, 0xa1, 0xa1, 0xa1, 0x9f, 0xa1, 0x9e, 0x9f, 0xa1, 0x9e, 0x9f, 0xa1, 0xa4, 0xb6, 0xbe, 0xc3, 0xbe, 0xa6, 0x98, 0x99, 0x99, 0x97, 0x98, 0x97, 0x98, 0x97, 0x99, 0x97, 0x9a, 0x98, 0x96, 0x93, 0x99, 0x99, 0xf7, 0xf1, 0x03, 0x04, 0x0c, 0x2c, 0x48, 0x34, 0x31, 0x42, 0x42, 0x42, 0x3c, 0x3c, 0x38, 0x3b, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x31, 0x38, 0x49, 0x3c, 0x37, 0x58, 0x2f, 0x0c, 0x03, 0x95, 0x95, 0x93, 0x93, 0x96, 0xf1, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x97, 0x96, 0x94, 0xc9, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x90, 0x90, 0x64, 0x5f, 0x2f, 0x26, 0x45, 0x63, 0xe1, 0xdc, 0xe0, 0xdf, 0xde, 0xe0, 0xe0, 0xe0, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xe3, 0xdf, 0xe0, 0xe0, 0xe0, 0xe3, 0xde, 0xde, 0xe8, 0x64, 0x59, 0x26, 0x24, 0x2b, 0x23, 0x2e, 0x47, 0x50, 0x4d, 0x4d, 0x4c, 0x5e, 0x60, 0xee, 0xde, 0xdf, 0xe3, 0xe3, 0xe1, 0xe3, 0xe1, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdc, 0xde, 0xe5, 0xff, 0x5d, 0x2f, 0x36, 0x41, 0x3b, 0x38, 0x39, 0x34, 0x39, 0x31, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xa2, 0xc2, 0xc0, 0xb2, 0xae, 0xbb, 0xc1, 0xbd, 0xbc, 0xb8, 0xb7, 0xb6, 0xb3, 0xb6, 0xb1, 0xb1, 0xb1, 0xaa, 0xaa, 0xae, 0xc0, 0xbb, 0xac, 0xae, 0xb8, 0xb8, 0xb7, 0xb3, 0xb3, 0xb1, 0xae, 0xaf, 0xae, 0xaf, 0xae, 0xaf, 0xae, 0xaa, 0xb4, 0xbd, 0xc3, 0xc0, 0xa7, 0x99, 0x98, 0x99, 0x99, 0x97, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x93, 0x96, 0x97, 0x99, 0xf7, 0x02, 0x02, 0x07, 0x11, 0x3a, 0x35, 0x2b, 0x3e, 0x38, 0x38, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x37, 0x31, 0x42, 0x42, 0x31, 0x47, 0x3d, 0x13, 0x06, 0x95, 0x95, 0x96, 0xf1, 0x99, 0x99, 0x97, 0x97, 0x96, 0x97, 0x97, 0x98, 0x97, 0x97, 0x96, 0x94, 0xc4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x90, 0x64, 0x59, 0x25, 0x24, 0x4f, 0x64, 0xde, 0xdc, 0xe0, 0xdf, 0xdf, 0xe0, 0xe0, 0xdc, 0xe0, 0xe0, 0xdc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe1, 0xe8, 0x64, 0x55, 0x24, 0x24, 0x24, 0x23, 0x31, 0x49, 0x50, 0x4d, 0x4d, 0x48, 0x5f, 0x60, 0xdd, 0xde, 0xdf, 0xe3, 0xe1, 0xe3, 0xe1, 0xe3, 0xe1, 0xe3, 0xe1, 0xdf, 0xdf, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xe0, 0xe0, 0xdc, 0xe6, 0xff, 0x5e, 0x2f, 0x36, 0x3b, 0x3b, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x32, 0x21, 0x09, 0x05, 0x8e, 0x9c, 0xa2, 0xc2, 0xc0, 0xb0, 0xac, 0xc1, 0xd3, 0xcf, 0xca, 0xd3, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcc, 0xca, 0xc3, 0xb3, 0xb0, 0xc0, 0xb9, 0xa7, 0xb8, 0xd3, 0xdb, 0xd7, 0xdb, 0xd3, 0xdb, 0xd3, 0xd3, 0xd3, 0xcd, 0xcf, 0xd3, 0xc5, 0xae, 0xb4, 0xbd, 0xc3, 0xbe, 0xa7, 0x99, 0x9a, 0x99, 0x97, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x99, 0xf1, 0x02, 0x04, 0x09, 0x21, 0x46, 0x3f, 0x37, 0x3b, 0x41, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x37, 0x37, 0x42, 0x38, 0x42, 0x41, 0x36, 0x56, 0x17, 0x07, 0x02, 0xf1, 0x99, 0x97, 0x96, 0x99, 0x96, 0x97, 0x97, 0x97, 0x96, 0x97, 0x97, 0x96, 0x94, 0x20, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0xec, 0xec, 0xeb, 0xeb, 0xeb, 0xec, 0x90, 0x90, 0x64, 0x59, 0x26, 0x26, 0x54, 0x64, 0xd9, 0xe0, 0xe0, 0xde, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe3, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xdf, 0xe3, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xe9, 0x63, 0x45, 0x2a, 0x24, 0x28, 0x23, 0x2e, 0x47, 0x50, 0x47, 0x4d, 0x48, 0x5f, 0x5b, 0xdd, 0xde, 0xe1, 0xe3, 0xe1, 0xde, 0xdb, 0xd9, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xde, 0xe3, 0xe3, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xde, 0xe5, 0x63, 0x5d, 0x35, 0x34, 0x39, 0x3b, 0x37, 0x41, 0x34, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xa2, 0xc4, 0xc0, 0xae, 0xaa, 0xbd, 0xd3, 0xca, 0xca, 0xcd, 0xcd, 0xca, 0xca, 0xcd, 0xca, 0xca, 0xcf, 0xc5, 0xb4, 0xab, 0xc3, 0xbe, 0xaa, 0xb7, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcf, 0xcd, 0xcd, 0xd3, 0xd3, 0xc5, 0xaa, 0xae, 0xbe, 0xc3, 0xc0, 0xaa, 0x9a, 0x97, 0x9a, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x97, 0xf1, 0x02, 0x04, 0x0c, 0x2c, 0x4c, 0x3b, 0x3b, 0x3c, 0x38, 0x38, 0x42, 0x3c, 0x3b, 0x3b, 0x37, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x3c, 0x42, 0x31, 0x41, 0x39, 0x36, 0x4e, 0x26, 0x09, 0x03, 0xf1, 0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x97, 0x98, 0x97, 0x97, 0x96, 0x94, 0xc2, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x65, 0x01, 0x01, 0xf5, 0xed, 0xec, 0xe7, 0xdd, 0xd1, 0xc7, 0xc4, 0xc4, 0xc3, 0xc0, 0xc4, 0xd7, 0xe9, 0x01, 0x62, 0x4b, 0x2a, 0x26, 0x5d, 0xec, 0xd9, 0xe0, 0xe0, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xdf, 0xe3, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe9, 0x62, 0x45, 0x24, 0x28, 0x23, 0x23, 0x32, 0x46, 0x52, 0x49, 0x47, 0x48, 0x61, 0xf4, 0xdd, 0xdb, 0xe1, 0xcf, 0xca, 0xca, 0xc7, 0xc5, 0xc7, 0xc5, 0xc7, 0xc5, 0xca, 0xca, 0xd9, 0xe1, 0xe3, 0xdc, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xe6, 0x63, 0x59, 0x35, 0x36, 0x3e, 0x34, 0x37, 0x39, 0x38, 0x37, 0x37, 0x34, 0x34, 0x34, 0x37, 0x34, 0x32, 0x21, 0x09, 0x05, 0x8e, 0x9c, 0xa0, 0xc4, 0xc0, 0xae, 0xa7, 0xc1, 0xcd, 0xc7, 0xcd, 0xca, 0xca, 0xca, 0xc7, 0xca, 0xc7, 0xca, 0xc7, 0xc5, 0xb2, 0xae, 0xc0, 0xbe, 0xaa, 0xb6, 0xcf, 0xcd, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcd, 0xca, 0xcd, 0xcf, 0xc3, 0xac, 0xb2, 0xbd, 0xc3, 0xbe, 0xab, 0x9a, 0x98, 0x97, 0x98, 0x93, 0x93, 0x93, 0x93, 0x93, 0x99, 0x99, 0xf1, 0x95, 0x02, 0x05, 0x11, 0x46, 0x37, 0x3e, 0x3b, 0x3b, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x38, 0x39, 0x37, 0x37, 0x38, 0x42, 0x38, 0x37, 0x38, 0x3c, 0x3c, 0x42, 0x42, 0x3c, 0x42, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x39, 0x34, 0x40, 0x34, 0x52, 0x35, 0x0c, 0x03, 0x95, 0xf1, 0x96, 0x99, 0x97, 0x97, 0x97, 0x96, 0x98, 0x97, 0x97, 0x94, 0x20, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xe7, 0xcc, 0xb9, 0xb2, 0xae, 0xae, 0xb6, 0xb9, 0xbe, 0xba, 0xc3, 0xe2, 0x65, 0x61, 0x3a, 0x2a, 0x21, 0x5d, 0xec, 0xd9, 0xe0, 0xe0, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe3, 0xe3, 0xe0, 0xe0, 0xe0, 0xe1, 0xef, 0x62, 0x3a, 0x24, 0x2e, 0x28, 0x24, 0x32, 0x4c, 0x50, 0x49, 0x4d, 0x5a, 0x60, 0xfd, 0xdb, 0xe1, 0xdb, 0xc7, 0xca, 0xca, 0xcd, 0xcc, 0xcd, 0xd3, 0xcf, 0xcf, 0xca, 0xcd, 0xd2, 0xd9, 0xe3, 0xde, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdc, 0xe8, 0x63, 0x5e, 0x35, 0x36, 0x3e, 0x34, 0x39, 0x37, 0x41, 0x37, 0x37, 0x34, 0x34, 0x34, 0x37, 0x34, 0x3d, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xf2, 0xc4, 0xc0, 0xae, 0xa7, 0xc1, 0xcd, 0xca, 0xca, 0xca, 0xcd, 0xca, 0xc5, 0xca, 0xca, 0xc7, 0xca, 0xc3, 0xb4, 0xb2, 0xc0, 0xbd, 0xac, 0xb4, 0xcd, 0xcd, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcf, 0xc3, 0xac, 0xb2, 0xbd, 0xc2, 0xbe, 0xab, 0x9a, 0x96, 0x98, 0x98, 0x98, 0x93, 0x93, 0x93, 0x98, 0xf1, 0xf7, 0x03, 0x03, 0x07, 0x22, 0x4e, 0x47, 0x38, 0x38, 0x3b, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x38, 0x3b, 0x39, 0x37, 0x3b, 0x38, 0x42, 0x3c, 0x3b, 0x3c, 0x38, 0x3c, 0x42, 0x3c, 0x42, 0x38, 0x3c, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x42, 0x42, 0x38, 0x39, 0x37, 0x37, 0x3b, 0x3b, 0x4d, 0x48, 0x0c, 0x04, 0xf1, 0x99, 0x96, 0x97, 0x97, 0x98, 0x96, 0x97, 0x97, 0x96, 0x94, 0xc2, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x65, 0xf5, 0xed, 0x01, 0x01, 0xe9, 0xd1, 0xc4, 0xc4, 0xc4, 0xc7, 0xd1, 0xdb, 0xdd, 0xd7, 0xd1, 0xe9, 0x65, 0x61, 0x2f, 0x24, 0x26, 0x60, 0xf0, 0xd9, 0xe3, 0xe0, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe3, 0xdf, 0xe0, 0xe0, 0xe0, 0xe1, 0xff, 0x61, 0x3a, 0x24, 0x23, 0x28, 0x23, 0x3d, 0x46, 0x52, 0x50, 0x4d, 0x5a, 0x60, 0xe2, 0xdd, 0xe4, 0xdb, 0xc5, 0xd3, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcd, 0xcd, 0xd2, 0xdb, 0xde, 0xde, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xe8, 0x63, 0x59, 0x35, 0x36, 0x3f, 0x39, 0x34, 0x37, 0x37, 0x38, 0x37, 0x34, 0x34, 0x34, 0x37, 0x34, 0x3d, 0x21, 0x09, 0x05, 0x8e, 0x9c, 0xa0, 0xc4, 0xc0, 0xae, 0xaa, 0xc1, 0xcd, 0xc7, 0xcd, 0xc5, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xca, 0xc3, 0xb3, 0xb0, 0xc1, 0xbd, 0xa7, 0xb3, 0xcd, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcd, 0xcd, 0xc5, 0xab, 0xb1, 0xbd, 0xc3, 0xbe, 0xab, 0x9a, 0x96, 0x98, 0x98, 0x99, 0x99, 0x99, 0x98, 0x99, 0xf7, 0x04, 0x06, 0x13, 0x2c, 0x4e, 0x32, 0x31, 0x42, 0x3c, 0x38, 0x38, 0x3c, 0x42, 0x38, 0x38, 0x38, 0x37, 0x3b, 0x37, 0x3b, 0x3c, 0x42, 0x3c, 0x38, 0x38, 0x3c, 0x42, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x3b, 0x37, 0x38, 0x3b, 0x38, 0x3b, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x49, 0x2e, 0x42, 0x39, 0x4c, 0x45, 0x10, 0x9c, 0x97, 0x96, 0x97, 0x97, 0x9a, 0x96, 0x97, 0x99, 0x96, 0x94, 0x20, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xf5, 0xed, 0xed, 0x01, 0xe9, 0xd7, 0xc7, 0xcc, 0xcc, 0xd3, 0xd3, 0xd3, 0xd7, 0xd7, 0xcc, 0xe7, 0x64, 0x5f, 0x2f, 0x2a, 0x2c, 0x61, 0xe9, 0xde, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xdf, 0xe3, 0xe3, 0xe0, 0xe0, 0xe0, 0xde, 0xe5, 0xff, 0x60, 0x2c, 0x24, 0x28, 0x23, 0x2b, 0x36, 0x4d, 0x50, 0x47, 0x4d, 0x5a, 0x60, 0xe2, 0xdd, 0xe5, 0xdb, 0xc7, 0xcd, 0xca, 0xcc, 0xca, 0xcc, 0xcd, 0xcc, 0xca, 0xca, 0xdb, 0xe3, 0xe5, 0xde, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xda, 0xe8, 0x63, 0x59, 0x35, 0x36, 0x39, 0x34, 0x39, 0x39, 0x37, 0x41, 0x37, 0x39, 0x34, 0x34, 0x39, 0x34, 0x3d, 0x21, 0x09, 0x04, 0x9c, 0x9c, 0xf2, 0xc4, 0xc0, 0xae, 0xa7, 0xc1, 0xcd, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc5, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xb4, 0xb2, 0xc0, 0xbd, 0xa7, 0xb3, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcd, 0xc3, 0xac, 0xb2, 0xbd, 0xc2, 0xbe, 0xab, 0x9a, 0x96, 0x98, 0x98, 0xf1, 0x99, 0x99, 0x9a, 0xf1, 0xf7, 0x02, 0x0f, 0x53, 0x32, 0x32, 0x3b, 0x31, 0x3b, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x3b, 0x37, 0x3b, 0x3b, 0x3c, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3b, 0x3b, 0x37, 0x3b, 0x37, 0x3b, 0x37, 0x3b, 0x38, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x42, 0x3c, 0x38, 0x32, 0x56, 0x27, 0x05, 0x97, 0x96, 0x97, 0x97, 0x9a, 0x96, 0x97, 0x97, 0x97, 0x94, 0xc2, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0xed, 0xed, 0xe9, 0xd3, 0xd1, 0xcf, 0xd3, 0xd1, 0xd3, 0xd8, 0xd7, 0xd7, 0xcc, 0xef, 0x64, 0x5d, 0x2a, 0x2a, 0x2c, 0x62, 0xe7, 0xde, 0xdc, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe3, 0xe3, 0xe0, 0xe0, 0xdf, 0xe6, 0xff, 0x5d, 0x2f, 0x24, 0x28, 0x23, 0x2b, 0x36, 0x52, 0x52, 0x47, 0x48, 0x5e, 0x60, 0xe2, 0xdd, 0xe1, 0xdd, 0xcd, 0xca, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xca, 0xd2, 0xe1, 0xe5, 0xe3, 0xde, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xdf, 0xe3, 0xe0, 0xde, 0xe5, 0x64, 0x59, 0x35, 0x32, 0x36, 0x40, 0x34, 0x3b, 0x41, 0x37, 0x3b, 0x34, 0x39, 0x34, 0x37, 0x34, 0x3d, 0x21, 0x09, 0x05, 0x8e, 0x9c, 0xa2, 0xc4, 0xc0, 0xae, 0xa7, 0xc1, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xca, 0xc3, 0xb4, 0xb0, 0xc1, 0xbd, 0xa7, 0xb1, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcf, 0xc3, 0xac, 0xb0, 0xbe, 0xc3, 0xbe, 0xab, 0x9a, 0x96, 0x98, 0x98, 0x99, 0x99, 0x99, 0x97, 0x98, 0xf7, 0x02, 0x0c, 0x48, 0x4d, 0x2e, 0x42, 0x2e, 0x31, 0x3c, 0x3c, 0x38, 0x38, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x3c, 0x3c, 0x3c, 0x42, 0x42, 0x3c, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x3b, 0x38, 0x37, 0x38, 0x3b, 0x38, 0x3b, 0x37, 0x39, 0x37, 0x38, 0x42, 0x42, 0x42, 0x42, 0x38, 0x49, 0x38, 0x3e, 0x46, 0x3a, 0x0f, 0xf7, 0x99, 0x96, 0x97, 0x99, 0x98, 0x96, 0x97, 0x99, 0x96, 0x94, 0x20, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe9, 0xd8, 0xcc, 0xd1, 0xd3, 0xcc, 0xcf, 0xd7, 0xdd, 0xd3, 0xd1, 0xeb, 0x63, 0x5e, 0x26, 0x2a, 0x3a, 0x63, 0xe6, 0xde, 0xdc, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xe3, 0xe0, 0xe0, 0xe0, 0xde, 0xe6, 0xff, 0x5d, 0x2c, 0x24, 0x23, 0x28, 0x2b, 0x36, 0x52, 0x47, 0x4d, 0x56, 0x5f, 0x5b, 0xe2, 0xdd, 0xe1, 0xdd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcf, 0xcd, 0xcd, 0xd3, 0xe1, 0xe3, 0xdf, 0xe3, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe3, 0xda, 0xe8, 0x63, 0x59, 0x2f, 0x3d, 0x34, 0x36, 0x39, 0x39, 0x39, 0x38, 0x39, 0x37, 0x34, 0x34, 0x39, 0x34, 0x3d, 0x21, 0x09, 0x04, 0x9c, 0x9c, 0xa2, 0xc4, 0xc0, 0xac, 0xa7, 0xc1, 0xcd, 0xca, 0xca, 0xc5, 0xca, 0xca, 0xc5, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xb4, 0xb2, 0xc0, 0xbe, 0xa7, 0xb1, 0xcd, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcd, 0xc3, 0xac, 0xb2, 0xbd, 0xc2, 0xbe, 0xab, 0x9a, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x93, 0x98, 0xf1, 0x04, 0x0f, 0x4d, 0x31, 0x38, 0x3b, 0x34, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x3b, 0x3c, 0x3c, 0x3c, 0x3c, 0x42, 0x42, 0x38, 0x42, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x3b, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x3b, 0x37, 0x37, 0x3b, 0x38, 0x3c, 0x3c, 0x42, 0x42, 0x3c, 0x38, 0x36, 0x3d, 0x17, 0x06, 0x02, 0x97, 0x97, 0x97, 0x97, 0x98, 0x96, 0x97, 0x97, 0x97, 0x94, 0xc2, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0xed, 0x01, 0x01, 0xea, 0xd8, 0xcc, 0xd3, 0xd3, 0xd1, 0xd3, 0xd7, 0xdd, 0xd7, 0xd1, 0xff, 0x63, 0x51, 0x2f, 0x2a, 0x45, 0x63, 0xe4, 0xde, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xe0, 0xe0, 0xe0, 0xe1, 0xe6, 0x63, 0x59, 0x26, 0x24, 0x28, 0x23, 0x2e, 0x46, 0x50, 0x4d, 0x4d, 0x48, 0x61, 0x5b, 0xe2, 0xdd, 0xe1, 0xdd, 0xd3, 0xca, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xd9, 0xe1, 0xe3, 0xe1, 0xe3, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe3, 0xe0, 0xe0, 0xe3, 0xe0, 0xde, 0xe8, 0xff, 0x59, 0x35, 0x32, 0x36, 0x40, 0x36, 0x41, 0x37, 0x41, 0x37, 0x39, 0x39, 0x39, 0x37, 0x34, 0x3d, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xa2, 0xc4, 0xc0, 0xae, 0xa7, 0xc1, 0xcd, 0xc5, 0xcd, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc5, 0xcd, 0xc3, 0xb4, 0xae, 0xc3, 0xbd, 0xaa, 0xb3, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc5, 0xca, 0xcf, 0xc3, 0xac, 0xb0, 0xbe, 0xc3, 0xbe, 0xab, 0x9a, 0x96, 0x98, 0x98, 0x93, 0x93, 0x93, 0x98, 0x93, 0x93, 0x98, 0x02, 0x06, 0x26, 0x46, 0x2e, 0x3b, 0x34, 0x31, 0x41, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x3b, 0x37, 0x3b, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x3b, 0x3b, 0x37, 0x3b, 0x37, 0x3b, 0x3c, 0x42, 0x31, 0x47, 0x4c, 0x22, 0x09, 0x03, 0xf1, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x97, 0x98, 0x96, 0x94, 0x20, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xea, 0xd8, 0xcc, 0xd1, 0xd3, 0xd3, 0xd3, 0xd7, 0xdd, 0xd7, 0xd3, 0xff, 0x62, 0x51, 0x2a, 0x2a, 0x45, 0x64, 0xdd, 0xde, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe0, 0xdf, 0xe1, 0xe8, 0x63, 0x54, 0x26, 0x2b, 0x2b, 0x23, 0x2b, 0x40, 0x47, 0x52, 0x35, 0x5a, 0x61, 0xf4, 0xe2, 0xde, 0xdd, 0xe4, 0xcd, 0xcd, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xca, 0xdd, 0xe3, 0xe1, 0xe3, 0xdf, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xdf, 0xe0, 0xe3, 0xe3, 0xdf, 0xe0, 0xe3, 0xdc, 0xe8, 0x63, 0x54, 0x35, 0x36, 0x40, 0x36, 0x39, 0x39, 0x39, 0x41, 0x39, 0x39, 0x39, 0x34, 0x39, 0x34, 0x3d, 0x21, 0x07, 0x04, 0x8e, 0x9c, 0xa2, 0xc9, 0xc0, 0xac, 0xaa, 0xc1, 0xcd, 0xca, 0xca, 0xca, 0xc5, 0xca, 0xca, 0xc5, 0xc5, 0xca, 0xca, 0xc5, 0xb4, 0xae, 0xc3, 0xbe, 0xac, 0xb3, 0xca, 0xca, 0xca, 0xc5, 0xca, 0xc5, 0xca, 0xc7, 0xca, 0xca, 0xc5, 0xcd, 0xc3, 0xaa, 0xb0, 0xbd, 0xc3, 0xc0, 0xab, 0x9a, 0x96, 0x98, 0x93, 0x93, 0x93, 0x98, 0x98, 0x93, 0x93, 0x93, 0xf1, 0x03, 0x0f, 0x3d, 0x34, 0x31, 0x3b, 0x41, 0x31, 0x38, 0x3c, 0x3c, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x38, 0x3b, 0x37, 0x3b, 0x38, 0x38, 0x3b, 0x37, 0x3b, 0x38, 0x3c, 0x3c, 0x42, 0x42, 0x3c, 0x38, 0x42, 0x38, 0x42, 0x3c, 0x3b, 0x34, 0x37, 0x3b, 0x3c, 0x42, 0x2e, 0x4d, 0x3a, 0x0c, 0x03, 0xf1, 0x99, 0x97, 0x99, 0x97, 0x99, 0x97, 0x98, 0x97, 0x99, 0x96, 0x94, 0xc2, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0x01, 0xed, 0xeb, 0xd8, 0xcc, 0xd3, 0xd3, 0xd3, 0xd7, 0xd7, 0xdd, 0xd3, 0xd8, 0xff, 0x62, 0x48, 0x35, 0x2a, 0x4f, 0x64, 0xe4, 0xd9, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe3, 0xe0, 0xe0, 0xe0, 0xdf, 0xe4, 0xef, 0x62, 0x54, 0x1a, 0x2b, 0x2b, 0x23, 0x34, 0x47, 0x50, 0x4d, 0x3d, 0x59, 0x61, 0xf4, 0xdd, 0xdd, 0xe1, 0xe4, 0xcf, 0xcd, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xd3, 0xca, 0xcd, 0xde, 0xe5, 0xdf, 0xe1, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xe7, 0x63, 0x53, 0x3d, 0x32, 0x34, 0x40, 0x34, 0x39, 0x41, 0x39, 0x3b, 0x36, 0x39, 0x39, 0x37, 0x34, 0x3d, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xa2, 0xc9, 0xbe, 0xae, 0xa4, 0xc1, 0xd3, 0xc5, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc5, 0xca, 0xc3, 0xb1, 0xab, 0xc3, 0xbd, 0xac, 0xb4, 0xc7, 0xca, 0xca, 0xca, 0xc7, 0xc5, 0xc7, 0xc7, 0xc7, 0xca, 0xc5, 0xcd, 0xc3, 0xae, 0xb4, 0xbd, 0xc3, 0xc0, 0xab, 0x9a, 0x96, 0x98, 0x98, 0x93, 0x98, 0x99, 0xf1, 0x9a, 0x93, 0x93, 0x93, 0x02, 0x06, 0x26, 0x46, 0x31, 0x3c, 0x38, 0x37, 0x41, 0x42, 0x3c, 0x3c, 0x42, 0x42, 0x38, 0x41, 0x41, 0x41, 0x37, 0x2e, 0x3b, 0x3c, 0x38, 0x37, 0x3b, 0x37, 0x3c, 0x3c, 0x3c, 0x3c, 0x42, 0x42, 0x37, 0x37, 0x38, 0x42, 0x42, 0x38, 0x3b, 0x3b, 0x3b, 0x3c, 0x3c, 0x41, 0x48, 0x11, 0x06, 0x02, 0x99, 0x99, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x97, 0x99, 0x96, 0x94, 0xc2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xeb, 0xd8, 0xcc, 0xd1, 0xd3, 0xd3, 0xd3, 0xd7, 0xdd, 0xd3, 0xd8, 0xff, 0x61, 0x48, 0x35, 0x24, 0x59, 0x65, 0xdd, 0xde, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe4, 0xef, 0x62, 0x51, 0x26, 0x2b, 0x2b, 0x23, 0x34, 0x40, 0x50, 0x4d, 0x48, 0x5e, 0xfe, 0xfd, 0xdd, 0xe1, 0xdd, 0xe4, 0xd3, 0xcd, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcd, 0xe1, 0xe3, 0xe1, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xe3, 0xe0, 0xe1, 0xe1, 0xef, 0x62, 0x53, 0x3d, 0x34, 0x40, 0x34, 0x40, 0x39, 0x39, 0x41, 0x39, 0x37, 0x3f, 0x34, 0x39, 0x34, 0x3d, 0x21, 0x09, 0x04, 0x8e, 0x9c, 0xa2, 0xc9, 0xc0, 0xac, 0xaa, 0xc1, 0xdb, 0xcd, 0xcf, 0xd3, 0xcf, 0xcd, 0xcd, 0xca, 0xcd, 0xcd, 0xcd, 0xc5, 0xb6, 0xac, 0xc3, 0xbb, 0xaa, 0xb6, 0xcd, 0xcd, 0xca, 0xca, 0xcd, 0xca, 0xca, 0xcd, 0xca, 0xca, 0xca, 0xcf, 0xc3, 0xac, 0xae, 0xbd, 0xc3, 0xc0, 0xab, 0x9a, 0x96, 0x9a, 0x98, 0x97, 0x99, 0xf1, 0xf7, 0xf1, 0x98, 0x93, 0x93, 0xf1, 0x03, 0x0c, 0x4c, 0x37, 0x42, 0x38, 0x41, 0x38, 0x38, 0x3c, 0x42, 0x49, 0x38, 0x39, 0x50, 0x34, 0x40, 0x39, 0x34, 0x3b, 0x38, 0x38, 0x3b, 0x37, 0x3b, 0x38, 0x42, 0x3c, 0x42, 0x42, 0x41, 0x41, 0x36, 0x2e, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x31, 0x52, 0x26, 0x07, 0x02, 0xf1, 0x98, 0x98, 0x99, 0x97, 0x98, 0x97, 0x98, 0x97, 0x98, 0x97, 0x96, 0x94, 0xc2, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xeb, 0xdd, 0xcc, 0xd3, 0xd3, 0xd7, 0xd7, 0xdb, 0xdd, 0xcf, 0xee, 0x64, 0x61, 0x35, 0x32, 0x26, 0x59, 0x65, 0xdd, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xe4, 0xff, 0x61, 0x45, 0x24, 0x24, 0x2b, 0x23, 0x40, 0x47, 0x50, 0x4d, 0x48, 0x5d, 0xfe, 0xe2, 0xe4, 0xdd, 0xe1, 0xe4, 0xd7, 0xcd, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xd2, 0xe1, 0xe5, 0xe3, 0xe3, 0xe1, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xe3, 0xe3, 0xe3, 0xe3, 0xde, 0xe2, 0xef, 0x61, 0x4e, 0x32, 0x3e, 0x39, 0x39, 0x39, 0x39, 0x41, 0x39, 0x39, 0x3f, 0x34, 0x39, 0x37, 0x39, 0x3d, 0x21, 0x09, 0x05, 0x8e, 0x9c, 0xa2, 0xc9, 0xc0, 0xaa, 0xa7, 0xb1, 0xbb, 0xb8, 0xb8, 0xbc, 0xb7, 0xbc, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xb2, 0xac, 0xc7, 0xbd, 0xac, 0xb1, 0xc5, 0xc7, 0xca, 0xca, 0xca, 0xc7, 0xca, 0xcc, 0xca, 0xca, 0xd3, 0xd3, 0xc5, 0xaa, 0xb2, 0xbd, 0xc3, 0xc0, 0xab, 0x9a, 0x96, 0x98, 0x98, 0x99, 0xf1, 0xf7, 0xf1, 0xf7, 0x99, 0x98, 0x9b, 0x95, 0x03, 0x06, 0x26, 0x4d, 0x31, 0x41, 0x37, 0x31, 0x3c, 0x42, 0x3b, 0x2e, 0x46, 0x4c, 0x35, 0x0e, 0x1e, 0x40, 0x3b, 0x38, 0x3c, 0x38, 0x38, 0x3b, 0x3b, 0x38, 0x38, 0x38, 0x42, 0x37, 0x1e, 0x1a, 0x2f, 0x4c, 0x37, 0x38, 0x38, 0x3c, 0x3c, 0x42, 0x38, 0x31, 0x48, 0x0f, 0x04, 0x02, 0x99, 0x99, 0x97, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x97, 0x99, 0x96, 0x94, 0xc2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0xed, 0xec, 0xdd, 0xcc, 0xd7, 0xd3, 0xd3, 0xd7, 0xdb, 0xdd, 0xcf, 0xe2, 0x64, 0x5f, 0x2f, 0x32, 0x2a, 0x5f, 0x65, 0xdb, 0xe3, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xe6, 0xff, 0x60, 0x45, 0x2a, 0x23, 0x2b, 0x24, 0x39, 0x50, 0x47, 0x4d, 0x48, 0x5d, 0xfe, 0xe2, 0xdd, 0xe1, 0xe4, 0xe4, 0xdb, 0xca, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd7, 0xe1, 0xe5, 0xde, 0xe5, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe1, 0xe3, 0xde, 0xe3, 0xe3, 0xe3, 0xdf, 0xde, 0xde, 0xe6, 0x63, 0x61, 0x48, 0x36, 0x47, 0x3b, 0x39, 0x39, 0x41, 0x39, 0x39, 0x40, 0x34, 0x3f, 0x34, 0x39, 0x34, 0x3d, 0x21, 0x09, 0x05, 0x9c, 0x9c, 0xa6, 0xc9, 0xc0, 0xac, 0xaa, 0xa7, 0xa4, 0xa7, 0xa9, 0xa4, 0xa4, 0xa9, 0xa4, 0xa4, 0xa4, 0xa7, 0xac, 0xaa, 0xa7, 0xab, 0xc7, 0xbe, 0xac, 0xa4, 0xae, 0xac, 0xac, 0xaa, 0xac, 0xac, 0xac, 0xae, 0xae, 0xac, 0xaf, 0xb4, 0xb1, 0xaa, 0xae, 0xbd, 0xc3, 0xc0, 0xab, 0x9a, 0x98, 0x9a, 0x98, 0x99, 0xf1, 0x97, 0xf7, 0xf1, 0x99, 0x99, 0x99, 0x98, 0xf1, 0x02, 0x0f, 0x56, 0x2e, 0x41, 0x31, 0x3c, 0x42, 0x3b, 0x34, 0x3d, 0x48, 0x21, 0x09, 0x06, 0x1a, 0x46, 0x3b, 0x3c, 0x42, 0x3c, 0x38, 0x3b, 0x38, 0x3c, 0x38, 0x38, 0x41, 0x40, 0x12, 0x07, 0x0c, 0x2c, 0x3d, 0x46, 0x40, 0x3b, 0x38, 0x42, 0x41, 0x4d, 0x21, 0x04, 0x02, 0x99, 0xf1, 0x99, 0x99, 0x99, 0x97, 0x98, 0x97, 0x98, 0x97, 0x98, 0x97, 0x96, 0x94, 0xc2, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xdd, 0xd1, 0xd3, 0xd7, 0xd7, 0xd7, 0xdb, 0xdd, 0xcf, 0xe2, 0x64, 0x5e, 0x2f, 0x2b, 0x2a, 0x5f, 0x65, 0xd7, 0xe3, 0xde, 0xdc, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe3, 0xdf, 0xdf, 0xe0, 0xe3, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xe6, 0xff, 0x60, 0x2c, 0x2a, 0x23, 0x2b, 0x24, 0x47, 0x49, 0x50, 0x4d, 0x51, 0x5f, 0xfd, 0xe2, 0xe1, 0xe4, 0xe1, 0xdd, 0xdb, 0xca, 0xcf, 0xcf, 0xcf, 0xd3, 0xcd, 0xd3, 0xcd, 0xdb, 0xe5, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe1, 0xe3, 0xe1, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe5, 0xdf, 0xde, 0xdf, 0xe5, 0xec, 0x63, 0x59, 0x35, 0x39, 0x3e, 0x3b, 0x39, 0x39, 0x39, 0x41, 0x39, 0x39, 0x36, 0x39, 0x34, 0x37, 0x39, 0x3d, 0x26, 0x09, 0x05, 0x8e, 0x9c, 0xa2, 0xcc, 0xc0, 0xaa, 0xaa, 0xa7, 0xa5, 0xaa, 0xa7, 0xac, 0xac, 0xaa, 0xac, 0xac, 0xa7, 0xa7, 0xa7, 0xa5, 0xac, 0xb2, 0xc7, 0xc1, 0xb6, 0xaa, 0xa9, 0xa7, 0xac, 0xac, 0xac, 0xab, 0xac, 0xae, 0xac, 0xae, 0xac, 0xa7, 0xb1, 0xb0, 0xb6, 0xbd, 0xc2, 0xc0, 0xad, 0x9a, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x93, 0x98, 0x99, 0x99, 0x97, 0x97, 0x97, 0xf7, 0x04, 0x26, 0x35, 0x37, 0x3b, 0x3c, 0x31, 0x37, 0x36, 0x48, 0x13, 0x06, 0x02, 0x04, 0x2f, 0x46, 0x3c, 0x42, 0x3c, 0x3c, 0x38, 0x38, 0x3b, 0x38, 0x3c, 0x49, 0x2e, 0x3d, 0x21, 0x06, 0x02, 0x09, 0x17, 0x2f, 0x35, 0x3e, 0x38, 0x38, 0x3b, 0x48, 0x0c, 0xf6, 0x98, 0x9a, 0x99, 0xf7, 0x99, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x97, 0x99, 0x96, 0x94, 0xc2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0xec, 0xdd, 0xd1, 0xd3, 0xd7, 0xd3, 0xd7, 0xdb, 0xe2, 0xcd, 0xfd, 0x64, 0x5e, 0x2a, 0x32, 0x2a, 0x61, 0xf5, 0xd3, 0xe3, 0xdc, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe3, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xe3, 0xe3, 0xe0, 0xdf, 0xe0, 0xdf, 0xe3, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe1, 0xe6, 0xff, 0x5d, 0x2c, 0x2a, 0x28, 0x2b, 0x23, 0x49, 0x50, 0x47, 0x4d, 0x53, 0x5f, 0xfd, 0xe2, 0xdd, 0xe1, 0xe4, 0xdd, 0xdb, 0xcd, 0xcd, 0xd3, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xdb, 0xe5, 0xe5, 0xe1, 0xe5, 0xe1, 0xe3, 0xe1, 0xe3, 0xe1, 0xe3, 0xe1, 0xe1, 0xde, 0xe1, 0xe1, 0xe1, 0xde, 0xe5, 0xea, 0x65, 0x60, 0x51, 0x35, 0x3e, 0x3b, 0x3b, 0x3e, 0x39, 0x41, 0x39, 0x39, 0x40, 0x34, 0x3f, 0x34, 0x39, 0x34, 0x46, 0x22, 0x09, 0x05, 0x8e, 0x9c, 0xa6, 0xc9, 0xc0, 0xa7, 0xa7, 0xaa, 0xae, 0xac, 0xa4, 0xac, 0xa9, 0xa4, 0xa9, 0xaa, 0xa9, 0xa7, 0xa7, 0xa7, 0xaa, 0xa6, 0xb8, 0xae, 0xae, 0xac, 0xb1, 0xae, 0xac, 0xac, 0xa7, 0xa4, 0xa4, 0xa5, 0xa4, 0xa9, 0xac, 0xa9, 0xac, 0xae, 0xb4, 0xc0, 0xc3, 0xc0, 0xae, 0x9a, 0x96, 0x9a, 0x98, 0x98, 0x93, 0x93, 0x93, 0x98, 0x98, 0x99, 0x9a, 0x95, 0x9b, 0xf1, 0x02, 0x0c, 0x5a, 0x23, 0x3c, 0x3c, 0x2e, 0x52, 0x48, 0x0e, 0x04, 0x02, 0x04, 0x04, 0x21, 0x36, 0x38, 0x42, 0x42, 0x42, 0x3c, 0x38, 0x3b, 0x38, 0x38, 0x37, 0x47, 0x35, 0x11, 0x06, 0x03, 0x02, 0x02, 0x0c, 0x2c, 0x4c, 0x47, 0x31, 0x46, 0x21, 0x02, 0x97, 0x93, 0x93, 0x99, 0xf7, 0xf1, 0x98, 0x97, 0x98, 0x97, 0x98, 0x97, 0x98, 0x97, 0x96, 0x94, 0xc2, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xff, 0x01, 0xed, 0x90, 0xec, 0xdd, 0xcc, 0xd1, 0xd7, 0xd7, 0xd7, 0xdd, 0xdb, 0xcc, 0xfd, 0x62, 0x5a, 0x32, 0x28, 0x2f, 0x61, 0xef, 0xe1, 0xd9, 0xe3, 0xdf, 0xdf, 0xe3, 0xdc, 0xe0, 0xdc, 0xe0, 0xe0, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xe0, 0xdf, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xe0, 0xde, 0xde, 0xde, 0xde, 0xe3, 0xde, 0xe3, 0xe3, 0xdf, 0xdf, 0xdc, 0xdf, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xd9, 0xdd, 0xf0, 0x63, 0x54, 0x26, 0x24, 0x34, 0x28, 0x2e, 0x49, 0x50, 0x47, 0x35, 0x53, 0x60, 0xfd, 0xe4, 0xdd, 0xe1, 0xe4, 0xe4, 0xdb, 0xca, 0xcf, 0xcd, 0xcd, 0xd3, 0xcf, 0xd7, 0xd7, 0xdd, 0xe6, 0xe4, 0xdd, 0xe4, 0xdd, 0xe4, 0xe1, 0xe4, 0xe4, 0xe4, 0xe1, 0xe4, 0xe4, 0xe4, 0xe2, 0xfd, 0xf0, 0x64, 0x64, 0x5f, 0x5a, 0x32, 0x36, 0x41, 0x37, 0x41, 0x39, 0x3e, 0x34, 0x3e, 0x39, 0x3b, 0x3b, 0x39, 0x3e, 0x37, 0x39, 0x3d, 0x26, 0x09, 0xf7, 0x8e, 0x9c, 0xa2, 0xcc, 0xbe, 0xaa, 0xae, 0xa1, 0xa9, 0xa4, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xb1, 0xaf, 0xb2, 0xb4, 0xb2, 0xb1, 0xb4, 0xb3, 0xaf, 0xac, 0xaf, 0xac, 0xa4, 0xb1, 0xbf, 0xbc, 0xaf, 0xb7, 0xa8, 0xa4, 0xa8, 0xb1, 0xae, 0xb1, 0xbd, 0xc3, 0xc0, 0xb0, 0x9b, 0x96, 0x98, 0x98, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x96, 0xf7, 0x03, 0x04, 0x18, 0x56, 0x2e, 0x31, 0x4c, 0x2c, 0x07, 0x03, 0x95, 0x97, 0x97, 0x03, 0x21, 0x46, 0x3b, 0x42, 0x3c, 0x38, 0x38, 0x37, 0x3b, 0x3b, 0x3c, 0x3c, 0x39, 0x3d, 0x17, 0x06, 0x95, 0xf1, 0x02, 0x02, 0x04, 0x0f, 0x59, 0x59, 0x33, 0x06, 0x04, 0x95, 0x99, 0x9a, 0x97, 0xf1, 0x98, 0x99, 0x98, 0x99, 0x98, 0x98, 0x9a, 0x98, 0x99, 0x96, 0x94, 0xc4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0xed, 0x01, 0xed, 0x90, 0x90, 0xe2, 0xd8, 0xd7, 0xee, 0xdb, 0xd7, 0xdb, 0xe4, 0xd7, 0xfd, 0x62, 0x56, 0x2b, 0x32, 0x2c, 0x62, 0xef, 0xd9, 0xde, 0xe3, 0xde, 0xdb, 0xde, 0xe3, 0xdf, 0xde, 0xde, 0xd9, 0xde, 0xd9, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xdd, 0xdb, 0xdd, 0xe1, 0xdd, 0xe1, 0xe4, 0xe1, 0xdd, 0xe1, 0xdd, 0xe1, 0xdd, 0xe1, 0xe4, 0xe1, 0xe4, 0xe1, 0xdd, 0xe1, 0xdd, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xde, 0xe5, 0xe3, 0xe1, 0xe3, 0xe1, 0xde, 0xe4, 0xe7, 0x63, 0x61, 0x45, 0x2a, 0x32, 0x28, 0x31, 0x2e, 0x41, 0x47, 0x3d, 0x48, 0x53, 0xfe, 0xf4, 0xe2, 0xe1, 0xe4, 0xe1, 0xe2, 0xdb, 0xd3, 0xd3, 0xcd, 0xcf, 0xd7, 0xdb, 0xdd, 0xdb, 0xf4, 0xef, 0xfe, 0xff, 0xff, 0x65, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x64, 0x64, 0x63, 0x63, 0x62, 0x61, 0x4e, 0x32, 0x32, 0x40, 0x41, 0x41, 0x41, 0x39, 0x37, 0x3f, 0x39, 0x3e, 0x3b, 0x3b, 0x37, 0x39, 0x39, 0x34, 0x4d, 0x22, 0x09, 0x04, 0x8e, 0x9c, 0xa6, 0xd1, 0xbd, 0xac, 0xa1, 0xa8, 0xca, 0xd9, 0xdf, 0xe0, 0xda, 0xda, 0xd0, 0xbf, 0xbf, 0xbf, 0xbd, 0xb9, 0xb0, 0xb2, 0xb6, 0xb8, 0xaf, 0xac, 0xaf, 0xaf, 0xb7, 0xd9, 0xe8, 0xe8, 0xe8, 0xea, 0xe5, 0xd9, 0xbf, 0xac, 0xaf, 0xb3, 0xb8, 0xbd, 0xc3, 0xc3, 0xad, 0x9b, 0x96, 0x9a, 0x98, 0x99, 0x99, 0x99, 0x97, 0x99, 0x98, 0x98, 0x93, 0x98, 0x97, 0xf1, 0xf7, 0x03, 0x0d, 0x2c, 0x35, 0x4e, 0x21, 0x07, 0x04, 0x95, 0x95, 0x93, 0x97, 0x03, 0x21, 0x46, 0x3c, 0x3c, 0x42, 0x3c, 0x38, 0x37, 0x3b, 0x3c, 0x3c, 0x42, 0x41, 0x3d, 0x17, 0x06, 0x95, 0x93, 0x98, 0xf1, 0x02, 0x04, 0x0c, 0x18, 0x27, 0x03, 0x02, 0xf1, 0x99, 0x97, 0x97, 0x98, 0x99, 0x97, 0x98, 0x97, 0x98, 0x98, 0x96, 0x9a, 0x98, 0x96, 0x94, 0xc4, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x65, 0x01, 0x01, 0x90, 0xed, 0xe9, 0xd7, 0xd7, 0xd7, 0xdd, 0xd7, 0xd7, 0xdb, 0xdb, 0xe7, 0x61, 0x45, 0x2a, 0x2a, 0x2c, 0x62, 0xf0, 0xdb, 0xd3, 0xde, 0xe1, 0xe4, 0xe1, 0xdd, 0xe4, 0xe4, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x63, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xe9, 0xef, 0xef, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe2, 0xe2, 0xe2, 0xe2, 0xf4, 0xff, 0x63, 0x5e, 0x2f, 0x2a, 0x34, 0x2e, 0x28, 0x28, 0x47, 0x32, 0x4d, 0x3a, 0x54, 0x60, 0xfd, 0xe4, 0xe1, 0xe1, 0xe1, 0xe1, 0xd8, 0xd1, 0xd7, 0xd7, 0xdb, 0xe4, 0xe6, 0xf4, 0xfc, 0x57, 0x5d, 0x59, 0x5d, 0x5d, 0x5d, 0x5d, 0x5f, 0x5d, 0x5f, 0x5d, 0x5d, 0x5d, 0x59, 0x54, 0x59, 0x59, 0x53, 0x45, 0x2f, 0x2f, 0x3d, 0x40, 0x47, 0x41, 0x31, 0x41, 0x3e, 0x39, 0x34, 0x3f, 0x34, 0x3e, 0x3e, 0x39, 0x3e, 0x37, 0x39, 0x3d, 0x26, 0x09, 0x05, 0x8e, 0x9c, 0xa6, 0xcc, 0xbd, 0xaa, 0xa9, 0xac, 0xd9, 0xd2, 0xc6, 0xc6, 0xc8, 0xce, 0xd6, 0xc6, 0xb7, 0xbc, 0xba, 0xf3, 0xfa, 0xba, 0xfa, 0xb3, 0xb0, 0xaf, 0xaf, 0xb1, 0xc5, 0xe5, 0xe3, 0xd4, 0xd4, 0xdc, 0xd4, 0xe3, 0xe3, 0xd2, 0xbc, 0xae, 0xb6, 0xbd, 0xc3, 0xc0, 0xae, 0x9a, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x99, 0x98, 0x9a, 0x96, 0x98, 0x98, 0xf1, 0xf7, 0x02, 0x06, 0x18, 0x45, 0x0f, 0x06, 0x02, 0x02, 0x97, 0x99, 0x96, 0xf7, 0x03, 0x21, 0x40, 0x3c, 0x42, 0x3c, 0x38, 0x38, 0x38, 0x3c, 0x42, 0x42, 0x42, 0x38, 0x46, 0x17, 0x06, 0x02, 0x97, 0x97, 0xf7, 0xf7, 0x02, 0x03, 0x07, 0x0a, 0x02, 0x02, 0x99, 0x99, 0x96, 0x96, 0x9a, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x96, 0x94, 0xc4, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0x01, 0x90, 0xed, 0x01, 0xeb, 0xe2, 0xd1, 0xd7, 0xdb, 0xd7, 0xdb, 0xdb, 0xdd, 0xe7, 0x62, 0x3a, 0x2a, 0x2a, 0x3a, 0x61, 0xff, 0xfd, 0xe6, 0xe7, 0xef, 0xef, 0xfe, 0xff, 0x63, 0xff, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x61, 0x61, 0x61, 0x62, 0x61, 0x62, 0x62, 0x62, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x63, 0x64, 0x63, 0x64, 0x63, 0x63, 0x62, 0x5f, 0x45, 0x2a, 0x24, 0x2e, 0x2e, 0x2e, 0x2b, 0x4d, 0x46, 0x35, 0x3a, 0x54, 0x60, 0xf4, 0xe4, 0xe1, 0xe1, 0xe1, 0xdd, 0xdb, 0xfb, 0xe2, 0xe4, 0xe5, 0xe6, 0xe6, 0xf4, 0x57, 0x45, 0x53, 0x48, 0x3a, 0x3a, 0x2f, 0x2f, 0x35, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3a, 0x2f, 0x2f, 0x2a, 0x2f, 0x2a, 0x35, 0x3d, 0x46, 0x40, 0x39, 0x37, 0x37, 0x50, 0x37, 0x40, 0x39, 0x36, 0x39, 0x39, 0x39, 0x39, 0x3e, 0x39, 0x39, 0x3d, 0x2c, 0x09, 0x05, 0x8e, 0x9c, 0xa6, 0xd1, 0xbd, 0xaa, 0xa1, 0xaf, 0xd2, 0xc6, 0xbf, 0xc6, 0xce, 0xc6, 0xc8, 0xc6, 0xb7, 0xbe, 0xc2, 0xfb, 0xfb, 0x2d, 0xf3, 0xfa, 0xb0, 0xb1, 0xac, 0xbc, 0xde, 0xde, 0xde, 0xdc, 0xdc, 0xdc, 0xdc, 0xd2, 0xe5, 0xe5, 0xbc, 0xac, 0xb6, 0xbe, 0xc4, 0xc0, 0xb0, 0x9b, 0x96, 0x9a, 0x98, 0x98, 0x98, 0x97, 0x9a, 0x97, 0x99, 0x98, 0x96, 0x9a, 0x98, 0xf1, 0xf1, 0xf1, 0x03, 0xf9, 0x0d, 0x03, 0x02, 0xf1, 0xf1, 0x99, 0x97, 0xf1, 0xf7, 0x03, 0x26, 0x40, 0x38, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x3c, 0x42, 0x42, 0x42, 0x41, 0x40, 0x21, 0x07, 0x02, 0x96, 0x98, 0x99, 0xf1, 0x04, 0x04, 0x02, 0x02, 0xf7, 0x99, 0x9a, 0x9a, 0x98, 0x96, 0x9a, 0x98, 0x97, 0x98, 0x97, 0x98, 0x98, 0x98, 0x9a, 0x98, 0x96, 0x94, 0xc4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xea, 0xe6, 0xd7, 0xd7, 0xd7, 0xdb, 0xdd, 0xdd, 0xfe, 0x61, 0x3a, 0x2a, 0x24, 0x3a, 0x61, 0x62, 0x63, 0x64, 0x63, 0xfe, 0x60, 0x5f, 0x5f, 0x5e, 0x59, 0x59, 0x53, 0x53, 0x51, 0x48, 0x51, 0x3d, 0x48, 0x35, 0x35, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x26, 0x2f, 0x26, 0x2f, 0x26, 0x2f, 0x26, 0x2f, 0x2f, 0x2f, 0x2f, 0x3a, 0x2f, 0x3a, 0x3a, 0x3a, 0x3a, 0x48, 0x51, 0x48, 0x53, 0x53, 0x5a, 0x59, 0x5e, 0x5d, 0x59, 0x5d, 0x59, 0x5d, 0x59, 0x53, 0x3a, 0x2a, 0x32, 0x2b, 0x28, 0x31, 0x2e, 0x34, 0x4d, 0x40, 0x32, 0x48, 0x5e, 0x60, 0xf4, 0xe2, 0xe1, 0xdd, 0xe1, 0xe4, 0xe2, 0xfd, 0xe6, 0xe6, 0xe5, 0xe6, 0xe2, 0x57, 0x54, 0x48, 0x56, 0x4d, 0x4d, 0x4d, 0x3d, 0x50, 0x4d, 0x47, 0x4d, 0x4d, 0x4d, 0x46, 0x36, 0x36, 0x40, 0x36, 0x47, 0x40, 0x40, 0x40, 0x36, 0x34, 0x39, 0x41, 0x41, 0x41, 0x39, 0x39, 0x36, 0x39, 0x36, 0x39, 0x39, 0x39, 0x39, 0x3e, 0x39, 0x4c, 0x26, 0x09, 0x05, 0x8e, 0x9c, 0xaa, 0xd1, 0xbd, 0xaa, 0xa4, 0xaf, 0xd9, 0xc6, 0xc6, 0xce, 0xd6, 0xce, 0xce, 0xc6, 0xbb, 0xc4, 0xfb, 0x44, 0x2d, 0x44, 0xfb, 0x1b, 0xb9, 0xab, 0xaf, 0xbf, 0xdc, 0xd9, 0xd4, 0xdc, 0xdc, 0xd9, 0xd4, 0xdc, 0xde, 0xd9, 0xbc, 0xb1, 0xbb, 0xbd, 0xc3, 0xc0, 0xb0, 0x9a, 0x97, 0x98, 0x98, 0x93, 0x93, 0x98, 0x98, 0x99, 0x99, 0x99, 0x9a, 0x99, 0x98, 0x97, 0x99, 0xf1, 0xf1, 0xf1, 0x95, 0xf1, 0xf7, 0x96, 0x96, 0x96, 0x97, 0xf1, 0x02, 0x04, 0x21, 0x40, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x3c, 0x3c, 0x42, 0x42, 0x3c, 0x4d, 0x21, 0x06, 0x02, 0x99, 0x98, 0x96, 0x95, 0xf1, 0xf7, 0x04, 0xf1, 0xf1, 0x98, 0x93, 0x93, 0x93, 0x98, 0x98, 0x99, 0x97, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x94, 0xc4, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xea, 0xe4, 0xdd, 0xdb, 0xd7, 0xd8, 0xee, 0xfe, 0x5e, 0x2f, 0x28, 0x2b, 0x32, 0x5a, 0x5e, 0x59, 0x54, 0x45, 0x45, 0x2c, 0x3a, 0x2a, 0x2f, 0x2a, 0x2a, 0x2a, 0x24, 0x24, 0x24, 0x23, 0x28, 0x23, 0x28, 0x28, 0x28, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x2b, 0x28, 0x2b, 0x2b, 0x28, 0x2b, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x26, 0x24, 0x24, 0x32, 0x31, 0x28, 0x2e, 0x31, 0x34, 0x49, 0x34, 0x34, 0x48, 0x5a, 0x60, 0x5b, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe6, 0xe6, 0xe4, 0xe4, 0xe6, 0xfd, 0x5b, 0x53, 0x4e, 0x52, 0x47, 0x47, 0x47, 0x40, 0x47, 0x41, 0x47, 0x41, 0x39, 0x39, 0x39, 0x39, 0x40, 0x3e, 0x47, 0x3e, 0x39, 0x39, 0x39, 0x39, 0x47, 0x41, 0x41, 0x37, 0x37, 0x39, 0x3e, 0x39, 0x36, 0x39, 0x39, 0x3e, 0x36, 0x3e, 0x3e, 0x39, 0x3d, 0x2c, 0x09, 0x05, 0x8e, 0x9c, 0xa7, 0xd1, 0xbd, 0xa7, 0xa8, 0xaf, 0xd9, 0xce, 0xc6, 0xce, 0xd6, 0xce, 0xd6, 0xc5, 0xbe, 0xfb, 0xfc, 0x44, 0x33, 0x44, 0xfc, 0xfc, 0xf3, 0xb0, 0xaf, 0xc5, 0xe3, 0xe0, 0xd9, 0xd4, 0xd4, 0xd4, 0xd4, 0xde, 0xd9, 0xe1, 0xbc, 0xb1, 0xb9, 0xbd, 0xc4, 0xc0, 0xb0, 0x9b, 0x96, 0x9a, 0x93, 0x93, 0x93, 0x98, 0x97, 0x99, 0x99, 0x99, 0x99, 0x98, 0x96, 0x98, 0x97, 0x99, 0x97, 0x95, 0x96, 0xf7, 0xf1, 0x93, 0x96, 0x9a, 0x97, 0xf1, 0xf1, 0x03, 0x21, 0x3d, 0x34, 0x37, 0x3b, 0x37, 0x3b, 0x37, 0x3c, 0x42, 0x42, 0x3c, 0x41, 0x3d, 0x21, 0x07, 0x02, 0x96, 0x93, 0x93, 0x97, 0xf1, 0xf1, 0x97, 0x99, 0x93, 0x93, 0x93, 0x93, 0x9a, 0x98, 0x99, 0x97, 0x99, 0x98, 0x97, 0x98, 0x98, 0x98, 0x98, 0x99, 0x96, 0x94, 0xc4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xf5, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0xed, 0xed, 0xec, 0xe7, 0xe6, 0xdd, 0xd8, 0x5b, 0x61, 0x48, 0x24, 0x31, 0x2e, 0x2e, 0x2a, 0x2a, 0x2a, 0x24, 0x24, 0x24, 0x24, 0x24, 0x28, 0x28, 0x2b, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x24, 0x2b, 0x2a, 0x2b, 0x2b, 0x24, 0x2b, 0x2b, 0x2e, 0x28, 0x2e, 0x2e, 0x31, 0x31, 0x31, 0x41, 0x41, 0x47, 0x4d, 0x3a, 0x59, 0x5b, 0xf4, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe4, 0xe6, 0xe4, 0xe6, 0xfd, 0x5b, 0x59, 0x48, 0x48, 0x50, 0x47, 0x47, 0x47, 0x40, 0x3e, 0x47, 0x3e, 0x3e, 0x40, 0x3e, 0x39, 0x39, 0x39, 0x41, 0x39, 0x3b, 0x37, 0x3b, 0x37, 0x41, 0x41, 0x3b, 0x37, 0x41, 0x41, 0x3e, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x40, 0x39, 0x40, 0x46, 0x2c, 0x09, 0x05, 0x8e, 0x9c, 0xf8, 0xd1, 0xbd, 0xa7, 0xa4, 0xaf, 0xda, 0xd6, 0xce, 0xce, 0xd6, 0xce, 0xd6, 0xc6, 0xc2, 0xee, 0x44, 0x27, 0x33, 0x33, 0x33, 0xfc, 0x20, 0xb9, 0xae, 0xbf, 0xe3, 0xdc, 0xd4, 0xd5, 0xd4, 0xce, 0xd2, 0xdf, 0xd9, 0xe1, 0xbc, 0xb1, 0xb9, 0xbe, 0xc3, 0xc0, 0xb0, 0x9a, 0x97, 0x98, 0x98, 0x93, 0x93, 0x93, 0x99, 0x99, 0xf1, 0x99, 0x99, 0x96, 0x96, 0x98, 0x98, 0x98, 0x99, 0x98, 0x98, 0x99, 0x97, 0x96, 0x93, 0x98, 0x96, 0x96, 0xf1, 0x03, 0x21, 0x3d, 0x34, 0x37, 0x3b, 0x31, 0x3b, 0x37, 0x3c, 0x3c, 0x3c, 0x3c, 0x39, 0x3d, 0x22, 0x06, 0xf1, 0x97, 0x96, 0x96, 0x98, 0x99, 0x97, 0x97, 0x96, 0x93, 0x93, 0x93, 0x93, 0x98, 0x98, 0x97, 0x97, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x96, 0x94, 0xc4, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0x5b, 0x61, 0x53, 0x2a, 0x23, 0x31, 0x31, 0x2e, 0x28, 0x28, 0x28, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x28, 0x2e, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x31, 0x41, 0x41, 0x47, 0x32, 0x2c, 0x33, 0xfc, 0xfd, 0xe6, 0xe4, 0xe7, 0xe6, 0xe4, 0xe6, 0xe4, 0xfd, 0x5b, 0x5d, 0x54, 0x51, 0x48, 0x4d, 0x4d, 0x47, 0x3e, 0x47, 0x40, 0x36, 0x40, 0x36, 0x39, 0x34, 0x39, 0x34, 0x39, 0x39, 0x39, 0x39, 0x3e, 0x39, 0x39, 0x37, 0x3b, 0x37, 0x41, 0x37, 0x37, 0x39, 0x37, 0x41, 0x47, 0x3e, 0x39, 0x3e, 0x39, 0x36, 0x3e, 0x3e, 0x39, 0x3d, 0x2f, 0x09, 0x05, 0x8e, 0x9c, 0xaa, 0xd1, 0xbd, 0xa9, 0xa1, 0xb7, 0xd9, 0xd6, 0xce, 0xda, 0xce, 0xce, 0xd6, 0xc5, 0xc4, 0xfc, 0x44, 0x45, 0x22, 0x33, 0x33, 0x2d, 0xfb, 0xb9, 0xaf, 0xbf, 0xe0, 0xdc, 0xdc, 0xdc, 0xdc, 0xd4, 0xd4, 0xe3, 0xde, 0xd2, 0xbc, 0xb3, 0xb9, 0xbe, 0xc4, 0xc3, 0xb0, 0x9b, 0x98, 0x98, 0x98, 0x93, 0x93, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x97, 0x93, 0x98, 0x93, 0x93, 0x98, 0x98, 0x97, 0xf1, 0xf1, 0x93, 0x93, 0x96, 0x93, 0x95, 0xf1, 0x03, 0x21, 0x46, 0x3f, 0x3b, 0x3c, 0x3b, 0x38, 0x3b, 0x38, 0x3c, 0x3c, 0x3c, 0x36, 0x3d, 0x22, 0x07, 0x02, 0xf1, 0x93, 0x96, 0x97, 0x98, 0x9a, 0x98, 0x98, 0x93, 0x93, 0x93, 0x98, 0x99, 0x99, 0x99, 0x99, 0x97, 0x98, 0x97, 0x98, 0x98, 0x98, 0x9a, 0x97, 0x96, 0x94, 0xc4, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0xed, 0xed, 0xed, 0x65, 0x65, 0x64, 0x62, 0x54, 0x2f, 0x24, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x28, 0x2e, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x28, 0x2e, 0x2b, 0x2e, 0x2b, 0x28, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x34, 0x28, 0x31, 0x41, 0x47, 0x47, 0x35, 0x3a, 0x44, 0xfc, 0xe2, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xfd, 0x60, 0x5d, 0x53, 0x48, 0x3d, 0x4d, 0x46, 0x40, 0x40, 0x40, 0x3e, 0x3e, 0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x39, 0x39, 0x34, 0x37, 0x34, 0x39, 0x37, 0x3b, 0x37, 0x3e, 0x37, 0x39, 0x3e, 0x3e, 0x37, 0x47, 0x41, 0x41, 0x37, 0x41, 0x39, 0x39, 0x40, 0x39, 0x40, 0x3d, 0x2c, 0x0c, 0x04, 0x8e, 0x9c, 0xf8, 0xd3, 0xbd, 0xaa, 0xa4, 0xaf, 0xda, 0xd6, 0xce, 0xce, 0xce, 0xda, 0xce, 0xca, 0xc9, 0xfc, 0x44, 0x45, 0x22, 0x2c, 0x44, 0x27, 0xfb, 0xb5, 0xb2, 0xb7, 0xdc, 0xdf, 0xdc, 0xdc, 0xdf, 0xe3, 0xdf, 0xd9, 0xe5, 0xd2, 0xb3, 0xb7, 0xbb, 0xbd, 0xc3, 0xc3, 0xad, 0x9b, 0x97, 0x98, 0x9a, 0x93, 0x93, 0x9a, 0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x93, 0x98, 0x93, 0x98, 0x98, 0x97, 0xf1, 0xf1, 0x93, 0x93, 0x93, 0x93, 0x95, 0x99, 0x03, 0x21, 0x46, 0x3b, 0x3c, 0x3c, 0x3c, 0x3b, 0x3c, 0x38, 0x3c, 0x3c, 0x3b, 0x36, 0x3d, 0x22, 0x07, 0x02, 0xf1, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x93, 0x93, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x97, 0x94, 0xc4, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0xed, 0x64, 0x64, 0x61, 0x4f, 0x2c, 0x24, 0x2b, 0x2e, 0x2e, 0x2e, 0x28, 0x28, 0x2e, 0x2e, 0x31, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2b, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x31, 0x2e, 0x34, 0x2e, 0x28, 0x2e, 0x47, 0x4d, 0x3d, 0x48, 0x54, 0x57, 0xf4, 0xe6, 0xe6, 0xe6, 0xe2, 0xfd, 0xfd, 0x5b, 0x5d, 0x59, 0x5a, 0x4d, 0x47, 0x47, 0x47, 0x40, 0x40, 0x39, 0x3e, 0x37, 0x39, 0x36, 0x32, 0x36, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x34, 0x39, 0x39, 0x40, 0x39, 0x34, 0x34, 0x34, 0x3f, 0x36, 0x36, 0x36, 0x34, 0x3e, 0x3b, 0x37, 0x3e, 0x41, 0x3e, 0x39, 0x40, 0x3e, 0x39, 0x46, 0x2f, 0x09, 0x05, 0x05, 0x9c, 0xaa, 0xd1, 0xbe, 0xa4, 0xa8, 0xaf, 0xd2, 0xe3, 0xce, 0xd6, 0xce, 0xd6, 0xd6, 0xc5, 0xc2, 0xfb, 0x44, 0x33, 0x17, 0x17, 0x33, 0x1b, 0xfb, 0xba, 0xb1, 0xb7, 0xc6, 0xe3, 0xe3, 0xdc, 0xdf, 0xe3, 0xd9, 0xdf, 0xde, 0xbf, 0xaf, 0xb6, 0xbb, 0xbe, 0xc3, 0xc3, 0xae, 0x9b, 0x98, 0x98, 0x93, 0x9a, 0x93, 0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x93, 0x98, 0x93, 0x98, 0x98, 0x98, 0x96, 0x99, 0x96, 0x93, 0x93, 0x93, 0x93, 0x98, 0xf1, 0x03, 0x21, 0x46, 0x37, 0x3b, 0x31, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x34, 0x32, 0x48, 0x22, 0x07, 0x02, 0xf1, 0xf1, 0x97, 0x99, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x99, 0x99, 0xf7, 0x99, 0x99, 0x97, 0x98, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x92, 0x20, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x65, 0x01, 0x01, 0xed, 0xed, 0x01, 0x65, 0x64, 0x62, 0x4f, 0x22, 0x1a, 0x2a, 0x2e, 0x28, 0x2e, 0x28, 0x2b, 0x2b, 0x28, 0x2e, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x32, 0x4d, 0x4c, 0x48, 0x51, 0x5e, 0x60, 0xfd, 0xfd, 0xe6, 0xfd, 0xfd, 0x60, 0x5d, 0x59, 0x53, 0x48, 0x3d, 0x47, 0x41, 0x41, 0x41, 0x39, 0x39, 0x39, 0x34, 0x3b, 0x37, 0x34, 0x34, 0x34, 0x34, 0x39, 0x34, 0x37, 0x39, 0x39, 0x39, 0x34, 0x36, 0x32, 0x36, 0x3f, 0x3f, 0x36, 0x3d, 0x32, 0x43, 0x32, 0x3f, 0x40, 0x47, 0x3b, 0x41, 0x3e, 0x3e, 0x39, 0x3f, 0x39, 0x40, 0x3d, 0x3a, 0x0c, 0x05, 0x8e, 0x9c, 0xf8, 0xd3, 0xbd, 0xaa, 0xa9, 0xa8, 0xc6, 0xe0, 0xd6, 0xd6, 0xd6, 0xda, 0xd2, 0xc1, 0xc2, 0xfc, 0x44, 0x33, 0x11, 0x10, 0x27, 0x2d, 0xfb, 0xb9, 0xb2, 0xaf, 0xb7, 0xd9, 0xe5, 0xe3, 0xe5, 0xe3, 0xe3, 0xe3, 0xbf, 0xaf, 0xaf, 0xbb, 0xbb, 0xbe, 0xc3, 0xc0, 0xb0, 0x9a, 0x98, 0x98, 0x9a, 0x93, 0x9a, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x98, 0x93, 0x98, 0x98, 0x98, 0x93, 0x93, 0x97, 0x97, 0x93, 0x93, 0x93, 0x93, 0x98, 0x94, 0x03, 0x2c, 0x56, 0x46, 0x4d, 0x46, 0x4d, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x3a, 0x51, 0x27, 0x0a, 0x03, 0xf1, 0xf1, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x97, 0x99, 0x97, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x97, 0x94, 0xc4, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x90, 0x90, 0xed, 0x65, 0x63, 0x5d, 0x2c, 0x26, 0x2b, 0x2b, 0x2e, 0x28, 0x28, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x31, 0x31, 0x2e, 0x28, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2b, 0x2e, 0x2b, 0x2e, 0x2b, 0x2e, 0x2b, 0x2e, 0x2b, 0x2e, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x28, 0x28, 0x2e, 0x36, 0x46, 0x4c, 0x4c, 0x4e, 0x53, 0x5d, 0x5d, 0xfd, 0x60, 0xfd, 0x60, 0x60, 0x5d, 0x53, 0x48, 0x35, 0x32, 0x39, 0x47, 0x41, 0x41, 0x41, 0x37, 0x39, 0x39, 0x37, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x37, 0x37, 0x37, 0x34, 0x34, 0x36, 0x36, 0x3d, 0x36, 0x43, 0x2a, 0x1d, 0x1a, 0x84, 0x15, 0x1a, 0x25, 0x24, 0x3f, 0x47, 0x40, 0x3e, 0x39, 0x39, 0x40, 0x40, 0x39, 0x40, 0x3d, 0x2f, 0x0c, 0x05, 0x05, 0x9c, 0xab, 0xd1, 0xbe, 0xa9, 0xa9, 0xa4, 0xb7, 0xc6, 0xd2, 0xe0, 0xda, 0xda, 0xd2, 0xb7, 0xb9, 0xfb, 0x44, 0x2d, 0x22, 0x27, 0x2d, 0x44, 0xc9, 0xf9, 0xaf, 0xb1, 0xaf, 0xbc, 0xc6, 0xd2, 0xd9, 0xd9, 0xd2, 0xc6, 0xb7, 0xaf, 0xb3, 0xbc, 0xb9, 0xbd, 0xc4, 0xc0, 0xad, 0x9b, 0x97, 0x98, 0x9a, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x98, 0x98, 0x93, 0x93, 0x93, 0x98, 0x97, 0x99, 0x93, 0x93, 0x98, 0x97, 0x93, 0x93, 0x98, 0x93, 0x98, 0x96, 0xf1, 0x13, 0x22, 0x21, 0x26, 0x17, 0x21, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x10, 0x08, 0x02, 0xf7, 0xf1, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x97, 0x98, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x92, 0x20, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0x01, 0x01, 0x65, 0x62, 0x45, 0x1a, 0x32, 0x28, 0x2e, 0x2e, 0x31, 0x31, 0x2b, 0x2b, 0x28, 0x2b, 0x31, 0x31, 0x31, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x34, 0x4d, 0x4c, 0x4c, 0x4c, 0x4e, 0x53, 0x59, 0x5d, 0x60, 0x60, 0x60, 0x59, 0x59, 0x35, 0x35, 0x39, 0x39, 0x39, 0x36, 0x40, 0x36, 0x34, 0x34, 0x39, 0x34, 0x34, 0x34, 0x34, 0x37, 0x31, 0x37, 0x37, 0x31, 0x37, 0x37, 0x34, 0x39, 0x36, 0x3f, 0x35, 0x1f, 0x1d, 0x84, 0x0e, 0x0e, 0x0e, 0x0b, 0x0e, 0x0b, 0x0e, 0x0e, 0x1c, 0x32, 0x3e, 0x39, 0x40, 0x40, 0x3f, 0x40, 0x40, 0x40, 0x46, 0x3a, 0x0c, 0x04, 0x8e, 0x8e, 0xf8, 0xd7, 0xbd, 0xa7, 0xa9, 0xa8, 0xa9, 0xaf, 0xb7, 0xbf, 0xbf, 0xbf, 0xaf, 0xaf, 0xb9, 0xfb, 0xfc, 0x44, 0x27, 0x44, 0x44, 0xfb, 0x20, 0xb9, 0xb0, 0xb7, 0xb7, 0xa9, 0xa9, 0xaf, 0xb7, 0xb3, 0xaf, 0xb7, 0xb7, 0xb7, 0xb7, 0xbb, 0xbb, 0xbd, 0xc3, 0xc0, 0xae, 0x9a, 0x98, 0x98, 0x9a, 0x98, 0x9a, 0x99, 0x99, 0x99, 0x98, 0x98, 0x93, 0x93, 0x93, 0x93, 0x98, 0x99, 0x99, 0x98, 0x93, 0x99, 0xf1, 0x99, 0x99, 0x99, 0x96, 0x93, 0x93, 0x95, 0x05, 0x06, 0x04, 0x06, 0x06, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 0x95, 0xf1, 0x96, 0x99, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x99, 0x97, 0x99, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x97, 0x94, 0xc4, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x65, 0x01, 0x01, 0xed, 0xed, 0x01, 0x64, 0x60, 0x3a, 0x1a, 0x28, 0x31, 0x2e, 0x31, 0x31, 0x31, 0x2e, 0x28, 0x2b, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x39, 0x50, 0x4d, 0x52, 0x56, 0x52, 0x4e, 0x4e, 0x53, 0x59, 0x59, 0x54, 0x45, 0x48, 0x35, 0x32, 0x41, 0x41, 0x37, 0x34, 0x36, 0x32, 0x36, 0x2b, 0x36, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x34, 0x37, 0x34, 0x39, 0x34, 0x3f, 0x36, 0x2a, 0x14, 0x84, 0x0e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0e, 0x0e, 0x0e, 0x0b, 0x0e, 0x0b, 0x14, 0x32, 0x3f, 0x36, 0x39, 0x40, 0x40, 0x40, 0x3e, 0x39, 0x4c, 0x2f, 0x0c, 0x05, 0x05, 0x9c, 0xad, 0xd3, 0xbe, 0xa9, 0xa9, 0xaf, 0xa9, 0xa8, 0xaf, 0xa8, 0xa8, 0xa8, 0xaf, 0xb1, 0xb2, 0xf3, 0xfb, 0xfc, 0x44, 0x44, 0xfb, 0x1b, 0xf9, 0xb5, 0xb4, 0xb1, 0xbc, 0xb7, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb7, 0xb7, 0xb1, 0xbc, 0xbb, 0xbd, 0xc3, 0xc0, 0xab, 0x9b, 0x97, 0x98, 0x9a, 0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x9a, 0x98, 0x93, 0x93, 0x98, 0x97, 0x99, 0x99, 0x98, 0x98, 0x99, 0xf7, 0x99, 0xf1, 0x99, 0x99, 0x93, 0x93, 0x93, 0x95, 0x02, 0x95, 0x02, 0xf1, 0x02, 0xf1, 0x02, 0xf1, 0x02, 0x02, 0x03, 0xf1, 0x02, 0xf1, 0x9a, 0x98, 0x98, 0x97, 0x96, 0x98, 0x98, 0x93, 0x98, 0x98, 0x97, 0x97, 0x99, 0x97, 0x9a, 0x93, 0x98, 0x98, 0x99, 0x97, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x98, 0x97, 0x92, 0x20, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x65, 0x01, 0x65, 0x01, 0xed, 0x90, 0x01, 0x65, 0x5f, 0x2c, 0x24, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x28, 0x2b, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x31, 0x31, 0x2e, 0x2e, 0x2b, 0x2e, 0x2b, 0x2e, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x4d, 0x50, 0x52, 0x4d, 0x4c, 0x52, 0x56, 0x4d, 0x4e, 0x56, 0x4e, 0x48, 0x35, 0x35, 0x32, 0x32, 0x31, 0x41, 0x31, 0x3c, 0x37, 0x31, 0x34, 0x2e, 0x39, 0x34, 0x34, 0x2e, 0x2e, 0x34, 0x2e, 0x32, 0x36, 0x2b, 0x36, 0x43, 0x32, 0x25, 0x14, 0x12, 0x0e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0b, 0x1e, 0x43, 0x40, 0x3f, 0x3f, 0x40, 0x36, 0x47, 0x47, 0x41, 0x4d, 0x35, 0x0c, 0x06, 0x05, 0x8e, 0xab, 0xd1, 0xc1, 0xa4, 0xaf, 0xa8, 0xb1, 0xaf, 0xa8, 0xb1, 0xaf, 0xb7, 0xb1, 0xb7, 0xae, 0xb2, 0xba, 0xc2, 0xc2, 0xc0, 0xf3, 0xb2, 0xb0, 0xb3, 0xb1, 0xb7, 0xb1, 0xb1, 0xb9, 0xb6, 0xb7, 0xbc, 0xbc, 0xb7, 0xb7, 0xaf, 0xb7, 0xbc, 0xbd, 0xbe, 0xc2, 0xc2, 0xad, 0x99, 0x99, 0x98, 0x9a, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x97, 0x98, 0xf1, 0x99, 0xf1, 0x99, 0x97, 0x97, 0x96, 0x93, 0x93, 0x98, 0x99, 0x99, 0xf1, 0x99, 0x99, 0x99, 0x99, 0xf1, 0x99, 0xf7, 0xf1, 0xf7, 0xf1, 0xf1, 0x99, 0x99, 0x96, 0x97, 0x98, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x98, 0x98, 0x98, 0x9a, 0x98, 0x98, 0x99, 0x97, 0x94, 0xc4, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0xed, 0x01, 0x64, 0x60, 0x2c, 0x24, 0x2e, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x28, 0x2e, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x28, 0x2e, 0x2e, 0x34, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x34, 0x2e, 0x34, 0x2e, 0x34, 0x2e, 0x34, 0x2b, 0x36, 0x2b, 0x36, 0x2b, 0x2e, 0x2e, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x2b, 0x28, 0x2b, 0x2e, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x28, 0x34, 0x2e, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x34, 0x40, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x56, 0x52, 0x56, 0x4d, 0x4d, 0x40, 0x36, 0x39, 0x34, 0x34, 0x34, 0x39, 0x31, 0x37, 0x31, 0x37, 0x37, 0x37, 0x31, 0x31, 0x34, 0x2e, 0x34, 0x34, 0x32, 0x36, 0x32, 0x36, 0x25, 0x1d, 0x14, 0x0e, 0x0e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0e, 0x0e, 0x12, 0x84, 0x14, 0x1d, 0x1d, 0x1d, 0x1d, 0x14, 0x12, 0x16, 0x36, 0x52, 0x3f, 0x3f, 0x47, 0x39, 0x40, 0x47, 0x47, 0x41, 0x4d, 0x3d, 0x0f, 0x06, 0x05, 0x8e, 0xad, 0xd3, 0xbd, 0xa8, 0xa9, 0xa8, 0xaf, 0xaf, 0xa8, 0xb1, 0xaf, 0xaf, 0xb1, 0xb3, 0xb7, 0xb3, 0xb3, 0xaf, 0xb3, 0xb4, 0xae, 0xb2, 0xb6, 0xaf, 0xaf, 0xb7, 0xb7, 0xb3, 0xae, 0xb4, 0xb6, 0xaf, 0xbf, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbc, 0xbe, 0xc3, 0xc2, 0xad, 0x99, 0x99, 0x97, 0x98, 0x98, 0x97, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x99, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x98, 0x96, 0x97, 0x96, 0x96, 0x95, 0x96, 0x96, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x97, 0x97, 0x96, 0x98, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x97, 0x95, 0xc4, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x01, 0x90, 0xed, 0x01, 0x65, 0x5f, 0x2c, 0x24, 0x2e, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x34, 0x2e, 0x32, 0x2b, 0x32, 0x2b, 0x2a, 0x32, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x28, 0x2e, 0x2b, 0x2e, 0x2b, 0x34, 0x34, 0x2e, 0x34, 0x2e, 0x34, 0x2e, 0x2e, 0x2e, 0x2e, 0x34, 0x2b, 0x2b, 0x34, 0x2e, 0x31, 0x31, 0x2e, 0x31, 0x39, 0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x56, 0x52, 0x4d, 0x46, 0x40, 0x40, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x34, 0x34, 0x34, 0x36, 0x2e, 0x32, 0x2e, 0x32, 0x2b, 0x2b, 0x32, 0x32, 0x32, 0x2a, 0x1a, 0x1a, 0x84, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x15, 0x15, 0x1d, 0x25, 0x29, 0x2a, 0x43, 0x35, 0x3d, 0x3d, 0x3d, 0x36, 0x32, 0x32, 0x36, 0x46, 0x47, 0x47, 0x3e, 0x49, 0x3e, 0x40, 0x46, 0x47, 0x41, 0x47, 0x48, 0x11, 0x06, 0x05, 0x8e, 0xad, 0xd1, 0xbc, 0xa9, 0xa9, 0xb1, 0xa8, 0xa9, 0xaf, 0xb7, 0xb7, 0xbb, 0xb1, 0xb1, 0xb1, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb3, 0xb3, 0xb3, 0xb1, 0xaf, 0xaf, 0xbc, 0xbb, 0xb5, 0xba, 0xbd, 0xae, 0xb7, 0xbf, 0xbc, 0xb7, 0xb7, 0xb7, 0xbc, 0xbe, 0xc3, 0xc2, 0xf8, 0x9a, 0x99, 0x98, 0x96, 0x98, 0x97, 0x98, 0x99, 0x97, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x9a, 0x98, 0x98, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x98, 0x9a, 0x9a, 0x9a, 0x9b, 0x9a, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x96, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x01, 0x01, 0x90, 0xed, 0x01, 0x64, 0x60, 0x2c, 0x24, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x31, 0x31, 0x31, 0x2e, 0x31, 0x2e, 0x34, 0x2e, 0x34, 0x32, 0x32, 0x32, 0x2a, 0x26, 0x1a, 0x21, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x15, 0x17, 0x1a, 0x21, 0x1a, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x23, 0x23, 0x28, 0x28, 0x24, 0x28, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x34, 0x2e, 0x2e, 0x31, 0x31, 0x41, 0x4d, 0x50, 0x4d, 0x47, 0x4d, 0x52, 0x52, 0x4d, 0x47, 0x36, 0x39, 0x32, 0x34, 0x34, 0x34, 0x34, 0x37, 0x34, 0x31, 0x2e, 0x2e, 0x36, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x32, 0x2b, 0x2b, 0x24, 0x19, 0x14, 0x12, 0x12, 0x12, 0x14, 0x14, 0x1a, 0x25, 0x25, 0x43, 0x35, 0x43, 0x43, 0x3f, 0x3f, 0x3f, 0x36, 0x3f, 0x36, 0x40, 0x46, 0x46, 0x46, 0x4d, 0x47, 0x47, 0x40, 0x41, 0x49, 0x41, 0x49, 0x40, 0x3f, 0x40, 0x3e, 0x46, 0x4c, 0x17, 0x71, 0x06, 0x05, 0xad, 0xd1, 0xbd, 0xa9, 0xa9, 0xaf, 0x9e, 0xbc, 0xcd, 0xe4, 0xe1, 0xe1, 0xcf, 0xc5, 0xbb, 0xb7, 0xb7, 0xb7, 0xbc, 0xb7, 0xb4, 0xb4, 0xae, 0xb7, 0xb1, 0xbf, 0xc1, 0xbe, 0xc2, 0x20, 0xc2, 0xbe, 0xb4, 0xb3, 0xbc, 0xb7, 0xb7, 0xbc, 0xbc, 0xbe, 0xc0, 0xc0, 0xab, 0x9c, 0x9d, 0x9d, 0x9d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa1, 0xa1, 0xa1, 0xa0, 0xa1, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa1, 0xa1, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa2, 0xa5, 0xa5, 0xa2, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa2, 0xa0, 0x9c, 0xcc, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0xed, 0x90, 0x01, 0x01, 0x65, 0x61, 0x2c, 0x24, 0x2e, 0x2e, 0x28, 0x2e, 0x2b, 0x2b, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x34, 0x34, 0x32, 0x24, 0x1a, 0x1a, 0x11, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x0d, 0x0f, 0x10, 0x13, 0x13, 0x17, 0x17, 0x15, 0x16, 0x16, 0x16, 0x19, 0x14, 0x14, 0x14, 0x16, 0x19, 0x1e, 0x1e, 0x2b, 0x2b, 0x28, 0x2b, 0x31, 0x34, 0x47, 0x47, 0x50, 0x4d, 0x4d, 0x4d, 0x47, 0x4d, 0x3e, 0x39, 0x39, 0x34, 0x34, 0x34, 0x39, 0x39, 0x34, 0x37, 0x34, 0x31, 0x34, 0x31, 0x2e, 0x2b, 0x2b, 0x2e, 0x2b, 0x34, 0x32, 0x34, 0x32, 0x2b, 0x24, 0x23, 0x24, 0x32, 0x3d, 0x32, 0x36, 0x4c, 0x46, 0x46, 0x46, 0x46, 0x3f, 0x40, 0x40, 0x40, 0x3e, 0x41, 0x3e, 0x47, 0x40, 0x40, 0x39, 0x40, 0x39, 0x3e, 0x47, 0x39, 0x41, 0x47, 0x41, 0x41, 0x49, 0x3f, 0x3f, 0x3e, 0x3e, 0x40, 0x3d, 0x22, 0x09, 0x05, 0x08, 0xad, 0xd8, 0xbb, 0xa9, 0xaf, 0xa4, 0xaf, 0xe1, 0xe8, 0xe8, 0xea, 0xea, 0xea, 0xe5, 0xcf, 0xbc, 0xb3, 0xb7, 0xb7, 0xb7, 0xb3, 0xb4, 0xb4, 0xae, 0xc1, 0xbf, 0xb8, 0xd1, 0xf4, 0xf4, 0xef, 0xf4, 0xdd, 0xb9, 0xb6, 0xb6, 0xb8, 0xbc, 0xbb, 0xbc, 0xc3, 0xc0, 0xab, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0xa2, 0xa3, 0xa2, 0xa5, 0xa2, 0xa5, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa2, 0xa5, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa2, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa4, 0xa4, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa6, 0xa5, 0xa2, 0x9d, 0xc9, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x90, 0x01, 0x90, 0x90, 0x01, 0x65, 0x60, 0x3a, 0x26, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x34, 0x34, 0x32, 0x24, 0x21, 0x15, 0x0e, 0x0f, 0x0c, 0x0c, 0x10, 0x0d, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xba, 0xf9, 0xb9, 0xf9, 0xb5, 0xf9, 0xb0, 0xf9, 0xad, 0xad, 0xf8, 0xf8, 0xf8, 0x0d, 0x0d, 0x0f, 0x17, 0x17, 0x1a, 0x1a, 0x19, 0x19, 0x1a, 0x19, 0x16, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16, 0x23, 0x2e, 0x47, 0x50, 0x47, 0x46, 0x47, 0x4d, 0x47, 0x47, 0x34, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x34, 0x34, 0x39, 0x39, 0x3e, 0x3e, 0x39, 0x3e, 0x40, 0x47, 0x47, 0x40, 0x40, 0x47, 0x47, 0x47, 0x47, 0x40, 0x34, 0x39, 0x40, 0x3e, 0x39, 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x3e, 0x40, 0x39, 0x40, 0x39, 0x40, 0x3e, 0x47, 0x47, 0x47, 0x41, 0x41, 0x3e, 0x3f, 0x3f, 0x3e, 0x41, 0x39, 0x3d, 0x26, 0x09, 0x06, 0x06, 0xf9, 0xd1, 0xbb, 0xa9, 0xac, 0xa1, 0xcf, 0xe8, 0xe8, 0xdd, 0xe5, 0xe8, 0xea, 0xec, 0xe8, 0xca, 0xb7, 0xb3, 0xbc, 0xbc, 0xb7, 0xae, 0xb4, 0xb7, 0xc5, 0xbb, 0xc4, 0xef, 0xfc, 0xf4, 0xfe, 0xef, 0xec, 0xe7, 0xc4, 0xb0, 0xb7, 0xb8, 0xbc, 0xbe, 0xc1, 0xbe, 0xab, 0x9f, 0xa2, 0xa2, 0xa2, 0xa1, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa1, 0xa3, 0xa4, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa4, 0xa1, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa1, 0xa4, 0xa3, 0xa4, 0xa2, 0xa4, 0xa3, 0xa4, 0xa5, 0xa4, 0xa5, 0xa3, 0xa4, 0xa3, 0xa5, 0xa2, 0xa5, 0xa5, 0xa5, 0xa4, 0xa3, 0xa3, 0xa3, 0xa5, 0xa0, 0x9d, 0xcc, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x90, 0x90, 0x90, 0x01, 0x65, 0x62, 0x45, 0x26, 0x2b, 0x32, 0x2b, 0x36, 0x2b, 0x2b, 0x2b, 0x2e, 0x28, 0x2e, 0x28, 0x2e, 0x32, 0x2a, 0x24, 0x11, 0x0f, 0x0f, 0x13, 0xfa, 0x86, 0xf3, 0xba, 0xb9, 0xba, 0xbd, 0xc0, 0xc3, 0xc5, 0xc3, 0xc5, 0xc7, 0xc7, 0xca, 0xc7, 0xc5, 0xc7, 0xc3, 0xc3, 0xc0, 0xbe, 0xb9, 0xb5, 0xad, 0xf8, 0x0d, 0x0d, 0x0f, 0x17, 0x21, 0x26, 0x26, 0x24, 0x25, 0x24, 0x2b, 0x23, 0x28, 0x1e, 0x1e, 0x1e, 0x28, 0x40, 0x47, 0x52, 0x40, 0x40, 0x46, 0x40, 0x34, 0x34, 0x31, 0x37, 0x37, 0x37, 0x31, 0x37, 0x31, 0x37, 0x37, 0x31, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x34, 0x37, 0x37, 0x41, 0x3e, 0x41, 0x3e, 0x41, 0x3e, 0x3e, 0x3e, 0x3e, 0x47, 0x3e, 0x41, 0x49, 0x3c, 0x41, 0x41, 0x41, 0x47, 0x3e, 0x39, 0x39, 0x40, 0x39, 0x40, 0x39, 0x39, 0x3e, 0x40, 0x3e, 0x40, 0x3e, 0x40, 0x3e, 0x40, 0x47, 0x3e, 0x39, 0x40, 0x3e, 0x3e, 0x3e, 0x3e, 0x49, 0x49, 0x41, 0x3d, 0x2c, 0x09, 0x06, 0x06, 0xf9, 0xfb, 0xbb, 0xa9, 0xac, 0xaa, 0xea, 0xe5, 0xe4, 0xc7, 0xc4, 0xe6, 0xe5, 0xe8, 0xea, 0xe1, 0xc1, 0xb7, 0xbc, 0xb7, 0xb7, 0xb4, 0xb2, 0xc1, 0xbe, 0xbc, 0xe7, 0xee, 0xfc, 0xfb, 0xfc, 0xf4, 0xf4, 0xf0, 0xe6, 0xc0, 0xb2, 0xb8, 0xbc, 0xbc, 0xc1, 0xbe, 0xaa, 0xa0, 0xa5, 0xa0, 0xa3, 0xa2, 0xa0, 0xa1, 0xa0, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa4, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xf2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa5, 0xa2, 0xa5, 0xa2, 0xa5, 0xa2, 0xa5, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0x9d, 0xc9, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x90, 0x90, 0x90, 0x01, 0x65, 0x60, 0x2c, 0x26, 0x35, 0x43, 0x43, 0x32, 0x3d, 0x36, 0x32, 0x40, 0x50, 0x2e, 0x23, 0x2a, 0x2a, 0x14, 0x0f, 0x0f, 0xf3, 0x86, 0xba, 0xfa, 0xb5, 0xb8, 0xc0, 0xc5, 0xc1, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xbd, 0xbe, 0xbe, 0xbe, 0xc1, 0xbd, 0xc0, 0xc1, 0xc3, 0xc3, 0xc4, 0xc3, 0x20, 0xba, 0xfa, 0xf8, 0x0d, 0x0d, 0x13, 0x17, 0x1d, 0x26, 0x2b, 0x2b, 0x28, 0x2e, 0x28, 0x2e, 0x2b, 0x2e, 0x40, 0x47, 0x58, 0x3f, 0x46, 0x46, 0x46, 0x46, 0x34, 0x2e, 0x37, 0x31, 0x38, 0x31, 0x38, 0x31, 0x31, 0x31, 0x31, 0x37, 0x37, 0x37, 0x39, 0x41, 0x47, 0x3e, 0x40, 0x3e, 0x3f, 0x3e, 0x40, 0x3e, 0x3f, 0x3e, 0x40, 0x3e, 0x3f, 0x3e, 0x3f, 0x3e, 0x49, 0x49, 0x49, 0x3e, 0x3e, 0x3f, 0x39, 0x3f, 0x36, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x39, 0x3e, 0x40, 0x3e, 0x3e, 0x49, 0x42, 0x42, 0x41, 0x4d, 0x26, 0x0c, 0x06, 0x07, 0xf9, 0xd1, 0xbb, 0xa9, 0xa1, 0xbb, 0xe8, 0xe6, 0xe2, 0xc4, 0xd7, 0xdd, 0xd8, 0xe8, 0xea, 0xe5, 0xcd, 0xb7, 0xb7, 0xb7, 0xb3, 0xb4, 0xae, 0xc7, 0xb7, 0xd1, 0xe6, 0xf4, 0xfc, 0x57, 0x5b, 0xfc, 0xfd, 0xf4, 0xf0, 0xe4, 0xb6, 0xb1, 0xc1, 0xbd, 0xc1, 0xbd, 0xaa, 0x9f, 0xa2, 0xa3, 0xa2, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa5, 0xa2, 0xa6, 0xa5, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa5, 0xa2, 0xa2, 0xa0, 0xa0, 0xa3, 0xa6, 0xa7, 0xa5, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa5, 0xa5, 0xa5, 0xa3, 0xa3, 0xa1, 0xa5, 0xa3, 0xa3, 0xa0, 0x9d, 0xc9, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x90, 0x90, 0xed, 0xec, 0xff, 0x63, 0x4f, 0x22, 0x25, 0x15, 0x12, 0x12, 0x1d, 0x46, 0x4d, 0x47, 0x40, 0x58, 0x5c, 0x3d, 0x0e, 0x0f, 0x13, 0x86, 0xb5, 0xba, 0xc0, 0xc7, 0xca, 0xca, 0xc5, 0xbf, 0xbf, 0xbf, 0xbc, 0xc1, 0xbc, 0xbe, 0xc0, 0xbe, 0xbe, 0xbe, 0xbd, 0xba, 0xbd, 0xb5, 0xb9, 0xb9, 0xb9, 0xba, 0xba, 0xf3, 0xc1, 0xc4, 0xc0, 0xf9, 0xf8, 0x0d, 0x13, 0x17, 0x26, 0x24, 0x2b, 0x2b, 0x2b, 0x2b, 0x34, 0x40, 0x52, 0x46, 0x46, 0x43, 0x32, 0x2a, 0x43, 0x32, 0x43, 0x39, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x37, 0x31, 0x37, 0x41, 0x47, 0x41, 0x47, 0x47, 0x47, 0x39, 0x47, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x37, 0x3f, 0x34, 0x3f, 0x34, 0x3f, 0x36, 0x3f, 0x3f, 0x36, 0x43, 0x36, 0x43, 0x36, 0x3e, 0x41, 0x3e, 0x41, 0x3e, 0x3b, 0x37, 0x47, 0x3e, 0x47, 0x3e, 0x47, 0x3e, 0x47, 0x3e, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x2f, 0x09, 0x06, 0x07, 0xfa, 0xfb, 0xbb, 0xa9, 0xa4, 0xc1, 0xea, 0xea, 0xe4, 0xba, 0xba, 0xb9, 0xc0, 0xd3, 0xe8, 0xe8, 0xca, 0xb7, 0xbc, 0xb7, 0xb7, 0xb1, 0xb4, 0xc5, 0xb6, 0xdd, 0xe2, 0xf4, 0x60, 0xfc, 0xfc, 0xf4, 0xf4, 0xfd, 0xe6, 0xe6, 0xbb, 0xb8, 0xbc, 0xbc, 0xc1, 0xbd, 0xaa, 0x9f, 0xa0, 0xa3, 0xa0, 0xa3, 0xa2, 0xa1, 0xa2, 0xa1, 0xa4, 0xa3, 0xa1, 0xa1, 0xa3, 0xa3, 0xa5, 0xa6, 0xa2, 0xa7, 0xa4, 0xa4, 0xa4, 0xa1, 0x9f, 0x9f, 0xa1, 0xa2, 0xa3, 0xa3, 0xa1, 0xa4, 0xa1, 0xa3, 0xa3, 0xa7, 0xab, 0xaa, 0xa7, 0x9f, 0x9f, 0xa5, 0xa3, 0xa2, 0xa2, 0xa6, 0xa2, 0xa2, 0xa5, 0xa4, 0xa3, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa5, 0xa5, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0x9d, 0xc7, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xff, 0x27, 0x85, 0x10, 0x0e, 0x0b, 0x0b, 0x12, 0x24, 0x36, 0x36, 0x36, 0x3f, 0x26, 0x12, 0x0f, 0x18, 0x13, 0xf3, 0xc0, 0xc1, 0xc3, 0xbc, 0xb8, 0xb7, 0xb7, 0xb8, 0xb8, 0xb8, 0xba, 0xb5, 0xb9, 0xb5, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xba, 0xba, 0xb9, 0xb5, 0xb5, 0xb5, 0xb0, 0xb0, 0xb4, 0xc1, 0xc1, 0xc0, 0xb5, 0x0d, 0x0f, 0x15, 0x26, 0x24, 0x2b, 0x2e, 0x2b, 0x2e, 0x3f, 0x36, 0x36, 0x2a, 0x2a, 0x30, 0x2f, 0x25, 0x25, 0x35, 0x43, 0x3f, 0x2e, 0x37, 0x39, 0x41, 0x3e, 0x41, 0x47, 0x3e, 0x40, 0x39, 0x40, 0x39, 0x39, 0x39, 0x40, 0x39, 0x47, 0x47, 0x39, 0x40, 0x34, 0x40, 0x34, 0x36, 0x34, 0x39, 0x36, 0x39, 0x34, 0x40, 0x40, 0x47, 0x40, 0x47, 0x40, 0x40, 0x3e, 0x40, 0x34, 0x3e, 0x37, 0x39, 0x37, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x49, 0x41, 0x3b, 0x37, 0x3b, 0x39, 0x3e, 0x39, 0x3e, 0x39, 0x39, 0x41, 0x37, 0x39, 0x3d, 0x2c, 0x0b, 0x06, 0x07, 0xfa, 0xd1, 0xbb, 0xa8, 0xa1, 0xc5, 0xec, 0xe8, 0xec, 0xe6, 0xe6, 0xee, 0xcc, 0xe6, 0xea, 0xe8, 0xc5, 0xb7, 0xb7, 0xbc, 0xb7, 0xac, 0xb9, 0xc5, 0xb4, 0xe7, 0xe8, 0xfc, 0xf4, 0xfc, 0xfe, 0xf4, 0xe2, 0xef, 0xe6, 0xd7, 0xb9, 0xb8, 0xbb, 0xbd, 0xc3, 0xbd, 0xaa, 0x9f, 0xa1, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa5, 0xa5, 0xa5, 0xa2, 0xa2, 0xa2, 0xa2, 0xa1, 0xa1, 0xa1, 0xa4, 0xa4, 0xa9, 0xab, 0xa3, 0xa1, 0xa1, 0xa1, 0xa3, 0xa4, 0xa1, 0xa4, 0xa2, 0x9f, 0x9e, 0x9e, 0xa1, 0xa7, 0xa9, 0xa1, 0xa4, 0xa1, 0xa1, 0xa3, 0xa5, 0xa5, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa5, 0xa3, 0xa5, 0xa4, 0xa1, 0xa3, 0xa3, 0xa5, 0xa1, 0xa2, 0x9b, 0xc9, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0x90, 0x90, 0xed, 0x01, 0xfd, 0x76, 0x8c, 0x03, 0x6f, 0x78, 0x0b, 0x0e, 0x84, 0x15, 0x19, 0x23, 0x23, 0x19, 0x16, 0x17, 0x17, 0xfa, 0x1b, 0xc4, 0xcf, 0xcf, 0xca, 0xc5, 0xc5, 0xcf, 0xd3, 0xd3, 0xd3, 0xd8, 0xdd, 0xe2, 0xee, 0xe2, 0xdd, 0xdd, 0xdd, 0xdd, 0xe2, 0xdd, 0xe2, 0xd7, 0xdd, 0xd8, 0xdd, 0xd8, 0xdd, 0xdd, 0xd7, 0xc5, 0xb8, 0xb7, 0xb8, 0xba, 0xba, 0x0d, 0x13, 0x1a, 0x26, 0x2b, 0x2b, 0x32, 0x52, 0x43, 0x3f, 0x2f, 0x4b, 0x2c, 0x22, 0x85, 0x0f, 0x11, 0x84, 0x2f, 0x43, 0x3f, 0x36, 0x3e, 0x40, 0x3e, 0x39, 0x39, 0x40, 0x3e, 0x36, 0x40, 0x3f, 0x46, 0x3f, 0x46, 0x40, 0x39, 0x39, 0x40, 0x39, 0x40, 0x34, 0x40, 0x40, 0x47, 0x46, 0x47, 0x47, 0x47, 0x40, 0x36, 0x36, 0x36, 0x34, 0x36, 0x34, 0x34, 0x3e, 0x3e, 0x3e, 0x49, 0x3e, 0x49, 0x49, 0x3e, 0x39, 0x3f, 0x3e, 0x47, 0x47, 0x50, 0x3f, 0x3e, 0x3f, 0x3f, 0x3f, 0x46, 0x3f, 0x43, 0x52, 0x43, 0x52, 0x43, 0x4b, 0x30, 0x0c, 0x06, 0x71, 0x0d, 0xfb, 0xbb, 0xa9, 0xa1, 0xc5, 0xed, 0xe8, 0xeb, 0xdd, 0xc9, 0xc4, 0xd7, 0xe7, 0xea, 0xe4, 0xc7, 0xbc, 0xb7, 0xb7, 0xbc, 0xae, 0xb9, 0xc5, 0xb8, 0xdd, 0xe6, 0xef, 0x60, 0xf4, 0x60, 0xf4, 0xed, 0xe2, 0xec, 0xd3, 0xb3, 0xb7, 0xbb, 0xbd, 0xc3, 0xbd, 0xa7, 0x9f, 0xa0, 0xa3, 0xa1, 0xa0, 0xa3, 0xa2, 0xa3, 0xa1, 0xa1, 0xa1, 0xa4, 0xa5, 0xa2, 0xa6, 0xf2, 0xa6, 0xf2, 0xa6, 0xa3, 0xa3, 0xa3, 0xa0, 0xf2, 0x9f, 0xf2, 0xf2, 0xa6, 0xf8, 0xa6, 0xa6, 0xa2, 0xa2, 0xa6, 0xa6, 0xa6, 0xa7, 0xa5, 0xa1, 0xa1, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa1, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0x9d, 0xc7, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0x01, 0xe2, 0x8e, 0x00, 0x8b, 0x8b, 0x8c, 0x8b, 0x8c, 0x78, 0x88, 0x25, 0x1d, 0x1c, 0x1c, 0x1c, 0x26, 0x25, 0x18, 0x86, 0xf3, 0xbd, 0xae, 0xb2, 0xb6, 0xbd, 0xbd, 0xb6, 0xb9, 0xba, 0xba, 0xb9, 0xb9, 0xb5, 0xb5, 0xb6, 0xb6, 0xb3, 0xb4, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0xb8, 0xbb, 0xbb, 0xbd, 0xbd, 0xc1, 0xc4, 0xd3, 0xdb, 0xd3, 0xc5, 0xbd, 0xb9, 0xfa, 0x0d, 0x13, 0x21, 0x2a, 0x2b, 0x3f, 0x43, 0x43, 0x3a, 0x25, 0x11, 0x09, 0x06, 0x03, 0x03, 0x03, 0x71, 0x0e, 0x25, 0x43, 0x3f, 0x36, 0x34, 0x36, 0x36, 0x36, 0x36, 0x43, 0x36, 0x43, 0x36, 0x36, 0x36, 0x36, 0x36, 0x50, 0x47, 0x47, 0x4d, 0x47, 0x4d, 0x46, 0x46, 0x36, 0x3f, 0x36, 0x3f, 0x36, 0x3f, 0x46, 0x3f, 0x43, 0x46, 0x46, 0x46, 0x46, 0x3f, 0x3f, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x43, 0x4b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4b, 0x4b, 0x43, 0x30, 0x43, 0x30, 0x30, 0x30, 0x29, 0x29, 0x29, 0x30, 0x88, 0x78, 0x6f, 0x71, 0x80, 0xfb, 0xb9, 0xaf, 0x9e, 0xbc, 0xea, 0xe6, 0xea, 0xef, 0xe7, 0xe2, 0xd7, 0xe6, 0xec, 0xe8, 0xc1, 0xb7, 0xb7, 0xbc, 0xb3, 0xb3, 0xb6, 0xc5, 0xbb, 0xcd, 0xe9, 0xfb, 0xf4, 0xfc, 0xd7, 0xf4, 0xdd, 0xd3, 0xe5, 0xc1, 0xbf, 0xb9, 0xbc, 0xbd, 0xbe, 0xbe, 0xf8, 0x9f, 0xa0, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa3, 0xa0, 0xa2, 0xa2, 0xa6, 0xf8, 0x08, 0xf8, 0x08, 0x08, 0x08, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x08, 0x07, 0x08, 0x08, 0x08, 0xf2, 0xa6, 0xa2, 0xa1, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa3, 0xa5, 0xa3, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa3, 0xa3, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa1, 0xa0, 0x9b, 0xc9, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfd, 0x8f, 0x00, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x66, 0x0b, 0x87, 0x1d, 0x23, 0x1c, 0x28, 0x14, 0x11, 0x18, 0xfb, 0xc0, 0xb9, 0xc3, 0xc5, 0xc7, 0xc7, 0xc7, 0xcc, 0xc4, 0xc3, 0xc0, 0xbe, 0xba, 0xbd, 0xbb, 0xbb, 0xbb, 0xbc, 0xbd, 0xbd, 0xbe, 0xbe, 0xbe, 0xb6, 0xb8, 0xb6, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xb2, 0xb6, 0xbc, 0xc5, 0xc5, 0xbd, 0xfa, 0xfa, 0x17, 0x26, 0x3d, 0x52, 0x43, 0x29, 0x15, 0x0b, 0x04, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x03, 0x71, 0x0e, 0x30, 0x43, 0x36, 0x3f, 0x36, 0x3f, 0x3f, 0x43, 0x3f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x36, 0x43, 0x32, 0x43, 0x29, 0x43, 0x29, 0x43, 0x43, 0x30, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x1f, 0x87, 0x1f, 0x87, 0x83, 0x83, 0x83, 0x7f, 0x7f, 0x7e, 0x7e, 0x77, 0x7a, 0x77, 0x77, 0x72, 0x72, 0x72, 0x70, 0x6d, 0x72, 0x72, 0x6d, 0x6d, 0x69, 0x69, 0x6f, 0x71, 0x0d, 0xfb, 0xbd, 0xac, 0xaf, 0xbb, 0xe8, 0xe4, 0xe6, 0xe6, 0xe7, 0xef, 0xea, 0xec, 0xe8, 0xd3, 0xbd, 0xb7, 0xb7, 0xbc, 0xb7, 0xb2, 0xb2, 0xbe, 0xbe, 0xc5, 0xea, 0xee, 0xfb, 0xfb, 0xf4, 0xd7, 0xcc, 0xea, 0xcd, 0xbc, 0xc1, 0xb7, 0xbb, 0xbe, 0xc0, 0xf3, 0xa7, 0x9f, 0xa0, 0xa1, 0xa1, 0xa1, 0xa2, 0xa1, 0xa2, 0xa3, 0xa3, 0xa3, 0xa5, 0xa2, 0xf2, 0xf2, 0xf2, 0x08, 0x08, 0x0a, 0x0c, 0x0f, 0x0f, 0x18, 0x17, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x18, 0x13, 0x10, 0x0c, 0x0a, 0x0a, 0x08, 0xf8, 0xf2, 0xa0, 0xa1, 0xa3, 0xa4, 0xa4, 0xa1, 0xa5, 0xa3, 0xa5, 0xa5, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa1, 0xa3, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa1, 0xa1, 0x9c, 0xc7, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0xec, 0x80, 0x00, 0x8c, 0x95, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x68, 0x0b, 0x1d, 0x1f, 0x1c, 0x24, 0x24, 0x17, 0x18, 0xc9, 0xc9, 0xc4, 0xc5, 0xc3, 0xbe, 0xbb, 0xba, 0xbe, 0xc0, 0xc3, 0xc5, 0xc5, 0xca, 0xca, 0xcd, 0xcd, 0xcf, 0xd1, 0xcf, 0xd1, 0xd3, 0xd1, 0xd3, 0xee, 0xdb, 0xd8, 0xd8, 0xd8, 0xd7, 0xd8, 0xd1, 0xd1, 0xd1, 0xd7, 0xd7, 0xcf, 0xcd, 0xca, 0xba, 0xfa, 0x18, 0x26, 0x35, 0x52, 0x4b, 0x1d, 0x0b, 0x06, 0x8c, 0x02, 0x95, 0x92, 0x91, 0x8b, 0x8c, 0x03, 0x78, 0x22, 0x43, 0x43, 0x43, 0x36, 0x29, 0x2b, 0x29, 0x2b, 0x29, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x87, 0x29, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7e, 0x7e, 0x77, 0x7e, 0x77, 0x77, 0x77, 0x70, 0x70, 0x6d, 0x6d, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x70, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x70, 0x6d, 0x72, 0x6d, 0x6b, 0x6f, 0x6f, 0x7b, 0xfb, 0xba, 0xac, 0xa9, 0xac, 0xdd, 0xea, 0xea, 0xef, 0xe7, 0xe6, 0xe8, 0xea, 0xdd, 0xc7, 0xc1, 0xb9, 0xb7, 0xc1, 0xb7, 0xac, 0xb6, 0xb7, 0xc3, 0xbe, 0xcf, 0xff, 0xef, 0xef, 0xef, 0xe4, 0xe8, 0xe5, 0xbc, 0xbf, 0xc1, 0xaf, 0xbb, 0xbe, 0xc2, 0xbd, 0xf8, 0x9f, 0x9f, 0xa1, 0x9f, 0xa1, 0xa2, 0xa1, 0xa3, 0xa1, 0xa3, 0xa2, 0xa6, 0xa6, 0xf2, 0x08, 0xf8, 0x0d, 0xfa, 0x13, 0x21, 0x21, 0x25, 0x1a, 0x1d, 0x1a, 0x1a, 0x1d, 0x1a, 0x1d, 0x21, 0x1d, 0x21, 0x26, 0x2c, 0x3a, 0x33, 0x22, 0x18, 0x10, 0x0a, 0xf8, 0x08, 0xf2, 0xa2, 0xa6, 0xa5, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa5, 0xa5, 0xa3, 0xa5, 0xa5, 0xa5, 0xa3, 0xa4, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa1, 0xa4, 0xa0, 0xa1, 0x9b, 0xc9, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xec, 0x01, 0x65, 0x65, 0x89, 0x8e, 0x66, 0x95, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x72, 0x85, 0x1d, 0x1c, 0x1c, 0x1d, 0x17, 0x2d, 0xf3, 0xc0, 0xbd, 0xb9, 0xbb, 0xc3, 0xcc, 0xd7, 0xd3, 0xd7, 0xd7, 0xd3, 0xd3, 0xcf, 0xcf, 0xca, 0xcd, 0xcc, 0xcc, 0xc7, 0xc7, 0xc4, 0xc4, 0xc3, 0xc2, 0xc3, 0xc2, 0xc3, 0xc3, 0xc3, 0xc2, 0xc4, 0xc9, 0xc4, 0xc3, 0xbe, 0xc1, 0xc5, 0xc7, 0xc0, 0xba, 0x13, 0x18, 0x3d, 0x43, 0x29, 0x7f, 0x6f, 0x68, 0x8b, 0xf6, 0x8a, 0x8a, 0x8b, 0x8b, 0x8a, 0x8c, 0x06, 0x85, 0x30, 0x29, 0x7f, 0x83, 0x83, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x77, 0x7a, 0x77, 0x77, 0x72, 0x74, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6d, 0x70, 0x6d, 0x70, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x70, 0x70, 0x6d, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x74, 0x73, 0x70, 0x73, 0x6f, 0x7b, 0x2d, 0xb8, 0xac, 0xaf, 0xaa, 0xc5, 0xe1, 0xe8, 0xe8, 0xe8, 0xe7, 0xe8, 0xe8, 0xe6, 0xd3, 0xbc, 0xb3, 0xaf, 0xbf, 0xbc, 0xac, 0xb4, 0xb2, 0xc1, 0xc1, 0xbb, 0xd7, 0xe8, 0xef, 0xea, 0xe8, 0xe4, 0xbc, 0xbc, 0xd2, 0xbe, 0xb1, 0xbb, 0xbe, 0xc0, 0xf3, 0xa7, 0x9e, 0x9f, 0xa1, 0xa1, 0xa2, 0xa2, 0xa3, 0xa1, 0xa1, 0xa1, 0xa4, 0xf2, 0x08, 0x0a, 0x0c, 0x13, 0x18, 0x21, 0x21, 0x1a, 0x19, 0x1a, 0x19, 0x1a, 0x19, 0x19, 0x19, 0x1c, 0x19, 0x1c, 0x24, 0x24, 0x1d, 0x1a, 0x26, 0x26, 0x26, 0x2c, 0x2c, 0x27, 0x13, 0x0d, 0x0a, 0xf2, 0xf8, 0xa2, 0xa5, 0xa4, 0xa4, 0xa3, 0xa3, 0xa2, 0xa6, 0xa3, 0xa3, 0xa4, 0xa4, 0xa1, 0xa3, 0xa5, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0x9b, 0xc4, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xec, 0x01, 0x65, 0xf0, 0x86, 0x66, 0x8c, 0x8d, 0x8c, 0x8b, 0x8a, 0x68, 0x8d, 0x8d, 0x8c, 0x8c, 0x66, 0x81, 0x1d, 0x1f, 0x1c, 0x26, 0x17, 0xc9, 0xc0, 0xbb, 0xc0, 0xc5, 0xc4, 0xc7, 0xc7, 0xc7, 0xc3, 0xbd, 0xbb, 0xbb, 0xb9, 0xb8, 0xb6, 0xb8, 0xb8, 0xb6, 0xb6, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbb, 0xba, 0xbb, 0xb9, 0xb9, 0xb9, 0xb9, 0xb6, 0xb6, 0xb9, 0xbb, 0xba, 0xc0, 0xc3, 0xf3, 0xfa, 0x18, 0x3a, 0x4b, 0x1d, 0x72, 0x73, 0x66, 0x8b, 0xf6, 0x02, 0xf7, 0x99, 0x8b, 0x8b, 0x8b, 0x03, 0x7c, 0x88, 0x7f, 0x69, 0x6b, 0x6d, 0x6a, 0x6a, 0x6c, 0x6a, 0x6a, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x70, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x70, 0x6c, 0x70, 0x6c, 0x6d, 0x6d, 0x70, 0x70, 0x70, 0x74, 0x70, 0x74, 0x74, 0x74, 0x79, 0x79, 0x79, 0x7d, 0x7d, 0x79, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x82, 0x7d, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x80, 0xc9, 0xbb, 0xac, 0xac, 0xac, 0xaf, 0xc3, 0xdb, 0xdb, 0xd7, 0xdb, 0xd7, 0xcd, 0xca, 0xbf, 0xb3, 0xb3, 0xb3, 0xc1, 0xbc, 0xaf, 0xae, 0xb1, 0xb4, 0xbf, 0xc3, 0xb7, 0xc1, 0xd3, 0xdb, 0xd7, 0xc5, 0xbc, 0xca, 0xca, 0xbb, 0xb2, 0xba, 0xbe, 0xc0, 0xbd, 0xaa, 0x9e, 0x9f, 0xa1, 0xa1, 0xa6, 0xf2, 0xa1, 0xa1, 0xa4, 0xa4, 0xa2, 0x08, 0x09, 0x0f, 0x15, 0x26, 0x1a, 0x1a, 0x16, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1c, 0x19, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x1c, 0x19, 0x24, 0x19, 0x24, 0x1e, 0x24, 0x24, 0x2a, 0x3a, 0x22, 0x13, 0x0d, 0x08, 0xf2, 0x9f, 0xa4, 0xa4, 0xa3, 0xa2, 0xa2, 0xa6, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa1, 0xa2, 0xa2, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa1, 0xa1, 0xa1, 0x9f, 0x9b, 0xc4, 0xff, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xed, 0xed, 0x01, 0x5b, 0x7b, 0x66, 0x66, 0x8c, 0x8b, 0x8b, 0x8b, 0xf6, 0x8b, 0x6e, 0x8d, 0x8c, 0x66, 0x7a, 0x87, 0x1c, 0x1c, 0x26, 0x18, 0xfb, 0xc4, 0xc5, 0xcd, 0xcc, 0xc7, 0xc3, 0xbe, 0xbe, 0xbd, 0xbd, 0xbe, 0xbe, 0xc3, 0xc3, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xcc, 0xc7, 0xcc, 0xcc, 0xcd, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcc, 0xd1, 0xcc, 0xcd, 0xcd, 0xcc, 0xcc, 0xd1, 0xcf, 0xc9, 0xc2, 0xfa, 0x18, 0x3a, 0x43, 0x83, 0x72, 0x6f, 0x68, 0x8b, 0x94, 0xf7, 0x0a, 0x8f, 0x8b, 0x91, 0x8b, 0x02, 0x71, 0x87, 0x81, 0x6d, 0x6d, 0x6d, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x70, 0x6d, 0x70, 0x6d, 0x70, 0x6d, 0x74, 0x70, 0x74, 0x70, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x79, 0x74, 0x7d, 0x79, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x79, 0x7d, 0x79, 0x7d, 0x79, 0x7d, 0x79, 0x7d, 0x7d, 0x7d, 0x79, 0x7d, 0x79, 0x7d, 0x79, 0x79, 0x79, 0x75, 0x7b, 0xc9, 0xba, 0xa9, 0xb3, 0xaf, 0xac, 0xaf, 0xb7, 0xb7, 0xb7, 0xb3, 0xb7, 0xaf, 0xaf, 0xaf, 0xb1, 0xb3, 0xb7, 0xbc, 0xc1, 0xae, 0xb3, 0xb1, 0xb3, 0xb4, 0xbc, 0xc1, 0xbc, 0xb7, 0xbb, 0xbe, 0xbe, 0xca, 0xc6, 0xc5, 0xb7, 0xb6, 0xbb, 0xbe, 0xc0, 0xbe, 0xaa, 0x9e, 0xa1, 0x9f, 0xa1, 0xa2, 0xa2, 0xa1, 0xa1, 0xa1, 0xf2, 0x08, 0x0c, 0x0f, 0x21, 0x24, 0x1a, 0x19, 0x19, 0x1c, 0x19, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x1d, 0x19, 0x1a, 0x19, 0x24, 0x1e, 0x24, 0x1e, 0x23, 0x1e, 0x24, 0x24, 0x2f, 0x33, 0x22, 0x10, 0x0a, 0x08, 0xa2, 0xa2, 0xa5, 0xa6, 0xa2, 0xa6, 0xa2, 0xa3, 0xa4, 0xa1, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0xa3, 0xa1, 0xa2, 0xa3, 0xa3, 0xa1, 0xa1, 0xa1, 0x9f, 0x9b, 0xc2, 0xec, 0xec, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0x01, 0xf5, 0x89, 0x71, 0x67, 0x6e, 0x8c, 0x8c, 0x8b, 0x02, 0x8b, 0x8b, 0x8f, 0x6e, 0x8c, 0x8c, 0x78, 0x1d, 0x1f, 0x1c, 0x21, 0x13, 0xd1, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc4, 0xc7, 0xc7, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xd1, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc7, 0xcc, 0xc7, 0xc7, 0xc4, 0xc7, 0xc4, 0xc4, 0xc3, 0xc4, 0xc4, 0xc4, 0xc4, 0xc5, 0xc3, 0xc3, 0xc3, 0xc0, 0xc0, 0xc3, 0xf3, 0xfa, 0x18, 0x2c, 0x29, 0x7f, 0x72, 0x73, 0x66, 0x8b, 0x95, 0x03, 0xf9, 0x7b, 0x97, 0x8b, 0x8b, 0x03, 0x6f, 0x88, 0x83, 0x72, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x70, 0x6d, 0x74, 0x70, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x70, 0x74, 0x70, 0x70, 0x73, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6a, 0x6d, 0x6a, 0x6b, 0x6a, 0x6b, 0x6b, 0x6b, 0x69, 0x6a, 0x69, 0x6b, 0x69, 0x69, 0x69, 0x6b, 0x67, 0x67, 0x66, 0x6e, 0xc2, 0xb9, 0xaf, 0xaf, 0xb3, 0xaf, 0xac, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb7, 0xb3, 0xb7, 0xb7, 0xb3, 0xc1, 0xbc, 0xb3, 0xb3, 0xb6, 0xb3, 0xb3, 0xb3, 0xbc, 0xbc, 0xc1, 0xbe, 0xbc, 0xc1, 0xbf, 0xbf, 0xbc, 0xb3, 0xb4, 0xbb, 0xbe, 0xc0, 0xbd, 0xab, 0x9e, 0xa0, 0xa1, 0xa3, 0xa1, 0x9f, 0xa0, 0xa6, 0xf2, 0x0a, 0x0d, 0x17, 0x21, 0x1a, 0x1a, 0x19, 0x19, 0x1c, 0x1c, 0x19, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x14, 0x14, 0x12, 0x14, 0x15, 0x16, 0x19, 0x1e, 0x1e, 0x23, 0x23, 0x23, 0x23, 0x2b, 0x24, 0x2a, 0x2f, 0x2c, 0x21, 0x0d, 0x0a, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xa2, 0xf2, 0xa0, 0xf2, 0xa0, 0xf2, 0xf2, 0xf2, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xf2, 0xa0, 0xf2, 0x9a, 0xc0, 0xea, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0xed, 0x64, 0x2d, 0x73, 0x6f, 0x67, 0x66, 0x8c, 0x8b, 0x8c, 0x02, 0x8b, 0x8d, 0x7b, 0x66, 0x8c, 0x78, 0x87, 0x1c, 0x1d, 0x21, 0x18, 0xd1, 0xbe, 0xb7, 0xbd, 0xc3, 0xc3, 0xc0, 0xc1, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0xbd, 0xbb, 0xb9, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xbb, 0xbb, 0xbb, 0xbd, 0xbd, 0xbd, 0xbe, 0xbd, 0xbd, 0xbd, 0xbc, 0xbe, 0xbd, 0xbe, 0xbd, 0xc0, 0xc0, 0xf3, 0x18, 0x2c, 0x29, 0x83, 0x72, 0x73, 0x66, 0x8b, 0xf6, 0x02, 0x08, 0xad, 0x68, 0x91, 0x8b, 0x03, 0x71, 0x85, 0x85, 0x74, 0x6d, 0x70, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x70, 0x6d, 0x6d, 0x6d, 0x70, 0x6d, 0x72, 0x72, 0x72, 0x77, 0x77, 0x72, 0x77, 0x72, 0x72, 0x6f, 0x6b, 0x6b, 0x6b, 0x6d, 0x6b, 0x6b, 0x6c, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6b, 0x6b, 0x69, 0x67, 0x75, 0x20, 0xb8, 0xac, 0xa9, 0xaf, 0xb7, 0xb1, 0xaf, 0xb7, 0xb1, 0xb1, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbe, 0xc1, 0xae, 0xb6, 0xb6, 0xb7, 0xb6, 0xb7, 0xb6, 0xaf, 0xbc, 0xbc, 0xb7, 0xbb, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0xbb, 0xbd, 0xc3, 0xbe, 0xab, 0x9e, 0xa0, 0xf2, 0xa1, 0xa1, 0xa1, 0xa0, 0x0a, 0x0a, 0x0f, 0x21, 0x21, 0x1a, 0x19, 0x19, 0x1c, 0x1c, 0x19, 0x1c, 0x1c, 0x19, 0x19, 0x19, 0x16, 0x16, 0x14, 0x14, 0x12, 0x0e, 0x0e, 0x0e, 0x0e, 0x12, 0x16, 0x19, 0x1c, 0x1e, 0x1e, 0x23, 0x23, 0x28, 0x28, 0x28, 0x2b, 0x32, 0x35, 0x21, 0x13, 0x0a, 0x0a, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0xba, 0xe9, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0x01, 0x01, 0xff, 0x2d, 0x6f, 0x72, 0x69, 0x66, 0x66, 0x8c, 0x02, 0x66, 0x95, 0x8d, 0x7b, 0x8c, 0x8c, 0x78, 0x1d, 0x84, 0x19, 0x22, 0x18, 0xcc, 0xc1, 0xc5, 0xcf, 0xc7, 0xc3, 0xc3, 0xc5, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc5, 0xc4, 0xc5, 0xc4, 0xc7, 0xc4, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xcc, 0xc7, 0xcc, 0xcc, 0xcc, 0xca, 0xcc, 0xca, 0xcc, 0xcc, 0xd1, 0xcd, 0x20, 0xf3, 0x13, 0x2c, 0x2f, 0x7f, 0x72, 0x73, 0x66, 0x8c, 0x8a, 0x02, 0x8e, 0x76, 0x8e, 0x8b, 0x8b, 0x03, 0x73, 0x85, 0x81, 0x6d, 0x6d, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x6b, 0x6d, 0x6d, 0x6f, 0x77, 0x7a, 0x7f, 0x81, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x83, 0x7f, 0x7a, 0x77, 0x72, 0x6b, 0x6b, 0x6d, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6a, 0x6a, 0x6b, 0x6a, 0x6b, 0x69, 0x66, 0x75, 0x20, 0xbb, 0xa8, 0xaf, 0xaf, 0xb3, 0xae, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xb6, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xc1, 0xc1, 0xb3, 0xb3, 0xb6, 0xb4, 0xb4, 0xb6, 0xb8, 0xb4, 0xb4, 0xb8, 0xb6, 0xb8, 0xb1, 0xbc, 0xb8, 0xbb, 0xbc, 0xbb, 0xbd, 0xc0, 0xbe, 0xaa, 0x9f, 0xf2, 0xa2, 0xa0, 0xa1, 0xa2, 0xf2, 0x0a, 0x0f, 0x21, 0x1a, 0x19, 0x1c, 0x1c, 0x1e, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x19, 0x16, 0x16, 0x14, 0x12, 0x12, 0x0e, 0x12, 0x0e, 0x12, 0x12, 0x16, 0x16, 0x1c, 0x1c, 0x23, 0x23, 0x28, 0x28, 0x2e, 0x2e, 0x28, 0x2e, 0x34, 0x32, 0x2c, 0x17, 0x13, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x10, 0x0f, 0x10, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x10, 0x10, 0x10, 0x0a, 0x1b, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0x64, 0x2d, 0x72, 0x72, 0x6f, 0x66, 0x66, 0x68, 0x6e, 0xf7, 0x8d, 0x8e, 0x75, 0x8c, 0x66, 0x78, 0x87, 0x14, 0x1d, 0x22, 0x18, 0xc9, 0xc5, 0xcd, 0xdb, 0xcd, 0xcc, 0xcf, 0xcc, 0xcc, 0xca, 0xcc, 0xcd, 0xcc, 0xc7, 0xca, 0xc7, 0xca, 0xc7, 0xcc, 0xc7, 0xcc, 0xc7, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc7, 0xc7, 0xc7, 0xc4, 0xc5, 0xc5, 0xc3, 0xc7, 0xc4, 0xc5, 0xc4, 0xc0, 0xfa, 0x18, 0x2c, 0x29, 0x83, 0x72, 0x73, 0x67, 0x8b, 0x8b, 0x02, 0x05, 0x7b, 0x8e, 0x8c, 0x8b, 0x68, 0x78, 0x85, 0x7d, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c, 0x6a, 0x6a, 0x6c, 0x6a, 0x6c, 0x6a, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x6b, 0x6d, 0x6d, 0x77, 0x81, 0x84, 0x29, 0x29, 0x43, 0x4b, 0x43, 0x4c, 0x52, 0x4c, 0x52, 0x43, 0x43, 0x3d, 0x35, 0x29, 0x87, 0x85, 0x7e, 0x77, 0x6d, 0x6b, 0x6b, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x69, 0x67, 0x75, 0xc2, 0xb8, 0xaf, 0xaf, 0xaf, 0xaf, 0xae, 0xfa, 0x1b, 0x1b, 0xf3, 0x1b, 0xf9, 0xf9, 0xb6, 0xb7, 0xb7, 0xaf, 0xbf, 0xc1, 0xb3, 0xb3, 0xb2, 0xb4, 0xb5, 0xb2, 0xad, 0xb5, 0xb5, 0xb5, 0xba, 0xb6, 0xb2, 0xb4, 0xb2, 0xbb, 0xbb, 0xb8, 0xbc, 0xc3, 0xbe, 0xab, 0x9e, 0xa2, 0xf2, 0xa2, 0xf2, 0xf2, 0x0a, 0x0f, 0x21, 0x24, 0x16, 0x1e, 0x1c, 0x1c, 0x19, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x19, 0x19, 0x14, 0x16, 0x14, 0x14, 0x14, 0x12, 0x14, 0x14, 0x16, 0x16, 0x19, 0x19, 0x1c, 0x1c, 0x23, 0x23, 0x28, 0x28, 0x2e, 0x2e, 0x31, 0x34, 0x2e, 0x36, 0x35, 0x25, 0x15, 0x87, 0x17, 0x87, 0x15, 0x1d, 0x1d, 0x1d, 0x1d, 0x87, 0x1d, 0x87, 0x1d, 0x87, 0x17, 0x87, 0x21, 0x87, 0x25, 0x1d, 0x25, 0x13, 0x89, 0x64, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x64, 0x2d, 0x78, 0x72, 0x72, 0x66, 0x66, 0x68, 0x8e, 0x68, 0x8d, 0x8f, 0x6e, 0x8c, 0x67, 0x7c, 0x84, 0x84, 0x1d, 0x22, 0x18, 0xc9, 0xbe, 0xbd, 0xbe, 0xbb, 0xbd, 0xbb, 0xbd, 0xbb, 0xb8, 0xbb, 0xb9, 0xb8, 0xb9, 0xb6, 0xb8, 0xb6, 0xb9, 0xb8, 0xb9, 0xb9, 0xbb, 0xb9, 0xbb, 0xb9, 0xb8, 0xb9, 0xbb, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb7, 0xb9, 0xb7, 0xba, 0xbb, 0xba, 0xbb, 0xbe, 0xf9, 0x18, 0x33, 0x25, 0x83, 0x72, 0x77, 0x6e, 0x8c, 0x8b, 0x8b, 0x08, 0x0d, 0x75, 0x02, 0x66, 0x06, 0x79, 0x81, 0x7d, 0x6d, 0x6a, 0x6c, 0x6a, 0x6a, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6d, 0x6b, 0x6d, 0x77, 0x85, 0x30, 0x30, 0x4b, 0x5c, 0x52, 0x4c, 0x46, 0x52, 0x52, 0x58, 0x52, 0x52, 0x47, 0x46, 0x46, 0x46, 0x3d, 0x43, 0x30, 0x30, 0x87, 0x85, 0x77, 0x6b, 0x69, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x6a, 0x69, 0x66, 0x75, 0x20, 0xb8, 0xa8, 0xb7, 0xa8, 0xa7, 0xfb, 0xfc, 0x44, 0x4f, 0x4f, 0x44, 0x27, 0x1b, 0xfa, 0xb3, 0xb7, 0xb7, 0xbc, 0xc1, 0xb3, 0xb3, 0xb6, 0xb2, 0xf9, 0xf9, 0xf3, 0xfb, 0xfc, 0xc9, 0xf3, 0xf9, 0xba, 0xf3, 0xb9, 0xb8, 0xb6, 0xbb, 0xbc, 0xc1, 0xbe, 0xaa, 0x9e, 0xa0, 0xa2, 0xf2, 0xf2, 0x0a, 0x10, 0x17, 0x24, 0x19, 0x1e, 0x1c, 0x1c, 0x19, 0x19, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x19, 0x16, 0x16, 0x14, 0x16, 0x16, 0x1c, 0x1e, 0x24, 0x24, 0x2b, 0x2b, 0x28, 0x24, 0x23, 0x1e, 0x1c, 0x28, 0x28, 0x28, 0x2e, 0x34, 0x31, 0x31, 0x2e, 0x34, 0x36, 0x29, 0x1d, 0x1d, 0x1d, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x15, 0x4f, 0x64, 0xf5, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x65, 0xf5, 0xed, 0x01, 0x64, 0x89, 0x78, 0x78, 0x72, 0x66, 0x8c, 0x8c, 0x68, 0x8c, 0x8d, 0x6e, 0x8d, 0x8c, 0x6e, 0x81, 0x85, 0x14, 0x1d, 0x22, 0x18, 0xc4, 0xf3, 0xbb, 0xb9, 0xbb, 0xbd, 0xbe, 0xc1, 0xc1, 0xc3, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc7, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc7, 0xc5, 0xc7, 0xc5, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xf3, 0x18, 0x33, 0x30, 0x7f, 0x77, 0x72, 0x73, 0x8c, 0x8b, 0x8b, 0x71, 0x7b, 0x05, 0x8c, 0x04, 0x6f, 0x7c, 0x81, 0x74, 0x79, 0x6a, 0x6a, 0x6c, 0x6a, 0x6c, 0x6a, 0x6c, 0x6c, 0x6a, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x6b, 0x72, 0x83, 0x30, 0x4b, 0x4b, 0x4b, 0x56, 0x43, 0x46, 0x4d, 0x52, 0x4d, 0x52, 0x47, 0x4d, 0x47, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x46, 0x3f, 0x32, 0x43, 0x30, 0x87, 0x81, 0x6b, 0x6b, 0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x6a, 0x6b, 0x6a, 0x6a, 0x69, 0x69, 0x67, 0x75, 0xc2, 0xb8, 0xaf, 0xaf, 0xa9, 0xf3, 0x60, 0x5d, 0x33, 0x54, 0x59, 0x5e, 0x5d, 0x54, 0x1b, 0xba, 0xb6, 0xb7, 0xbc, 0xc1, 0xb1, 0xb1, 0xb5, 0xb0, 0xf9, 0xfb, 0x5b, 0xfe, 0xfd, 0xfe, 0xfc, 0xc9, 0x2d, 0xc9, 0xc9, 0xf3, 0xb6, 0xbb, 0xbc, 0xc1, 0xbc, 0xac, 0x9e, 0xa0, 0xa2, 0xf2, 0x07, 0x10, 0x17, 0x26, 0x19, 0x1e, 0x1e, 0x1c, 0x1c, 0x1d, 0x19, 0x1c, 0x1c, 0x1e, 0x1c, 0x1c, 0x1c, 0x19, 0x19, 0x19, 0x1c, 0x1e, 0x23, 0x2b, 0x3f, 0x4d, 0x52, 0x52, 0x58, 0x58, 0x58, 0x58, 0x52, 0x46, 0x3f, 0x36, 0x2b, 0x2b, 0x2e, 0x34, 0x34, 0x37, 0x37, 0x3c, 0x3b, 0x3f, 0x2e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x85, 0x44, 0x63, 0x01, 0x90, 0x01, 0x01, 0x90, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0xed, 0x01, 0x65, 0x5b, 0x82, 0x78, 0x78, 0x6f, 0x66, 0x8c, 0x8b, 0x8c, 0x8d, 0x66, 0x8c, 0x67, 0x78, 0x87, 0x84, 0x14, 0x1d, 0x30, 0x18, 0xc2, 0xc7, 0xee, 0xd7, 0xd3, 0xcf, 0xcf, 0xcf, 0xd3, 0xd3, 0xd3, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xcf, 0xcf, 0xcf, 0xcd, 0xcc, 0xcc, 0xcc, 0xcd, 0xc7, 0xf3, 0x1b, 0x33, 0x25, 0x84, 0x77, 0x72, 0x72, 0x6f, 0x66, 0x66, 0x68, 0x71, 0x66, 0x68, 0x71, 0x78, 0x85, 0x79, 0x6d, 0x70, 0x6a, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6a, 0x6d, 0x6d, 0x6d, 0x7a, 0x29, 0x4a, 0x5a, 0x56, 0x4c, 0x52, 0x4d, 0x46, 0x4c, 0x52, 0x4c, 0x52, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x47, 0x52, 0x46, 0x36, 0x43, 0x43, 0x4b, 0x87, 0x6f, 0x67, 0x6b, 0x6a, 0x67, 0x6a, 0x69, 0x69, 0x69, 0x6a, 0x69, 0x6a, 0x69, 0x6a, 0x69, 0x66, 0x75, 0x20, 0xb7, 0xac, 0xa8, 0xfa, 0xf4, 0x54, 0x45, 0x59, 0x51, 0x45, 0x45, 0x59, 0x5e, 0x54, 0x1b, 0xba, 0xb6, 0xbc, 0xc5, 0xb1, 0xb1, 0xb0, 0xf9, 0xfb, 0x5b, 0x5b, 0x5d, 0x57, 0x5b, 0x5b, 0xfc, 0xfb, 0x2d, 0xfb, 0xd1, 0xb9, 0xb8, 0xbb, 0xbf, 0xbd, 0xa9, 0x9e, 0xa2, 0xf2, 0x08, 0x0c, 0x12, 0x21, 0x1e, 0x1e, 0x1e, 0x1c, 0x19, 0x1d, 0x16, 0x1d, 0x1c, 0x1c, 0x23, 0x1e, 0x23, 0x1e, 0x23, 0x1e, 0x28, 0x2b, 0x47, 0x52, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x5c, 0x58, 0x5c, 0x58, 0x5c, 0x58, 0x46, 0x3f, 0x2b, 0x2e, 0x34, 0x39, 0x3b, 0x3b, 0x3b, 0x37, 0x3f, 0x2b, 0x23, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x29, 0x1f, 0x87, 0x87, 0x89, 0x64, 0x90, 0x90, 0x01, 0xed, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x65, 0x01, 0xed, 0xed, 0x65, 0xfe, 0x86, 0x7a, 0x7c, 0x78, 0x71, 0x68, 0x66, 0x8c, 0x66, 0x66, 0x8c, 0x77, 0x88, 0x83, 0x14, 0x1f, 0x14, 0x22, 0x1b, 0x20, 0xc7, 0xd1, 0xc4, 0xc5, 0xc3, 0xc1, 0xbe, 0xbd, 0xbb, 0xbd, 0xbd, 0xbd, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xbb, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc, 0xb7, 0xbb, 0xb8, 0xb8, 0xbb, 0xbc, 0xbe, 0xba, 0x18, 0x33, 0x22, 0x84, 0x7a, 0x72, 0x77, 0x73, 0x71, 0x6f, 0x68, 0x67, 0x71, 0x78, 0x78, 0x7c, 0x81, 0x70, 0x69, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6c, 0x6b, 0x72, 0x81, 0x4a, 0x4b, 0x5a, 0x43, 0x3d, 0x58, 0x56, 0x46, 0x56, 0x4c, 0x43, 0x4c, 0x43, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4c, 0x4c, 0x4c, 0x4d, 0x50, 0x52, 0x52, 0x4d, 0x43, 0x35, 0x30, 0x30, 0x7a, 0x69, 0x67, 0x69, 0x67, 0x69, 0x67, 0x67, 0x69, 0x6a, 0x69, 0x6a, 0x69, 0x69, 0x66, 0x75, 0xc2, 0xb4, 0xaf, 0xa7, 0xf3, 0x60, 0x4f, 0x53, 0x5e, 0x45, 0x33, 0x22, 0x51, 0x59, 0x5f, 0x2d, 0xf3, 0xb5, 0xbc, 0xc5, 0xb3, 0xb4, 0xb2, 0xf3, 0xf4, 0x57, 0xfc, 0x5d, 0x5b, 0x60, 0x60, 0x89, 0xfc, 0x1b, 0xfb, 0xc9, 0xb9, 0xb4, 0xbc, 0xc1, 0xbc, 0xaa, 0x9f, 0xf2, 0xf2, 0x08, 0x11, 0x1a, 0x24, 0x1e, 0x1e, 0x1e, 0x1c, 0x1c, 0x1d, 0x1c, 0x24, 0x23, 0x28, 0x2e, 0x2e, 0x34, 0x34, 0x34, 0x40, 0x4d, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x5c, 0x5c, 0x50, 0x40, 0x39, 0x34, 0x3e, 0x39, 0x47, 0x41, 0x39, 0x39, 0x3f, 0x43, 0x1d, 0x29, 0x25, 0x87, 0x87, 0x87, 0x87, 0x87, 0x29, 0x87, 0x29, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x85, 0x80, 0x57, 0x90, 0x90, 0x90, 0x01, 0xed, 0x01, 0x90, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x01, 0xed, 0xed, 0x01, 0xfe, 0x27, 0x0b, 0x7a, 0x81, 0x81, 0x7c, 0x78, 0x71, 0x6f, 0x68, 0x77, 0x85, 0x87, 0x84, 0x1d, 0x1c, 0x14, 0x27, 0x27, 0xc0, 0xbe, 0xbe, 0xb4, 0xbb, 0xbb, 0xbc, 0xbe, 0xc1, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc1, 0xc3, 0xc3, 0xc5, 0xc5, 0xc5, 0xc7, 0xc7, 0xcc, 0xca, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xca, 0xcd, 0xca, 0xc7, 0xcc, 0xc5, 0xc7, 0xc7, 0xc2, 0x1b, 0x33, 0x30, 0x84, 0x7e, 0x77, 0x72, 0x77, 0x73, 0x78, 0x72, 0x72, 0x78, 0x7a, 0x7a, 0x85, 0x7e, 0x6d, 0x6a, 0x6d, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x72, 0x87, 0x4a, 0x5a, 0x4e, 0x4c, 0x56, 0x56, 0x3d, 0x4d, 0x4c, 0x50, 0x4c, 0x52, 0x4c, 0x4c, 0x48, 0x4b, 0x48, 0x4b, 0x48, 0x3d, 0x4e, 0x4e, 0x4c, 0x56, 0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x46, 0x3d, 0x4b, 0x4a, 0x81, 0x6f, 0x69, 0x69, 0x69, 0x67, 0x67, 0x67, 0x67, 0x6a, 0x69, 0x6a, 0x67, 0x67, 0x75, 0xc2, 0xb7, 0xac, 0xa7, 0xc9, 0x60, 0x54, 0x53, 0x53, 0x55, 0x33, 0x22, 0x53, 0x53, 0x5e, 0x44, 0xfa, 0xb5, 0xbc, 0xc5, 0xb1, 0xb4, 0xae, 0x20, 0xfd, 0xfc, 0xfc, 0x5d, 0xfc, 0x57, 0xef, 0xfc, 0xfc, 0x2d, 0xc9, 0xfb, 0xb9, 0xb8, 0xbe, 0xbf, 0xbd, 0xaa, 0xf2, 0xf2, 0x08, 0x0a, 0x21, 0x24, 0x1e, 0x1e, 0x1e, 0x23, 0x23, 0x2b, 0x2b, 0x32, 0x36, 0x36, 0x3e, 0x41, 0x3e, 0x39, 0x40, 0x4d, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x5c, 0x5a, 0x5a, 0x5a, 0x56, 0x5c, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x47, 0x3e, 0x39, 0x39, 0x46, 0x40, 0x39, 0x3e, 0x46, 0x2b, 0x14, 0x0b, 0x7c, 0x82, 0x82, 0x7c, 0x7c, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x71, 0x78, 0x71, 0x71, 0x6f, 0x05, 0x68, 0xc9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xec, 0xed, 0x01, 0x64, 0x89, 0x81, 0x0e, 0x7f, 0x81, 0x85, 0x81, 0x81, 0x78, 0x7f, 0x87, 0x87, 0x14, 0x14, 0x1c, 0x1c, 0x1d, 0x2c, 0x1b, 0xbb, 0xc5, 0xd3, 0xcf, 0xca, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc5, 0xc7, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc1, 0xc3, 0xc3, 0xc3, 0xc5, 0xc5, 0xc2, 0x1b, 0x44, 0x2c, 0x84, 0x7a, 0x7e, 0x77, 0x72, 0x72, 0x72, 0x77, 0x78, 0x77, 0x0b, 0x7e, 0x85, 0x77, 0x6d, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6b, 0x72, 0x87, 0x4a, 0x5a, 0x4e, 0x56, 0x4c, 0x56, 0x56, 0x56, 0x48, 0x56, 0x4c, 0x4c, 0x48, 0x3a, 0x3a, 0x3a, 0x45, 0x3a, 0x45, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x48, 0x4b, 0x48, 0x4c, 0x4d, 0x4d, 0x58, 0x46, 0x46, 0x4b, 0x4b, 0x87, 0x78, 0x67, 0x69, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6a, 0x69, 0x69, 0x66, 0x75, 0xc2, 0xb1, 0xaf, 0xa4, 0xd3, 0x5b, 0x54, 0x54, 0x53, 0x59, 0x33, 0x33, 0x53, 0x53, 0x5d, 0x44, 0xf3, 0xb9, 0xbe, 0xc5, 0xb4, 0xb1, 0xb0, 0x20, 0xfe, 0xfc, 0x57, 0x57, 0xfc, 0xfc, 0xfd, 0xee, 0x57, 0x2d, 0xfb, 0xc9, 0xba, 0xb8, 0xbc, 0xc1, 0xbd, 0xaa, 0xf2, 0x08, 0x08, 0x0c, 0x21, 0x1c, 0x1c, 0x1e, 0x23, 0x2e, 0x31, 0x39, 0x47, 0x3e, 0x39, 0x3e, 0x3b, 0x3e, 0x41, 0x40, 0x50, 0x58, 0x5c, 0x5c, 0x5c, 0x5a, 0x5a, 0x5a, 0x5a, 0x5e, 0x53, 0x5e, 0x5a, 0x59, 0x59, 0x5a, 0x59, 0x5a, 0x5a, 0x5a, 0x5c, 0x5c, 0x5c, 0x58, 0x4d, 0x47, 0x40, 0x3d, 0x47, 0x39, 0x3e, 0x50, 0x32, 0x87, 0x06, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x8b, 0x8b, 0xba, 0xe7, 0xe7, 0xe9, 0xeb, 0xeb, 0xeb, 0x90, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xed, 0x01, 0x64, 0x5f, 0x85, 0x7f, 0x7f, 0x84, 0x83, 0x83, 0x83, 0x15, 0x87, 0x1f, 0x84, 0x1f, 0x1c, 0x1c, 0x16, 0x1a, 0x27, 0x1b, 0xc1, 0xbf, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc1, 0xbd, 0xbd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb9, 0xbb, 0xb9, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc, 0xbd, 0xbb, 0xbb, 0xbc, 0xc3, 0xba, 0x1b, 0x27, 0x4a, 0x1d, 0x7f, 0x7e, 0x7e, 0x77, 0x77, 0x77, 0x72, 0x77, 0x77, 0x7f, 0x85, 0x83, 0x72, 0x6d, 0x6d, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x70, 0x85, 0x4a, 0x5a, 0x48, 0x56, 0x56, 0x56, 0x4d, 0x48, 0x48, 0x4b, 0x51, 0x3a, 0x33, 0x3a, 0x44, 0x4f, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x5d, 0x57, 0x4f, 0x4f, 0x33, 0x3a, 0x4b, 0x4e, 0x4c, 0x4d, 0x4d, 0x52, 0x4d, 0x4c, 0x43, 0x4a, 0x29, 0x0b, 0x69, 0x67, 0x67, 0x67, 0x69, 0x6a, 0x6a, 0x6a, 0x67, 0x67, 0x75, 0xc2, 0xb8, 0xa9, 0xa8, 0xc5, 0xef, 0x57, 0x59, 0x5e, 0x4f, 0x45, 0x45, 0x53, 0x53, 0x5f, 0xfb, 0xbd, 0xb9, 0xc1, 0xc7, 0xbb, 0xae, 0xb2, 0xc9, 0xfd, 0xf4, 0x57, 0x57, 0x57, 0xe2, 0xee, 0xe2, 0xfc, 0x2d, 0x20, 0xd1, 0xb9, 0xb4, 0xbc, 0xbc, 0xbd, 0xf8, 0xf2, 0x07, 0x0a, 0x13, 0x26, 0x1c, 0x1c, 0x23, 0x37, 0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x41, 0x40, 0x50, 0x58, 0x5c, 0x5c, 0x5c, 0x56, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x61, 0x60, 0x61, 0x60, 0x5f, 0x5e, 0x5e, 0x5e, 0x5a, 0x5a, 0x5c, 0x5c, 0x58, 0x52, 0x46, 0x46, 0x46, 0x41, 0x3e, 0x49, 0x43, 0x3a, 0x78, 0x8c, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x05, 0x8d, 0x9c, 0x8d, 0x9b, 0x8d, 0x93, 0x9f, 0xf8, 0xab, 0xa6, 0xa6, 0xad, 0xb8, 0xba, 0xd1, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x90, 0xeb, 0xed, 0x01, 0x65, 0xfe, 0x27, 0x0e, 0x84, 0x84, 0x84, 0x84, 0x1f, 0x87, 0x1d, 0x84, 0x1c, 0x14, 0x1c, 0x1e, 0x19, 0x1e, 0x22, 0xf3, 0xbe, 0xbc, 0xbc, 0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xbd, 0xbc, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc7, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc7, 0xc2, 0x1b, 0x44, 0x45, 0x30, 0x1d, 0x7f, 0x7f, 0x7e, 0x77, 0x7a, 0x77, 0x7e, 0x7f, 0x87, 0x85, 0x77, 0x72, 0x70, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6d, 0x85, 0x4a, 0x4a, 0x4b, 0x4e, 0x4e, 0x4d, 0x56, 0x48, 0x48, 0x51, 0x45, 0x33, 0x44, 0x57, 0x5b, 0x62, 0xff, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x63, 0xfe, 0x55, 0x4f, 0x33, 0x3a, 0x48, 0x4e, 0x52, 0x52, 0x50, 0x46, 0x52, 0x4c, 0x4b, 0x30, 0x7c, 0x69, 0x69, 0x6b, 0x6b, 0x6b, 0x6a, 0x69, 0x6a, 0x67, 0x75, 0xc2, 0xb1, 0xaf, 0xa8, 0xbc, 0xe7, 0xfe, 0x5d, 0x4f, 0x44, 0x5f, 0x54, 0x4f, 0x5f, 0x60, 0xc9, 0xb9, 0xb7, 0xbd, 0xc7, 0xbc, 0xae, 0xae, 0xc4, 0xef, 0xf4, 0xf4, 0xfc, 0xf4, 0xee, 0xf4, 0xe9, 0xf4, 0xc2, 0xfb, 0xd3, 0xb2, 0xb6, 0xbb, 0xbc, 0xbd, 0xa6, 0x08, 0x08, 0x09, 0x21, 0x2a, 0x23, 0x28, 0x34, 0x3e, 0x47, 0x41, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x49, 0x41, 0x47, 0x52, 0x5c, 0x5c, 0x5a, 0x53, 0x5e, 0x5e, 0x60, 0x61, 0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x63, 0x63, 0x63, 0x62, 0x61, 0x5f, 0x5e, 0x5a, 0x5a, 0x5a, 0x56, 0x52, 0x4c, 0x47, 0x40, 0x49, 0x3e, 0x3f, 0x4b, 0x88, 0x71, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9b, 0x8d, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9e, 0x9e, 0x9d, 0x9e, 0x9f, 0xf2, 0x9d, 0x9f, 0xa0, 0x98, 0x9c, 0xbd, 0xef, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0x90, 0x90, 0x90, 0x01, 0xf5, 0x01, 0x64, 0xfd, 0x88, 0x11, 0x15, 0x19, 0x16, 0x1f, 0x1c, 0x14, 0x1d, 0x14, 0x1c, 0x1c, 0x23, 0x1e, 0x1a, 0x22, 0x1b, 0xf3, 0xb9, 0xbb, 0xbd, 0xbd, 0xbd, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbc, 0xbe, 0xbd, 0xc1, 0xbc, 0xc1, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0xbe, 0xbe, 0xbd, 0xc0, 0xbe, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbf, 0xc1, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0xc1, 0xc3, 0xc0, 0x1b, 0x1b, 0x33, 0x33, 0x4b, 0x30, 0x25, 0x84, 0x83, 0x0e, 0x83, 0x84, 0x87, 0x87, 0x87, 0x77, 0x6f, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x6c, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x82, 0x4a, 0x55, 0x51, 0x53, 0x56, 0x56, 0x53, 0x48, 0x53, 0x45, 0x33, 0x44, 0x57, 0xfe, 0xf5, 0x65, 0x01, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x65, 0xfe, 0x5b, 0x44, 0x45, 0x45, 0x4e, 0x4c, 0x52, 0x4d, 0x58, 0x52, 0x46, 0x52, 0x30, 0x0b, 0x72, 0x6f, 0x6d, 0x6b, 0x6a, 0x6a, 0x67, 0x67, 0x7b, 0xf3, 0xb4, 0xac, 0xaf, 0xbc, 0xd7, 0xfd, 0xff, 0xfc, 0xfc, 0x57, 0x5b, 0x5b, 0xfe, 0xee, 0xc2, 0xbb, 0xb8, 0xbb, 0xcd, 0xb9, 0xb1, 0xb2, 0xbe, 0xe6, 0xec, 0xf0, 0xef, 0xe7, 0xff, 0xf0, 0xef, 0x20, 0xc2, 0xe6, 0xc0, 0xae, 0xb6, 0xb9, 0xbd, 0xbb, 0xa7, 0xf2, 0x07, 0x0f, 0x26, 0x24, 0x2e, 0x40, 0x3e, 0x3e, 0x39, 0x3e, 0x3e, 0x40, 0x3e, 0x39, 0x41, 0x41, 0x49, 0x58, 0x5c, 0x5a, 0x53, 0x59, 0x5d, 0x62, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x01, 0x01, 0x65, 0x01, 0x65, 0x64, 0x62, 0x61, 0x5e, 0x5a, 0x53, 0x56, 0x58, 0x46, 0x47, 0x46, 0x47, 0x40, 0x3d, 0x30, 0x09, 0x68, 0x8d, 0x93, 0x8d, 0x9b, 0x8d, 0x9b, 0x8d, 0x9b, 0x9b, 0x93, 0x9d, 0x9e, 0x9b, 0x9d, 0x9e, 0x9e, 0x9f, 0x9f, 0xa1, 0x9f, 0xa1, 0xa0, 0x9e, 0x9d, 0x9d, 0xc4, 0x01, 0x01, 0xec, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xeb, 0xed, 0x65, 0x65, 0x64, 0x65, 0x64, 0x63, 0x55, 0x2c, 0x25, 0x2b, 0x36, 0x28, 0x24, 0x1f, 0x24, 0x25, 0x2b, 0x2b, 0x37, 0x2e, 0x3d, 0x3a, 0x27, 0x1b, 0x1b, 0x1b, 0x1b, 0xc0, 0xf3, 0xc2, 0xf3, 0xf3, 0xf3, 0xf3, 0xba, 0xf3, 0xba, 0xf3, 0xba, 0xba, 0xf3, 0xba, 0xf3, 0xba, 0xf3, 0xba, 0xba, 0xf3, 0xba, 0xf3, 0xbd, 0xba, 0xf3, 0xba, 0xbd, 0xba, 0xbe, 0xf3, 0xf3, 0xf3, 0xc0, 0xf3, 0xbe, 0xf3, 0xc4, 0x2d, 0x2d, 0x33, 0x22, 0x2c, 0x25, 0x25, 0x21, 0x25, 0x25, 0x25, 0x25, 0x1d, 0x87, 0x0b, 0x6f, 0x6f, 0x72, 0x6f, 0x6d, 0x72, 0x6d, 0x6f, 0x72, 0x73, 0x6e, 0x69, 0x67, 0x67, 0x67, 0x6b, 0x6b, 0x7a, 0x30, 0x55, 0x51, 0x51, 0x4e, 0x53, 0x48, 0x53, 0x45, 0x45, 0x44, 0xfc, 0x60, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x64, 0x62, 0x57, 0x45, 0x3a, 0x4e, 0x56, 0x4d, 0x46, 0x52, 0x52, 0x52, 0x4b, 0x29, 0x78, 0x6d, 0x6b, 0x69, 0x6a, 0x6a, 0x6a, 0x67, 0x7b, 0xba, 0xb5, 0xaf, 0xa9, 0xb8, 0xcf, 0xd8, 0xee, 0xfd, 0x5b, 0x5b, 0x5b, 0xef, 0xee, 0x20, 0xb6, 0xb9, 0xb7, 0xbd, 0xcf, 0xbc, 0xb1, 0xb2, 0xb3, 0xcc, 0xe8, 0xec, 0xec, 0xec, 0xef, 0xe2, 0xd1, 0xd7, 0xe6, 0xc3, 0xaa, 0xb6, 0xb6, 0xb6, 0xbd, 0xbb, 0xa7, 0x08, 0x0a, 0x0f, 0x24, 0x32, 0x37, 0x3e, 0x47, 0x3e, 0x3e, 0x3e, 0x40, 0x39, 0x39, 0x50, 0x39, 0x37, 0x58, 0x5c, 0x5a, 0x53, 0x5e, 0x61, 0x63, 0x64, 0x65, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0xed, 0x90, 0xed, 0x01, 0x65, 0x64, 0x63, 0x62, 0x5f, 0x5e, 0x53, 0x56, 0x56, 0x4d, 0x46, 0x40, 0x47, 0x46, 0x3d, 0x13, 0x0d, 0x7b, 0x8f, 0x8e, 0x8e, 0x8e, 0x8e, 0xa1, 0x9e, 0xa8, 0xa1, 0xa4, 0xa2, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xa7, 0xa4, 0xa5, 0xa7, 0xa5, 0xa3, 0x9e, 0xba, 0xeb, 0x01, 0xed, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0x01, 0x90, 0x64, 0x65, 0x63, 0x63, 0x61, 0x57, 0x4a, 0x3a, 0x43, 0x43, 0x3f, 0x43, 0x3f, 0x4d, 0x4c, 0x4c, 0x56, 0x56, 0x58, 0x5c, 0x5a, 0x5a, 0x59, 0x54, 0x57, 0x54, 0xfc, 0xfc, 0xfc, 0xfc, 0x44, 0xfc, 0xfb, 0x44, 0xfb, 0x44, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0x54, 0x45, 0x2c, 0x2f, 0x3a, 0x3a, 0x4b, 0x3a, 0x4b, 0x4e, 0x4b, 0x48, 0x30, 0x21, 0x30, 0x30, 0x88, 0x87, 0x25, 0x25, 0x15, 0x88, 0x4a, 0x5b, 0x5b, 0xee, 0x89, 0x20, 0x82, 0x71, 0x7c, 0x30, 0x59, 0x55, 0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x4f, 0x44, 0x57, 0x63, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x65, 0x64, 0x63, 0x60, 0x45, 0x45, 0x4e, 0x56, 0x52, 0x4d, 0x52, 0x52, 0x4e, 0x4b, 0x87, 0x72, 0x6b, 0x69, 0x6a, 0x6e, 0x6a, 0x67, 0x7b, 0xba, 0xb4, 0xb1, 0xa9, 0xaf, 0xc7, 0xdd, 0xd8, 0xf4, 0xfd, 0xfd, 0xfd, 0xf4, 0xee, 0xc7, 0xc5, 0xc5, 0xc3, 0xca, 0xdd, 0xc1, 0xbb, 0xbb, 0xbb, 0xb9, 0xc0, 0xd7, 0xe8, 0xe6, 0xe6, 0xee, 0xe2, 0xd8, 0xb6, 0xae, 0xae, 0xb4, 0xb6, 0xb2, 0xbb, 0xb9, 0xab, 0xf2, 0x09, 0x11, 0x2a, 0x36, 0x39, 0x47, 0x40, 0x3e, 0x3e, 0x3e, 0x47, 0x3b, 0x39, 0x39, 0x4d, 0x52, 0x56, 0x4e, 0x55, 0x5f, 0x62, 0x63, 0x64, 0x64, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x65, 0x64, 0x63, 0x62, 0x61, 0x5e, 0x51, 0x4e, 0x4e, 0x4d, 0x4d, 0x50, 0x4d, 0x43, 0x5a, 0x55, 0x44, 0x89, 0xfb, 0x86, 0xfa, 0xad, 0xb1, 0xaf, 0xb1, 0xb3, 0xb2, 0xb5, 0xb4, 0xb4, 0xb1, 0xb1, 0xb2, 0xb2, 0xb6, 0xb4, 0xae, 0xb5, 0xb6, 0xb0, 0xaa, 0xc0, 0xeb, 0x01, 0x90, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xec, 0x01, 0x64, 0x62, 0x4f, 0x22, 0x18, 0x22, 0x21, 0x2a, 0x24, 0x1c, 0x34, 0x46, 0x50, 0x50, 0x52, 0x56, 0x4c, 0x56, 0x58, 0x56, 0x56, 0x4b, 0x51, 0x51, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x4f, 0x54, 0x54, 0x54, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4f, 0x44, 0x4f, 0xfc, 0x54, 0x54, 0x55, 0x59, 0x55, 0x54, 0x59, 0x57, 0x54, 0x59, 0x59, 0x5a, 0x5e, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x5c, 0x58, 0x5c, 0x5c, 0x5a, 0x5c, 0x5a, 0x5c, 0x5a, 0x5a, 0x5c, 0x5c, 0x5e, 0x61, 0x62, 0x64, 0x65, 0x64, 0x62, 0x60, 0x55, 0x55, 0x51, 0x4a, 0x45, 0x51, 0x53, 0x4f, 0x4f, 0x44, 0x44, 0x60, 0x64, 0x65, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0xed, 0x01, 0x65, 0x63, 0x62, 0x4f, 0x3a, 0x53, 0x56, 0x4d, 0x46, 0x50, 0x4d, 0x4c, 0x4b, 0x85, 0x72, 0x6b, 0x6b, 0x6a, 0x67, 0x67, 0x7b, 0xb8, 0xb6, 0xb1, 0xb1, 0xa9, 0xaf, 0xc7, 0xc4, 0xc0, 0xc2, 0xc2, 0xc4, 0xc0, 0xbe, 0xc0, 0xc1, 0xbc, 0xb7, 0xb6, 0xbc, 0xae, 0xb1, 0xb4, 0xb4, 0xb9, 0xb9, 0xb2, 0xb6, 0xbe, 0xc2, 0xbe, 0xb2, 0xab, 0xa7, 0xb6, 0xb3, 0xae, 0xb3, 0xb6, 0xb9, 0xb8, 0xaa, 0x08, 0x0c, 0x11, 0x32, 0x36, 0x47, 0x3e, 0x40, 0x39, 0x3e, 0x49, 0x41, 0x49, 0x37, 0x34, 0x4d, 0x56, 0x51, 0x55, 0x62, 0x63, 0x64, 0x64, 0x64, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0x65, 0x64, 0x64, 0x62, 0x59, 0x45, 0x48, 0x56, 0x58, 0x4d, 0x4d, 0x4c, 0x4e, 0x5a, 0x5e, 0x5f, 0x5f, 0x60, 0xfb, 0xba, 0xb0, 0xb8, 0xb7, 0xb8, 0xb6, 0xb9, 0xb8, 0xb6, 0xb8, 0xb3, 0xb8, 0xb5, 0xb9, 0xb4, 0xb6, 0xb6, 0xb8, 0xb2, 0xb0, 0xd1, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xec, 0x64, 0xfe, 0x2c, 0x17, 0x11, 0x15, 0x21, 0x1d, 0x1a, 0x1c, 0x23, 0x3f, 0x58, 0x50, 0x50, 0x52, 0x4c, 0x4c, 0x4e, 0x4c, 0x4c, 0x46, 0x3d, 0x3a, 0x4c, 0x48, 0x4c, 0x3a, 0x3a, 0x45, 0x3a, 0x45, 0x3a, 0x33, 0x3a, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x45, 0x4f, 0x45, 0x4f, 0x45, 0x4f, 0x45, 0x51, 0x45, 0x51, 0x45, 0x48, 0x3a, 0x48, 0x3a, 0x3a, 0x3a, 0x48, 0x48, 0x3d, 0x4e, 0x52, 0x4d, 0x47, 0x47, 0x47, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x47, 0x40, 0x40, 0x52, 0x4c, 0x36, 0x4d, 0x58, 0x52, 0x40, 0x4e, 0x53, 0x61, 0x62, 0x63, 0x61, 0x5b, 0x55, 0x55, 0x45, 0x4f, 0x45, 0x54, 0x44, 0x54, 0x44, 0x44, 0x5b, 0x64, 0x65, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x90, 0xed, 0x01, 0x01, 0x65, 0x65, 0x62, 0x44, 0x3a, 0x48, 0x56, 0x4d, 0x52, 0x4d, 0x52, 0x4b, 0x4b, 0x7a, 0x67, 0x6f, 0x6a, 0x67, 0x67, 0x7b, 0xba, 0xb3, 0xb7, 0xb1, 0xaf, 0xac, 0xb1, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb1, 0xaf, 0xae, 0xaf, 0xae, 0xae, 0xae, 0xb4, 0xb4, 0xb2, 0xb4, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xb5, 0xb9, 0xbb, 0xae, 0xb1, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xaa, 0x0a, 0x09, 0x21, 0x32, 0x47, 0x3e, 0x40, 0x39, 0x40, 0x3b, 0x3e, 0x3c, 0x37, 0x41, 0x52, 0x48, 0x51, 0x59, 0x62, 0x64, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x62, 0x55, 0x45, 0x4e, 0x56, 0x4d, 0x52, 0x5c, 0x4d, 0x4c, 0x4e, 0x4e, 0x51, 0x55, 0x57, 0xfa, 0xb0, 0xb6, 0xb4, 0xb3, 0xb5, 0xb5, 0xb2, 0xb1, 0xb1, 0xb1, 0xb2, 0xb6, 0xb4, 0xb4, 0xb2, 0xb6, 0xb2, 0xb0, 0xb0, 0xdd, 0x01, 0xed, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x4f, 0x11, 0x2f, 0x4e, 0x4e, 0x4e, 0x3d, 0x4c, 0x40, 0x46, 0x4d, 0x46, 0x50, 0x58, 0x52, 0x56, 0x56, 0x4c, 0x56, 0x52, 0x4c, 0x52, 0x4c, 0x4c, 0x4c, 0x3d, 0x48, 0x3a, 0x3a, 0x3a, 0x3a, 0x33, 0x3a, 0x33, 0x3a, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x45, 0x33, 0x3a, 0x33, 0x3a, 0x33, 0x3a, 0x2c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x48, 0x3a, 0x3d, 0x48, 0x3d, 0x3d, 0x46, 0x32, 0x34, 0x32, 0x39, 0x36, 0x2e, 0x2e, 0x34, 0x34, 0x31, 0x34, 0x31, 0x39, 0x31, 0x2e, 0x23, 0x28, 0x2e, 0x39, 0x47, 0x2e, 0x32, 0x36, 0x36, 0x37, 0x41, 0x39, 0x47, 0x3d, 0x2f, 0x4f, 0x61, 0x63, 0x89, 0x44, 0x44, 0x4f, 0x54, 0x54, 0x4f, 0xfc, 0x44, 0xfc, 0x5b, 0x65, 0x65, 0xec, 0x01, 0x01, 0xed, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0x90, 0x90, 0x01, 0x01, 0x65, 0x65, 0x61, 0x44, 0x45, 0x56, 0x4c, 0x4d, 0x50, 0x4d, 0x36, 0x4b, 0x29, 0x77, 0x69, 0x6b, 0x67, 0x8d, 0x7b, 0xb8, 0xb4, 0xb1, 0xaf, 0xb1, 0xbc, 0xaf, 0xac, 0xaf, 0xb6, 0xb7, 0xb3, 0xb3, 0xb3, 0xb1, 0xac, 0xb1, 0xb3, 0xb4, 0xb1, 0xb2, 0xb3, 0xb1, 0xae, 0xb1, 0xb8, 0xb4, 0xb2, 0xb4, 0xb2, 0xb1, 0xae, 0xac, 0xab, 0xb7, 0xb8, 0xb3, 0xb1, 0xb2, 0xb6, 0xb2, 0xf8, 0x0a, 0x0c, 0x26, 0x32, 0x47, 0x47, 0x40, 0x40, 0x40, 0x3e, 0x41, 0x49, 0x38, 0x50, 0x56, 0x51, 0x4f, 0x61, 0x65, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x60, 0x59, 0x48, 0x56, 0x56, 0x4d, 0x40, 0x58, 0x58, 0x4d, 0x56, 0x5a, 0x59, 0x57, 0xf3, 0xf9, 0xb8, 0xb4, 0xb6, 0xb9, 0xb5, 0xb6, 0xb6, 0xb4, 0xb7, 0xb6, 0xb6, 0xb6, 0xb4, 0xb6, 0xb6, 0xb5, 0xb2, 0xb5, 0xd8, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x64, 0x5d, 0x2f, 0x56, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x52, 0x46, 0x4c, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4c, 0x4c, 0x46, 0x46, 0x46, 0x3f, 0x46, 0x36, 0x35, 0x35, 0x2c, 0x2c, 0x33, 0x2c, 0x33, 0x2c, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x45, 0x33, 0x45, 0x48, 0x3a, 0x48, 0x35, 0x3d, 0x3d, 0x39, 0x47, 0x37, 0x38, 0x41, 0x49, 0x3b, 0x41, 0x39, 0x39, 0x47, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x40, 0x47, 0x39, 0x37, 0x50, 0x40, 0x3f, 0x47, 0x34, 0x42, 0x49, 0x41, 0x50, 0x4d, 0x35, 0x51, 0x5f, 0x89, 0xee, 0xfc, 0x57, 0x54, 0xfc, 0xfc, 0xfc, 0xfb, 0xee, 0xff, 0x65, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x5f, 0x4f, 0x48, 0x48, 0x4d, 0x4d, 0x50, 0x46, 0x43, 0x4b, 0x87, 0x6f, 0x67, 0x67, 0x6e, 0x7b, 0xb8, 0xb3, 0xb1, 0xb1, 0xb3, 0xb1, 0xac, 0xbc, 0xb3, 0xaf, 0xb1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb1, 0xb4, 0xb2, 0xb1, 0xb2, 0xb1, 0xb6, 0xb4, 0xae, 0xb1, 0xb4, 0xb3, 0xb1, 0xb1, 0xb6, 0xb6, 0xbb, 0xae, 0xaf, 0xb3, 0xb4, 0xb4, 0xb2, 0xb5, 0xad, 0x0a, 0x0c, 0x26, 0x36, 0x47, 0x40, 0x40, 0x40, 0x47, 0x47, 0x41, 0x41, 0x49, 0x4d, 0x48, 0x53, 0x62, 0x64, 0xf5, 0x90, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x90, 0xed, 0xed, 0x90, 0x01, 0x64, 0x5f, 0x45, 0x56, 0x5a, 0x4c, 0x58, 0x50, 0x49, 0x58, 0x47, 0x56, 0x5e, 0x57, 0xfa, 0xb5, 0xb2, 0xb2, 0xb6, 0xb2, 0xb5, 0xb5, 0xb4, 0xb1, 0xb1, 0xb4, 0xb4, 0xb5, 0xb4, 0xb2, 0xb4, 0xb6, 0xb0, 0xb0, 0xd8, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x5f, 0x3a, 0x46, 0x3d, 0x3f, 0x3d, 0x35, 0x35, 0x3d, 0x35, 0x32, 0x2a, 0x36, 0x2b, 0x2b, 0x24, 0x24, 0x23, 0x2b, 0x28, 0x31, 0x28, 0x1e, 0x35, 0x15, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2d, 0x27, 0x2d, 0x2d, 0x27, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xfb, 0x2d, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x33, 0x33, 0x33, 0x2c, 0x33, 0x2f, 0x48, 0x32, 0x2e, 0x38, 0x38, 0x38, 0x38, 0x38, 0x31, 0x2e, 0x31, 0x31, 0x2e, 0x37, 0x2e, 0x3f, 0x2b, 0x36, 0x36, 0x34, 0x3e, 0x3c, 0x42, 0x41, 0x47, 0x3e, 0x50, 0x47, 0x49, 0x49, 0x49, 0x49, 0x52, 0x48, 0x59, 0x5b, 0xfb, 0x89, 0xfc, 0xfc, 0xfc, 0xfb, 0xfc, 0xee, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x5d, 0x45, 0x53, 0x4c, 0x4d, 0x47, 0x52, 0x3f, 0x43, 0x4b, 0x7a, 0x67, 0x67, 0x6e, 0xb1, 0xb8, 0xb4, 0xb1, 0xb1, 0xb1, 0xb4, 0xb1, 0xb1, 0xb1, 0xb3, 0xb1, 0xb1, 0xb3, 0xb3, 0xb4, 0xb3, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb1, 0xb3, 0xb3, 0xb3, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xb3, 0xb3, 0xb4, 0xb6, 0xb9, 0xf8, 0x0a, 0x11, 0x2a, 0x4d, 0x3e, 0x3e, 0x40, 0x40, 0x47, 0x3e, 0x47, 0x41, 0x4d, 0x56, 0x3a, 0x61, 0x64, 0x64, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0xec, 0xec, 0xeb, 0x90, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0x01, 0x90, 0x65, 0x63, 0x59, 0x45, 0x4e, 0x5a, 0x4d, 0x58, 0x58, 0x58, 0x47, 0x4e, 0x5a, 0x5d, 0xf3, 0xf9, 0xb6, 0xb6, 0xb6, 0xb5, 0xb6, 0xb2, 0xb4, 0xb3, 0xb3, 0xb6, 0xb6, 0xb2, 0xb4, 0xb4, 0xb2, 0xb2, 0xb2, 0xb0, 0xd8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x5f, 0x48, 0x46, 0x46, 0x43, 0x2a, 0x15, 0x0e, 0x12, 0x16, 0x12, 0x14, 0x14, 0x19, 0x24, 0x3f, 0x36, 0x34, 0x28, 0x2e, 0x2e, 0x31, 0x32, 0x48, 0x2c, 0x44, 0x2d, 0x2d, 0xfb, 0x2d, 0x2d, 0xfb, 0x2d, 0x20, 0xfb, 0xfb, 0x1b, 0x20, 0x2d, 0xd1, 0xfb, 0x20, 0xfb, 0xc9, 0x20, 0x20, 0x1b, 0x20, 0xc9, 0x1b, 0x20, 0x1b, 0x20, 0x2d, 0xc9, 0x1b, 0x27, 0x2d, 0x27, 0x27, 0x3a, 0x3a, 0x36, 0x3e, 0x3c, 0x3c, 0x3c, 0x3b, 0x37, 0x49, 0x49, 0x3b, 0x3b, 0x3b, 0x36, 0x3f, 0x46, 0x32, 0x32, 0x36, 0x49, 0x49, 0x42, 0x42, 0x49, 0x49, 0x47, 0x47, 0x47, 0x49, 0x49, 0x49, 0x47, 0x4d, 0x5e, 0x57, 0xee, 0xee, 0xfb, 0xfc, 0xee, 0xee, 0xd8, 0xe6, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x65, 0xfe, 0x5d, 0x51, 0x53, 0x4d, 0x47, 0x50, 0x46, 0x46, 0x4b, 0x25, 0x6f, 0x66, 0x6e, 0x7b, 0xb8, 0xb7, 0xb6, 0xb3, 0xb2, 0xb1, 0xb4, 0xb1, 0xb3, 0xb1, 0xb1, 0xb3, 0xb3, 0xb3, 0xb2, 0xb4, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb3, 0xb4, 0xb1, 0xb3, 0xb3, 0xb1, 0xb1, 0xb3, 0xb2, 0xb3, 0xb1, 0xb1, 0xb1, 0xb4, 0xb2, 0xb6, 0xb5, 0xad, 0x0a, 0x0f, 0x35, 0x47, 0x3e, 0x40, 0x40, 0x3e, 0x47, 0x47, 0x39, 0x46, 0x4c, 0x3a, 0x5e, 0x62, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0xed, 0xed, 0x90, 0x90, 0x90, 0xec, 0xec, 0xec, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x63, 0x61, 0x53, 0x51, 0x5a, 0x56, 0x58, 0x49, 0x58, 0x52, 0x4e, 0x5a, 0x57, 0xfa, 0xf9, 0xb9, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb4, 0xb1, 0xb3, 0xb4, 0xb5, 0xb4, 0xb4, 0xb5, 0xb4, 0xb2, 0xb2, 0xb0, 0xd8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x5f, 0x35, 0x4c, 0x46, 0x3d, 0x0e, 0x09, 0x09, 0x0e, 0x1a, 0x1a, 0x16, 0x12, 0x12, 0x1c, 0x52, 0x58, 0x2e, 0x28, 0x31, 0x31, 0x39, 0x32, 0x3a, 0x27, 0x2d, 0xf8, 0xf1, 0x9c, 0x9c, 0x9d, 0x9c, 0x9e, 0xf2, 0xa0, 0x9e, 0xf2, 0xa6, 0xa2, 0xa0, 0xa0, 0xa0, 0xa0, 0xf2, 0xa6, 0xf8, 0xb0, 0xad, 0xf9, 0xb0, 0xf9, 0xf9, 0xad, 0xf9, 0xf9, 0xf9, 0xb5, 0xad, 0xf9, 0x0a, 0x0a, 0x0f, 0x35, 0x46, 0x3e, 0x41, 0x3e, 0x47, 0x39, 0x3c, 0x38, 0x31, 0x41, 0x47, 0x2b, 0x2a, 0x2f, 0x2f, 0x35, 0x32, 0x37, 0x41, 0x42, 0x49, 0x42, 0x49, 0x40, 0x46, 0x46, 0x47, 0x50, 0x49, 0x50, 0x4d, 0x5e, 0x59, 0xfc, 0xee, 0xee, 0xd8, 0xee, 0xee, 0xe2, 0xf0, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x64, 0x61, 0x4f, 0x53, 0x48, 0x4d, 0x46, 0x47, 0x3f, 0x4c, 0x4b, 0x7c, 0x66, 0x6e, 0xb8, 0xb8, 0xb1, 0xb6, 0xb3, 0xb2, 0xb4, 0xb4, 0xb3, 0xb3, 0xb3, 0xb1, 0xb3, 0xb3, 0xb4, 0xb4, 0xb2, 0xb2, 0xb4, 0xb2, 0xb3, 0xb2, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xb3, 0xb1, 0xb3, 0xb3, 0xb3, 0xb1, 0xb4, 0xb2, 0xb1, 0xb1, 0xb3, 0xb4, 0xb4, 0xb5, 0xb9, 0xf8, 0x0d, 0x17, 0x3d, 0x47, 0x47, 0x3e, 0x47, 0x47, 0x3e, 0x47, 0x46, 0x4c, 0x48, 0x4f, 0x62, 0x64, 0x65, 0x01, 0xf5, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0xed, 0x01, 0xed, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0xec, 0xec, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x63, 0x5d, 0x45, 0x51, 0x5c, 0x56, 0x50, 0x52, 0x58, 0x4c, 0x51, 0x4f, 0xfa, 0xf9, 0xb5, 0xb6, 0xb6, 0xb5, 0xb6, 0xb2, 0xb4, 0xb3, 0xb3, 0xb6, 0xb5, 0xb4, 0xb4, 0xb6, 0xb2, 0xb2, 0xb2, 0xb0, 0xd8, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x63, 0x5f, 0x35, 0x46, 0x46, 0x4b, 0x12, 0x07, 0x0b, 0x0e, 0x25, 0x2a, 0x25, 0x14, 0x12, 0x19, 0x58, 0x58, 0x34, 0x28, 0x37, 0x2e, 0x41, 0x3d, 0x2c, 0x2d, 0x20, 0xa0, 0x91, 0x91, 0x00, 0x91, 0x96, 0x9f, 0x9a, 0x91, 0x91, 0x94, 0x91, 0x91, 0x91, 0x91, 0x92, 0x00, 0x00, 0x91, 0x94, 0xf6, 0x00, 0x00, 0x94, 0x95, 0x9e, 0x94, 0x00, 0x00, 0x91, 0xaa, 0xa7, 0x92, 0x00, 0x02, 0x03, 0x3a, 0x36, 0x3e, 0x3b, 0x3b, 0x3e, 0x36, 0x31, 0x31, 0x28, 0x2e, 0x2a, 0x12, 0x0b, 0x0f, 0x0f, 0x21, 0x15, 0x24, 0x37, 0x49, 0x49, 0x42, 0x49, 0x47, 0x46, 0x46, 0x3f, 0x50, 0x49, 0x47, 0x4c, 0x5a, 0x5b, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xe6, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xf5, 0xf5, 0xec, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0x90, 0x01, 0x01, 0x65, 0xff, 0x5d, 0x4f, 0x53, 0x3d, 0x46, 0x40, 0x3e, 0x46, 0x4b, 0x22, 0x71, 0x6e, 0xb8, 0xb6, 0xb1, 0xb1, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb2, 0xb4, 0xb5, 0xb4, 0xb2, 0xb4, 0xb4, 0xb3, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb3, 0xb3, 0xb2, 0xb4, 0xb1, 0xb1, 0xb1, 0xb4, 0xb2, 0xb3, 0xfa, 0xf8, 0x0d, 0x17, 0x46, 0x47, 0x40, 0x40, 0x47, 0x41, 0x47, 0x47, 0x4c, 0x4e, 0x45, 0x5d, 0x64, 0x65, 0x65, 0xed, 0xed, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x90, 0xec, 0xf5, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x65, 0x65, 0x61, 0x45, 0x51, 0x56, 0x56, 0x52, 0x52, 0x56, 0x4c, 0x51, 0x44, 0xfa, 0xf9, 0xb9, 0xb6, 0xb6, 0xb6, 0xb5, 0xb4, 0xb4, 0xb1, 0xb3, 0xb4, 0xb6, 0xb2, 0xb4, 0xb5, 0xb4, 0xb2, 0xb2, 0xb0, 0xd8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x5f, 0x3d, 0x4c, 0x4c, 0x3d, 0x11, 0x07, 0x09, 0x0e, 0x15, 0x29, 0x1c, 0x14, 0x14, 0x16, 0x58, 0x58, 0x34, 0x28, 0x37, 0x28, 0x39, 0x46, 0x2c, 0x2d, 0x20, 0x9e, 0x92, 0x93, 0x92, 0x9f, 0xbd, 0xc7, 0xaa, 0x00, 0xaa, 0xbd, 0xae, 0x92, 0x92, 0xb6, 0xad, 0x96, 0xaa, 0xba, 0x96, 0x97, 0xa6, 0xa6, 0x96, 0xa2, 0xb5, 0x9d, 0xa2, 0x9d, 0x92, 0xb1, 0xb7, 0x93, 0x92, 0x02, 0x06, 0x2f, 0x3d, 0x3e, 0x3b, 0x3b, 0x39, 0x39, 0x34, 0x2e, 0x28, 0x2a, 0x26, 0x0c, 0x04, 0x04, 0x07, 0x09, 0x0c, 0x12, 0x3d, 0x3b, 0x42, 0x49, 0x49, 0x3e, 0x47, 0x3f, 0x50, 0x49, 0x47, 0x47, 0x48, 0x5e, 0x57, 0xee, 0xee, 0xee, 0xee, 0xd8, 0xe2, 0xeb, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0xf5, 0xf5, 0xec, 0xed, 0xf5, 0xec, 0xec, 0xec, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x90, 0x01, 0xed, 0x01, 0x64, 0x60, 0x4f, 0x51, 0x4e, 0x46, 0x3f, 0x47, 0x47, 0x3d, 0x30, 0x0d, 0x76, 0xb8, 0xb8, 0xb3, 0xb2, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xb2, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb2, 0xb4, 0xb1, 0xb1, 0xb3, 0xb4, 0xb4, 0xb5, 0xb5, 0xf9, 0x0d, 0x22, 0x4c, 0x47, 0x3e, 0x47, 0x47, 0x49, 0x3e, 0x47, 0x48, 0x51, 0x44, 0x63, 0x65, 0x65, 0x01, 0xf5, 0x01, 0x65, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0xec, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x65, 0x63, 0x59, 0x45, 0x56, 0x56, 0x56, 0x52, 0x4c, 0x52, 0x5a, 0x27, 0xfa, 0xf9, 0xb8, 0xb4, 0xb4, 0xb6, 0xb6, 0xb2, 0xb4, 0xb3, 0xb4, 0xb6, 0xb5, 0xb6, 0xb4, 0xb6, 0xb2, 0xb2, 0xb2, 0xb0, 0xd8, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x63, 0x5f, 0x2f, 0x46, 0x43, 0x3a, 0x11, 0x71, 0x09, 0x0e, 0x15, 0x1f, 0x14, 0x14, 0x12, 0x19, 0x52, 0x58, 0x36, 0x28, 0x34, 0x2e, 0x39, 0x3d, 0x2c, 0x27, 0xc2, 0x9f, 0x92, 0x92, 0x92, 0xb0, 0xc3, 0xa7, 0x9a, 0x00, 0xc2, 0xc0, 0xc0, 0x9a, 0x97, 0xd3, 0xb8, 0x91, 0xb8, 0xe4, 0x92, 0x92, 0xbd, 0xbd, 0x92, 0xa1, 0xa4, 0x9e, 0xbd, 0xbc, 0x9b, 0xa9, 0xb1, 0x9b, 0x92, 0x02, 0x06, 0x2f, 0x36, 0x3b, 0x3c, 0x3c, 0x3b, 0x37, 0x2e, 0x2e, 0x28, 0x32, 0x2f, 0x0f, 0x06, 0x06, 0x06, 0x07, 0x0b, 0x15, 0x46, 0x3e, 0x41, 0x49, 0x47, 0x47, 0x50, 0x49, 0x49, 0x49, 0x41, 0x4d, 0x35, 0x5d, 0x57, 0xd8, 0xee, 0xee, 0xee, 0xe2, 0xe7, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0xf5, 0xf5, 0xec, 0xec, 0xec, 0x90, 0x01, 0x01, 0x65, 0x01, 0x01, 0x90, 0xed, 0x90, 0x01, 0x65, 0xff, 0x5d, 0x45, 0x4b, 0x3d, 0x3f, 0x49, 0x47, 0x4d, 0x4a, 0x18, 0x80, 0xb5, 0xb8, 0xb4, 0xb3, 0xb6, 0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xb2, 0xb2, 0xb1, 0xb1, 0xb3, 0xb4, 0xb5, 0xb3, 0xfa, 0xad, 0x10, 0x22, 0x52, 0x3e, 0x40, 0x47, 0x47, 0x49, 0x41, 0x46, 0x4e, 0x33, 0x5d, 0x65, 0xf5, 0xed, 0xed, 0x65, 0x01, 0x01, 0x01, 0xed, 0x90, 0x01, 0x90, 0xed, 0x90, 0x01, 0x01, 0xed, 0x65, 0x65, 0x65, 0x65, 0xed, 0x01, 0xed, 0xed, 0x90, 0x90, 0xec, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x5f, 0x3a, 0x56, 0x56, 0x58, 0x4e, 0x52, 0x4c, 0x56, 0x27, 0xf9, 0xf9, 0xb8, 0xb4, 0xb6, 0xb6, 0xb5, 0xb4, 0xb4, 0xb1, 0xb4, 0xb4, 0xb5, 0xb2, 0xb4, 0xb6, 0xb4, 0xb2, 0xb2, 0xb0, 0xd7, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x63, 0x5f, 0x35, 0x3d, 0x46, 0x3a, 0x15, 0x07, 0x09, 0x0b, 0x0e, 0x1d, 0x14, 0x14, 0x12, 0x1e, 0x58, 0x58, 0x36, 0x24, 0x36, 0x28, 0x34, 0x36, 0x3a, 0x27, 0xc2, 0xa2, 0x92, 0x92, 0x92, 0xaa, 0xb5, 0x92, 0x92, 0x91, 0xb4, 0x9a, 0xb0, 0x9a, 0x98, 0xc7, 0xa4, 0x00, 0xa1, 0xe4, 0x9d, 0x92, 0x93, 0xa4, 0x92, 0xa1, 0xa1, 0x93, 0x9f, 0xa4, 0x93, 0xab, 0xb8, 0x93, 0x95, 0x03, 0x06, 0x2f, 0x36, 0x3c, 0x42, 0x3c, 0x3c, 0x3b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2f, 0x0f, 0x06, 0x04, 0x06, 0x07, 0x0c, 0x1a, 0x36, 0x3e, 0x50, 0x47, 0x47, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x3a, 0x5d, 0xf4, 0xee, 0xdd, 0xee, 0xe2, 0xe2, 0xf0, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xf5, 0xed, 0xed, 0x01, 0xed, 0xed, 0xec, 0xed, 0x01, 0x01, 0x01, 0xed, 0xec, 0xec, 0x90, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0x65, 0x64, 0x60, 0x4f, 0x51, 0x43, 0x36, 0x47, 0x40, 0x36, 0x48, 0x22, 0x1b, 0xb9, 0xb5, 0xb3, 0xb4, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xb2, 0xb3, 0xb2, 0xb3, 0xb2, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb4, 0xb2, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb6, 0xb5, 0x0d, 0x13, 0x2c, 0x52, 0x40, 0x40, 0x47, 0x50, 0x41, 0x47, 0x4d, 0x3a, 0x4f, 0xff, 0x65, 0x90, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x90, 0x90, 0x90, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0xf5, 0xed, 0x01, 0xec, 0x90, 0x90, 0xec, 0xec, 0x90, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x62, 0x51, 0x48, 0x5c, 0x56, 0x52, 0x56, 0x52, 0x4e, 0x18, 0xfa, 0xf9, 0xb8, 0xb4, 0xb4, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb5, 0xb4, 0xb4, 0xb4, 0xb5, 0xb2, 0xb2, 0xb0, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x64, 0x5e, 0x2f, 0x46, 0x3d, 0x3a, 0x11, 0x71, 0x09, 0x0b, 0x0e, 0x14, 0x14, 0x12, 0x12, 0x1c, 0x58, 0x52, 0x3f, 0x24, 0x2b, 0x36, 0x2e, 0x36, 0x3a, 0x27, 0x20, 0xa1, 0x92, 0x92, 0x92, 0xa4, 0xc3, 0xb1, 0xa1, 0x92, 0x9b, 0x92, 0xbc, 0x9e, 0xa4, 0xdd, 0xc5, 0x93, 0x92, 0xe1, 0xc1, 0xa9, 0x9a, 0x91, 0x92, 0xa4, 0x9e, 0x92, 0x92, 0x92, 0x91, 0xae, 0xb8, 0x9a, 0x95, 0x03, 0x06, 0x2f, 0x36, 0x3b, 0x3c, 0x3c, 0x37, 0x3e, 0x34, 0x28, 0x31, 0x31, 0x32, 0x11, 0x04, 0x04, 0x05, 0x07, 0x0e, 0x24, 0x3f, 0x47, 0x49, 0x47, 0x49, 0x50, 0x47, 0x50, 0x49, 0x49, 0x49, 0x4d, 0x45, 0x5b, 0xfd, 0xe6, 0xe6, 0xe2, 0xe2, 0xe7, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x65, 0x65, 0xf5, 0x65, 0x01, 0xf5, 0xf5, 0xed, 0xed, 0xf5, 0xed, 0xed, 0xed, 0xed, 0xed, 0x90, 0xec, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0xfe, 0x57, 0x51, 0x48, 0x3d, 0x46, 0x36, 0x46, 0x3d, 0x45, 0x18, 0xba, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xb5, 0xb4, 0xb3, 0xb3, 0xb1, 0xb7, 0xfa, 0xf9, 0x17, 0x3a, 0x46, 0x47, 0x36, 0x50, 0x47, 0x47, 0x47, 0x4e, 0x45, 0x5b, 0x64, 0x01, 0x01, 0xf5, 0xed, 0x01, 0xec, 0x90, 0xed, 0xed, 0xed, 0xf5, 0x01, 0x01, 0xed, 0xec, 0xec, 0xec, 0xec, 0x01, 0x01, 0x01, 0xf5, 0xed, 0xf5, 0xf5, 0xed, 0x90, 0x90, 0xeb, 0xec, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x62, 0x5d, 0x3a, 0x56, 0x58, 0x58, 0x52, 0x4e, 0x45, 0x1b, 0xf9, 0xb5, 0xb5, 0xb6, 0xb4, 0xb6, 0xb6, 0xb2, 0xb6, 0xb4, 0xb6, 0xb2, 0xb6, 0xb2, 0xb6, 0xb4, 0xb4, 0xb2, 0xb2, 0xb0, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x64, 0x5f, 0x35, 0x36, 0x4d, 0x43, 0x11, 0x0b, 0x0b, 0x0e, 0x12, 0x12, 0x84, 0x12, 0x84, 0x1e, 0x58, 0x58, 0x40, 0x24, 0x2b, 0x2b, 0x2e, 0x36, 0x48, 0x27, 0xc3, 0xa1, 0x92, 0x92, 0x92, 0xaa, 0xbb, 0xb0, 0xbc, 0x9b, 0x93, 0x93, 0xcf, 0xb8, 0xac, 0xcd, 0xbd, 0x93, 0x93, 0xdb, 0xb8, 0xae, 0xa4, 0x92, 0x92, 0xa4, 0xa1, 0x91, 0x92, 0x92, 0x91, 0xaf, 0xb8, 0x93, 0x95, 0x02, 0x06, 0x2f, 0x36, 0x39, 0x3b, 0x3b, 0x37, 0x3f, 0x28, 0x28, 0x38, 0x31, 0x32, 0x11, 0x06, 0x68, 0x06, 0x07, 0x0e, 0x2a, 0x40, 0x47, 0x3e, 0x49, 0x47, 0x49, 0x47, 0x50, 0x49, 0x49, 0x49, 0x46, 0x45, 0x5b, 0xfd, 0xe6, 0xe4, 0xe2, 0xe4, 0xe9, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x65, 0x65, 0xf5, 0xf5, 0xec, 0xf5, 0xed, 0xf5, 0xed, 0xed, 0xf5, 0xec, 0x65, 0xec, 0xed, 0xed, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x5b, 0x53, 0x48, 0x3d, 0x46, 0x3f, 0x3f, 0x3d, 0x3a, 0x27, 0xf9, 0xb4, 0xb1, 0xb3, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb1, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb2, 0xb3, 0xb2, 0xb3, 0xb2, 0xb3, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb1, 0xb4, 0xb5, 0xb4, 0xb4, 0xb3, 0xb1, 0xb3, 0xb5, 0x0d, 0x22, 0x48, 0x4d, 0x40, 0x40, 0x4d, 0x49, 0x40, 0x4d, 0x48, 0x44, 0x61, 0x65, 0x65, 0xed, 0xf5, 0xed, 0xed, 0xed, 0xed, 0xed, 0xec, 0xed, 0x01, 0xec, 0xe6, 0xdd, 0xcc, 0xc7, 0xc4, 0xcc, 0xd8, 0xe7, 0xed, 0x01, 0xec, 0x90, 0x01, 0xec, 0x01, 0xed, 0xec, 0xec, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x65, 0x65, 0x65, 0x63, 0x60, 0x45, 0x56, 0x5c, 0x58, 0x56, 0x4e, 0x45, 0xfa, 0xfa, 0xb2, 0xb9, 0xb5, 0xb4, 0xb6, 0xb4, 0xb6, 0xb5, 0xb6, 0xb2, 0xb6, 0xb4, 0xb4, 0xb3, 0xb6, 0xb2, 0xb4, 0xb2, 0xb0, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x63, 0x5e, 0x35, 0x40, 0x36, 0x3d, 0x12, 0x0b, 0x0e, 0x15, 0x0e, 0x12, 0x12, 0x14, 0x12, 0x23, 0x49, 0x58, 0x3e, 0x28, 0x2e, 0x34, 0x31, 0x36, 0x48, 0x1b, 0xc4, 0x9f, 0x95, 0x92, 0x96, 0xb0, 0xab, 0x94, 0xaa, 0x9b, 0xaa, 0x9b, 0xca, 0xb8, 0x9b, 0x9b, 0x92, 0x00, 0xa4, 0xdd, 0x93, 0x92, 0x92, 0x96, 0x92, 0xa7, 0x9f, 0x91, 0x93, 0x92, 0x92, 0xb1, 0xb7, 0x98, 0x95, 0x02, 0x07, 0x3a, 0x32, 0x37, 0x3b, 0x3b, 0x37, 0x39, 0x2b, 0x2e, 0x31, 0x31, 0x32, 0x17, 0x06, 0x03, 0x05, 0x07, 0x0e, 0x24, 0x40, 0x47, 0x49, 0x49, 0x49, 0x50, 0x47, 0x50, 0x49, 0x49, 0x50, 0x3d, 0x4f, 0xfc, 0xf4, 0xe4, 0xe2, 0xdd, 0xe7, 0xec, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xed, 0xf5, 0x65, 0xec, 0xff, 0xec, 0x01, 0x01, 0x01, 0x90, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0xed, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x60, 0x45, 0x51, 0x3d, 0x43, 0x3f, 0x3f, 0x46, 0x3a, 0x18, 0xba, 0xb1, 0xb1, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb3, 0xb4, 0xb1, 0xb4, 0xb1, 0xb3, 0xb1, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb2, 0xb3, 0xb2, 0xb3, 0xb2, 0xb4, 0xb4, 0xb1, 0xb4, 0xb4, 0xb5, 0xb3, 0xb7, 0xb1, 0xb6, 0xf9, 0x10, 0x22, 0x4e, 0x4d, 0x40, 0x46, 0x46, 0x47, 0x47, 0x52, 0x3a, 0x55, 0x63, 0x65, 0x65, 0xf5, 0xed, 0xed, 0x90, 0xed, 0xed, 0xed, 0x01, 0x90, 0xe7, 0xc7, 0xba, 0xb4, 0xae, 0xae, 0xac, 0xab, 0xb5, 0xba, 0xd8, 0x90, 0x01, 0x90, 0xed, 0xed, 0xf5, 0xed, 0xf5, 0xec, 0xec, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0x01, 0x64, 0x62, 0x45, 0x4e, 0x56, 0x58, 0x56, 0x4b, 0x45, 0xf3, 0xf9, 0xb5, 0xb5, 0xb6, 0xb4, 0xb4, 0xb6, 0xb2, 0xb6, 0xb5, 0xb6, 0xb4, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb2, 0xb2, 0xae, 0xd1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x63, 0x5e, 0x2a, 0x34, 0x39, 0x4c, 0x14, 0x0e, 0x12, 0x12, 0x12, 0x12, 0x12, 0x14, 0x12, 0x23, 0x58, 0x49, 0x49, 0x2e, 0x2e, 0x3b, 0x31, 0x36, 0x3a, 0x1b, 0xc4, 0xa1, 0x95, 0x95, 0x95, 0xb6, 0xc4, 0xa2, 0xba, 0x9b, 0xb2, 0xac, 0xcc, 0x9d, 0xa4, 0xbe, 0xa1, 0x94, 0xbd, 0xdd, 0x92, 0x91, 0xa7, 0x9e, 0x96, 0xb6, 0xa6, 0x91, 0x92, 0x96, 0x91, 0xb8, 0xb8, 0x93, 0x02, 0x02, 0x07, 0x35, 0x3d, 0x39, 0x3b, 0x3b, 0x3e, 0x34, 0x2e, 0x2e, 0x31, 0x2e, 0x35, 0x17, 0x06, 0x68, 0x05, 0x71, 0x0e, 0x24, 0x47, 0x47, 0x49, 0x49, 0x49, 0x49, 0x50, 0x50, 0x49, 0x49, 0x49, 0x3d, 0x45, 0xf4, 0xe2, 0xe6, 0xe4, 0xe2, 0xe8, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0xf5, 0xed, 0xed, 0xeb, 0x01, 0x01, 0xed, 0xec, 0xec, 0xeb, 0x90, 0xed, 0x01, 0xed, 0xec, 0xf5, 0x01, 0x01, 0x01, 0xed, 0xf5, 0xec, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0xfe, 0x4f, 0x53, 0x3d, 0x3d, 0x3f, 0x3f, 0x3d, 0x3a, 0x27, 0xf9, 0xb3, 0xb1, 0xb4, 0xb4, 0xb3, 0xb4, 0xb1, 0xb4, 0xb3, 0xb3, 0xb4, 0xb3, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb4, 0xb2, 0xb3, 0xb2, 0xb3, 0xb2, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb1, 0xb4, 0xb5, 0xb4, 0xb4, 0xb1, 0xb1, 0xb3, 0xf9, 0x13, 0x2c, 0x4e, 0x4d, 0x40, 0x46, 0x47, 0x47, 0x4d, 0x56, 0x3a, 0x5d, 0x64, 0x65, 0xf5, 0xf5, 0x65, 0xed, 0xed, 0x90, 0x90, 0x01, 0xeb, 0xd8, 0xbd, 0xb0, 0xa9, 0xac, 0xac, 0xaf, 0xac, 0xac, 0xaa, 0xac, 0xad, 0xc4, 0xec, 0x01, 0x01, 0xed, 0xeb, 0x01, 0x01, 0xec, 0xeb, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x63, 0x55, 0x48, 0x56, 0x5c, 0x56, 0x4e, 0x45, 0xfa, 0xf9, 0xb5, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb6, 0xb2, 0xb6, 0xb2, 0xb4, 0xb6, 0xb1, 0xb4, 0xb6, 0xb1, 0xb4, 0xb2, 0xb0, 0xcc, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xf5, 0x64, 0x54, 0x1a, 0x2b, 0x58, 0x52, 0x12, 0x0e, 0x12, 0x12, 0x12, 0x14, 0x12, 0x14, 0x12, 0x28, 0x49, 0x58, 0x41, 0x2e, 0x2e, 0x37, 0x2e, 0x32, 0x45, 0x2d, 0xc4, 0x9f, 0x00, 0x94, 0x92, 0x97, 0xa5, 0xb9, 0xd3, 0x9f, 0xa5, 0xb0, 0xb6, 0x91, 0xa5, 0xe7, 0xe8, 0xa5, 0xa1, 0xb6, 0xb6, 0xcc, 0xd7, 0x91, 0x9b, 0xc3, 0xbd, 0x96, 0x91, 0x91, 0x92, 0xba, 0xb2, 0x95, 0x02, 0x02, 0x09, 0x3a, 0x36, 0x39, 0x41, 0x41, 0x3b, 0x34, 0x2e, 0x2e, 0x2e, 0x31, 0x36, 0x17, 0x06, 0x05, 0x71, 0x06, 0x0e, 0x24, 0x3e, 0x3e, 0x49, 0x49, 0x49, 0x49, 0x50, 0x49, 0x50, 0x49, 0x50, 0x48, 0x4f, 0xf4, 0xf4, 0xe4, 0xe6, 0xe6, 0xeb, 0x01, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xf5, 0xed, 0xed, 0xed, 0x01, 0xec, 0xe7, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0xd8, 0xe7, 0x90, 0x01, 0x90, 0xec, 0xed, 0x01, 0xed, 0xed, 0xec, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x63, 0x57, 0x51, 0x4b, 0x3d, 0x3f, 0x3e, 0x46, 0x35, 0x27, 0xb5, 0xb1, 0xb7, 0xb4, 0xb4, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb3, 0xb4, 0xb1, 0xb4, 0xb1, 0xb3, 0xb1, 0xb3, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xb2, 0xb4, 0xb2, 0xb4, 0xb1, 0xb4, 0xb4, 0xb2, 0xb6, 0xb4, 0xb7, 0xb1, 0xb5, 0xf9, 0x18, 0x3a, 0x4c, 0x4d, 0x40, 0x46, 0x46, 0x47, 0x4d, 0x56, 0x45, 0x61, 0x64, 0xf5, 0xf5, 0xed, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x90, 0xd8, 0xb8, 0xa7, 0xaf, 0xb1, 0xaf, 0xaf, 0xa9, 0xac, 0xa9, 0xac, 0xae, 0xaa, 0xa5, 0xc7, 0xed, 0x01, 0xec, 0xed, 0xed, 0x01, 0xf5, 0xec, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0x01, 0x63, 0x5d, 0x3a, 0x56, 0x58, 0x56, 0x56, 0x33, 0xfa, 0xb5, 0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb4, 0xb6, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xb2, 0xb4, 0xb2, 0xae, 0xd1, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x90, 0x65, 0x5d, 0x21, 0x3d, 0x5c, 0x52, 0x14, 0x0e, 0x12, 0x12, 0x14, 0x12, 0x12, 0x12, 0x14, 0x1e, 0x58, 0x58, 0x41, 0x2e, 0x28, 0x34, 0x36, 0x35, 0x3a, 0x1b, 0x20, 0xaa, 0x9d, 0x9a, 0x93, 0x92, 0x9a, 0x9b, 0x9b, 0x92, 0x9b, 0x93, 0x92, 0x92, 0x92, 0xa4, 0xae, 0x93, 0x91, 0x93, 0x9b, 0x9b, 0x9b, 0x93, 0x93, 0x9a, 0x9b, 0x92, 0x92, 0x98, 0x8e, 0xf9, 0x0a, 0x02, 0x02, 0x02, 0x0e, 0x48, 0x40, 0x39, 0x3b, 0x3b, 0x3e, 0x37, 0x2e, 0x37, 0x31, 0x37, 0x32, 0x15, 0x09, 0x06, 0x06, 0x07, 0x0e, 0x23, 0x47, 0x50, 0x49, 0x49, 0x49, 0x49, 0x50, 0x50, 0x49, 0x50, 0x50, 0x48, 0x4f, 0xf4, 0xe2, 0xe4, 0xe6, 0xe7, 0xec, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0xec, 0xed, 0xed, 0xec, 0xec, 0xea, 0xcc, 0xb9, 0xb0, 0xab, 0xa7, 0xab, 0xae, 0xab, 0xb2, 0xc4, 0xe6, 0x90, 0xed, 0x90, 0xed, 0x01, 0x01, 0xed, 0xf5, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x5b, 0x51, 0x51, 0x36, 0x3f, 0x3f, 0x46, 0x48, 0x18, 0xfa, 0xb1, 0xb1, 0xb4, 0xb4, 0xb3, 0xb4, 0xb1, 0xb4, 0xb3, 0xb4, 0xb4, 0xb3, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb4, 0xb5, 0xb4, 0xb1, 0xb4, 0xb6, 0xfa, 0x18, 0x3a, 0x4c, 0x46, 0x47, 0x46, 0x4d, 0x4d, 0x52, 0x48, 0x53, 0x62, 0x65, 0x65, 0xf5, 0x01, 0x65, 0xed, 0xed, 0x01, 0x01, 0xe2, 0xb8, 0xac, 0xac, 0xa9, 0xaf, 0xa8, 0xa9, 0xa9, 0xa9, 0xaf, 0xa9, 0xa7, 0xb1, 0xae, 0xaa, 0xcc, 0xec, 0x01, 0x01, 0xed, 0x01, 0xed, 0xf5, 0xec, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0x65, 0x5d, 0x45, 0x56, 0x5c, 0x56, 0x56, 0x2c, 0xfa, 0xf9, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb6, 0xb1, 0xb2, 0xb2, 0xae, 0xd1, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0xf5, 0x60, 0x55, 0x5a, 0x56, 0x46, 0x24, 0x14, 0x12, 0x14, 0x14, 0x12, 0x14, 0x14, 0x12, 0x1e, 0x58, 0x58, 0x46, 0x24, 0x24, 0x2b, 0x32, 0x3d, 0x45, 0x17, 0xf3, 0x08, 0xf2, 0xf2, 0xf2, 0xf2, 0x8e, 0xf2, 0xf2, 0xf2, 0x8e, 0xf7, 0x8e, 0xf2, 0x8e, 0xf1, 0xf1, 0xf1, 0x94, 0x8e, 0x9c, 0x95, 0xf1, 0x8e, 0x9c, 0x95, 0xf1, 0x9c, 0xf7, 0x05, 0x06, 0x07, 0x04, 0x03, 0x04, 0x06, 0x26, 0x4c, 0x36, 0x3b, 0x3b, 0x41, 0x3b, 0x34, 0x2e, 0x34, 0x2e, 0x3b, 0x39, 0x46, 0x25, 0x21, 0x25, 0x26, 0x2b, 0x52, 0x50, 0x3e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x50, 0x50, 0x50, 0x4d, 0x48, 0x4f, 0xf4, 0xe2, 0xdd, 0xe2, 0xe9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xf5, 0xed, 0xed, 0xec, 0xe9, 0xb8, 0xac, 0xaa, 0xae, 0xac, 0xab, 0xac, 0xaa, 0xab, 0xab, 0xa7, 0xb5, 0xd8, 0xec, 0xec, 0xed, 0x01, 0x01, 0x01, 0xf5, 0xeb, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x5b, 0x4f, 0x48, 0x43, 0x36, 0x3e, 0x46, 0x3a, 0x27, 0xb5, 0xb1, 0xb7, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb4, 0xb6, 0xb2, 0xb6, 0xb3, 0xb6, 0xf9, 0xfa, 0x22, 0x48, 0x3d, 0x3f, 0x4d, 0x46, 0x46, 0x4d, 0x56, 0x3a, 0x59, 0x63, 0x65, 0xf5, 0xed, 0x01, 0xed, 0xec, 0x90, 0x01, 0xe9, 0xc2, 0xa7, 0xac, 0xa9, 0xaf, 0xa9, 0xa8, 0x9e, 0x9e, 0xa4, 0xac, 0xa9, 0xa4, 0xa7, 0xac, 0xa5, 0xb2, 0xe7, 0x01, 0xec, 0xed, 0xed, 0x01, 0xf5, 0xec, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x65, 0x60, 0x3a, 0x56, 0x5c, 0x56, 0x4e, 0x33, 0x0d, 0xb2, 0xb5, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb1, 0xb6, 0xb3, 0xb2, 0xb4, 0xb2, 0xb0, 0xcc, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x90, 0x01, 0x63, 0x5f, 0x51, 0x4c, 0x52, 0x58, 0x52, 0x52, 0x4d, 0x4d, 0x46, 0x3f, 0x3f, 0x36, 0x46, 0x58, 0x52, 0x46, 0x3d, 0x32, 0x32, 0x36, 0x3d, 0x4c, 0x45, 0x45, 0x4f, 0x45, 0x4f, 0x45, 0x4f, 0x45, 0x45, 0x4f, 0x45, 0x4f, 0x45, 0x45, 0x45, 0x45, 0x45, 0x33, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x33, 0x45, 0x33, 0x45, 0x33, 0x45, 0x33, 0x33, 0x3a, 0x33, 0x3a, 0x45, 0x48, 0x4e, 0x46, 0x3e, 0x3e, 0x3b, 0x3b, 0x3e, 0x3e, 0x36, 0x37, 0x3b, 0x42, 0x49, 0x47, 0x52, 0x4c, 0x56, 0x4d, 0x50, 0x50, 0x50, 0x49, 0x50, 0x49, 0x49, 0x49, 0x50, 0x50, 0x50, 0x50, 0x52, 0x3a, 0x57, 0xe2, 0xe4, 0xe4, 0xe6, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xec, 0x01, 0xeb, 0x01, 0xef, 0xae, 0xaa, 0xac, 0xae, 0xae, 0xae, 0xae, 0xac, 0xab, 0xac, 0xa6, 0xae, 0xab, 0xb0, 0xd1, 0xec, 0xec, 0xec, 0xed, 0xed, 0x01, 0xec, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0xfe, 0x44, 0x4b, 0x3d, 0x3f, 0x3f, 0x36, 0x48, 0x18, 0xb5, 0xb1, 0xb1, 0xb6, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb1, 0xb4, 0xb2, 0xb4, 0xb2, 0xb4, 0xb5, 0xf9, 0xfa, 0x2c, 0x3a, 0x52, 0x46, 0x47, 0x46, 0x4d, 0x4c, 0x56, 0x3a, 0x5f, 0x64, 0x65, 0xec, 0xf5, 0x01, 0xf5, 0xed, 0x01, 0xed, 0xee, 0xb2, 0xa7, 0xac, 0xac, 0xa8, 0xa1, 0x9e, 0xa4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xac, 0xa5, 0xa5, 0xc3, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xf5, 0xec, 0xf5, 0x65, 0x01, 0x01, 0x01, 0xed, 0x01, 0x65, 0x61, 0x45, 0x4e, 0x5c, 0x56, 0x4e, 0x2c, 0xf9, 0xb5, 0xb6, 0xb6, 0xb3, 0xb3, 0xb4, 0xb4, 0xb6, 0xb2, 0xb4, 0xb2, 0xb4, 0xb1, 0xb8, 0xae, 0xb6, 0xb4, 0xb4, 0xb2, 0xb0, 0xd8, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x64, 0x5f, 0x51, 0x48, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x50, 0x52, 0x58, 0x52, 0x4c, 0x43, 0x56, 0x4c, 0x52, 0x58, 0x52, 0x56, 0x4e, 0x56, 0x56, 0x4e, 0x56, 0x4e, 0x4e, 0x56, 0x4e, 0x56, 0x4e, 0x56, 0x4e, 0x56, 0x4e, 0x56, 0x56, 0x4e, 0x56, 0x4e, 0x56, 0x4e, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x4e, 0x56, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x56, 0x52, 0x47, 0x3e, 0x3b, 0x3b, 0x3e, 0x3e, 0x3f, 0x40, 0x46, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x50, 0x49, 0x50, 0x49, 0x49, 0x50, 0x49, 0x49, 0x49, 0x49, 0x50, 0x50, 0x50, 0x50, 0x4d, 0x45, 0x57, 0xfd, 0xe4, 0xe4, 0xe6, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0x01, 0xed, 0x01, 0xe7, 0xba, 0xa5, 0xae, 0xac, 0xac, 0xac, 0xac, 0xab, 0xac, 0xae, 0xab, 0xa7, 0xa5, 0xaa, 0xa7, 0xb2, 0xd8, 0xec, 0xed, 0xed, 0x01, 0x01, 0x01, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xfe, 0x4f, 0x51, 0x3d, 0x3f, 0x40, 0x3d, 0x3a, 0x1b, 0xb5, 0xb1, 0xb1, 0xb6, 0xb6, 0xb4, 0xb4, 0xb3, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb3, 0xb3, 0xb4, 0xb2, 0xb6, 0xb4, 0xb4, 0xb5, 0xf9, 0x13, 0x2c, 0x48, 0x4c, 0x3f, 0x46, 0x46, 0x4d, 0x4c, 0x4e, 0x45, 0x60, 0x64, 0xed, 0xec, 0xed, 0x01, 0xf5, 0x01, 0x01, 0xf0, 0xc7, 0xab, 0xac, 0xac, 0xa9, 0xa9, 0xa4, 0xa4, 0xa5, 0x8f, 0xaa, 0xa5, 0xa7, 0xa7, 0xa9, 0xa7, 0xa7, 0xa5, 0xb2, 0xe9, 0x01, 0xed, 0xed, 0x01, 0x01, 0xf5, 0xf5, 0xf5, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x65, 0x62, 0x51, 0x48, 0x5c, 0x56, 0x5a, 0x22, 0xf9, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb1, 0xb4, 0xae, 0xb1, 0xb9, 0xae, 0xb2, 0xb2, 0xb0, 0xd8, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0x64, 0x61, 0x53, 0x3d, 0x52, 0x58, 0x58, 0x50, 0x58, 0x58, 0x49, 0x58, 0x49, 0x58, 0x50, 0x58, 0x52, 0x4c, 0x56, 0x58, 0x56, 0x58, 0x58, 0x50, 0x50, 0x50, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x4d, 0x52, 0x4d, 0x46, 0x46, 0x46, 0x4d, 0x4d, 0x52, 0x4c, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x52, 0x52, 0x4d, 0x52, 0x4d, 0x52, 0x4d, 0x4d, 0x46, 0x4c, 0x4d, 0x46, 0x40, 0x47, 0x49, 0x3e, 0x49, 0x3e, 0x50, 0x47, 0x52, 0x50, 0x50, 0x49, 0x49, 0x42, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x50, 0x49, 0x50, 0x49, 0x49, 0x50, 0x50, 0x47, 0x47, 0x4d, 0x4c, 0x53, 0x5b, 0xe6, 0xe4, 0xe2, 0xe8, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xbd, 0xa2, 0xaa, 0xae, 0xae, 0xac, 0xab, 0xae, 0xb2, 0xac, 0xab, 0xac, 0xb0, 0xa7, 0xa1, 0xa7, 0xa6, 0xba, 0xe7, 0xec, 0xed, 0xed, 0xed, 0x01, 0xec, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x55, 0x51, 0x43, 0x36, 0x3f, 0x3d, 0x3a, 0x1b, 0xb5, 0xb1, 0xb1, 0xb6, 0xb2, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb1, 0xb3, 0xb1, 0xb3, 0xb1, 0xb3, 0xb1, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xb2, 0xb3, 0xb2, 0xb4, 0xb3, 0xb3, 0xb4, 0xb4, 0xb2, 0xb6, 0xb2, 0xb5, 0xf9, 0x18, 0x33, 0x4c, 0x4d, 0x40, 0x46, 0x4d, 0x4c, 0x56, 0x48, 0x45, 0x61, 0x01, 0xed, 0xec, 0xed, 0x01, 0xf5, 0xed, 0x01, 0xe6, 0xba, 0xa7, 0xac, 0xa9, 0xa9, 0x8f, 0x8f, 0x8f, 0x75, 0xf2, 0x8f, 0xa6, 0xaa, 0xaa, 0xa9, 0xa7, 0xa7, 0xa7, 0xa2, 0xd1, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xec, 0xf5, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x65, 0x62, 0x4f, 0x4e, 0x56, 0x5a, 0x53, 0x22, 0xf9, 0xb2, 0xb2, 0xb6, 0xb3, 0xb4, 0xb4, 0xb6, 0xb6, 0xb5, 0xb6, 0xb2, 0xb1, 0xb1, 0xb8, 0xb6, 0xb2, 0xb0, 0xb6, 0xb0, 0xb6, 0xe6, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x65, 0x64, 0x65, 0x62, 0x5f, 0x51, 0x4d, 0x58, 0x50, 0x52, 0x50, 0x50, 0x58, 0x49, 0x58, 0x50, 0x50, 0x52, 0x46, 0x4c, 0x56, 0x56, 0x52, 0x52, 0x50, 0x58, 0x50, 0x50, 0x52, 0x52, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x50, 0x4d, 0x47, 0x4d, 0x47, 0x4d, 0x52, 0x47, 0x52, 0x47, 0x52, 0x47, 0x52, 0x50, 0x47, 0x50, 0x47, 0x50, 0x47, 0x50, 0x46, 0x47, 0x4d, 0x47, 0x47, 0x47, 0x47, 0x3f, 0x49, 0x3f, 0x47, 0x50, 0x46, 0x47, 0x3f, 0x50, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x50, 0x49, 0x50, 0x50, 0x50, 0x50, 0x49, 0x50, 0x50, 0x50, 0x52, 0x52, 0x48, 0x54, 0x5b, 0xe6, 0xdd, 0xe4, 0xe9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xeb, 0xed, 0xe7, 0x9d, 0xb2, 0xae, 0xac, 0xac, 0xaa, 0xac, 0xb0, 0xb2, 0xb0, 0xb0, 0xab, 0xad, 0xac, 0xa7, 0xa7, 0xa7, 0xaa, 0xd1, 0xec, 0xec, 0xed, 0x01, 0xed, 0xec, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x55, 0x51, 0x35, 0x3f, 0x3d, 0x35, 0x33, 0x1b, 0xb0, 0xb7, 0xb3, 0xb5, 0xb6, 0xb4, 0xb3, 0xb3, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb3, 0xb2, 0xb3, 0xb2, 0xb3, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb1, 0xb1, 0xb2, 0xb4, 0xb2, 0xb4, 0xf9, 0xfa, 0x18, 0x3a, 0x4c, 0x4d, 0x3f, 0x4d, 0x46, 0x4c, 0x56, 0x48, 0x4f, 0xfe, 0x65, 0x90, 0xec, 0x01, 0x65, 0xf5, 0x01, 0x01, 0xd8, 0xb2, 0xaa, 0xae, 0xa9, 0x8f, 0xab, 0x75, 0x75, 0x6e, 0x75, 0x75, 0x8f, 0x8f, 0xab, 0xa7, 0xa7, 0xaa, 0xa7, 0x9f, 0xc2, 0x01, 0x01, 0x01, 0xed, 0x01, 0xf5, 0xf5, 0xf5, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x65, 0x62, 0x45, 0x5a, 0x53, 0x4e, 0x59, 0x18, 0xf9, 0xb5, 0xb5, 0xb6, 0xb4, 0xb6, 0xb5, 0xb2, 0xb2, 0xb5, 0xb2, 0xb5, 0xb6, 0xb4, 0xb6, 0xb0, 0xb6, 0xba, 0xb2, 0xa6, 0xc2, 0xec, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x65, 0x64, 0x65, 0x64, 0x62, 0x53, 0x48, 0x4e, 0x52, 0x4e, 0x56, 0x56, 0x52, 0x58, 0x52, 0x52, 0x56, 0x4c, 0x56, 0x4e, 0x56, 0x56, 0x56, 0x4c, 0x52, 0x52, 0x52, 0x58, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x50, 0x52, 0x50, 0x52, 0x50, 0x52, 0x50, 0x52, 0x50, 0x52, 0x50, 0x52, 0x50, 0x52, 0x52, 0x4d, 0x52, 0x4d, 0x52, 0x52, 0x50, 0x47, 0x47, 0x3f, 0x50, 0x46, 0x50, 0x46, 0x50, 0x47, 0x47, 0x47, 0x50, 0x50, 0x49, 0x50, 0x49, 0x50, 0x50, 0x50, 0x50, 0x49, 0x50, 0x50, 0x50, 0x50, 0x50, 0x46, 0x52, 0x4d, 0x48, 0x54, 0xfc, 0xe4, 0xdd, 0xe4, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0xed, 0xed, 0xb9, 0xa0, 0xae, 0xb0, 0xab, 0xab, 0xb0, 0xb0, 0xb5, 0xb0, 0xb5, 0xb2, 0xb5, 0xa7, 0xa7, 0xac, 0xa5, 0xa3, 0xa6, 0xb9, 0xef, 0xed, 0x01, 0x01, 0x01, 0xed, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x5d, 0x51, 0x3d, 0x32, 0x43, 0x35, 0x33, 0x86, 0xb1, 0xb1, 0xb1, 0xb6, 0xb5, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb1, 0xb3, 0xb1, 0xb3, 0xb1, 0xb3, 0xb1, 0xb3, 0xb4, 0xb2, 0xb3, 0xb2, 0xb3, 0xb2, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb3, 0xb2, 0xb2, 0xb4, 0xb5, 0xf9, 0xfa, 0x22, 0x51, 0x4c, 0x4d, 0x40, 0x46, 0x4c, 0x4c, 0x56, 0x45, 0x59, 0x63, 0x01, 0x90, 0xec, 0xed, 0x01, 0xf5, 0x01, 0xec, 0xcc, 0xac, 0xae, 0xac, 0xa7, 0x8f, 0x8f, 0x6e, 0x6e, 0x6f, 0x73, 0x75, 0x76, 0x7b, 0x8f, 0xa7, 0xa7, 0xa5, 0xa7, 0xa6, 0xb8, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xec, 0xf5, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x63, 0x4f, 0x51, 0x53, 0x53, 0x4f, 0x86, 0xf9, 0xb5, 0xb4, 0xb2, 0xb2, 0xb1, 0xb2, 0xb2, 0xb0, 0xb2, 0xb0, 0xb0, 0xab, 0xac, 0xad, 0xae, 0xb0, 0xa7, 0xad, 0xb9, 0xe6, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x64, 0x62, 0x5e, 0x51, 0x3a, 0x48, 0x3a, 0x3a, 0x4b, 0x48, 0x4e, 0x3d, 0x48, 0x48, 0x48, 0x3d, 0x48, 0x56, 0x56, 0x48, 0x48, 0x4e, 0x48, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x4c, 0x4d, 0x46, 0x4d, 0x46, 0x4d, 0x4d, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x4d, 0x52, 0x4d, 0x52, 0x46, 0x52, 0x46, 0x52, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x47, 0x52, 0x47, 0x52, 0x47, 0x4d, 0x4d, 0x50, 0x52, 0x50, 0x46, 0x52, 0x46, 0x52, 0x47, 0x52, 0x47, 0x50, 0x50, 0x49, 0x49, 0x50, 0x50, 0x50, 0x50, 0x50, 0x46, 0x52, 0x4d, 0x48, 0x54, 0xf4, 0xe2, 0xe1, 0xe6, 0xec, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xe2, 0xa2, 0xb2, 0xa6, 0xac, 0xab, 0xa7, 0xb0, 0xb0, 0x8f, 0xa2, 0x8f, 0x8f, 0xb5, 0xb0, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0xb0, 0xd8, 0xec, 0x01, 0x01, 0xed, 0x01, 0xf5, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x59, 0x51, 0x2f, 0x36, 0x3d, 0x2f, 0x33, 0xf3, 0xb1, 0xb7, 0xb7, 0xf9, 0xb6, 0xb4, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb3, 0xb3, 0xb4, 0xb4, 0xb2, 0xb5, 0xf9, 0xfa, 0x27, 0x48, 0x46, 0x47, 0x47, 0x46, 0x4d, 0x4c, 0x56, 0x3a, 0x59, 0x64, 0x90, 0x90, 0xec, 0xed, 0xed, 0x65, 0x01, 0xe9, 0xc4, 0xac, 0xae, 0xa9, 0x8f, 0x8f, 0x6e, 0x73, 0x73, 0x74, 0x73, 0x73, 0x73, 0x75, 0x8f, 0xa7, 0xa7, 0xa5, 0xa6, 0xa7, 0xad, 0xe9, 0x01, 0x01, 0xed, 0x01, 0x01, 0xf5, 0xec, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x63, 0x44, 0x3a, 0x45, 0x45, 0x27, 0x0d, 0xf8, 0xb0, 0xb0, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xf9, 0xb5, 0xb5, 0xb9, 0xb8, 0xba, 0xbd, 0xbd, 0xc4, 0xc4, 0xee, 0xf0, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x90, 0x90, 0x01, 0x63, 0x62, 0x61, 0x5f, 0x5f, 0x5f, 0x5d, 0x5f, 0x59, 0x5e, 0x59, 0x59, 0x59, 0x5e, 0x59, 0x5a, 0x5e, 0x53, 0x53, 0x51, 0x54, 0x51, 0x4f, 0x51, 0x51, 0x4e, 0x51, 0x48, 0x51, 0x48, 0x51, 0x48, 0x48, 0x48, 0x3a, 0x48, 0x3a, 0x48, 0x48, 0x4e, 0x48, 0x48, 0x4e, 0x48, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x48, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x46, 0x46, 0x4c, 0x3d, 0x4c, 0x3d, 0x4b, 0x3d, 0x3d, 0x3d, 0x3d, 0x46, 0x47, 0x47, 0x47, 0x3d, 0x47, 0x46, 0x43, 0x4c, 0x3d, 0x48, 0x3a, 0x54, 0xf4, 0xe4, 0xe4, 0xe4, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xc4, 0xa2, 0xb2, 0xac, 0xaa, 0xb0, 0xad, 0xb5, 0x7b, 0xa6, 0x8d, 0x8f, 0xa0, 0xa0, 0xb5, 0xb0, 0xa7, 0xa7, 0xa7, 0xa7, 0xad, 0xc4, 0xeb, 0xed, 0xed, 0xed, 0x01, 0xec, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x63, 0x5d, 0x51, 0x35, 0x35, 0x43, 0x3a, 0x33, 0xfa, 0xb1, 0xb1, 0xb7, 0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb1, 0xb2, 0xb3, 0xb2, 0xb1, 0xb0, 0xb2, 0xae, 0xb2, 0xae, 0xb1, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xac, 0xae, 0xae, 0xb0, 0xb0, 0xb0, 0xf9, 0xfa, 0x33, 0x3a, 0x48, 0x4d, 0x46, 0x4c, 0x4c, 0x4e, 0x53, 0x3a, 0x57, 0x64, 0xed, 0x90, 0xec, 0x90, 0xed, 0x01, 0x01, 0xe9, 0xc3, 0xac, 0xac, 0xaa, 0x8f, 0x8e, 0x6e, 0x73, 0x70, 0x70, 0x70, 0x70, 0x6f, 0x75, 0x7b, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa6, 0xe7, 0x01, 0x01, 0xed, 0xed, 0x01, 0xec, 0xec, 0xed, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x64, 0x5f, 0x5d, 0x5f, 0x5d, 0x5b, 0xee, 0xee, 0xe2, 0xdd, 0xe2, 0xdd, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xeb, 0xf0, 0x90, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x90, 0x65, 0x01, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x63, 0x62, 0x63, 0x62, 0xfe, 0x60, 0x60, 0x60, 0xfe, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5d, 0x60, 0x5d, 0x60, 0x60, 0x60, 0x5f, 0x60, 0x5d, 0x5f, 0x5d, 0x5f, 0x5d, 0x5f, 0x5d, 0x5e, 0x5d, 0x5d, 0x5f, 0x5d, 0x5e, 0x5d, 0x5f, 0x5e, 0x5f, 0x59, 0x5d, 0x5e, 0x5d, 0x5e, 0x59, 0x59, 0x59, 0x59, 0x59, 0x54, 0x53, 0x54, 0x53, 0x53, 0x4f, 0x53, 0x4f, 0x4f, 0x51, 0x4f, 0x45, 0x4f, 0x45, 0x45, 0x45, 0x48, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x4f, 0xfc, 0xf4, 0xfd, 0xe2, 0xdd, 0xe6, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x01, 0xec, 0xb5, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xb0, 0x7b, 0x7b, 0x75, 0x6f, 0x6e, 0x75, 0x6e, 0x8f, 0xf9, 0xaa, 0xa7, 0xa6, 0xa6, 0xa6, 0xba, 0xe7, 0xed, 0x01, 0xed, 0x01, 0xed, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x65, 0xfe, 0x57, 0x33, 0x2c, 0x2c, 0x2c, 0x33, 0x1b, 0xf9, 0xab, 0xb0, 0xae, 0xad, 0xab, 0xb0, 0xae, 0xad, 0xae, 0xad, 0xab, 0xab, 0xab, 0xae, 0xad, 0xae, 0xad, 0xae, 0xad, 0xb0, 0xb0, 0xb0, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xb5, 0xb2, 0xf9, 0xb5, 0x0d, 0x1b, 0x27, 0x45, 0x45, 0x3a, 0x3a, 0x3a, 0x3a, 0x45, 0x4f, 0x4f, 0x5b, 0x64, 0x01, 0x90, 0x90, 0xec, 0xed, 0x01, 0x01, 0xef, 0xc3, 0xac, 0xae, 0x8f, 0x8f, 0x75, 0x6e, 0x73, 0x6d, 0x70, 0x70, 0x6d, 0x6d, 0x73, 0x7b, 0xb0, 0xa4, 0xab, 0xa7, 0xa7, 0xa6, 0xe2, 0x01, 0x01, 0x65, 0x01, 0x01, 0xed, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x65, 0x65, 0x01, 0x65, 0x65, 0xff, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xf0, 0xff, 0xef, 0xf0, 0xff, 0x65, 0x65, 0x65, 0x64, 0x65, 0x64, 0x64, 0x63, 0x64, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xfe, 0x63, 0x63, 0x62, 0xfe, 0x62, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0xfe, 0x61, 0x62, 0x61, 0x61, 0x61, 0xfe, 0x60, 0xfe, 0xfd, 0xff, 0xef, 0xf0, 0xe9, 0xe7, 0xea, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xe9, 0xb2, 0xaa, 0xaa, 0xa7, 0xab, 0xab, 0x7b, 0x75, 0x75, 0x73, 0x73, 0x73, 0x73, 0x75, 0x8f, 0xf9, 0xad, 0xa6, 0xa7, 0xa6, 0xa6, 0xb9, 0xe6, 0xed, 0x01, 0xed, 0x01, 0x01, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x65, 0xfe, 0x57, 0x27, 0x27, 0x2c, 0x44, 0x44, 0xfb, 0x20, 0xc2, 0xc3, 0xc4, 0xc3, 0xc4, 0xc9, 0xc4, 0xc9, 0xc9, 0xcc, 0xd1, 0xd1, 0xd8, 0xd1, 0xd8, 0xd8, 0xee, 0xdd, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe6, 0xe2, 0xe6, 0xe7, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xef, 0xef, 0xfd, 0x5b, 0x5b, 0x5b, 0x5d, 0x5d, 0x5d, 0x5f, 0x5d, 0x60, 0x5d, 0x5b, 0xfe, 0xf5, 0x65, 0x90, 0x01, 0x90, 0x90, 0x01, 0x01, 0xef, 0xc2, 0xae, 0xab, 0x8f, 0x8f, 0x6e, 0x6e, 0x6d, 0x6d, 0x6d, 0x70, 0x70, 0x73, 0x73, 0x7b, 0xb5, 0x8f, 0xac, 0xa7, 0xa7, 0xaa, 0xdd, 0x01, 0x01, 0x65, 0x65, 0x65, 0x65, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xfd, 0xef, 0xf5, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0xf5, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0xf0, 0xfe, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0xf0, 0xfe, 0xf0, 0xfe, 0xff, 0x64, 0x65, 0x64, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0xff, 0xf5, 0xff, 0xeb, 0xf0, 0xea, 0xe9, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xe6, 0xad, 0xa6, 0xab, 0xa7, 0xaa, 0x7b, 0xf2, 0x6e, 0x6f, 0x73, 0x73, 0x73, 0x73, 0x73, 0x75, 0xf9, 0xb0, 0xa7, 0xaa, 0xa7, 0xa0, 0xb5, 0xe2, 0x90, 0x01, 0xed, 0x01, 0xed, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x01, 0xff, 0xfe, 0x60, 0x61, 0x61, 0x62, 0x63, 0x64, 0xf5, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x64, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x63, 0xfe, 0xfe, 0xfe, 0xfd, 0x65, 0xed, 0x90, 0xed, 0x90, 0xed, 0x01, 0x01, 0xef, 0xc4, 0xae, 0xab, 0xa5, 0x75, 0x75, 0x6e, 0x69, 0x6d, 0x70, 0x6b, 0x70, 0x73, 0x70, 0x80, 0xb5, 0xa4, 0xaa, 0xa4, 0xa7, 0xa7, 0xd8, 0x01, 0x65, 0x01, 0x65, 0x01, 0xf5, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xf0, 0xe9, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xf5, 0x01, 0x01, 0x65, 0x65, 0x01, 0x01, 0x90, 0xed, 0xed, 0xec, 0xf0, 0xe7, 0xf0, 0xf0, 0xf0, 0xe9, 0xf0, 0xe9, 0xe9, 0xe9, 0xf0, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xf0, 0xef, 0xf0, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xf5, 0xff, 0xeb, 0xfe, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xe9, 0xef, 0xe7, 0xe9, 0xe9, 0xea, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xee, 0xaa, 0xa6, 0xab, 0xa7, 0xa7, 0x8f, 0x6e, 0x67, 0x6f, 0x73, 0x77, 0x73, 0x70, 0x73, 0x6e, 0x7b, 0xb5, 0xa6, 0xaa, 0xaa, 0xa2, 0xb0, 0xe2, 0xec, 0x01, 0x01, 0x01, 0xed, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0x65, 0x64, 0x64, 0x64, 0x64, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xfe, 0xef, 0xef, 0xfd, 0xe7, 0x90, 0x01, 0x90, 0x01, 0x90, 0x01, 0x01, 0x01, 0xef, 0xc4, 0xb2, 0xad, 0x8f, 0x75, 0x75, 0x6d, 0x69, 0x6d, 0x6d, 0x6d, 0x70, 0x70, 0x6e, 0x80, 0xb8, 0xa4, 0xae, 0xa4, 0xaa, 0xab, 0xd8, 0x01, 0x01, 0x65, 0x01, 0x65, 0xed, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xec, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xe9, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xeb, 0xed, 0x01, 0xed, 0xf5, 0xed, 0x90, 0x90, 0x90, 0x90, 0x90, 0xe9, 0xe7, 0xe9, 0xe9, 0xeb, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0x01, 0x01, 0x01, 0x90, 0xed, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x01, 0x90, 0x01, 0x90, 0x90, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xf0, 0xeb, 0xf0, 0xea, 0xf0, 0xe9, 0xef, 0xe9, 0xef, 0xeb, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0xd8, 0xaa, 0xa6, 0xac, 0xaa, 0x8f, 0x75, 0x67, 0x6e, 0x72, 0x72, 0x77, 0x70, 0x70, 0x70, 0x6e, 0x7b, 0xb0, 0xa7, 0xaa, 0xa7, 0xa0, 0xad, 0xd8, 0xec, 0x01, 0x01, 0x01, 0xed, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x90, 0x90, 0x01, 0x65, 0x64, 0x64, 0x64, 0x65, 0x01, 0x01, 0x01, 0x01, 0x65, 0xed, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x65, 0xeb, 0xf0, 0xf0, 0xf0, 0xeb, 0xf0, 0xf0, 0xe9, 0xeb, 0xe9, 0xe9, 0xe7, 0xe7, 0xec, 0xed, 0xed, 0xed, 0xed, 0x01, 0xed, 0x65, 0xeb, 0xc9, 0xb5, 0xb0, 0x8f, 0x75, 0x75, 0x6e, 0x6d, 0x6d, 0x6d, 0x73, 0x79, 0x6d, 0x75, 0x86, 0xab, 0xa7, 0xae, 0xac, 0xac, 0xab, 0xdd, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 
-  0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe8, 0xe7, 0xe9, 0xeb, 0xed, 0xed, 0xf5, 0xed, 0x90, 0xec, 0xed, 0x90, 0xec, 0xe7, 0xe6, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe8, 0xe9, 0xe7, 0xe9, 0xe7, 0xe9, 0xe7, 0xe9, 0xec, 0x01, 0xed, 0xed, 0x90, 0xed, 0x90, 0x90, 0x90, 0xed, 0x90, 0x90, 0xed, 0x90, 0xed, 0xed, 0x01, 0x90, 0xeb, 0xeb, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe7, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xd8, 0xad, 0xa7, 0xab, 0xa7, 0xad, 0x75, 0x6e, 0x70, 0x74, 0x72, 0x77, 0x77, 0x74, 0x73, 0x73, 0x7b, 0xb0, 0xa7, 0xa7, 0xa7, 0xa0, 0xad, 0xdd, 0xf0, 0xed, 0x01, 0x01, 0xed, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x90, 0x90, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x90, 0x01, 0x01, 0x65, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf5, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0xeb, 0xeb, 0xeb, 0xea, 0xe9, 0xe9, 0xea, 0xea, 0xe9, 0xea, 0xe9, 0xe8, 0xeb, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xf5, 0xcc, 0xb8, 0xb0, 0x8f, 0x8e, 0x75, 0x6e, 0x69, 0x6f, 0x70, 0x73, 0x6e, 0x6e, 0x80, 0xc0, 0xa4, 0xac, 0xa9, 0xaa, 0xac, 0xae, 0xe6, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0xf5, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 
-  0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0xec, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xec, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0xef, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xef, 0xe9, 0xef, 0xe7, 0xf0, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xea, 0xe9, 0xe9, 0xe7, 0xe9, 0xe7, 0xea, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xd8, 0xb0, 0xa7, 0xa7, 0xa7, 0xb0, 0x79, 0x6f, 0x74, 0x77, 0x74, 0x77, 0x7d, 0x79, 0x74, 0x7b, 0x7b, 0xad, 0xaa, 0xa7, 0xa7, 0xa2, 0xb0, 0xee, 0xeb, 0xed, 0x01, 0x01, 0xed, 0xf5, 0xed, 0x01, 0x01, 0xed, 0xed, 0x90, 0xed, 0x01, 0x01, 0x01, 0x90, 0x90, 0x90, 0x90, 0x01, 0x01, 0x01, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0xec, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe8, 0xe9, 0xe8, 0xe7, 0xeb, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xec, 0xd8, 0xbd, 0xb8, 0x8f, 0x8f, 0x75, 0x75, 0x6f, 0x6e, 0x73, 0x6f, 0x7b, 0x86, 0x86, 0x8f, 0xa5, 0xac, 0xa9, 0xac, 0xac, 0xb2, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0xec, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0xeb, 0xe7, 0xf0, 0xe9, 0xe9, 0xf0, 0xea, 0xf0, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xeb, 0xed, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0xed, 0xed, 0xf0, 0xe6, 0xfd, 0xe7, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe7, 0xef, 0xf0, 0x65, 0x01, 0x65, 0x01, 0x65, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0xf0, 0xf0, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xe9, 0xeb, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0x90, 0x01, 0xee, 0xb0, 0xaa, 0xaa, 0xaa, 0xb0, 0x7b, 0x73, 0x73, 0x74, 0x77, 0x79, 0x7e, 0x74, 0x79, 0x75, 0x80, 0xad, 0xa7, 0xaa, 0xaa, 0xa2, 0xb5, 0xe2, 0xec, 0xed, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x90, 0xeb, 0xea, 0xea, 0xeb, 0xeb, 0xea, 0xe9, 0xea, 0xe8, 0xea, 0xe9, 0xe7, 0xe9, 0xf5, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x90, 0xdd, 0xc1, 0xbb, 0xb0, 0xa6, 0x8f, 0x7b, 0x7b, 0x7b, 0x80, 0x86, 0x20, 0xc2, 0x8f, 0xa4, 0xac, 0xae, 0xac, 0xac, 0xae, 0xbd, 0xed, 0x01, 0xf5, 0xf5, 0x01, 0xed, 0x90, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xf5, 0xef, 0xef, 0xe9, 0xef, 0xf0, 0xf0, 0xeb, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xec, 0x01, 0x01, 0xed, 0xed, 0x01, 0xf5, 0xed, 0x01, 0xec, 0xef, 0xe2, 0xe6, 0xe8, 0xef, 0xe8, 0xe9, 0xe9, 0xe9, 0xe9, 0xef, 0xe7, 0xef, 0xe7, 0xef, 0xef, 0xf5, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x65, 0x65, 0x65, 0x65, 0x65, 0x01, 0x65, 0x01, 0x65, 0x65, 0x01, 0x65, 0xf0, 0xf0, 0xf0, 0xf0, 0xeb, 0xf0, 0xea, 0xeb, 0xea, 0xe9, 0xea, 0xe9, 0xe9, 0xe7, 0xea, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0xed, 0x01, 0xe6, 0xad, 0xaa, 0xab, 0xac, 0x7b, 0x80, 0x79, 0x73, 0x74, 0x74, 0x77, 0x79, 0x73, 0x79, 0x80, 0xf9, 0xab, 0xa7, 0xa7, 0xaa, 0xa0, 0xba, 0xe6, 0xf5, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xec, 0xeb, 0xe9, 0xeb, 0xea, 0xeb, 0xea, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xef, 0xef, 0xf5, 0xed, 0x65, 0xed, 0x01, 0x01, 0xed, 0x90, 0xe6, 0xc5, 0xbc, 0xbb, 0xab, 0x8f, 0xb0, 0x80, 0x80, 0xc0, 0x86, 0xb5, 0x8f, 0xa4, 0xac, 0xac, 0xac, 0xa9, 0xae, 0xac, 0xcc, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x90, 0x90, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0xf5, 0x01, 0xed, 0xef, 0xef, 0xef, 0xef, 0xeb, 0xf0, 0xf0, 0xf0, 0xf0, 0xe9, 0xe9, 0xe9, 0xef, 0xe7, 0xef, 0xf5, 0x01, 0x01, 0xf5, 0xed, 0xed, 0xed, 0x90, 0x01, 0xed, 0xea, 0xe2, 0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 0xe7, 0xe8, 0xe7, 0xe8, 0xe7, 0xe7, 0xe7, 0xe7, 0xeb, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xeb, 0xeb, 0xe9, 0xea, 0xe9, 0xe9, 0xe8, 0xea, 0x90, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0xeb, 0xb0, 0xaa, 0xaa, 0xae, 0xab, 0xc2, 0x80, 0x79, 0x73, 0x79, 0x79, 0x79, 0x79, 0x80, 0x80, 0xad, 0xa7, 0xa7, 0x8f, 0xa7, 0xa0, 0xc2, 0xe7, 0x90, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xec, 0xf0, 0xeb, 0xf0, 0xf0, 0xf0, 0xec, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xff, 0x01, 0x65, 0x01, 0x01, 0x90, 0x01, 0x90, 0xea, 0xcf, 0xbe, 0xbd, 0xbb, 0xa7, 0xa0, 0x8f, 0xab, 0x8f, 0xa5, 0xa5, 0xa7, 0xac, 0xae, 0xac, 0xac, 0xb1, 0xb1, 0xae, 0xe6, 0x01, 0xf5, 0x01, 0x65, 0xed, 0xed, 0x90, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe9, 0xe9, 0xe9, 0xe9, 0xef, 0xef, 0xec, 0x01, 0x01, 0xed, 0x90, 0x01, 0x90, 0x90, 0xed, 0xed, 0x90, 0xe8, 0xe6, 0xe4, 0xe4, 0xe6, 0xe6, 0xe8, 0xe6, 0xe8, 0xe7, 0xe6, 0xe6, 0xe7, 0xe9, 0x90, 0xed, 0x01, 0x90, 0x90, 0x01, 0xed, 0x90, 0xed, 0x01, 0x01, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x90, 0xec, 0xef, 0xf0, 0xeb, 0xff, 0xeb, 0xf0, 0xf0, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xec, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xbd, 0xa6, 0xae, 0xb0, 0xad, 0xf9, 0x80, 0x80, 0x80, 0x7b, 0x7d, 0x80, 0x86, 0x7b, 0xad, 0xad, 0xaa, 0xaa, 0xa7, 0xaa, 0xa6, 0xd1, 0xe9, 0xec, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0xf0, 0xf0, 0xf0, 0xec, 0xeb, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xef, 0xef, 0xf0, 0xed, 0x01, 0x01, 0xed, 0x90, 0x01, 0xed, 0xed, 0xdd, 0xc1, 0xbe, 0xc1, 0xae, 0xa4, 0xa4, 0xa5, 0xa5, 0xaa, 0xab, 0xa9, 0xac, 0xaf, 0xac, 0xac, 0xbb, 0xa7, 0xc5, 0xed, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0xec, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0xef, 0xef, 0xe7, 0xef, 0xf0, 0xe9, 0xf0, 0xe9, 0xf0, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe9, 0xf0, 0xf5, 0x01, 0x01, 0x90, 0xed, 0xed, 0x90, 0x90, 0x90, 0x90, 0xeb, 0xe8, 0xe4, 0xe4, 0xe4, 0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe6, 0xe7, 0xe9, 0xec, 0x90, 0x01, 0x01, 0x90, 0xed, 0x01, 0xed, 0x90, 0xed, 0xed, 0x01, 0x90, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xec, 0xe9, 0xf0, 0xf0, 0xef, 0xf0, 0xec, 0xe9, 0xe9, 0xeb, 0xe9, 0xeb, 0xe9, 0xe7, 0xe9, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0xed, 0xed, 0x01, 0xd8, 0xa6, 0xab, 0xae, 0xae, 0xab, 0xb5, 0x86, 0x80, 0x80, 0x86, 0x80, 0x80, 0x8f, 0xad, 0xab, 0xaa, 0xab, 0xac, 0xa2, 0xb0, 0xe2, 0xea, 0x01, 0xf5, 0x01, 0x01, 0x01, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xec, 0xe7, 0xef, 0xec, 0xf0, 0xef, 0xf0, 0xf0, 0xff, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xec, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0xea, 0xd1, 0xbc, 0xbb, 0xbc, 0xac, 0xa9, 0xa7, 0xac, 0xac, 0xac, 0xac, 0xaf, 0xae, 0xae, 0xb3, 0xae, 0xb6, 0xe6, 0x01, 0x01, 0x01, 0x65, 0x65, 0x01, 0xf5, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xeb, 0xef, 0xe9, 0xf0, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xf0, 0xeb, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0x01, 0xec, 0xe9, 0xe6, 0xe4, 0xe6, 0xe4, 0xe2, 0xe6, 0xe6, 0xe7, 0xeb, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9, 0xeb, 0xe9, 0xe9, 0xf0, 0xe9, 0xeb, 0xe9, 0xe9, 0xe9, 0xeb, 0xed, 0x01, 0x01, 0xed, 0xed, 0x01, 0x90, 0x01, 0x01, 0xe9, 0xb8, 0xab, 0xa7, 0xb2, 0xac, 0xad, 0xad, 0xb5, 0xf9, 0xad, 0xf9, 0x8f, 0x8f, 0xad, 0xae, 0xaa, 0xaa, 0xaa, 0xa2, 0xc3, 0xe7, 0xec, 0x01, 0xec, 0x01, 0x01, 0xed, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xf0, 0xf0, 0xea, 0xf0, 0xe9, 0xeb, 0xf0, 0xf0, 0xf0, 0xf0, 0xe9, 0xe9, 0xe7, 0xeb, 0xed, 0x01, 0xed, 0xed, 0x01, 0x01, 0x65, 0x01, 0xe6, 0xc5, 0xbb, 0xbf, 0xb7, 0xa9, 0xaf, 0xae, 0xa9, 0xac, 0xb4, 0xaf, 0xac, 0xb6, 0xb4, 0xa7, 0xd3, 0xed, 0xed, 0x01, 0x65, 0x65, 0x65, 0xf5, 0xf5, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xc9, 0xc9, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0xc2, 0xc2, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xc9, 0x20, 0xc9, 0x20, 0xc9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xc9, 0xc9, 0xc9, 0xd1, 0xd1, 0xee, 0xe6, 0xf0, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xf0, 0x90, 0x01, 0x65, 0x65, 0x65, 0x01, 0x01, 0x65, 0x01, 0xed, 0xed, 0xed, 0xec, 0xf0, 0xe7, 0xe7, 0xef, 0xef, 0xff, 0xec, 0x01, 0x01, 0x65, 0xf5, 0x65, 0x65, 0x65, 0x65, 0x01, 0x65, 0x01, 0x01, 0xff, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xec, 0xf0, 0xf5, 0xf0, 0xf5, 0xe7, 0xe9, 0xeb, 0xea, 0xe9, 0xeb, 0xeb, 0xea, 0xe9, 0xf0, 0xf0, 0xf0, 0xef, 0xe7, 0xf0, 0xec, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0x01, 0xed, 0x01, 0xc4, 0xa5, 0xac, 0xae, 0xb1, 0xae, 0xab, 0xa7, 0xf8, 0xaa, 0xf8, 0xaa, 0x8f, 0xae, 0xaa, 0xaa, 0xac, 0xa6, 0xab, 0xe2, 0xeb, 0xec, 0xed, 0xed, 0x01, 0x01, 0x01, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf0, 0xe9, 0xeb, 0xe7, 0xeb, 0xec, 0xe9, 0xf0, 0xf0, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0x90, 0x01, 0xed, 0xf5, 0x01, 0x65, 0x65, 0x01, 0x01, 0xe6, 0xc1, 0xbc, 0xbc, 0xb7, 0xaf, 0xaf, 0xb2, 0xb1, 0xae, 0xb4, 0xb8, 0xb6, 0xac, 0xc7, 0xeb, 0xed, 0xed, 0x01, 0x65, 0x65, 0x01, 0xf5, 0x01, 0xeb, 0xd1, 0xba, 0xf3, 0xba, 0xf3, 0xf3, 0xc0, 0xf3, 0xc2, 0xc2, 0xc2, 0xc2, 0x20, 0xc2, 0x20, 0x20, 0x20, 0xc9, 0x20, 0xc9, 0x20, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xd1, 0xc9, 0xd1, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0x20, 0x20, 0xc2, 0x20, 
-  0x95, 0x95, 0x94, 0x95, 0x94, 0x94, 0xf6, 0x94, 0x94, 0x94, 0x94, 0xf6, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x95, 0x95, 0xf1, 0x96, 0x9c, 0xe6, 0xec, 0xe7, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xeb, 0xea, 0xe9, 0xe9, 0xeb, 0xea, 0xe7, 0xe9, 0xeb, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xf5, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0xf5, 0xed, 0x01, 0x01, 0xff, 0x01, 0x01, 0xee, 0xa0, 0x8e, 0x8e, 0x8e, 0xf2, 0x8e, 0xf2, 0x8e, 0xf2, 0xf2, 0xf2, 0xf2, 0x9c, 0xd8, 0xec, 0xe9, 0xeb, 0xe9, 0xe9, 0xeb, 0xf0, 0xea, 0xf0, 0xea, 0xe9, 0xef, 0xe9, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0x01, 0xec, 0xb2, 0x9f, 0xbb, 0xaf, 0xaf, 0xb1, 0xb1, 0xac, 0xa7, 0xa9, 0xaa, 0xb1, 0xae, 0xaa, 0xac, 0xa7, 0xa6, 0xcc, 0xea, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xed, 0xec, 0xf5, 0xeb, 0xec, 0xeb, 0xf0, 0xf0, 0xef, 0xef, 0xfd, 0xe7, 0xfd, 0xe6, 0xfd, 0xe2, 0xe2, 0xe2, 0xee, 0xee, 0xd8, 0xee, 0xd1, 0xd1, 0xc9, 0xc9, 0x20, 0xc2, 0xf3, 0xba, 0xb5, 0xad, 0xaa, 0xf2, 0xb0, 0xe7, 0xeb, 0xeb, 0xe7, 0xec, 0xe9, 0xe9, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0x01, 0x01, 0xed, 0xed, 0x01, 0x65, 0x01, 0x01, 0xed, 0xe6, 0xca, 0xb8, 0xbb, 0xb9, 0xb4, 0xbb, 0xb9, 0xb6, 0xb9, 0xb3, 0xb5, 0xcf, 0xeb, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x65, 0x01, 0xe2, 0xa6, 0xf6, 0x8a, 0x94, 0xf6, 0x91, 0xf6, 0x94, 0xf6, 0xf6, 0x94, 0xf6, 0x94, 0x94, 0x94, 0x94, 0x95, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x01, 0xec, 0xe7, 0xef, 0xe7, 0xe9, 0xec, 0xe9, 0xe9, 0xe9, 0xea, 0xeb, 0xe9, 0xe9, 0xe7, 0xea, 0xec, 0xed, 0x01, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xec, 0xec, 0x01, 0x01, 0xed, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x01, 0xf0, 0xe9, 0xeb, 0xef, 0xeb, 0xe9, 0xf0, 0xeb, 0xf0, 0xe9, 0xe9, 0xe7, 0xeb, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0xf5, 0x01, 0xed, 0x01, 0xdb, 0xa7, 0xa7, 0xaf, 0xac, 0xa4, 0xa9, 0xac, 0xb7, 0xb3, 0xb7, 0xa4, 0xa4, 0xac, 0xaa, 0xa4, 0xba, 0xe7, 0x90, 0x01, 0x01, 0xed, 0x01, 0x01, 0xec, 0xf5, 0x90, 0xc9, 0x8e, 0xf2, 0xf2, 0xa0, 0x8e, 0xf2, 0x8e, 0xf2, 0x8e, 0xf2, 0xa0, 0xf2, 0xf2, 0xf2, 0xa0, 0x8e, 0xa0, 0x8e, 0x8e, 0x8e, 0x8e, 0x9c, 0x05, 0x9c, 0xf7, 0x9c, 0xf7, 0xf7, 0x99, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x95, 0x02, 0x95, 0x95, 0x02, 0x95, 0x95, 0xf6, 0x94, 0xf6, 0xf6, 0x94, 0x91, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x94, 0xc2, 0xec, 0xef, 0xe9, 0xf0, 0xe9, 0xf0, 0xe9, 0xeb, 0xf0, 0xeb, 0xe9, 0xe9, 0xef, 0xeb, 0xf5, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xe6, 0xd8, 0xba, 0xb2, 0xad, 0xb2, 0xb2, 0xb0, 0xb2, 0xbe, 0xee, 0xeb, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xec, 0xed, 0xed, 0x01, 0xc9, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0xf6, 0xc9, 0x01, 0xe6, 0xef, 0xeb, 0xef, 0xec, 0xeb, 0xe9, 0xeb, 0xea, 0xe9, 0xea, 0xe7, 0xe9, 0xe7, 0xea, 0x90, 0x90, 0x01, 0xed, 0x90, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x01, 0xed, 0xf5, 0x01, 0xed, 0x01, 0xe2, 0x94, 0x00, 0x91, 0x8a, 0x8a, 0x91, 0xf6, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0xe2, 0x01, 0xe6, 0xec, 0xe9, 0xf0, 0xf0, 0xeb, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xec, 0x01, 0x01, 0x01, 0x65, 0xf5, 0xf5, 0x01, 0xec, 0x01, 0x65, 0xcf, 0xa1, 0xb3, 0xb7, 0xb7, 0xa9, 0xa9, 0xa9, 0xa4, 0xa1, 0xaf, 0xb6, 0xae, 0xa5, 0xbd, 0xe9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xee, 0x90, 0xf0, 0xe9, 0xf0, 0xe9, 0xf0, 0xe9, 0xf0, 0xe9, 0xf0, 0xe9, 0xe9, 0xef, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xec, 0xe9, 0xdd, 0xc9, 0xc3, 0xc4, 0xd7, 0xe8, 0xed, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xf0, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf6, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0xf1, 0xee, 0x01, 0xef, 0xe7, 0xe9, 0xe7, 0xeb, 0xeb, 0xea, 0xf0, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xe9, 0xf0, 0x90, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0xed, 0x01, 0xeb, 0xf2, 0x00, 0xf6, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8e, 0x01, 0xe7, 0xef, 0xeb, 0xef, 0xea, 0xe9, 0xf0, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xeb, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xec, 0x01, 0xed, 0xd7, 0xa4, 0xa3, 0xae, 0xbb, 0xb3, 0xae, 0xb7, 0xb6, 0xb6, 0xa4, 0xa5, 0xc4, 0xe9, 0x01, 0x01, 0x01, 0x90, 0xed, 0x01, 0x01, 0x01, 0xeb, 0x01, 0xe2, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xf6, 0x91, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0xf8, 0xe9, 0xeb, 0xef, 0xf0, 0xe9, 0xf0, 0xe9, 0xe9, 0xf0, 0xe9, 0xf0, 0xe7, 0xef, 0xe9, 0xec, 0x01, 0x01, 0x01, 0xed, 0xed, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x01, 0xc9, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xf6, 0x91, 0xf6, 0x91, 0xf6, 0x91, 0xf6, 0x91, 0xf6, 0x91, 0xf6, 0x91, 0xf6, 0xf6, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0xf6, 0x8a, 0x8a, 0x00, 0x00, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x8e, 0xef, 0xed, 0xfd, 0xe7, 0xef, 0xe9, 0xf0, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe7, 0xe7, 0xeb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xf0, 0x01, 0xeb, 0xf5, 0x01, 0xba, 0x00, 0x00, 0x95, 0x8a, 0x94, 0x00, 0x91, 0x91, 0x8a, 0x8a, 0x91, 0x8a, 0x91, 0x91, 0x00, 0x91, 0x00, 0xc9, 0x01, 0xe9, 0xf0, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe7, 0xea, 0xec, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xf5, 0x01, 0xeb, 0xec, 0x01, 0x01, 0xe6, 0xbd, 0xa7, 0xae, 0xb1, 0xb2, 0xb4, 0xae, 0xa5, 0xb0, 0xdd, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xb5, 0x00, 0x94, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0xf6, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xeb, 0xec, 0xef, 0xe9, 0xe9, 0xe9, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xf0, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x90, 0xec, 0x01, 0x01, 0x01, 0xed, 0xec, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xf5, 0xed, 0x01, 0xe7, 0xf2, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x8a, 0xf6, 0x8a, 0xf6, 0x8a, 0x8a, 0x8a, 0xf6, 0x00, 0xf6, 0x8a, 
-  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xe7, 0x01, 0xe9, 0xe7, 0xef, 0xf0, 0xf0, 0xe9, 0xe9, 0xe9, 0xf0, 0xea, 0xf0, 0xe9, 0xe7, 0xf0, 0xeb, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xed, 0x01, 0x01, 0xf3, 0x00, 0x00, 0x91, 0x00, 0x8a, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xed, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xf0, 0xe9, 0xea, 0xe9, 0xea, 0xe9, 0xe9, 0xeb, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xec, 0x01, 0xec, 0x01, 0xea, 0xd3, 0xbd, 0xb5, 0xb2, 0xb0, 0xbd, 0xd7, 0xeb, 0x01, 0x01, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x90, 0x01, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x91, 0x8a, 0x91, 0x8a, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x91, 0x8a, 0x00, 0xf6, 0xc9, 0x01, 0xeb, 0xef, 0xf0, 0xe9, 0xf0, 0xe9, 0xf0, 0xf0, 0xe9, 0xf0, 0xef, 0xf0, 0xf0, 0x65, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xec, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xf5, 0x01, 0xc2, 0xf6, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0xf6, 0x00, 0x8a, 0x00, 0x00, 
-  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x95, 0x00, 0x00, 0x8a, 0xf6, 0x00, 0xf8, 0xfd, 0xeb, 0xef, 0xe9, 0xf0, 0xe9, 0xf0, 0xf0, 0xf0, 0xe9, 0xe9, 0xe9, 0xf0, 0xe9, 0xef, 0xef, 0xeb, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0xf5, 0xc2, 0x94, 0x91, 0x95, 0x95, 0x94, 0x95, 0x91, 0x94, 0x91, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x94, 0x00, 0x94, 0x00, 0xba, 0x01, 0xe9, 0xf0, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xea, 0xe9, 0xe7, 0xea, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xeb, 0x90, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xec, 0xf5, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x91, 0x00, 0x00, 0x99, 0xd1, 0xed, 0xf0, 0xe9, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe9, 0xef, 0xef, 0xf0, 0xec, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xd8, 0x9c, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 
-  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xee, 0xec, 0xf0, 0xef, 0xe9, 0xf0, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xf0, 0xeb, 0xef, 0xe7, 0xf0, 0xeb, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0xe9, 0xba, 0x97, 0x9c, 0xa2, 0xa0, 0xa0, 0xa2, 0xa0, 0x9e, 0xf2, 0xa0, 0x9e, 0x9f, 0x9d, 0x9e, 0x9d, 0x9d, 0x9d, 0x9c, 0x9d, 0x97, 0x95, 0x9a, 0xe7, 0xed, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xeb, 0xea, 0xea, 0xe8, 0xe9, 0xec, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xec, 0xec, 0xed, 0x01, 0xed, 0xed, 0xec, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x95, 0x00, 0x97, 0x95, 0x95, 0x94, 0x95, 0x92, 0x95, 0x92, 0x95, 0x92, 0x95, 0x92, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x91, 0x94, 0x91, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x91, 0x00, 0x00, 0x91, 0x91, 0x00, 0x00, 0x8e, 0xe6, 0xf0, 0xf0, 0xf0, 0xf0, 0xe9, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe7, 0xef, 0xf0, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x01, 0xe9, 0xf8, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 
-  0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xc0, 0xe7, 0xeb, 0xe9, 0xef, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xef, 0xe7, 0xe7, 0xef, 0xec, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xed, 0xd8, 0xab, 0x99, 0x9d, 0xa6, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa6, 0xa2, 0xa2, 0xa6, 0xa2, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa6, 0xaa, 0x9a, 0xad, 0xe9, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xec, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xec, 0xed, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x65, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x9e, 0x9d, 0xa2, 0xa0, 0xa0, 0xa2, 0xa0, 0xa2, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0xa0, 0xa2, 0xa0, 0xa2, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa0, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9d, 0x9e, 0x9d, 0x8e, 0x9d, 0x9c, 0x9d, 0x9c, 0x9c, 0x9d, 0x9c, 0x9a, 0x9c, 0x97, 0x94, 0xf8, 0xe6, 0xef, 0xea, 0xe9, 0xe9, 0xea, 0xf0, 0xe9, 0xf0, 0xf0, 0xef, 0xe7, 0xef, 0xeb, 0xf5, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xe9, 0xf9, 0x00, 0x00, 0x91, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 
-  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0xf6, 0xa2, 0xc9, 0xe7, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xf0, 0xea, 0xea, 0xef, 0xe7, 0xef, 0xe9, 0xef, 0xeb, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0x01, 0x01, 0xeb, 0xe6, 0xba, 0xa0, 0x99, 0xa2, 0xa2, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa6, 0xa6, 0x9d, 0xa6, 0x9d, 0xba, 0xeb, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xf5, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0xed, 0xf5, 0x01, 0xf5, 0x01, 0x01, 0xc9, 0x9b, 0xf2, 0xa6, 0xa2, 0xa2, 0xa2, 0xa6, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa5, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa6, 0xa5, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0xab, 0xab, 0x9e, 0x9d, 0xad, 0xc9, 0xe7, 0xec, 0xea, 0xef, 0xe9, 0xe9, 0xf0, 0xea, 0xf0, 0xf0, 0xef, 0xe7, 0xf0, 0xed, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xf5, 0x01, 0x01, 0xf0, 0xb9, 0x00, 0x00, 0x91, 0x00, 0x8a, 0x91, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0xf6, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x8a, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x96, 0xb2, 0xc9, 0xd8, 0xe6, 0xe9, 0xea, 0xe9, 0xea, 0xeb, 0xea, 0xec, 0xea, 0xea, 0xe9, 0xe9, 0xe7, 0xe9, 0xea, 0xec, 0xed, 0xed, 0xed, 0xed, 0xed, 0xec, 0xe9, 0xdd, 0xba, 0xa6, 0x9b, 0x9d, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa2, 0xa7, 0x9d, 0xa6, 0x9f, 0xa6, 0xa0, 0x9e, 0xc9, 0xe9, 0xeb, 0xe9, 0xe9, 0xeb, 0xea, 0xe9, 0xea, 0xeb, 0xea, 0xe7, 0xe9, 0xeb, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0xed, 0x01, 0xec, 0xed, 0x01, 0xee, 0x9d, 0x9c, 0xaa, 0xa2, 0x9f, 0xa2, 0xa0, 0x9f, 0xa2, 0xa0, 0xa2, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa1, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa1, 0xa3, 0xa2, 0xa1, 0xa2, 0xa3, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0xa2, 0xa0, 0xa2, 0xa6, 0xa5, 0x9d, 0xa5, 0xba, 0xd7, 0xe9, 0xeb, 0xf0, 0xea, 0xea, 0xeb, 0xf0, 0xe9, 0xe7, 0xef, 0xe7, 0xeb, 0xf5, 0x01, 0xed, 0xed, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xed, 0x01, 0xf5, 0x01, 0x01, 0xfd, 0xb9, 0x00, 0x00, 0x91, 0x91, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x91, 0x95, 0x95, 0x96, 0x95, 0x9a, 0x97, 0x9a, 0x9d, 0xa5, 0xad, 0xb6, 0xba, 0xc3, 0xcc, 0xd7, 0xd8, 0xdd, 0xe2, 0xe2, 0xe2, 0xe2, 0xdd, 0xee, 0xdd, 0xd8, 0xdd, 0xee, 0xdd, 0xd8, 0xcc, 0xba, 0xb0, 0xa6, 0xa0, 0x9b, 0xa6, 0xa1, 0x9f, 0xa0, 0xa3, 0xa3, 0xa1, 0xa2, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa1, 0xa6, 0x9e, 0xa6, 0xa7, 0xa0, 0xa2, 0x9e, 0xa2, 0xc2, 0xe9, 0xec, 0xe9, 0xe7, 0xf0, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xec, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xec, 0xed, 0x01, 0xe2, 0xad, 0x9d, 0xa0, 0xa7, 0x9f, 0x9f, 0xa3, 0xa1, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa5, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa5, 0xa1, 0xa2, 0xa3, 0xa2, 0xa5, 0xa3, 0xa5, 0xa6, 0xa3, 0xa5, 0xa5, 0xa1, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa6, 0xb9, 0xcc, 0xe7, 0xe9, 0xea, 0xec, 0xea, 0xea, 0xe9, 0xea, 0xe9, 0xe7, 0xe9, 0xec, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xf5, 0x01, 0xec, 0xee, 0xb0, 0x95, 0x97, 0x97, 0x9a, 0x9a, 0x99, 0x98, 0x9a, 0x97, 0x96, 0x95, 0x94, 0x91, 0xf6, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x94, 0x95, 0x99, 0x9a, 0x9d, 0x9d, 0x9f, 0xa0, 0xa2, 0xa5, 0xa0, 0xa6, 0xa2, 0xa2, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9f, 0xa0, 0xa5, 0xa6, 0xaa, 0xaa, 0xab, 0xaa, 0xad, 0xab, 0xab, 0xab, 0xaa, 0xaa, 0xa6, 0xa2, 0xa0, 0x9f, 0x9d, 0x9f, 0xa0, 0xa3, 0xa2, 0xa1, 0xa5, 0xa5, 0xa1, 0x9f, 0xa1, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa6, 0x9f, 0xa6, 0xa5, 0x9f, 0xa6, 0x9d, 0x9f, 0xbd, 0xe2, 0xec, 0xed, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xf0, 0xe9, 0xef, 0xe9, 0xec, 0xf5, 0xed, 0x01, 0x01, 0x01, 0xf5, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xed, 0x90, 0xed, 0x01, 0xf5, 0x01, 0xed, 0x01, 0x01, 0xe6, 0xb0, 0x9c, 0xa5, 0x9f, 0xa2, 0xa1, 0xa5, 0xa1, 0x9f, 0xa5, 0xa5, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa3, 0xa6, 0xa3, 0xa3, 0xa3, 0xa0, 0xa1, 0xa2, 0x9f, 0x9f, 0xa6, 0xb2, 0xc0, 0xcc, 0xdd, 0xe6, 0xe7, 0xe9, 0xe9, 0xeb, 0xe9, 0xe9, 0xe9, 0xec, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xe2, 0xf3, 0xa2, 0x9c, 0x9f, 0xa2, 0xa7, 0xa2, 0xa2, 0xa5, 0xa2, 0xa6, 0xa6, 0xa2, 0xa0, 0xf2, 0x9d, 0x9d, 0x9d, 0x97, 0x96, 0x95, 0x94, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x92, 0x97, 0x9c, 0x9e, 0x9f, 0xa2, 0xa6, 0xaa, 0xa6, 0xaa, 0xa6, 0xa6, 0xa5, 0xa6, 0xa6, 0x9f, 0xa0, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0xa0, 0x9f, 0xa0, 0x9f, 0x9f, 0x9f, 0x9f, 0xa0, 0xa0, 0xa0, 0x9f, 0x9f, 0x9f, 0xa0, 0xa1, 0xa0, 0xa1, 0xa3, 0xa3, 0xa1, 0xa5, 0x9f, 0x9f, 0xa3, 0xa7, 0xa1, 0xa0, 0xa3, 0xa1, 0xa2, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa3, 0xa5, 0x9f, 0xa3, 0xa5, 0x9f, 0xa5, 0xa0, 0x9e, 0x9d, 0xb0, 0xcc, 0xe6, 0xf0, 0xec, 0xeb, 0xf0, 0xf0, 0xe9, 0xe9, 0xe9, 0xef, 0xe9, 0xeb, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x01, 0xed, 0xed, 0xed, 0x90, 0xed, 0xed, 0xed, 0x90, 0xed, 0x01, 0x01, 0xe2, 0xb5, 0x9e, 0x9e, 0xa2, 0xa3, 0x9f, 0xa5, 0xa5, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa5, 0xa3, 0xa1, 0xa1, 0x9f, 0xa7, 0xa5, 0xa1, 0xa3, 0xa5, 0xa3, 0x9f, 0x9f, 0x9f, 0xa0, 0xaa, 0xb0, 0xb9, 0xc0, 0xc9, 0xd3, 0xee, 0xdd, 0xe2, 0xe6, 0xe9, 0xf0, 0xec, 0xf5, 0xed, 0xed, 0xf5, 0xf0, 0xef, 0xe6, 0xd1, 0xf3, 0xa6, 0x9e, 0x9f, 0xa6, 0xa2, 0xa0, 0xa6, 0xa2, 0xa3, 0xa5, 0xa3, 0xa5, 0xa2, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa0, 0x9e, 0x9c, 0x96, 0x95, 0xf6, 0xf6, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x9c, 0xf2, 0xa2, 0xa6, 0xaa, 0xa6, 0xa7, 0xa6, 0xa6, 0xa5, 0xa2, 0xa2, 0xa5, 0xa2, 0xa3, 0xa2, 0xa7, 0xa5, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xa1, 0xa5, 0xa3, 0xa3, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa3, 0xa0, 0xa1, 0xa3, 0xa3, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa1, 0x9f, 0xa1, 0xa3, 0xa1, 0xa2, 0xa1, 0xa3, 0xa0, 0xa1, 0xa2, 0xa3, 0xa3, 0xa2, 0xa1, 0xa2, 0xa1, 0xa3, 0x9f, 0xa6, 0xa5, 0x9f, 0xa5, 0xa3, 0xa0, 0xa5, 0xa0, 0x9d, 0x9d, 0xb2, 0xc9, 0xe2, 0xe9, 0xeb, 0xed, 0xed, 0xec, 0xec, 0xe9, 0xef, 0xe9, 0xeb, 0xf5, 0x01, 0x01, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xed, 0x90, 0xed, 0x90, 0x01, 0x01, 0x01, 0xeb, 0xdd, 0xab, 0x9d, 0xa2, 0x9f, 0xa1, 0xa5, 0x9f, 0xa1, 0xa1, 0xa1, 0xa4, 0xa1, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa5, 0xa1, 0xa3, 0xa3, 0xa7, 0xa3, 0xa5, 0xa1, 0xa1, 0xa1, 0x9f, 0xa1, 0xa5, 0xa5, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa0, 0xa5, 0xab, 0xb2, 0xb5, 0xb9, 0xba, 0xc2, 0xc3, 0xc9, 0xc4, 0xc2, 0xba, 0xb5, 0xab, 0x9f, 0x9d, 0x9e, 0xa0, 0xa2, 0xa2, 0xa6, 0xa7, 0x9f, 0xa3, 0xa6, 0xa3, 0xa5, 0xa2, 0xa2, 0xa2, 0xa2, 0xa6, 0xa2, 0xa6, 0xa6, 0xa2, 0xa6, 0xa6, 0xaa, 0xa7, 0xa6, 0xa6, 0x9d, 0x9c, 0x95, 0xf6, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xa6, 0xb0, 0xad, 0xa6, 0xaa, 0xa6, 0xa5, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xa2, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 0xa5, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa5, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0x9f, 0x9e, 0x9e, 0xa5, 0xb5, 0xc2, 0xd7, 0xee, 0xe7, 0xe7, 0xec, 0xec, 0xeb, 0xf0, 0xeb, 0xed, 0xed, 0x01, 0xed, 0x01, 0xed, 0xf5, 0xed, 0xed, 0x01, 0x01, 0xed, 0xf5, 0x01, 0x01, 0xec, 0xe2, 0xc3, 0xa1, 0x9d, 0xa1, 0xa1, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa1, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa3, 0xa5, 0xa1, 0xa1, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9e, 0xa3, 0xa2, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa6, 0xa5, 0xa6, 0xa7, 0xa6, 0xf8, 0xad, 0xf2, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x91, 0xf7, 0xa5, 0xf8, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xa5, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa5, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa5, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa1, 0xa3, 0xa2, 0xa3, 0xa5, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa3, 0xa5, 0xa2, 0xa1, 0xa3, 0xa5, 0xa0, 0x9d, 0x9d, 0x9e, 0xa3, 0xad, 0xb9, 0xc0, 0xc4, 0xd1, 0xd8, 0xe2, 0xe8, 0xeb, 0xed, 0x01, 0x01, 0x01, 0xed, 0xed, 0x01, 0x01, 0x01, 0x01, 0xed, 0xeb, 0xee, 0xc2, 0xaa, 0x9b, 0x9e, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa4, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa5, 0xa1, 0xa5, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa5, 0xa3, 0xa3, 0xa5, 0xa4, 0xa5, 0xa5, 0xa3, 0xa5, 0xa5, 0xa3, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa2, 0xa5, 0xa5, 0xa6, 0xa7, 0xa6, 0xa7, 0xf8, 0xad, 0xa6, 0xf1, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x8a, 0x00, 0x8a, 0x95, 0x97, 0x9c, 0x9f, 0x9f, 0xa0, 0xa5, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa2, 0xa5, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa5, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa6, 0xa5, 0xa5, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa5, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa0, 0xa5, 0xa5, 0xa2, 0xa2, 0xa3, 0xa6, 0xa6, 0xa5, 0xa2, 0x9f, 0x9f, 0x9e, 0x9d, 0x9d, 0xa1, 0xaa, 0xae, 0xb9, 0xc0, 0xc7, 0xd8, 0xe2, 0xe6, 0xe9, 0xe7, 0xe7, 0xe6, 0xe2, 0xdd, 0xc9, 0xb8, 0xa6, 0x9f, 0x9e, 0x9f, 0xa4, 0xa3, 0x9f, 0xa1, 0xa5, 0xa1, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa5, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa2, 0xa3, 0xa2, 0xa5, 0xa2, 0xa5, 0xa2, 0xa3, 0xa2, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa5, 0xa5, 0xa2, 0xf2, 0x9d, 0xf1, 0x8a, 0x00, 0x8a, 0xf6, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x94, 0x94, 0x95, 0x96, 0x99, 0x9b, 0x9c, 0x9d, 0x9d, 0x9e, 0xa0, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa6, 0xa2, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa2, 0xa1, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa5, 0xa5, 0xa2, 0xa3, 0xa5, 0xa3, 0xa5, 0xa5, 0xa7, 0xa7, 0xa5, 0xa5, 0xa3, 0xa3, 0xa1, 0x9e, 0x9e, 0x9f, 0xa1, 0xa7, 0xaa, 0xb0, 0xb2, 0xb2, 0xb2, 0xb0, 0xab, 0xa3, 0x9e, 0x9e, 0x9f, 0xa0, 0xa1, 0xa5, 0xa1, 0xa0, 0xa1, 0xa5, 0xa5, 0x9e, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa2, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa1, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa1, 0xa2, 0xa3, 0xa3, 0xa3, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa5, 0xa5, 0xa5, 0xa5, 0xa6, 0xa3, 0xa3, 0xa5, 0xa3, 0xa5, 0xa5, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa5, 0xa2, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa0, 0x9e, 0x9c, 0x9c, 0x9a, 0x97, 0x95, 0xf6, 0x00, 0x00, 0x8a, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0xf6, 0x94, 0x94, 0x95, 0x95, 0x97, 0x99, 0x99, 0x9a, 0x9c, 0x9c, 0x9d, 0x9d, 0x9e, 0x9e, 0x9f, 0xa0, 0xa0, 0xa2, 0xa2, 0xa0, 0xa0, 0xa2, 0xf2, 0xa5, 0xa2, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa2, 0xa6, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa5, 0xa2, 0xa5, 0xa5, 0xa1, 0xa1, 0xa1, 0xa3, 0xa5, 0xa5, 0xa4, 0xa6, 0xa4, 0xa7, 0xa4, 0xa3, 0x9f, 0xa1, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa1, 0xa0, 0xa1, 0x9f, 0xa5, 0xa3, 0xa0, 0xa1, 0xa2, 0xa3, 0xa0, 0xa5, 0xa3, 0xa1, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa3, 0xa2, 0xa1, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa5, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0xa5, 0xa2, 0xa5, 0xa2, 0xa5, 0xa2, 0xa5, 0xa5, 0xa5, 0xa2, 0xa5, 0xa6, 0xa3, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa2, 0xa6, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa0, 0xa0, 0x9e, 0x9e, 0x9d, 0x9d, 0x9c, 0x9c, 0x9a, 0x99, 0x99, 0x97, 0x94, 0x94, 0x94, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x91, 0x8a, 0x8a, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x91, 0xf6, 0x94, 0xf6, 0x94, 0x94, 0x95, 0x95, 0x96, 0x95, 0xf1, 0x99, 0x99, 0x99, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c, 0x9d, 0x9c, 0x9d, 0x9d, 0x9d, 0xa0, 0x9d, 0xf2, 0x9f, 0xf2, 0xa0, 0xf2, 0xa2, 0xa0, 0xa2, 0xa2, 0xa2, 0xa6, 0xa2, 0xa6, 0xa2, 0xa2, 0xa6, 0xa2, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xa5, 0xa6, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa1, 0xa2, 0xa3, 0xa1, 0xa2, 0xa3, 0xa2, 0xa1, 0xa2, 0xa3, 0xa0, 0xa3, 0xa6, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa2, 0xa2, 0xa5, 0xa2, 0xa5, 0xa2, 0xa5, 0xa2, 0xa5, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa2, 0xa6, 0xa6, 0xa6, 0xa5, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa0, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9d, 0x9d, 0x9c, 0x9c, 0x9c, 0x9c, 0x99, 0x9c, 0x99, 0x97, 0xf1, 0x95, 0x95, 0x94, 0x94, 0x94, 0xf6, 0x91, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0xf6, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x8a, 0x00, 0x8a, 0x8a, 0xf6, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x91, 0x8a, 0xf6, 0x8a, 0xf6, 0xf6, 0x94, 0xf6, 0x94, 0x95, 0x94, 0x95, 0x95, 0x95, 0xf1, 0x95, 0x99, 0x96, 0x99, 0x99, 0x99, 0x9a, 0x99, 0x9a, 0x9a, 0x9c, 0x9a, 0x9c, 0x9b, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9f, 0x9d, 0x9e, 0x9e, 0xa0, 0x9f, 0x9e, 0xa0, 0x9f, 0xa0, 0x9f, 0x9f, 0x9f, 0x9f, 0xa0, 0xa1, 0xa0, 0x9f, 0x9f, 0xa0, 0xa0, 0xa2, 0x9f, 0xa0, 0x9f, 0xa0, 0x9f, 0xa0, 0x9f, 0x9f, 0xa0, 0xa2, 0xa2, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa6, 0xa6, 0xa6, 0xa2, 0xa5, 0xa2, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0xa0, 0xa2, 0xa0, 0xa0, 0xa0, 0xa0, 0xa2, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0xa0, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9e, 0x9f, 0x9d, 0x9e, 0x9d, 0x9e, 0x9d, 0x9e, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9b, 0x9c, 0x9a, 0x9c, 0x9a, 0x9c, 0x9a, 0x9a, 0x99, 0x9a, 0x99, 0x97, 0x97, 0x96, 0x96, 0x95, 0x96, 0x95, 0x95, 0x95, 0x94, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xf6, 0x91, 0xf6, 0x8a, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0xf6, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0xf6, 0x8a, 0x8a, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x91, 0x8a, 0x91, 0x8a, 0x91, 0x91, 0x94, 0x91, 0x94, 0x91, 0x94, 0x91, 0x94, 0x91, 0x94, 0x94, 0x94, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x95, 0x97, 0x99, 0x99, 0x99, 0x9a, 0x99, 0x9a, 0x99, 0x9a, 0x99, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x91, 0x91, 0x91, 0x8a, 0x91, 0x00, 0x8a, 0x00, 0x91, 0x00, 0x91, 0x00, 0x8a, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x8a, 0xf6, 0xf6, 0x00, 0x8a, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x8a, 0x91, 0x8a, 0x91, 0x8a, 0x91, 0x8a, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x8a, 0x91, 0x8a, 0x00, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x91, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0xf6, 0x8a, 0x8a, 0x8a, 0x8a, 0xf6, 0x8a, 0x8a, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0xf6, 0x8a, 0xf6, 0x8a, 0xf6, 0x8a, 0xf6, 0x8a, 0xf6, 0x8a, 0xf6, 0x8a, 0xf6, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x00, 0x8a, 
-};
-
-const lv_img_dsc_t image15 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image15_map,
-};
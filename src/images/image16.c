@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE16
-#define LV_ATTRIBUTE_IMG_IMAGE16
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE16 uint8_t image16_map[] = {
-  0xfc, 0xfc, 0xfc, 0xff, 	/*Color of index 0*/
-  0xf3, 0xf3, 0xf3, 0xff, 	/*Color of index 1*/
-  0x02, 0x02, 0x02, 0xff, 	/*Color of index 2*/
-  0xe9, 0xea, 0xf5, 0xff, 	/*Color of index 3*/
-  0xe0, 0xe3, 0xf6, 0xff, 	/*Color of index 4*/
-  0xcf, 0xdb, 0xf8, 0xff, 	/*Color of index 5*/
-  0xc0, 0xcb, 0xf8, 0xff, 	/*Color of index 6*/
-  0xb3, 0xbc, 0xf0, 0xff, 	/*Color of index 7*/
-  0x99, 0xa6, 0xe0, 0xff, 	/*Color of index 8*/
-  0x7b, 0x94, 0xda, 0xff, 	/*Color of index 9*/
-  0x7c, 0x85, 0xbc, 0xff, 	/*Color of index 10*/
-  0x5d, 0x6f, 0xd0, 0xff, 	/*Color of index 11*/
-  0x65, 0x6c, 0xb2, 0xff, 	/*Color of index 12*/
-  0x3d, 0x58, 0xbf, 0xff, 	/*Color of index 13*/
-  0x17, 0x4e, 0xea, 0xff, 	/*Color of index 14*/
-  0x20, 0x4c, 0xe8, 0xff, 	/*Color of index 15*/
-  0x2a, 0x4f, 0xd7, 0xff, 	/*Color of index 16*/
-  0x40, 0x54, 0xb2, 0xff, 	/*Color of index 17*/
-  0x12, 0x43, 0xf3, 0xff, 	/*Color of index 18*/
-  0x20, 0x41, 0xf2, 0xff, 	/*Color of index 19*/
-  0x1e, 0x45, 0xe2, 0xff, 	/*Color of index 20*/
-  0x4c, 0x54, 0x92, 0xff, 	/*Color of index 21*/
-  0x36, 0x48, 0xbd, 0xff, 	/*Color of index 22*/
-  0x2b, 0x3d, 0xc2, 0xff, 	/*Color of index 23*/
-  0x1a, 0x2f, 0xf2, 0xff, 	/*Color of index 24*/
-  0x1f, 0x31, 0xd8, 0xff, 	/*Color of index 25*/
-  0x24, 0x33, 0xa5, 0xff, 	/*Color of index 26*/
-  0x2c, 0x38, 0x87, 0xff, 	/*Color of index 27*/
-  0x10, 0x1e, 0xe4, 0xff, 	/*Color of index 28*/
-  0x3a, 0x35, 0x64, 0xff, 	/*Color of index 29*/
-  0x0e, 0x1e, 0x7a, 0xff, 	/*Color of index 30*/
-  0x0d, 0x1f, 0x50, 0xff, 	/*Color of index 31*/
-  0x03, 0x03, 0x22, 0xff, 	/*Color of index 32*/
-  0x03, 0x01, 0x09, 0xff, 	/*Color of index 33*/
-  0xf7, 0xf9, 0xfa, 0xff, 	/*Color of index 34*/
-  0xe7, 0xf3, 0xf6, 0xff, 	/*Color of index 35*/
-  0xbf, 0xeb, 0xf2, 0xff, 	/*Color of index 36*/
-  0x66, 0xe7, 0xfd, 0xff, 	/*Color of index 37*/
-  0x55, 0xe7, 0xfc, 0xff, 	/*Color of index 38*/
-  0xc6, 0xe2, 0xe6, 0xff, 	/*Color of index 39*/
-  0xa8, 0xe0, 0xf0, 0xff, 	/*Color of index 40*/
-  0x92, 0xde, 0xf6, 0xff, 	/*Color of index 41*/
-  0x49, 0xe3, 0xfa, 0xff, 	/*Color of index 42*/
-  0x92, 0xd7, 0xe8, 0xff, 	/*Color of index 43*/
-  0x74, 0xd2, 0xef, 0xff, 	/*Color of index 44*/
-  0xbc, 0xca, 0xe7, 0xff, 	/*Color of index 45*/
-  0x8a, 0xc4, 0xf5, 0xff, 	/*Color of index 46*/
-  0x53, 0xcc, 0xec, 0xff, 	/*Color of index 47*/
-  0x3a, 0xcc, 0xf2, 0xff, 	/*Color of index 48*/
-  0x6d, 0xca, 0xdc, 0xff, 	/*Color of index 49*/
-  0x9f, 0xc6, 0xcf, 0xff, 	/*Color of index 50*/
-  0x50, 0xc2, 0xdf, 0xff, 	/*Color of index 51*/
-  0x71, 0xc1, 0xcf, 0xff, 	/*Color of index 52*/
-  0x37, 0xbf, 0xe9, 0xff, 	/*Color of index 53*/
-  0x78, 0xb3, 0xf2, 0xff, 	/*Color of index 54*/
-  0xad, 0xbb, 0xbe, 0xff, 	/*Color of index 55*/
-  0x27, 0xb7, 0xe5, 0xff, 	/*Color of index 56*/
-  0x56, 0xb9, 0xce, 0xff, 	/*Color of index 57*/
-  0x1d, 0xb0, 0xfc, 0xff, 	/*Color of index 58*/
-  0x3c, 0xb3, 0xd7, 0xff, 	/*Color of index 59*/
-  0x60, 0xae, 0xbf, 0xff, 	/*Color of index 60*/
-  0x42, 0xa2, 0xdc, 0xff, 	/*Color of index 61*/
-  0x71, 0xa3, 0xb3, 0xff, 	/*Color of index 62*/
-  0x2d, 0x91, 0xf5, 0xff, 	/*Color of index 63*/
-  0x4e, 0x9a, 0xaf, 0xff, 	/*Color of index 64*/
-  0x34, 0x93, 0xc6, 0xff, 	/*Color of index 65*/
-  0x2f, 0x8a, 0xdd, 0xff, 	/*Color of index 66*/
-  0x6e, 0x94, 0x99, 0xff, 	/*Color of index 67*/
-  0x5f, 0x84, 0xcd, 0xff, 	/*Color of index 68*/
-  0x1f, 0x7a, 0xde, 0xff, 	/*Color of index 69*/
-  0x61, 0x82, 0x89, 0xff, 	/*Color of index 70*/
-  0x3c, 0x7f, 0x9a, 0xff, 	/*Color of index 71*/
-  0x16, 0x67, 0xe5, 0xff, 	/*Color of index 72*/
-  0x49, 0x6d, 0xbd, 0xff, 	/*Color of index 73*/
-  0x2a, 0x69, 0xd4, 0xff, 	/*Color of index 74*/
-  0x10, 0x6a, 0xd9, 0xff, 	/*Color of index 75*/
-  0x27, 0x62, 0xe8, 0xff, 	/*Color of index 76*/
-  0x16, 0x62, 0xeb, 0xff, 	/*Color of index 77*/
-  0x28, 0x62, 0xc4, 0xff, 	/*Color of index 78*/
-  0x54, 0x6e, 0x7e, 0xff, 	/*Color of index 79*/
-  0x40, 0x63, 0x9e, 0xff, 	/*Color of index 80*/
-  0x10, 0x52, 0xdb, 0xff, 	/*Color of index 81*/
-  0x11, 0x5e, 0x90, 0xff, 	/*Color of index 82*/
-  0x32, 0x63, 0x71, 0xff, 	/*Color of index 83*/
-  0x07, 0x42, 0xb5, 0xff, 	/*Color of index 84*/
-  0x12, 0x51, 0x70, 0xff, 	/*Color of index 85*/
-  0x3e, 0x42, 0x44, 0xff, 	/*Color of index 86*/
-  0x1a, 0x37, 0x6b, 0xff, 	/*Color of index 87*/
-  0x18, 0x39, 0x4a, 0xff, 	/*Color of index 88*/
-  0x06, 0x1a, 0x2d, 0xff, 	/*Color of index 89*/
-  0x11, 0x15, 0x16, 0xff, 	/*Color of index 90*/
-  0xce, 0xf2, 0xf2, 0xff, 	/*Color of index 91*/
-  0x93, 0xf2, 0xfa, 0xff, 	/*Color of index 92*/
-  0xac, 0xef, 0xf3, 0xff, 	/*Color of index 93*/
-  0x73, 0xf1, 0xf8, 0xff, 	/*Color of index 94*/
-  0xdf, 0xea, 0xe7, 0xff, 	/*Color of index 95*/
-  0x4a, 0xeb, 0xf4, 0xff, 	/*Color of index 96*/
-  0x59, 0xea, 0xf0, 0xff, 	/*Color of index 97*/
-  0x98, 0xe6, 0xe5, 0xff, 	/*Color of index 98*/
-  0x7a, 0xe5, 0xe7, 0xff, 	/*Color of index 99*/
-  0x65, 0xe4, 0xee, 0xff, 	/*Color of index 100*/
-  0xcb, 0xdb, 0xd7, 0xff, 	/*Color of index 101*/
-  0xab, 0xdd, 0xdb, 0xff, 	/*Color of index 102*/
-  0x84, 0xb8, 0xbc, 0xff, 	/*Color of index 103*/
-  0x89, 0xa9, 0xa6, 0xff, 	/*Color of index 104*/
-  0x87, 0x9d, 0x98, 0xff, 	/*Color of index 105*/
-  0x54, 0x91, 0x96, 0xff, 	/*Color of index 106*/
-  0x35, 0x55, 0x58, 0xff, 	/*Color of index 107*/
-  0x24, 0x2e, 0x2b, 0xff, 	/*Color of index 108*/
-  0x0a, 0x2f, 0x2f, 0xff, 	/*Color of index 109*/
-  0xf2, 0xfa, 0xf2, 0xff, 	/*Color of index 110*/
-  0xca, 0xcb, 0xca, 0xff, 	/*Color of index 111*/
-  0x02, 0x07, 0x01, 0xff, 	/*Color of index 112*/
-  0xfc, 0xfa, 0xf4, 0xff, 	/*Color of index 113*/
-  0xf3, 0xf1, 0xeb, 0xff, 	/*Color of index 114*/
-  0xea, 0xe7, 0xdd, 0xff, 	/*Color of index 115*/
-  0xe4, 0xe1, 0xd9, 0xff, 	/*Color of index 116*/
-  0xd4, 0xd3, 0xcf, 0xff, 	/*Color of index 117*/
-  0xa6, 0xa8, 0x97, 0xff, 	/*Color of index 118*/
-  0x9f, 0x9d, 0x97, 0xff, 	/*Color of index 119*/
-  0x4a, 0x4a, 0x49, 0xff, 	/*Color of index 120*/
-  0xf9, 0xf5, 0xf4, 0xff, 	/*Color of index 121*/
-  0xfa, 0xf3, 0xea, 0xff, 	/*Color of index 122*/
-  0xef, 0xeb, 0xea, 0xff, 	/*Color of index 123*/
-  0xf2, 0xeb, 0xe2, 0xff, 	/*Color of index 124*/
-  0xea, 0xe6, 0xe2, 0xff, 	/*Color of index 125*/
-  0xf1, 0xe6, 0xdb, 0xff, 	/*Color of index 126*/
-  0xea, 0xe3, 0xdb, 0xff, 	/*Color of index 127*/
-  0xe9, 0xe0, 0xd4, 0xff, 	/*Color of index 128*/
-  0xe3, 0xdc, 0xd6, 0xff, 	/*Color of index 129*/
-  0xe6, 0xdb, 0xcb, 0xff, 	/*Color of index 130*/
-  0xdd, 0xd8, 0xd7, 0xff, 	/*Color of index 131*/
-  0xe2, 0xd3, 0xc2, 0xff, 	/*Color of index 132*/
-  0xd8, 0xd0, 0xc5, 0xff, 	/*Color of index 133*/
-  0xdf, 0xce, 0xbb, 0xff, 	/*Color of index 134*/
-  0xd2, 0xc9, 0xbd, 0xff, 	/*Color of index 135*/
-  0xd8, 0xc9, 0xb8, 0xff, 	/*Color of index 136*/
-  0xd2, 0xc5, 0xb4, 0xff, 	/*Color of index 137*/
-  0xc9, 0xc3, 0xbd, 0xff, 	/*Color of index 138*/
-  0xe0, 0xc4, 0xac, 0xff, 	/*Color of index 139*/
-  0xcc, 0xc0, 0xb1, 0xff, 	/*Color of index 140*/
-  0xcc, 0xbd, 0xaf, 0xff, 	/*Color of index 141*/
-  0xce, 0xbd, 0xab, 0xff, 	/*Color of index 142*/
-  0xc2, 0xba, 0xb2, 0xff, 	/*Color of index 143*/
-  0xc9, 0xb9, 0xaa, 0xff, 	/*Color of index 144*/
-  0xc4, 0xb7, 0xab, 0xff, 	/*Color of index 145*/
-  0xc9, 0xb6, 0xa8, 0xff, 	/*Color of index 146*/
-  0xbc, 0xb5, 0xae, 0xff, 	/*Color of index 147*/
-  0xc2, 0xb4, 0xa5, 0xff, 	/*Color of index 148*/
-  0xb0, 0xaf, 0xae, 0xff, 	/*Color of index 149*/
-  0xbb, 0xb0, 0xa4, 0xff, 	/*Color of index 150*/
-  0xc4, 0xae, 0x97, 0xff, 	/*Color of index 151*/
-  0xb0, 0xaa, 0xa3, 0xff, 	/*Color of index 152*/
-  0xba, 0xa9, 0x97, 0xff, 	/*Color of index 153*/
-  0xab, 0xa3, 0x9a, 0xff, 	/*Color of index 154*/
-  0xbd, 0xa4, 0x8e, 0xff, 	/*Color of index 155*/
-  0xb1, 0xa0, 0x8e, 0xff, 	/*Color of index 156*/
-  0xbb, 0x9e, 0x82, 0xff, 	/*Color of index 157*/
-  0xa9, 0x9b, 0x87, 0xff, 	/*Color of index 158*/
-  0x99, 0x94, 0x92, 0xff, 	/*Color of index 159*/
-  0xac, 0x95, 0x82, 0xff, 	/*Color of index 160*/
-  0x9e, 0x92, 0x84, 0xff, 	/*Color of index 161*/
-  0xb4, 0x90, 0x74, 0xff, 	/*Color of index 162*/
-  0x8f, 0x8c, 0x87, 0xff, 	/*Color of index 163*/
-  0x9d, 0x8d, 0x7a, 0xff, 	/*Color of index 164*/
-  0x91, 0x86, 0x79, 0xff, 	/*Color of index 165*/
-  0x92, 0x82, 0x6f, 0xff, 	/*Color of index 166*/
-  0x81, 0x7a, 0x72, 0xff, 	/*Color of index 167*/
-  0x8c, 0x7b, 0x67, 0xff, 	/*Color of index 168*/
-  0x97, 0x72, 0x67, 0xff, 	/*Color of index 169*/
-  0x83, 0x73, 0x60, 0xff, 	/*Color of index 170*/
-  0x74, 0x70, 0x6e, 0xff, 	/*Color of index 171*/
-  0x79, 0x6c, 0x5d, 0xff, 	/*Color of index 172*/
-  0x80, 0x6a, 0x53, 0xff, 	/*Color of index 173*/
-  0x67, 0x65, 0x63, 0xff, 	/*Color of index 174*/
-  0x9c, 0x6e, 0x27, 0xff, 	/*Color of index 175*/
-  0xa9, 0x70, 0x14, 0xff, 	/*Color of index 176*/
-  0x75, 0x63, 0x4f, 0xff, 	/*Color of index 177*/
-  0x66, 0x5f, 0x58, 0xff, 	/*Color of index 178*/
-  0xa0, 0x6a, 0x17, 0xff, 	/*Color of index 179*/
-  0x6b, 0x5b, 0x48, 0xff, 	/*Color of index 180*/
-  0x89, 0x60, 0x27, 0xff, 	/*Color of index 181*/
-  0x59, 0x56, 0x54, 0xff, 	/*Color of index 182*/
-  0x71, 0x58, 0x45, 0xff, 	/*Color of index 183*/
-  0x90, 0x5f, 0x19, 0xff, 	/*Color of index 184*/
-  0x93, 0x5f, 0x11, 0xff, 	/*Color of index 185*/
-  0x99, 0x5f, 0x09, 0xff, 	/*Color of index 186*/
-  0x65, 0x53, 0x42, 0xff, 	/*Color of index 187*/
-  0x84, 0x59, 0x1e, 0xff, 	/*Color of index 188*/
-  0x8b, 0x5a, 0x12, 0xff, 	/*Color of index 189*/
-  0x92, 0x5a, 0x0b, 0xff, 	/*Color of index 190*/
-  0x56, 0x4e, 0x47, 0xff, 	/*Color of index 191*/
-  0x92, 0x5b, 0x05, 0xff, 	/*Color of index 192*/
-  0x79, 0x54, 0x21, 0xff, 	/*Color of index 193*/
-  0x8e, 0x57, 0x0b, 0xff, 	/*Color of index 194*/
-  0x66, 0x4d, 0x3a, 0xff, 	/*Color of index 195*/
-  0x83, 0x53, 0x0f, 0xff, 	/*Color of index 196*/
-  0x59, 0x49, 0x37, 0xff, 	/*Color of index 197*/
-  0x63, 0x49, 0x32, 0xff, 	/*Color of index 198*/
-  0xb4, 0x44, 0x1c, 0xff, 	/*Color of index 199*/
-  0x50, 0x44, 0x3c, 0xff, 	/*Color of index 200*/
-  0x6a, 0x4a, 0x1c, 0xff, 	/*Color of index 201*/
-  0x5c, 0x44, 0x2e, 0xff, 	/*Color of index 202*/
-  0x72, 0x45, 0x1b, 0xff, 	/*Color of index 203*/
-  0x75, 0x49, 0x08, 0xff, 	/*Color of index 204*/
-  0x51, 0x40, 0x31, 0xff, 	/*Color of index 205*/
-  0x52, 0x3e, 0x2a, 0xff, 	/*Color of index 206*/
-  0x67, 0x43, 0x11, 0xff, 	/*Color of index 207*/
-  0x5d, 0x40, 0x1a, 0xff, 	/*Color of index 208*/
-  0x59, 0x3b, 0x2b, 0xff, 	/*Color of index 209*/
-  0x6f, 0x43, 0x06, 0xff, 	/*Color of index 210*/
-  0x3e, 0x39, 0x36, 0xff, 	/*Color of index 211*/
-  0x4b, 0x3a, 0x2b, 0xff, 	/*Color of index 212*/
-  0x68, 0x40, 0x08, 0xff, 	/*Color of index 213*/
-  0x4e, 0x3a, 0x22, 0xff, 	/*Color of index 214*/
-  0x92, 0x36, 0x18, 0xff, 	/*Color of index 215*/
-  0x5b, 0x3c, 0x13, 0xff, 	/*Color of index 216*/
-  0x68, 0x3f, 0x04, 0xff, 	/*Color of index 217*/
-  0x65, 0x3e, 0x08, 0xff, 	/*Color of index 218*/
-  0x43, 0x34, 0x29, 0xff, 	/*Color of index 219*/
-  0x4a, 0x34, 0x21, 0xff, 	/*Color of index 220*/
-  0x5b, 0x38, 0x0b, 0xff, 	/*Color of index 221*/
-  0x32, 0x30, 0x2c, 0xff, 	/*Color of index 222*/
-  0x4e, 0x34, 0x14, 0xff, 	/*Color of index 223*/
-  0x42, 0x31, 0x21, 0xff, 	/*Color of index 224*/
-  0x3d, 0x2d, 0x21, 0xff, 	/*Color of index 225*/
-  0x52, 0x2f, 0x09, 0xff, 	/*Color of index 226*/
-  0x32, 0x29, 0x1f, 0xff, 	/*Color of index 227*/
-  0x41, 0x2a, 0x10, 0xff, 	/*Color of index 228*/
-  0x32, 0x24, 0x18, 0xff, 	/*Color of index 229*/
-  0x29, 0x21, 0x1b, 0xff, 	/*Color of index 230*/
-  0x3c, 0x22, 0x04, 0xff, 	/*Color of index 231*/
-  0x21, 0x1c, 0x19, 0xff, 	/*Color of index 232*/
-  0x27, 0x1c, 0x13, 0xff, 	/*Color of index 233*/
-  0x2d, 0x1d, 0x09, 0xff, 	/*Color of index 234*/
-  0x23, 0x18, 0x12, 0xff, 	/*Color of index 235*/
-  0x1e, 0x15, 0x12, 0xff, 	/*Color of index 236*/
-  0x2e, 0x18, 0x01, 0xff, 	/*Color of index 237*/
-  0x21, 0x15, 0x0d, 0xff, 	/*Color of index 238*/
-  0x1a, 0x12, 0x0c, 0xff, 	/*Color of index 239*/
-  0x22, 0x11, 0x01, 0xff, 	/*Color of index 240*/
-  0x18, 0x0e, 0x0a, 0xff, 	/*Color of index 241*/
-  0x10, 0x0c, 0x0a, 0xff, 	/*Color of index 242*/
-  0x1d, 0x0a, 0x00, 0xff, 	/*Color of index 243*/
-  0x0b, 0x07, 0x04, 0xff, 	/*Color of index 244*/
-  0x12, 0x06, 0x01, 0xff, 	/*Color of index 245*/
-  0x08, 0x03, 0x02, 0xff, 	/*Color of index 246*/
-  0x8d, 0x4b, 0x4a, 0xff, 	/*Color of index 247*/
-  0x7b, 0x23, 0x1a, 0xff, 	/*Color of index 248*/
-  0x09, 0x08, 0x08, 0xff, 	/*Color of index 249*/
-  0x80, 0x7e, 0x7f, 0xff, 	/*Color of index 250*/
-  0xe1, 0xdf, 0xe2, 0xff, 	/*Color of index 251*/
-  0x7d, 0x68, 0x92, 0xff, 	/*Color of index 252*/
-  0x5e, 0x4d, 0x74, 0xff, 	/*Color of index 253*/
-  0x57, 0x3e, 0x5d, 0xff, 	/*Color of index 254*/
-  0x40, 0x28, 0x46, 0xff, 	/*Color of index 255*/
-
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 
-  0xf6, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0x02, 0xf6, 0x70, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0x02, 0xf6, 0x70, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0x02, 0xf6, 0x70, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x70, 0x02, 0xf6, 0x70, 0x02, 0xf6, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 
-  0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x21, 0x70, 0x21, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf4, 0x02, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x21, 0x70, 0x21, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf4, 0x02, 0xf4, 0x02, 0xf6, 0x21, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x21, 0x21, 0x21, 0x02, 0x02, 0x02, 0x02, 0x70, 0xf6, 0xf6, 0x02, 0x02, 0xf9, 0x21, 0x21, 0x21, 0xf4, 0xf9, 0x70, 0x02, 0x21, 0x02, 0x02, 0x70, 0x70, 0xf6, 0xf9, 0x02, 0xf9, 0x02, 0x02, 0xf4, 0x02, 0xf4, 0x02, 0x02, 0xf4, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0xf6, 0x02, 0x02, 0xf4, 0xf6, 0x02, 0x02, 0x21, 0xf6, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x21, 0x21, 0x21, 0x21, 0x02, 0x21, 0x21, 0x21, 0x21, 0xf9, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x21, 0x21, 0x21, 0x21, 0x21, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x21, 0x21, 0x21, 0x21, 0x70, 0x02, 0x02, 0x02, 0x21, 0x21, 0x70, 0x02, 0x70, 0xf4, 0xf4, 0x02, 0x02, 0xf9, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0xf9, 0x02, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x02, 0xf4, 0xef, 0xf6, 0x02, 0x21, 0x02, 0x21, 0x21, 0x21, 0x02, 0x21, 0x21, 0x21, 0x02, 0x02, 0x02, 0x02, 0xf2, 0x02, 0x21, 0x21, 0x21, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x21, 0x21, 0x21, 0x02, 0x70, 0x70, 0x70, 0x02, 0xf6, 0xf6, 0xf4, 0x70, 0xf6, 0x02, 0x21, 0x21, 0x02, 0x70, 0x70, 0x70, 0x21, 0x21, 0x21, 0x70, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x5a, 0xf9, 0xf2, 0xf2, 0xe8, 0x5a, 0xef, 0xe6, 0x6c, 0xe8, 0x5a, 0xf2, 0x5a, 0xf9, 0xef, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0xf2, 0xf9, 0xf9, 0xf9, 0xf6, 0xf2, 0xf2, 0xf6, 0x02, 0x02, 0x02, 0x21, 0x21, 0x21, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x21, 0x21, 0x02, 0x02, 0x02, 0x70, 0xf6, 0x70, 0xf6, 0x21, 0x70, 0xf2, 0x02, 0xf9, 0x21, 0x02, 0x02, 0x70, 0x02, 0x02, 0x21, 0x21, 0x5a, 0xe8, 0x6c, 0xd3, 0xbf, 0xae, 0xab, 0xfa, 0x9f, 0x9f, 0x9f, 0x98, 0x93, 0x6f, 0x6f, 0x83, 0x75, 0x83, 0xfb, 0x6f, 0x6f, 0x75, 0x6f, 0x37, 0x98, 0x9f, 0xa3, 0xab, 0xb2, 0xbf, 0x56, 0x6c, 0x6c, 0xe8, 0xec, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x70, 0x02, 0x02, 0xf9, 0xf6, 0x21, 0x21, 0x21, 0x21, 0x02, 0x02, 0x70, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x70, 0x02, 0x70, 0x70, 0x70, 0x02, 0x02, 0x02, 0x70, 0x02, 0x21, 0x02, 0x02, 0xf2, 0xea, 0xd3, 0x78, 0xae, 0xa3, 0x9a, 0x6f, 0x81, 0x7b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x7d, 0x7d, 0x83, 0x6f, 0x95, 0x9f, 0xae, 0x78, 0xe6, 0xe8, 0x02, 0x02, 0x02, 0x02, 0x70, 0x70, 0x70, 0x70, 0x70, 0x02, 0x21, 0x21, 0x21, 0x21, 0x02, 0x02, 0xf6, 0x70, 0x70, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0xf6, 0x70, 0x70, 0xf4, 0x70, 0x02, 0x02, 0x21, 0x21, 0x02, 0x20, 0x5a, 0x1f, 0xae, 0x69, 0x8f, 0x82, 0x7d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x00, 0x7b, 0x8f, 0xfa, 0xfa, 0x75, 0x00, 0x75, 0xa7, 0x78, 0x95, 0x7b, 0x77, 0x8f, 0x00, 0x8f, 0xfa, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x7b, 0x6f, 0x93, 0x9f, 0xac, 0x56, 0xe8, 0x02, 0x02, 0x02, 0x70, 0x70, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x02, 0xf6, 0xf6, 0x70, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0xf6, 0x70, 0x70, 0x70, 0x70, 0x70, 0x02, 0x21, 0x20, 0x20, 0x1d, 0x15, 0x0c, 0x08, 0x05, 0x00, 0x00, 0x6e, 0x71, 0x22, 0x79, 0x83, 0xa3, 0xb6, 0xb6, 0x95, 0x00, 0x95, 0xa7, 0xde, 0x02, 0xab, 0x00, 0x95, 0xf9, 0xf1, 0x6f, 0x00, 0xb6, 0xab, 0x22, 0xb2, 0x02, 0x9f, 0x00, 0x95, 0xae, 0xa3, 0xfb, 0x00, 0x71, 0x8f, 0x9f, 0x77, 0x93, 0x5f, 0x00, 0x01, 0xfb, 0x7b, 0x7c, 0x7c, 0x5f, 0x74, 0x37, 0x69, 0x78, 0x5a, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x70, 0x70, 0x02, 0x21, 0x20, 0x1d, 0x50, 0x0c, 0x11, 0x0b, 0x50, 0x08, 0x00, 0x79, 0x7a, 0x01, 0x79, 0x9f, 0xe6, 0x02, 0x02, 0x02, 0xb6, 0x81, 0xb6, 0x8f, 0xfa, 0x02, 0xd3, 0x22, 0x8a, 0xec, 0xde, 0x7d, 0x00, 0xb6, 0xab, 0x79, 0xb6, 0x02, 0x95, 0x7b, 0xf6, 0x02, 0xf9, 0x8f, 0x00, 0xb6, 0xf2, 0x02, 0xef, 0xe6, 0xde, 0x9f, 0x79, 0x75, 0x82, 0x83, 0x81, 0x5f, 0x04, 0x5b, 0x22, 0x5b, 0x2d, 0x0a, 0x58, 0x21, 0x02, 0x70, 0x70, 0x70, 0x70, 0xf6, 0x02, 0x21, 0x21, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0xf6, 0x70, 0x70, 0x21, 0x20, 0x20, 0x15, 0x0c, 0x16, 0x16, 0x17, 0x16, 0x1a, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x8a, 0x59, 0xf6, 0xb2, 0x77, 0xe6, 0xe8, 0xa3, 0xe6, 0x95, 0x79, 0xf6, 0xe3, 0x7d, 0x8f, 0x5a, 0xd3, 0x7d, 0x00, 0xab, 0xab, 0x79, 0xbf, 0x02, 0x98, 0x7b, 0x9f, 0x93, 0x75, 0x00, 0x98, 0x02, 0xf1, 0xe3, 0x70, 0x02, 0x02, 0xe6, 0x83, 0x00, 0x75, 0x7b, 0x83, 0x6f, 0x06, 0x24, 0x06, 0x36, 0x0a, 0x0a, 0x0a, 0x09, 0x6b, 0x5a, 0x02, 0x70, 0x70, 0x70, 0x21, 0x20, 0x21, 0x21, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x70, 0xf6, 0x70, 0xf6, 0x70, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x21, 0x21, 0x20, 0xfd, 0x0d, 0x1a, 0x17, 0x19, 0x19, 0x14, 0x17, 0x16, 0x04, 0x03, 0x72, 0x00, 0x95, 0xf2, 0xae, 0x00, 0x00, 0x79, 0xa7, 0x56, 0x02, 0x9a, 0x00, 0xf2, 0xe3, 0x7d, 0x37, 0xef, 0xd3, 0x7b, 0x22, 0xab, 0xab, 0x00, 0xbf, 0x02, 0x98, 0x79, 0x00, 0x00, 0x00, 0x00, 0xae, 0x02, 0xb6, 0x71, 0x00, 0x8a, 0x56, 0x70, 0x75, 0x7d, 0x85, 0x7b, 0x5f, 0x07, 0x07, 0x09, 0x0b, 0x0d, 0x0d, 0x16, 0x11, 0x50, 0x0a, 0x32, 0x46, 0xe6, 0x02, 0x02, 0x02, 0x20, 0x21, 0x21, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x20, 0x1b, 0x0d, 0x1a, 0x1a, 0x19, 0x19, 0x18, 0x19, 0x17, 0x1a, 0x05, 0x01, 0x22, 0x00, 0x95, 0x5a, 0xab, 0x7d, 0x96, 0x95, 0x75, 0x78, 0xf6, 0xa3, 0x8f, 0x02, 0x6c, 0xfb, 0x8a, 0xe8, 0xd3, 0x7b, 0x00, 0xab, 0xae, 0x00, 0xb6, 0x02, 0x77, 0x00, 0x72, 0x7b, 0x01, 0x71, 0xb6, 0xf4, 0xd3, 0xae, 0xa7, 0xab, 0xd3, 0x5a, 0x65, 0x00, 0x75, 0xfb, 0x04, 0x2d, 0x44, 0x4e, 0x4e, 0x10, 0x4c, 0x10, 0x16, 0x16, 0x11, 0x50, 0x2d, 0x68, 0x56, 0x70, 0x21, 0x02, 0x20, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x21, 0x21, 0x1f, 0x0a, 0x17, 0x1e, 0x13, 0x1c, 0x18, 0x18, 0x19, 0x19, 0x1a, 0x06, 0x03, 0x01, 0x00, 0x8a, 0x5a, 0xd3, 0x8f, 0xa7, 0x98, 0x83, 0x78, 0xf6, 0x56, 0xe3, 0x02, 0xdb, 0x7d, 0x6f, 0xeb, 0xd3, 0x72, 0x00, 0xfa, 0xae, 0x22, 0xb2, 0x02, 0x9a, 0x00, 0x7d, 0x7b, 0xfb, 0x22, 0xb2, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0xae, 0x01, 0x72, 0x7e, 0x04, 0x04, 0x08, 0x49, 0x10, 0x4c, 0x4c, 0x0f, 0x14, 0x0f, 0x0f, 0x16, 0x1b, 0x50, 0x06, 0x37, 0x56, 0x70, 0x21, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf6, 0xf6, 0x02, 0x21, 0x20, 0x1d, 0x0b, 0x16, 0x1c, 0x1c, 0x1c, 0x1c, 0x18, 0x1c, 0x17, 0x1a, 0x06, 0x23, 0x22, 0x01, 0x6f, 0xe6, 0x56, 0x00, 0x6e, 0x00, 0x7d, 0xc8, 0x02, 0x9f, 0x77, 0xf4, 0x78, 0x7b, 0x75, 0xe6, 0xd3, 0x72, 0x79, 0xab, 0xae, 0x00, 0xae, 0x02, 0x95, 0x00, 0x00, 0x00, 0x01, 0x79, 0xb6, 0xf2, 0xd3, 0xfa, 0xab, 0xfa, 0x69, 0xfb, 0x6e, 0x72, 0x74, 0x01, 0x05, 0x09, 0x0d, 0x0f, 0x12, 0x14, 0x12, 0x12, 0x13, 0x18, 0x14, 0x10, 0x1b, 0x47, 0x05, 0x69, 0xe6, 0xf2, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x20, 0x1d, 0x0b, 0x17, 0x1c, 0x18, 0x1c, 0x1c, 0x18, 0x18, 0x17, 0x1a, 0x07, 0x22, 0x01, 0x00, 0x83, 0x6c, 0xe8, 0x00, 0x00, 0x7b, 0x6f, 0xb6, 0x02, 0x6f, 0x00, 0xa7, 0xd3, 0xfb, 0x8a, 0xec, 0x56, 0x00, 0x00, 0x56, 0xae, 0x79, 0xb2, 0x02, 0x8a, 0x00, 0x8f, 0x93, 0x83, 0x00, 0xb6, 0x02, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x6e, 0x7b, 0x03, 0x06, 0x0b, 0x10, 0x0e, 0x12, 0x14, 0x12, 0x12, 0x13, 0x18, 0x13, 0x14, 0x1a, 0x1b, 0x07, 0x65, 0xb6, 0x70, 0x70, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf6, 0x02, 0x21, 0x21, 0x1d, 0x0b, 0x17, 0x19, 0x1c, 0x1c, 0x1c, 0x18, 0x19, 0x17, 0x1a, 0x06, 0x03, 0x03, 0x71, 0x7d, 0xd3, 0x02, 0xae, 0xae, 0xd3, 0x7d, 0xa7, 0x02, 0xa7, 0x8a, 0x5a, 0x02, 0x78, 0x8a, 0x6c, 0xeb, 0x9a, 0xa7, 0x02, 0x78, 0x7b, 0xb2, 0x02, 0xae, 0xb6, 0x02, 0xf9, 0xd3, 0x75, 0xb2, 0x02, 0xf2, 0xc8, 0xb6, 0xab, 0xab, 0xa7, 0x65, 0x73, 0x5f, 0x04, 0x2d, 0x49, 0x10, 0x13, 0x13, 0x12, 0x0f, 0x13, 0x18, 0x18, 0x18, 0x14, 0x1a, 0x1b, 0x3e, 0x05, 0xa7, 0xf2, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x21, 0x21, 0x1f, 0x49, 0x16, 0x19, 0x18, 0x1c, 0x1c, 0x18, 0x1c, 0x17, 0x15, 0x07, 0x00, 0x00, 0x00, 0x5f, 0xc8, 0x02, 0x02, 0x02, 0xab, 0x79, 0x37, 0xec, 0x78, 0x95, 0xec, 0x02, 0x78, 0x7b, 0xfa, 0x02, 0x02, 0x02, 0x02, 0xb6, 0x75, 0xd3, 0x02, 0xf2, 0x02, 0x02, 0x02, 0x02, 0xb2, 0xe6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x98, 0x79, 0x5f, 0x03, 0x08, 0x11, 0x17, 0x13, 0x13, 0x14, 0x13, 0x12, 0x18, 0x13, 0x18, 0x19, 0x17, 0x1b, 0x0a, 0x04, 0x46, 0xef, 0x02, 0xf9, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf9, 0xf4, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x21, 0x20, 0x15, 0x16, 0x17, 0x1c, 0x18, 0x18, 0x1c, 0x17, 0x1a, 0x1b, 0x04, 0x04, 0x7b, 0x7a, 0x73, 0xab, 0xe6, 0xe3, 0xae, 0x7d, 0x72, 0x71, 0x75, 0x75, 0x00, 0x74, 0x98, 0x75, 0x00, 0x75, 0x95, 0x77, 0x8f, 0x77, 0x87, 0x79, 0x98, 0xa3, 0x98, 0xa3, 0xa3, 0xa5, 0xa7, 0xa3, 0xfa, 0xb6, 0xb6, 0xc8, 0xde, 0xde, 0xd3, 0xb2, 0xfb, 0x00, 0x7b, 0x03, 0x08, 0x11, 0x17, 0x18, 0x13, 0x18, 0x13, 0x18, 0x18, 0x18, 0x18, 0x19, 0x54, 0x57, 0x0a, 0x66, 0xa3, 0xf2, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf9, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf4, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x21, 0x21, 0x20, 0x1b, 0x11, 0x17, 0x19, 0x19, 0x1c, 0x17, 0x17, 0x11, 0x0c, 0x79, 0x01, 0x01, 0x71, 0x00, 0x81, 0x85, 0xfb, 0x00, 0x71, 0x7b, 0x7d, 0x00, 0x71, 0x7b, 0x00, 0x00, 0x00, 0x72, 0x72, 0x00, 0x00, 0x00, 0x22, 0x71, 0x79, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x7a, 0x71, 0x22, 0x00, 0x81, 0x04, 0x03, 0x0a, 0x1a, 0x14, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x1a, 0x57, 0x0a, 0x05, 0x4f, 0xf2, 0x02, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x21, 0x1f, 0x15, 0x16, 0x17, 0x1a, 0x17, 0x16, 0x1b, 0x0c, 0x07, 0x00, 0x7b, 0x7a, 0x7a, 0x7c, 0x6e, 0x71, 0x79, 0x7d, 0x7d, 0x7b, 0x7c, 0x7d, 0x7f, 0x7d, 0x72, 0x7a, 0x83, 0x72, 0x79, 0x7d, 0x7f, 0x7a, 0x7b, 0x7a, 0x7b, 0x7a, 0x7a, 0x7d, 0x00, 0x71, 0x7a, 0x00, 0x72, 0x71, 0x00, 0x00, 0x71, 0x6e, 0x00, 0x00, 0x72, 0x79, 0xfb, 0x7b, 0x04, 0x0c, 0x1b, 0x17, 0x19, 0x18, 0x19, 0x18, 0x18, 0x1c, 0x19, 0x19, 0x17, 0x1e, 0x1b, 0x3c, 0x32, 0xb2, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0x21, 0x21, 0x20, 0x1e, 0x15, 0x0d, 0x16, 0x16, 0x1b, 0x1b, 0xfc, 0x95, 0x83, 0x9f, 0x96, 0x94, 0x77, 0x77, 0xa3, 0xa3, 0xfa, 0x77, 0xa5, 0x9f, 0xa1, 0xa3, 0x77, 0x9f, 0x9f, 0xa5, 0x77, 0x9a, 0x9f, 0x77, 0xa3, 0x77, 0x77, 0x9f, 0x9a, 0x98, 0x9a, 0x93, 0x95, 0x93, 0x8c, 0x6f, 0x87, 0x75, 0x85, 0x80, 0x82, 0x73, 0x74, 0x74, 0x74, 0xfb, 0x83, 0x2d, 0xfc, 0x1b, 0x1a, 0x17, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x1a, 0x1e, 0x15, 0x3e, 0x69, 0x58, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1f, 0x15, 0x15, 0x1b, 0x1b, 0x1d, 0x1d, 0xff, 0xb6, 0xab, 0xc5, 0xbb, 0x78, 0xc5, 0x78, 0xbf, 0x56, 0xc8, 0xbf, 0xb6, 0x78, 0xbf, 0xb6, 0xc8, 0xb2, 0x78, 0xb6, 0xb6, 0xbf, 0xbf, 0x78, 0xbf, 0xc8, 0xbf, 0x78, 0xbf, 0xbf, 0xbf, 0x78, 0xbf, 0x78, 0xbf, 0xb6, 0xb6, 0xb2, 0xb6, 0xae, 0xac, 0xfa, 0xa7, 0xa5, 0xfa, 0xa3, 0xfa, 0xfa, 0xfd, 0x15, 0x1b, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1b, 0x1e, 0x53, 0x0a, 0x46, 0xb6, 0x5a, 0x02, 0x02, 0x02, 0xf2, 0xe6, 0xde, 0x56, 0xbf, 0xb6, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xab, 0xae, 0xa7, 0xab, 0xa7, 0xa7, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xa7, 0xab, 0xab, 0xae, 0xae, 0xb2, 0xb6, 0xb6, 0x78, 0x78, 0x78, 0xd3, 0xd3, 0x6c, 0xe6, 0xe8, 0xef, 0xf2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0x02, 0xf2, 0xd3, 0xae, 0xa3, 0x9a, 0x09, 0x08, 0x08, 0x37, 0x08, 0x37, 0x8a, 0x87, 0x85, 0x85, 0x75, 0x85, 0x75, 0x75, 0x75, 0x75, 0x75, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x74, 0x7d, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x83, 0x6f, 0x75, 0x87, 0x6f, 0x8a, 0x8a, 0x8f, 0x95, 0x93, 0x98, 0x98, 0x9a, 0x9a, 0x9a, 0xa1, 0x9f, 0xa3, 0xa3, 0xa5, 0xa7, 0xa5, 0xab, 0xfa, 0x46, 0xfc, 0x0c, 0x1b, 0x15, 0x1e, 0x1b, 0x1e, 0x1b, 0x1b, 0x1b, 0xfd, 0x46, 0x4f, 0xab, 0x4f, 0xab, 0xa3, 0x95, 0x6f, 0x83, 0xfb, 0x01, 0x22, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x7b, 0xfb, 0xfb, 0x83, 0x6f, 0x8a, 0x95, 0x77, 0xfa, 0xae, 0xb6, 0x56, 0xde, 0xe8, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x70, 0xf6, 0xf6, 0x02, 0x02, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0x02, 0xf4, 0x02, 0x02, 0xf4, 0xf9, 0x70, 0x02, 0xf9, 0x56, 0xfa, 0x8a, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x72, 0x7b, 0x7b, 0x04, 0x2d, 0x2d, 0x07, 0x07, 0x07, 0x07, 0x2d, 0x2d, 0x2d, 0x65, 0x23, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x7d, 0x83, 0x8a, 0x37, 0xa3, 0xab, 0x56, 0xe6, 0x5a, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf9, 0xf2, 0x02, 0x02, 0x5a, 0xae, 0x8a, 0x22, 0x00, 0x00, 0x00, 0x00, 0x71, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x79, 0x79, 0x71, 0x00, 0x71, 0x00, 0x00, 0x79, 0x79, 0x79, 0x22, 0x71, 0x22, 0x00, 0x79, 0x22, 0x22, 0x00, 0x6e, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x6e, 0x00, 0x00, 0x00, 0x79, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xfb, 0x37, 0x77, 0xa7, 0x78, 0xe8, 0xf2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf2, 0x02, 0xf2, 0x02, 0xf4, 0xb6, 0x93, 0x01, 0x00, 0x22, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x71, 0x71, 0x71, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x71, 0x22, 0x00, 0x00, 0x22, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x83, 0x95, 0xfa, 0x56, 0xe3, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf4, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf4, 0x02, 0xf2, 0xfa, 0x7b, 0x00, 0x00, 0x22, 0x79, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x6e, 0x6e, 0x22, 0x00, 0x00, 0x00, 0x71, 0x6e, 0x6e, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x75, 0x9a, 0xae, 0x6c, 0xf9, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf9, 0x02, 0x02, 0x5a, 0xa3, 0x00, 0x00, 0x00, 0x6e, 0x22, 0x00, 0x22, 0x79, 0x00, 0x22, 0x00, 0x71, 0x71, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x6e, 0x00, 0x00, 0x6e, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x79, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x75, 0x9a, 0xb2, 0xe8, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf9, 0x9f, 0x79, 0x22, 0x00, 0x71, 0x71, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x79, 0x79, 0x22, 0x71, 0x22, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x8a, 0xa7, 0xf9, 0x02, 0x02, 0x02, 0xf9, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0xf4, 0xf4, 0x02, 0xae, 0x72, 0x00, 0x00, 0x71, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x79, 0x22, 0x00, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x22, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x22, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x75, 0xb6, 0x02, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xde, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x00, 0x00, 0x71, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x72, 0x01, 0x7d, 0xfb, 0x6f, 0x6f, 0x8a, 0x8f, 0x37, 0x37, 0x93, 0x37, 0x8f, 0x37, 0x8a, 0x6f, 0x6f, 0x83, 0xfb, 0x04, 0x03, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x79, 0x71, 0x71, 0x6e, 0x7a, 0x22, 0x22, 0x22, 0x01, 0x00, 0x00, 0x00, 0x79, 0x71, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x98, 0xd3, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x21, 0xf6, 0x21, 0x21, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf4, 0xa3, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x79, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x7d, 0x74, 0x6f, 0x93, 0x9f, 0xa7, 0xb2, 0xbf, 0xd3, 0xeb, 0xee, 0xf1, 0xf5, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf2, 0xee, 0xe6, 0xe6, 0xe3, 0xd3, 0xc8, 0xb6, 0xb2, 0xa7, 0xa3, 0x98, 0x8f, 0x6f, 0x83, 0x7d, 0x79, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x72, 0x79, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x71, 0x00, 0x00, 0x00, 0x65, 0xb6, 0xf2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x6c, 0x75, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x75, 0x93, 0xa1, 0xac, 0xbf, 0xde, 0xf0, 0xf5, 0xf6, 0x02, 0xf6, 0xf6, 0xf5, 0xf3, 0xf0, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed, 0xea, 0xed, 0xed, 0xe7, 0xed, 0xe7, 0xed, 0xed, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf2, 0xe9, 0xde, 0x78, 0xac, 0xfa, 0x95, 0x6f, 0x7d, 0x22, 0x00, 0x22, 0x23, 0x01, 0x23, 0x00, 0x00, 0x7a, 0x6e, 0x00, 0x71, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x71, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x79, 0x00, 0x5f, 0xb2, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xae, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x7b, 0x8f, 0xa5, 0xb6, 0xdb, 0xf1, 0xf6, 0xf6, 0xf6, 0xf5, 0xed, 0xe7, 0xe4, 0xe2, 0xdf, 0xd0, 0xc9, 0xc9, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xc1, 0xbc, 0xc1, 0xc1, 0xc9, 0xcf, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe7, 0xe7, 0xe7, 0xea, 0xf0, 0xf0, 0xf0, 0xf5, 0xf6, 0xf6, 0x02, 0xf6, 0xf3, 0xe6, 0x78, 0xab, 0x9f, 0x75, 0x01, 0x00, 0x00, 0x71, 0x72, 0x6e, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x71, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x72, 0x71, 0x01, 0x79, 0xfb, 0x78, 0x02, 0xf6, 0xf9, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0xf4, 0x02, 0x02, 0x02, 0x5a, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x6f, 0xa3, 0x56, 0xe8, 0xf4, 0xf6, 0xf5, 0xf0, 0xe7, 0xdd, 0xd0, 0xc9, 0xc1, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb8, 0xc1, 0xbc, 0xb5, 0xbc, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc9, 0xc9, 0xd0, 0xd0, 0xd8, 0xdf, 0xe4, 0xe7, 0xed, 0xf3, 0xf5, 0xf6, 0xf6, 0xef, 0xdb, 0xbf, 0x77, 0x81, 0x00, 0x71, 0x6e, 0x6e, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x7a, 0x79, 0x7a, 0x79, 0x7a, 0x79, 0x7a, 0x01, 0x7a, 0x01, 0x7a, 0x01, 0x7a, 0x01, 0x7a, 0x01, 0x7a, 0x01, 0x7a, 0x01, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x01, 0x7a, 0x01, 0x7a, 0x01, 0x7a, 0x79, 0x6e, 0x71, 0x6e, 0x71, 0x71, 0x71, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x79, 0x7b, 0x00, 0x01, 0x79, 0x00, 0x37, 0xe8, 0x02, 0x02, 0x02, 0x02, 0xf2, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0xf9, 0x6c, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x8a, 0xb2, 0xe9, 0xf2, 0xf6, 0xf5, 0xe7, 0xdf, 0xc9, 0xbc, 0xb5, 0xaf, 0xb5, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb3, 0xb3, 0xaf, 0xaf, 0xb0, 0xaf, 0xb3, 0xb3, 0xb3, 0xaf, 0xb3, 0xaf, 0xaf, 0xb5, 0xc2, 0xbc, 0xb5, 0xbc, 0xb5, 0xb5, 0xb5, 0xbc, 0xb5, 0xb5, 0xb5, 0xb5, 0xc1, 0xc1, 0xb5, 0xc1, 0xc1, 0xc9, 0xc6, 0xd6, 0xe4, 0xed, 0xf0, 0xf5, 0xf3, 0xef, 0xe1, 0xa3, 0x72, 0x00, 0x71, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x79, 0x7a, 0x72, 0x72, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f, 0x7d, 0x74, 0x7f, 0x7f, 0x7f, 0xfb, 0x7f, 0x74, 0x7f, 0x7f, 0x74, 0xfb, 0x74, 0x74, 0x74, 0xfb, 0x74, 0xfb, 0x74, 0x7f, 0x74, 0x7f, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x7f, 0x74, 0x7f, 0x7f, 0x7f, 0x74, 0x74, 0x7f, 0x74, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x7d, 0x73, 0x7b, 0x7c, 0x72, 0x72, 0x01, 0x7a, 0x79, 0x71, 0x71, 0x71, 0x00, 0x71, 0x71, 0x00, 0x71, 0x7a, 0x01, 0x71, 0x00, 0xab, 0x02, 0x02, 0xf2, 0x02, 0x02, 0x21, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf4, 0x21, 0xf9, 0x02, 0x21, 0xab, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xa7, 0xf3, 0xf6, 0x02, 0xf0, 0xdd, 0xbb, 0xaf, 0xb5, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb0, 0xaf, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb0, 0xb0, 0xaf, 0xaf, 0xaf, 0xaf, 0xb3, 0xbd, 0xc2, 0xb8, 0xb8, 0xb8, 0xbd, 0xb9, 0xb9, 0xb9, 0xb8, 0xb8, 0xb8, 0xb8, 0xbc, 0xb8, 0xb5, 0xbc, 0xb5, 0xb5, 0xb5, 0xb5, 0xbc, 0xc1, 0xbc, 0xc9, 0xd8, 0xe7, 0xf3, 0xf3, 0xf0, 0xe0, 0x95, 0x00, 0x22, 0x71, 0x01, 0x71, 0x22, 0x71, 0x79, 0x00, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x71, 0x71, 0x7a, 0x7a, 0x7d, 0x73, 0x7f, 0x7d, 0x7f, 0x74, 0x7f, 0x74, 0x81, 0x81, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x81, 0x74, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x7c, 0x81, 0x81, 0x74, 0x74, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x74, 0x74, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x73, 0x74, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x74, 0x73, 0x74, 0x82, 0x81, 0x80, 0x74, 0x7f, 0x74, 0x74, 0x74, 0x80, 0x74, 0x7f, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x7f, 0x7d, 0x7c, 0x72, 0x71, 0x71, 0x71, 0x71, 0x00, 0x79, 0x72, 0x79, 0x00, 0x7b, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x21, 0x02, 0x37, 0x00, 0x01, 0x22, 0x00, 0x71, 0xbf, 0x02, 0xf5, 0xe7, 0xc9, 0xb5, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xaf, 0xb0, 0xaf, 0xb3, 0xbe, 0xc2, 0xc4, 0xcc, 0xcc, 0xc4, 0xc2, 0xb8, 0xbd, 0xb8, 0xba, 0xba, 0xba, 0xb9, 0xba, 0xb3, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb8, 0xb9, 0xbd, 0xb8, 0xb8, 0xaf, 0xbc, 0xbc, 0xc1, 0xe7, 0xed, 0xf6, 0xe9, 0xa5, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x00, 0x72, 0x00, 0x00, 0x00, 0x71, 0x72, 0x79, 0x7f, 0x73, 0x7f, 0x7f, 0x74, 0x74, 0x74, 0x73, 0x74, 0x74, 0x73, 0x7c, 0x73, 0x74, 0x74, 0x7f, 0x74, 0x74, 0x74, 0x74, 0x74, 0x83, 0x81, 0x74, 0x7f, 0x7c, 0x7f, 0x85, 0x74, 0x81, 0x74, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x81, 0x74, 0x7f, 0x7d, 0x73, 0x7c, 0x7f, 0x81, 0x82, 0x7f, 0x73, 0x7c, 0x7f, 0x74, 0x7f, 0x74, 0x7f, 0x7f, 0x7f, 0x81, 0x80, 0x73, 0x7c, 0x73, 0x73, 0x74, 0x73, 0x7f, 0x73, 0x74, 0x73, 0x74, 0x7f, 0x74, 0x74, 0x74, 0x7f, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x81, 0x81, 0x80, 0x81, 0x72, 0x7a, 0x79, 0x71, 0x71, 0x79, 0x71, 0x00, 0xae, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x21, 0x6c, 0x00, 0x00, 0x22, 0x00, 0x00, 0xa7, 0xf6, 0xf3, 0xdd, 0xc1, 0xaf, 0xaf, 0xaf, 0xaf, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb0, 0xb0, 0xaf, 0xb0, 0xaf, 0xb0, 0xb9, 0xbd, 0xc2, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0xc4, 0xbd, 0xbd, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb3, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb3, 0xb9, 0xba, 0xb9, 0xb9, 0xb3, 0xb5, 0xb5, 0xc9, 0xd0, 0xe7, 0xf6, 0xeb, 0x9a, 0x00, 0x00, 0x79, 0x71, 0x00, 0x71, 0x71, 0x00, 0x71, 0x7a, 0x7c, 0x7f, 0x7f, 0x7f, 0x74, 0x74, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x73, 0x7d, 0x7f, 0x74, 0x7f, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x74, 0x80, 0x7f, 0x7e, 0x81, 0x81, 0x7f, 0x7c, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x73, 0x7e, 0x7f, 0x74, 0x80, 0x74, 0x82, 0x73, 0x7c, 0x73, 0x80, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x73, 0x73, 0x73, 0x74, 0x80, 0x74, 0x80, 0x73, 0x73, 0x73, 0x73, 0x7f, 0x7f, 0x74, 0x80, 0x74, 0x7f, 0x73, 0x7f, 0x7f, 0x74, 0x7f, 0x7f, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x7f, 0x7d, 0x72, 0x79, 0x71, 0x71, 0x79, 0x00, 0x75, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x21, 0xf9, 0x02, 0xae, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xf0, 0xf5, 0xd8, 0xb5, 0xaf, 0xaf, 0xaf, 0xb9, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb0, 0xaf, 0xb0, 0xaf, 0xb3, 0xc2, 0xc4, 0xd2, 0xcc, 0xd2, 0xd2, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0xc4, 0xbd, 0xbd, 0xb9, 0xba, 0xba, 0xba, 0xb9, 0xba, 0xb3, 0xba, 0xb9, 0xba, 0xb9, 0xb3, 0xba, 0xb3, 0xba, 0xb3, 0xba, 0xb3, 0xc0, 0xba, 0xba, 0xb9, 0xb8, 0xb5, 0xb5, 0xca, 0xe4, 0xf5, 0xdb, 0xfb, 0x71, 0x79, 0x22, 0x22, 0x79, 0x79, 0x00, 0x72, 0x7d, 0x7d, 0x72, 0x7c, 0x7d, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x7f, 0x74, 0x7f, 0x7f, 0x7f, 0x74, 0x7d, 0x7c, 0x73, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x74, 0x7f, 0x81, 0x80, 0x7f, 0x7e, 0x81, 0x82, 0x7f, 0x82, 0x81, 0x81, 0x80, 0x80, 0x74, 0x7f, 0x74, 0x80, 0x74, 0x80, 0x74, 0x7f, 0x7f, 0x80, 0x74, 0x7f, 0x7f, 0x7e, 0x73, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x74, 0x7f, 0x73, 0x74, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x74, 0x80, 0x74, 0x7f, 0x7f, 0x7f, 0x74, 0x74, 0x80, 0x74, 0x74, 0x74, 0x7f, 0x74, 0x80, 0x74, 0x7f, 0x7f, 0x72, 0x79, 0x71, 0x79, 0x7a, 0x00, 0x6c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x95, 0x00, 0x22, 0x71, 0x71, 0xb4, 0xf0, 0xf3, 0xb5, 0xaf, 0xb3, 0xaf, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xaf, 0xb0, 0xaf, 0xb3, 0xb8, 0xc4, 0xcc, 0xd9, 0xd9, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd9, 0xd5, 0xcc, 0xd2, 0xcc, 0xc4, 0xbd, 0xbd, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb3, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xc0, 0xb3, 0xba, 0xb3, 0xba, 0xb9, 0xb9, 0xb8, 0xbc, 0xc9, 0xc9, 0xca, 0xf0, 0xf0, 0x6f, 0x22, 0x71, 0x00, 0x79, 0x71, 0x00, 0x71, 0x79, 0x7b, 0x73, 0x74, 0x7f, 0x73, 0x7c, 0x7c, 0x7c, 0x72, 0x7a, 0x71, 0x7a, 0x72, 0x72, 0x7c, 0x7e, 0x7f, 0x7f, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7c, 0x80, 0x80, 0x7c, 0x7c, 0x73, 0x7a, 0x7a, 0x7a, 0x7c, 0x72, 0x7c, 0x7a, 0x72, 0x7a, 0x7c, 0x72, 0x7c, 0x7c, 0x7c, 0x7a, 0x7c, 0x7c, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x74, 0x7f, 0x74, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x74, 0x80, 0x74, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x74, 0x80, 0x74, 0x7e, 0x7b, 0x71, 0x79, 0x71, 0x00, 0xab, 0x02, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0xf9, 0x02, 0x02, 0x5a, 0x03, 0x00, 0x00, 0x00, 0x8c, 0xe9, 0xf3, 0xd6, 0xad, 0xb3, 0xb3, 0xb3, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xaf, 0xb0, 0xb8, 0xbd, 0xcc, 0xd2, 0xd9, 0xd9, 0xd9, 0xcc, 0xd9, 0xd9, 0xd2, 0xd2, 0xcf, 0xd2, 0xd2, 0xd5, 0xd9, 0xd9, 0xcc, 0xc4, 0xc2, 0xbd, 0xbd, 0xb8, 0xbd, 0xb8, 0xb8, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb3, 0xbd, 0xb9, 0xb9, 0xba, 0xb9, 0xba, 0xbe, 0xb8, 0xbd, 0xc9, 0xc1, 0xc9, 0xed, 0xed, 0x8a, 0x00, 0x22, 0x00, 0x79, 0x00, 0x00, 0x7a, 0x01, 0x7a, 0x7c, 0x72, 0x7a, 0x71, 0x7a, 0x7f, 0x75, 0x85, 0x8a, 0x8a, 0x8f, 0x87, 0x82, 0x7c, 0x7a, 0x7f, 0x80, 0x7b, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x82, 0x7f, 0x7c, 0x7e, 0x85, 0x8d, 0x98, 0x9f, 0xa1, 0xa1, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa1, 0x77, 0x9a, 0x98, 0x96, 0x8f, 0x75, 0x7c, 0x72, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7c, 0x7f, 0x7f, 0x73, 0x72, 0x7a, 0x72, 0x7a, 0x72, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a, 0x72, 0x72, 0x72, 0x7a, 0x7a, 0x71, 0x71, 0x7a, 0x7a, 0x7c, 0x73, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7d, 0x7a, 0x71, 0x71, 0x00, 0x93, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x21, 0x21, 0x02, 0x56, 0x00, 0x00, 0x00, 0x71, 0xa6, 0xf3, 0xf0, 0xb5, 0xaf, 0xaf, 0xb3, 0xb0, 0xb0, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb3, 0xaf, 0xb3, 0xb0, 0xb3, 0xb0, 0xaf, 0xb3, 0xc2, 0xcc, 0xd2, 0xd2, 0xd2, 0xd5, 0xd5, 0xd5, 0xda, 0xd2, 0xd9, 0xd2, 0xd5, 0xd2, 0xcf, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xcc, 0xbd, 0xb8, 0xbc, 0xb8, 0xbc, 0xbd, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xb8, 0xb9, 0xb8, 0xb9, 0xb8, 0xb9, 0xb8, 0xb3, 0xb9, 0xb9, 0xb3, 0xc4, 0xc4, 0xc9, 0xd0, 0xea, 0xee, 0x8a, 0x00, 0x01, 0x71, 0x79, 0x71, 0x79, 0x00, 0x7a, 0x72, 0x71, 0x7a, 0x8c, 0xa5, 0xb4, 0xc5, 0xdb, 0xe3, 0xe5, 0xe5, 0xe9, 0xe3, 0xe5, 0xae, 0x87, 0x7a, 0x7c, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x71, 0x87, 0xac, 0xe0, 0xe3, 0xea, 0xea, 0xeb, 0xed, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xeb, 0xe9, 0xe5, 0xe0, 0xb4, 0x96, 0x7c, 0x7b, 0x80, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x74, 0x7f, 0x73, 0x7c, 0x82, 0x96, 0xa6, 0xac, 0xac, 0xb2, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xb2, 0xb1, 0xac, 0xaa, 0xa7, 0xa5, 0xa1, 0x9c, 0x98, 0x8c, 0x81, 0x7c, 0x7a, 0x7e, 0x7f, 0x7f, 0x74, 0x7f, 0x7b, 0x71, 0x71, 0x71, 0x7d, 0xde, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x21, 0xf6, 0x02, 0x9f, 0x00, 0x22, 0x22, 0xfb, 0xc8, 0xf3, 0xe7, 0xaf, 0xaf, 0xb3, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xaf, 0xb0, 0xb8, 0xaf, 0xaf, 0xaf, 0xbd, 0xcc, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xda, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xc4, 0xc4, 0xb5, 0xb8, 0xb5, 0xbd, 0xbd, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb8, 0xb9, 0xb3, 0xb9, 0xb8, 0xc4, 0xc1, 0xc9, 0xd0, 0xf0, 0xea, 0x75, 0x00, 0x22, 0x71, 0x79, 0x71, 0x71, 0x79, 0x72, 0x00, 0x81, 0xb2, 0xea, 0xf6, 0xf5, 0xf5, 0xf3, 0xf0, 0xf3, 0xf3, 0xf5, 0xf5, 0xf6, 0xf3, 0xe1, 0x8a, 0x22, 0x83, 0x73, 0x7f, 0x7f, 0x7e, 0x74, 0x74, 0x7f, 0x7a, 0x89, 0xce, 0xf0, 0xf3, 0xed, 0xf0, 0xed, 0xe7, 0xed, 0xe7, 0xe7, 0xe7, 0xe2, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xed, 0xed, 0xf3, 0xf3, 0xf0, 0xa5, 0x7a, 0x7f, 0x7f, 0xfb, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0xfb, 0xfb, 0x71, 0xa1, 0xe0, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0x02, 0xf3, 0xec, 0xec, 0xd3, 0xfa, 0x7c, 0x7c, 0x7f, 0xfb, 0x7d, 0x7b, 0x7b, 0x6e, 0x7a, 0x6e, 0xae, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x21, 0x21, 0xf6, 0x70, 0x8a, 0x00, 0x00, 0x00, 0x95, 0xe9, 0xf3, 0xc9, 0xaf, 0xb3, 0xb3, 0xb0, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb3, 0xb3, 0xaf, 0xaf, 0xaf, 0xbc, 0xcc, 0xd9, 0xd9, 0xd2, 0xd2, 0xd9, 0xd9, 0xd5, 0xd9, 0xd9, 0xd2, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xd9, 0xd9, 0xcc, 0xc4, 0xc4, 0xc2, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb8, 0xb8, 0xb9, 0xb9, 0xc4, 0xc4, 0xc9, 0xd0, 0xf0, 0xe3, 0xfb, 0x00, 0x79, 0x71, 0x7a, 0x6e, 0x71, 0x5f, 0x00, 0x83, 0xbf, 0xf3, 0xf5, 0xe2, 0xe2, 0xd8, 0xd0, 0xc9, 0xc9, 0xc9, 0xc1, 0xc9, 0xd8, 0xf3, 0xf6, 0xbf, 0x75, 0x23, 0x7e, 0x80, 0x7f, 0x7f, 0xfb, 0xfb, 0x7d, 0x7a, 0xac, 0xf3, 0xed, 0xda, 0xc1, 0xbc, 0xb8, 0xbc, 0xb8, 0xb5, 0xb8, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xb8, 0xbc, 0xbc, 0xbc, 0xb5, 0xc9, 0xdd, 0xf3, 0xea, 0x99, 0x7b, 0x7d, 0x7d, 0xfb, 0x7f, 0x7f, 0x7e, 0x7e, 0x04, 0x7d, 0x77, 0xeb, 0xf0, 0xe7, 0xdd, 0xcf, 0xd0, 0xd0, 0xcf, 0xd0, 0xcf, 0xcf, 0xd8, 0xdf, 0xdd, 0xe2, 0xe2, 0xe4, 0xe4, 0xe2, 0xea, 0xf0, 0xed, 0xf3, 0xf6, 0xf5, 0xf3, 0x94, 0x7a, 0x7b, 0x65, 0xfb, 0x23, 0x71, 0x00, 0x71, 0x9f, 0xf6, 0x02, 0x02, 0x21, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x21, 0x21, 0x21, 0x02, 0xde, 0x7c, 0x00, 0x00, 0x22, 0xa7, 0xf6, 0xed, 0xb5, 0xaf, 0xb3, 0xb3, 0xb3, 0xb0, 0xb3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb3, 0xb3, 0xb3, 0xaf, 0xb3, 0xb3, 0xcc, 0xcc, 0xdd, 0xd9, 0xd9, 0xd2, 0xd9, 0xd2, 0xd2, 0xd9, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd9, 0xd2, 0xd2, 0xcc, 0xc4, 0xb8, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb8, 0xb9, 0xb8, 0xb9, 0xcc, 0xcc, 0xc9, 0xdf, 0xf3, 0xd3, 0x03, 0x00, 0x22, 0x79, 0x71, 0x71, 0x6e, 0x22, 0x01, 0xa7, 0xf6, 0xea, 0xd0, 0xc1, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xd8, 0xed, 0xf3, 0x98, 0x01, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x74, 0x7d, 0x80, 0xe5, 0xf0, 0xc9, 0xb5, 0xbc, 0xb5, 0xbc, 0xb8, 0xbc, 0xbd, 0xbc, 0xbd, 0xbc, 0xbd, 0xbc, 0xbd, 0xbc, 0xbd, 0xbc, 0xbd, 0xb5, 0xbc, 0xb5, 0xdc, 0xf5, 0xb1, 0x7f, 0x73, 0x7d, 0x7f, 0xfb, 0x7f, 0x7e, 0x7f, 0x7c, 0x7d, 0xac, 0xf3, 0xdf, 0xb5, 0xb5, 0xc1, 0xb5, 0xc1, 0xb5, 0xc1, 0xbc, 0xbc, 0xb5, 0xb3, 0xb5, 0xb8, 0xb5, 0xb8, 0xbc, 0xb5, 0xbc, 0xbc, 0xbc, 0xc1, 0xcf, 0xe2, 0xf5, 0xe9, 0xa0, 0x00, 0x74, 0xfb, 0x7c, 0x01, 0x71, 0x71, 0x8a, 0xe8, 0x02, 0x21, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x21, 0x02, 0x02, 0xae, 0x00, 0x00, 0x00, 0x5f, 0xb6, 0xf5, 0xe4, 0xb5, 0xaf, 0xba, 0xb0, 0xb3, 0xb3, 0xb0, 0xb3, 0xb0, 0xb3, 0xb0, 0xb3, 0xb0, 0xaf, 0xaf, 0xbd, 0xd9, 0xd2, 0xd9, 0xd2, 0xd2, 0xcc, 0xd9, 0xd9, 0xd2, 0xd9, 0xd5, 0xd9, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd2, 0xd2, 0xd9, 0xd9, 0xd2, 0xcc, 0xcc, 0xbd, 0xbd, 0xbd, 0xb8, 0xb8, 0xb8, 0xb9, 0xb8, 0xb9, 0xb8, 0xbd, 0xb8, 0xb8, 0xb8, 0xc2, 0xcc, 0xcc, 0xc9, 0xe4, 0xf3, 0xb6, 0x00, 0x00, 0x79, 0x71, 0x71, 0x6e, 0x71, 0x00, 0x93, 0xe5, 0xed, 0xc6, 0xb5, 0xb5, 0xb5, 0xb8, 0xb5, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb5, 0xb5, 0xdf, 0xf5, 0xa5, 0x7a, 0x7e, 0x7f, 0x74, 0x7d, 0xfb, 0x7d, 0x7b, 0x89, 0xf3, 0xe2, 0xb7, 0xb5, 0xc9, 0xbd, 0xbd, 0xbd, 0xbd, 0xb9, 0xbe, 0xbd, 0xbe, 0xbd, 0xbe, 0xbd, 0xbe, 0xbd, 0xbe, 0xbd, 0xc2, 0xc1, 0xb5, 0xc1, 0xe7, 0xe4, 0x85, 0x7c, 0x7d, 0xfb, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x87, 0xd1, 0xed, 0xc1, 0xbc, 0xb8, 0xbc, 0xb8, 0xbc, 0xb8, 0xbc, 0xb8, 0xb8, 0xba, 0xc0, 0xba, 0xba, 0xba, 0xb9, 0xb9, 0xc2, 0xb9, 0xb9, 0xb8, 0xb9, 0xb8, 0xb8, 0xcf, 0xf3, 0xe5, 0x89, 0x7a, 0x7d, 0x73, 0x7a, 0x6e, 0x71, 0x7f, 0xd3, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x21, 0x02, 0x77, 0x00, 0x00, 0x00, 0x75, 0xde, 0xf6, 0xd8, 0xb5, 0xaf, 0xb3, 0xb3, 0xb0, 0xb3, 0xb0, 0xb3, 0xb0, 0xb3, 0xaf, 0xb0, 0xaf, 0xb9, 0xc4, 0xd2, 0xd9, 0xd9, 0xd2, 0xd2, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd2, 0xd2, 0xd9, 0xd9, 0xd9, 0xd2, 0xcc, 0xcc, 0xbd, 0xbc, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xbd, 0xbd, 0xcc, 0xcc, 0xc9, 0xcb, 0xe4, 0xf5, 0xa7, 0x00, 0x22, 0x71, 0x72, 0x00, 0x6e, 0x71, 0x00, 0xb2, 0xf3, 0xdf, 0xc1, 0xbc, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb8, 0xb9, 0xbd, 0xb5, 0xd8, 0xf3, 0xb1, 0x79, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x72, 0x90, 0xf5, 0xe2, 0xc1, 0xbc, 0xbd, 0xb8, 0xbe, 0xba, 0xbe, 0xbe, 0xba, 0xbe, 0xba, 0xbe, 0xba, 0xbe, 0xb9, 0xba, 0xb9, 0xba, 0xb8, 0xbd, 0xc1, 0xc1, 0xdf, 0xf5, 0x90, 0x7c, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x88, 0xea, 0xe4, 0xb5, 0xb5, 0xb9, 0xb9, 0xb9, 0xbd, 0xb9, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb3, 0xba, 0xba, 0xba, 0xba, 0xc0, 0xba, 0xba, 0xb9, 0xc1, 0xcb, 0xf3, 0xb1, 0x7c, 0x73, 0x73, 0x7a, 0x7a, 0x00, 0x72, 0xae, 0x02, 0x02, 0x21, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x21, 0x02, 0x5a, 0x8a, 0x00, 0x00, 0x00, 0x96, 0xf1, 0xf3, 0xca, 0xaf, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb0, 0xb3, 0xb3, 0xb3, 0xb3, 0xbd, 0xcc, 0xdd, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd9, 0xd9, 0xd5, 0xcc, 0xd9, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd5, 0xd5, 0xd2, 0xd9, 0xd2, 0xd9, 0xd9, 0xd2, 0xd2, 0xc4, 0xc4, 0xbc, 0xb8, 0xbd, 0xb8, 0xb8, 0xb8, 0xb8, 0xc4, 0xc4, 0xcc, 0xcc, 0xc9, 0xd0, 0xe7, 0xf3, 0x96, 0x00, 0x7a, 0x71, 0x79, 0x71, 0x01, 0x00, 0x6f, 0xea, 0xf0, 0xc9, 0xb5, 0xb8, 0xb9, 0xb3, 0xba, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbd, 0xb5, 0xc9, 0xed, 0xc3, 0x7c, 0x7c, 0x7f, 0x7f, 0x7f, 0xfb, 0x7d, 0x7a, 0x97, 0xf3, 0xe4, 0xb5, 0xb8, 0xb8, 0xbe, 0xc0, 0xba, 0xc0, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbe, 0xba, 0xbe, 0xbd, 0xb8, 0xc1, 0xd8, 0xf6, 0xa1, 0x7c, 0x73, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x89, 0xed, 0xe4, 0xb5, 0xb8, 0xc2, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb3, 0xba, 0xaf, 0xcb, 0xed, 0xd0, 0x8e, 0x7a, 0x7f, 0x73, 0x6e, 0x7a, 0x79, 0xa3, 0xf9, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x02, 0x6c, 0xfb, 0x00, 0x6e, 0x00, 0xfa, 0xf6, 0xed, 0xc1, 0xaf, 0xc2, 0xb0, 0xb3, 0xb3, 0xb0, 0xb3, 0xb3, 0xb3, 0xaf, 0xb3, 0xc4, 0xd9, 0xd9, 0xd2, 0xd9, 0xd9, 0xd9, 0xd9, 0xd2, 0xd2, 0xd2, 0xd9, 0xd9, 0xd5, 0xd2, 0xd9, 0xd2, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd9, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd2, 0xd5, 0xd9, 0xd9, 0xd9, 0xd2, 0xcc, 0xcc, 0xb8, 0xb8, 0xb5, 0xb8, 0xbc, 0xc4, 0xcc, 0xd2, 0xcc, 0xcb, 0xcf, 0xea, 0xee, 0x75, 0x00, 0x7a, 0x00, 0x79, 0x22, 0x23, 0x00, 0xac, 0xf0, 0xdf, 0xb5, 0xb8, 0xaf, 0xc0, 0xba, 0xba, 0xb3, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xc4, 0xc9, 0xed, 0xcd, 0x7a, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7d, 0x7a, 0x9c, 0xf0, 0xe2, 0xb5, 0xc4, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xc0, 0xba, 0xbe, 0xbd, 0xb5, 0xdd, 0xed, 0xb1, 0x7c, 0x7c, 0x7f, 0x7d, 0x74, 0x7f, 0x7f, 0x7a, 0x91, 0xf0, 0xdd, 0xbc, 0xbd, 0xb3, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xba, 0xb9, 0xba, 0xb9, 0xba, 0xc0, 0xb9, 0xb9, 0xc0, 0xc0, 0xb9, 0xbd, 0xb5, 0xdd, 0xed, 0x9e, 0x7e, 0x80, 0x73, 0x71, 0x71, 0x71, 0x95, 0x5a, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xb6, 0x23, 0x00, 0x00, 0x72, 0xc5, 0xf3, 0xe4, 0xb5, 0xb8, 0xb3, 0xba, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb8, 0xd9, 0xd9, 0xd2, 0xd9, 0xd5, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd5, 0xd9, 0xd5, 0xd5, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd5, 0xd9, 0xd9, 0xd9, 0xd5, 0xd9, 0xd2, 0xd9, 0xcc, 0xcc, 0xc4, 0xc4, 0xd2, 0xd2, 0xcc, 0xd5, 0xcf, 0xdf, 0xed, 0xe5, 0x71, 0x71, 0x71, 0x71, 0x22, 0x01, 0x00, 0x7c, 0xee, 0xea, 0xc1, 0xb5, 0xbe, 0xb3, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xba, 0xba, 0xba, 0xb9, 0xbd, 0xb5, 0xcb, 0xf0, 0xcd, 0x7c, 0x7c, 0x7e, 0x81, 0x7f, 0x7f, 0x7f, 0x71, 0x9c, 0xf3, 0xe2, 0xbc, 0xb9, 0xbe, 0xba, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xba, 0xbe, 0xba, 0xbe, 0xba, 0xbe, 0xba, 0xba, 0xc0, 0xb9, 0xc2, 0xbc, 0xcf, 0xed, 0xc6, 0x7a, 0x81, 0x73, 0x7f, 0x7f, 0x80, 0x7f, 0x72, 0x91, 0xed, 0xe2, 0xbc, 0xb8, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbe, 0xbd, 0xb9, 0xbd, 0xb9, 0xb9, 0xb9, 0xbd, 0xb9, 0xb9, 0xb9, 0xbe, 0xb9, 0xb9, 0xbd, 0xb5, 0xcb, 0xed, 0xad, 0x7e, 0x7c, 0x7c, 0x71, 0x7a, 0x71, 0x75, 0x6c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xfa, 0x00, 0x00, 0x00, 0x81, 0xe5, 0xf3, 0xe2, 0xb5, 0xb3, 0xb3, 0xb0, 0xb3, 0xb9, 0xb3, 0xb3, 0xaf, 0xc4, 0xcc, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd5, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd5, 0xd2, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd9, 0xd2, 0xd2, 0xd2, 0xd9, 0xd2, 0xd2, 0xd2, 0xda, 0xcb, 0xe4, 0xf3, 0xc8, 0x00, 0x71, 0x71, 0x71, 0x6e, 0x01, 0x00, 0x98, 0xed, 0xe7, 0xb5, 0xb8, 0xb9, 0xba, 0xba, 0xba, 0xb9, 0xb9, 0xba, 0xb9, 0xba, 0xb9, 0xb9, 0xbd, 0xb5, 0xd0, 0xf0, 0xcd, 0x5f, 0x7c, 0x7e, 0x80, 0x74, 0x7d, 0xfb, 0x71, 0x9e, 0xf3, 0xe2, 0xbc, 0xb8, 0xba, 0xc0, 0xba, 0xb9, 0xb9, 0xb9, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xba, 0xbd, 0xba, 0xc0, 0xb3, 0xc2, 0xb8, 0xc9, 0xed, 0xd6, 0x7c, 0x7e, 0x7f, 0x74, 0x7f, 0x74, 0x73, 0x7b, 0x8f, 0xed, 0xe4, 0xb5, 0xbd, 0xb9, 0xba, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xbd, 0xbe, 0xb9, 0xbe, 0xbd, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb8, 0xc4, 0xed, 0xbb, 0x84, 0x7c, 0x7c, 0x7a, 0x79, 0x71, 0x73, 0x78, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x5a, 0x95, 0x00, 0x00, 0x00, 0x96, 0xf5, 0xed, 0xcb, 0xb5, 0xb8, 0xb3, 0xb3, 0xb3, 0xb3, 0xaf, 0xb8, 0xbd, 0xd2, 0xdd, 0xd2, 0xd9, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd9, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xd2, 0xd9, 0xd9, 0xd9, 0xd9, 0xd2, 0xd2, 0xd2, 0xd5, 0xcf, 0xe4, 0xf5, 0xa7, 0x00, 0x7a, 0x6e, 0x79, 0x22, 0x22, 0x00, 0xb4, 0xed, 0xcf, 0xbc, 0xb8, 0xba, 0xba, 0xb3, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xba, 0xb9, 0xbd, 0xb5, 0xd0, 0xf3, 0x56, 0x7d, 0x7c, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x79, 0x9c, 0xf3, 0xe2, 0xbc, 0xbd, 0xba, 0xc0, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbd, 0xb9, 0xbe, 0xbd, 0xbe, 0xbd, 0xbe, 0xbd, 0xbe, 0xc0, 0xba, 0xbe, 0xb5, 0xc4, 0xed, 0xe7, 0x80, 0x73, 0x74, 0x74, 0x73, 0x7f, 0x7f, 0x7b, 0x8a, 0xea, 0xe4, 0xbc, 0xb8, 0xb9, 0xb9, 0xba, 0xb9, 0xb9, 0xbe, 0xb9, 0xba, 0xbe, 0xba, 0xba, 0xbe, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xc0, 0xb8, 0xbc, 0xe7, 0xdf, 0x8e, 0x7c, 0x7d, 0x7c, 0x71, 0x71, 0x72, 0xab, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x6c, 0x75, 0x00, 0x00, 0x00, 0xa7, 0xf5, 0xe7, 0xc1, 0xb8, 0xb3, 0xb3, 0xba, 0xb3, 0xb3, 0xb8, 0xc4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd5, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd2, 0xd5, 0xd2, 0xd9, 0xd5, 0xd5, 0xd2, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xd5, 0xda, 0xda, 0xd5, 0xd5, 0xd2, 0xda, 0xd5, 0xd5, 0xd5, 0xd2, 0xda, 0xcf, 0xd8, 0xed, 0xf5, 0x9a, 0x00, 0x71, 0x7a, 0x79, 0x22, 0x00, 0x7f, 0xe5, 0xea, 0xc1, 0xb8, 0xb9, 0xb3, 0xc0, 0xba, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xba, 0xb9, 0xb9, 0xb8, 0xbc, 0xd0, 0xf0, 0xcd, 0x5f, 0x7c, 0x7e, 0x80, 0x74, 0x7d, 0x7f, 0x79, 0x9c, 0xf5, 0xe2, 0xc1, 0xb9, 0xbe, 0xba, 0xba, 0xbd, 0xbe, 0xbd, 0xbe, 0xb9, 0xbe, 0xbd, 0xbe, 0xbd, 0xbe, 0xbd, 0xbe, 0xbe, 0xba, 0xba, 0xbe, 0xb8, 0xc1, 0xea, 0xed, 0x86, 0x7c, 0x74, 0x74, 0x73, 0x7f, 0x74, 0x7d, 0x6f, 0xea, 0xe7, 0xc1, 0xb8, 0xb9, 0xbe, 0xba, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xc0, 0xb9, 0xbc, 0xe2, 0xea, 0x99, 0x7a, 0x73, 0x7c, 0x71, 0x7a, 0x00, 0xa1, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x78, 0x5f, 0x00, 0x00, 0x00, 0xbf, 0xf3, 0xe7, 0xbc, 0xb8, 0xb3, 0xb3, 0xb3, 0xb3, 0xb8, 0xcc, 0xd9, 0xd9, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd2, 0xd5, 0xd9, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xd9, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xcf, 0xdd, 0xf0, 0xe9, 0x6f, 0x00, 0x71, 0x71, 0x01, 0x22, 0x00, 0x96, 0xf0, 0xe2, 0xb5, 0xb8, 0xb9, 0xba, 0xb9, 0xb9, 0xb8, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xba, 0xb9, 0xbd, 0xb5, 0xd8, 0xf3, 0x56, 0x7e, 0x7c, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x79, 0x9c, 0xf5, 0xe2, 0xc1, 0xbd, 0xbe, 0xba, 0xbd, 0xc0, 0xb9, 0xc0, 0xb9, 0xc0, 0xb9, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xb3, 0xba, 0xc2, 0xbc, 0xc1, 0xe7, 0xf0, 0x94, 0x72, 0x74, 0x74, 0x7f, 0x7e, 0x74, 0x7d, 0x75, 0xe4, 0xe7, 0xc1, 0xb8, 0xbe, 0xba, 0xb9, 0xbe, 0xb9, 0xbe, 0xbd, 0xbe, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xc4, 0xdd, 0xed, 0xa1, 0x7c, 0x7d, 0x7d, 0x6e, 0x7a, 0x00, 0x93, 0x5a, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xae, 0x22, 0x00, 0x00, 0x5f, 0xe9, 0xf0, 0xe2, 0xbc, 0xb3, 0xb9, 0xb0, 0xb3, 0xbd, 0xcc, 0xd9, 0xd9, 0xd2, 0xcf, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd9, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xd5, 0xd9, 0xd9, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xcb, 0xe2, 0xf3, 0xcd, 0xfb, 0x00, 0x00, 0x79, 0x22, 0x22, 0x79, 0xac, 0xf0, 0xcf, 0xb5, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xba, 0xb9, 0xc0, 0xb9, 0xbc, 0xd8, 0xf0, 0xc8, 0x7c, 0x7c, 0x7e, 0x80, 0x74, 0x7d, 0xfb, 0x79, 0x9c, 0xf5, 0xe2, 0xc1, 0xbd, 0xb9, 0xba, 0xc0, 0xb9, 0xc0, 0xb9, 0xc0, 0xb9, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xc0, 0xba, 0xba, 0xc2, 0xbc, 0xbc, 0xe4, 0xf3, 0x9e, 0x7a, 0x80, 0x74, 0x74, 0x7f, 0x74, 0x7d, 0x83, 0xe1, 0xe7, 0xc4, 0xb8, 0xb9, 0xc0, 0xba, 0xbe, 0xbe, 0xbd, 0xbe, 0xb9, 0xbe, 0xba, 0xbe, 0xba, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xbc, 0xd8, 0xf0, 0xaa, 0x7c, 0x7c, 0x7d, 0x7a, 0x7a, 0x00, 0x75, 0xde, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf4, 0x9f, 0x00, 0x23, 0x00, 0x8a, 0xf5, 0xed, 0xe2, 0xb5, 0xb3, 0xc2, 0xb0, 0xb9, 0xcc, 0xcc, 0xd2, 0xd5, 0xd5, 0xd9, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd2, 0xd9, 0xd9, 0xd2, 0xd5, 0xd5, 0xd5, 0xd2, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xd5, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xd5, 0xd5, 0xd2, 0xdd, 0xcf, 0xe7, 0xf3, 0xb6, 0x7b, 0x00, 0x01, 0x22, 0x79, 0x22, 0x01, 0xdb, 0xed, 0xc1, 0xb3, 0xb9, 0xba, 0xb9, 0xb3, 0xbd, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xba, 0xba, 0xc2, 0xbd, 0xbc, 0xd8, 0xf3, 0xc5, 0x7c, 0x7c, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x79, 0x9c, 0xf5, 0xe4, 0xc1, 0xbd, 0xbd, 0xba, 0xbe, 0xc0, 0xba, 0xc0, 0xba, 0xc0, 0xba, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xc0, 0xb9, 0xbe, 0xb5, 0xbc, 0xe2, 0xf5, 0xa4, 0x7a, 0x7f, 0x74, 0x74, 0x80, 0x74, 0x7f, 0x81, 0xdf, 0xe7, 0xc4, 0xb8, 0xbe, 0xba, 0xbe, 0xba, 0xbe, 0xbe, 0xbd, 0xbe, 0xb9, 0xb9, 0xb9, 0xbd, 0xb9, 0xbd, 0xb9, 0xbd, 0xb9, 0xbd, 0xbd, 0xbd, 0xbd, 0xb8, 0xba, 0xb9, 0xb8, 0xd0, 0xf0, 0xb1, 0x7f, 0x7d, 0x7d, 0x72, 0x6e, 0x71, 0x73, 0xc8, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xec, 0x95, 0x00, 0x00, 0x00, 0xa5, 0xf5, 0xe7, 0xcb, 0xb5, 0xb8, 0xb8, 0xbe, 0xd2, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd9, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd2, 0xd9, 0xd5, 0xd0, 0xd0, 0xea, 0xf6, 0xa5, 0x00, 0x01, 0x22, 0x79, 0x23, 0x00, 0x93, 0xed, 0xe4, 0xb8, 0xb8, 0xba, 0xba, 0xb9, 0xb9, 0xbd, 0xb9, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xbe, 0xbc, 0xb5, 0xdf, 0xf3, 0xbb, 0x7d, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x7d, 0x7a, 0x9a, 0xf5, 0xe4, 0xc1, 0xbc, 0xbe, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xbe, 0xba, 0xbe, 0xba, 0xbe, 0xba, 0xba, 0xc0, 0xbe, 0xb8, 0xc1, 0xd0, 0xf5, 0xaa, 0x79, 0x7d, 0x81, 0x7f, 0x80, 0x7f, 0x74, 0x7e, 0xc5, 0xf0, 0xc9, 0xb8, 0xbd, 0xba, 0xc0, 0xba, 0xba, 0xbe, 0xba, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xbd, 0xb9, 0xbe, 0xb9, 0xb9, 0xb9, 0xbe, 0xb9, 0xc2, 0xb3, 0xc4, 0xcb, 0xed, 0xc5, 0x82, 0x7b, 0x7f, 0x01, 0x6e, 0x6e, 0x22, 0xae, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x6c, 0x6f, 0x00, 0x00, 0x00, 0xb4, 0xf3, 0xe7, 0xc1, 0xb8, 0xb5, 0xb8, 0xc4, 0xd2, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd2, 0xd9, 0xd5, 0xdd, 0xd6, 0xed, 0xf2, 0x9a, 0x00, 0x79, 0x79, 0x22, 0x22, 0x00, 0xa5, 0xed, 0xcf, 0xbc, 0xb9, 0xba, 0xba, 0xba, 0xb9, 0xb9, 0xb9, 0xba, 0xba, 0xc0, 0xc0, 0xba, 0xba, 0xbd, 0xc1, 0xb5, 0xe2, 0xf3, 0xbb, 0x7c, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x7c, 0x7a, 0x99, 0xf5, 0xe4, 0xc1, 0xbc, 0xbe, 0xbe, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xc2, 0xb9, 0xbd, 0xbc, 0xda, 0xf3, 0xb4, 0x72, 0xfb, 0xfb, 0x7f, 0x80, 0x80, 0x74, 0x7f, 0xbb, 0xf0, 0xc9, 0xbc, 0xb8, 0xbe, 0xba, 0xba, 0xba, 0xba, 0xbe, 0xb9, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb9, 0xbe, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xba, 0xc0, 0xb3, 0xbc, 0xcc, 0xed, 0xd6, 0x85, 0x7b, 0x7d, 0x72, 0x6e, 0x79, 0x00, 0xa3, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x56, 0x01, 0x00, 0x00, 0x00, 0xe1, 0xf0, 0xe2, 0xc1, 0xb5, 0xb8, 0xb8, 0xd2, 0xd2, 0xd2, 0xcf, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xd9, 0xd2, 0xd9, 0xd2, 0xda, 0xd0, 0xdf, 0xf3, 0xe6, 0x87, 0x00, 0x22, 0x79, 0x79, 0x00, 0x7b, 0xbf, 0xf0, 0xc1, 0xb5, 0xb9, 0xb9, 0xba, 0xb9, 0xb9, 0xb8, 0xb9, 0xb9, 0xbe, 0xba, 0xba, 0xba, 0xb9, 0xbd, 0xbc, 0xc1, 0xe4, 0xf3, 0xb6, 0x7a, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x7e, 0x7a, 0x98, 0xf5, 0xe7, 0xc1, 0xbc, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xc0, 0xbe, 0xb8, 0xbc, 0xcf, 0xf0, 0xc8, 0x7d, 0x7d, 0xfb, 0x74, 0x80, 0x7e, 0x7f, 0x7f, 0xb4, 0xf0, 0xcb, 0xbc, 0xbd, 0xba, 0xbe, 0xba, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xba, 0xb9, 0xbd, 0xc9, 0xe7, 0xe5, 0x89, 0x72, 0x73, 0x7b, 0x01, 0x01, 0x00, 0x95, 0xf9, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xb2, 0x00, 0x00, 0x00, 0x73, 0xf3, 0xed, 0xe2, 0xb5, 0xb8, 0xb8, 0xc4, 0xd9, 0xcc, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd2, 0xd9, 0xda, 0xd8, 0xe4, 0xf6, 0xc8, 0x74, 0x00, 0x79, 0x01, 0x22, 0x00, 0x75, 0xe1, 0xee, 0xb5, 0xbc, 0xbd, 0xb9, 0xb9, 0xb9, 0xb9, 0xbd, 0xbd, 0xb9, 0xbe, 0xb9, 0xba, 0xb9, 0xbd, 0xb8, 0xbc, 0xc9, 0xe2, 0xf5, 0xb1, 0x7c, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x7e, 0x7a, 0x98, 0xf3, 0xe7, 0xc1, 0xbc, 0xbe, 0xbe, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xc0, 0xb9, 0xbd, 0xbc, 0xcb, 0xf0, 0xdc, 0x81, 0x7b, 0xfb, 0x74, 0x80, 0x7e, 0x74, 0x73, 0xac, 0xf3, 0xcf, 0xbc, 0xbd, 0xbe, 0xba, 0xc0, 0xba, 0xbe, 0xba, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xba, 0xbd, 0xc1, 0xe7, 0xea, 0x91, 0x7c, 0x7d, 0x5f, 0x01, 0x6e, 0x00, 0x75, 0xef, 0x02, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xfa, 0x00, 0x00, 0x00, 0x8f, 0xf6, 0xe7, 0xdd, 0xb5, 0xb5, 0xc4, 0xd2, 0xd9, 0xcc, 0xd5, 0xcf, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xd0, 0xe7, 0xf6, 0xb2, 0x72, 0x79, 0x01, 0x01, 0x01, 0x00, 0x98, 0xe9, 0xe7, 0xc6, 0xc4, 0xc4, 0xc2, 0xbd, 0xbd, 0xb8, 0xb8, 0xbd, 0xbd, 0xbd, 0xb9, 0xbd, 0xb9, 0xbd, 0xb5, 0xc1, 0xc9, 0xe4, 0xf5, 0xb1, 0x72, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x73, 0x7a, 0x94, 0xf5, 0xe7, 0xc1, 0xc4, 0xb9, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xc0, 0xc0, 0xbe, 0xbd, 0xbc, 0xc9, 0xed, 0xe5, 0x81, 0x7b, 0x7d, 0x74, 0x80, 0x7f, 0x7f, 0x73, 0xa8, 0xf3, 0xd8, 0xbc, 0xbd, 0xbe, 0xc0, 0xc0, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xc0, 0xbd, 0xbc, 0xe4, 0xed, 0x9a, 0x7c, 0x7d, 0x73, 0x01, 0x79, 0x22, 0x7d, 0x6c, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x5a, 0x93, 0x00, 0x00, 0x00, 0xfa, 0xf5, 0xe7, 0xd8, 0xb5, 0xbc, 0xcc, 0xd2, 0xd9, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd0, 0xed, 0xf0, 0xa3, 0x79, 0x22, 0x72, 0x22, 0x79, 0x7a, 0xa7, 0xf0, 0xd6, 0xcf, 0xcf, 0xcc, 0xcc, 0xc4, 0xc4, 0xc4, 0xbc, 0xc4, 0xbc, 0xbd, 0xbd, 0xb8, 0xbd, 0xbc, 0xc4, 0xc1, 0xd0, 0xe2, 0xf3, 0xac, 0x7a, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x7e, 0x7a, 0x96, 0xf5, 0xe7, 0xc9, 0xbc, 0xbe, 0xbe, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xbe, 0xbe, 0xbd, 0xbc, 0xc1, 0xed, 0xed, 0x75, 0x7d, 0xfb, 0x74, 0x80, 0x80, 0x7f, 0x73, 0xa4, 0xf3, 0xd8, 0xbc, 0xbd, 0xbe, 0xbe, 0xc0, 0xbe, 0xc0, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xba, 0xc0, 0xbc, 0xbc, 0xe2, 0xf3, 0xa1, 0x7c, 0x5f, 0x74, 0x01, 0x6e, 0x01, 0x00, 0x78, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x5a, 0x83, 0x00, 0x00, 0x00, 0xb4, 0xf5, 0xe7, 0xcb, 0xc1, 0xc4, 0xd5, 0xd9, 0xcc, 0xd9, 0xd2, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd9, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xd2, 0xda, 0xda, 0xdf, 0xf0, 0xeb, 0x98, 0x01, 0x00, 0x72, 0x22, 0x01, 0x7b, 0xb4, 0xf5, 0xc6, 0xd8, 0xcf, 0xd2, 0xd2, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xcf, 0xcf, 0xd8, 0xe4, 0xf3, 0xac, 0x7a, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x73, 0x7a, 0x94, 0xf5, 0xe7, 0xc9, 0xbc, 0xbe, 0xbe, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xc0, 0xbe, 0xb9, 0xbd, 0xb8, 0xc1, 0xe7, 0xf0, 0x85, 0x7f, 0x81, 0x7f, 0x80, 0x80, 0x7d, 0x7d, 0xa4, 0xf3, 0xdd, 0xbc, 0xbd, 0xc2, 0xc0, 0xbe, 0xc0, 0xbe, 0xc2, 0xbe, 0xc2, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb9, 0xbe, 0xbe, 0xb9, 0xbe, 0xbe, 0xba, 0xba, 0xbd, 0xc1, 0xe2, 0xf3, 0xa5, 0x7c, 0x7c, 0x81, 0x01, 0x71, 0x01, 0x00, 0xae, 0x02, 0xf9, 0xf4, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0xf9, 0xf9, 0x02, 0x02, 0xf6, 0xf9, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xd3, 0x22, 0x00, 0x00, 0x01, 0xe1, 0xea, 0xe4, 0xc1, 0xc9, 0xcc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd5, 0xd5, 0xd5, 0xda, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xda, 0xda, 0xda, 0xd5, 0xd9, 0xd9, 0xda, 0xd0, 0xe4, 0xf0, 0xde, 0x6f, 0x71, 0x22, 0x7b, 0x01, 0x00, 0x85, 0xe1, 0xea, 0xd8, 0xd0, 0xcf, 0xcb, 0xcf, 0xd2, 0xcf, 0xd5, 0xd5, 0xd5, 0xcf, 0xcf, 0xd5, 0xda, 0xd5, 0xd5, 0xcf, 0xdd, 0xd0, 0xe4, 0xf6, 0xa8, 0x7c, 0x7e, 0x7e, 0x80, 0x82, 0x7f, 0x7e, 0x7a, 0x94, 0xf3, 0xe7, 0xc9, 0xbd, 0xc2, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xbe, 0xba, 0xc2, 0xc2, 0xbc, 0xc1, 0xe7, 0xf3, 0x91, 0x7b, 0x7d, 0x7f, 0x7f, 0x73, 0x81, 0x7c, 0x9e, 0xf3, 0xe2, 0xc1, 0xb8, 0xbe, 0xba, 0xc0, 0xba, 0xbe, 0xbe, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb9, 0xbe, 0xbe, 0xbe, 0xba, 0xba, 0xba, 0xb8, 0xc1, 0xd8, 0xf3, 0xac, 0x72, 0x73, 0x73, 0x7b, 0x01, 0x71, 0x00, 0x9f, 0x02, 0xf4, 0x02, 0xf9, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xb2, 0x00, 0x00, 0x00, 0x75, 0xeb, 0xea, 0xe2, 0xc9, 0xd2, 0xd2, 0xd9, 0xd9, 0xd9, 0xd5, 0xd5, 0xd5, 0xd9, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd8, 0xe7, 0xf3, 0xbf, 0x74, 0x00, 0x79, 0x22, 0x23, 0x00, 0x98, 0xe5, 0xe7, 0xd0, 0xd8, 0xd8, 0xd8, 0xcf, 0xcf, 0xcf, 0xcc, 0xcf, 0xcf, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xd8, 0xda, 0xd8, 0xd6, 0xe4, 0xf6, 0xa7, 0x7c, 0x7e, 0x7c, 0x80, 0x80, 0x80, 0x7e, 0x7a, 0x94, 0xf3, 0xea, 0xc9, 0xbc, 0xc2, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xb9, 0xc2, 0xc2, 0xbd, 0xc1, 0xe7, 0xf3, 0x98, 0x7a, 0x74, 0x7f, 0x7f, 0x7f, 0x81, 0x7b, 0x9c, 0xf3, 0xdd, 0xc1, 0xbd, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0xbe, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb9, 0xbe, 0xbe, 0xb9, 0xbe, 0xbe, 0xba, 0xba, 0xbd, 0xbc, 0xdf, 0xf3, 0xad, 0x7b, 0x73, 0x73, 0x72, 0x7a, 0x79, 0x00, 0x93, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x21, 0xf6, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x77, 0x00, 0x00, 0x00, 0x9a, 0xf1, 0xed, 0xdf, 0xdd, 0xda, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd8, 0xd0, 0xea, 0xf1, 0xa7, 0x79, 0x22, 0x01, 0x79, 0x22, 0x6e, 0xa7, 0xf3, 0xe4, 0xcb, 0xd8, 0xd8, 0xd0, 0xd8, 0xd8, 0xd8, 0xcf, 0xda, 0xd8, 0xd8, 0xd8, 0xd8, 0xcf, 0xd0, 0xcf, 0xd8, 0xdf, 0xd0, 0xe4, 0xf6, 0xa8, 0x7a, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7c, 0x7c, 0x8f, 0xf3, 0xe7, 0xc9, 0xbd, 0xc2, 0xba, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xbe, 0xba, 0xc2, 0xbd, 0xbd, 0xc1, 0xe2, 0xf5, 0x9c, 0x7b, 0x7f, 0x81, 0x7f, 0x80, 0xfb, 0x7c, 0x76, 0xf0, 0xe2, 0xc1, 0xbc, 0xbe, 0xbe, 0xba, 0xbe, 0xbe, 0xbe, 0xbd, 0xc2, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xba, 0xc0, 0xb8, 0xc1, 0xd8, 0xf3, 0xbb, 0x7c, 0x73, 0x7f, 0x7c, 0x01, 0x71, 0x00, 0x75, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x6f, 0x00, 0x00, 0x00, 0xfa, 0xf0, 0xe7, 0xd0, 0xdd, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xcf, 0xd8, 0xed, 0xef, 0x77, 0x00, 0x79, 0x72, 0x01, 0x00, 0x5f, 0xb4, 0xf3, 0xdf, 0xd0, 0xd8, 0xd8, 0xd6, 0xd8, 0xd0, 0xd0, 0xcf, 0xcf, 0xd8, 0xd8, 0xdd, 0xd8, 0xd8, 0xdd, 0xdf, 0xd8, 0xd8, 0xd6, 0xe4, 0xf6, 0xa6, 0x7c, 0x7e, 0x7e, 0x80, 0x82, 0x7f, 0x7e, 0x7a, 0x90, 0xf0, 0xea, 0xc9, 0xbc, 0xc2, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xb9, 0xc0, 0xbd, 0xbd, 0xc1, 0xe2, 0xf5, 0xa1, 0x7c, 0x7f, 0x7f, 0x74, 0x7f, 0x74, 0x7b, 0x96, 0xf0, 0xe2, 0xc1, 0xbd, 0xbd, 0xc0, 0xc2, 0xc0, 0xbe, 0xbd, 0xc2, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xc0, 0xb9, 0xbc, 0xd8, 0xf3, 0xc3, 0x7f, 0x7c, 0x73, 0x5f, 0x7a, 0x79, 0x71, 0x7b, 0x5a, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0xf6, 0xf6, 0xf5, 0xf5, 0xf6, 0xf3, 0xf1, 0xf0, 0xf3, 0xf3, 0xf5, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0xe8, 0x01, 0x00, 0x00, 0x00, 0xb2, 0xf0, 0xe5, 0xd8, 0xdd, 0xd9, 0xd9, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd8, 0xe4, 0xf0, 0xe6, 0x8f, 0x00, 0x79, 0x79, 0x01, 0x00, 0x75, 0xd4, 0xf0, 0xdf, 0xd8, 0xd8, 0xdf, 0xd8, 0xd6, 0xdf, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd8, 0xdf, 0xdc, 0xe4, 0xf5, 0xa5, 0x7a, 0x7e, 0x7e, 0x7f, 0x82, 0x7f, 0x7e, 0x72, 0x8c, 0xf3, 0xe7, 0xc9, 0xbc, 0xc2, 0xbe, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xbe, 0xba, 0xc2, 0xbe, 0xbc, 0xc4, 0xe2, 0xf5, 0xa6, 0x72, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x7b, 0x94, 0xea, 0xe7, 0xc1, 0xbd, 0xc2, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xc0, 0xba, 0xc0, 0xb8, 0xbc, 0xd0, 0xf0, 0xd4, 0x7f, 0x73, 0x73, 0x7c, 0x01, 0x79, 0x79, 0x22, 0xde, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x02, 0xf6, 0x02, 0x02, 0xe8, 0xc8, 0xae, 0xac, 0xac, 0xaa, 0xaa, 0xac, 0xb2, 0xe3, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xbf, 0x00, 0x00, 0x00, 0x7b, 0xd3, 0xf0, 0xe4, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd5, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xdd, 0xd5, 0xda, 0xdd, 0xcf, 0xdd, 0xe4, 0xf5, 0xcd, 0x65, 0x00, 0x23, 0x00, 0x01, 0x00, 0x95, 0xe9, 0xed, 0xd8, 0xdf, 0xdd, 0xd6, 0xdf, 0xdc, 0xdf, 0xdf, 0xdd, 0xdd, 0xe4, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd0, 0xdf, 0xd6, 0xdf, 0xe5, 0xf5, 0xa5, 0x7a, 0x7e, 0x7e, 0x80, 0x82, 0x7e, 0x7e, 0x7a, 0x8c, 0xf0, 0xed, 0xc9, 0xbc, 0xc2, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xc2, 0xbe, 0xc4, 0xc1, 0xe2, 0xf3, 0xaa, 0x7c, 0x7f, 0x74, 0x7f, 0x74, 0xfb, 0x7c, 0x8c, 0xea, 0xe7, 0xbc, 0xc4, 0xbd, 0xc2, 0xc0, 0xbe, 0xbe, 0xc2, 0xc2, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xba, 0xc0, 0xbd, 0xbc, 0xd8, 0xed, 0xdc, 0x80, 0x7c, 0x73, 0x73, 0x7a, 0x79, 0x72, 0x00, 0xb6, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x02, 0x21, 0xf6, 0x02, 0x02, 0xd3, 0xab, 0xb1, 0xac, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xae, 0xe8, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 0xa7, 0x00, 0x22, 0x00, 0x83, 0xe6, 0xf0, 0xdf, 0xd0, 0xda, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xcf, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd9, 0xdd, 0xd5, 0xda, 0xd9, 0xd8, 0xdd, 0xe7, 0xf5, 0xb6, 0x71, 0x00, 0x01, 0x79, 0x72, 0x22, 0x77, 0xf5, 0xea, 0xd0, 0xe2, 0xdf, 0xe2, 0xe4, 0xdc, 0xd6, 0xc6, 0xc9, 0xc3, 0xc1, 0xb7, 0xc1, 0xca, 0xdf, 0xdd, 0xd6, 0xd8, 0xdc, 0xdf, 0xe5, 0xf3, 0xa5, 0x7a, 0x7e, 0x7e, 0x7f, 0x82, 0x7f, 0x7e, 0x72, 0x89, 0xf3, 0xe7, 0xc9, 0xbc, 0xc2, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xc2, 0xc0, 0xc2, 0xbd, 0xc4, 0xc4, 0xdd, 0xf6, 0xad, 0x72, 0x81, 0x74, 0x80, 0x74, 0x81, 0x7b, 0x8c, 0xea, 0xe7, 0xc1, 0xc4, 0xc2, 0xc0, 0xbe, 0xbe, 0xc2, 0xbd, 0xc2, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xc2, 0xc0, 0xc2, 0xbe, 0xc2, 0xc0, 0xba, 0xcc, 0xbd, 0xc1, 0xd8, 0xf0, 0xe1, 0x80, 0x73, 0x73, 0x5f, 0x7a, 0x71, 0x72, 0x00, 0xae, 0x02, 0x02, 0xf9, 0x02, 0xf9, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xcd, 0xbb, 0xbb, 0xc3, 0xc3, 0xc3, 0xc6, 0xc3, 0xbb, 0xbf, 0xe9, 0x02, 0xf4, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x02, 0x6f, 0x00, 0x00, 0x00, 0x98, 0xf1, 0xe7, 0xdf, 0xdd, 0xda, 0xd9, 0xd9, 0xd9, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd5, 0xda, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd2, 0xda, 0xcf, 0xd8, 0xd0, 0xd6, 0xf3, 0xf1, 0xa1, 0x00, 0x79, 0x7a, 0x71, 0x79, 0x71, 0xb2, 0xf6, 0xdf, 0xdf, 0xdf, 0xe2, 0xca, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xaa, 0xad, 0xad, 0xb1, 0xd0, 0xdf, 0xdf, 0xd6, 0xdf, 0xdc, 0xe7, 0xf3, 0x9e, 0x7a, 0x7e, 0x7c, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x89, 0xea, 0xed, 0xc9, 0xbc, 0xbe, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xbe, 0xc0, 0xbe, 0xc0, 0xc2, 0xc0, 0xbe, 0xbe, 0xc2, 0xc4, 0xcf, 0xd8, 0xf5, 0xbb, 0x7f, 0x7f, 0x7d, 0x74, 0x7f, 0x74, 0x7c, 0x8a, 0xe3, 0xe7, 0xc9, 0xb8, 0xc2, 0xc0, 0xbe, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xbe, 0xc2, 0xbe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xbe, 0xbe, 0xbe, 0xc2, 0xbe, 0xc2, 0xbd, 0xc4, 0xc9, 0xdd, 0xed, 0xe4, 0x85, 0x7a, 0x74, 0x73, 0x72, 0x79, 0x79, 0x00, 0x77, 0x02, 0x02, 0x70, 0x02, 0xf4, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf5, 0xf6, 0xcd, 0xbb, 0xc3, 0xc3, 0xbb, 0xc3, 0xc6, 0xc3, 0xbb, 0xbb, 0xeb, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x5a, 0x7b, 0x00, 0x00, 0x00, 0xa4, 0xf3, 0xe7, 0xd8, 0xdd, 0xda, 0xda, 0xd9, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd2, 0xd9, 0xda, 0xd8, 0xd8, 0xdc, 0xf5, 0xee, 0x93, 0x71, 0x79, 0x7a, 0x7a, 0x79, 0x73, 0x56, 0xf0, 0xe0, 0xdf, 0xdf, 0xe7, 0xb7, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xad, 0xb1, 0xad, 0xce, 0xdf, 0xd0, 0xdf, 0xdc, 0xdf, 0xe5, 0xf3, 0x9c, 0x7c, 0x7e, 0x7c, 0x80, 0x82, 0x7e, 0x7f, 0x7c, 0x8a, 0xea, 0xed, 0xc9, 0xbc, 0xbe, 0xbe, 0xc2, 0xc2, 0xbd, 0xc2, 0xc2, 0xc2, 0xbe, 0xbe, 0xc2, 0xbe, 0xc2, 0xc0, 0xc2, 0xc0, 0xbe, 0xc2, 0xc2, 0xc4, 0xcc, 0xcf, 0xd8, 0xf6, 0xbb, 0xfb, 0x7f, 0xfb, 0x80, 0x74, 0x80, 0x7c, 0x8a, 0xe3, 0xed, 0xc9, 0xbd, 0xc0, 0xc0, 0xc2, 0xc2, 0xc2, 0xbe, 0xc0, 0xc0, 0xc2, 0xbe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xbe, 0xc0, 0xbe, 0xbe, 0xbe, 0xbd, 0xc4, 0xcc, 0xcf, 0xd8, 0xe7, 0xea, 0x86, 0x72, 0x74, 0x73, 0x72, 0x7a, 0x71, 0x00, 0x98, 0x02, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf6, 0xf6, 0xd1, 0xbb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xbb, 0xbb, 0xeb, 0x02, 0xf4, 0x02, 0x70, 0x02, 0xf6, 0x21, 0xf6, 0x02, 0x78, 0x00, 0x22, 0x00, 0x01, 0xb2, 0xf5, 0xe7, 0xd0, 0xd8, 0xda, 0xdd, 0xd9, 0xda, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd2, 0xda, 0xda, 0xd8, 0xd6, 0xe4, 0xf6, 0xe1, 0x74, 0x00, 0x7a, 0x79, 0x72, 0x71, 0x6f, 0xee, 0xed, 0xdc, 0xdf, 0xdf, 0xe7, 0xb4, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xd0, 0xdf, 0xdf, 0xd6, 0xdf, 0xdc, 0xea, 0xf3, 0x99, 0x72, 0x7e, 0x7c, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x89, 0xea, 0xed, 0xc9, 0xbc, 0xc2, 0xbe, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xc0, 0xbe, 0xc0, 0xb9, 0xbe, 0xc4, 0xc4, 0xcc, 0xcf, 0xd8, 0xf5, 0xc8, 0x74, 0xfb, 0x7f, 0x74, 0x7f, 0x80, 0x73, 0x6f, 0xe1, 0xed, 0xcb, 0xbd, 0xbe, 0xc0, 0xbe, 0xc2, 0xc2, 0xbe, 0xc0, 0xc2, 0xbe, 0xc2, 0xc0, 0xbe, 0xc0, 0xc0, 0xc0, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0xbd, 0xc4, 0xd9, 0xcf, 0xd0, 0xe7, 0xed, 0x87, 0x72, 0x74, 0x73, 0x72, 0x7a, 0x7a, 0x00, 0x6f, 0x02, 0x02, 0x02, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf5, 0xf6, 0xcd, 0xbb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb7, 0xbf, 0xeb, 0x02, 0x70, 0x02, 0xf9, 0x02, 0xf9, 0xf6, 0xf6, 0x02, 0xfa, 0x00, 0x23, 0x00, 0x7d, 0xc8, 0xf5, 0xe4, 0xd8, 0xd8, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd8, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd0, 0xdf, 0xea, 0x02, 0xbf, 0x71, 0x79, 0x01, 0x01, 0x01, 0x00, 0x9a, 0x02, 0xe5, 0xdc, 0xdf, 0xdf, 0xe7, 0xb7, 0xad, 0xb4, 0xad, 0xb1, 0xad, 0xb1, 0xad, 0xb1, 0xad, 0xad, 0xca, 0xdf, 0xdf, 0xdf, 0xdc, 0xdf, 0xea, 0xf0, 0x94, 0x7c, 0x7e, 0x7c, 0x80, 0x82, 0x7e, 0x80, 0x7c, 0x87, 0xea, 0xed, 0xc9, 0xbc, 0xbe, 0xbe, 0xc2, 0xc2, 0xbd, 0xc2, 0xbe, 0xc2, 0xc2, 0xbe, 0xbe, 0xc2, 0xbe, 0xbe, 0xbe, 0xc2, 0xb9, 0xc2, 0xc4, 0xcc, 0xcc, 0xda, 0xd0, 0xf3, 0xd4, 0x83, 0x7d, 0xfb, 0x80, 0x74, 0x73, 0x7e, 0x75, 0xd1, 0xf0, 0xc9, 0xbd, 0xc0, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xbe, 0xbe, 0xc0, 0xbe, 0xc0, 0xc0, 0xc0, 0xba, 0xbe, 0xc0, 0xbe, 0xc2, 0xb9, 0xbe, 0xc4, 0xcc, 0xd2, 0xcf, 0xd0, 0xe7, 0xf0, 0x8c, 0x7c, 0x73, 0x7d, 0x7c, 0x79, 0x7a, 0x00, 0x74, 0xef, 0x02, 0x02, 0xf9, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf5, 0x02, 0xd1, 0xbb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc6, 0xc3, 0xb7, 0xc3, 0xeb, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x02, 0x02, 0x21, 0x02, 0x95, 0x00, 0x22, 0x00, 0x75, 0xde, 0xf3, 0xe4, 0xd8, 0xd8, 0xda, 0xda, 0xd9, 0xd9, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xda, 0xd0, 0xdf, 0xf0, 0xf6, 0xa7, 0x00, 0x01, 0x72, 0x01, 0x79, 0x00, 0xab, 0x02, 0xe4, 0xdc, 0xdf, 0xdf, 0xe7, 0xc3, 0xad, 0xb1, 0xad, 0xb1, 0xad, 0xb1, 0xb4, 0xb1, 0xb1, 0xad, 0xc9, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xea, 0xee, 0x8c, 0x7c, 0x7e, 0x7c, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x86, 0xe9, 0xed, 0xc9, 0xbc, 0xc2, 0xbe, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xbe, 0xbe, 0xc2, 0xbd, 0xc2, 0xcc, 0xcc, 0xcc, 0xcf, 0xd0, 0xf3, 0xe0, 0x75, 0x7c, 0x81, 0x74, 0x7f, 0x73, 0x7f, 0x83, 0xd3, 0xf0, 0xcb, 0xbd, 0xbe, 0xc0, 0xbe, 0xc2, 0xc2, 0xbe, 0xc0, 0xbe, 0xc2, 0xc0, 0xc2, 0xc0, 0xc0, 0xc0, 0xbe, 0xc0, 0xc2, 0xc2, 0xbe, 0xbd, 0xc2, 0xcc, 0xcc, 0xd2, 0xcf, 0xd0, 0xea, 0xf0, 0x91, 0x72, 0x7f, 0x73, 0x7c, 0x7a, 0x7a, 0x6e, 0x72, 0x6c, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xcd, 0xbb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xbb, 0xbf, 0xee, 0x02, 0x70, 0x02, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0xde, 0xfb, 0x00, 0x00, 0x00, 0x93, 0xe6, 0xf0, 0xdf, 0xd8, 0xdd, 0xda, 0xd9, 0xd9, 0xd2, 0xd9, 0xd5, 0xd5, 0xd9, 0xda, 0xd5, 0xda, 0xd9, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xd5, 0xda, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xd9, 0xda, 0xd5, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd5, 0xd8, 0xd8, 0xe4, 0xf3, 0xf1, 0x8f, 0x22, 0x01, 0x23, 0x01, 0x22, 0x79, 0xd3, 0xf3, 0xe1, 0xe0, 0xdf, 0xe4, 0xe4, 0xc6, 0xb1, 0xb1, 0xad, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xad, 0xc6, 0xd6, 0xdf, 0xdf, 0xdf, 0xdc, 0xed, 0xee, 0x88, 0x7c, 0x7e, 0x7c, 0x80, 0x82, 0x7e, 0x7f, 0x7c, 0x85, 0xea, 0xed, 0xc9, 0xbc, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xbe, 0xc4, 0xc4, 0xcc, 0xcc, 0xd2, 0xcf, 0xd0, 0xf3, 0xe3, 0x85, 0x7b, 0x81, 0x74, 0x7f, 0x73, 0x7f, 0x81, 0xc8, 0xf3, 0xd0, 0xbd, 0xc0, 0xc0, 0xc2, 0xc2, 0xc2, 0xbe, 0xc0, 0xc2, 0xbe, 0xbe, 0xc0, 0xc2, 0xc0, 0xc2, 0xba, 0xbe, 0xc2, 0xbe, 0xbd, 0xc2, 0xcc, 0xcc, 0xcc, 0xd2, 0xc9, 0xd0, 0xe7, 0xf0, 0x94, 0x7c, 0x7d, 0x7f, 0x7c, 0x7a, 0x7a, 0x72, 0x71, 0x56, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf5, 0xf6, 0xd1, 0xbb, 0xc3, 0xc6, 0xc3, 0xc3, 0xc6, 0xc3, 0xb7, 0xc5, 0xeb, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x02, 0xf4, 0x02, 0xb6, 0x22, 0x79, 0x22, 0x00, 0x9a, 0xef, 0xf0, 0xd6, 0xd8, 0xdd, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd2, 0xd5, 0xd9, 0xd9, 0xda, 0xd9, 0xd9, 0xda, 0xd9, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd9, 0xd9, 0xd5, 0xd9, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd9, 0xd9, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xd5, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd9, 0xd5, 0xd9, 0xd9, 0xd9, 0xd2, 0xd9, 0xd9, 0xda, 0xcf, 0xdd, 0xd8, 0xe7, 0xf3, 0xee, 0x7d, 0x01, 0x22, 0x01, 0x03, 0x22, 0x7b, 0xf1, 0xea, 0xe3, 0xdf, 0xdf, 0xe4, 0xe4, 0xca, 0xb1, 0xb1, 0xb1, 0xb7, 0xb1, 0xad, 0xb1, 0xb1, 0xb4, 0xad, 0xca, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xeb, 0xeb, 0x85, 0x7e, 0x7e, 0x7c, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x85, 0xea, 0xed, 0xc9, 0xbc, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xbd, 0xbe, 0xc2, 0xbe, 0xc2, 0xbd, 0xc4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xd0, 0xf0, 0xe9, 0x85, 0x7b, 0x81, 0x74, 0x7f, 0x73, 0x73, 0x81, 0x78, 0xf3, 0xcf, 0xbd, 0xbe, 0xc0, 0xbe, 0xc2, 0xc2, 0xbe, 0xc0, 0xbe, 0xbe, 0xc0, 0xbe, 0xc0, 0xc0, 0xc2, 0xba, 0xc2, 0xc2, 0xbd, 0xbd, 0xc4, 0xcc, 0xcc, 0xcc, 0xd2, 0xcf, 0xc9, 0xe7, 0xf3, 0x96, 0x7c, 0x73, 0x73, 0x7d, 0x7a, 0x7a, 0x72, 0x00, 0xb6, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf6, 0xc8, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xbb, 0xc3, 0xbf, 0xee, 0x02, 0x70, 0x02, 0x02, 0xf9, 0xf6, 0x02, 0x02, 0x77, 0x00, 0x01, 0x79, 0x71, 0xa1, 0xf0, 0xe7, 0xd8, 0xdd, 0xcf, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd2, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd5, 0xd9, 0xd2, 0xd5, 0xd2, 0xd9, 0xd9, 0xda, 0xd9, 0xda, 0xd2, 0xd2, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd5, 0xcc, 0xdd, 0xd0, 0xdf, 0xf0, 0xf6, 0xc8, 0x00, 0x22, 0x03, 0x23, 0x22, 0x00, 0x8f, 0x02, 0xe3, 0xe4, 0xe0, 0xdf, 0xe4, 0xe4, 0xe0, 0xb1, 0xad, 0xb4, 0xb1, 0xb1, 0xb1, 0xb4, 0xb4, 0xb1, 0xb1, 0xc6, 0xdf, 0xdf, 0xe4, 0xd6, 0xe4, 0xf0, 0xe3, 0x86, 0x72, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x7f, 0x7c, 0x85, 0xe5, 0xed, 0xd0, 0xbc, 0xc2, 0xbe, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xc4, 0xc2, 0xbd, 0xbd, 0xc2, 0xcc, 0xcc, 0xcc, 0xcc, 0xd2, 0xcf, 0xcb, 0xf0, 0xe9, 0x8c, 0x7b, 0x81, 0x7f, 0x80, 0x73, 0x80, 0x04, 0xb7, 0xf3, 0xd0, 0xbd, 0xc0, 0xc0, 0xbe, 0xc2, 0xc2, 0xbe, 0xc0, 0xbe, 0xc2, 0xc2, 0xc0, 0xbe, 0xbe, 0xc0, 0xc2, 0xbe, 0xb9, 0xbd, 0xcc, 0xcc, 0xd2, 0xcc, 0xcc, 0xd2, 0xc9, 0xd0, 0xe4, 0xf5, 0x9c, 0x7a, 0x73, 0x7c, 0x7f, 0x7a, 0x72, 0x7a, 0x00, 0xa7, 0x02, 0x02, 0x02, 0xf4, 0x70, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x70, 0x02, 0xf6, 0xf6, 0xc8, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc6, 0xc3, 0xbb, 0xc5, 0xeb, 0xf6, 0xf6, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xec, 0x6f, 0x00, 0x00, 0x00, 0x7a, 0xa6, 0xf6, 0xea, 0xd8, 0xd8, 0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdd, 0xd9, 0xdd, 0xd2, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd5, 0xd9, 0xd9, 0xd9, 0xd9, 0xd2, 0xd9, 0xd9, 0xdd, 0xdd, 0xd8, 0xe4, 0xf0, 0x02, 0x9f, 0x00, 0x22, 0x03, 0x01, 0x01, 0x00, 0xa3, 0x02, 0xe5, 0xe0, 0xdf, 0xdf, 0xe4, 0xe7, 0xe0, 0xb4, 0xac, 0xb4, 0xb1, 0xb7, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xc3, 0xdf, 0xd6, 0xdf, 0xe0, 0xe4, 0xef, 0xe0, 0x83, 0x7e, 0x73, 0x7c, 0x80, 0x80, 0x7f, 0x7f, 0x7c, 0x85, 0xe5, 0xed, 0xd0, 0xbc, 0xc4, 0xbe, 0xc2, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xbd, 0xbd, 0xc2, 0xc2, 0xbd, 0xc2, 0xc4, 0xc4, 0xcc, 0xcc, 0xcc, 0xcc, 0xd2, 0xcf, 0xd0, 0xf0, 0xea, 0x8f, 0x7b, 0x81, 0xfb, 0x7f, 0x74, 0x73, 0x7e, 0xb2, 0xf3, 0xda, 0xbc, 0xc0, 0xc0, 0xbe, 0xc2, 0xc2, 0xbe, 0xc0, 0xbe, 0xc2, 0xbe, 0xc2, 0xbe, 0xc0, 0xc2, 0xbe, 0xbd, 0xbd, 0xc4, 0xcc, 0xcc, 0xd2, 0xcc, 0xcc, 0xcc, 0xcf, 0xd0, 0xe4, 0xf5, 0x9e, 0x7a, 0x73, 0x7d, 0x73, 0x72, 0x7a, 0x72, 0x00, 0xa3, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf6, 0xf6, 0xf6, 0xc8, 0xc3, 0xc5, 0xc3, 0xc3, 0xc6, 0xc3, 0xc3, 0xbb, 0xc5, 0xee, 0x02, 0x70, 0x70, 0x02, 0xf6, 0x02, 0x02, 0x56, 0x7b, 0x00, 0x79, 0x00, 0x71, 0xa7, 0xf5, 0xe4, 0xdf, 0xd0, 0xdd, 0xda, 0xda, 0xd5, 0xda, 0xd8, 0xda, 0xd8, 0xda, 0xd8, 0xda, 0xd8, 0xcf, 0xd8, 0xcf, 0xd8, 0xda, 0xd8, 0xda, 0xd8, 0xda, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdd, 0xd0, 0xd5, 0xd8, 0xda, 0xd8, 0xdd, 0xd8, 0xda, 0xd8, 0xda, 0xd8, 0xda, 0xd8, 0xcf, 0xdd, 0xda, 0xd8, 0xda, 0xda, 0xd5, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xdd, 0xd0, 0xdf, 0xea, 0xf3, 0x02, 0x75, 0x00, 0x01, 0x23, 0x01, 0x01, 0x00, 0x78, 0xf5, 0xe1, 0xdf, 0xe0, 0xdf, 0xdf, 0xe4, 0xea, 0xbb, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb4, 0xb1, 0xb1, 0xb1, 0xc3, 0xe4, 0xdf, 0xdf, 0xe4, 0xe0, 0xf0, 0xc8, 0x80, 0x7d, 0x7e, 0x7c, 0x80, 0x80, 0x7f, 0x7f, 0x7c, 0x85, 0xe5, 0xf0, 0xd0, 0xbc, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xc4, 0xc2, 0xbd, 0xc4, 0xc2, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xd2, 0xcf, 0xcb, 0xed, 0xeb, 0x91, 0x7b, 0x81, 0x7f, 0x74, 0x74, 0x74, 0x7d, 0xb2, 0xf3, 0xd8, 0xbd, 0xc0, 0xc0, 0xc2, 0xc2, 0xc2, 0xbe, 0xc0, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xbd, 0xbe, 0xc4, 0xc4, 0xcc, 0xd2, 0xd2, 0xcc, 0xcc, 0xd2, 0xc9, 0xd0, 0xe4, 0xf5, 0xa1, 0x7a, 0x73, 0x7c, 0x7f, 0x72, 0x72, 0x72, 0x00, 0x9a, 0x02, 0xf6, 0x70, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0xf5, 0xf6, 0xcd, 0xc3, 0xc5, 0xc3, 0xc6, 0xc3, 0xc6, 0xc3, 0xc3, 0xc8, 0xeb, 0x02, 0xf6, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xa3, 0x22, 0x22, 0x22, 0x22, 0x72, 0xa7, 0xf5, 0xe5, 0xd6, 0xd0, 0xd0, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd0, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xdf, 0xd8, 0xdf, 0xd8, 0xdf, 0xd8, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd8, 0xdf, 0xd8, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd0, 0xd0, 0xd8, 0xd0, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdd, 0xdd, 0xdd, 0xd8, 0xda, 0xd8, 0xda, 0xdd, 0xda, 0xdd, 0xd0, 0xdf, 0xe4, 0xed, 0x02, 0xcd, 0x79, 0x22, 0x23, 0x01, 0x01, 0x22, 0x71, 0xeb, 0xf0, 0xe1, 0xe1, 0xdf, 0xdf, 0xe4, 0xe0, 0xea, 0xc3, 0xb2, 0xb1, 0xb4, 0xb4, 0xb4, 0xb7, 0xb4, 0xb1, 0xb1, 0xc3, 0xdf, 0xdf, 0xdc, 0xe4, 0xe0, 0xf5, 0xbf, 0x7f, 0x7e, 0x73, 0x7c, 0x80, 0x80, 0x7f, 0x7e, 0x7c, 0x85, 0xe5, 0xf0, 0xcf, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xc2, 0xbd, 0xc4, 0xc4, 0xc4, 0xcc, 0xcc, 0xcc, 0xcc, 0xd2, 0xcc, 0xcf, 0xcb, 0xed, 0xed, 0x98, 0x7b, 0x74, 0x81, 0x7f, 0x74, 0x73, 0x7d, 0xa9, 0xf5, 0xdd, 0xbd, 0xbe, 0xc0, 0xbe, 0xc2, 0xc2, 0xbe, 0xc0, 0xbe, 0xc2, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xbe, 0xc4, 0xc4, 0xcc, 0xcc, 0xd2, 0xd2, 0xcc, 0xcc, 0xcc, 0xcf, 0xc9, 0xe4, 0xf5, 0xa5, 0x7a, 0x73, 0x73, 0x73, 0x7c, 0x7a, 0x72, 0x71, 0x37, 0xf4, 0x02, 0xf9, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf5, 0xf6, 0xc8, 0xbf, 0xc6, 0xc3, 0xc6, 0xc3, 0xc6, 0xc3, 0xbb, 0xc8, 0xee, 0xf6, 0x70, 0x70, 0x02, 0x02, 0x02, 0x5a, 0x8f, 0x22, 0x00, 0x00, 0x22, 0x22, 0xab, 0x02, 0xf0, 0xdb, 0xd6, 0xe4, 0xdf, 0xdf, 0xe4, 0xe4, 0xe5, 0xe7, 0xe9, 0xe7, 0xea, 0xea, 0xea, 0xea, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xf0, 0xed, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xed, 0xee, 0xed, 0xee, 0xea, 0xed, 0xed, 0xea, 0xea, 0xe7, 0xe5, 0xe4, 0xe9, 0xe7, 0xe5, 0xe4, 0xe1, 0xdf, 0xdc, 0xdf, 0xd6, 0xdf, 0xd6, 0xd6, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd0, 0xdf, 0xe5, 0xf5, 0x02, 0xa3, 0x00, 0x01, 0x03, 0x01, 0x79, 0x00, 0x6f, 0xf3, 0xeb, 0xe0, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xbb, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb4, 0xb1, 0xb1, 0xb4, 0xc6, 0xdc, 0xdf, 0xdc, 0xe4, 0xe0, 0xf5, 0xb2, 0x7e, 0x7c, 0x7e, 0x7c, 0x80, 0x81, 0x7f, 0x7e, 0x7b, 0x85, 0xe5, 0xf0, 0xd8, 0xbc, 0xc4, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xc2, 0xc4, 0xc4, 0xbd, 0xc4, 0xc4, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcc, 0xcf, 0xcf, 0xcb, 0xed, 0xf1, 0x99, 0x7b, 0x81, 0xfb, 0x7f, 0x74, 0x7f, 0xfb, 0xa9, 0xf3, 0xdd, 0xbc, 0xc0, 0xc0, 0xc2, 0xc2, 0xc2, 0xbe, 0xc0, 0xc0, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xbd, 0xc2, 0xc4, 0xcc, 0xcc, 0xd2, 0xcc, 0xd2, 0xd2, 0xcc, 0xd2, 0xcf, 0xc9, 0xe4, 0xf5, 0xa8, 0x71, 0x7d, 0x73, 0x7d, 0x7c, 0x72, 0x72, 0x79, 0x75, 0xef, 0x02, 0xf9, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x21, 0x02, 0xf6, 0xf6, 0xcd, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc8, 0xee, 0xf6, 0xf4, 0x70, 0x02, 0x02, 0x02, 0x78, 0xfb, 0x22, 0x00, 0x22, 0x00, 0x23, 0xa3, 0xf9, 0x02, 0xf4, 0xf0, 0x70, 0xf5, 0xf4, 0xf5, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf5, 0x70, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf0, 0xf0, 0xed, 0xed, 0xea, 0xe7, 0xe4, 0xe4, 0xe4, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xd6, 0xe4, 0xed, 0xf6, 0xdb, 0x6f, 0x22, 0x03, 0x01, 0x22, 0x01, 0x00, 0x77, 0xf6, 0xe5, 0xe0, 0xe4, 0xe5, 0xe4, 0xe4, 0xe0, 0xdc, 0xbb, 0xb4, 0xb4, 0xb1, 0xb1, 0xb1, 0xb7, 0xb4, 0xbb, 0xc6, 0xd6, 0xe4, 0xe4, 0xdf, 0xe0, 0xe4, 0xf5, 0xa6, 0x7d, 0x7c, 0x7f, 0x7c, 0x80, 0x80, 0x7e, 0x7f, 0x72, 0x85, 0xe5, 0xf0, 0xcf, 0xc1, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xc2, 0xc4, 0xc4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcb, 0xcb, 0xe7, 0xf3, 0x9a, 0x7b, 0xfb, 0x81, 0x7f, 0x74, 0x73, 0x7d, 0xfa, 0xf3, 0xe2, 0xbd, 0xc0, 0xc0, 0xc0, 0xc2, 0xc2, 0xbe, 0xc0, 0xc2, 0xc2, 0xbe, 0xbe, 0xc0, 0xbe, 0xbe, 0xc4, 0xcc, 0xcc, 0xd2, 0xcc, 0xcf, 0xcc, 0xd2, 0xcc, 0xcc, 0xcf, 0xc9, 0xe4, 0xf5, 0xaa, 0x71, 0x73, 0x73, 0x73, 0x7c, 0x72, 0x7a, 0x72, 0x74, 0x6c, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x70, 0x70, 0x02, 0xf6, 0x02, 0xc3, 0xbf, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xbb, 0xc5, 0xee, 0xf6, 0xf4, 0x70, 0x02, 0x02, 0xf6, 0xfa, 0x22, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x6f, 0xb6, 0x5a, 0x02, 0xf1, 0xf4, 0xe9, 0xe9, 0xde, 0xcd, 0xb6, 0xb2, 0xab, 0xfa, 0xa3, 0x9f, 0x77, 0x98, 0x95, 0x91, 0x37, 0x8f, 0x8a, 0x8a, 0x6f, 0x75, 0x6f, 0x75, 0x6f, 0x75, 0x6f, 0x75, 0x6f, 0x75, 0x6f, 0x6f, 0x8a, 0x8a, 0x8f, 0x37, 0x93, 0x98, 0x98, 0x77, 0x9f, 0xa5, 0xfa, 0xa7, 0xae, 0xb6, 0x78, 0xd3, 0xe3, 0xec, 0xf1, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf5, 0xf0, 0xf0, 0xed, 0xea, 0xe7, 0xf0, 0x02, 0xf5, 0x9f, 0x22, 0x22, 0x01, 0x22, 0x01, 0x01, 0x00, 0xac, 0xf6, 0xe5, 0xdb, 0xe4, 0xe4, 0xdf, 0xd6, 0xca, 0xce, 0xbf, 0xc5, 0xc5, 0xc5, 0xd0, 0xce, 0xd6, 0xdc, 0xe1, 0xe4, 0xe4, 0xe4, 0xd6, 0xe1, 0xe4, 0xe5, 0xf3, 0xa1, 0x72, 0x7c, 0x7f, 0x7c, 0x80, 0x81, 0x7f, 0x7e, 0x7b, 0x85, 0xe5, 0xf0, 0xd0, 0xc4, 0xc4, 0xbe, 0xc2, 0xc2, 0xc2, 0xc4, 0xc2, 0xc2, 0xc4, 0xc4, 0xbd, 0xc4, 0xc4, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xd2, 0xcb, 0xd0, 0xe7, 0xf3, 0x77, 0x7c, 0x7f, 0x81, 0x7f, 0x74, 0x74, 0x7d, 0xa5, 0xf3, 0xe2, 0xbc, 0xbe, 0xc0, 0xbe, 0xc2, 0xc2, 0xc2, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xbd, 0xc2, 0xc4, 0xcc, 0xd2, 0xcc, 0xcf, 0xcc, 0xd2, 0xd2, 0xcc, 0xd2, 0xcf, 0xc9, 0xe4, 0xf5, 0xac, 0x71, 0x73, 0x7f, 0x7c, 0x7d, 0x7a, 0x72, 0x72, 0x5f, 0xd3, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf9, 0xf6, 0x02, 0xe6, 0xc5, 0xbf, 0xc3, 0xbb, 0xc3, 0xc6, 0xc3, 0xb7, 0xe0, 0xf0, 0x02, 0xf3, 0xf9, 0x02, 0x02, 0x6c, 0x83, 0x00, 0x00, 0x22, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x83, 0x8a, 0x95, 0xa3, 0xa7, 0xae, 0x78, 0xd3, 0xe3, 0xe6, 0xec, 0xf2, 0xf5, 0xf2, 0x02, 0xe6, 0x9a, 0x79, 0x00, 0x5f, 0x01, 0x01, 0x01, 0x22, 0x00, 0xde, 0xe8, 0xe1, 0xe0, 0xd6, 0xdc, 0xd4, 0xc6, 0xd6, 0xce, 0xdc, 0xdc, 0xe0, 0xdf, 0xdc, 0xd6, 0xe5, 0xe4, 0xe1, 0xdc, 0xe0, 0xe0, 0xe5, 0xe4, 0xd4, 0xf6, 0xcd, 0x87, 0x7a, 0x7c, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x7d, 0x7c, 0x87, 0xe5, 0xf0, 0xda, 0xbc, 0xb9, 0xc2, 0xbe, 0xbe, 0xc2, 0xc2, 0xc2, 0xc4, 0xc2, 0xbd, 0xc4, 0xc4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xc9, 0xed, 0xed, 0xa5, 0x7a, 0x81, 0x81, 0x7f, 0x7f, 0xfb, 0x7d, 0xa5, 0xf3, 0xdf, 0xc1, 0xbd, 0xc0, 0xc0, 0xba, 0xbe, 0xc0, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xc4, 0xc4, 0xd2, 0xd2, 0xcf, 0xd5, 0xcf, 0xcf, 0xcf, 0xd2, 0xcc, 0xcc, 0xcf, 0xcf, 0xdf, 0xf5, 0xb1, 0x71, 0x7c, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x01, 0x72, 0xb6, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf2, 0xe3, 0xbb, 0xbb, 0xc3, 0xc3, 0xc3, 0xb7, 0xca, 0xd6, 0xdc, 0xee, 0xf4, 0xf2, 0x02, 0x21, 0xfa, 0x23, 0x00, 0x79, 0x00, 0x00, 0x71, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x7d, 0xfb, 0x75, 0x6f, 0x6f, 0x8a, 0x75, 0x7b, 0x00, 0x22, 0x22, 0x01, 0x00, 0x01, 0x01, 0x72, 0x78, 0xf4, 0xdc, 0xdc, 0xce, 0xc5, 0xca, 0xe0, 0xca, 0xce, 0xd6, 0xd6, 0xdc, 0xdc, 0xe0, 0xe4, 0xd6, 0xe0, 0xe3, 0xe7, 0xe5, 0xe4, 0xe3, 0xe5, 0xe5, 0xd4, 0x9a, 0x7a, 0x7c, 0x80, 0x7e, 0x7c, 0x80, 0x80, 0x73, 0x7e, 0x7b, 0x85, 0xe5, 0xed, 0xdd, 0xbd, 0xbe, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xc2, 0xc4, 0xc4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcb, 0xe7, 0xf0, 0xa5, 0x72, 0x81, 0x81, 0x80, 0xfb, 0x81, 0x7c, 0xa1, 0xf3, 0xe2, 0xc9, 0xbd, 0xbe, 0xc0, 0xc0, 0xc0, 0xbe, 0xbe, 0xbe, 0xc0, 0xc2, 0xbd, 0xbd, 0xc4, 0xc4, 0xd2, 0xcf, 0xd2, 0xcf, 0xcf, 0xcf, 0xd2, 0xd2, 0xcc, 0xcc, 0xcf, 0xc9, 0xdf, 0xf5, 0xb1, 0x71, 0x7f, 0x7f, 0x7c, 0x7b, 0x72, 0x72, 0x72, 0x72, 0xab, 0x02, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf5, 0xdb, 0xbb, 0xc3, 0xcd, 0xbb, 0xb7, 0xca, 0xe1, 0xcd, 0xdb, 0xeb, 0x02, 0xf6, 0x56, 0xfb, 0x00, 0x22, 0x22, 0x00, 0x00, 0x71, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7b, 0x79, 0x22, 0x01, 0x72, 0x01, 0x71, 0xa5, 0xf1, 0xe4, 0xc5, 0xca, 0xd6, 0xcd, 0xce, 0xd6, 0xd4, 0xd6, 0xd4, 0xd6, 0xdc, 0xe0, 0xe0, 0xe5, 0xe5, 0xe1, 0xdc, 0xcd, 0xb4, 0xb1, 0x9c, 0x93, 0x80, 0x71, 0x7c, 0x7f, 0x7a, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x7f, 0x7c, 0x75, 0xe4, 0xf0, 0xd8, 0xbc, 0xc2, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xc4, 0xc4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xc9, 0xea, 0xf0, 0xa6, 0x7b, 0x80, 0x81, 0x74, 0x81, 0x7f, 0x7c, 0xa1, 0xf3, 0xe4, 0xc1, 0xbd, 0xbe, 0xc0, 0xc0, 0xc0, 0xbe, 0xbe, 0xc0, 0xc2, 0xc2, 0xc2, 0xbd, 0xc4, 0xd2, 0xd2, 0xd2, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcc, 0xcf, 0xcf, 0xc9, 0xd6, 0xf3, 0xb4, 0x71, 0x80, 0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x72, 0x79, 0xa5, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0xf6, 0xf6, 0xf4, 0xf1, 0xdb, 0xc8, 0xcd, 0xc6, 0xb7, 0xbb, 0xe0, 0xee, 0xf0, 0xf1, 0xec, 0xae, 0x6f, 0x00, 0x00, 0x22, 0x00, 0x79, 0x79, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x79, 0x79, 0x71, 0x22, 0x7a, 0x79, 0x7a, 0x71, 0x83, 0xa1, 0xdc, 0xce, 0xcd, 0xce, 0xd6, 0xcd, 0xd4, 0xd4, 0xdc, 0xe0, 0xe5, 0xe3, 0xe1, 0xe0, 0xb7, 0xac, 0xa1, 0x96, 0x87, 0x7e, 0x79, 0x7a, 0x7a, 0x7a, 0x7e, 0x7c, 0x7c, 0x81, 0x7e, 0x7c, 0x80, 0x80, 0x73, 0x7f, 0x7c, 0x85, 0xe0, 0xf3, 0xd8, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xbe, 0xcc, 0xc4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xc9, 0xe7, 0xf3, 0xa7, 0x7d, 0x7f, 0x81, 0x80, 0x80, 0x7e, 0x7e, 0xa0, 0xf0, 0xe2, 0xc1, 0xbd, 0xc2, 0xc0, 0xc0, 0xc0, 0xbe, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xcc, 0xd2, 0xd2, 0xcc, 0xd2, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xd2, 0xd0, 0xc9, 0xdf, 0xf5, 0xbb, 0x7a, 0x73, 0x7d, 0x7f, 0x7d, 0x7c, 0x72, 0x72, 0x71, 0x77, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0xf9, 0xf6, 0xef, 0xe3, 0xcd, 0xc5, 0xc3, 0xbb, 0xc5, 0xe9, 0xde, 0xfa, 0x8a, 0x7b, 0x00, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x71, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x79, 0x23, 0x01, 0x71, 0x79, 0x71, 0x71, 0x72, 0x7e, 0x7e, 0x80, 0xaa, 0xd1, 0xd6, 0xca, 0xcd, 0xca, 0xdb, 0xe5, 0xe1, 0xcd, 0xb4, 0xfa, 0x99, 0x87, 0x81, 0x7e, 0x7a, 0x7a, 0x7a, 0x7e, 0x7e, 0x7c, 0x7f, 0x7c, 0x7f, 0x80, 0x7b, 0x7c, 0x7f, 0x7c, 0x80, 0x80, 0x7e, 0x7f, 0x7d, 0x85, 0xd4, 0xf3, 0xdf, 0xc1, 0xc4, 0xc2, 0xc4, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcc, 0xcf, 0xcf, 0xc9, 0xea, 0xf3, 0xa7, 0x7c, 0xfb, 0x74, 0x74, 0x80, 0x7f, 0x7e, 0x9e, 0xed, 0xe7, 0xbc, 0xc4, 0xc2, 0xc0, 0xbe, 0xc2, 0xc2, 0xc4, 0xc2, 0xbd, 0xb9, 0xc4, 0xcc, 0xcc, 0xcc, 0xcf, 0xd2, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xc9, 0xd0, 0xdf, 0xf5, 0xc3, 0x7a, 0x7c, 0x7d, 0x7f, 0x7d, 0x7b, 0x7a, 0x72, 0x01, 0x95, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 
-  0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0xf6, 0xf4, 0xf6, 0xef, 0xe1, 0xcd, 0xc5, 0xc8, 0xbb, 0x9a, 0x82, 0x71, 0x00, 0x00, 0x79, 0x23, 0x00, 0x22, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x79, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x01, 0x01, 0x01, 0x00, 0x22, 0x22, 0x79, 0x71, 0x00, 0x71, 0x7a, 0x7c, 0x80, 0x81, 0x8d, 0x8c, 0x80, 0xa0, 0xc5, 0xe0, 0xd4, 0xe1, 0xd4, 0xa8, 0x77, 0x87, 0x7d, 0x7a, 0x7b, 0x80, 0x7c, 0x7e, 0x7e, 0x7e, 0x7f, 0x7c, 0x7c, 0x7e, 0x74, 0x7c, 0x7a, 0x7d, 0x81, 0x81, 0x7e, 0x7e, 0x80, 0x80, 0x7e, 0x7f, 0x73, 0x81, 0xbf, 0xf3, 0xe4, 0xc1, 0xc1, 0xc4, 0xc4, 0xc4, 0xbd, 0xc4, 0xc4, 0xcc, 0xc4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcb, 0xd0, 0xe7, 0xf4, 0xa6, 0x7b, 0x7f, 0x81, 0x7f, 0x80, 0x7e, 0x7e, 0x9a, 0xea, 0xea, 0xc9, 0xc1, 0xc4, 0xc4, 0xc2, 0xc4, 0xc4, 0xbc, 0xc4, 0xbc, 0xc4, 0xcc, 0xd5, 0xcf, 0xcf, 0xcf, 0xd8, 0xcf, 0xda, 0xcf, 0xcf, 0xcf, 0xcf, 0xc9, 0xd0, 0xc9, 0xce, 0xe4, 0xf4, 0xb4, 0x71, 0x7e, 0x73, 0x7d, 0x7c, 0x72, 0x72, 0x72, 0x79, 0x8f, 0xeb, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x21, 0x02, 0x21, 0x21, 0x21, 0x02, 0x02, 0x02, 0xf5, 0xef, 0xe6, 0xdb, 0xb4, 0x6f, 0x71, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x79, 0x22, 0x00, 0x01, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x71, 0x01, 0x7a, 0x71, 0x84, 0x8d, 0x86, 0x94, 0x82, 0x7c, 0x97, 0xdc, 0xdc, 0xe0, 0xd4, 0x83, 0x7a, 0x72, 0x7a, 0x7d, 0x7f, 0x7d, 0x7b, 0x7c, 0x7f, 0x7f, 0x7f, 0x73, 0x7e, 0x7d, 0x80, 0x7d, 0x7f, 0x74, 0x7f, 0x7f, 0x72, 0x74, 0x7c, 0x80, 0x80, 0x7e, 0x7f, 0x7e, 0x7b, 0xbb, 0xf1, 0xea, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xcb, 0xcf, 0xcc, 0xcb, 0xcf, 0xcb, 0xcf, 0xc9, 0xcf, 0xc9, 0xcf, 0xcb, 0xcf, 0xcb, 0xc6, 0xed, 0xf5, 0xa7, 0x72, 0x7f, 0x74, 0x7f, 0x81, 0x7e, 0x7c, 0x99, 0xe9, 0xed, 0xd0, 0xc1, 0xbc, 0xbc, 0xc1, 0xbc, 0xc1, 0xc1, 0xb5, 0xc1, 0xc9, 0xcf, 0xcf, 0xd8, 0xcb, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xc9, 0xd8, 0xd0, 0xd0, 0xca, 0xdf, 0xe7, 0x02, 0xac, 0x00, 0x7f, 0x74, 0x73, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x6f, 0xe3, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0x21, 0x02, 0x21, 0xf9, 0xf6, 0x02, 0x02, 0xf5, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x71, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x22, 0x01, 0x01, 0x79, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7d, 0x82, 0x9a, 0xa6, 0xa9, 0xa6, 0xb7, 0xe1, 0xc6, 0xe1, 0xcd, 0x84, 0x7c, 0x7e, 0x7e, 0x7f, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7f, 0x7f, 0x7c, 0x7f, 0x80, 0x80, 0x7e, 0x80, 0x72, 0x77, 0xf1, 0xf3, 0xe7, 0xe2, 0xc1, 0xc9, 0xc9, 0xc9, 0xd0, 0xd0, 0xd8, 0xd8, 0xd0, 0xd0, 0xd0, 0xd0, 0xd8, 0xd0, 0xd8, 0xd0, 0xd8, 0xd8, 0xcf, 0xd0, 0xd0, 0xdf, 0xf5, 0xea, 0x95, 0x7b, 0x83, 0x72, 0x81, 0x7c, 0x83, 0x7d, 0x85, 0xb6, 0x02, 0xea, 0xe7, 0xe2, 0xe7, 0xe2, 0xe7, 0xe7, 0xe7, 0xed, 0xed, 0xe7, 0xed, 0xed, 0xed, 0xf0, 0xea, 0xea, 0xea, 0xed, 0xed, 0xed, 0xf0, 0xe7, 0xf3, 0xf0, 0xed, 0xf6, 0xf3, 0xe5, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x7c, 0x7b, 0x7c, 0x00, 0x72, 0x83, 0xde, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0xf2, 0x02, 0x21, 0x02, 0x21, 0xf9, 0x02, 0x21, 0xf6, 0xe3, 0x98, 0x00, 0x00, 0x00, 0x71, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x79, 0x79, 0x01, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x79, 0x22, 0x00, 0x00, 0x00, 0x71, 0x7a, 0x73, 0x7e, 0x87, 0xbb, 0xe5, 0xe4, 0xcd, 0xca, 0xc8, 0xc3, 0xe1, 0xa9, 0x7a, 0x7c, 0x7f, 0x7f, 0x7d, 0x7f, 0x7d, 0xfb, 0x7d, 0x7f, 0x7d, 0x7f, 0x7d, 0x7f, 0x7d, 0x7f, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x81, 0x7d, 0x83, 0xae, 0xea, 0xf0, 0xf3, 0xf3, 0xf0, 0xf0, 0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xed, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0xed, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3, 0xfa, 0x73, 0x7b, 0x83, 0x74, 0x7f, 0x81, 0x83, 0x7b, 0x03, 0x9a, 0xc8, 0xef, 0xf0, 0xf0, 0xed, 0xf0, 0xf0, 0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0xea, 0xea, 0xf1, 0xf0, 0xf1, 0xee, 0xee, 0xea, 0xea, 0xef, 0xea, 0xe4, 0xe6, 0xe5, 0xb1, 0x87, 0x7e, 0x73, 0x7e, 0x7d, 0x73, 0x7c, 0x7c, 0x7b, 0x7a, 0x72, 0x74, 0x78, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x02, 0x02, 0x70, 0xf2, 0x70, 0x02, 0x21, 0x02, 0xf9, 0xbf, 0xfb, 0x00, 0x79, 0x22, 0x71, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x79, 0x79, 0x22, 0x79, 0x22, 0x79, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x79, 0x22, 0x22, 0x00, 0x00, 0x71, 0x72, 0x73, 0x74, 0x80, 0x80, 0x85, 0xc3, 0xd4, 0xca, 0xc8, 0xc3, 0xcd, 0xdb, 0xe5, 0xac, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xfb, 0x7f, 0xfb, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7c, 0x74, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x85, 0x22, 0x82, 0x9f, 0xb4, 0xc3, 0xc6, 0xd4, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xcd, 0xc5, 0xc5, 0xca, 0xc8, 0xc5, 0xcd, 0xc5, 0xce, 0xc5, 0xc6, 0xc6, 0xc6, 0xc3, 0xbb, 0x9f, 0x7f, 0x7b, 0xfb, 0x7f, 0x80, 0x7f, 0xfb, 0xfb, 0xfb, 0x5f, 0xfb, 0x6f, 0x77, 0xaa, 0xaa, 0xad, 0xac, 0xac, 0xab, 0xaa, 0xab, 0xa8, 0xa7, 0xa7, 0xfa, 0xa5, 0xa5, 0xa1, 0xa3, 0xa1, 0x9f, 0x9e, 0x77, 0x9c, 0x99, 0x9a, 0x99, 0x8c, 0x84, 0x7f, 0x7c, 0x7e, 0x73, 0x73, 0x73, 0x73, 0x7c, 0x7c, 0x72, 0x7c, 0x79, 0x7d, 0xb2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x5a, 0xfa, 0x03, 0x00, 0x71, 0x00, 0x71, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x79, 0x79, 0x01, 0x72, 0x01, 0x01, 0x79, 0x22, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x71, 0x72, 0x7c, 0x74, 0x83, 0x75, 0x82, 0x81, 0x86, 0xc8, 0xd4, 0xc5, 0xc6, 0xd4, 0xcd, 0xd4, 0xe1, 0xa7, 0x7e, 0x7c, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x73, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x74, 0x7e, 0x7f, 0x80, 0x7e, 0x7e, 0x7f, 0x74, 0x83, 0x7d, 0x7b, 0x80, 0x82, 0x84, 0x85, 0x85, 0x84, 0x75, 0x82, 0x75, 0x82, 0x75, 0x82, 0x75, 0x82, 0x75, 0x82, 0x75, 0x82, 0x75, 0x82, 0x84, 0x82, 0x82, 0x80, 0x7c, 0x72, 0xfb, 0x7d, 0xfb, 0x80, 0x7e, 0xfb, 0x7d, 0xfb, 0x83, 0x04, 0x72, 0x7b, 0x72, 0x7c, 0x7c, 0x7e, 0x73, 0x7d, 0x7b, 0x72, 0x7c, 0x72, 0x72, 0x72, 0x72, 0x72, 0x7b, 0x72, 0x7b, 0x72, 0x72, 0x7a, 0x7c, 0x7a, 0x7a, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x73, 0x7c, 0x73, 0x73, 0x73, 0x7c, 0x72, 0x7d, 0x79, 0x7b, 0xab, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0xf4, 0xf6, 0x70, 0x02, 0x02, 0x21, 0x6c, 0x95, 0x00, 0x00, 0x01, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x79, 0x79, 0x79, 0x79, 0x01, 0x01, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x7a, 0x7c, 0x74, 0x81, 0x75, 0x82, 0x81, 0x80, 0x81, 0x89, 0xcd, 0xe1, 0xdb, 0xe1, 0xc3, 0xa7, 0x77, 0x96, 0x84, 0x7c, 0x82, 0x7e, 0x7f, 0x7e, 0x7f, 0x73, 0x7f, 0x73, 0x74, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x74, 0x7c, 0x7e, 0x80, 0x80, 0x7e, 0x7f, 0x7d, 0x83, 0xfb, 0x81, 0x81, 0x80, 0x7c, 0x7e, 0x7d, 0x73, 0x7f, 0x73, 0x7e, 0x73, 0x7e, 0x73, 0x7e, 0x7e, 0x7e, 0x7e, 0x73, 0x7d, 0x7d, 0x73, 0x73, 0x7e, 0x7e, 0x74, 0x7d, 0xfb, 0x7d, 0xfb, 0x81, 0x7d, 0x80, 0x7f, 0xfb, 0x7d, 0xfb, 0x83, 0xfb, 0x81, 0x7f, 0x7e, 0x7e, 0x73, 0x7f, 0x7d, 0xfb, 0x7f, 0x7f, 0x7f, 0x74, 0x74, 0xfb, 0x74, 0x7d, 0x74, 0x7d, 0x80, 0x7f, 0x80, 0x7e, 0x81, 0x7f, 0x7f, 0x7f, 0x7c, 0x7c, 0x81, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7c, 0x72, 0x7c, 0x01, 0x7c, 0xfa, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0xf4, 0x02, 0xf6, 0x02, 0x02, 0xb2, 0xfb, 0x00, 0x22, 0x22, 0x00, 0x79, 0x00, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x22, 0x79, 0x79, 0x01, 0x01, 0x01, 0x01, 0x79, 0x22, 0x22, 0x22, 0x00, 0x22, 0x00, 0x22, 0x22, 0x22, 0x79, 0x00, 0x00, 0x00, 0x22, 0x01, 0x01, 0x7b, 0x74, 0x74, 0x82, 0x75, 0x82, 0x81, 0x80, 0x85, 0x7c, 0x85, 0xc3, 0xe0, 0xac, 0x97, 0x83, 0x84, 0x80, 0x7c, 0x80, 0x81, 0x7c, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x74, 0x74, 0x74, 0x7f, 0x74, 0x7f, 0x80, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x83, 0x82, 0x7c, 0x7e, 0x80, 0x80, 0xfb, 0x83, 0xfb, 0x83, 0x72, 0x73, 0x82, 0x81, 0x74, 0x81, 0x74, 0x80, 0x74, 0x80, 0x81, 0x80, 0x74, 0x80, 0x74, 0x7f, 0x74, 0xfb, 0x65, 0xfb, 0x74, 0x7c, 0x73, 0x7f, 0x7b, 0xfb, 0x83, 0x83, 0x74, 0x72, 0x82, 0x7f, 0x80, 0xfb, 0xfb, 0x7d, 0xfb, 0x7f, 0x74, 0x80, 0x80, 0x7f, 0x74, 0xfb, 0xfb, 0x74, 0x7f, 0x74, 0x7d, 0x74, 0x7f, 0x7f, 0xfb, 0x74, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x73, 0x7b, 0x7b, 0x81, 0x81, 0x7f, 0x72, 0x73, 0x73, 0x7c, 0x73, 0x73, 0x73, 0x7c, 0x72, 0x7c, 0x7b, 0x7b, 0x77, 0xf1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x70, 0x02, 0xf4, 0xfa, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x71, 0x22, 0x01, 0x01, 0x23, 0x72, 0x79, 0x22, 0x79, 0x00, 0x22, 0x00, 0x00, 0x79, 0x22, 0x6e, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x79, 0x72, 0x7d, 0x74, 0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x80, 0x82, 0x82, 0x86, 0x80, 0x7e, 0x80, 0x81, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x74, 0x7f, 0x81, 0x74, 0x74, 0x80, 0x7f, 0x7c, 0x8a, 0x89, 0x8c, 0x90, 0x90, 0x92, 0x8d, 0x91, 0x77, 0x91, 0x7e, 0x7e, 0x82, 0x7c, 0x74, 0xfb, 0x7d, 0x83, 0xfb, 0x75, 0x7d, 0x74, 0x74, 0x74, 0x74, 0x81, 0x74, 0x80, 0x81, 0x80, 0x80, 0x80, 0x74, 0x80, 0xfb, 0xfb, 0x7d, 0xfb, 0x74, 0x81, 0x81, 0xfb, 0x75, 0x7d, 0xfb, 0x7d, 0x7d, 0x83, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0xfb, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x74, 0xfb, 0xfb, 0x74, 0x74, 0x74, 0x74, 0x7f, 0xfb, 0x7f, 0x74, 0x74, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x74, 0x81, 0x74, 0x7d, 0x7b, 0x73, 0x74, 0x73, 0x73, 0x7c, 0x73, 0x73, 0x73, 0x73, 0x72, 0x7c, 0x7f, 0x72, 0x98, 0xe8, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 
-  0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x02, 0xf6, 0x21, 0x21, 0x21, 0x21, 0xf9, 0x02, 0x70, 0x02, 0xef, 0x02, 0x02, 0xf2, 0x70, 0xe8, 0x37, 0x00, 0x7b, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x71, 0x71, 0x00, 0x71, 0x00, 0x71, 0x71, 0x71, 0x79, 0x7a, 0x7a, 0x7a, 0x71, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x01, 0x79, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x22, 0x71, 0x6e, 0x6e, 0x72, 0x23, 0x01, 0x23, 0x22, 0x01, 0x79, 0x79, 0x71, 0x79, 0x00, 0x71, 0x6e, 0x6e, 0x00, 0x00, 0x71, 0x71, 0x79, 0x72, 0x7b, 0x74, 0x81, 0x82, 0x82, 0x80, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x82, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x83, 0x7b, 0x81, 0x83, 0x7f, 0x8f, 0xa3, 0xa1, 0xa1, 0xa0, 0xa0, 0xa0, 0xa0, 0x9d, 0x77, 0xa6, 0xa1, 0x7f, 0x7c, 0x7e, 0x83, 0x74, 0xfb, 0xfb, 0xfb, 0xfb, 0x81, 0xfb, 0xfb, 0x81, 0xfb, 0x83, 0xfb, 0x83, 0xfb, 0x80, 0x81, 0x7f, 0x81, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x7f, 0xfb, 0x7d, 0xfb, 0xfb, 0xfb, 0xfb, 0x7f, 0xfb, 0x7f, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x7f, 0xfb, 0x7f, 0xfb, 0xfb, 0x7d, 0xfb, 0x80, 0x74, 0x74, 0x7f, 0x7f, 0x74, 0x74, 0x74, 0x74, 0x7f, 0x7f, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x7f, 0x73, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7c, 0x7c, 0x7c, 0x80, 0x7a, 0x7e, 0x7d, 0x8a, 0xe3, 0x02, 0xf6, 0xf6, 0x21, 0x21, 0x21, 0x70, 0x70, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 
-  0x02, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x70, 0xf6, 0x02, 0x21, 0x21, 0x21, 0x21, 0xf9, 0x70, 0x02, 0x02, 0x02, 0xf6, 0xf2, 0x02, 0xe6, 0x95, 0x00, 0x03, 0x00, 0x22, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x6e, 0x72, 0x72, 0x7f, 0x82, 0x87, 0x8a, 0x89, 0x8a, 0x8c, 0x8a, 0x8a, 0x8a, 0x88, 0x85, 0x84, 0x82, 0x7e, 0x7c, 0x7a, 0x71, 0x71, 0x00, 0x00, 0x71, 0x22, 0x22, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x79, 0x22, 0x7a, 0x6e, 0x6e, 0x6e, 0x6e, 0x22, 0x22, 0x22, 0x79, 0x22, 0x71, 0x00, 0x71, 0x22, 0x22, 0x00, 0x00, 0x6e, 0x7a, 0x72, 0x7d, 0x7d, 0x83, 0xfb, 0x83, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x7f, 0x80, 0x74, 0x80, 0x80, 0x80, 0x80, 0x80, 0x83, 0x81, 0x7e, 0x87, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9d, 0x9d, 0x9d, 0xa0, 0x9b, 0xa6, 0xa4, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0xfb, 0x74, 0x74, 0x74, 0x81, 0xfb, 0x83, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x74, 0xfb, 0xfb, 0x7d, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x74, 0x74, 0x74, 0x74, 0x7f, 0x74, 0x7f, 0x74, 0x7f, 0x7f, 0x7f, 0x7f, 0x74, 0x7f, 0x80, 0xfb, 0x74, 0x74, 0x7f, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x73, 0x7f, 0x73, 0x73, 0x7f, 0x73, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7c, 0x7c, 0x7a, 0x83, 0x7d, 0x8a, 0xde, 0x02, 0x70, 0x02, 0x21, 0x21, 0x02, 0x70, 0x70, 0x70, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0xf6, 0x02, 0x02, 
-  0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x02, 0x02, 0x21, 0x21, 0x21, 0x21, 0x70, 0x70, 0x70, 0x02, 0x02, 0xec, 0x02, 0xe8, 0x98, 0x00, 0x22, 0x22, 0x79, 0x79, 0x00, 0x00, 0x71, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x7c, 0x73, 0x84, 0x8a, 0x90, 0x96, 0x96, 0x96, 0x93, 0x94, 0x93, 0x94, 0x93, 0x94, 0x91, 0x91, 0x90, 0x90, 0x91, 0x91, 0x91, 0x8c, 0x8a, 0x87, 0x75, 0x73, 0x72, 0x71, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x71, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x22, 0x79, 0x01, 0x7a, 0x71, 0x6e, 0x71, 0x22, 0x22, 0x23, 0x01, 0x79, 0x22, 0x71, 0x22, 0x71, 0x22, 0x79, 0x23, 0x01, 0x7b, 0x7d, 0xfb, 0x81, 0x83, 0x83, 0x83, 0x83, 0x81, 0x83, 0x80, 0x82, 0x81, 0x83, 0x81, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x83, 0x83, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x7e, 0x84, 0x9d, 0xa6, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa6, 0xa8, 0xaa, 0x9b, 0x7a, 0x7e, 0x82, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x74, 0x74, 0x74, 0x80, 0x80, 0x80, 0x7e, 0x80, 0x7f, 0x74, 0x73, 0x80, 0x74, 0x7f, 0x74, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x74, 0x7f, 0x74, 0x7f, 0x7f, 0x7f, 0x7f, 0x74, 0x74, 0x74, 0x74, 0x7f, 0x74, 0x7f, 0x74, 0x7f, 0x7f, 0x73, 0x73, 0x73, 0x7c, 0x73, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7c, 0x7b, 0x6f, 0x83, 0x6f, 0xde, 0x02, 0x70, 0x70, 0x21, 0x21, 0x21, 0x02, 0x70, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 
-  0x02, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf6, 0x21, 0x21, 0x21, 0x02, 0x02, 0x70, 0x70, 0x02, 0x21, 0xf2, 0x20, 0x77, 0x22, 0x03, 0x03, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x71, 0x00, 0x00, 0x00, 0x71, 0x7a, 0x80, 0x85, 0x8c, 0x93, 0x94, 0x96, 0x96, 0x96, 0x96, 0x94, 0x94, 0x91, 0x91, 0x91, 0x91, 0x90, 0x91, 0x90, 0x8e, 0x8c, 0x90, 0x8e, 0x91, 0x8d, 0x8d, 0x8c, 0x8f, 0x8c, 0x8a, 0x75, 0x73, 0x72, 0x71, 0x00, 0x00, 0x22, 0x79, 0x71, 0x00, 0x00, 0x22, 0x79, 0x79, 0x01, 0x79, 0x79, 0x71, 0x79, 0x22, 0x79, 0x79, 0x01, 0x23, 0x79, 0x79, 0x79, 0x79, 0x01, 0x72, 0x7b, 0x7d, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x83, 0x81, 0x83, 0x81, 0x81, 0x82, 0x81, 0x80, 0x74, 0x80, 0x81, 0x81, 0x81, 0x83, 0x74, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x82, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x74, 0x81, 0xfb, 0x80, 0x80, 0x7e, 0x82, 0x80, 0x80, 0x8e, 0xa4, 0xa0, 0xa4, 0xa2, 0x9d, 0x9d, 0x9d, 0xa0, 0x9e, 0x94, 0x82, 0x7a, 0x80, 0x80, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7f, 0x7f, 0x74, 0x74, 0x74, 0x74, 0x74, 0xfb, 0x74, 0x74, 0x74, 0x81, 0x74, 0x74, 0x74, 0x74, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x04, 0xfb, 0x04, 0xfb, 0xfb, 0xfb, 0x04, 0x7d, 0x04, 0x7d, 0x04, 0x7d, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x23, 0x03, 0x2d, 0x2d, 0x2d, 0xd3, 0x02, 0x70, 0x02, 0x21, 0x21, 0x21, 0x21, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 
-  0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x02, 0x02, 0x21, 0x21, 0x21, 0x02, 0x70, 0x70, 0x02, 0xf2, 0x02, 0x02, 0xfa, 0x03, 0x04, 0x05, 0x04, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x71, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x72, 0x80, 0x87, 0x8d, 0x94, 0x96, 0x97, 0x76, 0x99, 0x96, 0x97, 0x99, 0x9c, 0xa1, 0xa1, 0xa1, 0xa4, 0xa1, 0xa1, 0xa1, 0xa1, 0x9e, 0x9e, 0x99, 0x99, 0x94, 0x90, 0x8c, 0x8d, 0x8c, 0x8f, 0x8f, 0x8c, 0x8a, 0x87, 0x7d, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x79, 0x72, 0x01, 0x7a, 0x79, 0x22, 0x79, 0x79, 0x79, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x23, 0x7b, 0x5f, 0xfb, 0x73, 0x80, 0x80, 0x81, 0x82, 0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x83, 0x82, 0x74, 0x80, 0x82, 0x81, 0x82, 0x80, 0x81, 0x80, 0x81, 0x83, 0x75, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xfb, 0x83, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x75, 0xfb, 0x83, 0xfb, 0x7b, 0x7d, 0x81, 0x83, 0x83, 0x83, 0x81, 0x7d, 0x7d, 0x7e, 0x7d, 0x7b, 0x7b, 0x7d, 0xfb, 0x5f, 0xfb, 0x5f, 0xfb, 0x04, 0xfb, 0x04, 0xfb, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x2d, 0x06, 0x2d, 0x06, 0x2d, 0x2d, 0x2d, 0x2d, 0x06, 0x2d, 0x06, 0x06, 0x06, 0x08, 0x07, 0x08, 0x78, 0x21, 0x70, 0x70, 0x21, 0x21, 0x21, 0x21, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 
-  0x02, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0x02, 0xf4, 0xf4, 0x02, 0xf2, 0x02, 0x58, 0x05, 0x28, 0x2d, 0x2b, 0x2b, 0x34, 0x5d, 0x24, 0x23, 0x22, 0x00, 0x00, 0x00, 0x71, 0x00, 0x22, 0x00, 0x00, 0x00, 0x71, 0x7c, 0x80, 0x89, 0x8e, 0x96, 0x97, 0x94, 0x97, 0x99, 0x99, 0xa0, 0xaa, 0xac, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb1, 0xb4, 0xb1, 0xb1, 0xad, 0xad, 0xaa, 0xaa, 0xa6, 0xa1, 0x9c, 0x91, 0x8c, 0x8a, 0x8c, 0x8f, 0x8a, 0x75, 0x7c, 0x6e, 0x00, 0x6e, 0x6e, 0x6e, 0x01, 0x79, 0x01, 0x79, 0x79, 0x79, 0x01, 0x01, 0x79, 0x79, 0x22, 0x23, 0x23, 0x5b, 0x5f, 0x5f, 0xfb, 0x65, 0xfb, 0x81, 0x80, 0x81, 0x74, 0x83, 0xfb, 0x65, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x04, 0x7d, 0x04, 0xfb, 0xfb, 0x05, 0xfb, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x05, 0x06, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x36, 0x07, 0x08, 0x36, 0x08, 0x36, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x44, 0x44, 0x09, 0x44, 0x09, 0x44, 0x09, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x44, 0x49, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x50, 0x50, 0x58, 0x21, 0x70, 0x02, 0x21, 0x21, 0x21, 0x21, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 
-  0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf9, 0x21, 0x21, 0x95, 0x5b, 0x2b, 0x2e, 0x31, 0x2c, 0x62, 0x2b, 0x5d, 0x24, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x87, 0x91, 0x92, 0x96, 0x97, 0x96, 0x9b, 0xa6, 0xad, 0xbb, 0xb7, 0xb1, 0xad, 0xaa, 0xa8, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa4, 0xa4, 0xa4, 0xa5, 0xa6, 0xa8, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0x9e, 0x96, 0x89, 0x8f, 0x8f, 0x87, 0x73, 0x6e, 0x6e, 0x6e, 0x72, 0x7a, 0x6e, 0x79, 0x79, 0x01, 0x03, 0x23, 0x23, 0x22, 0x23, 0x23, 0x5f, 0x27, 0x65, 0x65, 0x2d, 0x65, 0x75, 0x65, 0x81, 0xfb, 0xfb, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x08, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x50, 0x11, 0x50, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x11, 0x0d, 0x49, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x49, 0x49, 0x4a, 0x0b, 0x4a, 0x4a, 0x4e, 0x4e, 0x4e, 0x0d, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4a, 0x4a, 0x4e, 0x4a, 0x4e, 0x4a, 0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4e, 0x4a, 0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x10, 0x0d, 0x17, 0x15, 0x57, 0x20, 0x02, 0x70, 0x21, 0x21, 0x21, 0x21, 0x21, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf6, 0xf4, 0x02, 0xf9, 0x02, 0x58, 0x24, 0x2e, 0x39, 0x39, 0x34, 0x31, 0x31, 0x66, 0x62, 0x24, 0x24, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x94, 0x89, 0x94, 0x9b, 0x99, 0x9e, 0xa8, 0xc3, 0xca, 0xb7, 0xb1, 0xad, 0xb1, 0xb1, 0xb4, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0xc6, 0xc3, 0xc6, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc3, 0xc5, 0xbb, 0xb4, 0xb1, 0xaa, 0xa1, 0x99, 0x91, 0x8f, 0x8f, 0x93, 0x73, 0x6e, 0x72, 0x72, 0x7a, 0x01, 0x01, 0x01, 0x23, 0x22, 0x5b, 0x5b, 0x24, 0x27, 0x6f, 0x66, 0x6f, 0x66, 0x27, 0x5b, 0x03, 0x27, 0xfb, 0x6f, 0x06, 0x06, 0x06, 0x07, 0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x0d, 0x11, 0x16, 0x16, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x0d, 0x16, 0x0d, 0x16, 0x0d, 0x16, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x51, 0x10, 0x51, 0x10, 0x51, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x10, 0x10, 0x10, 0x16, 0x4c, 0x4a, 0x4b, 0x4d, 0x48, 0x4d, 0x4c, 0x4c, 0x48, 0x4c, 0x48, 0x4c, 0x48, 0x4c, 0x48, 0x4c, 0x48, 0x4c, 0x48, 0x4c, 0x48, 0x4c, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x48, 0x4d, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x0e, 0x14, 0x17, 0x16, 0x1e, 0x20, 0x21, 0x02, 0x02, 0x21, 0x21, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x21, 0x21, 0x02, 0x02, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0x21, 0x0a, 0x2e, 0x0a, 0x41, 0x40, 0x40, 0x6a, 0x3c, 0x67, 0x62, 0x24, 0x24, 0x03, 0x24, 0x79, 0x6e, 0x00, 0x00, 0x6e, 0x71, 0x87, 0x85, 0x76, 0x8e, 0x99, 0xa8, 0xb1, 0xad, 0xa8, 0xa4, 0xa0, 0x9e, 0x9d, 0x9c, 0x9d, 0x9c, 0x9b, 0x9c, 0x9b, 0x9b, 0x9c, 0x9b, 0x9c, 0x9b, 0x9c, 0x9e, 0x9e, 0x9e, 0xa0, 0xa1, 0xa4, 0xa4, 0xa6, 0xa8, 0xaa, 0xb1, 0xbb, 0xbb, 0xb1, 0xa1, 0x96, 0x8d, 0x8a, 0x89, 0x5f, 0x6e, 0x72, 0x72, 0x72, 0x03, 0x23, 0x03, 0x5b, 0x24, 0x29, 0x66, 0x66, 0x6f, 0x66, 0x93, 0x27, 0x23, 0x22, 0x5b, 0x23, 0x22, 0x03, 0x07, 0x0a, 0x11, 0x0d, 0x17, 0x14, 0x17, 0x17, 0x17, 0x17, 0x17, 0x14, 0x17, 0x0f, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x10, 0x0f, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x51, 0x0f, 0x51, 0x0f, 0x51, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x51, 0x4c, 0x4a, 0x45, 0x4a, 0x45, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x0e, 0x18, 0x19, 0x16, 0x1e, 0x20, 0x21, 0x02, 0xf6, 0xf6, 0x21, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf9, 0x21, 0x20, 0x3e, 0x47, 0x52, 0x44, 0x37, 0x2b, 0x68, 0x43, 0x46, 0x68, 0x27, 0x24, 0x03, 0x24, 0x23, 0x5b, 0x6e, 0x71, 0x00, 0x74, 0x8c, 0x8e, 0x99, 0xa0, 0xaa, 0xa8, 0xa6, 0xa2, 0xa4, 0xa6, 0xa8, 0xaa, 0xaa, 0xac, 0xad, 0xac, 0xad, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa6, 0xa6, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0x9e, 0xa4, 0xa5, 0xa6, 0xa9, 0xa1, 0x96, 0x8f, 0x76, 0x85, 0x6e, 0x7a, 0x72, 0x03, 0x23, 0x03, 0x24, 0x28, 0x2c, 0x32, 0x2b, 0x69, 0x46, 0xa1, 0x69, 0x69, 0x32, 0x24, 0x23, 0x00, 0x23, 0x23, 0x04, 0x09, 0x11, 0x54, 0x10, 0x17, 0x0f, 0x13, 0x14, 0x14, 0x14, 0x14, 0x0f, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x0e, 0x12, 0x12, 0x12, 0x0f, 0x0f, 0x0f, 0x14, 0x12, 0x0f, 0x0e, 0x14, 0x0f, 0x14, 0x0f, 0x12, 0x0e, 0x14, 0x0f, 0x14, 0x0f, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x14, 0x0e, 0x14, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x51, 0x0d, 0x54, 0x4e, 0x42, 0x4b, 0x45, 0x45, 0x48, 0x48, 0x4d, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x19, 0x19, 0x17, 0x1e, 0x20, 0x21, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x21, 0x70, 0x02, 0x70, 0x70, 0xf6, 0x21, 0x21, 0x57, 0x47, 0x0d, 0x47, 0x06, 0x23, 0x2d, 0xbf, 0xb2, 0x98, 0xa3, 0x95, 0x28, 0x5b, 0x24, 0x5b, 0x23, 0x6e, 0x6e, 0x72, 0x8a, 0x87, 0x76, 0x99, 0xad, 0xbb, 0xb7, 0xb7, 0xbb, 0xc5, 0xbb, 0xbb, 0xb4, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb4, 0xb7, 0xb4, 0xb4, 0xb4, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb1, 0xb7, 0xbb, 0xb7, 0xb1, 0xad, 0xac, 0xb1, 0xaa, 0x9e, 0x91, 0x91, 0x93, 0x74, 0x7a, 0x7b, 0x03, 0x03, 0x24, 0x28, 0x2b, 0x31, 0x67, 0x43, 0x56, 0xb2, 0xa5, 0xae, 0x43, 0x68, 0x32, 0x24, 0x23, 0x5b, 0x22, 0x22, 0x06, 0x49, 0x11, 0x51, 0x0e, 0x12, 0x14, 0x13, 0x14, 0x14, 0x14, 0x12, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x12, 0x0e, 0x0e, 0x12, 0x14, 0x12, 0x12, 0x0e, 0x12, 0x0f, 0x12, 0x0f, 0x14, 0x0f, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x4c, 0x54, 0x1e, 0x52, 0x42, 0x42, 0x3f, 0x3f, 0x45, 0x45, 0x48, 0x48, 0x48, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x19, 0x19, 0x17, 0x1e, 0x20, 0x21, 0x02, 0xf6, 0xf6, 0xf6, 0x70, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x21, 0x02, 0x02, 0x70, 0x70, 0x02, 0xf6, 0x21, 0x21, 0x15, 0x47, 0x45, 0x3d, 0x5d, 0x23, 0x75, 0xd3, 0xeb, 0x9a, 0x77, 0x46, 0x2d, 0x24, 0x24, 0x5b, 0x6e, 0x23, 0x71, 0x5f, 0x87, 0x8e, 0x97, 0xb1, 0xbb, 0xad, 0xaa, 0xa8, 0xa8, 0xa6, 0xa5, 0xa4, 0xa1, 0xa0, 0xa0, 0xa0, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa4, 0xa1, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa4, 0xa5, 0xa6, 0xa6, 0xa8, 0xaa, 0xaa, 0xa8, 0xaa, 0xaa, 0xad, 0xb4, 0xad, 0xb1, 0xaa, 0x76, 0x8f, 0x96, 0x85, 0x01, 0x7b, 0x03, 0x03, 0x28, 0x2b, 0x31, 0x3c, 0x53, 0x6d, 0x6d, 0xac, 0x9e, 0xae, 0x77, 0x32, 0x37, 0x32, 0x5d, 0x00, 0x5b, 0x22, 0x5b, 0x09, 0x11, 0x10, 0x0f, 0x12, 0x13, 0x14, 0x13, 0x0f, 0x14, 0x0e, 0x12, 0x13, 0x13, 0x13, 0x14, 0x13, 0x14, 0x14, 0x14, 0x14, 0x51, 0x51, 0x51, 0x51, 0x51, 0x0e, 0x0e, 0x14, 0x0e, 0x0e, 0x0e, 0x12, 0x0f, 0x0f, 0x12, 0x0f, 0x12, 0x0f, 0x13, 0x0f, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0f, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x4d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x51, 0x0d, 0x4e, 0x1f, 0x57, 0x50, 0x47, 0x4e, 0x4b, 0x45, 0x3f, 0x45, 0x48, 0x4d, 0x4d, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x48, 0x4c, 0x48, 0x4c, 0x48, 0x4c, 0x48, 0x4c, 0x48, 0x4d, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4b, 0x4b, 0x4b, 0x4b, 0x48, 0x4b, 0x48, 0x4b, 0x48, 0x4b, 0x4b, 0x4b, 0x48, 0x45, 0x4d, 0x54, 0x1a, 0x1a, 0x1e, 0x20, 0x21, 0xf4, 0xf6, 0xf6, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x21, 0xf6, 0x21, 0x02, 0x70, 0x70, 0x70, 0x02, 0xf9, 0x21, 0x20, 0x50, 0x49, 0x45, 0x41, 0x28, 0x5b, 0x67, 0xe9, 0xf0, 0x9e, 0xa3, 0xa7, 0x3e, 0x24, 0x5b, 0x23, 0x23, 0x7a, 0x7a, 0x81, 0x89, 0x96, 0x96, 0xb4, 0xa6, 0x9b, 0x99, 0x9b, 0x9a, 0x9c, 0x77, 0xa0, 0xa1, 0xa1, 0xa4, 0xa4, 0xa5, 0xa6, 0xa6, 0xa4, 0xa4, 0xa5, 0xa4, 0xa6, 0xa5, 0xa6, 0xa4, 0xa5, 0xa1, 0xa4, 0xa0, 0x9e, 0x9e, 0x9c, 0x9c, 0x9e, 0x9c, 0x9b, 0x99, 0x97, 0x99, 0xa4, 0xa8, 0xa1, 0x94, 0x76, 0x8a, 0x7c, 0x03, 0x04, 0x24, 0x29, 0x31, 0x33, 0x40, 0x6d, 0x6d, 0xa6, 0x76, 0x8e, 0x96, 0xb6, 0x2d, 0x32, 0x3c, 0x05, 0x5b, 0x24, 0x23, 0x23, 0x07, 0x0d, 0x14, 0x12, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x13, 0x14, 0x12, 0x19, 0x51, 0x0e, 0x51, 0x51, 0x51, 0x51, 0x51, 0x0e, 0x14, 0x14, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0e, 0x0f, 0x0d, 0x11, 0x57, 0x55, 0x57, 0x57, 0x1e, 0x55, 0x48, 0x42, 0x48, 0x45, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x48, 0x48, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x45, 0x48, 0x48, 0x4b, 0x48, 0x48, 0x48, 0x4b, 0x45, 0x4b, 0x54, 0x1a, 0x1a, 0x1f, 0x20, 0x02, 0xf6, 0xf5, 0xf6, 0xf6, 0x70, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x21, 0x21, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x21, 0x59, 0x47, 0x49, 0x55, 0x45, 0x29, 0x5d, 0xab, 0xe9, 0xf6, 0xa5, 0xa1, 0x4f, 0x46, 0x2b, 0x5b, 0x24, 0x27, 0x01, 0x6e, 0x73, 0x8c, 0x90, 0xad, 0xaa, 0xa6, 0xaa, 0xb1, 0xb4, 0xc3, 0xbb, 0xbf, 0xcd, 0xc5, 0xca, 0xcd, 0xce, 0xcd, 0xc5, 0xc5, 0xc5, 0xca, 0xc5, 0xca, 0xc5, 0xca, 0xc5, 0xcd, 0xc5, 0xca, 0xc5, 0xca, 0xc8, 0xca, 0xcd, 0xc3, 0xc3, 0xc3, 0xbb, 0xb7, 0xb7, 0xb4, 0xaa, 0xad, 0xa4, 0x76, 0x97, 0x8f, 0x7d, 0x7d, 0x04, 0x05, 0x2b, 0x33, 0x39, 0x53, 0x59, 0xd3, 0x98, 0x82, 0x86, 0xa7, 0x6c, 0x65, 0x05, 0x3e, 0x34, 0x62, 0x5b, 0x23, 0x23, 0x06, 0x4a, 0x10, 0x12, 0x13, 0x13, 0x18, 0x13, 0x13, 0x13, 0x12, 0x12, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x0e, 0x4d, 0x3f, 0x3f, 0x3f, 0x3a, 0x3f, 0x3f, 0x45, 0x48, 0x4d, 0x51, 0x51, 0x0e, 0x51, 0x0f, 0x0e, 0x10, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x4c, 0x0e, 0x4d, 0x0e, 0x4d, 0x51, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x14, 0x10, 0x1a, 0x1b, 0xfd, 0xfc, 0x4f, 0x55, 0x57, 0x4e, 0x42, 0x4b, 0x4a, 0x48, 0x4d, 0x48, 0x4d, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x4b, 0x45, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x42, 0x3d, 0x3f, 0x36, 0x09, 0x15, 0x20, 0x02, 0xf4, 0x70, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0xf6, 0x02, 0x70, 0x21, 0x21, 0x59, 0x0c, 0x52, 0x1b, 0x50, 0x53, 0x53, 0x6d, 0xf1, 0xf6, 0xfa, 0xa7, 0xb6, 0x53, 0x65, 0x24, 0x24, 0x5f, 0x6e, 0x6e, 0x85, 0x8a, 0x99, 0xa8, 0xbb, 0xc3, 0xc3, 0xbb, 0xbb, 0xb4, 0xb1, 0xb1, 0xac, 0xaa, 0xac, 0xaa, 0xaa, 0xa8, 0xaa, 0xa8, 0xaa, 0xa8, 0xa8, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa6, 0xa6, 0xa8, 0xa8, 0xaa, 0xad, 0xb1, 0xb1, 0xb1, 0xb7, 0xa6, 0x9c, 0x76, 0x8c, 0x5f, 0x27, 0x24, 0x2b, 0x31, 0x3b, 0x40, 0x58, 0x59, 0xe6, 0x95, 0x79, 0xa3, 0x78, 0x5a, 0x4f, 0x2d, 0x3e, 0x3e, 0x31, 0x5c, 0x5d, 0x6e, 0x24, 0x0b, 0x10, 0x13, 0x12, 0x12, 0x12, 0x12, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x51, 0x51, 0x3f, 0x3a, 0x3f, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3f, 0x48, 0x48, 0x4d, 0x51, 0x4c, 0x51, 0x4c, 0x51, 0x4c, 0x51, 0x4b, 0x4c, 0x51, 0x51, 0x4d, 0x4d, 0x51, 0x4d, 0x51, 0x51, 0x4c, 0x51, 0x4b, 0x4b, 0x51, 0x4d, 0x51, 0x51, 0x51, 0x10, 0x51, 0x10, 0x51, 0x51, 0x51, 0x51, 0x10, 0x10, 0x10, 0x4e, 0x11, 0x1b, 0x56, 0x4f, 0x4f, 0xae, 0x1d, 0x1d, 0x52, 0x44, 0x45, 0x4b, 0x4d, 0x48, 0x48, 0x48, 0x4b, 0x48, 0x4b, 0x4b, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x4a, 0x4a, 0x45, 0x4a, 0x45, 0x4a, 0x4a, 0x45, 0x0b, 0x45, 0x49, 0x42, 0x41, 0x42, 0x41, 0x41, 0x3d, 0x3d, 0x3b, 0x3d, 0x3b, 0x38, 0x3b, 0x38, 0x35, 0x35, 0x35, 0x30, 0x35, 0x30, 0x30, 0x30, 0x30, 0x2a, 0x2a, 0x2a, 0x2a, 0x25, 0x25, 0x25, 0x2a, 0x29, 0x36, 0x36, 0x50, 0x20, 0x21, 0x02, 0x70, 0x70, 0x70, 0x02, 0x21, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x02, 0xf6, 0x21, 0xff, 0x47, 0x57, 0x57, 0x1f, 0x20, 0x59, 0x20, 0xec, 0xec, 0xa9, 0xb2, 0x78, 0x6b, 0x66, 0x5b, 0x24, 0x6e, 0x5f, 0x23, 0x85, 0x93, 0x9e, 0xaa, 0xa4, 0x9c, 0x9b, 0x9b, 0x9b, 0x9c, 0x9c, 0x9e, 0x9e, 0x9e, 0x9d, 0x9e, 0x9d, 0x9e, 0x9d, 0x9e, 0xa0, 0xa0, 0xa0, 0xa0, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa1, 0xa4, 0xa4, 0xa1, 0xa1, 0xa0, 0xa1, 0x9e, 0xa0, 0x9e, 0xa5, 0xa5, 0x9e, 0x76, 0x8c, 0x7c, 0x27, 0x24, 0x2b, 0x2f, 0x39, 0x3b, 0x6d, 0x6d, 0xde, 0xa3, 0x83, 0x37, 0x6b, 0x70, 0xf6, 0x43, 0x46, 0x6a, 0x2c, 0x63, 0x5d, 0x5d, 0x05, 0x09, 0x16, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x13, 0x12, 0x12, 0x12, 0x0f, 0x13, 0x0f, 0x14, 0x51, 0x51, 0x3f, 0x3a, 0x3a, 0x3a, 0x30, 0x3a, 0x35, 0x3a, 0x3a, 0x42, 0x4b, 0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x0b, 0x45, 0x42, 0x45, 0x42, 0x45, 0x45, 0x42, 0x45, 0x42, 0x42, 0x3f, 0x42, 0x42, 0x42, 0x3f, 0x42, 0x3f, 0x42, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3d, 0x3f, 0x3d, 0x42, 0x42, 0x42, 0x42, 0x42, 0x4e, 0x1b, 0x15, 0xff, 0x1f, 0x56, 0x56, 0xfe, 0x58, 0xfd, 0x55, 0x52, 0x45, 0x45, 0x4b, 0x42, 0x42, 0x42, 0x3d, 0x3d, 0x3d, 0x36, 0x3b, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x2e, 0x36, 0x36, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x29, 0x2e, 0x29, 0x29, 0x5c, 0x29, 0x5c, 0x5c, 0x5e, 0x25, 0x25, 0x5e, 0x5e, 0x5e, 0x26, 0x5e, 0x26, 0x25, 0x25, 0x5e, 0x25, 0x5e, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x2a, 0x41, 0x44, 0x50, 0x20, 0x21, 0x02, 0x70, 0x70, 0x70, 0xf6, 0x21, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x70, 0x02, 0x70, 0x02, 0x21, 0xf6, 0x02, 0x02, 0x21, 0x21, 0x78, 0x47, 0x1f, 0x1f, 0x59, 0x1f, 0x5a, 0x5a, 0xf1, 0xdb, 0xa5, 0xb2, 0x6c, 0x6b, 0x27, 0x5d, 0x24, 0x5b, 0x5b, 0x73, 0x75, 0x94, 0x9a, 0xad, 0xa9, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb4, 0xb1, 0xb4, 0xb7, 0xb7, 0xbb, 0xbb, 0xc3, 0xb7, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0xbb, 0xbb, 0xbb, 0xb7, 0xb4, 0xbb, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xad, 0xa1, 0x97, 0x96, 0x5f, 0x27, 0x28, 0x2b, 0x33, 0x35, 0x40, 0x58, 0x53, 0xa7, 0xab, 0xa3, 0x56, 0xef, 0x5a, 0x6c, 0x4f, 0x4f, 0x47, 0x31, 0x2c, 0x62, 0x24, 0x24, 0x09, 0x10, 0x4c, 0x0f, 0x0e, 0x0e, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0d, 0x4c, 0x49, 0x4a, 0x42, 0x3d, 0x3a, 0x3d, 0x38, 0x38, 0x3b, 0x41, 0x3b, 0x3d, 0x3d, 0x3d, 0x36, 0x36, 0x36, 0x36, 0x36, 0x2e, 0x2e, 0x2e, 0x2b, 0x29, 0x29, 0x2c, 0x2c, 0x2a, 0x2c, 0x2a, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x29, 0x25, 0x25, 0x25, 0x25, 0x25, 0x5e, 0x5c, 0x29, 0x50, 0x55, 0x0c, 0xfd, 0x78, 0x56, 0x78, 0xbb, 0xb2, 0x53, 0x55, 0x47, 0x38, 0x3b, 0x35, 0x25, 0x25, 0x25, 0x29, 0x25, 0x5d, 0x25, 0x28, 0x5c, 0x29, 0x5c, 0x5d, 0x5c, 0x5d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5d, 0x5c, 0x5d, 0x5d, 0x5b, 0x5d, 0x66, 0x67, 0x68, 0x46, 0x46, 0x46, 0x46, 0x0a, 0x69, 0x34, 0x2b, 0x5d, 0x5c, 0x5e, 0x26, 0x2a, 0x60, 0x60, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x2a, 0x26, 0x60, 0x26, 0x60, 0x26, 0x26, 0x26, 0x26, 0x25, 0x2c, 0x52, 0x52, 0x57, 0x20, 0x21, 0xf6, 0x70, 0x70, 0x70, 0x02, 0x21, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0x21, 0xf6, 0x21, 0x02, 0x70, 0xf9, 0x21, 0xfe, 0x34, 0x55, 0x1f, 0x1f, 0x5a, 0x20, 0xec, 0xe5, 0xb2, 0xa5, 0x78, 0xe6, 0x46, 0x5b, 0x66, 0x5b, 0x5f, 0x6e, 0x5f, 0x87, 0x76, 0xa1, 0xaa, 0xac, 0xac, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xac, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa5, 0xa6, 0xa5, 0xa6, 0xa6, 0xa8, 0xaa, 0xa8, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xa8, 0xa8, 0xaa, 0xa4, 0x76, 0x96, 0x5f, 0x27, 0x28, 0x2b, 0x33, 0x35, 0x3b, 0x55, 0x6b, 0xfa, 0xd3, 0xe6, 0xe8, 0xe6, 0x59, 0xb2, 0x37, 0x6b, 0x47, 0x33, 0x64, 0x63, 0x29, 0x24, 0x09, 0x16, 0x0d, 0x10, 0x10, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b, 0x44, 0x09, 0x09, 0x08, 0x08, 0x36, 0x07, 0x2e, 0x2e, 0x2e, 0x2c, 0x2c, 0x2c, 0x2c, 0x31, 0x2c, 0x2b, 0x29, 0x28, 0x2d, 0x3c, 0x43, 0x4f, 0x4f, 0x53, 0x4f, 0x46, 0x3e, 0x32, 0x2b, 0x5d, 0x5c, 0x5c, 0x63, 0x5e, 0x61, 0x26, 0x61, 0x26, 0x25, 0x25, 0x25, 0x25, 0x61, 0x61, 0x61, 0x25, 0x61, 0x25, 0x61, 0x60, 0x5e, 0x61, 0x25, 0x5c, 0x31, 0x55, 0x1d, 0x0a, 0xfc, 0xfc, 0x78, 0x6b, 0xb2, 0x6b, 0xfa, 0x52, 0x47, 0x3b, 0x35, 0x2c, 0x64, 0x64, 0x64, 0x63, 0x63, 0x29, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x66, 0x5d, 0x5b, 0x5b, 0x6f, 0x68, 0xac, 0x56, 0xde, 0x6c, 0x6c, 0xe6, 0xe6, 0xe3, 0xe8, 0x6d, 0xd3, 0x6b, 0x46, 0x34, 0x5c, 0x5e, 0x5e, 0x5e, 0x60, 0x60, 0x60, 0x60, 0x60, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x26, 0x60, 0x61, 0x60, 0x26, 0x25, 0x30, 0x52, 0x1f, 0x59, 0x20, 0x21, 0x02, 0x70, 0x70, 0x70, 0xf6, 0x21, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x70, 0x21, 0x02, 0x56, 0x2c, 0x41, 0x1f, 0x55, 0x4f, 0xbf, 0x78, 0x78, 0xa7, 0xb2, 0x6d, 0x58, 0x32, 0x5d, 0x5d, 0x5b, 0x27, 0x5f, 0x73, 0x8a, 0x98, 0xa4, 0xa8, 0xa6, 0xa4, 0xa8, 0xa8, 0xaa, 0xaa, 0xad, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa6, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa4, 0xa5, 0xa5, 0xa6, 0xa5, 0xa5, 0xa4, 0xa8, 0xa6, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x9e, 0x93, 0x5f, 0x27, 0x28, 0x2b, 0x33, 0x35, 0x3b, 0x58, 0x58, 0x56, 0x59, 0xf1, 0x21, 0x5a, 0x5a, 0x46, 0x3e, 0x55, 0x47, 0x2f, 0x2c, 0x2c, 0x29, 0x28, 0x08, 0x49, 0x44, 0x44, 0x09, 0x09, 0x08, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x2b, 0x28, 0x28, 0x28, 0x5d, 0x5b, 0x6e, 0x5d, 0x32, 0x46, 0x56, 0x6c, 0xd3, 0x6c, 0xe6, 0x6c, 0x6c, 0x6c, 0xde, 0x6d, 0x6b, 0x46, 0x67, 0x62, 0x5c, 0x5c, 0x64, 0x61, 0x60, 0x60, 0x61, 0x64, 0x64, 0x29, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x61, 0x5c, 0x31, 0x47, 0x6b, 0x50, 0x0a, 0x0a, 0xfc, 0xfe, 0xb6, 0xb6, 0x78, 0x4f, 0x4f, 0x1b, 0x52, 0x47, 0x39, 0x64, 0x64, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5d, 0x62, 0x62, 0x5b, 0x66, 0xa5, 0x56, 0xe0, 0x6c, 0xe4, 0xe3, 0xe0, 0xe0, 0xe4, 0xdc, 0xdc, 0xe0, 0xe4, 0xe6, 0xe6, 0x6d, 0x6d, 0x53, 0x31, 0x5e, 0x5e, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x26, 0x25, 0x41, 0x55, 0x20, 0x20, 0x21, 0xf6, 0x70, 0x70, 0x70, 0x02, 0x21, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0x21, 0xf6, 0x21, 0x02, 0x70, 0x02, 0x02, 0x58, 0x2b, 0x2f, 0x52, 0x57, 0xfd, 0x78, 0xb6, 0xb6, 0x6b, 0xef, 0xe8, 0x69, 0x5c, 0x62, 0x5b, 0x24, 0x5b, 0x5f, 0x5f, 0x85, 0x96, 0xa4, 0xb1, 0xb1, 0xad, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0xac, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4, 0xbb, 0xb7, 0xc3, 0xbb, 0xc3, 0xc3, 0xbb, 0xb7, 0xb4, 0xb1, 0xa8, 0xaa, 0xa8, 0xa8, 0xa6, 0xa6, 0xa6, 0xa4, 0xaa, 0xaa, 0xa4, 0x9e, 0x9e, 0x93, 0x5f, 0x27, 0x24, 0x2b, 0x2f, 0x33, 0x38, 0x3c, 0x1f, 0x58, 0x56, 0x20, 0xf2, 0x59, 0x6b, 0x3e, 0x4f, 0x55, 0x39, 0x35, 0x2f, 0x31, 0x29, 0x28, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x2d, 0x05, 0x05, 0x83, 0x05, 0xfb, 0x83, 0xfb, 0x66, 0xfb, 0x24, 0x27, 0x24, 0x22, 0x24, 0x37, 0xae, 0xe8, 0xe6, 0xde, 0xd4, 0xe0, 0xd4, 0xd6, 0xdb, 0xdb, 0xdb, 0xde, 0xd3, 0x6c, 0x6d, 0x6c, 0x53, 0x68, 0x62, 0x5c, 0x61, 0x61, 0x60, 0x26, 0x2a, 0x25, 0x25, 0x25, 0x61, 0x64, 0x61, 0x25, 0x61, 0x61, 0x2a, 0x64, 0x25, 0x5c, 0x47, 0x57, 0x1d, 0x1d, 0xfd, 0x15, 0xfd, 0xfe, 0xfd, 0xb6, 0xfd, 0x1d, 0x1d, 0x58, 0x1f, 0x59, 0x3e, 0x64, 0x64, 0x64, 0x29, 0x29, 0x28, 0x28, 0x28, 0x2b, 0x28, 0x28, 0x28, 0x28, 0x28, 0x62, 0x66, 0x5b, 0x23, 0x69, 0xd3, 0xe3, 0xe3, 0xe5, 0xe5, 0xe1, 0xd1, 0xd4, 0xe0, 0xd6, 0xd6, 0xd8, 0xd6, 0xdc, 0xd6, 0xd6, 0xe3, 0xde, 0x6d, 0x6d, 0x6a, 0x5d, 0x5c, 0x5e, 0x60, 0x60, 0x60, 0x60, 0x60, 0x26, 0x60, 0x26, 0x60, 0x60, 0x60, 0x60, 0x60, 0x2a, 0x2a, 0x5e, 0x5c, 0x40, 0x59, 0x21, 0x21, 0xf6, 0x70, 0x70, 0x70, 0x02, 0x21, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x70, 0x02, 0x02, 0x02, 0x6d, 0x31, 0x2a, 0x2f, 0x55, 0x59, 0x6d, 0x58, 0x6d, 0x6d, 0x5a, 0x40, 0x5c, 0x5c, 0x5d, 0x5c, 0x27, 0x24, 0x22, 0x73, 0x8f, 0x77, 0x9c, 0xa1, 0x99, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa0, 0xa0, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa0, 0xa0, 0xa0, 0xa4, 0xa4, 0xa4, 0xa6, 0xa5, 0xa4, 0xa4, 0xa1, 0xa4, 0xa5, 0xa8, 0xaa, 0xb1, 0xb1, 0xb4, 0xbb, 0xbb, 0xb4, 0xb4, 0xbb, 0xb1, 0xaa, 0x9e, 0xa1, 0xa5, 0x8f, 0x7d, 0x24, 0x24, 0x2c, 0x2f, 0x35, 0x35, 0x33, 0x3c, 0x55, 0x1f, 0x6d, 0x59, 0x58, 0x53, 0x47, 0x52, 0x3c, 0x30, 0x30, 0x30, 0x2c, 0x28, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x83, 0x2d, 0x75, 0x83, 0xfb, 0x65, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xfb, 0xfb, 0x65, 0x81, 0x01, 0xfb, 0xfa, 0xec, 0xe8, 0xde, 0xd3, 0xd4, 0xdc, 0xd6, 0xd6, 0xdc, 0xd6, 0xd1, 0xd4, 0xdb, 0xdb, 0xdb, 0xd3, 0xde, 0xe6, 0x6d, 0x53, 0x34, 0x5c, 0x61, 0x61, 0x2a, 0x25, 0x2a, 0x25, 0x64, 0x64, 0x25, 0x64, 0x64, 0x26, 0x64, 0x25, 0x64, 0x5c, 0x3c, 0x57, 0xff, 0x1d, 0x1f, 0x1d, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0x20, 0xff, 0xfe, 0x78, 0x1f, 0x53, 0x25, 0x64, 0x64, 0x29, 0x29, 0x28, 0x28, 0x28, 0x28, 0x62, 0x28, 0x28, 0x28, 0x28, 0x66, 0x22, 0x32, 0x6b, 0xe6, 0x6c, 0xde, 0xe1, 0xd1, 0xd1, 0xd1, 0xe1, 0xe1, 0xd1, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xdc, 0xdb, 0xe0, 0xde, 0x6c, 0x5a, 0x6b, 0x66, 0x5e, 0x5e, 0x60, 0x60, 0x60, 0x60, 0x2a, 0x60, 0x26, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x60, 0x64, 0x5e, 0x3c, 0x59, 0x21, 0x21, 0xf6, 0x70, 0x70, 0x70, 0x02, 0x21, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x70, 0x02, 0x02, 0x59, 0x33, 0x64, 0x26, 0x33, 0x55, 0x6d, 0x6d, 0x6d, 0x6b, 0x31, 0x5c, 0x5c, 0x5c, 0x5c, 0x5d, 0x24, 0x03, 0x5f, 0x27, 0x8c, 0x98, 0xa1, 0xb1, 0xca, 0xca, 0xce, 0xca, 0xca, 0xca, 0xca, 0xc5, 0xca, 0xc6, 0xc5, 0xc3, 0xc3, 0xbb, 0xbb, 0xb7, 0xb4, 0xb1, 0xad, 0xaa, 0xa8, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa4, 0xa5, 0xa4, 0x9e, 0xa0, 0x9e, 0x9e, 0x9c, 0x9e, 0x9e, 0x9e, 0x9e, 0xac, 0xac, 0xa4, 0x77, 0x98, 0x5f, 0x04, 0x5d, 0x28, 0x2c, 0x2f, 0x35, 0x30, 0x2f, 0x2f, 0x40, 0x52, 0x52, 0x55, 0x47, 0x40, 0x2f, 0x30, 0x30, 0x35, 0x2f, 0x31, 0x28, 0x27, 0x2d, 0x83, 0xfb, 0x83, 0x65, 0x83, 0x83, 0x80, 0x83, 0x74, 0x65, 0x65, 0x75, 0x73, 0x7f, 0x82, 0x81, 0x74, 0x74, 0x65, 0x73, 0x01, 0x93, 0xd3, 0xec, 0xe1, 0xd3, 0xdb, 0xd1, 0xdc, 0xd1, 0xd1, 0xdf, 0xd1, 0xdc, 0xd1, 0xdb, 0xdb, 0xdb, 0xcd, 0xce, 0xd4, 0xd4, 0xdc, 0x6c, 0xe8, 0x68, 0x5c, 0x5e, 0x61, 0x61, 0x26, 0x61, 0x25, 0x64, 0x64, 0x61, 0x64, 0x61, 0x61, 0x26, 0x64, 0x5c, 0x47, 0x58, 0x1d, 0x1d, 0x1d, 0x1d, 0xab, 0xb6, 0x56, 0xb6, 0xfd, 0xff, 0xfd, 0xb7, 0xb4, 0xc8, 0x6c, 0x6b, 0x39, 0x64, 0x5e, 0x63, 0x62, 0x28, 0x66, 0x66, 0x5d, 0x66, 0x62, 0x66, 0x24, 0x62, 0x6e, 0x69, 0xd3, 0xe5, 0xde, 0xd1, 0xdc, 0xd1, 0xdc, 0xdc, 0xdc, 0xce, 0xce, 0xd6, 0xd6, 0xd3, 0xd4, 0xd4, 0xdb, 0xdc, 0xe0, 0xd1, 0xe1, 0xe0, 0xdb, 0xe4, 0x6c, 0xd6, 0x31, 0x5e, 0x61, 0x61, 0x2a, 0x60, 0x60, 0x2a, 0x26, 0x2a, 0x26, 0x60, 0x60, 0x60, 0x60, 0x2a, 0x5e, 0x5e, 0x3e, 0x59, 0x21, 0xf6, 0xf6, 0x70, 0x70, 0x02, 0x02, 0x21, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x21, 0x02, 0x70, 0x70, 0x02, 0x02, 0x5a, 0x34, 0x2a, 0x2a, 0x2a, 0x25, 0x33, 0x39, 0x64, 0x5e, 0x5e, 0x5e, 0x5c, 0x5e, 0x5d, 0x29, 0x24, 0x24, 0x03, 0x73, 0x8f, 0x76, 0x9e, 0xa8, 0xa9, 0xa8, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa8, 0xaa, 0xaa, 0xad, 0xac, 0xad, 0xac, 0xb1, 0xb1, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb1, 0xb4, 0xb4, 0xb4, 0xb1, 0xb4, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb1, 0xa6, 0xa5, 0xa4, 0x95, 0x7b, 0x24, 0x24, 0x5d, 0x2c, 0x2f, 0x33, 0x35, 0x30, 0x30, 0x2f, 0x2c, 0x2f, 0x2c, 0x2f, 0x2f, 0x30, 0x35, 0x35, 0x30, 0x2f, 0x2b, 0x24, 0xfb, 0x81, 0x81, 0x81, 0x65, 0x81, 0x81, 0x81, 0x81, 0x81, 0x65, 0x80, 0x74, 0x74, 0x65, 0x82, 0x74, 0x83, 0x82, 0xfb, 0x74, 0x5f, 0x9f, 0xe3, 0xdb, 0xe6, 0xd1, 0xdb, 0xdc, 0xd1, 0xcd, 0xd1, 0xdf, 0xca, 0xd1, 0xce, 0xd1, 0xd1, 0xcd, 0xcd, 0xdf, 0xdc, 0xd6, 0xd6, 0xd6, 0xdc, 0x6c, 0x6d, 0x69, 0x63, 0x5e, 0x61, 0x61, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x61, 0x61, 0x25, 0x40, 0x1d, 0xfe, 0x1d, 0xff, 0x15, 0xa9, 0xbb, 0xc5, 0xfd, 0xfd, 0xfd, 0xae, 0xbf, 0xbb, 0xce, 0x6d, 0x55, 0x61, 0x61, 0x5e, 0x62, 0x62, 0x66, 0x62, 0x5d, 0x32, 0x5d, 0x62, 0x62, 0x24, 0x5b, 0x69, 0xd6, 0xe5, 0xce, 0xce, 0xe1, 0xce, 0xd1, 0xd1, 0xd6, 0xce, 0xd6, 0xce, 0xce, 0xde, 0xd3, 0x6c, 0xde, 0xe1, 0xdb, 0xdb, 0xcd, 0xe0, 0xe1, 0xdc, 0xe0, 0xe4, 0x6c, 0x6b, 0x63, 0x5c, 0x64, 0x5e, 0x2a, 0x26, 0x26, 0x2a, 0x26, 0x26, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x3e, 0x5a, 0x21, 0xf6, 0xf6, 0x02, 0x70, 0x70, 0x02, 0x21, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x21, 0x02, 0x70, 0x02, 0xf6, 0x21, 0x21, 0x39, 0x2a, 0x2a, 0x2a, 0x26, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5c, 0x5c, 0x5d, 0x24, 0x24, 0x5f, 0x5f, 0x93, 0x9a, 0x9e, 0xa4, 0xa0, 0x9d, 0xa0, 0x9e, 0xa0, 0x9e, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9e, 0x9e, 0x9e, 0x9e, 0x9c, 0x9e, 0x9e, 0xa0, 0x9e, 0xa4, 0xa0, 0xa4, 0xa5, 0xa5, 0xa5, 0xa6, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa6, 0xa1, 0xa5, 0xa5, 0x8c, 0x5f, 0x5f, 0x24, 0x5d, 0x29, 0x31, 0x2f, 0x38, 0x38, 0x38, 0x30, 0x35, 0x35, 0x38, 0x35, 0x38, 0x38, 0x35, 0x35, 0x35, 0x2c, 0x27, 0x27, 0x74, 0x82, 0x80, 0x80, 0x82, 0x74, 0x81, 0x81, 0x81, 0x82, 0x74, 0x65, 0x65, 0x74, 0x83, 0x81, 0x7f, 0x81, 0x83, 0x5f, 0x81, 0xa3, 0xde, 0xe6, 0xe6, 0xcd, 0xdc, 0xd1, 0xd1, 0xd6, 0xd6, 0xd0, 0xc5, 0xd0, 0xce, 0xd6, 0xd6, 0xdc, 0xd4, 0xdc, 0xd1, 0xd6, 0xd1, 0xdc, 0xd6, 0xdc, 0xd4, 0xdc, 0x6d, 0x46, 0x62, 0x5e, 0x61, 0x5e, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x64, 0x61, 0x5c, 0x3c, 0x53, 0xfc, 0xfd, 0x1d, 0xfc, 0xab, 0xca, 0xce, 0xfe, 0xfd, 0xfd, 0xfd, 0xbb, 0xc5, 0xc5, 0x6b, 0x39, 0x61, 0x61, 0x63, 0x63, 0x66, 0x62, 0x27, 0x66, 0x5d, 0x62, 0x62, 0x27, 0x5b, 0x69, 0xe3, 0xd6, 0xd6, 0xd4, 0xd6, 0xd6, 0xce, 0xdc, 0xce, 0xcd, 0xd6, 0xe0, 0xea, 0xea, 0xf2, 0xf9, 0xf4, 0xf4, 0xf9, 0xf1, 0xf1, 0xeb, 0xe1, 0xd4, 0xd6, 0xe0, 0xe4, 0xe3, 0xe8, 0x53, 0x63, 0x63, 0x61, 0x2a, 0x60, 0x2a, 0x26, 0x2a, 0x2a, 0x26, 0x2a, 0x60, 0x2a, 0x60, 0x61, 0x5e, 0x40, 0x5a, 0x02, 0xf6, 0xf6, 0x70, 0x02, 0x70, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x02, 0x02, 0x70, 0x02, 0xf6, 0x21, 0x02, 0x3c, 0x61, 0x2a, 0x2a, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x5e, 0x5c, 0x29, 0x5d, 0x28, 0x24, 0x24, 0x5b, 0x74, 0x8c, 0x9a, 0x9e, 0xac, 0xb4, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xac, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa4, 0xa4, 0xa1, 0xa5, 0xa3, 0x8f, 0x72, 0x27, 0x24, 0x24, 0x28, 0x29, 0x31, 0x35, 0x38, 0x38, 0x38, 0x38, 0x35, 0x38, 0x38, 0x38, 0x35, 0x30, 0x33, 0x2c, 0x2b, 0x27, 0x65, 0x80, 0x82, 0x82, 0x80, 0x82, 0x65, 0x81, 0x81, 0x81, 0x81, 0x65, 0x80, 0x65, 0x74, 0x65, 0x83, 0x83, 0x83, 0x73, 0x74, 0xa3, 0xe8, 0xe1, 0xdb, 0xdb, 0xdb, 0xd1, 0xd6, 0xce, 0xce, 0xce, 0xd4, 0xd6, 0xe5, 0xea, 0xea, 0xef, 0xee, 0xf0, 0xef, 0xea, 0xe6, 0xe1, 0xdb, 0xdb, 0xdb, 0xdb, 0xd4, 0xe3, 0xd3, 0x6a, 0x5d, 0x64, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x61, 0x60, 0x61, 0x29, 0x3c, 0xfd, 0x46, 0x0a, 0xfe, 0xfc, 0xf7, 0xd6, 0xd1, 0xff, 0xfd, 0xfd, 0xfd, 0xc8, 0xc5, 0xc5, 0x53, 0x31, 0x25, 0x64, 0x63, 0x28, 0x28, 0x66, 0x66, 0x66, 0x5d, 0x66, 0x66, 0x5b, 0x68, 0xd3, 0xe0, 0xcd, 0xce, 0xd4, 0xd4, 0xd4, 0xdb, 0xcd, 0xdb, 0xe5, 0xee, 0xf2, 0x70, 0x02, 0x02, 0x02, 0x21, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xe9, 0xe5, 0xdb, 0xd6, 0x6c, 0x6c, 0xe6, 0x6a, 0x62, 0x61, 0x64, 0x60, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x60, 0x60, 0x2a, 0x60, 0x26, 0x5e, 0x40, 0x5a, 0x02, 0xf6, 0xf6, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0x70, 0x02, 0xf5, 0xf6, 0x02, 0x40, 0x26, 0x2a, 0x2a, 0x60, 0x60, 0x60, 0x5e, 0x61, 0x5e, 0x5c, 0x5c, 0x5c, 0x28, 0x24, 0x24, 0x24, 0x5f, 0x5f, 0x8f, 0x76, 0x9a, 0xa6, 0xa6, 0xa8, 0xa6, 0xa6, 0xa6, 0xa8, 0xa8, 0xa8, 0xa8, 0xad, 0xac, 0xac, 0xad, 0xb1, 0xb1, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbb, 0xb7, 0xbb, 0xb7, 0xb4, 0xbb, 0xb4, 0xbb, 0xb4, 0xbb, 0xb7, 0xb7, 0xb4, 0xb7, 0xb7, 0xb7, 0xbb, 0xa8, 0xa1, 0xa1, 0x93, 0x5f, 0x5f, 0x5f, 0x24, 0x24, 0x28, 0x2c, 0x30, 0x30, 0x35, 0x38, 0x38, 0x3d, 0x3a, 0x38, 0x38, 0x35, 0x30, 0x31, 0x29, 0x04, 0x66, 0x65, 0x83, 0x82, 0x82, 0x80, 0x80, 0x81, 0x81, 0x83, 0x81, 0x83, 0x80, 0x65, 0xfb, 0x83, 0x83, 0x83, 0x81, 0x7f, 0x73, 0xa3, 0xe6, 0xe3, 0xde, 0xd4, 0xe1, 0xd6, 0xca, 0xce, 0xce, 0xce, 0xdb, 0xea, 0xf4, 0xf6, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf1, 0x5a, 0xe5, 0xde, 0xd1, 0xe1, 0xd3, 0xde, 0x56, 0x67, 0x5c, 0x64, 0x61, 0x61, 0x25, 0x61, 0x25, 0x61, 0x61, 0x64, 0x25, 0x5c, 0x3e, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xd1, 0xdc, 0xd7, 0xd1, 0xfd, 0xfc, 0xfd, 0xf7, 0xd1, 0x78, 0x6b, 0x40, 0x64, 0x2c, 0x29, 0x28, 0x28, 0x05, 0x66, 0x24, 0x66, 0x5d, 0x5b, 0x37, 0x78, 0xe3, 0xc8, 0xe0, 0xdb, 0xd1, 0xd4, 0xdb, 0xc8, 0xde, 0xe8, 0xf6, 0x02, 0x02, 0x21, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x70, 0xe9, 0xe3, 0xdc, 0xe1, 0x6c, 0x6d, 0x34, 0x5e, 0x5e, 0x26, 0x60, 0x2a, 0x2a, 0x26, 0x2a, 0x2a, 0x60, 0x2a, 0x60, 0x61, 0x5e, 0x6a, 0xf2, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x70, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x47, 0x60, 0x2a, 0x26, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x5e, 0x62, 0x5d, 0x28, 0x24, 0x24, 0x24, 0x5b, 0x5b, 0x5f, 0x91, 0x77, 0xa0, 0xa4, 0xa0, 0x9c, 0x9d, 0x9e, 0x9e, 0xa0, 0xa0, 0xa1, 0xa0, 0x9c, 0x9c, 0x9c, 0x9e, 0x9c, 0x9e, 0x9c, 0x99, 0x99, 0x9b, 0x9c, 0x9c, 0x9e, 0x9e, 0xa0, 0xa1, 0xa0, 0xa1, 0xa4, 0xa4, 0xa5, 0xa4, 0xa5, 0xa5, 0xa6, 0xa6, 0xa6, 0xa8, 0xa8, 0xa9, 0xaa, 0xa4, 0xa1, 0xa1, 0x68, 0x72, 0x5f, 0x27, 0x24, 0x24, 0x28, 0x2b, 0x2f, 0x30, 0x30, 0x35, 0x38, 0x35, 0x35, 0x35, 0x30, 0x30, 0x2c, 0x29, 0x2d, 0x65, 0x2d, 0x65, 0x83, 0x82, 0x80, 0x80, 0x65, 0x74, 0x65, 0x83, 0x83, 0x81, 0x80, 0x80, 0x81, 0x75, 0x81, 0x83, 0x7d, 0x7d, 0x9a, 0xe9, 0xd6, 0xe0, 0xce, 0xdf, 0xca, 0xd6, 0xd6, 0xce, 0xd4, 0xe6, 0xf5, 0x02, 0x21, 0x21, 0x21, 0x21, 0x02, 0xf9, 0x70, 0xf6, 0xf2, 0xf6, 0x02, 0x02, 0x70, 0xe8, 0xe3, 0xf7, 0xe9, 0xd1, 0x6c, 0x6b, 0x5d, 0x63, 0x63, 0x61, 0x63, 0x64, 0x63, 0x64, 0x63, 0x5e, 0x63, 0x28, 0x6a, 0xff, 0x56, 0xff, 0xff, 0xf8, 0xd7, 0xd7, 0xd7, 0xd1, 0xf7, 0xf7, 0xf7, 0xf8, 0xd7, 0xf7, 0x56, 0x4f, 0x33, 0x64, 0x29, 0x28, 0x66, 0x27, 0x66, 0x27, 0x66, 0x66, 0x27, 0xb2, 0xe3, 0xd1, 0xe1, 0xd1, 0xce, 0xdb, 0xd4, 0xd4, 0xd3, 0xf5, 0xf6, 0x02, 0xf6, 0xf9, 0xf9, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0x21, 0x21, 0x02, 0x21, 0xf9, 0xf9, 0xf6, 0x02, 0xf1, 0xe1, 0xe4, 0xdc, 0xe3, 0x53, 0x63, 0x61, 0x61, 0x60, 0x60, 0x2a, 0x26, 0x2a, 0x60, 0x60, 0x2a, 0x60, 0x26, 0x5e, 0x6a, 0xf2, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x70, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0x02, 0xf6, 0xf5, 0xf6, 0x02, 0x53, 0x25, 0x2a, 0x60, 0x60, 0x60, 0x5e, 0x61, 0x5e, 0x5c, 0x5c, 0x5d, 0x5d, 0x24, 0x24, 0x24, 0x24, 0x5b, 0x73, 0x8c, 0x99, 0x9a, 0xa8, 0xb1, 0xbb, 0xb7, 0xb4, 0xb4, 0xb4, 0xb7, 0xb4, 0xb7, 0xbb, 0xbb, 0xb4, 0xb4, 0xb1, 0xb1, 0xad, 0xb1, 0xad, 0xac, 0xaa, 0xaa, 0xa8, 0xa8, 0xa6, 0xa6, 0xa5, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0x9e, 0x9e, 0x9e, 0x9c, 0x9c, 0x99, 0x76, 0x9e, 0xa5, 0xa5, 0x8f, 0x5f, 0x5f, 0x5f, 0x27, 0x27, 0x24, 0x28, 0x2f, 0x2c, 0x2f, 0x30, 0x30, 0x35, 0x2f, 0x2f, 0x2f, 0x31, 0x2c, 0x28, 0x04, 0x83, 0x27, 0x83, 0xfb, 0x80, 0x81, 0x82, 0x74, 0x83, 0x83, 0x83, 0x83, 0x82, 0x74, 0x82, 0xfb, 0x83, 0x7f, 0x83, 0x7e, 0x8a, 0xea, 0xe3, 0xe0, 0xd6, 0xdc, 0xce, 0xdf, 0xcd, 0xcd, 0xe3, 0xf5, 0x02, 0x02, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x02, 0x02, 0xf6, 0x02, 0x70, 0x70, 0x70, 0x70, 0x02, 0xe9, 0xd1, 0xdb, 0xd3, 0xde, 0x46, 0x5c, 0x63, 0x63, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x5b, 0x46, 0xe6, 0xe6, 0xf8, 0xf8, 0xdc, 0xd7, 0xdd, 0xc7, 0xd7, 0xf8, 0xd1, 0xd7, 0xf8, 0xf8, 0xd7, 0xe1, 0x6b, 0x34, 0x2b, 0x28, 0x2b, 0x66, 0x27, 0x27, 0x66, 0x66, 0x5b, 0x46, 0xe3, 0xd4, 0xdb, 0xd1, 0xd6, 0xdc, 0xce, 0xc5, 0xe1, 0xf6, 0xf6, 0x70, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf5, 0xe1, 0xe0, 0xe3, 0x6d, 0x6a, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x61, 0x64, 0x2a, 0x5e, 0x64, 0x5c, 0x6a, 0xf9, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x21, 0x21, 0x58, 0x31, 0x5e, 0x64, 0x60, 0x5e, 0x5e, 0x5e, 0x5e, 0x5c, 0x5c, 0x5c, 0x62, 0x5d, 0x5d, 0x24, 0x24, 0x5f, 0x5f, 0x96, 0x9e, 0x9c, 0x96, 0x99, 0x9b, 0x9b, 0x9b, 0x9c, 0x9d, 0x9e, 0x9e, 0x9e, 0x9e, 0xa0, 0xa1, 0xa4, 0xa5, 0xa6, 0xa6, 0xa8, 0xa6, 0xa8, 0xaa, 0xaa, 0xaa, 0xac, 0xac, 0xad, 0xac, 0xad, 0xac, 0xb1, 0xad, 0xb1, 0xb1, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb1, 0xb4, 0xbb, 0xb1, 0xa7, 0xa1, 0x95, 0x5f, 0x5f, 0x27, 0x27, 0x5f, 0x27, 0x24, 0x29, 0x2c, 0x31, 0x31, 0x31, 0x2f, 0x31, 0x2e, 0x2b, 0x28, 0x27, 0xfb, 0xfb, 0x83, 0x83, 0xfb, 0x81, 0x81, 0x74, 0x81, 0x74, 0x81, 0xfb, 0x81, 0xfb, 0x81, 0x81, 0x81, 0x74, 0x81, 0x75, 0x7c, 0x84, 0xcd, 0xe5, 0xdc, 0xd6, 0xdb, 0xe0, 0xdc, 0xce, 0xcd, 0xec, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf6, 0xf6, 0xee, 0xcd, 0xdb, 0xd3, 0xe0, 0x6f, 0x5e, 0x5e, 0x63, 0x5e, 0x63, 0x62, 0x62, 0x62, 0x27, 0x65, 0x8a, 0xae, 0xf7, 0xe1, 0xf8, 0xd7, 0xc7, 0xd7, 0xd7, 0xc7, 0xd7, 0xf8, 0xf8, 0xd7, 0xd7, 0xd3, 0xe1, 0xb2, 0x28, 0x66, 0x24, 0x66, 0x65, 0x27, 0x65, 0x5f, 0x74, 0x93, 0xdb, 0xe0, 0xdb, 0xd4, 0xd1, 0xe0, 0xd4, 0xc8, 0xe3, 0xf4, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf5, 0xeb, 0xd3, 0xe3, 0x53, 0x37, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5d, 0x32, 0x6d, 0x02, 0x02, 0x21, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x21, 0xf2, 0x21, 0x21, 0xf2, 0x40, 0x5c, 0x63, 0x5e, 0x5e, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5f, 0x88, 0x96, 0x9c, 0x9a, 0x9b, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x76, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9e, 0x9e, 0xa1, 0xa0, 0xa1, 0x9e, 0xa0, 0xa1, 0xa4, 0xa6, 0xa6, 0xa8, 0xaa, 0xaa, 0xaa, 0xa8, 0xa7, 0xa4, 0x95, 0x7c, 0x27, 0x7d, 0x27, 0x5f, 0x27, 0x24, 0x24, 0x62, 0x28, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x28, 0x27, 0x04, 0xfb, 0x81, 0x81, 0x81, 0x83, 0x81, 0x83, 0x81, 0x83, 0x81, 0x83, 0x81, 0x83, 0x81, 0x83, 0x81, 0x83, 0x83, 0x81, 0x7f, 0x81, 0xaa, 0xe1, 0xe0, 0xe0, 0xdc, 0xdc, 0xdb, 0xcd, 0xdb, 0xeb, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf5, 0xf6, 0xec, 0xdb, 0xd4, 0xe3, 0xa7, 0x5c, 0x63, 0x63, 0x62, 0x63, 0x62, 0x66, 0x66, 0x65, 0x75, 0x82, 0x86, 0x86, 0xf7, 0xe2, 0xc7, 0xd2, 0xc7, 0xd7, 0xc7, 0xd7, 0xd7, 0xc7, 0xd7, 0xad, 0xa6, 0xb6, 0xae, 0x27, 0x27, 0x66, 0x65, 0x27, 0x27, 0x65, 0x65, 0x5f, 0xbf, 0x6c, 0xd4, 0xce, 0xdb, 0xd4, 0xd4, 0xcd, 0xe3, 0xef, 0x02, 0x02, 0x02, 0x70, 0x02, 0x21, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf1, 0xe6, 0x6c, 0xbf, 0x66, 0x00, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x00, 0x5b, 0x22, 0x22, 0xfa, 0x21, 0x02, 0x21, 0x02, 0xf6, 0x02, 0xf6, 0x70, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf6, 0xf6, 0xf5, 0x21, 0x02, 0x56, 0x40, 0x68, 0x34, 0x32, 0x2b, 0x32, 0x66, 0x32, 0x6f, 0x67, 0x37, 0x37, 0x95, 0x98, 0x9a, 0x9f, 0xa6, 0xaa, 0xa8, 0xaa, 0xa8, 0xa8, 0xa6, 0xa5, 0xa6, 0xa4, 0xa4, 0xa0, 0xa0, 0xa0, 0xa0, 0x9e, 0x9e, 0x9e, 0x9c, 0x9c, 0x9b, 0x9c, 0x9b, 0x9b, 0x9b, 0x99, 0x9b, 0x99, 0x9c, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9e, 0x9e, 0x9e, 0x9e, 0x9c, 0x9b, 0x9b, 0x99, 0x99, 0x97, 0x76, 0x9e, 0xa5, 0xa5, 0x76, 0x01, 0x7c, 0x5f, 0x72, 0x5f, 0x5f, 0x5f, 0x5b, 0x5b, 0x5b, 0x5b, 0x24, 0x5b, 0x5b, 0x24, 0x5f, 0x5f, 0x74, 0x7f, 0x7f, 0x80, 0x7e, 0x73, 0x7e, 0x73, 0x7e, 0x73, 0x7f, 0x7f, 0x74, 0x7f, 0x74, 0x7f, 0x74, 0x7f, 0x82, 0x5f, 0x7e, 0x9c, 0xe1, 0xe1, 0xdc, 0xdc, 0xdc, 0xdb, 0xd4, 0xd3, 0xe5, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf5, 0x02, 0xf5, 0xe9, 0xdb, 0xd4, 0xd3, 0x66, 0x62, 0x62, 0x66, 0x62, 0x66, 0x66, 0x32, 0x75, 0x65, 0x84, 0x81, 0x7e, 0xa6, 0xf8, 0xc7, 0xd7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc6, 0x9b, 0x84, 0x99, 0x95, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x75, 0x5f, 0xa1, 0xe9, 0xe1, 0xd4, 0xdb, 0xd6, 0xd4, 0xd4, 0xdb, 0xef, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf5, 0xef, 0xe3, 0xde, 0x37, 0x6e, 0x6e, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5f, 0x5b, 0x5b, 0x5f, 0x5b, 0x22, 0x46, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x70, 0x02, 0x02, 0xf6, 0xf5, 0xf3, 0xe6, 0xde, 0x6c, 0x6c, 0x6d, 0x78, 0x78, 0xbf, 0x78, 0xb6, 0xbf, 0x78, 0xbf, 0xc5, 0xcd, 0xc8, 0xcd, 0xcd, 0xd4, 0xcd, 0xcd, 0xca, 0xc8, 0xca, 0xca, 0xc6, 0xca, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc3, 0xc3, 0xc3, 0xc3, 0xbb, 0xbb, 0xbb, 0xbb, 0xb4, 0xb4, 0xb4, 0xb1, 0xb1, 0xad, 0xad, 0xaa, 0xaa, 0xa8, 0xaa, 0xa8, 0xa8, 0xa8, 0xa6, 0xa6, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa6, 0xa5, 0xa8, 0xaa, 0xa1, 0x8f, 0x8f, 0x8a, 0x8a, 0x75, 0x6f, 0x75, 0x83, 0x74, 0x74, 0x5f, 0xfb, 0x27, 0x27, 0x7f, 0x27, 0x74, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x74, 0x7e, 0x7c, 0x84, 0xb2, 0xe1, 0xe0, 0xe1, 0xdc, 0xdb, 0xd4, 0xdb, 0xe5, 0xf5, 0x02, 0xf4, 0xf6, 0xf6, 0xf4, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf5, 0xf6, 0xf5, 0xe8, 0xc8, 0xe5, 0x46, 0x5b, 0x65, 0x66, 0x65, 0x32, 0x85, 0x65, 0x87, 0x85, 0x85, 0x86, 0x82, 0x97, 0xe2, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xd7, 0xd7, 0xb5, 0x86, 0x80, 0x84, 0x81, 0x6f, 0x65, 0x75, 0x74, 0x75, 0x75, 0x73, 0x85, 0xe3, 0xe0, 0xd4, 0xdb, 0xdc, 0xe0, 0xcd, 0xdb, 0xe9, 0xf5, 0x02, 0xf6, 0x70, 0x02, 0x02, 0x21, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf4, 0xef, 0xeb, 0xac, 0x82, 0x65, 0x82, 0x84, 0x85, 0x84, 0x85, 0x86, 0x75, 0x87, 0x85, 0x75, 0x85, 0xb2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x70, 0x02, 0x02, 0xf5, 0xe5, 0xb1, 0xb2, 0xa9, 0xb6, 0xbf, 0xac, 0xb4, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0xc5, 0xca, 0xc5, 0xc3, 0xc6, 0xc5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xca, 0xc6, 0xc6, 0xc6, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xca, 0xc6, 0xca, 0xc6, 0xc6, 0xc6, 0xce, 0xca, 0xce, 0xca, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xca, 0xc6, 0xc6, 0xc6, 0xc6, 0xc3, 0xc5, 0xc5, 0xc3, 0xc5, 0xc5, 0xbb, 0xc5, 0xbf, 0xbf, 0xb4, 0xb2, 0xb2, 0xb1, 0xb2, 0xad, 0xac, 0xac, 0xac, 0xab, 0xaa, 0xae, 0xac, 0xac, 0xaa, 0xac, 0xaa, 0xad, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xac, 0xaa, 0xac, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xac, 0xb1, 0xe1, 0xe0, 0xd4, 0xdc, 0xdb, 0xdb, 0xd4, 0xe1, 0xf9, 0xf6, 0xf2, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xe3, 0xd3, 0xd3, 0x81, 0x75, 0x85, 0x75, 0x85, 0x75, 0x75, 0x85, 0x75, 0x86, 0x82, 0x80, 0x86, 0xf8, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xd7, 0xda, 0xa6, 0x82, 0x84, 0x84, 0x84, 0x75, 0x75, 0x85, 0x74, 0x85, 0x82, 0x72, 0xae, 0xea, 0xd4, 0xd4, 0xe0, 0xdb, 0xdc, 0xc8, 0xe5, 0xf3, 0x02, 0xf5, 0x70, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x21, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x70, 0xf4, 0xf2, 0xf0, 0xe5, 0x76, 0x86, 0x88, 0x89, 0x88, 0x8b, 0x88, 0x8b, 0x86, 0x8d, 0x85, 0x89, 0x85, 0xae, 0xf5, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0x70, 0x70, 0x02, 0xf3, 0xe1, 0xb1, 0xa9, 0xad, 0xa9, 0xa9, 0xa9, 0xb1, 0xad, 0xb1, 0xb4, 0xb7, 0xb1, 0xb7, 0xb7, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xbb, 0xc3, 0xc3, 0xc3, 0xc3, 0xbb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc6, 0xc3, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc3, 0xc3, 0xc6, 0xc6, 0xca, 0xc6, 0xca, 0xca, 0xc5, 0xca, 0xc8, 0xc6, 0xc8, 0xca, 0xc8, 0xca, 0xc8, 0xcd, 0xcd, 0xcd, 0xca, 0xca, 0xca, 0xc6, 0xc6, 0xc3, 0xc6, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xca, 0xc8, 0xca, 0xcd, 0xca, 0xcd, 0xca, 0xc5, 0xca, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xd4, 0xcd, 0xdc, 0xe0, 0xdb, 0xe1, 0xdb, 0xd4, 0xde, 0xef, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf5, 0xf6, 0x02, 0xf2, 0xd4, 0xe3, 0xa1, 0x82, 0x85, 0x86, 0x85, 0x84, 0x89, 0x82, 0x82, 0x85, 0x86, 0x84, 0x80, 0xaf, 0xd7, 0xc7, 0xc7, 0xc7, 0xc7, 0xd7, 0xd7, 0xc1, 0x8e, 0x80, 0x86, 0x84, 0x85, 0x84, 0x84, 0x87, 0x84, 0x85, 0x7e, 0x90, 0xe9, 0xcd, 0xe0, 0xdb, 0xe1, 0xd1, 0xdb, 0xdb, 0xee, 0xf6, 0xf6, 0xf4, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0x70, 0xf4, 0x70, 0xf0, 0xf3, 0xb1, 0x8b, 0x86, 0x8b, 0x8b, 0x86, 0x8b, 0x8b, 0x8b, 0x8b, 0x88, 0x89, 0x82, 0xfa, 0xf5, 0xf6, 0xf6, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xe5, 0xce, 0xc5, 0xd1, 0xd1, 0xca, 0xe4, 0xc6, 0xca, 0xcd, 0xca, 0xce, 0xce, 0xca, 0xcd, 0xce, 0xce, 0xce, 0xd0, 0xca, 0xca, 0xd0, 0xce, 0xca, 0xca, 0xce, 0xce, 0xca, 0xca, 0xca, 0xca, 0xd0, 0xca, 0xca, 0xca, 0xca, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xca, 0xbb, 0xc6, 0xc6, 0xc3, 0xc3, 0xca, 0xc3, 0xc5, 0xc6, 0xc5, 0xc5, 0xc3, 0xc3, 0xc3, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xca, 0xc6, 0xca, 0xc6, 0xca, 0xc5, 0xc6, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc5, 0xc6, 0xc5, 0xc3, 0xc3, 0xc3, 0xc3, 0xc5, 0xbb, 0xdc, 0xdb, 0xe1, 0xdc, 0xdb, 0xe1, 0xd3, 0xe6, 0xf6, 0x02, 0xf2, 0x02, 0xf6, 0x02, 0x02, 0xf4, 0xf6, 0x02, 0x02, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf4, 0x02, 0xf6, 0xf6, 0xef, 0xd1, 0xc3, 0x80, 0x84, 0x84, 0x84, 0x84, 0x84, 0x88, 0x88, 0x84, 0x82, 0x88, 0x7e, 0x92, 0xe2, 0xd7, 0xd7, 0xc7, 0xc7, 0xc7, 0xd8, 0xa6, 0x82, 0x86, 0x84, 0x88, 0x84, 0x86, 0x84, 0x86, 0x84, 0x84, 0x7e, 0xb1, 0xe5, 0xdb, 0xd4, 0xdb, 0xe1, 0xdb, 0xcd, 0xe9, 0xf5, 0x02, 0xf6, 0xf6, 0x02, 0xf4, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf2, 0x70, 0x02, 0x70, 0xf3, 0xf3, 0xea, 0x8e, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x86, 0x8b, 0x8e, 0x86, 0x86, 0xa6, 0xec, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0x70, 0x70, 0xe6, 0xcd, 0xce, 0xd6, 0xd1, 0xd6, 0xd1, 0xd6, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xd6, 0xce, 0xce, 0xd6, 0xce, 0xce, 0xcd, 0xce, 0xd6, 0xce, 0xce, 0xcd, 0xd0, 0xca, 0xca, 0xca, 0xca, 0xd0, 0xca, 0xca, 0xca, 0xc6, 0xca, 0xca, 0xca, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xca, 0xc6, 0xc3, 0xc6, 0xc6, 0xce, 0xc6, 0xc6, 0xc3, 0xc6, 0xc3, 0xc6, 0xc5, 0xc6, 0xc3, 0xc6, 0xc6, 0xc3, 0xc6, 0xc3, 0xc6, 0xc3, 0xc3, 0xbb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc6, 0xc3, 0xc6, 0xc3, 0xc3, 0xc3, 0xc6, 0xc3, 0xc6, 0xc6, 0xc6, 0xc6, 0xc5, 0xc6, 0xc5, 0xdc, 0xdc, 0xd4, 0xe1, 0xd4, 0xd3, 0xe8, 0xf6, 0x02, 0xf6, 0x02, 0xf4, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf4, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0xf4, 0xf6, 0xf9, 0xf6, 0xf4, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xcd, 0xe4, 0x97, 0x82, 0x84, 0x86, 0x86, 0x84, 0x84, 0x84, 0x84, 0x86, 0x84, 0x86, 0x82, 0x9d, 0xcb, 0xf8, 0xc7, 0xf8, 0xd7, 0xad, 0x82, 0x84, 0x88, 0x84, 0x8a, 0x84, 0x88, 0x82, 0x86, 0x84, 0x80, 0x99, 0xe1, 0xce, 0xe0, 0xd4, 0xdb, 0xdb, 0xd1, 0xde, 0xf5, 0x70, 0xf5, 0xf4, 0xf6, 0xf6, 0x21, 0x02, 0x02, 0x02, 0xf6, 0xf4, 0xf2, 0xf2, 0xef, 0xf1, 0x5a, 0xef, 0xf2, 0xf9, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x70, 0x02, 0xf4, 0xf3, 0xf6, 0xa9, 0x80, 0x88, 0x8b, 0x8b, 0x89, 0x8b, 0x88, 0x8b, 0x86, 0x88, 0x88, 0x98, 0xe9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf5, 0x70, 0xea, 0xc5, 0xce, 0xce, 0xd6, 0xce, 0xd0, 0xd6, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd6, 0xce, 0xce, 0xd6, 0xd6, 0xce, 0xce, 0xce, 0xce, 0xca, 0xd1, 0xce, 0xd6, 0xd1, 0xd6, 0xd1, 0xd0, 0xd1, 0xce, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xca, 0xca, 0xce, 0xd1, 0xce, 0xca, 0xca, 0xca, 0xca, 0xce, 0xca, 0xc6, 0xc6, 0xca, 0xd1, 0xce, 0xcd, 0xd1, 0xcd, 0xd1, 0xca, 0xd1, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xce, 0xca, 0xce, 0xca, 0xca, 0xdc, 0xe0, 0xdb, 0xe0, 0xdb, 0xde, 0xec, 0xf6, 0xf6, 0xf4, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf4, 0xf6, 0xf9, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf9, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xea, 0xe4, 0xaa, 0x82, 0x84, 0x86, 0x82, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x86, 0x80, 0x84, 0x9b, 0xa9, 0xb1, 0xf7, 0xa9, 0x86, 0x82, 0x89, 0x89, 0x75, 0x88, 0x87, 0x86, 0x84, 0x86, 0x84, 0x82, 0xa8, 0xe1, 0xd4, 0xe0, 0xdb, 0xdb, 0xdb, 0xd3, 0xe6, 0xf6, 0xf5, 0x70, 0xf6, 0xf6, 0xf6, 0x21, 0x02, 0x02, 0xf6, 0xf9, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf2, 0xf2, 0xef, 0x5a, 0xf2, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0xf6, 0xf1, 0xf5, 0xd4, 0x82, 0x8e, 0x88, 0x89, 0x89, 0x88, 0x8b, 0x89, 0x88, 0x89, 0x88, 0x76, 0xe3, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xe6, 0xcd, 0xce, 0xce, 0xce, 0xd6, 0xce, 0xce, 0xce, 0xd4, 0xcd, 0xd4, 0xcd, 0xce, 0xd4, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xca, 0xd6, 0xca, 0xce, 0xd4, 0xca, 0xce, 0xce, 0xd4, 0xd6, 0xdb, 0xd6, 0xdb, 0xd6, 0xdc, 0xdc, 0xdc, 0xdb, 0xdc, 0xd6, 0xd6, 0xdc, 0xd6, 0xd6, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xd6, 0xdc, 0xd6, 0xd1, 0xd4, 0xd1, 0xd6, 0xd4, 0xdc, 0xd4, 0xd1, 0xce, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xd1, 0xd1, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xd1, 0xcd, 0xd4, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xe0, 0xe0, 0xdb, 0xdb, 0xdb, 0xe6, 0xf5, 0x02, 0xf6, 0xf9, 0xf6, 0x02, 0xf6, 0x02, 0xf4, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xf4, 0xf4, 0xf9, 0xf9, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf2, 0xe4, 0xca, 0x8b, 0x84, 0x86, 0x84, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x89, 0x82, 0x84, 0x84, 0x86, 0x8b, 0x82, 0x84, 0x88, 0x89, 0x85, 0x85, 0x88, 0x8a, 0x84, 0x88, 0x84, 0x84, 0x8c, 0xca, 0xe3, 0xdb, 0xe0, 0xde, 0xe0, 0xd3, 0xe0, 0xf1, 0xf6, 0xf4, 0xf6, 0xf4, 0x21, 0xf6, 0x21, 0x02, 0x21, 0xf9, 0xf9, 0xf9, 0xf4, 0xf6, 0xf4, 0xf4, 0xf6, 0xf6, 0xf2, 0xf2, 0xef, 0x5a, 0xf2, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x21, 0x21, 0x02, 0xf6, 0xf9, 0xf1, 0xf5, 0x91, 0x8c, 0x86, 0x8c, 0x88, 0x89, 0x89, 0x8b, 0x89, 0x89, 0x88, 0x98, 0xe3, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xea, 0xc8, 0xce, 0xcd, 0xce, 0xce, 0xd6, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xd1, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xd1, 0xd4, 0xce, 0xcd, 0xcd, 0xe0, 0xcd, 0xd4, 0xdb, 0xd4, 0xdb, 0xd4, 0xd4, 0xdb, 0xd4, 0xdb, 0xd6, 0xd4, 0xd4, 0xd4, 0xe0, 0xdb, 0xdb, 0xd4, 0xdb, 0xd4, 0xd4, 0xdc, 0xce, 0xd1, 0xd4, 0xdc, 0xdb, 0xd6, 0xdb, 0xd1, 0xcd, 0xd1, 0xce, 0xd4, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd4, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xcd, 0xce, 0xcd, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xdc, 0xe0, 0xdb, 0xdb, 0xde, 0xf2, 0xf6, 0x02, 0xf6, 0xf4, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf4, 0x02, 0xf4, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0xf9, 0xf6, 0xf9, 0xf4, 0xf4, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf0, 0xe5, 0xe0, 0x9c, 0x80, 0x8b, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x86, 0x87, 0x75, 0x84, 0x84, 0x84, 0x86, 0x84, 0x88, 0x89, 0x85, 0x86, 0x8a, 0x87, 0x85, 0x88, 0x84, 0x86, 0x82, 0x9e, 0xe1, 0xe0, 0xe0, 0xdb, 0xe0, 0xe0, 0xd3, 0xe3, 0xf6, 0xf6, 0x70, 0xf6, 0xf6, 0xf4, 0x21, 0x21, 0xf6, 0x21, 0xf4, 0xf6, 0xf6, 0xf6, 0x70, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xef, 0xf2, 0xf2, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x21, 0x21, 0x02, 0x02, 0xf4, 0xf1, 0x02, 0xa6, 0x75, 0x89, 0x89, 0x89, 0x89, 0x88, 0x8b, 0x89, 0x8c, 0x88, 0x76, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x21, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xe9, 0xcd, 0xcd, 0xce, 0xce, 0xd4, 0xce, 0xd1, 0xce, 0xd1, 0xd1, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd6, 0xcd, 0xce, 0xce, 0xcd, 0xe0, 0xe0, 0xea, 0xe9, 0xe3, 0xe1, 0xe9, 0xeb, 0xe9, 0xe9, 0xe9, 0xe6, 0xe5, 0xe6, 0xe5, 0xe5, 0xdb, 0xdb, 0xdb, 0xdb, 0xe1, 0xdb, 0xe0, 0xd4, 0xdb, 0xdc, 0xdb, 0xdc, 0xcd, 0xca, 0xc8, 0xce, 0xd4, 0xcd, 0xcd, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xd4, 0xce, 0xd4, 0xce, 0xd4, 0xd1, 0xd4, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xce, 0xd4, 0xdb, 0xdb, 0xdb, 0xdb, 0xe6, 0xf6, 0xf6, 0xf4, 0xf6, 0x02, 0xf6, 0x70, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf9, 0xf6, 0xf9, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf9, 0xf9, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf0, 0xed, 0xe1, 0xa6, 0x82, 0x88, 0x86, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x86, 0x87, 0x85, 0x86, 0x87, 0x88, 0x86, 0x86, 0x86, 0x86, 0x86, 0x88, 0x89, 0x84, 0x87, 0x86, 0x86, 0x86, 0x84, 0xaa, 0xe4, 0xdb, 0xe0, 0xd4, 0xe0, 0xdb, 0xdb, 0xe9, 0xf6, 0x70, 0x02, 0xf4, 0x70, 0x21, 0xf6, 0x21, 0xf9, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0xf4, 0xf6, 0xf9, 0xf4, 0xf9, 0xf4, 0xf6, 0xf6, 0xf9, 0xf1, 0xf1, 0xf2, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x02, 0x02, 0x02, 0xf4, 0xf1, 0xf4, 0xcd, 0x82, 0x8c, 0x89, 0x8c, 0x8b, 0x88, 0x8b, 0x8b, 0x8e, 0x89, 0x98, 0xe6, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0xf6, 0xf6, 0xea, 0xcd, 0xd1, 0xcd, 0xd4, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xd4, 0xd4, 0xcd, 0xd4, 0xc8, 0xe1, 0xc5, 0x76, 0x8f, 0x8c, 0x87, 0x8a, 0x94, 0x96, 0x94, 0x98, 0x99, 0x9a, 0xa1, 0xa7, 0xaa, 0xae, 0xbf, 0xbf, 0xbf, 0xcd, 0xd3, 0xdb, 0xdb, 0xdb, 0xe5, 0xe9, 0xe5, 0xe3, 0xe5, 0xe9, 0xe5, 0xe5, 0xe3, 0xe4, 0xdb, 0xce, 0xc8, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xd4, 0xcd, 0xd1, 0xca, 0xce, 0xcd, 0xce, 0xce, 0xca, 0xce, 0xca, 0xce, 0xca, 0xce, 0xca, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xdc, 0xdb, 0xdb, 0xde, 0xde, 0xf1, 0x02, 0xf6, 0xf6, 0xf4, 0xf6, 0xf6, 0xf4, 0xf6, 0x21, 0xf4, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x70, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf4, 0xf6, 0x02, 0x21, 0xf6, 0xf9, 0xf2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf5, 0xef, 0xe1, 0xb1, 0x85, 0x84, 0x86, 0x87, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x89, 0x88, 0x84, 0x84, 0x84, 0x8e, 0x89, 0x89, 0x88, 0x86, 0x84, 0x86, 0x87, 0x88, 0x86, 0x82, 0x90, 0xc3, 0xe3, 0xd4, 0xe1, 0xdb, 0xdb, 0xdb, 0xe3, 0xf1, 0xf5, 0xf6, 0x02, 0x02, 0xf9, 0xf6, 0xf9, 0x21, 0xf4, 0x21, 0xf6, 0x02, 0x02, 0xf6, 0x70, 0x02, 0xf6, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0x02, 0xf9, 0xef, 0xf2, 0xf9, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x70, 0xf1, 0xf0, 0xee, 0x8e, 0x88, 0x8e, 0x8b, 0x8b, 0x8b, 0x8e, 0x8b, 0x8d, 0x89, 0x9a, 0xe5, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf6, 0xf5, 0xec, 0xd1, 0xcd, 0xd1, 0xd4, 0xd1, 0xd4, 0xd1, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xd4, 0xd4, 0xca, 0xe3, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x79, 0x7f, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x80, 0x7f, 0x82, 0x98, 0xa6, 0xa7, 0x99, 0x98, 0xa5, 0xbf, 0xdb, 0xd4, 0xca, 0xce, 0xca, 0xce, 0xca, 0xce, 0xcd, 0xce, 0xd4, 0xd1, 0xd4, 0xd4, 0xd4, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xd4, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xcd, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xe0, 0xdb, 0xe1, 0xdb, 0xe3, 0xf6, 0xf6, 0x02, 0x02, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0xf9, 0xf2, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf0, 0xe5, 0xbb, 0x8e, 0x82, 0x8b, 0x87, 0x86, 0x87, 0x87, 0x87, 0x86, 0x88, 0x88, 0x86, 0x86, 0x89, 0x89, 0x86, 0x86, 0x86, 0x88, 0x88, 0x86, 0x89, 0x8c, 0x84, 0x86, 0x89, 0x80, 0x9c, 0xd4, 0xe1, 0xdb, 0xe1, 0xdb, 0xe1, 0xdb, 0xe6, 0xf5, 0xf5, 0x70, 0x70, 0x02, 0xf9, 0x21, 0x21, 0x21, 0x21, 0x21, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf4, 0xf6, 0x02, 0xf4, 0xf2, 0xec, 0xf1, 0xf5, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf4, 0xf2, 0xf1, 0xf6, 0x9e, 0x84, 0x92, 0x86, 0x8e, 0x8b, 0x92, 0x8b, 0x8d, 0x8b, 0x9a, 0xe6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf5, 0x02, 0xee, 0xd4, 0xc8, 0xcd, 0xcd, 0xd4, 0xd4, 0xce, 0xce, 0xce, 0xd4, 0xce, 0xce, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xe3, 0xa5, 0x00, 0x00, 0x93, 0xec, 0xe8, 0xab, 0xd3, 0x9f, 0x00, 0x9a, 0xd3, 0x56, 0x75, 0xfa, 0xae, 0x7b, 0x8a, 0x56, 0xb2, 0x5f, 0x6f, 0x8f, 0x77, 0x8c, 0x00, 0x81, 0x81, 0xb6, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xdb, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xce, 0xca, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xe0, 0xe1, 0xdb, 0xe1, 0xec, 0x02, 0xf4, 0x02, 0x02, 0xf4, 0xf6, 0xf6, 0xf4, 0xf6, 0xf2, 0x02, 0xf4, 0xef, 0xe1, 0xbf, 0xac, 0xab, 0xac, 0xae, 0xbb, 0xe3, 0xef, 0x02, 0xee, 0x02, 0xf6, 0xf6, 0xf9, 0x02, 0xf2, 0xf2, 0x02, 0x02, 0x02, 0xf4, 0x02, 0xf5, 0xf3, 0xe3, 0xd1, 0x92, 0x86, 0x86, 0x88, 0x88, 0x87, 0x87, 0x86, 0x88, 0x86, 0x88, 0x88, 0x88, 0x86, 0x88, 0x88, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x88, 0x86, 0x86, 0x86, 0xa5, 0xe5, 0xe0, 0xdb, 0xd4, 0xe3, 0xdb, 0xde, 0xeb, 0xf5, 0xf6, 0x02, 0xf2, 0x02, 0xf4, 0xf4, 0xf9, 0x21, 0x21, 0xf9, 0x21, 0xf6, 0xeb, 0xe0, 0xcd, 0xc8, 0xcd, 0xe1, 0xeb, 0xf5, 0xf5, 0x02, 0xf5, 0xf6, 0xf5, 0xf2, 0xec, 0xf1, 0xf6, 0xf6, 0xf6, 0x70, 0xf4, 0x02, 0x02, 0xf6, 0xef, 0xf6, 0xac, 0x87, 0x89, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8c, 0x9c, 0xe8, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xef, 0xdb, 0xcd, 0xcd, 0xd4, 0xd4, 0xce, 0xd4, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd4, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xe3, 0xa5, 0x00, 0x00, 0xa3, 0x70, 0xd3, 0x00, 0xfa, 0xb2, 0x71, 0xb6, 0xe8, 0xb2, 0x8f, 0xe3, 0xe6, 0x8f, 0xd3, 0xbf, 0x93, 0x85, 0x70, 0xd3, 0xde, 0xd3, 0x72, 0x98, 0xf2, 0x5a, 0x95, 0x00, 0x6f, 0xa3, 0x6f, 0x00, 0xfa, 0xe0, 0xce, 0xce, 0xce, 0xca, 0xce, 0xca, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xcd, 0xd1, 0xcd, 0xd1, 0xcd, 0xd1, 0xcd, 0xd1, 0xcd, 0xd1, 0xcd, 0xd1, 0xcd, 0xce, 0xce, 0xce, 0xca, 0xce, 0xca, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xd4, 0xe0, 0xe0, 0xde, 0xe5, 0xf1, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf4, 0xf4, 0xf6, 0xf2, 0xdb, 0xa8, 0x9e, 0x9a, 0xa0, 0x9c, 0x9c, 0x9a, 0x9c, 0xa4, 0xa8, 0xe9, 0x02, 0xf3, 0xf4, 0xf2, 0xf4, 0x02, 0xf9, 0xf2, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf5, 0xf3, 0xe5, 0xdc, 0x9b, 0x84, 0x86, 0x88, 0x86, 0x88, 0x87, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x86, 0x87, 0xac, 0xe5, 0xdb, 0xe0, 0xd3, 0xe3, 0xdb, 0xde, 0xef, 0xf4, 0xf6, 0x02, 0xf2, 0xf6, 0x21, 0xf6, 0xf9, 0x21, 0xf9, 0x02, 0xeb, 0xb6, 0xa5, 0xa1, 0x99, 0x99, 0x99, 0x99, 0xa5, 0xb2, 0xe1, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf2, 0xeb, 0xf6, 0xf6, 0x02, 0xf6, 0x70, 0x02, 0x02, 0x70, 0xef, 0xf5, 0xb6, 0x89, 0x89, 0x8e, 0x8e, 0x8e, 0x8b, 0x8e, 0x90, 0x89, 0xa1, 0xeb, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x02, 0x70, 0xf6, 0xf1, 0xe0, 0xc8, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xcd, 0xe5, 0xa5, 0x00, 0x00, 0x7d, 0x93, 0x78, 0xb6, 0xb6, 0xa7, 0x00, 0xa7, 0xb6, 0x75, 0x00, 0x75, 0xa7, 0x9f, 0xe6, 0x93, 0x00, 0x7b, 0xe8, 0x78, 0xb6, 0xb2, 0x79, 0x75, 0xde, 0xd3, 0x01, 0x00, 0x8a, 0xde, 0xa3, 0x71, 0xa7, 0xe1, 0xcd, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xce, 0xca, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xdb, 0xe1, 0xdb, 0xdb, 0xeb, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0xf4, 0xf4, 0x02, 0xec, 0xb6, 0x9e, 0x76, 0xa4, 0x9e, 0x9e, 0xa0, 0xa1, 0xa0, 0xa0, 0x9e, 0x9e, 0xa8, 0xdb, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x70, 0xf9, 0xf9, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf3, 0xe5, 0xe4, 0xa4, 0x84, 0x86, 0x86, 0x87, 0x87, 0x87, 0x88, 0x86, 0x88, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x85, 0x8d, 0xc8, 0xe5, 0xdb, 0xdb, 0xdb, 0xe1, 0xdb, 0xe3, 0xf2, 0xf6, 0xf4, 0x70, 0x70, 0xf6, 0xf4, 0x02, 0xf2, 0x21, 0x02, 0xe3, 0xab, 0x9a, 0x99, 0x9c, 0xa0, 0x99, 0x9c, 0x9e, 0x96, 0x92, 0xa4, 0xb6, 0xf0, 0x02, 0xf5, 0xf2, 0xf6, 0xec, 0xf1, 0xf6, 0x02, 0x02, 0xf4, 0xf6, 0x02, 0xf4, 0xf1, 0xf1, 0xdb, 0x89, 0x8c, 0x8e, 0x8e, 0x8e, 0x8b, 0x8e, 0x92, 0x89, 0xa7, 0xf1, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xf3, 0xe3, 0xcd, 0xcd, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xcd, 0xce, 0xe3, 0xa5, 0x00, 0x00, 0x79, 0x74, 0x77, 0xae, 0xeb, 0xae, 0x79, 0xa3, 0xde, 0xd3, 0xb2, 0x01, 0x7d, 0xfa, 0xf6, 0x5a, 0xa3, 0x00, 0x98, 0xd3, 0xe6, 0xb6, 0x71, 0x00, 0xb6, 0xe3, 0x6f, 0x37, 0x00, 0x83, 0x7d, 0x71, 0xb6, 0xe1, 0xce, 0xce, 0xce, 0xca, 0xce, 0xca, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xdb, 0xe0, 0xdb, 0xe1, 0xf1, 0x02, 0xf5, 0x02, 0xf4, 0xf6, 0xf6, 0xf4, 0xf4, 0x02, 0xf4, 0xb2, 0xa4, 0x9e, 0xa0, 0xa0, 0xa0, 0x9c, 0x9d, 0x9c, 0x9c, 0x9c, 0x9d, 0x9e, 0x9a, 0xa5, 0xe9, 0xf3, 0xf6, 0xf6, 0x02, 0x02, 0xf9, 0xf9, 0xf9, 0xf6, 0x02, 0xf6, 0xf6, 0xf3, 0xe5, 0xe4, 0xa8, 0x84, 0x86, 0x88, 0x88, 0x87, 0x87, 0x86, 0x88, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x89, 0x84, 0x96, 0xe1, 0xe1, 0xdb, 0xe1, 0xde, 0xe0, 0xde, 0xe6, 0xf5, 0xf6, 0xf4, 0xf4, 0x02, 0xf9, 0xf6, 0xf6, 0xf6, 0x02, 0xeb, 0xa7, 0x98, 0x9c, 0xa0, 0x99, 0x99, 0x97, 0x97, 0x99, 0x9c, 0x99, 0x99, 0x96, 0xb2, 0xf3, 0xf6, 0xf1, 0xf6, 0xf4, 0xec, 0xf4, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf4, 0xf1, 0xeb, 0xe9, 0x92, 0x89, 0x8e, 0x8e, 0x8e, 0x8e, 0x90, 0x92, 0x8a, 0xb1, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf5, 0xe5, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xd1, 0xd1, 0xce, 0xcd, 0xe5, 0xa5, 0x00, 0x79, 0xa7, 0xe3, 0x9a, 0x00, 0xae, 0xdb, 0x81, 0x78, 0xf4, 0xf4, 0x02, 0x9f, 0x75, 0x83, 0xbf, 0x02, 0xe6, 0x8f, 0x22, 0xfa, 0xef, 0xbf, 0x8a, 0x00, 0x77, 0xe6, 0x83, 0xe6, 0x77, 0x00, 0x71, 0x00, 0xab, 0xdb, 0xcd, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xce, 0xca, 0xce, 0xce, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xcd, 0xe0, 0xe0, 0xdb, 0xe3, 0xf4, 0x02, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xdb, 0xa1, 0x76, 0x9e, 0x9d, 0x97, 0x9d, 0x97, 0x9b, 0x97, 0x97, 0x97, 0x9b, 0x9b, 0x9e, 0xa1, 0xa7, 0xec, 0x02, 0xf2, 0x02, 0x02, 0x02, 0xf9, 0xf9, 0xf6, 0x02, 0xf6, 0x02, 0xf3, 0xe9, 0xe4, 0xad, 0x86, 0x86, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x84, 0xa1, 0xe5, 0xdb, 0xdb, 0xdb, 0xe1, 0xde, 0xe0, 0xeb, 0xf6, 0xf6, 0xf6, 0xf4, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf5, 0xa7, 0x9a, 0x94, 0x9b, 0x9b, 0x9b, 0xa0, 0x9d, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0x9b, 0x92, 0xcd, 0xf6, 0xf6, 0xf5, 0x02, 0xf2, 0xf2, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0xf2, 0xeb, 0xee, 0x99, 0x88, 0x8e, 0x8e, 0x8e, 0x92, 0x8e, 0x8e, 0x96, 0xc8, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf5, 0xe9, 0xcd, 0xce, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xd6, 0xce, 0xce, 0xce, 0xd6, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xd1, 0xce, 0xd1, 0xcd, 0xe5, 0xa5, 0x00, 0x71, 0xa7, 0x02, 0xf2, 0x75, 0xb6, 0xde, 0x83, 0xc8, 0xde, 0x6f, 0x95, 0xd3, 0xe6, 0x81, 0x93, 0xde, 0x9f, 0x00, 0xae, 0xde, 0xae, 0xae, 0x78, 0x75, 0x00, 0x6c, 0x95, 0x6c, 0x5a, 0x9f, 0x72, 0x00, 0x9a, 0xf5, 0xca, 0xce, 0xce, 0xca, 0xce, 0xca, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xce, 0xce, 0xca, 0xce, 0xca, 0xce, 0xca, 0xce, 0xca, 0xce, 0xca, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xd4, 0xd4, 0xd4, 0xce, 0xe1, 0xe0, 0xe1, 0xe9, 0xf5, 0x02, 0xf9, 0xf6, 0x02, 0xf4, 0xf6, 0x02, 0xf6, 0xef, 0x77, 0x9c, 0x9e, 0x9d, 0x9b, 0x9d, 0x8e, 0x97, 0x97, 0x9b, 0x97, 0x9b, 0x97, 0x94, 0x99, 0xa1, 0x76, 0xd4, 0x02, 0xf4, 0xf6, 0xf6, 0x02, 0xf6, 0xf2, 0xf9, 0xf6, 0xf6, 0xf6, 0xf5, 0xef, 0xe4, 0xb1, 0x8b, 0x86, 0x88, 0x88, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x84, 0xaa, 0xe5, 0xd4, 0xe1, 0xdb, 0xe1, 0xde, 0xe3, 0xef, 0x02, 0xf5, 0xf6, 0xf6, 0x21, 0xf4, 0xf6, 0x02, 0x02, 0xc8, 0x94, 0x9c, 0xa0, 0x9e, 0x9b, 0x9b, 0x9b, 0x99, 0x97, 0x97, 0x9b, 0x9b, 0x97, 0x97, 0x89, 0xa0, 0xe5, 0xf6, 0xf4, 0xf6, 0xf9, 0xf2, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf1, 0xee, 0xeb, 0xa0, 0x86, 0x8e, 0x92, 0x8b, 0x94, 0x89, 0x8d, 0xa5, 0xe9, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf9, 0x02, 0xf6, 0x02, 0xf6, 0xe9, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xd0, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xce, 0xcd, 0xe5, 0xa5, 0x00, 0x00, 0x00, 0x8a, 0x9a, 0xab, 0xb4, 0x74, 0x00, 0xfa, 0xde, 0x93, 0x00, 0xe3, 0xeb, 0xa3, 0xab, 0xbf, 0x5f, 0x00, 0x02, 0xdb, 0x85, 0xac, 0x02, 0xc8, 0x00, 0xae, 0x93, 0x95, 0xef, 0xe3, 0x6f, 0x00, 0x98, 0xe0, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xd4, 0xcd, 0xe3, 0xe0, 0xe3, 0xee, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf4, 0xf9, 0x02, 0xf3, 0xcd, 0x9a, 0x97, 0x9c, 0x9d, 0x8e, 0x97, 0x97, 0x9d, 0x9c, 0x9d, 0x99, 0x97, 0x9b, 0x97, 0x99, 0x9c, 0x9c, 0xa5, 0xe6, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf2, 0xf9, 0xf6, 0xf6, 0xf6, 0xf5, 0xf3, 0xe5, 0xbb, 0x8e, 0x84, 0x88, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x88, 0x86, 0x88, 0x88, 0x88, 0x88, 0x84, 0xb4, 0xe5, 0xdb, 0xe1, 0xdb, 0xde, 0xe0, 0xe3, 0xf1, 0x02, 0xf6, 0x02, 0x02, 0xf9, 0xf9, 0xf6, 0x70, 0xef, 0xa4, 0x76, 0x99, 0x99, 0x9b, 0x9b, 0x99, 0x99, 0x9e, 0x9c, 0x76, 0x97, 0x97, 0x97, 0x9b, 0xa0, 0x88, 0xa9, 0xf6, 0xf5, 0xf9, 0x70, 0x5a, 0x21, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf4, 0xef, 0xe9, 0xa5, 0x86, 0x90, 0x92, 0x90, 0x97, 0x89, 0x94, 0xb6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf4, 0xe1, 0xd4, 0xce, 0xd1, 0xca, 0xca, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xca, 0xe0, 0xcd, 0xe4, 0xae, 0x80, 0x7f, 0x7c, 0x6e, 0x00, 0x00, 0x00, 0x71, 0x7a, 0x73, 0x82, 0x79, 0x00, 0x83, 0x9f, 0x7e, 0x8a, 0x72, 0x00, 0x7c, 0x81, 0x72, 0x00, 0x72, 0x9a, 0x75, 0x00, 0xa7, 0x8f, 0x00, 0x8a, 0x87, 0x00, 0x00, 0x9e, 0xe5, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd6, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xd4, 0xdb, 0xe0, 0xe0, 0xdb, 0xe1, 0xf2, 0xf6, 0x02, 0x21, 0x02, 0xf4, 0xf6, 0xf6, 0xf4, 0xf3, 0x77, 0x99, 0x9e, 0x9d, 0x9b, 0x9b, 0x9b, 0x9b, 0x76, 0x9c, 0x76, 0x76, 0x9b, 0x97, 0x97, 0x97, 0x96, 0x9e, 0x9a, 0xc8, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf2, 0xf9, 0x02, 0xf6, 0xf4, 0xf1, 0xea, 0xc6, 0x8e, 0x84, 0x89, 0x88, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x87, 0xd4, 0xe1, 0xdb, 0xe3, 0xd4, 0xe1, 0xdb, 0xe8, 0xf3, 0xf6, 0xf6, 0xf4, 0xf6, 0x21, 0xf6, 0x70, 0x02, 0xc5, 0x76, 0x9d, 0x97, 0x9d, 0x76, 0x99, 0x77, 0x76, 0x68, 0x76, 0x76, 0x98, 0x97, 0x99, 0x97, 0x97, 0x9b, 0x9c, 0xe1, 0x02, 0x02, 0xf9, 0xf6, 0xf2, 0xf6, 0x02, 0x02, 0xf6, 0xf6, 0xf4, 0xeb, 0xeb, 0xa5, 0x84, 0x90, 0x92, 0x92, 0x89, 0x8c, 0xab, 0xf1, 0x02, 0xf9, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf5, 0xe6, 0xe0, 0xd4, 0xd4, 0xce, 0xcd, 0xd4, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xd4, 0xce, 0xd4, 0xce, 0xd4, 0xd1, 0xd6, 0xcd, 0xd1, 0xc5, 0xdb, 0xe5, 0xc8, 0xbf, 0xbb, 0xb2, 0xaa, 0xa7, 0xa6, 0xfa, 0xa6, 0xa1, 0x9f, 0xa1, 0x9a, 0x98, 0x96, 0x77, 0x98, 0x96, 0x8f, 0x8a, 0x8f, 0x98, 0x97, 0x8f, 0x82, 0x75, 0x9a, 0xc8, 0x9f, 0x75, 0x75, 0x81, 0x80, 0x8c, 0xac, 0xe3, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xce, 0xce, 0xd4, 0xce, 0xdb, 0xdc, 0xdb, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe3, 0xf4, 0xf6, 0x02, 0x02, 0x21, 0x02, 0xf6, 0xf6, 0xf5, 0xd4, 0x99, 0x9c, 0x9d, 0x9b, 0x9b, 0x9b, 0x76, 0x76, 0x68, 0x68, 0x95, 0x69, 0x9c, 0x99, 0x9b, 0x97, 0x97, 0x9c, 0x99, 0xab, 0xf3, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf2, 0xf9, 0x02, 0xf6, 0xf6, 0xf0, 0xe9, 0xc6, 0x90, 0x88, 0x86, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x86, 0x88, 0x86, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x91, 0xe1, 0xe5, 0xd4, 0xe1, 0xe1, 0xe1, 0xde, 0xe9, 0xf4, 0xf6, 0x02, 0xf4, 0x21, 0xf6, 0x02, 0xf4, 0x70, 0xb1, 0x76, 0x9b, 0x9c, 0x9b, 0x98, 0x9a, 0x69, 0x68, 0x37, 0x67, 0x95, 0x68, 0x9a, 0x99, 0x97, 0x99, 0x92, 0x99, 0xb6, 0xf6, 0xf6, 0xf9, 0xf4, 0xf9, 0xf9, 0x02, 0x02, 0xf6, 0xf6, 0xec, 0xec, 0xeb, 0xa1, 0x87, 0x90, 0x8e, 0x8c, 0x9c, 0xb6, 0xee, 0x02, 0xf6, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xef, 0xe6, 0xe3, 0xe1, 0xdb, 0xdb, 0xe0, 0xe0, 0xdc, 0xdb, 0xdb, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xce, 0xd4, 0xd1, 0xcd, 0xce, 0xce, 0xce, 0xd4, 0xd4, 0xcd, 0xdb, 0xe1, 0xe3, 0xe3, 0xe3, 0xe3, 0xe5, 0xe5, 0xe5, 0xe3, 0xe5, 0xe5, 0xe5, 0xe3, 0xe3, 0xe3, 0xe5, 0xe1, 0xe3, 0xe3, 0xe0, 0xd4, 0xe0, 0xe1, 0xe3, 0xd4, 0xe3, 0xe1, 0xdb, 0xdb, 0xd3, 0xc5, 0xbf, 0xbf, 0xcd, 0xd4, 0xd6, 0xcd, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xce, 0xcd, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xd4, 0xce, 0xd4, 0xd6, 0xd4, 0xd6, 0xdb, 0xe0, 0xdc, 0xe0, 0xdc, 0xdb, 0xe1, 0xe0, 0xe1, 0xdb, 0xe0, 0xe0, 0xe0, 0xe5, 0xf5, 0x02, 0x02, 0xf9, 0x21, 0x02, 0xf6, 0xf6, 0xf6, 0xac, 0x92, 0xa0, 0x9b, 0x9b, 0x9b, 0x69, 0x76, 0x68, 0x67, 0x67, 0x67, 0x68, 0x76, 0x76, 0x97, 0x99, 0x96, 0x9c, 0x99, 0x9e, 0xe9, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0xf9, 0xf4, 0x02, 0xf6, 0x02, 0xf4, 0xf0, 0xce, 0x92, 0x86, 0x89, 0x87, 0x87, 0x87, 0x89, 0x89, 0x89, 0x86, 0x88, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x89, 0x89, 0x88, 0x84, 0xa1, 0xe1, 0xe3, 0xdb, 0xdb, 0xde, 0xe3, 0xdb, 0xeb, 0xf6, 0xf6, 0x70, 0xf4, 0x21, 0x02, 0x70, 0x02, 0xeb, 0xa6, 0x97, 0x99, 0x9e, 0x9a, 0x98, 0x69, 0x68, 0x34, 0x34, 0x34, 0x34, 0x95, 0x68, 0x98, 0x99, 0x9b, 0x92, 0x97, 0xa5, 0xf3, 0x02, 0x02, 0xf6, 0xf2, 0xf4, 0x02, 0x02, 0xf6, 0x21, 0xf1, 0xf2, 0xe1, 0x9f, 0x96, 0xa1, 0xa5, 0xb2, 0xe3, 0xf2, 0xf5, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x70, 0x02, 0xf6, 0xf2, 0xee, 0xe8, 0xe3, 0xe1, 0xdb, 0xe1, 0xe0, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe0, 0xe1, 0xe0, 0xe0, 0xdb, 0xe0, 0xdb, 0xe0, 0xe0, 0xd4, 0xe1, 0xe0, 0xcd, 0xd4, 0xdb, 0xdb, 0xdb, 0xdb, 0xd4, 0xdb, 0xdc, 0xe0, 0xd4, 0xd4, 0xd4, 0xe1, 0xe0, 0xd4, 0xd4, 0xe1, 0xdc, 0xd4, 0xe0, 0xe0, 0xd4, 0xe0, 0xdc, 0xd6, 0xdb, 0xdb, 0xcd, 0xe6, 0xdb, 0xe0, 0xe1, 0xe1, 0xe0, 0xd4, 0xcd, 0xd4, 0xce, 0xd4, 0xce, 0xd4, 0xce, 0xd4, 0xce, 0xd4, 0xce, 0xd4, 0xce, 0xd4, 0xce, 0xdb, 0xd4, 0xd4, 0xdb, 0xd4, 0xdb, 0xd4, 0xdb, 0xdc, 0xdb, 0xe0, 0xdb, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xdb, 0xe1, 0xe0, 0xe1, 0xe0, 0xe1, 0xe6, 0xf6, 0x02, 0x02, 0x21, 0xf9, 0x02, 0xf6, 0xf6, 0xf5, 0xa4, 0x99, 0x9d, 0x9b, 0x99, 0x77, 0x69, 0x68, 0x34, 0x39, 0x34, 0x39, 0x67, 0x68, 0x69, 0x99, 0x99, 0x97, 0x99, 0x9c, 0x98, 0xe1, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0xf9, 0x02, 0x02, 0xf6, 0xf0, 0xe9, 0xce, 0x94, 0x88, 0x88, 0x87, 0x87, 0x8a, 0x88, 0x87, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0xac, 0xe3, 0xe0, 0xe3, 0xe3, 0xdb, 0xe1, 0xde, 0xef, 0xf6, 0x02, 0xf6, 0x70, 0xf9, 0x02, 0x02, 0x02, 0xe3, 0x9e, 0x99, 0x9b, 0x9c, 0x9a, 0x69, 0x3e, 0x34, 0x34, 0x31, 0x39, 0x34, 0x32, 0x67, 0x9a, 0x98, 0x99, 0x99, 0x97, 0x77, 0xe6, 0xf6, 0xf6, 0x02, 0xf4, 0xf2, 0xf6, 0x02, 0xf6, 0xf6, 0xef, 0xf2, 0xec, 0xcd, 0xde, 0xe6, 0xee, 0xf5, 0x02, 0xf6, 0xf6, 0xf6, 0xf4, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf2, 0xec, 0xe8, 0xe6, 0xe1, 0xe3, 0xe0, 0xde, 0xe0, 0xe0, 0xdb, 0xe0, 0xe1, 0xe0, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe3, 0xd6, 0xdb, 0xe3, 0xe1, 0xe1, 0xdb, 0xdb, 0xdb, 0xe0, 0xe0, 0xe0, 0xdc, 0xd4, 0xe0, 0xdc, 0xdb, 0xd6, 0xe1, 0xe4, 0xd4, 0xdc, 0xdb, 0xdc, 0xd4, 0xdc, 0xe0, 0xdc, 0xd6, 0xe0, 0xd6, 0xe5, 0xd4, 0xcd, 0xe3, 0xe1, 0xe0, 0xdc, 0xd6, 0xdc, 0xe0, 0xd4, 0xdc, 0xdb, 0xdc, 0xdb, 0xdc, 0xdb, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe1, 0xe0, 0xe1, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe1, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe1, 0xdb, 0xe0, 0xe1, 0xe3, 0xe1, 0xe3, 0xe9, 0xf6, 0x02, 0x02, 0xf9, 0x21, 0x02, 0xf6, 0xf6, 0xe9, 0x9c, 0x99, 0x9b, 0x76, 0x9b, 0x69, 0x68, 0x3c, 0x34, 0x2f, 0x33, 0x33, 0x31, 0x34, 0x69, 0x96, 0x97, 0x97, 0x97, 0x9c, 0x99, 0xbf, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0xf9, 0xf0, 0xee, 0xd6, 0x94, 0x84, 0x89, 0x8c, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x89, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x88, 0x86, 0x86, 0x7e, 0xb4, 0xe9, 0xdb, 0xe1, 0xe1, 0xdb, 0xe3, 0xe1, 0xef, 0x02, 0x70, 0xf6, 0xf4, 0xf6, 0x02, 0x02, 0x02, 0xd4, 0x9c, 0x9b, 0x9b, 0x9a, 0x9a, 0x69, 0x3e, 0x31, 0x2f, 0x2f, 0x3b, 0x34, 0x31, 0x67, 0x68, 0x95, 0x96, 0x9c, 0x97, 0x9a, 0xd4, 0xf5, 0xf6, 0x02, 0xf4, 0xf2, 0xf6, 0x02, 0xf6, 0xf9, 0x02, 0xf4, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf5, 0xf1, 0xf0, 0xeb, 0xe9, 0xe9, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe1, 0xdc, 0xe3, 0xe4, 0xde, 0xe0, 0xe1, 0xe1, 0xe0, 0xe1, 0xdc, 0xdb, 0xdc, 0xdc, 0xdc, 0xe0, 0xd6, 0xd6, 0xdc, 0xdc, 0xce, 0xce, 0xe1, 0xd6, 0xe0, 0xe0, 0xdc, 0xd6, 0xe4, 0xd6, 0xce, 0xe0, 0xe0, 0xdc, 0xd4, 0xe1, 0xd6, 0xd4, 0xdc, 0xdc, 0xdc, 0xd6, 0xd6, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdc, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe1, 0xe0, 0xe1, 0xe0, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdb, 0xe0, 0xdb, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3, 0xe5, 0xe5, 0xe5, 0xe5, 0xee, 0xf6, 0x02, 0x21, 0x21, 0x02, 0x21, 0xf6, 0x02, 0xe0, 0x99, 0x9b, 0x9b, 0x76, 0x76, 0x68, 0x67, 0x34, 0x33, 0x30, 0x30, 0x33, 0x33, 0x34, 0x69, 0x69, 0x94, 0x99, 0x97, 0x99, 0x99, 0xac, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf4, 0xf4, 0x02, 0xf6, 0xf2, 0xea, 0xc3, 0x86, 0x7c, 0x7e, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x82, 0x82, 0x82, 0x84, 0x84, 0x84, 0xa1, 0xce, 0xe3, 0xe1, 0xe0, 0xde, 0xe1, 0xe5, 0xe3, 0xf1, 0xf6, 0xf6, 0x70, 0x02, 0x02, 0xf9, 0x02, 0x02, 0xc5, 0x76, 0x9b, 0x9c, 0x9a, 0x77, 0x3e, 0x39, 0x33, 0x35, 0x30, 0x35, 0x33, 0x39, 0x67, 0x68, 0x98, 0x96, 0x9b, 0x99, 0x99, 0xbf, 0xf5, 0xf6, 0x02, 0xf4, 0xf0, 0x70, 0x02, 0x02, 0xf4, 0x02, 0x02, 0xf2, 0x02, 0xf6, 0x02, 0x02, 0xf1, 0x02, 0xf6, 0xf2, 0xf6, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf3, 0xf1, 0xef, 0xee, 0xef, 0xea, 0xeb, 0xed, 0xeb, 0xee, 0xe9, 0xe9, 0xe9, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe3, 0xd6, 0xdb, 0xd6, 0xdc, 0xe0, 0xe1, 0xd6, 0xdc, 0xe1, 0xdc, 0xd6, 0xdb, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xdc, 0xdb, 0xdc, 0xdb, 0xdc, 0xdb, 0xdc, 0xdb, 0xdb, 0xdb, 0xe0, 0xe1, 0xe0, 0xe1, 0xe0, 0xe1, 0xe0, 0xe1, 0xdb, 0xe1, 0xde, 0xe1, 0xde, 0xe1, 0xe3, 0xe3, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe3, 0xe3, 0xe3, 0xe5, 0xe5, 0xe9, 0xea, 0xeb, 0xee, 0xee, 0xea, 0xe9, 0xef, 0x02, 0x02, 0x02, 0x02, 0x21, 0xf4, 0x02, 0x02, 0xcd, 0x9c, 0x9c, 0x9b, 0x76, 0x76, 0x68, 0x34, 0x31, 0x35, 0x30, 0x60, 0x30, 0x33, 0x31, 0x3c, 0x69, 0x92, 0x9b, 0x97, 0x99, 0x96, 0xa7, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xf4, 0xef, 0xeb, 0xe1, 0xac, 0xb1, 0xae, 0xb2, 0xb2, 0xb2, 0xb6, 0xb4, 0xb4, 0xc5, 0xc5, 0xc5, 0xc8, 0xcd, 0xd4, 0xd4, 0xe0, 0xe0, 0xe1, 0xe5, 0xe9, 0xf0, 0xf3, 0xf0, 0xf1, 0xe5, 0xe5, 0xe9, 0xe6, 0xe9, 0xe6, 0xe3, 0xef, 0xf6, 0xf4, 0x02, 0x02, 0x02, 0xf9, 0x02, 0x70, 0xbb, 0x9d, 0x99, 0x9b, 0x9a, 0x9f, 0x3c, 0x34, 0x3b, 0x38, 0x38, 0x33, 0x35, 0x39, 0x34, 0x67, 0x68, 0x98, 0x99, 0x99, 0x99, 0xb4, 0xf6, 0xf6, 0x02, 0xf4, 0xf2, 0xf6, 0x02, 0xf6, 0xf9, 0xf9, 0x02, 0x70, 0xf6, 0xf9, 0x02, 0xf6, 0x02, 0xf6, 0xf4, 0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf9, 0xef, 0xeb, 0xeb, 0xee, 0xee, 0xec, 0xef, 0xef, 0xef, 0xef, 0xec, 0xf1, 0xee, 0xef, 0xf2, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf3, 0xe9, 0xe9, 0xe9, 0xe5, 0xe5, 0xe5, 0xea, 0xe3, 0xe3, 0xe4, 0xe3, 0xe1, 0xe1, 0xe1, 0xe3, 0xe1, 0xe3, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3, 0xe3, 0xe5, 0xe1, 0xe3, 0xe6, 0xe8, 0xe6, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xef, 0xef, 0xef, 0xeb, 0xeb, 0xee, 0xef, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9, 0xe6, 0xe9, 0xe5, 0xef, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf6, 0xf6, 0xc8, 0x9e, 0x9b, 0x9c, 0x76, 0x68, 0x67, 0x31, 0x33, 0x2a, 0x2a, 0x30, 0x2a, 0x30, 0x2c, 0x40, 0x43, 0x96, 0x97, 0x97, 0x99, 0x96, 0xa6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf9, 0xf6, 0x02, 0xf9, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf1, 0xf1, 0xef, 0xee, 0xeb, 0xeb, 0xee, 0xeb, 0xeb, 0xe9, 0xe9, 0xe9, 0xee, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf9, 0x02, 0xf6, 0xbb, 0x9e, 0x9b, 0x9b, 0x77, 0x69, 0x3c, 0x39, 0x3b, 0x38, 0x2f, 0x2f, 0x39, 0x33, 0x34, 0x67, 0x68, 0x9a, 0x97, 0x9b, 0x97, 0xad, 0xf4, 0x02, 0xf6, 0x02, 0xf4, 0xf4, 0x02, 0xf4, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x70, 0xf4, 0xef, 0x5a, 0xeb, 0xec, 0xec, 0xee, 0xec, 0xef, 0xef, 0xec, 0xef, 0xeb, 0xec, 0xec, 0xef, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf2, 0xeb, 0xe9, 0xeb, 0xe9, 0xe9, 0xea, 0xe9, 0xea, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb, 0xec, 0xf5, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf2, 0xec, 0xec, 0xef, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xe6, 0xee, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xcd, 0x9c, 0x9c, 0x9c, 0x9a, 0x68, 0x34, 0x39, 0x33, 0x2a, 0x2a, 0x30, 0x2a, 0x33, 0x2f, 0x3e, 0x43, 0x92, 0x97, 0x97, 0x99, 0x94, 0xa3, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf4, 0x02, 0xf4, 0x02, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf1, 0xec, 0xeb, 0xeb, 0xec, 0xeb, 0xeb, 0xeb, 0xee, 0xe9, 0xe9, 0xeb, 0xe6, 0xee, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf9, 0x02, 0xf6, 0xc3, 0x9c, 0x9d, 0xa0, 0x76, 0x43, 0x3e, 0x33, 0x3b, 0x38, 0x2f, 0x2f, 0x39, 0x3b, 0x2e, 0x3c, 0x68, 0x99, 0x97, 0x9d, 0x9b, 0xad, 0xf4, 0x02, 0xf6, 0x02, 0xf4, 0xf6, 0x02, 0xf9, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0xf2, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xef, 0xec, 0xef, 0xef, 0xec, 0xeb, 0xe8, 0xeb, 0xec, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf5, 0xe9, 0xe6, 0xe9, 0xe9, 0xe6, 0xea, 0xe6, 0xea, 0xef, 0xf0, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xf1, 0xf0, 0xef, 0xf0, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xef, 0xec, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0xf6, 0xf1, 0xec, 0xec, 0xec, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xee, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xd4, 0x9b, 0x9c, 0x9e, 0x77, 0x68, 0x3c, 0x39, 0x33, 0x2a, 0x30, 0x2a, 0x2a, 0x35, 0x2f, 0x40, 0x43, 0x91, 0x99, 0x97, 0x9b, 0x92, 0xa1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0xef, 0xeb, 0xe8, 0xeb, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9, 0xe9, 0xec, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0xf9, 0x02, 0xf6, 0xc3, 0x9c, 0xa0, 0x9e, 0x76, 0x43, 0x6a, 0x34, 0x3b, 0x35, 0x30, 0x64, 0x35, 0x39, 0x33, 0x3e, 0x68, 0x9a, 0x9b, 0x9b, 0x97, 0xb1, 0xf9, 0x02, 0x21, 0x02, 0xf6, 0xf9, 0x02, 0xf9, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0xf6, 0xf2, 0x5a, 0xeb, 0xec, 0xeb, 0xec, 0xef, 0xec, 0xef, 0xec, 0xec, 0xeb, 0xec, 0xe8, 0xec, 0xf5, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf2, 0xec, 0xe6, 0xe9, 0xe5, 0xe9, 0xe3, 0xe5, 0xe5, 0xeb, 0xea, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf1, 0xf1, 0xf1, 0xf5, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0xf1, 0xec, 0xeb, 0xef, 0xef, 0xee, 0xeb, 0xee, 0xeb, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xf4, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xdb, 0x9c, 0x9c, 0x9c, 0x77, 0x68, 0x3e, 0x3b, 0x2f, 0x30, 0x2a, 0x30, 0x30, 0x30, 0x2f, 0x6a, 0x3e, 0x94, 0x99, 0x97, 0x9c, 0x8f, 0xa4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf4, 0xf9, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0xf1, 0xec, 0xeb, 0xef, 0xeb, 0xeb, 0xeb, 0xeb, 0xee, 0xeb, 0xe9, 0xe9, 0xe9, 0xeb, 0xf4, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xcd, 0x9c, 0x9d, 0x9e, 0x9e, 0x69, 0x6a, 0x3c, 0x3b, 0x35, 0x30, 0x35, 0x2f, 0x33, 0x39, 0x3e, 0x68, 0x99, 0x9b, 0x9b, 0x9b, 0xb1, 0xf9, 0x21, 0xf6, 0x02, 0xf6, 0xf4, 0xf6, 0xf9, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf4, 0xef, 0xe8, 0xec, 0xec, 0xec, 0xec, 0xef, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xe8, 0xec, 0xf1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf1, 0xe6, 0xe6, 0xe5, 0xe6, 0xe5, 0xe5, 0xe5, 0xe9, 0xe9, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xeb, 0xef, 0xf4, 0xf6, 0xf4, 0xf4, 0x02, 0xf4, 0xf4, 0xf4, 0x70, 0xf6, 0x70, 0x02, 0x70, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf2, 0xec, 0xe8, 0xec, 0xef, 0xeb, 0xee, 0xee, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9, 0xe9, 0xeb, 0xf2, 0xf6, 0x02, 0x02, 0x02, 0x70, 0xf5, 0x02, 0xe5, 0x9e, 0x9c, 0x9e, 0x76, 0x69, 0x3e, 0x3c, 0x2f, 0x35, 0x30, 0x30, 0x38, 0x2f, 0x33, 0x47, 0x67, 0x96, 0x97, 0x97, 0x99, 0x8d, 0xa7, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf4, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0xf1, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xe9, 0xec, 0xee, 0xeb, 0xeb, 0xe9, 0xe9, 0xec, 0xf1, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xe1, 0x9e, 0x9c, 0x9b, 0x9e, 0x68, 0x6a, 0x6a, 0x33, 0x33, 0x2f, 0x35, 0x2f, 0x33, 0x3e, 0x3e, 0x98, 0x99, 0x9d, 0x9b, 0x9b, 0xb7, 0x21, 0x21, 0x21, 0x02, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 
-  0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0xf6, 0x02, 0x02, 0xec, 0xeb, 0xec, 0xeb, 0xeb, 0xee, 0xec, 0xec, 0xee, 0xec, 0xeb, 0xec, 0xe9, 0xe8, 0xf1, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf5, 0xe8, 0xe3, 0xe3, 0xe5, 0xe6, 0xe5, 0xe5, 0xe3, 0xe9, 0xe9, 0xeb, 0xeb, 0xee, 0xee, 0xeb, 0xee, 0xec, 0xee, 0xeb, 0xeb, 0xeb, 0xec, 0xef, 0xf4, 0xf6, 0xf4, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf9, 0xeb, 0xe8, 0xe9, 0xeb, 0xee, 0xec, 0xee, 0xee, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9, 0xeb, 0xf1, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0xf1, 0xa5, 0x9c, 0x9e, 0xa0, 0x68, 0x68, 0x40, 0x39, 0x3b, 0x35, 0x35, 0x35, 0x39, 0x40, 0x6a, 0x95, 0x99, 0x97, 0x97, 0x9a, 0x8d, 0xb1, 0xf6, 0xf5, 0xf6, 0x02, 0x02, 0xf6, 0xf6, 0xf9, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf4, 0xf1, 0xec, 0xe8, 0xeb, 0xeb, 0xe8, 0xeb, 0xeb, 0xee, 0xee, 0xe9, 0xeb, 0xe9, 0xeb, 0xf1, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xe9, 0xa6, 0x99, 0xa0, 0x76, 0x9e, 0x69, 0x6a, 0x3c, 0x3c, 0x3b, 0x33, 0x3c, 0x3c, 0x3e, 0x68, 0x76, 0x9b, 0x9d, 0x9b, 0x9b, 0xc8, 0x21, 0x21, 0x21, 0x02, 0xf6, 0xf9, 0xf4, 0xf2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xef, 0xe8, 0xef, 0xeb, 0xeb, 0xec, 0xee, 0xec, 0xec, 0xec, 0xeb, 0xe9, 0xe8, 0xe6, 0xec, 0xf5, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf1, 0xe6, 0xe6, 0xe6, 0xe9, 0xe5, 0xe5, 0xe3, 0xe5, 0xe9, 0xe9, 0xeb, 0xeb, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xf2, 0xf4, 0xf6, 0x02, 0xf4, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0xf6, 0x02, 0xf4, 0xec, 0xec, 0xeb, 0xec, 0xee, 0xee, 0xef, 0xee, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9, 0xeb, 0xef, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xa7, 0x9c, 0x9b, 0xa2, 0x76, 0x68, 0x6a, 0x40, 0x3d, 0x39, 0x3b, 0x34, 0x40, 0x4f, 0x68, 0x95, 0x76, 0x9b, 0x99, 0x9b, 0x91, 0xbf, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf2, 0xec, 0xe9, 0xe8, 0xeb, 0xe8, 0xeb, 0xeb, 0xee, 0xeb, 0xeb, 0xe9, 0xe9, 0xec, 0xef, 0xf4, 0x02, 0x02, 0x70, 0x02, 0x70, 0xf6, 0xf1, 0xaa, 0x99, 0xa4, 0x97, 0xa4, 0x69, 0x69, 0x43, 0x3e, 0x6a, 0x34, 0x40, 0x6a, 0x68, 0x76, 0x9c, 0x9b, 0x9d, 0x9d, 0x9d, 0xcd, 0x02, 0x21, 0xf6, 0x02, 0x02, 0xf9, 0xf6, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x70, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x70, 0x02, 0xf6, 0xf6, 0xf9, 0xe3, 0xf1, 0xeb, 0xee, 0xeb, 0xec, 0xee, 0xee, 0xee, 0xec, 0xe9, 0xeb, 0xee, 0xe6, 0xf1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xef, 0xe6, 0xe5, 0xe5, 0xe6, 0xe5, 0xe5, 0xe5, 0xe9, 0xe9, 0xe9, 0xeb, 0xeb, 0xe9, 0xeb, 0xeb, 0xe8, 0xe8, 0xec, 0xef, 0xf6, 0x02, 0xf4, 0x70, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0xef, 0xef, 0xeb, 0xe8, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xeb, 0xf6, 0x02, 0xf4, 0x02, 0x02, 0xf9, 0xf5, 0x02, 0xbf, 0x9c, 0x9d, 0x9b, 0xa0, 0x77, 0x69, 0x46, 0x6a, 0x40, 0x40, 0x6a, 0x4f, 0x68, 0x37, 0x9a, 0x97, 0x9c, 0x97, 0x9a, 0x96, 0xe1, 0xf6, 0xf6, 0xf9, 0x02, 0x02, 0x02, 0xf6, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf1, 0xeb, 0xeb, 0xef, 0xeb, 0xeb, 0xeb, 0xe9, 0xeb, 0xeb, 0xee, 0xe9, 0xeb, 0xe8, 0xeb, 0xf6, 0x02, 0xf4, 0x02, 0x70, 0x02, 0xf2, 0x02, 0xbf, 0x9b, 0x9b, 0xa0, 0x9c, 0x9e, 0x9f, 0x9a, 0x43, 0x6a, 0x46, 0x43, 0x68, 0x76, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0xa4, 0xec, 0x70, 0x21, 0x02, 0xf4, 0x02, 0xf4, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 
-  0x02, 0x02, 0xf9, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0xe6, 0xe8, 0xee, 0xeb, 0xec, 0xee, 0xeb, 0xec, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xe6, 0xef, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf2, 0xec, 0xe6, 0xe3, 0xe3, 0xe6, 0xe5, 0xe6, 0xe6, 0xe9, 0xeb, 0xe9, 0xe9, 0xeb, 0xe8, 0xe8, 0xe9, 0xec, 0xf1, 0xf9, 0xf4, 0xf6, 0xf6, 0x02, 0xf6, 0xf2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0xec, 0xec, 0xeb, 0xeb, 0xee, 0xec, 0xee, 0xee, 0xeb, 0xee, 0xeb, 0xe9, 0xeb, 0xe9, 0xeb, 0xf4, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xe8, 0x9e, 0x9d, 0x9d, 0x9b, 0xa0, 0x9f, 0x68, 0x43, 0x43, 0x46, 0x43, 0x95, 0x96, 0x76, 0x9b, 0x99, 0x99, 0x99, 0x90, 0xa6, 0xf1, 0xf5, 0xf4, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0xf6, 0xf6, 0xef, 0xe8, 0xe6, 0xec, 0xeb, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xeb, 0xeb, 0xeb, 0xf9, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0xeb, 0xa1, 0x9d, 0x9b, 0x9b, 0xa0, 0xa4, 0x77, 0x98, 0x95, 0x68, 0x95, 0x98, 0x9b, 0x9d, 0x9d, 0x9b, 0xa2, 0x9d, 0xaa, 0xf6, 0x02, 0xf9, 0xf4, 0x02, 0x02, 0xf9, 0xf4, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 
-  0x02, 0xf9, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0xf6, 0x02, 0x02, 0xee, 0xec, 0xeb, 0xeb, 0xec, 0xeb, 0xee, 0xeb, 0xec, 0xee, 0xeb, 0xeb, 0xe9, 0xe9, 0xeb, 0xf4, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf2, 0xe8, 0xe3, 0xe3, 0xe6, 0xe5, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xe8, 0xe8, 0xe9, 0xe8, 0xec, 0xef, 0xf4, 0x02, 0x02, 0x70, 0xf4, 0x02, 0xf4, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf4, 0xef, 0xe8, 0xeb, 0xef, 0xeb, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xe6, 0xeb, 0xf2, 0x02, 0x02, 0xf6, 0x02, 0x02, 0xf9, 0xf6, 0x21, 0xac, 0x9b, 0xa2, 0x9d, 0xa0, 0xa1, 0x98, 0x77, 0x68, 0x68, 0x98, 0x98, 0x9c, 0x9c, 0x97, 0x9b, 0x99, 0x99, 0x91, 0xbb, 0xf6, 0xf5, 0xf9, 0x02, 0xf6, 0x02, 0x02, 0x21, 0xf9, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf2, 0xf6, 0xf9, 0xeb, 0xec, 0xef, 0xeb, 0xeb, 0xeb, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe8, 0xf2, 0xf6, 0x02, 0xf9, 0x02, 0x70, 0x70, 0xf4, 0x02, 0xb4, 0x99, 0x9d, 0xa2, 0x9d, 0x9d, 0xa2, 0x9f, 0x9c, 0x9a, 0x9b, 0x9d, 0x9d, 0x9d, 0x9b, 0x9d, 0xa2, 0x9b, 0xe0, 0xf6, 0x70, 0x02, 0x02, 0x02, 0xf6, 0xf2, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 
-  0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf2, 0x02, 0xf2, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xee, 0xeb, 0xee, 0xeb, 0xee, 0xe9, 0xe6, 0xe9, 0xef, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf1, 0xeb, 0xe6, 0xe3, 0xe6, 0xe6, 0xe9, 0xe9, 0xeb, 0xe8, 0xe9, 0xe6, 0xeb, 0xec, 0xf2, 0xf2, 0xf6, 0x02, 0xf4, 0x02, 0xf6, 0x70, 0x02, 0x02, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf1, 0xe8, 0xeb, 0xec, 0xeb, 0xee, 0xec, 0xee, 0xeb, 0xee, 0xeb, 0xeb, 0xeb, 0xe9, 0xe8, 0xef, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0xf6, 0xf4, 0x02, 0xde, 0x9e, 0x9d, 0xa0, 0x9d, 0x9b, 0x9b, 0x76, 0x9e, 0x9c, 0x9c, 0x9d, 0x9b, 0x9b, 0x9d, 0x9b, 0x9b, 0x97, 0xa1, 0xe5, 0xf6, 0x02, 0xf6, 0x02, 0xf9, 0x02, 0xf6, 0xf9, 0xf2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf4, 0xec, 0xec, 0xe9, 0xeb, 0xe8, 0xe9, 0xeb, 0xeb, 0xe9, 0xee, 0xeb, 0xee, 0xe8, 0xeb, 0xec, 0xf4, 0x02, 0xf4, 0x02, 0x02, 0xf9, 0xf6, 0x02, 0xe9, 0x9c, 0x9b, 0xa2, 0xa2, 0x9d, 0xa0, 0xa2, 0x9e, 0x9d, 0x9e, 0xa0, 0x9d, 0x9d, 0x9b, 0xa2, 0x9e, 0xa6, 0x02, 0x02, 0xf1, 0x70, 0xf2, 0x02, 0x02, 0xf2, 0xf2, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf5, 0xef, 0xeb, 0xe9, 0xeb, 0xee, 0xeb, 0xeb, 0xeb, 0xee, 0xeb, 0xee, 0xe9, 0xe9, 0xe9, 0xeb, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf2, 0xeb, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe8, 0xeb, 0xef, 0xf4, 0xf4, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x21, 0xf6, 0x21, 0xf6, 0x21, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0xf2, 0xeb, 0xe9, 0xec, 0xeb, 0xeb, 0xee, 0xee, 0xee, 0xeb, 0xee, 0xeb, 0xeb, 0xe9, 0xe9, 0xeb, 0xf4, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf4, 0x02, 0x02, 0xb2, 0x9b, 0x9c, 0xa2, 0x9b, 0x9b, 0x76, 0x96, 0x97, 0x97, 0x9b, 0x9b, 0x9b, 0xa0, 0x99, 0x99, 0x98, 0xbb, 0xf6, 0xf6, 0xf5, 0x02, 0x02, 0xf6, 0x02, 0x5a, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf1, 0xe8, 0xeb, 0xeb, 0xe9, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe8, 0x5a, 0xf2, 0x02, 0xf6, 0x02, 0x02, 0xf9, 0x02, 0xf4, 0x02, 0xce, 0x9b, 0x92, 0xa0, 0xa2, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xa2, 0x9b, 0xa4, 0xe3, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xef, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xf2, 0x5a, 0xef, 0x5a, 0x5a, 0x5a, 0x5a, 0xeb, 0x5a, 0xe8, 0x5a, 0xe8, 0xe8, 0xe8, 0xe6, 0xe8, 0xe6, 0xe3, 0xd3, 0x56, 0xd3, 0xd3, 0xd3, 0xd3, 0xf4, 0xe9, 0xeb, 0xe9, 0xeb, 0xeb, 0xee, 0xeb, 0xeb, 0xee, 0xee, 0xeb, 0xe9, 0xe9, 0xe8, 0xf1, 0xf5, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0xf9, 0xef, 0xeb, 0xe9, 0xe9, 0xe6, 0xe9, 0xeb, 0xec, 0xf1, 0xf4, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf4, 0xf4, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x70, 0xf6, 0xf6, 0xef, 0xe8, 0xeb, 0xeb, 0xeb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb, 0xeb, 0xe8, 0xe9, 0xef, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf9, 0x02, 0x5a, 0xaa, 0xa0, 0xa0, 0xa2, 0x9b, 0x9b, 0x9d, 0x9d, 0x9b, 0x9d, 0xa2, 0x9d, 0x94, 0x99, 0x99, 0xaa, 0xeb, 0xf6, 0xf5, 0xf4, 0xf9, 0xf6, 0x21, 0x02, 0x21, 0x02, 0xde, 0xbf, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0xb6, 0xbf, 0xb6, 0xc8, 0xbf, 0xb6, 0xf3, 0xe8, 0xeb, 0xe8, 0xe9, 0xe9, 0xe9, 0xeb, 0xe9, 0xeb, 0xeb, 0xeb, 0xe8, 0xef, 0x21, 0xf6, 0xf4, 0x21, 0x21, 0x21, 0xf9, 0x02, 0x02, 0xc3, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0xa2, 0x9d, 0x9d, 0x9d, 0xa2, 0x9e, 0x99, 0xc8, 0x02, 0xf4, 0xf9, 0xf6, 0xf6, 0x02, 0xef, 0x21, 0xf4, 0xe6, 0xe8, 0xe3, 0x5a, 0xeb, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0xef, 0x5a, 0xf1, 0x5a, 0xef, 0x5a, 0xf2, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf2, 0xf2, 0xf2, 0x5a, 0xf6, 
-  0xb6, 0x83, 0xfb, 0x83, 0x75, 0x83, 0x75, 0x83, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x83, 0x83, 0x83, 0xfb, 0x81, 0xfb, 0x81, 0xfb, 0xfb, 0xfb, 0x7d, 0xfb, 0x7d, 0x5f, 0x7d, 0x5f, 0x7d, 0x5f, 0x7d, 0x7b, 0x7b, 0x7b, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x79, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xab, 0xf2, 0xe9, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xee, 0xee, 0xee, 0xeb, 0xe9, 0xe6, 0xe8, 0xf1, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf5, 0xf5, 0xf1, 0xf1, 0xf2, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x56, 0x9f, 0xfa, 0xa7, 0xab, 0xab, 0xae, 0xb2, 0xb6, 0xb6, 0x78, 0x78, 0x56, 0x56, 0x56, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xde, 0x6c, 0x6c, 0xe3, 0xe8, 0xe8, 0xe8, 0xec, 0xe8, 0xec, 0xeb, 0xeb, 0xee, 0xeb, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xee, 0xeb, 0xe9, 0xe8, 0xef, 0xf6, 0xf6, 0xf2, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0xe6, 0xa9, 0x9c, 0xa2, 0xa0, 0x9d, 0x9c, 0x9d, 0x9d, 0x9d, 0x99, 0x9b, 0xa0, 0x99, 0xa4, 0xe9, 0x02, 0xf5, 0xf2, 0x02, 0x02, 0xf9, 0xf2, 0x02, 0x02, 0x21, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xb6, 0xf1, 0xe6, 0xeb, 0xe8, 0xe9, 0xeb, 0xeb, 0xe9, 0xeb, 0xec, 0xeb, 0xe8, 0xec, 0xf5, 0xf6, 0xf9, 0x02, 0x02, 0x21, 0x02, 0xf9, 0xf0, 0x02, 0xca, 0x9e, 0x9d, 0x9e, 0x9d, 0x9b, 0x9d, 0x9d, 0x9d, 0xa0, 0xa2, 0x9e, 0xc5, 0x02, 0xf6, 0xf6, 0x02, 0xf9, 0xf6, 0x02, 0x02, 0x02, 0x78, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x79, 0x01, 0x01, 0x79, 0x01, 0x01, 0x01, 0x03, 0x72, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x5f, 0x7b, 0x7d, 0x5f, 0xfb, 0x7d, 0xfb, 0x7d, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x7d, 0x7d, 0x7b, 0x5f, 0x7b, 0x7b, 
-  0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x75, 0xde, 0xef, 0xe6, 0xef, 0xeb, 0xe9, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9, 0xe5, 0xec, 0xf4, 0xf4, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf4, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf4, 0xf9, 0x02, 0x5a, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x01, 0x03, 0x7d, 0xfb, 0x75, 0x8a, 0xd3, 0xef, 0xeb, 0xeb, 0xe9, 0xee, 0xea, 0xf3, 0xe9, 0xee, 0xec, 0xeb, 0xe9, 0xe8, 0xec, 0xf2, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0xf9, 0xf6, 0x02, 0xe3, 0xab, 0xa0, 0x9e, 0xa0, 0xa1, 0x9d, 0xa0, 0xa0, 0xa0, 0x99, 0x9a, 0xfa, 0xe5, 0x02, 0xf5, 0xf4, 0x02, 0xf6, 0x02, 0xf6, 0xf9, 0x21, 0x02, 0xf9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x8a, 0x70, 0x6c, 0xef, 0xe6, 0xeb, 0xe8, 0xee, 0xeb, 0xec, 0xee, 0xe9, 0xeb, 0xeb, 0xf1, 0xf6, 0xf6, 0x21, 0xf6, 0x70, 0x02, 0x70, 0xf9, 0x02, 0x02, 0xe1, 0xac, 0x9f, 0x9c, 0xa4, 0x9d, 0xa4, 0xa4, 0xa2, 0xa6, 0xc8, 0xf6, 0xf4, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0xf4, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xef, 0xeb, 0xe8, 0xe6, 0xec, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xeb, 0xe9, 0xe6, 0xe6, 0xef, 0xf4, 0x02, 0x02, 0xf4, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf4, 0xf6, 0x02, 0xf4, 0xf4, 0x02, 0xf4, 0xf9, 0xf6, 0xf9, 0x9f, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xf5, 0xef, 0xe5, 0xeb, 0xee, 0xee, 0xe9, 0xee, 0xee, 0xee, 0xec, 0xe9, 0xe8, 0xec, 0xef, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf5, 0xf6, 0xf6, 0xeb, 0xb7, 0xa1, 0xa0, 0x9c, 0x9e, 0x9c, 0x9a, 0x99, 0xa1, 0xaa, 0xe9, 0xf6, 0x02, 0xf9, 0xf4, 0x02, 0x02, 0x02, 0x02, 0x21, 0xf6, 0x21, 0x78, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x22, 0x00, 0x00, 0xac, 0xf4, 0xe6, 0xe8, 0xec, 0xe8, 0xec, 0xeb, 0xee, 0xee, 0xeb, 0xe9, 0xeb, 0xee, 0xf6, 0xf6, 0x02, 0xf6, 0x02, 0x70, 0x70, 0x70, 0xf9, 0xf5, 0x02, 0xf3, 0xe1, 0xbb, 0xaa, 0xaa, 0xaa, 0xad, 0xc5, 0xe6, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf9, 0xe8, 0x81, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xb6, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x83, 0x56, 0xee, 0xe8, 0xe6, 0xf4, 0xe5, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xeb, 0xe9, 0xe8, 0xe6, 0xe8, 0xf1, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0xf4, 0xf4, 0x02, 0xf6, 0x02, 0x02, 0xb2, 0x01, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xae, 0xef, 0xe6, 0xeb, 0xeb, 0xf0, 0xe9, 0xf0, 0xeb, 0xee, 0xec, 0xeb, 0xe9, 0xe8, 0xec, 0xf5, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf4, 0x02, 0xf5, 0xf6, 0xf6, 0xe5, 0xb1, 0xa8, 0xa6, 0xa5, 0xa8, 0xb2, 0xe0, 0xf9, 0xf6, 0x70, 0xf5, 0xf4, 0xf6, 0x02, 0x02, 0xf4, 0x02, 0xf6, 0x02, 0x02, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x7d, 0xeb, 0xef, 0xe9, 0xe6, 0xef, 0xe8, 0xe9, 0xec, 0xee, 0xee, 0xe9, 0xeb, 0xeb, 0xf2, 0xf6, 0x02, 0x02, 0xf4, 0x70, 0x02, 0x70, 0x70, 0xf4, 0xf4, 0xf5, 0xf6, 0xf5, 0xeb, 0xf0, 0xf1, 0xf1, 0xf5, 0xf6, 0xf3, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0xf9, 0x02, 0xab, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xb6, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xe8, 0xe8, 0xe8, 0xe6, 0xec, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xeb, 0xe8, 0xe6, 0xe6, 0xe8, 0xf1, 0xf6, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0xf6, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf2, 0xf6, 0x02, 0xf6, 0xf4, 0xf2, 0x02, 0xe3, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x7f, 0xe6, 0xee, 0xe9, 0xe9, 0xeb, 0xef, 0xeb, 0xeb, 0xeb, 0xee, 0xeb, 0xeb, 0xe8, 0xe8, 0xf2, 0xf6, 0x02, 0x02, 0x70, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf2, 0xf5, 0xf6, 0xf2, 0xee, 0xe9, 0xeb, 0xf1, 0xf5, 0xf5, 0xf5, 0x02, 0xf9, 0xf6, 0x02, 0x02, 0xf4, 0xf6, 0xf4, 0xf6, 0x02, 0x02, 0x56, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x77, 0x02, 0xe8, 0xe9, 0xe9, 0xe9, 0xeb, 0xeb, 0xee, 0xee, 0xeb, 0xe9, 0xe9, 0xf1, 0xf5, 0xf6, 0x02, 0x21, 0x70, 0x02, 0xf9, 0xf4, 0x02, 0x02, 0xf6, 0xf4, 0xf3, 0xf6, 0xf4, 0xf3, 0xf3, 0xf5, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x02, 0xe8, 0x5f, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-  0x78, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x79, 0xfa, 0xf2, 0xf2, 0xde, 0xec, 0xe8, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xeb, 0xe8, 0xe6, 0xe6, 0xe8, 0xf2, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0xf6, 0x02, 0xf6, 0xf4, 0x02, 0xf6, 0xf9, 0x02, 0x02, 0xeb, 0xa1, 0x7d, 0x84, 0x83, 0x7e, 0x7f, 0x73, 0x73, 0x7c, 0x7c, 0x7c, 0x7c, 0x72, 0x7c, 0x72, 0x72, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x72, 0x71, 0x79, 0x80, 0x00, 0x78, 0xf3, 0xe8, 0xe9, 0xeb, 0xf1, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe8, 0xe6, 0xef, 0xf2, 0x02, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0xf9, 0xf4, 0x02, 0xf6, 0xf4, 0xf6, 0x02, 0xf6, 0xf5, 0xf3, 0xf4, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0xf5, 0xa3, 0x7c, 0x81, 0x7f, 0x80, 0x7f, 0x73, 0x73, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x72, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x7a, 0x71, 0x7a, 0x71, 0x7a, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 0x71, 0xb4, 0xf2, 0xee, 0xec, 0xe9, 0xe9, 0xeb, 0xeb, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xf1, 0x21, 0xf6, 0xf6, 0x70, 0x02, 0x02, 0x02, 0xf9, 0xf2, 0xf4, 0xf6, 0x02, 0xf6, 0xf4, 0x02, 0x02, 0x70, 0xf9, 0xf9, 0xf6, 0x02, 0x21, 0x02, 0x21, 0x21, 0x21, 0x02, 0xfa, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 
-  0xbf, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x79, 0x00, 0x7b, 0xb6, 0xe8, 0xf1, 0xe3, 0xe8, 0xe8, 0xeb, 0xeb, 0xe9, 0xeb, 0xe8, 0xeb, 0xeb, 0xe8, 0xe6, 0xe6, 0xeb, 0xf1, 0xf4, 0xf6, 0xf6, 0xf6, 0x21, 0xf6, 0x02, 0x70, 0xf6, 0x70, 0x02, 0xf6, 0x70, 0xf6, 0xf6, 0xf6, 0xf9, 0xf1, 0x02, 0x02, 0xeb, 0xa5, 0x85, 0x91, 0x8f, 0x9a, 0x8c, 0x98, 0x96, 0x96, 0x96, 0x96, 0x93, 0x94, 0x93, 0x96, 0x96, 0x94, 0x93, 0x93, 0x91, 0x93, 0x94, 0x93, 0x91, 0x93, 0x91, 0x8f, 0x8f, 0x8f, 0x96, 0x96, 0x96, 0x90, 0x98, 0x8a, 0xa1, 0xe3, 0xef, 0xeb, 0xec, 0xe9, 0xef, 0xeb, 0xeb, 0xeb, 0xee, 0xeb, 0xeb, 0xe8, 0xe8, 0xef, 0xf4, 0xf6, 0x70, 0xf6, 0x02, 0xf2, 0x02, 0x02, 0x02, 0x70, 0xf6, 0xf4, 0xf4, 0xf6, 0x02, 0x02, 0xf4, 0xf6, 0x02, 0xf4, 0xf9, 0x70, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0xf5, 0xbf, 0x8f, 0x8d, 0x8f, 0x91, 0x8f, 0x91, 0x8f, 0x91, 0x8f, 0x93, 0x91, 0x93, 0x8f, 0x94, 0x8f, 0x91, 0x8f, 0x8f, 0x8d, 0x8f, 0x8d, 0x8f, 0x8c, 0x8f, 0x8c, 0x89, 0x8a, 0x90, 0x8f, 0x8c, 0x89, 0x75, 0x84, 0x6f, 0xcd, 0xe9, 0xef, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xee, 0xee, 0xeb, 0xe8, 0xec, 0xf2, 0xf6, 0x02, 0x02, 0x02, 0xef, 0x02, 0x02, 0x02, 0xf9, 0xf4, 0xf6, 0x02, 0x70, 0xf9, 0x70, 0xf9, 0x70, 0x02, 0x70, 0x21, 0x02, 0x21, 0x21, 0x21, 0x02, 0xde, 0x72, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x22, 
-  0x78, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x79, 0x79, 0x01, 0xbf, 0xe8, 0xf1, 0xe8, 0xe8, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xe8, 0xeb, 0xeb, 0xe8, 0xe6, 0xe6, 0xe8, 0xf9, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0x02, 0xe3, 0x9f, 0x82, 0x8d, 0x96, 0x89, 0x8f, 0x90, 0x8c, 0x8d, 0x8d, 0x8d, 0x8f, 0x8e, 0x91, 0x90, 0x8f, 0x8e, 0x8f, 0x90, 0x91, 0x91, 0x91, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x90, 0x90, 0x92, 0x8c, 0x8c, 0x91, 0x8f, 0x8c, 0x96, 0x8a, 0xb2, 0xe9, 0xe8, 0xe9, 0xe3, 0xef, 0xee, 0xeb, 0xeb, 0xeb, 0xee, 0xeb, 0xe9, 0xe6, 0xec, 0xf2, 0xf6, 0x02, 0x02, 0xf6, 0x02, 0x70, 0xf9, 0x70, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf5, 0xf6, 0xe5, 0x9a, 0x82, 0x92, 0x8c, 0x8c, 0x8d, 0x8c, 0x8d, 0x8d, 0x90, 0x90, 0x8d, 0x8d, 0x8d, 0x8d, 0x8f, 0x90, 0x8d, 0x90, 0x8f, 0x90, 0x8f, 0x8e, 0x8f, 0x8e, 0x8a, 0x94, 0x91, 0x8c, 0x8d, 0x8d, 0x8f, 0x91, 0x96, 0x87, 0x9a, 0xe6, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xeb, 0xee, 0xeb, 0xee, 0xe6, 0xe8, 0xf1, 0xf4, 0x02, 0x02, 0x70, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0x70, 0xf9, 0x70, 0x02, 0x70, 0x02, 0x02, 0x21, 0x21, 0x02, 0x21, 0x02, 0x21, 0x21, 0x21, 0x98, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x01, 0xfa, 0xe8, 0xec, 0xe9, 0xe6, 0xe9, 0xeb, 0xeb, 0xe9, 0xeb, 0xeb, 0xe9, 0xe8, 0xe9, 0xe8, 0xe8, 0xe3, 0xeb, 0xf1, 0xf6, 0xf6, 0xf6, 0xf4, 0x02, 0xf6, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf9, 0xbf, 0x98, 0x85, 0x90, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x90, 0x91, 0x8f, 0x8d, 0x93, 0xc8, 0xf1, 0xe3, 0xec, 0xe9, 0xee, 0xee, 0xeb, 0xeb, 0xee, 0xee, 0xe6, 0xeb, 0xeb, 0xec, 0xf5, 0x02, 0x02, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf5, 0xe9, 0xa5, 0x84, 0x8c, 0x8c, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x8e, 0x8c, 0x8d, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x90, 0x8d, 0x8e, 0x8d, 0x90, 0x8d, 0x8e, 0x91, 0x8c, 0x8d, 0x87, 0x9c, 0xdb, 0xee, 0xe9, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xeb, 0xe8, 0xe8, 0xf1, 0xf6, 0xf6, 0xf9, 0x02, 0x02, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0x21, 0xf2, 0x02, 0xf9, 0xf4, 0x21, 0xa3, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x22, 0x00, 0x71, 0x79, 0x00, 0x00, 0x72, 0x8f, 0xb6, 0xdb, 0xef, 0xee, 0xe6, 0xe9, 0xee, 0xeb, 0xe9, 0xeb, 0xe9, 0xe9, 0xe8, 0xe6, 0xe8, 0xe6, 0xe6, 0xe8, 0xef, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf2, 0xdb, 0xa7, 0x8a, 0x6f, 0x91, 0x8d, 0x8e, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x8d, 0x9a, 0xde, 0xf3, 0xd3, 0xef, 0xe9, 0xee, 0xeb, 0xe9, 0xe9, 0xeb, 0xee, 0xe8, 0xe6, 0xeb, 0xef, 0xf4, 0xf6, 0x02, 0xf6, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0xf6, 0x02, 0xf9, 0x02, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xa5, 0x87, 0x88, 0x8c, 0x8e, 0x89, 0x8d, 0x8c, 0x8e, 0x8c, 0x8e, 0x8c, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x89, 0x8d, 0x90, 0x8c, 0x85, 0x9a, 0xe3, 0xef, 0xe9, 0xe6, 0xe9, 0xee, 0xef, 0xeb, 0xec, 0xe9, 0xe8, 0xe9, 0xf1, 0xf4, 0xf6, 0xf4, 0xf9, 0x02, 0x02, 0x70, 0x02, 0x02, 0xf9, 0x21, 0x70, 0x21, 0x70, 0x02, 0xf9, 0x02, 0xf2, 0x21, 0x02, 0xf2, 0xfa, 0x79, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 
-  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x71, 0x71, 0x79, 0x71, 0x81, 0x9a, 0xae, 0xc8, 0xdb, 0xe9, 0xf0, 0xf1, 0xf0, 0xf3, 0xf1, 0xf0, 0xf1, 0xf0, 0xef, 0xee, 0xeb, 0xeb, 0xeb, 0xee, 0xef, 0xf5, 0xf5, 0x02, 0x02, 0xf6, 0xf5, 0xeb, 0xd3, 0xa5, 0x93, 0x8c, 0x8a, 0x8d, 0x93, 0x8d, 0x90, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x91, 0x90, 0x8d, 0x94, 0x85, 0xa1, 0xe1, 0xee, 0xee, 0xe6, 0xe9, 0xee, 0xee, 0xef, 0xee, 0xe6, 0xe9, 0xe9, 0xe8, 0xeb, 0xef, 0xf6, 0x02, 0x70, 0xf6, 0x70, 0x70, 0x02, 0x02, 0x02, 0xf9, 0x21, 0x21, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf6, 0xf4, 0x70, 0xf6, 0x02, 0x02, 0xac, 0x87, 0x85, 0x8d, 0x89, 0x90, 0x89, 0x8e, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x8c, 0x8e, 0x8c, 0x8e, 0x8c, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x90, 0x8e, 0x92, 0x89, 0x94, 0x8d, 0x84, 0x9a, 0xdb, 0xe9, 0xf3, 0xee, 0xe5, 0xe6, 0xef, 0xef, 0xeb, 0xe6, 0xe6, 0xe8, 0xf1, 0xf4, 0x02, 0x02, 0xf6, 0x02, 0xf4, 0x70, 0xf2, 0x02, 0x70, 0x21, 0x70, 0x02, 0xf9, 0xf9, 0xf2, 0xf6, 0x02, 0xe8, 0xa5, 0x01, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x00, 0x22, 0x79, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x79, 0x7a, 0x72, 0x72, 0x73, 0x7c, 0x73, 0x74, 0x84, 0x6f, 0x86, 0x8a, 0x8c, 0x8d, 0x96, 0x9a, 0xa0, 0xa1, 0xaa, 0xac, 0xb2, 0xbb, 0xc8, 0xcd, 0xd3, 0xdb, 0xdb, 0xde, 0xe0, 0xde, 0xd4, 0xd3, 0xcd, 0xc8, 0xc8, 0xb4, 0xab, 0xa1, 0x9a, 0x87, 0x8f, 0x8c, 0x8a, 0x92, 0x8f, 0x89, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x94, 0x96, 0x87, 0x9c, 0xc8, 0xee, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xeb, 0xe9, 0xeb, 0xeb, 0xe9, 0xe8, 0xe8, 0xf1, 0xf5, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x02, 0x02, 0xf1, 0x02, 0xf6, 0xf4, 0x02, 0xef, 0xb6, 0x84, 0x87, 0x94, 0x8d, 0x89, 0x8d, 0x8c, 0x8d, 0x8c, 0x8e, 0x8c, 0x8e, 0x8c, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8c, 0x90, 0x89, 0x8c, 0x94, 0x8d, 0x88, 0x93, 0xa7, 0xd4, 0xf4, 0xf5, 0xf1, 0xeb, 0xe6, 0xe9, 0xe9, 0xe6, 0xe9, 0xeb, 0xef, 0xf5, 0xf5, 0xf6, 0x02, 0x02, 0xf6, 0x70, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xdb, 0x98, 0x79, 0x71, 0x71, 0x00, 0x71, 0x71, 0x00, 0x71, 0x00, 0x71, 0x71, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 
-  0x56, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x7c, 0x7c, 0x73, 0x7f, 0x81, 0x82, 0x75, 0x85, 0x87, 0x87, 0x8a, 0x8a, 0x8c, 0x8f, 0x8f, 0x93, 0x94, 0x93, 0x96, 0x96, 0x93, 0x91, 0x90, 0x8c, 0x8c, 0x8d, 0x91, 0x94, 0x89, 0x8d, 0x90, 0x91, 0x91, 0x92, 0x90, 0x90, 0x91, 0x94, 0x93, 0x94, 0x93, 0x91, 0x93, 0x90, 0x8f, 0x8f, 0x90, 0x8d, 0x8d, 0x96, 0x89, 0x8f, 0x99, 0x8f, 0x90, 0x98, 0x90, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x8d, 0x92, 0x90, 0x88, 0x98, 0xac, 0xe3, 0xee, 0xf3, 0xee, 0xe9, 0xe9, 0xf1, 0xe9, 0xeb, 0xe9, 0xe6, 0xe6, 0xe8, 0xef, 0x02, 0xf6, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x21, 0x21, 0x02, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xf6, 0x02, 0xf5, 0xae, 0x84, 0x85, 0x8f, 0x8c, 0x8d, 0x90, 0x88, 0x90, 0x8c, 0x8e, 0x8c, 0x8e, 0x8c, 0x8e, 0x8c, 0x8d, 0x8e, 0x8c, 0x8e, 0x8c, 0x8e, 0x8d, 0x8e, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8e, 0x90, 0x8b, 0x8c, 0x94, 0x8c, 0x88, 0x94, 0x8f, 0x8d, 0x89, 0x8f, 0xa1, 0xb2, 0xe1, 0xef, 0xf3, 0xf3, 0xf3, 0xf1, 0xee, 0xe9, 0xeb, 0xf2, 0xf5, 0xf6, 0xf6, 0x02, 0xf6, 0xf6, 0x02, 0xf4, 0xf9, 0xf5, 0x02, 0x02, 0x02, 0xf6, 0xae, 0x93, 0x82, 0x7e, 0x85, 0x87, 0x84, 0x84, 0x80, 0x7e, 0x7a, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x6e, 0x71, 0x00, 0x72, 0x74, 0x75, 0x6f, 0x8f, 0x8f, 0x93, 0x91, 0x93, 0x96, 0x96, 0x98, 0x96, 0x98, 0x96, 0x96, 0x93, 0x96, 0x93, 0x93, 0x91, 0x91, 0x93, 0x96, 0x90, 0x8f, 0x8e, 0x8d, 0x96, 0x96, 0x96, 0x90, 0x8d, 0x8e, 0x90, 0x8e, 0x8e, 0x90, 0x90, 0x90, 0x91, 0x94, 0x94, 0x91, 0x91, 0x90, 0x90, 0x91, 0x94, 0x90, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x8d, 0x96, 0x92, 0x89, 0x90, 0x90, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x90, 0x88, 0x92, 0x96, 0x89, 0x86, 0x91, 0xa6, 0xc8, 0xe9, 0xee, 0xef, 0xeb, 0xee, 0xee, 0xec, 0xee, 0xe9, 0xe8, 0xe9, 0xef, 0xf3, 0xf4, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x21, 0x02, 0x02, 0xf6, 0x02, 0xf6, 0x02, 0xf6, 0xf6, 0xe3, 0xa1, 0x85, 0x8f, 0x94, 0x8c, 0x87, 0x8c, 0x90, 0x89, 0x90, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x90, 0x8d, 0x8d, 0x90, 0x8d, 0x90, 0x8d, 0x90, 0x8d, 0x90, 0x8d, 0x8d, 0x8d, 0x92, 0x89, 0x8e, 0x94, 0x8e, 0x8d, 0x89, 0x8f, 0x8d, 0x8a, 0x87, 0x85, 0x8a, 0x8f, 0xa3, 0xa6, 0xac, 0xb4, 0xc8, 0xdb, 0xe3, 0xeb, 0xef, 0xf3, 0xf5, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf2, 0xd4, 0xb2, 0x96, 0x87, 0x88, 0x91, 0x98, 0x96, 0x89, 0x96, 0x96, 0x96, 0x98, 0x96, 0x96, 0x93, 0x85, 0x81, 0x7b, 0x79, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 
-  0x56, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x72, 0x81, 0x8f, 0x93, 0x95, 0x98, 0x98, 0x95, 0x96, 0x96, 0x94, 0x96, 0x94, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x96, 0x90, 0x90, 0x90, 0x8d, 0x92, 0x96, 0x90, 0x90, 0x90, 0x90, 0x92, 0x94, 0x94, 0x94, 0x94, 0x92, 0x92, 0x92, 0x92, 0x94, 0x8e, 0x90, 0x92, 0x94, 0x92, 0x94, 0x92, 0x90, 0x91, 0x94, 0x94, 0x94, 0x90, 0x90, 0x96, 0x8d, 0x8d, 0x90, 0x92, 0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x90, 0x90, 0x8e, 0x8d, 0x97, 0x90, 0x8c, 0x94, 0x90, 0x90, 0x8a, 0x89, 0x9a, 0xaa, 0xc8, 0xdb, 0xe6, 0xe9, 0xee, 0xee, 0xef, 0xee, 0xee, 0xe9, 0xee, 0xf1, 0xf6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xf6, 0xf3, 0xe3, 0xac, 0x8f, 0x85, 0x87, 0x8c, 0x8a, 0x89, 0x8d, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x90, 0x8e, 0x89, 0x8e, 0x8e, 0x90, 0x96, 0x8c, 0x91, 0x94, 0x91, 0x8f, 0x8d, 0x8f, 0x86, 0x85, 0x84, 0x87, 0x88, 0x89, 0x8c, 0x92, 0x98, 0x9c, 0xa3, 0xa5, 0xaa, 0xa7, 0xac, 0xa7, 0xa4, 0x77, 0x96, 0x8c, 0x85, 0x89, 0x96, 0x91, 0x8e, 0x90, 0x8e, 0x97, 0x90, 0x90, 0x94, 0x94, 0x96, 0x96, 0x94, 0x9a, 0x98, 0x8f, 0x85, 0x7c, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x71, 0x00, 0x00, 0x8a, 0x77, 0x98, 0x96, 0x94, 0x91, 0x91, 0x94, 0x94, 0x94, 0x94, 0x94, 0x91, 0x94, 0x91, 0x92, 0x90, 0x91, 0x91, 0x92, 0x91, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x90, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x92, 0x90, 0x92, 0x90, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x92, 0x90, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x8d, 0x92, 0x90, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x90, 0x8e, 0x90, 0x90, 0x8e, 0x90, 0x8e, 0x91, 0x90, 0x8c, 0x89, 0x8c, 0x91, 0x9e, 0xa4, 0xaa, 0xac, 0xb4, 0xbb, 0xc5, 0xc8, 0xd3, 0xdb, 0xe3, 0xe6, 0xec, 0xef, 0xf2, 0xf4, 0xf2, 0xf1, 0xe8, 0xd3, 0xb6, 0xa4, 0x8c, 0x82, 0x8c, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x8e, 0x8e, 0x8c, 0x8e, 0x8b, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8c, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e, 0x90, 0x8c, 0x8e, 0x8c, 0x8e, 0x8d, 0x8e, 0x90, 0x8d, 0x8e, 0x8e, 0x8e, 0x90, 0x90, 0x90, 0x8e, 0x90, 0x8d, 0x92, 0x8d, 0x90, 0x90, 0x92, 0x8e, 0x92, 0x90, 0x8e, 0x8d, 0x8e, 0x89, 0x89, 0x89, 0x88, 0x88, 0x87, 0x88, 0x86, 0x87, 0x88, 0x8c, 0x8c, 0x8e, 0x90, 0x94, 0x92, 0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x94, 0x92, 0x91, 0x91, 0x96, 0x93, 0x98, 0x9a, 0x8f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 
-  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x71, 0x79, 0x83, 0x8f, 0x96, 0x96, 0x98, 0x96, 0x96, 0x96, 0x94, 0x92, 0x94, 0x91, 0x94, 0x91, 0x92, 0x91, 0x91, 0x94, 0x91, 0x94, 0x92, 0x94, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x92, 0x90, 0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x92, 0x90, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x8d, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x94, 0x91, 0x90, 0x8d, 0x8d, 0x90, 0x87, 0x89, 0x8c, 0x8c, 0x89, 0x8c, 0x8d, 0x93, 0x91, 0x98, 0x9a, 0x9f, 0xa1, 0xa3, 0xa5, 0xa6, 0xa3, 0xa1, 0x9a, 0x8d, 0x85, 0x89, 0x88, 0x8d, 0x90, 0x8c, 0x89, 0x90, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8e, 0x8c, 0x8e, 0x8c, 0x8c, 0x8c, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8e, 0x8d, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8e, 0x8d, 0x8d, 0x8c, 0x90, 0x8d, 0x90, 0x8d, 0x90, 0x8d, 0x90, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x90, 0x90, 0x92, 0x90, 0x90, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x93, 0x94, 0x98, 0x98, 0x87, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x71, 0x7b, 0x83, 0x85, 0x8a, 0x8d, 0x93, 0x94, 0x96, 0x94, 0x96, 0x94, 0x96, 0x94, 0x96, 0x96, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x94, 0x92, 0x92, 0x92, 0x90, 0x91, 0x90, 0x94, 0x92, 0x92, 0x92, 0x90, 0x92, 0x90, 0x91, 0x90, 0x90, 0x92, 0x90, 0x92, 0x91, 0x92, 0x91, 0x90, 0x92, 0x92, 0x92, 0x91, 0x92, 0x92, 0x91, 0x92, 0x91, 0x90, 0x90, 0x91, 0x92, 0x91, 0x92, 0x91, 0x92, 0x92, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92, 0x90, 0x8f, 0x90, 0x90, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x8e, 0x90, 0x8e, 0x92, 0x90, 0x92, 0x92, 0x90, 0x92, 0x90, 0x92, 0x90, 0x92, 0x90, 0x90, 0x92, 0x90, 0x90, 0x92, 0x94, 0x92, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x8d, 0x8c, 0x8d, 0x90, 0x8d, 0x8c, 0x8c, 0x89, 0x88, 0x87, 0x88, 0x8c, 0x8a, 0x86, 0x85, 0x88, 0x8c, 0x8d, 0x8d, 0x90, 0x8d, 0x8c, 0x8c, 0x8d, 0x90, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8c, 0x8e, 0x8c, 0x8e, 0x8c, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8f, 0x8e, 0x8f, 0x90, 0x8d, 0x90, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x91, 0x8d, 0x8e, 0x8d, 0x90, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x90, 0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x90, 0x8d, 0x90, 0x90, 0x91, 0x90, 0x91, 0x91, 0x91, 0x92, 0x94, 0x91, 0x92, 0x91, 0x90, 0x93, 0x8c, 0x8a, 0x85, 0x81, 0x01, 0x00, 0x71, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 
-  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x71, 0x71, 0x7a, 0x7c, 0x7e, 0x7f, 0x74, 0x85, 0x85, 0x85, 0x8a, 0x8a, 0x8d, 0x8f, 0x96, 0x93, 0x96, 0x96, 0x96, 0x98, 0x96, 0x96, 0x96, 0x94, 0x96, 0x94, 0x94, 0x94, 0x91, 0x93, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x94, 0x91, 0x91, 0x92, 0x93, 0x92, 0x93, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8f, 0x91, 0x91, 0x90, 0x8f, 0x90, 0x8f, 0x8d, 0x8f, 0x8d, 0x8f, 0x90, 0x8f, 0x8e, 0x8f, 0x8e, 0x8f, 0x90, 0x91, 0x8d, 0x91, 0x8d, 0x90, 0x90, 0x8e, 0x8e, 0x8d, 0x8e, 0x8e, 0x8d, 0x8e, 0x92, 0x90, 0x92, 0x92, 0x90, 0x92, 0x90, 0x92, 0x92, 0x90, 0x92, 0x90, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x92, 0x8d, 0x8e, 0x8e, 0x90, 0x92, 0x94, 0x94, 0x89, 0x8c, 0x92, 0x90, 0x90, 0x89, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x92, 0x92, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8f, 0x8d, 0x8d, 0x8c, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8f, 0x8d, 0x8f, 0x8f, 0x8d, 0x8d, 0x8d, 0x8d, 0x8f, 0x8d, 0x8f, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8f, 0x8d, 0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x91, 0x91, 0x8f, 0x93, 0x91, 0x8f, 0x91, 0x93, 0x91, 0x91, 0x8f, 0x8f, 0x8c, 0x8c, 0x89, 0x89, 0x87, 0x85, 0x75, 0x82, 0x74, 0x7c, 0x79, 0x79, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x79, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x7a, 0x01, 0x72, 0x7b, 0x7c, 0x7d, 0x74, 0x81, 0x81, 0x75, 0x87, 0x87, 0x8a, 0x8a, 0x8a, 0x8f, 0x8f, 0x8f, 0x91, 0x93, 0x96, 0x96, 0x96, 0x98, 0x91, 0x96, 0x93, 0x96, 0x95, 0x96, 0x96, 0x93, 0x96, 0x96, 0x96, 0x96, 0x95, 0x96, 0x93, 0x96, 0x93, 0x96, 0x96, 0x96, 0x96, 0x93, 0x96, 0x93, 0x96, 0x93, 0x96, 0x93, 0x94, 0x93, 0x91, 0x93, 0x91, 0x91, 0x91, 0x91, 0x8f, 0x90, 0x8f, 0x8f, 0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x92, 0x92, 0x90, 0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x8f, 0x8d, 0x8d, 0x91, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x8d, 0x8d, 0x8c, 0x90, 0x8e, 0x8e, 0x8c, 0x8e, 0x89, 0x8e, 0x92, 0x8e, 0x8c, 0x8b, 0x89, 0x8e, 0x94, 0x8c, 0x92, 0x92, 0x8d, 0x8d, 0x8a, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x90, 0x90, 0x91, 0x91, 0x8c, 0x8c, 0x8f, 0x8d, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x8f, 0x90, 0x8f, 0x91, 0x8f, 0x91, 0x8f, 0x91, 0x91, 0x93, 0x91, 0x93, 0x93, 0x96, 0x93, 0x96, 0x93, 0x96, 0x93, 0x91, 0x93, 0x93, 0x93, 0x91, 0x93, 0x8f, 0x96, 0x96, 0x93, 0x94, 0x8f, 0x8f, 0x8f, 0x8a, 0x8a, 0x8a, 0x87, 0x87, 0x87, 0x6f, 0x82, 0x83, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7a, 0x71, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 
-  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x71, 0x71, 0x00, 0x71, 0x71, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x79, 0x71, 0x79, 0x79, 0x01, 0x7a, 0x72, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f, 0xfb, 0x74, 0x75, 0x83, 0x75, 0x75, 0x75, 0x75, 0x85, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8c, 0x8f, 0x8f, 0x8f, 0x93, 0x93, 0x93, 0x96, 0x8f, 0x91, 0x93, 0x94, 0x93, 0x96, 0x93, 0x93, 0x91, 0x93, 0x96, 0x94, 0x95, 0x96, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x94, 0x91, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x94, 0x93, 0x92, 0x93, 0x91, 0x91, 0x8f, 0x91, 0x91, 0x91, 0x93, 0x94, 0x93, 0x92, 0x90, 0x8e, 0x8e, 0x8e, 0x8e, 0x90, 0x90, 0x8e, 0x8e, 0x8e, 0x94, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8f, 0x8f, 0x8d, 0x93, 0x99, 0x8f, 0x91, 0x8f, 0x91, 0x8f, 0x91, 0x8f, 0x8f, 0x8f, 0x8d, 0x8f, 0x8d, 0x8f, 0x8d, 0x8f, 0x8d, 0x8f, 0x8d, 0x8f, 0x8d, 0x8f, 0x93, 0x93, 0x91, 0x93, 0x91, 0x8f, 0x8f, 0x93, 0x93, 0x91, 0x8f, 0x8d, 0x8f, 0x8c, 0x8f, 0x8c, 0x8f, 0x8c, 0x8a, 0x8a, 0x89, 0x6f, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x83, 0x83, 0x81, 0x81, 0xfb, 0x74, 0x81, 0x72, 0x72, 0x7a, 0x79, 0x79, 0x79, 0x71, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x71, 0x71, 0x71, 0x79, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x79, 0x7a, 0x72, 0x7c, 0x72, 0x7c, 0x7c, 0x73, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x83, 0x84, 0x83, 0x87, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x8a, 0x8a, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x93, 0x8f, 0x93, 0x8f, 0x8f, 0x8f, 0x8f, 0x93, 0x93, 0x91, 0x8f, 0x93, 0x93, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x91, 0x91, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x90, 0x8c, 0x8c, 0x91, 0x8d, 0x8d, 0x8f, 0x93, 0x8a, 0x8d, 0x93, 0x93, 0x8d, 0x8a, 0x8f, 0x8d, 0x8f, 0x8c, 0x8f, 0x8c, 0x8f, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x87, 0x8a, 0x87, 0x87, 0x85, 0x85, 0x85, 0x75, 0x82, 0x81, 0x80, 0x74, 0x7f, 0x73, 0x7f, 0x73, 0x73, 0x73, 0x7c, 0x7c, 0x72, 0x7a, 0x7a, 0x79, 0x7a, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x71, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 
-  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x71, 0x7a, 0x79, 0x7a, 0x72, 0x72, 0x72, 0x72, 0x72, 0x7c, 0x72, 0x7c, 0x7b, 0x7c, 0x7d, 0x7c, 0x7d, 0x73, 0x7d, 0x7f, 0x7d, 0x7f, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x7f, 0x7f, 0x73, 0x7f, 0x7f, 0x7f, 0x73, 0x7f, 0x7d, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c, 0x7b, 0x72, 0x72, 0x72, 0x7a, 0x01, 0x7a, 0x79, 0x7a, 0x79, 0x71, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_img_dsc_t image16 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image16_map,
-};
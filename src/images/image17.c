@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE17
-#define LV_ATTRIBUTE_IMG_IMAGE17
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE17 uint8_t image17_map[] = {
-  0xfc, 0xfc, 0xfc, 0xff, 	/*Color of index 0*/
-  0x02, 0x02, 0x02, 0xff, 	/*Color of index 1*/
-  0xbc, 0xc5, 0xef, 0xff, 	/*Color of index 2*/
-  0xa3, 0xb8, 0xf5, 0xff, 	/*Color of index 3*/
-  0xad, 0xb2, 0xc3, 0xff, 	/*Color of index 4*/
-  0x9d, 0xab, 0xdf, 0xff, 	/*Color of index 5*/
-  0x89, 0x9f, 0xee, 0xff, 	/*Color of index 6*/
-  0xa1, 0xa8, 0xc5, 0xff, 	/*Color of index 7*/
-  0xa2, 0xa5, 0xb6, 0xff, 	/*Color of index 8*/
-  0x83, 0x9a, 0xd4, 0xff, 	/*Color of index 9*/
-  0x90, 0x9d, 0xbf, 0xff, 	/*Color of index 10*/
-  0x72, 0x90, 0xe9, 0xff, 	/*Color of index 11*/
-  0x76, 0x8c, 0xd0, 0xff, 	/*Color of index 12*/
-  0x89, 0x8e, 0xbf, 0xff, 	/*Color of index 13*/
-  0x8b, 0x8f, 0xa3, 0xff, 	/*Color of index 14*/
-  0x57, 0x7f, 0xe9, 0xff, 	/*Color of index 15*/
-  0x70, 0x82, 0xcf, 0xff, 	/*Color of index 16*/
-  0x5c, 0x7b, 0xd4, 0xff, 	/*Color of index 17*/
-  0x6b, 0x78, 0xbf, 0xff, 	/*Color of index 18*/
-  0x4f, 0x74, 0xd4, 0xff, 	/*Color of index 19*/
-  0x72, 0x7b, 0xab, 0xff, 	/*Color of index 20*/
-  0x3a, 0x6a, 0xf1, 0xff, 	/*Color of index 21*/
-  0x32, 0x69, 0xf6, 0xff, 	/*Color of index 22*/
-  0x4b, 0x6b, 0xdb, 0xff, 	/*Color of index 23*/
-  0x46, 0x66, 0xec, 0xff, 	/*Color of index 24*/
-  0x41, 0x65, 0xe0, 0xff, 	/*Color of index 25*/
-  0x74, 0x78, 0x89, 0xff, 	/*Color of index 26*/
-  0x52, 0x6a, 0xc1, 0xff, 	/*Color of index 27*/
-  0x2f, 0x63, 0xe1, 0xff, 	/*Color of index 28*/
-  0x4c, 0x63, 0xcf, 0xff, 	/*Color of index 29*/
-  0x2c, 0x59, 0xfa, 0xff, 	/*Color of index 30*/
-  0x2b, 0x5b, 0xed, 0xff, 	/*Color of index 31*/
-  0x5a, 0x69, 0xaa, 0xff, 	/*Color of index 32*/
-  0x29, 0x58, 0xf1, 0xff, 	/*Color of index 33*/
-  0x3d, 0x57, 0xec, 0xff, 	/*Color of index 34*/
-  0x24, 0x5c, 0xe2, 0xff, 	/*Color of index 35*/
-  0x44, 0x5a, 0xdd, 0xff, 	/*Color of index 36*/
-  0x3d, 0x5e, 0xd0, 0xff, 	/*Color of index 37*/
-  0x24, 0x58, 0xec, 0xff, 	/*Color of index 38*/
-  0x24, 0x54, 0xf3, 0xff, 	/*Color of index 39*/
-  0x31, 0x58, 0xdd, 0xff, 	/*Color of index 40*/
-  0x42, 0x5f, 0xbf, 0xff, 	/*Color of index 41*/
-  0x23, 0x54, 0xeb, 0xff, 	/*Color of index 42*/
-  0x2a, 0x53, 0xeb, 0xff, 	/*Color of index 43*/
-  0x3c, 0x53, 0xde, 0xff, 	/*Color of index 44*/
-  0x28, 0x54, 0xe0, 0xff, 	/*Color of index 45*/
-  0x4a, 0x59, 0xc1, 0xff, 	/*Color of index 46*/
-  0x35, 0x56, 0xce, 0xff, 	/*Color of index 47*/
-  0x1e, 0x50, 0xe9, 0xff, 	/*Color of index 48*/
-  0x22, 0x51, 0xe1, 0xff, 	/*Color of index 49*/
-  0x1b, 0x4a, 0xf6, 0xff, 	/*Color of index 50*/
-  0x27, 0x4b, 0xed, 0xff, 	/*Color of index 51*/
-  0x1f, 0x54, 0xd1, 0xff, 	/*Color of index 52*/
-  0x27, 0x4b, 0xe3, 0xff, 	/*Color of index 53*/
-  0x1a, 0x4a, 0xe6, 0xff, 	/*Color of index 54*/
-  0x30, 0x4c, 0xd7, 0xff, 	/*Color of index 55*/
-  0x3a, 0x50, 0xc3, 0xff, 	/*Color of index 56*/
-  0x3d, 0x53, 0xb1, 0xff, 	/*Color of index 57*/
-  0x1c, 0x49, 0xd9, 0xff, 	/*Color of index 58*/
-  0x56, 0x5c, 0x78, 0xff, 	/*Color of index 59*/
-  0x28, 0x46, 0xc4, 0xff, 	/*Color of index 60*/
-  0x39, 0x4f, 0x9a, 0xff, 	/*Color of index 61*/
-  0x17, 0x39, 0xee, 0xff, 	/*Color of index 62*/
-  0x26, 0x36, 0xed, 0xff, 	/*Color of index 63*/
-  0x32, 0x47, 0xaa, 0xff, 	/*Color of index 64*/
-  0x21, 0x39, 0xcf, 0xff, 	/*Color of index 65*/
-  0x2f, 0x42, 0x96, 0xff, 	/*Color of index 66*/
-  0x15, 0x2a, 0xe6, 0xff, 	/*Color of index 67*/
-  0x1b, 0x35, 0xa2, 0xff, 	/*Color of index 68*/
-  0x25, 0x37, 0x82, 0xff, 	/*Color of index 69*/
-  0x40, 0x43, 0x50, 0xff, 	/*Color of index 70*/
-  0x10, 0x1e, 0xd2, 0xff, 	/*Color of index 71*/
-  0x28, 0x37, 0x6d, 0xff, 	/*Color of index 72*/
-  0x18, 0x2a, 0x79, 0xff, 	/*Color of index 73*/
-  0x13, 0x21, 0x67, 0xff, 	/*Color of index 74*/
-  0x14, 0x21, 0x4f, 0xff, 	/*Color of index 75*/
-  0x26, 0x26, 0x27, 0xff, 	/*Color of index 76*/
-  0x14, 0x1b, 0x3a, 0xff, 	/*Color of index 77*/
-  0x0b, 0x15, 0x50, 0xff, 	/*Color of index 78*/
-  0x17, 0x1b, 0x27, 0xff, 	/*Color of index 79*/
-  0x08, 0x16, 0x3b, 0xff, 	/*Color of index 80*/
-  0x02, 0x09, 0x4b, 0xff, 	/*Color of index 81*/
-  0x0e, 0x10, 0x24, 0xff, 	/*Color of index 82*/
-  0x04, 0x09, 0x35, 0xff, 	/*Color of index 83*/
-  0x0a, 0x09, 0x1e, 0xff, 	/*Color of index 84*/
-  0x01, 0x03, 0x27, 0xff, 	/*Color of index 85*/
-  0x01, 0x01, 0x1a, 0xff, 	/*Color of index 86*/
-  0x01, 0x00, 0x12, 0xff, 	/*Color of index 87*/
-  0x01, 0x00, 0x08, 0xff, 	/*Color of index 88*/
-  0xf4, 0xf7, 0xfa, 0xff, 	/*Color of index 89*/
-  0xdf, 0xf3, 0xfd, 0xff, 	/*Color of index 90*/
-  0xdf, 0xe8, 0xfd, 0xff, 	/*Color of index 91*/
-  0x75, 0xe1, 0xfc, 0xff, 	/*Color of index 92*/
-  0xc7, 0xd9, 0xfa, 0xff, 	/*Color of index 93*/
-  0x20, 0xda, 0xfa, 0xff, 	/*Color of index 94*/
-  0x59, 0xd4, 0xf9, 0xff, 	/*Color of index 95*/
-  0x72, 0xca, 0xf2, 0xff, 	/*Color of index 96*/
-  0x2e, 0xcd, 0xf4, 0xff, 	/*Color of index 97*/
-  0x4c, 0xc8, 0xf8, 0xff, 	/*Color of index 98*/
-  0x32, 0xbf, 0xf4, 0xff, 	/*Color of index 99*/
-  0x4b, 0xba, 0xf7, 0xff, 	/*Color of index 100*/
-  0x60, 0xb5, 0xed, 0xff, 	/*Color of index 101*/
-  0x1f, 0xb5, 0xfb, 0xff, 	/*Color of index 102*/
-  0x7e, 0xab, 0xfc, 0xff, 	/*Color of index 103*/
-  0x1d, 0xb7, 0xed, 0xff, 	/*Color of index 104*/
-  0x30, 0xb0, 0xf9, 0xff, 	/*Color of index 105*/
-  0x68, 0xad, 0xcd, 0xff, 	/*Color of index 106*/
-  0x2e, 0xab, 0xe7, 0xff, 	/*Color of index 107*/
-  0x4c, 0xa2, 0xf7, 0xff, 	/*Color of index 108*/
-  0x49, 0xa7, 0xd2, 0xff, 	/*Color of index 109*/
-  0x5a, 0x95, 0xf5, 0xff, 	/*Color of index 110*/
-  0x3f, 0x94, 0xfa, 0xff, 	/*Color of index 111*/
-  0x2a, 0xa0, 0xd6, 0xff, 	/*Color of index 112*/
-  0x38, 0x8e, 0xfa, 0xff, 	/*Color of index 113*/
-  0x14, 0x95, 0xea, 0xff, 	/*Color of index 114*/
-  0x2f, 0x92, 0xea, 0xff, 	/*Color of index 115*/
-  0x57, 0x8f, 0xe4, 0xff, 	/*Color of index 116*/
-  0x48, 0x8b, 0xee, 0xff, 	/*Color of index 117*/
-  0x32, 0x8a, 0xf7, 0xff, 	/*Color of index 118*/
-  0x5b, 0x8e, 0xd1, 0xff, 	/*Color of index 119*/
-  0x40, 0x98, 0xb8, 0xff, 	/*Color of index 120*/
-  0x3b, 0x84, 0xf6, 0xff, 	/*Color of index 121*/
-  0x74, 0x8e, 0xbd, 0xff, 	/*Color of index 122*/
-  0x2b, 0x83, 0xf5, 0xff, 	/*Color of index 123*/
-  0x31, 0x81, 0xf4, 0xff, 	/*Color of index 124*/
-  0x50, 0x85, 0xd9, 0xff, 	/*Color of index 125*/
-  0x42, 0x7b, 0xf6, 0xff, 	/*Color of index 126*/
-  0x2b, 0x89, 0xc7, 0xff, 	/*Color of index 127*/
-  0x35, 0x78, 0xfb, 0xff, 	/*Color of index 128*/
-  0x45, 0x7c, 0xe7, 0xff, 	/*Color of index 129*/
-  0x2a, 0x79, 0xfa, 0xff, 	/*Color of index 130*/
-  0x32, 0x79, 0xf3, 0xff, 	/*Color of index 131*/
-  0x2a, 0x76, 0xf0, 0xff, 	/*Color of index 132*/
-  0x3b, 0x74, 0xeb, 0xff, 	/*Color of index 133*/
-  0x39, 0x86, 0xaa, 0xff, 	/*Color of index 134*/
-  0x4a, 0x76, 0xc0, 0xff, 	/*Color of index 135*/
-  0x1d, 0x7d, 0xb7, 0xff, 	/*Color of index 136*/
-  0x28, 0x69, 0xf5, 0xff, 	/*Color of index 137*/
-  0x4c, 0x7b, 0xaa, 0xff, 	/*Color of index 138*/
-  0x2d, 0x67, 0xeb, 0xff, 	/*Color of index 139*/
-  0x31, 0x74, 0x93, 0xff, 	/*Color of index 140*/
-  0x1c, 0x6a, 0xa9, 0xff, 	/*Color of index 141*/
-  0x42, 0x65, 0xac, 0xff, 	/*Color of index 142*/
-  0x36, 0x59, 0x9c, 0xff, 	/*Color of index 143*/
-  0x31, 0x61, 0x82, 0xff, 	/*Color of index 144*/
-  0x20, 0x53, 0x87, 0xff, 	/*Color of index 145*/
-  0x38, 0x51, 0x69, 0xff, 	/*Color of index 146*/
-  0x2e, 0x48, 0x83, 0xff, 	/*Color of index 147*/
-  0x17, 0x49, 0x71, 0xff, 	/*Color of index 148*/
-  0x30, 0x3a, 0x48, 0xff, 	/*Color of index 149*/
-  0x15, 0x32, 0x65, 0xff, 	/*Color of index 150*/
-  0x14, 0x31, 0x58, 0xff, 	/*Color of index 151*/
-  0x0f, 0x2c, 0x44, 0xff, 	/*Color of index 152*/
-  0x04, 0x07, 0x01, 0xff, 	/*Color of index 153*/
-  0xfa, 0xf8, 0xf1, 0xff, 	/*Color of index 154*/
-  0xf1, 0xf3, 0xec, 0xff, 	/*Color of index 155*/
-  0x13, 0x11, 0x0a, 0xff, 	/*Color of index 156*/
-  0xef, 0xec, 0xe6, 0xff, 	/*Color of index 157*/
-  0xe7, 0xe4, 0xe3, 0xff, 	/*Color of index 158*/
-  0xe4, 0xde, 0xd6, 0xff, 	/*Color of index 159*/
-  0xdc, 0xd3, 0xc9, 0xff, 	/*Color of index 160*/
-  0xd4, 0xca, 0xbe, 0xff, 	/*Color of index 161*/
-  0xcc, 0xc3, 0xba, 0xff, 	/*Color of index 162*/
-  0xcf, 0xc1, 0xb1, 0xff, 	/*Color of index 163*/
-  0xcc, 0xbd, 0xb0, 0xff, 	/*Color of index 164*/
-  0xcb, 0xbb, 0xac, 0xff, 	/*Color of index 165*/
-  0xc4, 0xb9, 0xae, 0xff, 	/*Color of index 166*/
-  0xc5, 0xba, 0xa2, 0xff, 	/*Color of index 167*/
-  0xc1, 0xb4, 0xaa, 0xff, 	/*Color of index 168*/
-  0xc2, 0xb2, 0x9f, 0xff, 	/*Color of index 169*/
-  0xb4, 0xad, 0xab, 0xff, 	/*Color of index 170*/
-  0xba, 0xae, 0x9c, 0xff, 	/*Color of index 171*/
-  0xb3, 0xa9, 0x9d, 0xff, 	/*Color of index 172*/
-  0xb9, 0xaa, 0x90, 0xff, 	/*Color of index 173*/
-  0xb2, 0xa3, 0x93, 0xff, 	/*Color of index 174*/
-  0xa6, 0x9e, 0x9a, 0xff, 	/*Color of index 175*/
-  0xb2, 0xa2, 0x88, 0xff, 	/*Color of index 176*/
-  0xaa, 0x9a, 0x8c, 0xff, 	/*Color of index 177*/
-  0xab, 0x99, 0x81, 0xff, 	/*Color of index 178*/
-  0xa4, 0x93, 0x82, 0xff, 	/*Color of index 179*/
-  0x98, 0x8f, 0x87, 0xff, 	/*Color of index 180*/
-  0xa1, 0x8f, 0x7b, 0xff, 	/*Color of index 181*/
-  0xa1, 0x8e, 0x74, 0xff, 	/*Color of index 182*/
-  0x9d, 0x8c, 0x7a, 0xff, 	/*Color of index 183*/
-  0x9c, 0x89, 0x74, 0xff, 	/*Color of index 184*/
-  0x8c, 0x83, 0x78, 0xff, 	/*Color of index 185*/
-  0x96, 0x83, 0x6f, 0xff, 	/*Color of index 186*/
-  0x86, 0x7c, 0x73, 0xff, 	/*Color of index 187*/
-  0x8e, 0x7b, 0x67, 0xff, 	/*Color of index 188*/
-  0x7c, 0x75, 0x6b, 0xff, 	/*Color of index 189*/
-  0x87, 0x74, 0x62, 0xff, 	/*Color of index 190*/
-  0x82, 0x6f, 0x5c, 0xff, 	/*Color of index 191*/
-  0x72, 0x6b, 0x66, 0xff, 	/*Color of index 192*/
-  0xa7, 0x77, 0x28, 0xff, 	/*Color of index 193*/
-  0x7a, 0x69, 0x58, 0xff, 	/*Color of index 194*/
-  0x8f, 0x6c, 0x37, 0xff, 	/*Color of index 195*/
-  0xa7, 0x72, 0x1a, 0xff, 	/*Color of index 196*/
-  0xb1, 0x75, 0x0b, 0xff, 	/*Color of index 197*/
-  0xa8, 0x72, 0x10, 0xff, 	/*Color of index 198*/
-  0x74, 0x62, 0x51, 0xff, 	/*Color of index 199*/
-  0xa6, 0x6d, 0x17, 0xff, 	/*Color of index 200*/
-  0x9b, 0x6a, 0x16, 0xff, 	/*Color of index 201*/
-  0x65, 0x5c, 0x54, 0xff, 	/*Color of index 202*/
-  0x9d, 0x6a, 0x0a, 0xff, 	/*Color of index 203*/
-  0x8f, 0x64, 0x21, 0xff, 	/*Color of index 204*/
-  0x6c, 0x5a, 0x49, 0xff, 	/*Color of index 205*/
-  0x83, 0x5e, 0x29, 0xff, 	/*Color of index 206*/
-  0x98, 0x61, 0x14, 0xff, 	/*Color of index 207*/
-  0x9b, 0x63, 0x0a, 0xff, 	/*Color of index 208*/
-  0x93, 0x62, 0x0d, 0xff, 	/*Color of index 209*/
-  0x66, 0x53, 0x41, 0xff, 	/*Color of index 210*/
-  0x5b, 0x51, 0x49, 0xff, 	/*Color of index 211*/
-  0x91, 0x5b, 0x0f, 0xff, 	/*Color of index 212*/
-  0x70, 0x52, 0x25, 0xff, 	/*Color of index 213*/
-  0x5b, 0x4a, 0x3a, 0xff, 	/*Color of index 214*/
-  0x80, 0x52, 0x0b, 0xff, 	/*Color of index 215*/
-  0x53, 0x42, 0x33, 0xff, 	/*Color of index 216*/
-  0x65, 0x44, 0x1b, 0xff, 	/*Color of index 217*/
-  0x6e, 0x45, 0x0a, 0xff, 	/*Color of index 218*/
-  0x71, 0x45, 0x02, 0xff, 	/*Color of index 219*/
-  0x48, 0x3b, 0x30, 0xff, 	/*Color of index 220*/
-  0x56, 0x3c, 0x1f, 0xff, 	/*Color of index 221*/
-  0x69, 0x40, 0x09, 0xff, 	/*Color of index 222*/
-  0x69, 0x41, 0x05, 0xff, 	/*Color of index 223*/
-  0x5e, 0x3d, 0x13, 0xff, 	/*Color of index 224*/
-  0x6b, 0x3b, 0x11, 0xff, 	/*Color of index 225*/
-  0x65, 0x3d, 0x09, 0xff, 	/*Color of index 226*/
-  0x65, 0x3d, 0x03, 0xff, 	/*Color of index 227*/
-  0x41, 0x33, 0x29, 0xff, 	/*Color of index 228*/
-  0x57, 0x37, 0x11, 0xff, 	/*Color of index 229*/
-  0x5f, 0x39, 0x06, 0xff, 	/*Color of index 230*/
-  0x49, 0x32, 0x1b, 0xff, 	/*Color of index 231*/
-  0x3b, 0x2b, 0x1f, 0xff, 	/*Color of index 232*/
-  0x33, 0x29, 0x23, 0xff, 	/*Color of index 233*/
-  0x3e, 0x29, 0x11, 0xff, 	/*Color of index 234*/
-  0x32, 0x24, 0x19, 0xff, 	/*Color of index 235*/
-  0x2c, 0x20, 0x17, 0xff, 	/*Color of index 236*/
-  0x29, 0x1d, 0x18, 0xff, 	/*Color of index 237*/
-  0x28, 0x1c, 0x13, 0xff, 	/*Color of index 238*/
-  0x25, 0x1a, 0x18, 0xff, 	/*Color of index 239*/
-  0x2b, 0x1b, 0x0c, 0xff, 	/*Color of index 240*/
-  0x1c, 0x19, 0x17, 0xff, 	/*Color of index 241*/
-  0x24, 0x19, 0x13, 0xff, 	/*Color of index 242*/
-  0x22, 0x18, 0x0c, 0xff, 	/*Color of index 243*/
-  0x21, 0x16, 0x11, 0xff, 	/*Color of index 244*/
-  0x1d, 0x13, 0x10, 0xff, 	/*Color of index 245*/
-  0x21, 0x14, 0x0a, 0xff, 	/*Color of index 246*/
-  0x1c, 0x11, 0x0b, 0xff, 	/*Color of index 247*/
-  0x16, 0x0c, 0x0a, 0xff, 	/*Color of index 248*/
-  0x14, 0x0a, 0x04, 0xff, 	/*Color of index 249*/
-  0x12, 0x04, 0x01, 0xff, 	/*Color of index 250*/
-  0x08, 0x02, 0x01, 0xff, 	/*Color of index 251*/
-  0xc2, 0xbd, 0xbf, 0xff, 	/*Color of index 252*/
-  0xf5, 0xf1, 0xfa, 0xff, 	/*Color of index 253*/
-  0xa6, 0xa2, 0xa8, 0xff, 	/*Color of index 254*/
-  0x09, 0x06, 0x0a, 0xff, 	/*Color of index 255*/
-
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x99, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xfb, 0x99, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x58, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x58, 0x01, 0x58, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0xff, 0x01, 0xff, 0x01, 0x58, 0x01, 0x58, 0x01, 0x01, 0x58, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x58, 0x58, 0x58, 0x58, 0x58, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x57, 0x52, 0x98, 0x95, 0x46, 0x46, 0x92, 0x92, 0x92, 0x92, 0x46, 0x92, 0x95, 0x95, 0x4c, 0x4f, 0xff, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0x57, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfa, 0x99, 0x01, 0xfb, 0xff, 0x57, 0x58, 0x01, 0x58, 0x52, 0x94, 0x8c, 0x78, 0x6d, 0x6a, 0x65, 0x60, 0x60, 0x60, 0x5f, 0x5c, 0x5f, 0x5c, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x6a, 0x78, 0x86, 0x92, 0x98, 0x54, 0x01, 0x58, 0x58, 0x57, 0xff, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfa, 0xfb, 0x99, 0xf9, 0xff, 0x58, 0x58, 0x52, 0x97, 0x78, 0x60, 0x5c, 0x62, 0x61, 0x61, 0x62, 0x62, 0x69, 0x64, 0x62, 0x62, 0x61, 0x5f, 0x63, 0x5f, 0x5f, 0x5f, 0x5c, 0x5f, 0x5c, 0x5c, 0x5c, 0x5f, 0x5c, 0x5c, 0x60, 0x78, 0x91, 0x50, 0x57, 0x01, 0x58, 0xff, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0x58, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0xff, 0x99, 0x01, 0xff, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x99, 0x99, 0x01, 0x4d, 0x90, 0x65, 0x60, 0x5c, 0x60, 0x62, 0x62, 0x63, 0x68, 0x63, 0x68, 0x63, 0x62, 0x5f, 0x62, 0x65, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x63, 0x61, 0x61, 0x61, 0x61, 0x5f, 0x62, 0x5c, 0x5f, 0x5c, 0x5c, 0x65, 0x86, 0x97, 0xff, 0x58, 0x58, 0xff, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xff, 0x99, 0x99, 0x98, 0x78, 0x60, 0x61, 0x60, 0x60, 0x6a, 0x6a, 0x6d, 0x64, 0x69, 0x63, 0x68, 0x61, 0x6d, 0x86, 0x90, 0x90, 0x90, 0x86, 0x6d, 0x63, 0x68, 0x6b, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x61, 0x5c, 0x5f, 0x5f, 0x62, 0x5f, 0x65, 0x8c, 0x98, 0x01, 0xff, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x4f, 0x86, 0x5f, 0x63, 0x61, 0x5f, 0x86, 0x95, 0x98, 0x96, 0x6b, 0x64, 0x69, 0x68, 0x6d, 0x90, 0x99, 0xff, 0x01, 0x01, 0x54, 0x94, 0x78, 0x64, 0x6b, 0x68, 0x68, 0x68, 0x6b, 0x6b, 0x7f, 0x94, 0x92, 0x8c, 0x6d, 0x68, 0x64, 0x62, 0x60, 0x6d, 0x98, 0xff, 0x01, 0x99, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x01, 0x01, 0x01, 0x99, 0x99, 0x01, 0x01, 0xf8, 0x4c, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xff, 0xfb, 0x01, 0x98, 0x6a, 0x62, 0x63, 0x63, 0x78, 0x54, 0x58, 0x56, 0x94, 0x64, 0x69, 0x69, 0x64, 0x78, 0x50, 0x57, 0x54, 0x01, 0x57, 0x56, 0x56, 0x91, 0x65, 0x64, 0x68, 0x68, 0x68, 0x66, 0x64, 0x7f, 0x55, 0x56, 0x54, 0x91, 0x65, 0x6b, 0x68, 0x6b, 0x62, 0x78, 0x4f, 0x58, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x1a, 0xf1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfa, 0x58, 0x58, 0x92, 0x60, 0x69, 0x63, 0x62, 0x90, 0x57, 0x57, 0x55, 0x8a, 0x62, 0x66, 0x69, 0x64, 0x88, 0x55, 0x56, 0x4f, 0x98, 0x98, 0x54, 0x56, 0x50, 0x88, 0x64, 0x63, 0x68, 0x68, 0x69, 0x69, 0x67, 0x97, 0x56, 0x56, 0x91, 0x6d, 0x6b, 0x69, 0x72, 0x6b, 0x65, 0x94, 0xff, 0x58, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x99, 0xff, 0xff, 0x01, 0x4f, 0xbd, 0x52, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0x54, 0x8a, 0x60, 0x64, 0x66, 0x64, 0x6a, 0x56, 0x58, 0x50, 0x78, 0x61, 0x68, 0x68, 0x64, 0x70, 0x93, 0x97, 0x86, 0x60, 0x60, 0x92, 0x57, 0x56, 0x91, 0x63, 0x68, 0x63, 0x68, 0x69, 0x64, 0x65, 0x94, 0x57, 0x56, 0x94, 0x6d, 0x66, 0x72, 0x72, 0x70, 0x6b, 0x86, 0x52, 0x01, 0x01, 0xfa, 0xfb, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0xfa, 0x01, 0x01, 0x58, 0x4c, 0x1a, 0xff, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x4d, 0x6d, 0x64, 0x69, 0x64, 0x64, 0x65, 0x56, 0x58, 0x4b, 0x6d, 0x61, 0x68, 0x63, 0x69, 0x69, 0x62, 0x64, 0x60, 0x60, 0x6a, 0x92, 0x52, 0x57, 0x94, 0x6b, 0x63, 0x68, 0x68, 0x66, 0x68, 0x64, 0x90, 0x58, 0x54, 0x94, 0x6b, 0x6b, 0x72, 0x72, 0x6c, 0x6c, 0x86, 0x4b, 0x01, 0x01, 0xf9, 0x01, 0x99, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x99, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0x58, 0xff, 0x58, 0x95, 0x7a, 0x46, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x99, 0x95, 0x62, 0x64, 0x69, 0x66, 0x64, 0x6a, 0x58, 0x57, 0x98, 0x63, 0x62, 0x68, 0x68, 0x69, 0x69, 0x69, 0x64, 0x60, 0x86, 0x50, 0x54, 0x92, 0x56, 0x94, 0x6b, 0x63, 0x68, 0x66, 0x63, 0x6b, 0x61, 0x8c, 0xff, 0x54, 0x46, 0x70, 0x6b, 0x72, 0x72, 0x72, 0x73, 0x6d, 0x96, 0x57, 0x01, 0x99, 0x99, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xff, 0xfb, 0xfb, 0xff, 0xfa, 0x58, 0xff, 0x56, 0x4f, 0x92, 0x8a, 0x8c, 0x01, 0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x90, 0x5f, 0x63, 0x66, 0x69, 0x62, 0x78, 0x01, 0x57, 0x48, 0x62, 0x6b, 0x68, 0x69, 0x69, 0x64, 0x65, 0x65, 0x8a, 0x50, 0x57, 0x90, 0x7a, 0x97, 0x90, 0x64, 0x63, 0x6b, 0x69, 0x69, 0x69, 0x61, 0x86, 0x99, 0x54, 0x97, 0x70, 0x6b, 0x72, 0x72, 0x72, 0x73, 0x6c, 0x8f, 0x54, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xfb, 0xfb, 0xff, 0xff, 0x58, 0x57, 0x56, 0x90, 0x7a, 0x8c, 0x96, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x58, 0x01, 0x8c, 0x5f, 0x63, 0x66, 0x69, 0x5f, 0x90, 0x58, 0xff, 0x91, 0x60, 0x69, 0x69, 0x63, 0x6b, 0x64, 0x64, 0x8c, 0x50, 0x58, 0x48, 0x6a, 0x09, 0x8d, 0x65, 0x64, 0x63, 0x66, 0x69, 0x69, 0x63, 0x68, 0x78, 0xff, 0x54, 0x4b, 0x70, 0x70, 0x6b, 0x72, 0x72, 0x72, 0x6c, 0x86, 0x55, 0x58, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x99, 0x01, 0x01, 0x01, 0x58, 0x58, 0x56, 0x92, 0x8c, 0x7f, 0x78, 0x58, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfa, 0x54, 0x78, 0x5f, 0x68, 0x66, 0x69, 0x5f, 0x94, 0x01, 0x54, 0x90, 0x60, 0x69, 0x68, 0x69, 0x63, 0x62, 0x8c, 0x4d, 0x56, 0x50, 0x0a, 0x65, 0x93, 0x91, 0x69, 0x63, 0x68, 0x66, 0x69, 0x69, 0x66, 0x61, 0x78, 0xff, 0x56, 0x4b, 0x77, 0x6b, 0x72, 0x72, 0x72, 0x72, 0x73, 0x77, 0x50, 0x57, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xff, 0x99, 0x01, 0x01, 0x95, 0x92, 0x98, 0x8c, 0x86, 0x6d, 0x60, 0x54, 0xf1, 0x01, 0xed, 0xe4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x58, 0x01, 0x58, 0x01, 0x58, 0x01, 0x58, 0x01, 0x58, 0x01, 0x58, 0x58, 0x52, 0x65, 0x61, 0x66, 0x66, 0x64, 0x60, 0x98, 0x57, 0x52, 0x8a, 0x60, 0x69, 0x63, 0x66, 0x60, 0x88, 0x50, 0x56, 0x54, 0x8c, 0x6a, 0x93, 0x51, 0x7f, 0x62, 0x68, 0x61, 0x68, 0x66, 0x66, 0x68, 0x61, 0x78, 0x4f, 0xfa, 0x4b, 0x78, 0x6b, 0x70, 0x72, 0x72, 0x72, 0x73, 0x70, 0x97, 0x57, 0x01, 0xfa, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xff, 0x01, 0x01, 0x46, 0x9c, 0x99, 0x92, 0x6a, 0x6a, 0x65, 0x65, 0x88, 0x70, 0x1a, 0x4f, 0x01, 0x4c, 0xe4, 0xff, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0x01, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x58, 0x58, 0x58, 0x01, 0x58, 0x57, 0x4d, 0x5f, 0x66, 0x66, 0x66, 0x64, 0x6d, 0x52, 0x56, 0x52, 0x6d, 0x62, 0x6b, 0x68, 0x68, 0x63, 0x48, 0x56, 0x53, 0x95, 0x77, 0x94, 0x53, 0x8d, 0x63, 0x63, 0x63, 0x68, 0x61, 0x68, 0x63, 0x66, 0x61, 0x78, 0x4c, 0x57, 0x4d, 0x78, 0x6b, 0x70, 0x72, 0x72, 0x72, 0x72, 0x6c, 0x94, 0x57, 0xfb, 0xfa, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 0xff, 0x01, 0xe4, 0xff, 0x01, 0xff, 0x94, 0x86, 0x78, 0x7f, 0x88, 0x60, 0x90, 0x52, 0x01, 0xff, 0xf9, 0x99, 0x99, 0x01, 0x58, 0x58, 0x58, 0xfa, 0xfa, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x5f, 0x61, 0x68, 0x68, 0x5f, 0x6d, 0x4f, 0x56, 0x52, 0x60, 0x62, 0x63, 0x63, 0x61, 0x6d, 0x97, 0x56, 0x3b, 0x5c, 0x5d, 0x90, 0x91, 0x5c, 0x5c, 0x69, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x62, 0x78, 0x98, 0x57, 0x53, 0x88, 0x6b, 0x70, 0x72, 0x72, 0x72, 0x73, 0x70, 0x8c, 0x57, 0x58, 0xfa, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xff, 0x01, 0x01, 0xff, 0xfb, 0xfb, 0xfb, 0x57, 0x57, 0x94, 0x78, 0x97, 0x4a, 0x88, 0x5c, 0x52, 0x01, 0xff, 0x01, 0xfa, 0xfb, 0x01, 0x99, 0x58, 0x01, 0x58, 0xfb, 0xfa, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x99, 0x01, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x01, 0x01, 0x86, 0x5c, 0x68, 0x68, 0x63, 0x62, 0x8c, 0x54, 0x58, 0x4d, 0x65, 0x61, 0x6b, 0x68, 0x63, 0x78, 0x50, 0x50, 0x46, 0x90, 0x46, 0x98, 0x97, 0x8a, 0x78, 0x64, 0x66, 0x66, 0x66, 0x69, 0x6c, 0x69, 0x66, 0x6a, 0x98, 0x57, 0x53, 0x8a, 0x69, 0x72, 0x72, 0x72, 0x76, 0x72, 0x6c, 0x7f, 0x54, 0x58, 0xfa, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x58, 0x01, 0xff, 0xf8, 0xfb, 0xff, 0x57, 0x50, 0x90, 0x5f, 0x64, 0x7f, 0x70, 0x65, 0x8c, 0x58, 0xff, 0x9c, 0xfa, 0xfa, 0x99, 0x01, 0x01, 0x99, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x6a, 0x5f, 0x68, 0x66, 0x63, 0x62, 0x90, 0x52, 0x57, 0x98, 0x65, 0x64, 0x69, 0x64, 0x63, 0x7f, 0x53, 0x56, 0x55, 0x57, 0x58, 0x56, 0x56, 0x57, 0x91, 0x69, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x6d, 0x95, 0x01, 0x50, 0x8c, 0x6b, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d, 0x50, 0x58, 0xfb, 0xfa, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xff, 0x01, 0xfb, 0x58, 0xfa, 0x57, 0x58, 0x56, 0x92, 0x62, 0x6d, 0x63, 0x5f, 0x63, 0x97, 0x6a, 0x52, 0x01, 0xff, 0xfa, 0xfa, 0xf9, 0x01, 0x99, 0x01, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0x01, 0x58, 0xfb, 0x58, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0x57, 0x60, 0x62, 0x66, 0x66, 0x66, 0x64, 0x94, 0x53, 0x55, 0x96, 0x65, 0x63, 0x69, 0x69, 0x66, 0x70, 0x8d, 0x91, 0x91, 0x91, 0x90, 0x90, 0x91, 0x94, 0x8d, 0x6b, 0x63, 0x66, 0x68, 0x66, 0x69, 0x69, 0x68, 0x6a, 0x98, 0x01, 0x54, 0x8c, 0x6b, 0x72, 0x72, 0x76, 0x72, 0x72, 0x72, 0x6d, 0x96, 0x01, 0x58, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xff, 0xfb, 0x58, 0x58, 0x57, 0x94, 0x91, 0x63, 0x62, 0x63, 0x63, 0x61, 0x6d, 0x86, 0x57, 0x58, 0x58, 0xfb, 0xf9, 0xfb, 0xfb, 0x01, 0x99, 0x01, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x01, 0x53, 0x60, 0x63, 0x66, 0x66, 0x66, 0x69, 0x88, 0x88, 0x87, 0x7f, 0x64, 0x69, 0x66, 0x66, 0x66, 0x66, 0x64, 0x62, 0x64, 0x63, 0x61, 0x64, 0x62, 0x62, 0x63, 0x66, 0x66, 0x68, 0x68, 0x66, 0x69, 0x69, 0x68, 0x6d, 0x94, 0x53, 0x97, 0x7f, 0x6b, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x70, 0x91, 0x58, 0x57, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0xfb, 0x58, 0xff, 0x58, 0x52, 0x86, 0x88, 0x5c, 0x68, 0x61, 0x61, 0x5e, 0x5f, 0x62, 0x98, 0x52, 0xff, 0x58, 0xfa, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x50, 0x5c, 0x68, 0x66, 0x66, 0x66, 0x63, 0x63, 0x62, 0x60, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x63, 0x63, 0x64, 0x64, 0x63, 0x64, 0x66, 0x64, 0x69, 0x66, 0x69, 0x69, 0x66, 0x68, 0x69, 0x69, 0x69, 0x69, 0x6b, 0x7f, 0x86, 0x7f, 0x73, 0x6b, 0x73, 0x72, 0x7b, 0x72, 0x72, 0x72, 0x6b, 0x8c, 0x57, 0x57, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0xf1, 0xf8, 0x01, 0x01, 0x01, 0xff, 0x01, 0x4f, 0x86, 0x6a, 0x70, 0x5e, 0x61, 0x5e, 0x5e, 0x5e, 0x61, 0x5f, 0x6d, 0x8c, 0x56, 0xff, 0xe4, 0x52, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x99, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x5c, 0x63, 0x61, 0x63, 0x62, 0x63, 0x64, 0x62, 0x65, 0x64, 0x64, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x64, 0x63, 0x69, 0x69, 0x6c, 0x69, 0x64, 0x6c, 0x6c, 0x72, 0x73, 0x72, 0x7f, 0x72, 0x72, 0x72, 0x72, 0x70, 0x8a, 0x55, 0x58, 0x58, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0x95, 0xf1, 0x99, 0x4f, 0x9c, 0x01, 0xfb, 0x90, 0x5b, 0x60, 0x63, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x62, 0x6a, 0x97, 0x52, 0x46, 0xf1, 0x4c, 0x46, 0x95, 0xff, 0xfb, 0xff, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0xf9, 0xf9, 0x99, 0xfa, 0x01, 0xfb, 0x01, 0xf8, 0x99, 0xff, 0x01, 0x01, 0x01, 0x94, 0x60, 0x70, 0x7f, 0x70, 0x7f, 0x88, 0x88, 0x88, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x70, 0x78, 0x70, 0x73, 0x73, 0x6c, 0x6c, 0x6c, 0x6b, 0x6c, 0x6c, 0x6c, 0x73, 0x73, 0x7f, 0x73, 0x72, 0x72, 0x70, 0x7f, 0x53, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0xf8, 0x95, 0x4c, 0xff, 0x01, 0xc0, 0x5a, 0x5c, 0x63, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x6d, 0x60, 0x6a, 0x4c, 0x54, 0x01, 0x4f, 0x46, 0xd3, 0x54, 0xff, 0xff, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0x58, 0x57, 0x58, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x58, 0x58, 0x01, 0x58, 0x01, 0x01, 0x58, 0x58, 0x53, 0x96, 0x50, 0x51, 0x53, 0x51, 0x4e, 0x51, 0x4e, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4e, 0x4e, 0x4b, 0x4b, 0x97, 0x4a, 0x49, 0x49, 0x45, 0x94, 0x91, 0x8f, 0x8d, 0x8d, 0x88, 0x88, 0x74, 0x73, 0x70, 0x73, 0x70, 0x09, 0x4b, 0x57, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0xf8, 0xff, 0x99, 0xff, 0x01, 0x52, 0x0e, 0x78, 0x6a, 0x5f, 0x5e, 0x61, 0x5e, 0x61, 0x61, 0x5f, 0x78, 0x78, 0x0a, 0x4c, 0x01, 0xff, 0x9c, 0x58, 0x58, 0x58, 0xfb, 0xff, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x58, 0x01, 0x58, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x58, 0x58, 0x58, 0x57, 0x56, 0x55, 0x50, 0x4b, 0x96, 0x93, 0x93, 0x8f, 0x8f, 0x8d, 0x87, 0x87, 0x87, 0x11, 0x7f, 0x7d, 0x7d, 0x0b, 0x0f, 0x74, 0x0f, 0x0b, 0x10, 0x0b, 0x0f, 0x0b, 0x0f, 0x10, 0x11, 0x87, 0x8e, 0x8f, 0x91, 0x45, 0x96, 0x96, 0x97, 0x98, 0x4e, 0x4e, 0x51, 0x51, 0x51, 0x53, 0x51, 0x53, 0x51, 0x51, 0x4e, 0x4a, 0x45, 0x91, 0x8d, 0x87, 0x7f, 0x4b, 0x58, 0x01, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf1, 0x01, 0x01, 0x52, 0x78, 0x5f, 0x61, 0x63, 0x61, 0x63, 0x5f, 0x62, 0x98, 0x56, 0x58, 0x58, 0xff, 0x01, 0x01, 0x01, 0x01, 0xf8, 0xf8, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0x57, 0xff, 0x52, 0x52, 0x4d, 0x4a, 0x94, 0x90, 0x8e, 0x86, 0x7d, 0x6d, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x67, 0x75, 0x6c, 0x6e, 0x6e, 0x75, 0x6e, 0x71, 0x6f, 0x71, 0x75, 0x79, 0x71, 0x71, 0x71, 0x6f, 0x6f, 0x6c, 0x6e, 0x6c, 0x6c, 0x67, 0x65, 0x60, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x64, 0x64, 0x6c, 0x6c, 0x74, 0x70, 0x7f, 0x88, 0x8d, 0x8f, 0x91, 0x45, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x93, 0x4b, 0x58, 0xfb, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfa, 0xff, 0xfa, 0x58, 0xff, 0x97, 0x90, 0x63, 0x62, 0x63, 0x63, 0x63, 0x8a, 0x50, 0x52, 0x58, 0x01, 0xf9, 0xf9, 0x99, 0x9c, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x58, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfa, 0x99, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x57, 0x54, 0x50, 0x4b, 0x96, 0x93, 0x8d, 0x7a, 0x74, 0x6c, 0x67, 0x6c, 0x67, 0x6c, 0x6c, 0x6e, 0x6f, 0x6f, 0x6f, 0x76, 0x76, 0x7b, 0x6f, 0x7b, 0x6f, 0x7b, 0x79, 0x71, 0x79, 0x76, 0x76, 0x7c, 0x79, 0x79, 0x79, 0x76, 0x76, 0x76, 0x7b, 0x76, 0x7b, 0x71, 0x71, 0x6f, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x69, 0x6c, 0x69, 0x6c, 0x65, 0x6c, 0x69, 0x65, 0x64, 0x64, 0x65, 0x65, 0x67, 0x67, 0x6e, 0x7f, 0x8d, 0x40, 0x91, 0x4a, 0x55, 0x55, 0x57, 0x58, 0x58, 0x01, 0x58, 0x58, 0x58, 0x58, 0x01, 0x58, 0xfb, 0x01, 0xfb, 0xfb, 0x58, 0x58, 0x58, 0x01, 0x58, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0xff, 0xfb, 0xfb, 0xff, 0x58, 0x57, 0x98, 0x78, 0x62, 0x78, 0x8d, 0x94, 0x88, 0x94, 0x4d, 0x52, 0xff, 0xf8, 0xff, 0x99, 0x99, 0x99, 0x01, 0x01, 0x99, 0xfa, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x58, 0xfa, 0x58, 0xfb, 0xfb, 0xfb, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x99, 0xfa, 0xf9, 0xf9, 0xfa, 0xfa, 0x99, 0x01, 0x58, 0x58, 0x58, 0x57, 0x54, 0x4d, 0x97, 0x93, 0x8d, 0x87, 0x77, 0x6e, 0x6c, 0x6c, 0x6f, 0x6f, 0x71, 0x71, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x79, 0x76, 0x79, 0x76, 0x79, 0x79, 0x79, 0x79, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7b, 0x79, 0x71, 0x6f, 0x6f, 0x6f, 0x6c, 0x6c, 0x6c, 0x6c, 0x6f, 0x6c, 0x6f, 0x6c, 0x6f, 0x6f, 0x71, 0x71, 0x71, 0x71, 0x71, 0x6f, 0x6f, 0x6f, 0x6c, 0x6c, 0x6e, 0x13, 0x8e, 0x42, 0x45, 0x4b, 0x50, 0x54, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0xfb, 0xfb, 0x58, 0x58, 0x58, 0x58, 0x01, 0x01, 0xfb, 0x99, 0xfb, 0xfa, 0xfb, 0xfb, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x58, 0x58, 0x57, 0x4f, 0x8c, 0x65, 0x6d, 0x8c, 0x96, 0x90, 0x6a, 0x90, 0x01, 0x57, 0xff, 0xfa, 0xfb, 0x99, 0x99, 0x99, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x58, 0x58, 0x58, 0x58, 0xfb, 0x01, 0x01, 0x99, 0x01, 0x01, 0x58, 0xff, 0x58, 0x01, 0x01, 0x99, 0xfb, 0x01, 0x01, 0x58, 0x58, 0x56, 0x53, 0x97, 0x45, 0x8f, 0x87, 0x77, 0x6e, 0x6c, 0x6e, 0x6f, 0x6f, 0x71, 0x76, 0x73, 0x71, 0x71, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x71, 0x76, 0x71, 0x76, 0x71, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x79, 0x7b, 0x79, 0x79, 0x79, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x7e, 0x7c, 0x7e, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x79, 0x79, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x73, 0x71, 0x6f, 0x71, 0x71, 0x71, 0x71, 0x71, 0x6f, 0x71, 0x75, 0x6f, 0x6c, 0x6e, 0x6e, 0x74, 0x77, 0x87, 0x8e, 0x91, 0x48, 0x98, 0x53, 0x54, 0x56, 0x58, 0x01, 0x58, 0x01, 0x01, 0xff, 0x58, 0xff, 0xfb, 0xfb, 0xfa, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x58, 0x01, 0x58, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0xfb, 0x57, 0x58, 0x52, 0x90, 0x78, 0x90, 0x86, 0x91, 0x94, 0x5a, 0x78, 0xf8, 0x57, 0xff, 0xfb, 0xf9, 0x01, 0x99, 0x99, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x58, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0x58, 0x01, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x55, 0x4b, 0x93, 0x20, 0x7d, 0x74, 0x6f, 0x6e, 0x6f, 0x76, 0x75, 0x76, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x71, 0x71, 0x71, 0x71, 0x76, 0x71, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x79, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x79, 0x79, 0x7c, 0x79, 0x7e, 0x79, 0x7e, 0x80, 0x7e, 0x80, 0x7e, 0x80, 0x80, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x75, 0x6f, 0x6f, 0x6c, 0x6f, 0x6f, 0x76, 0x71, 0x71, 0x71, 0x6f, 0x71, 0x71, 0x71, 0x76, 0x71, 0x73, 0x76, 0x73, 0x71, 0x73, 0x6f, 0x74, 0x6e, 0x74, 0x6e, 0x6e, 0x6e, 0x6e, 0x74, 0x7d, 0x8a, 0x20, 0x91, 0x97, 0x4d, 0x54, 0x57, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x58, 0x58, 0x57, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfa, 0xfb, 0x57, 0x4f, 0x0e, 0x86, 0x4d, 0x97, 0x98, 0x90, 0x0a, 0x90, 0x58, 0xff, 0xfa, 0xfb, 0xfb, 0x99, 0x01, 0x99, 0x01, 0xfb, 0x58, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x99, 0x01, 0x58, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0x01, 0x01, 0xff, 0x56, 0x58, 0x56, 0x50, 0x96, 0x8f, 0x77, 0x6e, 0x6e, 0x75, 0x76, 0x7b, 0x7b, 0x7b, 0x76, 0x71, 0x76, 0x76, 0x71, 0x71, 0x76, 0x71, 0x76, 0x71, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x79, 0x76, 0x79, 0x79, 0x79, 0x7c, 0x80, 0x7e, 0x80, 0x7c, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x84, 0x84, 0x83, 0x7c, 0x79, 0x71, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x6f, 0x73, 0x71, 0x73, 0x75, 0x76, 0x76, 0x76, 0x76, 0x6f, 0x6e, 0x6c, 0x74, 0x6d, 0x77, 0x86, 0x8e, 0x94, 0x97, 0x52, 0x56, 0x58, 0x01, 0x58, 0x58, 0x58, 0x58, 0x57, 0x58, 0x58, 0x58, 0x58, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xfb, 0xfa, 0xfb, 0x58, 0xff, 0x4f, 0x98, 0x52, 0x92, 0x92, 0x52, 0x4f, 0xff, 0x01, 0x58, 0xfb, 0xf8, 0xfb, 0x01, 0x99, 0x01, 0x01, 0x58, 0xfb, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x99, 0x01, 0x58, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfa, 0x58, 0x58, 0x58, 0x55, 0x96, 0x20, 0x7d, 0x6e, 0x6e, 0x81, 0x0f, 0x79, 0x79, 0x79, 0x76, 0x7b, 0x76, 0x7b, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x71, 0x76, 0x71, 0x76, 0x71, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7e, 0x7c, 0x7e, 0x7c, 0x7e, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x7e, 0x83, 0x83, 0x7e, 0x83, 0x7e, 0x83, 0x83, 0x84, 0x7e, 0x84, 0x85, 0x85, 0x84, 0x7e, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x76, 0x76, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x76, 0x76, 0x76, 0x76, 0x71, 0x76, 0x76, 0x76, 0x71, 0x71, 0x76, 0x76, 0x73, 0x75, 0x6e, 0x6e, 0x6c, 0x6e, 0x77, 0x87, 0x90, 0x96, 0x50, 0x55, 0x58, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xfa, 0xfb, 0x58, 0x01, 0x58, 0x01, 0x1a, 0x1a, 0x58, 0x58, 0x01, 0x54, 0xff, 0xfb, 0xfa, 0xfb, 0x99, 0x01, 0x99, 0x01, 0x58, 0x58, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x01, 0x58, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x57, 0x97, 0x20, 0x74, 0x74, 0x75, 0x81, 0x7c, 0x81, 0x7c, 0x79, 0x79, 0x76, 0x79, 0x71, 0x79, 0x79, 0x7b, 0x7b, 0x76, 0x76, 0x76, 0x7b, 0x76, 0x76, 0x76, 0x76, 0x7c, 0x76, 0x7c, 0x79, 0x7c, 0x81, 0x7c, 0x81, 0x7c, 0x81, 0x7c, 0x83, 0x7c, 0x83, 0x7c, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x83, 0x7e, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x83, 0x7c, 0x83, 0x84, 0x80, 0x84, 0x85, 0x84, 0x15, 0x84, 0x83, 0x79, 0x79, 0x71, 0x71, 0x71, 0x71, 0x76, 0x71, 0x76, 0x76, 0x76, 0x76, 0x76, 0x71, 0x71, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7b, 0x76, 0x76, 0x76, 0x76, 0x7b, 0x76, 0x79, 0x76, 0x71, 0x6c, 0x6e, 0x6c, 0x7d, 0x8e, 0x91, 0x4b, 0x53, 0x58, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0xff, 0x99, 0x9c, 0xbd, 0x95, 0x01, 0x58, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xfa, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x58, 0x58, 0x01, 0x01, 0xf9, 0x99, 0x99, 0x99, 0xfb, 0x58, 0x57, 0x52, 0x8f, 0x0c, 0x74, 0x7d, 0x79, 0x7e, 0x7c, 0x80, 0x7c, 0x7e, 0x83, 0x7e, 0x79, 0x79, 0x79, 0x81, 0x7c, 0x81, 0x79, 0x79, 0x79, 0x79, 0x76, 0x81, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x81, 0x75, 0x0f, 0x79, 0x81, 0x81, 0x83, 0x81, 0x7e, 0x83, 0x80, 0x83, 0x80, 0x84, 0x80, 0x84, 0x82, 0x80, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x83, 0x83, 0x85, 0x84, 0x15, 0x16, 0x80, 0x89, 0x85, 0x89, 0x85, 0x89, 0x85, 0x84, 0x85, 0x83, 0x85, 0x79, 0x79, 0x79, 0x79, 0x79, 0x76, 0x79, 0x7b, 0x79, 0x79, 0x76, 0x76, 0x71, 0x76, 0x76, 0x71, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7b, 0x7b, 0x7c, 0x7b, 0x76, 0x71, 0x6f, 0x6f, 0x6e, 0x74, 0x74, 0x8a, 0x91, 0x4b, 0x52, 0x57, 0x58, 0x01, 0x58, 0x01, 0x58, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x99, 0x01, 0x52, 0xca, 0xf1, 0x01, 0x01, 0x58, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x58, 0x01, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x58, 0xfb, 0x58, 0xfb, 0x99, 0x99, 0x01, 0x99, 0x99, 0x01, 0x56, 0x4b, 0x8e, 0x74, 0x7d, 0x79, 0x83, 0x82, 0x84, 0x82, 0x82, 0x82, 0x82, 0x80, 0x83, 0x7e, 0x83, 0x81, 0x79, 0x75, 0x6e, 0x74, 0x74, 0x74, 0x77, 0x7d, 0x77, 0x7d, 0x7d, 0x7d, 0x11, 0x7d, 0x87, 0x87, 0x87, 0x87, 0x87, 0x11, 0x11, 0x11, 0x7d, 0x11, 0x7d, 0x7d, 0x7d, 0x75, 0x7d, 0x75, 0x0f, 0x0f, 0x0f, 0x79, 0x0f, 0x80, 0x85, 0x84, 0x15, 0x84, 0x89, 0x83, 0x80, 0x84, 0x83, 0x83, 0x83, 0x84, 0x16, 0x80, 0x16, 0x15, 0x84, 0x16, 0x84, 0x16, 0x84, 0x15, 0x84, 0x8b, 0x84, 0x15, 0x85, 0x15, 0x15, 0x8b, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x80, 0x16, 0x80, 0x80, 0x83, 0x7e, 0x79, 0x79, 0x79, 0x76, 0x79, 0x76, 0x79, 0x76, 0x76, 0x76, 0x76, 0x7b, 0x7b, 0x76, 0x79, 0x71, 0x75, 0x74, 0x74, 0x06, 0x77, 0x87, 0x94, 0x4a, 0x52, 0x58, 0x57, 0x57, 0x57, 0x58, 0xff, 0x58, 0x01, 0xfb, 0xfa, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x9c, 0xdc, 0xf1, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x58, 0xfb, 0x58, 0xfb, 0xfb, 0xfb, 0x99, 0x01, 0x01, 0x58, 0x54, 0x48, 0x13, 0x75, 0x85, 0x84, 0x82, 0x84, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x79, 0x79, 0x71, 0x71, 0x71, 0x75, 0x13, 0x87, 0x8e, 0x8f, 0x3d, 0x91, 0x48, 0x48, 0x96, 0x98, 0x4b, 0x4b, 0x4d, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4d, 0x50, 0x4d, 0x4d, 0x50, 0x4b, 0x4b, 0x96, 0x48, 0x45, 0x93, 0x3d, 0x8f, 0x8e, 0x1b, 0x11, 0x7d, 0x0f, 0x7e, 0x0f, 0x79, 0x7e, 0x85, 0x85, 0x15, 0x80, 0x16, 0x89, 0x89, 0x16, 0x80, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x16, 0x85, 0x89, 0x15, 0x89, 0x8b, 0x85, 0x15, 0x23, 0x23, 0x2d, 0x2d, 0x31, 0x31, 0x31, 0x31, 0x2a, 0x2d, 0x26, 0x2d, 0x1f, 0x1f, 0x1f, 0x16, 0x15, 0x15, 0x83, 0x83, 0x7c, 0x7b, 0x76, 0x71, 0x71, 0x79, 0x76, 0x79, 0x76, 0x79, 0x76, 0x76, 0x76, 0x76, 0x6f, 0x6e, 0x6f, 0x77, 0x20, 0x92, 0x4b, 0x56, 0x58, 0x56, 0x57, 0x57, 0x58, 0xff, 0xfb, 0xfa, 0xfa, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x99, 0x4c, 0x9c, 0x01, 0xfb, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x58, 0xfb, 0x58, 0xfb, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0xfb, 0xfb, 0xfb, 0xfb, 0x99, 0xff, 0x57, 0x53, 0x93, 0x7d, 0x7e, 0x89, 0x82, 0x82, 0x84, 0x82, 0x82, 0x84, 0x79, 0x75, 0x74, 0x7d, 0x13, 0x8f, 0x42, 0x45, 0x4a, 0x4e, 0x50, 0x55, 0x57, 0x58, 0x58, 0xfb, 0x99, 0xfa, 0xf7, 0xf5, 0xf3, 0xef, 0xec, 0xeb, 0xec, 0xec, 0xed, 0xed, 0xed, 0xee, 0xef, 0xf4, 0xf5, 0xf8, 0xff, 0xff, 0x58, 0x57, 0x57, 0x56, 0x55, 0x50, 0x4d, 0x97, 0x48, 0x40, 0x8e, 0x1d, 0x10, 0x0f, 0x0f, 0x7e, 0x15, 0x15, 0x16, 0x16, 0x89, 0x16, 0x84, 0x16, 0x84, 0x16, 0x16, 0x89, 0x15, 0x89, 0x16, 0x89, 0x15, 0x89, 0x16, 0x1f, 0x23, 0x2d, 0x2d, 0x2a, 0x31, 0x2b, 0x2a, 0x30, 0x2a, 0x31, 0x31, 0x30, 0x33, 0x2b, 0x2b, 0x31, 0x2d, 0x2d, 0x34, 0x23, 0x1c, 0x1c, 0x85, 0x8b, 0x81, 0x79, 0x79, 0x79, 0x79, 0x79, 0x71, 0x7e, 0x7b, 0x7c, 0x7b, 0x7b, 0x76, 0x71, 0x6c, 0x0b, 0x77, 0x8e, 0x96, 0x53, 0x57, 0x57, 0x57, 0x57, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x99, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x58, 0x56, 0x53, 0x3d, 0x74, 0x85, 0x89, 0x82, 0x80, 0x84, 0x83, 0x81, 0x75, 0x7d, 0x87, 0x8f, 0x48, 0x4b, 0x52, 0x55, 0x56, 0x58, 0x58, 0x9c, 0xf7, 0xea, 0xdd, 0xdd, 0xd5, 0xd5, 0xce, 0xce, 0xc3, 0xce, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xce, 0xce, 0xce, 0xd5, 0xd5, 0xd6, 0xd9, 0xd8, 0xe7, 0xe8, 0xf0, 0xf7, 0xf9, 0x57, 0x56, 0x55, 0x50, 0x48, 0x3d, 0x1b, 0x11, 0x0f, 0x7e, 0x85, 0x16, 0x16, 0x80, 0x16, 0x16, 0x16, 0x15, 0x89, 0x15, 0x89, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1f, 0x31, 0x31, 0x2b, 0x26, 0x2b, 0x33, 0x35, 0x36, 0x35, 0x35, 0x35, 0x30, 0x35, 0x2b, 0x33, 0x2b, 0x2b, 0x2b, 0x2d, 0x30, 0x34, 0x31, 0x34, 0x31, 0x34, 0x34, 0x25, 0x1c, 0x8b, 0x15, 0x84, 0x80, 0x7c, 0x79, 0x76, 0x7c, 0x82, 0x7c, 0x79, 0x81, 0x75, 0x6e, 0x6e, 0x74, 0x87, 0x45, 0x53, 0x57, 0x57, 0x57, 0x57, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x99, 0x01, 0xfb, 0xfb, 0x01, 0x56, 0x53, 0x3d, 0x79, 0x15, 0x15, 0x83, 0x85, 0x7e, 0x0f, 0x0f, 0x1b, 0x93, 0x4b, 0x53, 0x58, 0xfb, 0xfa, 0xf6, 0xea, 0xe6, 0xd9, 0xcc, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc8, 0xc8, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc1, 0xc4, 0xc8, 0xcc, 0xc9, 0xcc, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xd5, 0xdd, 0xe7, 0xf2, 0xf8, 0x54, 0x53, 0x4a, 0x8f, 0x0f, 0x75, 0x85, 0x85, 0x89, 0x84, 0x15, 0x84, 0x89, 0x15, 0x89, 0x16, 0x16, 0x89, 0x16, 0x89, 0x16, 0x1f, 0x31, 0x26, 0x2a, 0x2a, 0x2b, 0x21, 0x2b, 0x33, 0x27, 0x21, 0x2b, 0x22, 0x2a, 0x31, 0x2d, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x33, 0x33, 0x33, 0x33, 0x32, 0x35, 0x3a, 0x34, 0x31, 0x34, 0x26, 0x2d, 0x23, 0x8b, 0x84, 0x7e, 0x79, 0x7e, 0x79, 0x71, 0x7b, 0x7c, 0x79, 0x75, 0x74, 0x67, 0x7a, 0x48, 0x53, 0x57, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x99, 0xfb, 0x99, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x57, 0x56, 0x40, 0x6e, 0x15, 0x16, 0x7e, 0x81, 0x11, 0x87, 0x3d, 0x4b, 0x56, 0x58, 0xf9, 0xf6, 0xe5, 0xd6, 0xce, 0xc3, 0xc1, 0xc1, 0xc1, 0xc4, 0xc4, 0xc6, 0xc4, 0xc6, 0xc6, 0xc6, 0xc4, 0xc6, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc4, 0xc5, 0xc4, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xcb, 0xc8, 0xcb, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xcf, 0xcc, 0xcf, 0xce, 0xcf, 0xce, 0xcc, 0xc3, 0xce, 0xd5, 0xe7, 0xeb, 0x9c, 0x55, 0x4b, 0x8f, 0x0f, 0x81, 0x85, 0x15, 0x89, 0x89, 0x16, 0x89, 0x84, 0x15, 0x16, 0x89, 0x89, 0x1e, 0x1c, 0x2a, 0x2a, 0x2a, 0x32, 0x33, 0x27, 0x2b, 0x2b, 0x2b, 0x35, 0x33, 0x37, 0x2d, 0x28, 0x28, 0x2d, 0x23, 0x2d, 0x30, 0x31, 0x33, 0x33, 0x33, 0x27, 0x3e, 0x32, 0x33, 0x26, 0x30, 0x31, 0x30, 0x34, 0x31, 0x31, 0x34, 0x31, 0x34, 0x23, 0x85, 0x85, 0x82, 0x82, 0x79, 0x79, 0x79, 0x75, 0x81, 0x74, 0x06, 0x0c, 0x91, 0x4e, 0x55, 0x58, 0x58, 0x58, 0x58, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x58, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0xfb, 0xff, 0x01, 0x01, 0xfb, 0xfb, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0x58, 0x57, 0x45, 0x6e, 0x16, 0x89, 0x7e, 0x13, 0x87, 0x93, 0x53, 0xff, 0xf9, 0xea, 0xd7, 0xce, 0xc4, 0xc1, 0xc1, 0xc1, 0xc8, 0xc4, 0xc6, 0xc6, 0xc4, 0xc6, 0xc4, 0xc6, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc6, 0xc9, 0xc6, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xcb, 0xc4, 0xc8, 0xc8, 0xc8, 0xcb, 0xc9, 0xd0, 0xc9, 0xd0, 0xc9, 0xcf, 0xcb, 0xcf, 0xc9, 0xcf, 0xcf, 0xcf, 0xcc, 0xc9, 0xcc, 0xd5, 0xea, 0x9c, 0x53, 0x93, 0x11, 0x85, 0x85, 0x16, 0x89, 0x82, 0x1f, 0x85, 0x16, 0x16, 0x1e, 0x89, 0x16, 0x28, 0x3a, 0x2b, 0x32, 0x32, 0x32, 0x33, 0x2d, 0x28, 0x28, 0x22, 0x28, 0x24, 0x1b, 0x1d, 0x1d, 0x24, 0x24, 0x24, 0x24, 0x24, 0x28, 0x28, 0x28, 0x2b, 0x35, 0x32, 0x32, 0x30, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x3a, 0x2b, 0x31, 0x31, 0x3a, 0x34, 0x31, 0x34, 0x1c, 0x15, 0x85, 0x80, 0x7e, 0x7e, 0x79, 0x81, 0x75, 0x6e, 0x81, 0x3d, 0x4b, 0x55, 0x57, 0x57, 0x01, 0xfb, 0xfa, 0xfa, 0xfb, 0xfb, 0x58, 0x57, 0x57, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x58, 0x4b, 0x0f, 0x7e, 0x89, 0x0f, 0x13, 0x8f, 0x4d, 0x58, 0xf7, 0xdd, 0xd5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc4, 0xc4, 0xc8, 0xc4, 0xc4, 0xc6, 0xc4, 0xc6, 0xc4, 0xc6, 0xc8, 0xc6, 0xc4, 0xc4, 0xc4, 0xc4, 0xc8, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc9, 0xc4, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xd1, 0xd1, 0xc9, 0xd0, 0xc9, 0xd1, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd1, 0xc9, 0xcc, 0xd5, 0xdc, 0xf1, 0x53, 0x93, 0x11, 0x85, 0x89, 0x80, 0x89, 0x8b, 0x15, 0x85, 0x89, 0x89, 0x1e, 0x16, 0x28, 0x2d, 0x2a, 0x33, 0x33, 0x35, 0x28, 0x1d, 0x29, 0x2e, 0x40, 0x40, 0x45, 0x48, 0x96, 0x48, 0x96, 0x49, 0x49, 0x45, 0x42, 0x40, 0x2e, 0x2f, 0x2f, 0x2b, 0x30, 0x33, 0x36, 0x2b, 0x30, 0x2d, 0x3a, 0x31, 0x35, 0x2b, 0x33, 0x30, 0x30, 0x30, 0x31, 0x2d, 0x2d, 0x31, 0x26, 0x1f, 0x89, 0x89, 0x80, 0x7e, 0x85, 0x85, 0x79, 0x75, 0x13, 0x3d, 0x53, 0x56, 0x57, 0x01, 0x01, 0xfa, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0xfb, 0xfb, 0x58, 0x50, 0x87, 0x75, 0x19, 0x0f, 0x87, 0x48, 0x52, 0xf3, 0xe5, 0xce, 0xc1, 0xc1, 0xc1, 0xc5, 0xc5, 0xc5, 0xc5, 0xc6, 0xc6, 0xc4, 0xc6, 0xc4, 0xc5, 0xc4, 0xc6, 0xc4, 0xc4, 0xc4, 0xc8, 0xc8, 0xc4, 0xc4, 0xc1, 0xc4, 0xc4, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xcf, 0xc9, 0xcf, 0xd0, 0xcf, 0xc9, 0xcf, 0xc9, 0xd1, 0xcf, 0xd1, 0xcf, 0xcf, 0xcf, 0xcf, 0xd1, 0xcf, 0xcc, 0xd4, 0xd5, 0xdc, 0xf5, 0x52, 0x3d, 0x81, 0x85, 0x16, 0x89, 0x89, 0x85, 0x15, 0x16, 0x89, 0x1e, 0x1f, 0x2d, 0x2d, 0x2a, 0x30, 0x35, 0x25, 0x2e, 0x93, 0x96, 0x4b, 0x53, 0x53, 0x54, 0x54, 0xf6, 0xf7, 0xf7, 0xf7, 0x52, 0x52, 0x53, 0x50, 0x4e, 0x49, 0x39, 0x2f, 0x2c, 0x35, 0x35, 0x33, 0x35, 0x36, 0x30, 0x36, 0x33, 0x30, 0x33, 0x30, 0x30, 0x30, 0x36, 0x32, 0x30, 0x32, 0x30, 0x30, 0x27, 0x30, 0x89, 0x16, 0x80, 0x85, 0x80, 0x85, 0x0f, 0x0f, 0x1b, 0x96, 0x55, 0x58, 0x58, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x99, 0xfa, 0x01, 0x54, 0x8f, 0x75, 0x19, 0x79, 0x8e, 0x4b, 0x54, 0xea, 0xd4, 0xc1, 0xc1, 0xc4, 0xc1, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc4, 0xc6, 0xc6, 0xc8, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc8, 0xc4, 0xcf, 0xcc, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd4, 0xd7, 0xcf, 0xcf, 0xcf, 0xcc, 0xcf, 0xc9, 0xcc, 0xc9, 0xcf, 0xcf, 0xd4, 0xd1, 0xcf, 0xd1, 0xcf, 0xcf, 0xcf, 0xcf, 0xd1, 0xcf, 0xd1, 0xd7, 0xe3, 0xd5, 0xe7, 0xf5, 0x97, 0x1d, 0x7e, 0x80, 0x8b, 0x7e, 0x8b, 0x15, 0x16, 0x16, 0x89, 0x21, 0x2d, 0x31, 0x36, 0x24, 0x24, 0x45, 0x98, 0x4f, 0xf6, 0xec, 0xe8, 0xe4, 0xdd, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd5, 0xd9, 0xdd, 0xe4, 0xeb, 0x54, 0x55, 0x49, 0x39, 0x24, 0x2c, 0x35, 0x36, 0x33, 0x32, 0x36, 0x30, 0x33, 0x30, 0x33, 0x30, 0x36, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x30, 0x32, 0x30, 0x27, 0x2a, 0x16, 0x16, 0x15, 0x85, 0x81, 0x0f, 0x13, 0x93, 0x53, 0x57, 0x57, 0x99, 0x99, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x58, 0x96, 0x11, 0x7e, 0x1c, 0x87, 0x4b, 0xfa, 0xe7, 0xcc, 0xc4, 0xc1, 0xc5, 0xc6, 0xc5, 0xc5, 0xc6, 0xc5, 0xc6, 0xc6, 0xc6, 0xc4, 0xc6, 0xc4, 0xc6, 0xc6, 0xc6, 0xc8, 0xc4, 0xc8, 0xc8, 0xc4, 0xc4, 0xc9, 0xcf, 0xd7, 0xd7, 0xdf, 0xdb, 0xe3, 0xdf, 0xdb, 0xdb, 0xdf, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xd7, 0xd7, 0xd7, 0xd4, 0xd4, 0xd4, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd1, 0xd1, 0xd1, 0xcf, 0xcf, 0xcf, 0xd0, 0xd4, 0xd7, 0xdb, 0xd7, 0xd9, 0xea, 0x52, 0x3d, 0x0f, 0x15, 0x89, 0x80, 0x15, 0x85, 0x15, 0x16, 0x1e, 0x2a, 0x35, 0x26, 0x3a, 0x28, 0x42, 0x50, 0xf4, 0xdd, 0xd5, 0xce, 0xce, 0xcc, 0xce, 0xcf, 0xc9, 0xcb, 0xc9, 0xd1, 0xcf, 0xcc, 0xcc, 0xce, 0xce, 0xd6, 0xe8, 0x57, 0x4b, 0x8f, 0x2c, 0x2b, 0x33, 0x36, 0x32, 0x36, 0x36, 0x2d, 0x2d, 0x28, 0x28, 0x24, 0x1f, 0x22, 0x2b, 0x2b, 0x35, 0x35, 0x2b, 0x36, 0x30, 0x27, 0x36, 0x33, 0x1e, 0x16, 0x16, 0x89, 0x17, 0x79, 0x11, 0x3d, 0x4e, 0x57, 0x57, 0x58, 0xf9, 0xfb, 0xfa, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xfb, 0x53, 0x1b, 0x85, 0x15, 0x0f, 0x4a, 0xff, 0xe5, 0xc3, 0xc1, 0xc5, 0xc5, 0xc6, 0xc5, 0xc4, 0xc4, 0xc6, 0xc4, 0xc4, 0xc4, 0xc8, 0xc8, 0xc8, 0xc6, 0xc6, 0xc4, 0xc8, 0xc4, 0xc8, 0xc4, 0xc1, 0xc9, 0xd4, 0xd7, 0xdb, 0xdb, 0xdf, 0xdb, 0xda, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdf, 0xdb, 0xdf, 0xdb, 0xdf, 0xdf, 0xde, 0xdb, 0xda, 0xdb, 0xda, 0xd7, 0xd4, 0xcf, 0xc9, 0xcf, 0xd4, 0xd1, 0xd1, 0xd1, 0xcf, 0xcf, 0xcf, 0xc9, 0xd7, 0xdb, 0xdb, 0xdb, 0xd7, 0xe1, 0x52, 0x45, 0x13, 0x85, 0x80, 0x1c, 0x85, 0x19, 0x16, 0x16, 0x1e, 0x30, 0x31, 0x2b, 0x28, 0x2e, 0x4a, 0xf5, 0xd2, 0xcc, 0xc9, 0xcb, 0xcb, 0xc9, 0xcb, 0xcb, 0xd0, 0xd0, 0xd0, 0xd0, 0xcb, 0xd0, 0xcb, 0xcb, 0xd4, 0xcc, 0xc3, 0xe7, 0xf9, 0x4b, 0x38, 0x2c, 0x35, 0x36, 0x36, 0x30, 0x37, 0x25, 0x1d, 0x2e, 0x39, 0x40, 0x40, 0x38, 0x2e, 0x17, 0x17, 0x18, 0x19, 0x24, 0x35, 0x35, 0x33, 0x27, 0x32, 0x32, 0x23, 0x84, 0x89, 0x85, 0x85, 0x0f, 0x39, 0x4e, 0x56, 0x56, 0x57, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xf9, 0x01, 0x57, 0x93, 0x13, 0x85, 0x79, 0x42, 0x01, 0xe5, 0xcc, 0xc1, 0xc4, 0xc5, 0xc6, 0xc5, 0xc8, 0xc6, 0xc8, 0xc8, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc4, 0xc8, 0xcb, 0xc9, 0xc4, 0xc1, 0xc4, 0xd7, 0xd7, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xde, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdb, 0xdb, 0xdb, 0xd7, 0xd7, 0xcf, 0xcc, 0xcb, 0xd1, 0xd1, 0xcf, 0xcf, 0xd4, 0xd4, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xd9, 0xed, 0x4a, 0x13, 0x85, 0x89, 0x84, 0x15, 0x85, 0x15, 0x16, 0x1e, 0x36, 0x35, 0x35, 0x24, 0x39, 0x55, 0xdc, 0xcc, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xd0, 0xcf, 0xcf, 0xc9, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xd1, 0xd4, 0xc3, 0xe6, 0x58, 0x4a, 0x24, 0x28, 0x35, 0x27, 0x3a, 0x25, 0x39, 0x4a, 0x56, 0x56, 0x55, 0x55, 0x55, 0x53, 0x51, 0x4e, 0x45, 0x39, 0x1b, 0x0f, 0x18, 0x18, 0x3a, 0x33, 0x36, 0x2a, 0x2a, 0x89, 0x1f, 0x89, 0x15, 0x85, 0x29, 0x51, 0x56, 0x56, 0xfb, 0xfa, 0xfa, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4b, 0x29, 0x85, 0x80, 0x39, 0x52, 0xf0, 0xd0, 0xc1, 0xc4, 0xc6, 0xc5, 0xc5, 0xc6, 0xc6, 0xc8, 0xc8, 0xc4, 0xc4, 0xc4, 0xc8, 0xc8, 0xc6, 0xc8, 0xc9, 0xc1, 0xc1, 0xc1, 0xd1, 0xd7, 0xdb, 0xdb, 0xdf, 0xdb, 0xdf, 0xdb, 0xda, 0xde, 0xde, 0xdf, 0xdf, 0xda, 0xde, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xdb, 0xda, 0xdb, 0xd7, 0xd7, 0xd4, 0xd1, 0xcb, 0xd4, 0xd4, 0xd7, 0xce, 0xd7, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xd9, 0xed, 0x4b, 0x1b, 0x81, 0x89, 0x80, 0x8b, 0x85, 0x18, 0x16, 0x21, 0x36, 0x2b, 0x2c, 0x1d, 0x45, 0xf5, 0xd5, 0xcc, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xd0, 0xcf, 0xcf, 0xcf, 0xd1, 0xd0, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xcf, 0xcc, 0xce, 0xeb, 0x55, 0x42, 0x2f, 0x31, 0x31, 0x2f, 0x40, 0x55, 0x57, 0xeb, 0xe4, 0xf0, 0xf6, 0xf9, 0xfa, 0xfb, 0xfb, 0xfb, 0x57, 0x55, 0x4e, 0x45, 0x1d, 0x18, 0x18, 0x22, 0x36, 0x36, 0x32, 0x1e, 0x1e, 0x1e, 0x18, 0x85, 0x39, 0x51, 0x57, 0x57, 0x58, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xff, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x56, 0x93, 0x0f, 0x85, 0x17, 0x4e, 0x99, 0xd7, 0xc1, 0xc5, 0xc5, 0xc4, 0xc5, 0xc5, 0xc5, 0xc5, 0xc6, 0xc5, 0xc6, 0xc6, 0xc6, 0xc5, 0xc6, 0xc5, 0xc6, 0xc8, 0xcc, 0xd4, 0xd7, 0xdf, 0xe3, 0xe3, 0xdf, 0xdf, 0xdb, 0xda, 0xdf, 0xde, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xe3, 0xdb, 0xdf, 0xdb, 0xda, 0xd7, 0xd1, 0xd4, 0xd4, 0xce, 0xd4, 0xda, 0xdf, 0xdf, 0xda, 0xda, 0xe0, 0xd9, 0xed, 0x4b, 0x1b, 0x81, 0x89, 0x89, 0x85, 0x15, 0x15, 0x16, 0x2b, 0x33, 0x35, 0x2c, 0x2e, 0x50, 0xeb, 0xc3, 0xc8, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xd1, 0xcf, 0xcf, 0xcb, 0xd1, 0xc9, 0xd1, 0xcb, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xcc, 0xce, 0xd6, 0x57, 0x4e, 0x39, 0x24, 0x3a, 0x25, 0x45, 0x50, 0xc7, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xd4, 0xd5, 0xe5, 0xf0, 0xf9, 0x58, 0x56, 0x55, 0x4a, 0x42, 0x2e, 0x18, 0x22, 0x35, 0x3e, 0x32, 0x1e, 0x1e, 0x18, 0x81, 0x3d, 0x55, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x4b, 0x29, 0x85, 0x17, 0x3d, 0x54, 0xea, 0xc1, 0xc5, 0xc5, 0xc4, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xcb, 0xc6, 0xc6, 0xc5, 0xc6, 0xc6, 0xd1, 0xd7, 0xdb, 0xe3, 0xe6, 0xe3, 0xdf, 0xdb, 0xdf, 0xda, 0xde, 0xe2, 0xdf, 0xe2, 0xde, 0xda, 0xde, 0xde, 0xde, 0xda, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xda, 0xde, 0xde, 0xda, 0xde, 0xda, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xdb, 0xd7, 0xd4, 0xd4, 0xce, 0xd5, 0xe3, 0xda, 0xdf, 0xda, 0xda, 0xd9, 0xd9, 0xec, 0x4d, 0x8e, 0x7e, 0x82, 0x89, 0x85, 0x15, 0x15, 0x18, 0x30, 0x33, 0x35, 0x24, 0x3d, 0x55, 0xdd, 0xc8, 0xcf, 0xcb, 0xcf, 0xcb, 0xd1, 0xcb, 0xd1, 0xcf, 0xd1, 0xcb, 0xd1, 0xcb, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xcf, 0xcf, 0xd4, 0xce, 0xce, 0xea, 0x56, 0x42, 0x25, 0x37, 0x2f, 0x45, 0x4f, 0xc7, 0xcc, 0xd0, 0xc1, 0xc8, 0xc4, 0xc6, 0xc1, 0xc1, 0xc1, 0xc3, 0xce, 0xd9, 0xe9, 0xf7, 0x57, 0x56, 0x4e, 0x45, 0x2e, 0x18, 0x22, 0x36, 0x32, 0x27, 0x2a, 0x19, 0x11, 0x45, 0x56, 0x57, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0xff, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x56, 0x45, 0x11, 0x13, 0x29, 0x4b, 0xf8, 0xd7, 0xc1, 0xc5, 0xc5, 0xc5, 0xc6, 0xc5, 0xc6, 0xc5, 0xc6, 0xc5, 0xc6, 0xc6, 0xc6, 0xc4, 0xc4, 0xd1, 0xd7, 0xdb, 0xe3, 0xe3, 0xdb, 0xda, 0xdb, 0xde, 0xde, 0xda, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xdf, 0xde, 0xdb, 0xde, 0xda, 0xda, 0xe3, 0xdb, 0xda, 0xda, 0xd5, 0xdb, 0xdf, 0xdf, 0xdb, 0xda, 0xda, 0xde, 0xd9, 0xed, 0x4d, 0x1b, 0x81, 0x89, 0x89, 0x16, 0x85, 0x18, 0x8b, 0x33, 0x36, 0x33, 0x1d, 0x45, 0xf5, 0xd5, 0xcc, 0xd0, 0xcf, 0xcf, 0xc9, 0xd1, 0xcb, 0xd1, 0xcf, 0xcf, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xd4, 0xcc, 0xd9, 0xff, 0x4a, 0x2e, 0x2d, 0x2f, 0x42, 0x52, 0xd5, 0xcc, 0xc6, 0xc5, 0xcb, 0xcb, 0xc9, 0xcb, 0xcb, 0xcb, 0xc9, 0xc8, 0xc3, 0xc3, 0xce, 0xd8, 0xea, 0xfa, 0x56, 0x4e, 0x42, 0x2e, 0x18, 0x33, 0x32, 0x2a, 0x26, 0x17, 0x1b, 0x49, 0x56, 0x57, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x57, 0x50, 0x8e, 0x81, 0x13, 0x42, 0x4f, 0xf0, 0xc1, 0xc1, 0xc6, 0xc5, 0xc5, 0xc5, 0xc4, 0xc6, 0xc4, 0xc6, 0xc8, 0xc8, 0xc4, 0xc8, 0xcf, 0xd7, 0xda, 0xe3, 0xe3, 0xde, 0xde, 0xe2, 0xe2, 0xde, 0xde, 0xde, 0xe2, 0xe2, 0xde, 0xde, 0xde, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xde, 0xda, 0xde, 0xda, 0xde, 0xda, 0xde, 0xde, 0xe2, 0xe6, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xda, 0xe1, 0xf0, 0x4d, 0x8e, 0x7c, 0x89, 0x89, 0x16, 0x15, 0x15, 0x1f, 0x36, 0x35, 0x33, 0x17, 0x4b, 0xf1, 0xce, 0xcb, 0xd0, 0xcf, 0xcf, 0xd1, 0xd1, 0xcb, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xcf, 0xcf, 0xd1, 0xd0, 0xd0, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xcc, 0xf0, 0x53, 0x38, 0x2c, 0x2c, 0x3d, 0x52, 0xd9, 0xc1, 0xcb, 0xc5, 0xc6, 0xc9, 0xc8, 0xc6, 0xcb, 0xcb, 0xc6, 0xc6, 0xcb, 0xc9, 0xc4, 0xc1, 0xcc, 0xd5, 0xea, 0xf9, 0x56, 0x49, 0x25, 0x8b, 0x30, 0x32, 0x30, 0x2b, 0x19, 0x38, 0x4e, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x58, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x56, 0x49, 0x13, 0x13, 0x1b, 0x97, 0xf6, 0xd7, 0xc1, 0xc6, 0xc6, 0xc4, 0xc5, 0xc5, 0xc4, 0xc4, 0xc8, 0xc8, 0xc8, 0xc4, 0xcf, 0xd7, 0xda, 0xe2, 0xe6, 0xe1, 0xde, 0xde, 0xde, 0xe2, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe1, 0xde, 0xde, 0xe1, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe1, 0xe6, 0xe6, 0xe3, 0xe3, 0xe3, 0xdf, 0xe3, 0xdf, 0xe1, 0xf0, 0x4d, 0x87, 0x85, 0x89, 0x89, 0x89, 0x15, 0x15, 0x1c, 0x36, 0x33, 0x35, 0x1d, 0x53, 0xe8, 0xce, 0xcb, 0xd0, 0xd0, 0xcf, 0xcf, 0xd1, 0xcb, 0xd0, 0xd0, 0xcf, 0xd0, 0xcf, 0xcf, 0xd4, 0xcf, 0xd1, 0xd1, 0xcb, 0xcb, 0xd0, 0xcb, 0xcb, 0xd0, 0xc9, 0xea, 0x55, 0x42, 0x2c, 0x2f, 0x39, 0x4d, 0xdd, 0xcc, 0xc6, 0xc5, 0xcb, 0xcb, 0xc9, 0xcb, 0xc6, 0xc6, 0xcb, 0xc5, 0xc6, 0xcb, 0xcb, 0xc9, 0xc9, 0xc9, 0xc3, 0xd9, 0xec, 0x56, 0x4a, 0x2e, 0x16, 0x32, 0x27, 0x27, 0x22, 0x18, 0x44, 0x53, 0x58, 0x58, 0x99, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x58, 0x58, 0x58, 0x01, 0xfa, 0x99, 0xfa, 0x99, 0x01, 0x57, 0x53, 0x3c, 0x0f, 0x13, 0x8f, 0xe9, 0xf0, 0xc1, 0xc6, 0xc4, 0xc1, 0xc8, 0xc5, 0xc5, 0xc5, 0xcb, 0xc4, 0xc4, 0xc3, 0xcf, 0xdb, 0xde, 0xde, 0xde, 0xe2, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xde, 0xde, 0xe6, 0xe1, 0xe6, 0xe6, 0xe6, 0xe3, 0xdf, 0xe3, 0xdf, 0xe0, 0xf4, 0x4d, 0x13, 0x85, 0x85, 0x89, 0x15, 0x8b, 0x15, 0x23, 0x36, 0x33, 0x2c, 0x1b, 0x55, 0xdd, 0xce, 0xcb, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xd1, 0xd0, 0xd1, 0xd0, 0xcf, 0xd4, 0xcf, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xc9, 0xd9, 0xfa, 0x49, 0x25, 0x28, 0x38, 0x4b, 0xe8, 0xcc, 0xcb, 0xc5, 0xcb, 0xc6, 0xcb, 0xc6, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc6, 0xcb, 0xcb, 0xc9, 0xc9, 0xcc, 0xc3, 0xce, 0xea, 0x58, 0x96, 0x1d, 0x1f, 0x32, 0x32, 0x27, 0x1e, 0x24, 0x49, 0x55, 0x57, 0x99, 0xfb, 0x99, 0x58, 0x58, 0x01, 0x99, 0x99, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x58, 0x58, 0x58, 0x01, 0x01, 0xfa, 0x99, 0x01, 0xff, 0x58, 0x4e, 0x17, 0x17, 0x1b, 0x48, 0xf2, 0xdf, 0xc1, 0xc5, 0xc4, 0xc4, 0xc4, 0xc5, 0xc5, 0xc6, 0xc4, 0xc4, 0xc8, 0xd4, 0xdf, 0xe3, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xe6, 0xe5, 0xe6, 0xe1, 0xe6, 0xe6, 0xdf, 0xe2, 0xe2, 0xe0, 0x9c, 0x4b, 0x1b, 0x81, 0x15, 0x8b, 0x16, 0x15, 0x8b, 0x23, 0x36, 0x33, 0x2c, 0x39, 0x54, 0xdd, 0xcc, 0xcb, 0xd0, 0xd0, 0xcf, 0xd4, 0xcf, 0xd1, 0xd1, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xd1, 0xd0, 0xd1, 0xd0, 0xd1, 0xcf, 0xd4, 0xcf, 0xcf, 0xd1, 0xc9, 0xd5, 0xf8, 0x4e, 0x2e, 0x28, 0x29, 0x4a, 0xeb, 0xcc, 0xc8, 0xc6, 0xcb, 0xcb, 0xc6, 0xcb, 0xc6, 0xcb, 0xc8, 0xcb, 0xcb, 0xc9, 0xcb, 0xc8, 0xcb, 0xcf, 0xcf, 0xcc, 0xcc, 0xc3, 0xf0, 0x56, 0x45, 0x19, 0x21, 0x32, 0x27, 0x2b, 0x24, 0x3c, 0x51, 0x57, 0x01, 0x99, 0xfb, 0x01, 0x58, 0x01, 0x99, 0x99, 0x01, 0xfb, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x58, 0x58, 0x58, 0x01, 0xfb, 0x99, 0xfb, 0x01, 0x54, 0x58, 0x42, 0x0f, 0x19, 0x8e, 0x4b, 0xf0, 0xcc, 0xc5, 0xc5, 0xc6, 0xc4, 0xc4, 0xc6, 0xc6, 0xc6, 0xc1, 0xc8, 0xdb, 0xe6, 0xdf, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe6, 0xe5, 0xe3, 0xe6, 0xe3, 0xdf, 0xe2, 0xde, 0xe5, 0x9c, 0x4b, 0x13, 0x85, 0x85, 0x16, 0x16, 0x15, 0x8b, 0x2d, 0x36, 0x33, 0x24, 0x42, 0xfa, 0xd6, 0xcc, 0xcb, 0xd0, 0xd0, 0xcf, 0xd4, 0xcf, 0xd1, 0xd1, 0xd1, 0xd1, 0xd4, 0xd1, 0xd0, 0xd1, 0xd1, 0xd0, 0xd1, 0xd1, 0xd1, 0xcf, 0xcf, 0xcf, 0xcf, 0xd1, 0xd5, 0xed, 0x53, 0x38, 0x24, 0x25, 0x48, 0xf8, 0xce, 0xcb, 0xcb, 0xc6, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc9, 0xcb, 0xc9, 0xcb, 0xcc, 0xc1, 0xd5, 0xff, 0x51, 0x40, 0x24, 0x33, 0x21, 0x2b, 0x22, 0x17, 0x49, 0x56, 0x01, 0x9c, 0x01, 0x58, 0x01, 0x01, 0x99, 0x01, 0xfb, 0x58, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x58, 0x58, 0x58, 0x01, 0xfb, 0x99, 0xfb, 0x01, 0x57, 0x55, 0x1b, 0x17, 0x17, 0x3d, 0x52, 0xe7, 0xc1, 0xc5, 0xc5, 0xc5, 0xc8, 0xcb, 0xc4, 0xc1, 0xc4, 0xd7, 0xdb, 0xdb, 0xdb, 0xe3, 0xde, 0xe2, 0xe1, 0xdf, 0xe2, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xe2, 0xe6, 0xe5, 0xe6, 0xe2, 0xe6, 0xe3, 0xe2, 0xe6, 0xd9, 0xe5, 0x9c, 0x97, 0x13, 0x85, 0x15, 0x8b, 0x16, 0x15, 0x8b, 0x34, 0x36, 0x33, 0x18, 0x49, 0xf5, 0xd5, 0xcc, 0xcb, 0xd0, 0xd0, 0xcf, 0xd4, 0xcf, 0xd0, 0xd0, 0xcf, 0xd4, 0xd0, 0xd4, 0xd0, 0xd4, 0xd0, 0xd1, 0xd0, 0xd1, 0xd4, 0xd4, 0xd1, 0xcf, 0xcf, 0xd4, 0xd7, 0xe9, 0x55, 0x40, 0x19, 0x25, 0x93, 0xff, 0xd5, 0xc9, 0xcb, 0xcb, 0xcb, 0xc6, 0xcb, 0xc8, 0xcb, 0xc8, 0xcb, 0xcb, 0xc9, 0xcb, 0xc9, 0xcb, 0xcb, 0xcb, 0xc6, 0xcb, 0xcf, 0xc3, 0xd8, 0x58, 0x4a, 0x25, 0x24, 0x1f, 0x2b, 0x1f, 0x24, 0x2e, 0x4e, 0x57, 0x01, 0xff, 0xfb, 0x01, 0x01, 0x99, 0x99, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0xfb, 0xfb, 0xfb, 0x01, 0x57, 0x58, 0x96, 0x10, 0x19, 0x1b, 0x96, 0xf5, 0xd9, 0xc4, 0xc5, 0xc5, 0xc5, 0xc8, 0xc4, 0xc4, 0xcb, 0xd7, 0xdb, 0xe3, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe3, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xda, 0xdf, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xe3, 0xe5, 0xe6, 0xe6, 0xe2, 0xe3, 0xe3, 0xe3, 0xe6, 0xde, 0xe7, 0xff, 0x48, 0x13, 0x85, 0x8b, 0x16, 0x16, 0x16, 0x1c, 0x31, 0x35, 0x33, 0x1d, 0x4a, 0xf0, 0xce, 0xd1, 0xcb, 0xd0, 0xd0, 0xcf, 0xd4, 0xd1, 0xd1, 0xd0, 0xd4, 0xd1, 0xd4, 0xd0, 0xd4, 0xd1, 0xd0, 0xd1, 0xd0, 0xd4, 0xd0, 0xcf, 0xd4, 0xd4, 0xd4, 0xdb, 0xd9, 0xe7, 0x55, 0x45, 0x25, 0x25, 0x3d, 0x54, 0xdd, 0xcf, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xc9, 0xcb, 0xcb, 0xcb, 0xc5, 0xd7, 0xc1, 0xce, 0xf8, 0x53, 0x40, 0x19, 0x2c, 0x30, 0x2b, 0x22, 0x17, 0x45, 0x55, 0x01, 0xff, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x58, 0x58, 0x01, 0x01, 0xfb, 0x99, 0x58, 0x57, 0x56, 0x8f, 0x11, 0x17, 0x8f, 0x50, 0xeb, 0xcc, 0xc6, 0xc5, 0xc5, 0xc5, 0xc6, 0xc4, 0xd1, 0xd7, 0xe3, 0xdf, 0xdf, 0xdf, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xe3, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xe3, 0xe6, 0xe6, 0xe5, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe6, 0xd9, 0xea, 0xf8, 0x48, 0x13, 0x85, 0x8b, 0x16, 0x16, 0x1f, 0x8b, 0x3a, 0x35, 0x35, 0x2e, 0x4b, 0xf0, 0xcc, 0xd1, 0xcb, 0xd0, 0xd0, 0xd4, 0xd0, 0xd4, 0xd0, 0xd0, 0xd4, 0xcf, 0xd4, 0xd0, 0xd1, 0xd4, 0xd0, 0xd4, 0xd4, 0xd0, 0xd4, 0xd1, 0xd4, 0xd4, 0xd7, 0xdb, 0xda, 0xdd, 0x54, 0x49, 0x25, 0x2f, 0x39, 0x4d, 0xea, 0xcc, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc9, 0xcb, 0xcb, 0xc9, 0xcb, 0xc9, 0xd0, 0xcb, 0xcb, 0xcb, 0xc5, 0xcb, 0xc9, 0xc3, 0xe4, 0x57, 0x48, 0x1d, 0x28, 0x27, 0x27, 0x30, 0x18, 0x1d, 0x4e, 0x57, 0x58, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0xfb, 0xff, 0x01, 0x57, 0x57, 0x51, 0x0c, 0x29, 0x13, 0x3d, 0x52, 0xdd, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xc4, 0xc4, 0xd7, 0xdf, 0xdb, 0xe3, 0xdf, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xdf, 0xe3, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xe3, 0xe2, 0xe3, 0xe5, 0xe6, 0xe6, 0xe2, 0xe3, 0xe2, 0xe2, 0xe6, 0xe0, 0xe7, 0x57, 0x45, 0x85, 0x15, 0x8b, 0x16, 0x1e, 0x16, 0x26, 0x31, 0x35, 0x2c, 0x2e, 0x4d, 0xea, 0xce, 0xd1, 0xcb, 0xd0, 0xd4, 0xcf, 0xd4, 0xd0, 0xd0, 0xd4, 0xcf, 0xd4, 0xd0, 0xd4, 0xd0, 0xd4, 0xd1, 0xd0, 0xd1, 0xd4, 0xd4, 0xcf, 0xd4, 0xd7, 0xdb, 0xdb, 0xd9, 0xd9, 0x54, 0x4b, 0x25, 0x25, 0x39, 0x4b, 0xee, 0xce, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xc9, 0xcb, 0xc9, 0xd0, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcf, 0xc1, 0xd9, 0xfa, 0x53, 0x1b, 0x19, 0x27, 0x27, 0x33, 0x26, 0x17, 0x42, 0x56, 0x57, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0x56, 0x57, 0x49, 0x0f, 0x1d, 0x87, 0x96, 0xf6, 0xd9, 0xc4, 0xc5, 0xc5, 0xc5, 0xc5, 0xc4, 0xd1, 0xd7, 0xdf, 0xdf, 0xda, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xe2, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xe2, 0xe3, 0xe6, 0xe6, 0xe2, 0xe2, 0xe6, 0xe2, 0xdf, 0xe6, 0xe6, 0xe0, 0xea, 0x56, 0x93, 0x85, 0x17, 0x89, 0x84, 0x1e, 0x16, 0x35, 0x31, 0x3a, 0x22, 0x39, 0x53, 0xe1, 0xcc, 0xd1, 0xd0, 0xd0, 0xd0, 0xd4, 0xd4, 0xd1, 0xd1, 0xd0, 0xd4, 0xcf, 0xd4, 0xd4, 0xd1, 0xd4, 0xd0, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd7, 0xdb, 0xdb, 0xd7, 0xda, 0xd9, 0xf4, 0x4e, 0x2e, 0x2f, 0x2e, 0x4a, 0xf4, 0xd5, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc9, 0xcb, 0xd0, 0xcb, 0xc9, 0xcb, 0xc9, 0xcb, 0xc9, 0xcb, 0xd0, 0xcb, 0xc9, 0xc9, 0xd5, 0xe0, 0xf0, 0x56, 0x3d, 0x19, 0x2a, 0x32, 0x27, 0x2b, 0x18, 0x1d, 0x53, 0x57, 0x58, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0xfb, 0x01, 0x58, 0x57, 0x55, 0x39, 0x17, 0x17, 0x8e, 0x98, 0xf0, 0xcc, 0xc6, 0xc5, 0xc5, 0xc5, 0xc4, 0xc8, 0xd7, 0xdf, 0xdf, 0xde, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe2, 0xe2, 0xdf, 0xdf, 0xe2, 0xdf, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xda, 0xdf, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xe3, 0xe2, 0xe6, 0xe2, 0xe6, 0xe3, 0xe2, 0xe3, 0xe2, 0xe5, 0xe0, 0xea, 0x56, 0x42, 0x85, 0x84, 0x8b, 0x16, 0x1e, 0x16, 0x36, 0x37, 0x35, 0x24, 0x40, 0x4d, 0xd9, 0xce, 0xd1, 0xd0, 0xcf, 0xcf, 0xd4, 0xd1, 0xd0, 0xd1, 0xcf, 0xd4, 0xd4, 0xd1, 0xd4, 0xcf, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xcf, 0xd7, 0xdb, 0xde, 0xdb, 0xda, 0xda, 0xd9, 0xf0, 0x53, 0x39, 0x2f, 0x2f, 0x45, 0x54, 0xd9, 0xc4, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xc9, 0xd0, 0xc9, 0xd0, 0xc9, 0xd0, 0xc9, 0xc9, 0xcb, 0xcf, 0xc9, 0xcc, 0xd4, 0xdf, 0xe6, 0xe7, 0xff, 0x4a, 0x17, 0x21, 0x32, 0x27, 0x27, 0x2b, 0x85, 0x45, 0x58, 0x56, 0x01, 0xfb, 0x58, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0x58, 0x57, 0x51, 0x13, 0x2f, 0x17, 0x3d, 0xf5, 0xea, 0xc9, 0xc6, 0xc5, 0xc6, 0xc8, 0xc4, 0xcf, 0xdb, 0xe3, 0xda, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xdf, 0xde, 0xde, 0xdf, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xdf, 0xe3, 0xe3, 0xe3, 0xe6, 0xe6, 0xe2, 0xe6, 0xe3, 0xe3, 0xe2, 0xe0, 0xe5, 0xec, 0x55, 0x3d, 0x85, 0x15, 0x84, 0x89, 0x1e, 0x16, 0x35, 0x3a, 0x35, 0x24, 0x42, 0x52, 0xe1, 0xd7, 0xd7, 0xd7, 0xd4, 0xd4, 0xd4, 0xcf, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd7, 0xda, 0xe3, 0xdf, 0xda, 0xda, 0xdb, 0xd5, 0xea, 0x55, 0x40, 0x2f, 0x2f, 0x45, 0x55, 0xd9, 0xc4, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xc9, 0xd0, 0xd1, 0xd0, 0xcf, 0xd1, 0xcf, 0xc9, 0xcc, 0xd7, 0xe3, 0xdf, 0xe6, 0xd9, 0xf7, 0x55, 0x1b, 0x1f, 0x27, 0x32, 0x27, 0x2b, 0x18, 0x1d, 0x55, 0x57, 0x58, 0x58, 0x58, 0xfb, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0xfb, 0x01, 0xfb, 0xfb, 0x58, 0x57, 0x48, 0x17, 0x23, 0x17, 0x48, 0xf8, 0xda, 0xc8, 0xc5, 0xcb, 0xc8, 0xc8, 0xc8, 0xd4, 0xdb, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xe3, 0xe2, 0xe6, 0xe0, 0xe6, 0xe2, 0xe3, 0xdf, 0xe6, 0xe2, 0xe5, 0xe0, 0xf0, 0x55, 0x39, 0x85, 0x89, 0x8b, 0x89, 0x1e, 0x1e, 0x35, 0x35, 0x2c, 0x24, 0x45, 0x52, 0xe5, 0xde, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xd7, 0xd7, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd7, 0xd4, 0xd7, 0xd4, 0xd4, 0xcf, 0xd7, 0xda, 0xdb, 0xdf, 0xde, 0xda, 0xda, 0xdf, 0xd7, 0xe5, 0x57, 0x42, 0x24, 0x37, 0x40, 0x55, 0xe7, 0xc4, 0xd0, 0xd0, 0xcb, 0xd1, 0xcb, 0xd0, 0xc9, 0xd1, 0xd0, 0xcf, 0xd0, 0xc9, 0xc9, 0xc9, 0xcc, 0xd7, 0xdf, 0xe6, 0xdf, 0xdf, 0xdf, 0xe0, 0xea, 0x57, 0x3d, 0x19, 0x2b, 0x2b, 0x33, 0x1e, 0x3a, 0x0f, 0x4a, 0x58, 0x57, 0x58, 0x58, 0x58, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x58, 0x55, 0x3d, 0x1d, 0x26, 0x25, 0x4d, 0xf6, 0xd7, 0xc6, 0xc5, 0xcb, 0xc9, 0xc3, 0xd1, 0xdb, 0xdb, 0xe2, 0xde, 0xde, 0xdb, 0xde, 0xdf, 0xe3, 0xdf, 0xde, 0xe3, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xe3, 0xe3, 0xe2, 0xe6, 0xe6, 0xe2, 0xe2, 0xe6, 0xe3, 0xe3, 0xe6, 0xe0, 0xe5, 0xf4, 0x54, 0x29, 0x85, 0x15, 0x84, 0x8b, 0x16, 0x1e, 0x35, 0x35, 0x35, 0x24, 0x49, 0x4f, 0xd9, 0xd9, 0xdb, 0xd7, 0xdb, 0xda, 0xda, 0xdb, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd4, 0xd4, 0xcf, 0xd4, 0xd4, 0xd4, 0xd7, 0xda, 0xdb, 0xde, 0xde, 0xda, 0xe0, 0xda, 0xdb, 0xda, 0xdd, 0x57, 0x45, 0x2c, 0x37, 0x40, 0x50, 0xe7, 0xc9, 0xcb, 0xcb, 0xd0, 0xcb, 0xd0, 0xcb, 0xd0, 0xd0, 0xd0, 0xd1, 0xc9, 0xd0, 0xd0, 0xd4, 0xd7, 0xdf, 0xe6, 0xe3, 0xdf, 0xdf, 0xdf, 0xe3, 0xdd, 0x57, 0x4a, 0x25, 0x22, 0x2b, 0x33, 0x27, 0x33, 0x18, 0x8f, 0x55, 0x58, 0x57, 0x57, 0x01, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0xfb, 0xfb, 0x01, 0x57, 0x4d, 0x29, 0x25, 0x2d, 0x39, 0x54, 0xea, 0xcc, 0xc6, 0xc5, 0xcb, 0xc9, 0xc9, 0xd7, 0xdb, 0xdf, 0xda, 0xe2, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xda, 0xde, 0xdf, 0xe3, 0xe3, 0xe6, 0xe3, 0xe6, 0xe2, 0xe6, 0xe6, 0xe3, 0xe6, 0xde, 0xe5, 0xdd, 0xf6, 0x53, 0x29, 0x85, 0x8b, 0x89, 0x1e, 0x16, 0x33, 0x35, 0x35, 0x35, 0x2e, 0x49, 0xef, 0xd9, 0xda, 0xda, 0xdb, 0xde, 0xda, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xd7, 0xd7, 0xd4, 0xd7, 0xd7, 0xda, 0xdb, 0xdb, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xda, 0xdb, 0xda, 0xe1, 0x57, 0x4a, 0x2f, 0x37, 0x38, 0x50, 0xec, 0xcc, 0xcb, 0xcf, 0xcb, 0xd1, 0xcb, 0xd0, 0xc9, 0xd0, 0xc9, 0xcf, 0xd1, 0xd4, 0xd7, 0xdb, 0xdf, 0xdb, 0xdf, 0xde, 0xe2, 0xdf, 0xdb, 0xe3, 0xe0, 0xed, 0x53, 0x2e, 0x24, 0x22, 0x27, 0x33, 0x1e, 0x23, 0x1b, 0x4b, 0x57, 0x57, 0x01, 0x01, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf9, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0xff, 0xfb, 0xf9, 0x99, 0x57, 0x49, 0x19, 0x2f, 0x25, 0x93, 0xfa, 0xe1, 0xce, 0xc8, 0xcb, 0xc6, 0xc9, 0xce, 0xda, 0xe1, 0xdb, 0xdb, 0xdb, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xe3, 0xe2, 0xde, 0xde, 0xe2, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xe2, 0xda, 0xda, 0xde, 0xe2, 0xe6, 0xe3, 0xe3, 0xe3, 0xe6, 0xe5, 0xe1, 0xe6, 0xe3, 0xdb, 0xe6, 0xe0, 0xf8, 0x51, 0x1b, 0x85, 0x8b, 0x89, 0x16, 0x1e, 0x21, 0x31, 0x3a, 0x2c, 0x2f, 0x4b, 0xeb, 0xda, 0xda, 0xda, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xda, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xde, 0xe2, 0xe0, 0xda, 0xda, 0xe0, 0xf9, 0x4a, 0x2e, 0x34, 0x2e, 0x4a, 0xf8, 0xcc, 0xd4, 0xd0, 0xcf, 0xcb, 0xcf, 0xd0, 0xcf, 0xd1, 0xc9, 0xcf, 0xd4, 0xd7, 0xdb, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xe2, 0xe0, 0xde, 0xe6, 0xd9, 0xea, 0x55, 0x42, 0x19, 0x22, 0x2b, 0x2b, 0x1f, 0x23, 0x1c, 0x40, 0x55, 0x57, 0x01, 0xf9, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x01, 0x99, 0x01, 0x01, 0x99, 0x9c, 0xf1, 0xdc, 0xd6, 0xd3, 0xca, 0xca, 0xd3, 0x4c, 0x58, 0x58, 0xf9, 0xfb, 0x58, 0x55, 0x44, 0x24, 0x2c, 0x1d, 0x4b, 0xf6, 0xd9, 0xd7, 0xd1, 0xcb, 0xc4, 0xcf, 0xd7, 0xde, 0xe3, 0xdf, 0xdf, 0xdb, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xde, 0xda, 0xde, 0xdf, 0xde, 0xda, 0xde, 0xe6, 0xe6, 0xe3, 0xe3, 0xe3, 0xe3, 0xe5, 0xe1, 0xe6, 0xe3, 0xdb, 0xe6, 0xdd, 0xf8, 0x4e, 0x1d, 0x7e, 0x8b, 0x89, 0x16, 0x1e, 0x30, 0x31, 0x31, 0x35, 0x2e, 0x4b, 0xea, 0xda, 0xda, 0xdf, 0xdf, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xde, 0xda, 0xde, 0xde, 0xde, 0xda, 0xde, 0xde, 0xde, 0xda, 0xde, 0xde, 0xde, 0xda, 0xda, 0xd9, 0xf7, 0x4e, 0x2e, 0x2f, 0x2f, 0x4a, 0xf8, 0xd5, 0xcf, 0xcf, 0xd0, 0xcf, 0xd0, 0xc9, 0xd0, 0xc9, 0xd4, 0xd4, 0xda, 0xdb, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xe0, 0xe1, 0xe1, 0xe2, 0xda, 0xe7, 0xff, 0x49, 0x1d, 0x22, 0x2b, 0x26, 0x23, 0x2a, 0x18, 0x3c, 0x51, 0x57, 0x01, 0xf9, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xf8, 0x58, 0x01, 0xe4, 0xaa, 0xa1, 0xa0, 0xa0, 0xa1, 0xa1, 0xa0, 0xa0, 0xaf, 0xe4, 0x58, 0xfb, 0x99, 0x01, 0x4e, 0x38, 0x24, 0x2f, 0x1d, 0x56, 0xec, 0xda, 0xd9, 0xd7, 0xd7, 0xd0, 0xd7, 0xdb, 0xde, 0xe2, 0xdf, 0xdb, 0xe3, 0xdb, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xda, 0xde, 0xde, 0xe6, 0xe6, 0xe6, 0xe3, 0xe3, 0xe6, 0xe5, 0xe5, 0xe6, 0xe3, 0xdb, 0xe2, 0xe5, 0xff, 0x4a, 0x17, 0x85, 0x8b, 0x89, 0x1e, 0x1e, 0x30, 0x31, 0x2d, 0x2c, 0x38, 0x4e, 0xea, 0xda, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xde, 0xda, 0xde, 0xda, 0xde, 0xda, 0xde, 0xde, 0xde, 0xde, 0xda, 0xde, 0xda, 0xde, 0xde, 0xde, 0xda, 0xd9, 0xf2, 0x53, 0x39, 0x2f, 0x25, 0x45, 0xff, 0xd9, 0xc9, 0xd4, 0xd0, 0xd4, 0xd0, 0xd1, 0xd1, 0xcf, 0xd7, 0xdb, 0xe3, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xe0, 0xe2, 0xe1, 0xe3, 0xda, 0xdd, 0x54, 0x4e, 0x2e, 0x22, 0x2b, 0x2a, 0x26, 0x26, 0x1f, 0x25, 0x49, 0x57, 0x01, 0x99, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0xf8, 0x01, 0x01, 0xca, 0xa0, 0xa0, 0xa1, 0xa3, 0xa8, 0xa8, 0xae, 0xb0, 0xaa, 0xbd, 0x99, 0xfb, 0x99, 0x56, 0x4a, 0x19, 0x28, 0x24, 0x8f, 0x57, 0xe7, 0xd5, 0xdb, 0xdf, 0xd7, 0xdb, 0xdb, 0xdb, 0xde, 0xde, 0xdf, 0xdb, 0xdb, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xda, 0xde, 0xda, 0xe2, 0xe3, 0xe6, 0xe6, 0xe6, 0xe3, 0xe3, 0xe6, 0xe5, 0xe6, 0xe6, 0xe3, 0xdf, 0xde, 0xe7, 0x58, 0x96, 0x17, 0x85, 0x15, 0x89, 0x16, 0x1e, 0x36, 0x31, 0x2d, 0x22, 0x38, 0x4d, 0xe8, 0xda, 0xda, 0xdf, 0xdf, 0xda, 0xdf, 0xda, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xda, 0xde, 0xde, 0xde, 0xda, 0xde, 0xde, 0xda, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xda, 0xda, 0xd9, 0xec, 0x53, 0x40, 0x2f, 0x2f, 0x3d, 0x57, 0xe5, 0xcc, 0xd0, 0xd4, 0xd0, 0xd1, 0xd1, 0xd1, 0xd7, 0xd7, 0xe3, 0xe3, 0xe3, 0xde, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe1, 0xe6, 0xde, 0xdf, 0xd9, 0xef, 0x55, 0x40, 0x19, 0x2b, 0x26, 0x26, 0x26, 0x21, 0x19, 0x42, 0x55, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xff, 0x01, 0x01, 0xca, 0xa1, 0xa7, 0xb0, 0xb2, 0xb3, 0xb5, 0xb3, 0xb1, 0xb1, 0xbb, 0x99, 0x01, 0x01, 0x55, 0x42, 0x22, 0x2c, 0x17, 0x48, 0x57, 0xe5, 0xd9, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdf, 0xda, 0xde, 0xdb, 0xdf, 0xdb, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xde, 0xda, 0xde, 0xe2, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe3, 0xe6, 0xe5, 0xe5, 0xe6, 0xdf, 0xe3, 0xd9, 0xea, 0x57, 0x49, 0x85, 0x15, 0x8b, 0x89, 0x16, 0x27, 0x36, 0x31, 0x2d, 0x22, 0x40, 0x50, 0xe7, 0xda, 0xda, 0xda, 0xdf, 0xdf, 0xda, 0xdf, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xda, 0xde, 0xda, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xda, 0xde, 0xda, 0xd9, 0xe8, 0x56, 0x42, 0x25, 0x2f, 0x39, 0x54, 0xf0, 0xc9, 0xd4, 0xd0, 0xd4, 0xd0, 0xd4, 0xd7, 0xdb, 0xdb, 0xdf, 0xdf, 0xde, 0xde, 0xe2, 0xe2, 0xde, 0xdf, 0xdf, 0xe2, 0xe1, 0xe6, 0xde, 0xe3, 0xd9, 0xe8, 0x54, 0x45, 0x24, 0x1f, 0x26, 0x2a, 0x27, 0x2a, 0x19, 0x39, 0x4e, 0x58, 0x58, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xff, 0x01, 0x01, 0xfb, 0xd3, 0xab, 0xb2, 0xb6, 0xb6, 0xb6, 0xb7, 0xb8, 0xb9, 0xb3, 0xb8, 0x99, 0x99, 0x58, 0x4e, 0x38, 0x21, 0x2c, 0x13, 0x53, 0xf3, 0xdd, 0xda, 0xdf, 0xd7, 0xdb, 0xdb, 0xdb, 0xdf, 0xda, 0xde, 0xe3, 0xdb, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xe2, 0xda, 0xda, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe3, 0xe3, 0xe5, 0xe6, 0xe2, 0xe3, 0xe3, 0xe0, 0xea, 0x56, 0x45, 0x85, 0x15, 0x8b, 0x89, 0x16, 0x32, 0x36, 0x36, 0x2d, 0x22, 0x40, 0x4d, 0xe7, 0xda, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xda, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xde, 0xdf, 0xdf, 0xde, 0xda, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xe2, 0xda, 0xde, 0xe1, 0xe8, 0x56, 0x42, 0x2f, 0x25, 0x2e, 0x50, 0xf6, 0xce, 0xd1, 0xd4, 0xd4, 0xd4, 0xd7, 0xdb, 0xdb, 0xdf, 0xdb, 0xde, 0xe2, 0xe2, 0xde, 0xe2, 0xdf, 0xdf, 0xdf, 0xde, 0xe2, 0xe1, 0xda, 0xe3, 0xdf, 0xe4, 0xf8, 0x4e, 0x25, 0x1f, 0x2a, 0x27, 0x27, 0x21, 0x1f, 0x1d, 0x49, 0x55, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x58, 0xfb, 0xfb, 0xd3, 0xac, 0xb2, 0xb6, 0xb2, 0xb6, 0xb6, 0xb5, 0xb7, 0xb1, 0xba, 0x99, 0x99, 0x56, 0x4a, 0x22, 0x2b, 0x2c, 0x13, 0x58, 0xeb, 0xd9, 0xde, 0xde, 0xdb, 0xdb, 0xdb, 0xdb, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe6, 0xe6, 0xe5, 0xe1, 0xe3, 0xe6, 0xe0, 0xec, 0x56, 0x42, 0x7e, 0x15, 0x89, 0x8b, 0x16, 0x32, 0x35, 0x30, 0x2d, 0x22, 0x40, 0x52, 0xdd, 0xda, 0xda, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xde, 0xdf, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xda, 0xdf, 0xda, 0xde, 0xda, 0xdf, 0xda, 0xde, 0xe1, 0xe7, 0x56, 0x48, 0x25, 0x37, 0x2e, 0x4e, 0xf9, 0xce, 0xd4, 0xd4, 0xd4, 0xd7, 0xdb, 0xdb, 0xe3, 0xdb, 0xde, 0xe2, 0xe2, 0xe2, 0xe1, 0xe2, 0xde, 0xdf, 0xdf, 0xe2, 0xe1, 0xe2, 0xde, 0xdf, 0xe3, 0xdd, 0xf4, 0x53, 0x39, 0x23, 0x1f, 0x30, 0x1e, 0x27, 0x1f, 0x17, 0x42, 0x53, 0x57, 0x58, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0xd6, 0xb0, 0xb2, 0xb6, 0xb6, 0xb6, 0xb8, 0xb7, 0xb9, 0xb2, 0xba, 0x99, 0x01, 0x55, 0x44, 0x22, 0x30, 0x24, 0x8f, 0x58, 0xe5, 0xd9, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xe3, 0xdf, 0xe3, 0xe3, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe3, 0xe6, 0xe5, 0xe6, 0xe6, 0xe3, 0xe6, 0xdd, 0xf5, 0x55, 0x39, 0x85, 0x16, 0x84, 0x89, 0x1e, 0x32, 0x33, 0x2b, 0x31, 0x22, 0x42, 0x52, 0xdd, 0xda, 0xda, 0xdf, 0xda, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xde, 0xda, 0xde, 0xda, 0xde, 0xde, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xde, 0xdf, 0xdb, 0xde, 0xda, 0xe1, 0xdd, 0xff, 0x49, 0x2e, 0x37, 0x1d, 0x4a, 0xfb, 0xd5, 0xd4, 0xd4, 0xd4, 0xd7, 0xdb, 0xdb, 0xdf, 0xdf, 0xe2, 0xde, 0xe2, 0xe2, 0xe2, 0xe0, 0xdf, 0xdf, 0xdf, 0xde, 0xe1, 0xe1, 0xe2, 0xdb, 0xda, 0xe5, 0xeb, 0x54, 0x42, 0x19, 0x1c, 0x32, 0x1e, 0x32, 0x1f, 0x19, 0x38, 0x4e, 0x56, 0x58, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x58, 0xfb, 0xfb, 0xd6, 0xaf, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb8, 0xb8, 0xb5, 0xba, 0x9c, 0x01, 0x51, 0x40, 0x22, 0x30, 0x19, 0x45, 0xfb, 0xe5, 0xda, 0xda, 0xda, 0xdf, 0xdb, 0xda, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xdf, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xe2, 0xe2, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe3, 0xe6, 0xe6, 0xe5, 0xe6, 0xe3, 0xe3, 0xdd, 0xf8, 0x53, 0x39, 0x80, 0x16, 0x89, 0x89, 0x1f, 0x33, 0x33, 0x33, 0x2d, 0x24, 0x42, 0x52, 0xe0, 0xda, 0xda, 0xdf, 0xda, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xda, 0xdf, 0xda, 0xe1, 0xe1, 0xdd, 0xff, 0x4b, 0x25, 0x37, 0x24, 0x49, 0xfb, 0xd9, 0xcf, 0xd7, 0xd7, 0xdb, 0xdf, 0xdf, 0xdf, 0xe2, 0xde, 0xe2, 0xe2, 0xde, 0xe0, 0xe2, 0xe0, 0xdf, 0xdf, 0xde, 0xe1, 0xe1, 0xe2, 0xda, 0xdf, 0xe0, 0xe7, 0x56, 0x49, 0x25, 0x1f, 0x2b, 0x27, 0x27, 0x21, 0x1f, 0x25, 0x49, 0x55, 0x57, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x58, 0xd8, 0xb0, 0xb2, 0xb6, 0xb6, 0xb8, 0xb7, 0xb8, 0xb8, 0xb2, 0xba, 0x9c, 0x58, 0x49, 0x24, 0x2b, 0x2d, 0x17, 0x4b, 0xfa, 0xd9, 0xda, 0xda, 0xda, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xe3, 0xe2, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe6, 0xe3, 0xe6, 0xe5, 0xe6, 0xe6, 0xdf, 0xe0, 0xdd, 0xff, 0x53, 0x1d, 0x16, 0x89, 0x89, 0x84, 0x21, 0x3e, 0x33, 0x35, 0x2b, 0x2c, 0x42, 0xf5, 0xdd, 0xd7, 0xdf, 0xda, 0xda, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdb, 0xde, 0xe1, 0xe1, 0xdd, 0x9c, 0x4b, 0x38, 0x2c, 0x24, 0x42, 0x57, 0xe5, 0xcc, 0xd4, 0xda, 0xdb, 0xe3, 0xdf, 0xe2, 0xde, 0xe2, 0xe2, 0xde, 0xe2, 0xe2, 0xe0, 0xdf, 0xdf, 0xdf, 0xe2, 0xe1, 0xe1, 0xe2, 0xda, 0xe3, 0xd9, 0xe5, 0xf8, 0x4b, 0x29, 0x24, 0x21, 0x32, 0x1e, 0x21, 0x23, 0x18, 0x44, 0x51, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xd8, 0xaf, 0xb3, 0xb6, 0xb6, 0xb8, 0xb7, 0xba, 0xb6, 0xb2, 0xbc, 0x99, 0x55, 0x44, 0x19, 0x35, 0x23, 0x87, 0x53, 0xf7, 0xd9, 0xdb, 0xda, 0xdf, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xe2, 0xe3, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xe0, 0xe2, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe6, 0xe3, 0xe6, 0xe6, 0xe5, 0xe6, 0xe3, 0xde, 0xe7, 0x58, 0x4b, 0x17, 0x16, 0x16, 0x89, 0x8b, 0x26, 0x36, 0x33, 0x33, 0x2c, 0x2c, 0x45, 0x52, 0xe0, 0xda, 0xda, 0xdf, 0xda, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xde, 0xda, 0xde, 0xda, 0xde, 0xda, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdb, 0xde, 0xe1, 0xe1, 0xd9, 0x9c, 0x4d, 0x2e, 0x35, 0x2c, 0x40, 0x56, 0xea, 0xcc, 0xd7, 0xda, 0xdf, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xe0, 0xde, 0xdf, 0xdb, 0xde, 0xe1, 0xe1, 0xe0, 0xda, 0xe3, 0xda, 0xdd, 0xf5, 0x51, 0x39, 0x19, 0x22, 0x33, 0x1e, 0x27, 0x21, 0x18, 0x38, 0x51, 0x57, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0xdc, 0xb1, 0xb2, 0xb6, 0xb7, 0xb8, 0xb8, 0xb8, 0xba, 0xb2, 0xbd, 0x57, 0x55, 0x2e, 0x22, 0x31, 0x1c, 0x8e, 0x56, 0xf0, 0xd9, 0xdf, 0xdb, 0xda, 0xe1, 0xde, 0xe1, 0xdf, 0xdf, 0xdb, 0xdf, 0xdf, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe3, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe6, 0xe3, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xd9, 0xea, 0xfb, 0x96, 0x85, 0x16, 0x89, 0x84, 0x8b, 0x30, 0x33, 0x33, 0x33, 0x2b, 0x2c, 0x45, 0x9c, 0xe0, 0xda, 0xdf, 0xda, 0xda, 0xda, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xda, 0xdf, 0xde, 0xda, 0xde, 0xda, 0xde, 0xde, 0xde, 0xe2, 0xdf, 0xde, 0xdf, 0xde, 0xde, 0xdf, 0xdb, 0xde, 0xe1, 0xe1, 0xd9, 0xf3, 0x50, 0x39, 0x35, 0x37, 0x2e, 0x54, 0xea, 0xce, 0xd7, 0xdf, 0xde, 0xde, 0xe1, 0xe2, 0xe2, 0xe2, 0xde, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xde, 0xe5, 0xe1, 0xe5, 0xda, 0xdf, 0xe0, 0xe1, 0xeb, 0x55, 0x42, 0x17, 0x22, 0x27, 0x27, 0x27, 0x21, 0x1f, 0x2f, 0x49, 0x57, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0xdc, 0xaf, 0xb3, 0xb7, 0xb7, 0xb8, 0xb7, 0xba, 0xb6, 0xb6, 0xbb, 0x57, 0x51, 0x38, 0x18, 0x31, 0x8b, 0x91, 0x57, 0xea, 0xd9, 0xdb, 0xda, 0xdf, 0xde, 0xe1, 0xde, 0xde, 0xda, 0xdf, 0xdf, 0xde, 0xe2, 0xe2, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xe2, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xe2, 0xe2, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xe0, 0xe2, 0xe6, 0xe6, 0xe5, 0xe1, 0xe5, 0xe6, 0xe6, 0xe3, 0xe6, 0xe6, 0xe6, 0xe6, 0xe0, 0xe8, 0x01, 0x48, 0x0f, 0x16, 0x89, 0x89, 0x8b, 0x30, 0x33, 0x33, 0x33, 0x2b, 0x24, 0x45, 0xf8, 0xdd, 0xd7, 0xdf, 0xda, 0xda, 0xda, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xda, 0xde, 0xda, 0xde, 0xda, 0xde, 0xda, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xde, 0xe1, 0xe1, 0xd9, 0xf3, 0x52, 0x38, 0x35, 0x33, 0x1d, 0x55, 0xf0, 0xce, 0xda, 0xde, 0xe3, 0xde, 0xe2, 0xe6, 0xe1, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe0, 0xe2, 0xdf, 0xdf, 0xe2, 0xe1, 0xe0, 0xe0, 0xe0, 0xda, 0xe6, 0xe0, 0xe8, 0x55, 0x45, 0x17, 0x35, 0x1e, 0x27, 0x27, 0x27, 0x21, 0x18, 0x45, 0x55, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9c, 0x01, 0x01, 0xfa, 0x58, 0xe4, 0xb1, 0xb4, 0xb8, 0xb6, 0xb6, 0xb6, 0xb6, 0xb2, 0xb8, 0xbd, 0x57, 0x49, 0x18, 0x2d, 0x26, 0x81, 0x4a, 0x57, 0xd9, 0xda, 0xda, 0xdf, 0xde, 0xde, 0xde, 0xe6, 0xe6, 0xe5, 0xe6, 0xe0, 0xe1, 0xe0, 0xe1, 0xe3, 0xe3, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xe3, 0xdf, 0xdf, 0xdf, 0xdb, 0xdf, 0xe2, 0xe1, 0xe0, 0xde, 0xe0, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xe0, 0xe5, 0xe0, 0xe5, 0xe0, 0xe5, 0xe0, 0xe0, 0xe0, 0xe5, 0xe5, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe1, 0xf5, 0x56, 0x42, 0x0f, 0x89, 0x16, 0x16, 0x1f, 0x31, 0x27, 0x36, 0x33, 0x35, 0x1d, 0x48, 0xf8, 0xe0, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdf, 0xda, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdb, 0xda, 0xe1, 0xda, 0xda, 0xf0, 0x54, 0x40, 0x22, 0x35, 0x2e, 0x4b, 0xf9, 0xd5, 0xd9, 0xe6, 0xde, 0xe2, 0xe6, 0xe2, 0xe0, 0xe0, 0xe0, 0xe0, 0xe2, 0xe0, 0xe2, 0xe1, 0xe2, 0xe1, 0xe1, 0xe1, 0xe5, 0xe1, 0xe0, 0xe0, 0xdd, 0xe1, 0xe7, 0x57, 0x4a, 0x29, 0x18, 0x27, 0x1e, 0x32, 0x1e, 0x2b, 0x18, 0x2e, 0x51, 0x57, 0x01, 0xfb, 0x01, 0x58, 0x57, 0x58, 0x58, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0xff, 0x01, 0xe9, 0x0e, 0xb0, 0xb4, 0xb5, 0xb6, 0xb8, 0xba, 0xba, 0xb5, 0x1a, 0x56, 0x42, 0x19, 0x31, 0x28, 0x17, 0x4a, 0x54, 0xd9, 0xe0, 0xda, 0xe2, 0xde, 0xde, 0xd9, 0xe6, 0xd9, 0xd9, 0xd9, 0xdd, 0xe0, 0xdd, 0xe0, 0xd9, 0xe0, 0xd9, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xd9, 0xe0, 0xd9, 0xe0, 0xd9, 0xe0, 0xe0, 0xe0, 0xd9, 0xe0, 0xd9, 0xe2, 0xe0, 0xe2, 0xe0, 0xe5, 0xe1, 0xe5, 0xe1, 0xe0, 0xe0, 0xe0, 0xde, 0xe0, 0xdf, 0xde, 0xdf, 0xe2, 0xe0, 0xe1, 0xe0, 0xe2, 0xe0, 0xde, 0xe0, 0xe2, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe3, 0xe3, 0xe1, 0xe7, 0x54, 0x55, 0x39, 0x81, 0x89, 0x89, 0x1e, 0x1f, 0x31, 0x2a, 0x30, 0x32, 0x2b, 0x1d, 0x48, 0xff, 0xdd, 0xda, 0xda, 0xda, 0xdf, 0xdf, 0xdf, 0xda, 0xdf, 0xda, 0xde, 0xe0, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xe0, 0xde, 0xe0, 0xde, 0xdf, 0xda, 0xe1, 0xda, 0xda, 0xea, 0x54, 0x40, 0x2b, 0x33, 0x24, 0x97, 0xf8, 0xd5, 0xd9, 0xe3, 0xde, 0xdf, 0xe3, 0xe2, 0xe0, 0xe2, 0xe0, 0xe2, 0xe2, 0xe2, 0xde, 0xe1, 0xe2, 0xe2, 0xe0, 0xe2, 0xe1, 0xe2, 0xe1, 0xe0, 0xe1, 0xe0, 0xdd, 0xf8, 0x4e, 0x29, 0x8b, 0x2a, 0x27, 0x32, 0x1e, 0x27, 0x22, 0x1d, 0x4a, 0x56, 0x58, 0xfb, 0x58, 0x58, 0x58, 0x58, 0x58, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x4c, 0xb9, 0xb1, 0xb3, 0xb3, 0xb6, 0xb6, 0xb2, 0xb6, 0xb3, 0xc0, 0x55, 0x2e, 0x19, 0x2d, 0x1f, 0x25, 0x4e, 0x52, 0xd8, 0xd9, 0xe0, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xeb, 0xeb, 0xec, 0xec, 0xec, 0xed, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xeb, 0xec, 0xe8, 0xeb, 0xea, 0xe8, 0xea, 0xe8, 0xe7, 0xe7, 0xe7, 0xdd, 0xe5, 0xdd, 0xe5, 0xdd, 0xe0, 0xe0, 0xd9, 0xe0, 0xd9, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xde, 0xe0, 0xde, 0xd9, 0xde, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe6, 0xe3, 0xe6, 0xe1, 0xe7, 0x56, 0x53, 0x13, 0x81, 0x89, 0x16, 0x8b, 0x21, 0x31, 0x2a, 0x27, 0x30, 0x22, 0x1d, 0x45, 0xff, 0xe7, 0xd9, 0xda, 0xe1, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe1, 0xde, 0xe1, 0xe1, 0xe1, 0xde, 0xe2, 0xde, 0xde, 0xe2, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xdf, 0xe1, 0xe1, 0xe1, 0xd9, 0xf0, 0x54, 0x42, 0x22, 0x35, 0x1d, 0x48, 0xf9, 0xd9, 0xda, 0xdf, 0xdf, 0xdb, 0xdf, 0xdf, 0xdf, 0xe2, 0xde, 0xdf, 0xe3, 0xdb, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xda, 0xdf, 0xdd, 0xf5, 0x53, 0x3d, 0x15, 0x30, 0x27, 0x1e, 0x33, 0x1e, 0x1f, 0x17, 0x45, 0x55, 0x58, 0x01, 0xfb, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x01, 0x58, 0x99, 0x01, 0xf8, 0xd6, 0xca, 0xca, 0xc2, 0xbe, 0xbb, 0xb8, 0xb6, 0xb3, 0x1a, 0x93, 0x20, 0x2f, 0x37, 0x1c, 0x1c, 0x4e, 0x55, 0xed, 0xf6, 0xf7, 0xf7, 0x9c, 0xf9, 0xf9, 0xff, 0xf8, 0xf8, 0xff, 0xf8, 0x57, 0xff, 0x57, 0x56, 0x56, 0x54, 0x56, 0x54, 0x56, 0x54, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x54, 0xff, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf6, 0xf4, 0xf3, 0xf0, 0xf0, 0xeb, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xe7, 0xe7, 0xdd, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe1, 0xe0, 0xe5, 0xdd, 0xe5, 0xe5, 0xe5, 0xe1, 0xdd, 0xe9, 0x56, 0x4e, 0x11, 0x85, 0x89, 0x89, 0x1e, 0x2b, 0x2a, 0x26, 0x27, 0x32, 0x22, 0x24, 0x45, 0x56, 0xe8, 0xd9, 0xe1, 0xde, 0xe1, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe1, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe1, 0xe1, 0xe1, 0xd9, 0xeb, 0x54, 0x42, 0x31, 0x35, 0x25, 0x93, 0x99, 0xd9, 0xda, 0xe3, 0xdb, 0xdf, 0xdb, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xe0, 0xef, 0x55, 0x40, 0x17, 0x30, 0x27, 0x27, 0x27, 0x1e, 0x2b, 0x18, 0x39, 0x55, 0x57, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0x01, 0x99, 0x01, 0x99, 0x01, 0x99, 0xf9, 0xf7, 0xf4, 0xec, 0xee, 0xdc, 0xc0, 0x0e, 0x14, 0x1d, 0x2f, 0x31, 0x1c, 0x34, 0x51, 0x55, 0x54, 0x54, 0x52, 0x53, 0x4d, 0x50, 0x98, 0x4b, 0x97, 0x97, 0x48, 0x48, 0x94, 0x93, 0x93, 0x91, 0x3d, 0x91, 0x8f, 0x91, 0x8f, 0x91, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x91, 0x3d, 0x93, 0x93, 0x93, 0x93, 0x93, 0x48, 0x48, 0x96, 0x48, 0x4a, 0x97, 0x4a, 0x4d, 0x4d, 0x4d, 0x52, 0x50, 0x52, 0x53, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x57, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xf8, 0xf5, 0xf4, 0xf2, 0xed, 0xf0, 0xec, 0xec, 0xeb, 0xeb, 0xe8, 0xe8, 0xe8, 0x4c, 0x52, 0x55, 0x49, 0x0f, 0x83, 0x16, 0x89, 0x1f, 0x2b, 0x23, 0x26, 0x30, 0x27, 0x2b, 0x19, 0x42, 0x55, 0xe8, 0xda, 0xde, 0xe2, 0xdf, 0xdf, 0xda, 0xdf, 0xdb, 0xdf, 0xdf, 0xdb, 0xdf, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xde, 0xdf, 0xe1, 0xe1, 0xe1, 0xd9, 0xee, 0x55, 0x42, 0x28, 0x35, 0x25, 0x8f, 0xff, 0xe7, 0xda, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xde, 0xe2, 0xde, 0xe3, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xe0, 0xde, 0xde, 0xe0, 0xed, 0x56, 0x45, 0x85, 0x30, 0x1e, 0x27, 0x1e, 0x27, 0x27, 0x19, 0x1d, 0x51, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x01, 0xff, 0x01, 0x99, 0x99, 0xfb, 0x99, 0xfb, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x98, 0x0a, 0x8e, 0x42, 0x28, 0x34, 0x2d, 0x1c, 0x44, 0x3d, 0x91, 0x90, 0x1b, 0x87, 0x87, 0x87, 0x11, 0x7d, 0x7d, 0x74, 0x7d, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x77, 0x7d, 0x7d, 0x77, 0x7d, 0x7d, 0x87, 0x87, 0x87, 0x8e, 0x8e, 0x8e, 0x8e, 0x8f, 0x8f, 0x8f, 0x93, 0x94, 0x45, 0x48, 0x96, 0x96, 0x4b, 0x4b, 0x4d, 0x50, 0x53, 0x53, 0x55, 0x54, 0x56, 0x57, 0x56, 0x56, 0x57, 0x57, 0x57, 0x56, 0x55, 0x51, 0x29, 0x81, 0x15, 0x89, 0x16, 0x30, 0x21, 0x26, 0x26, 0x26, 0x27, 0x22, 0x24, 0x39, 0x53, 0xec, 0xd9, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdf, 0xdf, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xde, 0xe1, 0xe1, 0xdd, 0xf2, 0x55, 0x40, 0x23, 0x2d, 0x2f, 0x29, 0x54, 0xea, 0xe0, 0xe0, 0xe2, 0xdf, 0xdf, 0xe2, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xe2, 0xe0, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe1, 0xdd, 0xe8, 0x57, 0x45, 0x17, 0x21, 0x1e, 0x32, 0x1e, 0x27, 0x27, 0x28, 0x7e, 0x49, 0x57, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x99, 0x01, 0x99, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x58, 0x58, 0x57, 0x53, 0x48, 0x4a, 0x44, 0x23, 0x3a, 0x8b, 0x84, 0x81, 0x74, 0x0c, 0x74, 0x75, 0x79, 0x79, 0x79, 0x76, 0x79, 0x79, 0x7b, 0x79, 0x7b, 0x7c, 0x7b, 0x7c, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x73, 0x7b, 0x73, 0x76, 0x73, 0x79, 0x73, 0x76, 0x75, 0x73, 0x76, 0x73, 0x75, 0x76, 0x75, 0x76, 0x75, 0x71, 0x75, 0x6f, 0x75, 0x6f, 0x75, 0x75, 0x75, 0x75, 0x6e, 0x74, 0x6e, 0x7d, 0x75, 0x7d, 0x7d, 0x7d, 0x11, 0x87, 0x1b, 0x8e, 0x8e, 0x8f, 0x8f, 0x8f, 0x93, 0x93, 0x93, 0x48, 0x93, 0x93, 0x3d, 0x29, 0x79, 0x85, 0x85, 0x16, 0x1f, 0x27, 0x2a, 0x23, 0x26, 0x2a, 0x27, 0x27, 0x18, 0x25, 0x4e, 0x52, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdf, 0xda, 0xde, 0xda, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xe2, 0xde, 0xe3, 0xe3, 0xdf, 0xda, 0xe1, 0xe6, 0xdd, 0xd9, 0x54, 0x53, 0x39, 0x28, 0x22, 0x34, 0x1d, 0x51, 0xf0, 0xdd, 0xe0, 0xd9, 0xe2, 0xde, 0xde, 0xe2, 0xe0, 0xe0, 0xe2, 0xe0, 0xe2, 0xe1, 0xe5, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xdd, 0xea, 0x57, 0x96, 0x19, 0x1f, 0x1e, 0x27, 0x27, 0x27, 0x27, 0x1f, 0x18, 0x40, 0x56, 0x58, 0x01, 0x01, 0x99, 0x99, 0x01, 0x01, 0xfb, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 0xfb, 0xfb, 0x01, 0x99, 0x01, 0x01, 0x01, 0x58, 0x57, 0x57, 0x58, 0x54, 0x96, 0x42, 0x8f, 0x1c, 0x85, 0x8b, 0x82, 0x89, 0x82, 0x83, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x82, 0x7c, 0x82, 0x7b, 0x82, 0x82, 0x7b, 0x82, 0x82, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x76, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x76, 0x7c, 0x79, 0x79, 0x76, 0x75, 0x71, 0x71, 0x75, 0x71, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x85, 0x80, 0x16, 0x16, 0x1f, 0x27, 0x2a, 0x26, 0x26, 0x1f, 0x27, 0x1e, 0x22, 0x17, 0x44, 0x54, 0xf1, 0x4c, 0xeb, 0xeb, 0xe9, 0xea, 0xe8, 0xea, 0xe7, 0xe7, 0xdd, 0xe7, 0xdd, 0xe5, 0xdd, 0xe0, 0xdd, 0xdd, 0xd9, 0xdd, 0xd9, 0xe0, 0xd9, 0xd9, 0xd9, 0xd9, 0xe0, 0xe0, 0xd9, 0xd8, 0xe4, 0x57, 0x4e, 0x25, 0x28, 0x2b, 0x2c, 0x19, 0x4a, 0xf6, 0xd9, 0xdd, 0xe2, 0xe6, 0xdf, 0xde, 0xde, 0xe2, 0xe2, 0xde, 0xe3, 0xde, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe8, 0x58, 0x4a, 0x17, 0x2a, 0x1e, 0x1e, 0x27, 0x27, 0x27, 0x1e, 0x1f, 0x17, 0x55, 0x57, 0x58, 0x01, 0x99, 0x99, 0x99, 0xfb, 0x58, 0x58, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0xff, 0x99, 0x01, 0x01, 0x58, 0x57, 0x56, 0x56, 0x53, 0x48, 0x8e, 0x1b, 0x7d, 0x0f, 0x81, 0x7e, 0x84, 0x80, 0x82, 0x82, 0x82, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x82, 0x7b, 0x7b, 0x82, 0x7b, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x7b, 0x76, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7e, 0x7c, 0x81, 0x7c, 0x7e, 0x7c, 0x82, 0x82, 0x82, 0x7e, 0x83, 0x83, 0x7e, 0x85, 0x83, 0x85, 0x80, 0x80, 0x85, 0x16, 0x1e, 0x27, 0x21, 0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 0x21, 0x18, 0x1d, 0x4a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0xf5, 0xf7, 0xf5, 0xf4, 0xf2, 0xf4, 0xee, 0xf2, 0xec, 0xee, 0xec, 0xec, 0xeb, 0xeb, 0xe8, 0xe8, 0xf2, 0x57, 0x53, 0x42, 0x17, 0x28, 0x2d, 0x22, 0x22, 0x49, 0xfa, 0xdd, 0xe0, 0xe5, 0xde, 0xde, 0xe3, 0xde, 0xe2, 0xde, 0xdf, 0xdf, 0xdf, 0xe2, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe2, 0xde, 0xde, 0xde, 0xe3, 0xd9, 0xea, 0xff, 0x4a, 0x17, 0x30, 0x1e, 0x1e, 0x1e, 0x1e, 0x27, 0x21, 0x22, 0x85, 0x51, 0x57, 0x58, 0x01, 0x99, 0x99, 0x99, 0xfb, 0xfb, 0x58, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x58, 0x57, 0x57, 0x56, 0x55, 0x50, 0x93, 0x87, 0x10, 0x13, 0x81, 0x81, 0x84, 0x8b, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7b, 0x82, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7b, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7b, 0x73, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x7b, 0x76, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x83, 0x83, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x80, 0x80, 0x80, 0x80, 0x16, 0x80, 0x16, 0x8b, 0x1e, 0x21, 0x27, 0x1f, 0x1c, 0x1f, 0x21, 0x27, 0x22, 0x1f, 0x85, 0x1d, 0x1d, 0x2e, 0x39, 0x39, 0x42, 0x42, 0x45, 0x45, 0x49, 0x49, 0x4a, 0x4a, 0x4e, 0x4e, 0x50, 0x50, 0x53, 0x53, 0x52, 0x55, 0x55, 0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x57, 0x56, 0x55, 0x51, 0x3d, 0x1d, 0x19, 0x2d, 0x2b, 0x22, 0x18, 0x40, 0x57, 0xeb, 0xdc, 0xd9, 0xd9, 0xe1, 0xe1, 0xe1, 0xde, 0xde, 0xde, 0xe3, 0xe2, 0xe2, 0xe0, 0xde, 0xe0, 0xdf, 0xe2, 0xe2, 0xde, 0xe2, 0xdf, 0xe2, 0xde, 0xe0, 0xe7, 0x58, 0x4a, 0x19, 0x21, 0x1e, 0x1e, 0x21, 0x1e, 0x26, 0x27, 0x1f, 0x18, 0x45, 0x57, 0x57, 0xff, 0x01, 0x99, 0x99, 0xfb, 0x58, 0x58, 0x58, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xff, 0x58, 0x58, 0x57, 0x56, 0x55, 0x4b, 0x3d, 0x13, 0x7d, 0x13, 0x81, 0x81, 0x84, 0x83, 0x80, 0x7b, 0x80, 0x7c, 0x82, 0x7c, 0x82, 0x7c, 0x82, 0x82, 0x7c, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7b, 0x79, 0x7c, 0x76, 0x7b, 0x76, 0x7b, 0x75, 0x7b, 0x75, 0x7b, 0x75, 0x7c, 0x75, 0x7c, 0x7b, 0x7c, 0x7b, 0x79, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x83, 0x7c, 0x7c, 0x7c, 0x7c, 0x83, 0x82, 0x82, 0x82, 0x84, 0x84, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x1f, 0x8b, 0x1f, 0x21, 0x27, 0x21, 0x1f, 0x23, 0x1f, 0x2b, 0x1e, 0x1e, 0x1e, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x1d, 0x18, 0x1d, 0x17, 0x1b, 0x1b, 0x29, 0x8e, 0x29, 0x39, 0x39, 0x3d, 0x3d, 0x3d, 0x42, 0x42, 0x93, 0x42, 0x93, 0x42, 0x3d, 0x29, 0x13, 0x1c, 0x1f, 0x23, 0x26, 0x26, 0x22, 0x25, 0x53, 0x56, 0x52, 0xef, 0xeb, 0xe4, 0xe7, 0xe7, 0xe7, 0xdd, 0xdd, 0xe0, 0xdd, 0xd9, 0xdd, 0xd9, 0xdd, 0xe0, 0xdd, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xd9, 0xe7, 0x57, 0x4a, 0x19, 0x1e, 0x1e, 0x27, 0x21, 0x1f, 0x1e, 0x27, 0x22, 0x18, 0x42, 0x55, 0x57, 0x58, 0x99, 0x01, 0x99, 0xfb, 0x58, 0x58, 0x58, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x56, 0x4a, 0x8f, 0x11, 0x7d, 0x81, 0x84, 0x84, 0x84, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x7c, 0x81, 0x7c, 0x83, 0x7b, 0x82, 0x7b, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x76, 0x7c, 0x76, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7b, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x79, 0x7c, 0x83, 0x84, 0x84, 0x84, 0x84, 0x8b, 0x84, 0x85, 0x84, 0x85, 0x84, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x8b, 0x1f, 0x21, 0x27, 0x1e, 0x1f, 0x1c, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1e, 0x16, 0x1f, 0x1f, 0x1f, 0x15, 0x1c, 0x18, 0x1f, 0x18, 0x1c, 0x18, 0x1f, 0x18, 0x8b, 0x18, 0x8b, 0x19, 0x8b, 0x19, 0x18, 0x18, 0x19, 0x17, 0x19, 0x18, 0x17, 0x85, 0x17, 0x19, 0x18, 0x1f, 0x26, 0x26, 0x1f, 0x8b, 0x1f, 0x1f, 0x18, 0x39, 0x96, 0x4e, 0x55, 0x56, 0x58, 0xff, 0x57, 0xf8, 0xff, 0xf4, 0xef, 0xec, 0xeb, 0xea, 0xe8, 0xe7, 0xe7, 0xe7, 0xe4, 0xe7, 0xdd, 0xdd, 0xdd, 0xdd, 0xd8, 0xeb, 0x56, 0x49, 0x18, 0x21, 0x1e, 0x1e, 0x26, 0x26, 0x1e, 0x26, 0x27, 0x18, 0x1b, 0x53, 0x56, 0x58, 0x99, 0x99, 0x01, 0xfb, 0x58, 0x57, 0x58, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x58, 0x01, 0x58, 0x01, 0x58, 0x58, 0x56, 0x97, 0x8e, 0x10, 0x7d, 0x81, 0x85, 0x84, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x7c, 0x7c, 0x7c, 0x81, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x7b, 0x79, 0x7b, 0x7c, 0x7c, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x7c, 0x76, 0x7b, 0x7b, 0x7b, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x73, 0x7b, 0x76, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x79, 0x7b, 0x7b, 0x7c, 0x7b, 0x84, 0x84, 0x84, 0x84, 0x84, 0x7c, 0x7b, 0x75, 0x79, 0x75, 0x75, 0x79, 0x79, 0x80, 0x80, 0x89, 0x16, 0x16, 0x16, 0x15, 0x1f, 0x1f, 0x1e, 0x1e, 0x8b, 0x8b, 0x1f, 0x16, 0x1e, 0x1e, 0x16, 0x1f, 0x89, 0x1f, 0x1e, 0x16, 0x89, 0x1f, 0x16, 0x16, 0x16, 0x8b, 0x16, 0x1f, 0x89, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x21, 0x1f, 0x1f, 0x1f, 0x26, 0x16, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x89, 0x1f, 0x8b, 0x1f, 0x8b, 0x17, 0x85, 0x29, 0x8e, 0x3d, 0x45, 0x48, 0x97, 0x4e, 0x50, 0x53, 0x55, 0x54, 0x56, 0x56, 0x57, 0x57, 0x56, 0xff, 0xf8, 0xff, 0xf8, 0x54, 0xf5, 0x52, 0xf5, 0xf8, 0x55, 0x42, 0x85, 0x33, 0x1e, 0x1e, 0x1e, 0x26, 0x26, 0x1e, 0x21, 0x22, 0x11, 0x51, 0x56, 0x58, 0x99, 0xf9, 0xfb, 0x58, 0x58, 0x58, 0x58, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x58, 0x01, 0x99, 0x99, 0x01, 0xfb, 0xfb, 0xfb, 0x58, 0x58, 0x57, 0x57, 0x58, 0x57, 0x53, 0x49, 0x1b, 0x74, 0x75, 0x81, 0x85, 0x85, 0x83, 0x80, 0x82, 0x82, 0x7c, 0x82, 0x83, 0x83, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x7c, 0x79, 0x7b, 0x7c, 0x7c, 0x82, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x79, 0x7c, 0x79, 0x7b, 0x7c, 0x7b, 0x79, 0x7b, 0x79, 0x7c, 0x79, 0x7b, 0x79, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x76, 0x76, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x79, 0x76, 0x79, 0x7c, 0x84, 0x84, 0x84, 0x84, 0x7c, 0x7b, 0x76, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x73, 0x6f, 0x71, 0x71, 0x79, 0x79, 0x80, 0x16, 0x89, 0x1f, 0x16, 0x1f, 0x28, 0x2d, 0x28, 0x34, 0x23, 0x34, 0x37, 0x35, 0x3a, 0x35, 0x3a, 0x3a, 0x34, 0x3c, 0x34, 0x18, 0x16, 0x1e, 0x33, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x16, 0x15, 0x16, 0x16, 0x16, 0x16, 0x1e, 0x16, 0x15, 0x15, 0x8b, 0x16, 0x1e, 0x16, 0x1e, 0x8b, 0x8b, 0x15, 0x18, 0x22, 0x1f, 0x1c, 0x15, 0x85, 0x85, 0x13, 0x0f, 0x13, 0x13, 0x13, 0x1b, 0x1b, 0x8e, 0x29, 0x3d, 0x3d, 0x45, 0x45, 0x49, 0x4a, 0x4a, 0x51, 0x4e, 0x51, 0x51, 0x51, 0x51, 0x51, 0x49, 0x37, 0x18, 0x1e, 0x21, 0x1e, 0x1e, 0x27, 0x1e, 0x26, 0x21, 0x1f, 0x17, 0x45, 0x56, 0x57, 0xfb, 0xf9, 0xfb, 0xfb, 0x57, 0x57, 0x58, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x58, 0xfb, 0x57, 0x58, 0x01, 0x99, 0x01, 0x01, 0xf9, 0xfb, 0xfb, 0x58, 0x57, 0x56, 0x56, 0x50, 0x93, 0x87, 0x7c, 0x75, 0x79, 0x85, 0x83, 0x7e, 0x80, 0x80, 0x82, 0x82, 0x7c, 0x82, 0x7c, 0x82, 0x7b, 0x83, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x7b, 0x7c, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x7c, 0x7b, 0x79, 0x7c, 0x76, 0x7b, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x76, 0x75, 0x7b, 0x75, 0x7b, 0x85, 0x84, 0x84, 0x7c, 0x79, 0x7b, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x71, 0x6f, 0x6f, 0x71, 0x79, 0x76, 0x79, 0x79, 0x79, 0x80, 0x89, 0x1f, 0x1f, 0x1f, 0x26, 0x3a, 0x41, 0x3c, 0x3c, 0x3a, 0x3c, 0x41, 0x41, 0x3a, 0x3a, 0x31, 0x2d, 0x28, 0x2f, 0x34, 0x37, 0x35, 0x35, 0x2b, 0x41, 0x1f, 0x15, 0x15, 0x15, 0x89, 0x15, 0x1e, 0x18, 0x16, 0x18, 0x8b, 0x15, 0x8b, 0x8b, 0x16, 0x21, 0x16, 0x27, 0x16, 0x1c, 0x8b, 0x1f, 0x16, 0x1e, 0x16, 0x1f, 0x18, 0x1f, 0x18, 0x16, 0x18, 0x16, 0x15, 0x80, 0x16, 0x15, 0x16, 0x15, 0x15, 0x15, 0x85, 0x15, 0x85, 0x8b, 0x15, 0x7e, 0x80, 0x85, 0x7e, 0x85, 0x85, 0x17, 0x85, 0x17, 0x19, 0x1d, 0x1d, 0x25, 0x1f, 0x22, 0x8b, 0x22, 0x2b, 0x1e, 0x27, 0x1e, 0x27, 0x27, 0x27, 0x26, 0x26, 0x85, 0x42, 0x55, 0x57, 0xfb, 0xfa, 0xfb, 0x01, 0x57, 0x57, 0x57, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0xfb, 0xfb, 0x58, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x99, 0x57, 0x56, 0x50, 0x3d, 0x11, 0x74, 0x0f, 0x75, 0x81, 0x81, 0x84, 0x85, 0x84, 0x80, 0x83, 0x82, 0x83, 0x7c, 0x83, 0x82, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7c, 0x7e, 0x7c, 0x80, 0x7c, 0x7e, 0x7b, 0x7e, 0x7b, 0x79, 0x7c, 0x7c, 0x79, 0x7b, 0x79, 0x7c, 0x7b, 0x7c, 0x7c, 0x7b, 0x7c, 0x79, 0x7b, 0x7c, 0x7c, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x76, 0x7b, 0x7b, 0x79, 0x7b, 0x7c, 0x7b, 0x7b, 0x79, 0x7b, 0x7c, 0x79, 0x7b, 0x7c, 0x7c, 0x7c, 0x79, 0x76, 0x79, 0x7c, 0x82, 0x83, 0x84, 0x84, 0x7c, 0x76, 0x76, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x71, 0x6f, 0x71, 0x76, 0x76, 0x71, 0x71, 0x71, 0x79, 0x7e, 0x89, 0x8b, 0x8b, 0x1f, 0x1f, 0x21, 0x1e, 0x26, 0x26, 0x1f, 0x1f, 0x28, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x21, 0x2b, 0x1f, 0x8b, 0x1f, 0x2a, 0x36, 0x2b, 0x16, 0x1f, 0x34, 0x3c, 0x3a, 0x31, 0x30, 0x30, 0x35, 0x30, 0x35, 0x31, 0x31, 0x31, 0x2d, 0x26, 0x23, 0x31, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x2a, 0x30, 0x27, 0x2a, 0x1f, 0x23, 0x1f, 0x23, 0x1f, 0x1e, 0x16, 0x1e, 0x15, 0x16, 0x16, 0x15, 0x15, 0x16, 0x1e, 0x16, 0x1e, 0x16, 0x1e, 0x16, 0x1e, 0x18, 0x1e, 0x18, 0x1e, 0x18, 0x21, 0x1f, 0x1f, 0x8b, 0x8b, 0x16, 0x8b, 0x15, 0x8b, 0x1f, 0x1f, 0x16, 0x27, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x19, 0x25, 0x55, 0x56, 0xfb, 0xfb, 0xfa, 0x01, 0x58, 0x57, 0x58, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0xfa, 0x58, 0x01, 0xff, 0x01, 0x01, 0x57, 0x4d, 0x93, 0x7d, 0x74, 0x0f, 0x81, 0x84, 0x81, 0x84, 0x85, 0x83, 0x80, 0x84, 0x82, 0x80, 0x82, 0x83, 0x82, 0x7c, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x82, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x79, 0x79, 0x7c, 0x7b, 0x79, 0x7b, 0x7c, 0x7c, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x79, 0x7c, 0x79, 0x79, 0x79, 0x79, 0x7c, 0x79, 0x7c, 0x7e, 0x79, 0x79, 0x79, 0x79, 0x7c, 0x7c, 0x7c, 0x82, 0x84, 0x82, 0x82, 0x76, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x6f, 0x71, 0x71, 0x76, 0x76, 0x71, 0x6f, 0x79, 0x71, 0x79, 0x7e, 0x89, 0x8b, 0x1c, 0x23, 0x1f, 0x1f, 0x1f, 0x1f, 0x2b, 0x2b, 0x22, 0x1f, 0x2c, 0x2d, 0x22, 0x22, 0x27, 0x22, 0x27, 0x22, 0x1e, 0x21, 0x21, 0x1e, 0x1e, 0x26, 0x26, 0x8b, 0x15, 0x23, 0x34, 0x3a, 0x3a, 0x33, 0x21, 0x1e, 0x1f, 0x1e, 0x21, 0x21, 0x21, 0x21, 0x8b, 0x1f, 0x8b, 0x8b, 0x8b, 0x8b, 0x1f, 0x89, 0x1e, 0x16, 0x16, 0x16, 0x8b, 0x8b, 0x1c, 0x8b, 0x1f, 0x1e, 0x1f, 0x19, 0x1c, 0x19, 0x19, 0x28, 0x19, 0x1c, 0x19, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x18, 0x1f, 0x1f, 0x1f, 0x8b, 0x1f, 0x21, 0x89, 0x1f, 0x1e, 0x1e, 0x21, 0x21, 0x26, 0x2a, 0x26, 0x21, 0x1e, 0x1e, 0x1e, 0x1e, 0x21, 0x27, 0x21, 0x26, 0x1f, 0x23, 0x17, 0x4e, 0x57, 0x58, 0xfa, 0xfb, 0x01, 0x58, 0x58, 0x58, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0x58, 0x58, 0x58, 0x57, 0x50, 0x48, 0x87, 0x77, 0x75, 0x81, 0x84, 0x80, 0x83, 0x7c, 0x7c, 0x7c, 0x84, 0x83, 0x80, 0x83, 0x82, 0x83, 0x7c, 0x83, 0x7c, 0x7c, 0x80, 0x80, 0x80, 0x7c, 0x80, 0x7c, 0x80, 0x7c, 0x80, 0x7c, 0x80, 0x7c, 0x80, 0x79, 0x82, 0x79, 0x7c, 0x7c, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x79, 0x7b, 0x7c, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x76, 0x7b, 0x76, 0x7b, 0x7c, 0x79, 0x7c, 0x79, 0x7e, 0x79, 0x79, 0x7c, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7c, 0x83, 0x83, 0x7c, 0x7c, 0x76, 0x71, 0x6f, 0x6f, 0x71, 0x6f, 0x6f, 0x71, 0x6f, 0x76, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x79, 0x79, 0x80, 0x8b, 0x8b, 0x23, 0x23, 0x23, 0x1f, 0x1c, 0x1f, 0x1f, 0x1f, 0x22, 0x24, 0x2c, 0x2f, 0x19, 0x2f, 0x24, 0x24, 0x22, 0x22, 0x22, 0x19, 0x22, 0x1f, 0x21, 0x26, 0x1f, 0x26, 0x26, 0x23, 0x23, 0x1c, 0x8b, 0x2d, 0x36, 0x27, 0x1e, 0x1e, 0x21, 0x1e, 0x1e, 0x1e, 0x1e, 0x21, 0x1f, 0x8b, 0x85, 0x85, 0x81, 0x15, 0x15, 0x16, 0x15, 0x8b, 0x8b, 0x8b, 0x17, 0x8b, 0x8b, 0x8b, 0x89, 0x1e, 0x16, 0x19, 0x13, 0x0b, 0x0f, 0x7d, 0x87, 0x13, 0x87, 0x17, 0x1b, 0x19, 0x1d, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x1c, 0x28, 0x1f, 0x26, 0x1f, 0x1f, 0x1e, 0x1f, 0x1f, 0x16, 0x21, 0x26, 0x27, 0x21, 0x1e, 0x27, 0x1e, 0x27, 0x2b, 0x21, 0x22, 0x28, 0x17, 0x4a, 0x56, 0x58, 0xfb, 0x99, 0xfb, 0x01, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x55, 0x96, 0x8e, 0x7d, 0x81, 0x79, 0x83, 0x83, 0x83, 0x7c, 0x83, 0x84, 0x7c, 0x83, 0x83, 0x84, 0x82, 0x83, 0x82, 0x7c, 0x83, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x82, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x7c, 0x7b, 0x79, 0x7b, 0x7c, 0x7c, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7b, 0x7b, 0x75, 0x76, 0x7d, 0x7c, 0x75, 0x76, 0x73, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x6f, 0x71, 0x6f, 0x71, 0x71, 0x6f, 0x71, 0x71, 0x79, 0x7e, 0x89, 0x8b, 0x23, 0x23, 0x26, 0x23, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x21, 0x23, 0x24, 0x13, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x29, 0x2e, 0x29, 0x2e, 0x2e, 0x29, 0x25, 0x1c, 0x1c, 0x1f, 0x28, 0x26, 0x1c, 0x8b, 0x23, 0x23, 0x2b, 0x33, 0x33, 0x1e, 0x1f, 0x21, 0x1e, 0x27, 0x1e, 0x21, 0x1e, 0x31, 0x15, 0x6e, 0x75, 0x6e, 0x75, 0x0f, 0x79, 0x0f, 0x0f, 0x81, 0x7d, 0x81, 0x13, 0x13, 0x1c, 0x8b, 0x1e, 0x1f, 0x1d, 0x17, 0x6e, 0x03, 0x03, 0x5d, 0x02, 0x02, 0x03, 0x03, 0x05, 0x09, 0x09, 0x09, 0x0c, 0x10, 0x10, 0x11, 0x1b, 0x1b, 0x1d, 0x25, 0x2f, 0x2f, 0x37, 0x2f, 0x37, 0x37, 0x2c, 0x35, 0x2c, 0x35, 0x2b, 0x2b, 0x2b, 0x2b, 0x22, 0x21, 0x22, 0x22, 0x17, 0x45, 0x55, 0x58, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x58, 0x01, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0xff, 0x58, 0x50, 0x91, 0x11, 0x0f, 0x7e, 0x80, 0x80, 0x82, 0x84, 0x7b, 0x7c, 0x7c, 0x83, 0x84, 0x84, 0x82, 0x82, 0x83, 0x82, 0x83, 0x83, 0x7c, 0x83, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x82, 0x7c, 0x82, 0x7b, 0x82, 0x7b, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x7c, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x76, 0x7b, 0x7b, 0x7b, 0x79, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x76, 0x76, 0x7b, 0x7b, 0x73, 0x71, 0x6f, 0x6f, 0x6f, 0x73, 0x6c, 0x72, 0x6c, 0x72, 0x6f, 0x6f, 0x6f, 0x71, 0x71, 0x71, 0x71, 0x71, 0x79, 0x7e, 0x84, 0x8b, 0x23, 0x23, 0x1f, 0x23, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1b, 0x06, 0x05, 0x09, 0x0a, 0x0a, 0x0d, 0x0a, 0x0d, 0x0d, 0x10, 0x14, 0x12, 0x20, 0x29, 0x25, 0x25, 0x28, 0x2c, 0x26, 0x1f, 0x26, 0x1f, 0x21, 0x35, 0x2b, 0x21, 0x1f, 0x21, 0x21, 0x1e, 0x27, 0x1e, 0x26, 0x28, 0x8b, 0x6e, 0x67, 0x74, 0x7d, 0x7d, 0x11, 0x11, 0x87, 0x11, 0x87, 0x77, 0x87, 0x7d, 0x19, 0x1c, 0x1f, 0x22, 0x22, 0x24, 0x17, 0x17, 0x09, 0x03, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b, 0x5d, 0x5d, 0x5d, 0x02, 0x02, 0x03, 0x05, 0x05, 0x09, 0x0b, 0x0c, 0x10, 0x0f, 0x11, 0x17, 0x1d, 0x1d, 0x2f, 0x38, 0x38, 0x3c, 0x37, 0x3c, 0x37, 0x3c, 0x2c, 0x1d, 0x42, 0x55, 0x57, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x58, 0x58, 0xff, 0x01, 0x57, 0x58, 0x01, 0x56, 0x97, 0x8e, 0x10, 0x75, 0x7e, 0x80, 0x82, 0x89, 0x82, 0x82, 0x84, 0x7c, 0x83, 0x83, 0x82, 0x83, 0x82, 0x7c, 0x82, 0x7c, 0x82, 0x7c, 0x83, 0x7c, 0x83, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x82, 0x7b, 0x7c, 0x7b, 0x7c, 0x7b, 0x82, 0x7b, 0x82, 0x7b, 0x7b, 0x7b, 0x7c, 0x7b, 0x79, 0x7b, 0x7c, 0x7c, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7b, 0x7c, 0x7b, 0x79, 0x7b, 0x76, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x6c, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x73, 0x6f, 0x73, 0x6c, 0x73, 0x6f, 0x71, 0x71, 0x6f, 0x71, 0x71, 0x79, 0x80, 0x84, 0x1c, 0x23, 0x23, 0x23, 0x1f, 0x26, 0x1f, 0x1f, 0x26, 0x26, 0x26, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x28, 0x20, 0x04, 0x02, 0xfc, 0xfc, 0xfc, 0xfc, 0x04, 0x04, 0x04, 0xfc, 0x04, 0x04, 0x0a, 0x12, 0x20, 0x29, 0x24, 0x2c, 0x2b, 0x22, 0x27, 0x21, 0x2a, 0x3a, 0x26, 0x1f, 0x23, 0x1f, 0x1f, 0x21, 0x21, 0x27, 0x89, 0x2d, 0x34, 0x17, 0x6c, 0x77, 0x87, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8c, 0x8e, 0x87, 0x29, 0x19, 0x15, 0x1e, 0x22, 0x22, 0x18, 0x0f, 0x13, 0x1b, 0x10, 0x09, 0x03, 0x02, 0x5b, 0x5b, 0xfd, 0x5a, 0x59, 0x5b, 0x5a, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5d, 0x02, 0x02, 0x02, 0x03, 0x03, 0x05, 0x06, 0x06, 0x0b, 0x0f, 0x13, 0x17, 0x1d, 0x1d, 0x8f, 0x50, 0x01, 0x01, 0x01, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0x58, 0x58, 0x56, 0xff, 0x57, 0x57, 0x45, 0x7d, 0x6e, 0x81, 0x85, 0x79, 0x82, 0x82, 0x82, 0x82, 0x84, 0x83, 0x83, 0x83, 0x82, 0x84, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x7c, 0x83, 0x7c, 0x83, 0x82, 0x7c, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7c, 0x82, 0x7c, 0x82, 0x79, 0x82, 0x79, 0x7c, 0x7c, 0x7c, 0x7b, 0x82, 0x7b, 0x82, 0x7b, 0x82, 0x7b, 0x7b, 0x7c, 0x79, 0x7b, 0x79, 0x7b, 0x7c, 0x7c, 0x79, 0x7b, 0x79, 0x7b, 0x79, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x76, 0x73, 0x73, 0x73, 0x6c, 0x6f, 0x7b, 0x7b, 0x76, 0x71, 0x76, 0x71, 0x6f, 0x76, 0x76, 0x73, 0x6f, 0x71, 0x76, 0x71, 0x71, 0x79, 0x82, 0x8b, 0x1c, 0x23, 0x23, 0x26, 0x23, 0x1f, 0x1f, 0x1f, 0x21, 0x26, 0x26, 0x1f, 0x26, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x2d, 0x1b, 0x04, 0xa1, 0x04, 0xa8, 0xa2, 0xa1, 0xa2, 0xa3, 0xfc, 0xfc, 0xa4, 0xa6, 0xfc, 0x07, 0x0d, 0x1b, 0x2e, 0x35, 0x22, 0x32, 0x1e, 0x27, 0x2a, 0x3a, 0x23, 0x23, 0x8b, 0x26, 0x1f, 0x26, 0x1e, 0x26, 0x2a, 0x8b, 0x1c, 0x40, 0x44, 0x8d, 0x8d, 0x14, 0x8a, 0x8a, 0x14, 0x8a, 0x8a, 0x12, 0x8a, 0x1b, 0x39, 0x3c, 0x2c, 0x2b, 0x1e, 0x41, 0x36, 0x85, 0x6e, 0x06, 0x13, 0x1b, 0x1b, 0x12, 0x10, 0x09, 0x06, 0x02, 0x5d, 0x5b, 0x5b, 0x5b, 0x5a, 0x5b, 0x5b, 0x5b, 0x59, 0x59, 0x9b, 0x9d, 0xfd, 0xfd, 0x59, 0xfd, 0xfd, 0x5a, 0x5b, 0x5a, 0x5b, 0x5b, 0x5d, 0x5d, 0x5d, 0x02, 0x02, 0x03, 0x95, 0x58, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0x01, 0xff, 0x58, 0x56, 0x56, 0x56, 0x91, 0x6e, 0x85, 0x1c, 0x79, 0x7c, 0x84, 0x84, 0x83, 0x82, 0x83, 0x82, 0x80, 0x80, 0x82, 0x83, 0x83, 0x83, 0x82, 0x7c, 0x82, 0x7c, 0x83, 0x7c, 0x83, 0x7c, 0x83, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7c, 0x7e, 0x7c, 0x7e, 0x79, 0x81, 0x79, 0x7c, 0x79, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x7b, 0x82, 0x7c, 0x7b, 0x7b, 0x79, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7b, 0x75, 0x6f, 0x6f, 0x1c, 0x85, 0x7c, 0x80, 0x84, 0x89, 0x84, 0x82, 0x79, 0x79, 0x71, 0x71, 0x71, 0x6f, 0x76, 0x79, 0x82, 0x89, 0x23, 0x23, 0x26, 0x23, 0x1f, 0x1f, 0x21, 0x1f, 0x21, 0x26, 0x21, 0x26, 0x1f, 0x2a, 0x26, 0x1f, 0x1f, 0x26, 0x26, 0x26, 0x28, 0x8e, 0x08, 0x02, 0xa1, 0xfc, 0xa3, 0xa2, 0xa2, 0xfc, 0xa2, 0xa2, 0xa2, 0xa2, 0xfc, 0x04, 0x0a, 0x10, 0x2e, 0x41, 0x33, 0x27, 0x27, 0x27, 0x26, 0x3a, 0x23, 0x1f, 0x23, 0x23, 0x1f, 0x21, 0x1f, 0x26, 0x23, 0x23, 0x25, 0x34, 0x40, 0x49, 0x4a, 0x45, 0x93, 0x91, 0x8f, 0x8e, 0x20, 0x20, 0x8e, 0x8e, 0x40, 0x38, 0x24, 0x1f, 0x26, 0x31, 0x23, 0x2d, 0x8b, 0x7b, 0x03, 0x67, 0x6e, 0x17, 0x2e, 0x38, 0x2e, 0x25, 0x13, 0x11, 0x06, 0x03, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x00, 0x9d, 0x5b, 0x9e, 0x9d, 0x9d, 0x9b, 0x5a, 0x9d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x00, 0x59, 0x3b, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x58, 0x56, 0x57, 0x53, 0x8e, 0x09, 0x7e, 0x15, 0x80, 0x15, 0x84, 0x7c, 0x7b, 0x83, 0x7b, 0x84, 0x83, 0x84, 0x80, 0x84, 0x83, 0x84, 0x83, 0x83, 0x83, 0x7c, 0x83, 0x82, 0x83, 0x82, 0x80, 0x83, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x81, 0x7e, 0x81, 0x81, 0x0f, 0x81, 0x74, 0x7d, 0x75, 0x7d, 0x75, 0x81, 0x75, 0x79, 0x75, 0x79, 0x79, 0x79, 0x7b, 0x7c, 0x7b, 0x7c, 0x7c, 0x79, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x76, 0x76, 0x75, 0x75, 0x7d, 0x7d, 0x11, 0x7d, 0x11, 0x11, 0x0f, 0x6e, 0x75, 0x7e, 0x7e, 0x80, 0x79, 0x79, 0x79, 0x71, 0x79, 0x80, 0x89, 0x23, 0x23, 0x23, 0x1f, 0x8b, 0x21, 0x1f, 0x21, 0x1f, 0x21, 0x1f, 0x26, 0x26, 0x1f, 0x2a, 0x1f, 0x2a, 0x26, 0x1f, 0x26, 0x2a, 0x1f, 0x31, 0x38, 0x1b, 0x10, 0x0d, 0x09, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0x07, 0x07, 0x0a, 0x06, 0x10, 0x24, 0x37, 0x33, 0x27, 0x27, 0x21, 0x26, 0x3a, 0x2d, 0x1f, 0x1f, 0x21, 0x26, 0x26, 0x21, 0x21, 0x1f, 0x26, 0x2d, 0x1c, 0x85, 0x8b, 0x34, 0x39, 0x40, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x44, 0x44, 0x3c, 0x26, 0x28, 0x8b, 0x34, 0x1c, 0x1c, 0x34, 0x34, 0x3c, 0x1c, 0x6e, 0x67, 0x67, 0x6c, 0x0f, 0x1d, 0x25, 0x25, 0x38, 0x29, 0x29, 0x1b, 0x77, 0x05, 0x60, 0x5d, 0x5d, 0x5b, 0x5a, 0x59, 0x5a, 0x5a, 0x5a, 0x9b, 0x9a, 0x9a, 0x9b, 0x9b, 0x9b, 0x5a, 0x9b, 0x5d, 0x5a, 0x59, 0x0e, 0x01, 0x01, 0x01, 0xfb, 0x58, 0xfb, 0x58, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0xfb, 0x99, 0xfb, 0x01, 0x01, 0x57, 0x97, 0x12, 0x06, 0x0f, 0x17, 0x80, 0x83, 0x83, 0x80, 0x84, 0x82, 0x82, 0x84, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7c, 0x83, 0x7c, 0x83, 0x82, 0x83, 0x82, 0x82, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x75, 0x7d, 0x74, 0x7d, 0x74, 0x74, 0x74, 0x7d, 0x77, 0x7d, 0x7d, 0x7d, 0x74, 0x81, 0x7d, 0x79, 0x81, 0x79, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x79, 0x79, 0x0f, 0x13, 0x1b, 0x1b, 0x14, 0x14, 0x20, 0x8e, 0x1b, 0x13, 0x0f, 0x75, 0x7e, 0x79, 0x71, 0x79, 0x71, 0x16, 0x89, 0x23, 0x23, 0x26, 0x89, 0x1f, 0x1f, 0x26, 0x26, 0x27, 0x21, 0x21, 0x26, 0x1f, 0x26, 0x26, 0x23, 0x2a, 0x26, 0x26, 0x26, 0x26, 0x1f, 0x1f, 0x26, 0x2c, 0x38, 0x38, 0x40, 0x29, 0x8e, 0x12, 0x12, 0x12, 0x1b, 0x12, 0x12, 0x12, 0x14, 0x10, 0x12, 0x1d, 0x38, 0x37, 0x2b, 0x2b, 0x26, 0x1f, 0x26, 0x3a, 0x2b, 0x26, 0x26, 0x26, 0x21, 0x21, 0x27, 0x27, 0x21, 0x1f, 0x1f, 0x2d, 0x31, 0x1c, 0x15, 0x1f, 0x1c, 0x1f, 0x18, 0x1f, 0x15, 0x19, 0x8b, 0x19, 0x1c, 0x23, 0x1f, 0x26, 0x1c, 0x34, 0x3a, 0x23, 0x1f, 0x1f, 0x89, 0x23, 0x3a, 0x34, 0x8b, 0x0f, 0x6c, 0x67, 0x6e, 0x0f, 0x13, 0x17, 0x13, 0x1d, 0x29, 0x29, 0x39, 0x29, 0x81, 0x0b, 0x06, 0x03, 0x5d, 0x5b, 0x5b, 0x5b, 0x9d, 0x5b, 0x9d, 0x5b, 0x9b, 0xfd, 0x59, 0x00, 0x9b, 0x00, 0xfe, 0xf5, 0x01, 0x01, 0x58, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x58, 0x01, 0x01, 0xfb, 0x99, 0x01, 0x01, 0x4d, 0x20, 0x14, 0x10, 0x11, 0x0f, 0x81, 0x85, 0x85, 0x80, 0x80, 0x89, 0x80, 0x80, 0x82, 0x84, 0x83, 0x7c, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x83, 0x80, 0x83, 0x82, 0x83, 0x83, 0x81, 0x7d, 0x7d, 0x74, 0x74, 0x09, 0x74, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x05, 0x09, 0x06, 0x09, 0x06, 0x09, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x7d, 0x81, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x79, 0x75, 0x11, 0x13, 0x12, 0x0c, 0x05, 0x5d, 0xfd, 0x5b, 0x02, 0x07, 0x10, 0x20, 0x13, 0x0f, 0x0f, 0x7e, 0x71, 0x15, 0x1c, 0x26, 0x1f, 0x1f, 0x8b, 0x21, 0x1f, 0x26, 0x21, 0x21, 0x21, 0x21, 0x27, 0x26, 0x26, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x1f, 0x26, 0x1f, 0x1f, 0x1f, 0x36, 0x3e, 0x37, 0x37, 0x2f, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2e, 0x38, 0x2e, 0x2e, 0x2e, 0x39, 0x38, 0x37, 0x3c, 0x31, 0x2d, 0x26, 0x1f, 0x26, 0x3a, 0x2b, 0x2b, 0x21, 0x27, 0x27, 0x27, 0x21, 0x27, 0x21, 0x27, 0x2a, 0x21, 0x21, 0x35, 0x30, 0x27, 0x27, 0x27, 0x33, 0x2b, 0x35, 0x2d, 0x28, 0x23, 0x2d, 0x26, 0x26, 0x36, 0x22, 0x31, 0x22, 0x21, 0x27, 0x21, 0x2a, 0x26, 0x1f, 0x23, 0x23, 0x34, 0x25, 0x1c, 0x7d, 0x6e, 0x67, 0x67, 0x75, 0x0f, 0x85, 0x17, 0x18, 0x19, 0x24, 0x2f, 0x25, 0x13, 0x0f, 0x0b, 0x03, 0x02, 0x5b, 0x5b, 0xfd, 0xfd, 0xfd, 0x5b, 0xfd, 0x9b, 0x9b, 0x00, 0xa1, 0x4c, 0x01, 0x01, 0xfb, 0x58, 0x58, 0x58, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xf9, 0x01, 0x01, 0x4c, 0xc0, 0x1a, 0x0e, 0x0e, 0x0a, 0x7a, 0x0c, 0x7d, 0x11, 0x7e, 0x80, 0x82, 0x89, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7c, 0x83, 0x84, 0x80, 0x80, 0x80, 0x82, 0x83, 0x81, 0x7d, 0x77, 0x77, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x0a, 0x07, 0x08, 0x08, 0x08, 0x04, 0x08, 0x08, 0x04, 0x08, 0x07, 0x07, 0x07, 0x07, 0x05, 0x07, 0x05, 0x07, 0x09, 0x09, 0x77, 0x7d, 0x7d, 0x81, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x82, 0x7b, 0x82, 0x7b, 0x83, 0x7c, 0x79, 0x82, 0x7b, 0x75, 0x81, 0x12, 0x0d, 0x0d, 0x1a, 0x5d, 0x00, 0x59, 0xfd, 0x00, 0x00, 0x9e, 0x02, 0x12, 0x12, 0x0f, 0x85, 0x16, 0x23, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x26, 0x1f, 0x1f, 0x1f, 0x21, 0x26, 0x26, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x26, 0x26, 0x21, 0x26, 0x21, 0x35, 0x30, 0x35, 0x2d, 0x31, 0x24, 0x37, 0x2c, 0x37, 0x2c, 0x37, 0x37, 0x37, 0x38, 0x37, 0x37, 0x37, 0x31, 0x31, 0x1f, 0x26, 0x1f, 0x2b, 0x3a, 0x31, 0x21, 0x21, 0x21, 0x2a, 0x21, 0x2a, 0x27, 0x2b, 0x2a, 0x2b, 0x26, 0x2a, 0x21, 0x21, 0x30, 0x30, 0x27, 0x30, 0x27, 0x2b, 0x2a, 0x31, 0x2a, 0x2a, 0x26, 0x26, 0x2a, 0x2b, 0x35, 0x30, 0x21, 0x21, 0x26, 0x21, 0x1f, 0x26, 0x1f, 0x23, 0x1c, 0x23, 0x23, 0x34, 0x28, 0x1c, 0x85, 0x0b, 0x6e, 0x06, 0x06, 0x0b, 0x0f, 0x7e, 0x13, 0x1c, 0x1c, 0x25, 0x25, 0x19, 0x0f, 0x0b, 0x06, 0x03, 0x5d, 0x5b, 0xfd, 0x5a, 0x9b, 0x9a, 0x5a, 0x9f, 0x95, 0x01, 0x99, 0xfb, 0x57, 0x57, 0x57, 0x57, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xff, 0x01, 0x01, 0x01, 0x4c, 0xa8, 0xa0, 0x9f, 0x9e, 0x9f, 0x9f, 0x02, 0x07, 0x0c, 0x10, 0x81, 0x85, 0x80, 0x82, 0x82, 0x80, 0x82, 0x83, 0x83, 0x84, 0x7c, 0x84, 0x82, 0x80, 0x80, 0x80, 0x84, 0x80, 0x81, 0x7d, 0x7a, 0x09, 0x08, 0x08, 0x08, 0xfe, 0xfe, 0xfe, 0xaf, 0xfe, 0xae, 0xfe, 0xac, 0xac, 0xac, 0xab, 0xab, 0xac, 0xab, 0xac, 0xac, 0xfe, 0xaa, 0xfe, 0xaa, 0x08, 0x04, 0x04, 0x04, 0x07, 0x09, 0x09, 0x77, 0x74, 0x7d, 0x7c, 0x81, 0x79, 0x7c, 0x7b, 0x82, 0x7b, 0x7b, 0x7c, 0x79, 0x80, 0x7c, 0x7b, 0x7c, 0x87, 0x0d, 0x0e, 0x46, 0x4c, 0xa8, 0x00, 0x00, 0x59, 0x9a, 0x59, 0x00, 0x59, 0x02, 0x10, 0x13, 0x85, 0x22, 0x27, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x1f, 0x26, 0x1f, 0x1f, 0x26, 0x26, 0x21, 0x26, 0x26, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2b, 0x2b, 0x35, 0x35, 0x3a, 0x35, 0x35, 0x35, 0x35, 0x33, 0x35, 0x35, 0x35, 0x35, 0x2b, 0x35, 0x3a, 0x35, 0x35, 0x2b, 0x1f, 0x2b, 0x1f, 0x2a, 0x3a, 0x31, 0x1f, 0x26, 0x21, 0x2a, 0x21, 0x2a, 0x2b, 0x26, 0x2a, 0x21, 0x2a, 0x26, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x30, 0x2a, 0x30, 0x2a, 0x30, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x26, 0x36, 0x31, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x26, 0x26, 0x1f, 0x23, 0x31, 0x34, 0x1f, 0x19, 0x85, 0x0b, 0x06, 0x67, 0x06, 0x06, 0x6e, 0x7d, 0x85, 0x1c, 0x19, 0x28, 0x24, 0x17, 0x11, 0x10, 0x06, 0x03, 0x5d, 0x5b, 0x5a, 0x5a, 0x5b, 0x92, 0x01, 0x01, 0x01, 0x58, 0x56, 0x57, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x99, 0x01, 0x01, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9d, 0xfd, 0x5b, 0x02, 0x0c, 0x11, 0x7e, 0x84, 0x82, 0x80, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84, 0x82, 0x82, 0x80, 0x85, 0x13, 0x7d, 0x0c, 0x09, 0x0a, 0x08, 0x08, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb3, 0xb4, 0xb1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1, 0xb1, 0xae, 0xac, 0xac, 0xac, 0xaa, 0xaa, 0xac, 0xfe, 0xfe, 0x08, 0x07, 0x07, 0x09, 0x09, 0x74, 0x7d, 0x7d, 0x7d, 0x79, 0x7c, 0x7b, 0x82, 0x7c, 0x7c, 0x79, 0x80, 0x79, 0x7b, 0x87, 0x0c, 0x14, 0x46, 0x4f, 0xf1, 0x95, 0xfc, 0x9e, 0x00, 0x9a, 0x9d, 0x9a, 0x59, 0x59, 0x02, 0x13, 0x0f, 0x1f, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x1f, 0x26, 0x21, 0x26, 0x21, 0x21, 0x26, 0x26, 0x26, 0x21, 0x26, 0x21, 0x26, 0x26, 0x26, 0x21, 0x2a, 0x30, 0x35, 0x36, 0x3a, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x33, 0x35, 0x35, 0x35, 0x35, 0x2b, 0x1f, 0x1f, 0x2b, 0x1f, 0x2a, 0x3a, 0x31, 0x1f, 0x26, 0x21, 0x2b, 0x26, 0x2a, 0x2a, 0x26, 0x2b, 0x26, 0x2a, 0x21, 0x2a, 0x2a, 0x2a, 0x2a, 0x30, 0x2a, 0x30, 0x30, 0x30, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x26, 0x36, 0x2a, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x1f, 0x26, 0x26, 0x23, 0x28, 0x23, 0x25, 0x25, 0x25, 0x17, 0x75, 0x06, 0x03, 0x03, 0x03, 0x0b, 0x0f, 0x17, 0x17, 0x25, 0x25, 0x25, 0x1d, 0x13, 0x7d, 0x05, 0x03, 0x02, 0x5b, 0x3b, 0x58, 0x01, 0xfb, 0x58, 0x58, 0x58, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0xa6, 0x00, 0x9e, 0x9f, 0x9e, 0x00, 0x00, 0x9b, 0x9e, 0xfd, 0x59, 0x03, 0x7d, 0x13, 0x83, 0x80, 0x82, 0x80, 0x82, 0x80, 0x84, 0x83, 0x7c, 0x82, 0x82, 0x82, 0x83, 0x11, 0x77, 0x0a, 0x0a, 0xfe, 0xfe, 0x0e, 0xb4, 0xb4, 0xb4, 0xbb, 0xbb, 0xbe, 0xbd, 0xbf, 0xbf, 0xc2, 0xc2, 0xc7, 0xc7, 0xc7, 0xcd, 0xc7, 0xc7, 0xc2, 0xc2, 0xbf, 0xbc, 0xb9, 0xb4, 0xaf, 0xac, 0xa8, 0xab, 0xaa, 0xac, 0x08, 0x08, 0x0a, 0x05, 0x09, 0x77, 0x77, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b, 0x7c, 0x7e, 0x80, 0x79, 0x81, 0x13, 0x09, 0x95, 0x52, 0xe9, 0x4f, 0xf1, 0xe9, 0xe4, 0xbb, 0xfd, 0x00, 0x9b, 0xfd, 0xfd, 0x5b, 0x05, 0x17, 0x18, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x1f, 0x26, 0x26, 0x21, 0x26, 0x21, 0x26, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x21, 0x26, 0x2b, 0x2a, 0x35, 0x35, 0x3a, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x30, 0x2b, 0x2b, 0x1f, 0x22, 0x2d, 0x1f, 0x2b, 0x3a, 0x31, 0x1f, 0x21, 0x26, 0x26, 0x21, 0x2a, 0x26, 0x2b, 0x26, 0x2b, 0x26, 0x2b, 0x26, 0x2b, 0x2a, 0x2a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2a, 0x2a, 0x2a, 0x2a, 0x26, 0x2a, 0x2b, 0x35, 0x30, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x21, 0x26, 0x26, 0x26, 0x1f, 0x1f, 0x1f, 0x23, 0x28, 0x23, 0x1c, 0x2f, 0x25, 0x2f, 0x2f, 0x1d, 0x10, 0x67, 0x02, 0x03, 0x03, 0x06, 0x0f, 0x0f, 0x17, 0x25, 0x19, 0x17, 0x1d, 0x1b, 0x10, 0x0b, 0x8f, 0x56, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x99, 0x9c, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xca, 0x9f, 0xd8, 0x4c, 0xf1, 0x4c, 0xb1, 0x00, 0x00, 0x9a, 0x5b, 0x59, 0x5a, 0x05, 0x13, 0x0f, 0x85, 0x80, 0x84, 0x80, 0x84, 0x80, 0x89, 0x80, 0x82, 0x84, 0x85, 0x7d, 0x0c, 0x0a, 0xaf, 0xb1, 0xb3, 0xb7, 0xb9, 0xb9, 0xbc, 0xb8, 0xb5, 0xb6, 0xb5, 0xb2, 0xb3, 0xb5, 0xb3, 0xb6, 0xb2, 0xb6, 0xb2, 0xb6, 0xb6, 0xb8, 0xbc, 0xbc, 0xbc, 0xc2, 0xc7, 0xc7, 0xbf, 0xbe, 0xbc, 0xb6, 0xad, 0xa9, 0xa9, 0xaa, 0xfe, 0xaf, 0x08, 0x0a, 0x09, 0x77, 0x7d, 0x79, 0x79, 0x7b, 0x82, 0x80, 0x79, 0x81, 0x17, 0x7a, 0x20, 0x54, 0xfb, 0xff, 0x99, 0xf8, 0x01, 0x01, 0x99, 0xa4, 0x00, 0x9a, 0xfd, 0xfd, 0x59, 0x5d, 0x0b, 0x17, 0x2d, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x26, 0x1f, 0x26, 0x1f, 0x26, 0x26, 0x26, 0x21, 0x26, 0x21, 0x26, 0x21, 0x26, 0x26, 0x26, 0x21, 0x26, 0x21, 0x26, 0x2a, 0x21, 0x1f, 0x21, 0x21, 0x21, 0x2a, 0x2a, 0x35, 0x36, 0x3a, 0x35, 0x3a, 0x35, 0x35, 0x35, 0x2b, 0x22, 0x21, 0x1f, 0x2b, 0x1f, 0x2b, 0x1f, 0x2a, 0x3a, 0x31, 0x1f, 0x26, 0x21, 0x2b, 0x26, 0x2a, 0x2b, 0x27, 0x2b, 0x27, 0x2b, 0x27, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x30, 0x30, 0x2a, 0x2a, 0x2a, 0x2a, 0x26, 0x2a, 0x27, 0x26, 0x36, 0x2a, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x21, 0x1f, 0x27, 0x26, 0x26, 0x1f, 0x2a, 0x23, 0x2d, 0x28, 0x23, 0x28, 0x1c, 0x1c, 0x19, 0x37, 0x38, 0x17, 0x6e, 0x03, 0x60, 0x5d, 0x03, 0x67, 0x0b, 0x11, 0x17, 0x0f, 0x17, 0x24, 0x11, 0x3d, 0x55, 0x58, 0x01, 0xfb, 0xfb, 0x99, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0xfe, 0x01, 0x58, 0x01, 0x01, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x9a, 0x59, 0x59, 0x5b, 0x06, 0x1b, 0x83, 0x85, 0x82, 0x89, 0x82, 0x89, 0x84, 0x89, 0x89, 0x85, 0x81, 0x77, 0x0a, 0xb4, 0xb3, 0xb8, 0xba, 0xb6, 0xb7, 0xb1, 0xad, 0xad, 0xb0, 0xb2, 0xb6, 0xb8, 0xb6, 0xb2, 0xb2, 0xb2, 0xb0, 0xb2, 0xb0, 0xad, 0xad, 0xad, 0xad, 0xa9, 0xab, 0xa9, 0xad, 0xad, 0xb5, 0xb6, 0xba, 0xbc, 0xbf, 0xba, 0xb2, 0xad, 0xa8, 0xa8, 0xaa, 0x08, 0x08, 0x09, 0x77, 0x74, 0x7d, 0x7b, 0x7c, 0x16, 0x71, 0x19, 0x87, 0x7a, 0x98, 0xfb, 0x54, 0xfa, 0x58, 0x01, 0x9c, 0xfe, 0xae, 0xac, 0x9d, 0x00, 0x9b, 0xfd, 0x5b, 0x5b, 0x05, 0x13, 0x28, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x1f, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x21, 0x26, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x26, 0x26, 0x21, 0x1f, 0x2a, 0x2b, 0x2b, 0x30, 0x35, 0x30, 0x30, 0x2b, 0x2b, 0x21, 0x1f, 0x21, 0x2b, 0x1f, 0x31, 0x1f, 0x2b, 0x3a, 0x31, 0x1f, 0x21, 0x26, 0x26, 0x21, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x27, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x26, 0x2a, 0x26, 0x21, 0x2b, 0x35, 0x30, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x21, 0x26, 0x27, 0x2a, 0x2a, 0x2a, 0x26, 0x26, 0x1f, 0x26, 0x1f, 0x2d, 0x36, 0x30, 0x27, 0x1f, 0x31, 0x34, 0x25, 0x17, 0x7d, 0x06, 0x02, 0x02, 0x02, 0x03, 0x0b, 0x0b, 0x0f, 0x10, 0x8e, 0x52, 0x58, 0x01, 0x58, 0x58, 0x58, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xd3, 0xe9, 0x01, 0x01, 0x01, 0x01, 0xff, 0xaa, 0x00, 0x00, 0x9a, 0x9a, 0x9b, 0x59, 0x5a, 0x03, 0x1b, 0x85, 0x80, 0x89, 0x82, 0x89, 0x84, 0x89, 0x89, 0x85, 0x13, 0x7a, 0x0d, 0xb4, 0xb4, 0xb6, 0xb6, 0xad, 0xb0, 0xb2, 0xba, 0xc7, 0xd6, 0xea, 0xea, 0xe7, 0xe7, 0xe7, 0xea, 0xe7, 0xe7, 0xe7, 0xdd, 0xe7, 0xdc, 0xdd, 0xd6, 0xd6, 0xd2, 0xcd, 0xbf, 0xbe, 0xb8, 0xb2, 0xb0, 0xad, 0xad, 0xad, 0xb6, 0xbc, 0xbe, 0xba, 0xad, 0xab, 0xac, 0xfe, 0x0a, 0x0a, 0x77, 0x7d, 0x75, 0x7c, 0x80, 0x79, 0x2f, 0x12, 0x14, 0x54, 0xfb, 0xfb, 0xfb, 0x99, 0x01, 0xf8, 0xaf, 0x9b, 0x9e, 0x9a, 0x9b, 0x59, 0x9b, 0x00, 0x00, 0x02, 0x13, 0x24, 0x1f, 0x21, 0x1f, 0x26, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x26, 0x21, 0x26, 0x21, 0x1f, 0x21, 0x21, 0x21, 0x1f, 0x1e, 0x1f, 0x21, 0x21, 0x26, 0x22, 0x26, 0x21, 0x1f, 0x2b, 0x1f, 0x2d, 0x3a, 0x31, 0x1f, 0x26, 0x21, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x2a, 0x21, 0x2a, 0x2a, 0x2a, 0x2a, 0x27, 0x26, 0x27, 0x26, 0x35, 0x30, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x1f, 0x2a, 0x27, 0x27, 0x1f, 0x27, 0x21, 0x21, 0x21, 0x21, 0x2a, 0x2a, 0x27, 0x1f, 0x1e, 0x1e, 0x27, 0x27, 0x26, 0x23, 0x28, 0x2f, 0x2f, 0x1d, 0x17, 0x0b, 0x67, 0x03, 0x02, 0x03, 0x67, 0x06, 0x12, 0x53, 0x58, 0x01, 0x58, 0x58, 0x57, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xd3, 0x9c, 0x58, 0x01, 0x01, 0x01, 0xf4, 0xfc, 0x00, 0x00, 0x9a, 0x9a, 0x9b, 0xfd, 0x59, 0x5d, 0x87, 0x85, 0x85, 0x89, 0x89, 0x89, 0x16, 0x82, 0x16, 0x85, 0x12, 0x0a, 0xb4, 0xb4, 0xb3, 0xb1, 0xae, 0xb7, 0xc2, 0xe5, 0xea, 0xe7, 0xdd, 0xd6, 0xcd, 0xcd, 0xc7, 0xc7, 0xc7, 0xc7, 0xca, 0xc7, 0xcd, 0xca, 0xcd, 0xd2, 0xd2, 0xd8, 0xd8, 0xdd, 0xe4, 0xe7, 0xe7, 0xe7, 0xd8, 0xd6, 0xcd, 0xbe, 0xb2, 0xad, 0xb2, 0xba, 0xbc, 0xb2, 0xad, 0xaa, 0xfe, 0x0a, 0x0a, 0x77, 0x7d, 0x79, 0x80, 0x7e, 0x3c, 0x7a, 0x3b, 0x01, 0xfb, 0xfa, 0xff, 0x01, 0x01, 0x4c, 0xb9, 0xc7, 0xab, 0x9a, 0x9b, 0xfd, 0x9a, 0x00, 0x59, 0x5a, 0x12, 0x24, 0x31, 0x1f, 0x1f, 0x26, 0x26, 0x21, 0x1f, 0x26, 0x21, 0x26, 0x21, 0x26, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x2a, 0x26, 0x2a, 0x26, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x1f, 0x21, 0x1f, 0x21, 0x1f, 0x21, 0x21, 0x1f, 0x21, 0x26, 0x1f, 0x26, 0x2b, 0x1f, 0x2b, 0x1f, 0x3a, 0x2a, 0x1f, 0x26, 0x21, 0x26, 0x21, 0x2a, 0x26, 0x26, 0x26, 0x21, 0x26, 0x21, 0x26, 0x21, 0x2a, 0x21, 0x21, 0x21, 0x21, 0x26, 0x2b, 0x21, 0x2a, 0x21, 0x2a, 0x30, 0x2b, 0x2a, 0x30, 0x2a, 0x21, 0x21, 0x26, 0x26, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x21, 0x21, 0x27, 0x21, 0x27, 0x27, 0x27, 0x27, 0x21, 0x27, 0x27, 0x27, 0x23, 0x26, 0x23, 0x26, 0x27, 0x26, 0x2b, 0x1f, 0x28, 0x28, 0x2f, 0x25, 0x17, 0x74, 0x6c, 0x03, 0x03, 0x0b, 0x4d, 0x58, 0x01, 0x58, 0x58, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xf9, 0x95, 0x9c, 0x01, 0x99, 0x01, 0x01, 0x4f, 0xa0, 0x00, 0x9b, 0x9a, 0x9a, 0x9a, 0x9b, 0xfd, 0x5b, 0x0c, 0x1d, 0x15, 0x89, 0x89, 0x89, 0x89, 0x16, 0x8b, 0x11, 0x0a, 0xb4, 0xb3, 0xb2, 0xb1, 0xb9, 0xca, 0xd8, 0xd6, 0xbf, 0xba, 0xb3, 0xb3, 0xb2, 0xb1, 0xb2, 0xb3, 0xb1, 0xb2, 0xb1, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb1, 0xb3, 0xb1, 0xb1, 0xb5, 0xb5, 0xb9, 0xba, 0xbf, 0xc7, 0xcd, 0xd2, 0xd3, 0xc2, 0xba, 0xb2, 0xb2, 0xbc, 0xb6, 0xad, 0xaa, 0xaf, 0x0a, 0x0a, 0x7d, 0x7e, 0x80, 0x16, 0x3c, 0x10, 0x92, 0x01, 0xfa, 0xff, 0xff, 0x99, 0xfb, 0x46, 0xa1, 0x4c, 0xd6, 0x9b, 0x9d, 0x9b, 0x9a, 0x9a, 0x59, 0x5a, 0x10, 0x24, 0x31, 0x1e, 0x1f, 0x21, 0x21, 0x26, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x1f, 0x21, 0x26, 0x21, 0x26, 0x21, 0x1f, 0x21, 0x21, 0x26, 0x21, 0x26, 0x1f, 0x26, 0x26, 0x1f, 0x26, 0x3a, 0x2d, 0x1f, 0x26, 0x21, 0x2a, 0x26, 0x26, 0x2a, 0x2a, 0x21, 0x26, 0x26, 0x26, 0x26, 0x21, 0x2a, 0x21, 0x2a, 0x21, 0x2a, 0x21, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x35, 0x30, 0x21, 0x26, 0x2a, 0x21, 0x26, 0x26, 0x21, 0x26, 0x26, 0x27, 0x1f, 0x27, 0x21, 0x21, 0x27, 0x21, 0x27, 0x21, 0x27, 0x27, 0x27, 0x27, 0x26, 0x23, 0x23, 0x28, 0x26, 0x2b, 0x27, 0x32, 0x27, 0x27, 0x26, 0x31, 0x23, 0x23, 0x2f, 0x25, 0x18, 0x75, 0x11, 0x4b, 0x58, 0x99, 0xfb, 0xfb, 0xfb, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xdc, 0xff, 0x01, 0xff, 0xff, 0x01, 0xf1, 0xfc, 0x59, 0x9b, 0x9a, 0x9a, 0x9a, 0x9b, 0xfd, 0x5b, 0x06, 0x29, 0x89, 0x16, 0x89, 0x89, 0x89, 0x85, 0x13, 0x7a, 0x0e, 0xb3, 0xb0, 0xb2, 0xbc, 0xd3, 0x95, 0x46, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xc7, 0xcd, 0xca, 0xd2, 0xd3, 0xcd, 0xd3, 0xcd, 0xd3, 0xcd, 0xd3, 0xcd, 0xcd, 0xca, 0xcd, 0xca, 0xcd, 0xca, 0xc7, 0xc7, 0xc2, 0xc2, 0xbf, 0xbf, 0xbd, 0xbd, 0xbd, 0xc0, 0xbe, 0xb8, 0xb0, 0xb6, 0xb8, 0xae, 0xaa, 0xaf, 0x0a, 0x77, 0x81, 0x80, 0x21, 0x3c, 0x7a, 0x92, 0xfa, 0xfb, 0xff, 0xff, 0x01, 0x01, 0x54, 0xd8, 0x9c, 0xd3, 0x9d, 0xfd, 0xfd, 0x9b, 0x9a, 0x9a, 0x00, 0x09, 0x2c, 0x37, 0x27, 0x1f, 0x21, 0x2a, 0x26, 0x2a, 0x26, 0x21, 0x26, 0x26, 0x26, 0x21, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x21, 0x26, 0x21, 0x26, 0x21, 0x21, 0x1f, 0x21, 0x1f, 0x21, 0x26, 0x21, 0x1f, 0x21, 0x21, 0x21, 0x2b, 0x1f, 0x2a, 0x1f, 0x2b, 0x1f, 0x3a, 0x2b, 0x1f, 0x21, 0x21, 0x26, 0x21, 0x2b, 0x2a, 0x21, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x27, 0x2a, 0x21, 0x2a, 0x21, 0x2a, 0x2b, 0x21, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x30, 0x2b, 0x26, 0x21, 0x26, 0x26, 0x26, 0x21, 0x26, 0x26, 0x2b, 0x2a, 0x2a, 0x26, 0x26, 0x2b, 0x26, 0x27, 0x21, 0x21, 0x27, 0x21, 0x27, 0x27, 0x2a, 0x23, 0x28, 0x23, 0x2b, 0x27, 0x27, 0x32, 0x32, 0x1e, 0x27, 0x26, 0x26, 0x23, 0x23, 0x1c, 0x31, 0x24, 0x17, 0x96, 0x57, 0x01, 0x99, 0xfb, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0x95, 0xf8, 0xf9, 0xff, 0x99, 0x01, 0xf8, 0xe4, 0xbb, 0x00, 0x00, 0x9a, 0x9a, 0x9b, 0xfd, 0xfd, 0x05, 0x38, 0x15, 0x89, 0x89, 0x89, 0x15, 0x1c, 0x10, 0x0d, 0xaf, 0xb2, 0xb6, 0xbe, 0xc2, 0xbb, 0xb9, 0xb4, 0xba, 0xba, 0xbc, 0xbd, 0xbc, 0xbd, 0xbe, 0xbe, 0xbd, 0xbc, 0xbe, 0xbe, 0xbe, 0xbf, 0xbf, 0xc2, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xca, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xdd, 0xcd, 0xb8, 0xb2, 0xb5, 0xac, 0xaa, 0x08, 0x7a, 0x0f, 0x16, 0x30, 0x3c, 0x0c, 0x3b, 0xf9, 0x01, 0x01, 0x58, 0x01, 0xf8, 0x4f, 0x4f, 0x01, 0xbe, 0x59, 0x9d, 0xfd, 0x9b, 0x9b, 0x9a, 0x00, 0x06, 0x37, 0x3a, 0x21, 0x21, 0x21, 0x21, 0x2a, 0x21, 0x2a, 0x21, 0x2a, 0x21, 0x2b, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x1f, 0x21, 0x1f, 0x21, 0x1f, 0x21, 0x1f, 0x21, 0x1f, 0x26, 0x21, 0x26, 0x1f, 0x26, 0x1f, 0x1f, 0x26, 0x3a, 0x2d, 0x26, 0x26, 0x21, 0x2b, 0x26, 0x2a, 0x26, 0x2a, 0x2b, 0x26, 0x2a, 0x26, 0x2a, 0x26, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x27, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x30, 0x2b, 0x21, 0x26, 0x1f, 0x21, 0x26, 0x2a, 0x26, 0x26, 0x2a, 0x2b, 0x26, 0x2b, 0x26, 0x2b, 0x26, 0x2b, 0x21, 0x2b, 0x21, 0x2b, 0x27, 0x2b, 0x2a, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x1f, 0x1f, 0x2d, 0x21, 0x1e, 0x22, 0x17, 0x45, 0x57, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xd6, 0x01, 0x99, 0xf1, 0x01, 0x01, 0x01, 0xff, 0xb4, 0x00, 0x9a, 0x9b, 0x9a, 0x9b, 0xfd, 0xfd, 0x03, 0x38, 0x85, 0x16, 0x89, 0x89, 0x89, 0x1b, 0x7a, 0x0a, 0xb4, 0xae, 0xb6, 0xbe, 0xbc, 0xb8, 0xb4, 0xb3, 0xb5, 0xb2, 0xb2, 0xb2, 0xb3, 0xb5, 0xb5, 0xb5, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb2, 0xb3, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb1, 0xb3, 0xb7, 0xbb, 0xba, 0xbf, 0xba, 0xb6, 0xb5, 0xae, 0xb1, 0x08, 0x7a, 0x81, 0x8b, 0x27, 0x3c, 0x0c, 0x0e, 0xd6, 0xf1, 0x9c, 0x57, 0x01, 0x01, 0x54, 0xef, 0xe4, 0xa2, 0x9a, 0x5b, 0xfd, 0x9d, 0x9a, 0x9a, 0x00, 0x03, 0x41, 0x37, 0x27, 0x1f, 0x21, 0x26, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x26, 0x2a, 0x26, 0x21, 0x21, 0x1f, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x26, 0x21, 0x1f, 0x1e, 0x1f, 0x21, 0x1f, 0x21, 0x26, 0x21, 0x26, 0x2b, 0x1f, 0x2b, 0x1f, 0x3a, 0x2b, 0x1f, 0x21, 0x21, 0x26, 0x21, 0x2b, 0x26, 0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x30, 0x2b, 0x2b, 0x30, 0x2b, 0x26, 0x2a, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x2a, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x2a, 0x21, 0x1f, 0x26, 0x2b, 0x2b, 0x27, 0x26, 0x2a, 0x26, 0x1e, 0x33, 0x24, 0x42, 0x56, 0x01, 0x99, 0xfb, 0xfb, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xd3, 0x08, 0xb4, 0xdc, 0xe9, 0x01, 0xff, 0xca, 0xa6, 0x00, 0x9b, 0x9b, 0x9b, 0x9a, 0xfd, 0xfd, 0xfd, 0x03, 0x38, 0x16, 0x89, 0x1e, 0x89, 0x1c, 0x87, 0xfe, 0x0e, 0xb1, 0xb1, 0xc7, 0xc7, 0xbf, 0xc7, 0xc7, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xcd, 0xd2, 0xd2, 0xd2, 0xcd, 0xd2, 0xd2, 0xd2, 0xcd, 0xcd, 0xc7, 0xc7, 0xc2, 0xc2, 0xbf, 0xbf, 0xbe, 0xbc, 0xb9, 0xb7, 0xb5, 0xb6, 0xb8, 0xc2, 0xb5, 0xae, 0xb1, 0xaf, 0x0a, 0x11, 0x23, 0x1e, 0x44, 0x0c, 0x04, 0xa1, 0xfc, 0xfc, 0x0e, 0xca, 0xdc, 0x3b, 0xaf, 0xa0, 0x00, 0x9e, 0xfd, 0x9e, 0x9b, 0x9b, 0x9a, 0x00, 0x03, 0x41, 0x3a, 0x2a, 0x2a, 0x30, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x26, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x2d, 0x30, 0x2d, 0x2a, 0x2a, 0x26, 0x1f, 0x1f, 0x1f, 0x21, 0x1f, 0x21, 0x21, 0x1f, 0x26, 0x26, 0x1f, 0x26, 0x1f, 0x3a, 0x2d, 0x21, 0x26, 0x21, 0x2a, 0x21, 0x2a, 0x26, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x27, 0x2b, 0x2b, 0x26, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x35, 0x31, 0x30, 0x2b, 0x2a, 0x27, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x26, 0x2d, 0x2d, 0x37, 0x2d, 0x37, 0x2d, 0x37, 0x31, 0x37, 0x31, 0x31, 0x28, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x2b, 0x26, 0x23, 0x23, 0x1c, 0x26, 0x21, 0x27, 0x27, 0x32, 0x1f, 0x30, 0x1e, 0x33, 0x19, 0x40, 0x55, 0x58, 0x01, 0xfb, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x92, 0x9e, 0x5b, 0xa0, 0xa6, 0xab, 0xfc, 0xfd, 0x00, 0x59, 0x59, 0x9b, 0x59, 0x9b, 0x9b, 0x59, 0xfd, 0x06, 0x38, 0x15, 0x89, 0x89, 0x8b, 0x1c, 0x12, 0xfe, 0xaf, 0xb4, 0xbd, 0xe4, 0xd6, 0xd6, 0xd5, 0xd6, 0xcd, 0xcd, 0xd2, 0xd2, 0xc7, 0xcd, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xcd, 0xcd, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd8, 0xdc, 0xd6, 0xd8, 0xd8, 0xbe, 0xad, 0xb1, 0xaf, 0x0a, 0x7d, 0x25, 0x30, 0x3c, 0x11, 0x02, 0x5b, 0x9b, 0xfd, 0xfd, 0xfd, 0x9e, 0x9d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9b, 0x9b, 0x9a, 0x59, 0x05, 0x38, 0x41, 0x30, 0x36, 0x36, 0x3a, 0x36, 0x36, 0x36, 0x3a, 0x36, 0x3a, 0x36, 0x36, 0x36, 0x36, 0x36, 0x34, 0x34, 0x3a, 0x3a, 0x36, 0x3e, 0x36, 0x3e, 0x3a, 0x31, 0x34, 0x3a, 0x3c, 0x34, 0x38, 0x2f, 0x2f, 0x25, 0x2f, 0x25, 0x2f, 0x25, 0x2f, 0x1c, 0x28, 0x23, 0x1f, 0x26, 0x2a, 0x26, 0x1f, 0x2a, 0x1f, 0x26, 0x3a, 0x2b, 0x22, 0x2a, 0x21, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x26, 0x2b, 0x26, 0x2b, 0x2a, 0x2a, 0x2b, 0x27, 0x33, 0x27, 0x33, 0x27, 0x2b, 0x2a, 0x26, 0x26, 0x2b, 0x2b, 0x35, 0x3a, 0x31, 0x30, 0x30, 0x30, 0x33, 0x27, 0x2b, 0x28, 0x28, 0x2e, 0x29, 0x29, 0x1b, 0x12, 0x12, 0x12, 0x12, 0x10, 0x12, 0x12, 0x1b, 0x2e, 0x2e, 0x2e, 0x24, 0x2b, 0x22, 0x27, 0x22, 0x1f, 0x2d, 0x2d, 0x1f, 0x26, 0x21, 0x27, 0x32, 0x27, 0x27, 0x30, 0x1f, 0x1f, 0x18, 0x38, 0x53, 0x58, 0x01, 0xfb, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x46, 0x02, 0xa0, 0xa0, 0x9d, 0x9a, 0x00, 0x00, 0xfd, 0xfd, 0x9a, 0x9b, 0x9b, 0x9b, 0x9a, 0x59, 0x5b, 0x0b, 0x3c, 0x1f, 0x89, 0x8b, 0x8b, 0x19, 0x0d, 0xfe, 0xb4, 0xaf, 0xb8, 0xb8, 0xb2, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb8, 0xb7, 0xb8, 0xb7, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb8, 0xb6, 0xb8, 0xb8, 0xba, 0xba, 0xba, 0xbc, 0xbc, 0xbc, 0xbc, 0xb0, 0xb0, 0xae, 0xfe, 0x0c, 0x29, 0x3a, 0x3c, 0x1b, 0x05, 0x5b, 0x9e, 0x9f, 0x9d, 0x9e, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9b, 0x9d, 0x9d, 0xfd, 0x59, 0x09, 0x40, 0x3a, 0x2a, 0x26, 0x30, 0x30, 0x30, 0x30, 0x36, 0x30, 0x30, 0x30, 0x30, 0x31, 0x32, 0x30, 0x31, 0x23, 0x34, 0x34, 0x31, 0x3e, 0x33, 0x3e, 0x30, 0x3c, 0x34, 0x38, 0x29, 0x1b, 0x11, 0x7d, 0x10, 0x0c, 0x10, 0x0c, 0x10, 0x0c, 0x12, 0x12, 0x1b, 0x1d, 0x2e, 0x1c, 0x28, 0x26, 0x1f, 0x26, 0x26, 0x1f, 0x31, 0x3a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x31, 0x2b, 0x2b, 0x2b, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x33, 0x33, 0x33, 0x33, 0x36, 0x31, 0x31, 0x31, 0x31, 0x37, 0x35, 0x3a, 0x31, 0x30, 0x30, 0x32, 0x2b, 0x2b, 0x2d, 0x2e, 0x29, 0x87, 0x12, 0x0a, 0x0a, 0x08, 0x08, 0xfc, 0x04, 0xaa, 0x08, 0x04, 0x07, 0x0d, 0x7a, 0x12, 0x29, 0x38, 0x2c, 0x2c, 0x2d, 0x2a, 0x26, 0x21, 0x26, 0x21, 0x27, 0x27, 0x27, 0x32, 0x1e, 0x2a, 0x1c, 0x2b, 0x1c, 0x2f, 0x51, 0x58, 0xfb, 0xfb, 0xfa, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x95, 0x02, 0x9e, 0xa0, 0x9f, 0x9d, 0x9d, 0xfd, 0xfd, 0xfd, 0x9b, 0x00, 0x9b, 0x9a, 0x9b, 0x5a, 0x5b, 0x2e, 0x38, 0x1e, 0x1f, 0x89, 0x1c, 0x17, 0x0d, 0xaf, 0xaf, 0xb7, 0xd3, 0xc2, 0xc7, 0xc2, 0xc7, 0xc7, 0xcd, 0xc7, 0xcd, 0xc7, 0xcd, 0xc7, 0xcd, 0xcd, 0xcd, 0xcd, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xcd, 0xcd, 0xd2, 0xcd, 0xd2, 0xd2, 0xd2, 0xcd, 0xcd, 0xc7, 0xc7, 0xc2, 0xc2, 0xc2, 0xc2, 0xbf, 0xbf, 0xbe, 0xbe, 0xbf, 0xbc, 0xbc, 0xc7, 0xb3, 0xb0, 0xb1, 0x08, 0x7a, 0x25, 0x3c, 0x41, 0x2e, 0x09, 0x5b, 0x9e, 0x9e, 0x9d, 0x9f, 0x9d, 0x9d, 0x9d, 0x9d, 0x5b, 0x9d, 0x9b, 0x9d, 0x9d, 0x9d, 0xfd, 0x5b, 0x10, 0x3c, 0x3a, 0x26, 0x27, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x30, 0x2b, 0x30, 0x2a, 0x2d, 0x23, 0x2a, 0x30, 0x30, 0x33, 0x2b, 0x2f, 0x1d, 0x87, 0x7a, 0x0a, 0x0a, 0x07, 0x07, 0x04, 0x04, 0x08, 0xaa, 0x07, 0x08, 0x08, 0x0a, 0x0a, 0x0d, 0x10, 0x1b, 0x25, 0x2f, 0x2d, 0x2d, 0x1f, 0x1f, 0x31, 0x37, 0x31, 0x3a, 0x30, 0x35, 0x36, 0x35, 0x35, 0x36, 0x35, 0x3a, 0x36, 0x3a, 0x36, 0x3a, 0x36, 0x3a, 0x35, 0x3a, 0x35, 0x36, 0x3a, 0x36, 0x31, 0x3a, 0x3a, 0x35, 0x35, 0x35, 0x3a, 0x30, 0x2a, 0x30, 0x31, 0x28, 0x2f, 0x29, 0x12, 0x7a, 0x0d, 0x08, 0x08, 0xac, 0xaa, 0xab, 0xac, 0xab, 0xa9, 0xa9, 0xaa, 0xaa, 0x04, 0x07, 0x07, 0x0d, 0x10, 0x2e, 0x2f, 0x24, 0x2b, 0x2b, 0x27, 0x21, 0x26, 0x26, 0x2b, 0x27, 0x2b, 0x27, 0x2a, 0x23, 0x23, 0x1f, 0x25, 0x4e, 0x58, 0x01, 0xfb, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x58, 0x4c, 0x0a, 0xfd, 0x5a, 0xa0, 0x9d, 0x9d, 0x9b, 0xfd, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x5a, 0x59, 0x02, 0x40, 0x35, 0x2a, 0x1e, 0x1f, 0x1c, 0x17, 0x0d, 0xb1, 0xaf, 0xb9, 0xcd, 0xbf, 0xc2, 0xc2, 0xc2, 0xc2, 0xbf, 0xbf, 0xbf, 0xbf, 0xc2, 0xc2, 0xbf, 0xbf, 0xbf, 0xbf, 0xbe, 0xbc, 0xbe, 0xbc, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbf, 0xbf, 0xc2, 0xbf, 0xc2, 0xc2, 0xc7, 0xc7, 0xc7, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xb8, 0xb0, 0xb1, 0xfe, 0x09, 0x1d, 0x41, 0x41, 0x38, 0x1b, 0x02, 0xfd, 0x9e, 0x9d, 0x9b, 0x9e, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9b, 0x5b, 0xfd, 0x02, 0x3c, 0x3c, 0x30, 0x2a, 0x26, 0x2a, 0x2a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2a, 0x33, 0x2b, 0x31, 0x2a, 0x30, 0x30, 0x30, 0x26, 0x37, 0x2f, 0x1b, 0x0c, 0x07, 0x07, 0xaa, 0xa8, 0xaa, 0xab, 0xac, 0xac, 0xab, 0xab, 0xab, 0xa9, 0xaa, 0xab, 0xaa, 0x08, 0x0a, 0x09, 0x10, 0x1b, 0x25, 0x2f, 0x28, 0x25, 0x3a, 0x34, 0x31, 0x31, 0x36, 0x36, 0x35, 0x36, 0x3a, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x31, 0x31, 0x35, 0x35, 0x35, 0x35, 0x31, 0x31, 0x31, 0x31, 0x31, 0x35, 0x36, 0x36, 0x30, 0x2b, 0x34, 0x2f, 0x29, 0x1b, 0x10, 0x0a, 0x08, 0xaa, 0xac, 0xab, 0xab, 0xa7, 0xa7, 0xa9, 0xad, 0xad, 0xa9, 0xa9, 0xab, 0xab, 0xaa, 0xaa, 0x08, 0x0a, 0x7a, 0x20, 0x2e, 0x22, 0x27, 0x27, 0x27, 0x21, 0x26, 0x26, 0x26, 0x2b, 0x2b, 0x2a, 0x1f, 0x2d, 0x18, 0x25, 0x4a, 0x58, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x4d, 0x3b, 0x03, 0x00, 0x59, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0x00, 0x5a, 0x11, 0x3c, 0x35, 0x32, 0x1e, 0x89, 0x2f, 0x11, 0x0a, 0xaf, 0xb3, 0xc0, 0xcd, 0xbe, 0xbf, 0xbf, 0xbe, 0xbc, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb7, 0xb5, 0xb5, 0xb5, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb5, 0xba, 0xba, 0xbe, 0xb8, 0xb0, 0xb1, 0xaf, 0x09, 0x13, 0x41, 0x47, 0x38, 0x2e, 0x0d, 0x5d, 0xfd, 0x9e, 0x9a, 0x9f, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xfd, 0x5b, 0x06, 0x44, 0x3a, 0x2a, 0x2a, 0x26, 0x26, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x30, 0x2b, 0x2a, 0x30, 0x2b, 0x2b, 0x30, 0x33, 0x30, 0x27, 0x2d, 0x34, 0x1d, 0x10, 0x05, 0x04, 0x04, 0xaa, 0xa8, 0xa8, 0xa9, 0xa8, 0xa9, 0xa9, 0xa1, 0xa5, 0xa7, 0xa9, 0xa7, 0xa6, 0xa4, 0xa3, 0xfc, 0x04, 0x07, 0x09, 0x10, 0x1b, 0x39, 0x25, 0x34, 0x3a, 0x31, 0x2a, 0x2a, 0x27, 0x30, 0x27, 0x30, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2d, 0x2a, 0x31, 0x2b, 0x2d, 0x2b, 0x2d, 0x2b, 0x2d, 0x26, 0x26, 0x30, 0x35, 0x36, 0x36, 0x3a, 0x34, 0x2f, 0x1b, 0x10, 0x0a, 0x08, 0xfe, 0xac, 0xad, 0xa7, 0xa9, 0xad, 0xa7, 0xa7, 0xa3, 0xa0, 0xa0, 0xa0, 0xa1, 0xa1, 0xa1, 0xa3, 0xa7, 0xab, 0xab, 0x04, 0x7a, 0x8e, 0x38, 0x22, 0x21, 0x27, 0x21, 0x26, 0x23, 0x23, 0x23, 0x2a, 0x2a, 0x23, 0x26, 0x1f, 0x1d, 0x49, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x53, 0x45, 0x1b, 0x03, 0x59, 0x5a, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x5a, 0x5b, 0x06, 0x40, 0x37, 0x3e, 0x32, 0x32, 0x26, 0x25, 0x10, 0x0e, 0xb4, 0xae, 0xc0, 0xcd, 0xc7, 0xcd, 0xcd, 0xd2, 0xcd, 0xcd, 0xd2, 0xcd, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd2, 0xd2, 0xcd, 0xcd, 0xc7, 0xcd, 0xc2, 0xbf, 0xbf, 0xbe, 0xbc, 0xbb, 0xb0, 0xb5, 0xb6, 0xb0, 0xb2, 0xaf, 0x07, 0x11, 0x41, 0x47, 0x41, 0x2f, 0x2e, 0x09, 0x5b, 0x5a, 0x9f, 0x9b, 0x9d, 0x9d, 0x9d, 0x9b, 0x9d, 0x9b, 0x9d, 0xfd, 0xfd, 0x03, 0x1b, 0x41, 0x36, 0x26, 0x30, 0x30, 0x2a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x33, 0x33, 0x2d, 0x2f, 0x1b, 0x09, 0x04, 0x04, 0xaa, 0xa8, 0xaa, 0xaa, 0xac, 0xa9, 0xa8, 0xa9, 0xa9, 0xc7, 0xd2, 0xe8, 0xee, 0xef, 0xef, 0xdc, 0xcd, 0xbc, 0xaf, 0xa4, 0xfc, 0xaa, 0x0a, 0x14, 0x29, 0x39, 0x3a, 0x1e, 0x27, 0x2a, 0x2a, 0x2a, 0x2a, 0x27, 0x30, 0x2a, 0x30, 0x2b, 0x30, 0x31, 0x30, 0x31, 0x30, 0x2d, 0x31, 0x31, 0x2c, 0x35, 0x31, 0x30, 0x2a, 0x30, 0x31, 0x36, 0x3a, 0x2d, 0x2f, 0x29, 0x12, 0x0d, 0x08, 0xfe, 0xac, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa3, 0xa1, 0xa3, 0xb6, 0xc7, 0xdd, 0xe7, 0xe7, 0xd8, 0xd2, 0xbe, 0xb3, 0xa9, 0xab, 0xb2, 0xfe, 0x0a, 0x29, 0x38, 0x22, 0x2b, 0x27, 0x26, 0x26, 0x23, 0x23, 0x2b, 0x1f, 0x2a, 0x28, 0x1f, 0x19, 0x45, 0x58, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x57, 0x55, 0x49, 0x44, 0x40, 0x02, 0x5a, 0x5a, 0x59, 0x59, 0x00, 0x59, 0x59, 0xfd, 0x5a, 0x06, 0x3c, 0x41, 0x41, 0x3e, 0x32, 0x32, 0x26, 0x1d, 0x14, 0x08, 0xb4, 0xac, 0xbc, 0xae, 0xae, 0xb0, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb0, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb5, 0xb5, 0xb7, 0xb8, 0xb8, 0xba, 0xba, 0xba, 0xbc, 0xbc, 0xbc, 0xbe, 0xbf, 0xc2, 0xc7, 0xcd, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xdc, 0xd8, 0xdd, 0xc7, 0xb0, 0xb2, 0xb1, 0x08, 0x11, 0x37, 0x47, 0x47, 0x41, 0x24, 0x2e, 0x0c, 0x5b, 0x5b, 0xfd, 0x9d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xfd, 0xfd, 0x5d, 0x10, 0x44, 0x3a, 0x2a, 0x27, 0x30, 0x30, 0x26, 0x30, 0x30, 0x30, 0x2a, 0x2a, 0x30, 0x2a, 0x2b, 0x30, 0x2a, 0x30, 0x30, 0x33, 0x2c, 0x2f, 0x12, 0x05, 0x04, 0x04, 0xa4, 0xa6, 0xa8, 0xa8, 0xa6, 0xfc, 0xa6, 0xb7, 0xd8, 0xfb, 0xfb, 0xf9, 0xf9, 0xf7, 0xf8, 0xf8, 0xfa, 0xfa, 0xfa, 0xf0, 0xcd, 0xb0, 0xa6, 0xa3, 0x08, 0x8a, 0x40, 0x34, 0x22, 0x27, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x27, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x30, 0x30, 0x31, 0x2b, 0x31, 0x2b, 0x2b, 0x30, 0x30, 0x30, 0x30, 0x31, 0x28, 0x2e, 0x1b, 0x10, 0x0a, 0x07, 0xfe, 0xab, 0xad, 0xa7, 0xad, 0xa7, 0xa7, 0xa3, 0xad, 0xc7, 0xf7, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xea, 0xc2, 0xb0, 0xab, 0x0e, 0x0e, 0x1b, 0x25, 0x22, 0x27, 0x27, 0x26, 0x23, 0x23, 0x2b, 0x21, 0x23, 0x26, 0x1f, 0x19, 0x45, 0x57, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x57, 0x55, 0x4a, 0x40, 0x44, 0x44, 0x11, 0x67, 0x5d, 0x5b, 0x5d, 0x5d, 0x5d, 0x06, 0x24, 0x44, 0x41, 0x3f, 0x3f, 0x3e, 0x3e, 0x32, 0x35, 0x1b, 0x0d, 0x0e, 0xac, 0xac, 0xdc, 0xdd, 0xdc, 0xdd, 0xd8, 0xdd, 0xd8, 0xdd, 0xd8, 0xd6, 0xd6, 0xd2, 0xd2, 0xcd, 0xc7, 0xc2, 0xc2, 0xbe, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xb8, 0xb8, 0xba, 0xb8, 0xb7, 0xb7, 0xb3, 0xb2, 0xb3, 0xb3, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb3, 0xb3, 0xb3, 0xba, 0xb8, 0xbc, 0xc7, 0xbe, 0xb2, 0xb2, 0xb2, 0x08, 0x0c, 0x2d, 0x47, 0x47, 0x47, 0x37, 0x2c, 0x38, 0x1d, 0x06, 0x5b, 0x5a, 0x59, 0x5a, 0x5a, 0xfd, 0x59, 0x5b, 0x02, 0x1b, 0x44, 0x41, 0x36, 0x1e, 0x30, 0x2a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0x30, 0x37, 0x38, 0x10, 0x05, 0xfc, 0xa4, 0xa7, 0xa3, 0xa9, 0xa8, 0xa2, 0xa6, 0xb9, 0xeb, 0x01, 0x9c, 0x01, 0xf3, 0x9c, 0x9c, 0x9c, 0x9c, 0xf3, 0xef, 0xf4, 0xee, 0xf6, 0xfb, 0xf3, 0xd2, 0xad, 0xaa, 0x07, 0x20, 0x38, 0x24, 0x2c, 0x26, 0x26, 0x31, 0x26, 0x27, 0x2a, 0x30, 0x30, 0x30, 0x35, 0x30, 0x35, 0x30, 0x30, 0x33, 0x30, 0x35, 0x2c, 0x33, 0x36, 0x33, 0x27, 0x35, 0x31, 0x28, 0x38, 0x20, 0x0d, 0x0a, 0x08, 0xae, 0xa9, 0xa9, 0xad, 0xa7, 0xa9, 0xa7, 0xaa, 0xd6, 0x01, 0x01, 0xfb, 0xf8, 0xf8, 0x54, 0xf5, 0x54, 0xf5, 0xf4, 0xf7, 0xf8, 0xf9, 0xfa, 0xec, 0xbf, 0xae, 0xaf, 0x14, 0x1b, 0x24, 0x22, 0x33, 0x27, 0x26, 0x31, 0x21, 0x27, 0x2d, 0x26, 0x22, 0x19, 0x3d, 0x57, 0x01, 0xfb, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x57, 0x51, 0x40, 0x41, 0x41, 0x44, 0x44, 0x3c, 0x38, 0x2e, 0x2c, 0x3c, 0x44, 0x41, 0x43, 0x3f, 0x3f, 0x3f, 0x3e, 0x3e, 0x32, 0x35, 0x1b, 0x0e, 0xaf, 0xaf, 0xb1, 0xcd, 0xbe, 0xbe, 0xbc, 0xbc, 0xbe, 0xbe, 0xbf, 0xbf, 0xc2, 0xc2, 0xc7, 0xc7, 0xcd, 0xcd, 0xcd, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd6, 0xd2, 0xd2, 0xcd, 0xcd, 0xc7, 0xc7, 0xcd, 0xc7, 0xc7, 0xbf, 0xbf, 0xbe, 0xbc, 0xbc, 0xb7, 0xb6, 0xb8, 0xb2, 0xb2, 0xb2, 0xfe, 0x0c, 0x37, 0x43, 0x47, 0x47, 0x43, 0x33, 0x22, 0x2c, 0x1d, 0x1d, 0x06, 0x05, 0x02, 0x02, 0x03, 0x03, 0x10, 0x24, 0x40, 0x41, 0x3a, 0x32, 0x32, 0x32, 0x31, 0x2a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x26, 0x37, 0x38, 0x10, 0x05, 0xfc, 0xa8, 0xa3, 0xa3, 0xa9, 0xa3, 0xa2, 0xb1, 0xd6, 0xf9, 0x99, 0xf9, 0x9c, 0xf0, 0x9c, 0x9c, 0xf6, 0x9c, 0xf3, 0xf5, 0xf3, 0x9c, 0xf3, 0xeb, 0xeb, 0xf6, 0x9c, 0xeb, 0xbb, 0x08, 0x0a, 0x20, 0x29, 0x25, 0x28, 0x28, 0x31, 0x2d, 0x26, 0x30, 0x30, 0x33, 0x30, 0x30, 0x2b, 0x31, 0x33, 0x30, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2d, 0x38, 0x38, 0x12, 0x0a, 0xfe, 0x08, 0xac, 0xab, 0xad, 0xa7, 0xad, 0xa9, 0xa4, 0xbb, 0x52, 0xfb, 0xf8, 0x99, 0xf9, 0x9c, 0xf8, 0xff, 0xf8, 0xf8, 0xf5, 0xf5, 0xf4, 0xf6, 0xee, 0xef, 0xfa, 0xf9, 0xd8, 0xb6, 0xaf, 0x8a, 0x1d, 0x18, 0x22, 0x33, 0x1e, 0x26, 0x27, 0x2a, 0x26, 0x26, 0x26, 0x19, 0x40, 0x57, 0x01, 0x01, 0xfb, 0x58, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x58, 0x54, 0x45, 0x38, 0x41, 0x43, 0x41, 0x47, 0x41, 0x47, 0x47, 0x47, 0x41, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3e, 0x3e, 0x3e, 0x35, 0x1b, 0x7a, 0xaf, 0xb1, 0xae, 0xbc, 0xb3, 0xb3, 0xb3, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb3, 0xb3, 0xb5, 0xb5, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb8, 0xba, 0xba, 0xba, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbe, 0xbe, 0xbe, 0xbc, 0xb2, 0xb0, 0xb2, 0x08, 0x0c, 0x28, 0x3e, 0x47, 0x47, 0x47, 0x43, 0x3f, 0x33, 0x2c, 0x2c, 0x38, 0x24, 0x2c, 0x24, 0x24, 0x37, 0x37, 0x41, 0x41, 0x3f, 0x32, 0x32, 0x3e, 0x30, 0x30, 0x2a, 0x30, 0x2a, 0x30, 0x30, 0x2a, 0x30, 0x30, 0x2b, 0x30, 0x30, 0x2a, 0x34, 0x2f, 0x10, 0x05, 0xfc, 0xa3, 0xa3, 0xa7, 0xa3, 0xa7, 0xa2, 0xb4, 0xe9, 0xfa, 0xfa, 0xf7, 0xf6, 0x99, 0xf6, 0x9c, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf2, 0xee, 0xf2, 0xf4, 0xf9, 0x4f, 0xca, 0x0a, 0x0e, 0x3b, 0x8e, 0x1c, 0x28, 0x2d, 0x2d, 0x26, 0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x31, 0x30, 0x33, 0x30, 0x33, 0x31, 0x33, 0x33, 0x32, 0x33, 0x35, 0x2c, 0x39, 0x87, 0x0d, 0xaa, 0xac, 0xae, 0xab, 0xad, 0xab, 0xad, 0xa5, 0xa8, 0xca, 0xf8, 0x57, 0xff, 0x99, 0x9c, 0x9c, 0xf1, 0x9c, 0x9c, 0x9c, 0xf3, 0x9c, 0xf3, 0x9c, 0xf3, 0xf0, 0x52, 0xed, 0xf7, 0x9c, 0xd8, 0xbb, 0x0e, 0x12, 0x2e, 0x24, 0x1e, 0x27, 0x27, 0x27, 0x21, 0x2d, 0x21, 0x2b, 0x18, 0x3d, 0x56, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x99, 0x58, 0x97, 0x38, 0x41, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x43, 0x3f, 0x3e, 0x3f, 0x3e, 0x32, 0x35, 0x1b, 0x0d, 0xaf, 0xae, 0xb3, 0xd6, 0xd2, 0xd2, 0xd6, 0xd2, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc7, 0xcd, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xcd, 0xc7, 0xc2, 0xc2, 0xc7, 0xc7, 0xc7, 0xc7, 0xcd, 0xc7, 0xd2, 0xcd, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd8, 0xcd, 0xb8, 0xb0, 0xb2, 0xfe, 0x0c, 0x28, 0x36, 0x43, 0x47, 0x47, 0x47, 0x43, 0x3f, 0x3f, 0x22, 0x33, 0x22, 0x22, 0x22, 0x33, 0x3f, 0x41, 0x43, 0x3e, 0x3e, 0x32, 0x32, 0x32, 0x30, 0x30, 0x30, 0x2a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x2f, 0x38, 0x87, 0x05, 0xfc, 0xa8, 0xa3, 0xa5, 0xa7, 0xa3, 0xa1, 0xb9, 0xe9, 0x99, 0xf9, 0xf8, 0xf9, 0xf7, 0xf5, 0xf9, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf5, 0xef, 0xed, 0x4c, 0xfa, 0xef, 0xca, 0xb4, 0x1a, 0x8e, 0x2f, 0x19, 0x34, 0x28, 0x26, 0x2d, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x2b, 0x33, 0x30, 0x35, 0x2b, 0x35, 0x33, 0x33, 0x33, 0x37, 0x39, 0x1b, 0x0d, 0x08, 0xac, 0xae, 0xad, 0xac, 0xab, 0xab, 0xab, 0xa4, 0xca, 0xff, 0x58, 0xff, 0x54, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xf3, 0xf3, 0xf3, 0xf0, 0xf3, 0xef, 0xef, 0xeb, 0xf0, 0xf9, 0xdc, 0xc0, 0x14, 0x20, 0x17, 0x24, 0x21, 0x32, 0x27, 0x2b, 0x26, 0x26, 0x2b, 0x18, 0x39, 0x56, 0x58, 0x01, 0x58, 0x58, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x50, 0x40, 0x37, 0x43, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3e, 0x3e, 0x43, 0x3f, 0x3f, 0x37, 0x3a, 0x3e, 0x3e, 0x35, 0x13, 0x0d, 0x0e, 0xae, 0xad, 0xc7, 0xbf, 0xbe, 0xbf, 0xbf, 0xbf, 0xbf, 0xc2, 0xc2, 0xc2, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xcd, 0xc7, 0xcd, 0xc7, 0xcd, 0xcd, 0xcd, 0xd2, 0xcd, 0xcd, 0xcd, 0xc7, 0xc7, 0xc2, 0xc2, 0xc2, 0xbf, 0xbf, 0xbe, 0xbf, 0xbf, 0xbf, 0xbe, 0xbe, 0xbf, 0xc2, 0xbe, 0xc7, 0xbe, 0xb5, 0xb2, 0xb3, 0x08, 0x09, 0x2f, 0x3a, 0x3e, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x43, 0x43, 0x32, 0x32, 0x32, 0x30, 0x30, 0x30, 0x30, 0x2a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x12, 0x09, 0xfc, 0xa2, 0xa3, 0xa5, 0xa5, 0xa8, 0xa1, 0xac, 0xe4, 0x99, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf5, 0xf4, 0xf3, 0xf3, 0xf6, 0xf8, 0xef, 0xef, 0xf2, 0xed, 0xec, 0xf3, 0xed, 0xca, 0xb9, 0x8f, 0x38, 0x28, 0x24, 0x28, 0x2d, 0x2d, 0x30, 0x30, 0x30, 0x33, 0x31, 0x30, 0x35, 0x2b, 0x31, 0x2d, 0x31, 0x2a, 0x30, 0x36, 0x33, 0x38, 0x2e, 0x0e, 0x08, 0xab, 0xae, 0xad, 0xab, 0xad, 0xac, 0xac, 0xa1, 0xc0, 0xf9, 0x99, 0xf9, 0xff, 0xf9, 0xf8, 0xf7, 0xf9, 0xf9, 0x9c, 0xf3, 0xf3, 0xea, 0xeb, 0xf0, 0xf0, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe9, 0xc0, 0x14, 0x20, 0x25, 0x1e, 0x27, 0x27, 0x26, 0x26, 0x27, 0x2b, 0x18, 0x39, 0x55, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0xfa, 0x01, 0x01, 0x56, 0x42, 0x37, 0x3f, 0x43, 0x3f, 0x3e, 0x3e, 0x3e, 0x36, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x3a, 0x41, 0x3e, 0x3e, 0x35, 0x1d, 0x0d, 0xaf, 0xb1, 0xac, 0xb8, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb3, 0xb2, 0xb3, 0xb1, 0xb1, 0xb2, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xb7, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xba, 0xb8, 0xb8, 0xba, 0xb8, 0xb8, 0xba, 0xb8, 0xb8, 0xb7, 0xb3, 0xb1, 0xb3, 0xb2, 0xb0, 0xb5, 0xb2, 0xb2, 0xb3, 0x0a, 0x09, 0x37, 0x3a, 0x35, 0x43, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3f, 0x3f, 0x43, 0x43, 0x43, 0x3e, 0x3e, 0x32, 0x32, 0x31, 0x34, 0x34, 0x2a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x29, 0x0d, 0xfc, 0x04, 0xa3, 0xa3, 0xa7, 0xa4, 0xa1, 0x04, 0xdc, 0xf9, 0x9c, 0x9c, 0xf9, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xf9, 0xf3, 0xeb, 0xe8, 0xe8, 0xe7, 0xe9, 0xe8, 0xec, 0xeb, 0xf2, 0xf6, 0xf0, 0xf0, 0xea, 0xf0, 0xf0, 0xeb, 0xca, 0x3b, 0x40, 0x25, 0x19, 0x28, 0x2d, 0x2a, 0x31, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2d, 0x31, 0x31, 0x2d, 0x2d, 0x31, 0x30, 0x2b, 0x3a, 0x38, 0x12, 0x0a, 0xab, 0xad, 0xab, 0xab, 0xac, 0xab, 0xac, 0xa8, 0xb1, 0xf1, 0x01, 0x9c, 0xf9, 0x9c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf6, 0xe8, 0xe8, 0xe7, 0xe4, 0xdc, 0xe4, 0xe8, 0xe9, 0xed, 0xf0, 0xec, 0xf3, 0xef, 0x4f, 0xef, 0xf7, 0xe4, 0xc0, 0x8a, 0x1b, 0x23, 0x27, 0x32, 0x21, 0x26, 0x2a, 0x2a, 0x18, 0x39, 0x53, 0x01, 0x58, 0x58, 0x58, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x58, 0x01, 0x01, 0x57, 0x42, 0x3c, 0x2c, 0x3f, 0x32, 0x3e, 0x3e, 0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x36, 0x3f, 0x36, 0x3e, 0x41, 0x37, 0x13, 0x7a, 0x0e, 0xaf, 0xae, 0xca, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xcd, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd2, 0xd6, 0xd2, 0xbc, 0xb0, 0xb3, 0xfe, 0x09, 0x38, 0x3a, 0x3e, 0x3f, 0x43, 0x43, 0x47, 0x43, 0x43, 0x3f, 0x43, 0x3f, 0x43, 0x43, 0x43, 0x3e, 0x3e, 0x32, 0x36, 0x30, 0x31, 0x31, 0x34, 0x31, 0x30, 0x30, 0x31, 0x30, 0x30, 0x36, 0x32, 0x32, 0x30, 0x21, 0x2f, 0x2f, 0x0d, 0x04, 0xfc, 0xa6, 0xa7, 0xa3, 0xa5, 0xa2, 0xa2, 0xd3, 0xf9, 0xf9, 0x9c, 0xf9, 0x9c, 0x9c, 0x9c, 0xf9, 0xf9, 0x9c, 0xe8, 0xe8, 0xe4, 0xe4, 0xdc, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe8, 0xeb, 0xea, 0xf0, 0xf0, 0xf0, 0xee, 0xec, 0xe9, 0x3b, 0x48, 0x39, 0x1d, 0x28, 0x31, 0x26, 0x31, 0x2a, 0x33, 0x33, 0x33, 0x2b, 0x35, 0x2c, 0x2b, 0x31, 0x30, 0x30, 0x3a, 0x2c, 0x3c, 0x1b, 0x0d, 0x08, 0xab, 0xad, 0xab, 0xae, 0xad, 0xaf, 0xa6, 0xac, 0xe9, 0xf9, 0xf9, 0x9c, 0xf6, 0x9c, 0xf9, 0xf8, 0xf4, 0xeb, 0xe4, 0xdc, 0xd8, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe4, 0xe4, 0xe7, 0xea, 0xee, 0x4f, 0xef, 0xec, 0xf0, 0xf3, 0x4c, 0x1a, 0x11, 0x1c, 0x33, 0x1e, 0x2b, 0x27, 0x21, 0x2a, 0x18, 0x8e, 0x55, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x54, 0x58, 0x56, 0x20, 0x38, 0x41, 0x41, 0x3f, 0x3f, 0x3f, 0x3e, 0x3e, 0x36, 0x3e, 0x3a, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x3a, 0x11, 0x77, 0x0d, 0xfe, 0xaf, 0xb9, 0xbf, 0xc2, 0xbf, 0xbf, 0xbf, 0xbc, 0xbc, 0xba, 0xba, 0xba, 0xbc, 0xbe, 0xbf, 0xbf, 0xbc, 0xbc, 0xbc, 0xbc, 0xbe, 0xbc, 0xbe, 0xbe, 0xbc, 0xbe, 0xbc, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xba, 0xbb, 0xbc, 0xbc, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xbe, 0xba, 0xb2, 0xb2, 0xfe, 0x09, 0x38, 0x36, 0x32, 0x3e, 0x43, 0x43, 0x43, 0x43, 0x41, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3e, 0x3e, 0x36, 0x30, 0x36, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x32, 0x27, 0x32, 0x32, 0x28, 0x2f, 0x20, 0x07, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa1, 0xb3, 0xec, 0xf9, 0xf9, 0xfa, 0x9c, 0xf8, 0xf7, 0xf8, 0xf9, 0xf3, 0xe8, 0xe4, 0xe4, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe4, 0xe4, 0xe4, 0xe9, 0xeb, 0xed, 0xee, 0xee, 0xeb, 0xd8, 0xca, 0x45, 0x1b, 0x22, 0x2d, 0x31, 0x23, 0x30, 0x2b, 0x33, 0x33, 0x31, 0x31, 0x35, 0x2b, 0x30, 0x36, 0x33, 0x35, 0x38, 0x2e, 0x12, 0x07, 0xaa, 0xae, 0xa9, 0xad, 0xab, 0xac, 0xab, 0xa8, 0xc0, 0xf9, 0x99, 0xf8, 0xf8, 0xf9, 0xf9, 0xf8, 0xf0, 0xe7, 0xd8, 0xd8, 0xe7, 0xe4, 0xe7, 0xdc, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xdd, 0xe4, 0xeb, 0xed, 0xed, 0xec, 0xea, 0xf0, 0xec, 0x46, 0x1b, 0x1d, 0x1f, 0x22, 0x2b, 0x27, 0x27, 0x26, 0x17, 0x29, 0x52, 0x58, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xff, 0x01, 0x4f, 0x48, 0x0d, 0x1b, 0x39, 0x41, 0x3c, 0x41, 0x41, 0x3f, 0x3f, 0x3f, 0x3a, 0x3f, 0x33, 0x3f, 0x43, 0x3f, 0x3f, 0x41, 0x2c, 0x1b, 0x7a, 0xb9, 0xb4, 0xac, 0xa8, 0xad, 0xb0, 0xb0, 0xb0, 0xb2, 0xb8, 0xba, 0xbc, 0xbe, 0xba, 0xb3, 0xad, 0xab, 0xac, 0xb0, 0xae, 0xae, 0xae, 0xae, 0xad, 0xae, 0xae, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xac, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xb1, 0xae, 0xae, 0xac, 0xae, 0xab, 0xae, 0xad, 0xab, 0xad, 0xb0, 0xae, 0xb4, 0x0a, 0x0c, 0x3c, 0x3e, 0x43, 0x43, 0x3f, 0x3f, 0x3f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3e, 0x3e, 0x32, 0x32, 0x27, 0x32, 0x2a, 0x2a, 0x26, 0x26, 0x26, 0x30, 0x27, 0x2a, 0x26, 0x26, 0x27, 0x32, 0x32, 0x32, 0x35, 0x2f, 0x39, 0x09, 0xfc, 0xa6, 0xa6, 0xa2, 0xa5, 0xa7, 0xa1, 0xa8, 0xe4, 0xfa, 0xf7, 0xf9, 0xfa, 0xf7, 0xf9, 0xfa, 0xf6, 0xeb, 0xe4, 0xd8, 0xdc, 0xdc, 0xd8, 0xd8, 0xdc, 0xdc, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xdc, 0xe4, 0xe4, 0xe8, 0xeb, 0xec, 0xf0, 0x4c, 0xc7, 0x48, 0x39, 0x19, 0x2d, 0x31, 0x2a, 0x2b, 0x2b, 0x33, 0x33, 0x30, 0x2c, 0x2d, 0x31, 0x36, 0x30, 0x31, 0x24, 0x40, 0x12, 0x0a, 0x08, 0xac, 0xad, 0xab, 0xab, 0xab, 0xab, 0xa6, 0xb9, 0xf6, 0xf8, 0xfa, 0xf9, 0x9c, 0xfa, 0x9c, 0xe8, 0xd8, 0xdd, 0xdc, 0xe7, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0xd8, 0xdc, 0xd8, 0xd8, 0xdd, 0xdc, 0xdc, 0xe9, 0x4c, 0xf0, 0xec, 0xe7, 0xed, 0x52, 0x3d, 0x1d, 0x18, 0x22, 0x2b, 0x21, 0x21, 0x23, 0x19, 0x8e, 0x53, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xfb, 0x01, 0xec, 0xfe, 0x9e, 0x02, 0x07, 0x0c, 0x10, 0x12, 0x1b, 0x29, 0x38, 0x38, 0x38, 0x3c, 0x40, 0x41, 0x41, 0x41, 0x3f, 0x41, 0x41, 0x40, 0x40, 0x3b, 0x1a, 0xaf, 0xb9, 0xb7, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xae, 0xae, 0xae, 0xba, 0xbf, 0xc7, 0xcd, 0xc7, 0xd2, 0xcd, 0xd2, 0xcd, 0xd2, 0xcd, 0xcd, 0xcd, 0xc7, 0xcd, 0xcd, 0xd2, 0xd2, 0xcd, 0xd2, 0xcd, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xcd, 0xd2, 0xd2, 0xbf, 0xb1, 0x0e, 0x0a, 0x0c, 0x2f, 0x41, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3e, 0x3e, 0x3e, 0x32, 0x32, 0x32, 0x36, 0x30, 0x36, 0x30, 0x36, 0x30, 0x32, 0x36, 0x36, 0x30, 0x31, 0x36, 0x30, 0x30, 0x21, 0x28, 0x2e, 0x12, 0x05, 0x04, 0xa3, 0xa8, 0xa4, 0xa8, 0xa5, 0xa2, 0xbe, 0xf8, 0xfa, 0xf7, 0xf8, 0x9c, 0xf8, 0xf8, 0xf7, 0xee, 0xe4, 0xdc, 0xdc, 0xd8, 0xdc, 0xe4, 0xe9, 0xeb, 0xee, 0xee, 0xee, 0xee, 0xec, 0xeb, 0xe9, 0xe8, 0xe4, 0xe8, 0xe4, 0xeb, 0xeb, 0xec, 0xee, 0xe4, 0x3b, 0x49, 0x17, 0x28, 0x2d, 0x2a, 0x30, 0x2b, 0x31, 0x33, 0x31, 0x30, 0x2d, 0x35, 0x35, 0x31, 0x2d, 0x38, 0x20, 0x0d, 0x08, 0xaa, 0xae, 0xab, 0xab, 0xab, 0xad, 0xab, 0xac, 0xd6, 0xfb, 0x9c, 0xf8, 0xf9, 0xf8, 0xf7, 0xeb, 0xdc, 0xd8, 0xe8, 0xe7, 0xdc, 0xd8, 0xdc, 0xe8, 0xec, 0xec, 0xf0, 0xee, 0xee, 0xec, 0xe8, 0xe4, 0xdc, 0xe4, 0xe4, 0xeb, 0xea, 0xea, 0xec, 0x52, 0x4b, 0x1b, 0x19, 0x24, 0x23, 0x22, 0x26, 0x28, 0x18, 0x29, 0x53, 0x58, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xed, 0xac, 0xa0, 0xa2, 0xfc, 0xa0, 0x02, 0x5d, 0x02, 0x02, 0x02, 0x03, 0x05, 0x05, 0x07, 0x09, 0x0d, 0x0c, 0x10, 0x12, 0x10, 0x12, 0x12, 0x14, 0x14, 0xb4, 0xb4, 0xb4, 0xb9, 0xba, 0xba, 0xbc, 0xbc, 0xbe, 0xbf, 0xbf, 0xc0, 0xc2, 0xbf, 0xbe, 0xbc, 0xba, 0xb7, 0xb5, 0xb1, 0xb2, 0xb3, 0xb7, 0xb7, 0xba, 0xb9, 0xb7, 0xb9, 0xba, 0xb9, 0xba, 0xb9, 0xbc, 0xbd, 0xbc, 0xbd, 0xbe, 0xbd, 0xbe, 0xbd, 0xbe, 0xbf, 0xc2, 0xc2, 0xc2, 0xc7, 0xca, 0xca, 0xcd, 0xd3, 0xc7, 0xb9, 0xb4, 0x0d, 0x20, 0x40, 0x41, 0x41, 0x41, 0x3f, 0x41, 0x3f, 0x3f, 0x3f, 0x43, 0x33, 0x3e, 0x33, 0x32, 0x33, 0x32, 0x30, 0x32, 0x30, 0x2a, 0x30, 0x2b, 0x2b, 0x30, 0x2a, 0x2d, 0x2d, 0x34, 0x23, 0x37, 0x28, 0x24, 0x39, 0x8e, 0x0d, 0x07, 0xa6, 0xa3, 0xa5, 0xa5, 0xa5, 0xa1, 0xae, 0xe8, 0xf9, 0xf5, 0xf8, 0xf8, 0xf5, 0xf8, 0xf6, 0xeb, 0xe8, 0xdc, 0xd8, 0xdc, 0xe4, 0xe9, 0xec, 0xee, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf3, 0xf2, 0xf0, 0xee, 0xec, 0xe9, 0xe8, 0xe4, 0xe8, 0xeb, 0xeb, 0x52, 0xca, 0x48, 0x3d, 0x19, 0x2d, 0x33, 0x30, 0x2b, 0x2d, 0x2d, 0x30, 0x31, 0x2d, 0x31, 0x31, 0x30, 0x38, 0x29, 0x14, 0x08, 0xab, 0xad, 0xad, 0xa9, 0xad, 0xac, 0xab, 0xab, 0xbb, 0xf2, 0xf9, 0xf8, 0x9c, 0xfa, 0xf8, 0xec, 0xdc, 0xe4, 0xe8, 0xdc, 0xd8, 0xd8, 0xe8, 0xee, 0xf3, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf0, 0xf0, 0xf0, 0x4c, 0xe4, 0xe4, 0xe4, 0xea, 0xea, 0xeb, 0x4f, 0x53, 0x3d, 0x1b, 0x19, 0x23, 0x1f, 0x1f, 0x26, 0x17, 0x2e, 0x50, 0x57, 0x58, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xd3, 0xa1, 0xa5, 0xa3, 0xaa, 0xa8, 0xa6, 0x04, 0xa3, 0xfc, 0xa2, 0xfc, 0xa1, 0xfc, 0xa0, 0xa1, 0xa0, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfc, 0xa0, 0xfc, 0xfc, 0xa0, 0xa1, 0xa4, 0xa7, 0xa9, 0xa9, 0xab, 0xab, 0xac, 0xac, 0xae, 0xac, 0xad, 0xac, 0xae, 0xb1, 0xb3, 0xb5, 0xb3, 0xb3, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xac, 0xac, 0xab, 0xab, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa8, 0xa9, 0xa8, 0xa8, 0xab, 0xaa, 0xa9, 0xaa, 0xac, 0xfe, 0xfe, 0xfe, 0x14, 0x20, 0x87, 0x25, 0x1d, 0x25, 0x1d, 0x25, 0x24, 0x2f, 0x2c, 0x2c, 0x2c, 0x2c, 0x2f, 0x28, 0x34, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x28, 0x25, 0x2f, 0x25, 0x25, 0x29, 0x25, 0x29, 0x1b, 0x20, 0x20, 0x04, 0xfc, 0xa6, 0xa5, 0xa5, 0xa4, 0xa3, 0xa2, 0xc2, 0xf9, 0xf7, 0xf4, 0xff, 0xf8, 0xf5, 0x9c, 0xec, 0xe8, 0xdc, 0xdc, 0xdc, 0xe4, 0xf2, 0xed, 0xee, 0xef, 0xed, 0xec, 0xed, 0xec, 0xed, 0xec, 0xee, 0xee, 0xf3, 0xf0, 0xec, 0xeb, 0xe9, 0xe8, 0xe8, 0xeb, 0xee, 0xe4, 0x3b, 0x48, 0x29, 0x22, 0x33, 0x2b, 0x30, 0x28, 0x2d, 0x31, 0x31, 0x2d, 0x31, 0x31, 0x37, 0x38, 0x8e, 0x0a, 0xac, 0xab, 0xad, 0xad, 0xac, 0xae, 0xac, 0xab, 0xae, 0xd6, 0x99, 0xf9, 0xf8, 0xf9, 0xf8, 0xee, 0xe4, 0xe4, 0xe8, 0xe4, 0xdc, 0xe4, 0xee, 0xf6, 0xf3, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf3, 0xee, 0xec, 0xe9, 0xe4, 0xe7, 0xea, 0xea, 0xed, 0x55, 0x96, 0x1b, 0x17, 0x23, 0x1f, 0x1f, 0x21, 0x18, 0x29, 0x51, 0x57, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0xbe, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa6, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa3, 0xa7, 0xa3, 0xa6, 0xa4, 0xfc, 0xa4, 0xa1, 0xa2, 0xfc, 0xfc, 0xfc, 0xa2, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa6, 0xa6, 0xa6, 0xa7, 0xa8, 0xa9, 0xa8, 0xa7, 0xa8, 0xa8, 0xab, 0xab, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xaf, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xaf, 0xb1, 0xb0, 0xaf, 0xb0, 0xaf, 0xb0, 0xaf, 0xae, 0xaf, 0xaf, 0xaf, 0xaf, 0xae, 0xaf, 0xaf, 0xfe, 0x08, 0x0a, 0x05, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x0c, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x10, 0x77, 0x10, 0x0c, 0x10, 0x0c, 0x10, 0x0c, 0x10, 0x10, 0x0c, 0x10, 0x0c, 0x0c, 0x0c, 0x0c, 0x09, 0x0a, 0xfe, 0x04, 0xa6, 0xa5, 0xa5, 0xa7, 0xa4, 0xa4, 0xae, 0xe8, 0xf9, 0xf5, 0xf7, 0xff, 0xf5, 0xf5, 0xf0, 0xe8, 0xe4, 0xe4, 0xe4, 0xe8, 0xee, 0xed, 0xed, 0xec, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xec, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xec, 0xe8, 0xe9, 0xeb, 0xeb, 0xeb, 0x46, 0x92, 0x40, 0x24, 0x33, 0x33, 0x2d, 0x2d, 0x2d, 0x31, 0x2a, 0x31, 0x31, 0x35, 0x37, 0x2e, 0x12, 0xfe, 0xab, 0xad, 0xad, 0xad, 0xae, 0xac, 0xac, 0xab, 0xbb, 0xf2, 0xf9, 0xf8, 0xf8, 0xf9, 0xf3, 0xe4, 0xe4, 0xe8, 0xe8, 0xdc, 0xe8, 0xee, 0xf3, 0xf3, 0xee, 0xee, 0xf2, 0xee, 0xee, 0xf2, 0xf2, 0xf3, 0xf0, 0xf0, 0xf4, 0xf4, 0xec, 0xe8, 0xe7, 0xe7, 0xe8, 0x4c, 0x4f, 0x53, 0x8f, 0x17, 0x23, 0x26, 0x1e, 0x2b, 0x18, 0x2e, 0x4e, 0x57, 0x58, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9c, 0xbd, 0xa9, 0xa7, 0xa7, 0xa7, 0xa3, 0xa4, 0xa3, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa7, 0xa3, 0xa7, 0xa7, 0xa6, 0xa6, 0xa6, 0xa8, 0xa6, 0xa8, 0xa8, 0xa6, 0xa8, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa3, 0xa8, 0xa2, 0xa2, 0xa4, 0xa2, 0xa2, 0xa1, 0xa2, 0xa1, 0xa1, 0xa2, 0xa2, 0xa2, 0xa3, 0xa1, 0xa4, 0xa1, 0xa3, 0xa3, 0xa4, 0xa4, 0xa6, 0xa3, 0xa6, 0xa8, 0xa9, 0xa8, 0xab, 0xa9, 0xac, 0xab, 0xab, 0xac, 0xab, 0xa9, 0xab, 0xac, 0xac, 0xab, 0xac, 0xaa, 0xac, 0xaa, 0xac, 0xaa, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x04, 0xaa, 0xa8, 0xa8, 0xa5, 0xa7, 0xa8, 0xa3, 0xa3, 0xbe, 0xf5, 0xf7, 0xf8, 0x9c, 0xf8, 0xf5, 0xf1, 0xeb, 0xe8, 0xe4, 0xe4, 0xe8, 0xec, 0xee, 0xee, 0xed, 0xee, 0xed, 0xef, 0xf2, 0xed, 0xee, 0xf2, 0xf0, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xf2, 0xec, 0xeb, 0xe8, 0xe9, 0xeb, 0xe4, 0x92, 0x45, 0x2e, 0x22, 0x33, 0x2d, 0x31, 0x34, 0x35, 0x2a, 0x35, 0x35, 0x2c, 0x3c, 0x29, 0x0d, 0xfe, 0xad, 0xad, 0xad, 0xad, 0xfe, 0xae, 0xaa, 0xb0, 0xd3, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xe9, 0xe4, 0xe8, 0xe8, 0xe4, 0xe9, 0xee, 0xf2, 0xee, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf0, 0xf2, 0xee, 0xee, 0xee, 0xf2, 0xf4, 0xef, 0xeb, 0xea, 0xe7, 0xe8, 0xe8, 0x4f, 0x4f, 0x48, 0x17, 0x1f, 0x1e, 0x21, 0x21, 0x18, 0x1d, 0x4e, 0x57, 0x58, 0xfb, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xbd, 0xb0, 0xb5, 0xb3, 0xb5, 0xb3, 0xb1, 0xaf, 0xae, 0xad, 0xab, 0xaa, 0xa8, 0xa8, 0xa6, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa4, 0xa2, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa6, 0xa5, 0xa6, 0xa2, 0xa4, 0xa6, 0xa3, 0xa3, 0xa4, 0xa1, 0xa4, 0xa2, 0xa3, 0xa1, 0xa1, 0xa1, 0xa2, 0xa1, 0xa1, 0xa0, 0xa1, 0xa0, 0xa0, 0xa1, 0xa1, 0xa0, 0xa1, 0xa0, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xfc, 0xa2, 0xfc, 0xfc, 0xfc, 0xfc, 0xa6, 0xfc, 0xa6, 0xa6, 0xa6, 0x04, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa6, 0xaa, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xa8, 0xa5, 0xa7, 0xa7, 0xa3, 0xa3, 0xa8, 0xdc, 0xf9, 0x9c, 0xf8, 0xf8, 0x9c, 0xf5, 0xef, 0xe9, 0xe8, 0xe4, 0xe8, 0xeb, 0xee, 0xee, 0xf2, 0xed, 0xec, 0xed, 0xf2, 0xf2, 0xf4, 0xee, 0xee, 0xec, 0xed, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xec, 0xec, 0xeb, 0xeb, 0xeb, 0xe9, 0xd3, 0x48, 0x39, 0x2c, 0x2c, 0x2d, 0x2b, 0x2d, 0x2d, 0x2b, 0x36, 0x35, 0x37, 0x38, 0x12, 0x0a, 0xac, 0xad, 0xad, 0xad, 0xac, 0xae, 0xfe, 0xa9, 0xb9, 0xeb, 0xfb, 0x9c, 0xf8, 0xf9, 0xed, 0xe8, 0xe9, 0xe4, 0xe8, 0xe8, 0xec, 0xee, 0xf4, 0xf3, 0xee, 0xf3, 0xee, 0xee, 0xec, 0xf3, 0xf6, 0xf6, 0xee, 0xf0, 0xee, 0xf4, 0xf2, 0xee, 0xf0, 0xeb, 0xea, 0xe8, 0xe8, 0x4c, 0xef, 0x4d, 0x17, 0x8b, 0x1f, 0x1f, 0x22, 0x19, 0x1b, 0x50, 0x58, 0x01, 0x99, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9c, 0xbd, 0xb1, 0xb7, 0xb5, 0xb5, 0xb4, 0xb4, 0xb7, 0xb4, 0xb8, 0xb7, 0xb8, 0xb9, 0xb4, 0xb4, 0xb4, 0xb1, 0xb3, 0xb0, 0xb1, 0xae, 0xae, 0xac, 0xac, 0xa9, 0xa8, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xab, 0xa7, 0xb1, 0xc2, 0xd3, 0xca, 0xca, 0xc0, 0xc7, 0xc0, 0xbd, 0xbd, 0xbb, 0xb9, 0xb9, 0xb9, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb1, 0xb1, 0xb1, 0xac, 0xab, 0xaa, 0xa4, 0xa4, 0xa6, 0xa2, 0xa1, 0xa0, 0xa0, 0xa0, 0x9f, 0xa0, 0xa0, 0x9f, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa2, 0xa1, 0xfc, 0xa1, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa6, 0xa4, 0xa6, 0xa6, 0xa8, 0xa8, 0xa5, 0xa7, 0xa7, 0xa7, 0xa9, 0xa7, 0xa9, 0xa5, 0xa7, 0xa9, 0xa9, 0xa7, 0xa7, 0xa5, 0xa9, 0xa3, 0xa1, 0xb7, 0xf2, 0xf7, 0xf7, 0xf9, 0xf8, 0xf4, 0xef, 0xec, 0xe9, 0xe8, 0xe8, 0xeb, 0xee, 0xee, 0xec, 0xec, 0xee, 0xf2, 0xf2, 0xee, 0xec, 0xed, 0xee, 0xee, 0xf2, 0xf3, 0xee, 0xec, 0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xed, 0xe8, 0xeb, 0xe7, 0x95, 0x46, 0x3d, 0x38, 0x2c, 0x35, 0x2b, 0x2d, 0x31, 0x35, 0x36, 0x35, 0x38, 0x39, 0x14, 0x08, 0xac, 0xad, 0xad, 0xad, 0xae, 0xfe, 0xae, 0xac, 0xcd, 0xf9, 0xfa, 0xf6, 0x99, 0xf6, 0xe9, 0xe8, 0xe9, 0xe8, 0xe8, 0xec, 0xf0, 0xec, 0xee, 0xf6, 0xf2, 0xeb, 0xec, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xf3, 0xf3, 0xf0, 0xf2, 0xf2, 0xf2, 0xee, 0xf0, 0xea, 0xe8, 0xe8, 0xe9, 0xed, 0x54, 0x42, 0x17, 0x28, 0x19, 0x24, 0x13, 0x12, 0x4b, 0xfb, 0x01, 0x99, 0x01, 0x99, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xbd, 0xb1, 0xb6, 0xb3, 0xb3, 0xb5, 0xb9, 0xb4, 0xb7, 0xb4, 0xb3, 0xb3, 0xb7, 0xb7, 0xb7, 0xb7, 0xb8, 0xb7, 0xb7, 0xb6, 0xb6, 0xb6, 0xb6, 0xb7, 0xb8, 0xb8, 0xb8, 0xb7, 0xb5, 0xb5, 0xb3, 0xb1, 0xae, 0xc2, 0xc2, 0xb7, 0xb9, 0xbb, 0xbd, 0xbb, 0xbb, 0xca, 0xc0, 0xc0, 0xbd, 0xca, 0xbd, 0xc7, 0xd3, 0xc0, 0xca, 0xca, 0xc7, 0xc7, 0xca, 0xc2, 0xc7, 0xca, 0xc2, 0xc7, 0xc7, 0xc0, 0xbe, 0xc0, 0xbc, 0xb7, 0xab, 0xa7, 0xa9, 0xa9, 0xa7, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa6, 0xfc, 0xfc, 0xfc, 0xa4, 0xfc, 0xa4, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xfc, 0xa2, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xa6, 0xfc, 0xa4, 0xa7, 0xa7, 0xa7, 0xa9, 0xa7, 0xa9, 0xa9, 0xa7, 0xab, 0xab, 0xa9, 0xa4, 0xa9, 0xa5, 0xa9, 0xa5, 0xa2, 0xd3, 0xf9, 0xf4, 0xf7, 0xf9, 0x9c, 0xef, 0xec, 0xe9, 0xe8, 0xe9, 0xeb, 0xec, 0xf2, 0xee, 0xec, 0xee, 0xec, 0xec, 0xec, 0xee, 0xf3, 0xf3, 0xee, 0xee, 0xee, 0xf0, 0xf2, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xf4, 0xe9, 0xec, 0xe9, 0xec, 0x46, 0x48, 0x39, 0x2c, 0x35, 0x36, 0x33, 0x31, 0x3a, 0x33, 0x37, 0x38, 0x20, 0x0a, 0xaa, 0xae, 0xad, 0xad, 0xad, 0xac, 0xae, 0xac, 0xb1, 0xe9, 0xfb, 0xf3, 0xf9, 0xfa, 0xec, 0xe9, 0xe8, 0xe9, 0xe8, 0xe8, 0xec, 0xec, 0xf6, 0xee, 0xe8, 0xf6, 0xf9, 0xf7, 0xf0, 0xf0, 0xf6, 0xf6, 0xf0, 0xf0, 0xf3, 0xf0, 0xf2, 0xee, 0xf4, 0xf0, 0xf3, 0xec, 0xeb, 0xeb, 0xe8, 0xe9, 0xf8, 0x4a, 0x11, 0x11, 0x13, 0x11, 0x10, 0x09, 0xb9, 0x4c, 0xfb, 0xfb, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9c, 0xbe, 0xb2, 0xb6, 0xb6, 0xb3, 0xb3, 0xb3, 0xb7, 0xb7, 0xb7, 0xb8, 0xb6, 0xb2, 0xb6, 0xb5, 0xb7, 0xb7, 0xb5, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb6, 0xb5, 0xb6, 0xd3, 0xad, 0x00, 0x9a, 0x9d, 0x9b, 0x9a, 0x9d, 0x9f, 0x9e, 0x9d, 0x9f, 0x9e, 0xa2, 0xa0, 0xa0, 0xac, 0xa1, 0xa2, 0xa8, 0xa3, 0xa2, 0xac, 0xb1, 0xac, 0xb1, 0xaf, 0xae, 0xb1, 0xb3, 0xaf, 0xad, 0xb4, 0xba, 0xb7, 0xb3, 0xb3, 0xb4, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb3, 0xb2, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb6, 0xb2, 0xb2, 0xab, 0xa5, 0xa8, 0xa8, 0xa5, 0xa3, 0xa8, 0xe8, 0xf9, 0xf7, 0xf8, 0xf8, 0xf4, 0xec, 0xeb, 0xe9, 0xe8, 0xe9, 0xec, 0xee, 0xee, 0xee, 0xeb, 0xee, 0xee, 0xf6, 0xf6, 0xf3, 0xee, 0xf3, 0xf7, 0xf3, 0xee, 0xec, 0xec, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xf2, 0xed, 0x4c, 0xeb, 0xec, 0x95, 0x46, 0x39, 0x2f, 0x33, 0x3f, 0x33, 0x37, 0x3a, 0x35, 0x2f, 0x39, 0x14, 0xfe, 0xac, 0xad, 0xae, 0xae, 0xae, 0xae, 0xad, 0xac, 0xb9, 0xf7, 0xfa, 0x9c, 0xfa, 0xf5, 0xe9, 0xe9, 0xe9, 0xe8, 0xeb, 0xeb, 0xf0, 0xee, 0xf3, 0xf0, 0xf3, 0xf6, 0xe4, 0xd2, 0xc2, 0xbe, 0xcd, 0xdd, 0xec, 0xf3, 0xf0, 0xf3, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xee, 0xec, 0xeb, 0xe9, 0xe8, 0xed, 0x53, 0x14, 0x09, 0x10, 0x0d, 0x0d, 0x08, 0x04, 0xd6, 0xfb, 0xfb, 0x57, 0xff, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9c, 0xbf, 0xb2, 0xb6, 0xb2, 0xb6, 0xb6, 0xb7, 0xb5, 0xb3, 0xb6, 0xb2, 0xb6, 0xb2, 0xb6, 0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb3, 0xb3, 0xcd, 0xa7, 0x9a, 0x9d, 0x9a, 0x00, 0xa1, 0xa3, 0x00, 0x9a, 0xa2, 0xac, 0x9f, 0x9a, 0xa0, 0x00, 0x9b, 0x00, 0x9e, 0x9a, 0x9d, 0x9d, 0x00, 0x00, 0x9d, 0x9a, 0x9e, 0xa0, 0x9e, 0x00, 0x00, 0x00, 0xa1, 0xbc, 0xb9, 0xb7, 0xb5, 0xb7, 0xb6, 0xb7, 0xb6, 0xb7, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb7, 0xb6, 0xb7, 0xb7, 0xb3, 0xb5, 0xb3, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb8, 0xb7, 0xb6, 0xb6, 0xb3, 0xac, 0xa4, 0xa8, 0xa8, 0xa5, 0xa2, 0xb7, 0xf3, 0xf8, 0xf7, 0xf8, 0xf7, 0xed, 0xec, 0xeb, 0xe8, 0xe9, 0x4c, 0xec, 0xed, 0xed, 0xec, 0xec, 0xf9, 0xf3, 0xe4, 0xd8, 0xd3, 0xcd, 0xcd, 0xdc, 0xee, 0xf9, 0xf6, 0xf3, 0xf3, 0xee, 0xee, 0xee, 0xec, 0xee, 0xed, 0xed, 0xf4, 0xe9, 0xed, 0xeb, 0x95, 0x46, 0x93, 0x2f, 0x33, 0x3e, 0x33, 0x31, 0x37, 0x31, 0x38, 0x20, 0x0e, 0xac, 0xb0, 0xad, 0xae, 0xae, 0xae, 0xae, 0xad, 0xad, 0xd2, 0xfb, 0x9c, 0xf9, 0xf9, 0xed, 0xe4, 0xeb, 0xe9, 0xe8, 0xeb, 0xf0, 0xee, 0xf0, 0xee, 0xf7, 0xf0, 0xcd, 0xb8, 0xae, 0xb1, 0xb3, 0xb2, 0xb1, 0xbf, 0xe7, 0xf6, 0xee, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xe9, 0xeb, 0xe8, 0xeb, 0x52, 0x3b, 0x0a, 0x0e, 0x7a, 0x0e, 0xaf, 0xa9, 0xd6, 0xfa, 0xfa, 0xff, 0x57, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf5, 0xc2, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb5, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb6, 0xb7, 0xb8, 0xcd, 0xa2, 0x9a, 0x9b, 0x00, 0xa6, 0xec, 0xd3, 0x00, 0xaf, 0xe4, 0xd3, 0xc0, 0x9e, 0xbd, 0xc2, 0x00, 0xc0, 0xbd, 0xa4, 0xbd, 0xc2, 0xaf, 0xa6, 0xbb, 0xa2, 0xa0, 0xca, 0xb4, 0x9b, 0x00, 0x00, 0xa0, 0xbd, 0xb7, 0xb3, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb6, 0xb3, 0xb6, 0xb6, 0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb3, 0xb5, 0xb3, 0xb6, 0xb3, 0xb6, 0xb3, 0xb6, 0xb3, 0xb6, 0xb5, 0xb6, 0xb2, 0xb6, 0xb2, 0xb6, 0xb3, 0xb4, 0xb5, 0xb4, 0xb5, 0xb3, 0xb3, 0xb3, 0xb7, 0xb2, 0xa9, 0xa8, 0xa8, 0xa8, 0xa6, 0xa3, 0xca, 0xf9, 0xf7, 0xf5, 0xf8, 0xf4, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xed, 0xec, 0xeb, 0xf6, 0xf3, 0xdd, 0xc7, 0xb8, 0xb3, 0xb2, 0xb5, 0xb3, 0xb8, 0xbf, 0xd8, 0xf7, 0xf7, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xec, 0xee, 0xf4, 0x4c, 0xed, 0x4c, 0xe4, 0x46, 0x93, 0x38, 0x35, 0x33, 0x3f, 0x37, 0x37, 0x37, 0x39, 0x20, 0xfe, 0xae, 0xae, 0xad, 0xae, 0xad, 0xae, 0xad, 0xad, 0xb0, 0xed, 0xfb, 0xf8, 0xf8, 0xf7, 0xeb, 0xe9, 0xec, 0xeb, 0xe8, 0xeb, 0xee, 0xec, 0xeb, 0xf7, 0xf0, 0xbf, 0xb3, 0xb1, 0xba, 0xb7, 0xb5, 0xb6, 0xb3, 0xb2, 0xb8, 0xdc, 0xf6, 0xf6, 0xee, 0xf7, 0xee, 0xf2, 0xf2, 0xf2, 0xeb, 0xeb, 0xe8, 0xeb, 0x52, 0x46, 0x0e, 0x0e, 0x0e, 0xb4, 0xaf, 0xab, 0xd6, 0xfb, 0xfb, 0x57, 0x57, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9c, 0xc7, 0xb3, 0xb5, 0xb6, 0xb2, 0xb6, 0xb6, 0xb5, 0xb7, 0xb7, 0xb7, 0xb5, 0xb6, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb5, 0xb6, 0xb7, 0xb6, 0xb7, 0xb5, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb8, 0xb3, 0xb8, 0xd3, 0xa2, 0x00, 0x00, 0xfd, 0xbd, 0x01, 0xb4, 0x9a, 0x4c, 0xf7, 0xaa, 0xb4, 0xaa, 0xb9, 0xe9, 0x9b, 0xf8, 0xca, 0x9b, 0xc0, 0xe9, 0xca, 0xdc, 0xca, 0xc0, 0x9d, 0xc0, 0xd8, 0xa0, 0x00, 0x00, 0xa1, 0xbd, 0xb9, 0xb5, 0xb5, 0xb5, 0xb6, 0xb5, 0xb5, 0xb5, 0xb4, 0xb5, 0xb5, 0xb5, 0xb7, 0xb5, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb6, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb8, 0xb1, 0xa8, 0xa6, 0xa9, 0xa8, 0xa6, 0xa8, 0xdc, 0x99, 0xf6, 0x9c, 0x9c, 0xee, 0xed, 0xec, 0xe9, 0xeb, 0xec, 0xec, 0xec, 0xeb, 0xf6, 0xec, 0xd2, 0xb8, 0xb3, 0xb6, 0xba, 0xba, 0xb6, 0xb3, 0xb8, 0xb0, 0xb5, 0xd8, 0xf3, 0xf6, 0xf2, 0xee, 0xf4, 0xf2, 0xee, 0xec, 0xf0, 0xec, 0xf2, 0x4c, 0x4c, 0x4c, 0x95, 0x93, 0x39, 0x37, 0x35, 0x3e, 0x35, 0x37, 0x2f, 0x39, 0x0e, 0xfe, 0xb0, 0xae, 0xae, 0xae, 0xad, 0xb0, 0xad, 0xad, 0xb7, 0xfa, 0xf9, 0xfa, 0xf7, 0xf4, 0xe9, 0xeb, 0xe9, 0xeb, 0xeb, 0xec, 0xec, 0xf0, 0xf3, 0xf3, 0xc7, 0xae, 0xb5, 0xb7, 0xb6, 0xb5, 0xb6, 0xb3, 0xb6, 0xb2, 0xb2, 0xbc, 0xea, 0xf3, 0xee, 0xf6, 0xec, 0xf4, 0xee, 0xf3, 0xec, 0xeb, 0xe8, 0xe8, 0x52, 0x98, 0x0e, 0xb1, 0x0e, 0xb1, 0xb1, 0xab, 0xd8, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xca, 0xb3, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb7, 0xb5, 0xb4, 0xb7, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb5, 0xb6, 0xb7, 0xb6, 0xb5, 0xb6, 0xb7, 0xb6, 0xb7, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb3, 0xb9, 0xd3, 0xa2, 0x00, 0x00, 0x00, 0xfe, 0x4c, 0xaf, 0x9d, 0xb4, 0xbb, 0xc0, 0xca, 0xd3, 0xd3, 0xbd, 0x9e, 0xc7, 0xe4, 0xfc, 0xaa, 0xd3, 0xaa, 0xca, 0xbb, 0x95, 0xa6, 0xc0, 0x46, 0xa0, 0x00, 0x00, 0xa0, 0xbd, 0xb9, 0xb5, 0xb7, 0xb6, 0xb5, 0xb6, 0xb5, 0xb5, 0xb7, 0xb4, 0xb7, 0xb5, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb4, 0xb5, 0xb7, 0xb1, 0xa7, 0xa8, 0xa9, 0xa8, 0xa4, 0xb4, 0xed, 0xf9, 0xf5, 0xf7, 0xf4, 0xee, 0xec, 0xec, 0xeb, 0xec, 0xec, 0xf2, 0xeb, 0xf0, 0xf3, 0xc7, 0xb0, 0xb6, 0xb8, 0xb6, 0xb6, 0xb6, 0xb8, 0xb6, 0xb6, 0xb8, 0xb3, 0xb3, 0xd6, 0xf9, 0xee, 0xef, 0xf6, 0xec, 0xf2, 0xee, 0xee, 0xee, 0xef, 0xed, 0x4c, 0x4c, 0x95, 0x92, 0x39, 0x2f, 0x35, 0x35, 0x37, 0x3c, 0x38, 0x20, 0x0e, 0xaf, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xa9, 0xc7, 0xfb, 0xf9, 0xf8, 0xf5, 0xed, 0xe9, 0xeb, 0xe9, 0xe9, 0xed, 0xee, 0xed, 0xf0, 0xf7, 0xd6, 0xb1, 0xb7, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb2, 0xb2, 0xb6, 0xb0, 0xcd, 0xee, 0xf7, 0xec, 0xed, 0xf2, 0xee, 0xf2, 0xee, 0xeb, 0xe8, 0xe8, 0x4f, 0x4f, 0x1a, 0xaf, 0xb4, 0xb4, 0xb3, 0xaf, 0xe4, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xcd, 0xb3, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb7, 0xb7, 0xb5, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb7, 0xb6, 0xb7, 0xb6, 0xb5, 0xb6, 0xb7, 0xb7, 0xb6, 0xb7, 0xb6, 0xb6, 0xb7, 0xb5, 0xb9, 0xcd, 0xaa, 0x9b, 0x00, 0x00, 0xac, 0x4c, 0xef, 0xb4, 0x00, 0x00, 0x9e, 0xb9, 0xe4, 0x99, 0xdc, 0x9b, 0xb1, 0xf1, 0xe9, 0x46, 0xd3, 0xa0, 0xb4, 0xc0, 0xe4, 0xf1, 0xe4, 0xc2, 0x9e, 0x00, 0x00, 0xa0, 0xbd, 0xb9, 0xb5, 0xb7, 0xb5, 0xb6, 0xb5, 0xb7, 0xb5, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb7, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb7, 0xb1, 0xa9, 0xa8, 0xa9, 0xa8, 0xa4, 0xbd, 0xfb, 0xf6, 0xf5, 0xf6, 0xf2, 0xec, 0xec, 0xed, 0xeb, 0xec, 0xec, 0xec, 0xec, 0xee, 0xd2, 0xb1, 0xba, 0xb6, 0xbc, 0xba, 0xb8, 0xba, 0xb8, 0xba, 0xb2, 0xb5, 0xb8, 0xae, 0xb7, 0xeb, 0xf7, 0xec, 0xf2, 0xed, 0xf2, 0xf3, 0xf2, 0xed, 0xef, 0x4f, 0xeb, 0x4c, 0xe4, 0x92, 0x8e, 0x38, 0x3a, 0x3a, 0x37, 0x37, 0x39, 0x20, 0x0a, 0xb1, 0xb0, 0xae, 0xb1, 0xb0, 0xad, 0xad, 0xb0, 0xa9, 0xe4, 0xfb, 0xf7, 0xf8, 0xf5, 0xeb, 0xeb, 0xec, 0xeb, 0xeb, 0xf2, 0xec, 0xec, 0xf6, 0xeb, 0xbe, 0xae, 0xba, 0xba, 0xb8, 0xb8, 0xba, 0xbc, 0xba, 0xb6, 0xb3, 0xb2, 0xb1, 0xbb, 0xea, 0xf6, 0xeb, 0xf8, 0xf3, 0xf2, 0xf2, 0xee, 0xec, 0xeb, 0xe9, 0x4c, 0x4f, 0xc0, 0x0e, 0xb1, 0xb4, 0xb1, 0xb2, 0xe8, 0x01, 0xfb, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xd6, 0xb3, 0xb5, 0xb7, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb7, 0xb6, 0xb5, 0xb6, 0xb7, 0xb6, 0xb7, 0xba, 0xca, 0xaa, 0x00, 0x9a, 0x9a, 0x1a, 0xf7, 0x46, 0xb1, 0xaf, 0x9f, 0x00, 0x9d, 0xa0, 0xc0, 0x99, 0xaf, 0xbd, 0xca, 0xbd, 0xe9, 0xe4, 0xa2, 0xa2, 0x95, 0xa6, 0xff, 0xff, 0xc0, 0x9f, 0x00, 0x00, 0x9f, 0xbd, 0xb8, 0xb5, 0xb5, 0xb6, 0xb6, 0xb5, 0xb5, 0xb7, 0xb7, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb3, 0xb1, 0xa7, 0xa9, 0xab, 0xa6, 0xa8, 0xd3, 0xfa, 0xf2, 0xf7, 0x9c, 0xed, 0xeb, 0xeb, 0xed, 0xec, 0xed, 0xed, 0xeb, 0xf0, 0xd8, 0xb7, 0xb5, 0xbc, 0xba, 0xb6, 0xba, 0xba, 0xba, 0xbc, 0xbc, 0xba, 0xb0, 0xb5, 0xb3, 0xac, 0xc0, 0xf7, 0xee, 0xec, 0xf4, 0xee, 0xed, 0xf2, 0xef, 0xef, 0xef, 0xeb, 0xeb, 0xe9, 0x46, 0x42, 0x39, 0x3a, 0x37, 0x34, 0x38, 0x39, 0x14, 0xfe, 0xb1, 0xb0, 0xad, 0xb1, 0xae, 0xb0, 0xad, 0xb0, 0xb1, 0xf8, 0xfa, 0xf7, 0xf8, 0xf5, 0xeb, 0xeb, 0xec, 0xe9, 0xed, 0xec, 0xee, 0xee, 0xf7, 0xd2, 0xb2, 0xbb, 0xb5, 0xb5, 0xba, 0xbe, 0xbe, 0xbc, 0xbe, 0xbc, 0xb6, 0xb2, 0xb2, 0xae, 0xd8, 0xf6, 0xe8, 0xf9, 0xeb, 0xf2, 0xf2, 0xee, 0xee, 0xeb, 0xe8, 0xe9, 0xf7, 0xd3, 0xb3, 0xb7, 0xb7, 0xb2, 0xb7, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xe4, 0xb7, 0xb3, 0xb5, 0xb3, 0xb6, 0xb5, 0xb6, 0xb6, 0xb6, 0xb5, 0xb6, 0xb6, 0xb5, 0xb6, 0xb6, 0xb6, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb8, 0xb7, 0xb7, 0xb6, 0xb8, 0xb5, 0xb5, 0xb8, 0xca, 0xae, 0x00, 0x9b, 0x9b, 0xb9, 0xf1, 0xa6, 0x00, 0xb9, 0xdc, 0xb4, 0xb1, 0xa0, 0xb4, 0xec, 0xa8, 0xd8, 0xe4, 0xaa, 0xb4, 0xf5, 0xaf, 0x9d, 0xf3, 0xc0, 0x59, 0xd6, 0x4c, 0xa0, 0x00, 0x00, 0x9f, 0xbb, 0xb9, 0xb5, 0xb5, 0xb7, 0xb7, 0xb6, 0xb7, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb5, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb7, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xae, 0xa8, 0xa9, 0xab, 0xa8, 0xaf, 0xe9, 0xf9, 0xf5, 0xf3, 0xf5, 0xec, 0x4c, 0xec, 0xed, 0xec, 0xee, 0xec, 0xee, 0xe8, 0xbf, 0xb7, 0xbc, 0xb5, 0xb8, 0xb8, 0xba, 0xba, 0xb8, 0xb3, 0xb6, 0xbf, 0xb8, 0xb1, 0xb5, 0xb1, 0xb1, 0xe8, 0xf7, 0xec, 0xf3, 0xed, 0xeb, 0xef, 0xed, 0xef, 0xef, 0xe9, 0xeb, 0xe9, 0x4f, 0x48, 0x39, 0x34, 0x31, 0x3a, 0x40, 0x20, 0x0e, 0xaf, 0xb0, 0xb0, 0xb0, 0xb1, 0xb0, 0xb0, 0xb0, 0xab, 0xbe, 0xfa, 0xf9, 0xf7, 0xf7, 0xef, 0xeb, 0xec, 0xe9, 0xec, 0xeb, 0xec, 0xec, 0xf6, 0xe8, 0xba, 0xb1, 0xbc, 0xb5, 0xbc, 0xbe, 0xbe, 0xbc, 0xbc, 0xbe, 0xbf, 0xb8, 0xb1, 0xb2, 0xae, 0xbf, 0xf6, 0xf0, 0xf8, 0xeb, 0xf4, 0xf2, 0xf2, 0xee, 0xec, 0xe9, 0xeb, 0xf2, 0xd2, 0xb4, 0xb8, 0xb7, 0xb2, 0xba, 0xf3, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xf4, 0xb9, 0xb3, 0xb3, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb6, 0xb6, 0xb6, 0xb5, 0xb6, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb7, 0xb6, 0xb7, 0xb8, 0xb6, 0xb8, 0xb5, 0xb5, 0xc7, 0xbd, 0x9d, 0x9a, 0x00, 0xaa, 0xe9, 0xfc, 0x00, 0x9d, 0xc0, 0xe9, 0xc0, 0x9f, 0xbb, 0xb4, 0x00, 0xb1, 0xbd, 0xa8, 0xb4, 0xc0, 0xa1, 0x9b, 0xbb, 0xf8, 0xa0, 0xa0, 0xdc, 0xa8, 0x00, 0x00, 0x9f, 0xbe, 0xb9, 0xb7, 0xb7, 0xb6, 0xb6, 0xb7, 0xb5, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb7, 0xb5, 0xb3, 0xae, 0xa9, 0xa9, 0xab, 0xa8, 0xb9, 0xf6, 0xf7, 0x9c, 0xf6, 0xf3, 0xec, 0xeb, 0xeb, 0xee, 0xec, 0xec, 0xec, 0xf0, 0xd6, 0xba, 0xb7, 0xb8, 0xba, 0xb8, 0xbe, 0xbc, 0xba, 0xbc, 0xba, 0xb5, 0xb8, 0xba, 0xb5, 0xb1, 0xb1, 0xae, 0xca, 0xfa, 0xed, 0xf2, 0xf2, 0xed, 0xef, 0xed, 0x4f, 0xee, 0xe9, 0xea, 0xec, 0x4c, 0x49, 0x39, 0x3a, 0x3a, 0x3a, 0x39, 0x20, 0xaf, 0xaf, 0xb0, 0xb0, 0xb2, 0xb1, 0xb0, 0xb0, 0xb0, 0xab, 0xcd, 0xfb, 0xf8, 0xf9, 0xf4, 0xeb, 0xe9, 0xed, 0xeb, 0xec, 0xeb, 0xeb, 0xf3, 0xee, 0xd6, 0xb7, 0xb8, 0xb8, 0xba, 0xba, 0xb5, 0xa7, 0xab, 0xb0, 0xbc, 0xbf, 0xbc, 0xb3, 0xb2, 0xae, 0xb3, 0xec, 0xf3, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xec, 0xe8, 0xeb, 0xea, 0xcd, 0xb2, 0xb6, 0xb5, 0xb2, 0xbd, 0x9c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xff, 0xd3, 0xaf, 0xb3, 0xb7, 0xb5, 0xb5, 0xb6, 0xb6, 0xb6, 0xb5, 0xb6, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb7, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb8, 0xb5, 0xb7, 0xb7, 0xb6, 0xb5, 0xb7, 0xb6, 0xb5, 0xb5, 0xbe, 0xcd, 0xb9, 0xa4, 0x9e, 0xa6, 0xca, 0xb4, 0xa4, 0x9f, 0xa2, 0xaf, 0xa4, 0xa8, 0xac, 0x9d, 0x9d, 0x9e, 0x9f, 0x9f, 0xa0, 0x9f, 0x9d, 0xa0, 0x9f, 0xaf, 0xaa, 0xb1, 0xd3, 0x9f, 0x00, 0x00, 0x9d, 0xbf, 0xb8, 0xb8, 0xb7, 0xb6, 0xb5, 0xb6, 0xb5, 0xb5, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb3, 0xb3, 0xac, 0xa5, 0xac, 0xa9, 0xaa, 0xc2, 0xf9, 0xf6, 0x9c, 0xf5, 0xee, 0xec, 0xeb, 0xec, 0xec, 0xed, 0xec, 0xee, 0xe8, 0xc2, 0xb8, 0xb8, 0xb7, 0xba, 0xbc, 0xb2, 0xad, 0xa7, 0xab, 0xb1, 0xbc, 0xba, 0xb5, 0xb7, 0xb2, 0xb1, 0xae, 0xb8, 0xf7, 0xf7, 0xee, 0xef, 0xf2, 0xef, 0xed, 0xed, 0xee, 0xeb, 0xe8, 0xeb, 0x4f, 0x48, 0x39, 0x34, 0x3a, 0x3c, 0x39, 0x14, 0xaf, 0xb0, 0xb0, 0xb0, 0xb2, 0xb1, 0xb0, 0xb0, 0xb0, 0xa9, 0xe9, 0xfa, 0xf7, 0xf8, 0xf4, 0xeb, 0xeb, 0xec, 0xec, 0xeb, 0xec, 0xeb, 0xf0, 0xec, 0xc2, 0xb7, 0xba, 0xb5, 0xbc, 0xb2, 0xa3, 0xa1, 0xa3, 0xa1, 0xae, 0xbc, 0xbf, 0xb5, 0xb2, 0xb1, 0xab, 0xe7, 0xf7, 0xeb, 0xf6, 0xef, 0xee, 0xf2, 0xf2, 0xf2, 0xeb, 0xe8, 0xf0, 0xc7, 0xb5, 0xba, 0xb6, 0xb5, 0xc7, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xf8, 0x01, 0xf7, 0xc2, 0xb4, 0xb1, 0xb5, 0xb5, 0xb5, 0xb7, 0xb6, 0xb7, 0xb5, 0xb5, 0xb7, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb6, 0xb7, 0xb7, 0xb6, 0xb7, 0xb8, 0xb7, 0xb5, 0xb5, 0xb6, 0xb8, 0xb3, 0xb7, 0xbf, 0xd3, 0xca, 0xc7, 0xc2, 0xd3, 0xd6, 0xd6, 0xd3, 0xc2, 0xc0, 0xc2, 0xd6, 0xc7, 0xbd, 0xc7, 0xbf, 0xbd, 0xc0, 0xbc, 0xbb, 0xbd, 0xc2, 0xb4, 0xb5, 0xb4, 0xd6, 0xb9, 0xa0, 0x9f, 0x9e, 0xa3, 0xc2, 0xba, 0xb7, 0xb7, 0xb7, 0xb6, 0xb5, 0xb7, 0xb5, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb2, 0xb7, 0xae, 0xa8, 0xad, 0xa8, 0xae, 0xdc, 0xf9, 0xf3, 0xf7, 0xf6, 0xec, 0xec, 0xec, 0xec, 0xec, 0xed, 0xee, 0xf0, 0xe4, 0xbe, 0xb7, 0xb8, 0xba, 0xb8, 0xae, 0xa7, 0xa3, 0xa1, 0xa1, 0xa1, 0xad, 0xb8, 0xb8, 0xb7, 0xb3, 0xb2, 0xae, 0xb1, 0xeb, 0xf7, 0xee, 0xed, 0xef, 0xef, 0xee, 0xed, 0xf1, 0xeb, 0xea, 0xe9, 0x4f, 0x48, 0x39, 0x3c, 0x37, 0x3c, 0x39, 0xb4, 0xb1, 0xb1, 0xb0, 0xb0, 0xb1, 0xb1, 0xb0, 0xb2, 0xb0, 0xb2, 0xf4, 0xfa, 0xf7, 0x9c, 0xf2, 0xeb, 0xec, 0xeb, 0xec, 0xeb, 0xec, 0xeb, 0xf3, 0xe8, 0xbc, 0xb8, 0xb8, 0xb8, 0xb6, 0xa5, 0xa0, 0xa3, 0xa3, 0xa1, 0xa1, 0xb0, 0xbc, 0xba, 0xb2, 0xb0, 0xa9, 0xd6, 0xf9, 0xeb, 0xf4, 0xf2, 0xed, 0xf2, 0xf4, 0xf2, 0xeb, 0xea, 0xea, 0xd2, 0xb3, 0xba, 0xb8, 0xb5, 0xd6, 0x01, 0xfb, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xf5, 0xdc, 0xc0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb3, 0xb5, 0xb3, 0xb5, 0xb7, 0xb5, 0xb7, 0xb7, 0xb8, 0xb5, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb6, 0xb5, 0xb5, 0xb5, 0xb6, 0xb5, 0xb5, 0xb7, 0xba, 0xbd, 0xc2, 0xc0, 0xbe, 0xc0, 0xc2, 0xbf, 0xc2, 0xc2, 0xc7, 0xcd, 0xc7, 0xcd, 0xd6, 0xd2, 0xd6, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd3, 0xd6, 0xd2, 0xd3, 0xc7, 0xc2, 0xc2, 0xbf, 0xbf, 0xc7, 0xb8, 0xb3, 0xb5, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb7, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb7, 0xb7, 0xb5, 0xab, 0xa9, 0xac, 0xa8, 0xb4, 0xed, 0xf9, 0xf5, 0xf6, 0xf5, 0xec, 0xec, 0xec, 0xec, 0xee, 0xec, 0xef, 0xf0, 0xd6, 0xba, 0xb7, 0xb5, 0xba, 0xb3, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa0, 0xae, 0xbc, 0xb7, 0xb2, 0xb3, 0xae, 0xae, 0xd8, 0xf8, 0xed, 0xf2, 0xf1, 0xee, 0xf1, 0xec, 0xee, 0xec, 0xeb, 0xeb, 0x4c, 0x48, 0x39, 0x38, 0x38, 0x40, 0x20, 0x0e, 0xb0, 0xb2, 0xb0, 0xb0, 0xb1, 0xb3, 0xb0, 0xb2, 0xad, 0xb8, 0xff, 0xf8, 0xf8, 0xf6, 0xee, 0xeb, 0xec, 0xec, 0xec, 0xeb, 0xec, 0xf0, 0xee, 0xd8, 0xba, 0xb5, 0xb8, 0xb8, 0xad, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa0, 0xa3, 0xb5, 0xbc, 0xb1, 0xb0, 0xa7, 0xc2, 0xf9, 0xec, 0xf2, 0xf2, 0xef, 0xef, 0xf2, 0xf2, 0xec, 0xeb, 0xeb, 0xd2, 0xb5, 0xba, 0xb7, 0xb8, 0xec, 0x01, 0xfb, 0xfb, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xfb, 0x01, 0x01, 0x01, 0x9c, 0xec, 0xe4, 0xca, 0xbb, 0xb5, 0xb4, 0xb1, 0xb1, 0xae, 0xae, 0xb1, 0xb1, 0xae, 0xb3, 0xb3, 0xb3, 0xb7, 0xb9, 0xba, 0xb9, 0xb8, 0xb8, 0xb8, 0xb8, 0xb6, 0xb6, 0xb5, 0xb6, 0xb8, 0xb8, 0xb8, 0xb9, 0xba, 0xb8, 0xb8, 0xba, 0xba, 0xb8, 0xb8, 0xb8, 0xba, 0xb8, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xc2, 0xb8, 0xbe, 0xbc, 0xbc, 0xb8, 0xbc, 0xbc, 0xbc, 0xba, 0xb3, 0xb3, 0xb8, 0xb7, 0xb5, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb3, 0xb1, 0xae, 0xb1, 0xab, 0xa5, 0xc7, 0xfa, 0xf4, 0xf7, 0xf6, 0xf4, 0xec, 0xec, 0xed, 0xec, 0xed, 0xed, 0xee, 0xf0, 0xcd, 0xb8, 0xb8, 0xb7, 0xb6, 0xad, 0xa3, 0xa1, 0xa3, 0xa1, 0xa1, 0xa3, 0xa0, 0xa7, 0xb8, 0xba, 0xb2, 0xb1, 0xb0, 0xac, 0xcd, 0xf9, 0xee, 0xf2, 0xf2, 0xef, 0xee, 0xf1, 0xf1, 0xec, 0xea, 0xe9, 0xef, 0x48, 0x8f, 0x3d, 0x39, 0x3d, 0x1a, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb3, 0xb4, 0xb1, 0xb2, 0xad, 0xc2, 0x01, 0xf5, 0xf8, 0xf3, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xee, 0xf0, 0xd6, 0xb7, 0xb5, 0xb8, 0xb6, 0xa3, 0xa3, 0xa7, 0xa3, 0xa7, 0xa3, 0xa7, 0xa1, 0xae, 0xbc, 0xb2, 0xb0, 0xa7, 0xba, 0xfa, 0xf0, 0xee, 0xf2, 0xef, 0xee, 0xf4, 0xef, 0xf2, 0xe8, 0xf0, 0xd6, 0xbf, 0xbc, 0xb4, 0xc7, 0x99, 0x01, 0xfb, 0x01, 0x58, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x01, 0xf9, 0xf9, 0x01, 0x01, 0xfb, 0xfa, 0xff, 0xfa, 0xff, 0xf0, 0xe8, 0xd8, 0xd3, 0xd2, 0xca, 0xbf, 0xb7, 0xb4, 0xb3, 0xae, 0xae, 0xae, 0xb1, 0xb2, 0xb2, 0xb3, 0xb5, 0xb6, 0xb6, 0xb6, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb8, 0xba, 0xb8, 0xb8, 0xba, 0xb8, 0xb8, 0xb6, 0xb6, 0xba, 0xb6, 0xb2, 0xb8, 0xb8, 0xba, 0xba, 0xb8, 0xb8, 0xba, 0xad, 0xba, 0xb6, 0xb2, 0xba, 0xb8, 0xb6, 0xb5, 0xb6, 0xb5, 0xb8, 0xb8, 0xb5, 0xb5, 0xb7, 0xb5, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb3, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb3, 0xb7, 0xb8, 0xae, 0xab, 0xa8, 0xae, 0xe4, 0xfa, 0xec, 0xf9, 0xf5, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xef, 0xee, 0xeb, 0xc2, 0xb8, 0xba, 0xb8, 0xb3, 0xa9, 0xa5, 0xa7, 0xa5, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xb1, 0xba, 0xb5, 0xae, 0xb1, 0xac, 0xbf, 0xfa, 0xee, 0xf1, 0xef, 0xef, 0xf1, 0xed, 0xf1, 0xee, 0xec, 0xe8, 0xed, 0x46, 0x3b, 0x8e, 0x3b, 0x3b, 0x1a, 0xb1, 0xb2, 0xb2, 0xb0, 0xb1, 0xb1, 0xb1, 0xb2, 0xb0, 0xad, 0xd8, 0xfb, 0xf8, 0xf8, 0xf2, 0xeb, 0xec, 0xee, 0xec, 0xee, 0xeb, 0xeb, 0xf0, 0xec, 0xd3, 0xb8, 0xb8, 0xba, 0xb2, 0xa3, 0xa7, 0xa7, 0xa7, 0xa4, 0xa3, 0xab, 0xa5, 0xae, 0xbf, 0xb5, 0xb0, 0xab, 0xb2, 0xfa, 0xf3, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xf2, 0xf2, 0xe8, 0xf6, 0xd2, 0xbb, 0xb1, 0xb9, 0xec, 0x01, 0xfb, 0xfb, 0xfb, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0xfb, 0xfa, 0xfb, 0xfb, 0xfb, 0xf7, 0xf9, 0xfa, 0xfb, 0x01, 0xfb, 0xf3, 0xe4, 0xd3, 0xc7, 0xbd, 0xba, 0xb7, 0xb5, 0xb5, 0xb3, 0xb2, 0xb2, 0xb3, 0xb5, 0xb7, 0xb8, 0xb8, 0xb7, 0xba, 0xb8, 0xb6, 0xb2, 0xb5, 0xb6, 0xb6, 0xb6, 0xb8, 0xb8, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb8, 0xb6, 0xb8, 0xb8, 0xbc, 0xbc, 0xb3, 0xba, 0xb2, 0xb6, 0xbc, 0xb8, 0xb6, 0xb8, 0xb5, 0xb8, 0xb8, 0xb7, 0xb7, 0xb5, 0xb7, 0xb7, 0xb7, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb1, 0xab, 0xb3, 0xb7, 0xcd, 0xf6, 0xf7, 0xf2, 0xf8, 0xf7, 0xec, 0xed, 0xec, 0xed, 0xec, 0xef, 0xed, 0xf0, 0xe4, 0xbf, 0xb7, 0xba, 0xb8, 0xb2, 0xad, 0xa3, 0xa7, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xb1, 0xba, 0xb7, 0xb0, 0xb2, 0xab, 0xba, 0xfa, 0xed, 0xf2, 0xef, 0xef, 0xf4, 0xef, 0x4f, 0xf0, 0xec, 0xea, 0xeb, 0xd3, 0x14, 0x1a, 0x1a, 0xbb, 0xb7, 0xb1, 0xb0, 0xb0, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb0, 0xad, 0xe8, 0xf8, 0xff, 0xf7, 0xf0, 0xe9, 0xeb, 0xee, 0xec, 0xeb, 0xeb, 0xec, 0xf0, 0xeb, 0xd2, 0xba, 0xba, 0xbc, 0xb2, 0xa7, 0xa7, 0xa9, 0xa7, 0xad, 0xa7, 0xab, 0xa9, 0xb7, 0xbf, 0xb6, 0xad, 0xab, 0xae, 0xf9, 0xf0, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xf2, 0xf4, 0xee, 0xee, 0xd6, 0xc0, 0xc7, 0xe4, 0x01, 0x01, 0xfb, 0x58, 0x58, 0x58, 0xff, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xec, 0xe9, 0xeb, 0xec, 0xee, 0xf7, 0xfa, 0xfb, 0xfb, 0xfb, 0xfa, 0xf7, 0xec, 0xdc, 0xd8, 0xd2, 0xd2, 0xc7, 0xc7, 0xbf, 0xbe, 0xbd, 0xbe, 0xbe, 0xbc, 0xb7, 0xba, 0xbc, 0xba, 0xb8, 0xb7, 0xb6, 0xb6, 0xb2, 0xb5, 0xb6, 0xb2, 0xb5, 0xb6, 0xb3, 0xb5, 0xb5, 0xb2, 0xb6, 0xb0, 0xb6, 0xb6, 0xb8, 0xb8, 0xb2, 0xb5, 0xb3, 0xba, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb3, 0xb5, 0xb5, 0xb5, 0xb7, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xbc, 0xcd, 0xeb, 0xf0, 0xf6, 0xf9, 0xf6, 0xf7, 0xf7, 0xf7, 0xed, 0xec, 0xed, 0xed, 0xee, 0xed, 0xf2, 0xf2, 0xe4, 0xbe, 0xb8, 0xb8, 0xba, 0xb2, 0xb0, 0xa7, 0xa3, 0xa2, 0xa3, 0xa3, 0xa3, 0xa1, 0xa4, 0xb1, 0xba, 0xb8, 0xb2, 0xb0, 0xab, 0xb8, 0xfa, 0xed, 0xef, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xee, 0xea, 0xeb, 0xd3, 0xbb, 0xbb, 0xbb, 0xba, 0xb5, 0xb3, 0xb8, 0xba, 0xbc, 0xbe, 0xc0, 0xbd, 0xbd, 0xb6, 0xb6, 0xf1, 0xf8, 0xf9, 0xf8, 0xec, 0xeb, 0xec, 0xee, 0xee, 0xeb, 0xec, 0xec, 0xf0, 0xeb, 0xca, 0xba, 0xbc, 0xbc, 0xb8, 0xb0, 0xab, 0xae, 0xad, 0xae, 0xb0, 0xae, 0xae, 0xba, 0xbe, 0xb7, 0xad, 0xac, 0xad, 0xf9, 0xee, 0xf2, 0xee, 0xf2, 0xf2, 0xf2, 0xee, 0xf4, 0xf2, 0xee, 0xf9, 0xf8, 0x01, 0x01, 0x01, 0xfb, 0xff, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xf8, 0x4c, 0xed, 0xef, 0xec, 0xed, 0xf2, 0xf6, 0xf7, 0xf7, 0xf8, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xf9, 0xf9, 0xf8, 0xf9, 0xf8, 0xf7, 0xf5, 0xf5, 0xf5, 0xf4, 0xf2, 0xf4, 0xec, 0xe8, 0xd6, 0xd6, 0xd2, 0xd2, 0xcd, 0xc7, 0xc2, 0xbf, 0xbf, 0xbe, 0xbc, 0xba, 0xba, 0xba, 0xb7, 0xb9, 0xba, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb3, 0xb4, 0xb5, 0xb4, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb1, 0xb1, 0xb1, 0xb1, 0xb3, 0xb1, 0xb1, 0xb3, 0xb1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb3, 0xb7, 0xb3, 0xb5, 0xb9, 0xbf, 0xd6, 0xeb, 0xf9, 0xf0, 0xeb, 0xf0, 0xec, 0xf2, 0xed, 0xf4, 0xf4, 0xee, 0xed, 0xed, 0xee, 0xef, 0xec, 0xed, 0xf2, 0xdc, 0xbe, 0xb6, 0xba, 0xba, 0xb8, 0xb5, 0xa9, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xab, 0xb2, 0xbc, 0xb8, 0xb0, 0xb2, 0xad, 0xbc, 0xf8, 0xf3, 0xef, 0xf1, 0xef, 0xef, 0xef, 0xf2, 0xee, 0xec, 0xec, 0xec, 0xcd, 0xba, 0xbc, 0xba, 0xba, 0xbc, 0xcd, 0xe4, 0xea, 0xe8, 0xeb, 0xec, 0xeb, 0xeb, 0xdc, 0xdc, 0xf3, 0xfb, 0xf4, 0xf9, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xec, 0xf0, 0xec, 0xf0, 0xee, 0xc7, 0xba, 0xba, 0xbe, 0xbc, 0xb3, 0xb0, 0xae, 0xae, 0xae, 0xb0, 0xae, 0xb3, 0xbe, 0xc2, 0xb3, 0xad, 0xab, 0xab, 0xf9, 0xf0, 0xf2, 0xf2, 0xee, 0xf2, 0xf2, 0xee, 0xf2, 0xec, 0xf5, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xf5, 0xec, 0xed, 0xef, 0xeb, 0xec, 0xed, 0xee, 0xf4, 0xf4, 0xf7, 0xf7, 0xf5, 0xf2, 0xf2, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf8, 0xf8, 0xf8, 0xfa, 0xfa, 0xfa, 0xed, 0xeb, 0xeb, 0xec, 0xe8, 0xea, 0xf0, 0xeb, 0xea, 0xe8, 0xe8, 0xe8, 0xe7, 0xe4, 0xd8, 0xdc, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd2, 0xd3, 0xcd, 0xcd, 0xcd, 0xca, 0xcd, 0xca, 0xca, 0xca, 0xcd, 0xca, 0xca, 0xca, 0xcd, 0xca, 0xcd, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc0, 0xc7, 0xc2, 0xc7, 0xc2, 0xc2, 0xc7, 0xc2, 0xc2, 0xbf, 0xbf, 0xbe, 0xc2, 0xbe, 0xbf, 0xc2, 0xca, 0xd6, 0xe4, 0xeb, 0xf0, 0xf0, 0xec, 0xe8, 0xea, 0xeb, 0xec, 0xeb, 0xec, 0xf2, 0xf2, 0xf2, 0xed, 0xed, 0xef, 0xee, 0xed, 0xed, 0xf3, 0xdc, 0xbc, 0xb8, 0xba, 0xba, 0xb8, 0xb6, 0xb1, 0xa9, 0xa3, 0xa3, 0xa7, 0xa5, 0xa3, 0xae, 0xb2, 0xba, 0xb6, 0xb2, 0xb0, 0xad, 0xba, 0xf9, 0xf4, 0xf1, 0xf1, 0xf1, 0xef, 0xef, 0xee, 0xee, 0xec, 0xec, 0xec, 0xd2, 0xba, 0xbc, 0xc2, 0xd2, 0xdd, 0xf0, 0xf0, 0xe8, 0xe4, 0xe7, 0xe4, 0xe8, 0xe8, 0xe8, 0xed, 0xf6, 0xf7, 0xf7, 0xf6, 0xeb, 0xeb, 0xec, 0xee, 0xec, 0xeb, 0xf0, 0xec, 0xf0, 0xec, 0xcd, 0xb8, 0xba, 0xbe, 0xbe, 0xba, 0xb5, 0xb3, 0xb2, 0xb1, 0xb2, 0xb5, 0xba, 0xbe, 0xbf, 0xb3, 0xae, 0xa9, 0xae, 0xf9, 0xf5, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xed, 0xf5, 0xfb, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xf8, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xec, 0xed, 0xf4, 0xf8, 0xf8, 0xf7, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf2, 0xf3, 0xf6, 0xeb, 0xe4, 0xe4, 0xe8, 0xdc, 0xe4, 0xe7, 0xe8, 0xe8, 0xe8, 0xea, 0xe8, 0xea, 0xee, 0xec, 0xee, 0xee, 0xf3, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf7, 0xf9, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf8, 0x9c, 0xf8, 0xf8, 0xf8, 0x9c, 0x9c, 0xf4, 0xee, 0xee, 0xee, 0xec, 0xf0, 0xf2, 0xf0, 0xf0, 0xf6, 0xf3, 0xf3, 0xec, 0xeb, 0xe8, 0xeb, 0xeb, 0xeb, 0xeb, 0xec, 0xec, 0xef, 0xf4, 0xf2, 0xee, 0xed, 0xf2, 0xef, 0xed, 0xee, 0xf4, 0xd8, 0xbc, 0xb8, 0xbc, 0xba, 0xba, 0xba, 0xb7, 0xae, 0xa9, 0xa5, 0xa7, 0xa4, 0xa9, 0xb3, 0xb3, 0xba, 0xb8, 0xb0, 0xb0, 0xae, 0xba, 0xf9, 0xf3, 0xf4, 0xed, 0xf1, 0xf2, 0xed, 0xee, 0xf2, 0xee, 0xec, 0xeb, 0xcd, 0xbc, 0xc7, 0xe7, 0xec, 0xf0, 0xec, 0xec, 0xe8, 0xe4, 0xe8, 0xe4, 0xe8, 0xe4, 0xe9, 0xec, 0xec, 0xee, 0xf7, 0xee, 0xeb, 0xec, 0xee, 0xec, 0xec, 0xec, 0xec, 0xf0, 0xee, 0xf0, 0xcd, 0xb8, 0xbb, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xba, 0xb8, 0xbc, 0xbc, 0xbf, 0xbe, 0xb2, 0xae, 0xa5, 0xb2, 0xf9, 0xf6, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xf2, 0xed, 0xf8, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x99, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xf8, 0xed, 0xf4, 0xed, 0xed, 0xef, 0xf2, 0xf2, 0xed, 0xec, 0xec, 0xef, 0xf5, 0xf7, 0xf5, 0xf5, 0xf7, 0xf5, 0xf2, 0xf2, 0xef, 0xef, 0xf2, 0xf2, 0xf5, 0xf5, 0xf4, 0xf2, 0xf6, 0xf7, 0xf3, 0xe4, 0xdc, 0xe4, 0xe4, 0xd8, 0xe4, 0xdc, 0xe7, 0xdc, 0xe4, 0xe4, 0xe4, 0xe8, 0xe4, 0xe8, 0xe4, 0xeb, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf9, 0xfa, 0xfb, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf9, 0x9c, 0xf6, 0xf3, 0xee, 0xf2, 0xf0, 0xf4, 0xf3, 0xf0, 0xec, 0xec, 0xe9, 0xe8, 0xe9, 0xee, 0xee, 0xec, 0xec, 0xed, 0xec, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xf2, 0xed, 0xed, 0xf6, 0xd8, 0xbc, 0xb8, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xb5, 0xb1, 0xae, 0xac, 0xab, 0xb1, 0xb8, 0xb5, 0xbc, 0xb8, 0xb0, 0xb2, 0xad, 0xbe, 0xf9, 0xf6, 0xf1, 0xef, 0xf4, 0xf2, 0xee, 0xee, 0xf2, 0xed, 0xee, 0xf3, 0xe4, 0xd8, 0xdc, 0xe8, 0xec, 0xeb, 0xf0, 0xf6, 0xf0, 0xeb, 0xe4, 0xe4, 0xe4, 0xe8, 0xe8, 0xe9, 0xec, 0xed, 0xeb, 0xed, 0xeb, 0xed, 0xee, 0xee, 0xec, 0xee, 0xeb, 0xf2, 0xf0, 0xf0, 0xd3, 0xba, 0xbc, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbe, 0xbc, 0xbc, 0xbe, 0xbc, 0xbf, 0xbe, 0xb0, 0xb0, 0xa4, 0xb9, 0xf9, 0xf2, 0xed, 0xf2, 0xf2, 0xee, 0xf2, 0xee, 0xf4, 0xed, 0xff, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xff, 0xf4, 0xf5, 0xf4, 0xed, 0xed, 0xef, 0xf2, 0xf2, 0xf2, 0xec, 0xe9, 0xed, 0xef, 0xf4, 0xf2, 0xf4, 0xef, 0xed, 0xef, 0xf2, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf4, 0xf2, 0xee, 0xf6, 0xf6, 0xeb, 0xe4, 0xe4, 0xe4, 0xe4, 0xdc, 0xe7, 0xdc, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe9, 0xf6, 0xf3, 0xf6, 0xf6, 0xf5, 0xf4, 0xf5, 0xf2, 0xf7, 0xf7, 0xf7, 0xf9, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xf8, 0xf6, 0xf4, 0xed, 0xeb, 0xec, 0xec, 0xeb, 0xec, 0xee, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf4, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xf2, 0xef, 0xee, 0xef, 0xf3, 0xdc, 0xbc, 0xb8, 0xbc, 0xbc, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xb7, 0xb7, 0xb7, 0xb7, 0xba, 0xb9, 0xbc, 0xb5, 0xb0, 0xb0, 0xad, 0xc7, 0xf9, 0xf2, 0xf2, 0xef, 0xf1, 0xf2, 0xed, 0xee, 0xf2, 0xf2, 0xed, 0xf7, 0xf9, 0xf9, 0xf4, 0xec, 0xf2, 0xf3, 0xeb, 0xf6, 0xf7, 0xf7, 0xf3, 0xee, 0xee, 0xf2, 0xf2, 0xf0, 0xf5, 0xf3, 0xeb, 0xee, 0xed, 0xed, 0xf2, 0xec, 0xee, 0xf2, 0xe9, 0xf0, 0xee, 0xf0, 0xd6, 0xba, 0xbb, 0xbe, 0xbe, 0xbc, 0xbc, 0xba, 0xbc, 0xbc, 0xbe, 0xbc, 0xbc, 0xbf, 0xba, 0xae, 0xae, 0xa3, 0xc2, 0xf9, 0xee, 0xee, 0xf2, 0xee, 0xf2, 0xee, 0xee, 0xf2, 0xef, 0xff, 0x01, 0xfb, 0x01, 0x01, 0x01, 0xfb, 0x99, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xff, 0xf8, 0xf8, 0xf5, 0xf2, 0xef, 0xec, 0xec, 0xed, 0xf2, 0xf5, 0xf4, 0xe9, 0xe9, 0xeb, 0xeb, 0xec, 0xeb, 0xed, 0xef, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf8, 0xed, 0xe8, 0xdc, 0xe7, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xeb, 0x9c, 0xf6, 0xf5, 0xf4, 0xf7, 0xf5, 0xf4, 0x9c, 0xf4, 0xf4, 0xf5, 0xff, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xf5, 0xf4, 0xf4, 0xf5, 0xf6, 0xed, 0xed, 0xec, 0xec, 0xeb, 0xed, 0xf2, 0xf4, 0xf7, 0xf7, 0xf5, 0xf6, 0xf4, 0xf7, 0xf6, 0xf4, 0xee, 0xf2, 0xee, 0xec, 0xee, 0xee, 0xf2, 0xed, 0xf2, 0xf4, 0xdd, 0xbe, 0xb6, 0xbc, 0xbc, 0xbc, 0xba, 0xbe, 0xba, 0xbb, 0xba, 0xbc, 0xb9, 0xba, 0xba, 0xba, 0xbc, 0xb3, 0xad, 0xb2, 0xab, 0xcd, 0xfa, 0xee, 0xf2, 0xf1, 0xf4, 0xf2, 0xee, 0xed, 0xee, 0xf2, 0xee, 0xf8, 0xf9, 0xf9, 0xf2, 0xef, 0xef, 0xed, 0xee, 0xec, 0xf6, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf7, 0xf6, 0xf6, 0xf7, 0xf8, 0xef, 0xec, 0xee, 0xee, 0xec, 0xee, 0xf7, 0xe8, 0xf3, 0xf0, 0xee, 0xd8, 0xbb, 0xba, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbe, 0xbc, 0xbe, 0xc2, 0xb5, 0xad, 0xae, 0xa4, 0xd2, 0xf9, 0xed, 0xf4, 0xef, 0xf2, 0xf2, 0xee, 0xf2, 0xee, 0xef, 0xfb, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xff, 0xf5, 0xf5, 0xf9, 0xfa, 0xf8, 0xf4, 0xed, 0xec, 0xec, 0xed, 0xef, 0xf7, 0xf5, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xed, 0xe4, 0xdc, 0xe4, 0xe4, 0xe4, 0xe4, 0xdc, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xdc, 0xdc, 0xed, 0xf7, 0xf4, 0xf5, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf1, 0xf8, 0xfb, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf9, 0xf4, 0xf5, 0xf7, 0xf8, 0xf7, 0xf7, 0xf5, 0xef, 0xed, 0xf4, 0xf4, 0xf2, 0xf5, 0xf7, 0xf7, 0xf4, 0xef, 0xee, 0xee, 0xed, 0xf2, 0xf3, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf3, 0xe8, 0xbc, 0xba, 0xb8, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xba, 0xba, 0xba, 0xba, 0xb2, 0xae, 0xb0, 0xac, 0xdc, 0xf7, 0xee, 0xf4, 0xf2, 0xf2, 0xf2, 0xec, 0xf2, 0xf4, 0xef, 0xef, 0xf8, 0xf9, 0xf8, 0xf5, 0xef, 0xef, 0xeb, 0xed, 0xec, 0xeb, 0xf2, 0xf8, 0xf0, 0xf2, 0xf0, 0xee, 0xee, 0xec, 0xf0, 0xf3, 0xed, 0xed, 0xed, 0xf2, 0xee, 0xee, 0xec, 0xec, 0xee, 0xee, 0xf0, 0xe8, 0xbe, 0xb8, 0xba, 0xc2, 0xba, 0xbc, 0xbe, 0xbc, 0xbe, 0xbc, 0xbc, 0xc2, 0xbe, 0xae, 0xac, 0xad, 0xa6, 0xe4, 0xf0, 0xf4, 0xec, 0xf2, 0xef, 0xf2, 0xf4, 0xf2, 0xef, 0xf5, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf5, 0xf4, 0xf5, 0xf7, 0xf8, 0xf9, 0xf8, 0xf6, 0xf2, 0xed, 0xef, 0xef, 0xf2, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf2, 0xef, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf4, 0xf5, 0xf7, 0xf6, 0xe9, 0xe4, 0xdc, 0xdc, 0xe4, 0xdc, 0xe4, 0xdc, 0xe4, 0xdc, 0xe4, 0xdc, 0xdc, 0xec, 0xf5, 0xf7, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0x9c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xf5, 0xf4, 0xf5, 0xef, 0xf5, 0xf5, 0xf7, 0xf5, 0xf5, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf5, 0xf4, 0xef, 0xee, 0xec, 0xed, 0xf2, 0xf2, 0xf2, 0xec, 0xee, 0xee, 0xee, 0xed, 0xee, 0xf2, 0xea, 0xbf, 0xba, 0xb8, 0xbe, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xba, 0xbc, 0xba, 0xbc, 0xbc, 0xba, 0xae, 0xb0, 0xae, 0xb0, 0xee, 0xf6, 0xec, 0xf4, 0xef, 0xf2, 0xef, 0xed, 0xf2, 0xef, 0xef, 0xf2, 0xf8, 0xfa, 0xf8, 0xf5, 0xf5, 0xf1, 0xed, 0xed, 0xee, 0xec, 0xee, 0xf7, 0xee, 0xed, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xee, 0xed, 0xee, 0xf2, 0xee, 0xec, 0xf2, 0xee, 0xee, 0xf0, 0xeb, 0xc2, 0xbc, 0xbc, 0xbf, 0xbf, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xc2, 0xb8, 0xad, 0xae, 0xa5, 0xb5, 0xf0, 0xee, 0xf7, 0xed, 0xf2, 0xef, 0xef, 0xf4, 0xf2, 0xef, 0xf7, 0xfb, 0x01, 0xfa, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0xf8, 0xf5, 0xf5, 0xf2, 0xf5, 0xf8, 0xf9, 0xf9, 0xf7, 0xf7, 0xf2, 0xef, 0xf4, 0xf8, 0xf7, 0xf7, 0xf8, 0xf5, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf7, 0xf7, 0xf5, 0xeb, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xd8, 0xe9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x9c, 0xf4, 0xef, 0xec, 0xed, 0xee, 0xf5, 0xf6, 0xf7, 0x9c, 0xf8, 0xf6, 0xf5, 0xf3, 0xf4, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xee, 0xf2, 0xee, 0xef, 0xee, 0xef, 0xef, 0xf2, 0xef, 0xf2, 0xeb, 0xcd, 0xb8, 0xbc, 0xb8, 0xc2, 0xba, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xbc, 0xbc, 0xb2, 0xb0, 0xae, 0xae, 0xbb, 0xf9, 0xf3, 0xec, 0xee, 0xf2, 0xf2, 0xf2, 0xef, 0xf4, 0xef, 0xed, 0xf4, 0xf8, 0xfa, 0xff, 0xf7, 0xf5, 0xf5, 0xf5, 0xef, 0xf2, 0xed, 0xee, 0xf4, 0xed, 0xe9, 0xeb, 0xeb, 0xec, 0xec, 0xec, 0xec, 0xf4, 0xef, 0xef, 0xf2, 0xf2, 0xed, 0xed, 0xf3, 0xec, 0xee, 0xee, 0xf4, 0xd6, 0xba, 0xbc, 0xba, 0xc2, 0xc2, 0xbe, 0xbf, 0xbc, 0xbf, 0xc7, 0xbc, 0xb1, 0xae, 0xae, 0xa3, 0xcd, 0xf9, 0xeb, 0xf7, 0xed, 0xf1, 0xf4, 0xf1, 0xf2, 0xef, 0xee, 0xf8, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0xf8, 0xf8, 0xf7, 0xf5, 0xf5, 0xf4, 0xf7, 0xf8, 0xf9, 0xf9, 0xf8, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf7, 0xf5, 0xf2, 0xf2, 0xef, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf7, 0xf8, 0xf5, 0xed, 0xe9, 0xe4, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe9, 0xef, 0xf7, 0xf7, 0x9c, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf1, 0x9c, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x9c, 0xf4, 0xf1, 0xef, 0xec, 0xec, 0xec, 0xee, 0xf2, 0xf4, 0xf6, 0xf6, 0xf4, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf2, 0xf0, 0xd6, 0xba, 0xbc, 0xb6, 0xbe, 0xbe, 0xba, 0xbc, 0xbc, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xb0, 0xb2, 0xae, 0xab, 0xd6, 0xf9, 0xeb, 0xf3, 0xed, 0xf2, 0xf2, 0xf2, 0xef, 0xf4, 0xf2, 0xef, 0xf5, 0xf9, 0xfb, 0xf8, 0x9c, 0xf5, 0x9c, 0xf5, 0xf5, 0xf4, 0xef, 0xef, 0xf2, 0xec, 0xec, 0xec, 0xec, 0xeb, 0xec, 0xec, 0xed, 0xf4, 0xef, 0xf2, 0xf2, 0xf1, 0xee, 0xee, 0xf5, 0xec, 0xec, 0xf2, 0xf6, 0xe4, 0xbe, 0xba, 0xbc, 0xbc, 0xc7, 0xc7, 0xc2, 0xc7, 0xc2, 0xbe, 0xb3, 0xad, 0xae, 0xab, 0xae, 0xe8, 0xf6, 0xeb, 0xf4, 0xf1, 0xf4, 0xf1, 0xf2, 0xef, 0xf2, 0xef, 0x99, 0xfb, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xfb, 0xff, 0xf7, 0xf5, 0xf8, 0xf7, 0xf5, 0xf6, 0xf5, 0xf6, 0x9c, 0xf9, 0xfa, 0xf8, 0xf4, 0xf4, 0xf5, 0xf7, 0xf5, 0xf4, 0xf2, 0xf2, 0xef, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf5, 0xef, 0xf4, 0xf5, 0xf7, 0xf8, 0xf8, 0xf5, 0xec, 0xeb, 0xe9, 0xe4, 0xe9, 0xe9, 0xeb, 0xf8, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xff, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0xf4, 0xf5, 0xf7, 0xf2, 0xec, 0xeb, 0xeb, 0xeb, 0xec, 0xee, 0xed, 0xed, 0xee, 0xec, 0xee, 0xee, 0xec, 0xec, 0xed, 0xf2, 0xed, 0xf2, 0xf2, 0xed, 0xed, 0xee, 0xed, 0xf2, 0xee, 0xf3, 0xdd, 0xbc, 0xba, 0xb8, 0xb8, 0xbf, 0xbf, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xbe, 0xba, 0xb5, 0xae, 0xb3, 0xab, 0xb1, 0xeb, 0xf6, 0xe9, 0xf6, 0xed, 0xee, 0xf4, 0xef, 0xf4, 0xf4, 0xef, 0xf2, 0xf7, 0xfa, 0xfb, 0xf8, 0xf5, 0xf5, 0x9c, 0xf5, 0x9c, 0xf5, 0xf5, 0xf4, 0xf4, 0xee, 0xf4, 0xee, 0xec, 0xeb, 0xec, 0xee, 0xf0, 0xf5, 0xf2, 0xf4, 0xf4, 0xf2, 0xf1, 0xec, 0xf3, 0xeb, 0xee, 0xee, 0xf6, 0xf0, 0xcd, 0xb8, 0xbe, 0xba, 0xba, 0xbf, 0xbf, 0xc2, 0xbc, 0xb3, 0xad, 0xae, 0xae, 0xa5, 0xbf, 0xec, 0xf3, 0xf4, 0xef, 0xef, 0xf1, 0xf5, 0xf1, 0xef, 0xf1, 0xf4, 0xfb, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xff, 0xf4, 0xef, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf5, 0xf8, 0xf9, 0xf7, 0xf5, 0xf2, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf2, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf2, 0xf5, 0xf5, 0xf7, 0xf8, 0xf9, 0x99, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf8, 0xf9, 0xf8, 0xf5, 0xf1, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0x99, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0xf9, 0xf7, 0xf5, 0xf4, 0xf6, 0xf2, 0xec, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xed, 0xf2, 0xf2, 0xf2, 0xed, 0xee, 0xef, 0xee, 0xed, 0xee, 0xef, 0xee, 0xf0, 0xea, 0xc7, 0xb6, 0xba, 0xb8, 0xb5, 0xbf, 0xbe, 0xbe, 0xbc, 0xbc, 0xbc, 0xbe, 0xb2, 0xb2, 0xb0, 0xb1, 0xab, 0xbf, 0xf6, 0xee, 0xee, 0xf2, 0xf0, 0xf2, 0xf2, 0xef, 0xef, 0xf4, 0xef, 0xf4, 0xf8, 0xfb, 0xfb, 0xf9, 0xf5, 0xf3, 0x9c, 0x9c, 0xf8, 0x9c, 0xf8, 0xf7, 0xf5, 0xf7, 0xf4, 0xee, 0xee, 0xec, 0xee, 0xf0, 0xf3, 0xf5, 0xf4, 0xf2, 0xf4, 0xf4, 0xee, 0xec, 0xf4, 0xeb, 0xf2, 0xee, 0xee, 0xf6, 0xe7, 0xbc, 0xba, 0xba, 0xb7, 0xb7, 0xb5, 0xb2, 0xb1, 0xab, 0xae, 0xb0, 0xab, 0xb1, 0xdc, 0xf3, 0xf0, 0xf5, 0xee, 0xef, 0xf1, 0xf4, 0xf1, 0xef, 0xf2, 0xf7, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x99, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x99, 0x01, 0xfb, 0x9c, 0xed, 0xef, 0xed, 0xef, 0xee, 0xf2, 0xf4, 0xf4, 0xf4, 0xf5, 0xf9, 0xfa, 0xf9, 0xf7, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf2, 0xf5, 0xf4, 0xf4, 0xf1, 0xf5, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf9, 0xf5, 0xf2, 0xf5, 0xf5, 0xf4, 0x9c, 0xf4, 0xf6, 0xf5, 0xf4, 0xf5, 0xf4, 0x9c, 0xfb, 0x01, 0x01, 0x99, 0x01, 0x99, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0xfb, 0x9c, 0xf4, 0xee, 0xf8, 0xf3, 0xf6, 0xf4, 0xf3, 0xee, 0xed, 0xee, 0xf2, 0xee, 0xed, 0xec, 0xeb, 0xed, 0xf5, 0xf7, 0xf7, 0xf2, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xed, 0xee, 0xf3, 0xd6, 0xb8, 0xbb, 0xbc, 0xb0, 0xba, 0xba, 0xbe, 0xbf, 0xbe, 0xba, 0xb3, 0xb0, 0xb2, 0xb1, 0xae, 0xae, 0xe4, 0xf6, 0xec, 0xf6, 0xec, 0xf4, 0xf2, 0xed, 0xef, 0xf4, 0xf4, 0xf2, 0xf4, 0xf9, 0xfb, 0xfb, 0x99, 0xf4, 0x9c, 0x9c, 0x9c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf9, 0xf8, 0xf9, 0xf4, 0xf4, 0xf2, 0xf1, 0xf4, 0xf2, 0xec, 0xf1, 0xeb, 0xf2, 0xee, 0xec, 0xf0, 0xf0, 0xd6, 0xb7, 0xb8, 0xbe, 0xb3, 0xb1, 0xae, 0xae, 0xae, 0xb1, 0xab, 0xa9, 0xc7, 0xf3, 0xf0, 0xed, 0xee, 0xf2, 0xef, 0xef, 0xf4, 0xf1, 0xef, 0xf4, 0xf8, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0xf8, 0xf4, 0xf4, 0xf5, 0xf4, 0xf2, 0xed, 0xee, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf2, 0xef, 0xf4, 0xf5, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf4, 0xf2, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf3, 0xf5, 0xf6, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x99, 0x01, 0x99, 0x01, 0x99, 0x01, 0x99, 0x01, 0x99, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0x99, 0x01, 0xf9, 0xf1, 0xf1, 0xf4, 0xf4, 0xf2, 0xf4, 0xf5, 0xf7, 0xf7, 0xf7, 0xf7, 0xf4, 0xf4, 0xef, 0xf2, 0xf2, 0xf7, 0xf8, 0xf5, 0xf4, 0xf2, 0xf4, 0xef, 0xf2, 0xef, 0xef, 0xed, 0xed, 0xee, 0xf3, 0xec, 0xc2, 0xb3, 0xbc, 0xb7, 0xb3, 0xb0, 0xb2, 0xb2, 0xb2, 0xb0, 0xae, 0xb0, 0xb1, 0xb0, 0xab, 0xbe, 0xf6, 0xf3, 0xee, 0xed, 0xf2, 0xee, 0xf2, 0xee, 0xef, 0xf2, 0xf4, 0xee, 0x9c, 0xfb, 0x01, 0xfb, 0x99, 0x9c, 0xf4, 0xf6, 0xf8, 0xf7, 0xf7, 0xf8, 0xf9, 0xf8, 0xf8, 0xf7, 0xf8, 0xf9, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xee, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xf0, 0xec, 0xc7, 0xb3, 0xb7, 0xb3, 0xb2, 0xb0, 0xb0, 0xb1, 0xa9, 0xa9, 0xbc, 0xec, 0xf3, 0xee, 0xee, 0xf2, 0xf3, 0xf4, 0xee, 0xf4, 0xf4, 0xee, 0xf4, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x99, 0x9c, 0xf5, 0xf8, 0xf7, 0xf2, 0xee, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xf2, 0xef, 0xf4, 0xf4, 0xf7, 0xf5, 0xf4, 0xef, 0xed, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf7, 0xf5, 0xf4, 0xf5, 0xf8, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0xf8, 0xf1, 0xf7, 0xf4, 0xef, 0xf2, 0xf4, 0xf5, 0xf8, 0xf8, 0xf5, 0xf4, 0xed, 0xf2, 0xf5, 0xf4, 0xf5, 0xf8, 0xf7, 0xf2, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xf2, 0xec, 0xf9, 0xe4, 0xb8, 0xb7, 0xb8, 0xb5, 0xb3, 0xb3, 0xb2, 0xb0, 0xb2, 0xb2, 0xb1, 0xb5, 0xa9, 0xb3, 0xe8, 0xf6, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf1, 0xef, 0xf2, 0xf4, 0xef, 0xf2, 0xf8, 0xfb, 0x01, 0x01, 0xfb, 0xf8, 0xf4, 0xf4, 0xf5, 0xed, 0xf4, 0xf5, 0xf7, 0xf8, 0xf9, 0xf7, 0xf5, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf6, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xec, 0xf6, 0xf0, 0xc7, 0xb1, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xbe, 0xe8, 0xf3, 0xee, 0xf2, 0xee, 0xf3, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xee, 0xf5, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0xfb, 0xff, 0xed, 0xf5, 0xf7, 0xf9, 0xf7, 0xf6, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xef, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf7, 0xf4, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0x99, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0xff, 0xf5, 0xf5, 0xf7, 0xf8, 0xf8, 0xf7, 0xf5, 0xf5, 0xf7, 0xf8, 0xf7, 0xf4, 0xef, 0xef, 0xf5, 0xf8, 0xf8, 0xf5, 0xf4, 0xf2, 0xf2, 0xf2, 0xef, 0xf2, 0xef, 0xed, 0xee, 0xec, 0xeb, 0xf0, 0xf6, 0xd8, 0xb3, 0xb5, 0xba, 0xb3, 0xb2, 0xb5, 0xb2, 0xb2, 0xb0, 0xb3, 0xae, 0xae, 0xd8, 0xf7, 0xf0, 0xec, 0xee, 0xed, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xed, 0xf4, 0xf9, 0x01, 0xfb, 0x01, 0xfb, 0x99, 0x9c, 0xf1, 0xf4, 0xf2, 0xf2, 0xef, 0xf4, 0xf5, 0xf7, 0xf4, 0xf7, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf5, 0xf3, 0xf4, 0xf2, 0xee, 0xf2, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf2, 0xee, 0xf0, 0xeb, 0xf6, 0xf0, 0xd8, 0xbf, 0xb9, 0xb7, 0xb9, 0xba, 0xd6, 0xf0, 0xf9, 0xee, 0xee, 0xee, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf1, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0xfb, 0xf5, 0xf2, 0xf5, 0xf9, 0xfa, 0xf8, 0xf6, 0xf5, 0xf5, 0xf4, 0xf2, 0xf2, 0xef, 0xef, 0xed, 0xed, 0xed, 0xf4, 0xf4, 0xf5, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf5, 0xf5, 0xf5, 0xf8, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xf5, 0xed, 0xf4, 0xf5, 0xf8, 0xf8, 0xf8, 0xf5, 0xf4, 0xf5, 0xf8, 0xf8, 0xf7, 0xf7, 0xf8, 0xf8, 0xf6, 0xf2, 0xef, 0xf5, 0xf4, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf3, 0xec, 0xf6, 0xf3, 0xcd, 0xb7, 0xb3, 0xb2, 0xb5, 0xb3, 0xb5, 0xb5, 0xb2, 0xae, 0xae, 0xd6, 0xf7, 0xf0, 0xeb, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xed, 0x9c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x9c, 0xf5, 0xf4, 0xf5, 0xf4, 0xf2, 0xef, 0xf2, 0xf2, 0xf4, 0xf5, 0xf7, 0xf7, 0xf5, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xec, 0xec, 0xf0, 0xf3, 0xf0, 0xeb, 0xe8, 0xe8, 0xf3, 0xf6, 0xf6, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xf4, 0xee, 0xf4, 0xf4, 0xf4, 0xf2, 0xf5, 0x99, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xf5, 0xed, 0xf4, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf8, 0xf5, 0xf4, 0xf2, 0xf2, 0xef, 0xed, 0xf2, 0xf5, 0xf8, 0xf5, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf8, 0xf9, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x9c, 0xf4, 0xef, 0xed, 0xed, 0xed, 0xf4, 0xf5, 0xf8, 0xf7, 0xf5, 0xf2, 0xf5, 0xf7, 0xf7, 0xf2, 0xef, 0xec, 0xef, 0xf2, 0xf5, 0xef, 0xf2, 0xf2, 0xef, 0xef, 0xee, 0xee, 0xec, 0xf3, 0xec, 0xf0, 0xf9, 0xd6, 0xb5, 0xb1, 0xb0, 0xb1, 0xb0, 0xae, 0xac, 0xb8, 0xdc, 0xf3, 0xeb, 0xf6, 0xee, 0xec, 0xee, 0xed, 0xf2, 0xf2, 0xf2, 0xef, 0xf4, 0xef, 0xef, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xff, 0x9c, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf2, 0xf4, 0xef, 0xf2, 0xf4, 0xef, 0xed, 0xec, 0xec, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xed, 0xf0, 0xee, 0xed, 0xf6, 0xf2, 0xf2, 0xf6, 0xf6, 0xee, 0xf3, 0xf2, 0xec, 0xee, 0xee, 0xee, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0x9c, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0xf9, 0xf5, 0xf2, 0xf5, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf5, 0xf4, 0xf2, 0xf5, 0xf7, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf5, 0xf7, 0xf5, 0xf5, 0xf5, 0xf1, 0xf7, 0xf9, 0x01, 0x99, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf1, 0xf4, 0xef, 0xed, 0xed, 0xef, 0xed, 0xf2, 0xf4, 0xf5, 0xef, 0xec, 0xed, 0xec, 0xed, 0xed, 0xef, 0xf2, 0xf2, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xf2, 0xf2, 0xec, 0xee, 0xf0, 0xeb, 0xf7, 0xf0, 0xe8, 0xd2, 0xbd, 0xba, 0xbc, 0xbf, 0xd6, 0xeb, 0xf6, 0xf0, 0xeb, 0xec, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xef, 0xf4, 0xf1, 0xf9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xf2, 0xef, 0xf2, 0xef, 0xec, 0xeb, 0x4c, 0xec, 0xe9, 0xee, 0xf2, 0xee, 0xf3, 0xf6, 0xf2, 0xee, 0xf2, 0xee, 0xf2, 0xf2, 0xee, 0xee, 0xf2, 0xf2, 0xee, 0xee, 0xf2, 0xf3, 0xed, 0xeb, 0xee, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf1, 0xf4, 0xf9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0x58, 0x99, 0x01, 0x99, 0x01, 0xfb, 0xff, 0x01, 0xf9, 0xf5, 0xef, 0xef, 0xf4, 0xf5, 0xf7, 0xf5, 0xf8, 0xfa, 0xf8, 0xf7, 0xf5, 0xf8, 0xf7, 0xf8, 0xf7, 0xf5, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf5, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xed, 0xf5, 0xf7, 0xf4, 0xf4, 0xf7, 0xf5, 0xf8, 0x9c, 0xf5, 0xf8, 0xfb, 0x01, 0xfa, 0x99, 0xfb, 0x99, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xf9, 0xf4, 0xf9, 0xf8, 0xf7, 0xf2, 0xf7, 0xf4, 0xf2, 0xee, 0xed, 0xec, 0xec, 0xed, 0xed, 0xec, 0xef, 0xf4, 0xf5, 0xf7, 0xf4, 0xf4, 0xf2, 0xef, 0xed, 0xf2, 0xf2, 0xee, 0xee, 0xf2, 0xec, 0xec, 0xf0, 0xf6, 0xf3, 0xf0, 0xee, 0xee, 0xf3, 0xf6, 0xf6, 0xee, 0xec, 0xf3, 0xec, 0xee, 0xee, 0xee, 0xed, 0xed, 0xee, 0xef, 0xeb, 0xff, 0xec, 0x4c, 0x01, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x99, 0xf8, 0xf8, 0xf8, 0xf8, 0xf5, 0xed, 0xf7, 0xf5, 0xf2, 0xed, 0xed, 0xed, 0xed, 0xec, 0xf2, 0xf2, 0xf3, 0xf6, 0xf2, 0xf3, 0xee, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xee, 0xef, 0xed, 0xed, 0xef, 0xf2, 0xef, 0xed, 0xf4, 0xef, 0xed, 0xf2, 0xf6, 0xee, 0xec, 0xec, 0xf2, 0xf4, 0xed, 0xf2, 0xf2, 0xf1, 0x99, 0x9c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x99, 0xfb, 0x99, 0xf9, 0xf5, 0xed, 0xf2, 0xf4, 0xef, 0xf4, 0xf5, 0xf7, 0xf5, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xec, 0xf8, 0x01, 0x01, 0x99, 0xfb, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x99, 0xfa, 0xfb, 0xf6, 0xf5, 0xf2, 0xf6, 0xf7, 0xf2, 0xf6, 0xf7, 0xf9, 0xf8, 0xf4, 0xf2, 0xef, 0xf2, 0xf4, 0xf7, 0xf5, 0xf4, 0xf4, 0xf4, 0xf2, 0xef, 0xed, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xec, 0xee, 0xf3, 0xf4, 0xf3, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xf2, 0xee, 0xf2, 0xf2, 0xf4, 0xed, 0xec, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xf9, 0xf9, 0xf8, 0xfa, 0xfa, 0xfb, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf5, 0xf5, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xee, 0xf2, 0xee, 0xee, 0xed, 0xec, 0xee, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xf2, 0xf1, 0xef, 0xef, 0xf2, 0xef, 0xee, 0xec, 0xf7, 0xf7, 0xec, 0xec, 0xf5, 0xf4, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xe4, 0x4c, 0xe4, 0x4c, 0xe9, 0x4c, 0xe9, 0x4c, 0xe9, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0xec, 0x4c, 0xec, 0x4c, 0xec, 0x4c, 0xec, 0x4f, 0xf1, 0xf1, 0xf5, 0x9c, 0xf8, 0xf5, 0xff, 0x01, 0xfa, 0x99, 0xf8, 0xf7, 0xf5, 0xf5, 0xf5, 0xf4, 0xf2, 0xf9, 0xf9, 0xfa, 0xf9, 0xf8, 0xf4, 0xf2, 0xf4, 0xf7, 0xf7, 0xf7, 0xf4, 0xf5, 0xf2, 0xf5, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf7, 0xf2, 0xef, 0xf8, 0xf8, 0xf5, 0xf4, 0x99, 0xf9, 0xf2, 0xf2, 0xfa, 0xfb, 0xf9, 0xf9, 0xfa, 0xfb, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xfb, 0xf2, 0xf9, 0xf7, 0xf7, 0xf7, 0xf5, 0xf7, 0xf8, 0xf9, 0xf8, 0xf7, 0xf5, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xf4, 0xf2, 0xf2, 0xf2, 0xef, 0xf2, 0xef, 0xee, 0xf2, 0xef, 0xf2, 0xed, 0xee, 0xed, 0xeb, 0xed, 0xed, 0xee, 0xed, 0xec, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xed, 0xee, 0xf4, 0xee, 0xed, 0xee, 0xf5, 0xef, 0xf4, 0xfb, 0xf7, 0xf8, 0xfb, 0xf8, 0x99, 0xf9, 0x99, 0xfb, 0x01, 0xfb, 0xf7, 0xf4, 0xf9, 0xf5, 0xfa, 0xfb, 0xfa, 0xf9, 0xf9, 0xf9, 0xf8, 0xf7, 0xf5, 0x9c, 0xf7, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xee, 0xf2, 0xef, 0xf2, 0xef, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf2, 0xf2, 0xed, 0xf5, 0xf2, 0xf4, 0xf5, 0xf1, 0xed, 0x4c, 0xe4, 0xf1, 0x4c, 0x4c, 0xe9, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xfd, 0x9b, 0xfd, 0xa0, 0xa0, 0xaa, 0xe4, 0x01, 0xf8, 0xfa, 0xf5, 0xed, 0xf4, 0xed, 0xef, 0xf4, 0xf5, 0xf5, 0xf4, 0xf2, 0xef, 0xef, 0xef, 0xf4, 0xf5, 0xf7, 0xf7, 0xf5, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf7, 0xf5, 0xf2, 0xf4, 0xf9, 0xee, 0xb3, 0xa1, 0xa2, 0xa6, 0xa2, 0xa6, 0xaa, 0xaa, 0xac, 0xae, 0xaf, 0xb1, 0xb1, 0xb4, 0xb4, 0xb7, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb9, 0xb7, 0xf5, 0xf7, 0xf4, 0xf7, 0xf5, 0xf9, 0xf7, 0xf7, 0xf3, 0xf7, 0xf9, 0xfa, 0xf9, 0xf8, 0xf4, 0xf2, 0xf5, 0xf9, 0xf8, 0xf2, 0xf4, 0xf2, 0xef, 0xf2, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xed, 0xef, 0xed, 0xee, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xf2, 0xf2, 0xee, 0xec, 0xed, 0xf7, 0xeb, 0xb4, 0xa1, 0xa8, 0xfc, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0xa4, 0xa8, 0xb9, 0xfa, 0xf5, 0xeb, 0xed, 0xed, 0xf8, 0xf8, 0xf5, 0xf8, 0xf8, 0xf9, 0xf8, 0xf7, 0xf9, 0xf7, 0xf7, 0xf4, 0xf6, 0xf5, 0xf3, 0xf4, 0xf2, 0xf2, 0xee, 0xf2, 0xf2, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf2, 0xf7, 0xeb, 0xeb, 0xf8, 0xed, 0xf1, 0xed, 0xaf, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xe4, 0x01, 0xfa, 0xf7, 0xf4, 0xef, 0xef, 0xed, 0x4c, 0xeb, 0x4c, 0xec, 0xec, 0xee, 0xef, 0xf2, 0xef, 0xf4, 0xf5, 0xf7, 0xf5, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf8, 0xf5, 0xf2, 0xf5, 0xfa, 0xee, 0xbd, 0xa0, 0xa0, 0xa3, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0xa0, 0x9f, 0xa0, 0x9f, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0xa0, 0x9f, 0xa0, 0x9f, 0x9f, 0xb4, 0xf7, 0xf6, 0xee, 0xee, 0xee, 0xf6, 0xf4, 0xf6, 0xf7, 0xf7, 0xf8, 0xf9, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xef, 0xf2, 0xf2, 0xf4, 0xef, 0xf2, 0xed, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xee, 0xed, 0xf2, 0xf3, 0xfa, 0xc2, 0x9f, 0x9e, 0xa0, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9f, 0x9d, 0x9d, 0xa0, 0xd6, 0xf9, 0xef, 0xf2, 0xef, 0xe9, 0xec, 0xec, 0xed, 0xf4, 0xf8, 0xf8, 0xf7, 0xf6, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf7, 0xf4, 0xf3, 0xf2, 0xf2, 0xee, 0xf2, 0xf2, 0xee, 0xf2, 0xee, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf5, 0xf2, 0xed, 0xf5, 0xef, 0xbd, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xfd, 0x00, 0x00, 0x00, 0xa1, 0xd3, 0xf5, 0xfa, 0xfa, 0xf7, 0xf5, 0xf8, 0xf2, 0xf4, 0xef, 0xf2, 0xed, 0xef, 0xf2, 0xf2, 0xf5, 0xf5, 0xf7, 0xf7, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf2, 0xf7, 0xf4, 0xf5, 0xfb, 0xed, 0xbd, 0xa1, 0xa1, 0xa3, 0xa5, 0xa3, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa4, 0xa4, 0xa4, 0xa2, 0xa3, 0xa2, 0x9f, 0xd3, 0xfa, 0xee, 0xeb, 0xec, 0xec, 0xee, 0xee, 0xf2, 0xee, 0xee, 0xf4, 0xf5, 0xf7, 0xf8, 0xf4, 0xf2, 0xed, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xed, 0xf3, 0xf2, 0xf7, 0xe4, 0xa8, 0xa0, 0xa5, 0xa1, 0xa2, 0xa2, 0xa1, 0xa2, 0xa3, 0xa3, 0xa3, 0xa1, 0xa0, 0xaa, 0xdc, 0xf8, 0xf4, 0xef, 0xf2, 0xf2, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xee, 0xf2, 0xf4, 0xf4, 0xf4, 0xf6, 0xf5, 0xf4, 0xf3, 0xf2, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xf2, 0xee, 0xf2, 0xee, 0xf2, 0xee, 0xf2, 0xf2, 0xec, 0xf7, 0xeb, 0xf8, 0xf5, 0xc0, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x9a, 0x59, 0x59, 0x00, 0x00, 0x9e, 0xb9, 0xe9, 0x01, 0xf7, 0xf5, 0xf9, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf5, 0xf5, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf7, 0xf7, 0xf4, 0xf5, 0xf2, 0xf5, 0xf9, 0xed, 0xbd, 0xa2, 0xa1, 0xa5, 0xa4, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa6, 0xd8, 0xfa, 0xee, 0xee, 0xec, 0xec, 0xeb, 0xeb, 0xee, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xec, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xee, 0xf2, 0xf2, 0xf2, 0xed, 0xef, 0xed, 0xf2, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xed, 0xed, 0xee, 0xed, 0xee, 0xf4, 0xeb, 0xf2, 0xee, 0xf2, 0xee, 0xb9, 0xa0, 0xa3, 0xa3, 0xa1, 0xa2, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0xa0, 0xac, 0xdc, 0xf7, 0xf4, 0xed, 0xf4, 0xf4, 0xef, 0xee, 0xef, 0xef, 0xec, 0xee, 0xef, 0xf2, 0xf4, 0xf7, 0xf7, 0xf7, 0xf6, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xf1, 0xed, 0xed, 0xfb, 0xc0, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe4, 0xfb, 0xf8, 0xf1, 0xf8, 0xf5, 0xf7, 0xf7, 0xf8, 0xf7, 0xf5, 0xf5, 0xf7, 0xf5, 0xf5, 0xf4, 0xf5, 0xf7, 0xf4, 0xf1, 0xf2, 0xf4, 0xf1, 0xf4, 0xf4, 0xf5, 0xf5, 0xf4, 0xf4, 0xef, 0xf5, 0xf2, 0xf8, 0xfb, 0xeb, 0xb9, 0xa2, 0xa2, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa3, 0xa4, 0xa3, 0xa2, 0xa5, 0xa1, 0xb1, 0xe8, 0xf9, 0xf3, 0xed, 0xeb, 0xed, 0xec, 0x4c, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xee, 0xf2, 0xf4, 0xf5, 0xf4, 0xf8, 0xf6, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xed, 0xec, 0xee, 0xf2, 0xec, 0xee, 0xed, 0xee, 0xf4, 0xee, 0xf6, 0xd3, 0xa5, 0xa1, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa2, 0xa1, 0xa1, 0xae, 0xd6, 0xf8, 0xf7, 0xf2, 0xf4, 0xf7, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf4, 0xf1, 0xf2, 0xf1, 0xf5, 0xf4, 0xf4, 0xef, 0xf2, 0xef, 0xef, 0xed, 0xef, 0xef, 0xf2, 0xf4, 0xf2, 0xef, 0xef, 0xed, 0xef, 0xf5, 0x01, 0xc0, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdc, 0xfb, 0xfa, 0xf8, 0xf7, 0xf5, 0xf5, 0xf4, 0xf5, 0xf7, 0xf8, 0x9c, 0xf7, 0xf5, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xef, 0xf5, 0xf7, 0xf8, 0xf6, 0xf9, 0xfb, 0xe4, 0xb1, 0xa0, 0xa1, 0xa6, 0xa4, 0xa4, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa5, 0xa1, 0xa7, 0xa1, 0xb3, 0xee, 0xf9, 0xf3, 0xf2, 0xf2, 0xed, 0xed, 0xec, 0xef, 0xee, 0xed, 0xf2, 0xf4, 0xf7, 0xf8, 0xf5, 0xf3, 0xf4, 0xf6, 0xf4, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xf4, 0xee, 0xed, 0xee, 0xec, 0xf7, 0xeb, 0xfa, 0xdc, 0xaa, 0xa1, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa1, 0xa3, 0xa3, 0xa0, 0xa8, 0xcd, 0xf9, 0xfa, 0xf4, 0xed, 0xf5, 0xff, 0x9c, 0xef, 0xef, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xef, 0xf1, 0xf4, 0xf5, 0xf4, 0xf4, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xf4, 0xf4, 0xf5, 0xf5, 0xf2, 0xed, 0xed, 0xf4, 0xf5, 0xf1, 0x9c, 0x01, 0xbb, 0x59, 0x59, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x9a, 0x9d, 0x9b, 0x9f, 0x9f, 0x9e, 0xac, 0xca, 0xe9, 0xf5, 0xf7, 0xf8, 0xf8, 0xf6, 0xf2, 0xf4, 0xf2, 0xef, 0xf4, 0xf5, 0xf8, 0x9c, 0xf8, 0xf5, 0xf4, 0xf1, 0xf2, 0xf1, 0xf4, 0xf4, 0xf7, 0xf5, 0xee, 0xf2, 0xf6, 0xfb, 0xf9, 0xca, 0xa2, 0x9f, 0xa8, 0xa8, 0xa2, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa5, 0xa3, 0xa9, 0xa1, 0xa3, 0xa2, 0xb5, 0xec, 0xf9, 0xf4, 0xf2, 0xef, 0xef, 0xf5, 0xf9, 0xf7, 0xf6, 0xf4, 0xf3, 0xf6, 0xf7, 0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xf2, 0xee, 0xed, 0xeb, 0xee, 0xee, 0xed, 0xf2, 0xeb, 0xb4, 0xa1, 0xa2, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa4, 0xa3, 0xa3, 0xa5, 0xa1, 0xa1, 0xbb, 0xee, 0xfa, 0xf9, 0xf7, 0xed, 0xef, 0xf1, 0xf7, 0xf4, 0xf1, 0xef, 0xed, 0xef, 0xf2, 0xf4, 0xf5, 0xf5, 0xf5, 0xf1, 0xf2, 0xf4, 0xf4, 0xf4, 0xef, 0xed, 0xec, 0xed, 0xf2, 0xf2, 0xf4, 0xf2, 0xed, 0xf2, 0xfb, 0xf9, 0xc0, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x59, 0x59, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x9d, 0x9f, 0xa1, 0xa1, 0xa2, 0xa6, 0xa8, 0xab, 0xa8, 0xa9, 0xaf, 0xa6, 0xa0, 0xfc, 0xb7, 0xdc, 0xf2, 0xfb, 0x01, 0xfa, 0xf2, 0xee, 0xf4, 0xf4, 0xf6, 0xf4, 0xf2, 0xf2, 0xf2, 0xf5, 0xf6, 0xf7, 0xf6, 0xf7, 0xf7, 0xf4, 0xed, 0xf9, 0x01, 0xf8, 0xd8, 0xab, 0xa0, 0xa1, 0xa8, 0xa6, 0xa3, 0xa3, 0xa5, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa5, 0xa1, 0xa7, 0xa5, 0xa3, 0xa3, 0xa0, 0xb1, 0xe8, 0xfb, 0xf4, 0xe4, 0xf2, 0xf4, 0xf7, 0xf8, 0xf8, 0xf7, 0xf4, 0xef, 0xf1, 0xf5, 0xf5, 0xf4, 0xf2, 0xf1, 0xf4, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xf2, 0xee, 0xee, 0xec, 0xec, 0xec, 0xee, 0xe9, 0xfa, 0xee, 0xb1, 0xa0, 0xa1, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa3, 0xa2, 0xa3, 0xa3, 0xa0, 0xa1, 0xa2, 0xbb, 0xed, 0x01, 0x01, 0x01, 0xfb, 0xf7, 0xf7, 0xf6, 0xee, 0xf4, 0xf7, 0xf7, 0xf4, 0xf4, 0xf4, 0xf2, 0xee, 0xec, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf3, 0xf1, 0xeb, 0xec, 0x9c, 0xfb, 0x99, 0xf1, 0xb7, 0xa0, 0xa0, 0xa0, 0xa8, 0xaf, 0xa0, 0xa0, 0x9f, 0x9d, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x9a, 0x9f, 0xa0, 0xa6, 0xaa, 0xac, 0xab, 0xa8, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0xa4, 0xa2, 0xa6, 0xa8, 0xa1, 0xa0, 0x9f, 0xa2, 0xb4, 0xca, 0xe4, 0xf4, 0xf5, 0xeb, 0xf2, 0xf5, 0xf9, 0xfa, 0xfb, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf7, 0xf7, 0xf9, 0xf8, 0xe4, 0xbb, 0xa2, 0x9f, 0x9f, 0xa3, 0xa9, 0xa4, 0xa3, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa9, 0xa1, 0xa7, 0xa4, 0xa3, 0xa4, 0x9f, 0xa8, 0xdc, 0xfb, 0xfa, 0xee, 0xed, 0xec, 0xef, 0xf2, 0xf7, 0xf5, 0xf4, 0xf2, 0xef, 0xee, 0xef, 0xec, 0xed, 0xef, 0xef, 0xee, 0xef, 0xf2, 0xee, 0xf2, 0xf2, 0xee, 0xed, 0xee, 0xed, 0xee, 0xef, 0xee, 0xee, 0xec, 0xec, 0xf3, 0xf6, 0xf6, 0xfa, 0xdc, 0xae, 0xa1, 0xa1, 0xa2, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa5, 0xa2, 0xa3, 0xa6, 0xa3, 0xa2, 0xa0, 0x9f, 0xa8, 0xc0, 0xdc, 0xe9, 0xf9, 0xff, 0xfb, 0xfa, 0x99, 0xf9, 0xf9, 0xf9, 0x9c, 0xf8, 0xf7, 0xf7, 0xf7, 0xf3, 0xf6, 0x9c, 0x9c, 0x9c, 0xf9, 0xf9, 0xf9, 0xf6, 0xeb, 0xca, 0xac, 0x9d, 0xa0, 0xa5, 0xa0, 0xa9, 0xa9, 0xa0, 0xab, 0xa8, 0xaa, 0xa8, 0xa4, 0xa0, 0x9f, 0x9b, 0x00, 0x00, 0x00, 0x59, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x59, 0x9d, 0xa1, 0xa4, 0xab, 0xac, 0xa8, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa6, 0xa9, 0xa3, 0xa4, 0xab, 0xa9, 0xa8, 0xa3, 0xa1, 0xa0, 0xa1, 0xa2, 0xa8, 0xb4, 0xb4, 0xbb, 0xc2, 0xca, 0xd6, 0xd3, 0xd6, 0xd6, 0xd6, 0xd3, 0xc7, 0xc0, 0xae, 0xa5, 0x9f, 0xa0, 0xa2, 0xa4, 0xab, 0xa7, 0xa2, 0xa3, 0xa5, 0xa7, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa3, 0xa7, 0xa4, 0xa4, 0xa7, 0x9f, 0xa0, 0xca, 0xee, 0xeb, 0xf7, 0xf5, 0xef, 0xef, 0xf1, 0xf2, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xed, 0xf4, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xec, 0xee, 0xf6, 0xf4, 0xeb, 0xd3, 0xa8, 0x9f, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa5, 0xa4, 0xa4, 0xa3, 0xa2, 0xa4, 0xa6, 0xa1, 0xa0, 0xa0, 0xa1, 0xaa, 0xb1, 0xb9, 0xc0, 0xca, 0xd6, 0xd8, 0xdc, 0xdc, 0xe4, 0xe4, 0xe4, 0xdc, 0xe4, 0xdc, 0xd6, 0xd3, 0xc7, 0xbe, 0xbb, 0xb1, 0xa6, 0xa0, 0x9f, 0xa1, 0xa3, 0xa3, 0xa2, 0xa9, 0xa4, 0xa0, 0xa4, 0xa8, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa6, 0xa2, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x9e, 0xfc, 0xa8, 0xa6, 0xa6, 0xa5, 0xa4, 0xa5, 0xa8, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa7, 0xa8, 0xa5, 0xa4, 0xa4, 0xa6, 0xa4, 0xa4, 0xa5, 0xa6, 0xa5, 0xa5, 0xa4, 0xa3, 0xa2, 0xa0, 0xa1, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa0, 0xa0, 0x9f, 0xa1, 0xa1, 0xa3, 0xa5, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa7, 0xa3, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa3, 0xa7, 0xa5, 0xa2, 0xa4, 0xa4, 0xa4, 0xa6, 0xa1, 0x9f, 0xae, 0xd6, 0xe8, 0xee, 0xf7, 0x9c, 0xf7, 0xf2, 0xf2, 0xf2, 0xef, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xf2, 0xee, 0xed, 0xed, 0xee, 0xef, 0xf3, 0xee, 0xf0, 0xf6, 0xee, 0xd6, 0xb9, 0xa2, 0xa0, 0xa3, 0xa4, 0xa4, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa5, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa2, 0xa4, 0xa2, 0xa1, 0xa1, 0xa1, 0xa0, 0xa0, 0xa0, 0xa1, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa1, 0xa1, 0xa0, 0xa0, 0xa0, 0xa1, 0xa1, 0xa3, 0xa3, 0xa4, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa7, 0xa5, 0xa3, 0xa5, 0xa2, 0xa3, 0xa3, 0xa6, 0xa8, 0xaa, 0xa0, 0x59, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x59, 0x9f, 0xa8, 0xa8, 0xa5, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa6, 0xa6, 0xa6, 0xa8, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa4, 0xa4, 0xa4, 0xa2, 0xa4, 0xa2, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa3, 0xa5, 0xa4, 0xa4, 0xa5, 0xa5, 0xa4, 0xa5, 0xa3, 0xa5, 0xa3, 0xa0, 0xa1, 0xae, 0xbd, 0xca, 0xdc, 0xeb, 0xf2, 0xf6, 0xf7, 0xf6, 0xf8, 0xf9, 0xf8, 0xf7, 0xf7, 0xf7, 0xf6, 0xf7, 0xf6, 0xf4, 0xf4, 0xf3, 0xf7, 0xf4, 0xf4, 0xf6, 0xf5, 0xf6, 0xf6, 0xf0, 0xeb, 0xd3, 0xb9, 0xa8, 0xa0, 0xa2, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0xa2, 0xa4, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa3, 0xa3, 0xa4, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa3, 0xa3, 0xa4, 0xa6, 0xa6, 0xa8, 0xa4, 0xfc, 0x9f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x9a, 0x00, 0x00, 0x9b, 0x9f, 0xa2, 0xa4, 0xa8, 0xa8, 0xa8, 0xa6, 0xa6, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa6, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa5, 0xa6, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa4, 0xa6, 0xa5, 0xa4, 0xa6, 0xa4, 0xa6, 0xa6, 0xa6, 0xa4, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa5, 0xa4, 0xa4, 0xa5, 0xa4, 0xa4, 0xa5, 0xa4, 0xa3, 0xa5, 0xa8, 0xa3, 0xa1, 0xa1, 0xa2, 0xa8, 0xae, 0xb7, 0xbd, 0xc7, 0xd3, 0xd6, 0xdc, 0xe4, 0xe8, 0xe9, 0xec, 0xec, 0xee, 0xf2, 0xee, 0xec, 0xeb, 0xeb, 0xeb, 0xe9, 0xe8, 0xe4, 0xdc, 0xcd, 0xbd, 0xb1, 0xa8, 0xa1, 0xa1, 0xa4, 0xa3, 0xa3, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xa5, 0xa6, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa4, 0xa3, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xa4, 0xa6, 0xa6, 0xa4, 0xa1, 0xa0, 0x9b, 0xfd, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x59, 0x59, 0x00, 0x00, 0x9b, 0x9e, 0x9f, 0xa1, 0xa2, 0xa4, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xa4, 0xa4, 0xa5, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa4, 0xa5, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa5, 0xa4, 0xa5, 0xa5, 0xa4, 0xa5, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa4, 0xa5, 0xa5, 0xa4, 0xa5, 0xa5, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa5, 0xa7, 0xa5, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa2, 0xa3, 0xa1, 0xa1, 0xa1, 0xa2, 0xa3, 0xa6, 0xa8, 0xac, 0xac, 0xae, 0xb3, 0xb4, 0xb7, 0xb9, 0xb8, 0xb9, 0xb8, 0xb4, 0xb4, 0xb1, 0xb1, 0xac, 0xaa, 0xa4, 0xa2, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa5, 0xa5, 0xa4, 0xa6, 0xa4, 0xa6, 0xa5, 0xa6, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa4, 0xa4, 0xa1, 0xa0, 0x9f, 0x9d, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x9d, 0x9e, 0xa0, 0xa0, 0xa1, 0xa2, 0xa6, 0xa6, 0xaa, 0xa9, 0xaa, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa6, 0xa4, 0xa6, 0xa4, 0xa6, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa5, 0xa3, 0xa4, 0xa5, 0xa7, 0xa5, 0xa5, 0xa3, 0xa3, 0xa3, 0xa4, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa1, 0xa2, 0xa2, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa2, 0xa2, 0xa1, 0xa4, 0xa5, 0xa4, 0xa5, 0xa5, 0xa6, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa6, 0xa5, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xa6, 0xa4, 0xa6, 0xa6, 0xa8, 0xa8, 0xa8, 0xa8, 0xa6, 0xa6, 0xa4, 0xa2, 0xa1, 0xa0, 0x9f, 0x9e, 0x9d, 0x9b, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x9b, 0x9d, 0x9d, 0x9f, 0x9f, 0xa0, 0xa1, 0xa2, 0xa6, 0xa6, 0xa8, 0xaa, 0xa8, 0xa8, 0xa9, 0xaa, 0xa8, 0xa5, 0xa8, 0xa7, 0xa6, 0xa7, 0xa6, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa3, 0xa3, 0xa4, 0xa7, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa9, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa4, 0xa6, 0xa5, 0xa4, 0xa3, 0xa4, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa4, 0xa5, 0xa5, 0xa8, 0xa7, 0xa8, 0xa9, 0xa8, 0xa8, 0xa6, 0xa6, 0xa6, 0xfc, 0xa4, 0xa2, 0xa0, 0xa0, 0x9f, 0x9e, 0x9d, 0x9b, 0x59, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x9a, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x9a, 0x9b, 0x9d, 0x9d, 0x9f, 0x9f, 0xa0, 0xa0, 0xa1, 0xa1, 0xa1, 0xa2, 0xa4, 0xa6, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa8, 0xa5, 0xa6, 0xa5, 0xa6, 0xa6, 0xa7, 0xa6, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa5, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa3, 0xa3, 0xa5, 0xa5, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa5, 0xa5, 0xa3, 0xa4, 0xa4, 0xa4, 0xa5, 0xa6, 0xa5, 0xa4, 0xa4, 0xa4, 0xa6, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xa4, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa5, 0xa6, 0xa6, 0xa5, 0xa6, 0xa6, 0xa5, 0xa5, 0xa5, 0xa4, 0xa4, 0xa3, 0xa2, 0xa1, 0xa1, 0xa0, 0xa0, 0x9f, 0x9f, 0x9e, 0x9d, 0x9d, 0x9a, 0x9a, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xfd, 0x9a, 0x9b, 0x9b, 0x9d, 0x9d, 0x9e, 0x9f, 0x9f, 0x9f, 0xa0, 0xa0, 0xa0, 0xa1, 0xa1, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xfc, 0xa4, 0xa4, 0xa4, 0xa6, 0xa6, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa6, 0xa8, 0xa8, 0xa8, 0xa6, 0xa8, 0xa8, 0xa6, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa5, 0xa5, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa8, 0xa6, 0xa8, 0xa6, 0xa8, 0xa8, 0xa6, 0xa6, 0xa6, 0xa8, 0xa6, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0xa8, 0xa8, 0xa6, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa4, 0xa4, 0xa6, 0xfc, 0xa4, 0xfc, 0xa2, 0xa2, 0xa2, 0xa1, 0xa1, 0xa0, 0xa0, 0x9f, 0x9f, 0x9f, 0x9e, 0x9d, 0x9d, 0x9b, 0x59, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x9a, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa0, 0x9f, 0xa0, 0xa0, 0xa0, 0x9f, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa1, 0xa0, 0xa0, 0xa1, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa2, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa2, 0xa1, 0xa2, 0xa1, 0xa2, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa0, 0xa0, 0xa1, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0xa0, 0x9f, 0xa0, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x59, 0x9a, 0x59, 0x9a, 0x59, 0x9a, 0x59, 0x9a, 0x59, 0x9a, 0x59, 0x9a, 0x59, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_img_dsc_t image17 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image17_map,
-};
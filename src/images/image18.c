@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE18
-#define LV_ATTRIBUTE_IMG_IMAGE18
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE18 uint8_t image18_map[] = {
-  0xfc, 0xfc, 0xfc, 0xff, 	/*Color of index 0*/
-  0x02, 0x02, 0x02, 0xff, 	/*Color of index 1*/
-  0xe4, 0xe2, 0xf6, 0xff, 	/*Color of index 2*/
-  0xcd, 0xcc, 0xf9, 0xff, 	/*Color of index 3*/
-  0xd3, 0xcd, 0xe4, 0xff, 	/*Color of index 4*/
-  0xaf, 0xae, 0xe0, 0xff, 	/*Color of index 5*/
-  0x9a, 0x94, 0xcf, 0xff, 	/*Color of index 6*/
-  0x99, 0x92, 0xb4, 0xff, 	/*Color of index 7*/
-  0x87, 0x86, 0xd5, 0xff, 	/*Color of index 8*/
-  0x85, 0x7f, 0xaf, 0xff, 	/*Color of index 9*/
-  0x86, 0x86, 0x92, 0xff, 	/*Color of index 10*/
-  0x77, 0x6d, 0xa8, 0xff, 	/*Color of index 11*/
-  0x61, 0x63, 0xc5, 0xff, 	/*Color of index 12*/
-  0x66, 0x63, 0xac, 0xff, 	/*Color of index 13*/
-  0x4d, 0x55, 0xc6, 0xff, 	/*Color of index 14*/
-  0x15, 0x49, 0xe9, 0xff, 	/*Color of index 15*/
-  0x3e, 0x48, 0xdc, 0xff, 	/*Color of index 16*/
-  0x1a, 0x46, 0xbc, 0xff, 	/*Color of index 17*/
-  0x46, 0x40, 0xc0, 0xff, 	/*Color of index 18*/
-  0x2f, 0x35, 0xe7, 0xff, 	/*Color of index 19*/
-  0x5a, 0x49, 0x8d, 0xff, 	/*Color of index 20*/
-  0x31, 0x34, 0xc7, 0xff, 	/*Color of index 21*/
-  0x4e, 0x36, 0xa0, 0xff, 	/*Color of index 22*/
-  0x44, 0x2c, 0xaa, 0xff, 	/*Color of index 23*/
-  0x41, 0x34, 0x87, 0xff, 	/*Color of index 24*/
-  0x2f, 0x19, 0xce, 0xff, 	/*Color of index 25*/
-  0x3b, 0x22, 0xa9, 0xff, 	/*Color of index 26*/
-  0x35, 0x1e, 0xb7, 0xff, 	/*Color of index 27*/
-  0x32, 0x1a, 0x92, 0xff, 	/*Color of index 28*/
-  0x2e, 0x17, 0x89, 0xff, 	/*Color of index 29*/
-  0x2a, 0x10, 0xa0, 0xff, 	/*Color of index 30*/
-  0x2a, 0x12, 0x94, 0xff, 	/*Color of index 31*/
-  0x2f, 0x19, 0x7a, 0xff, 	/*Color of index 32*/
-  0x2a, 0x17, 0x66, 0xff, 	/*Color of index 33*/
-  0x1b, 0x10, 0x44, 0xff, 	/*Color of index 34*/
-  0x0f, 0x0b, 0x2f, 0xff, 	/*Color of index 35*/
-  0x04, 0x01, 0x1c, 0xff, 	/*Color of index 36*/
-  0x02, 0x00, 0x08, 0xff, 	/*Color of index 37*/
-  0xe7, 0xf8, 0xfd, 0xff, 	/*Color of index 38*/
-  0xdc, 0xf0, 0xfc, 0xff, 	/*Color of index 39*/
-  0xee, 0xf0, 0xf3, 0xff, 	/*Color of index 40*/
-  0xc1, 0xee, 0xfd, 0xff, 	/*Color of index 41*/
-  0xc7, 0xe2, 0xf9, 0xff, 	/*Color of index 42*/
-  0xa6, 0xdc, 0xf4, 0xff, 	/*Color of index 43*/
-  0xcd, 0xda, 0xe6, 0xff, 	/*Color of index 44*/
-  0xb0, 0xcf, 0xed, 0xff, 	/*Color of index 45*/
-  0xc7, 0xce, 0xd5, 0xff, 	/*Color of index 46*/
-  0xa1, 0xc7, 0xea, 0xff, 	/*Color of index 47*/
-  0x82, 0xcb, 0xdf, 0xff, 	/*Color of index 48*/
-  0xb7, 0xc7, 0xd4, 0xff, 	/*Color of index 49*/
-  0x4e, 0xc6, 0xf7, 0xff, 	/*Color of index 50*/
-  0x9d, 0xc0, 0xd5, 0xff, 	/*Color of index 51*/
-  0x90, 0xb7, 0xe1, 0xff, 	/*Color of index 52*/
-  0x30, 0xb0, 0xf7, 0xff, 	/*Color of index 53*/
-  0x4a, 0xb2, 0xd8, 0xff, 	/*Color of index 54*/
-  0x9b, 0xb0, 0xbf, 0xff, 	/*Color of index 55*/
-  0x82, 0xa7, 0xe1, 0xff, 	/*Color of index 56*/
-  0x7f, 0xa5, 0xc3, 0xff, 	/*Color of index 57*/
-  0x5d, 0x96, 0xd4, 0xff, 	/*Color of index 58*/
-  0x46, 0x8b, 0xe1, 0xff, 	/*Color of index 59*/
-  0x71, 0x97, 0xa1, 0xff, 	/*Color of index 60*/
-  0x56, 0x8c, 0xb6, 0xff, 	/*Color of index 61*/
-  0x35, 0x7c, 0xde, 0xff, 	/*Color of index 62*/
-  0x45, 0x7f, 0xc3, 0xff, 	/*Color of index 63*/
-  0x53, 0x7c, 0x9b, 0xff, 	/*Color of index 64*/
-  0x35, 0x6c, 0xc7, 0xff, 	/*Color of index 65*/
-  0x08, 0x69, 0xcc, 0xff, 	/*Color of index 66*/
-  0x3f, 0x66, 0xaf, 0xff, 	/*Color of index 67*/
-  0x3f, 0x6b, 0x89, 0xff, 	/*Color of index 68*/
-  0x1e, 0x54, 0xa8, 0xff, 	/*Color of index 69*/
-  0x4d, 0x59, 0x66, 0xff, 	/*Color of index 70*/
-  0x4c, 0x4d, 0x4e, 0xff, 	/*Color of index 71*/
-  0x2f, 0x34, 0x3b, 0xff, 	/*Color of index 72*/
-  0xf7, 0xf8, 0xf8, 0xff, 	/*Color of index 73*/
-  0xe0, 0xe9, 0xe9, 0xff, 	/*Color of index 74*/
-  0xf5, 0xf6, 0xf4, 0xff, 	/*Color of index 75*/
-  0x04, 0x06, 0x02, 0xff, 	/*Color of index 76*/
-  0xfe, 0xfd, 0xec, 0xff, 	/*Color of index 77*/
-  0xfa, 0xf9, 0xf6, 0xff, 	/*Color of index 78*/
-  0xf8, 0xf5, 0xf1, 0xff, 	/*Color of index 79*/
-  0xfd, 0xf5, 0xe4, 0xff, 	/*Color of index 80*/
-  0xf6, 0xf1, 0xeb, 0xff, 	/*Color of index 81*/
-  0xfd, 0xf2, 0xd9, 0xff, 	/*Color of index 82*/
-  0xf0, 0xec, 0xe9, 0xff, 	/*Color of index 83*/
-  0xf0, 0xe9, 0xe3, 0xff, 	/*Color of index 84*/
-  0xfa, 0xeb, 0xd2, 0xff, 	/*Color of index 85*/
-  0xee, 0xe8, 0xda, 0xff, 	/*Color of index 86*/
-  0xea, 0xe5, 0xe1, 0xff, 	/*Color of index 87*/
-  0xea, 0xe3, 0xd9, 0xff, 	/*Color of index 88*/
-  0xea, 0xe2, 0xd4, 0xff, 	/*Color of index 89*/
-  0xe6, 0xe0, 0xdc, 0xff, 	/*Color of index 90*/
-  0xed, 0xdf, 0xcc, 0xff, 	/*Color of index 91*/
-  0xdd, 0xdb, 0xda, 0xff, 	/*Color of index 92*/
-  0xe3, 0xdb, 0xd3, 0xff, 	/*Color of index 93*/
-  0xee, 0xdb, 0xbf, 0xff, 	/*Color of index 94*/
-  0xe1, 0xd8, 0xcb, 0xff, 	/*Color of index 95*/
-  0xe2, 0xd4, 0xc3, 0xff, 	/*Color of index 96*/
-  0xda, 0xd3, 0xc9, 0xff, 	/*Color of index 97*/
-  0xdc, 0xd1, 0xc3, 0xff, 	/*Color of index 98*/
-  0xe4, 0xd1, 0xb7, 0xff, 	/*Color of index 99*/
-  0xda, 0xcd, 0xc1, 0xff, 	/*Color of index 100*/
-  0xd4, 0xcc, 0xc5, 0xff, 	/*Color of index 101*/
-  0xda, 0xcd, 0xbc, 0xff, 	/*Color of index 102*/
-  0xd8, 0xcb, 0xb4, 0xff, 	/*Color of index 103*/
-  0xd5, 0xc8, 0xba, 0xff, 	/*Color of index 104*/
-  0xdd, 0xc8, 0xa9, 0xff, 	/*Color of index 105*/
-  0xcc, 0xc3, 0xbb, 0xff, 	/*Color of index 106*/
-  0xd1, 0xc3, 0xb3, 0xff, 	/*Color of index 107*/
-  0xd1, 0xc3, 0xa9, 0xff, 	/*Color of index 108*/
-  0xec, 0xc7, 0x89, 0xff, 	/*Color of index 109*/
-  0xca, 0xbe, 0xb1, 0xff, 	/*Color of index 110*/
-  0xcb, 0xbc, 0xac, 0xff, 	/*Color of index 111*/
-  0xc3, 0xba, 0xb1, 0xff, 	/*Color of index 112*/
-  0xcb, 0xba, 0xa2, 0xff, 	/*Color of index 113*/
-  0xc3, 0xb7, 0xa9, 0xff, 	/*Color of index 114*/
-  0xbb, 0xb3, 0xac, 0xff, 	/*Color of index 115*/
-  0xd3, 0xb7, 0x93, 0xff, 	/*Color of index 116*/
-  0xba, 0xaf, 0xa2, 0xff, 	/*Color of index 117*/
-  0xc4, 0xb0, 0x99, 0xff, 	/*Color of index 118*/
-  0xba, 0xaa, 0x96, 0xff, 	/*Color of index 119*/
-  0xc7, 0xaa, 0x7d, 0xff, 	/*Color of index 120*/
-  0xb0, 0xa3, 0x96, 0xff, 	/*Color of index 121*/
-  0xb3, 0xa2, 0x8b, 0xff, 	/*Color of index 122*/
-  0xae, 0x9d, 0x8a, 0xff, 	/*Color of index 123*/
-  0xbf, 0xa1, 0x73, 0xff, 	/*Color of index 124*/
-  0xa3, 0x9a, 0x92, 0xff, 	/*Color of index 125*/
-  0xac, 0x98, 0x82, 0xff, 	/*Color of index 126*/
-  0x98, 0x93, 0x92, 0xff, 	/*Color of index 127*/
-  0xab, 0x96, 0x76, 0xff, 	/*Color of index 128*/
-  0xa4, 0x93, 0x82, 0xff, 	/*Color of index 129*/
-  0xa2, 0x90, 0x7b, 0xff, 	/*Color of index 130*/
-  0x97, 0x8d, 0x84, 0xff, 	/*Color of index 131*/
-  0x9f, 0x8c, 0x79, 0xff, 	/*Color of index 132*/
-  0xa0, 0x8b, 0x73, 0xff, 	/*Color of index 133*/
-  0xb4, 0x8e, 0x5c, 0xff, 	/*Color of index 134*/
-  0x9c, 0x88, 0x73, 0xff, 	/*Color of index 135*/
-  0x9a, 0x85, 0x71, 0xff, 	/*Color of index 136*/
-  0x87, 0x82, 0x7e, 0xff, 	/*Color of index 137*/
-  0x93, 0x83, 0x73, 0xff, 	/*Color of index 138*/
-  0x98, 0x82, 0x6c, 0xff, 	/*Color of index 139*/
-  0xa1, 0x84, 0x5e, 0xff, 	/*Color of index 140*/
-  0x94, 0x7e, 0x6a, 0xff, 	/*Color of index 141*/
-  0xe3, 0x8f, 0x13, 0xff, 	/*Color of index 142*/
-  0x86, 0x7b, 0x71, 0xff, 	/*Color of index 143*/
-  0xca, 0x87, 0x21, 0xff, 	/*Color of index 144*/
-  0x8d, 0x79, 0x63, 0xff, 	/*Color of index 145*/
-  0x9d, 0x7c, 0x51, 0xff, 	/*Color of index 146*/
-  0xa0, 0x7b, 0x4b, 0xff, 	/*Color of index 147*/
-  0x84, 0x73, 0x63, 0xff, 	/*Color of index 148*/
-  0x9d, 0x78, 0x49, 0xff, 	/*Color of index 149*/
-  0x75, 0x71, 0x6e, 0xff, 	/*Color of index 150*/
-  0x9f, 0x78, 0x44, 0xff, 	/*Color of index 151*/
-  0x9f, 0x7b, 0x36, 0xff, 	/*Color of index 152*/
-  0x97, 0x70, 0x5d, 0xff, 	/*Color of index 153*/
-  0x9d, 0x74, 0x49, 0xff, 	/*Color of index 154*/
-  0x9d, 0x75, 0x44, 0xff, 	/*Color of index 155*/
-  0x91, 0x73, 0x4d, 0xff, 	/*Color of index 156*/
-  0x83, 0x70, 0x56, 0xff, 	/*Color of index 157*/
-  0xa0, 0x73, 0x3f, 0xff, 	/*Color of index 158*/
-  0xaa, 0x72, 0x3c, 0xff, 	/*Color of index 159*/
-  0x76, 0x6b, 0x5f, 0xff, 	/*Color of index 160*/
-  0x9c, 0x70, 0x3a, 0xff, 	/*Color of index 161*/
-  0x93, 0x6e, 0x3f, 0xff, 	/*Color of index 162*/
-  0xa4, 0x71, 0x2f, 0xff, 	/*Color of index 163*/
-  0x89, 0x6b, 0x45, 0xff, 	/*Color of index 164*/
-  0x77, 0x66, 0x4e, 0xff, 	/*Color of index 165*/
-  0x6b, 0x61, 0x5c, 0xff, 	/*Color of index 166*/
-  0x96, 0x6a, 0x2f, 0xff, 	/*Color of index 167*/
-  0xa5, 0x6e, 0x1b, 0xff, 	/*Color of index 168*/
-  0x85, 0x61, 0x3d, 0xff, 	/*Color of index 169*/
-  0x9a, 0x68, 0x1c, 0xff, 	/*Color of index 170*/
-  0x88, 0x63, 0x2e, 0xff, 	/*Color of index 171*/
-  0x69, 0x5c, 0x4f, 0xff, 	/*Color of index 172*/
-  0xa2, 0x68, 0x11, 0xff, 	/*Color of index 173*/
-  0x79, 0x5f, 0x3d, 0xff, 	/*Color of index 174*/
-  0x91, 0x62, 0x1e, 0xff, 	/*Color of index 175*/
-  0x69, 0x5a, 0x42, 0xff, 	/*Color of index 176*/
-  0xa3, 0x65, 0x07, 0xff, 	/*Color of index 177*/
-  0x99, 0x62, 0x13, 0xff, 	/*Color of index 178*/
-  0x5e, 0x54, 0x4d, 0xff, 	/*Color of index 179*/
-  0x9b, 0x62, 0x09, 0xff, 	/*Color of index 180*/
-  0x85, 0x59, 0x26, 0xff, 	/*Color of index 181*/
-  0x7a, 0x58, 0x2c, 0xff, 	/*Color of index 182*/
-  0x9a, 0x5d, 0x0b, 0xff, 	/*Color of index 183*/
-  0x8d, 0x59, 0x13, 0xff, 	/*Color of index 184*/
-  0x5f, 0x50, 0x3d, 0xff, 	/*Color of index 185*/
-  0x73, 0x52, 0x2e, 0xff, 	/*Color of index 186*/
-  0x94, 0x59, 0x0a, 0xff, 	/*Color of index 187*/
-  0x7f, 0x53, 0x17, 0xff, 	/*Color of index 188*/
-  0x54, 0x48, 0x3d, 0xff, 	/*Color of index 189*/
-  0x60, 0x4a, 0x31, 0xff, 	/*Color of index 190*/
-  0x82, 0x50, 0x0b, 0xff, 	/*Color of index 191*/
-  0x6a, 0x48, 0x1d, 0xff, 	/*Color of index 192*/
-  0x45, 0x41, 0x3d, 0xff, 	/*Color of index 193*/
-  0x51, 0x42, 0x33, 0xff, 	/*Color of index 194*/
-  0x79, 0x46, 0x11, 0xff, 	/*Color of index 195*/
-  0x59, 0x41, 0x2c, 0xff, 	/*Color of index 196*/
-  0x78, 0x46, 0x0a, 0xff, 	/*Color of index 197*/
-  0x69, 0x42, 0x13, 0xff, 	/*Color of index 198*/
-  0x61, 0x3f, 0x1d, 0xff, 	/*Color of index 199*/
-  0x72, 0x43, 0x09, 0xff, 	/*Color of index 200*/
-  0x73, 0x40, 0x10, 0xff, 	/*Color of index 201*/
-  0x51, 0x3b, 0x29, 0xff, 	/*Color of index 202*/
-  0x42, 0x39, 0x30, 0xff, 	/*Color of index 203*/
-  0x69, 0x40, 0x09, 0xff, 	/*Color of index 204*/
-  0x6a, 0x40, 0x05, 0xff, 	/*Color of index 205*/
-  0x61, 0x3d, 0x12, 0xff, 	/*Color of index 206*/
-  0x66, 0x3f, 0x07, 0xff, 	/*Color of index 207*/
-  0x64, 0x3c, 0x07, 0xff, 	/*Color of index 208*/
-  0x55, 0x38, 0x15, 0xff, 	/*Color of index 209*/
-  0x46, 0x34, 0x23, 0xff, 	/*Color of index 210*/
-  0x5d, 0x39, 0x0a, 0xff, 	/*Color of index 211*/
-  0x34, 0x2f, 0x2b, 0xff, 	/*Color of index 212*/
-  0x53, 0x33, 0x0b, 0xff, 	/*Color of index 213*/
-  0x44, 0x2f, 0x1c, 0xff, 	/*Color of index 214*/
-  0x3c, 0x2d, 0x21, 0xff, 	/*Color of index 215*/
-  0x46, 0x2d, 0x0d, 0xff, 	/*Color of index 216*/
-  0x3b, 0x29, 0x19, 0xff, 	/*Color of index 217*/
-  0x32, 0x28, 0x1f, 0xff, 	/*Color of index 218*/
-  0x31, 0x24, 0x1a, 0xff, 	/*Color of index 219*/
-  0x33, 0x22, 0x13, 0xff, 	/*Color of index 220*/
-  0x41, 0x24, 0x06, 0xff, 	/*Color of index 221*/
-  0x2b, 0x1f, 0x18, 0xff, 	/*Color of index 222*/
-  0x2b, 0x1f, 0x14, 0xff, 	/*Color of index 223*/
-  0x23, 0x1c, 0x1a, 0xff, 	/*Color of index 224*/
-  0x26, 0x1e, 0x12, 0xff, 	/*Color of index 225*/
-  0x28, 0x1c, 0x13, 0xff, 	/*Color of index 226*/
-  0x35, 0x1e, 0x05, 0xff, 	/*Color of index 227*/
-  0x24, 0x19, 0x12, 0xff, 	/*Color of index 228*/
-  0x2b, 0x1a, 0x0a, 0xff, 	/*Color of index 229*/
-  0x1e, 0x18, 0x13, 0xff, 	/*Color of index 230*/
-  0x23, 0x18, 0x0d, 0xff, 	/*Color of index 231*/
-  0x21, 0x15, 0x0d, 0xff, 	/*Color of index 232*/
-  0x1b, 0x13, 0x11, 0xff, 	/*Color of index 233*/
-  0x1b, 0x11, 0x0a, 0xff, 	/*Color of index 234*/
-  0x24, 0x11, 0x01, 0xff, 	/*Color of index 235*/
-  0x13, 0x0e, 0x0a, 0xff, 	/*Color of index 236*/
-  0x19, 0x0c, 0x02, 0xff, 	/*Color of index 237*/
-  0x0b, 0x08, 0x04, 0xff, 	/*Color of index 238*/
-  0x13, 0x07, 0x01, 0xff, 	/*Color of index 239*/
-  0x09, 0x03, 0x01, 0xff, 	/*Color of index 240*/
-  0xd5, 0xd3, 0xd3, 0xff, 	/*Color of index 241*/
-  0xcd, 0xc6, 0xc6, 0xff, 	/*Color of index 242*/
-  0x7a, 0x4a, 0x45, 0xff, 	/*Color of index 243*/
-  0x56, 0x34, 0x3a, 0xff, 	/*Color of index 244*/
-  0x84, 0x65, 0x7c, 0xff, 	/*Color of index 245*/
-  0x6a, 0x41, 0x63, 0xff, 	/*Color of index 246*/
-  0x4c, 0x2c, 0x4d, 0xff, 	/*Color of index 247*/
-  0x0a, 0x08, 0x0a, 0xff, 	/*Color of index 248*/
-  0xfa, 0xf5, 0xfb, 0xff, 	/*Color of index 249*/
-  0xc3, 0xb8, 0xd3, 0xff, 	/*Color of index 250*/
-  0xa8, 0xa7, 0xaa, 0xff, 	/*Color of index 251*/
-  0x6e, 0x57, 0x8a, 0xff, 	/*Color of index 252*/
-  0x5b, 0x35, 0x87, 0xff, 	/*Color of index 253*/
-  0x44, 0x2b, 0x68, 0xff, 	/*Color of index 254*/
-  0x3b, 0x22, 0x71, 0xff, 	/*Color of index 255*/
-
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0xf0, 0x4c, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0xf0, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x25, 0x25, 0x25, 0x25, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x25, 0xf8, 0x25, 0x01, 0x01, 0x4c, 0xee, 0xee, 0xef, 0xf0, 0x4c, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0xef, 0xea, 0xe8, 0xe8, 0xe8, 0xed, 0xed, 0xed, 0xea, 0xe6, 0xe4, 0xde, 0xe0, 0xe6, 0xe0, 0xe0, 0xe0, 0xe0, 0xe6, 0xe9, 0xec, 0xec, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0xf8, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x25, 0x25, 0x25, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x01, 0x01, 0x25, 0x01, 0xf0, 0xf0, 0x25, 0xf0, 0x25, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x01, 0x01, 0xf0, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xed, 0xe5, 0xdc, 0xd6, 0xbe, 0xbe, 0xb9, 0xb9, 0xb0, 0xac, 0x9d, 0x8a, 0x7e, 0x75, 0x72, 0x6f, 0x70, 0x6a, 0x6a, 0x6a, 0x6a, 0xf2, 0x6a, 0xf2, 0xf2, 0xf2, 0x70, 0x70, 0xfb, 0x79, 0x7d, 0x0a, 0x8f, 0xa0, 0x47, 0xc1, 0x48, 0xe0, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf8, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0x4c, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xeb, 0xdc, 0xca, 0xba, 0xa5, 0x92, 0x91, 0xa4, 0x8c, 0x7c, 0x77, 0x6c, 0x5e, 0x5e, 0x5b, 0x59, 0x5b, 0x5b, 0x56, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4b, 0x4b, 0x4a, 0xf1, 0x73, 0x7f, 0x96, 0xc1, 0xda, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x25, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0x25, 0x25, 0x25, 0x25, 0xf0, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0xef, 0xef, 0x25, 0xf0, 0x25, 0xf0, 0xf0, 0xf0, 0xef, 0xeb, 0xd6, 0xbe, 0x9c, 0x92, 0x8c, 0x8c, 0x86, 0x8c, 0x86, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0x76, 0x69, 0x63, 0x5e, 0x5e, 0x5e, 0x5e, 0x60, 0x5e, 0x60, 0x5b, 0x59, 0x52, 0x4d, 0x4d, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x70, 0x8f, 0x47, 0xda, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x25, 0x25, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0xf0, 0x4c, 0xf0, 0xf0, 0xf0, 0xf0, 0x25, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0xef, 0xf0, 0xf0, 0x4c, 0xf0, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xdd, 0xd1, 0xb6, 0xa4, 0x8c, 0xa2, 0x9c, 0xa2, 0xa2, 0xa2, 0xa1, 0x9e, 0xa1, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa4, 0xa4, 0xa4, 0xa4, 0x91, 0x85, 0x7c, 0x71, 0x69, 0x5e, 0x5b, 0x5e, 0x60, 0x63, 0x60, 0x5b, 0x59, 0x55, 0x50, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf2, 0x7f, 0x96, 0xc1, 0xe6, 0xf8, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0xef, 0xee, 0xef, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0x4c, 0xf0, 0x01, 0x25, 0xf0, 0x25, 0xf0, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf0, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x25, 0x25, 0xf0, 0xef, 0xeb, 0xd8, 0xc0, 0xa9, 0xa2, 0xa2, 0xa7, 0xab, 0xa2, 0x9e, 0x9b, 0x97, 0x9e, 0x97, 0x9e, 0x97, 0x97, 0x97, 0x9b, 0x9b, 0x9b, 0x9a, 0xa2, 0x9c, 0x9c, 0xa2, 0xa4, 0xa5, 0xa9, 0x9d, 0x8c, 0x80, 0x78, 0x63, 0x5e, 0x5b, 0x5e, 0x5e, 0x60, 0x5f, 0x56, 0x54, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x6a, 0x7f, 0xa6, 0x48, 0xea, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x25, 0xf0, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x25, 0x01, 0x25, 0x25, 0x4c, 0xf8, 0xf8, 0x4c, 0x25, 0x25, 0x25, 0xf0, 0xeb, 0xd1, 0xb5, 0xa7, 0xa7, 0xb8, 0xbc, 0xab, 0x8c, 0x78, 0x69, 0x6d, 0x78, 0x93, 0x97, 0x97, 0x97, 0x9f, 0x97, 0x9e, 0x9e, 0x9e, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x9c, 0x9a, 0x9a, 0x95, 0x9c, 0xa4, 0xa4, 0xa4, 0x92, 0x8c, 0x7a, 0x71, 0x5e, 0x52, 0x55, 0x66, 0x60, 0x5f, 0x5d, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x5a, 0x73, 0xa0, 0xd4, 0xe1, 0xdc, 0xe4, 0xed, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0x25, 0x25, 0x25, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x25, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xed, 0xd6, 0xa4, 0x98, 0xaf, 0xbf, 0xbf, 0x98, 0x78, 0x5e, 0x55, 0x52, 0x63, 0x7c, 0x97, 0x97, 0x97, 0x97, 0x9e, 0x97, 0x9e, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9a, 0x9b, 0x9a, 0x9a, 0x9c, 0x9b, 0x9c, 0x9b, 0x9c, 0xa2, 0x9c, 0xa4, 0xa4, 0x92, 0x7e, 0x69, 0x52, 0x55, 0x5f, 0x5b, 0x5d, 0x5d, 0x56, 0x4f, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x4e, 0x56, 0x79, 0xac, 0xcb, 0xbe, 0xbe, 0xc7, 0xe3, 0xe3, 0xe3, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x25, 0xf8, 0x25, 0x25, 0xf8, 0x25, 0x25, 0x01, 0x25, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x25, 0x25, 0xf8, 0x01, 0xee, 0xec, 0xf0, 0xf0, 0xed, 0xd3, 0xa7, 0x98, 0xbc, 0xce, 0xb6, 0x8c, 0x63, 0x4d, 0x52, 0x4d, 0x52, 0x74, 0x93, 0xa1, 0xa9, 0x93, 0x97, 0x9e, 0x9e, 0x9b, 0x9b, 0x9a, 0x9a, 0x9c, 0x9a, 0x9a, 0x9e, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0xa2, 0x9b, 0xa2, 0x9c, 0xa4, 0xa4, 0xa4, 0x9c, 0x8d, 0x74, 0x5e, 0x5b, 0x5e, 0x5f, 0x5f, 0x59, 0x51, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x73, 0x9d, 0xba, 0xba, 0xa9, 0xa9, 0xc0, 0xc0, 0xc7, 0xdd, 0xe5, 0xef, 0xef, 0xf0, 0xf0, 0xee, 0xf0, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0xed, 0xd8, 0xb8, 0x98, 0xbf, 0xbf, 0x9b, 0x76, 0x55, 0x4d, 0x4d, 0x4d, 0x4d, 0x5e, 0x78, 0x9c, 0xab, 0x93, 0x93, 0xa1, 0x9b, 0x97, 0xa1, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x9c, 0x9a, 0x9b, 0x9b, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xa2, 0x9b, 0x9a, 0x9c, 0xa4, 0xa4, 0xae, 0x91, 0x74, 0x60, 0x5e, 0x5e, 0x5e, 0x64, 0x5d, 0x56, 0x4e, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x71, 0x9c, 0xae, 0xb6, 0xa9, 0xb6, 0xa9, 0xb6, 0xba, 0xc0, 0xd5, 0xdd, 0xeb, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf0, 0xef, 0xed, 0xe5, 0xc0, 0xab, 0xab, 0xbb, 0x98, 0x78, 0x55, 0x4d, 0x00, 0xf9, 0x00, 0x4f, 0x6c, 0x86, 0xa2, 0x98, 0x97, 0x9b, 0xa2, 0xa1, 0x9b, 0x97, 0x9e, 0x9b, 0x9b, 0x9b, 0x9a, 0x9c, 0x9a, 0x9a, 0x9b, 0x9a, 0x9a, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xa2, 0xa2, 0xa2, 0x9a, 0xa2, 0x9c, 0xa9, 0xa4, 0x91, 0x78, 0x63, 0x5b, 0x5f, 0x5b, 0x61, 0x5d, 0x56, 0x4e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x4d, 0x55, 0x7a, 0xa4, 0xc0, 0xb5, 0xab, 0xb5, 0xab, 0xab, 0xb5, 0xb5, 0xc0, 0xc6, 0xd8, 0xe3, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x4c, 0xf0, 0x4c, 0xf0, 0xf0, 0xed, 0xd8, 0xb5, 0xa2, 0xb8, 0xbc, 0x7c, 0x5e, 0x4d, 0x4d, 0x4e, 0x4d, 0x00, 0x5b, 0x85, 0xa4, 0xa9, 0xa1, 0x93, 0x9e, 0xa1, 0x97, 0x93, 0x9e, 0xa1, 0x93, 0x9e, 0x9b, 0x9b, 0x9a, 0x9b, 0x9c, 0x9a, 0x9a, 0x9b, 0x9a, 0x9a, 0x9b, 0x9b, 0x9a, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9e, 0xa1, 0x9b, 0x9b, 0x9a, 0xa2, 0x9c, 0x9c, 0xa4, 0xa4, 0x8c, 0x7c, 0x5e, 0x59, 0x5b, 0x62, 0x5f, 0x58, 0x51, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x4d, 0x4d, 0x4d, 0x5e, 0x86, 0xb5, 0xbc, 0xaf, 0xb8, 0xb2, 0xb2, 0xaa, 0xb2, 0xa7, 0xaf, 0xbc, 0xc0, 0xd1, 0xe3, 0xed, 0xef, 0xf0, 0x01, 0xf0, 0x25, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x4c, 0xef, 0xf0, 0xe3, 0xc0, 0x9b, 0xab, 0xd3, 0x9f, 0x63, 0x4e, 0x00, 0x4d, 0x4d, 0x4d, 0x4d, 0x78, 0x9c, 0xab, 0xa2, 0x93, 0x9f, 0x9f, 0x97, 0x93, 0x9f, 0xa1, 0x9e, 0x97, 0xa1, 0x9e, 0x9b, 0x9e, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x97, 0x9b, 0xa2, 0x9e, 0x9a, 0x95, 0x9a, 0xa2, 0x9c, 0xa4, 0x9c, 0xa4, 0x9d, 0x71, 0x55, 0x5b, 0x60, 0x5f, 0x5f, 0x58, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x4e, 0x4d, 0x4d, 0x4d, 0x52, 0x6d, 0xa2, 0xbc, 0xb2, 0xb2, 0xb2, 0xb4, 0xb2, 0xb4, 0xb2, 0xaf, 0xaa, 0xa7, 0xb6, 0xba, 0xd6, 0xe3, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0x25, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x25, 0x25, 0x25, 0x25, 0xf0, 0x4c, 0xed, 0xf0, 0x01, 0x24, 0x25, 0x24, 0x01, 0x01, 0x4c, 0x4c, 0xed, 0xd8, 0xa3, 0xa3, 0xb8, 0xbc, 0x80, 0x4d, 0x4e, 0x4d, 0x00, 0x4d, 0x4d, 0x63, 0x9c, 0xab, 0xa2, 0x9b, 0x9e, 0x9e, 0x9a, 0x9a, 0x9e, 0x9b, 0x9e, 0x9b, 0x9e, 0x9b, 0x9e, 0x97, 0x9b, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9c, 0x9a, 0x9a, 0x9a, 0x9c, 0x92, 0xae, 0x8c, 0x63, 0x52, 0x5e, 0x5e, 0x59, 0x58, 0x56, 0x4f, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x49, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x52, 0x85, 0xc0, 0xb5, 0xaa, 0xb7, 0xad, 0xb1, 0xb4, 0xad, 0xb2, 0xb2, 0xaa, 0xa7, 0xa7, 0xab, 0xb5, 0xc0, 0xdd, 0xeb, 0xef, 0xf0, 0xf0, 0xf0, 0x25, 0x4c, 0xee, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0xf0, 0x25, 0x25, 0x25, 0x25, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x01, 0x25, 0x25, 0x25, 0xf0, 0xee, 0xee, 0x4c, 0x01, 0x25, 0x25, 0x25, 0xee, 0xee, 0xf0, 0xeb, 0xc0, 0xa7, 0xaa, 0xb8, 0xab, 0x74, 0x4d, 0x00, 0x4d, 0x00, 0x4d, 0x52, 0x78, 0xb6, 0xa2, 0x9b, 0x9e, 0x9e, 0x9e, 0x97, 0x9b, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x9b, 0x97, 0x9b, 0x97, 0x9b, 0x97, 0x9b, 0x97, 0x9b, 0x9b, 0x95, 0x9b, 0x95, 0x9a, 0x9a, 0xa2, 0x9a, 0xa2, 0x9a, 0xa2, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0xa4, 0x8c, 0xa4, 0xa4, 0x7c, 0x55, 0x52, 0x5e, 0x58, 0x5b, 0x5c, 0x57, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x49, 0x00, 0x00, 0xf9, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x49, 0x00, 0x00, 0x4f, 0x4d, 0x6c, 0xb5, 0xb8, 0xaa, 0xb7, 0xb2, 0xb1, 0xad, 0xb1, 0xa8, 0xad, 0xb2, 0xaf, 0xaa, 0xab, 0xaa, 0xb5, 0xb8, 0xc7, 0xdd, 0xeb, 0xef, 0xf0, 0xf0, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0xf0, 0x25, 0xf0, 0x25, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x25, 0x25, 0x25, 0x25, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x4c, 0x25, 0x4c, 0xee, 0xf0, 0xe3, 0xc0, 0x9f, 0xab, 0xbc, 0x93, 0x5e, 0x4d, 0x4d, 0x4d, 0x4d, 0x50, 0x69, 0x8d, 0xae, 0xa2, 0x9b, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x9b, 0x97, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x92, 0xa2, 0x9c, 0x9c, 0xa4, 0x80, 0x63, 0x55, 0x5b, 0x5b, 0x5d, 0x5c, 0x57, 0x4b, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x49, 0x00, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x49, 0x00, 0x00, 0x4d, 0x4d, 0x63, 0x9b, 0xbc, 0xaf, 0xb7, 0xad, 0xb2, 0xb7, 0xad, 0xad, 0xb4, 0xaa, 0xaa, 0xaa, 0xaf, 0xab, 0xa7, 0xa7, 0xab, 0xc0, 0xd8, 0xe5, 0xef, 0xf0, 0xf8, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x4c, 0xee, 0xf0, 0x01, 0x01, 0x25, 0x25, 0x25, 0x25, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0x25, 0x01, 0x01, 0x4c, 0x4c, 0xee, 0x4c, 0xf0, 0xee, 0x4c, 0xdd, 0xb5, 0xa3, 0xb5, 0xc9, 0x86, 0x55, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x7a, 0xa4, 0xa9, 0x9a, 0xa2, 0x9f, 0x97, 0x9f, 0x9f, 0x9e, 0x9e, 0x9a, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x95, 0x9c, 0x9a, 0x92, 0x9c, 0xa4, 0x8c, 0x6c, 0x55, 0x55, 0x5f, 0x5d, 0x5a, 0x57, 0x53, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0x49, 0x00, 0x4e, 0x4e, 0x4e, 0x00, 0x49, 0x00, 0x49, 0x4e, 0x4d, 0x4d, 0x4d, 0x5e, 0x93, 0xb5, 0xb8, 0xa8, 0xaa, 0xb1, 0xb4, 0xb1, 0xb1, 0xad, 0xb4, 0xb2, 0xaf, 0xaf, 0xaf, 0xaf, 0xad, 0xa3, 0xa7, 0xb6, 0xca, 0xe3, 0xef, 0xf0, 0xf0, 0x01, 0x25, 0x25, 0x25, 0xee, 0xef, 0xee, 0xf0, 0xf0, 0x25, 0x25, 0x25, 0x25, 0x25, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0xf0, 0xf0, 0xf0, 0xf0, 0x01, 0x25, 0x25, 0x25, 0xf8, 0x4c, 0x4c, 0xef, 0xed, 0xdd, 0xaf, 0xa3, 0xbf, 0xb5, 0x86, 0x4d, 0x4d, 0x00, 0x50, 0x00, 0x5b, 0x9c, 0xa9, 0xa4, 0x9a, 0x9a, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9f, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x9b, 0x97, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x95, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x92, 0x95, 0xa4, 0x9a, 0x9c, 0xa4, 0x9c, 0x71, 0x55, 0x55, 0x59, 0x5d, 0x59, 0x58, 0x53, 0x4f, 0x4e, 0x00, 0x00, 0x49, 0x49, 0xf9, 0x4e, 0x49, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x49, 0x49, 0x49, 0x00, 0x4f, 0x4d, 0x4d, 0x4d, 0x52, 0x86, 0xbc, 0xb8, 0xaa, 0xaa, 0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xb2, 0xad, 0xaf, 0xaf, 0xad, 0xad, 0xb4, 0xb2, 0xb5, 0xab, 0xa9, 0xba, 0xd6, 0xea, 0xf0, 0x25, 0x25, 0x24, 0x01, 0xf0, 0xf0, 0xf0, 0xf8, 0xf0, 0xf0, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x25, 0x25, 0xf0, 0xf0, 0xef, 0xf0, 0x25, 0x25, 0x25, 0xf8, 0x01, 0xef, 0xeb, 0xd0, 0xaf, 0xa3, 0xbc, 0xaf, 0x78, 0x4d, 0x4d, 0x4d, 0x4e, 0x00, 0x74, 0xc0, 0xa2, 0x9a, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9a, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x9a, 0x9b, 0x9a, 0x9b, 0x9a, 0x9b, 0x95, 0x9a, 0x95, 0x95, 0x95, 0x95, 0x9a, 0x93, 0x9b, 0x95, 0x92, 0x9b, 0xa2, 0x92, 0xa4, 0xa4, 0x7a, 0x55, 0x55, 0x5b, 0x59, 0x59, 0x58, 0x54, 0x51, 0x4b, 0x00, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0xf9, 0x4e, 0x4e, 0x4d, 0x4e, 0x49, 0x49, 0x26, 0x28, 0x00, 0x4e, 0x56, 0x4d, 0x50, 0x4d, 0x7c, 0xab, 0xbf, 0xb2, 0xad, 0xb1, 0xa8, 0xb1, 0xb1, 0xad, 0xad, 0xb2, 0xaf, 0xb2, 0xad, 0xb1, 0xad, 0xa8, 0xad, 0xaf, 0xaa, 0xa9, 0xa9, 0xb3, 0xf4, 0x22, 0x24, 0x24, 0x24, 0x25, 0x24, 0xf0, 0xf0, 0xf0, 0x4c, 0x4c, 0x01, 0x25, 0x25, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0xf0, 0xef, 0xf0, 0xf0, 0x25, 0x25, 0x25, 0x01, 0xf0, 0xeb, 0xd3, 0xb8, 0xaa, 0xbf, 0xb6, 0x6d, 0x4d, 0x4d, 0x4d, 0x4e, 0x55, 0x85, 0xae, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0x9e, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x9b, 0x97, 0x9b, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x95, 0x9a, 0x95, 0x9a, 0x95, 0x9a, 0x95, 0xa2, 0x9b, 0x95, 0x93, 0x95, 0x9a, 0x92, 0xa4, 0xa9, 0x80, 0x55, 0x52, 0x5b, 0x59, 0x59, 0x58, 0x58, 0x4f, 0x4e, 0x00, 0x49, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x28, 0x00, 0x00, 0x4f, 0x00, 0x4d, 0x4d, 0x78, 0xb6, 0xaf, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xaa, 0xad, 0xad, 0xb1, 0xad, 0xb1, 0xad, 0xb1, 0xad, 0xb2, 0xab, 0xb0, 0xf5, 0xf6, 0x14, 0x21, 0x22, 0x23, 0x24, 0x24, 0x25, 0x01, 0x4c, 0x4c, 0x01, 0x25, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x25, 0x25, 0x4c, 0x01, 0xef, 0x4c, 0x4c, 0x25, 0x25, 0xf0, 0xed, 0xce, 0xaf, 0xaf, 0xb8, 0xb5, 0x74, 0x4d, 0x4d, 0x50, 0x4d, 0x5e, 0x86, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9b, 0x9b, 0x9b, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x9b, 0x95, 0x95, 0x95, 0x95, 0x9b, 0x95, 0x9a, 0x95, 0x95, 0x95, 0x95, 0x95, 0x9a, 0x9a, 0x95, 0x9a, 0x95, 0x9a, 0x95, 0x9b, 0x95, 0x9b, 0x97, 0x97, 0x9b, 0x9b, 0x95, 0x95, 0xa4, 0xa4, 0x7c, 0x5e, 0x52, 0x5b, 0x59, 0x56, 0x5d, 0x57, 0x54, 0x4e, 0x4e, 0x4f, 0x4e, 0x4e, 0x00, 0x4e, 0x4d, 0x4e, 0x4e, 0x4e, 0x49, 0x26, 0x49, 0x26, 0x49, 0x49, 0x4e, 0x4e, 0x4e, 0x4d, 0x4d, 0x78, 0xab, 0xb2, 0xb4, 0xad, 0xb1, 0xb1, 0xad, 0xb1, 0xad, 0xad, 0xb2, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xaf, 0xb5, 0xf3, 0xac, 0x14, 0x14, 0x16, 0x18, 0xff, 0x22, 0x24, 0x24, 0x25, 0x25, 0x25, 0xf8, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0xf0, 0xf0, 0xf0, 0xef, 0xd1, 0xab, 0xab, 0xbc, 0xbc, 0x69, 0x4d, 0x4d, 0x4d, 0x4d, 0x5e, 0x86, 0xa7, 0x9e, 0x9f, 0xa1, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9f, 0x97, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x97, 0x95, 0x9b, 0x95, 0x9b, 0x9a, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x97, 0x9b, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9b, 0x9b, 0x8c, 0xa2, 0xa5, 0x7c, 0x5e, 0x50, 0x5b, 0x5f, 0x52, 0x5d, 0x57, 0x53, 0x4f, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x4d, 0x4d, 0x52, 0x7c, 0xb5, 0xaf, 0xb1, 0xb1, 0xa8, 0xad, 0xad, 0xb4, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb2, 0xab, 0xb5, 0xa9, 0xf3, 0x14, 0x14, 0x14, 0x14, 0x18, 0x18, 0xff, 0x22, 0x24, 0x24, 0x24, 0x4c, 0x01, 0xf8, 0x01, 0x01, 0xf8, 0xf8, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0xf0, 0xef, 0xeb, 0xdd, 0xa9, 0xaf, 0xbc, 0xc0, 0x74, 0x4d, 0x4d, 0x4e, 0x00, 0x50, 0x93, 0x9f, 0x9f, 0x98, 0x98, 0x9e, 0xa1, 0x9e, 0x98, 0x9f, 0x98, 0x9e, 0x9e, 0x9e, 0x9b, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x95, 0x95, 0x97, 0x95, 0x97, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x97, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x97, 0x9b, 0x97, 0x97, 0x97, 0x97, 0x97, 0x93, 0xa2, 0x9b, 0x9c, 0x9a, 0xa4, 0x7e, 0x55, 0x50, 0x5b, 0x56, 0x58, 0x58, 0x58, 0x53, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4f, 0x50, 0x4d, 0x50, 0x7c, 0xbf, 0xaa, 0xad, 0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xad, 0xb2, 0xad, 0xb2, 0xad, 0xb2, 0xad, 0xb2, 0xaf, 0xaf, 0xa9, 0xb3, 0xf6, 0x14, 0xfd, 0x14, 0x16, 0x16, 0x16, 0x18, 0x22, 0x25, 0x01, 0x01, 0x01, 0xee, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0xef, 0xeb, 0xdd, 0xb5, 0xa1, 0xc3, 0xb6, 0x74, 0x4d, 0x4d, 0x50, 0x4d, 0x50, 0x8c, 0xa2, 0xa3, 0x9f, 0xa3, 0x98, 0x93, 0xa3, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9b, 0x9e, 0x9b, 0x9e, 0x9b, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x9b, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x9b, 0x95, 0x9b, 0x95, 0x97, 0x95, 0x97, 0x95, 0x9b, 0x95, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x9b, 0x95, 0x97, 0x9b, 0x97, 0x97, 0x97, 0x9b, 0x9e, 0x92, 0x9b, 0x9a, 0x92, 0x9c, 0xa9, 0x7e, 0x55, 0x50, 0x59, 0x59, 0x58, 0x57, 0x57, 0x54, 0x51, 0x4e, 0x4d, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x28, 0x00, 0x50, 0x4d, 0x52, 0x80, 0xc5, 0xaa, 0xa8, 0xb4, 0xb1, 0xa8, 0xb1, 0xb1, 0xad, 0xb1, 0xad, 0xb2, 0xb2, 0xb2, 0xb2, 0xad, 0xad, 0xad, 0xad, 0xb2, 0xb5, 0xb6, 0xb3, 0xf3, 0x14, 0xfd, 0x17, 0x17, 0x17, 0x12, 0x14, 0x14, 0xfc, 0x48, 0xf8, 0x01, 0x01, 0x01, 0xec, 0xf8, 0x01, 0x01, 0xf8, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x4c, 0xee, 0xed, 0xdd, 0xbf, 0xa3, 0xc3, 0xaf, 0x74, 0x4d, 0x4b, 0x4d, 0x4d, 0x50, 0x86, 0xa4, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9e, 0x9e, 0x98, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x9a, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x9a, 0x97, 0x95, 0x9b, 0x95, 0x97, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x97, 0x97, 0x97, 0x97, 0x9e, 0x9b, 0x93, 0x95, 0xa2, 0x9c, 0x9c, 0xa5, 0x7e, 0x52, 0x52, 0x58, 0x56, 0x54, 0x58, 0x5a, 0x54, 0x51, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0xf9, 0x49, 0x51, 0x4d, 0x4d, 0x8c, 0xbf, 0xb8, 0xa8, 0xb4, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb4, 0xad, 0xb2, 0xad, 0xb2, 0xb1, 0xad, 0xb1, 0xad, 0xb2, 0xb2, 0xaa, 0xb5, 0xf3, 0xf6, 0xfd, 0x16, 0x17, 0x15, 0x17, 0x17, 0x18, 0x0d, 0x02, 0xf9, 0xfb, 0x47, 0xde, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x4c, 0xef, 0xe3, 0xc3, 0xa7, 0xb8, 0xbf, 0x78, 0x52, 0x4b, 0xf9, 0x50, 0x4d, 0x78, 0xa2, 0x97, 0xa2, 0x95, 0x9a, 0x9a, 0xa1, 0xa3, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9a, 0x9e, 0x9e, 0x9f, 0x9e, 0x9f, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0x95, 0x95, 0x95, 0x95, 0x97, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x97, 0x95, 0x9b, 0x95, 0x97, 0x9a, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x9b, 0x97, 0x9a, 0x95, 0x9a, 0x97, 0x97, 0x97, 0x97, 0x97, 0xa2, 0x9b, 0x92, 0x9b, 0x9c, 0x9c, 0x9d, 0x99, 0x77, 0x55, 0x56, 0x56, 0x57, 0x56, 0x57, 0x58, 0x53, 0x50, 0x4e, 0x00, 0x49, 0x4e, 0x4e, 0x4e, 0x4d, 0x4e, 0x4d, 0x4e, 0x4d, 0x4e, 0x4e, 0x49, 0x00, 0x02, 0x00, 0x4e, 0x50, 0x4d, 0x55, 0x93, 0xbc, 0xaa, 0xb4, 0xb1, 0xad, 0xb1, 0xad, 0xb2, 0xb2, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb2, 0xaf, 0xb2, 0xb1, 0xb2, 0xb5, 0xf3, 0xf6, 0xfd, 0x17, 0x1b, 0x17, 0x17, 0x12, 0x16, 0x0d, 0x05, 0x00, 0x00, 0xf1, 0x7f, 0xb3, 0xe0, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0xf0, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x25, 0x25, 0x01, 0x01, 0xef, 0xeb, 0xc3, 0xaf, 0xaa, 0xd0, 0x80, 0x52, 0x4d, 0x4d, 0x4f, 0x4d, 0x78, 0xa2, 0xa3, 0x97, 0x9e, 0x97, 0xa2, 0xa1, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9b, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9a, 0x9f, 0x9b, 0x9e, 0x97, 0x97, 0x9b, 0x9b, 0x9a, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x95, 0x9a, 0x9a, 0x9a, 0x95, 0x95, 0x97, 0x95, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9c, 0x9a, 0x9a, 0x95, 0x95, 0x97, 0x97, 0x97, 0x95, 0x97, 0x95, 0x97, 0x97, 0x95, 0x97, 0x9b, 0x95, 0x95, 0x9b, 0x9a, 0x95, 0x95, 0x9c, 0xa4, 0x92, 0x6f, 0x52, 0x59, 0x58, 0x56, 0x56, 0x54, 0x56, 0x54, 0x4f, 0x4e, 0x4e, 0x4b, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0xf9, 0x00, 0x49, 0x4e, 0x4f, 0x50, 0x4d, 0x63, 0xa2, 0xaf, 0xaf, 0xb1, 0xb1, 0xb1, 0xb4, 0xb2, 0xb1, 0xb2, 0xb1, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0xb4, 0xb2, 0xb2, 0xb1, 0xb1, 0xb7, 0xb5, 0xf3, 0xf6, 0xfd, 0x16, 0x1a, 0x1a, 0x17, 0x1a, 0x17, 0x14, 0x06, 0x28, 0x00, 0x00, 0x49, 0x6a, 0x7f, 0xa6, 0xda, 0x01, 0x01, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x4c, 0xf0, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x24, 0xf8, 0xf0, 0xef, 0xef, 0xc9, 0xaa, 0xaa, 0xcd, 0x9b, 0x55, 0x00, 0x4b, 0x4f, 0x4d, 0x6c, 0x93, 0xa7, 0x98, 0x9f, 0xa3, 0x9f, 0x9f, 0x9f, 0x98, 0x9f, 0x98, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9e, 0x9f, 0x9a, 0x9f, 0x9b, 0x9b, 0x97, 0x98, 0x9b, 0x97, 0x95, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x97, 0x9e, 0x97, 0x97, 0x97, 0x97, 0x93, 0x97, 0x95, 0x9a, 0x9a, 0x9c, 0x9c, 0x9c, 0x97, 0x93, 0x97, 0x9a, 0x9a, 0x99, 0x9a, 0x99, 0x9a, 0x99, 0x9a, 0x9a, 0x95, 0x97, 0x97, 0x97, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x9b, 0x9b, 0x95, 0x97, 0x9a, 0x97, 0x93, 0x95, 0xa4, 0x8c, 0x5e, 0x52, 0x56, 0x56, 0x58, 0x56, 0x54, 0x56, 0x51, 0x4f, 0x4f, 0x4e, 0x4b, 0x4e, 0x4e, 0x4e, 0x49, 0x49, 0x4b, 0x49, 0x49, 0xf9, 0x49, 0xf9, 0x4b, 0x4e, 0x4f, 0x4b, 0x4d, 0x50, 0x76, 0xb6, 0xaf, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb4, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xf3, 0xf3, 0xfd, 0x16, 0x17, 0x1b, 0x17, 0x17, 0x1b, 0x17, 0x08, 0x27, 0x00, 0x4e, 0x00, 0x00, 0x4a, 0x65, 0x7f, 0x47, 0xf8, 0x01, 0x01, 0x25, 0x01, 0x25, 0x25, 0xf8, 0x01, 0x25, 0xec, 0x25, 0x01, 0x25, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x25, 0x25, 0xf8, 0x25, 0xeb, 0xdd, 0xaf, 0xaf, 0xb5, 0xb5, 0x5e, 0x4d, 0x4e, 0x4e, 0x00, 0x69, 0xa2, 0xa7, 0x97, 0x98, 0xa3, 0x9f, 0x9f, 0x9f, 0xa1, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9b, 0x9e, 0x9e, 0x9b, 0x9f, 0x9a, 0x9f, 0x9a, 0x9b, 0x97, 0x97, 0x9b, 0x97, 0x9b, 0x95, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x97, 0x9b, 0x97, 0x95, 0x95, 0x97, 0x97, 0x97, 0x97, 0x95, 0x9a, 0x95, 0x95, 0x95, 0x95, 0x97, 0x98, 0x97, 0x98, 0x97, 0x97, 0x95, 0x9a, 0x95, 0x95, 0x95, 0x95, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x9b, 0x9b, 0x95, 0x9b, 0x9b, 0x95, 0x9b, 0x97, 0x93, 0xa2, 0xa4, 0x85, 0x52, 0x55, 0x54, 0x59, 0x56, 0x53, 0x56, 0x56, 0x53, 0x4f, 0x00, 0x4e, 0x4f, 0x49, 0x4e, 0x4b, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0xf9, 0x4e, 0x4b, 0x4b, 0x4b, 0x4f, 0x4d, 0x50, 0x86, 0xb5, 0xb4, 0xb4, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb4, 0xad, 0xb4, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xb2, 0xb5, 0xf3, 0xf6, 0xfd, 0x16, 0x17, 0x1b, 0x17, 0x1b, 0x1a, 0x18, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x0a, 0xd4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0xf8, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x01, 0x01, 0x4c, 0xef, 0xe3, 0xab, 0xb5, 0xb5, 0xbc, 0x63, 0x4d, 0x4d, 0x50, 0x4d, 0x69, 0x8c, 0xab, 0x9b, 0x98, 0xa3, 0x98, 0x9f, 0xa1, 0xa1, 0x9a, 0xa2, 0x9b, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9b, 0x9e, 0x9e, 0x9e, 0x9e, 0x9b, 0x9b, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x9a, 0x9a, 0x9b, 0x93, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x95, 0x95, 0x9a, 0x95, 0x9a, 0x9a, 0x95, 0x95, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x97, 0x9b, 0x95, 0x9c, 0x9c, 0x7a, 0x55, 0x52, 0x56, 0x58, 0x56, 0x56, 0x57, 0x57, 0x51, 0x4f, 0x4e, 0x4e, 0x4b, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x49, 0xf9, 0x49, 0x49, 0x4e, 0x4e, 0x4f, 0x4b, 0x4b, 0x4d, 0x4d, 0x55, 0xa7, 0xb8, 0xb4, 0xb1, 0xb1, 0xb1, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb2, 0xb4, 0xb2, 0xb4, 0xb2, 0xb2, 0xb2, 0xb4, 0xb1, 0xb4, 0xb2, 0xb5, 0xb0, 0xf6, 0xfd, 0x17, 0x17, 0x19, 0x17, 0x1a, 0x16, 0x1c, 0x0b, 0x02, 0x49, 0x00, 0x4e, 0x4b, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x70, 0x96, 0xda, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0xf0, 0x4c, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x25, 0x01, 0xf8, 0xf0, 0xed, 0xc9, 0xa1, 0xbc, 0xba, 0x7c, 0x50, 0x4d, 0x4d, 0x4d, 0x5e, 0x8c, 0xa7, 0xa1, 0x98, 0xa3, 0xa3, 0xa3, 0x9e, 0xa1, 0xa2, 0x9e, 0x9a, 0xa2, 0x9a, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9e, 0x97, 0x9b, 0x9a, 0x9e, 0x9a, 0x9e, 0x95, 0x9a, 0x97, 0x9a, 0x95, 0x9a, 0x9a, 0x99, 0x9a, 0x99, 0x9a, 0x9a, 0x9a, 0x95, 0x97, 0x98, 0x97, 0x97, 0x97, 0x95, 0x9a, 0x9a, 0x95, 0x98, 0x98, 0x98, 0x93, 0x98, 0x93, 0x97, 0x95, 0x95, 0x9a, 0x9a, 0x9a, 0x9a, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x93, 0x97, 0x95, 0x92, 0xa4, 0x9d, 0x63, 0x54, 0x52, 0x5a, 0x56, 0x57, 0x57, 0x57, 0x57, 0x51, 0x4e, 0x00, 0x4f, 0x4b, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0x4f, 0x4b, 0x4b, 0x4b, 0x4e, 0x50, 0x4d, 0x69, 0xbc, 0xb8, 0xad, 0xb4, 0xb1, 0xb4, 0xb1, 0xb1, 0xb4, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb8, 0xb2, 0xb7, 0xb1, 0xb4, 0xb1, 0xb2, 0xb5, 0xf3, 0xf6, 0xfd, 0x17, 0x1b, 0x17, 0x1b, 0x1b, 0x1a, 0x1a, 0x09, 0xf9, 0x26, 0x49, 0xf9, 0x00, 0xf9, 0x4f, 0x4e, 0x00, 0x00, 0x00, 0x2c, 0xfb, 0x46, 0xde, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x01, 0x25, 0x25, 0x01, 0xf0, 0xeb, 0xd1, 0xa7, 0xbc, 0xbc, 0x92, 0x52, 0x00, 0x4d, 0x50, 0x55, 0x86, 0xa7, 0xa1, 0x98, 0xa3, 0x98, 0x98, 0xa3, 0x9f, 0xa1, 0x9f, 0xa1, 0x9e, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9f, 0x9a, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0x97, 0x95, 0x9a, 0x9a, 0x9a, 0x99, 0x9a, 0x9a, 0x9a, 0x95, 0x95, 0x97, 0x93, 0x97, 0x97, 0x97, 0x97, 0x9a, 0x9a, 0x95, 0x95, 0x92, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x9a, 0x9a, 0x95, 0x9a, 0x95, 0x95, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x93, 0x93, 0x9b, 0x9b, 0x9c, 0xa4, 0x7e, 0x5e, 0x52, 0x56, 0x57, 0x58, 0x54, 0x57, 0x57, 0x54, 0x51, 0x4e, 0x4e, 0x4b, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4f, 0x4b, 0x4b, 0x4f, 0x4f, 0x50, 0x4d, 0x92, 0xbc, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb4, 0xb7, 0xb2, 0xb7, 0xb7, 0xb7, 0xb2, 0xb4, 0xb1, 0xb1, 0xb1, 0xb7, 0xb5, 0xf3, 0xfd, 0x16, 0x1b, 0x1a, 0x15, 0x1b, 0x1b, 0x1a, 0x1c, 0x06, 0x00, 0x00, 0xf9, 0x00, 0x4e, 0x4d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x51, 0x2e, 0x7f, 0x47, 0xec, 0x01, 0x25, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0xf0, 0x01, 0xf0, 0x01, 0x25, 0x25, 0x01, 0x25, 0x25, 0x25, 0x01, 0x01, 0xed, 0xe5, 0xbc, 0xa7, 0xc3, 0xa9, 0x5e, 0x4d, 0x00, 0x4d, 0x50, 0x80, 0xa7, 0x9f, 0x9f, 0xa3, 0xa3, 0x98, 0xa3, 0x98, 0xa3, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9f, 0x9e, 0x9e, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0x9e, 0x9a, 0x9e, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x95, 0x9a, 0x9a, 0x9a, 0x95, 0x95, 0x9a, 0x9c, 0x9a, 0x9c, 0x95, 0x95, 0x97, 0x95, 0x97, 0x95, 0x9a, 0x9c, 0x99, 0x9c, 0x9c, 0x9a, 0x9c, 0x95, 0x9a, 0x95, 0x95, 0x9a, 0x95, 0x95, 0x95, 0x9b, 0x95, 0x97, 0x95, 0x97, 0x95, 0x95, 0x93, 0x95, 0x93, 0x95, 0x95, 0x93, 0x9e, 0x93, 0x93, 0x9b, 0x92, 0x9c, 0xae, 0x69, 0x54, 0x55, 0x57, 0x56, 0x57, 0x54, 0x57, 0x57, 0x53, 0x4f, 0x4e, 0x4e, 0x4e, 0x49, 0x4b, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x4f, 0x4f, 0x4b, 0x4b, 0x4b, 0x4f, 0x50, 0x4d, 0x63, 0xa7, 0xbc, 0xb4, 0xb4, 0xb1, 0xb4, 0xb1, 0xb1, 0xb4, 0xb1, 0xb7, 0xb4, 0xb4, 0xb2, 0xb4, 0xb7, 0xb2, 0xb7, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb7, 0xf3, 0xf6, 0xfd, 0x16, 0x17, 0x1b, 0x19, 0x19, 0x1b, 0x1a, 0x18, 0x05, 0x27, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0x96, 0xda, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x01, 0x4c, 0x01, 0x01, 0x25, 0xf8, 0x01, 0xf8, 0x01, 0x01, 0xf8, 0xf0, 0xeb, 0xcc, 0xab, 0xbc, 0xc3, 0x74, 0x4d, 0x4b, 0x4d, 0x00, 0x76, 0xb5, 0x9f, 0x9f, 0x9f, 0xa3, 0x98, 0xa3, 0x98, 0xa3, 0x98, 0x9f, 0x9f, 0xa3, 0x9f, 0x9f, 0x98, 0xa1, 0x9e, 0x9b, 0x9e, 0x9f, 0xa2, 0xa2, 0x93, 0x9a, 0xa2, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x97, 0x93, 0x97, 0x98, 0x97, 0x93, 0x95, 0x93, 0x92, 0x9a, 0x95, 0x98, 0x92, 0x92, 0x9c, 0x99, 0x92, 0x99, 0x93, 0x92, 0x93, 0xa2, 0x93, 0x93, 0x99, 0x9a, 0x99, 0x9a, 0x9a, 0x95, 0x9a, 0x95, 0x9b, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x95, 0x92, 0x9d, 0x5e, 0x50, 0x59, 0x57, 0x57, 0x56, 0x54, 0x57, 0x57, 0x54, 0x4e, 0x4e, 0x4f, 0x4f, 0x4e, 0x49, 0x4e, 0x4b, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4b, 0x4b, 0x4b, 0x50, 0x4d, 0x7c, 0xbc, 0xad, 0xb7, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb4, 0xb1, 0xb7, 0xb2, 0xb7, 0xb1, 0xb1, 0xb4, 0xb2, 0xb4, 0xb1, 0xb1, 0xb1, 0xb7, 0xb5, 0xf3, 0xf6, 0xfd, 0x17, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x18, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0xc1, 0xf8, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf8, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x25, 0x01, 0x25, 0x25, 0x01, 0x01, 0x01, 0xee, 0xf0, 0xd8, 0xaf, 0xaf, 0xb5, 0x92, 0x4d, 0x4d, 0x4d, 0x00, 0x63, 0xae, 0x9e, 0x9f, 0xa3, 0x9f, 0xa3, 0xa3, 0x98, 0xa3, 0x98, 0xa3, 0x9f, 0x9f, 0x97, 0x98, 0x98, 0x9f, 0x97, 0xa2, 0xa2, 0xa2, 0x9a, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0x99, 0xa5, 0x99, 0xa5, 0x9c, 0x9d, 0xa4, 0x9c, 0x9c, 0xa4, 0x9c, 0xa2, 0x9c, 0xa9, 0xa2, 0x9c, 0x93, 0x98, 0x9c, 0x9c, 0x99, 0xa5, 0x99, 0x99, 0xa2, 0xa4, 0x9b, 0x92, 0x8c, 0xa4, 0x9a, 0x99, 0x9b, 0x9a, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x95, 0x93, 0x95, 0x93, 0x95, 0x95, 0x93, 0x97, 0x93, 0x97, 0x93, 0x97, 0x95, 0x9c, 0xa4, 0x77, 0x55, 0x56, 0x56, 0x54, 0x57, 0x54, 0x57, 0x58, 0x54, 0x51, 0x4e, 0x4f, 0x4e, 0x4e, 0x4e, 0x4e, 0x4f, 0x49, 0x4b, 0x4e, 0x4f, 0x4e, 0x4f, 0x49, 0x28, 0x4b, 0x49, 0x50, 0x4d, 0x5e, 0x9b, 0xbf, 0xb4, 0xb2, 0xb7, 0xb1, 0xb1, 0xb1, 0xb4, 0xb1, 0xb4, 0xb2, 0xb7, 0xb1, 0xb1, 0xb1, 0xb4, 0xb2, 0xb8, 0xb4, 0xb1, 0xb1, 0xb1, 0xb8, 0xba, 0xf3, 0xf6, 0x16, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x17, 0x14, 0x2c, 0x28, 0x00, 0x49, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x89, 0xd4, 0x01, 0x01, 0x01, 0x01, 0xec, 0xf8, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x4c, 0x01, 0x01, 0x01, 0xec, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0xf8, 0xf0, 0x01, 0xef, 0xf0, 0xed, 0xbf, 0xaa, 0xb5, 0xb6, 0x5e, 0x00, 0x4d, 0x4d, 0x56, 0x8c, 0xb6, 0x98, 0xa3, 0xa1, 0xa3, 0x9f, 0xa3, 0xa3, 0xa3, 0x9f, 0x97, 0x9e, 0xa7, 0xa1, 0xa1, 0x9b, 0xa1, 0xa4, 0xa4, 0x9a, 0x99, 0x8c, 0x85, 0x7b, 0x79, 0x75, 0x73, 0xfb, 0x73, 0xfb, 0x70, 0x73, 0x75, 0x75, 0x75, 0x75, 0x79, 0x7a, 0x7e, 0x80, 0x80, 0x85, 0x86, 0x8c, 0x8c, 0x8c, 0x9d, 0x91, 0x99, 0x99, 0xa2, 0x92, 0x92, 0x9c, 0x9c, 0x9d, 0x91, 0x9c, 0x9a, 0x95, 0x95, 0x97, 0x97, 0x97, 0x98, 0x97, 0x97, 0x95, 0x95, 0x9c, 0x93, 0x95, 0x93, 0x95, 0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x93, 0x97, 0x97, 0x97, 0x97, 0x95, 0x95, 0x9c, 0x92, 0x63, 0x52, 0x54, 0x58, 0x56, 0x54, 0x57, 0x57, 0x57, 0x53, 0x4f, 0x4e, 0x4e, 0x4e, 0x4e, 0x4f, 0x49, 0x4b, 0x4e, 0x4f, 0x4e, 0x4f, 0x4b, 0x4b, 0x28, 0x49, 0x49, 0x53, 0x4d, 0x4d, 0x78, 0xb8, 0xaa, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb1, 0xb4, 0xb4, 0xb4, 0xb7, 0xb1, 0xb1, 0xb1, 0xb4, 0xb8, 0xb2, 0xb7, 0xb7, 0xb1, 0xb7, 0xb2, 0xb8, 0xae, 0xf3, 0xfd, 0x1a, 0x17, 0x17, 0x1a, 0x19, 0x1b, 0x17, 0x20, 0x09, 0x27, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xfb, 0x47, 0xe0, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x25, 0x01, 0x25, 0x01, 0x25, 0x4c, 0x01, 0x4c, 0xef, 0xf0, 0xd8, 0xa3, 0xb2, 0xbc, 0x7c, 0x4d, 0x4d, 0x4d, 0x4d, 0x78, 0xae, 0x98, 0xa3, 0xa3, 0xa3, 0x9f, 0xa3, 0xa3, 0x9f, 0x9f, 0xa1, 0xa2, 0x99, 0x99, 0x9d, 0xa5, 0xa4, 0x9d, 0x85, 0x78, 0x6c, 0x5e, 0x54, 0x4e, 0x00, 0x26, 0x29, 0x2b, 0x2b, 0x2a, 0x2a, 0x27, 0x26, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x50, 0x52, 0x59, 0x55, 0x5b, 0x5b, 0x67, 0x67, 0x71, 0x78, 0x7c, 0x86, 0x93, 0x92, 0x94, 0xa6, 0xf5, 0xa0, 0xf5, 0x94, 0x99, 0x9c, 0x9a, 0x95, 0x95, 0x95, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x95, 0x93, 0x95, 0x93, 0x95, 0x93, 0x95, 0x95, 0x93, 0x95, 0x93, 0x97, 0x97, 0x93, 0x95, 0xa4, 0x77, 0x55, 0x52, 0x5a, 0x58, 0x54, 0x56, 0x57, 0x56, 0x57, 0x51, 0x4e, 0x4e, 0x4e, 0x4f, 0x4e, 0x4e, 0x49, 0x49, 0x4e, 0x4f, 0x4e, 0x4f, 0x4e, 0x4b, 0xf9, 0x4b, 0x51, 0x51, 0x4d, 0x5e, 0xa3, 0xb8, 0xb8, 0xb2, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb4, 0xb4, 0xb1, 0xb1, 0xb4, 0xb7, 0xb8, 0xb7, 0xb2, 0xb4, 0xb1, 0xb4, 0xb8, 0xb5, 0xba, 0xf6, 0x17, 0xfd, 0x1a, 0x1a, 0x1b, 0x1b, 0x1b, 0x17, 0xff, 0x05, 0xf9, 0x02, 0xf9, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xf2, 0x8f, 0xd4, 0x01, 0x01, 0x01, 0x01, 0xf8, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x25, 0x25, 0x25, 0x01, 0x01, 0xf0, 0xef, 0xf0, 0xed, 0xb6, 0xa8, 0xaf, 0xa7, 0x59, 0x00, 0x00, 0x4d, 0x5e, 0x92, 0xab, 0xa3, 0x9f, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa2, 0x99, 0xa5, 0xa6, 0xa0, 0x96, 0xfb, 0x67, 0x55, 0x4d, 0x4d, 0x00, 0x00, 0x26, 0x26, 0x30, 0x36, 0x36, 0x34, 0x32, 0x3a, 0x3d, 0x38, 0x2b, 0x03, 0x34, 0x38, 0x34, 0x03, 0x26, 0x00, 0xf9, 0x49, 0x4d, 0x00, 0x4d, 0x00, 0x4d, 0x55, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x76, 0x81, 0xfc, 0x0d, 0x14, 0xfc, 0xfc, 0xf5, 0xf5, 0x94, 0x99, 0x9c, 0x9a, 0x95, 0x95, 0x95, 0x95, 0x93, 0x97, 0x93, 0x95, 0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x92, 0x95, 0x95, 0x97, 0x93, 0x97, 0x97, 0x92, 0xa2, 0x91, 0x5e, 0x56, 0x56, 0x57, 0x56, 0x54, 0x57, 0x57, 0x54, 0x54, 0x4f, 0x4f, 0x4e, 0x4f, 0x4f, 0x4e, 0x49, 0x49, 0x4e, 0x4f, 0x4f, 0x4f, 0x4b, 0x28, 0x4b, 0x28, 0x28, 0x51, 0x52, 0x52, 0x7c, 0xbc, 0xb8, 0xaa, 0xb7, 0xb4, 0xb7, 0xb1, 0xb7, 0xb1, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb7, 0xb8, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb2, 0xb7, 0xb5, 0xf6, 0xfd, 0xfd, 0x18, 0x17, 0x1b, 0x1b, 0x1b, 0x17, 0x1c, 0x14, 0x02, 0x02, 0x4a, 0x54, 0x28, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x5c, 0x7f, 0xd4, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x25, 0x01, 0x25, 0x25, 0x01, 0xee, 0x01, 0xef, 0xef, 0xef, 0xd6, 0xab, 0xb2, 0xad, 0x78, 0x4d, 0x00, 0x4e, 0x4f, 0x7c, 0xa1, 0x98, 0xaa, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0xa2, 0xa4, 0xa5, 0xf5, 0x83, 0x37, 0x31, 0x29, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x30, 0x36, 0x36, 0x32, 0x32, 0x32, 0x42, 0x45, 0x43, 0x38, 0x2f, 0x3b, 0x43, 0x43, 0x43, 0x38, 0x27, 0x26, 0xf9, 0x26, 0x00, 0x28, 0x28, 0x5b, 0x92, 0xa7, 0xa8, 0x90, 0x90, 0x7c, 0x74, 0x04, 0x14, 0x16, 0x17, 0x15, 0x16, 0x16, 0xfc, 0xfc, 0xf5, 0x99, 0x99, 0x9a, 0x95, 0x97, 0x97, 0x95, 0x93, 0x97, 0x95, 0x97, 0x95, 0x93, 0x97, 0x93, 0x97, 0x93, 0x97, 0x93, 0x9c, 0x95, 0x9c, 0x93, 0x97, 0x97, 0x98, 0x97, 0x97, 0x95, 0xa5, 0x77, 0x55, 0x54, 0x56, 0x57, 0x56, 0x54, 0x56, 0x57, 0x54, 0x53, 0x4f, 0x4e, 0x4f, 0x4e, 0x4e, 0x4b, 0x4b, 0x4b, 0x4f, 0x50, 0x4f, 0x51, 0x28, 0x28, 0x53, 0x28, 0x53, 0x53, 0x52, 0x63, 0xaf, 0xb5, 0xb8, 0xb2, 0xb2, 0xb7, 0xb7, 0xb1, 0xb7, 0xb4, 0xb7, 0xb7, 0xb2, 0xb8, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb7, 0xb5, 0xf3, 0xfd, 0xfd, 0x17, 0x17, 0x1a, 0x1a, 0x1b, 0x1b, 0x17, 0x20, 0x06, 0x28, 0x5a, 0x57, 0x5a, 0x4a, 0x53, 0x51, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x7d, 0xd4, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x4c, 0x01, 0x25, 0x25, 0x01, 0xef, 0xf0, 0xe3, 0xba, 0xa7, 0xb2, 0xa3, 0x55, 0x00, 0x4b, 0x00, 0x66, 0xa2, 0xa7, 0xa8, 0x98, 0xa8, 0x9f, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa2, 0xa6, 0xf5, 0xfc, 0x0b, 0x08, 0x34, 0x2b, 0x29, 0x00, 0x4e, 0xf9, 0x00, 0x26, 0x2b, 0x3a, 0x35, 0x32, 0x35, 0x35, 0x35, 0x42, 0x42, 0x45, 0x3b, 0x2b, 0x2f, 0x41, 0x10, 0x45, 0x0e, 0x34, 0x26, 0x26, 0x49, 0xf9, 0x00, 0x00, 0x76, 0xbf, 0xa3, 0x90, 0x90, 0x90, 0x90, 0x86, 0x6b, 0x0d, 0x15, 0x19, 0x19, 0x19, 0x17, 0x17, 0xfd, 0xfc, 0xf5, 0x99, 0x99, 0x95, 0x97, 0x98, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x95, 0x97, 0x97, 0x93, 0x97, 0x97, 0x92, 0xa4, 0xa4, 0x55, 0x55, 0x56, 0x57, 0x56, 0x54, 0x54, 0x54, 0x58, 0x53, 0x50, 0x4e, 0x4f, 0x4f, 0x4e, 0x28, 0x4b, 0x51, 0x51, 0x51, 0x53, 0x51, 0x53, 0x28, 0x57, 0x57, 0x54, 0x54, 0x52, 0x52, 0x86, 0xbc, 0xbf, 0xb2, 0xb7, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb8, 0xb8, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xf3, 0xf3, 0xfd, 0xfd, 0x1a, 0x1a, 0x17, 0x1b, 0x1b, 0x1b, 0x1a, 0x18, 0x04, 0x28, 0x5a, 0x57, 0x58, 0x59, 0x57, 0x5a, 0x57, 0x53, 0x4d, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x47, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x25, 0x25, 0xf0, 0xee, 0xee, 0x4c, 0x25, 0x24, 0x25, 0xf0, 0xef, 0xd3, 0xaa, 0xaa, 0xaf, 0x7c, 0x4d, 0x4d, 0x4d, 0x4d, 0x7c, 0xab, 0xa3, 0xa3, 0xa8, 0xa3, 0xa3, 0x9f, 0xa8, 0xa3, 0x98, 0xa3, 0xa4, 0xf5, 0x14, 0x15, 0x15, 0x0f, 0x3b, 0x32, 0x2b, 0x26, 0x26, 0x26, 0x00, 0x29, 0x34, 0x3a, 0x35, 0x35, 0x35, 0x32, 0x35, 0x42, 0x42, 0x3e, 0x3d, 0x2a, 0x32, 0x10, 0x0f, 0x0f, 0x11, 0x3e, 0x00, 0x26, 0x4d, 0x26, 0x4f, 0x00, 0x86, 0xb8, 0xa8, 0x90, 0xa3, 0x8e, 0x86, 0x8e, 0x74, 0x09, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x17, 0x16, 0x14, 0xf5, 0x99, 0x95, 0x98, 0x98, 0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x93, 0x97, 0x97, 0x93, 0x93, 0x9a, 0x9c, 0xa4, 0x74, 0x50, 0x56, 0x58, 0x54, 0x5a, 0x54, 0x58, 0x56, 0x56, 0x51, 0x50, 0x51, 0x51, 0x53, 0x53, 0x53, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x63, 0xbc, 0xb8, 0xb7, 0xb4, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb2, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb2, 0xb4, 0xb7, 0xb7, 0xb2, 0xb4, 0xb5, 0xf6, 0x16, 0x1a, 0x1b, 0x1a, 0x17, 0x1b, 0x1b, 0x17, 0x1d, 0x09, 0x28, 0x02, 0x56, 0x56, 0x56, 0x56, 0x5a, 0x5a, 0x5a, 0x56, 0x56, 0x50, 0x51, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xd4, 0x01, 0x01, 0x01, 0x01, 0xee, 0x01, 0x01, 0x01, 0xee, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x4c, 0xee, 0xee, 0x4c, 0x25, 0x24, 0x25, 0xef, 0xeb, 0xbc, 0xaa, 0xaa, 0xa7, 0x5e, 0x4d, 0x4d, 0x4d, 0x5f, 0x92, 0xa7, 0xa3, 0xa8, 0xa3, 0xa3, 0xa3, 0x9f, 0xa7, 0x9f, 0xa7, 0xa2, 0x81, 0xfb, 0x0e, 0x15, 0x19, 0x13, 0x3e, 0x32, 0x30, 0x2c, 0x00, 0x00, 0x27, 0x27, 0x39, 0x3d, 0x35, 0x35, 0x35, 0x35, 0x35, 0x42, 0x41, 0x3e, 0x34, 0x2a, 0x34, 0x11, 0x0f, 0x0f, 0x0f, 0x45, 0x2a, 0x26, 0x4d, 0x26, 0x4d, 0x54, 0x9f, 0xb7, 0x90, 0x90, 0x90, 0x8e, 0x8e, 0x8e, 0x6d, 0x09, 0x17, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x17, 0x16, 0xfc, 0xf5, 0x9c, 0x93, 0x98, 0x95, 0x95, 0x9a, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x97, 0x93, 0x97, 0x97, 0x97, 0x97, 0x95, 0x9a, 0x92, 0x93, 0xa5, 0x86, 0x55, 0x55, 0x58, 0x54, 0x57, 0x5a, 0x57, 0x54, 0x56, 0x56, 0x50, 0x51, 0x53, 0x53, 0x53, 0x51, 0x53, 0x53, 0x53, 0x53, 0x54, 0x51, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x55, 0x52, 0xa1, 0xbc, 0xad, 0xb7, 0xb4, 0xb7, 0xb2, 0xb8, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb7, 0xb4, 0xb7, 0xb2, 0xb7, 0xb7, 0xb4, 0xb2, 0xb4, 0xb1, 0xb8, 0xf6, 0xfd, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1b, 0x1b, 0x1c, 0x0d, 0x03, 0x02, 0x58, 0x59, 0x55, 0x56, 0x5a, 0x57, 0x5a, 0x56, 0x59, 0x58, 0x57, 0x57, 0x28, 0x51, 0x4b, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x96, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x25, 0x25, 0x4c, 0xee, 0xee, 0x4c, 0x25, 0x24, 0x01, 0xed, 0xdd, 0xaf, 0xaa, 0xb8, 0x86, 0x4d, 0x4d, 0x4d, 0x00, 0x76, 0xb6, 0xa1, 0xa3, 0xa8, 0xa3, 0xa3, 0xa1, 0xa7, 0xa1, 0xa7, 0xa9, 0x86, 0x75, 0xfa, 0x14, 0x15, 0x15, 0x1b, 0x42, 0x2b, 0x30, 0x37, 0x4a, 0x00, 0x28, 0x26, 0x39, 0x40, 0x3a, 0x35, 0x35, 0x35, 0x3b, 0x45, 0x11, 0x38, 0x2a, 0x27, 0x38, 0x11, 0x0f, 0x0f, 0x10, 0x11, 0x34, 0x00, 0x27, 0x26, 0x00, 0x5b, 0xb5, 0xa8, 0x8e, 0x90, 0x8e, 0x8e, 0x8e, 0x8e, 0x6d, 0x0b, 0x1a, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1a, 0x17, 0x14, 0xf5, 0x99, 0x9c, 0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x97, 0x95, 0x93, 0x97, 0x97, 0x93, 0x9e, 0x92, 0x92, 0xa4, 0xa4, 0x67, 0x50, 0x56, 0x57, 0x54, 0x5a, 0x57, 0x56, 0x56, 0x52, 0x54, 0x51, 0x53, 0x53, 0x53, 0x53, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x4d, 0x78, 0xb8, 0xb7, 0xb7, 0xb7, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb2, 0xb7, 0xb7, 0xb4, 0xb4, 0xb8, 0xf3, 0xfd, 0x17, 0x1a, 0x1a, 0x1b, 0x1b, 0x1b, 0x17, 0x1c, 0x18, 0x06, 0x02, 0x57, 0x59, 0x55, 0x58, 0x5a, 0x57, 0x57, 0x59, 0x55, 0x59, 0x5a, 0x5a, 0x5a, 0x57, 0x57, 0x54, 0x51, 0x4b, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x49, 0x79, 0xf8, 0x01, 0x01, 0xee, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x4c, 0x4c, 0x4c, 0x4c, 0x25, 0x25, 0xf0, 0xed, 0xc0, 0xa7, 0xaa, 0xbf, 0x69, 0x4d, 0x4d, 0x4d, 0x4d, 0x91, 0xab, 0xa3, 0xa8, 0xa3, 0xa8, 0xa3, 0xa1, 0xa3, 0x9f, 0xab, 0xa4, 0x7b, 0x69, 0x06, 0xfc, 0x16, 0x11, 0x15, 0x41, 0x29, 0x30, 0x7f, 0x2e, 0x4b, 0x4a, 0x00, 0x2a, 0x3d, 0x40, 0x3d, 0x3a, 0x3d, 0x43, 0x45, 0x43, 0x03, 0x26, 0x00, 0x0a, 0x11, 0x0e, 0x0f, 0x11, 0x18, 0x06, 0x26, 0x27, 0x27, 0x00, 0x64, 0xbf, 0xb1, 0x90, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x74, 0x0b, 0x1a, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1a, 0x16, 0xf5, 0xf5, 0x99, 0x95, 0x93, 0x95, 0x95, 0x95, 0x97, 0x93, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x95, 0x97, 0x97, 0x93, 0x95, 0x93, 0x95, 0x92, 0x92, 0xae, 0x7a, 0x50, 0x54, 0x59, 0x54, 0x5a, 0x54, 0x54, 0x56, 0x56, 0x52, 0x54, 0x51, 0x53, 0x53, 0x51, 0x53, 0x53, 0x53, 0x54, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x53, 0x54, 0x53, 0x52, 0x5e, 0xab, 0xbf, 0xb7, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb2, 0xb7, 0xb7, 0xb7, 0xb2, 0xb7, 0xb4, 0xb8, 0xf3, 0xf6, 0xfd, 0x17, 0x1b, 0x1a, 0x1b, 0x1b, 0x1a, 0x1a, 0x1c, 0x0b, 0x02, 0x57, 0x56, 0x56, 0x59, 0x5a, 0x5a, 0x5a, 0x56, 0x59, 0x56, 0x57, 0x57, 0x5c, 0x5a, 0x5a, 0x5a, 0x58, 0x54, 0x54, 0x51, 0x4b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x49, 0x00, 0x7f, 0x01, 0x01, 0xee, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x25, 0x25, 0x01, 0x4c, 0x4c, 0x01, 0x25, 0x25, 0xed, 0xe5, 0xaf, 0xaa, 0xb8, 0xa7, 0x00, 0x4d, 0x4e, 0x00, 0x60, 0xb6, 0x9e, 0xa3, 0xa8, 0xa8, 0xa3, 0xa3, 0xa3, 0xa7, 0x98, 0xa7, 0xa9, 0x7e, 0x6f, 0x79, 0xfc, 0x14, 0x14, 0x18, 0x0b, 0x26, 0x27, 0x2e, 0x5a, 0x00, 0x4e, 0x00, 0x26, 0x29, 0x34, 0x3d, 0x44, 0x40, 0x40, 0x40, 0x03, 0x00, 0xf9, 0x00, 0x37, 0x09, 0x43, 0x41, 0x41, 0x3d, 0x2f, 0x00, 0x27, 0x27, 0x00, 0x6b, 0xc9, 0xa8, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x86, 0x74, 0x0d, 0x1a, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1a, 0xfd, 0x0b, 0x99, 0x99, 0x98, 0x95, 0x97, 0x97, 0x97, 0x93, 0x97, 0x95, 0x97, 0x93, 0x97, 0x93, 0x97, 0x93, 0x97, 0x93, 0x97, 0x93, 0x97, 0x93, 0x97, 0x9e, 0x92, 0x9a, 0xa2, 0x92, 0xa4, 0x9c, 0x5b, 0x52, 0x59, 0x54, 0x5a, 0x54, 0x56, 0x56, 0x56, 0x56, 0x54, 0x53, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x53, 0x54, 0x53, 0x54, 0x54, 0x53, 0x59, 0x52, 0x86, 0xbf, 0xb8, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xbb, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xbb, 0xba, 0xf6, 0xfd, 0x16, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x16, 0xfa, 0x02, 0x58, 0x56, 0x59, 0x5a, 0x57, 0x57, 0x56, 0x56, 0x56, 0x59, 0x5a, 0x57, 0x58, 0x58, 0x58, 0x5a, 0x5a, 0x58, 0x5a, 0x58, 0x54, 0x51, 0x50, 0x4f, 0x4f, 0x4e, 0x4b, 0x4e, 0x00, 0x49, 0x00, 0xc1, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x01, 0x4c, 0x4c, 0x01, 0x25, 0xf0, 0xef, 0xcf, 0xb5, 0xa7, 0xbc, 0x7c, 0x00, 0xf9, 0x4d, 0x00, 0x78, 0xa9, 0xa8, 0xa3, 0xa8, 0xa8, 0xa8, 0xa7, 0xa3, 0xa8, 0xa8, 0xa7, 0xa7, 0x7e, 0x69, 0x7b, 0x99, 0xf5, 0xfc, 0xf5, 0x07, 0x00, 0x4e, 0x4a, 0x53, 0x4e, 0x4f, 0x49, 0x4b, 0x26, 0x27, 0x29, 0x2a, 0x2a, 0x2b, 0x02, 0x02, 0x54, 0x56, 0x52, 0x56, 0x2a, 0x2f, 0x2d, 0x03, 0x2a, 0x4a, 0x2c, 0x2c, 0x2c, 0xf9, 0x77, 0xc0, 0xa8, 0xb1, 0x90, 0x90, 0x90, 0x8e, 0x86, 0x78, 0x0b, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0xfc, 0x0b, 0x8d, 0x93, 0x98, 0x93, 0x97, 0x93, 0x97, 0x97, 0x93, 0x97, 0x93, 0x97, 0x95, 0x97, 0x93, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x95, 0x9b, 0x93, 0x9a, 0x92, 0x9c, 0x92, 0xa4, 0x71, 0x50, 0x56, 0x54, 0x5a, 0x54, 0x57, 0x56, 0x56, 0x56, 0x56, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x53, 0x53, 0x54, 0x53, 0x54, 0x54, 0x57, 0x53, 0x56, 0x52, 0x74, 0xb5, 0xb8, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbc, 0xb9, 0xf6, 0xfd, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1c, 0x06, 0x02, 0x5a, 0x56, 0x56, 0x57, 0x5a, 0x5a, 0x59, 0x56, 0x59, 0x5a, 0x5a, 0x58, 0x56, 0x58, 0x56, 0x58, 0x58, 0x58, 0x59, 0x58, 0x59, 0x5a, 0x56, 0x57, 0x56, 0xf2, 0x57, 0x4b, 0x51, 0x4e, 0x00, 0x70, 0xe6, 0x01, 0x01, 0xf8, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x25, 0x25, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0xf0, 0xef, 0xbc, 0xaf, 0xaf, 0xbf, 0x5e, 0x00, 0x4e, 0x4e, 0x4d, 0x92, 0xa7, 0xa7, 0xa8, 0xa8, 0xa8, 0xa3, 0xa3, 0xa7, 0xa3, 0x90, 0xab, 0xa2, 0x7e, 0x74, 0x80, 0x99, 0x99, 0xa6, 0xa6, 0x8f, 0x75, 0x79, 0x7f, 0x7f, 0x83, 0x83, 0x8f, 0x8f, 0x96, 0xa6, 0x44, 0xa6, 0x46, 0xb3, 0x46, 0xac, 0x47, 0xb0, 0xb9, 0xb0, 0x46, 0x47, 0x46, 0x46, 0x46, 0x47, 0xc1, 0x47, 0xac, 0x46, 0xf3, 0xd6, 0xb5, 0xaa, 0xaa, 0xaa, 0xa7, 0x93, 0x8c, 0x7e, 0xfc, 0x16, 0x17, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x12, 0x0b, 0x0a, 0x91, 0x93, 0x98, 0x97, 0x97, 0x95, 0x93, 0x93, 0x95, 0x9b, 0x97, 0x9b, 0x93, 0x93, 0x9b, 0x97, 0x95, 0x95, 0x93, 0x95, 0x95, 0x95, 0x93, 0x97, 0x93, 0x95, 0x93, 0x9c, 0x92, 0xa4, 0x7e, 0x52, 0x54, 0x56, 0x5d, 0x54, 0x58, 0x56, 0x58, 0x56, 0x56, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x53, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x57, 0x53, 0x55, 0x5e, 0xa7, 0xbc, 0xb8, 0xb4, 0xb7, 0xb4, 0xb7, 0xb4, 0xbb, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb8, 0xba, 0xf6, 0xfd, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x1b, 0x1c, 0x0d, 0x03, 0x57, 0x58, 0x56, 0x58, 0x5a, 0x5a, 0x56, 0x59, 0x56, 0x58, 0x5a, 0x58, 0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x58, 0x59, 0x58, 0x5a, 0x5d, 0x61, 0x5a, 0x4e, 0x4f, 0x4e, 0x4b, 0xb3, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0xf0, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0xf8, 0x4c, 0x01, 0x01, 0xf0, 0xef, 0xdd, 0xab, 0xb2, 0xaf, 0xa1, 0x52, 0x4f, 0x4e, 0x4d, 0x55, 0xab, 0x9f, 0xa8, 0xa3, 0xa8, 0xa3, 0xa8, 0xa7, 0xa7, 0xa8, 0xa7, 0xb5, 0xba, 0x99, 0x91, 0xa9, 0x9c, 0xa0, 0x99, 0x8f, 0x8f, 0x88, 0x8f, 0x89, 0x89, 0x83, 0x83, 0x81, 0x89, 0x83, 0x0a, 0x83, 0x0a, 0x0a, 0x83, 0x89, 0x0a, 0x83, 0x89, 0x82, 0x87, 0x83, 0x0a, 0x0a, 0x0a, 0x89, 0x89, 0x89, 0x89, 0x8f, 0x96, 0x96, 0x91, 0x9c, 0x9d, 0x9c, 0x91, 0xa4, 0xae, 0xa9, 0xa6, 0x14, 0x18, 0x17, 0x16, 0x15, 0x12, 0x15, 0x15, 0x12, 0x0e, 0xfc, 0x46, 0xb0, 0x9c, 0x98, 0x92, 0x95, 0x95, 0x95, 0x93, 0x93, 0x92, 0x92, 0x95, 0x9b, 0x95, 0x9b, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x93, 0x97, 0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x9c, 0x8b, 0x5e, 0x52, 0x58, 0x5a, 0x57, 0x57, 0x58, 0x56, 0x56, 0x56, 0x54, 0x53, 0x54, 0x53, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x53, 0x54, 0x53, 0x54, 0x52, 0x5b, 0x8c, 0xbc, 0xb8, 0xb7, 0xb4, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbc, 0xf3, 0xfd, 0x17, 0x1b, 0x1b, 0x1b, 0x1a, 0x1b, 0x1b, 0x1a, 0xfd, 0x03, 0x02, 0x56, 0x59, 0x58, 0x57, 0x5a, 0x58, 0x56, 0x58, 0x58, 0x58, 0x58, 0x59, 0x58, 0x59, 0x58, 0x59, 0x58, 0x59, 0x58, 0x59, 0x58, 0x59, 0x58, 0x56, 0x59, 0xf1, 0x58, 0x54, 0x51, 0x51, 0x00, 0x79, 0xf8, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x25, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0xef, 0xd3, 0xa8, 0xb8, 0xaf, 0x7c, 0x52, 0x4d, 0x00, 0x00, 0x63, 0xab, 0xa7, 0xaa, 0xaa, 0xa8, 0xa3, 0xa7, 0xab, 0xb6, 0xb6, 0xb6, 0x9d, 0x7f, 0x75, 0x6a, 0x5b, 0x56, 0x55, 0x53, 0x28, 0xf9, 0x4e, 0x4f, 0x28, 0x4f, 0x4e, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0xf9, 0xf9, 0xf9, 0x4f, 0x4b, 0x4a, 0x58, 0x5a, 0x5a, 0x04, 0x37, 0x06, 0x0b, 0x0d, 0x18, 0x18, 0x17, 0x14, 0x16, 0x14, 0x0d, 0x89, 0x89, 0x8c, 0x9d, 0xae, 0x9c, 0x92, 0x92, 0x9c, 0x92, 0x8c, 0x95, 0x92, 0x95, 0x93, 0x93, 0x97, 0x9a, 0x95, 0x95, 0x95, 0x95, 0x97, 0x93, 0x97, 0x93, 0x95, 0x95, 0x95, 0x95, 0x9c, 0x9c, 0x67, 0x55, 0x57, 0x58, 0x57, 0x58, 0x58, 0x56, 0x56, 0x56, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x53, 0x57, 0x53, 0x52, 0x78, 0xba, 0xb8, 0xb7, 0xb7, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb8, 0xb9, 0xf6, 0x17, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a, 0x1b, 0x1a, 0x1c, 0x05, 0x02, 0x56, 0x56, 0x58, 0x5a, 0x5a, 0x56, 0x59, 0x56, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x56, 0x5a, 0x5f, 0x5d, 0x56, 0x54, 0x54, 0x4b, 0x5a, 0x48, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x4c, 0x01, 0x01, 0xf0, 0xef, 0xeb, 0xc0, 0xb2, 0xb2, 0xb8, 0x69, 0x50, 0x00, 0x4d, 0x4d, 0x7c, 0xb6, 0xa1, 0xab, 0xa7, 0xab, 0xb6, 0xab, 0x85, 0x78, 0x5e, 0x52, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x4d, 0x00, 0xf9, 0xf9, 0x26, 0x26, 0xf9, 0xf9, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0x49, 0x4d, 0xf9, 0x00, 0x49, 0x00, 0x26, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x2a, 0xfa, 0x05, 0x06, 0x05, 0x03, 0x02, 0x00, 0x00, 0x00, 0x52, 0x5e, 0x7e, 0x9d, 0xa5, 0x91, 0x92, 0xa4, 0x9c, 0x92, 0x92, 0x95, 0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x93, 0x93, 0x93, 0x93, 0x95, 0x93, 0x95, 0x92, 0x9c, 0xa9, 0x77, 0x52, 0x56, 0x58, 0x57, 0x57, 0x58, 0x56, 0x56, 0x58, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x28, 0x5a, 0x51, 0x50, 0x69, 0xb5, 0xbc, 0xb7, 0xb7, 0xb4, 0xbb, 0xb7, 0xbb, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb8, 0xba, 0xf6, 0xfd, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1c, 0x0b, 0x02, 0x56, 0x59, 0x56, 0x5a, 0x5a, 0x58, 0x56, 0x59, 0x56, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5d, 0x5d, 0x5a, 0x57, 0x58, 0x53, 0x00, 0x89, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0xf0, 0x4c, 0x25, 0xf0, 0xef, 0xeb, 0xaf, 0xb4, 0xb4, 0x98, 0x5e, 0x50, 0x53, 0x00, 0x4d, 0x85, 0xb6, 0x9c, 0x92, 0x80, 0x74, 0x5e, 0x50, 0x4d, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x4d, 0x26, 0x00, 0x26, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x26, 0x00, 0x00, 0xf9, 0x28, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0xf9, 0x27, 0xf9, 0xf9, 0x00, 0xf9, 0xf9, 0x00, 0x00, 0x4d, 0x4d, 0x55, 0x71, 0x87, 0x9d, 0x9d, 0x92, 0x92, 0x95, 0x9a, 0x9b, 0x92, 0x93, 0x95, 0x92, 0x95, 0x93, 0x95, 0x93, 0x93, 0x93, 0x95, 0x93, 0x95, 0x93, 0x95, 0xa9, 0x80, 0x55, 0x56, 0x57, 0x5a, 0x58, 0x58, 0x56, 0x58, 0x56, 0x57, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x54, 0x4a, 0x53, 0x57, 0x54, 0x51, 0x5e, 0xa2, 0xbc, 0xbb, 0xb7, 0xb7, 0xb7, 0xbb, 0xb8, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xb7, 0xb4, 0xbb, 0xb8, 0xba, 0xf6, 0xfd, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1c, 0x14, 0x02, 0x57, 0x56, 0x59, 0x5a, 0x57, 0x58, 0x58, 0x56, 0x59, 0x56, 0x58, 0x5a, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x5f, 0x59, 0x56, 0x57, 0x51, 0x4e, 0xf2, 0xe6, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0xf0, 0xef, 0xd8, 0xaf, 0xad, 0xb4, 0x86, 0x55, 0x5d, 0x5c, 0x59, 0x5f, 0x76, 0x71, 0x5e, 0x52, 0x4d, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x26, 0x26, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x26, 0x00, 0x00, 0xf9, 0xf9, 0x4e, 0x26, 0x00, 0x49, 0x49, 0x49, 0xf9, 0x4e, 0xf9, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x52, 0x71, 0x85, 0x9c, 0xa4, 0x92, 0x92, 0x93, 0x9a, 0x92, 0x9a, 0x92, 0x95, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x95, 0x92, 0x95, 0x92, 0xa4, 0x8d, 0x5e, 0x54, 0x58, 0x5a, 0x57, 0x57, 0x56, 0x56, 0x58, 0x56, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x4a, 0x53, 0x57, 0x52, 0x55, 0x86, 0xbc, 0xbb, 0xb7, 0xbb, 0xb7, 0xb8, 0xb8, 0xbb, 0xb7, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xb7, 0xb4, 0xb7, 0xbb, 0xba, 0xf3, 0xfd, 0x17, 0x1b, 0x19, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x18, 0x04, 0x54, 0x59, 0x56, 0x5a, 0x5a, 0x58, 0x56, 0x59, 0x56, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5a, 0x58, 0x5a, 0x58, 0x5a, 0x58, 0x58, 0x59, 0x56, 0x58, 0x5f, 0x5d, 0x57, 0x56, 0x53, 0x57, 0x28, 0xc1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0xf0, 0xef, 0xc9, 0xaf, 0xad, 0xb2, 0x7c, 0x74, 0x73, 0x5c, 0x4a, 0x50, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4d, 0x4d, 0x4d, 0x00, 0x00, 0x00, 0x26, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x4d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4e, 0x4e, 0x4e, 0x4d, 0x00, 0x4d, 0x4e, 0x4d, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x4d, 0x55, 0x76, 0x8c, 0x9c, 0x92, 0x95, 0x9a, 0x93, 0x92, 0x95, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x95, 0x93, 0x92, 0xa2, 0xa4, 0x60, 0x55, 0x57, 0x5a, 0x57, 0x56, 0x57, 0x56, 0x58, 0x57, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x53, 0x54, 0x54, 0x53, 0x57, 0x49, 0x5a, 0x51, 0x52, 0x78, 0xb5, 0xbb, 0xbb, 0xb7, 0xb7, 0xb8, 0xb8, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb4, 0xbb, 0xb7, 0xb8, 0xb5, 0xf3, 0xfd, 0x18, 0x1b, 0x1b, 0x19, 0x1b, 0x1a, 0x1b, 0x1a, 0x20, 0xfa, 0x28, 0x59, 0x56, 0x58, 0x5a, 0x58, 0x58, 0x56, 0x59, 0x56, 0x5a, 0x58, 0x5a, 0x58, 0x5a, 0x5a, 0x58, 0x5a, 0x58, 0x5a, 0x58, 0x58, 0x58, 0x59, 0x56, 0x58, 0x5f, 0x5f, 0x56, 0x5a, 0x57, 0x54, 0x4e, 0x89, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0x4c, 0x25, 0x01, 0xef, 0xed, 0xbc, 0xb2, 0xb5, 0xa7, 0x71, 0x5f, 0x28, 0x4d, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x50, 0x4e, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4b, 0x4e, 0x00, 0x00, 0x4d, 0x00, 0x4d, 0x4d, 0x00, 0x4d, 0x5f, 0x85, 0xa5, 0x9c, 0x92, 0x93, 0x95, 0x95, 0x93, 0x95, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x9c, 0xae, 0x71, 0x52, 0x59, 0x57, 0x58, 0x57, 0x58, 0x58, 0x58, 0x56, 0x58, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x4a, 0x53, 0x56, 0x50, 0x6c, 0xb5, 0xb8, 0xb7, 0xb7, 0xbb, 0xb2, 0xbb, 0xbb, 0xb7, 0xb7, 0xbb, 0xb7, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xb7, 0xbb, 0xb8, 0xbc, 0xbe, 0xf6, 0xfd, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1c, 0x09, 0x28, 0x57, 0x59, 0x58, 0x58, 0x5a, 0x5a, 0x58, 0x56, 0x58, 0x58, 0x5a, 0x58, 0x5a, 0x58, 0x58, 0x5a, 0x58, 0x5a, 0x58, 0x58, 0x58, 0x5a, 0x59, 0x56, 0x58, 0x5d, 0x5d, 0x5d, 0x5a, 0x5a, 0x53, 0x4f, 0xf2, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0xf0, 0x25, 0x25, 0x4c, 0xef, 0xdd, 0xb8, 0xaf, 0xc0, 0x74, 0x51, 0x00, 0x00, 0x00, 0x4d, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x5c, 0xf2, 0x73, 0xfb, 0x0a, 0x94, 0x96, 0xac, 0x47, 0xcb, 0xcb, 0xd4, 0xd4, 0xda, 0xda, 0xdb, 0xdb, 0xde, 0xda, 0xd4, 0xcb, 0x47, 0xa6, 0xa0, 0x8f, 0x79, 0xfb, 0x6e, 0x2e, 0x54, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x4f, 0x49, 0x49, 0x00, 0x00, 0x26, 0x49, 0x4b, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x4e, 0x00, 0x00, 0x59, 0x7a, 0x9c, 0x9c, 0x92, 0x93, 0x93, 0x93, 0x95, 0x93, 0x95, 0x92, 0x95, 0x92, 0x95, 0x92, 0x93, 0x92, 0x9c, 0xb6, 0x7a, 0x52, 0x59, 0x56, 0x5a, 0x57, 0x57, 0x58, 0x57, 0x56, 0x58, 0x54, 0x53, 0x53, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4a, 0x57, 0x53, 0x57, 0x52, 0x5e, 0xab, 0xbc, 0xb8, 0xb7, 0xbb, 0xb4, 0xbb, 0xb7, 0xbb, 0xb7, 0xb7, 0xb8, 0xb7, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xbb, 0xb7, 0xb8, 0xb8, 0xb8, 0xba, 0xf6, 0xfd, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1d, 0x0d, 0x02, 0x57, 0x59, 0x56, 0x58, 0x5a, 0x5a, 0x5a, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5d, 0x5f, 0x5d, 0x57, 0x57, 0x5a, 0x54, 0x51, 0xcb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0xf0, 0xef, 0xd8, 0xaf, 0xbc, 0x9c, 0x50, 0x00, 0x00, 0x4e, 0x51, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x54, 0x5c, 0x70, 0x79, 0x89, 0xac, 0xcb, 0xdb, 0xe4, 0xef, 0xf0, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0xef, 0xe7, 0xda, 0xb9, 0x96, 0x79, 0x65, 0x5c, 0xf9, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x28, 0x49, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x56, 0x80, 0x9c, 0x95, 0x93, 0x95, 0x95, 0x93, 0x95, 0x93, 0x95, 0x92, 0x95, 0x93, 0x93, 0x93, 0x93, 0x9c, 0xae, 0x8c, 0x52, 0x5b, 0x58, 0x58, 0x5a, 0x57, 0x58, 0x58, 0x58, 0x56, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x57, 0x57, 0x53, 0x57, 0x52, 0x52, 0xa2, 0xbf, 0xb8, 0xb7, 0xbb, 0xb2, 0xbb, 0xb7, 0xb7, 0xb7, 0xbb, 0xb7, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb8, 0xbb, 0xb8, 0xbc, 0xf6, 0xfd, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1c, 0xfd, 0x02, 0x5a, 0x58, 0x58, 0x58, 0x5a, 0x5a, 0x58, 0x58, 0x56, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x58, 0x58, 0x5d, 0x5f, 0x5d, 0x58, 0x53, 0x5c, 0x54, 0x00, 0x89, 0x01, 0x01, 0x4c, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x01, 0x25, 0x4c, 0xef, 0xd3, 0xb5, 0xbc, 0x74, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x65, 0x73, 0x89, 0xac, 0xcb, 0xdb, 0x4c, 0x01, 0x01, 0xf0, 0xf0, 0xeb, 0xeb, 0xe3, 0xe3, 0xd8, 0xd5, 0xd1, 0xce, 0xc7, 0xce, 0xc0, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc6, 0xc6, 0xc7, 0xce, 0xd1, 0xd5, 0xd6, 0xd8, 0xd5, 0xdd, 0xdd, 0xeb, 0xe5, 0xeb, 0xef, 0xf0, 0x01, 0xef, 0xd7, 0xa6, 0x83, 0x65, 0x4d, 0x00, 0x00, 0x49, 0x28, 0xf9, 0x49, 0xf9, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4b, 0x00, 0x4f, 0x4e, 0x00, 0x5e, 0x85, 0x9c, 0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x92, 0x95, 0x92, 0x93, 0x93, 0x93, 0x92, 0x9c, 0xae, 0xa4, 0x52, 0x59, 0x58, 0x58, 0x5a, 0x57, 0x5a, 0x58, 0x56, 0x59, 0x56, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x57, 0x57, 0x53, 0x54, 0x56, 0x50, 0x86, 0xc3, 0xb8, 0xbb, 0xb7, 0xb7, 0xbb, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xb7, 0xbb, 0xbb, 0xb8, 0xba, 0xf3, 0xfd, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x18, 0x03, 0x02, 0x58, 0x58, 0x59, 0x5a, 0x5a, 0x5a, 0x58, 0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x58, 0x59, 0x5f, 0x5d, 0x58, 0x5a, 0x58, 0x57, 0x4f, 0xf2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf0, 0x01, 0x25, 0xf0, 0xed, 0xce, 0xbc, 0xa2, 0x52, 0x00, 0x00, 0x49, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x5c, 0xfb, 0x96, 0xbd, 0xde, 0xef, 0xf0, 0x01, 0xef, 0xed, 0xe5, 0xdc, 0xd1, 0xc4, 0xba, 0xb6, 0xb6, 0xab, 0xab, 0xab, 0xa7, 0xa1, 0xa1, 0xa1, 0x98, 0x9f, 0x97, 0x97, 0x97, 0x97, 0x9f, 0xa1, 0xa7, 0xa7, 0xa7, 0xa1, 0xa1, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xab, 0xb5, 0xb5, 0xb5, 0xbc, 0xc0, 0xc6, 0xd1, 0xdd, 0xe5, 0xed, 0xef, 0xf0, 0xdb, 0xb3, 0x75, 0x4e, 0x00, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x4f, 0x51, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x4e, 0x49, 0x00, 0x49, 0x4e, 0x00, 0x4d, 0x76, 0x9c, 0x95, 0x92, 0x93, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x9c, 0xa9, 0xae, 0x55, 0x55, 0x58, 0x5a, 0x58, 0x5a, 0x58, 0x58, 0x58, 0x59, 0x57, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x57, 0x53, 0x53, 0x57, 0x55, 0x4d, 0x78, 0xc8, 0xb8, 0xb8, 0xb7, 0xb8, 0xbb, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xb7, 0xb7, 0xbb, 0xbb, 0xbb, 0xbc, 0xf3, 0xfd, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x17, 0xff, 0xfa, 0x02, 0x5a, 0x59, 0x58, 0x59, 0x5a, 0x59, 0x58, 0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5d, 0x58, 0x59, 0x5d, 0x61, 0x59, 0x5a, 0x58, 0x5a, 0x53, 0x00, 0xe0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0xf0, 0x01, 0x25, 0x4c, 0xeb, 0xc6, 0xc0, 0x80, 0x4d, 0x00, 0x00, 0x49, 0x49, 0x00, 0x00, 0x00, 0x70, 0xa6, 0xda, 0xec, 0xf0, 0xf0, 0xf0, 0xe5, 0xd8, 0xc7, 0xc0, 0xb6, 0xab, 0x9c, 0xa2, 0xab, 0xab, 0xa7, 0xa7, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0x98, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xaa, 0xa7, 0xa7, 0xaa, 0xaa, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xaa, 0xaa, 0xaa, 0xa7, 0xa3, 0xaf, 0xa7, 0xab, 0xae, 0xb6, 0xba, 0xd1, 0xd8, 0xeb, 0xf0, 0xea, 0xb3, 0x5c, 0x00, 0x28, 0x00, 0x4e, 0x4b, 0x00, 0x00, 0x00, 0x51, 0x65, 0x89, 0xac, 0xb9, 0x47, 0xac, 0xa0, 0x7f, 0x65, 0x4f, 0x00, 0x00, 0x00, 0xf9, 0x49, 0x00, 0x53, 0x00, 0x5b, 0x85, 0x95, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x95, 0x92, 0x93, 0x93, 0x95, 0x92, 0x9b, 0xae, 0xb6, 0x63, 0x52, 0x58, 0x58, 0x5a, 0x58, 0x58, 0x58, 0x59, 0x56, 0x58, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x57, 0x53, 0x57, 0x54, 0x56, 0x52, 0x69, 0xc5, 0xbc, 0xbb, 0xb8, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xb7, 0xb7, 0xbb, 0xbb, 0xbb, 0xb5, 0xf3, 0xfd, 0x1a, 0x1a, 0x1b, 0x1a, 0x1b, 0x1b, 0x1b, 0x1c, 0x18, 0x06, 0x02, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x58, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x58, 0x5f, 0x61, 0x58, 0x58, 0x57, 0x5d, 0x57, 0x4e, 0xa0, 0xee, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0xe3, 0xc4, 0xbc, 0x69, 0x00, 0x4e, 0x26, 0x00, 0x00, 0x28, 0x7f, 0xda, 0x01, 0x01, 0xf0, 0xeb, 0xdd, 0xce, 0xb6, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xaf, 0xaf, 0xa7, 0xa7, 0xa3, 0xaf, 0xaf, 0xa7, 0xa3, 0xa7, 0xaf, 0xb8, 0xb8, 0xbf, 0xc5, 0xbf, 0xc5, 0xbf, 0xbf, 0xb8, 0xbf, 0xbf, 0xbf, 0xaf, 0xa8, 0xa8, 0xa8, 0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf, 0xab, 0xab, 0xab, 0xab, 0xb6, 0xdd, 0xe3, 0x01, 0xcb, 0x2c, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x00, 0x5d, 0xa0, 0xe8, 0xf0, 0xeb, 0xeb, 0xef, 0xed, 0xed, 0xef, 0xed, 0xd2, 0x8a, 0x5d, 0x00, 0x00, 0xf9, 0x00, 0x28, 0x00, 0x00, 0x7a, 0x9c, 0x92, 0x92, 0x93, 0x92, 0x93, 0x93, 0x93, 0x93, 0x95, 0x92, 0x93, 0x92, 0x9c, 0xb6, 0xba, 0x71, 0x52, 0x56, 0x58, 0x58, 0x5a, 0x58, 0x58, 0x59, 0x59, 0x58, 0x56, 0x53, 0x53, 0x54, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x5a, 0x51, 0x5a, 0x53, 0x56, 0x52, 0x63, 0xc0, 0xb8, 0xbc, 0xbb, 0xb8, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xbb, 0xb7, 0xbb, 0xbb, 0xb7, 0xb7, 0xbb, 0xbb, 0xb7, 0xbc, 0xf3, 0xfe, 0x17, 0x1b, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1c, 0x0b, 0x02, 0x5a, 0x58, 0x59, 0x59, 0x59, 0x59, 0x58, 0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x58, 0x5f, 0x61, 0x59, 0x5a, 0x58, 0x54, 0x56, 0x57, 0x5d, 0x89, 0x96, 0xc1, 0xe9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xec, 0xe8, 0xc0, 0xae, 0x52, 0x00, 0x00, 0x00, 0x00, 0x73, 0xdb, 0x01, 0xf0, 0xe5, 0xd8, 0xb6, 0xab, 0xa1, 0xa7, 0xa7, 0xaa, 0xa7, 0xaf, 0xaa, 0xad, 0xa8, 0xaa, 0xaa, 0xad, 0xaa, 0xaa, 0xa7, 0xaa, 0xaf, 0xbf, 0xc8, 0xcd, 0xcd, 0xd0, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd0, 0xcd, 0xcd, 0xcd, 0xcd, 0xbf, 0xb8, 0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xb2, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xb2, 0xaf, 0xaf, 0xa3, 0xb6, 0xc0, 0xe3, 0x01, 0x89, 0x00, 0x00, 0x28, 0x00, 0x4e, 0x54, 0xac, 0xed, 0xeb, 0xe5, 0xe3, 0xdd, 0xd8, 0xd8, 0xd9, 0xe3, 0xe3, 0xed, 0xf0, 0xd9, 0x83, 0x53, 0x28, 0x49, 0xf9, 0x53, 0x00, 0x5b, 0x9c, 0x92, 0x95, 0x92, 0x95, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x92, 0x92, 0x93, 0xba, 0xba, 0x7a, 0x50, 0x58, 0x59, 0x5a, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x58, 0x54, 0x54, 0x51, 0x56, 0x54, 0x56, 0x54, 0x54, 0x54, 0x54, 0x56, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x55, 0xbc, 0xbc, 0xb8, 0xb8, 0xb8, 0xb8, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb8, 0xf3, 0xfd, 0xfd, 0x1b, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1e, 0x18, 0x0d, 0x02, 0x02, 0x5b, 0x59, 0x59, 0x59, 0x59, 0x59, 0x58, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x58, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x58, 0x59, 0x58, 0x61, 0x5d, 0x58, 0x56, 0x5d, 0x57, 0x58, 0x5a, 0x51, 0x4e, 0x54, 0x5d, 0x70, 0xfb, 0x83, 0x8f, 0xa6, 0xc1, 0xda, 0xe0, 0xea, 0xee, 0xf0, 0x01, 0x01, 0x01, 0xee, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0xf0, 0xe3, 0xc4, 0x8c, 0x4d, 0x00, 0x28, 0x00, 0x7f, 0xed, 0xf0, 0xe3, 0xc0, 0xb6, 0xa2, 0xa1, 0xa7, 0xa7, 0xaa, 0xa8, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xb1, 0xb1, 0xad, 0xa8, 0xaa, 0xaa, 0xaf, 0xbf, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xc8, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xc8, 0xcc, 0xc8, 0xcd, 0xcd, 0xc5, 0xbf, 0xb8, 0xb2, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb2, 0xb2, 0xad, 0xad, 0xb2, 0xb2, 0xb2, 0xaa, 0xaf, 0xaa, 0xab, 0xd1, 0xed, 0xac, 0x00, 0x4b, 0x4e, 0x00, 0x4d, 0x72, 0xdc, 0xeb, 0xdd, 0xc7, 0xc0, 0xc0, 0xc0, 0xba, 0xc0, 0xc4, 0xc0, 0xc7, 0xd8, 0xeb, 0xf0, 0xa6, 0x5c, 0xf9, 0xf9, 0xf9, 0x4e, 0x55, 0x85, 0x9c, 0x92, 0x95, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x92, 0x92, 0x9c, 0xb6, 0xbe, 0x80, 0x50, 0x59, 0x59, 0x5d, 0x58, 0x5d, 0x59, 0x59, 0x59, 0x59, 0x58, 0x56, 0x54, 0x54, 0x54, 0x54, 0x54, 0x56, 0x54, 0x56, 0x54, 0x54, 0x54, 0x56, 0x57, 0x57, 0x57, 0x56, 0x55, 0x52, 0xb6, 0xbc, 0xbc, 0xb8, 0xb8, 0xbc, 0xbb, 0xb8, 0xbb, 0xbf, 0xbb, 0xb8, 0xbb, 0xb8, 0xbb, 0xb8, 0xbb, 0xb8, 0xbb, 0xbb, 0xb8, 0xbb, 0xbb, 0xbb, 0xbf, 0xf3, 0xfe, 0x17, 0x1a, 0x1a, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a, 0x1d, 0x0d, 0x03, 0x5c, 0x58, 0x5b, 0x55, 0x59, 0x59, 0x59, 0x58, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x58, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5b, 0x58, 0x5b, 0x59, 0x62, 0x5f, 0x5a, 0x59, 0x5d, 0x58, 0x58, 0x5f, 0x5f, 0x5d, 0x5a, 0x54, 0x53, 0x51, 0x51, 0x4f, 0x51, 0x54, 0xf1, 0x6a, 0x79, 0x83, 0x96, 0xb3, 0xcb, 0xe6, 0x01, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0xd9, 0xc0, 0x76, 0x50, 0x00, 0x00, 0x2e, 0xda, 0xf0, 0xd5, 0xab, 0xa2, 0xa7, 0xa7, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xad, 0xad, 0xa8, 0xb1, 0xad, 0xa8, 0xa8, 0xad, 0xb2, 0xbf, 0xc8, 0xcd, 0xcf, 0xcd, 0xc8, 0xc6, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xce, 0xcc, 0xcc, 0xcc, 0xc6, 0xcd, 0xcd, 0xcd, 0xc5, 0xc5, 0xb8, 0xaf, 0xaf, 0xaf, 0xb2, 0xaf, 0xaf, 0xaa, 0xb2, 0xad, 0xb2, 0xad, 0xb4, 0xad, 0xad, 0xb7, 0xaa, 0xa7, 0xc0, 0xeb, 0xcb, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xed, 0xd8, 0xc7, 0xba, 0xba, 0xc0, 0xc3, 0xbc, 0xc0, 0xba, 0xc0, 0xc0, 0xc0, 0xc7, 0xe5, 0xef, 0xa6, 0x28, 0xf9, 0x53, 0x51, 0x4d, 0x7a, 0x9c, 0x92, 0x9c, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0xa2, 0xba, 0xc0, 0x8d, 0x52, 0x56, 0x59, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x58, 0x57, 0x54, 0x54, 0x54, 0x54, 0x56, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x4d, 0xa7, 0xbc, 0xbc, 0xb8, 0xbf, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xbb, 0xbb, 0xb8, 0xf3, 0xf6, 0x17, 0x17, 0x1a, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a, 0x1c, 0xfc, 0x03, 0x02, 0x5b, 0x56, 0x55, 0x59, 0x55, 0x5a, 0x58, 0x58, 0x59, 0x58, 0x59, 0x58, 0x59, 0x58, 0x58, 0x56, 0x59, 0x58, 0x59, 0x59, 0x58, 0x59, 0x58, 0x59, 0x59, 0x64, 0x5f, 0x56, 0x5d, 0x59, 0x58, 0x57, 0x5f, 0xf1, 0x58, 0x57, 0x58, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5f, 0x5d, 0x5a, 0x5d, 0x5a, 0x5f, 0x65, 0x6e, 0x7d, 0xda, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf8, 0xf8, 0xf0, 0xd8, 0xba, 0x5e, 0x4d, 0x28, 0x00, 0x0a, 0xf0, 0xeb, 0xb5, 0xa1, 0xaa, 0xa7, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xad, 0xa8, 0xad, 0xad, 0xad, 0xa8, 0xa8, 0xb2, 0xbb, 0xbf, 0xcd, 0xc8, 0xc5, 0xc5, 0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xc6, 0xcc, 0xc8, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xc8, 0xbf, 0xb8, 0xaf, 0xaa, 0xaf, 0xaf, 0xb2, 0xb2, 0xad, 0xb2, 0xb2, 0xb4, 0xb1, 0xb4, 0xaa, 0xb5, 0xc0, 0xeb, 0xcb, 0x49, 0x00, 0x4f, 0x4f, 0x50, 0xd2, 0xeb, 0xc7, 0xba, 0xbc, 0xbf, 0xbf, 0xbf, 0xbc, 0xc3, 0xbf, 0xbc, 0xc3, 0xc3, 0xc0, 0xc7, 0xeb, 0xee, 0x79, 0x4f, 0x00, 0x51, 0x4d, 0x71, 0x9d, 0x92, 0x95, 0x92, 0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x92, 0x92, 0xa2, 0xb6, 0xba, 0xa5, 0x55, 0x59, 0x5d, 0x59, 0x5a, 0x59, 0x59, 0x5b, 0x59, 0x5b, 0x59, 0x59, 0x56, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x5d, 0x5a, 0x5c, 0x5a, 0x5b, 0x52, 0xa2, 0xc0, 0xbf, 0xbc, 0xbf, 0xbc, 0xbf, 0xbc, 0xbf, 0xbc, 0xbf, 0xbc, 0xbf, 0xbc, 0xbf, 0xb8, 0xbf, 0xbc, 0xbf, 0xbc, 0xbf, 0xbc, 0xbf, 0xbb, 0xbf, 0xf3, 0xfe, 0xfd, 0x1a, 0x1a, 0x1a, 0x1b, 0x1e, 0x1b, 0x17, 0x1c, 0x14, 0x03, 0x5c, 0x59, 0x5b, 0x5b, 0x5b, 0x5b, 0x59, 0x5d, 0x5b, 0x59, 0x5b, 0x59, 0x5b, 0x59, 0x5b, 0x59, 0x5b, 0x59, 0x5b, 0x5b, 0x5b, 0x5b, 0x5f, 0x5b, 0x5f, 0x5f, 0x66, 0x62, 0x59, 0x5f, 0x5d, 0x5d, 0x59, 0x61, 0x6e, 0x68, 0x65, 0x65, 0x68, 0xf2, 0x64, 0xf2, 0x68, 0xf2, 0x65, 0x65, 0x68, 0x6a, 0x65, 0x61, 0x65, 0x5d, 0x89, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf0, 0xd9, 0xa9, 0x5b, 0x4d, 0x00, 0x4a, 0x47, 0xf0, 0xdd, 0x98, 0xa3, 0xaa, 0xa8, 0xa8, 0xad, 0xa8, 0xa8, 0xad, 0xa8, 0xad, 0xaa, 0xad, 0xa8, 0xa8, 0xaa, 0xbb, 0xc5, 0xc8, 0xcd, 0xc8, 0xc8, 0xc8, 0xcd, 0xc8, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcc, 0xc8, 0xcc, 0xcf, 0xcd, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc8, 0xbf, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2, 0xb7, 0xb7, 0xb4, 0xb4, 0xb2, 0xaf, 0xc0, 0xeb, 0xc1, 0x4f, 0x49, 0x28, 0x00, 0x62, 0xeb, 0xe3, 0xc0, 0xc0, 0xc3, 0xbc, 0xbf, 0xbb, 0xbf, 0xbf, 0xc8, 0xc5, 0xbf, 0xbf, 0xc6, 0xba, 0xd8, 0xef, 0xd4, 0x4f, 0x51, 0x53, 0x4d, 0x5e, 0x9c, 0x9c, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0xa4, 0xb6, 0xbe, 0xb6, 0x60, 0x60, 0x62, 0x61, 0x62, 0x61, 0x60, 0x60, 0x60, 0x62, 0x61, 0x61, 0x62, 0x61, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x62, 0x64, 0x62, 0x65, 0x65, 0x65, 0x62, 0x5b, 0xa4, 0xd0, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xbf, 0xc5, 0xbf, 0xc5, 0xbf, 0xc5, 0xbf, 0xc5, 0xbf, 0xc5, 0xbf, 0xc5, 0xc3, 0xc3, 0xc3, 0xbf, 0xc5, 0xbf, 0xca, 0xfe, 0x1c, 0x1c, 0x1c, 0x1c, 0x1e, 0x1e, 0x1e, 0x1c, 0x20, 0xfd, 0xfa, 0x04, 0x66, 0x63, 0x63, 0x63, 0x62, 0x65, 0x65, 0x65, 0x66, 0x64, 0x66, 0x64, 0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x64, 0x66, 0x64, 0x70, 0x68, 0x5f, 0x64, 0x5f, 0x61, 0x5f, 0x65, 0x73, 0xf2, 0x6a, 0x6a, 0x6a, 0x6e, 0x6a, 0x6e, 0x70, 0x6e, 0x6a, 0x6e, 0x70, 0x70, 0x75, 0x6e, 0x73, 0x64, 0x7d, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xd8, 0x8c, 0x52, 0x50, 0x00, 0x2e, 0xe0, 0xf0, 0xba, 0x9f, 0xb2, 0xa8, 0xad, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xab, 0xaf, 0xc5, 0xcd, 0xcd, 0xcd, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc8, 0xc5, 0xcd, 0xc8, 0xcd, 0xc8, 0xcd, 0xc8, 0xcd, 0xcd, 0xcd, 0xc8, 0xcd, 0xc8, 0xc8, 0xd0, 0xcf, 0xcc, 0xcc, 0xcd, 0xcd, 0xc8, 0xc8, 0xd0, 0xd3, 0xcd, 0xc5, 0xbc, 0xb8, 0xaf, 0xaf, 0xaf, 0xb2, 0xb7, 0xb4, 0xb2, 0xb2, 0xab, 0xce, 0xef, 0xb3, 0x00, 0x4b, 0x4b, 0x00, 0x7b, 0xeb, 0xd8, 0xc0, 0xbc, 0xbf, 0xbf, 0xbb, 0xbf, 0xbf, 0xb8, 0xbb, 0xbf, 0xbf, 0xc5, 0xc5, 0xc0, 0xc7, 0xeb, 0xef, 0x75, 0x51, 0x51, 0x50, 0x52, 0x8b, 0x9c, 0x8c, 0x95, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0xab, 0xba, 0xb6, 0xb9, 0x67, 0x64, 0x64, 0x65, 0x65, 0x64, 0x64, 0x66, 0x66, 0x64, 0x64, 0x64, 0x65, 0x64, 0x64, 0x65, 0x64, 0x65, 0x64, 0x65, 0x64, 0x64, 0x64, 0x62, 0x65, 0x65, 0x65, 0x65, 0x62, 0x5e, 0xa2, 0xd5, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc9, 0xc5, 0xc8, 0xbf, 0xc9, 0xc7, 0xfe, 0xff, 0x1c, 0x1c, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x20, 0xfd, 0x05, 0x6a, 0x68, 0x69, 0x67, 0x67, 0x67, 0x6a, 0xf2, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x6b, 0x68, 0x68, 0x68, 0x6f, 0x6a, 0x5f, 0x64, 0x5d, 0x65, 0x5f, 0x61, 0x73, 0x6e, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6a, 0x6a, 0x70, 0x70, 0x70, 0x6e, 0x6a, 0x6a, 0x66, 0x6a, 0x75, 0xbd, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0xed, 0xd2, 0x7b, 0x4d, 0x51, 0x00, 0x7d, 0xf8, 0xeb, 0xb5, 0xa7, 0xa8, 0xa8, 0xa8, 0xad, 0xa8, 0xad, 0xa8, 0xad, 0xaa, 0xa8, 0xaa, 0xaf, 0xbc, 0xc5, 0xcd, 0xcd, 0xcd, 0xc8, 0xc8, 0xcd, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc8, 0xcf, 0xcc, 0xcc, 0xcc, 0xcf, 0xd0, 0xcd, 0xd0, 0xcd, 0xcd, 0xcd, 0xcd, 0xd0, 0xc5, 0xbc, 0xbc, 0xaf, 0xb8, 0xb2, 0xb2, 0xb8, 0xb8, 0xab, 0xd8, 0xee, 0xa6, 0x00, 0x28, 0x28, 0x00, 0x94, 0xeb, 0xd5, 0xbc, 0xbc, 0xbf, 0xbf, 0xbf, 0xbf, 0xbb, 0xc5, 0xbf, 0xbf, 0xbf, 0xc5, 0xc3, 0xc0, 0xc0, 0xe3, 0xeb, 0xb3, 0x00, 0x53, 0x56, 0x50, 0x80, 0x9c, 0x92, 0x95, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0xa9, 0xbc, 0xba, 0xba, 0x67, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64, 0x62, 0x64, 0x64, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64, 0x62, 0x62, 0x65, 0x65, 0x62, 0x62, 0x5b, 0x9a, 0xd5, 0xc5, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc3, 0xc5, 0xc5, 0xc5, 0xca, 0xf7, 0xff, 0x1a, 0x1f, 0x1a, 0x1e, 0x1e, 0x1e, 0x1c, 0x20, 0xfd, 0xfa, 0xf2, 0x65, 0x67, 0x63, 0x67, 0x67, 0x68, 0x65, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x66, 0x67, 0x62, 0x6e, 0x67, 0x5f, 0x66, 0x5f, 0x62, 0x5f, 0x61, 0x73, 0x6a, 0x70, 0x6e, 0x6a, 0x6e, 0x6a, 0x70, 0x6e, 0x6a, 0x68, 0xf2, 0x6a, 0x6e, 0x7f, 0x96, 0xcb, 0xec, 0x01, 0xee, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xed, 0xcb, 0x6e, 0x4b, 0x49, 0x49, 0x8f, 0xf0, 0xe3, 0xab, 0xa3, 0xa8, 0xa8, 0xa8, 0xad, 0xa8, 0xad, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xbf, 0xcd, 0xcf, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcc, 0xcc, 0xcc, 0xcf, 0xcd, 0xd0, 0xcf, 0xc6, 0xbf, 0xb8, 0xb8, 0xb8, 0xaf, 0xb5, 0xba, 0xd8, 0xef, 0x83, 0x00, 0x53, 0x28, 0x4d, 0xb0, 0xe3, 0xd3, 0xbc, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xc5, 0xbf, 0xc3, 0xbc, 0xc3, 0xc0, 0xc5, 0xc0, 0xc0, 0xd5, 0xed, 0xd2, 0x53, 0x28, 0x54, 0x4d, 0x76, 0xa4, 0x92, 0x97, 0x8c, 0x93, 0x93, 0x92, 0x92, 0x93, 0x92, 0x93, 0xab, 0xba, 0xba, 0xb0, 0x69, 0x5f, 0x64, 0x64, 0x65, 0x65, 0x64, 0x64, 0x62, 0x64, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x66, 0x64, 0x65, 0x65, 0x65, 0x66, 0x55, 0xa9, 0xd0, 0xc3, 0xc5, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc5, 0xc3, 0xc7, 0xf7, 0xfe, 0x1c, 0x1e, 0x1e, 0x1c, 0x1e, 0x1e, 0x1c, 0xff, 0x18, 0xfa, 0xf2, 0x68, 0x68, 0x67, 0x68, 0x66, 0x68, 0x68, 0x66, 0x68, 0x66, 0x66, 0x66, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x68, 0x68, 0x67, 0x68, 0x66, 0x6f, 0x67, 0x5b, 0x66, 0x5f, 0x62, 0x60, 0x65, 0x72, 0x6a, 0x6e, 0x70, 0x6a, 0x6a, 0x6a, 0x61, 0x61, 0x70, 0x75, 0x83, 0xac, 0xcb, 0xe0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xed, 0xbd, 0x61, 0x00, 0xf9, 0x53, 0xb3, 0xef, 0xd8, 0xab, 0xaa, 0xa8, 0xad, 0xad, 0xa8, 0xad, 0xa8, 0xaa, 0xa8, 0xaa, 0xb8, 0xbf, 0xc8, 0xcd, 0xcd, 0xc8, 0xcd, 0xc8, 0xcd, 0xc8, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc6, 0xd0, 0xd0, 0xcd, 0xbf, 0xbc, 0xaf, 0xb5, 0xba, 0xdd, 0xf0, 0xfb, 0x00, 0x28, 0x4f, 0x51, 0xd1, 0xe3, 0xcc, 0xbc, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xc5, 0xbf, 0xc0, 0xc3, 0xc0, 0xc6, 0xc6, 0xc0, 0xce, 0xeb, 0xe3, 0xf2, 0x28, 0x54, 0x50, 0x6c, 0xa4, 0x92, 0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x92, 0x93, 0x93, 0xb6, 0xba, 0xb6, 0xba, 0x6b, 0x60, 0x64, 0x62, 0x65, 0x62, 0x65, 0x62, 0x64, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64, 0x62, 0x62, 0x62, 0x62, 0x64, 0x64, 0x63, 0x64, 0x65, 0x65, 0x64, 0x66, 0x5b, 0xa2, 0xd3, 0xc5, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc9, 0xc7, 0xf7, 0xfe, 0x1c, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1c, 0x20, 0xf6, 0xfa, 0xf2, 0xf2, 0x67, 0x68, 0x67, 0x66, 0x68, 0x68, 0x66, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x66, 0x67, 0x66, 0x6c, 0x68, 0x5e, 0x62, 0x60, 0x61, 0x5f, 0x68, 0x6a, 0x61, 0x61, 0x5d, 0xf1, 0x6a, 0x79, 0x8f, 0xac, 0xd4, 0xe6, 0xec, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xeb, 0xb3, 0x54, 0x00, 0x4b, 0x4a, 0xda, 0xed, 0xc7, 0xab, 0xaa, 0xad, 0xa8, 0xad, 0xa8, 0xad, 0xa8, 0xa8, 0xaa, 0xb2, 0xc5, 0xcd, 0xd0, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcf, 0xcd, 0xc8, 0xcd, 0xc8, 0xc5, 0xc0, 0xc7, 0xe3, 0xef, 0x5f, 0x00, 0x28, 0x4e, 0x58, 0xeb, 0xdd, 0xc6, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbc, 0xbf, 0xc0, 0xbf, 0xc6, 0xcf, 0xce, 0xcf, 0xc6, 0xc6, 0xe3, 0xed, 0x7d, 0xf9, 0x57, 0x50, 0x5f, 0xa4, 0x92, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x93, 0x9a, 0xb5, 0xba, 0xba, 0xba, 0x69, 0x5f, 0x66, 0x62, 0x65, 0x65, 0x65, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x65, 0x65, 0x65, 0x63, 0x5b, 0xa4, 0xd0, 0xc3, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xca, 0xf4, 0xff, 0x1c, 0x1e, 0x1e, 0x1c, 0x1f, 0x1e, 0x1c, 0x21, 0x14, 0xfa, 0xf2, 0x68, 0x67, 0x68, 0x67, 0x66, 0x67, 0x66, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x68, 0x67, 0x68, 0x67, 0x6e, 0x67, 0x60, 0x62, 0x60, 0x5f, 0x5f, 0x5f, 0x83, 0x83, 0x96, 0x47, 0xd4, 0xec, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0xf8, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xe8, 0x91, 0x4b, 0x4e, 0x00, 0xf1, 0xec, 0xeb, 0xc0, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xb8, 0xc5, 0xcd, 0xcd, 0xcd, 0xc8, 0xcd, 0xc8, 0xcd, 0xc8, 0xcd, 0xc8, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xc6, 0xcc, 0xc8, 0xcd, 0xcd, 0xcd, 0xd0, 0xcc, 0xd5, 0xeb, 0xdb, 0x51, 0x28, 0x28, 0x00, 0x6b, 0xed, 0xd8, 0xc3, 0xc0, 0xbf, 0xbf, 0xbf, 0xbc, 0xbf, 0xbc, 0xc5, 0xc3, 0xc6, 0xcf, 0xd3, 0xd3, 0xd3, 0xd3, 0xc7, 0xe3, 0xeb, 0x8f, 0x28, 0x57, 0x54, 0x55, 0x9c, 0x92, 0x92, 0x97, 0x93, 0x93, 0x93, 0x92, 0x92, 0x93, 0x9b, 0xba, 0xb6, 0xb6, 0xb9, 0x69, 0x5f, 0x66, 0x62, 0x65, 0x64, 0x62, 0x65, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x62, 0x64, 0x65, 0x65, 0x64, 0x64, 0x5b, 0xa2, 0xd3, 0xc5, 0xc5, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc9, 0xc7, 0xf7, 0xfe, 0x1c, 0x1e, 0x1e, 0x1e, 0x1f, 0x1e, 0x1c, 0x20, 0x14, 0xf2, 0xf2, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x68, 0x68, 0x66, 0x68, 0x67, 0x6e, 0x66, 0x5f, 0x60, 0x62, 0x62, 0x62, 0x70, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0xf0, 0x01, 0x01, 0x4c, 0xee, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe7, 0x7d, 0x4e, 0x49, 0x00, 0x73, 0xf0, 0xe5, 0xc0, 0xab, 0xad, 0xa8, 0xa8, 0xad, 0xa8, 0xaa, 0xaa, 0xbb, 0xc5, 0xcd, 0xcd, 0xcd, 0xc8, 0xc8, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcd, 0xc6, 0xcc, 0xcd, 0xd0, 0xcd, 0xcd, 0xc8, 0xd0, 0xc6, 0xd8, 0xeb, 0xb9, 0x4b, 0x53, 0x51, 0x00, 0x7d, 0xeb, 0xd5, 0xc6, 0xbf, 0xbf, 0xbf, 0xbf, 0xc5, 0xbf, 0xc5, 0xcd, 0xcf, 0xcf, 0xd3, 0xd0, 0xd3, 0xcc, 0xd3, 0xc6, 0xdd, 0xed, 0xa6, 0x57, 0x57, 0x54, 0x52, 0x8d, 0x92, 0x93, 0x93, 0x93, 0x93, 0x95, 0x92, 0x92, 0x93, 0xa1, 0xba, 0xb6, 0xb6, 0xba, 0x67, 0x5f, 0x64, 0x62, 0x65, 0x65, 0x65, 0x62, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x66, 0x62, 0x65, 0x65, 0x65, 0x63, 0x5b, 0xa9, 0xd3, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc9, 0xc7, 0xf7, 0xff, 0x1c, 0x1e, 0x1e, 0x1f, 0x1f, 0x1e, 0x1c, 0x21, 0xfc, 0x04, 0xf2, 0x68, 0x67, 0x68, 0x67, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x6b, 0x67, 0x6e, 0x63, 0x60, 0x62, 0x60, 0x61, 0x59, 0x83, 0x01, 0x01, 0xf8, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x25, 0x01, 0xf0, 0xe7, 0x70, 0x00, 0x49, 0x00, 0x7f, 0xf0, 0xe3, 0xb5, 0xb5, 0xa8, 0xad, 0xa8, 0xa8, 0xad, 0xaa, 0xb7, 0xc8, 0xcd, 0xcd, 0xc8, 0xcf, 0xcc, 0xcc, 0xcd, 0xc8, 0xcd, 0xc8, 0xcd, 0xc8, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xc8, 0xcd, 0xc8, 0xcd, 0xc8, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcf, 0xcc, 0xcd, 0xcd, 0xc8, 0xcd, 0xc8, 0xc6, 0xd8, 0xef, 0x94, 0x49, 0x4b, 0x28, 0x4e, 0x8d, 0xeb, 0xd8, 0xc6, 0xbc, 0xbf, 0xbf, 0xc5, 0xc5, 0xcd, 0xcf, 0xd0, 0xd0, 0xd0, 0xd3, 0xd3, 0xce, 0xce, 0xce, 0xce, 0xd8, 0xeb, 0xc2, 0x5c, 0x54, 0x57, 0x52, 0x85, 0x95, 0x93, 0x93, 0x92, 0x93, 0x95, 0x92, 0x92, 0x93, 0xa2, 0xbc, 0xb6, 0xae, 0xba, 0x67, 0x5e, 0x64, 0x62, 0x65, 0x64, 0x62, 0x65, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x62, 0x64, 0x65, 0x65, 0x64, 0x66, 0x5e, 0xa9, 0xd0, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc9, 0xc3, 0xca, 0xf7, 0xfe, 0x1c, 0x1e, 0x1e, 0x1f, 0x1f, 0x1a, 0x1d, 0xff, 0xfc, 0x31, 0xf2, 0x64, 0x68, 0x67, 0x66, 0x67, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x68, 0x6a, 0x66, 0x6b, 0x68, 0x6e, 0x62, 0x62, 0x60, 0x62, 0x61, 0x54, 0xb3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf8, 0x4c, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xda, 0x5d, 0x00, 0x49, 0x00, 0x96, 0xf0, 0xdd, 0xbc, 0xaf, 0xad, 0xa8, 0xad, 0xaa, 0xa8, 0xb8, 0xc5, 0xcd, 0xcd, 0xc8, 0xcc, 0xcf, 0xcc, 0xcc, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcf, 0xcc, 0xcc, 0xcd, 0xc8, 0xcd, 0xcd, 0xc6, 0xd1, 0xdd, 0xef, 0x7d, 0x00, 0x28, 0x51, 0x4e, 0xa5, 0xeb, 0xd5, 0xc0, 0xc3, 0xc5, 0xc5, 0xcd, 0xcd, 0xcf, 0xd0, 0xd0, 0xcf, 0xd0, 0xd3, 0xd0, 0xce, 0xd0, 0xd0, 0xce, 0xd8, 0xef, 0xc1, 0xf2, 0x53, 0x5d, 0x4d, 0x7e, 0x9c, 0x92, 0x93, 0x93, 0x93, 0x92, 0x92, 0x97, 0x8c, 0xb5, 0xba, 0xb6, 0xba, 0xae, 0x60, 0x60, 0x64, 0x64, 0x65, 0x65, 0x65, 0x62, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x64, 0x65, 0x65, 0x64, 0x60, 0x5e, 0xba, 0xc9, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc9, 0xc7, 0xf7, 0xff, 0x1f, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1c, 0x21, 0x0b, 0x04, 0x65, 0x68, 0x67, 0x68, 0x67, 0x68, 0x66, 0x68, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x6b, 0x60, 0x60, 0x60, 0x62, 0x5f, 0x56, 0xd4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0xc2, 0x53, 0x4e, 0xf9, 0x00, 0xac, 0x01, 0xd5, 0xbc, 0xaf, 0xad, 0xa8, 0xa8, 0xb2, 0xb2, 0xbf, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcc, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xce, 0xce, 0xe3, 0xeb, 0x70, 0x00, 0x53, 0x28, 0x51, 0xb9, 0xeb, 0xd1, 0xc6, 0xc8, 0xcd, 0xcd, 0xcd, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd3, 0xd3, 0xd3, 0xce, 0xd3, 0xce, 0xce, 0xd5, 0xed, 0xd2, 0x70, 0x28, 0x5d, 0x50, 0x7a, 0x9c, 0x92, 0x93, 0x93, 0x92, 0x92, 0x92, 0x95, 0x8c, 0xbc, 0xb6, 0xb6, 0xb6, 0xb0, 0x5e, 0x66, 0x64, 0x64, 0x65, 0x65, 0x62, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x66, 0x62, 0x64, 0x62, 0x65, 0x64, 0x60, 0x5e, 0xc0, 0xc9, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc3, 0xc9, 0xf4, 0xf7, 0xff, 0x1c, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1c, 0x21, 0x09, 0xf2, 0xf2, 0x68, 0x67, 0x67, 0x66, 0x67, 0x66, 0x68, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x68, 0x6a, 0x68, 0x68, 0x6e, 0x6b, 0x60, 0x62, 0x64, 0x66, 0x5f, 0x61, 0xea, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xa0, 0x00, 0x4b, 0x49, 0x49, 0x48, 0xf0, 0xce, 0xbc, 0xb2, 0xb2, 0xa8, 0xaa, 0xb2, 0xc5, 0xcd, 0xcd, 0xc8, 0xcd, 0xc8, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcc, 0xcf, 0xcc, 0xcc, 0xcf, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xd0, 0xc6, 0xd5, 0xe3, 0xda, 0x5d, 0x28, 0x28, 0x4e, 0x5d, 0xd6, 0xe5, 0xce, 0xd0, 0xd0, 0xcd, 0xcd, 0xcd, 0xd0, 0xcf, 0xd0, 0xd0, 0xd0, 0xd3, 0xd3, 0xd3, 0xce, 0xd0, 0xd3, 0xce, 0xd1, 0xed, 0xdb, 0xfb, 0x54, 0x5c, 0x4d, 0x77, 0x9c, 0x92, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x93, 0xbc, 0xb6, 0xb6, 0xba, 0xa4, 0x5e, 0x66, 0x62, 0x64, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x66, 0x62, 0x65, 0x65, 0x65, 0x5e, 0x63, 0xce, 0xc9, 0xc8, 0xc5, 0xc5, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc9, 0xca, 0xf7, 0xff, 0x1f, 0x1e, 0x1e, 0x1c, 0x1f, 0x1d, 0x1c, 0x21, 0x07, 0x04, 0x6a, 0x66, 0x67, 0x67, 0x67, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x62, 0x62, 0x60, 0x62, 0x54, 0x79, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x25, 0x01, 0x01, 0x7f, 0x00, 0x4e, 0xf9, 0x28, 0xde, 0xef, 0xc6, 0xc3, 0xb7, 0xb8, 0xa8, 0xaa, 0xbf, 0xcd, 0xcd, 0xcd, 0xcd, 0xc8, 0xcf, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcc, 0xcf, 0xc7, 0xd5, 0xed, 0xc2, 0x51, 0x4a, 0x53, 0x4e, 0x68, 0xdf, 0xe3, 0xce, 0xd3, 0xd0, 0xd0, 0xcd, 0xd0, 0xcf, 0xce, 0xcf, 0xd3, 0xcf, 0xd3, 0xd3, 0xd3, 0xce, 0xd3, 0xd3, 0xce, 0xce, 0xed, 0xdc, 0x7d, 0x4a, 0x5c, 0x51, 0x71, 0x9c, 0x92, 0x92, 0x93, 0x92, 0x95, 0x92, 0x8c, 0xa1, 0xba, 0xb5, 0xb6, 0xba, 0x9d, 0x5b, 0x66, 0x62, 0x64, 0x65, 0x65, 0x62, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x66, 0x62, 0x64, 0x62, 0x65, 0x64, 0x5f, 0x69, 0xce, 0xd0, 0xc3, 0xc8, 0xc5, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc9, 0xc7, 0xca, 0xf7, 0xff, 0x1c, 0x1e, 0x1e, 0x1f, 0x1c, 0x1f, 0x20, 0xff, 0x06, 0x65, 0xf2, 0x67, 0x67, 0x67, 0x67, 0x68, 0x66, 0x68, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x67, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x6b, 0x68, 0x62, 0x66, 0x61, 0x61, 0x54, 0xa0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00, 0x4b, 0x00, 0x5a, 0xea, 0xeb, 0xc6, 0xc5, 0xbb, 0xbf, 0xaa, 0xbb, 0xcd, 0xc8, 0xc8, 0xcd, 0xc8, 0xcf, 0xc8, 0xcc, 0xcd, 0xc8, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcd, 0xcd, 0xcd, 0xcc, 0xcf, 0xce, 0xc6, 0xdd, 0xed, 0xa6, 0x4b, 0x28, 0x53, 0x4e, 0x73, 0xe5, 0xe3, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd3, 0xd0, 0xce, 0xd3, 0xcc, 0xd3, 0xd3, 0xd3, 0xce, 0xd0, 0xd3, 0xd3, 0xc7, 0xeb, 0xe2, 0x83, 0x57, 0x5a, 0x56, 0x66, 0x9c, 0x93, 0x92, 0x92, 0x93, 0x92, 0x93, 0x8c, 0xab, 0xbc, 0xb6, 0xb6, 0xc0, 0x8c, 0x5b, 0x66, 0x64, 0x64, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x66, 0x62, 0x65, 0x65, 0x62, 0x5f, 0x74, 0xd5, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc9, 0xc3, 0xf4, 0xf7, 0xff, 0x1f, 0x1e, 0x1e, 0x1f, 0x1c, 0x1f, 0x20, 0xfe, 0x05, 0xf2, 0x68, 0x68, 0x67, 0x67, 0x66, 0x67, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x66, 0x66, 0x62, 0x62, 0x5f, 0x5d, 0xd4, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0xee, 0x5a, 0x00, 0x4f, 0x00, 0x31, 0xef, 0xe3, 0xce, 0xbf, 0xbf, 0xbf, 0xbb, 0xbf, 0xcd, 0xc8, 0xc5, 0xcf, 0xcc, 0xcc, 0xcd, 0xcc, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0xcc, 0xcf, 0xcf, 0xc7, 0xdd, 0xeb, 0x87, 0x4b, 0x28, 0x4a, 0x4f, 0x7e, 0xe8, 0xdd, 0xd3, 0xce, 0xd0, 0xd0, 0xcd, 0xd0, 0xcf, 0xce, 0xce, 0xd0, 0xce, 0xd3, 0xd5, 0xd3, 0xce, 0xd3, 0xd3, 0xce, 0xce, 0xed, 0xdf, 0x8f, 0x5c, 0x5a, 0x5a, 0x63, 0x8c, 0x9c, 0x92, 0x92, 0x92, 0x93, 0x93, 0x92, 0xb5, 0xb6, 0xb5, 0xb6, 0xba, 0x85, 0x55, 0x67, 0x62, 0x64, 0x65, 0x65, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x66, 0x62, 0x64, 0x62, 0x65, 0x65, 0x5b, 0x7b, 0xd8, 0xc9, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc3, 0xc7, 0xca, 0xf7, 0xff, 0x1f, 0x1e, 0x1e, 0x1f, 0x1c, 0x1c, 0x20, 0x18, 0xfa, 0x04, 0x6a, 0x66, 0x67, 0x67, 0x67, 0x68, 0x66, 0x68, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x67, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x66, 0x62, 0x60, 0x62, 0x58, 0x70, 0xea, 0x4c, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe9, 0x4f, 0x4e, 0x28, 0x00, 0x73, 0x01, 0xe3, 0xce, 0xb8, 0xc5, 0xbf, 0xc5, 0xc5, 0xcd, 0xcd, 0xcc, 0xc8, 0xcd, 0xcc, 0xcc, 0xc8, 0xcd, 0xc8, 0xcd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xce, 0xce, 0xe3, 0xe7, 0x79, 0x28, 0x49, 0x57, 0x4b, 0x8a, 0xeb, 0xd8, 0xd5, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd3, 0xd3, 0xd0, 0xce, 0xd3, 0xd3, 0xd3, 0xce, 0xd0, 0xd3, 0xce, 0xd1, 0xef, 0xdf, 0xa0, 0x5c, 0x5a, 0x5d, 0x5e, 0x91, 0x92, 0x92, 0x93, 0x8c, 0x92, 0x93, 0x93, 0xb6, 0xb5, 0xb6, 0xb6, 0xc0, 0x80, 0x5b, 0x68, 0x66, 0x64, 0x65, 0x64, 0x65, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x66, 0x62, 0x65, 0x65, 0x64, 0x5b, 0x80, 0xdd, 0xc3, 0xc5, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc9, 0xf4, 0xf7, 0x20, 0x1c, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x20, 0x14, 0x03, 0xf2, 0x68, 0x67, 0x67, 0x67, 0x66, 0x67, 0x68, 0x67, 0x66, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x64, 0x6a, 0x6b, 0x68, 0x62, 0x66, 0x60, 0x68, 0x54, 0x7f, 0x01, 0xee, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x4c, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0x4c, 0x01, 0x01, 0x4c, 0xee, 0x01, 0xee, 0xee, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0x4c, 0x01, 0xcb, 0x00, 0x00, 0x4b, 0x00, 0x79, 0xf0, 0xdd, 0xc6, 0xbf, 0xc8, 0xbf, 0xc5, 0xc5, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xc8, 0xcd, 0xc8, 0xcf, 0xce, 0xc7, 0xed, 0xd9, 0x70, 0x4f, 0x28, 0x53, 0x53, 0xa6, 0xe5, 0xdd, 0xc6, 0xd3, 0xd3, 0xd0, 0xd0, 0xd0, 0xd3, 0xcf, 0xd0, 0xd0, 0xd3, 0xd3, 0xd5, 0xd1, 0xd3, 0xd3, 0xd3, 0xce, 0xc7, 0xe5, 0xed, 0xa0, 0xf1, 0x5d, 0x54, 0x5e, 0x85, 0x92, 0x92, 0x8c, 0x98, 0x93, 0x93, 0xa2, 0xb5, 0xb5, 0xb5, 0xb6, 0xbe, 0x76, 0x5e, 0x62, 0x62, 0x64, 0x62, 0x64, 0x64, 0x65, 0x65, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x66, 0x5f, 0x68, 0x61, 0x60, 0x5b, 0xa9, 0xc6, 0xcc, 0xc3, 0xc5, 0xc8, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc9, 0xc3, 0xc3, 0xc6, 0xf4, 0xff, 0x1c, 0x1f, 0x1c, 0x1f, 0x1f, 0x1f, 0x1c, 0x21, 0x09, 0x65, 0x64, 0x67, 0x67, 0x68, 0xf2, 0x68, 0x68, 0x66, 0x67, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x60, 0x60, 0x62, 0x5f, 0x59, 0xb3, 0x01, 0x01, 0xee, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xef, 0xf0, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0xee, 0x4c, 0xf0, 0x01, 0x01, 0x46, 0x00, 0xf9, 0x4b, 0x00, 0x84, 0xf0, 0xd8, 0xc6, 0xc3, 0xc5, 0xc3, 0xc5, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc8, 0xcd, 0xc8, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xc8, 0xcd, 0xcd, 0xcf, 0xd3, 0xd1, 0xed, 0xcb, 0xf1, 0x4f, 0x28, 0x53, 0x57, 0xb9, 0xe5, 0xdd, 0xce, 0xd3, 0xd3, 0xd0, 0xd3, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xce, 0xd3, 0xd5, 0xd3, 0xce, 0xd3, 0xd3, 0xce, 0xce, 0xe5, 0xeb, 0xa6, 0x5d, 0x5d, 0x56, 0x5b, 0x85, 0x9c, 0x92, 0x93, 0x93, 0x92, 0x93, 0xa7, 0xb6, 0xb5, 0xb6, 0xb6, 0xba, 0x71, 0x60, 0x64, 0x66, 0x62, 0x66, 0x62, 0x64, 0x65, 0x65, 0x64, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x66, 0x61, 0x68, 0x62, 0x60, 0x63, 0xae, 0xc9, 0xc8, 0xc5, 0xc5, 0xc8, 0xc3, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc3, 0xc9, 0xc3, 0xc3, 0xc6, 0xf4, 0xff, 0x1c, 0x1f, 0x1f, 0x1d, 0x1e, 0x1f, 0x1f, 0x21, 0x07, 0x65, 0x66, 0x67, 0x67, 0x68, 0xf2, 0xf2, 0x68, 0x67, 0x67, 0x66, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x67, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x67, 0x60, 0x63, 0x62, 0x60, 0x65, 0xda, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x4c, 0x25, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x01, 0xf0, 0x01, 0xef, 0xe2, 0xdb, 0xda, 0xda, 0xda, 0xe1, 0xec, 0x4c, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x96, 0x00, 0x49, 0x28, 0x00, 0xa0, 0xf0, 0xd8, 0xc3, 0xcc, 0xc5, 0xc5, 0xc8, 0xc8, 0xcd, 0xcd, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xce, 0xd8, 0xeb, 0xb9, 0x57, 0x4b, 0x51, 0x53, 0xf1, 0xc2, 0xeb, 0xd5, 0xd3, 0xd0, 0xd3, 0xd0, 0xd3, 0xd0, 0xd3, 0xd0, 0xd0, 0xd0, 0xd3, 0xd3, 0xd5, 0xd3, 0xd1, 0xd3, 0xd3, 0xd3, 0xc7, 0xe3, 0xeb, 0xb3, 0x6f, 0x6e, 0x5f, 0x5b, 0x7a, 0x9c, 0x92, 0x92, 0x93, 0x92, 0x97, 0xb6, 0xb6, 0xb6, 0xb5, 0xb6, 0xba, 0x63, 0x62, 0x68, 0x64, 0x64, 0x62, 0x66, 0x62, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x60, 0x6a, 0x60, 0x62, 0x69, 0xba, 0xd0, 0xc3, 0xc5, 0xc5, 0xcd, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc3, 0xc7, 0xf4, 0xff, 0x1c, 0x1f, 0x1c, 0x1f, 0x1f, 0x1c, 0x1d, 0x21, 0x05, 0x65, 0x66, 0x67, 0x67, 0x68, 0xf2, 0x68, 0xf2, 0x67, 0x67, 0x67, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x66, 0x68, 0x6b, 0x68, 0x63, 0x60, 0x64, 0x62, 0x59, 0x7d, 0xec, 0xee, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0x01, 0xf0, 0xee, 0xd7, 0xa0, 0x8f, 0x8a, 0x8a, 0x8f, 0xa0, 0xac, 0xee, 0x4c, 0x01, 0x4c, 0x4c, 0x4c, 0xee, 0x01, 0x25, 0x7d, 0x00, 0x28, 0x49, 0x00, 0xb9, 0xf0, 0xd5, 0xc6, 0xcd, 0xc5, 0xc8, 0xcc, 0xcd, 0xcd, 0xcd, 0xcd, 0xc8, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcf, 0xd1, 0xdd, 0xeb, 0xa6, 0x4f, 0x4b, 0x53, 0x28, 0x65, 0xda, 0xe3, 0xd5, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xd3, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd3, 0xd3, 0xd3, 0xce, 0xd3, 0xce, 0xd3, 0xce, 0xe3, 0xeb, 0xb9, 0x8a, 0xa0, 0x8d, 0x85, 0x91, 0x9c, 0x9c, 0x9b, 0x93, 0x92, 0x9c, 0xab, 0xba, 0xb6, 0xb6, 0xb6, 0xb0, 0x5e, 0x68, 0x64, 0x64, 0x64, 0x63, 0x64, 0x64, 0x65, 0x65, 0x62, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x68, 0x60, 0x60, 0x74, 0xc7, 0xcc, 0xc5, 0xc5, 0xc8, 0xc8, 0xc3, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc9, 0xc3, 0xc9, 0xc7, 0xf7, 0xff, 0x1c, 0x1f, 0x1f, 0x1d, 0x1f, 0x1f, 0x21, 0x18, 0x04, 0xf2, 0x67, 0x67, 0x67, 0x68, 0xf2, 0xf2, 0x68, 0x67, 0x67, 0x66, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x66, 0x68, 0x67, 0x6b, 0x66, 0x60, 0x60, 0x66, 0x62, 0x58, 0xb3, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x4c, 0x25, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0xec, 0xbd, 0xac, 0xb0, 0xb9, 0xb9, 0xb9, 0xb9, 0xbd, 0xe8, 0xee, 0x01, 0xee, 0x01, 0x4c, 0xf8, 0x01, 0x01, 0x70, 0x00, 0x28, 0x4e, 0x00, 0xcb, 0xeb, 0xd5, 0xc6, 0xcc, 0xc5, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcd, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcd, 0xcd, 0xcd, 0xd3, 0xce, 0xe3, 0xe7, 0x89, 0x00, 0x28, 0x53, 0x4e, 0x70, 0xdf, 0xe3, 0xd1, 0xd5, 0xd0, 0xd3, 0xd0, 0xd3, 0xd3, 0xd3, 0xd0, 0xd0, 0xd0, 0xd0, 0xd3, 0xd5, 0xd3, 0xce, 0xd3, 0xd0, 0xd3, 0xce, 0xe3, 0xeb, 0xbd, 0x8d, 0x8d, 0x8d, 0x94, 0x92, 0x91, 0x95, 0xa4, 0x9c, 0xa2, 0xab, 0xbe, 0xb6, 0xb6, 0xb6, 0xba, 0x9c, 0x5f, 0x68, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x65, 0x62, 0x65, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x60, 0x5e, 0x7e, 0xc6, 0xc9, 0xc8, 0xc5, 0xc5, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xc7, 0xc4, 0xf7, 0x20, 0x1d, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x21, 0xfc, 0x04, 0xf2, 0x66, 0x67, 0x67, 0x68, 0xf2, 0x68, 0x68, 0x66, 0x67, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x66, 0x68, 0x67, 0x62, 0x60, 0x62, 0x62, 0x5d, 0x6a, 0xdb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xee, 0xcb, 0xbe, 0xbe, 0xc4, 0xc4, 0xc2, 0xbd, 0xc2, 0xea, 0xf0, 0x01, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5c, 0x00, 0x4b, 0x00, 0x51, 0xe5, 0xe5, 0xd1, 0xc6, 0xc8, 0xc8, 0xcd, 0xcf, 0xcc, 0xcd, 0xd0, 0xcd, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xd3, 0xce, 0xeb, 0xe1, 0x79, 0x00, 0x28, 0x53, 0x4f, 0xfb, 0xeb, 0xdc, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd0, 0xcf, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xcf, 0xce, 0xc6, 0xe3, 0xeb, 0xbd, 0x91, 0x91, 0x8b, 0x8c, 0x8d, 0x9c, 0xa4, 0xa4, 0xa9, 0xb6, 0xc0, 0xc0, 0xb6, 0xa9, 0xb6, 0xc0, 0x80, 0x60, 0x66, 0x62, 0x64, 0x64, 0x63, 0x64, 0x64, 0x65, 0x65, 0x62, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x63, 0x8d, 0xce, 0xcc, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc3, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc8, 0xc0, 0xc7, 0xf4, 0xfe, 0xff, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x20, 0x21, 0x06, 0xfa, 0x65, 0x67, 0x67, 0x66, 0x68, 0x68, 0xf2, 0x68, 0x67, 0x67, 0x66, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68, 0x67, 0x68, 0x60, 0x62, 0x62, 0x60, 0x5a, 0xa0, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x4c, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xef, 0xec, 0xc2, 0xb9, 0xbe, 0xba, 0xbe, 0xb9, 0xbe, 0xc2, 0xed, 0x01, 0xee, 0xf8, 0xf8, 0x01, 0x01, 0x01, 0xee, 0x4a, 0x00, 0xf9, 0x00, 0x5a, 0xed, 0xe3, 0xd3, 0xc6, 0xc8, 0xcc, 0xcd, 0xd0, 0xcd, 0xcc, 0xcd, 0xd0, 0xcd, 0xcf, 0xcc, 0xcd, 0xcc, 0xcf, 0xcc, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcf, 0xcc, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xce, 0xd1, 0xeb, 0xdb, 0x70, 0x00, 0x4f, 0x53, 0x4f, 0x81, 0xea, 0xdd, 0xd1, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd0, 0xcf, 0xd3, 0xd3, 0xd3, 0xce, 0xd0, 0xd0, 0xce, 0xc6, 0xdd, 0xeb, 0xc2, 0x8d, 0x99, 0x9d, 0xae, 0xb9, 0xc0, 0xbe, 0xba, 0xba, 0xae, 0xae, 0xae, 0xba, 0xba, 0xb6, 0xbe, 0x78, 0x61, 0x64, 0x61, 0x64, 0x62, 0x64, 0x62, 0x64, 0x65, 0x62, 0x65, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x62, 0x64, 0x62, 0x67, 0xa4, 0xce, 0xc3, 0xc8, 0xc5, 0xc5, 0xc5, 0xcc, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xbf, 0xc5, 0xc7, 0xc4, 0xf4, 0xfe, 0x20, 0x1c, 0x1f, 0x1f, 0x1f, 0x1d, 0x20, 0xfe, 0x05, 0xf2, 0x65, 0x68, 0x67, 0x67, 0x68, 0x68, 0xf2, 0x68, 0x66, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x66, 0x67, 0x62, 0x60, 0x62, 0x62, 0x5d, 0x6a, 0xda, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf8, 0xc2, 0xb9, 0xbe, 0xbe, 0xbe, 0xbe, 0xb9, 0xc2, 0xed, 0xf0, 0xee, 0xee, 0x01, 0xf8, 0x01, 0x01, 0xdb, 0x00, 0xf9, 0x49, 0x00, 0x65, 0xef, 0xe3, 0xd1, 0xc6, 0xc8, 0xc8, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xd0, 0xcf, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcc, 0xd0, 0xcf, 0xcc, 0xd3, 0xd8, 0xeb, 0xd4, 0xf1, 0x49, 0x28, 0x28, 0x53, 0x8f, 0xed, 0xdd, 0xd1, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xcf, 0xd3, 0xd3, 0xd3, 0xce, 0xcf, 0xce, 0xd0, 0xc6, 0xdd, 0xef, 0xc4, 0x94, 0xa4, 0xb0, 0xc4, 0xc7, 0xc4, 0xc4, 0xbe, 0xbe, 0xbe, 0xae, 0xae, 0xae, 0xba, 0xba, 0xba, 0x71, 0x64, 0x64, 0x65, 0x64, 0x64, 0x66, 0x66, 0x64, 0x65, 0x65, 0x62, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x62, 0x68, 0x60, 0x6c, 0xba, 0xce, 0xc8, 0xc5, 0xc5, 0xc5, 0xc8, 0xc8, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc3, 0xc7, 0xf4, 0xf7, 0xff, 0x20, 0x1d, 0x1f, 0x1f, 0x1f, 0x20, 0x21, 0xfc, 0xfa, 0x2e, 0xf2, 0x67, 0x66, 0x68, 0x66, 0xf2, 0x68, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x62, 0x66, 0x68, 0x68, 0x67, 0x68, 0x62, 0x60, 0x61, 0x5f, 0x5f, 0x47, 0x01, 0xf0, 0xf0, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x4c, 0x25, 0x01, 0x01, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0xec, 0xc2, 0xb0, 0xbe, 0xbe, 0xbe, 0xbe, 0xb9, 0xc2, 0xed, 0x4c, 0xef, 0x4c, 0x4c, 0xf8, 0x01, 0x01, 0x48, 0x00, 0x49, 0x28, 0x00, 0x6a, 0xf0, 0xe3, 0xce, 0xc6, 0xcc, 0xc8, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcc, 0xcf, 0xd0, 0xc6, 0xd1, 0xd8, 0xeb, 0xbd, 0x4a, 0x49, 0x28, 0x51, 0x53, 0xa0, 0xef, 0xd8, 0xd1, 0xd0, 0xd3, 0xd0, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xd0, 0xd3, 0xd5, 0xd3, 0xce, 0xce, 0xcf, 0xce, 0xc6, 0xd8, 0xef, 0xc2, 0x9d, 0xae, 0xb9, 0xc7, 0xc4, 0xbe, 0xbe, 0xbe, 0xc0, 0xbe, 0xb6, 0xa9, 0xa9, 0xb6, 0xba, 0xa9, 0x6c, 0x60, 0x65, 0x64, 0x65, 0x62, 0x64, 0x62, 0x64, 0x64, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x68, 0x5e, 0x77, 0xc7, 0xc9, 0xc8, 0xc5, 0xc5, 0xc5, 0xc8, 0xc8, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc7, 0xf4, 0xfe, 0xff, 0x1d, 0x1c, 0x1f, 0x1f, 0x1d, 0x20, 0xff, 0x0a, 0x04, 0x6a, 0x68, 0x66, 0x66, 0x67, 0x68, 0x68, 0xf2, 0x68, 0x68, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x66, 0x68, 0x6b, 0x68, 0x60, 0x6a, 0x6b, 0x5f, 0x54, 0x56, 0xfb, 0xc1, 0x01, 0x01, 0xf8, 0x4c, 0x01, 0xee, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xec, 0xc2, 0xb9, 0xbe, 0xbe, 0xbe, 0xbe, 0xb9, 0xc2, 0xed, 0xf0, 0xee, 0xf0, 0x01, 0xf8, 0x01, 0x01, 0xb3, 0x00, 0xf9, 0x28, 0x00, 0x79, 0xf0, 0xe3, 0xd1, 0xc6, 0xc8, 0xcd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd0, 0xcf, 0xd5, 0xdd, 0xec, 0xac, 0x00, 0xf9, 0x53, 0x4b, 0x57, 0xac, 0xef, 0xd8, 0xd1, 0xd3, 0xd0, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xd3, 0xd3, 0xce, 0xcf, 0xce, 0xd3, 0xc6, 0xdd, 0xed, 0xca, 0xa5, 0xae, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xbe, 0xc4, 0xbe, 0xb0, 0xa9, 0xa9, 0xae, 0xba, 0x91, 0x63, 0x5f, 0x68, 0x65, 0x65, 0x64, 0x64, 0x63, 0x64, 0x64, 0x65, 0x62, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x66, 0x60, 0x82, 0xd5, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc9, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xca, 0xf7, 0xff, 0x20, 0x20, 0x1d, 0x1f, 0x1f, 0x1d, 0xff, 0xfe, 0xfb, 0xf2, 0xf2, 0x68, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x64, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x68, 0x62, 0x62, 0x6b, 0x6b, 0x56, 0x4f, 0x75, 0x47, 0xe8, 0x01, 0x01, 0xee, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x4c, 0x25, 0x01, 0x01, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0xec, 0xc2, 0xb9, 0xbe, 0xbe, 0xc2, 0xbd, 0xb9, 0xc2, 0xed, 0xf0, 0xee, 0xf0, 0x4c, 0xf8, 0x01, 0x01, 0x96, 0x00, 0x00, 0x28, 0x00, 0x83, 0xf0, 0xdd, 0xc7, 0xc6, 0xcd, 0xcd, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd0, 0xcc, 0xcf, 0xcc, 0xce, 0xd5, 0xe3, 0xee, 0x89, 0x00, 0x28, 0x4a, 0x28, 0x5c, 0xbd, 0xed, 0xd6, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xd3, 0xd5, 0xd3, 0xce, 0xce, 0xce, 0xce, 0xc7, 0xd8, 0xed, 0xd2, 0xa5, 0xb9, 0xc4, 0xc4, 0xc4, 0xc2, 0xc4, 0xbd, 0xc4, 0xba, 0xba, 0xa9, 0xab, 0xb6, 0xba, 0x80, 0x60, 0x62, 0x65, 0x65, 0x65, 0x62, 0x64, 0x64, 0x62, 0x64, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x61, 0x64, 0x60, 0x63, 0x9d, 0xd3, 0xc6, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc6, 0xca, 0xf7, 0xff, 0x1d, 0x1d, 0x1d, 0x1f, 0x1f, 0x1d, 0x21, 0xfc, 0xf1, 0x6a, 0x68, 0x61, 0x6b, 0x66, 0x68, 0x66, 0xf2, 0x68, 0xf2, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x66, 0x66, 0x68, 0x66, 0x68, 0x68, 0x60, 0x56, 0x7d, 0xc1, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xed, 0xc1, 0xb9, 0xbe, 0xbd, 0xbe, 0xbd, 0xb9, 0xc1, 0xed, 0xf0, 0xee, 0xf8, 0x01, 0xf8, 0x01, 0x01, 0x7f, 0x00, 0xf9, 0xf9, 0x00, 0x8f, 0xef, 0xd9, 0xc0, 0xce, 0xc8, 0xd0, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcc, 0xd0, 0xcf, 0xd0, 0xcf, 0xd0, 0xcf, 0xd0, 0xcf, 0xcf, 0xd0, 0xcc, 0xd0, 0xcf, 0xcf, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd0, 0xcf, 0xcf, 0xcf, 0xd0, 0xd8, 0xe5, 0xed, 0x73, 0x00, 0x4a, 0x28, 0x28, 0x5d, 0xcb, 0xed, 0xd1, 0xd5, 0xd3, 0xd3, 0xd0, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xce, 0xd3, 0xd5, 0xd1, 0xd3, 0xce, 0xd3, 0xce, 0xce, 0xd8, 0xed, 0xd6, 0xb3, 0xbe, 0xc4, 0xc4, 0xc2, 0xca, 0xc2, 0xc4, 0xbe, 0xbe, 0xba, 0xab, 0xae, 0xb6, 0xb6, 0x76, 0x60, 0x64, 0x65, 0x65, 0x65, 0x64, 0x62, 0x66, 0x64, 0x64, 0x65, 0x62, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x65, 0x62, 0x64, 0x60, 0x71, 0xbe, 0xce, 0xc8, 0xc5, 0xc5, 0xc5, 0xc8, 0xc5, 0xc9, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc3, 0xf4, 0xf7, 0x20, 0x1c, 0x20, 0x1f, 0x1d, 0x1f, 0x1d, 0x21, 0x07, 0xf1, 0x6e, 0x64, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x6b, 0x66, 0x62, 0x6b, 0x66, 0x5f, 0x75, 0xb3, 0xea, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0x01, 0xf0, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0xec, 0xc2, 0xb9, 0xc2, 0xbe, 0xc2, 0xbd, 0xb9, 0xc2, 0xed, 0xf0, 0xee, 0xf0, 0xf0, 0xf8, 0x01, 0x01, 0x73, 0x00, 0x4b, 0x28, 0x00, 0xa0, 0x4c, 0xd8, 0xc7, 0xd0, 0xcc, 0xcd, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xcf, 0xd0, 0xcf, 0xd0, 0xcc, 0xd0, 0xcf, 0xd0, 0xcf, 0xd0, 0xcf, 0xd0, 0xcf, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd0, 0xcf, 0xcf, 0xcf, 0xd1, 0xd8, 0xeb, 0xe7, 0x5c, 0x00, 0x28, 0xf9, 0x53, 0xf1, 0xcb, 0xed, 0xd1, 0xd5, 0xd0, 0xd0, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xce, 0xce, 0xd5, 0xd3, 0xd1, 0xd3, 0xce, 0xce, 0xc7, 0xd9, 0xed, 0xd7, 0xb9, 0xca, 0xca, 0xc4, 0xc2, 0xca, 0xc2, 0xc4, 0xc4, 0xbe, 0xb6, 0xae, 0xb5, 0xba, 0xa9, 0x69, 0x60, 0x66, 0xf1, 0x68, 0x65, 0x64, 0x62, 0x66, 0x62, 0x64, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x77, 0xd1, 0xce, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc3, 0xc8, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc3, 0xc3, 0xc6, 0xcb, 0xfe, 0x20, 0x1d, 0x1d, 0x1d, 0x1d, 0x1f, 0x20, 0x18, 0xfa, 0x68, 0x64, 0x62, 0x6e, 0x62, 0x68, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x66, 0x6b, 0x66, 0x5f, 0x6e, 0x94, 0xde, 0xf0, 0x01, 0xf0, 0xf0, 0x01, 0x4c, 0x25, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xec, 0xc1, 0xb9, 0xbe, 0xc2, 0xbe, 0xbd, 0xb9, 0xbd, 0xed, 0xf0, 0x4c, 0xf8, 0x01, 0x25, 0x01, 0xec, 0x2e, 0x00, 0x28, 0x4b, 0x00, 0xb3, 0xef, 0xd6, 0xc7, 0xd5, 0xce, 0xd0, 0xce, 0xd3, 0xce, 0xce, 0xd3, 0xce, 0xd3, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcf, 0xce, 0xd0, 0xce, 0xd3, 0xd0, 0xce, 0xd0, 0xce, 0xd0, 0xd3, 0xd3, 0xd3, 0xd0, 0xd0, 0xcf, 0xcf, 0xcc, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xcd, 0xcf, 0xcc, 0xce, 0xd3, 0xd5, 0xd8, 0xed, 0xd4, 0x00, 0x49, 0x28, 0x49, 0x57, 0x61, 0xd7, 0xe5, 0xd6, 0xd5, 0xd1, 0xd3, 0xd3, 0xce, 0xd3, 0xce, 0xd1, 0xd1, 0xd5, 0xc7, 0xd5, 0xd8, 0xd1, 0xd1, 0xe3, 0xd8, 0xd1, 0xd8, 0xd8, 0xeb, 0xe5, 0xca, 0xca, 0xca, 0xd2, 0xc2, 0xc4, 0xca, 0xc4, 0xca, 0xc7, 0xbe, 0xba, 0xae, 0xa9, 0xba, 0x91, 0x5e, 0x66, 0x66, 0x62, 0x62, 0x64, 0x64, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x65, 0x60, 0x60, 0x92, 0xd5, 0xc6, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc3, 0xc9, 0xc3, 0xc3, 0xc5, 0xc3, 0xc3, 0xc7, 0xf4, 0xff, 0x1f, 0x1f, 0x1d, 0x1c, 0x20, 0x20, 0x20, 0xf5, 0x04, 0x68, 0x64, 0x66, 0x6b, 0x66, 0x68, 0x66, 0x68, 0x68, 0x66, 0x64, 0x66, 0x68, 0x68, 0x64, 0x66, 0x6b, 0x66, 0x65, 0x62, 0x5d, 0x6a, 0x89, 0xda, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xee, 0x01, 0xec, 0xc1, 0xb9, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0xc2, 0xef, 0xef, 0xf8, 0x4c, 0x25, 0x25, 0x01, 0xd4, 0x5c, 0x00, 0x49, 0x4b, 0x49, 0xb3, 0x01, 0xd9, 0xc4, 0xbe, 0xc0, 0xd5, 0xd1, 0xc7, 0xd1, 0xce, 0xc7, 0xd1, 0xce, 0xd1, 0xd1, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xc7, 0xd1, 0xc7, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xc7, 0xc6, 0xc7, 0xce, 0xd1, 0xce, 0xce, 0xc7, 0xc6, 0xc6, 0xc6, 0xc9, 0xc6, 0xcc, 0xd0, 0xd0, 0xd0, 0xc5, 0xc8, 0xcc, 0xcf, 0xd0, 0xd0, 0xd3, 0xd5, 0xd5, 0xc7, 0xd6, 0xe5, 0xf0, 0xac, 0x00, 0x4e, 0x28, 0x49, 0x57, 0x61, 0xd7, 0xeb, 0xd8, 0xc7, 0xc7, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd5, 0xd8, 0xd8, 0xdc, 0xdc, 0xe1, 0xf0, 0xed, 0xd9, 0xbe, 0xd2, 0xd2, 0xd6, 0xd9, 0xb9, 0xb0, 0xcb, 0xd2, 0xcb, 0xc2, 0xc2, 0xca, 0xc2, 0xc4, 0xc4, 0xbe, 0xba, 0xae, 0xba, 0xbe, 0x82, 0x5f, 0x67, 0x5f, 0x67, 0x64, 0x66, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x65, 0x60, 0x63, 0xb6, 0xd0, 0xc8, 0xc8, 0xc8, 0xc9, 0xc9, 0xc8, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xc5, 0xc8, 0xc5, 0xc5, 0xc8, 0xc9, 0xc3, 0xc9, 0xc3, 0xc5, 0xc3, 0xc6, 0xc4, 0xf7, 0xff, 0x1f, 0x1e, 0x1d, 0x20, 0xff, 0x20, 0x21, 0x37, 0x2e, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68, 0x66, 0x62, 0x60, 0x66, 0x6b, 0x6b, 0x67, 0x68, 0x6b, 0x6a, 0x62, 0x62, 0x5d, 0x61, 0x89, 0xd4, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xe9, 0xc1, 0xc2, 0xc4, 0xc4, 0xbe, 0xbd, 0xbe, 0xbd, 0xed, 0xef, 0xf0, 0xf8, 0xf8, 0x25, 0x01, 0xb3, 0x28, 0x00, 0x49, 0x49, 0x00, 0xa6, 0x01, 0xe7, 0xd9, 0xd8, 0xd8, 0xd5, 0xd2, 0xd1, 0xd6, 0xd9, 0xdd, 0xe3, 0xe3, 0xdd, 0xe3, 0xe3, 0xe5, 0xe5, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe5, 0xe3, 0xe3, 0xdd, 0xe3, 0xdd, 0xe3, 0xdd, 0xe3, 0xdd, 0xd8, 0xd2, 0xd5, 0xd6, 0xd8, 0xd8, 0xd8, 0xd1, 0xd5, 0xd1, 0xce, 0xce, 0xc0, 0xce, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xce, 0xd3, 0xc0, 0xd1, 0xd1, 0xd8, 0xeb, 0x01, 0x73, 0x00, 0x49, 0x4f, 0x4f, 0x28, 0x61, 0xcb, 0xed, 0xca, 0xd9, 0xd8, 0xd1, 0xd1, 0xce, 0xd6, 0xdd, 0xe3, 0xeb, 0xe5, 0xed, 0xeb, 0xd9, 0xbe, 0x7e, 0x80, 0xca, 0xa5, 0xb9, 0x9d, 0x99, 0xb0, 0xd2, 0xd9, 0xdb, 0xd2, 0xca, 0xd2, 0xca, 0xca, 0xca, 0xbe, 0xc4, 0xba, 0xa5, 0xba, 0xb0, 0x69, 0x62, 0x67, 0x5f, 0x68, 0x66, 0x66, 0x66, 0x64, 0x62, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x68, 0x65, 0x5e, 0x76, 0xd3, 0xc9, 0xc3, 0xc8, 0xc8, 0xc8, 0xc9, 0xc8, 0xc5, 0xc9, 0xc9, 0xc9, 0xc8, 0xc5, 0xc5, 0xc5, 0xc8, 0xc5, 0xc9, 0xc3, 0xc5, 0xc5, 0xc5, 0xc3, 0xc6, 0xf4, 0xf7, 0x20, 0x1f, 0x1e, 0x1d, 0x1d, 0xff, 0x22, 0xfc, 0x04, 0xf2, 0x68, 0x68, 0x67, 0x68, 0x68, 0x67, 0x68, 0x68, 0x6b, 0x6b, 0x66, 0x60, 0x5f, 0x68, 0x61, 0x61, 0x5f, 0x65, 0x96, 0xe6, 0x01, 0x01, 0xf8, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xe9, 0xc1, 0xb9, 0xbd, 0xc2, 0xc2, 0xc4, 0xbd, 0xbd, 0xef, 0xef, 0x4c, 0xee, 0xf8, 0x01, 0x01, 0x89, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x89, 0xec, 0xf0, 0xeb, 0xeb, 0xeb, 0xeb, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xed, 0xeb, 0xeb, 0xe3, 0xe5, 0xe3, 0xe5, 0xe3, 0xe3, 0xdd, 0xd6, 0xd5, 0xd6, 0xd1, 0xd2, 0xd1, 0xd8, 0xd1, 0xd1, 0xd9, 0xdf, 0xef, 0xe6, 0x28, 0x00, 0x00, 0x28, 0x4b, 0x4f, 0x61, 0xcb, 0xf0, 0xd7, 0xdc, 0xe5, 0xe3, 0xe5, 0xeb, 0xeb, 0xeb, 0xe7, 0xcb, 0xbd, 0x89, 0x72, 0x56, 0x4d, 0x00, 0x6f, 0xeb, 0xb0, 0x8d, 0xa5, 0xb9, 0xa5, 0xca, 0xd9, 0xd2, 0xd6, 0xcb, 0xca, 0xca, 0xc2, 0xc4, 0xc4, 0xd1, 0xbe, 0xb0, 0xc7, 0xae, 0x62, 0x60, 0x66, 0x60, 0x67, 0x62, 0x62, 0x66, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x5b, 0x8c, 0xdd, 0xc5, 0xc3, 0xc8, 0xc9, 0xc9, 0xc9, 0xc8, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xc8, 0xc5, 0xc8, 0xc5, 0xc9, 0xc5, 0xc9, 0xc5, 0xc5, 0xc5, 0xc6, 0xc4, 0xf4, 0xff, 0x20, 0x1f, 0x1f, 0x1f, 0x20, 0xff, 0x22, 0xfa, 0xf2, 0xf2, 0x66, 0x66, 0x68, 0x66, 0x68, 0x66, 0x68, 0x64, 0x62, 0x62, 0x65, 0x68, 0x68, 0x5f, 0x65, 0x72, 0x8f, 0xe0, 0x01, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf8, 0xe0, 0xcb, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xed, 0xef, 0xef, 0xf0, 0x01, 0x01, 0xe9, 0x73, 0x00, 0x00, 0x28, 0x49, 0x00, 0x5a, 0xa0, 0xe0, 0xea, 0xe2, 0xdc, 0xda, 0xcb, 0xcb, 0x47, 0xb3, 0xa6, 0xa0, 0x96, 0x8f, 0x8f, 0x89, 0x83, 0x83, 0x7f, 0x7d, 0x7f, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x83, 0x89, 0x89, 0x8f, 0x96, 0x96, 0xa6, 0xac, 0xb3, 0xbd, 0xcb, 0xcb, 0xd4, 0xda, 0xdb, 0xe4, 0xea, 0xee, 0x4c, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xed, 0xef, 0xe5, 0xeb, 0xeb, 0xe7, 0xf0, 0xec, 0x7f, 0x00, 0x00, 0x4b, 0x4f, 0x28, 0x4b, 0x57, 0x7f, 0xda, 0xe8, 0xea, 0xe1, 0xda, 0xd6, 0xbd, 0xa0, 0x83, 0x70, 0xf1, 0x4f, 0x00, 0x51, 0x50, 0x56, 0x52, 0x6b, 0xd9, 0xc4, 0x87, 0x81, 0x94, 0xca, 0xd6, 0xd9, 0xdc, 0xe2, 0xe3, 0xd6, 0xca, 0xd2, 0xd2, 0xd6, 0xd6, 0xb9, 0xc4, 0xd2, 0xa5, 0x71, 0x62, 0x60, 0x66, 0x62, 0x66, 0x62, 0x66, 0x64, 0x62, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x60, 0x62, 0x5e, 0xc0, 0xd3, 0xc9, 0xc3, 0xc8, 0xc8, 0xc8, 0xc9, 0xc8, 0xc8, 0xc5, 0xc9, 0xc5, 0xc6, 0xc5, 0xc6, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc5, 0xc5, 0xbf, 0xc7, 0xf4, 0xf7, 0xff, 0x1d, 0x1f, 0x1f, 0x1f, 0x20, 0x21, 0x46, 0xf1, 0x6a, 0x68, 0x66, 0x68, 0x66, 0x66, 0x68, 0x64, 0x66, 0x65, 0x68, 0x65, 0x65, 0x61, 0xf1, 0x7d, 0xa0, 0xdb, 0x01, 0x01, 0xf0, 0xf0, 0x4c, 0xf8, 0x01, 0x01, 0xf8, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0xf8, 0xf0, 0x01, 0x01, 0xea, 0xe0, 0xda, 0xd4, 0xcb, 0xc2, 0xbd, 0xd2, 0xea, 0xf0, 0xef, 0x01, 0x01, 0xc1, 0x57, 0x00, 0x00, 0x4f, 0xf9, 0x49, 0x00, 0x57, 0xf2, 0x6e, 0x6a, 0x6b, 0x61, 0x5c, 0x5a, 0x57, 0x28, 0x28, 0x49, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x4b, 0x28, 0x54, 0x57, 0x5a, 0xf1, 0x65, 0xf2, 0x70, 0x73, 0xfb, 0xfb, 0x83, 0x89, 0x8f, 0xa6, 0xb3, 0xbd, 0xc1, 0xd4, 0xda, 0xde, 0xe6, 0xec, 0x4c, 0xf0, 0xef, 0xee, 0xef, 0xda, 0x89, 0x28, 0x00, 0xf9, 0x26, 0xf9, 0x28, 0x53, 0x53, 0x54, 0x70, 0xfb, 0x75, 0x73, 0x6e, 0x61, 0x59, 0x54, 0x4f, 0x28, 0x4a, 0x57, 0x5a, 0x5a, 0x58, 0x51, 0x51, 0x66, 0xd7, 0xd9, 0xbe, 0xb0, 0xc4, 0xdc, 0xd6, 0xd9, 0xd9, 0xdc, 0xd9, 0xd2, 0xca, 0xd2, 0xd2, 0xd6, 0xdc, 0xd9, 0xe3, 0xd6, 0xa5, 0x75, 0x63, 0x60, 0x62, 0x60, 0x66, 0x66, 0x66, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x60, 0x60, 0x77, 0xd5, 0xc9, 0xcc, 0xc8, 0xc9, 0xc8, 0xc9, 0xc9, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc6, 0xc5, 0xc6, 0xc5, 0xc9, 0xc5, 0xc5, 0xc5, 0xbf, 0xcc, 0xc4, 0xf7, 0xff, 0x20, 0x1d, 0x1f, 0x1f, 0x1f, 0x20, 0xfe, 0x07, 0x5f, 0x6a, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x64, 0x6a, 0x61, 0x5d, 0x65, 0x7f, 0xb3, 0xe0, 0x01, 0x01, 0x4c, 0xee, 0x01, 0x4c, 0x4c, 0x01, 0x01, 0x4c, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x4c, 0xea, 0xde, 0xcb, 0xbd, 0xb3, 0xbd, 0xcb, 0xef, 0x01, 0xec, 0x89, 0x00, 0x4f, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x49, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x28, 0x53, 0x4a, 0x5c, 0x5c, 0x2e, 0xf2, 0x70, 0x73, 0x72, 0xfb, 0xfb, 0x6a, 0x5a, 0x49, 0xf9, 0x26, 0x4b, 0x00, 0x4e, 0x4b, 0x57, 0x57, 0x57, 0x54, 0x56, 0x53, 0x54, 0x53, 0x56, 0x57, 0x5a, 0x5a, 0x57, 0x2c, 0x57, 0x5a, 0x51, 0x54, 0x53, 0x50, 0x59, 0xb9, 0xd6, 0xdc, 0xd2, 0xe5, 0xca, 0xd9, 0xe3, 0xd9, 0xd2, 0xd6, 0xd2, 0xd9, 0xe3, 0xeb, 0xe5, 0xe5, 0xeb, 0xc2, 0x7b, 0x60, 0x60, 0x60, 0x66, 0x67, 0x62, 0x64, 0x66, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x62, 0x66, 0x5b, 0x92, 0xdd, 0xc3, 0xc9, 0xcd, 0xc8, 0xc9, 0xc8, 0xc9, 0xc8, 0xc5, 0xc8, 0xc5, 0xc5, 0xc6, 0xc8, 0xc6, 0xc8, 0xc9, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xca, 0xf7, 0x20, 0x1d, 0x1d, 0x1f, 0x1d, 0x1c, 0x21, 0xfc, 0x65, 0x6c, 0x62, 0x68, 0x66, 0x68, 0x66, 0x66, 0x65, 0x68, 0x5f, 0x5a, 0x65, 0x89, 0xcb, 0xf8, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf8, 0x25, 0x01, 0x25, 0x25, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xea, 0xcb, 0xb9, 0xb3, 0xa0, 0xa0, 0xd4, 0x96, 0x51, 0x00, 0x4e, 0x49, 0x4e, 0x00, 0x26, 0xf9, 0x49, 0x00, 0x49, 0x00, 0x4b, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x49, 0x4b, 0x49, 0x49, 0x4b, 0xf9, 0x4b, 0x49, 0x49, 0x4b, 0x49, 0x4b, 0x49, 0x49, 0x4b, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x28, 0x28, 0xf9, 0x4b, 0x28, 0x5a, 0x5d, 0x5d, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x58, 0x57, 0x54, 0x4a, 0x54, 0x4a, 0x53, 0x53, 0x53, 0x58, 0x5d, 0xac, 0xd2, 0xd6, 0xd6, 0xc4, 0xd2, 0xd6, 0xc4, 0xbe, 0xbe, 0xb9, 0xb0, 0xb0, 0xac, 0x91, 0x8a, 0x81, 0x6f, 0x60, 0x5b, 0x5f, 0x66, 0x62, 0x66, 0x62, 0x66, 0x62, 0x66, 0x62, 0x66, 0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x66, 0x62, 0x66, 0x68, 0x5f, 0x68, 0x64, 0x60, 0x69, 0xd1, 0xce, 0xc8, 0xc8, 0xc5, 0xc9, 0xc8, 0xc9, 0xc9, 0xc8, 0xc8, 0xc5, 0xc5, 0xc5, 0xc8, 0xc6, 0xc9, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc6, 0xc7, 0xf7, 0xfe, 0x1d, 0x1f, 0x1c, 0x1d, 0x1d, 0x20, 0xff, 0xfb, 0x65, 0x63, 0x6c, 0x68, 0x66, 0x64, 0x6a, 0x66, 0x5d, 0x5d, 0x70, 0xa6, 0xe9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0xcb, 0xb3, 0xa6, 0x7f, 0x57, 0x00, 0x00, 0x4e, 0x4e, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4b, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x49, 0xf9, 0x4b, 0xf9, 0x4b, 0x49, 0x4b, 0x49, 0x49, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x49, 0x49, 0x00, 0x26, 0x00, 0x49, 0x49, 0x49, 0x00, 0x4b, 0x28, 0x57, 0x5a, 0x5d, 0x5f, 0x5b, 0x5d, 0x5b, 0x59, 0x58, 0x52, 0x54, 0x51, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x57, 0x5a, 0x5f, 0x5f, 0xa5, 0xd6, 0xca, 0xca, 0xdc, 0xd7, 0x81, 0x60, 0x5f, 0x5f, 0x5b, 0x5b, 0x59, 0x59, 0x56, 0x59, 0x5d, 0x5b, 0x5d, 0x64, 0x67, 0x62, 0x66, 0x62, 0x63, 0x62, 0x66, 0x62, 0x66, 0x62, 0x64, 0x62, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x62, 0x64, 0x64, 0x62, 0x68, 0x62, 0x5e, 0x85, 0xce, 0xc9, 0xcd, 0xc3, 0xc5, 0xc8, 0xc9, 0xc8, 0xc6, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc9, 0xc9, 0xc6, 0xc8, 0xc5, 0xc5, 0xc5, 0xc3, 0xc9, 0xc7, 0xca, 0xf7, 0xff, 0x1d, 0x1f, 0x1d, 0x1d, 0x20, 0xff, 0x0b, 0xfa, 0x66, 0x67, 0x67, 0x68, 0x68, 0x61, 0x5f, 0x61, 0x7d, 0x47, 0xec, 0x01, 0x01, 0x4c, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xea, 0xd4, 0xb9, 0x6a, 0x00, 0x4f, 0x00, 0x4e, 0x49, 0x4e, 0x49, 0x00, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x00, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4b, 0x49, 0x4b, 0x49, 0x4b, 0x4b, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0xf9, 0xf9, 0xf9, 0x4b, 0xf9, 0x49, 0x49, 0x49, 0x51, 0x57, 0x5c, 0x5c, 0x5d, 0x5b, 0x5d, 0x5b, 0x5f, 0x5b, 0x59, 0x58, 0x56, 0x56, 0x56, 0x56, 0x54, 0x54, 0x5a, 0x5a, 0x61, 0x65, 0x6e, 0x6b, 0xa0, 0xdc, 0xd9, 0xd9, 0xca, 0x81, 0x60, 0x5b, 0x60, 0x60, 0x60, 0x5f, 0x60, 0x60, 0x61, 0x62, 0x64, 0x64, 0x64, 0x62, 0x62, 0x66, 0x62, 0x66, 0x62, 0x66, 0x64, 0x66, 0x62, 0x64, 0x62, 0x66, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x62, 0x64, 0x68, 0x5f, 0x63, 0xba, 0xd3, 0xc3, 0xd0, 0xc5, 0xc8, 0xc8, 0xc9, 0xc9, 0xc8, 0xc8, 0xc8, 0xc5, 0xc5, 0xc5, 0xc8, 0xc6, 0xc9, 0xc3, 0xc8, 0xc5, 0xc5, 0xc6, 0xc7, 0xf4, 0xf4, 0xff, 0x20, 0x1f, 0x1f, 0x1c, 0x20, 0xff, 0x18, 0xfa, 0x65, 0x68, 0x6c, 0x61, 0x61, 0x5f, 0x6e, 0x89, 0xcb, 0xf8, 0x01, 0x01, 0x01, 0x4c, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf8, 0xf8, 0x01, 0x01, 0xf0, 0xef, 0x01, 0xee, 0x96, 0x57, 0x00, 0x4f, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0xf9, 0x49, 0x4b, 0x49, 0x4b, 0x4e, 0x4b, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x00, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x51, 0x54, 0x5a, 0x5d, 0x5d, 0x5d, 0x60, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5b, 0x58, 0x58, 0x56, 0x58, 0x61, 0x61, 0x64, 0x68, 0x68, 0x60, 0x79, 0x91, 0xa0, 0x88, 0x79, 0x60, 0x5d, 0x64, 0x60, 0x60, 0x62, 0x62, 0x62, 0x62, 0x61, 0x60, 0x61, 0x62, 0x62, 0x64, 0x62, 0x62, 0x66, 0x62, 0x63, 0x62, 0x66, 0x62, 0x66, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x66, 0x62, 0x66, 0x62, 0x5b, 0x7a, 0xd5, 0xce, 0xc8, 0xc5, 0xcd, 0xc5, 0xc9, 0xc8, 0xc9, 0xc6, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc9, 0xc9, 0xc6, 0xc8, 0xc5, 0xc5, 0xc5, 0xc7, 0xca, 0xf4, 0xf7, 0xff, 0x1d, 0x1d, 0x1c, 0x1d, 0x21, 0x21, 0x07, 0xf2, 0xf2, 0x61, 0x61, 0x66, 0x7d, 0xa6, 0xda, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0xbd, 0x5c, 0x4e, 0x4e, 0x00, 0x28, 0x4e, 0x49, 0x49, 0x4e, 0x4e, 0x49, 0x49, 0x4e, 0x49, 0x49, 0x00, 0x49, 0x49, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4b, 0x4e, 0x4b, 0x4e, 0x49, 0x4b, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x4e, 0x4b, 0x49, 0x4b, 0x4b, 0x4b, 0x4b, 0x49, 0x4b, 0x4e, 0x4b, 0x4e, 0x4b, 0x4e, 0x4b, 0x49, 0x49, 0x49, 0x4e, 0x4e, 0x4e, 0x53, 0x57, 0x5a, 0x5a, 0x5d, 0x5d, 0x61, 0x5d, 0x5d, 0x56, 0x5a, 0x59, 0x5d, 0x5f, 0x61, 0x5f, 0x5f, 0x60, 0x62, 0x64, 0x60, 0x64, 0x61, 0x60, 0x5f, 0x5b, 0x62, 0x67, 0x66, 0x5b, 0x5f, 0x5f, 0x60, 0x62, 0x61, 0x60, 0x61, 0x61, 0x61, 0x61, 0x66, 0x62, 0x60, 0x61, 0x62, 0x62, 0x62, 0x66, 0x62, 0x63, 0x64, 0x63, 0x64, 0x66, 0x62, 0x64, 0x62, 0x66, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x66, 0x62, 0x64, 0x64, 0x64, 0x66, 0x5f, 0x64, 0xa5, 0xce, 0xcc, 0xcf, 0xc3, 0xcd, 0xcd, 0xc8, 0xc6, 0xc9, 0xc9, 0xc8, 0xc5, 0xc8, 0xc5, 0xc5, 0xc9, 0xc6, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc7, 0xf4, 0xf7, 0xff, 0x20, 0x1f, 0x1d, 0x1d, 0x20, 0x20, 0x14, 0x04, 0x5a, 0x5d, 0x62, 0x89, 0xcb, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf8, 0x01, 0xf8, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x25, 0xf0, 0x01, 0x01, 0x01, 0x48, 0x65, 0x00, 0x00, 0x00, 0x28, 0x00, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0x4b, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0xf9, 0x49, 0xf9, 0x49, 0x4e, 0xf9, 0x49, 0xf9, 0x49, 0x49, 0xf9, 0x49, 0x4b, 0x49, 0xf9, 0x49, 0x49, 0x49, 0x4b, 0x49, 0x4b, 0x49, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e, 0x4e, 0x4f, 0x51, 0x53, 0x59, 0x5d, 0x5f, 0x5d, 0x5d, 0x58, 0x57, 0x53, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x51, 0x54, 0x59, 0x5f, 0x5f, 0x60, 0x5d, 0x60, 0x60, 0x60, 0x60, 0x66, 0x60, 0x5b, 0x56, 0x62, 0x62, 0x5f, 0x64, 0x65, 0x64, 0x65, 0x64, 0x65, 0x64, 0x62, 0x61, 0x61, 0x61, 0x62, 0x60, 0x66, 0x66, 0x62, 0x66, 0x62, 0x66, 0x62, 0x66, 0x62, 0x66, 0x62, 0x64, 0x62, 0x64, 0x64, 0x66, 0x62, 0x64, 0x62, 0x66, 0x62, 0x64, 0x66, 0x64, 0x64, 0x66, 0x5d, 0x7b, 0xd1, 0xc6, 0xd0, 0xc8, 0xc5, 0xcd, 0xc8, 0xc8, 0xc8, 0xc9, 0xc6, 0xc8, 0xc8, 0xc8, 0xc5, 0xc9, 0xc9, 0xc9, 0xc8, 0xc5, 0xc5, 0xc5, 0xc6, 0xc7, 0xf4, 0xf7, 0xff, 0x1f, 0x1f, 0x1d, 0x20, 0x1d, 0x18, 0x06, 0x54, 0x7d, 0xb9, 0xf0, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x4c, 0x01, 0x01, 0xee, 0x47, 0x4e, 0x00, 0x00, 0x4b, 0x00, 0x00, 0xf9, 0x49, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x49, 0x4b, 0x49, 0x4b, 0xf9, 0x4b, 0x49, 0x4b, 0x4e, 0x4b, 0x4e, 0x4b, 0x4e, 0x4e, 0x00, 0x4f, 0x54, 0x5a, 0x5f, 0xf1, 0x59, 0x5a, 0x58, 0x53, 0x4e, 0x00, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4f, 0x51, 0x59, 0x62, 0x64, 0x64, 0x60, 0x62, 0x66, 0x62, 0x60, 0x5f, 0x66, 0x60, 0x62, 0x68, 0x66, 0x5d, 0x68, 0x62, 0x5f, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x64, 0x66, 0x66, 0x64, 0x62, 0x64, 0x62, 0x66, 0x62, 0x66, 0x62, 0x66, 0x62, 0x66, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x66, 0x63, 0x60, 0x9d, 0xd8, 0xc9, 0xd3, 0xc9, 0xc8, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xc8, 0xc5, 0xc5, 0xc9, 0xc3, 0xc8, 0xc5, 0xc5, 0xc5, 0xc6, 0xf4, 0xf7, 0x20, 0x20, 0x1f, 0x1f, 0x1c, 0xff, 0x20, 0x18, 0x0b, 0xe7, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0x01, 0x01, 0xec, 0x96, 0x00, 0x00, 0x00, 0x49, 0x49, 0xf9, 0xf9, 0x49, 0x4e, 0x4e, 0x4e, 0x49, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x00, 0x49, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4b, 0x49, 0x4b, 0x49, 0x4b, 0x49, 0x4b, 0x4e, 0x4b, 0x4e, 0x4b, 0x49, 0x4b, 0x49, 0x49, 0x4b, 0x4e, 0x4e, 0x4e, 0x4d, 0x4f, 0x4e, 0x53, 0x5a, 0x5f, 0xf1, 0x5f, 0x5c, 0x57, 0x53, 0x4e, 0x00, 0x4e, 0x4f, 0x4e, 0x4f, 0x4e, 0x4e, 0x4e, 0x51, 0x59, 0x61, 0x61, 0x62, 0x62, 0x60, 0x5f, 0x62, 0x62, 0x61, 0x62, 0x61, 0x60, 0x61, 0x62, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64, 0x62, 0x64, 0x62, 0x62, 0x62, 0x60, 0x62, 0x62, 0x62, 0x64, 0x63, 0x62, 0x62, 0x64, 0x62, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x62, 0x63, 0x62, 0x64, 0x65, 0x65, 0x65, 0x64, 0x66, 0x63, 0x5b, 0x74, 0xd3, 0xce, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc9, 0xca, 0xf7, 0xff, 0x20, 0x1e, 0x1f, 0x1d, 0xff, 0xff, 0xfe, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0xf8, 0x7f, 0x4b, 0x00, 0x00, 0x4e, 0x00, 0x49, 0x49, 0xf9, 0x49, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x49, 0x00, 0x49, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4b, 0x4e, 0x4e, 0x4b, 0x49, 0x4b, 0xf9, 0x49, 0xf9, 0x4b, 0x4f, 0x4e, 0x00, 0x4e, 0x51, 0x57, 0x61, 0xf1, 0xf1, 0x5a, 0x57, 0x4f, 0x4f, 0x49, 0x4e, 0x49, 0x49, 0x4b, 0x4f, 0x00, 0x00, 0x4f, 0x58, 0x5d, 0x61, 0x5f, 0x60, 0x62, 0x60, 0x62, 0x60, 0x61, 0x61, 0x61, 0x62, 0x61, 0x62, 0x61, 0x60, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64, 0x62, 0x64, 0x62, 0x62, 0x62, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x62, 0x64, 0x67, 0x55, 0xa2, 0xd5, 0xc9, 0xc9, 0xc9, 0xcd, 0xc9, 0xcd, 0xc9, 0xcd, 0xc9, 0xcd, 0xc9, 0xc8, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc8, 0xc9, 0xc7, 0xf4, 0xf7, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x20, 0x22, 0x24, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x00, 0x4e, 0x4e, 0x00, 0x00, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4b, 0x4b, 0x4e, 0x4b, 0x4e, 0x49, 0x4b, 0x4e, 0x4b, 0x49, 0x4b, 0xf9, 0x49, 0xf9, 0x00, 0x28, 0x4b, 0x00, 0x4e, 0x51, 0x5c, 0x61, 0x65, 0x5d, 0x54, 0x51, 0x4f, 0x4e, 0x4e, 0x4e, 0x4b, 0x51, 0x4b, 0x4e, 0x00, 0x4e, 0x53, 0x58, 0xf1, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x62, 0x60, 0x61, 0x62, 0x61, 0x61, 0x60, 0x61, 0x62, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64, 0x62, 0x62, 0x64, 0x62, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x64, 0x66, 0x64, 0x66, 0x64, 0x66, 0x62, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x60, 0x69, 0xd5, 0xd3, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xcd, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xc8, 0xc8, 0xc5, 0xc9, 0xce, 0xf4, 0xf4, 0xfe, 0xfe, 0xff, 0x18, 0x21, 0x22, 0x23, 0x24, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0xee, 0x01, 0xa6, 0x00, 0x4e, 0x49, 0x49, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x49, 0x49, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x4b, 0x4e, 0x49, 0x4b, 0xf9, 0x4b, 0xf9, 0x28, 0xf9, 0x49, 0x49, 0x53, 0x5c, 0x65, 0xf1, 0x57, 0x4f, 0x4b, 0x4e, 0x4e, 0x4b, 0x4f, 0x4b, 0x4f, 0x4b, 0x4e, 0x00, 0x4e, 0x57, 0xf1, 0x61, 0x61, 0x5f, 0x61, 0x60, 0x61, 0x60, 0x5f, 0x62, 0x62, 0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64, 0x62, 0x64, 0x64, 0x62, 0x64, 0x62, 0x64, 0x62, 0x66, 0x62, 0x66, 0x64, 0x64, 0x66, 0x64, 0x66, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x68, 0x5f, 0x5b, 0x92, 0xd8, 0xd3, 0xc5, 0xc5, 0xc5, 0xc8, 0xcd, 0xc8, 0xcd, 0xc8, 0xcc, 0xcd, 0xc8, 0xc8, 0xc5, 0xc8, 0xc9, 0xc9, 0xc9, 0xc5, 0xc8, 0xc6, 0xd2, 0xf4, 0xf7, 0xf6, 0xfe, 0x21, 0x23, 0x23, 0x24, 0x25, 0x25, 0x25, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xcb, 0x4e, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4b, 0x4b, 0x4e, 0x49, 0x4e, 0x49, 0x4b, 0x4e, 0x4f, 0x4e, 0x49, 0x4b, 0xf9, 0x4b, 0xf9, 0x49, 0x49, 0x28, 0x57, 0x5c, 0x5a, 0x51, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4d, 0x00, 0x00, 0x4e, 0x51, 0x5d, 0xf1, 0x62, 0xf1, 0x5f, 0x61, 0x62, 0x61, 0x60, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x65, 0x62, 0x65, 0x64, 0x62, 0x65, 0x62, 0x65, 0x64, 0x64, 0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x62, 0x5e, 0x71, 0xd5, 0xc6, 0xd3, 0xc5, 0xcd, 0xc8, 0xcd, 0xc8, 0xcc, 0xc9, 0xce, 0xc9, 0xc9, 0xc9, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xc8, 0xc6, 0xc9, 0xca, 0xc2, 0xf7, 0xf7, 0x22, 0x23, 0x24, 0x24, 0x25, 0x01, 0x4c, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x25, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0xee, 0x6a, 0x00, 0x4e, 0x00, 0x4b, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x49, 0x4b, 0x4f, 0x4e, 0x4f, 0x4e, 0xf9, 0x4e, 0xf9, 0x4b, 0xf9, 0x4f, 0x4a, 0x57, 0x54, 0x4f, 0x4e, 0x4b, 0x4e, 0x4e, 0x4f, 0x4f, 0x4e, 0x4e, 0x4e, 0x4d, 0x00, 0x56, 0x5d, 0x61, 0x61, 0x61, 0x5f, 0x61, 0x61, 0x61, 0x62, 0x61, 0x62, 0x61, 0x60, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x61, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x65, 0x62, 0x65, 0x65, 0x65, 0x65, 0x62, 0x65, 0x62, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x64, 0x65, 0x65, 0x62, 0x64, 0x63, 0x60, 0x92, 0xd8, 0xc3, 0xcc, 0xcc, 0xcc, 0xc8, 0xce, 0xc9, 0xce, 0xce, 0xce, 0xc9, 0xce, 0xc9, 0xc9, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xc6, 0xc7, 0xca, 0xf4, 0xda, 0x23, 0x24, 0x24, 0x24, 0x25, 0x01, 0xee, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x89, 0x49, 0x00, 0x49, 0x00, 0xf9, 0x26, 0x00, 0x00, 0x4b, 0x4e, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4b, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x50, 0x4f, 0x4e, 0x4e, 0x49, 0x4e, 0x4b, 0x4b, 0x53, 0x57, 0x51, 0x4f, 0x4b, 0x4b, 0x4f, 0x4f, 0x4e, 0x4e, 0x4f, 0x4f, 0x4e, 0x4d, 0x4f, 0x54, 0x61, 0x65, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x61, 0x62, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x60, 0x60, 0x62, 0x62, 0x60, 0x62, 0x5f, 0x61, 0x61, 0x64, 0x65, 0x65, 0x61, 0x5f, 0x5a, 0x58, 0x5a, 0x5d, 0x5d, 0x5d, 0x5f, 0x61, 0x61, 0x65, 0x64, 0xf2, 0x66, 0x65, 0x68, 0x68, 0x65, 0x64, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x62, 0x62, 0x62, 0x60, 0x6b, 0x5e, 0x74, 0xc0, 0xd0, 0xc6, 0xc5, 0xc9, 0xc9, 0xce, 0xc9, 0xce, 0xc9, 0xd1, 0xc9, 0xce, 0xc9, 0xc9, 0xc9, 0xc3, 0xc8, 0xc8, 0xc9, 0xc7, 0xc7, 0xf4, 0xda, 0xe9, 0x24, 0x24, 0x24, 0x24, 0xf8, 0x24, 0xee, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0xf0, 0xf8, 0x01, 0xf8, 0x01, 0x01, 0xd4, 0x5a, 0x00, 0x00, 0x26, 0x49, 0x00, 0x00, 0x28, 0x00, 0x00, 0x4e, 0x00, 0x4d, 0x4e, 0x4e, 0x49, 0x00, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x49, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x4b, 0x4f, 0x4f, 0x4e, 0x4e, 0x51, 0x53, 0x28, 0x4b, 0x53, 0x54, 0x51, 0x4d, 0x4d, 0x4e, 0x4b, 0x4e, 0x4e, 0x4e, 0x4f, 0x4f, 0x4d, 0x4e, 0x4f, 0x56, 0x5f, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x61, 0x60, 0x61, 0x60, 0x61, 0x62, 0x60, 0x60, 0x60, 0x61, 0x60, 0x61, 0x5f, 0x61, 0x62, 0x65, 0x62, 0x5d, 0x57, 0x51, 0x4f, 0x4e, 0x00, 0x4d, 0x00, 0x4d, 0x4b, 0x4e, 0x4e, 0x51, 0x4f, 0x51, 0x54, 0x59, 0x5d, 0x5f, 0x61, 0x65, 0x62, 0xf2, 0x68, 0xf2, 0x64, 0x65, 0x64, 0x65, 0x68, 0x68, 0x66, 0x6b, 0x6b, 0x60, 0x5b, 0x63, 0x92, 0xd5, 0xc9, 0xd0, 0xc8, 0xcc, 0xc9, 0xd0, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xd0, 0xd0, 0xcc, 0xc0, 0xc4, 0xf4, 0xe0, 0x24, 0x24, 0xf8, 0xf8, 0xec, 0xf8, 0x24, 0x25, 0x25, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0xf0, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x7f, 0x00, 0x00, 0x26, 0xf9, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x00, 0x00, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4b, 0x49, 0x4e, 0x4e, 0x49, 0x4b, 0x00, 0xf9, 0x4f, 0x26, 0x00, 0x26, 0x4b, 0x4a, 0x57, 0x28, 0x4d, 0x4e, 0x50, 0x4f, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x50, 0x5a, 0x5f, 0x62, 0x61, 0x5f, 0x62, 0x61, 0x60, 0x61, 0x60, 0x61, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x62, 0x62, 0x60, 0x61, 0x62, 0x61, 0x65, 0x5f, 0x5a, 0x54, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x51, 0x54, 0x57, 0x5f, 0x61, 0x64, 0xf2, 0x68, 0xf2, 0x65, 0x59, 0x67, 0x66, 0x5b, 0x5e, 0x67, 0x69, 0x74, 0xd1, 0xd3, 0xc6, 0xc9, 0xd0, 0xc9, 0xc9, 0xc9, 0xc3, 0xc9, 0xc9, 0xd0, 0xd0, 0xd0, 0xc6, 0xc6, 0xc0, 0xc6, 0xc0, 0xc4, 0xcb, 0xf4, 0x23, 0x23, 0x24, 0x23, 0xec, 0xf8, 0x01, 0xf0, 0x25, 0xf8, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x48, 0x2c, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x26, 0x27, 0xf9, 0x26, 0x49, 0x4b, 0x00, 0x4e, 0x49, 0x00, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4b, 0x4e, 0x4e, 0x49, 0x4e, 0x4b, 0x4b, 0x27, 0x26, 0x26, 0x02, 0x2c, 0x31, 0x31, 0x2e, 0x2c, 0x2e, 0x2e, 0x59, 0x4b, 0x4e, 0x4e, 0x4b, 0x4f, 0x4f, 0x4e, 0x4d, 0x51, 0x5a, 0x61, 0x64, 0x62, 0x61, 0x5f, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x62, 0x61, 0x5f, 0x61, 0x62, 0x65, 0x61, 0x5a, 0x51, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x53, 0x5d, 0xf1, 0x65, 0x65, 0x6a, 0x68, 0x62, 0x68, 0x6e, 0x5e, 0x60, 0xbe, 0xd5, 0xc0, 0xd5, 0xc0, 0xd0, 0xc9, 0xcc, 0xc9, 0xcc, 0xc6, 0xc8, 0xce, 0xc0, 0xc7, 0xd1, 0xd6, 0xd2, 0xf4, 0xcb, 0xf6, 0x22, 0x23, 0x24, 0x23, 0x24, 0x24, 0x01, 0x4c, 0xec, 0xea, 0xed, 0xf8, 0xe6, 0xe0, 0xda, 0xd4, 0xd4, 0xcb, 0xd4, 0xd7, 0xde, 0xe1, 0xea, 0xee, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x25, 0x0a, 0x26, 0x26, 0x29, 0x2b, 0x31, 0x2f, 0x2f, 0x33, 0x2d, 0x2a, 0x26, 0x26, 0x26, 0x4b, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x4b, 0x4e, 0x49, 0x4e, 0x49, 0x4b, 0xf9, 0x27, 0x27, 0x2d, 0x33, 0x34, 0x33, 0x33, 0x33, 0x31, 0x2e, 0x2e, 0xf1, 0x2e, 0x57, 0x28, 0x4e, 0x00, 0x4d, 0x4e, 0x51, 0x5d, 0x61, 0x62, 0x62, 0x61, 0x60, 0x62, 0x62, 0x62, 0x60, 0x62, 0x62, 0x62, 0x60, 0x62, 0x60, 0x61, 0x62, 0x61, 0x62, 0x61, 0x61, 0x61, 0x65, 0x61, 0x5c, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x57, 0x5c, 0x61, 0x64, 0x65, 0x68, 0x62, 0x70, 0x91, 0xdc, 0xd1, 0xd6, 0xd5, 0xce, 0xce, 0xd1, 0xce, 0xd1, 0xd1, 0xd5, 0xd1, 0xd1, 0xd2, 0xc1, 0xb3, 0x46, 0xfc, 0x0b, 0x0d, 0x0d, 0x12, 0x18, 0x18, 0xff, 0xfe, 0xf7, 0xf7, 0xc1, 0x47, 0xa0, 0x83, 0x77, 0x6e, 0xf2, 0xf2, 0x62, 0x61, 0x60, 0x60, 0x66, 0x68, 0x70, 0x75, 0x83, 0xa0, 0xc1, 0xda, 0xec, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x25, 0x01, 0x48, 0x2e, 0x26, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2f, 0x31, 0x2c, 0x26, 0x00, 0x26, 0x4e, 0x4e, 0x00, 0x4e, 0x4e, 0x49, 0x00, 0x4e, 0x00, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x00, 0x49, 0x00, 0x4e, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e, 0x4b, 0x49, 0x49, 0x4e, 0x49, 0x4e, 0x4b, 0x4f, 0x4b, 0x2a, 0x2f, 0x39, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x33, 0x31, 0x2e, 0x5c, 0x5c, 0x4b, 0x00, 0x4e, 0x53, 0x5d, 0x61, 0x61, 0x62, 0x61, 0x5f, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x60, 0x61, 0x60, 0x62, 0x61, 0x60, 0x61, 0x61, 0x61, 0x65, 0x61, 0x5a, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x57, 0x5d, 0x65, 0x65, 0x75, 0xa6, 0xa5, 0xac, 0xbe, 0xb0, 0xbe, 0xbe, 0xb9, 0xb9, 0xb0, 0xa5, 0x94, 0x8a, 0x7f, 0x79, 0x37, 0x05, 0x05, 0x08, 0x0c, 0x10, 0x15, 0x10, 0x12, 0x0e, 0x0d, 0x0b, 0x07, 0x39, 0xfa, 0x61, 0x5d, 0x5b, 0x5e, 0x5f, 0x60, 0x64, 0x67, 0x71, 0x76, 0x77, 0x7a, 0x7a, 0x79, 0x73, 0x6e, 0x2e, 0x65, 0xf2, 0xfb, 0x96, 0xd4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x01, 0x40, 0x29, 0x2a, 0x2b, 0x2b, 0x29, 0x37, 0x44, 0x44, 0x3c, 0x2d, 0x2b, 0x2d, 0x37, 0x2a, 0x26, 0x00, 0x49, 0x49, 0x49, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4b, 0x4e, 0x49, 0x4b, 0x49, 0x4b, 0x4b, 0x4e, 0x4e, 0x49, 0x4b, 0x4b, 0x26, 0x34, 0x3a, 0x3a, 0x3a, 0x3d, 0x34, 0x2b, 0x2b, 0x2d, 0x2a, 0x37, 0x3c, 0x37, 0x31, 0x2e, 0x57, 0x53, 0x54, 0x5d, 0x65, 0x61, 0x61, 0x61, 0x61, 0x62, 0x60, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x60, 0x62, 0x60, 0x62, 0x61, 0x62, 0x61, 0x65, 0x61, 0x54, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x5c, 0xf2, 0x73, 0xfb, 0xfb, 0x70, 0xf1, 0x28, 0x00, 0x00, 0x00, 0x4b, 0xf9, 0x49, 0xf9, 0x49, 0x49, 0xf9, 0x49, 0xf9, 0x00, 0x51, 0x28, 0x5a, 0x5d, 0x5c, 0x5f, 0x65, 0x68, 0x6b, 0x6f, 0x71, 0x6f, 0x6f, 0x6b, 0x6a, 0xf2, 0x65, 0x31, 0x2c, 0x03, 0x03, 0x08, 0x0e, 0x15, 0x15, 0x13, 0x13, 0x13, 0x12, 0x0e, 0x08, 0x05, 0xfa, 0x04, 0xfa, 0xf2, 0x67, 0x6c, 0x69, 0x71, 0x6f, 0x76, 0x77, 0x7a, 0x7c, 0x80, 0x80, 0x7b, 0x81, 0x84, 0x89, 0x89, 0x7f, 0xfb, 0x5a, 0x4a, 0xf1, 0x7d, 0xcb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0xf0, 0xf0, 0x25, 0x25, 0xe0, 0x2b, 0x2c, 0x2d, 0x4a, 0x26, 0x3c, 0xe6, 0xf8, 0x25, 0xe9, 0x48, 0x37, 0x2b, 0x33, 0x37, 0x2a, 0x26, 0x00, 0x49, 0x00, 0x49, 0x00, 0x4b, 0x49, 0x49, 0x00, 0x49, 0x49, 0xf9, 0x4b, 0x00, 0x4d, 0x4e, 0x4d, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x4e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x4f, 0x4e, 0x4f, 0x4f, 0x4f, 0x4e, 0x4e, 0x4f, 0x28, 0x4b, 0x49, 0x4e, 0x00, 0x51, 0x4e, 0x49, 0x26, 0x26, 0x34, 0x3b, 0x3b, 0x3a, 0x3d, 0x30, 0x26, 0x00, 0x26, 0x26, 0x26, 0x27, 0x31, 0x44, 0xfb, 0x31, 0x2e, 0xf1, 0x5f, 0x5f, 0x62, 0x60, 0x61, 0x61, 0x62, 0x61, 0x60, 0x60, 0x62, 0x60, 0x62, 0x60, 0x60, 0x60, 0x62, 0x62, 0x60, 0x62, 0x62, 0x60, 0x61, 0x68, 0x5c, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xa6, 0x48, 0xe9, 0xf8, 0x4c, 0x25, 0x4c, 0xf8, 0xec, 0xda, 0xa6, 0x73, 0x00, 0x00, 0x00, 0x28, 0x4e, 0x28, 0x00, 0x49, 0x4f, 0x00, 0x28, 0x54, 0x5a, 0x58, 0x58, 0x56, 0x59, 0x59, 0x5f, 0x64, 0x68, 0x6a, 0x6a, 0x68, 0x6a, 0x68, 0xf2, 0x31, 0x2f, 0x03, 0x38, 0x10, 0x15, 0x13, 0x13, 0x15, 0x13, 0x13, 0x10, 0x0c, 0x08, 0x31, 0xfa, 0x70, 0x73, 0x68, 0x6f, 0x71, 0x6c, 0x6c, 0x69, 0x67, 0x67, 0x74, 0x80, 0x91, 0x9d, 0xb0, 0xae, 0xa5, 0xa0, 0x8d, 0x7e, 0x79, 0x7e, 0x94, 0x7d, 0x56, 0x4f, 0x54, 0x83, 0xec, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0xf0, 0xf0, 0xf0, 0x25, 0x24, 0x46, 0x29, 0x30, 0x29, 0x26, 0x37, 0xe6, 0x25, 0xe6, 0xe0, 0x25, 0x01, 0x25, 0x0a, 0x2b, 0x37, 0x39, 0x26, 0x00, 0x26, 0x28, 0xf9, 0xf9, 0xf9, 0x00, 0x00, 0x4b, 0x4b, 0xf9, 0x00, 0x00, 0x50, 0x50, 0x4d, 0x4f, 0x52, 0x58, 0x5f, 0x5f, 0x66, 0x68, 0x68, 0x68, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x62, 0x5f, 0x5d, 0x50, 0x4e, 0x4d, 0x00, 0x4d, 0x4e, 0x4d, 0x4d, 0x00, 0x00, 0x49, 0xf9, 0x4f, 0x50, 0x4e, 0x51, 0x26, 0x27, 0x2f, 0x3a, 0x3b, 0x3b, 0x3d, 0x2b, 0x29, 0x4b, 0x00, 0x00, 0x27, 0x26, 0x00, 0x00, 0x37, 0x0a, 0x33, 0xf1, 0x5c, 0x62, 0x5f, 0x60, 0x62, 0x61, 0x61, 0x61, 0x62, 0x60, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x60, 0x62, 0x62, 0x62, 0x61, 0x62, 0x62, 0x5c, 0x53, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xac, 0xec, 0x01, 0x01, 0x4c, 0x25, 0x4c, 0x25, 0x25, 0x25, 0x25, 0x25, 0x01, 0x01, 0x25, 0xde, 0x7f, 0x54, 0x00, 0x00, 0x49, 0x53, 0x4f, 0x49, 0x53, 0x53, 0x57, 0x5d, 0x59, 0x59, 0x59, 0x5b, 0x59, 0x5d, 0x5d, 0x5f, 0x61, 0x61, 0x68, 0xf2, 0x65, 0xfa, 0x03, 0x05, 0x0c, 0x15, 0x15, 0x13, 0x13, 0x13, 0x13, 0x10, 0x10, 0x0c, 0x08, 0xfa, 0x70, 0x69, 0x6f, 0x69, 0x6f, 0x6b, 0x63, 0x67, 0x5e, 0x6c, 0x8d, 0xc4, 0xe5, 0xeb, 0xeb, 0xeb, 0xd9, 0xd9, 0xd9, 0xd6, 0xd6, 0xd6, 0xd2, 0xb9, 0x82, 0x8d, 0xa5, 0x75, 0x50, 0x4f, 0x61, 0xc1, 0x01, 0x4c, 0x01, 0xe9, 0x25, 0x25, 0x25, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x01, 0xf0, 0x25, 0x25, 0x3c, 0x2b, 0x2d, 0x26, 0x26, 0x47, 0x01, 0xe0, 0xe0, 0xc1, 0x48, 0x48, 0xe9, 0xda, 0x3c, 0x2a, 0x37, 0x33, 0x00, 0x00, 0x28, 0x00, 0x4f, 0x4f, 0x4e, 0x4e, 0x00, 0x00, 0x4e, 0x53, 0x54, 0x5f, 0x66, 0x72, 0x77, 0x79, 0x7a, 0x79, 0x7b, 0x7d, 0x7b, 0x79, 0x7a, 0x79, 0x79, 0x79, 0x7d, 0x79, 0x79, 0x79, 0x77, 0xfb, 0x76, 0x6a, 0x66, 0x59, 0x54, 0x50, 0x4f, 0x4d, 0x49, 0x49, 0x4b, 0x4e, 0x51, 0x00, 0x4e, 0x26, 0x29, 0x38, 0x3a, 0x3b, 0x3a, 0x34, 0x29, 0x37, 0x4a, 0x00, 0x4d, 0x4e, 0x00, 0x51, 0x00, 0x4a, 0x3c, 0x39, 0x31, 0xf1, 0x62, 0x5f, 0x60, 0x60, 0x61, 0x61, 0x61, 0x62, 0x60, 0x60, 0x60, 0x62, 0x60, 0x60, 0x60, 0x62, 0x60, 0x62, 0x64, 0x5f, 0x64, 0x62, 0x5f, 0x4f, 0x4d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x73, 0xa6, 0xe0, 0x4c, 0x01, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0x01, 0xf0, 0xf8, 0x25, 0xf8, 0xee, 0xf0, 0xec, 0x01, 0x01, 0xb3, 0xf2, 0x4f, 0x4f, 0x4e, 0x4f, 0x4f, 0x4f, 0x5a, 0x5a, 0x5d, 0x59, 0x59, 0x5b, 0x5b, 0x5b, 0x59, 0x5d, 0x5a, 0x5d, 0x5d, 0x5c, 0x04, 0x04, 0x2f, 0x06, 0x0c, 0x15, 0x15, 0x13, 0x13, 0x13, 0x13, 0x10, 0x10, 0x0c, 0x08, 0x05, 0xfa, 0x72, 0x6c, 0x69, 0x67, 0x68, 0x66, 0x64, 0x76, 0xa5, 0xe1, 0xef, 0xf0, 0xef, 0xed, 0xef, 0xf0, 0xf0, 0xf0, 0xef, 0xed, 0xe1, 0xda, 0xd2, 0xca, 0xd9, 0xb3, 0x91, 0xa0, 0x83, 0x57, 0x00, 0x5a, 0xac, 0x25, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0xf0, 0x25, 0x25, 0x25, 0x33, 0x2d, 0x2b, 0x26, 0x2e, 0xe6, 0xec, 0x24, 0x48, 0xfb, 0xf2, 0xfb, 0x48, 0xe6, 0x46, 0x2d, 0x33, 0x37, 0x4a, 0x00, 0x4b, 0x00, 0x4f, 0x4f, 0x00, 0x4d, 0x50, 0x58, 0x61, 0x70, 0x79, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a, 0x7d, 0x7b, 0x7a, 0x79, 0x77, 0x75, 0x76, 0x75, 0x77, 0x75, 0x72, 0x75, 0x75, 0x75, 0x77, 0x77, 0x75, 0x77, 0x79, 0x77, 0x72, 0x6b, 0x5f, 0x58, 0x4b, 0x00, 0x00, 0x4f, 0x4d, 0x4e, 0x49, 0x27, 0x2f, 0x3a, 0x3a, 0x3d, 0x39, 0x29, 0x30, 0x3c, 0x29, 0x00, 0x4d, 0x00, 0x4d, 0x51, 0x4e, 0x4e, 0x37, 0xfb, 0x37, 0xf1, 0x61, 0x60, 0x60, 0x60, 0x62, 0x61, 0x61, 0x62, 0x62, 0x60, 0x60, 0x60, 0x62, 0x60, 0x60, 0x61, 0x60, 0x64, 0x62, 0x62, 0x65, 0x61, 0x51, 0x4e, 0x00, 0x00, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x51, 0x00, 0x5d, 0x96, 0xde, 0x01, 0x01, 0x01, 0xee, 0xee, 0xf0, 0x01, 0xf0, 0x01, 0xf8, 0xf0, 0xf8, 0xf0, 0xf8, 0xee, 0x01, 0xf8, 0xec, 0xee, 0x01, 0xda, 0x7f, 0x4f, 0x00, 0x51, 0xf9, 0x5a, 0x5d, 0x5a, 0x5d, 0x59, 0x59, 0x59, 0x5d, 0x5d, 0x5d, 0x59, 0x5d, 0x59, 0x5d, 0x2c, 0x03, 0x03, 0x08, 0x45, 0x15, 0x12, 0x13, 0x13, 0x13, 0x10, 0x10, 0x10, 0x0e, 0x09, 0x05, 0xfa, 0x73, 0x67, 0x67, 0x69, 0x67, 0x5f, 0xf2, 0x94, 0xde, 0xed, 0xf0, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xec, 0xed, 0xef, 0x4c, 0xf0, 0x01, 0x01, 0xed, 0xe8, 0xd9, 0xcb, 0xd2, 0xb3, 0xa0, 0xa0, 0x61, 0x4f, 0x4a, 0xa0, 0xf0, 0x01, 0x25, 0x4c, 0x25, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x25, 0x25, 0x01, 0x01, 0x4c, 0x01, 0xf0, 0x25, 0x24, 0x33, 0x30, 0x27, 0x26, 0xf2, 0xe9, 0xe9, 0xe9, 0x47, 0x07, 0x7d, 0x75, 0x89, 0xa0, 0xd4, 0x2e, 0x2f, 0x37, 0x2c, 0x26, 0x4b, 0x4b, 0x4e, 0x4d, 0x00, 0x56, 0x6a, 0x75, 0x7a, 0x7d, 0x81, 0x7b, 0x7b, 0x7a, 0x79, 0x76, 0x77, 0x76, 0x76, 0x77, 0x7a, 0x79, 0x7a, 0x79, 0x77, 0x77, 0x79, 0x77, 0x77, 0x75, 0x75, 0x72, 0x72, 0x72, 0x72, 0x75, 0x72, 0x76, 0x77, 0x75, 0x6a, 0x5a, 0x4f, 0x4e, 0x00, 0x53, 0x00, 0x29, 0x38, 0x3a, 0x3b, 0x3d, 0x2d, 0x29, 0x36, 0x36, 0x33, 0x26, 0x00, 0x4d, 0x50, 0x00, 0x4d, 0x28, 0x2c, 0x33, 0xfb, 0x5c, 0x5d, 0x64, 0x60, 0x60, 0x61, 0x61, 0x62, 0x61, 0x60, 0x62, 0x60, 0x62, 0x60, 0x60, 0x60, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x58, 0x4d, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xd4, 0xe6, 0xec, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 0xe6, 0xf0, 0x01, 0xf0, 0xec, 0x01, 0xe6, 0x96, 0x4f, 0x00, 0x5a, 0x5a, 0x5d, 0x59, 0x5d, 0x58, 0x59, 0x5d, 0x5b, 0x59, 0x5b, 0x5d, 0x5b, 0x5d, 0x5a, 0x2c, 0x03, 0x08, 0x12, 0x17, 0x10, 0x13, 0x13, 0x13, 0x13, 0x10, 0x10, 0x0e, 0x08, 0xfa, 0x6a, 0x6a, 0x69, 0x69, 0x69, 0x63, 0x5d, 0x72, 0xf4, 0xee, 0xf0, 0x01, 0xf0, 0xf0, 0xee, 0xec, 0xee, 0xf0, 0x4c, 0xee, 0xf8, 0xec, 0xf8, 0xf8, 0x01, 0xf0, 0xed, 0xef, 0xea, 0xd4, 0xda, 0xbd, 0xa0, 0xb3, 0x65, 0x4e, 0x53, 0xa6, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x25, 0x25, 0xf0, 0x01, 0x4c, 0x01, 0x25, 0x25, 0xe0, 0x33, 0x33, 0x27, 0xf9, 0x53, 0x47, 0xf8, 0x24, 0x48, 0x96, 0xfb, 0x65, 0x67, 0x77, 0xb3, 0x33, 0x2d, 0x37, 0x2e, 0x26, 0x49, 0x4e, 0x00, 0x4d, 0x60, 0x71, 0x7a, 0x82, 0x7b, 0x7a, 0x77, 0x77, 0x77, 0x7a, 0x7a, 0x85, 0x91, 0xa5, 0xb0, 0xbe, 0xbe, 0xbe, 0xc4, 0xc4, 0xc4, 0xc2, 0xca, 0xc2, 0xc2, 0xbe, 0xb9, 0xac, 0xa0, 0x91, 0x84, 0x7b, 0x77, 0x71, 0x6b, 0x71, 0x73, 0x75, 0x6a, 0x5f, 0x51, 0x51, 0x00, 0x2c, 0x3a, 0x3a, 0x3b, 0x3d, 0x29, 0x2b, 0x32, 0x36, 0x3a, 0x29, 0x26, 0x00, 0x00, 0x4e, 0x28, 0x31, 0x2c, 0x2f, 0x37, 0xf1, 0x5f, 0x64, 0x60, 0x62, 0x60, 0x61, 0x61, 0x62, 0x62, 0x60, 0x60, 0x60, 0x62, 0x60, 0x60, 0x62, 0x62, 0x61, 0x65, 0x62, 0x5a, 0x4d, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x00, 0x54, 0xa6, 0xde, 0xde, 0xdb, 0xd7, 0xda, 0xe1, 0xed, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0x01, 0xef, 0xe9, 0xec, 0xf0, 0xef, 0xee, 0xea, 0x96, 0x65, 0x53, 0x54, 0x5d, 0x59, 0x5d, 0x59, 0x5d, 0x59, 0x5d, 0x5d, 0x5d, 0x5f, 0x5f, 0x5d, 0x5c, 0x03, 0x38, 0x12, 0x12, 0x10, 0x13, 0x13, 0x13, 0x13, 0x10, 0x12, 0x0e, 0x08, 0xfa, 0x6a, 0x6f, 0x69, 0x63, 0x69, 0x63, 0x5b, 0x7d, 0xe0, 0x01, 0x01, 0xea, 0xf0, 0xea, 0xee, 0x01, 0xee, 0xee, 0xec, 0xec, 0xf8, 0x4c, 0x01, 0x01, 0x25, 0xec, 0xec, 0xf0, 0xed, 0xe4, 0xec, 0xd7, 0xe4, 0xcb, 0x96, 0xb3, 0x6e, 0x4f, 0x51, 0x47, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x25, 0x25, 0xf0, 0x01, 0x4c, 0x01, 0x01, 0x25, 0xe0, 0x30, 0x33, 0x29, 0x28, 0x51, 0x5f, 0x96, 0x01, 0x48, 0xfb, 0x57, 0x5b, 0x5e, 0x84, 0xbd, 0x2e, 0x31, 0x33, 0x31, 0x26, 0x00, 0x4e, 0x50, 0x68, 0x7b, 0x7e, 0x7b, 0x7a, 0x7a, 0x7e, 0x85, 0x9d, 0xae, 0xc2, 0xd1, 0xd2, 0xca, 0xc4, 0xc4, 0xb9, 0xb0, 0xae, 0xac, 0xb0, 0xb0, 0xb0, 0xac, 0xb0, 0xb0, 0xb9, 0xb9, 0xc4, 0xca, 0xd6, 0xd9, 0xd6, 0xd2, 0xc2, 0xa5, 0x88, 0x7a, 0x77, 0xfb, 0x77, 0x6a, 0x57, 0x26, 0x2f, 0x3a, 0x3b, 0x3e, 0x30, 0x29, 0x2b, 0x32, 0x36, 0x36, 0x30, 0x26, 0x27, 0x00, 0x4b, 0x28, 0x3c, 0x3c, 0x2d, 0x37, 0x2e, 0x61, 0x60, 0x60, 0x60, 0x62, 0x61, 0x61, 0x61, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x60, 0x61, 0x60, 0x61, 0x64, 0x61, 0x51, 0x00, 0x4f, 0x4e, 0x4e, 0x4e, 0x00, 0x4e, 0x4e, 0x65, 0xd4, 0xed, 0xe0, 0xd4, 0xda, 0xde, 0xda, 0xd4, 0xcb, 0xd4, 0xdb, 0xe8, 0xea, 0xed, 0xec, 0xed, 0xed, 0xef, 0xed, 0xef, 0xef, 0xe9, 0xec, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xe0, 0xb3, 0x79, 0x5a, 0x59, 0x59, 0x5b, 0x5d, 0x5d, 0x5d, 0x5d, 0x5b, 0x5d, 0x5d, 0x5c, 0x5c, 0x2c, 0x05, 0x0e, 0x12, 0x10, 0x13, 0x13, 0x13, 0x0f, 0x10, 0x10, 0x0d, 0x08, 0x05, 0xfa, 0x69, 0x63, 0x69, 0x69, 0x5e, 0x60, 0x94, 0xee, 0x01, 0xf8, 0xe9, 0x01, 0xea, 0xea, 0xea, 0xe7, 0xe6, 0xed, 0x4c, 0xef, 0xee, 0xec, 0xec, 0xec, 0xf8, 0xf8, 0xf0, 0xec, 0xee, 0xf0, 0xed, 0xea, 0xdb, 0xe4, 0xde, 0xa6, 0xa6, 0x6a, 0x50, 0x51, 0xd4, 0xee, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x25, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x25, 0x25, 0x25, 0xf0, 0x01, 0x4c, 0x01, 0x01, 0x25, 0xe0, 0x33, 0x2f, 0x27, 0x02, 0x51, 0x56, 0x75, 0xe6, 0x46, 0x5c, 0x53, 0x50, 0x5b, 0x6b, 0x6a, 0x4a, 0x29, 0x37, 0x2e, 0x26, 0x4b, 0x4e, 0x68, 0x7a, 0x7a, 0x7a, 0x85, 0x91, 0xa5, 0xba, 0xca, 0xc4, 0xb9, 0xae, 0xa5, 0x9d, 0x91, 0x91, 0x8c, 0x8d, 0x8b, 0x8b, 0x87, 0x88, 0x85, 0x87, 0x88, 0x8b, 0x8d, 0x8b, 0x8d, 0x88, 0x8d, 0x8d, 0x94, 0x94, 0xae, 0xb0, 0xc4, 0xbe, 0xac, 0x7d, 0x79, 0x73, 0x79, 0x75, 0x02, 0x2d, 0x3a, 0x3b, 0x3e, 0x30, 0x29, 0x2b, 0x32, 0x35, 0x3d, 0x3d, 0x37, 0x26, 0x26, 0xf9, 0x00, 0x33, 0x2f, 0x2a, 0x3c, 0x5c, 0xf1, 0x60, 0x60, 0x62, 0x60, 0x61, 0x62, 0x61, 0x62, 0x62, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0xf2, 0x54, 0x00, 0x4f, 0x00, 0x00, 0x4e, 0x4e, 0x00, 0x00, 0x73, 0xd4, 0xec, 0xe8, 0xe8, 0xea, 0xed, 0xe8, 0xe7, 0xe2, 0xd7, 0xcb, 0xc2, 0xcb, 0xcb, 0xd7, 0xd7, 0xda, 0xda, 0xdb, 0xdf, 0xe2, 0xe8, 0xea, 0xec, 0xed, 0xee, 0xed, 0xec, 0xef, 0xe8, 0xf0, 0xb3, 0x96, 0x75, 0x56, 0x59, 0x5a, 0x5f, 0x5a, 0x59, 0x5d, 0x5b, 0x5d, 0x5f, 0x04, 0x2c, 0x03, 0x0c, 0x10, 0x10, 0x13, 0x0f, 0x13, 0x0f, 0x13, 0x0e, 0x0e, 0x09, 0x05, 0xf2, 0x6b, 0x67, 0x63, 0x69, 0x63, 0x5e, 0xa0, 0x4c, 0x01, 0xf8, 0xe9, 0xe6, 0xdb, 0xda, 0xd7, 0xd7, 0xda, 0xd9, 0xdb, 0xdf, 0xe2, 0xe2, 0xea, 0xea, 0xea, 0xea, 0xed, 0xef, 0xed, 0xea, 0xed, 0xef, 0xed, 0xea, 0xda, 0xe2, 0xd2, 0xbd, 0x94, 0x64, 0x54, 0xf2, 0xda, 0x01, 0xec, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0xf0, 0x01, 0x4c, 0x01, 0x4c, 0x25, 0x23, 0x30, 0x37, 0x29, 0x02, 0x51, 0x51, 0x54, 0x70, 0xfb, 0x61, 0x4f, 0x51, 0x5d, 0x57, 0x00, 0x26, 0x2a, 0x33, 0x2e, 0x26, 0x4b, 0x5f, 0x77, 0x7a, 0x80, 0x9d, 0xae, 0xae, 0x9d, 0x91, 0x82, 0x80, 0x82, 0x7e, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7e, 0x7e, 0x80, 0x7e, 0x80, 0x81, 0x80, 0x81, 0x82, 0x7e, 0x81, 0x7e, 0x7b, 0x7e, 0x82, 0x7e, 0x7e, 0x7a, 0x7b, 0x7a, 0x7e, 0x8a, 0x87, 0x8a, 0x77, 0x77, 0xfb, 0x31, 0x2f, 0x3a, 0x3b, 0x3e, 0x30, 0x26, 0x2b, 0x30, 0x36, 0x3c, 0x44, 0x3c, 0x26, 0x26, 0x26, 0x26, 0x33, 0x33, 0x2d, 0x07, 0x2c, 0x65, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x60, 0x62, 0x60, 0x62, 0x62, 0x62, 0x65, 0x5f, 0x51, 0x00, 0x4d, 0x00, 0x4e, 0x49, 0x00, 0x4d, 0xf2, 0xda, 0xee, 0xe2, 0xe8, 0xea, 0xef, 0xed, 0xeb, 0xea, 0xeb, 0xe7, 0xd9, 0xcb, 0xc2, 0xca, 0xcb, 0xca, 0xd2, 0xd7, 0xd6, 0xd7, 0xd7, 0xda, 0xd9, 0xdb, 0xe2, 0xe8, 0xed, 0xea, 0xef, 0xea, 0xed, 0xd7, 0x8f, 0xa0, 0x6b, 0x59, 0x58, 0x5d, 0x61, 0x5d, 0x59, 0x5f, 0x5d, 0x5c, 0x04, 0x03, 0x06, 0x0e, 0x10, 0x10, 0x10, 0x13, 0x10, 0x10, 0x0e, 0x0e, 0x0b, 0x39, 0xfa, 0x6b, 0x68, 0x69, 0x6b, 0x60, 0x5b, 0x96, 0xf0, 0xef, 0xec, 0xec, 0xe9, 0xe7, 0xe4, 0xe1, 0xe1, 0xdc, 0xd9, 0xd2, 0xd2, 0xd2, 0xd7, 0xd9, 0xd9, 0xdb, 0xe3, 0xe7, 0xe5, 0xe8, 0xe7, 0xea, 0xea, 0xed, 0xea, 0xea, 0xe8, 0xd9, 0xda, 0xd2, 0xc2, 0x8a, 0x58, 0x59, 0x7d, 0xe9, 0x01, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x25, 0x25, 0x25, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x25, 0xf8, 0x33, 0x34, 0x2f, 0x27, 0x53, 0x4f, 0x57, 0x4b, 0x58, 0x5c, 0x4b, 0x28, 0x02, 0x33, 0xfa, 0x33, 0x34, 0x33, 0x2c, 0x26, 0x51, 0x72, 0x7b, 0x7a, 0x8d, 0xa4, 0x91, 0x85, 0x85, 0x8c, 0x87, 0x91, 0x91, 0x9d, 0xa5, 0xa5, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb0, 0xbe, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb0, 0xac, 0xac, 0xac, 0xa5, 0x82, 0x77, 0x77, 0x37, 0x33, 0x3a, 0x3b, 0x3e, 0x34, 0x29, 0x2b, 0x30, 0x30, 0x3c, 0x3c, 0x4a, 0x26, 0x26, 0x26, 0x27, 0x39, 0x38, 0x39, 0x39, 0x2e, 0x61, 0x5f, 0x60, 0x60, 0x60, 0x62, 0x61, 0x62, 0x61, 0x62, 0x60, 0x62, 0x60, 0x62, 0x62, 0x62, 0x62, 0x65, 0x54, 0x00, 0x00, 0x00, 0x49, 0x49, 0x4e, 0x00, 0x61, 0xd4, 0xec, 0xe4, 0xea, 0xe2, 0xdf, 0xdc, 0xe4, 0xe5, 0xe8, 0xeb, 0xeb, 0xeb, 0xdc, 0xd2, 0xc2, 0xc2, 0xca, 0xd2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd7, 0xd9, 0xdc, 0xe5, 0xe5, 0xe5, 0xe8, 0xe5, 0xb9, 0x84, 0xac, 0x5f, 0x58, 0x5a, 0x5a, 0x58, 0x5f, 0x5b, 0x5d, 0x2c, 0x03, 0x05, 0x0c, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x0d, 0x06, 0xf2, 0x68, 0x66, 0x67, 0x66, 0x66, 0x60, 0x83, 0xf0, 0xf0, 0xec, 0xe9, 0xea, 0xea, 0xe7, 0xeb, 0xe5, 0xeb, 0xe5, 0xe5, 0xdc, 0xd9, 0xd2, 0xd2, 0xd6, 0xd2, 0xd6, 0xd9, 0xd9, 0xd9, 0xd9, 0xdc, 0xdc, 0xe2, 0xe2, 0xe7, 0xe5, 0xe7, 0xe5, 0xd9, 0xd7, 0xc2, 0xc2, 0x72, 0x57, 0x5c, 0xa6, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0xf0, 0x01, 0x4c, 0x4c, 0x01, 0x25, 0x24, 0x39, 0x30, 0x39, 0x2a, 0x02, 0x27, 0x51, 0x5a, 0x65, 0x70, 0x2c, 0x02, 0x27, 0x05, 0x14, 0x44, 0x43, 0x31, 0x2a, 0x4d, 0x5c, 0x79, 0x7a, 0x85, 0xae, 0xb9, 0xb6, 0xbe, 0xbe, 0xb9, 0xb9, 0xb0, 0xb0, 0x9d, 0x94, 0x8d, 0x88, 0x82, 0x80, 0x81, 0x80, 0x82, 0x80, 0x80, 0x81, 0x7e, 0x81, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x7e, 0x7b, 0x7b, 0x7b, 0x82, 0x8b, 0x8d, 0x81, 0x8a, 0x8b, 0x77, 0x79, 0xfb, 0x2f, 0x3a, 0x3b, 0x3b, 0x3a, 0x29, 0x29, 0x30, 0x30, 0x33, 0x33, 0x27, 0x26, 0x26, 0x29, 0x38, 0x3a, 0x3a, 0x40, 0x37, 0x2c, 0x65, 0x60, 0x5e, 0x62, 0x60, 0x61, 0x61, 0x61, 0x62, 0x62, 0x60, 0x62, 0x60, 0x62, 0x62, 0x61, 0x65, 0x61, 0x4f, 0x00, 0x4e, 0x00, 0x49, 0x53, 0x00, 0x57, 0xc1, 0xee, 0xec, 0xe7, 0xda, 0xdb, 0xdb, 0xdc, 0xd9, 0xd7, 0xd7, 0xd9, 0xdb, 0xe5, 0xeb, 0xdc, 0xd6, 0xc2, 0xc2, 0xc4, 0xd2, 0xd2, 0xd2, 0xca, 0xca, 0xca, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd6, 0xd9, 0xc4, 0xdb, 0xac, 0x81, 0xa0, 0x58, 0x5a, 0x5d, 0x64, 0x56, 0x59, 0x5c, 0x04, 0x03, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0d, 0x40, 0xfa, 0x65, 0x6a, 0x63, 0x69, 0x68, 0x62, 0x79, 0xe9, 0xf0, 0xef, 0xe0, 0xe4, 0xe1, 0xe1, 0xdc, 0xdc, 0xdc, 0xdc, 0xe5, 0xe5, 0xe5, 0xe5, 0xdc, 0xd6, 0xd6, 0xd6, 0xd2, 0xd6, 0xd1, 0xd2, 0xd2, 0xd6, 0xd9, 0xd9, 0xd9, 0xd9, 0xdc, 0xe5, 0xd6, 0xeb, 0xca, 0xd6, 0xca, 0xb9, 0x68, 0x5d, 0x61, 0xe0, 0xf0, 0x01, 0xee, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x4c, 0x4c, 0xf0, 0xf0, 0xf8, 0x25, 0x3d, 0x29, 0x3a, 0x34, 0x27, 0x02, 0x4a, 0x51, 0x28, 0x6a, 0x31, 0x2a, 0x2f, 0x38, 0x41, 0x43, 0x43, 0x2d, 0x27, 0x28, 0x6e, 0x7e, 0x7a, 0x9d, 0xa4, 0x85, 0x7a, 0x77, 0x77, 0x77, 0x7a, 0x77, 0x77, 0x7a, 0x7b, 0x7e, 0x80, 0x85, 0x8b, 0x8b, 0x8d, 0x8b, 0x8d, 0x91, 0x91, 0x94, 0x91, 0x94, 0x94, 0x9d, 0x94, 0xa5, 0xa0, 0xa5, 0xa0, 0xa5, 0x94, 0x91, 0x8a, 0x84, 0x7f, 0x7a, 0x8f, 0x8c, 0x77, 0x79, 0x7f, 0x33, 0x38, 0x3b, 0x3b, 0x3e, 0x38, 0x2a, 0x29, 0x29, 0x26, 0x00, 0x26, 0x29, 0x2d, 0x3a, 0x3f, 0x3f, 0x3f, 0x40, 0x2d, 0x04, 0x65, 0x60, 0x62, 0x60, 0x62, 0x60, 0x61, 0x62, 0x61, 0x60, 0x62, 0x60, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5a, 0x4e, 0x00, 0x49, 0x49, 0x4b, 0x00, 0x57, 0xb3, 0x01, 0xe9, 0xdb, 0xe6, 0xda, 0xda, 0xdb, 0xda, 0xd9, 0xd7, 0xd6, 0xca, 0xca, 0xd2, 0xdc, 0xe5, 0xdc, 0xca, 0xc4, 0xc2, 0xbe, 0xca, 0xca, 0xca, 0xbe, 0xbe, 0xd2, 0xd6, 0xd2, 0xca, 0xca, 0xd2, 0xc4, 0xd2, 0xca, 0xd8, 0xdc, 0x81, 0x96, 0x83, 0x54, 0x5d, 0x60, 0x59, 0x5b, 0xf1, 0x02, 0x05, 0x10, 0x12, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x0d, 0x0b, 0x37, 0x65, 0x68, 0x67, 0x63, 0x6b, 0x60, 0x75, 0xdb, 0xf0, 0xef, 0xe8, 0xea, 0xe2, 0xe3, 0xe1, 0xdd, 0xdc, 0xd9, 0xdc, 0xdb, 0xd9, 0xdc, 0xe3, 0xe5, 0xe3, 0xd2, 0xd1, 0xd2, 0xd1, 0xd6, 0xd1, 0xca, 0xca, 0xca, 0xca, 0xca, 0xd2, 0xd6, 0xd6, 0xe5, 0xd6, 0xd9, 0xdc, 0xc4, 0xd2, 0x89, 0x64, 0x54, 0x79, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0x4c, 0xf0, 0xf0, 0x25, 0x24, 0x40, 0x29, 0x34, 0x3a, 0x34, 0x27, 0x2a, 0x4b, 0x4a, 0x27, 0x27, 0x38, 0x41, 0x0e, 0x41, 0x41, 0x3a, 0x2a, 0x27, 0x54, 0x70, 0x81, 0x82, 0x9d, 0x80, 0x80, 0x8c, 0x91, 0x9d, 0xa5, 0xac, 0xb0, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb0, 0xb9, 0xb0, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb0, 0xb0, 0xac, 0xb0, 0xac, 0xb0, 0xac, 0xb0, 0xac, 0xb0, 0xac, 0xb0, 0xb9, 0xb9, 0xb9, 0xbd, 0xc4, 0xa5, 0x77, 0x7a, 0x89, 0x2d, 0x38, 0x3b, 0x3b, 0x3e, 0x3e, 0x38, 0x2f, 0x29, 0x2a, 0x2a, 0x2f, 0x38, 0x3b, 0x3e, 0x3e, 0x3e, 0x3f, 0x38, 0x2c, 0x2e, 0x61, 0x61, 0x60, 0x63, 0x60, 0x61, 0x62, 0x61, 0x62, 0x62, 0x60, 0x62, 0x60, 0x62, 0x62, 0x62, 0x61, 0x51, 0x00, 0x4f, 0x49, 0x49, 0x00, 0x00, 0x96, 0x01, 0xe6, 0xde, 0xe0, 0xdb, 0xe4, 0xdf, 0xdb, 0xd9, 0xda, 0xd9, 0xd2, 0xd2, 0xc4, 0xca, 0xca, 0xd2, 0xd2, 0xdc, 0xd2, 0xc4, 0xbe, 0xc4, 0xc7, 0xca, 0xc4, 0xc4, 0xd1, 0xd2, 0xc4, 0xc4, 0xca, 0xc7, 0xca, 0xd1, 0xd6, 0xca, 0xd6, 0xd2, 0x7d, 0x96, 0x73, 0x54, 0x5b, 0x5f, 0x5b, 0x5c, 0x03, 0x08, 0x12, 0x0f, 0x13, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x0d, 0x07, 0xf2, 0x64, 0x67, 0x67, 0x68, 0x66, 0x6c, 0xc2, 0x01, 0xef, 0xe4, 0xe2, 0xdc, 0xdc, 0xdc, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdb, 0xdb, 0xdb, 0xdf, 0xdf, 0xdc, 0xd6, 0xca, 0xbe, 0xd6, 0xd8, 0xca, 0xbe, 0xc4, 0xb9, 0xbe, 0xca, 0xca, 0xca, 0xca, 0xe3, 0xd2, 0xd9, 0xd2, 0xd6, 0xca, 0xbd, 0x75, 0x65, 0x58, 0x47, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0xf0, 0xf0, 0x25, 0x01, 0x44, 0x29, 0x2b, 0x37, 0x40, 0x39, 0x2f, 0x2a, 0x2a, 0x2d, 0x3a, 0x41, 0x41, 0x41, 0x3f, 0x41, 0x34, 0x29, 0x53, 0x4a, 0x75, 0x7e, 0x82, 0x9c, 0xa5, 0xb0, 0xb0, 0xb0, 0xac, 0xa5, 0x9d, 0x9d, 0x91, 0x8d, 0x8b, 0x85, 0x85, 0x82, 0x82, 0x80, 0x82, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7b, 0x7e, 0x7b, 0x7b, 0x7b, 0x7e, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7e, 0x7b, 0x7a, 0x82, 0x8b, 0x7a, 0x79, 0x89, 0x31, 0x2f, 0x39, 0x3b, 0x3b, 0x3e, 0x3e, 0x3e, 0x3b, 0x3a, 0x3a, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x3a, 0x31, 0x2c, 0x2e, 0x61, 0x5f, 0x60, 0x61, 0x60, 0x61, 0x62, 0x61, 0x61, 0x62, 0x60, 0x62, 0x62, 0x62, 0x61, 0x65, 0x5a, 0x4f, 0x4e, 0x4b, 0x4b, 0x49, 0x00, 0x7f, 0xe0, 0xef, 0xe0, 0xe0, 0xea, 0xe9, 0xe2, 0xe5, 0xe7, 0xe7, 0xdc, 0xdb, 0xd6, 0xd2, 0xca, 0xc2, 0xbe, 0xc2, 0xb9, 0xe3, 0xd6, 0xc2, 0xbe, 0xca, 0xd2, 0xd9, 0xd9, 0xd9, 0xd9, 0xd6, 0xd2, 0xca, 0xd2, 0xc2, 0xd2, 0xc2, 0xc4, 0xca, 0xd2, 0xdc, 0xa6, 0x83, 0x96, 0xf1, 0x5d, 0x59, 0x5c, 0x2c, 0x05, 0x0c, 0x15, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0c, 0x0d, 0x09, 0xfa, 0x65, 0x67, 0x67, 0x63, 0x66, 0x60, 0xa0, 0xed, 0x01, 0xdf, 0xde, 0xdb, 0xd7, 0xd2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xd9, 0xd7, 0xd7, 0xdc, 0xd9, 0xd2, 0xca, 0xd2, 0xc4, 0xc4, 0xd2, 0xd2, 0xc4, 0xc2, 0xc4, 0xc4, 0xca, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xdb, 0xd2, 0xd6, 0xd7, 0xd7, 0xd2, 0x8f, 0x65, 0x5f, 0x73, 0xec, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x25, 0x01, 0x48, 0x27, 0x2a, 0x2a, 0x34, 0x3d, 0x40, 0x3f, 0x3f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x34, 0x2a, 0x27, 0x28, 0x56, 0x7a, 0x7b, 0x85, 0x9c, 0x9d, 0x91, 0x91, 0x91, 0x94, 0x9d, 0x9d, 0x9d, 0xa5, 0xa5, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xa5, 0xae, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x9d, 0x9d, 0x94, 0x91, 0x91, 0x91, 0x94, 0x94, 0x91, 0xa0, 0x9d, 0x7d, 0x79, 0x0a, 0x37, 0x2c, 0x33, 0x39, 0x3e, 0x3b, 0x3b, 0x3e, 0x3b, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x3e, 0x3a, 0x2f, 0x5f, 0x61, 0x61, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x61, 0x60, 0x62, 0x62, 0x62, 0x65, 0x61, 0x57, 0x00, 0x28, 0x00, 0x4b, 0x00, 0x5c, 0xe0, 0xe9, 0xe9, 0xdb, 0xe0, 0xe8, 0xe4, 0xe7, 0xe7, 0xe5, 0xe2, 0xe5, 0xe5, 0xe5, 0xd9, 0xd9, 0xd2, 0xc4, 0xc2, 0xbe, 0xd7, 0xd2, 0xca, 0xcb, 0xd9, 0xe1, 0xe5, 0xe7, 0xe4, 0xe2, 0xe2, 0xdf, 0xdf, 0xdc, 0xdb, 0xd7, 0xd7, 0xcb, 0xcb, 0xc2, 0xc4, 0xd8, 0x8f, 0x96, 0x7f, 0x54, 0xf1, 0x2c, 0x03, 0x06, 0x0e, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x0d, 0x0b, 0xfb, 0xf2, 0x6b, 0x63, 0x67, 0x67, 0x5b, 0x79, 0xe8, 0xee, 0xe8, 0xda, 0xd7, 0xdb, 0xd7, 0xd7, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xc4, 0xca, 0xd2, 0xca, 0xd2, 0xca, 0xc2, 0xca, 0xca, 0xca, 0xca, 0xca, 0xd6, 0xd7, 0xdb, 0xdc, 0xe1, 0xe2, 0xe2, 0xdc, 0xde, 0xdc, 0xd7, 0xd7, 0xd7, 0xd2, 0xd2, 0xd7, 0xb9, 0x75, 0x6a, 0x5a, 0xac, 0x25, 0x01, 0x01, 0xf0, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0x01, 0x25, 0xda, 0x2e, 0x27, 0x2a, 0x27, 0x2b, 0x39, 0x3d, 0x43, 0x43, 0x43, 0x3f, 0x3b, 0x34, 0x2d, 0x27, 0x2a, 0x02, 0x4b, 0x59, 0x7d, 0x80, 0x85, 0x9d, 0x7a, 0x7a, 0x82, 0x7b, 0x7b, 0x80, 0x7e, 0x82, 0x80, 0x85, 0x85, 0x82, 0x82, 0x80, 0x87, 0x85, 0x88, 0x88, 0x8b, 0x8c, 0x94, 0x9d, 0x9d, 0xa5, 0xa5, 0xae, 0xa5, 0xa5, 0xac, 0xa5, 0xb0, 0xb0, 0xb0, 0xb0, 0xac, 0xb0, 0xa5, 0xa5, 0xbe, 0xac, 0x7b, 0x77, 0x83, 0xfb, 0x2c, 0x2c, 0x2c, 0x38, 0x3b, 0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3f, 0x3f, 0x3a, 0x2f, 0x2c, 0x61, 0x61, 0x60, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x60, 0x60, 0x66, 0x5f, 0x62, 0x65, 0xf1, 0x53, 0x00, 0x53, 0x49, 0x00, 0x49, 0xa6, 0xf0, 0xec, 0xdb, 0xda, 0xe2, 0xde, 0xda, 0xda, 0xd7, 0xd7, 0xd7, 0xd2, 0xd2, 0xca, 0xd2, 0xd9, 0xdc, 0xd6, 0xca, 0xc2, 0xc2, 0xd2, 0xdb, 0xe1, 0xe7, 0xe7, 0xe1, 0xe2, 0xe7, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe7, 0xe7, 0xdb, 0xd7, 0xcb, 0xb9, 0xdb, 0xf3, 0x89, 0xa6, 0x6a, 0x5a, 0x04, 0x03, 0x3e, 0x0e, 0x10, 0x10, 0x10, 0x0e, 0x0e, 0x0c, 0x0d, 0x0a, 0xfa, 0x65, 0x67, 0x63, 0x67, 0x67, 0x5f, 0xc2, 0xf0, 0xef, 0xe4, 0xdb, 0xde, 0xdf, 0xdf, 0xdc, 0xdc, 0xd9, 0xdc, 0xd9, 0xd9, 0xd6, 0xdd, 0xd6, 0xc4, 0xbe, 0xc2, 0xbe, 0xd9, 0xd2, 0xca, 0xd2, 0xdc, 0xe2, 0xe5, 0xe5, 0xe4, 0xe5, 0xe2, 0xdf, 0xde, 0xe5, 0xe2, 0xe5, 0xdf, 0xdb, 0xd7, 0xd2, 0xd6, 0xd2, 0x8d, 0x6a, 0x61, 0xfb, 0xea, 0x01, 0x01, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x25, 0x01, 0x25, 0x37, 0x27, 0x2a, 0x27, 0x29, 0x26, 0x29, 0x2a, 0x2b, 0x2b, 0x2d, 0x2a, 0x27, 0x2a, 0x2a, 0x27, 0x28, 0x53, 0x5d, 0x81, 0x7e, 0x80, 0x9c, 0xa5, 0xbe, 0xc4, 0xc4, 0xbe, 0xbe, 0xb9, 0xb0, 0xb0, 0xae, 0xac, 0xae, 0xb0, 0xb0, 0xa5, 0xa5, 0x9d, 0x9d, 0x9d, 0x91, 0x91, 0x8b, 0x88, 0x85, 0x82, 0x7e, 0x7e, 0x80, 0x80, 0x85, 0x8b, 0x8d, 0x91, 0x94, 0x94, 0x9d, 0xb0, 0xa5, 0xa5, 0xac, 0x7b, 0x79, 0x89, 0x7d, 0x31, 0x5a, 0x2a, 0x2a, 0x2f, 0x38, 0x3a, 0x3d, 0x3f, 0x3d, 0x3b, 0x3d, 0x3a, 0x2f, 0x03, 0x2d, 0x2e, 0x60, 0x5f, 0x62, 0x61, 0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x62, 0x62, 0x66, 0x5f, 0x61, 0xf2, 0x5d, 0xf9, 0x4e, 0xf9, 0x4f, 0x00, 0x7f, 0xec, 0xe0, 0xde, 0xe4, 0xe9, 0xe2, 0xda, 0xd7, 0xd2, 0xd7, 0xd2, 0xca, 0xca, 0xc2, 0xc2, 0xbe, 0xc2, 0xd6, 0xdc, 0xd2, 0xca, 0xd7, 0xdc, 0xe5, 0xe1, 0xe5, 0xe7, 0xe5, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe7, 0xdf, 0xde, 0xdf, 0xdf, 0xe2, 0xe4, 0xe5, 0xd9, 0xbd, 0xcb, 0xb3, 0x89, 0xa0, 0x4a, 0x02, 0x05, 0x0c, 0x12, 0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0x0d, 0x0b, 0xfb, 0x31, 0x66, 0x6b, 0x67, 0x6b, 0x5b, 0x81, 0x01, 0xe8, 0xe2, 0xe4, 0xea, 0xe8, 0xdf, 0xdc, 0xdf, 0xe3, 0xdf, 0xe3, 0xdc, 0xdd, 0xd9, 0xd2, 0xd6, 0xd9, 0xd2, 0xca, 0xdc, 0xd6, 0xd9, 0xdc, 0xe1, 0xe5, 0xe1, 0xdc, 0xdf, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xdb, 0xd9, 0xd2, 0xd9, 0xb3, 0x6f, 0x75, 0x5d, 0xa6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0xf8, 0x01, 0x0a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x02, 0x27, 0x27, 0x27, 0x27, 0x27, 0x02, 0x02, 0x4a, 0x4a, 0x4a, 0x4a, 0x61, 0x82, 0x7a, 0x80, 0xa5, 0x91, 0x82, 0x8a, 0x91, 0x94, 0x94, 0x9d, 0xa5, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xae, 0xac, 0xae, 0xac, 0xb0, 0xb0, 0xb0, 0xb9, 0xb0, 0xac, 0x9d, 0x91, 0x8b, 0x87, 0x88, 0x84, 0x87, 0x81, 0x7e, 0x80, 0x79, 0x79, 0x83, 0x7f, 0x70, 0x2e, 0x2c, 0x04, 0x2c, 0x2c, 0x2c, 0x2d, 0x2f, 0x34, 0xfa, 0x2d, 0x2c, 0x2c, 0xf1, 0x2e, 0x61, 0x61, 0x61, 0x60, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x60, 0x62, 0x66, 0x5f, 0x62, 0x65, 0x57, 0x4e, 0x51, 0x00, 0x00, 0xf1, 0xd4, 0xf8, 0xe4, 0xde, 0xe2, 0xe5, 0xde, 0xdc, 0xdf, 0xdc, 0xdc, 0xdc, 0xdf, 0xdc, 0xdc, 0xd9, 0xd9, 0xd6, 0xd9, 0xd2, 0xd2, 0xd6, 0xe1, 0xe7, 0xe7, 0xdf, 0xdf, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xde, 0xf4, 0xcb, 0xa0, 0x9d, 0xfb, 0x02, 0x06, 0x0e, 0x0e, 0x0e, 0x0c, 0x0c, 0x0c, 0x0d, 0x0b, 0x0a, 0xfa, 0x65, 0x68, 0x69, 0x67, 0x63, 0x62, 0xd2, 0x01, 0xea, 0xe1, 0xe1, 0xe5, 0xe5, 0xe5, 0xe7, 0xe3, 0xe5, 0xdd, 0xdc, 0xd6, 0xca, 0xca, 0xca, 0xd2, 0xe3, 0xdc, 0xdc, 0xdf, 0xd9, 0xdc, 0xe1, 0xe5, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe5, 0xdf, 0xdf, 0xdc, 0xdf, 0xe2, 0xdf, 0xdf, 0xd6, 0xd7, 0xd2, 0x83, 0x70, 0xf2, 0x79, 0xec, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x25, 0x01, 0xf8, 0x01, 0x46, 0x4a, 0x02, 0x28, 0x4a, 0x28, 0x4a, 0x4a, 0x4a, 0x57, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x57, 0x4a, 0x54, 0x5f, 0x81, 0x80, 0x82, 0xa4, 0x91, 0x82, 0x7b, 0x81, 0x7e, 0x7e, 0x82, 0x7e, 0x80, 0x82, 0x82, 0x85, 0x85, 0x84, 0x80, 0x82, 0x80, 0x82, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x85, 0x82, 0x84, 0x88, 0x91, 0x94, 0x9d, 0x9d, 0x94, 0xa0, 0x9d, 0xa5, 0xbe, 0xbd, 0x80, 0x79, 0x81, 0x7f, 0x73, 0x61, 0xf1, 0x5d, 0x5c, 0x5c, 0x2c, 0xf1, 0x2c, 0x2c, 0x2c, 0x2c, 0xf1, 0xf1, 0x61, 0x5f, 0x61, 0x60, 0x5f, 0x62, 0x61, 0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x62, 0x60, 0x62, 0x61, 0x62, 0x61, 0x54, 0x4f, 0x4f, 0xf9, 0x4f, 0x8f, 0xf8, 0xe6, 0xe8, 0xdc, 0xde, 0xe2, 0xdf, 0xd7, 0xca, 0xd6, 0xd6, 0xd6, 0xd9, 0xd9, 0xd9, 0xd9, 0xdc, 0xe5, 0xd9, 0xcb, 0xd7, 0xe5, 0xdf, 0xe5, 0xe4, 0xe1, 0xe2, 0xe1, 0xdf, 0xe7, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe7, 0xe2, 0xe2, 0xdb, 0xe4, 0xe4, 0xda, 0xcb, 0xb9, 0xa0, 0x89, 0x31, 0x08, 0x0d, 0x0e, 0x0c, 0x0e, 0x0b, 0x0b, 0x0b, 0x40, 0x07, 0x6a, 0x6a, 0x6b, 0x63, 0x67, 0x63, 0x81, 0xee, 0xe8, 0xe8, 0xe5, 0xe1, 0xdc, 0xdc, 0xdb, 0xd9, 0xd9, 0xd6, 0xd2, 0xca, 0xbe, 0xb9, 0xb9, 0xbe, 0xc4, 0xd2, 0xdc, 0xe3, 0xd7, 0xdc, 0xdf, 0xdf, 0xdc, 0xde, 0xe1, 0xe5, 0xdf, 0xdf, 0xdf, 0xdc, 0xdf, 0xdc, 0xe4, 0xe1, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xdc, 0xd2, 0xdf, 0xb3, 0x68, 0x70, 0x70, 0xc1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x25, 0x01, 0xf0, 0x01, 0xf8, 0x01, 0xd4, 0x31, 0x28, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x28, 0x53, 0x54, 0x54, 0x53, 0x57, 0x57, 0x4a, 0x4a, 0x53, 0x59, 0x83, 0x80, 0x80, 0x80, 0xbe, 0xc4, 0xbe, 0xb9, 0xbe, 0xbe, 0xb0, 0xb9, 0xb0, 0xb9, 0xb0, 0xb9, 0xb9, 0xbe, 0xbe, 0xbe, 0xb9, 0xbe, 0xb9, 0xb9, 0xbe, 0xb9, 0xb9, 0xb0, 0xb0, 0xb9, 0xb0, 0xb0, 0xac, 0xb0, 0xa5, 0xa5, 0xa5, 0x9d, 0x94, 0x91, 0x94, 0x82, 0x82, 0x8b, 0x7e, 0x7b, 0x82, 0x84, 0x79, 0x65, 0x5f, 0x5b, 0x5f, 0x61, 0x5f, 0x5c, 0xf1, 0xf1, 0xf1, 0x5f, 0x61, 0x62, 0x5e, 0x60, 0x60, 0x5f, 0x61, 0x60, 0x60, 0x62, 0x60, 0x61, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x60, 0x62, 0x64, 0x62, 0x5d, 0x53, 0x4e, 0x4f, 0x51, 0xf2, 0xe0, 0xec, 0xde, 0xde, 0xdf, 0xdb, 0xd9, 0xd6, 0xd2, 0xca, 0xca, 0xca, 0xca, 0xc4, 0xc4, 0xc4, 0xca, 0xd6, 0xd9, 0xd2, 0xd9, 0xe5, 0xdf, 0xe2, 0xe1, 0xdf, 0xdf, 0xe7, 0xe4, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe4, 0xda, 0xe9, 0xe0, 0xdb, 0xc4, 0xa5, 0x94, 0x07, 0x09, 0x0e, 0x0c, 0x0c, 0x43, 0x0b, 0x09, 0x0b, 0x89, 0x73, 0x65, 0x67, 0x6c, 0x63, 0x67, 0x67, 0xbd, 0xf0, 0xe1, 0xdb, 0xd9, 0xd2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xca, 0xca, 0xca, 0xca, 0xca, 0xbd, 0xc4, 0xd9, 0xd9, 0xd6, 0xdb, 0xe5, 0xdf, 0xdc, 0xe1, 0xe1, 0xe1, 0xdf, 0xdf, 0xe1, 0xe2, 0xdf, 0xe1, 0xdf, 0xdf, 0xe1, 0xdc, 0xdf, 0xe1, 0xdf, 0xdc, 0xe1, 0xd9, 0xd9, 0xd7, 0x77, 0x73, 0x65, 0xa0, 0x01, 0xf0, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0x7f, 0x49, 0x4a, 0x4a, 0x53, 0x4a, 0x54, 0x54, 0x54, 0x54, 0x57, 0x54, 0x4a, 0x57, 0x4a, 0x5a, 0x4a, 0x57, 0x79, 0x82, 0x80, 0x7a, 0x85, 0x91, 0xa5, 0xa5, 0xa5, 0xa0, 0xa4, 0xa5, 0xa5, 0x9d, 0x91, 0x91, 0x8d, 0x8b, 0x87, 0x88, 0x8b, 0x8d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x94, 0x91, 0x91, 0x94, 0x9d, 0x9d, 0xa5, 0xa5, 0xa5, 0xac, 0xa5, 0xa5, 0x94, 0x91, 0x9d, 0x9d, 0x81, 0x7a, 0x81, 0x82, 0x7d, 0x6c, 0x5d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5d, 0x5f, 0x5f, 0x61, 0x5f, 0x5f, 0x60, 0x5e, 0x60, 0x60, 0x64, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x60, 0x61, 0x60, 0x61, 0x60, 0x60, 0x62, 0x5f, 0x65, 0x5d, 0x51, 0x4f, 0x53, 0x00, 0xa6, 0xf0, 0xe6, 0xe2, 0xe2, 0xdc, 0xd9, 0xd2, 0xca, 0xd2, 0xca, 0xd2, 0xca, 0xca, 0xc4, 0xca, 0xc4, 0xd2, 0xd2, 0xcb, 0xd2, 0xe2, 0xe8, 0xdc, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe2, 0xde, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe9, 0xe0, 0xe0, 0xe5, 0xd9, 0xb0, 0xac, 0x0a, 0x06, 0x0d, 0x0c, 0x0b, 0x09, 0x40, 0x0a, 0x0a, 0x0a, 0xf2, 0x68, 0x67, 0x67, 0x6c, 0x5e, 0x7b, 0xe7, 0xef, 0xe8, 0xd7, 0xd2, 0xd2, 0xd7, 0xdc, 0xdb, 0xd9, 0xdc, 0xd9, 0xd9, 0xdd, 0xd9, 0xdd, 0xdf, 0xd6, 0xd6, 0xdf, 0xd7, 0xd2, 0xe8, 0xe5, 0xe2, 0xe1, 0xdb, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe1, 0xdf, 0xe2, 0xe1, 0xe2, 0xe1, 0xdf, 0xdf, 0xdf, 0xd9, 0xdf, 0x94, 0x6e, 0x6a, 0x7d, 0xe0, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xec, 0xec, 0x01, 0x01, 0xa6, 0x5a, 0x4a, 0x4a, 0x4a, 0x57, 0x4a, 0x57, 0x54, 0x54, 0x53, 0x54, 0x4a, 0x4a, 0x4a, 0x4a, 0x28, 0x50, 0x75, 0x8b, 0x7e, 0x80, 0x7b, 0x7b, 0x81, 0x83, 0x7e, 0x82, 0x82, 0x82, 0x84, 0x88, 0x8d, 0x91, 0x94, 0x94, 0x9d, 0x9d, 0x94, 0x91, 0x8d, 0x8d, 0x8a, 0x87, 0x87, 0x8b, 0x8b, 0x91, 0x91, 0x8d, 0x8d, 0x8d, 0x8b, 0x88, 0x8a, 0x87, 0x8a, 0x8f, 0x9d, 0xb0, 0xb9, 0xb9, 0x85, 0x7a, 0x81, 0x81, 0x7b, 0x72, 0x67, 0x5b, 0x5b, 0x5d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x5f, 0x5f, 0x5f, 0x60, 0x5f, 0x64, 0x62, 0x64, 0x62, 0x62, 0x62, 0x62, 0x66, 0x60, 0x64, 0x68, 0x54, 0x4e, 0x51, 0x4e, 0xf2, 0xe6, 0xef, 0xde, 0xde, 0xdc, 0xd9, 0xd2, 0xca, 0xca, 0xca, 0xca, 0xd2, 0xca, 0xca, 0xca, 0xc4, 0xc4, 0xcb, 0xd2, 0xd7, 0xdb, 0xe5, 0xe2, 0xe4, 0xe2, 0xe2, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe0, 0xe0, 0xde, 0xe1, 0xe5, 0xbe, 0xa6, 0x96, 0x08, 0x0b, 0x0c, 0x0b, 0x40, 0x0a, 0x0a, 0x89, 0x79, 0x68, 0x67, 0x67, 0x69, 0x6c, 0x66, 0x94, 0xea, 0xea, 0xdb, 0xd6, 0xd7, 0xd2, 0xd6, 0xd9, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd9, 0xd9, 0xdc, 0xd9, 0xd9, 0xdc, 0xe2, 0xe1, 0xe2, 0xe7, 0xe8, 0xe4, 0xe1, 0xdf, 0xe7, 0xe1, 0xe2, 0xe1, 0xe2, 0xdc, 0xdf, 0xe2, 0xe1, 0xe2, 0xdf, 0xe2, 0xe1, 0xe1, 0xdc, 0xdb, 0xe5, 0xb3, 0x73, 0x73, 0x70, 0xd4, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0xf0, 0x01, 0xf0, 0xec, 0x01, 0xe1, 0x70, 0x28, 0x4a, 0x4a, 0x53, 0x53, 0x51, 0x53, 0x57, 0x57, 0x57, 0x4a, 0x5a, 0x4a, 0x5c, 0x5c, 0x51, 0x5b, 0x87, 0x85, 0x7a, 0x80, 0x81, 0x82, 0x7e, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x82, 0x85, 0x85, 0x87, 0x8b, 0x8b, 0x8d, 0x8d, 0x8d, 0x8d, 0x8a, 0x94, 0x91, 0x94, 0xa0, 0xa0, 0x9d, 0xa0, 0x91, 0x94, 0x91, 0x91, 0x8d, 0x8a, 0x85, 0x81, 0x7a, 0x77, 0x7a, 0x87, 0x87, 0x7b, 0x71, 0x61, 0x5f, 0x61, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x60, 0x5f, 0x60, 0x60, 0x62, 0x62, 0x62, 0x62, 0x60, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x68, 0x65, 0x54, 0x4f, 0x53, 0x4e, 0xac, 0x01, 0xe8, 0xe2, 0xdc, 0xe5, 0xe5, 0xdc, 0xdc, 0xdc, 0xd9, 0xdc, 0xd6, 0xd7, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd7, 0xde, 0xe2, 0xdf, 0xdf, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe7, 0xe4, 0xe1, 0xdf, 0xdf, 0xe2, 0xdf, 0xe1, 0xe2, 0xde, 0xe9, 0xde, 0xde, 0xe5, 0xe3, 0xa5, 0xb3, 0x09, 0x09, 0x0b, 0x09, 0x0a, 0x0a, 0x89, 0x0a, 0x75, 0x68, 0x6c, 0x67, 0x69, 0x63, 0x71, 0xcb, 0xef, 0xe8, 0xdb, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd6, 0xd2, 0xd2, 0xca, 0xca, 0xca, 0xca, 0xd2, 0xe2, 0xdc, 0xd7, 0xdb, 0xe5, 0xdb, 0xdf, 0xdb, 0xdb, 0xdb, 0xe2, 0xe2, 0xdf, 0xdc, 0xdb, 0xdf, 0xe1, 0xe5, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xdc, 0xe5, 0xd7, 0x7e, 0x75, 0x68, 0xa6, 0xef, 0x01, 0x01, 0x4c, 0x25, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x25, 0x01, 0x01, 0xf8, 0xf0, 0xef, 0x01, 0x01, 0xe1, 0x89, 0x5f, 0x5c, 0x5c, 0x5c, 0x5a, 0x5d, 0x5a, 0x57, 0x57, 0x58, 0x57, 0x57, 0x57, 0x4a, 0x5c, 0x57, 0x52, 0x71, 0x85, 0x85, 0x81, 0x7e, 0x7b, 0x7d, 0x7e, 0x7b, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x77, 0x77, 0x77, 0x79, 0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x77, 0x77, 0x79, 0x79, 0x7a, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x82, 0x8a, 0x8a, 0x84, 0x7e, 0x77, 0x72, 0x72, 0x70, 0x70, 0x6e, 0x6b, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x65, 0x68, 0x64, 0x66, 0x64, 0x66, 0x62, 0x66, 0x62, 0x62, 0x62, 0x64, 0x66, 0x66, 0x68, 0x68, 0x68, 0x6b, 0x6a, 0x5f, 0x51, 0x51, 0x4e, 0x68, 0xee, 0xea, 0xe7, 0xea, 0xe4, 0xe3, 0xe1, 0xe3, 0xe5, 0xdc, 0xe5, 0xdc, 0xe5, 0xdf, 0xe3, 0xe2, 0xdc, 0xd9, 0xd7, 0xdb, 0xe2, 0xe7, 0xe2, 0xe2, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xdc, 0xe4, 0xe0, 0xe0, 0xdb, 0xeb, 0xbd, 0xb3, 0x89, 0x09, 0x09, 0x40, 0x0a, 0x0a, 0x83, 0x83, 0x6e, 0x67, 0x6c, 0x6c, 0x67, 0x63, 0x7a, 0xe7, 0xed, 0xe4, 0xe1, 0xe1, 0xdc, 0xdc, 0xdc, 0xdf, 0xdc, 0xdc, 0xdc, 0xd9, 0xd7, 0xd2, 0xd2, 0xca, 0xd7, 0xdc, 0xdc, 0xda, 0xdf, 0xe4, 0xde, 0xe4, 0xe4, 0xe8, 0xe4, 0xe2, 0xe2, 0xe2, 0xe7, 0xe2, 0xe1, 0xdc, 0xdf, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0xe1, 0xe1, 0xdc, 0xe5, 0xe8, 0x8f, 0x75, 0x6e, 0x83, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0xe6, 0xb3, 0x8a, 0x7e, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x73, 0x75, 0x73, 0x72, 0x72, 0x72, 0x72, 0x70, 0xfb, 0x72, 0x6c, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a, 0x81, 0x81, 0x82, 0x82, 0x87, 0x87, 0x87, 0x82, 0x82, 0x85, 0x88, 0x8b, 0x8b, 0x87, 0x87, 0x87, 0x88, 0x8d, 0x8a, 0x87, 0x8a, 0x8a, 0x8b, 0x8d, 0x8a, 0x8d, 0x8a, 0x85, 0x84, 0x87, 0x87, 0x8a, 0x8a, 0x8a, 0x84, 0x7b, 0x79, 0x77, 0x79, 0x7b, 0x7d, 0x7a, 0x7d, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x77, 0x79, 0x77, 0x79, 0x77, 0x79, 0x77, 0x77, 0x75, 0x77, 0x77, 0x79, 0x77, 0x79, 0x77, 0x77, 0x77, 0x75, 0x7a, 0x73, 0x59, 0x54, 0x54, 0x4f, 0xa0, 0x01, 0xe7, 0xe7, 0xed, 0xdc, 0xdf, 0xe3, 0xe2, 0xe5, 0xe5, 0xdf, 0xe3, 0xdc, 0xdf, 0xe2, 0xdc, 0xdc, 0xd7, 0xdb, 0xe1, 0xde, 0xe2, 0xe2, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe5, 0xdc, 0xe4, 0xe4, 0xdb, 0xe8, 0xd9, 0xac, 0x96, 0x0a, 0x09, 0x0a, 0x0a, 0x0a, 0x83, 0x7f, 0x68, 0x6b, 0x6b, 0x6c, 0x6c, 0x67, 0x94, 0xed, 0xed, 0xe6, 0xea, 0xe5, 0xe5, 0xe5, 0xe1, 0xe3, 0xdf, 0xe1, 0xdf, 0xdc, 0xdc, 0xd9, 0xd9, 0xd7, 0xdb, 0xda, 0xdb, 0xdf, 0xde, 0xdf, 0xe2, 0xdb, 0xe2, 0xe4, 0xe2, 0xe2, 0xe4, 0xe2, 0xdf, 0xe1, 0xe1, 0xdc, 0xdb, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0xe1, 0xe1, 0xe1, 0xdc, 0xdc, 0xeb, 0xac, 0x79, 0x77, 0x73, 0xea, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x25, 0x01, 0x25, 0xf0, 0x01, 0xe9, 0x83, 0x72, 0x75, 0x7b, 0x7e, 0x80, 0x7e, 0x7e, 0x7e, 0x81, 0x7d, 0x7e, 0x7b, 0x7e, 0x7b, 0x7e, 0x7a, 0x7f, 0x7d, 0x79, 0x83, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x81, 0x7e, 0x7e, 0x81, 0x7e, 0x7e, 0x7b, 0x7e, 0x7b, 0x7b, 0x7b, 0x7e, 0x7e, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x7a, 0x79, 0x7a, 0x7b, 0x7b, 0x7a, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x7a, 0x7a, 0x7a, 0x7b, 0x7a, 0x77, 0x75, 0x77, 0x75, 0x76, 0x75, 0x77, 0x75, 0x75, 0x75, 0x75, 0x75, 0x77, 0x76, 0x77, 0x76, 0x76, 0x76, 0x75, 0x75, 0x73, 0x75, 0x72, 0x75, 0x72, 0x72, 0x72, 0x75, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6f, 0x72, 0x72, 0x79, 0x72, 0x54, 0x4f, 0x51, 0x6a, 0xda, 0xe8, 0xe4, 0xdb, 0xe2, 0xd9, 0xd2, 0xd7, 0xd7, 0xd7, 0xd2, 0xd7, 0xd2, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xde, 0xe2, 0xe2, 0xde, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe1, 0xe3, 0xdc, 0xe0, 0xe9, 0xe0, 0xdb, 0xe5, 0xbe, 0xa6, 0x0a, 0x0a, 0x0a, 0x0a, 0x83, 0x83, 0x79, 0x68, 0x6b, 0x6b, 0x6c, 0x67, 0x6c, 0xca, 0xed, 0xe8, 0xe4, 0xea, 0xe4, 0xe5, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xdc, 0xdc, 0xde, 0xdf, 0xdf, 0xda, 0xdb, 0xe1, 0xdf, 0xde, 0xe4, 0xe8, 0xe2, 0xde, 0xe4, 0xe9, 0xea, 0xe8, 0xe7, 0xe7, 0xea, 0xea, 0xe1, 0xdb, 0xdf, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xdc, 0xe1, 0xdc, 0xe5, 0xca, 0x7e, 0x79, 0x70, 0xcb, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xcb, 0x6a, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76, 0x77, 0x76, 0x77, 0x77, 0x79, 0x77, 0x77, 0x77, 0x77, 0x78, 0x75, 0x79, 0x79, 0x75, 0x7b, 0x76, 0x76, 0x77, 0x77, 0x77, 0x75, 0x76, 0x76, 0x77, 0x76, 0x76, 0x76, 0x77, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x77, 0x76, 0x71, 0x72, 0x72, 0x71, 0x72, 0x71, 0x72, 0x71, 0x72, 0x71, 0x71, 0x71, 0x71, 0x6f, 0x71, 0x6f, 0x6b, 0x71, 0x72, 0x6f, 0x6b, 0x6f, 0x6f, 0x72, 0x6f, 0x6f, 0x71, 0x6f, 0x71, 0x6f, 0x71, 0x6f, 0x71, 0x72, 0x71, 0x76, 0x72, 0x76, 0x75, 0x77, 0x77, 0x77, 0x79, 0x77, 0x79, 0x7a, 0x79, 0x7b, 0x7b, 0x7e, 0x81, 0x81, 0x81, 0x84, 0x83, 0x62, 0x56, 0x54, 0x96, 0xe8, 0xde, 0xd7, 0xcb, 0xca, 0xd7, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xca, 0xcb, 0xd2, 0xca, 0xca, 0xd2, 0xdb, 0xdf, 0xde, 0xe4, 0xe4, 0xde, 0xe0, 0xe2, 0xe4, 0xe0, 0xe4, 0xe4, 0xe8, 0xe4, 0xe8, 0xe7, 0xe8, 0xe7, 0xe7, 0xe4, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xdc, 0xdd, 0xe0, 0xe0, 0xec, 0xda, 0xe5, 0xd2, 0xb3, 0x89, 0x7f, 0x0a, 0x0a, 0x0a, 0x83, 0x75, 0x6a, 0x6c, 0x67, 0x6c, 0x6c, 0x75, 0xeb, 0xea, 0xd7, 0xd4, 0xd2, 0xd7, 0xd6, 0xd9, 0xd9, 0xd9, 0xdc, 0xdc, 0xd9, 0xdb, 0xd9, 0xdb, 0xd9, 0xdb, 0xdb, 0xe1, 0xde, 0xdf, 0xe1, 0xe2, 0xde, 0xdb, 0xde, 0xe8, 0xea, 0xd7, 0xa6, 0x8a, 0x81, 0x8f, 0xb9, 0xe1, 0xeb, 0xe7, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xdc, 0xe1, 0xdc, 0x88, 0x75, 0x73, 0xa6, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x25, 0x01, 0x25, 0x01, 0x01, 0xbd, 0x83, 0x87, 0x88, 0x87, 0x85, 0x85, 0x82, 0x80, 0x81, 0x7e, 0x7e, 0x7a, 0x7a, 0x7a, 0x7a, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x76, 0x76, 0x72, 0x76, 0x72, 0x76, 0x71, 0x76, 0x77, 0x77, 0x7b, 0x7a, 0x7e, 0x7e, 0x7b, 0x7a, 0x7e, 0x7b, 0x7e, 0x7e, 0x7b, 0x84, 0x7a, 0x7b, 0x81, 0x81, 0x7b, 0x7e, 0x81, 0x7e, 0x7e, 0x7b, 0x7e, 0x7e, 0x7b, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7e, 0x7e, 0x7e, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x87, 0x87, 0x87, 0x87, 0x87, 0x8a, 0x84, 0x8a, 0x87, 0x87, 0x87, 0x84, 0x84, 0x84, 0x87, 0x85, 0x87, 0x77, 0x72, 0x77, 0xd9, 0xe1, 0xd4, 0xd2, 0xd7, 0xd2, 0xd2, 0xca, 0xd2, 0xca, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xca, 0xd2, 0xd9, 0xdf, 0xdc, 0xe4, 0xe2, 0xde, 0xe4, 0xe0, 0xe6, 0xe0, 0xe4, 0xe4, 0xe4, 0xdb, 0xc2, 0xa0, 0x91, 0x91, 0xa0, 0xc2, 0xe5, 0xe8, 0xe2, 0xde, 0xe2, 0xe4, 0xe1, 0xde, 0xe5, 0xe1, 0xe1, 0xe2, 0xde, 0xde, 0xdf, 0xe1, 0xda, 0xbd, 0x89, 0x7f, 0x0a, 0x7f, 0x83, 0x7f, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x5b, 0xa0, 0xef, 0xe2, 0xdb, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xca, 0xca, 0xca, 0xc4, 0xca, 0xc4, 0xc2, 0xbe, 0xcb, 0xd9, 0xd9, 0xe1, 0xdf, 0xdf, 0xe2, 0xe2, 0xe4, 0xe7, 0xe5, 0xdc, 0xac, 0x7e, 0x7e, 0x85, 0x82, 0x80, 0x77, 0x88, 0xbd, 0xe5, 0xe5, 0xe2, 0xdf, 0xde, 0xdf, 0xdf, 0xe1, 0xde, 0xe7, 0xdc, 0xe1, 0xe5, 0xdc, 0xac, 0x77, 0x73, 0xa0, 0x01, 0xf8, 0xf8, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xc1, 0x83, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x8b, 0x8b, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x87, 0x87, 0x88, 0x88, 0x8d, 0x8b, 0x7e, 0x8d, 0x8b, 0x84, 0x88, 0x8b, 0x88, 0x8b, 0x84, 0x8b, 0x88, 0x82, 0x94, 0x8d, 0x88, 0x8a, 0x8a, 0x8a, 0x84, 0x81, 0x87, 0x8b, 0x8d, 0x81, 0x85, 0x85, 0x84, 0x85, 0x84, 0x85, 0x84, 0x84, 0x84, 0x85, 0x84, 0x87, 0x87, 0x84, 0x85, 0x84, 0x87, 0x84, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x84, 0x81, 0x77, 0x79, 0xa0, 0xdf, 0xdc, 0xd7, 0xd7, 0xd7, 0xd7, 0xd2, 0xd2, 0xd1, 0xd2, 0xca, 0xca, 0xca, 0xc4, 0xca, 0xca, 0xca, 0xd2, 0xdc, 0xe5, 0xdf, 0xe2, 0xde, 0xe4, 0xe6, 0xe0, 0xe4, 0xe6, 0xe9, 0xdc, 0xb3, 0x87, 0x79, 0x7e, 0x7b, 0x7a, 0x7a, 0x7a, 0x8f, 0xcb, 0xe4, 0xea, 0xdb, 0xdb, 0xe7, 0xdb, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xde, 0xc1, 0x96, 0x7f, 0x0a, 0x7f, 0x0a, 0x7d, 0x6f, 0x6f, 0x6c, 0x6c, 0x6c, 0x62, 0xc2, 0xf0, 0xed, 0xe8, 0xdf, 0xdc, 0xd6, 0xd6, 0xd2, 0xd6, 0xd2, 0xd1, 0xd2, 0xca, 0xca, 0xca, 0xca, 0xd7, 0xd9, 0xdb, 0xdf, 0xdc, 0xdf, 0xdf, 0xde, 0xe2, 0xe5, 0xd7, 0x9d, 0x81, 0x88, 0x85, 0x80, 0x85, 0x80, 0x85, 0x77, 0x81, 0xb9, 0xe4, 0xeb, 0xdb, 0xe2, 0xdf, 0xdf, 0xdf, 0xe1, 0xe2, 0xdf, 0xdc, 0xe5, 0xdc, 0xb9, 0x7b, 0x75, 0x8f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x25, 0x01, 0x01, 0x01, 0xc1, 0x81, 0x88, 0x8b, 0x88, 0x87, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x87, 0x87, 0x88, 0x87, 0x88, 0x94, 0x81, 0x6b, 0x6b, 0x62, 0x5b, 0x68, 0x71, 0x68, 0x67, 0x6b, 0x63, 0x6b, 0x6b, 0x67, 0x67, 0x6f, 0x6e, 0x6e, 0x83, 0x68, 0x68, 0x6e, 0x6e, 0x76, 0x8d, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x84, 0x87, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x7b, 0x7d, 0xc2, 0xed, 0xe4, 0xda, 0xda, 0xd9, 0xdb, 0xd9, 0xd9, 0xd9, 0xd6, 0xd6, 0xd2, 0xd6, 0xd2, 0xd7, 0xd2, 0xd2, 0xd9, 0xdc, 0xe2, 0xe2, 0xe2, 0xde, 0xe6, 0xde, 0xde, 0xe4, 0xea, 0xd7, 0xa0, 0x7d, 0x81, 0x88, 0x84, 0x85, 0x84, 0x87, 0x81, 0x7b, 0x83, 0xb9, 0xe4, 0xe4, 0xde, 0xe8, 0xdf, 0xe2, 0xe2, 0xe2, 0xe1, 0xdf, 0xe1, 0xdc, 0xe1, 0xe8, 0xcb, 0xa6, 0x7d, 0x7f, 0x0a, 0x7f, 0x7d, 0x6f, 0x6f, 0x71, 0x6c, 0x6c, 0x6e, 0xe5, 0xef, 0xe8, 0xdf, 0xe2, 0xd9, 0xd9, 0xd6, 0xd6, 0xd6, 0xd2, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd9, 0xdb, 0xde, 0xdf, 0xdc, 0xdf, 0xe2, 0xdf, 0xe2, 0xe8, 0xe2, 0x94, 0x84, 0x88, 0x85, 0x87, 0x8c, 0x85, 0x80, 0x85, 0x82, 0x7b, 0x7b, 0xb9, 0xed, 0xdb, 0xe2, 0xdf, 0xe1, 0xde, 0xe1, 0xde, 0xe1, 0xe5, 0xdf, 0xe3, 0xca, 0x81, 0x79, 0x83, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xd4, 0x7e, 0x8a, 0x88, 0x88, 0x85, 0x87, 0x87, 0x87, 0x88, 0x87, 0x87, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0xac, 0x6b, 0x00, 0x52, 0x4d, 0x62, 0x60, 0x51, 0x4d, 0x00, 0x4d, 0x50, 0x4d, 0x00, 0x4d, 0x4d, 0x54, 0x00, 0x4d, 0xac, 0x53, 0x00, 0x50, 0x4f, 0x50, 0x8a, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x81, 0x87, 0x83, 0x7e, 0x81, 0xd7, 0xed, 0xe8, 0xde, 0xd9, 0xd7, 0xd7, 0xd7, 0xdc, 0xd9, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xd7, 0xd9, 0xdb, 0xe5, 0xdc, 0xe2, 0xde, 0xe4, 0xe4, 0xdb, 0xde, 0xe8, 0xde, 0x94, 0x81, 0x8a, 0x88, 0x81, 0x80, 0x81, 0x81, 0x82, 0x87, 0x83, 0x7e, 0x83, 0xc2, 0xea, 0xe2, 0xdf, 0xdc, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xde, 0xe7, 0xd4, 0xb3, 0x7f, 0x7f, 0x0a, 0x7f, 0x79, 0x6e, 0x6f, 0x71, 0x6c, 0x67, 0x7b, 0xf0, 0xe8, 0xdb, 0xd2, 0xd9, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd7, 0xdc, 0xde, 0xde, 0xdf, 0xdb, 0xe5, 0xdf, 0xdf, 0xe8, 0xe8, 0xac, 0x88, 0x83, 0x8d, 0x8d, 0x87, 0x87, 0x85, 0x8c, 0x81, 0x80, 0x81, 0x7a, 0x84, 0xdb, 0xe7, 0xe2, 0xdc, 0xe7, 0xdb, 0xe1, 0xdb, 0xdf, 0xe5, 0xdc, 0xe5, 0xd9, 0x8a, 0x79, 0x8f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0xda, 0x83, 0x8b, 0x88, 0x8b, 0x88, 0x8b, 0x88, 0x88, 0x88, 0x87, 0x88, 0x85, 0x87, 0x85, 0x87, 0x85, 0x87, 0x87, 0x85, 0x84, 0x85, 0x84, 0x85, 0x84, 0x84, 0x85, 0x84, 0x85, 0x87, 0x87, 0x88, 0xbd, 0x61, 0x50, 0x54, 0x8f, 0xed, 0xa0, 0x58, 0x6e, 0xa0, 0x72, 0x00, 0x5d, 0xa0, 0x8f, 0x50, 0x00, 0x75, 0xb3, 0x47, 0x83, 0x4f, 0x51, 0x4f, 0x50, 0x8f, 0x84, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x84, 0x85, 0x85, 0x85, 0x84, 0x84, 0x87, 0x87, 0x84, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x82, 0x87, 0x84, 0x82, 0x79, 0x8f, 0xe4, 0xe8, 0xe4, 0xe7, 0xe4, 0xdf, 0xda, 0xd2, 0xd2, 0xd6, 0xd2, 0xd6, 0xd7, 0xd7, 0xd7, 0xd2, 0xd2, 0xd7, 0xdb, 0xde, 0xde, 0xe2, 0xdb, 0xe7, 0xe4, 0xde, 0xea, 0xe5, 0xac, 0x83, 0x82, 0x91, 0x8b, 0x8d, 0xa5, 0x91, 0x8d, 0x84, 0x7e, 0x84, 0x83, 0x79, 0x8f, 0xdb, 0xe8, 0xde, 0xdf, 0xdf, 0xe2, 0xdf, 0xe1, 0xdf, 0xdf, 0xde, 0xdf, 0xe0, 0xdb, 0x47, 0x7d, 0x7f, 0x7f, 0x7f, 0x75, 0x6e, 0x6c, 0x71, 0x6c, 0x67, 0xa5, 0xf0, 0xe2, 0xdb, 0xd7, 0xdb, 0xd6, 0xda, 0xd9, 0xd7, 0xd6, 0xd9, 0xd6, 0xd9, 0xd7, 0xd7, 0xdb, 0xde, 0xe2, 0xde, 0xe1, 0xdb, 0xe7, 0xdf, 0xdf, 0xeb, 0xca, 0x83, 0x87, 0x87, 0x87, 0x91, 0x8d, 0x8b, 0x8c, 0x88, 0x85, 0x81, 0x81, 0x81, 0x75, 0xac, 0xeb, 0xdf, 0xdf, 0xe7, 0xdb, 0xe6, 0xdb, 0xe2, 0xe1, 0xdc, 0xe5, 0xd9, 0xa0, 0x8a, 0x47, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xea, 0x83, 0x8d, 0x87, 0x8b, 0x87, 0x87, 0x87, 0x88, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8b, 0x87, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8b, 0x8a, 0xbd, 0x5d, 0x51, 0x00, 0xb3, 0xa6, 0xa0, 0x65, 0xac, 0xc1, 0x83, 0x50, 0x83, 0xd4, 0xed, 0x65, 0x51, 0xb3, 0xcb, 0xbd, 0xa6, 0x00, 0x4d, 0x00, 0x56, 0xac, 0x83, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x84, 0x84, 0x82, 0x84, 0x84, 0x84, 0x84, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x84, 0x84, 0x82, 0x84, 0x82, 0x84, 0x84, 0x84, 0x83, 0x79, 0xa6, 0xea, 0xe4, 0xe2, 0xe8, 0xe8, 0xe7, 0xe2, 0xe2, 0xdb, 0xd9, 0xda, 0xd7, 0xd7, 0xd7, 0xd2, 0xd7, 0xd4, 0xdc, 0xe2, 0xde, 0xde, 0xe2, 0xdb, 0xe1, 0xdf, 0xe1, 0xeb, 0xc2, 0x7e, 0x88, 0x8d, 0x87, 0x8b, 0x8b, 0x87, 0x88, 0x8b, 0x8b, 0x87, 0x81, 0x81, 0x81, 0x79, 0xac, 0xeb, 0xde, 0xe5, 0xe2, 0xe2, 0xe1, 0xe2, 0xdf, 0xdf, 0xdf, 0xde, 0xe1, 0xe0, 0xc1, 0x83, 0x7d, 0x7f, 0x7d, 0x73, 0x72, 0x71, 0x6c, 0x6f, 0x6c, 0xd7, 0xed, 0xea, 0xe8, 0xe5, 0xea, 0xdf, 0xe5, 0xde, 0xdf, 0xdc, 0xdb, 0xdc, 0xd9, 0xd9, 0xdb, 0xdb, 0xde, 0xe2, 0xe0, 0xe2, 0xdb, 0xe7, 0xdc, 0xe7, 0xdf, 0x94, 0x87, 0x87, 0x8d, 0x8d, 0x88, 0x8d, 0x91, 0x8d, 0x82, 0x8d, 0x8d, 0x81, 0x7e, 0x79, 0x7e, 0xda, 0xe5, 0xdf, 0xdf, 0xe1, 0xe1, 0xe2, 0xdf, 0xdf, 0xe1, 0xe1, 0xdc, 0xd7, 0xda, 0xe9, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0xed, 0x83, 0x8a, 0x85, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x85, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x87, 0x87, 0x85, 0x85, 0x85, 0x85, 0x87, 0x87, 0x8a, 0xb9, 0x61, 0x51, 0x00, 0xcb, 0x7f, 0xa0, 0x5d, 0xf2, 0x4d, 0x6a, 0x79, 0x7d, 0x5f, 0x47, 0x75, 0x57, 0x6a, 0x00, 0x47, 0xcb, 0xfb, 0x53, 0x00, 0x58, 0xa6, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x84, 0x85, 0x85, 0x85, 0x85, 0x87, 0x84, 0x84, 0x87, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x82, 0x82, 0x84, 0x83, 0x84, 0x7d, 0xb3, 0xea, 0xde, 0xe2, 0xe2, 0xde, 0xe2, 0xe4, 0xeb, 0xe8, 0xe8, 0xe7, 0xe5, 0xdf, 0xdf, 0xdb, 0xe2, 0xdf, 0xe0, 0xe2, 0xde, 0xde, 0xe2, 0xdc, 0xe1, 0xdf, 0xe2, 0xdc, 0xa0, 0x8a, 0x88, 0x87, 0x8b, 0x8d, 0x8d, 0x8d, 0x8d, 0x88, 0x8d, 0x8d, 0x81, 0x7e, 0x81, 0x7b, 0x81, 0xe2, 0xe2, 0xe2, 0xde, 0xdf, 0xe1, 0xe1, 0xdf, 0xdf, 0xde, 0xde, 0xe2, 0xe6, 0xcb, 0x7f, 0x7d, 0x7f, 0x79, 0x72, 0x71, 0x71, 0x71, 0x6c, 0x76, 0xe5, 0xed, 0xed, 0xed, 0xe8, 0xeb, 0xe5, 0xe2, 0xe2, 0xde, 0xdc, 0xdb, 0xdb, 0xdb, 0xd7, 0xda, 0xdb, 0xdb, 0xdb, 0xde, 0xe4, 0xdb, 0xdf, 0xdf, 0xe8, 0xd2, 0x81, 0x8a, 0x8d, 0x88, 0x8d, 0x91, 0x8d, 0x8d, 0x8d, 0x8d, 0x88, 0x87, 0x84, 0x7e, 0x81, 0x76, 0xbd, 0xe5, 0xe2, 0xdf, 0xdf, 0xe2, 0xe1, 0xde, 0xdf, 0xdf, 0xdf, 0xe1, 0xef, 0x01, 0x01, 0xf0, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8a, 0x8a, 0x85, 0x87, 0x87, 0x88, 0x87, 0x88, 0x87, 0x87, 0x88, 0x87, 0x87, 0x87, 0x87, 0x88, 0x87, 0x87, 0x87, 0x85, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x87, 0x88, 0xb3, 0x65, 0x54, 0x4f, 0xe2, 0xa6, 0x8f, 0x00, 0x79, 0x7d, 0x75, 0x8f, 0x89, 0x94, 0xdb, 0x7d, 0x61, 0x7f, 0x89, 0xac, 0xf8, 0xbd, 0x58, 0x00, 0x5f, 0xa0, 0x84, 0x84, 0x85, 0x84, 0x85, 0x84, 0x85, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x82, 0x82, 0x84, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x7d, 0xc2, 0xe8, 0xde, 0xe2, 0xde, 0xde, 0xe2, 0xe2, 0xe2, 0xe5, 0xe2, 0xe5, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xde, 0xdb, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xe5, 0xe5, 0xca, 0x8a, 0x88, 0x88, 0x8d, 0x8d, 0x8d, 0x8b, 0x88, 0x87, 0x88, 0x8d, 0x8d, 0x84, 0x81, 0x7e, 0x7e, 0x77, 0xd2, 0xe8, 0xe2, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xde, 0xe2, 0xde, 0xda, 0x7f, 0x7d, 0x7f, 0x79, 0x72, 0x71, 0x71, 0x71, 0x67, 0x8b, 0xea, 0xef, 0xea, 0xea, 0xea, 0xe2, 0xe7, 0xe4, 0xe2, 0xdc, 0xdb, 0xdb, 0xd9, 0xd9, 0xd7, 0xd7, 0xdb, 0xde, 0xdb, 0xe0, 0xe2, 0xde, 0xdf, 0xe2, 0xe5, 0xac, 0x84, 0x88, 0x8d, 0x8a, 0x91, 0x8b, 0x7b, 0x7a, 0x81, 0x8b, 0x8b, 0x88, 0x87, 0x81, 0x7e, 0x79, 0x8d, 0xe8, 0xdc, 0xe7, 0xdb, 0xe1, 0xde, 0xe1, 0xdf, 0xe1, 0xdf, 0xe4, 0xed, 0x01, 0xef, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xa6, 0x82, 0x88, 0x87, 0x88, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x87, 0x87, 0xbd, 0x6b, 0x00, 0x59, 0x96, 0x75, 0x7d, 0x53, 0x61, 0xd7, 0xc1, 0x5d, 0x7a, 0x96, 0xcb, 0x61, 0x73, 0xc1, 0x96, 0xa6, 0xda, 0x83, 0x58, 0x00, 0x61, 0xa6, 0x82, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x82, 0x84, 0x83, 0x81, 0xd7, 0xe4, 0xda, 0xdb, 0xdb, 0xde, 0xdc, 0xe2, 0xe7, 0xe5, 0xe8, 0xe7, 0xe8, 0xe5, 0xe7, 0xdf, 0xda, 0xdb, 0xdb, 0xe0, 0xe2, 0xde, 0xde, 0xe1, 0xdf, 0xe2, 0xdf, 0xb0, 0x84, 0x8d, 0x88, 0x8d, 0x91, 0x88, 0x7a, 0x76, 0x7a, 0x84, 0x8d, 0x8d, 0x87, 0x82, 0x81, 0x7e, 0x79, 0xa0, 0xe8, 0xe4, 0xdf, 0xdc, 0xe1, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe2, 0xe0, 0xdb, 0x83, 0x7d, 0x7f, 0x77, 0x71, 0x76, 0x71, 0x6c, 0x6c, 0xb0, 0xef, 0xed, 0xed, 0xe9, 0xe7, 0xdc, 0xdc, 0xdc, 0xde, 0xdb, 0xdc, 0xdb, 0xd9, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xde, 0xe6, 0xe2, 0xe4, 0xdf, 0xe7, 0xdc, 0x94, 0x87, 0x8a, 0x88, 0x94, 0x8b, 0x72, 0x67, 0x66, 0x67, 0x75, 0x8b, 0x8d, 0x84, 0x82, 0x7e, 0x79, 0x84, 0xd9, 0xe2, 0xe1, 0xdb, 0xdf, 0xdf, 0xde, 0xe1, 0xdf, 0xde, 0xe4, 0xef, 0xf0, 0xf0, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xc2, 0x7b, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x87, 0x87, 0x87, 0x85, 0x87, 0x85, 0x87, 0x87, 0x88, 0x87, 0x87, 0xb3, 0xa6, 0x62, 0x00, 0x52, 0x00, 0x52, 0x53, 0x50, 0x59, 0x5b, 0x51, 0x62, 0x50, 0x56, 0x50, 0x4d, 0x4f, 0x51, 0x50, 0x73, 0x00, 0x4e, 0x00, 0x66, 0x94, 0x82, 0x84, 0x85, 0x84, 0x85, 0x85, 0x85, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x82, 0x82, 0x82, 0x84, 0x82, 0x82, 0x81, 0x87, 0x7a, 0x8a, 0xe7, 0xe8, 0xde, 0xe2, 0xde, 0xdf, 0xdf, 0xe2, 0xdf, 0xdc, 0xdc, 0xdb, 0xd9, 0xda, 0xd7, 0xd7, 0xd2, 0xda, 0xde, 0xe2, 0xe2, 0xde, 0xde, 0xe4, 0xdb, 0xe2, 0xd9, 0x94, 0x84, 0x88, 0x88, 0x8b, 0x87, 0x76, 0x66, 0x60, 0x6b, 0x76, 0x81, 0x8b, 0x8b, 0x87, 0x81, 0x7b, 0x7b, 0x81, 0xdf, 0xe7, 0xe2, 0xdf, 0xdc, 0xe1, 0xdf, 0xde, 0xe2, 0xde, 0xe4, 0xe2, 0xde, 0x83, 0x7d, 0x7d, 0x77, 0x72, 0x71, 0x76, 0x6c, 0x71, 0xbd, 0xdf, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xd9, 0xdb, 0xdf, 0xe2, 0xe5, 0xe7, 0xe8, 0xe5, 0xdc, 0xdc, 0xe2, 0xde, 0xde, 0xde, 0xe0, 0xe8, 0xde, 0xe7, 0xd2, 0x84, 0x8b, 0x8d, 0x88, 0x8d, 0x79, 0x60, 0x66, 0x66, 0x60, 0x60, 0x77, 0x8b, 0x8b, 0x82, 0x7e, 0x79, 0x7a, 0xbd, 0xeb, 0xdf, 0xe1, 0xdf, 0xde, 0xe1, 0xdf, 0xde, 0xdf, 0xe4, 0xee, 0x01, 0xf0, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x4c, 0x01, 0x01, 0xda, 0x81, 0x85, 0x85, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x87, 0x87, 0x87, 0xca, 0xd6, 0xb0, 0xac, 0x91, 0xa0, 0xa5, 0xa5, 0x8d, 0x75, 0x87, 0xd2, 0x94, 0x7a, 0x79, 0xa0, 0xa5, 0x7d, 0x8a, 0xa0, 0x81, 0xa0, 0x8a, 0x8d, 0x87, 0x84, 0x87, 0x85, 0x87, 0x84, 0x87, 0x84, 0x85, 0x84, 0x85, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x82, 0x82, 0x82, 0x84, 0x85, 0x84, 0x79, 0xa5, 0xe5, 0xe4, 0xe7, 0xe7, 0xe1, 0xd9, 0xd7, 0xd2, 0xca, 0xca, 0xca, 0xca, 0xcb, 0xca, 0xc2, 0xcb, 0xcb, 0xd7, 0xde, 0xe2, 0xdf, 0xde, 0xde, 0xe0, 0xdb, 0xe8, 0xd2, 0x8d, 0x87, 0x84, 0x8b, 0x88, 0x7a, 0x68, 0x60, 0x6b, 0x66, 0x67, 0x76, 0x7e, 0x8d, 0x88, 0x7e, 0x7e, 0x7b, 0x7b, 0xd2, 0xe8, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xde, 0xe2, 0xe0, 0xde, 0xe2, 0xe2, 0x89, 0x7d, 0x7d, 0x75, 0x71, 0x71, 0x71, 0x71, 0x7a, 0xdc, 0xe2, 0xe0, 0xe0, 0xe9, 0xea, 0xea, 0xeb, 0xe8, 0xe8, 0xe5, 0xe5, 0xdc, 0xd9, 0xd6, 0xd7, 0xd7, 0xdf, 0xde, 0xde, 0xde, 0xdb, 0xe4, 0xde, 0xe7, 0xbd, 0x82, 0x8d, 0x8d, 0x8d, 0x82, 0x68, 0x5e, 0x6b, 0x6b, 0x68, 0x5f, 0x63, 0x7b, 0x8d, 0x87, 0x7e, 0x7b, 0x76, 0xb0, 0xeb, 0xdf, 0xe1, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xe0, 0xe0, 0xef, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xeb, 0x8f, 0x85, 0x85, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x87, 0x87, 0x87, 0x85, 0x87, 0x85, 0x87, 0x87, 0x88, 0x87, 0x88, 0x8b, 0x8a, 0xb0, 0xc2, 0xb9, 0xb0, 0xbe, 0xca, 0xbd, 0xc4, 0xb0, 0xb9, 0xbe, 0xc2, 0xc4, 0xbe, 0xb9, 0xd2, 0xd9, 0xc2, 0xbd, 0xb9, 0xca, 0xb9, 0xa5, 0x82, 0x85, 0x87, 0x85, 0x87, 0x87, 0x85, 0x87, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x82, 0x82, 0x84, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x85, 0x82, 0x7b, 0xc2, 0xdf, 0xdc, 0xda, 0xd9, 0xd7, 0xd2, 0xd2, 0xcb, 0xd2, 0xca, 0xd2, 0xd2, 0xd2, 0xd2, 0xd7, 0xd2, 0xd7, 0xd9, 0xe2, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xe7, 0xc2, 0x8a, 0x88, 0x87, 0x8d, 0x82, 0x6f, 0x5f, 0x60, 0x6b, 0x67, 0x68, 0x6c, 0x77, 0x8d, 0x88, 0x7e, 0x7e, 0x7b, 0x79, 0xbd, 0xe8, 0xe1, 0xe1, 0xdc, 0xe1, 0xdf, 0xdf, 0xe0, 0xe2, 0xde, 0xe0, 0xe8, 0x8a, 0x7d, 0x7a, 0x75, 0x71, 0x76, 0x71, 0x63, 0x87, 0xdf, 0xeb, 0xec, 0xe9, 0xe8, 0xde, 0xdc, 0xdb, 0xd7, 0xd9, 0xd7, 0xd2, 0xd2, 0xca, 0xca, 0xca, 0xd2, 0xdc, 0xde, 0xde, 0xde, 0xde, 0xe6, 0xdb, 0xe4, 0xb0, 0x84, 0x8d, 0x8d, 0x91, 0x7a, 0x66, 0x62, 0x66, 0x5f, 0x62, 0x68, 0x60, 0x71, 0x8b, 0x88, 0x85, 0x7a, 0x77, 0xa0, 0xeb, 0xdf, 0xe5, 0xdf, 0xdf, 0xdf, 0xe1, 0xe0, 0xde, 0xe6, 0xee, 0x01, 0xf0, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xb0, 0x82, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x87, 0x87, 0x87, 0x87, 0x85, 0x88, 0x87, 0x88, 0x87, 0x87, 0x88, 0x82, 0x85, 0x82, 0x88, 0x82, 0x87, 0x88, 0x87, 0x87, 0x88, 0x87, 0x88, 0x85, 0x8d, 0x8d, 0x8a, 0x88, 0x84, 0x8a, 0x88, 0x91, 0x85, 0x88, 0x84, 0x87, 0x84, 0x87, 0x85, 0x87, 0x85, 0x87, 0x84, 0x85, 0x84, 0x85, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x82, 0x84, 0x82, 0x82, 0x84, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x8a, 0xeb, 0xe1, 0xe1, 0xdc, 0xdb, 0xda, 0xda, 0xd7, 0xd9, 0xd6, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xdc, 0xe2, 0xdf, 0xdc, 0xdf, 0xe4, 0xde, 0xde, 0xe8, 0xb3, 0x87, 0x88, 0x88, 0x8a, 0x7b, 0x6b, 0x60, 0x64, 0x66, 0x68, 0x67, 0x67, 0x76, 0x85, 0x8b, 0x87, 0x7a, 0x81, 0x77, 0xb9, 0xe7, 0xde, 0xe1, 0xe1, 0xdf, 0xdf, 0xde, 0xe2, 0xe0, 0xe4, 0xe4, 0xe2, 0x89, 0x75, 0x70, 0x6c, 0x71, 0x71, 0x71, 0x6f, 0xa5, 0xdc, 0xde, 0xe0, 0xdb, 0xda, 0xd7, 0xcb, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd7, 0xdf, 0xdf, 0xde, 0xdf, 0xe0, 0xde, 0xe2, 0xdc, 0xa6, 0x8a, 0x8b, 0x8d, 0x8b, 0x76, 0x63, 0x66, 0x66, 0x64, 0x66, 0x60, 0x5f, 0x76, 0x88, 0x88, 0x84, 0x7a, 0x7a, 0x94, 0xe5, 0xe2, 0xdf, 0xdf, 0xdf, 0xe1, 0xde, 0xe1, 0xe0, 0xe0, 0xee, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xee, 0x01, 0xd4, 0x89, 0x83, 0x87, 0x87, 0x87, 0x87, 0x84, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x85, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x87, 0x85, 0x88, 0x87, 0x88, 0x85, 0x88, 0x85, 0x8b, 0x87, 0x88, 0x88, 0x88, 0x8b, 0x85, 0x88, 0x88, 0x88, 0x88, 0x88, 0x85, 0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x85, 0x85, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x87, 0x87, 0x85, 0x85, 0x84, 0x82, 0x84, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x84, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x84, 0x83, 0x81, 0x83, 0x84, 0x8a, 0x84, 0x83, 0x81, 0x7e, 0x7d, 0xb9, 0xed, 0xdc, 0xe1, 0xe2, 0xe1, 0xe2, 0xdf, 0xdc, 0xda, 0xd9, 0xd7, 0xd9, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xda, 0xdf, 0xdf, 0xdb, 0xdf, 0xdf, 0xde, 0xe0, 0xe2, 0xe2, 0xb3, 0x88, 0x84, 0x8a, 0x8b, 0x79, 0x66, 0x60, 0x68, 0x62, 0x67, 0x6b, 0x67, 0x71, 0x87, 0x8b, 0x85, 0x7e, 0x7a, 0x79, 0xac, 0xed, 0xde, 0xdf, 0xdf, 0xdf, 0xe1, 0xde, 0xe2, 0xde, 0xde, 0xe4, 0xe8, 0x7b, 0x6b, 0x6a, 0x67, 0x6b, 0x67, 0x67, 0x88, 0xdb, 0xe7, 0xde, 0xde, 0xdb, 0xdb, 0xdb, 0xd9, 0xd9, 0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xdc, 0xdc, 0xdf, 0xdf, 0xe2, 0xe4, 0xdb, 0xe4, 0xde, 0xa5, 0x8a, 0x88, 0x91, 0x85, 0x71, 0x68, 0x66, 0x66, 0x66, 0x66, 0x67, 0x60, 0x76, 0x88, 0x87, 0x82, 0x7b, 0x77, 0x94, 0xe7, 0xdb, 0xe4, 0xe2, 0xe2, 0xde, 0xe0, 0xde, 0xde, 0xe6, 0xee, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x48, 0x89, 0x83, 0x83, 0x82, 0x83, 0x84, 0x8a, 0x87, 0x84, 0x84, 0x84, 0x87, 0x87, 0x87, 0x87, 0x84, 0x87, 0x85, 0x87, 0x87, 0x85, 0x8a, 0x8b, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8c, 0x8b, 0x88, 0x88, 0x8b, 0x88, 0x88, 0x8b, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x87, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x85, 0x87, 0x87, 0x85, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x8a, 0x8a, 0x87, 0x87, 0x84, 0x84, 0x83, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x83, 0x7e, 0x7d, 0x7d, 0x7d, 0x7b, 0x83, 0x81, 0x8f, 0xd7, 0xea, 0xe7, 0xdf, 0xde, 0xdf, 0xe2, 0xdf, 0xde, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd7, 0xdb, 0xe4, 0xe1, 0xdb, 0xe1, 0xde, 0xde, 0xe2, 0xe2, 0xdf, 0xb3, 0x87, 0x88, 0x87, 0x8b, 0x7a, 0x6b, 0x60, 0x68, 0x67, 0x68, 0x69, 0x66, 0x76, 0x84, 0x88, 0x82, 0x81, 0x79, 0x7a, 0xa6, 0xeb, 0xde, 0xde, 0xe1, 0xde, 0xe2, 0xde, 0xdf, 0xe2, 0xe7, 0xe4, 0xdc, 0x7d, 0x6a, 0x64, 0x68, 0x6a, 0x6f, 0x8f, 0xda, 0xed, 0xe8, 0xe4, 0xe2, 0xdc, 0xdc, 0xdc, 0xdc, 0xd9, 0xdb, 0xdb, 0xdb, 0xda, 0xd9, 0xda, 0xd7, 0xd9, 0xdb, 0xe1, 0xdf, 0xdf, 0xe1, 0xe2, 0xdb, 0xe7, 0xdc, 0xa0, 0x8a, 0x8b, 0x8d, 0x8b, 0x76, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x63, 0x76, 0x87, 0x87, 0x82, 0x7e, 0x77, 0x94, 0xe8, 0xde, 0xe4, 0xe2, 0xe2, 0xde, 0xdf, 0xe0, 0xde, 0xe6, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0xe0, 0xac, 0xa0, 0x8a, 0x8a, 0x89, 0x84, 0x83, 0x83, 0x84, 0x83, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x87, 0x87, 0x87, 0x87, 0x88, 0x8b, 0x8b, 0x88, 0x8b, 0x87, 0x87, 0x88, 0x88, 0x85, 0x84, 0x87, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x85, 0x88, 0x87, 0x88, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x84, 0x84, 0x84, 0x82, 0x82, 0x84, 0x81, 0x84, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x81, 0x81, 0x81, 0x81, 0x83, 0x81, 0x83, 0x89, 0x84, 0x8f, 0xa0, 0xac, 0xb9, 0xcb, 0xe8, 0xea, 0xea, 0xe7, 0xe4, 0xdf, 0xde, 0xe1, 0xe2, 0xe2, 0xe1, 0xe2, 0xe2, 0xde, 0xdf, 0xde, 0xdc, 0xde, 0xdb, 0xdb, 0xdf, 0xe7, 0xe2, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xe2, 0xdf, 0xb0, 0x84, 0x88, 0x87, 0x87, 0x81, 0x76, 0x66, 0x66, 0x6e, 0x6b, 0x67, 0x6f, 0x7a, 0x87, 0x8b, 0x82, 0x81, 0x7b, 0x79, 0xac, 0xe8, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xdf, 0xde, 0xdc, 0xe2, 0xe7, 0xc2, 0xcb, 0xcb, 0xda, 0xd7, 0xda, 0xf0, 0xed, 0xde, 0xea, 0xea, 0xe4, 0xe2, 0xdc, 0xdc, 0xd9, 0xd9, 0xdb, 0xd9, 0xdb, 0xd9, 0xda, 0xd9, 0xda, 0xdb, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xe2, 0xde, 0xe7, 0xdc, 0xa0, 0x87, 0x8d, 0x8d, 0x91, 0x7a, 0x60, 0x67, 0x6b, 0x67, 0x6b, 0x63, 0x6b, 0x7b, 0x8d, 0x88, 0x82, 0x7e, 0x77, 0x94, 0xe8, 0xe5, 0xde, 0xe4, 0xde, 0xe2, 0xde, 0xe1, 0xe0, 0xe6, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x01, 0x01, 0xf0, 0xf0, 0xea, 0xe7, 0xe2, 0xe1, 0xde, 0xd9, 0xcb, 0xc2, 0xbd, 0xb9, 0xb3, 0xac, 0xa6, 0xa5, 0x94, 0x94, 0x8f, 0x8d, 0x8f, 0x8d, 0x8a, 0x8a, 0x8a, 0x8a, 0x87, 0x8a, 0x87, 0x8a, 0x87, 0x8a, 0x87, 0x88, 0x87, 0x87, 0x84, 0x84, 0x84, 0x82, 0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x84, 0x83, 0x87, 0x83, 0x87, 0x84, 0x8a, 0x8a, 0x8a, 0x8a, 0x8f, 0x8f, 0x8f, 0x94, 0x94, 0x96, 0x94, 0xa0, 0xa0, 0xa0, 0xa6, 0xac, 0xb3, 0xb3, 0xbd, 0xc1, 0xcb, 0xd4, 0xdb, 0xdb, 0xea, 0xec, 0xef, 0xf0, 0xef, 0xed, 0xed, 0xe8, 0xea, 0xe8, 0xe4, 0xe7, 0xe7, 0xe7, 0xe7, 0xe2, 0xdf, 0xe2, 0xe2, 0xe4, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xde, 0xe4, 0xe1, 0xde, 0xe2, 0xdf, 0xde, 0xde, 0xdf, 0xe2, 0xac, 0x83, 0x88, 0x8b, 0x87, 0x84, 0x7b, 0x6f, 0x66, 0x68, 0x67, 0x6b, 0x76, 0x7e, 0x87, 0x8b, 0x84, 0x7e, 0x7b, 0x79, 0xb3, 0xe5, 0xe2, 0xde, 0xe1, 0xde, 0xdf, 0xde, 0xe2, 0xdf, 0xe4, 0xe2, 0xe7, 0xe8, 0x4c, 0xed, 0xee, 0xed, 0xed, 0xe4, 0xe2, 0xe4, 0xe9, 0xea, 0xea, 0xe4, 0xdf, 0xdc, 0xdc, 0xdc, 0xda, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xe2, 0xde, 0xe1, 0xde, 0xe1, 0xde, 0xe2, 0xe2, 0xe5, 0xde, 0xa5, 0x84, 0x8d, 0x8d, 0x8d, 0x82, 0x6b, 0x67, 0x6b, 0x66, 0x67, 0x68, 0x76, 0x85, 0x8b, 0x8b, 0x82, 0x7a, 0x79, 0xa0, 0xe5, 0xe8, 0xdb, 0xe2, 0xe2, 0xde, 0xde, 0xe2, 0xe0, 0xe6, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0xf8, 0xee, 0xf0, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0xef, 0xea, 0xed, 0xed, 0xef, 0xed, 0xed, 0xeb, 0xe7, 0xdf, 0xdb, 0xd9, 0xd7, 0xd7, 0xd7, 0xd2, 0xcb, 0xd2, 0xcb, 0xca, 0xcb, 0xca, 0xcb, 0xca, 0xcb, 0xc2, 0xc2, 0xbd, 0xbd, 0xc2, 0xbd, 0xb9, 0xbd, 0xb3, 0xbd, 0xb9, 0x47, 0xb9, 0x47, 0xb9, 0x47, 0xb9, 0xb9, 0x47, 0xb9, 0x47, 0xbd, 0xbd, 0xbd, 0xc2, 0xc1, 0xc2, 0xcb, 0xcb, 0xd4, 0xd4, 0xd7, 0xda, 0xda, 0xd7, 0xda, 0xde, 0xe0, 0xe6, 0xe8, 0xe9, 0xec, 0xed, 0xee, 0xee, 0x4c, 0xef, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0xef, 0xea, 0xe8, 0xe4, 0xdf, 0xe7, 0xef, 0xe8, 0xe8, 0xe7, 0xe7, 0xe2, 0xdf, 0xde, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe2, 0xde, 0xdc, 0xde, 0xdf, 0xdf, 0xe1, 0xe2, 0xe2, 0xde, 0xde, 0xe5, 0xb3, 0x84, 0x87, 0x8d, 0x87, 0x85, 0x84, 0x7b, 0x72, 0x6f, 0x6b, 0x71, 0x7b, 0x82, 0x87, 0x88, 0x84, 0x7e, 0x7b, 0x79, 0xb9, 0xe8, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xe2, 0xe2, 0xde, 0xed, 0x4c, 0xea, 0xed, 0xea, 0xe2, 0xe6, 0xed, 0xea, 0xe0, 0xe8, 0xea, 0xe8, 0xe4, 0xdc, 0xdf, 0xdc, 0xde, 0xdb, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xde, 0xe4, 0xe2, 0xe2, 0xac, 0x84, 0x8d, 0x8d, 0x8d, 0x91, 0x7e, 0x6f, 0x68, 0x67, 0x68, 0x76, 0x7e, 0x87, 0x8b, 0x87, 0x81, 0x7a, 0x77, 0xb3, 0xe2, 0xe7, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe2, 0xe9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0xf8, 0x4c, 0x01, 0x01, 0xef, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xec, 0xe7, 0xe8, 0xed, 0xed, 0xed, 0xea, 0xea, 0xec, 0xeb, 0xed, 0xed, 0xea, 0xe7, 0xe7, 0xe8, 0xea, 0xea, 0xed, 0xea, 0xea, 0xea, 0xed, 0xea, 0xea, 0xea, 0xef, 0xed, 0xef, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 0xee, 0x01, 0x01, 0xf0, 0xf0, 0xec, 0xe9, 0xe9, 0xe8, 0xde, 0xda, 0xe8, 0xe8, 0xea, 0xea, 0xe7, 0xe4, 0xdf, 0xdf, 0xdf, 0xde, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe1, 0xe2, 0xdf, 0xe1, 0xe2, 0xe2, 0xdb, 0xe7, 0xb9, 0x84, 0x87, 0x8d, 0x88, 0x87, 0x88, 0x87, 0x81, 0x7a, 0x7b, 0x7e, 0x82, 0x88, 0x8b, 0x8b, 0x82, 0x7b, 0x7b, 0x79, 0xc2, 0xe8, 0xde, 0xde, 0xe1, 0xde, 0xe2, 0xde, 0xde, 0xe2, 0xe2, 0xde, 0xe4, 0xec, 0xee, 0xec, 0xec, 0xe9, 0xea, 0xec, 0xe6, 0xe0, 0xea, 0xe9, 0xe8, 0xea, 0xe8, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe8, 0xe8, 0xe8, 0xe8, 0xe4, 0xe4, 0xde, 0xe4, 0xe2, 0xde, 0xe2, 0xe4, 0xe2, 0xe5, 0xb9, 0x87, 0x8d, 0x8d, 0x8d, 0x91, 0x8d, 0x7e, 0x76, 0x77, 0x7a, 0x81, 0x87, 0x8b, 0x8b, 0x88, 0x7e, 0x79, 0x7a, 0xc2, 0xe5, 0xe2, 0xde, 0xe2, 0xe2, 0xe2, 0xde, 0xe4, 0xe0, 0xea, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xef, 0x01, 0x01, 0x01, 0x4c, 0x01, 0xee, 0xe6, 0xe9, 0xea, 0xec, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xe7, 0xe4, 0xe2, 0xe2, 0xe2, 0xde, 0xde, 0xe4, 0xe4, 0xe6, 0xe8, 0xe6, 0xe1, 0xe6, 0xea, 0x4c, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x4c, 0xef, 0xee, 0xf0, 0xf0, 0x4c, 0xee, 0xee, 0xe9, 0xec, 0xee, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0xee, 0xee, 0x01, 0x01, 0xee, 0xe9, 0xe6, 0xe8, 0xe8, 0xdb, 0xe7, 0xe7, 0xe2, 0xea, 0xea, 0xea, 0xe8, 0xe8, 0xe4, 0xe7, 0xdf, 0xe2, 0xe2, 0xdf, 0xde, 0xdf, 0xdf, 0xe8, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe4, 0xde, 0xdb, 0xea, 0xb9, 0x87, 0x84, 0x8d, 0x8b, 0x85, 0x87, 0x88, 0x8b, 0x8a, 0x8b, 0x8a, 0x84, 0x87, 0x8b, 0x85, 0x7e, 0x7b, 0x7b, 0x79, 0xcb, 0xea, 0xde, 0xdf, 0xdf, 0xdf, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe6, 0xea, 0xee, 0xf0, 0xee, 0xed, 0xec, 0xea, 0xf8, 0xed, 0xe9, 0xe0, 0xe8, 0xea, 0xea, 0xe8, 0xe4, 0xe4, 0xe8, 0xe8, 0xe8, 0xe4, 0xe4, 0xe4, 0xe4, 0xe8, 0xe2, 0xe2, 0xe4, 0xe4, 0xe2, 0xde, 0xe7, 0xde, 0xe8, 0xb9, 0x87, 0x8a, 0x8d, 0x91, 0x84, 0x8d, 0x94, 0x8d, 0x8d, 0x8d, 0x8d, 0x87, 0x87, 0x8b, 0x88, 0x7b, 0x7b, 0x79, 0xd7, 0xe7, 0xde, 0xe8, 0xe2, 0xde, 0xe2, 0xe2, 0xe4, 0xe4, 0xea, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0xe9, 0xe0, 0xde, 0xea, 0xef, 0xed, 0xea, 0xec, 0xea, 0xea, 0xea, 0xe8, 0xe9, 0xe7, 0xe6, 0xe2, 0xe0, 0xde, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xe0, 0xe6, 0xe6, 0xe0, 0xe0, 0xee, 0x01, 0xf0, 0x4c, 0xf0, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0xf0, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x01, 0x01, 0xf8, 0xf8, 0x4c, 0xf8, 0xf8, 0xe9, 0xf8, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0xf0, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf8, 0xec, 0xe4, 0xea, 0xe8, 0xe2, 0xda, 0xdb, 0xdf, 0xe2, 0xdf, 0xe7, 0xe8, 0xeb, 0xea, 0xed, 0xe7, 0xe2, 0xe2, 0xe2, 0xe7, 0xea, 0xea, 0xdf, 0xe2, 0xe1, 0xdf, 0xde, 0xe2, 0xde, 0xe4, 0xdb, 0xe5, 0xd7, 0x8a, 0x84, 0x8d, 0x8d, 0x88, 0x87, 0x84, 0x84, 0x88, 0x8b, 0x88, 0x88, 0x87, 0x8b, 0x85, 0x7e, 0x7b, 0x7b, 0x7b, 0xeb, 0xdb, 0xe4, 0xe1, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe4, 0xe9, 0xec, 0xee, 0xee, 0xee, 0xf8, 0xe9, 0xe9, 0xec, 0xec, 0xed, 0xea, 0xe9, 0xe6, 0xe8, 0xe9, 0xe9, 0xe8, 0xe8, 0xe8, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe0, 0xe4, 0xe2, 0xe4, 0xe2, 0xde, 0xe4, 0xdb, 0xeb, 0xd7, 0x8a, 0x8d, 0x8d, 0x8d, 0x91, 0x8d, 0x88, 0x8d, 0x8f, 0x8d, 0x8d, 0x8b, 0x8d, 0x8d, 0x80, 0x7b, 0x77, 0x8d, 0xe5, 0xe7, 0xdf, 0xe2, 0xde, 0xe2, 0xe7, 0xe0, 0xde, 0xe6, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xe9, 0xe0, 0xe0, 0xde, 0xde, 0xe0, 0xe4, 0xe8, 0xea, 0xec, 0xec, 0xea, 0xea, 0xe9, 0xe8, 0xe6, 0xe4, 0xe2, 0xe9, 0xe4, 0xe4, 0xe0, 0xe0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe0, 0xec, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x25, 0x01, 0x25, 0x01, 0x25, 0x01, 0x25, 0x01, 0x25, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0x4c, 0xf8, 0xf8, 0xec, 0xe9, 0xf8, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0xec, 0xe0, 0xde, 0xe7, 0xe8, 0xe7, 0xde, 0xdb, 0xdb, 0xde, 0xdf, 0xe2, 0xe2, 0xe7, 0xe2, 0xe4, 0xe8, 0xeb, 0xea, 0xe7, 0xdb, 0xdb, 0xde, 0xe2, 0xe1, 0xdf, 0xde, 0xe1, 0xe4, 0xe7, 0xdb, 0xe8, 0xd9, 0x8a, 0x87, 0x8a, 0x8d, 0x8d, 0x88, 0x87, 0x87, 0x8a, 0x88, 0x88, 0x88, 0x8b, 0x8b, 0x85, 0x7e, 0x7e, 0x7b, 0x8f, 0xe8, 0xe7, 0xde, 0xe1, 0xde, 0xdf, 0xe2, 0xe2, 0xe4, 0xe2, 0xe2, 0xe0, 0xe6, 0xec, 0x4c, 0xee, 0x4c, 0xf8, 0xec, 0xe9, 0xe6, 0xe8, 0xe6, 0xea, 0xea, 0xe8, 0xe9, 0xea, 0xea, 0xea, 0xe8, 0xe8, 0xea, 0xea, 0xe8, 0xe8, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe2, 0xe0, 0xe8, 0xdb, 0xe7, 0xe7, 0xdc, 0x94, 0x87, 0x8a, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8b, 0x8d, 0x8d, 0x87, 0x7e, 0x82, 0x72, 0xac, 0xeb, 0xdb, 0xe8, 0xde, 0xe2, 0xe2, 0xe4, 0xe2, 0xde, 0xe9, 0xee, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xe9, 0xe0, 0xe9, 0xe0, 0xdb, 0xde, 0xe1, 0xe0, 0xe4, 0xe2, 0xe2, 0xe6, 0xe6, 0xe8, 0xe8, 0xe8, 0xe6, 0xe8, 0xe9, 0xe9, 0xe0, 0xe4, 0xe0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe0, 0xe9, 0xee, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x25, 0x4c, 0x01, 0x01, 0x4c, 0x25, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0x4c, 0x4c, 0x01, 0xf8, 0x4c, 0xee, 0xf8, 0xec, 0xec, 0xec, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x4c, 0xf0, 0x25, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xe0, 0xde, 0xe2, 0xe2, 0xe4, 0xdf, 0xde, 0xdb, 0xdc, 0xde, 0xdf, 0xde, 0xdb, 0xdb, 0xe2, 0xe4, 0xe2, 0xe2, 0xde, 0xda, 0xda, 0xdb, 0xdf, 0xe2, 0xe2, 0xdf, 0xe1, 0xe2, 0xe6, 0xdb, 0xe8, 0xe5, 0xa0, 0x84, 0x88, 0x8b, 0x91, 0x8d, 0x87, 0x88, 0x8b, 0x88, 0x88, 0x88, 0x8d, 0x8b, 0x82, 0x7e, 0x7b, 0x79, 0xb9, 0xe8, 0xe4, 0xde, 0xdf, 0xe1, 0xde, 0xe2, 0xe2, 0xe2, 0xe4, 0xe0, 0xe0, 0xe6, 0xec, 0x01, 0x4c, 0xee, 0xf8, 0xea, 0xe6, 0xe4, 0xe0, 0xde, 0xe4, 0xe6, 0xe4, 0xe8, 0xe9, 0xe9, 0xe9, 0xe8, 0xea, 0xe8, 0xe8, 0xde, 0xdb, 0xdb, 0xdb, 0xe2, 0xe4, 0xe4, 0xe2, 0xde, 0xe8, 0xda, 0xe8, 0xdc, 0xeb, 0xb3, 0x82, 0x8d, 0x91, 0x8d, 0x8b, 0x91, 0x8f, 0x8d, 0x8d, 0x8b, 0x91, 0x8d, 0x82, 0x7b, 0x7e, 0x76, 0xd7, 0xeb, 0xdb, 0xea, 0xde, 0xe4, 0xe2, 0xe2, 0xde, 0xe0, 0xea, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe9, 0xe0, 0xec, 0xed, 0xe9, 0xde, 0xde, 0xdb, 0xde, 0xde, 0xe0, 0xde, 0xde, 0xde, 0xe1, 0xe4, 0xe7, 0xe8, 0xe2, 0xe4, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe6, 0xe6, 0xe0, 0xe6, 0xea, 0x01, 0xf0, 0x01, 0xf0, 0x4c, 0x01, 0xf0, 0x01, 0xf0, 0x4c, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x4c, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0xf8, 0x4c, 0x4c, 0xf8, 0xf8, 0xec, 0xe9, 0xec, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0xf8, 0xe6, 0xe2, 0xde, 0xdb, 0xdc, 0xde, 0xdf, 0xe2, 0xdf, 0xdf, 0xde, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xd9, 0xdb, 0xdf, 0xdb, 0xde, 0xe1, 0xe2, 0xe1, 0xe2, 0xdb, 0xe2, 0xdb, 0xdc, 0xeb, 0xbd, 0x82, 0x84, 0x8d, 0x91, 0x8d, 0x8b, 0x8a, 0x8d, 0x8b, 0x88, 0x8b, 0x8d, 0x8b, 0x81, 0x7e, 0x77, 0x7b, 0xd9, 0xe7, 0xdb, 0xe1, 0xde, 0xdf, 0xdf, 0xe2, 0xe2, 0xe4, 0xe2, 0xe0, 0xe0, 0xe6, 0xf8, 0x01, 0x01, 0x4c, 0xf8, 0xec, 0xe9, 0xe6, 0xe2, 0xe1, 0xe1, 0xde, 0xde, 0xde, 0xe4, 0xe2, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xdc, 0xdb, 0xdb, 0xdb, 0xe2, 0xe2, 0xe7, 0xe2, 0xe1, 0xe0, 0xdb, 0xde, 0xe2, 0xe5, 0xd7, 0x84, 0x8b, 0x91, 0x8d, 0x8d, 0x8d, 0x91, 0x8d, 0x8d, 0x8d, 0x91, 0x8b, 0x7e, 0x7b, 0x76, 0x87, 0xeb, 0xe7, 0xdc, 0xe4, 0xe2, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xec, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe9, 0xde, 0xe4, 0xec, 0xec, 0xea, 0xe7, 0xe1, 0xde, 0xe1, 0xe2, 0xe1, 0xdb, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xe6, 0xe7, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe6, 0xef, 0xf0, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x4c, 0x4c, 0xee, 0x4c, 0xee, 0x4c, 0xee, 0x4c, 0xef, 0x4c, 0xec, 0xec, 0xe9, 0xea, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x4c, 0xf0, 0x25, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xea, 0xe2, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xe2, 0xdf, 0xdf, 0xde, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xde, 0xde, 0xdb, 0xdf, 0xe4, 0xe2, 0xe1, 0xe2, 0xde, 0xe4, 0xe4, 0xda, 0xeb, 0xd7, 0x87, 0x82, 0x88, 0x8d, 0x91, 0x8d, 0x8d, 0x8d, 0x8d, 0x8b, 0x8d, 0x8d, 0x85, 0x7e, 0x7e, 0x77, 0x8f, 0xeb, 0xe7, 0xda, 0xe2, 0xe1, 0xe1, 0xde, 0xe2, 0xe2, 0xe2, 0xe4, 0xe0, 0xe6, 0xec, 0x4c, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xea, 0xe6, 0xe1, 0xe1, 0xe1, 0xe1, 0xdb, 0xe1, 0xde, 0xe0, 0xe0, 0xdc, 0xdb, 0xdb, 0xde, 0xdb, 0xdf, 0xdf, 0xde, 0xe1, 0xe2, 0xe7, 0xe1, 0xe2, 0xdf, 0xea, 0xdb, 0xe8, 0xe1, 0xeb, 0xa0, 0x81, 0x8b, 0x91, 0x91, 0x91, 0x8d, 0x8d, 0x91, 0x8d, 0x8d, 0x85, 0x7e, 0x7b, 0x76, 0xbd, 0xed, 0xdc, 0xe7, 0xdb, 0xe8, 0xe4, 0xe2, 0xe2, 0xe2, 0xe4, 0xef, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xe6, 0xe0, 0xe0, 0xea, 0xed, 0xed, 0xec, 0xe8, 0xe7, 0xe4, 0xe4, 0xe7, 0xe4, 0xe1, 0xe1, 0xde, 0xdf, 0xe1, 0xe4, 0xe7, 0xe7, 0xe7, 0xe4, 0xe4, 0xe1, 0xe2, 0xe7, 0xe4, 0xe1, 0xea, 0xee, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0x4c, 0xee, 0xee, 0xec, 0xe9, 0xe9, 0xea, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0xf0, 0x01, 0xf0, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0xef, 0xea, 0xe8, 0xe7, 0xe8, 0xe7, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xde, 0xdc, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xe2, 0xe2, 0xe4, 0xe1, 0xdf, 0xe4, 0xe7, 0xde, 0xe4, 0xe5, 0xdf, 0xe5, 0xb0, 0x82, 0x84, 0x8b, 0x8d, 0x94, 0x91, 0x8d, 0x8d, 0x8d, 0x91, 0x8b, 0x81, 0x7e, 0x7b, 0x7b, 0xd2, 0xe5, 0xe2, 0xe1, 0xe1, 0xde, 0xdf, 0xdf, 0xe2, 0xe2, 0xe4, 0xe0, 0xe2, 0xec, 0xf8, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xee, 0xe8, 0xe7, 0xe7, 0xe7, 0xe7, 0xe1, 0xe2, 0xe4, 0xe2, 0xe2, 0xe2, 0xe5, 0xe1, 0xdf, 0xdc, 0xdc, 0xdc, 0xe5, 0xe2, 0xe5, 0xe1, 0xe7, 0xe1, 0xe1, 0xe6, 0xdf, 0xe7, 0xdc, 0xeb, 0xd9, 0x87, 0x84, 0x88, 0x91, 0x91, 0x8d, 0x8d, 0x91, 0x8d, 0x85, 0x7e, 0x7b, 0x7a, 0x91, 0xeb, 0xe3, 0xe1, 0xe7, 0xde, 0xe4, 0xdf, 0xe2, 0xe4, 0xe4, 0xe6, 0xee, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf8, 0xe0, 0xde, 0xe2, 0xe4, 0xe7, 0xe8, 0xed, 0xea, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe7, 0xe7, 0xe8, 0xe7, 0xe7, 0xe4, 0xe4, 0xe4, 0xe7, 0xe2, 0xe2, 0xe7, 0xe4, 0xe2, 0xe6, 0xed, 0x4c, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0xee, 0x4c, 0x4c, 0x4c, 0xef, 0x4c, 0xef, 0xf0, 0xef, 0xec, 0xea, 0xe8, 0xe9, 0xec, 0xf0, 0x01, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x4c, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf0, 0x01, 0xf0, 0xef, 0xea, 0xe8, 0xe8, 0xe8, 0xe7, 0xe6, 0xe7, 0xe7, 0xe2, 0xe4, 0xe1, 0xe4, 0xe7, 0xe2, 0xe2, 0xde, 0xdf, 0xe4, 0xe4, 0xe7, 0xe4, 0xe2, 0xe2, 0xe4, 0xe2, 0xe6, 0xdb, 0xe1, 0xe8, 0xdb, 0xeb, 0xd7, 0x84, 0x82, 0x87, 0x8b, 0x91, 0x94, 0x91, 0x91, 0x91, 0x91, 0x88, 0x7e, 0x7b, 0x7a, 0x8d, 0xeb, 0xd9, 0xe7, 0xe7, 0xde, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf8, 0xea, 0xe8, 0xea, 0xea, 0xe7, 0xe4, 0xe2, 0xe2, 0xe4, 0xe1, 0xde, 0xdf, 0xe2, 0xe2, 0xe7, 0xe1, 0xe7, 0xe1, 0xe7, 0xe1, 0xe7, 0xe1, 0xe4, 0xe2, 0xe2, 0xe4, 0xde, 0xdc, 0xdf, 0xeb, 0xb0, 0x87, 0x81, 0x8d, 0x8d, 0x8d, 0x91, 0x91, 0x88, 0x7e, 0x7b, 0x7a, 0x7b, 0xc4, 0xed, 0xdc, 0xe2, 0xe1, 0xe2, 0xe1, 0xe2, 0xe2, 0xe4, 0xe4, 0xea, 0xef, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xe0, 0xe0, 0xe6, 0xde, 0xde, 0xde, 0xe4, 0xe7, 0xea, 0xea, 0xea, 0xec, 0xed, 0xea, 0xea, 0xe8, 0xe4, 0xe4, 0xe6, 0xe4, 0xe7, 0xe4, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe9, 0xec, 0xee, 0xf0, 0xf0, 0xf0, 0x4c, 0xf0, 0xf0, 0xf0, 0xf0, 0x4c, 0xef, 0x4c, 0x4c, 0x4c, 0x4c, 0xf0, 0xee, 0xef, 0xf0, 0xec, 0xe6, 0xe9, 0xec, 0xec, 0xec, 0x01, 0xf0, 0x01, 0xf0, 0x25, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x25, 0xf0, 0x25, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x25, 0xf0, 0xf0, 0xf8, 0xe8, 0xe9, 0xec, 0xe9, 0xe6, 0xe8, 0xe6, 0xe8, 0xe6, 0xe4, 0xe4, 0xe2, 0xe8, 0xe8, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xec, 0xe4, 0xe2, 0xe4, 0xe8, 0xe4, 0xe1, 0xe2, 0xe1, 0xe2, 0xe1, 0xe1, 0xeb, 0xb3, 0x82, 0x7e, 0x84, 0x84, 0x8d, 0x8d, 0x91, 0x91, 0x85, 0x7e, 0x7e, 0x7a, 0x82, 0xd2, 0xeb, 0xd7, 0xe8, 0xdc, 0xe2, 0xdf, 0xde, 0xe2, 0xe2, 0xe4, 0xe4, 0xe2, 0xe6, 0xee, 0xf0, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xee, 0xee, 0xec, 0xe6, 0xea, 0xec, 0xea, 0xe9, 0xe8, 0xe9, 0xe8, 0xe6, 0xe7, 0xe7, 0xe4, 0xe4, 0xe4, 0xe8, 0xe8, 0xe4, 0xe7, 0xe6, 0xe4, 0xe2, 0xde, 0xe2, 0xe0, 0xe2, 0xe4, 0xe2, 0xe2, 0xe5, 0xe2, 0xa0, 0x7e, 0x84, 0x88, 0x91, 0x91, 0x8b, 0x82, 0x7b, 0x7b, 0x7a, 0xb0, 0xe5, 0xe5, 0xe4, 0xe2, 0xe4, 0xe0, 0xe4, 0xdf, 0xe4, 0xdf, 0xe4, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xe9, 0xe0, 0xe6, 0xe6, 0xe2, 0xdf, 0xde, 0xe1, 0xe2, 0xe4, 0xe7, 0xe7, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe7, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe0, 0xe6, 0xec, 0xf0, 0x01, 0xf0, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x4c, 0xee, 0xf8, 0x4c, 0xf8, 0xef, 0xf8, 0xf8, 0xea, 0xe9, 0xec, 0xe9, 0xec, 0xee, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xee, 0xe9, 0xe6, 0xec, 0xec, 0xed, 0xe9, 0xe7, 0xe8, 0xea, 0xe8, 0xe7, 0xe7, 0xe6, 0xe4, 0xe4, 0xe2, 0xe4, 0xe8, 0xea, 0xed, 0xe8, 0xe4, 0xe6, 0xe8, 0xe2, 0xe0, 0xe2, 0xe2, 0xdf, 0xe1, 0xe2, 0xe2, 0xe5, 0x94, 0x7b, 0x88, 0x88, 0x81, 0x82, 0x80, 0x80, 0x85, 0x7e, 0x7b, 0x7e, 0xb9, 0xe5, 0xeb, 0xdc, 0xe5, 0xdb, 0xe5, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xea, 0xee, 0xf0, 0xf0, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 0xe9, 0xec, 0xe9, 0xe9, 0xec, 0xec, 0xed, 0xec, 0xea, 0xea, 0xea, 0xe9, 0xe8, 0xe8, 0xe7, 0xe6, 0xe4, 0xe8, 0xe4, 0xe4, 0xe2, 0xde, 0xe4, 0xe6, 0xe2, 0xe4, 0xe2, 0xdf, 0xe2, 0xe5, 0xd9, 0xac, 0x7e, 0x7e, 0x81, 0x7e, 0x80, 0x7b, 0x76, 0x81, 0xa5, 0xe5, 0xe8, 0xe2, 0xe2, 0xe2, 0xe4, 0xe0, 0xe2, 0xe4, 0xe2, 0xe1, 0xe7, 0xee, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0xf8, 0xe6, 0xe6, 0xea, 0xea, 0xe7, 0xe2, 0xe1, 0xe4, 0xe1, 0xde, 0xe1, 0xe1, 0xe4, 0xe4, 0xe6, 0xe7, 0xe6, 0xe4, 0xe7, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xde, 0xe0, 0xe9, 0xec, 0xee, 0xf0, 0xf0, 0xf0, 0x4c, 0xf0, 0xee, 0xee, 0xee, 0x4c, 0x4c, 0x01, 0x4c, 0xee, 0xf8, 0xed, 0xe9, 0xea, 0xe9, 0xe9, 0xe9, 0xf8, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0xe9, 0xe0, 0xe6, 0xe9, 0xea, 0xee, 0xef, 0xea, 0xe8, 0xe8, 0xea, 0xed, 0xe4, 0xe4, 0xe2, 0xe4, 0xea, 0xed, 0xef, 0xea, 0xe8, 0xe4, 0xe8, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe2, 0xe1, 0xe2, 0xe2, 0xe5, 0xdc, 0x9d, 0x77, 0x7b, 0x82, 0x85, 0x84, 0x7e, 0x7e, 0x7a, 0x7b, 0xb9, 0xe5, 0xe8, 0xdc, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xec, 0xf0, 0x01, 0xf0, 0x01, 0x4c, 0x4c, 0xf0, 0x01, 0xf0, 0xee, 0xec, 0xe9, 0xea, 0xe9, 0xe8, 0xe9, 0xed, 0xec, 0xed, 0xec, 0xed, 0xec, 0xea, 0xea, 0xea, 0xe8, 0xe8, 0xe6, 0xe7, 0xe2, 0xe2, 0xde, 0xe6, 0xe6, 0xe4, 0xe2, 0xe2, 0xe1, 0xde, 0xdc, 0xed, 0xe5, 0xb9, 0x8a, 0x7b, 0x7a, 0x77, 0x7b, 0x8d, 0xc4, 0xeb, 0xe7, 0xe2, 0xe5, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe1, 0xe1, 0xea, 0x4c, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x4c, 0xec, 0xe6, 0xe8, 0xec, 0xec, 0xea, 0xe8, 0xe6, 0xe7, 0xe6, 0xe4, 0xe6, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe2, 0xe6, 0xe6, 0xe0, 0xe6, 0xe9, 0xec, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xf8, 0xec, 0xec, 0xe9, 0xe9, 0xe9, 0xec, 0xe9, 0xec, 0xef, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xee, 0xe6, 0xe6, 0xe6, 0xe6, 0xe4, 0xea, 0xed, 0xef, 0xef, 0xed, 0xea, 0xed, 0xec, 0xed, 0xef, 0xec, 0xed, 0xec, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xe0, 0xe2, 0xe2, 0xe2, 0xdb, 0xed, 0xd9, 0xb3, 0x84, 0x75, 0x7b, 0x7a, 0x7a, 0x77, 0x8b, 0xd2, 0xeb, 0xe5, 0xd9, 0xdf, 0xe2, 0xdb, 0xe8, 0xde, 0xdf, 0xe2, 0xe2, 0xe1, 0xde, 0xe2, 0xe9, 0xef, 0x01, 0xf0, 0x4c, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0xf8, 0xec, 0xe0, 0xe9, 0xe9, 0xe6, 0xe8, 0xea, 0xed, 0xec, 0xea, 0xea, 0xed, 0xef, 0xed, 0xef, 0xea, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe6, 0xe6, 0xe4, 0xe6, 0xe1, 0xe2, 0xe1, 0xe4, 0xd9, 0xdf, 0xeb, 0xe5, 0xd2, 0xc4, 0xc2, 0xd7, 0xed, 0xeb, 0xea, 0xdc, 0xde, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe4, 0xee, 0xf0, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0xf8, 0xe9, 0xe9, 0xe7, 0xec, 0xed, 0xec, 0xe8, 0xea, 0xed, 0xec, 0xea, 0xea, 0xe8, 0xe9, 0xe4, 0xe4, 0xe6, 0xe4, 0xe4, 0xe7, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe6, 0xe6, 0xe0, 0xe0, 0xe6, 0xe9, 0xea, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xe9, 0xe9, 0xe9, 0xe6, 0xe0, 0xe6, 0xe9, 0xe9, 0xec, 0xec, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0xf0, 0xf0, 0xec, 0xe9, 0xe9, 0xe9, 0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 0xec, 0xed, 0xea, 0xed, 0xec, 0xe8, 0xe8, 0xde, 0xde, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe4, 0xe6, 0xe0, 0xe2, 0xe0, 0xe2, 0xdb, 0xde, 0xe8, 0xed, 0xd9, 0xb3, 0xa0, 0x94, 0xac, 0xca, 0xdf, 0xeb, 0xe2, 0xdc, 0xe4, 0xe7, 0xde, 0xdb, 0xe6, 0xe2, 0xde, 0xe1, 0xe4, 0xdf, 0xde, 0xe4, 0xea, 0xf0, 0x01, 0x4c, 0x4c, 0x01, 0x01, 0x4c, 0xf0, 0x01, 0xf0, 0x4c, 0xec, 0xe6, 0xe6, 0xe8, 0xec, 0xee, 0xed, 0xec, 0xe7, 0xe6, 0xe4, 0xe6, 0xe8, 0xe8, 0xe8, 0xe7, 0xe4, 0xe4, 0xe2, 0xe2, 0xe4, 0xe6, 0xe4, 0xe6, 0xe6, 0xe2, 0xe4, 0xe1, 0xe2, 0xdf, 0xe4, 0xdf, 0xdf, 0xeb, 0xea, 0xeb, 0xea, 0xe8, 0xe7, 0xda, 0xdc, 0xe9, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe8, 0x4c, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0xec, 0xe9, 0xe4, 0xe6, 0xed, 0xee, 0xea, 0xec, 0xed, 0xed, 0xee, 0xed, 0xec, 0xe8, 0xea, 0xea, 0xe8, 0xe8, 0xe7, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe6, 0xe6, 0xe6, 0xe0, 0xe6, 0xe0, 0xe4, 0xe0, 0xe6, 0xe6, 0xe6, 0xe8, 0xe0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe9, 0xe9, 0xe9, 0xee, 0x01, 0xf0, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0xf0, 0xf0, 0x01, 0xee, 0xe6, 0xe6, 0xea, 0xe8, 0xe9, 0xe7, 0xe4, 0xe7, 0xe7, 0xe8, 0xe7, 0xe4, 0xe4, 0xe2, 0xde, 0xde, 0xde, 0xe4, 0xe7, 0xe7, 0xe4, 0xe2, 0xe2, 0xe4, 0xe6, 0xe0, 0xe4, 0xe0, 0xde, 0xe2, 0xea, 0xde, 0xdf, 0xde, 0xe4, 0xeb, 0xe5, 0xe8, 0xe5, 0xe8, 0xeb, 0xda, 0xdf, 0xe2, 0xe2, 0xde, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe1, 0xe2, 0xde, 0xe1, 0xe6, 0xec, 0xf0, 0x01, 0x4c, 0x4c, 0x01, 0x01, 0xf8, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0xe9, 0xe6, 0xe6, 0xea, 0xea, 0xee, 0xed, 0xea, 0xe8, 0xe7, 0xe1, 0xde, 0xde, 0xde, 0xde, 0xe2, 0xde, 0xe1, 0xe4, 0xe7, 0xe8, 0xe2, 0xe6, 0xe1, 0xe6, 0xe4, 0xe4, 0xe1, 0xdf, 0xe7, 0xe1, 0xdb, 0xdc, 0xdf, 0xde, 0xde, 0xe2, 0xe2, 0xe4, 0xe8, 0xde, 0xde, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xec, 0xf0, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xea, 0xea, 0xe6, 0xe6, 0xe9, 0xed, 0xec, 0xec, 0xec, 0xec, 0xea, 0xea, 0xea, 0xed, 0xea, 0xea, 0xe8, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe6, 0xe4, 0xe6, 0xe4, 0xe4, 0xe2, 0xe6, 0xe2, 0xe6, 0xe2, 0xe6, 0xe0, 0xe8, 0xe6, 0xde, 0xe0, 0xe9, 0xe8, 0xe9, 0xe6, 0xe8, 0xec, 0xea, 0xec, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0xef, 0x01, 0xe9, 0xe6, 0xec, 0xea, 0xec, 0xea, 0xe6, 0xe7, 0xe8, 0xe4, 0xe7, 0xe8, 0xe8, 0xe4, 0xe2, 0xdf, 0xe4, 0xe2, 0xe7, 0xe6, 0xe7, 0xe2, 0xe7, 0xe6, 0xe4, 0xe6, 0xe0, 0xe4, 0xe0, 0xe2, 0xe4, 0xde, 0xe4, 0xe2, 0xde, 0xe4, 0xe2, 0xe4, 0xdc, 0xde, 0xde, 0xe2, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xe4, 0xde, 0xe0, 0xdf, 0xe1, 0xe7, 0xde, 0xe8, 0xe1, 0x4c, 0xf0, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xee, 0xf0, 0x4c, 0xee, 0xe9, 0xe4, 0xe9, 0xe9, 0xea, 0xe0, 0xef, 0xed, 0xea, 0xea, 0xe8, 0xe4, 0xe1, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xdc, 0xe1, 0xe4, 0xe7, 0xe1, 0xe2, 0xe0, 0xe9, 0xe0, 0xe4, 0xe6, 0xe4, 0xe2, 0xe2, 0xe4, 0xe2, 0xe2, 0xe8, 0xe4, 0xe8, 0xe9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xd4, 0xd4, 0xd4, 0xd4, 0xda, 0xd4, 0xda, 0xd4, 0xf8, 0xec, 0xf8, 0xec, 0xf8, 0xec, 0xf8, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xf8, 0xec, 0xf8, 0xec, 0xf8, 0xec, 0xf8, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xe9, 0xe9, 0xec, 0xe9, 0xec, 0xe9, 0xe9, 0xe6, 0xe6, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe6, 0xe0, 0xe6, 0xe0, 0xe6, 0xe0, 0xee, 0xec, 0xee, 0xe0, 0xe9, 0xe9, 0xe4, 0xea, 0xe9, 0xe8, 0xe4, 0xe6, 0xe8, 0xe6, 0xe1, 0xe4, 0xe4, 0xe7, 0xe7, 0xe7, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe1, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe4, 0xe4, 0xe6, 0xe4, 0xe4, 0xe4, 0xe6, 0xe6, 0xe6, 0xea, 0xe6, 0xe6, 0xe4, 0xec, 0xe4, 0xe0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x4c, 0xea, 0xe0, 0xec, 0xed, 0xec, 0xe8, 0xe8, 0xe8, 0xe4, 0xe7, 0xe8, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xea, 0xe8, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe4, 0xe4, 0xe4, 0xe2, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe2, 0xde, 0xe2, 0xde, 0xe0, 0xe0, 0xe0, 0xdf, 0xe1, 0xda, 0xe7, 0xd4, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0x01, 0x01, 0xf0, 0xf0, 0xee, 0xec, 0xe0, 0xee, 0xea, 0xe6, 0xe2, 0xe6, 0xe8, 0xea, 0xea, 0xea, 0xe8, 0xe6, 0xe1, 0xe2, 0xe7, 0xe8, 0xea, 0xe7, 0xe7, 0xe4, 0xe6, 0xe6, 0xe4, 0xe6, 0xe1, 0xe6, 0xe1, 0xe4, 0xe1, 0xe1, 0xe1, 0xe2, 0xe4, 0xe6, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xe4, 0xe4, 0xe2, 0xde, 0xe2, 0xe8, 0xe0, 0xea, 0xd4, 0x96, 0xa6, 0x47, 0x47, 0xcb, 0x48, 0xd4, 0xda, 0xde, 0xe0, 0xe6, 0xe9, 0xe9, 0xec, 0xec, 0xec, 0xf8, 0xf8, 0x01, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x5c, 0xf1, 0x5c, 0xf1, 0x5c, 0xf1, 0x5c, 0xf1, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x57, 0x4a, 0x4a, 0x28, 0x53, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x28, 0x89, 0xec, 0xe0, 0xea, 0xe0, 0xe0, 0xe6, 0xe0, 0xe0, 0xe4, 0xe0, 0xe6, 0xe9, 0xe4, 0xe8, 0xe4, 0xe4, 0xe6, 0xe8, 0xe6, 0xe4, 0xe7, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe6, 0xe4, 0xe4, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe4, 0xe9, 0xea, 0xe6, 0xe0, 0xe8, 0xec, 0xe9, 0xe0, 0xec, 0xd4, 0xc1, 0xda, 0xd4, 0xd4, 0xd4, 0xda, 0xda, 0xda, 0xe0, 0xdb, 0xe0, 0xe6, 0xe6, 0xe6, 0xe9, 0xe9, 0xe9, 0xe6, 0xe6, 0xe9, 0xea, 0xec, 0xec, 0xec, 0xec, 0xec, 0xee, 0xec, 0xee, 0xee, 0xee, 0x01, 0xee, 0xf0, 0xf0, 0xe9, 0xe7, 0xe8, 0xed, 0x4c, 0xed, 0xe8, 0xea, 0xe8, 0xe6, 0xe4, 0xea, 0xed, 0xed, 0xec, 0xea, 0xea, 0xea, 0xe8, 0xe4, 0xe4, 0xe8, 0xe4, 0xe6, 0xe2, 0xe4, 0xe0, 0xe2, 0xe0, 0xe2, 0xe0, 0xe2, 0xe0, 0xe4, 0xe0, 0xe2, 0xe0, 0xe2, 0xe0, 0xe2, 0xe2, 0xde, 0xe0, 0xde, 0xe2, 0xde, 0xdf, 0xde, 0xe2, 0xe7, 0xe8, 0xea, 0xea, 0xd4, 0xdb, 0xe6, 0xe9, 0xea, 0xec, 0x4c, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe6, 0xe6, 0xec, 0xe8, 0xf0, 0xe2, 0xe7, 0xe8, 0xe8, 0xea, 0xea, 0xea, 0xe8, 0xe6, 0xea, 0xed, 0xec, 0xea, 0xe2, 0xe6, 0xe4, 0xe7, 0xe2, 0xe1, 0xe4, 0xe1, 0xe4, 0xe1, 0xe6, 0xe2, 0xe6, 0xe1, 0xe4, 0xe0, 0xe4, 0xe0, 0xe4, 0xe4, 0xe4, 0xde, 0xe8, 0xde, 0xe2, 0xe8, 0xe8, 0xe4, 0xe6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x28, 0x53, 0x57, 0x5a, 0x5c, 0x5c, 0x5c, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x65, 0x2e, 0x65, 0x2e, 0x65, 0x2e, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x65, 0xf1, 0x2e, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x01, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xe9, 0xe9, 0xe4, 0xe4, 0xe6, 0xe6, 0xe4, 0xe4, 0xe4, 0xe6, 0xe7, 0xe4, 0xe6, 0xe4, 0xe6, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe8, 0xe0, 0xe2, 0xe9, 0xe6, 0xe4, 0xe0, 0x01, 0xb3, 0x58, 0x00, 0x00, 0x00, 0x4f, 0x4b, 0x4f, 0x28, 0x53, 0x53, 0x54, 0x4a, 0x54, 0x57, 0x57, 0x5a, 0x57, 0x5a, 0x5a, 0x5c, 0x5c, 0x5c, 0x5d, 0xf1, 0x5d, 0xf1, 0x5d, 0xf1, 0xf1, 0xf1, 0xf1, 0x65, 0xf2, 0x73, 0x70, 0xa0, 0xf0, 0xe6, 0xde, 0xe4, 0xe8, 0xea, 0xea, 0xed, 0xea, 0xea, 0xe8, 0xea, 0xea, 0xec, 0xea, 0xe8, 0xe9, 0xe8, 0xe4, 0xe8, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe2, 0xe2, 0xe0, 0xe2, 0xe1, 0xe2, 0xe0, 0xe1, 0xde, 0xe2, 0xde, 0xe2, 0xe0, 0xe1, 0xe4, 0xdb, 0xdb, 0xe6, 0xa0, 0x51, 0x5d, 0x5a, 0x5a, 0xf1, 0xf1, 0xf2, 0xf2, 0x6a, 0x73, 0xfb, 0x7f, 0x89, 0xa6, 0x47, 0xe8, 0x01, 0xe0, 0xea, 0xe9, 0xed, 0xec, 0xea, 0xec, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xed, 0xed, 0xea, 0xe8, 0xe7, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xde, 0xe4, 0xe1, 0xe4, 0xe1, 0xde, 0xea, 0x48, 0x57, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x01, 0x4c, 0xe9, 0xe9, 0xec, 0xf8, 0xea, 0xe9, 0xe0, 0xde, 0xe0, 0xe2, 0xe2, 0xe2, 0xe8, 0xe8, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe0, 0xea, 0xe9, 0xe1, 0xe8, 0xed, 0xda, 0x61, 0x00, 0x54, 0x4f, 0x4f, 0x4e, 0x4e, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4e, 0x4f, 0x4e, 0x4e, 0x4e, 0x4f, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xd4, 0x01, 0xea, 0xde, 0xde, 0xe1, 0xe7, 0xe7, 0xea, 0xea, 0xed, 0xe9, 0xea, 0xed, 0xed, 0xea, 0xe8, 0xe8, 0xe8, 0xe6, 0xe8, 0xe4, 0xe7, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe1, 0xe1, 0xe1, 0xde, 0xe2, 0xe0, 0xde, 0xe4, 0xe0, 0xe2, 0xdf, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xdf, 0xde, 0xe2, 0xe1, 0xec, 0xd4, 0x61, 0x00, 0x4f, 0x4f, 0x4e, 0x4e, 0xf9, 0x4e, 0xf9, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x7d, 0xee, 0xf0, 0xea, 0xe8, 0xe6, 0xe8, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xed, 0xec, 0xed, 0xe9, 0xe7, 0xe4, 0xe4, 0xe7, 0xe2, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe7, 0xe2, 0xe2, 0xe4, 0xe1, 0xe4, 0xec, 0x79, 0x00, 0x49, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x96, 0xec, 0xee, 0xe6, 0xe6, 0xe4, 0xe9, 0xe9, 0xe9, 0xed, 0xec, 0xea, 0xe9, 0xe8, 0xe6, 0xe4, 0xe4, 0xe4, 0xe6, 0xe2, 0xe6, 0xe2, 0xe2, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe6, 0xe8, 0xe4, 0xe2, 0xea, 0xee, 0xda, 0x70, 0x4e, 0x56, 0x4e, 0x56, 0x4f, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4f, 0x51, 0x4f, 0x4f, 0x4f, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4f, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4b, 0x54, 0x53, 0x51, 0x4e, 0x7f, 0xe4, 0xee, 0xed, 0xe4, 0xe4, 0xe7, 0xe1, 0xe4, 0xea, 0xea, 0xea, 0xea, 0xec, 0xed, 0xec, 0xe8, 0xe9, 0xe8, 0xe8, 0xe4, 0xe4, 0xe2, 0xe7, 0xe1, 0xe2, 0xe1, 0xe2, 0xe1, 0xe1, 0xde, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xde, 0xe4, 0xdf, 0x75, 0x51, 0x54, 0x53, 0x53, 0x53, 0x54, 0x51, 0x53, 0x28, 0x51, 0x28, 0x53, 0x53, 0x4f, 0x4f, 0x4e, 0x4e, 0xa6, 0xec, 0xec, 0xea, 0xea, 0xe8, 0xe8, 0xe7, 0xe4, 0xe4, 0xe2, 0xe2, 0xde, 0xe4, 0xe9, 0xed, 0xec, 0xe8, 0xe4, 0xe4, 0xe7, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xe4, 0xe2, 0xe4, 0xe1, 0xe4, 0xe1, 0xe4, 0xe1, 0xe6, 0xdb, 0xe6, 0xe4, 0xec, 0xea, 0x47, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x7d, 0xe6, 0x4c, 0xe9, 0xe0, 0xe0, 0xe4, 0xea, 0xef, 0xec, 0xed, 0xe8, 0xe9, 0xe7, 0xe8, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe1, 0xe6, 0xea, 0xdb, 0xed, 0xf0, 0xcb, 0x73, 0x65, 0x68, 0x6a, 0x6a, 0x65, 0x6a, 0xf2, 0x68, 0xf2, 0x68, 0xf2, 0x65, 0xf2, 0x65, 0xf2, 0x64, 0xf2, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0xf2, 0x65, 0xf2, 0xf2, 0x61, 0x6a, 0x6a, 0x65, 0xa6, 0xea, 0xf0, 0xea, 0xe8, 0xea, 0xde, 0xe4, 0xe2, 0xe4, 0xe8, 0xe8, 0xe8, 0xe4, 0xe4, 0xe4, 0xe4, 0xe8, 0xe8, 0xe4, 0xe4, 0xe7, 0xe2, 0xe2, 0xe2, 0xe1, 0xde, 0xe1, 0xde, 0xe2, 0xe1, 0xde, 0xe1, 0xe1, 0xde, 0xe2, 0xde, 0xe2, 0xe1, 0xe2, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xed, 0x83, 0x61, 0x6a, 0x64, 0x65, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0xf1, 0x61, 0x2e, 0x62, 0x65, 0x5d, 0x65, 0xcb, 0xef, 0xea, 0xe4, 0xed, 0xe8, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe7, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xe4, 0xe1, 0xe2, 0xe2, 0xe4, 0xe1, 0xe4, 0xe4, 0xe1, 0xea, 0xde, 0xec, 0xd4, 0x51, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0xf2, 0xcb, 0xee, 0xe9, 0xde, 0xe6, 0xec, 0xe0, 0xe4, 0xe0, 0xe4, 0xe6, 0xe8, 0xe9, 0xe6, 0xe4, 0xe6, 0xe2, 0xe0, 0xe4, 0xe4, 0xe4, 0xe6, 0xe8, 0xe4, 0xe2, 0xe2, 0xe6, 0xe8, 0xe2, 0xde, 0xe2, 0xe8, 0xe8, 0xe6, 0xe5, 0xea, 0xed, 0xeb, 0xb3, 0x70, 0x66, 0x6e, 0x6e, 0x6e, 0x6e, 0x70, 0x6e, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x70, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x6f, 0x70, 0x70, 0x6f, 0xf2, 0xa0, 0x01, 0xef, 0xe9, 0xef, 0xe9, 0xe6, 0xe4, 0xe6, 0xe8, 0xe6, 0xe4, 0xe4, 0xe4, 0xde, 0xde, 0xe4, 0xe8, 0xe4, 0xe7, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe0, 0xe2, 0xe0, 0xe4, 0xe2, 0xe4, 0xe2, 0xe0, 0xe4, 0xde, 0xe4, 0xe4, 0xde, 0xe2, 0xe8, 0xde, 0xef, 0x8d, 0x64, 0x6b, 0x72, 0x6b, 0x6f, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x72, 0x70, 0x72, 0x70, 0x70, 0x77, 0x5b, 0x7d, 0xd7, 0xed, 0xe8, 0xed, 0xe8, 0xea, 0xe9, 0xe8, 0xe2, 0xe6, 0xe2, 0xe0, 0xe4, 0xe6, 0xe7, 0xe6, 0xe2, 0xe6, 0xe7, 0xe4, 0xe2, 0xe4, 0xe4, 0xe6, 0xe4, 0xe2, 0xe2, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe6, 0xde, 0xdb, 0xe6, 0xe6, 0xe0, 0xe9, 0x4c, 0xbd, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x53, 0x96, 0xf0, 0xec, 0xe4, 0xe6, 0xe0, 0xe0, 0xe6, 0xe9, 0xe9, 0xe9, 0xe4, 0xe4, 0xe4, 0xe6, 0xe4, 0xe9, 0xe4, 0xe6, 0xe2, 0xe2, 0xe4, 0xe4, 0xe2, 0xe6, 0xe8, 0xe2, 0xe6, 0xe8, 0xe6, 0xe4, 0xde, 0xe4, 0xeb, 0xe7, 0xd9, 0x81, 0x5b, 0x66, 0x6e, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x6e, 0x6a, 0x96, 0xed, 0x01, 0xe9, 0xec, 0xec, 0xe7, 0xe0, 0xe4, 0xe7, 0xe4, 0xe2, 0xe9, 0xe7, 0xe6, 0xe8, 0xe9, 0xea, 0xe8, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe2, 0xe0, 0xe2, 0xe2, 0xe2, 0xe0, 0xe2, 0xde, 0xde, 0xde, 0xde, 0xef, 0x8f, 0x6f, 0x62, 0x6e, 0x6f, 0x6b, 0x72, 0x6e, 0x6c, 0x6e, 0x6c, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x72, 0x66, 0x8a, 0xea, 0xeb, 0xe2, 0xe8, 0xe6, 0xe7, 0xe6, 0xe6, 0xe2, 0xe6, 0xe7, 0xe9, 0xe8, 0xe6, 0xe4, 0xe6, 0xea, 0xe8, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe0, 0xe2, 0xe2, 0xe2, 0xde, 0xe6, 0xe9, 0xdb, 0xe6, 0xee, 0xde, 0xe9, 0xe6, 0xec, 0xac, 0x5a, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x4e, 0x4d, 0x51, 0x54, 0x54, 0x53, 0x61, 0x8f, 0xda, 0xea, 0xea, 0xea, 0xe2, 0xe0, 0xe2, 0xe4, 0xe4, 0xe9, 0xe9, 0xe9, 0xe8, 0xe9, 0xe4, 0xe4, 0xde, 0xe4, 0xe8, 0xe8, 0xe4, 0xe4, 0xe4, 0xe8, 0xe4, 0xe4, 0xe4, 0xe4, 0xea, 0xed, 0xed, 0xd7, 0x9d, 0x72, 0x62, 0x6f, 0x72, 0x6f, 0x6e, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x6a, 0x6e, 0x96, 0xde, 0x01, 0xed, 0xea, 0xee, 0xed, 0xea, 0xe6, 0xe9, 0xe8, 0xec, 0xec, 0xea, 0xe9, 0xe8, 0xe9, 0xe8, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe0, 0xe2, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe2, 0xe2, 0xe8, 0xe0, 0xdb, 0xed, 0xe2, 0xa6, 0x6e, 0x6b, 0x6e, 0x6f, 0x6e, 0x6b, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x72, 0x6f, 0x68, 0x8a, 0xdc, 0xf0, 0xe8, 0xe9, 0xe8, 0xec, 0xea, 0xea, 0xe4, 0xe0, 0xe2, 0xe4, 0xe6, 0xe8, 0xec, 0xea, 0xea, 0xe8, 0xe8, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe4, 0xe0, 0xe8, 0xe0, 0xde, 0xe0, 0xe6, 0xe9, 0x8f, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x4f, 0x51, 0x54, 0x56, 0xf1, 0x64, 0x65, 0x68, 0x6a, 0x72, 0x73, 0x72, 0x6e, 0x75, 0x96, 0xcb, 0xe4, 0xef, 0xed, 0xec, 0xea, 0xe6, 0xe8, 0xe8, 0xe4, 0xe6, 0xe2, 0xe6, 0xe1, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xea, 0xde, 0xe4, 0xef, 0xef, 0xc1, 0x8f, 0x77, 0x64, 0x68, 0x72, 0x6f, 0x6b, 0x6e, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6c, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x72, 0x6e, 0x6a, 0x83, 0xcb, 0xef, 0xec, 0xea, 0xe7, 0xe9, 0xed, 0xea, 0xe7, 0xec, 0xed, 0xea, 0xe7, 0xe4, 0xe7, 0xe7, 0xe6, 0xe4, 0xe4, 0xe0, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xe0, 0xe2, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xdb, 0xda, 0xea, 0xe4, 0xa6, 0x6a, 0x68, 0x6f, 0x6f, 0x6e, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x75, 0x71, 0x6e, 0x6b, 0x7e, 0xc2, 0xed, 0xe7, 0xe4, 0xe7, 0xec, 0xea, 0xed, 0xee, 0xea, 0xe8, 0xea, 0xec, 0xea, 0xe8, 0xe8, 0xe4, 0xe8, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xde, 0xea, 0xe4, 0xe2, 0xe7, 0xed, 0xcb, 0x79, 0x5d, 0x5d, 0x5f, 0x58, 0x5d, 0x51, 0x53, 0x51, 0x4e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4f, 0x5a, 0x58, 0x61, 0x65, 0x6e, 0x70, 0x72, 0x72, 0x72, 0x75, 0x77, 0x70, 0x6f, 0x73, 0x68, 0x6e, 0x72, 0x6b, 0x6e, 0x82, 0xa6, 0xbd, 0xe1, 0xef, 0x4c, 0xed, 0xea, 0xea, 0xe8, 0xe8, 0xe7, 0xe7, 0xe4, 0xe4, 0xe4, 0xe8, 0xea, 0xea, 0xea, 0xea, 0xe8, 0xef, 0xe7, 0x47, 0x83, 0x73, 0x6e, 0x6b, 0x72, 0x6f, 0x6b, 0x6e, 0x75, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6c, 0x6f, 0x6f, 0x6f, 0x72, 0x6b, 0x6e, 0x73, 0x68, 0x75, 0xa6, 0xea, 0xf0, 0xf0, 0xea, 0xe7, 0xe8, 0xe8, 0xe4, 0xe7, 0xe7, 0xe4, 0xe4, 0xe8, 0xe8, 0xe4, 0xe4, 0xe0, 0xe4, 0xe2, 0xe6, 0xe4, 0xe2, 0xe6, 0xe2, 0xe0, 0xe0, 0xe2, 0xe2, 0xe2, 0xde, 0xe2, 0xde, 0xe2, 0xde, 0xe4, 0xef, 0xde, 0x8f, 0x6e, 0x6a, 0x6e, 0x6e, 0x6b, 0x6f, 0x6f, 0x72, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x68, 0x75, 0x6f, 0x62, 0x75, 0x8f, 0xc1, 0xed, 0xf0, 0xe8, 0xea, 0xed, 0xe8, 0xe4, 0xe6, 0xed, 0xea, 0xe7, 0xe4, 0xe4, 0xe8, 0xe7, 0xe6, 0xe7, 0xe6, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe7, 0xda, 0xe4, 0xf0, 0xdb, 0x89, 0x6a, 0x65, 0x6a, 0x6a, 0x70, 0x73, 0x68, 0x6e, 0x6a, 0x68, 0x65, 0x5f, 0x5f, 0x5d, 0x54, 0x51, 0x4e, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x4f, 0x5a, 0x65, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x76, 0x72, 0x6f, 0x68, 0x6b, 0x72, 0x6f, 0x72, 0x6f, 0x75, 0x76, 0x6e, 0x6f, 0x72, 0x6b, 0x6e, 0x6f, 0x72, 0x79, 0x8f, 0xbd, 0xd7, 0xe1, 0xe7, 0xeb, 0xed, 0xea, 0xeb, 0xed, 0xed, 0xea, 0xea, 0xe2, 0xda, 0xd7, 0x96, 0x7e, 0x70, 0x66, 0x6a, 0x68, 0x6a, 0x6f, 0x68, 0x6f, 0x72, 0x6f, 0x6b, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6c, 0x6f, 0x6f, 0x71, 0x6c, 0x6f, 0x6c, 0x72, 0x6f, 0x6f, 0x72, 0x6f, 0x68, 0x62, 0x75, 0xa6, 0xdf, 0xe8, 0xea, 0xed, 0xed, 0xe8, 0xe4, 0xe4, 0xe7, 0xe7, 0xe8, 0xe7, 0xe6, 0xe6, 0xe4, 0xe0, 0xe4, 0xe4, 0xe0, 0xe4, 0xe0, 0xe4, 0xe0, 0xe2, 0xe0, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xea, 0xd9, 0x83, 0x68, 0xf2, 0x72, 0x72, 0x6f, 0x6f, 0x72, 0x72, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x75, 0x68, 0x71, 0x6e, 0x6e, 0x76, 0x6a, 0x68, 0x68, 0x79, 0xa0, 0xdb, 0xed, 0xed, 0xed, 0xef, 0xed, 0xec, 0xe7, 0xe4, 0xe8, 0xea, 0xe8, 0xea, 0xe8, 0xe8, 0xe7, 0xe4, 0xe7, 0xe7, 0xe7, 0xe7, 0xe8, 0xe4, 0xe7, 0xee, 0xea, 0xa6, 0x75, 0x6e, 0x62, 0x75, 0x6e, 0x6b, 0x70, 0x68, 0x72, 0x6e, 0x6e, 0x6e, 0x70, 0x70, 0x70, 0x72, 0x70, 0x6a, 0x68, 0xf1, 0x59, 0x53, 0x4e, 0x49, 0x00, 0x00, 0x00, 0x49, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x57, 0x6e, 0xfb, 0x75, 0x6e, 0x73, 0x72, 0x72, 0x6f, 0x6f, 0x6c, 0x6f, 0x72, 0x75, 0x6f, 0x71, 0x6f, 0x6f, 0x72, 0x6b, 0x6e, 0x71, 0x6f, 0x6f, 0x72, 0x6e, 0x70, 0x6f, 0x6b, 0x66, 0x64, 0x66, 0x68, 0x75, 0x79, 0x83, 0x87, 0x87, 0x8a, 0x83, 0x81, 0x79, 0x73, 0x68, 0x5f, 0x65, 0x68, 0x6a, 0x6e, 0x6e, 0x70, 0x72, 0x6f, 0x72, 0x6f, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6c, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x68, 0x6f, 0x71, 0x6e, 0x6f, 0x75, 0x6f, 0x6a, 0x6a, 0x6a, 0x79, 0xa0, 0xcb, 0xdf, 0xea, 0xea, 0xe8, 0xed, 0xe8, 0xe7, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xe0, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe0, 0xe0, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe7, 0xe2, 0xde, 0xac, 0x75, 0x61, 0x6e, 0x72, 0x6e, 0x6b, 0x6e, 0x6f, 0x6f, 0x6b, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x75, 0x6e, 0x72, 0x72, 0x68, 0x72, 0x70, 0x6e, 0x6a, 0x62, 0x6a, 0x79, 0x8a, 0xa6, 0xb3, 0xca, 0xd4, 0xdb, 0xe7, 0xe8, 0xe7, 0xea, 0xe8, 0xea, 0xe8, 0xe7, 0xe8, 0xe8, 0xe8, 0xe2, 0xe2, 0xdc, 0xda, 0xc2, 0xa0, 0x75, 0x64, 0x68, 0x6a, 0x72, 0x68, 0x6f, 0x72, 0x6b, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x72, 0x70, 0x72, 0x70, 0x75, 0x75, 0x73, 0x70, 0x5c, 0x28, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x61, 0x73, 0x73, 0x70, 0x73, 0x72, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x72, 0x71, 0x72, 0x71, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6e, 0x6b, 0x68, 0x68, 0x66, 0x64, 0x64, 0x62, 0x65, 0x68, 0x6e, 0x6e, 0x70, 0x6f, 0x6e, 0x70, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x6f, 0x6c, 0x71, 0x6c, 0x6f, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x70, 0x68, 0x68, 0x72, 0x7d, 0x8f, 0xac, 0xc2, 0xd7, 0xdb, 0xe7, 0xea, 0xea, 0xea, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe6, 0xe4, 0xe7, 0xe4, 0xe7, 0xe7, 0xe8, 0xe8, 0xe5, 0xcb, 0xac, 0x7b, 0x6a, 0x66, 0x6b, 0x70, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x6f, 0x6e, 0x6f, 0x6e, 0x6a, 0x68, 0x68, 0x68, 0x6a, 0x72, 0x77, 0x7d, 0x81, 0x89, 0x8d, 0x96, 0xa0, 0xa0, 0xa0, 0xa0, 0x94, 0x94, 0x89, 0x7b, 0x79, 0x72, 0x68, 0x64, 0x68, 0x6e, 0x72, 0x6f, 0x6e, 0x6e, 0x6f, 0x6e, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x70, 0x6f, 0x6e, 0x6e, 0x70, 0x72, 0x73, 0x70, 0x4a, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4a, 0x65, 0x6a, 0x70, 0x73, 0x73, 0x72, 0x72, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x72, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x70, 0x6f, 0x6f, 0x6f, 0x70, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x70, 0x6f, 0x6b, 0x6b, 0x68, 0x6b, 0x72, 0x75, 0x7d, 0x84, 0x8f, 0xa0, 0xac, 0xbd, 0xbd, 0xcb, 0xcb, 0xd2, 0xd4, 0xd7, 0xd7, 0xda, 0xd7, 0xd4, 0xca, 0xc2, 0xa0, 0x8a, 0x77, 0x6a, 0x6b, 0x6e, 0x6b, 0x72, 0x6f, 0x6f, 0x72, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x6e, 0x6b, 0x6b, 0x68, 0x68, 0x67, 0x6a, 0x68, 0x6b, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x68, 0x6e, 0x70, 0x6b, 0x6e, 0x70, 0x72, 0x72, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x70, 0x72, 0x70, 0x70, 0x72, 0x70, 0x70, 0xf1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x51, 0x53, 0x57, 0xf1, 0x6a, 0x6a, 0x6a, 0x70, 0x72, 0x73, 0x75, 0x73, 0x72, 0x73, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x72, 0x70, 0x6f, 0x72, 0x6f, 0x71, 0x6f, 0x72, 0x71, 0x72, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x6f, 0x72, 0x72, 0x72, 0x6f, 0x6f, 0x6b, 0x6b, 0x68, 0x6b, 0x6b, 0x6b, 0x6a, 0x6e, 0x70, 0x72, 0x70, 0x72, 0x73, 0x77, 0xfb, 0x79, 0x79, 0x77, 0x77, 0x72, 0x72, 0x6f, 0x68, 0x6b, 0x6e, 0x6b, 0x6b, 0x72, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6f, 0x6f, 0x72, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x72, 0x72, 0x72, 0x70, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6b, 0x6e, 0x6e, 0x70, 0x72, 0x73, 0x72, 0x73, 0x72, 0x70, 0x72, 0x70, 0xf2, 0x5d, 0x53, 0x4e, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x4f, 0x51, 0x57, 0x5a, 0x5a, 0x61, 0x65, 0x68, 0x6a, 0x70, 0x73, 0x73, 0x75, 0x73, 0x75, 0x73, 0x73, 0x72, 0x73, 0x72, 0x72, 0x72, 0x6f, 0x6e, 0x6b, 0x6b, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6f, 0x6e, 0x6b, 0x6e, 0x6f, 0x6f, 0x6e, 0x6f, 0x72, 0x6b, 0x68, 0x68, 0x6b, 0x68, 0x6a, 0x6b, 0x6f, 0x6e, 0x6b, 0x6b, 0x6e, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x6e, 0x6f, 0x6b, 0x6b, 0x68, 0x72, 0x6f, 0x6e, 0x6f, 0x6b, 0x6f, 0x6b, 0x6e, 0x6b, 0x6e, 0x6e, 0x6f, 0x6f, 0x6e, 0x70, 0x70, 0x72, 0x70, 0x70, 0x72, 0x70, 0x70, 0x70, 0x72, 0x73, 0x73, 0x73, 0x73, 0x72, 0x70, 0x6a, 0x65, 0x61, 0x5f, 0x5a, 0x53, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4b, 0x51, 0x53, 0x57, 0x57, 0x5c, 0x5d, 0xf1, 0x62, 0xf2, 0x6a, 0x6e, 0x6b, 0x6e, 0x6c, 0x70, 0x72, 0x72, 0x75, 0x71, 0x72, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6f, 0x72, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x6c, 0x72, 0x71, 0x6f, 0x6f, 0x6c, 0x6f, 0x6f, 0x6b, 0x6b, 0x6f, 0x72, 0x6f, 0x6b, 0x6f, 0x6f, 0x6e, 0x6b, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x72, 0x76, 0x6e, 0x6e, 0x6e, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x72, 0x75, 0x72, 0x72, 0x73, 0x72, 0x72, 0x70, 0x6e, 0x6e, 0x6e, 0x6e, 0x6a, 0x65, 0x64, 0x5f, 0x5f, 0x57, 0x57, 0x54, 0x51, 0x4f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x49, 0x00, 0x00, 0x49, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4f, 0x4f, 0x51, 0x53, 0x54, 0x58, 0x59, 0x5f, 0x5f, 0x61, 0x65, 0x68, 0x68, 0x6a, 0x6b, 0x6e, 0x6e, 0x6f, 0x6e, 0x6f, 0x72, 0x6f, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6c, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6b, 0x6b, 0x72, 0x6b, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x71, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x71, 0x72, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6e, 0x71, 0x6f, 0x71, 0x6f, 0x6f, 0x6e, 0x6f, 0x6b, 0x6e, 0x68, 0x67, 0x62, 0x66, 0x62, 0x64, 0x61, 0x5d, 0x5d, 0x5a, 0x58, 0x53, 0x51, 0x50, 0x4e, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4b, 0x49, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0xf9, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x4d, 0x4b, 0x4f, 0x51, 0x54, 0x54, 0x58, 0x58, 0x59, 0x5d, 0x5f, 0x61, 0x62, 0x65, 0x68, 0x6a, 0x6a, 0x6e, 0x70, 0x70, 0x70, 0x72, 0x70, 0x72, 0x73, 0x75, 0x72, 0x73, 0x72, 0x72, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x70, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x6e, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x6e, 0x6f, 0x6e, 0x6b, 0x6b, 0x6e, 0x6e, 0x6e, 0x6b, 0x6b, 0x6e, 0x6e, 0x6f, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x70, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x70, 0x6f, 0x70, 0x70, 0x6f, 0x70, 0x72, 0x72, 0x70, 0x72, 0x72, 0x72, 0x72, 0x73, 0x75, 0x72, 0x73, 0x72, 0x73, 0x72, 0x73, 0x73, 0x72, 0x70, 0x70, 0x6e, 0x6b, 0x6a, 0x68, 0x68, 0x65, 0x62, 0x61, 0x5f, 0x5f, 0x5c, 0x59, 0x57, 0x54, 0x53, 0x53, 0x50, 0x51, 0x4f, 0x4f, 0x4d, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x49, 0x4e, 0x49, 0x4b, 0x28, 0x28, 0x4a, 0x54, 0x5a, 0x59, 0x5d, 0x5d, 0x5f, 0x5f, 0x65, 0x68, 0xf2, 0x6a, 0x6a, 0x6e, 0x6e, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73, 0x72, 0x70, 0x73, 0x72, 0x73, 0x73, 0x73, 0x72, 0x73, 0x72, 0x73, 0x72, 0x73, 0x73, 0x70, 0x70, 0x72, 0x70, 0x72, 0x73, 0x72, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x70, 0x72, 0x70, 0x72, 0x70, 0x72, 0x73, 0x72, 0x70, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x72, 0x73, 0x70, 0x73, 0x70, 0x73, 0x72, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6a, 0x6e, 0x6a, 0x6a, 0x6a, 0x6a, 0x65, 0x62, 0x65, 0x62, 0x61, 0x61, 0x5f, 0x5d, 0x5c, 0x58, 0x57, 0x54, 0x53, 0x53, 0x4f, 0x51, 0x4e, 0x4e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x4e, 0x4f, 0x4f, 0x51, 0x51, 0x51, 0x53, 0x54, 0x54, 0x57, 0x58, 0x57, 0x58, 0x5a, 0x5a, 0x5d, 0x5d, 0x5f, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x68, 0xf2, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x70, 0x70, 0x6e, 0x6e, 0x6a, 0x6e, 0x6a, 0x6e, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5f, 0x61, 0x5f, 0x61, 0x5f, 0x5d, 0x5d, 0x5c, 0x5a, 0x58, 0x57, 0x58, 0x57, 0x57, 0x54, 0x54, 0x51, 0x51, 0x51, 0x4f, 0x4f, 0x4f, 0x4e, 0x4e, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x00, 0x4d, 0x00, 0x4e, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_img_dsc_t image18 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image18_map,
-};
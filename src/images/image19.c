@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE19
-#define LV_ATTRIBUTE_IMG_IMAGE19
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE19 uint8_t image19_map[] = {
-  0xfc, 0xfc, 0xfc, 0xff, 	/*Color of index 0*/
-  0x02, 0x02, 0x02, 0xff, 	/*Color of index 1*/
-  0xe9, 0xec, 0xf7, 0xff, 	/*Color of index 2*/
-  0xc7, 0xc8, 0xd1, 0xff, 	/*Color of index 3*/
-  0xa7, 0xb1, 0xe3, 0xff, 	/*Color of index 4*/
-  0xb3, 0xb4, 0xc9, 0xff, 	/*Color of index 5*/
-  0xab, 0xa9, 0xc9, 0xff, 	/*Color of index 6*/
-  0x9d, 0x9d, 0xcb, 0xff, 	/*Color of index 7*/
-  0x8d, 0x97, 0xc4, 0xff, 	/*Color of index 8*/
-  0xa0, 0x99, 0xb4, 0xff, 	/*Color of index 9*/
-  0x96, 0x93, 0xaa, 0xff, 	/*Color of index 10*/
-  0x8f, 0x8c, 0xbe, 0xff, 	/*Color of index 11*/
-  0x6f, 0x86, 0xd9, 0xff, 	/*Color of index 12*/
-  0x90, 0x8b, 0xa9, 0xff, 	/*Color of index 13*/
-  0x82, 0x83, 0xbf, 0xff, 	/*Color of index 14*/
-  0x83, 0x84, 0xaf, 0xff, 	/*Color of index 15*/
-  0x58, 0x7a, 0xd9, 0xff, 	/*Color of index 16*/
-  0x6b, 0x78, 0xc7, 0xff, 	/*Color of index 17*/
-  0x79, 0x77, 0xb5, 0xff, 	/*Color of index 18*/
-  0x70, 0x7b, 0xa4, 0xff, 	/*Color of index 19*/
-  0x5b, 0x75, 0xb3, 0xff, 	/*Color of index 20*/
-  0x3d, 0x64, 0xf3, 0xff, 	/*Color of index 21*/
-  0x52, 0x70, 0xc2, 0xff, 	/*Color of index 22*/
-  0x4a, 0x69, 0xdc, 0xff, 	/*Color of index 23*/
-  0x4e, 0x6a, 0xce, 0xff, 	/*Color of index 24*/
-  0x2c, 0x63, 0xe4, 0xff, 	/*Color of index 25*/
-  0x33, 0x5f, 0xec, 0xff, 	/*Color of index 26*/
-  0x3e, 0x62, 0xdc, 0xff, 	/*Color of index 27*/
-  0x5f, 0x71, 0x9c, 0xff, 	/*Color of index 28*/
-  0x6a, 0x68, 0xae, 0xff, 	/*Color of index 29*/
-  0x2a, 0x5c, 0xec, 0xff, 	/*Color of index 30*/
-  0x2b, 0x5b, 0xe2, 0xff, 	/*Color of index 31*/
-  0x42, 0x5d, 0xcd, 0xff, 	/*Color of index 32*/
-  0x55, 0x5e, 0xbe, 0xff, 	/*Color of index 33*/
-  0x47, 0x53, 0xe6, 0xff, 	/*Color of index 34*/
-  0x24, 0x54, 0xec, 0xff, 	/*Color of index 35*/
-  0x43, 0x62, 0xb1, 0xff, 	/*Color of index 36*/
-  0x5c, 0x5d, 0xb0, 0xff, 	/*Color of index 37*/
-  0x31, 0x53, 0xd9, 0xff, 	/*Color of index 38*/
-  0x5c, 0x5d, 0x9b, 0xff, 	/*Color of index 39*/
-  0x32, 0x4b, 0xe4, 0xff, 	/*Color of index 40*/
-  0x3b, 0x4b, 0xd8, 0xff, 	/*Color of index 41*/
-  0x5d, 0x5e, 0x85, 0xff, 	/*Color of index 42*/
-  0x44, 0x4e, 0xc3, 0xff, 	/*Color of index 43*/
-  0x4a, 0x53, 0xaf, 0xff, 	/*Color of index 44*/
-  0x28, 0x43, 0xe6, 0xff, 	/*Color of index 45*/
-  0x4d, 0x51, 0x9f, 0xff, 	/*Color of index 46*/
-  0x26, 0x42, 0xd8, 0xff, 	/*Color of index 47*/
-  0x5f, 0x5e, 0x65, 0xff, 	/*Color of index 48*/
-  0x37, 0x44, 0xbf, 0xff, 	/*Color of index 49*/
-  0x45, 0x46, 0xaf, 0xff, 	/*Color of index 50*/
-  0x29, 0x41, 0xc9, 0xff, 	/*Color of index 51*/
-  0x2b, 0x39, 0xdc, 0xff, 	/*Color of index 52*/
-  0x24, 0x3b, 0xd1, 0xff, 	/*Color of index 53*/
-  0x37, 0x43, 0xac, 0xff, 	/*Color of index 54*/
-  0x45, 0x46, 0x9d, 0xff, 	/*Color of index 55*/
-  0x34, 0x39, 0xcd, 0xff, 	/*Color of index 56*/
-  0x21, 0x36, 0xdc, 0xff, 	/*Color of index 57*/
-  0x35, 0x46, 0x9e, 0xff, 	/*Color of index 58*/
-  0x30, 0x3b, 0xbf, 0xff, 	/*Color of index 59*/
-  0x2a, 0x36, 0xd1, 0xff, 	/*Color of index 60*/
-  0x41, 0x49, 0x84, 0xff, 	/*Color of index 61*/
-  0x1b, 0x35, 0xd0, 0xff, 	/*Color of index 62*/
-  0x25, 0x31, 0xd1, 0xff, 	/*Color of index 63*/
-  0x36, 0x39, 0xb0, 0xff, 	/*Color of index 64*/
-  0x20, 0x32, 0xc4, 0xff, 	/*Color of index 65*/
-  0x38, 0x38, 0x9e, 0xff, 	/*Color of index 66*/
-  0x2a, 0x29, 0xd4, 0xff, 	/*Color of index 67*/
-  0x23, 0x2c, 0xcc, 0xff, 	/*Color of index 68*/
-  0x30, 0x2f, 0xbd, 0xff, 	/*Color of index 69*/
-  0x23, 0x2a, 0xd2, 0xff, 	/*Color of index 70*/
-  0x2c, 0x30, 0xb0, 0xff, 	/*Color of index 71*/
-  0x29, 0x3d, 0x85, 0xff, 	/*Color of index 72*/
-  0x1f, 0x34, 0x9a, 0xff, 	/*Color of index 73*/
-  0x45, 0x43, 0x4d, 0xff, 	/*Color of index 74*/
-  0x1e, 0x2b, 0x76, 0xff, 	/*Color of index 75*/
-  0x26, 0x32, 0x51, 0xff, 	/*Color of index 76*/
-  0x14, 0x1e, 0x81, 0xff, 	/*Color of index 77*/
-  0x17, 0x22, 0x57, 0xff, 	/*Color of index 78*/
-  0x0e, 0x18, 0x66, 0xff, 	/*Color of index 79*/
-  0x0e, 0x14, 0x48, 0xff, 	/*Color of index 80*/
-  0x05, 0x09, 0x51, 0xff, 	/*Color of index 81*/
-  0x05, 0x0c, 0x3c, 0xff, 	/*Color of index 82*/
-  0x01, 0x04, 0x2e, 0xff, 	/*Color of index 83*/
-  0x00, 0x01, 0x1d, 0xff, 	/*Color of index 84*/
-  0x00, 0x00, 0x12, 0xff, 	/*Color of index 85*/
-  0x01, 0x00, 0x08, 0xff, 	/*Color of index 86*/
-  0xf5, 0xf9, 0xfb, 0xff, 	/*Color of index 87*/
-  0xed, 0xf6, 0xfb, 0xff, 	/*Color of index 88*/
-  0xdf, 0xf4, 0xfe, 0xff, 	/*Color of index 89*/
-  0xd5, 0xe6, 0xfb, 0xff, 	/*Color of index 90*/
-  0xc8, 0xdf, 0xfc, 0xff, 	/*Color of index 91*/
-  0xc2, 0xd4, 0xf3, 0xff, 	/*Color of index 92*/
-  0xb4, 0xcb, 0xf2, 0xff, 	/*Color of index 93*/
-  0x6f, 0xce, 0xf4, 0xff, 	/*Color of index 94*/
-  0xa3, 0xc2, 0xef, 0xff, 	/*Color of index 95*/
-  0x61, 0xc1, 0xed, 0xff, 	/*Color of index 96*/
-  0x46, 0xc0, 0xf2, 0xff, 	/*Color of index 97*/
-  0x41, 0xb6, 0xf9, 0xff, 	/*Color of index 98*/
-  0x31, 0xb6, 0xf7, 0xff, 	/*Color of index 99*/
-  0x90, 0xaf, 0xe8, 0xff, 	/*Color of index 100*/
-  0x87, 0xa5, 0xe1, 0xff, 	/*Color of index 101*/
-  0x32, 0x9f, 0xf5, 0xff, 	/*Color of index 102*/
-  0x57, 0xa3, 0xcb, 0xff, 	/*Color of index 103*/
-  0x73, 0x99, 0xe0, 0xff, 	/*Color of index 104*/
-  0x59, 0x95, 0xe8, 0xff, 	/*Color of index 105*/
-  0x6e, 0x96, 0xce, 0xff, 	/*Color of index 106*/
-  0x45, 0x87, 0xf1, 0xff, 	/*Color of index 107*/
-  0x2a, 0x82, 0xf4, 0xff, 	/*Color of index 108*/
-  0x2b, 0x83, 0xea, 0xff, 	/*Color of index 109*/
-  0x46, 0x84, 0xdd, 0xff, 	/*Color of index 110*/
-  0x39, 0x7d, 0xf3, 0xff, 	/*Color of index 111*/
-  0x22, 0x7e, 0xf4, 0xff, 	/*Color of index 112*/
-  0x44, 0x7a, 0xf3, 0xff, 	/*Color of index 113*/
-  0x5b, 0x84, 0xc8, 0xff, 	/*Color of index 114*/
-  0x33, 0x79, 0xf4, 0xff, 	/*Color of index 115*/
-  0x1c, 0x7d, 0xe3, 0xff, 	/*Color of index 116*/
-  0x2a, 0x76, 0xf4, 0xff, 	/*Color of index 117*/
-  0x27, 0x79, 0xea, 0xff, 	/*Color of index 118*/
-  0x2d, 0x78, 0xe1, 0xff, 	/*Color of index 119*/
-  0x2b, 0x75, 0xeb, 0xff, 	/*Color of index 120*/
-  0x44, 0x7c, 0xc9, 0xff, 	/*Color of index 121*/
-  0x45, 0x74, 0xdd, 0xff, 	/*Color of index 122*/
-  0x2e, 0x6c, 0xef, 0xff, 	/*Color of index 123*/
-  0x41, 0x70, 0xcd, 0xff, 	/*Color of index 124*/
-  0x2a, 0x61, 0xcd, 0xff, 	/*Color of index 125*/
-  0x3c, 0x65, 0x9c, 0xff, 	/*Color of index 126*/
-  0x2f, 0x5d, 0x7f, 0xff, 	/*Color of index 127*/
-  0x39, 0x4b, 0x6c, 0xff, 	/*Color of index 128*/
-  0x27, 0x3c, 0x6b, 0xff, 	/*Color of index 129*/
-  0x0f, 0x20, 0x3d, 0xff, 	/*Color of index 130*/
-  0x02, 0x06, 0x00, 0xff, 	/*Color of index 131*/
-  0xfb, 0xfa, 0xf4, 0xff, 	/*Color of index 132*/
-  0xf9, 0xf8, 0xeb, 0xff, 	/*Color of index 133*/
-  0xf5, 0xf5, 0xf4, 0xff, 	/*Color of index 134*/
-  0xc7, 0xb9, 0x98, 0xff, 	/*Color of index 135*/
-  0xad, 0xa1, 0x82, 0xff, 	/*Color of index 136*/
-  0xf5, 0xf1, 0xeb, 0xff, 	/*Color of index 137*/
-  0xef, 0xea, 0xe2, 0xff, 	/*Color of index 138*/
-  0xea, 0xe4, 0xdb, 0xff, 	/*Color of index 139*/
-  0xe2, 0xdf, 0xdd, 0xff, 	/*Color of index 140*/
-  0xea, 0xdf, 0xd1, 0xff, 	/*Color of index 141*/
-  0xe2, 0xda, 0xd1, 0xff, 	/*Color of index 142*/
-  0xdc, 0xd3, 0xcb, 0xff, 	/*Color of index 143*/
-  0xda, 0xce, 0xc0, 0xff, 	/*Color of index 144*/
-  0xd3, 0xc9, 0xbf, 0xff, 	/*Color of index 145*/
-  0xd7, 0xc8, 0xb3, 0xff, 	/*Color of index 146*/
-  0xce, 0xc4, 0xba, 0xff, 	/*Color of index 147*/
-  0xe0, 0xc4, 0xa3, 0xff, 	/*Color of index 148*/
-  0xcf, 0xc1, 0xb1, 0xff, 	/*Color of index 149*/
-  0xcb, 0xbd, 0xb0, 0xff, 	/*Color of index 150*/
-  0xce, 0xbc, 0xad, 0xff, 	/*Color of index 151*/
-  0xca, 0xbb, 0xac, 0xff, 	/*Color of index 152*/
-  0xc5, 0xb8, 0xac, 0xff, 	/*Color of index 153*/
-  0xc4, 0xb6, 0xa2, 0xff, 	/*Color of index 154*/
-  0xc0, 0xb4, 0xaa, 0xff, 	/*Color of index 155*/
-  0xcb, 0xb1, 0xaa, 0xff, 	/*Color of index 156*/
-  0xbc, 0xb1, 0xa6, 0xff, 	/*Color of index 157*/
-  0xc1, 0xb1, 0x9a, 0xff, 	/*Color of index 158*/
-  0xb7, 0xaa, 0xa5, 0xff, 	/*Color of index 159*/
-  0xb9, 0xab, 0x9b, 0xff, 	/*Color of index 160*/
-  0xb8, 0xa8, 0x94, 0xff, 	/*Color of index 161*/
-  0xb1, 0xa4, 0x9a, 0xff, 	/*Color of index 162*/
-  0xb8, 0xa4, 0x93, 0xff, 	/*Color of index 163*/
-  0xb3, 0xa4, 0x92, 0xff, 	/*Color of index 164*/
-  0xb6, 0xa5, 0x8c, 0xff, 	/*Color of index 165*/
-  0xab, 0x9f, 0x93, 0xff, 	/*Color of index 166*/
-  0xb0, 0xa0, 0x8d, 0xff, 	/*Color of index 167*/
-  0xb5, 0x9d, 0x93, 0xff, 	/*Color of index 168*/
-  0xb0, 0x9c, 0x8a, 0xff, 	/*Color of index 169*/
-  0xa6, 0x98, 0x95, 0xff, 	/*Color of index 170*/
-  0xaa, 0x9a, 0x88, 0xff, 	/*Color of index 171*/
-  0xae, 0x9a, 0x83, 0xff, 	/*Color of index 172*/
-  0xa9, 0x98, 0x84, 0xff, 	/*Color of index 173*/
-  0xa6, 0x95, 0x8a, 0xff, 	/*Color of index 174*/
-  0xa9, 0x97, 0x7b, 0xff, 	/*Color of index 175*/
-  0xa5, 0x94, 0x83, 0xff, 	/*Color of index 176*/
-  0xa4, 0x92, 0x7c, 0xff, 	/*Color of index 177*/
-  0x9f, 0x8e, 0x87, 0xff, 	/*Color of index 178*/
-  0x9f, 0x8c, 0x79, 0xff, 	/*Color of index 179*/
-  0x9b, 0x87, 0x73, 0xff, 	/*Color of index 180*/
-  0x91, 0x82, 0x75, 0xff, 	/*Color of index 181*/
-  0x96, 0x81, 0x6c, 0xff, 	/*Color of index 182*/
-  0x8e, 0x7b, 0x66, 0xff, 	/*Color of index 183*/
-  0x82, 0x73, 0x66, 0xff, 	/*Color of index 184*/
-  0x7d, 0x6c, 0x5b, 0xff, 	/*Color of index 185*/
-  0x6e, 0x60, 0x55, 0xff, 	/*Color of index 186*/
-  0x6b, 0x5a, 0x49, 0xff, 	/*Color of index 187*/
-  0x62, 0x52, 0x43, 0xff, 	/*Color of index 188*/
-  0x51, 0x4c, 0x48, 0xff, 	/*Color of index 189*/
-  0x61, 0x4d, 0x3a, 0xff, 	/*Color of index 190*/
-  0x5b, 0x48, 0x38, 0xff, 	/*Color of index 191*/
-  0x5a, 0x44, 0x34, 0xff, 	/*Color of index 192*/
-  0x54, 0x42, 0x33, 0xff, 	/*Color of index 193*/
-  0x59, 0x41, 0x2e, 0xff, 	/*Color of index 194*/
-  0x4e, 0x40, 0x35, 0xff, 	/*Color of index 195*/
-  0x52, 0x3f, 0x2d, 0xff, 	/*Color of index 196*/
-  0x51, 0x3d, 0x31, 0xff, 	/*Color of index 197*/
-  0x57, 0x3d, 0x2c, 0xff, 	/*Color of index 198*/
-  0x49, 0x3b, 0x31, 0xff, 	/*Color of index 199*/
-  0x50, 0x3c, 0x2a, 0xff, 	/*Color of index 200*/
-  0x4d, 0x39, 0x2a, 0xff, 	/*Color of index 201*/
-  0x51, 0x39, 0x27, 0xff, 	/*Color of index 202*/
-  0x46, 0x38, 0x2c, 0xff, 	/*Color of index 203*/
-  0x4b, 0x37, 0x26, 0xff, 	/*Color of index 204*/
-  0x4a, 0x35, 0x29, 0xff, 	/*Color of index 205*/
-  0x49, 0x34, 0x23, 0xff, 	/*Color of index 206*/
-  0x43, 0x33, 0x28, 0xff, 	/*Color of index 207*/
-  0x3d, 0x31, 0x29, 0xff, 	/*Color of index 208*/
-  0x43, 0x31, 0x23, 0xff, 	/*Color of index 209*/
-  0x3d, 0x2f, 0x21, 0xff, 	/*Color of index 210*/
-  0x43, 0x2e, 0x22, 0xff, 	/*Color of index 211*/
-  0x43, 0x2f, 0x1d, 0xff, 	/*Color of index 212*/
-  0x3b, 0x2d, 0x20, 0xff, 	/*Color of index 213*/
-  0x40, 0x2c, 0x1b, 0xff, 	/*Color of index 214*/
-  0x35, 0x2a, 0x22, 0xff, 	/*Color of index 215*/
-  0x3a, 0x2a, 0x1c, 0xff, 	/*Color of index 216*/
-  0x3c, 0x28, 0x16, 0xff, 	/*Color of index 217*/
-  0x35, 0x27, 0x1b, 0xff, 	/*Color of index 218*/
-  0x2b, 0x25, 0x23, 0xff, 	/*Color of index 219*/
-  0x38, 0x26, 0x18, 0xff, 	/*Color of index 220*/
-  0x31, 0x24, 0x1a, 0xff, 	/*Color of index 221*/
-  0x38, 0x23, 0x12, 0xff, 	/*Color of index 222*/
-  0x31, 0x21, 0x13, 0xff, 	/*Color of index 223*/
-  0x2a, 0x20, 0x18, 0xff, 	/*Color of index 224*/
-  0x2c, 0x1f, 0x14, 0xff, 	/*Color of index 225*/
-  0x25, 0x1f, 0x13, 0xff, 	/*Color of index 226*/
-  0x25, 0x1c, 0x18, 0xff, 	/*Color of index 227*/
-  0x29, 0x1c, 0x13, 0xff, 	/*Color of index 228*/
-  0x32, 0x1c, 0x0c, 0xff, 	/*Color of index 229*/
-  0x25, 0x1a, 0x13, 0xff, 	/*Color of index 230*/
-  0x2a, 0x1a, 0x0d, 0xff, 	/*Color of index 231*/
-  0x21, 0x18, 0x13, 0xff, 	/*Color of index 232*/
-  0x24, 0x18, 0x0e, 0xff, 	/*Color of index 233*/
-  0x21, 0x16, 0x0f, 0xff, 	/*Color of index 234*/
-  0x2a, 0x15, 0x07, 0xff, 	/*Color of index 235*/
-  0x21, 0x14, 0x0b, 0xff, 	/*Color of index 236*/
-  0x1b, 0x13, 0x10, 0xff, 	/*Color of index 237*/
-  0x1b, 0x11, 0x0b, 0xff, 	/*Color of index 238*/
-  0x1c, 0x10, 0x06, 0xff, 	/*Color of index 239*/
-  0x13, 0x0c, 0x09, 0xff, 	/*Color of index 240*/
-  0x18, 0x0c, 0x04, 0xff, 	/*Color of index 241*/
-  0x12, 0x08, 0x02, 0xff, 	/*Color of index 242*/
-  0x0a, 0x07, 0x06, 0xff, 	/*Color of index 243*/
-  0x08, 0x03, 0x01, 0xff, 	/*Color of index 244*/
-  0x9b, 0x94, 0x97, 0xff, 	/*Color of index 245*/
-  0x6f, 0x6d, 0x6d, 0xff, 	/*Color of index 246*/
-  0xb8, 0xb2, 0xb6, 0xff, 	/*Color of index 247*/
-  0xa8, 0xa4, 0xa6, 0xff, 	/*Color of index 248*/
-  0xa5, 0x99, 0xa4, 0xff, 	/*Color of index 249*/
-  0x8c, 0x86, 0x89, 0xff, 	/*Color of index 250*/
-  0x7d, 0x7a, 0x7c, 0xff, 	/*Color of index 251*/
-  0xfa, 0xf5, 0xfb, 0xff, 	/*Color of index 252*/
-  0xab, 0xa6, 0xb5, 0xff, 	/*Color of index 253*/
-  0x76, 0x6f, 0x84, 0xff, 	/*Color of index 254*/
-  0x07, 0x03, 0x09, 0xff, 	/*Color of index 255*/
-
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0xf4, 0x01, 0x01, 0xf4, 0x83, 0x83, 0x83, 0x83, 0x83, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0xff, 0xf4, 0x01, 0xf4, 0xf4, 0x83, 0xf2, 0x83, 0x83, 0x83, 0x83, 0x83, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0x01, 0x83, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0x83, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0x01, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xff, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x56, 0x01, 0x01, 0xff, 0xf4, 0xf4, 0xf2, 0x83, 0x01, 0x01, 0x83, 0x83, 0x83, 0xf4, 0x01, 0xf4, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x56, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xff, 0x83, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xff, 0xf3, 0x55, 0x56, 0xff, 0x55, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x56, 0x56, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0xf0, 0xf0, 0xf3, 0xf0, 0xff, 0xf3, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x56, 0xf4, 0x56, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xff, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xe3, 0xcb, 0xbd, 0x30, 0xf6, 0xfb, 0xfa, 0xfa, 0xfa, 0xf5, 0xaa, 0xf9, 0xf8, 0x9f, 0xfd, 0x9f, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xae, 0xfa, 0xb7, 0xf6, 0xbd, 0xd2, 0x52, 0xed, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x01, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xdb, 0x30, 0xf6, 0xf9, 0x9d, 0x03, 0x8e, 0x5a, 0x89, 0x86, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x89, 0x8c, 0x03, 0x0a, 0x13, 0x1c, 0x27, 0x2a, 0x48, 0x81, 0x81, 0x4e, 0x52, 0x52, 0xff, 0x55, 0x01, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf3, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0x30, 0xf5, 0x03, 0x8a, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x5b, 0x03, 0x06, 0x6a, 0x65, 0x68, 0x68, 0x69, 0x69, 0x6a, 0x72, 0x13, 0x7e, 0x7f, 0x81, 0x4e, 0x52, 0x54, 0x55, 0x55, 0x55, 0x56, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0x83, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0x01, 0xf3, 0x83, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xdb, 0x4a, 0xb2, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5d, 0x65, 0x6e, 0x6b, 0x6f, 0x71, 0x6b, 0x6f, 0x69, 0x69, 0x69, 0x68, 0x69, 0x68, 0x0c, 0x79, 0x2a, 0x81, 0x4e, 0x52, 0x54, 0xff, 0xff, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x83, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0x83, 0x01, 0x83, 0x01, 0x01, 0x83, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0x01, 0xf3, 0xf3, 0x01, 0x01, 0x01, 0xdb, 0xbd, 0xfa, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x58, 0x57, 0x00, 0x02, 0x5d, 0x68, 0x6b, 0x6b, 0x6b, 0x6f, 0x71, 0x70, 0x6f, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x69, 0x69, 0x65, 0x6a, 0x6a, 0x0f, 0x0d, 0x30, 0x4a, 0xdb, 0xf3, 0x01, 0x01, 0x01, 0xff, 0xff, 0x56, 0xff, 0xff, 0x56, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0xc7, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x00, 0x00, 0x59, 0x5e, 0x68, 0x71, 0x71, 0x71, 0x73, 0x6f, 0x6c, 0x6c, 0x6b, 0x6c, 0x6f, 0x71, 0x6b, 0x6b, 0x6e, 0x69, 0x68, 0x5f, 0x5a, 0x59, 0x5a, 0x03, 0xf9, 0xbd, 0xe3, 0x56, 0x56, 0x55, 0x55, 0xff, 0x55, 0xff, 0x56, 0x56, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf3, 0xf0, 0x01, 0xf0, 0xf6, 0x8c, 0x00, 0x00, 0x86, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x57, 0x57, 0x00, 0x57, 0x59, 0x5f, 0x6a, 0x71, 0x71, 0x71, 0x71, 0x73, 0x6b, 0x6c, 0x6f, 0x6f, 0x73, 0x73, 0x6c, 0x6c, 0x6e, 0x6e, 0x72, 0x65, 0x5a, 0x59, 0x00, 0x00, 0x02, 0x03, 0xfa, 0x80, 0x4c, 0x52, 0x54, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0x01, 0xf0, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x57, 0x58, 0x57, 0x00, 0x00, 0x57, 0x59, 0x04, 0x72, 0x6b, 0x6b, 0x71, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6c, 0x75, 0x73, 0x6c, 0x6b, 0x6e, 0x72, 0x72, 0x5b, 0x59, 0x58, 0x58, 0x00, 0x58, 0x5c, 0x07, 0x09, 0x0f, 0x7f, 0x81, 0x82, 0x53, 0x54, 0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xe3, 0xa6, 0x89, 0x8a, 0x85, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x57, 0x59, 0x6a, 0x0c, 0x71, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x6f, 0x71, 0x6b, 0x10, 0x6e, 0x5f, 0x5a, 0x58, 0x00, 0x57, 0x57, 0x5c, 0x6a, 0x68, 0x66, 0x69, 0x66, 0x69, 0x7c, 0x24, 0x81, 0x82, 0x53, 0x54, 0x55, 0x56, 0x56, 0x01, 0xff, 0x83, 0xf3, 0x01, 0x01, 0xf3, 0x01, 0xf3, 0xf4, 0x01, 0xff, 0x56, 0x56, 0x56, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0x01, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf4, 0xf4, 0xb8, 0x93, 0x9d, 0x9c, 0x96, 0x91, 0x8f, 0x8d, 0x8a, 0x85, 0x84, 0x84, 0x00, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x84, 0x84, 0x57, 0x59, 0x5f, 0x72, 0x69, 0x71, 0x6f, 0x71, 0x73, 0x6f, 0x6f, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x73, 0x77, 0x6b, 0x72, 0x5d, 0x58, 0x58, 0x57, 0x58, 0x59, 0x5f, 0x72, 0x69, 0x6b, 0x6b, 0x6b, 0x66, 0x69, 0x69, 0x72, 0x79, 0x80, 0x81, 0x82, 0x52, 0xff, 0x56, 0x01, 0x56, 0x55, 0xff, 0x01, 0xf4, 0xf4, 0xf3, 0xf4, 0x01, 0xff, 0x56, 0x01, 0x56, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xe8, 0xaa, 0x96, 0xa0, 0xa6, 0xa3, 0xa2, 0xa0, 0x9f, 0x9b, 0x96, 0x91, 0x8e, 0x8b, 0x8a, 0x85, 0x89, 0x85, 0x89, 0x85, 0x86, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x57, 0x00, 0x5a, 0x6a, 0x6e, 0x6b, 0x6f, 0x6f, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x7a, 0x79, 0x6a, 0x5b, 0x58, 0x57, 0x02, 0x57, 0x5a, 0x67, 0x6e, 0x69, 0x6b, 0x6c, 0x6f, 0x6b, 0x6e, 0x69, 0x69, 0x69, 0x69, 0x72, 0x1c, 0x7f, 0x4c, 0x82, 0x54, 0x55, 0x55, 0x56, 0xf3, 0xf4, 0xf2, 0x01, 0xf3, 0xff, 0xff, 0x56, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xd7, 0x9d, 0x9f, 0xa0, 0xa2, 0xa1, 0xa2, 0xa8, 0xa6, 0xa6, 0xa6, 0xa2, 0xa2, 0x9d, 0x96, 0x91, 0x8e, 0x8e, 0x8c, 0x8d, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x86, 0x84, 0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x57, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x57, 0x57, 0x59, 0x64, 0x6e, 0x6e, 0x71, 0x71, 0x73, 0x6f, 0x6f, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x6e, 0x14, 0x64, 0x02, 0x57, 0x86, 0x86, 0x00, 0x5c, 0x6a, 0x6e, 0x69, 0x6b, 0x6c, 0x6c, 0x6d, 0x6d, 0x6e, 0x6b, 0x69, 0x69, 0x69, 0x69, 0x72, 0x79, 0x7e, 0x81, 0x82, 0x54, 0x01, 0x01, 0xf4, 0xf2, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x56, 0x56, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xd7, 0x9b, 0x9b, 0xa2, 0xa1, 0xa0, 0xa0, 0xa0, 0xa1, 0xa1, 0xa1, 0xa4, 0xa6, 0xa6, 0xa6, 0xa2, 0x9d, 0x95, 0x90, 0x8e, 0x8b, 0x8b, 0x8e, 0x8f, 0x8e, 0x8e, 0x8e, 0x8c, 0x8d, 0x8c, 0x8b, 0x8c, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x86, 0x86, 0x57, 0x84, 0x84, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x00, 0x59, 0x5c, 0x72, 0x6b, 0x6f, 0x71, 0x73, 0x6f, 0x6f, 0x6d, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x73, 0x78, 0x6b, 0x6e, 0x6e, 0x72, 0x5f, 0x00, 0x84, 0x85, 0x02, 0x59, 0x5f, 0x6a, 0x77, 0x6b, 0x6c, 0x6b, 0x6c, 0x6c, 0x6c, 0x70, 0x76, 0x74, 0x6e, 0x6d, 0x69, 0x69, 0x69, 0x68, 0x6a, 0x0d, 0x2a, 0xe3, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 0xff, 0x56, 0x56, 0x56, 0x56, 0x56, 0xff, 0x01, 0x56, 0x56, 0x01, 0x56, 0x01, 0x56, 0x56, 0x56, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xdd, 0x9f, 0x9d, 0xa0, 0xa0, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa6, 0xa3, 0xa0, 0xa1, 0xa1, 0xa6, 0xa9, 0xae, 0xa6, 0xa1, 0x98, 0x90, 0x8d, 0x8a, 0x8b, 0x8d, 0x8d, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8c, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x85, 0x86, 0x84, 0x84, 0x84, 0x84, 0x00, 0x00, 0x84, 0x84, 0x00, 0xfc, 0x00, 0x5a, 0x68, 0x10, 0x6b, 0x71, 0x73, 0x6f, 0x6f, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x73, 0x73, 0x75, 0x6f, 0x6f, 0x6e, 0x79, 0x68, 0x5b, 0x00, 0x00, 0x86, 0x58, 0x59, 0x65, 0x6a, 0x6b, 0x6c, 0x6c, 0x70, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x6d, 0x6d, 0x79, 0x79, 0x64, 0x5b, 0x59, 0x05, 0xb7, 0xe0, 0xf4, 0xf4, 0xf3, 0x01, 0x56, 0x56, 0x56, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0xff, 0x83, 0xff, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xff, 0xff, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0x01, 0xe8, 0xa2, 0x9d, 0xa0, 0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa1, 0xa1, 0xa3, 0xa1, 0xa6, 0xa4, 0xa4, 0xa0, 0xa0, 0xa3, 0xa4, 0xa9, 0xa4, 0xa0, 0x97, 0x90, 0x8d, 0x8d, 0x8b, 0x8b, 0x8d, 0x8d, 0x8d, 0x8b, 0x8b, 0x8d, 0x8b, 0x8d, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8b, 0x8b, 0x8b, 0x8c, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x86, 0x85, 0x85, 0x84, 0x86, 0x00, 0x5a, 0x64, 0x79, 0x71, 0x71, 0x73, 0x6f, 0x6f, 0x6d, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x73, 0x6f, 0x78, 0x6b, 0x78, 0x10, 0x6e, 0x04, 0xfc, 0x58, 0x00, 0x59, 0x59, 0x5b, 0x6a, 0x6e, 0x6b, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6c, 0x70, 0x70, 0x6c, 0x6c, 0x6c, 0x6b, 0x6b, 0x79, 0x6a, 0x5c, 0x00, 0x00, 0x89, 0x9f, 0xba, 0xd7, 0xed, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf3, 0x01, 0x01, 0x56, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0xb3, 0x9d, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa4, 0xa3, 0xa4, 0xa4, 0x9d, 0x92, 0x90, 0x8e, 0x8d, 0x8b, 0x8b, 0x8d, 0x8b, 0x8d, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8c, 0x8c, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x86, 0xfc, 0x02, 0x64, 0x16, 0x7a, 0x71, 0x73, 0x73, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x75, 0x75, 0x73, 0x6f, 0x6f, 0x6e, 0x68, 0x5b, 0x59, 0x58, 0x57, 0x59, 0x59, 0x64, 0x72, 0x6b, 0x6d, 0x70, 0x6c, 0x6c, 0x70, 0x6c, 0x70, 0x6c, 0x70, 0x6c, 0x6c, 0x6c, 0x70, 0x6d, 0x6e, 0x79, 0x69, 0x5d, 0x57, 0x00, 0x00, 0x00, 0x8c, 0xf7, 0x30, 0x4c, 0xed, 0x56, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xf3, 0xf3, 0x01, 0x01, 0xf4, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0xf0, 0x83, 0xf3, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0x56, 0x01, 0x56, 0x56, 0x56, 0x56, 0xf4, 0x56, 0xf4, 0x01, 0xff, 0x01, 0x01, 0xff, 0x83, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf2, 0xba, 0x99, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa4, 0xa4, 0xa3, 0xa2, 0x9e, 0x97, 0x90, 0x8d, 0x8b, 0x8b, 0x8b, 0x8d, 0x8d, 0x8d, 0x8b, 0x8b, 0x8b, 0x8b, 0x8d, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8a, 0x8b, 0x02, 0x02, 0x04, 0x16, 0x17, 0x7b, 0x7b, 0x7b, 0x6f, 0x77, 0x6f, 0x73, 0x6f, 0x71, 0x6f, 0x73, 0x6f, 0x73, 0x73, 0x73, 0x6f, 0x71, 0x71, 0x10, 0x5f, 0x59, 0x59, 0x86, 0x58, 0x00, 0x5b, 0x6a, 0x6e, 0x6b, 0x76, 0x6c, 0x70, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x70, 0x6c, 0x70, 0x70, 0x6b, 0x6d, 0x6e, 0x79, 0x65, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x8c, 0xfd, 0xfe, 0xc7, 0xf2, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf4, 0x83, 0xf0, 0xf4, 0xf4, 0xff, 0xf4, 0x55, 0xf3, 0xff, 0xff, 0x56, 0x56, 0x55, 0x56, 0x55, 0x55, 0x56, 0x55, 0x55, 0x56, 0x55, 0x56, 0xff, 0xff, 0x56, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xc3, 0x99, 0xa2, 0xa1, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa1, 0xa4, 0xa7, 0xa6, 0xa4, 0xa1, 0xa0, 0x98, 0x90, 0x8b, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8a, 0x5a, 0x5d, 0x16, 0x1b, 0x7b, 0x19, 0x7b, 0x78, 0x7a, 0x78, 0x75, 0x71, 0x73, 0x71, 0x6f, 0x73, 0x73, 0x75, 0x75, 0x73, 0x73, 0x77, 0x10, 0x69, 0x5a, 0x59, 0x86, 0x85, 0x58, 0x58, 0x64, 0x79, 0x6b, 0x74, 0x6b, 0x74, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x6c, 0x6c, 0x70, 0x70, 0x6c, 0x6d, 0x6d, 0x79, 0x6a, 0x5a, 0x00, 0x02, 0x84, 0x84, 0x02, 0x00, 0x00, 0x57, 0x8a, 0xf7, 0xb5, 0xdb, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0x83, 0xf4, 0x83, 0xf4, 0x01, 0xf4, 0x01, 0x56, 0x55, 0x55, 0x56, 0x55, 0x56, 0x54, 0x50, 0x4c, 0x80, 0x3d, 0x81, 0x4e, 0x53, 0x53, 0x54, 0x54, 0x55, 0x56, 0x55, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0xf4, 0xf4, 0xe3, 0xa9, 0x9d, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa7, 0xa3, 0xa2, 0xa1, 0xa3, 0xa2, 0xa4, 0xa7, 0xa7, 0xa4, 0xa1, 0x9a, 0x90, 0x8d, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8d, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8a, 0x02, 0x5f, 0x16, 0x17, 0x7b, 0x1e, 0x19, 0x19, 0x19, 0x7b, 0x1a, 0x7b, 0x7b, 0x78, 0x78, 0x73, 0x73, 0x73, 0x73, 0x73, 0x71, 0x6f, 0x7a, 0x6e, 0x5b, 0x59, 0x86, 0x85, 0x89, 0x59, 0x5a, 0x79, 0x6e, 0x6b, 0x6c, 0x6d, 0x6c, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x70, 0x6c, 0x6c, 0x70, 0x70, 0x6c, 0x6d, 0x6b, 0x79, 0x64, 0x59, 0x00, 0x00, 0x84, 0x00, 0x00, 0x57, 0x58, 0x00, 0x00, 0x00, 0x86, 0x93, 0xf6, 0xd7, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf3, 0x56, 0xf3, 0x55, 0x56, 0x54, 0x82, 0x80, 0x79, 0x65, 0x60, 0x64, 0x69, 0x0c, 0x69, 0x0c, 0x16, 0x21, 0x2e, 0x37, 0x82, 0x56, 0x56, 0x56, 0xff, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf1, 0xb9, 0x9d, 0xa1, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa0, 0xa0, 0xa7, 0xa9, 0xab, 0xa6, 0xa4, 0x9d, 0x92, 0x8f, 0x8b, 0x8a, 0x8a, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8c, 0x8a, 0x8a, 0x8a, 0x02, 0x5d, 0x16, 0x17, 0x19, 0x15, 0x19, 0x7b, 0x17, 0x19, 0x1e, 0x19, 0x19, 0x17, 0x7b, 0x7a, 0x75, 0x78, 0x75, 0x73, 0x73, 0x71, 0x77, 0x79, 0x64, 0x59, 0x84, 0x85, 0x85, 0x02, 0x59, 0x65, 0x77, 0x6b, 0x6d, 0x6c, 0x70, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x70, 0x6c, 0x6c, 0x70, 0x70, 0x76, 0x6b, 0x74, 0x72, 0x5c, 0x57, 0x84, 0x85, 0x86, 0x57, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xf7, 0xf6, 0xd0, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0x56, 0x56, 0x56, 0x54, 0x82, 0x7e, 0x67, 0x62, 0x62, 0x66, 0x6b, 0x74, 0x77, 0x78, 0x17, 0x19, 0x1b, 0x1b, 0x1b, 0x10, 0x81, 0x55, 0x55, 0x56, 0xf0, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0xf4, 0x01, 0xcb, 0xa2, 0x9e, 0xa1, 0xa0, 0xa1, 0xa1, 0xa3, 0xa1, 0xa3, 0xa2, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa2, 0xa3, 0xa2, 0xa3, 0xa6, 0xa9, 0xa4, 0xa1, 0xa1, 0xa1, 0xa4, 0xa4, 0xa7, 0xa6, 0xa1, 0x9b, 0x92, 0x8f, 0x8d, 0x8b, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8b, 0x8a, 0x8a, 0x5f, 0x16, 0x7d, 0x7b, 0x1e, 0x19, 0x19, 0x19, 0x1a, 0x1a, 0x1a, 0x19, 0x7b, 0x19, 0x19, 0x7b, 0x19, 0x7b, 0x78, 0x7b, 0x78, 0x71, 0x79, 0x68, 0x59, 0x85, 0x85, 0x85, 0x00, 0x5a, 0x5d, 0x6e, 0x6d, 0x6c, 0x6c, 0x70, 0x70, 0x6c, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x70, 0x6c, 0x6c, 0x6d, 0x6c, 0x6c, 0x6d, 0x6e, 0x64, 0x59, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x58, 0x57, 0x00, 0x00, 0x86, 0x57, 0x00, 0x00, 0x00, 0x8c, 0xf7, 0xfb, 0xc7, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0xf4, 0x56, 0x56, 0x56, 0x55, 0x82, 0x7e, 0x67, 0x60, 0x62, 0x62, 0x66, 0x6b, 0x74, 0x76, 0x75, 0x75, 0x7b, 0x7b, 0x1e, 0x1f, 0x1a, 0x17, 0x81, 0x56, 0x55, 0x55, 0xf0, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf3, 0x01, 0xf4, 0xf0, 0xfa, 0xa0, 0xa1, 0xa0, 0xa1, 0xa1, 0xa0, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa3, 0xa1, 0xa4, 0xa3, 0xa4, 0xa3, 0xa1, 0xa1, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa6, 0xa7, 0xa2, 0xa0, 0x9b, 0x95, 0x8f, 0x8b, 0x8a, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x5a, 0x8b, 0x8a, 0x8b, 0x5a, 0x04, 0x16, 0x1b, 0x15, 0x7b, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x7b, 0x19, 0x7b, 0x7a, 0x72, 0x5a, 0xfc, 0x89, 0x89, 0xfc, 0x02, 0x5b, 0x69, 0x79, 0x70, 0x6c, 0x6c, 0x6c, 0x6d, 0x6c, 0x6f, 0x6f, 0x6c, 0x6f, 0x70, 0x70, 0x6c, 0x6c, 0x6d, 0x6c, 0x6c, 0x6e, 0x6a, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xf7, 0xfb, 0xc3, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x83, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0xf4, 0xf4, 0xff, 0x01, 0x56, 0xf3, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xff, 0x56, 0x56, 0x53, 0x7f, 0x67, 0x60, 0x60, 0x62, 0x62, 0x69, 0x6d, 0x6d, 0x74, 0x75, 0x78, 0x7b, 0x73, 0x1f, 0x1b, 0x1b, 0x1b, 0x18, 0x4c, 0x55, 0x56, 0x56, 0xff, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0xbd, 0x9b, 0xa0, 0xa1, 0xa4, 0x9e, 0x88, 0xa1, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa1, 0xa4, 0xa1, 0xa4, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa2, 0xa1, 0x9b, 0x95, 0x8f, 0x8d, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8c, 0x8c, 0x8c, 0x8b, 0x8a, 0x8a, 0x5a, 0x04, 0x20, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x15, 0x1a, 0x19, 0x19, 0x1a, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x1a, 0x1a, 0x19, 0x1a, 0x19, 0x19, 0x18, 0x5d, 0xfc, 0xfc, 0x89, 0x02, 0x59, 0x5a, 0x64, 0x6e, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x6f, 0x6c, 0x6f, 0x73, 0x6f, 0x70, 0x6c, 0x6c, 0x6d, 0x6d, 0x6c, 0x70, 0x6b, 0x79, 0x5f, 0x59, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x84, 0x5a, 0x96, 0xf6, 0xe3, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0xf3, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0xff, 0xf4, 0xff, 0x56, 0xff, 0xff, 0x01, 0x01, 0x01, 0xf4, 0xf1, 0xf2, 0xf3, 0x01, 0x56, 0xf0, 0x82, 0x67, 0x60, 0x60, 0x62, 0x62, 0x62, 0x66, 0x6d, 0x74, 0x77, 0x76, 0x76, 0x7b, 0x71, 0x1b, 0x4d, 0x4d, 0x4d, 0x4d, 0x48, 0x52, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xff, 0x01, 0x83, 0xae, 0x9a, 0xa4, 0xa4, 0x9e, 0xa7, 0xa1, 0xa5, 0xa5, 0xa1, 0xa5, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa3, 0xa1, 0xa3, 0xa1, 0xa4, 0xa6, 0xa9, 0xa4, 0xa0, 0xa0, 0x91, 0x8f, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8c, 0x8b, 0x8b, 0x8a, 0x5a, 0x68, 0x21, 0x1a, 0x19, 0x7b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x1f, 0x24, 0x64, 0xfc, 0x02, 0x89, 0xfc, 0x02, 0x59, 0x5d, 0x72, 0x6d, 0x70, 0x6c, 0x6d, 0x6c, 0x6d, 0x6f, 0x6c, 0x6c, 0x6f, 0x6c, 0x6c, 0x6d, 0x6c, 0x6c, 0x70, 0x6c, 0x6d, 0x72, 0x68, 0x5b, 0x58, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9d, 0xf6, 0xdb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0xf1, 0x83, 0xf4, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0xf4, 0xf4, 0x56, 0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0xf3, 0x82, 0x7f, 0x5e, 0x60, 0x62, 0x62, 0x62, 0x66, 0x66, 0x76, 0x76, 0x7b, 0x78, 0x75, 0x78, 0x78, 0x6b, 0x2c, 0x51, 0x51, 0x52, 0x53, 0x53, 0xff, 0x01, 0xff, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0x83, 0x56, 0xf4, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xf3, 0xf3, 0x01, 0xc3, 0x9d, 0xa1, 0xa1, 0xa9, 0x9e, 0xa5, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa1, 0xa3, 0xa4, 0xa1, 0xa0, 0xa0, 0xa0, 0xa4, 0xa6, 0xa4, 0xa1, 0x9d, 0x95, 0x90, 0x8d, 0x8a, 0x89, 0x8a, 0x8b, 0x89, 0x5b, 0x0c, 0x20, 0x15, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1e, 0x1b, 0x7d, 0x08, 0xfc, 0x8b, 0x8a, 0x8a, 0x02, 0x02, 0x5b, 0x72, 0x6e, 0x70, 0x70, 0x70, 0x6c, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x6f, 0x6f, 0x70, 0x6c, 0x6d, 0x6e, 0x72, 0x5d, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x86, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x9f, 0x30, 0xd0, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0xf4, 0xf4, 0xf2, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0xf3, 0xf4, 0xff, 0xf4, 0xff, 0x56, 0x55, 0x55, 0x80, 0x67, 0x5e, 0x62, 0x62, 0x62, 0x62, 0x66, 0x6d, 0x77, 0x7b, 0x75, 0x75, 0x75, 0x75, 0x7b, 0x7b, 0x6d, 0x33, 0x51, 0x51, 0x4f, 0x4e, 0x4c, 0x55, 0x56, 0xf3, 0xff, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf2, 0xb7, 0x98, 0xa1, 0xa1, 0xa4, 0xa1, 0xa3, 0xa5, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa3, 0xa3, 0xa1, 0xa0, 0xa1, 0xa4, 0xa4, 0xa4, 0xa1, 0xa0, 0xa4, 0xa4, 0xa6, 0xa6, 0xa0, 0x9d, 0x95, 0x8f, 0x8d, 0x8b, 0x89, 0x5d, 0x11, 0x20, 0x1e, 0x1a, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x20, 0x08, 0x02, 0x8c, 0x8d, 0x8b, 0x8c, 0x02, 0x5b, 0x6a, 0x6e, 0x6b, 0x70, 0x70, 0x6c, 0x70, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x6f, 0x6f, 0x6f, 0x75, 0x6c, 0x6d, 0x6e, 0x72, 0x64, 0x59, 0x57, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x57, 0x84, 0x00, 0x57, 0x84, 0x00, 0x00, 0x86, 0x57, 0x00, 0x00, 0x00, 0x8e, 0xf5, 0xbd, 0xe8, 0x01, 0x56, 0xf3, 0x56, 0x01, 0xf4, 0xf4, 0xf4, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0x83, 0x83, 0x83, 0x83, 0xf3, 0x83, 0x01, 0xff, 0xff, 0x55, 0x55, 0x82, 0x14, 0x60, 0x60, 0x61, 0x61, 0x63, 0x62, 0x66, 0x74, 0x70, 0x6f, 0x73, 0x75, 0x7b, 0x75, 0x7b, 0x7b, 0x75, 0x7b, 0x1b, 0x26, 0x31, 0x2b, 0x20, 0x2c, 0x54, 0x01, 0x56, 0x01, 0x01, 0x83, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x83, 0x01, 0xd0, 0xa6, 0xa4, 0x9e, 0xac, 0xa0, 0xa5, 0xa3, 0xa5, 0xa3, 0xa3, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa5, 0xa3, 0xa5, 0xa1, 0xa1, 0xa1, 0xa1, 0xa0, 0xa0, 0xa0, 0xa1, 0xa4, 0xa4, 0xa4, 0xa7, 0x9a, 0x93, 0x03, 0x65, 0x21, 0x26, 0x1a, 0x1a, 0x15, 0x1a, 0x19, 0x1f, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1f, 0x7d, 0x07, 0x5a, 0x8b, 0x8d, 0x8d, 0x8e, 0x8b, 0x5b, 0x04, 0x72, 0x6b, 0x73, 0x6c, 0x70, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x6f, 0x6f, 0x71, 0x70, 0x6c, 0x6d, 0x6e, 0x79, 0x67, 0x5a, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x86, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xba, 0x82, 0xed, 0x55, 0x55, 0x56, 0xff, 0xff, 0x01, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x83, 0x83, 0x83, 0x83, 0xf4, 0xf4, 0xff, 0xff, 0x55, 0xff, 0x81, 0x67, 0x5e, 0x60, 0x61, 0x63, 0x63, 0x63, 0x66, 0x6d, 0x76, 0x73, 0x75, 0x7b, 0x75, 0x75, 0x75, 0x7b, 0x75, 0x7b, 0x7b, 0x19, 0x1a, 0x26, 0x29, 0x22, 0x47, 0x54, 0x01, 0x01, 0x56, 0x01, 0xf3, 0x01, 0x83, 0x01, 0x83, 0x56, 0xf4, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf4, 0x83, 0xba, 0x9b, 0xab, 0x9d, 0xa9, 0xa1, 0xa5, 0xa3, 0xa3, 0xa1, 0xa3, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa5, 0xa1, 0xa5, 0xa3, 0xa5, 0xa4, 0xa1, 0xa0, 0xa0, 0xa1, 0xa0, 0xa1, 0xa1, 0xa1, 0xf8, 0x08, 0x1d, 0x49, 0x3b, 0x34, 0x28, 0x23, 0x1a, 0x1a, 0x7b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x24, 0x64, 0x8c, 0x8a, 0x8d, 0x8d, 0x8e, 0x8a, 0x8c, 0x04, 0x14, 0x7c, 0x6b, 0x6d, 0x6c, 0x6d, 0x6c, 0x6c, 0x70, 0x6c, 0x70, 0x6c, 0x6f, 0x6c, 0x6f, 0x70, 0x6c, 0x6c, 0x6d, 0x72, 0x72, 0x5c, 0x57, 0x57, 0x00, 0x84, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x86, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf7, 0x1c, 0x7f, 0x4c, 0x52, 0x55, 0x55, 0x56, 0x01, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf4, 0x01, 0x01, 0x83, 0x83, 0x83, 0xf4, 0xf4, 0x56, 0x56, 0x55, 0x7f, 0x67, 0x61, 0x61, 0x63, 0x63, 0x62, 0x62, 0x66, 0x74, 0x74, 0x6c, 0x75, 0x78, 0x6f, 0x76, 0x77, 0x76, 0x76, 0x78, 0x78, 0x71, 0x1b, 0x1a, 0x29, 0x29, 0x22, 0x4d, 0x53, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x83, 0xf0, 0xb5, 0x99, 0xab, 0x9e, 0xa1, 0xa7, 0xa0, 0xa1, 0xa4, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa1, 0xa3, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa1, 0xa5, 0xa1, 0xa5, 0xa1, 0xa5, 0xa1, 0xa1, 0xa3, 0xa1, 0xa5, 0xa1, 0xa1, 0xa1, 0xa1, 0x9e, 0xa2, 0x09, 0x0b, 0x37, 0x47, 0x38, 0x3e, 0x3f, 0x3e, 0x35, 0x28, 0x26, 0x1a, 0x19, 0x15, 0x19, 0x1a, 0x19, 0x1f, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x20, 0x5d, 0x5a, 0x8d, 0x8d, 0x8d, 0x8b, 0x8e, 0x8e, 0x5b, 0x14, 0x3a, 0x24, 0x79, 0x6e, 0x6b, 0x6b, 0x6f, 0x6c, 0x6c, 0x70, 0x6c, 0x70, 0x6d, 0x6d, 0x6c, 0x70, 0x6b, 0x74, 0x6e, 0x79, 0x5f, 0x59, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x5d, 0x0f, 0x0e, 0x0c, 0x11, 0x4b, 0x54, 0x01, 0x01, 0x01, 0xf4, 0x56, 0x56, 0x56, 0xf3, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0x01, 0x83, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf3, 0x83, 0x01, 0x83, 0xf4, 0xf4, 0x56, 0x55, 0xed, 0x1c, 0x5e, 0x61, 0x61, 0x61, 0x63, 0x62, 0x63, 0x66, 0x74, 0x74, 0x76, 0x76, 0x78, 0x75, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x6e, 0x7c, 0x4b, 0x4d, 0x4b, 0x37, 0x37, 0x4f, 0x55, 0x56, 0xff, 0x56, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf3, 0x01, 0xd7, 0xb2, 0x98, 0xab, 0xa7, 0xa1, 0xa1, 0xa9, 0xa1, 0xa1, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa1, 0xa5, 0xa5, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa0, 0xa1, 0xfd, 0x07, 0x25, 0x40, 0x45, 0x41, 0x44, 0x46, 0x46, 0x3f, 0x3e, 0x38, 0x33, 0x2f, 0x26, 0x23, 0x1a, 0x15, 0x15, 0x19, 0x1a, 0x1f, 0x1f, 0x19, 0x19, 0x19, 0x1b, 0x24, 0x5d, 0x8c, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x5a, 0x07, 0x7f, 0x7e, 0x14, 0x7e, 0x18, 0x7a, 0x6f, 0x71, 0x75, 0x6f, 0x6c, 0x6c, 0x6b, 0x6d, 0x6d, 0x76, 0x6c, 0x74, 0x6e, 0x79, 0x64, 0x59, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0x16, 0x17, 0x0c, 0x5f, 0x5b, 0xfd, 0xbd, 0xe9, 0x01, 0x01, 0xff, 0x56, 0x83, 0xf0, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf4, 0x01, 0x01, 0x83, 0xf4, 0xf4, 0xff, 0xff, 0x82, 0x67, 0x5e, 0x61, 0x61, 0x63, 0x63, 0x62, 0x62, 0x6b, 0x74, 0x77, 0x6f, 0x76, 0x6f, 0x76, 0x76, 0x75, 0x76, 0x76, 0x76, 0x77, 0x77, 0x6e, 0x2c, 0x51, 0x51, 0x50, 0x50, 0x82, 0x53, 0xff, 0x56, 0x56, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0xc3, 0xa0, 0xa0, 0xa4, 0xa0, 0xa1, 0xa7, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa1, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa1, 0xa3, 0xa5, 0xa1, 0xa5, 0xa1, 0xa5, 0xa1, 0xa3, 0xa1, 0xa4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa2, 0x09, 0x0b, 0x40, 0x45, 0x38, 0x44, 0x44, 0x46, 0x43, 0x46, 0x44, 0x44, 0x41, 0x3e, 0x3e, 0x2f, 0x28, 0x26, 0x23, 0x1a, 0x1a, 0x15, 0x19, 0x1a, 0x1f, 0x19, 0x20, 0x0c, 0x5c, 0x8c, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8a, 0x04, 0x2a, 0x0a, 0x08, 0x14, 0x7e, 0x2e, 0x18, 0x17, 0x71, 0x6b, 0x6f, 0x74, 0x6d, 0x6d, 0x6d, 0x76, 0x6c, 0x76, 0x6d, 0x79, 0x68, 0x59, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x58, 0x5a, 0x64, 0x7a, 0x17, 0x7a, 0x64, 0x5a, 0x00, 0x8f, 0xf6, 0xd0, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf3, 0xf3, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf3, 0x01, 0x01, 0xff, 0x55, 0x55, 0x82, 0x67, 0x5e, 0x61, 0x61, 0x61, 0x63, 0x61, 0x66, 0x66, 0x74, 0x6d, 0x77, 0x6f, 0x77, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x77, 0x49, 0x51, 0x51, 0x50, 0x52, 0x82, 0x82, 0x56, 0x56, 0x56, 0xff, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf3, 0xbb, 0x9b, 0xa4, 0xa4, 0xa9, 0xa1, 0xa1, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa4, 0xa5, 0xa3, 0xa5, 0xa3, 0xa1, 0xa1, 0xa4, 0xa4, 0xa1, 0xa4, 0xa1, 0xa2, 0xa2, 0xfd, 0x09, 0x21, 0x45, 0x45, 0x3f, 0x3f, 0x44, 0x43, 0x43, 0x43, 0x3f, 0x44, 0x3e, 0x3f, 0x3e, 0x41, 0x3e, 0x3e, 0x35, 0x2f, 0x26, 0x23, 0x15, 0x1a, 0x1a, 0x1f, 0x21, 0x68, 0x5c, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8b, 0x05, 0x80, 0xf8, 0x05, 0x05, 0x09, 0x0e, 0x7e, 0x2e, 0x24, 0x7c, 0x6d, 0x6b, 0x6d, 0x6d, 0x6c, 0x76, 0x70, 0x76, 0x6f, 0x79, 0x6e, 0x5a, 0x00, 0x00, 0x00, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x59, 0x5b, 0x6b, 0x10, 0x7a, 0x16, 0x65, 0x5a, 0x57, 0x00, 0x03, 0xf9, 0xc7, 0xf0, 0x01, 0x01, 0xf3, 0x01, 0x01, 0xff, 0x01, 0x01, 0xff, 0xf3, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x55, 0x56, 0x55, 0x80, 0x60, 0x60, 0x61, 0x61, 0x63, 0x63, 0x63, 0x63, 0x66, 0x74, 0x77, 0x6c, 0x71, 0x76, 0x73, 0x77, 0x76, 0x76, 0x76, 0x75, 0x7b, 0x75, 0x7b, 0x7b, 0x7b, 0x49, 0x4f, 0x4f, 0x4f, 0x4e, 0x4e, 0x54, 0x55, 0x56, 0x56, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0xf1, 0xb8, 0x9b, 0xa1, 0xab, 0xa0, 0xa4, 0xa7, 0xa0, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa5, 0xa3, 0xa5, 0xa1, 0xa4, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa2, 0xfd, 0x0e, 0x42, 0x44, 0x46, 0x46, 0x3e, 0x3f, 0x43, 0x43, 0x43, 0x43, 0x3f, 0x3f, 0x46, 0x3f, 0x46, 0x3f, 0x3f, 0x3e, 0x3e, 0x3e, 0x35, 0x2f, 0x28, 0x23, 0x20, 0x18, 0x04, 0x5c, 0x8e, 0x8d, 0x8d, 0x8f, 0x8d, 0x8d, 0x8d, 0x8b, 0xf7, 0x30, 0x9b, 0x93, 0xf7, 0xf7, 0xf7, 0x06, 0x0f, 0x7e, 0x3a, 0x24, 0x6b, 0x6c, 0x73, 0x76, 0x73, 0x70, 0x73, 0x70, 0x7a, 0x79, 0x5b, 0x00, 0x00, 0x84, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x57, 0x57, 0x58, 0x5f, 0x10, 0x7c, 0x7a, 0x7a, 0x65, 0x5a, 0x00, 0x00, 0x00, 0x8c, 0xf8, 0x30, 0xed, 0x01, 0x01, 0xf3, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf3, 0x56, 0x56, 0x54, 0x80, 0x67, 0x60, 0x61, 0x61, 0x61, 0x63, 0x62, 0x62, 0x6d, 0x74, 0x74, 0x6d, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x75, 0x7b, 0x7b, 0x1e, 0x1f, 0x1a, 0x1b, 0x21, 0x18, 0x2c, 0x52, 0x55, 0x56, 0x56, 0xff, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x83, 0xf4, 0x01, 0xe2, 0xb3, 0x9d, 0xa1, 0xa1, 0xa4, 0xa7, 0xa1, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa3, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa2, 0xa4, 0xa2, 0xa1, 0xf8, 0x0a, 0x25, 0x47, 0x3f, 0x46, 0x46, 0x3e, 0x3f, 0x46, 0x43, 0x43, 0x43, 0x46, 0x43, 0x46, 0x46, 0x3f, 0x3f, 0x3f, 0x39, 0x3f, 0x3e, 0x44, 0x44, 0x41, 0x3e, 0x2b, 0x16, 0x5f, 0x03, 0x8c, 0x8f, 0x8f, 0x90, 0x8d, 0x90, 0x8d, 0x8d, 0xf8, 0xf6, 0xa2, 0x92, 0x95, 0x92, 0x9a, 0x99, 0xf7, 0x09, 0x1c, 0x3a, 0x7d, 0x7a, 0x73, 0x73, 0x76, 0x73, 0x75, 0x78, 0x6e, 0x16, 0x5b, 0x58, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x02, 0x58, 0x5f, 0x7a, 0x10, 0x7b, 0x7c, 0x64, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x84, 0x8c, 0xf9, 0xdb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0x01, 0xed, 0x56, 0x56, 0x80, 0x60, 0x5e, 0x61, 0x61, 0x63, 0x61, 0x61, 0x66, 0x6b, 0x74, 0x77, 0x70, 0x70, 0x78, 0x70, 0x75, 0x75, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x78, 0x7b, 0x19, 0x1e, 0x19, 0x7b, 0x17, 0x18, 0x0c, 0x24, 0x52, 0x55, 0x56, 0x56, 0x01, 0xff, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf4, 0xf4, 0x01, 0xe2, 0xb2, 0xa0, 0xa6, 0xa0, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa2, 0xa2, 0xa2, 0x09, 0x1d, 0x42, 0x38, 0x46, 0x46, 0x3e, 0x44, 0x44, 0x46, 0x43, 0x43, 0x43, 0x46, 0x46, 0x46, 0x43, 0x43, 0x43, 0x43, 0x46, 0x46, 0x3f, 0x3e, 0x3e, 0x3e, 0x44, 0x47, 0x36, 0x0c, 0x07, 0x03, 0x03, 0x8e, 0x03, 0x8d, 0x90, 0x8f, 0x8d, 0xf5, 0xf6, 0x92, 0x87, 0x87, 0x87, 0x87, 0x87, 0x9a, 0xf7, 0x06, 0x13, 0x2c, 0x7b, 0x71, 0x7b, 0x71, 0x75, 0x73, 0x7b, 0x77, 0x7c, 0x5c, 0x57, 0x00, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x00, 0x02, 0x5b, 0x68, 0x7c, 0x71, 0x7b, 0x7a, 0x64, 0x59, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xf6, 0xd0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0x01, 0x83, 0x7f, 0x60, 0x5e, 0x61, 0x63, 0x63, 0x63, 0x62, 0x63, 0x6b, 0x77, 0x77, 0x70, 0x76, 0x78, 0x6c, 0x76, 0x70, 0x76, 0x76, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x19, 0x19, 0x1e, 0x1e, 0x15, 0x1f, 0x17, 0x7a, 0x2c, 0x53, 0x55, 0x01, 0x56, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xd7, 0xae, 0xa2, 0xa6, 0xa0, 0xa4, 0xa4, 0xa4, 0xa1, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa3, 0xa3, 0xa5, 0xa1, 0xa4, 0xa2, 0xf9, 0xf9, 0x0e, 0x47, 0x3f, 0x44, 0x3f, 0x46, 0x46, 0x46, 0x46, 0x46, 0x43, 0x46, 0x43, 0x46, 0x3f, 0x3f, 0x46, 0x43, 0x43, 0x43, 0x43, 0x43, 0x39, 0x3f, 0x44, 0x3e, 0x3e, 0x41, 0x45, 0x40, 0x42, 0x2e, 0x14, 0x08, 0x05, 0x03, 0x03, 0x8e, 0x03, 0xfe, 0xfa, 0x97, 0x94, 0x87, 0x94, 0x87, 0x94, 0x87, 0x9b, 0xfd, 0x0b, 0x24, 0x18, 0x71, 0x78, 0x71, 0x75, 0x75, 0x75, 0x7a, 0x16, 0x5c, 0xfc, 0x00, 0x84, 0x00, 0x00, 0x57, 0x00, 0xfc, 0x00, 0x57, 0x00, 0x57, 0x57, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x00, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x84, 0x84, 0x00, 0x86, 0x57, 0x59, 0x5f, 0x6e, 0x7a, 0x7b, 0x15, 0x10, 0x5c, 0x58, 0xfc, 0x00, 0x00, 0x84, 0x84, 0x00, 0x00, 0x00, 0x02, 0xa0, 0xbd, 0xdd, 0xff, 0x01, 0x01, 0xff, 0xf4, 0xff, 0x83, 0x01, 0x83, 0x83, 0xf3, 0x01, 0x01, 0xf4, 0x01, 0xff, 0xf3, 0x55, 0x80, 0x5e, 0x5e, 0x62, 0x62, 0x63, 0x63, 0x62, 0x63, 0x74, 0x74, 0x75, 0x70, 0x76, 0x76, 0x76, 0x76, 0x70, 0x76, 0x78, 0x78, 0x76, 0x73, 0x75, 0x78, 0x76, 0x77, 0x19, 0x1e, 0x1e, 0x1e, 0x23, 0x15, 0x1a, 0x17, 0x2c, 0x53, 0x55, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xd0, 0xae, 0xa0, 0xa6, 0xa1, 0xa1, 0xa1, 0xa7, 0xa4, 0xa0, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa2, 0xa8, 0xa2, 0xa8, 0xa3, 0xa3, 0x88, 0x9e, 0xa4, 0xf9, 0x06, 0x0f, 0x32, 0x44, 0x3f, 0x3f, 0x44, 0x44, 0x44, 0x46, 0x46, 0x43, 0x46, 0x46, 0x43, 0x46, 0x3f, 0x44, 0x3f, 0x46, 0x43, 0x43, 0x43, 0x43, 0x46, 0x46, 0x3f, 0x41, 0x44, 0x44, 0x3f, 0x2f, 0x29, 0x31, 0x3a, 0x3a, 0x27, 0x1c, 0x0f, 0x04, 0x05, 0xfe, 0x0d, 0x9c, 0x9a, 0x98, 0x94, 0x87, 0x87, 0x87, 0x9a, 0xa2, 0x0f, 0x7e, 0x7c, 0x71, 0x78, 0x7b, 0x75, 0x75, 0x7b, 0x78, 0x16, 0x65, 0x8f, 0x8b, 0x89, 0x84, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x57, 0x00, 0xfc, 0x00, 0x58, 0x5a, 0x68, 0x7a, 0x15, 0x7b, 0x15, 0x65, 0x5a, 0xfc, 0x00, 0x84, 0x84, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x85, 0x03, 0xfa, 0x4a, 0xed, 0x01, 0x01, 0x01, 0x83, 0xf3, 0x83, 0x01, 0x83, 0x01, 0xf4, 0xff, 0xf3, 0x54, 0x56, 0x80, 0x60, 0x5e, 0x61, 0x61, 0x63, 0x62, 0x61, 0x66, 0x6d, 0x6d, 0x6c, 0x75, 0x75, 0x76, 0x70, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76, 0x75, 0x7b, 0x78, 0x77, 0x7d, 0x1e, 0x1e, 0x15, 0x1e, 0x1e, 0x1b, 0x17, 0x48, 0x53, 0x56, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x56, 0x01, 0x01, 0xf4, 0xff, 0x01, 0xf4, 0xd7, 0xa6, 0x9d, 0xa6, 0xa7, 0xa0, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa4, 0xa2, 0xa8, 0xa3, 0xa3, 0xa5, 0xa5, 0x88, 0xa6, 0xfd, 0x0b, 0x25, 0x47, 0x44, 0x3f, 0x44, 0x46, 0x3f, 0x43, 0x46, 0x3f, 0x43, 0x46, 0x43, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3f, 0x46, 0x3f, 0x43, 0x3f, 0x43, 0x46, 0x39, 0x44, 0x44, 0x44, 0x34, 0x34, 0x38, 0x33, 0x33, 0x31, 0x31, 0x3a, 0x3a, 0x27, 0x1d, 0x2a, 0x0f, 0x05, 0xf7, 0xf7, 0x96, 0x9a, 0x87, 0x87, 0x9e, 0x9f, 0x0d, 0x14, 0x7a, 0x77, 0x75, 0x78, 0x7b, 0x75, 0x7b, 0x78, 0x16, 0x08, 0xfd, 0x9f, 0x9d, 0x91, 0x8c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x57, 0x57, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfc, 0x00, 0x58, 0x59, 0x5f, 0x7a, 0x7b, 0x15, 0x17, 0x10, 0x5f, 0x00, 0xfc, 0x84, 0x84, 0x84, 0x57, 0xfc, 0x57, 0x00, 0x84, 0x84, 0x00, 0x00, 0x8a, 0xf7, 0x30, 0xe3, 0x01, 0x01, 0x01, 0x83, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x55, 0x55, 0x81, 0x60, 0x5e, 0x60, 0x61, 0x63, 0x62, 0x62, 0x66, 0x6d, 0x74, 0x74, 0x76, 0x75, 0x70, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76, 0x75, 0x75, 0x7b, 0x7b, 0x7d, 0x26, 0x1a, 0x15, 0x1a, 0x19, 0x17, 0x17, 0x18, 0x81, 0x54, 0x56, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xc7, 0xa6, 0xa0, 0xa6, 0xa9, 0xa4, 0xa7, 0xa6, 0xa1, 0xa3, 0xa3, 0xa5, 0xa4, 0xa3, 0xa4, 0xa1, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa8, 0xa2, 0xa8, 0xa3, 0xa5, 0xa5, 0xa5, 0xab, 0xf8, 0x08, 0x2c, 0x45, 0x44, 0x44, 0x44, 0x3f, 0x46, 0x44, 0x44, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x43, 0x46, 0x43, 0x3f, 0x44, 0x3f, 0x41, 0x44, 0x46, 0x46, 0x43, 0x43, 0x44, 0x45, 0x38, 0x33, 0x38, 0x34, 0x34, 0x34, 0x34, 0x34, 0x29, 0x3b, 0x40, 0x3a, 0x49, 0x2e, 0x1d, 0x12, 0x08, 0x06, 0xf7, 0x98, 0x9a, 0x9a, 0xf9, 0x13, 0x14, 0x7a, 0x78, 0x78, 0x7b, 0x75, 0x7b, 0x7b, 0x7a, 0x7c, 0x08, 0x06, 0x9f, 0xa0, 0x9f, 0xf8, 0xf7, 0x91, 0x8e, 0x85, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x58, 0x58, 0x57, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x58, 0x59, 0x5b, 0x0c, 0x1a, 0x71, 0x15, 0x20, 0x68, 0x57, 0x00, 0x84, 0x84, 0x84, 0xfc, 0x00, 0xfc, 0x00, 0x84, 0x84, 0x84, 0x57, 0x57, 0x00, 0x57, 0x8c, 0xf5, 0xc7, 0x01, 0x01, 0x01, 0x56, 0xed, 0xf0, 0x56, 0x56, 0x4c, 0x60, 0x5e, 0x60, 0x61, 0x61, 0x61, 0x62, 0x62, 0x6d, 0x77, 0x6f, 0x78, 0x75, 0x76, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x78, 0x78, 0x7b, 0x7b, 0x19, 0x7d, 0x1f, 0x1a, 0x26, 0x26, 0x1b, 0x7c, 0x21, 0x2e, 0x52, 0x55, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x56, 0x01, 0x56, 0xf4, 0x01, 0xf3, 0x01, 0xf2, 0x01, 0xda, 0xae, 0x9d, 0xa2, 0xa6, 0xa0, 0xa4, 0xa7, 0xa4, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa5, 0xa5, 0xa1, 0xfd, 0x0a, 0x21, 0x40, 0x43, 0x43, 0x43, 0x44, 0x46, 0x44, 0x3f, 0x43, 0x44, 0x46, 0x3f, 0x43, 0x46, 0x43, 0x46, 0x43, 0x43, 0x46, 0x41, 0x41, 0x41, 0x44, 0x46, 0x43, 0x43, 0x45, 0x47, 0x2b, 0x2b, 0x32, 0x31, 0x31, 0x38, 0x34, 0x34, 0x43, 0x39, 0x2d, 0x35, 0x2f, 0x29, 0x31, 0x49, 0x42, 0x2e, 0x27, 0x0f, 0x09, 0xfd, 0xfd, 0x0a, 0x1c, 0x16, 0x7a, 0x75, 0x75, 0x7b, 0x7b, 0x7b, 0x7b, 0x78, 0x16, 0x08, 0xfd, 0x9b, 0x99, 0x9a, 0x9d, 0xa0, 0xa4, 0xa1, 0x9d, 0x95, 0x8b, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x58, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x86, 0x57, 0x00, 0x00, 0x58, 0x59, 0x64, 0x17, 0x1a, 0x15, 0x1b, 0x18, 0x5c, 0x57, 0x00, 0x84, 0x84, 0x84, 0x00, 0x00, 0x57, 0x84, 0x84, 0x00, 0x00, 0x00, 0x57, 0x57, 0x00, 0x00, 0x57, 0x93, 0x30, 0xdb, 0x01, 0x56, 0x56, 0x01, 0x4c, 0x60, 0x5e, 0x61, 0x61, 0x61, 0x61, 0x61, 0x63, 0x74, 0x74, 0x77, 0x78, 0x73, 0x75, 0x75, 0x76, 0x70, 0x78, 0x76, 0x78, 0x76, 0x76, 0x78, 0x75, 0x78, 0x7b, 0x7b, 0x23, 0x19, 0x7d, 0x1a, 0x1f, 0x41, 0x51, 0x51, 0x51, 0x53, 0x53, 0x55, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf0, 0x01, 0xf2, 0x01, 0x01, 0xd7, 0xb7, 0x9c, 0xa0, 0xa8, 0xa2, 0xa4, 0xa8, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa3, 0xa3, 0xf9, 0x0b, 0x25, 0x40, 0x45, 0x43, 0x43, 0x46, 0x44, 0x46, 0x44, 0x46, 0x44, 0x3f, 0x44, 0x46, 0x3f, 0x46, 0x46, 0x46, 0x43, 0x43, 0x44, 0x44, 0x41, 0x44, 0x44, 0x46, 0x43, 0x45, 0x47, 0x21, 0x0e, 0x0e, 0x14, 0x1d, 0x2c, 0x36, 0x31, 0x34, 0x34, 0x34, 0x39, 0x39, 0x39, 0x39, 0x3e, 0x28, 0x33, 0x3b, 0x40, 0x3a, 0x2e, 0x27, 0x1d, 0x1d, 0x25, 0x10, 0x71, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a, 0x7c, 0x06, 0xf7, 0x9d, 0x87, 0x87, 0x87, 0x87, 0x95, 0x9a, 0x9e, 0xa5, 0xa1, 0x98, 0x90, 0x8d, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x57, 0x57, 0x00, 0x00, 0x57, 0x57, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x57, 0x58, 0x5b, 0x17, 0x15, 0x15, 0x15, 0x1b, 0x65, 0x59, 0x57, 0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xfa, 0x4a, 0xed, 0x82, 0x5f, 0x5e, 0x61, 0x61, 0x61, 0x61, 0x61, 0x66, 0x6d, 0x74, 0x6d, 0x73, 0x73, 0x73, 0x75, 0x76, 0x75, 0x76, 0x78, 0x76, 0x76, 0x78, 0x78, 0x75, 0x78, 0x7b, 0x75, 0x19, 0x23, 0x1f, 0x19, 0x22, 0x1b, 0x3e, 0x4f, 0x53, 0x53, 0x54, 0x54, 0x56, 0xf2, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0xf4, 0x01, 0xe3, 0xfb, 0xa0, 0xa2, 0xa2, 0xa1, 0xa2, 0xa7, 0xa3, 0xa3, 0xa3, 0xa7, 0xa1, 0xa3, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa4, 0xa7, 0xa4, 0xa4, 0xa1, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xf9, 0x0b, 0x1d, 0x40, 0x45, 0x44, 0x3f, 0x46, 0x46, 0x46, 0x44, 0x46, 0x46, 0x3f, 0x46, 0x44, 0x46, 0x46, 0x44, 0x46, 0x46, 0x43, 0x43, 0x46, 0x3f, 0x44, 0x3e, 0x46, 0x46, 0x44, 0x45, 0x37, 0x0b, 0x06, 0xf8, 0xfd, 0x09, 0x08, 0x12, 0x21, 0x2c, 0x31, 0x38, 0x3c, 0x34, 0x34, 0x39, 0x34, 0x3e, 0x3c, 0x35, 0x35, 0x33, 0x3b, 0x40, 0x40, 0x36, 0x31, 0x17, 0x15, 0x15, 0x7b, 0x15, 0x7b, 0x15, 0x7b, 0x7a, 0x11, 0x07, 0xf7, 0x9e, 0x87, 0x87, 0x87, 0x87, 0x9e, 0x87, 0x98, 0x87, 0x87, 0x9e, 0x9e, 0x9a, 0x95, 0x8f, 0x8b, 0x89, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x57, 0x84, 0x57, 0x00, 0x84, 0x00, 0x00, 0xfc, 0x00, 0x84, 0x57, 0x5a, 0x68, 0x22, 0x15, 0x15, 0x1e, 0x11, 0x5a, 0x57, 0x84, 0x85, 0x84, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x59, 0xfd, 0xf8, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x63, 0x66, 0x6c, 0x74, 0x70, 0x75, 0x70, 0x6f, 0x78, 0x76, 0x75, 0x76, 0x75, 0x76, 0x78, 0x78, 0x78, 0x78, 0x78, 0x75, 0x7b, 0x7b, 0x1e, 0x23, 0x19, 0x1f, 0x26, 0x1a, 0x2b, 0x4f, 0x54, 0x54, 0x55, 0x55, 0xf3, 0x83, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf6, 0x9d, 0xa2, 0xa3, 0xa2, 0xa3, 0xa6, 0xa3, 0xa7, 0xa3, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa4, 0xa3, 0xa4, 0xa9, 0xa5, 0xa5, 0x88, 0xa4, 0xa2, 0x07, 0x1d, 0x45, 0x45, 0x3c, 0x44, 0x41, 0x3e, 0x3f, 0x46, 0x46, 0x46, 0x46, 0x46, 0x44, 0x46, 0x44, 0x44, 0x46, 0x44, 0x46, 0x46, 0x46, 0x46, 0x44, 0x46, 0x43, 0x44, 0x43, 0x47, 0x32, 0x12, 0xfd, 0xa4, 0xa6, 0xa6, 0xf8, 0xf8, 0xfd, 0x09, 0x0e, 0x12, 0x21, 0x32, 0x40, 0x3b, 0x38, 0x35, 0x3c, 0x3c, 0x39, 0x34, 0x39, 0x3e, 0x3e, 0x35, 0x3e, 0x41, 0x2f, 0x28, 0x28, 0x15, 0x15, 0x15, 0x71, 0x7b, 0x18, 0x16, 0x06, 0xfd, 0x9a, 0x87, 0x87, 0x87, 0x87, 0x87, 0x9a, 0x87, 0x9a, 0x87, 0x87, 0x87, 0x9a, 0x9a, 0x9d, 0x9b, 0x95, 0x8f, 0x8a, 0x85, 0x00, 0x00, 0x00, 0x84, 0x85, 0x00, 0x00, 0x00, 0x00, 0x84, 0x57, 0x84, 0x00, 0xfc, 0xfc, 0x00, 0x84, 0x84, 0x00, 0x02, 0x5f, 0x20, 0x15, 0x15, 0x1a, 0x18, 0x5f, 0x58, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x5b, 0x5c, 0x67, 0x61, 0x5e, 0x61, 0x66, 0x6c, 0x70, 0x70, 0x70, 0x75, 0x75, 0x74, 0x70, 0x70, 0x76, 0x75, 0x76, 0x78, 0x78, 0x76, 0x78, 0x78, 0x78, 0x7b, 0x7b, 0x1f, 0x1f, 0x23, 0x1f, 0x19, 0x22, 0x15, 0x2b, 0x51, 0x54, 0x55, 0x56, 0xff, 0xf4, 0xf2, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x83, 0x01, 0xf4, 0x56, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xba, 0x9f, 0x9f, 0xab, 0xa2, 0xa1, 0xa4, 0xa3, 0xa4, 0xa7, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa6, 0xa4, 0xa7, 0xa4, 0xa4, 0xa9, 0xa4, 0xa1, 0xa6, 0xf8, 0x08, 0x1d, 0x47, 0x45, 0x43, 0x43, 0x3f, 0x41, 0x41, 0x46, 0x46, 0x46, 0x3f, 0x46, 0x3f, 0x46, 0x44, 0x46, 0x44, 0x44, 0x46, 0x44, 0x46, 0x44, 0x46, 0x46, 0x43, 0x46, 0x44, 0x47, 0x42, 0x12, 0x06, 0xa6, 0x88, 0x9e, 0xa2, 0xa8, 0xaa, 0xa6, 0xf8, 0xf8, 0x09, 0x0a, 0x0b, 0x12, 0x1d, 0x2c, 0x42, 0x31, 0x3b, 0x3c, 0x3c, 0x39, 0x39, 0x39, 0x39, 0x3e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x35, 0x23, 0x1a, 0x15, 0x10, 0x0c, 0x07, 0x06, 0x9b, 0x9a, 0x87, 0x87, 0x87, 0x9a, 0x9a, 0x98, 0x87, 0x98, 0x87, 0x9a, 0x87, 0x97, 0x87, 0x9d, 0x9e, 0xa0, 0x9d, 0x95, 0x8f, 0x8a, 0x85, 0x00, 0x00, 0x84, 0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x84, 0x84, 0x00, 0x58, 0x5d, 0x17, 0x1a, 0x15, 0x1e, 0x20, 0x68, 0x59, 0x00, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xfc, 0x57, 0x00, 0x00, 0x58, 0x59, 0x5e, 0x5f, 0x67, 0x62, 0x66, 0x6d, 0x78, 0x75, 0x75, 0x70, 0x6c, 0x74, 0x74, 0x76, 0x75, 0x76, 0x75, 0x76, 0x78, 0x78, 0x78, 0x78, 0x7b, 0x7b, 0x19, 0x1f, 0x1f, 0x23, 0x1e, 0x1f, 0x23, 0x22, 0x2b, 0x50, 0x54, 0x01, 0xf4, 0xf4, 0xf4, 0xf2, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf4, 0x01, 0xf0, 0x01, 0xc3, 0xae, 0x9b, 0xa7, 0xaa, 0xa3, 0xa1, 0xa3, 0xa1, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa6, 0xa0, 0xa6, 0xf5, 0xfd, 0x0b, 0x2e, 0x42, 0x45, 0x43, 0x43, 0x44, 0x44, 0x3b, 0x3c, 0x46, 0x46, 0x43, 0x46, 0x46, 0x46, 0x46, 0x46, 0x44, 0x44, 0x46, 0x44, 0x44, 0x3f, 0x44, 0x43, 0x3f, 0x43, 0x45, 0x47, 0x42, 0x12, 0xfd, 0xf8, 0x88, 0x88, 0xa1, 0xa8, 0xa2, 0xa3, 0xa4, 0xa5, 0xa9, 0xa1, 0xa2, 0xf8, 0xfd, 0x09, 0x0d, 0x12, 0x25, 0x32, 0x36, 0x45, 0x41, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3f, 0x3f, 0x3f, 0x3e, 0x3c, 0x41, 0x3b, 0x29, 0x10, 0x65, 0x04, 0x06, 0xf7, 0xf7, 0x9b, 0x9d, 0xf7, 0x9c, 0x9d, 0x9b, 0x9a, 0x9a, 0x87, 0x9a, 0x87, 0x87, 0x9a, 0x9a, 0x96, 0x9a, 0x9a, 0x9d, 0x9a, 0x93, 0x8e, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x85, 0x86, 0x85, 0x84, 0x00, 0xfc, 0x57, 0x84, 0x85, 0x85, 0x57, 0x5a, 0x0c, 0x22, 0x15, 0x1a, 0x22, 0x10, 0x5b, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x57, 0x57, 0x57, 0x59, 0x59, 0x5e, 0x6a, 0x79, 0x6e, 0x6d, 0x6b, 0x78, 0x78, 0x76, 0x74, 0x6c, 0x74, 0x75, 0x76, 0x76, 0x78, 0x78, 0x76, 0x7b, 0x78, 0x7b, 0x19, 0x1f, 0x1f, 0x23, 0x1e, 0x1f, 0x1e, 0x22, 0x1a, 0x2b, 0x51, 0x55, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf4, 0x56, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf4, 0x01, 0xf4, 0x01, 0xd7, 0xb2, 0x9f, 0xa0, 0xa7, 0xa4, 0xa1, 0xa9, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa6, 0x09, 0x08, 0x12, 0x32, 0x40, 0x3b, 0x3f, 0x3c, 0x44, 0x44, 0x44, 0x3f, 0x44, 0x46, 0x46, 0x46, 0x43, 0x46, 0x46, 0x46, 0x46, 0x44, 0x46, 0x44, 0x44, 0x44, 0x41, 0x44, 0x44, 0x3f, 0x45, 0x47, 0x37, 0x1d, 0xf9, 0xf8, 0xa9, 0xa5, 0xa1, 0xa9, 0xa8, 0xa8, 0xa8, 0xa5, 0xa5, 0xa5, 0xa5, 0x88, 0xab, 0xab, 0xa6, 0xf8, 0x9f, 0x0b, 0x0b, 0x1d, 0x25, 0x32, 0x40, 0x3b, 0x3b, 0x35, 0x33, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f, 0x3e, 0x3c, 0x41, 0x47, 0x47, 0x40, 0x2c, 0x0c, 0x07, 0x04, 0x06, 0x06, 0x06, 0xfd, 0xfd, 0x9f, 0x9d, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x98, 0x9a, 0x9a, 0x9e, 0xa0, 0x9e, 0x93, 0x8e, 0x8a, 0x84, 0x00, 0x00, 0x84, 0x85, 0x57, 0xfc, 0xfc, 0x84, 0x84, 0x85, 0x00, 0x5a, 0x64, 0x26, 0x15, 0x1e, 0x1a, 0x18, 0x5f, 0x00, 0x00, 0x84, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x57, 0x57, 0x58, 0x57, 0x59, 0x57, 0x57, 0x59, 0x60, 0x6a, 0x79, 0x79, 0x6e, 0x6b, 0x77, 0x76, 0x6d, 0x70, 0x76, 0x73, 0x76, 0x78, 0x78, 0x78, 0x78, 0x7b, 0x7b, 0x19, 0x1f, 0x1f, 0x1f, 0x1e, 0x23, 0x1e, 0x23, 0x22, 0x31, 0x52, 0x55, 0x01, 0xf4, 0xff, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0xff, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0xf3, 0x01, 0xf3, 0x01, 0xed, 0xb8, 0x9b, 0xa0, 0xa7, 0xa1, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa4, 0xf9, 0x09, 0x1d, 0x36, 0x45, 0x44, 0x44, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x43, 0x43, 0x46, 0x43, 0x46, 0x43, 0x46, 0x46, 0x46, 0x44, 0x44, 0x44, 0x44, 0x3f, 0x44, 0x41, 0x44, 0x45, 0x45, 0x42, 0x1d, 0xf8, 0xa2, 0x88, 0xa1, 0xa1, 0xf9, 0xa8, 0xa2, 0xa4, 0xa5, 0xa9, 0xa5, 0xa5, 0xa9, 0x88, 0xa7, 0xa3, 0xa3, 0xa8, 0xaa, 0xf8, 0xf9, 0x09, 0x0b, 0x12, 0x1d, 0x2c, 0x32, 0x36, 0x3b, 0x3b, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3e, 0x39, 0x3e, 0x35, 0x41, 0x40, 0x49, 0x42, 0x21, 0x11, 0x65, 0x06, 0x05, 0x05, 0x05, 0xf7, 0xf7, 0x9d, 0x9b, 0x9a, 0x98, 0x98, 0x9a, 0x9a, 0x9a, 0x9a, 0x98, 0x9a, 0x9b, 0x9a, 0x9b, 0xa0, 0xa0, 0x99, 0x93, 0x8e, 0x89, 0x85, 0x00, 0x00, 0x57, 0xfc, 0x84, 0x85, 0x85, 0x00, 0x02, 0x5f, 0x17, 0x22, 0x15, 0x1a, 0x1b, 0x64, 0x58, 0x00, 0x84, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x86, 0x59, 0x57, 0x57, 0x5a, 0x5f, 0x6a, 0x72, 0x7c, 0x6e, 0x6f, 0x7b, 0x78, 0x75, 0x76, 0x78, 0x76, 0x78, 0x78, 0x7b, 0x7b, 0x19, 0x1f, 0x1f, 0x1f, 0x1e, 0x1f, 0x1f, 0x1e, 0x23, 0x22, 0x31, 0x51, 0x56, 0xf4, 0xf4, 0x56, 0x56, 0x56, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x83, 0xf3, 0xf3, 0xf0, 0x01, 0xf4, 0xf4, 0x01, 0xee, 0xbb, 0xab, 0x9d, 0xa4, 0xa1, 0xa4, 0xa4, 0xa4, 0xa7, 0xa3, 0xa4, 0xa4, 0xa7, 0xa4, 0xa6, 0xa6, 0xa8, 0xf9, 0x0a, 0x27, 0x42, 0x45, 0x43, 0x43, 0x46, 0x41, 0x41, 0x3b, 0x41, 0x43, 0x43, 0x43, 0x43, 0x43, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x44, 0x46, 0x44, 0x44, 0x44, 0x41, 0x44, 0x45, 0x45, 0x42, 0x25, 0x09, 0xa2, 0xa5, 0xa5, 0xa5, 0xa2, 0xf9, 0xa8, 0xa4, 0xa5, 0xa5, 0xa7, 0xa9, 0xa5, 0xa3, 0xa3, 0xa9, 0xa8, 0xa8, 0xa8, 0xa4, 0xa7, 0xa4, 0xa6, 0xf9, 0x09, 0x0b, 0x0e, 0x12, 0x25, 0x36, 0x40, 0x41, 0x41, 0x34, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f, 0x39, 0x3c, 0x3e, 0x38, 0x3b, 0x40, 0x40, 0x36, 0x25, 0x12, 0x0b, 0x06, 0x05, 0x05, 0xf7, 0x9b, 0x9b, 0x99, 0x98, 0x98, 0x9a, 0x9a, 0x98, 0x87, 0x9a, 0x87, 0x9a, 0x9a, 0x99, 0x9b, 0x9d, 0xa0, 0x9d, 0x9b, 0x93, 0x8e, 0x8a, 0x00, 0x00, 0x00, 0x84, 0x85, 0x00, 0x59, 0x5c, 0x17, 0x1f, 0x15, 0x23, 0x1b, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x57, 0xfc, 0xfc, 0x57, 0x00, 0x84, 0x57, 0x59, 0x57, 0x5a, 0x5f, 0x6a, 0x7c, 0x7a, 0x6f, 0x73, 0x76, 0x76, 0x76, 0x78, 0x78, 0x78, 0x78, 0x19, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1f, 0x1e, 0x23, 0x22, 0x31, 0x52, 0x55, 0xf4, 0xf4, 0x56, 0x56, 0x55, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xcb, 0xfa, 0x9b, 0x9f, 0xa7, 0xa9, 0xa8, 0xa3, 0xa3, 0xa7, 0xa5, 0xa5, 0xa4, 0xa6, 0x09, 0x0b, 0x12, 0x2e, 0x40, 0x45, 0x45, 0x44, 0x46, 0x3f, 0x41, 0x41, 0x41, 0x41, 0x46, 0x43, 0x43, 0x46, 0x44, 0x46, 0x44, 0x46, 0x44, 0x46, 0x44, 0x46, 0x44, 0x43, 0x3f, 0x43, 0x43, 0x38, 0x40, 0x42, 0x27, 0x0a, 0xf8, 0xa4, 0xa5, 0xa5, 0xa7, 0xa3, 0xa8, 0xa6, 0x88, 0xa4, 0xa5, 0xa5, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa8, 0xa5, 0xa8, 0xa7, 0xa4, 0xa6, 0xa6, 0xa8, 0xaa, 0xf9, 0xf9, 0x0a, 0x0d, 0x12, 0x12, 0x2e, 0x37, 0x40, 0x41, 0x41, 0x3f, 0x3f, 0x39, 0x3f, 0x46, 0x3f, 0x3c, 0x35, 0x41, 0x3b, 0x3b, 0x40, 0x40, 0x31, 0x2c, 0x11, 0x0b, 0x04, 0x05, 0x05, 0xf7, 0x9f, 0x9d, 0x99, 0x9e, 0x87, 0x87, 0x97, 0x9a, 0x9c, 0x9e, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x87, 0x9a, 0x87, 0x96, 0x91, 0x8e, 0x85, 0x84, 0x84, 0x84, 0x57, 0x5b, 0x0c, 0x22, 0x22, 0x1a, 0x1b, 0x0c, 0x5b, 0xfc, 0x86, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x57, 0x84, 0xfc, 0x57, 0x57, 0x00, 0x84, 0x57, 0x57, 0x57, 0x59, 0x5a, 0x5f, 0x6a, 0x16, 0x79, 0x77, 0x76, 0x7a, 0x7b, 0x78, 0x71, 0x7a, 0x7d, 0x7d, 0x7d, 0x1f, 0x23, 0x23, 0x23, 0x23, 0x1a, 0x23, 0x1f, 0x36, 0x52, 0x56, 0xf4, 0xf4, 0xf4, 0xf4, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xff, 0x01, 0x01, 0xed, 0x30, 0x9f, 0xa2, 0xa1, 0xa0, 0xa8, 0xa6, 0xa4, 0xa7, 0xa2, 0xf8, 0x09, 0x12, 0x25, 0x40, 0x47, 0x44, 0x41, 0x44, 0x41, 0x44, 0x41, 0x3f, 0x41, 0x3f, 0x44, 0x44, 0x44, 0x46, 0x44, 0x46, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3f, 0x3c, 0x43, 0x43, 0x44, 0x38, 0x47, 0x4b, 0x1d, 0xf9, 0xa2, 0xa4, 0xa7, 0xa3, 0xa8, 0xa3, 0xa7, 0xa5, 0xa5, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa8, 0xa8, 0xa8, 0xf5, 0xf5, 0xf9, 0x09, 0x0d, 0x13, 0x25, 0x32, 0x3b, 0x40, 0x41, 0x38, 0x3f, 0x3c, 0x3f, 0x3f, 0x41, 0x41, 0x33, 0x2f, 0x3f, 0x39, 0x44, 0x41, 0x40, 0x2b, 0x2c, 0x12, 0x07, 0x05, 0x03, 0xf7, 0x9f, 0x96, 0x98, 0x9a, 0x9e, 0x9e, 0x9a, 0x97, 0x9e, 0x9e, 0x9a, 0x9a, 0x87, 0x9a, 0x9a, 0x9a, 0x9e, 0x9e, 0x9d, 0x95, 0x91, 0x8b, 0x85, 0x84, 0x59, 0x68, 0x22, 0x23, 0x22, 0x1f, 0x11, 0x5c, 0x00, 0x57, 0x00, 0x00, 0xfc, 0x58, 0x57, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x84, 0x00, 0x57, 0x57, 0x57, 0x57, 0x57, 0x00, 0x57, 0x58, 0x58, 0x57, 0x59, 0x5a, 0x5d, 0x72, 0x79, 0x7c, 0x6e, 0x6b, 0x71, 0x7d, 0x7d, 0x7d, 0x7c, 0x1b, 0x7d, 0x26, 0x1b, 0x1f, 0x26, 0x1e, 0x26, 0x20, 0x3a, 0x52, 0x55, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x56, 0x01, 0x56, 0x56, 0x01, 0x56, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0x01, 0x01, 0xdb, 0xa6, 0xa2, 0xa0, 0xa2, 0xa2, 0xf9, 0xf9, 0x0b, 0x0e, 0x25, 0x36, 0x40, 0x47, 0x44, 0x46, 0x46, 0x44, 0x43, 0x44, 0x44, 0x43, 0x44, 0x43, 0x46, 0x43, 0x46, 0x46, 0x43, 0x44, 0x46, 0x44, 0x44, 0x44, 0x3f, 0x41, 0x3f, 0x44, 0x45, 0x44, 0x45, 0x47, 0x42, 0x1d, 0xfd, 0xf8, 0xab, 0x9e, 0xa7, 0xa3, 0xa8, 0xa8, 0xa5, 0xa5, 0xa5, 0xa7, 0xa3, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa8, 0xad, 0xf5, 0xaa, 0xf9, 0x0a, 0x0a, 0x09, 0x0f, 0x13, 0x25, 0x2e, 0x36, 0x40, 0x45, 0x38, 0x38, 0x34, 0x39, 0x46, 0x3f, 0x33, 0x3e, 0x3b, 0x35, 0x3e, 0x41, 0x47, 0x47, 0x42, 0x2c, 0x1d, 0x07, 0x04, 0xf7, 0xf7, 0x99, 0x99, 0x9a, 0x9a, 0x87, 0x87, 0x9a, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c, 0x9a, 0x9a, 0x9a, 0x9f, 0x9f, 0x9f, 0x9d, 0x98, 0x8f, 0x8c, 0x68, 0x17, 0x15, 0x1e, 0x1b, 0x18, 0x5d, 0x57, 0x84, 0x85, 0x00, 0x00, 0x00, 0x00, 0x57, 0x84, 0x57, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x57, 0x84, 0x57, 0x84, 0x00, 0x84, 0x84, 0x84, 0x00, 0x00, 0x57, 0x57, 0x57, 0x00, 0x00, 0x59, 0x5d, 0x6a, 0x7c, 0x24, 0x78, 0x6b, 0x78, 0x7b, 0x17, 0x7a, 0x10, 0x11, 0x11, 0x16, 0x16, 0x18, 0x20, 0x18, 0x3a, 0x53, 0x55, 0x56, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0xbd, 0xfa, 0xa2, 0xf9, 0x0a, 0x12, 0x25, 0x32, 0x45, 0x47, 0x45, 0x41, 0x3f, 0x44, 0x46, 0x46, 0x46, 0x46, 0x43, 0x46, 0x43, 0x43, 0x46, 0x43, 0x43, 0x46, 0x43, 0x44, 0x43, 0x44, 0x46, 0x44, 0x3f, 0x3f, 0x45, 0x45, 0x3b, 0x3b, 0x40, 0x37, 0x12, 0xfd, 0xf9, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa8, 0xa3, 0xa7, 0xa5, 0xa5, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa5, 0x88, 0xa5, 0x88, 0xa7, 0xa9, 0xae, 0xae, 0xf5, 0xb2, 0xf5, 0xaa, 0xf9, 0xf9, 0x0a, 0x0f, 0x1d, 0x27, 0x32, 0x40, 0x3b, 0x38, 0x3f, 0x39, 0x35, 0x33, 0x3b, 0x3e, 0x3e, 0x34, 0x34, 0x34, 0x3c, 0x3b, 0x40, 0x40, 0x37, 0x2e, 0x0e, 0x08, 0x07, 0x06, 0xf7, 0xf7, 0x9b, 0x9a, 0x9a, 0x9e, 0x9b, 0x9d, 0x9c, 0x9b, 0x9a, 0x9a, 0x99, 0x9c, 0xf7, 0xf7, 0x9f, 0xa0, 0x9d, 0x05, 0x0f, 0x20, 0x22, 0x15, 0x1a, 0x18, 0x5f, 0xfc, 0x00, 0x84, 0x85, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x57, 0x84, 0x00, 0x84, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x00, 0x00, 0x58, 0x58, 0x59, 0xfc, 0x00, 0x5a, 0x5f, 0x6a, 0x79, 0x7d, 0x6f, 0x71, 0x7b, 0x10, 0x0e, 0x0e, 0x0d, 0x0b, 0x0f, 0x0e, 0x11, 0x11, 0x48, 0x53, 0x54, 0x56, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x83, 0xe8, 0xc7, 0x30, 0x27, 0x2e, 0x40, 0x45, 0x43, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46, 0x44, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x43, 0x44, 0x44, 0x3f, 0x44, 0x43, 0x43, 0x43, 0x43, 0x44, 0x3b, 0x47, 0x42, 0x3a, 0x37, 0x0f, 0xf9, 0xf9, 0x88, 0xa5, 0xa5, 0x88, 0xa5, 0xa3, 0xa8, 0xa8, 0xa4, 0xa7, 0xa5, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa5, 0x88, 0xa5, 0x88, 0xa5, 0x88, 0x88, 0xaf, 0xac, 0xa9, 0xab, 0xaa, 0xaa, 0xaf, 0x88, 0x88, 0xa6, 0xaa, 0xf9, 0x0f, 0x12, 0x25, 0x2c, 0x40, 0x3b, 0x38, 0x35, 0x3e, 0x3e, 0x35, 0x3e, 0x3f, 0x39, 0x39, 0x39, 0x3f, 0x3c, 0x45, 0x38, 0x3b, 0x45, 0x32, 0x21, 0x0e, 0x68, 0x06, 0x05, 0xf7, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x87, 0x87, 0x9a, 0x9c, 0x9c, 0xfd, 0x9c, 0x9b, 0x9d, 0xf7, 0x14, 0x2c, 0x26, 0x28, 0x1b, 0x20, 0x06, 0x5c, 0x8a, 0x89, 0x84, 0x00, 0x00, 0x00, 0xfc, 0x57, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x00, 0x84, 0xfc, 0x84, 0x00, 0xfc, 0x57, 0x59, 0x5a, 0x64, 0x6e, 0x7d, 0x17, 0x10, 0x18, 0x14, 0x0f, 0xf5, 0xf5, 0xf9, 0x09, 0x08, 0x08, 0x3d, 0x54, 0x55, 0x56, 0x01, 0x01, 0x56, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x53, 0x4e, 0x42, 0x40, 0x45, 0x43, 0x46, 0x46, 0x46, 0x44, 0x41, 0x44, 0x44, 0x44, 0x3f, 0x44, 0x3f, 0x44, 0x3f, 0x44, 0x3f, 0x44, 0x3f, 0x41, 0x41, 0x3f, 0x43, 0x43, 0x43, 0x43, 0x45, 0x45, 0x42, 0x3d, 0x1d, 0x0a, 0xfd, 0xa8, 0xa4, 0xa5, 0x88, 0x88, 0x9e, 0xa9, 0xa3, 0xa8, 0xa4, 0xa7, 0xa5, 0xa5, 0xa7, 0xa3, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa5, 0x88, 0xa5, 0x88, 0xaf, 0x88, 0xac, 0x88, 0xad, 0xad, 0x88, 0x88, 0xaf, 0xac, 0xa9, 0xaa, 0xf5, 0x09, 0x0d, 0x0e, 0x14, 0x25, 0x32, 0x40, 0x38, 0x3c, 0x35, 0x34, 0x35, 0x3e, 0x3f, 0x3e, 0x39, 0x34, 0x39, 0x3f, 0x3f, 0x38, 0x38, 0x45, 0x3b, 0x32, 0x21, 0x11, 0x07, 0x06, 0x05, 0x99, 0x98, 0x87, 0x87, 0x87, 0x87, 0x87, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c, 0x9d, 0x05, 0x13, 0x2b, 0x29, 0x2d, 0x29, 0x2c, 0x0b, 0xfd, 0x9a, 0x87, 0x98, 0x8f, 0x8a, 0x57, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x84, 0x57, 0x84, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x00, 0xfc, 0xfc, 0x86, 0x57, 0x57, 0x59, 0x5a, 0x68, 0x0c, 0x16, 0x11, 0x72, 0x13, 0x13, 0xb3, 0xf5, 0xf9, 0xfd, 0x07, 0x80, 0x55, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf3, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0xff, 0xff, 0xff, 0x54, 0x51, 0x4d, 0x31, 0x38, 0x44, 0x46, 0x44, 0x44, 0x41, 0x41, 0x41, 0x41, 0x44, 0x3f, 0x44, 0x3f, 0x46, 0x41, 0x44, 0x41, 0x41, 0x3b, 0x41, 0x3f, 0x43, 0x43, 0x43, 0x45, 0x45, 0x42, 0x2e, 0x0f, 0xf8, 0xf8, 0xa6, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa3, 0xa3, 0xa6, 0xa4, 0xa4, 0xa5, 0xa5, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x88, 0xa5, 0x88, 0x88, 0xaf, 0xac, 0x88, 0xac, 0x88, 0xa7, 0xac, 0xac, 0xb0, 0xaf, 0xad, 0xab, 0xae, 0xaa, 0xf5, 0x0a, 0x0b, 0x0d, 0x0f, 0x1d, 0x31, 0x45, 0x3b, 0x38, 0x35, 0x3c, 0x3e, 0x39, 0x39, 0x3e, 0x39, 0x39, 0x39, 0x3f, 0x39, 0x34, 0x3c, 0x3c, 0x3b, 0x3b, 0x36, 0x25, 0x0e, 0x06, 0x05, 0x93, 0x99, 0x9b, 0x9a, 0x9a, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0x05, 0x12, 0x2b, 0x29, 0x2f, 0x29, 0x2c, 0x07, 0xf7, 0x9e, 0x87, 0x87, 0x87, 0x9f, 0x9d, 0x91, 0x8b, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x57, 0x84, 0x00, 0x84, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x84, 0x57, 0x57, 0x57, 0x84, 0x85, 0x86, 0x58, 0xfc, 0x5f, 0x0b, 0x14, 0x14, 0x79, 0x13, 0xfa, 0xfa, 0xfa, 0x0a, 0xf8, 0x4a, 0xf4, 0xf4, 0xf4, 0xf4, 0x83, 0x01, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x55, 0x55, 0x55, 0x55, 0x53, 0x50, 0x49, 0x42, 0x3b, 0x44, 0x41, 0x45, 0x44, 0x3f, 0x3f, 0x46, 0x46, 0x3f, 0x46, 0x46, 0x44, 0x44, 0x3f, 0x41, 0x3e, 0x41, 0x41, 0x45, 0x3b, 0x40, 0x40, 0x37, 0x12, 0x09, 0xf9, 0xa6, 0xa4, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xa5, 0xa7, 0xa7, 0xa8, 0xa7, 0xa7, 0xa5, 0x88, 0xa5, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa2, 0xae, 0xa8, 0xa3, 0xa9, 0xa9, 0xac, 0xaf, 0x88, 0xac, 0x88, 0xac, 0xac, 0xae, 0xae, 0xae, 0xae, 0xac, 0xac, 0xac, 0xab, 0xab, 0xab, 0xab, 0xf5, 0xf5, 0x0a, 0x0b, 0x12, 0x25, 0x37, 0x40, 0x38, 0x38, 0x34, 0x3c, 0x39, 0x35, 0x3e, 0x35, 0x35, 0x35, 0x35, 0x35, 0x39, 0x34, 0x34, 0x38, 0x3b, 0x36, 0x40, 0x25, 0x11, 0x07, 0x06, 0x05, 0x05, 0x9b, 0x9d, 0x9c, 0x9e, 0x98, 0x99, 0xf7, 0x14, 0x2c, 0x2f, 0x28, 0x26, 0x2c, 0x06, 0xf7, 0x87, 0x87, 0x87, 0x87, 0x9d, 0x9d, 0xa0, 0xa0, 0x9f, 0x96, 0x8f, 0x89, 0x85, 0x00, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x57, 0x00, 0x86, 0x58, 0x86, 0x86, 0x57, 0x00, 0x00, 0x57, 0x57, 0x57, 0x84, 0x57, 0xfc, 0x57, 0x58, 0x57, 0x86, 0x84, 0x85, 0x85, 0x89, 0x00, 0x02, 0x64, 0x14, 0x79, 0x72, 0x13, 0xfb, 0x0a, 0xfa, 0xf9, 0xc3, 0x01, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0x01, 0xf4, 0x83, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x56, 0x56, 0x56, 0x01, 0x56, 0x01, 0x55, 0x54, 0x4b, 0x42, 0x40, 0x38, 0x41, 0x45, 0x44, 0x3f, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3f, 0x3f, 0x3f, 0x41, 0x38, 0x41, 0x3b, 0x40, 0x37, 0x2e, 0x1d, 0x0a, 0x09, 0xfd, 0xa8, 0xa8, 0xab, 0xa3, 0xa8, 0xa7, 0xa8, 0xa7, 0xa8, 0xa8, 0xa7, 0xa8, 0xa4, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa8, 0xa8, 0xa8, 0xa9, 0xa9, 0xab, 0xad, 0xa9, 0xa9, 0xac, 0xac, 0xac, 0xa9, 0xae, 0xae, 0xae, 0xae, 0xab, 0xac, 0xac, 0x88, 0xac, 0xac, 0xae, 0xab, 0xae, 0xaa, 0xb2, 0xf9, 0x0d, 0x0e, 0x25, 0x2c, 0x40, 0x3b, 0x3b, 0x33, 0x33, 0x33, 0x33, 0x35, 0x35, 0x35, 0x39, 0x35, 0x39, 0x3f, 0x35, 0x34, 0x38, 0x3b, 0x45, 0x31, 0x2b, 0x18, 0x0e, 0x07, 0x06, 0x05, 0xf7, 0x9b, 0x9b, 0x99, 0xfd, 0x13, 0x2b, 0x1b, 0x22, 0x2b, 0x1d, 0x06, 0x9b, 0x87, 0x87, 0x87, 0x87, 0x9a, 0x9e, 0x9a, 0x9e, 0x9a, 0xa0, 0xa0, 0x9d, 0x95, 0x8f, 0x8a, 0x85, 0x84, 0x00, 0x00, 0x84, 0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x84, 0x02, 0x86, 0x58, 0x86, 0x57, 0xfc, 0x84, 0x58, 0x57, 0x57, 0x57, 0xfc, 0xfc, 0x86, 0x85, 0x85, 0x85, 0x58, 0x5b, 0x64, 0x16, 0x79, 0x13, 0x13, 0x13, 0x0a, 0x0a, 0xcb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x56, 0x01, 0x01, 0x83, 0x83, 0x83, 0x01, 0x54, 0x51, 0x4d, 0x47, 0x40, 0x38, 0x45, 0x44, 0x44, 0x3f, 0x43, 0x3f, 0x3f, 0x3f, 0x45, 0x45, 0x45, 0x45, 0x40, 0x36, 0x2e, 0x13, 0x0a, 0xf8, 0xa6, 0xa4, 0xa7, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa7, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xae, 0xa8, 0xa8, 0xa6, 0xa8, 0xae, 0xb0, 0xa7, 0xab, 0xab, 0xa9, 0xad, 0xad, 0xae, 0xab, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xae, 0xac, 0xac, 0x88, 0xae, 0xaa, 0x0d, 0x0f, 0x12, 0x1d, 0x2b, 0x36, 0x3b, 0x3b, 0x33, 0x35, 0x34, 0x3e, 0x3e, 0x3e, 0x35, 0x2f, 0x35, 0x35, 0x34, 0x34, 0x3c, 0x3c, 0x3f, 0x45, 0x31, 0x25, 0x12, 0x0b, 0x06, 0x06, 0xf7, 0x05, 0x05, 0x1c, 0x2c, 0x20, 0x26, 0x31, 0x16, 0x06, 0xf7, 0x9a, 0x87, 0x87, 0x9a, 0x9a, 0x9c, 0x87, 0x9a, 0x87, 0x99, 0x9a, 0x9e, 0xa0, 0x9d, 0xa0, 0x96, 0x90, 0x8d, 0x89, 0x84, 0x00, 0x00, 0x84, 0x57, 0x84, 0x58, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x57, 0x84, 0x84, 0x57, 0xfc, 0xfc, 0xfc, 0x86, 0x84, 0x85, 0x58, 0x59, 0x5a, 0x65, 0x14, 0x14, 0x6a, 0x1c, 0x0d, 0x0a, 0x4c, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x56, 0x56, 0xf3, 0xff, 0xff, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x83, 0xf0, 0x83, 0x01, 0x55, 0x55, 0x53, 0x51, 0x4d, 0x40, 0x32, 0x40, 0x45, 0x47, 0x45, 0x3b, 0x47, 0x40, 0x40, 0x36, 0x40, 0x2c, 0x25, 0x12, 0x0b, 0xf8, 0xa2, 0xa1, 0xa5, 0x88, 0xa9, 0xa8, 0xa8, 0xa8, 0xa8, 0xa7, 0xa4, 0xa8, 0xa6, 0xa8, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa5, 0xa8, 0xab, 0xa2, 0xa9, 0xa8, 0xa7, 0xb0, 0xae, 0xab, 0xae, 0xad, 0xae, 0xa9, 0xab, 0xac, 0xab, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xa9, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xab, 0xa6, 0x0a, 0x0d, 0x0f, 0x1d, 0x21, 0x32, 0x40, 0x45, 0x38, 0x38, 0x33, 0x2f, 0x33, 0x35, 0x2f, 0x35, 0x35, 0x35, 0x34, 0x34, 0x34, 0x34, 0x38, 0x3b, 0x36, 0x2c, 0x2c, 0x12, 0x0e, 0x06, 0x07, 0x14, 0x2b, 0x20, 0x26, 0x31, 0x11, 0x06, 0xfd, 0x9c, 0x9a, 0x9a, 0x9b, 0x9a, 0x9d, 0x87, 0x9e, 0x87, 0x9e, 0x9a, 0x9a, 0x9e, 0x9e, 0x9a, 0xa0, 0x9d, 0x9d, 0x99, 0x91, 0x8e, 0x8a, 0x84, 0x84, 0x00, 0x00, 0x84, 0x57, 0x57, 0x58, 0x58, 0x86, 0x86, 0xfc, 0x84, 0x84, 0x84, 0x84, 0xfc, 0xfc, 0xfc, 0x86, 0x86, 0x00, 0x8a, 0x59, 0x00, 0x5b, 0x08, 0x13, 0x0f, 0x72, 0x13, 0x08, 0x80, 0x54, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x83, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0x01, 0x01, 0x01, 0x56, 0x56, 0x55, 0x54, 0x53, 0x50, 0x4b, 0x37, 0x2c, 0x2c, 0x37, 0x37, 0x37, 0x2e, 0x2e, 0x1d, 0x12, 0x0b, 0x09, 0x09, 0xf8, 0xa6, 0x88, 0x88, 0xa5, 0xa5, 0xa5, 0xa7, 0xa8, 0xa8, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa5, 0xa7, 0xa7, 0xa8, 0xa8, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xad, 0xa4, 0xa1, 0xa6, 0xa0, 0xa4, 0xa9, 0xae, 0xb3, 0xb2, 0xb0, 0xab, 0xac, 0xac, 0xac, 0xac, 0xab, 0xac, 0xab, 0xab, 0xab, 0xad, 0xab, 0xab, 0xab, 0xae, 0xac, 0xac, 0x88, 0xaf, 0x88, 0xaf, 0xa6, 0x0a, 0x09, 0x0e, 0x12, 0x21, 0x2b, 0x32, 0x3b, 0x3b, 0x3b, 0x33, 0x33, 0x33, 0x35, 0x35, 0x35, 0x2f, 0x3c, 0x3c, 0x39, 0x38, 0x33, 0x31, 0x33, 0x31, 0x40, 0x36, 0x2c, 0x24, 0x36, 0x36, 0x35, 0x33, 0x2b, 0x0c, 0x04, 0x05, 0x96, 0x9c, 0x9d, 0x9c, 0x9d, 0x9d, 0x9a, 0x87, 0x87, 0x97, 0x87, 0x9e, 0x9e, 0x9e, 0x9e, 0x98, 0x9a, 0xa0, 0xa2, 0xa2, 0xa0, 0x9a, 0x9a, 0x90, 0x8d, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x58, 0x58, 0x58, 0x58, 0x86, 0x59, 0x89, 0x58, 0x86, 0x5c, 0x0d, 0x1c, 0x08, 0x13, 0x72, 0x72, 0x2e, 0x48, 0x51, 0x54, 0x55, 0x55, 0x54, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x56, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x83, 0x83, 0x01, 0x56, 0x56, 0x54, 0x55, 0x56, 0xf4, 0x83, 0xf4, 0x01, 0xff, 0x55, 0x82, 0x80, 0x1c, 0x13, 0x0f, 0x0d, 0x0a, 0xf9, 0xfd, 0x9b, 0x9e, 0xa1, 0xa7, 0xac, 0xa9, 0xa3, 0xa8, 0xa9, 0xa7, 0xa9, 0xa5, 0x88, 0xa5, 0x88, 0xa5, 0xa5, 0xa5, 0xa5, 0xa7, 0xa5, 0xa5, 0x88, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa5, 0x88, 0xac, 0x9e, 0xac, 0xba, 0xb8, 0xb4, 0xab, 0xa2, 0xa4, 0xa7, 0xa9, 0xab, 0xac, 0xad, 0xab, 0xab, 0xab, 0xae, 0xad, 0xab, 0xab, 0xab, 0x88, 0xac, 0xa9, 0xae, 0xae, 0xb0, 0xb0, 0xac, 0x88, 0xa7, 0xa9, 0xad, 0xae, 0xaa, 0xf9, 0xf9, 0x0d, 0x12, 0x1d, 0x2c, 0x32, 0x31, 0x2f, 0x3f, 0x35, 0x34, 0x34, 0x2f, 0x35, 0x2f, 0x2f, 0x33, 0x35, 0x33, 0x34, 0x34, 0x34, 0x38, 0x3b, 0x3b, 0x3b, 0x3f, 0x3e, 0x3e, 0x33, 0x21, 0x0e, 0x0d, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x9d, 0x9a, 0x87, 0x9e, 0x9e, 0x87, 0x87, 0x98, 0x87, 0x98, 0xa1, 0x9d, 0x98, 0x96, 0x9a, 0x9d, 0xa0, 0x9e, 0xa1, 0xa1, 0x9e, 0x95, 0x8f, 0x8c, 0x89, 0x86, 0x00, 0x00, 0x00, 0x84, 0xfc, 0xfc, 0x84, 0x84, 0x85, 0x85, 0x84, 0x57, 0x02, 0xfc, 0x00, 0x89, 0x8a, 0x89, 0xf7, 0xfe, 0x0d, 0x72, 0x79, 0x79, 0x6e, 0x7a, 0x10, 0x16, 0x24, 0x81, 0x82, 0x53, 0x55, 0x55, 0x56, 0x56, 0x56, 0xff, 0x56, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x83, 0x01, 0x83, 0x01, 0x56, 0x55, 0xff, 0x56, 0xff, 0x83, 0xf4, 0x83, 0x83, 0xf4, 0x01, 0x01, 0xff, 0xdb, 0xfb, 0xfa, 0xf5, 0xfa, 0xb2, 0xae, 0xa5, 0x88, 0x88, 0xa5, 0xa1, 0xa7, 0xa8, 0xa8, 0xa8, 0xa3, 0xa7, 0xa7, 0x88, 0xa5, 0xa5, 0x88, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0x88, 0xa5, 0xa7, 0xa7, 0xa8, 0xa8, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa9, 0xa7, 0xa7, 0xa5, 0xa7, 0xba, 0xe7, 0xe2, 0xcc, 0xbc, 0xb8, 0xb1, 0xae, 0xa7, 0xab, 0xac, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0x88, 0xad, 0x88, 0xad, 0xae, 0xab, 0xaa, 0xa9, 0xab, 0xb0, 0xac, 0xad, 0xac, 0xab, 0xab, 0xac, 0xab, 0xf5, 0xf9, 0x0a, 0x0f, 0x12, 0x25, 0x32, 0x31, 0x38, 0x38, 0x38, 0x3c, 0x35, 0x33, 0x35, 0x33, 0x33, 0x2f, 0x34, 0x34, 0x34, 0x34, 0x34, 0x41, 0x34, 0x34, 0x46, 0x35, 0x33, 0x49, 0x36, 0x37, 0x1d, 0x12, 0x07, 0x07, 0x06, 0x05, 0xf7, 0x9b, 0x9a, 0x87, 0x9a, 0x87, 0x9e, 0x87, 0x87, 0x87, 0x9a, 0x9e, 0x9e, 0xa0, 0x9e, 0x9d, 0x9a, 0x9c, 0x9e, 0x9f, 0xa0, 0xa2, 0x9f, 0x9d, 0x93, 0x8f, 0x8a, 0x89, 0x85, 0x84, 0x00, 0x84, 0x84, 0x85, 0x85, 0x84, 0x86, 0xfc, 0x02, 0x89, 0x84, 0x85, 0x8b, 0x8f, 0xf9, 0xfe, 0x6a, 0x14, 0x7c, 0x17, 0x19, 0x19, 0x17, 0x7a, 0x10, 0x72, 0x24, 0x7e, 0x48, 0x4e, 0x50, 0x53, 0x53, 0x55, 0x55, 0x56, 0x56, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0xe8, 0xbc, 0xb5, 0xb3, 0xb1, 0xb1, 0xb1, 0x88, 0xa1, 0xa5, 0x88, 0xa5, 0xa5, 0xa4, 0xa5, 0xa7, 0xa7, 0xa7, 0xa4, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa3, 0xa7, 0xa9, 0xa3, 0xa4, 0xa7, 0xa4, 0xa9, 0xa1, 0xa7, 0xba, 0xd9, 0xd8, 0xd5, 0xd8, 0xdf, 0xda, 0xbf, 0xb9, 0xb5, 0xad, 0xa9, 0xac, 0xac, 0xab, 0xad, 0xad, 0xa9, 0xad, 0xad, 0xad, 0xa9, 0xac, 0xad, 0xac, 0xab, 0xac, 0xad, 0xab, 0xac, 0xac, 0xab, 0xac, 0xac, 0xac, 0xab, 0xab, 0xae, 0xf5, 0xaa, 0xf9, 0x0a, 0x0d, 0x0e, 0x1d, 0x25, 0x32, 0x31, 0x31, 0x33, 0x35, 0x33, 0x2f, 0x35, 0x2f, 0x35, 0x34, 0x34, 0x34, 0x3c, 0x3c, 0x3c, 0x38, 0x35, 0x35, 0x35, 0x35, 0x33, 0x3b, 0x3b, 0x36, 0x36, 0x21, 0x1d, 0x0b, 0x07, 0x06, 0x05, 0x96, 0x99, 0x9a, 0x9e, 0x9e, 0x87, 0x9e, 0x87, 0x9e, 0x9e, 0x9e, 0x9e, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9d, 0xa0, 0xa0, 0xa1, 0x9e, 0x95, 0x90, 0x8d, 0x8a, 0x85, 0x84, 0x84, 0x84, 0x86, 0x86, 0xfc, 0xfc, 0x89, 0xfc, 0x89, 0x8b, 0x8b, 0xf7, 0xfb, 0x0f, 0x72, 0x7c, 0x1b, 0x19, 0x1e, 0x1e, 0x1f, 0x19, 0x1b, 0x7b, 0x17, 0x7a, 0x7a, 0x7d, 0x24, 0x3a, 0x4b, 0x4e, 0x53, 0x55, 0x55, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0x83, 0x83, 0x83, 0x83, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf3, 0xda, 0xbb, 0xb3, 0xb0, 0xb5, 0xb3, 0x88, 0xa5, 0x88, 0xa1, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa2, 0xa0, 0xba, 0xd2, 0xd5, 0xd8, 0xd5, 0xd8, 0xcf, 0xd1, 0xe2, 0xdd, 0xc9, 0xbc, 0xb8, 0xb0, 0xa4, 0xab, 0xad, 0xa9, 0xb3, 0xad, 0xa7, 0xa9, 0xad, 0xad, 0xab, 0xab, 0xad, 0xab, 0xac, 0xad, 0xab, 0xab, 0xa9, 0xac, 0xa9, 0xab, 0xab, 0xab, 0xac, 0xab, 0xa9, 0xae, 0xaa, 0xf5, 0xf5, 0x09, 0x0f, 0x12, 0x1d, 0x2c, 0x2c, 0x36, 0x31, 0x33, 0x31, 0x33, 0x33, 0x35, 0x38, 0x3e, 0x3c, 0x3f, 0x3c, 0x35, 0x34, 0x38, 0x35, 0x38, 0x3c, 0x3c, 0x3c, 0x3b, 0x33, 0x40, 0x36, 0x32, 0x1d, 0x1d, 0x0b, 0x09, 0x06, 0x05, 0xf7, 0xf7, 0x9f, 0xa0, 0x9e, 0x9a, 0x87, 0x9a, 0x87, 0x9e, 0x9a, 0x9e, 0x9e, 0x9c, 0x9e, 0x9a, 0x9e, 0x9d, 0x9a, 0x9b, 0x9e, 0xa1, 0xa1, 0xa0, 0x9d, 0x96, 0x8f, 0x8e, 0x8a, 0x86, 0x84, 0x00, 0x84, 0x84, 0x84, 0x8a, 0x8f, 0x8f, 0x8e, 0x0d, 0x1c, 0x72, 0x16, 0x19, 0x19, 0x1e, 0x1e, 0x23, 0x1a, 0x1f, 0x1a, 0x1e, 0x19, 0x19, 0x17, 0x17, 0x7a, 0x18, 0x18, 0x2c, 0x3d, 0x4e, 0x52, 0x55, 0x55, 0x56, 0x55, 0x56, 0x55, 0xff, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf2, 0x83, 0x83, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xef, 0x01, 0x01, 0xf0, 0xd5, 0xb9, 0xad, 0xb1, 0xb6, 0xb3, 0xa4, 0xa4, 0xa7, 0xa7, 0xa7, 0xa5, 0xa4, 0xa5, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa4, 0xa7, 0xab, 0xa7, 0xa1, 0xa7, 0xa1, 0xb8, 0xd5, 0xdd, 0xd1, 0xda, 0xd1, 0xcf, 0xda, 0xd8, 0xcc, 0xcf, 0xd8, 0xd8, 0xd9, 0xce, 0xba, 0xb1, 0xa4, 0xad, 0xa1, 0xab, 0xb3, 0xb0, 0xa7, 0xa9, 0xad, 0xab, 0xad, 0xab, 0xad, 0xab, 0xad, 0xab, 0xad, 0xab, 0xad, 0xab, 0xad, 0xad, 0x88, 0x88, 0xac, 0x88, 0xac, 0xad, 0xaa, 0xb2, 0xf5, 0x0a, 0x0a, 0x0b, 0x13, 0x1d, 0x2c, 0x32, 0x36, 0x40, 0x31, 0x31, 0x33, 0x38, 0x3c, 0x3c, 0x39, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x33, 0x33, 0x31, 0x36, 0x40, 0x36, 0x37, 0x2c, 0x1d, 0x0e, 0x07, 0x06, 0x05, 0x05, 0xf7, 0x9d, 0x9e, 0xa0, 0x9e, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x9e, 0x9a, 0x9e, 0x9a, 0x9a, 0x9d, 0x9d, 0x9c, 0x9d, 0x9f, 0xa2, 0xf9, 0x9f, 0xf7, 0x93, 0x8e, 0x8b, 0x89, 0x85, 0x84, 0x8d, 0x90, 0x93, 0x8c, 0xf7, 0x2a, 0x72, 0x10, 0x7d, 0x26, 0x1e, 0x1e, 0x15, 0x1a, 0x1f, 0x1f, 0x1e, 0x1a, 0x1a, 0x1f, 0x1f, 0x1f, 0x17, 0x1b, 0x17, 0x18, 0x7c, 0x24, 0x2e, 0x81, 0x50, 0x54, 0x55, 0x55, 0x55, 0x56, 0x56, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x83, 0x83, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf2, 0xf4, 0x01, 0xee, 0xc7, 0xb7, 0xb0, 0xb3, 0xb7, 0xb1, 0xa4, 0xa4, 0xa7, 0xa7, 0xa7, 0x88, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa9, 0xab, 0xa4, 0xa0, 0xa9, 0xa9, 0x9a, 0xb9, 0xd7, 0xde, 0xd2, 0xd2, 0xd1, 0xd8, 0xd5, 0xd5, 0xd2, 0xd2, 0xd5, 0xd5, 0xdc, 0xd2, 0xce, 0xdf, 0xdf, 0xc0, 0xb7, 0xae, 0xab, 0xa6, 0xab, 0xb0, 0xb0, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xac, 0x88, 0x88, 0x88, 0xaf, 0x88, 0x88, 0x88, 0x88, 0xa9, 0xab, 0xaa, 0xaa, 0xf5, 0x0a, 0x0f, 0x12, 0x1d, 0x2e, 0x37, 0x40, 0x32, 0x3b, 0x33, 0x38, 0x3c, 0x39, 0x35, 0x38, 0x38, 0x38, 0x3f, 0x3c, 0x39, 0x3c, 0x39, 0x3e, 0x3e, 0x3b, 0x33, 0x31, 0x33, 0x31, 0x40, 0x40, 0x32, 0x1d, 0x11, 0x07, 0x07, 0xf7, 0x05, 0x9b, 0xf7, 0x9e, 0x9e, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x9e, 0x9e, 0x9e, 0x9c, 0x9e, 0x9f, 0x9c, 0x9c, 0x99, 0x9d, 0xa2, 0xa2, 0x9f, 0x9d, 0x95, 0x90, 0x8e, 0x92, 0x95, 0x95, 0x8f, 0x03, 0x1c, 0x14, 0x79, 0x1b, 0x1f, 0x2f, 0x2f, 0x2f, 0x1f, 0x1f, 0x23, 0x23, 0x1e, 0x23, 0x23, 0x1e, 0x1a, 0x23, 0x23, 0x1f, 0x1e, 0x1a, 0x19, 0x17, 0x17, 0x18, 0x21, 0x3a, 0x4f, 0x53, 0x54, 0x55, 0x56, 0x56, 0xf4, 0xf3, 0xf0, 0x56, 0x56, 0x56, 0x01, 0x83, 0x01, 0x01, 0x83, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf3, 0xf4, 0x01, 0x01, 0xe3, 0xbc, 0xb5, 0xb3, 0xb5, 0xb3, 0xab, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa6, 0xab, 0xa1, 0xab, 0xab, 0x9e, 0xa0, 0xb9, 0xdf, 0xdf, 0xd1, 0xda, 0xda, 0xcf, 0xda, 0xd5, 0xd5, 0xd5, 0xd8, 0xd8, 0xd5, 0xd1, 0xd4, 0xda, 0xd4, 0xd1, 0xd8, 0xe7, 0xdc, 0xbc, 0xb6, 0xae, 0xab, 0xaa, 0xa7, 0xad, 0xab, 0xad, 0xab, 0xad, 0xab, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xab, 0xad, 0x88, 0xac, 0x88, 0xac, 0x88, 0x88, 0x88, 0x88, 0xac, 0xad, 0xad, 0xab, 0xf5, 0xf9, 0x0a, 0x0d, 0x0f, 0x1d, 0x25, 0x2e, 0x32, 0x40, 0x3b, 0x3b, 0x33, 0x38, 0x3f, 0x3c, 0x3f, 0x34, 0x3f, 0x39, 0x3f, 0x39, 0x34, 0x2f, 0x2f, 0x35, 0x3b, 0x3e, 0x35, 0x35, 0x33, 0x31, 0x40, 0x42, 0x37, 0x27, 0x12, 0x0b, 0x07, 0x07, 0x06, 0x99, 0x9a, 0x9d, 0x9d, 0xa0, 0x9e, 0x9d, 0x9e, 0x9e, 0x9e, 0x9a, 0x9e, 0x9e, 0x87, 0x87, 0x87, 0xa1, 0xa0, 0x9a, 0x9a, 0x9a, 0x9d, 0xa0, 0x9a, 0x98, 0x95, 0x92, 0x92, 0x91, 0x8f, 0xf5, 0x14, 0x16, 0x17, 0x7d, 0x23, 0x2f, 0x26, 0x2f, 0x2f, 0x2f, 0x2f, 0x28, 0x2d, 0x28, 0x2d, 0x2d, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1e, 0x1e, 0x1b, 0x1b, 0x18, 0x18, 0x48, 0x4b, 0x50, 0x53, 0x54, 0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x83, 0x01, 0x83, 0x83, 0x83, 0x01, 0x01, 0x56, 0x56, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x83, 0x83, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0xf4, 0x83, 0x83, 0x01, 0x01, 0x56, 0x56, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0xf2, 0xd0, 0xb9, 0xb5, 0xb5, 0xb7, 0xb4, 0xb1, 0xa7, 0xa5, 0xa5, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa4, 0xa9, 0xa6, 0xa4, 0xae, 0xba, 0xd9, 0xdd, 0xd5, 0xda, 0xd5, 0xd5, 0xda, 0xd2, 0xd2, 0xd5, 0xd8, 0xd5, 0xd2, 0xd5, 0xd5, 0xd8, 0xd2, 0xd5, 0xd8, 0xd5, 0xd2, 0xd2, 0xdd, 0xdd, 0xc5, 0xba, 0xb5, 0xb2, 0xa7, 0xab, 0xab, 0xad, 0xab, 0xab, 0xae, 0xab, 0xae, 0xad, 0xab, 0xad, 0xad, 0xae, 0xae, 0xab, 0xab, 0xab, 0xa9, 0xac, 0xaf, 0xac, 0xa9, 0xa9, 0xab, 0xb0, 0xae, 0xae, 0xaa, 0xaa, 0x0a, 0x0a, 0x0d, 0x12, 0x1d, 0x25, 0x32, 0x36, 0x40, 0x40, 0x38, 0x3c, 0x3f, 0x3c, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3c, 0x3c, 0x35, 0x34, 0x35, 0x2f, 0x35, 0x2f, 0x38, 0x33, 0x31, 0x31, 0x40, 0x40, 0x36, 0x32, 0x18, 0x11, 0x0b, 0x07, 0x06, 0x06, 0x06, 0xfd, 0xfd, 0x9f, 0x9f, 0x9e, 0x9a, 0x87, 0x87, 0x9e, 0x87, 0x87, 0x87, 0x87, 0x9e, 0x9e, 0x9a, 0x98, 0x98, 0x95, 0x97, 0x95, 0x92, 0x94, 0x92, 0x90, 0xfd, 0x1c, 0x79, 0x18, 0x1f, 0x1f, 0x1e, 0x1e, 0x23, 0x26, 0x2f, 0x2f, 0x2f, 0x28, 0x23, 0x23, 0x23, 0x28, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2d, 0x23, 0x23, 0x1e, 0x19, 0x1b, 0x7a, 0x16, 0x24, 0x2e, 0x48, 0x4e, 0x52, 0x54, 0x55, 0x55, 0x56, 0x01, 0x83, 0x83, 0x83, 0x83, 0xf4, 0x01, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0xf4, 0x01, 0x56, 0x56, 0x56, 0xf4, 0x01, 0x83, 0x83, 0xf4, 0x01, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0xf3, 0x56, 0x01, 0x56, 0x01, 0xf4, 0x01, 0x01, 0xed, 0xbf, 0xb9, 0xb7, 0xb8, 0xb8, 0xb6, 0xb1, 0x88, 0xa1, 0xa5, 0xa7, 0xab, 0xa9, 0xa4, 0xa7, 0xa7, 0xa9, 0xa7, 0xa4, 0xa4, 0xa4, 0xa7, 0xa7, 0xa9, 0xa6, 0xa4, 0xa7, 0xa9, 0xa7, 0xa6, 0xa4, 0xa1, 0xb1, 0xbf, 0xe5, 0xd8, 0xd2, 0xd5, 0xda, 0xd2, 0xd2, 0xda, 0xd2, 0xd5, 0xd2, 0xd2, 0xd8, 0xd8, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd5, 0xcf, 0xd8, 0xd3, 0xd8, 0xda, 0xda, 0xc7, 0xbe, 0xb8, 0xb3, 0xa4, 0xa7, 0xae, 0xad, 0xb0, 0xad, 0xad, 0xab, 0xb0, 0xad, 0xae, 0xae, 0xae, 0xaa, 0xae, 0xae, 0xab, 0xa9, 0xa8, 0xab, 0xad, 0xae, 0xae, 0xae, 0xa9, 0xac, 0xac, 0xae, 0xae, 0xf5, 0x0a, 0x0a, 0x0b, 0x0f, 0x12, 0x1d, 0x2c, 0x2e, 0x47, 0x3b, 0x38, 0x33, 0x38, 0x35, 0x3c, 0x34, 0x3c, 0x3c, 0x3c, 0x3f, 0x3c, 0x3c, 0x35, 0x35, 0x3c, 0x35, 0x3c, 0x3c, 0x38, 0x38, 0x3b, 0x38, 0x3b, 0x3b, 0x40, 0x32, 0x2c, 0x21, 0x11, 0x68, 0x07, 0x04, 0x05, 0x06, 0xfd, 0x9d, 0x9f, 0x9d, 0x87, 0x87, 0x87, 0x9e, 0x9e, 0x9e, 0x9a, 0x9e, 0x9a, 0x97, 0x95, 0x92, 0x94, 0x94, 0x94, 0x94, 0x90, 0xf8, 0x13, 0x14, 0x7c, 0x1b, 0x1e, 0x23, 0x1e, 0x1e, 0x1e, 0x23, 0x1e, 0x23, 0x35, 0x41, 0x28, 0x20, 0x1b, 0x20, 0x20, 0x26, 0x26, 0x26, 0x23, 0x23, 0x23, 0x23, 0x1f, 0x1f, 0x1b, 0x1b, 0x17, 0x7a, 0x10, 0x16, 0x7c, 0x1d, 0x81, 0x4c, 0x54, 0x56, 0xf3, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0x56, 0x56, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x83, 0x83, 0x83, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x83, 0x83, 0x83, 0x01, 0x56, 0x56, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0xf4, 0xf4, 0xf4, 0x01, 0xf0, 0xd2, 0xc3, 0xbc, 0xba, 0xb9, 0xb9, 0xb7, 0xa5, 0xa7, 0xa4, 0xa1, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xab, 0xab, 0xa7, 0xa4, 0xa6, 0xab, 0xab, 0xa6, 0xa4, 0x9a, 0xab, 0xba, 0xd5, 0xdf, 0xd8, 0xce, 0xd8, 0xd8, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd3, 0xd5, 0xd3, 0xd2, 0xd3, 0xd5, 0xd3, 0xd2, 0xd3, 0xd2, 0xd3, 0xd8, 0xd5, 0xd6, 0xcc, 0xbc, 0xb4, 0xa4, 0xa3, 0xa9, 0xab, 0xab, 0xab, 0xad, 0xae, 0xab, 0xae, 0xae, 0xae, 0xa9, 0xa9, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xab, 0xaa, 0xae, 0xab, 0x88, 0xac, 0xac, 0xab, 0xae, 0xae, 0xf5, 0xf5, 0x0d, 0x0a, 0x0b, 0x0d, 0x12, 0x25, 0x2c, 0x36, 0x36, 0x40, 0x31, 0x3b, 0x33, 0x38, 0x34, 0x34, 0x34, 0x43, 0x34, 0x35, 0x34, 0x3c, 0x3c, 0x39, 0x3f, 0x39, 0x39, 0x39, 0x3c, 0x34, 0x35, 0x3c, 0x38, 0x45, 0x40, 0x40, 0x32, 0x2c, 0x21, 0x12, 0x08, 0x06, 0x04, 0x05, 0x06, 0xf8, 0xf8, 0x9f, 0x9f, 0x9d, 0xf7, 0x9b, 0x9b, 0x9d, 0x9e, 0x9a, 0x97, 0x94, 0x94, 0x94, 0x92, 0x90, 0x9f, 0x1c, 0x14, 0x18, 0x1b, 0x1e, 0x1e, 0x23, 0x23, 0x1e, 0x1e, 0x19, 0x1f, 0x26, 0x29, 0x31, 0x49, 0x2c, 0x2c, 0x24, 0x24, 0x18, 0x18, 0x1b, 0x7d, 0x1b, 0x1b, 0x17, 0x17, 0x17, 0x7c, 0x18, 0x18, 0x7c, 0x10, 0x10, 0x72, 0x0b, 0x13, 0x4a, 0x54, 0x01, 0x01, 0x83, 0x83, 0x83, 0x01, 0x01, 0xff, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0x01, 0x01, 0xff, 0x56, 0x56, 0xf4, 0x01, 0x83, 0x83, 0x01, 0x01, 0xff, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xee, 0xec, 0xe2, 0xd1, 0xc4, 0xc1, 0xbe, 0xbb, 0xb7, 0xad, 0xa0, 0x9e, 0xa4, 0xa9, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa1, 0xa3, 0xa6, 0xab, 0xa6, 0xa0, 0xa0, 0xa0, 0xb9, 0xc3, 0xdc, 0xdd, 0xd1, 0xd2, 0xdf, 0xd5, 0xd8, 0xd5, 0xd8, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd7, 0xd9, 0xd1, 0xd2, 0xd8, 0xc1, 0xb9, 0xae, 0xa4, 0xb0, 0xb0, 0xa9, 0xa7, 0xb0, 0xac, 0xa9, 0xac, 0xb0, 0xad, 0xa9, 0xa4, 0xab, 0xab, 0xab, 0xab, 0xab, 0xae, 0x88, 0xaf, 0x88, 0xac, 0x88, 0xac, 0xab, 0xab, 0xae, 0xae, 0xaa, 0xaa, 0xf9, 0xf5, 0x09, 0x0f, 0x13, 0x27, 0x27, 0x37, 0x36, 0x32, 0x3b, 0x3b, 0x3c, 0x34, 0x34, 0x3f, 0x38, 0x3f, 0x3f, 0x39, 0x43, 0x39, 0x39, 0x39, 0x39, 0x35, 0x3e, 0x35, 0x35, 0x3f, 0x34, 0x38, 0x38, 0x38, 0x3b, 0x36, 0x40, 0x36, 0x32, 0x25, 0x11, 0x0c, 0x65, 0x04, 0x04, 0x04, 0x07, 0x06, 0x06, 0xfd, 0xf8, 0xa2, 0xa0, 0x9a, 0x94, 0x94, 0x92, 0x94, 0x91, 0x0a, 0x0f, 0x16, 0x18, 0x1b, 0x1e, 0x23, 0x1e, 0x23, 0x1e, 0x19, 0x1f, 0x26, 0x15, 0x7a, 0x49, 0x53, 0x53, 0x54, 0x53, 0x52, 0x52, 0x51, 0x50, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4c, 0x4c, 0x82, 0x56, 0x01, 0x83, 0x83, 0x83, 0x01, 0x83, 0x01, 0x01, 0xff, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0xff, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf0, 0xe3, 0xd0, 0xda, 0xe9, 0xd8, 0xc1, 0xbe, 0xc0, 0xc8, 0xc1, 0xbc, 0xb8, 0xb3, 0xa7, 0xa1, 0xa7, 0xa7, 0xa4, 0xa4, 0xa4, 0xa9, 0xa7, 0xa4, 0xa0, 0xa0, 0xb2, 0xba, 0xd2, 0xe9, 0xe1, 0xd8, 0xd8, 0xd5, 0xd5, 0xcf, 0xd8, 0xd8, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd5, 0xd2, 0xd1, 0xd2, 0xd8, 0xd9, 0xd8, 0xd6, 0xd2, 0xbe, 0xb5, 0xa4, 0xab, 0xb0, 0xa6, 0xaf, 0xaf, 0xac, 0x88, 0xa5, 0xaf, 0xaf, 0xac, 0x88, 0xad, 0x88, 0xad, 0x88, 0xad, 0x88, 0xac, 0x88, 0xad, 0x88, 0xaf, 0x88, 0xac, 0xad, 0xb0, 0xae, 0xad, 0xae, 0xaa, 0xaa, 0xf9, 0xf9, 0x0d, 0x13, 0x1d, 0x27, 0x32, 0x36, 0x40, 0x41, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3f, 0x3c, 0x43, 0x39, 0x39, 0x39, 0x35, 0x35, 0x35, 0x35, 0x34, 0x35, 0x34, 0x35, 0x38, 0x38, 0x38, 0x3b, 0x41, 0x47, 0x45, 0x40, 0x45, 0x40, 0x40, 0x2b, 0x18, 0x0c, 0x0c, 0x65, 0x07, 0x06, 0x06, 0xfd, 0xfd, 0xf8, 0xf8, 0x9c, 0x05, 0x06, 0x08, 0x12, 0x10, 0x20, 0x1a, 0x1e, 0x23, 0x1e, 0x23, 0x1e, 0x1f, 0x1e, 0x1f, 0x20, 0x17, 0x4d, 0x53, 0x54, 0x55, 0xff, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x56, 0x56, 0x01, 0x56, 0xf3, 0x56, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x83, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0xea, 0xdd, 0xdd, 0xdd, 0xdd, 0xd8, 0xc7, 0xbf, 0xbc, 0xbe, 0xc0, 0xc4, 0xbf, 0xbc, 0xbb, 0xb8, 0xb6, 0xb1, 0xa7, 0xa7, 0xab, 0xb1, 0xb5, 0xba, 0xc7, 0xda, 0xdc, 0xd8, 0xd2, 0xd5, 0xda, 0xd5, 0xd2, 0xd5, 0xdd, 0xd5, 0xd8, 0xd5, 0xd8, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd2, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xce, 0xcf, 0xd9, 0xd8, 0xd8, 0xde, 0xc5, 0xb9, 0xb3, 0xb1, 0xa1, 0x88, 0xaf, 0xac, 0xac, 0x88, 0xb1, 0x88, 0xac, 0xac, 0x88, 0xac, 0x88, 0xac, 0xad, 0xad, 0xac, 0xac, 0xac, 0x88, 0xac, 0xaf, 0x88, 0xac, 0x88, 0xac, 0xa7, 0xac, 0xad, 0xad, 0xae, 0xaa, 0xf9, 0x0a, 0x0f, 0x0f, 0x1d, 0x25, 0x2e, 0x32, 0x40, 0x32, 0x3b, 0x3b, 0x38, 0x3c, 0x3c, 0x3c, 0x39, 0x3c, 0x35, 0x35, 0x33, 0x35, 0x35, 0x35, 0x3c, 0x3c, 0x35, 0x35, 0x34, 0x38, 0x34, 0x2f, 0x34, 0x3f, 0x41, 0x3c, 0x38, 0x38, 0x45, 0x3b, 0x31, 0x31, 0x21, 0x18, 0x12, 0x0c, 0x0b, 0x07, 0x08, 0x07, 0x06, 0x07, 0x6a, 0x10, 0x17, 0x1b, 0x1a, 0x23, 0x1e, 0x23, 0x1f, 0x1f, 0x1f, 0x1e, 0x26, 0x1b, 0x20, 0x4f, 0x54, 0x56, 0x83, 0x83, 0x01, 0x56, 0x56, 0x56, 0x01, 0xf4, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x83, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x83, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x83, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xff, 0x83, 0xff, 0x01, 0x83, 0x83, 0x01, 0x83, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf4, 0xf3, 0xe0, 0xd7, 0xda, 0xdd, 0xda, 0xd8, 0xd3, 0xcc, 0xc1, 0xbe, 0xbc, 0xbf, 0xbf, 0xbf, 0xc4, 0xc1, 0xbe, 0xbc, 0xbc, 0xc1, 0xcc, 0xda, 0xd5, 0xd8, 0xda, 0xd8, 0xd5, 0xd5, 0xd5, 0xd5, 0xd8, 0xda, 0xd5, 0xd5, 0xd8, 0xd8, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd5, 0xd2, 0xd2, 0xd1, 0xd2, 0xd8, 0xd8, 0xd1, 0xd1, 0xd2, 0xd2, 0xd8, 0xde, 0xcb, 0xbe, 0xb9, 0xb4, 0xa2, 0xa3, 0xab, 0xb0, 0xa7, 0xad, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xab, 0xae, 0xac, 0xac, 0xac, 0xaf, 0x88, 0xac, 0x88, 0xaf, 0xad, 0xaf, 0xac, 0xab, 0xad, 0xa9, 0xa6, 0xaa, 0xaa, 0xf5, 0x0a, 0x09, 0x0f, 0x0f, 0x1d, 0x27, 0x32, 0x32, 0x36, 0x3b, 0x3b, 0x38, 0x34, 0x3c, 0x34, 0x3c, 0x3c, 0x3c, 0x3c, 0x35, 0x3c, 0x2f, 0x34, 0x35, 0x3c, 0x35, 0x34, 0x35, 0x3c, 0x3c, 0x34, 0x34, 0x39, 0x3f, 0x39, 0x3e, 0x3f, 0x3e, 0x35, 0x41, 0x3b, 0x3b, 0x31, 0x2b, 0x1b, 0x18, 0x0c, 0x0c, 0x0c, 0x10, 0x17, 0x1b, 0x1f, 0x23, 0x1e, 0x23, 0x1e, 0x1f, 0x1f, 0x1f, 0x23, 0x1e, 0x1b, 0x17, 0x51, 0x54, 0xff, 0x83, 0x83, 0x83, 0x01, 0x56, 0x56, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0x83, 0xf3, 0x01, 0x56, 0xff, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x83, 0x83, 0x83, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xff, 0x83, 0xf4, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xe3, 0xd7, 0xdd, 0xd7, 0xd8, 0xd0, 0xcf, 0xcb, 0xd9, 0xde, 0xd4, 0xc1, 0xbe, 0xbf, 0xbf, 0xc1, 0xc1, 0xc0, 0xc4, 0xcc, 0xd2, 0xd2, 0xd5, 0xd8, 0xd5, 0xd2, 0xd5, 0xd7, 0xd8, 0xd7, 0xd5, 0xd5, 0xd5, 0xd7, 0xd8, 0xd5, 0xd8, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd5, 0xd2, 0xd2, 0xd6, 0xd4, 0xd2, 0xce, 0xd1, 0xd1, 0xd1, 0xd4, 0xd5, 0xd6, 0xd8, 0xda, 0xd3, 0xd0, 0xbf, 0xb8, 0xb2, 0xa2, 0xa8, 0xab, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xae, 0xad, 0xab, 0xac, 0xac, 0xac, 0xac, 0x88, 0xac, 0xad, 0xad, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xae, 0xa9, 0xae, 0xaa, 0xaa, 0xaa, 0xf9, 0x0d, 0x0e, 0x1d, 0x2c, 0x32, 0x40, 0x3b, 0x3b, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x34, 0x35, 0x34, 0x35, 0x3c, 0x35, 0x3c, 0x35, 0x34, 0x3e, 0x39, 0x39, 0x39, 0x3e, 0x39, 0x34, 0x39, 0x34, 0x34, 0x3e, 0x3f, 0x3c, 0x33, 0x31, 0x2b, 0x1b, 0x17, 0x1f, 0x1e, 0x1e, 0x23, 0x1e, 0x23, 0x1f, 0x1f, 0x1f, 0x1e, 0x23, 0x1e, 0x1b, 0x2b, 0x53, 0x54, 0x56, 0x83, 0xf1, 0x83, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x56, 0x56, 0x56, 0xff, 0x01, 0x01, 0x01, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x56, 0x01, 0x01, 0x83, 0x83, 0x83, 0x83, 0x01, 0xf4, 0x56, 0x01, 0x01, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xd7, 0xd7, 0xe0, 0xd7, 0xda, 0xd3, 0xd7, 0xd5, 0xf0, 0xf4, 0xec, 0xd7, 0xc3, 0xbb, 0xbf, 0xc4, 0xc2, 0xbf, 0xc0, 0xc0, 0xca, 0xd6, 0xd8, 0xd1, 0xd1, 0xd8, 0xda, 0xd8, 0xd5, 0xd5, 0xd7, 0xd7, 0xda, 0xd7, 0xd7, 0xd7, 0xd7, 0xd5, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd6, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd5, 0xd7, 0xd8, 0xdd, 0xcf, 0xbc, 0xb7, 0xa8, 0xa3, 0xa8, 0xa9, 0xb0, 0xad, 0xae, 0xa9, 0xa9, 0xab, 0xad, 0xb0, 0xaf, 0xb0, 0xac, 0xa9, 0xac, 0xad, 0xab, 0xa7, 0xab, 0xad, 0xad, 0xab, 0xab, 0xad, 0xab, 0xad, 0xab, 0xae, 0xae, 0xae, 0xaa, 0xf5, 0x0a, 0x0a, 0x09, 0x0f, 0x1d, 0x2e, 0x42, 0x40, 0x3b, 0x38, 0x34, 0x34, 0x39, 0x3f, 0x39, 0x39, 0x39, 0x34, 0x34, 0x35, 0x35, 0x33, 0x35, 0x35, 0x34, 0x3f, 0x3e, 0x35, 0x41, 0x3b, 0x41, 0x3b, 0x3b, 0x33, 0x3b, 0x3b, 0x35, 0x33, 0x2f, 0x35, 0x35, 0x2f, 0x2f, 0x28, 0x23, 0x1a, 0x1e, 0x1e, 0x1e, 0x1a, 0x19, 0x19, 0x1f, 0x23, 0x23, 0x23, 0x1b, 0x2c, 0x54, 0x54, 0x01, 0xf4, 0x83, 0x83, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x83, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xff, 0xdb, 0xd0, 0xdd, 0xd7, 0xda, 0xd3, 0xd0, 0xcb, 0xe8, 0xf4, 0x01, 0x01, 0xef, 0xdb, 0xc7, 0xbe, 0xbf, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xcc, 0xd4, 0xd9, 0xd5, 0xd2, 0xd5, 0xd5, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd5, 0xd0, 0xd8, 0xd5, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xcf, 0xd1, 0xd8, 0xda, 0xd8, 0xd5, 0xd2, 0xbc, 0xb7, 0xae, 0xa6, 0xa6, 0xa9, 0xb0, 0xb0, 0xad, 0xb0, 0xad, 0xa9, 0xad, 0xad, 0xab, 0xa9, 0xab, 0xad, 0xb1, 0xab, 0xab, 0xab, 0xab, 0xad, 0xab, 0xab, 0xab, 0xad, 0xab, 0xab, 0xab, 0xac, 0xa9, 0xa9, 0xae, 0xaa, 0xf9, 0xf9, 0x0a, 0x0f, 0x12, 0x2c, 0x36, 0x40, 0x3b, 0x35, 0x29, 0x34, 0x3c, 0x39, 0x39, 0x39, 0x2f, 0x2f, 0x33, 0x35, 0x35, 0x3e, 0x35, 0x3b, 0x36, 0x2c, 0x21, 0x25, 0x16, 0x1d, 0x25, 0x25, 0x2c, 0x32, 0x36, 0x40, 0x3b, 0x38, 0x41, 0x41, 0x44, 0x41, 0x3e, 0x34, 0x2f, 0x28, 0x23, 0x1f, 0x1e, 0x1e, 0x23, 0x23, 0x1f, 0x20, 0x48, 0x54, 0x56, 0x01, 0xf2, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe8, 0xd0, 0xdb, 0xd8, 0xd3, 0xd7, 0xd0, 0xd0, 0xd7, 0xf0, 0xf4, 0xf3, 0xf4, 0xf4, 0xe4, 0xd0, 0xc4, 0xc1, 0xc2, 0xc2, 0xc4, 0xbf, 0xbf, 0xc1, 0xc9, 0xd1, 0xd2, 0xd1, 0xd5, 0xd8, 0xd7, 0xd5, 0xd2, 0xd7, 0xd5, 0xd7, 0xd5, 0xd7, 0xd3, 0xd7, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd5, 0xd2, 0xcf, 0xcf, 0xd5, 0xdc, 0xd8, 0xd8, 0xd2, 0xc7, 0xbb, 0xb7, 0xb0, 0xa7, 0xa3, 0xa7, 0xa9, 0xb0, 0xb0, 0xa9, 0xa9, 0xb0, 0xb0, 0xa9, 0xa9, 0xa9, 0xad, 0xad, 0xad, 0xad, 0xab, 0xad, 0xad, 0xad, 0xab, 0xad, 0xad, 0xad, 0xad, 0xa9, 0xac, 0xad, 0xaf, 0xab, 0xaa, 0xaa, 0x0a, 0x0a, 0x0f, 0x12, 0x1d, 0x2e, 0x2e, 0x36, 0x36, 0x3b, 0x31, 0x34, 0x38, 0x34, 0x39, 0x35, 0x2f, 0x35, 0x41, 0x3b, 0x21, 0x12, 0x0b, 0x07, 0x07, 0x08, 0x07, 0x08, 0x08, 0x0b, 0x0e, 0x0e, 0x12, 0x25, 0x2c, 0x32, 0x36, 0x36, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x35, 0x39, 0x2f, 0x2d, 0x28, 0x26, 0x20, 0x18, 0x4e, 0x54, 0x56, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xd0, 0xd0, 0xd3, 0xd0, 0xd3, 0xd3, 0xdb, 0xd0, 0xe3, 0xf4, 0xf0, 0xf4, 0xf4, 0xf4, 0xf1, 0xe1, 0xcb, 0xc1, 0xbf, 0xc1, 0xc8, 0xc9, 0xbf, 0xc1, 0xc4, 0xcb, 0xcd, 0xd5, 0xd5, 0xd8, 0xd5, 0xd2, 0xd5, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd5, 0xd2, 0xd7, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd1, 0xd3, 0xd8, 0xd5, 0xd1, 0xcf, 0xcf, 0xd1, 0xd2, 0xd8, 0xd8, 0xd2, 0xcf, 0xc1, 0xbb, 0xb8, 0xb1, 0xa7, 0xa7, 0xa9, 0xad, 0xb0, 0xad, 0xab, 0xab, 0xb0, 0xb0, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xab, 0xaf, 0x88, 0xaf, 0x88, 0xac, 0x88, 0xb0, 0xab, 0xf5, 0xa6, 0x0a, 0xf5, 0x0f, 0x13, 0x27, 0x2e, 0x2e, 0x40, 0x31, 0x38, 0x34, 0x39, 0x3f, 0x3f, 0x3b, 0x40, 0x21, 0x0e, 0x09, 0x09, 0x09, 0xf9, 0xf9, 0xa2, 0xf8, 0xa2, 0x09, 0xf8, 0x09, 0x09, 0x09, 0x08, 0x0b, 0x0e, 0x1d, 0x25, 0x25, 0x32, 0x32, 0x36, 0x40, 0x47, 0x47, 0x45, 0x49, 0x40, 0x2c, 0x27, 0x50, 0x54, 0x56, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xdb, 0xd0, 0xd0, 0xcf, 0xd3, 0xcf, 0xd3, 0xd0, 0xdd, 0xf3, 0xf4, 0x01, 0xf4, 0xf4, 0x01, 0xf4, 0xee, 0xda, 0xcb, 0xc3, 0xbf, 0xc3, 0xc3, 0xc4, 0xc1, 0xc1, 0xc4, 0xc9, 0xce, 0xd5, 0xd6, 0xd9, 0xd2, 0xd2, 0xd5, 0xd8, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd7, 0xd5, 0xd7, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd5, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd1, 0xd1, 0xd1, 0xd5, 0xd8, 0xd2, 0xd2, 0xcf, 0xd1, 0xd1, 0xd2, 0xd3, 0xd2, 0xd3, 0xd4, 0xd1, 0xc8, 0xbc, 0xb7, 0xb0, 0xa7, 0xa7, 0xa9, 0xad, 0xb0, 0xad, 0xa7, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xaf, 0x88, 0xaf, 0x88, 0x88, 0x88, 0x88, 0xac, 0xab, 0xab, 0xaa, 0xab, 0xf9, 0x0a, 0x0f, 0x1c, 0x27, 0x2e, 0x40, 0x3b, 0x44, 0x44, 0x38, 0x31, 0x21, 0x11, 0x09, 0xa8, 0xa2, 0xa8, 0xa8, 0xa5, 0xa1, 0xa3, 0xa4, 0xa1, 0xa0, 0x9f, 0xa2, 0xf8, 0xa6, 0xf8, 0xf8, 0xfd, 0x09, 0x0a, 0x0e, 0x0e, 0x12, 0x1d, 0x25, 0x25, 0x2e, 0x2c, 0x3a, 0x27, 0x81, 0x53, 0x56, 0x56, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe8, 0xcb, 0xd3, 0xd0, 0xcf, 0xcf, 0xd0, 0xd0, 0xd0, 0xe8, 0xf4, 0xff, 0xf4, 0xf3, 0xf3, 0x01, 0x01, 0xf3, 0xee, 0xe0, 0xc3, 0xbc, 0xbf, 0xc7, 0xc3, 0xc1, 0xc0, 0xc1, 0xc4, 0xc8, 0xce, 0xd4, 0xd4, 0xd6, 0xd5, 0xd8, 0xd5, 0xd8, 0xd5, 0xd5, 0xd7, 0xd2, 0xd7, 0xd5, 0xd7, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd5, 0xd2, 0xd2, 0xd2, 0xd5, 0xd2, 0xd5, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd5, 0xd2, 0xcf, 0xcd, 0xd1, 0xcf, 0xd1, 0xd8, 0xd2, 0xcf, 0xcb, 0xcf, 0xd1, 0xd2, 0xd1, 0xd4, 0xd1, 0xd1, 0xce, 0xcd, 0xbc, 0xb9, 0xb2, 0xa3, 0xa3, 0xa9, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xab, 0xa6, 0xb0, 0xad, 0xb1, 0xaf, 0xaf, 0xaf, 0xac, 0xac, 0xac, 0xac, 0xad, 0xb2, 0xf5, 0xf5, 0xf9, 0x0a, 0x12, 0x25, 0x32, 0x47, 0x31, 0x22, 0x2c, 0x12, 0x0f, 0xf5, 0xae, 0xae, 0xab, 0xab, 0x88, 0xa5, 0xa5, 0xa5, 0xa7, 0xa7, 0xa4, 0xa4, 0xa4, 0xa0, 0xa0, 0xa0, 0x9f, 0xa2, 0xf8, 0x9f, 0xfd, 0xfd, 0x09, 0xf9, 0x0a, 0x0a, 0x0f, 0x0f, 0x0f, 0x4c, 0x55, 0x55, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf0, 0xd0, 0xd0, 0xd5, 0xcf, 0xd3, 0xcf, 0xd3, 0xd0, 0xe0, 0x01, 0xf4, 0xf3, 0xff, 0x01, 0xf3, 0xff, 0x01, 0x01, 0x01, 0xf2, 0xe3, 0xd0, 0xc3, 0xbf, 0xc3, 0xc8, 0xc0, 0xbf, 0xbf, 0xc2, 0xc2, 0xd4, 0xd4, 0xd6, 0xd6, 0xd6, 0xd8, 0xd5, 0xd5, 0xd5, 0xd7, 0xd5, 0xd7, 0xd7, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xd2, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xd5, 0xd5, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd5, 0xd5, 0xd2, 0xd1, 0xd2, 0xd2, 0xc7, 0xd1, 0xd5, 0xd5, 0xd1, 0xcf, 0xcd, 0xd1, 0xce, 0xd1, 0xd4, 0xd1, 0xce, 0xd8, 0xd9, 0xd1, 0xbf, 0xb9, 0xb3, 0xa6, 0xac, 0xab, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb0, 0xb2, 0xae, 0xaa, 0xab, 0xad, 0xad, 0xa9, 0xac, 0xb0, 0xaf, 0xb0, 0xac, 0xae, 0xae, 0xb2, 0xae, 0xb0, 0xf5, 0x0f, 0x12, 0x2e, 0x32, 0x25, 0x3d, 0x0f, 0xf9, 0xae, 0xab, 0xa9, 0xa7, 0xa5, 0xa7, 0x88, 0xa5, 0x88, 0x88, 0xa5, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa4, 0xa4, 0xa1, 0xa1, 0xa6, 0xa4, 0xa4, 0xa0, 0xa0, 0xa0, 0xa0, 0xf9, 0xfd, 0xfd, 0x4a, 0x56, 0x56, 0xff, 0x56, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xe0, 0xc3, 0xcf, 0xcf, 0xcb, 0xd1, 0xcf, 0xcb, 0xd7, 0xee, 0x01, 0x56, 0x01, 0x56, 0x56, 0x01, 0xff, 0xf4, 0xf4, 0xf4, 0x01, 0xf1, 0xe0, 0xcb, 0xc1, 0xc3, 0xc8, 0xc4, 0xc1, 0xc0, 0xbf, 0xc0, 0xbf, 0xc4, 0xd2, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd7, 0xd2, 0xd7, 0xd2, 0xd3, 0xd2, 0xd3, 0xd5, 0xd3, 0xd2, 0xd3, 0xd2, 0xd3, 0xd5, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xcf, 0xce, 0xcf, 0xce, 0xd1, 0xcc, 0xcc, 0xd8, 0xde, 0xd1, 0xc0, 0xb8, 0xb6, 0xb1, 0xad, 0xad, 0xad, 0xac, 0xb0, 0xad, 0xad, 0xb0, 0xb0, 0xad, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xae, 0xad, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xaf, 0xaf, 0xaf, 0xf5, 0xfa, 0x0b, 0x0f, 0x27, 0xfe, 0xfa, 0xb2, 0xaa, 0xab, 0xad, 0xab, 0xab, 0xa9, 0xab, 0x88, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa8, 0xf9, 0xa8, 0xf9, 0xa8, 0xa8, 0xa3, 0xa3, 0xa4, 0xa4, 0xa5, 0xa5, 0xa4, 0xa8, 0x9f, 0xf5, 0xe3, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xea, 0xcb, 0xcf, 0xd1, 0xcf, 0xce, 0xcf, 0xcf, 0xd0, 0xe8, 0x01, 0x01, 0x56, 0x01, 0x56, 0x56, 0xff, 0x83, 0xf4, 0xf4, 0x01, 0x01, 0xf4, 0xf2, 0xe2, 0xd2, 0xc0, 0xc1, 0xc4, 0xc4, 0xc0, 0xc1, 0xbf, 0xc2, 0xc4, 0xc4, 0xc5, 0xcc, 0xd8, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd2, 0xd1, 0xd5, 0xd2, 0xd8, 0xd8, 0xd2, 0xd5, 0xd8, 0xd5, 0xd8, 0xd1, 0xd1, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xd1, 0xcd, 0xcf, 0xd1, 0xd1, 0xd1, 0xd9, 0xcc, 0xbc, 0xba, 0xb7, 0xb3, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb0, 0xad, 0xad, 0xad, 0xa9, 0xac, 0xac, 0xad, 0xb0, 0xad, 0xad, 0xae, 0xad, 0xae, 0xae, 0xb2, 0xae, 0xaf, 0xaf, 0xaf, 0xaf, 0xb0, 0xf5, 0xf5, 0xfa, 0xfa, 0xb2, 0xa8, 0xaf, 0xa9, 0xa9, 0xac, 0xad, 0xab, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa7, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa7, 0xa2, 0xa0, 0xb8, 0xed, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf2, 0xd7, 0xcb, 0xcf, 0xd1, 0xcc, 0xcf, 0xd0, 0xcb, 0xdd, 0x01, 0xf4, 0x01, 0x56, 0x56, 0x01, 0xff, 0x01, 0x01, 0xff, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf0, 0xdd, 0xcb, 0xc3, 0xc3, 0xc7, 0xc4, 0xc1, 0xc0, 0xc0, 0xbf, 0xc0, 0xc3, 0xc4, 0xc9, 0xcd, 0xd1, 0xd8, 0xda, 0xda, 0xda, 0xda, 0xd8, 0xd3, 0xd2, 0xcf, 0xd8, 0xd3, 0xd2, 0xd1, 0xd1, 0xd5, 0xd8, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd1, 0xd5, 0xd5, 0xd2, 0xd2, 0xd1, 0xd1, 0xcf, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xd1, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xcf, 0xd5, 0xd1, 0xcf, 0xcf, 0xd5, 0xce, 0xd2, 0xd6, 0xd6, 0xcc, 0xbf, 0xbb, 0xb8, 0xb4, 0xab, 0xa9, 0xab, 0xb0, 0xb1, 0xaf, 0xaf, 0xac, 0xac, 0xac, 0xaf, 0xaf, 0xad, 0xad, 0xad, 0xad, 0xad, 0xae, 0xae, 0xb0, 0xaf, 0xaf, 0x88, 0xaf, 0xaf, 0xb1, 0xae, 0xb2, 0xb3, 0xb3, 0xb4, 0xb1, 0xac, 0xac, 0xac, 0xac, 0xad, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa8, 0xa7, 0xa7, 0xa7, 0xa5, 0xa5, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa3, 0xa3, 0xbc, 0x01, 0xf2, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xe1, 0xcb, 0xcf, 0xd1, 0xcb, 0xcf, 0xd0, 0xc7, 0xd7, 0xf3, 0xf4, 0x56, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x83, 0xff, 0x01, 0xf4, 0xf2, 0xf4, 0x01, 0xf0, 0xe0, 0xc7, 0xc3, 0xc7, 0xc1, 0xc1, 0xc1, 0xc0, 0xbf, 0xc1, 0xbe, 0xbf, 0xc1, 0xc8, 0xcc, 0xd1, 0xce, 0xd1, 0xd1, 0xd3, 0xd5, 0xd8, 0xda, 0xd8, 0xd5, 0xd1, 0xcf, 0xd1, 0xd1, 0xd5, 0xd5, 0xd5, 0xd2, 0xd5, 0xd2, 0xd2, 0xd5, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xd1, 0xcd, 0xcf, 0xd2, 0xd5, 0xd1, 0xcb, 0xc9, 0xc7, 0xcc, 0xd1, 0xd5, 0xd8, 0xd5, 0xd6, 0xd8, 0xc4, 0xbb, 0xb8, 0xb3, 0xae, 0xa5, 0x88, 0x88, 0xaf, 0xb1, 0xaf, 0xac, 0xaf, 0xaf, 0xad, 0xad, 0xad, 0xad, 0xb0, 0xb0, 0xb0, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb1, 0xaf, 0xb3, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb1, 0xae, 0xb2, 0xae, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xa5, 0x88, 0xa7, 0xa9, 0xa7, 0xa3, 0xae, 0xdd, 0x01, 0xf2, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0xf4, 0xf4, 0xef, 0xd0, 0xcb, 0xce, 0xcc, 0xce, 0xd0, 0xcb, 0xd0, 0xe6, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf3, 0xf4, 0x01, 0x01, 0xf0, 0xdb, 0xcd, 0xc5, 0xc5, 0xc5, 0xc3, 0xbf, 0xc0, 0xc3, 0xc0, 0xc0, 0xc0, 0xbf, 0xbf, 0xbf, 0xc0, 0xc3, 0xc7, 0xcd, 0xd1, 0xd1, 0xd8, 0xd8, 0xdf, 0xdd, 0xdc, 0xd5, 0xcf, 0xd5, 0xd1, 0xd2, 0xcf, 0xd1, 0xcf, 0xcf, 0xd1, 0xcf, 0xd1, 0xd1, 0xd1, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xcf, 0xd1, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd1, 0xcd, 0xcf, 0xd2, 0xd2, 0xd1, 0xd5, 0xd1, 0xcf, 0xc9, 0xcb, 0xcf, 0xcf, 0xc7, 0xd2, 0xe1, 0xdf, 0xc7, 0xbc, 0xb8, 0xb4, 0xaf, 0xa5, 0x88, 0xac, 0xad, 0xaf, 0xb0, 0xad, 0xaf, 0xad, 0xaf, 0xad, 0xaf, 0xaf, 0xaf, 0xb1, 0xb1, 0xaf, 0xaf, 0xaf, 0xb1, 0xb1, 0xb1, 0xb3, 0xb3, 0xb6, 0xb7, 0xb8, 0xb8, 0xfb, 0xb5, 0xfb, 0xfa, 0xfb, 0xfa, 0xfa, 0xb2, 0xf5, 0xae, 0xa9, 0xab, 0xab, 0x88, 0xac, 0x88, 0x88, 0x88, 0x88, 0xa9, 0x88, 0xa9, 0xa9, 0xa2, 0xb8, 0xf2, 0xf4, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf2, 0xdd, 0xcb, 0xcc, 0xce, 0xcf, 0xcd, 0xd0, 0xd0, 0xd7, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0xff, 0xff, 0xf3, 0x01, 0x01, 0xf3, 0xf3, 0x01, 0x01, 0x01, 0xec, 0xda, 0xcf, 0xd1, 0xcf, 0xc4, 0xc4, 0xc4, 0xc4, 0xc2, 0xc0, 0xbf, 0xbe, 0xc0, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xc7, 0xcd, 0xd3, 0xd9, 0xdf, 0xdf, 0xe5, 0xdd, 0xdf, 0xdd, 0xdd, 0xdc, 0xda, 0xd8, 0xd5, 0xd8, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xcf, 0xd1, 0xd1, 0xd1, 0xcf, 0xd1, 0xcf, 0xd1, 0xd0, 0xd2, 0xd1, 0xd2, 0xd0, 0xd1, 0xcf, 0xcf, 0xcf, 0xd1, 0xd2, 0xd5, 0xcd, 0xcf, 0xd2, 0xd2, 0xd1, 0xd1, 0xd2, 0xd5, 0xcf, 0xcb, 0xcd, 0xd5, 0xda, 0xde, 0xd2, 0xbe, 0xba, 0xb7, 0xfa, 0xac, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xb0, 0xaf, 0xaf, 0x88, 0xb1, 0xb0, 0xb2, 0xb2, 0xb3, 0xb1, 0xb1, 0xb3, 0xb3, 0xb1, 0xb2, 0xfa, 0xb5, 0xfb, 0xf6, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x13, 0xfa, 0xfa, 0xfa, 0xfa, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xaa, 0xd0, 0x01, 0xf4, 0x01, 0xf0, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf4, 0x01, 0xe8, 0xcf, 0xcb, 0xce, 0xce, 0xcb, 0xcf, 0xd0, 0xd0, 0xf2, 0xf4, 0xf4, 0xf4, 0x01, 0x83, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf3, 0x01, 0xee, 0xd7, 0xd2, 0xd8, 0xcf, 0xcb, 0xc9, 0xc9, 0xc8, 0xc4, 0xc2, 0xc8, 0xc1, 0xc0, 0xbf, 0xc0, 0xc0, 0xc0, 0xc0, 0xbf, 0xc0, 0xc0, 0xc1, 0xc9, 0xd6, 0xe4, 0xeb, 0xeb, 0xe7, 0xe9, 0xe7, 0xe9, 0xec, 0xec, 0xe9, 0xe4, 0xe0, 0xdd, 0xdd, 0xd7, 0xd8, 0xd5, 0xd2, 0xd1, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xd0, 0xd1, 0xd0, 0xd2, 0xd0, 0xd2, 0xd0, 0xd0, 0xd0, 0xd1, 0xcf, 0xcf, 0xd0, 0xd1, 0xcf, 0xd1, 0xd0, 0xcf, 0xcf, 0xcf, 0xcd, 0xcf, 0xd0, 0xcf, 0xd1, 0xcf, 0xd3, 0xd1, 0xd1, 0xcd, 0xcf, 0xd2, 0xda, 0xda, 0xd7, 0xc2, 0xbd, 0xb8, 0xb6, 0xb3, 0xae, 0xa8, 0xae, 0xad, 0xaf, 0xaf, 0xb1, 0xb0, 0xb2, 0xb0, 0xb2, 0xb1, 0xaf, 0xb3, 0xb3, 0xb3, 0xb4, 0xb1, 0xb2, 0xb2, 0xfb, 0xf6, 0x2a, 0xfe, 0x1c, 0x1c, 0x27, 0x1d, 0x27, 0x1d, 0x27, 0x1d, 0x27, 0x1d, 0x1d, 0x13, 0x13, 0x0f, 0xfa, 0x0d, 0xb2, 0xf5, 0xae, 0xf5, 0xb6, 0xf1, 0xf4, 0xf4, 0xf4, 0xf3, 0x01, 0x56, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0x83, 0x01, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf4, 0x83, 0xf4, 0x83, 0x01, 0x01, 0xf4, 0xf3, 0x01, 0xf3, 0xd0, 0xcf, 0xce, 0xcc, 0xcc, 0xcf, 0xcf, 0xcb, 0xe8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xdb, 0xd0, 0xd7, 0xd1, 0xd3, 0xd1, 0xd4, 0xce, 0xcb, 0xcd, 0xcb, 0xcb, 0xc5, 0xc3, 0xc1, 0xc1, 0xc0, 0xc0, 0xbf, 0xc0, 0xc0, 0xc0, 0xbf, 0xc1, 0xc8, 0xd1, 0xda, 0xe9, 0xeb, 0xec, 0xe9, 0xe4, 0xe9, 0xec, 0xee, 0xec, 0xed, 0xea, 0xea, 0xe9, 0xe9, 0xe7, 0xe1, 0xdd, 0xdd, 0xd7, 0xd7, 0xd2, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd2, 0xd0, 0xd5, 0xd0, 0xd3, 0xd0, 0xd3, 0xd0, 0xd3, 0xd0, 0xd3, 0xd0, 0xd0, 0xcf, 0xcf, 0xd1, 0xcf, 0xd1, 0xd3, 0xd1, 0xd3, 0xd1, 0xd2, 0xd3, 0xd1, 0xcf, 0xd1, 0xd3, 0xd8, 0xda, 0xd6, 0xcd, 0xbf, 0xbb, 0xb8, 0xb4, 0xab, 0xa7, 0xab, 0xab, 0xad, 0xb1, 0xb1, 0xb3, 0xb1, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb3, 0xb3, 0xb3, 0xb2, 0xfb, 0xfe, 0x2a, 0x2a, 0x1d, 0x25, 0x24, 0x21, 0x2c, 0x21, 0x2c, 0x21, 0x2c, 0x25, 0x25, 0x25, 0x27, 0x1d, 0x1c, 0x13, 0x0f, 0xf5, 0xfa, 0xd7, 0x83, 0xf1, 0x83, 0xf4, 0xf0, 0x56, 0x01, 0x56, 0x56, 0x01, 0x01, 0x83, 0x56, 0x56, 0x56, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xf4, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0xf3, 0xe2, 0xcb, 0xcc, 0xcc, 0xce, 0xcc, 0xcf, 0xd0, 0xdd, 0xf4, 0xf4, 0xf3, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0xed, 0xd7, 0xd0, 0xd3, 0xd1, 0xd1, 0xce, 0xcf, 0xd1, 0xcf, 0xc7, 0xc7, 0xcb, 0xcb, 0xcd, 0xcd, 0xc6, 0xc5, 0xc2, 0xc6, 0xc2, 0xc2, 0xc2, 0xbf, 0xbe, 0xbf, 0xc8, 0xd9, 0xe1, 0xe9, 0xeb, 0xe9, 0xe6, 0xe9, 0xe8, 0xe6, 0xea, 0xec, 0xec, 0xec, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xee, 0xea, 0xe6, 0xdd, 0xdb, 0xd7, 0xd0, 0xcf, 0xd0, 0xcb, 0xcf, 0xcb, 0xcf, 0xd0, 0xd0, 0xd0, 0xd3, 0xd0, 0xd3, 0xd0, 0xd0, 0xd0, 0xd3, 0xd0, 0xd3, 0xd2, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd1, 0xd1, 0xcf, 0xd1, 0xcf, 0xd2, 0xd5, 0xdc, 0xdd, 0xd5, 0xcb, 0xbf, 0xba, 0xb7, 0xb0, 0xa4, 0xab, 0xb0, 0xb1, 0xb1, 0xb1, 0xb3, 0xb3, 0xb3, 0xb4, 0xaf, 0xb3, 0xb4, 0xb3, 0xb2, 0xfb, 0xf6, 0x2a, 0x27, 0x25, 0x21, 0x20, 0x2b, 0x29, 0x2b, 0x29, 0x2b, 0x29, 0x2b, 0x2b, 0x20, 0x21, 0x21, 0x27, 0x24, 0x27, 0x3d, 0x56, 0x01, 0xf3, 0xff, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x83, 0x01, 0xf3, 0x01, 0x83, 0xf0, 0xcc, 0xcc, 0xce, 0xcf, 0xcc, 0xcf, 0xcf, 0xd0, 0xf0, 0xf4, 0xf4, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xda, 0xcb, 0xd7, 0xd3, 0xd1, 0xcd, 0xcf, 0xcd, 0xcd, 0xd1, 0xcb, 0xc7, 0xc7, 0xc7, 0xcb, 0xcd, 0xc5, 0xd1, 0xc9, 0xc2, 0xc2, 0xc2, 0xc1, 0xc0, 0xc0, 0xbf, 0xbe, 0xc0, 0xd1, 0xdf, 0xef, 0xef, 0xeb, 0xe2, 0xe0, 0xe1, 0xe9, 0xe4, 0xe9, 0xe9, 0xec, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xee, 0xe6, 0xe0, 0xdb, 0xd7, 0xd5, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xd0, 0xd0, 0xd0, 0xd5, 0xd5, 0xd3, 0xd0, 0xd1, 0xd0, 0xd1, 0xd1, 0xd1, 0xd2, 0xd5, 0xd3, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xcf, 0xcf, 0xd1, 0xd5, 0xdc, 0xdf, 0xdf, 0xd1, 0xc4, 0xbc, 0xb7, 0xb0, 0xab, 0xb1, 0xb0, 0xad, 0xaf, 0xb1, 0xb1, 0xb5, 0xb4, 0xb4, 0xb4, 0xb3, 0xb0, 0xf5, 0xf6, 0x80, 0x1d, 0x21, 0x31, 0x22, 0x29, 0x28, 0x29, 0x2f, 0x2f, 0x2f, 0x2f, 0x33, 0x29, 0x31, 0x29, 0x2b, 0x2b, 0x32, 0x4b, 0x54, 0x54, 0x55, 0x55, 0x01, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0xff, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0xda, 0xcc, 0xcb, 0xce, 0xcf, 0xcd, 0xd0, 0xc7, 0xea, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xe8, 0xcf, 0xd3, 0xcf, 0xcf, 0xd1, 0xd1, 0xcf, 0xd8, 0xf1, 0xf1, 0xe3, 0xd0, 0xc3, 0xc3, 0xc7, 0xcd, 0xc9, 0xc9, 0xc8, 0xc4, 0xc1, 0xc8, 0xca, 0xc0, 0xc2, 0xc2, 0xc0, 0xc1, 0xc1, 0xc9, 0xd4, 0xe4, 0xef, 0xef, 0xea, 0xe1, 0xe9, 0xe9, 0xe6, 0xe6, 0xe6, 0xea, 0xee, 0xee, 0xef, 0xf0, 0xf1, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xee, 0xea, 0xe3, 0xdd, 0xda, 0xd7, 0xd7, 0xd7, 0xd7, 0xd0, 0xd0, 0xcf, 0xd0, 0xd3, 0xd5, 0xd3, 0xd7, 0xd5, 0xd7, 0xd3, 0xd2, 0xd2, 0xd1, 0xd2, 0xd5, 0xd5, 0xd8, 0xd5, 0xd2, 0xd2, 0xd2, 0xd1, 0xcf, 0xd1, 0xd6, 0xdf, 0xe5, 0xda, 0xc9, 0xbb, 0xb8, 0xb6, 0xb3, 0xb2, 0xb1, 0xb4, 0xb2, 0xb2, 0xb1, 0xb3, 0xb4, 0xb4, 0xb4, 0xfa, 0xfe, 0x3d, 0x2e, 0x22, 0x38, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x34, 0x2d, 0x34, 0x2d, 0x2d, 0x28, 0x2b, 0x42, 0x51, 0x53, 0x54, 0xff, 0x83, 0x83, 0x83, 0x83, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0xf3, 0x01, 0x01, 0x01, 0xe9, 0xd1, 0xcb, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xdb, 0xf2, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf0, 0xd7, 0xcd, 0xd3, 0xd1, 0xd3, 0xd1, 0xc9, 0xcf, 0xec, 0xf4, 0xf4, 0xf0, 0xed, 0xdd, 0xd0, 0xc3, 0xc3, 0xc7, 0xc9, 0xc9, 0xc4, 0xc4, 0xc4, 0xc6, 0xc6, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xcb, 0xd6, 0xdf, 0xe7, 0xef, 0xe9, 0xe9, 0xe6, 0xe4, 0xe6, 0xe6, 0xe6, 0xe8, 0xea, 0xed, 0xee, 0xee, 0xf0, 0xee, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xed, 0xed, 0xe8, 0xe3, 0xe0, 0xdb, 0xda, 0xd0, 0xd7, 0xd0, 0xd0, 0xcf, 0xcf, 0xd0, 0xd2, 0xd1, 0xd2, 0xd1, 0xd5, 0xd5, 0xd5, 0xd3, 0xd2, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xcf, 0xd3, 0xdc, 0xdd, 0xe5, 0xde, 0xd1, 0xbf, 0xbb, 0xb9, 0xb9, 0xb8, 0xb8, 0xb6, 0xb3, 0xaf, 0xaf, 0xb4, 0xaf, 0xfa, 0x27, 0x3d, 0x2b, 0x22, 0x38, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x34, 0x34, 0x34, 0x2d, 0x29, 0x29, 0x36, 0x4f, 0x53, 0x55, 0xff, 0x83, 0x83, 0x83, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf3, 0x83, 0x01, 0x01, 0x01, 0xf1, 0xd2, 0xc7, 0xcf, 0xd1, 0xcb, 0xcf, 0xcf, 0xcf, 0xf1, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xe3, 0xc7, 0xd5, 0xcf, 0xd3, 0xd3, 0xcd, 0xc7, 0xda, 0xf3, 0x01, 0x01, 0x01, 0x83, 0xed, 0xe6, 0xd0, 0xcb, 0xc3, 0xc4, 0xc8, 0xc9, 0xc4, 0xc6, 0xc6, 0xc6, 0xc2, 0xc0, 0xc4, 0xc6, 0xc1, 0xc1, 0xbf, 0xc4, 0xcc, 0xd9, 0xe7, 0xe9, 0xec, 0xec, 0xea, 0xe6, 0xe3, 0xe6, 0xe4, 0xe3, 0xe3, 0xe8, 0xe8, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xee, 0xec, 0xe9, 0xe4, 0xdd, 0xdd, 0xd8, 0xd5, 0xd5, 0xd3, 0xd2, 0xd3, 0xd2, 0xd3, 0xd2, 0xd5, 0xd5, 0xd5, 0xd1, 0xcf, 0xd3, 0xd3, 0xd3, 0xd3, 0xd1, 0xd1, 0xd1, 0xd3, 0xd4, 0xd3, 0xd4, 0xd8, 0xd9, 0xc7, 0xc0, 0xbb, 0xbb, 0xbb, 0xb7, 0xb6, 0xb3, 0xb2, 0x0d, 0x27, 0x37, 0x2c, 0x20, 0x2f, 0x28, 0x2d, 0x28, 0x2d, 0x2d, 0x2d, 0x39, 0x39, 0x2d, 0x2d, 0x2d, 0x2d, 0x34, 0x28, 0x29, 0x31, 0x49, 0x52, 0x54, 0x56, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x83, 0x83, 0x01, 0xf4, 0x56, 0x56, 0xff, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0xe7, 0xc7, 0xcb, 0xd1, 0xc9, 0xd1, 0xcf, 0xcd, 0xe3, 0xf4, 0xf4, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0xcb, 0xd3, 0xd1, 0xd1, 0xd3, 0xcf, 0xcd, 0xd0, 0xed, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf2, 0xea, 0xda, 0xc7, 0xc1, 0xc3, 0xc8, 0xcd, 0xc6, 0xc2, 0xc0, 0xc2, 0xc6, 0xc8, 0xc4, 0xc0, 0xc0, 0xc1, 0xc1, 0xc1, 0xc3, 0xcf, 0xdd, 0xec, 0xf1, 0xef, 0xea, 0xe4, 0xe3, 0xe6, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe8, 0xed, 0xee, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xef, 0xf1, 0xf1, 0xf1, 0xef, 0xeb, 0xe7, 0xdf, 0xdf, 0xe4, 0xdf, 0xd8, 0xcf, 0xd1, 0xd8, 0xda, 0xdc, 0xcf, 0xd8, 0xdd, 0xd8, 0xcf, 0xcd, 0xcb, 0xcd, 0xcd, 0xd4, 0xd3, 0xcc, 0xc1, 0xc1, 0xbf, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbb, 0xba, 0xfe, 0x30, 0x4e, 0x81, 0x2c, 0x29, 0x29, 0x2f, 0x29, 0x28, 0x28, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2f, 0x29, 0x20, 0x42, 0x4b, 0x54, 0x54, 0x56, 0xf3, 0x01, 0xf4, 0xf2, 0x83, 0x83, 0x01, 0xf4, 0x01, 0xff, 0x56, 0x56, 0x56, 0x01, 0x01, 0x83, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xef, 0xcf, 0xcb, 0xd1, 0xc8, 0xd1, 0xcd, 0xcb, 0xd7, 0xf4, 0xf4, 0xf3, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xf2, 0xd0, 0xcf, 0xd0, 0xd3, 0xcf, 0xcd, 0xcd, 0xcd, 0xe0, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf2, 0x83, 0xf2, 0xef, 0xe2, 0xd0, 0xc5, 0xc0, 0xc5, 0xc9, 0xce, 0xc9, 0xc4, 0xc1, 0xc2, 0xc4, 0xc2, 0xc4, 0xc4, 0xc1, 0xc7, 0xc5, 0xc3, 0xc7, 0xd2, 0xe1, 0xee, 0xf2, 0xf1, 0xea, 0xe4, 0xe0, 0xe4, 0xe3, 0xe0, 0xe3, 0xe6, 0xe3, 0xe8, 0xe3, 0xed, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xe6, 0xee, 0xf1, 0xf2, 0xf2, 0xf2, 0xeb, 0xe1, 0xda, 0xda, 0xdc, 0xda, 0xd2, 0xd1, 0xd1, 0xd8, 0xda, 0xd5, 0xd2, 0xdc, 0xe7, 0xdd, 0xd8, 0xcf, 0xcd, 0xc9, 0xcd, 0xd1, 0xce, 0xcf, 0xc8, 0xc4, 0xbf, 0xbc, 0xbe, 0xbb, 0xbe, 0xbf, 0xbe, 0xbb, 0xbc, 0xd0, 0xe3, 0xf3, 0xff, 0x55, 0x4e, 0x2b, 0x20, 0x29, 0x3b, 0x2f, 0x28, 0x28, 0x2d, 0x28, 0x2d, 0x2d, 0x2f, 0x2d, 0x2d, 0x34, 0x2d, 0x28, 0x29, 0x2b, 0x2b, 0x4b, 0x52, 0x54, 0x55, 0x56, 0x01, 0x83, 0x83, 0xf0, 0x83, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf2, 0xd7, 0xcb, 0xcf, 0xd1, 0xcc, 0xcd, 0xcd, 0xd0, 0xea, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xe9, 0xd0, 0xd0, 0xd3, 0xd0, 0xcf, 0xcd, 0xc7, 0xd0, 0xf0, 0x01, 0x01, 0x01, 0x83, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf2, 0xec, 0xd5, 0xcf, 0xc5, 0xc3, 0xc4, 0xc9, 0xc5, 0xc4, 0xc5, 0xc4, 0xc0, 0xbf, 0xc2, 0xc4, 0xc0, 0xbf, 0xbf, 0xc1, 0xc3, 0xc8, 0xd8, 0xe1, 0xec, 0xf1, 0xef, 0xec, 0xe8, 0xe4, 0xe0, 0xe0, 0xe0, 0xdd, 0xe3, 0xe0, 0xe3, 0xe6, 0xe8, 0xea, 0xe8, 0xea, 0xed, 0xea, 0xed, 0xe8, 0xea, 0xea, 0xea, 0xef, 0xef, 0xec, 0xe7, 0xda, 0xd0, 0xcb, 0xc7, 0xc4, 0xc7, 0xcb, 0xcb, 0xc5, 0xdc, 0xd5, 0xd2, 0xd5, 0xda, 0xdf, 0xe7, 0xe5, 0xd8, 0xc9, 0xc9, 0xcd, 0xcf, 0xce, 0xc9, 0xc4, 0xbf, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xbc, 0xbb, 0xbc, 0xc1, 0xcf, 0xee, 0x01, 0x01, 0x83, 0x83, 0x55, 0x51, 0x40, 0x2b, 0x3b, 0x33, 0x34, 0x2d, 0x2d, 0x2d, 0x34, 0x2d, 0x2f, 0x2d, 0x2f, 0x2d, 0x2d, 0x2d, 0x28, 0x28, 0x22, 0x20, 0x32, 0x4b, 0x53, 0x55, 0x55, 0xff, 0xf3, 0x01, 0x01, 0x01, 0xf3, 0xf4, 0xf4, 0xf4, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf4, 0x01, 0xe6, 0xcb, 0xcc, 0xd1, 0xc9, 0xcc, 0xcd, 0xcb, 0xdd, 0x01, 0x01, 0xf3, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf3, 0xd2, 0xcf, 0xcf, 0xcf, 0xd3, 0xd0, 0xcd, 0xcb, 0xe3, 0x01, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0xf2, 0xec, 0xda, 0xcf, 0xc7, 0xc7, 0xc8, 0xc7, 0xc9, 0xc8, 0xc4, 0xc4, 0xc4, 0xc1, 0xc1, 0xc8, 0xc8, 0xc4, 0xc1, 0xbf, 0xbf, 0xc5, 0xd1, 0xdc, 0xe9, 0xec, 0xef, 0xee, 0xea, 0xe4, 0xe3, 0xe4, 0xe6, 0xe0, 0xdd, 0xdd, 0xdd, 0xe0, 0xe6, 0xe8, 0xea, 0xea, 0xea, 0xea, 0xee, 0xec, 0xf1, 0xec, 0xe1, 0xd5, 0xcb, 0xc3, 0xc3, 0xc0, 0xc7, 0xcd, 0xcb, 0xc1, 0xcf, 0xdf, 0xe7, 0xd8, 0xd8, 0xdf, 0xe7, 0xdf, 0xd5, 0xcb, 0xcd, 0xce, 0xcf, 0xce, 0xcc, 0xc8, 0xc0, 0xbf, 0xbf, 0xbf, 0xc0, 0xbf, 0xbe, 0xbf, 0xbe, 0xbc, 0xc3, 0xd3, 0xee, 0x01, 0xf4, 0xf4, 0x83, 0xf1, 0x83, 0x56, 0x53, 0x51, 0x42, 0x20, 0x3b, 0x3c, 0x39, 0x39, 0x39, 0x39, 0x34, 0x2f, 0x2d, 0x2f, 0x2d, 0x2d, 0x2d, 0x34, 0x2d, 0x2d, 0x29, 0x1b, 0x2b, 0x48, 0x4f, 0x53, 0x55, 0x55, 0x56, 0xff, 0xff, 0x01, 0xf4, 0x83, 0xf4, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf4, 0x83, 0xf4, 0xef, 0xd5, 0xcb, 0xce, 0xc8, 0xce, 0xcf, 0xcb, 0xd0, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xff, 0x01, 0x83, 0x01, 0x01, 0xe0, 0xcf, 0xcf, 0xcf, 0xd0, 0xd3, 0xcd, 0xcd, 0xd7, 0xf3, 0xf4, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf4, 0x83, 0xf4, 0x83, 0xf1, 0xe2, 0xd0, 0xcf, 0xcb, 0xc7, 0xc4, 0xcb, 0xc9, 0xc4, 0xc8, 0xc8, 0xc2, 0xc0, 0xc1, 0xc4, 0xc9, 0xc9, 0xc1, 0xc0, 0xc0, 0xcb, 0xd6, 0xdf, 0xe6, 0xec, 0xef, 0xee, 0xec, 0xe4, 0xe4, 0xe3, 0xdd, 0xdb, 0xdd, 0xe0, 0xe2, 0xe9, 0xec, 0xef, 0xef, 0xec, 0xe1, 0xd8, 0xcd, 0xc7, 0xc5, 0xc3, 0xc5, 0xc5, 0xcb, 0xc7, 0xc8, 0xc5, 0xcd, 0xdd, 0xeb, 0xe4, 0xe5, 0xe9, 0xeb, 0xd8, 0xcb, 0xc7, 0xca, 0xd1, 0xd1, 0xce, 0xc4, 0xc4, 0xc4, 0xc4, 0xc0, 0xc0, 0xc4, 0xc0, 0xbe, 0xbf, 0xbe, 0xc1, 0xd7, 0xef, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x83, 0xff, 0x55, 0x54, 0x50, 0x36, 0x2b, 0x38, 0x3f, 0x39, 0x39, 0x39, 0x39, 0x39, 0x35, 0x2f, 0x2f, 0x2d, 0x34, 0x39, 0x2d, 0x2d, 0x2d, 0x28, 0x26, 0x17, 0x2c, 0x49, 0x52, 0x53, 0x55, 0x54, 0x55, 0x01, 0xf3, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0xf4, 0x83, 0xe0, 0xc8, 0xce, 0xca, 0xcd, 0xcc, 0xcb, 0xc7, 0xed, 0x01, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x56, 0x01, 0xff, 0xf4, 0x01, 0xf4, 0xee, 0xd2, 0xd0, 0xcd, 0xd0, 0xd3, 0xd0, 0xd0, 0xc7, 0xe8, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0xff, 0x56, 0x01, 0x83, 0x83, 0x01, 0x83, 0xf2, 0xef, 0xe2, 0xd8, 0xcf, 0xcb, 0xc5, 0xc9, 0xc4, 0xc2, 0xc2, 0xc6, 0xc4, 0xc6, 0xc2, 0xc2, 0xc4, 0xc4, 0xc4, 0xc5, 0xc4, 0xc1, 0xc5, 0xcb, 0xd3, 0xe0, 0xeb, 0xea, 0xe9, 0xea, 0xea, 0xe4, 0xe4, 0xe2, 0xe2, 0xe1, 0xee, 0xec, 0xea, 0xe1, 0xd2, 0xc5, 0xc0, 0xc1, 0xc1, 0xc5, 0xc5, 0xc4, 0xc5, 0xc9, 0xc5, 0xc1, 0xcb, 0xde, 0xe9, 0xeb, 0xef, 0xef, 0xe5, 0xd2, 0xc5, 0xc9, 0xd5, 0xd4, 0xd1, 0xcc, 0xc4, 0xc1, 0xc2, 0xc4, 0xc1, 0xc2, 0xc0, 0xbf, 0xbf, 0xbf, 0xc5, 0xdb, 0xef, 0xf4, 0xf4, 0x83, 0x01, 0x01, 0xf4, 0xff, 0xff, 0xff, 0x56, 0x01, 0x83, 0x56, 0x55, 0x4f, 0x36, 0x31, 0x34, 0x39, 0x39, 0x3f, 0x39, 0x3e, 0x35, 0x3e, 0x34, 0x39, 0x2d, 0x39, 0x2d, 0x2d, 0x2d, 0x2d, 0x29, 0x26, 0x26, 0x1b, 0x2c, 0x81, 0x53, 0x55, 0x55, 0xff, 0xff, 0x83, 0xf4, 0x83, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf3, 0x01, 0xe9, 0xc7, 0xce, 0xcc, 0xcc, 0xc9, 0xcf, 0xc3, 0xe3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0xf4, 0xf2, 0xf0, 0xda, 0xd2, 0xcf, 0xcd, 0xd3, 0xcd, 0xd3, 0xc3, 0xdb, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xff, 0x01, 0x56, 0x01, 0xff, 0x01, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xef, 0xda, 0xcb, 0xc7, 0xc9, 0xcc, 0xca, 0xc8, 0xc8, 0xc4, 0xc4, 0xc4, 0xc2, 0xc4, 0xc4, 0xc4, 0xc4, 0xc6, 0xc8, 0xc5, 0xc5, 0xc3, 0xcb, 0xd8, 0xe1, 0xeb, 0xec, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xdc, 0xcb, 0xc0, 0xc1, 0xc3, 0xc7, 0xc7, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc5, 0xd2, 0xdf, 0xe9, 0xef, 0xf1, 0xf2, 0xdc, 0xc5, 0xc3, 0xc9, 0xcb, 0xd1, 0xca, 0xc4, 0xc2, 0xc4, 0xc4, 0xc4, 0xc1, 0xc2, 0xc4, 0xc0, 0xbe, 0xc4, 0xd9, 0xf1, 0xf4, 0xf4, 0xf4, 0x01, 0x83, 0x83, 0x83, 0x01, 0x01, 0xff, 0x55, 0xff, 0xf3, 0x83, 0xef, 0x01, 0x54, 0x4f, 0x36, 0x33, 0x33, 0x39, 0x3e, 0x3c, 0x35, 0x35, 0x3f, 0x3e, 0x3e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x2f, 0x2f, 0x2f, 0x29, 0x26, 0x18, 0x14, 0x2e, 0x52, 0x55, 0x56, 0x56, 0x83, 0x83, 0x83, 0xf4, 0x01, 0x56, 0x56, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0xf0, 0x01, 0xf0, 0xd2, 0xcc, 0xca, 0xc8, 0xcc, 0xcc, 0xc3, 0xd0, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x56, 0x01, 0x01, 0x01, 0x83, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xed, 0xc7, 0xd3, 0xcf, 0xc8, 0xce, 0xcd, 0xcd, 0xcb, 0xea, 0x01, 0xf3, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xe3, 0xd0, 0xc3, 0xc7, 0xc9, 0xc7, 0xc4, 0xc5, 0xc4, 0xc4, 0xc2, 0xc2, 0xc2, 0xc2, 0xc6, 0xc8, 0xc2, 0xc4, 0xc1, 0xc4, 0xc1, 0xc1, 0xc7, 0xcc, 0xd2, 0xd5, 0xd2, 0xcf, 0xcb, 0xbf, 0xc2, 0xc9, 0xc8, 0xc2, 0xc1, 0xc4, 0xc1, 0xc4, 0xc7, 0xc9, 0xc7, 0xc5, 0xc7, 0xda, 0xe9, 0xf1, 0xf1, 0xf1, 0xeb, 0xc5, 0xc3, 0xcc, 0xcd, 0xcc, 0xcd, 0xc8, 0xc2, 0xc8, 0xca, 0xc8, 0xc4, 0xc0, 0xc4, 0xc3, 0xbf, 0xc4, 0xe0, 0xf2, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x56, 0x01, 0x83, 0x01, 0x01, 0x55, 0x54, 0x53, 0x48, 0x2e, 0x2b, 0x31, 0x41, 0x41, 0x3c, 0x35, 0x39, 0x34, 0x35, 0x2f, 0x2f, 0x2f, 0x2f, 0x29, 0x29, 0x26, 0x26, 0x26, 0x18, 0x1d, 0x12, 0x3d, 0x54, 0x55, 0xf3, 0xf4, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf2, 0xdf, 0xcb, 0xc8, 0xca, 0xc9, 0xcc, 0xc7, 0xcb, 0xea, 0xf4, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0xf4, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xd5, 0xd0, 0xce, 0xce, 0xcc, 0xcc, 0xcd, 0xc5, 0xe0, 0xf4, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xff, 0xf4, 0x01, 0x01, 0x01, 0xf3, 0xe8, 0xd2, 0xc7, 0xc7, 0xcd, 0xcb, 0xc1, 0xc4, 0xc6, 0xc8, 0xc6, 0xc6, 0xc2, 0xc2, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc1, 0xc1, 0xc8, 0xc2, 0xc0, 0xc0, 0xc2, 0xc8, 0xc6, 0xcb, 0xc5, 0xc1, 0xc1, 0xcb, 0xda, 0xe4, 0xea, 0xf1, 0xf1, 0xef, 0xdc, 0xc0, 0xc7, 0xc9, 0xcc, 0xcc, 0xca, 0xc8, 0xc8, 0xce, 0xc2, 0xc0, 0xc2, 0xc8, 0xc8, 0xc3, 0xc3, 0xd7, 0xed, 0xf2, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x56, 0x54, 0x53, 0x50, 0x4b, 0x32, 0x36, 0x31, 0x3b, 0x31, 0x31, 0x31, 0x31, 0x36, 0x36, 0x36, 0x3a, 0x36, 0x49, 0x48, 0x4b, 0x4b, 0x4b, 0x50, 0x4e, 0x50, 0x56, 0x55, 0x01, 0x01, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xee, 0xce, 0xc8, 0xca, 0xc4, 0xcb, 0xc9, 0xc3, 0xdd, 0xf2, 0x01, 0x01, 0xff, 0xf4, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xe3, 0xc7, 0xd2, 0xce, 0xcc, 0xcc, 0xca, 0xc9, 0xd0, 0xf1, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0xf2, 0xe3, 0xd0, 0xc3, 0xc7, 0xcd, 0xc9, 0xc6, 0xc6, 0xc2, 0xc6, 0xca, 0xca, 0xc4, 0xc6, 0xc4, 0xc6, 0xc4, 0xc4, 0xc4, 0xc1, 0xc1, 0xc0, 0xc0, 0xc1, 0xc4, 0xc8, 0xc2, 0xc0, 0xc6, 0xc8, 0xc4, 0xc1, 0xc1, 0xc4, 0xcb, 0xd3, 0xdf, 0xe1, 0xef, 0xf2, 0xf2, 0xe1, 0xcb, 0xc3, 0xc3, 0xc9, 0xcb, 0xcc, 0xc9, 0xc9, 0xc6, 0xc4, 0xc2, 0xc8, 0xc8, 0xc5, 0xc1, 0xc3, 0xd0, 0xe6, 0xf2, 0xf4, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x56, 0x56, 0x56, 0x55, 0x54, 0x53, 0x50, 0x51, 0x4f, 0x4f, 0x4e, 0x4e, 0x4e, 0x50, 0x50, 0x50, 0x52, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x56, 0xf3, 0x01, 0x83, 0x83, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0xf3, 0x01, 0xf4, 0xf4, 0xf2, 0xd2, 0xc8, 0xc8, 0xc4, 0xc9, 0xcb, 0xc1, 0xd0, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0xff, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xee, 0xcb, 0xcf, 0xd1, 0xca, 0xc9, 0xce, 0xc7, 0xcb, 0xe6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf1, 0xe8, 0xd7, 0xc5, 0xc3, 0xc5, 0xc9, 0xcd, 0xca, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc5, 0xc2, 0xc6, 0xc6, 0xc2, 0xc6, 0xc4, 0xc6, 0xc5, 0xc2, 0xc2, 0xc8, 0xc8, 0xc4, 0xc1, 0xc0, 0xc1, 0xd3, 0xda, 0xdd, 0xe5, 0xf1, 0xf2, 0xeb, 0xd5, 0xc5, 0xc3, 0xc9, 0xd1, 0xc9, 0xc9, 0xc8, 0xca, 0xc8, 0xc8, 0xc8, 0xcc, 0xcb, 0xc8, 0xc3, 0xc7, 0xe1, 0xf1, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xf4, 0xf3, 0x56, 0xff, 0x56, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0xff, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0xf4, 0x83, 0x01, 0x01, 0x56, 0x56, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x83, 0x01, 0x83, 0x83, 0xf4, 0xe2, 0xc8, 0xc8, 0xc4, 0xc9, 0xc8, 0xc3, 0xc7, 0xe2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x56, 0x01, 0xf4, 0x01, 0x83, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf2, 0xd7, 0xcd, 0xcf, 0xc8, 0xce, 0xcd, 0xcd, 0xc7, 0xd7, 0xf2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xe3, 0xd0, 0xd0, 0xc7, 0xc5, 0xc7, 0xc9, 0xcb, 0xc6, 0xc5, 0xc6, 0xc5, 0xc2, 0xc6, 0xc1, 0xc2, 0xc2, 0xc6, 0xc2, 0xc2, 0xc2, 0xc1, 0xc4, 0xc2, 0xc0, 0xbf, 0xc8, 0xcd, 0xd3, 0xda, 0xe5, 0xef, 0xf2, 0xf1, 0xdf, 0xcb, 0xc1, 0xc5, 0xcc, 0xcd, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc9, 0xca, 0xc9, 0xc7, 0xc0, 0xc1, 0xd0, 0xef, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf4, 0x56, 0xf4, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0x83, 0x01, 0x83, 0xff, 0xff, 0x56, 0x56, 0x56, 0x56, 0xff, 0x56, 0xff, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x83, 0xf4, 0x83, 0x01, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x83, 0xf4, 0x83, 0x83, 0x83, 0xf4, 0x01, 0xef, 0xcc, 0xc4, 0xcc, 0xc8, 0xc4, 0xcb, 0xc7, 0xd0, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xee, 0xcf, 0xcb, 0xcd, 0xcd, 0xcd, 0xd1, 0xc7, 0xcb, 0xed, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0xf3, 0x01, 0x01, 0xff, 0xf0, 0xf4, 0xf4, 0xf4, 0xea, 0xd7, 0xcd, 0xc7, 0xd0, 0xd0, 0xcb, 0xc9, 0xc7, 0xc9, 0xc5, 0xc8, 0xc6, 0xc5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc2, 0xc1, 0xc1, 0xc4, 0xcb, 0xd6, 0xdd, 0xdf, 0xe4, 0xef, 0xf4, 0xef, 0xce, 0xbf, 0xc1, 0xce, 0xd1, 0xc4, 0xc1, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xc4, 0xc8, 0xc4, 0xc3, 0xd0, 0xe3, 0xf2, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x56, 0xff, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0xf4, 0x01, 0x01, 0xf4, 0xf4, 0x83, 0xf2, 0x01, 0xf4, 0x01, 0xf4, 0x83, 0x01, 0x56, 0x01, 0x56, 0x56, 0x56, 0x01, 0x56, 0x01, 0x56, 0xff, 0xff, 0xff, 0xf4, 0x83, 0x83, 0x83, 0x83, 0x83, 0xf3, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0xf4, 0xf4, 0xd2, 0xc1, 0xc9, 0xc8, 0xc4, 0xc9, 0xc8, 0xc7, 0xe6, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xd0, 0xc7, 0xcd, 0xcf, 0xc9, 0xcf, 0xcb, 0xc3, 0xe0, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0xf0, 0xe0, 0xd0, 0xcb, 0xcb, 0xcb, 0xcb, 0xc7, 0xc9, 0xc7, 0xc5, 0xc2, 0xc5, 0xc2, 0xc1, 0xc2, 0xc4, 0xc1, 0xc3, 0xcd, 0xd6, 0xdd, 0xde, 0xe1, 0xeb, 0xf2, 0xf2, 0xd8, 0xc1, 0xc9, 0xd1, 0xcc, 0xc6, 0xc8, 0xc9, 0xc8, 0xcc, 0xc9, 0xcc, 0xc9, 0xc4, 0xc4, 0xc4, 0xc7, 0xe0, 0xf2, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0xff, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x83, 0x83, 0xf2, 0x83, 0xf4, 0x01, 0x83, 0xff, 0xff, 0xff, 0x01, 0x56, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0xf4, 0x83, 0xf4, 0x01, 0x56, 0x56, 0x56, 0xff, 0x01, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0xf3, 0xf2, 0xf0, 0xf0, 0xee, 0xee, 0xed, 0xea, 0xed, 0xed, 0xee, 0xe8, 0xf0, 0xf0, 0xf2, 0xf4, 0xf4, 0xeb, 0xc1, 0xc4, 0xc4, 0xc4, 0xc8, 0xc8, 0xc1, 0xd7, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf4, 0x01, 0xdd, 0xc7, 0xcb, 0xcd, 0xcd, 0xcf, 0xcd, 0xc7, 0xd0, 0xef, 0xf4, 0xf4, 0x01, 0x01, 0xff, 0x56, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xed, 0xe0, 0xe0, 0xdd, 0xd7, 0xcf, 0xcb, 0xc7, 0xc7, 0xc8, 0xc4, 0xc3, 0xc1, 0xc4, 0xcf, 0xd8, 0xdd, 0xdf, 0xdd, 0xe7, 0xf2, 0xf2, 0xe9, 0xd3, 0xc3, 0xc3, 0xcc, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc4, 0xc5, 0xc4, 0xc1, 0xc4, 0xd8, 0xec, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xf4, 0xf4, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0xff, 0x01, 0x83, 0x83, 0x83, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0x01, 0xf2, 0x83, 0xf4, 0xf4, 0xf4, 0xf1, 0xe3, 0xdd, 0xda, 0xdb, 0xd2, 0xd0, 0xc7, 0xc7, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc7, 0xc7, 0xcb, 0xd2, 0xdd, 0xe9, 0xf2, 0xc9, 0xc9, 0xc4, 0xc4, 0xc8, 0xc8, 0xc3, 0xcf, 0xef, 0xf4, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0xf4, 0x56, 0x01, 0x01, 0x01, 0x01, 0xee, 0xd0, 0xc7, 0xcd, 0xcd, 0xcd, 0xcb, 0xc7, 0xcb, 0xdd, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf2, 0xf2, 0x83, 0xf2, 0xf0, 0xea, 0xe2, 0xe2, 0xda, 0xd5, 0xd8, 0xda, 0xda, 0xdf, 0xe4, 0xdd, 0xdf, 0xf1, 0xf4, 0xef, 0xdd, 0xc9, 0xc1, 0xc9, 0xcf, 0xc5, 0xc9, 0xcd, 0xc8, 0xc6, 0xc9, 0xc9, 0xc9, 0xcb, 0xc1, 0xc0, 0xcf, 0xe9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x56, 0x01, 0x56, 0x56, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0xf4, 0x56, 0xff, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0xf4, 0xf4, 0xf1, 0xdd, 0xcb, 0xc3, 0xbf, 0xc3, 0xc3, 0xc3, 0xc3, 0xc7, 0xc7, 0xc7, 0xc7, 0xc3, 0xbf, 0xc3, 0xc7, 0xc3, 0xc3, 0xbd, 0xbd, 0xc3, 0xc3, 0xbf, 0xc3, 0xd1, 0xce, 0xc9, 0xc4, 0xc4, 0xc4, 0xc8, 0xc4, 0xc3, 0xdd, 0x01, 0xf4, 0x83, 0x01, 0x83, 0x01, 0xff, 0x01, 0xff, 0xf4, 0x01, 0xf4, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xdd, 0xc7, 0xcd, 0xcb, 0xc9, 0xcd, 0xc8, 0xc7, 0xcb, 0xf2, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf2, 0x83, 0xf4, 0xf4, 0x83, 0x83, 0xef, 0xef, 0xf2, 0xf4, 0x01, 0x01, 0xf4, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xec, 0xf1, 0xef, 0xf1, 0xf4, 0xef, 0xd3, 0xc7, 0xc5, 0xc3, 0xc5, 0xc9, 0xcb, 0xc9, 0xca, 0xc9, 0xcc, 0xc9, 0xc9, 0xc3, 0xc1, 0xcf, 0xe2, 0xf2, 0x83, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xff, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x83, 0x83, 0x83, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf2, 0xf4, 0xf4, 0x01, 0xef, 0xe1, 0xd0, 0xcb, 0xd1, 0xe4, 0xeb, 0xdf, 0xe1, 0xe4, 0xe5, 0xe7, 0xe7, 0xe9, 0xe7, 0xe1, 0xdf, 0xdf, 0xda, 0xd1, 0xcf, 0xc5, 0xc1, 0xc3, 0xcf, 0xc3, 0xbb, 0xcc, 0xc8, 0xc8, 0xc8, 0xc8, 0xc4, 0xc4, 0xc0, 0xd1, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf4, 0xf3, 0x01, 0xe8, 0xcb, 0xcb, 0xc9, 0xc9, 0xcd, 0xcf, 0xc9, 0xc7, 0xe6, 0xf2, 0x01, 0xf4, 0xf4, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0x83, 0xf4, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0xf2, 0xf1, 0xef, 0xef, 0xee, 0xef, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf4, 0xec, 0xcb, 0xc3, 0xc3, 0xcf, 0xcf, 0xc8, 0xc5, 0xcd, 0xc8, 0xc5, 0xcd, 0xc9, 0xc5, 0xc3, 0xcd, 0xd7, 0xef, 0xf4, 0xf4, 0xf2, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xff, 0xf2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0xff, 0xff, 0xff, 0xf4, 0x56, 0xf4, 0x56, 0xf4, 0x56, 0xf4, 0x01, 0x01, 0xff, 0x56, 0x56, 0x56, 0x56, 0x56, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf3, 0x01, 0xf4, 0xe6, 0xc3, 0xbf, 0xc7, 0xd4, 0xde, 0xdc, 0xd4, 0xce, 0xd4, 0xd1, 0xd4, 0xd1, 0xd4, 0xd1, 0xd6, 0xd4, 0xd6, 0xd8, 0xd9, 0xd8, 0xd4, 0xd8, 0xe7, 0xdf, 0xcd, 0xc5, 0xcd, 0xd8, 0xc5, 0xc8, 0xc4, 0xc9, 0xc8, 0xc8, 0xc8, 0xc1, 0xc7, 0xec, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x83, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf3, 0x01, 0xf2, 0xd7, 0xc7, 0xcb, 0xc9, 0xcd, 0xcd, 0xcd, 0xc7, 0xcf, 0xef, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf2, 0xf1, 0xef, 0xe9, 0xe4, 0xe4, 0xdf, 0xe0, 0xe1, 0xe4, 0xe4, 0xe0, 0xda, 0xd3, 0xd5, 0xd5, 0xe0, 0xec, 0xf2, 0xf2, 0xf1, 0xf1, 0xee, 0xee, 0xf0, 0xf2, 0xf4, 0xf2, 0xf2, 0xe9, 0xd0, 0xc3, 0xcb, 0xcb, 0xc5, 0xc7, 0xcd, 0xc9, 0xc4, 0xc5, 0xc9, 0xc9, 0xc3, 0xc7, 0xd5, 0xe6, 0xf4, 0xf2, 0xf4, 0xf4, 0x01, 0xf2, 0xf0, 0xef, 0xef, 0xee, 0xec, 0xe9, 0xe6, 0xe6, 0xe9, 0xea, 0xec, 0xee, 0xf1, 0xf1, 0xf2, 0xff, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x83, 0x01, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0xff, 0xff, 0xff, 0x56, 0xff, 0x56, 0xff, 0x56, 0xf4, 0x56, 0xf4, 0x56, 0xf4, 0x56, 0x01, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xee, 0xd7, 0xc3, 0xbc, 0xc3, 0xbf, 0xbf, 0xbe, 0xbe, 0xbf, 0xbe, 0xbf, 0xbf, 0xbf, 0xc0, 0xc0, 0xc2, 0xbf, 0xbe, 0xbf, 0xc0, 0xc0, 0xc2, 0xc0, 0xc0, 0xcd, 0xeb, 0xeb, 0xd3, 0xc5, 0xcd, 0xd1, 0xcc, 0xc8, 0xc8, 0xc8, 0xc4, 0xc4, 0xc3, 0xc0, 0xe0, 0x01, 0xf4, 0x83, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xe3, 0xcd, 0xcb, 0xcd, 0xcb, 0xc9, 0xcb, 0xc8, 0xc3, 0xe6, 0xf4, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xee, 0xe3, 0xdb, 0xcf, 0xc9, 0xc9, 0xc5, 0xc3, 0xc0, 0xc1, 0xc0, 0xc0, 0xbf, 0xc0, 0xc0, 0xc0, 0xc0, 0xc1, 0xc3, 0xc1, 0xbf, 0xc5, 0xcf, 0xe4, 0xf1, 0xf4, 0xf4, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xe6, 0xcf, 0xc3, 0xc7, 0xcb, 0xcb, 0xc5, 0xc5, 0xcc, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xcf, 0xe1, 0xef, 0xf2, 0xf4, 0xf4, 0xf2, 0xf0, 0xe8, 0xdb, 0xd0, 0xcf, 0xcb, 0xcb, 0xcb, 0xc7, 0xcb, 0xc7, 0xcb, 0xcb, 0xcb, 0xd0, 0xcf, 0xd0, 0xd0, 0xd7, 0xd7, 0xe0, 0xe8, 0xf0, 0xf4, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x83, 0x83, 0x83, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x56, 0x01, 0x01, 0xf3, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xf2, 0xd8, 0xc7, 0xc8, 0xcf, 0xd5, 0xd2, 0xd1, 0xd4, 0xd2, 0xd4, 0xce, 0xd4, 0xcc, 0xcc, 0xca, 0xca, 0xc8, 0xc9, 0xc4, 0xc4, 0xc2, 0xc0, 0xc0, 0xc1, 0xc4, 0xc6, 0xbf, 0xc0, 0xdc, 0xe5, 0xdc, 0xc9, 0xd1, 0xce, 0xc4, 0xc4, 0xc8, 0xc8, 0xc8, 0xc2, 0xc4, 0xcf, 0xf2, 0xf4, 0xf3, 0x01, 0x01, 0x56, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xee, 0xd0, 0xcd, 0xcb, 0xc9, 0xc9, 0xc8, 0xc9, 0xc4, 0xd7, 0xef, 0x01, 0x01, 0x01, 0xf0, 0xff, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0xf1, 0xe8, 0xd5, 0xcb, 0xc7, 0xc1, 0xcb, 0xca, 0xca, 0xca, 0xcd, 0xd1, 0xd1, 0xd1, 0xd1, 0xcf, 0xcf, 0xc9, 0xc3, 0xc1, 0xc0, 0xc1, 0xc6, 0xcb, 0xc5, 0xc1, 0xc0, 0xcb, 0xe9, 0xf2, 0xf2, 0xf1, 0xf2, 0xee, 0xec, 0xd7, 0xc3, 0xc5, 0xc9, 0xc4, 0xc5, 0xca, 0xcc, 0xc8, 0xc5, 0xc8, 0xc7, 0xc5, 0xd3, 0xe9, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xdd, 0xd0, 0xcb, 0xcb, 0xcb, 0xcd, 0xcb, 0xcb, 0xc7, 0xc7, 0xc9, 0xcb, 0xc7, 0xcb, 0xc7, 0xcb, 0xcd, 0xcd, 0xcb, 0xcb, 0xcb, 0xcd, 0xd0, 0xd0, 0xe4, 0xea, 0xf1, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0x01, 0xf4, 0x83, 0x83, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0x83, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0x01, 0x83, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0xf4, 0xf4, 0xef, 0xd9, 0xc0, 0xc4, 0xd8, 0xde, 0xd9, 0xd4, 0xd6, 0xd4, 0xd6, 0xd6, 0xd6, 0xd6, 0xd9, 0xd9, 0xd9, 0xd6, 0xd6, 0xd9, 0xd6, 0xd6, 0xd4, 0xd1, 0xcc, 0xc8, 0xc1, 0xc5, 0xc6, 0xc5, 0xc9, 0xdc, 0xde, 0xd1, 0xd3, 0xd1, 0xcc, 0xc7, 0xc8, 0xc8, 0xc8, 0xc2, 0xc8, 0xc4, 0xee, 0x01, 0xf4, 0x56, 0x56, 0x56, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xf3, 0xdb, 0xcb, 0xc7, 0xcb, 0xce, 0xc4, 0xca, 0xc9, 0xc5, 0xe3, 0xf4, 0x01, 0x56, 0xff, 0x01, 0xf4, 0xf4, 0x01, 0xf4, 0xe8, 0xd2, 0xcb, 0xc4, 0xc4, 0xc8, 0xcc, 0xce, 0xca, 0xca, 0xc6, 0xca, 0xca, 0xcc, 0xce, 0xcc, 0xce, 0xd4, 0xd6, 0xd9, 0xde, 0xdc, 0xd1, 0xce, 0xc5, 0xc2, 0xc6, 0xcd, 0xcd, 0xc0, 0xc9, 0xde, 0xef, 0xf2, 0xf1, 0xe0, 0xd3, 0xc7, 0xc5, 0xc8, 0xca, 0xc8, 0xc6, 0xc2, 0xc2, 0xcc, 0xc9, 0xc4, 0xc7, 0xda, 0xef, 0xf2, 0xf4, 0xf2, 0xf2, 0xe5, 0xdf, 0xdf, 0xe5, 0xe5, 0xeb, 0xeb, 0xe7, 0xeb, 0xe7, 0xeb, 0xeb, 0xeb, 0xdf, 0xd6, 0xd3, 0xcf, 0xc9, 0xc5, 0xc1, 0xc3, 0xc7, 0xc5, 0xcd, 0xd3, 0xd3, 0xc3, 0xc5, 0xcd, 0xd0, 0xda, 0xe9, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x56, 0xf4, 0x01, 0xff, 0x56, 0x01, 0x01, 0xf3, 0xf2, 0x01, 0xf1, 0xc5, 0xbf, 0xc4, 0xc9, 0xcc, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xd3, 0xd4, 0xd6, 0xd6, 0xd9, 0xdc, 0xe5, 0xe5, 0xde, 0xd8, 0xce, 0xc0, 0xcc, 0xcc, 0xc6, 0xcc, 0xdc, 0xe5, 0xd6, 0xd6, 0xd1, 0xca, 0xc4, 0xc4, 0xc8, 0xc2, 0xc4, 0xc4, 0xdd, 0x01, 0x01, 0x01, 0x56, 0x56, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe3, 0xc7, 0xc3, 0xcc, 0xc9, 0xca, 0xc8, 0xcc, 0xc5, 0xd0, 0xf4, 0xf3, 0xff, 0xff, 0xf2, 0xf4, 0xf4, 0xe4, 0xd0, 0xbf, 0xc3, 0xce, 0xcc, 0xce, 0xcc, 0xc4, 0xc0, 0xc2, 0xc2, 0xc6, 0xc6, 0xc2, 0xc0, 0xbf, 0xc6, 0xc4, 0xc8, 0xcc, 0xce, 0xd4, 0xd6, 0xde, 0xe5, 0xde, 0xc6, 0xc2, 0xca, 0xd6, 0xca, 0xbe, 0xc0, 0xd8, 0xeb, 0xe7, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9, 0xca, 0xc6, 0xc8, 0xc8, 0xc4, 0xc0, 0xc9, 0xd2, 0xe4, 0xf4, 0xf4, 0xf1, 0xe5, 0xe4, 0xd8, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xca, 0xc6, 0xcd, 0xca, 0xd3, 0xd3, 0xd6, 0xd9, 0xe5, 0xf1, 0xf1, 0xf2, 0xef, 0xeb, 0xeb, 0xd1, 0xd6, 0xd3, 0xc3, 0xc6, 0xcd, 0xd3, 0xd3, 0xcd, 0xc5, 0xc3, 0xc7, 0xd0, 0xe0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x56, 0x01, 0x56, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf2, 0xd7, 0xc1, 0xc1, 0xc8, 0xc9, 0xc4, 0xc4, 0xc9, 0xc4, 0xc4, 0xc4, 0xc8, 0xc8, 0xc8, 0xc8, 0xc2, 0xc5, 0xc2, 0xc5, 0xc2, 0xc5, 0xc2, 0xc8, 0xc4, 0xce, 0xd4, 0xde, 0xe5, 0xd6, 0xd1, 0xcc, 0xcd, 0xd9, 0xdf, 0xd9, 0xd6, 0xd6, 0xd6, 0xce, 0xc1, 0xc4, 0xca, 0xc2, 0xc4, 0xc3, 0xcb, 0xf2, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xcb, 0xc1, 0xcf, 0xc9, 0xc9, 0xca, 0xc9, 0xcf, 0xc7, 0xe3, 0xf3, 0x56, 0xf4, 0xf4, 0xf4, 0xe4, 0xcb, 0xcb, 0xda, 0xdc, 0xd5, 0xd4, 0xd4, 0xd6, 0xd6, 0xd9, 0xd9, 0xd9, 0xd4, 0xd4, 0xce, 0xcc, 0xca, 0xc0, 0xc2, 0xc0, 0xc0, 0xbf, 0xc0, 0xc0, 0xca, 0xd4, 0xde, 0xe5, 0xd3, 0xc0, 0xc0, 0xce, 0xd1, 0xc0, 0xbe, 0xcd, 0xc7, 0xc5, 0xc7, 0xc5, 0xc9, 0xcc, 0xc8, 0xc2, 0xc2, 0xc8, 0xc8, 0xc9, 0xda, 0xf2, 0xf4, 0xf2, 0xee, 0xd5, 0xcb, 0xc3, 0xbf, 0xc5, 0xc5, 0xc6, 0xc6, 0xc5, 0xc2, 0xc2, 0xc5, 0xc2, 0xc0, 0xc2, 0xc0, 0xc0, 0xbf, 0xbf, 0xbf, 0xc2, 0xca, 0xd6, 0xdc, 0xeb, 0xdf, 0xe5, 0xdf, 0xc9, 0xc0, 0xc9, 0xc5, 0xc9, 0xcd, 0xcd, 0xcb, 0xc7, 0xc3, 0xd0, 0xe3, 0xf4, 0x01, 0x01, 0x83, 0x83, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf3, 0x01, 0xf4, 0xdd, 0xc7, 0xc8, 0xc9, 0xcc, 0xcc, 0xc9, 0xca, 0xcc, 0xc8, 0xc8, 0xc8, 0xc8, 0xc9, 0xc8, 0xc9, 0xcd, 0xc9, 0xcd, 0xc9, 0xc9, 0xc8, 0xc8, 0xc4, 0xc2, 0xc2, 0xc2, 0xc8, 0xca, 0xd9, 0xd9, 0xd3, 0xce, 0xce, 0xce, 0xca, 0xce, 0xd1, 0xd6, 0xce, 0xc4, 0xc4, 0xc8, 0xc8, 0xc8, 0xc4, 0xc7, 0xed, 0x01, 0x01, 0x01, 0x56, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xda, 0xc3, 0xcb, 0xc9, 0xc9, 0xc9, 0xc1, 0xd1, 0xc3, 0xd7, 0xed, 0xf4, 0xee, 0xee, 0xd8, 0xc7, 0xc9, 0xd5, 0xd4, 0xd1, 0xd1, 0xd1, 0xce, 0xd4, 0xd4, 0xd6, 0xd9, 0xd6, 0xd9, 0xd6, 0xde, 0xe5, 0xe5, 0xe5, 0xd9, 0xd6, 0xce, 0xca, 0xc8, 0xc6, 0xc6, 0xc0, 0xc6, 0xd6, 0xd4, 0xcc, 0xc0, 0xca, 0xd9, 0xc9, 0xbf, 0xc5, 0xc1, 0xcb, 0xcd, 0xc9, 0xc9, 0xca, 0xc6, 0xc6, 0xc4, 0xc8, 0xd1, 0xe9, 0xf1, 0xf1, 0xeb, 0xdc, 0xc3, 0xc7, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xc2, 0xc5, 0xc2, 0xc6, 0xc6, 0xc2, 0xc6, 0xc2, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xca, 0xc6, 0xc8, 0xd6, 0xeb, 0xd9, 0xbc, 0xcd, 0xc9, 0xc5, 0xc5, 0xc5, 0xcb, 0xcf, 0xd0, 0xdb, 0xec, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xe9, 0xd7, 0xcb, 0xcc, 0xca, 0xcc, 0xce, 0xce, 0xcc, 0xc8, 0xc9, 0xc9, 0xca, 0xc9, 0xc8, 0xc8, 0xc8, 0xc5, 0xc5, 0xc7, 0xc5, 0xc9, 0xc8, 0xca, 0xc8, 0xca, 0xc4, 0xc2, 0xc2, 0xbf, 0xc2, 0xcc, 0xce, 0xcc, 0xc6, 0xc6, 0xce, 0xcc, 0xcc, 0xd4, 0xd6, 0xc8, 0xc8, 0xc8, 0xca, 0xc2, 0xc4, 0xc7, 0xdd, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xea, 0xc7, 0xc5, 0xc9, 0xc9, 0xca, 0xc5, 0xcd, 0xc7, 0xc7, 0xc7, 0xdb, 0xd0, 0xd4, 0xd6, 0xcc, 0xbf, 0xbe, 0xbc, 0xbe, 0xbe, 0xc0, 0xc0, 0xbe, 0xbc, 0xbc, 0xbe, 0xbe, 0xbc, 0xbe, 0xbe, 0xbf, 0xc0, 0xca, 0xd4, 0xde, 0xe5, 0xd9, 0xd4, 0xc8, 0xc2, 0xc4, 0xc6, 0xc6, 0xca, 0xca, 0xca, 0xc6, 0xcd, 0xcc, 0xc9, 0xce, 0xc5, 0xca, 0xc8, 0xc6, 0xc4, 0xc6, 0xc8, 0xc8, 0xc9, 0xdf, 0xeb, 0xec, 0xe4, 0xea, 0xe9, 0xcf, 0xbf, 0xc1, 0xc5, 0xc0, 0xc5, 0xc5, 0xc2, 0xc5, 0xc2, 0xc5, 0xc2, 0xc6, 0xc2, 0xc2, 0xc2, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xca, 0xc6, 0xc2, 0xbf, 0xbe, 0xbc, 0xc8, 0xc0, 0xbe, 0xcc, 0xe5, 0xce, 0xbf, 0xc6, 0xd3, 0xd9, 0xdd, 0xdf, 0xe6, 0xea, 0xe6, 0xe3, 0xed, 0xf2, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xf4, 0xea, 0xd5, 0xdf, 0xe5, 0xdf, 0xde, 0xdc, 0xd9, 0xd9, 0xd9, 0xd6, 0xd9, 0xd6, 0xd6, 0xd6, 0xd4, 0xd4, 0xd1, 0xd1, 0xd0, 0xd1, 0xd1, 0xce, 0xce, 0xcc, 0xc8, 0xc8, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xcc, 0xcc, 0xcd, 0xcc, 0xce, 0xcc, 0xc9, 0xd4, 0xd8, 0xcc, 0xc4, 0xc4, 0xcc, 0xc0, 0xc4, 0xcb, 0xd0, 0xf3, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x83, 0xf4, 0x83, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf2, 0xcf, 0xc1, 0xcb, 0xc9, 0xc9, 0xce, 0xc1, 0xd0, 0xd5, 0xbd, 0xd7, 0xcf, 0xd2, 0xd6, 0xcc, 0xc0, 0xbf, 0xc8, 0xc2, 0xc4, 0xc6, 0xc6, 0xc2, 0xc2, 0xc6, 0xc0, 0xbf, 0xc0, 0xc0, 0xc0, 0xbf, 0xbf, 0xbf, 0xbe, 0xc2, 0xc6, 0xd6, 0xd9, 0xde, 0xca, 0xc8, 0xc2, 0xc8, 0xca, 0xca, 0xc6, 0xc0, 0xcc, 0xce, 0xc4, 0xc8, 0xc8, 0xc8, 0xc9, 0xc9, 0xc6, 0xc5, 0xc2, 0xc7, 0xde, 0xef, 0xef, 0xe0, 0xda, 0xee, 0xef, 0xe4, 0xda, 0xd5, 0xda, 0xd8, 0xd3, 0xd1, 0xd1, 0xd4, 0xd4, 0xd1, 0xce, 0xc8, 0xc6, 0xc6, 0xc6, 0xc2, 0xc2, 0xc2, 0xc0, 0xc0, 0xc2, 0xc2, 0xc6, 0xca, 0xca, 0xc0, 0xbe, 0xc0, 0xc2, 0xc0, 0xc6, 0xd9, 0xcd, 0xd6, 0xdf, 0xe5, 0xe7, 0xe5, 0xe4, 0xe4, 0xe8, 0xe6, 0xe6, 0xed, 0xf3, 0xf4, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf1, 0xd7, 0xcc, 0xd8, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xde, 0xe5, 0xe5, 0xe5, 0xde, 0xe5, 0xde, 0xde, 0xde, 0xde, 0xe1, 0xdf, 0xdf, 0xdf, 0xe5, 0xe7, 0xe5, 0xd9, 0xc2, 0xc0, 0xca, 0xcc, 0xc6, 0xc2, 0xc6, 0xc9, 0xce, 0xce, 0xce, 0xce, 0xc9, 0xc8, 0xce, 0xd4, 0xce, 0xc9, 0xc2, 0xcc, 0xc8, 0xc0, 0xc7, 0xc3, 0xec, 0xf4, 0x01, 0xf4, 0xf4, 0x01, 0xf3, 0x01, 0x83, 0x01, 0x01, 0x83, 0x01, 0x01, 0xf3, 0xf4, 0x01, 0xf3, 0xf4, 0x01, 0xf4, 0xf4, 0xf1, 0xcf, 0xc3, 0xc5, 0xc9, 0xcc, 0xc5, 0xc5, 0xd0, 0xd3, 0xc7, 0xd0, 0xd5, 0xce, 0xce, 0xce, 0xce, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xde, 0xd6, 0xd4, 0xd1, 0xcc, 0xc8, 0xc2, 0xc0, 0xbe, 0xca, 0xc2, 0xbc, 0xbf, 0xc6, 0xd6, 0xeb, 0xd4, 0xbf, 0xc6, 0xce, 0xc4, 0xc0, 0xc2, 0xca, 0xcd, 0xce, 0xce, 0xce, 0xc2, 0xc2, 0xc8, 0xc9, 0xc2, 0xcf, 0xe7, 0xf2, 0xef, 0xdf, 0xd7, 0xe0, 0xd7, 0xd5, 0xdc, 0xdc, 0xdc, 0xde, 0xde, 0xdf, 0xde, 0xe5, 0xdf, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xde, 0xde, 0xde, 0xe5, 0xe5, 0xe5, 0xca, 0xbf, 0xbf, 0xc0, 0xc2, 0xc6, 0xe5, 0xce, 0xbc, 0xbe, 0xc4, 0xd4, 0xdc, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe1, 0xe1, 0xe1, 0xe2, 0xe3, 0xe6, 0xe8, 0xed, 0xf2, 0x01, 0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xee, 0xd0, 0xbc, 0xbc, 0xbc, 0xbe, 0xbe, 0xbe, 0xc0, 0xc2, 0xcc, 0xce, 0xd4, 0xd4, 0xd4, 0xd4, 0xd9, 0xd6, 0xd9, 0xd9, 0xde, 0xdc, 0xdc, 0xd8, 0xd6, 0xd4, 0xd6, 0xde, 0xde, 0xce, 0xc2, 0xc8, 0xd6, 0xce, 0xcd, 0xc9, 0xc9, 0xc8, 0xc7, 0xc8, 0xc9, 0xcb, 0xd1, 0xda, 0xd8, 0xc7, 0xc0, 0xcc, 0xc8, 0xc1, 0xc8, 0xc3, 0xe0, 0xf4, 0x01, 0xf4, 0xf4, 0x01, 0xf3, 0x01, 0x01, 0x83, 0xf4, 0x01, 0x83, 0x01, 0x01, 0xf4, 0xf3, 0x01, 0x01, 0xf3, 0xf4, 0xf2, 0xdd, 0xc5, 0xc1, 0xc5, 0xc9, 0xc5, 0xd1, 0xc3, 0xcd, 0xe1, 0xe1, 0xd3, 0xcf, 0xd6, 0xd9, 0xd9, 0xde, 0xde, 0xde, 0xde, 0xe5, 0xde, 0xe5, 0xde, 0xe5, 0xde, 0xeb, 0xeb, 0xf1, 0xef, 0xeb, 0xe5, 0xd9, 0xd1, 0xbf, 0xc0, 0xca, 0xc6, 0xbf, 0xbf, 0xce, 0xde, 0xd4, 0xbe, 0xc0, 0xd6, 0xd8, 0xd9, 0xdc, 0xdf, 0xe5, 0xdf, 0xe5, 0xdc, 0xd4, 0xc4, 0xc0, 0xcf, 0xeb, 0xf2, 0xeb, 0xee, 0xda, 0xd0, 0xd1, 0xcd, 0xcb, 0xcd, 0xcd, 0xcd, 0xcf, 0xce, 0xd1, 0xca, 0xcc, 0xca, 0xca, 0xca, 0xca, 0xcc, 0xca, 0xca, 0xc6, 0xca, 0xca, 0xce, 0xd6, 0xe5, 0xde, 0xc6, 0xc0, 0xc2, 0xc0, 0xd4, 0xce, 0xc6, 0xcc, 0xd9, 0xe5, 0xe7, 0xe5, 0xe2, 0xe5, 0xe2, 0xe5, 0xe5, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe8, 0xe6, 0xf0, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xd8, 0xc5, 0xc2, 0xc2, 0xc0, 0xbf, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbf, 0xc0, 0xc2, 0xc8, 0xc8, 0xc1, 0xc4, 0xc8, 0xc8, 0xc9, 0xc8, 0xce, 0xde, 0xe5, 0xde, 0xce, 0xcc, 0xde, 0xcd, 0xcd, 0xc9, 0xcb, 0xcd, 0xcf, 0xd3, 0xe0, 0xdf, 0xe7, 0xef, 0xe7, 0xcf, 0xc4, 0xca, 0xc8, 0xc4, 0xcb, 0xc3, 0xcf, 0xf2, 0x01, 0xf4, 0xf4, 0x01, 0xf3, 0x01, 0x01, 0x83, 0x83, 0x01, 0x83, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf2, 0xdd, 0xc7, 0xc1, 0xc3, 0xcb, 0xc5, 0xc7, 0xc9, 0xcb, 0xd8, 0xe5, 0xda, 0xcf, 0xca, 0xc0, 0xc2, 0xc2, 0xc8, 0xc6, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc6, 0xc1, 0xc2, 0xc2, 0xca, 0xd9, 0xe5, 0xef, 0xeb, 0xd4, 0xc6, 0xc6, 0xc2, 0xc6, 0xc0, 0xc2, 0xce, 0xd4, 0xd1, 0xd9, 0xdc, 0xde, 0xdf, 0xe1, 0xe5, 0xe4, 0xe5, 0xe4, 0xde, 0xe1, 0xde, 0xd8, 0xeb, 0xf1, 0xec, 0xe9, 0xec, 0xe4, 0xd8, 0xd0, 0xd3, 0xd6, 0xd3, 0xd4, 0xd3, 0xd4, 0xd3, 0xd4, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xca, 0xca, 0xce, 0xca, 0xca, 0xca, 0xca, 0xc6, 0xc2, 0xce, 0xe5, 0xde, 0xc6, 0xbf, 0xc0, 0xc0, 0xc8, 0xd4, 0xde, 0xe5, 0xe7, 0xe5, 0xe2, 0xe5, 0xe4, 0xe5, 0xe4, 0xe4, 0xe7, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe8, 0xe8, 0xf0, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0xf3, 0x83, 0x01, 0x01, 0xf4, 0xe9, 0xd2, 0xcf, 0xce, 0xca, 0xc6, 0xc6, 0xc4, 0xc2, 0xc2, 0xc0, 0xc0, 0xbf, 0xbe, 0xbe, 0xbe, 0xbe, 0xbf, 0xbf, 0xc0, 0xc2, 0xc4, 0xc8, 0xce, 0xd1, 0xd6, 0xd4, 0xd3, 0xde, 0xe5, 0xdf, 0xd6, 0xd6, 0xc7, 0xcb, 0xd0, 0xd7, 0xe0, 0xe9, 0xec, 0xf1, 0xef, 0xef, 0xf2, 0xec, 0xd7, 0xc4, 0xc9, 0xc4, 0xc4, 0xcc, 0xc4, 0xc3, 0xec, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0xff, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf3, 0xf4, 0x01, 0xf2, 0xf4, 0xf4, 0xe0, 0xc7, 0xc3, 0xc5, 0xc9, 0xcb, 0xc5, 0xc5, 0xc1, 0xdd, 0xe7, 0xd8, 0xc7, 0xc9, 0xcf, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xca, 0xc8, 0xc8, 0xc8, 0xc8, 0xca, 0xc8, 0xca, 0xca, 0xc4, 0xc6, 0xc6, 0xc8, 0xca, 0xde, 0xeb, 0xe5, 0xc8, 0xc0, 0xc4, 0xca, 0xce, 0xd1, 0xd6, 0xe7, 0xeb, 0xdf, 0xdd, 0xdf, 0xdf, 0xe1, 0xe1, 0xe1, 0xdf, 0xdf, 0xe5, 0xe7, 0xe9, 0xec, 0xec, 0xec, 0xe4, 0xe1, 0xe4, 0xdc, 0xd3, 0xd8, 0xdc, 0xdc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xde, 0xdc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd6, 0xd4, 0xd1, 0xce, 0xcd, 0xca, 0xc6, 0xc6, 0xc0, 0xc0, 0xde, 0xde, 0xca, 0xbf, 0xc0, 0xce, 0xdf, 0xe7, 0xe2, 0xe5, 0xe2, 0xe7, 0xe2, 0xe4, 0xe4, 0xe4, 0xe5, 0xe4, 0xe7, 0xe2, 0xe7, 0xe2, 0xe6, 0xe4, 0xe6, 0xed, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x83, 0x01, 0x01, 0xf4, 0xf0, 0xdd, 0xdd, 0xde, 0xde, 0xd4, 0xd6, 0xd4, 0xd4, 0xce, 0xce, 0xca, 0xca, 0xca, 0xc6, 0xc8, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xbf, 0xc0, 0xbf, 0xc2, 0xc8, 0xcc, 0xcd, 0xce, 0xde, 0xe9, 0xdc, 0xd1, 0xd0, 0xd3, 0xd7, 0xe0, 0xe9, 0xec, 0xf1, 0xef, 0xf1, 0xf1, 0xee, 0xef, 0xef, 0xe0, 0xd1, 0xc8, 0xc4, 0xc8, 0xc8, 0xc7, 0xc0, 0xe1, 0xf2, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0x01, 0x01, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xe8, 0xc7, 0xc3, 0xc5, 0xc7, 0xcb, 0xc7, 0xc3, 0xc5, 0xcf, 0xeb, 0xe5, 0xc9, 0xc9, 0xcf, 0xca, 0xce, 0xcc, 0xca, 0xca, 0xca, 0xca, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xc6, 0xc6, 0xcc, 0xce, 0xcc, 0xca, 0xc4, 0xc8, 0xd6, 0xeb, 0xde, 0xc4, 0xc2, 0xd1, 0xdc, 0xe5, 0xe1, 0xdf, 0xe2, 0xe4, 0xe2, 0xe0, 0xe2, 0xe0, 0xe1, 0xe1, 0xe0, 0xe9, 0xdf, 0xe1, 0xe0, 0xdd, 0xe6, 0xf2, 0xe4, 0xe0, 0xdd, 0xd3, 0xce, 0xce, 0xce, 0xd3, 0xd1, 0xd3, 0xd3, 0xd6, 0xd4, 0xd9, 0xd6, 0xd9, 0xd6, 0xd9, 0xd9, 0xd9, 0xdc, 0xde, 0xde, 0xde, 0xde, 0xdc, 0xde, 0xd6, 0xcd, 0xcd, 0xd9, 0xd9, 0xc5, 0xd9, 0xe1, 0xeb, 0xe7, 0xe7, 0xe2, 0xe7, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe7, 0xe2, 0xe7, 0xe2, 0xe4, 0xe4, 0xe6, 0xe3, 0xe6, 0xf0, 0xf4, 0x01, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf4, 0xe9, 0xd7, 0xdc, 0xd9, 0xd6, 0xd6, 0xd4, 0xd9, 0xd9, 0xd9, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd4, 0xd4, 0xce, 0xce, 0xce, 0xd4, 0xca, 0xca, 0xc8, 0xc8, 0xca, 0xc8, 0xcc, 0xdc, 0xe5, 0xd3, 0xcd, 0xd7, 0xe6, 0xe8, 0xea, 0xed, 0xee, 0xee, 0xee, 0xee, 0xf1, 0xf0, 0xee, 0xf2, 0xee, 0xda, 0xc4, 0xc4, 0xc4, 0xc8, 0xc8, 0xc3, 0xd0, 0xf1, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x83, 0x83, 0x83, 0x83, 0xf4, 0x01, 0xf4, 0xf2, 0xf4, 0xed, 0xc3, 0xc3, 0xc7, 0xc5, 0xc9, 0xc9, 0xc3, 0xc3, 0xcb, 0xe9, 0xe7, 0xd8, 0xcc, 0xce, 0xd1, 0xcc, 0xd1, 0xcd, 0xcd, 0xca, 0xc9, 0xcc, 0xcc, 0xcc, 0xca, 0xca, 0xca, 0xca, 0xc8, 0xd4, 0xcc, 0xca, 0xc6, 0xca, 0xce, 0xd4, 0xce, 0xbf, 0xcc, 0xd9, 0xce, 0xd4, 0xe5, 0xe5, 0xdd, 0xdf, 0xe1, 0xe4, 0xdf, 0xe0, 0xe2, 0xe0, 0xe0, 0xe0, 0xe3, 0xe1, 0xe1, 0xe0, 0xe2, 0xe6, 0xe0, 0xe3, 0xe8, 0xec, 0xec, 0xde, 0xd1, 0xcc, 0xce, 0xca, 0xce, 0xcd, 0xce, 0xcc, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xd4, 0xce, 0xd4, 0xce, 0xd3, 0xd3, 0xd3, 0xd8, 0xd8, 0xdc, 0xd6, 0xe5, 0xeb, 0xd3, 0xc2, 0xd3, 0xde, 0xe7, 0xe7, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe6, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe7, 0xe4, 0xe9, 0xe6, 0xe6, 0xe8, 0xf3, 0x01, 0x01, 0x01, 0x56, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf2, 0xe8, 0xd5, 0xd8, 0xd4, 0xd4, 0xd9, 0xd9, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd4, 0xd4, 0xcd, 0xc9, 0xcb, 0xd8, 0xd7, 0xd7, 0xe4, 0xed, 0xea, 0xe8, 0xea, 0xed, 0xee, 0xf0, 0xed, 0xf2, 0xf0, 0xed, 0xf0, 0xee, 0xdd, 0xc4, 0xc8, 0xc8, 0xc1, 0xc9, 0xc5, 0xcb, 0xef, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x83, 0x01, 0xf2, 0xf4, 0x01, 0xf0, 0xcf, 0xbd, 0xc7, 0xcd, 0xc7, 0xcd, 0xc7, 0xc5, 0xc7, 0xd6, 0xef, 0xdc, 0xd6, 0xd3, 0xc8, 0xc9, 0xd9, 0xcd, 0xce, 0xd1, 0xd1, 0xce, 0xcc, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xca, 0xca, 0xca, 0xce, 0xca, 0xca, 0xc8, 0xcc, 0xc8, 0xc8, 0xd6, 0xe1, 0xe5, 0xe1, 0xe1, 0xe1, 0xe4, 0xe1, 0xe0, 0xe2, 0xe3, 0xe2, 0xe0, 0xe1, 0xe4, 0xe4, 0xe6, 0xe4, 0xe6, 0xe0, 0xe0, 0xed, 0xea, 0xe0, 0xea, 0xf1, 0xdd, 0xc6, 0xca, 0xce, 0xce, 0xcd, 0xcd, 0xcd, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xcc, 0xca, 0xc9, 0xca, 0xca, 0xc9, 0xcd, 0xc9, 0xc9, 0xd3, 0xd6, 0xd3, 0xdf, 0xeb, 0xe1, 0xdf, 0xe1, 0xec, 0xe9, 0xe6, 0xe2, 0xe2, 0xe6, 0xe4, 0xe4, 0xe3, 0xe7, 0xe2, 0xe7, 0xe2, 0xe4, 0xe4, 0xe6, 0xec, 0xe3, 0xe3, 0xf0, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x83, 0x01, 0xf1, 0xd0, 0xd1, 0xd5, 0xdc, 0xd9, 0xd8, 0xd4, 0xd6, 0xd9, 0xd9, 0xd6, 0xd6, 0xd4, 0xd4, 0xd9, 0xd4, 0xd6, 0xd4, 0xd4, 0xd1, 0xd4, 0xce, 0xd4, 0xd4, 0xce, 0xd4, 0xce, 0xd1, 0xd1, 0xcf, 0xd0, 0xda, 0xe4, 0xee, 0xea, 0xe8, 0xe8, 0xe8, 0xee, 0xf0, 0xee, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf1, 0xee, 0xcf, 0xc0, 0xcf, 0xc6, 0xc4, 0xc9, 0xbf, 0xda, 0xf4, 0xf2, 0x01, 0xf0, 0x56, 0x01, 0x01, 0x83, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xd0, 0xbf, 0xc7, 0xc7, 0xc7, 0xc5, 0xc3, 0xc7, 0xc3, 0xcf, 0xea, 0xdd, 0xd0, 0xcb, 0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xca, 0xcc, 0xca, 0xca, 0xc2, 0xcc, 0xda, 0xe1, 0xe4, 0xe0, 0xe0, 0xe4, 0xe4, 0xe1, 0xe4, 0xe4, 0xe4, 0xe1, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe2, 0xe2, 0xe4, 0xe2, 0xe4, 0xe1, 0xe7, 0xef, 0xe5, 0xd2, 0xcf, 0xd1, 0xcd, 0xcc, 0xcc, 0xca, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xc9, 0xca, 0xc8, 0xca, 0xcc, 0xca, 0xc6, 0xca, 0xc6, 0xc9, 0xc6, 0xc9, 0xd3, 0xdd, 0xe7, 0xe4, 0xdf, 0xe4, 0xe2, 0xe5, 0xe2, 0xe7, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe5, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe2, 0xe4, 0xe6, 0xe6, 0xe6, 0xe6, 0xf1, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x83, 0xe9, 0xda, 0xdc, 0xda, 0xd6, 0xd5, 0xd6, 0xd8, 0xd8, 0xd5, 0xd6, 0xd8, 0xd6, 0xd8, 0xd8, 0xd4, 0xd4, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd4, 0xd4, 0xce, 0xd1, 0xd4, 0xd2, 0xd1, 0xd2, 0xcf, 0xda, 0xe1, 0xea, 0xea, 0xe8, 0xe8, 0xe8, 0xee, 0xee, 0xf0, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xda, 0xc5, 0xcd, 0xc5, 0xc6, 0xc8, 0xc1, 0xce, 0xf2, 0xf4, 0x01, 0xff, 0x01, 0x56, 0xf3, 0x01, 0x01, 0x83, 0xf2, 0x01, 0xf1, 0xd0, 0xc0, 0xc5, 0xcd, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xcf, 0xe1, 0xef, 0xe4, 0xd5, 0xcf, 0xd1, 0xcf, 0xd3, 0xd3, 0xce, 0xce, 0xce, 0xcc, 0xca, 0xc9, 0xc6, 0xc8, 0xc9, 0xce, 0xcd, 0xce, 0xcc, 0xcc, 0xce, 0xca, 0xc4, 0xce, 0xce, 0xc8, 0xca, 0xd8, 0xde, 0xe1, 0xe0, 0xe3, 0xe6, 0xe1, 0xe2, 0xe4, 0xe4, 0xe1, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe2, 0xe1, 0xe4, 0xe2, 0xe1, 0xe4, 0xe1, 0xe1, 0xe7, 0xe6, 0xdf, 0xdf, 0xe1, 0xdf, 0xdc, 0xdc, 0xdc, 0xd6, 0xd3, 0xce, 0xd1, 0xd3, 0xce, 0xcd, 0xcc, 0xc9, 0xca, 0xc6, 0xc6, 0xc6, 0xc6, 0xca, 0xc6, 0xca, 0xca, 0xc9, 0xd1, 0xde, 0xe4, 0xe7, 0xe1, 0xe2, 0xe5, 0xe2, 0xe7, 0xe4, 0xe5, 0xe4, 0xe5, 0xe4, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe7, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe9, 0xe6, 0xe6, 0xef, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0xf2, 0xe0, 0xe2, 0xeb, 0xe7, 0xe7, 0xe5, 0xe5, 0xdf, 0xd9, 0xdc, 0xd9, 0xd6, 0xd8, 0xd6, 0xd4, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd9, 0xd4, 0xd4, 0xd6, 0xd8, 0xd6, 0xd2, 0xd5, 0xd7, 0xe0, 0xec, 0xec, 0xea, 0xe8, 0xed, 0xed, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xe4, 0xcd, 0xc9, 0xc8, 0xc9, 0xc6, 0xc4, 0xc1, 0xea, 0xf4, 0xf4, 0xff, 0x01, 0x56, 0xff, 0x83, 0xf4, 0x83, 0xf4, 0xf2, 0xda, 0xc1, 0xc1, 0xcb, 0xc1, 0xc5, 0xc5, 0xc7, 0xc7, 0xc5, 0xdd, 0xec, 0xe4, 0xcd, 0xd2, 0xdc, 0xe5, 0xdf, 0xd3, 0xce, 0xca, 0xcd, 0xcc, 0xd1, 0xd4, 0xd3, 0xd6, 0xd8, 0xd4, 0xcc, 0xca, 0xc9, 0xca, 0xc8, 0xc8, 0xc8, 0xc4, 0xca, 0xcc, 0xca, 0xd6, 0xde, 0xe4, 0xe1, 0xe0, 0xe6, 0xe8, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe2, 0xe4, 0xe1, 0xe4, 0xe1, 0xe4, 0xe1, 0xdf, 0xe7, 0xe7, 0xdd, 0xd8, 0xdf, 0xe5, 0xe5, 0xe5, 0xe7, 0xe5, 0xe5, 0xdf, 0xde, 0xdf, 0xdc, 0xd9, 0xd8, 0xd9, 0xd6, 0xce, 0xcc, 0xce, 0xcd, 0xc6, 0xc6, 0xcd, 0xce, 0xdc, 0xe9, 0xe7, 0xe1, 0xe2, 0xe4, 0xe2, 0xe7, 0xe4, 0xe7, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe7, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe8, 0xe9, 0xe2, 0xea, 0xf2, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xe2, 0xc1, 0xcc, 0xce, 0xd6, 0xde, 0xe5, 0xe5, 0xe5, 0xe7, 0xe7, 0xe7, 0xe5, 0xe7, 0xe5, 0xe5, 0xde, 0xde, 0xde, 0xde, 0xd9, 0xd9, 0xd9, 0xd9, 0xd4, 0xd6, 0xd9, 0xd8, 0xd1, 0xd1, 0xd5, 0xe0, 0xe7, 0xea, 0xea, 0xea, 0xe3, 0xed, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xec, 0xd1, 0xc1, 0xc7, 0xc8, 0xc6, 0xc9, 0xbf, 0xe0, 0xf4, 0xf4, 0x01, 0x56, 0x01, 0x01, 0xf3, 0xf3, 0x01, 0xf2, 0xda, 0xc1, 0xc3, 0xc9, 0xc9, 0xc5, 0xc5, 0xc5, 0xc9, 0xc5, 0xcd, 0xeb, 0xef, 0xcb, 0xbf, 0xbe, 0xbe, 0xc0, 0xce, 0xe5, 0xe7, 0xd9, 0xd6, 0xd1, 0xc9, 0xc2, 0xc0, 0xc0, 0xc6, 0xce, 0xd9, 0xde, 0xde, 0xdf, 0xd9, 0xd4, 0xd6, 0xd9, 0xca, 0xc8, 0xd6, 0xdf, 0xdf, 0xe1, 0xe1, 0xe1, 0xe3, 0xe2, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe2, 0xe4, 0xe1, 0xe2, 0xe1, 0xe5, 0xe4, 0xdf, 0xe7, 0xe4, 0xcf, 0xc0, 0xc5, 0xca, 0xd1, 0xd6, 0xde, 0xde, 0xdf, 0xe5, 0xe5, 0xe5, 0xeb, 0xe5, 0xeb, 0xeb, 0xeb, 0xe5, 0xe5, 0xe5, 0xe5, 0xd6, 0xcd, 0xcd, 0xd8, 0xe5, 0xe7, 0xe7, 0xe1, 0xe4, 0xe1, 0xe4, 0xe2, 0xe7, 0xe4, 0xe7, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe7, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe9, 0xe3, 0xe6, 0xef, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xdd, 0xc0, 0xbf, 0xbc, 0xbc, 0xbe, 0xbe, 0xc0, 0xc2, 0xca, 0xce, 0xd1, 0xd4, 0xd8, 0xde, 0xde, 0xe1, 0xe5, 0xdf, 0xe5, 0xe7, 0xe7, 0xe7, 0xe5, 0xe5, 0xeb, 0xe7, 0xe7, 0xe7, 0xda, 0xdd, 0xe7, 0xea, 0xe6, 0xe6, 0xea, 0xed, 0xee, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf0, 0xf3, 0xf0, 0xf2, 0xef, 0xd7, 0xc3, 0xc9, 0xc9, 0xc8, 0xc9, 0xc1, 0xd0, 0xf4, 0xf4, 0x01, 0x01, 0xf3, 0x56, 0x01, 0x01, 0x01, 0xe4, 0xc3, 0xc1, 0xc4, 0xc0, 0xc5, 0xcc, 0xca, 0xc1, 0xc1, 0xc5, 0xdd, 0xf1, 0xeb, 0xc1, 0xd5, 0xd6, 0xd3, 0xca, 0xc0, 0xbe, 0xbc, 0xd9, 0xdc, 0xde, 0xde, 0xe5, 0xe5, 0xde, 0xce, 0xc8, 0xbf, 0xbe, 0xbf, 0xbf, 0xd9, 0xd1, 0xd6, 0xde, 0xcc, 0xcc, 0xde, 0xe5, 0xdf, 0xdf, 0xe1, 0xe6, 0xe1, 0xe0, 0xe4, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe1, 0xe2, 0xe4, 0xe1, 0xe4, 0xe1, 0xe4, 0xe1, 0xdf, 0xe7, 0xe4, 0xcf, 0xbf, 0xbc, 0xbc, 0xbe, 0xbf, 0xc0, 0xc2, 0xc5, 0xcd, 0xce, 0xce, 0xd3, 0xd6, 0xd6, 0xd9, 0xde, 0xde, 0xe5, 0xeb, 0xeb, 0xe5, 0xd6, 0xd3, 0xdf, 0xe7, 0xe1, 0xe1, 0xe4, 0xe2, 0xe4, 0xe1, 0xe4, 0xe4, 0xe4, 0xe6, 0xe1, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe6, 0xe4, 0xe6, 0xe2, 0xed, 0xf2, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xef, 0xdf, 0xd8, 0xcc, 0xcc, 0xc2, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbc, 0xbe, 0xbe, 0xbe, 0xbf, 0xbe, 0xbf, 0xbf, 0xbf, 0xc0, 0xc0, 0xc0, 0xc1, 0xc8, 0xc9, 0xc9, 0xc8, 0xcc, 0xd5, 0xdd, 0xe4, 0xea, 0xea, 0xe8, 0xea, 0xe6, 0xf0, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf0, 0xf2, 0xe4, 0xc5, 0xc9, 0xc9, 0xc8, 0xc8, 0xc7, 0xc5, 0xf0, 0xf4, 0xf4, 0x56, 0xf3, 0xf3, 0x01, 0x01, 0xe8, 0xc3, 0xbf, 0xc7, 0xc4, 0xc2, 0xc6, 0xca, 0xc6, 0xc6, 0xc3, 0xce, 0xef, 0xf1, 0xd9, 0xd1, 0xc6, 0xcc, 0xcc, 0xcc, 0xce, 0xd6, 0xce, 0xbe, 0xbe, 0xc0, 0xc4, 0xcc, 0xd1, 0xd4, 0xde, 0xdf, 0xeb, 0xe5, 0xde, 0xdc, 0xbe, 0xbe, 0xbc, 0xbe, 0xcc, 0xe5, 0xe7, 0xdf, 0xe1, 0xe4, 0xe1, 0xe1, 0xe1, 0xe6, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe2, 0xe2, 0xe1, 0xe4, 0xe2, 0xe4, 0xe1, 0xdf, 0xe4, 0xe4, 0xdf, 0xdd, 0xcd, 0xc9, 0xc9, 0xc2, 0xc0, 0xbf, 0xbf, 0xc0, 0xbe, 0xbe, 0xbf, 0xc0, 0xbf, 0xc0, 0xc0, 0xc1, 0xc2, 0xc6, 0xc8, 0xca, 0xce, 0xd3, 0xdc, 0xe5, 0xe4, 0xe7, 0xe1, 0xe4, 0xe4, 0xe1, 0xe4, 0xe2, 0xe6, 0xe4, 0xe4, 0xe4, 0xe1, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe7, 0xe2, 0xe7, 0xe4, 0xe4, 0xe6, 0xe4, 0xe2, 0xe6, 0xe6, 0xe8, 0xf1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xe6, 0xda, 0xd8, 0xce, 0xd9, 0xd9, 0xd6, 0xd6, 0xd4, 0xd1, 0xcc, 0xc9, 0xc8, 0xc5, 0xc1, 0xc0, 0xbf, 0xc0, 0xbf, 0xc0, 0xbf, 0xbf, 0xbf, 0xbf, 0xbe, 0xbf, 0xbf, 0xbe, 0xc0, 0xcb, 0xdf, 0xe9, 0xe9, 0xea, 0xe9, 0xe8, 0xea, 0xf3, 0xf4, 0x01, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf0, 0xf4, 0xec, 0xcb, 0xcb, 0xc6, 0xc8, 0xc4, 0xc9, 0xc0, 0xe3, 0xf4, 0xf3, 0xf3, 0x01, 0xf3, 0x01, 0xf0, 0xcf, 0xbf, 0xc3, 0xc1, 0xc8, 0xcc, 0xc2, 0xc0, 0xc2, 0xcb, 0xc5, 0xe0, 0xf2, 0xeb, 0xd6, 0xd6, 0xcc, 0xce, 0xcc, 0xc6, 0xca, 0xca, 0xca, 0xd6, 0xd1, 0xcc, 0xc4, 0xc0, 0xbe, 0xbf, 0xbf, 0xbf, 0xbf, 0xc0, 0xc4, 0xc8, 0xd9, 0xdc, 0xce, 0xcc, 0xdc, 0xe7, 0xdd, 0xdf, 0xe1, 0xe7, 0xe4, 0xe1, 0xe1, 0xe4, 0xe4, 0xe3, 0xe4, 0xe0, 0xe4, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe4, 0xe6, 0xe3, 0xe4, 0xe1, 0xe4, 0xe1, 0xe4, 0xe1, 0xe1, 0xe1, 0xe4, 0xdf, 0xe1, 0xdf, 0xd8, 0xd6, 0xd6, 0xd3, 0xcd, 0xcd, 0xca, 0xc6, 0xc2, 0xc1, 0xc0, 0xc0, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbe, 0xbe, 0xbe, 0xc0, 0xd5, 0xe5, 0xe1, 0xe4, 0xe1, 0xe9, 0xe4, 0xdf, 0xe4, 0xe6, 0xe4, 0xe4, 0xe6, 0xe9, 0xe4, 0xe9, 0xe4, 0xe1, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe7, 0xe4, 0xe1, 0xe4, 0xe6, 0xe2, 0xe3, 0xe4, 0xe8, 0xe6, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf1, 0xe0, 0xd8, 0xd4, 0xd4, 0xce, 0xd4, 0xd4, 0xce, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xd1, 0xce, 0xcc, 0xd1, 0xce, 0xcb, 0xd2, 0xda, 0xe4, 0xe4, 0xea, 0xec, 0xe6, 0xe6, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf0, 0xf2, 0xf0, 0xd2, 0xcd, 0xc3, 0xc6, 0xc9, 0xc3, 0xc3, 0xda, 0xf4, 0xf4, 0xf3, 0xf3, 0x01, 0xf0, 0xd0, 0xc3, 0xc7, 0xc8, 0xc4, 0xc2, 0xc6, 0xc4, 0xc0, 0xc8, 0xc5, 0xd2, 0xf1, 0xf1, 0xdd, 0xd8, 0xd3, 0xce, 0xce, 0xce, 0xcc, 0xca, 0xca, 0xcc, 0xca, 0xca, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xcc, 0xcc, 0xc9, 0xc8, 0xc4, 0xc4, 0xc5, 0xc8, 0xd4, 0xe1, 0xe1, 0xdf, 0xe7, 0xdf, 0xe1, 0xe1, 0xdd, 0xe1, 0xe4, 0xe4, 0xe4, 0xdd, 0xe4, 0xe9, 0xe1, 0xe0, 0xe0, 0xe0, 0xe4, 0xe6, 0xe0, 0xe0, 0xe9, 0xe2, 0xe2, 0xe4, 0xe2, 0xdf, 0xe1, 0xe1, 0xe4, 0xdf, 0xe4, 0xe1, 0xdd, 0xd8, 0xd3, 0xd3, 0xd3, 0xd4, 0xd6, 0xd3, 0xd3, 0xcd, 0xcd, 0xca, 0xc9, 0xc6, 0xc2, 0xc1, 0xc0, 0xc0, 0xc1, 0xc0, 0xc0, 0xd3, 0xe4, 0xe4, 0xe7, 0xe4, 0xe0, 0xe9, 0xe4, 0xe6, 0xe1, 0xe0, 0xe7, 0xec, 0xec, 0xef, 0xef, 0xea, 0xec, 0xec, 0xe1, 0xe4, 0xe9, 0xe1, 0xe1, 0xe9, 0xdf, 0xe0, 0xe6, 0xe6, 0xe2, 0xe6, 0xe2, 0xe4, 0xe3, 0xe0, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf0, 0xda, 0xd5, 0xd5, 0xd4, 0xd6, 0xd4, 0xce, 0xd4, 0xce, 0xd4, 0xd1, 0xd4, 0xd2, 0xd4, 0xd1, 0xd1, 0xd1, 0xd6, 0xd4, 0xd6, 0xd4, 0xd6, 0xd4, 0xd6, 0xd5, 0xd6, 0xd5, 0xd5, 0xda, 0xe4, 0xe9, 0xe6, 0xe8, 0xe9, 0xe8, 0xea, 0xf0, 0xf4, 0xf4, 0xff, 0x83, 0xff, 0xf4, 0x01, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf2, 0xf2, 0xe0, 0xc7, 0xc4, 0xc9, 0xc8, 0xc8, 0xc3, 0xd3, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xe0, 0xbd, 0xc5, 0xc9, 0xc4, 0xc6, 0xc2, 0xc4, 0xca, 0xc4, 0xc0, 0xcb, 0xdd, 0xf4, 0xf2, 0xd5, 0xd1, 0xd4, 0xd1, 0xce, 0xd4, 0xd4, 0xce, 0xce, 0xcc, 0xca, 0xc9, 0xcc, 0xca, 0xcc, 0xc9, 0xca, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd4, 0xd2, 0xda, 0xe1, 0xe1, 0xe1, 0xe1, 0xdd, 0xe9, 0xe4, 0xde, 0xe4, 0xe7, 0xe1, 0xe7, 0xea, 0xf1, 0xef, 0xec, 0xec, 0xef, 0xec, 0xdd, 0xda, 0xe9, 0xec, 0xe0, 0xe1, 0xe2, 0xe4, 0xe1, 0xe1, 0xdf, 0xe1, 0xe4, 0xe1, 0xe1, 0xe1, 0xdf, 0xda, 0xd6, 0xd6, 0xd1, 0xd1, 0xd3, 0xd4, 0xd1, 0xd4, 0xd3, 0xd3, 0xd1, 0xd1, 0xd3, 0xd1, 0xce, 0xcd, 0xcd, 0xc9, 0xcb, 0xda, 0xe7, 0xe4, 0xdf, 0xe4, 0xe1, 0xe9, 0xe4, 0xe1, 0xe9, 0xf1, 0xeb, 0xd5, 0xbc, 0xba, 0xb8, 0xba, 0xbf, 0xda, 0xef, 0xe9, 0xe1, 0xe1, 0xe7, 0xe4, 0xe1, 0xe7, 0xe9, 0xe4, 0xe4, 0xe2, 0xe4, 0xe3, 0xe6, 0xe3, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xed, 0xdd, 0xda, 0xda, 0xd6, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd4, 0xd1, 0xd4, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd1, 0xd1, 0xd1, 0xd1, 0xd3, 0xd7, 0xdf, 0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 0xf0, 0xf4, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xf3, 0xf4, 0xee, 0xc7, 0xc5, 0xc9, 0xc8, 0xca, 0xc3, 0xcd, 0xec, 0xf4, 0xf4, 0x01, 0xd7, 0xc0, 0xc3, 0xc5, 0xc2, 0xc1, 0xc2, 0xc9, 0xca, 0xc0, 0xc0, 0xc7, 0xe1, 0xee, 0xf1, 0xee, 0xdd, 0xd7, 0xd1, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xce, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xc8, 0xc8, 0xd8, 0xdd, 0xe4, 0xe4, 0xe6, 0xe6, 0xe0, 0xe7, 0xe9, 0xdf, 0xde, 0xe9, 0xeb, 0xdf, 0xc8, 0xbb, 0xba, 0xbe, 0xc5, 0xdf, 0xf2, 0xec, 0xdf, 0xe2, 0xe9, 0xe2, 0xe1, 0xe4, 0xe2, 0xdf, 0xe1, 0xdf, 0xe4, 0xdf, 0xe1, 0xe5, 0xdd, 0xdc, 0xd8, 0xd6, 0xd3, 0xd4, 0xd6, 0xd4, 0xd3, 0xce, 0xd1, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xcf, 0xd2, 0xdd, 0xe2, 0xdd, 0xe2, 0xef, 0xe1, 0xe0, 0xe0, 0xdf, 0xef, 0xdc, 0xba, 0xb2, 0xab, 0xa8, 0xa7, 0xa8, 0xa4, 0xb2, 0xbe, 0xe7, 0xeb, 0xe1, 0xe4, 0xe1, 0xe9, 0xe9, 0xe1, 0xe2, 0xe6, 0xe4, 0xe2, 0xe6, 0xe2, 0xe3, 0xed, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf0, 0xe0, 0xda, 0xd8, 0xd3, 0xd1, 0xd4, 0xd1, 0xd4, 0xd3, 0xd8, 0xd4, 0xd2, 0xd4, 0xd1, 0xd4, 0xd4, 0xd1, 0xd6, 0xd4, 0xd6, 0xd4, 0xd6, 0xd4, 0xd6, 0xd1, 0xd5, 0xd2, 0xd8, 0xdd, 0xe1, 0xe6, 0xe9, 0xe3, 0xe6, 0xee, 0xf2, 0xf4, 0xf4, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf3, 0x01, 0xf3, 0xf4, 0xf2, 0xd0, 0xc8, 0xc8, 0xc9, 0xc9, 0xc5, 0xc5, 0xe6, 0xf4, 0xf4, 0xdf, 0xbe, 0xbf, 0xcf, 0xc4, 0xc0, 0xca, 0xc6, 0xc6, 0xc1, 0xc4, 0xcb, 0xd5, 0xee, 0xf0, 0xee, 0xe6, 0xd7, 0xda, 0xd3, 0xd8, 0xd4, 0xd4, 0xce, 0xd4, 0xd4, 0xd4, 0xd6, 0xd4, 0xd6, 0xd3, 0xd4, 0xd1, 0xd4, 0xd3, 0xd1, 0xd4, 0xce, 0xce, 0xce, 0xc9, 0xd8, 0xe1, 0xe7, 0xe6, 0xe0, 0xe0, 0xe0, 0xe4, 0xe1, 0xdd, 0xe5, 0xeb, 0xd6, 0xba, 0xb4, 0xab, 0xae, 0xad, 0xa6, 0xad, 0xb0, 0xbb, 0xdf, 0xeb, 0xd9, 0xeb, 0xe2, 0xe2, 0xe4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe4, 0xdf, 0xe1, 0xe1, 0xe1, 0xdd, 0xd8, 0xd1, 0xd6, 0xd5, 0xd8, 0xd4, 0xce, 0xd2, 0xd2, 0xd4, 0xd2, 0xd1, 0xd1, 0xd1, 0xcd, 0xce, 0xcd, 0xd1, 0xda, 0xe1, 0xe1, 0xe0, 0xe4, 0xea, 0xe0, 0xe4, 0xea, 0xf1, 0xbf, 0xad, 0xa0, 0xa7, 0xab, 0xb0, 0xb4, 0xab, 0xb1, 0xa8, 0x98, 0xb8, 0xe5, 0xef, 0xe7, 0xdd, 0xec, 0xdf, 0xe0, 0xe4, 0xe2, 0xe4, 0xe2, 0xe6, 0xe3, 0xe3, 0xed, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0xe3, 0xdd, 0xd7, 0xd3, 0xd2, 0xd3, 0xd1, 0xd2, 0xd4, 0xd2, 0xd4, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd4, 0xd5, 0xd4, 0xd5, 0xd4, 0xd6, 0xd2, 0xd4, 0xd2, 0xd8, 0xda, 0xdf, 0xe4, 0xe9, 0xe6, 0xe4, 0xe6, 0xf0, 0xf4, 0xf3, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf2, 0xf4, 0xdf, 0xc7, 0xc5, 0xc8, 0xca, 0xc5, 0xc9, 0xe4, 0xf4, 0xee, 0xbe, 0xc3, 0xc8, 0xc6, 0xc0, 0xc6, 0xca, 0xc6, 0xc2, 0xc1, 0xd8, 0xef, 0xf2, 0xee, 0xed, 0xf3, 0xe6, 0xd0, 0xd0, 0xda, 0xdc, 0xd8, 0xd6, 0xd4, 0xce, 0xce, 0xce, 0xd1, 0xd4, 0xd1, 0xd4, 0xd3, 0xd4, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xd1, 0xcc, 0xda, 0xe4, 0xe4, 0xe4, 0xe3, 0xe0, 0xe6, 0xe6, 0xe0, 0xeb, 0xef, 0xbf, 0xb5, 0xb1, 0xb0, 0xb4, 0xb6, 0xb6, 0xb4, 0xb4, 0xb0, 0xa7, 0xb4, 0xcc, 0xef, 0xde, 0xe2, 0xe1, 0xe4, 0xe1, 0xe1, 0xdf, 0xe1, 0xe1, 0xdf, 0xdf, 0xe4, 0xdf, 0xdf, 0xdc, 0xd9, 0xda, 0xd9, 0xdc, 0xd8, 0xd8, 0xd6, 0xd6, 0xd5, 0xd4, 0xd2, 0xd1, 0xd1, 0xd3, 0xd3, 0xd1, 0xd5, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xdd, 0xe0, 0xec, 0xec, 0xc0, 0xb1, 0xa1, 0xb4, 0xb3, 0xa9, 0xae, 0xa9, 0xa8, 0xb0, 0xb0, 0xa7, 0xa3, 0xb7, 0xe4, 0xec, 0xdd, 0xe1, 0xe0, 0xe4, 0xe6, 0xe4, 0xe2, 0xe4, 0xe3, 0xe6, 0xe3, 0xe3, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf0, 0xe0, 0xe3, 0xe1, 0xdd, 0xdc, 0xd8, 0xd8, 0xd5, 0xd3, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd6, 0xd4, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd2, 0xd3, 0xd5, 0xda, 0xe1, 0xe1, 0xe6, 0xea, 0xe6, 0xe8, 0xf0, 0xf4, 0xf2, 0x01, 0xf4, 0x01, 0x83, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xef, 0xcb, 0xc4, 0xc8, 0xc9, 0xc9, 0xc7, 0xdd, 0xec, 0xc7, 0xbf, 0xc4, 0xc4, 0xc2, 0xc8, 0xc6, 0xc0, 0xc2, 0xce, 0xcc, 0xcf, 0xdd, 0xf1, 0xf3, 0xed, 0xf0, 0xed, 0xe0, 0xd7, 0xd0, 0xcf, 0xd6, 0xd8, 0xdc, 0xd9, 0xd4, 0xce, 0xd1, 0xce, 0xd1, 0xd1, 0xd4, 0xd3, 0xd4, 0xd3, 0xd4, 0xd1, 0xd4, 0xd3, 0xce, 0xd2, 0xdf, 0xe1, 0xe0, 0xe0, 0xe8, 0xe3, 0xe6, 0xdd, 0xe9, 0xef, 0xbe, 0xb4, 0xb1, 0xb6, 0xb4, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb6, 0xb3, 0xab, 0xb3, 0xbe, 0xeb, 0xe2, 0xe1, 0xe4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xe1, 0xdf, 0xdf, 0xda, 0xd6, 0xd5, 0xd5, 0xd9, 0xd9, 0xdd, 0xdc, 0xdc, 0xdc, 0xd9, 0xda, 0xd9, 0xd8, 0xd8, 0xd3, 0xd8, 0xe7, 0xe2, 0xe0, 0xe2, 0xe0, 0xe0, 0xe9, 0xe9, 0xcd, 0xb3, 0xb0, 0xb1, 0xb4, 0xb4, 0xb4, 0xb6, 0xb4, 0xb4, 0xa9, 0xa3, 0xac, 0xa8, 0xa1, 0xbb, 0xec, 0xdf, 0xe1, 0xe9, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe6, 0xe3, 0xe6, 0xe3, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xe0, 0xd7, 0xd7, 0xdd, 0xe4, 0xe5, 0xdf, 0xdf, 0xde, 0xde, 0xdc, 0xd8, 0xd6, 0xd4, 0xd1, 0xd4, 0xd1, 0xd1, 0xd1, 0xd4, 0xd4, 0xd1, 0xd3, 0xd3, 0xd6, 0xd5, 0xd1, 0xd2, 0xda, 0xdd, 0xe0, 0xe6, 0xe9, 0xe6, 0xe3, 0xee, 0xf2, 0x01, 0xf3, 0xf4, 0xff, 0xf4, 0xff, 0xf3, 0xf4, 0xf4, 0x01, 0xff, 0x01, 0xff, 0x56, 0x01, 0x56, 0xf3, 0xf3, 0x01, 0xf2, 0xda, 0xc7, 0xc9, 0xc8, 0xc8, 0xcc, 0xcc, 0xcc, 0xbe, 0xc8, 0xc0, 0xc2, 0xc6, 0xc9, 0xc0, 0xc0, 0xd7, 0xeb, 0xdd, 0xc7, 0xd2, 0xda, 0xe0, 0xe8, 0xf1, 0xee, 0xe4, 0xe7, 0xde, 0xd1, 0xd1, 0xd6, 0xd6, 0xd8, 0xd9, 0xd9, 0xd8, 0xd8, 0xd6, 0xd3, 0xd1, 0xce, 0xd1, 0xd1, 0xd1, 0xce, 0xcf, 0xd1, 0xd8, 0xdc, 0xe1, 0xe4, 0xe4, 0xe1, 0xe4, 0xe0, 0xe1, 0xe1, 0xf2, 0xbb, 0xb6, 0xb1, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb4, 0xb4, 0xb3, 0xb3, 0xac, 0xb3, 0xc0, 0xef, 0xe4, 0xdd, 0xe1, 0xe1, 0xe6, 0xdf, 0xe4, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xdf, 0xd9, 0xcf, 0xc8, 0xc9, 0xcb, 0xc9, 0xce, 0xce, 0xd1, 0xd1, 0xd4, 0xd4, 0xd6, 0xd6, 0xd3, 0xd8, 0xdd, 0xdf, 0xe2, 0xe4, 0xe0, 0xe6, 0xe0, 0xec, 0xe0, 0xb8, 0xb0, 0xb4, 0xb6, 0xb6, 0xb4, 0xb3, 0xb5, 0xb4, 0xb4, 0xb6, 0xb3, 0xa3, 0xa3, 0xa1, 0xad, 0xd6, 0xe2, 0xeb, 0xe4, 0xe1, 0xe3, 0xe4, 0xe4, 0xe3, 0xe4, 0xe6, 0xe2, 0xe3, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf1, 0xc7, 0xc1, 0xc5, 0xd1, 0xdf, 0xe5, 0xd6, 0xde, 0xde, 0xdf, 0xe5, 0xdf, 0xe5, 0xe7, 0xe5, 0xdf, 0xdf, 0xde, 0xde, 0xdf, 0xde, 0xdc, 0xd9, 0xd6, 0xd6, 0xd6, 0xdd, 0xda, 0xda, 0xdd, 0xe0, 0xe6, 0xea, 0xe8, 0xe3, 0xf0, 0xf3, 0xf4, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x56, 0x56, 0x56, 0x56, 0x01, 0xf3, 0x01, 0xf4, 0xe2, 0xc7, 0xc5, 0xc4, 0xc9, 0xca, 0xc4, 0xc0, 0xc0, 0xbf, 0xc2, 0xc2, 0xbf, 0xbf, 0xc7, 0xda, 0xe3, 0xeb, 0xe4, 0xd8, 0xd5, 0xda, 0xdf, 0xec, 0xee, 0xd3, 0xd1, 0xdc, 0xdf, 0xeb, 0xe5, 0xdf, 0xdc, 0xd8, 0xd2, 0xd1, 0xda, 0xd8, 0xdd, 0xdf, 0xe1, 0xe7, 0xdf, 0xda, 0xda, 0xda, 0xdf, 0xe1, 0xe4, 0xdf, 0xe1, 0xe1, 0xe4, 0xe4, 0xe3, 0xe1, 0xe6, 0xe7, 0xd8, 0xb7, 0xb3, 0xb7, 0xb6, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb3, 0xb4, 0xb1, 0xad, 0xb6, 0xe7, 0xef, 0xdf, 0xe4, 0xe1, 0xe9, 0xdd, 0xe1, 0xe1, 0xe1, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xd3, 0xcf, 0xcf, 0xcd, 0xcd, 0xc5, 0xc2, 0xc5, 0xc4, 0xc6, 0xc6, 0xc4, 0xc5, 0xc9, 0xd5, 0xe1, 0xe1, 0xe3, 0xe9, 0xe0, 0xe9, 0xe0, 0xe9, 0xcb, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb1, 0xb3, 0xb3, 0xaf, 0xa9, 0xa3, 0xa0, 0xba, 0xeb, 0xeb, 0xe1, 0xe9, 0xe6, 0xe3, 0xe6, 0xe6, 0xe4, 0xe4, 0xe4, 0xe2, 0xed, 0xf4, 0xf4, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xe9, 0xd2, 0xd2, 0xd2, 0xc9, 0xc5, 0xca, 0xd8, 0xd4, 0xd6, 0xd6, 0xd6, 0xd9, 0xd8, 0xd6, 0xd6, 0xd9, 0xd8, 0xd9, 0xdc, 0xd6, 0xdc, 0xde, 0xe5, 0xe5, 0xe5, 0xdf, 0xe0, 0xda, 0xe0, 0xe0, 0xe0, 0xe8, 0xea, 0xe3, 0xe8, 0xf0, 0xf4, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0x01, 0x01, 0xf4, 0xf4, 0xf3, 0xf4, 0x56, 0x56, 0x56, 0x56, 0xff, 0x01, 0xf3, 0xf4, 0x01, 0xf2, 0xd7, 0xc7, 0xc9, 0xc8, 0xc2, 0xbe, 0xbe, 0xbe, 0xc8, 0xc0, 0xc0, 0xc6, 0xce, 0xcd, 0xd3, 0xd6, 0xd7, 0xd8, 0xd2, 0xcc, 0xd2, 0xc7, 0xe1, 0xe1, 0xc1, 0xc0, 0xc1, 0xca, 0xce, 0xd4, 0xd9, 0xde, 0xdf, 0xe4, 0xdf, 0xd8, 0xd5, 0xd3, 0xd1, 0xcd, 0xcd, 0xd1, 0xd8, 0xd3, 0xd8, 0xdc, 0xd8, 0xd1, 0xdd, 0xe1, 0xe4, 0xe2, 0xe4, 0xe1, 0xe2, 0xe9, 0xdf, 0xb9, 0xb4, 0xb4, 0xb9, 0xb4, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb0, 0xa7, 0xbc, 0xef, 0xe4, 0xe7, 0xdd, 0xec, 0xdd, 0xe3, 0xe1, 0xe2, 0xdf, 0xe2, 0xdf, 0xe1, 0xdf, 0xd8, 0xd8, 0xda, 0xd8, 0xd6, 0xd3, 0xd8, 0xd4, 0xd1, 0xd1, 0xce, 0xce, 0xd1, 0xd8, 0xdf, 0xe7, 0xe0, 0xe0, 0xe0, 0xe4, 0xe0, 0xe7, 0xdd, 0xb9, 0xb3, 0xb4, 0xb6, 0xb4, 0xb1, 0xb6, 0xb7, 0xb4, 0xb6, 0xb6, 0xb4, 0xb4, 0xb6, 0xac, 0xa1, 0x9e, 0xa5, 0xdf, 0xe4, 0xe9, 0xe4, 0xe4, 0xe6, 0xe4, 0xe3, 0xe4, 0xe4, 0xe4, 0xe2, 0xe9, 0xf4, 0xf4, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xef, 0xdf, 0xe4, 0xdf, 0xcf, 0xcc, 0xc4, 0xc1, 0xc2, 0xc4, 0xc8, 0xce, 0xd1, 0xd4, 0xd3, 0xd4, 0xd8, 0xd9, 0xdc, 0xde, 0xdf, 0xde, 0xdc, 0xd6, 0xd3, 0xce, 0xcb, 0xcf, 0xd7, 0xe1, 0xe9, 0xe4, 0xe4, 0xe8, 0xe8, 0xe8, 0xf3, 0xf3, 0xff, 0xf4, 0x56, 0xf4, 0xf4, 0xff, 0xf3, 0xf3, 0xf2, 0x83, 0xf3, 0xf4, 0x56, 0x01, 0x56, 0x01, 0xf4, 0x01, 0xf2, 0xf4, 0xf2, 0xe7, 0xd1, 0xc8, 0xbf, 0xbc, 0xbb, 0xbb, 0xbc, 0xbc, 0xbe, 0xc0, 0xc0, 0xbe, 0xba, 0xb8, 0xb3, 0xb0, 0xb0, 0xae, 0xab, 0xaa, 0xb7, 0xd0, 0xe4, 0xcd, 0xcf, 0xc0, 0xbe, 0xc2, 0xc4, 0xc8, 0xcd, 0xd1, 0xd3, 0xd5, 0xde, 0xdd, 0xdf, 0xe1, 0xe5, 0xe7, 0xdf, 0xdc, 0xdc, 0xdc, 0xd8, 0xd3, 0xd1, 0xdf, 0xe1, 0xe1, 0xe4, 0xe1, 0xe4, 0xe2, 0xe9, 0xc8, 0xb5, 0xb7, 0xb7, 0xb7, 0xb6, 0xb7, 0xb7, 0xb7, 0xb6, 0xb6, 0xb7, 0xb7, 0xb7, 0xb4, 0xb1, 0xb4, 0xb3, 0xb1, 0xb3, 0xd8, 0xe7, 0xe1, 0xe4, 0xe4, 0xe4, 0xe1, 0xe0, 0xe1, 0xe1, 0xdf, 0xe2, 0xde, 0xda, 0xd3, 0xd0, 0xd3, 0xd3, 0xd5, 0xd8, 0xd8, 0xd6, 0xd9, 0xd9, 0xd9, 0xd9, 0xdf, 0xdf, 0xe2, 0xe1, 0xe0, 0xe4, 0xe3, 0xe6, 0xe0, 0xe9, 0xcd, 0xb2, 0xb3, 0xb4, 0xb4, 0xb4, 0xb6, 0xb4, 0xb4, 0xac, 0xab, 0xb3, 0xb6, 0xb6, 0xb3, 0xb1, 0xa9, 0xa3, 0x9a, 0xbc, 0xef, 0xdf, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe6, 0xe2, 0xe4, 0xe4, 0xe6, 0xf3, 0xf4, 0x83, 0x01, 0x01, 0x01, 0xff, 0x83, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xec, 0xdd, 0xdd, 0xd8, 0xd8, 0xdf, 0xdc, 0xd4, 0xd1, 0xc9, 0xc4, 0xc1, 0xbf, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xbf, 0xbf, 0xbf, 0xc0, 0xc4, 0xc9, 0xcd, 0xd3, 0xd5, 0xe0, 0xe6, 0xe4, 0xe8, 0xe8, 0xe8, 0xed, 0xf2, 0xf4, 0xf3, 0xf4, 0x01, 0xf4, 0xff, 0xf3, 0xf4, 0x01, 0x01, 0xf4, 0xf4, 0xf2, 0xf3, 0xff, 0xf4, 0xf3, 0xf4, 0x01, 0xf2, 0xf2, 0xf4, 0xf1, 0xd2, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0xbc, 0xbb, 0xb7, 0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xb3, 0xb5, 0xb7, 0xfa, 0xba, 0xdd, 0xe6, 0xd3, 0xd8, 0xcc, 0xcf, 0xc2, 0xc1, 0xc0, 0xc1, 0xc1, 0xc5, 0xc7, 0xc8, 0xc9, 0xc8, 0xc9, 0xc9, 0xcc, 0xcc, 0xce, 0xd1, 0xcc, 0xc8, 0xc8, 0xd1, 0xdf, 0xe1, 0xe0, 0xe0, 0xe1, 0xe4, 0xe4, 0xe4, 0xbb, 0xb4, 0xb7, 0xb7, 0xb6, 0xb7, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0xb7, 0xb6, 0xb6, 0xb4, 0xb3, 0xb4, 0xb3, 0xab, 0xbe, 0xe9, 0xdf, 0xe9, 0xdd, 0xe8, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xdf, 0xe1, 0xdf, 0xd7, 0xd1, 0xcf, 0xcd, 0xcf, 0xcb, 0xcc, 0xcd, 0xce, 0xcd, 0xce, 0xcf, 0xce, 0xd8, 0xdf, 0xe0, 0xe4, 0xe6, 0xe1, 0xe4, 0xe4, 0xe4, 0xbc, 0xad, 0xb5, 0xb4, 0xb3, 0xb4, 0xb6, 0xad, 0x9a, 0x9a, 0x95, 0x98, 0xa5, 0xb3, 0xb6, 0xb3, 0xaf, 0xa3, 0xa1, 0xb3, 0xf4, 0xdf, 0xe4, 0xe6, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe2, 0xe6, 0xe2, 0xf3, 0xf4, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xe2, 0xda, 0xdf, 0xdd, 0xdd, 0xdc, 0xd3, 0xd9, 0xd8, 0xd9, 0xd6, 0xd8, 0xd8, 0xd4, 0xd3, 0xcf, 0xcd, 0xcc, 0xcd, 0xc9, 0xcf, 0xce, 0xd1, 0xd3, 0xd8, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 0xe4, 0xe2, 0xea, 0xea, 0xe8, 0xed, 0xf3, 0xf3, 0xff, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xc8, 0xbb, 0xba, 0xb9, 0xbb, 0xba, 0xbb, 0xbc, 0xba, 0xb4, 0xb1, 0xb4, 0xb4, 0xb3, 0xb1, 0xb3, 0xb3, 0xb5, 0xfb, 0xb7, 0xc3, 0xee, 0xe4, 0xd5, 0xd5, 0xd8, 0xde, 0xd9, 0xd6, 0xd1, 0xc9, 0xc3, 0xc1, 0xc0, 0xbf, 0xc0, 0xc1, 0xc4, 0xc8, 0xc8, 0xc4, 0xc1, 0xc9, 0xc4, 0xc4, 0xcc, 0xd8, 0xe1, 0xe3, 0xe1, 0xe0, 0xe1, 0xe4, 0xe7, 0xd5, 0xb7, 0xb6, 0xb7, 0xb7, 0xb6, 0xb7, 0xb7, 0xb7, 0xb6, 0xb6, 0xb6, 0xb8, 0xb6, 0xb6, 0xb7, 0xb7, 0xb1, 0xb4, 0xb1, 0xae, 0xb8, 0xdf, 0xe4, 0xe7, 0xdd, 0xe6, 0xe1, 0xe0, 0xe1, 0xe1, 0xdf, 0xe2, 0xe7, 0xe9, 0xe1, 0xda, 0xd3, 0xd0, 0xcf, 0xd1, 0xd1, 0xd1, 0xcf, 0xce, 0xcd, 0xcc, 0xcf, 0xdf, 0xe7, 0xe6, 0xe4, 0xe0, 0xdd, 0xe6, 0xe9, 0xdc, 0xb8, 0xb2, 0xb5, 0xb4, 0xb4, 0xb4, 0xac, 0x9a, 0x90, 0x92, 0x95, 0x92, 0x97, 0xac, 0xb6, 0xb4, 0xb0, 0xa5, 0xa3, 0x9e, 0xef, 0xe4, 0xe9, 0xe8, 0xe4, 0xe3, 0xe4, 0xe6, 0xe4, 0xe4, 0xe2, 0xe0, 0xf3, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xff, 0x83, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xee, 0xdd, 0xda, 0xdc, 0xdd, 0xdc, 0xd6, 0xd8, 0xd9, 0xda, 0xd9, 0xd8, 0xd6, 0xda, 0xdc, 0xdc, 0xd9, 0xda, 0xdc, 0xdc, 0xd9, 0xda, 0xdc, 0xdc, 0xdc, 0xd8, 0xda, 0xd8, 0xdd, 0xe4, 0xe8, 0xe4, 0xe6, 0xe8, 0xe8, 0xee, 0xf3, 0xf4, 0xf3, 0xf4, 0xff, 0xff, 0x01, 0xf4, 0xf0, 0xf2, 0xf1, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0xec, 0xd8, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0xb9, 0xb9, 0xb9, 0xb7, 0xb0, 0xae, 0xb3, 0xb5, 0xb3, 0xb4, 0xb2, 0xb8, 0x30, 0xbb, 0x30, 0xe0, 0xe8, 0xe0, 0xdd, 0xd8, 0xd8, 0xd3, 0xd6, 0xd8, 0xd9, 0xda, 0xdc, 0xd8, 0xd5, 0xcc, 0xcc, 0xc8, 0xc4, 0xc1, 0xc0, 0xc1, 0xc8, 0xc8, 0xcc, 0xce, 0xd8, 0xde, 0xe4, 0xe4, 0xe0, 0xe0, 0xe1, 0xe2, 0xe7, 0xbf, 0xb3, 0xb8, 0xb7, 0xb6, 0xb7, 0xb7, 0xb6, 0xa5, 0x92, 0x92, 0x9e, 0xb1, 0xb7, 0xb4, 0xb7, 0xb7, 0xb1, 0xb4, 0xb4, 0xab, 0xb4, 0xd1, 0xe4, 0xdf, 0xe6, 0xe0, 0xe1, 0xe1, 0xe0, 0xdf, 0xe2, 0xdf, 0xe0, 0xe1, 0xe9, 0xe4, 0xe0, 0xdc, 0xd8, 0xd5, 0xd3, 0xd1, 0xd1, 0xd1, 0xce, 0xd1, 0xd5, 0xe2, 0xe4, 0xe0, 0xe4, 0xe4, 0xe1, 0xe4, 0xef, 0xd5, 0xb3, 0xb4, 0xb4, 0xb3, 0xb6, 0xb3, 0x9a, 0x90, 0x92, 0x92, 0x92, 0x95, 0x95, 0x9e, 0xb3, 0xb7, 0xb4, 0xa5, 0xa0, 0x9e, 0xdd, 0xe7, 0xe1, 0xe6, 0xe3, 0xe4, 0xe3, 0xe4, 0xe2, 0xe4, 0xe6, 0xe0, 0xf0, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf2, 0xe0, 0xd8, 0xd5, 0xdc, 0xe4, 0xdc, 0xda, 0xd8, 0xd8, 0xd6, 0xda, 0xdc, 0xd9, 0xd8, 0xd8, 0xda, 0xd8, 0xda, 0xd8, 0xd8, 0xd8, 0xd8, 0xda, 0xd8, 0xd8, 0xd8, 0xda, 0xdf, 0xe1, 0xe4, 0xe4, 0xe8, 0xe8, 0xe6, 0xed, 0xf4, 0xf3, 0xf3, 0xf3, 0x01, 0xf3, 0xff, 0xf2, 0x01, 0xb8, 0xa2, 0xae, 0xb5, 0xb9, 0xbb, 0xba, 0xba, 0xba, 0xb9, 0xb8, 0xb5, 0xb2, 0xb0, 0xb0, 0xb4, 0xb5, 0xb4, 0xb3, 0xb1, 0xb1, 0xb1, 0xae, 0xb2, 0xb2, 0xb5, 0xfa, 0xb5, 0xfb, 0xb8, 0xbd, 0x4a, 0x4a, 0x30, 0x4a, 0xed, 0xe8, 0xdd, 0xdd, 0xda, 0xd5, 0xd2, 0xd8, 0xd8, 0xd5, 0xd8, 0xd5, 0xd7, 0xd8, 0xd9, 0xd9, 0xdc, 0xd9, 0xdc, 0xdc, 0xd9, 0xd6, 0xd9, 0xd9, 0xd9, 0xd9, 0xde, 0xdd, 0xe3, 0xe4, 0xe0, 0xe4, 0xdf, 0xeb, 0xb9, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb1, 0x98, 0x92, 0x95, 0x92, 0x92, 0x90, 0xac, 0xb8, 0xb6, 0xb6, 0xb6, 0xb1, 0xb3, 0xad, 0xb3, 0xbc, 0xef, 0xde, 0xe3, 0xe4, 0xe1, 0xe0, 0xe1, 0xe0, 0xe1, 0xe2, 0xe1, 0xe6, 0xe6, 0xe6, 0xe9, 0xe6, 0xd7, 0xd8, 0xdd, 0xd8, 0xda, 0xd6, 0xd3, 0xd1, 0xdd, 0xe1, 0xe4, 0xe1, 0xe0, 0xe0, 0xe3, 0xdd, 0xf2, 0xbe, 0xae, 0xb5, 0xb4, 0xb4, 0xb6, 0xa7, 0x92, 0x90, 0x94, 0x92, 0x92, 0x97, 0x94, 0x9a, 0xb1, 0xb4, 0xb1, 0xa9, 0xa3, 0x99, 0xbe, 0xf1, 0xe1, 0xe6, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe3, 0xf0, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xff, 0x83, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xe9, 0xe4, 0xdf, 0xdd, 0xdd, 0xd8, 0xdc, 0xdc, 0xdc, 0xda, 0xd6, 0xd2, 0xd8, 0xd8, 0xda, 0xd8, 0xd8, 0xd8, 0xd8, 0xda, 0xdc, 0xda, 0xd8, 0xda, 0xdc, 0xda, 0xda, 0xe0, 0xe1, 0xe3, 0xe4, 0xea, 0xea, 0xe3, 0xee, 0xf3, 0xf4, 0xf3, 0xff, 0xf3, 0xf3, 0x01, 0x01, 0xf4, 0xb2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0xa3, 0xa8, 0xa6, 0xab, 0xa6, 0xa9, 0xae, 0xb0, 0xb2, 0xb0, 0xb1, 0xb1, 0xb3, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xfb, 0xf6, 0xfb, 0xfe, 0xf6, 0x80, 0x4a, 0x80, 0x30, 0x4c, 0xf0, 0xea, 0xe0, 0xd7, 0xd7, 0xd3, 0xd8, 0xd4, 0xd8, 0xd8, 0xda, 0xdc, 0xd7, 0xd5, 0xd5, 0xd6, 0xd8, 0xd8, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd6, 0xd8, 0xd9, 0xdf, 0xe0, 0xe6, 0xe0, 0xe0, 0xe1, 0xdf, 0xe5, 0xb7, 0xb7, 0xb7, 0xb6, 0xb7, 0xb4, 0x9e, 0x92, 0x90, 0x92, 0x92, 0x90, 0x92, 0x95, 0xb1, 0xb7, 0xb4, 0xb6, 0xb4, 0xb1, 0xb0, 0xb1, 0xbb, 0xeb, 0xdf, 0xe1, 0xe4, 0xe0, 0xe1, 0xe0, 0xe1, 0xe1, 0xe0, 0xe0, 0xe4, 0xe6, 0xe4, 0xe9, 0xec, 0xe4, 0xdd, 0xda, 0xda, 0xda, 0xdc, 0xdd, 0xdd, 0xda, 0xe2, 0xe6, 0xe2, 0xe0, 0xe6, 0xe1, 0xe0, 0xf1, 0xbc, 0xae, 0xb4, 0xb4, 0xb6, 0xb4, 0xa1, 0x90, 0x92, 0x95, 0x92, 0x92, 0x95, 0x95, 0x9a, 0xb0, 0xb6, 0xb4, 0xac, 0xa3, 0x99, 0xbc, 0xf1, 0xe0, 0xe6, 0xe3, 0xe4, 0xe3, 0xe6, 0xe4, 0xe2, 0xe6, 0xe2, 0xf0, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xea, 0xe9, 0xe6, 0xe1, 0xdc, 0xd8, 0xdc, 0xdd, 0xde, 0xdd, 0xdc, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd5, 0xdd, 0xda, 0xd8, 0xd8, 0xd8, 0xda, 0xda, 0xdd, 0xdf, 0xe4, 0xe1, 0xe3, 0xea, 0xe8, 0xe8, 0xed, 0xf4, 0xf3, 0xf3, 0xf4, 0xff, 0xff, 0xff, 0xf4, 0xf1, 0xb2, 0xab, 0xab, 0xab, 0xad, 0xb1, 0xb3, 0xb0, 0xad, 0xb0, 0xb1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xfa, 0xb8, 0xfe, 0xfb, 0xfe, 0xfe, 0x2a, 0x2a, 0x2a, 0x2a, 0x80, 0x80, 0x4e, 0xf0, 0xed, 0xe3, 0xe4, 0xdd, 0xdd, 0xdc, 0xda, 0xd8, 0xd8, 0xd5, 0xd7, 0xda, 0xda, 0xd8, 0xd8, 0xd5, 0xd8, 0xd6, 0xd8, 0xda, 0xd8, 0xd8, 0xd2, 0xd5, 0xda, 0xdf, 0xe0, 0xe6, 0xe3, 0xe0, 0xe4, 0xe5, 0xd5, 0xb3, 0xb7, 0xb7, 0xb6, 0xb7, 0xa4, 0x92, 0x90, 0x90, 0x90, 0x92, 0x90, 0x92, 0x8f, 0x9e, 0xb9, 0xb4, 0xb6, 0xb4, 0xb3, 0xaf, 0xae, 0xb9, 0xe7, 0xdf, 0xe4, 0xe4, 0xe3, 0xe1, 0xe3, 0xe1, 0xe0, 0xe1, 0xe0, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe9, 0xe4, 0xe4, 0xdf, 0xdd, 0xdc, 0xdd, 0xde, 0xe0, 0xe2, 0xe6, 0xe4, 0xe3, 0xe4, 0xe3, 0xe0, 0xf1, 0xba, 0xad, 0xb4, 0xb4, 0xb6, 0xb4, 0x9e, 0x90, 0x90, 0x92, 0x92, 0x92, 0x92, 0x95, 0x97, 0xac, 0xb6, 0xb4, 0xb1, 0xa3, 0x9a, 0xba, 0xef, 0xe4, 0xe6, 0xe4, 0xe3, 0xe4, 0xe6, 0xe2, 0xe4, 0xe6, 0xe3, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x83, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0xe6, 0xe9, 0xec, 0xe9, 0xe9, 0xe1, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd8, 0xda, 0xdd, 0xdd, 0xda, 0xe0, 0xe4, 0xe0, 0xe4, 0xe6, 0xe8, 0xe3, 0xee, 0xf3, 0xf4, 0xf3, 0xf3, 0xff, 0x01, 0xf0, 0xf3, 0xf3, 0xb8, 0xa6, 0xb3, 0xb1, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb4, 0xb4, 0xb5, 0xb4, 0xb4, 0xfa, 0xfb, 0xfb, 0xfe, 0x2a, 0x27, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x4c, 0x54, 0xee, 0xe0, 0xe3, 0xe9, 0xe1, 0xdd, 0xdf, 0xdd, 0xd8, 0xd7, 0xd5, 0xdb, 0xda, 0xd7, 0xd8, 0xd8, 0xd8, 0xd7, 0xd8, 0xd5, 0xd5, 0xd7, 0xd5, 0xda, 0xdd, 0xe4, 0xe0, 0xe6, 0xe0, 0xe1, 0xe1, 0xe7, 0xc8, 0xb3, 0xb7, 0xb7, 0xb7, 0xb4, 0x9a, 0x90, 0x95, 0x95, 0x95, 0x92, 0x92, 0x92, 0x90, 0x95, 0xb7, 0xb6, 0xb7, 0xb4, 0xb1, 0xb1, 0xab, 0xb7, 0xde, 0xe5, 0xe4, 0xe1, 0xe3, 0xe1, 0xe3, 0xe4, 0xe1, 0xe4, 0xe0, 0xe0, 0xe6, 0xe6, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe1, 0xe1, 0xdd, 0xe0, 0xe3, 0xe2, 0xe3, 0xe0, 0xe3, 0xe4, 0xe1, 0xef, 0xb9, 0xae, 0xb4, 0xb4, 0xb6, 0xb3, 0xa5, 0x95, 0x92, 0x92, 0x92, 0x92, 0x92, 0x94, 0xa1, 0xb1, 0xb6, 0xb4, 0xb1, 0xa3, 0x9a, 0xb8, 0xf1, 0xe4, 0xe6, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe2, 0xe6, 0xe2, 0xf0, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xef, 0xda, 0xe0, 0xe4, 0xe4, 0xeb, 0xea, 0xe7, 0xe4, 0xdc, 0xd8, 0xd8, 0xd5, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xda, 0xda, 0xdf, 0xe1, 0xe7, 0xe4, 0xda, 0xe1, 0xe4, 0xe1, 0xe3, 0xe6, 0xe8, 0xe8, 0xed, 0xf4, 0xf3, 0xf4, 0xf3, 0xff, 0x01, 0xff, 0xf3, 0x01, 0xbc, 0xab, 0xb4, 0xb4, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb4, 0xb5, 0x30, 0x30, 0x2a, 0x2a, 0x27, 0x2e, 0x37, 0x48, 0x37, 0x2e, 0x27, 0x81, 0x54, 0xee, 0xd0, 0xd0, 0xd7, 0xda, 0xdc, 0xdc, 0xde, 0xe1, 0xe1, 0xe0, 0xda, 0xd7, 0xda, 0xd7, 0xd7, 0xd7, 0xd8, 0xd7, 0xd5, 0xd7, 0xd8, 0xda, 0xdd, 0xdd, 0xe4, 0xe0, 0xe8, 0xe0, 0xe4, 0xe1, 0xef, 0xbe, 0xb4, 0xb6, 0xb7, 0xb8, 0xaf, 0x93, 0x92, 0x98, 0x95, 0x97, 0x95, 0x92, 0x95, 0x92, 0x92, 0xb6, 0xb6, 0xb6, 0xb4, 0xb3, 0xaf, 0xab, 0xb5, 0xdc, 0xe4, 0xe4, 0xe1, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe0, 0xdd, 0xe3, 0xe9, 0xea, 0xe6, 0xe8, 0xe7, 0xe4, 0xe4, 0xe1, 0xdf, 0xda, 0xda, 0xe0, 0xe0, 0xe3, 0xe0, 0xe3, 0xe1, 0xe3, 0xe1, 0xf1, 0xb7, 0xb0, 0xb4, 0xb4, 0xb4, 0xb4, 0xad, 0x9e, 0x92, 0x92, 0x92, 0x95, 0x95, 0x9a, 0xa9, 0xb4, 0xb4, 0xb6, 0xb1, 0xa3, 0xa0, 0xb7, 0xf1, 0xe1, 0xe6, 0xe3, 0xe4, 0xe3, 0xe6, 0xe4, 0xe4, 0xe6, 0xe3, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x83, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xea, 0xd0, 0xd7, 0xdd, 0xd7, 0xda, 0xe1, 0xeb, 0xe7, 0xe5, 0xe2, 0xdf, 0xe1, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdd, 0xe0, 0xe1, 0xe1, 0xe1, 0xdf, 0xdd, 0xdd, 0xe1, 0xe4, 0xe3, 0xe1, 0xe6, 0xe8, 0xe3, 0xee, 0xf3, 0xf4, 0xf3, 0xf4, 0xff, 0xf3, 0xf4, 0xf4, 0x01, 0xdd, 0xbb, 0xb3, 0xb4, 0xb6, 0xb6, 0xb4, 0xaf, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xbd, 0xed, 0x52, 0x4c, 0x3d, 0x37, 0x42, 0x37, 0x32, 0x2e, 0x37, 0x37, 0x48, 0x54, 0xee, 0xd7, 0xc7, 0xc3, 0xcd, 0xd7, 0xd3, 0xd5, 0xdd, 0xdf, 0xe0, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd, 0xdb, 0xdd, 0xdb, 0xdd, 0xdb, 0xe0, 0xe0, 0xe3, 0xe8, 0xdd, 0xe4, 0xde, 0xf1, 0xbb, 0xb4, 0xb6, 0xb7, 0xb7, 0xa9, 0x95, 0x96, 0x98, 0x99, 0x96, 0x95, 0x95, 0x96, 0x92, 0x98, 0xb4, 0xb6, 0xb4, 0xb7, 0xb1, 0xaf, 0xab, 0xb4, 0xda, 0xe5, 0xe4, 0xe0, 0xe4, 0xe4, 0xe4, 0xe4, 0xe3, 0xe4, 0xe0, 0xdb, 0xda, 0xe3, 0xe6, 0xe6, 0xe4, 0xea, 0xe4, 0xe0, 0xda, 0xd8, 0xd8, 0xda, 0xe6, 0xe2, 0xe3, 0xe2, 0xe3, 0xe3, 0xe1, 0xe1, 0xf1, 0xb5, 0xb3, 0xb4, 0xb6, 0xb6, 0xb6, 0xb3, 0xab, 0x9e, 0x95, 0x95, 0x9e, 0x9e, 0xa7, 0xb1, 0xb3, 0xb4, 0xb4, 0xad, 0xa3, 0xa1, 0xb5, 0xf1, 0xe4, 0xe6, 0xe4, 0xe3, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xf0, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf1, 0xda, 0xdd, 0xdd, 0xd7, 0xd3, 0xd2, 0xd1, 0xd5, 0xdc, 0xdf, 0xe7, 0xe7, 0xe7, 0xe9, 0xe7, 0xe9, 0xe7, 0xe9, 0xe7, 0xe4, 0xdf, 0xdf, 0xdd, 0xd8, 0xd1, 0xd3, 0xe0, 0xe1, 0xe4, 0xe1, 0xe3, 0xe6, 0xe6, 0xe8, 0xed, 0xf4, 0xf4, 0xf3, 0xf3, 0x01, 0xf0, 0xff, 0xf4, 0xf2, 0x01, 0xf1, 0xd5, 0xc4, 0xbc, 0xbc, 0xbc, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc, 0xbc, 0xbc, 0xbf, 0xc1, 0xc8, 0xcb, 0xd2, 0xd7, 0xd5, 0xed, 0x01, 0x01, 0x55, 0x54, 0x50, 0x4e, 0x4d, 0x4e, 0x4b, 0x4e, 0x81, 0x4e, 0x55, 0xf0, 0xe3, 0xd7, 0xc7, 0xc7, 0xcd, 0xd1, 0xcf, 0xcd, 0xcf, 0xd5, 0xda, 0xe0, 0xe4, 0xe3, 0xe1, 0xe1, 0xe4, 0xe0, 0xe4, 0xe4, 0xe0, 0xda, 0xd7, 0xda, 0xe0, 0xe0, 0xe8, 0xe0, 0xe2, 0xdf, 0xf1, 0xba, 0xb1, 0xb7, 0xb6, 0xb7, 0xa7, 0x95, 0x9a, 0x99, 0x9a, 0x98, 0x95, 0x97, 0x97, 0x92, 0xa7, 0xb6, 0xb6, 0xb4, 0xb7, 0xb1, 0xad, 0xad, 0xb3, 0xd9, 0xe1, 0xe1, 0xe1, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe1, 0xda, 0xd7, 0xd7, 0xdd, 0xd7, 0xdd, 0xd5, 0xd0, 0xd2, 0xd7, 0xdd, 0xe9, 0xea, 0xe6, 0xe4, 0xe2, 0xe6, 0xe6, 0xe4, 0xe4, 0xe1, 0xf1, 0xb4, 0xb3, 0xb4, 0xb4, 0xb6, 0xb3, 0xb4, 0xb4, 0xb4, 0xb3, 0xb3, 0xb1, 0xb3, 0xb6, 0xb6, 0xb3, 0xb4, 0xb6, 0xac, 0xa3, 0xa3, 0xb5, 0xf1, 0xe1, 0xe3, 0xe4, 0xe6, 0xe3, 0xe6, 0xe6, 0xe4, 0xe8, 0xe3, 0xf0, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf1, 0xdd, 0xd2, 0xd8, 0xdc, 0xd9, 0xd9, 0xd4, 0xd1, 0xce, 0xce, 0xd1, 0xd1, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd1, 0xcf, 0xce, 0xd2, 0xdc, 0xdf, 0xe1, 0xe1, 0xe1, 0xe4, 0xe4, 0xe4, 0xe6, 0xe6, 0xed, 0xf2, 0xf4, 0x83, 0x83, 0xf3, 0xff, 0xf3, 0xf3, 0xf4, 0xf2, 0xf4, 0x01, 0x01, 0xf4, 0xf4, 0xf2, 0xf0, 0xf0, 0xf3, 0xf0, 0xe3, 0xea, 0xec, 0xec, 0xec, 0xec, 0xe9, 0xec, 0xe9, 0xe6, 0xe0, 0xff, 0xff, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0xf0, 0xe3, 0xdb, 0xdd, 0xd3, 0xc7, 0xc9, 0xce, 0xd1, 0xd3, 0xd1, 0xcd, 0xc9, 0xcb, 0xcd, 0xd1, 0xd3, 0xd5, 0xd8, 0xd8, 0xd3, 0xcd, 0xcd, 0xd5, 0xdd, 0xe1, 0xe6, 0xdd, 0xec, 0xdd, 0xdf, 0xef, 0xba, 0xb3, 0xb7, 0xb6, 0xb8, 0xac, 0x94, 0x9a, 0x9a, 0x9a, 0x9a, 0x9e, 0x9e, 0x98, 0xa3, 0xb3, 0xb6, 0xb6, 0xb6, 0xb6, 0xb3, 0xac, 0xac, 0xb1, 0xde, 0xdf, 0xdf, 0xe4, 0xe4, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe1, 0xe2, 0xda, 0xd5, 0xd0, 0xd2, 0xd0, 0xd5, 0xd7, 0xe0, 0xe4, 0xe1, 0xdd, 0xe0, 0xe2, 0xe6, 0xe2, 0xe2, 0xe2, 0xe6, 0xdc, 0xf2, 0xb6, 0xb3, 0xb4, 0xb6, 0xb6, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0x88, 0xa9, 0x9e, 0xb8, 0xf2, 0xe1, 0xe4, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe3, 0xe8, 0xe0, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0xf4, 0xe7, 0xdd, 0xdf, 0xde, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd6, 0xd3, 0xd1, 0xce, 0xcf, 0xce, 0xcf, 0xce, 0xcf, 0xce, 0xd1, 0xd2, 0xd6, 0xdc, 0xdf, 0xe5, 0xe4, 0xe1, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe6, 0xea, 0xf2, 0x83, 0x83, 0x83, 0x83, 0xf3, 0xf4, 0xf3, 0xf3, 0xff, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xe3, 0xe8, 0xe9, 0xe9, 0xe7, 0xe4, 0xe7, 0xe4, 0xe4, 0xe4, 0xe3, 0xf3, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x01, 0xf2, 0xe3, 0xdd, 0xdd, 0xe0, 0xdf, 0xd3, 0xd1, 0xcc, 0xc9, 0xcd, 0xd2, 0xd7, 0xd1, 0xd1, 0xcf, 0xcf, 0xcf, 0xcd, 0xcb, 0xc9, 0xcd, 0xd5, 0xda, 0xdf, 0xe5, 0xe2, 0xe0, 0xe9, 0xdf, 0xe2, 0xef, 0xba, 0xb3, 0xb6, 0xb4, 0xb7, 0xb3, 0x87, 0x9e, 0x9a, 0x9e, 0xa0, 0x9e, 0x9e, 0xa1, 0xaf, 0xb4, 0xb6, 0xb6, 0xb6, 0xb6, 0xb3, 0xaf, 0x88, 0xb4, 0xdc, 0xe5, 0xe2, 0xe7, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe7, 0xe4, 0xe4, 0xe1, 0xdd, 0xdd, 0xe0, 0xdd, 0xe0, 0xdf, 0xe0, 0xdd, 0xda, 0xdf, 0xe2, 0xe6, 0xe2, 0xe4, 0xe2, 0xe4, 0xdf, 0xf1, 0xb9, 0xb0, 0xb4, 0xb4, 0xb6, 0xb4, 0xb3, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xa7, 0xac, 0x97, 0xbb, 0xf1, 0xe1, 0xe4, 0xe3, 0xe6, 0xe3, 0xe8, 0xe3, 0xe3, 0xe8, 0xe3, 0xf3, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xef, 0xe4, 0xe2, 0xdf, 0xde, 0xd8, 0xd9, 0xd8, 0xde, 0xdd, 0xdf, 0xdd, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xdf, 0xdf, 0xe1, 0xe1, 0xdf, 0xdf, 0xdd, 0xe4, 0xe4, 0xe1, 0xe4, 0xe4, 0xe4, 0xe6, 0xe6, 0xe8, 0xf1, 0xf4, 0xf3, 0x83, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xff, 0xf0, 0xe3, 0xe8, 0xe6, 0xe1, 0xe4, 0xe1, 0xe1, 0xe4, 0xe2, 0xe4, 0xe3, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x56, 0x01, 0x01, 0x56, 0x01, 0x56, 0x01, 0xf3, 0xe8, 0xdb, 0xdb, 0xda, 0xe1, 0xdf, 0xdf, 0xd8, 0xd5, 0xd1, 0xd1, 0xcd, 0xcf, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcb, 0xcf, 0xd8, 0xdf, 0xdd, 0xdf, 0xe1, 0xe6, 0xe0, 0xe2, 0xe2, 0xdf, 0xef, 0xbb, 0xb3, 0xb6, 0xb6, 0xb7, 0xb7, 0xac, 0xa1, 0x9e, 0xa0, 0x9a, 0x9e, 0xa1, 0xb3, 0xb4, 0xb6, 0xb4, 0xb4, 0xb6, 0xb4, 0xb0, 0xaf, 0xa5, 0xb6, 0xde, 0xe2, 0xe7, 0xe2, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe9, 0xe6, 0xe4, 0xe1, 0xe6, 0xe4, 0xe1, 0xe1, 0xe1, 0xdd, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe2, 0xe2, 0xe6, 0xe2, 0xe2, 0xe4, 0xe1, 0xf1, 0xbe, 0xa9, 0xb6, 0xb3, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb7, 0xb3, 0xa9, 0xac, 0x95, 0xc6, 0xef, 0xe4, 0xe6, 0xe4, 0xe8, 0xe3, 0xe3, 0xe6, 0xe3, 0xe8, 0xe8, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf0, 0xe6, 0xe0, 0xe0, 0xe1, 0xe1, 0xdf, 0xdf, 0xdd, 0xde, 0xdd, 0xdd, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe4, 0xdf, 0xe4, 0xe1, 0xe4, 0xe4, 0xe1, 0xe1, 0xe1, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe6, 0xe6, 0xf0, 0x83, 0x83, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xf3, 0xe8, 0xe3, 0xe6, 0xe4, 0xe1, 0xe4, 0xdf, 0xe1, 0xe4, 0xe1, 0xe3, 0xec, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xe8, 0xdb, 0xdd, 0xdd, 0xe1, 0xdc, 0xdd, 0xdf, 0xe1, 0xdf, 0xda, 0xd8, 0xd5, 0xd8, 0xd8, 0xda, 0xd8, 0xda, 0xdc, 0xdf, 0xe1, 0xe5, 0xdf, 0xdc, 0xdf, 0xe4, 0xe2, 0xe1, 0xe0, 0xe2, 0xeb, 0xbc, 0xb1, 0xb7, 0xb6, 0xb7, 0xb7, 0xb3, 0xaf, 0xa9, 0xa7, 0xa5, 0xa7, 0xb1, 0xb6, 0xb6, 0xb3, 0xb4, 0xb6, 0xb6, 0xb4, 0xac, 0xac, 0xa5, 0xb8, 0xdf, 0xdf, 0xe9, 0xe1, 0xe4, 0xe3, 0xe4, 0xe4, 0xe1, 0xe4, 0xec, 0xec, 0xe1, 0xe0, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xdd, 0xe0, 0xe1, 0xe4, 0xe0, 0xe4, 0xe6, 0xe2, 0xe3, 0xe2, 0xe6, 0xe1, 0xef, 0xc4, 0xa9, 0xb3, 0xb3, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xb1, 0xa9, 0xa7, 0x95, 0xd9, 0xe9, 0xe4, 0xe3, 0xe4, 0xe3, 0xe3, 0xe6, 0xe3, 0xe3, 0xe8, 0xed, 0xff, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xe3, 0xdd, 0xe0, 0xe7, 0xe7, 0xe7, 0xe1, 0xe4, 0xdd, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xe1, 0xe0, 0xe0, 0xe0, 0xe4, 0xe4, 0xe4, 0xe1, 0xe2, 0xe4, 0xe4, 0xe1, 0xe6, 0xe6, 0xe1, 0xf0, 0xf2, 0x83, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xe8, 0xe3, 0xed, 0xe4, 0xe6, 0xe7, 0xe0, 0xe1, 0xe4, 0xe3, 0xe4, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0xee, 0xe8, 0xe3, 0xe0, 0xda, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xe1, 0xe1, 0xdf, 0xdc, 0xdd, 0xdc, 0xdd, 0xdc, 0xdd, 0xdf, 0xdf, 0xdd, 0xdc, 0xdd, 0xdf, 0xe4, 0xe6, 0xe0, 0xe1, 0xe2, 0xe9, 0xcb, 0xb1, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb3, 0xb4, 0xb3, 0xb6, 0xb4, 0xb6, 0xb3, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0xb3, 0xa9, 0xad, 0xa5, 0xbb, 0xe7, 0xdd, 0xe7, 0xe0, 0xe2, 0xe4, 0xe3, 0xe4, 0xe4, 0xe4, 0xee, 0xef, 0xe9, 0xe4, 0xe0, 0xe3, 0xe1, 0xe0, 0xe4, 0xe1, 0xe0, 0xe0, 0xe4, 0xe4, 0xe0, 0xe2, 0xe6, 0xe6, 0xe2, 0xe2, 0xe4, 0xe1, 0xe7, 0xd9, 0xb5, 0xb1, 0xb1, 0xb7, 0xb6, 0xb6, 0xb4, 0xb4, 0xb6, 0xb4, 0xb4, 0xb6, 0xb4, 0xb6, 0xb7, 0xb4, 0xac, 0xac, 0xa3, 0xa3, 0xef, 0xe1, 0xe6, 0xe4, 0xe3, 0xe8, 0xe6, 0xe3, 0xe4, 0xe8, 0xe3, 0xed, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0xf3, 0xed, 0xdb, 0xe0, 0xe3, 0xe4, 0xe1, 0xe4, 0xe6, 0xe8, 0xe6, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xe3, 0xe1, 0xe3, 0xe1, 0xe3, 0xe0, 0xe6, 0xe4, 0xe2, 0xe4, 0xe1, 0xe3, 0xe6, 0xe6, 0xe3, 0xee, 0x83, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xe8, 0xe0, 0xec, 0xe4, 0xe1, 0xe7, 0xdf, 0xe1, 0xe6, 0xe4, 0xe3, 0xf2, 0x83, 0x01, 0x01, 0x83, 0x83, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0xee, 0xed, 0xed, 0xe4, 0xdd, 0xe1, 0xdf, 0xe0, 0xdd, 0xdd, 0xda, 0xdd, 0xe1, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xdf, 0xdf, 0xdd, 0xdc, 0xe1, 0xdf, 0xdf, 0xe2, 0xe8, 0xe0, 0xe2, 0xdd, 0xe9, 0xd6, 0xb3, 0xb5, 0xb6, 0xb6, 0xb7, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xb1, 0xa9, 0xac, 0xa7, 0xbc, 0xef, 0xdc, 0xea, 0xe0, 0xe2, 0xe3, 0xe4, 0xe4, 0xe1, 0xe4, 0xea, 0xee, 0xee, 0xea, 0xe4, 0xe1, 0xe0, 0xe1, 0xe3, 0xe9, 0xe3, 0xe1, 0xe6, 0xea, 0xdd, 0xe4, 0xe6, 0xe3, 0xe3, 0xe3, 0xe4, 0xe0, 0xe7, 0xe7, 0xb9, 0xad, 0xb1, 0xb7, 0xb7, 0xb6, 0xb3, 0xb6, 0xb6, 0xb4, 0xb6, 0xb6, 0xb4, 0xb6, 0xb7, 0xb3, 0xa7, 0xac, 0xa0, 0xb6, 0xf4, 0xe1, 0xe4, 0xe3, 0xe6, 0xe3, 0xe6, 0xe6, 0xe4, 0xe3, 0xe8, 0xed, 0x56, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xf0, 0xed, 0xe8, 0xe6, 0xe3, 0xe4, 0xe6, 0xea, 0xe8, 0xe8, 0xe3, 0xe3, 0xe3, 0xe0, 0xe3, 0xe0, 0xe3, 0xe0, 0xe3, 0xe3, 0xe3, 0xe0, 0xe3, 0xe3, 0xe3, 0xe4, 0xe2, 0xe1, 0xe3, 0xe1, 0xe1, 0xe4, 0xe6, 0xe0, 0xea, 0xf0, 0x83, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xe6, 0xe3, 0xe6, 0xe1, 0xe1, 0xe9, 0xe1, 0xe4, 0xe6, 0xe3, 0xe8, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xe3, 0xea, 0xee, 0xec, 0xdf, 0xe2, 0xdd, 0xdf, 0xdd, 0xe0, 0xdd, 0xdd, 0xdd, 0xdf, 0xdd, 0xe0, 0xdf, 0xe1, 0xdd, 0xdd, 0xdf, 0xe1, 0xe4, 0xe0, 0xe2, 0xe6, 0xe1, 0xe0, 0xe0, 0xe7, 0xe1, 0xb7, 0xb3, 0xb6, 0xb4, 0xb7, 0xb7, 0xb4, 0xb4, 0xb6, 0xb4, 0xb3, 0xb4, 0xb6, 0xb6, 0xb4, 0xb4, 0xb7, 0xb3, 0xb0, 0xa9, 0xac, 0xa7, 0xc9, 0xe7, 0xdf, 0xea, 0xe1, 0xe3, 0xe6, 0xe3, 0xe3, 0xe4, 0xe4, 0xe4, 0xe8, 0xef, 0xef, 0xea, 0xe4, 0xe3, 0xe0, 0xe3, 0xe1, 0xe9, 0xea, 0xe9, 0xe6, 0xe0, 0xe2, 0xe6, 0xe6, 0xe6, 0xe6, 0xe0, 0xe2, 0xe4, 0xeb, 0xbf, 0xa9, 0xb1, 0xb4, 0xb7, 0xb6, 0xb4, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xaf, 0xa9, 0xa9, 0x9e, 0xbc, 0xf1, 0xe4, 0xe3, 0xe3, 0xe3, 0xe6, 0xe3, 0xe4, 0xe6, 0xe8, 0xe3, 0xf0, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xf4, 0xff, 0x83, 0xff, 0x83, 0xff, 0x83, 0xff, 0x83, 0xff, 0x83, 0xff, 0x83, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x56, 0x01, 0xf3, 0xf0, 0xed, 0xea, 0xe8, 0xe6, 0xe3, 0xe4, 0xe3, 0xe3, 0xe8, 0xe8, 0xe8, 0xe8, 0xe3, 0xe8, 0xe3, 0xe6, 0xe0, 0xe3, 0xe0, 0xe3, 0xe6, 0xe8, 0xe6, 0xe2, 0xe4, 0xe2, 0xe4, 0xe0, 0xe1, 0xe3, 0xe6, 0xe0, 0xe0, 0xee, 0xf4, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xf3, 0xf2, 0xee, 0xe3, 0xe4, 0xe6, 0xe1, 0xe4, 0xe7, 0xe4, 0xe4, 0xe6, 0xe3, 0xed, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xe0, 0xe0, 0xea, 0xec, 0xee, 0xe9, 0xe2, 0xe2, 0xdd, 0xe0, 0xe0, 0xe1, 0xe1, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe1, 0xe0, 0xdd, 0xe0, 0xdf, 0xe0, 0xe6, 0xe6, 0xe0, 0xe0, 0xe2, 0xe4, 0xe7, 0xb9, 0xb3, 0xb6, 0xb3, 0xb7, 0xb7, 0xb6, 0xb4, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb3, 0xb3, 0xb8, 0xaf, 0xb1, 0xac, 0xa7, 0xb3, 0xdf, 0xe4, 0xe7, 0xe2, 0xe6, 0xe3, 0xe6, 0xe6, 0xe4, 0xe1, 0xe6, 0xe4, 0xe3, 0xec, 0xf0, 0xee, 0xea, 0xe9, 0xe8, 0xe6, 0xe6, 0xea, 0xec, 0xe8, 0xdd, 0xe2, 0xe6, 0xe4, 0xe3, 0xe6, 0xe6, 0xe0, 0xe9, 0xdd, 0xec, 0xd8, 0xb6, 0xb0, 0xaf, 0xb6, 0xb8, 0xb7, 0xb3, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb1, 0xac, 0xb0, 0xa1, 0xae, 0xe1, 0xe7, 0xe0, 0xe6, 0xe8, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe6, 0xe3, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x83, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xf3, 0x01, 0xff, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xed, 0xe8, 0xe8, 0xee, 0xef, 0xec, 0xe8, 0xe3, 0xe3, 0xe0, 0xe3, 0xe3, 0xe4, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xe8, 0xea, 0xed, 0xec, 0xe8, 0xe2, 0xe2, 0xe2, 0xe0, 0xe4, 0xe3, 0xe1, 0xe3, 0xe0, 0xe3, 0xed, 0xf0, 0xf2, 0xf3, 0xf0, 0xf3, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf0, 0xf4, 0xf3, 0xea, 0xe4, 0xe6, 0xe4, 0xe4, 0xe1, 0xe4, 0xe6, 0xe6, 0xe0, 0xe8, 0xf2, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0xf3, 0xe3, 0xe3, 0xe0, 0xda, 0xef, 0xef, 0xef, 0xec, 0xe6, 0xe0, 0xdd, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xe1, 0xe1, 0xe1, 0xdd, 0xe0, 0xe1, 0xe6, 0xe3, 0xe2, 0xe0, 0xe1, 0xe4, 0xe7, 0xbc, 0xb3, 0xb5, 0xb4, 0xb6, 0xb6, 0xb8, 0xb6, 0xb4, 0xb6, 0xb6, 0xb6, 0xb4, 0xb6, 0xb6, 0xb4, 0xb4, 0xad, 0xb0, 0xa9, 0xa0, 0xbb, 0xef, 0xe7, 0xe6, 0xdd, 0xe6, 0xe3, 0xe6, 0xe6, 0xe3, 0xe4, 0xe6, 0xe9, 0xe6, 0xe3, 0xec, 0xef, 0xf1, 0xed, 0xf1, 0xee, 0xee, 0xec, 0xea, 0xe4, 0xe0, 0xe4, 0xe8, 0xe6, 0xe3, 0xe8, 0xe3, 0xe6, 0xe2, 0xe0, 0xeb, 0xe2, 0xbe, 0xab, 0xb1, 0xb1, 0xb6, 0xb8, 0xb7, 0xb7, 0xb8, 0xb8, 0xb8, 0xb7, 0xb3, 0xac, 0xa9, 0xac, 0x9b, 0xbb, 0xf1, 0xe6, 0xda, 0xe8, 0xe8, 0xe3, 0xe8, 0xe3, 0xe4, 0xe6, 0xe8, 0xe8, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf3, 0xe8, 0xe0, 0xe3, 0xe8, 0xe8, 0xed, 0xf1, 0xf0, 0xee, 0xed, 0xea, 0xec, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xf1, 0xf1, 0xf1, 0xec, 0xec, 0xe3, 0xe2, 0xe6, 0xe2, 0xe2, 0xe4, 0xe0, 0xe4, 0xe0, 0xe1, 0xe6, 0xe0, 0xe8, 0xee, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xee, 0xe3, 0xe1, 0xe2, 0xe4, 0xe4, 0xe1, 0xe1, 0xe4, 0xe6, 0xe0, 0xed, 0xf4, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xed, 0xe0, 0xe0, 0xd7, 0xe0, 0xe0, 0xe4, 0xea, 0xee, 0xec, 0xec, 0xe0, 0xe1, 0xe0, 0xe0, 0xdd, 0xe0, 0xda, 0xdd, 0xea, 0xea, 0xe4, 0xe1, 0xe0, 0xe6, 0xe6, 0xe3, 0xe3, 0xe2, 0xe4, 0xe4, 0xce, 0xb5, 0xb3, 0xb4, 0xb4, 0xb6, 0xb7, 0xb7, 0xb6, 0xb4, 0xb6, 0xb6, 0xb6, 0xb3, 0xb7, 0xb7, 0xb1, 0xa9, 0xac, 0xab, 0xa0, 0xd6, 0xe7, 0xe6, 0xe2, 0xe0, 0xe6, 0xe2, 0xe8, 0xe6, 0xe4, 0xe6, 0xea, 0xea, 0xe8, 0xe4, 0xe6, 0xea, 0xee, 0xee, 0xee, 0xef, 0xee, 0xea, 0xe3, 0xe0, 0xe3, 0xe6, 0xe8, 0xe6, 0xe3, 0xe8, 0xe8, 0xe3, 0xe2, 0xe6, 0xe2, 0xe7, 0xdc, 0xb7, 0xad, 0xb3, 0xb3, 0xb4, 0xb9, 0xb9, 0xb7, 0xb8, 0xb6, 0xb3, 0xa9, 0xac, 0xa9, 0xa3, 0xb2, 0xe7, 0xe4, 0xe1, 0xe8, 0xea, 0xe8, 0xe8, 0xe8, 0xe6, 0xe6, 0xe4, 0xe6, 0xed, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0xf3, 0xed, 0xe3, 0xe4, 0xe3, 0xda, 0xdd, 0xe3, 0xea, 0xee, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xf1, 0xee, 0xec, 0xe8, 0xe0, 0xe0, 0xe0, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe3, 0xe0, 0xe3, 0xe3, 0xe6, 0xe3, 0xe8, 0xee, 0xf4, 0xf3, 0xf3, 0xf3, 0xf0, 0xf3, 0xf3, 0xf3, 0xf0, 0xf3, 0xf4, 0xf3, 0xed, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe7, 0xe4, 0xe1, 0xe6, 0xe6, 0xe6, 0xf0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xe3, 0xe3, 0xe1, 0xd7, 0xd8, 0xdd, 0xe0, 0xe4, 0xed, 0xec, 0xef, 0xec, 0xec, 0xe9, 0xe4, 0xe4, 0xe4, 0xe6, 0xec, 0xe6, 0xe0, 0xdd, 0xe4, 0xe6, 0xe3, 0xe4, 0xe3, 0xe1, 0xe1, 0xe1, 0xe1, 0xb9, 0xb3, 0xb4, 0xb1, 0xb6, 0xb7, 0xb8, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb3, 0xad, 0xb0, 0xac, 0xa3, 0xb8, 0xef, 0xe0, 0xe7, 0xdd, 0xed, 0xe0, 0xe3, 0xe6, 0xe6, 0xe2, 0xe9, 0xec, 0xec, 0xe8, 0xe8, 0xe3, 0xdb, 0xe3, 0xea, 0xe8, 0xed, 0xea, 0xe3, 0xe0, 0xe3, 0xe4, 0xe8, 0xe9, 0xe6, 0xe3, 0xe8, 0xe3, 0xe0, 0xe2, 0xe9, 0xdf, 0xe2, 0xeb, 0xcb, 0xb1, 0xad, 0xb1, 0xb1, 0xad, 0xaf, 0xb3, 0xb1, 0xac, 0xa9, 0xad, 0xaf, 0xa7, 0xab, 0xc0, 0xef, 0xdd, 0xe8, 0xe8, 0xe3, 0xe3, 0xe8, 0xe8, 0xe8, 0xe6, 0xe9, 0xe6, 0xf3, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf2, 0xed, 0xe9, 0xe9, 0xe6, 0xe1, 0xda, 0xdb, 0xdd, 0xe0, 0xe3, 0xe4, 0xe1, 0xe1, 0xe1, 0xe0, 0xe1, 0xda, 0xda, 0xda, 0xda, 0xdd, 0xe1, 0xe3, 0xe6, 0xe2, 0xe2, 0xe4, 0xe2, 0xe4, 0xe4, 0xe0, 0xe4, 0xe6, 0xe3, 0xe3, 0xed, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xf0, 0xf3, 0xf0, 0xf3, 0xf0, 0xf0, 0xe8, 0xe3, 0xe3, 0xe7, 0xe0, 0xe5, 0xe4, 0xe7, 0xe4, 0xe4, 0xe6, 0xed, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xe8, 0xe3, 0xe6, 0xe1, 0xe0, 0xdd, 0xda, 0xdd, 0xdd, 0xe0, 0xe4, 0xe6, 0xe9, 0xec, 0xee, 0xf1, 0xef, 0xee, 0xe4, 0xdd, 0xda, 0xdd, 0xe6, 0xe6, 0xe8, 0xe3, 0xe6, 0xe1, 0xe1, 0xe1, 0xe7, 0xc0, 0xb6, 0xb3, 0xb3, 0xb6, 0xb3, 0xb7, 0xb7, 0xb6, 0xb6, 0xb6, 0xb6, 0xb7, 0xb4, 0xac, 0xa9, 0xb1, 0xa3, 0xa1, 0xd4, 0xf1, 0xdf, 0xe8, 0xdd, 0xea, 0xe0, 0xe3, 0xe8, 0xe3, 0xe4, 0xe9, 0xee, 0xee, 0xea, 0xed, 0xe6, 0xe0, 0xe0, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe0, 0xe3, 0xea, 0xea, 0xea, 0xe6, 0xe3, 0xe8, 0xe8, 0xe0, 0xe3, 0xe6, 0xe2, 0xe5, 0xe9, 0xeb, 0xbb, 0xb1, 0xa3, 0xb3, 0xb3, 0xa9, 0xb0, 0xad, 0xac, 0xb0, 0xb1, 0xa8, 0xac, 0xb9, 0xec, 0xe4, 0xe6, 0xec, 0xe3, 0xe3, 0xe8, 0xe8, 0xe8, 0xe6, 0xe8, 0xe9, 0xea, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x01, 0xf4, 0xf0, 0xe6, 0xe4, 0xe4, 0xe6, 0xe8, 0xe4, 0xe0, 0xe0, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0xdd, 0xd7, 0xdd, 0xe0, 0xe4, 0xe4, 0xe4, 0xe6, 0xe2, 0xe6, 0xe2, 0xe4, 0xe2, 0xe3, 0xe4, 0xe3, 0xe0, 0xe8, 0xe6, 0xe0, 0xe3, 0xed, 0xee, 0xf0, 0xf3, 0xf3, 0xf3, 0xf0, 0xf3, 0xf3, 0xf3, 0xed, 0xe3, 0xe3, 0xe3, 0xe9, 0xe9, 0xe0, 0xdf, 0xe7, 0xe4, 0xe7, 0xe0, 0xe3, 0xf2, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0xf3, 0xe8, 0xe0, 0xe0, 0xe9, 0xe4, 0xe1, 0xdd, 0xdd, 0xd7, 0xda, 0xd7, 0xda, 0xdd, 0xe0, 0xe4, 0xe4, 0xe4, 0xe0, 0xdd, 0xdb, 0xe0, 0xe0, 0xe0, 0xe3, 0xe8, 0xe3, 0xe6, 0xe1, 0xe0, 0xdf, 0xe7, 0xd9, 0xb9, 0xb3, 0xb3, 0xb6, 0xb1, 0xb4, 0xb7, 0xb8, 0xb8, 0xb7, 0xb6, 0xb4, 0xa9, 0xad, 0xad, 0xa9, 0xa1, 0xb9, 0xf2, 0xdc, 0xea, 0xe4, 0xe0, 0xe3, 0xe8, 0xe3, 0xe6, 0xe6, 0xe4, 0xea, 0xef, 0xf1, 0xee, 0xed, 0xe8, 0xe8, 0xe3, 0xe0, 0xe3, 0xe3, 0xe0, 0xe3, 0xe3, 0xea, 0xed, 0xea, 0xea, 0xe6, 0xe3, 0xe8, 0xe6, 0xe8, 0xe0, 0xe0, 0xe9, 0xdf, 0xdf, 0xe7, 0xeb, 0xbb, 0xa9, 0xad, 0xb1, 0xb3, 0xb1, 0xb0, 0xb0, 0xb1, 0xa9, 0x9e, 0xba, 0xe5, 0xe7, 0xe4, 0xe9, 0xd7, 0xee, 0xe8, 0xe3, 0xe3, 0xe3, 0xe8, 0xe8, 0xec, 0xea, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf3, 0x01, 0x83, 0xf4, 0xf3, 0xec, 0xe3, 0xe3, 0xe9, 0xe6, 0xea, 0xee, 0xe8, 0xe6, 0xe6, 0xe0, 0xdd, 0xdd, 0xe3, 0xe4, 0xe3, 0xe1, 0xe4, 0xe4, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe8, 0xe6, 0xe3, 0xe4, 0xe6, 0xe3, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 0xe0, 0xe8, 0xe8, 0xee, 0xf0, 0xf1, 0xf2, 0xed, 0xee, 0xe3, 0xe3, 0xe0, 0xe3, 0xe6, 0xe4, 0xe7, 0xe4, 0xe7, 0xe6, 0xe7, 0xe8, 0xe4, 0xed, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xed, 0xe0, 0xdb, 0xe0, 0xdd, 0xe0, 0xe1, 0xe4, 0xe0, 0xda, 0xdd, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xe0, 0xdd, 0xdd, 0xe0, 0xe1, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe4, 0xe4, 0xe4, 0xec, 0xc0, 0xb5, 0xb0, 0xb3, 0xb3, 0xb3, 0xb1, 0xb4, 0xb4, 0xb3, 0xb1, 0xac, 0xac, 0xb0, 0xb1, 0xa3, 0xb0, 0xdf, 0xea, 0xe0, 0xe4, 0xe3, 0xe4, 0xe4, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xea, 0xf1, 0xf1, 0xf0, 0xf2, 0xee, 0xee, 0xe8, 0xe3, 0xe3, 0xe3, 0xe3, 0xe8, 0xea, 0xed, 0xec, 0xe8, 0xe6, 0xe3, 0xe1, 0xe3, 0xe8, 0xe8, 0xe4, 0xe3, 0xe4, 0xe2, 0xe4, 0xe2, 0xe7, 0xeb, 0xbc, 0xae, 0xa0, 0xab, 0xb2, 0xab, 0xa8, 0xa0, 0xab, 0xbb, 0xe5, 0xef, 0xe2, 0xe4, 0xe4, 0xe0, 0xea, 0xe6, 0xe6, 0xe8, 0xea, 0xe8, 0xe4, 0xe8, 0xf1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0xf0, 0xe8, 0xe8, 0xe8, 0xe0, 0xe4, 0xec, 0xee, 0xea, 0xea, 0xec, 0xed, 0xea, 0xe3, 0xe1, 0xe3, 0xe4, 0xe3, 0xe1, 0xe3, 0xe4, 0xe3, 0xe1, 0xe3, 0xe6, 0xe3, 0xe4, 0xe6, 0xe6, 0xe4, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe3, 0xe0, 0xe3, 0xe3, 0xe4, 0xe3, 0xe6, 0xe9, 0xe6, 0xe3, 0xe0, 0xe3, 0xe6, 0xe4, 0xe5, 0xe4, 0xe7, 0xe6, 0xe4, 0xe6, 0xe3, 0xe8, 0xf0, 0x01, 0xf4, 0xff, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0xf0, 0xe3, 0xe0, 0xe0, 0xdd, 0xdd, 0xe0, 0xe1, 0xe1, 0xe1, 0xe0, 0xdf, 0xe0, 0xdd, 0xdd, 0xdd, 0xda, 0xdd, 0xe1, 0xe1, 0xdd, 0xe1, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe2, 0xe4, 0xe4, 0xda, 0xec, 0xec, 0xbf, 0xae, 0xb2, 0xb6, 0xb1, 0xaf, 0xb1, 0xaf, 0xac, 0xad, 0xab, 0xb0, 0xb3, 0x9d, 0xae, 0xd5, 0xef, 0xe1, 0xe3, 0xe3, 0xe4, 0xe6, 0xe6, 0xe6, 0xe4, 0xe6, 0xe6, 0xe8, 0xea, 0xed, 0xea, 0xed, 0xee, 0xf0, 0xf0, 0xee, 0xee, 0xed, 0xea, 0xed, 0xe8, 0xed, 0xea, 0xed, 0xea, 0xe6, 0xe6, 0xe3, 0xe4, 0xe6, 0xe6, 0xe3, 0xe4, 0xe6, 0xe3, 0xe6, 0xe6, 0xd7, 0xea, 0xee, 0xd1, 0xba, 0xb5, 0xae, 0xae, 0xb8, 0xbb, 0xcd, 0xec, 0xea, 0xdd, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xe4, 0xea, 0xea, 0xe3, 0xe8, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0xf0, 0xed, 0xf0, 0xef, 0xed, 0xe6, 0xe6, 0xe4, 0xe6, 0xea, 0xee, 0xef, 0xee, 0xee, 0xea, 0xee, 0xee, 0xec, 0xed, 0xe9, 0xea, 0xe8, 0xea, 0xe4, 0xe3, 0xe6, 0xe6, 0xe6, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe3, 0xe4, 0xe8, 0xe6, 0xe6, 0xe6, 0xe3, 0xe4, 0xe3, 0xe3, 0xe4, 0xe3, 0xe6, 0xe6, 0xe9, 0xe9, 0xe6, 0xe7, 0xe6, 0xe4, 0xe6, 0xe6, 0xe6, 0xed, 0xf3, 0x01, 0xf4, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0xee, 0xe8, 0xe8, 0xe3, 0xe0, 0xdd, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xdf, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe1, 0xe4, 0xe4, 0xe7, 0xea, 0xe6, 0xe6, 0xe6, 0xe6, 0xe2, 0xe3, 0xe4, 0xe9, 0xda, 0xeb, 0xec, 0xbb, 0xae, 0xac, 0xb1, 0xb3, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1, 0xab, 0x9d, 0xb4, 0xcb, 0xe9, 0xe4, 0xe1, 0xe3, 0xe4, 0xe3, 0xe6, 0xe3, 0xe6, 0xe6, 0xe3, 0xe6, 0xec, 0xea, 0xe4, 0xe3, 0xe6, 0xe8, 0xee, 0xf1, 0xf0, 0xed, 0xee, 0xee, 0xed, 0xe6, 0xe8, 0xed, 0xee, 0xec, 0xe8, 0xe6, 0xe4, 0xe3, 0xe2, 0xe3, 0xe6, 0xe3, 0xe6, 0xe4, 0xe3, 0xe4, 0xec, 0xe0, 0xe1, 0xef, 0xec, 0xe4, 0xec, 0xec, 0xee, 0xec, 0xec, 0xec, 0xe9, 0xe4, 0xe2, 0xe2, 0xe6, 0xe2, 0xe6, 0xe4, 0xe8, 0xe6, 0xe6, 0xe8, 0xe6, 0xee, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf3, 0x01, 0x83, 0xf4, 0x83, 0xf3, 0xed, 0xe8, 0xee, 0xf0, 0xf1, 0xed, 0xe9, 0xe8, 0xea, 0xe0, 0xe3, 0xe9, 0xee, 0xf2, 0xee, 0xf1, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xea, 0xe6, 0xea, 0xea, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xe8, 0xe8, 0xe1, 0xe3, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 0xf0, 0xf4, 0x01, 0xf3, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0xf0, 0xed, 0xf0, 0xee, 0xea, 0xe6, 0xe3, 0xe0, 0xe0, 0xdd, 0xe0, 0xe0, 0xe1, 0xe1, 0xe4, 0xe1, 0xe4, 0xe6, 0xe4, 0xe9, 0xe9, 0xea, 0xe6, 0xe6, 0xe6, 0xe3, 0xe1, 0xe4, 0xe4, 0xe9, 0xe1, 0xdf, 0xeb, 0xe4, 0xbb, 0xb2, 0xac, 0xac, 0xb3, 0xb1, 0xab, 0xa9, 0xa8, 0xa6, 0xb8, 0xcf, 0xee, 0xe1, 0xda, 0xe3, 0xe1, 0xe3, 0xe4, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe6, 0xee, 0xee, 0xea, 0xe6, 0xe3, 0xe0, 0xe8, 0xee, 0xf1, 0xf0, 0xee, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xe6, 0xe6, 0xe3, 0xe4, 0xe3, 0xe2, 0xe6, 0xe4, 0xe3, 0xe4, 0xe3, 0xe6, 0xe6, 0xdd, 0xdd, 0xe9, 0xe6, 0xe1, 0xe4, 0xe6, 0xe1, 0xe7, 0xe6, 0xdd, 0xe0, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe6, 0xe4, 0xe6, 0xe6, 0xe6, 0xe6, 0xed, 0xf2, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x83, 0xee, 0xdb, 0xe3, 0xe8, 0xee, 0xee, 0xf1, 0xee, 0xec, 0xea, 0xea, 0xea, 0xf1, 0xf1, 0xee, 0xef, 0xf0, 0xf1, 0xf0, 0xf1, 0xee, 0xe8, 0xe6, 0xe3, 0xea, 0xe8, 0xe6, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe6, 0xe3, 0xe6, 0xe4, 0xe3, 0xe6, 0xe6, 0xe8, 0xe4, 0xe3, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 0xed, 0xf3, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0xf3, 0xed, 0xee, 0xf0, 0xf0, 0xf0, 0xee, 0xea, 0xea, 0xe6, 0xe4, 0xe4, 0xe0, 0xe0, 0xe0, 0xe1, 0xe6, 0xe6, 0xea, 0xea, 0xec, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe2, 0xe3, 0xe4, 0xe0, 0xe9, 0xe4, 0xe1, 0xeb, 0xe1, 0xc0, 0xb7, 0xb0, 0xa3, 0xa3, 0xae, 0xb2, 0xb8, 0xba, 0xe4, 0xe9, 0xda, 0xe6, 0xe8, 0xe3, 0xe3, 0xe3, 0xe4, 0xe6, 0xe6, 0xe6, 0xe8, 0xe4, 0xe8, 0xee, 0xf1, 0xee, 0xee, 0xea, 0xe3, 0xe3, 0xed, 0xf0, 0xf1, 0xee, 0xee, 0xf0, 0xf1, 0xee, 0xed, 0xea, 0xe0, 0xe0, 0xe6, 0xe4, 0xe6, 0xe4, 0xe3, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe3, 0xe4, 0xe6, 0xe0, 0xe0, 0xe1, 0xe8, 0xe9, 0xea, 0xe4, 0xe3, 0xe1, 0xe0, 0xe4, 0xe6, 0xe2, 0xe2, 0xe4, 0xe4, 0xe6, 0xe4, 0xe6, 0xe8, 0xe6, 0xe8, 0xee, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xee, 0xe3, 0xe3, 0xe3, 0xe8, 0xea, 0xee, 0xf0, 0xf1, 0xf1, 0xf1, 0xef, 0xee, 0xee, 0xef, 0xef, 0xf1, 0xee, 0xec, 0xea, 0xdd, 0xe1, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe9, 0xe8, 0xe9, 0xe6, 0xe6, 0xe4, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe6, 0xe6, 0xe6, 0xe3, 0xe8, 0xe8, 0xed, 0xf0, 0xf4, 0x01, 0xf3, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf3, 0xed, 0xed, 0xee, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xec, 0xe8, 0xe4, 0xe1, 0xe8, 0xec, 0xea, 0xec, 0xee, 0xec, 0xe8, 0xe6, 0xe6, 0xe6, 0xe3, 0xe1, 0xe4, 0xe4, 0xec, 0xe1, 0xe1, 0xe1, 0xe7, 0xe4, 0xeb, 0xe1, 0xd1, 0xc5, 0xc5, 0xcb, 0xcf, 0xe1, 0xf2, 0xe1, 0xe6, 0xe3, 0xd5, 0xea, 0xe3, 0xe1, 0xe4, 0xe3, 0xe4, 0xe6, 0xe4, 0xe3, 0xe6, 0xee, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xee, 0xe8, 0xe6, 0xe3, 0xe3, 0xed, 0xed, 0xee, 0xee, 0xed, 0xe8, 0xe6, 0xe0, 0xe4, 0xe6, 0xe8, 0xe6, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xdd, 0xe2, 0xe6, 0xe2, 0xe0, 0xdd, 0xdb, 0xda, 0xdd, 0xe2, 0xe6, 0xe4, 0xe3, 0xe2, 0xe2, 0xe4, 0xe2, 0xe4, 0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 0xea, 0xf3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xf3, 0x01, 0x83, 0xf3, 0x01, 0x01, 0x01, 0xf2, 0xe3, 0xe8, 0xee, 0xea, 0xe3, 0xe3, 0xe0, 0xe1, 0xe3, 0xe4, 0xe3, 0xe4, 0xe0, 0xe1, 0xe3, 0xe1, 0xe0, 0xda, 0xd7, 0xe0, 0xe6, 0xea, 0xea, 0xe6, 0xe4, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe1, 0xe4, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe6, 0xe4, 0xe4, 0xe3, 0xe1, 0xe3, 0xe4, 0xe6, 0xe6, 0xe6, 0xe3, 0xe3, 0xe8, 0xe8, 0xed, 0xf3, 0x01, 0xf4, 0xf3, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x83, 0x01, 0x01, 0xf0, 0xed, 0xee, 0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xef, 0xef, 0xee, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe2, 0xe3, 0xe4, 0xe0, 0xe9, 0xe7, 0xe1, 0xe4, 0xe4, 0xe1, 0xe7, 0xe1, 0xe9, 0xe7, 0xe4, 0xea, 0xe6, 0xdd, 0xe6, 0xe0, 0xe0, 0xed, 0xdb, 0xe4, 0xe3, 0xe1, 0xe4, 0xe6, 0xe4, 0xe0, 0xe0, 0xea, 0xf1, 0xf1, 0xef, 0xec, 0xed, 0xea, 0xed, 0xe8, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe0, 0xe3, 0xe3, 0xe6, 0xe9, 0xea, 0xec, 0xe9, 0xe3, 0xe2, 0xe6, 0xe2, 0xe4, 0xe2, 0xe6, 0xe4, 0xe6, 0xe0, 0xe0, 0xe6, 0xe2, 0xe2, 0xea, 0xe8, 0xe8, 0xe0, 0xe0, 0xe6, 0xe9, 0xe0, 0xe2, 0xe3, 0xe2, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 0xed, 0xf3, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0x01, 0xf3, 0xe3, 0xe8, 0xed, 0xea, 0xed, 0xe9, 0xe3, 0xe1, 0xe4, 0xe4, 0xe0, 0xe1, 0xe0, 0xda, 0xdd, 0xdd, 0xe3, 0xe6, 0xef, 0xec, 0xea, 0xe9, 0xe8, 0xe9, 0xe6, 0xe6, 0xe6, 0xe4, 0xe6, 0xe4, 0xe3, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe6, 0xe4, 0xe9, 0xea, 0xe9, 0xe9, 0xe8, 0xe3, 0xe8, 0xe8, 0xe0, 0xed, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0xf4, 0x83, 0xf4, 0xf4, 0x01, 0x01, 0xee, 0xe3, 0xe3, 0xed, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xee, 0xed, 0xe8, 0xe3, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe2, 0xe4, 0xe4, 0xe6, 0xe2, 0xe4, 0xe2, 0xe1, 0xe4, 0xe1, 0xe4, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe0, 0xe3, 0xe3, 0xe3, 0xe1, 0xe8, 0xda, 0xea, 0xe6, 0xd7, 0xf2, 0xe0, 0xe3, 0xec, 0xf2, 0xe6, 0xf1, 0xf1, 0xf0, 0xee, 0xed, 0xea, 0xe8, 0xed, 0xee, 0xe6, 0xe3, 0xe3, 0xe3, 0xe3, 0xe6, 0xe9, 0xe6, 0xe9, 0xea, 0xe9, 0xe8, 0xe9, 0xe6, 0xe4, 0xe6, 0xe2, 0xe6, 0xe2, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe4, 0xe0, 0xe6, 0xee, 0xdd, 0xe3, 0xee, 0xdb, 0xee, 0xf4, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf3, 0xe3, 0xf0, 0xee, 0xee, 0xef, 0xec, 0xea, 0xe6, 0xe4, 0xe0, 0xe4, 0xe3, 0xe4, 0xe6, 0xea, 0xec, 0xec, 0xea, 0xea, 0xe9, 0xea, 0xe9, 0xea, 0xe6, 0xe6, 0xe6, 0xe6, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe1, 0xee, 0xe8, 0xdd, 0xe0, 0xe6, 0xe6, 0xee, 0xe8, 0xe0, 0x01, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0x01, 0xf4, 0xf4, 0xf4, 0xed, 0xe8, 0xe3, 0xe0, 0xe3, 0xf0, 0xee, 0xef, 0xee, 0xf1, 0xef, 0xf0, 0xf1, 0xf2, 0xee, 0xe8, 0xe2, 0xe3, 0xe2, 0xe3, 0xe8, 0xe6, 0xe6, 0xe4, 0xe4, 0xe3, 0xe6, 0xe7, 0xe2, 0xe4, 0xe2, 0xe2, 0xe2, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe0, 0xe4, 0xe0, 0xe3, 0xe0, 0xe3, 0xe9, 0xe6, 0xe0, 0xe1, 0xf1, 0xdd, 0xe0, 0xe4, 0xf1, 0xf1, 0xef, 0xf1, 0xec, 0xef, 0xf0, 0xf1, 0xf0, 0xee, 0xee, 0xed, 0xed, 0xea, 0xed, 0xed, 0xee, 0xee, 0xee, 0xe6, 0xe8, 0xea, 0xea, 0xec, 0xea, 0xe9, 0xe2, 0xe6, 0xe4, 0xe3, 0xe4, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe0, 0xe3, 0xe0, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe9, 0xe3, 0xe0, 0xe8, 0xe8, 0xe3, 0xdb, 0xf0, 0xd7, 0xdb, 0xe3, 0xdb, 0xe3, 0xed, 0xed, 0xf0, 0xf0, 0xf3, 0xf3, 0xf3, 0x01, 0xf4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x30, 0xf6, 0x30, 0xf6, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xbd, 0xbd, 0x4a, 0xc7, 0xd7, 0xe8, 0xf3, 0xf3, 0xe3, 0xe3, 0xf0, 0xf1, 0xf2, 0xee, 0xea, 0xea, 0xea, 0xe6, 0xe9, 0xe8, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xee, 0xea, 0xed, 0xe9, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe6, 0xe0, 0xe8, 0xe9, 0xe8, 0xed, 0xe9, 0xe3, 0xe1, 0xed, 0xf2, 0xd0, 0xd7, 0xdb, 0xd0, 0xd7, 0xd7, 0xdb, 0xe0, 0xe3, 0xe3, 0xe3, 0xe6, 0xe3, 0xe8, 0xe8, 0xe8, 0xea, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0x01, 0x01, 0x01, 0xf2, 0xed, 0xe8, 0xed, 0xe6, 0xdb, 0xe0, 0xe3, 0xe2, 0xe3, 0xe6, 0xe6, 0xe8, 0xe6, 0xe2, 0xe0, 0xe0, 0xe6, 0xea, 0xea, 0xe6, 0xe8, 0xe6, 0xe6, 0xe2, 0xe4, 0xe4, 0xe6, 0xe2, 0xe4, 0xe2, 0xe2, 0xe4, 0xe4, 0xe3, 0xe2, 0xe3, 0xe4, 0xe3, 0xe1, 0xe3, 0xe0, 0xe3, 0xe1, 0xe3, 0xe4, 0xe3, 0xe3, 0xe4, 0xe3, 0xe8, 0xd7, 0xf1, 0xbd, 0xb9, 0xf0, 0xf1, 0xed, 0xf1, 0xf0, 0xee, 0xf0, 0xf1, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xed, 0xf0, 0xf2, 0xf0, 0xed, 0xea, 0xea, 0xea, 0xec, 0xea, 0xec, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe4, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe0, 0xe6, 0xe6, 0xe6, 0xea, 0xe6, 0xe8, 0xe6, 0xf8, 0x91, 0x03, 0x93, 0x93, 0xf7, 0xf7, 0x9f, 0xf8, 0xf8, 0xf5, 0xf5, 0xf5, 0xfa, 0xb2, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 
-  0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x84, 0xfc, 0x57, 0x86, 0x57, 0x86, 0x57, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x57, 0x84, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x89, 0x89, 0x02, 0x89, 0x02, 0x8b, 0x8c, 0x8c, 0xf8, 0xe8, 0x01, 0xe8, 0xe3, 0xed, 0xec, 0xee, 0xee, 0xea, 0xea, 0xee, 0xee, 0xee, 0xf1, 0xee, 0xee, 0xed, 0xec, 0xed, 0xee, 0xee, 0xee, 0xea, 0xe8, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe6, 0xea, 0xe0, 0xe3, 0xec, 0xe6, 0xe0, 0xea, 0xf4, 0xda, 0xb2, 0x96, 0x99, 0x96, 0x99, 0x99, 0x9b, 0x9b, 0x9d, 0x9f, 0x9d, 0x9f, 0x9f, 0xa2, 0x9f, 0xa6, 0xa2, 0xa6, 0xa2, 0xa6, 0xa6, 0xaa, 0xaa, 0xae, 0xaa, 0xb0, 0xb2, 0xb5, 0xb5, 0xf6, 0xba, 0xd0, 0xee, 0xf1, 0xe8, 0xee, 0xf0, 0xea, 0xe8, 0xe8, 0xe3, 0xe0, 0xe0, 0xdb, 0xdd, 0xdb, 0xe0, 0xe0, 0xe3, 0xea, 0xee, 0xea, 0xea, 0xe6, 0xe6, 0xe4, 0xe4, 0xe6, 0xe6, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe4, 0xe3, 0xe4, 0xe2, 0xe3, 0xe1, 0xe3, 0xe1, 0xe3, 0xe1, 0xe3, 0xe1, 0xe0, 0xe0, 0xea, 0xe4, 0xdd, 0xee, 0xd7, 0x9f, 0x8f, 0xfb, 0xf2, 0xf1, 0xe8, 0xf1, 0xf0, 0xf0, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xed, 0xee, 0xf0, 0xf2, 0xf0, 0xec, 0xee, 0xec, 0xed, 0xea, 0xec, 0xea, 0xea, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe4, 0xe3, 0xe6, 0xea, 0xdb, 0xe0, 0xe8, 0xf2, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xe3, 0x01, 0xf0, 0xe3, 0xe4, 0xe6, 0xe6, 0xe6, 0xea, 0xec, 0xee, 0xee, 0xef, 0xf1, 0xf1, 0xf1, 0xef, 0xec, 0xee, 0xec, 0xea, 0xea, 0xe6, 0xe8, 0xe6, 0xe8, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xea, 0xe6, 0xe8, 0xe6, 0xdd, 0xef, 0xf4, 0xe0, 0xb2, 0x8e, 0x90, 0x93, 0x93, 0x93, 0x93, 0x91, 0x93, 0x91, 0x91, 0x91, 0x93, 0x93, 0x91, 0x93, 0x91, 0x93, 0x91, 0x93, 0x91, 0x93, 0x91, 0x93, 0x91, 0x93, 0x93, 0x95, 0x93, 0x91, 0x91, 0x91, 0x93, 0xbc, 0xf2, 0xef, 0xd7, 0xe3, 0xee, 0xee, 0xee, 0xed, 0xed, 0xe8, 0xe8, 0xe8, 0xea, 0xe8, 0xed, 0xed, 0xed, 0xe8, 0xed, 0xea, 0xe8, 0xe6, 0xe2, 0xe6, 0xe4, 0xe2, 0xe7, 0xe2, 0xe7, 0xe2, 0xe2, 0xe2, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe8, 0xe0, 0xdd, 0xed, 0xf4, 0xb5, 0x8f, 0x93, 0x90, 0xa6, 0xea, 0x01, 0xf1, 0xee, 0xec, 0xed, 0xee, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xee, 0xee, 0xee, 0xec, 0xea, 0xe8, 0xea, 0xe8, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe8, 0xe4, 0xe3, 0xea, 0xe3, 0xee, 0xff, 0xbb, 0x86, 0x00, 0x89, 0x86, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x86, 0x30, 0x01, 0xf4, 0xee, 0xe6, 0xe3, 0xe6, 0xe8, 0xea, 0xe0, 0xe3, 0xe3, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe3, 0xe6, 0xe6, 0xe6, 0xe8, 0xe9, 0xea, 0xe8, 0xe9, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe4, 0xe3, 0xec, 0xe6, 0xe6, 0xf1, 0xee, 0xc7, 0x9f, 0x8d, 0x96, 0x93, 0x93, 0x93, 0x92, 0x93, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x95, 0x95, 0x95, 0x93, 0x92, 0x95, 0x96, 0x96, 0x96, 0x96, 0x8d, 0x9f, 0xbf, 0xf3, 0xf2, 0xe6, 0xec, 0xe3, 0xe6, 0xe8, 0xed, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xec, 0xed, 0xea, 0xec, 0xec, 0xe8, 0xe4, 0xe3, 0xe4, 0xe8, 0xe2, 0xe6, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe8, 0xe4, 0xe0, 0xe6, 0xf1, 0xba, 0x93, 0x96, 0x96, 0x96, 0x8f, 0x9b, 0xbd, 0xf1, 0xee, 0xea, 0xe8, 0xe8, 0xe6, 0xe6, 0xe8, 0xe8, 0xe8, 0xed, 0xed, 0xef, 0xf0, 0xec, 0xea, 0xe8, 0xea, 0xea, 0xec, 0xea, 0xe8, 0xe6, 0xe6, 0xe8, 0xe4, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe6, 0xe3, 0xe6, 0xe3, 0xe0, 0xe8, 0xea, 0xf0, 0xba, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x57, 0x86, 0x57, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x86, 0xf5, 0xd7, 0xf2, 0xf0, 0xe4, 0xe6, 0xee, 0xea, 0xe3, 0xe4, 0xe6, 0xe0, 0xe3, 0xdd, 0xdd, 0xe0, 0xe3, 0xe0, 0xe3, 0xe3, 0xe8, 0xe8, 0xe3, 0xe6, 0xe3, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xea, 0xe0, 0xee, 0xf2, 0xbd, 0x9f, 0x91, 0x95, 0x91, 0x96, 0x96, 0x93, 0x96, 0x95, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x95, 0x95, 0x95, 0x95, 0x96, 0x95, 0x96, 0x98, 0x98, 0x95, 0x95, 0x96, 0x96, 0x96, 0x9d, 0x8f, 0x9d, 0xbf, 0xf2, 0xec, 0xe1, 0xed, 0xea, 0xed, 0xed, 0xea, 0xe8, 0xed, 0xea, 0xea, 0xea, 0xed, 0xee, 0xee, 0xee, 0xea, 0xe8, 0xe4, 0xe6, 0xe2, 0xe6, 0xe6, 0xe2, 0xe7, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe2, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe0, 0xe0, 0xe1, 0xe6, 0xe4, 0xdd, 0xe4, 0xdd, 0xe1, 0xef, 0xd0, 0x96, 0x91, 0x96, 0x99, 0x93, 0x9b, 0x91, 0x96, 0xba, 0xe4, 0xf4, 0xec, 0xe6, 0xea, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe3, 0xe6, 0xea, 0xe6, 0xe8, 0xea, 0xea, 0xec, 0xee, 0xea, 0xe6, 0xe6, 0xe8, 0xe4, 0xe6, 0xe3, 0xe6, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe6, 0xe8, 0xe3, 0xe0, 0xe6, 0xe8, 0xe6, 0xe0, 0xe8, 0xed, 0xbd, 0x8f, 0x00, 0x85, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xb8, 0xee, 0xf0, 0xea, 0xea, 0xe9, 0xec, 0xea, 0xe8, 0xe9, 0xe8, 0xe2, 0xe6, 0xe3, 0xe8, 0xe8, 0xea, 0xe8, 0xea, 0xe8, 0xed, 0xe3, 0xe8, 0xe3, 0xe8, 0xe3, 0xe8, 0xe6, 0xe3, 0xe6, 0xed, 0xea, 0xe0, 0xea, 0xe6, 0xf2, 0xee, 0xb9, 0x96, 0x90, 0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x95, 0x96, 0x95, 0x96, 0x95, 0x95, 0x95, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x95, 0x96, 0x96, 0x95, 0x96, 0x95, 0x97, 0x96, 0x91, 0xa0, 0xbf, 0xf4, 0xe1, 0xe2, 0xea, 0xee, 0xf0, 0xf2, 0xf0, 0xee, 0xee, 0xed, 0xed, 0xed, 0xee, 0xf0, 0xec, 0xec, 0xe9, 0xea, 0xe4, 0xe6, 0xe4, 0xe2, 0xe4, 0xe2, 0xe6, 0xe4, 0xe6, 0xe4, 0xe3, 0xe4, 0xe3, 0xe2, 0xe3, 0xe2, 0xe6, 0xe0, 0xdd, 0xe8, 0xe4, 0xe0, 0xe3, 0xe1, 0xdd, 0xef, 0xd2, 0xab, 0x90, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x95, 0x93, 0xb0, 0xd0, 0xf2, 0xef, 0xe6, 0xec, 0xe6, 0xea, 0xe8, 0xe6, 0xe0, 0xdd, 0xdb, 0xec, 0xee, 0xee, 0xee, 0xe8, 0xe3, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe3, 0xe6, 0xe3, 0xe4, 0xe6, 0xe6, 0xe6, 0xe3, 0xe1, 0xe8, 0xe0, 0xe1, 0xe8, 0xe4, 0xe0, 0xe6, 0xe2, 0xed, 0xf2, 0xbd, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe0, 0x01, 0xe9, 0xee, 0xe9, 0xe2, 0xe6, 0xea, 0xec, 0xe9, 0xe3, 0xe8, 0xe8, 0xe8, 0xe3, 0xe3, 0xe3, 0xe3, 0xe8, 0xe3, 0xe8, 0xe8, 0xe8, 0xea, 0xe3, 0xe6, 0xe8, 0xea, 0xee, 0xec, 0xe4, 0xf1, 0xf2, 0xd0, 0xb4, 0x8f, 0x91, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x98, 0x98, 0x96, 0x90, 0xa0, 0xc1, 0xf2, 0xe3, 0xe0, 0xe3, 0xe8, 0xea, 0xf0, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xea, 0xea, 0xe9, 0xe9, 0xe9, 0xe6, 0xe6, 0xe4, 0xe4, 0xe4, 0xe2, 0xe4, 0xe2, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe0, 0xe8, 0xea, 0xe0, 0xe0, 0xe6, 0xe4, 0xe7, 0xe2, 0xdf, 0xb3, 0x8f, 0x98, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x99, 0x93, 0x99, 0xb8, 0xe1, 0xf4, 0xef, 0xe4, 0xe9, 0xea, 0xe4, 0xe0, 0xe0, 0xe4, 0xe3, 0xe0, 0xe2, 0xe6, 0xea, 0xea, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe3, 0xe4, 0xe8, 0xe8, 0xe6, 0xf1, 0x83, 0xbb, 0x8f, 0x85, 0x89, 0x85, 0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x89, 0x8a, 0x8b, 0x8e, 0x8e, 0x90, 0x90, 0x96, 0xb9, 0xea, 0xec, 0xef, 0xee, 0xe9, 0xe9, 0xe2, 0xe6, 0xe4, 0xe8, 0xe6, 0xea, 0xee, 0xee, 0xee, 0xed, 0xed, 0xea, 0xe6, 0xe3, 0xe3, 0xe3, 0xec, 0xee, 0xe4, 0xda, 0xdd, 0xec, 0xf2, 0xdd, 0xb9, 0x9b, 0x8f, 0x95, 0x9b, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x97, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x97, 0x95, 0x98, 0x96, 0x96, 0x96, 0x96, 0x97, 0x95, 0x96, 0x95, 0x9a, 0x90, 0x97, 0xc7, 0x01, 0xea, 0xdd, 0xe3, 0xec, 0xe3, 0xe3, 0xe8, 0xea, 0xee, 0xed, 0xea, 0xe8, 0xe8, 0xe9, 0xe6, 0xe9, 0xe6, 0xe9, 0xe6, 0xe4, 0xe2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xe6, 0xe0, 0xdd, 0xea, 0xed, 0xd7, 0xec, 0xe7, 0xb0, 0x93, 0x99, 0x93, 0x99, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x96, 0x98, 0x96, 0x9d, 0xb8, 0xcf, 0xf2, 0xf4, 0xf2, 0xee, 0xe6, 0xea, 0xee, 0xe6, 0xe0, 0xe0, 0xe3, 0xe8, 0xe8, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe3, 0xe6, 0xe3, 0xe4, 0xe0, 0xe3, 0xe4, 0xe6, 0xe8, 0xd7, 0xe6, 0xea, 0xe3, 0xe9, 0xee, 0xf1, 0xcf, 0xae, 0x96, 0x91, 0x93, 0x91, 0x91, 0x90, 0x90, 0x8e, 0x8d, 0x8b, 0x8b, 0x8a, 0x89, 0x85, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x86, 0x57, 0x00, 0x00, 0x00, 0x00, 0x84, 0x89, 0x8b, 0x8e, 0x93, 0x93, 0x96, 0x99, 0x9d, 0x9b, 0xa0, 0x98, 0x96, 0x98, 0x8f, 0x92, 0xb5, 0xc7, 0xdc, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xea, 0xea, 0xea, 0xe4, 0xe4, 0xe0, 0xe4, 0xe9, 0xea, 0xe9, 0xe6, 0xe9, 0xec, 0xe1, 0xe1, 0xec, 0xf4, 0xf4, 0xd7, 0xba, 0x9d, 0x8e, 0x90, 0x9e, 0x95, 0x90, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x95, 0x96, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x95, 0x96, 0x97, 0x95, 0x96, 0x97, 0x95, 0x96, 0x97, 0x95, 0x96, 0x97, 0x95, 0x97, 0x96, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x92, 0x9d, 0x98, 0x95, 0x98, 0x90, 0xf6, 0xee, 0xf4, 0xdd, 0xe8, 0xea, 0xe3, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 0xe8, 0xea, 0xe3, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe8, 0xdd, 0xe1, 0xee, 0xdd, 0xd7, 0xf1, 0xdf, 0xad, 0x91, 0x95, 0x96, 0x95, 0x95, 0x96, 0x98, 0x96, 0x96, 0x96, 0x96, 0x9b, 0x95, 0x91, 0x9b, 0x96, 0x8f, 0x93, 0xa2, 0xb8, 0xc7, 0xea, 0xf1, 0xec, 0xe6, 0xe0, 0xe0, 0xe0, 0xe9, 0xec, 0xea, 0xe9, 0xec, 0xea, 0xea, 0xe9, 0xe9, 0xe6, 0xe6, 0xe4, 0xe6, 0xe4, 0xe6, 0xe8, 0xe9, 0xf2, 0xec, 0xe1, 0xec, 0xf0, 0xd5, 0xba, 0x96, 0x8e, 0x96, 0x98, 0x95, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x9b, 0x9d, 0x9b, 0x9b, 0x99, 0x99, 0x93, 0x91, 0x90, 0x8f, 0x8d, 0x8b, 0x8a, 0x85, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x84, 0x89, 0x8b, 0x8f, 0x93, 0x99, 0x9b, 0x9d, 0x9b, 0x9b, 0x9a, 0x99, 0x98, 0x96, 0x95, 0x98, 0x98, 0x96, 0x99, 0x97, 0x8f, 0x90, 0x9b, 0xb3, 0xb8, 0xbb, 0xc9, 0xd8, 0xd8, 0xdd, 0xe1, 0xe7, 0xec, 0xef, 0xea, 0xe9, 0xec, 0xe7, 0xe1, 0xdf, 0xe4, 0xe1, 0xdd, 0xcb, 0xbb, 0xb6, 0x9d, 0x8d, 0x90, 0x98, 0x98, 0x93, 0x96, 0x96, 0x95, 0x95, 0x96, 0x95, 0x97, 0x95, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x9a, 0x96, 0x92, 0x98, 0x98, 0x96, 0x95, 0x8f, 0xb2, 0xc7, 0xf1, 0xef, 0xe8, 0xea, 0xea, 0xea, 0xe8, 0xe6, 0xe8, 0xea, 0xe8, 0xe8, 0xe6, 0xe8, 0xe6, 0xe8, 0xe8, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe3, 0xe6, 0xe2, 0xe4, 0xe2, 0xe4, 0xe2, 0xe4, 0xe0, 0xec, 0xe6, 0xda, 0xef, 0xf1, 0xd2, 0xa6, 0x91, 0x93, 0x97, 0x93, 0x99, 0x98, 0x96, 0x96, 0x98, 0x98, 0x98, 0x96, 0x96, 0x9b, 0x9d, 0x93, 0x96, 0x9d, 0x95, 0x91, 0x91, 0x93, 0x9d, 0xb2, 0xb9, 0xc3, 0xcf, 0xd5, 0xdd, 0xe3, 0xe9, 0xec, 0xea, 0xea, 0xea, 0xea, 0xec, 0xea, 0xec, 0xee, 0xef, 0xee, 0xef, 0xec, 0xea, 0xe9, 0xd7, 0xd7, 0xd7, 0xc3, 0xf6, 0x9d, 0x8e, 0x91, 0x9a, 0x97, 0x93, 0x98, 0x95, 0x95, 0x95, 0x96, 0x95, 0x96, 0x95, 0x96, 0x9a, 0x99, 0x9b, 0x9a, 0x9d, 0x9b, 0x9d, 0xa0, 0x9d, 0x99, 0x93, 0x8f, 0x8e, 0x8b, 0x89, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x8c, 0x91, 0x99, 0x99, 0x9b, 0x9b, 0x9b, 0x99, 0x97, 0x98, 0x95, 0x97, 0x95, 0x98, 0x95, 0x99, 0x95, 0x97, 0x99, 0x98, 0x97, 0x98, 0x97, 0x97, 0x91, 0x92, 0x93, 0x97, 0x9b, 0xa2, 0xa6, 0xab, 0xb2, 0xb4, 0xb5, 0xb6, 0xb8, 0xb7, 0xb5, 0xb2, 0xb0, 0xb2, 0xa6, 0xa2, 0x99, 0x91, 0x90, 0x92, 0x96, 0x9a, 0x95, 0x95, 0x97, 0x95, 0x97, 0x98, 0x95, 0x95, 0x97, 0x95, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x96, 0x97, 0x96, 0x96, 0x97, 0x96, 0x96, 0x97, 0x96, 0x96, 0x97, 0x95, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99, 0x96, 0x95, 0x98, 0x96, 0x92, 0x9d, 0x98, 0x8f, 0x9f, 0xb9, 0xd7, 0xea, 0xef, 0xee, 0xea, 0xea, 0xea, 0xea, 0xed, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe6, 0xe8, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe0, 0xe6, 0xe4, 0xe8, 0xe6, 0xbc, 0xa2, 0x8f, 0x98, 0x96, 0x96, 0x98, 0x96, 0x98, 0x96, 0x96, 0x98, 0x98, 0x96, 0x98, 0x95, 0x95, 0x97, 0x9b, 0x99, 0x95, 0x99, 0x96, 0x96, 0x98, 0x96, 0x93, 0x93, 0x91, 0x96, 0x9f, 0xa6, 0xae, 0xb5, 0xfb, 0xb9, 0xba, 0xba, 0xba, 0xbb, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xba, 0xb9, 0xf6, 0xb3, 0xaa, 0x9d, 0x96, 0x90, 0x91, 0x96, 0x99, 0x95, 0x92, 0x99, 0x95, 0x95, 0x97, 0x98, 0x97, 0x97, 0x97, 0x96, 0x97, 0x95, 0x97, 0x97, 0x98, 0x98, 0x9a, 0x99, 0x99, 0x99, 0x9b, 0x9d, 0x9d, 0x9d, 0x9b, 0x93, 0x8f, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x8b, 0x93, 0xf8, 0x98, 0x96, 0x96, 0x96, 0x98, 0x9b, 0x9a, 0x97, 0x98, 0x97, 0x98, 0x98, 0x98, 0x99, 0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x97, 0x97, 0x98, 0x9a, 0x99, 0x97, 0x95, 0x92, 0x95, 0x93, 0x95, 0x91, 0x92, 0x91, 0x91, 0x92, 0x91, 0x92, 0x91, 0x95, 0x91, 0x92, 0x93, 0x95, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x98, 0x95, 0x95, 0x95, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x97, 0x96, 0x97, 0x97, 0x96, 0x98, 0x98, 0x96, 0x99, 0x95, 0x95, 0x96, 0x91, 0x90, 0xa6, 0xb8, 0xc3, 0xea, 0xf1, 0xf1, 0xec, 0xe8, 0xe4, 0xe3, 0xe6, 0xe8, 0xe3, 0xe0, 0xe3, 0xe8, 0xe8, 0xe8, 0xe6, 0xe6, 0xe8, 0xe6, 0xe8, 0xe4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe4, 0xee, 0xf1, 0xcb, 0xb5, 0x96, 0x91, 0x96, 0x97, 0x98, 0x98, 0x96, 0x95, 0x98, 0x96, 0x96, 0x98, 0x96, 0x96, 0x96, 0x98, 0x98, 0x96, 0x98, 0x98, 0x96, 0x96, 0x99, 0x96, 0x99, 0x96, 0x99, 0x99, 0x99, 0x95, 0x96, 0x96, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x95, 0x96, 0x95, 0x96, 0x96, 0x96, 0x96, 0x93, 0x96, 0x91, 0x93, 0x91, 0x91, 0x91, 0x93, 0x93, 0x95, 0x93, 0x95, 0x97, 0x92, 0x95, 0x97, 0x97, 0x97, 0x98, 0x97, 0x97, 0x97, 0x96, 0x96, 0x98, 0x98, 0x9a, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x98, 0x98, 0x99, 0x9b, 0x99, 0xf7, 0xf7, 0x8f, 0xfc, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x02, 0x03, 0x99, 0x99, 0x9b, 0x9b, 0x99, 0x96, 0x93, 0x93, 0x99, 0x98, 0x99, 0x98, 0x9a, 0x98, 0x97, 0x95, 0x97, 0x96, 0x97, 0x97, 0x97, 0x99, 0x9a, 0x99, 0x98, 0x98, 0x97, 0x98, 0x99, 0x9a, 0x98, 0x99, 0x98, 0x99, 0x98, 0x97, 0x98, 0x97, 0x97, 0x97, 0x95, 0x98, 0x96, 0x97, 0x96, 0x98, 0x95, 0x98, 0x95, 0x98, 0x95, 0x97, 0x95, 0x97, 0x95, 0x96, 0x97, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x98, 0x97, 0x97, 0x98, 0x97, 0x97, 0x98, 0x97, 0x97, 0x98, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x98, 0x97, 0x97, 0x97, 0x96, 0x98, 0x96, 0x98, 0x98, 0x93, 0x91, 0x96, 0x9b, 0xa6, 0xba, 0xd7, 0xec, 0xf2, 0xf1, 0xe6, 0xea, 0xec, 0xe8, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdd, 0xe0, 0xdd, 0xe0, 0xe1, 0xe1, 0xe0, 0xe1, 0xec, 0xef, 0xef, 0xf1, 0xcb, 0xb2, 0x96, 0x91, 0x96, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x96, 0x98, 0x98, 0x99, 0x96, 0x99, 0x96, 0x99, 0x96, 0x99, 0x96, 0x99, 0x99, 0x98, 0x99, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x96, 0x93, 0x96, 0x95, 0x96, 0x96, 0x96, 0x99, 0x96, 0x99, 0x99, 0x99, 0x96, 0x99, 0x97, 0x97, 0x98, 0x97, 0x98, 0x97, 0x95, 0x95, 0x95, 0x95, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x98, 0x96, 0x96, 0x96, 0x96, 0xf7, 0xa2, 0xf7, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x86, 0x8a, 0x8f, 0x93, 0x96, 0x9d, 0x9d, 0x9d, 0x9b, 0x99, 0x99, 0x97, 0x96, 0x93, 0x93, 0x95, 0x97, 0x97, 0x97, 0x98, 0x98, 0x99, 0x97, 0x96, 0x97, 0x98, 0x99, 0x99, 0x99, 0x97, 0x95, 0x97, 0x96, 0x98, 0x97, 0x98, 0x9a, 0x98, 0x99, 0x98, 0x98, 0x98, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x97, 0x97, 0x97, 0x95, 0x95, 0x98, 0x99, 0x95, 0x93, 0x93, 0x93, 0x90, 0x8f, 0x9c, 0xb5, 0xba, 0xcb, 0xdd, 0xe6, 0xee, 0xef, 0xee, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xc1, 0xba, 0xa0, 0x95, 0x93, 0x91, 0x95, 0x98, 0x9b, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x97, 0x98, 0x98, 0x98, 0x96, 0x98, 0x96, 0x99, 0x96, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x96, 0x99, 0x99, 0x99, 0x99, 0x96, 0x96, 0x96, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x98, 0x98, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x97, 0x95, 0x95, 0x96, 0x99, 0x9b, 0x9d, 0x9d, 0x9b, 0x96, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x86, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x8a, 0x8e, 0x90, 0x91, 0x96, 0x96, 0x96, 0x99, 0x9b, 0x9b, 0x99, 0x96, 0x98, 0x96, 0x96, 0x96, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x99, 0x9a, 0x98, 0x99, 0x98, 0x99, 0x98, 0x96, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x98, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x97, 0x97, 0x96, 0x97, 0x96, 0x98, 0x97, 0x95, 0x95, 0x97, 0x99, 0x98, 0x97, 0x96, 0x96, 0x97, 0x93, 0x90, 0x8f, 0x8f, 0x91, 0x9d, 0xa6, 0xb2, 0xb5, 0xb8, 0xb8, 0xb8, 0xb9, 0xb8, 0xb9, 0xf6, 0xb8, 0xb8, 0xb3, 0xa6, 0x9b, 0x91, 0x8e, 0x91, 0x93, 0x96, 0x9b, 0x99, 0x96, 0x91, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x9a, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x99, 0x98, 0x99, 0x98, 0x97, 0x99, 0x98, 0x99, 0x96, 0x98, 0x96, 0x96, 0x99, 0x99, 0x98, 0x99, 0x98, 0x96, 0x98, 0x96, 0x98, 0x97, 0x99, 0x97, 0x99, 0x96, 0x95, 0x96, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x99, 0x9b, 0x9b, 0x9d, 0x9d, 0x9b, 0x99, 0x93, 0x90, 0x8c, 0x8a, 0x89, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x84, 0x57, 0x84, 0x00, 0x00, 0x00, 0x00, 0x84, 0x89, 0x8a, 0x8b, 0x8c, 0x8f, 0x8f, 0x91, 0x93, 0x93, 0x96, 0x96, 0x99, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x98, 0x96, 0x98, 0x98, 0x98, 0x97, 0x96, 0x97, 0x96, 0x95, 0x97, 0x95, 0x98, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x98, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x97, 0x97, 0x98, 0x97, 0x98, 0x97, 0x98, 0x97, 0x97, 0x97, 0x96, 0x97, 0x97, 0x97, 0x97, 0x98, 0x9a, 0x98, 0x95, 0x97, 0x95, 0x96, 0x96, 0x95, 0x96, 0x96, 0x96, 0x93, 0x95, 0x93, 0x92, 0x90, 0x90, 0x8f, 0x8e, 0x90, 0x8f, 0x90, 0x90, 0x8f, 0x90, 0x8f, 0x8e, 0x90, 0x90, 0x93, 0x95, 0x99, 0x98, 0x96, 0x96, 0x95, 0x96, 0x96, 0x99, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x96, 0x96, 0x98, 0x96, 0x99, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x96, 0x93, 0x91, 0x8f, 0x8e, 0x8c, 0x8a, 0x8a, 0x86, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x84, 0x57, 0x57, 0x00, 0x57, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x85, 0x89, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x8f, 0x90, 0x93, 0x93, 0x95, 0x96, 0x98, 0x99, 0x99, 0x9b, 0x9a, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x97, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x98, 0x97, 0x97, 0x97, 0x98, 0x97, 0x98, 0x97, 0x98, 0x97, 0x98, 0x97, 0x98, 0x97, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x95, 0x95, 0x98, 0x98, 0x97, 0x98, 0x97, 0x97, 0x96, 0x95, 0x95, 0x96, 0x95, 0x98, 0x96, 0x95, 0x95, 0x95, 0x95, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x95, 0x95, 0x96, 0x96, 0x95, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x98, 0x99, 0x98, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x9a, 0x98, 0x9a, 0x98, 0x98, 0x98, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97, 0x98, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x9b, 0x9b, 0x9b, 0x9b, 0x99, 0x9b, 0x99, 0x99, 0x99, 0x96, 0x96, 0x96, 0x95, 0x93, 0x90, 0x90, 0x8e, 0x8e, 0x8d, 0x8b, 0x8a, 0x8a, 0x89, 0x86, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x84, 0x84, 0x84, 0x85, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8d, 0x8e, 0x8e, 0x90, 0x91, 0x91, 0x95, 0x96, 0x99, 0x99, 0x9b, 0x9b, 0x9b, 0x99, 0x9b, 0x99, 0x99, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x98, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x96, 0x97, 0x98, 0x97, 0x98, 0x97, 0x97, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x97, 0x95, 0x99, 0x99, 0x97, 0x96, 0x96, 0x99, 0x95, 0x93, 0x95, 0x96, 0x95, 0x95, 0x93, 0x95, 0x93, 0x92, 0x96, 0x95, 0x95, 0x93, 0x95, 0x95, 0x96, 0x96, 0x96, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x99, 0x96, 0x98, 0x96, 0x98, 0x96, 0x98, 0x96, 0x99, 0x98, 0x98, 0x99, 0x98, 0x99, 0x98, 0x98, 0x98, 0x9a, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x9b, 0x9a, 0x9b, 0x9a, 0x9a, 0x9b, 0x9a, 0x9b, 0x9a, 0x9b, 0x9a, 0x9b, 0x9d, 0x9b, 0x9b, 0x99, 0x99, 0x99, 0x96, 0x95, 0x93, 0x91, 0x90, 0x8f, 0x8f, 0x8d, 0x8c, 0x8b, 0x8b, 0x89, 0x89, 0x89, 0x85, 0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x86, 0x86, 0x89, 0x8a, 0x8a, 0x8b, 0x8c, 0x8e, 0x8e, 0x8f, 0x8f, 0x8f, 0x91, 0x91, 0x93, 0x96, 0x96, 0x99, 0x99, 0x99, 0x9b, 0x9b, 0x9d, 0x9b, 0x99, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9b, 0x9d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9b, 0x99, 0x9b, 0x99, 0x9b, 0x9b, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x99, 0x96, 0x99, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x99, 0x96, 0x99, 0x99, 0x96, 0x99, 0x96, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9b, 0x9b, 0x99, 0x99, 0x9b, 0x99, 0x99, 0x99, 0x96, 0x96, 0x96, 0x96, 0x93, 0x93, 0x91, 0x90, 0x8f, 0x8f, 0x8e, 0x8e, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x86, 0x89, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x84, 0x85, 0x84, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8e, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x8f, 0x8e, 0x8e, 0x8f, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x91, 0x90, 0x90, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x90, 0x90, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8f, 0x8e, 0x8f, 0x8e, 0x8e, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x84, 0x84, 0x84, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86, 0x86, 0x84, 0x86, 0x84, 0x86, 0x86, 0x84, 0x86, 0x84, 0x86, 0x84, 0x84, 0x86, 0x84, 0x86, 0x84, 0x84, 0xfc, 0x84, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x57, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0xfc, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_img_dsc_t image19 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image19_map,
-};
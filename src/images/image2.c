@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE2
-#define LV_ATTRIBUTE_IMG_IMAGE2
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE2 uint8_t image2_map[] = {
-  0x0b, 0x0b, 0x0b, 0xff, 	/*Color of index 0*/
-  0xb9, 0xcb, 0xfb, 0xff, 	/*Color of index 1*/
-  0xb2, 0xc3, 0xf7, 0xff, 	/*Color of index 2*/
-  0xba, 0xc2, 0xf2, 0xff, 	/*Color of index 3*/
-  0xb8, 0xbe, 0xed, 0xff, 	/*Color of index 4*/
-  0xab, 0xba, 0xf1, 0xff, 	/*Color of index 5*/
-  0xb4, 0xb6, 0xe9, 0xff, 	/*Color of index 6*/
-  0xab, 0xb2, 0xf7, 0xff, 	/*Color of index 7*/
-  0xaa, 0xb2, 0xf5, 0xff, 	/*Color of index 8*/
-  0xa8, 0xb2, 0xf1, 0xff, 	/*Color of index 9*/
-  0xa6, 0xb3, 0xec, 0xff, 	/*Color of index 10*/
-  0xad, 0xaf, 0xf7, 0xff, 	/*Color of index 11*/
-  0xaa, 0xae, 0xf6, 0xff, 	/*Color of index 12*/
-  0xb3, 0xb0, 0xe3, 0xff, 	/*Color of index 13*/
-  0xa6, 0xaa, 0xec, 0xff, 	/*Color of index 14*/
-  0xb2, 0xaa, 0xe2, 0xff, 	/*Color of index 15*/
-  0xb8, 0xa9, 0xe3, 0xff, 	/*Color of index 16*/
-  0xac, 0xa8, 0xe0, 0xff, 	/*Color of index 17*/
-  0x9e, 0xa6, 0xe6, 0xff, 	/*Color of index 18*/
-  0xb3, 0xa5, 0xe2, 0xff, 	/*Color of index 19*/
-  0x98, 0xa9, 0xdb, 0xff, 	/*Color of index 20*/
-  0xa1, 0xa0, 0xea, 0xff, 	/*Color of index 21*/
-  0x93, 0xa6, 0xd9, 0xff, 	/*Color of index 22*/
-  0xa0, 0xa1, 0xe0, 0xff, 	/*Color of index 23*/
-  0x9c, 0x9a, 0xe0, 0xff, 	/*Color of index 24*/
-  0x91, 0x9b, 0xdf, 0xff, 	/*Color of index 25*/
-  0xa9, 0x9b, 0xd0, 0xff, 	/*Color of index 26*/
-  0x8f, 0x95, 0xe2, 0xff, 	/*Color of index 27*/
-  0x99, 0x8f, 0xe8, 0xff, 	/*Color of index 28*/
-  0x95, 0x91, 0xe1, 0xff, 	/*Color of index 29*/
-  0x8f, 0x97, 0xce, 0xff, 	/*Color of index 30*/
-  0x98, 0x8f, 0xe5, 0xff, 	/*Color of index 31*/
-  0x88, 0x98, 0xc2, 0xff, 	/*Color of index 32*/
-  0x92, 0x8b, 0xe4, 0xff, 	/*Color of index 33*/
-  0x8f, 0x8d, 0xdc, 0xff, 	/*Color of index 34*/
-  0x8d, 0x89, 0xe0, 0xff, 	/*Color of index 35*/
-  0x89, 0x88, 0xce, 0xff, 	/*Color of index 36*/
-  0x85, 0x8b, 0xc2, 0xff, 	/*Color of index 37*/
-  0x7e, 0x84, 0xbd, 0xff, 	/*Color of index 38*/
-  0x7c, 0x7a, 0xd9, 0xff, 	/*Color of index 39*/
-  0x85, 0x80, 0xa5, 0xff, 	/*Color of index 40*/
-  0x78, 0x77, 0xc1, 0xff, 	/*Color of index 41*/
-  0x72, 0x79, 0xab, 0xff, 	/*Color of index 42*/
-  0x6c, 0x6a, 0xd9, 0xff, 	/*Color of index 43*/
-  0x69, 0x64, 0xe4, 0xff, 	/*Color of index 44*/
-  0x78, 0x76, 0x9e, 0xff, 	/*Color of index 45*/
-  0x66, 0x6b, 0xc5, 0xff, 	/*Color of index 46*/
-  0x68, 0x68, 0xb0, 0xff, 	/*Color of index 47*/
-  0x5f, 0x63, 0xc3, 0xff, 	/*Color of index 48*/
-  0x67, 0x6b, 0x9f, 0xff, 	/*Color of index 49*/
-  0x64, 0x65, 0x8c, 0xff, 	/*Color of index 50*/
-  0x5a, 0x61, 0x96, 0xff, 	/*Color of index 51*/
-  0x52, 0x5a, 0x8e, 0xff, 	/*Color of index 52*/
-  0x49, 0x58, 0x86, 0xff, 	/*Color of index 53*/
-  0x56, 0x58, 0x7b, 0xff, 	/*Color of index 54*/
-  0x40, 0x52, 0x8e, 0xff, 	/*Color of index 55*/
-  0x3d, 0x4f, 0x91, 0xff, 	/*Color of index 56*/
-  0x3d, 0x4f, 0x8e, 0xff, 	/*Color of index 57*/
-  0x42, 0x51, 0x83, 0xff, 	/*Color of index 58*/
-  0x3c, 0x4b, 0x81, 0xff, 	/*Color of index 59*/
-  0x44, 0x4b, 0x75, 0xff, 	/*Color of index 60*/
-  0x35, 0x47, 0x73, 0xff, 	/*Color of index 61*/
-  0x38, 0x42, 0x7a, 0xff, 	/*Color of index 62*/
-  0x2e, 0x3c, 0x6e, 0xff, 	/*Color of index 63*/
-  0x2d, 0x3b, 0x63, 0xff, 	/*Color of index 64*/
-  0x32, 0x3c, 0x5a, 0xff, 	/*Color of index 65*/
-  0x32, 0x3b, 0x51, 0xff, 	/*Color of index 66*/
-  0x2b, 0x39, 0x5a, 0xff, 	/*Color of index 67*/
-  0x2a, 0x33, 0x68, 0xff, 	/*Color of index 68*/
-  0x2a, 0x33, 0x63, 0xff, 	/*Color of index 69*/
-  0x32, 0x39, 0x4a, 0xff, 	/*Color of index 70*/
-  0x2e, 0x36, 0x53, 0xff, 	/*Color of index 71*/
-  0x2a, 0x34, 0x59, 0xff, 	/*Color of index 72*/
-  0x25, 0x31, 0x62, 0xff, 	/*Color of index 73*/
-  0x24, 0x2e, 0x65, 0xff, 	/*Color of index 74*/
-  0x23, 0x2c, 0x59, 0xff, 	/*Color of index 75*/
-  0x27, 0x2e, 0x4b, 0xff, 	/*Color of index 76*/
-  0x23, 0x2c, 0x52, 0xff, 	/*Color of index 77*/
-  0x1c, 0x2b, 0x51, 0xff, 	/*Color of index 78*/
-  0x26, 0x2d, 0x42, 0xff, 	/*Color of index 79*/
-  0x20, 0x27, 0x4b, 0xff, 	/*Color of index 80*/
-  0x1d, 0x24, 0x53, 0xff, 	/*Color of index 81*/
-  0x18, 0x23, 0x4a, 0xff, 	/*Color of index 82*/
-  0x21, 0x23, 0x42, 0xff, 	/*Color of index 83*/
-  0x21, 0x24, 0x2c, 0xff, 	/*Color of index 84*/
-  0x1c, 0x22, 0x33, 0xff, 	/*Color of index 85*/
-  0x0e, 0x1b, 0x3c, 0xff, 	/*Color of index 86*/
-  0x18, 0x1d, 0x2c, 0xff, 	/*Color of index 87*/
-  0x18, 0x1b, 0x23, 0xff, 	/*Color of index 88*/
-  0x0c, 0x16, 0x2e, 0xff, 	/*Color of index 89*/
-  0x13, 0x17, 0x23, 0xff, 	/*Color of index 90*/
-  0x13, 0x13, 0x18, 0xff, 	/*Color of index 91*/
-  0x0c, 0x0f, 0x19, 0xff, 	/*Color of index 92*/
-  0x05, 0x0d, 0x21, 0xff, 	/*Color of index 93*/
-  0x06, 0x09, 0x2e, 0xff, 	/*Color of index 94*/
-  0x0e, 0x0f, 0x13, 0xff, 	/*Color of index 95*/
-  0x0e, 0x0c, 0x19, 0xff, 	/*Color of index 96*/
-  0x0a, 0x0b, 0x12, 0xff, 	/*Color of index 97*/
-  0x06, 0x06, 0x12, 0xff, 	/*Color of index 98*/
-  0x00, 0x01, 0x17, 0xff, 	/*Color of index 99*/
-  0x02, 0x03, 0x09, 0xff, 	/*Color of index 100*/
-  0xea, 0xf2, 0xfd, 0xff, 	/*Color of index 101*/
-  0xd1, 0xe7, 0xfe, 0xff, 	/*Color of index 102*/
-  0xde, 0xe6, 0xf0, 0xff, 	/*Color of index 103*/
-  0xcb, 0xe2, 0xfe, 0xff, 	/*Color of index 104*/
-  0xc4, 0xdf, 0xfe, 0xff, 	/*Color of index 105*/
-  0xc1, 0xdb, 0xfd, 0xff, 	/*Color of index 106*/
-  0xc7, 0xdc, 0xf7, 0xff, 	/*Color of index 107*/
-  0xbc, 0xd7, 0xfb, 0xff, 	/*Color of index 108*/
-  0xbb, 0xd8, 0xf6, 0xff, 	/*Color of index 109*/
-  0xc2, 0xd8, 0xf3, 0xff, 	/*Color of index 110*/
-  0xb6, 0xd6, 0xfa, 0xff, 	/*Color of index 111*/
-  0xbd, 0xd3, 0xfd, 0xff, 	/*Color of index 112*/
-  0xb6, 0xd6, 0xf5, 0xff, 	/*Color of index 113*/
-  0xb8, 0xd4, 0xf9, 0xff, 	/*Color of index 114*/
-  0xb8, 0xd3, 0xf5, 0xff, 	/*Color of index 115*/
-  0xb5, 0xd1, 0xf9, 0xff, 	/*Color of index 116*/
-  0xbd, 0xd4, 0xeb, 0xff, 	/*Color of index 117*/
-  0xb4, 0xd1, 0xf5, 0xff, 	/*Color of index 118*/
-  0xb0, 0xd0, 0xf9, 0xff, 	/*Color of index 119*/
-  0xae, 0xd0, 0xf4, 0xff, 	/*Color of index 120*/
-  0xb3, 0xce, 0xf9, 0xff, 	/*Color of index 121*/
-  0xb5, 0xd1, 0xee, 0xff, 	/*Color of index 122*/
-  0xb7, 0xce, 0xf2, 0xff, 	/*Color of index 123*/
-  0xb1, 0xcd, 0xf3, 0xff, 	/*Color of index 124*/
-  0xad, 0xca, 0xf6, 0xff, 	/*Color of index 125*/
-  0xb1, 0xc9, 0xea, 0xff, 	/*Color of index 126*/
-  0xb8, 0xcc, 0xdd, 0xff, 	/*Color of index 127*/
-  0xaa, 0xc4, 0xef, 0xff, 	/*Color of index 128*/
-  0xab, 0xc2, 0xe1, 0xff, 	/*Color of index 129*/
-  0xa2, 0xbe, 0xec, 0xff, 	/*Color of index 130*/
-  0xa3, 0xba, 0xe0, 0xff, 	/*Color of index 131*/
-  0xab, 0xbc, 0xcf, 0xff, 	/*Color of index 132*/
-  0x9c, 0xb2, 0xde, 0xff, 	/*Color of index 133*/
-  0x9e, 0xb4, 0xd1, 0xff, 	/*Color of index 134*/
-  0xb0, 0xb7, 0xc0, 0xff, 	/*Color of index 135*/
-  0x93, 0xaa, 0xca, 0xff, 	/*Color of index 136*/
-  0x93, 0xa7, 0xd3, 0xff, 	/*Color of index 137*/
-  0x8c, 0xa2, 0xd1, 0xff, 	/*Color of index 138*/
-  0x8c, 0xa3, 0xc2, 0xff, 	/*Color of index 139*/
-  0xa1, 0xa7, 0xa8, 0xff, 	/*Color of index 140*/
-  0x8a, 0x9c, 0xb2, 0xff, 	/*Color of index 141*/
-  0x80, 0x98, 0xbe, 0xff, 	/*Color of index 142*/
-  0x8e, 0x97, 0xa6, 0xff, 	/*Color of index 143*/
-  0x83, 0x94, 0xad, 0xff, 	/*Color of index 144*/
-  0x79, 0x90, 0xb2, 0xff, 	/*Color of index 145*/
-  0x7d, 0x8c, 0x9e, 0xff, 	/*Color of index 146*/
-  0x71, 0x87, 0xad, 0xff, 	/*Color of index 147*/
-  0x6d, 0x82, 0xa1, 0xff, 	/*Color of index 148*/
-  0x73, 0x82, 0x92, 0xff, 	/*Color of index 149*/
-  0x65, 0x79, 0x9b, 0xff, 	/*Color of index 150*/
-  0x71, 0x7a, 0x88, 0xff, 	/*Color of index 151*/
-  0x66, 0x74, 0x89, 0xff, 	/*Color of index 152*/
-  0x5d, 0x6f, 0x96, 0xff, 	/*Color of index 153*/
-  0x53, 0x67, 0x86, 0xff, 	/*Color of index 154*/
-  0x66, 0x6a, 0x6c, 0xff, 	/*Color of index 155*/
-  0x53, 0x62, 0x78, 0xff, 	/*Color of index 156*/
-  0x47, 0x58, 0x77, 0xff, 	/*Color of index 157*/
-  0x57, 0x5b, 0x5e, 0xff, 	/*Color of index 158*/
-  0x42, 0x53, 0x75, 0xff, 	/*Color of index 159*/
-  0x3a, 0x50, 0x7a, 0xff, 	/*Color of index 160*/
-  0x43, 0x50, 0x6b, 0xff, 	/*Color of index 161*/
-  0x3a, 0x4d, 0x72, 0xff, 	/*Color of index 162*/
-  0x37, 0x4b, 0x79, 0xff, 	/*Color of index 163*/
-  0x45, 0x4e, 0x5f, 0xff, 	/*Color of index 164*/
-  0x3c, 0x4a, 0x6a, 0xff, 	/*Color of index 165*/
-  0x33, 0x44, 0x6a, 0xff, 	/*Color of index 166*/
-  0x3a, 0x46, 0x60, 0xff, 	/*Color of index 167*/
-  0x40, 0x47, 0x52, 0xff, 	/*Color of index 168*/
-  0x31, 0x41, 0x60, 0xff, 	/*Color of index 169*/
-  0x38, 0x40, 0x52, 0xff, 	/*Color of index 170*/
-  0x2b, 0x39, 0x53, 0xff, 	/*Color of index 171*/
-  0x27, 0x37, 0x54, 0xff, 	/*Color of index 172*/
-  0x2b, 0x38, 0x4c, 0xff, 	/*Color of index 173*/
-  0x26, 0x35, 0x52, 0xff, 	/*Color of index 174*/
-  0x26, 0x36, 0x4d, 0xff, 	/*Color of index 175*/
-  0x22, 0x33, 0x58, 0xff, 	/*Color of index 176*/
-  0x30, 0x37, 0x42, 0xff, 	/*Color of index 177*/
-  0x25, 0x33, 0x51, 0xff, 	/*Color of index 178*/
-  0x29, 0x34, 0x4c, 0xff, 	/*Color of index 179*/
-  0x20, 0x30, 0x52, 0xff, 	/*Color of index 180*/
-  0x2b, 0x33, 0x44, 0xff, 	/*Color of index 181*/
-  0x24, 0x31, 0x4c, 0xff, 	/*Color of index 182*/
-  0x1f, 0x2f, 0x4b, 0xff, 	/*Color of index 183*/
-  0x23, 0x30, 0x45, 0xff, 	/*Color of index 184*/
-  0x2a, 0x30, 0x3d, 0xff, 	/*Color of index 185*/
-  0x21, 0x2d, 0x49, 0xff, 	/*Color of index 186*/
-  0x1c, 0x2b, 0x4a, 0xff, 	/*Color of index 187*/
-  0x21, 0x2c, 0x44, 0xff, 	/*Color of index 188*/
-  0x26, 0x2d, 0x3a, 0xff, 	/*Color of index 189*/
-  0x1d, 0x2a, 0x44, 0xff, 	/*Color of index 190*/
-  0x18, 0x28, 0x49, 0xff, 	/*Color of index 191*/
-  0x22, 0x2a, 0x3a, 0xff, 	/*Color of index 192*/
-  0x28, 0x2b, 0x2f, 0xff, 	/*Color of index 193*/
-  0x1a, 0x26, 0x42, 0xff, 	/*Color of index 194*/
-  0x13, 0x25, 0x43, 0xff, 	/*Color of index 195*/
-  0x1c, 0x26, 0x3b, 0xff, 	/*Color of index 196*/
-  0x21, 0x27, 0x33, 0xff, 	/*Color of index 197*/
-  0x10, 0x22, 0x41, 0xff, 	/*Color of index 198*/
-  0x13, 0x20, 0x3c, 0xff, 	/*Color of index 199*/
-  0x1b, 0x20, 0x2a, 0xff, 	/*Color of index 200*/
-  0x12, 0x1b, 0x2c, 0xff, 	/*Color of index 201*/
-  0x14, 0x17, 0x1c, 0xff, 	/*Color of index 202*/
-  0x0c, 0x13, 0x22, 0xff, 	/*Color of index 203*/
-  0x04, 0x0a, 0x16, 0xff, 	/*Color of index 204*/
-  0x06, 0x08, 0x0b, 0xff, 	/*Color of index 205*/
-  0x96, 0x9b, 0x98, 0xff, 	/*Color of index 206*/
-  0x84, 0x86, 0x85, 0xff, 	/*Color of index 207*/
-  0xfd, 0xfe, 0xfc, 0xff, 	/*Color of index 208*/
-  0xb1, 0xb4, 0xab, 0xff, 	/*Color of index 209*/
-  0x91, 0x9b, 0x84, 0xff, 	/*Color of index 210*/
-  0x32, 0x3f, 0x30, 0xff, 	/*Color of index 211*/
-  0x16, 0x18, 0x15, 0xff, 	/*Color of index 212*/
-  0x0d, 0x10, 0x0b, 0xff, 	/*Color of index 213*/
-  0xf8, 0xf6, 0xe5, 0xff, 	/*Color of index 214*/
-  0xe0, 0xdf, 0xd6, 0xff, 	/*Color of index 215*/
-  0xe1, 0xdd, 0xbd, 0xff, 	/*Color of index 216*/
-  0xd1, 0xd1, 0xcf, 0xff, 	/*Color of index 217*/
-  0xc0, 0xc1, 0xbd, 0xff, 	/*Color of index 218*/
-  0xc9, 0xc6, 0xa6, 0xff, 	/*Color of index 219*/
-  0xb7, 0xb5, 0x8a, 0xff, 	/*Color of index 220*/
-  0x9d, 0x9f, 0x70, 0xff, 	/*Color of index 221*/
-  0x93, 0x9a, 0x4b, 0xff, 	/*Color of index 222*/
-  0x95, 0x8f, 0x69, 0xff, 	/*Color of index 223*/
-  0x89, 0x8c, 0x76, 0xff, 	/*Color of index 224*/
-  0x8b, 0x83, 0x56, 0xff, 	/*Color of index 225*/
-  0x7e, 0x88, 0x33, 0xff, 	/*Color of index 226*/
-  0x83, 0x7b, 0x48, 0xff, 	/*Color of index 227*/
-  0x75, 0x71, 0x53, 0xff, 	/*Color of index 228*/
-  0x7b, 0x6c, 0x3d, 0xff, 	/*Color of index 229*/
-  0x64, 0x62, 0x31, 0xff, 	/*Color of index 230*/
-  0x59, 0x50, 0x2c, 0xff, 	/*Color of index 231*/
-  0x41, 0x3a, 0x26, 0xff, 	/*Color of index 232*/
-  0x3b, 0x39, 0x18, 0xff, 	/*Color of index 233*/
-  0x2a, 0x28, 0x0d, 0xff, 	/*Color of index 234*/
-  0x14, 0x12, 0x0d, 0xff, 	/*Color of index 235*/
-  0x0c, 0x0a, 0x03, 0xff, 	/*Color of index 236*/
-  0xf8, 0xf7, 0xf5, 0xff, 	/*Color of index 237*/
-  0x7e, 0x7b, 0x78, 0xff, 	/*Color of index 238*/
-  0x19, 0x16, 0x13, 0xff, 	/*Color of index 239*/
-  0x1e, 0x16, 0x0c, 0xff, 	/*Color of index 240*/
-  0x1c, 0x14, 0x11, 0xff, 	/*Color of index 241*/
-  0x19, 0x14, 0x0f, 0xff, 	/*Color of index 242*/
-  0x18, 0x13, 0x12, 0xff, 	/*Color of index 243*/
-  0x18, 0x0f, 0x02, 0xff, 	/*Color of index 244*/
-  0x0f, 0x0c, 0x0b, 0xff, 	/*Color of index 245*/
-  0xef, 0xec, 0xed, 0xff, 	/*Color of index 246*/
-  0x16, 0x11, 0x11, 0xff, 	/*Color of index 247*/
-  0x18, 0x16, 0x18, 0xff, 	/*Color of index 248*/
-  0x17, 0x0f, 0x13, 0xff, 	/*Color of index 249*/
-  0x01, 0x00, 0x01, 0xff, 	/*Color of index 250*/
-  0x9f, 0x91, 0xbe, 0xff, 	/*Color of index 251*/
-  0x9b, 0x89, 0xb9, 0xff, 	/*Color of index 252*/
-  0x99, 0x83, 0xb5, 0xff, 	/*Color of index 253*/
-  0x94, 0x7e, 0xb1, 0xff, 	/*Color of index 254*/
-  0x10, 0x0d, 0x11, 0xff, 	/*Color of index 255*/
-
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0x5b, 0x5b, 0xf3, 0xf0, 0xf0, 0xf3, 0x5c, 0x5c, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0x5b, 0x5b, 0xef, 0xf0, 0xf2, 0xf3, 0x5c, 0x60, 0xf9, 0xf8, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf7, 0xf2, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0x5b, 0xf7, 0xef, 0xeb, 0xf0, 0x61, 0xc9, 0x55, 0xf9, 0xf3, 0xef, 0xf3, 0xf7, 0xf3, 0xef, 0xf8, 0xf8, 0xf3, 0xf1, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf1, 0xf7, 0xef, 0xf3, 0xeb, 0xef, 0xff, 0x42, 0xa7, 0x58, 0xf9, 0xf3, 0xf2, 0xef, 0xf1, 0xf7, 0xf9, 0x5b, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0xf1, 0xf3, 0x5b, 0xef, 0xf2, 0xf7, 0x5c, 0xa7, 0xa4, 0xb9, 0x5c, 0xf9, 0xf2, 0xef, 0xf7, 0xf3, 0x5a, 0x55, 0xca, 0x5b, 0xf3, 0xf3, 0xf3, 0xf1, 0xf1, 0xef, 0xf3, 0xf3, 0xef, 0xf1, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf1, 0x5b, 0xf7, 0xd4, 0xf3, 0xeb, 0x5a, 0xaa, 0xa6, 0xa8, 0xc9, 0x61, 0xf7, 0xef, 0xf3, 0x60, 0xc0, 0xaa, 0xb9, 0x5f, 0x5b, 0xf7, 0xf3, 0xeb, 0xf3, 0xf3, 0xf9, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf9, 0xf9, 0x5c, 0xf7, 0xf3, 0xf3, 0x5c, 0xaa, 0xa7, 0xa6, 0x46, 0x60, 0xf3, 0xf3, 0xf9, 0xcb, 0xaa, 0xa6, 0xb1, 0x5c, 0x5b, 0xf3, 0xf1, 0xf1, 0xf2, 0xf8, 0xf7, 0xf7, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0x5b, 0xf9, 0x5c, 0x5b, 0x5b, 0xf2, 0xf8, 0xff, 0xb3, 0xa5, 0x40, 0xa7, 0x55, 0x5f, 0xf3, 0x5c, 0x57, 0xa5, 0xa9, 0x41, 0xcb, 0x5b, 0xf1, 0xf7, 0xf0, 0xf1, 0xef, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf1, 0xef, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0x5b, 0x58, 0xc5, 0x58, 0xff, 0xf5, 0xef, 0xf9, 0x55, 0xa7, 0x3f, 0xa6, 0xaa, 0x5a, 0xf9, 0x5c, 0x42, 0xa6, 0x3f, 0xa7, 0xcb, 0x5c, 0xf3, 0xef, 0xf0, 0xec, 0xf5, 0xf7, 0xff, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xf3, 0xf2, 0xf3, 0xf3, 0xef, 0xf7, 0xf7, 0xf7, 0xff, 0x54, 0xa4, 0x9e, 0xb1, 0x58, 0x5c, 0x60, 0xcb, 0x43, 0x3d, 0x41, 0xa5, 0xc0, 0x60, 0x5d, 0xa7, 0x3f, 0xa6, 0xa5, 0x5a, 0x5c, 0xf8, 0x5f, 0xf9, 0xc1, 0xa4, 0xa8, 0xef, 0xf9, 0xf3, 0xf7, 0xef, 0xf9, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf8, 0xf8, 0x5b, 0xf8, 0xf7, 0x5b, 0xb5, 0x36, 0x9c, 0x41, 0x56, 0x5e, 0x59, 0x3d, 0xa6, 0xa7, 0xa9, 0x57, 0x5e, 0xa5, 0xa6, 0xa6, 0xa7, 0xc9, 0x5a, 0x62, 0x57, 0xa5, 0x32, 0x9b, 0xc8, 0xff, 0xf7, 0xf1, 0xf9, 0xf7, 0xf7, 0x5b, 0xf9, 0x5b, 0xf9, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xeb, 0xf2, 0xeb, 0xca, 0x5b, 0x5c, 0xcb, 0xb8, 0x36, 0xa1, 0x42, 0x56, 0x4b, 0x3d, 0xa6, 0xa2, 0xae, 0x5e, 0xa5, 0x3d, 0xa6, 0x9f, 0x56, 0x63, 0xaf, 0xa1, 0x36, 0xa1, 0xc7, 0x5c, 0x5b, 0xf3, 0xef, 0xef, 0xef, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf9, 0xf3, 0xf9, 0xf3, 0xf3, 0xf3, 0xef, 0xef, 0xd5, 0x5f, 0x61, 0xcc, 0xcc, 0x5d, 0x5d, 0x56, 0x42, 0x9f, 0xa1, 0x3f, 0xa3, 0xa2, 0xa2, 0xa2, 0xac, 0xa3, 0x3d, 0x3d, 0x3d, 0xb4, 0x43, 0x9d, 0xa2, 0xa2, 0x52, 0x63, 0x5d, 0xcc, 0x5f, 0x5f, 0xff, 0xeb, 0xf2, 0xf2, 0xf0, 0xf0, 0xf0, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf0, 0xf2, 0xf0, 0xf0, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0x5b, 0x5f, 0xcc, 0x5c, 0x5a, 0x55, 0xb8, 0xa7, 0xa5, 0x9f, 0x9f, 0xa2, 0x9f, 0xa5, 0xa0, 0x3a, 0xa0, 0xa0, 0xa3, 0x9f, 0x3a, 0xa3, 0xa3, 0xa3, 0x3b, 0xa3, 0x3a, 0xa6, 0xa3, 0x3d, 0x3d, 0xa2, 0xa9, 0xaf, 0x55, 0x59, 0x5c, 0x5c, 0x5b, 0xeb, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0x5b, 0xf3, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf3, 0xf1, 0xeb, 0xf0, 0xf7, 0x5f, 0x61, 0x5d, 0xc0, 0x41, 0xa1, 0x9f, 0x9d, 0x9f, 0x9f, 0xa2, 0xa3, 0xa0, 0xa0, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa3, 0xa0, 0x3b, 0x3b, 0xa3, 0xa0, 0xa3, 0xa3, 0x3b, 0xa3, 0x9f, 0x9f, 0xa1, 0xa2, 0x42, 0xc7, 0x60, 0xcc, 0x61, 0xf9, 0xf7, 0xf9, 0xf1, 0xf3, 0xf1, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0xf3, 0xf3, 0xf2, 0xf0, 0xd4, 0xf3, 0x5b, 0x5b, 0x5c, 0xeb, 0x5f, 0x58, 0xb9, 0xa4, 0x36, 0x35, 0x3a, 0x3b, 0xa3, 0x3b, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x3b, 0xa3, 0x3a, 0xa0, 0xa0, 0xa2, 0xa0, 0xa2, 0xa0, 0xa2, 0xa0, 0xa0, 0x3b, 0xa3, 0xa0, 0xa3, 0xa3, 0x3b, 0x3d, 0xa3, 0xa1, 0xa0, 0x3d, 0xa3, 0xa0, 0x9f, 0x3c, 0x42, 0xc7, 0x5d, 0x60, 0x61, 0x60, 0xf9, 0x5b, 0xf3, 0xf7, 0xef, 0xef, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xef, 0xf8, 0x5f, 0xcc, 0xcb, 0xc8, 0xaa, 0xa1, 0x9d, 0x9f, 0xa2, 0xa3, 0x3b, 0x3b, 0x3b, 0x3b, 0xa3, 0xa0, 0x3c, 0xa3, 0x3d, 0xa6, 0x3f, 0x40, 0x40, 0x43, 0x43, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x43, 0x40, 0xa9, 0xa6, 0x3d, 0x3d, 0x3b, 0xa3, 0xa1, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0x3c, 0xa0, 0x3c, 0xa9, 0x50, 0xcb, 0x60, 0xcc, 0x5c, 0x5b, 0x5f, 0xef, 0xef, 0xef, 0xf2, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf2, 0xef, 0xd5, 0xcc, 0xcb, 0x4c, 0xa5, 0x3a, 0x3a, 0xa3, 0xa3, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0x3d, 0x3d, 0xa9, 0x40, 0xac, 0x47, 0xb4, 0xb0, 0xb4, 0xb0, 0xb2, 0xb2, 0xb0, 0xae, 0xb0, 0xae, 0xb2, 0xae, 0xb2, 0xb7, 0xb4, 0xb6, 0xb6, 0xb4, 0x4b, 0x49, 0x40, 0xa9, 0xa6, 0x3d, 0xa3, 0xa0, 0xa3, 0xa3, 0xa3, 0xa0, 0xa0, 0xa0, 0xa1, 0xab, 0x55, 0xcb, 0x62, 0x5b, 0xf3, 0xef, 0xf0, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xeb, 0x5f, 0xca, 0xb5, 0xa1, 0xa1, 0x3c, 0x3b, 0x3e, 0x3b, 0x3b, 0x3a, 0xa3, 0x3d, 0xa9, 0x43, 0xb0, 0xb4, 0xb4, 0xb2, 0xaf, 0xb3, 0xaf, 0xae, 0xae, 0xac, 0x47, 0xac, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xae, 0x47, 0xae, 0xaf, 0xad, 0xb6, 0xb2, 0x4b, 0x4b, 0xb4, 0xb4, 0xb2, 0xb0, 0x43, 0x40, 0x3d, 0xa0, 0xa3, 0xa2, 0xa3, 0xa3, 0xa2, 0xa1, 0xa1, 0xa9, 0xc5, 0xcb, 0xf5, 0x5f, 0xeb, 0xef, 0xf7, 0xef, 0xf2, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf2, 0xf2, 0xf9, 0xf3, 0xf9, 0xf7, 0xf7, 0xef, 0xf0, 0xeb, 0xf8, 0xcc, 0xcc, 0xb7, 0xa2, 0xa0, 0xa3, 0xa3, 0x3c, 0xa0, 0x9d, 0x3c, 0xa6, 0x43, 0xb4, 0xb2, 0xb4, 0xb4, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xb2, 0xb0, 0xb4, 0xb4, 0xb4, 0xb0, 0x41, 0xa6, 0xa2, 0x9f, 0xa2, 0xa2, 0xa3, 0xa2, 0xa0, 0xa9, 0xc3, 0x5c, 0x61, 0xf8, 0xeb, 0xeb, 0xef, 0xf0, 0xf2, 0xf2, 0x5b, 0xf7, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf1, 0xf7, 0xd5, 0xf2, 0xf8, 0x62, 0x55, 0xa1, 0x9f, 0x3d, 0xa3, 0xa3, 0xa0, 0xa2, 0xa5, 0x40, 0x47, 0xb4, 0xb4, 0xb2, 0xb0, 0xb2, 0x48, 0xb2, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb4, 0xb2, 0xb2, 0xb4, 0xb2, 0x4d, 0xba, 0x48, 0xa9, 0xa2, 0xa0, 0xa0, 0xa3, 0xa3, 0x9f, 0x9f, 0xaa, 0x55, 0xcc, 0x5f, 0xf8, 0xeb, 0xf2, 0xf2, 0xf1, 0xf2, 0x5b, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf7, 0xf1, 0xf2, 0xf9, 0xf3, 0xca, 0xcc, 0x5c, 0x46, 0x9f, 0xa5, 0xa2, 0xa0, 0xa0, 0xa2, 0xa6, 0x48, 0xb4, 0xb4, 0xb4, 0xae, 0x48, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb4, 0xb0, 0xb4, 0xb2, 0xb4, 0xb2, 0xb0, 0xb2, 0x4e, 0xb7, 0xa9, 0xa5, 0xa0, 0xa0, 0x3c, 0x3d, 0x9f, 0xa1, 0xad, 0xcb, 0x62, 0xca, 0xf7, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xf7, 0xf2, 0xf2, 0xeb, 0xd4, 0x5c, 0x62, 0x53, 0xa5, 0xa1, 0xa5, 0x9f, 0xa3, 0x3d, 0x40, 0xb4, 0xb7, 0xac, 0xae, 0x48, 0xae, 0x48, 0xae, 0xb0, 0xb2, 0x48, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xb4, 0x48, 0xb4, 0x4d, 0xb4, 0xb2, 0xac, 0xb7, 0xb4, 0x48, 0xa6, 0x3b, 0x9d, 0x3c, 0x3c, 0x9f, 0xa1, 0xbc, 0x62, 0x5d, 0x5b, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf9, 0xf3, 0xf3, 0xf2, 0xd4, 0x61, 0x5c, 0x47, 0xa5, 0x3c, 0xa0, 0xa0, 0x3d, 0x43, 0xb0, 0xac, 0xac, 0xaf, 0xae, 0xac, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xae, 0xb2, 0xb0, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xb6, 0xb6, 0xaf, 0xb2, 0xb0, 0x4b, 0x45, 0x3e, 0xa3, 0x3b, 0x9f, 0xa2, 0xa2, 0xab, 0x5d, 0x5c, 0x5f, 0xf1, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf8, 0xf9, 0x5b, 0xd5, 0x61, 0x54, 0xa1, 0xa1, 0x3d, 0x3c, 0x3d, 0x40, 0xb4, 0xb0, 0xb0, 0xae, 0xac, 0xad, 0xac, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0x48, 0xad, 0xaf, 0xae, 0xb2, 0x48, 0xb0, 0x4e, 0x49, 0x3f, 0xa3, 0x35, 0x9f, 0x9d, 0xa5, 0x55, 0xcc, 0x5b, 0x5b, 0xf1, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf7, 0x5f, 0xcc, 0xb1, 0xa1, 0xa5, 0xa5, 0xa2, 0x40, 0xb0, 0x4e, 0xac, 0xb0, 0xae, 0xae, 0xac, 0xaf, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0x48, 0x48, 0xb4, 0x4b, 0xb4, 0x48, 0x3f, 0xa0, 0xa0, 0x9d, 0x9f, 0xba, 0x5c, 0x60, 0x5f, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0x5f, 0x5a, 0x42, 0xa1, 0xa2, 0x9f, 0xa9, 0xb0, 0xb6, 0xae, 0xab, 0xac, 0xaf, 0xae, 0xad, 0xac, 0xb3, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xb3, 0xb2, 0xae, 0xae, 0xae, 0xb0, 0x4b, 0x40, 0x3d, 0x3a, 0x9f, 0x36, 0xab, 0xcb, 0x5c, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xeb, 0xeb, 0xd4, 0xa8, 0xa1, 0x3c, 0xa6, 0x43, 0xb4, 0xaf, 0xab, 0xab, 0xaf, 0xaf, 0xab, 0xad, 0xae, 0xae, 0xac, 0xae, 0xb2, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xaf, 0xae, 0xb0, 0xb0, 0xae, 0xb3, 0xae, 0xb3, 0xad, 0xaf, 0xb3, 0xb2, 0x4b, 0x4b, 0xb0, 0xa6, 0x3a, 0xa2, 0x9d, 0xa5, 0xcb, 0x5f, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf2, 0xf2, 0xef, 0xf3, 0x5b, 0xf3, 0x5b, 0xeb, 0x5f, 0x5a, 0xa8, 0xa1, 0xa5, 0xa9, 0x48, 0xb0, 0xb2, 0xac, 0xaf, 0xaf, 0xac, 0xaf, 0xaf, 0xae, 0x47, 0xae, 0x47, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb0, 0xae, 0xae, 0xae, 0xb3, 0xae, 0xaf, 0xae, 0x47, 0xb4, 0x48, 0xb0, 0x4e, 0x43, 0xa0, 0x9f, 0x9f, 0xa1, 0x55, 0x62, 0x5b, 0xd5, 0xd4, 0xf2, 0xf2, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf0, 0xf2, 0xf3, 0xf9, 0x5b, 0xff, 0xf7, 0x5f, 0x58, 0xa7, 0xa5, 0xa5, 0xa7, 0xb6, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb3, 0x47, 0xb3, 0xb2, 0xb0, 0x48, 0x4d, 0xa6, 0x3a, 0xa0, 0x9f, 0xc7, 0xcc, 0xf8, 0xf2, 0xf0, 0xf2, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf9, 0x5b, 0x5c, 0x5b, 0xa8, 0xa1, 0xa5, 0xab, 0xb2, 0xb2, 0xac, 0xae, 0x47, 0xae, 0x47, 0xae, 0xac, 0x47, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xaf, 0xae, 0xb2, 0xb2, 0xb2, 0xb0, 0xb0, 0x40, 0x9f, 0x9d, 0x9f, 0xc8, 0x62, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xd4, 0xff, 0xcb, 0xa7, 0xa5, 0xa7, 0xac, 0xae, 0xac, 0xb2, 0xae, 0xac, 0xae, 0xac, 0xac, 0xac, 0xae, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xb3, 0xae, 0xb2, 0x48, 0xb0, 0xb4, 0x4b, 0x43, 0x3d, 0x9d, 0x9f, 0xc4, 0x61, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf9, 0xf1, 0xf0, 0xf2, 0xd5, 0x5c, 0xaa, 0xa5, 0xa9, 0x43, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0x47, 0xae, 0x47, 0xae, 0x47, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xb2, 0xb4, 0xb0, 0xb4, 0xb0, 0xa5, 0x9d, 0xa4, 0x57, 0xcc, 0x5b, 0xf9, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf8, 0xf1, 0xf7, 0xd4, 0xeb, 0x5f, 0x46, 0xa1, 0xa9, 0x49, 0xb2, 0xac, 0xb2, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x47, 0xb2, 0xb2, 0xae, 0xae, 0xb0, 0xae, 0xb0, 0xae, 0xb0, 0xb0, 0xb0, 0xa6, 0x9d, 0xa1, 0xc9, 0x62, 0x5b, 0xf9, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf9, 0xf8, 0x5f, 0x5f, 0xb1, 0xa4, 0x41, 0x43, 0x4b, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb0, 0xb0, 0xb0, 0xae, 0xa6, 0x9d, 0xa7, 0x5c, 0x62, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf8, 0x61, 0xc0, 0xa7, 0x41, 0xb4, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x47, 0xb2, 0x47, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xaf, 0xaf, 0xb2, 0xb7, 0xb2, 0xa7, 0x9d, 0xad, 0x5b, 0x5c, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0x61, 0xc9, 0x41, 0xa9, 0x48, 0xae, 0xac, 0xaf, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xaf, 0xad, 0xb3, 0xae, 0xb0, 0xb4, 0xa7, 0xa1, 0xb1, 0x61, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf3, 0xf7, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xeb, 0x5b, 0x42, 0xa7, 0x49, 0xb4, 0xb4, 0xb3, 0xad, 0xae, 0xb2, 0xac, 0xae, 0xae, 0xb2, 0xae, 0x47, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xac, 0xac, 0xae, 0x47, 0xae, 0xac, 0xae, 0xae, 0xae, 0x47, 0xae, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xae, 0xae, 0xb2, 0x47, 0xb2, 0xae, 0xae, 0xaf, 0xac, 0xaf, 0xaf, 0xad, 0xad, 0xae, 0xae, 0xb4, 0xb4, 0xa4, 0xa4, 0x57, 0x5f, 0x5f, 0xf7, 0xf3, 0xf7, 0xf2, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf7, 0xf3, 0xf3, 0xf7, 0xf7, 0xeb, 0xef, 0xf2, 0xf2, 0xeb, 0xf2, 0xf3, 0xf7, 0xf3, 0xef, 0xf2, 0xf3, 0xef, 0x5b, 0x5b, 0x5c, 0x60, 0xc0, 0xa7, 0xab, 0xb2, 0xb2, 0xb2, 0xaf, 0xb2, 0xaf, 0xaf, 0xae, 0xaf, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xab, 0xab, 0xaf, 0xb4, 0xb2, 0xb6, 0xae, 0xae, 0xae, 0xae, 0xae, 0x47, 0xac, 0xae, 0xab, 0xac, 0xaf, 0xaf, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xac, 0xaf, 0xaf, 0xaf, 0xaf, 0xae, 0x47, 0xae, 0x47, 0x47, 0xb2, 0xae, 0xac, 0xb6, 0xb6, 0xaf, 0xb7, 0xaf, 0xac, 0xaf, 0xb2, 0x47, 0xb6, 0xb2, 0xb2, 0xb3, 0xae, 0xb3, 0xaf, 0xb2, 0xb3, 0xb2, 0xb2, 0xb2, 0xb2, 0xb7, 0xae, 0xa5, 0xa9, 0x59, 0xcc, 0xcb, 0xf7, 0xf0, 0xf0, 0xf0, 0xeb, 0xf7, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0x5c, 0x5f, 0x5b, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf0, 0xf0, 0xf2, 0xf0, 0xf7, 0xf3, 0xf7, 0xf7, 0xeb, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0x5b, 0xef, 0xf2, 0xf2, 0xef, 0xf3, 0xf7, 0xf3, 0x5c, 0x5a, 0x42, 0x42, 0xb6, 0xae, 0xae, 0xb2, 0xb2, 0xb3, 0xaf, 0xae, 0xaf, 0xb2, 0xab, 0xae, 0xab, 0xb4, 0xba, 0xc3, 0xc6, 0xc3, 0xc3, 0xbb, 0xbb, 0xc6, 0xc6, 0xc6, 0xc3, 0xbb, 0xae, 0xae, 0xae, 0xab, 0xae, 0xaf, 0xae, 0xaf, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xaf, 0xae, 0xaf, 0xb2, 0xae, 0xb6, 0xae, 0xbb, 0xb7, 0xc7, 0xc3, 0xbf, 0xc3, 0xbe, 0xc3, 0xc7, 0xc7, 0xc6, 0xbe, 0xb4, 0xac, 0xb2, 0xb2, 0xb2, 0xaf, 0xb2, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xb6, 0xae, 0xb6, 0xae, 0xa5, 0xb5, 0x5c, 0xf7, 0xf3, 0xf0, 0xf0, 0xf0, 0xf1, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf8, 0xf3, 0xf9, 0xf8, 0xf9, 0xeb, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xeb, 0xf7, 0xf7, 0x5b, 0xef, 0x5b, 0xf7, 0xff, 0xff, 0xff, 0x60, 0xff, 0x60, 0x61, 0x61, 0xf5, 0x5f, 0xf1, 0xeb, 0xef, 0xf1, 0xf3, 0xff, 0xb5, 0xaa, 0xb8, 0xaf, 0xb6, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xb7, 0xab, 0xb2, 0xb2, 0xb7, 0xc6, 0xb4, 0xa2, 0x96, 0x8e, 0x86, 0x7e, 0x81, 0x80, 0x81, 0x86, 0x8e, 0x96, 0x9f, 0xbf, 0xc3, 0xb4, 0xb2, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xb3, 0xae, 0xb2, 0xae, 0xae, 0xbb, 0xbb, 0x40, 0x9c, 0x91, 0x88, 0x81, 0x7a, 0x7e, 0x7e, 0x83, 0x8b, 0x94, 0x9d, 0xac, 0xc6, 0xbb, 0xac, 0xb2, 0xb2, 0xaf, 0xb2, 0xb3, 0xb2, 0xb2, 0xae, 0xb2, 0xb2, 0xb6, 0xb2, 0xb7, 0xac, 0xa4, 0x54, 0x5f, 0xf3, 0xf3, 0xf7, 0xf7, 0xff, 0x61, 0x61, 0x61, 0x61, 0x5c, 0xff, 0x5f, 0x61, 0x61, 0xf9, 0x5b, 0xf9, 0xf1, 0xf1, 0xf1, 0xeb, 0xf1, 0xf3, 0x5b, 0x5c, 0x5b, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf3, 0xf7, 0x5b, 0x5c, 0x61, 0xcc, 0x5c, 0x57, 0xc0, 0xb9, 0xb3, 0x46, 0xb3, 0xb5, 0x4f, 0xc0, 0x57, 0xcb, 0xff, 0x5c, 0x5f, 0xf9, 0xf9, 0x57, 0xad, 0xaf, 0xb8, 0xac, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb3, 0xb2, 0xb2, 0xbe, 0xbb, 0xa9, 0x93, 0x83, 0x71, 0x6a, 0x6a, 0x6c, 0x72, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x72, 0x73, 0x86, 0x96, 0x43, 0xc3, 0xb7, 0xb2, 0xae, 0xb2, 0xac, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xb7, 0xbf, 0x9d, 0x8e, 0x7e, 0x6a, 0x6a, 0x69, 0x6d, 0x72, 0x6a, 0x6a, 0x6c, 0x6a, 0x6a, 0x6d, 0x7e, 0x8e, 0x9f, 0xc6, 0xbb, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb7, 0xae, 0xb6, 0xb4, 0xaa, 0x42, 0x5a, 0x60, 0x5f, 0x61, 0x60, 0xcb, 0xc9, 0xc4, 0xb8, 0xb5, 0xad, 0xb5, 0xb8, 0x4f, 0xc5, 0x59, 0x5d, 0x5f, 0xf9, 0xf9, 0xf9, 0xf3, 0xf3, 0x5b, 0x5b, 0x5b, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf7, 0x5b, 0x5b, 0x5c, 0x62, 0x5a, 0xb9, 0xa9, 0xa4, 0x9f, 0xa1, 0x9f, 0xa5, 0x9f, 0x3c, 0x3c, 0xa2, 0xa1, 0xa1, 0xa5, 0xaa, 0x4f, 0x55, 0x5d, 0xcb, 0xb5, 0xb3, 0xb6, 0xaf, 0xb6, 0xae, 0xb6, 0xb6, 0xb2, 0xb2, 0xb2, 0xb4, 0xc2, 0xa5, 0x8b, 0x73, 0x66, 0x6f, 0x73, 0x6f, 0x70, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x72, 0x6f, 0x72, 0x68, 0x7c, 0x93, 0x41, 0xc3, 0xb2, 0xae, 0xac, 0xae, 0xae, 0x43, 0xb2, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xb2, 0x47, 0xbb, 0xbb, 0x9f, 0x88, 0x69, 0x68, 0x6f, 0x73, 0x72, 0x72, 0x74, 0x73, 0x74, 0x73, 0x72, 0x72, 0x74, 0x6f, 0x73, 0x69, 0x68, 0x83, 0x9a, 0xbb, 0xbb, 0xb2, 0xb2, 0xac, 0xb6, 0xae, 0xae, 0xae, 0xac, 0xb2, 0xb7, 0xb6, 0xb7, 0xa7, 0xbe, 0xcb, 0xc2, 0xab, 0xa7, 0x9d, 0x9d, 0x9d, 0x9f, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9f, 0xa5, 0x41, 0xc0, 0x59, 0x60, 0xcc, 0x5b, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf1, 0xca, 0x5f, 0x60, 0xcc, 0x55, 0x46, 0xa1, 0xa1, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x3d, 0x3d, 0x3d, 0xa5, 0xa2, 0xa5, 0xa5, 0x41, 0xba, 0xb2, 0xaf, 0xb6, 0xb6, 0xb3, 0x4c, 0xab, 0xb2, 0xb2, 0xb4, 0xbb, 0xb4, 0x91, 0x73, 0x6c, 0x6d, 0x76, 0x72, 0x72, 0x76, 0x77, 0x74, 0x77, 0x74, 0x77, 0x74, 0x77, 0x77, 0x76, 0x76, 0x73, 0x76, 0x71, 0x69, 0x7c, 0x9a, 0xb7, 0xbb, 0xb2, 0xac, 0xb2, 0xb6, 0x43, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xae, 0xac, 0xb2, 0xac, 0xae, 0xb2, 0xac, 0xbf, 0xb4, 0x91, 0x6e, 0x6a, 0x72, 0x73, 0x73, 0x72, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x73, 0x76, 0x76, 0x73, 0x6c, 0x71, 0x83, 0xa2, 0xc3, 0xae, 0xae, 0xac, 0xac, 0xb6, 0xae, 0xb2, 0xb2, 0xb6, 0xb2, 0xb4, 0xb4, 0x40, 0xa9, 0x35, 0x9f, 0x3a, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0xa2, 0x47, 0x55, 0xcc, 0x5b, 0xf1, 0xeb, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf9, 0x5f, 0x60, 0x59, 0x41, 0x9f, 0x9f, 0xa1, 0xa1, 0xa0, 0xa2, 0xa0, 0xa3, 0xa0, 0x3d, 0xa3, 0xa3, 0xa3, 0xa0, 0xa0, 0xa2, 0xa3, 0x3d, 0x3d, 0xa5, 0xa5, 0xb2, 0xb7, 0xb4, 0xb6, 0xb2, 0x4c, 0xab, 0xba, 0xae, 0xb7, 0xc3, 0xa2, 0x81, 0x6a, 0x6a, 0x73, 0x73, 0x72, 0x72, 0x72, 0x74, 0x74, 0x79, 0x74, 0x77, 0x74, 0x77, 0x74, 0x77, 0x74, 0x72, 0x76, 0x74, 0x73, 0x76, 0x6d, 0x68, 0x8b, 0xb4, 0xbb, 0xb6, 0x43, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xae, 0xac, 0xb2, 0xb2, 0xab, 0xc3, 0xa6, 0x86, 0x66, 0x6c, 0x73, 0x73, 0x72, 0x72, 0x76, 0x72, 0x74, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x72, 0x72, 0x76, 0x6f, 0x76, 0x73, 0x6c, 0x6a, 0x73, 0x93, 0xc3, 0xbb, 0x47, 0xb7, 0x41, 0xb6, 0xae, 0xb2, 0xb6, 0xb2, 0xb0, 0xbf, 0x45, 0xa6, 0xa0, 0xa0, 0xa0, 0x3a, 0xa0, 0x3a, 0xa0, 0xa0, 0xa3, 0xa3, 0xa0, 0xa0, 0x3a, 0x3a, 0x3a, 0x3a, 0xa3, 0xa0, 0x9f, 0x9f, 0xaa, 0x58, 0xf5, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf8, 0x5f, 0x5c, 0xc4, 0xa1, 0x9d, 0xa2, 0x9f, 0xa2, 0xa6, 0xa9, 0x40, 0xb0, 0xb4, 0xbb, 0x4e, 0xbb, 0x4e, 0xbb, 0xb4, 0xae, 0x40, 0x3d, 0xa2, 0x9f, 0xa2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb6, 0xb6, 0xb6, 0xaf, 0xb7, 0xc3, 0x96, 0x69, 0x6a, 0x76, 0x73, 0x73, 0x72, 0x74, 0x74, 0x72, 0x72, 0x77, 0x72, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76, 0x6c, 0x76, 0x69, 0x83, 0xa5, 0xb7, 0xb6, 0xae, 0xb2, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xbb, 0x9f, 0x7e, 0x68, 0x76, 0x6c, 0x73, 0x74, 0x74, 0x74, 0x74, 0x73, 0x72, 0x73, 0x74, 0x73, 0x74, 0x73, 0x72, 0x73, 0x74, 0x74, 0x74, 0x74, 0x76, 0x72, 0x73, 0x71, 0x68, 0x88, 0xa9, 0xbe, 0xac, 0xb2, 0xb2, 0xb2, 0xb2, 0xb6, 0xb2, 0xb7, 0xb0, 0xb4, 0xb7, 0xa0, 0xa2, 0xa2, 0x40, 0x43, 0xb0, 0x4e, 0x4e, 0xbf, 0xbf, 0xbf, 0xbf, 0xb7, 0xb0, 0x43, 0x40, 0xa6, 0xa2, 0xa2, 0x9f, 0x9f, 0x9f, 0xb8, 0xcb, 0x5f, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0x5c, 0xb1, 0x9d, 0x9d, 0x9f, 0xa3, 0x40, 0x4e, 0x4e, 0xbe, 0xbb, 0xbc, 0xba, 0xba, 0xbc, 0xba, 0xbc, 0xbc, 0xb8, 0xbe, 0xbe, 0x50, 0x4d, 0x40, 0xa9, 0xba, 0xb2, 0xb2, 0x4d, 0xb4, 0x4c, 0xb3, 0xb6, 0xbc, 0xc6, 0x94, 0x69, 0x71, 0x71, 0x76, 0x76, 0x76, 0x72, 0x72, 0x74, 0x74, 0x74, 0x73, 0x74, 0x73, 0x74, 0x73, 0x74, 0x73, 0x74, 0x74, 0x79, 0x74, 0x74, 0x76, 0x6f, 0x73, 0x71, 0x6f, 0x6a, 0x7e, 0x43, 0xc2, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xc3, 0xa5, 0x81, 0x69, 0x72, 0x73, 0x72, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x73, 0x73, 0x73, 0x72, 0x73, 0x73, 0x73, 0x73, 0x74, 0x79, 0x74, 0x74, 0x76, 0x73, 0x76, 0x76, 0x78, 0x69, 0x83, 0x42, 0xbf, 0xae, 0xb2, 0xb2, 0xb2, 0xb6, 0xb2, 0xb6, 0xae, 0x4c, 0xb4, 0xab, 0xb4, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xbb, 0xbc, 0xbb, 0xbb, 0xbe, 0x50, 0xbe, 0x50, 0xc2, 0xba, 0x4d, 0x40, 0x3d, 0xa0, 0x9f, 0x9f, 0xa9, 0xcb, 0xff, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0x5b, 0xf3, 0xf1, 0xeb, 0xf2, 0xef, 0x5b, 0x5f, 0x5d, 0xa5, 0x9d, 0x9d, 0xa7, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7, 0x4c, 0xba, 0x4c, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xbc, 0xba, 0xba, 0x50, 0xc2, 0xba, 0xb2, 0xb7, 0xb4, 0xb2, 0xb2, 0xb6, 0xbc, 0xbe, 0x8e, 0x68, 0x78, 0x74, 0x78, 0x74, 0x74, 0x77, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x74, 0x74, 0x76, 0x73, 0x76, 0x73, 0x74, 0x73, 0x74, 0x76, 0x74, 0x76, 0x72, 0x74, 0x72, 0x76, 0x69, 0x7e, 0xa6, 0xbb, 0xae, 0xaf, 0xab, 0xae, 0xab, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xac, 0xac, 0xac, 0xae, 0xac, 0xac, 0xbf, 0xa7, 0x7e, 0x69, 0x72, 0x76, 0x76, 0x72, 0x73, 0x72, 0x72, 0x72, 0x72, 0x73, 0x72, 0x72, 0x72, 0x73, 0x72, 0x72, 0x72, 0x72, 0x74, 0x73, 0x74, 0x73, 0x72, 0x73, 0x74, 0x76, 0x72, 0x73, 0x6a, 0x73, 0x9f, 0xc6, 0xac, 0xac, 0x4c, 0xb2, 0xba, 0x4c, 0xb6, 0xb6, 0xb2, 0xb6, 0xba, 0xc2, 0xbc, 0xbe, 0xb6, 0xbc, 0xba, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb8, 0xbc, 0xba, 0xbe, 0xbf, 0xbb, 0xb4, 0xa6, 0x9f, 0xa0, 0xa1, 0xc9, 0xcc, 0x5b, 0xf7, 0xef, 0xf2, 0xf3, 0xf9, 0x5b, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf8, 0x5c, 0x5b, 0xf3, 0xf0, 0xf0, 0xf2, 0xf3, 0x5f, 0xcb, 0xaa, 0x36, 0xa1, 0x41, 0xba, 0xb7, 0xb6, 0xb7, 0xb7, 0xb8, 0xb7, 0x4c, 0xba, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xbc, 0x4c, 0xbc, 0xba, 0xbe, 0xbf, 0xb6, 0xb2, 0xb6, 0xbb, 0xb2, 0xba, 0xb2, 0xc7, 0x94, 0x66, 0x78, 0x79, 0x79, 0x74, 0x79, 0x79, 0x79, 0x74, 0x74, 0x79, 0x74, 0x74, 0x74, 0x74, 0x72, 0x76, 0x74, 0x73, 0x73, 0x73, 0x73, 0x76, 0x76, 0x73, 0x76, 0x76, 0x72, 0x76, 0x72, 0x76, 0x6f, 0x6a, 0x86, 0xbf, 0xb6, 0xac, 0xb3, 0xb2, 0xab, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xab, 0xac, 0x47, 0xb2, 0xb7, 0x4e, 0x86, 0x69, 0x71, 0x74, 0x72, 0x72, 0x73, 0x74, 0x73, 0x73, 0x74, 0x73, 0x72, 0x74, 0x73, 0x72, 0x74, 0x72, 0x74, 0x73, 0x72, 0x73, 0x72, 0x73, 0x72, 0x73, 0x74, 0x76, 0x74, 0x76, 0x74, 0x78, 0x6a, 0x7e, 0xa2, 0xc3, 0x48, 0xb6, 0xba, 0x47, 0xb6, 0xb2, 0xb2, 0xb6, 0xb2, 0xb6, 0xbe, 0xba, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xbc, 0xbc, 0xb8, 0xbc, 0xb8, 0xbc, 0xba, 0xba, 0xb7, 0xba, 0xb7, 0xb7, 0xb0, 0xa2, 0x9d, 0xa5, 0xc9, 0xcc, 0xef, 0xef, 0xf2, 0xf3, 0x5b, 0xf9, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0xf3, 0xf3, 0xf1, 0xeb, 0xf1, 0x5c, 0x61, 0xa7, 0x9c, 0xa9, 0xb4, 0xbf, 0xb2, 0xb6, 0xb6, 0xb6, 0xb7, 0xb7, 0xb7, 0xb8, 0xba, 0xba, 0xba, 0xba, 0xbc, 0xba, 0xbc, 0xba, 0xb8, 0xbc, 0xba, 0xba, 0xbc, 0xbb, 0xb6, 0xb6, 0xb7, 0xae, 0xbb, 0xb2, 0xc9, 0x93, 0x69, 0x7c, 0x74, 0x79, 0x74, 0x79, 0x79, 0x74, 0x79, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76, 0x76, 0x73, 0x76, 0x73, 0x77, 0x72, 0x76, 0x74, 0x76, 0x74, 0x72, 0x74, 0x72, 0x74, 0x76, 0x69, 0x8b, 0xc6, 0xaf, 0xab, 0xac, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xac, 0xae, 0xae, 0xbb, 0x91, 0x68, 0x71, 0x73, 0x74, 0x73, 0x74, 0x72, 0x72, 0x72, 0x72, 0x73, 0x72, 0x73, 0x72, 0x72, 0x73, 0x72, 0x73, 0x72, 0x72, 0x74, 0x72, 0x73, 0x72, 0x74, 0x72, 0x76, 0x74, 0x73, 0x76, 0x72, 0x72, 0x76, 0x73, 0x6a, 0xa6, 0xbb, 0xb2, 0x47, 0xba, 0xb2, 0xb4, 0xb6, 0xb2, 0xb6, 0xb6, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb8, 0xbc, 0xb8, 0xbc, 0xb8, 0xbc, 0xb8, 0xbc, 0xba, 0xb8, 0xb7, 0xba, 0xb7, 0xbb, 0xb7, 0x43, 0x9d, 0xa4, 0xc9, 0x5f, 0xf3, 0xf1, 0xf3, 0xf7, 0x5b, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0x5f, 0x61, 0x42, 0x9d, 0xa9, 0x4c, 0xb4, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb7, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xbc, 0x4f, 0xba, 0xba, 0xbc, 0xbb, 0x4c, 0xb4, 0xb6, 0xb7, 0xb7, 0xb2, 0xc6, 0x9f, 0x69, 0x73, 0x73, 0x7d, 0x78, 0x79, 0x74, 0x74, 0x79, 0x77, 0x74, 0x74, 0x74, 0x74, 0x74, 0x79, 0x74, 0x74, 0x74, 0x76, 0x74, 0x76, 0x76, 0x73, 0x76, 0x74, 0x76, 0x72, 0x76, 0x72, 0x73, 0x72, 0x76, 0x72, 0x6f, 0x72, 0x69, 0x9a, 0xc2, 0xb6, 0xac, 0xb6, 0xab, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xbf, 0x9d, 0x69, 0x71, 0x71, 0x72, 0x74, 0x72, 0x72, 0x73, 0x74, 0x73, 0x72, 0x74, 0x72, 0x74, 0x72, 0x76, 0x72, 0x74, 0x73, 0x74, 0x73, 0x73, 0x72, 0x74, 0x72, 0x73, 0x72, 0x76, 0x73, 0x74, 0x73, 0x76, 0x76, 0x78, 0x76, 0x72, 0x81, 0xb4, 0xb6, 0xb7, 0xae, 0xb6, 0xb6, 0xb2, 0xb6, 0xb2, 0xb6, 0xba, 0xbc, 0xb8, 0xbc, 0xbc, 0xb8, 0xbc, 0xb8, 0xbc, 0xb8, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb8, 0xb7, 0xb8, 0xba, 0xb7, 0xbe, 0xbb, 0xba, 0xae, 0x9f, 0xaa, 0x5b, 0x5c, 0xf2, 0xf3, 0xf1, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xf1, 0xf0, 0xf3, 0xf3, 0xcc, 0xb9, 0x9d, 0x41, 0xba, 0xb2, 0xb7, 0xb2, 0xb7, 0x4c, 0xb6, 0x4c, 0xba, 0xb7, 0xb7, 0xb8, 0xb7, 0xb8, 0xbc, 0xbc, 0xb7, 0xb8, 0xba, 0x4f, 0xba, 0x4f, 0xba, 0xba, 0xba, 0xb6, 0xb6, 0xb6, 0xb4, 0xb7, 0xbf, 0x41, 0x81, 0x6a, 0x7b, 0x7c, 0x76, 0x77, 0x76, 0x74, 0x76, 0x76, 0x74, 0x72, 0x77, 0x74, 0x77, 0x70, 0x70, 0x6a, 0x6a, 0x6a, 0x6c, 0x74, 0x76, 0x73, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x74, 0x72, 0x73, 0x74, 0x6c, 0x76, 0x73, 0x6b, 0x7e, 0xa7, 0xbf, 0xab, 0xac, 0xb2, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xac, 0xb4, 0xb7, 0x7e, 0x6c, 0x71, 0x78, 0x71, 0x74, 0x73, 0x74, 0x72, 0x72, 0x72, 0x72, 0x73, 0x72, 0x73, 0x73, 0x72, 0x73, 0x76, 0x72, 0x6c, 0x6c, 0x70, 0x73, 0x74, 0x73, 0x74, 0x72, 0x76, 0x74, 0x73, 0x76, 0x74, 0x78, 0x73, 0x7c, 0x76, 0x6c, 0x86, 0xc7, 0xb2, 0x4c, 0xb2, 0xb7, 0xb2, 0xb6, 0xb6, 0xaf, 0x4c, 0xbe, 0xb8, 0xbc, 0xb8, 0xbc, 0x4f, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb8, 0xb8, 0xb8, 0xb6, 0xb8, 0xbc, 0xbc, 0xb6, 0xbb, 0xab, 0xa1, 0xbd, 0x61, 0x5b, 0xf1, 0xf1, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf0, 0xf3, 0xef, 0x5c, 0x5a, 0xa1, 0x41, 0xbb, 0xae, 0xb2, 0xb6, 0xb2, 0xb6, 0xb2, 0x4c, 0xb7, 0xb2, 0x4c, 0x4c, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbe, 0xba, 0xb8, 0xb8, 0x4c, 0xba, 0xbe, 0xbb, 0x4c, 0xb6, 0xb7, 0xba, 0xb7, 0xc7, 0x8b, 0x6a, 0x73, 0x7c, 0x76, 0x77, 0x77, 0x74, 0x76, 0x74, 0x76, 0x74, 0x76, 0x72, 0x72, 0x6f, 0x7d, 0x85, 0x8a, 0x20, 0x89, 0x82, 0x73, 0x6f, 0x76, 0x6f, 0x74, 0x74, 0x74, 0x74, 0x73, 0x72, 0x73, 0x72, 0x76, 0x72, 0x72, 0x72, 0x72, 0x69, 0x8b, 0xc6, 0xb6, 0xac, 0xb2, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xae, 0xbf, 0x96, 0x66, 0x73, 0x72, 0x72, 0x72, 0x73, 0x72, 0x72, 0x73, 0x74, 0x73, 0x72, 0x74, 0x73, 0x74, 0x74, 0x6c, 0x74, 0x6c, 0x73, 0x7e, 0x81, 0x80, 0x6d, 0x6c, 0x72, 0x72, 0x76, 0x74, 0x73, 0x74, 0x76, 0x73, 0x74, 0x74, 0x76, 0x78, 0x76, 0x68, 0x9a, 0xc3, 0xb2, 0xb2, 0xb2, 0xb6, 0xb6, 0xb6, 0xb2, 0xb6, 0xba, 0xbc, 0xb8, 0xbc, 0xb8, 0xbc, 0xbc, 0xb8, 0xba, 0xbc, 0x50, 0xbc, 0x4c, 0x4f, 0xbc, 0xbc, 0xb8, 0xb6, 0xb8, 0xb6, 0xb8, 0xbe, 0xb2, 0xbb, 0x41, 0xa7, 0x5a, 0x5c, 0xf8, 0xf2, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf2, 0xf0, 0xf2, 0xf2, 0x5b, 0x60, 0xaa, 0xa9, 0xba, 0xb0, 0xae, 0xb6, 0xaf, 0xb6, 0xb2, 0xb6, 0x4d, 0xb2, 0x4d, 0x53, 0x53, 0x53, 0x53, 0xc7, 0x53, 0xc7, 0x53, 0x50, 0x4c, 0x4c, 0x4c, 0xbe, 0xbe, 0xba, 0xba, 0xb7, 0x4c, 0xb7, 0xb7, 0xc6, 0x9f, 0x6a, 0x72, 0x7c, 0x78, 0x78, 0x77, 0x76, 0x77, 0x74, 0x77, 0x74, 0x79, 0x79, 0x79, 0x6c, 0x8a, 0x96, 0x93, 0x8e, 0x8a, 0x8e, 0x93, 0x8e, 0x80, 0x6c, 0x79, 0x76, 0x73, 0x72, 0x73, 0x72, 0x74, 0x72, 0x73, 0x74, 0x72, 0x72, 0x72, 0x72, 0x72, 0x66, 0x43, 0xbb, 0xaf, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0x47, 0xb0, 0xb4, 0xa9, 0x7a, 0x6c, 0x72, 0x71, 0x71, 0x72, 0x74, 0x73, 0x74, 0x72, 0x72, 0x72, 0x73, 0x72, 0x73, 0x72, 0x72, 0x72, 0x6c, 0x88, 0x91, 0x94, 0x94, 0x94, 0x93, 0x89, 0x6a, 0x73, 0x72, 0x73, 0x74, 0x73, 0x73, 0x74, 0x79, 0x74, 0x77, 0x78, 0x71, 0x76, 0x7e, 0xac, 0xb4, 0xb2, 0xb2, 0xb2, 0xb6, 0xb7, 0xb3, 0xb6, 0xbc, 0xbc, 0xbc, 0xb8, 0xbc, 0xb8, 0x53, 0x56, 0xc7, 0x53, 0x53, 0x53, 0xc7, 0x53, 0x4c, 0x4c, 0xba, 0x4c, 0xb6, 0xb8, 0xb8, 0xb6, 0xbe, 0xb6, 0xbe, 0x42, 0x42, 0x5c, 0x5b, 0xf1, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf2, 0xf3, 0x5b, 0x5c, 0xc5, 0xa7, 0xba, 0xb2, 0xb4, 0xb2, 0xaf, 0xb6, 0xaf, 0xb6, 0xb6, 0xb2, 0x50, 0x50, 0xa5, 0x32, 0x2d, 0x28, 0x28, 0x2d, 0x32, 0x36, 0x48, 0x53, 0x53, 0xb8, 0x4c, 0xbc, 0xbc, 0x4c, 0xba, 0x4c, 0xba, 0xb6, 0xbe, 0x86, 0x6a, 0x7c, 0x77, 0x79, 0x77, 0x78, 0x76, 0x79, 0x79, 0x79, 0x79, 0x74, 0x77, 0x6d, 0x20, 0x8b, 0x79, 0x74, 0x70, 0x74, 0x70, 0x6f, 0x80, 0x7d, 0x6f, 0x76, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x73, 0x72, 0x71, 0x74, 0x6f, 0x72, 0x6a, 0x8b, 0xbb, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xb2, 0x48, 0xc3, 0x93, 0x69, 0x72, 0x71, 0x74, 0x72, 0x73, 0x74, 0x72, 0x72, 0x73, 0x74, 0x73, 0x72, 0x74, 0x73, 0x74, 0x6c, 0x7e, 0x85, 0x86, 0x80, 0x78, 0x70, 0x6f, 0x7e, 0x8b, 0x8e, 0x6f, 0x7b, 0x74, 0x73, 0x74, 0x73, 0x79, 0x74, 0x79, 0x74, 0x78, 0x78, 0x71, 0x68, 0x91, 0xc3, 0xb2, 0xb2, 0xb6, 0xb4, 0xb6, 0xb6, 0xb6, 0x4c, 0xbc, 0xba, 0xbc, 0x53, 0x53, 0xa9, 0x36, 0x2d, 0xfe, 0xfc, 0xfe, 0x2d, 0x36, 0x50, 0x53, 0x4c, 0xb6, 0xb6, 0xb6, 0xb7, 0xb5, 0xb7, 0xb6, 0xbb, 0xb7, 0xa7, 0x57, 0x60, 0xef, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xeb, 0xef, 0x5f, 0xcb, 0x46, 0xb3, 0xba, 0x48, 0xb4, 0xb6, 0xaf, 0xb2, 0xb3, 0xb2, 0x4c, 0x56, 0xa1, 0x28, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0x31, 0xaa, 0xbe, 0xc4, 0xba, 0x4c, 0xb2, 0xba, 0xbb, 0xb6, 0xc6, 0x9f, 0x68, 0x7c, 0x7c, 0x7d, 0x7d, 0x77, 0x78, 0x76, 0x74, 0x79, 0x74, 0x77, 0x79, 0x6d, 0x80, 0x83, 0x77, 0x79, 0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x76, 0x74, 0x79, 0x73, 0x72, 0x73, 0x74, 0x73, 0x72, 0x74, 0x74, 0x72, 0x74, 0x73, 0x72, 0x72, 0x74, 0x72, 0x74, 0x73, 0x41, 0xb6, 0xaf, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0x47, 0x4d, 0xb7, 0x7e, 0x6d, 0x72, 0x6f, 0x72, 0x72, 0x74, 0x73, 0x74, 0x73, 0x74, 0x73, 0x72, 0x73, 0x72, 0x74, 0x73, 0x7c, 0x72, 0x7c, 0x6f, 0x73, 0x74, 0x7e, 0x7c, 0x7c, 0x6c, 0x86, 0x85, 0x71, 0x73, 0x74, 0x73, 0x76, 0x74, 0x79, 0x79, 0x77, 0x78, 0x78, 0x78, 0x78, 0x6b, 0xb4, 0xb7, 0xb2, 0xb6, 0xb6, 0xb7, 0xb6, 0xb2, 0xb8, 0xbc, 0xc4, 0x56, 0xa7, 0x2d, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfb, 0x36, 0x53, 0x4c, 0xb6, 0xb6, 0xb8, 0xaf, 0xb5, 0xb8, 0xb6, 0xbb, 0xb3, 0x4f, 0xcb, 0x5b, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xeb, 0x5b, 0x5f, 0x57, 0x42, 0xbe, 0x47, 0x4c, 0x47, 0xaf, 0xb6, 0xaf, 0xb2, 0x50, 0x41, 0x28, 0x1a, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfd, 0xfe, 0xfd, 0xfc, 0xfd, 0xfb, 0x2d, 0x41, 0xc2, 0xb8, 0xb6, 0xb6, 0xbb, 0x4c, 0xc7, 0x88, 0x6a, 0x7c, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x79, 0x76, 0x74, 0x74, 0x74, 0x70, 0x77, 0x74, 0x7d, 0x79, 0x02, 0x80, 0x80, 0x82, 0x7d, 0x7d, 0x79, 0x77, 0x74, 0x76, 0x6f, 0x76, 0x76, 0x72, 0x73, 0x73, 0x73, 0x6f, 0x71, 0x6f, 0x72, 0x74, 0x6c, 0x6a, 0x91, 0xc7, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb0, 0x4e, 0x9a, 0x69, 0x71, 0x72, 0x73, 0x72, 0x74, 0x72, 0x72, 0x72, 0x72, 0x73, 0x72, 0x76, 0x74, 0x76, 0x72, 0x73, 0x6c, 0x7e, 0x7c, 0x7e, 0x7c, 0x7e, 0x77, 0x7c, 0x7c, 0x7c, 0x79, 0x72, 0x79, 0x79, 0x73, 0x74, 0x73, 0x76, 0x79, 0x74, 0x77, 0x78, 0x78, 0x78, 0x73, 0x69, 0x93, 0xbb, 0xb7, 0xb2, 0xb6, 0xb2, 0xb8, 0xae, 0xbc, 0xbe, 0xa5, 0x28, 0x1a, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfc, 0xfc, 0xfc, 0xfb, 0xfc, 0x41, 0x52, 0xb6, 0xb7, 0xb6, 0xb8, 0xb6, 0xb8, 0x4c, 0xba, 0x47, 0xc9, 0x5b, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0x5b, 0xc0, 0xad, 0xb6, 0xb3, 0xb6, 0xb3, 0xad, 0xb3, 0xb3, 0x53, 0xa5, 0xfb, 0xfb, 0x28, 0xfc, 0xfc, 0xfd, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0x2d, 0xc2, 0xbc, 0xb6, 0xb8, 0x4c, 0x4e, 0x40, 0x74, 0x79, 0x74, 0x7d, 0x77, 0x79, 0x77, 0x79, 0x74, 0x7b, 0x76, 0x76, 0x76, 0x76, 0x74, 0x72, 0x79, 0x79, 0x7d, 0x7d, 0x82, 0x82, 0x82, 0x82, 0x7d, 0x7d, 0x7d, 0x79, 0x74, 0x72, 0x74, 0x73, 0x6f, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x6f, 0x77, 0x70, 0x72, 0x6a, 0x81, 0xc6, 0xae, 0xae, 0xac, 0xac, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xb2, 0xb0, 0xb7, 0x8e, 0x69, 0x6f, 0x72, 0x72, 0x70, 0x74, 0x70, 0x74, 0x72, 0x72, 0x72, 0x73, 0x70, 0x6c, 0x79, 0x74, 0x7b, 0x7a, 0x76, 0x73, 0x76, 0x7c, 0x7e, 0x7d, 0x77, 0x7c, 0x7c, 0x7c, 0x01, 0x74, 0x74, 0x74, 0x7b, 0x73, 0x7b, 0x76, 0x76, 0x76, 0x74, 0x78, 0x76, 0x76, 0x6c, 0x80, 0xb4, 0xb4, 0xb6, 0xb2, 0xaf, 0xb6, 0xb6, 0x4d, 0x4c, 0xfd, 0xfb, 0xfc, 0xfc, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfb, 0xfb, 0x3c, 0x50, 0xb7, 0xb7, 0xb6, 0xb5, 0xb3, 0xb8, 0x4c, 0xb2, 0xc4, 0x5c, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf7, 0xcb, 0xb5, 0xb8, 0xb6, 0xb2, 0xb6, 0xb3, 0xb8, 0xaf, 0xc2, 0x3c, 0x1a, 0xfb, 0xfd, 0xfc, 0xfd, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x28, 0xbb, 0xb7, 0xb8, 0x4c, 0xb6, 0xc6, 0x96, 0x6a, 0x7c, 0x79, 0x72, 0x7c, 0x74, 0x74, 0x79, 0x74, 0x76, 0x73, 0x76, 0x72, 0x74, 0x74, 0x79, 0x74, 0x7d, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x80, 0x80, 0x7d, 0x7d, 0x80, 0x77, 0x74, 0x6f, 0x74, 0x6f, 0x72, 0x71, 0x6f, 0x73, 0x6f, 0x6f, 0x72, 0x77, 0x74, 0x6c, 0x66, 0xa5, 0xbb, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb4, 0x43, 0x78, 0x6a, 0x6f, 0x72, 0x73, 0x74, 0x70, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x6c, 0x77, 0x72, 0x6f, 0x72, 0x70, 0x74, 0x78, 0x7d, 0x7c, 0x77, 0x79, 0x7d, 0x7d, 0x7c, 0x77, 0x79, 0x01, 0x7d, 0x70, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x74, 0x76, 0x7c, 0x68, 0x9a, 0x4d, 0xb7, 0xae, 0xb7, 0xaf, 0xba, 0x4c, 0x50, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfd, 0xfc, 0xfc, 0x1a, 0x11, 0xa1, 0x50, 0xb4, 0xaf, 0xb6, 0xb5, 0x4c, 0xb6, 0x4c, 0xb3, 0xf8, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xc8, 0xb5, 0xba, 0xb6, 0xb2, 0xb3, 0xb3, 0xae, 0xbb, 0x41, 0x88, 0x1a, 0xfb, 0xfd, 0xfd, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0x32, 0xc2, 0xaf, 0xb8, 0x4c, 0xb6, 0xc3, 0x89, 0x74, 0x7c, 0x79, 0x72, 0x79, 0x74, 0x79, 0x79, 0x74, 0x76, 0x76, 0x72, 0x76, 0x70, 0x74, 0x79, 0x79, 0x82, 0x82, 0x85, 0x0a, 0x82, 0x80, 0x7d, 0x7d, 0x79, 0x7d, 0x79, 0x7d, 0x80, 0x79, 0x6f, 0x74, 0x72, 0x6f, 0x72, 0x73, 0x6f, 0x71, 0x72, 0x6f, 0x74, 0x6c, 0x7c, 0x68, 0x96, 0xc3, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbb, 0x35, 0x69, 0x73, 0x6f, 0x72, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x6f, 0x77, 0x6f, 0x77, 0x77, 0x6f, 0x78, 0x7d, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x82, 0x7e, 0x7d, 0x79, 0x77, 0x79, 0x70, 0x79, 0x79, 0x77, 0x72, 0x76, 0x76, 0x76, 0x76, 0x78, 0x6c, 0x7c, 0x78, 0x6a, 0x89, 0xc7, 0xae, 0xb7, 0xb6, 0xb7, 0x4c, 0x48, 0x53, 0x99, 0xfb, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0x1a, 0x11, 0x06, 0x43, 0x4e, 0xb6, 0xb3, 0xb3, 0xb6, 0xb6, 0xba, 0xab, 0x58, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0x5b, 0x54, 0xb5, 0xb7, 0xb7, 0xb2, 0xb3, 0xb6, 0xb6, 0xbf, 0xfb, 0x06, 0x0d, 0x13, 0xfd, 0x24, 0x1a, 0x1a, 0x1a, 0x13, 0x1a, 0x1a, 0xfc, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0x36, 0xbf, 0xb8, 0xb8, 0xb6, 0xb8, 0x4e, 0x7b, 0x74, 0x79, 0x76, 0x79, 0x76, 0x74, 0x74, 0x74, 0x77, 0x73, 0x76, 0x72, 0x72, 0x74, 0x6f, 0x6a, 0x7d, 0x83, 0x83, 0x82, 0x7d, 0x79, 0x82, 0x14, 0x89, 0x93, 0x8e, 0x83, 0x77, 0x77, 0x80, 0x7d, 0x70, 0x72, 0x74, 0x70, 0x74, 0x72, 0x71, 0x72, 0x6f, 0x77, 0x6f, 0x72, 0x69, 0x88, 0xbf, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xc6, 0x91, 0x69, 0x73, 0x73, 0x72, 0x72, 0x74, 0x70, 0x74, 0x72, 0x70, 0x74, 0x6f, 0x77, 0x6f, 0x69, 0x85, 0x88, 0x80, 0x82, 0x85, 0x8b, 0x91, 0x91, 0x8e, 0x88, 0x81, 0x76, 0x7e, 0x80, 0x7d, 0x79, 0x79, 0x82, 0x80, 0x79, 0x77, 0x76, 0x76, 0x76, 0x76, 0x74, 0x7c, 0x76, 0x72, 0x73, 0x76, 0xac, 0xb7, 0xb6, 0xb6, 0xb7, 0xaf, 0x4c, 0x50, 0x36, 0xfb, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfc, 0xfb, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x06, 0x06, 0x03, 0x20, 0x4e, 0xaf, 0xb3, 0xb3, 0xb6, 0xb6, 0x4c, 0xb3, 0xc8, 0xf7, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xc0, 0xb8, 0xb6, 0xb7, 0xb2, 0xb6, 0xb2, 0xbb, 0x34, 0x7e, 0x06, 0x0d, 0x1a, 0x13, 0x10, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x10, 0x13, 0x1a, 0xfe, 0xfe, 0xfd, 0xfc, 0xa6, 0xbe, 0xb6, 0xb8, 0xb3, 0xc6, 0xa1, 0x6c, 0x74, 0x78, 0x72, 0x74, 0x74, 0x7c, 0x77, 0x76, 0x76, 0x74, 0x6f, 0x7c, 0x72, 0x73, 0x70, 0x86, 0x83, 0x7e, 0x80, 0x8b, 0x35, 0x43, 0xbf, 0xc3, 0x56, 0x56, 0xbf, 0xa9, 0xa0, 0x8b, 0x7c, 0x7c, 0x7d, 0x74, 0x6a, 0x7c, 0x6a, 0x73, 0x72, 0x72, 0x74, 0x72, 0x74, 0x6c, 0x6d, 0x7e, 0xb4, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xb2, 0xb2, 0xb2, 0xc3, 0x85, 0x6c, 0x6c, 0x73, 0x72, 0x72, 0x74, 0x70, 0x72, 0x72, 0x72, 0x6f, 0x77, 0x6f, 0x6f, 0x86, 0x88, 0x86, 0x94, 0xa7, 0xc6, 0x59, 0x5d, 0x5d, 0x5d, 0x59, 0xb1, 0x9a, 0x8b, 0x7e, 0x7e, 0x7d, 0x14, 0x85, 0x77, 0x79, 0x6f, 0x74, 0x76, 0x76, 0x76, 0x76, 0x7c, 0x73, 0x78, 0x76, 0x6c, 0x9a, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6, 0x4d, 0xbc, 0x3f, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0x1a, 0x11, 0x0f, 0x10, 0x10, 0x0d, 0x10, 0x13, 0x13, 0x13, 0x06, 0x04, 0x03, 0x35, 0xbb, 0xb3, 0xb6, 0x4c, 0xb2, 0xb4, 0xb3, 0xc5, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0x5b, 0xbd, 0xb8, 0xb7, 0xb6, 0xb2, 0xb2, 0xb6, 0xc6, 0x88, 0x03, 0x06, 0x13, 0x13, 0x13, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x10, 0x17, 0xfc, 0xfe, 0xfc, 0xb4, 0x4c, 0xb6, 0xb8, 0xb3, 0xc3, 0x9a, 0x6a, 0x79, 0x74, 0x79, 0x74, 0x74, 0x79, 0x76, 0x79, 0x72, 0x77, 0x69, 0x8e, 0x81, 0x6c, 0x73, 0x56, 0x6e, 0x86, 0xa5, 0x59, 0x59, 0xb2, 0xb3, 0xb6, 0xb6, 0xb6, 0x47, 0xaa, 0x43, 0xb6, 0x9f, 0x86, 0x7b, 0x7a, 0x76, 0x6c, 0x7c, 0x72, 0x72, 0x72, 0x6f, 0x74, 0x74, 0x6f, 0x6c, 0x6d, 0xa5, 0xba, 0xac, 0xb2, 0xac, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb4, 0x7e, 0x6d, 0x6c, 0x72, 0x74, 0x72, 0x74, 0x70, 0x74, 0x6c, 0x74, 0x77, 0x77, 0x6a, 0x83, 0x86, 0x92, 0xad, 0xcc, 0x64, 0x64, 0x64, 0x5c, 0x5f, 0xcd, 0xfa, 0xfa, 0x64, 0x59, 0xa1, 0x83, 0x6e, 0x91, 0x81, 0x72, 0x69, 0x8e, 0x88, 0x69, 0x79, 0x72, 0x7c, 0x76, 0x76, 0x76, 0x76, 0x6a, 0x94, 0xc3, 0xb6, 0xaf, 0xb7, 0xb6, 0xb2, 0x4d, 0x48, 0xfb, 0xfc, 0xfc, 0x1a, 0x0f, 0x0d, 0x0d, 0x10, 0x11, 0x10, 0x10, 0x13, 0x10, 0x13, 0x17, 0x06, 0x03, 0x70, 0x20, 0xc3, 0xb3, 0xb6, 0xb6, 0xb4, 0xb4, 0xb3, 0xc5, 0xf8, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0xb9, 0xb8, 0xb7, 0xb4, 0xb7, 0xb2, 0xba, 0x40, 0x68, 0x04, 0x03, 0x11, 0x10, 0x10, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x10, 0x13, 0xfb, 0xfe, 0x53, 0xb4, 0xb5, 0x4c, 0xb5, 0xc6, 0x94, 0x69, 0x79, 0x74, 0x77, 0x74, 0x7c, 0x74, 0x79, 0x74, 0x77, 0x78, 0x77, 0x7d, 0x9f, 0x83, 0x7f, 0xa1, 0xb5, 0xc9, 0xc5, 0x42, 0xb5, 0xa8, 0x98, 0x92, 0x8f, 0x92, 0xee, 0x9c, 0xa4, 0xb9, 0xad, 0xc0, 0x94, 0x6e, 0x7b, 0x72, 0x72, 0x76, 0x72, 0x72, 0x72, 0x74, 0x72, 0x76, 0x71, 0x68, 0x9a, 0xc6, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb7, 0xa5, 0x6c, 0x73, 0x6c, 0x73, 0x72, 0x72, 0x74, 0x70, 0x74, 0x70, 0x74, 0x77, 0x6c, 0x83, 0x88, 0xa1, 0x64, 0xc8, 0x9b, 0x8c, 0xd9, 0xf6, 0xf6, 0xf6, 0x67, 0xda, 0xcf, 0xb1, 0x62, 0x64, 0xcc, 0x9c, 0x88, 0x8b, 0x6a, 0x98, 0x91, 0x68, 0x74, 0x78, 0x72, 0x72, 0x76, 0x76, 0x74, 0x78, 0x6a, 0x88, 0xc3, 0xae, 0xb6, 0xb3, 0xb6, 0xb4, 0x4c, 0x51, 0xfe, 0x1a, 0x0f, 0x0d, 0x0d, 0x0f, 0x10, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x13, 0x11, 0x13, 0x0d, 0x03, 0x03, 0x70, 0xb4, 0xb7, 0xb3, 0xb6, 0xb4, 0xb4, 0xb3, 0xbd, 0x5b, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xca, 0xb9, 0xb8, 0xb7, 0xb7, 0xb4, 0xb6, 0xbb, 0x9a, 0x69, 0x03, 0x04, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x2d, 0x52, 0x4c, 0xb7, 0xb5, 0xb3, 0xc7, 0x91, 0x6a, 0x79, 0x77, 0x79, 0x74, 0x79, 0x74, 0x79, 0x74, 0x7d, 0x6a, 0x78, 0x6a, 0x91, 0xab, 0x88, 0x9b, 0xcb, 0xb9, 0xb1, 0x9e, 0xda, 0x67, 0xed, 0xed, 0xed, 0xd0, 0x65, 0xd7, 0xd9, 0x8c, 0x9b, 0xb8, 0xb1, 0x94, 0x6e, 0x6a, 0x73, 0x6c, 0x73, 0x72, 0x72, 0x74, 0x6f, 0x76, 0x73, 0x69, 0x94, 0xc7, 0xb2, 0xae, 0xac, 0xb2, 0xae, 0xac, 0xac, 0xbb, 0x9d, 0x6a, 0x73, 0x6d, 0x6f, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x6c, 0x74, 0x86, 0xa7, 0x64, 0xee, 0xd9, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xed, 0x87, 0xc1, 0x62, 0x63, 0x4f, 0x8b, 0x9c, 0x9d, 0x66, 0x6f, 0x6a, 0x69, 0x7c, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76, 0x81, 0xc3, 0xaf, 0xb6, 0xaf, 0xb6, 0xb4, 0xb4, 0x50, 0x2a, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x11, 0x10, 0x0f, 0x0f, 0x0f, 0x11, 0x0f, 0x13, 0x11, 0x11, 0x03, 0x03, 0x68, 0xa7, 0xb7, 0xb6, 0xae, 0xb4, 0xb4, 0xb6, 0xb9, 0x5b, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xca, 0xb9, 0xb6, 0xb7, 0x4e, 0xb7, 0xb4, 0xc2, 0x8e, 0x7b, 0x01, 0x04, 0x11, 0x0f, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x10, 0x31, 0x52, 0xb6, 0xbc, 0xb3, 0xb3, 0xc6, 0x8b, 0x6c, 0x79, 0x74, 0x79, 0x74, 0x79, 0x74, 0x79, 0x6f, 0x82, 0x8e, 0x6f, 0x6c, 0x6d, 0x42, 0x5a, 0x64, 0xc1, 0x9e, 0xd9, 0xd0, 0xd0, 0xd0, 0xd0, 0xed, 0xf6, 0xd9, 0xda, 0xda, 0xd9, 0xd7, 0xf6, 0xda, 0xa4, 0x59, 0x8e, 0x69, 0x74, 0x73, 0x72, 0x72, 0x70, 0x72, 0x6f, 0x76, 0x6d, 0x69, 0x90, 0x56, 0xab, 0xac, 0xae, 0xb2, 0xb2, 0x47, 0xac, 0xbf, 0x99, 0x6a, 0x6c, 0x72, 0x73, 0x74, 0x72, 0x72, 0x70, 0x74, 0x70, 0x77, 0x6f, 0x81, 0x9d, 0x4f, 0xd9, 0xed, 0xd6, 0xd7, 0xd1, 0xd2, 0xcf, 0xee, 0xd2, 0x8c, 0xd7, 0xf6, 0xd0, 0xd0, 0xd0, 0x97, 0x62, 0x62, 0x5d, 0xa1, 0x68, 0x66, 0x6a, 0x83, 0x89, 0x73, 0x74, 0x74, 0x76, 0x76, 0x76, 0x73, 0x71, 0xb4, 0xb7, 0xb3, 0xb6, 0xb6, 0xb4, 0xb6, 0x51, 0x32, 0x04, 0x0d, 0x0d, 0x0f, 0x0f, 0x10, 0x10, 0x13, 0x0f, 0x0f, 0x0f, 0x13, 0x11, 0x0f, 0x11, 0x01, 0x03, 0x68, 0x9c, 0xb7, 0xb6, 0xae, 0xb4, 0xb2, 0x4c, 0xb5, 0x5b, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xca, 0xb5, 0x4f, 0xb6, 0xbb, 0xb2, 0xbb, 0xb7, 0x8b, 0x01, 0x01, 0x03, 0x0f, 0x11, 0x13, 0x13, 0x13, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0d, 0x32, 0x53, 0xb6, 0xb8, 0xb6, 0xb3, 0xc6, 0x8b, 0x6c, 0x77, 0x79, 0x77, 0x77, 0x77, 0x74, 0x79, 0x72, 0x77, 0x96, 0x9a, 0x75, 0x8c, 0x5d, 0x5b, 0xca, 0xcf, 0xf6, 0xed, 0x65, 0xd6, 0xd7, 0x8c, 0x9b, 0xe8, 0xea, 0xd4, 0xf3, 0xef, 0x54, 0x9b, 0xda, 0xd7, 0x97, 0xb9, 0x81, 0x69, 0x74, 0x72, 0x72, 0x72, 0x72, 0x6f, 0x72, 0x72, 0x69, 0x8e, 0xc6, 0xac, 0xae, 0xae, 0xb2, 0xac, 0xb2, 0xae, 0xbb, 0x99, 0x6b, 0x73, 0x6c, 0x6c, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6f, 0x6f, 0x75, 0x90, 0x46, 0xda, 0xf6, 0xda, 0xee, 0xc8, 0xf9, 0x5b, 0xf2, 0xf0, 0xd4, 0xe8, 0xe7, 0xe4, 0xdb, 0xd6, 0xd0, 0xd0, 0x95, 0xcc, 0xcb, 0xb1, 0x8f, 0x90, 0x35, 0x99, 0x85, 0x74, 0x74, 0x74, 0x77, 0x74, 0x79, 0x73, 0x6a, 0xac, 0xb6, 0xb6, 0xb3, 0xb6, 0xb6, 0xb2, 0x50, 0x34, 0x04, 0x0d, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x13, 0x11, 0x0a, 0x03, 0x01, 0x68, 0x9a, 0xbe, 0x48, 0xb2, 0xb4, 0xb4, 0xaf, 0xb9, 0x5b, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf2, 0x5b, 0xf8, 0xb9, 0xba, 0xb6, 0xbb, 0xb4, 0xbb, 0xba, 0x8a, 0x01, 0x02, 0x04, 0x0d, 0x0f, 0x10, 0x10, 0x13, 0x13, 0x0f, 0x13, 0x0f, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0d, 0x32, 0x52, 0xb6, 0xb8, 0xb6, 0xb3, 0xc6, 0x88, 0x6a, 0x79, 0x77, 0x79, 0x77, 0x74, 0x79, 0x77, 0x79, 0x6f, 0x6f, 0x93, 0xa1, 0x46, 0x61, 0xff, 0x97, 0xd0, 0x65, 0xf6, 0xd0, 0xdd, 0xe5, 0xf0, 0xcd, 0xeb, 0xd4, 0xef, 0x64, 0xd5, 0xfa, 0xfa, 0xd5, 0xee, 0xed, 0x9c, 0x96, 0x6a, 0x6c, 0x6d, 0x72, 0x6d, 0x72, 0x6d, 0x6f, 0x73, 0x69, 0x8b, 0xc7, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xbe, 0x99, 0x69, 0x76, 0x6c, 0x72, 0x72, 0x6f, 0x6c, 0x6f, 0x76, 0x73, 0x6a, 0x81, 0xa1, 0x8c, 0x67, 0xcf, 0x5b, 0xfa, 0x61, 0xca, 0xf3, 0xf5, 0xea, 0xf0, 0xf4, 0xe9, 0xe7, 0xe7, 0xe1, 0xd7, 0xd0, 0xd0, 0x9b, 0x64, 0x5a, 0xa4, 0xc6, 0x8e, 0x68, 0x6c, 0x7d, 0x6f, 0x74, 0x74, 0x74, 0x79, 0x73, 0x6a, 0xa9, 0xb7, 0xb6, 0xb3, 0xb6, 0xb6, 0xb6, 0x50, 0x36, 0x04, 0x0d, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x0f, 0x0f, 0x10, 0x10, 0x0f, 0x13, 0x06, 0x02, 0x01, 0x68, 0x9a, 0x4c, 0x4c, 0xb4, 0xb4, 0xaf, 0xaf, 0xc0, 0xcb, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0x5b, 0xbd, 0xb8, 0x4c, 0xb4, 0x4c, 0xb7, 0xbb, 0x8e, 0x70, 0x03, 0x01, 0x06, 0x11, 0x0f, 0x10, 0x13, 0x13, 0x13, 0x10, 0x13, 0x10, 0x13, 0x13, 0x13, 0x13, 0x10, 0x0d, 0x36, 0x52, 0xb6, 0xb6, 0xb3, 0xb3, 0xc3, 0x88, 0x6f, 0x77, 0x79, 0x77, 0x74, 0x7d, 0x74, 0x74, 0x74, 0x6a, 0x6d, 0x65, 0x92, 0x61, 0xf8, 0xa4, 0xd0, 0xf6, 0xf6, 0xd6, 0xe2, 0xe2, 0xdd, 0xe9, 0xd5, 0x58, 0xf4, 0xca, 0x8c, 0xd9, 0xda, 0x9e, 0xfa, 0xfa, 0xa4, 0xd9, 0xa1, 0x6d, 0x6c, 0x72, 0x6c, 0x72, 0x72, 0x6f, 0x6c, 0x73, 0x69, 0x8b, 0xc6, 0xac, 0xae, 0xae, 0xb2, 0xac, 0xb2, 0xac, 0xbb, 0x99, 0x6a, 0x73, 0x6c, 0x73, 0x72, 0x6c, 0x72, 0x6d, 0x72, 0x6f, 0x69, 0x90, 0x9d, 0xf6, 0x9c, 0xfa, 0x00, 0xf3, 0xf9, 0xcd, 0xf8, 0xd1, 0xf6, 0xd7, 0xee, 0xf4, 0xf4, 0xe6, 0xe5, 0xe4, 0xd7, 0xd0, 0xf6, 0xaa, 0x5c, 0x55, 0x7e, 0x6a, 0x6c, 0x6c, 0x6c, 0x77, 0x71, 0x77, 0x76, 0x76, 0x73, 0x6a, 0xa5, 0xbb, 0xaf, 0xb3, 0xb3, 0xb6, 0xb3, 0x50, 0x3c, 0x04, 0x0f, 0x0d, 0x10, 0x10, 0x10, 0x0f, 0x0f, 0x10, 0x10, 0x10, 0x13, 0x10, 0x11, 0x05, 0x01, 0x02, 0x66, 0x9d, 0xba, 0x48, 0x4d, 0xae, 0xb6, 0xaf, 0xc5, 0x5c, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0x5b, 0xc5, 0xb3, 0xb6, 0x4c, 0xb4, 0xb6, 0xc2, 0x93, 0x6c, 0x01, 0x01, 0x06, 0x0f, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x13, 0x10, 0x10, 0x13, 0x10, 0x0d, 0x36, 0xc3, 0xb6, 0xb8, 0xb6, 0xb6, 0xc3, 0x8b, 0x6a, 0x77, 0x77, 0x77, 0x77, 0x73, 0x7d, 0x69, 0x89, 0x93, 0x83, 0x6e, 0xa8, 0xcd, 0xc8, 0xd7, 0xf6, 0xd6, 0xd0, 0xe2, 0xe2, 0xde, 0xdc, 0xe8, 0x00, 0xeb, 0xcd, 0xce, 0xd0, 0xd0, 0xd0, 0xf6, 0xe8, 0xec, 0xfa, 0x98, 0x8d, 0x84, 0x6a, 0x72, 0x6d, 0x72, 0x6c, 0x6f, 0x73, 0x72, 0x69, 0x8e, 0xc6, 0xae, 0xb2, 0xb2, 0xae, 0xac, 0xae, 0xac, 0xba, 0x35, 0x6a, 0x72, 0x6c, 0x72, 0x72, 0x71, 0x6c, 0x6f, 0x76, 0x6a, 0x73, 0x9a, 0x87, 0x92, 0xfa, 0xcd, 0xf7, 0x00, 0xff, 0xfa, 0x9e, 0xd0, 0xd0, 0xd0, 0xd0, 0xeb, 0x64, 0xea, 0xe5, 0xe5, 0xe1, 0xd6, 0xd0, 0x87, 0xcc, 0x63, 0x8f, 0x7e, 0x88, 0x93, 0x7e, 0x73, 0x71, 0x73, 0x76, 0x76, 0x73, 0x6a, 0x9f, 0xbe, 0xb2, 0xb3, 0xb3, 0xb6, 0xb6, 0x50, 0x3c, 0x03, 0x0f, 0x0d, 0x10, 0x10, 0x10, 0x0f, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x0f, 0x03, 0x01, 0x01, 0x6a, 0xa9, 0x4c, 0x48, 0xb4, 0xb2, 0xb3, 0xad, 0xc8, 0x5b, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0x5b, 0x54, 0xb3, 0x4c, 0x4c, 0xb2, 0xb2, 0xbe, 0x9d, 0x69, 0x01, 0x7e, 0x01, 0x0d, 0x0f, 0x0f, 0x10, 0x13, 0x10, 0x10, 0x10, 0x10, 0x10, 0x13, 0x10, 0x13, 0x10, 0x0d, 0x3c, 0x52, 0xb6, 0xb6, 0x4c, 0xb3, 0xc7, 0x8b, 0x6c, 0x78, 0x77, 0x78, 0x77, 0x78, 0x74, 0x7d, 0x78, 0x8b, 0xa2, 0x42, 0xcc, 0xfa, 0xce, 0x65, 0xed, 0xd6, 0xdc, 0xe5, 0xe2, 0xe2, 0xe3, 0xf0, 0xd5, 0x5b, 0xcd, 0x8c, 0xd0, 0xd0, 0xd0, 0xd7, 0xef, 0xf5, 0xd5, 0x61, 0x8f, 0x90, 0x6b, 0x6f, 0x72, 0x6f, 0x6c, 0x72, 0x73, 0x6f, 0x69, 0x91, 0xc6, 0xac, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xb7, 0xa2, 0x6a, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x71, 0x6c, 0x76, 0x7e, 0x98, 0x84, 0xff, 0xcd, 0xf5, 0xff, 0x00, 0xff, 0xfa, 0xa8, 0xd0, 0xd0, 0xd0, 0xee, 0xfa, 0xec, 0xea, 0xe5, 0xe3, 0xe5, 0xdc, 0xed, 0xd0, 0xa4, 0x5d, 0x59, 0x56, 0xb2, 0x8e, 0x71, 0x71, 0x71, 0x76, 0x73, 0x76, 0x73, 0x6a, 0x9d, 0xbe, 0xaf, 0xb3, 0xb3, 0xb6, 0xb6, 0xbb, 0x3c, 0x03, 0x0d, 0x0d, 0x10, 0x10, 0x10, 0x0f, 0x0f, 0x10, 0x10, 0x10, 0x0f, 0x11, 0x0a, 0x01, 0x01, 0x7b, 0x81, 0xbe, 0xb2, 0xb2, 0x48, 0x4c, 0xaf, 0xb5, 0xc8, 0x5f, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0x57, 0xb5, 0x4c, 0x4c, 0xb6, 0xb6, 0xb7, 0x43, 0x6c, 0x74, 0x01, 0x01, 0x04, 0x11, 0x0f, 0x10, 0x10, 0x13, 0x10, 0x10, 0x13, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0d, 0x36, 0xc3, 0xb7, 0xb8, 0x4c, 0xb6, 0xc6, 0x8e, 0x6a, 0x77, 0x76, 0x77, 0x74, 0x77, 0x77, 0x76, 0x77, 0x74, 0x76, 0x8d, 0xfa, 0xf1, 0xf6, 0xf6, 0xf6, 0xd6, 0xe1, 0xe2, 0xe2, 0xe7, 0xf0, 0xec, 0xf5, 0x60, 0x00, 0xc1, 0xd7, 0xd0, 0xda, 0xe8, 0xfa, 0xf2, 0x00, 0xfa, 0xa8, 0x8f, 0x6b, 0x6c, 0x72, 0x6c, 0x72, 0x73, 0x6f, 0x73, 0x69, 0x94, 0xc6, 0x43, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0x40, 0x7c, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x6f, 0x6f, 0x6c, 0x78, 0x7c, 0x98, 0x8f, 0xfa, 0xff, 0xf5, 0xf5, 0x61, 0xec, 0x00, 0xec, 0xcf, 0xd7, 0x9b, 0xcd, 0xcd, 0x64, 0xf0, 0xe6, 0xe3, 0xe5, 0xe1, 0xed, 0xd0, 0x8c, 0xcb, 0xc5, 0x90, 0x6d, 0x69, 0x73, 0x6d, 0x71, 0x71, 0x76, 0x76, 0x73, 0x69, 0x9d, 0xbf, 0xb2, 0xb3, 0xb6, 0xb6, 0xb6, 0xbb, 0x3c, 0x04, 0x0d, 0x10, 0x0f, 0x10, 0x0f, 0x0f, 0x0d, 0x10, 0x10, 0x0f, 0x0f, 0x0f, 0x03, 0x01, 0x7b, 0x6c, 0x93, 0xbb, 0x4c, 0x48, 0xb2, 0xb6, 0xb5, 0xad, 0x5b, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf2, 0xef, 0x5b, 0xca, 0xb5, 0x4c, 0xb6, 0xb6, 0xb6, 0xb6, 0x56, 0x8b, 0x70, 0x7b, 0x01, 0x79, 0x06, 0x0f, 0x0d, 0x10, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x06, 0x32, 0x52, 0xb8, 0xb6, 0x4c, 0x4c, 0xc7, 0x93, 0x6a, 0x79, 0x77, 0x77, 0x74, 0x77, 0x77, 0x74, 0x74, 0x77, 0x6a, 0x97, 0xfa, 0x9e, 0xd0, 0xf6, 0xed, 0xd8, 0xe2, 0xe2, 0xe6, 0xfa, 0xf5, 0xff, 0xf7, 0x5f, 0x62, 0xec, 0xec, 0x64, 0x64, 0x64, 0xf2, 0xd5, 0xf5, 0x5b, 0xfa, 0x92, 0x7e, 0x6c, 0x72, 0x6d, 0x72, 0x6c, 0x73, 0x6f, 0x69, 0x9c, 0xbb, 0xab, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbf, 0x83, 0x6a, 0x6a, 0x73, 0x6c, 0x6c, 0x6f, 0x73, 0x6f, 0x77, 0x7e, 0x97, 0xa8, 0xfa, 0xd5, 0xf5, 0xff, 0xf5, 0xf5, 0xf5, 0x5f, 0xfa, 0xfa, 0xfa, 0xcd, 0xd5, 0x00, 0xec, 0xea, 0xe5, 0xe3, 0xe5, 0xd6, 0xed, 0x66, 0xb1, 0xc5, 0x6e, 0x6e, 0x6d, 0x73, 0x71, 0x71, 0x78, 0x74, 0x76, 0x76, 0x69, 0x9f, 0xbe, 0xb3, 0xb3, 0xb3, 0xb6, 0xb6, 0x53, 0x99, 0x04, 0x0d, 0x0f, 0x0d, 0x10, 0x0d, 0x10, 0x0f, 0x0d, 0x11, 0x0f, 0x0a, 0x04, 0x01, 0x7d, 0x7b, 0x7e, 0xa9, 0xb7, 0xae, 0x4c, 0x4c, 0xb2, 0xad, 0xb9, 0xf7, 0x5b, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0x5c, 0xc0, 0xb3, 0x4c, 0xb6, 0xb6, 0xb3, 0xc2, 0xa0, 0x73, 0x7b, 0x7c, 0x74, 0x01, 0x06, 0x11, 0x0d, 0x0f, 0x0f, 0x11, 0x0f, 0x0f, 0x0d, 0x0f, 0x0f, 0x11, 0x04, 0x99, 0xbf, 0xb7, 0xb3, 0x4c, 0x4c, 0xc2, 0x99, 0x69, 0x77, 0x79, 0x77, 0x74, 0x79, 0x74, 0x74, 0x6f, 0x70, 0x68, 0x9c, 0xfa, 0xce, 0xd0, 0xf6, 0xd0, 0xdc, 0xe2, 0xe2, 0xe9, 0xf5, 0x62, 0xcd, 0xf5, 0xff, 0x60, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xf7, 0xcd, 0xd5, 0x61, 0xfa, 0x9b, 0x7f, 0x6c, 0x6c, 0x72, 0x6f, 0x72, 0x72, 0x6a, 0x6a, 0xa2, 0xb7, 0x43, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xc6, 0x8e, 0x68, 0x73, 0x6c, 0x72, 0x6c, 0x6c, 0x6f, 0x77, 0x6f, 0x7e, 0x95, 0x54, 0xec, 0xf5, 0xf5, 0xf5, 0x61, 0xd5, 0xf5, 0xcd, 0xd5, 0xf7, 0x00, 0xf5, 0xcd, 0xcd, 0xec, 0xec, 0xe7, 0xe3, 0xe5, 0xd7, 0xd0, 0x65, 0x9e, 0x64, 0x91, 0x66, 0x7a, 0x71, 0x78, 0x6f, 0x72, 0x74, 0x79, 0x73, 0x6a, 0xa7, 0xbb, 0xb6, 0xb3, 0xb7, 0xb3, 0xb4, 0x53, 0x93, 0x06, 0x0d, 0x0d, 0x10, 0x0d, 0x10, 0x0f, 0x0f, 0x11, 0x0e, 0x0d, 0x02, 0x01, 0x7d, 0x74, 0x6a, 0x94, 0xbb, 0xaf, 0x48, 0xb2, 0xb4, 0xb3, 0xad, 0x55, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf8, 0x5c, 0x55, 0x4c, 0xb6, 0x4c, 0xb3, 0xb6, 0x4c, 0x52, 0x96, 0x68, 0x7b, 0x7c, 0x01, 0x01, 0x04, 0x06, 0x0f, 0x0f, 0x11, 0x0f, 0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x03, 0x2d, 0xc3, 0xbb, 0xb3, 0x4c, 0x4c, 0xc2, 0x9f, 0x6a, 0x79, 0x77, 0x79, 0x74, 0x77, 0x77, 0x74, 0x74, 0x6f, 0x83, 0xc9, 0xec, 0xd1, 0xd0, 0x65, 0xed, 0xdc, 0xe2, 0xe2, 0xea, 0xcd, 0x60, 0xd5, 0xeb, 0x00, 0x60, 0x60, 0xf5, 0x61, 0x5b, 0x5f, 0x00, 0x5b, 0x5f, 0x5f, 0xfa, 0xa4, 0x81, 0x6c, 0x6c, 0x73, 0x6c, 0x72, 0x6f, 0x69, 0x80, 0x43, 0xac, 0xac, 0xac, 0xab, 0xac, 0xac, 0xac, 0xac, 0xac, 0xbf, 0x9a, 0x6a, 0x72, 0x6c, 0x72, 0x6c, 0x6f, 0x73, 0x6f, 0x77, 0x7a, 0x98, 0x5b, 0x00, 0xf5, 0xf5, 0xff, 0x00, 0x00, 0xf5, 0xf7, 0x00, 0x00, 0x00, 0xf7, 0xf5, 0xec, 0xcc, 0x64, 0xea, 0xe3, 0xe5, 0xd7, 0xd0, 0x65, 0x9b, 0xcd, 0x9c, 0x69, 0x71, 0x73, 0x6f, 0x73, 0x77, 0x79, 0x79, 0x74, 0x73, 0xac, 0xb7, 0xb6, 0xb3, 0xb7, 0xb3, 0xba, 0xb4, 0x11, 0x0d, 0x0d, 0x0d, 0x10, 0x0f, 0x0d, 0x0f, 0x0d, 0x0a, 0x04, 0x02, 0x01, 0x01, 0x02, 0x69, 0x8b, 0x4e, 0xb7, 0xae, 0xb4, 0x4c, 0xb2, 0xb6, 0xb8, 0x5b, 0x5b, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf9, 0x5a, 0xbd, 0xb3, 0xb6, 0xb7, 0xb7, 0xb2, 0xba, 0xbb, 0x8b, 0x6a, 0x74, 0x7b, 0x01, 0x74, 0x02, 0x03, 0x04, 0x83, 0x06, 0x85, 0x04, 0x05, 0x04, 0x04, 0x7b, 0x96, 0xc6, 0xbc, 0xb6, 0xb3, 0x4c, 0xbf, 0x43, 0x76, 0x74, 0x78, 0x74, 0x74, 0x74, 0x77, 0x72, 0x74, 0x70, 0x6c, 0x9c, 0xfa, 0xda, 0xed, 0xf6, 0xed, 0xdd, 0xe2, 0xe2, 0xea, 0xec, 0xcc, 0x5f, 0xd5, 0xeb, 0x60, 0x62, 0x60, 0x5f, 0xd5, 0x5f, 0x00, 0xd5, 0x61, 0x5f, 0xfa, 0x9e, 0x81, 0x70, 0x6f, 0x72, 0x71, 0x73, 0x6d, 0x6a, 0x86, 0xb4, 0xab, 0x43, 0xab, 0x43, 0x43, 0xac, 0x43, 0xab, 0x43, 0xae, 0xa9, 0x7b, 0x69, 0x6c, 0x72, 0x6d, 0x72, 0x71, 0x6f, 0x6f, 0x7a, 0x95, 0x5c, 0xcd, 0xd5, 0x00, 0x00, 0x5f, 0xff, 0xf5, 0x00, 0xd5, 0xf5, 0xd5, 0xf5, 0x00, 0x61, 0xcd, 0x00, 0xea, 0xe3, 0xe5, 0xd7, 0xd0, 0x65, 0xa4, 0xaa, 0x7e, 0x6c, 0x6f, 0x6f, 0x76, 0x72, 0x74, 0x74, 0x79, 0x73, 0x7e, 0xbb, 0xb6, 0xaf, 0xb3, 0xb8, 0xb2, 0xbe, 0xa9, 0x03, 0x7e, 0x06, 0x03, 0x06, 0x05, 0x06, 0x05, 0x03, 0x7d, 0x02, 0x79, 0x7d, 0x79, 0x69, 0x88, 0x43, 0xb2, 0xae, 0xb0, 0xac, 0xb2, 0xb6, 0x46, 0xc8, 0x5b, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xef, 0xf7, 0x5b, 0xc8, 0xb1, 0xb8, 0xb6, 0xb4, 0xb7, 0xaf, 0xc2, 0xb7, 0x88, 0x69, 0x7c, 0x72, 0x79, 0x74, 0x72, 0x79, 0x76, 0x79, 0x76, 0x7b, 0x7c, 0x7c, 0x7e, 0x6c, 0x9f, 0xbb, 0xbb, 0xb6, 0xba, 0xb3, 0xba, 0xc6, 0x83, 0x6a, 0x76, 0x76, 0x72, 0x72, 0x72, 0x74, 0x73, 0x76, 0x6a, 0x81, 0xfa, 0xce, 0xd0, 0xf6, 0xd0, 0xdd, 0xe2, 0xe2, 0xea, 0xd5, 0xcd, 0x60, 0x61, 0xd5, 0xd5, 0x60, 0x60, 0x61, 0x5f, 0xd5, 0x5f, 0xd5, 0x5f, 0xcd, 0xfa, 0x9e, 0x7e, 0x6c, 0x72, 0x6d, 0x71, 0x6d, 0x7a, 0x66, 0x96, 0xc4, 0xbf, 0xb7, 0xbf, 0xbf, 0xc3, 0xbb, 0xbf, 0xbf, 0xbe, 0xb6, 0xc7, 0x88, 0x6c, 0x6d, 0x72, 0x72, 0x6c, 0x6e, 0x73, 0x6a, 0x7a, 0x8d, 0x5a, 0xcc, 0xcd, 0x5b, 0xcd, 0xf5, 0x00, 0xf5, 0xf5, 0xec, 0xd5, 0xf5, 0x00, 0x00, 0xcd, 0x62, 0x64, 0xea, 0xe1, 0xe3, 0xd6, 0xd0, 0x67, 0xb8, 0x95, 0x69, 0x72, 0x72, 0x74, 0x72, 0x76, 0x74, 0x76, 0x76, 0x69, 0x86, 0xc3, 0xaf, 0xb6, 0xb5, 0xb6, 0xb3, 0xbb, 0xac, 0x7e, 0x70, 0x7d, 0x01, 0x7d, 0x01, 0x74, 0x79, 0x7d, 0x7d, 0x7d, 0x77, 0x79, 0x69, 0x20, 0xac, 0xbb, 0xaf, 0xb4, 0xb0, 0xb0, 0xb3, 0x46, 0xb1, 0x5b, 0xef, 0xef, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf8, 0xf3, 0xf9, 0x5b, 0x4f, 0xb5, 0xb6, 0xb6, 0xbb, 0xb2, 0xae, 0xbb, 0x4e, 0x8e, 0x68, 0x7c, 0x79, 0x73, 0x79, 0x7a, 0x70, 0x76, 0x7b, 0x7c, 0x7b, 0x7e, 0x6c, 0x20, 0x4d, 0xba, 0xbc, 0xb6, 0x4c, 0xb6, 0xb6, 0xc2, 0x91, 0x6a, 0x6f, 0x76, 0x72, 0x72, 0x76, 0x72, 0x73, 0x74, 0x6c, 0x66, 0xa8, 0x9b, 0xd0, 0xf6, 0xd0, 0xdd, 0xe2, 0xde, 0xe7, 0xec, 0x61, 0x60, 0x5f, 0xd5, 0xeb, 0xf5, 0x60, 0x5f, 0x61, 0x5f, 0xff, 0xd5, 0x5f, 0x00, 0xfa, 0x95, 0x75, 0x6c, 0x72, 0x6f, 0x6f, 0x6d, 0x6c, 0x6d, 0xa5, 0x99, 0x93, 0x91, 0x8b, 0x88, 0x88, 0x8b, 0x8b, 0x91, 0x93, 0x9a, 0xac, 0xa9, 0x68, 0x6c, 0x72, 0x72, 0x71, 0x6d, 0x71, 0x6f, 0x6a, 0x86, 0xa8, 0xfa, 0x61, 0x00, 0x00, 0xeb, 0x00, 0xd5, 0xf5, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf5, 0xfa, 0xe7, 0xe3, 0xdd, 0xed, 0xd0, 0x87, 0xc9, 0x7f, 0x6a, 0x72, 0x72, 0x72, 0x72, 0x72, 0x76, 0x76, 0x76, 0x72, 0x8d, 0xc3, 0xae, 0xad, 0xb8, 0xb6, 0xb3, 0xb6, 0xc3, 0x93, 0x6a, 0x76, 0x01, 0x01, 0x7d, 0x01, 0x7d, 0x74, 0x7d, 0x77, 0x6c, 0x81, 0x99, 0xc3, 0xbb, 0x47, 0xb2, 0xac, 0xb0, 0xb6, 0xad, 0xb1, 0xc8, 0x5f, 0xef, 0xf7, 0xf8, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf8, 0x61, 0xc8, 0xb1, 0xb6, 0xb8, 0xae, 0xbb, 0xb7, 0xbb, 0xb7, 0xbf, 0x99, 0x6e, 0x6a, 0x6c, 0x6c, 0x73, 0x7b, 0x7b, 0x7b, 0x76, 0x7b, 0x66, 0x88, 0xb7, 0xc6, 0xba, 0xb6, 0xb6, 0xb6, 0xba, 0xb4, 0xc7, 0x99, 0x6c, 0x6c, 0x6f, 0x74, 0x73, 0x72, 0x74, 0x73, 0x72, 0x74, 0x68, 0x88, 0xd3, 0xd0, 0xed, 0xd0, 0xdc, 0xe3, 0xde, 0xe6, 0xf4, 0xf5, 0x60, 0x61, 0xd5, 0xd5, 0xd5, 0xff, 0x61, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xcd, 0xca, 0x8d, 0x6e, 0x6c, 0x72, 0x6f, 0x6f, 0x76, 0x6a, 0x83, 0x7c, 0x69, 0x6a, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6c, 0x6a, 0x6b, 0x8e, 0x78, 0x6c, 0x6f, 0x72, 0x6c, 0x71, 0x6c, 0x78, 0x68, 0x81, 0x95, 0xfa, 0x5f, 0xd5, 0xf7, 0xec, 0xd5, 0xd5, 0xd5, 0xcc, 0x61, 0x61, 0x00, 0x00, 0xd5, 0xec, 0xec, 0xe5, 0xe3, 0xdb, 0xd0, 0xd0, 0x98, 0x9c, 0x66, 0x71, 0x74, 0x72, 0x72, 0x72, 0x72, 0x76, 0x76, 0x76, 0x69, 0x99, 0xc3, 0xaf, 0xb6, 0xb3, 0xb8, 0xb3, 0xb6, 0xb7, 0xbb, 0x8b, 0x69, 0x01, 0x79, 0x01, 0x74, 0x70, 0x72, 0x6a, 0x6c, 0x91, 0x40, 0xc3, 0xb0, 0xae, 0xb2, 0xb2, 0x48, 0xb6, 0xb6, 0xaa, 0xc5, 0x5c, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xef, 0xef, 0xf8, 0x61, 0x54, 0x46, 0xb8, 0xb6, 0xbb, 0xae, 0xb7, 0xb7, 0xb7, 0xc6, 0xc3, 0x96, 0x86, 0x7a, 0x6a, 0x6b, 0x6c, 0x6b, 0x7e, 0x86, 0x9f, 0xc6, 0xbf, 0xb4, 0xb6, 0x4c, 0xbe, 0xb6, 0xb6, 0xbb, 0xbf, 0x81, 0x6c, 0x76, 0x72, 0x76, 0x76, 0x74, 0x73, 0x74, 0x74, 0x74, 0x6f, 0x67, 0x96, 0x87, 0xed, 0xed, 0xd8, 0xe3, 0xde, 0xde, 0xea, 0xf4, 0xf5, 0xff, 0xff, 0xd5, 0xff, 0x5f, 0x61, 0xff, 0xff, 0xff, 0xff, 0x61, 0x64, 0x9e, 0x7f, 0x6a, 0x77, 0x6f, 0x6f, 0x72, 0x74, 0x78, 0x69, 0x72, 0x6a, 0x69, 0x69, 0x6b, 0x69, 0x6a, 0x6a, 0x6b, 0x69, 0x69, 0x6d, 0x73, 0x69, 0x6f, 0x73, 0x6f, 0x72, 0x6f, 0x72, 0x72, 0x6f, 0x73, 0x6e, 0x84, 0xaa, 0xfa, 0x5f, 0xd5, 0xd5, 0xd5, 0xd5, 0x61, 0x61, 0xcc, 0x61, 0x61, 0xf4, 0xec, 0xf4, 0xe8, 0xdf, 0xdd, 0xd6, 0xd0, 0x67, 0x9a, 0x75, 0x6d, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73, 0x74, 0x76, 0x79, 0x6a, 0x94, 0xc6, 0xb7, 0xb3, 0xb3, 0xb8, 0xb6, 0xb3, 0xb2, 0xbf, 0xbf, 0x9c, 0x81, 0x7b, 0x74, 0x7b, 0x81, 0x8a, 0x98, 0x50, 0xc7, 0xbf, 0x47, 0xb4, 0xb2, 0x48, 0x4c, 0xae, 0xb3, 0x46, 0xbd, 0xca, 0x5f, 0xf8, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xef, 0x5b, 0xf1, 0xf3, 0xef, 0xf3, 0x5f, 0xca, 0xbd, 0x46, 0xb8, 0xb2, 0xba, 0xb7, 0xb7, 0xb2, 0xba, 0xba, 0xc7, 0xbb, 0xa7, 0x9c, 0x9a, 0x9a, 0x9f, 0x43, 0xc3, 0xc3, 0xb4, 0xb7, 0xba, 0xb6, 0xb7, 0xb6, 0xb3, 0xb7, 0x56, 0x93, 0x68, 0x6f, 0x74, 0x73, 0x72, 0x72, 0x73, 0x72, 0x73, 0x6f, 0x74, 0x79, 0x6c, 0x75, 0x98, 0x67, 0xed, 0xd6, 0xd2, 0xe2, 0xde, 0xe3, 0xf4, 0xf4, 0xff, 0xff, 0x5f, 0xcc, 0x60, 0xff, 0xff, 0x5b, 0x61, 0x5f, 0xfa, 0xc0, 0x92, 0x6b, 0x6b, 0x77, 0x6f, 0x6f, 0x72, 0x73, 0x6c, 0x6c, 0x69, 0x68, 0x75, 0x84, 0x88, 0x8f, 0x92, 0x92, 0x90, 0x8d, 0x84, 0x7e, 0x68, 0x68, 0x66, 0x6d, 0x6e, 0x73, 0x6a, 0x76, 0x6c, 0x6c, 0x78, 0x6a, 0x7a, 0x8d, 0xc8, 0xfa, 0xff, 0xd5, 0xd5, 0xeb, 0xff, 0x61, 0x61, 0xff, 0xf9, 0xec, 0xec, 0xe9, 0xe1, 0xe1, 0xdb, 0xd0, 0xd0, 0x90, 0x85, 0x6a, 0x6f, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x76, 0x76, 0x76, 0x74, 0x6c, 0x9d, 0xc7, 0xae, 0xaf, 0xb8, 0x4c, 0xb6, 0xb6, 0xb6, 0xba, 0xc3, 0x4e, 0xa6, 0xa5, 0xa6, 0xac, 0xc3, 0xc6, 0x4c, 0xb2, 0xb2, 0x4c, 0xab, 0xb6, 0xb6, 0x47, 0xb6, 0x46, 0xb1, 0x5a, 0x5f, 0xf8, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf2, 0xef, 0xd4, 0x5f, 0x5f, 0xbd, 0xad, 0xb8, 0xba, 0xb3, 0x4c, 0xb3, 0xb6, 0x4c, 0xb7, 0xba, 0xbe, 0xc6, 0xc7, 0xc7, 0xc2, 0xbe, 0xbe, 0xb7, 0xb7, 0xb7, 0xb6, 0xb8, 0xb6, 0xb8, 0xb2, 0xc7, 0x9a, 0x6a, 0x6c, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x77, 0x6c, 0x76, 0x6a, 0x7f, 0x8b, 0x65, 0xed, 0xd7, 0xe1, 0xde, 0xdd, 0xe4, 0xf4, 0xec, 0xf7, 0x60, 0x61, 0x60, 0xf7, 0x5f, 0xff, 0xcd, 0xcd, 0xc9, 0x92, 0x6e, 0x7a, 0x6f, 0x6a, 0x72, 0x6c, 0x73, 0x68, 0x6b, 0x81, 0x95, 0xa4, 0xc1, 0xca, 0x00, 0x61, 0x5f, 0xcc, 0xd5, 0x5b, 0x5b, 0xc8, 0xab, 0x9b, 0x8b, 0x6b, 0x68, 0x6d, 0x73, 0x6c, 0x74, 0x6f, 0x72, 0x72, 0x69, 0x75, 0x8d, 0x57, 0x64, 0xcd, 0x00, 0xf5, 0xd5, 0xf5, 0xf9, 0xec, 0xec, 0xf4, 0xe8, 0xdf, 0xdf, 0xdc, 0xd0, 0xd0, 0x84, 0x88, 0x68, 0x01, 0x77, 0x6f, 0x72, 0x72, 0x76, 0x74, 0x73, 0x74, 0x76, 0x78, 0x72, 0x72, 0x7a, 0xa6, 0xc2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb8, 0xb6, 0xb8, 0xb7, 0xba, 0xbf, 0xbf, 0xbf, 0xb7, 0xb7, 0xb6, 0x4c, 0xb6, 0x4c, 0xb6, 0xb6, 0x47, 0xb3, 0xb6, 0x46, 0xbd, 0x5a, 0x5f, 0xf8, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0x5b, 0xf3, 0xef, 0xf3, 0xf2, 0xeb, 0xd4, 0xf7, 0x5b, 0xb9, 0xb3, 0xb5, 0xbc, 0xb6, 0xba, 0xb7, 0x4c, 0xb4, 0xb7, 0xbc, 0xb6, 0xb6, 0xb8, 0xbb, 0xb8, 0xb6, 0xbc, 0xb6, 0xb7, 0xb6, 0xb6, 0xb8, 0xb6, 0xb8, 0xc3, 0x7e, 0x6c, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x69, 0x84, 0x7f, 0x65, 0x65, 0xda, 0xe1, 0xe0, 0xdd, 0xe4, 0xea, 0xec, 0xec, 0x00, 0x5f, 0xd5, 0x00, 0xec, 0x64, 0xc1, 0x95, 0x81, 0x6b, 0x6a, 0x6f, 0x74, 0x73, 0x73, 0x66, 0x84, 0xa1, 0xc8, 0x62, 0xcc, 0x58, 0xd3, 0xa4, 0x9b, 0x9b, 0x9b, 0x9e, 0x9e, 0xb1, 0x58, 0x61, 0xcc, 0x58, 0xaa, 0x84, 0x68, 0x6e, 0x72, 0x72, 0x6f, 0x72, 0x77, 0x6f, 0x6c, 0x75, 0x88, 0xa8, 0xc9, 0xfa, 0x64, 0xec, 0xec, 0xfa, 0xf4, 0xea, 0xe4, 0xd2, 0xdf, 0xd2, 0xd6, 0xd0, 0x7f, 0x86, 0x69, 0x77, 0x79, 0x74, 0x70, 0x6f, 0x72, 0x74, 0x72, 0x72, 0x76, 0x76, 0x76, 0x7d, 0x74, 0x72, 0x88, 0xc3, 0xbe, 0xb3, 0xb6, 0xb6, 0xb8, 0xb5, 0xb5, 0xb8, 0xba, 0xb7, 0x4c, 0xb7, 0xb7, 0xb8, 0xb6, 0xb6, 0xb6, 0x4c, 0xb5, 0xb3, 0xb5, 0xad, 0x46, 0xb9, 0xca, 0xff, 0xf8, 0xf3, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf0, 0xef, 0xf0, 0xf3, 0xeb, 0xf7, 0x5c, 0xc4, 0x46, 0xb5, 0x4f, 0xbc, 0xba, 0xba, 0xbb, 0xb7, 0xb6, 0xbc, 0xbc, 0xb8, 0xbc, 0xb8, 0xb8, 0xbc, 0xb8, 0xb6, 0xb8, 0xb3, 0xb8, 0xaf, 0xc7, 0x94, 0x66, 0x74, 0x74, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x76, 0x71, 0x6c, 0x72, 0x6f, 0x71, 0x68, 0x75, 0x6b, 0x6b, 0x65, 0x75, 0xd2, 0xe0, 0xdd, 0xe0, 0xe6, 0xe9, 0xea, 0xf4, 0xd5, 0xea, 0xc1, 0x9b, 0x8c, 0x75, 0x6e, 0x6f, 0x6f, 0x6f, 0x72, 0x6a, 0x66, 0x94, 0xcb, 0xfa, 0x58, 0x9e, 0xd1, 0xd7, 0xed, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xed, 0xf6, 0xd7, 0xce, 0xa8, 0x00, 0x5b, 0x5b, 0x90, 0x68, 0x6a, 0x72, 0x74, 0x6f, 0x6c, 0x74, 0x6d, 0x6d, 0x6b, 0x75, 0x8d, 0x9b, 0xa8, 0xd3, 0xd3, 0xe6, 0xe4, 0xdd, 0xd2, 0xe0, 0xd1, 0x67, 0x67, 0x7e, 0x81, 0x6a, 0x71, 0x71, 0x73, 0x6f, 0x72, 0x72, 0x72, 0x73, 0x74, 0x73, 0x74, 0x76, 0x76, 0x77, 0x79, 0x72, 0x66, 0x9a, 0xc3, 0xb8, 0xb8, 0x4c, 0xb8, 0xb5, 0xb5, 0xba, 0xb8, 0xba, 0xb6, 0xb8, 0xb6, 0xb8, 0xb7, 0xb6, 0xb6, 0xb6, 0xb3, 0xb5, 0xad, 0xb1, 0xc5, 0x5c, 0xf9, 0x5b, 0xef, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0x5b, 0xf3, 0xf3, 0xef, 0xeb, 0xef, 0xef, 0xef, 0xef, 0x5b, 0x5c, 0x5a, 0xb9, 0xb5, 0xb6, 0xb6, 0x4c, 0x4e, 0xb7, 0x4f, 0xb8, 0xb8, 0xb8, 0xbc, 0xba, 0xbc, 0xb8, 0xb8, 0xb6, 0xb6, 0xb8, 0xb6, 0xc2, 0xa9, 0x7e, 0x6a, 0x7c, 0x6c, 0x72, 0x73, 0x72, 0x71, 0x72, 0x73, 0x6f, 0x72, 0x6f, 0x6f, 0x76, 0x6f, 0x6f, 0x76, 0x71, 0x6b, 0x75, 0x75, 0x7b, 0x6e, 0x67, 0xda, 0xdc, 0xe0, 0xd2, 0xe0, 0xe0, 0xe0, 0xcf, 0xcf, 0x8c, 0x87, 0x6b, 0x75, 0x6b, 0x78, 0x6f, 0x6f, 0x74, 0x68, 0x94, 0x64, 0x62, 0x5f, 0xf5, 0x9e, 0xd1, 0xf6, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xed, 0xed, 0xd0, 0xd0, 0xd0, 0xd0, 0x9b, 0xef, 0xcb, 0x5c, 0x88, 0x69, 0x72, 0x72, 0x74, 0x74, 0x6f, 0x77, 0x6f, 0x71, 0x6d, 0x69, 0x75, 0x84, 0xd1, 0xce, 0xd2, 0xd2, 0xd2, 0xd1, 0xd9, 0x67, 0x75, 0x7a, 0x74, 0x6f, 0x6f, 0x71, 0x7a, 0x6d, 0x6d, 0x71, 0x72, 0x72, 0x73, 0x72, 0x73, 0x76, 0x77, 0x74, 0x79, 0x77, 0x7c, 0x6c, 0x83, 0xaf, 0xba, 0xba, 0xb6, 0xb8, 0xb5, 0xb8, 0xb8, 0x4c, 0xb8, 0xb7, 0xb8, 0xb8, 0xb8, 0xb6, 0xb6, 0xb6, 0xb3, 0xb5, 0xb5, 0xbd, 0x58, 0x5c, 0x5b, 0xf9, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0x5b, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xef, 0xf3, 0xf3, 0xf3, 0xf1, 0xff, 0x5b, 0x54, 0xb9, 0xb8, 0xb5, 0xb8, 0xbc, 0xb8, 0xbc, 0xb8, 0xb8, 0xbb, 0xbc, 0xb7, 0x4c, 0xba, 0xb8, 0xb6, 0xb7, 0xb2, 0x56, 0x94, 0x6a, 0x74, 0x6f, 0x77, 0x74, 0x72, 0x71, 0x71, 0x71, 0x71, 0x6f, 0x6f, 0x72, 0x71, 0x6f, 0x74, 0x72, 0x71, 0x6f, 0x71, 0x6f, 0x6f, 0x70, 0x74, 0x6d, 0x6d, 0x69, 0x75, 0x7f, 0x83, 0x84, 0x83, 0x81, 0x7a, 0x71, 0x69, 0x6d, 0x6d, 0x6f, 0x6f, 0x6f, 0x6f, 0x6a, 0x81, 0xcc, 0xcd, 0xd5, 0xf5, 0xf5, 0x64, 0xfa, 0xeb, 0xb1, 0xee, 0xce, 0xda, 0xd9, 0x67, 0xed, 0xf6, 0xd7, 0x8c, 0x9b, 0xc1, 0xc1, 0x5f, 0x64, 0xad, 0x6e, 0x6d, 0x72, 0x6f, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x69, 0x6a, 0x69, 0x7a, 0x71, 0x6d, 0x69, 0x6b, 0x71, 0x71, 0x6f, 0x6c, 0x6f, 0x6f, 0x6f, 0x71, 0x71, 0x72, 0x72, 0x72, 0x71, 0x71, 0x71, 0x71, 0x74, 0x77, 0x77, 0x77, 0x74, 0x74, 0x79, 0x6a, 0x96, 0x56, 0xba, 0xb8, 0xb7, 0xb5, 0xb8, 0xb8, 0xb8, 0xba, 0x4c, 0xb6, 0xb6, 0xb3, 0xb7, 0xb8, 0xb3, 0xb5, 0xb5, 0xc5, 0x5f, 0x5b, 0xf8, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf8, 0xf1, 0xf9, 0x5c, 0x60, 0x57, 0xc5, 0x4f, 0x4f, 0xb5, 0xb9, 0xb8, 0x4f, 0xbc, 0xb8, 0xbc, 0xba, 0xbc, 0xb8, 0xb6, 0xb7, 0xbe, 0xbb, 0x7b, 0x6c, 0x74, 0x77, 0x77, 0x72, 0x73, 0x73, 0x71, 0x71, 0x71, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x74, 0x74, 0x74, 0x74, 0x71, 0x71, 0x6e, 0x6d, 0x6b, 0x6c, 0x6c, 0x6a, 0x72, 0x70, 0x73, 0x6c, 0x72, 0x72, 0x6f, 0x6f, 0x72, 0x69, 0x94, 0xfa, 0xff, 0xd5, 0xf5, 0xf5, 0x61, 0xcd, 0xcd, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xec, 0x64, 0x64, 0xfa, 0xfa, 0xfa, 0xf4, 0xf5, 0xf5, 0xcc, 0x62, 0x86, 0x69, 0x74, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6f, 0x74, 0x71, 0x6f, 0x6c, 0x6d, 0x6a, 0x6d, 0x71, 0x6f, 0x6f, 0x6f, 0x72, 0x76, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x74, 0x73, 0x73, 0x73, 0x76, 0x76, 0x77, 0x77, 0x79, 0x76, 0x76, 0x79, 0x6c, 0x7e, 0xc6, 0xba, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0x4c, 0x4f, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xb8, 0xc0, 0x58, 0x60, 0x5b, 0xf9, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0x5b, 0xf9, 0xf8, 0x5b, 0x5c, 0x5c, 0xca, 0xc9, 0x54, 0x55, 0xbd, 0xbd, 0xb8, 0xb8, 0xc0, 0xb8, 0xb8, 0xbc, 0xb3, 0xba, 0xbf, 0xa1, 0x66, 0x7b, 0x6f, 0x74, 0x77, 0x72, 0x74, 0x72, 0x73, 0x76, 0x76, 0x74, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x79, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x72, 0x76, 0x71, 0x6d, 0x6c, 0x6c, 0x6c, 0x72, 0x72, 0x72, 0x72, 0x6f, 0x71, 0x6f, 0x6f, 0x6f, 0x78, 0x66, 0x9a, 0x64, 0xff, 0xd5, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xd5, 0x00, 0xcd, 0xcd, 0xcd, 0xd5, 0xf5, 0xd5, 0xf5, 0xec, 0x00, 0xd5, 0x5d, 0x64, 0x86, 0x68, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6c, 0x6c, 0x6f, 0x76, 0x76, 0x72, 0x72, 0x01, 0x74, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x79, 0x70, 0x74, 0x74, 0x76, 0x76, 0x72, 0x77, 0x74, 0x77, 0x74, 0x77, 0x74, 0x74, 0x6a, 0xa5, 0xc2, 0xb3, 0xbc, 0xbc, 0xb8, 0xbe, 0xc5, 0x4f, 0xbd, 0xc0, 0xc5, 0xc5, 0x57, 0x5b, 0x5c, 0x5c, 0x5b, 0x5b, 0xf8, 0xf9, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf9, 0xf7, 0xf3, 0xf7, 0xf7, 0x5b, 0xf1, 0xf9, 0xf9, 0x5c, 0x5b, 0x5b, 0xcb, 0x5b, 0x5a, 0x5d, 0xc0, 0x4f, 0x4f, 0xb7, 0xba, 0xc2, 0x90, 0x69, 0x7b, 0x72, 0x77, 0x74, 0x74, 0x72, 0x74, 0x74, 0x70, 0x70, 0x79, 0x01, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x02, 0x02, 0x70, 0x70, 0x70, 0x72, 0x6f, 0x71, 0x71, 0x76, 0x76, 0x72, 0x72, 0x6c, 0x72, 0x6f, 0x6f, 0x6f, 0x72, 0x6d, 0x69, 0x8d, 0x64, 0x61, 0xf5, 0xf5, 0xf5, 0xf5, 0x00, 0xf5, 0x00, 0xcd, 0x00, 0xff, 0xd5, 0xf5, 0x00, 0xcd, 0xf5, 0xec, 0xf5, 0xd5, 0xf5, 0x5b, 0x64, 0xb3, 0x6b, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6f, 0x6c, 0x72, 0x72, 0x70, 0x70, 0x6f, 0x70, 0x74, 0x01, 0x01, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x01, 0x79, 0x70, 0x77, 0x73, 0x74, 0x76, 0x74, 0x76, 0x76, 0x79, 0x7b, 0x68, 0x91, 0x56, 0xbc, 0xb8, 0xb8, 0xb8, 0x55, 0x60, 0x5c, 0x5c, 0xf9, 0xff, 0xff, 0xd5, 0x5b, 0xf8, 0xf3, 0xf7, 0xf7, 0xf9, 0xf3, 0x5b, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf7, 0xf3, 0xf3, 0xf8, 0xf3, 0xf1, 0xf7, 0xf3, 0xf1, 0xef, 0xf3, 0x5b, 0xf8, 0xf3, 0x5b, 0x5b, 0x5c, 0xc0, 0xb5, 0xb8, 0xbc, 0xb7, 0xbe, 0x83, 0x6c, 0x72, 0x74, 0x74, 0x74, 0x74, 0x74, 0x79, 0x70, 0x79, 0x01, 0x05, 0x05, 0x05, 0x09, 0x05, 0x09, 0x05, 0x09, 0x05, 0x09, 0x05, 0x08, 0x0a, 0x0a, 0x02, 0x02, 0x74, 0x74, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x73, 0x73, 0x73, 0x72, 0x71, 0x72, 0x71, 0x6f, 0x6f, 0x6e, 0x7a, 0xb8, 0x64, 0x00, 0xff, 0xf5, 0xf5, 0x00, 0x00, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf5, 0xf5, 0xec, 0xf7, 0xec, 0x5c, 0xcd, 0x63, 0x8d, 0x6b, 0x6d, 0x74, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6f, 0x6c, 0x6f, 0x74, 0x72, 0x70, 0x70, 0x70, 0x01, 0x7d, 0x05, 0x05, 0x08, 0x09, 0x09, 0x09, 0x08, 0x05, 0x08, 0x09, 0x09, 0x08, 0x05, 0x02, 0x01, 0x74, 0x74, 0x76, 0x73, 0x77, 0x74, 0x74, 0x79, 0x74, 0x70, 0x86, 0xba, 0xc4, 0xb8, 0xbb, 0xb5, 0xc4, 0x5c, 0x5b, 0x5b, 0xf3, 0xef, 0xf3, 0xf1, 0xf1, 0xf7, 0xf1, 0x5b, 0xf3, 0xf3, 0xf8, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf1, 0xf3, 0xef, 0xef, 0xf2, 0xf3, 0xf3, 0x5b, 0x5c, 0xbd, 0x4f, 0xb8, 0xbc, 0xba, 0xa9, 0x7a, 0x6c, 0x76, 0x72, 0x74, 0x70, 0x77, 0x79, 0x70, 0x01, 0x02, 0x09, 0x0a, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0a, 0x05, 0x02, 0x01, 0x70, 0x6f, 0x6f, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x7c, 0x71, 0x6b, 0x86, 0xcb, 0x62, 0x61, 0x5f, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf5, 0xeb, 0x00, 0x5f, 0x61, 0x64, 0x9c, 0x66, 0x73, 0x73, 0x72, 0x73, 0x72, 0x72, 0x6f, 0x74, 0x6f, 0x6f, 0x6c, 0x6f, 0x72, 0x6f, 0x70, 0x70, 0x79, 0x02, 0x05, 0x05, 0x09, 0x07, 0x08, 0x08, 0x05, 0x07, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0a, 0x02, 0x79, 0x70, 0x74, 0x74, 0x76, 0x74, 0x79, 0x7b, 0x6c, 0x81, 0xb2, 0xbe, 0xbc, 0xba, 0x4f, 0xc0, 0x5f, 0xf8, 0xf1, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xef, 0xf0, 0xf0, 0xf1, 0xf3, 0x5c, 0xbd, 0xb8, 0x4c, 0xbc, 0xc2, 0x9d, 0x69, 0x73, 0x72, 0x74, 0x74, 0x74, 0x70, 0x01, 0x79, 0x05, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x08, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x05, 0x79, 0x70, 0x76, 0x76, 0x72, 0x72, 0x72, 0x74, 0x71, 0x72, 0x71, 0x72, 0x6f, 0x71, 0x73, 0x71, 0x66, 0x90, 0x5d, 0x64, 0x61, 0xcd, 0xff, 0x00, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf5, 0xd5, 0x62, 0xfa, 0x9d, 0x6b, 0x73, 0x71, 0x74, 0x76, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6c, 0x72, 0x71, 0x74, 0x6c, 0x74, 0x01, 0x05, 0x05, 0x0a, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x07, 0x08, 0x09, 0x0a, 0x02, 0x79, 0x70, 0x79, 0x74, 0x76, 0x79, 0x76, 0x70, 0x73, 0x42, 0xbe, 0xbc, 0xba, 0x4f, 0xc0, 0x5f, 0xef, 0xef, 0xf1, 0xf3, 0xf3, 0xf1, 0xf1, 0xf3, 0xf1, 0xf1, 0xf3, 0xef, 0xf9, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xf3, 0x5c, 0x4f, 0x4f, 0xb8, 0x4c, 0xc7, 0x9a, 0x68, 0x72, 0x73, 0x74, 0x74, 0x79, 0x70, 0x70, 0x05, 0x08, 0x08, 0x07, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x08, 0x0a, 0x05, 0x79, 0x70, 0x6c, 0x73, 0x72, 0x73, 0x72, 0x72, 0x6f, 0x72, 0x6f, 0x73, 0x72, 0x78, 0x78, 0x73, 0x68, 0x84, 0x59, 0xfa, 0xff, 0x00, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0x00, 0xf5, 0xf3, 0xcd, 0xcd, 0x64, 0xa4, 0x66, 0x6e, 0x72, 0x79, 0x7c, 0x74, 0x76, 0x72, 0x76, 0x72, 0x74, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x72, 0x01, 0x82, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x09, 0x0a, 0x02, 0x01, 0x74, 0x76, 0x74, 0x79, 0x7b, 0x72, 0x6b, 0xa9, 0xbe, 0x4f, 0xbc, 0xb9, 0xc0, 0xf7, 0xf8, 0xef, 0xf3, 0x5b, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0x5b, 0xf3, 0x5b, 0x5b, 0x5b, 0xef, 0xf0, 0xf2, 0xf0, 0xef, 0xf3, 0x5c, 0xc0, 0xba, 0xbc, 0x4c, 0xc7, 0x98, 0x69, 0x73, 0x74, 0x74, 0x74, 0x70, 0x79, 0x7d, 0x09, 0x05, 0x07, 0x07, 0x07, 0x0b, 0x0b, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0b, 0x0b, 0x07, 0x07, 0x09, 0x0a, 0x03, 0x70, 0x70, 0x73, 0x72, 0x72, 0x72, 0x71, 0x73, 0x72, 0x71, 0x6f, 0x76, 0x78, 0x78, 0x6f, 0x7c, 0x6a, 0x75, 0xa1, 0x64, 0x64, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xd5, 0xfa, 0xcd, 0x5c, 0x92, 0x6b, 0x73, 0x73, 0x7d, 0x72, 0x74, 0x76, 0x74, 0x76, 0x72, 0x73, 0x72, 0x72, 0x6f, 0x6c, 0x76, 0x6f, 0x74, 0x80, 0x0a, 0x05, 0x08, 0x07, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x0b, 0x0b, 0x07, 0x08, 0x09, 0x09, 0x01, 0x79, 0x77, 0x76, 0x79, 0x73, 0x79, 0x6e, 0x41, 0xbc, 0xba, 0x4f, 0xb8, 0xc1, 0x5f, 0xef, 0xef, 0xf3, 0x5b, 0x5c, 0xf3, 0x5b, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xef, 0xf2, 0xf1, 0xef, 0x5b, 0x5c, 0x4f, 0xb8, 0x4f, 0x4f, 0xc2, 0x96, 0x68, 0x72, 0x73, 0x72, 0x74, 0x79, 0x01, 0x05, 0x05, 0x07, 0x07, 0x0b, 0x0b, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0b, 0x0b, 0x0b, 0x0b, 0x07, 0x0a, 0x0a, 0x01, 0x70, 0x72, 0x73, 0x6c, 0x6e, 0x73, 0x6f, 0x6a, 0x7d, 0x6a, 0x71, 0x76, 0x73, 0x74, 0x73, 0x73, 0x6e, 0x66, 0x92, 0xc4, 0xfa, 0xfa, 0xcd, 0xcd, 0x00, 0xff, 0xcd, 0x64, 0xfa, 0x62, 0xa1, 0x84, 0x68, 0x73, 0x7a, 0x77, 0x72, 0x78, 0x6f, 0x79, 0x72, 0x78, 0x71, 0x6c, 0x6d, 0x73, 0x70, 0x6c, 0x72, 0x6c, 0x01, 0x05, 0x09, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x08, 0x0b, 0x08, 0x08, 0x09, 0x0a, 0x05, 0x74, 0x74, 0x77, 0x79, 0x74, 0x70, 0x73, 0xa9, 0xc2, 0xba, 0xbc, 0xb8, 0xc0, 0x5f, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0x5b, 0x5b, 0x60, 0xbd, 0xb9, 0x4f, 0xba, 0xc4, 0x96, 0x68, 0x72, 0x72, 0x72, 0x72, 0x79, 0x01, 0x05, 0x09, 0x08, 0x0b, 0x07, 0x0b, 0x07, 0x08, 0x0b, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0b, 0x08, 0x0b, 0x0b, 0x0c, 0x09, 0x09, 0x02, 0x70, 0x72, 0x76, 0x73, 0x6c, 0x6b, 0x7e, 0x7e, 0x6c, 0x77, 0x73, 0x73, 0x73, 0x74, 0x73, 0x74, 0x73, 0x78, 0x68, 0x68, 0x8d, 0xaa, 0xcb, 0xfa, 0x64, 0x61, 0x64, 0xc0, 0x97, 0x7e, 0x69, 0x69, 0x7c, 0x7c, 0x77, 0x78, 0x79, 0x78, 0x79, 0x79, 0x7c, 0x6a, 0x76, 0x81, 0x6c, 0x69, 0x70, 0x7b, 0x71, 0x70, 0x02, 0x08, 0x07, 0x0b, 0x0b, 0x07, 0x09, 0x08, 0x07, 0x08, 0x08, 0x08, 0x07, 0x07, 0x08, 0x0c, 0x08, 0x09, 0x09, 0x09, 0x08, 0x08, 0x0c, 0x08, 0x09, 0x05, 0x01, 0x77, 0x74, 0x77, 0x74, 0x79, 0x7e, 0xac, 0xbb, 0xbc, 0x50, 0xb8, 0x55, 0x5f, 0xf7, 0xef, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0x5b, 0x5c, 0xc0, 0x4f, 0xb8, 0xb8, 0xc7, 0x96, 0x68, 0x70, 0x73, 0x72, 0x73, 0x79, 0x01, 0x08, 0x09, 0x08, 0x0b, 0x0b, 0x0b, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x0a, 0x02, 0x79, 0x70, 0x72, 0x6c, 0x73, 0x7e, 0x9f, 0x93, 0x6a, 0x6c, 0x78, 0x73, 0x76, 0x74, 0x74, 0x79, 0x78, 0x6c, 0x73, 0x71, 0x68, 0x6b, 0x84, 0x9e, 0xcb, 0x5c, 0x98, 0x75, 0x68, 0x6b, 0x73, 0x7b, 0x76, 0x74, 0x79, 0x79, 0x78, 0x78, 0x74, 0x77, 0x74, 0x78, 0x68, 0x9f, 0x8b, 0x88, 0x73, 0x6c, 0x72, 0x70, 0x05, 0x05, 0x07, 0x07, 0x0b, 0x07, 0x07, 0x08, 0x07, 0x0b, 0x07, 0x0b, 0x07, 0x07, 0x0c, 0x09, 0x0c, 0x09, 0x08, 0x08, 0x0c, 0x08, 0x0c, 0x09, 0x09, 0x0a, 0x01, 0x77, 0x74, 0x77, 0x79, 0x72, 0x81, 0xbb, 0xba, 0xbe, 0xbe, 0x4f, 0x55, 0x5f, 0xef, 0xf2, 0xf2, 0xf2, 0xf7, 0xef, 0xf3, 0xef, 0xf1, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf7, 0xf8, 0x5c, 0x54, 0xb5, 0xb8, 0xb8, 0xc7, 0x9a, 0x69, 0x72, 0x72, 0x72, 0x72, 0x79, 0x01, 0x05, 0x08, 0x0b, 0x07, 0x0b, 0x0b, 0x0b, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0b, 0x0c, 0x0b, 0x0b, 0x0c, 0x08, 0x08, 0x09, 0x02, 0x70, 0x70, 0x70, 0x70, 0x7e, 0x83, 0xa7, 0x50, 0x6e, 0x73, 0x71, 0x74, 0x74, 0x77, 0x77, 0x72, 0x7d, 0x79, 0x78, 0x77, 0x77, 0x7b, 0x68, 0x66, 0x9a, 0x9c, 0x66, 0x6e, 0x76, 0x7b, 0x7b, 0x74, 0x77, 0x79, 0x77, 0x77, 0x79, 0x78, 0x73, 0x78, 0x76, 0x68, 0x8b, 0xc3, 0x7c, 0x81, 0x7c, 0x6d, 0x74, 0x70, 0x05, 0x08, 0x07, 0x0b, 0x0b, 0x07, 0x0b, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0c, 0x0c, 0x08, 0x0b, 0x0c, 0x0b, 0x0b, 0x0c, 0x08, 0x09, 0x09, 0x79, 0x74, 0x77, 0x74, 0x74, 0x6c, 0x88, 0xc3, 0xbe, 0xbe, 0xbc, 0x4f, 0x58, 0x5f, 0xef, 0xf2, 0xf2, 0xf1, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf8, 0x5f, 0x54, 0xb9, 0xb5, 0xba, 0xc2, 0x9d, 0x6a, 0x6c, 0x73, 0x72, 0x73, 0x74, 0x79, 0x05, 0x05, 0x07, 0x07, 0x0b, 0x0b, 0x07, 0x0b, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0c, 0x0b, 0x0c, 0x0b, 0x07, 0x09, 0x05, 0x01, 0x70, 0x77, 0x79, 0x70, 0x72, 0x6a, 0x73, 0xcb, 0x94, 0x68, 0x73, 0x76, 0x77, 0x77, 0x77, 0x7d, 0x74, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x6a, 0x94, 0x9d, 0x69, 0x79, 0x76, 0x74, 0x73, 0x78, 0x79, 0x77, 0x79, 0x7d, 0x77, 0x78, 0x73, 0x78, 0x6c, 0x73, 0x4d, 0x96, 0x68, 0x6a, 0x72, 0x71, 0x77, 0x70, 0x02, 0x09, 0x07, 0x07, 0x0b, 0x0b, 0x07, 0x0b, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0c, 0x09, 0x0b, 0x0c, 0x07, 0x0c, 0x07, 0x08, 0x09, 0x09, 0x05, 0x79, 0x74, 0x77, 0x74, 0x74, 0x69, 0x94, 0xc3, 0xbe, 0xbc, 0xbc, 0xbd, 0x5a, 0xf7, 0xef, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0xf3, 0xf2, 0xef, 0xf7, 0x5f, 0xc8, 0xbd, 0x4f, 0xb5, 0xbe, 0xa9, 0x6e, 0x70, 0x74, 0x72, 0x6f, 0x70, 0x79, 0x01, 0x09, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0b, 0x0c, 0x0b, 0x0b, 0x07, 0x0a, 0x02, 0x70, 0x74, 0x70, 0x70, 0x74, 0x70, 0x6c, 0x66, 0x98, 0x63, 0x6b, 0x6d, 0x71, 0x76, 0x74, 0x77, 0x77, 0x79, 0x79, 0x78, 0x77, 0x77, 0x72, 0x74, 0x6a, 0x90, 0x9f, 0x74, 0x6f, 0x74, 0x78, 0x76, 0x74, 0x77, 0x77, 0x77, 0x74, 0x7c, 0x7a, 0x78, 0x75, 0x66, 0x9d, 0x59, 0x70, 0x6a, 0x6d, 0x6f, 0x6f, 0x74, 0x6f, 0x02, 0x0a, 0x08, 0x07, 0x0c, 0x0c, 0x0b, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x08, 0x08, 0x0a, 0x02, 0x79, 0x6f, 0x74, 0x78, 0x70, 0x69, 0x9d, 0xc7, 0xbc, 0x4f, 0x4c, 0xc0, 0xcb, 0xf7, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0x5f, 0xca, 0xb9, 0xb9, 0xba, 0xbe, 0x4e, 0x83, 0x6c, 0x6c, 0x6c, 0x74, 0x72, 0x70, 0x79, 0x02, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x0b, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0c, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0a, 0x01, 0x70, 0x74, 0x70, 0x72, 0x70, 0x72, 0x73, 0x6c, 0x6e, 0x55, 0xaa, 0x75, 0x6b, 0x73, 0x7b, 0x7b, 0x79, 0x77, 0x77, 0x76, 0x6f, 0x7d, 0x76, 0x7b, 0x68, 0x91, 0xbc, 0x68, 0x76, 0x76, 0x73, 0x76, 0x7c, 0x78, 0x79, 0x7d, 0x7e, 0x72, 0x73, 0x7a, 0x68, 0x92, 0x63, 0x20, 0x66, 0x70, 0x6c, 0x71, 0x6f, 0x77, 0x70, 0x01, 0x05, 0x0a, 0x08, 0x07, 0x07, 0x07, 0x0c, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0c, 0x09, 0x0b, 0x0b, 0x0c, 0x07, 0x07, 0x08, 0x0a, 0x05, 0x01, 0x74, 0x72, 0x72, 0x79, 0x72, 0x73, 0xba, 0xbe, 0xbc, 0x4f, 0xb9, 0xc5, 0x5b, 0xf3, 0xf2, 0xf0, 0xf2, 0xef, 0xf7, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf1, 0x5b, 0xf9, 0xf3, 0xf1, 0xf1, 0xf7, 0xf3, 0xf7, 0x5b, 0xc1, 0xb8, 0xbe, 0xba, 0xc3, 0x8e, 0x6a, 0x7b, 0x72, 0x76, 0x72, 0x72, 0x74, 0x01, 0x02, 0x09, 0x09, 0x07, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x07, 0x08, 0x0a, 0x01, 0x70, 0x72, 0x6d, 0x72, 0x6f, 0x6f, 0x6f, 0x73, 0x6a, 0x6b, 0x86, 0xfa, 0xa7, 0x6e, 0x68, 0x6b, 0x73, 0x7b, 0x73, 0x73, 0x76, 0x7a, 0x7e, 0x6e, 0x66, 0x6b, 0xaa, 0x64, 0x8d, 0x66, 0x6e, 0x7a, 0x7b, 0x73, 0x79, 0x76, 0x74, 0x71, 0x7e, 0x6b, 0x66, 0x98, 0x64, 0x9a, 0x68, 0x72, 0x6f, 0x72, 0x6f, 0x71, 0x70, 0x77, 0x70, 0x01, 0x05, 0x0a, 0x08, 0x08, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0c, 0x0c, 0x08, 0x08, 0x0b, 0x08, 0x09, 0x0a, 0x05, 0x7d, 0x70, 0x74, 0x73, 0x76, 0x74, 0x69, 0x89, 0x59, 0xb7, 0xbc, 0x4f, 0x4f, 0x57, 0x5b, 0xef, 0xf2, 0xf2, 0xf2, 0xf3, 0x5b, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xf1, 0xf7, 0xf1, 0xf1, 0xf2, 0x5b, 0xd5, 0xc8, 0xb9, 0xbc, 0xba, 0xc3, 0x9f, 0x68, 0x6f, 0x74, 0x6c, 0x73, 0x73, 0x73, 0x70, 0x01, 0x02, 0x07, 0x08, 0x09, 0x05, 0x0b, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0b, 0x07, 0x07, 0x08, 0x09, 0x08, 0x05, 0x02, 0x70, 0x74, 0x73, 0x71, 0x6d, 0x71, 0x6f, 0x6f, 0x6f, 0x71, 0x6d, 0x65, 0x9c, 0xfa, 0xcb, 0x95, 0x81, 0x6e, 0x6b, 0x6b, 0x6a, 0x6b, 0x68, 0x68, 0x75, 0x88, 0x46, 0xfa, 0x5c, 0x5c, 0x8d, 0x6b, 0x68, 0x69, 0x6c, 0x6a, 0x6c, 0x6a, 0x6a, 0x6b, 0x8b, 0xa4, 0xfa, 0x42, 0x66, 0x6a, 0x6f, 0x6f, 0x6f, 0x73, 0x73, 0x72, 0x77, 0x70, 0x79, 0x02, 0x05, 0x05, 0x09, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x0b, 0x09, 0x0c, 0x08, 0x08, 0x08, 0x09, 0x09, 0x05, 0x7d, 0x70, 0x74, 0x72, 0x76, 0x74, 0x72, 0x72, 0x9d, 0xc6, 0xba, 0xc0, 0x4f, 0xbd, 0x5a, 0xff, 0xd4, 0xf2, 0xf0, 0xf2, 0xef, 0xf7, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf8, 0xf7, 0xca, 0xb9, 0xba, 0xbc, 0xc3, 0x4e, 0x7b, 0x6a, 0x7b, 0x6f, 0x6d, 0x71, 0x73, 0x79, 0x70, 0x01, 0x02, 0x02, 0x0a, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x09, 0x0a, 0x09, 0x02, 0x01, 0x70, 0x01, 0x72, 0x6d, 0x71, 0x71, 0x6d, 0x6f, 0x71, 0x6f, 0x71, 0x71, 0x6d, 0x6b, 0x42, 0xfa, 0x64, 0xcb, 0xa8, 0x9c, 0x95, 0x92, 0x92, 0x98, 0x9e, 0xbd, 0xcd, 0xfa, 0xcd, 0x5f, 0x64, 0x64, 0xaa, 0x95, 0x90, 0x86, 0x88, 0x8b, 0x90, 0x98, 0xb3, 0x5d, 0xfa, 0xc2, 0x81, 0x66, 0x71, 0x6f, 0x6f, 0x73, 0x72, 0x73, 0x72, 0x72, 0x74, 0x70, 0x70, 0x01, 0x02, 0x05, 0x0a, 0x09, 0x0c, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0c, 0x09, 0x09, 0x09, 0x0a, 0x08, 0x05, 0x01, 0x74, 0x72, 0x73, 0x76, 0x73, 0x72, 0x6c, 0x83, 0xb4, 0xbf, 0xbc, 0xbc, 0x4f, 0xbd, 0x5c, 0xf3, 0xef, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xc0, 0xb9, 0xbc, 0xbe, 0x56, 0x94, 0x6a, 0x73, 0x72, 0x78, 0x73, 0x72, 0x73, 0x72, 0x74, 0x70, 0x70, 0x01, 0x7e, 0x05, 0x05, 0x09, 0x0a, 0x0a, 0x0a, 0x05, 0x08, 0x05, 0x80, 0x7d, 0x73, 0x6f, 0x70, 0x72, 0x6f, 0x72, 0x6f, 0x6f, 0x72, 0x72, 0x6f, 0x72, 0x6f, 0x72, 0x71, 0x6c, 0x6a, 0x6b, 0xc5, 0x62, 0x61, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xcd, 0xf5, 0xf5, 0x00, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0x64, 0x64, 0x55, 0x7b, 0x68, 0x6f, 0x73, 0x6c, 0x72, 0x72, 0x70, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x76, 0x7e, 0x05, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x82, 0x04, 0x80, 0x70, 0x70, 0x77, 0x74, 0x77, 0x74, 0x74, 0x77, 0x76, 0x68, 0x9c, 0xc7, 0xbc, 0xbe, 0xb8, 0xbd, 0x58, 0xf2, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf1, 0xef, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf7, 0xc8, 0xb5, 0x4f, 0xbc, 0xc3, 0xa9, 0x7b, 0x6d, 0x73, 0x6d, 0x72, 0x73, 0x72, 0x73, 0x74, 0x74, 0x74, 0x70, 0x70, 0x70, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x70, 0x70, 0x74, 0x70, 0x72, 0x74, 0x72, 0x6f, 0x71, 0x6f, 0x72, 0x6c, 0x6f, 0x6f, 0x6f, 0x71, 0x72, 0x6f, 0x6f, 0x6c, 0x69, 0x86, 0x5c, 0xcd, 0xeb, 0xeb, 0xd5, 0x00, 0x61, 0x61, 0x61, 0x5f, 0x61, 0x62, 0x62, 0x63, 0x63, 0x62, 0x61, 0x61, 0x00, 0xcd, 0x00, 0x00, 0x5b, 0xcd, 0x62, 0xca, 0x86, 0x66, 0x76, 0x6c, 0x6c, 0x72, 0x72, 0x72, 0x70, 0x70, 0x72, 0x72, 0x72, 0x72, 0x72, 0x76, 0x72, 0x72, 0x72, 0x70, 0x01, 0x01, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x01, 0x74, 0x70, 0x74, 0x74, 0x74, 0x77, 0x74, 0x77, 0x74, 0x7c, 0x6a, 0x7e, 0xc6, 0xbe, 0xba, 0xbc, 0xb8, 0xc5, 0xef, 0xf7, 0xd4, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xcb, 0xbd, 0x4f, 0x4f, 0xbb, 0xc7, 0x96, 0x66, 0x7b, 0x71, 0x73, 0x72, 0x73, 0x73, 0x70, 0x70, 0x74, 0x74, 0x70, 0x79, 0x73, 0x74, 0x73, 0x72, 0x72, 0x70, 0x73, 0x74, 0x79, 0x72, 0x74, 0x6f, 0x74, 0x6f, 0x72, 0x6c, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x71, 0x6c, 0x6f, 0x6a, 0x68, 0x84, 0xcb, 0x64, 0xcd, 0x5c, 0x5c, 0xcc, 0x63, 0x63, 0x63, 0x63, 0x5e, 0x52, 0x56, 0x56, 0x5e, 0x63, 0x64, 0x62, 0x5f, 0xcc, 0xcd, 0xcc, 0x64, 0x5d, 0x87, 0x66, 0x6c, 0x6c, 0x6a, 0x73, 0x6c, 0x72, 0x70, 0x72, 0x70, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x73, 0x72, 0x72, 0x70, 0x72, 0x74, 0x6c, 0x72, 0x74, 0x72, 0x72, 0x74, 0x70, 0x70, 0x74, 0x70, 0x79, 0x79, 0x79, 0x79, 0x79, 0x74, 0x6f, 0x6c, 0x36, 0xc6, 0xbc, 0xbc, 0x4f, 0xb9, 0x55, 0xeb, 0xf7, 0xf8, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0x5b, 0x58, 0xb1, 0xc0, 0xbe, 0xc2, 0xbf, 0x81, 0x69, 0x73, 0x73, 0x72, 0x73, 0x72, 0x74, 0x74, 0x74, 0x70, 0x74, 0x71, 0x72, 0x73, 0x72, 0x73, 0x72, 0x73, 0x72, 0x6c, 0x6f, 0x70, 0x72, 0x74, 0x72, 0x72, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x71, 0x72, 0x6f, 0x6f, 0x6c, 0x76, 0x6a, 0x68, 0x88, 0x5a, 0x63, 0x63, 0x63, 0x5e, 0x56, 0x4a, 0x38, 0x30, 0x29, 0x2e, 0x29, 0x29, 0x2e, 0x33, 0x3e, 0x52, 0x5e, 0x63, 0x63, 0x63, 0xcc, 0x90, 0x66, 0x6e, 0x73, 0x6d, 0x76, 0x6c, 0x6c, 0x72, 0x70, 0x6f, 0x70, 0x73, 0x72, 0x72, 0x72, 0x72, 0x73, 0x72, 0x72, 0x72, 0x6f, 0x71, 0x71, 0x6d, 0x71, 0x73, 0x73, 0x71, 0x71, 0x73, 0x73, 0x72, 0x74, 0x72, 0x70, 0x79, 0x74, 0x74, 0x79, 0x70, 0x6a, 0x8b, 0xc6, 0xba, 0xbc, 0x4f, 0xbd, 0xc4, 0xca, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x5f, 0xca, 0xb9, 0xbd, 0xbc, 0xb6, 0x59, 0x9c, 0x6a, 0x73, 0x73, 0x73, 0x72, 0x7b, 0x72, 0x74, 0x74, 0x79, 0x79, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x6f, 0x6f, 0x6d, 0x71, 0x6d, 0x66, 0x86, 0x40, 0x3f, 0x37, 0x2e, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x2e, 0x33, 0x3e, 0x52, 0x96, 0x65, 0x6c, 0x6d, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x72, 0x70, 0x72, 0x70, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x71, 0x72, 0x73, 0x76, 0x71, 0x72, 0x71, 0x76, 0x73, 0x72, 0x74, 0x74, 0x74, 0x70, 0x01, 0x74, 0x70, 0x6e, 0x43, 0xc6, 0xbc, 0xb8, 0xc0, 0x4f, 0x58, 0x5c, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xeb, 0xc8, 0xb9, 0x4f, 0xbe, 0xb7, 0x56, 0x94, 0x68, 0x73, 0x6c, 0x7b, 0x6d, 0x79, 0x74, 0x70, 0x79, 0x70, 0x74, 0x74, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x74, 0x72, 0x70, 0x74, 0x72, 0x72, 0x72, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6d, 0x72, 0x72, 0x6f, 0x6d, 0x71, 0x6c, 0x6a, 0x03, 0x2f, 0x27, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x29, 0x29, 0x16, 0x69, 0x6c, 0x72, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x6c, 0x72, 0x70, 0x72, 0x70, 0x72, 0x72, 0x72, 0x74, 0x73, 0x72, 0x72, 0x72, 0x72, 0x6f, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x74, 0x71, 0x72, 0x73, 0x74, 0x74, 0x6c, 0x7d, 0x70, 0x01, 0x69, 0x9c, 0x56, 0xb8, 0xbc, 0xc0, 0xb9, 0x54, 0x5b, 0x5b, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0x5f, 0xc1, 0x4f, 0x4f, 0xb6, 0xc6, 0xbe, 0x88, 0x6c, 0x72, 0x73, 0x7b, 0x74, 0x70, 0x74, 0x74, 0x74, 0x74, 0x79, 0x79, 0x79, 0x74, 0x70, 0x74, 0x79, 0x74, 0x70, 0x74, 0x70, 0x72, 0x72, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x6f, 0x6f, 0x71, 0x6f, 0x6d, 0x71, 0x70, 0x6a, 0x05, 0x29, 0x30, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x30, 0x1b, 0x70, 0x70, 0x6a, 0x76, 0x6c, 0x6f, 0x6d, 0x6c, 0x6c, 0x6f, 0x72, 0x72, 0x70, 0x72, 0x72, 0x6c, 0x72, 0x73, 0x74, 0x72, 0x72, 0x72, 0x72, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x70, 0x74, 0x72, 0x72, 0x74, 0x73, 0x72, 0x79, 0x72, 0x74, 0x69, 0x90, 0x56, 0xb6, 0xbe, 0xb8, 0xbd, 0xbd, 0xca, 0x5c, 0xf9, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf0, 0xd4, 0xff, 0x58, 0xc0, 0x4f, 0xc2, 0xba, 0xc3, 0xbf, 0x88, 0x73, 0x6c, 0x76, 0x70, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x70, 0x74, 0x70, 0x74, 0x70, 0x70, 0x70, 0x74, 0x70, 0x74, 0x72, 0x72, 0x72, 0x6f, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x71, 0x72, 0x71, 0x70, 0x70, 0x72, 0x6d, 0x71, 0x70, 0x70, 0x70, 0x15, 0x29, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x30, 0x24, 0x05, 0x6c, 0x6b, 0x6c, 0x73, 0x6f, 0x72, 0x6d, 0x6c, 0x6d, 0x6c, 0x72, 0x72, 0x72, 0x70, 0x70, 0x72, 0x72, 0x72, 0x74, 0x73, 0x72, 0x72, 0x72, 0x73, 0x70, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x73, 0x73, 0x6c, 0x69, 0x8b, 0xc6, 0xbe, 0xbc, 0xc4, 0xbd, 0xb9, 0x58, 0x5b, 0xca, 0xf7, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xf2, 0xef, 0xff, 0x58, 0xb6, 0x4f, 0xbe, 0xbe, 0xc6, 0x40, 0x88, 0x74, 0x6c, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x73, 0x73, 0x73, 0x73, 0x72, 0x73, 0x72, 0x73, 0x72, 0x74, 0x70, 0x72, 0x72, 0x6f, 0x71, 0x6f, 0x71, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x72, 0x71, 0x72, 0x6f, 0x6f, 0x70, 0x70, 0x70, 0x6d, 0x6d, 0x6d, 0x71, 0x6c, 0x6f, 0x01, 0x15, 0x23, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x24, 0x0a, 0x01, 0x6a, 0x6e, 0x75, 0x6b, 0x6d, 0x71, 0x6f, 0x6d, 0x6c, 0x6d, 0x6c, 0x72, 0x72, 0x70, 0x72, 0x72, 0x72, 0x6c, 0x73, 0x74, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x72, 0x72, 0x72, 0x74, 0x73, 0x72, 0x72, 0x74, 0x74, 0x72, 0x77, 0x72, 0x74, 0x72, 0x6a, 0x81, 0xb4, 0xc2, 0xbc, 0xbc, 0xb8, 0xb9, 0xc5, 0x5c, 0x5b, 0xf9, 0xf8, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0x5f, 0xc8, 0xb5, 0xbf, 0x50, 0x50, 0xc6, 0xae, 0x8b, 0x81, 0x6a, 0x73, 0x6c, 0x78, 0x72, 0x76, 0x73, 0x73, 0x72, 0x73, 0x70, 0x73, 0x70, 0x74, 0x70, 0x70, 0x74, 0x72, 0x70, 0x72, 0x72, 0x72, 0x6f, 0x6c, 0x72, 0x6d, 0x72, 0x6d, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x70, 0x6c, 0x71, 0x6c, 0x6d, 0x72, 0x6c, 0x70, 0x6c, 0x6c, 0x6a, 0x70, 0x7d, 0x02, 0x82, 0x82, 0x7d, 0x6c, 0x6c, 0x6a, 0x6c, 0x72, 0x72, 0x6d, 0x71, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6d, 0x72, 0x6d, 0x72, 0x6d, 0x72, 0x6c, 0x72, 0x72, 0x72, 0x72, 0x72, 0x70, 0x74, 0x74, 0x74, 0x76, 0x6c, 0x72, 0x73, 0x73, 0x72, 0x72, 0x79, 0x73, 0x74, 0x6b, 0x7e, 0x86, 0xab, 0xc6, 0xb8, 0xc0, 0xb8, 0xbd, 0xc5, 0x5b, 0xf3, 0x5b, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xef, 0xf3, 0xf2, 0xef, 0x5c, 0xc8, 0xba, 0x50, 0xbf, 0xbe, 0xc7, 0x43, 0x8d, 0x85, 0x6d, 0x71, 0x6f, 0x71, 0x72, 0x73, 0x74, 0x73, 0x70, 0x74, 0x70, 0x74, 0x70, 0x74, 0x70, 0x70, 0x70, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x6c, 0x72, 0x6c, 0x72, 0x6f, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x74, 0x6c, 0x6c, 0x70, 0x6a, 0x6a, 0x6a, 0x70, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x6f, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6f, 0x6c, 0x71, 0x6d, 0x71, 0x6c, 0x72, 0x6c, 0x71, 0x74, 0x72, 0x72, 0x74, 0x74, 0x74, 0x74, 0x73, 0x74, 0x6f, 0x6f, 0x71, 0x74, 0x7c, 0x6c, 0x6c, 0x6c, 0x83, 0x86, 0x41, 0xc4, 0xbe, 0xc0, 0xbe, 0xbd, 0xbd, 0xf8, 0x5b, 0xef, 0xef, 0xf3, 0xf8, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf2, 0x5b, 0x5c, 0x55, 0xbc, 0xbe, 0xb8, 0xc2, 0xc2, 0xc6, 0x8b, 0x88, 0x83, 0x72, 0x72, 0x74, 0x74, 0x74, 0x74, 0x74, 0x70, 0x74, 0x70, 0x74, 0x72, 0x70, 0x6f, 0x72, 0x72, 0x72, 0x6d, 0x72, 0x6d, 0x72, 0x6f, 0x6c, 0x72, 0x6d, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6a, 0x70, 0x6c, 0x6c, 0x70, 0x72, 0x70, 0x72, 0x72, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6d, 0x72, 0x6c, 0x72, 0x6d, 0x72, 0x6d, 0x72, 0x72, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x73, 0x72, 0x72, 0x74, 0x74, 0x74, 0x6a, 0x74, 0x80, 0x88, 0x88, 0x41, 0xc7, 0xbe, 0xb7, 0xc0, 0x4f, 0xc5, 0x58, 0x5c, 0xf3, 0x5b, 0xef, 0xf8, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf8, 0xf2, 0xf1, 0xf2, 0xf3, 0x5f, 0x5b, 0xc4, 0xb9, 0xbe, 0xbc, 0xbe, 0xc2, 0xc6, 0x94, 0x85, 0x14, 0x83, 0x7d, 0x74, 0x70, 0x70, 0x74, 0x74, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6c, 0x6f, 0x6d, 0x72, 0x71, 0x71, 0x6d, 0x72, 0x6f, 0x6c, 0x72, 0x6f, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x6a, 0x72, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6f, 0x6c, 0x71, 0x6c, 0x71, 0x6c, 0x72, 0x72, 0x73, 0x72, 0x74, 0x70, 0x72, 0x73, 0x76, 0x72, 0x72, 0x77, 0x72, 0x6f, 0x70, 0x74, 0x82, 0x89, 0x85, 0x8e, 0xb2, 0xc7, 0xbc, 0xbe, 0x4f, 0xc0, 0xc5, 0x5a, 0x5c, 0xef, 0xf8, 0xf2, 0xf8, 0xf3, 0xf8, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0x5b, 0xf7, 0xc5, 0xb5, 0xc0, 0xbc, 0xbe, 0xbf, 0xc6, 0x35, 0x88, 0x14, 0x8a, 0x85, 0x80, 0x70, 0x6f, 0x70, 0x70, 0x77, 0x74, 0x70, 0x72, 0x6c, 0x72, 0x73, 0x72, 0x6d, 0x6d, 0x6d, 0x6d, 0x72, 0x6d, 0x72, 0x6d, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6c, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x72, 0x6c, 0x73, 0x6c, 0x72, 0x6c, 0x6c, 0x72, 0x74, 0x70, 0x74, 0x78, 0x6f, 0x6f, 0x77, 0x72, 0x70, 0x6a, 0x79, 0x82, 0x14, 0x88, 0x85, 0x94, 0x52, 0xc7, 0xbe, 0xbc, 0xc0, 0xc0, 0xc0, 0x5a, 0x5c, 0xca, 0xf7, 0xef, 0xf3, 0xef, 0xef, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf9, 0xf1, 0xf7, 0xf1, 0xf2, 0xf2, 0xf3, 0xf3, 0x5b, 0x55, 0xb5, 0x4f, 0x4f, 0xc2, 0xbb, 0x56, 0xa6, 0x91, 0x85, 0x8a, 0x8a, 0x14, 0x83, 0x7d, 0x74, 0x6c, 0x6f, 0x74, 0x72, 0x72, 0x72, 0x6c, 0x6c, 0x6c, 0x6f, 0x6d, 0x72, 0x6f, 0x72, 0x6f, 0x72, 0x72, 0x71, 0x72, 0x72, 0x71, 0x72, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6f, 0x6c, 0x6c, 0x72, 0x6d, 0x72, 0x6f, 0x71, 0x72, 0x72, 0x70, 0x74, 0x74, 0x74, 0x72, 0x72, 0x77, 0x6c, 0x6f, 0x80, 0x83, 0x14, 0x8a, 0x85, 0x89, 0x36, 0x56, 0xbe, 0xbe, 0xc0, 0xbc, 0x4f, 0xc5, 0xcb, 0x5b, 0x5b, 0xef, 0xef, 0xf1, 0xf3, 0xf3, 0xf3, 0x5b, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xf1, 0xf7, 0xf1, 0xf2, 0xef, 0xf2, 0x5f, 0x5b, 0xc8, 0xb1, 0x4f, 0x4f, 0xc7, 0xb7, 0x56, 0x4e, 0x99, 0x83, 0x85, 0x8a, 0x89, 0x8a, 0x85, 0x80, 0x79, 0x6c, 0x6a, 0x6c, 0x72, 0x74, 0x72, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6f, 0x6c, 0x6f, 0x6c, 0x6f, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x70, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x72, 0x6d, 0x6c, 0x6d, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6f, 0x72, 0x73, 0x72, 0x6c, 0x72, 0x70, 0x74, 0x79, 0x74, 0x70, 0x70, 0x6c, 0x74, 0x82, 0x14, 0x89, 0x8a, 0x88, 0x80, 0x91, 0x41, 0x56, 0xba, 0xc2, 0xbc, 0xc0, 0xb9, 0xc5, 0xca, 0x5c, 0xca, 0x5b, 0xef, 0xef, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xef, 0xef, 0xef, 0x5f, 0x58, 0xbd, 0xbd, 0xb8, 0xc4, 0xbf, 0xbf, 0x56, 0xb4, 0x91, 0x85, 0x86, 0x8a, 0x8a, 0x8a, 0x8a, 0x85, 0x0a, 0x7c, 0x70, 0x6c, 0x6c, 0x70, 0x70, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x6d, 0x6c, 0x6d, 0x72, 0x6c, 0x6c, 0x71, 0x72, 0x6a, 0x72, 0x72, 0x70, 0x6f, 0x70, 0x6a, 0x70, 0x79, 0x82, 0x85, 0x8a, 0x8a, 0x8a, 0x89, 0x83, 0x89, 0x9f, 0x56, 0xc6, 0xb8, 0xbe, 0xb9, 0xc0, 0xbd, 0xc8, 0x5b, 0x5b, 0x5b, 0xf3, 0xf3, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xeb, 0xf3, 0xf7, 0xf7, 0xf3, 0xf9, 0xf3, 0xf3, 0xf3, 0xef, 0xd4, 0xeb, 0x5f, 0xca, 0xb9, 0xc0, 0xbc, 0xbc, 0xc2, 0xc2, 0xc3, 0xc7, 0xa6, 0x20, 0x85, 0x85, 0x14, 0x8a, 0x8a, 0x8a, 0x8a, 0x14, 0x83, 0x7d, 0x7d, 0x70, 0x70, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x72, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x72, 0x6d, 0x6c, 0x6d, 0x6c, 0x72, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x72, 0x72, 0x72, 0x6c, 0x6c, 0x6f, 0x6c, 0x6f, 0x6c, 0x6c, 0x6f, 0x6c, 0x6f, 0x70, 0x6c, 0x6c, 0x6c, 0x74, 0x7d, 0x82, 0x85, 0x88, 0x19, 0x16, 0x1e, 0x17, 0x83, 0x06, 0x99, 0x50, 0x52, 0x4c, 0xbc, 0xbc, 0xc0, 0xc0, 0xb1, 0x58, 0x5f, 0xf8, 0xd4, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0xf3, 0x5b, 0xeb, 0xf2, 0xf2, 0xf3, 0x5f, 0x61, 0x55, 0xbd, 0x4f, 0x4f, 0xbe, 0xbe, 0xbb, 0xc3, 0x56, 0xa6, 0x93, 0x14, 0x83, 0x14, 0x14, 0x16, 0x8a, 0x16, 0x8a, 0x8a, 0x14, 0x82, 0x05, 0x7d, 0x79, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x6c, 0x6d, 0x6c, 0x6c, 0x72, 0x6c, 0x72, 0x6c, 0x6c, 0x6c, 0x6c, 0x6f, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x70, 0x6c, 0x79, 0x80, 0x82, 0x85, 0x89, 0x8a, 0x8a, 0x8a, 0x89, 0x14, 0x89, 0x05, 0x85, 0x99, 0x4e, 0x59, 0xb4, 0xbb, 0xc2, 0xbc, 0xb8, 0xb5, 0xc5, 0x5c, 0x5b, 0xf8, 0xeb, 0xef, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0x5b, 0x5c, 0x5a, 0x55, 0xb5, 0xbe, 0xbc, 0xbb, 0xbb, 0xbf, 0x56, 0xc6, 0x40, 0x99, 0x89, 0x14, 0x14, 0x14, 0x8a, 0x8a, 0x16, 0x16, 0x19, 0x8a, 0x89, 0x14, 0x14, 0x85, 0x82, 0x02, 0x7c, 0x01, 0x70, 0x70, 0x6c, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c, 0x6a, 0x6c, 0x70, 0x70, 0x7c, 0x01, 0x80, 0x03, 0x82, 0x85, 0x16, 0x8a, 0x8a, 0x8a, 0x16, 0x8a, 0x16, 0x89, 0x14, 0x14, 0x83, 0x89, 0x9c, 0xbb, 0xc7, 0xbe, 0xbb, 0xbc, 0xbc, 0xb8, 0xb5, 0xc0, 0x57, 0x5c, 0x5c, 0xf3, 0xf3, 0xf1, 0xf1, 0xf2, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0x5b, 0x60, 0x5b, 0x58, 0x4f, 0xc0, 0xbc, 0xbc, 0xba, 0xbb, 0xbf, 0x52, 0xc7, 0x4b, 0x35, 0x20, 0x85, 0x0a, 0x85, 0x16, 0x16, 0x16, 0x16, 0x16, 0x89, 0x16, 0x89, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x14, 0x86, 0x85, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7b, 0x74, 0x70, 0x70, 0x6c, 0x70, 0x6c, 0x70, 0x72, 0x70, 0x73, 0x79, 0x7b, 0x7d, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x85, 0x85, 0x14, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x14, 0x8a, 0x16, 0x89, 0x85, 0x85, 0x83, 0x85, 0x91, 0x3d, 0xc2, 0x56, 0xbf, 0xb6, 0xba, 0xb8, 0xb8, 0xb5, 0x4f, 0xc5, 0xcb, 0xff, 0x5c, 0xf8, 0xf3, 0xf3, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0xf9, 0x5b, 0x5b, 0x5c, 0x5f, 0x5c, 0x57, 0xb9, 0xb9, 0x4f, 0xbc, 0xbb, 0xbe, 0xc3, 0xc3, 0x56, 0x52, 0x40, 0x99, 0x8e, 0x14, 0x0a, 0x85, 0x14, 0x14, 0x16, 0x8a, 0x16, 0x14, 0x16, 0x16, 0x16, 0x16, 0x89, 0x16, 0x89, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x85, 0x85, 0x85, 0x89, 0x93, 0x35, 0x4b, 0x52, 0xc6, 0xbf, 0xbb, 0xba, 0xc2, 0x4f, 0xb5, 0xb5, 0xc0, 0x58, 0x5f, 0xf9, 0xf3, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf9, 0x5b, 0xf7, 0xf8, 0xf7, 0xf7, 0xef, 0x5b, 0xef, 0xff, 0x5f, 0xc8, 0xc0, 0xb1, 0x4f, 0xc2, 0xbc, 0xbe, 0xbb, 0xbf, 0xc3, 0x56, 0x52, 0x40, 0x35, 0x93, 0x89, 0x83, 0x05, 0x82, 0x14, 0x14, 0x16, 0x16, 0x16, 0x16, 0x16, 0x89, 0x89, 0x14, 0x14, 0x89, 0x14, 0x89, 0x16, 0x89, 0x16, 0x89, 0x14, 0x16, 0x16, 0x89, 0x16, 0x89, 0x16, 0x89, 0x16, 0x14, 0x16, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x85, 0x05, 0x83, 0x8a, 0x2a, 0x9f, 0x45, 0xbf, 0x52, 0xbf, 0xbf, 0xbb, 0xbe, 0xbc, 0xb8, 0xb5, 0xb5, 0xc5, 0x5a, 0x5b, 0xff, 0xf1, 0xf1, 0xef, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xf3, 0xf9, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xeb, 0xf1, 0xf1, 0xf3, 0xf9, 0x5f, 0x5a, 0xc5, 0xb9, 0xb5, 0xb8, 0xb8, 0xbc, 0xc0, 0xbb, 0xbe, 0xc2, 0x53, 0xc6, 0x52, 0xb0, 0x35, 0x2a, 0x20, 0x14, 0x85, 0x85, 0x85, 0x16, 0x14, 0x89, 0x89, 0x16, 0x89, 0x14, 0x16, 0x14, 0x14, 0x14, 0x16, 0x14, 0x16, 0x14, 0x16, 0x16, 0x14, 0x16, 0x14, 0x14, 0x16, 0x14, 0x16, 0x14, 0x14, 0x14, 0x16, 0x14, 0x14, 0x14, 0x14, 0x0a, 0x85, 0x0a, 0x85, 0x8a, 0x2a, 0x35, 0xb0, 0x50, 0xc6, 0x52, 0xbe, 0x4e, 0x4c, 0xba, 0xba, 0xba, 0xb5, 0xb3, 0xc0, 0xc8, 0x5b, 0x5b, 0xf7, 0xf3, 0xef, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0x5b, 0x5b, 0x5c, 0xca, 0xc8, 0xbd, 0xb9, 0xb5, 0xb9, 0x4f, 0x4f, 0xbe, 0xbc, 0xbc, 0xbe, 0xbf, 0xc6, 0x56, 0x4e, 0x43, 0xa3, 0x32, 0x26, 0x89, 0x85, 0x83, 0x85, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x16, 0x14, 0x16, 0x16, 0x16, 0x16, 0x14, 0x14, 0x16, 0x14, 0x14, 0x14, 0x14, 0x85, 0x0a, 0x06, 0x0a, 0x05, 0x05, 0x14, 0x25, 0x99, 0x3a, 0x40, 0x4e, 0x4e, 0xbf, 0x4e, 0xbf, 0x4d, 0xb6, 0xbc, 0xba, 0xb5, 0xb3, 0xb5, 0xb9, 0xc0, 0x58, 0xcb, 0x5b, 0x5b, 0x5b, 0xf3, 0x5b, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xd4, 0x5b, 0xd5, 0x5c, 0x5b, 0x58, 0xc5, 0xbd, 0xb9, 0xb9, 0xb9, 0x4f, 0x4f, 0xbe, 0xb3, 0xb4, 0xbe, 0x52, 0xc6, 0x52, 0x56, 0x56, 0x4e, 0x40, 0x35, 0x31, 0x93, 0x25, 0x20, 0x1e, 0x16, 0x16, 0x14, 0x14, 0x14, 0x11, 0x85, 0x0e, 0x14, 0x14, 0x14, 0x14, 0x8a, 0x8a, 0x1e, 0x1e, 0x26, 0x2a, 0x33, 0x3a, 0x3d, 0x4e, 0x52, 0x52, 0x52, 0xbb, 0xb4, 0x4c, 0xb4, 0xba, 0xba, 0xb8, 0xb3, 0xb3, 0xb5, 0xb1, 0xb9, 0x54, 0xc8, 0x5b, 0x5f, 0x5b, 0xef, 0x5b, 0xf3, 0xf3, 0xf1, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf9, 0xf3, 0xf7, 0xf3, 0xf3, 0xf8, 0xf3, 0xf3, 0xef, 0xf8, 0x5b, 0x5f, 0x5b, 0x5b, 0x58, 0xc8, 0xc0, 0xb9, 0xb9, 0xb8, 0x4f, 0xc0, 0xb6, 0xb3, 0x4c, 0xbb, 0x50, 0x4d, 0xbb, 0xbf, 0xbf, 0x4e, 0x49, 0x49, 0x45, 0x3f, 0x3f, 0x3f, 0x3e, 0xa3, 0x3b, 0x3b, 0x3b, 0xa3, 0x3b, 0x3d, 0x3e, 0x3f, 0x3f, 0x44, 0x49, 0x4a, 0x49, 0x4a, 0x4a, 0x49, 0x45, 0xb0, 0x4d, 0x4d, 0xb4, 0xb2, 0xae, 0xae, 0xb3, 0xb5, 0xab, 0xb5, 0x4f, 0xc5, 0xc8, 0x58, 0xca, 0x5f, 0x5f, 0xd4, 0xd4, 0xef, 0xef, 0xd4, 0xef, 0xef, 0xef, 0xf3, 0xf1, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf2, 0xf2, 0xf1, 0xf3, 0xf7, 0xf1, 0xf9, 0xf3, 0xf3, 0x5b, 0xf3, 0x5b, 0xf3, 0xef, 0xef, 0xeb, 0xeb, 0xf2, 0x5b, 0xd4, 0x5b, 0x5b, 0x5c, 0x5f, 0x5c, 0xca, 0x5a, 0xc8, 0xc0, 0xc0, 0xbd, 0xc0, 0xb9, 0xb6, 0xbc, 0x4c, 0x4e, 0x4e, 0x49, 0xa9, 0x49, 0x40, 0x44, 0x44, 0x44, 0x44, 0x45, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x45, 0x45, 0x45, 0x44, 0x40, 0x3f, 0x40, 0x44, 0x40, 0x45, 0x45, 0x41, 0x43, 0x4c, 0x4c, 0xb3, 0xb5, 0xc0, 0xc4, 0xc5, 0xc9, 0x5a, 0xcb, 0x5c, 0x5c, 0x5b, 0x5b, 0xd4, 0xd4, 0xd4, 0xd4, 0xf0, 0xef, 0xf1, 0xef, 0xf3, 0xef, 0xf1, 0x5b, 0xf3, 0x5b, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xef, 0xeb, 0xf0, 0xef, 0xf7, 0xca, 0x5b, 0x5b, 0x5b, 0xf3, 0x5b, 0xef, 0x5b, 0xf3, 0x5b, 0xf3, 0x5f, 0xf7, 0x5c, 0x5c, 0xef, 0xd4, 0xd4, 0x58, 0x5a, 0x59, 0x53, 0x4e, 0x45, 0x40, 0x44, 0x3f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3f, 0x44, 0x3f, 0x44, 0x44, 0x40, 0xc2, 0xcb, 0xcb, 0xf8, 0x5b, 0xef, 0x5c, 0x5b, 0x5b, 0x5b, 0xf8, 0x5b, 0xf8, 0xef, 0x5b, 0xef, 0xf8, 0xef, 0x5b, 0xf8, 0xf8, 0xf3, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xef, 0xd4, 0xf3, 0xd4, 0xc8, 0x5b, 0x5b, 0xf7, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0x5b, 0x5c, 0x5b, 0xef, 0xd4, 0xef, 0xef, 0xcc, 0x59, 0x48, 0x40, 0x44, 0x45, 0x49, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x45, 0x44, 0x49, 0x44, 0x45, 0x41, 0xc4, 0x5c, 0xca, 0xd4, 0xf8, 0xd4, 0xf3, 0xf8, 0xef, 0xf8, 0xef, 0x5b, 0x5b, 0xf8, 0x5b, 0x5b, 0xf8, 0xf7, 0xef, 0x54, 0xca, 0xf7, 0xf3, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0x5b, 0xc1, 0x58, 0xeb, 0x5b, 0x5f, 0xef, 0xf3, 0xef, 0x5b, 0xef, 0xf3, 0x5b, 0xf3, 0xf3, 0x5b, 0xf7, 0xef, 0xef, 0xd4, 0x5c, 0x59, 0x47, 0x43, 0x45, 0x45, 0x45, 0x45, 0x44, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x45, 0x44, 0x45, 0x49, 0x44, 0x45, 0x41, 0xab, 0xc9, 0x5c, 0xca, 0xef, 0x5b, 0xf8, 0x5b, 0xf8, 0x5b, 0xf8, 0xf8, 0xf8, 0x5b, 0xf8, 0x5b, 0xf8, 0xca, 0xf7, 0x58, 0xc1, 0xca, 0xf7, 0x5b, 0xf7, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf8, 0xf7, 0x5f, 0x54, 0xc1, 0xca, 0x5f, 0x5b, 0xf7, 0x5b, 0xf3, 0x5b, 0xf3, 0xf3, 0x5b, 0xf3, 0xf3, 0x5b, 0xef, 0xef, 0xeb, 0xf3, 0x5b, 0x5b, 0x53, 0x41, 0x44, 0x45, 0x45, 0x44, 0x40, 0x45, 0x45, 0x45, 0x49, 0x44, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x45, 0x44, 0x45, 0x45, 0x44, 0x45, 0x45, 0x44, 0x45, 0x45, 0xb0, 0x41, 0xbc, 0x5c, 0x5b, 0x5b, 0xef, 0x5b, 0xf8, 0xf8, 0xf8, 0xef, 0x5b, 0xf8, 0xf8, 0xef, 0x5b, 0xf8, 0xf8, 0x5b, 0xf9, 0xc1, 0x54, 0xca, 0xff, 0x5b, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0x5b, 0x5b, 0xca, 0xb9, 0x54, 0xca, 0x5b, 0xf7, 0x5b, 0xf3, 0x5b, 0xf3, 0x5b, 0xf3, 0x5b, 0xf7, 0x5b, 0xef, 0xef, 0xf2, 0xf2, 0x5b, 0x5c, 0xcb, 0x41, 0x40, 0x4a, 0x44, 0x45, 0x45, 0x44, 0x45, 0x44, 0x45, 0x44, 0x4a, 0x44, 0x44, 0x44, 0x44, 0x4a, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x49, 0x45, 0x4a, 0x45, 0x49, 0x44, 0x44, 0x49, 0x45, 0x45, 0x48, 0x47, 0x59, 0x5c, 0xd4, 0xf8, 0xef, 0x5b, 0xf7, 0xf8, 0x5b, 0xf8, 0x5b, 0xf8, 0x5b, 0xf8, 0x5b, 0x5b, 0xf8, 0x5c, 0x54, 0xb9, 0x54, 0xcb, 0x5f, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf8, 0x5b, 0x54, 0xb9, 0xc8, 0x5c, 0x5b, 0xf3, 0xf3, 0x5b, 0x5b, 0xf3, 0x5b, 0xf7, 0x5f, 0xf8, 0x5b, 0xf8, 0xf2, 0xef, 0xf3, 0xf8, 0x5c, 0x53, 0x40, 0x4a, 0x44, 0x44, 0x45, 0x45, 0x45, 0x4a, 0x44, 0x44, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x4a, 0x4a, 0x44, 0x44, 0x44, 0x49, 0x4a, 0x44, 0x44, 0x45, 0x44, 0x49, 0x49, 0x45, 0x43, 0x55, 0x60, 0x5b, 0xef, 0xf8, 0xf8, 0xf8, 0x5b, 0xef, 0x5b, 0xf8, 0xf8, 0xef, 0xf8, 0xf8, 0x5b, 0xf8, 0x5c, 0x58, 0xc1, 0xc5, 0x54, 0x5c, 0xf7, 0xf3, 0xf7, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0x5b, 0x5c, 0xc8, 0xbd, 0x4f, 0x58, 0x5b, 0x5b, 0xf3, 0x5b, 0x5b, 0xf8, 0x5b, 0xf8, 0x5b, 0xf8, 0x5b, 0x5b, 0xf7, 0xf2, 0xef, 0x5b, 0x5f, 0xcb, 0x47, 0x40, 0x49, 0x44, 0x44, 0x44, 0x44, 0x4a, 0x44, 0x4a, 0x4a, 0x44, 0x44, 0x3f, 0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0x3b, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3f, 0x44, 0x44, 0x44, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x44, 0x44, 0x49, 0x45, 0xbb, 0x5d, 0xf8, 0xf3, 0xf3, 0x5b, 0xf8, 0x5b, 0x5b, 0xf8, 0x5b, 0xf8, 0x5b, 0xf8, 0x5b, 0x5b, 0x5b, 0x5b, 0x5a, 0x55, 0xbd, 0xc0, 0x5a, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0x5f, 0x5b, 0xc5, 0x4f, 0xc0, 0x5a, 0x5c, 0x5b, 0xf1, 0xf3, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5f, 0xff, 0x5b, 0x5b, 0xef, 0xf3, 0x5b, 0x60, 0x57, 0x48, 0x48, 0x44, 0x44, 0x4a, 0x4a, 0x4a, 0x44, 0x3f, 0x3e, 0x3e, 0x39, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x38, 0x37, 0x37, 0x37, 0x39, 0x39, 0x37, 0x37, 0x37, 0x39, 0x3b, 0x3e, 0x3f, 0x3f, 0x44, 0x4a, 0x4a, 0x44, 0x45, 0x48, 0xcb, 0x5b, 0xf1, 0xd4, 0x5b, 0xf7, 0x5b, 0xf3, 0xf8, 0xef, 0xf8, 0xef, 0xf8, 0x5b, 0xf8, 0x5b, 0xcb, 0x5c, 0x55, 0xc0, 0xc5, 0xc0, 0xd4, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x5c, 0xc8, 0xb9, 0xc0, 0x4f, 0xcb, 0x60, 0xf3, 0xf3, 0xf3, 0x5b, 0x5b, 0x5b, 0x5b, 0xff, 0x5c, 0xf8, 0x5b, 0x5b, 0xf7, 0x5f, 0x5b, 0xcb, 0x53, 0x41, 0x45, 0x49, 0x44, 0x3f, 0x3e, 0x3b, 0x38, 0x37, 0x37, 0x37, 0x38, 0x38, 0x37, 0x38, 0x39, 0x38, 0x38, 0x38, 0x39, 0x38, 0x38, 0x39, 0x38, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x37, 0x39, 0x3c, 0x3e, 0x44, 0x4a, 0x49, 0x41, 0x59, 0xf8, 0xd4, 0xf7, 0x5b, 0xef, 0x5b, 0xf7, 0x5f, 0x5b, 0x5b, 0x5b, 0xf8, 0x5b, 0x5b, 0x5b, 0xcb, 0x5c, 0x57, 0xc4, 0xc4, 0xc0, 0x54, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf8, 0xf3, 0xf3, 0x58, 0xc0, 0xbc, 0xc0, 0xc4, 0x5a, 0x5b, 0x5b, 0xef, 0x5b, 0xf8, 0xf8, 0x5c, 0x5c, 0x57, 0xbd, 0xb5, 0xb3, 0xad, 0xbd, 0xcb, 0x60, 0x5e, 0xbc, 0x45, 0x44, 0x3f, 0x39, 0x38, 0x38, 0x37, 0x39, 0x39, 0x38, 0x38, 0x39, 0x39, 0x39, 0x39, 0x38, 0x37, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x39, 0x38, 0x38, 0x39, 0x39, 0x38, 0x39, 0x38, 0x39, 0x34, 0x39, 0x38, 0x3b, 0x3f, 0x45, 0x56, 0x5d, 0xca, 0x55, 0x4f, 0xad, 0xb1, 0xb5, 0xc5, 0x5a, 0x5b, 0x5c, 0xf8, 0xf3, 0xf8, 0xf8, 0x5b, 0x5b, 0x5a, 0xc4, 0xc4, 0xc4, 0xc1, 0x5a, 0xf9, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0x5b, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf1, 0xf1, 0xf3, 0xf3, 0xf7, 0xf8, 0xf3, 0xf8, 0xf7, 0xf3, 0x54, 0xc0, 0xc2, 0x4c, 0x55, 0xf8, 0xf7, 0xeb, 0x5b, 0xd4, 0x5b, 0x5f, 0xc8, 0xb9, 0xb5, 0xab, 0x47, 0x4c, 0xb6, 0x42, 0xaa, 0xc7, 0x5d, 0x4d, 0x3f, 0x3a, 0x38, 0x38, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x38, 0x38, 0x38, 0x38, 0x37, 0x3b, 0xc2, 0x56, 0x46, 0xb2, 0x43, 0xb3, 0xb6, 0xad, 0xad, 0xb5, 0xc0, 0xcb, 0x5f, 0xef, 0xf3, 0xf3, 0xca, 0x5b, 0x5a, 0xc4, 0xc4, 0x53, 0xc4, 0xc5, 0xf9, 0xf3, 0xf1, 0xf1, 0xf3, 0x5b, 0x5f, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf8, 0xf7, 0xca, 0xbd, 0x4f, 0x53, 0x50, 0x55, 0x5c, 0x5b, 0xd4, 0xca, 0x5c, 0xcb, 0xbd, 0xb5, 0xad, 0xb3, 0xb3, 0xb6, 0xb6, 0xac, 0xaf, 0xbc, 0xab, 0x48, 0x40, 0x35, 0x37, 0x39, 0x38, 0x38, 0x39, 0x37, 0x38, 0x37, 0x38, 0x37, 0x39, 0x37, 0x38, 0x37, 0x38, 0x37, 0x39, 0x37, 0x38, 0x37, 0x39, 0x39, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x39, 0x38, 0x38, 0x38, 0x37, 0x37, 0x34, 0xa9, 0x47, 0xb3, 0xb6, 0xae, 0xb6, 0xb2, 0xab, 0xb3, 0x46, 0xad, 0xb5, 0xc8, 0x5b, 0x5b, 0xca, 0x5b, 0x5b, 0xca, 0xc5, 0xc4, 0xc4, 0xc4, 0xbd, 0x58, 0xf9, 0xf2, 0xf2, 0xf3, 0xf3, 0x5b, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf8, 0xf3, 0x5b, 0xf7, 0x54, 0xbd, 0xbd, 0xc2, 0x4f, 0x57, 0x5c, 0xf8, 0x5b, 0x5f, 0x5a, 0x4f, 0x42, 0xad, 0xb3, 0xaf, 0xb3, 0xb2, 0xb2, 0xb2, 0xb3, 0xae, 0xb6, 0x4c, 0x3d, 0x35, 0x3a, 0x39, 0x38, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0xa0, 0xb0, 0xb6, 0x47, 0xb4, 0xae, 0xae, 0xb2, 0xb3, 0xb3, 0xb6, 0xb3, 0xad, 0x46, 0xc5, 0xcc, 0x5c, 0x5b, 0xcb, 0x5b, 0x55, 0xc0, 0xc4, 0x55, 0xc0, 0xc8, 0xf3, 0xf7, 0xf1, 0xf3, 0x5b, 0xf3, 0x5b, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0x5b, 0xf1, 0x5c, 0x5b, 0xbd, 0xc0, 0xc0, 0xc2, 0x50, 0x57, 0x5b, 0xca, 0x5c, 0x55, 0xb3, 0xb3, 0xb6, 0xb6, 0xb6, 0xae, 0xb2, 0xaf, 0xb2, 0xb7, 0xae, 0xbb, 0xae, 0xb4, 0x50, 0x3f, 0x35, 0x37, 0x37, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x37, 0x39, 0x37, 0x38, 0x37, 0x38, 0x37, 0x39, 0x37, 0x38, 0x37, 0x39, 0x39, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x39, 0x37, 0x3b, 0x4b, 0x48, 0xb0, 0xaf, 0xb0, 0xb4, 0xb2, 0xb0, 0xb2, 0xb2, 0xb6, 0xae, 0xb2, 0xb3, 0xad, 0x4f, 0xcb, 0x5c, 0xcb, 0x5c, 0xc5, 0xc0, 0xc5, 0xc4, 0xc4, 0xc1, 0x5a, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf1, 0xf1, 0xf7, 0xf8, 0xff, 0x57, 0xbd, 0xc0, 0xbe, 0xc2, 0x4f, 0x59, 0x5b, 0x5c, 0x54, 0x46, 0xb3, 0xb2, 0xb6, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xb2, 0xb4, 0xb2, 0xb2, 0xb4, 0x4e, 0x3e, 0x37, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x38, 0x39, 0x37, 0x3a, 0x45, 0xb0, 0xb0, 0xb2, 0xac, 0xb4, 0xb0, 0xb4, 0xae, 0xb2, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xac, 0x42, 0xb8, 0x5a, 0x60, 0xcb, 0xc8, 0xc0, 0xc4, 0xc4, 0xc4, 0xc0, 0x54, 0xf9, 0x5b, 0xf1, 0xf7, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0x5b, 0x5c, 0xc5, 0xbd, 0xbe, 0xc0, 0x50, 0xba, 0x5a, 0x5c, 0xc5, 0xb5, 0xb6, 0xaf, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb2, 0xb2, 0xb0, 0x51, 0xa6, 0x34, 0x37, 0x38, 0x37, 0x39, 0x39, 0x38, 0x37, 0x39, 0x37, 0x38, 0x37, 0x38, 0x37, 0x39, 0x37, 0x38, 0x37, 0x39, 0x39, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x39, 0x37, 0x3a, 0x40, 0xb4, 0xb0, 0xb2, 0xb0, 0xac, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb2, 0xaf, 0xbc, 0x5a, 0x5d, 0xc8, 0xc0, 0xc4, 0xc0, 0xc4, 0xc5, 0xc5, 0xca, 0x5f, 0xef, 0xf3, 0xf2, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0x5b, 0xf3, 0xf3, 0xf1, 0xef, 0xf9, 0x5a, 0xbd, 0xbe, 0xc0, 0xc2, 0xc2, 0xbe, 0x59, 0x54, 0x46, 0xad, 0xb3, 0xb6, 0xb3, 0xb2, 0xb3, 0xb6, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xb2, 0xaf, 0xb2, 0xac, 0xb0, 0xbf, 0x3d, 0x37, 0x37, 0x39, 0x37, 0x37, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x39, 0x35, 0x40, 0xb4, 0xae, 0xaf, 0xac, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xb4, 0xb2, 0xaf, 0x46, 0xb8, 0xcb, 0xc9, 0xc4, 0xc0, 0xc2, 0xc4, 0xc4, 0xbd, 0xc8, 0x5f, 0xf3, 0xf1, 0xeb, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf1, 0xef, 0xf3, 0x57, 0x4f, 0xbc, 0xbe, 0xbe, 0x53, 0xbc, 0x57, 0xb1, 0x46, 0xb5, 0xac, 0xb6, 0xaf, 0xb3, 0xb3, 0xb6, 0xb2, 0xb2, 0xb4, 0xb2, 0xb2, 0xae, 0xaf, 0xae, 0xaf, 0x47, 0x4c, 0xb2, 0x48, 0x4e, 0x3b, 0x37, 0x39, 0x37, 0x38, 0x39, 0x37, 0x39, 0x38, 0x39, 0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x3e, 0x4d, 0xb3, 0xad, 0xad, 0xb3, 0xac, 0xb2, 0xaf, 0xb3, 0xb2, 0xb3, 0xb2, 0xb3, 0xb2, 0xb2, 0xb2, 0xae, 0xb0, 0xb6, 0xb3, 0xaf, 0x42, 0xc0, 0x56, 0xc0, 0xbe, 0xc4, 0xc4, 0xc4, 0xc0, 0xc5, 0x5b, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0x5b, 0xf3, 0xf1, 0xf2, 0xf3, 0x5b, 0xc5, 0xc0, 0xba, 0xbe, 0xbb, 0x4c, 0x4c, 0xc4, 0xad, 0xb1, 0xaf, 0xb4, 0xae, 0xb3, 0xb3, 0xb2, 0xb3, 0xae, 0xb2, 0xb2, 0x48, 0xb2, 0xae, 0xb2, 0xae, 0xb3, 0xb2, 0x47, 0xb2, 0xb2, 0xb0, 0x4b, 0x3b, 0x37, 0x37, 0x38, 0x38, 0x38, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x37, 0x38, 0x38, 0x38, 0x39, 0x39, 0x37, 0x3d, 0x4b, 0xb2, 0xae, 0xb3, 0xaf, 0xaf, 0xb2, 0xae, 0xaf, 0xae, 0xb3, 0xae, 0xaf, 0xb2, 0xb2, 0xb2, 0xaf, 0xb4, 0xae, 0xac, 0xb3, 0xb3, 0xad, 0xad, 0xbe, 0xaf, 0xc2, 0xc4, 0xc4, 0xc4, 0xc5, 0xc0, 0x58, 0x5f, 0xf1, 0xf1, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0x5b, 0xf3, 0xef, 0xf2, 0xef, 0xf3, 0x5b, 0xbd, 0xbe, 0xbb, 0x4c, 0xb2, 0x43, 0xb3, 0xc2, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xb4, 0x45, 0x35, 0x39, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x39, 0x3a, 0x3a, 0x43, 0xb6, 0xac, 0xb6, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xbe, 0xa9, 0xb2, 0xb7, 0xc3, 0xc4, 0xc4, 0xbd, 0x57, 0xff, 0xf8, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf8, 0xf3, 0xf3, 0xef, 0xf3, 0x58, 0xb5, 0xb6, 0xaf, 0x43, 0x43, 0x47, 0xae, 0xc2, 0xae, 0xb3, 0xb2, 0xb4, 0x48, 0xb3, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x43, 0x4e, 0x40, 0x37, 0x37, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x39, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x3a, 0x39, 0x40, 0xb6, 0xae, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xbb, 0xae, 0x41, 0x41, 0xab, 0xb6, 0xbe, 0xc0, 0xc5, 0x5b, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0x5b, 0xef, 0xef, 0x5b, 0xc5, 0x46, 0xab, 0xac, 0x48, 0xb2, 0xae, 0xb3, 0xc2, 0xae, 0xb3, 0x48, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xb4, 0x4b, 0xa3, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x37, 0x38, 0x38, 0x38, 0x37, 0x39, 0x35, 0xa3, 0x4b, 0xac, 0xae, 0xb6, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xab, 0xbb, 0xb6, 0x41, 0x43, 0x43, 0x43, 0xae, 0xb5, 0xc0, 0x5b, 0xf7, 0xef, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf8, 0xf3, 0xef, 0x5b, 0xca, 0xb1, 0xad, 0xac, 0xae, 0x48, 0x48, 0xab, 0xae, 0xc2, 0xaf, 0xb2, 0xb2, 0xb4, 0x48, 0xb3, 0xb2, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xb0, 0x3b, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x3a, 0x49, 0xb4, 0xac, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xac, 0xae, 0xbe, 0xb6, 0x43, 0x43, 0x48, 0x43, 0x43, 0x47, 0xad, 0x58, 0x5f, 0xf0, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf8, 0x5f, 0x54, 0x46, 0xb3, 0xae, 0x48, 0x48, 0xac, 0x47, 0xb6, 0xc2, 0xae, 0xb3, 0x48, 0xb2, 0xb2, 0xae, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xb2, 0xac, 0x4e, 0x3f, 0x3a, 0x37, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x37, 0x35, 0x3f, 0x4e, 0xb0, 0xb2, 0xb2, 0xac, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xac, 0xb2, 0xbb, 0xb7, 0x41, 0x48, 0x43, 0x48, 0x48, 0x43, 0xaa, 0xbd, 0x5b, 0xeb, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xef, 0x5b, 0x5b, 0xb9, 0xad, 0x47, 0xb2, 0x48, 0xac, 0x43, 0x43, 0xb6, 0xbe, 0xb3, 0xae, 0xb2, 0xb4, 0x48, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xb4, 0x3d, 0x37, 0x39, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x3a, 0xa3, 0xb0, 0xb0, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbe, 0xb7, 0x41, 0x48, 0x43, 0xb0, 0x45, 0x48, 0x43, 0x46, 0xca, 0x5f, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0x5b, 0x5a, 0xb3, 0xab, 0xb2, 0xb0, 0x48, 0x48, 0x47, 0x47, 0xb3, 0xc2, 0xae, 0xb3, 0x48, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xb0, 0xae, 0xae, 0xb4, 0xb0, 0x3a, 0x37, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x37, 0x40, 0x4e, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbf, 0xb7, 0x41, 0xab, 0x48, 0x43, 0x45, 0x48, 0x48, 0x42, 0xc0, 0x61, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0xef, 0xef, 0x5c, 0x54, 0xad, 0xab, 0x48, 0xb4, 0x48, 0x48, 0x47, 0x43, 0xae, 0xc2, 0xb3, 0xb2, 0xb2, 0xb4, 0x48, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xb0, 0xae, 0xae, 0xae, 0xb4, 0xa6, 0x34, 0x39, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x39, 0x37, 0xa3, 0x4b, 0x43, 0x4c, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xbe, 0xb6, 0x41, 0xab, 0x43, 0xac, 0x49, 0x45, 0xb0, 0x41, 0xb5, 0x5c, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf2, 0xf8, 0x5f, 0xc0, 0x42, 0x47, 0x48, 0x48, 0x48, 0x43, 0x48, 0x47, 0xac, 0xc4, 0xae, 0xb3, 0x48, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb0, 0xb0, 0xb0, 0xaf, 0xae, 0xae, 0xb0, 0xa3, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x38, 0x38, 0x38, 0x37, 0x37, 0x49, 0xb4, 0xb2, 0xae, 0xb3, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0x47, 0xbf, 0xb7, 0x41, 0xab, 0xab, 0x45, 0xb0, 0x45, 0x45, 0x48, 0x42, 0xc9, 0x5f, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf1, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xf3, 0xf7, 0x5b, 0xf3, 0xf1, 0xf7, 0xca, 0xbd, 0xad, 0xac, 0x43, 0x48, 0x48, 0x48, 0xb2, 0x47, 0xab, 0xc7, 0xaf, 0xae, 0xae, 0xb4, 0x48, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xb0, 0xb2, 0xae, 0xaf, 0xab, 0xb0, 0x45, 0x34, 0x39, 0x38, 0x38, 0x38, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x3a, 0xa3, 0x4e, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbe, 0xaf, 0x41, 0xab, 0x43, 0x43, 0x45, 0xb0, 0x48, 0x48, 0x42, 0x55, 0x5c, 0xef, 0xf1, 0xf2, 0xf2, 0xf9, 0xf9, 0xf1, 0xf1, 0xf2, 0xf7, 0xf7, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf0, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0xef, 0xf1, 0xeb, 0xf7, 0xf5, 0xf8, 0x58, 0xca, 0xca, 0x5b, 0x61, 0x5a, 0xb5, 0xac, 0xac, 0xae, 0x48, 0x48, 0x48, 0x43, 0x47, 0xab, 0xc7, 0xb3, 0xb2, 0x47, 0xb4, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xae, 0xae, 0xaf, 0xaf, 0xae, 0xae, 0x4b, 0x3c, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x39, 0x35, 0xb0, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb3, 0x47, 0xb3, 0xc2, 0xaf, 0x42, 0xac, 0x43, 0x43, 0x48, 0x48, 0x48, 0x47, 0x41, 0x4c, 0x5d, 0x60, 0xf7, 0xd4, 0xf8, 0x58, 0x60, 0xf9, 0xeb, 0xf9, 0x5b, 0xf8, 0xf7, 0xf7, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xff, 0xf8, 0x60, 0x5b, 0x54, 0x46, 0xaa, 0xa8, 0xaa, 0xa8, 0xaa, 0xb5, 0xc0, 0xba, 0xb2, 0x48, 0xb0, 0x48, 0x48, 0xae, 0xac, 0xab, 0x41, 0xc7, 0x4c, 0xae, 0xae, 0xb4, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb0, 0xae, 0xaf, 0xae, 0xaf, 0xb0, 0xb4, 0x44, 0x34, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x35, 0x3e, 0xb4, 0xae, 0xae, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xaf, 0xc7, 0xad, 0x41, 0xac, 0x48, 0xac, 0x43, 0x40, 0x43, 0xb3, 0xb6, 0xb5, 0x53, 0xc0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x46, 0xc8, 0x5f, 0xff, 0xff, 0xf3, 0xf3, 0xf2, 0xef, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xef, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0x5b, 0x5c, 0x60, 0xc5, 0xa8, 0xa8, 0xa8, 0xaa, 0x42, 0xaa, 0x46, 0x46, 0xaa, 0x41, 0x41, 0x48, 0xb4, 0xb2, 0xac, 0x47, 0xb4, 0xae, 0xb2, 0x42, 0x53, 0xbe, 0x47, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xae, 0xb0, 0xb2, 0xb2, 0xae, 0xaf, 0xae, 0xae, 0xb0, 0x49, 0xa3, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0xb4, 0xb0, 0xb2, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xaf, 0x47, 0xae, 0x59, 0xaf, 0x42, 0xab, 0xac, 0xac, 0x43, 0xab, 0xb7, 0x4c, 0xb8, 0xb3, 0x41, 0x43, 0x42, 0x46, 0x42, 0x47, 0x47, 0xa9, 0xa8, 0xaa, 0xc9, 0x61, 0x5c, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xef, 0x5b, 0x5b, 0x61, 0x58, 0x46, 0xa8, 0xaa, 0x42, 0x42, 0x47, 0x46, 0xad, 0x46, 0x46, 0x46, 0x47, 0x47, 0x48, 0xb2, 0xb6, 0xab, 0xad, 0xae, 0xae, 0xba, 0xab, 0xc4, 0xc4, 0xae, 0xb3, 0xb0, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xb2, 0xac, 0xaf, 0xac, 0xb2, 0xb4, 0xb0, 0x40, 0x37, 0x37, 0x39, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x3d, 0x4b, 0xae, 0xae, 0xaf, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb3, 0x59, 0xab, 0xab, 0xae, 0xac, 0x41, 0x43, 0xac, 0x4c, 0xac, 0x4c, 0xb3, 0x48, 0x48, 0x47, 0xaf, 0x47, 0x47, 0x48, 0x47, 0x42, 0xaa, 0xaa, 0x57, 0x61, 0x5c, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf7, 0xca, 0x61, 0x57, 0xa8, 0xa8, 0x42, 0xaa, 0xab, 0x42, 0xab, 0xb6, 0xab, 0xad, 0xb1, 0xad, 0xb3, 0xb2, 0x53, 0x48, 0xaf, 0xad, 0xad, 0xae, 0x43, 0xb6, 0xad, 0xbe, 0xc9, 0xab, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xaf, 0xac, 0xae, 0xac, 0xac, 0xb0, 0xb0, 0x3a, 0x37, 0x39, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x3a, 0x49, 0xb0, 0xb2, 0xae, 0xae, 0xb2, 0xb0, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xae, 0xae, 0x47, 0xaf, 0xbf, 0x59, 0x42, 0xb2, 0xae, 0xac, 0xa9, 0x47, 0xb2, 0xb4, 0x48, 0x4d, 0x4b, 0x4d, 0xb2, 0xb6, 0x42, 0x4c, 0x47, 0x4b, 0x48, 0x47, 0x47, 0x41, 0xa8, 0x55, 0x5c, 0x5f, 0xf7, 0xeb, 0xf8, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0xf0, 0xeb, 0xef, 0x61, 0x57, 0xa8, 0xa8, 0xaa, 0x46, 0x41, 0xbb, 0x48, 0xa6, 0x48, 0x4b, 0xb3, 0xad, 0x42, 0xbb, 0x40, 0x36, 0x3c, 0x50, 0xb3, 0xad, 0xac, 0xab, 0xb2, 0xad, 0xbe, 0x59, 0xad, 0xb2, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xb0, 0x3f, 0x35, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x35, 0x3d, 0x4e, 0xae, 0xb6, 0xae, 0xaf, 0xb2, 0xb0, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xab, 0xc7, 0x56, 0xad, 0xb6, 0xac, 0x41, 0x43, 0x48, 0x48, 0x51, 0x45, 0x3c, 0x3b, 0x3f, 0x4d, 0x4c, 0x47, 0x4c, 0x4b, 0x45, 0x4b, 0x50, 0x43, 0x47, 0x41, 0xa4, 0x5a, 0x61, 0xf7, 0xf8, 0xf1, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xef, 0xf2, 0xf0, 0xeb, 0x5b, 0x00, 0xaa, 0xa8, 0x46, 0x46, 0xab, 0xb2, 0x31, 0x1e, 0x1e, 0x1e, 0x33, 0xb4, 0xb7, 0xac, 0x45, 0xfe, 0x17, 0x11, 0x2d, 0x4b, 0xb2, 0xac, 0xab, 0xaf, 0xad, 0xb8, 0x59, 0xb6, 0xad, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xb4, 0x40, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x35, 0x45, 0xb4, 0xae, 0xb2, 0xaf, 0xae, 0xae, 0xb0, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xae, 0xac, 0xae, 0xae, 0x59, 0xc7, 0xb3, 0xb6, 0x41, 0x40, 0x43, 0x48, 0x51, 0x3a, 0x18, 0x18, 0x18, 0xfb, 0x41, 0x4d, 0x4c, 0x49, 0x31, 0x25, 0x24, 0x31, 0x51, 0x40, 0x42, 0xa7, 0xa8, 0x58, 0xff, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf0, 0xd4, 0xec, 0xc5, 0xa4, 0xa9, 0xa4, 0xaf, 0x4d, 0x3b, 0x10, 0x22, 0x1d, 0x1f, 0x15, 0x26, 0xa9, 0x52, 0x34, 0x15, 0x24, 0x24, 0x15, 0xfe, 0x4a, 0xb2, 0xab, 0xab, 0xaf, 0x46, 0xcb, 0xc4, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xaf, 0xac, 0xae, 0xb4, 0x3d, 0x34, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x3d, 0x4e, 0xac, 0xb2, 0xaf, 0xaf, 0xb2, 0xb2, 0xb0, 0xb0, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0x47, 0xb7, 0x5d, 0xc2, 0x4f, 0xac, 0x41, 0x40, 0x48, 0x4b, 0x44, 0x17, 0x1d, 0x1d, 0x1b, 0x18, 0x34, 0x50, 0x51, 0x1e, 0x18, 0x1d, 0x24, 0x18, 0x24, 0xbf, 0x48, 0xb3, 0xaa, 0xb1, 0xca, 0xf7, 0xf9, 0xf1, 0xf9, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0x5f, 0xaa, 0xaa, 0xad, 0xb6, 0xb2, 0x4d, 0x33, 0x18, 0x21, 0x1c, 0x21, 0x1f, 0x12, 0x34, 0x51, 0x38, 0x1a, 0x27, 0x24, 0x22, 0x18, 0x3a, 0xb6, 0xac, 0xab, 0xad, 0x42, 0xc9, 0xc9, 0xad, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xb0, 0x3f, 0x35, 0x39, 0x38, 0x38, 0x38, 0x38, 0x35, 0x40, 0x4d, 0xb0, 0xb3, 0xb2, 0xaf, 0xae, 0xb2, 0xb0, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xaf, 0xb0, 0xae, 0xae, 0xaf, 0x42, 0xc4, 0x59, 0xc4, 0xbc, 0x41, 0x41, 0x48, 0x48, 0x4b, 0x3e, 0x18, 0x1b, 0x23, 0x1c, 0x12, 0x35, 0x51, 0x3e, 0x19, 0x23, 0x27, 0x23, 0x23, 0x1e, 0x40, 0xbb, 0x4c, 0x4c, 0xaa, 0xc5, 0xf9, 0xf9, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xef, 0x5f, 0x58, 0xa8, 0x46, 0xaf, 0xb1, 0xb3, 0xc0, 0x36, 0x0e, 0x21, 0x21, 0x21, 0x1d, 0x17, 0x26, 0x52, 0x3e, 0x17, 0x24, 0x24, 0x22, 0x1e, 0x31, 0xb2, 0xac, 0xad, 0x47, 0x42, 0x53, 0xcb, 0xb3, 0x46, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xb0, 0x3a, 0x3a, 0x37, 0x38, 0x38, 0x37, 0xa3, 0xb4, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb0, 0xb2, 0xad, 0x42, 0xc9, 0xcb, 0xc2, 0xb3, 0xa9, 0x41, 0xac, 0x43, 0x4b, 0x3d, 0x17, 0x1d, 0x1c, 0x1c, 0x18, 0x3a, 0x52, 0x31, 0x1b, 0x27, 0x27, 0x21, 0x22, 0x91, 0xbc, 0x4c, 0x4c, 0x4c, 0xb2, 0x47, 0x5a, 0x5f, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf1, 0xf3, 0xf0, 0xf2, 0xef, 0xf3, 0x5f, 0xbd, 0xaa, 0xb5, 0xaf, 0xb5, 0xb1, 0xb5, 0xa6, 0x11, 0x21, 0x21, 0x1c, 0x1d, 0x15, 0x2d, 0x51, 0x4b, 0x20, 0x1a, 0x1e, 0x1e, 0x17, 0x3c, 0xb2, 0xae, 0xab, 0x47, 0x42, 0xb5, 0x5d, 0x55, 0xaa, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb2, 0xb0, 0xb4, 0x3d, 0x35, 0x38, 0x38, 0x38, 0x37, 0x3f, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xaf, 0xab, 0xb5, 0xcb, 0x59, 0xbc, 0x41, 0x41, 0xab, 0xab, 0xab, 0x48, 0x45, 0x1e, 0x17, 0x22, 0x1d, 0x17, 0xb4, 0x4b, 0x99, 0x1b, 0x23, 0x21, 0x24, 0x19, 0x32, 0xc4, 0xb6, 0xb6, 0x4c, 0xb3, 0x46, 0xc5, 0xf7, 0xeb, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xef, 0x61, 0xb1, 0x42, 0xaf, 0xb7, 0xb9, 0xb1, 0xb1, 0xba, 0x25, 0x15, 0x1f, 0x21, 0x1b, 0x0f, 0xa0, 0xb2, 0xbb, 0x40, 0x14, 0x1e, 0xfb, 0x3a, 0xb6, 0xae, 0xab, 0xae, 0x47, 0xad, 0x42, 0xc9, 0x59, 0xad, 0xad, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0x48, 0xb4, 0x40, 0x34, 0x39, 0x38, 0x38, 0x3a, 0x48, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x42, 0xc4, 0xcb, 0x57, 0xae, 0xa9, 0x43, 0xab, 0xab, 0x43, 0xac, 0x4d, 0xa6, 0x17, 0x14, 0x0e, 0x3c, 0x4d, 0x52, 0x2a, 0x1e, 0x26, 0x24, 0x19, 0x26, 0xbf, 0xb6, 0xc2, 0xba, 0xb6, 0xb5, 0x46, 0xb1, 0xf2, 0xeb, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf1, 0xf3, 0xf2, 0xf2, 0xef, 0xf3, 0x5b, 0xaa, 0xad, 0xbb, 0xa6, 0x9f, 0xaf, 0xb7, 0xba, 0x40, 0x16, 0x0e, 0x17, 0x17, 0x33, 0xb4, 0xb7, 0xab, 0xbb, 0x48, 0xa6, 0x4e, 0xb4, 0xab, 0xac, 0xac, 0xae, 0x47, 0xad, 0x42, 0xc4, 0xcb, 0xb5, 0xab, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xac, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xb2, 0xb0, 0xb0, 0x3a, 0x39, 0x38, 0x37, 0x3d, 0xb4, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xac, 0xaf, 0x46, 0x59, 0xcb, 0xc2, 0xaa, 0x43, 0x41, 0xab, 0xab, 0xab, 0xac, 0xa9, 0x4d, 0x48, 0x3f, 0x45, 0x50, 0x47, 0x4d, 0xab, 0x2a, 0x8a, 0x1e, 0x31, 0x4e, 0x50, 0x4e, 0xa5, 0x9f, 0x50, 0xb3, 0xb5, 0xb1, 0xd4, 0xeb, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xca, 0x42, 0x4f, 0xa0, 0x20, 0x89, 0x25, 0x45, 0x4b, 0x4d, 0x40, 0x32, 0x31, 0xa6, 0x4b, 0xb4, 0xb6, 0xbb, 0xc3, 0x51, 0x52, 0x4b, 0xac, 0xab, 0xae, 0x48, 0x47, 0xac, 0x47, 0x42, 0xb8, 0xcb, 0xc4, 0xad, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0x48, 0xb2, 0xb4, 0x3d, 0x3a, 0x37, 0x37, 0x3f, 0xb4, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xaf, 0xb8, 0xcb, 0xc9, 0xbc, 0xa9, 0x43, 0x43, 0x41, 0xab, 0xab, 0x43, 0xb2, 0x43, 0x4d, 0x52, 0x50, 0x50, 0x4d, 0x4d, 0x4b, 0x4d, 0x41, 0x4b, 0x4d, 0x56, 0x3e, 0x26, 0x12, 0x06, 0x32, 0x52, 0xb5, 0xb5, 0x58, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xca, 0x42, 0xba, 0x2a, 0x16, 0x1b, 0x1b, 0x1e, 0x44, 0x48, 0xac, 0xb8, 0xb6, 0x4b, 0x51, 0x45, 0x3a, 0x96, 0x28, 0x31, 0x37, 0x49, 0x4d, 0x48, 0x48, 0xb2, 0x48, 0xac, 0xb2, 0x42, 0xad, 0xc9, 0x5a, 0x47, 0xac, 0xac, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xac, 0xac, 0xb4, 0x3f, 0x37, 0x34, 0x3a, 0xb0, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xac, 0xac, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xad, 0xab, 0x55, 0xcb, 0xc9, 0xb3, 0x41, 0x43, 0x40, 0xab, 0x43, 0x43, 0x48, 0x45, 0x49, 0xa0, 0x31, 0x2a, 0x31, 0x3a, 0x4b, 0x4b, 0x48, 0xb4, 0xb6, 0x50, 0x33, 0x17, 0x15, 0x19, 0x19, 0x1e, 0x45, 0x4c, 0xb3, 0x58, 0x5c, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xef, 0xf3, 0x5a, 0xad, 0x4e, 0x1e, 0x19, 0x1b, 0x22, 0x0e, 0x29, 0x40, 0xaf, 0xaa, 0xb2, 0x51, 0x34, 0x24, 0x11, 0x17, 0x17, 0x12, 0x15, 0x24, 0x34, 0x51, 0x4d, 0x49, 0x43, 0x48, 0xab, 0xaf, 0xaa, 0xc4, 0x5d, 0xb8, 0x43, 0xae, 0x47, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb2, 0xac, 0xb2, 0x48, 0x37, 0x35, 0x3a, 0xbf, 0xaf, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0x46, 0x59, 0xcb, 0xc9, 0x42, 0xa9, 0x48, 0x40, 0x43, 0x48, 0x45, 0x4b, 0x3e, 0x2a, 0x12, 0x17, 0x18, 0x17, 0x18, 0x26, 0x3e, 0x51, 0x47, 0xb2, 0x40, 0x14, 0x15, 0x1b, 0x1b, 0x19, 0x1e, 0x45, 0x4c, 0xb3, 0x58, 0x60, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0x5f, 0x58, 0x42, 0x4d, 0x26, 0x19, 0x1b, 0x1b, 0x1b, 0x0a, 0x35, 0xab, 0xac, 0x48, 0x29, 0x15, 0x18, 0x1d, 0x1d, 0x1d, 0x1f, 0x23, 0x18, 0x18, 0x26, 0x45, 0x4d, 0x48, 0xb2, 0x41, 0xaf, 0xaa, 0xb5, 0xcb, 0xc9, 0xb2, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0x47, 0xae, 0xb0, 0xb4, 0xa3, 0x34, 0x3f, 0xbb, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0x47, 0xad, 0x4f, 0x5d, 0xc9, 0xc4, 0xaa, 0x43, 0x43, 0x48, 0x43, 0x49, 0x4b, 0x33, 0x15, 0x15, 0x22, 0x21, 0x1d, 0x22, 0x1b, 0x1f, 0x15, 0x35, 0x50, 0xbe, 0x3a, 0x0e, 0x1b, 0x1b, 0x1b, 0x19, 0x25, 0x4b, 0x4c, 0xb1, 0x5a, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xcb, 0xad, 0x4e, 0x31, 0x12, 0x19, 0x1b, 0x19, 0x17, 0xa3, 0xae, 0x4e, 0x31, 0x15, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x21, 0x21, 0x1c, 0x17, 0x26, 0x40, 0x4d, 0x43, 0xac, 0xab, 0x42, 0xad, 0x57, 0x5d, 0xb4, 0xab, 0xb2, 0xab, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xab, 0xb6, 0xac, 0x4e, 0x3d, 0x34, 0x49, 0xae, 0xaf, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xb2, 0xac, 0xae, 0x47, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xad, 0x55, 0xcc, 0xc9, 0xbc, 0xaa, 0x43, 0x40, 0x43, 0x45, 0x4a, 0x31, 0x15, 0x1d, 0x21, 0x21, 0x21, 0x21, 0x23, 0x21, 0x23, 0x1d, 0x18, 0x35, 0x52, 0x44, 0x12, 0x1b, 0x1b, 0x15, 0x09, 0x33, 0xbb, 0xad, 0xb5, 0xd4, 0x5b, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0x5f, 0xb1, 0xaf, 0x40, 0x8e, 0x12, 0x19, 0x0a, 0x2a, 0x49, 0x48, 0x3e, 0x15, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1f, 0x1c, 0x1c, 0x1f, 0x1f, 0x1c, 0x1c, 0x26, 0x4b, 0xb2, 0xab, 0xab, 0xac, 0x42, 0xc5, 0x5c, 0x55, 0x46, 0xaf, 0xae, 0xae, 0xb2, 0xae, 0xaf, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xac, 0xae, 0xae, 0x48, 0xae, 0x48, 0xae, 0x48, 0xae, 0x48, 0xae, 0xac, 0xac, 0xb2, 0xb0, 0xb4, 0x40, 0x9a, 0xb4, 0xae, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb0, 0xac, 0xac, 0xae, 0xac, 0xb2, 0xb2, 0xac, 0xb0, 0x46, 0xb1, 0x60, 0x59, 0xc9, 0xb3, 0x43, 0x43, 0x43, 0x49, 0x4b, 0x33, 0x18, 0x1d, 0x23, 0x21, 0x23, 0x21, 0x21, 0x21, 0x22, 0x21, 0x23, 0x1d, 0x18, 0x4a, 0x51, 0x2d, 0x0a, 0x19, 0x0a, 0x25, 0x4b, 0xb4, 0xad, 0xb9, 0xca, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0x5b, 0xc0, 0xaa, 0xba, 0x40, 0x25, 0x12, 0x26, 0xa6, 0xb4, 0x4b, 0x31, 0x15, 0x1d, 0x1c, 0x1c, 0x1f, 0x1c, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1c, 0x15, 0x33, 0xb7, 0xac, 0x43, 0xae, 0x42, 0xc0, 0x5b, 0xcb, 0xb5, 0xad, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xae, 0xae, 0x47, 0xae, 0x47, 0xae, 0x47, 0xae, 0x47, 0xae, 0xae, 0xae, 0x48, 0xae, 0x48, 0xae, 0x48, 0xae, 0x48, 0xaf, 0xac, 0xb2, 0xb0, 0xb4, 0x43, 0x35, 0xba, 0xb0, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0x47, 0xae, 0x47, 0xae, 0x47, 0xae, 0xae, 0xae, 0xb0, 0xac, 0xae, 0xae, 0xb2, 0xab, 0xae, 0xb6, 0xad, 0x54, 0x5d, 0xc9, 0x57, 0x43, 0x42, 0x40, 0x48, 0xb0, 0x3f, 0x1e, 0x1b, 0x22, 0x21, 0x21, 0x21, 0x21, 0x22, 0x22, 0x21, 0x22, 0x21, 0x23, 0x18, 0x33, 0x51, 0x4b, 0x93, 0x16, 0x26, 0x3f, 0x4e, 0xb4, 0x42, 0xbd, 0x5b, 0xeb, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xff, 0xc5, 0xad, 0xab, 0x4e, 0x4b, 0x3f, 0x4b, 0xb4, 0x40, 0x4b, 0x26, 0x15, 0x1c, 0x1c, 0x1c, 0x1f, 0x1c, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1c, 0x21, 0x1d, 0x1e, 0x40, 0xb0, 0x48, 0x48, 0x42, 0xb8, 0x58, 0x61, 0xc5, 0x46, 0xaf, 0xac, 0xb2, 0xae, 0xb2, 0xae, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0x47, 0xae, 0x48, 0xae, 0xac, 0x48, 0xae, 0xac, 0x48, 0xae, 0xac, 0xaf, 0xb2, 0xac, 0xb4, 0xb0, 0xa1, 0xb7, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xac, 0xb0, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xaf, 0x43, 0xb5, 0xcb, 0x5c, 0x57, 0x55, 0x41, 0x43, 0x43, 0x48, 0x4b, 0x33, 0x0e, 0x22, 0x1d, 0x23, 0x21, 0x23, 0x21, 0x22, 0x22, 0x22, 0x23, 0x21, 0x22, 0x1d, 0x29, 0x51, 0x47, 0x50, 0x49, 0x52, 0x4e, 0x48, 0xb6, 0x46, 0xc5, 0x5f, 0xf8, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf8, 0x5b, 0xad, 0xab, 0x48, 0x48, 0xb0, 0x41, 0x43, 0xac, 0x48, 0x25, 0x18, 0x1c, 0x1c, 0x1c, 0x1f, 0x1c, 0x1f, 0x1f, 0x1c, 0x1f, 0x1f, 0x1c, 0x1c, 0x21, 0x17, 0x31, 0x4e, 0x40, 0xb2, 0xab, 0xb5, 0x5a, 0x58, 0x5a, 0xbd, 0x42, 0xaf, 0xae, 0xb0, 0xb0, 0xb0, 0x47, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x48, 0xb2, 0xae, 0x48, 0xae, 0xae, 0x48, 0xae, 0xae, 0xae, 0xac, 0xb0, 0xbb, 0xa6, 0xba, 0xae, 0xac, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0x47, 0xae, 0x47, 0xae, 0xae, 0xb0, 0xae, 0xac, 0xac, 0xb3, 0xae, 0x42, 0x55, 0x60, 0x5a, 0x57, 0xc7, 0x42, 0x43, 0x43, 0x48, 0x40, 0x24, 0x1d, 0x22, 0x1f, 0x23, 0x21, 0x21, 0x22, 0x22, 0x22, 0x21, 0x21, 0x23, 0x21, 0x22, 0x25, 0x45, 0x4d, 0xae, 0xb4, 0xb0, 0xac, 0xb6, 0xb3, 0x46, 0xc8, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf3, 0xf0, 0x5f, 0xca, 0xb9, 0x42, 0x47, 0xac, 0x43, 0xae, 0x42, 0x48, 0x48, 0x25, 0x15, 0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x21, 0x21, 0x21, 0x18, 0x24, 0x51, 0x43, 0x48, 0x42, 0xb6, 0x58, 0x58, 0x5c, 0xc8, 0x46, 0xaf, 0xae, 0xb2, 0xb0, 0xb0, 0xac, 0xae, 0xac, 0xac, 0xae, 0xac, 0xac, 0xac, 0xac, 0xae, 0x48, 0xae, 0xac, 0x48, 0xae, 0xac, 0x48, 0xb2, 0xac, 0xae, 0xae, 0xac, 0xac, 0xbb, 0xab, 0xba, 0xb2, 0xaf, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xae, 0xae, 0xb0, 0xae, 0xae, 0xb3, 0x42, 0xb5, 0x5c, 0xcb, 0x57, 0xc9, 0xc0, 0x43, 0x47, 0x43, 0x48, 0x3d, 0x1d, 0x1d, 0x22, 0x23, 0x21, 0x21, 0x22, 0x22, 0x22, 0x22, 0x23, 0x22, 0x21, 0x22, 0x22, 0x1e, 0x4b, 0xb2, 0xb3, 0xac, 0xb7, 0xb3, 0xab, 0x46, 0xb5, 0xca, 0xf8, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf3, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf2, 0xf2, 0xd4, 0x5f, 0xc8, 0xaa, 0xab, 0xab, 0x42, 0x42, 0xab, 0xab, 0x4b, 0x26, 0x15, 0x1c, 0x1f, 0x1c, 0x1c, 0x1c, 0x1c, 0x1f, 0x1f, 0x1c, 0x1f, 0x1c, 0x1c, 0x21, 0x1d, 0x15, 0x49, 0xb0, 0xae, 0xab, 0xb3, 0x57, 0x54, 0x58, 0xcb, 0xb9, 0xad, 0x47, 0xb4, 0x48, 0xb0, 0xae, 0xae, 0x47, 0xae, 0xae, 0xac, 0x47, 0xac, 0x47, 0xae, 0xac, 0xac, 0x48, 0xac, 0xb2, 0x43, 0xae, 0xb2, 0x48, 0xab, 0xae, 0xae, 0xae, 0xb7, 0xc2, 0xb6, 0xae, 0xae, 0xb2, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xb0, 0xac, 0xac, 0xad, 0x46, 0x55, 0x60, 0x5a, 0x55, 0xc9, 0xbe, 0x42, 0x48, 0x41, 0xb4, 0x35, 0x1b, 0x21, 0x22, 0x23, 0x22, 0x21, 0x22, 0x22, 0x22, 0x21, 0x21, 0x23, 0x21, 0x22, 0x1d, 0x25, 0x4b, 0xae, 0xb3, 0xaf, 0xad, 0xb3, 0xb5, 0x42, 0xc5, 0x5b, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0x5f, 0x5c, 0xad, 0xaa, 0xab, 0x42, 0xab, 0xab, 0x43, 0x51, 0x2a, 0x15, 0x1f, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x21, 0x1c, 0x21, 0x15, 0x3e, 0xb4, 0xab, 0xad, 0xb3, 0xc9, 0x54, 0xc8, 0x5b, 0x57, 0x46, 0xad, 0xb2, 0x43, 0xb4, 0xae, 0xae, 0xac, 0xac, 0xae, 0xac, 0xac, 0xac, 0xac, 0xac, 0x48, 0xac, 0xac, 0xac, 0x48, 0xac, 0x48, 0xac, 0xac, 0x48, 0xae, 0xac, 0xad, 0xb6, 0xc4, 0xb6, 0x47, 0xb2, 0xac, 0xac, 0xb6, 0xb7, 0xb2, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0x47, 0xaf, 0xb0, 0xae, 0xb0, 0xb6, 0x42, 0x4f, 0xca, 0xcb, 0xc8, 0x55, 0x57, 0x4f, 0x43, 0xac, 0x43, 0x4e, 0x33, 0x1b, 0x22, 0x22, 0x23, 0x21, 0x22, 0x21, 0x22, 0x21, 0x22, 0x21, 0x23, 0x21, 0x22, 0x18, 0x2a, 0x4d, 0xb3, 0xad, 0xaf, 0x42, 0xaf, 0xad, 0x46, 0x58, 0x5b, 0xef, 0xf1, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0x61, 0xc5, 0x42, 0x42, 0xab, 0xab, 0xab, 0x48, 0x51, 0x37, 0x15, 0x1b, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1f, 0x1f, 0x1c, 0x1f, 0x1f, 0x1d, 0x1f, 0x21, 0x15, 0x37, 0x4c, 0x42, 0xad, 0xad, 0x57, 0x55, 0xc8, 0x57, 0x5b, 0x55, 0x42, 0xaf, 0xb2, 0xac, 0xac, 0xae, 0x47, 0xae, 0xae, 0xac, 0xac, 0xac, 0x47, 0xae, 0x48, 0xac, 0x48, 0xac, 0xae, 0xae, 0x48, 0xac, 0x48, 0xae, 0xae, 0xad, 0xab, 0xb3, 0x59, 0xaf, 0x47, 0x47, 0xae, 0x43, 0xba, 0xb6, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xb0, 0xac, 0xb2, 0xb3, 0x57, 0x61, 0x58, 0x54, 0x55, 0x57, 0xbc, 0xab, 0x43, 0x48, 0x4e, 0x33, 0x18, 0x21, 0x1d, 0x22, 0x22, 0x21, 0x23, 0x21, 0x23, 0x21, 0x23, 0x21, 0x23, 0x22, 0x15, 0x34, 0x4b, 0xb3, 0xad, 0xb3, 0xb6, 0xb3, 0x42, 0xb9, 0x5c, 0xf7, 0xef, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xef, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf2, 0xf0, 0xeb, 0xd4, 0x5b, 0x5a, 0xb5, 0x42, 0xab, 0x47, 0x43, 0x48, 0x4b, 0x44, 0x18, 0x18, 0x1b, 0x1c, 0x1c, 0x1c, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1f, 0x21, 0x15, 0x3a, 0xb7, 0xaa, 0xb1, 0xb3, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x5b, 0xb8, 0xad, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xac, 0xac, 0x48, 0xac, 0x48, 0xac, 0x48, 0xae, 0x48, 0xac, 0xb2, 0xb7, 0x47, 0xae, 0xab, 0xad, 0xad, 0x5d, 0xaf, 0xac, 0x48, 0xac, 0xae, 0xbf, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xb0, 0xb0, 0xae, 0xbe, 0x5c, 0xf8, 0xc8, 0x55, 0xc5, 0xc9, 0xc0, 0x47, 0x47, 0x43, 0x4e, 0x34, 0x1b, 0x22, 0x22, 0x23, 0x1f, 0x23, 0x21, 0x21, 0x21, 0x21, 0x21, 0x23, 0x21, 0x23, 0x15, 0x44, 0x4d, 0xad, 0xb3, 0xb2, 0xb6, 0x47, 0xb3, 0x57, 0x5c, 0x5b, 0xf2, 0xf0, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf2, 0xf2, 0xf3, 0x5b, 0xff, 0x54, 0xaa, 0x47, 0xaa, 0xab, 0xad, 0x48, 0x51, 0x26, 0x15, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x21, 0x1c, 0x1f, 0x1f, 0x1f, 0x1c, 0x1f, 0x1f, 0x15, 0x3e, 0xb4, 0xad, 0xab, 0xb3, 0x57, 0x55, 0xc5, 0x54, 0x54, 0xcb, 0x57, 0x42, 0xaf, 0xac, 0xb3, 0xae, 0xae, 0xb4, 0xab, 0xac, 0x47, 0xaf, 0x47, 0xab, 0xae, 0xae, 0xac, 0xab, 0xae, 0xae, 0xab, 0xae, 0xbe, 0xb2, 0xb3, 0xab, 0x42, 0xaf, 0xcc, 0xad, 0x47, 0xac, 0xaf, 0x47, 0xc4, 0xab, 0xae, 0x47, 0xb2, 0x47, 0xae, 0xb2, 0xae, 0x47, 0xac, 0xac, 0xae, 0xae, 0xac, 0xac, 0xac, 0xae, 0xae, 0xae, 0xaf, 0xab, 0xb5, 0xc9, 0x5c, 0x57, 0x54, 0x55, 0xc5, 0xc9, 0xbe, 0x42, 0x48, 0x48, 0x4d, 0x3a, 0x1d, 0x1d, 0x22, 0x22, 0x23, 0x1d, 0x23, 0x23, 0x22, 0x23, 0x21, 0x21, 0x23, 0x18, 0x26, 0x51, 0x4d, 0x47, 0xb6, 0x48, 0x47, 0x42, 0xbd, 0x5c, 0xf7, 0xf1, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 
-  0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf8, 0xef, 0xf3, 0xf3, 0x4f, 0x42, 0xad, 0xad, 0x42, 0xab, 0x50, 0x3e, 0x17, 0x1d, 0x1d, 0x1f, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x21, 0x1c, 0x21, 0x1f, 0x1d, 0x14, 0x4b, 0xae, 0xae, 0xab, 0xb6, 0xc4, 0x55, 0x54, 0xc5, 0x54, 0x57, 0x5c, 0x55, 0xaa, 0xb3, 0x47, 0xae, 0x43, 0xb2, 0xb0, 0xac, 0xac, 0xab, 0xad, 0xac, 0xae, 0xae, 0xac, 0xb2, 0x47, 0xb3, 0x47, 0xad, 0xbc, 0xc4, 0xab, 0x43, 0xab, 0xbd, 0xcc, 0xbd, 0x42, 0x47, 0x42, 0xb8, 0xbc, 0xab, 0xaf, 0x47, 0xae, 0xae, 0x43, 0xba, 0x47, 0xb2, 0xb2, 0xae, 0xae, 0xac, 0x43, 0xb0, 0xac, 0xac, 0xb3, 0xac, 0xb5, 0x42, 0x55, 0xcc, 0xc9, 0xc8, 0x55, 0x55, 0xc5, 0xc9, 0xc4, 0xab, 0x47, 0x43, 0xb4, 0x3f, 0x1d, 0x22, 0x1d, 0x21, 0x1d, 0x21, 0x22, 0x22, 0x22, 0x23, 0x23, 0x21, 0x1d, 0x1e, 0x3b, 0x50, 0xb2, 0xb2, 0xae, 0xb2, 0xaf, 0x46, 0x58, 0xf3, 0xf1, 0xf2, 0x5b, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xef, 0xf8, 0xf3, 0xff, 0x5a, 0xb3, 0x42, 0xad, 0x42, 0xaf, 0x45, 0x51, 0x31, 0x0e, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x21, 0x1c, 0x21, 0x1c, 0x21, 0x18, 0x26, 0x4e, 0xb0, 0xac, 0x43, 0xb7, 0x55, 0xc5, 0xc8, 0xc5, 0x54, 0xc5, 0x54, 0x5d, 0xc0, 0x42, 0xb3, 0x4c, 0x48, 0xac, 0xb0, 0xae, 0xae, 0xaf, 0xab, 0xae, 0xac, 0xb0, 0xae, 0xb7, 0xac, 0xac, 0xaf, 0xae, 0xb8, 0xc9, 0xac, 0x42, 0xb3, 0xc5, 0xcc, 0x54, 0xa8, 0x47, 0xaa, 0x56, 0xad, 0xb2, 0xb3, 0xae, 0xae, 0xab, 0xb7, 0xb2, 0xae, 0xb2, 0xae, 0xac, 0xac, 0xac, 0xac, 0xae, 0xb0, 0xac, 0xac, 0xad, 0x42, 0xbd, 0x5c, 0x5a, 0x54, 0xc5, 0xc8, 0x55, 0x55, 0x57, 0x53, 0x42, 0x48, 0x48, 0x48, 0x4b, 0x29, 0x15, 0x22, 0x1d, 0x23, 0x21, 0x21, 0x23, 0x22, 0x21, 0x23, 0x23, 0x15, 0x31, 0x51, 0xb4, 0x48, 0xb2, 0xae, 0xb2, 0xad, 0xc5, 0xff, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xef, 0x5b, 0x58, 0x46, 0x46, 0xae, 0x47, 0x48, 0x48, 0x4b, 0x26, 0x15, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x21, 0x1f, 0x1d, 0x17, 0x3e, 0x4b, 0xac, 0xac, 0xab, 0xbc, 0xc7, 0x55, 0xc5, 0xc5, 0xc5, 0x54, 0x5a, 0x5c, 0x5c, 0xb9, 0x41, 0xab, 0xb6, 0xb0, 0xac, 0xb0, 0xac, 0xae, 0xb2, 0xac, 0xae, 0xae, 0xb2, 0xba, 0xb7, 0xb3, 0xae, 0xb6, 0xaf, 0xc9, 0x4f, 0x47, 0xaa, 0x57, 0x5f, 0xc8, 0xaa, 0x42, 0xb3, 0x56, 0xab, 0xb6, 0xae, 0xb6, 0xae, 0xb7, 0xc2, 0x43, 0xb2, 0xb2, 0x43, 0xae, 0xb2, 0xb0, 0xac, 0xac, 0xae, 0xae, 0xac, 0xad, 0xb5, 0xcb, 0x5c, 0xca, 0xf8, 0xc8, 0xc5, 0x55, 0x55, 0x55, 0xc9, 0x41, 0xab, 0x48, 0x43, 0x51, 0x3b, 0x17, 0x22, 0x1b, 0x23, 0x1f, 0x23, 0x21, 0x23, 0x23, 0x1b, 0x18, 0x26, 0x51, 0x4b, 0xb4, 0xae, 0xac, 0xb3, 0xb3, 0x4f, 0x5c, 0xf7, 0xef, 0xf1, 0xf1, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xef, 0xf3, 0x61, 0x54, 0x42, 0x47, 0x47, 0x48, 0xb2, 0xb2, 0x48, 0x26, 0x0e, 0x1d, 0x1b, 0x1f, 0x1f, 0x1c, 0x21, 0x1f, 0x1d, 0x12, 0x2f, 0x4e, 0x45, 0xae, 0xae, 0xab, 0xc2, 0x55, 0x55, 0xc5, 0x54, 0x58, 0x5b, 0xf9, 0x5b, 0xf9, 0xcb, 0x4f, 0x41, 0xb6, 0xae, 0xb0, 0xab, 0xac, 0xb2, 0xb6, 0xac, 0xb0, 0xb2, 0xae, 0xb7, 0xc3, 0xb2, 0xb2, 0xb6, 0xb3, 0xc5, 0xc0, 0x46, 0x46, 0xca, 0x5f, 0xca, 0xbd, 0xaa, 0x50, 0xc2, 0xb2, 0xb6, 0xb2, 0x47, 0xaf, 0xc7, 0xb6, 0x43, 0xb2, 0xb0, 0xac, 0xbb, 0xb7, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xab, 0xad, 0x5a, 0x5c, 0xf3, 0x5b, 0xf3, 0xf3, 0xf8, 0x57, 0xc5, 0x55, 0x59, 0xb3, 0x41, 0xae, 0xac, 0x48, 0x51, 0x2a, 0x17, 0x1b, 0x22, 0x22, 0x21, 0x23, 0x23, 0x1d, 0x17, 0x25, 0x44, 0x4b, 0xb2, 0xb6, 0xb2, 0xaf, 0xaf, 0xb1, 0xcb, 0x5b, 0xf8, 0xf7, 0xf1, 0xf2, 0xf3, 0x5b, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 
-  0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xff, 0x55, 0xaa, 0x47, 0x47, 0xab, 0xad, 0x4e, 0x51, 0x34, 0x1a, 0x15, 0x18, 0x18, 0x1d, 0x18, 0x1b, 0x17, 0x2f, 0x52, 0x40, 0xb0, 0xae, 0x42, 0xb3, 0x55, 0x55, 0x55, 0x58, 0xca, 0xf9, 0xf7, 0x5b, 0xf3, 0x5b, 0xf9, 0x5c, 0x46, 0x42, 0x47, 0xae, 0xac, 0xb4, 0xab, 0xc3, 0xbb, 0xab, 0xae, 0xae, 0xac, 0x4c, 0xc6, 0xab, 0xb7, 0xb1, 0xc0, 0xc5, 0x46, 0x5a, 0x5f, 0xd4, 0x5f, 0x5b, 0xb5, 0xc0, 0x53, 0xb3, 0x47, 0xaf, 0xaf, 0xc7, 0xc2, 0x41, 0xb4, 0x43, 0xae, 0xbb, 0xc3, 0xac, 0xac, 0xae, 0xb6, 0xac, 0xad, 0x46, 0xc9, 0x61, 0xca, 0xf3, 0xef, 0xef, 0xf1, 0x5b, 0x5b, 0x5a, 0x54, 0x55, 0xc4, 0x42, 0x43, 0xab, 0x43, 0x4e, 0x4b, 0x31, 0x17, 0x18, 0x1d, 0x22, 0x21, 0x18, 0x19, 0x2a, 0x4d, 0x4d, 0xb2, 0xb6, 0xad, 0xad, 0xab, 0xb5, 0x5a, 0x5f, 0x5b, 0xf7, 0xf7, 0xf3, 0xf3, 0xef, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xef, 0xf3, 0xf3, 0x5b, 0x5b, 0x55, 0x42, 0x46, 0x42, 0xad, 0xab, 0x4d, 0x51, 0x3f, 0x33, 0x25, 0x1e, 0x18, 0x25, 0x26, 0x35, 0x51, 0x48, 0x48, 0xac, 0x42, 0xab, 0xbd, 0x55, 0x55, 0x58, 0x5f, 0xff, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0x60, 0x5c, 0xb9, 0xaa, 0xb3, 0xab, 0xb2, 0x47, 0xb6, 0x59, 0xac, 0xab, 0xb2, 0xb3, 0xaf, 0xc7, 0xb8, 0xad, 0xb3, 0xc1, 0x58, 0xcb, 0xf9, 0x5b, 0xf2, 0xeb, 0x5f, 0xcb, 0xc9, 0xc0, 0x46, 0xb5, 0xb3, 0xbc, 0x56, 0xaf, 0xae, 0xac, 0xb4, 0x41, 0xc7, 0xb6, 0xb6, 0xb3, 0xb3, 0xad, 0xad, 0x46, 0x57, 0x61, 0x5f, 0xf8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf8, 0x5b, 0x5f, 0x5c, 0xc8, 0x55, 0x42, 0x42, 0x47, 0xae, 0x41, 0x4d, 0x50, 0x3a, 0x2a, 0x24, 0x19, 0x24, 0x2f, 0x3b, 0x52, 0xb0, 0xb6, 0xab, 0xad, 0xb5, 0x42, 0xb9, 0x5a, 0x5b, 0xf3, 0xf3, 0xf8, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 
-  0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xf8, 0xf7, 0xf9, 0xf9, 0x54, 0xaa, 0xad, 0xaf, 0x47, 0xb2, 0x43, 0x4d, 0x52, 0x51, 0x51, 0x4b, 0x51, 0x52, 0x50, 0x48, 0x48, 0xab, 0xb3, 0xaa, 0xb1, 0x55, 0x58, 0x5f, 0x5f, 0xf8, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0x5b, 0xef, 0x5b, 0x5c, 0xc0, 0x42, 0xb3, 0xb3, 0xb3, 0xab, 0xbb, 0xcb, 0xad, 0xad, 0xad, 0xb3, 0x4f, 0x55, 0xb5, 0xb1, 0xc1, 0xcb, 0xf9, 0x5b, 0xf2, 0xf0, 0xef, 0xf8, 0xf9, 0x5c, 0x58, 0xc0, 0x46, 0xb5, 0xc9, 0xbc, 0xad, 0xae, 0xb3, 0xae, 0xc7, 0xc2, 0xb3, 0xad, 0xb5, 0xad, 0x46, 0xb3, 0x5b, 0x61, 0xf8, 0xf8, 0xf7, 0xef, 0xf1, 0xf1, 0xf3, 0xf2, 0xf1, 0xf8, 0x5b, 0x5f, 0x5a, 0xc5, 0x46, 0xaa, 0xab, 0xb3, 0x47, 0x48, 0x50, 0x51, 0x51, 0x52, 0x51, 0x52, 0x4e, 0xb0, 0xb6, 0xaf, 0xb5, 0xb1, 0xaa, 0xc1, 0x5c, 0x5f, 0xf1, 0xf1, 0xef, 0xef, 0xf3, 0xf3, 0xef, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0x5b, 0xf9, 0xf3, 0xf2, 0xf2, 0xeb, 0x58, 0xb1, 0x41, 0x42, 0xad, 0x47, 0xab, 0xb2, 0x47, 0x47, 0xb2, 0xb3, 0x47, 0xab, 0xb3, 0xab, 0x42, 0x42, 0xb1, 0x57, 0x5b, 0x5f, 0xf3, 0xf7, 0xf2, 0xf1, 0xf0, 0xf1, 0xf3, 0xf3, 0x5b, 0xf9, 0xf3, 0xf3, 0x5b, 0x5b, 0x57, 0xb5, 0xb3, 0x47, 0xb3, 0x46, 0xc7, 0x59, 0x46, 0xb5, 0xb5, 0x46, 0x55, 0xc5, 0xc5, 0xef, 0x5b, 0x5b, 0xf9, 0xf1, 0xf0, 0xf0, 0xf3, 0x5b, 0xf9, 0x5b, 0xca, 0xbd, 0xc5, 0x59, 0xb3, 0xae, 0xae, 0xb2, 0xb6, 0x59, 0xb3, 0xb8, 0xb3, 0x46, 0xb1, 0xc5, 0xcb, 0xff, 0xf7, 0xf3, 0xf1, 0xf1, 0xf0, 0xf1, 0xef, 0x5b, 0xef, 0xf1, 0xeb, 0xef, 0xf3, 0xff, 0x5c, 0x54, 0xb1, 0xaa, 0xaf, 0xaf, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xb2, 0xb3, 0xb4, 0xb2, 0xae, 0xb5, 0x46, 0x46, 0x58, 0xf7, 0x5c, 0xef, 0xf1, 0xef, 0xf1, 0xf9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 
-  0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xf9, 0xef, 0xef, 0xf0, 0xf2, 0x5f, 0x5c, 0x55, 0xaf, 0xaa, 0xad, 0xab, 0x42, 0xaf, 0xb3, 0xaf, 0xad, 0x46, 0xb3, 0x42, 0xaa, 0xad, 0xc5, 0x5c, 0x61, 0x5b, 0x5b, 0xef, 0xf3, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf3, 0x5b, 0xf3, 0xef, 0xf2, 0x5b, 0x5b, 0x60, 0x5c, 0x55, 0xb9, 0xb5, 0xb5, 0xb5, 0xc8, 0x58, 0xb5, 0xb9, 0xbd, 0x58, 0x60, 0x5f, 0xf7, 0xf8, 0xf9, 0xf8, 0xf3, 0xf0, 0xf2, 0xf1, 0x5b, 0xf3, 0xef, 0xff, 0x5b, 0x60, 0x57, 0xc0, 0xb5, 0x4f, 0xb5, 0xc9, 0x4f, 0xb5, 0xb1, 0xb9, 0xc5, 0x5a, 0x61, 0x5c, 0xf3, 0xf1, 0xef, 0xf1, 0xf1, 0xf1, 0xef, 0xf3, 0xef, 0xf7, 0xf0, 0xf1, 0xf2, 0xf8, 0xf8, 0x5f, 0x5c, 0x5b, 0xb9, 0xad, 0x47, 0x42, 0xb6, 0x47, 0x47, 0xb3, 0xad, 0xad, 0x42, 0xab, 0xad, 0x46, 0x54, 0xf8, 0xf7, 0xf8, 0xef, 0xf9, 0xf0, 0xf1, 0xeb, 0xf1, 0xf3, 0xef, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0x5b, 0xc8, 0xbd, 0xb1, 0x46, 0x42, 0xaa, 0x42, 0x42, 0x42, 0x42, 0xb1, 0xc8, 0x5a, 0x5f, 0x5c, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xef, 0xf7, 0xf3, 0xd4, 0x58, 0x58, 0xd4, 0xf8, 0xf3, 0xeb, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf8, 0x5b, 0xf8, 0x58, 0x58, 0xf8, 0xf7, 0xf7, 0xf3, 0xf3, 0x5b, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0x5a, 0xc4, 0xb9, 0xb3, 0x46, 0x46, 0x46, 0x46, 0x46, 0xb9, 0xc1, 0xc8, 0xef, 0x5f, 0xf7, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0x5f, 0x5f, 0x5f, 0xca, 0x58, 0xc8, 0x54, 0x55, 0x55, 0x55, 0x5b, 0xcb, 0x5c, 0x5b, 0x5c, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf7, 0xeb, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xd5, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf2, 0x5b, 0x5b, 0x5c, 0x5c, 0xca, 0x5a, 0x58, 0x5a, 0x58, 0x5a, 0xd4, 0xeb, 0xd5, 0x5f, 0xf8, 0xf3, 0xf7, 0xf1, 0xf9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xeb, 0xeb, 0xff, 0xf7, 0xf9, 0xf9, 0xff, 0x5b, 0x5c, 0x5f, 0x5b, 0xf3, 0xef, 0xf7, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xef, 0xef, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf7, 0xf3, 0xef, 0xef, 0xef, 0x5b, 0xef, 0x5b, 0xf3, 0xef, 0x5b, 0xf3, 0xf8, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xef, 0x5b, 0xef, 0xf3, 0xf3, 0xeb, 0xf7, 0x5f, 0x5b, 0xf8, 0xef, 0xf7, 0xf7, 0x5b, 0xf3, 0xf1, 0xf3, 0xf1, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xf3, 0xf7, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf0, 0xf2, 0xf0, 0xeb, 0xf2, 0xf3, 0xf3, 0xf1, 0xf7, 0x5b, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf0, 0xf2, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf7, 0xf3, 0xf3, 0xef, 0xef, 0xef, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xef, 0xd4, 0xf2, 0xf2, 0xf2, 0xd4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xeb, 0xf3, 0xf8, 0xf3, 0xf3, 0xf1, 0xf9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf3, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xeb, 0xf2, 0xef, 0xf7, 0xf3, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xef, 0xf2, 0xf1, 0xf2, 0xf1, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf8, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf2, 0xf7, 0xf3, 0xf2, 0xef, 0xf2, 0xf3, 0xeb, 0xf7, 0xf3, 0xf3, 0xf3, 0xef, 0xf7, 0xef, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf7, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xf7, 0x5b, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf9, 0x5b, 0xf9, 0x5b, 0xf7, 0x5b, 0xf9, 0x5b, 0xf9, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xf3, 0xf1, 0xef, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf7, 0xf2, 0xf2, 0xf2, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf7, 0x5b, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x5b, 0xf1, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf7, 0xf2, 0xf3, 0xf2, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0x5b, 0xf7, 0x5b, 0xf3, 0xf7, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x5b, 0xf3, 0x5b, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xf3, 0xf3, 0x5b, 0xf3, 0xef, 0xf7, 0x5b, 0xf3, 0x5b, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf2, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xf1, 0xf3, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf3, 0xef, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-};
-
-const lv_img_dsc_t image2 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image2_map,
-};
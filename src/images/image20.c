@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE20
-#define LV_ATTRIBUTE_IMG_IMAGE20
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE20 uint8_t image20_map[] = {
-  0xcb, 0xcb, 0xcb, 0xff, 	/*Color of index 0*/
-  0xf7, 0xf6, 0xfa, 0xff, 	/*Color of index 1*/
-  0xf1, 0xf3, 0xf9, 0xff, 	/*Color of index 2*/
-  0xe9, 0xec, 0xfb, 0xff, 	/*Color of index 3*/
-  0xe0, 0xe5, 0xfb, 0xff, 	/*Color of index 4*/
-  0xd5, 0xdb, 0xeb, 0xff, 	/*Color of index 5*/
-  0xd2, 0xd3, 0xd7, 0xff, 	/*Color of index 6*/
-  0xc9, 0xcd, 0xd7, 0xff, 	/*Color of index 7*/
-  0xae, 0xc4, 0xf9, 0xff, 	/*Color of index 8*/
-  0xc3, 0xc3, 0xc6, 0xff, 	/*Color of index 9*/
-  0xbb, 0xbd, 0xc4, 0xff, 	/*Color of index 10*/
-  0x9b, 0xb1, 0xf4, 0xff, 	/*Color of index 11*/
-  0xb3, 0xb3, 0xb7, 0xff, 	/*Color of index 12*/
-  0x8d, 0xa4, 0xf2, 0xff, 	/*Color of index 13*/
-  0x86, 0xa0, 0xde, 0xff, 	/*Color of index 14*/
-  0x77, 0x8e, 0xf9, 0xff, 	/*Color of index 15*/
-  0x78, 0x90, 0xe0, 0xff, 	/*Color of index 16*/
-  0x62, 0x87, 0xf2, 0xff, 	/*Color of index 17*/
-  0x99, 0x99, 0x9d, 0xff, 	/*Color of index 18*/
-  0x62, 0x80, 0xdd, 0xff, 	/*Color of index 19*/
-  0x5d, 0x77, 0xf1, 0xff, 	/*Color of index 20*/
-  0x5f, 0x7d, 0xcb, 0xff, 	/*Color of index 21*/
-  0x70, 0x7e, 0xba, 0xff, 	/*Color of index 22*/
-  0x4f, 0x73, 0xde, 0xff, 	/*Color of index 23*/
-  0x5a, 0x74, 0xca, 0xff, 	/*Color of index 24*/
-  0x48, 0x6e, 0xcc, 0xff, 	/*Color of index 25*/
-  0x51, 0x6b, 0xb8, 0xff, 	/*Color of index 26*/
-  0x41, 0x62, 0xcf, 0xff, 	/*Color of index 27*/
-  0x3b, 0x58, 0xe0, 0xff, 	/*Color of index 28*/
-  0x54, 0x63, 0xa9, 0xff, 	/*Color of index 29*/
-  0x3f, 0x5f, 0xbc, 0xff, 	/*Color of index 30*/
-  0x28, 0x4e, 0xf1, 0xff, 	/*Color of index 31*/
-  0x2e, 0x56, 0xc6, 0xff, 	/*Color of index 32*/
-  0x2e, 0x4e, 0xde, 0xff, 	/*Color of index 33*/
-  0x3f, 0x5b, 0xa9, 0xff, 	/*Color of index 34*/
-  0x20, 0x44, 0xf8, 0xff, 	/*Color of index 35*/
-  0x5a, 0x61, 0x7c, 0xff, 	/*Color of index 36*/
-  0x36, 0x4b, 0xcf, 0xff, 	/*Color of index 37*/
-  0x1a, 0x46, 0xe3, 0xff, 	/*Color of index 38*/
-  0x35, 0x4e, 0xbb, 0xff, 	/*Color of index 39*/
-  0x1e, 0x3c, 0xf9, 0xff, 	/*Color of index 40*/
-  0x51, 0x52, 0x82, 0xff, 	/*Color of index 41*/
-  0x21, 0x44, 0xc1, 0xff, 	/*Color of index 42*/
-  0x2a, 0x47, 0xae, 0xff, 	/*Color of index 43*/
-  0x4d, 0x55, 0x68, 0xff, 	/*Color of index 44*/
-  0x27, 0x31, 0xee, 0xff, 	/*Color of index 45*/
-  0x33, 0x3b, 0xc5, 0xff, 	/*Color of index 46*/
-  0x26, 0x33, 0xde, 0xff, 	/*Color of index 47*/
-  0x3f, 0x42, 0x9f, 0xff, 	/*Color of index 48*/
-  0x21, 0x39, 0xc6, 0xff, 	/*Color of index 49*/
-  0x1f, 0x3f, 0xaf, 0xff, 	/*Color of index 50*/
-  0x20, 0x43, 0x9d, 0xff, 	/*Color of index 51*/
-  0x14, 0x32, 0xcd, 0xff, 	/*Color of index 52*/
-  0x15, 0x33, 0xbc, 0xff, 	/*Color of index 53*/
-  0x1b, 0x27, 0xde, 0xff, 	/*Color of index 54*/
-  0x2c, 0x2e, 0xaf, 0xff, 	/*Color of index 55*/
-  0x11, 0x2f, 0xa6, 0xff, 	/*Color of index 56*/
-  0x19, 0x20, 0xd1, 0xff, 	/*Color of index 57*/
-  0x18, 0x21, 0xc2, 0xff, 	/*Color of index 58*/
-  0x2c, 0x2a, 0x99, 0xff, 	/*Color of index 59*/
-  0x32, 0x3b, 0x56, 0xff, 	/*Color of index 60*/
-  0x25, 0x23, 0x85, 0xff, 	/*Color of index 61*/
-  0x18, 0x18, 0xad, 0xff, 	/*Color of index 62*/
-  0x1c, 0x18, 0x9b, 0xff, 	/*Color of index 63*/
-  0x13, 0x0d, 0xbb, 0xff, 	/*Color of index 64*/
-  0x1e, 0x21, 0x6c, 0xff, 	/*Color of index 65*/
-  0x11, 0x0c, 0xad, 0xff, 	/*Color of index 66*/
-  0x19, 0x16, 0x84, 0xff, 	/*Color of index 67*/
-  0x1b, 0x27, 0x49, 0xff, 	/*Color of index 68*/
-  0x10, 0x09, 0x9b, 0xff, 	/*Color of index 69*/
-  0x12, 0x0f, 0x6b, 0xff, 	/*Color of index 70*/
-  0x13, 0x16, 0x4f, 0xff, 	/*Color of index 71*/
-  0x0a, 0x09, 0x53, 0xff, 	/*Color of index 72*/
-  0x0a, 0x0c, 0x3c, 0xff, 	/*Color of index 73*/
-  0x10, 0x09, 0x25, 0xff, 	/*Color of index 74*/
-  0x03, 0x04, 0x29, 0xff, 	/*Color of index 75*/
-  0x09, 0x06, 0x17, 0xff, 	/*Color of index 76*/
-  0xf4, 0xf9, 0xfb, 0xff, 	/*Color of index 77*/
-  0xec, 0xf3, 0xfb, 0xff, 	/*Color of index 78*/
-  0xe1, 0xf2, 0xfd, 0xff, 	/*Color of index 79*/
-  0xed, 0xf1, 0xf5, 0xff, 	/*Color of index 80*/
-  0xe2, 0xf0, 0xf3, 0xff, 	/*Color of index 81*/
-  0xc2, 0xef, 0xfe, 0xff, 	/*Color of index 82*/
-  0xe8, 0xee, 0xf4, 0xff, 	/*Color of index 83*/
-  0xdc, 0xec, 0xfc, 0xff, 	/*Color of index 84*/
-  0xe4, 0xec, 0xf8, 0xff, 	/*Color of index 85*/
-  0xd4, 0xe9, 0xfd, 0xff, 	/*Color of index 86*/
-  0xe2, 0xea, 0xf4, 0xff, 	/*Color of index 87*/
-  0xdb, 0xea, 0xf3, 0xff, 	/*Color of index 88*/
-  0xe4, 0xea, 0xeb, 0xff, 	/*Color of index 89*/
-  0xda, 0xea, 0xec, 0xff, 	/*Color of index 90*/
-  0xdc, 0xe5, 0xf1, 0xff, 	/*Color of index 91*/
-  0xc9, 0xe3, 0xfd, 0xff, 	/*Color of index 92*/
-  0xd2, 0xe0, 0xfd, 0xff, 	/*Color of index 93*/
-  0xe0, 0xe4, 0xe6, 0xff, 	/*Color of index 94*/
-  0x96, 0xe4, 0xf4, 0xff, 	/*Color of index 95*/
-  0xd4, 0xde, 0xf3, 0xff, 	/*Color of index 96*/
-  0xd9, 0xe0, 0xe9, 0xff, 	/*Color of index 97*/
-  0xb5, 0xdd, 0xfb, 0xff, 	/*Color of index 98*/
-  0xda, 0xdf, 0xe3, 0xff, 	/*Color of index 99*/
-  0xc6, 0xd8, 0xfd, 0xff, 	/*Color of index 100*/
-  0xc5, 0xdc, 0xe8, 0xff, 	/*Color of index 101*/
-  0xc9, 0xd6, 0xf1, 0xff, 	/*Color of index 102*/
-  0xd5, 0xd9, 0xe2, 0xff, 	/*Color of index 103*/
-  0xb9, 0xcf, 0xfb, 0xff, 	/*Color of index 104*/
-  0xa4, 0xd0, 0xf9, 0xff, 	/*Color of index 105*/
-  0xb7, 0xd3, 0xe8, 0xff, 	/*Color of index 106*/
-  0xca, 0xd2, 0xe3, 0xff, 	/*Color of index 107*/
-  0x8c, 0xd0, 0xf9, 0xff, 	/*Color of index 108*/
-  0xa8, 0xcb, 0xe5, 0xff, 	/*Color of index 109*/
-  0x43, 0xcb, 0xf1, 0xff, 	/*Color of index 110*/
-  0x75, 0xc8, 0xea, 0xff, 	/*Color of index 111*/
-  0x9d, 0xbf, 0xf4, 0xff, 	/*Color of index 112*/
-  0xba, 0xc4, 0xd7, 0xff, 	/*Color of index 113*/
-  0x8e, 0xbb, 0xfd, 0xff, 	/*Color of index 114*/
-  0x76, 0xbd, 0xed, 0xff, 	/*Color of index 115*/
-  0x7f, 0xb5, 0xfd, 0xff, 	/*Color of index 116*/
-  0x35, 0xba, 0xf9, 0xff, 	/*Color of index 117*/
-  0xa0, 0xb8, 0xdb, 0xff, 	/*Color of index 118*/
-  0x4c, 0xba, 0xe6, 0xff, 	/*Color of index 119*/
-  0x7c, 0xb3, 0xe2, 0xff, 	/*Color of index 120*/
-  0x7a, 0xa9, 0xfc, 0xff, 	/*Color of index 121*/
-  0x90, 0xae, 0xdf, 0xff, 	/*Color of index 122*/
-  0x91, 0xb4, 0xca, 0xff, 	/*Color of index 123*/
-  0x25, 0xb0, 0xf7, 0xff, 	/*Color of index 124*/
-  0x72, 0x9e, 0xfa, 0xff, 	/*Color of index 125*/
-  0x6b, 0xa4, 0xe2, 0xff, 	/*Color of index 126*/
-  0x2e, 0xa7, 0xe7, 0xff, 	/*Color of index 127*/
-  0xa3, 0xaa, 0xb4, 0xff, 	/*Color of index 128*/
-  0x61, 0x94, 0xf4, 0xff, 	/*Color of index 129*/
-  0x6b, 0x96, 0xe1, 0xff, 	/*Color of index 130*/
-  0x50, 0x99, 0xdf, 0xff, 	/*Color of index 131*/
-  0x7f, 0x9a, 0xc3, 0xff, 	/*Color of index 132*/
-  0x6c, 0x92, 0xce, 0xff, 	/*Color of index 133*/
-  0x34, 0x87, 0xed, 0xff, 	/*Color of index 134*/
-  0x4c, 0x87, 0xe2, 0xff, 	/*Color of index 135*/
-  0x57, 0x89, 0xce, 0xff, 	/*Color of index 136*/
-  0x7a, 0x8c, 0xab, 0xff, 	/*Color of index 137*/
-  0x1a, 0x80, 0xf1, 0xff, 	/*Color of index 138*/
-  0x08, 0x80, 0xed, 0xff, 	/*Color of index 139*/
-  0x09, 0x81, 0xe2, 0xff, 	/*Color of index 140*/
-  0x20, 0x85, 0xbb, 0xff, 	/*Color of index 141*/
-  0x57, 0x81, 0xb5, 0xff, 	/*Color of index 142*/
-  0x30, 0x71, 0xee, 0xff, 	/*Color of index 143*/
-  0x18, 0x70, 0xf0, 0xff, 	/*Color of index 144*/
-  0x3c, 0x75, 0xc9, 0xff, 	/*Color of index 145*/
-  0x6a, 0x7a, 0x9f, 0xff, 	/*Color of index 146*/
-  0x0b, 0x6b, 0xec, 0xff, 	/*Color of index 147*/
-  0x0d, 0x62, 0xe9, 0xff, 	/*Color of index 148*/
-  0x34, 0x6e, 0xb1, 0xff, 	/*Color of index 149*/
-  0x58, 0x6f, 0x88, 0xff, 	/*Color of index 150*/
-  0x17, 0x58, 0xe3, 0xff, 	/*Color of index 151*/
-  0x2f, 0x57, 0xb2, 0xff, 	/*Color of index 152*/
-  0x26, 0x52, 0xa7, 0xff, 	/*Color of index 153*/
-  0x0a, 0x47, 0xd0, 0xff, 	/*Color of index 154*/
-  0x29, 0x53, 0x82, 0xff, 	/*Color of index 155*/
-  0x32, 0x43, 0x69, 0xff, 	/*Color of index 156*/
-  0x16, 0x3d, 0x80, 0xff, 	/*Color of index 157*/
-  0xfb, 0xfd, 0xfd, 0xff, 	/*Color of index 158*/
-  0xf1, 0xf5, 0xf4, 0xff, 	/*Color of index 159*/
-  0xd6, 0xdc, 0xdb, 0xff, 	/*Color of index 160*/
-  0xea, 0xed, 0xea, 0xff, 	/*Color of index 161*/
-  0xf9, 0xfb, 0xf4, 0xff, 	/*Color of index 162*/
-  0xf9, 0xf8, 0xe1, 0xff, 	/*Color of index 163*/
-  0xef, 0xf1, 0xe7, 0xff, 	/*Color of index 164*/
-  0xe0, 0xe3, 0xd6, 0xff, 	/*Color of index 165*/
-  0xd8, 0xdb, 0xd1, 0xff, 	/*Color of index 166*/
-  0xe7, 0xdf, 0xb2, 0xff, 	/*Color of index 167*/
-  0xf4, 0xe5, 0x8d, 0xff, 	/*Color of index 168*/
-  0xf2, 0xdf, 0x77, 0xff, 	/*Color of index 169*/
-  0xd6, 0xce, 0xa5, 0xff, 	/*Color of index 170*/
-  0xec, 0xda, 0x69, 0xff, 	/*Color of index 171*/
-  0xd8, 0xce, 0x89, 0xff, 	/*Color of index 172*/
-  0xe4, 0xd1, 0x6e, 0xff, 	/*Color of index 173*/
-  0xe2, 0xcb, 0x5d, 0xff, 	/*Color of index 174*/
-  0xc8, 0xbe, 0x83, 0xff, 	/*Color of index 175*/
-  0xbc, 0xb5, 0x9b, 0xff, 	/*Color of index 176*/
-  0xce, 0xbf, 0x6f, 0xff, 	/*Color of index 177*/
-  0xdb, 0xc1, 0x59, 0xff, 	/*Color of index 178*/
-  0xcf, 0xbb, 0x5c, 0xff, 	/*Color of index 179*/
-  0xc1, 0xb4, 0x6d, 0xff, 	/*Color of index 180*/
-  0xb3, 0xab, 0x87, 0xff, 	/*Color of index 181*/
-  0xd3, 0xb6, 0x4c, 0xff, 	/*Color of index 182*/
-  0xce, 0xb2, 0x54, 0xff, 	/*Color of index 183*/
-  0xb6, 0xa7, 0x6e, 0xff, 	/*Color of index 184*/
-  0xc5, 0xaa, 0x59, 0xff, 	/*Color of index 185*/
-  0xc9, 0xa9, 0x4a, 0xff, 	/*Color of index 186*/
-  0x9b, 0x99, 0x8f, 0xff, 	/*Color of index 187*/
-  0xb7, 0xa4, 0x5e, 0xff, 	/*Color of index 188*/
-  0xc8, 0xa8, 0x43, 0xff, 	/*Color of index 189*/
-  0xc4, 0xa2, 0x43, 0xff, 	/*Color of index 190*/
-  0xc4, 0xa3, 0x39, 0xff, 	/*Color of index 191*/
-  0x9e, 0x96, 0x71, 0xff, 	/*Color of index 192*/
-  0xaf, 0x9a, 0x56, 0xff, 	/*Color of index 193*/
-  0xbe, 0x9d, 0x44, 0xff, 	/*Color of index 194*/
-  0xa4, 0x93, 0x5a, 0xff, 	/*Color of index 195*/
-  0xbd, 0x9a, 0x39, 0xff, 	/*Color of index 196*/
-  0xbc, 0x9a, 0x30, 0xff, 	/*Color of index 197*/
-  0xb2, 0x94, 0x42, 0xff, 	/*Color of index 198*/
-  0x99, 0x8c, 0x5a, 0xff, 	/*Color of index 199*/
-  0xb6, 0x93, 0x31, 0xff, 	/*Color of index 200*/
-  0x9e, 0x8a, 0x48, 0xff, 	/*Color of index 201*/
-  0x86, 0x7e, 0x5c, 0xff, 	/*Color of index 202*/
-  0x8f, 0x7f, 0x47, 0xff, 	/*Color of index 203*/
-  0x9f, 0x81, 0x2b, 0xff, 	/*Color of index 204*/
-  0x74, 0x6e, 0x5b, 0xff, 	/*Color of index 205*/
-  0x85, 0x72, 0x39, 0xff, 	/*Color of index 206*/
-  0x76, 0x6a, 0x3e, 0xff, 	/*Color of index 207*/
-  0x65, 0x5e, 0x45, 0xff, 	/*Color of index 208*/
-  0x6b, 0x5d, 0x2e, 0xff, 	/*Color of index 209*/
-  0x58, 0x4f, 0x33, 0xff, 	/*Color of index 210*/
-  0x5b, 0x4d, 0x20, 0xff, 	/*Color of index 211*/
-  0x49, 0x40, 0x24, 0xff, 	/*Color of index 212*/
-  0x4c, 0x3e, 0x13, 0xff, 	/*Color of index 213*/
-  0x3c, 0x32, 0x16, 0xff, 	/*Color of index 214*/
-  0xbc, 0xbb, 0xb9, 0xff, 	/*Color of index 215*/
-  0x80, 0x7b, 0x70, 0xff, 	/*Color of index 216*/
-  0x96, 0x80, 0x54, 0xff, 	/*Color of index 217*/
-  0x5c, 0x58, 0x57, 0xff, 	/*Color of index 218*/
-  0x45, 0x41, 0x3e, 0xff, 	/*Color of index 219*/
-  0x35, 0x27, 0x08, 0xff, 	/*Color of index 220*/
-  0x2b, 0x22, 0x1b, 0xff, 	/*Color of index 221*/
-  0x25, 0x1a, 0x17, 0xff, 	/*Color of index 222*/
-  0x20, 0x16, 0x13, 0xff, 	/*Color of index 223*/
-  0x27, 0x19, 0x06, 0xff, 	/*Color of index 224*/
-  0x1e, 0x17, 0x0b, 0xff, 	/*Color of index 225*/
-  0x20, 0x13, 0x11, 0xff, 	/*Color of index 226*/
-  0x21, 0x13, 0x0d, 0xff, 	/*Color of index 227*/
-  0x1c, 0x11, 0x0d, 0xff, 	/*Color of index 228*/
-  0x1b, 0x13, 0x03, 0xff, 	/*Color of index 229*/
-  0x15, 0x10, 0x0b, 0xff, 	/*Color of index 230*/
-  0x21, 0x11, 0x02, 0xff, 	/*Color of index 231*/
-  0x17, 0x0b, 0x03, 0xff, 	/*Color of index 232*/
-  0x11, 0x07, 0x03, 0xff, 	/*Color of index 233*/
-  0x65, 0x61, 0x61, 0xff, 	/*Color of index 234*/
-  0x4f, 0x4e, 0x4e, 0xff, 	/*Color of index 235*/
-  0x31, 0x2c, 0x2c, 0xff, 	/*Color of index 236*/
-  0x26, 0x13, 0x12, 0xff, 	/*Color of index 237*/
-  0x20, 0x11, 0x17, 0xff, 	/*Color of index 238*/
-  0x1e, 0x11, 0x10, 0xff, 	/*Color of index 239*/
-  0x22, 0x0e, 0x14, 0xff, 	/*Color of index 240*/
-  0x1b, 0x0e, 0x10, 0xff, 	/*Color of index 241*/
-  0x18, 0x0c, 0x0b, 0xff, 	/*Color of index 242*/
-  0x15, 0x08, 0x09, 0xff, 	/*Color of index 243*/
-  0x14, 0x06, 0x08, 0xff, 	/*Color of index 244*/
-  0x0c, 0x04, 0x04, 0xff, 	/*Color of index 245*/
-  0x05, 0x01, 0x02, 0xff, 	/*Color of index 246*/
-  0xa7, 0xa5, 0xa7, 0xff, 	/*Color of index 247*/
-  0x8e, 0x8c, 0x8d, 0xff, 	/*Color of index 248*/
-  0x82, 0x7f, 0x82, 0xff, 	/*Color of index 249*/
-  0x75, 0x70, 0x73, 0xff, 	/*Color of index 250*/
-  0x39, 0x35, 0x37, 0xff, 	/*Color of index 251*/
-  0x27, 0x23, 0x25, 0xff, 	/*Color of index 252*/
-  0x1b, 0x13, 0x17, 0xff, 	/*Color of index 253*/
-  0x14, 0x0e, 0x14, 0xff, 	/*Color of index 254*/
-  0x1b, 0x17, 0x24, 0xff, 	/*Color of index 255*/
-
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe4, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xef, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xe3, 0xe3, 0xe1, 0xe3, 0xe3, 0xde, 0xf2, 0xfd, 0xed, 0xf1, 0xee, 0xe2, 0xee, 0xfe, 0xf0, 0xfe, 0xf0, 0xee, 0xe2, 0xef, 0xe2, 0xe1, 0xe4, 0xe4, 0xde, 0xe1, 0xf1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xee, 0xef, 0xe3, 0xe1, 0xe1, 0xe1, 0xe1, 0xdf, 0xf3, 0xde, 0xfd, 0xf1, 0xee, 0xee, 0xfd, 0x4a, 0xee, 0xee, 0xee, 0xee, 0xdf, 0xe2, 0xe1, 0xde, 0xe1, 0xe6, 0xe1, 0xdf, 0xf2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xf0, 0xed, 0xe2, 0xe1, 0xe1, 0xe1, 0xe3, 0xe4, 0xde, 0xf0, 0xf4, 0xe2, 0xde, 0xef, 0xf1, 0xfd, 0xfd, 0xee, 0xf0, 0xe4, 0xf1, 0xdf, 0xe6, 0xe1, 0xde, 0xe6, 0xf2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe1, 0xe3, 0xe1, 0xf3, 0xe4, 0xee, 0xdd, 0xde, 0xf5, 0xe3, 0xe6, 0xe1, 0xe3, 0xe4, 0xe4, 0xed, 0xde, 0xde, 0xe4, 0xe6, 0xdf, 0xef, 0xef, 0xee, 0xf0, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xde, 0xdd, 0xf4, 0xf5, 0xe9, 0xe9, 0xe5, 0xe8, 0xe9, 0xf6, 0xf5, 0xe9, 0xf5, 0xf5, 0xe8, 0xe3, 0xe3, 0xde, 0xf0, 0xed, 0xee, 0xf2, 0xee, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xef, 0xef, 0xf2, 0xf3, 0xf2, 0xd2, 0xd7, 0xa5, 0xa6, 0xa6, 0xaa, 0x80, 0xbb, 0xd8, 0xeb, 0xec, 0xe2, 0xf3, 0xf1, 0xed, 0xf0, 0xf0, 0xee, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe1, 0xe1, 0xe2, 0xef, 0xe2, 0xee, 0xe2, 0xef, 0xe3, 0xf9, 0xa2, 0xa2, 0xa5, 0x63, 0x9f, 0x4e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x0c, 0xeb, 0xf2, 0xf2, 0xed, 0xf0, 0xee, 0xee, 0xed, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe1, 0xe3, 0xe3, 0xfd, 0xf0, 0xee, 0xf2, 0xe4, 0xf8, 0xa4, 0xa2, 0x5e, 0x57, 0x50, 0x54, 0x56, 0x04, 0x56, 0x5d, 0x5d, 0x04, 0x9e, 0x0c, 0xfc, 0xf3, 0xdd, 0xee, 0xf1, 0xf0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe1, 0xe1, 0xf1, 0xde, 0xf3, 0xff, 0xf5, 0xea, 0xa4, 0x9e, 0x5e, 0x63, 0x05, 0x5d, 0x64, 0x08, 0x0b, 0x0e, 0x82, 0x13, 0x0e, 0x64, 0x9e, 0xdb, 0xf3, 0xdf, 0xe6, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe5, 0xe3, 0xfd, 0xf4, 0xee, 0xf3, 0xec, 0xa0, 0x9e, 0x51, 0x67, 0x66, 0x64, 0x68, 0x0b, 0x19, 0x32, 0x2b, 0x1c, 0x98, 0x30, 0x0e, 0x4e, 0x2c, 0xe6, 0xde, 0xe6, 0xe6, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe1, 0xe4, 0xee, 0xfd, 0xf0, 0xf5, 0xf7, 0x9e, 0x9f, 0x61, 0x6d, 0x66, 0x0b, 0x10, 0x17, 0x2a, 0x25, 0x1f, 0x1c, 0x1c, 0x27, 0x1a, 0x64, 0x2c, 0xf3, 0xe1, 0xe1, 0xe1, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe4, 0xf0, 0xff, 0xf6, 0xeb, 0x9e, 0x9e, 0x5a, 0x65, 0x66, 0x08, 0x10, 0x32, 0x14, 0x21, 0x26, 0x1f, 0x26, 0x1f, 0x20, 0x27, 0x68, 0x24, 0xf6, 0xde, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xf1, 0xed, 0xfd, 0xf5, 0xf0, 0x06, 0x9e, 0xa2, 0x63, 0x65, 0x68, 0x08, 0x19, 0x2e, 0x1c, 0x26, 0x23, 0x23, 0x23, 0x1f, 0x21, 0x27, 0x64, 0x24, 0xf6, 0xe1, 0xde, 0xe5, 0xdf, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xf2, 0xfd, 0xf0, 0xf4, 0xfa, 0x9e, 0x9f, 0xa5, 0x61, 0x65, 0x08, 0x0b, 0x1b, 0x1c, 0x1f, 0x1f, 0x23, 0x28, 0x28, 0x28, 0x21, 0x27, 0x08, 0x29, 0xf5, 0xed, 0xe0, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe3, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xe3, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xf1, 0xdf, 0xdf, 0xf6, 0xfc, 0x05, 0x9e, 0xa2, 0xa6, 0x5a, 0x52, 0x08, 0x7d, 0x25, 0x26, 0x21, 0x1f, 0x23, 0x28, 0x1f, 0x23, 0x21, 0x20, 0x68, 0x29, 0xf1, 0xef, 0xe4, 0xe4, 0xed, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xed, 0xed, 0xed, 0xe3, 0xe3, 0xe1, 0xe3, 0xe1, 0xe2, 0xef, 0xe2, 0xef, 0xee, 0xe3, 0xe1, 0xe3, 0xe3, 0xed, 0xef, 0xed, 0xf0, 0xf0, 0xef, 0xef, 0xe1, 0xe1, 0xe1, 0xe1, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe5, 0xe1, 0xe5, 0x4c, 0x12, 0x9e, 0x9e, 0xa0, 0x63, 0x58, 0x66, 0x68, 0x18, 0x1c, 0x21, 0x26, 0x23, 0x23, 0x23, 0x28, 0x1f, 0x26, 0x1e, 0x08, 0x2c, 0xf4, 0xdf, 0xdf, 0xf1, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xee, 0xf0, 0xed, 0xe2, 0xe2, 0xe3, 0xdf, 0xe1, 0xe3, 0xe2, 0xe2, 0xe2, 0xef, 0xee, 0xe3, 0xe1, 0xe1, 0xe3, 0xe3, 0xed, 0xf0, 0xed, 0xf0, 0xed, 0xef, 0xe2, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe0, 0xe8, 0xfb, 0x61, 0x4d, 0x03, 0x07, 0x59, 0x58, 0x64, 0x72, 0x17, 0x21, 0x23, 0x26, 0x1f, 0x28, 0x28, 0x23, 0x23, 0x25, 0x27, 0x0b, 0x9c, 0xf2, 0xfd, 0xde, 0xde, 0xee, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xee, 0xee, 0xee, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe2, 0xe3, 0xee, 0xef, 0xee, 0xe2, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xf0, 0xee, 0xee, 0xee, 0xe2, 0xef, 0xdf, 0xe3, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe8, 0xe6, 0x12, 0x01, 0x02, 0x07, 0x53, 0x53, 0x58, 0x68, 0x0b, 0x1b, 0x26, 0x1f, 0x23, 0x23, 0x23, 0x28, 0x28, 0x23, 0x25, 0x20, 0x7a, 0x44, 0xfe, 0xe6, 0xe2, 0xed, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xfd, 0xee, 0xfd, 0xfd, 0xe2, 0xee, 0xed, 0xe3, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xe2, 0xe1, 0xe1, 0xe3, 0xe2, 0xe2, 0xfd, 0xef, 0xee, 0xf0, 0xf0, 0xee, 0xf0, 0xee, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe9, 0xdb, 0x67, 0x4d, 0x60, 0x07, 0x53, 0x55, 0x56, 0x08, 0x0d, 0x1c, 0x26, 0x23, 0x23, 0x23, 0x28, 0x28, 0x28, 0x23, 0x25, 0x1b, 0x0e, 0x44, 0xfd, 0xef, 0xe2, 0xdf, 0xf1, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xfd, 0xfd, 0xfd, 0xfd, 0xee, 0xfd, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xee, 0xe1, 0xe2, 0xe1, 0xe1, 0xe4, 0xfd, 0xef, 0xfd, 0xf0, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe1, 0x12, 0x01, 0x57, 0x67, 0x55, 0x61, 0x58, 0x5d, 0x08, 0x0f, 0x1c, 0x28, 0x23, 0x28, 0x23, 0x28, 0x28, 0x23, 0x23, 0x25, 0x1b, 0x0b, 0x44, 0xfe, 0xdf, 0xe3, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xfd, 0xfd, 0xfd, 0xe2, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xe2, 0xef, 0xe1, 0xe4, 0xdf, 0xe4, 0xe2, 0xef, 0xe2, 0xee, 0xef, 0xf0, 0xee, 0xf0, 0xf0, 0xf0, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xf3, 0xdb, 0x06, 0x9e, 0x07, 0x5b, 0x57, 0x51, 0x5b, 0x64, 0x08, 0x0f, 0x1c, 0x2f, 0x23, 0x23, 0x23, 0x28, 0x28, 0x28, 0x1f, 0x25, 0x1b, 0x0b, 0x44, 0x4c, 0xdf, 0xe4, 0xe3, 0xed, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xee, 0xe1, 0xfd, 0xdf, 0xe2, 0xdf, 0xe2, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe2, 0xed, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xf1, 0xdf, 0xf8, 0x9e, 0x63, 0x07, 0x53, 0x58, 0x4f, 0x5b, 0x64, 0x70, 0x13, 0x21, 0x2f, 0x28, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1f, 0x25, 0x1a, 0x0b, 0x3c, 0xf6, 0xde, 0xe3, 0xe3, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xe9, 0xdd, 0xe1, 0xf2, 0xdf, 0xdf, 0xdd, 0xdf, 0xf2, 0xf6, 0xf3, 0xe6, 0xe6, 0xe6, 0xed, 0xde, 0xe4, 0xde, 0xe1, 0xf2, 0xe0, 0xed, 0xe3, 0xe3, 0xed, 0xed, 0xf0, 0xed, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xde, 0xe2, 0xe4, 0xe2, 0xef, 0xf3, 0xeb, 0x67, 0x01, 0x07, 0x5b, 0x4d, 0x61, 0x4f, 0x5b, 0x5c, 0x0b, 0x11, 0x25, 0x34, 0x1f, 0x28, 0x1f, 0x26, 0x26, 0x1f, 0x1c, 0x27, 0x10, 0x68, 0x3c, 0x4c, 0xdf, 0xe3, 0xdf, 0xed, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xef, 0xe1, 0xdd, 0xe8, 0xf2, 0xdd, 0xe4, 0xf6, 0xf6, 0xf6, 0xfe, 0xfc, 0xec, 0xff, 0xfe, 0xf6, 0xf6, 0xf4, 0xf1, 0xe9, 0xed, 0xdd, 0xe3, 0xe0, 0xe3, 0xe1, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xdf, 0xe4, 0xe2, 0xde, 0xf3, 0xef, 0xf8, 0x01, 0x5e, 0x67, 0x53, 0x4f, 0x5a, 0x4f, 0x54, 0x54, 0x08, 0x15, 0x27, 0x25, 0x1c, 0x1c, 0x1c, 0x21, 0x21, 0x1c, 0x27, 0x1b, 0x0b, 0x64, 0x3c, 0xee, 0xe3, 0xdf, 0xe0, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe7, 0xdd, 0xf5, 0xdd, 0xe6, 0xf5, 0xdb, 0x12, 0x7b, 0x6a, 0x65, 0x5f, 0x6a, 0x6d, 0x7b, 0x96, 0xfc, 0x4c, 0xdf, 0xf2, 0xe9, 0xdd, 0xe7, 0xe0, 0xe3, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xf2, 0xe2, 0xf2, 0xde, 0xed, 0xf6, 0xdb, 0x67, 0x02, 0x6b, 0x03, 0x53, 0x55, 0x4e, 0x5b, 0x61, 0x5d, 0x64, 0x10, 0x30, 0x2b, 0x37, 0x46, 0x38, 0x27, 0x27, 0x2b, 0x1e, 0x0e, 0x64, 0x04, 0x3c, 0xf4, 0xe2, 0xe1, 0xde, 0xe4, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe7, 0xe1, 0xfc, 0xf5, 0xfa, 0x5f, 0x4f, 0x52, 0x5f, 0x6f, 0x6f, 0x6f, 0x6c, 0x62, 0x52, 0x76, 0x96, 0xfe, 0x4c, 0xdd, 0xe9, 0xed, 0xe3, 0xe1, 0xe1, 0xe2, 0xe1, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe2, 0xe2, 0xde, 0xf2, 0xf4, 0xbb, 0x01, 0x63, 0x06, 0x53, 0x4e, 0x58, 0x4f, 0x58, 0x4d, 0x04, 0x03, 0x08, 0x16, 0x30, 0x9d, 0x18, 0x0b, 0x68, 0x0b, 0x08, 0x64, 0x56, 0x04, 0x60, 0xfb, 0xf3, 0xe6, 0xed, 0xe1, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe3, 0xde, 0xdf, 0xf5, 0x96, 0x52, 0x4d, 0x5f, 0x6f, 0x77, 0x83, 0x7f, 0x8d, 0x83, 0x8d, 0x7e, 0x6f, 0x69, 0x96, 0xff, 0xfe, 0xfd, 0xe3, 0xe3, 0xe3, 0xe3, 0xe1, 0xe1, 0xfd, 0xe1, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xdf, 0xf1, 0xe9, 0xec, 0xa0, 0x5e, 0x07, 0x04, 0x55, 0x4e, 0x55, 0x5a, 0x4f, 0x57, 0x04, 0x57, 0x02, 0x04, 0x64, 0x02, 0x5d, 0x03, 0x04, 0x64, 0x4f, 0x4f, 0x66, 0x66, 0x05, 0xfb, 0xfe, 0xe4, 0xe6, 0xdf, 0xe3, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe3, 0xf0, 0xde, 0xfe, 0xfb, 0x65, 0x52, 0x6f, 0x77, 0x77, 0x77, 0x7f, 0x7c, 0x7f, 0x7f, 0x83, 0x8d, 0x8d, 0x7e, 0x6c, 0x92, 0xf6, 0xff, 0xf0, 0xed, 0xed, 0xe3, 0xfd, 0xe6, 0xfd, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xdf, 0xf5, 0xe3, 0xf9, 0x50, 0x06, 0x05, 0x01, 0x57, 0x4f, 0x51, 0x65, 0x4e, 0x61, 0x02, 0x05, 0x60, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x56, 0x5b, 0x5c, 0x5b, 0x57, 0x5e, 0xfb, 0xe2, 0xe3, 0xe4, 0xe3, 0xe2, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xf4, 0xfd, 0x96, 0x52, 0x6c, 0x6f, 0x77, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7f, 0x8d, 0x85, 0x6f, 0x96, 0x4c, 0xfe, 0xf0, 0xf0, 0xe2, 0xe2, 0xfd, 0xfd, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xde, 0xf6, 0xfc, 0xa6, 0x59, 0x06, 0x03, 0x50, 0x57, 0x55, 0x55, 0x5b, 0x53, 0x57, 0x59, 0x50, 0xa1, 0x53, 0x50, 0x59, 0x5e, 0x5b, 0xa1, 0x57, 0x5e, 0x5a, 0x5a, 0x59, 0x5e, 0xfb, 0xf1, 0xdf, 0xe3, 0xdf, 0xe3, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xee, 0xe2, 0xee, 0xef, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfd, 0xee, 0xed, 0xfd, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xdf, 0xdf, 0xed, 0xe2, 0xed, 0xe2, 0xef, 0xef, 0xef, 0xdf, 0xdf, 0xe1, 0xe1, 0xe3, 0xe3, 0xe3, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xee, 0xef, 0xee, 0xfd, 0xdf, 0xfd, 0xdf, 0xfd, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xef, 0xe4, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xde, 0xe6, 0xe6, 0xde, 0xe4, 0xe2, 0xe2, 0xe1, 0xe3, 0xe1, 0xed, 0xfd, 0x4c, 0xff, 0x12, 0x62, 0x6f, 0x77, 0x7f, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7f, 0x7f, 0x8d, 0x7e, 0x78, 0x29, 0x4c, 0xee, 0xdf, 0xed, 0xdf, 0xdf, 0xef, 0xe4, 0xe4, 0xef, 0xdf, 0xdf, 0xdf, 0xef, 0xdf, 0xf1, 0xef, 0xf6, 0xfa, 0x9f, 0x06, 0x63, 0x02, 0x55, 0x57, 0x57, 0x58, 0x55, 0x53, 0x57, 0x5b, 0x53, 0x57, 0x5e, 0x57, 0x59, 0x53, 0x59, 0x5b, 0x5a, 0x58, 0x4e, 0x61, 0xa1, 0x5e, 0xfb, 0xf3, 0xdf, 0xdf, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe3, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe3, 0xef, 0xfd, 0xef, 0xfd, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xed, 0xee, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xfd, 0xee, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xde, 0xed, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xed, 0xdf, 0xfd, 0xed, 0xf1, 0xe4, 0xe1, 0xe1, 0xe1, 0xde, 0xe1, 0xdf, 0xdf, 0xfd, 0xdf, 0xef, 0xe2, 0xe6, 0xef, 0xe4, 0xef, 0xfd, 0xfd, 0xfd, 0xfd, 0xee, 0xf1, 0xee, 0xee, 0xef, 0xf1, 0xe3, 0xdf, 0xdf, 0xdf, 0xe4, 0xe6, 0xe4, 0xe4, 0xe2, 0xdf, 0xde, 0xe3, 0xdf, 0xe3, 0xe2, 0xed, 0xe3, 0xed, 0xe2, 0xe1, 0xe2, 0xe1, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe3, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xe4, 0xde, 0xde, 0xdf, 0xe4, 0xe6, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xee, 0xff, 0x4a, 0x7b, 0x6f, 0x77, 0x77, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x7c, 0x7c, 0x7c, 0x7f, 0x7f, 0x7f, 0x7e, 0x78, 0x3c, 0xf6, 0xfe, 0xe3, 0xe4, 0xe2, 0xe6, 0xde, 0xde, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xf1, 0xdf, 0xf3, 0xef, 0x00, 0x5e, 0x06, 0x50, 0x4e, 0x55, 0x55, 0x57, 0x57, 0x55, 0x57, 0x57, 0x57, 0x57, 0x57, 0x55, 0x57, 0x57, 0x57, 0x57, 0x58, 0x57, 0x57, 0x5b, 0x5b, 0x55, 0x5e, 0xfb, 0xf3, 0xfd, 0xde, 0xf2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xf0, 0xee, 0xef, 0xed, 0xef, 0xed, 0xe3, 0xed, 0xe3, 0xed, 0xe1, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xe3, 0xfd, 0xe2, 0xfd, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xee, 0xed, 0xee, 0xee, 0xee, 0xfd, 0xee, 0xfd, 0xe2, 0xfd, 0xe2, 0xed, 0xed, 0xed, 0xf1, 0xed, 0xdf, 0xed, 0xed, 0xdf, 0xde, 0xde, 0xe2, 0xf0, 0xf1, 0xee, 0xdf, 0xde, 0xdf, 0xf1, 0xf1, 0xe2, 0xe2, 0xfd, 0xee, 0xfd, 0xee, 0xfe, 0xf0, 0xf1, 0xee, 0xed, 0xdf, 0xe4, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xfd, 0xe2, 0xe2, 0xe2, 0xef, 0xf1, 0xef, 0xe2, 0xe2, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe3, 0xdf, 0xe2, 0xdf, 0xed, 0xe4, 0xf2, 0xf3, 0xe6, 0xfd, 0xe9, 0xf5, 0xf5, 0xe9, 0xe8, 0xe3, 0xed, 0xe6, 0xfe, 0xff, 0xff, 0x7b, 0x70, 0x7f, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7f, 0x7f, 0x77, 0x77, 0x89, 0xff, 0xe6, 0xe6, 0xf2, 0xf2, 0xdf, 0xe8, 0xe6, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xf3, 0xe2, 0xf6, 0xea, 0xa1, 0x00, 0xa1, 0x9e, 0x53, 0x55, 0x53, 0x57, 0x57, 0x55, 0x55, 0x57, 0x57, 0x55, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x5b, 0x57, 0x57, 0x5b, 0x53, 0x67, 0xfb, 0xf3, 0xe2, 0xdf, 0xf2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xed, 0xe2, 0xed, 0xed, 0xef, 0xed, 0xe3, 0xed, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xef, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xef, 0xe2, 0xfd, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xed, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xed, 0xed, 0xe4, 0xe3, 0xde, 0xed, 0xe2, 0xef, 0xf2, 0xef, 0xe2, 0xfd, 0xe2, 0xee, 0xf1, 0xf3, 0xee, 0xfc, 0xff, 0xf0, 0xfe, 0x4c, 0xf3, 0x4c, 0xf4, 0xf4, 0xf3, 0xf0, 0xf2, 0xf0, 0xf0, 0xed, 0xe0, 0xed, 0xe3, 0xe3, 0xe2, 0xdf, 0xe4, 0xef, 0xdf, 0xde, 0xdf, 0xfd, 0xfd, 0xe4, 0xf3, 0xe4, 0xdf, 0xdf, 0xe4, 0xef, 0xef, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xed, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xed, 0xe2, 0xe2, 0xde, 0xdf, 0xf6, 0xe6, 0xdf, 0xe6, 0xec, 0xec, 0xfc, 0xde, 0xde, 0xe6, 0xe9, 0xf6, 0xf6, 0xf6, 0x4a, 0x78, 0x73, 0x7f, 0x7f, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x75, 0x7c, 0x7c, 0x7c, 0x77, 0x77, 0x5f, 0x96, 0xe9, 0xfd, 0xdd, 0xdf, 0xf3, 0xde, 0xdf, 0xe1, 0xe6, 0xf2, 0xf2, 0xef, 0xdf, 0xf5, 0xf6, 0x09, 0x00, 0x5e, 0x4d, 0x53, 0x53, 0x55, 0x55, 0x55, 0x57, 0x55, 0x57, 0x57, 0x57, 0x57, 0x55, 0x57, 0x57, 0x55, 0x57, 0x58, 0x57, 0x58, 0x57, 0x5b, 0x5b, 0x53, 0x67, 0xec, 0xfe, 0xef, 0xe2, 0xe4, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xfd, 0xef, 0xfd, 0xe2, 0xef, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe3, 0xfd, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xed, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xed, 0xde, 0xe2, 0xf2, 0xe8, 0xf1, 0xe2, 0xfd, 0xe2, 0xfd, 0xe2, 0xfd, 0xe6, 0xfe, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0x4c, 0xf0, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xdd, 0xed, 0xf2, 0xe8, 0xf5, 0xf5, 0xf5, 0xe9, 0xe9, 0xe9, 0xe8, 0xf2, 0xef, 0xef, 0xf1, 0xfe, 0xfe, 0xfe, 0xdf, 0xde, 0xde, 0xe2, 0xe4, 0xe6, 0xdf, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xed, 0xe4, 0xe9, 0xdd, 0xea, 0x0c, 0x06, 0x63, 0x9f, 0x63, 0xa0, 0x00, 0x09, 0x0c, 0xf7, 0x12, 0xf9, 0xda, 0x2c, 0x7e, 0x74, 0x7f, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x6e, 0x75, 0x6e, 0x75, 0x6e, 0x6e, 0x6f, 0x77, 0xfc, 0xf6, 0xf6, 0xf0, 0xed, 0xf1, 0xdf, 0xdf, 0xde, 0xdf, 0xef, 0xf1, 0xfd, 0xf5, 0xea, 0xa1, 0x09, 0x9e, 0x01, 0x59, 0x55, 0x53, 0x57, 0x55, 0x53, 0x57, 0x55, 0x57, 0x57, 0x55, 0x57, 0x57, 0x55, 0x57, 0x57, 0x58, 0x5b, 0x58, 0x57, 0x57, 0x5b, 0x4e, 0x06, 0xec, 0xfe, 0xfd, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xfd, 0xe2, 0xee, 0xef, 0xee, 0xfd, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xfd, 0xfd, 0xfe, 0xfd, 0xef, 0xee, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xed, 0xe3, 0xe2, 0xef, 0xfd, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe1, 0xe2, 0xe1, 0xe3, 0xe1, 0xe1, 0xdf, 0xe3, 0xdf, 0xe3, 0xe2, 0xe2, 0xe2, 0xef, 0xe6, 0xe4, 0xde, 0xde, 0xdf, 0xef, 0xe6, 0xf4, 0xf5, 0xf6, 0xf3, 0xfc, 0xdb, 0xfa, 0x12, 0xf7, 0x09, 0x06, 0x5e, 0x03, 0x50, 0x02, 0x01, 0x01, 0x50, 0xa1, 0x5e, 0xa6, 0xd7, 0xf7, 0xbb, 0xd8, 0xda, 0xdb, 0xfb, 0xdd, 0xdf, 0xf1, 0xf5, 0xf4, 0xfe, 0xfe, 0xef, 0xf2, 0xe6, 0xe2, 0xde, 0xdf, 0xe6, 0xf2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xed, 0xdf, 0xed, 0xe2, 0xdf, 0xf2, 0xeb, 0x9f, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0x54, 0x70, 0x83, 0x7f, 0x81, 0x7f, 0x7f, 0x6f, 0x6f, 0x75, 0x7c, 0x7c, 0x75, 0x75, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x5f, 0x5f, 0x6a, 0xfa, 0xec, 0xfe, 0xf5, 0xf6, 0xf5, 0xe8, 0xe6, 0xef, 0xe4, 0xf2, 0xf6, 0xdd, 0x06, 0x00, 0x02, 0x01, 0x50, 0x4d, 0x57, 0x55, 0x53, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x57, 0x55, 0x57, 0x57, 0x55, 0x57, 0x58, 0x58, 0x57, 0x58, 0x57, 0x61, 0x4e, 0x07, 0xfc, 0xfd, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe3, 0xe3, 0xe3, 0xe2, 0xef, 0xe2, 0xfd, 0xef, 0xfd, 0xfd, 0xfd, 0xfd, 0xef, 0xfd, 0xfe, 0xee, 0xfd, 0xe2, 0xef, 0xef, 0xe2, 0xe3, 0xe3, 0xef, 0xe2, 0xe2, 0xe2, 0xfd, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xfd, 0xee, 0xee, 0xee, 0xdf, 0xdf, 0xe2, 0xe6, 0xf5, 0xf5, 0xfe, 0xe2, 0xfb, 0xfa, 0xf7, 0x00, 0xa1, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x59, 0x00, 0x0c, 0xbb, 0xfa, 0xeb, 0xec, 0xde, 0xe6, 0xf3, 0xf3, 0xe6, 0xfd, 0xe6, 0xf2, 0xe2, 0xfd, 0xe2, 0xfd, 0xdf, 0xe2, 0xfd, 0xe2, 0xdf, 0xe2, 0xfd, 0xe2, 0xfd, 0xe2, 0xee, 0xe2, 0xee, 0xed, 0xee, 0xe2, 0xed, 0xed, 0xe8, 0xdb, 0xa6, 0x9e, 0xa1, 0x01, 0xa1, 0x59, 0x53, 0x59, 0x61, 0x07, 0x71, 0x09, 0xa6, 0xa5, 0x5b, 0x08, 0x83, 0x81, 0x7f, 0x7f, 0x7e, 0x8d, 0x85, 0x78, 0x6e, 0x75, 0x7c, 0x75, 0x75, 0x6e, 0x75, 0x6e, 0x6e, 0x6e, 0x6f, 0x6f, 0x52, 0x52, 0x4d, 0x00, 0xf7, 0xfa, 0xda, 0xec, 0xe6, 0xf3, 0xf4, 0xf5, 0xfd, 0xf9, 0x63, 0x06, 0x9e, 0x53, 0x50, 0x4e, 0x57, 0x55, 0x53, 0x55, 0x53, 0x55, 0x55, 0x57, 0x57, 0x57, 0x57, 0x57, 0x55, 0x57, 0x57, 0x57, 0x5b, 0x58, 0x04, 0x57, 0x5b, 0x4e, 0x00, 0xfc, 0xfd, 0xef, 0xe2, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xef, 0xdf, 0xe2, 0xe3, 0xe0, 0xe0, 0xe0, 0xe3, 0xe1, 0xe2, 0xe3, 0xdf, 0xe2, 0xe2, 0xe4, 0xe4, 0xfd, 0xef, 0xfd, 0xfd, 0xfe, 0xef, 0xfd, 0xdf, 0xe2, 0xe3, 0xe3, 0xe2, 0xe3, 0xef, 0xef, 0xef, 0xfd, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xfd, 0xed, 0xfd, 0xe3, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xf1, 0xe2, 0xfd, 0xee, 0xee, 0xfd, 0xe2, 0xe8, 0xf3, 0xe4, 0xec, 0xda, 0xf9, 0x09, 0x5e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0x4d, 0x9e, 0x9e, 0x4d, 0x4d, 0x4f, 0x4d, 0x4f, 0x4d, 0x4f, 0x4d, 0x4f, 0x4d, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x5e, 0x00, 0xf7, 0xf9, 0xda, 0xfb, 0xec, 0xde, 0xfd, 0xe6, 0xe6, 0xf2, 0xe6, 0xef, 0xfd, 0xe2, 0xfd, 0xe2, 0xfd, 0xe2, 0xe2, 0xfd, 0xed, 0xe2, 0xe2, 0xe2, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xf2, 0xef, 0xea, 0x06, 0xa2, 0x5e, 0x9e, 0x50, 0x50, 0x57, 0x5b, 0x67, 0x6b, 0x07, 0x00, 0x00, 0x71, 0x08, 0x7d, 0x86, 0x83, 0x83, 0x95, 0x44, 0xff, 0x9b, 0x7e, 0x77, 0x7f, 0x6e, 0x75, 0x75, 0x77, 0x77, 0x6e, 0x6f, 0x6f, 0x5f, 0x65, 0x4f, 0x4d, 0x50, 0x9e, 0x9e, 0xa2, 0x59, 0xa0, 0x00, 0x0c, 0x12, 0x12, 0xa0, 0x5e, 0x9e, 0x4d, 0x02, 0x9f, 0x5b, 0x57, 0x55, 0x55, 0x53, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x57, 0x57, 0x5b, 0x5b, 0x02, 0x09, 0xff, 0xfd, 0xef, 0xe4, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe6, 0xdf, 0xe4, 0xe4, 0xdf, 0xdf, 0xe7, 0xe0, 0xe0, 0xe7, 0xe0, 0xe3, 0xe8, 0xe8, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xe4, 0xe9, 0xfe, 0xf3, 0xfe, 0xf1, 0xfd, 0xdf, 0xdf, 0xe4, 0xef, 0xdf, 0xdf, 0xe2, 0xe2, 0xfd, 0xdf, 0xe2, 0xef, 0xef, 0xe2, 0xdf, 0xdf, 0xef, 0xef, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xfd, 0xee, 0xef, 0xfd, 0xde, 0xdf, 0xe4, 0xe2, 0xef, 0xfd, 0xdf, 0xf1, 0xf0, 0xf3, 0xe6, 0xfc, 0xda, 0xf8, 0x00, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0xa2, 0xa2, 0x9e, 0xa2, 0x4d, 0x4d, 0x4f, 0x4f, 0x52, 0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x5c, 0x56, 0x4f, 0x4d, 0x4d, 0x4e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x5e, 0x09, 0x12, 0xf9, 0xda, 0xeb, 0xfb, 0xfc, 0xdf, 0xe6, 0xf5, 0xf3, 0xf2, 0xf1, 0xef, 0xfd, 0xe2, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xe2, 0xdf, 0xef, 0xf2, 0xde, 0xeb, 0xbb, 0x06, 0xa1, 0x50, 0x02, 0x53, 0x57, 0x55, 0x60, 0x60, 0x63, 0x5b, 0x08, 0x7d, 0x81, 0x81, 0x86, 0x83, 0x9b, 0x4a, 0x47, 0xfe, 0x9b, 0x77, 0x77, 0x75, 0x7f, 0x77, 0x6e, 0x6f, 0x5f, 0x6f, 0x7b, 0x7b, 0x6a, 0x52, 0x4d, 0x4e, 0xa1, 0x59, 0x50, 0x01, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x02, 0x02, 0x01, 0x4e, 0x50, 0x57, 0x53, 0x55, 0x55, 0x57, 0x57, 0x57, 0x57, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x57, 0x5b, 0x58, 0x58, 0x58, 0x04, 0x5b, 0x5b, 0x4e, 0x0a, 0xff, 0xf3, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe2, 0xe4, 0xe6, 0xef, 0xdf, 0xe2, 0xe2, 0xdf, 0xe3, 0xe7, 0xe9, 0xfe, 0xfd, 0xfc, 0x44, 0xfb, 0x9c, 0xeb, 0x24, 0x24, 0x24, 0x2c, 0xeb, 0xfb, 0xfc, 0xfd, 0xf4, 0xe9, 0xf2, 0xe3, 0xe4, 0xe3, 0xe2, 0xdf, 0xdf, 0xe2, 0xef, 0xe6, 0xe2, 0xdf, 0xdf, 0xe2, 0xe4, 0xe4, 0xdf, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xee, 0xf0, 0xee, 0xee, 0xed, 0xdf, 0xed, 0xe4, 0xe3, 0xdd, 0xef, 0xf4, 0xf6, 0xff, 0xdb, 0xf8, 0xd7, 0xa1, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0xa2, 0x4d, 0x9e, 0x9e, 0x9f, 0x4d, 0x9e, 0x4f, 0x62, 0x6d, 0x7a, 0x0e, 0x84, 0x82, 0x85, 0x82, 0x82, 0x0e, 0x0e, 0x70, 0x6d, 0x5c, 0x54, 0x9e, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x5e, 0x00, 0x0c, 0xbb, 0xfa, 0xda, 0xdb, 0xfc, 0xe6, 0xf6, 0xf3, 0xf2, 0xf2, 0xf1, 0xef, 0xe2, 0xdf, 0xdf, 0xee, 0xf2, 0xf2, 0xe2, 0xde, 0xde, 0xe2, 0xdd, 0xeb, 0xfa, 0xbb, 0x09, 0x67, 0x05, 0x60, 0x61, 0x04, 0x5d, 0x68, 0x70, 0x79, 0x81, 0x86, 0x86, 0x87, 0x22, 0x49, 0x4a, 0x49, 0x3c, 0x77, 0x6e, 0x77, 0x77, 0x6c, 0x6c, 0x6c, 0x7b, 0x24, 0x2c, 0x2c, 0x2c, 0x12, 0x0a, 0x07, 0x51, 0x9f, 0x9f, 0x50, 0xa1, 0x59, 0xa1, 0x50, 0x50, 0x02, 0x01, 0x01, 0x4e, 0x53, 0x53, 0x53, 0x55, 0x55, 0x57, 0x55, 0x57, 0x57, 0x57, 0x55, 0x57, 0x55, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x5b, 0x57, 0x58, 0x5b, 0x5b, 0x4e, 0x0c, 0xff, 0xe6, 0xfd, 0xe2, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe6, 0xde, 0xdf, 0xe6, 0xdf, 0xe2, 0xf3, 0xf6, 0xe6, 0x44, 0x2c, 0x96, 0x89, 0x80, 0x76, 0x76, 0x70, 0x69, 0x68, 0x68, 0x68, 0x6d, 0x6b, 0x07, 0x0c, 0x12, 0xfa, 0xdb, 0xdd, 0xe6, 0xf2, 0xe9, 0xf2, 0xe4, 0xdf, 0xfd, 0xef, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xdf, 0xde, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xef, 0xee, 0xdf, 0xe3, 0xe3, 0xe0, 0xe3, 0xf5, 0xe0, 0xec, 0xda, 0xf7, 0x06, 0xa2, 0x9e, 0x9e, 0xa2, 0xa2, 0x9e, 0x4d, 0xa2, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x01, 0x4e, 0x4d, 0x54, 0x6b, 0x0e, 0x0e, 0x85, 0x82, 0x82, 0x82, 0x87, 0x82, 0x7e, 0x85, 0x84, 0x84, 0x84, 0x84, 0x76, 0x07, 0x55, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0xa1, 0x06, 0xd7, 0xf8, 0xfa, 0xda, 0xdb, 0xdd, 0xfe, 0xf5, 0xf6, 0xf5, 0xf3, 0xef, 0xe2, 0xfd, 0xde, 0xdf, 0xe2, 0xdf, 0xdf, 0xe1, 0xe6, 0xfc, 0xdb, 0x2c, 0xfa, 0x12, 0x0c, 0x7b, 0x76, 0x0d, 0x79, 0x7d, 0x11, 0x86, 0x86, 0x87, 0x88, 0x9b, 0x49, 0x49, 0x9d, 0x6f, 0x73, 0x77, 0x6c, 0x6f, 0x96, 0xeb, 0x44, 0x4c, 0x4c, 0xfe, 0x4a, 0xfb, 0xeb, 0xda, 0xf9, 0x0c, 0x07, 0x5e, 0x50, 0x02, 0x02, 0x50, 0x53, 0x02, 0x01, 0x01, 0x53, 0x53, 0x55, 0x53, 0x55, 0x53, 0x57, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x57, 0x5b, 0x58, 0x58, 0x58, 0x04, 0x57, 0x5b, 0x4d, 0x80, 0xfd, 0xfe, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xe9, 0xde, 0xef, 0xf5, 0xfc, 0xea, 0x89, 0x76, 0x65, 0x54, 0x5c, 0x69, 0x70, 0x74, 0x7a, 0x7e, 0x85, 0x88, 0x8e, 0x8e, 0x92, 0x00, 0x9e, 0x4d, 0x53, 0x63, 0x09, 0xbb, 0xcd, 0xfb, 0xe6, 0xf5, 0xe8, 0xe6, 0xdf, 0xe4, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xef, 0xdf, 0xdf, 0xdf, 0xef, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xee, 0xe2, 0xed, 0xde, 0xe0, 0xe0, 0xe0, 0xe7, 0xe0, 0xcd, 0xb0, 0xa5, 0xa2, 0xa2, 0xa4, 0xa2, 0x9e, 0xa2, 0x9f, 0xa2, 0x50, 0x01, 0xa2, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x01, 0x01, 0x01, 0x9e, 0x5d, 0x76, 0x84, 0x7a, 0x7a, 0x0e, 0x0e, 0x82, 0x85, 0x13, 0x88, 0x0e, 0x7a, 0x7a, 0x76, 0x71, 0x6d, 0x6b, 0x53, 0x01, 0x4d, 0x9e, 0x9e, 0xa2, 0x4d, 0x9f, 0x9f, 0x9f, 0x4d, 0x4d, 0x9e, 0x01, 0x9f, 0x9e, 0x9e, 0x01, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x59, 0x06, 0x09, 0x12, 0xf9, 0xea, 0xfb, 0xfc, 0xfe, 0xf2, 0xf5, 0xf3, 0xfd, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xfd, 0xf2, 0xfe, 0x44, 0xeb, 0x89, 0x84, 0x82, 0x10, 0x19, 0x20, 0x91, 0x81, 0x87, 0x83, 0x82, 0x9b, 0x47, 0x3c, 0x77, 0x6f, 0x6f, 0x84, 0x9b, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0x4c, 0x4c, 0xff, 0xeb, 0xda, 0xeb, 0xeb, 0xec, 0xda, 0x0c, 0x01, 0x01, 0x53, 0x02, 0x02, 0x4e, 0x50, 0x4f, 0x53, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x57, 0x55, 0x57, 0x55, 0x57, 0x57, 0x57, 0x57, 0x58, 0x57, 0x58, 0x57, 0x58, 0x5b, 0x5b, 0x01, 0xf7, 0xfe, 0xfd, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe6, 0xdf, 0xe4, 0xfc, 0xe8, 0xec, 0xf7, 0x5b, 0x4f, 0x4f, 0x54, 0x62, 0x76, 0x85, 0x85, 0x85, 0x82, 0x85, 0x88, 0x8e, 0x15, 0x8e, 0x89, 0x67, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0xa2, 0x50, 0xa6, 0xd7, 0xf8, 0xda, 0xec, 0xf2, 0xf5, 0xe9, 0xf3, 0xf2, 0xef, 0xef, 0xe2, 0xef, 0xe4, 0xef, 0xdf, 0xde, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xef, 0xe3, 0xdf, 0xe0, 0xe7, 0xe7, 0xe0, 0xd2, 0xc0, 0xca, 0xb5, 0xa5, 0xa5, 0xa3, 0xa2, 0x9f, 0xa1, 0x9f, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0x01, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x01, 0x01, 0x4d, 0x03, 0x60, 0x66, 0x64, 0x68, 0x68, 0x08, 0x70, 0x08, 0x6d, 0x68, 0x66, 0x5c, 0x4f, 0x4f, 0x4f, 0x4e, 0x4e, 0x9f, 0x01, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x50, 0x01, 0x9e, 0x9e, 0x9e, 0x01, 0xa1, 0x9f, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0xa1, 0x63, 0x00, 0xf7, 0xf8, 0xfa, 0xdb, 0xec, 0xe6, 0xe8, 0xe8, 0xe8, 0xf5, 0xe9, 0xf2, 0xe6, 0x4c, 0xf6, 0xff, 0x2c, 0x89, 0x99, 0x9d, 0x46, 0x9d, 0x88, 0x83, 0x83, 0x85, 0x0e, 0x85, 0x9b, 0x9b, 0x6f, 0x73, 0x6f, 0x96, 0xff, 0xff, 0xfe, 0xfc, 0xfd, 0xf5, 0xfe, 0xff, 0xfe, 0xdf, 0xea, 0xcd, 0xff, 0xea, 0x0a, 0x50, 0x4d, 0x53, 0x4d, 0x4d, 0x50, 0x55, 0x55, 0x50, 0x4f, 0x53, 0x57, 0x55, 0x53, 0x57, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x58, 0x57, 0x58, 0x55, 0x04, 0x57, 0x5b, 0x57, 0x4e, 0x12, 0xfe, 0xef, 0xfd, 0xdf, 0xe4, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xde, 0xde, 0xf6, 0xf5, 0xdd, 0x12, 0x9e, 0xa2, 0x9f, 0x9e, 0x9e, 0x4e, 0x66, 0x7b, 0x7b, 0x7a, 0x7b, 0x70, 0x68, 0x64, 0x62, 0x56, 0x58, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x5e, 0x09, 0xbb, 0xea, 0xec, 0xf2, 0xf6, 0xf5, 0xe8, 0xde, 0xef, 0xe4, 0xef, 0xe2, 0xe2, 0xe4, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xe0, 0xe0, 0xe7, 0xe0, 0xd5, 0xcf, 0xaa, 0xa7, 0xca, 0xd3, 0xd4, 0xd3, 0xc0, 0x09, 0xa5, 0x4d, 0x9f, 0xa1, 0xa1, 0x01, 0xa2, 0x01, 0xa2, 0x4d, 0xa2, 0x9e, 0x4d, 0x9e, 0xa2, 0xa2, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x54, 0x54, 0x54, 0x56, 0x54, 0x4e, 0x4d, 0x4f, 0x4d, 0x4f, 0x4d, 0x9e, 0x9e, 0x9e, 0xa2, 0x4d, 0xa2, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9f, 0x9f, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x01, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x53, 0x5e, 0x06, 0x0c, 0xbb, 0xd8, 0xcd, 0xeb, 0xdb, 0xfb, 0xfb, 0xec, 0xfb, 0x24, 0x96, 0x24, 0x29, 0x9b, 0x24, 0x0e, 0x78, 0x78, 0x7a, 0x78, 0x84, 0x7b, 0x78, 0x6c, 0x73, 0x7b, 0x9b, 0xf6, 0x4c, 0xe6, 0xe4, 0xf2, 0xfd, 0x4c, 0xf6, 0xf6, 0xfd, 0xd8, 0xbb, 0x00, 0x9e, 0x9e, 0x59, 0x5e, 0x9e, 0x53, 0x03, 0x53, 0x03, 0x53, 0x55, 0x53, 0x55, 0x55, 0x53, 0x55, 0x55, 0x57, 0x57, 0x57, 0x57, 0x55, 0x57, 0x55, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x57, 0x58, 0x55, 0x58, 0x5b, 0x9e, 0xf8, 0xfe, 0xfd, 0xe2, 0xdf, 0xf1, 0xed, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xf3, 0xdf, 0xdf, 0xde, 0xe8, 0xfa, 0xa5, 0xa6, 0xa5, 0xa4, 0xa4, 0x9e, 0x9e, 0x53, 0x03, 0x4f, 0x04, 0x4f, 0x4d, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x4d, 0x9e, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0xa5, 0xf7, 0xea, 0xfb, 0xf1, 0xe8, 0xf5, 0xf5, 0xe6, 0xf1, 0xe6, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe3, 0xfd, 0xe2, 0xe2, 0xe2, 0xe1, 0xdf, 0xe2, 0xe2, 0xee, 0xe2, 0xe2, 0xfd, 0xe2, 0xe2, 0xe3, 0xe3, 0xe0, 0xe0, 0xe0, 0xd5, 0xb8, 0xa3, 0xa7, 0xaf, 0xac, 0xaa, 0xac, 0xc0, 0xd3, 0xdc, 0xeb, 0xca, 0xd7, 0xa4, 0x9e, 0xa3, 0x01, 0xa2, 0x01, 0x9e, 0x01, 0x4d, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0x9f, 0x9f, 0x4d, 0x9f, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x4d, 0x4e, 0x4e, 0x4d, 0x4d, 0x9e, 0x01, 0x9f, 0x01, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0xa2, 0x9e, 0xa2, 0x4d, 0x01, 0x9f, 0x4d, 0x9f, 0x4d, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x50, 0x50, 0x55, 0x61, 0x04, 0x03, 0x68, 0x5d, 0x60, 0x6b, 0x5c, 0x6a, 0x6d, 0x6d, 0x5d, 0x6d, 0x6d, 0x07, 0x6f, 0x6a, 0x7b, 0x89, 0x24, 0xdb, 0xfb, 0xdd, 0xdd, 0xfc, 0xec, 0xeb, 0xfa, 0x09, 0xa5, 0x9e, 0x9e, 0x51, 0x55, 0x4d, 0x4d, 0x53, 0x50, 0x53, 0x53, 0x50, 0x53, 0x55, 0x57, 0x4f, 0x03, 0x55, 0x55, 0x57, 0x55, 0x57, 0x57, 0x57, 0x55, 0x57, 0x55, 0x57, 0x58, 0x57, 0x58, 0x58, 0x54, 0x56, 0x54, 0x54, 0x55, 0x04, 0x4d, 0xf8, 0x4c, 0xdf, 0xfe, 0xdf, 0xe4, 0xe2, 0xe2, 0xdf, 0xed, 0xdf, 0xe2, 0xe2, 0xdf, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xed, 0xed, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xf2, 0xe2, 0xde, 0xf6, 0xe9, 0xdb, 0xf7, 0x00, 0x06, 0xa6, 0x5e, 0x4d, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x4d, 0x9e, 0x4d, 0x4f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x59, 0xd7, 0xf8, 0xeb, 0xfb, 0xfd, 0xf3, 0xf2, 0xe6, 0xe6, 0xe6, 0xef, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe4, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xef, 0xed, 0xdf, 0xed, 0xe2, 0xee, 0xee, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xf2, 0xff, 0xfc, 0x4a, 0xf3, 0xee, 0xdf, 0xe7, 0xe0, 0xe0, 0xe0, 0xcf, 0xaf, 0xa7, 0xa8, 0xa8, 0xac, 0xad, 0xa8, 0xa8, 0xa8, 0xb1, 0xbc, 0xd1, 0xd5, 0xdc, 0xd3, 0xc7, 0x00, 0xa3, 0x9f, 0xa2, 0x01, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9f, 0x01, 0x4d, 0x4d, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0x01, 0x9f, 0x01, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x01, 0x4d, 0x4e, 0x51, 0x4d, 0x4f, 0x51, 0x9e, 0xa2, 0xa4, 0x9e, 0x9f, 0x53, 0x4d, 0x4e, 0x9f, 0xa2, 0x9e, 0x9e, 0x4d, 0x02, 0x4d, 0x4d, 0x9e, 0x9e, 0x01, 0x01, 0x4d, 0x9e, 0x01, 0x4d, 0x4d, 0x01, 0x4d, 0x01, 0x01, 0x9f, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x4d, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x4e, 0x4d, 0x4e, 0x4f, 0x9f, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x03, 0x03, 0x4e, 0x54, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x55, 0x55, 0x03, 0x03, 0x03, 0x04, 0x04, 0x5b, 0x04, 0x57, 0x55, 0x55, 0x57, 0x55, 0x55, 0x51, 0x55, 0x5a, 0x5b, 0x56, 0x62, 0x54, 0x56, 0x66, 0x71, 0x66, 0x04, 0x96, 0xf5, 0xff, 0xde, 0xdf, 0xdf, 0xe4, 0xed, 0xf2, 0xf2, 0xf3, 0xed, 0xde, 0xf2, 0xdf, 0xdd, 0xf2, 0xf2, 0xdf, 0xdd, 0xf1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xed, 0xed, 0xee, 0xee, 0xee, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xef, 0xdf, 0xed, 0xf1, 0xef, 0xdd, 0xea, 0x80, 0x00, 0x00, 0x06, 0x5e, 0xa1, 0x9f, 0x9e, 0x9e, 0x50, 0x53, 0x9e, 0x4d, 0x9e, 0xa2, 0x4d, 0x9f, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x5e, 0x0a, 0xf7, 0xda, 0xdb, 0xfc, 0xe2, 0xe6, 0xf2, 0xe9, 0xe6, 0xef, 0xe4, 0xdf, 0xde, 0xdf, 0xe2, 0xe4, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xe3, 0xe4, 0xe2, 0xe3, 0xdf, 0xef, 0xe4, 0xf2, 0xee, 0xf0, 0xdf, 0xe1, 0xe0, 0xe1, 0xe1, 0xfd, 0xf0, 0x4c, 0xff, 0xee, 0xf2, 0xe3, 0xdd, 0xe0, 0xe0, 0xcf, 0xaf, 0xaa, 0xa8, 0xa8, 0xad, 0xad, 0xa9, 0xa9, 0xa9, 0xb9, 0xc8, 0xc8, 0xbe, 0xb9, 0xcc, 0xd3, 0xd6, 0xd5, 0xca, 0xb0, 0xa4, 0x9f, 0x9f, 0x4d, 0x9e, 0x9e, 0x4d, 0x51, 0x4d, 0x9e, 0x9f, 0x02, 0x9e, 0x01, 0x9e, 0x4d, 0x01, 0x4d, 0x4d, 0x01, 0xa2, 0xa2, 0xa2, 0x9e, 0x9e, 0x9e, 0x4d, 0x01, 0x4e, 0x02, 0x03, 0x50, 0x03, 0x4e, 0x03, 0x02, 0x4e, 0x4d, 0x4f, 0x4d, 0x9e, 0x51, 0x51, 0x4d, 0xa2, 0x9e, 0x50, 0x55, 0x4d, 0x01, 0xa2, 0x50, 0xa1, 0x4d, 0x9e, 0x4d, 0x4d, 0x4e, 0x01, 0x01, 0x01, 0x01, 0x4d, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x01, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x4d, 0x4e, 0x01, 0x01, 0x4d, 0x4e, 0x4e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4d, 0x01, 0x4d, 0x9e, 0x9e, 0x4d, 0x4d, 0x01, 0x03, 0x4f, 0x03, 0x4f, 0x51, 0x4f, 0x51, 0x51, 0x51, 0x51, 0x53, 0x55, 0x53, 0x03, 0x03, 0x03, 0x4e, 0x01, 0x03, 0x57, 0x5b, 0x5b, 0x54, 0x5b, 0x5b, 0x5b, 0x5a, 0x54, 0x4f, 0x5c, 0x64, 0x62, 0x84, 0x24, 0x24, 0x84, 0x71, 0x24, 0xff, 0xee, 0xf3, 0xe8, 0xdf, 0xe3, 0xef, 0xde, 0xde, 0xf2, 0xf2, 0xed, 0xe2, 0xf2, 0xf2, 0xe2, 0xde, 0xef, 0xe9, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xed, 0xee, 0xed, 0xfd, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xf3, 0xdf, 0xde, 0xf3, 0xf6, 0xf5, 0xde, 0xea, 0xf7, 0x09, 0x00, 0x00, 0xa0, 0x59, 0x4d, 0x9e, 0x9e, 0x4d, 0xa1, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x01, 0x9f, 0x01, 0x4d, 0x01, 0x01, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa1, 0xd7, 0x12, 0xd8, 0xeb, 0xec, 0xde, 0xdf, 0xf3, 0xe9, 0xe6, 0xe4, 0xe6, 0xe2, 0xdf, 0xe2, 0xe4, 0xe2, 0xdf, 0xe4, 0xef, 0xe2, 0xdf, 0xdf, 0xe2, 0xe2, 0xed, 0xdf, 0xee, 0xee, 0xe2, 0xdf, 0xe1, 0xe1, 0xe1, 0xfd, 0xfe, 0x4c, 0xee, 0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xce, 0xaf, 0xac, 0xa8, 0xa8, 0xa8, 0xae, 0xa9, 0xa9, 0xa9, 0xad, 0xc8, 0xc4, 0xc2, 0xc2, 0xc8, 0xc1, 0xbe, 0xc9, 0xcf, 0xd5, 0xd6, 0xd1, 0xb0, 0xa4, 0xa3, 0x9f, 0x9f, 0x9f, 0xa2, 0x01, 0x4d, 0x01, 0x01, 0x50, 0x9e, 0x01, 0x01, 0x4d, 0xa2, 0x9f, 0x4d, 0x4d, 0x4d, 0x9f, 0x50, 0x9f, 0x50, 0x02, 0x4e, 0x02, 0x50, 0x53, 0x57, 0x53, 0x50, 0x53, 0x59, 0x53, 0x50, 0x61, 0x55, 0x4d, 0x55, 0x59, 0x9e, 0x5e, 0x57, 0x9e, 0x4e, 0x57, 0x59, 0x01, 0x4d, 0x01, 0x51, 0x50, 0x55, 0x50, 0x4e, 0x01, 0x4d, 0x4d, 0x01, 0x9f, 0x01, 0x4e, 0x4d, 0x01, 0x4d, 0x01, 0x4d, 0x4d, 0x02, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x02, 0x02, 0x01, 0x4d, 0x01, 0x4d, 0x4d, 0x01, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x4d, 0x01, 0x4e, 0x50, 0x53, 0x50, 0x50, 0x50, 0x53, 0x4f, 0x55, 0x54, 0x54, 0x55, 0x54, 0x55, 0x53, 0x53, 0x53, 0x50, 0x51, 0x51, 0x5a, 0x5a, 0x58, 0x4f, 0x4f, 0x58, 0x56, 0x54, 0x4f, 0x54, 0x56, 0x64, 0x6d, 0x7b, 0x84, 0x12, 0x84, 0x71, 0x6b, 0x5b, 0x09, 0xf8, 0xfa, 0xeb, 0xec, 0xdd, 0xe4, 0xf2, 0xe9, 0xf1, 0xf2, 0xf2, 0xe2, 0xe2, 0xde, 0xf2, 0xef, 0xdf, 0xde, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xed, 0xf0, 0xee, 0xfd, 0xfd, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xf1, 0xdf, 0xdf, 0xe4, 0xf2, 0xe2, 0xdf, 0xdf, 0xe6, 0xf3, 0xf3, 0xdd, 0xda, 0x12, 0x09, 0x00, 0x00, 0x06, 0x63, 0x9f, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x01, 0x9f, 0x02, 0x01, 0x01, 0x01, 0x4d, 0x01, 0x4d, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0xa2, 0x4d, 0x9e, 0x9e, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x59, 0x00, 0x0c, 0xf8, 0xea, 0xfb, 0xfc, 0xdf, 0xe6, 0xf2, 0xe8, 0xf2, 0xe6, 0xdf, 0xdf, 0xdf, 0xef, 0xdf, 0xed, 0xe2, 0xef, 0xef, 0xdf, 0xde, 0xe2, 0xee, 0xe2, 0xe2, 0xe1, 0xdf, 0xe2, 0xee, 0xee, 0xff, 0xee, 0xed, 0xe0, 0xe0, 0xe0, 0xd1, 0xaf, 0xa8, 0xac, 0xa8, 0xa8, 0xae, 0xa9, 0xa9, 0xa9, 0xad, 0xb6, 0xbf, 0xbf, 0xc8, 0xc4, 0xc2, 0xc4, 0xc6, 0xc2, 0xc1, 0xc6, 0xce, 0xd3, 0xd5, 0xd0, 0xb5, 0xa3, 0xa3, 0xa1, 0x9f, 0x9f, 0xa2, 0x4d, 0x01, 0x01, 0x01, 0x01, 0x4d, 0x9f, 0x9f, 0x4d, 0x9f, 0x53, 0x4e, 0x4d, 0x4e, 0x50, 0x51, 0x50, 0x59, 0x59, 0x53, 0xa4, 0x9f, 0x9f, 0x9f, 0x9f, 0xa4, 0x9f, 0xa1, 0x50, 0x5b, 0x5b, 0x5b, 0x03, 0x5b, 0x5b, 0x57, 0x55, 0x55, 0x03, 0x9e, 0xa1, 0x59, 0x9f, 0x4d, 0x4d, 0x4d, 0x9f, 0x53, 0x51, 0x50, 0x4e, 0x9f, 0x4e, 0x50, 0x02, 0x4e, 0x02, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x02, 0x4e, 0x02, 0x4e, 0x01, 0x4e, 0x4d, 0x4e, 0x4d, 0x4e, 0x01, 0x4e, 0x01, 0x02, 0x4e, 0x4d, 0x02, 0x4e, 0x50, 0x53, 0x53, 0x53, 0x9f, 0x51, 0x9f, 0x53, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x55, 0x53, 0x51, 0x51, 0x51, 0x4f, 0x58, 0x54, 0x54, 0x54, 0x56, 0x56, 0x56, 0x56, 0x64, 0x64, 0x70, 0x7a, 0x84, 0x96, 0x89, 0x71, 0x5c, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0xa4, 0xa6, 0xd7, 0xf7, 0xf9, 0xda, 0xdb, 0xec, 0xde, 0xf2, 0xf6, 0xf2, 0xf2, 0xde, 0xf2, 0xef, 0xde, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xed, 0xed, 0xee, 0xe2, 0xfd, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe4, 0xe4, 0xef, 0xde, 0xe2, 0xf1, 0xe4, 0xe2, 0xdf, 0xe4, 0xe6, 0xf6, 0xf6, 0xfc, 0xda, 0x12, 0x0c, 0x09, 0x09, 0x00, 0xa0, 0x53, 0x9f, 0x9f, 0x02, 0x01, 0x4d, 0x4d, 0x4d, 0x01, 0x4e, 0x01, 0x4e, 0x01, 0x01, 0x4d, 0x01, 0x4d, 0x9f, 0x01, 0x01, 0xa2, 0x4d, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0xa2, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa1, 0x06, 0xd7, 0x12, 0xfa, 0xeb, 0xfb, 0xdd, 0xe6, 0xe9, 0xf2, 0xe8, 0xf2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xef, 0xf2, 0xfd, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xfd, 0xee, 0xee, 0xf0, 0xde, 0xe3, 0xe7, 0xe0, 0xd1, 0xb1, 0xac, 0xac, 0xa8, 0xa8, 0xa9, 0xae, 0xa9, 0xab, 0xa9, 0xb2, 0xc5, 0xc5, 0xc4, 0xc5, 0xc4, 0xc5, 0xc4, 0xc5, 0xc4, 0xc8, 0xc2, 0xb9, 0xbc, 0xc9, 0xd3, 0xd5, 0xcf, 0xb0, 0xa3, 0x9f, 0xa1, 0x5e, 0x9f, 0x9e, 0x50, 0x01, 0x9f, 0x01, 0x9f, 0x9f, 0x9f, 0x9f, 0x4f, 0x4f, 0x4f, 0x55, 0x5a, 0x53, 0x50, 0xa2, 0x9e, 0xa2, 0xa2, 0xa3, 0xa5, 0xa6, 0xaa, 0x09, 0xa7, 0x63, 0xa2, 0x53, 0x61, 0x02, 0x04, 0x60, 0x03, 0x57, 0x5b, 0x50, 0x59, 0xd7, 0xbb, 0xf9, 0xf8, 0xbb, 0xd7, 0xa5, 0x9f, 0x9f, 0x9f, 0x51, 0x5a, 0x4f, 0x9f, 0x4f, 0x51, 0x50, 0x50, 0x4e, 0x50, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x50, 0x4e, 0x50, 0x4e, 0x50, 0x50, 0x4e, 0x50, 0x4e, 0x50, 0x53, 0x50, 0x53, 0x50, 0x50, 0x50, 0x50, 0x55, 0x50, 0x53, 0x02, 0xa4, 0x9f, 0xa4, 0x50, 0x03, 0x03, 0x04, 0x03, 0x04, 0x03, 0x03, 0x53, 0x51, 0x51, 0x51, 0x52, 0x5c, 0x5c, 0x56, 0x54, 0x56, 0x5d, 0x68, 0x0b, 0x84, 0x15, 0x16, 0x18, 0x16, 0x0e, 0x71, 0x4f, 0x4d, 0x4d, 0x9e, 0x4d, 0x4d, 0xa2, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x59, 0xa6, 0xd7, 0x12, 0xd8, 0xda, 0xfc, 0xf2, 0xdf, 0xef, 0xe4, 0xf1, 0xed, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xf0, 0xee, 0xed, 0xfd, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xef, 0xe9, 0xf1, 0xe2, 0xe2, 0xdf, 0xdf, 0xef, 0xf1, 0xe2, 0xde, 0xef, 0xf2, 0xf5, 0xde, 0xeb, 0xf8, 0x0c, 0x00, 0x09, 0xd7, 0x06, 0x63, 0xa1, 0x4d, 0x9e, 0x4d, 0x01, 0x01, 0x4d, 0x01, 0x01, 0x4e, 0x4e, 0x4e, 0x01, 0x01, 0x9f, 0x01, 0x9f, 0x4d, 0x01, 0x4d, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9f, 0x4d, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x5e, 0x06, 0x80, 0xf8, 0xea, 0xdb, 0xdd, 0xe6, 0xe9, 0xf5, 0xf5, 0xf2, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xfd, 0xee, 0xff, 0xf2, 0xf2, 0xde, 0xe0, 0xe0, 0xd1, 0xb8, 0xa8, 0xa9, 0xa8, 0xa8, 0xab, 0xae, 0xa9, 0xab, 0xab, 0xae, 0xbd, 0xc5, 0xbd, 0xc5, 0xbf, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xbf, 0xbe, 0xbd, 0xc1, 0xc6, 0xce, 0xd3, 0xd6, 0xca, 0xa5, 0xa2, 0xa5, 0x59, 0x01, 0x4d, 0x02, 0x4e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x4d, 0x53, 0x57, 0x51, 0x4d, 0xa2, 0xa2, 0xa5, 0x09, 0xb5, 0xca, 0xd0, 0xd2, 0xd3, 0xd2, 0xd3, 0xd4, 0xd0, 0xbb, 0x5e, 0x01, 0x67, 0x60, 0x03, 0x04, 0x67, 0x50, 0x5a, 0xbb, 0xd4, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd0, 0xf7, 0xa5, 0x9e, 0x9f, 0x5a, 0x51, 0x4f, 0x51, 0x53, 0x53, 0x53, 0x50, 0x53, 0x4e, 0x50, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x50, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x50, 0x4e, 0x53, 0x50, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x50, 0x53, 0x53, 0x53, 0x50, 0x53, 0x4e, 0x50, 0x51, 0xa4, 0x50, 0x53, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x55, 0x55, 0x51, 0x51, 0x51, 0x52, 0x4f, 0x52, 0x52, 0x6d, 0x7b, 0x84, 0x92, 0x92, 0x8e, 0x85, 0x0e, 0x70, 0x69, 0x66, 0x5c, 0x4d, 0x4d, 0x4f, 0x4d, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x5e, 0xea, 0xe4, 0xf2, 0xef, 0xde, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xed, 0xed, 0xee, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xef, 0xf1, 0xef, 0xed, 0xe2, 0xf1, 0xe4, 0xf1, 0xe4, 0xf3, 0xf3, 0xfe, 0xfb, 0xd8, 0x80, 0x00, 0x0c, 0x0a, 0x0a, 0x07, 0x61, 0x02, 0x9e, 0x9e, 0x01, 0x4d, 0x4e, 0x01, 0x4e, 0x4e, 0x02, 0x4d, 0x9f, 0x9f, 0x9f, 0x01, 0x9f, 0x4d, 0x9f, 0x4d, 0x01, 0x4d, 0x4d, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa1, 0x63, 0xd7, 0xf7, 0xfa, 0xeb, 0xec, 0xf2, 0xf3, 0xf5, 0xf5, 0xe2, 0xe1, 0xdf, 0xdf, 0xfd, 0xee, 0xee, 0xf0, 0xed, 0xde, 0xe0, 0xe0, 0xd5, 0xbc, 0xa8, 0xac, 0xa9, 0xa8, 0xa9, 0xad, 0xab, 0xab, 0xab, 0xab, 0xb6, 0xc5, 0xbf, 0xc5, 0xbf, 0xc4, 0xc5, 0xc8, 0xbf, 0xc5, 0xc5, 0xc5, 0xbd, 0xb6, 0xbd, 0xc2, 0xc2, 0xc1, 0xc6, 0xd1, 0xd6, 0xd2, 0xb0, 0x9e, 0xa4, 0xa0, 0x01, 0x9f, 0x02, 0x9f, 0x9f, 0x9f, 0x9f, 0x51, 0x9f, 0x51, 0x50, 0x9e, 0x9f, 0xd7, 0xca, 0xd2, 0xd5, 0xd4, 0xd3, 0xd1, 0xce, 0xd9, 0xc3, 0xc7, 0xc3, 0xcb, 0xdc, 0xd8, 0x9e, 0x5b, 0x61, 0x04, 0x05, 0x58, 0x5e, 0xbb, 0xd6, 0xca, 0xb8, 0xb5, 0xb8, 0xb8, 0xc7, 0xd1, 0xd4, 0xc0, 0xa1, 0xa2, 0x5a, 0x55, 0x4f, 0x54, 0x50, 0x4e, 0x53, 0x4e, 0x50, 0x50, 0x4e, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x50, 0x4e, 0x50, 0x4e, 0x50, 0x4e, 0x50, 0x50, 0x50, 0x50, 0x53, 0x50, 0x53, 0x50, 0x4e, 0x50, 0x4e, 0x50, 0x50, 0x4e, 0x53, 0x50, 0x50, 0x4e, 0x53, 0x53, 0x53, 0x57, 0x50, 0x50, 0x50, 0x53, 0x53, 0x03, 0x57, 0x03, 0x03, 0x03, 0x03, 0x54, 0x54, 0x52, 0x4f, 0x52, 0x5c, 0x76, 0x84, 0x92, 0x89, 0x8e, 0x7b, 0x78, 0x6a, 0x69, 0x69, 0x69, 0x68, 0x64, 0x66, 0x4e, 0x4d, 0x9e, 0x9e, 0xa2, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa4, 0x9e, 0xa2, 0x00, 0xec, 0xe9, 0xde, 0xf2, 0xdf, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xf0, 0xed, 0xfd, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xef, 0xe3, 0xed, 0xed, 0xe3, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xe6, 0xf2, 0xf3, 0xfb, 0xd8, 0x09, 0x09, 0x09, 0x0a, 0xd7, 0x09, 0x06, 0x57, 0x9e, 0x9e, 0x9e, 0x03, 0x02, 0x4e, 0x01, 0x4d, 0x4d, 0x01, 0x9f, 0x50, 0x9f, 0x4d, 0x4d, 0x9f, 0x50, 0x50, 0x9f, 0x01, 0x4d, 0x9f, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0xa4, 0x06, 0x0c, 0xf8, 0xda, 0xec, 0xf5, 0xe8, 0xf6, 0xf5, 0xfe, 0xfd, 0xde, 0xed, 0xe1, 0xe0, 0xe0, 0xd5, 0xbc, 0xa8, 0xac, 0xa9, 0xa9, 0xa8, 0xad, 0xae, 0xa9, 0xa9, 0xa9, 0xb6, 0xbf, 0xc5, 0xc5, 0xc4, 0xbf, 0xc4, 0xc4, 0xc5, 0xc5, 0xc5, 0xc5, 0xbf, 0xbd, 0xbf, 0xbf, 0xbe, 0xc6, 0xc6, 0xc6, 0xc3, 0xd9, 0xd4, 0xd6, 0xbb, 0x9e, 0x00, 0xa1, 0x59, 0x4d, 0x01, 0x51, 0x4d, 0x9f, 0xa4, 0x5e, 0x9e, 0xa2, 0xb5, 0xd0, 0xd6, 0xd5, 0xcf, 0xd9, 0xc1, 0xb8, 0xb4, 0xb4, 0xb4, 0xb1, 0xb1, 0xb1, 0xaf, 0xb4, 0xdc, 0xf8, 0x9e, 0x61, 0x03, 0x5b, 0x5a, 0x0c, 0xdb, 0xc0, 0xaf, 0xb1, 0xb1, 0xb1, 0xaf, 0xaf, 0xaf, 0xd9, 0xd5, 0xc0, 0xa2, 0x02, 0x55, 0x03, 0x54, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x03, 0x53, 0x53, 0x55, 0x53, 0x55, 0x03, 0x57, 0x57, 0x03, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x4f, 0x5c, 0x56, 0x54, 0x5c, 0x78, 0x92, 0x8e, 0x80, 0x78, 0x6d, 0x62, 0x08, 0x6d, 0x69, 0x6d, 0x68, 0x62, 0x68, 0x08, 0x66, 0x04, 0x60, 0x63, 0x63, 0xa5, 0xa1, 0xa4, 0xa4, 0x59, 0x59, 0x5e, 0x5b, 0x61, 0xa5, 0x5e, 0xa0, 0x50, 0xa2, 0xf7, 0xec, 0xe6, 0xef, 0xdf, 0xe2, 0xe2, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xf0, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xe2, 0xe2, 0xef, 0xf1, 0xdf, 0xde, 0xf2, 0xf3, 0xfd, 0xfb, 0xfa, 0x0c, 0x00, 0x0a, 0xd7, 0x09, 0x09, 0x06, 0x59, 0x4d, 0x9e, 0x9e, 0x01, 0x53, 0x9f, 0x9f, 0x4d, 0x01, 0x4d, 0x9f, 0x4d, 0x01, 0x9f, 0x50, 0x9f, 0x9f, 0x01, 0x9f, 0x02, 0x9f, 0x02, 0x01, 0x4d, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0xa1, 0xd7, 0xbb, 0xeb, 0xde, 0xf5, 0xf6, 0xf5, 0xe3, 0xe0, 0xe0, 0xdc, 0xc1, 0xac, 0xa8, 0xa9, 0xa8, 0xa8, 0xa9, 0xae, 0xab, 0xa9, 0xab, 0xad, 0xbd, 0xc5, 0xbf, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc5, 0xc5, 0xc5, 0xbf, 0xbd, 0xbd, 0xbd, 0xbd, 0xbf, 0xc6, 0xc6, 0xc6, 0xc9, 0xc3, 0xc7, 0xd3, 0xe0, 0xb5, 0x9e, 0xa6, 0xa1, 0x4d, 0x9f, 0x51, 0x9f, 0x51, 0x9f, 0x9e, 0xb0, 0xd2, 0xd6, 0xd2, 0xc3, 0xc3, 0xc1, 0xbc, 0xb9, 0xb4, 0xb7, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xaf, 0xc7, 0xdc, 0xa5, 0x59, 0x05, 0x63, 0x51, 0xb0, 0xd2, 0xb5, 0xb1, 0xae, 0xb1, 0xb2, 0xb2, 0xb1, 0xb1, 0xb4, 0xd1, 0xd2, 0xd7, 0x9f, 0x4e, 0x04, 0x03, 0x55, 0x50, 0x55, 0x53, 0x03, 0x53, 0x03, 0x53, 0x03, 0x53, 0x03, 0x53, 0x03, 0x53, 0x03, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x03, 0x53, 0x03, 0x53, 0x03, 0x53, 0x03, 0x53, 0x55, 0x53, 0x03, 0x53, 0x03, 0x53, 0x03, 0x51, 0x03, 0x50, 0x03, 0x50, 0x55, 0x03, 0x04, 0x03, 0x03, 0x53, 0x53, 0xa1, 0x51, 0x51, 0x5b, 0x5c, 0x54, 0x4f, 0x64, 0x0e, 0x88, 0x0b, 0x69, 0x5c, 0x68, 0x08, 0x08, 0x70, 0x08, 0x0b, 0x7a, 0x7a, 0x85, 0x7a, 0x71, 0x84, 0x07, 0x60, 0x06, 0x5e, 0xa1, 0xa6, 0x06, 0xa6, 0x67, 0xa0, 0x05, 0x05, 0x63, 0x06, 0xa6, 0xa4, 0xa6, 0xd8, 0xde, 0xf5, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xf0, 0xee, 0xdf, 0xdf, 0xe1, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xed, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xed, 0xe3, 0xe2, 0xe3, 0xe2, 0xe2, 0xdf, 0xe6, 0xef, 0xfd, 0xdf, 0xf3, 0xf5, 0xf6, 0xf3, 0xec, 0xf9, 0xd7, 0x00, 0xd7, 0x80, 0x0c, 0x0c, 0x00, 0x5b, 0x4d, 0x4d, 0x4d, 0x4d, 0x01, 0x02, 0x50, 0x50, 0x01, 0x4d, 0x50, 0x02, 0x50, 0x02, 0x01, 0x02, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x02, 0x02, 0x4e, 0x01, 0x4e, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x0a, 0xd8, 0xfb, 0xd6, 0xe5, 0xd5, 0xbc, 0xa8, 0xa8, 0xac, 0xa9, 0xa8, 0xa8, 0xb2, 0xad, 0xa9, 0xab, 0xab, 0xb6, 0xbd, 0xc5, 0xc4, 0xc4, 0xc5, 0xc4, 0xc4, 0xc4, 0xc5, 0xc5, 0xbf, 0xbf, 0xbd, 0xbd, 0xbf, 0xbf, 0xc4, 0xc4, 0xc6, 0xc6, 0xc6, 0xc6, 0xc3, 0xc1, 0xd1, 0xf3, 0xb5, 0x9e, 0x63, 0x5e, 0x53, 0x9f, 0x9f, 0x9f, 0x9e, 0xb0, 0xdc, 0xd5, 0xc3, 0xb8, 0xbc, 0xb9, 0xb4, 0xb9, 0xb7, 0xba, 0xb7, 0xb7, 0xb2, 0xb3, 0xb3, 0xb7, 0xbd, 0xb4, 0xa8, 0xd6, 0xca, 0x9e, 0xa0, 0xa0, 0x51, 0xb5, 0xd0, 0xb8, 0xb3, 0xb2, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb1, 0xc1, 0xd3, 0xd1, 0x02, 0x02, 0x03, 0x54, 0x50, 0x55, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x50, 0x55, 0x50, 0x55, 0x50, 0x53, 0x03, 0x04, 0x03, 0x04, 0x03, 0x4f, 0x51, 0x4f, 0x51, 0x52, 0x4f, 0x4f, 0x62, 0x08, 0x15, 0x1a, 0x7d, 0x0d, 0x0f, 0x18, 0x17, 0x18, 0x19, 0x1a, 0x1a, 0x1d, 0x1d, 0x1d, 0x1a, 0x1d, 0x29, 0xf8, 0x24, 0xeb, 0x24, 0xf9, 0xf8, 0xf7, 0x0c, 0xd7, 0x09, 0x09, 0x00, 0x09, 0x00, 0xd7, 0xf8, 0xda, 0xfc, 0xf6, 0xf6, 0xdd, 0xe4, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xf0, 0xed, 0xed, 0xe1, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xed, 0xe2, 0xf1, 0xe2, 0xde, 0xde, 0xfc, 0xef, 0xf6, 0xf6, 0xdd, 0xfa, 0xf7, 0x09, 0x09, 0x0a, 0x0c, 0xf7, 0x0a, 0x67, 0x59, 0x50, 0x01, 0x4d, 0x01, 0x02, 0x50, 0x50, 0x02, 0x50, 0x02, 0x02, 0x02, 0x50, 0x50, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x50, 0x02, 0x02, 0x01, 0x01, 0x4d, 0x4d, 0x4d, 0x4d, 0xa2, 0x4d, 0x9e, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0xa2, 0x02, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa3, 0xc9, 0xc9, 0xa8, 0xac, 0xab, 0xad, 0xa8, 0xa8, 0xae, 0xad, 0xa9, 0xa9, 0xae, 0xad, 0xbf, 0xc4, 0xc5, 0xc4, 0xc5, 0xc4, 0xc4, 0xc5, 0xc8, 0xc5, 0xc4, 0xbf, 0xbd, 0xbd, 0xbd, 0xbd, 0xc4, 0xc4, 0xc4, 0xc6, 0xc8, 0xc9, 0xc8, 0xbc, 0xc1, 0xb8, 0xd5, 0xd6, 0x00, 0xa5, 0x63, 0x59, 0x50, 0x50, 0x9e, 0xa6, 0xe0, 0xce, 0xb8, 0xb4, 0xbc, 0xbc, 0xc2, 0xba, 0xb7, 0xb7, 0xb6, 0xb7, 0xb6, 0xb3, 0xb2, 0xb7, 0xbf, 0xba, 0xb7, 0xb4, 0xbc, 0xd6, 0xa5, 0x59, 0xa0, 0xa4, 0xb0, 0xd0, 0xbc, 0xb7, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xae, 0xb1, 0xb9, 0xd9, 0xd6, 0x00, 0x50, 0x03, 0x03, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x03, 0x03, 0x04, 0x04, 0x56, 0x54, 0x4f, 0x52, 0x52, 0x52, 0x5c, 0x69, 0x76, 0x7e, 0x8e, 0x99, 0x30, 0x30, 0x3b, 0x30, 0x27, 0x22, 0x30, 0x1d, 0x22, 0x1d, 0x16, 0x16, 0x84, 0x89, 0x66, 0x0c, 0xfb, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xf2, 0xf1, 0xee, 0xfd, 0xee, 0xee, 0xf4, 0xf6, 0xe9, 0xf6, 0xf5, 0xdd, 0xdd, 0xf3, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xf0, 0xed, 0xed, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xed, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe1, 0xe3, 0xe1, 0xe2, 0xe3, 0xdf, 0xe4, 0xf2, 0xdf, 0xdf, 0xe3, 0xee, 0xed, 0xf1, 0xf6, 0xde, 0xdd, 0xef, 0xf5, 0xf2, 0xec, 0xfa, 0x12, 0x0c, 0x09, 0xd7, 0x0c, 0x0c, 0x0a, 0x00, 0x63, 0x53, 0x9e, 0x4d, 0x02, 0x50, 0x02, 0x9f, 0x02, 0x50, 0x50, 0x02, 0x02, 0x01, 0x4e, 0x02, 0x02, 0x02, 0x4e, 0x50, 0x4e, 0x02, 0x4e, 0x02, 0x4e, 0x01, 0x4e, 0x9f, 0x4d, 0x4d, 0xa2, 0x4d, 0x4d, 0xa2, 0x4d, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x9f, 0x9e, 0xa3, 0xa3, 0xb4, 0xac, 0xa9, 0xab, 0xa8, 0xa9, 0xa9, 0xad, 0xae, 0xab, 0xab, 0xa9, 0xab, 0xb6, 0xc5, 0xbf, 0xc5, 0xbf, 0xc5, 0xc4, 0xc5, 0xc5, 0xc5, 0xc5, 0xbf, 0xbd, 0xbd, 0xbd, 0xbd, 0xbe, 0xc4, 0xc4, 0xc8, 0xc4, 0xc8, 0xc5, 0xc4, 0xc2, 0xc2, 0xc3, 0xc7, 0xdc, 0xcd, 0x9f, 0x5e, 0x50, 0xa1, 0xa1, 0x9e, 0xcd, 0xd5, 0xb8, 0xbc, 0xc6, 0xb9, 0xb7, 0xba, 0xb7, 0xba, 0xb6, 0xb3, 0xb6, 0xb3, 0xb3, 0xb6, 0xc2, 0xc5, 0xb7, 0xb6, 0xc1, 0xac, 0xd5, 0xbb, 0xa4, 0xa0, 0xa4, 0xd7, 0xd0, 0xb8, 0xb7, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xc1, 0xc1, 0xd3, 0xd8, 0xa4, 0x51, 0x57, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x53, 0x55, 0x53, 0x55, 0x55, 0x53, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x03, 0x51, 0x03, 0x03, 0x03, 0x54, 0x54, 0x56, 0x52, 0x5c, 0x52, 0x69, 0x78, 0x7a, 0x78, 0x69, 0x69, 0x84, 0x1d, 0x16, 0x84, 0x7a, 0x0e, 0x7a, 0x70, 0x71, 0x68, 0x6b, 0x66, 0x60, 0x66, 0x9e, 0x6b, 0xfb, 0xf6, 0xff, 0xee, 0xfd, 0xde, 0xf0, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xdf, 0xde, 0xde, 0xef, 0xe6, 0xe2, 0xdf, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xf0, 0xdf, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xf1, 0xf2, 0xef, 0xed, 0xee, 0xf1, 0xdf, 0xe3, 0xf2, 0xe4, 0xe4, 0xe4, 0xe9, 0xf5, 0xec, 0xfa, 0xf7, 0xd7, 0x09, 0xd7, 0xd7, 0xd7, 0x0a, 0x00, 0x06, 0x5b, 0x4d, 0x9e, 0x50, 0x50, 0x02, 0x50, 0x53, 0x50, 0x01, 0x53, 0x02, 0x50, 0x50, 0x50, 0x53, 0x50, 0x02, 0x02, 0x02, 0x02, 0x02, 0x50, 0x02, 0x02, 0x9f, 0x9f, 0x9f, 0x4d, 0xa2, 0x4d, 0x4d, 0x9e, 0x4d, 0x4d, 0x9e, 0x01, 0xa2, 0x9e, 0x9e, 0x01, 0x9e, 0x01, 0x01, 0xa2, 0xa3, 0xc1, 0xb4, 0xa8, 0xad, 0xab, 0xa9, 0xa9, 0xa9, 0xad, 0xad, 0xa9, 0xad, 0xab, 0xad, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xbf, 0xbf, 0xbd, 0xbd, 0xbe, 0xbe, 0xc4, 0xc4, 0xc8, 0xc4, 0xc8, 0xc4, 0xbf, 0xbf, 0xbf, 0xc6, 0xc1, 0xb8, 0xd6, 0xd6, 0xa6, 0x59, 0xa1, 0x59, 0x01, 0x63, 0xdb, 0xd1, 0xb4, 0xbc, 0xb9, 0xb7, 0xbe, 0xba, 0xb6, 0xb6, 0xb7, 0xb6, 0xb7, 0xb6, 0xb3, 0xb7, 0xc4, 0xbe, 0xb7, 0xb3, 0xb3, 0xb8, 0xca, 0xd0, 0x5a, 0xa0, 0x59, 0xaa, 0xd2, 0xc0, 0xb7, 0xb3, 0xae, 0xb2, 0xb2, 0xae, 0xae, 0xb2, 0xc6, 0xc9, 0xc7, 0xd4, 0xa5, 0x51, 0x50, 0x53, 0x03, 0x51, 0x03, 0x51, 0x03, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x50, 0x55, 0x50, 0x55, 0x4e, 0x55, 0x50, 0x55, 0x50, 0x55, 0x4e, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x53, 0x51, 0x54, 0x54, 0x56, 0x62, 0x62, 0x78, 0x7e, 0x7e, 0x78, 0x73, 0x69, 0x62, 0x69, 0x6a, 0x6d, 0x64, 0x66, 0x6b, 0x6b, 0x60, 0x6b, 0x60, 0x05, 0x07, 0x57, 0x5b, 0x0c, 0xdb, 0xe9, 0xe9, 0xde, 0xde, 0xef, 0xee, 0xdf, 0xde, 0xed, 0xe2, 0xed, 0xe3, 0xdf, 0xe1, 0xf2, 0xf1, 0xe4, 0xe2, 0xdf, 0xe2, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xf0, 0xed, 0xe1, 0xe1, 0xe1, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xed, 0xdf, 0xe2, 0xdf, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe1, 0xe1, 0xe2, 0xe1, 0xe3, 0xe3, 0xe2, 0xdf, 0xe4, 0xef, 0xef, 0xf1, 0xf0, 0xde, 0xf2, 0xe3, 0xdf, 0xed, 0xdf, 0xe2, 0xe2, 0xe6, 0xe9, 0xf5, 0xec, 0xea, 0xf7, 0x09, 0x0a, 0xd7, 0x0a, 0x0c, 0x0a, 0x09, 0x06, 0x63, 0x02, 0x01, 0x4d, 0x02, 0x50, 0x50, 0x50, 0x03, 0x50, 0x03, 0x50, 0x03, 0x50, 0x50, 0x50, 0x50, 0x50, 0x02, 0x50, 0x02, 0x50, 0x02, 0x9f, 0x9f, 0x9f, 0x4d, 0x9f, 0x4d, 0x4d, 0x9e, 0x9f, 0x4d, 0x9e, 0x9e, 0x4d, 0x9e, 0x4d, 0x01, 0x9e, 0xa2, 0x9e, 0xa3, 0xb5, 0xb4, 0xac, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xad, 0xad, 0xab, 0xab, 0xa9, 0xab, 0xbd, 0xc5, 0xbf, 0xbf, 0xc5, 0xc5, 0xbf, 0xc5, 0xc5, 0xc5, 0xbf, 0xbf, 0xbd, 0xbd, 0xbe, 0xbe, 0xc2, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xbd, 0xbf, 0xbf, 0xbd, 0xc4, 0xc6, 0xb8, 0xcf, 0xe5, 0x0c, 0x4d, 0x5e, 0xa1, 0x01, 0xd7, 0xd6, 0xd1, 0xb1, 0xb9, 0xb9, 0xba, 0xb7, 0xba, 0xb7, 0xb7, 0xb6, 0xb7, 0xb3, 0xb7, 0xb7, 0xba, 0xbe, 0xbe, 0xbd, 0xb3, 0xb3, 0xb8, 0xb8, 0xdb, 0x00, 0x63, 0xa1, 0x09, 0xd0, 0xc7, 0xb9, 0xb3, 0xb2, 0xb2, 0xae, 0xb2, 0xae, 0xb3, 0xcc, 0xc9, 0xb4, 0xd2, 0xb5, 0xa2, 0x9f, 0x03, 0x51, 0x03, 0x4f, 0x03, 0x4f, 0x03, 0x55, 0x55, 0x53, 0x57, 0x55, 0x57, 0x55, 0x53, 0x03, 0x55, 0x03, 0x55, 0x55, 0x50, 0x55, 0x50, 0x55, 0x53, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x53, 0x4f, 0x55, 0x4f, 0x53, 0x4f, 0x53, 0x55, 0x4f, 0x55, 0x4f, 0x03, 0x54, 0x53, 0x51, 0x4f, 0x56, 0x69, 0x79, 0x88, 0x13, 0x91, 0x88, 0x72, 0x6c, 0x69, 0x5f, 0x65, 0x66, 0x07, 0x6b, 0x67, 0x65, 0x6b, 0x67, 0xa0, 0x06, 0xa0, 0x5e, 0xa5, 0x12, 0xfb, 0xf6, 0xdd, 0xde, 0xe6, 0xde, 0xe2, 0xe2, 0xed, 0xed, 0xed, 0xe3, 0xe3, 0xe3, 0xe0, 0xdf, 0xde, 0xed, 0xef, 0xed, 0xdf, 0xed, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xed, 0xdf, 0xe0, 0xdf, 0xe3, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xdf, 0xed, 0xef, 0xf2, 0xed, 0xed, 0xe3, 0xe2, 0xf0, 0xef, 0xee, 0xdf, 0xed, 0xe2, 0xe4, 0xe9, 0xe6, 0xec, 0xcd, 0xf7, 0x00, 0x09, 0x0a, 0x0c, 0x0a, 0x09, 0x09, 0x00, 0x67, 0xa1, 0x9e, 0x4d, 0x50, 0x53, 0x4d, 0x50, 0x53, 0x53, 0x02, 0x02, 0x02, 0x50, 0x02, 0x50, 0x50, 0x50, 0x02, 0x01, 0x9f, 0x50, 0x50, 0x9f, 0x50, 0x9f, 0x02, 0x9f, 0x4d, 0x9f, 0x01, 0x4d, 0x4d, 0x01, 0x4d, 0x4d, 0x4d, 0x01, 0x9e, 0xa3, 0xaa, 0xbc, 0xac, 0xa9, 0xad, 0xab, 0xa8, 0xa9, 0xab, 0xae, 0xab, 0xab, 0xab, 0xa9, 0xb2, 0xc5, 0xbf, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xbf, 0xbd, 0xbd, 0xbf, 0xbe, 0xbe, 0xc4, 0xc4, 0xc8, 0xc4, 0xc4, 0xbd, 0xbd, 0xbd, 0xbf, 0xbe, 0xc8, 0xc1, 0xc1, 0xcd, 0xe0, 0xbb, 0x9e, 0x5e, 0x59, 0x9e, 0xbb, 0xd6, 0xc3, 0xba, 0xb9, 0xb9, 0xba, 0xba, 0xb7, 0xb7, 0xb6, 0xb7, 0xb6, 0xb7, 0xb7, 0xb7, 0xbe, 0xba, 0xc2, 0xbd, 0xb3, 0xb7, 0xb1, 0xb8, 0xd2, 0xbb, 0x5b, 0x5e, 0xa6, 0xd0, 0xc7, 0xb9, 0xb2, 0xb3, 0xb1, 0xb2, 0xb2, 0xb2, 0xbd, 0xcc, 0xc9, 0xb4, 0xcd, 0xcd, 0x9e, 0x5a, 0x51, 0x53, 0x55, 0x53, 0x53, 0x55, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x03, 0x53, 0x53, 0x53, 0x03, 0x55, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x54, 0x03, 0x51, 0x57, 0x57, 0x55, 0x03, 0x03, 0x55, 0x55, 0x50, 0x58, 0x53, 0x4f, 0x04, 0x54, 0x03, 0x56, 0x64, 0x08, 0x0e, 0x8e, 0x95, 0x15, 0x7e, 0x82, 0x91, 0x15, 0x73, 0x62, 0x6a, 0x65, 0x65, 0x06, 0x6a, 0xa0, 0x6b, 0xa0, 0xa0, 0x67, 0x06, 0x5e, 0xa0, 0xf9, 0xde, 0xe9, 0xe1, 0xde, 0xe1, 0xe3, 0xdf, 0xdf, 0xed, 0xe2, 0xef, 0xed, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xf1, 0xed, 0xdf, 0xef, 0xe4, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xed, 0xe2, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xf0, 0xf0, 0xee, 0xed, 0xee, 0xe7, 0xe3, 0xe1, 0xe7, 0xe9, 0xed, 0xec, 0xea, 0xf7, 0x00, 0x00, 0xd7, 0xd7, 0xd7, 0x09, 0x09, 0x09, 0x06, 0x50, 0x9e, 0x9e, 0x53, 0x01, 0x4d, 0x02, 0x50, 0x50, 0x50, 0x9f, 0x02, 0xa4, 0x9f, 0x50, 0x9f, 0xa4, 0x50, 0x02, 0x9f, 0x02, 0x02, 0x50, 0x02, 0x50, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x4e, 0x4e, 0x4f, 0x4d, 0xa3, 0xa7, 0xc3, 0xb1, 0xad, 0xa9, 0xab, 0xa8, 0xa9, 0xad, 0xae, 0xab, 0xab, 0xab, 0xa9, 0xae, 0xbd, 0xc8, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xbf, 0xbf, 0xbf, 0xbd, 0xbd, 0xbd, 0xc4, 0xc8, 0xc4, 0xc4, 0xbe, 0xba, 0xba, 0xba, 0xbd, 0xbe, 0xbe, 0xc6, 0xc2, 0xbc, 0xce, 0xe5, 0x12, 0x4d, 0x5b, 0x59, 0x9f, 0xd8, 0xd5, 0xc1, 0xba, 0xb7, 0xba, 0xba, 0xba, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xba, 0xbe, 0xbe, 0xbe, 0xba, 0xb3, 0xb3, 0xb7, 0xb4, 0xcf, 0xd8, 0x5b, 0x61, 0x5a, 0xd0, 0xd9, 0xb7, 0xae, 0xb2, 0xae, 0xb1, 0xb2, 0xb1, 0xbe, 0xcc, 0xcc, 0xb8, 0xc7, 0xd2, 0x9f, 0x50, 0x51, 0x53, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x51, 0x54, 0x55, 0x55, 0x53, 0x03, 0x53, 0x03, 0x55, 0x53, 0x53, 0x55, 0x55, 0x4f, 0x55, 0x54, 0x4f, 0x54, 0x4f, 0x50, 0x4e, 0x50, 0x04, 0x03, 0x54, 0x55, 0x4f, 0x51, 0x4f, 0x54, 0x54, 0x56, 0x68, 0x0d, 0x17, 0x1a, 0x95, 0x8e, 0x7a, 0x72, 0x7d, 0x82, 0x17, 0x22, 0x7e, 0x62, 0x5f, 0x65, 0x65, 0x67, 0x65, 0x63, 0x65, 0x06, 0x06, 0x5e, 0x50, 0xd7, 0xda, 0xe2, 0xe6, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xe2, 0xdf, 0xe1, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xef, 0xef, 0xee, 0xf0, 0xf0, 0xf1, 0xdf, 0xef, 0xe4, 0xde, 0xe1, 0xf2, 0xe8, 0xf2, 0xf1, 0xfc, 0xea, 0xf7, 0xa0, 0x07, 0x0c, 0x0c, 0x09, 0x00, 0x0a, 0xd7, 0x00, 0x63, 0x9e, 0x4e, 0x57, 0x50, 0x4d, 0x01, 0xa1, 0x50, 0x9f, 0x50, 0x9f, 0x9f, 0x9f, 0x50, 0xa4, 0x02, 0x50, 0x02, 0x50, 0x02, 0x02, 0x02, 0x50, 0x50, 0x50, 0x50, 0x02, 0x50, 0x02, 0x4e, 0x60, 0x9e, 0xa4, 0xc9, 0xbc, 0xa8, 0xa9, 0xad, 0xa9, 0xa8, 0xab, 0xb2, 0xab, 0xab, 0xab, 0xa9, 0xae, 0xb6, 0xc5, 0xc5, 0xc4, 0xc4, 0xc5, 0xc8, 0xc5, 0xc5, 0xbf, 0xbf, 0xbd, 0xbf, 0xbe, 0xbd, 0xbd, 0xbe, 0xc8, 0xc8, 0xc4, 0xba, 0xba, 0xba, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xc4, 0xc6, 0xc3, 0xd9, 0xe5, 0xbb, 0x4d, 0x61, 0xa1, 0xa5, 0xd0, 0xd4, 0xb9, 0xba, 0xb7, 0xba, 0xba, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb3, 0xb3, 0xba, 0xbd, 0xbe, 0xba, 0xc2, 0xba, 0xb3, 0xb2, 0xb6, 0xb4, 0xce, 0xea, 0xa0, 0x5b, 0x59, 0xd8, 0xce, 0xb3, 0xb6, 0xae, 0xb1, 0xae, 0xb3, 0xb2, 0xc4, 0xcc, 0xcc, 0xc1, 0xc0, 0xd4, 0xa0, 0xa2, 0x55, 0x53, 0x51, 0x55, 0x53, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x51, 0x03, 0x03, 0x03, 0x53, 0x03, 0x53, 0x55, 0x53, 0x03, 0x51, 0x03, 0x51, 0x53, 0x51, 0x51, 0xa1, 0x55, 0x03, 0x04, 0x04, 0x54, 0x4f, 0x5a, 0x4d, 0x52, 0x5c, 0x68, 0x0b, 0x18, 0x19, 0x1e, 0x88, 0x0e, 0x6c, 0x72, 0x8e, 0x99, 0x1b, 0x13, 0x1e, 0x82, 0x68, 0x65, 0x65, 0x65, 0x65, 0x67, 0x07, 0x07, 0xa0, 0x57, 0x5e, 0xf9, 0xec, 0xf2, 0xe6, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xed, 0xe2, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xee, 0xef, 0xee, 0xf1, 0xf0, 0xdf, 0xe4, 0xe7, 0xe1, 0xde, 0xdf, 0xed, 0xde, 0xe2, 0xf2, 0xf2, 0xfc, 0xda, 0xf7, 0x5e, 0x06, 0x0c, 0x0c, 0x09, 0x07, 0x09, 0x0a, 0x09, 0x61, 0x9e, 0x9e, 0x50, 0x53, 0x4d, 0x50, 0x50, 0x50, 0x9f, 0x01, 0x9f, 0x9f, 0x9f, 0x50, 0x50, 0x02, 0x50, 0x02, 0x50, 0x50, 0x53, 0x53, 0x53, 0x50, 0x50, 0x50, 0x50, 0x53, 0xa2, 0xa3, 0xb8, 0xc9, 0xa8, 0xab, 0xad, 0xa9, 0xa8, 0xa9, 0xb6, 0xab, 0xa9, 0xab, 0xab, 0xab, 0xb6, 0xc8, 0xc5, 0xc4, 0xc5, 0xc4, 0xc8, 0xc8, 0xc5, 0xc4, 0xbf, 0xbf, 0xbf, 0xbd, 0xba, 0xbe, 0xc4, 0xc5, 0xc4, 0xbe, 0xbd, 0xba, 0xba, 0xbd, 0xbe, 0xbd, 0xc2, 0xbf, 0xc2, 0xc4, 0xc6, 0xc1, 0xd9, 0xe5, 0xf7, 0x02, 0x61, 0x01, 0xd7, 0xd4, 0xd1, 0xb9, 0xb7, 0xba, 0xba, 0xba, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb3, 0xb7, 0xbe, 0xc2, 0xba, 0xba, 0xc2, 0xbe, 0xb2, 0xb2, 0xb6, 0xb3, 0xc7, 0xd2, 0x09, 0x05, 0xa1, 0xf8, 0xd1, 0xb3, 0xb6, 0xb2, 0xb2, 0xb3, 0xb2, 0xb2, 0xc5, 0xcc, 0xcc, 0xc9, 0xb8, 0xd2, 0xa0, 0x9f, 0x53, 0x51, 0x53, 0x53, 0x55, 0x55, 0x53, 0x55, 0x53, 0x55, 0x55, 0x51, 0x53, 0x55, 0x03, 0x55, 0x03, 0x55, 0x55, 0x55, 0x53, 0x53, 0x51, 0x53, 0x50, 0x51, 0x50, 0x51, 0xa4, 0x51, 0x53, 0x03, 0x04, 0x04, 0x5d, 0x56, 0x52, 0x52, 0x62, 0x7a, 0x8e, 0x1a, 0x1a, 0x10, 0x78, 0x69, 0x62, 0x08, 0x88, 0x9d, 0x1e, 0x0f, 0x81, 0x19, 0x10, 0x69, 0x6a, 0x65, 0x61, 0x67, 0x67, 0x61, 0x5e, 0x63, 0x00, 0xda, 0xde, 0xf6, 0xdf, 0xde, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xfd, 0xef, 0xdf, 0xe1, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xef, 0xe2, 0xe2, 0xef, 0xe4, 0xdf, 0xe2, 0xe6, 0xe3, 0xe4, 0xe4, 0xe4, 0xdf, 0xdf, 0xf1, 0xf2, 0xf5, 0xf5, 0xec, 0xda, 0xd7, 0x07, 0x00, 0x0c, 0xd7, 0x09, 0x09, 0x09, 0x0a, 0x0a, 0x07, 0x53, 0x4d, 0x4d, 0x50, 0x50, 0x4d, 0x9f, 0x53, 0xa1, 0x9f, 0x02, 0x50, 0x50, 0x50, 0x02, 0x50, 0x02, 0x50, 0x50, 0x50, 0x50, 0x50, 0x53, 0x50, 0x50, 0xa4, 0xa2, 0xb5, 0xd1, 0xac, 0xa9, 0xab, 0xab, 0xa8, 0xa9, 0xae, 0xae, 0xab, 0xab, 0xab, 0xab, 0xb6, 0xbf, 0xc5, 0xc8, 0xc4, 0xc4, 0xc8, 0xc8, 0xc4, 0xc4, 0xbe, 0xbe, 0xbd, 0xc2, 0xbd, 0xbd, 0xbf, 0xc8, 0xc4, 0xba, 0xb6, 0xba, 0xba, 0xbd, 0xbe, 0xbe, 0xc2, 0xc4, 0xc4, 0xc8, 0xc2, 0xc2, 0xc1, 0xcb, 0xe5, 0xd7, 0x50, 0x59, 0x4d, 0xbb, 0xd6, 0xcb, 0xb9, 0xb7, 0xba, 0xba, 0xba, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb3, 0xb7, 0xbe, 0xc2, 0xba, 0xbe, 0xc2, 0xba, 0xb3, 0xb2, 0xb6, 0xb3, 0xbc, 0xd4, 0xf7, 0x63, 0x59, 0xb0, 0xd3, 0xb4, 0xb6, 0xb2, 0xb2, 0xb6, 0xb2, 0xb6, 0xbf, 0xcc, 0xce, 0xbe, 0xc7, 0xd2, 0xa4, 0x57, 0x53, 0x55, 0x53, 0x55, 0x53, 0x53, 0x53, 0x51, 0x53, 0x51, 0x53, 0x51, 0x53, 0x53, 0x55, 0x54, 0x55, 0x55, 0x53, 0x55, 0x51, 0x53, 0x50, 0x51, 0xa4, 0x50, 0xa4, 0x50, 0xa4, 0x9f, 0x5a, 0x4f, 0x54, 0x4f, 0x5c, 0x64, 0x0b, 0x10, 0x1e, 0x22, 0x95, 0x88, 0x6c, 0x69, 0x62, 0x69, 0x69, 0x69, 0x8e, 0x19, 0x72, 0x70, 0x79, 0x1b, 0x85, 0x64, 0x62, 0x67, 0x6b, 0x5e, 0x06, 0x61, 0x01, 0x12, 0xfd, 0xf6, 0xfd, 0xde, 0xf1, 0xf2, 0xdf, 0xde, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xed, 0xe2, 0xe2, 0xe1, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xdf, 0xe3, 0xe3, 0xe3, 0xe2, 0xe1, 0xe6, 0xf2, 0xdf, 0xdf, 0xef, 0xf1, 0xe4, 0xf1, 0xe8, 0xe2, 0xde, 0xdf, 0xf4, 0xf5, 0xf6, 0xf1, 0xfa, 0xd7, 0x00, 0xd7, 0xd7, 0xd7, 0x0a, 0x09, 0x09, 0xd7, 0x0c, 0x71, 0x5e, 0x02, 0x4d, 0x9e, 0x4d, 0x50, 0x53, 0x9f, 0x02, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x53, 0x9f, 0xa2, 0xa7, 0xcf, 0xb4, 0xa8, 0xad, 0xab, 0xa9, 0xa9, 0xae, 0xae, 0xa9, 0xab, 0xab, 0xa9, 0xae, 0xbf, 0xc5, 0xc4, 0xc5, 0xc8, 0xc8, 0xc8, 0xc4, 0xc2, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xbe, 0xc5, 0xc4, 0xbe, 0xba, 0xba, 0xba, 0xbd, 0xbe, 0xba, 0xba, 0xbe, 0xc4, 0xc5, 0xc5, 0xc8, 0xc4, 0xc2, 0xb8, 0xd2, 0xd6, 0xa6, 0x57, 0x53, 0xa1, 0xd8, 0xd5, 0xc0, 0xb9, 0xb7, 0xba, 0xba, 0xba, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xba, 0xc2, 0xbe, 0xba, 0xba, 0xc2, 0xba, 0xb2, 0xb2, 0xb6, 0xb2, 0xbc, 0xd3, 0xf8, 0x5e, 0x57, 0x00, 0xd4, 0xb9, 0xb6, 0xb2, 0xb6, 0xb2, 0xb6, 0xb6, 0xbf, 0xcc, 0xce, 0xaf, 0xd1, 0xda, 0x50, 0x4e, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x51, 0x55, 0x50, 0x53, 0x53, 0x53, 0x53, 0x51, 0x55, 0x55, 0x55, 0x53, 0x55, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0xa1, 0x53, 0x51, 0x51, 0xa4, 0x52, 0x4f, 0x5c, 0x08, 0x0d, 0x17, 0x27, 0x98, 0x1e, 0x82, 0x6c, 0x6c, 0x5f, 0x62, 0x5c, 0x6a, 0x62, 0x62, 0x95, 0x88, 0x08, 0x72, 0x11, 0x98, 0x0d, 0x62, 0x66, 0x65, 0x67, 0x06, 0x50, 0x09, 0xfb, 0xf6, 0xde, 0xde, 0xf2, 0xf3, 0xde, 0xde, 0xed, 0xf2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xe2, 0xdf, 0xe1, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe4, 0xe5, 0xe8, 0xe5, 0xe5, 0xe1, 0xe6, 0xe6, 0xe2, 0xfd, 0xe2, 0xdf, 0xdf, 0xde, 0xde, 0xf2, 0xf3, 0xe2, 0xde, 0xde, 0xdf, 0xf3, 0xf6, 0xdf, 0xfa, 0x09, 0x06, 0x09, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x09, 0x0c, 0x09, 0x67, 0x63, 0x53, 0x01, 0x4d, 0x4e, 0x50, 0x50, 0x53, 0x50, 0x50, 0x53, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x53, 0x50, 0x53, 0xa2, 0xb0, 0xd1, 0xac, 0xac, 0xa9, 0xa9, 0xa9, 0xab, 0xb2, 0xab, 0xa9, 0xab, 0xab, 0xae, 0xbd, 0xc5, 0xc8, 0xc5, 0xc5, 0xc8, 0xc5, 0xc4, 0xc4, 0xc4, 0xbe, 0xbe, 0xbe, 0xbd, 0xbe, 0xbf, 0xc4, 0xbe, 0xbd, 0xb7, 0xbe, 0xbd, 0xbe, 0xbd, 0xc2, 0xc2, 0xc4, 0xc4, 0xc4, 0xc5, 0xc4, 0xc4, 0xc6, 0xb8, 0xd5, 0xdb, 0xa1, 0x5b, 0x50, 0x06, 0xd0, 0xd4, 0xb8, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbe, 0xbe, 0xbe, 0xba, 0xc2, 0xc2, 0xba, 0xb2, 0xb2, 0xb6, 0xb2, 0xb9, 0xd1, 0xcd, 0xa0, 0x5e, 0xa0, 0xd0, 0xcb, 0xba, 0xb7, 0xb3, 0xb6, 0xb6, 0xbf, 0xbf, 0xcc, 0xc6, 0xc7, 0xd4, 0xbb, 0x01, 0x03, 0x55, 0x55, 0x53, 0x55, 0x51, 0x53, 0x51, 0x53, 0x50, 0x53, 0x53, 0x53, 0x53, 0x53, 0x50, 0x51, 0x53, 0x51, 0x53, 0x53, 0x55, 0x55, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4f, 0x52, 0x62, 0x70, 0x10, 0x1a, 0x99, 0x99, 0x91, 0x7e, 0x72, 0x6c, 0x72, 0x87, 0x7d, 0x62, 0x5a, 0x5f, 0x6a, 0x6d, 0x82, 0x85, 0x81, 0x11, 0x1b, 0x18, 0x0b, 0x5d, 0x6b, 0xa0, 0x59, 0x59, 0xf8, 0xfc, 0xfe, 0xde, 0xfd, 0xf1, 0xde, 0xdf, 0xf1, 0xdf, 0xde, 0xf1, 0xe3, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe1, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe3, 0xe5, 0xe1, 0xdc, 0xe0, 0xe5, 0xe1, 0xe0, 0xdf, 0xe6, 0xf1, 0xf1, 0xef, 0xe4, 0xf2, 0xef, 0xed, 0xdf, 0xe4, 0xef, 0xf2, 0xf1, 0xe2, 0xdf, 0xf4, 0xf6, 0xdd, 0xfa, 0x80, 0x00, 0x09, 0x0a, 0xd7, 0x0a, 0x09, 0x07, 0x09, 0x0a, 0x0a, 0x07, 0x63, 0x53, 0x02, 0x02, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x53, 0x50, 0x50, 0x50, 0x53, 0x50, 0x53, 0x50, 0xa2, 0xa6, 0xcd, 0xcb, 0xb8, 0xb4, 0xa9, 0xad, 0xae, 0xab, 0xa9, 0xab, 0xab, 0xab, 0xbd, 0xc8, 0xc8, 0xc8, 0xc5, 0xc5, 0xc5, 0xbf, 0xc4, 0xbf, 0xbf, 0xbe, 0xbe, 0xbe, 0xbe, 0xc8, 0xc4, 0xbd, 0xba, 0xbd, 0xbe, 0xbd, 0xbe, 0xbd, 0xbe, 0xc4, 0xc8, 0xc6, 0xc4, 0xbf, 0xc5, 0xc4, 0xc4, 0xc1, 0xbc, 0xdc, 0xea, 0x01, 0x5e, 0x50, 0xd7, 0xd4, 0xd1, 0xb8, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xb7, 0xb7, 0xba, 0xb7, 0xb3, 0xba, 0xc2, 0xbe, 0xba, 0xba, 0xc2, 0xbe, 0xba, 0xb2, 0xb2, 0xb6, 0xb2, 0xb3, 0xd1, 0xeb, 0x00, 0x61, 0x5e, 0xd8, 0xd1, 0xbc, 0xb9, 0xb9, 0xb7, 0xba, 0xc4, 0xc6, 0xc9, 0xc7, 0xd2, 0xeb, 0x59, 0x4e, 0x55, 0x55, 0x03, 0x53, 0x55, 0x53, 0x53, 0x53, 0x51, 0x53, 0x50, 0x53, 0x53, 0x53, 0x55, 0x50, 0x53, 0x53, 0x53, 0x53, 0x55, 0x55, 0x54, 0x54, 0x56, 0x56, 0x56, 0x56, 0x56, 0x68, 0x0b, 0x10, 0x95, 0x22, 0x95, 0x88, 0x82, 0x6c, 0x6c, 0x72, 0x83, 0x33, 0x3d, 0x91, 0x5c, 0x65, 0x61, 0x62, 0x62, 0x08, 0x88, 0x1b, 0x98, 0x1e, 0x10, 0x64, 0x5c, 0xa0, 0x59, 0x0a, 0xea, 0xfd, 0xf4, 0xdf, 0xde, 0xf2, 0xdf, 0xef, 0xe2, 0xdf, 0xef, 0xe4, 0xed, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xdf, 0xe2, 0xe1, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe8, 0xdd, 0xcd, 0xb5, 0xc0, 0xd4, 0xe1, 0xe5, 0xdf, 0xf1, 0xfd, 0xfd, 0xe4, 0xe4, 0xe6, 0xe4, 0xe4, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xf1, 0xf2, 0xde, 0xed, 0xf6, 0xf4, 0xec, 0xf9, 0x80, 0x06, 0x09, 0x0a, 0x09, 0xd7, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x09, 0x67, 0x59, 0x01, 0x02, 0x02, 0x50, 0x01, 0x50, 0x53, 0x50, 0x53, 0x50, 0x53, 0x53, 0x50, 0x53, 0x50, 0x9e, 0xa5, 0xbb, 0xce, 0xce, 0xc9, 0xbc, 0xac, 0xa9, 0xad, 0xa9, 0xab, 0xb6, 0xc5, 0xc8, 0xc5, 0xc5, 0xc5, 0xbf, 0xbf, 0xc4, 0xbf, 0xbf, 0xbd, 0xbd, 0xbf, 0xc4, 0xc8, 0xbf, 0xbe, 0xbd, 0xba, 0xbd, 0xbd, 0xbd, 0xbe, 0xc4, 0xc4, 0xc6, 0xc4, 0xc8, 0xc4, 0xc4, 0xc5, 0xc2, 0xc4, 0xbc, 0xc7, 0xe5, 0xbb, 0x01, 0x5b, 0x02, 0xf8, 0xd6, 0xcb, 0xbc, 0xba, 0xbd, 0xbd, 0xba, 0xba, 0xb7, 0xb7, 0xb7, 0xb6, 0xb7, 0xbd, 0xbe, 0xbd, 0xba, 0xba, 0xbe, 0xbe, 0xba, 0xb6, 0xb2, 0xb2, 0xb6, 0xb3, 0xcf, 0xd2, 0x0a, 0x61, 0x5b, 0xbb, 0xd4, 0xc7, 0xbc, 0xc3, 0xc1, 0xbc, 0xc1, 0xc9, 0xcb, 0xd1, 0xd0, 0xa5, 0x03, 0x04, 0x03, 0x54, 0x03, 0x54, 0x53, 0x55, 0x53, 0x51, 0x53, 0x51, 0x53, 0x53, 0x03, 0x55, 0x57, 0x59, 0x53, 0x50, 0x53, 0x55, 0x04, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5c, 0x68, 0x0e, 0x15, 0x20, 0x98, 0x91, 0x7e, 0x73, 0x6c, 0x6c, 0x6c, 0x74, 0x98, 0x99, 0x98, 0x38, 0x91, 0x5c, 0x65, 0x62, 0x6a, 0x5d, 0x69, 0x15, 0x1d, 0x1a, 0x82, 0x68, 0x54, 0x61, 0x00, 0xbb, 0xdb, 0xf4, 0xf2, 0xde, 0xfd, 0xef, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xe3, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xe2, 0xdf, 0xe1, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe7, 0xdb, 0xaa, 0xa5, 0xa7, 0xaf, 0xd4, 0xe5, 0xe1, 0xe2, 0xfd, 0xf1, 0xef, 0xe3, 0xe4, 0xe4, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xf2, 0xf1, 0xe2, 0xfd, 0xe2, 0xf2, 0xf5, 0xf3, 0xdb, 0xfa, 0x80, 0x00, 0x06, 0x09, 0x0a, 0x0a, 0x0a, 0x00, 0x09, 0x09, 0x0a, 0x09, 0x07, 0x63, 0xa1, 0x01, 0x9e, 0x02, 0x53, 0x50, 0x50, 0x53, 0x50, 0x53, 0x53, 0x53, 0x03, 0x4e, 0x9e, 0xa2, 0xa5, 0xb0, 0xcb, 0xce, 0xce, 0xc9, 0xb1, 0xad, 0xb7, 0xc5, 0xc8, 0xc5, 0xc4, 0xc2, 0xbf, 0xc4, 0xbf, 0xbf, 0xbd, 0xbf, 0xbf, 0xc5, 0xc4, 0xc5, 0xbf, 0xba, 0xbd, 0xba, 0xbd, 0xba, 0xbd, 0xc2, 0xc4, 0xc6, 0xc4, 0xc8, 0xc8, 0xc6, 0xc4, 0xc4, 0xc4, 0xbe, 0xc2, 0xbc, 0xd1, 0xe0, 0x00, 0x03, 0x57, 0x5e, 0xd8, 0xd6, 0xd9, 0xb9, 0xba, 0xbd, 0xbd, 0xba, 0xba, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbe, 0xbe, 0xbd, 0xbd, 0xba, 0xbe, 0xc2, 0xba, 0xb3, 0xb2, 0xb6, 0xb2, 0xb1, 0xce, 0xd4, 0x0c, 0x5b, 0x5e, 0x09, 0xd6, 0xd2, 0xcf, 0xcb, 0xce, 0xd1, 0xcf, 0xcf, 0xd8, 0xb5, 0x5e, 0x9e, 0x58, 0x60, 0x03, 0x03, 0x03, 0x03, 0x53, 0x55, 0x53, 0x51, 0x53, 0x53, 0x55, 0x55, 0x04, 0x57, 0x04, 0x57, 0x50, 0x03, 0x54, 0x04, 0x56, 0x54, 0x54, 0x62, 0x64, 0x70, 0x0e, 0x95, 0x22, 0x1e, 0x13, 0x79, 0x6c, 0x74, 0x6c, 0x5f, 0x6c, 0x6f, 0x95, 0x9d, 0x83, 0x79, 0x9d, 0x15, 0x5c, 0x65, 0x66, 0x5d, 0x68, 0x76, 0x16, 0x88, 0x0e, 0x68, 0x4f, 0x5b, 0xf7, 0xd0, 0xde, 0xe9, 0xe2, 0xdd, 0xdf, 0xf2, 0xdf, 0xde, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xed, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xe2, 0xdf, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe5, 0xd2, 0xa7, 0xaf, 0xaa, 0xa7, 0xc0, 0xdc, 0xe8, 0xe2, 0xfd, 0xf2, 0xef, 0xe1, 0xe4, 0xe3, 0xe4, 0xe4, 0xe3, 0xe4, 0xef, 0xf1, 0xe3, 0xed, 0xf1, 0xf4, 0xe2, 0xfd, 0xf1, 0xf1, 0xf6, 0xf1, 0xdb, 0xfa, 0x80, 0x00, 0x00, 0x09, 0xd7, 0x0a, 0x09, 0x07, 0x00, 0x09, 0x0a, 0x0a, 0x0a, 0x09, 0x67, 0x50, 0x01, 0x50, 0x53, 0x50, 0x50, 0x50, 0x9f, 0x02, 0x03, 0x4e, 0x50, 0xa4, 0xa2, 0xa3, 0xa5, 0xaa, 0xc0, 0xcf, 0xd3, 0xce, 0xc9, 0xc2, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xc2, 0xbf, 0xbe, 0xbf, 0xc4, 0xc8, 0xc8, 0xc5, 0xbd, 0xbd, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xc4, 0xc8, 0xc4, 0xc8, 0xc6, 0xc8, 0xc6, 0xc4, 0xc2, 0xbe, 0xc2, 0xc1, 0xbc, 0xdc, 0xdb, 0x9f, 0x55, 0x03, 0x06, 0xd0, 0xd6, 0xc1, 0xb9, 0xba, 0xbd, 0xbd, 0xba, 0xb7, 0xba, 0xb6, 0xb7, 0xb6, 0xbd, 0xbe, 0xbd, 0xba, 0xbd, 0xbd, 0xbe, 0xbe, 0xb7, 0xb2, 0xb2, 0xb6, 0xb3, 0xb3, 0xcb, 0xdd, 0x80, 0x5a, 0x61, 0x5e, 0xd8, 0xdb, 0xd4, 0xd2, 0xcf, 0xc7, 0xb5, 0xaa, 0x5a, 0xa2, 0x58, 0x5b, 0x4f, 0x4e, 0x56, 0x03, 0x03, 0x55, 0x55, 0x53, 0x55, 0x53, 0x55, 0x51, 0x54, 0x55, 0x56, 0x04, 0x56, 0x03, 0x04, 0x5c, 0x04, 0x56, 0x56, 0x5d, 0x68, 0x7a, 0x15, 0x1e, 0x22, 0x1e, 0x82, 0x74, 0x70, 0x74, 0x82, 0x98, 0x83, 0x6c, 0x62, 0x74, 0x95, 0x85, 0x69, 0x74, 0x3d, 0x88, 0x64, 0x6a, 0x66, 0x5c, 0x6d, 0x08, 0x76, 0x66, 0x56, 0x4f, 0x71, 0xea, 0xfc, 0xe5, 0xe5, 0xdf, 0xde, 0xe2, 0xe4, 0xdf, 0xdd, 0xf3, 0xdf, 0xe2, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xe2, 0xdf, 0xe1, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xf4, 0xd2, 0xa7, 0xaf, 0xac, 0xa7, 0xa7, 0xd2, 0xe8, 0xed, 0xdf, 0xf2, 0xe3, 0xe1, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xef, 0xe2, 0xe2, 0xf2, 0xf2, 0xf1, 0xef, 0xf2, 0xf1, 0xe4, 0xf3, 0xe8, 0xfb, 0xfa, 0xd7, 0x00, 0x00, 0x0a, 0x0c, 0x0c, 0x09, 0x00, 0x06, 0xa0, 0x06, 0x67, 0x63, 0x59, 0x50, 0x4d, 0x01, 0x02, 0x50, 0x50, 0x59, 0x57, 0x03, 0x03, 0x53, 0x50, 0xa4, 0xa4, 0xa3, 0xa2, 0xa2, 0xa7, 0xb0, 0xce, 0xd3, 0xd3, 0xcb, 0xc1, 0xc1, 0xc6, 0xc1, 0xc2, 0xc2, 0xc4, 0xc8, 0xc8, 0xbf, 0xbf, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbe, 0xbe, 0xc4, 0xc4, 0xc4, 0xc6, 0xc8, 0xc6, 0xc8, 0xc2, 0xc4, 0xc2, 0xbe, 0xbe, 0xc6, 0xbc, 0xc9, 0xe8, 0xf8, 0x4d, 0x60, 0x4e, 0x00, 0xdb, 0xd3, 0xbc, 0xb9, 0xba, 0xbd, 0xbd, 0xba, 0xba, 0xb7, 0xba, 0xb6, 0xba, 0xbe, 0xbf, 0xbd, 0xba, 0xbd, 0xbd, 0xbf, 0xbe, 0xb7, 0xb3, 0xb7, 0xb6, 0xb7, 0xb4, 0xc7, 0xd6, 0xf8, 0x5b, 0x53, 0x5b, 0x5a, 0x0c, 0xd7, 0xa6, 0xa5, 0xa4, 0xa4, 0x9f, 0x5a, 0x58, 0x56, 0x60, 0x56, 0x03, 0x03, 0x04, 0x03, 0x55, 0x55, 0x57, 0x55, 0x51, 0x4e, 0x54, 0x54, 0x04, 0x56, 0x04, 0x56, 0x54, 0x56, 0x5c, 0x5c, 0x68, 0x7a, 0x88, 0x1d, 0x98, 0x1e, 0x13, 0x79, 0x74, 0x74, 0x81, 0x17, 0x99, 0x33, 0x9d, 0x73, 0x52, 0x5f, 0x73, 0x9b, 0x8e, 0x95, 0x99, 0x99, 0x85, 0x5c, 0x66, 0x6a, 0x66, 0x6b, 0x60, 0x4f, 0x4d, 0x71, 0x96, 0xff, 0xf5, 0xe0, 0xde, 0xe7, 0xe4, 0xe4, 0xe3, 0xe3, 0xe3, 0xde, 0xe6, 0xe1, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xfd, 0xed, 0xe3, 0xe1, 0xe1, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe8, 0xd3, 0xaf, 0xaf, 0xac, 0xac, 0xa7, 0xc7, 0xe1, 0xf2, 0xdf, 0xf1, 0xdf, 0xe5, 0xe5, 0xe3, 0xe3, 0xe3, 0xe4, 0xef, 0xe4, 0xef, 0xdf, 0xf2, 0xf1, 0xdf, 0xf1, 0xf2, 0xf2, 0xe2, 0xf2, 0xe6, 0xe3, 0xf2, 0xf5, 0xe8, 0xfc, 0xea, 0xd7, 0x5e, 0x00, 0x0c, 0x0c, 0x0a, 0x09, 0x63, 0x53, 0x9f, 0x4d, 0x9e, 0x9e, 0x53, 0x50, 0x50, 0x50, 0x53, 0x50, 0x53, 0x03, 0x57, 0x50, 0x9f, 0xa1, 0xa4, 0x9f, 0xa2, 0x9e, 0x9e, 0xa3, 0xa4, 0xa7, 0xc7, 0xd3, 0xd5, 0xce, 0xc3, 0xb8, 0xc1, 0xc9, 0xcc, 0xc6, 0xc2, 0xbe, 0xba, 0xba, 0xbd, 0xbe, 0xbe, 0xbd, 0xbe, 0xc4, 0xc8, 0xc8, 0xc8, 0xc4, 0xc4, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xb9, 0xd2, 0xe0, 0x06, 0x4e, 0x60, 0x4f, 0x09, 0xd4, 0xd3, 0xbc, 0xba, 0xbd, 0xbd, 0xbd, 0xba, 0xb6, 0xba, 0xba, 0xb7, 0xbd, 0xbe, 0xbe, 0xbd, 0xbd, 0xbd, 0xbf, 0xbf, 0xbf, 0xb9, 0xb3, 0xb7, 0xb2, 0xad, 0xb4, 0xd1, 0xe1, 0xf8, 0x5a, 0x58, 0x5e, 0x4f, 0x5b, 0x5a, 0xa4, 0xa1, 0xa4, 0xa1, 0x59, 0x4f, 0x4f, 0x4f, 0x56, 0x4e, 0x57, 0x61, 0x03, 0x04, 0x55, 0x55, 0x57, 0x51, 0x58, 0x5b, 0x58, 0x56, 0x56, 0x56, 0x56, 0x5c, 0x5d, 0x69, 0x0b, 0x88, 0x1a, 0x22, 0x22, 0x19, 0x10, 0x74, 0x72, 0x7d, 0x17, 0x27, 0x32, 0x2b, 0x1e, 0x8e, 0x8e, 0x5f, 0x52, 0x6c, 0x6d, 0x9b, 0x9d, 0x41, 0x95, 0x85, 0x70, 0x69, 0x6a, 0x6a, 0x60, 0x5b, 0x57, 0x67, 0xf8, 0xec, 0xf5, 0xde, 0xdd, 0xe9, 0xe4, 0xde, 0xdf, 0xdf, 0xdd, 0xdf, 0xe4, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xe2, 0xe1, 0xe1, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe3, 0xe7, 0xd5, 0xb0, 0xac, 0xac, 0xaf, 0xaa, 0xb0, 0xd6, 0xf2, 0xed, 0xe4, 0xe1, 0xe7, 0xe1, 0xe6, 0xe3, 0xe6, 0xe3, 0xe4, 0xe4, 0xef, 0xde, 0xf3, 0xe8, 0xf1, 0xee, 0xdf, 0xde, 0xe4, 0xe4, 0xe7, 0xe4, 0xe6, 0xf2, 0xf2, 0xe8, 0xf6, 0xf2, 0xda, 0x0c, 0xa0, 0x00, 0x0c, 0x0a, 0x5e, 0x9e, 0x9e, 0x4d, 0x5e, 0x63, 0x53, 0x53, 0x53, 0x01, 0x4d, 0x9e, 0x9e, 0xa1, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0x9f, 0x50, 0x02, 0x4d, 0x9e, 0xa2, 0x9e, 0xa3, 0xa5, 0xb5, 0xd1, 0xd6, 0xd5, 0xcb, 0xc1, 0xb9, 0xb9, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xb7, 0xc4, 0xc4, 0xc4, 0xc8, 0xc8, 0xc6, 0xc8, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xc6, 0xbc, 0xc9, 0xdc, 0xcd, 0x9f, 0x54, 0x5d, 0x54, 0x0a, 0xd4, 0xd1, 0xb9, 0xba, 0xbe, 0xbd, 0xbd, 0xba, 0xba, 0xb7, 0xba, 0xba, 0xbe, 0xbf, 0xbd, 0xba, 0xbd, 0xbe, 0xbf, 0xbf, 0xbd, 0xb7, 0xb3, 0xb1, 0xb1, 0xb7, 0xc9, 0xdc, 0xdb, 0x09, 0x4f, 0x5a, 0x5a, 0x60, 0x4f, 0x4e, 0x59, 0x59, 0x59, 0x57, 0x54, 0x04, 0x64, 0x56, 0x04, 0x61, 0x50, 0x01, 0x04, 0x03, 0x55, 0x57, 0x53, 0x57, 0x51, 0x54, 0x4f, 0x4f, 0x54, 0x5d, 0x66, 0x08, 0x88, 0x91, 0x98, 0x99, 0x98, 0x13, 0x79, 0x72, 0x74, 0x11, 0x1b, 0x27, 0x27, 0x27, 0x1e, 0x85, 0x08, 0x62, 0x70, 0x6f, 0x62, 0x5f, 0x74, 0x88, 0x83, 0x7e, 0x6c, 0x69, 0x69, 0x62, 0x6d, 0x5c, 0x4f, 0x5a, 0x12, 0xfc, 0xf6, 0xe6, 0xde, 0xdf, 0xf2, 0xde, 0xde, 0xed, 0xe8, 0xe8, 0xe8, 0xe7, 0xe3, 0xdd, 0xde, 0xdf, 0xe1, 0xe1, 0xe3, 0xdf, 0xe1, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xee, 0xe3, 0xdf, 0xe1, 0xe1, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe7, 0xdc, 0xb8, 0xaf, 0xb4, 0xb1, 0xac, 0xa7, 0xd2, 0xe8, 0xe4, 0xe4, 0xdf, 0xe5, 0xe1, 0xe4, 0xe4, 0xe3, 0xe4, 0xe4, 0xe4, 0xe6, 0xf3, 0xdf, 0xdf, 0xef, 0xf2, 0xf1, 0xf2, 0xe3, 0xe3, 0xe3, 0xf2, 0xe7, 0xef, 0xdf, 0xe6, 0xef, 0xf2, 0xf6, 0xf6, 0xdb, 0xf7, 0xa1, 0x02, 0x9e, 0x01, 0x59, 0x59, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0xa3, 0xb0, 0xcf, 0xd5, 0xd3, 0xce, 0xc1, 0xbc, 0xb9, 0xb9, 0xb9, 0xc2, 0xc6, 0xc4, 0xc6, 0xc8, 0xc6, 0xc4, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xc2, 0xbe, 0xc1, 0xbc, 0xd3, 0xe8, 0xaa, 0x4e, 0x5b, 0x5c, 0x55, 0x0a, 0xd6, 0xcf, 0xbc, 0xba, 0xba, 0xbd, 0xbd, 0xba, 0xb6, 0xba, 0xba, 0xbd, 0xbe, 0xbe, 0xba, 0xbd, 0xbe, 0xbe, 0xbf, 0xbd, 0xb6, 0xb4, 0xb1, 0xb1, 0xc1, 0xd1, 0xdc, 0xd2, 0x09, 0x51, 0x5a, 0x4f, 0x5e, 0x60, 0x54, 0x5b, 0x5b, 0x50, 0x59, 0x57, 0x5b, 0x54, 0x4f, 0x60, 0x55, 0x4e, 0x59, 0x5b, 0x03, 0x04, 0x04, 0x03, 0x56, 0x54, 0x56, 0x56, 0x56, 0x62, 0x08, 0x84, 0x1a, 0x9b, 0x2b, 0x99, 0x19, 0x7d, 0x72, 0x74, 0x7d, 0x17, 0x98, 0x33, 0x99, 0x98, 0x19, 0x0d, 0x68, 0x64, 0x5c, 0x66, 0x62, 0x64, 0x69, 0x08, 0x69, 0x0b, 0x62, 0x64, 0x69, 0x69, 0x62, 0x6a, 0x4f, 0x4f, 0xf7, 0xfb, 0xf6, 0xe5, 0xdd, 0xe1, 0xde, 0xdd, 0xf1, 0xf0, 0xf0, 0xf2, 0xed, 0xdd, 0xdd, 0xe2, 0xe3, 0xdf, 0xe8, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xef, 0xdf, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xdf, 0xdf, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe1, 0xe1, 0xe7, 0xe0, 0xc0, 0xaf, 0xb4, 0xb1, 0xb1, 0xa7, 0xc0, 0xe8, 0xe0, 0xe8, 0xe4, 0xe3, 0xe4, 0xe3, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe4, 0xe4, 0xe4, 0xe2, 0xe2, 0xef, 0xe4, 0xe3, 0xe4, 0xf2, 0xe4, 0xe2, 0xe6, 0xf3, 0xe6, 0xf3, 0xec, 0xf8, 0x50, 0x9e, 0x9e, 0x01, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0xa2, 0xa6, 0xca, 0xd4, 0xd5, 0xd3, 0xcf, 0xc7, 0xc3, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xbe, 0xbe, 0xbf, 0xbe, 0xbd, 0xbe, 0xc2, 0xbe, 0xc2, 0xc9, 0xc1, 0xcf, 0xe0, 0xcd, 0x9e, 0x51, 0x5b, 0x5b, 0x4e, 0x00, 0xd2, 0xd1, 0xc3, 0xb8, 0xbe, 0xbd, 0xba, 0xbf, 0xbd, 0xbd, 0xbf, 0xbd, 0xbe, 0xbd, 0xbe, 0xba, 0xba, 0xb9, 0xb7, 0xb7, 0xbc, 0xbc, 0xc7, 0xd3, 0xd6, 0xd6, 0xf9, 0x06, 0x9e, 0x54, 0x61, 0x58, 0x58, 0x58, 0x5b, 0x58, 0x57, 0x57, 0x57, 0x57, 0x5b, 0x57, 0x04, 0x57, 0x04, 0x04, 0x57, 0x03, 0x03, 0x03, 0x04, 0x56, 0x54, 0x64, 0x69, 0x0b, 0x88, 0x1a, 0x99, 0x99, 0x22, 0x13, 0x7d, 0x79, 0x79, 0x81, 0x17, 0x27, 0x99, 0x33, 0x22, 0x15, 0x0e, 0x08, 0x68, 0x64, 0x64, 0x66, 0x6a, 0x66, 0x62, 0x6a, 0x65, 0x62, 0x6a, 0x62, 0x6a, 0x6a, 0x65, 0x61, 0x61, 0x4d, 0xf7, 0xdb, 0xf3, 0xe6, 0xdf, 0xe2, 0xe4, 0xdf, 0xe3, 0xe2, 0xe2, 0xed, 0xed, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe3, 0xdf, 0xe3, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe1, 0xe7, 0xe0, 0xd9, 0xaf, 0xb4, 0xb4, 0xaf, 0xa8, 0xb5, 0xdc, 0xe7, 0xe3, 0xe4, 0xfd, 0xe6, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xe2, 0xef, 0xdf, 0xdf, 0xe2, 0xe6, 0xf2, 0xe6, 0xe6, 0xe2, 0xf2, 0xe6, 0xde, 0xe2, 0xf2, 0xe8, 0xf2, 0xfc, 0xd8, 0xa1, 0x9e, 0x9e, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x01, 0x01, 0x9f, 0x4d, 0xa2, 0x9e, 0x9e, 0x9e, 0xa2, 0xa3, 0xb0, 0xca, 0xd3, 0xd5, 0xd3, 0xcf, 0xcb, 0xc3, 0xc3, 0xc1, 0xbc, 0xba, 0xbc, 0xbe, 0xbe, 0xba, 0xc2, 0xc2, 0xc2, 0xb9, 0xc2, 0xc1, 0xce, 0xdc, 0xd4, 0xa6, 0x9f, 0x58, 0x4f, 0x51, 0x61, 0xa4, 0xcd, 0xdc, 0xc0, 0xc3, 0xbe, 0xb9, 0xba, 0xba, 0xbe, 0xba, 0xba, 0xbe, 0xb9, 0xbc, 0xb9, 0xc1, 0xc1, 0xc3, 0xc9, 0xcf, 0xd1, 0xd5, 0xd6, 0xd0, 0xbb, 0x63, 0x9e, 0x4d, 0x5b, 0x5b, 0x54, 0x4f, 0x61, 0x58, 0xa1, 0x58, 0x59, 0x5b, 0x57, 0x5b, 0x55, 0x04, 0x04, 0x04, 0x04, 0x04, 0x54, 0x04, 0x5d, 0x56, 0x5d, 0x08, 0x0b, 0x88, 0x19, 0x99, 0x27, 0x1e, 0x17, 0x81, 0x7d, 0x79, 0x11, 0x17, 0x20, 0x2b, 0x2b, 0x22, 0x91, 0x82, 0x70, 0x70, 0x62, 0x64, 0x64, 0x68, 0x6a, 0x6a, 0x66, 0x60, 0x65, 0x6a, 0x6a, 0x65, 0x61, 0x65, 0x67, 0x5b, 0x55, 0x67, 0x0a, 0xdb, 0xde, 0xe9, 0xf6, 0xf2, 0xde, 0xde, 0xed, 0xe2, 0xed, 0xe2, 0xdf, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe3, 0xdf, 0xdf, 0xe4, 0xdf, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe7, 0xe0, 0xcf, 0xac, 0xb4, 0xb1, 0xb1, 0xac, 0xaa, 0xd2, 0xe9, 0xe1, 0xdf, 0xe2, 0xe4, 0xef, 0xef, 0xef, 0xe2, 0xe3, 0xe2, 0xe4, 0xf2, 0xe4, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe8, 0xf5, 0xf6, 0xde, 0xec, 0xd8, 0x06, 0x9e, 0x9e, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x01, 0x01, 0x9f, 0x01, 0x9f, 0x9f, 0x02, 0x02, 0x02, 0x01, 0x9f, 0xa2, 0xa2, 0x9e, 0xa2, 0xa2, 0xa5, 0xb0, 0xca, 0xd2, 0xd4, 0xd3, 0xd1, 0xd1, 0xce, 0xc9, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc9, 0xce, 0xd1, 0xd6, 0xd6, 0xf7, 0xa4, 0x5a, 0x4f, 0x66, 0x58, 0x54, 0x9f, 0xd7, 0xd6, 0xd6, 0xca, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc9, 0xd9, 0xce, 0xd1, 0xd3, 0xd3, 0xd4, 0xd2, 0xcd, 0xbb, 0x00, 0xa1, 0x4d, 0x4e, 0x5b, 0x5b, 0x60, 0x61, 0x58, 0x58, 0x51, 0x5a, 0xa1, 0xa1, 0x57, 0x55, 0x56, 0x04, 0x5d, 0x5c, 0x04, 0x56, 0x54, 0x5c, 0x5c, 0x68, 0x70, 0x0e, 0x15, 0x22, 0x99, 0x98, 0x20, 0x13, 0x0f, 0x7d, 0x0f, 0x11, 0x1b, 0x25, 0x32, 0x2b, 0x99, 0x19, 0x85, 0x79, 0x08, 0x68, 0x68, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x65, 0x6b, 0x6a, 0x65, 0x6a, 0x6b, 0x6a, 0x65, 0x65, 0x5b, 0xa0, 0x80, 0x2c, 0xf3, 0xf2, 0xef, 0xed, 0xde, 0xdf, 0xed, 0xef, 0xe2, 0xed, 0xdf, 0xed, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe0, 0xd3, 0xaf, 0xb4, 0xb4, 0xb4, 0xaf, 0xa7, 0xcd, 0xe8, 0xe3, 0xe1, 0xef, 0xe4, 0xef, 0xe3, 0xe3, 0xe3, 0xe2, 0xe3, 0xe3, 0xe3, 0xe4, 0xe4, 0xe3, 0xe2, 0xe1, 0xe2, 0xe3, 0xf2, 0xf2, 0xde, 0xfb, 0xd8, 0x06, 0x9e, 0x9e, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x01, 0x01, 0x9f, 0x9f, 0x9f, 0x01, 0x4d, 0x01, 0x4d, 0x4d, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa6, 0xaa, 0xc0, 0xcd, 0xd2, 0xd5, 0xd5, 0xd5, 0xd3, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd5, 0xd5, 0xdc, 0xd4, 0xf7, 0xa4, 0x59, 0x4e, 0x5b, 0x54, 0x04, 0x58, 0x5b, 0xa2, 0x80, 0xd2, 0xd6, 0xd6, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xeb, 0xcd, 0xf8, 0xb0, 0x07, 0xa1, 0x4d, 0x50, 0x57, 0x5a, 0x60, 0x58, 0x58, 0x4f, 0x51, 0x58, 0x5b, 0x5a, 0x58, 0x59, 0x5b, 0x5b, 0x58, 0x04, 0x54, 0x56, 0x56, 0x5c, 0x64, 0x08, 0x7a, 0x85, 0x18, 0x22, 0x1e, 0x19, 0x91, 0x11, 0x81, 0x7d, 0x11, 0x14, 0x1b, 0x25, 0x2a, 0x25, 0x27, 0x15, 0x85, 0x0d, 0x70, 0x68, 0x68, 0x64, 0x69, 0x64, 0x68, 0x66, 0x6a, 0x66, 0x66, 0x05, 0x05, 0x65, 0x6b, 0x6b, 0x6b, 0x65, 0x61, 0x5a, 0x67, 0xf7, 0x2c, 0xdd, 0xf5, 0xfe, 0xf2, 0xef, 0xdf, 0xed, 0xdf, 0xed, 0xde, 0xed, 0xe2, 0xed, 0xe2, 0xdf, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xee, 0xef, 0xe1, 0xe0, 0xd6, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xaa, 0xc0, 0xe7, 0xe7, 0xdf, 0xe6, 0xef, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe4, 0xe3, 0xe3, 0xe1, 0xe3, 0xe4, 0xe6, 0xe9, 0xdf, 0xeb, 0xbb, 0xa6, 0x9e, 0x9e, 0xa2, 0x4d, 0xa2, 0x4d, 0x9f, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x01, 0x4d, 0x01, 0x01, 0x9f, 0x01, 0x9f, 0x9f, 0x9f, 0x9f, 0x4d, 0x9f, 0x01, 0xa2, 0x01, 0x01, 0x4d, 0x4d, 0x4d, 0x01, 0x4d, 0x01, 0x4d, 0x01, 0x02, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa4, 0xa6, 0xb0, 0xf8, 0xca, 0xd0, 0xd2, 0xd2, 0xd2, 0xd4, 0xd4, 0xd2, 0xd0, 0xd8, 0x09, 0x9f, 0x50, 0x4e, 0x57, 0x66, 0x54, 0x04, 0x57, 0x57, 0x5e, 0x50, 0x5e, 0x12, 0xca, 0xcd, 0xd0, 0xd0, 0xd0, 0xcd, 0xd8, 0xd8, 0xbb, 0xf7, 0x09, 0x06, 0x5e, 0x50, 0x03, 0x03, 0x03, 0x05, 0x05, 0x57, 0x4f, 0x58, 0x4f, 0x5a, 0x61, 0x58, 0x5a, 0x5a, 0x58, 0x04, 0x5d, 0x54, 0x54, 0x54, 0x54, 0x5c, 0x62, 0x70, 0x0e, 0x18, 0x1a, 0x1e, 0x1e, 0x19, 0x87, 0x81, 0x7d, 0x79, 0x11, 0x17, 0x20, 0x20, 0x2a, 0x27, 0x1b, 0x18, 0x11, 0x0d, 0x08, 0x68, 0x64, 0x64, 0x64, 0x68, 0x68, 0x66, 0x66, 0x60, 0x60, 0x05, 0x66, 0x6b, 0x6b, 0x6b, 0x06, 0x65, 0x61, 0x58, 0x5e, 0x07, 0xf8, 0xeb, 0xff, 0xf5, 0xfe, 0xfd, 0xde, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xed, 0xe2, 0xed, 0xdf, 0xed, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xe3, 0xe2, 0xe2, 0xdf, 0xe2, 0xee, 0xef, 0xee, 0xe2, 0xee, 0xef, 0xed, 0xe3, 0xe0, 0xdc, 0xc3, 0xaf, 0xb8, 0xb4, 0xaf, 0xaf, 0xaa, 0xdc, 0xe8, 0xe1, 0xe4, 0xef, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe4, 0xe6, 0xdf, 0xe1, 0xf2, 0xe9, 0xe6, 0xe1, 0xea, 0xf7, 0xa5, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x01, 0x9e, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x4d, 0x01, 0x02, 0x9f, 0x50, 0x50, 0x01, 0x9f, 0x01, 0x9f, 0x02, 0x02, 0x9f, 0x01, 0x01, 0x4d, 0x01, 0x02, 0x01, 0x9f, 0x02, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x01, 0x4d, 0x9e, 0x01, 0x01, 0x9e, 0x4d, 0x01, 0x02, 0x4d, 0x9e, 0x9e, 0xa2, 0xa1, 0xa5, 0xa6, 0x00, 0xd7, 0xd7, 0xd7, 0x00, 0xa5, 0x9f, 0x9e, 0x61, 0x57, 0x03, 0x61, 0x01, 0x5b, 0x04, 0x5b, 0x5b, 0x5b, 0x57, 0x53, 0x50, 0x5a, 0x5a, 0x5e, 0x5a, 0x5e, 0x5e, 0x5e, 0xa4, 0x53, 0x50, 0x50, 0x03, 0x04, 0x04, 0x5b, 0x04, 0x03, 0x03, 0x57, 0x5b, 0x5a, 0x5a, 0x5a, 0x51, 0x51, 0x58, 0x58, 0x58, 0x04, 0x54, 0x56, 0x56, 0x64, 0x08, 0x0e, 0x85, 0x1a, 0x22, 0x98, 0x1a, 0x17, 0x82, 0x79, 0x79, 0x81, 0x11, 0x1b, 0x97, 0x2b, 0x2a, 0x99, 0x1e, 0x15, 0x0e, 0x0b, 0x70, 0x68, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x60, 0x66, 0x66, 0x6b, 0x6b, 0x6b, 0x05, 0x61, 0x67, 0x5e, 0x57, 0x5e, 0x09, 0xfa, 0xfb, 0xfd, 0xfe, 0xf3, 0xfd, 0xe2, 0xe2, 0xf1, 0xed, 0xe2, 0xef, 0xe2, 0xed, 0xdf, 0xe2, 0xe2, 0xed, 0xe2, 0xed, 0xdf, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xe3, 0xe5, 0xe5, 0xca, 0xaf, 0xbc, 0xb4, 0xaf, 0xb4, 0xa7, 0xd5, 0xe9, 0xde, 0xe6, 0xe2, 0xe3, 0xe4, 0xe3, 0xe4, 0xe4, 0xe2, 0xe4, 0xdf, 0xdf, 0xe8, 0xf5, 0xdd, 0xd8, 0x00, 0xa4, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x9f, 0x02, 0x02, 0x02, 0x9f, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x4d, 0x02, 0x50, 0x01, 0x4d, 0x03, 0x01, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x4f, 0x4e, 0x4e, 0x4e, 0x4e, 0x9f, 0x4d, 0xa2, 0x4d, 0x9e, 0x4d, 0x50, 0x50, 0x55, 0x5b, 0x51, 0x57, 0x61, 0x55, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x54, 0x61, 0x54, 0x4f, 0x58, 0x5a, 0x51, 0x59, 0x5a, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x04, 0x5e, 0x5b, 0x5e, 0x57, 0x5a, 0x59, 0x58, 0x58, 0x58, 0x58, 0x56, 0x54, 0x4f, 0x04, 0x5c, 0x70, 0x0e, 0x8e, 0x1e, 0x22, 0x1e, 0x19, 0x11, 0x0f, 0x79, 0x74, 0x7d, 0x17, 0x1b, 0x20, 0x2a, 0x32, 0x2b, 0x27, 0x15, 0x82, 0x0b, 0x68, 0x62, 0x62, 0x5c, 0x5c, 0x65, 0x60, 0x60, 0x66, 0x65, 0x66, 0x65, 0x66, 0x6a, 0x67, 0x05, 0x61, 0x05, 0x67, 0x67, 0x63, 0x53, 0x5e, 0x80, 0xea, 0xfc, 0xfe, 0xf3, 0xe6, 0xf2, 0xe2, 0xed, 0xef, 0xf1, 0xed, 0xe2, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xf1, 0xed, 0xf2, 0xf3, 0xde, 0xee, 0xe3, 0xe0, 0xe7, 0xd2, 0xaf, 0xb8, 0xb8, 0xb1, 0xaf, 0xaa, 0xcf, 0xf5, 0xe5, 0xf1, 0xe2, 0xdf, 0xdd, 0xf2, 0xdf, 0xde, 0xf6, 0xdd, 0xf5, 0xf5, 0xec, 0xf8, 0xa6, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x01, 0x02, 0x02, 0x02, 0x02, 0x50, 0x50, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x4d, 0x02, 0x01, 0x4e, 0x02, 0x02, 0x02, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x4d, 0x9f, 0x50, 0x50, 0x50, 0x53, 0x53, 0x53, 0x03, 0x53, 0x57, 0x55, 0x55, 0x54, 0x54, 0x54, 0x55, 0x57, 0x57, 0x53, 0x57, 0x55, 0x57, 0x03, 0x55, 0x55, 0x57, 0x54, 0x58, 0x54, 0x55, 0x58, 0x57, 0x5a, 0x59, 0x58, 0x59, 0x58, 0x58, 0x58, 0x5b, 0x56, 0x60, 0x60, 0x5b, 0x5b, 0x58, 0x5b, 0x5e, 0x57, 0x53, 0x59, 0x5a, 0x5e, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x56, 0x58, 0x56, 0x4f, 0x56, 0x64, 0x68, 0x0b, 0x85, 0x19, 0x98, 0x99, 0x27, 0x15, 0x81, 0x79, 0x74, 0x79, 0x81, 0x13, 0x1b, 0x27, 0x32, 0x38, 0x33, 0x1e, 0x13, 0x0d, 0x70, 0x68, 0x64, 0x5c, 0x64, 0x65, 0x65, 0x5a, 0x5a, 0xa0, 0x58, 0x65, 0x66, 0x6b, 0x65, 0x05, 0x05, 0x6b, 0x67, 0x05, 0x67, 0x60, 0x03, 0x4f, 0x67, 0xbb, 0xdb, 0xde, 0xf2, 0xf3, 0xe6, 0xde, 0xfd, 0xe2, 0xe2, 0xef, 0xed, 0xe3, 0xed, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xed, 0xe2, 0xed, 0xed, 0xdf, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xdf, 0xf1, 0xde, 0xde, 0xdd, 0xde, 0xf3, 0xe3, 0xdf, 0xe7, 0xd5, 0xb5, 0xb4, 0xb8, 0xb4, 0xaf, 0xac, 0xc7, 0xe9, 0xe1, 0xee, 0xdf, 0xf5, 0xf2, 0xe2, 0xf2, 0xdd, 0xdf, 0xf6, 0xde, 0xf9, 0xa5, 0x9e, 0x9e, 0x01, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x01, 0x02, 0x02, 0x50, 0x50, 0x50, 0x02, 0x50, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x4e, 0x02, 0x02, 0x4e, 0x01, 0x4d, 0x01, 0x9e, 0x4d, 0x9e, 0x4d, 0x4d, 0x01, 0x4e, 0x9f, 0x9f, 0x9f, 0x9f, 0x50, 0x51, 0x53, 0x53, 0x51, 0x55, 0x53, 0x55, 0x55, 0x57, 0x55, 0x04, 0x54, 0x04, 0x55, 0x04, 0x55, 0x04, 0x03, 0x57, 0x03, 0x57, 0x55, 0x04, 0x55, 0x58, 0x54, 0x54, 0x58, 0x51, 0x5a, 0x51, 0x5a, 0xa1, 0x5a, 0x5a, 0x5b, 0x58, 0x5b, 0x5b, 0x4f, 0x54, 0x04, 0x5b, 0x5b, 0x5a, 0x5b, 0x5e, 0x63, 0x5a, 0x5a, 0x5a, 0x5a, 0x51, 0x54, 0x57, 0x60, 0x60, 0x5c, 0x5c, 0x56, 0x56, 0x52, 0x08, 0x0e, 0x88, 0x1e, 0x99, 0x27, 0x32, 0x8f, 0x7d, 0x72, 0x72, 0x74, 0x7d, 0x13, 0x1e, 0x99, 0x38, 0x38, 0x32, 0x20, 0x13, 0x0b, 0x0b, 0x68, 0x64, 0x5d, 0x5d, 0x5d, 0x64, 0x56, 0x51, 0x5c, 0xa6, 0x6a, 0xa6, 0x6b, 0x6b, 0x61, 0x5b, 0x5b, 0x61, 0x6b, 0x05, 0x05, 0x6b, 0x61, 0x57, 0x07, 0xfa, 0xec, 0xf5, 0xf6, 0xe9, 0xfd, 0xe6, 0xe4, 0xdf, 0xe2, 0xe3, 0xed, 0xe3, 0xed, 0xed, 0xed, 0xed, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe4, 0xe6, 0xde, 0xe3, 0xf2, 0xe9, 0xe8, 0xdd, 0xdf, 0xe3, 0xe7, 0xdc, 0xca, 0xb5, 0xb8, 0xb8, 0xb1, 0xac, 0xb5, 0xe7, 0xe1, 0xf0, 0xfd, 0xde, 0xfd, 0xde, 0xde, 0xf6, 0xf6, 0xda, 0x00, 0x9e, 0x9e, 0x9e, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x50, 0x02, 0x02, 0x02, 0x50, 0x02, 0x50, 0x53, 0x50, 0x50, 0x02, 0x02, 0x02, 0x9f, 0x02, 0x02, 0x02, 0x4d, 0x4d, 0x9e, 0x9e, 0x4d, 0x4d, 0x4d, 0x01, 0x4e, 0x50, 0x53, 0x53, 0x9f, 0x51, 0x50, 0xa1, 0x50, 0x51, 0x50, 0x51, 0x51, 0x53, 0x51, 0x57, 0x51, 0x58, 0x55, 0x55, 0x55, 0x57, 0x55, 0x57, 0x03, 0x57, 0x03, 0x04, 0x55, 0x55, 0x55, 0x57, 0x54, 0x58, 0x58, 0x51, 0x58, 0x5a, 0xa1, 0xa1, 0x5a, 0x51, 0x5a, 0x58, 0x5a, 0x5b, 0x58, 0x60, 0x5b, 0x5b, 0x60, 0x61, 0x61, 0x5b, 0x58, 0x57, 0x5a, 0x58, 0x58, 0x58, 0x58, 0x5c, 0x5c, 0x52, 0x52, 0x52, 0x62, 0x72, 0x7e, 0x91, 0x98, 0x2b, 0x2b, 0x1b, 0x17, 0x7d, 0x72, 0x08, 0x79, 0x7d, 0x17, 0x2a, 0x32, 0x38, 0x33, 0x27, 0x1a, 0x82, 0x70, 0x64, 0x04, 0x03, 0x02, 0x03, 0x03, 0x04, 0x04, 0x5d, 0x04, 0x64, 0x66, 0x66, 0x60, 0x5d, 0x54, 0x60, 0x61, 0x6a, 0x06, 0x6b, 0x67, 0x61, 0x61, 0x57, 0x55, 0x0c, 0xeb, 0x4c, 0xf5, 0x4c, 0xe6, 0xdf, 0xdd, 0xde, 0xf2, 0xf2, 0xe4, 0xed, 0xe3, 0xed, 0xe3, 0xed, 0xe3, 0xe3, 0xed, 0xe2, 0xed, 0xed, 0xed, 0xed, 0xdf, 0xed, 0xe2, 0xed, 0xed, 0xdf, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe3, 0xdf, 0xe3, 0xe3, 0xde, 0xe3, 0xdd, 0xdd, 0xe6, 0xe1, 0xdf, 0xe3, 0xe3, 0xe7, 0xd0, 0xaf, 0xb8, 0xbc, 0xb4, 0xaf, 0xac, 0xe0, 0xe7, 0xee, 0xf3, 0xee, 0xde, 0xf4, 0xf3, 0xdf, 0xf9, 0x01, 0x9e, 0x9e, 0x01, 0x02, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9f, 0x9f, 0x02, 0x50, 0x50, 0x50, 0x50, 0x50, 0x02, 0x02, 0x50, 0x02, 0x02, 0x02, 0x02, 0x53, 0x50, 0x02, 0x02, 0x02, 0x01, 0x02, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9e, 0x4e, 0x50, 0x50, 0x50, 0x50, 0x53, 0x53, 0x53, 0x53, 0xa1, 0x51, 0x53, 0x53, 0x53, 0x51, 0x51, 0x53, 0x51, 0x58, 0x51, 0x58, 0x53, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x55, 0x58, 0x58, 0x5a, 0x51, 0x5a, 0x5a, 0xa1, 0x5a, 0x5a, 0x58, 0x5b, 0x58, 0x5b, 0x5b, 0x5b, 0x55, 0x55, 0x58, 0x5b, 0x5b, 0x5b, 0x65, 0x60, 0x60, 0x56, 0x56, 0x5c, 0x5c, 0x62, 0x69, 0x78, 0x82, 0x8e, 0x1e, 0x99, 0x98, 0x91, 0x11, 0x81, 0x79, 0x74, 0x79, 0x7d, 0x13, 0x99, 0x38, 0x33, 0x98, 0x1d, 0x13, 0x10, 0x70, 0x64, 0x04, 0x5d, 0x04, 0x54, 0x53, 0x03, 0x53, 0x03, 0x03, 0x04, 0x04, 0x60, 0x60, 0x60, 0x64, 0x64, 0x66, 0x68, 0x05, 0x65, 0x63, 0x5b, 0x5b, 0x61, 0x6b, 0x09, 0xf9, 0xec, 0xf6, 0xf6, 0x4c, 0xfd, 0xde, 0xde, 0xe1, 0xf2, 0xe8, 0xe3, 0xdf, 0xed, 0xe3, 0xed, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xee, 0xe2, 0xed, 0xe2, 0xdf, 0xe3, 0xe1, 0xe1, 0xe1, 0xe5, 0xe1, 0xe0, 0xe8, 0xe0, 0xdf, 0xe2, 0xdf, 0xe8, 0xd4, 0xc0, 0xb4, 0xb8, 0xb4, 0xb4, 0xac, 0xd4, 0xe8, 0xfd, 0xee, 0xfd, 0xfe, 0xf3, 0xfc, 0x12, 0x9e, 0x9e, 0x02, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x4d, 0x4d, 0xa2, 0x9f, 0x9f, 0x02, 0x02, 0x50, 0x9f, 0x02, 0x50, 0x02, 0x02, 0x50, 0x02, 0x02, 0x02, 0x50, 0x02, 0x02, 0x50, 0x02, 0x02, 0x01, 0x01, 0x01, 0x4e, 0x9e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4e, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x57, 0x55, 0x57, 0x53, 0x53, 0x53, 0x53, 0x53, 0x55, 0x51, 0x53, 0x5a, 0x53, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x5a, 0x58, 0x5a, 0x58, 0x57, 0x5a, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5d, 0x5b, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x62, 0x68, 0x70, 0x78, 0x88, 0x91, 0x22, 0x98, 0x1e, 0x91, 0x87, 0x7d, 0x79, 0x74, 0x79, 0x82, 0x13, 0x1e, 0x33, 0x33, 0x22, 0x16, 0x0e, 0x70, 0x68, 0x5c, 0x4f, 0x4e, 0x4f, 0x03, 0x56, 0x03, 0x4e, 0x9e, 0xa2, 0xa2, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x04, 0x66, 0x6b, 0x64, 0x60, 0x60, 0x5e, 0x05, 0x67, 0x0a, 0xf8, 0xea, 0xfc, 0xfe, 0xf4, 0xde, 0xfc, 0xde, 0xe4, 0xe6, 0xe6, 0xe3, 0xe4, 0xe3, 0xde, 0xed, 0xf2, 0xed, 0xe3, 0xe2, 0xe2, 0xe3, 0xe2, 0xe1, 0xef, 0xdf, 0xed, 0xe2, 0xed, 0xed, 0xdf, 0xed, 0xe2, 0xed, 0xed, 0xdf, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xe2, 0xe3, 0xe3, 0xde, 0xe0, 0xe5, 0xdd, 0xd0, 0xd0, 0xd4, 0xe1, 0xe2, 0xed, 0xdf, 0xe7, 0xdc, 0xd9, 0xb8, 0xb4, 0xb4, 0xb8, 0xac, 0xd0, 0xe8, 0xee, 0xee, 0xfe, 0xf5, 0xfb, 0xd7, 0x9e, 0x9e, 0x50, 0x9e, 0x4d, 0x9e, 0x9e, 0x4d, 0x01, 0x01, 0x4d, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x50, 0x9f, 0x50, 0x02, 0x50, 0x02, 0x02, 0x02, 0x02, 0x4e, 0x02, 0x4e, 0x02, 0x4e, 0x50, 0x02, 0x4e, 0x01, 0x4e, 0x01, 0x01, 0x01, 0x01, 0x4d, 0x4d, 0x01, 0x4e, 0x50, 0x53, 0x53, 0x57, 0x53, 0x53, 0x53, 0x53, 0x53, 0x57, 0x57, 0x03, 0x57, 0x03, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57, 0x53, 0x58, 0x53, 0x58, 0x59, 0x57, 0x5a, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x5b, 0x57, 0x58, 0x5b, 0x57, 0x58, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x58, 0x5a, 0x5b, 0x58, 0x54, 0x56, 0x5c, 0x5d, 0x64, 0x08, 0x0b, 0x82, 0x15, 0x1e, 0x98, 0x95, 0x91, 0x88, 0x7e, 0x79, 0x72, 0x70, 0x0d, 0x82, 0x15, 0x1a, 0x22, 0x22, 0x1d, 0x85, 0x7a, 0x08, 0x64, 0x5d, 0x56, 0x4d, 0x4e, 0x4e, 0x4e, 0x01, 0x02, 0x01, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x02, 0x57, 0x5b, 0x6b, 0x0a, 0x12, 0x12, 0xf9, 0xda, 0xff, 0xf5, 0xf5, 0xee, 0xdf, 0xed, 0xde, 0xdf, 0xe3, 0xdf, 0xde, 0xe1, 0xde, 0xdd, 0xe3, 0xe4, 0xe4, 0xed, 0xe3, 0xe2, 0xe3, 0xe2, 0xe1, 0xdf, 0xe2, 0xe2, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xee, 0xe2, 0xe2, 0xe2, 0xdf, 0xe3, 0xe1, 0xe1, 0xe1, 0xd2, 0xc0, 0xbb, 0xc7, 0xdb, 0xe8, 0xdf, 0xed, 0xe0, 0xe8, 0xd2, 0xb8, 0xb8, 0xb3, 0xbc, 0xaf, 0xca, 0xf6, 0xf3, 0x4c, 0xff, 0xff, 0xf9, 0x03, 0x01, 0x01, 0x4d, 0x4d, 0x9e, 0x4d, 0x01, 0x9e, 0x4d, 0x02, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x02, 0x50, 0x50, 0x50, 0x9f, 0x02, 0x50, 0x02, 0x50, 0x02, 0x50, 0x4e, 0x50, 0x4e, 0x02, 0x4e, 0x02, 0x02, 0x01, 0x01, 0x4d, 0x4e, 0x01, 0x4e, 0x4e, 0x50, 0x4f, 0x53, 0x53, 0x53, 0x57, 0x53, 0x57, 0x53, 0x53, 0x55, 0x53, 0x55, 0x55, 0x03, 0x04, 0x03, 0x04, 0x03, 0x57, 0x55, 0x57, 0x55, 0x57, 0x53, 0x5a, 0x53, 0x58, 0x59, 0x57, 0x5a, 0x57, 0x57, 0x57, 0x57, 0x04, 0x57, 0x04, 0x57, 0x58, 0x57, 0x58, 0x57, 0x57, 0x04, 0x57, 0x04, 0x5b, 0x04, 0x5b, 0x56, 0x5b, 0x04, 0x5b, 0x04, 0x5b, 0x5b, 0x54, 0x56, 0x56, 0x52, 0x5c, 0x68, 0x76, 0x0e, 0x88, 0x15, 0x1e, 0x98, 0x1b, 0x19, 0x87, 0x0d, 0x74, 0x08, 0x74, 0x0d, 0x13, 0x18, 0x1a, 0x1a, 0x16, 0x84, 0x7a, 0x71, 0x64, 0x57, 0x03, 0x02, 0x4d, 0x4d, 0x4e, 0x4e, 0x01, 0x02, 0x9f, 0x9f, 0xa3, 0xa2, 0xa3, 0xa2, 0xa2, 0x9e, 0xa2, 0x9e, 0xa2, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x5a, 0x00, 0x80, 0xf9, 0xea, 0xdb, 0xdb, 0xfb, 0xfc, 0xde, 0xed, 0xed, 0xe4, 0xe7, 0xe8, 0xe7, 0xe7, 0xe6, 0xe8, 0xe6, 0xe3, 0xe3, 0xe3, 0xdf, 0xe3, 0xe2, 0xe2, 0xdf, 0xef, 0xfd, 0xe1, 0xfd, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xdf, 0xe2, 0xed, 0xe2, 0xed, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xee, 0xed, 0xe3, 0xe4, 0xdc, 0xea, 0xc7, 0xc3, 0xca, 0xb8, 0xd4, 0xf5, 0xe1, 0xed, 0xe7, 0xd6, 0xc3, 0xb4, 0xb4, 0xbc, 0xac, 0xca, 0xfd, 0x44, 0x29, 0x92, 0x16, 0x84, 0x0b, 0x0e, 0x7a, 0x9e, 0x4e, 0x9e, 0xa2, 0xa2, 0x9e, 0x02, 0x01, 0x02, 0x4e, 0x02, 0x4e, 0x02, 0x4e, 0x50, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x4e, 0x02, 0x03, 0x02, 0x03, 0x02, 0x4e, 0x4e, 0x01, 0x4e, 0x4e, 0x4e, 0x50, 0x4e, 0x50, 0x53, 0x53, 0x53, 0x53, 0x55, 0x53, 0x55, 0x57, 0x55, 0x57, 0x03, 0x03, 0x03, 0x03, 0x03, 0x54, 0x54, 0x54, 0x55, 0x57, 0x57, 0x57, 0x57, 0x57, 0x53, 0x51, 0xa1, 0x53, 0xa1, 0x57, 0x57, 0x55, 0x55, 0x57, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x5b, 0x59, 0xa1, 0x5a, 0x55, 0x58, 0x58, 0x60, 0x56, 0x5d, 0x5c, 0x5d, 0x56, 0x04, 0x56, 0x5c, 0x62, 0x70, 0x0d, 0x85, 0x91, 0x1a, 0x98, 0x98, 0x19, 0x13, 0x82, 0x7d, 0x70, 0x72, 0x74, 0x7e, 0x15, 0x1a, 0x1a, 0x16, 0x85, 0x76, 0x6d, 0x66, 0x60, 0x54, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x01, 0x4d, 0x01, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x4d, 0x9e, 0x4d, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0x9e, 0x9e, 0x4d, 0x53, 0x67, 0x00, 0x09, 0xd7, 0xf7, 0x12, 0xf8, 0xd8, 0xcd, 0xda, 0xdb, 0xfb, 0xec, 0xde, 0xe2, 0xef, 0xef, 0xf3, 0xe9, 0xf1, 0xf2, 0xe9, 0xf3, 0xe6, 0xe6, 0xe6, 0xe2, 0xdf, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xef, 0xdf, 0xfd, 0xe2, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xed, 0xe3, 0xed, 0xed, 0xdf, 0xdf, 0xdf, 0xfd, 0xe2, 0xef, 0xe3, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xdf, 0xed, 0xf2, 0xe2, 0xdf, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xee, 0xee, 0xed, 0xed, 0xe3, 0xe0, 0xd1, 0xc7, 0xc7, 0xcb, 0xc3, 0xc0, 0xd6, 0xe5, 0xe3, 0xf2, 0xe7, 0xcf, 0xaf, 0xb4, 0xc1, 0xaf, 0xd7, 0x89, 0x76, 0x0b, 0x72, 0x0d, 0x11, 0x0f, 0x1a, 0x22, 0x7a, 0x4d, 0x9e, 0xa4, 0xa2, 0xa4, 0x53, 0x01, 0x4e, 0x50, 0x4e, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x01, 0x02, 0x02, 0x02, 0x4e, 0x02, 0x4e, 0x4e, 0x02, 0x4e, 0x4e, 0x4e, 0x53, 0x53, 0x53, 0x57, 0x51, 0x51, 0x55, 0x51, 0x57, 0x55, 0x55, 0x55, 0x55, 0x03, 0x55, 0x04, 0x03, 0x04, 0x55, 0x58, 0x58, 0x58, 0x57, 0x58, 0x53, 0x58, 0x53, 0xa1, 0x51, 0xa1, 0x53, 0xa1, 0x51, 0x57, 0x55, 0x04, 0x5b, 0x04, 0x57, 0x03, 0x56, 0x04, 0x5d, 0x04, 0x5c, 0x04, 0x56, 0x54, 0x51, 0x5a, 0x5a, 0x5b, 0x58, 0x56, 0x56, 0x56, 0x56, 0x5c, 0x5c, 0x64, 0x08, 0x70, 0x85, 0x13, 0x95, 0x98, 0x98, 0x20, 0x1b, 0x87, 0x81, 0x74, 0x74, 0x70, 0x72, 0x7e, 0x1a, 0x1a, 0x1a, 0x88, 0x0e, 0x76, 0x64, 0x03, 0x03, 0x4e, 0x4d, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x4d, 0xa2, 0x4d, 0xa2, 0x9e, 0xa2, 0x9e, 0xa2, 0x9e, 0xa2, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x01, 0xa1, 0x5e, 0x63, 0x06, 0x00, 0x0c, 0xf7, 0x12, 0xf8, 0xf9, 0xea, 0xeb, 0xdb, 0xfb, 0xec, 0xde, 0xfd, 0xf3, 0xf3, 0xe9, 0xe9, 0xe9, 0xf2, 0xe6, 0xf2, 0xe4, 0xef, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xfd, 0xed, 0xed, 0xed, 0xed, 0xe7, 0xed, 0xed, 0xe3, 0xf0, 0xef, 0xfd, 0xfd, 0xe2, 0xe2, 0xed, 0xef, 0xf2, 0xf2, 0xf3, 0xf0, 0xed, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0xf0, 0xe4, 0xde, 0xed, 0xf1, 0xf2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xee, 0xf0, 0xed, 0xee, 0xe0, 0xe8, 0xd6, 0xcd, 0xc3, 0xc7, 0xc9, 0xc7, 0xc3, 0xd6, 0xe8, 0xed, 0xf1, 0xdd, 0xd0, 0xc0, 0xbb, 0x06, 0x5c, 0x64, 0x68, 0x72, 0x0b, 0x7d, 0x7d, 0x14, 0x8f, 0x1e, 0x22, 0x76, 0x4e, 0x9f, 0x9f, 0x50, 0x02, 0x01, 0x50, 0x9f, 0x9f, 0x9f, 0x9f, 0x02, 0x9f, 0x50, 0x9f, 0x9f, 0x02, 0x9f, 0x02, 0x9f, 0x02, 0x4e, 0x01, 0x01, 0x01, 0x01, 0x50, 0x50, 0x50, 0x53, 0x51, 0xa1, 0x51, 0x59, 0x51, 0x53, 0x53, 0x53, 0x53, 0x51, 0x53, 0x51, 0x55, 0x53, 0x55, 0x53, 0x53, 0x55, 0x53, 0x53, 0x5a, 0x51, 0x51, 0xa1, 0x51, 0x59, 0x51, 0x59, 0x53, 0x57, 0x53, 0x57, 0x53, 0x59, 0x5b, 0x59, 0x59, 0x53, 0x59, 0x58, 0x5a, 0x53, 0x51, 0x58, 0x5a, 0x58, 0x58, 0x58, 0x56, 0x04, 0x5d, 0x56, 0x56, 0x54, 0x5c, 0x5c, 0x68, 0x08, 0x0b, 0x10, 0x15, 0x1e, 0x98, 0x33, 0x98, 0x95, 0x87, 0x7d, 0x74, 0x6c, 0x70, 0x79, 0x81, 0x14, 0x19, 0x27, 0x2b, 0x22, 0x15, 0x7a, 0x64, 0x56, 0x03, 0x03, 0x4e, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x50, 0xa1, 0xa1, 0x59, 0xa0, 0x00, 0x0a, 0xf7, 0x12, 0xf9, 0xfa, 0xea, 0xeb, 0xfb, 0xde, 0xf2, 0xf3, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf3, 0xf2, 0xe3, 0xed, 0xde, 0xed, 0xed, 0xed, 0xf1, 0xfd, 0xfe, 0xfe, 0xe2, 0xe2, 0xde, 0xde, 0xed, 0xff, 0xee, 0xff, 0xee, 0xff, 0xdf, 0xe2, 0xef, 0xf1, 0xe4, 0xe2, 0xed, 0xdf, 0xdf, 0xe2, 0xde, 0xde, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe3, 0xe2, 0xe2, 0xed, 0xee, 0xee, 0xed, 0xde, 0xe7, 0xe0, 0xd6, 0xcb, 0xc0, 0xc7, 0xce, 0xb8, 0xc7, 0xdc, 0xe8, 0xf5, 0xf6, 0x92, 0x66, 0x64, 0x54, 0x08, 0x08, 0x0d, 0x0f, 0x17, 0x14, 0x14, 0x1c, 0x1c, 0x1b, 0x27, 0x9d, 0x71, 0x9e, 0x4d, 0x50, 0x9e, 0x51, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xa2, 0x9f, 0x9f, 0x4d, 0x4e, 0x9f, 0x4f, 0x50, 0x51, 0x59, 0x51, 0xa1, 0x51, 0xa1, 0x51, 0x59, 0x55, 0x57, 0x55, 0x57, 0x55, 0x57, 0x55, 0x53, 0x53, 0x53, 0x53, 0x53, 0xa1, 0x53, 0xa1, 0xa1, 0xa1, 0x59, 0x53, 0x59, 0x53, 0x57, 0x57, 0x57, 0x53, 0x57, 0x57, 0x04, 0x57, 0x53, 0xa4, 0x51, 0xa4, 0x51, 0x51, 0x5a, 0x5a, 0x5a, 0x5a, 0x58, 0x51, 0x58, 0x54, 0x56, 0x5d, 0x5c, 0x5d, 0x64, 0x08, 0x0d, 0x0e, 0x91, 0x1a, 0x99, 0x33, 0x2b, 0x20, 0x1b, 0x83, 0x79, 0x74, 0x6c, 0x74, 0x79, 0x81, 0x17, 0x98, 0x27, 0x27, 0x27, 0x2e, 0x20, 0x0d, 0x04, 0x4f, 0x4d, 0x4f, 0x03, 0x4e, 0x9e, 0x01, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x01, 0x01, 0x01, 0xa2, 0x01, 0xa2, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0xa1, 0x5e, 0xa6, 0x06, 0xd7, 0xf7, 0xbb, 0xf9, 0xfa, 0xda, 0xdb, 0xfb, 0xec, 0xdd, 0xde, 0xe6, 0xe9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xf5, 0x4c, 0xe9, 0xf3, 0xf5, 0xf6, 0xf6, 0x4c, 0xf6, 0x4c, 0x4c, 0x4c, 0xfe, 0xfe, 0xfe, 0xef, 0xfd, 0xdf, 0xde, 0xf2, 0xf3, 0xe4, 0xde, 0xe2, 0xf2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xee, 0xe2, 0xee, 0xed, 0xed, 0xe0, 0xe7, 0xe0, 0xd6, 0xcf, 0xc3, 0xc1, 0xce, 0xc0, 0xd9, 0xdd, 0xf4, 0x89, 0x68, 0x5d, 0x0b, 0x0b, 0x0f, 0x0f, 0x17, 0x1b, 0x20, 0x21, 0x26, 0x26, 0x26, 0x21, 0x1b, 0x3b, 0x16, 0x56, 0x03, 0x58, 0x4e, 0x4e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0xa2, 0x4d, 0x4e, 0x51, 0x51, 0x51, 0x51, 0x57, 0x51, 0x57, 0x58, 0x51, 0x57, 0x53, 0x51, 0x55, 0x03, 0x04, 0x04, 0x03, 0x04, 0x04, 0x03, 0x04, 0x57, 0x57, 0x57, 0x57, 0x57, 0x53, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x04, 0x57, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x53, 0x5b, 0x61, 0x60, 0x5b, 0x54, 0x54, 0x54, 0x54, 0x4f, 0x4f, 0x56, 0x5c, 0x64, 0x08, 0x0b, 0x81, 0x18, 0x1e, 0x2b, 0x32, 0x33, 0x2b, 0x98, 0x17, 0x83, 0x79, 0x6c, 0x6c, 0x74, 0x79, 0x81, 0x8f, 0x1b, 0x9a, 0x32, 0x2a, 0x25, 0x32, 0x30, 0x15, 0x08, 0x5d, 0x4e, 0x4f, 0x4d, 0x4d, 0x01, 0x4d, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x01, 0x01, 0x4d, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x4d, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x9e, 0x9e, 0x9f, 0x01, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa3, 0xa1, 0xa0, 0x09, 0x0c, 0x80, 0xf9, 0xf9, 0x24, 0x2c, 0xeb, 0x3c, 0xeb, 0x2c, 0xeb, 0xeb, 0x3c, 0x3c, 0x3c, 0x44, 0x44, 0xff, 0x4a, 0x4c, 0xf5, 0xf3, 0xe6, 0xf2, 0xe2, 0xfc, 0xde, 0xf2, 0xdf, 0xdf, 0xe9, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xfd, 0xee, 0xee, 0xe3, 0xe4, 0xde, 0xe0, 0xe5, 0xdc, 0xd0, 0xc9, 0xc9, 0xcb, 0xc0, 0xd8, 0xf7, 0x60, 0x08, 0x0b, 0x0d, 0x0f, 0x11, 0x14, 0x1c, 0x1c, 0x1f, 0x21, 0x23, 0x1f, 0x23, 0x2f, 0x21, 0x27, 0x9d, 0x7a, 0x4d, 0x4e, 0x51, 0x4d, 0x4f, 0x9f, 0x4f, 0x9f, 0x51, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x4f, 0x51, 0x54, 0x57, 0x58, 0x57, 0x57, 0x55, 0x57, 0x55, 0x57, 0x55, 0x55, 0x03, 0x57, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 0x57, 0x57, 0x57, 0x57, 0x57, 0x04, 0x57, 0x04, 0x57, 0x04, 0x57, 0x57, 0x57, 0x55, 0x55, 0x58, 0x58, 0x58, 0x5b, 0x56, 0x56, 0x54, 0x4f, 0x54, 0x56, 0x64, 0x64, 0x68, 0x70, 0x0b, 0x10, 0x15, 0x1a, 0x22, 0x2b, 0x99, 0x2b, 0x98, 0x19, 0x13, 0x11, 0x79, 0x74, 0x74, 0x72, 0x79, 0x81, 0x87, 0x20, 0x20, 0x2a, 0x32, 0x2a, 0x2a, 0x20, 0x2b, 0x1b, 0x18, 0x70, 0x4e, 0x4d, 0x03, 0x4f, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x01, 0x9f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9e, 0x01, 0x4d, 0x4d, 0x4d, 0x01, 0x4d, 0x01, 0x4d, 0x01, 0x4d, 0x01, 0x4d, 0x01, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9f, 0x9f, 0x01, 0x9f, 0x9f, 0x01, 0x9f, 0x01, 0x4d, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x01, 0x4d, 0x01, 0x50, 0x01, 0x4d, 0xa2, 0x4d, 0xa2, 0x4d, 0x9e, 0x9e, 0xa2, 0x4d, 0x4d, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0xa2, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x61, 0x58, 0x4f, 0x4f, 0x52, 0x5c, 0x6a, 0x68, 0x6d, 0x76, 0xf7, 0x92, 0xda, 0xec, 0xdd, 0xe6, 0xf6, 0xe8, 0xdd, 0xe2, 0xe6, 0xdd, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xee, 0xe2, 0xfd, 0xe2, 0xee, 0xe3, 0xde, 0xe1, 0xe7, 0xe5, 0xdc, 0xd3, 0xb8, 0xc7, 0xbb, 0x00, 0x60, 0x76, 0x0b, 0x7d, 0x0f, 0x1c, 0x1f, 0x26, 0x1f, 0x1f, 0x26, 0x2f, 0x28, 0x28, 0x28, 0x36, 0x34, 0x21, 0x3b, 0x1a, 0x54, 0x4f, 0x4d, 0x50, 0x4e, 0x03, 0x03, 0x4e, 0x03, 0x4e, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x4f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x03, 0x54, 0x04, 0x55, 0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x57, 0x57, 0x57, 0x57, 0x53, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x53, 0x57, 0x57, 0x57, 0x51, 0x54, 0x51, 0x52, 0x51, 0x52, 0x51, 0x52, 0x56, 0x64, 0x68, 0x08, 0x70, 0x0e, 0x10, 0x18, 0x19, 0x1e, 0x27, 0x2b, 0x2b, 0x2a, 0x98, 0x19, 0x87, 0x7e, 0x74, 0x72, 0x72, 0x74, 0x79, 0x81, 0x14, 0x1b, 0x9a, 0x34, 0x35, 0x34, 0x31, 0x31, 0x31, 0x20, 0x1b, 0x19, 0x0e, 0x7a, 0x92, 0x66, 0x9e, 0x4e, 0x9e, 0x9e, 0x4d, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x4d, 0x01, 0x01, 0x01, 0x01, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x01, 0x4d, 0x01, 0x4d, 0x01, 0x4d, 0x02, 0x9f, 0x02, 0x02, 0x01, 0x50, 0x01, 0x50, 0x02, 0x02, 0x01, 0x4d, 0x01, 0x4d, 0x01, 0x02, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9f, 0x01, 0x4d, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x4d, 0x9f, 0x01, 0xa2, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0x9e, 0x9e, 0x4d, 0x4d, 0x4f, 0x52, 0x69, 0x6d, 0x76, 0x7b, 0x7b, 0x7b, 0x65, 0x58, 0x4f, 0x5c, 0x6d, 0x76, 0x78, 0x76, 0x76, 0x6d, 0x56, 0x9e, 0x9e, 0xa4, 0x09, 0xd8, 0xec, 0xf3, 0xe6, 0xe6, 0xf2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xfd, 0xe2, 0xfd, 0xe2, 0xde, 0xe2, 0xe6, 0xde, 0xe1, 0xf5, 0xe0, 0xd3, 0xd8, 0xd7, 0x65, 0x7a, 0x7a, 0x81, 0x13, 0x8f, 0x21, 0x21, 0x23, 0x28, 0x2d, 0x26, 0x2d, 0x23, 0x2d, 0x2d, 0x2d, 0x39, 0x21, 0x2e, 0x30, 0x08, 0x03, 0x4d, 0x9f, 0x50, 0x03, 0x02, 0x03, 0x02, 0x03, 0x4e, 0x03, 0x4e, 0x03, 0x03, 0x03, 0x04, 0x55, 0x04, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57, 0x04, 0x57, 0x04, 0x03, 0x03, 0x04, 0x57, 0x04, 0xa1, 0xa1, 0xa4, 0x5a, 0xa1, 0x5a, 0x51, 0x59, 0x55, 0x58, 0x55, 0x58, 0x57, 0x54, 0x57, 0x55, 0x58, 0x54, 0x54, 0x54, 0x54, 0x56, 0x56, 0x5c, 0x5c, 0x62, 0x64, 0x69, 0x76, 0x0d, 0x10, 0x19, 0x22, 0x99, 0x2b, 0x33, 0x99, 0x99, 0x20, 0x19, 0x17, 0x81, 0x7d, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x81, 0x17, 0x1b, 0x27, 0x32, 0x35, 0x38, 0x34, 0x2e, 0x26, 0x25, 0x1b, 0x17, 0x10, 0x0d, 0x08, 0x68, 0x68, 0x5d, 0x92, 0xf7, 0x54, 0xa1, 0x5e, 0x63, 0x5e, 0x5e, 0x5e, 0xa5, 0x63, 0x63, 0x5e, 0x63, 0x5e, 0x5e, 0x5b, 0x5b, 0x57, 0x5b, 0x53, 0x02, 0x02, 0x02, 0x4d, 0x01, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x01, 0x01, 0x01, 0x4d, 0x02, 0x4d, 0x01, 0x50, 0x02, 0x50, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x4d, 0x4d, 0x01, 0x01, 0x01, 0x9e, 0x4d, 0x01, 0x9f, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9f, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0xa2, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x4f, 0x62, 0x6d, 0x84, 0x89, 0x8e, 0x92, 0x89, 0x7b, 0x6b, 0x56, 0x4e, 0x5c, 0x76, 0x84, 0x89, 0x85, 0x89, 0x85, 0x84, 0x07, 0x4f, 0x9e, 0x9e, 0x9e, 0xa2, 0x06, 0xd8, 0xfc, 0xe6, 0xde, 0xf2, 0xe4, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xfd, 0xdf, 0xdf, 0xdf, 0xfd, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe1, 0xe5, 0xfd, 0xdb, 0x0e, 0x0b, 0x10, 0x17, 0x1b, 0x1c, 0x21, 0x26, 0x26, 0x2d, 0x2d, 0x28, 0x2d, 0x2d, 0x36, 0x2d, 0x2d, 0x36, 0x36, 0x2f, 0x2e, 0x3b, 0x0e, 0x4e, 0xa1, 0xa2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x57, 0x04, 0x03, 0x55, 0x53, 0x5a, 0x51, 0x53, 0x51, 0x57, 0x53, 0x59, 0x57, 0x57, 0x57, 0x57, 0x57, 0x04, 0x51, 0xa4, 0xa4, 0xa3, 0x5a, 0xa4, 0x5a, 0x51, 0x5a, 0x58, 0x54, 0x54, 0x54, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5c, 0x56, 0x64, 0x68, 0x70, 0x0b, 0x0e, 0x10, 0x13, 0x19, 0x98, 0x2b, 0x32, 0x32, 0x2b, 0x27, 0x1b, 0x91, 0x17, 0x10, 0x81, 0x74, 0x72, 0x72, 0x74, 0x7e, 0x81, 0x87, 0x17, 0x20, 0x2a, 0x32, 0x35, 0x35, 0x35, 0x2e, 0x2e, 0x1c, 0x1b, 0x14, 0x10, 0x0b, 0x08, 0x68, 0x64, 0x64, 0x64, 0x5d, 0x66, 0x4f, 0x0a, 0x24, 0x12, 0x12, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x12, 0x12, 0x12, 0xf7, 0xf7, 0x80, 0x80, 0x0c, 0x0a, 0x0a, 0x09, 0x71, 0x00, 0x07, 0x06, 0x67, 0x63, 0x63, 0x5b, 0x59, 0x57, 0x50, 0x53, 0x4e, 0x01, 0x4d, 0x9e, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x4d, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x9f, 0x4d, 0x01, 0x4d, 0x4d, 0x9e, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9e, 0xa2, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x4d, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4e, 0x61, 0x76, 0x84, 0x8e, 0x89, 0x85, 0x7b, 0x70, 0x66, 0x56, 0x54, 0x9e, 0x65, 0x0a, 0x76, 0x6d, 0x6d, 0x6d, 0x6a, 0x6d, 0x65, 0x54, 0x4d, 0x01, 0x9f, 0xa2, 0xa2, 0x9e, 0x9e, 0xf7, 0xdf, 0xe6, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xfd, 0xe2, 0xe2, 0xdf, 0xfd, 0xe2, 0xe2, 0xdf, 0xe8, 0xff, 0x4a, 0x22, 0x13, 0x1c, 0x1c, 0x26, 0x26, 0x26, 0x2f, 0x28, 0x2d, 0x2d, 0x2d, 0x2d, 0x2f, 0x2d, 0x2d, 0x36, 0x36, 0x39, 0x39, 0x2e, 0x3b, 0x16, 0x04, 0x9e, 0xa4, 0x9f, 0x50, 0x50, 0x50, 0x53, 0x53, 0x59, 0x53, 0x57, 0x57, 0x57, 0x57, 0x57, 0x55, 0x53, 0x51, 0xa1, 0x51, 0x5a, 0x51, 0x5a, 0x51, 0x50, 0x51, 0x5a, 0x5b, 0x5a, 0x58, 0x51, 0x5a, 0x52, 0x51, 0x52, 0x51, 0x52, 0x56, 0x54, 0x52, 0x5c, 0x5c, 0x5d, 0x64, 0x08, 0x70, 0x0d, 0x0d, 0x10, 0x13, 0x18, 0x1e, 0x98, 0x99, 0x2b, 0x33, 0x33, 0x99, 0x1e, 0x1b, 0x13, 0x87, 0x81, 0x7d, 0x79, 0x79, 0x74, 0x79, 0x7d, 0x11, 0x17, 0x8f, 0x20, 0x97, 0x2a, 0x31, 0x35, 0x35, 0x35, 0x2a, 0x27, 0x1b, 0x17, 0x10, 0x0d, 0x0b, 0x08, 0x68, 0x64, 0x5d, 0x04, 0x5b, 0x60, 0x05, 0x66, 0x60, 0x60, 0x03, 0x60, 0x12, 0x92, 0x12, 0x12, 0x12, 0x84, 0xf7, 0x84, 0xf7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0x80, 0xf7, 0xf7, 0xf7, 0x80, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x80, 0x80, 0x80, 0x80, 0x0c, 0x0c, 0xd7, 0x0a, 0x09, 0x71, 0x06, 0x67, 0x67, 0x63, 0x63, 0x5e, 0x5e, 0x5e, 0x50, 0x53, 0x02, 0x02, 0x01, 0x01, 0x4d, 0x4d, 0x01, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x01, 0x9f, 0x01, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0x57, 0x07, 0x80, 0x89, 0x80, 0x7a, 0x70, 0x68, 0x5c, 0x54, 0x4f, 0x4d, 0x4f, 0x4e, 0x05, 0x66, 0x58, 0x4f, 0x4e, 0x4f, 0x4f, 0x4e, 0x4f, 0x4d, 0x9e, 0x01, 0x50, 0x50, 0xa2, 0x9f, 0xa5, 0xd8, 0xde, 0xdf, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xed, 0xfd, 0xed, 0xfd, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xfd, 0xee, 0xfd, 0xe1, 0xff, 0x49, 0x22, 0x25, 0x25, 0x2d, 0x28, 0x2d, 0x2d, 0x2f, 0x28, 0x2d, 0x2d, 0x36, 0x2d, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x36, 0x2e, 0x37, 0x22, 0x68, 0x9e, 0xa4, 0xa4, 0xa4, 0x9f, 0xa4, 0x9f, 0x50, 0x50, 0x51, 0x4e, 0x50, 0x4f, 0x53, 0x54, 0x58, 0x58, 0x51, 0x51, 0x5a, 0x51, 0x5a, 0x5a, 0x5a, 0x58, 0x58, 0x51, 0x54, 0x4f, 0x4f, 0x52, 0x4f, 0x56, 0x5c, 0x5c, 0x62, 0x64, 0x68, 0x0b, 0x7a, 0x10, 0x15, 0x18, 0x1a, 0x1e, 0x27, 0x25, 0x2a, 0x2a, 0x32, 0x2a, 0x27, 0x20, 0x1e, 0x17, 0x87, 0x82, 0x79, 0x79, 0x74, 0x72, 0x72, 0x74, 0x7d, 0x81, 0x17, 0x19, 0x1b, 0x20, 0x25, 0x2a, 0x31, 0x2a, 0x31, 0x31, 0x25, 0x21, 0x17, 0x11, 0x82, 0x0b, 0x08, 0x68, 0x64, 0x5d, 0x5d, 0x5d, 0x05, 0x60, 0xa5, 0xa1, 0xa5, 0x5e, 0x63, 0x63, 0x05, 0x60, 0x05, 0x04, 0x04, 0x0a, 0x0a, 0x71, 0x0a, 0x71, 0x71, 0x07, 0x6b, 0x6b, 0x6b, 0x6b, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x6b, 0x00, 0x71, 0x0a, 0x71, 0x09, 0x71, 0x09, 0x71, 0x0a, 0x0a, 0x0a, 0x0c, 0x0a, 0x0c, 0x0c, 0x0c, 0x0c, 0x80, 0x0c, 0x0c, 0x0c, 0x80, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xd7, 0x0c, 0x0a, 0x0a, 0x09, 0x00, 0x00, 0x07, 0x06, 0x06, 0x67, 0x67, 0x63, 0x63, 0x5e, 0xa1, 0x53, 0x50, 0x50, 0x01, 0x4d, 0x9e, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x4d, 0x9f, 0x4d, 0x9f, 0x9e, 0x9e, 0x9e, 0x4d, 0x4d, 0x5b, 0x06, 0x07, 0x71, 0x6b, 0x66, 0x5d, 0x5c, 0x4f, 0x4f, 0x54, 0x4f, 0x4f, 0x4f, 0x4d, 0x4e, 0x67, 0x55, 0x4d, 0x4f, 0x4f, 0x4f, 0x4f, 0x4d, 0x9e, 0x01, 0x59, 0x5e, 0xa1, 0xa1, 0xa5, 0x0c, 0xda, 0xfd, 0xe8, 0xfc, 0xe6, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xdf, 0xe3, 0xe3, 0xdf, 0xe2, 0xe2, 0xee, 0xee, 0xee, 0xee, 0xe1, 0xf5, 0x2c, 0x16, 0x27, 0x37, 0x2f, 0x2f, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x36, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x2f, 0x37, 0x3b, 0x71, 0x03, 0x50, 0xa1, 0x51, 0xa1, 0x51, 0x5a, 0x5a, 0x5b, 0x58, 0x5b, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5c, 0x5d, 0x5c, 0x56, 0x54, 0x54, 0x54, 0x52, 0x56, 0x56, 0x5c, 0x5c, 0x62, 0x68, 0x68, 0x0b, 0x0e, 0x10, 0x15, 0x19, 0x1e, 0x98, 0x27, 0x2b, 0x2b, 0x32, 0x32, 0x2a, 0x27, 0x98, 0x95, 0x95, 0x88, 0x82, 0x7e, 0x79, 0x79, 0x74, 0x74, 0x74, 0x79, 0x7d, 0x81, 0x11, 0x1b, 0x1c, 0x21, 0x25, 0x2a, 0x2a, 0x2a, 0x32, 0x32, 0x2b, 0x2b, 0x1e, 0x18, 0x11, 0x0e, 0x0b, 0x08, 0x08, 0x68, 0x64, 0x64, 0x5d, 0x60, 0x60, 0x61, 0x61, 0x63, 0x5e, 0x59, 0x67, 0x67, 0x59, 0x5e, 0x5e, 0xa5, 0x63, 0xa1, 0xa0, 0xa0, 0xa1, 0x57, 0x67, 0x6b, 0x6b, 0x71, 0x09, 0x71, 0x0a, 0x0a, 0x71, 0x0a, 0x71, 0x07, 0x71, 0x07, 0x07, 0x07, 0x07, 0x06, 0x6b, 0x67, 0x06, 0x07, 0x07, 0x06, 0x07, 0x07, 0x07, 0x6b, 0x06, 0x67, 0x6b, 0x67, 0x6b, 0x06, 0x6b, 0x07, 0x07, 0x07, 0x07, 0x07, 0x71, 0x00, 0x71, 0x00, 0x71, 0x09, 0x09, 0x0a, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x80, 0x0c, 0x0c, 0x0a, 0x09, 0x09, 0x07, 0x06, 0x67, 0x67, 0x63, 0x61, 0x5e, 0x5e, 0x9f, 0x9f, 0x9f, 0x4d, 0x4d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x5e, 0x06, 0x00, 0x09, 0x07, 0x60, 0x03, 0x03, 0x54, 0x54, 0x4f, 0x4f, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4d, 0x57, 0x0c, 0x09, 0x02, 0x4e, 0x4e, 0x01, 0x9e, 0x4e, 0x06, 0x00, 0x61, 0x59, 0x00, 0xf7, 0xea, 0xde, 0xe6, 0xe4, 0xe6, 0xe6, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xee, 0xee, 0xee, 0xe2, 0xe2, 0xe3, 0xe1, 0xe3, 0xe3, 0xe2, 0xdf, 0xe2, 0xee, 0xee, 0xed, 0xe7, 0xe7, 0x12, 0x12, 0x1d, 0x1e, 0x37, 0x2f, 0x2f, 0x2d, 0x36, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3a, 0x39, 0x3a, 0x36, 0x39, 0x36, 0x3a, 0x31, 0x3b, 0x0b, 0x04, 0x4d, 0x55, 0x4f, 0x54, 0x4f, 0x54, 0x54, 0x56, 0x54, 0x54, 0x56, 0x56, 0x5c, 0x56, 0x5d, 0x56, 0x56, 0x56, 0x5c, 0x5d, 0x68, 0x08, 0x08, 0x7a, 0x0d, 0x85, 0x15, 0x1a, 0x1d, 0x22, 0x99, 0x2b, 0x33, 0x32, 0x2b, 0x2b, 0x27, 0x20, 0x1b, 0x17, 0x14, 0x11, 0x0f, 0x7d, 0x74, 0x72, 0x6c, 0x6c, 0x6c, 0x72, 0x74, 0x79, 0x81, 0x17, 0x17, 0x20, 0x20, 0x2a, 0x2a, 0x26, 0x2e, 0x31, 0x31, 0x2e, 0x27, 0x20, 0x1a, 0x13, 0x0e, 0x70, 0x08, 0x68, 0x64, 0x64, 0x65, 0x60, 0x56, 0x04, 0x5d, 0x04, 0x04, 0x60, 0x5b, 0x61, 0x5e, 0xa5, 0xa5, 0xa5, 0x60, 0x5d, 0x60, 0x5e, 0x5e, 0xa5, 0xa4, 0xa5, 0xa3, 0xa4, 0xa0, 0x5a, 0x61, 0x05, 0x05, 0x67, 0x6b, 0x07, 0x71, 0x71, 0x09, 0x71, 0x0a, 0x71, 0x09, 0x71, 0x09, 0x71, 0x71, 0xf7, 0x0c, 0x00, 0x6b, 0x07, 0x07, 0x07, 0x06, 0x6b, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x06, 0x06, 0x6b, 0x06, 0x6b, 0x06, 0x06, 0x6b, 0x06, 0x07, 0x06, 0x6b, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x00, 0x07, 0x06, 0x07, 0x07, 0x07, 0x00, 0x71, 0x00, 0x07, 0x00, 0x09, 0x0a, 0x0a, 0xd7, 0xd7, 0x0c, 0x0c, 0x0c, 0x0c, 0xd7, 0x0c, 0x0a, 0x0c, 0xd7, 0x0c, 0xd7, 0xd7, 0x0a, 0x09, 0xd7, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x63, 0x03, 0x4d, 0x03, 0x57, 0x4f, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x01, 0x4d, 0x01, 0x01, 0xa1, 0xa0, 0x63, 0xa0, 0x59, 0xa2, 0x5e, 0x09, 0x00, 0x5e, 0xa1, 0xd7, 0xf9, 0xdb, 0xed, 0xf6, 0xef, 0xde, 0xe2, 0xdf, 0xef, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xf0, 0xf0, 0xf0, 0xed, 0xed, 0xe3, 0xe3, 0xe1, 0xe1, 0xe3, 0xed, 0xe2, 0xee, 0xee, 0xed, 0xe7, 0xd3, 0xb5, 0xf8, 0xf9, 0x92, 0x29, 0x3b, 0x37, 0x39, 0x40, 0x40, 0x40, 0x3a, 0x39, 0x39, 0x39, 0x39, 0x3a, 0x3a, 0x39, 0x36, 0x36, 0x39, 0x31, 0x38, 0x0e, 0x04, 0x54, 0x54, 0x54, 0x4f, 0x54, 0x56, 0x56, 0x5c, 0x5c, 0x64, 0x64, 0x08, 0x08, 0x0b, 0x72, 0x0d, 0x13, 0x17, 0x19, 0x27, 0x27, 0x2b, 0x32, 0x38, 0x38, 0x38, 0x38, 0x38, 0x32, 0x32, 0x98, 0x20, 0x19, 0x13, 0x81, 0x7d, 0x74, 0x74, 0x72, 0x72, 0x72, 0x72, 0x74, 0x74, 0x79, 0x81, 0x11, 0x8f, 0x1b, 0x20, 0x9a, 0x2a, 0x2a, 0x2a, 0x35, 0x35, 0x35, 0x2a, 0x32, 0x27, 0x98, 0x19, 0x13, 0x0d, 0x72, 0x08, 0x64, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x5d, 0x04, 0x57, 0x57, 0x5e, 0x63, 0x63, 0x67, 0x63, 0x5e, 0x5e, 0x5a, 0x59, 0x5a, 0x5e, 0x5e, 0x60, 0x05, 0x05, 0x05, 0x61, 0x5e, 0x5a, 0x06, 0x63, 0x5a, 0x63, 0x61, 0x57, 0x61, 0x5b, 0xa1, 0x5e, 0x5e, 0xa0, 0xa0, 0x67, 0x6b, 0x06, 0x6b, 0x07, 0x6b, 0x07, 0x07, 0x07, 0xf7, 0x7b, 0x71, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x07, 0x6b, 0x6b, 0x67, 0x6b, 0x67, 0x67, 0x6b, 0x06, 0x67, 0x6b, 0x06, 0x07, 0x07, 0x06, 0x07, 0x06, 0x07, 0x6b, 0x07, 0x06, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x67, 0x07, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x07, 0x06, 0x07, 0x07, 0x00, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0xd7, 0x0c, 0x0c, 0x0c, 0x0c, 0x09, 0x09, 0x09, 0x0a, 0xd7, 0xd7, 0x09, 0x09, 0x71, 0x5b, 0x4e, 0x4d, 0x50, 0xa4, 0x9f, 0xa2, 0x9e, 0xa2, 0xa2, 0xa2, 0x9e, 0x9e, 0x9e, 0xa1, 0x5e, 0xa3, 0xa6, 0xd7, 0xd7, 0xa3, 0xa6, 0xbb, 0xda, 0xde, 0xf6, 0xf6, 0xde, 0xde, 0xf1, 0xf2, 0xde, 0xdd, 0xf5, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xfd, 0xf0, 0xee, 0xef, 0xed, 0xe3, 0xe1, 0xe3, 0xe1, 0xdf, 0xe2, 0xed, 0xfd, 0xee, 0xed, 0xe7, 0xcd, 0xb8, 0xd9, 0xc7, 0xca, 0x96, 0x9c, 0x3d, 0x45, 0x45, 0x42, 0x40, 0x39, 0x36, 0x39, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x39, 0x39, 0x39, 0x34, 0x3f, 0x13, 0x68, 0x08, 0x0b, 0x0b, 0x0d, 0x0e, 0x10, 0x13, 0x13, 0x19, 0x1e, 0x98, 0x99, 0x32, 0x33, 0x3b, 0x32, 0x32, 0x30, 0x32, 0x2b, 0x2b, 0x27, 0x20, 0x1b, 0x19, 0x14, 0x11, 0x7d, 0x7d, 0x7d, 0x74, 0x72, 0x70, 0x72, 0x72, 0x74, 0x74, 0x74, 0x7d, 0x81, 0x87, 0x91, 0x95, 0x98, 0x2b, 0x31, 0x35, 0x35, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x98, 0x1b, 0x18, 0x13, 0x0f, 0x79, 0x69, 0x64, 0x5c, 0x56, 0x56, 0x5d, 0x5d, 0x64, 0x66, 0x60, 0x60, 0x60, 0x60, 0x05, 0x63, 0x67, 0x63, 0x63, 0x5e, 0x5e, 0x59, 0x5e, 0x5e, 0x5e, 0x63, 0x63, 0x5e, 0x61, 0x5b, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x05, 0x55, 0x61, 0x63, 0x5b, 0x63, 0x67, 0x5a, 0x63, 0xa0, 0xa0, 0x5e, 0x63, 0x5e, 0x61, 0x5e, 0x05, 0x61, 0x63, 0x05, 0x67, 0x05, 0x6b, 0x03, 0x5b, 0x5e, 0x67, 0x06, 0x06, 0x06, 0x67, 0x06, 0x67, 0x06, 0x67, 0x06, 0x67, 0x67, 0x63, 0x61, 0x5e, 0x5e, 0x5e, 0x61, 0x63, 0x5e, 0x63, 0x61, 0x63, 0x63, 0x63, 0x63, 0x67, 0x67, 0x67, 0xa0, 0x67, 0x67, 0x06, 0x67, 0xa0, 0x67, 0x06, 0x67, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x06, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x00, 0x07, 0x06, 0x06, 0x06, 0x06, 0xa0, 0x06, 0x06, 0x09, 0x0a, 0x0c, 0x80, 0x80, 0xf7, 0xd7, 0xd7, 0xd7, 0x09, 0x06, 0xa5, 0xa5, 0xa1, 0xa1, 0xa4, 0xd7, 0x09, 0x0c, 0xd7, 0x00, 0xa7, 0xd7, 0xcd, 0xd6, 0xe8, 0xf5, 0xdf, 0xdf, 0xde, 0xdf, 0xf2, 0xed, 0xf1, 0xe4, 0xed, 0xf3, 0xde, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xef, 0xf2, 0xd6, 0xb8, 0xc7, 0xc9, 0xcb, 0xc9, 0xca, 0xfa, 0x29, 0x3d, 0x3f, 0x3e, 0x39, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3e, 0x2e, 0x32, 0x32, 0x38, 0x35, 0x38, 0x37, 0x37, 0x35, 0x37, 0x2e, 0x31, 0x2e, 0x2a, 0x20, 0x20, 0x1b, 0x1e, 0x91, 0x15, 0x87, 0x82, 0x7d, 0x74, 0x74, 0x72, 0x72, 0x72, 0x72, 0x79, 0x79, 0x79, 0x7d, 0x81, 0x11, 0x11, 0x8f, 0x1b, 0x20, 0x2a, 0x27, 0x32, 0x32, 0x35, 0x2a, 0x2a, 0x27, 0x98, 0x98, 0x1e, 0x1a, 0x15, 0x85, 0x0e, 0x70, 0x08, 0x68, 0x5d, 0x56, 0x56, 0x56, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x63, 0x5e, 0x63, 0x5e, 0x5b, 0x61, 0x5e, 0x61, 0x61, 0x61, 0x5e, 0x5b, 0x5e, 0x5e, 0x61, 0x61, 0x63, 0x5e, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5e, 0x63, 0x61, 0x59, 0x57, 0x5e, 0x67, 0xa6, 0xf7, 0xfa, 0xdb, 0xfb, 0xec, 0xec, 0xec, 0xec, 0xec, 0xfb, 0xdb, 0xdb, 0xeb, 0xeb, 0xda, 0xda, 0xea, 0xfa, 0xfa, 0xd8, 0xf9, 0xf8, 0xf8, 0xf8, 0xbb, 0x12, 0x12, 0xf7, 0xf7, 0xf7, 0x80, 0x0c, 0x0c, 0xd7, 0xd7, 0x0a, 0xd7, 0x09, 0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x67, 0x06, 0xa6, 0xa6, 0xa6, 0xa5, 0xa6, 0x06, 0x06, 0x06, 0x67, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x06, 0xa6, 0xa6, 0xa0, 0xa0, 0x07, 0x07, 0x06, 0xd7, 0x09, 0xd7, 0x00, 0x09, 0x0a, 0x0a, 0xd7, 0xd7, 0xd7, 0xd7, 0x09, 0xd7, 0xf7, 0xbb, 0xd8, 0xfb, 0xe8, 0xe9, 0xe6, 0xe2, 0xe2, 0xe2, 0xe2, 0xfd, 0xe2, 0xe2, 0xdf, 0xed, 0xe2, 0xe2, 0xdf, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xdf, 0xe2, 0xe2, 0xe8, 0xd2, 0xb5, 0xc7, 0xcb, 0xc9, 0xcb, 0xd9, 0xd9, 0xfa, 0x24, 0x30, 0x37, 0x3a, 0x39, 0x39, 0x39, 0x3a, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x34, 0x3e, 0x2e, 0x27, 0x20, 0x20, 0x1b, 0x1b, 0x1b, 0x17, 0x17, 0x14, 0x11, 0x11, 0x81, 0x7d, 0x79, 0x79, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x79, 0x7d, 0x7d, 0x81, 0x11, 0x17, 0x19, 0x1b, 0x20, 0x20, 0x27, 0x2a, 0x32, 0x32, 0x32, 0x32, 0x2b, 0x2b, 0x20, 0x1e, 0x17, 0x15, 0x11, 0x10, 0x0b, 0x0b, 0x08, 0x68, 0x64, 0x64, 0x5d, 0x64, 0x5d, 0x60, 0x5b, 0x61, 0x61, 0x63, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5e, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x5e, 0x5e, 0x5e, 0x61, 0x5e, 0x61, 0x5e, 0x63, 0x61, 0x63, 0x63, 0x63, 0x61, 0x5e, 0x5e, 0x5e, 0x5a, 0x61, 0xa0, 0x63, 0x63, 0x5e, 0x63, 0x5e, 0x61, 0x63, 0x63, 0x63, 0x5e, 0x59, 0x59, 0x5e, 0x5e, 0x63, 0x67, 0x00, 0x80, 0xf9, 0xea, 0xfc, 0xdf, 0xe8, 0xf5, 0xe9, 0xe9, 0xf5, 0xe9, 0xe9, 0xe9, 0xe9, 0xf5, 0xe9, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xe9, 0xe9, 0xf3, 0xe8, 0xe6, 0xe8, 0xfd, 0xee, 0xdf, 0xfd, 0xde, 0xff, 0xdd, 0xfc, 0xec, 0xec, 0xfb, 0xfb, 0xdb, 0xdb, 0xeb, 0xeb, 0xeb, 0xda, 0xea, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0x92, 0xf8, 0x89, 0x89, 0x84, 0x76, 0x71, 0x6b, 0x6d, 0x07, 0x71, 0x71, 0x07, 0x6b, 0x6b, 0x6b, 0x71, 0x68, 0x6b, 0x6b, 0x00, 0x5e, 0xa6, 0x09, 0x0a, 0x0c, 0xf7, 0x12, 0xf8, 0xf8, 0xd8, 0xcd, 0xeb, 0xfb, 0xde, 0xf3, 0xf2, 0xf2, 0xef, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe8, 0xca, 0xbc, 0xd9, 0xcb, 0xd9, 0xcb, 0xcb, 0xd9, 0xca, 0xfa, 0x92, 0x22, 0x37, 0x3a, 0x3a, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x39, 0x39, 0x39, 0x3a, 0x3a, 0x38, 0x17, 0x79, 0x72, 0x7e, 0x74, 0x72, 0x72, 0x72, 0x6c, 0x72, 0x6c, 0x72, 0x72, 0x74, 0x78, 0x7e, 0x7e, 0x81, 0x11, 0x14, 0x17, 0x1b, 0x1b, 0x20, 0x27, 0x2a, 0x2b, 0x32, 0x2b, 0x2b, 0x27, 0x27, 0x20, 0x1e, 0x1b, 0x19, 0x18, 0x13, 0x10, 0x0d, 0x0b, 0x70, 0x08, 0x68, 0x64, 0x62, 0x64, 0x64, 0x5d, 0x5d, 0x64, 0x64, 0x64, 0x66, 0x5d, 0x60, 0x60, 0x05, 0x05, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5e, 0x61, 0x61, 0x5e, 0x63, 0x5e, 0x61, 0x5e, 0x61, 0x5e, 0x5e, 0x61, 0x5e, 0x61, 0x5e, 0x61, 0x5e, 0x61, 0x5e, 0x61, 0x5e, 0x61, 0x5e, 0x61, 0x5e, 0x63, 0x63, 0x67, 0x5e, 0x5b, 0x5e, 0x61, 0x61, 0x63, 0x61, 0x5e, 0x5a, 0x5e, 0xa1, 0x53, 0x5e, 0x06, 0x09, 0xf7, 0xf9, 0xeb, 0xec, 0xef, 0xf3, 0xf6, 0xf2, 0xf2, 0xe6, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe4, 0xdf, 0xdf, 0xe2, 0xe1, 0xfd, 0xe1, 0xe2, 0xdf, 0xdf, 0xe6, 0xe4, 0xe6, 0xe6, 0xef, 0xe6, 0xe2, 0xf2, 0xe6, 0xf3, 0xe6, 0xf3, 0xf2, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf5, 0xe9, 0xe8, 0xe8, 0xe9, 0xf6, 0xf6, 0xf6, 0x4c, 0x4b, 0x4b, 0x48, 0x46, 0x46, 0x30, 0x1d, 0x18, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x92, 0x92, 0x92, 0x16, 0x16, 0x16, 0x16, 0x96, 0x92, 0xda, 0xfb, 0xfc, 0xff, 0xfd, 0x4a, 0xf2, 0xe9, 0xe9, 0xe9, 0xf6, 0xf5, 0xe8, 0xf3, 0xe8, 0xf2, 0xde, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe7, 0xc7, 0xc3, 0xcb, 0xd9, 0xd9, 0xd9, 0xd9, 0xcb, 0xcb, 0xca, 0xf8, 0x89, 0x30, 0x37, 0x3a, 0x39, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3a, 0x3a, 0x3a, 0x35, 0x3f, 0x17, 0x0b, 0x74, 0x74, 0x79, 0x79, 0x7e, 0x81, 0x83, 0x87, 0x15, 0x87, 0x91, 0x95, 0x1e, 0x98, 0x98, 0x27, 0x32, 0x32, 0x32, 0x2a, 0x2b, 0x27, 0x20, 0x1e, 0x1b, 0x18, 0x15, 0x10, 0x10, 0x0e, 0x0d, 0x0b, 0x08, 0x08, 0x68, 0x68, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x60, 0x64, 0x60, 0x60, 0x66, 0x60, 0x66, 0x60, 0x60, 0x60, 0x66, 0x67, 0x66, 0x05, 0x05, 0x61, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x63, 0x61, 0x63, 0x61, 0x63, 0x5e, 0x61, 0x5e, 0x61, 0x61, 0x5e, 0x61, 0x5e, 0x61, 0x5e, 0x63, 0x61, 0x5e, 0x61, 0x61, 0x5e, 0x5e, 0x5e, 0x63, 0x5e, 0x5e, 0x5e, 0x63, 0x63, 0x63, 0x5e, 0x59, 0xa1, 0x57, 0xa1, 0x5e, 0x06, 0x0c, 0xbb, 0xfa, 0xeb, 0xec, 0xfe, 0xe6, 0xf4, 0xf5, 0xfe, 0xef, 0xfd, 0xe2, 0xdf, 0xdf, 0xe2, 0xe6, 0xe4, 0xdf, 0xe2, 0xef, 0xe4, 0xe2, 0xe2, 0xe2, 0xdf, 0xe4, 0xe2, 0xef, 0xe2, 0xef, 0xdf, 0xe4, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe4, 0xfd, 0xf1, 0xee, 0xfd, 0xfd, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf1, 0xf2, 0xef, 0xe1, 0xe1, 0xe1, 0xe1, 0xfd, 0x4a, 0x49, 0x41, 0x3d, 0x37, 0x35, 0x2e, 0x2a, 0x2a, 0x2e, 0x32, 0x30, 0x3b, 0x30, 0x30, 0x3b, 0x30, 0x30, 0x1e, 0x1a, 0x1a, 0x1b, 0x27, 0x2b, 0x29, 0x1d, 0xff, 0xf6, 0xee, 0xf2, 0xfe, 0xf2, 0xe6, 0xdf, 0xe1, 0xe1, 0xe3, 0xed, 0xdf, 0xe2, 0xf1, 0xef, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xdf, 0xe2, 0xe4, 0xdf, 0xe7, 0xc1, 0xc3, 0xcb, 0xca, 0xd9, 0xd9, 0xcb, 0xcc, 0xc1, 0xc6, 0xc0, 0x12, 0x16, 0x30, 0x37, 0x39, 0x39, 0x39, 0x3a, 0x39, 0x3a, 0x3a, 0x3a, 0x34, 0x35, 0x3f, 0x1b, 0x19, 0x20, 0x1b, 0x9a, 0x2b, 0x2a, 0x32, 0x27, 0x2b, 0x2b, 0x33, 0x2b, 0x2b, 0x27, 0x20, 0x1b, 0x19, 0x17, 0x13, 0x10, 0x10, 0x10, 0x0d, 0x0b, 0x70, 0x08, 0x08, 0x68, 0x68, 0x64, 0x64, 0x60, 0x04, 0x60, 0x04, 0x60, 0x05, 0x66, 0x60, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x61, 0x63, 0x5e, 0x61, 0x63, 0x63, 0x05, 0x61, 0x61, 0x60, 0x61, 0x60, 0x05, 0x05, 0x05, 0x05, 0x61, 0x61, 0x61, 0x61, 0x61, 0x63, 0x61, 0x61, 0x63, 0x61, 0x63, 0x63, 0x61, 0x63, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5e, 0x61, 0x63, 0x63, 0x63, 0x5e, 0x5e, 0x5e, 0x59, 0x53, 0x50, 0x53, 0x63, 0x0a, 0xf7, 0xf9, 0xda, 0xdb, 0xfc, 0xde, 0xe6, 0xf3, 0xf5, 0xe6, 0xf1, 0xe4, 0xfd, 0xdf, 0xef, 0xf1, 0xe6, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe1, 0xe1, 0xe1, 0xdf, 0xe3, 0xe2, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xed, 0xe3, 0xe3, 0xde, 0xdf, 0xe6, 0x4c, 0x4c, 0x49, 0x41, 0x9d, 0x32, 0x25, 0x2e, 0x2f, 0x36, 0x34, 0x34, 0x35, 0x35, 0x2e, 0x32, 0x37, 0x30, 0x27, 0x18, 0x0f, 0x0f, 0x14, 0x1b, 0x25, 0x2e, 0x25, 0x1e, 0x29, 0x4b, 0x4c, 0xff, 0xde, 0xe2, 0xfd, 0xe2, 0xdf, 0xe1, 0xe3, 0xe6, 0xef, 0xef, 0xdf, 0xdf, 0xdf, 0xe2, 0xef, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xef, 0xef, 0xed, 0xe5, 0xc1, 0xc9, 0xd9, 0xd9, 0xca, 0xd9, 0xcb, 0xcc, 0xbf, 0xc2, 0xc3, 0xbb, 0xf9, 0x30, 0x3b, 0x3a, 0x3a, 0x3a, 0x39, 0x3a, 0x39, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x1b, 0x1e, 0x1e, 0x20, 0x2b, 0x1b, 0x87, 0x10, 0x7e, 0x0d, 0x7e, 0x0e, 0x0d, 0x0e, 0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x68, 0x68, 0x64, 0x64, 0x64, 0x66, 0x66, 0x65, 0x65, 0x61, 0x65, 0x65, 0x65, 0x63, 0xa6, 0xa0, 0xa6, 0xa0, 0x63, 0x5e, 0x63, 0x63, 0x67, 0x05, 0x67, 0x05, 0x05, 0x63, 0xa0, 0x5e, 0xa5, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x61, 0x05, 0x61, 0x61, 0x05, 0x05, 0x61, 0x61, 0x05, 0x61, 0x05, 0x61, 0x61, 0x61, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5e, 0x63, 0x59, 0x5e, 0x59, 0x50, 0x50, 0x50, 0x5e, 0x06, 0x0c, 0xbb, 0xea, 0xdb, 0xec, 0xdf, 0xfd, 0xe6, 0xf2, 0xe9, 0xf3, 0xe6, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xf1, 0xe4, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe6, 0xe4, 0xe4, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xf1, 0xe4, 0xef, 0xe2, 0xe2, 0xdf, 0xdf, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xe1, 0xe1, 0xe1, 0xe3, 0xe2, 0xe2, 0xf0, 0xee, 0xee, 0xed, 0xed, 0xed, 0xe1, 0xe3, 0xe1, 0xe5, 0xe4, 0xfe, 0x4a, 0x4b, 0x41, 0x3d, 0x2b, 0x2e, 0x2e, 0x2f, 0x36, 0x36, 0x36, 0x36, 0x34, 0x34, 0x35, 0x37, 0x2e, 0x25, 0x14, 0x11, 0x0f, 0x14, 0x25, 0x37, 0x31, 0x31, 0x26, 0x1c, 0x1b, 0x41, 0x4b, 0xff, 0xde, 0xe3, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xef, 0xe4, 0xef, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xed, 0xef, 0xe4, 0xdf, 0xe1, 0xc3, 0xcb, 0xc9, 0xcd, 0xd9, 0xd9, 0xc9, 0xc6, 0xc6, 0xc5, 0xc1, 0xc0, 0xeb, 0x49, 0x41, 0x37, 0x37, 0x37, 0x3a, 0x3a, 0x3a, 0x3a, 0x39, 0x3a, 0x3e, 0x35, 0x1b, 0x1b, 0x0d, 0x98, 0x99, 0x7d, 0x68, 0x08, 0x69, 0x69, 0x62, 0x64, 0x62, 0x66, 0x64, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x65, 0x65, 0x65, 0xa0, 0x65, 0xa5, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa0, 0xa0, 0x63, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x63, 0xa5, 0xa5, 0x63, 0xa5, 0xa0, 0x5e, 0x5e, 0x63, 0x63, 0x63, 0x05, 0x63, 0x05, 0x61, 0x05, 0x63, 0x61, 0x05, 0x63, 0x61, 0x63, 0x61, 0x63, 0x61, 0x63, 0x63, 0x5e, 0x63, 0x63, 0x61, 0x63, 0x61, 0x61, 0x5e, 0x61, 0x63, 0x63, 0x61, 0x63, 0x61, 0x5e, 0x5b, 0x59, 0x02, 0xa1, 0x67, 0x0a, 0x12, 0xfa, 0xeb, 0xfc, 0xde, 0xfe, 0xf4, 0xf0, 0xf2, 0xf0, 0xf1, 0xe1, 0xfd, 0xe1, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe4, 0xe2, 0xe2, 0xdf, 0xe3, 0xe2, 0xdf, 0xe2, 0xe6, 0xe2, 0xe2, 0xdf, 0xe4, 0xdf, 0xdf, 0xdf, 0xdf, 0xe4, 0xe2, 0xe6, 0xef, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3, 0xe3, 0xed, 0xf0, 0xe4, 0xef, 0xe3, 0xe3, 0xe0, 0xe1, 0xe0, 0xdf, 0xfe, 0x4b, 0x49, 0x43, 0x37, 0x25, 0x2f, 0x36, 0x36, 0x36, 0x39, 0x36, 0x34, 0x34, 0x31, 0x34, 0x2e, 0x21, 0x17, 0x0f, 0x11, 0x1b, 0x25, 0x38, 0x38, 0x9a, 0x25, 0x1f, 0x26, 0x1f, 0x1b, 0x47, 0x4b, 0xfd, 0xe1, 0xe1, 0xe0, 0xe3, 0xe2, 0xdf, 0xe2, 0xf1, 0xf1, 0xe2, 0xdf, 0xed, 0xef, 0xef, 0xed, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xed, 0xe8, 0xcf, 0xbc, 0xd9, 0xcb, 0xc7, 0xcb, 0xc9, 0xc6, 0xc6, 0xc9, 0xc7, 0xd0, 0xed, 0x4a, 0x49, 0x47, 0x3d, 0x30, 0x2e, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3e, 0x2e, 0x18, 0x1d, 0x72, 0x1a, 0x38, 0x0b, 0x69, 0x8e, 0x1d, 0x9b, 0x8e, 0x6a, 0x4f, 0x60, 0x07, 0x67, 0x6b, 0x6b, 0xa0, 0x67, 0xa0, 0xa0, 0x63, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x63, 0x05, 0x67, 0x63, 0x05, 0x63, 0x63, 0x63, 0xa5, 0x63, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x5e, 0x63, 0xa0, 0xa0, 0x67, 0xa0, 0x67, 0x5e, 0x61, 0x63, 0x5e, 0x61, 0x63, 0x67, 0x61, 0x61, 0x63, 0x61, 0x63, 0x63, 0x63, 0x63, 0x5e, 0x63, 0x5e, 0x63, 0x63, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x63, 0x63, 0x63, 0x5b, 0x59, 0x50, 0x01, 0x9e, 0x53, 0x00, 0x0c, 0xfa, 0xda, 0xec, 0xe6, 0xf2, 0xf2, 0xf2, 0xef, 0xf1, 0xf0, 0xef, 0xee, 0xed, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xe2, 0xe3, 0xdf, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xdf, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3, 0xed, 0xe3, 0xed, 0xe3, 0xe3, 0xe3, 0xe1, 0xe1, 0xe5, 0xdf, 0x4c, 0x4b, 0x48, 0x3d, 0x2e, 0x2d, 0x39, 0x36, 0x36, 0x36, 0x2d, 0x2f, 0x2f, 0x34, 0x34, 0x35, 0x2e, 0x1c, 0x11, 0x14, 0x1b, 0x2a, 0x35, 0x38, 0x2a, 0x97, 0x26, 0x26, 0x1f, 0x26, 0x1b, 0x27, 0x4b, 0x4a, 0xfc, 0xe5, 0xe0, 0xe0, 0xed, 0xe2, 0xee, 0xee, 0xee, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xd6, 0xc7, 0xd9, 0xce, 0xc7, 0xc3, 0xc9, 0xcb, 0xc3, 0xc1, 0xd0, 0xdc, 0xed, 0xee, 0x4a, 0x4c, 0x4a, 0x4b, 0x48, 0x30, 0x30, 0x30, 0x3f, 0x3b, 0x3d, 0x1e, 0x1a, 0x1d, 0x69, 0x17, 0x33, 0x79, 0x13, 0x82, 0x69, 0x84, 0x9c, 0x92, 0x71, 0x6a, 0xa0, 0x5e, 0xa0, 0xa6, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x63, 0xa0, 0x63, 0xa0, 0x63, 0x67, 0x63, 0x67, 0x05, 0x66, 0x66, 0x05, 0x05, 0x05, 0x61, 0x67, 0x63, 0xa0, 0xa5, 0x63, 0xa5, 0xa5, 0x63, 0xa0, 0x05, 0x5e, 0x5b, 0x5a, 0x5b, 0x59, 0x63, 0x63, 0xa0, 0x67, 0xa0, 0x61, 0x5e, 0x5e, 0x61, 0x5e, 0x61, 0x63, 0x61, 0x5e, 0x5e, 0x61, 0x63, 0x63, 0xa0, 0x63, 0xa0, 0xa0, 0x63, 0x63, 0x5e, 0x59, 0x50, 0x50, 0xa1, 0x00, 0x80, 0xf9, 0xda, 0xec, 0xee, 0xf6, 0xf5, 0xf5, 0xf5, 0xe6, 0xdf, 0xde, 0xf1, 0xe2, 0xe2, 0xed, 0xfd, 0xed, 0xed, 0xed, 0xed, 0xdf, 0xe2, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe3, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xed, 0xe2, 0xdf, 0xed, 0xed, 0xed, 0xe2, 0xed, 0xe2, 0xdf, 0xed, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe3, 0xe1, 0xed, 0xe3, 0xe3, 0xe4, 0xe4, 0xdf, 0xdf, 0xfe, 0x4c, 0x49, 0x46, 0x30, 0x2e, 0x2f, 0x2d, 0x2d, 0x2d, 0x36, 0x36, 0x36, 0x36, 0x31, 0x31, 0x25, 0x14, 0x11, 0x11, 0x1c, 0x32, 0x35, 0x35, 0x2a, 0x26, 0x97, 0x26, 0x26, 0x1f, 0x97, 0x97, 0x1b, 0x9d, 0x49, 0xfe, 0xde, 0xe0, 0xe0, 0xe0, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe1, 0xe7, 0xcf, 0xc0, 0xc7, 0xcb, 0xcb, 0xc9, 0xc7, 0xc7, 0xd8, 0xd6, 0xf2, 0xee, 0xde, 0xde, 0xff, 0xfd, 0xf1, 0xe3, 0x12, 0xf7, 0x89, 0xf9, 0x1d, 0x9c, 0x16, 0x16, 0x1d, 0x08, 0x82, 0x38, 0x74, 0x91, 0x7e, 0x52, 0x73, 0x9b, 0x96, 0x6d, 0x00, 0x06, 0xa5, 0xa6, 0xa5, 0xa6, 0xa0, 0xa6, 0xa0, 0xa0, 0xa0, 0xa0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x05, 0x66, 0x05, 0x66, 0x05, 0x05, 0x05, 0x05, 0x65, 0x63, 0x65, 0x63, 0x63, 0x61, 0x61, 0x60, 0x05, 0x05, 0x05, 0x67, 0x6b, 0x07, 0x61, 0x61, 0x5a, 0x5e, 0x5a, 0x5e, 0x5e, 0x06, 0x67, 0x05, 0x5e, 0x61, 0x63, 0x06, 0x63, 0x63, 0x67, 0x63, 0x5e, 0x59, 0x59, 0xa1, 0x5e, 0xa0, 0x00, 0x0c, 0xf8, 0xeb, 0xec, 0xfe, 0xf2, 0xf5, 0xf6, 0xf3, 0xfe, 0xfd, 0xfd, 0xdf, 0xdf, 0xde, 0xde, 0xdf, 0xe4, 0xef, 0xe2, 0xed, 0xe2, 0xed, 0xed, 0xe2, 0xed, 0xe3, 0xed, 0xe3, 0xed, 0xe3, 0xed, 0xe3, 0xed, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xed, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xfd, 0xe2, 0xe3, 0xe2, 0xe1, 0xe1, 0xe6, 0xe4, 0xde, 0xff, 0xfe, 0x4a, 0x4c, 0x48, 0x3d, 0x37, 0x26, 0x2e, 0x36, 0x39, 0x36, 0x36, 0x36, 0x2d, 0x36, 0x34, 0x2f, 0x26, 0x14, 0x14, 0x21, 0x31, 0x35, 0x35, 0x25, 0x9a, 0x21, 0x94, 0x26, 0x26, 0x23, 0x1f, 0x1f, 0x19, 0x98, 0x47, 0x4a, 0xfd, 0xe5, 0xe0, 0xe0, 0xe0, 0xed, 0xee, 0xf0, 0xee, 0xee, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xf5, 0xdc, 0xcf, 0xc7, 0xc9, 0xcb, 0xd9, 0xc0, 0xcd, 0xd6, 0xed, 0xf0, 0xe3, 0xed, 0xde, 0xde, 0xde, 0xe0, 0xd3, 0xaf, 0xaf, 0xb4, 0xb0, 0xc0, 0xeb, 0x89, 0x89, 0x1a, 0x70, 0x7d, 0x9d, 0x74, 0x91, 0x7e, 0x6c, 0x7e, 0x92, 0x84, 0x5f, 0x71, 0x00, 0x5a, 0xa6, 0xa5, 0xa6, 0xa5, 0xa6, 0xa0, 0xa6, 0xa0, 0xa0, 0xa0, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x63, 0x67, 0x63, 0x67, 0x05, 0x65, 0x05, 0x05, 0x05, 0x05, 0x05, 0x66, 0x05, 0x66, 0x67, 0x66, 0x05, 0x05, 0x61, 0x61, 0x61, 0x67, 0x67, 0x63, 0x63, 0xa0, 0x63, 0xa0, 0x59, 0x61, 0x63, 0x63, 0x61, 0x5e, 0x53, 0x59, 0x5e, 0x5e, 0x63, 0x06, 0x0c, 0x12, 0xf9, 0xea, 0xfb, 0xdf, 0xf6, 0xf6, 0xf3, 0xf2, 0xf2, 0xf1, 0xef, 0xee, 0xef, 0xe2, 0xe2, 0xdf, 0xdf, 0xe4, 0xe4, 0xe6, 0xef, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xdf, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xfd, 0xef, 0xe2, 0xe3, 0xe3, 0xe1, 0xe2, 0xe2, 0xff, 0xff, 0x4a, 0x4b, 0x49, 0x41, 0x3b, 0x31, 0x2e, 0x2f, 0x26, 0x2f, 0x2f, 0x2d, 0x36, 0x2f, 0x2f, 0x34, 0x2f, 0x34, 0x34, 0x25, 0x34, 0x37, 0x31, 0x21, 0x21, 0x97, 0x26, 0x97, 0x26, 0x26, 0x26, 0x1f, 0x1f, 0x97, 0x18, 0x9d, 0x4b, 0xff, 0xe6, 0xe0, 0xe0, 0xe0, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xfd, 0xed, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xed, 0xdf, 0xf3, 0xdc, 0xd0, 0xd9, 0xc7, 0xd9, 0xd0, 0xd4, 0xf0, 0xed, 0xed, 0xde, 0xed, 0xde, 0xf0, 0xe0, 0xdc, 0xc1, 0xad, 0xb3, 0xb1, 0xb1, 0xcb, 0xea, 0x0a, 0x84, 0x1d, 0x08, 0x74, 0x98, 0x72, 0x95, 0x83, 0x62, 0x6c, 0x8d, 0x84, 0x52, 0x7b, 0x71, 0xa0, 0x06, 0xa0, 0xa6, 0xa6, 0xa5, 0xa6, 0xa5, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x67, 0xa0, 0xa5, 0xa0, 0xa5, 0x63, 0xa0, 0x63, 0x63, 0x63, 0x05, 0x05, 0x66, 0x05, 0x66, 0x66, 0x05, 0x05, 0x05, 0x67, 0x67, 0x67, 0x05, 0x67, 0x61, 0x63, 0x63, 0x63, 0x5e, 0x59, 0x59, 0x61, 0x61, 0x5e, 0x5e, 0x63, 0x07, 0x0a, 0xf7, 0x12, 0xfa, 0xeb, 0xfb, 0xde, 0xf2, 0xf6, 0xf5, 0xf3, 0xe6, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xdf, 0xdd, 0xf2, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xe2, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xfd, 0xef, 0xee, 0xef, 0xe3, 0xe1, 0xe1, 0xe2, 0xfd, 0x4a, 0x4b, 0x49, 0x48, 0x3d, 0x32, 0x25, 0x2f, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x9a, 0x34, 0x34, 0x34, 0x26, 0x2f, 0x34, 0x35, 0x31, 0x21, 0x1f, 0x21, 0x26, 0x97, 0x1f, 0x97, 0x26, 0x1f, 0x97, 0x97, 0x97, 0x19, 0x22, 0x47, 0x4b, 0xff, 0xe8, 0xde, 0xe7, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xde, 0xed, 0xe1, 0xdc, 0xd4, 0xd2, 0xd4, 0xdc, 0xed, 0xe0, 0xf0, 0xdf, 0xde, 0xe0, 0xde, 0xe0, 0xe7, 0xd3, 0xac, 0xb1, 0xb2, 0xb1, 0xb1, 0xcf, 0xcd, 0x06, 0x76, 0x92, 0x69, 0x72, 0x85, 0x73, 0x91, 0x8e, 0x7e, 0x69, 0x6c, 0x69, 0x5c, 0x71, 0x71, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xa0, 0xa0, 0xa5, 0xa0, 0x63, 0xa0, 0x63, 0x63, 0x63, 0x05, 0x05, 0x05, 0x67, 0x67, 0x63, 0x63, 0x61, 0x61, 0x63, 0x5e, 0x5b, 0x59, 0x57, 0x59, 0x5e, 0x67, 0x00, 0x09, 0x0c, 0x12, 0xf9, 0xea, 0xeb, 0xfb, 0xff, 0xf1, 0xf4, 0xf5, 0xf5, 0xfe, 0xfe, 0xe2, 0xe2, 0xdf, 0xdf, 0xef, 0xe6, 0xe2, 0xdf, 0xe4, 0xe2, 0xdf, 0xdf, 0xed, 0xef, 0xf1, 0xed, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe3, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xee, 0xef, 0xe4, 0xe1, 0xe3, 0xe1, 0xe6, 0x4c, 0x4b, 0x49, 0x3d, 0x32, 0x25, 0x2e, 0x36, 0x35, 0x34, 0x34, 0x9a, 0x9a, 0x9a, 0x97, 0x97, 0x97, 0x97, 0x9a, 0x34, 0x34, 0x26, 0x3a, 0x2a, 0x97, 0x1c, 0x97, 0x9a, 0x94, 0x94, 0x97, 0x94, 0x94, 0x94, 0x97, 0x94, 0x1b, 0x41, 0x4a, 0x4a, 0xee, 0xf2, 0xed, 0xe3, 0xed, 0xf0, 0xee, 0xee, 0xfd, 0xdf, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xed, 0xfd, 0xf0, 0xdf, 0xdf, 0xe5, 0xe0, 0xe5, 0xe0, 0xe7, 0xe0, 0xe3, 0xe3, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xc3, 0xac, 0xb9, 0xb1, 0xb1, 0xb8, 0xd4, 0xdb, 0x09, 0x6a, 0x80, 0x76, 0x6d, 0x6f, 0x70, 0x78, 0x8e, 0x7e, 0x70, 0x62, 0x62, 0x6a, 0x6d, 0x67, 0x06, 0xa6, 0x67, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0xa0, 0x67, 0xa0, 0x67, 0x63, 0xa0, 0x67, 0xa0, 0x63, 0xa0, 0xa6, 0xa0, 0xa5, 0xa5, 0x5e, 0xa5, 0xa1, 0x59, 0xa1, 0xa1, 0x59, 0x5e, 0x06, 0x07, 0x09, 0xf7, 0x12, 0xf9, 0xfa, 0xda, 0xeb, 0xec, 0xfc, 0xef, 0x4c, 0xf3, 0x4c, 0xf3, 0xf1, 0xfe, 0xfd, 0xde, 0xde, 0xde, 0xfd, 0xdf, 0xe3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xed, 0xe3, 0xdf, 0xed, 0xe4, 0xe3, 0xe2, 0xe3, 0xdf, 0xdf, 0xe2, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xed, 0xee, 0xed, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xed, 0xfd, 0xdf, 0xfd, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xf1, 0xe2, 0xef, 0xe4, 0xe2, 0xfe, 0xfe, 0x49, 0x44, 0x30, 0x27, 0x2e, 0x3a, 0x39, 0x34, 0x26, 0x94, 0x8f, 0x8f, 0x8a, 0x8a, 0x86, 0x8a, 0x8a, 0x8a, 0x8f, 0x90, 0x26, 0x35, 0x9a, 0x31, 0x21, 0x94, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x1b, 0x8f, 0x19, 0x33, 0x49, 0x4a, 0x4a, 0xf0, 0xde, 0xf2, 0xed, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xe1, 0xe1, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xfd, 0xed, 0xde, 0xe0, 0xe1, 0xe5, 0xde, 0xe3, 0xed, 0xe3, 0xed, 0xe1, 0xdf, 0xe0, 0xe5, 0xd4, 0xaf, 0xb1, 0xb3, 0xb1, 0xb1, 0xc3, 0xdc, 0xe6, 0xda, 0x0a, 0x65, 0x71, 0x6d, 0x66, 0x65, 0x6a, 0x71, 0x6d, 0x68, 0x68, 0x6b, 0x07, 0xa0, 0xa6, 0x06, 0x06, 0x67, 0x67, 0x67, 0x67, 0x67, 0x05, 0x67, 0x66, 0x67, 0x67, 0x67, 0x6b, 0x67, 0x6b, 0xa0, 0xa0, 0xa0, 0x67, 0x05, 0x60, 0x05, 0x05, 0x61, 0x5b, 0xa1, 0xa4, 0xa4, 0xa5, 0xa6, 0x09, 0x0c, 0xf7, 0xf8, 0xfa, 0xda, 0xeb, 0xdb, 0xec, 0xfc, 0xde, 0xf0, 0xf2, 0xf4, 0xf4, 0xf1, 0xf1, 0xfe, 0xef, 0xfd, 0xdf, 0xef, 0xfd, 0xdf, 0xfd, 0xe2, 0xee, 0xef, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xdf, 0xe3, 0xed, 0xe3, 0xdf, 0xed, 0xe3, 0xed, 0xe3, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xfd, 0xe2, 0xdf, 0xe2, 0xe1, 0xe2, 0xe1, 0xdf, 0xe1, 0xef, 0xe2, 0xe6, 0xe2, 0xdf, 0xe3, 0xf0, 0x4a, 0x4b, 0x4b, 0x46, 0x30, 0x30, 0x2e, 0x37, 0x3e, 0x34, 0x26, 0x94, 0x8f, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x9a, 0x35, 0x35, 0x97, 0x93, 0x94, 0x93, 0x94, 0x94, 0x94, 0x94, 0x97, 0x91, 0x86, 0x99, 0x49, 0x4c, 0x4a, 0xee, 0xee, 0xed, 0xf0, 0xed, 0xed, 0xee, 0xee, 0xee, 0xdf, 0xe2, 0xdf, 0xe3, 0xed, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xed, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xef, 0xe0, 0xcf, 0xaf, 0xb1, 0xb2, 0xb1, 0xb1, 0xcf, 0xe0, 0xf2, 0xf5, 0xfb, 0x12, 0x63, 0x67, 0x5e, 0x59, 0x5e, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0xa0, 0xa5, 0xa5, 0x06, 0x67, 0x6b, 0x07, 0x07, 0x07, 0x6b, 0x6b, 0x6b, 0x07, 0x6b, 0x6b, 0x05, 0x05, 0x5b, 0x58, 0x5b, 0x53, 0x59, 0x60, 0x5d, 0x5d, 0x64, 0x66, 0x71, 0x0c, 0x12, 0xf9, 0xcd, 0xeb, 0xec, 0xdd, 0xde, 0xdf, 0xf2, 0xf3, 0xe9, 0xf5, 0xe9, 0xf3, 0xf3, 0xf2, 0xf1, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xdf, 0xe2, 0xdf, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xfd, 0xe2, 0xdf, 0xdf, 0xe2, 0xe1, 0xe3, 0xe1, 0xde, 0xe3, 0xe1, 0xdf, 0xe2, 0xed, 0xe3, 0xed, 0x4a, 0x4b, 0x48, 0x3b, 0x30, 0x2e, 0x35, 0x3e, 0x35, 0x9a, 0x1f, 0x90, 0x8f, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x90, 0x90, 0x9a, 0x97, 0x94, 0x90, 0x93, 0x94, 0x93, 0x93, 0x93, 0x97, 0x94, 0x87, 0x22, 0x47, 0x4a, 0xee, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe7, 0xd6, 0xc0, 0xac, 0xb3, 0xb3, 0xb3, 0xb1, 0xd3, 0xe8, 0xdf, 0xfe, 0x4c, 0xde, 0xeb, 0x12, 0x0a, 0x5e, 0xa4, 0xa1, 0x57, 0x04, 0x60, 0x66, 0x67, 0x60, 0x5b, 0x60, 0x66, 0x66, 0x04, 0x5b, 0x04, 0x60, 0x5b, 0x60, 0x60, 0x04, 0x05, 0x6b, 0x71, 0x07, 0x76, 0x80, 0x89, 0x89, 0x96, 0x29, 0x9c, 0x41, 0x44, 0x44, 0xfc, 0x4a, 0xe8, 0xf3, 0xe6, 0xef, 0xef, 0xf1, 0xe4, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xdf, 0xfd, 0xe2, 0xe2, 0xe1, 0xdf, 0xe6, 0xe1, 0xe2, 0xe3, 0xde, 0xe2, 0xef, 0xee, 0x4c, 0x4b, 0x41, 0x30, 0x20, 0x2e, 0x38, 0x3a, 0x2a, 0x1f, 0x8f, 0x8f, 0x97, 0x94, 0x8b, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x86, 0x8c, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x93, 0x90, 0x93, 0x93, 0x93, 0x93, 0x94, 0x93, 0x87, 0x1e, 0x47, 0x4b, 0xfd, 0xfd, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe7, 0xd2, 0xaf, 0xb1, 0xb3, 0xb3, 0xb3, 0xb4, 0xd6, 0xe8, 0xef, 0xf0, 0xee, 0xf3, 0xf6, 0xf6, 0xfc, 0xdb, 0xeb, 0xeb, 0xeb, 0xeb, 0x3c, 0x3c, 0x29, 0x96, 0x16, 0x89, 0x10, 0x89, 0x89, 0x92, 0x92, 0x92, 0x96, 0x92, 0x24, 0x2c, 0x9c, 0x3c, 0x3c, 0x3c, 0x44, 0x47, 0x49, 0x48, 0x48, 0x46, 0x48, 0x41, 0x47, 0x44, 0xff, 0xfd, 0x4c, 0xe6, 0xf1, 0xfe, 0xf1, 0xe4, 0xef, 0xef, 0xef, 0xe4, 0xf2, 0xf2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xed, 0xdf, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xfd, 0xe2, 0xe2, 0xdf, 0xe2, 0xe1, 0xe3, 0xe4, 0xde, 0xe6, 0xe4, 0xfd, 0xe4, 0x4c, 0x4c, 0x49, 0x30, 0x22, 0x99, 0x38, 0x38, 0x9a, 0x97, 0x8f, 0x8f, 0x97, 0x9a, 0x35, 0x9a, 0x97, 0x8b, 0x86, 0x8b, 0x86, 0x8b, 0x8c, 0x8b, 0x8c, 0x86, 0x8c, 0x8c, 0x8c, 0x8a, 0x8a, 0x8a, 0x90, 0x93, 0x90, 0x93, 0x93, 0x93, 0x90, 0x86, 0x95, 0x47, 0x4b, 0xff, 0x4c, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe3, 0xe0, 0xcb, 0xac, 0xb4, 0xb3, 0xb2, 0xb1, 0xc3, 0xe0, 0xe5, 0xfd, 0x4c, 0xfd, 0xfc, 0xde, 0xf0, 0xfe, 0xf5, 0xf6, 0xf6, 0xf6, 0x4c, 0x4a, 0x49, 0x46, 0x41, 0x46, 0x46, 0x48, 0x48, 0x46, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x46, 0x48, 0x46, 0x46, 0x43, 0x46, 0x43, 0x46, 0x46, 0x46, 0x46, 0x48, 0x47, 0x49, 0x4a, 0xff, 0xfe, 0xde, 0xfd, 0xfd, 0xee, 0xe2, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe4, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xee, 0xed, 0xdf, 0xe3, 0xdf, 0xe2, 0xe4, 0xdf, 0xef, 0xfe, 0xfd, 0xfe, 0x4a, 0x47, 0x22, 0x1e, 0x32, 0x38, 0x97, 0x93, 0x90, 0x90, 0x90, 0x94, 0x94, 0x97, 0x9a, 0x9a, 0x20, 0x93, 0x8b, 0x8a, 0x8c, 0x8b, 0x8c, 0x8c, 0x86, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8a, 0x8c, 0x93, 0x90, 0x94, 0x94, 0x93, 0x86, 0x95, 0x47, 0x4b, 0xfd, 0xfe, 0xde, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xd6, 0xbc, 0xb1, 0xb7, 0xb2, 0xb1, 0xb1, 0xce, 0xe5, 0xef, 0xde, 0xff, 0xf0, 0xf1, 0xf4, 0xde, 0xfd, 0xee, 0xdf, 0xde, 0xdd, 0xe1, 0x4a, 0x49, 0x3d, 0x3f, 0x42, 0x3f, 0x3e, 0x3f, 0x45, 0x43, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3f, 0x3f, 0x43, 0x45, 0x3f, 0x45, 0x45, 0x45, 0x46, 0x45, 0x46, 0x41, 0x47, 0x47, 0x4a, 0xfd, 0xfe, 0xfd, 0xee, 0xee, 0xfd, 0xde, 0xdf, 0xe2, 0xe4, 0xf1, 0xf2, 0xe4, 0xdf, 0xed, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xdf, 0xed, 0xe3, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xfe, 0xfd, 0xfd, 0xee, 0x44, 0x1d, 0x25, 0x32, 0x25, 0x90, 0x8a, 0x90, 0x90, 0x93, 0x94, 0x93, 0x90, 0x8f, 0x93, 0x93, 0x8b, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x86, 0x8c, 0x8c, 0x8c, 0x86, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x86, 0x99, 0x47, 0x4a, 0xfd, 0xf0, 0xed, 0xed, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe6, 0xd3, 0xb4, 0xb1, 0xb3, 0xb1, 0xb3, 0xb4, 0xd5, 0xe8, 0xdf, 0xee, 0xfe, 0xf5, 0xe2, 0xdd, 0xf0, 0xf0, 0xf0, 0xe2, 0xe1, 0xe0, 0xe6, 0x4c, 0x47, 0x3f, 0x3e, 0x40, 0x42, 0x42, 0x3f, 0x42, 0x45, 0x45, 0x45, 0x42, 0x3f, 0x42, 0x45, 0x45, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x45, 0x46, 0x43, 0x46, 0x47, 0x4a, 0x4a, 0xfd, 0xfe, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xdf, 0xed, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xdf, 0xed, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xed, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xdf, 0xfd, 0xf1, 0xfe, 0xff, 0xfe, 0xee, 0x3c, 0x27, 0x2e, 0x21, 0x8f, 0x94, 0x94, 0x90, 0x93, 0x93, 0x90, 0x90, 0x90, 0x90, 0x8b, 0x90, 0x8b, 0x8a, 0x8b, 0x8c, 0x8b, 0x86, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8b, 0x90, 0x90, 0x8a, 0x17, 0x99, 0x44, 0x4c, 0xff, 0xe6, 0xdf, 0xed, 0xf0, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xef, 0xe7, 0xd2, 0xb1, 0xb3, 0xb7, 0xb1, 0xb4, 0xc1, 0xdc, 0xe7, 0xde, 0xfe, 0xf0, 0xff, 0xde, 0xe8, 0xed, 0xed, 0xf0, 0xf2, 0xe1, 0xe0, 0xdf, 0xfe, 0x48, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x42, 0x42, 0x42, 0x45, 0x42, 0x45, 0x45, 0x42, 0x42, 0x42, 0x42, 0x40, 0x42, 0x42, 0x45, 0x45, 0x43, 0x46, 0x47, 0x49, 0x4a, 0xfd, 0xfd, 0xdf, 0xdf, 0xdf, 0xe3, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xed, 0xed, 0xed, 0xed, 0xe3, 0xe2, 0xe2, 0xe2, 0xdf, 0xfe, 0xfe, 0xfd, 0x4c, 0xee, 0x44, 0x30, 0x35, 0x34, 0x34, 0x26, 0x1f, 0x97, 0x94, 0x93, 0x90, 0x8a, 0x8b, 0x93, 0x8b, 0x8b, 0x8c, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x90, 0x8b, 0x8f, 0x8a, 0x17, 0x99, 0x49, 0xff, 0xfd, 0xe6, 0xde, 0xed, 0xf0, 0xee, 0xed, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xf1, 0xe3, 0xdf, 0xe2, 0xf1, 0xe2, 0xcf, 0xac, 0xb1, 0xb4, 0xb4, 0xb1, 0xcf, 0xe7, 0xe1, 0xf0, 0xee, 0xee, 0xf1, 0xe2, 0xe3, 0xed, 0xf0, 0xed, 0xed, 0xe3, 0xe0, 0xe1, 0xfe, 0x49, 0x43, 0x42, 0x40, 0x40, 0x40, 0x40, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x43, 0x41, 0x47, 0x4a, 0xff, 0xfe, 0xdf, 0xe1, 0xe3, 0xe1, 0xe1, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xed, 0xed, 0xed, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xee, 0xfe, 0xee, 0xfd, 0xfd, 0x4b, 0x3b, 0x3e, 0x3e, 0x3e, 0x3e, 0x3a, 0x34, 0x9a, 0x1c, 0x8f, 0x8a, 0x90, 0x8b, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 0x8b, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x90, 0x8a, 0x19, 0x33, 0x49, 0x4a, 0xfd, 0xe1, 0xe1, 0xe1, 0xee, 0x4a, 0xf0, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe4, 0xef, 0xde, 0xef, 0xe4, 0xe4, 0xcf, 0xb4, 0xb4, 0xb9, 0xaf, 0xb8, 0xd5, 0xe7, 0xe3, 0xe2, 0xfe, 0xfd, 0xee, 0xe3, 0xe3, 0xed, 0xed, 0xf0, 0xed, 0xe3, 0xe1, 0xe1, 0xee, 0x4b, 0x48, 0x3f, 0x3e, 0x40, 0x40, 0x40, 0x42, 0x42, 0x40, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3f, 0x45, 0x3d, 0x46, 0x47, 0x49, 0xff, 0xfe, 0xdf, 0xe1, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xe3, 0xe2, 0xe2, 0xe2, 0xef, 0xee, 0xfd, 0xee, 0xfd, 0x4a, 0x41, 0x3f, 0x3f, 0x3f, 0x3e, 0x3e, 0x42, 0x3e, 0x35, 0x1c, 0x8f, 0x8a, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8b, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8b, 0x8a, 0x86, 0x91, 0x3d, 0x4b, 0x4a, 0xfd, 0xe1, 0xe1, 0xe0, 0xee, 0xee, 0x4a, 0xee, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xef, 0xdf, 0xef, 0xf1, 0xe4, 0xd0, 0xaf, 0xaf, 0xb5, 0xb4, 0xca, 0xe0, 0xe7, 0xe3, 0xfd, 0xef, 0xfd, 0xef, 0xe3, 0xed, 0xe3, 0xf0, 0xed, 0xef, 0xed, 0xe3, 0xe3, 0xfd, 0x4a, 0x48, 0x43, 0x37, 0x3e, 0x42, 0x40, 0x3e, 0x40, 0x3e, 0x40, 0x40, 0x42, 0x40, 0x40, 0x3e, 0x40, 0x3e, 0x42, 0x3f, 0x42, 0x43, 0x3d, 0x41, 0x47, 0x49, 0xfe, 0xfd, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe3, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xed, 0xe2, 0xdf, 0xdf, 0xe2, 0xdf, 0xef, 0xe2, 0xfd, 0xfe, 0xfd, 0xfd, 0x4a, 0x49, 0x46, 0x3b, 0x3f, 0x3f, 0x3f, 0x3e, 0x3e, 0x3f, 0x38, 0x21, 0x8a, 0x90, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8c, 0x8b, 0x8b, 0x8b, 0x8a, 0x90, 0x8a, 0x90, 0x90, 0x8c, 0x86, 0x1e, 0x41, 0x4b, 0x4b, 0xff, 0xed, 0xe0, 0xe0, 0xe1, 0xdf, 0xee, 0x4a, 0xee, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xd4, 0xc0, 0xb5, 0xb8, 0xcd, 0xdc, 0xe9, 0xe1, 0xe2, 0xe2, 0xfd, 0xef, 0xe2, 0xe3, 0xe3, 0xe2, 0xe2, 0xef, 0xed, 0xef, 0xed, 0xe2, 0xee, 0xfe, 0x4a, 0x47, 0x3d, 0x3b, 0x3e, 0x3e, 0x42, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x3e, 0x42, 0x3f, 0x3f, 0x3d, 0x41, 0x47, 0x49, 0x4a, 0xfe, 0xe3, 0xe1, 0xed, 0xe1, 0xed, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xee, 0xdf, 0xe3, 0xe2, 0xe1, 0xe2, 0xe1, 0xe2, 0xe2, 0xe2, 0xfd, 0xfd, 0xee, 0x4b, 0x47, 0x41, 0x3b, 0x43, 0x3f, 0x3f, 0x3f, 0x42, 0x3f, 0x3f, 0x2a, 0x8f, 0x8f, 0x8c, 0x90, 0x8c, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8c, 0x8a, 0x8a, 0x8c, 0x8f, 0x8c, 0x87, 0x87, 0x99, 0x47, 0x4b, 0x4a, 0xff, 0xf0, 0xe3, 0xe3, 0xe1, 0xe3, 0xee, 0xfd, 0xee, 0xee, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe7, 0xd6, 0xd4, 0xd6, 0xe0, 0xe9, 0xde, 0xdd, 0xe4, 0xfd, 0xe1, 0xef, 0xe2, 0xe3, 0xe3, 0xe2, 0xef, 0xe2, 0xee, 0xf0, 0xf0, 0xf0, 0xee, 0xdf, 0xfd, 0xfe, 0x47, 0x3d, 0x37, 0x3e, 0x3e, 0x3e, 0x40, 0x3e, 0x40, 0x40, 0x40, 0x40, 0x42, 0x3e, 0x3e, 0x3b, 0x3f, 0x3b, 0x41, 0x47, 0x49, 0xf0, 0xfd, 0xe1, 0xe1, 0xe0, 0xe3, 0xed, 0xed, 0xed, 0xe3, 0xe1, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xdf, 0xe3, 0xdf, 0xe1, 0xdf, 0xe3, 0xe2, 0xe2, 0xdf, 0xee, 0xff, 0x4b, 0x49, 0x41, 0x3b, 0x3d, 0x3f, 0x3f, 0x3f, 0x3e, 0x45, 0x3f, 0x2a, 0x8f, 0x86, 0x8a, 0x8c, 0x90, 0x8c, 0x8a, 0x8c, 0x8c, 0x86, 0x8c, 0x8c, 0x87, 0x87, 0x87, 0x15, 0x9d, 0x49, 0x4b, 0x4a, 0xff, 0xef, 0xe4, 0xe3, 0xdf, 0xe2, 0xfd, 0xdf, 0xdf, 0xe1, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xed, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe4, 0xdf, 0xe1, 0xe8, 0xe9, 0xed, 0xe0, 0xde, 0xe6, 0xdf, 0xe6, 0xdf, 0xe2, 0xe3, 0xe3, 0xed, 0xe2, 0xfd, 0xe2, 0xef, 0xee, 0xf0, 0xf0, 0xed, 0xe0, 0xe0, 0xe1, 0xff, 0x48, 0x43, 0x3f, 0x3b, 0x3f, 0x37, 0x3e, 0x3e, 0x42, 0x3e, 0x3e, 0x3b, 0x3e, 0x3d, 0x3d, 0x41, 0x41, 0x47, 0x49, 0x4a, 0xfe, 0xdf, 0xe0, 0xe0, 0xe0, 0xed, 0xed, 0xee, 0xed, 0xe3, 0xe2, 0xe1, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xfd, 0xdf, 0xdf, 0xe2, 0xe1, 0xe1, 0xdf, 0xe1, 0xe1, 0xe3, 0xe2, 0xe2, 0xdf, 0xee, 0xf0, 0x4a, 0x47, 0x41, 0x3d, 0x3b, 0x3e, 0x3f, 0x3e, 0x37, 0x3e, 0x45, 0x37, 0x1c, 0x8f, 0x86, 0x8a, 0x8b, 0x8c, 0x8b, 0x8c, 0x8c, 0x8a, 0x8d, 0x81, 0x8d, 0x99, 0x47, 0x4c, 0x4a, 0xff, 0xdf, 0xe7, 0xe5, 0xde, 0xdf, 0xfd, 0xfd, 0xfd, 0xe1, 0xe0, 0xe0, 0xe0, 0xe3, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe4, 0xef, 0xe2, 0xef, 0xe3, 0xe8, 0xed, 0xde, 0xe4, 0xed, 0xe9, 0xe4, 0xdf, 0xdf, 0xe4, 0xdf, 0xe3, 0xed, 0xe3, 0xfd, 0xe2, 0xdf, 0xee, 0xee, 0xf0, 0xf0, 0xee, 0xe5, 0xdc, 0xdd, 0xfd, 0x4b, 0x48, 0x48, 0x46, 0x41, 0x3d, 0x3d, 0x3b, 0x3d, 0x3d, 0x43, 0x3d, 0x41, 0x41, 0x47, 0x48, 0x49, 0x4b, 0x4a, 0xee, 0xfd, 0xde, 0xe1, 0xe3, 0xe3, 0xed, 0xed, 0xf0, 0xed, 0xee, 0xe2, 0xdf, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xe2, 0xdf, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xfd, 0xdf, 0xed, 0xdf, 0xee, 0xdf, 0xef, 0xed, 0xe2, 0xed, 0xdf, 0xe2, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xed, 0xdf, 0xe2, 0xed, 0xe2, 0xe2, 0xed, 0xe2, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xfd, 0xe2, 0xfd, 0xe2, 0xdf, 0xdf, 0xe2, 0xdf, 0xe1, 0xdf, 0xe3, 0xe2, 0xe2, 0xe2, 0xed, 0xe7, 0xde, 0xee, 0x4b, 0x4b, 0x46, 0x46, 0x41, 0x43, 0x3b, 0x3d, 0x3b, 0x3b, 0x3d, 0x3d, 0x98, 0x91, 0x87, 0x87, 0x87, 0x83, 0x87, 0x88, 0x8d, 0x95, 0x9d, 0x47, 0x4b, 0x4b, 0xff, 0xf0, 0xf2, 0xed, 0xe0, 0xe1, 0xe6, 0xef, 0xfd, 0xfd, 0xfd, 0xfd, 0xe0, 0xe0, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xfd, 0xe2, 0xee, 0xef, 0xee, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xef, 0xfe, 0xef, 0xef, 0xf1, 0xee, 0xf0, 0xef, 0xe2, 0xe4, 0xe4, 0xee, 0xfe, 0xf0, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4c, 0x4b, 0x4c, 0x4b, 0x4c, 0x4c, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe4, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xf1, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xf0, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xee, 0xef, 0xef, 0xf1, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf1, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf1, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xe2, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xee, 0xfe, 0xf0, 0x4c, 0x4a, 0x4b, 0x4a, 0x4b, 0x4a, 0x49, 0x4a, 0x49, 0x49, 0x4a, 0x47, 0x44, 0x3c, 0x9c, 0x9d, 0x9c, 0x44, 0x44, 0x49, 0x4c, 0x4c, 0x4a, 0xfd, 0xf0, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xfd, 0xfd, 0xee, 0xfd, 0xe2, 0xe2, 0xe3, 0xe2, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xf1, 0xf1, 0xe2, 0xee, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xed, 0xfd, 0xed, 0xfd, 0xe2, 0xe2, 0xef, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x4c, 0xf4, 0x4c, 0xf4, 0x4c, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0x4c, 0xf4, 0x4c, 0xf4, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b, 0x4b, 0x4c, 0x4c, 0xfe, 0xfe, 0xef, 0xef, 0xfd, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xe2, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xf1, 0xf1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xed, 0xdf, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xf0, 0xef, 0xf1, 0xef, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0x4c, 0xf4, 0x4c, 0xf4, 0x4c, 0xf4, 0x4c, 0xf4, 0xf4, 0x4c, 0xf4, 0x4c, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xe8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x4c, 0xf0, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4a, 0x4c, 0x4c, 0x4c, 0x4b, 0x4c, 0x4a, 0xfe, 0x4a, 0xfd, 0xfd, 0xdf, 0xdf, 0xdf, 0xed, 0xfd, 0xed, 0xe2, 0xed, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xfd, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xee, 0xef, 0xef, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xef, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe6, 0xf1, 0xe6, 0xe4, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0x4c, 0xf4, 0x4c, 0xf4, 0xf4, 0xf3, 0xfe, 0x4c, 0xf1, 0x4c, 0x4c, 0x4c, 0xf3, 0xf4, 0xf4, 0xe9, 0xe8, 0xe8, 0xe4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xef, 0xef, 0xf1, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xfd, 0xed, 0xdf, 0xee, 0xdf, 0xee, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xe8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xe9, 0xf3, 0xe9, 0xf3, 0xe9, 0xf3, 0xe8, 0xf3, 0xe8, 0xf3, 0xe9, 0xf3, 0xe9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfe, 0xf3, 0xf0, 0xf3, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xe8, 0xe8, 0xe8, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xef, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xef, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xf3, 0xe8, 0xf4, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xe8, 0xe9, 0xe9, 0xf5, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xe7, 0xf2, 0xe8, 0xe8, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xf2, 0xf2, 0xe4, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xe9, 0xe8, 0xe9, 0xe8, 0xe9, 0xe8, 0xe9, 0xe8, 0xf3, 0xe8, 0xf3, 0xe8, 0xf3, 0xe8, 0xe8, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xe7, 0xe8, 0xe7, 0xf2, 0xe7, 0xf2, 0xf3, 0xf3, 0xf1, 0xf2, 0xe8, 0xf3, 0xe8, 0xe8, 0xe6, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xef, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xe8, 0xf3, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xe8, 0xe9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xef, 0xef, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xe2, 0xee, 0xe2, 0xe2, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf1, 0xe4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe3, 0xe4, 0xe4, 0xef, 0xe4, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xfe, 0xe6, 0xfe, 0xfe, 0xef, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xe2, 0xee, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xed, 0xdf, 0xee, 0xdf, 0xed, 0xfd, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xfd, 0xe2, 0xfd, 0xe2, 0xfd, 0xe2, 0xfd, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe2, 0xdf, 0xe2, 0xdf, 0xed, 0xdf, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xe2, 0xed, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe3, 0xdf, 0xe3, 0xe1, 0xe2, 0xdf, 0xfd, 0xe2, 0xed, 0xfd, 0xed, 0xfd, 0xee, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe2, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xdf, 0xee, 0xe2, 0xe2, 0xee, 0xdf, 0xed, 0xfd, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xe2, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xee, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe2, 0xe3, 0xe2, 0xe2, 0xef, 0xfd, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xfd, 0xfe, 0xfd, 0xfd, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xfd, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xe2, 0xee, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xe2, 0xed, 0xe2, 0xe2, 0xee, 0xe2, 0xfd, 0xe2, 0xfd, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xfd, 0xe2, 0xdf, 0xfd, 0xe2, 0xfd, 0xe2, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xef, 0xee, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xfd, 0xed, 0xfd, 0xe2, 0xed, 0xfd, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xe2, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xe2, 0xe2, 0xed, 0xfd, 0xed, 0xfd, 0xed, 0xfd, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xdf, 0xfd, 0xfd, 0xfd, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xed, 0xdf, 0xee, 0xdf, 0xee, 0xdf, 0xfd, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe2, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xdf, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xdf, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xdf, 0xe3, 0xe2, 0xe3, 0xe2, 0xed, 0xe2, 0xed, 0xe2, 0xee, 0xe2, 0xee, 0xed, 0xee, 0xed, 0xee, 0xe2, 0xfd, 0xe2, 0xe2, 0xe2, 0xed, 0xe3, 0xdf, 0xe3, 0xe1, 0xe2, 0xe1, 0xdf, 0xdf, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xee, 0xef, 0xef, 0xef, 0xe2, 0xee, 0xed, 0xee, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe2, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe3, 0xed, 0xe3, 0xed, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xee, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe3, 0xdf, 0xed, 0xdf, 0xe3, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xee, 0xe2, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xef, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 
-};
-
-const lv_img_dsc_t image20 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image20_map,
-};
@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE21
-#define LV_ATTRIBUTE_IMG_IMAGE21
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE21 uint8_t image21_map[] = {
-  0x94, 0xae, 0xf7, 0xff, 	/*Color of index 0*/
-  0x7a, 0x95, 0xf2, 0xff, 	/*Color of index 1*/
-  0x61, 0x7b, 0xe0, 0xff, 	/*Color of index 2*/
-  0x41, 0x60, 0xdc, 0xff, 	/*Color of index 3*/
-  0x34, 0x50, 0xe0, 0xff, 	/*Color of index 4*/
-  0x37, 0x54, 0xcc, 0xff, 	/*Color of index 5*/
-  0x2b, 0x43, 0xed, 0xff, 	/*Color of index 6*/
-  0x54, 0x5b, 0x8a, 0xff, 	/*Color of index 7*/
-  0x20, 0x3f, 0xf9, 0xff, 	/*Color of index 8*/
-  0x20, 0x41, 0xf1, 0xff, 	/*Color of index 9*/
-  0x39, 0x43, 0xdb, 0xff, 	/*Color of index 10*/
-  0x25, 0x3f, 0xdb, 0xff, 	/*Color of index 11*/
-  0x24, 0x40, 0xc5, 0xff, 	/*Color of index 12*/
-  0x2c, 0x31, 0xe7, 0xff, 	/*Color of index 13*/
-  0x3a, 0x4b, 0x7b, 0xff, 	/*Color of index 14*/
-  0x2f, 0x31, 0xd5, 0xff, 	/*Color of index 15*/
-  0x36, 0x34, 0xc3, 0xff, 	/*Color of index 16*/
-  0x11, 0x35, 0xbe, 0xff, 	/*Color of index 17*/
-  0x20, 0x2b, 0xd5, 0xff, 	/*Color of index 18*/
-  0x36, 0x33, 0xaf, 0xff, 	/*Color of index 19*/
-  0x27, 0x2a, 0xc4, 0xff, 	/*Color of index 20*/
-  0x2a, 0x23, 0xd5, 0xff, 	/*Color of index 21*/
-  0x31, 0x31, 0x9d, 0xff, 	/*Color of index 22*/
-  0x02, 0x2e, 0xb3, 0xff, 	/*Color of index 23*/
-  0x1e, 0x1c, 0xd6, 0xff, 	/*Color of index 24*/
-  0x36, 0x31, 0x86, 0xff, 	/*Color of index 25*/
-  0x24, 0x26, 0xb0, 0xff, 	/*Color of index 26*/
-  0x27, 0x2a, 0x9d, 0xff, 	/*Color of index 27*/
-  0x2f, 0x1e, 0xc1, 0xff, 	/*Color of index 28*/
-  0x24, 0x1a, 0xcb, 0xff, 	/*Color of index 29*/
-  0x1f, 0x1b, 0xbe, 0xff, 	/*Color of index 30*/
-  0x0b, 0x1e, 0xb9, 0xff, 	/*Color of index 31*/
-  0x02, 0x25, 0xa2, 0xff, 	/*Color of index 32*/
-  0x27, 0x25, 0x8b, 0xff, 	/*Color of index 33*/
-  0x05, 0x22, 0x91, 0xff, 	/*Color of index 34*/
-  0x1a, 0x1a, 0x7d, 0xff, 	/*Color of index 35*/
-  0x1a, 0x17, 0x65, 0xff, 	/*Color of index 36*/
-  0x06, 0x10, 0x60, 0xff, 	/*Color of index 37*/
-  0x13, 0x13, 0x4d, 0xff, 	/*Color of index 38*/
-  0x15, 0x14, 0x1b, 0xff, 	/*Color of index 39*/
-  0x07, 0x06, 0x4c, 0xff, 	/*Color of index 40*/
-  0x04, 0x02, 0x35, 0xff, 	/*Color of index 41*/
-  0x04, 0x02, 0x25, 0xff, 	/*Color of index 42*/
-  0x06, 0x01, 0x16, 0xff, 	/*Color of index 43*/
-  0xe8, 0xef, 0xf2, 0xff, 	/*Color of index 44*/
-  0xa8, 0xf1, 0xfc, 0xff, 	/*Color of index 45*/
-  0x94, 0xe8, 0xfa, 0xff, 	/*Color of index 46*/
-  0xae, 0xe6, 0xf1, 0xff, 	/*Color of index 47*/
-  0x86, 0xe4, 0xf8, 0xff, 	/*Color of index 48*/
-  0x7a, 0xe3, 0xf9, 0xff, 	/*Color of index 49*/
-  0x71, 0xe2, 0xfa, 0xff, 	/*Color of index 50*/
-  0x64, 0xe1, 0xfe, 0xff, 	/*Color of index 51*/
-  0x6c, 0xe0, 0xfb, 0xff, 	/*Color of index 52*/
-  0x93, 0xdb, 0xe8, 0xff, 	/*Color of index 53*/
-  0x56, 0xdb, 0xfc, 0xff, 	/*Color of index 54*/
-  0x85, 0xd1, 0xec, 0xff, 	/*Color of index 55*/
-  0x4c, 0xd2, 0xf7, 0xff, 	/*Color of index 56*/
-  0xa1, 0xcd, 0xd8, 0xff, 	/*Color of index 57*/
-  0x7b, 0xc9, 0xf2, 0xff, 	/*Color of index 58*/
-  0x63, 0xce, 0xe9, 0xff, 	/*Color of index 59*/
-  0x3e, 0xc7, 0xf5, 0xff, 	/*Color of index 60*/
-  0x3c, 0xc6, 0xea, 0xff, 	/*Color of index 61*/
-  0x7a, 0xc1, 0xdd, 0xff, 	/*Color of index 62*/
-  0x50, 0xc0, 0xe8, 0xff, 	/*Color of index 63*/
-  0x2f, 0xbe, 0xf5, 0xff, 	/*Color of index 64*/
-  0x2e, 0xbe, 0xea, 0xff, 	/*Color of index 65*/
-  0x1c, 0xbb, 0xf4, 0xff, 	/*Color of index 66*/
-  0x3e, 0xb6, 0xf8, 0xff, 	/*Color of index 67*/
-  0x15, 0xb9, 0xf1, 0xff, 	/*Color of index 68*/
-  0x22, 0xb8, 0xea, 0xff, 	/*Color of index 69*/
-  0x41, 0xb7, 0xe2, 0xff, 	/*Color of index 70*/
-  0x30, 0xb2, 0xf4, 0xff, 	/*Color of index 71*/
-  0x1a, 0xb6, 0xec, 0xff, 	/*Color of index 72*/
-  0x48, 0xac, 0xfa, 0xff, 	/*Color of index 73*/
-  0x21, 0xb1, 0xf6, 0xff, 	/*Color of index 74*/
-  0x52, 0xb6, 0xd3, 0xff, 	/*Color of index 75*/
-  0x0a, 0xb4, 0xf2, 0xff, 	/*Color of index 76*/
-  0x4a, 0xb1, 0xe6, 0xff, 	/*Color of index 77*/
-  0x13, 0xb2, 0xf1, 0xff, 	/*Color of index 78*/
-  0x1a, 0xb0, 0xf4, 0xff, 	/*Color of index 79*/
-  0x29, 0xb2, 0xe7, 0xff, 	/*Color of index 80*/
-  0x2e, 0xa9, 0xfc, 0xff, 	/*Color of index 81*/
-  0x19, 0xad, 0xf4, 0xff, 	/*Color of index 82*/
-  0x21, 0xac, 0xf3, 0xff, 	/*Color of index 83*/
-  0x3f, 0xa6, 0xfc, 0xff, 	/*Color of index 84*/
-  0x1a, 0xaa, 0xf8, 0xff, 	/*Color of index 85*/
-  0x14, 0xac, 0xf3, 0xff, 	/*Color of index 86*/
-  0x7e, 0xb1, 0xbc, 0xff, 	/*Color of index 87*/
-  0x2c, 0xaa, 0xee, 0xff, 	/*Color of index 88*/
-  0x0b, 0xab, 0xf3, 0xff, 	/*Color of index 89*/
-  0x14, 0xa8, 0xf8, 0xff, 	/*Color of index 90*/
-  0x1a, 0xab, 0xeb, 0xff, 	/*Color of index 91*/
-  0x3a, 0xa8, 0xe5, 0xff, 	/*Color of index 92*/
-  0x13, 0xa5, 0xf6, 0xff, 	/*Color of index 93*/
-  0x1c, 0xa3, 0xf5, 0xff, 	/*Color of index 94*/
-  0x44, 0xaa, 0xcb, 0xff, 	/*Color of index 95*/
-  0x4d, 0xa6, 0xd3, 0xff, 	/*Color of index 96*/
-  0x23, 0x9f, 0xf3, 0xff, 	/*Color of index 97*/
-  0x7c, 0x9e, 0xd8, 0xff, 	/*Color of index 98*/
-  0x0c, 0x9e, 0xf6, 0xff, 	/*Color of index 99*/
-  0x4c, 0xa7, 0xbd, 0xff, 	/*Color of index 100*/
-  0x35, 0x97, 0xf7, 0xff, 	/*Color of index 101*/
-  0x13, 0x9e, 0xe8, 0xff, 	/*Color of index 102*/
-  0x26, 0x9f, 0xdb, 0xff, 	/*Color of index 103*/
-  0x6e, 0x9d, 0xaf, 0xff, 	/*Color of index 104*/
-  0x31, 0x8f, 0xea, 0xff, 	/*Color of index 105*/
-  0x3b, 0x98, 0xc6, 0xff, 	/*Color of index 106*/
-  0x4e, 0x98, 0xbd, 0xff, 	/*Color of index 107*/
-  0x31, 0x83, 0xec, 0xff, 	/*Color of index 108*/
-  0x3b, 0x93, 0xb0, 0xff, 	/*Color of index 109*/
-  0x6b, 0x91, 0x9f, 0xff, 	/*Color of index 110*/
-  0x57, 0x90, 0xa3, 0xff, 	/*Color of index 111*/
-  0x18, 0x8b, 0xc7, 0xff, 	/*Color of index 112*/
-  0x39, 0x8a, 0x9b, 0xff, 	/*Color of index 113*/
-  0x2a, 0x75, 0xd8, 0xff, 	/*Color of index 114*/
-  0x64, 0x78, 0xa6, 0xff, 	/*Color of index 115*/
-  0x38, 0x7d, 0x9f, 0xff, 	/*Color of index 116*/
-  0x1c, 0x73, 0xc2, 0xff, 	/*Color of index 117*/
-  0x20, 0x78, 0xa4, 0xff, 	/*Color of index 118*/
-  0x1e, 0x68, 0xd9, 0xff, 	/*Color of index 119*/
-  0x34, 0x7c, 0x8b, 0xff, 	/*Color of index 120*/
-  0x07, 0x73, 0xb4, 0xff, 	/*Color of index 121*/
-  0x52, 0x78, 0x85, 0xff, 	/*Color of index 122*/
-  0x28, 0x6c, 0x89, 0xff, 	/*Color of index 123*/
-  0x3b, 0x6b, 0x72, 0xff, 	/*Color of index 124*/
-  0x14, 0x55, 0xc3, 0xff, 	/*Color of index 125*/
-  0x23, 0x68, 0x73, 0xff, 	/*Color of index 126*/
-  0x09, 0x5a, 0xa3, 0xff, 	/*Color of index 127*/
-  0x1d, 0x5a, 0x72, 0xff, 	/*Color of index 128*/
-  0x29, 0x58, 0x5e, 0xff, 	/*Color of index 129*/
-  0x06, 0x50, 0x83, 0xff, 	/*Color of index 130*/
-  0x14, 0x4d, 0x5e, 0xff, 	/*Color of index 131*/
-  0x09, 0x37, 0xa2, 0xff, 	/*Color of index 132*/
-  0x27, 0x39, 0x5a, 0xff, 	/*Color of index 133*/
-  0x04, 0x2f, 0x78, 0xff, 	/*Color of index 134*/
-  0x0e, 0x37, 0x4a, 0xff, 	/*Color of index 135*/
-  0x0e, 0x2c, 0x33, 0xff, 	/*Color of index 136*/
-  0x08, 0x23, 0x2f, 0xff, 	/*Color of index 137*/
-  0x05, 0x0e, 0x14, 0xff, 	/*Color of index 138*/
-  0x01, 0x07, 0x0a, 0xff, 	/*Color of index 139*/
-  0x95, 0xa5, 0xa4, 0xff, 	/*Color of index 140*/
-  0x74, 0x8a, 0x89, 0xff, 	/*Color of index 141*/
-  0x25, 0x4d, 0x4b, 0xff, 	/*Color of index 142*/
-  0x0f, 0x45, 0x47, 0xff, 	/*Color of index 143*/
-  0x09, 0x35, 0x33, 0xff, 	/*Color of index 144*/
-  0x04, 0x26, 0x20, 0xff, 	/*Color of index 145*/
-  0x1f, 0x40, 0x2e, 0xff, 	/*Color of index 146*/
-  0x14, 0x2d, 0x15, 0xff, 	/*Color of index 147*/
-  0x05, 0x1f, 0x10, 0xff, 	/*Color of index 148*/
-  0xfc, 0xfd, 0xfb, 0xff, 	/*Color of index 149*/
-  0xb4, 0xb8, 0xad, 0xff, 	/*Color of index 150*/
-  0x41, 0x50, 0x2c, 0xff, 	/*Color of index 151*/
-  0x23, 0x36, 0x1e, 0xff, 	/*Color of index 152*/
-  0x13, 0x14, 0x12, 0xff, 	/*Color of index 153*/
-  0xf7, 0xed, 0xb3, 0xff, 	/*Color of index 154*/
-  0xf7, 0xed, 0x9c, 0xff, 	/*Color of index 155*/
-  0xf6, 0xe9, 0x87, 0xff, 	/*Color of index 156*/
-  0xd7, 0xd2, 0xa4, 0xff, 	/*Color of index 157*/
-  0xd6, 0xd0, 0x83, 0xff, 	/*Color of index 158*/
-  0xea, 0xd4, 0x6d, 0xff, 	/*Color of index 159*/
-  0xd9, 0xbd, 0x70, 0xff, 	/*Color of index 160*/
-  0xe1, 0xbb, 0x5f, 0xff, 	/*Color of index 161*/
-  0xdf, 0xc2, 0x46, 0xff, 	/*Color of index 162*/
-  0xc2, 0xb5, 0x7b, 0xff, 	/*Color of index 163*/
-  0xdb, 0xbc, 0x53, 0xff, 	/*Color of index 164*/
-  0xd8, 0xb9, 0x5c, 0xff, 	/*Color of index 165*/
-  0xc8, 0xb4, 0x62, 0xff, 	/*Color of index 166*/
-  0xd7, 0xb4, 0x5a, 0xff, 	/*Color of index 167*/
-  0xdd, 0xbd, 0x38, 0xff, 	/*Color of index 168*/
-  0xd3, 0xb2, 0x4f, 0xff, 	/*Color of index 169*/
-  0xc9, 0xb3, 0x4f, 0xff, 	/*Color of index 170*/
-  0xd1, 0xb4, 0x43, 0xff, 	/*Color of index 171*/
-  0xaa, 0xa4, 0x7e, 0xff, 	/*Color of index 172*/
-  0xdb, 0xaf, 0x46, 0xff, 	/*Color of index 173*/
-  0xc5, 0xa8, 0x61, 0xff, 	/*Color of index 174*/
-  0xd2, 0xac, 0x4c, 0xff, 	/*Color of index 175*/
-  0xd7, 0xaf, 0x39, 0xff, 	/*Color of index 176*/
-  0xca, 0xa9, 0x4c, 0xff, 	/*Color of index 177*/
-  0xd1, 0xab, 0x42, 0xff, 	/*Color of index 178*/
-  0xbe, 0xae, 0x38, 0xff, 	/*Color of index 179*/
-  0xca, 0xa8, 0x44, 0xff, 	/*Color of index 180*/
-  0xae, 0x9f, 0x66, 0xff, 	/*Color of index 181*/
-  0xb5, 0xa1, 0x55, 0xff, 	/*Color of index 182*/
-  0xb9, 0x9f, 0x47, 0xff, 	/*Color of index 183*/
-  0xcd, 0xa2, 0x35, 0xff, 	/*Color of index 184*/
-  0xb8, 0x9a, 0x39, 0xff, 	/*Color of index 185*/
-  0x9d, 0x8f, 0x62, 0xff, 	/*Color of index 186*/
-  0x88, 0x8e, 0x5c, 0xff, 	/*Color of index 187*/
-  0xa5, 0x8e, 0x4a, 0xff, 	/*Color of index 188*/
-  0xb9, 0x9b, 0x10, 0xff, 	/*Color of index 189*/
-  0xb0, 0x90, 0x33, 0xff, 	/*Color of index 190*/
-  0x95, 0x84, 0x4b, 0xff, 	/*Color of index 191*/
-  0xa2, 0x87, 0x37, 0xff, 	/*Color of index 192*/
-  0xb0, 0x8a, 0x26, 0xff, 	/*Color of index 193*/
-  0xab, 0x85, 0x29, 0xff, 	/*Color of index 194*/
-  0xb5, 0x88, 0x12, 0xff, 	/*Color of index 195*/
-  0x87, 0x7b, 0x4b, 0xff, 	/*Color of index 196*/
-  0xac, 0x83, 0x22, 0xff, 	/*Color of index 197*/
-  0xa5, 0x80, 0x28, 0xff, 	/*Color of index 198*/
-  0xa8, 0x85, 0x0b, 0xff, 	/*Color of index 199*/
-  0x92, 0x7a, 0x36, 0xff, 	/*Color of index 200*/
-  0x99, 0x7d, 0x27, 0xff, 	/*Color of index 201*/
-  0x76, 0x73, 0x48, 0xff, 	/*Color of index 202*/
-  0x9a, 0x7b, 0x13, 0xff, 	/*Color of index 203*/
-  0x7f, 0x70, 0x39, 0xff, 	/*Color of index 204*/
-  0x86, 0x70, 0x24, 0xff, 	/*Color of index 205*/
-  0x64, 0x68, 0x43, 0xff, 	/*Color of index 206*/
-  0x93, 0x71, 0x10, 0xff, 	/*Color of index 207*/
-  0x73, 0x66, 0x32, 0xff, 	/*Color of index 208*/
-  0x82, 0x68, 0x16, 0xff, 	/*Color of index 209*/
-  0x5e, 0x5e, 0x32, 0xff, 	/*Color of index 210*/
-  0x86, 0x64, 0x08, 0xff, 	/*Color of index 211*/
-  0x65, 0x57, 0x2a, 0xff, 	/*Color of index 212*/
-  0x39, 0x3f, 0x18, 0xff, 	/*Color of index 213*/
-  0x1a, 0x18, 0x10, 0xff, 	/*Color of index 214*/
-  0x0c, 0x0c, 0x05, 0xff, 	/*Color of index 215*/
-  0xdb, 0xd8, 0xd3, 0xff, 	/*Color of index 216*/
-  0xda, 0xb0, 0x53, 0xff, 	/*Color of index 217*/
-  0x84, 0x7a, 0x76, 0xff, 	/*Color of index 218*/
-  0xb3, 0x83, 0x25, 0xff, 	/*Color of index 219*/
-  0x83, 0x74, 0x62, 0xff, 	/*Color of index 220*/
-  0xae, 0x7e, 0x30, 0xff, 	/*Color of index 221*/
-  0xa9, 0x7e, 0x1e, 0xff, 	/*Color of index 222*/
-  0x79, 0x6c, 0x64, 0xff, 	/*Color of index 223*/
-  0x5d, 0x54, 0x46, 0xff, 	/*Color of index 224*/
-  0x7e, 0x57, 0x14, 0xff, 	/*Color of index 225*/
-  0x7c, 0x58, 0x07, 0xff, 	/*Color of index 226*/
-  0x5a, 0x4b, 0x28, 0xff, 	/*Color of index 227*/
-  0x69, 0x4c, 0x16, 0xff, 	/*Color of index 228*/
-  0x71, 0x4d, 0x05, 0xff, 	/*Color of index 229*/
-  0x53, 0x40, 0x2b, 0xff, 	/*Color of index 230*/
-  0x4a, 0x38, 0x2e, 0xff, 	/*Color of index 231*/
-  0x53, 0x3e, 0x14, 0xff, 	/*Color of index 232*/
-  0x49, 0x3a, 0x23, 0xff, 	/*Color of index 233*/
-  0x48, 0x34, 0x2f, 0xff, 	/*Color of index 234*/
-  0x43, 0x31, 0x2c, 0xff, 	/*Color of index 235*/
-  0x3f, 0x32, 0x27, 0xff, 	/*Color of index 236*/
-  0x43, 0x2f, 0x24, 0xff, 	/*Color of index 237*/
-  0x41, 0x31, 0x19, 0xff, 	/*Color of index 238*/
-  0x3b, 0x29, 0x25, 0xff, 	/*Color of index 239*/
-  0x41, 0x30, 0x0a, 0xff, 	/*Color of index 240*/
-  0x30, 0x24, 0x18, 0xff, 	/*Color of index 241*/
-  0x2f, 0x1e, 0x18, 0xff, 	/*Color of index 242*/
-  0x25, 0x19, 0x15, 0xff, 	/*Color of index 243*/
-  0x26, 0x16, 0x12, 0xff, 	/*Color of index 244*/
-  0x20, 0x13, 0x11, 0xff, 	/*Color of index 245*/
-  0x21, 0x14, 0x0d, 0xff, 	/*Color of index 246*/
-  0x1c, 0x11, 0x0b, 0xff, 	/*Color of index 247*/
-  0x6b, 0x63, 0x63, 0xff, 	/*Color of index 248*/
-  0x22, 0x12, 0x16, 0xff, 	/*Color of index 249*/
-  0x1f, 0x11, 0x11, 0xff, 	/*Color of index 250*/
-  0x1d, 0x0e, 0x14, 0xff, 	/*Color of index 251*/
-  0x18, 0x0b, 0x0b, 0xff, 	/*Color of index 252*/
-  0x14, 0x07, 0x09, 0xff, 	/*Color of index 253*/
-  0x11, 0x06, 0x29, 0xff, 	/*Color of index 254*/
-  0x10, 0x09, 0x16, 0xff, 	/*Color of index 255*/
-
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xfa, 0xf4, 0xfa, 0xf5, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xfa, 0xf7, 0xfa, 0xf7, 0xfa, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf7, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xf7, 0xfa, 0xf7, 0xfa, 0xf7, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xfa, 0xf7, 0xfa, 0xf7, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xfa, 0xf7, 0xfa, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf7, 0xfa, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xfa, 0xfa, 0xf7, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf5, 0xf7, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xfa, 0xfa, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf5, 0xf7, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xfa, 0xf5, 0xfa, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xd6, 0xfa, 0xd6, 0xfa, 0xd6, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfb, 0xfb, 0xfb, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xf6, 0xfa, 0xfb, 0xf9, 0xf4, 0xf3, 0xf4, 0xfa, 0xf7, 0xf4, 0xf4, 0xf9, 0xf5, 0xfa, 0xf5, 0xf9, 0xfa, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xfb, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf5, 0xf4, 0xf5, 0xf4, 0xd6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xfa, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xfa, 0xf4, 0xfe, 0xfb, 0xfb, 0xfb, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xf6, 0xf6, 0xd6, 0xf3, 0xf4, 0xfb, 0xfc, 0xfc, 0xfb, 0x99, 0xf7, 0xf7, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xfb, 0xfb, 0xfb, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xf5, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xfb, 0xf9, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf4, 0xfa, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf9, 0xfa, 0xfb, 0xf9, 0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xfa, 0xf9, 0xfa, 0xfa, 0xf5, 0x99, 0xf6, 0xfb, 0xf4, 0xf4, 0xf3, 0xf5, 0xd6, 0xf3, 0xf2, 0xf3, 0xd6, 0xf7, 0xf7, 0xfa, 0xf3, 0xf3, 0xd6, 0xd6, 0x99, 0xd6, 0x99, 0xd6, 0xd6, 0xf7, 0x99, 0xd6, 0xf3, 0xf3, 0xf3, 0xf3, 0xd6, 0xd6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf7, 0xfc, 0xf7, 0xfa, 0xf4, 0xf9, 0xf9, 0xfb, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfa, 0xf6, 0xfa, 0xf6, 0xf6, 0xf7, 0xf7, 0xd7, 0xf7, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8b, 0x8b, 0xd7, 0x8a, 0xd7, 0x8a, 0xd7, 0x8a, 0xd7, 0x8a, 0x99, 0xd7, 0x8a, 0xd7, 0x8a, 0xd7, 0xd6, 0xf6, 0x94, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf9, 0xf9, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf5, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfb, 0xf9, 0xfb, 0xfb, 0xfb, 0xf9, 0xfb, 0xf9, 0xf6, 0xf7, 0xf7, 0xf6, 0xd6, 0x99, 0xf3, 0x27, 0x99, 0x8a, 0x8b, 0x8a, 0x27, 0x89, 0x89, 0x89, 0x88, 0x87, 0x88, 0x87, 0x87, 0x87, 0x88, 0x88, 0x89, 0x89, 0x89, 0x27, 0x27, 0x8a, 0xd7, 0xd7, 0xd7, 0x94, 0x99, 0x99, 0xf7, 0x99, 0xf9, 0xf3, 0xf9, 0xfb, 0xfb, 0xfb, 0xf9, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf5, 0x99, 0xf5, 0x99, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf6, 0xf6, 0xf6, 0xfa, 0xf5, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xfb, 0xf9, 0xf6, 0xf7, 0xf3, 0xf3, 0x99, 0x8b, 0x2b, 0x8a, 0xfe, 0x89, 0x85, 0x0e, 0x7a, 0x73, 0x6e, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x73, 0x74, 0x07, 0x80, 0x85, 0x88, 0x89, 0x2a, 0xff, 0x8a, 0xff, 0x8b, 0xff, 0xfb, 0xf9, 0xf5, 0xf5, 0xf5, 0xfb, 0xf9, 0xfb, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xfa, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfa, 0xf5, 0xfa, 0xf9, 0xf9, 0xfa, 0xf4, 0x27, 0x27, 0x8a, 0x2b, 0xfe, 0x87, 0x07, 0x6f, 0x62, 0x3a, 0x00, 0x3a, 0x00, 0x00, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x62, 0x73, 0x07, 0x19, 0x88, 0x26, 0x27, 0x2b, 0xd7, 0x99, 0xf3, 0xd6, 0xf6, 0xfa, 0xf9, 0xfa, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf9, 0xd6, 0xf6, 0xd6, 0xf5, 0xf5, 0xfb, 0x27, 0xfb, 0xf9, 0xf5, 0xf6, 0xd6, 0xf4, 0xf7, 0xf7, 0xf9, 0x27, 0x2b, 0x2b, 0x89, 0x0e, 0x73, 0x62, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x05, 0x05, 0x0b, 0x04, 0x0a, 0x0b, 0x0c, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0a, 0x05, 0x04, 0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x73, 0x07, 0x0e, 0x88, 0x8a, 0xd7, 0xd7, 0xd7, 0xf7, 0xf5, 0xf6, 0xf6, 0xf6, 0xd6, 0xf6, 0xd6, 0xf6, 0xf6, 0xf3, 0xf6, 0xf6, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf5, 0xf9, 0xf9, 0xfb, 0xf9, 0xf7, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf7, 0x99, 0x2b, 0x89, 0x0e, 0x73, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05, 0x0b, 0x0c, 0x0b, 0x0b, 0x06, 0x06, 0x09, 0x09, 0x06, 0x09, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0d, 0x11, 0x0b, 0x04, 0x03, 0x02, 0x01, 0x01, 0x00, 0x62, 0x73, 0x0e, 0x88, 0xff, 0x8a, 0xd7, 0x99, 0xf6, 0xd6, 0xf6, 0xd6, 0xf3, 0xf6, 0xf6, 0xf6, 0xf7, 0xfc, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf9, 0xd6, 0xf6, 0xd6, 0xf5, 0xf9, 0xf9, 0xfb, 0xf4, 0xd7, 0xf2, 0x94, 0xf7, 0x94, 0xf2, 0x8b, 0x27, 0x86, 0x73, 0x00, 0x00, 0x01, 0x72, 0x05, 0x0c, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x09, 0x06, 0x09, 0x06, 0x0b, 0x0a, 0x0a, 0x0c, 0x05, 0x03, 0x02, 0x01, 0x00, 0x62, 0x73, 0x0e, 0x89, 0x8b, 0x99, 0x27, 0x99, 0xf7, 0xd6, 0xf6, 0xf7, 0xf6, 0xf4, 0xf4, 0xf7, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xd6, 0xf6, 0xf9, 0xf9, 0xfb, 0xf9, 0xf9, 0xf4, 0xd6, 0xf6, 0x94, 0xf1, 0x8b, 0x27, 0x0e, 0x62, 0x00, 0x01, 0x05, 0x0c, 0x0c, 0x04, 0x04, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x09, 0x09, 0x06, 0x09, 0x06, 0x06, 0x06, 0x0b, 0x04, 0x0a, 0x05, 0x0c, 0x03, 0x02, 0x01, 0x3e, 0x68, 0x07, 0x89, 0x2b, 0x2b, 0x27, 0x27, 0xf3, 0x99, 0xf5, 0xf5, 0xf4, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf6, 0xd6, 0xf5, 0xf9, 0xf9, 0xfb, 0xf6, 0xf3, 0xd6, 0xd6, 0x94, 0xff, 0xfe, 0x73, 0x01, 0x01, 0x03, 0x0c, 0x04, 0x03, 0x04, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x0a, 0x0b, 0x0a, 0x05, 0x02, 0x01, 0x00, 0x00, 0x02, 0x85, 0x2a, 0x2b, 0x2b, 0x27, 0xf3, 0xfb, 0xfd, 0xf4, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xd6, 0xd6, 0xf5, 0xf9, 0xfb, 0xf9, 0xf9, 0xf6, 0xf6, 0xd6, 0x8b, 0xfe, 0x07, 0x00, 0x02, 0x05, 0x04, 0x04, 0x04, 0x09, 0x0b, 0x04, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x06, 0x06, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0d, 0x09, 0x09, 0x06, 0x06, 0x0b, 0x0c, 0x0c, 0x03, 0x02, 0x00, 0x00, 0x73, 0x85, 0x2a, 0x2b, 0xff, 0x27, 0xf3, 0xf9, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf6, 0xd6, 0xd6, 0xf5, 0xf9, 0xf9, 0xfb, 0xf9, 0xf6, 0xf3, 0xff, 0x8a, 0x07, 0x00, 0x02, 0x0c, 0x04, 0x06, 0x09, 0x09, 0x06, 0x08, 0x08, 0x08, 0x09, 0x09, 0x06, 0x06, 0x06, 0x06, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x06, 0x06, 0x09, 0x08, 0x08, 0x0d, 0x08, 0x08, 0x08, 0x08, 0x06, 0x08, 0x09, 0x09, 0x08, 0x08, 0x06, 0x06, 0x0b, 0x05, 0x02, 0x00, 0x00, 0x73, 0x85, 0x2b, 0x8b, 0xff, 0x99, 0xfa, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xd6, 0xd6, 0xf5, 0xf9, 0xf9, 0xf9, 0xfa, 0xf4, 0xf4, 0x8a, 0x85, 0x62, 0x02, 0x0c, 0x04, 0x09, 0x06, 0x09, 0x09, 0x08, 0x06, 0x08, 0x09, 0x08, 0x09, 0x09, 0x09, 0x06, 0x06, 0x06, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x08, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x04, 0x0b, 0x0c, 0x05, 0x02, 0x00, 0x62, 0x07, 0x89, 0x2b, 0x27, 0x99, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xfa, 0xf4, 0xfa, 0xf4, 0xfa, 0xf4, 0xfa, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf4, 0xf6, 0xf6, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xd6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0x94, 0x99, 0x99, 0xf4, 0xf4, 0xf6, 0xf6, 0xd6, 0xfb, 0x89, 0x73, 0x01, 0x0c, 0x04, 0x06, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x09, 0x0a, 0x0b, 0x05, 0x01, 0x00, 0x62, 0x0e, 0x2a, 0x8a, 0xf7, 0xd6, 0xf3, 0xf6, 0xf7, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xd6, 0x27, 0x99, 0x27, 0x99, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf9, 0xf4, 0xf5, 0xf6, 0xf4, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xd6, 0xd6, 0x99, 0xd6, 0x99, 0xd6, 0xf5, 0xd6, 0xf5, 0xd6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf6, 0xf4, 0xf5, 0xf6, 0xd6, 0xf6, 0xf6, 0xf6, 0xd6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf4, 0xf5, 0xf4, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0x99, 0xf5, 0x99, 0xf5, 0x99, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x99, 0x99, 0x99, 0xf4, 0xf6, 0xf6, 0xf4, 0xf3, 0x8a, 0x07, 0x62, 0x03, 0x05, 0x08, 0x08, 0x08, 0x08, 0x09, 0x08, 0x09, 0x08, 0x08, 0x08, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x06, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x06, 0x0c, 0x05, 0x01, 0x62, 0x7b, 0x26, 0x8a, 0x8a, 0xfc, 0xf3, 0xf3, 0xfc, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0x99, 0x99, 0x99, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xd6, 0xf5, 0xd6, 0xf5, 0xd6, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf9, 0xf5, 0xf5, 0xf6, 0xf5, 0xd6, 0xf5, 0xf5, 0xd6, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xd6, 0xf5, 0xd6, 0xf5, 0xd6, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xfa, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0x99, 0xfa, 0x27, 0xf4, 0xfa, 0xf7, 0xf4, 0xf9, 0xff, 0x26, 0x62, 0x02, 0x0c, 0x04, 0x08, 0x08, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x06, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x04, 0x0c, 0x05, 0x02, 0x00, 0x6b, 0x85, 0x29, 0x27, 0x2a, 0xff, 0xf3, 0xf9, 0xf6, 0xf6, 0xf6, 0xf4, 0xf5, 0xd6, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xd6, 0xfa, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0x99, 0xf9, 0x99, 0xf5, 0x99, 0xf9, 0x99, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf9, 0xd6, 0xf5, 0xd6, 0xf5, 0x99, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xfb, 0xf9, 0xf4, 0xf7, 0xf4, 0xf9, 0xff, 0x2a, 0x07, 0x01, 0x0c, 0x04, 0x08, 0x08, 0x08, 0x08, 0x06, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x09, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x0b, 0x0b, 0x03, 0x01, 0x01, 0x0e, 0x28, 0x2a, 0x26, 0xff, 0x27, 0xfa, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0xfa, 0xf4, 0xf6, 0xf4, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf9, 0xf9, 0xfb, 0xfa, 0xf6, 0xf4, 0xf9, 0xff, 0x26, 0x02, 0x03, 0x0a, 0x09, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x09, 0x03, 0x01, 0x01, 0x7f, 0x28, 0x2a, 0xfe, 0x27, 0xf9, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf6, 0xf6, 0xd6, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0x99, 0xf9, 0xf9, 0xf5, 0xf9, 0x99, 0xf9, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xfb, 0xfa, 0xf4, 0xf4, 0xf9, 0x2a, 0x07, 0x02, 0x04, 0x04, 0x08, 0x09, 0x08, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x09, 0x09, 0x08, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x0b, 0x04, 0x02, 0x01, 0x02, 0x26, 0xfe, 0x2a, 0x27, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x99, 0xf9, 0x99, 0xf5, 0x99, 0x99, 0x99, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xfa, 0xf9, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xfb, 0xf7, 0xf2, 0x99, 0xf7, 0x26, 0x07, 0x02, 0x05, 0x06, 0x06, 0x06, 0x06, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0a, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x08, 0x04, 0x04, 0x05, 0x02, 0x01, 0x62, 0x85, 0x2b, 0x8a, 0x99, 0xf4, 0xf6, 0xf6, 0xf5, 0xf4, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0x99, 0xf9, 0x99, 0xf5, 0x99, 0x99, 0xd6, 0x99, 0xd6, 0x99, 0x99, 0xd6, 0x99, 0xd6, 0x99, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xf4, 0xf2, 0xfa, 0xfa, 0xf7, 0xf3, 0xfa, 0xf6, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf4, 0xfa, 0xf6, 0xfa, 0xf4, 0xf4, 0xf3, 0xf3, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf9, 0xf3, 0xf9, 0xfa, 0xfa, 0x99, 0xfa, 0x99, 0xf4, 0x99, 0xf9, 0x99, 0x27, 0xf5, 0x27, 0xf5, 0x27, 0xf5, 0x27, 0xf4, 0x27, 0xf5, 0x27, 0xf5, 0x27, 0xf9, 0xfb, 0xd6, 0xf2, 0xd7, 0x8a, 0x88, 0x07, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x04, 0x03, 0x04, 0x03, 0x05, 0x03, 0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x05, 0x72, 0x02, 0x00, 0x62, 0x7a, 0x27, 0x27, 0xd7, 0xf2, 0x27, 0xfa, 0xfb, 0xfa, 0xf5, 0x99, 0xf5, 0x99, 0xf3, 0x27, 0xf4, 0xf3, 0xf9, 0xd6, 0xf9, 0x99, 0xf5, 0xfa, 0xd6, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xfa, 0xfa, 0xf6, 0xf3, 0xd6, 0xf9, 0xd6, 0xf3, 0xd6, 0xf7, 0x99, 0xd6, 0xd6, 0xd6, 0x99, 0xd6, 0xd6, 0xf3, 0x99, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xf4, 0xfc, 0xfb, 0xfc, 0xfa, 0xf4, 0xf4, 0xfc, 0xf7, 0xfa, 0xf6, 0xf4, 0xf6, 0xf4, 0xf3, 0xf4, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf7, 0xfa, 0xd6, 0xd6, 0x99, 0xf5, 0x99, 0x99, 0x99, 0x27, 0x27, 0x27, 0x27, 0x99, 0x8a, 0xfc, 0x8a, 0x99, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x99, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0xff, 0x8b, 0x8b, 0x94, 0xd7, 0x8b, 0x89, 0x86, 0x82, 0x22, 0x22, 0x20, 0x86, 0x22, 0x86, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x22, 0x20, 0x22, 0x1b, 0x22, 0x84, 0x20, 0x1b, 0x20, 0x1b, 0x84, 0x1b, 0x84, 0x1b, 0x84, 0x1b, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x16, 0x7f, 0x0e, 0x07, 0x7a, 0x7a, 0x81, 0x89, 0x8b, 0x8a, 0x8b, 0xff, 0x27, 0x8a, 0x8a, 0xfb, 0x8a, 0xfb, 0x8a, 0x8a, 0x8a, 0x8a, 0x99, 0x8a, 0x27, 0x99, 0x27, 0x27, 0xfa, 0x99, 0xf6, 0x99, 0xf7, 0x99, 0xfa, 0xf5, 0xf4, 0xf3, 0xf4, 0xf5, 0xf7, 0xfa, 0xf7, 0xfb, 0xf7, 0xfa, 0x99, 0xf3, 0xd6, 0xf6, 0xf6, 0xf6, 0xd6, 0xf3, 0xd6, 0xd6, 0xf6, 0xf6, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf5, 0x99, 0xd6, 0xd6, 0x99, 0x99, 0xd7, 0x8a, 0xf7, 0x99, 0xd6, 0x27, 0x99, 0x99, 0x8a, 0x99, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x27, 0x8a, 0x8a, 0x27, 0x27, 0x27, 0x89, 0x27, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x90, 0x88, 0x87, 0x87, 0x87, 0x8f, 0x8f, 0x8f, 0x8f, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x24, 0x86, 0x24, 0x86, 0x24, 0x86, 0x24, 0x86, 0x24, 0x86, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x25, 0x25, 0x28, 0x25, 0x28, 0x25, 0x28, 0x25, 0x28, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x24, 0x29, 0x26, 0xfe, 0x89, 0x27, 0x27, 0x8a, 0x27, 0x27, 0x27, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0xd7, 0x8b, 0x8a, 0xd7, 0x8a, 0xf7, 0x8a, 0xd7, 0x8a, 0xfc, 0x99, 0x99, 0x27, 0xf3, 0xf3, 0xf3, 0xf4, 0xfa, 0xfc, 0xf7, 0xf5, 0xf4, 0xf7, 0xf6, 0xf4, 0xf4, 0xf6, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf9, 0xfa, 0xfc, 0xfc, 0xf4, 0x99, 0x99, 0xd7, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8a, 0x8a, 0x8b, 0x8a, 0x8a, 0x27, 0x94, 0x89, 0x91, 0x88, 0x90, 0x90, 0x87, 0x8f, 0x8f, 0x8e, 0x81, 0x81, 0x80, 0x7c, 0x7c, 0x7a, 0x7a, 0x78, 0x6e, 0x6e, 0x6e, 0x68, 0x68, 0x57, 0x57, 0x57, 0x57, 0x3e, 0x57, 0x3e, 0x39, 0x3e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x35, 0x39, 0x35, 0x35, 0x35, 0x35, 0x2f, 0x35, 0x2f, 0x35, 0x37, 0x3a, 0x3a, 0x3a, 0x3a, 0x37, 0x37, 0x37, 0x37, 0x3a, 0x37, 0x3a, 0x37, 0x3a, 0x37, 0x3a, 0x37, 0x3a, 0x37, 0x3a, 0x37, 0x3a, 0x37, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3e, 0x3a, 0x3e, 0x3e, 0x3a, 0x3e, 0x3e, 0x3e, 0x4b, 0x3e, 0x4d, 0x57, 0x4b, 0x62, 0x4d, 0x62, 0x4d, 0x62, 0x60, 0x62, 0x60, 0x62, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x7b, 0x74, 0x64, 0x68, 0x6f, 0x68, 0x68, 0x57, 0x57, 0x57, 0x57, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6e, 0x6f, 0x8d, 0x6e, 0x7a, 0x7a, 0x7a, 0x7c, 0x7c, 0x81, 0x81, 0x8e, 0x8f, 0x90, 0x88, 0x89, 0x89, 0x27, 0x8a, 0x27, 0x8a, 0x8a, 0x8b, 0x8a, 0x8b, 0x8b, 0x8b, 0xfc, 0x27, 0xf2, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfb, 0xfa, 0x99, 0x8b, 0x8b, 0x8b, 0x27, 0x91, 0x89, 0x90, 0x8f, 0x83, 0x81, 0x7e, 0x7c, 0x7a, 0x78, 0x8d, 0x6f, 0x68, 0x57, 0x57, 0x3e, 0x39, 0x3e, 0x39, 0x35, 0x35, 0x35, 0x2f, 0x30, 0x2f, 0x2e, 0x2f, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x2d, 0x2d, 0x2e, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2e, 0x30, 0x2e, 0x2e, 0x30, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x37, 0x2e, 0x35, 0x60, 0x39, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x2d, 0x2f, 0x2e, 0x2f, 0x2f, 0x2f, 0x2f, 0x35, 0x39, 0x39, 0x39, 0x39, 0x57, 0x57, 0x68, 0x6f, 0x7a, 0x7c, 0x81, 0x85, 0x90, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x2b, 0x8a, 0xfb, 0xfb, 0xfa, 0xfb, 0xfb, 0xfb, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xfa, 0xf5, 0xf9, 0x27, 0xff, 0x8a, 0x88, 0x8e, 0x7c, 0x68, 0x57, 0x3e, 0x37, 0x35, 0x35, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x35, 0x34, 0x35, 0x31, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x32, 0x31, 0x31, 0x31, 0x32, 0x30, 0x34, 0x31, 0x31, 0x31, 0x32, 0x32, 0x32, 0x34, 0x34, 0x34, 0x34, 0x32, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x34, 0x31, 0x34, 0x31, 0x34, 0x31, 0x32, 0x32, 0x32, 0x34, 0x32, 0x31, 0x32, 0x31, 0x31, 0x32, 0x31, 0x34, 0x31, 0x34, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x34, 0x31, 0x37, 0x34, 0x31, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3e, 0x37, 0x2e, 0x30, 0x2e, 0x35, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x30, 0x2d, 0x2e, 0x2d, 0x2e, 0x2e, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2f, 0x35, 0x39, 0x3e, 0x68, 0x6e, 0x7c, 0x8e, 0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x27, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0x99, 0x8a, 0x8a, 0x85, 0x6e, 0x39, 0x2f, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x2e, 0x31, 0x30, 0x32, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x32, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x32, 0x31, 0x32, 0x32, 0x34, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x33, 0x32, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x32, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x31, 0x34, 0x31, 0x34, 0x30, 0x32, 0x30, 0x31, 0x30, 0x31, 0x30, 0x2e, 0x4b, 0x32, 0x30, 0x34, 0x2e, 0x2e, 0x30, 0x2e, 0x31, 0x30, 0x31, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x31, 0x31, 0x31, 0x30, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2d, 0x2e, 0x2e, 0x2f, 0x35, 0x3e, 0x68, 0x7a, 0x81, 0x87, 0x8a, 0x2b, 0xf7, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf7, 0xf3, 0xfa, 0x99, 0xf3, 0x8b, 0x89, 0x71, 0x39, 0x2d, 0x2e, 0x35, 0x30, 0x30, 0x31, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x32, 0x34, 0x31, 0x32, 0x31, 0x32, 0x32, 0x32, 0x33, 0x33, 0x33, 0x32, 0x33, 0x32, 0x32, 0x34, 0x32, 0x32, 0x32, 0x34, 0x32, 0x32, 0x32, 0x33, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x34, 0x36, 0x34, 0x32, 0x34, 0x34, 0x32, 0x33, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x34, 0x36, 0x34, 0x36, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x4b, 0x3b, 0x2d, 0x31, 0x31, 0x34, 0x31, 0x31, 0x2e, 0x30, 0x31, 0x30, 0x31, 0x31, 0x32, 0x31, 0x32, 0x31, 0x31, 0x32, 0x31, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x34, 0x31, 0x34, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x34, 0x2e, 0x30, 0x2e, 0x30, 0x30, 0x31, 0x30, 0x30, 0x30, 0x2d, 0x2e, 0x2d, 0x2d, 0x2f, 0x39, 0x6f, 0x7c, 0x91, 0xd7, 0x8a, 0x27, 0x99, 0xf5, 0xf6, 0xf4, 0xf6, 0xd6, 0xd6, 0xd6, 0xf5, 0xf9, 0xfa, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf7, 0xfd, 0xf2, 0x8a, 0x99, 0x27, 0x89, 0x71, 0x35, 0x2e, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x33, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x34, 0x34, 0x34, 0x32, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x31, 0x32, 0x2e, 0x2d, 0x4b, 0x35, 0x2e, 0x31, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x30, 0x31, 0x32, 0x34, 0x34, 0x32, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x31, 0x30, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x2e, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2d, 0x35, 0x68, 0x81, 0x91, 0x8a, 0x8a, 0xf3, 0xf4, 0xf4, 0xf6, 0xd6, 0x94, 0xd6, 0xf3, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf9, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf4, 0xf7, 0x8a, 0x99, 0x8a, 0x94, 0x68, 0x30, 0x2e, 0x30, 0x34, 0x2e, 0x30, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x31, 0x32, 0x31, 0x32, 0x32, 0x32, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x34, 0x34, 0x32, 0x34, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x32, 0x34, 0x32, 0x34, 0x32, 0x34, 0x32, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x2e, 0x4b, 0x37, 0x30, 0x31, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x34, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x30, 0x2e, 0x30, 0x2f, 0x2d, 0x2f, 0x6f, 0x90, 0x8a, 0xf9, 0xf7, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xf9, 0xf9, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf4, 0xf5, 0xf3, 0x8a, 0x91, 0x7a, 0x2f, 0x2d, 0x2e, 0x35, 0x37, 0x31, 0x31, 0x32, 0x32, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x33, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x32, 0x34, 0x32, 0x34, 0x32, 0x34, 0x34, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x32, 0x31, 0x32, 0x4b, 0x3b, 0x2e, 0x34, 0x31, 0x32, 0x33, 0x33, 0x32, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x32, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x31, 0x32, 0x31, 0x31, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x31, 0x31, 0x30, 0x31, 0x2e, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2f, 0x35, 0x2d, 0x3e, 0x8e, 0x27, 0xfc, 0xf4, 0xf3, 0xd6, 0x94, 0x99, 0x99, 0xfb, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf9, 0xf4, 0xf5, 0xf5, 0xf4, 0xf6, 0xfa, 0xf7, 0x27, 0x99, 0xff, 0x81, 0x2f, 0x2e, 0x35, 0x30, 0x31, 0x31, 0x34, 0x37, 0x31, 0x32, 0x34, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x33, 0x32, 0x33, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x32, 0x33, 0x32, 0x33, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x34, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x31, 0x31, 0x31, 0x3b, 0x36, 0x2e, 0x32, 0x32, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x32, 0x31, 0x31, 0x31, 0x33, 0x32, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2d, 0x35, 0x81, 0x8a, 0xfc, 0xfc, 0xfa, 0x99, 0x99, 0xfb, 0xf9, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf4, 0xf5, 0x99, 0x8b, 0x8f, 0x39, 0x2d, 0x35, 0x30, 0x30, 0x30, 0x31, 0x31, 0x34, 0x34, 0x32, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x36, 0x38, 0x38, 0x38, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x3d, 0x3f, 0x32, 0x36, 0x38, 0x36, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x38, 0x3d, 0x38, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x40, 0x41, 0x40, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x38, 0x38, 0x38, 0x36, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x30, 0x31, 0x37, 0x2e, 0x30, 0x35, 0x2d, 0xd8, 0x7c, 0xf9, 0x99, 0xfb, 0x99, 0x27, 0xfb, 0x27, 0xf9, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf9, 0xf5, 0xf4, 0xf6, 0xf5, 0xf6, 0xf5, 0xd6, 0x8a, 0x8a, 0x6e, 0x2d, 0x35, 0x35, 0x30, 0x32, 0x34, 0x32, 0x31, 0x34, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x3c, 0x5f, 0x70, 0x3c, 0x46, 0x41, 0x45, 0x41, 0x44, 0x45, 0x45, 0x45, 0x50, 0x45, 0x46, 0x45, 0x45, 0x45, 0x48, 0x4e, 0x48, 0x48, 0x44, 0x45, 0x44, 0x41, 0x44, 0x41, 0x42, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3b, 0x3d, 0x3b, 0x38, 0x3b, 0x34, 0x36, 0x34, 0x33, 0x31, 0x30, 0x31, 0x37, 0x30, 0x2d, 0x2f, 0x2f, 0xe7, 0xf3, 0xf4, 0xf3, 0xf9, 0xf7, 0xfb, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf4, 0xf5, 0xf6, 0xf6, 0xf4, 0xf7, 0x99, 0x8a, 0x81, 0x39, 0x2e, 0x35, 0x32, 0x31, 0x31, 0x34, 0x34, 0x33, 0x33, 0x38, 0x38, 0x3c, 0x3c, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x41, 0x41, 0x45, 0x41, 0x45, 0x45, 0x45, 0x41, 0x42, 0x41, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x41, 0x45, 0x41, 0x44, 0x41, 0x44, 0x41, 0x45, 0x45, 0x41, 0x45, 0x41, 0x44, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 0x42, 0x41, 0x45, 0x41, 0x42, 0x41, 0x42, 0x41, 0x45, 0x41, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x50, 0x45, 0x45, 0x45, 0x50, 0x41, 0x41, 0x70, 0x76, 0x50, 0x45, 0x50, 0x45, 0x48, 0x45, 0x44, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x44, 0x4c, 0x4c, 0x4c, 0x4c, 0x44, 0x44, 0x44, 0x42, 0x41, 0x42, 0x42, 0x42, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x40, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x38, 0x36, 0x34, 0x34, 0x2e, 0x2e, 0x2d, 0xd8, 0x8d, 0xee, 0xf7, 0xfd, 0xf7, 0xf4, 0xf6, 0x99, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0xf6, 0xf6, 0xd6, 0xf5, 0xd6, 0x8a, 0x8b, 0x6e, 0x2f, 0x37, 0x31, 0x34, 0x33, 0x33, 0x33, 0x36, 0x38, 0x3d, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x45, 0x42, 0x42, 0x45, 0x42, 0x42, 0x42, 0x42, 0x44, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x40, 0x42, 0x41, 0x44, 0x42, 0x44, 0x42, 0x42, 0x42, 0x45, 0x44, 0x45, 0x44, 0x45, 0x44, 0x45, 0x45, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x45, 0x44, 0x45, 0x44, 0x48, 0x48, 0x45, 0x44, 0x45, 0x48, 0x48, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x41, 0x41, 0x70, 0x79, 0x40, 0x50, 0x48, 0x48, 0x44, 0x44, 0x4c, 0x44, 0x4c, 0x48, 0x44, 0x44, 0x4c, 0x4c, 0x4c, 0x44, 0x4c, 0x56, 0x44, 0x4a, 0x44, 0x4e, 0x45, 0x45, 0x40, 0x47, 0x40, 0x43, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x40, 0x40, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x3c, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x41, 0x3c, 0x41, 0x3c, 0x46, 0x3f, 0x31, 0x2d, 0x2f, 0x8c, 0x97, 0x94, 0xe9, 0xd2, 0xe6, 0xfd, 0xf6, 0xf3, 0xd6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xd6, 0xf6, 0xd6, 0x99, 0x8b, 0x89, 0x57, 0x2d, 0x32, 0x32, 0x36, 0x33, 0x33, 0x38, 0x3d, 0x41, 0x41, 0x3d, 0x42, 0x41, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x48, 0x44, 0x44, 0x44, 0x42, 0x48, 0x44, 0x44, 0x42, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x44, 0x42, 0x48, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x40, 0x70, 0x76, 0x40, 0x45, 0x48, 0x48, 0x44, 0x4c, 0x44, 0x4c, 0x44, 0x4c, 0x44, 0x4c, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x42, 0x50, 0x40, 0x40, 0x3c, 0x41, 0x41, 0x3f, 0x3c, 0x3c, 0x3f, 0x40, 0x3f, 0x40, 0x3f, 0x3c, 0x3c, 0x3c, 0x40, 0x42, 0x42, 0x3c, 0x3c, 0x42, 0x3c, 0x3c, 0x42, 0x44, 0x40, 0x38, 0x3c, 0x42, 0x3c, 0x42, 0x3c, 0x42, 0x40, 0x40, 0x46, 0x3b, 0x39, 0x81, 0x94, 0xd5, 0xb5, 0xa3, 0x9d, 0xa3, 0xe3, 0xfd, 0xf2, 0xd6, 0xf2, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xd6, 0xf6, 0xf6, 0xd6, 0xf6, 0x99, 0x8b, 0x8e, 0x35, 0x30, 0x31, 0x33, 0x33, 0x36, 0x38, 0x41, 0x41, 0x45, 0x41, 0x42, 0x41, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x44, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4e, 0x44, 0x44, 0x42, 0x44, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x4c, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x45, 0x44, 0x48, 0x42, 0x48, 0x42, 0x48, 0x44, 0x44, 0x48, 0x48, 0x4e, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x48, 0x44, 0x44, 0x48, 0x48, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x40, 0x70, 0x79, 0x40, 0x48, 0x4e, 0x44, 0x4c, 0x44, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x44, 0x48, 0x45, 0x50, 0x46, 0x3f, 0x3f, 0x4b, 0x4b, 0x4b, 0x4b, 0x5f, 0x5f, 0x60, 0x5f, 0x5f, 0x5f, 0x4b, 0x3f, 0x4b, 0x3f, 0x3f, 0x3c, 0x38, 0x38, 0x40, 0x45, 0x42, 0x3c, 0x3c, 0x42, 0x40, 0x3c, 0x44, 0x44, 0x3c, 0x42, 0x40, 0x42, 0x40, 0x40, 0x3c, 0x3d, 0x3e, 0x7c, 0x94, 0xd2, 0x9e, 0x9f, 0x9d, 0x9b, 0x9d, 0xac, 0xf0, 0xf7, 0xf6, 0xd6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf6, 0xd6, 0xf6, 0xd6, 0x99, 0x8a, 0x7a, 0x2f, 0x31, 0x34, 0x33, 0x38, 0x41, 0x41, 0x45, 0x41, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x42, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x42, 0x42, 0x44, 0x42, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x44, 0x4e, 0x42, 0x44, 0x44, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x42, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x48, 0x44, 0x42, 0x42, 0x42, 0x45, 0x44, 0x48, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x48, 0x42, 0x48, 0x42, 0x48, 0x4e, 0x44, 0x48, 0x44, 0x44, 0x42, 0x42, 0x44, 0x44, 0x42, 0x44, 0x44, 0x48, 0x44, 0x48, 0x44, 0x48, 0x44, 0x48, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x40, 0x70, 0x79, 0x3c, 0x4f, 0x48, 0x48, 0x4c, 0x44, 0x4c, 0x44, 0x4c, 0x4e, 0x4e, 0x4c, 0x4a, 0x5b, 0x46, 0x3f, 0x3f, 0x4b, 0x68, 0x71, 0x7e, 0x81, 0x8f, 0x8f, 0x92, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x81, 0x7e, 0x78, 0x71, 0x6d, 0x4b, 0x3f, 0x37, 0x38, 0x3f, 0x41, 0x3c, 0x3c, 0x40, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x40, 0x42, 0x40, 0x42, 0x38, 0x64, 0x90, 0xd5, 0xae, 0xaf, 0xa6, 0x9c, 0x9c, 0x9d, 0x9a, 0xbf, 0xfc, 0xf6, 0xf7, 0xf6, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0x8a, 0x91, 0x68, 0x2e, 0x31, 0x38, 0x38, 0x41, 0x41, 0x44, 0x41, 0x42, 0x40, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x44, 0x42, 0x44, 0x42, 0x44, 0x44, 0x48, 0x42, 0x48, 0x42, 0x48, 0x44, 0x4e, 0x48, 0x4e, 0x44, 0x4e, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4e, 0x42, 0x44, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x42, 0x45, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x41, 0x45, 0x45, 0x45, 0x41, 0x42, 0x45, 0x45, 0x45, 0x45, 0x42, 0x42, 0x44, 0x44, 0x42, 0x44, 0x44, 0x44, 0x44, 0x42, 0x4a, 0x42, 0x48, 0x44, 0x48, 0x42, 0x48, 0x44, 0x48, 0x42, 0x48, 0x42, 0x48, 0x42, 0x45, 0x45, 0x48, 0x45, 0x50, 0x48, 0x50, 0x48, 0x50, 0x48, 0x50, 0x45, 0x45, 0x45, 0x42, 0x48, 0x44, 0x48, 0x4e, 0x48, 0x4e, 0x48, 0x44, 0x48, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x41, 0x42, 0x70, 0x79, 0x40, 0x50, 0x48, 0x4c, 0x48, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4e, 0x5b, 0x50, 0x3b, 0x4b, 0x64, 0x7c, 0x92, 0x93, 0x93, 0x93, 0x98, 0xd5, 0xd5, 0x97, 0xd5, 0x97, 0xd5, 0xe3, 0xd5, 0xd5, 0xd5, 0xf0, 0x93, 0x93, 0x94, 0x94, 0x98, 0x81, 0x7a, 0x64, 0x3b, 0x3b, 0x46, 0x41, 0x3c, 0x42, 0x40, 0x42, 0x42, 0x40, 0x42, 0x40, 0x40, 0x41, 0x38, 0x6d, 0x94, 0xcc, 0xb1, 0xb8, 0xa2, 0x9b, 0x9c, 0x9c, 0x9a, 0x9d, 0xd4, 0xf6, 0xf7, 0xf6, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf6, 0xd6, 0xd6, 0x99, 0x8b, 0x92, 0x39, 0x2e, 0x32, 0x3d, 0x3d, 0x48, 0x40, 0x41, 0x44, 0x45, 0x44, 0x42, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x42, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x48, 0x48, 0x4a, 0x44, 0x4a, 0x45, 0x4a, 0x45, 0x4a, 0x44, 0x4e, 0x44, 0x4e, 0x44, 0x4e, 0x48, 0x44, 0x44, 0x44, 0x42, 0x44, 0x44, 0x42, 0x44, 0x4e, 0x42, 0x4e, 0x44, 0x4e, 0x42, 0x48, 0x44, 0x44, 0x4a, 0x44, 0x44, 0x42, 0x44, 0x45, 0x45, 0x45, 0x41, 0x41, 0x40, 0x41, 0x3c, 0x40, 0x3d, 0x41, 0x41, 0x46, 0x41, 0x41, 0x40, 0x40, 0x45, 0x47, 0x48, 0x45, 0x48, 0x45, 0x45, 0x45, 0x44, 0x45, 0x44, 0x42, 0x45, 0x44, 0x44, 0x44, 0x4a, 0x42, 0x44, 0x42, 0x4e, 0x44, 0x44, 0x4a, 0x44, 0x44, 0x42, 0x42, 0x45, 0x40, 0x41, 0x40, 0x40, 0x3c, 0x40, 0x40, 0x40, 0x40, 0x41, 0x42, 0x41, 0x42, 0x45, 0x4a, 0x42, 0x4a, 0x48, 0x4a, 0x48, 0x4a, 0x48, 0x4a, 0x44, 0x4a, 0x44, 0x48, 0x44, 0x45, 0x42, 0x40, 0x70, 0x79, 0x40, 0x48, 0x48, 0x4e, 0x44, 0x48, 0x4e, 0x44, 0x4f, 0x48, 0x50, 0x45, 0x3f, 0x5f, 0x7e, 0x93, 0x93, 0x97, 0xd2, 0xc8, 0xc0, 0xb6, 0xae, 0xae, 0xb6, 0xa6, 0xae, 0xa6, 0xa6, 0xae, 0xae, 0xb6, 0xae, 0xb6, 0xc4, 0xcc, 0xd2, 0x97, 0xf0, 0x94, 0x88, 0x7e, 0x4b, 0x3b, 0x3d, 0x41, 0x40, 0x42, 0x42, 0x42, 0x42, 0x40, 0x42, 0x40, 0x41, 0x36, 0x71, 0xd7, 0xd0, 0xaf, 0xa4, 0xa8, 0x9c, 0x9c, 0x9b, 0x9d, 0x9d, 0xac, 0xd6, 0xf7, 0xf7, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf9, 0xf5, 0xf9, 0xd6, 0xf6, 0xd6, 0xf6, 0xd6, 0x8b, 0x7c, 0x2f, 0x37, 0x3b, 0x41, 0x45, 0x42, 0x45, 0x42, 0x42, 0x48, 0x44, 0x4e, 0x42, 0x42, 0x44, 0x44, 0x42, 0x45, 0x42, 0x41, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x40, 0x3c, 0x3c, 0x40, 0x3c, 0x40, 0x3c, 0x40, 0x3c, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x45, 0x48, 0x44, 0x44, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x48, 0x42, 0x44, 0x42, 0x4e, 0x44, 0x4e, 0x48, 0x44, 0x45, 0x42, 0x40, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x4b, 0x46, 0x4b, 0x4b, 0x5f, 0x4b, 0x5f, 0x4b, 0x4b, 0x4b, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c, 0x40, 0x46, 0x50, 0x45, 0x45, 0x45, 0x45, 0x42, 0x45, 0x42, 0x45, 0x42, 0x4a, 0x42, 0x44, 0x42, 0x4a, 0x42, 0x44, 0x47, 0x48, 0x45, 0x40, 0x40, 0x40, 0x3c, 0x3f, 0x41, 0x3f, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3f, 0x3d, 0x3f, 0x3c, 0x3c, 0x40, 0x40, 0x47, 0x50, 0x47, 0x48, 0x4a, 0x48, 0x4a, 0x42, 0x48, 0x4a, 0x42, 0x48, 0x41, 0x42, 0x70, 0x79, 0x40, 0x48, 0x50, 0x48, 0x4e, 0x4e, 0x48, 0x4e, 0x48, 0x53, 0x41, 0x3f, 0x71, 0x8f, 0x94, 0x97, 0xbb, 0xa6, 0xa6, 0xa1, 0xa1, 0xa5, 0xa9, 0xa9, 0xa9, 0xaa, 0xab, 0xab, 0xab, 0xab, 0xab, 0xad, 0xa9, 0xd9, 0xd9, 0xa6, 0xa0, 0xa3, 0xb5, 0xbf, 0x8e, 0x99, 0x88, 0x71, 0x3b, 0x3d, 0x3c, 0x40, 0x40, 0x42, 0x40, 0x42, 0x40, 0x3d, 0x42, 0x38, 0x6d, 0x91, 0xe1, 0xad, 0xb0, 0xa8, 0xa2, 0x9c, 0x9b, 0x9a, 0x9a, 0x9d, 0xdc, 0xf7, 0xf7, 0xfa, 0xf7, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0x27, 0xfa, 0xf5, 0xf6, 0xf6, 0xf6, 0x99, 0x8a, 0x68, 0x2e, 0x3b, 0x41, 0x41, 0x41, 0x42, 0x45, 0x48, 0x40, 0x42, 0x4a, 0x42, 0x4f, 0x4f, 0x42, 0x42, 0x45, 0x41, 0x3b, 0x3b, 0x3f, 0x4b, 0x4b, 0x64, 0x6a, 0x6b, 0x6d, 0x6d, 0x6b, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x64, 0x5f, 0x4b, 0x46, 0x3f, 0x3f, 0x3c, 0x3c, 0x50, 0x4e, 0x4e, 0x42, 0x4c, 0x44, 0x42, 0x42, 0x42, 0x45, 0x44, 0x48, 0x4f, 0x4f, 0x4a, 0x4c, 0x4a, 0x44, 0x50, 0x3d, 0x3b, 0x5f, 0x6d, 0x7a, 0x7c, 0x7c, 0x81, 0x81, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x81, 0x81, 0x7b, 0x78, 0x68, 0x4b, 0x37, 0x3f, 0x46, 0x50, 0x45, 0x42, 0x48, 0x42, 0x48, 0x45, 0x45, 0x40, 0x44, 0x4c, 0x4c, 0x4c, 0x4a, 0x50, 0x43, 0x3f, 0x3f, 0x4b, 0x64, 0x71, 0x78, 0x7e, 0x7e, 0x80, 0x81, 0x83, 0x83, 0x8f, 0x83, 0x83, 0x83, 0x81, 0x80, 0x7e, 0x7e, 0x78, 0x74, 0x6d, 0x4b, 0x3f, 0x3f, 0x50, 0x47, 0x50, 0x40, 0x42, 0x4e, 0x42, 0x48, 0x50, 0x45, 0x45, 0x40, 0x70, 0x79, 0x40, 0x50, 0x48, 0x4f, 0x4f, 0x4f, 0x4f, 0x4e, 0x50, 0x41, 0x3e, 0x71, 0x93, 0x98, 0xc4, 0xa6, 0xa6, 0xa4, 0xaa, 0xab, 0xaf, 0xb2, 0xb2, 0xb2, 0xad, 0xb0, 0xab, 0xb2, 0xb0, 0xb2, 0xb0, 0xad, 0xb2, 0xb4, 0xaf, 0xaf, 0xb1, 0xb1, 0xa6, 0xa3, 0xa3, 0xdc, 0x98, 0x94, 0x7b, 0x3e, 0x3d, 0x47, 0x42, 0x42, 0x42, 0x42, 0x40, 0x44, 0x3d, 0x3d, 0x64, 0x93, 0xd4, 0xa1, 0xa8, 0xa2, 0xa8, 0x9f, 0x9c, 0x9b, 0x9a, 0x9a, 0x96, 0xe6, 0xd7, 0xf7, 0xf6, 0xf6, 0xd6, 0xf6, 0xf7, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf9, 0xf5, 0x27, 0xf6, 0xf4, 0xf6, 0xf7, 0x8a, 0x88, 0x4b, 0x31, 0x46, 0x41, 0x42, 0x40, 0x48, 0x45, 0x42, 0x45, 0x45, 0x4a, 0x42, 0x4a, 0x4a, 0x4a, 0x40, 0x3f, 0x4b, 0x71, 0x7e, 0x8e, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x88, 0x90, 0x88, 0x93, 0x88, 0x93, 0x90, 0x90, 0x90, 0x90, 0x92, 0x8f, 0x81, 0x7c, 0x6d, 0x4b, 0x3c, 0x3c, 0x4c, 0x42, 0x59, 0x44, 0x4c, 0x44, 0x41, 0x45, 0x45, 0x44, 0x4a, 0x4f, 0x4f, 0x4a, 0x4e, 0x45, 0x3b, 0x64, 0x7c, 0x92, 0xd5, 0xd5, 0xe8, 0xe3, 0xe4, 0xd4, 0xd4, 0xd2, 0xd0, 0xd2, 0xd0, 0xd4, 0xd0, 0xd2, 0xd4, 0xd4, 0x97, 0xf0, 0x93, 0x94, 0x98, 0x7c, 0x64, 0x3b, 0x3f, 0x50, 0x48, 0x44, 0x44, 0x42, 0x45, 0x41, 0x45, 0x4c, 0x4c, 0x4c, 0x59, 0x47, 0x43, 0x3a, 0x64, 0x7c, 0x92, 0x93, 0x93, 0x93, 0xee, 0x98, 0xd5, 0x92, 0xd5, 0x97, 0xe6, 0x97, 0xd5, 0xe3, 0x98, 0xd5, 0x98, 0xf0, 0x93, 0x93, 0x93, 0x90, 0x81, 0x64, 0x3a, 0x3d, 0x48, 0x4c, 0x44, 0x4c, 0x4e, 0x40, 0x45, 0x44, 0x41, 0x40, 0x79, 0x79, 0x47, 0x48, 0x45, 0x5b, 0x52, 0x5a, 0x4f, 0x4e, 0x50, 0x3b, 0x78, 0x92, 0xd5, 0xb5, 0xa4, 0xab, 0xb0, 0xb0, 0xb2, 0xab, 0xaf, 0xb2, 0xb2, 0xb0, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xaf, 0xb1, 0xb1, 0xb1, 0xaf, 0xa7, 0xa7, 0x9e, 0xb5, 0x97, 0x94, 0x81, 0x4b, 0x3c, 0x43, 0x42, 0x42, 0x40, 0x42, 0x42, 0x42, 0x3c, 0x64, 0x90, 0xe1, 0xd9, 0xa8, 0xa2, 0xa2, 0xa2, 0x9c, 0x9b, 0x9d, 0x9a, 0x9a, 0xba, 0xf1, 0xf7, 0xf6, 0xf6, 0xf3, 0xf7, 0xf6, 0xf6, 0xf6, 0xf5, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0x27, 0xf3, 0xf5, 0xf6, 0xf4, 0xf6, 0x8b, 0x83, 0x39, 0x33, 0x41, 0x45, 0x45, 0x42, 0x44, 0x44, 0x42, 0x44, 0x48, 0x42, 0x5b, 0x43, 0x40, 0x4d, 0x6a, 0x7e, 0x8f, 0x98, 0xd5, 0x97, 0xd0, 0xd2, 0xcc, 0xd0, 0xcc, 0xca, 0xc8, 0xca, 0xca, 0xca, 0xcc, 0xca, 0xcc, 0xcc, 0xce, 0xd2, 0x97, 0x97, 0x90, 0x98, 0x8f, 0x7b, 0x4b, 0x40, 0x40, 0x4e, 0x42, 0x4c, 0x4e, 0x44, 0x41, 0x48, 0x44, 0x4a, 0x4a, 0x55, 0x56, 0x45, 0x3f, 0x71, 0x8f, 0x92, 0xce, 0xca, 0xbc, 0xb6, 0xb6, 0xa6, 0xa6, 0xa5, 0xa6, 0xaa, 0xa6, 0xaa, 0xa6, 0xa7, 0xaa, 0xa6, 0xaa, 0xb5, 0xbc, 0xbf, 0xca, 0x97, 0x94, 0x91, 0x80, 0x4b, 0x3c, 0x50, 0x42, 0x4e, 0x44, 0x40, 0x45, 0x50, 0x4c, 0x42, 0x4c, 0x44, 0x43, 0x5f, 0x7b, 0x91, 0x90, 0x97, 0xca, 0xbf, 0xbb, 0xb6, 0xb6, 0xb6, 0xae, 0xae, 0xae, 0xa6, 0xae, 0xa6, 0xae, 0xae, 0xae, 0xb6, 0xb5, 0xb6, 0xbb, 0xc4, 0xce, 0x98, 0x88, 0x81, 0x5f, 0x3c, 0x67, 0x42, 0x44, 0x4e, 0x42, 0x47, 0x45, 0x45, 0x40, 0x75, 0x79, 0x42, 0x50, 0x48, 0x48, 0x53, 0x4a, 0x55, 0x4a, 0x3f, 0x64, 0x90, 0x98, 0xb5, 0xa6, 0xaa, 0xb0, 0xa8, 0xb0, 0xab, 0xb2, 0xaf, 0xaf, 0xb2, 0xad, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xb2, 0xb4, 0xb4, 0xb4, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa0, 0xa3, 0x97, 0x94, 0x80, 0x5f, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x40, 0x42, 0x3c, 0x4b, 0x8e, 0xe4, 0xb7, 0xa8, 0xa8, 0xa2, 0xa2, 0x9f, 0x9c, 0x9b, 0x9b, 0x9a, 0x9d, 0xe0, 0xf7, 0xd7, 0xd6, 0xf6, 0xf7, 0xd6, 0xf6, 0x99, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0x99, 0xfb, 0xf5, 0xfa, 0xf7, 0xf2, 0xf7, 0xd7, 0x7a, 0x31, 0x3b, 0x50, 0x41, 0x48, 0x42, 0x44, 0x44, 0x4c, 0x44, 0x40, 0x45, 0x50, 0x3f, 0x3f, 0x7e, 0x91, 0x91, 0x97, 0xca, 0xba, 0xae, 0xaa, 0xa6, 0xaa, 0xa6, 0xa5, 0xa7, 0xa6, 0xa9, 0xd9, 0xaa, 0xaf, 0xaa, 0xb1, 0xd9, 0xb6, 0xae, 0xb5, 0xb5, 0xbf, 0xe0, 0x92, 0x91, 0x83, 0x5f, 0x3f, 0x41, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4e, 0x4c, 0x4f, 0x4a, 0x50, 0x3f, 0x71, 0x90, 0x97, 0xb5, 0xa3, 0xa0, 0xa5, 0xa5, 0xa4, 0xaa, 0xa4, 0xaa, 0xab, 0xab, 0xab, 0xab, 0xaa, 0xab, 0xaa, 0xb3, 0xb1, 0xb1, 0xa0, 0xa6, 0xae, 0xac, 0xbb, 0x97, 0x94, 0x83, 0x4b, 0x3d, 0x45, 0x42, 0x4e, 0x44, 0x47, 0x4e, 0x4c, 0x4c, 0x5b, 0x40, 0x4b, 0x7e, 0x90, 0x92, 0xbb, 0xa3, 0xa3, 0xa6, 0xa0, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xaa, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa0, 0xa6, 0xae, 0xac, 0xac, 0xe0, 0x90, 0x8f, 0x6d, 0x38, 0x45, 0x45, 0x48, 0x4a, 0x4e, 0x48, 0x45, 0x40, 0x79, 0x79, 0x47, 0x48, 0x48, 0x4f, 0x56, 0x4a, 0x52, 0x45, 0x46, 0x7e, 0x93, 0xc4, 0xac, 0xb1, 0xaf, 0xb0, 0xb0, 0xab, 0xb2, 0xaf, 0xaf, 0xb4, 0xab, 0xb2, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xad, 0xb1, 0xb4, 0xb1, 0xa9, 0xa7, 0xa5, 0xa5, 0xa1, 0xa6, 0xa6, 0x9e, 0xac, 0xe0, 0x94, 0x80, 0x3b, 0x3d, 0x5b, 0x40, 0x42, 0x40, 0x42, 0x40, 0x4b, 0x7e, 0xd5, 0xc0, 0xa8, 0xa2, 0xa2, 0xa2, 0xa2, 0x9c, 0x9b, 0x9b, 0x9a, 0x9a, 0xac, 0xf0, 0xf7, 0xf1, 0xf7, 0xf2, 0xf7, 0xf5, 0xf9, 0xfa, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0x8a, 0xf5, 0xf5, 0xf6, 0xf4, 0xd7, 0x27, 0x64, 0x35, 0x3d, 0x41, 0x41, 0x44, 0x45, 0x44, 0x4c, 0x44, 0x42, 0x48, 0x50, 0x3f, 0x64, 0x8f, 0x93, 0xe0, 0xba, 0xa3, 0xae, 0xae, 0xd9, 0xaf, 0xb0, 0xad, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xad, 0xb2, 0xad, 0xb2, 0xb4, 0xb1, 0xaf, 0xb7, 0xae, 0xae, 0xba, 0xce, 0x93, 0x81, 0x64, 0x3d, 0x50, 0x48, 0x44, 0x4c, 0x44, 0x42, 0x4c, 0x4f, 0x4f, 0x41, 0x3f, 0x6d, 0x92, 0x97, 0xa3, 0xa6, 0xaa, 0xb3, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xab, 0xa8, 0xab, 0xb0, 0xb8, 0xb8, 0xb1, 0xaf, 0xae, 0xb5, 0xdc, 0x94, 0x83, 0x3e, 0x46, 0x50, 0x42, 0x5a, 0x5b, 0x40, 0x4c, 0x4c, 0x41, 0x4b, 0x7e, 0x94, 0xe0, 0xa3, 0xa3, 0xa6, 0xaa, 0xa7, 0xad, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xab, 0xa9, 0xab, 0xaf, 0xa5, 0xa5, 0xa6, 0xa3, 0xa3, 0xba, 0x90, 0x8f, 0x64, 0x4b, 0x50, 0x47, 0x56, 0x52, 0x48, 0x45, 0x43, 0x79, 0x79, 0x40, 0x48, 0x48, 0x5b, 0x52, 0x55, 0x4a, 0x46, 0x6d, 0x91, 0xce, 0xac, 0xa7, 0xb7, 0xa4, 0xad, 0xb8, 0xad, 0xad, 0xb1, 0xb1, 0xaf, 0xb2, 0xb0, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xb4, 0xb1, 0xb2, 0xd9, 0xa7, 0xa1, 0xa5, 0xa5, 0xa5, 0xa1, 0xa5, 0xae, 0xa0, 0xa3, 0x97, 0x91, 0x7e, 0x3d, 0x41, 0x45, 0x40, 0x4a, 0x4a, 0x42, 0x3c, 0x78, 0xf0, 0xcd, 0xa4, 0xa8, 0xa2, 0xa8, 0xa8, 0x9f, 0x9c, 0x9b, 0x9b, 0x9a, 0x9a, 0xce, 0xd6, 0xf6, 0xf7, 0xf2, 0xfc, 0xfa, 0xfb, 0xf9, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0x99, 0xf9, 0xf4, 0xfa, 0xf6, 0x8b, 0x88, 0x3e, 0x37, 0x3f, 0x45, 0x41, 0x42, 0x42, 0x44, 0x44, 0x4c, 0x4e, 0x50, 0x3b, 0x4b, 0x8f, 0x93, 0xc4, 0xa3, 0xa7, 0xaf, 0xd9, 0xb1, 0xb8, 0xab, 0xad, 0xb0, 0xad, 0xb0, 0xad, 0xad, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb0, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4, 0xae, 0xa3, 0xca, 0x92, 0x7e, 0x4b, 0x41, 0x4c, 0x44, 0x4c, 0x4a, 0x42, 0x59, 0x59, 0x48, 0x41, 0x4b, 0x81, 0x93, 0xb5, 0xa6, 0xab, 0xa4, 0xa8, 0xa2, 0xa2, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xb0, 0xa8, 0xa2, 0xb0, 0xb0, 0xb0, 0xb8, 0xbe, 0xb6, 0xac, 0xd2, 0x91, 0x71, 0x3f, 0x47, 0x42, 0x59, 0x4a, 0x42, 0x59, 0x45, 0x3d, 0x6d, 0x91, 0x97, 0xb5, 0xa0, 0xaa, 0xab, 0xa4, 0xa4, 0xad, 0xa1, 0xa4, 0xd9, 0xa4, 0xa9, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xd9, 0xab, 0xd9, 0xab, 0xad, 0xb2, 0xb4, 0xa7, 0xa6, 0xa3, 0xbb, 0x98, 0x81, 0x4b, 0x46, 0x50, 0x55, 0x4c, 0x4a, 0x45, 0x43, 0x79, 0x79, 0x40, 0x48, 0x48, 0x48, 0x52, 0x4f, 0x43, 0x41, 0x7e, 0x94, 0xbf, 0xae, 0xd9, 0xd9, 0xb8, 0xb0, 0xad, 0xb2, 0xb2, 0xb1, 0xaf, 0xb1, 0xb2, 0xb2, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb2, 0xb1, 0xa9, 0xa7, 0xa1, 0xa1, 0xa5, 0xa5, 0xaa, 0xa1, 0xa0, 0xaf, 0xa3, 0xa0, 0xac, 0x92, 0x94, 0x6d, 0x3b, 0x45, 0x43, 0x42, 0x55, 0x42, 0x3f, 0x64, 0x98, 0xd4, 0xb1, 0xa8, 0xa8, 0xa8, 0xa2, 0xa8, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0xa3, 0xe8, 0xd7, 0xf6, 0xf6, 0xf3, 0xfb, 0xf9, 0xfb, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf4, 0xf7, 0x8b, 0x81, 0x37, 0x3b, 0x46, 0x41, 0x48, 0x42, 0x42, 0x4a, 0x42, 0x53, 0x5c, 0x3c, 0x4b, 0x81, 0x94, 0xbb, 0xaa, 0xa9, 0xad, 0xb2, 0xb2, 0xad, 0xa9, 0xaf, 0xb2, 0xaf, 0xb2, 0xaf, 0xb2, 0xad, 0xaf, 0xb2, 0xaf, 0xb2, 0xb2, 0xb4, 0xb4, 0xb0, 0xb0, 0xb0, 0xa8, 0xb2, 0xb8, 0xb9, 0xaf, 0xa3, 0xd2, 0x92, 0x6d, 0x3b, 0x50, 0x44, 0x4a, 0x44, 0x4f, 0x59, 0x4c, 0x42, 0x4b, 0x71, 0x93, 0x97, 0x9f, 0xaf, 0xa2, 0xb0, 0xa8, 0xb0, 0xab, 0xab, 0xa4, 0xab, 0xa8, 0xab, 0xb0, 0xb0, 0xab, 0xb0, 0xab, 0xb0, 0xab, 0xb0, 0xb0, 0xb0, 0xb8, 0xbd, 0xb0, 0xb0, 0xb4, 0xbc, 0xb5, 0x97, 0x90, 0x64, 0x3c, 0x5d, 0x4a, 0x42, 0x55, 0x48, 0x41, 0x64, 0x8e, 0x93, 0xb5, 0xa0, 0xaa, 0xa4, 0xab, 0xb0, 0xa8, 0xa1, 0xb4, 0xd9, 0xd9, 0xd9, 0xd9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xd9, 0xd9, 0xd9, 0xaf, 0xaf, 0xab, 0xa2, 0xa1, 0xad, 0xd9, 0xa0, 0xa3, 0xbb, 0x91, 0x78, 0x3f, 0x50, 0x4f, 0x4f, 0x4e, 0x50, 0x43, 0x79, 0x79, 0x42, 0x45, 0x4c, 0x4e, 0x44, 0x53, 0x45, 0x4b, 0x8f, 0x98, 0xae, 0xb1, 0xaf, 0xad, 0xb8, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb4, 0xb2, 0xb0, 0xb2, 0xb2, 0xb2, 0xaf, 0xb2, 0xaf, 0xb2, 0xb1, 0xaf, 0xa9, 0xa7, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa1, 0xa1, 0xd9, 0xa7, 0xa0, 0xb5, 0x93, 0x92, 0x64, 0x3d, 0x47, 0x42, 0x4a, 0x42, 0x43, 0x3f, 0x81, 0xf0, 0xb9, 0xb3, 0xa8, 0xa8, 0xa2, 0xa2, 0xa2, 0x9c, 0x9b, 0x9b, 0x9a, 0x9a, 0xba, 0xd6, 0xf6, 0xf7, 0xf9, 0xf9, 0xfb, 0xf9, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xfc, 0xf4, 0xf4, 0x99, 0x8a, 0x7c, 0x30, 0x3b, 0x46, 0x45, 0x48, 0x44, 0x40, 0x4f, 0x4a, 0x43, 0x4d, 0x3b, 0x7b, 0x91, 0xc4, 0xa6, 0xa5, 0xab, 0xb0, 0xb0, 0xab, 0xab, 0xaa, 0xb2, 0xaf, 0xaf, 0xaf, 0xb2, 0xaf, 0xb4, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4, 0xb1, 0xb4, 0xb3, 0xa8, 0xb3, 0xb3, 0xb8, 0xb0, 0xa4, 0xd9, 0xa6, 0xba, 0x92, 0x7c, 0x4b, 0x48, 0x4c, 0x4a, 0x4a, 0x56, 0x59, 0x44, 0x40, 0x4b, 0x7e, 0x93, 0xbb, 0xd9, 0xad, 0xa2, 0xa8, 0xa8, 0xa2, 0xa9, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xad, 0xab, 0xb0, 0xb0, 0xb0, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4, 0xb6, 0xca, 0x88, 0x78, 0x38, 0x4f, 0x4a, 0x56, 0x5b, 0x45, 0x3d, 0x71, 0x90, 0xd2, 0xa3, 0xa7, 0xa9, 0xab, 0xa2, 0xa2, 0xad, 0xad, 0xa7, 0xa7, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xaf, 0xa6, 0xaf, 0xa6, 0xd9, 0xa6, 0xa7, 0xa9, 0xa4, 0xad, 0xad, 0xad, 0xd9, 0xd9, 0xa3, 0xae, 0x92, 0x8f, 0x4b, 0x43, 0x4e, 0x59, 0x56, 0x47, 0x43, 0x7f, 0x79, 0x40, 0x48, 0x48, 0x4e, 0x4e, 0x5e, 0x46, 0x5f, 0x90, 0x97, 0xae, 0xd9, 0xb2, 0xad, 0xad, 0xb0, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xa9, 0xd9, 0xa5, 0xa5, 0xa5, 0xa7, 0xa5, 0xa5, 0xa6, 0xa1, 0xd9, 0xd9, 0xa0, 0xd9, 0xa3, 0xa0, 0xc4, 0x94, 0x81, 0x3b, 0x40, 0x55, 0x42, 0x4f, 0x4a, 0x3b, 0x78, 0x93, 0xc8, 0xb4, 0xa8, 0xa8, 0xa2, 0xa2, 0xab, 0x9f, 0x9b, 0x9b, 0x9b, 0x9a, 0x9d, 0xe4, 0xd7, 0xf3, 0xfb, 0xfb, 0xfb, 0xf9, 0xf5, 0xf6, 0xf6, 0xd6, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xd6, 0xf5, 0xf3, 0xfc, 0x8a, 0x27, 0x6f, 0x2e, 0x3f, 0x50, 0x45, 0x42, 0x48, 0x4a, 0x50, 0x53, 0x5c, 0x3f, 0x4b, 0x90, 0x97, 0xa3, 0xa6, 0xb0, 0xab, 0xa8, 0xab, 0xab, 0xaa, 0xaf, 0xab, 0xb2, 0xab, 0xb2, 0xad, 0xb2, 0xad, 0xb2, 0xad, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xab, 0xa4, 0xd9, 0xa7, 0xb5, 0xce, 0x8f, 0x4b, 0x41, 0x4f, 0x56, 0x4f, 0x4a, 0x4c, 0x5b, 0x3c, 0x64, 0x8f, 0xd5, 0xb5, 0xa1, 0xad, 0xa8, 0xb0, 0xa8, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xad, 0xa9, 0xab, 0xa9, 0xad, 0xd9, 0xa9, 0xa9, 0xb2, 0xb3, 0xb3, 0xb8, 0xb3, 0xb0, 0xb0, 0xb8, 0xb8, 0xb7, 0xb5, 0x93, 0x8f, 0x3f, 0x43, 0x4c, 0x4a, 0x4f, 0x45, 0x4b, 0x7e, 0x93, 0xba, 0xa6, 0xd9, 0xa4, 0xa8, 0xa4, 0xab, 0xa4, 0xd9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xa9, 0xab, 0xad, 0xd9, 0xd9, 0xa3, 0xca, 0x90, 0x6d, 0x3f, 0x4e, 0x59, 0x4e, 0x50, 0x43, 0x7f, 0x79, 0x40, 0x48, 0x4c, 0x4e, 0x56, 0x4a, 0x3f, 0x71, 0x88, 0xca, 0xaa, 0xad, 0xb0, 0xad, 0xb0, 0xaf, 0xb2, 0xaf, 0xb4, 0xb1, 0xb4, 0xb4, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xaf, 0xb4, 0xb7, 0xb2, 0xd9, 0xa7, 0xa5, 0xa5, 0xa7, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa5, 0xa1, 0xa5, 0xa1, 0xa7, 0xa0, 0x9e, 0xe6, 0x99, 0x6d, 0x38, 0x56, 0x42, 0x4a, 0x47, 0x3c, 0x64, 0x90, 0x97, 0xbe, 0xb2, 0xa8, 0xa8, 0xa2, 0xa2, 0xa2, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0xa3, 0xf2, 0xfc, 0xf6, 0xf9, 0xfb, 0xfb, 0xf5, 0xf7, 0xf7, 0xd6, 0xf3, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xfa, 0xd7, 0x88, 0x68, 0x31, 0x3f, 0x50, 0x42, 0x44, 0x42, 0x48, 0x4a, 0x45, 0x50, 0x3f, 0x78, 0x92, 0xbb, 0xa6, 0xaf, 0xad, 0xb0, 0xb0, 0xab, 0xb2, 0xaa, 0xaf, 0xad, 0xad, 0xad, 0xb2, 0xad, 0xb2, 0xad, 0xb2, 0xb2, 0xad, 0xb2, 0xb4, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xaa, 0xa9, 0xa9, 0xad, 0xd9, 0xae, 0xae, 0xca, 0x8f, 0x6b, 0x45, 0x4e, 0x4f, 0x45, 0x4a, 0x4e, 0x5b, 0x41, 0x6d, 0x90, 0x97, 0xae, 0xa1, 0xad, 0xa2, 0xb0, 0xa4, 0xab, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xaf, 0xaf, 0xb1, 0xb3, 0xb3, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb7, 0xae, 0xd5, 0x8f, 0x46, 0x42, 0x4a, 0x4f, 0x48, 0x46, 0x4b, 0x81, 0x92, 0xb5, 0xa1, 0xd9, 0xa4, 0xab, 0xa4, 0xa9, 0xd9, 0xa9, 0xaa, 0xa4, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0xab, 0xa9, 0xab, 0xd9, 0xa9, 0xa3, 0xc4, 0x92, 0x71, 0x3f, 0x4f, 0x4c, 0x4e, 0x47, 0x43, 0x7f, 0x79, 0x45, 0x48, 0x44, 0x4e, 0x4f, 0x51, 0x3f, 0x74, 0x93, 0xc4, 0xaa, 0xab, 0xab, 0xb0, 0xab, 0xb0, 0xaf, 0xb4, 0xb1, 0xb4, 0xb1, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xaf, 0xa9, 0xa5, 0xa5, 0xa7, 0xa5, 0xa5, 0xa7, 0xa5, 0xa7, 0xa1, 0xa6, 0xa7, 0xa6, 0xa5, 0xa7, 0xa7, 0xa1, 0xa6, 0xba, 0x93, 0x83, 0x4b, 0x40, 0x4a, 0x42, 0x40, 0x40, 0x4b, 0x7e, 0x93, 0xc8, 0xb4, 0xa8, 0xa8, 0xa2, 0xa2, 0xa2, 0x9f, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0xd0, 0xf7, 0xf7, 0xfa, 0xfb, 0xf9, 0xf4, 0xf3, 0xf6, 0xf6, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xd6, 0x8b, 0x87, 0x3e, 0x31, 0x46, 0x48, 0x44, 0x44, 0x4e, 0x42, 0x4a, 0x48, 0x41, 0x4b, 0x8f, 0xd2, 0xa3, 0xaa, 0xaf, 0xb0, 0xad, 0xad, 0xb2, 0xaf, 0xaf, 0xaf, 0xb2, 0xad, 0xb2, 0xad, 0xb2, 0xad, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb2, 0xb4, 0xb1, 0xd9, 0xa7, 0xa7, 0xa7, 0xd9, 0xaf, 0xaf, 0xae, 0xc4, 0x90, 0x71, 0x45, 0x4e, 0x4e, 0x4e, 0x4a, 0x4f, 0x50, 0x46, 0x71, 0x90, 0xd2, 0xa6, 0xa5, 0xad, 0xa2, 0xab, 0xab, 0xaa, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb2, 0xab, 0xaf, 0xaa, 0xaa, 0xaa, 0xb7, 0xb3, 0xb8, 0xb8, 0xb8, 0xb9, 0xae, 0x97, 0x88, 0x5f, 0x40, 0x4a, 0x4e, 0x50, 0x46, 0x4b, 0x92, 0x97, 0xa3, 0xa7, 0xa7, 0xa4, 0xa4, 0xaa, 0xaa, 0xa7, 0xa7, 0xa9, 0xab, 0xa9, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xaa, 0xa6, 0xaa, 0xaa, 0xa9, 0xab, 0xa9, 0xa9, 0xa6, 0xbb, 0x92, 0x78, 0x3f, 0x50, 0x4e, 0x4e, 0x50, 0x43, 0x7f, 0x79, 0x40, 0x48, 0x4c, 0x4e, 0x55, 0x4a, 0x4d, 0x7b, 0x98, 0xbf, 0xaa, 0xab, 0xb3, 0xab, 0xb2, 0xaa, 0xb2, 0xb2, 0xb4, 0xb4, 0xb2, 0xb4, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xaf, 0xa9, 0xa5, 0xa5, 0xa7, 0xa5, 0xa5, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa1, 0xa6, 0xa6, 0xa6, 0xa7, 0xa5, 0xa7, 0xa1, 0xa3, 0xce, 0x27, 0x7b, 0x36, 0x5b, 0x47, 0x42, 0x50, 0x3c, 0x64, 0x94, 0xd2, 0xb7, 0xb8, 0xa2, 0xa8, 0xa2, 0xa2, 0xa4, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0xa3, 0xee, 0xd7, 0xf4, 0xf4, 0xf5, 0xf5, 0xf4, 0xf3, 0xf7, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf6, 0xf7, 0xf5, 0x99, 0x8b, 0x81, 0x35, 0x3b, 0x50, 0x48, 0x44, 0x44, 0x4a, 0x42, 0x50, 0x4e, 0x3d, 0x6d, 0x98, 0xbb, 0xa6, 0xb1, 0xb2, 0xad, 0xad, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb1, 0xb1, 0xb1, 0xb4, 0xb1, 0xaf, 0xb1, 0xb1, 0xb4, 0xb1, 0xb1, 0xd9, 0xd9, 0xa7, 0xa7, 0xd9, 0xd9, 0xaf, 0xaf, 0xae, 0xbf, 0x90, 0x7b, 0x40, 0x4c, 0x59, 0x48, 0x56, 0x5b, 0x58, 0x3f, 0x74, 0x93, 0xca, 0xa6, 0xa4, 0xab, 0xab, 0xaa, 0xa4, 0xab, 0xa2, 0xab, 0xa8, 0xab, 0xa8, 0xab, 0xa8, 0xab, 0xab, 0xab, 0xb3, 0xb2, 0xab, 0xaa, 0xa7, 0xa7, 0xa6, 0xaa, 0xb7, 0xb3, 0xb8, 0xb8, 0xb9, 0xae, 0xce, 0x94, 0x60, 0x40, 0x4a, 0x44, 0x50, 0x41, 0x64, 0x90, 0xd2, 0xa3, 0xa1, 0xad, 0xa4, 0xab, 0xa4, 0xaa, 0xa6, 0xd9, 0xd9, 0xd9, 0xd9, 0xa9, 0xd9, 0xd9, 0xd9, 0xa9, 0xd9, 0xa9, 0xd9, 0xa9, 0xd9, 0xa9, 0xae, 0xaa, 0xae, 0xaa, 0xaa, 0xab, 0xa9, 0xaa, 0xa6, 0xb5, 0x98, 0x78, 0x3f, 0x5b, 0x4f, 0x4e, 0x50, 0x43, 0x7f, 0x79, 0x41, 0x4e, 0x44, 0x55, 0x4a, 0x51, 0x46, 0x7e, 0x98, 0xbc, 0xaa, 0xb2, 0xab, 0xb4, 0xab, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xaf, 0xd9, 0xa5, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa6, 0xa5, 0xa7, 0xa1, 0xa7, 0xa7, 0xa6, 0xa6, 0xa6, 0xa6, 0xa1, 0xd9, 0xa0, 0xae, 0xba, 0x92, 0x90, 0x4b, 0x3f, 0x45, 0x4a, 0x48, 0x40, 0x3b, 0x8f, 0x93, 0xc0, 0xb2, 0xa8, 0xa8, 0xa2, 0xa2, 0xab, 0x9f, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0xbf, 0xf7, 0xf6, 0xf3, 0xf4, 0xf7, 0xfa, 0xf4, 0xf4, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0x99, 0x8b, 0x7a, 0x30, 0x3b, 0x50, 0x45, 0x44, 0x4c, 0x44, 0x47, 0x4e, 0x47, 0x3d, 0x7e, 0x92, 0xb7, 0xaa, 0xad, 0xad, 0xad, 0xaf, 0xaf, 0xaf, 0xaf, 0xad, 0xad, 0xb1, 0xaf, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd9, 0xd9, 0xd9, 0xa7, 0xa7, 0xa7, 0xd9, 0xd9, 0xb1, 0xae, 0xbf, 0x93, 0x7b, 0x3d, 0x4f, 0x4c, 0x48, 0x59, 0x5b, 0x58, 0x4d, 0x78, 0x93, 0xca, 0xa5, 0xaa, 0xab, 0xab, 0xa4, 0xab, 0xaa, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb2, 0xb3, 0xa9, 0xa4, 0xd9, 0xa7, 0xa5, 0xaa, 0xaa, 0xb4, 0xb8, 0xb8, 0xb8, 0xb6, 0xce, 0x94, 0x6a, 0x3f, 0x55, 0x42, 0x50, 0x46, 0x64, 0x90, 0xce, 0xae, 0xa7, 0xd9, 0xa2, 0xa4, 0xaa, 0xaa, 0xa7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xaf, 0xd9, 0xaf, 0xd9, 0xaf, 0xd9, 0xaf, 0xd9, 0xaf, 0xd9, 0xae, 0xaa, 0xaa, 0xab, 0xaa, 0xab, 0xaf, 0xa6, 0xba, 0x92, 0x7e, 0x3f, 0x5c, 0x4e, 0x4f, 0x50, 0x43, 0x7f, 0x79, 0x40, 0x50, 0x4e, 0x55, 0x55, 0x47, 0x43, 0x80, 0x98, 0xbc, 0xaa, 0xb2, 0xaf, 0xb2, 0xaf, 0xb4, 0xb2, 0xb2, 0xb2, 0xb0, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb7, 0xb4, 0xa9, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa6, 0xa5, 0xa5, 0xa1, 0xad, 0xbe, 0xbc, 0xc4, 0x90, 0x7c, 0x3b, 0x46, 0x42, 0x44, 0x45, 0x38, 0x7b, 0x93, 0xd0, 0xb7, 0xb0, 0xa8, 0xa2, 0xa2, 0xa2, 0xa4, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0x9d, 0xf0, 0xfd, 0xf7, 0xf6, 0xf5, 0xfa, 0xfb, 0x27, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf9, 0xd6, 0xf4, 0xf6, 0xf6, 0x8a, 0x8a, 0x68, 0x30, 0x3f, 0x45, 0x44, 0x42, 0x4e, 0x4e, 0x4a, 0x47, 0x43, 0x4b, 0x8e, 0x97, 0xb6, 0xad, 0xad, 0xad, 0xaf, 0xb1, 0xb1, 0xb1, 0xad, 0xb0, 0xab, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2, 0xb1, 0xb2, 0xaf, 0xb2, 0xb1, 0xb4, 0xaa, 0xa9, 0xa4, 0xd9, 0xa4, 0xa6, 0xaa, 0xa6, 0xaa, 0xa7, 0xaf, 0xae, 0xbf, 0x98, 0x7e, 0x46, 0x4f, 0x4c, 0x44, 0x4e, 0x53, 0x5c, 0x4d, 0x7a, 0x93, 0xbf, 0xa5, 0xab, 0xa8, 0xab, 0xa4, 0xa9, 0xab, 0xa4, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb2, 0xad, 0xa9, 0xa4, 0xa1, 0xd9, 0xd9, 0xa7, 0xa7, 0xaa, 0xb3, 0xb4, 0xb8, 0xb8, 0xb6, 0xce, 0x94, 0x6b, 0x43, 0x52, 0x4e, 0x48, 0x46, 0x64, 0x90, 0xce, 0xa3, 0xa1, 0xad, 0xa4, 0xab, 0xa4, 0xaa, 0xa7, 0xd9, 0xd9, 0xd9, 0xa9, 0xd9, 0xa9, 0xd9, 0xa9, 0xd9, 0xaf, 0xd9, 0xaf, 0xd9, 0xaf, 0xd9, 0xaf, 0xd9, 0xaf, 0xa9, 0xab, 0xab, 0xab, 0xb1, 0xa6, 0xba, 0x98, 0x7c, 0x3f, 0x58, 0x55, 0x4e, 0x50, 0x47, 0x7f, 0x79, 0x40, 0x5b, 0x4c, 0x55, 0x5a, 0x47, 0x4d, 0x80, 0xd5, 0xb5, 0xaf, 0xb2, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb2, 0xb1, 0xb1, 0xb4, 0xaf, 0xa9, 0xa5, 0xa5, 0xa5, 0xa5, 0xa7, 0xa5, 0xa6, 0xa7, 0xa6, 0xa7, 0xa6, 0xa1, 0xd9, 0xa7, 0xa5, 0xa6, 0xa6, 0xa6, 0xa9, 0xd9, 0xc1, 0xc2, 0xc9, 0xba, 0xd2, 0x90, 0x68, 0x3f, 0x45, 0x42, 0x4e, 0x40, 0x57, 0x8f, 0xe8, 0xc1, 0xb8, 0xa8, 0xa8, 0xa2, 0xa2, 0xaa, 0xa0, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0xc4, 0xd6, 0xd7, 0xf7, 0xf3, 0xf9, 0xfb, 0xf9, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf3, 0x8b, 0x27, 0x57, 0x30, 0x46, 0x45, 0x44, 0x42, 0x4c, 0x4e, 0x4a, 0x53, 0x43, 0x6b, 0x8e, 0xd0, 0xb1, 0xa4, 0xb0, 0xad, 0xb4, 0xb1, 0xb1, 0xb1, 0xab, 0xb0, 0xb0, 0xad, 0xad, 0xad, 0xb2, 0xb2, 0xb2, 0xb2, 0xad, 0xb2, 0xb2, 0xb2, 0xb2, 0xa9, 0xa4, 0xa4, 0xa4, 0xaa, 0xa4, 0xaa, 0xaa, 0xa4, 0xaa, 0xd9, 0xb6, 0xbf, 0x88, 0x7e, 0x4d, 0x4a, 0x4c, 0x4c, 0x4c, 0x53, 0x58, 0x4b, 0x7b, 0x93, 0xbf, 0xa4, 0xa2, 0xa8, 0xab, 0xa8, 0xa9, 0xad, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xad, 0xb1, 0xad, 0xd9, 0xa7, 0xa7, 0xd9, 0xd9, 0xd9, 0xd9, 0xa7, 0xa5, 0xaa, 0xad, 0xb8, 0xb7, 0xae, 0xd0, 0x89, 0x6d, 0x43, 0x4a, 0x4f, 0x48, 0x46, 0x6d, 0x90, 0xce, 0xa0, 0xa7, 0xa4, 0xab, 0xa2, 0xab, 0xa4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xa9, 0xaa, 0xa9, 0xa9, 0xaf, 0xd9, 0xad, 0xad, 0xab, 0xab, 0xa9, 0xaa, 0xae, 0xbb, 0x92, 0x7e, 0x4b, 0x5c, 0x5b, 0x4f, 0x5b, 0x43, 0x7f, 0x79, 0x40, 0x50, 0x4a, 0x4a, 0x5a, 0x51, 0x4d, 0x83, 0xd5, 0xb6, 0xb1, 0xaf, 0xb1, 0xb4, 0xb1, 0xb4, 0xb2, 0xb2, 0xb0, 0xb0, 0xb2, 0xb2, 0xb4, 0xb1, 0xb4, 0xb1, 0xa9, 0xa5, 0xa5, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa5, 0xa7, 0xa7, 0xa6, 0xa7, 0xa7, 0xa4, 0xa7, 0xa6, 0xa7, 0xd9, 0xd9, 0xbe, 0xc3, 0xc1, 0xc6, 0xbc, 0xbb, 0x93, 0x81, 0x3b, 0x48, 0x4e, 0x44, 0x48, 0x3a, 0x7c, 0xf0, 0xd1, 0xad, 0xb0, 0xa8, 0xa2, 0xa2, 0xa4, 0xa5, 0x9f, 0x9a, 0x9b, 0x9a, 0x9a, 0x9d, 0xe8, 0xf6, 0xf7, 0xf7, 0xf9, 0xff, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xd6, 0xf7, 0xf3, 0x8b, 0x88, 0x39, 0x31, 0x46, 0x50, 0x44, 0x4a, 0x4c, 0x4a, 0x44, 0x50, 0x3f, 0x71, 0x98, 0xcc, 0xa7, 0xad, 0xad, 0xad, 0xaf, 0xaf, 0xb4, 0xaa, 0xb2, 0xb2, 0xaf, 0xad, 0xaf, 0xb2, 0xaf, 0xb2, 0xaf, 0xb2, 0xb4, 0xb2, 0xaf, 0xa9, 0xa9, 0xa9, 0xa4, 0xa9, 0xaa, 0xa4, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xd9, 0xae, 0xbf, 0x98, 0x80, 0x4d, 0x4f, 0x56, 0x59, 0x4f, 0x4e, 0x58, 0x46, 0x7c, 0x93, 0xbc, 0xa0, 0xab, 0xab, 0xa2, 0xa9, 0xa4, 0xa9, 0xa4, 0xa7, 0xa9, 0xa9, 0xaf, 0xaf, 0xb2, 0xb7, 0xa9, 0xd9, 0xa5, 0xa7, 0xa5, 0xa7, 0xd9, 0xd9, 0xa7, 0xd9, 0xa9, 0xaa, 0xa9, 0xb4, 0xb9, 0xb5, 0xce, 0x27, 0x6d, 0x43, 0x5b, 0x48, 0x45, 0x45, 0x6d, 0x91, 0xca, 0xa0, 0xa5, 0xd9, 0xa4, 0xaa, 0xa4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xd9, 0xaf, 0xad, 0xd9, 0xa9, 0xa9, 0xaa, 0xb9, 0xbf, 0x92, 0x80, 0x4d, 0x47, 0x56, 0x5b, 0x4a, 0x4d, 0x7f, 0x75, 0x43, 0x4f, 0x4e, 0x4f, 0x4a, 0x4a, 0x4d, 0x83, 0xd5, 0xb6, 0xd9, 0xb2, 0xb2, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb1, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa7, 0xa5, 0xa5, 0xa7, 0xa7, 0xa7, 0xa6, 0xa5, 0xa5, 0xa7, 0xa7, 0xa7, 0xa5, 0xa5, 0xa7, 0xb7, 0xbe, 0xc5, 0xc2, 0xc1, 0xc0, 0xc8, 0xbc, 0xd0, 0x98, 0x6d, 0x3f, 0x45, 0x4c, 0x59, 0x38, 0x4b, 0x90, 0xd4, 0xc1, 0xb8, 0xa8, 0xa2, 0xa2, 0xa2, 0xaa, 0x9f, 0x9c, 0x9a, 0x9c, 0x9a, 0x9a, 0xb5, 0xd7, 0xf7, 0xf2, 0xfc, 0xfb, 0xf9, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xd6, 0xf7, 0xf3, 0x8b, 0x87, 0x35, 0x37, 0x45, 0x48, 0x4e, 0x4a, 0x4a, 0x44, 0x4a, 0x45, 0x3f, 0x78, 0x98, 0xc8, 0xa5, 0xb1, 0xad, 0xaf, 0xaf, 0xad, 0xb2, 0xb2, 0xaf, 0xb1, 0xaf, 0xaf, 0xaf, 0xaf, 0xb4, 0xaf, 0xb4, 0xaf, 0xb4, 0xaf, 0xaf, 0xa9, 0xa4, 0xa7, 0xa9, 0xa9, 0xa7, 0xa7, 0xa5, 0xa5, 0xa7, 0xaa, 0xa7, 0xa9, 0xae, 0xbf, 0xef, 0x80, 0x46, 0x50, 0x55, 0x56, 0x4f, 0x59, 0x50, 0x46, 0x7c, 0x93, 0xbf, 0xa1, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xaf, 0xb4, 0xaf, 0xaf, 0xaf, 0xaf, 0xb4, 0xb1, 0xa7, 0xa7, 0xa1, 0xa7, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa7, 0xd9, 0xa9, 0xa4, 0xb1, 0xb7, 0xae, 0xce, 0x94, 0x6d, 0x3c, 0x5b, 0x45, 0x48, 0x40, 0x6d, 0x93, 0xca, 0xa1, 0xa4, 0xa9, 0xa4, 0xa9, 0xab, 0xa4, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaa, 0xad, 0xd9, 0xd9, 0xd9, 0xb1, 0xb7, 0xbe, 0xbf, 0x92, 0x80, 0x43, 0x50, 0x4f, 0x5b, 0x53, 0x49, 0x82, 0x70, 0x4f, 0x4a, 0x4f, 0x4e, 0x4a, 0x4a, 0x4d, 0x8f, 0xd5, 0xb6, 0xb2, 0xaf, 0xb2, 0xb2, 0xb2, 0xb4, 0xb2, 0xb4, 0xb4, 0xb2, 0xb1, 0xb4, 0xb4, 0xb1, 0xaf, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xa6, 0xa7, 0xa5, 0xa5, 0xa7, 0xb9, 0xbe, 0xc1, 0xc2, 0xdb, 0xc2, 0xbe, 0xdd, 0xbc, 0xc0, 0xd5, 0x7e, 0x3f, 0x46, 0x44, 0x42, 0x44, 0x3f, 0x81, 0xd5, 0xcd, 0xb4, 0xb0, 0xa2, 0xa2, 0xa2, 0xa4, 0xaa, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0x9d, 0xe6, 0xd7, 0xd6, 0xf6, 0xf5, 0xf3, 0xf9, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf6, 0xd6, 0xf5, 0xf3, 0xfd, 0x81, 0x2e, 0x3b, 0x50, 0x45, 0x4a, 0x4e, 0x4a, 0x4a, 0x44, 0x50, 0x3d, 0x7c, 0x98, 0xbc, 0xa5, 0xb2, 0xaf, 0xaf, 0xaf, 0xad, 0xb2, 0xab, 0xb2, 0xb1, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2, 0xaf, 0xb4, 0xaf, 0xaf, 0xa9, 0xa9, 0xa7, 0xa5, 0xa9, 0xa5, 0xa9, 0xaa, 0xd9, 0xd9, 0xa7, 0xa9, 0xa9, 0xaa, 0xd9, 0xb5, 0xbf, 0x93, 0x81, 0x4d, 0x4a, 0x53, 0x5d, 0x4f, 0x4c, 0x5b, 0x46, 0x7e, 0x93, 0xbf, 0xa5, 0xa9, 0xab, 0xab, 0xa9, 0xaa, 0xa9, 0xa9, 0xaa, 0xa7, 0xa5, 0xa7, 0xaf, 0xd9, 0xa5, 0xa7, 0xa7, 0xa7, 0xd9, 0xd9, 0xa7, 0xa1, 0xa7, 0xd9, 0xd9, 0xa4, 0xa7, 0xaa, 0xaf, 0xb6, 0xae, 0xce, 0x27, 0x6d, 0x3c, 0x48, 0x45, 0x45, 0x50, 0x6d, 0x91, 0xcc, 0xa0, 0xa9, 0xa7, 0xa4, 0xa7, 0xab, 0xa9, 0xaa, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaf, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xd9, 0xaa, 0xaf, 0xad, 0xd9, 0xd9, 0xb1, 0xb7, 0xc1, 0xb9, 0xc0, 0x92, 0x80, 0x4d, 0x53, 0x4e, 0x5b, 0x47, 0x4d, 0x7f, 0x75, 0x42, 0x4a, 0x4e, 0x4a, 0x4c, 0x43, 0x60, 0x83, 0xd5, 0xb7, 0xa9, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb2, 0xb4, 0xb1, 0xb2, 0xb7, 0xb4, 0xd9, 0xa5, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa7, 0xa6, 0xa5, 0xaf, 0xb9, 0xc2, 0xc5, 0xc1, 0xc1, 0xc2, 0xc6, 0xc0, 0xc0, 0xdd, 0xb6, 0xd2, 0x90, 0x64, 0x46, 0x42, 0x42, 0x5b, 0x38, 0x6f, 0x93, 0xd0, 0xbe, 0xb0, 0xa8, 0xa2, 0xa2, 0xa2, 0xb2, 0x9f, 0x9c, 0x9b, 0x9b, 0x9a, 0x9a, 0xba, 0xf6, 0xf7, 0xf3, 0xf6, 0xf9, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xd6, 0xf7, 0xd6, 0x8b, 0x7a, 0x2f, 0x3b, 0x50, 0x45, 0x4e, 0x4a, 0x4a, 0x4e, 0x44, 0x41, 0x4b, 0x81, 0xd5, 0xb6, 0xa7, 0xb2, 0xaf, 0xaf, 0xaf, 0xb2, 0xb2, 0xb3, 0xaf, 0xaf, 0xb1, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xa9, 0xaf, 0xa9, 0xa7, 0xa4, 0xa9, 0xa4, 0xd9, 0xa9, 0xa5, 0xa5, 0xa7, 0xd9, 0xd9, 0xa4, 0xa7, 0xa4, 0xd9, 0xae, 0xbf, 0xf1, 0x83, 0x4d, 0x50, 0x52, 0x5b, 0x56, 0x4c, 0x5b, 0x46, 0x7c, 0x93, 0xbf, 0xa0, 0xa4, 0xa4, 0xa4, 0xa4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa7, 0xd9, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa7, 0xa5, 0xa7, 0xd9, 0xd9, 0xd9, 0xa9, 0xa9, 0xaf, 0xb1, 0xae, 0xce, 0x99, 0x6d, 0x40, 0x48, 0x45, 0x45, 0x43, 0x6d, 0x91, 0xca, 0xa1, 0xa4, 0xa4, 0xa1, 0xa4, 0xa9, 0xab, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xd9, 0xa9, 0xd9, 0xa9, 0xd9, 0xa9, 0xa9, 0xa9, 0xaf, 0xaa, 0xad, 0xd9, 0xb4, 0xb7, 0xbe, 0xbe, 0xbe, 0xbf, 0x92, 0x80, 0x43, 0x47, 0x5b, 0x56, 0x4a, 0x4d, 0x82, 0x70, 0x4a, 0x4a, 0x4e, 0x4e, 0x42, 0x4a, 0x4d, 0x87, 0x97, 0xb6, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xaf, 0xaf, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa7, 0xa5, 0xa5, 0xa7, 0xa7, 0xa7, 0xd9, 0xa6, 0xa1, 0xb1, 0xc0, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xdb, 0xc2, 0xdd, 0xc9, 0xbc, 0xbf, 0x90, 0x7e, 0x3f, 0x45, 0x44, 0x4c, 0x41, 0x3e, 0x8e, 0xe8, 0xc9, 0xad, 0xa8, 0xa8, 0xa2, 0xa2, 0xa4, 0xab, 0x9f, 0x9b, 0x9b, 0x9b, 0x9a, 0x9d, 0xd4, 0xd7, 0xd6, 0xf4, 0xf5, 0xfa, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf7, 0xfa, 0x8a, 0x6e, 0x2d, 0x4b, 0x45, 0x48, 0x44, 0x4a, 0x44, 0x4a, 0x4e, 0x41, 0x4b, 0x8e, 0xd5, 0xb6, 0xaa, 0xb2, 0xa9, 0xad, 0xaf, 0xb2, 0xb2, 0xab, 0xb2, 0xaf, 0xaf, 0xb4, 0xaf, 0xaf, 0xa9, 0xa9, 0xa7, 0xa9, 0xa5, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa9, 0xa7, 0xa7, 0xd9, 0xaf, 0xa7, 0xa9, 0xa9, 0xaa, 0xd9, 0xae, 0xbf, 0x93, 0x80, 0x5f, 0x4a, 0x5b, 0x55, 0x4c, 0x59, 0x50, 0x46, 0x7c, 0x94, 0xba, 0xa1, 0xa1, 0xa2, 0xa1, 0xa1, 0xa1, 0xa5, 0xa1, 0xa1, 0xa1, 0xa5, 0xa7, 0xa1, 0xa1, 0xa1, 0xa5, 0xa5, 0xd9, 0xa7, 0xd9, 0xa5, 0xa9, 0xa5, 0xa1, 0xa5, 0xd9, 0xa9, 0xa9, 0xa9, 0xb6, 0xae, 0xd2, 0x8a, 0x6d, 0x3f, 0x4e, 0x45, 0x45, 0x50, 0x6d, 0x93, 0xcc, 0xa0, 0xa1, 0xa1, 0xa1, 0xa5, 0xab, 0xa9, 0xa9, 0xaa, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xd9, 0xb4, 0xb9, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0x92, 0x80, 0x4d, 0x47, 0x4e, 0x4f, 0x58, 0x49, 0x82, 0x75, 0x42, 0x4a, 0x4e, 0x4a, 0x4c, 0x43, 0x60, 0x87, 0x97, 0xb6, 0xaa, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xb1, 0xd9, 0xa5, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa7, 0xa5, 0xa5, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb1, 0xbe, 0xde, 0xc5, 0xc1, 0xbe, 0xc5, 0xdb, 0xc1, 0xc2, 0xc6, 0xc0, 0xdd, 0xc6, 0xba, 0xd2, 0x90, 0x64, 0x3d, 0x48, 0x42, 0x46, 0x3d, 0x8d, 0x93, 0xd1, 0xb4, 0xa8, 0xa8, 0xa8, 0xa2, 0x9f, 0xb3, 0x9f, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0xb5, 0xf1, 0xd7, 0xf3, 0xd6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf7, 0xd6, 0x8b, 0x89, 0x8c, 0x2e, 0x46, 0x45, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x41, 0x5f, 0x8f, 0xd4, 0xb6, 0xaf, 0xb2, 0xab, 0xaf, 0xaf, 0xb2, 0xb2, 0xb3, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf, 0xa9, 0xa7, 0xa5, 0xa4, 0xa5, 0xa9, 0xa5, 0xa9, 0xa5, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa9, 0xb2, 0xb1, 0xae, 0xba, 0xef, 0x83, 0x4d, 0x47, 0x52, 0x5b, 0x4f, 0x4c, 0x5b, 0x46, 0x7e, 0x93, 0xba, 0xa0, 0xa1, 0xa4, 0xa1, 0xa4, 0xa1, 0xa5, 0xa5, 0xa1, 0xa1, 0xa5, 0xa1, 0xa5, 0xa1, 0xa7, 0xb4, 0xbe, 0xbe, 0xbe, 0xb9, 0xb9, 0xaf, 0xd9, 0xa5, 0xa7, 0xa7, 0xa9, 0xa9, 0xa9, 0xb1, 0xae, 0xe0, 0x94, 0x6d, 0x40, 0x48, 0x45, 0x48, 0x40, 0x6d, 0x91, 0xca, 0xa1, 0xa4, 0xa4, 0xa1, 0xa4, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaf, 0xaa, 0xa9, 0xb4, 0xb9, 0xdb, 0xc2, 0xc2, 0xbe, 0xbe, 0xbf, 0x92, 0x80, 0x49, 0x47, 0x5b, 0x4f, 0x47, 0x4d, 0x82, 0x70, 0x4a, 0x4a, 0x4e, 0x44, 0x4a, 0x42, 0x60, 0x87, 0x97, 0xb1, 0xb1, 0xb2, 0xb2, 0xb4, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xaf, 0xa9, 0xa5, 0xa1, 0xa5, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xa5, 0xa5, 0xa7, 0xb7, 0xde, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xdb, 0xc1, 0xbe, 0xdd, 0xc0, 0xbb, 0x92, 0x7e, 0x3f, 0x3d, 0x4c, 0x4e, 0x46, 0x4b, 0x92, 0xd5, 0xc0, 0xab, 0xa8, 0xa8, 0xa2, 0xa2, 0xa2, 0xab, 0x9f, 0x9b, 0x9b, 0x9b, 0x9a, 0x9d, 0xce, 0xf7, 0xf6, 0xf6, 0xd6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf3, 0xf5, 0xfd, 0x88, 0x57, 0x2e, 0x46, 0x50, 0x44, 0x44, 0x4a, 0x4a, 0x4e, 0x48, 0x41, 0x64, 0x92, 0xd2, 0xb6, 0xaf, 0xab, 0xb2, 0xaf, 0xb2, 0xaf, 0xb3, 0xaa, 0xb3, 0xaf, 0xaf, 0xaa, 0xa9, 0xa4, 0xa5, 0xa4, 0xa5, 0xa7, 0xa5, 0xa9, 0xa5, 0xa9, 0xa7, 0xa9, 0xa7, 0xa5, 0xa5, 0xaf, 0xb1, 0xb4, 0xaf, 0xb2, 0xb4, 0xb9, 0xb6, 0xbf, 0x98, 0x80, 0x5f, 0x4a, 0x5b, 0x5a, 0x4e, 0x4e, 0x50, 0x46, 0x7e, 0x93, 0xbf, 0xa0, 0xa1, 0xa4, 0xa1, 0xa5, 0xa7, 0xa0, 0xa1, 0xa5, 0xa1, 0xa0, 0xa1, 0xd9, 0xb7, 0xbe, 0xc1, 0xc5, 0xc5, 0xc5, 0xdb, 0xc5, 0xbe, 0xb9, 0xb4, 0xd9, 0xa5, 0xa9, 0xa9, 0xaf, 0xb6, 0xae, 0xce, 0x8a, 0x6d, 0x40, 0x48, 0x45, 0x45, 0x45, 0x6d, 0x93, 0xcc, 0xa0, 0xa7, 0xa4, 0xa9, 0xaa, 0xad, 0xa4, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa9, 0xaf, 0xa9, 0xa9, 0xa9, 0xaf, 0xa9, 0xa9, 0xa9, 0xaf, 0xa7, 0xb1, 0xb4, 0xbe, 0xc1, 0xc1, 0xc0, 0xc1, 0xc1, 0xbe, 0xbf, 0x92, 0x80, 0x4d, 0x53, 0x4e, 0x4f, 0x50, 0x54, 0x82, 0x75, 0x40, 0x4a, 0x4f, 0x48, 0x4f, 0x40, 0x6a, 0x87, 0xd2, 0xb6, 0xaf, 0xb2, 0xb2, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xb1, 0xa9, 0xa7, 0xa5, 0xa7, 0xa5, 0xa5, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xa5, 0xd9, 0xb7, 0xc1, 0xc6, 0xc1, 0xbe, 0xc1, 0xc1, 0xc5, 0xc1, 0xc1, 0xde, 0xc1, 0xc2, 0xc2, 0xc0, 0xc6, 0xc0, 0xbc, 0xd2, 0x92, 0x64, 0x3c, 0x4e, 0x48, 0x50, 0x3b, 0x7c, 0x98, 0xd1, 0xb2, 0xa8, 0xa8, 0xa2, 0xa2, 0xa2, 0xa4, 0xa2, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0xa3, 0xf0, 0xd7, 0xd6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf3, 0x8b, 0x8f, 0x39, 0x34, 0x46, 0x45, 0x44, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x3d, 0x6b, 0x90, 0xcc, 0xae, 0xad, 0xb2, 0xb4, 0xb2, 0xb1, 0xb2, 0xb3, 0xb3, 0xaa, 0xa9, 0xa9, 0xa7, 0xa4, 0xa5, 0xa7, 0xaa, 0xa5, 0xa4, 0xa5, 0xa5, 0xa9, 0xa5, 0xa7, 0xa4, 0xaf, 0xb7, 0xbe, 0xc2, 0xde, 0xde, 0xdb, 0xc1, 0xc1, 0xbe, 0xbc, 0xbf, 0xef, 0x83, 0x4d, 0x58, 0x5b, 0x52, 0x56, 0x4c, 0x5b, 0x46, 0x7c, 0x91, 0xbc, 0xa0, 0xa1, 0xa4, 0xa1, 0xa1, 0xa1, 0xa0, 0xa5, 0xd9, 0xa1, 0xa1, 0xaf, 0xbe, 0xc2, 0xde, 0xc6, 0xc5, 0xc2, 0xc1, 0xc5, 0xc5, 0xde, 0xc6, 0xc2, 0xb9, 0xb4, 0xa9, 0xa9, 0xaf, 0xb7, 0xae, 0xe0, 0x99, 0x6d, 0x43, 0x50, 0x48, 0x48, 0x43, 0x6d, 0x91, 0xcc, 0xa1, 0xa9, 0xaf, 0xaa, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaf, 0xa7, 0xa9, 0xaf, 0xa9, 0xa7, 0xa9, 0xb9, 0xbe, 0xdb, 0xdb, 0xc2, 0xbe, 0xbe, 0xc2, 0xbe, 0xbf, 0x98, 0x80, 0x49, 0x47, 0x52, 0x4f, 0x47, 0x4d, 0x82, 0x70, 0x4a, 0x42, 0x4f, 0x48, 0x4a, 0x40, 0x60, 0x87, 0x97, 0xb1, 0xaa, 0xb4, 0xb2, 0xb2, 0xb4, 0xb2, 0xb4, 0xb4, 0xaf, 0xa5, 0xa5, 0xa7, 0xa9, 0xa7, 0xa1, 0xa5, 0xa7, 0xa7, 0xa5, 0xa7, 0xa5, 0xa5, 0xa1, 0xa7, 0xa7, 0xa5, 0xa7, 0xb9, 0xc6, 0xc6, 0xc1, 0xc1, 0xc5, 0xc1, 0xdb, 0xc1, 0xc1, 0xc1, 0xdb, 0xc1, 0xc1, 0xc2, 0xc2, 0xc2, 0xc0, 0xc0, 0xbf, 0xd5, 0x7e, 0x3f, 0x41, 0x44, 0x42, 0x3d, 0x64, 0x98, 0xd5, 0xb9, 0xad, 0xa8, 0xa8, 0xa8, 0xa2, 0xa2, 0xa4, 0x9f, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0xdc, 0xd6, 0xd6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf3, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xd6, 0xfb, 0x8b, 0x8e, 0x35, 0x3b, 0x46, 0x48, 0x44, 0x4a, 0x4a, 0x53, 0x4e, 0x48, 0x3d, 0x6d, 0x93, 0xcc, 0xae, 0xad, 0xb3, 0xb2, 0xaf, 0xb4, 0xb4, 0xab, 0xaa, 0xab, 0xa7, 0xa5, 0xa5, 0xa7, 0xaa, 0xa7, 0xa5, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xd9, 0xb7, 0xbe, 0xc5, 0xde, 0xde, 0xc6, 0xde, 0xde, 0xde, 0xde, 0xc1, 0xbc, 0xbf, 0xef, 0x83, 0x4b, 0x53, 0x5b, 0x52, 0x56, 0x4c, 0x50, 0x46, 0x7c, 0x94, 0xba, 0xa0, 0xa1, 0xa1, 0xa4, 0xa1, 0xa5, 0xa1, 0xa7, 0xa1, 0xa0, 0xd9, 0xbe, 0xc6, 0xc2, 0xc2, 0xc2, 0xc1, 0xc5, 0xc1, 0xdb, 0xc1, 0xc2, 0xc2, 0xdb, 0xdb, 0xbe, 0xb8, 0xaa, 0xd9, 0xb1, 0xa3, 0xd4, 0x8a, 0x6d, 0x40, 0x5b, 0x45, 0x5b, 0x41, 0x6d, 0x93, 0xd0, 0xa1, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaf, 0xa7, 0xa9, 0xb7, 0xc1, 0xc2, 0xc1, 0xc1, 0xc2, 0xc0, 0xc2, 0xbe, 0xbe, 0xbf, 0xec, 0x7b, 0x43, 0x53, 0x48, 0x52, 0x47, 0x49, 0x82, 0x70, 0x43, 0x4a, 0x4a, 0x48, 0x4f, 0x40, 0x6a, 0x90, 0x97, 0xb6, 0xb4, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xaf, 0xa5, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa5, 0xa5, 0xa1, 0xa5, 0xa5, 0xa5, 0xd9, 0xb7, 0xc2, 0xc6, 0xc1, 0xc2, 0xc1, 0xc1, 0xdb, 0xc1, 0xdb, 0xdb, 0xc1, 0xc1, 0xc1, 0xdb, 0xc2, 0xc2, 0xc1, 0xdb, 0xdb, 0xbc, 0xd2, 0x92, 0x64, 0x3c, 0x42, 0x5b, 0x40, 0x4b, 0x81, 0x98, 0xc8, 0xad, 0xab, 0xa8, 0xa2, 0xa2, 0xa2, 0xab, 0xa2, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9e, 0xe8, 0xf7, 0xd6, 0xf5, 0xfa, 0xf5, 0xf5, 0xf4, 0xf3, 0xfa, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xfa, 0xfa, 0x8b, 0x7c, 0x2f, 0x3b, 0x50, 0x48, 0x4c, 0x4a, 0x4a, 0x4a, 0x4f, 0x44, 0x3d, 0x71, 0x98, 0xca, 0xb1, 0xad, 0xb2, 0xa4, 0xa7, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa7, 0xa7, 0xa7, 0xaa, 0xd9, 0xa5, 0xa5, 0xa7, 0xaf, 0xa7, 0xa7, 0xa9, 0xb7, 0xc1, 0xde, 0xde, 0xc9, 0xc5, 0xc6, 0xde, 0xde, 0xde, 0xde, 0xde, 0xc2, 0xbc, 0xc4, 0xef, 0x83, 0x4d, 0x58, 0x53, 0x56, 0x4e, 0x4e, 0x4e, 0x4b, 0x7b, 0x93, 0xbf, 0xa0, 0xa4, 0xa1, 0xa4, 0xa0, 0xd9, 0xd9, 0xa0, 0xa0, 0xaf, 0xc2, 0xc6, 0xc2, 0xc2, 0xc2, 0xdb, 0xc2, 0xc2, 0xc5, 0xc2, 0xc5, 0xc2, 0xc5, 0xc6, 0xdb, 0xc5, 0xbe, 0xb9, 0xb4, 0xae, 0xae, 0xe0, 0x8a, 0x6b, 0x3f, 0x4e, 0x45, 0x50, 0x40, 0x6d, 0x91, 0xd0, 0xa5, 0xa9, 0xa9, 0xaa, 0xa9, 0xab, 0xa9, 0xa9, 0xaa, 0xd9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaf, 0xa9, 0xa9, 0xa9, 0xb9, 0xc1, 0xc2, 0xc1, 0xc1, 0xdb, 0xc1, 0xc0, 0xc1, 0xc1, 0xbe, 0xbf, 0x98, 0x7b, 0x4d, 0x51, 0x4e, 0x4f, 0x47, 0x4d, 0x82, 0x70, 0x4a, 0x42, 0x4f, 0x48, 0x4a, 0x40, 0x60, 0x88, 0x97, 0xaa, 0xb1, 0xb2, 0xaf, 0xb2, 0xb4, 0xb4, 0xaf, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xd9, 0xd9, 0xa5, 0xa5, 0xbe, 0xde, 0xbe, 0xbe, 0xde, 0xc2, 0xc1, 0xc2, 0xc1, 0xdb, 0xc1, 0xc5, 0xc1, 0xdb, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 0xdb, 0xdb, 0xbe, 0xc4, 0x98, 0x78, 0x3b, 0x45, 0x42, 0x42, 0x3c, 0x71, 0x93, 0xd2, 0xb7, 0xa9, 0xa8, 0xa2, 0xa2, 0xa2, 0xa2, 0xab, 0x9f, 0x9b, 0x9c, 0x9b, 0x9b, 0x9a, 0xba, 0xd6, 0xf6, 0xf4, 0xfa, 0xfa, 0xf4, 0xfa, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xf7, 0x27, 0x8b, 0x7a, 0x2d, 0x3d, 0x50, 0x48, 0x44, 0x4a, 0x4a, 0x53, 0x4a, 0x44, 0x3f, 0x71, 0x93, 0xca, 0xa7, 0x9f, 0xa4, 0xa4, 0xa1, 0xa1, 0xa1, 0xa4, 0xa4, 0xa4, 0xa7, 0xd9, 0xaa, 0xa5, 0xa5, 0xaa, 0xa9, 0xa5, 0xa5, 0xd9, 0xb4, 0xbe, 0xde, 0xde, 0xde, 0xc6, 0xde, 0xc5, 0xc6, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xc0, 0xc4, 0xef, 0x83, 0x5f, 0x53, 0x5b, 0x56, 0x59, 0x4c, 0x50, 0x46, 0x7c, 0x94, 0xba, 0xa6, 0xa4, 0xa4, 0xa4, 0xa1, 0xa7, 0xa5, 0xa1, 0xa7, 0xbe, 0xde, 0xc2, 0xc2, 0xc5, 0xc2, 0xdb, 0xc1, 0xdb, 0xc2, 0xdb, 0xc2, 0xc2, 0xc2, 0xdb, 0xdb, 0xc5, 0xc5, 0xde, 0xb9, 0xb7, 0xb5, 0xd4, 0x8a, 0x6d, 0x40, 0x50, 0x48, 0x50, 0x40, 0x6d, 0x93, 0xd0, 0xa5, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaf, 0xaf, 0xa7, 0xa9, 0xb9, 0xc2, 0xc2, 0xc1, 0xc2, 0xdb, 0xc1, 0xdd, 0xc2, 0xc0, 0xc1, 0xbe, 0xc4, 0xec, 0x7b, 0x43, 0x53, 0x4f, 0x53, 0x47, 0x49, 0x82, 0x70, 0x43, 0x4a, 0x4a, 0x48, 0x4a, 0x40, 0x6a, 0x90, 0x97, 0xb6, 0xb1, 0xb2, 0xb2, 0xb2, 0xb4, 0xaf, 0xa9, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xd9, 0xb7, 0xdb, 0xc6, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc5, 0xdb, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc1, 0xdb, 0xbe, 0xbc, 0x97, 0x92, 0x4b, 0x3f, 0x42, 0x48, 0x3c, 0x4b, 0x8f, 0xd5, 0xc8, 0xa4, 0xab, 0xa8, 0xa2, 0xa2, 0xa2, 0xab, 0xa2, 0x9b, 0x9c, 0x9b, 0x9b, 0x9a, 0x9a, 0xe4, 0xd7, 0xf4, 0xf3, 0xfa, 0xf5, 0xfa, 0xfc, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xfa, 0xfa, 0x8b, 0x8d, 0x2d, 0x46, 0x45, 0x48, 0x4c, 0x4a, 0x4a, 0x53, 0x4a, 0x48, 0x3d, 0x71, 0x93, 0xc4, 0xa1, 0x9f, 0xa1, 0x9f, 0xd9, 0xa1, 0xa7, 0xa4, 0xa4, 0xa5, 0xa1, 0xa5, 0xd9, 0xaa, 0xd9, 0xa5, 0xa5, 0xa7, 0xd9, 0xbe, 0xc6, 0xcb, 0xde, 0xc6, 0xdb, 0xde, 0xde, 0xc6, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdd, 0xc4, 0xef, 0x83, 0x4d, 0x50, 0x5e, 0x52, 0x59, 0x4e, 0x4e, 0x4b, 0x78, 0x93, 0xbf, 0xa0, 0xa4, 0xab, 0xa9, 0xa1, 0xa1, 0xa1, 0xa5, 0xbe, 0xdb, 0xc2, 0xc1, 0xc2, 0xc6, 0xdb, 0xc2, 0xdb, 0xc2, 0xdb, 0xdb, 0xc2, 0xc5, 0xc2, 0xc2, 0xdb, 0xdb, 0xc5, 0xc5, 0xc2, 0xc0, 0xb6, 0xe3, 0x27, 0x6d, 0x3f, 0x4e, 0x45, 0x48, 0x40, 0x6a, 0x93, 0xd2, 0xa5, 0xa9, 0xa9, 0xaa, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaf, 0xa9, 0xa9, 0xb9, 0xc5, 0xc5, 0xbe, 0xbe, 0xc2, 0xc1, 0xdb, 0xc2, 0xc0, 0xc1, 0xc1, 0xbe, 0xc8, 0x98, 0x7b, 0x43, 0x58, 0x4f, 0x4f, 0x47, 0x4d, 0x82, 0x70, 0x42, 0x4a, 0x44, 0x48, 0x48, 0x40, 0x6a, 0x87, 0x97, 0xaa, 0xaf, 0xb2, 0xb4, 0xb4, 0xaf, 0xa9, 0xa5, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa5, 0xaa, 0xa5, 0xa5, 0xa1, 0xa5, 0xa7, 0xb9, 0xdb, 0xc2, 0xbe, 0xdb, 0xc2, 0xbe, 0xc2, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc2, 0xc2, 0xc1, 0xc1, 0xc5, 0xbc, 0xcc, 0x93, 0x78, 0x3b, 0x40, 0x4f, 0x40, 0x3f, 0x78, 0x93, 0xd4, 0xa6, 0xab, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xab, 0x9c, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0xac, 0xd6, 0xfc, 0xf3, 0xf5, 0xf7, 0xf3, 0xfc, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xf9, 0xfb, 0x8a, 0x68, 0x2e, 0x46, 0x45, 0x44, 0x4c, 0x4a, 0x51, 0x4a, 0x4f, 0x44, 0x46, 0x71, 0x98, 0xca, 0xb1, 0xad, 0xa4, 0xa1, 0xa1, 0xa5, 0xa7, 0xaa, 0xaa, 0xa9, 0xd9, 0xa5, 0xa1, 0xa5, 0xa5, 0xd9, 0xb1, 0xbe, 0xc2, 0xcf, 0xde, 0xdb, 0xc6, 0xdb, 0xc6, 0xde, 0xde, 0xc5, 0xc6, 0xde, 0xde, 0xde, 0xde, 0xde, 0xc9, 0xdd, 0xc4, 0xef, 0x83, 0x60, 0x47, 0x53, 0x56, 0x59, 0x4c, 0x50, 0x3f, 0x7c, 0x93, 0xbf, 0xa1, 0xa4, 0xab, 0xab, 0xa2, 0xa1, 0xaf, 0xb9, 0xc5, 0xc5, 0xc2, 0xc2, 0xc2, 0xdb, 0xc6, 0xdb, 0xc6, 0xdb, 0xdd, 0xdb, 0xc6, 0xde, 0xc5, 0xdb, 0xc2, 0xdb, 0xc5, 0xc5, 0xde, 0xdd, 0xbc, 0xe0, 0x27, 0x6d, 0x40, 0x50, 0x48, 0x50, 0x40, 0x6d, 0x93, 0xd0, 0xa5, 0xa9, 0xaf, 0xa9, 0xa9, 0xa9, 0xab, 0xaa, 0xaf, 0xa9, 0xaf, 0xa9, 0xaf, 0xa9, 0xaf, 0xa9, 0xa5, 0xa9, 0xbe, 0xc5, 0xc5, 0xbe, 0xc1, 0xc2, 0xc1, 0xdb, 0xc2, 0xdb, 0xc0, 0xc1, 0xc0, 0xc1, 0xc4, 0xe7, 0x7b, 0x43, 0x53, 0x4f, 0x5b, 0x47, 0x4d, 0x82, 0x70, 0x43, 0x4a, 0x48, 0x4a, 0x48, 0x43, 0x60, 0x88, 0x97, 0xb6, 0xaa, 0xb4, 0xb4, 0xaf, 0xa9, 0xa1, 0xa4, 0xa7, 0xa4, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa5, 0xa5, 0xa7, 0xa7, 0xa5, 0xa5, 0xa5, 0xaf, 0xb7, 0xc2, 0xc5, 0xc2, 0xc1, 0xc2, 0xdb, 0xdb, 0xc2, 0xc2, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xdb, 0xc1, 0xdb, 0xc1, 0xc1, 0xc5, 0xc6, 0xb6, 0xd5, 0x8f, 0x4b, 0x40, 0x45, 0x48, 0x3f, 0x5f, 0x92, 0x98, 0xbe, 0xa4, 0xa2, 0xab, 0xa2, 0xa2, 0xa2, 0xab, 0xa2, 0x9b, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0xce, 0xfd, 0xfa, 0xf7, 0xfc, 0xf2, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf9, 0xfd, 0x27, 0x57, 0x2e, 0x46, 0x45, 0x4c, 0x4c, 0x4a, 0x4a, 0x53, 0x4a, 0x45, 0x41, 0x78, 0x92, 0xc8, 0xbc, 0xb9, 0xb9, 0xa4, 0xa5, 0xa7, 0xa7, 0xa7, 0xaa, 0xa9, 0xaf, 0xd9, 0xa1, 0xa5, 0xa9, 0xb9, 0xc2, 0xcb, 0xcf, 0xc2, 0xc2, 0xc2, 0xde, 0xde, 0xde, 0xdb, 0xc2, 0xde, 0xc6, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xc8, 0xc4, 0xf1, 0x83, 0x60, 0x47, 0x5b, 0x55, 0x59, 0x4e, 0x5b, 0x46, 0x78, 0x93, 0xbf, 0xa5, 0xa4, 0xab, 0xab, 0xaa, 0xb2, 0xbe, 0xc1, 0xc5, 0xc5, 0xc5, 0xde, 0xc2, 0xc2, 0xdb, 0xc6, 0xdb, 0xdd, 0xc6, 0xdd, 0xdb, 0xc9, 0xc5, 0xc6, 0xdb, 0xc5, 0xc5, 0xc1, 0xc5, 0xc6, 0xbc, 0xd4, 0x27, 0x6b, 0x3c, 0x4f, 0x45, 0x48, 0x40, 0x6a, 0x93, 0xce, 0xa4, 0xa9, 0xa9, 0xaa, 0xaf, 0xa9, 0xad, 0xa9, 0xa9, 0xaf, 0xa9, 0xa9, 0xaf, 0xa9, 0xaf, 0xa9, 0xa9, 0xb9, 0xc2, 0xc5, 0xc1, 0xbe, 0xc1, 0xc2, 0xc2, 0xc1, 0xdb, 0xdd, 0xc2, 0xc0, 0xc1, 0xbe, 0xc8, 0x98, 0x74, 0x49, 0x47, 0x5b, 0x4a, 0x50, 0x4d, 0x82, 0x70, 0x42, 0x4a, 0x4e, 0x45, 0x48, 0x40, 0x6a, 0x87, 0x97, 0xaa, 0xb1, 0xb4, 0xb4, 0xa9, 0xa4, 0xa1, 0xa5, 0xa5, 0xa5, 0xa5, 0xa7, 0xa5, 0xa7, 0xa7, 0xa7, 0xa5, 0xa5, 0xaa, 0xa5, 0xa7, 0xb1, 0xb9, 0xc2, 0xc2, 0xc1, 0xc2, 0xdb, 0xbe, 0xc2, 0xc5, 0xc2, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc1, 0xc5, 0xc2, 0xbc, 0xce, 0x93, 0x71, 0x3c, 0x42, 0x4a, 0x46, 0x3e, 0x7c, 0x93, 0xd1, 0xaa, 0xa2, 0xab, 0xa2, 0xa2, 0xa2, 0xa2, 0xb3, 0x9c, 0x9b, 0x9c, 0x9a, 0x9b, 0x9a, 0x96, 0xf2, 0xfc, 0xf7, 0xfa, 0xf3, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xfb, 0xfd, 0x89, 0x3e, 0x31, 0x46, 0x45, 0x4c, 0x4c, 0x4a, 0x4a, 0x4a, 0x4a, 0x44, 0x46, 0x71, 0x98, 0xca, 0xb9, 0xb9, 0xc1, 0xbe, 0xbe, 0xb7, 0xb1, 0xa5, 0xa4, 0xa1, 0xa1, 0xa7, 0xb4, 0xbe, 0xde, 0xc9, 0xde, 0xc2, 0xc2, 0xde, 0xde, 0xde, 0xde, 0xdb, 0xc6, 0xde, 0xde, 0xc5, 0xc5, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdd, 0xc4, 0xef, 0x83, 0x60, 0x47, 0x53, 0x5a, 0x59, 0x56, 0x4a, 0x4b, 0x78, 0x93, 0xc4, 0xa5, 0xa4, 0xa2, 0xa2, 0xb2, 0xc1, 0xc5, 0xc5, 0xc5, 0xc5, 0xc1, 0xc1, 0xc5, 0xc5, 0xc5, 0xdb, 0xc6, 0xdb, 0xdb, 0xdb, 0xc5, 0xc2, 0xc1, 0xc2, 0xc5, 0xc5, 0xc5, 0xc2, 0xc1, 0xdd, 0xbf, 0xe3, 0x91, 0x6b, 0x43, 0x5b, 0x50, 0x4f, 0x3f, 0x6a, 0x93, 0xd0, 0xa5, 0xa9, 0xaf, 0xab, 0xaa, 0xab, 0xab, 0xa9, 0xaf, 0xa9, 0xaf, 0xa9, 0xaf, 0xa9, 0xa9, 0xa9, 0xbe, 0xc5, 0xc5, 0xc1, 0xc1, 0xde, 0xc1, 0xc1, 0xc1, 0xdb, 0xc1, 0xc2, 0xc2, 0xc2, 0xc1, 0xc0, 0xc8, 0x88, 0x7a, 0x43, 0x58, 0x52, 0x52, 0x47, 0x4d, 0x82, 0x70, 0x43, 0x4a, 0x4f, 0x4f, 0x4a, 0x40, 0x60, 0x90, 0x97, 0xb6, 0xb4, 0xb4, 0xa9, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa7, 0xa5, 0xa7, 0xa7, 0xa5, 0xa7, 0xa5, 0xa7, 0xa4, 0xa5, 0xa1, 0xa9, 0xb9, 0xde, 0xde, 0xc1, 0xbe, 0xc1, 0xc2, 0xdb, 0xdb, 0xc1, 0xc2, 0xc2, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc2, 0xc5, 0xc5, 0xbe, 0xc5, 0xc0, 0xbc, 0x93, 0x81, 0x3f, 0x50, 0x44, 0x4f, 0x3b, 0x6b, 0x93, 0xd5, 0xb9, 0xa4, 0xab, 0xa2, 0xa2, 0xa2, 0xa2, 0xab, 0xa4, 0x9b, 0x9b, 0x9c, 0x9b, 0x9a, 0x9a, 0xe0, 0xd7, 0xf3, 0xf4, 0xf5, 0xfd, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0x8b, 0x90, 0x39, 0x34, 0x50, 0x48, 0x44, 0x44, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x3f, 0x78, 0x90, 0xca, 0xb7, 0xbe, 0xbe, 0xbe, 0xc0, 0xc0, 0xbe, 0xbe, 0xb4, 0xb2, 0xaa, 0xb9, 0xde, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xde, 0xde, 0xc5, 0xc5, 0xc5, 0xde, 0xde, 0xc5, 0xde, 0xc5, 0xc9, 0xc5, 0xc5, 0xde, 0xde, 0xdd, 0xcc, 0x98, 0x8f, 0x4d, 0x4e, 0x5b, 0x59, 0x4f, 0x55, 0x58, 0x4d, 0x71, 0x94, 0xbf, 0xa6, 0xa2, 0xa4, 0xb8, 0xc1, 0xde, 0xc5, 0xc5, 0xc5, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc5, 0xc5, 0xdb, 0xc5, 0xc5, 0xc5, 0xc5, 0xc1, 0xc3, 0xc1, 0xc2, 0xc1, 0xc5, 0xc1, 0xde, 0xc2, 0xbc, 0x97, 0x94, 0x60, 0x4d, 0x4a, 0x4a, 0x50, 0x3f, 0x6d, 0x91, 0xca, 0xa6, 0xaf, 0xad, 0xab, 0xa8, 0xaa, 0xab, 0xb1, 0xaf, 0xad, 0xa9, 0xad, 0xad, 0xa4, 0xb2, 0xb8, 0xc1, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc1, 0xc1, 0xc2, 0xc1, 0xc1, 0xdb, 0xc0, 0xcc, 0x98, 0x74, 0x4d, 0x58, 0x53, 0x52, 0x53, 0x4d, 0x82, 0x70, 0x43, 0x4a, 0x55, 0x4a, 0x55, 0x40, 0x60, 0x87, 0x97, 0xb1, 0xb1, 0xb3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa1, 0xa5, 0xa7, 0xa7, 0xa5, 0xa7, 0xa4, 0xa4, 0xa4, 0xa9, 0xa4, 0xa4, 0xb9, 0xc5, 0xc5, 0xc1, 0xdb, 0xdb, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xc5, 0xc5, 0xc5, 0xbe, 0xc6, 0xc0, 0xd4, 0x94, 0x4b, 0x46, 0x44, 0x59, 0x45, 0x4b, 0x81, 0x93, 0xcf, 0xa9, 0xa2, 0xa8, 0xa8, 0xa2, 0xa2, 0xab, 0xaf, 0x9c, 0x9c, 0x9b, 0x9b, 0x9c, 0x9a, 0xa3, 0xf1, 0xf6, 0xd6, 0xf4, 0xff, 0xf3, 0x27, 0x99, 0xf9, 0xd6, 0xd6, 0xd6, 0xf6, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf6, 0xd7, 0x85, 0x30, 0x3b, 0x50, 0x48, 0x42, 0x4a, 0x4e, 0x4a, 0x4a, 0x4a, 0x47, 0x40, 0x78, 0x98, 0xca, 0xbc, 0xbd, 0xbe, 0xc1, 0xbe, 0xbe, 0xc1, 0xc1, 0xc1, 0xbe, 0xc1, 0xc5, 0xde, 0xc6, 0xde, 0xc6, 0xde, 0xc6, 0xde, 0xc6, 0xde, 0xc6, 0xde, 0xc6, 0xde, 0xdb, 0xde, 0xde, 0xc5, 0xc9, 0xc5, 0xc9, 0xde, 0xde, 0xde, 0xdd, 0xc8, 0x98, 0x83, 0x4d, 0x50, 0x59, 0x56, 0x56, 0x5e, 0x47, 0x4d, 0x71, 0x93, 0xca, 0xb1, 0xb9, 0xb8, 0xc1, 0xc5, 0xc2, 0xc5, 0xc1, 0xc5, 0xc2, 0xc5, 0xc2, 0xc5, 0xc2, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc2, 0xc3, 0xc1, 0xc5, 0xc2, 0xc5, 0xc2, 0xc5, 0xdb, 0xdd, 0xbc, 0x97, 0x94, 0x60, 0x43, 0x4a, 0x4a, 0x50, 0x3f, 0x6d, 0x91, 0xdc, 0xae, 0xb1, 0xad, 0xa8, 0xab, 0xab, 0xa9, 0xaf, 0xaf, 0xa9, 0xb2, 0xa9, 0xa5, 0xb2, 0xb9, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc1, 0xc1, 0xc2, 0xc2, 0xc1, 0xdb, 0xc0, 0xca, 0x90, 0x71, 0x3f, 0x58, 0x4f, 0x55, 0x53, 0x4d, 0x82, 0x6a, 0x43, 0x55, 0x55, 0x55, 0x4a, 0x40, 0x5c, 0x90, 0x97, 0xae, 0xb1, 0xaa, 0xa4, 0xa4, 0xa4, 0xa7, 0xa7, 0xd9, 0xa6, 0xa7, 0xa6, 0xa5, 0xa7, 0xa9, 0xd9, 0xa4, 0xa1, 0xad, 0xbe, 0xc1, 0xc1, 0xc1, 0xdb, 0xc1, 0xc2, 0xdb, 0xc2, 0xdb, 0xc2, 0xdb, 0xc2, 0xdb, 0xc2, 0xdb, 0xc2, 0xdb, 0xc2, 0xc2, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xc5, 0xbe, 0xc1, 0xc6, 0xde, 0xdb, 0xbc, 0xc9, 0x94, 0x78, 0x3d, 0x44, 0x59, 0x47, 0x3d, 0x78, 0x93, 0xe4, 0xb9, 0xaa, 0xa2, 0xa8, 0xa2, 0xa8, 0xa2, 0xb2, 0xa0, 0x9b, 0x9c, 0x9b, 0x9c, 0x9a, 0x9b, 0xcc, 0xf7, 0xf1, 0xf2, 0xfc, 0x27, 0xfb, 0xf9, 0x99, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xd6, 0x8a, 0x8e, 0x2e, 0x3b, 0x5b, 0x45, 0x42, 0x4c, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x3f, 0x71, 0x93, 0xc8, 0xb9, 0xc1, 0xbd, 0xc1, 0xc1, 0xbe, 0xc1, 0xc1, 0xc1, 0xbd, 0xc5, 0xc5, 0xc9, 0xc6, 0xc9, 0xdd, 0xc9, 0xdd, 0xc9, 0xdd, 0xc9, 0xdd, 0xc9, 0xdd, 0xc9, 0xdd, 0xde, 0xdd, 0xde, 0xc6, 0xc9, 0xc6, 0xde, 0xde, 0xdb, 0xdd, 0xcc, 0xef, 0x83, 0x4d, 0x58, 0x5b, 0x52, 0x56, 0x5e, 0x58, 0x46, 0x6f, 0x93, 0xca, 0xb7, 0xc5, 0xc3, 0xde, 0xc2, 0xc2, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc6, 0xdb, 0xdb, 0xdd, 0xdb, 0xdd, 0xdb, 0xdb, 0xdb, 0xdb, 0xbf, 0x97, 0x89, 0x5f, 0x43, 0x56, 0x4c, 0x48, 0x41, 0x6d, 0x91, 0xca, 0xae, 0xaf, 0xad, 0xab, 0xab, 0xab, 0xaf, 0xb1, 0xd9, 0xb1, 0xaf, 0xa7, 0xa9, 0xb7, 0xc2, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xdb, 0xc2, 0xc0, 0xc2, 0xc2, 0xc1, 0xdb, 0xbc, 0xcc, 0x90, 0x71, 0x43, 0x4e, 0x56, 0x4f, 0x55, 0x4d, 0x82, 0x70, 0x43, 0x4a, 0x55, 0x4f, 0x55, 0x43, 0x60, 0x8f, 0x98, 0xbc, 0xb1, 0xa6, 0xa4, 0xa1, 0xaa, 0xa1, 0xa5, 0xa6, 0xae, 0xa6, 0xa6, 0xa6, 0xa7, 0xa9, 0xa7, 0xa5, 0xa7, 0xb7, 0xde, 0xc9, 0xbe, 0xc2, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc6, 0xc5, 0xde, 0xbe, 0xdd, 0xdd, 0xc0, 0xbf, 0x93, 0x92, 0x3f, 0x40, 0x59, 0x42, 0x3f, 0x4b, 0x92, 0xd5, 0xc0, 0xb7, 0xa2, 0xa2, 0xa8, 0xa2, 0xa2, 0xab, 0xab, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0xa3, 0xf1, 0xf7, 0xf6, 0xf3, 0xf3, 0xf9, 0xf5, 0xf9, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf7, 0x99, 0x81, 0x2d, 0x3f, 0x5c, 0x42, 0x4c, 0x4a, 0x4e, 0x4f, 0x4f, 0x4a, 0x47, 0x46, 0x8d, 0x93, 0xcc, 0xb9, 0xc3, 0xbe, 0xbd, 0xbe, 0xc1, 0xbe, 0xbe, 0xbe, 0xc1, 0xdb, 0xde, 0xc6, 0xc9, 0xc6, 0xc9, 0xc6, 0xc9, 0xc6, 0xc9, 0xc6, 0xc9, 0xc6, 0xc9, 0xc6, 0xc9, 0xdd, 0xdd, 0xdd, 0xc9, 0xc9, 0xc6, 0xde, 0xde, 0xdd, 0xdd, 0xcc, 0xef, 0x81, 0x4d, 0x58, 0x53, 0x5b, 0x56, 0x5b, 0x47, 0x46, 0x71, 0x90, 0xce, 0xbc, 0xc2, 0xdb, 0xdb, 0xc2, 0xc6, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xdd, 0xbc, 0x97, 0x91, 0x60, 0x40, 0x59, 0x4c, 0x4c, 0x3d, 0x6d, 0x90, 0xce, 0xa3, 0xb1, 0xad, 0xab, 0xab, 0xaf, 0xaf, 0xaf, 0xae, 0xb1, 0xd9, 0xaf, 0xb7, 0xc1, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xdb, 0xc2, 0xdd, 0xdd, 0xc2, 0xdb, 0xdb, 0xc0, 0xce, 0x88, 0x6d, 0x41, 0x59, 0x4c, 0x55, 0x53, 0x4d, 0x82, 0x6a, 0x43, 0x4a, 0x55, 0x4f, 0x55, 0x47, 0x4d, 0x81, 0x93, 0xcd, 0xb9, 0xb1, 0xa4, 0xa9, 0xa9, 0xa1, 0xa5, 0xa7, 0xa6, 0xa6, 0xa6, 0xa7, 0xa7, 0xa7, 0xa4, 0xa5, 0xb9, 0xc1, 0xc2, 0xc2, 0xc6, 0xc1, 0xc0, 0xc2, 0xc2, 0xc2, 0xdd, 0xc2, 0xc2, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc6, 0xc2, 0xc2, 0xc5, 0xc2, 0xc1, 0xdd, 0xdd, 0xc8, 0xb5, 0x97, 0x94, 0x6d, 0x3c, 0x5b, 0x40, 0x40, 0x3b, 0x7c, 0x94, 0xca, 0xb6, 0xb7, 0xa8, 0xa8, 0xa2, 0xa2, 0xa8, 0xab, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0x9a, 0xe1, 0xf6, 0xf6, 0xf6, 0xfa, 0xf9, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf9, 0xf5, 0xd6, 0xf5, 0xd6, 0xf5, 0xd6, 0xf5, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0x8a, 0x7c, 0x2d, 0x3f, 0x50, 0x48, 0x4a, 0x4c, 0x4a, 0x4f, 0x4a, 0x4a, 0x4a, 0x3f, 0x6f, 0x98, 0xd0, 0xbe, 0xc3, 0xbd, 0xc1, 0xbe, 0xbe, 0xbd, 0xc1, 0xc1, 0xdb, 0xde, 0xdd, 0xde, 0xdb, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc6, 0xde, 0xc8, 0xc9, 0xc8, 0xc6, 0xc9, 0xde, 0xde, 0xde, 0xdd, 0xca, 0xf1, 0x80, 0x4d, 0x58, 0x58, 0x58, 0x53, 0x56, 0x4a, 0x46, 0x6d, 0x90, 0xd2, 0xbc, 0xdd, 0xdb, 0xde, 0xc6, 0xc9, 0xc5, 0xc6, 0xdb, 0xc6, 0xdb, 0xc6, 0xdb, 0xc5, 0xc5, 0xc5, 0xdb, 0xc5, 0xc5, 0xc5, 0xc6, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xdd, 0xbf, 0x97, 0x89, 0x5f, 0x40, 0x52, 0x4c, 0x4c, 0x41, 0x64, 0x91, 0xd2, 0xa3, 0xaf, 0xaf, 0xab, 0xab, 0xab, 0xaf, 0xae, 0xaf, 0xd9, 0xa7, 0xb4, 0xdb, 0xc5, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xdb, 0xdd, 0xdd, 0xc0, 0xdd, 0xc2, 0xdb, 0xc2, 0xc0, 0xce, 0x88, 0x71, 0x40, 0x5b, 0x59, 0x4f, 0x51, 0x4d, 0x82, 0x70, 0x40, 0x55, 0x4f, 0x4f, 0x4a, 0x47, 0x4d, 0x81, 0x93, 0xcc, 0xb9, 0xb4, 0xad, 0xad, 0xab, 0xa4, 0xa4, 0xa9, 0xa5, 0xa5, 0xa7, 0xa7, 0xa5, 0xa4, 0xd9, 0xb8, 0xc1, 0xc5, 0xc1, 0xc1, 0xc5, 0xc2, 0xc1, 0xdb, 0xc2, 0xc2, 0xc1, 0xc2, 0xc2, 0xc1, 0xdb, 0xc2, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xdb, 0xc2, 0xc5, 0xc5, 0xc2, 0xc0, 0xbc, 0xba, 0xb5, 0xda, 0x94, 0x7e, 0x3f, 0x50, 0x4a, 0x50, 0x38, 0x6f, 0x88, 0xd5, 0xbf, 0xb7, 0xab, 0xa8, 0xa2, 0xa8, 0xa8, 0xa2, 0xab, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9a, 0xa3, 0xf1, 0xf6, 0xf6, 0xf6, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xf9, 0xfa, 0xf4, 0x99, 0xd6, 0x99, 0xd6, 0xf5, 0xd6, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf9, 0xd6, 0xfc, 0x94, 0x6e, 0x2d, 0x3f, 0x58, 0x44, 0x4e, 0x4c, 0x4f, 0x4f, 0x4a, 0x4f, 0x47, 0x43, 0x68, 0x88, 0xd4, 0xbe, 0xc1, 0xc1, 0xbe, 0xc1, 0xc1, 0xc1, 0xbe, 0xdb, 0xde, 0xdd, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xdd, 0xdd, 0xc9, 0xc6, 0xc9, 0xde, 0xdb, 0xde, 0xde, 0xc8, 0xcc, 0x91, 0x7b, 0x4d, 0x53, 0x58, 0x58, 0x55, 0x4f, 0x5b, 0x41, 0x6b, 0x90, 0xe0, 0xbc, 0xdd, 0xde, 0xdb, 0xc1, 0xc2, 0xc5, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xc5, 0xdb, 0xc5, 0xdb, 0xc5, 0xdb, 0xdb, 0xc6, 0xdd, 0xc6, 0xc6, 0xdb, 0xde, 0xc5, 0xdb, 0xc6, 0xbf, 0x92, 0x90, 0x4b, 0x43, 0x55, 0x4f, 0x4a, 0x41, 0x5f, 0x8f, 0x92, 0xae, 0xae, 0xad, 0xab, 0xab, 0xab, 0xaf, 0xaf, 0xaf, 0xa9, 0xad, 0xbe, 0xde, 0xde, 0xc1, 0xdb, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xc5, 0xc0, 0xc6, 0xc0, 0xc2, 0xc1, 0xc2, 0xc0, 0xce, 0x91, 0x6d, 0x43, 0x59, 0x56, 0x55, 0x58, 0x50, 0x82, 0x70, 0x40, 0x4a, 0x59, 0x4f, 0x42, 0x43, 0x46, 0x80, 0x93, 0xbf, 0xb1, 0xb4, 0xa8, 0xd9, 0xa8, 0xab, 0xa4, 0xa4, 0xa4, 0xa5, 0xa9, 0xa7, 0xa4, 0xa9, 0xb8, 0xc1, 0xc1, 0xc1, 0xc5, 0xc1, 0xc1, 0xc5, 0xc5, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xc5, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc1, 0xbe, 0xbf, 0xd0, 0xd0, 0xdc, 0xac, 0x94, 0x87, 0x3f, 0x50, 0x50, 0x4f, 0x40, 0x3e, 0x83, 0x99, 0xd2, 0xb6, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa2, 0xb8, 0x9f, 0x9b, 0x9c, 0x9b, 0x9a, 0x9a, 0x9a, 0xe3, 0xd7, 0xf4, 0xf3, 0xf5, 0xf6, 0xf5, 0xf4, 0xf5, 0xfa, 0xf9, 0xf6, 0xd6, 0xd6, 0xf6, 0xd6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf9, 0xf6, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xd7, 0x89, 0x57, 0x2e, 0x46, 0x5b, 0x45, 0x4a, 0x4c, 0x4a, 0x4f, 0x4f, 0x4a, 0x52, 0x43, 0x5f, 0x87, 0x97, 0xbf, 0xdd, 0xdb, 0xdb, 0xbe, 0xc2, 0xc1, 0xc1, 0xc2, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xc5, 0xde, 0xdb, 0xde, 0xc5, 0xde, 0xc6, 0xc9, 0xc6, 0xc9, 0xde, 0xc5, 0xc7, 0xdb, 0xc6, 0xc8, 0xce, 0x91, 0x78, 0x40, 0x58, 0x5e, 0x58, 0x55, 0x52, 0x4e, 0x41, 0x5f, 0x8f, 0xd5, 0xbc, 0xdd, 0xdb, 0xdb, 0xdb, 0xc5, 0xc5, 0xdb, 0xc5, 0xdb, 0xc5, 0xdb, 0xc5, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xc5, 0xc2, 0xc9, 0xc1, 0xc9, 0xc1, 0xc7, 0xc1, 0xc5, 0xc0, 0xc4, 0x98, 0x87, 0x3f, 0x43, 0x52, 0x55, 0x55, 0x47, 0x4b, 0x83, 0x98, 0xb5, 0xae, 0xad, 0xab, 0xb3, 0xab, 0xb3, 0xd9, 0xd9, 0xad, 0xbe, 0xc5, 0xc1, 0xbe, 0xc1, 0xc5, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xdb, 0xc1, 0xc1, 0xc5, 0xc2, 0xc2, 0xc1, 0xc1, 0xc1, 0xc5, 0xbc, 0xce, 0x89, 0x74, 0x43, 0x58, 0x55, 0x51, 0x53, 0x4d, 0x82, 0x70, 0x40, 0x4f, 0x4c, 0x4f, 0x4a, 0x53, 0x3f, 0x78, 0x91, 0xca, 0xb6, 0xb4, 0xad, 0xa4, 0xad, 0xb0, 0xab, 0xa4, 0xa4, 0xaa, 0xa9, 0xa4, 0xa4, 0xb2, 0xdb, 0xc3, 0xc1, 0xc1, 0xc1, 0xc5, 0xc1, 0xc1, 0xc2, 0xc1, 0xc2, 0xdb, 0xc2, 0xc2, 0xc2, 0xc1, 0xc5, 0xc1, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xdb, 0xbe, 0xd0, 0xf0, 0xf4, 0xf6, 0xe9, 0x98, 0x89, 0x4b, 0x46, 0x5b, 0x5b, 0x40, 0x3c, 0x6b, 0x88, 0x94, 0xbf, 0xa3, 0xa4, 0xa4, 0xa8, 0xa4, 0xa4, 0xd9, 0xae, 0x9c, 0x9a, 0x9b, 0xac, 0xb5, 0xac, 0xce, 0x99, 0xd7, 0xd7, 0x27, 0xd6, 0xd6, 0xf5, 0xf5, 0xf9, 0xf9, 0xf6, 0xd6, 0xf6, 0xd6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xfa, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0x99, 0xd7, 0x88, 0x3e, 0x2e, 0x4d, 0x50, 0x4f, 0x4c, 0x4f, 0x4e, 0x4a, 0x53, 0x4a, 0x4a, 0x40, 0x4d, 0x83, 0xec, 0xc4, 0xc0, 0xdd, 0xdb, 0xc6, 0xc1, 0xc1, 0xc1, 0xc5, 0xde, 0xdd, 0xdd, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc5, 0xc5, 0xcb, 0xc1, 0xc3, 0xc3, 0xcb, 0xde, 0xc9, 0xc8, 0x97, 0x88, 0x71, 0x40, 0x5b, 0x53, 0x5e, 0x5a, 0x59, 0x4e, 0x45, 0x4b, 0x81, 0xec, 0xbf, 0xdd, 0xdd, 0xc3, 0xdb, 0xc3, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc5, 0xc9, 0xc7, 0xc1, 0xc1, 0xc3, 0xc1, 0xc5, 0xc2, 0xc0, 0xce, 0x93, 0x81, 0x3f, 0x47, 0x5d, 0x51, 0x53, 0x49, 0x3f, 0x7c, 0x91, 0xc4, 0xae, 0xd9, 0xb3, 0xab, 0xb3, 0xab, 0xab, 0xad, 0xbe, 0xc1, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc7, 0xc1, 0xc1, 0xc1, 0xc9, 0xc3, 0xc1, 0xc1, 0xbc, 0xd2, 0x87, 0x60, 0x43, 0x5e, 0x53, 0x4a, 0x51, 0x50, 0x82, 0x70, 0x40, 0x59, 0x4f, 0x4c, 0x4e, 0x47, 0x43, 0x6d, 0x91, 0xce, 0xbc, 0xb7, 0xb4, 0xad, 0xab, 0xa9, 0xab, 0xaa, 0xaa, 0xa7, 0xa5, 0xa7, 0xaf, 0xb9, 0xc5, 0xc2, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc6, 0xc2, 0xc5, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc5, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc8, 0xe4, 0xe6, 0xe6, 0xf1, 0xf1, 0xd6, 0x91, 0x6b, 0x3f, 0x66, 0x4c, 0x42, 0x3c, 0x3a, 0x78, 0x91, 0x93, 0xca, 0xb6, 0xa5, 0xa0, 0xa1, 0xa0, 0xa6, 0xbb, 0xc4, 0xbb, 0xce, 0xd2, 0x78, 0x96, 0x57, 0x8d, 0x8e, 0x91, 0x8b, 0x8b, 0xd7, 0x99, 0xd6, 0x99, 0xf4, 0xfa, 0xf7, 0xf7, 0xf5, 0xf4, 0xf3, 0xfa, 0xf9, 0xf4, 0xfa, 0xf4, 0xf5, 0xfa, 0xfb, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0x8b, 0x87, 0x39, 0x30, 0x4d, 0x5b, 0x4a, 0x4f, 0x4f, 0x4a, 0x4f, 0x4a, 0x4a, 0x53, 0x47, 0x40, 0x7b, 0x94, 0xd2, 0xdd, 0xdd, 0xdd, 0xbe, 0xc1, 0xc3, 0xc3, 0xc3, 0xde, 0xde, 0xde, 0xc9, 0xde, 0xc9, 0xde, 0xc9, 0xc9, 0xde, 0xc9, 0xde, 0xc9, 0xde, 0xc9, 0xde, 0xc9, 0xc5, 0xc3, 0xcb, 0xc7, 0xde, 0xc7, 0xdb, 0xc2, 0xc8, 0xca, 0x98, 0x8f, 0x5f, 0x47, 0x5b, 0x5e, 0x53, 0x5a, 0x59, 0x4e, 0x45, 0x46, 0x71, 0x94, 0xd4, 0xbc, 0xde, 0xdb, 0xc1, 0xde, 0xc6, 0xc2, 0xdd, 0xc2, 0xdd, 0xc2, 0xdd, 0xc6, 0xdd, 0xc6, 0xdd, 0xc6, 0xdd, 0xc6, 0xc2, 0xc1, 0xc5, 0xc7, 0xcb, 0xc3, 0xc5, 0xc7, 0xc8, 0xbf, 0x97, 0x90, 0x74, 0x3f, 0x47, 0x5a, 0x51, 0x55, 0x53, 0x4d, 0x64, 0x90, 0xec, 0xb5, 0xa6, 0xaf, 0xab, 0xab, 0xab, 0xad, 0xb4, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xc0, 0xc1, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc1, 0xc3, 0xc3, 0xbe, 0xbd, 0xc2, 0xc7, 0xc0, 0xbf, 0x98, 0x7e, 0x4d, 0x58, 0x47, 0x53, 0x53, 0x47, 0x5c, 0x82, 0x67, 0x4a, 0x4f, 0x4c, 0x4f, 0x4a, 0x4a, 0x46, 0x60, 0x87, 0x92, 0xb5, 0xb7, 0xbc, 0xb1, 0xa1, 0xa4, 0xaa, 0xaa, 0xaa, 0xa0, 0xa4, 0xb7, 0xc2, 0xc5, 0xc2, 0xc1, 0xc0, 0xc1, 0xc0, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xdd, 0xc0, 0xc6, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xc0, 0xe4, 0xe8, 0xe6, 0xe0, 0xe3, 0xe6, 0xf1, 0x99, 0x78, 0x3f, 0x5b, 0x4f, 0x4c, 0x4a, 0x38, 0x36, 0x71, 0x92, 0x93, 0x98, 0x97, 0xcd, 0xd2, 0xd2, 0xd2, 0x97, 0x92, 0x8e, 0x78, 0x57, 0x35, 0x2f, 0x2d, 0x2d, 0x39, 0x57, 0x7a, 0x8e, 0x91, 0x8a, 0xd7, 0x8b, 0x99, 0xf2, 0xf2, 0xf4, 0xf9, 0xf5, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf3, 0xf9, 0x99, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0x99, 0x8b, 0x8e, 0x2f, 0x37, 0x67, 0x50, 0x4a, 0x4c, 0x4f, 0x4f, 0x4a, 0x53, 0x4a, 0x4f, 0x47, 0x41, 0x64, 0x90, 0xe9, 0xc4, 0xbc, 0xcd, 0xdd, 0xdb, 0xc7, 0xc3, 0xc3, 0xc3, 0xc5, 0xdb, 0xde, 0xc5, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xc5, 0xdb, 0xde, 0xdb, 0xde, 0xde, 0xdb, 0xc3, 0xde, 0xde, 0xde, 0xc9, 0xbf, 0x97, 0x94, 0x7b, 0x4b, 0x47, 0x53, 0x5e, 0x55, 0x55, 0x59, 0x59, 0x50, 0x41, 0x57, 0x90, 0xf1, 0xba, 0xc8, 0xdd, 0xde, 0xc1, 0xc2, 0xc2, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xde, 0xde, 0xdb, 0xdb, 0xc1, 0xc5, 0xc6, 0xc0, 0xc8, 0xca, 0x94, 0x83, 0x4b, 0x4d, 0x56, 0x4a, 0x4a, 0x5a, 0x4a, 0x50, 0x4d, 0x78, 0x8a, 0xe3, 0xb5, 0xa6, 0xb1, 0xb4, 0xad, 0xb2, 0xbe, 0xc1, 0xc2, 0xc2, 0xc2, 0xc5, 0xc5, 0xc2, 0xc5, 0xc5, 0xc5, 0xc2, 0xc5, 0xc1, 0xdb, 0xc1, 0xdb, 0xc5, 0xc2, 0xc5, 0xc9, 0xc2, 0xbc, 0x97, 0x90, 0x6d, 0x46, 0x66, 0x42, 0x4a, 0x56, 0x49, 0x50, 0x82, 0x67, 0x4a, 0x55, 0x59, 0x4f, 0x4e, 0x4f, 0x43, 0x46, 0x7b, 0x94, 0xc4, 0xb6, 0xb7, 0xb9, 0xb9, 0xad, 0xa4, 0xa4, 0xa4, 0xaa, 0xb4, 0xbe, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xdb, 0xc1, 0xdb, 0xc2, 0xdb, 0xc2, 0xdb, 0xc2, 0xc5, 0xdb, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc5, 0xdb, 0xc2, 0xc2, 0xc2, 0xc5, 0xc2, 0xdd, 0xcd, 0xe8, 0xee, 0xe0, 0xe6, 0xe6, 0xe6, 0xe6, 0x8a, 0x80, 0x46, 0x53, 0x4c, 0x59, 0x4c, 0x40, 0x36, 0x34, 0x3d, 0x71, 0x7c, 0x8e, 0x97, 0x8e, 0xce, 0x7c, 0x71, 0x57, 0x35, 0x2e, 0x2d, 0x2d, 0x30, 0x2e, 0x2e, 0x2d, 0x2e, 0x2d, 0x35, 0x68, 0x8d, 0x8e, 0x88, 0x8b, 0x8b, 0xfd, 0x27, 0xf3, 0xf9, 0xfc, 0xf9, 0xf3, 0xfa, 0xfa, 0xf9, 0xf3, 0xf3, 0xf5, 0xfb, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0x99, 0x8b, 0x81, 0x2d, 0x3a, 0x5c, 0x42, 0x52, 0x4f, 0x55, 0x4f, 0x52, 0x4a, 0x53, 0x4a, 0x53, 0x45, 0x4b, 0x7e, 0xd7, 0xe8, 0xbf, 0xbf, 0xdd, 0xdd, 0xdb, 0xc3, 0xc5, 0xde, 0xde, 0xc9, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xcf, 0xde, 0xdd, 0xdd, 0xc4, 0xce, 0x91, 0x8f, 0x64, 0x5c, 0x4d, 0x55, 0x5e, 0x53, 0x4a, 0x59, 0x59, 0x5b, 0x46, 0x3f, 0x78, 0x94, 0x97, 0xc4, 0xba, 0xcd, 0xc0, 0xc6, 0xc6, 0xdb, 0xc6, 0xdb, 0xc6, 0xdb, 0xc6, 0xdb, 0xc6, 0xdb, 0xc6, 0xdb, 0xc6, 0xdb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xc8, 0xc4, 0xca, 0x94, 0x88, 0x6d, 0x3f, 0x50, 0x56, 0x4f, 0x59, 0x4f, 0x4c, 0x4f, 0x46, 0x4b, 0x83, 0xd7, 0x97, 0xba, 0xa3, 0xa6, 0xae, 0xdb, 0xde, 0xc2, 0xc1, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc5, 0xc2, 0xc5, 0xc2, 0xc1, 0xc5, 0xc2, 0xdb, 0xdd, 0xdd, 0xdd, 0xc8, 0xc0, 0xbc, 0xca, 0x93, 0x7e, 0x3f, 0x5b, 0x56, 0x4c, 0x44, 0x52, 0x47, 0x5c, 0x82, 0x67, 0x47, 0x55, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x40, 0x6a, 0x90, 0x98, 0xcd, 0xa6, 0xb7, 0xbe, 0xb9, 0xb8, 0xb2, 0xb2, 0xbe, 0xc1, 0xc1, 0xc1, 0xc1, 0xdb, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xc1, 0xc1, 0xc1, 0xc2, 0xc1, 0xc2, 0xc2, 0xc2, 0xdb, 0xc2, 0xdb, 0xc2, 0xdb, 0xc2, 0xc2, 0xc2, 0xc1, 0xc1, 0xc1, 0xbe, 0xc0, 0xe4, 0xf0, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xe6, 0x27, 0x83, 0x43, 0x5c, 0x59, 0x4c, 0x4c, 0x4c, 0x42, 0x36, 0x31, 0x31, 0x32, 0x3b, 0x3b, 0x35, 0x35, 0x31, 0x2e, 0x2e, 0x2e, 0x31, 0x32, 0x32, 0x34, 0x34, 0x31, 0x31, 0x30, 0x2e, 0x2d, 0x2d, 0x2d, 0x35, 0x8c, 0x71, 0x92, 0x89, 0x8b, 0x8b, 0x27, 0x27, 0xf9, 0xf9, 0xf9, 0xf9, 0xfb, 0xfc, 0xf9, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0x99, 0x8b, 0x7c, 0x2d, 0x3f, 0x5c, 0x40, 0x4f, 0x59, 0x4f, 0x55, 0x4f, 0x53, 0x4a, 0x53, 0x4a, 0x58, 0x46, 0x4b, 0x81, 0x94, 0x98, 0xd2, 0xce, 0xc4, 0xc0, 0xc0, 0xc0, 0xc9, 0xbf, 0xc8, 0xdd, 0xc6, 0xdd, 0xc6, 0xdd, 0xc6, 0xdd, 0xc6, 0xdd, 0xc6, 0xdd, 0xc6, 0xdd, 0xc6, 0xc8, 0xc8, 0xc8, 0xc8, 0xcc, 0xc4, 0xc4, 0xe0, 0x94, 0x87, 0x6d, 0x4d, 0x4d, 0x58, 0x5e, 0x5b, 0x52, 0x56, 0x52, 0x59, 0x5b, 0x5b, 0x4d, 0x4b, 0x78, 0x99, 0x90, 0xce, 0xca, 0xc4, 0xc8, 0xc0, 0xc8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xdd, 0xbf, 0xdd, 0xcc, 0xcc, 0xc4, 0xc4, 0xca, 0xe0, 0x93, 0x89, 0x6f, 0x3f, 0x67, 0x4a, 0x42, 0x63, 0x4f, 0x4c, 0x4c, 0x4c, 0x5b, 0x43, 0x6b, 0x83, 0x91, 0x93, 0xce, 0xbb, 0xbf, 0xbf, 0xbf, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xdd, 0xbf, 0xbf, 0xc4, 0xc4, 0xbb, 0x97, 0x93, 0x8f, 0x4b, 0x47, 0x55, 0x59, 0x4e, 0x4e, 0x48, 0x58, 0x50, 0x82, 0x67, 0x4a, 0x55, 0x5a, 0x55, 0x4f, 0x4f, 0x56, 0x47, 0x46, 0x71, 0x98, 0xf0, 0x97, 0xc8, 0xbc, 0xc0, 0xb9, 0xbe, 0xc2, 0xc0, 0xc0, 0xc0, 0xc2, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xbe, 0xbc, 0xcc, 0xf0, 0xed, 0xe6, 0xe6, 0xe7, 0xe6, 0xe6, 0x92, 0x27, 0x85, 0x46, 0x66, 0x59, 0x44, 0x4c, 0x4c, 0x4c, 0x42, 0x3c, 0x36, 0x36, 0x32, 0x36, 0x33, 0x32, 0x34, 0x32, 0x32, 0x34, 0x32, 0x31, 0x31, 0x32, 0x32, 0x31, 0x30, 0x31, 0x31, 0x2e, 0x2e, 0x2f, 0x2d, 0x2d, 0x2f, 0x2f, 0x57, 0x7c, 0x87, 0x27, 0x8b, 0x8a, 0x27, 0x27, 0xf3, 0xf4, 0xfa, 0xfa, 0xf3, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0x8a, 0x8d, 0x2d, 0x3e, 0x67, 0x50, 0x52, 0x4f, 0x55, 0x4f, 0x55, 0x52, 0x53, 0x4f, 0x53, 0x55, 0x43, 0x3f, 0x4b, 0x7c, 0x89, 0x91, 0x92, 0x97, 0xd4, 0xd2, 0xd0, 0xd2, 0xce, 0xca, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xcc, 0xd0, 0xcc, 0xd2, 0xce, 0xce, 0xce, 0xce, 0xe0, 0x98, 0x89, 0x87, 0x6d, 0x4d, 0x5c, 0x53, 0x5b, 0x5d, 0x4f, 0x5b, 0x5b, 0x4f, 0x4a, 0x55, 0x53, 0x50, 0x40, 0x3f, 0x7b, 0x88, 0x94, 0x92, 0x92, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xe0, 0xe0, 0xe0, 0xe3, 0xec, 0x91, 0x99, 0x87, 0x6d, 0x4d, 0x4d, 0x58, 0x56, 0x42, 0x59, 0x4e, 0x42, 0x59, 0x42, 0x4c, 0x5b, 0x43, 0x64, 0x7b, 0x90, 0x94, 0x93, 0x92, 0xd4, 0xd2, 0xd2, 0xd2, 0xd2, 0xd0, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd4, 0xd4, 0x97, 0xd4, 0xe6, 0xe7, 0x92, 0x92, 0x91, 0x93, 0x8f, 0x64, 0x4d, 0x63, 0x4a, 0x59, 0x4c, 0x50, 0x4f, 0x47, 0x5c, 0x82, 0x67, 0x51, 0x5a, 0x55, 0x4f, 0x4f, 0x4f, 0x5a, 0x59, 0x40, 0x4b, 0x71, 0x8e, 0x93, 0x93, 0xd5, 0xd5, 0xd4, 0xd4, 0xd0, 0xd2, 0xd0, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd2, 0xd4, 0xd2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xe3, 0xf6, 0xed, 0xe6, 0xe7, 0xe6, 0xe3, 0xe3, 0xed, 0x8a, 0x83, 0x49, 0x67, 0x59, 0x4c, 0x4c, 0x4c, 0x59, 0x5b, 0x4e, 0x3c, 0x38, 0x38, 0x36, 0x33, 0x36, 0x36, 0x36, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x30, 0x2e, 0x31, 0x30, 0x2e, 0x2e, 0x2e, 0x2d, 0x2d, 0x2d, 0x57, 0x7a, 0x88, 0x8a, 0x8b, 0x8a, 0xf9, 0xf9, 0xf3, 0xfb, 0xfa, 0xf9, 0xf4, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0x99, 0x8a, 0x6f, 0x2f, 0x5f, 0x5c, 0x52, 0x4a, 0x59, 0x4f, 0x52, 0x4f, 0x53, 0x4a, 0x53, 0x5a, 0x5a, 0x51, 0x67, 0x46, 0x3d, 0x5f, 0x76, 0x83, 0x87, 0x90, 0x88, 0xf1, 0x91, 0x89, 0x89, 0x91, 0x89, 0x91, 0x89, 0x91, 0x89, 0x91, 0x89, 0x91, 0x89, 0x91, 0x89, 0x91, 0x88, 0x91, 0x91, 0x94, 0x91, 0x94, 0x88, 0x87, 0x80, 0x6a, 0x3f, 0x45, 0x66, 0x59, 0x59, 0x4e, 0x4e, 0x50, 0x5b, 0x4a, 0x4a, 0x55, 0x55, 0x55, 0x58, 0x50, 0x3f, 0x5f, 0x74, 0x81, 0x87, 0x90, 0x87, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x88, 0x90, 0x91, 0x88, 0x90, 0x88, 0x87, 0x80, 0x71, 0x4d, 0x3a, 0x5c, 0x61, 0x4a, 0x5d, 0x5a, 0x4a, 0x43, 0x50, 0x59, 0x4c, 0x4c, 0x55, 0x58, 0x43, 0x3f, 0x64, 0x78, 0x81, 0x81, 0x8f, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x88, 0x90, 0x88, 0x90, 0x88, 0x90, 0x91, 0x90, 0x88, 0x90, 0x87, 0x87, 0x8f, 0x78, 0x4b, 0x3f, 0x61, 0x5e, 0x5a, 0x5a, 0x47, 0x50, 0x50, 0x53, 0x5f, 0x7f, 0x67, 0x51, 0x5e, 0x55, 0x55, 0x4f, 0x59, 0x5a, 0x4c, 0x58, 0x41, 0x46, 0x4d, 0x71, 0x7b, 0x83, 0x8f, 0x90, 0x88, 0x88, 0x89, 0x91, 0x88, 0x90, 0x91, 0x91, 0x91, 0x90, 0x91, 0x90, 0x91, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x27, 0xf2, 0xeb, 0xe7, 0xe6, 0xe6, 0xe6, 0xe6, 0x94, 0x2b, 0x7b, 0x5c, 0x66, 0x59, 0x48, 0x59, 0x4f, 0x4a, 0x4a, 0x63, 0x61, 0x55, 0x3c, 0x38, 0x38, 0x33, 0x33, 0x34, 0x34, 0x32, 0x30, 0x30, 0x31, 0x34, 0x34, 0x32, 0x32, 0x2e, 0x31, 0x31, 0x31, 0x2e, 0x31, 0x2e, 0x2e, 0x30, 0x30, 0x2d, 0x2d, 0x2d, 0x39, 0x7a, 0x88, 0x27, 0x8b, 0xfb, 0xf3, 0xfa, 0xfc, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0x8b, 0x81, 0x6f, 0x6a, 0x4d, 0x47, 0x4a, 0x4f, 0x55, 0x55, 0x55, 0x4f, 0x53, 0x53, 0x55, 0x51, 0x55, 0x4a, 0x50, 0x50, 0x40, 0x50, 0x4d, 0x5f, 0x6d, 0x6f, 0x71, 0x6f, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x78, 0x78, 0x78, 0x74, 0x71, 0x6a, 0x46, 0x46, 0x58, 0x4a, 0x42, 0x59, 0x4e, 0x56, 0x5b, 0x50, 0x4e, 0x53, 0x55, 0x5e, 0x55, 0x55, 0x59, 0x53, 0x47, 0x3f, 0x46, 0x4b, 0x60, 0x60, 0x6b, 0x60, 0x6b, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x64, 0x6b, 0x64, 0x64, 0x5f, 0x46, 0x46, 0x5c, 0x66, 0x47, 0x55, 0x55, 0x55, 0x5d, 0x4a, 0x50, 0x47, 0x4e, 0x59, 0x4c, 0x4f, 0x55, 0x58, 0x58, 0x46, 0x3d, 0x3d, 0x64, 0x64, 0x64, 0x64, 0x6b, 0x5f, 0x6b, 0x6a, 0x6b, 0x6b, 0x64, 0x6b, 0x6a, 0x6b, 0x6b, 0x6a, 0x6b, 0x64, 0x6b, 0x6b, 0x64, 0x5f, 0x4b, 0x46, 0x3f, 0x5c, 0x53, 0x55, 0x63, 0x55, 0x53, 0x50, 0x43, 0x50, 0x5c, 0x82, 0x67, 0x51, 0x55, 0x55, 0x4a, 0x4a, 0x5a, 0x59, 0x42, 0x59, 0x5b, 0x47, 0x53, 0x43, 0x4d, 0x4d, 0x60, 0x6b, 0x6b, 0x6d, 0x6b, 0x6b, 0x6d, 0x6d, 0x6b, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x7b, 0x27, 0xef, 0xea, 0x8e, 0xe7, 0xec, 0xec, 0x8a, 0x89, 0x70, 0x4d, 0x66, 0x66, 0x4a, 0x4a, 0x4a, 0x5d, 0x55, 0x51, 0x55, 0x5e, 0x5d, 0x4a, 0x40, 0x3c, 0x36, 0x36, 0x36, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x32, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x31, 0x31, 0x2e, 0x2d, 0x31, 0x30, 0x2d, 0x2d, 0x2d, 0x8c, 0x8f, 0xff, 0x8b, 0x27, 0xf9, 0xfb, 0xf9, 0xfa, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf5, 0xf5, 0x99, 0xf9, 0x99, 0x99, 0x99, 0x8e, 0x82, 0x73, 0x43, 0x58, 0x50, 0x4c, 0x5a, 0x5a, 0x5a, 0x53, 0x4f, 0x53, 0x53, 0x55, 0x52, 0x53, 0x5b, 0x4a, 0x5b, 0x47, 0x4a, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x40, 0x43, 0x40, 0x43, 0x40, 0x43, 0x47, 0x47, 0x53, 0x5b, 0x53, 0x5b, 0x52, 0x56, 0x52, 0x4f, 0x52, 0x53, 0x52, 0x53, 0x52, 0x52, 0x52, 0x53, 0x4f, 0x5b, 0x53, 0x53, 0x58, 0x47, 0x50, 0x47, 0x50, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x58, 0x47, 0x58, 0x4a, 0x47, 0x58, 0x5b, 0x53, 0x4a, 0x53, 0x53, 0x52, 0x52, 0x4f, 0x52, 0x53, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4a, 0x4a, 0x4a, 0x50, 0x50, 0x45, 0x47, 0x42, 0x43, 0x43, 0x47, 0x40, 0x43, 0x40, 0x43, 0x47, 0x43, 0x40, 0x43, 0x40, 0x43, 0x40, 0x47, 0x47, 0x45, 0x4a, 0x47, 0x50, 0x53, 0x50, 0x53, 0x4a, 0x55, 0x4a, 0x53, 0x4f, 0x53, 0x4e, 0x47, 0x67, 0x7f, 0x66, 0x42, 0x59, 0x4f, 0x52, 0x55, 0x4f, 0x55, 0x55, 0x4f, 0x4f, 0x53, 0x53, 0x58, 0x53, 0x58, 0x47, 0x47, 0x47, 0x43, 0x47, 0x43, 0x47, 0x43, 0x47, 0x47, 0x43, 0x47, 0x43, 0x47, 0x43, 0x47, 0x43, 0x47, 0x43, 0x47, 0x43, 0x47, 0x43, 0x47, 0x47, 0x47, 0x43, 0x47, 0x43, 0x47, 0x43, 0x47, 0x43, 0x49, 0x47, 0x49, 0x43, 0x43, 0x49, 0x76, 0x8a, 0x27, 0x27, 0xef, 0x89, 0x8a, 0x2a, 0x89, 0x76, 0x5c, 0x58, 0x66, 0x61, 0x51, 0x5a, 0x5a, 0x55, 0x5a, 0x55, 0x55, 0x52, 0x52, 0x5b, 0x56, 0x5b, 0x4f, 0x42, 0x3c, 0x3c, 0x36, 0x36, 0x33, 0x33, 0x33, 0x32, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x30, 0x2e, 0x30, 0x31, 0x2e, 0x31, 0x31, 0x2e, 0x2d, 0x2d, 0x2f, 0x7c, 0x91, 0x8b, 0x27, 0xf2, 0xfb, 0xfa, 0xf6, 0xf6, 0xf6, 0xf3, 0xf6, 0xf7, 0xf7, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfb, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf5, 0xf4, 0xf5, 0x99, 0xf9, 0xf7, 0x8a, 0x8c, 0x00, 0x7f, 0x01, 0x45, 0x5c, 0x4e, 0x55, 0x5a, 0x5a, 0x55, 0x53, 0x53, 0x53, 0x52, 0x53, 0x4f, 0x53, 0x52, 0x53, 0x56, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4a, 0x53, 0x4a, 0x53, 0x4a, 0x53, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5b, 0x53, 0x5b, 0x53, 0x5b, 0x5b, 0x5b, 0x53, 0x52, 0x5b, 0x52, 0x5b, 0x53, 0x5b, 0x53, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x52, 0x53, 0x4f, 0x53, 0x56, 0x52, 0x52, 0x53, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x53, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x52, 0x4a, 0x4f, 0x4f, 0x4a, 0x53, 0x4a, 0x53, 0x4a, 0x4a, 0x4f, 0x53, 0x4a, 0x53, 0x4a, 0x53, 0x4a, 0x4f, 0x4f, 0x4a, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x50, 0x4a, 0x67, 0x7f, 0x67, 0x4a, 0x4e, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x53, 0x4f, 0x4f, 0x52, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x53, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x53, 0x53, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x6a, 0x82, 0x87, 0x89, 0x26, 0x89, 0x86, 0x83, 0x70, 0x50, 0x40, 0x5b, 0x66, 0x66, 0x51, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x56, 0x52, 0x52, 0x56, 0x56, 0x5b, 0x5b, 0x5b, 0x56, 0x4e, 0x45, 0x3c, 0x3c, 0x38, 0x38, 0x33, 0x33, 0x32, 0x33, 0x31, 0x31, 0x2e, 0x31, 0x2e, 0x31, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x2f, 0x2d, 0x2f, 0x6f, 0x94, 0x8a, 0xff, 0xf2, 0xf4, 0xf6, 0xf7, 0xf6, 0xf4, 0xd6, 0xf3, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf9, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xd6, 0xfa, 0xd6, 0x99, 0x8a, 0x8a, 0x0e, 0x62, 0x03, 0x82, 0x43, 0x45, 0x53, 0x55, 0x55, 0x55, 0x52, 0x4f, 0x53, 0x53, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x58, 0x53, 0x53, 0x58, 0x53, 0x58, 0x53, 0x58, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x52, 0x56, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x53, 0x5b, 0x53, 0x5b, 0x53, 0x5b, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5b, 0x53, 0x5b, 0x53, 0x5b, 0x52, 0x5b, 0x4f, 0x52, 0x52, 0x52, 0x53, 0x4f, 0x4f, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x53, 0x4f, 0x53, 0x53, 0x4f, 0x53, 0x4f, 0x52, 0x53, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x53, 0x4e, 0x47, 0x67, 0x7f, 0x66, 0x42, 0x59, 0x4e, 0x55, 0x4a, 0x52, 0x53, 0x55, 0x4f, 0x4f, 0x52, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x55, 0x5b, 0x53, 0x53, 0x4a, 0x47, 0x4b, 0x6a, 0x6d, 0x6d, 0x6d, 0x64, 0x4d, 0x46, 0x41, 0x48, 0x4c, 0x66, 0x63, 0x4a, 0x55, 0x5a, 0x5a, 0x55, 0x59, 0x55, 0x56, 0x56, 0x5b, 0x59, 0x5b, 0x59, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x50, 0x45, 0x41, 0x3c, 0x3c, 0x38, 0x36, 0x33, 0x33, 0x32, 0x31, 0x31, 0x32, 0x32, 0x31, 0x33, 0x32, 0x31, 0x30, 0x2e, 0x2f, 0x2d, 0x2d, 0x68, 0x27, 0x8b, 0xfb, 0xf3, 0xf4, 0xf5, 0xf7, 0xf4, 0xf6, 0xf4, 0xf4, 0xf5, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf6, 0xf5, 0xf4, 0xf6, 0xf5, 0xf5, 0x99, 0xf9, 0x99, 0x27, 0xfe, 0x24, 0x16, 0x03, 0x86, 0x6c, 0x3f, 0x53, 0x53, 0x5a, 0x55, 0x52, 0x53, 0x52, 0x53, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x53, 0x52, 0x4f, 0x4f, 0x53, 0x4f, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4f, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x53, 0x4a, 0x53, 0x4a, 0x53, 0x4a, 0x53, 0x52, 0x5b, 0x52, 0x5b, 0x52, 0x5b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x52, 0x53, 0x53, 0x52, 0x53, 0x52, 0x53, 0x4f, 0x53, 0x52, 0x53, 0x52, 0x53, 0x53, 0x4f, 0x5b, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x53, 0x4f, 0x53, 0x52, 0x53, 0x52, 0x53, 0x4f, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4e, 0x47, 0x6a, 0x7f, 0x58, 0x4f, 0x4e, 0x56, 0x52, 0x52, 0x52, 0x55, 0x53, 0x4f, 0x4e, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x52, 0x53, 0x4f, 0x53, 0x4a, 0x53, 0x4a, 0x53, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4a, 0x42, 0x43, 0x43, 0x43, 0x4d, 0x47, 0x50, 0x45, 0x4e, 0x4c, 0x59, 0x59, 0x66, 0x59, 0x55, 0x56, 0x55, 0x56, 0x52, 0x56, 0x56, 0x55, 0x56, 0x56, 0x52, 0x4f, 0x4f, 0x52, 0x52, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5c, 0x50, 0x50, 0x46, 0x40, 0x3c, 0x38, 0x38, 0x36, 0x34, 0x33, 0x32, 0x32, 0x2e, 0x2e, 0x30, 0x2e, 0x2e, 0x2f, 0x2d, 0x8c, 0x8a, 0xd6, 0x27, 0xd6, 0xf5, 0x99, 0xf5, 0xd6, 0xfa, 0x99, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0xd6, 0xfb, 0x27, 0x26, 0x84, 0x16, 0x0c, 0x0c, 0x7f, 0x5c, 0x47, 0x53, 0x55, 0x55, 0x4f, 0x4f, 0x52, 0x55, 0x4f, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4a, 0x4f, 0x4a, 0x53, 0x4a, 0x53, 0x4f, 0x4a, 0x4f, 0x4a, 0x4f, 0x4a, 0x53, 0x4a, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x53, 0x5b, 0x53, 0x53, 0x53, 0x52, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x52, 0x4f, 0x53, 0x53, 0x5b, 0x53, 0x5b, 0x52, 0x5b, 0x52, 0x5b, 0x4f, 0x53, 0x4f, 0x52, 0x4f, 0x52, 0x4e, 0x53, 0x4f, 0x4f, 0x53, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4e, 0x53, 0x4e, 0x4f, 0x45, 0x69, 0x7f, 0x58, 0x4f, 0x4c, 0x56, 0x55, 0x4a, 0x4f, 0x53, 0x55, 0x4f, 0x4f, 0x52, 0x52, 0x53, 0x52, 0x52, 0x53, 0x52, 0x53, 0x4f, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x4a, 0x52, 0x4a, 0x52, 0x4a, 0x52, 0x4a, 0x52, 0x4a, 0x52, 0x4a, 0x52, 0x4a, 0x52, 0x4a, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4a, 0x4f, 0x56, 0x56, 0x4f, 0x4f, 0x59, 0x4a, 0x53, 0x53, 0x5b, 0x4a, 0x4e, 0x4c, 0x4c, 0x4c, 0x59, 0x66, 0x52, 0x55, 0x56, 0x59, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x52, 0x56, 0x5a, 0x5b, 0x5d, 0x52, 0x4f, 0x55, 0x5b, 0x5d, 0x5b, 0x5b, 0x5b, 0x66, 0x5b, 0x67, 0x5b, 0x67, 0x58, 0x58, 0x5c, 0x50, 0x3d, 0x38, 0x38, 0x34, 0x31, 0x2e, 0x35, 0x2e, 0x2d, 0x2d, 0x2d, 0x8d, 0x8b, 0xd7, 0xf7, 0x99, 0xd6, 0x27, 0xd6, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf4, 0xf5, 0xf5, 0x99, 0xf9, 0x99, 0xfe, 0x86, 0x05, 0x0a, 0x05, 0x0c, 0x86, 0x70, 0x43, 0x58, 0x51, 0x52, 0x52, 0x4f, 0x52, 0x55, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x53, 0x52, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x52, 0x53, 0x52, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x4f, 0x53, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x53, 0x56, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4a, 0x4f, 0x52, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4e, 0x43, 0x70, 0x7f, 0x53, 0x4f, 0x4e, 0x59, 0x4a, 0x55, 0x4f, 0x55, 0x53, 0x4f, 0x4e, 0x56, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x52, 0x4a, 0x52, 0x4a, 0x55, 0x4f, 0x56, 0x4f, 0x56, 0x52, 0x56, 0x4f, 0x4f, 0x56, 0x4f, 0x4f, 0x4a, 0x56, 0x56, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x55, 0x52, 0x4f, 0x4f, 0x4c, 0x59, 0x4c, 0x59, 0x66, 0x55, 0x52, 0x56, 0x56, 0x59, 0x56, 0x56, 0x5a, 0x5a, 0x5d, 0x5a, 0x5d, 0x52, 0x55, 0x55, 0x55, 0x5a, 0x5d, 0x5a, 0x5a, 0x56, 0x5a, 0x5a, 0x55, 0x4a, 0x55, 0x56, 0x5e, 0x66, 0x5d, 0x66, 0x67, 0x67, 0x5f, 0x5f, 0x4b, 0x4b, 0x3e, 0x3e, 0x3e, 0x3e, 0x35, 0x35, 0x2d, 0x2c, 0x7c, 0xd7, 0x27, 0x99, 0x99, 0xf3, 0x27, 0xfa, 0x99, 0xf9, 0xf5, 0xf5, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf5, 0xf5, 0x27, 0xfa, 0x27, 0xfe, 0x19, 0x0c, 0x0f, 0x04, 0x7d, 0x84, 0x75, 0x49, 0x58, 0x53, 0x52, 0x4f, 0x4f, 0x55, 0x55, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x53, 0x52, 0x53, 0x52, 0x52, 0x53, 0x52, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x53, 0x56, 0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x52, 0x53, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x52, 0x56, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x56, 0x52, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x5b, 0x40, 0x70, 0x7f, 0x58, 0x4f, 0x4c, 0x59, 0x52, 0x4a, 0x52, 0x53, 0x55, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x52, 0x56, 0x56, 0x56, 0x52, 0x59, 0x4a, 0x52, 0x59, 0x4f, 0x4f, 0x52, 0x4f, 0x4c, 0x59, 0x59, 0x5a, 0x55, 0x55, 0x4a, 0x55, 0x5a, 0x56, 0x56, 0x56, 0x5e, 0x66, 0x51, 0x5e, 0x56, 0x56, 0x56, 0x56, 0x59, 0x56, 0x56, 0x55, 0x56, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5d, 0x5a, 0x5a, 0x55, 0x55, 0x5a, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x63, 0x66, 0x5c, 0x5c, 0x60, 0x6d, 0x74, 0x7b, 0x7e, 0x7e, 0x82, 0x80, 0x80, 0x74, 0x57, 0x35, 0x8c, 0x94, 0xd6, 0xf3, 0x99, 0xfa, 0x8a, 0xfb, 0xfb, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf9, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf9, 0x99, 0xfb, 0xfe, 0x16, 0x0f, 0x0f, 0x06, 0x03, 0x84, 0x7f, 0x43, 0x58, 0x58, 0x56, 0x4f, 0x56, 0x55, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x53, 0x56, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x56, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x53, 0x56, 0x53, 0x56, 0x56, 0x53, 0x55, 0x53, 0x55, 0x53, 0x52, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x48, 0x47, 0x70, 0x7f, 0x47, 0x4f, 0x59, 0x4f, 0x52, 0x55, 0x4f, 0x55, 0x53, 0x4f, 0x4e, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x4f, 0x5a, 0x55, 0x55, 0x4a, 0x55, 0x53, 0x55, 0x52, 0x55, 0x55, 0x55, 0x66, 0x61, 0x53, 0x56, 0x4e, 0x59, 0x56, 0x56, 0x5a, 0x56, 0x5a, 0x55, 0x5a, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x55, 0x56, 0x5a, 0x55, 0x5a, 0x5a, 0x5a, 0x5d, 0x5d, 0x5d, 0x5a, 0x5d, 0x5d, 0x5d, 0x5c, 0x6d, 0x7b, 0x80, 0x7c, 0x7a, 0x8d, 0x73, 0x6e, 0x68, 0x6f, 0x73, 0x6f, 0x6e, 0x57, 0x8d, 0x8b, 0xd7, 0x27, 0xd6, 0x27, 0xfa, 0x99, 0xf9, 0xf5, 0xf5, 0xf6, 0xf4, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xd6, 0xf6, 0xf4, 0xf6, 0xf6, 0xf5, 0xf4, 0xfa, 0x27, 0xf9, 0x27, 0x29, 0x16, 0x0b, 0x0d, 0x06, 0x04, 0x1b, 0x7f, 0x49, 0x58, 0x55, 0x52, 0x4e, 0x56, 0x5a, 0x55, 0x55, 0x56, 0x55, 0x56, 0x55, 0x52, 0x55, 0x56, 0x53, 0x52, 0x52, 0x53, 0x55, 0x53, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x52, 0x52, 0x56, 0x52, 0x52, 0x53, 0x52, 0x53, 0x52, 0x4a, 0x52, 0x4f, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x55, 0x52, 0x55, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x4f, 0x56, 0x4f, 0x56, 0x4f, 0x56, 0x4f, 0x56, 0x4f, 0x56, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x5b, 0x40, 0x75, 0x79, 0x58, 0x4e, 0x59, 0x4f, 0x55, 0x4a, 0x52, 0x53, 0x55, 0x4f, 0x52, 0x4e, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x55, 0x52, 0x52, 0x55, 0x4f, 0x55, 0x55, 0x5e, 0x66, 0x61, 0x52, 0x56, 0x56, 0x56, 0x56, 0x59, 0x56, 0x56, 0x55, 0x55, 0x5a, 0x5a, 0x5a, 0x55, 0x5a, 0x5a, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5a, 0x6d, 0x86, 0x7c, 0x6e, 0x39, 0x96, 0x96, 0x96, 0x39, 0x39, 0x39, 0x2f, 0x2f, 0x2f, 0x2c, 0xd8, 0x97, 0x99, 0xf3, 0x99, 0x99, 0xfb, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0x27, 0xfb, 0x29, 0x16, 0x06, 0x0d, 0x06, 0x03, 0x84, 0x82, 0x54, 0x47, 0x5e, 0x4f, 0x4f, 0x56, 0x55, 0x55, 0x52, 0x52, 0x56, 0x56, 0x52, 0x56, 0x52, 0x52, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x55, 0x53, 0x4f, 0x53, 0x4a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x53, 0x56, 0x53, 0x56, 0x52, 0x56, 0x53, 0x52, 0x4f, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4e, 0x47, 0x70, 0x7f, 0x47, 0x4f, 0x59, 0x4e, 0x55, 0x4f, 0x55, 0x52, 0x53, 0x4f, 0x4e, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x4a, 0x55, 0x4a, 0x55, 0x4a, 0x55, 0x4a, 0x55, 0x53, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x53, 0x4f, 0x4e, 0x4e, 0x4e, 0x4f, 0x4e, 0x4f, 0x4e, 0x56, 0x4f, 0x55, 0x52, 0x5a, 0x63, 0x63, 0x52, 0x56, 0x59, 0x56, 0x56, 0x56, 0x55, 0x59, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x53, 0x5b, 0x55, 0x5b, 0x55, 0x56, 0x55, 0x5d, 0x5d, 0x5a, 0x5d, 0x5d, 0x5d, 0x55, 0x6a, 0x87, 0x7c, 0xdf, 0xba, 0xb5, 0xa3, 0xd8, 0xd8, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x95, 0x8c, 0xf7, 0xd6, 0xfc, 0xd6, 0xf9, 0x27, 0xf5, 0xf9, 0xf5, 0xf4, 0xf6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xd6, 0xf5, 0xf6, 0xf6, 0xf4, 0xf6, 0xf6, 0xf5, 0xf5, 0xf9, 0x27, 0xfb, 0x27, 0xfe, 0x20, 0x06, 0x0d, 0x06, 0x04, 0x1b, 0x7f, 0x58, 0x58, 0x55, 0x56, 0x4f, 0x56, 0x55, 0x5a, 0x52, 0x56, 0x56, 0x52, 0x56, 0x52, 0x52, 0x56, 0x55, 0x56, 0x55, 0x53, 0x55, 0x53, 0x55, 0x52, 0x56, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x52, 0x53, 0x52, 0x52, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x55, 0x56, 0x52, 0x52, 0x52, 0x56, 0x55, 0x52, 0x52, 0x52, 0x52, 0x56, 0x52, 0x56, 0x52, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x4f, 0x45, 0x75, 0x79, 0x58, 0x4e, 0x59, 0x56, 0x4a, 0x55, 0x4f, 0x53, 0x55, 0x4f, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x4a, 0x55, 0x4a, 0x55, 0x4a, 0x55, 0x52, 0x52, 0x4e, 0x4e, 0x4e, 0x4e, 0x4c, 0x4e, 0x4c, 0x56, 0x4c, 0x52, 0x59, 0x5a, 0x66, 0x5d, 0x55, 0x59, 0x56, 0x56, 0x59, 0x56, 0x59, 0x55, 0x5a, 0x55, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x5b, 0x55, 0x5b, 0x55, 0x56, 0x55, 0x56, 0x5d, 0x55, 0x5d, 0x55, 0x5d, 0x5d, 0x58, 0x70, 0x83, 0xf8, 0xf8, 0xe4, 0xd4, 0xc8, 0xbf, 0xa3, 0x96, 0x96, 0xd8, 0x2c, 0x2c, 0x2c, 0x95, 0x9d, 0xee, 0xd6, 0xd6, 0xf5, 0x99, 0xf9, 0xfa, 0xf9, 0xf5, 0xf5, 0xf4, 0xf6, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf6, 0xd6, 0xf6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0x27, 0xfb, 0x29, 0x1b, 0x0a, 0x09, 0x06, 0x04, 0x84, 0x7f, 0x54, 0x4a, 0x5a, 0x56, 0x4e, 0x55, 0x5a, 0x51, 0x56, 0x55, 0x55, 0x56, 0x55, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x55, 0x53, 0x55, 0x52, 0x55, 0x55, 0x55, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x55, 0x55, 0x55, 0x52, 0x55, 0x52, 0x56, 0x55, 0x52, 0x55, 0x56, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x5b, 0x40, 0x79, 0x75, 0x58, 0x4a, 0x59, 0x4e, 0x55, 0x4a, 0x55, 0x52, 0x53, 0x4f, 0x4e, 0x56, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x55, 0x55, 0x52, 0x55, 0x52, 0x55, 0x55, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4f, 0x52, 0x4e, 0x4e, 0x4c, 0x4c, 0x4c, 0x59, 0x4c, 0x55, 0x56, 0x55, 0x59, 0x63, 0x66, 0x4c, 0x5a, 0x56, 0x5a, 0x56, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x52, 0x56, 0x56, 0x55, 0x5b, 0x55, 0x56, 0x5d, 0x56, 0x5d, 0x55, 0x5d, 0x5a, 0x5e, 0x60, 0x7b, 0x81, 0x96, 0xae, 0xb9, 0xbe, 0xc9, 0xc8, 0xd0, 0xc4, 0xc4, 0xba, 0xac, 0xb5, 0xac, 0xac, 0xec, 0xd7, 0xd6, 0xf6, 0xf3, 0xf3, 0xf9, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xd6, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf9, 0x27, 0xfb, 0x27, 0xfe, 0x20, 0x04, 0x0d, 0x06, 0x04, 0x20, 0x75, 0x43, 0x55, 0x5a, 0x59, 0x56, 0x55, 0x5e, 0x5a, 0x52, 0x52, 0x56, 0x55, 0x56, 0x52, 0x52, 0x55, 0x56, 0x55, 0x52, 0x55, 0x53, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5b, 0x5a, 0x55, 0x5a, 0x53, 0x5a, 0x53, 0x5a, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x56, 0x55, 0x52, 0x52, 0x52, 0x52, 0x55, 0x56, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x5b, 0x43, 0x79, 0x75, 0x58, 0x4e, 0x59, 0x4f, 0x4a, 0x55, 0x4f, 0x53, 0x55, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x59, 0x4f, 0x59, 0x4f, 0x5a, 0x4f, 0x55, 0x52, 0x5a, 0x66, 0x5d, 0x55, 0x59, 0x55, 0x59, 0x5a, 0x59, 0x5a, 0x55, 0x5a, 0x56, 0x55, 0x5a, 0x55, 0x5a, 0x5a, 0x55, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x5a, 0x56, 0x5d, 0x5a, 0x5a, 0x5a, 0x5d, 0x58, 0x50, 0x74, 0x92, 0xba, 0xae, 0xb7, 0xab, 0xab, 0xaa, 0xa6, 0xb6, 0xbc, 0xbf, 0xb5, 0xb5, 0xba, 0xac, 0xca, 0xd7, 0xf6, 0xf7, 0xf4, 0xfa, 0xf9, 0xf9, 0xf5, 0xf5, 0xf4, 0xf6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0x27, 0xfb, 0x29, 0x84, 0x0c, 0x06, 0x06, 0x04, 0x84, 0x75, 0x43, 0x51, 0x5a, 0x59, 0x4f, 0x5a, 0x55, 0x51, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x56, 0x55, 0x55, 0x53, 0x55, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x55, 0x53, 0x55, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5b, 0x56, 0x56, 0x55, 0x53, 0x5a, 0x53, 0x5a, 0x55, 0x53, 0x55, 0x53, 0x55, 0x52, 0x55, 0x53, 0x55, 0x52, 0x55, 0x52, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x52, 0x55, 0x56, 0x55, 0x52, 0x56, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x5b, 0x40, 0x79, 0x75, 0x47, 0x52, 0x4e, 0x56, 0x52, 0x55, 0x4f, 0x55, 0x4a, 0x4f, 0x4f, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x52, 0x56, 0x52, 0x59, 0x52, 0x56, 0x52, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x51, 0x53, 0x58, 0x66, 0x66, 0x4a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x56, 0x5a, 0x56, 0x5a, 0x56, 0x5a, 0x56, 0x5d, 0x5a, 0x5d, 0x55, 0x5d, 0x5a, 0x5d, 0x50, 0x64, 0x8f, 0xca, 0xb6, 0xbd, 0xab, 0xa8, 0xab, 0xa4, 0xa6, 0xb7, 0xb6, 0x9e, 0x9e, 0x9d, 0x96, 0xa3, 0xf7, 0xf7, 0xd6, 0xf7, 0xfa, 0xf5, 0xf9, 0xf5, 0xf5, 0xf6, 0xd6, 0xf5, 0xf6, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0x27, 0xfe, 0x23, 0x10, 0x0a, 0x04, 0x0c, 0x84, 0x69, 0x43, 0x55, 0x59, 0x59, 0x56, 0x52, 0x5e, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x53, 0x53, 0x55, 0x55, 0x55, 0x53, 0x53, 0x5b, 0x5b, 0x4f, 0x4f, 0x5a, 0x5a, 0x5a, 0x55, 0x52, 0x4f, 0x52, 0x53, 0x5b, 0x4f, 0x53, 0x53, 0x53, 0x53, 0x4f, 0x5e, 0x55, 0x5e, 0x53, 0x5e, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x53, 0x53, 0x5b, 0x5b, 0x56, 0x4f, 0x4e, 0x5b, 0x56, 0x56, 0x56, 0x55, 0x5d, 0x5a, 0x5d, 0x51, 0x5a, 0x51, 0x55, 0x55, 0x52, 0x56, 0x4f, 0x56, 0x52, 0x52, 0x52, 0x56, 0x52, 0x56, 0x52, 0x52, 0x52, 0x52, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x5b, 0x40, 0x7f, 0x70, 0x58, 0x52, 0x56, 0x4f, 0x4a, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x53, 0x55, 0x51, 0x55, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4a, 0x55, 0x5a, 0x59, 0x56, 0x52, 0x4e, 0x56, 0x4c, 0x56, 0x4c, 0x59, 0x59, 0x59, 0x55, 0x4a, 0x55, 0x55, 0x55, 0x55, 0x4f, 0x4a, 0x55, 0x5a, 0x5a, 0x52, 0x5a, 0x66, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x56, 0x59, 0x56, 0x52, 0x55, 0x5b, 0x53, 0x55, 0x55, 0x59, 0x5a, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x5a, 0x5a, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5d, 0x50, 0x5c, 0x81, 0x8e, 0xae, 0xbe, 0xb8, 0xb3, 0xb3, 0xb3, 0xaa, 0xb7, 0xb7, 0xa5, 0x9f, 0x9e, 0x9d, 0x9d, 0xf0, 0xfd, 0xf2, 0xfa, 0xf4, 0xf6, 0xd6, 0xf6, 0xd6, 0xf5, 0xfa, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf4, 0xf6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0x99, 0xf7, 0xfe, 0x23, 0x0c, 0x04, 0x05, 0x20, 0x7d, 0x5e, 0x51, 0x56, 0x4f, 0x4e, 0x56, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x52, 0x53, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x5b, 0x4e, 0x50, 0x59, 0x5a, 0x5d, 0x5d, 0x5a, 0x56, 0x5b, 0x5b, 0x53, 0x4f, 0x58, 0x5b, 0x58, 0x58, 0x47, 0x43, 0x43, 0x43, 0x40, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x49, 0x47, 0x51, 0x53, 0x55, 0x5b, 0x5b, 0x5b, 0x59, 0x4e, 0x4f, 0x59, 0x5a, 0x5a, 0x5d, 0x5a, 0x5d, 0x5e, 0x5a, 0x51, 0x56, 0x52, 0x4e, 0x4e, 0x56, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x56, 0x56, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x58, 0x43, 0x79, 0x70, 0x53, 0x47, 0x5d, 0x4a, 0x55, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4e, 0x55, 0x52, 0x53, 0x51, 0x53, 0x51, 0x51, 0x55, 0x55, 0x52, 0x55, 0x4f, 0x5a, 0x5d, 0x55, 0x52, 0x52, 0x56, 0x56, 0x4e, 0x4c, 0x4e, 0x4e, 0x59, 0x55, 0x4f, 0x55, 0x4a, 0x55, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x55, 0x4a, 0x55, 0x55, 0x52, 0x55, 0x66, 0x66, 0x59, 0x5a, 0x63, 0x5d, 0x59, 0x59, 0x5a, 0x4f, 0x5b, 0x53, 0x5e, 0x5b, 0x5d, 0x56, 0x59, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x58, 0x50, 0x74, 0x92, 0xbb, 0xb7, 0xc2, 0xa4, 0xb3, 0xb3, 0xaa, 0xb3, 0xb7, 0xaa, 0x9f, 0x9e, 0x9e, 0x9d, 0x97, 0xfc, 0xf6, 0xfb, 0xf4, 0xf5, 0xf6, 0xd6, 0xf6, 0xf5, 0xf9, 0xfb, 0xf9, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xfa, 0xfa, 0xfe, 0x25, 0x13, 0x13, 0x22, 0x84, 0x69, 0x51, 0x55, 0x56, 0x56, 0x4e, 0x56, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x5b, 0x53, 0x55, 0x5d, 0x51, 0x5a, 0x52, 0x4a, 0x4e, 0x5b, 0x5b, 0x56, 0x5a, 0x5a, 0x55, 0x56, 0x55, 0x52, 0x51, 0x47, 0x43, 0x43, 0x49, 0x49, 0x69, 0x69, 0x72, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x72, 0x69, 0x69, 0x54, 0x49, 0x43, 0x51, 0x5c, 0x5e, 0x5c, 0x5b, 0x5e, 0x4a, 0x52, 0x5d, 0x5d, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x52, 0x56, 0x56, 0x56, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x56, 0x4f, 0x56, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x58, 0x43, 0x7f, 0x70, 0x47, 0x53, 0x5b, 0x4f, 0x55, 0x4f, 0x52, 0x4f, 0x55, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x53, 0x51, 0x53, 0x55, 0x53, 0x53, 0x52, 0x56, 0x4f, 0x59, 0x55, 0x59, 0x5a, 0x56, 0x56, 0x4f, 0x5b, 0x53, 0x5b, 0x4a, 0x47, 0x47, 0x43, 0x43, 0x43, 0x51, 0x49, 0x49, 0x43, 0x49, 0x43, 0x43, 0x43, 0x49, 0x47, 0x47, 0x58, 0x66, 0x5e, 0x55, 0x55, 0x59, 0x4f, 0x59, 0x66, 0x59, 0x4f, 0x5a, 0x5b, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x58, 0x6a, 0x83, 0xd2, 0xb5, 0xc6, 0xad, 0xab, 0xb3, 0xaa, 0xb3, 0xb3, 0xb7, 0x9f, 0x9e, 0x9e, 0x9d, 0xca, 0xd7, 0xfb, 0xf9, 0xf9, 0xd6, 0xf6, 0xd6, 0xf6, 0xf9, 0xfb, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf5, 0xf5, 0xf4, 0xfa, 0xf5, 0xfa, 0xfa, 0xff, 0x28, 0x24, 0x86, 0x86, 0x75, 0x54, 0x51, 0x55, 0x52, 0x4e, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x4f, 0x52, 0x5a, 0x51, 0x5d, 0x5e, 0x5a, 0x52, 0x4f, 0x5b, 0x4e, 0x4f, 0x52, 0x5d, 0x55, 0x55, 0x5e, 0x51, 0x47, 0x54, 0x6c, 0x75, 0x0c, 0x84, 0x84, 0x84, 0x84, 0x22, 0x84, 0x22, 0x20, 0x22, 0x20, 0x22, 0x22, 0x22, 0x84, 0x84, 0x7f, 0x77, 0x70, 0x54, 0x49, 0x49, 0x49, 0x58, 0x61, 0x5b, 0x55, 0x4c, 0x59, 0x59, 0x56, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x56, 0x56, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x47, 0x50, 0x79, 0x70, 0x53, 0x47, 0x55, 0x53, 0x55, 0x52, 0x55, 0x52, 0x52, 0x52, 0x4f, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x52, 0x53, 0x53, 0x53, 0x52, 0x52, 0x52, 0x56, 0x56, 0x59, 0x59, 0x59, 0x4f, 0x52, 0x4a, 0x4a, 0x47, 0x49, 0x49, 0x5c, 0x69, 0x75, 0x7f, 0x7d, 0x7f, 0x0c, 0x82, 0x0c, 0x82, 0x7d, 0x7f, 0x75, 0x72, 0x69, 0x49, 0x49, 0x5c, 0x5c, 0x43, 0x58, 0x58, 0x66, 0x4e, 0x4f, 0x4e, 0x59, 0x59, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5c, 0x78, 0x90, 0xb5, 0xb7, 0xc5, 0xa8, 0xa4, 0xab, 0xab, 0xb7, 0xb9, 0xa5, 0x9e, 0x9e, 0x9d, 0xba, 0xfd, 0xfa, 0xfb, 0x27, 0xf5, 0xd6, 0xf6, 0xd6, 0xf6, 0xf9, 0xf9, 0xf9, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xf9, 0xf5, 0xf9, 0xf7, 0xf9, 0x8a, 0x26, 0x80, 0x02, 0x6a, 0x65, 0x58, 0x5e, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x5a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x5b, 0x52, 0x55, 0x5d, 0x5e, 0x5a, 0x5a, 0x55, 0x52, 0x4f, 0x50, 0x5b, 0x5b, 0x67, 0x55, 0x49, 0x51, 0x69, 0x77, 0x84, 0x84, 0x20, 0x17, 0x84, 0x11, 0x11, 0x0c, 0x0c, 0x0c, 0x04, 0x0c, 0x04, 0x0c, 0x05, 0x0c, 0x0c, 0x13, 0x84, 0x20, 0x22, 0x23, 0x1b, 0x7d, 0x02, 0x65, 0x49, 0x54, 0x58, 0x5d, 0x5b, 0x59, 0x59, 0x4e, 0x4e, 0x56, 0x52, 0x55, 0x55, 0x55, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x56, 0x4f, 0x56, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x58, 0x47, 0x7f, 0x67, 0x58, 0x53, 0x53, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x52, 0x52, 0x56, 0x52, 0x56, 0x4e, 0x56, 0x4e, 0x5a, 0x56, 0x51, 0x51, 0x54, 0x70, 0x77, 0x7f, 0x84, 0x86, 0x22, 0x84, 0x1b, 0x84, 0x17, 0x84, 0x1b, 0x84, 0x20, 0x22, 0x23, 0x23, 0x22, 0x86, 0x84, 0x75, 0x69, 0x49, 0x4d, 0x5c, 0x58, 0x5b, 0x5d, 0x59, 0x5d, 0x5a, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x63, 0x5d, 0x58, 0x6b, 0x8f, 0xce, 0xb5, 0xcb, 0xb9, 0xa8, 0xb0, 0xab, 0xb3, 0xbe, 0xa5, 0x9e, 0x9e, 0x9d, 0xac, 0xd6, 0xfb, 0x27, 0x27, 0x99, 0xd6, 0xd6, 0xf6, 0xf6, 0xfa, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0x8a, 0x89, 0x68, 0x35, 0x3f, 0x60, 0x58, 0x53, 0x52, 0x56, 0x52, 0x56, 0x55, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x52, 0x56, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x58, 0x53, 0x50, 0x47, 0x43, 0x54, 0x6c, 0x7d, 0x84, 0x84, 0x84, 0x0c, 0x0b, 0x04, 0x0a, 0x04, 0x0a, 0x0a, 0x0a, 0x04, 0x0a, 0x06, 0x0a, 0x04, 0x0a, 0x04, 0x04, 0x04, 0x0a, 0x04, 0x04, 0x0c, 0x17, 0x20, 0x20, 0x84, 0x05, 0x65, 0x65, 0x58, 0x5b, 0x48, 0x48, 0x4e, 0x4e, 0x56, 0x52, 0x5a, 0x5e, 0x55, 0x55, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x56, 0x56, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x43, 0x5c, 0x79, 0x70, 0x4a, 0x58, 0x52, 0x53, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x53, 0x55, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4e, 0x5b, 0x56, 0x5b, 0x5b, 0x5b, 0x58, 0x5b, 0x58, 0x47, 0x51, 0x69, 0x79, 0x84, 0x22, 0x84, 0x84, 0x0c, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x0c, 0x84, 0x84, 0x22, 0x22, 0x84, 0x75, 0x65, 0x49, 0x49, 0x5d, 0x5d, 0x59, 0x5a, 0x5a, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x63, 0x5d, 0x5e, 0x5c, 0x74, 0x90, 0xca, 0xb7, 0xbe, 0xb0, 0xb0, 0xa8, 0xb4, 0xbe, 0xb6, 0x9f, 0x9e, 0x9e, 0xac, 0xf1, 0xfc, 0x27, 0x27, 0xf9, 0xd6, 0xd6, 0xf6, 0xf4, 0xf6, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xfa, 0x99, 0xfc, 0x89, 0x68, 0x3a, 0x46, 0x70, 0x43, 0x4a, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x53, 0x56, 0x55, 0x55, 0x5a, 0x5a, 0x5a, 0x55, 0x5e, 0x5e, 0x47, 0x54, 0x5c, 0x69, 0x7f, 0x84, 0x22, 0x84, 0x0c, 0x03, 0x04, 0x04, 0x0a, 0x06, 0x06, 0x06, 0x06, 0x0d, 0x0a, 0x0d, 0x0a, 0x0d, 0x0d, 0x0d, 0x0a, 0x06, 0x0a, 0x06, 0x0a, 0x0b, 0x0a, 0x06, 0x0b, 0x0f, 0x20, 0x20, 0x84, 0x77, 0x65, 0x43, 0x53, 0x66, 0x50, 0x4f, 0x5b, 0x55, 0x55, 0x5a, 0x5a, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x56, 0x4f, 0x56, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x47, 0x58, 0x7f, 0x67, 0x58, 0x4a, 0x53, 0x5b, 0x55, 0x56, 0x55, 0x56, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x55, 0x55, 0x53, 0x52, 0x4f, 0x56, 0x4e, 0x59, 0x56, 0x56, 0x5b, 0x56, 0x58, 0x53, 0x58, 0x49, 0x5c, 0x72, 0x7f, 0x22, 0x84, 0x11, 0x05, 0x04, 0x04, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x0d, 0x0b, 0x0b, 0x0a, 0x06, 0x04, 0x0a, 0x0a, 0x03, 0x04, 0x04, 0x0b, 0x0c, 0x20, 0x22, 0x86, 0x7d, 0x69, 0x43, 0x43, 0x63, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5d, 0x63, 0x51, 0x61, 0x60, 0x83, 0x92, 0xbb, 0xbc, 0xb8, 0xad, 0xab, 0xb2, 0xb7, 0xb9, 0xa5, 0x9e, 0x9d, 0xa3, 0xee, 0xd7, 0xfa, 0x27, 0x99, 0xd6, 0xf6, 0xd6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0x8a, 0x88, 0x68, 0x37, 0x3a, 0x67, 0x53, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x53, 0x56, 0x52, 0x56, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x53, 0x55, 0x55, 0x56, 0x4f, 0x56, 0x56, 0x52, 0x53, 0x53, 0x58, 0x54, 0x54, 0x69, 0x7d, 0x22, 0x84, 0x0c, 0x05, 0x04, 0x05, 0x0a, 0x0a, 0x0d, 0x0a, 0x15, 0x15, 0x1e, 0x1d, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x12, 0x12, 0x0d, 0x0d, 0x09, 0x0d, 0x09, 0x06, 0x0a, 0x17, 0x22, 0x20, 0x75, 0x65, 0x43, 0x58, 0x58, 0x53, 0x53, 0x5a, 0x5a, 0x55, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x56, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x43, 0x5c, 0x7f, 0x67, 0x58, 0x53, 0x53, 0x55, 0x55, 0x52, 0x56, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x55, 0x51, 0x55, 0x52, 0x52, 0x56, 0x4e, 0x4e, 0x56, 0x5b, 0x55, 0x58, 0x51, 0x51, 0x65, 0x75, 0x84, 0x84, 0x84, 0x05, 0x05, 0x0a, 0x0c, 0x0b, 0x0f, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x12, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0f, 0x0b, 0x0f, 0x0b, 0x0b, 0x09, 0x04, 0x0a, 0x11, 0x20, 0x22, 0x7d, 0x6c, 0x43, 0x51, 0x5e, 0x5e, 0x5a, 0x5a, 0x59, 0x5a, 0x59, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5d, 0x63, 0x5d, 0x51, 0x51, 0x6a, 0x87, 0x92, 0xc4, 0xc8, 0xb9, 0xb1, 0xaf, 0xb1, 0xb9, 0xb1, 0x9c, 0x9e, 0xa3, 0xe9, 0xfd, 0xf6, 0x99, 0xf5, 0x99, 0xd6, 0xf6, 0xd6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xfa, 0xfa, 0xf9, 0x99, 0xf9, 0xf7, 0x8a, 0x88, 0x68, 0x3a, 0x46, 0x67, 0x55, 0x5a, 0x5a, 0x55, 0x55, 0x53, 0x53, 0x5b, 0x52, 0x56, 0x53, 0x55, 0x55, 0x53, 0x55, 0x53, 0x55, 0x55, 0x5a, 0x55, 0x5d, 0x53, 0x5a, 0x55, 0x55, 0x5a, 0x5a, 0x42, 0x5b, 0x5b, 0x47, 0x5b, 0x58, 0x51, 0x65, 0x72, 0x11, 0x20, 0x0c, 0x0a, 0x04, 0x0a, 0x0a, 0x0a, 0x0f, 0x10, 0x1e, 0x1e, 0x1f, 0x1e, 0x1a, 0x14, 0x1a, 0x14, 0x1a, 0x13, 0x1a, 0x1a, 0x1a, 0x1a, 0x14, 0x14, 0x1c, 0x1f, 0x14, 0x12, 0x0d, 0x0d, 0x0d, 0x0f, 0x0b, 0x0b, 0x0b, 0x17, 0x22, 0x7d, 0x69, 0x54, 0x61, 0x51, 0x5e, 0x66, 0x5a, 0x4c, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x47, 0x5b, 0x7f, 0x67, 0x4a, 0x58, 0x56, 0x53, 0x56, 0x55, 0x52, 0x55, 0x56, 0x52, 0x52, 0x52, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x4a, 0x5e, 0x4a, 0x53, 0x5a, 0x56, 0x4f, 0x59, 0x52, 0x52, 0x53, 0x5e, 0x54, 0x43, 0x6c, 0x7f, 0x20, 0x84, 0x0c, 0x05, 0x0a, 0x0a, 0x0b, 0x0f, 0x0f, 0x0f, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x12, 0x10, 0x0f, 0x10, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x06, 0x11, 0x22, 0x20, 0x72, 0x54, 0x49, 0x67, 0x5e, 0x4a, 0x59, 0x59, 0x5a, 0x5a, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5a, 0x5d, 0x5e, 0x51, 0x5e, 0x63, 0x5e, 0x5c, 0x79, 0x8f, 0x90, 0xca, 0xbc, 0xb7, 0xb7, 0xb6, 0xb7, 0xbe, 0x9e, 0x9e, 0x9e, 0xe8, 0xf6, 0xd6, 0xf7, 0xd6, 0x99, 0xf5, 0xd6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf6, 0xf4, 0xfa, 0xf5, 0xfa, 0xf9, 0xf5, 0xf5, 0xff, 0x89, 0x6b, 0x3a, 0x4d, 0x61, 0x53, 0x5a, 0x5a, 0x5a, 0x55, 0x53, 0x53, 0x52, 0x4e, 0x56, 0x55, 0x55, 0x53, 0x55, 0x55, 0x55, 0x55, 0x53, 0x5a, 0x53, 0x55, 0x55, 0x55, 0x53, 0x5d, 0x55, 0x52, 0x66, 0x5b, 0x40, 0x67, 0x50, 0x43, 0x69, 0x0c, 0x20, 0x11, 0x04, 0x09, 0x0b, 0x0d, 0x0a, 0x0f, 0x14, 0x1a, 0x1e, 0x1a, 0x13, 0x1b, 0x16, 0x21, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x21, 0x21, 0x21, 0x1b, 0x16, 0x10, 0x13, 0x1a, 0x1f, 0x1a, 0x0f, 0x0f, 0x0d, 0x0f, 0x0b, 0x0a, 0x0c, 0x22, 0x22, 0x77, 0x49, 0x54, 0x51, 0x4a, 0x59, 0x5d, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x47, 0x67, 0x7f, 0x67, 0x47, 0x5b, 0x53, 0x56, 0x55, 0x52, 0x56, 0x52, 0x52, 0x52, 0x52, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x4a, 0x55, 0x5d, 0x5b, 0x5a, 0x52, 0x56, 0x66, 0x53, 0x51, 0x49, 0x65, 0x7d, 0x84, 0x17, 0x0a, 0x0a, 0x0a, 0x0b, 0x0f, 0x0b, 0x10, 0x1c, 0x1a, 0x1a, 0x14, 0x13, 0x1a, 0x1a, 0x1b, 0x13, 0x1b, 0x1b, 0x1b, 0x1b, 0x13, 0x13, 0x13, 0x10, 0x0c, 0x10, 0x0b, 0x0f, 0x0f, 0x12, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b, 0x84, 0x23, 0x84, 0x65, 0x43, 0x49, 0x66, 0x5d, 0x4c, 0x5a, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5d, 0x5e, 0x5e, 0x5e, 0x63, 0x5d, 0x51, 0x58, 0x76, 0x83, 0x90, 0x97, 0xca, 0xb5, 0xb5, 0xb7, 0xbc, 0xa0, 0x9e, 0xa3, 0xe6, 0xd7, 0xf6, 0xf6, 0xf5, 0xf5, 0x99, 0xf5, 0x99, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf9, 0xd6, 0xf9, 0x99, 0xff, 0x89, 0x6b, 0x3a, 0x4d, 0x66, 0x55, 0x5a, 0x5a, 0x55, 0x5e, 0x53, 0x53, 0x5b, 0x52, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x5d, 0x55, 0x5d, 0x55, 0x5d, 0x55, 0x5a, 0x5a, 0x55, 0x55, 0x56, 0x50, 0x5b, 0x5c, 0x43, 0x72, 0x84, 0x20, 0x0b, 0x06, 0x0f, 0x0d, 0x06, 0x0d, 0x18, 0x1e, 0x1f, 0x1a, 0x1b, 0x21, 0x23, 0x23, 0x26, 0x28, 0x29, 0x29, 0x29, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x29, 0x29, 0x28, 0x28, 0x24, 0x21, 0x16, 0x13, 0x13, 0x13, 0x10, 0x12, 0x14, 0x0b, 0x0f, 0x14, 0x0b, 0x14, 0x20, 0x05, 0x65, 0x49, 0x5e, 0x5d, 0x4e, 0x56, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x47, 0x67, 0x7f, 0x67, 0x53, 0x58, 0x55, 0x5b, 0x55, 0x55, 0x52, 0x55, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5a, 0x5b, 0x5d, 0x4a, 0x52, 0x4a, 0x55, 0x43, 0x61, 0x54, 0x6c, 0x7d, 0x20, 0x11, 0x0c, 0x0d, 0x0d, 0x0d, 0x0f, 0x14, 0x1e, 0x1a, 0x1a, 0x13, 0x16, 0x1b, 0x23, 0x23, 0x24, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x24, 0x21, 0x21, 0x13, 0x13, 0x0a, 0x0d, 0x15, 0x0d, 0x12, 0x0f, 0x0b, 0x0c, 0x17, 0x84, 0x21, 0x6c, 0x54, 0x61, 0x5a, 0x5d, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x58, 0x58, 0x5e, 0x63, 0x63, 0x63, 0x5a, 0x54, 0x6a, 0x83, 0x88, 0x91, 0x97, 0xce, 0xbf, 0xbb, 0xb5, 0x9d, 0x9d, 0xe3, 0xf7, 0xd6, 0xf2, 0xf6, 0xf5, 0xf5, 0xf9, 0xf5, 0x27, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf6, 0xf4, 0xfa, 0xf5, 0xfa, 0xf9, 0xf5, 0xfa, 0xff, 0x89, 0x6b, 0x3a, 0x49, 0x67, 0x4f, 0x5a, 0x5a, 0x55, 0x53, 0x58, 0x55, 0x53, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x5a, 0x55, 0x5e, 0x5a, 0x47, 0x66, 0x5c, 0x54, 0x72, 0x22, 0x11, 0x0b, 0x0b, 0x0a, 0x0d, 0x0f, 0x15, 0x1f, 0x14, 0x1a, 0x1a, 0x23, 0x25, 0x28, 0x29, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0xfd, 0x2b, 0xff, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x29, 0x28, 0x24, 0x19, 0x16, 0x13, 0x1a, 0x14, 0x14, 0x0b, 0x0f, 0x0f, 0x0c, 0x1e, 0x22, 0x04, 0x65, 0x49, 0x5e, 0x55, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x43, 0x67, 0x7f, 0x5b, 0x58, 0x53, 0x5b, 0x55, 0x55, 0x52, 0x56, 0x52, 0x56, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x56, 0x4a, 0x4a, 0x55, 0x61, 0x5e, 0x54, 0x54, 0x6c, 0x17, 0x20, 0x04, 0x0c, 0x0b, 0x0d, 0x12, 0x1d, 0x1f, 0x1a, 0x1a, 0x16, 0x23, 0x24, 0x28, 0x28, 0xfe, 0x29, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x29, 0x29, 0x28, 0x28, 0x23, 0x19, 0x13, 0x0a, 0x0f, 0x14, 0x0f, 0x10, 0x0a, 0x0a, 0x10, 0x20, 0x22, 0x72, 0x49, 0x49, 0x63, 0x66, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5d, 0x5e, 0x5e, 0x53, 0x5a, 0x63, 0x63, 0x63, 0x5e, 0x54, 0x60, 0x70, 0x83, 0x89, 0x91, 0x92, 0x92, 0xdf, 0xac, 0x8c, 0xe6, 0xd7, 0xf7, 0xf4, 0xf6, 0xf9, 0xf5, 0xf9, 0xfa, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xfa, 0xf4, 0x99, 0xfa, 0x8a, 0x26, 0x6b, 0x3a, 0x46, 0x66, 0x4f, 0x56, 0x52, 0x55, 0x53, 0x58, 0x53, 0x55, 0x5a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x5d, 0x5e, 0x55, 0x5e, 0x61, 0x54, 0x77, 0x20, 0x11, 0x0a, 0x0b, 0x0f, 0x0f, 0x0b, 0x10, 0x1a, 0x1b, 0x22, 0x25, 0x28, 0x29, 0x2a, 0x2b, 0x2b, 0x8b, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0x2b, 0xff, 0x2a, 0x2b, 0x2b, 0x29, 0x26, 0x21, 0x13, 0x0c, 0x1a, 0x1a, 0x0f, 0x12, 0x0f, 0x06, 0x12, 0x23, 0x7d, 0x65, 0x49, 0x5e, 0x53, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x43, 0x70, 0x7f, 0x5c, 0x53, 0x58, 0x56, 0x53, 0x56, 0x55, 0x52, 0x55, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x52, 0x53, 0x5e, 0x61, 0x54, 0x54, 0x72, 0x17, 0x11, 0x0c, 0x0b, 0x0f, 0x12, 0x14, 0x14, 0x1a, 0x13, 0x21, 0x23, 0x26, 0x29, 0x2a, 0x2b, 0x2b, 0x2b, 0xff, 0xff, 0xff, 0x2b, 0xfd, 0xff, 0xfc, 0x2b, 0xfd, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x29, 0x28, 0x21, 0x13, 0x05, 0x10, 0x0f, 0x14, 0x15, 0x0b, 0x0b, 0x1f, 0x20, 0x72, 0x54, 0x54, 0x5e, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5a, 0x5e, 0x61, 0x5e, 0x55, 0x5a, 0x5d, 0x5d, 0x5e, 0x5e, 0x54, 0x54, 0x6a, 0x70, 0x80, 0x87, 0x88, 0x88, 0x85, 0x8e, 0x88, 0x8a, 0xd6, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf6, 0xf4, 0xfa, 0xf5, 0xf9, 0x99, 0xf9, 0xf5, 0xff, 0x89, 0x68, 0x3a, 0x4d, 0x67, 0x48, 0x4e, 0x56, 0x53, 0x58, 0x51, 0x55, 0x5a, 0x5a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x53, 0x5a, 0x5a, 0x55, 0x55, 0x51, 0x49, 0x77, 0x20, 0x11, 0x0b, 0x0d, 0x0d, 0x0d, 0x14, 0x14, 0x10, 0x21, 0x24, 0x29, 0x29, 0x2b, 0xff, 0xff, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xff, 0xff, 0x2b, 0x2a, 0xfe, 0x2a, 0x2a, 0x28, 0x25, 0x16, 0x0c, 0x10, 0x14, 0x12, 0x12, 0x12, 0x0b, 0x12, 0x22, 0x0c, 0x54, 0x49, 0x55, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x56, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x43, 0x70, 0x79, 0x58, 0x53, 0x58, 0x5b, 0x55, 0x55, 0x52, 0x56, 0x52, 0x56, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x59, 0x56, 0x59, 0x5e, 0x53, 0x49, 0x54, 0x77, 0x84, 0x11, 0x0c, 0x0b, 0x0f, 0x15, 0x1c, 0x1a, 0x13, 0x16, 0x23, 0x28, 0x2a, 0x2a, 0x2b, 0x2b, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfc, 0xf7, 0xf7, 0xd7, 0xfd, 0xd7, 0xfc, 0xfb, 0xff, 0xff, 0x2a, 0x2a, 0xfe, 0x29, 0x26, 0x19, 0x0c, 0x10, 0x0f, 0x0d, 0x15, 0x15, 0x0b, 0x1f, 0x22, 0x77, 0x49, 0x54, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5d, 0x5d, 0x63, 0x63, 0x66, 0x5b, 0x5d, 0x5b, 0x63, 0x61, 0x61, 0x61, 0x54, 0x49, 0x5c, 0x70, 0x76, 0x82, 0x80, 0x0e, 0x87, 0x8a, 0x27, 0xfb, 0xf5, 0xf9, 0xf9, 0xf9, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0x27, 0xf7, 0xff, 0x89, 0x6b, 0x3e, 0x46, 0x67, 0x48, 0x48, 0x5b, 0x52, 0x58, 0x53, 0x51, 0x5a, 0x5a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x5a, 0x53, 0x5a, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x51, 0x51, 0x77, 0x84, 0x14, 0x09, 0x0d, 0x0d, 0x15, 0x0f, 0x10, 0x1a, 0x25, 0x29, 0x2a, 0x2b, 0xfd, 0xfc, 0xf7, 0xf7, 0xf7, 0xd7, 0xf7, 0xd7, 0xd7, 0xfc, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xd7, 0xfd, 0xfd, 0xfd, 0xfd, 0x2b, 0xff, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x28, 0x23, 0x10, 0x10, 0x12, 0x12, 0x12, 0x12, 0x0b, 0x11, 0x22, 0x7d, 0x54, 0x51, 0x53, 0x56, 0x56, 0x52, 0x56, 0x52, 0x56, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x43, 0x70, 0x7f, 0x47, 0x58, 0x53, 0x5b, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x56, 0x53, 0x56, 0x52, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x59, 0x4e, 0x52, 0x5e, 0x43, 0x61, 0x72, 0x84, 0x11, 0x0c, 0x0f, 0x12, 0x1d, 0x1d, 0x10, 0x16, 0x86, 0x28, 0x2a, 0x2b, 0xff, 0x8b, 0xfc, 0xd7, 0xf7, 0xd7, 0xf7, 0xd7, 0xd7, 0xfc, 0xd7, 0xfc, 0xd7, 0xfc, 0xd7, 0xf7, 0xf7, 0xf7, 0xf7, 0xd7, 0xfc, 0xfc, 0x8a, 0xff, 0x8b, 0xff, 0x2b, 0x29, 0x25, 0x13, 0x0f, 0x0d, 0x15, 0x18, 0x15, 0x0a, 0x20, 0x21, 0x72, 0x54, 0x5e, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5a, 0x5d, 0x5d, 0x5a, 0x5d, 0x5d, 0x5a, 0x63, 0x5d, 0x5d, 0x5b, 0x66, 0x5b, 0x66, 0x66, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5e, 0x51, 0x49, 0x54, 0x60, 0x62, 0x80, 0x2b, 0x27, 0x27, 0xf9, 0xf9, 0xf9, 0xfa, 0xf4, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf4, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0x99, 0xf5, 0xf5, 0xff, 0x89, 0x6f, 0x3a, 0x4d, 0x5f, 0x4e, 0x5b, 0x4e, 0x56, 0x53, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x56, 0x52, 0x55, 0x5a, 0x56, 0x55, 0x55, 0x55, 0x53, 0x55, 0x5b, 0x5e, 0x5a, 0x55, 0x5e, 0x51, 0x43, 0x75, 0x84, 0x0c, 0x0b, 0x0d, 0x08, 0x18, 0x15, 0x10, 0x19, 0x28, 0x29, 0x2a, 0xfd, 0xff, 0xfb, 0xfc, 0xd7, 0xfd, 0xd7, 0xf6, 0xd6, 0xf3, 0xf1, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf1, 0xf2, 0xf2, 0xf7, 0xfd, 0xd7, 0xfd, 0x8b, 0x2b, 0x2b, 0x2b, 0x2b, 0xff, 0x2a, 0x29, 0x25, 0x13, 0x13, 0x12, 0x0f, 0x12, 0x12, 0x0b, 0x14, 0x20, 0x7d, 0x49, 0x51, 0x53, 0x53, 0x5b, 0x44, 0x56, 0x59, 0x52, 0x55, 0x55, 0x55, 0x52, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x43, 0x79, 0x79, 0x47, 0x5b, 0x53, 0x52, 0x55, 0x52, 0x55, 0x56, 0x55, 0x56, 0x53, 0x56, 0x53, 0x55, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x55, 0x53, 0x53, 0x52, 0x52, 0x52, 0x56, 0x5a, 0x5a, 0x55, 0x51, 0x51, 0x72, 0x84, 0x0c, 0x0b, 0x12, 0x12, 0x14, 0x14, 0x10, 0x1b, 0x26, 0xfe, 0x2b, 0x2b, 0xff, 0xff, 0xfc, 0xfc, 0xf7, 0xd7, 0xf7, 0xf7, 0xf6, 0xd6, 0xf4, 0xf4, 0xf6, 0xf3, 0xf4, 0xf4, 0xf6, 0xf7, 0xd7, 0xd7, 0xfd, 0xfd, 0xd7, 0xfd, 0xfd, 0xfd, 0xd7, 0xfb, 0xff, 0x29, 0x28, 0x21, 0x0f, 0x0d, 0x0d, 0x18, 0x12, 0x0f, 0x20, 0x84, 0x6c, 0x43, 0x5e, 0x5e, 0x5d, 0x55, 0x63, 0x5a, 0x5a, 0x5d, 0x5d, 0x5a, 0x5a, 0x5d, 0x59, 0x5d, 0x5d, 0x5a, 0x5d, 0x5b, 0x5e, 0x5d, 0x5e, 0x5d, 0x63, 0x63, 0x63, 0x61, 0x66, 0x61, 0x61, 0x65, 0x54, 0x62, 0x80, 0x2b, 0x8a, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0x99, 0xf9, 0x99, 0xf9, 0x99, 0x27, 0x8a, 0x26, 0x6b, 0x3a, 0x4d, 0x67, 0x50, 0x5b, 0x56, 0x56, 0x56, 0x56, 0x52, 0x52, 0x53, 0x52, 0x5b, 0x52, 0x56, 0x56, 0x5a, 0x55, 0x56, 0x55, 0x5b, 0x53, 0x56, 0x5a, 0x55, 0x5a, 0x61, 0x54, 0x69, 0x84, 0x84, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x13, 0x23, 0x28, 0xff, 0x8b, 0xd7, 0xfc, 0xfd, 0x8b, 0xfd, 0xfd, 0xf5, 0xf3, 0xf1, 0xef, 0xef, 0xeb, 0xeb, 0xeb, 0xef, 0xef, 0xef, 0xeb, 0xef, 0xec, 0xef, 0xee, 0xef, 0xf1, 0xf3, 0xfa, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xd7, 0xff, 0x2b, 0x2a, 0x25, 0x16, 0x10, 0x14, 0x14, 0x12, 0x12, 0x0f, 0x1f, 0x1f, 0x72, 0x49, 0x51, 0x5b, 0x4f, 0x4c, 0x4e, 0x59, 0x4f, 0x55, 0x55, 0x55, 0x52, 0x56, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x4f, 0x53, 0x52, 0x4a, 0x43, 0x79, 0x79, 0x47, 0x5b, 0x4a, 0x52, 0x56, 0x55, 0x55, 0x55, 0x53, 0x55, 0x56, 0x55, 0x52, 0x53, 0x52, 0x55, 0x56, 0x55, 0x53, 0x55, 0x58, 0x55, 0x53, 0x53, 0x52, 0x56, 0x56, 0x55, 0x63, 0x51, 0x49, 0x6c, 0x0c, 0x11, 0x12, 0x12, 0x18, 0x15, 0x14, 0x13, 0x23, 0x26, 0x2b, 0x8b, 0x8b, 0x8b, 0xfc, 0xfc, 0xfd, 0xfc, 0xf7, 0xf4, 0xf4, 0xf1, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed, 0xef, 0xef, 0xf1, 0xf2, 0xf3, 0xf6, 0xfc, 0xfd, 0xd7, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0x2a, 0x29, 0x21, 0x13, 0x15, 0x15, 0x15, 0x0f, 0x0f, 0x1f, 0x84, 0x54, 0x61, 0x61, 0x52, 0x5d, 0x5d, 0x5d, 0x5d, 0x5a, 0x5e, 0x5d, 0x5a, 0x59, 0x5a, 0x59, 0x5a, 0x5d, 0x5d, 0x5e, 0x5e, 0x61, 0x5d, 0x5e, 0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x63, 0x63, 0x69, 0x54, 0x60, 0x0e, 0x2a, 0xf9, 0xfa, 0xd6, 0xf6, 0xd6, 0xf5, 0xf5, 0xf9, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xfa, 0xf4, 0xf5, 0xf9, 0xf5, 0x27, 0xf5, 0x99, 0xf9, 0x8a, 0x89, 0x6f, 0x3a, 0x4d, 0x67, 0x50, 0x59, 0x56, 0x59, 0x55, 0x5a, 0x52, 0x55, 0x5b, 0x53, 0x52, 0x52, 0x56, 0x5a, 0x55, 0x59, 0x55, 0x5b, 0x5a, 0x5b, 0x53, 0x4a, 0x5a, 0x5d, 0x51, 0x65, 0x7d, 0x84, 0x0c, 0x0b, 0x0d, 0x0d, 0x15, 0x0f, 0x23, 0x28, 0x2b, 0x2a, 0xff, 0xfd, 0xfc, 0xfd, 0xfd, 0xfc, 0xf3, 0xef, 0xeb, 0xeb, 0xeb, 0xeb, 0xed, 0xed, 0xef, 0xef, 0xed, 0xef, 0xeb, 0xed, 0xec, 0xed, 0xed, 0xed, 0xec, 0xef, 0xf1, 0xf2, 0xf9, 0xfc, 0xfd, 0xd7, 0xfd, 0x8b, 0x2b, 0x2a, 0x29, 0x25, 0x1b, 0x10, 0x14, 0x0f, 0x12, 0x12, 0x0b, 0x1f, 0x84, 0x69, 0x49, 0x5e, 0x4a, 0x5b, 0x44, 0x4f, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x55, 0x4f, 0x52, 0x4f, 0x53, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x53, 0x43, 0x79, 0x79, 0x53, 0x58, 0x52, 0x52, 0x5a, 0x52, 0x5a, 0x55, 0x55, 0x55, 0x52, 0x52, 0x53, 0x52, 0x55, 0x56, 0x52, 0x52, 0x55, 0x55, 0x55, 0x55, 0x53, 0x56, 0x52, 0x4f, 0x56, 0x52, 0x53, 0x51, 0x65, 0x7d, 0x20, 0x0b, 0x0b, 0x12, 0x15, 0x14, 0x1b, 0x23, 0x28, 0x2a, 0x2b, 0xfd, 0xfb, 0xfb, 0xfc, 0xfc, 0xf7, 0xf3, 0xf1, 0xf1, 0xed, 0xef, 0xeb, 0xeb, 0xed, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xef, 0xf1, 0xf3, 0xf4, 0xfc, 0xfc, 0xf7, 0xfc, 0xfd, 0xd7, 0xfb, 0xff, 0x2a, 0x28, 0x23, 0x13, 0x0f, 0x12, 0x12, 0x0f, 0x17, 0x20, 0x77, 0x54, 0x61, 0x51, 0x63, 0x5a, 0x5d, 0x5d, 0x5a, 0x5e, 0x5a, 0x5d, 0x5a, 0x5d, 0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x61, 0x5e, 0x63, 0x63, 0x63, 0x5d, 0x63, 0x63, 0x61, 0x63, 0x63, 0x63, 0x61, 0x62, 0x82, 0x2b, 0x27, 0xfa, 0xf6, 0xd6, 0xf5, 0xf5, 0xf9, 0xf9, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0x99, 0xf5, 0xf5, 0x99, 0xf9, 0xd6, 0xff, 0x89, 0x6b, 0x3a, 0x3f, 0x67, 0x4e, 0x56, 0x59, 0x59, 0x59, 0x5a, 0x56, 0x55, 0x53, 0x56, 0x53, 0x52, 0x55, 0x5a, 0x5a, 0x5a, 0x56, 0x5a, 0x5b, 0x5d, 0x5b, 0x55, 0x5e, 0x5e, 0x51, 0x72, 0x20, 0x11, 0x06, 0x0b, 0x15, 0x0f, 0x10, 0x23, 0x28, 0x2a, 0x2a, 0x2b, 0xff, 0xfd, 0xfd, 0xf6, 0xf3, 0xf1, 0xef, 0xef, 0xeb, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xf1, 0xf3, 0xfa, 0xd7, 0xfd, 0xfd, 0x2b, 0x2a, 0x29, 0x29, 0x25, 0x13, 0x10, 0x14, 0x0f, 0x0f, 0x12, 0x0b, 0x22, 0x0c, 0x54, 0x49, 0x56, 0x4a, 0x4c, 0x56, 0x4f, 0x55, 0x52, 0x55, 0x56, 0x4f, 0x56, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x4a, 0x53, 0x52, 0x4a, 0x43, 0x79, 0x79, 0x47, 0x53, 0x52, 0x56, 0x56, 0x55, 0x55, 0x55, 0x53, 0x55, 0x52, 0x56, 0x52, 0x53, 0x55, 0x55, 0x55, 0x52, 0x55, 0x53, 0x55, 0x53, 0x52, 0x53, 0x56, 0x56, 0x5b, 0x5b, 0x43, 0x49, 0x7d, 0x20, 0x0c, 0x0b, 0x12, 0x12, 0x10, 0x1b, 0x23, 0x29, 0x2a, 0x2b, 0xff, 0xfc, 0xfc, 0xfc, 0xf7, 0xf2, 0xf1, 0xed, 0xeb, 0xed, 0xeb, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xeb, 0xed, 0xef, 0xed, 0xef, 0xeb, 0xf1, 0xf2, 0xf6, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xff, 0x2a, 0x2a, 0x28, 0x23, 0x13, 0x0f, 0x14, 0x18, 0x12, 0x1f, 0x84, 0x69, 0x65, 0x61, 0x5e, 0x63, 0x55, 0x5d, 0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5e, 0x61, 0x61, 0x61, 0x61, 0x61, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x58, 0x60, 0x83, 0x2b, 0x27, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xf4, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0x99, 0x8a, 0x89, 0x6d, 0x3a, 0x46, 0x67, 0x48, 0x56, 0x59, 0x5a, 0x5a, 0x5a, 0x55, 0x55, 0x52, 0x53, 0x56, 0x55, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x56, 0x52, 0x5b, 0x5e, 0x5e, 0x5d, 0x51, 0x69, 0x84, 0x11, 0x0b, 0x0d, 0x0d, 0x0f, 0x10, 0x23, 0x29, 0x2b, 0x2a, 0xff, 0x2b, 0x2b, 0xfd, 0xf7, 0xf2, 0xed, 0xeb, 0xec, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xeb, 0xeb, 0xed, 0xef, 0xf1, 0xf7, 0xf7, 0xfb, 0xff, 0x2b, 0x2b, 0x29, 0x29, 0x25, 0x1b, 0x13, 0x0f, 0x12, 0x12, 0x0f, 0x11, 0x20, 0x75, 0x49, 0x47, 0x55, 0x4f, 0x4f, 0x59, 0x52, 0x55, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x56, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x55, 0x4f, 0x52, 0x4f, 0x53, 0x52, 0x53, 0x52, 0x53, 0x4a, 0x53, 0x43, 0x7f, 0x79, 0x47, 0x53, 0x53, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x52, 0x55, 0x55, 0x55, 0x55, 0x52, 0x56, 0x56, 0x56, 0x52, 0x56, 0x55, 0x52, 0x55, 0x56, 0x52, 0x58, 0x4d, 0x69, 0x20, 0x11, 0x0b, 0x12, 0x12, 0x10, 0x13, 0x25, 0x29, 0x2b, 0x2b, 0xfd, 0xf7, 0xfc, 0xfc, 0xf6, 0xf2, 0xef, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xed, 0xed, 0xeb, 0xed, 0xed, 0xed, 0xef, 0xeb, 0xed, 0xea, 0xef, 0xef, 0xeb, 0xeb, 0xeb, 0xef, 0xf2, 0xf9, 0xfb, 0xff, 0xfc, 0xfb, 0xfc, 0xfd, 0xff, 0x2a, 0x29, 0x23, 0x13, 0x0f, 0x18, 0x0d, 0x0f, 0x22, 0x7d, 0x65, 0x65, 0x61, 0x66, 0x55, 0x5d, 0x5b, 0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x61, 0x63, 0x61, 0x63, 0x63, 0x63, 0x63, 0x63, 0x65, 0x63, 0x63, 0x63, 0x58, 0x60, 0x0e, 0x2b, 0x27, 0x27, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf9, 0xd6, 0xf5, 0xf5, 0xf5, 0x8a, 0x89, 0x6d, 0x3e, 0x4b, 0x67, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x56, 0x52, 0x55, 0x55, 0x5a, 0x5a, 0x5a, 0x55, 0x55, 0x59, 0x5b, 0x4a, 0x5b, 0x5e, 0x51, 0x51, 0x77, 0x20, 0x04, 0x0d, 0x0d, 0x15, 0x0a, 0x21, 0x29, 0x2a, 0x8a, 0xfc, 0x2b, 0xfd, 0xff, 0xf4, 0xf1, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xe9, 0xec, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xef, 0xf1, 0xef, 0xf5, 0xfd, 0xfd, 0xfd, 0x2b, 0x2a, 0x29, 0x29, 0x23, 0x0c, 0x10, 0x14, 0x0d, 0x12, 0x0c, 0x0c, 0x20, 0x65, 0x43, 0x66, 0x56, 0x4f, 0x56, 0x52, 0x56, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x4a, 0x52, 0x52, 0x4a, 0x43, 0x7f, 0x70, 0x53, 0x53, 0x5b, 0x5a, 0x52, 0x55, 0x5a, 0x55, 0x53, 0x55, 0x52, 0x56, 0x55, 0x55, 0x52, 0x55, 0x53, 0x56, 0x53, 0x56, 0x52, 0x56, 0x52, 0x56, 0x55, 0x55, 0x58, 0x43, 0x65, 0x7f, 0x11, 0x0b, 0x0f, 0x15, 0x10, 0x1a, 0x23, 0x29, 0x2b, 0x8a, 0xf7, 0xd7, 0xfc, 0xf7, 0xf4, 0xf2, 0xed, 0xed, 0xed, 0xed, 0xee, 0xef, 0xed, 0xef, 0xed, 0xed, 0xeb, 0xed, 0xeb, 0xed, 0xeb, 0xed, 0xeb, 0xeb, 0xea, 0xeb, 0xed, 0xed, 0xed, 0xef, 0xeb, 0xef, 0xf3, 0xfd, 0xfd, 0xfc, 0xfa, 0xfa, 0xfd, 0xff, 0x2b, 0x28, 0x21, 0x10, 0x0d, 0x18, 0x12, 0x1f, 0x1f, 0x6c, 0x65, 0x65, 0x5a, 0x66, 0x5d, 0x5d, 0x5d, 0x5e, 0x61, 0x61, 0x61, 0x5d, 0x59, 0x5d, 0x5e, 0x5e, 0x5e, 0x61, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x66, 0x58, 0x60, 0x83, 0x2b, 0x27, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf4, 0xf5, 0x99, 0x89, 0x68, 0x37, 0x3e, 0x4d, 0x4d, 0x4a, 0x58, 0x5a, 0x55, 0x55, 0x5a, 0x5a, 0x56, 0x55, 0x55, 0x55, 0x5a, 0x51, 0x5a, 0x55, 0x56, 0x52, 0x66, 0x4a, 0x53, 0x61, 0x47, 0x6c, 0x84, 0x11, 0x0b, 0x0d, 0x0d, 0x15, 0x16, 0x28, 0x2b, 0xd7, 0x99, 0xd7, 0xfd, 0xff, 0xf3, 0xef, 0xed, 0xed, 0xed, 0xed, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xe9, 0xe9, 0xe9, 0xec, 0xec, 0xeb, 0xeb, 0xeb, 0xef, 0xef, 0xef, 0xed, 0xed, 0xed, 0xef, 0xe7, 0xef, 0xfc, 0xfc, 0xfb, 0xfb, 0xfd, 0x2b, 0x2a, 0x29, 0x21, 0x13, 0x0f, 0x0f, 0x12, 0x0f, 0x0c, 0x22, 0x7d, 0x49, 0x51, 0x5e, 0x4f, 0x59, 0x56, 0x4f, 0x56, 0x4f, 0x5b, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x56, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x55, 0x4f, 0x52, 0x4f, 0x55, 0x52, 0x55, 0x52, 0x53, 0x4a, 0x53, 0x43, 0x7f, 0x75, 0x47, 0x53, 0x5b, 0x5d, 0x4f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x52, 0x55, 0x55, 0x55, 0x55, 0x52, 0x52, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x51, 0x49, 0x7d, 0x20, 0x0b, 0x0f, 0x15, 0x14, 0x10, 0x23, 0x29, 0x2b, 0xff, 0xf7, 0xd7, 0xf7, 0xf7, 0xf4, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe7, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xeb, 0xed, 0xed, 0xef, 0xef, 0xeb, 0xeb, 0xea, 0xeb, 0xf2, 0xf9, 0xfb, 0xfa, 0xf7, 0xf7, 0xf7, 0xff, 0x2a, 0x28, 0x1b, 0x0f, 0x18, 0x15, 0x0f, 0x1f, 0x0c, 0x65, 0x65, 0x63, 0x5e, 0x59, 0x5d, 0x5d, 0x5e, 0x5e, 0x61, 0x61, 0x5a, 0x59, 0x59, 0x5d, 0x5e, 0x66, 0x5e, 0x5e, 0x5e, 0x58, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x5d, 0x67, 0x5c, 0x64, 0x0e, 0x2b, 0x27, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xd6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xfc, 0x8b, 0x27, 0x8d, 0x57, 0x6b, 0x6d, 0x5c, 0x4d, 0x43, 0x58, 0x61, 0x5a, 0x55, 0x52, 0x59, 0x59, 0x55, 0x5a, 0x55, 0x5d, 0x5a, 0x5a, 0x55, 0x56, 0x59, 0x52, 0x4a, 0x61, 0x51, 0x7d, 0x11, 0x0b, 0x12, 0x0d, 0x0f, 0x0a, 0x28, 0x2a, 0xd7, 0xd7, 0xd7, 0xd7, 0xfc, 0xf2, 0xef, 0xeb, 0xed, 0xeb, 0xec, 0xed, 0xed, 0xed, 0xec, 0xec, 0xe9, 0xec, 0xe9, 0xec, 0xec, 0xec, 0xee, 0xee, 0xee, 0xee, 0xed, 0xec, 0xeb, 0xeb, 0xea, 0xeb, 0xef, 0xeb, 0xea, 0xec, 0xec, 0xef, 0xeb, 0xeb, 0xf4, 0xfc, 0xfa, 0xfd, 0xfd, 0x2a, 0x29, 0x28, 0x13, 0x0c, 0x15, 0x0d, 0x0f, 0x0f, 0x11, 0x84, 0x6c, 0x49, 0x55, 0x5a, 0x4f, 0x59, 0x4f, 0x52, 0x4f, 0x53, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x47, 0x7f, 0x70, 0x47, 0x53, 0x5b, 0x59, 0x52, 0x55, 0x55, 0x55, 0x55, 0x53, 0x55, 0x52, 0x56, 0x55, 0x53, 0x55, 0x53, 0x55, 0x52, 0x56, 0x56, 0x56, 0x56, 0x55, 0x5e, 0x5e, 0x54, 0x65, 0x11, 0x11, 0x12, 0x12, 0x0f, 0x10, 0x21, 0x28, 0x2b, 0x8b, 0xf7, 0xd7, 0xfd, 0xf6, 0xf4, 0xef, 0xed, 0xeb, 0xe7, 0xed, 0xe9, 0xed, 0xed, 0xed, 0xe7, 0xea, 0xeb, 0xed, 0xed, 0xeb, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xed, 0xeb, 0xea, 0xef, 0xeb, 0xed, 0xec, 0xeb, 0xef, 0xf9, 0xfd, 0xfc, 0xf6, 0xf7, 0x99, 0xff, 0x29, 0x25, 0x10, 0x15, 0x1d, 0x0d, 0x1f, 0x1f, 0x6c, 0x54, 0x65, 0x5d, 0x5d, 0x59, 0x5d, 0x5d, 0x5e, 0x61, 0x5e, 0x66, 0x59, 0x5b, 0x4a, 0x58, 0x47, 0x58, 0x50, 0x5c, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x4d, 0x60, 0x85, 0x2b, 0x27, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xd6, 0xd6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf4, 0xf4, 0xf3, 0xf7, 0xfd, 0xf4, 0xf6, 0xf1, 0x88, 0x85, 0x8e, 0x85, 0x87, 0x82, 0x82, 0x70, 0x43, 0x5c, 0x51, 0x53, 0x4f, 0x59, 0x5d, 0x5a, 0x5a, 0x5e, 0x5a, 0x5e, 0x5d, 0x5d, 0x59, 0x4a, 0x56, 0x61, 0x54, 0x69, 0x17, 0x11, 0x09, 0x0d, 0x12, 0x10, 0x21, 0x29, 0x2b, 0xd7, 0x94, 0xd7, 0xd7, 0xf3, 0xec, 0xe9, 0xec, 0xeb, 0xeb, 0xeb, 0xec, 0xe9, 0xec, 0xe9, 0xe9, 0xe9, 0xe9, 0xee, 0xee, 0xf1, 0xf0, 0xee, 0xf0, 0xee, 0xf0, 0xf1, 0xf1, 0xee, 0xef, 0xec, 0xea, 0xea, 0xeb, 0xec, 0xea, 0xed, 0xef, 0xed, 0xef, 0xef, 0xf2, 0xf7, 0xfc, 0xfd, 0xfd, 0x2a, 0x2a, 0x25, 0x10, 0x10, 0x12, 0x0f, 0x0f, 0x10, 0x17, 0x7d, 0x54, 0x51, 0x55, 0x52, 0x4f, 0x56, 0x4e, 0x4f, 0x50, 0x4f, 0x52, 0x52, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x55, 0x4f, 0x52, 0x4f, 0x55, 0x4a, 0x52, 0x4a, 0x52, 0x4a, 0x4a, 0x58, 0x7f, 0x70, 0x43, 0x5b, 0x55, 0x4f, 0x55, 0x5a, 0x5a, 0x55, 0x53, 0x5a, 0x56, 0x56, 0x55, 0x55, 0x56, 0x55, 0x53, 0x56, 0x52, 0x56, 0x59, 0x59, 0x4f, 0x55, 0x5e, 0x51, 0x54, 0x7d, 0x17, 0x12, 0x0d, 0x15, 0x10, 0x13, 0x28, 0x2a, 0x8b, 0xf7, 0xd6, 0xd7, 0xfc, 0xf2, 0xeb, 0xeb, 0xeb, 0xed, 0xea, 0xe9, 0xef, 0xee, 0xec, 0xe9, 0xee, 0xee, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xee, 0xf1, 0xee, 0xf1, 0xf1, 0xe9, 0xea, 0xed, 0xef, 0xeb, 0xef, 0xec, 0xee, 0xec, 0xeb, 0xf2, 0xf9, 0xfd, 0xf7, 0xf6, 0xfc, 0xff, 0x2a, 0x28, 0x23, 0x10, 0x15, 0x15, 0x12, 0x1f, 0x11, 0x65, 0x61, 0x63, 0x63, 0x59, 0x5d, 0x5d, 0x5a, 0x61, 0x5e, 0x61, 0x43, 0x67, 0x5c, 0x70, 0x76, 0x76, 0x76, 0x76, 0x7b, 0x76, 0x7b, 0x7b, 0x7b, 0x7b, 0x76, 0x7f, 0x7a, 0x73, 0x89, 0xff, 0xf9, 0xfb, 0xf9, 0xf9, 0xf9, 0xfa, 0x99, 0xd6, 0xd6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf4, 0xfc, 0xf6, 0xf6, 0xfa, 0xe6, 0xdf, 0xac, 0x8c, 0x96, 0x96, 0x8c, 0x8c, 0x57, 0x6e, 0x7b, 0x85, 0x70, 0x4d, 0x43, 0x66, 0x55, 0x4c, 0x59, 0x5a, 0x5a, 0x5a, 0x5e, 0x5d, 0x5d, 0x5a, 0x59, 0x59, 0x55, 0x51, 0x65, 0x72, 0x17, 0x11, 0x0d, 0x12, 0x0f, 0x13, 0x25, 0x2b, 0x99, 0xd7, 0xd7, 0xd7, 0xd6, 0xef, 0xee, 0xe9, 0xe7, 0xef, 0xeb, 0xec, 0xec, 0xec, 0xe9, 0xe9, 0xf0, 0xee, 0xf0, 0xee, 0xe9, 0xe3, 0xd4, 0xd2, 0xd2, 0xd0, 0xd2, 0xe3, 0xe9, 0xee, 0xee, 0xee, 0xec, 0xe6, 0xec, 0xef, 0xe7, 0xef, 0xec, 0xeb, 0xeb, 0xed, 0xf1, 0xf6, 0xf7, 0xfd, 0xfc, 0xff, 0x2a, 0x28, 0x16, 0x10, 0x0f, 0x15, 0x0f, 0x0f, 0x11, 0x20, 0x69, 0x49, 0x5e, 0x4f, 0x59, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x4f, 0x53, 0x52, 0x47, 0x67, 0x7f, 0x70, 0x47, 0x5b, 0x52, 0x52, 0x56, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x56, 0x55, 0x56, 0x5a, 0x53, 0x55, 0x53, 0x53, 0x52, 0x56, 0x59, 0x59, 0x52, 0x51, 0x5e, 0x49, 0x6c, 0x17, 0x18, 0x12, 0x0f, 0x0f, 0x13, 0x23, 0x29, 0x2b, 0xd7, 0xd6, 0xd7, 0xf7, 0xf9, 0xef, 0xeb, 0xea, 0xea, 0xe7, 0xed, 0xee, 0xe6, 0xee, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xe6, 0xe3, 0xe3, 0xe3, 0xe0, 0xd4, 0xe3, 0xe6, 0xe8, 0xee, 0xf1, 0xee, 0xed, 0xeb, 0xeb, 0xef, 0xee, 0xd5, 0xee, 0xeb, 0xeb, 0xf2, 0xf9, 0xfc, 0xf7, 0xf7, 0xfb, 0x2b, 0x29, 0x25, 0x13, 0x10, 0x18, 0x12, 0x1f, 0x17, 0x72, 0x54, 0x63, 0x63, 0x59, 0x63, 0x5a, 0x61, 0x63, 0x61, 0x58, 0x4d, 0x76, 0x82, 0x7b, 0x82, 0x80, 0x7b, 0x7a, 0x78, 0x7a, 0x74, 0x7a, 0x73, 0x7a, 0x73, 0x7a, 0x73, 0xf8, 0x85, 0xff, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0x99, 0xd6, 0xd6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xe0, 0xd8, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x6f, 0x85, 0x74, 0x49, 0x5c, 0x55, 0x59, 0x5a, 0x59, 0x55, 0x5a, 0x5d, 0x5e, 0x5a, 0x59, 0x56, 0x66, 0x4f, 0x61, 0x65, 0x0c, 0x17, 0x0b, 0x12, 0x12, 0x0c, 0x23, 0x2a, 0x8b, 0x99, 0xd7, 0xd7, 0xd6, 0xef, 0xec, 0xe9, 0xd5, 0xec, 0xea, 0xef, 0xe7, 0xe6, 0xe9, 0xf0, 0xf0, 0xf0, 0xe4, 0xd4, 0xca, 0xbf, 0xba, 0xb5, 0xb5, 0xba, 0xba, 0xba, 0xba, 0xbb, 0xcc, 0xd4, 0xe9, 0xf0, 0xed, 0xee, 0xed, 0xec, 0xe7, 0xec, 0xea, 0xea, 0xea, 0xed, 0xf1, 0xf6, 0xf7, 0xf7, 0xfd, 0x2b, 0x29, 0x25, 0x13, 0x10, 0x15, 0x15, 0x0f, 0x0c, 0x22, 0x7d, 0x49, 0x51, 0x55, 0x55, 0x4f, 0x59, 0x4f, 0x53, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x55, 0x4f, 0x52, 0x4f, 0x55, 0x4a, 0x52, 0x4a, 0x52, 0x4a, 0x4a, 0x66, 0x7f, 0x67, 0x47, 0x5b, 0x55, 0x52, 0x55, 0x5a, 0x5a, 0x55, 0x53, 0x5a, 0x53, 0x5a, 0x56, 0x55, 0x56, 0x55, 0x53, 0x53, 0x56, 0x5b, 0x4c, 0x59, 0x5a, 0x55, 0x54, 0x54, 0x7d, 0x1f, 0x12, 0x12, 0x12, 0x10, 0x1b, 0x28, 0x2b, 0x8a, 0xd7, 0xd6, 0xd7, 0xf3, 0xef, 0xeb, 0xeb, 0xeb, 0xed, 0xec, 0xe9, 0xe9, 0xee, 0xf0, 0xf0, 0xe8, 0xe3, 0xcc, 0xc4, 0xbf, 0xc4, 0xbf, 0xbf, 0xbf, 0xbf, 0xbb, 0xc4, 0xc4, 0xce, 0xe3, 0xee, 0xee, 0xec, 0xec, 0xe7, 0xe9, 0xe9, 0xee, 0xeb, 0xea, 0xef, 0xf2, 0xfb, 0xf7, 0xf4, 0xfb, 0xff, 0x2a, 0x29, 0x23, 0x10, 0x18, 0x15, 0x12, 0x1f, 0x0c, 0x61, 0x65, 0x63, 0x63, 0x5d, 0x5d, 0x63, 0x66, 0x61, 0x60, 0x7b, 0x7b, 0x73, 0x57, 0x39, 0xd8, 0x2f, 0x2c, 0x2c, 0x2c, 0x2c, 0x95, 0x2c, 0x2c, 0x2c, 0x2c, 0x95, 0x2c, 0xd8, 0xdf, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf5, 0x99, 0xd6, 0xd6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf7, 0xf7, 0xf6, 0xf8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x39, 0x73, 0x82, 0x60, 0x43, 0x66, 0x4c, 0x5d, 0x59, 0x56, 0x5a, 0x5a, 0x5a, 0x5d, 0x59, 0x59, 0x5a, 0x5a, 0x54, 0x6c, 0x20, 0x0c, 0x0f, 0x12, 0x0b, 0x16, 0x28, 0x2b, 0x8a, 0xd7, 0xd7, 0xf7, 0xf1, 0xec, 0xe7, 0xee, 0xee, 0xe9, 0xeb, 0xec, 0xe9, 0xe9, 0xee, 0xd5, 0xe4, 0xcc, 0xbc, 0xb5, 0xae, 0xb6, 0xbc, 0xbf, 0xc0, 0xc8, 0xc8, 0xc8, 0xc8, 0xc0, 0xbf, 0xbf, 0xcc, 0xd4, 0xf0, 0xe9, 0xe9, 0xf1, 0xe7, 0xe9, 0xec, 0xeb, 0xea, 0xeb, 0xed, 0xf1, 0xf6, 0xf7, 0xd7, 0xff, 0x2a, 0x29, 0x19, 0x10, 0x0f, 0x0f, 0x0d, 0x10, 0x17, 0x84, 0x65, 0x49, 0x55, 0x55, 0x55, 0x4f, 0x4f, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x4f, 0x53, 0x52, 0x43, 0x70, 0x7f, 0x67, 0x47, 0x5b, 0x52, 0x56, 0x56, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x56, 0x55, 0x56, 0x59, 0x5a, 0x53, 0x5e, 0x53, 0x5b, 0x59, 0x4f, 0x59, 0x5d, 0x51, 0x54, 0x69, 0x11, 0x12, 0x0d, 0x12, 0x14, 0x13, 0x25, 0x29, 0x2b, 0xd7, 0xd7, 0xd7, 0xf6, 0xef, 0xeb, 0xea, 0xea, 0xe9, 0xec, 0xe9, 0xe9, 0xe8, 0xf0, 0xe8, 0xd4, 0xc8, 0xbf, 0xbc, 0xc4, 0xc8, 0xcc, 0xc8, 0xcd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc, 0xcc, 0xbf, 0xca, 0xe6, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xe9, 0xeb, 0xeb, 0xeb, 0xef, 0xf2, 0xf6, 0xf6, 0xfb, 0xfb, 0xfe, 0xfe, 0x26, 0x13, 0x15, 0x12, 0x12, 0x11, 0x1f, 0x6c, 0x65, 0x63, 0x63, 0x5d, 0x63, 0x66, 0x61, 0x43, 0x74, 0x0e, 0x68, 0x39, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x2c, 0x2c, 0x95, 0x95, 0xd8, 0xf8, 0xfc, 0xfb, 0xfb, 0xf9, 0xf9, 0xf6, 0x99, 0xd6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xef, 0xe0, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xba, 0x8d, 0xba, 0xdf, 0x8d, 0x8c, 0x83, 0x7b, 0x49, 0x58, 0x55, 0x59, 0x59, 0x59, 0x55, 0x5a, 0x5d, 0x56, 0x59, 0x59, 0x4f, 0x63, 0x54, 0x77, 0x20, 0x0b, 0x0f, 0x0f, 0x10, 0x19, 0x2a, 0x8a, 0xff, 0xfd, 0xfd, 0xf3, 0xeb, 0xea, 0xec, 0xee, 0xe9, 0xed, 0xeb, 0xe7, 0xee, 0xf0, 0xe8, 0xcc, 0xbc, 0xae, 0xb7, 0xc0, 0xc9, 0xc9, 0xc9, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xc9, 0xc9, 0xcd, 0xcd, 0xc0, 0xba, 0xe1, 0xe6, 0xe8, 0xf1, 0xee, 0xec, 0xe9, 0xed, 0xeb, 0xeb, 0xeb, 0xed, 0xf1, 0xd7, 0xd7, 0x27, 0xfe, 0x2a, 0x24, 0x13, 0x0f, 0x0d, 0x12, 0x10, 0x0c, 0x20, 0x72, 0x49, 0x51, 0x55, 0x55, 0x59, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x56, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x4a, 0x52, 0x4a, 0x52, 0x52, 0x4a, 0x70, 0x7f, 0x67, 0x47, 0x5e, 0x4f, 0x56, 0x5a, 0x55, 0x5a, 0x55, 0x53, 0x5a, 0x53, 0x5a, 0x59, 0x5a, 0x56, 0x5a, 0x53, 0x5b, 0x56, 0x5b, 0x59, 0x59, 0x5d, 0x51, 0x54, 0x77, 0x20, 0x11, 0x0d, 0x14, 0x10, 0x21, 0x28, 0x2a, 0xff, 0xd7, 0xd7, 0xf7, 0xf1, 0xeb, 0xea, 0xea, 0xe7, 0xec, 0xe9, 0xe6, 0xf0, 0xf0, 0xe4, 0xc8, 0xbf, 0xc0, 0xc8, 0xd1, 0xd1, 0xc9, 0xbe, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc9, 0xc9, 0xcd, 0xd0, 0xcd, 0xbf, 0xd0, 0xf0, 0xf0, 0xec, 0xed, 0xea, 0xeb, 0xef, 0xef, 0xeb, 0xef, 0xf2, 0xf7, 0xfc, 0xf9, 0xfe, 0x2b, 0x29, 0x21, 0x0d, 0x15, 0x1e, 0x0f, 0x1f, 0x7d, 0x54, 0x65, 0x63, 0x61, 0x63, 0x66, 0x51, 0x49, 0x80, 0x7c, 0x96, 0xd8, 0x2c, 0x2c, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x8c, 0xd6, 0xfc, 0xfb, 0x27, 0xf9, 0xf5, 0xd6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xed, 0xf8, 0xf8, 0xdf, 0xdc, 0xdc, 0xdf, 0xdc, 0xca, 0xdf, 0xcc, 0xdf, 0xdc, 0xf8, 0xda, 0x6e, 0x85, 0x6a, 0x43, 0x63, 0x55, 0x59, 0x59, 0x56, 0x5d, 0x55, 0x5d, 0x59, 0x59, 0x5a, 0x51, 0x61, 0x0c, 0x1a, 0x0a, 0x0f, 0x10, 0x13, 0x25, 0x2a, 0xfb, 0xff, 0xfd, 0xf9, 0xef, 0xe7, 0xec, 0xee, 0xea, 0xeb, 0xeb, 0xed, 0xe9, 0xe9, 0xe3, 0xcc, 0xbc, 0xb6, 0xbe, 0xc9, 0xc9, 0xc1, 0xb9, 0xb9, 0xbe, 0xbe, 0xc1, 0xbe, 0xb9, 0xb4, 0xb3, 0xb9, 0xc2, 0xc9, 0xc0, 0xc8, 0xd4, 0xe3, 0xe6, 0xee, 0xe9, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xee, 0xf6, 0xd7, 0x99, 0xff, 0x2a, 0x28, 0x21, 0x0d, 0x15, 0x12, 0x0f, 0x0c, 0x20, 0x7d, 0x65, 0x51, 0x55, 0x55, 0x4f, 0x59, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x56, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x4f, 0x53, 0x4a, 0x4a, 0x70, 0x7f, 0x58, 0x58, 0x5b, 0x4f, 0x5a, 0x56, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x56, 0x56, 0x5a, 0x59, 0x5d, 0x53, 0x5e, 0x53, 0x5b, 0x56, 0x59, 0x56, 0x5a, 0x49, 0x69, 0x7d, 0x84, 0x12, 0x14, 0x10, 0x13, 0x23, 0x29, 0xfe, 0xff, 0xd7, 0xd7, 0xf2, 0xee, 0xe7, 0xea, 0xea, 0xe6, 0xee, 0xe9, 0xe8, 0xe8, 0xe1, 0xbf, 0xc0, 0xc9, 0xc9, 0xcb, 0xbe, 0xbe, 0xb9, 0xbe, 0xb9, 0xbe, 0xbe, 0xb9, 0xbe, 0xbe, 0xc0, 0xb9, 0xc9, 0xcd, 0xd0, 0xd0, 0xd0, 0xe8, 0xef, 0xeb, 0xeb, 0xeb, 0xed, 0xeb, 0xe7, 0xec, 0xee, 0xf7, 0xf7, 0xf9, 0xfb, 0x2b, 0x29, 0x25, 0x0f, 0x12, 0x1c, 0x12, 0x17, 0x11, 0x6c, 0x65, 0x65, 0x63, 0x66, 0x61, 0x58, 0x70, 0x8f, 0x8d, 0xd8, 0xd8, 0x95, 0x95, 0xd8, 0xd8, 0xd8, 0xd8, 0x39, 0xd8, 0x39, 0xd8, 0x39, 0xd8, 0xd8, 0xd8, 0x2c, 0x95, 0x95, 0x96, 0xf1, 0x8b, 0xfb, 0xf9, 0xf9, 0xfa, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf6, 0xf3, 0xfd, 0xed, 0xdc, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xdc, 0xc4, 0xdc, 0xbf, 0xdc, 0xdc, 0xdf, 0x8d, 0x0e, 0x7f, 0x43, 0x51, 0x59, 0x59, 0x4e, 0x5a, 0x56, 0x5d, 0x59, 0x59, 0x59, 0x63, 0x4a, 0x6c, 0x20, 0x0c, 0x0f, 0x14, 0x0c, 0x16, 0x28, 0x2b, 0x2b, 0xfb, 0xfd, 0xf3, 0xea, 0xe7, 0xed, 0xee, 0xe6, 0xeb, 0xea, 0xe6, 0xee, 0xe8, 0xcc, 0xae, 0xbc, 0xcd, 0xc9, 0xbe, 0xb9, 0xbe, 0xcb, 0xcf, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xcf, 0xc5, 0xb8, 0xb3, 0xc2, 0xcf, 0xc0, 0xc8, 0xd4, 0xd4, 0xe9, 0xee, 0xe9, 0xe7, 0xea, 0xeb, 0xeb, 0xeb, 0xea, 0xf1, 0xf7, 0xd7, 0xff, 0xfe, 0x2a, 0x23, 0x0f, 0x15, 0x12, 0x0f, 0x11, 0x20, 0x84, 0x65, 0x51, 0x55, 0x52, 0x59, 0x4f, 0x4c, 0x55, 0x56, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x55, 0x4a, 0x52, 0x4a, 0x53, 0x52, 0x43, 0x75, 0x7f, 0x58, 0x58, 0x5b, 0x53, 0x5d, 0x56, 0x55, 0x5a, 0x55, 0x53, 0x5a, 0x53, 0x56, 0x59, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b, 0x56, 0x59, 0x4f, 0x51, 0x65, 0x6c, 0x20, 0x11, 0x14, 0x10, 0x10, 0x1b, 0x28, 0x2a, 0xff, 0x27, 0xfd, 0xf7, 0xf1, 0xe9, 0xea, 0xed, 0xe7, 0xe9, 0xe3, 0xe8, 0xf0, 0xe1, 0xbf, 0xdd, 0xcd, 0xc9, 0xc9, 0xbe, 0xb9, 0xbe, 0xc1, 0xc7, 0xcb, 0xcb, 0xcb, 0xc7, 0xc1, 0xbe, 0xb9, 0xc2, 0xb7, 0xc0, 0xcd, 0xcd, 0xc4, 0xd0, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xe7, 0xe7, 0xe9, 0xea, 0xd6, 0xf4, 0xf9, 0xff, 0xfe, 0xfe, 0x28, 0x1d, 0x0f, 0x12, 0x14, 0x0f, 0x1f, 0x77, 0x65, 0x65, 0x63, 0x69, 0x55, 0x5c, 0x79, 0x83, 0x8c, 0xd8, 0x95, 0x96, 0xba, 0xda, 0xdc, 0xdc, 0xdf, 0xdf, 0xdf, 0x7c, 0xdf, 0xdf, 0xdf, 0xda, 0xda, 0x8d, 0xac, 0xd8, 0x8c, 0x91, 0xfd, 0x99, 0xf9, 0xf9, 0xfa, 0xf6, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0xf6, 0xf5, 0xf4, 0xf6, 0xf7, 0xe6, 0xdf, 0xdf, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xc4, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdf, 0xda, 0x7b, 0x86, 0x65, 0x5e, 0x55, 0x55, 0x56, 0x59, 0x59, 0x59, 0x59, 0x59, 0x51, 0x63, 0x49, 0x77, 0x1f, 0x0b, 0x15, 0x10, 0x0c, 0x23, 0x2a, 0xfe, 0xfd, 0xfd, 0xf6, 0xea, 0xef, 0xeb, 0xea, 0xeb, 0xeb, 0xee, 0xe6, 0xf0, 0xe4, 0xc8, 0xb5, 0xc0, 0xc9, 0xc0, 0xbe, 0xc9, 0xd3, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe2, 0xe5, 0xd3, 0xcd, 0xb1, 0xb9, 0xcf, 0xc0, 0xc8, 0xe4, 0xd0, 0xe8, 0xf1, 0xe6, 0xed, 0xef, 0xe7, 0xeb, 0xea, 0xeb, 0xf6, 0xfd, 0xff, 0x2b, 0x2a, 0x29, 0x10, 0x0f, 0x0f, 0x12, 0x0f, 0x0c, 0x22, 0x72, 0x49, 0x42, 0x4a, 0x4e, 0x4e, 0x4e, 0x4e, 0x55, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x55, 0x56, 0x55, 0x52, 0x52, 0x5e, 0x55, 0x51, 0x47, 0x79, 0x79, 0x5c, 0x47, 0x5e, 0x53, 0x53, 0x5d, 0x5e, 0x55, 0x5e, 0x55, 0x55, 0x5b, 0x55, 0x5a, 0x5a, 0x5a, 0x55, 0x59, 0x56, 0x59, 0x56, 0x5a, 0x61, 0x54, 0x54, 0x0c, 0x17, 0x11, 0x15, 0x0f, 0x13, 0x24, 0xfe, 0xff, 0xff, 0xfd, 0xfc, 0xf3, 0xe7, 0xe7, 0xe9, 0xe7, 0xe7, 0xe7, 0xe6, 0xf0, 0xd1, 0xc0, 0xc2, 0xcd, 0xcd, 0xc0, 0xc0, 0xc9, 0xd1, 0xe2, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xd3, 0xcd, 0xbe, 0xc0, 0xbe, 0xc0, 0xc6, 0xcd, 0xcd, 0xd4, 0xf1, 0xe7, 0xed, 0xea, 0xe7, 0xef, 0xe7, 0xea, 0xed, 0xf2, 0xfd, 0xfb, 0xf4, 0xfe, 0x29, 0x1b, 0x10, 0x15, 0x0d, 0x15, 0x1f, 0x1f, 0x65, 0x65, 0x66, 0x63, 0x67, 0x69, 0x82, 0x0e, 0x96, 0x96, 0xda, 0xe0, 0xf8, 0xdc, 0xdc, 0xdc, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdf, 0xda, 0xdc, 0xdc, 0xda, 0xdf, 0xdc, 0xdc, 0xea, 0xd7, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf6, 0xfd, 0xe0, 0xdf, 0xdf, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xc4, 0xdc, 0xdc, 0xdf, 0xdc, 0xdf, 0xda, 0x07, 0x86, 0x69, 0x65, 0x55, 0x55, 0x52, 0x59, 0x4e, 0x59, 0x59, 0x59, 0x5d, 0x65, 0x54, 0x04, 0x20, 0x0b, 0x14, 0x10, 0x13, 0x24, 0x2a, 0xff, 0xff, 0xd7, 0xf1, 0xea, 0xeb, 0xeb, 0xea, 0xea, 0xee, 0xe6, 0xe8, 0xe8, 0xd0, 0xbc, 0xc0, 0xc0, 0xc0, 0xc2, 0xd1, 0xe1, 0xe5, 0xe5, 0xe5, 0xe5, 0xe2, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe4, 0xe2, 0xd1, 0xc5, 0xb9, 0xc1, 0xc9, 0xc0, 0xcd, 0xe4, 0xe3, 0xe9, 0xe7, 0xec, 0xeb, 0xe7, 0xea, 0xea, 0xea, 0xf4, 0xfb, 0xfd, 0xff, 0x2b, 0x29, 0x16, 0x0f, 0x0f, 0x15, 0x0d, 0x11, 0x20, 0x75, 0x58, 0x51, 0x5b, 0x59, 0x4a, 0x48, 0x4f, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x55, 0x5a, 0x5a, 0x5a, 0x55, 0x5a, 0x55, 0x55, 0x51, 0x55, 0x51, 0x55, 0x51, 0x55, 0x51, 0x55, 0x51, 0x55, 0x51, 0x55, 0x51, 0x55, 0x51, 0x55, 0x55, 0x4f, 0x55, 0x4f, 0x55, 0x4f, 0x4a, 0x4a, 0x53, 0x53, 0x47, 0x51, 0x79, 0x75, 0x61, 0x58, 0x61, 0x5b, 0x55, 0x55, 0x55, 0x51, 0x55, 0x53, 0x55, 0x52, 0x55, 0x55, 0x51, 0x5a, 0x52, 0x56, 0x4e, 0x59, 0x56, 0x55, 0x61, 0x54, 0x6c, 0x11, 0x17, 0x0f, 0x18, 0x14, 0x84, 0x26, 0x8a, 0x8a, 0xf7, 0xfd, 0xfb, 0xef, 0xeb, 0xe7, 0xe7, 0xe7, 0xe7, 0xea, 0xe9, 0xe8, 0xcd, 0xc5, 0xc9, 0xc9, 0xc9, 0xc8, 0xd1, 0xe2, 0xe5, 0xe5, 0xe4, 0xe4, 0xe5, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe2, 0xd3, 0xc9, 0xbe, 0xbe, 0xc0, 0xc0, 0xc0, 0xcc, 0xe8, 0xee, 0xe9, 0xea, 0xec, 0xeb, 0xea, 0xeb, 0xeb, 0xf1, 0xfc, 0xf7, 0xf9, 0xff, 0x2a, 0x23, 0x13, 0x14, 0x15, 0x18, 0x18, 0x17, 0x6c, 0x65, 0x63, 0x69, 0x61, 0x60, 0x86, 0xf8, 0x6e, 0xda, 0xe0, 0xdf, 0xda, 0xdc, 0xda, 0xdf, 0xda, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xe7, 0xd7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xd6, 0xf9, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xfd, 0xe6, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xca, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0x73, 0x86, 0x6c, 0x69, 0x51, 0x5d, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x5d, 0x55, 0x51, 0x58, 0x0c, 0x17, 0x0c, 0x14, 0x0c, 0x19, 0x25, 0x2a, 0x2a, 0xfc, 0xd6, 0xee, 0xe7, 0xeb, 0xeb, 0xea, 0xe7, 0xe9, 0xe6, 0xee, 0xe4, 0xbf, 0xbc, 0xc8, 0xc6, 0xc0, 0xd1, 0xe5, 0xe5, 0xe2, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe5, 0xe5, 0xe5, 0xe1, 0xd3, 0xe2, 0xcb, 0xb7, 0xc9, 0xc9, 0xbc, 0xe4, 0xe3, 0xe3, 0xf1, 0xe7, 0xe7, 0xeb, 0xe7, 0xe7, 0xea, 0xef, 0xf9, 0xfd, 0xff, 0xff, 0x29, 0x23, 0x10, 0x15, 0x15, 0x15, 0x0f, 0x20, 0x0c, 0x65, 0x54, 0x61, 0x51, 0x51, 0x53, 0x5e, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x5b, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x56, 0x55, 0x5b, 0x5e, 0x58, 0x51, 0x58, 0x7f, 0x75, 0x54, 0x58, 0x5e, 0x5e, 0x5e, 0x5a, 0x51, 0x5d, 0x51, 0x5e, 0x55, 0x55, 0x55, 0x5e, 0x51, 0x5e, 0x5a, 0x56, 0x5a, 0x52, 0x5d, 0x51, 0x54, 0x54, 0x77, 0x17, 0x11, 0x12, 0x14, 0x14, 0x16, 0x29, 0x2b, 0xf7, 0xf7, 0xfc, 0xf3, 0xeb, 0xe7, 0xe9, 0xe7, 0xe7, 0xe7, 0xeb, 0xe8, 0xe1, 0xc0, 0xc9, 0xc6, 0xc6, 0xcd, 0xe2, 0xe5, 0xe5, 0xe2, 0xe1, 0xe4, 0xe1, 0xe5, 0xe2, 0xe5, 0xe1, 0xe5, 0xe2, 0xe5, 0xe2, 0xe2, 0xcf, 0xbe, 0xbe, 0xcf, 0xcd, 0xbf, 0xd0, 0xf0, 0xe6, 0xe9, 0xec, 0xe7, 0xeb, 0xea, 0xea, 0xef, 0xf3, 0xfa, 0xf9, 0xfb, 0x2a, 0x28, 0x16, 0x10, 0x15, 0x15, 0x12, 0x1f, 0x04, 0x69, 0x65, 0x69, 0x65, 0x69, 0x24, 0x07, 0xda, 0xf8, 0xdf, 0x8d, 0xda, 0xda, 0x8d, 0xda, 0x7a, 0xda, 0x7a, 0xda, 0xda, 0x8d, 0xda, 0xda, 0xdf, 0xda, 0xdc, 0xda, 0xda, 0xec, 0xfd, 0xf4, 0xf6, 0xf5, 0xf5, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf4, 0xf7, 0xfc, 0xe7, 0xdf, 0xdc, 0xdf, 0xf8, 0xdf, 0xdf, 0xdf, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdf, 0x73, 0x86, 0x72, 0x6c, 0x4a, 0x51, 0x5a, 0x55, 0x59, 0x56, 0x59, 0x56, 0x66, 0x51, 0x65, 0x84, 0x17, 0x0c, 0x11, 0x0c, 0x21, 0x29, 0x29, 0x8b, 0xfd, 0xf1, 0xe9, 0xe7, 0xec, 0xe7, 0xea, 0xe7, 0xe9, 0xe6, 0xe8, 0xd0, 0xbc, 0xc0, 0xc0, 0xc9, 0xd1, 0xe5, 0xe5, 0xe5, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xd3, 0xe1, 0xe1, 0xe5, 0xe5, 0xe5, 0xe2, 0xe2, 0xc9, 0xb9, 0xd1, 0xc0, 0xcc, 0xe4, 0xe3, 0xee, 0xed, 0xe6, 0xeb, 0xea, 0xe7, 0xe7, 0xeb, 0xf3, 0xfd, 0xfb, 0x8a, 0x29, 0x25, 0x10, 0x14, 0x15, 0x15, 0x0f, 0x14, 0x22, 0x6c, 0x49, 0x54, 0x54, 0x65, 0x54, 0x51, 0x58, 0x47, 0x53, 0x47, 0x58, 0x47, 0x58, 0x47, 0x58, 0x47, 0x58, 0x47, 0x58, 0x47, 0x53, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x51, 0x49, 0x51, 0x49, 0x4a, 0x51, 0x47, 0x51, 0x47, 0x51, 0x47, 0x51, 0x43, 0x49, 0x54, 0x7f, 0x75, 0x49, 0x54, 0x49, 0x47, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x54, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x54, 0x54, 0x65, 0x0c, 0x17, 0x11, 0x11, 0x15, 0x11, 0x23, 0x2a, 0xff, 0x8a, 0xf7, 0xfd, 0xef, 0xea, 0xe7, 0xec, 0xe7, 0xe7, 0xea, 0xe9, 0xe8, 0xcc, 0xc2, 0xc9, 0xc2, 0xcd, 0xe1, 0xe5, 0xe5, 0xe2, 0xd3, 0xe2, 0xe5, 0xe5, 0xe5, 0xe2, 0xe5, 0xe2, 0xe2, 0xe1, 0xe2, 0xe2, 0xe5, 0xe2, 0xc9, 0xbe, 0xc9, 0xd1, 0xcd, 0xc4, 0xe8, 0xe9, 0xe9, 0xec, 0xe7, 0xeb, 0xea, 0xe7, 0xeb, 0xf1, 0xf9, 0xf7, 0xfb, 0xfe, 0x29, 0x16, 0x10, 0x15, 0x15, 0x12, 0x15, 0x0b, 0x6c, 0x6c, 0x6c, 0x6c, 0x02, 0x23, 0x0e, 0x0e, 0x07, 0x07, 0xda, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xdf, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0x8d, 0xda, 0xec, 0xfc, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf6, 0xfc, 0xed, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xf8, 0xdf, 0xdc, 0xc4, 0xdc, 0xdc, 0xdc, 0xc4, 0xda, 0xf8, 0x7a, 0x19, 0x77, 0x6c, 0x54, 0x54, 0x54, 0x51, 0x51, 0x51, 0x51, 0x51, 0x54, 0x49, 0x69, 0x84, 0x11, 0x11, 0x10, 0x13, 0x24, 0x29, 0xfe, 0x2b, 0x8b, 0xef, 0xee, 0xec, 0xe9, 0xe7, 0xec, 0xe9, 0xe7, 0xe8, 0xe8, 0xc8, 0xbc, 0xc9, 0xbc, 0xd1, 0xe8, 0xe5, 0xe2, 0xe1, 0xe5, 0xe2, 0xe2, 0xd3, 0xd3, 0xcf, 0xcf, 0xcf, 0xd3, 0xd3, 0xe1, 0xe2, 0xe5, 0xe2, 0xe2, 0xe2, 0xc0, 0xc9, 0xcf, 0xbc, 0xe3, 0xd4, 0xe9, 0xec, 0xea, 0xe7, 0xe7, 0xea, 0xe7, 0xe7, 0xf1, 0xfc, 0xfb, 0xff, 0x2a, 0x28, 0x13, 0x10, 0x15, 0x15, 0x0f, 0x1f, 0x1f, 0x03, 0x6c, 0x6c, 0x6c, 0x6c, 0x65, 0x6c, 0x65, 0x69, 0x65, 0x69, 0x65, 0x69, 0x65, 0x69, 0x65, 0x69, 0x65, 0x69, 0x65, 0x65, 0x69, 0x65, 0x69, 0x65, 0x69, 0x65, 0x69, 0x65, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x65, 0x69, 0x65, 0x69, 0x65, 0x69, 0x65, 0x69, 0x65, 0x69, 0x69, 0x65, 0x69, 0x69, 0x84, 0x77, 0x6c, 0x6c, 0x69, 0x69, 0x6c, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x69, 0x6c, 0x69, 0x6c, 0x6c, 0x6c, 0x72, 0x17, 0x17, 0x0c, 0x1f, 0x14, 0x13, 0x23, 0x2a, 0xff, 0xf7, 0xfd, 0xfa, 0xef, 0xe6, 0xe7, 0xee, 0xe7, 0xe7, 0xed, 0xe9, 0xd4, 0xc9, 0xc9, 0xc2, 0xc6, 0xe1, 0xe5, 0xe5, 0xe2, 0xe2, 0xe2, 0xe5, 0xe5, 0xd3, 0xd3, 0xd3, 0xd3, 0xe2, 0xe2, 0xe5, 0xe2, 0xe5, 0xe2, 0xe2, 0xe2, 0xc9, 0xb4, 0xc2, 0xd1, 0xc4, 0xd2, 0xf0, 0xe9, 0xe7, 0xec, 0xe7, 0xea, 0xe7, 0xea, 0xef, 0xf3, 0xfb, 0xf9, 0xfe, 0x29, 0x21, 0x10, 0x15, 0x18, 0x18, 0x18, 0x12, 0x0d, 0x09, 0x09, 0x06, 0x0b, 0x20, 0x21, 0x19, 0x86, 0x23, 0x21, 0x19, 0x23, 0x21, 0x21, 0x21, 0x21, 0x23, 0x19, 0x19, 0x19, 0xf8, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdf, 0xef, 0xd7, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf5, 0xf4, 0xf7, 0xf2, 0xf8, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xca, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xdf, 0x07, 0x84, 0x0c, 0x7d, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x77, 0x72, 0x77, 0x03, 0x20, 0x11, 0x14, 0x10, 0x13, 0x26, 0x29, 0x2a, 0x8b, 0xfd, 0xee, 0xec, 0xe9, 0xe9, 0xe7, 0xe9, 0xe9, 0xe9, 0xe9, 0xe4, 0xbc, 0xbc, 0xc9, 0xc9, 0xe5, 0xe5, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xcf, 0xcb, 0xc3, 0xc7, 0xc7, 0xcb, 0xcf, 0xd3, 0xd3, 0xe1, 0xe2, 0xe5, 0xe2, 0xe5, 0xcf, 0xbe, 0xd1, 0xc0, 0xd4, 0xd4, 0xe6, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xef, 0xf7, 0xfc, 0x8a, 0x2a, 0x28, 0x1b, 0x13, 0x15, 0x15, 0x15, 0x14, 0x1f, 0x20, 0x14, 0x1f, 0x11, 0x11, 0x17, 0x17, 0x17, 0x11, 0x17, 0x11, 0x17, 0x11, 0x17, 0x11, 0x17, 0x11, 0x17, 0x11, 0x17, 0x11, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x84, 0x17, 0x84, 0x17, 0x84, 0x17, 0x84, 0x17, 0x84, 0x17, 0x84, 0x17, 0x84, 0x22, 0x20, 0x0c, 0x20, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x20, 0x20, 0x20, 0x1f, 0x20, 0x1c, 0x0c, 0x14, 0x10, 0x1b, 0x28, 0x2a, 0xff, 0xfc, 0xfc, 0xf2, 0xea, 0xea, 0xe7, 0xe9, 0xe7, 0xe7, 0xe7, 0xe8, 0xd2, 0xc9, 0xc9, 0xc1, 0xcd, 0xe5, 0xe4, 0xe1, 0xe1, 0xe2, 0xe5, 0xe2, 0xcf, 0xdb, 0xc3, 0xc1, 0xc3, 0xcf, 0xd3, 0xe1, 0xe2, 0xe5, 0xe1, 0xe2, 0xe5, 0xcf, 0xc2, 0xb9, 0xd1, 0xcc, 0xc4, 0xe8, 0xee, 0xe6, 0xec, 0xe7, 0xe7, 0xea, 0xe7, 0xeb, 0xf2, 0xfb, 0xfb, 0xf9, 0xfe, 0x25, 0x13, 0x15, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x1d, 0x1d, 0x1f, 0x18, 0x1a, 0x10, 0x1b, 0x13, 0x13, 0x13, 0x10, 0x10, 0x14, 0x0f, 0x10, 0x10, 0x10, 0x0c, 0x0c, 0x07, 0x0e, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xf8, 0xf6, 0xf7, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xfc, 0xf6, 0xf8, 0xdf, 0xdf, 0xdf, 0xdf, 0xf8, 0xdf, 0xdc, 0xc4, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0x07, 0x0e, 0x16, 0x14, 0x17, 0x12, 0x1f, 0x17, 0x1f, 0x17, 0x17, 0x17, 0x17, 0x17, 0x1f, 0x17, 0x1f, 0x14, 0x14, 0x14, 0x13, 0x26, 0xfe, 0xfe, 0xfd, 0xf6, 0xed, 0xee, 0xe9, 0xe9, 0xe6, 0xe9, 0xe6, 0xe9, 0xee, 0xe1, 0xbc, 0xbe, 0xc0, 0xd1, 0xe5, 0xe2, 0xe1, 0xe1, 0xe5, 0xe2, 0xd3, 0xcb, 0xc7, 0xbd, 0xc3, 0xbd, 0xc3, 0xcb, 0xcf, 0xd1, 0xe2, 0xe1, 0xe5, 0xe2, 0xe2, 0xe2, 0xc0, 0xcb, 0xc9, 0xcc, 0xe3, 0xe3, 0xe9, 0xec, 0xe7, 0xea, 0xea, 0xe7, 0xe7, 0xef, 0xf6, 0xff, 0xd7, 0xfe, 0x29, 0x21, 0x13, 0x14, 0x1c, 0x15, 0x1c, 0x14, 0x14, 0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x1f, 0x1f, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1f, 0x1a, 0x1f, 0x1f, 0x1e, 0x14, 0x1a, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1f, 0x1a, 0x1f, 0x14, 0x1a, 0x14, 0x1a, 0x14, 0x14, 0x1d, 0x1a, 0x14, 0x16, 0x29, 0x2b, 0x8a, 0xf7, 0xfc, 0xef, 0xea, 0xe7, 0xe6, 0xe7, 0xe6, 0xe7, 0xe6, 0xe8, 0xd1, 0xc9, 0xc0, 0xc1, 0xe2, 0xe5, 0xe4, 0xe4, 0xe2, 0xe2, 0xd3, 0xcf, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 0xde, 0xde, 0xd3, 0xe1, 0xe5, 0xe1, 0xe5, 0xe2, 0xd3, 0xcb, 0xb9, 0xc9, 0xcd, 0xc4, 0xe3, 0xd5, 0xe9, 0xe7, 0xe7, 0xe7, 0xeb, 0xe7, 0xea, 0xf2, 0xfb, 0xfb, 0xfb, 0xfe, 0x28, 0x13, 0x14, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x15, 0x15, 0x1e, 0x15, 0x15, 0x1d, 0x18, 0x15, 0x18, 0x15, 0x12, 0x15, 0x10, 0x0c, 0x10, 0x16, 0xf8, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xe6, 0xfc, 0xfa, 0xf6, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf3, 0xf7, 0xfd, 0xe6, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xc4, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0x13, 0x13, 0x14, 0x12, 0x1f, 0x18, 0x15, 0x12, 0x18, 0x12, 0x12, 0x12, 0x14, 0x1f, 0x1d, 0x1c, 0x15, 0x1c, 0x15, 0x21, 0x29, 0xfe, 0xff, 0xff, 0xf3, 0xe9, 0xe9, 0xe9, 0xe9, 0xe6, 0xe9, 0xe6, 0xe9, 0xee, 0xd0, 0xbe, 0xbe, 0xc0, 0xe2, 0xe5, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xcf, 0xc7, 0xc7, 0xc3, 0xbd, 0xc7, 0xbd, 0xc7, 0xde, 0xcb, 0xe1, 0xe2, 0xe1, 0xe5, 0xe1, 0xe2, 0xcf, 0xbe, 0xcf, 0xbf, 0xe4, 0xe6, 0xe9, 0xe9, 0xec, 0xec, 0xe7, 0xea, 0xe7, 0xea, 0xf4, 0xd7, 0xfc, 0x8a, 0x29, 0x23, 0x13, 0x1c, 0x1d, 0x1d, 0x15, 0x14, 0x1e, 0x18, 0x15, 0x18, 0x1f, 0x1e, 0x14, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x1d, 0x18, 0x1d, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1d, 0x1c, 0x15, 0x1e, 0x1d, 0x1e, 0x1e, 0x1c, 0x1d, 0x1c, 0x1d, 0x1c, 0x18, 0x15, 0x1d, 0x18, 0x1d, 0x18, 0x1c, 0x18, 0x1c, 0x15, 0x15, 0x15, 0x1d, 0x15, 0x1c, 0x15, 0x1c, 0x1c, 0x1d, 0x1c, 0x1d, 0x15, 0x15, 0x1d, 0x14, 0x13, 0x21, 0x2a, 0x2a, 0xfb, 0xfd, 0xf5, 0xea, 0xe7, 0xe7, 0xe9, 0xe6, 0xe9, 0xe7, 0xe6, 0xe8, 0xcd, 0xc0, 0xc1, 0xc9, 0xe2, 0xe8, 0xe5, 0xe4, 0xe1, 0xe2, 0xcf, 0xc7, 0xde, 0xc3, 0xc3, 0xc7, 0xc3, 0xc3, 0xde, 0xcf, 0xe1, 0xe1, 0xe1, 0xe1, 0xe5, 0xe2, 0xc5, 0xb9, 0xcb, 0xe1, 0xbf, 0xd4, 0xf0, 0xe9, 0xe9, 0xe7, 0xea, 0xec, 0xeb, 0xea, 0xef, 0xf9, 0xfb, 0xfa, 0xf9, 0x29, 0x16, 0x11, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x1d, 0x15, 0x18, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x15, 0x14, 0x0c, 0x0c, 0x19, 0xf8, 0xda, 0xda, 0xdf, 0xda, 0xdc, 0xeb, 0xfd, 0xf6, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf6, 0xf7, 0xfa, 0xe0, 0xda, 0xda, 0xf8, 0xdf, 0xca, 0xdc, 0xc4, 0xdc, 0xda, 0xda, 0xda, 0xda, 0x07, 0x0e, 0x13, 0x14, 0x12, 0x15, 0x18, 0x18, 0x18, 0x15, 0x18, 0x15, 0x18, 0x18, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x1b, 0xfe, 0x2b, 0xff, 0xfd, 0xf3, 0xe9, 0xec, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xee, 0xd1, 0xbc, 0xbe, 0xbe, 0xe2, 0xe5, 0xe2, 0xe1, 0xe1, 0xe2, 0xe2, 0xcf, 0xc3, 0xc3, 0xbd, 0xbd, 0xbd, 0xc3, 0xc7, 0xc7, 0xde, 0xd1, 0xe1, 0xe1, 0xe5, 0xe2, 0xe5, 0xde, 0xc2, 0xcb, 0xbf, 0xd4, 0xe3, 0xe9, 0xe7, 0xec, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xf2, 0xfd, 0xf7, 0xfe, 0x29, 0x23, 0x13, 0x1c, 0x1d, 0x18, 0x1d, 0x1d, 0x18, 0x1d, 0x18, 0x1d, 0x18, 0x14, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1d, 0x1c, 0x15, 0x1d, 0x15, 0x1c, 0x15, 0x1d, 0x14, 0x16, 0x24, 0x29, 0xff, 0xd6, 0xfd, 0xf3, 0xea, 0xea, 0xe6, 0xe9, 0xe9, 0xe9, 0xe7, 0xe6, 0xe8, 0xcd, 0xbe, 0xc1, 0xc9, 0xe2, 0xe5, 0xe4, 0xe1, 0xe2, 0xe2, 0xcb, 0xde, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc7, 0xde, 0xde, 0xd3, 0xe5, 0xe1, 0xe5, 0xe2, 0xe2, 0xcb, 0xbd, 0xcd, 0xe2, 0xbc, 0xd4, 0xd5, 0xe9, 0xe9, 0xe7, 0xe7, 0xea, 0xeb, 0xe7, 0xeb, 0xf4, 0xf5, 0xf7, 0xfb, 0xfe, 0x21, 0x17, 0x1f, 0x15, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x18, 0x18, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x15, 0x14, 0x13, 0x10, 0x0e, 0x19, 0xda, 0xda, 0xda, 0xda, 0xda, 0xe0, 0xf6, 0xfc, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf4, 0xf7, 0xf4, 0xf4, 0xfd, 0xf4, 0xe0, 0xdc, 0xda, 0xdf, 0xdf, 0xce, 0xce, 0xf8, 0xdf, 0xf8, 0xdf, 0xf8, 0x85, 0x19, 0x13, 0x1c, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x18, 0x15, 0x15, 0x14, 0x1d, 0x14, 0x1d, 0x14, 0x1c, 0x14, 0x21, 0xfe, 0xff, 0x2b, 0xfd, 0xf4, 0xed, 0xee, 0xe9, 0xe9, 0xe6, 0xd5, 0xe6, 0xe9, 0xe9, 0xd4, 0xb9, 0xbe, 0xc0, 0xe5, 0xe2, 0xe1, 0xd3, 0xe1, 0xd3, 0xd3, 0xcb, 0xc3, 0xbd, 0xbd, 0xb0, 0xbd, 0xbd, 0xc7, 0xc3, 0xde, 0xcf, 0xe2, 0xe2, 0xe5, 0xe1, 0xe5, 0xde, 0xc1, 0xde, 0xbc, 0xe3, 0xd4, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xf3, 0xf7, 0xfb, 0x8a, 0x29, 0x23, 0x1a, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0x1d, 0x1e, 0x1e, 0x1e, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1c, 0x1e, 0x1f, 0x1e, 0x1f, 0x1a, 0x16, 0x26, 0x2a, 0xff, 0xf9, 0xfd, 0xf2, 0xea, 0xe7, 0xe7, 0xe9, 0xe9, 0xe9, 0xe7, 0xe6, 0xe8, 0xc8, 0xc9, 0xbe, 0xcb, 0xe5, 0xe4, 0xe4, 0xe1, 0xe5, 0xe2, 0xcb, 0xc3, 0xc7, 0xc3, 0xbd, 0xc3, 0xc3, 0xc7, 0xc3, 0xde, 0xd3, 0xe1, 0xe5, 0xe1, 0xe5, 0xd3, 0xcb, 0xbe, 0xcb, 0xe1, 0xbf, 0xd4, 0xe8, 0xe9, 0xe7, 0xe7, 0xea, 0xea, 0xea, 0xe7, 0xeb, 0xf4, 0xfa, 0xf4, 0xfe, 0x29, 0x1b, 0x1a, 0x15, 0x1d, 0x18, 0x1d, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x15, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x12, 0x1f, 0x10, 0x13, 0x19, 0x21, 0x07, 0xda, 0xf8, 0xda, 0x8d, 0xf8, 0xf1, 0xfa, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf7, 0xf3, 0xf6, 0xfc, 0xea, 0xf8, 0xdf, 0xdc, 0xdc, 0xdc, 0xf8, 0xf8, 0xf8, 0xe0, 0xeb, 0xef, 0x19, 0x13, 0x10, 0x13, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x14, 0x14, 0x10, 0x19, 0x27, 0xff, 0xff, 0xfc, 0xf3, 0xea, 0xec, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xd4, 0xb9, 0xbc, 0xbe, 0xe2, 0xe2, 0xe1, 0xd3, 0xe1, 0xe2, 0xd3, 0xcb, 0xc3, 0xbd, 0xbd, 0xbd, 0xb0, 0xbd, 0xc7, 0xc3, 0xc7, 0xcf, 0xd3, 0xe5, 0xe1, 0xe5, 0xe2, 0xc9, 0xc1, 0xde, 0xbc, 0xe4, 0xd2, 0xee, 0xe7, 0xec, 0xe7, 0xea, 0xe7, 0xe7, 0xea, 0xf3, 0xfc, 0xf6, 0xfe, 0x29, 0x23, 0x13, 0x1c, 0x1d, 0x1d, 0x1e, 0x1e, 0x1c, 0x1e, 0x1d, 0x1d, 0x1e, 0x1c, 0x1e, 0x1c, 0x1e, 0x1c, 0x1e, 0x1c, 0x1e, 0x1c, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1c, 0x1e, 0x1c, 0x1e, 0x1c, 0x1e, 0x1c, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e, 0x1a, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1f, 0x1a, 0x1e, 0x1a, 0x1e, 0x1a, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x0e, 0x26, 0x2b, 0xfc, 0xfc, 0xfc, 0xef, 0xea, 0xea, 0xe9, 0xe6, 0xe9, 0xe6, 0xe7, 0xe6, 0xe8, 0xcd, 0xc0, 0xb9, 0xcb, 0xe5, 0xe4, 0xe1, 0xe4, 0xe2, 0xe2, 0xc7, 0xc3, 0xc3, 0xc3, 0xc3, 0xbd, 0xc7, 0xc7, 0xc3, 0xc1, 0xd3, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xc3, 0xc1, 0xcf, 0xcd, 0xbc, 0xd4, 0xd5, 0xe9, 0xe7, 0xe7, 0xea, 0xe7, 0xe7, 0xe7, 0xed, 0xf3, 0xfb, 0xf4, 0xfe, 0x29, 0x1b, 0x14, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1e, 0x13, 0x13, 0x13, 0x0e, 0x07, 0x73, 0xda, 0xda, 0x8d, 0xdf, 0xef, 0xfc, 0xf4, 0xf3, 0xfa, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf3, 0xf3, 0xfa, 0xf7, 0xfa, 0xf6, 0xf9, 0xf3, 0xeb, 0xec, 0xe9, 0xe6, 0xe7, 0xea, 0xef, 0xef, 0x89, 0x89, 0x85, 0x19, 0x19, 0x21, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x16, 0x1b, 0x16, 0x19, 0x16, 0x85, 0xfe, 0xfc, 0xfb, 0xfb, 0xf2, 0xea, 0xe9, 0xe9, 0xe6, 0xe6, 0xd5, 0xe6, 0xe6, 0xe9, 0xe4, 0xbc, 0xb7, 0xb7, 0xe2, 0xe2, 0xe2, 0xd1, 0xe2, 0xd3, 0xd3, 0xcb, 0xc3, 0xbd, 0xbd, 0xbd, 0xbd, 0xc3, 0xc7, 0xc3, 0xc7, 0xcf, 0xe2, 0xe2, 0xe5, 0xe1, 0xe2, 0xc6, 0xc1, 0xc1, 0xbf, 0xe4, 0xe0, 0xe8, 0xec, 0xe7, 0xea, 0xea, 0xe7, 0xe7, 0xec, 0xf6, 0xf7, 0xfa, 0xff, 0xfe, 0x24, 0x19, 0x1a, 0x1a, 0x1a, 0x1a, 0x16, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1b, 0x1b, 0x1a, 0x16, 0x1a, 0x13, 0x1a, 0x13, 0x1a, 0x1b, 0x1a, 0x1b, 0x1a, 0x1b, 0x1a, 0x1b, 0x1a, 0x1b, 0x1a, 0x1b, 0x1a, 0x1b, 0x1a, 0x1b, 0x1a, 0x1b, 0x1a, 0x1b, 0x1a, 0x1b, 0x1a, 0x1b, 0x1b, 0x16, 0x1b, 0x16, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x21, 0x1b, 0x19, 0x16, 0x19, 0x1b, 0x16, 0x16, 0x1b, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x84, 0x16, 0x16, 0x16, 0x16, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0e, 0x29, 0xff, 0xfb, 0xd7, 0xf7, 0xef, 0xea, 0xea, 0xe6, 0xd5, 0xe6, 0xe9, 0xe7, 0xe7, 0xe8, 0xcd, 0xc0, 0xb9, 0xc0, 0xe5, 0xe5, 0xe4, 0xe1, 0xe5, 0xe2, 0xcb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc7, 0xc7, 0xc7, 0xc3, 0xcf, 0xe2, 0xe1, 0xe1, 0xe5, 0xd3, 0xc2, 0xc1, 0xcf, 0xc8, 0xb5, 0xd4, 0xee, 0xe9, 0xe7, 0xeb, 0xeb, 0xe7, 0xe7, 0xe7, 0xeb, 0xf6, 0xfa, 0xf9, 0xfe, 0x28, 0x21, 0x14, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1d, 0x1c, 0x1c, 0x1c, 0x14, 0x1c, 0x14, 0x1c, 0x13, 0x1c, 0x13, 0x1a, 0x13, 0x13, 0x16, 0x19, 0x07, 0x07, 0xdf, 0xf8, 0xf8, 0xe0, 0xeb, 0xf7, 0xf5, 0xf7, 0xfc, 0xf4, 0xfa, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf3, 0xfc, 0xfa, 0xf3, 0xf5, 0xfd, 0xff, 0xf7, 0xf6, 0xf4, 0xf9, 0xfb, 0xff, 0xf6, 0xf6, 0xf3, 0xfe, 0x29, 0x28, 0x26, 0x28, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x24, 0x24, 0x26, 0x24, 0x26, 0x24, 0x26, 0x26, 0x99, 0xff, 0xfb, 0xfb, 0xf4, 0xeb, 0xe7, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe4, 0xc8, 0xb6, 0xb6, 0xc9, 0xe2, 0xe2, 0xd1, 0xd3, 0xd3, 0xd3, 0xcb, 0xc3, 0xbd, 0xbd, 0xbd, 0xc7, 0xbd, 0xc7, 0xc7, 0xc7, 0xcf, 0xe2, 0xe2, 0xe2, 0xe1, 0xd3, 0xc2, 0xc1, 0xc1, 0xc8, 0xd4, 0xe3, 0xe9, 0xe9, 0xea, 0xe7, 0xea, 0xea, 0xe7, 0xef, 0xf7, 0xfc, 0xf4, 0xff, 0xfb, 0x26, 0x24, 0x23, 0x24, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x26, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x26, 0xfe, 0x2b, 0xf6, 0xfc, 0xfd, 0xf9, 0xeb, 0xeb, 0xe9, 0xe6, 0xe9, 0xe6, 0xea, 0xe6, 0xe8, 0xe1, 0xbc, 0xb9, 0xb9, 0xd1, 0xe4, 0xe1, 0xe1, 0xe2, 0xe2, 0xcb, 0xc7, 0xc3, 0xde, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xd3, 0xd3, 0xe1, 0xe1, 0xe5, 0xd1, 0xc1, 0xc1, 0xd3, 0xc0, 0xba, 0xd4, 0xee, 0xe7, 0xe6, 0xeb, 0xea, 0xe7, 0xe7, 0xe7, 0xef, 0xf6, 0xf5, 0xf9, 0xfb, 0x29, 0x19, 0x1b, 0x1b, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1b, 0x1b, 0x21, 0x1b, 0x21, 0x21, 0x21, 0x21, 0x23, 0x21, 0x21, 0x24, 0x24, 0x26, 0x26, 0xef, 0x27, 0xf2, 0xd7, 0xfc, 0xfc, 0xfc, 0xf7, 0xf4, 0xf4, 0xf5, 0xf5, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf5, 0xf4, 0xfa, 0xf7, 0xfa, 0xf3, 0xf3, 0xfd, 0xfa, 0xf3, 0x27, 0xf9, 0xf7, 0xf7, 0xfb, 0xfb, 0xfb, 0xf6, 0x94, 0xd6, 0x8a, 0x2a, 0x2a, 0xfe, 0xfe, 0xff, 0x2a, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x2a, 0xff, 0xff, 0x99, 0xfd, 0xf9, 0xfd, 0xfb, 0xeb, 0xea, 0xe9, 0xe6, 0xd5, 0xe6, 0xe9, 0xe6, 0xe6, 0xe8, 0xd1, 0xb6, 0xb6, 0xb7, 0xd1, 0xd3, 0xd1, 0xd3, 0xd1, 0xd3, 0xcf, 0xc7, 0xbd, 0xbd, 0xc7, 0xc3, 0xc7, 0xc7, 0xc7, 0xc7, 0xd3, 0xe2, 0xe2, 0xe1, 0xe1, 0xd1, 0xbe, 0xbe, 0xb9, 0xe1, 0xd0, 0xe8, 0xe9, 0xe7, 0xec, 0xea, 0xe7, 0xea, 0xe7, 0xef, 0xf7, 0xf7, 0xf9, 0xf7, 0xfd, 0xfb, 0xfe, 0x29, 0x29, 0x29, 0x29, 0x8a, 0xfe, 0xfe, 0x29, 0x29, 0x29, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x29, 0xfe, 0x29, 0xfe, 0x29, 0xfe, 0x29, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x2a, 0xfe, 0xfe, 0x29, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x29, 0xfe, 0x29, 0x29, 0x29, 0x29, 0x29, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfb, 0xf7, 0xfd, 0xf4, 0xef, 0xeb, 0xe9, 0xd5, 0xe8, 0xe9, 0xe7, 0xe7, 0xe8, 0xe1, 0xc0, 0xb9, 0xb7, 0xc2, 0xe1, 0xe4, 0xe1, 0xe2, 0xe2, 0xcf, 0xcb, 0xc3, 0xde, 0xc7, 0xcf, 0xc3, 0xc7, 0xc7, 0xc7, 0xd3, 0xe2, 0xe1, 0xe1, 0xe1, 0xcd, 0xb9, 0xde, 0xd1, 0xb6, 0xbf, 0xe8, 0xe9, 0xe9, 0xe6, 0xeb, 0xea, 0xe7, 0xea, 0xe7, 0xef, 0xf6, 0xf6, 0xf6, 0xf6, 0xff, 0x26, 0x26, 0x25, 0x24, 0x28, 0x26, 0x26, 0x26, 0x25, 0x28, 0x28, 0x26, 0x28, 0x28, 0x28, 0x28, 0x29, 0x28, 0x29, 0x29, 0x29, 0x2a, 0x2b, 0xfb, 0xfc, 0xfd, 0xfc, 0xf6, 0xf5, 0xf6, 0xf3, 0xf6, 0xfd, 0xf5, 0xf3, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf5, 0xf4, 0xfa, 0xf4, 0xfa, 0xf4, 0xfb, 0xf7, 0xfa, 0xf3, 0xf5, 0xf5, 0xf9, 0xf9, 0xfb, 0xf5, 0xf4, 0xf9, 0xf9, 0xf9, 0xf6, 0xf6, 0xd6, 0xf3, 0x27, 0xfb, 0x27, 0xf3, 0x27, 0xf4, 0xf9, 0xf9, 0xfb, 0xfb, 0xfe, 0xf9, 0xfe, 0xf9, 0xfb, 0xfb, 0xfb, 0xfb, 0x27, 0xfb, 0xfb, 0xf9, 0xfc, 0xfc, 0xef, 0xea, 0xec, 0xe9, 0xe6, 0xe9, 0xe6, 0xe6, 0xe6, 0xe8, 0xe4, 0xb6, 0xb6, 0xae, 0xc9, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xcf, 0xcb, 0xc7, 0xc3, 0xbd, 0xc3, 0xbd, 0xc7, 0xc7, 0xcf, 0xd3, 0xe2, 0xd3, 0xd1, 0xd1, 0xc9, 0xbe, 0xb9, 0xb9, 0xd4, 0xd2, 0xee, 0xe9, 0xe9, 0xea, 0xeb, 0xea, 0xe7, 0xe7, 0xef, 0xf7, 0xfa, 0xf9, 0xf6, 0xf4, 0xf4, 0xfb, 0xff, 0xfe, 0x27, 0x27, 0x27, 0x99, 0xf9, 0x27, 0xfb, 0x27, 0x27, 0x27, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfb, 0xf9, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x27, 0xff, 0x27, 0xff, 0x27, 0xfb, 0x27, 0xfb, 0x27, 0xfb, 0xfb, 0xfb, 0xfb, 0x27, 0x27, 0xfb, 0x27, 0xfb, 0x27, 0xff, 0x27, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xfe, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0x27, 0xfb, 0xf7, 0xf4, 0xfa, 0xef, 0xea, 0xef, 0xe9, 0xe9, 0xe9, 0xe9, 0xea, 0xe7, 0xe6, 0xe8, 0xc9, 0xb9, 0xb8, 0xb7, 0xcf, 0xe2, 0xe1, 0xe1, 0xe2, 0xd3, 0xcf, 0xde, 0xde, 0xde, 0xc7, 0xc3, 0xc3, 0xc7, 0xd3, 0xd3, 0xe2, 0xd3, 0xe1, 0xd1, 0xc2, 0xb4, 0xcb, 0xc9, 0xb5, 0xcc, 0xe8, 0xe9, 0xeb, 0xe7, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xf6, 0xf7, 0xf1, 0xd6, 0xf7, 0x27, 0x2a, 0x2a, 0x2b, 0xfe, 0xff, 0x8a, 0xfe, 0x8a, 0xfe, 0xff, 0x2a, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0x27, 0xfe, 0xff, 0x27, 0x27, 0xfa, 0xf6, 0xf4, 0xf6, 0xf6, 0xf3, 0xf6, 0xfc, 0xf2, 0xf4, 0xf7, 0xfa, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xf6, 0xf6, 0xf7, 0x99, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xfb, 0xf9, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xfb, 0xf4, 0xfb, 0xfc, 0xf2, 0xea, 0xec, 0xec, 0xe9, 0xe9, 0xe6, 0xe9, 0xe6, 0xe8, 0xe8, 0xbf, 0xb6, 0xae, 0xb1, 0xcf, 0xd3, 0xcf, 0xd3, 0xcf, 0xd3, 0xd3, 0xcf, 0xcf, 0xc9, 0xcb, 0xcb, 0xcf, 0xd3, 0xe2, 0xe2, 0xe2, 0xc9, 0xd3, 0xd1, 0xb7, 0xc0, 0xaf, 0xc8, 0xd4, 0xe3, 0xea, 0xe9, 0xea, 0xe7, 0xea, 0xec, 0xea, 0xea, 0xf1, 0xf9, 0xfc, 0xf9, 0xf5, 0xf6, 0xf6, 0xfa, 0xf9, 0xf9, 0xfb, 0x99, 0xfa, 0xf5, 0xfa, 0xfa, 0xf9, 0xfb, 0x99, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf5, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xf9, 0xf9, 0xf9, 0xfb, 0xf9, 0xfb, 0xf4, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0x27, 0xf9, 0xf5, 0xf7, 0xfa, 0xf1, 0xef, 0xef, 0xee, 0xe7, 0xe9, 0xe9, 0xed, 0xe6, 0xe6, 0xe8, 0xd1, 0xb7, 0xbd, 0xa8, 0xbd, 0xcf, 0xe2, 0xd1, 0xe1, 0xe1, 0xe1, 0xcf, 0xc6, 0xde, 0xdb, 0xc1, 0xcb, 0xd3, 0xe2, 0xe2, 0xd3, 0xe1, 0xe2, 0xc9, 0xb1, 0xb9, 0xcf, 0xbc, 0xb5, 0xd4, 0xe9, 0xe9, 0xe9, 0xe7, 0xea, 0xea, 0xea, 0xea, 0xeb, 0xf9, 0xfc, 0xf4, 0xf6, 0xf6, 0xf6, 0xf9, 0xfb, 0xf9, 0xf9, 0xfb, 0xf9, 0x27, 0x99, 0x27, 0xfb, 0x27, 0xf9, 0xf9, 0x27, 0xf9, 0x27, 0xf9, 0xf9, 0x27, 0xf9, 0x27, 0xf9, 0xf9, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xfc, 0xf3, 0xed, 0xed, 0xec, 0xe9, 0xe7, 0xe6, 0xe6, 0xe9, 0xe3, 0xe8, 0xd4, 0xb6, 0xae, 0xa6, 0xaa, 0xcf, 0xd3, 0xcf, 0xd3, 0xcf, 0xd3, 0xd1, 0xd3, 0xd3, 0xd3, 0xe2, 0xe2, 0xd3, 0xd3, 0xd1, 0xcb, 0xd1, 0xd3, 0xb7, 0xb7, 0xb1, 0xb6, 0xe2, 0xe0, 0xe6, 0xed, 0xe7, 0xe7, 0xed, 0xe6, 0xe6, 0xea, 0xef, 0xf2, 0xfc, 0xfa, 0xfb, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xfb, 0xfa, 0xf9, 0xf7, 0xf5, 0xf2, 0xef, 0xed, 0xef, 0xea, 0xe7, 0xea, 0xe9, 0xe7, 0xea, 0xe6, 0xe4, 0xcb, 0xa2, 0xb3, 0xa2, 0xb8, 0xcf, 0xe1, 0xe1, 0xe1, 0xe5, 0xe2, 0xd1, 0xcf, 0xcf, 0xd3, 0xe2, 0xe2, 0xe2, 0xd3, 0xd3, 0xcf, 0xcd, 0xb4, 0xa6, 0xcf, 0xc2, 0xa3, 0xc4, 0xe9, 0xe9, 0xe9, 0xe7, 0xea, 0xe7, 0xea, 0xea, 0xea, 0xef, 0xf4, 0xf7, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xf9, 0xfb, 0xfa, 0xf9, 0xf5, 0xfc, 0xf4, 0xf1, 0xed, 0xec, 0xec, 0xe9, 0xe6, 0xe6, 0xe9, 0xe3, 0xe4, 0xe8, 0xbf, 0xa6, 0xb7, 0xa0, 0xab, 0xcb, 0xcf, 0xd3, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xcf, 0xcb, 0xcd, 0xcf, 0xb7, 0xae, 0xb7, 0xa3, 0xcd, 0xd0, 0xe3, 0xe6, 0xec, 0xe7, 0xe7, 0xec, 0xe7, 0xe6, 0xe7, 0xef, 0xf3, 0xfa, 0xf5, 0xf4, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xfa, 0xfb, 0xf5, 0xfa, 0xf5, 0xf4, 0xef, 0xed, 0xef, 0xed, 0xe9, 0xe9, 0xe7, 0xe7, 0xe7, 0xe6, 0xe8, 0xd3, 0xb3, 0xb3, 0xa8, 0xa2, 0xb7, 0xcf, 0xd1, 0xc9, 0xcf, 0xd3, 0xe2, 0xe2, 0xe2, 0xe2, 0xd3, 0xd3, 0xd3, 0xd1, 0xd3, 0xcd, 0xb4, 0xa0, 0xaa, 0xcd, 0xb7, 0xb5, 0xd2, 0xee, 0xe9, 0xe9, 0xec, 0xeb, 0xe7, 0xea, 0xe7, 0xea, 0xf2, 0xf9, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfb, 0xf9, 0xf9, 0xf5, 0xf9, 0xf7, 0xf5, 0xf3, 0xec, 0xed, 0xe9, 0xec, 0xe9, 0xe6, 0xe6, 0xee, 0xd4, 0xe8, 0xe1, 0xbc, 0xa6, 0xa5, 0xa4, 0x9f, 0xbe, 0xc7, 0xc5, 0xc7, 0xcb, 0xc1, 0xde, 0xcb, 0xc5, 0xc1, 0xc1, 0xcb, 0xcb, 0xcb, 0xb7, 0xa0, 0xae, 0xa0, 0xbc, 0xd0, 0xd0, 0xee, 0xea, 0xe6, 0xec, 0xea, 0xe7, 0xea, 0xea, 0xe7, 0xf1, 0xfa, 0xf7, 0xf9, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf7, 0xf1, 0xef, 0xed, 0xed, 0xed, 0xea, 0xe9, 0xe7, 0xe7, 0xe6, 0xe8, 0xe5, 0xcd, 0xab, 0xb3, 0xa4, 0x9f, 0xa4, 0xb9, 0xcf, 0xcb, 0xc7, 0xc7, 0xcf, 0xcb, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xc1, 0xb6, 0x9c, 0xa0, 0xc0, 0xae, 0xa3, 0xcc, 0xe9, 0xee, 0xec, 0xe9, 0xec, 0xea, 0xea, 0xe7, 0xea, 0xef, 0xf4, 0xf4, 0xf3, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xfb, 0xfa, 0xf9, 0xf9, 0xf5, 0xfa, 0xf6, 0xef, 0xec, 0xed, 0xed, 0xe9, 0xe6, 0xe6, 0xe9, 0xe3, 0xe3, 0xe8, 0xd1, 0xae, 0xa6, 0xaa, 0xa4, 0xa2, 0xab, 0xbe, 0xc1, 0xbe, 0xc1, 0xc1, 0xc1, 0xc5, 0xcb, 0xcb, 0xc1, 0xb9, 0xaa, 0x9e, 0xa1, 0x9e, 0xac, 0xd4, 0xcc, 0xe6, 0xe9, 0xec, 0xe7, 0xe7, 0xea, 0xec, 0xea, 0xe7, 0xef, 0xf3, 0xfc, 0xf7, 0xf5, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xfa, 0x99, 0xfb, 0xfa, 0xf5, 0xf4, 0xf7, 0xf3, 0xef, 0xef, 0xed, 0xed, 0xe9, 0xea, 0xe7, 0xe7, 0xed, 0xe3, 0xe4, 0xe5, 0xc9, 0xa6, 0xb8, 0xaa, 0x9f, 0x9f, 0xb3, 0xbd, 0xc7, 0xc3, 0xde, 0xde, 0xcb, 0xcb, 0xcb, 0xbe, 0xb7, 0x9f, 0x9c, 0x9e, 0xae, 0xb5, 0xa0, 0xba, 0xe4, 0xee, 0xe6, 0xe6, 0xec, 0xe7, 0xe7, 0xea, 0xe7, 0xea, 0xf1, 0xf4, 0xf6, 0xf4, 0xd6, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xfa, 0xf4, 0xf5, 0xf6, 0xf7, 0xf1, 0xed, 0xec, 0xed, 0xec, 0xe9, 0xe7, 0xe3, 0xe9, 0xe9, 0xe4, 0xe8, 0xcd, 0xb6, 0xa1, 0xb7, 0x9f, 0x9f, 0xa4, 0xab, 0xb8, 0xb9, 0xc1, 0xbe, 0xbe, 0xb9, 0xb3, 0xa1, 0x9f, 0x9f, 0xa0, 0x9e, 0xa3, 0xd0, 0xce, 0xe3, 0xe7, 0xe6, 0xea, 0xed, 0xe7, 0xeb, 0xed, 0xe7, 0xe7, 0xef, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xf5, 0xfa, 0xf5, 0xf4, 0xf7, 0xf4, 0xf1, 0xef, 0xef, 0xed, 0xed, 0xe7, 0xe7, 0xe7, 0xe7, 0xe9, 0xe3, 0xf0, 0xe8, 0xbc, 0xa6, 0xaa, 0xb3, 0xa2, 0x9f, 0x9f, 0xa2, 0xab, 0xb4, 0xb7, 0xb4, 0xb4, 0xa4, 0x9f, 0x9b, 0x9c, 0x9e, 0xb6, 0xb5, 0x9e, 0xba, 0xe4, 0xf1, 0xe9, 0xe7, 0xe6, 0xec, 0xe7, 0xe6, 0xea, 0xea, 0xef, 0xf3, 0xf6, 0xf4, 0xf4, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf5, 0xf9, 0xfa, 0xfb, 0xf5, 0xf4, 0xf4, 0xf6, 0xf7, 0xf1, 0xe7, 0xed, 0xec, 0xe9, 0xec, 0xe7, 0xe6, 0xe9, 0xe6, 0xe3, 0xf0, 0xe5, 0xb5, 0xa1, 0xb7, 0xd9, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa0, 0xa6, 0xa0, 0xb5, 0xd4, 0xd2, 0xe3, 0xeb, 0xea, 0xeb, 0xea, 0xea, 0xec, 0xea, 0xe7, 0xeb, 0xef, 0xf3, 0xf7, 0xf7, 0xf4, 0xf5, 0xfa, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfb, 0xf4, 0x27, 0xf5, 0xfa, 0xf3, 0xf4, 0xf7, 0xf3, 0xed, 0xed, 0xef, 0xed, 0xea, 0xe9, 0xe7, 0xe9, 0xe6, 0xea, 0xe6, 0xe8, 0xe8, 0xc9, 0xb1, 0xaa, 0xab, 0xab, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0xa6, 0xb1, 0xa3, 0xa0, 0xbf, 0xe9, 0xee, 0xe6, 0xe9, 0xec, 0xea, 0xec, 0xea, 0xea, 0xea, 0xe7, 0xf2, 0xf4, 0xf4, 0xd6, 0xf6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf4, 0xf5, 0xf6, 0xf7, 0xf2, 0xed, 0xed, 0xed, 0xed, 0xec, 0xea, 0xe7, 0xe7, 0xe9, 0xe6, 0xe8, 0xe8, 0xe1, 0xbf, 0xae, 0xa0, 0xa5, 0xb6, 0xb1, 0xa5, 0xa7, 0xa7, 0xa7, 0xa6, 0xd9, 0xa6, 0xaa, 0xae, 0xbf, 0xcc, 0xe3, 0xe3, 0xea, 0xea, 0xeb, 0xef, 0xe7, 0xe7, 0xef, 0xe7, 0xe7, 0xeb, 0xf2, 0xf5, 0xfa, 0xfa, 0xf5, 0xfa, 0xf7, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xfa, 0xfa, 0xf9, 0xf5, 0xfa, 0xfa, 0xf5, 0xf5, 0xf6, 0xf3, 0xf1, 0xef, 0xef, 0xed, 0xe7, 0xe7, 0xe9, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe8, 0xe8, 0xd1, 0xb6, 0xa5, 0xa5, 0xaa, 0xa7, 0xa6, 0xa0, 0xa1, 0xa0, 0xa1, 0xa5, 0xa6, 0xb1, 0xa6, 0xa0, 0xa3, 0xce, 0xf0, 0xee, 0xe6, 0xe6, 0xec, 0xed, 0xe7, 0xe7, 0xeb, 0xeb, 0xea, 0xf1, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf7, 0xf4, 0xf1, 0xef, 0xec, 0xec, 0xed, 0xeb, 0xeb, 0xea, 0xea, 0xe7, 0xe6, 0xe8, 0xe8, 0xf0, 0xe1, 0xc8, 0xba, 0xa6, 0xa3, 0xae, 0xae, 0xa6, 0xa6, 0xa6, 0xae, 0xb6, 0xbf, 0xcc, 0xd4, 0xe4, 0xe3, 0xe7, 0xed, 0xea, 0xeb, 0xeb, 0xea, 0xeb, 0xeb, 0xea, 0xe7, 0xef, 0xf4, 0xf5, 0xf6, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xfa, 0xfa, 0xf5, 0xf5, 0xfa, 0xf6, 0xfa, 0xf6, 0xf3, 0xf1, 0xef, 0xef, 0xed, 0xec, 0xe9, 0xe9, 0xe7, 0xe7, 0xea, 0xe7, 0xe7, 0xe8, 0xf0, 0xf0, 0xe1, 0xbc, 0xae, 0xa3, 0xa3, 0xa6, 0xa3, 0xa5, 0xa3, 0xa6, 0xa6, 0xa3, 0xb6, 0xcc, 0xe8, 0xf0, 0xe6, 0xe6, 0xea, 0xef, 0xe7, 0xe7, 0xeb, 0xe7, 0xe7, 0xe7, 0xeb, 0xf3, 0xf4, 0xf6, 0xf6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf9, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf5, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xf6, 0xf6, 0xf3, 0xf1, 0xec, 0xec, 0xec, 0xef, 0xef, 0xeb, 0xea, 0xea, 0xe7, 0xe9, 0xe6, 0xe3, 0xe8, 0xe8, 0xf0, 0xd4, 0xc8, 0xc4, 0xbc, 0xbf, 0xbf, 0xcc, 0xcc, 0xe4, 0xe4, 0xe8, 0xe3, 0xe9, 0xe6, 0xec, 0xeb, 0xea, 0xeb, 0xea, 0xea, 0xeb, 0xea, 0xea, 0xef, 0xf2, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xf5, 0xfa, 0xf9, 0xf5, 0xf5, 0xf5, 0xfa, 0xf6, 0xfa, 0xf7, 0xf7, 0xf3, 0xf2, 0xeb, 0xef, 0xed, 0xe9, 0xe7, 0xe7, 0xea, 0xea, 0xea, 0xe7, 0xe6, 0xe4, 0xe8, 0xe8, 0xe8, 0xe3, 0xcc, 0xbf, 0xbc, 0xba, 0xb5, 0xb5, 0xbc, 0xc8, 0xd0, 0xe4, 0xe8, 0xf0, 0xe6, 0xe9, 0xec, 0xea, 0xe7, 0xea, 0xe7, 0xec, 0xea, 0xe6, 0xe7, 0xf2, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf3, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xfa, 0xf9, 0xf9, 0xf9, 0xf5, 0xf4, 0xf5, 0xf5, 0xf6, 0xf7, 0xf7, 0xf2, 0xef, 0xec, 0xec, 0xeb, 0xef, 0xeb, 0xeb, 0xea, 0xea, 0xe7, 0xe9, 0xee, 0xe3, 0xe3, 0xe6, 0xe8, 0xee, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xf0, 0xe8, 0xe3, 0xe3, 0xe9, 0xee, 0xe7, 0xec, 0xea, 0xea, 0xea, 0xea, 0xea, 0xeb, 0xe7, 0xeb, 0xf3, 0xf5, 0xf7, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf6, 0xfa, 0xf4, 0xf2, 0xef, 0xed, 0xec, 0xec, 0xe9, 0xe7, 0xe7, 0xea, 0xea, 0xe7, 0xe7, 0xe6, 0xe6, 0xe3, 0xee, 0xee, 0xf1, 0xf0, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe8, 0xf0, 0xe6, 0xe6, 0xe9, 0xec, 0xea, 0xeb, 0xef, 0xea, 0xe7, 0xe7, 0xeb, 0xeb, 0xef, 0xf6, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xd6, 0xf4, 0xd6, 0xf9, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf5, 0xf9, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf7, 0xf7, 0xf6, 0xf3, 0xef, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xec, 0xea, 0xe9, 0xea, 0xee, 0xe9, 0xe9, 0xe3, 0xe6, 0xe3, 0xe3, 0xe6, 0xe6, 0xe6, 0xe6, 0xeb, 0xed, 0xea, 0xe7, 0xeb, 0xea, 0xea, 0xeb, 0xeb, 0xea, 0xeb, 0xea, 0xea, 0xf1, 0xfa, 0xf7, 0xf4, 0xfa, 0xf5, 0xfa, 0xf6, 0xf5, 0x99, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf5, 0xf2, 0xef, 0xeb, 0xeb, 0xeb, 0xe7, 0xea, 0xe7, 0xe7, 0xe7, 0xe7, 0xec, 0xed, 0xea, 0xe3, 0xe3, 0xe6, 0xe9, 0xe9, 0xe8, 0xee, 0xe9, 0xe9, 0xe6, 0xe6, 0xed, 0xe6, 0xe7, 0xed, 0xea, 0xe6, 0xe7, 0xef, 0xea, 0xe7, 0xe6, 0xea, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf5, 0xf5, 0xf9, 0xf9, 0xf5, 0xf4, 0xf5, 0xf5, 0xf6, 0xf4, 0xf6, 0xf7, 0xf6, 0xf2, 0xef, 0xec, 0xec, 0xec, 0xeb, 0xec, 0xea, 0xec, 0xeb, 0xe7, 0xec, 0xe9, 0xea, 0xe6, 0xea, 0xee, 0xed, 0xec, 0xe9, 0xe7, 0xe7, 0xea, 0xea, 0xeb, 0xea, 0xea, 0xeb, 0xea, 0xe7, 0xed, 0xec, 0xea, 0xeb, 0xef, 0xef, 0xf3, 0xfc, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf6, 0xf7, 0xf5, 0xf2, 0xef, 0xef, 0xeb, 0xec, 0xe7, 0xe9, 0xe9, 0xe9, 0xec, 0xe7, 0xe7, 0xe7, 0xef, 0xea, 0xe6, 0xe6, 0xe7, 0xe6, 0xe6, 0xe6, 0xe7, 0xeb, 0xef, 0xea, 0xeb, 0xea, 0xea, 0xeb, 0xeb, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xec, 0xf3, 0xf6, 0xf4, 0xf6, 0xf4, 0xf3, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xd6, 0xf2, 0xf1, 0xed, 0xee, 0xec, 0xec, 0xec, 0xea, 0xec, 0xec, 0xec, 0xe7, 0xe7, 0xe7, 0xe9, 0xe7, 0xe7, 0xe7, 0xe7, 0xea, 0xeb, 0xef, 0xeb, 0xeb, 0xea, 0xea, 0xeb, 0xea, 0xe7, 0xed, 0xe9, 0xea, 0xef, 0xf2, 0xf9, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0x99, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf5, 0xf9, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xfa, 0xf5, 0xf5, 0xf4, 0xf9, 0xef, 0xef, 0xed, 0xec, 0xee, 0xe9, 0xe9, 0xe9, 0xea, 0xeb, 0xed, 0xea, 0xe7, 0xe9, 0xec, 0xe7, 0xea, 0xeb, 0xeb, 0xea, 0xea, 0xe7, 0xe7, 0xeb, 0xef, 0xe7, 0xe7, 0xe7, 0xeb, 0xea, 0xe7, 0xe7, 0xf1, 0xd6, 0xf3, 0xf3, 0xf3, 0xf6, 0xf3, 0xf3, 0xf4, 0xfa, 0xfa, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf4, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xd6, 0xf4, 0xf6, 0xf2, 0xf1, 0xee, 0xed, 0xec, 0xec, 0xec, 0xec, 0xea, 0xec, 0xed, 0xec, 0xe7, 0xea, 0xec, 0xea, 0xeb, 0xeb, 0xea, 0xea, 0x85, 0xeb, 0xeb, 0xeb, 0xea, 0xeb, 0xea, 0xe7, 0xec, 0xe7, 0xeb, 0xf2, 0xf9, 0xfc, 0xfb, 0xf9, 0xf5, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0x99, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xf5, 0xf3, 0xf4, 0xfa, 0xfb, 0xf3, 0xf2, 0xef, 0xec, 0xec, 0xe9, 0xec, 0xe9, 0xe7, 0xe7, 0xeb, 0xea, 0xe9, 0xec, 0xe9, 0xea, 0xea, 0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe7, 0xea, 0xe7, 0xef, 0xf3, 0xf6, 0xf3, 0xf2, 0xf7, 0xf4, 0xf4, 0xf4, 0xf9, 0xf5, 0xfa, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf4, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfc, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xf7, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfc, 0xfa, 0xfc, 0xfb, 0xf7, 0xfb, 0xf7, 0xf7, 0xf6, 0xf2, 0xef, 0xec, 0xec, 0xeb, 0xec, 0xec, 0xec, 0xec, 0xea, 0xec, 0xe7, 0xec, 0xeb, 0xea, 0xeb, 0xeb, 0xeb, 0xea, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xeb, 0xeb, 0xef, 0xf9, 0xfb, 0xfd, 0xfc, 0xfc, 0xfc, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xf7, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf7, 0xfb, 0xfc, 0xfb, 0xf7, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfc, 0xfb, 0x99, 0xf2, 0xf1, 0xef, 0xec, 0xec, 0xec, 0xec, 0xec, 0xea, 0xe9, 0xe7, 0xe9, 0xe7, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xeb, 0xea, 0xe7, 0xe7, 0xea, 0xeb, 0xf2, 0xf5, 0xfb, 0xfa, 0xf5, 0xfb, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfc, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfc, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0xd6, 0xf2, 0xef, 0xec, 0xea, 0xec, 0xec, 0xea, 0xec, 0xeb, 0xec, 0xea, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xeb, 0xef, 0xf1, 0xf9, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xd7, 0xfc, 0xd7, 0xfc, 0xd7, 0xfc, 0xfc, 0xfc, 0xfc, 0xd7, 0xfc, 0xfc, 0xfc, 0xd7, 0xfd, 0xfc, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x8b, 0xfd, 0xd7, 0xfd, 0xfd, 0xfd, 0xd7, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfd, 0xd7, 0xfc, 0xd7, 0xfc, 0x99, 0xf3, 0xef, 0xec, 0xec, 0xef, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xea, 0xec, 0xea, 0xec, 0xe7, 0xea, 0xe7, 0xec, 0xea, 0xe7, 0xe7, 0xe7, 0xed, 0xf1, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xf7, 0xfb, 0xf7, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xfb, 0xfa, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0xf7, 0xf3, 0xf1, 0xec, 0xef, 0xec, 0xeb, 0xe7, 0xea, 0xe7, 0xeb, 0xea, 0xea, 0xea, 0xeb, 0xea, 0xea, 0xeb, 0xef, 0xf1, 0xf2, 0xf4, 0xf7, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0xfd, 0xd7, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfc, 0xfd, 0xd7, 0xfc, 0xd7, 0xfc, 0xd7, 0xfc, 0xd7, 0xfc, 0xd7, 0xfc, 0xd7, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0x8b, 0xfd, 0xfd, 0xfc, 0xf7, 0xd6, 0xf1, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xec, 0xeb, 0xeb, 0xea, 0xeb, 0xea, 0xeb, 0xea, 0xe7, 0xe7, 0xeb, 0xef, 0xf2, 0xf6, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd, 0xfc, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xfb, 0xfc, 0xfa, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf7, 0xf7, 0xf7, 0xfc, 0xfd, 0xfc, 0xfc, 0xf7, 0xf4, 0xf3, 0xf2, 0xf2, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xeb, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xf9, 0xfa, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xf7, 0xf7, 0xf3, 0xf2, 0xf1, 0xef, 0xef, 0xed, 0xeb, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xf4, 0xf7, 0xfc, 0xfc, 0xfd, 0xfd, 0xfc, 0xfc, 0xfb, 0xfc, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xf7, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd, 0xfc, 0xfc, 0xfa, 0xfc, 0xf7, 0xf5, 0xf3, 0xf5, 0xfa, 0xf7, 0xfa, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xd7, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0xf6, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf9, 0xf5, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf7, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xfa, 0xfa, 0xfb, 0xf7, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf7, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xf7, 0xf7, 0xfc, 0xfc, 0xfd, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xf7, 0xfc, 0xf7, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfa, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xf7, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfa, 0xf5, 0xf5, 0xf4, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf4, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xf7, 0xfb, 0xf7, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfa, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf5, 0xf9, 0xf7, 0xf5, 0xf5, 0xf7, 0xfa, 0xf5, 0xf5, 0xf7, 0xfa, 0xf7, 0xf7, 0xfb, 0xf7, 0xfa, 0xf7, 0xfa, 0xfa, 0xf9, 0xf7, 0xfb, 0xfc, 0xfa, 0xf9, 0xf7, 0xfb, 0xf7, 0xfb, 0xf7, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0x99, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfc, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xfb, 0xf7, 0xfc, 0xf7, 0xfc, 0xf7, 0xfc, 0xf7, 0xfc, 0xf7, 0xfc, 0xf7, 0xfc, 0xfb, 0xfc, 0x99, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xf7, 0xfb, 0xf7, 0xfb, 0xf7, 0xfb, 0xf7, 0xfa, 0xfa, 0xfb, 0xfb, 0xf9, 0xfb, 0xfa, 0xfb, 0xfc, 0xfb, 0xfa, 0xfa, 0xf5, 0xf4, 0xf5, 0xf6, 0xfa, 0xfa, 0xf5, 0xf9, 0xf4, 0xf9, 0xf3, 0xf3, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf5, 0xf9, 0xfa, 0xfa, 0xfb, 0xfa, 0xfc, 0xfb, 0xf7, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xf7, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf3, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xd6, 0xf9, 0xf4, 0xf9, 0xf5, 0xf9, 0xf5, 0xf4, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf9, 0xf5, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf5, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xd6, 0xf9, 0xf5, 0xf5, 0xf9, 0xd6, 0xf9, 0xd6, 0xf9, 0xd6, 0xf9, 0xd6, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf9, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf6, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf9, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf6, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf6, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xd6, 0xf5, 0xf4, 0xf6, 0xd6, 0xf5, 0xd6, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf5, 0xf6, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xd6, 0xf5, 0xf4, 0xf6, 0xd6, 0xf5, 0xf4, 0xf6, 0xd6, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf6, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf7, 0xf5, 0xf7, 0xf5, 0xf7, 0xf5, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf4, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf5, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf7, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf5, 0xf4, 0xf6, 0xf5, 0xf4, 0xf6, 0xf5, 0xf4, 0xf6, 0xf5, 0xf4, 0xf6, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xfa, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xfa, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 
-};
-
-const lv_img_dsc_t image21 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image21_map,
-};
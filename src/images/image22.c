@@ -1,500 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE22
-#define LV_ATTRIBUTE_IMG_IMAGE22
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE22 uint8_t image22_map[] = {
-  0xfe, 0xfe, 0xfe, 0xff, 	/*Color of index 0*/
-  0xf8, 0xf8, 0xf8, 0xff, 	/*Color of index 1*/
-  0xf4, 0xf4, 0xf4, 0xff, 	/*Color of index 2*/
-  0xf0, 0xf0, 0xf0, 0xff, 	/*Color of index 3*/
-  0xed, 0xed, 0xed, 0xff, 	/*Color of index 4*/
-  0xea, 0xea, 0xea, 0xff, 	/*Color of index 5*/
-  0xe7, 0xe7, 0xe7, 0xff, 	/*Color of index 6*/
-  0xe2, 0xe2, 0xe2, 0xff, 	/*Color of index 7*/
-  0xe0, 0xe0, 0xe0, 0xff, 	/*Color of index 8*/
-  0xd5, 0xd5, 0xd5, 0xff, 	/*Color of index 9*/
-  0xd2, 0xd2, 0xd2, 0xff, 	/*Color of index 10*/
-  0xcb, 0xcb, 0xcb, 0xff, 	/*Color of index 11*/
-  0xc7, 0xc7, 0xc7, 0xff, 	/*Color of index 12*/
-  0xc3, 0xc3, 0xc3, 0xff, 	/*Color of index 13*/
-  0xbe, 0xbe, 0xbe, 0xff, 	/*Color of index 14*/
-  0xbb, 0xbb, 0xbb, 0xff, 	/*Color of index 15*/
-  0xb8, 0xb8, 0xb8, 0xff, 	/*Color of index 16*/
-  0xb6, 0xb6, 0xb6, 0xff, 	/*Color of index 17*/
-  0xb2, 0xb2, 0xb2, 0xff, 	/*Color of index 18*/
-  0xae, 0xae, 0xae, 0xff, 	/*Color of index 19*/
-  0xaa, 0xaa, 0xaa, 0xff, 	/*Color of index 20*/
-  0xa5, 0xa5, 0xa5, 0xff, 	/*Color of index 21*/
-  0xa1, 0xa1, 0xa1, 0xff, 	/*Color of index 22*/
-  0x92, 0x92, 0x92, 0xff, 	/*Color of index 23*/
-  0x8b, 0x8b, 0x8b, 0xff, 	/*Color of index 24*/
-  0x87, 0x87, 0x87, 0xff, 	/*Color of index 25*/
-  0x82, 0x82, 0x82, 0xff, 	/*Color of index 26*/
-  0x7a, 0x7a, 0x7a, 0xff, 	/*Color of index 27*/
-  0x72, 0x72, 0x72, 0xff, 	/*Color of index 28*/
-  0x6c, 0x6c, 0x6c, 0xff, 	/*Color of index 29*/
-  0x68, 0x68, 0x68, 0xff, 	/*Color of index 30*/
-  0x65, 0x65, 0x65, 0xff, 	/*Color of index 31*/
-  0x61, 0x61, 0x61, 0xff, 	/*Color of index 32*/
-  0x5a, 0x5a, 0x5a, 0xff, 	/*Color of index 33*/
-  0x56, 0x56, 0x56, 0xff, 	/*Color of index 34*/
-  0x52, 0x52, 0x52, 0xff, 	/*Color of index 35*/
-  0x4a, 0x4a, 0x4a, 0xff, 	/*Color of index 36*/
-  0x43, 0x43, 0x43, 0xff, 	/*Color of index 37*/
-  0x3e, 0x3e, 0x3e, 0xff, 	/*Color of index 38*/
-  0x39, 0x39, 0x39, 0xff, 	/*Color of index 39*/
-  0x35, 0x35, 0x35, 0xff, 	/*Color of index 40*/
-  0x32, 0x32, 0x32, 0xff, 	/*Color of index 41*/
-  0x2b, 0x2b, 0x2b, 0xff, 	/*Color of index 42*/
-  0x26, 0x26, 0x26, 0xff, 	/*Color of index 43*/
-  0x22, 0x22, 0x22, 0xff, 	/*Color of index 44*/
-  0x1e, 0x1e, 0x1e, 0xff, 	/*Color of index 45*/
-  0x1a, 0x1a, 0x1a, 0xff, 	/*Color of index 46*/
-  0x17, 0x17, 0x17, 0xff, 	/*Color of index 47*/
-  0x13, 0x13, 0x13, 0xff, 	/*Color of index 48*/
-  0x0e, 0x0e, 0x0e, 0xff, 	/*Color of index 49*/
-  0x0a, 0x0a, 0x0a, 0xff, 	/*Color of index 50*/
-  0x07, 0x07, 0x07, 0xff, 	/*Color of index 51*/
-  0x01, 0x01, 0x01, 0xff, 	/*Color of index 52*/
-  0xfa, 0xfa, 0xfb, 0xff, 	/*Color of index 53*/
-  0xf2, 0xf4, 0xfe, 0xff, 	/*Color of index 54*/
-  0xef, 0xf2, 0xfe, 0xff, 	/*Color of index 55*/
-  0xea, 0xed, 0xfe, 0xff, 	/*Color of index 56*/
-  0xe5, 0xe8, 0xfe, 0xff, 	/*Color of index 57*/
-  0xe3, 0xe3, 0xfe, 0xff, 	/*Color of index 58*/
-  0xe2, 0xe5, 0xf3, 0xff, 	/*Color of index 59*/
-  0xd7, 0xe0, 0xfc, 0xff, 	/*Color of index 60*/
-  0xe5, 0xe5, 0xe6, 0xff, 	/*Color of index 61*/
-  0xe1, 0xdd, 0xfd, 0xff, 	/*Color of index 62*/
-  0xdb, 0xdc, 0xff, 0xff, 	/*Color of index 63*/
-  0xdd, 0xdf, 0xe8, 0xff, 	/*Color of index 64*/
-  0xde, 0xdb, 0xe5, 0xff, 	/*Color of index 65*/
-  0xdd, 0xdd, 0xde, 0xff, 	/*Color of index 66*/
-  0xd0, 0xd2, 0xfd, 0xff, 	/*Color of index 67*/
-  0xda, 0xd5, 0xec, 0xff, 	/*Color of index 68*/
-  0xd4, 0xd6, 0xe4, 0xff, 	/*Color of index 69*/
-  0xcd, 0xcb, 0xf2, 0xff, 	/*Color of index 70*/
-  0xca, 0xc8, 0xfd, 0xff, 	/*Color of index 71*/
-  0xca, 0xce, 0xe4, 0xff, 	/*Color of index 72*/
-  0xcf, 0xcd, 0xda, 0xff, 	/*Color of index 73*/
-  0xc1, 0xc3, 0xf8, 0xff, 	/*Color of index 74*/
-  0xc2, 0xc4, 0xea, 0xff, 	/*Color of index 75*/
-  0xbe, 0xbb, 0xfb, 0xff, 	/*Color of index 76*/
-  0xc0, 0xc5, 0xd6, 0xff, 	/*Color of index 77*/
-  0xc3, 0xc4, 0xca, 0xff, 	/*Color of index 78*/
-  0xbb, 0xbb, 0xe7, 0xff, 	/*Color of index 79*/
-  0xb3, 0xb2, 0xf0, 0xff, 	/*Color of index 80*/
-  0xbb, 0xbc, 0xc3, 0xff, 	/*Color of index 81*/
-  0xb6, 0xb7, 0xd5, 0xff, 	/*Color of index 82*/
-  0xb4, 0xb3, 0xde, 0xff, 	/*Color of index 83*/
-  0xa9, 0xac, 0xe0, 0xff, 	/*Color of index 84*/
-  0xb2, 0xb2, 0xc0, 0xff, 	/*Color of index 85*/
-  0xa7, 0xa2, 0xdf, 0xff, 	/*Color of index 86*/
-  0x9d, 0xa3, 0xd3, 0xff, 	/*Color of index 87*/
-  0xa5, 0xa7, 0xbd, 0xff, 	/*Color of index 88*/
-  0xa0, 0x9b, 0xe6, 0xff, 	/*Color of index 89*/
-  0x94, 0x92, 0xf9, 0xff, 	/*Color of index 90*/
-  0xa8, 0xa6, 0xad, 0xff, 	/*Color of index 91*/
-  0x9a, 0x9a, 0xda, 0xff, 	/*Color of index 92*/
-  0xa7, 0xa7, 0xa8, 0xff, 	/*Color of index 93*/
-  0x99, 0x94, 0xea, 0xff, 	/*Color of index 94*/
-  0x94, 0x97, 0xd8, 0xff, 	/*Color of index 95*/
-  0x99, 0x9f, 0xb4, 0xff, 	/*Color of index 96*/
-  0x87, 0x89, 0xfe, 0xff, 	/*Color of index 97*/
-  0x7f, 0x8d, 0xf0, 0xff, 	/*Color of index 98*/
-  0x8c, 0x94, 0xcd, 0xff, 	/*Color of index 99*/
-  0x89, 0x89, 0xf3, 0xff, 	/*Color of index 100*/
-  0x91, 0x8e, 0xdf, 0xff, 	/*Color of index 101*/
-  0x8d, 0x90, 0xd3, 0xff, 	/*Color of index 102*/
-  0x9c, 0x9b, 0xa5, 0xff, 	/*Color of index 103*/
-  0x8c, 0x83, 0xfb, 0xff, 	/*Color of index 104*/
-  0x81, 0x83, 0xfe, 0xff, 	/*Color of index 105*/
-  0x91, 0x8d, 0xd5, 0xff, 	/*Color of index 106*/
-  0x88, 0x8a, 0xe1, 0xff, 	/*Color of index 107*/
-  0x82, 0x85, 0xf0, 0xff, 	/*Color of index 108*/
-  0x7d, 0x82, 0xf5, 0xff, 	/*Color of index 109*/
-  0x94, 0x96, 0xa8, 0xff, 	/*Color of index 110*/
-  0x89, 0x84, 0xe8, 0xff, 	/*Color of index 111*/
-  0x7c, 0x7f, 0xfd, 0xff, 	/*Color of index 112*/
-  0x88, 0x84, 0xe4, 0xff, 	/*Color of index 113*/
-  0x8c, 0x8b, 0xc7, 0xff, 	/*Color of index 114*/
-  0x80, 0x81, 0xec, 0xff, 	/*Color of index 115*/
-  0x7b, 0x7c, 0xfd, 0xff, 	/*Color of index 116*/
-  0x81, 0x7b, 0xfe, 0xff, 	/*Color of index 117*/
-  0x82, 0x7e, 0xf3, 0xff, 	/*Color of index 118*/
-  0x85, 0x84, 0xdd, 0xff, 	/*Color of index 119*/
-  0x8a, 0x85, 0xd6, 0xff, 	/*Color of index 120*/
-  0x7c, 0x88, 0xd0, 0xff, 	/*Color of index 121*/
-  0x74, 0x7c, 0xfa, 0xff, 	/*Color of index 122*/
-  0x91, 0x93, 0xa2, 0xff, 	/*Color of index 123*/
-  0x7d, 0x80, 0xe2, 0xff, 	/*Color of index 124*/
-  0x7a, 0x7a, 0xf3, 0xff, 	/*Color of index 125*/
-  0x86, 0x82, 0xd0, 0xff, 	/*Color of index 126*/
-  0x79, 0x75, 0xfd, 0xff, 	/*Color of index 127*/
-  0x7e, 0x7c, 0xd4, 0xff, 	/*Color of index 128*/
-  0x76, 0x75, 0xea, 0xff, 	/*Color of index 129*/
-  0x85, 0x8a, 0x97, 0xff, 	/*Color of index 130*/
-  0x77, 0x6c, 0xfe, 0xff, 	/*Color of index 131*/
-  0x73, 0x79, 0xcc, 0xff, 	/*Color of index 132*/
-  0x7e, 0x79, 0xc7, 0xff, 	/*Color of index 133*/
-  0x79, 0x74, 0xd8, 0xff, 	/*Color of index 134*/
-  0x71, 0x70, 0xe6, 0xff, 	/*Color of index 135*/
-  0x71, 0x6c, 0xee, 0xff, 	/*Color of index 136*/
-  0x7e, 0x7a, 0xb4, 0xff, 	/*Color of index 137*/
-  0x83, 0x7c, 0xa8, 0xff, 	/*Color of index 138*/
-  0x81, 0x82, 0x90, 0xff, 	/*Color of index 139*/
-  0x70, 0x6c, 0xdd, 0xff, 	/*Color of index 140*/
-  0x64, 0x68, 0xe9, 0xff, 	/*Color of index 141*/
-  0x7b, 0x79, 0xa3, 0xff, 	/*Color of index 142*/
-  0x72, 0x6f, 0xc5, 0xff, 	/*Color of index 143*/
-  0x71, 0x6c, 0xcf, 0xff, 	/*Color of index 144*/
-  0x73, 0x6f, 0xbb, 0xff, 	/*Color of index 145*/
-  0x6b, 0x64, 0xde, 0xff, 	/*Color of index 146*/
-  0x7e, 0x76, 0x95, 0xff, 	/*Color of index 147*/
-  0x79, 0x7a, 0x85, 0xff, 	/*Color of index 148*/
-  0x72, 0x73, 0x99, 0xff, 	/*Color of index 149*/
-  0x69, 0x64, 0xce, 0xff, 	/*Color of index 150*/
-  0x71, 0x6c, 0xb0, 0xff, 	/*Color of index 151*/
-  0x63, 0x5e, 0xcd, 0xff, 	/*Color of index 152*/
-  0x6d, 0x73, 0x82, 0xff, 	/*Color of index 153*/
-  0x5c, 0x5b, 0xd5, 0xff, 	/*Color of index 154*/
-  0x61, 0x5f, 0xc1, 0xff, 	/*Color of index 155*/
-  0x65, 0x64, 0xa0, 0xff, 	/*Color of index 156*/
-  0x61, 0x5d, 0xb6, 0xff, 	/*Color of index 157*/
-  0x5b, 0x52, 0xd8, 0xff, 	/*Color of index 158*/
-  0x5c, 0x56, 0xc8, 0xff, 	/*Color of index 159*/
-  0x58, 0x58, 0xbd, 0xff, 	/*Color of index 160*/
-  0x5d, 0x5c, 0xac, 0xff, 	/*Color of index 161*/
-  0x65, 0x6a, 0x7a, 0xff, 	/*Color of index 162*/
-  0x5e, 0x63, 0x77, 0xff, 	/*Color of index 163*/
-  0x5c, 0x5c, 0x8b, 0xff, 	/*Color of index 164*/
-  0x4e, 0x52, 0x66, 0xff, 	/*Color of index 165*/
-  0x39, 0x41, 0x56, 0xff, 	/*Color of index 166*/
-  0x2f, 0x35, 0x48, 0xff, 	/*Color of index 167*/
-  0x33, 0x34, 0x3d, 0xff, 	/*Color of index 168*/
-  0x2c, 0x2e, 0x3e, 0xff, 	/*Color of index 169*/
-  0x22, 0x29, 0x3e, 0xff, 	/*Color of index 170*/
-  0x27, 0x2a, 0x32, 0xff, 	/*Color of index 171*/
-  0x20, 0x24, 0x34, 0xff, 	/*Color of index 172*/
-  0x1b, 0x1f, 0x34, 0xff, 	/*Color of index 173*/
-  0x22, 0x20, 0x27, 0xff, 	/*Color of index 174*/
-  0x1d, 0x1c, 0x23, 0xff, 	/*Color of index 175*/
-  0x10, 0x15, 0x2d, 0xff, 	/*Color of index 176*/
-  0x13, 0x11, 0x1a, 0xff, 	/*Color of index 177*/
-  0x06, 0x0c, 0x1c, 0xff, 	/*Color of index 178*/
-  0x07, 0x06, 0x10, 0xff, 	/*Color of index 179*/
-  0x00, 0x01, 0x13, 0xff, 	/*Color of index 180*/
-  0x00, 0x00, 0x0a, 0xff, 	/*Color of index 181*/
-  0xf0, 0xf9, 0xfd, 0xff, 	/*Color of index 182*/
-  0xe4, 0xeb, 0xf1, 0xff, 	/*Color of index 183*/
-  0xa8, 0xaf, 0xb8, 0xff, 	/*Color of index 184*/
-  0x9d, 0xa3, 0xa6, 0xff, 	/*Color of index 185*/
-  0x96, 0x9b, 0x9d, 0xff, 	/*Color of index 186*/
-  0x5a, 0x61, 0x67, 0xff, 	/*Color of index 187*/
-  0x4a, 0x52, 0x55, 0xff, 	/*Color of index 188*/
-  0x3f, 0x46, 0x53, 0xff, 	/*Color of index 189*/
-  0x3a, 0x40, 0x47, 0xff, 	/*Color of index 190*/
-  0x32, 0x39, 0x49, 0xff, 	/*Color of index 191*/
-  0x13, 0x1b, 0x24, 0xff, 	/*Color of index 192*/
-  0x01, 0x08, 0x11, 0xff, 	/*Color of index 193*/
-  0xe6, 0xea, 0xea, 0xff, 	/*Color of index 194*/
-  0xf0, 0xf9, 0xf0, 0xff, 	/*Color of index 195*/
-  0xde, 0xdf, 0xde, 0xff, 	/*Color of index 196*/
-  0xd7, 0xd8, 0xd7, 0xff, 	/*Color of index 197*/
-  0x96, 0x97, 0x96, 0xff, 	/*Color of index 198*/
-  0x46, 0x47, 0x46, 0xff, 	/*Color of index 199*/
-  0x1f, 0x20, 0x1f, 0xff, 	/*Color of index 200*/
-  0xf0, 0xfc, 0xea, 0xff, 	/*Color of index 201*/
-  0xed, 0xf1, 0xeb, 0xff, 	/*Color of index 202*/
-  0xea, 0xf4, 0xe1, 0xff, 	/*Color of index 203*/
-  0xdb, 0xe3, 0xd5, 0xff, 	/*Color of index 204*/
-  0xcc, 0xd4, 0xc3, 0xff, 	/*Color of index 205*/
-  0xcd, 0xcf, 0xc9, 0xff, 	/*Color of index 206*/
-  0xbc, 0xc0, 0xba, 0xff, 	/*Color of index 207*/
-  0xb5, 0xb7, 0xb1, 0xff, 	/*Color of index 208*/
-  0x83, 0x87, 0x81, 0xff, 	/*Color of index 209*/
-  0x5b, 0x5f, 0x57, 0xff, 	/*Color of index 210*/
-  0x35, 0x3a, 0x32, 0xff, 	/*Color of index 211*/
-  0x2e, 0x31, 0x2c, 0xff, 	/*Color of index 212*/
-  0x27, 0x2b, 0x24, 0xff, 	/*Color of index 213*/
-  0xfb, 0xfd, 0xf6, 0xff, 	/*Color of index 214*/
-  0xfc, 0xfe, 0xee, 0xff, 	/*Color of index 215*/
-  0xf6, 0xf5, 0xea, 0xff, 	/*Color of index 216*/
-  0xf2, 0xf2, 0xee, 0xff, 	/*Color of index 217*/
-  0xef, 0xee, 0xe1, 0xff, 	/*Color of index 218*/
-  0xeb, 0xea, 0xdb, 0xff, 	/*Color of index 219*/
-  0xe5, 0xe5, 0xe4, 0xff, 	/*Color of index 220*/
-  0xe2, 0xe1, 0xdc, 0xff, 	/*Color of index 221*/
-  0xdf, 0xe0, 0xd0, 0xff, 	/*Color of index 222*/
-  0xd7, 0xd7, 0xd6, 0xff, 	/*Color of index 223*/
-  0xd5, 0xda, 0xc8, 0xff, 	/*Color of index 224*/
-  0xcf, 0xcf, 0xce, 0xff, 	/*Color of index 225*/
-  0xcb, 0xcc, 0xc1, 0xff, 	/*Color of index 226*/
-  0xc5, 0xc6, 0xb2, 0xff, 	/*Color of index 227*/
-  0x5f, 0x5f, 0x5e, 0xff, 	/*Color of index 228*/
-  0x50, 0x50, 0x4f, 0xff, 	/*Color of index 229*/
-  0x6f, 0x6a, 0x67, 0xff, 	/*Color of index 230*/
-  0xf7, 0xf6, 0xf6, 0xff, 	/*Color of index 231*/
-  0x9c, 0x9b, 0x9b, 0xff, 	/*Color of index 232*/
-  0x48, 0x42, 0x42, 0xff, 	/*Color of index 233*/
-  0xdb, 0xda, 0xdb, 0xff, 	/*Color of index 234*/
-  0xda, 0xd4, 0xda, 0xff, 	/*Color of index 235*/
-  0x5e, 0x5d, 0x5e, 0xff, 	/*Color of index 236*/
-  0x2f, 0x2e, 0x2f, 0xff, 	/*Color of index 237*/
-  0xf9, 0xf6, 0xfd, 0xff, 	/*Color of index 238*/
-  0xf5, 0xee, 0xff, 0xff, 	/*Color of index 239*/
-  0xf2, 0xec, 0xfb, 0xff, 	/*Color of index 240*/
-  0xf1, 0xed, 0xf2, 0xff, 	/*Color of index 241*/
-  0xee, 0xe9, 0xf2, 0xff, 	/*Color of index 242*/
-  0xeb, 0xe4, 0xf9, 0xff, 	/*Color of index 243*/
-  0xe9, 0xe6, 0xed, 0xff, 	/*Color of index 244*/
-  0xe8, 0xdf, 0xf1, 0xff, 	/*Color of index 245*/
-  0xd8, 0xd2, 0xe2, 0xff, 	/*Color of index 246*/
-  0xce, 0xcc, 0xd0, 0xff, 	/*Color of index 247*/
-  0xcc, 0xc6, 0xce, 0xff, 	/*Color of index 248*/
-  0x68, 0x5f, 0x6e, 0xff, 	/*Color of index 249*/
-  0x55, 0x53, 0x59, 0xff, 	/*Color of index 250*/
-  0x4f, 0x4e, 0x50, 0xff, 	/*Color of index 251*/
-  0x4c, 0x45, 0x51, 0xff, 	/*Color of index 252*/
-  0x40, 0x3b, 0x45, 0xff, 	/*Color of index 253*/
-  0x2b, 0x24, 0x2e, 0xff, 	/*Color of index 254*/
-  0x10, 0x0d, 0x12, 0xff, 	/*Color of index 255*/
-
-  0xd6, 0xc3, 0x00, 0x00, 0xee, 0x36, 0x00, 0x35, 0x00, 0xee, 0x01, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0x00, 0x35, 0x00, 0xee, 0xee, 0xf2, 0xee, 0xdc, 0xd9, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd6, 0xc3, 0xca, 0x03, 0xb6, 0x35, 0x00, 0x35, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0xd6, 0xee, 0xf1, 0xf4, 0x41, 0xf2, 0x06, 0x07, 0xcc, 0xc3, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xc2, 0xcc, 0x3d, 0xc2, 0xf4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x35, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf1, 0x3d, 0xf5, 0xf2, 0xf4, 0x00, 0xe7, 0xd7, 0xdb, 0xcc, 0xd6, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xc2, 0x04, 0xc3, 0xb6, 0x06, 0x42, 0xc4, 0x42, 0x01, 0x00, 0xd6, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x35, 0x00, 0x35, 0xca, 0x06, 0x05, 0xf1, 0xf1, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xc9, 0xcd, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd9, 0xca, 0x35, 0x00, 0x00, 0x02, 0xdc, 0xe1, 0xce, 0xdc, 0xd6, 0x00, 0xd6, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x02, 0x06, 0xdc, 0xda, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe7, 0xd6, 0xd6, 0xe0, 0x02, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x42, 0x3d, 0xe7, 0x00, 0x00, 0xd6, 0x00, 0xc3, 0xde, 0x0a, 0xde, 0xd9, 0x00, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xee, 0xf3, 0xf5, 0x05, 0xc3, 0xd6, 0xd6, 0xd7, 0xd6, 0xca, 0x00, 0xb6, 0x00, 0xf4, 0x03, 0xea, 0x04, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x07, 0x03, 0x00, 0x00, 0xc3, 0xc3, 0xd6, 0xd6, 0x00, 0xdd, 0x0b, 0xce, 0xdb, 0xd6, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xf0, 0xf5, 0xf5, 0xf2, 0x35, 0x00, 0xd7, 0xd7, 0xcb, 0xd7, 0xc3, 0x00, 0x36, 0x3b, 0x39, 0x38, 0x44, 0x07, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf4, 0xf1, 0x35, 0x00, 0xd6, 0x00, 0xd6, 0xd6, 0x00, 0x00, 0xc2, 0x0a, 0x0a, 0xdb, 0xd7, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0xf5, 0xef, 0x00, 0x00, 0xd6, 0xc9, 0xd6, 0xd6, 0xb6, 0x00, 0x36, 0x48, 0x58, 0x3e, 0x36, 0x44, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf4, 0x05, 0x00, 0xd6, 0xc3, 0xc3, 0x02, 0x00, 0x37, 0x35, 0x36, 0x05, 0xea, 0xce, 0xde, 0xd6, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x03, 0x3d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x35, 0xb6, 0xb6, 0xb6, 0xb6, 0x43, 0x57, 0x95, 0x8e, 0x3a, 0x36, 0x44, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf4, 0x04, 0x00, 0x00, 0xd6, 0x02, 0x40, 0x45, 0x35, 0x37, 0x35, 0x35, 0x40, 0xdf, 0xe0, 0xe0, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x01, 0x04, 0x05, 0xe7, 0xd6, 0xd6, 0xd6, 0x02, 0xb6, 0xb6, 0x38, 0x4a, 0x66, 0x85, 0x89, 0x97, 0x8e, 0x3e, 0xee, 0x41, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x60, 0x4b, 0xef, 0x36, 0xef, 0x35, 0x04, 0xcd, 0xcd, 0x07, 0x01, 0x00, 0x01, 0xe7, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0xd9, 0x04, 0x04, 0x02, 0xd6, 0xd7, 0xc9, 0xd6, 0xb6, 0x37, 0x47, 0x5e, 0x86, 0x98, 0x9f, 0x90, 0x7e, 0x72, 0x3e, 0xb6, 0x08, 0xea, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0x05, 0x00, 0x00, 0x00, 0xb6, 0x4d, 0x8e, 0x8e, 0x4c, 0x3a, 0x39, 0x35, 0xb6, 0xcc, 0xe0, 0x0a, 0x05, 0x00, 0x35, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x02, 0x35, 0x00, 0xc9, 0xc9, 0x00, 0x37, 0x50, 0x84, 0x9f, 0x9e, 0x83, 0x88, 0x68, 0x5e, 0x72, 0xf3, 0xb6, 0xcc, 0xea, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd9, 0x06, 0xd6, 0x00, 0xb6, 0xb6, 0x4b, 0x89, 0x91, 0x91, 0x4c, 0xef, 0x39, 0x36, 0xd6, 0xe0, 0xce, 0xc5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0xd9, 0x35, 0x00, 0x00, 0xb6, 0x00, 0x3c, 0x63, 0x9d, 0x98, 0x88, 0x83, 0x75, 0x7f, 0x68, 0x71, 0x72, 0x39, 0xd6, 0xe0, 0xdd, 0x35, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xc3, 0xdc, 0xd6, 0x00, 0x36, 0xb6, 0x43, 0x72, 0x78, 0xa1, 0x80, 0x43, 0x38, 0x37, 0xd6, 0xcb, 0x09, 0xe1, 0xea, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x35, 0x00, 0x00, 0xb6, 0xb6, 0x43, 0x63, 0x9c, 0xa0, 0x87, 0x75, 0x74, 0x7f, 0x75, 0x68, 0x7c, 0x5c, 0x36, 0x36, 0xce, 0x06, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd6, 0xdc, 0xd6, 0x00, 0x36, 0x36, 0x43, 0x65, 0x77, 0x86, 0x9d, 0x78, 0x3f, 0xb6, 0xc3, 0xd7, 0xdc, 0x0a, 0xe1, 0x03, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x06, 0x05, 0x00, 0x00, 0x35, 0x36, 0x3f, 0x65, 0x9d, 0x90, 0x6d, 0x81, 0x7f, 0x70, 0x74, 0x61, 0x73, 0x6b, 0x50, 0x36, 0x3b, 0xf7, 0x04, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd6, 0xdb, 0x01, 0x00, 0x36, 0xb6, 0x43, 0x6a, 0x71, 0x64, 0x96, 0x9d, 0x56, 0x37, 0x00, 0xd7, 0xca, 0x09, 0xf7, 0x07, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x06, 0xca, 0xd6, 0x00, 0x36, 0x36, 0x5e, 0x8c, 0x9f, 0x87, 0x61, 0x69, 0x70, 0x69, 0x70, 0x61, 0x7c, 0x65, 0x4a, 0xee, 0x41, 0xe1, 0x02, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd7, 0xda, 0xca, 0x35, 0x35, 0xef, 0x37, 0x63, 0x6b, 0x6c, 0x69, 0x98, 0x90, 0x47, 0x35, 0x00, 0xd9, 0x3d, 0xdf, 0x4e, 0x02, 0x00, 0x00, 0x01, 0x35, 0x35, 0x00, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x35, 0x00, 0x35, 0x00, 0x00, 0xd8, 0xde, 0xd7, 0xc3, 0xb6, 0xee, 0x4a, 0x96, 0x92, 0x81, 0x7d, 0x6d, 0x7a, 0x7a, 0x70, 0x74, 0x61, 0x6f, 0x59, 0x3a, 0x35, 0xde, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd7, 0xd8, 0xdc, 0x35, 0xee, 0xee, 0x36, 0x57, 0x79, 0x62, 0x7a, 0x8d, 0x96, 0x59, 0xf3, 0x35, 0xe7, 0x07, 0xe1, 0x0a, 0xf1, 0x02, 0xee, 0x00, 0x00, 0x35, 0x02, 0x05, 0x00, 0xd9, 0x02, 0x0f, 0x0e, 0xf7, 0xce, 0xcf, 0xdc, 0x04, 0x40, 0xf1, 0x02, 0xda, 0xdb, 0xd7, 0xd6, 0x00, 0x3c, 0x66, 0x9f, 0x92, 0x7f, 0x69, 0x69, 0x69, 0x69, 0x69, 0x61, 0x6c, 0x77, 0x50, 0x37, 0xf1, 0xe0, 0xde, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd7, 0xd7, 0xdd, 0x00, 0xee, 0x35, 0x36, 0x4b, 0x79, 0x62, 0x7a, 0x74, 0x96, 0x91, 0x46, 0xee, 0xee, 0x03, 0x0a, 0x0c, 0x07, 0x00, 0x00, 0x02, 0x02, 0x07, 0x08, 0xea, 0x02, 0xd6, 0x00, 0x22, 0xab, 0x29, 0xd4, 0xd3, 0xc6, 0x42, 0xf7, 0xf8, 0xeb, 0xe0, 0xda, 0xd6, 0x35, 0xb6, 0x4f, 0x91, 0x98, 0x88, 0x70, 0x69, 0x70, 0x70, 0x69, 0x6d, 0x64, 0x77, 0x5c, 0x3f, 0x35, 0x42, 0xe2, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd6, 0x00, 0xdd, 0xe7, 0x35, 0x00, 0x36, 0x3c, 0x5f, 0x77, 0x6d, 0x61, 0x8c, 0xa0, 0x56, 0xee, 0xee, 0x00, 0xc5, 0xe1, 0x0a, 0x01, 0x04, 0xc4, 0x04, 0x03, 0x00, 0x35, 0x05, 0x0b, 0xd9, 0x0e, 0xfe, 0xed, 0x2e, 0xd4, 0xe6, 0xd6, 0xf4, 0xeb, 0xe1, 0x0b, 0xda, 0xd6, 0x36, 0x36, 0x5c, 0x9b, 0x86, 0x7d, 0x69, 0x75, 0x7f, 0x70, 0x70, 0x73, 0x80, 0x5f, 0x4a, 0xb6, 0x35, 0x49, 0xce, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xd6, 0x04, 0x05, 0x00, 0x01, 0x00, 0x36, 0x54, 0x84, 0x62, 0x61, 0x81, 0x96, 0x85, 0x3e, 0x35, 0x05, 0x0b, 0xea, 0x0c, 0xe8, 0x23, 0x25, 0x15, 0x07, 0x00, 0x01, 0x00, 0x00, 0x08, 0x41, 0xfd, 0xa8, 0x26, 0xd3, 0xd5, 0x0d, 0x03, 0x0a, 0xea, 0xe1, 0xca, 0x00, 0x36, 0x3f, 0x8f, 0x9b, 0x81, 0x74, 0x69, 0x75, 0x75, 0x68, 0x64, 0x6b, 0x66, 0x4b, 0x36, 0xb6, 0x07, 0xe1, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xb6, 0x35, 0x07, 0xd6, 0xe7, 0x00, 0xb6, 0x46, 0x79, 0x62, 0x6c, 0x76, 0x87, 0x9b, 0x4c, 0xee, 0x00, 0x06, 0xd0, 0x1d, 0x29, 0x2e, 0xed, 0x2e, 0x20, 0x09, 0x00, 0xee, 0x00, 0xf4, 0x0b, 0xfc, 0xae, 0xe9, 0xd5, 0xc8, 0xd1, 0x00, 0x41, 0xdf, 0xf7, 0x02, 0x00, 0x36, 0x4c, 0x9b, 0x92, 0x6d, 0x70, 0x69, 0x69, 0x75, 0x76, 0x6f, 0x6a, 0x4f, 0x38, 0x00, 0xc2, 0xce, 0x09, 0x37, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xb6, 0x00, 0x35, 0x05, 0xda, 0xd7, 0x00, 0x00, 0x38, 0x57, 0x6b, 0x7c, 0x61, 0x7d, 0x9f, 0x65, 0xee, 0x07, 0x1a, 0x2b, 0x2e, 0xd3, 0x25, 0x29, 0xc7, 0x33, 0xc7, 0x4e, 0x00, 0x02, 0x00, 0xf2, 0xf9, 0xfe, 0x28, 0xd5, 0xd5, 0x22, 0x04, 0xea, 0x0b, 0xe1, 0xb6, 0x36, 0x37, 0x59, 0x9f, 0x88, 0x70, 0x70, 0x69, 0x68, 0x73, 0x7c, 0x65, 0x54, 0x3a, 0x35, 0xd6, 0xc5, 0xce, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xb6, 0x00, 0xb6, 0xd9, 0xde, 0xd6, 0xd6, 0x35, 0xb6, 0x4a, 0x66, 0x77, 0x5a, 0x7d, 0x9a, 0x86, 0x46, 0x05, 0x09, 0x1b, 0x25, 0x2c, 0x2a, 0x29, 0xd4, 0x24, 0x2c, 0x24, 0xf1, 0xee, 0x00, 0xef, 0xf9, 0xa8, 0xed, 0xc7, 0xd5, 0xd3, 0x0c, 0xf1, 0xf7, 0x45, 0x00, 0x39, 0x38, 0x7e, 0x9f, 0x88, 0x70, 0x7a, 0x76, 0x6c, 0x77, 0x6a, 0x4f, 0x3a, 0x35, 0xf1, 0xc4, 0xcd, 0xc5, 0x01, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xb6, 0xb6, 0x00, 0xd6, 0xda, 0xdb, 0xd8, 0x00, 0x35, 0x3a, 0x54, 0x79, 0x7c, 0x6d, 0x88, 0xa0, 0x46, 0xee, 0x00, 0x00, 0x09, 0xe6, 0x29, 0xd4, 0x26, 0xed, 0x27, 0xab, 0x1c, 0x35, 0xf2, 0x00, 0x55, 0xfe, 0x25, 0xd4, 0xd4, 0xd4, 0x14, 0xf0, 0x0a, 0x0a, 0x00, 0xee, 0x43, 0x8f, 0x9f, 0x75, 0x61, 0x87, 0x73, 0x77, 0x72, 0x4b, 0x36, 0xee, 0xee, 0xea, 0x0b, 0x42, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x00, 0x00, 0xd8, 0xda, 0xd9, 0x35, 0x36, 0x36, 0x3f, 0x63, 0x65, 0x64, 0x9a, 0x5a, 0x37, 0xee, 0xf2, 0x00, 0x00, 0x03, 0xc6, 0x2a, 0x2b, 0x24, 0x2c, 0x27, 0xed, 0x5b, 0x00, 0xee, 0xef, 0xfa, 0x2a, 0xd4, 0xd3, 0xd5, 0x1a, 0xf4, 0xf8, 0x41, 0x00, 0xb6, 0x47, 0x91, 0x9a, 0x75, 0x87, 0x5a, 0x5e, 0x66, 0x4f, 0x37, 0x00, 0xe7, 0xea, 0x0a, 0xea, 0xf1, 0x00, 0x00, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x35, 0x00, 0xd6, 0xd6, 0xd8, 0x05, 0x04, 0x35, 0x37, 0x36, 0x4f, 0x63, 0x6b, 0x8c, 0x5a, 0xef, 0x35, 0x00, 0x36, 0x02, 0x00, 0x35, 0x12, 0x26, 0x2c, 0x26, 0x29, 0x29, 0xfa, 0xf4, 0xf1, 0x35, 0x7b, 0x2b, 0xd3, 0x26, 0xc8, 0xbb, 0xea, 0xf7, 0x05, 0xee, 0x36, 0x4f, 0x97, 0x86, 0x68, 0x64, 0x77, 0x5c, 0x3a, 0xb6, 0x03, 0xc4, 0xe1, 0xf7, 0xeb, 0xf2, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0x05, 0x40, 0x00, 0x35, 0x36, 0x38, 0x53, 0x79, 0x6f, 0x8f, 0x53, 0xf3, 0xee, 0x35, 0xee, 0xe7, 0x00, 0xd6, 0xd0, 0x26, 0x29, 0xc8, 0x26, 0xae, 0x16, 0x35, 0x35, 0x0a, 0x27, 0xd3, 0xd4, 0xc8, 0x24, 0x45, 0xf7, 0xf1, 0x02, 0xee, 0x52, 0x9c, 0x86, 0x6f, 0x65, 0x4c, 0x38, 0xee, 0x3b, 0xdd, 0xdc, 0xce, 0xdc, 0x04, 0xee, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0xd6, 0xd6, 0xd6, 0x00, 0xf0, 0xf4, 0x45, 0x00, 0x35, 0x00, 0x39, 0x57, 0x80, 0x85, 0x8a, 0xf6, 0xf3, 0x36, 0x00, 0x35, 0xd9, 0x00, 0xd6, 0xd0, 0xd4, 0x28, 0x27, 0x2d, 0x21, 0xf2, 0xf4, 0x05, 0x26, 0xd5, 0xd5, 0x2f, 0xbe, 0x41, 0xf8, 0xf1, 0x35, 0x00, 0x58, 0xa4, 0x85, 0x59, 0x47, 0xee, 0xb6, 0x49, 0x42, 0xc5, 0xd0, 0xce, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xd6, 0xd6, 0x00, 0x00, 0xee, 0xef, 0xf4, 0x3d, 0xd7, 0x00, 0xb6, 0x43, 0x66, 0x97, 0x8e, 0xf3, 0xf3, 0xf6, 0x37, 0x35, 0x01, 0x00, 0xd6, 0xd9, 0xe8, 0x26, 0xd5, 0x29, 0xaf, 0x17, 0xf4, 0x3d, 0x26, 0x2f, 0x2c, 0x31, 0xfd, 0x41, 0xeb, 0xe7, 0xd6, 0x02, 0x67, 0x95, 0x50, 0x3f, 0xee, 0x42, 0xea, 0x08, 0x09, 0x1c, 0xd4, 0x18, 0xd6, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xd6, 0xd6, 0x00, 0x00, 0x35, 0xee, 0x35, 0xdf, 0xcb, 0xd7, 0x03, 0x37, 0x47, 0x89, 0x8a, 0x3e, 0x3a, 0x49, 0xf2, 0x00, 0x00, 0xca, 0x00, 0xd9, 0xc3, 0xe5, 0x30, 0x2c, 0x31, 0xfa, 0x42, 0x07, 0xd2, 0x32, 0x2d, 0x31, 0xfc, 0x49, 0xf2, 0x35, 0xd6, 0xdb, 0x5b, 0x52, 0x3e, 0x37, 0x42, 0xe3, 0xd8, 0x10, 0xec, 0xb1, 0xb5, 0x1b, 0xdc, 0xc9, 0xd6, 0xd6, 0xd6, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0xd6, 0x00, 0xd6, 0x35, 0x35, 0xee, 0xef, 0x00, 0xde, 0xcb, 0x00, 0x37, 0xef, 0x4f, 0x93, 0x44, 0xee, 0xf6, 0x4e, 0xeb, 0x00, 0x00, 0x01, 0xd6, 0x00, 0xcf, 0x2a, 0x30, 0x2f, 0x2e, 0x0d, 0x05, 0xd1, 0x32, 0x2f, 0x2f, 0xec, 0xf8, 0x02, 0x35, 0xd6, 0xd9, 0xf7, 0xb6, 0x39, 0x4b, 0xe0, 0xe0, 0xe2, 0x28, 0xff, 0xaf, 0xaf, 0x09, 0x09, 0xca, 0xd6, 0xd6, 0xd6, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xc3, 0x06, 0x04, 0x00, 0x00, 0xef, 0xf7, 0x41, 0xee, 0x42, 0xeb, 0x09, 0x09, 0x00, 0x00, 0xea, 0xc4, 0x09, 0xe8, 0x34, 0x30, 0x2a, 0x1b, 0x16, 0x1c, 0x23, 0xc7, 0x33, 0x1d, 0xf1, 0x35, 0x00, 0x01, 0xd6, 0x00, 0x41, 0x49, 0x0a, 0x0b, 0xdd, 0xe2, 0xc8, 0x2d, 0xff, 0x23, 0x3d, 0x0d, 0x06, 0xd6, 0x00, 0xd6, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xc4, 0x03, 0x00, 0x35, 0x02, 0x00, 0x00, 0x02, 0xe1, 0x13, 0x1c, 0x16, 0x02, 0xe1, 0x0a, 0x06, 0x0e, 0xfb, 0xc6, 0x0a, 0xc7, 0x28, 0x2e, 0x07, 0x05, 0x18, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x02, 0x09, 0x09, 0x42, 0x09, 0x09, 0x00, 0x1d, 0x2f, 0x2b, 0x2f, 0xe8, 0x05, 0x0a, 0xc5, 0xe7, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x05, 0x35, 0x00, 0x04, 0xc4, 0x04, 0xc4, 0x0f, 0x29, 0x27, 0x17, 0xdf, 0x07, 0xe1, 0xdf, 0x07, 0x00, 0x13, 0xed, 0x2d, 0x1c, 0x00, 0x35, 0x0f, 0xec, 0x09, 0x00, 0x00, 0xe7, 0x07, 0x0b, 0xe1, 0xc5, 0xea, 0x00, 0x12, 0xed, 0x27, 0x30, 0x25, 0x07, 0xea, 0x0c, 0x09, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x3d, 0x05, 0x00, 0x01, 0x06, 0x06, 0x03, 0x00, 0x3d, 0x29, 0x2f, 0x17, 0xea, 0x0b, 0x0c, 0x3d, 0x00, 0x35, 0xec, 0xc8, 0x28, 0x11, 0x35, 0x35, 0xc6, 0x2f, 0xc7, 0x0d, 0x00, 0xdc, 0x09, 0xea, 0x09, 0xea, 0x00, 0x04, 0x26, 0x27, 0x26, 0xc8, 0x15, 0x3d, 0x0b, 0x42, 0xc4, 0x00, 0x35, 0x02, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x04, 0x03, 0x1a, 0x13, 0x00, 0x02, 0x00, 0x05, 0xc7, 0x2b, 0x14, 0x04, 0x42, 0x05, 0x01, 0x35, 0x0b, 0x24, 0x28, 0x28, 0x07, 0x00, 0x00, 0x1e, 0x27, 0x2e, 0x1f, 0x04, 0x0a, 0x0a, 0xdf, 0x07, 0x00, 0x00, 0x1c, 0x29, 0x27, 0x2f, 0x1b, 0x03, 0xf7, 0x08, 0x12, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x35, 0x00, 0x00, 0x42, 0x1a, 0x2d, 0x1f, 0x00, 0x02, 0x02, 0x3d, 0xfb, 0x2b, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x2b, 0xed, 0x1a, 0x00, 0x00, 0x07, 0x28, 0x28, 0xed, 0x1a, 0x07, 0x0a, 0xdf, 0x0b, 0x01, 0x00, 0xe8, 0xed, 0x26, 0x2d, 0x24, 0x06, 0xea, 0x09, 0x07, 0x1c, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x35, 0x35, 0x00, 0xea, 0x21, 0x2a, 0x24, 0x05, 0x00, 0x00, 0xe7, 0x25, 0x2d, 0x10, 0x00, 0x03, 0x00, 0x00, 0x07, 0x1f, 0x2a, 0x2d, 0x07, 0x05, 0x00, 0x0e, 0x2b, 0x28, 0x28, 0xc4, 0x03, 0xdf, 0x42, 0x0b, 0x03, 0x15, 0x29, 0x29, 0x2b, 0x26, 0x0e, 0x00, 0x0d, 0x42, 0xc6, 0x1b, 0x03, 0x05, 0x09, 0x01, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x08, 0x35, 0x11, 0x2a, 0x2b, 0x0f, 0x00, 0xe7, 0x35, 0x25, 0x2a, 0x10, 0x00, 0x35, 0x00, 0x35, 0x09, 0x26, 0x2a, 0x1d, 0x05, 0x00, 0x00, 0x22, 0x27, 0xc8, 0x17, 0x00, 0x03, 0xea, 0x08, 0x0a, 0x0c, 0xc7, 0x2c, 0x26, 0x2b, 0xc6, 0x01, 0x04, 0x3d, 0x0b, 0x29, 0x1a, 0x18, 0x27, 0x1b, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x05, 0x09, 0x01, 0x00, 0x42, 0x26, 0x2b, 0x19, 0x00, 0x00, 0x35, 0x26, 0xed, 0xe1, 0x00, 0xe7, 0x00, 0x00, 0x18, 0x29, 0x2b, 0x14, 0x00, 0x02, 0x03, 0xed, 0x27, 0x28, 0x3d, 0x00, 0x00, 0x05, 0xea, 0x09, 0xea, 0x15, 0x2a, 0x2d, 0xc6, 0x00, 0x35, 0x04, 0xdf, 0x25, 0x2e, 0x2b, 0x34, 0xed, 0x0c, 0xe7, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x00, 0x05, 0xec, 0x2b, 0x1c, 0x00, 0x35, 0xe7, 0xc7, 0xed, 0xc5, 0x00, 0x00, 0x03, 0x35, 0xe4, 0x2b, 0x25, 0xdc, 0x35, 0x00, 0xc6, 0x28, 0x2c, 0xc6, 0x00, 0x04, 0x35, 0x00, 0x06, 0x0d, 0xc4, 0x42, 0x1e, 0x1a, 0x04, 0xe7, 0x00, 0xc5, 0x1e, 0x2f, 0x2e, 0x2d, 0x2f, 0x19, 0x0a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x35, 0xd9, 0x01, 0x00, 0x00, 0x17, 0x2c, 0x21, 0x02, 0x01, 0x02, 0x24, 0x29, 0x07, 0x00, 0x00, 0x03, 0x09, 0x29, 0x2d, 0x1a, 0x00, 0x35, 0x03, 0xc7, 0xed, 0x26, 0x3d, 0x01, 0xe7, 0x00, 0x01, 0x03, 0x03, 0x0a, 0x0b, 0x09, 0x05, 0x00, 0x01, 0x00, 0x1c, 0x33, 0x2b, 0x2e, 0x32, 0x20, 0xea, 0xdf, 0x09, 0x00, 0x35, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x15, 0x1b, 0x1c, 0xf7, 0x03, 0x00, 0x0e, 0x2a, 0x27, 0x3d, 0x01, 0x03, 0x24, 0x27, 0x05, 0x00, 0x01, 0x00, 0x18, 0x2c, 0xed, 0x0b, 0x00, 0x00, 0x5d, 0x29, 0x2c, 0xe8, 0x00, 0x02, 0x03, 0x5d, 0x24, 0x24, 0xc6, 0xea, 0x06, 0x0b, 0x07, 0x00, 0xe7, 0x18, 0x2f, 0x29, 0x27, 0x30, 0xec, 0xc5, 0x05, 0x09, 0x07, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x34, 0x34, 0x34, 0x26, 0x04, 0x00, 0x07, 0x26, 0x2b, 0x0a, 0x00, 0x04, 0xc7, 0x25, 0x35, 0x00, 0xe7, 0x00, 0x25, 0x2b, 0x20, 0x02, 0x02, 0x01, 0x1f, 0x2c, 0xc7, 0x05, 0x00, 0x3d, 0xe5, 0x31, 0x24, 0xc6, 0x1f, 0x1b, 0xea, 0x09, 0x0d, 0x0a, 0x1a, 0xc8, 0x27, 0xc7, 0x31, 0x1d, 0x07, 0x00, 0xe1, 0x0b, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x5d, 0x0f, 0x07, 0xe8, 0x30, 0x0c, 0x00, 0x02, 0xec, 0x2e, 0x10, 0x00, 0x04, 0x26, 0x22, 0x00, 0x03, 0x00, 0x0c, 0x2c, 0x29, 0x15, 0x00, 0x00, 0x10, 0x28, 0xc8, 0x13, 0x00, 0xdc, 0x19, 0xc7, 0xc4, 0x00, 0x04, 0x00, 0x3d, 0x0d, 0x07, 0x09, 0xe6, 0x2f, 0x29, 0x29, 0x2b, 0x1f, 0x06, 0x00, 0x09, 0x09, 0x0a, 0xf7, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x03, 0x00, 0x13, 0x13, 0x03, 0x00, 0x1b, 0x2e, 0xe8, 0x00, 0x05, 0x27, 0xe6, 0x00, 0x03, 0x00, 0x1b, 0x2d, 0x22, 0xdc, 0x35, 0x00, 0x20, 0x2b, 0x22, 0x02, 0x35, 0x0c, 0x1a, 0x00, 0x00, 0x00, 0xe7, 0x05, 0xe1, 0x0a, 0x09, 0xea, 0x21, 0x2c, 0x25, 0x2a, 0x1a, 0x35, 0x00, 0x05, 0x0a, 0x07, 0x10, 0x08, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xdf, 0x00, 0xd9, 0x35, 0xd9, 0xdc, 0x00, 0x00, 0x17, 0x2e, 0x18, 0x00, 0x05, 0x28, 0x1b, 0x00, 0x01, 0x02, 0x23, 0x2d, 0x1a, 0x00, 0x00, 0x0d, 0xed, 0x2a, 0x14, 0x01, 0x02, 0xea, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x05, 0x05, 0xc5, 0x07, 0x18, 0x2b, 0x26, 0x12, 0x00, 0x01, 0x01, 0xe1, 0x03, 0x12, 0xec, 0x03, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0xd6, 0x00, 0xc4, 0x00, 0x00, 0xd9, 0xd6, 0xd6, 0xd8, 0x02, 0x0b, 0x2f, 0x1b, 0x00, 0xea, 0x2a, 0xc6, 0x00, 0x00, 0x0e, 0x2d, 0x27, 0xe1, 0x02, 0x00, 0x20, 0x2c, 0x21, 0xd9, 0xd6, 0x01, 0xd6, 0x35, 0xee, 0x00, 0x5b, 0xec, 0x1f, 0xe6, 0xe4, 0xe6, 0x19, 0x17, 0xe8, 0x05, 0x35, 0x35, 0x02, 0x05, 0xea, 0x0b, 0x25, 0x1c, 0x00, 0x35, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xee, 0x35, 0x00, 0x00, 0xd6, 0x00, 0xd6, 0x02, 0xdd, 0x12, 0x09, 0xd6, 0x00, 0xda, 0xd6, 0xd6, 0xd6, 0x0a, 0x2d, 0x1c, 0x00, 0xc5, 0x2a, 0x15, 0x35, 0x01, 0x1a, 0x30, 0x1d, 0x03, 0x00, 0x0e, 0x28, 0x2c, 0x11, 0xd6, 0x00, 0xd6, 0xe7, 0x00, 0x08, 0xfe, 0xb5, 0xb3, 0xfd, 0xe9, 0xd5, 0xc8, 0xc6, 0xdf, 0x00, 0x00, 0x01, 0x00, 0xe7, 0x09, 0xe1, 0x2a, 0x2d, 0xdf, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xee, 0x35, 0x00, 0x00, 0x00, 0xd6, 0xd8, 0xea, 0x26, 0x34, 0x2b, 0x1b, 0xd6, 0x00, 0xd7, 0xd6, 0x00, 0xc4, 0xed, 0x1f, 0x00, 0x0a, 0x2b, 0x0e, 0x00, 0x06, 0xc7, 0x2d, 0x12, 0x00, 0x02, 0x20, 0xaf, 0x22, 0x01, 0xe7, 0xd6, 0x00, 0x00, 0x08, 0xa8, 0xb5, 0x94, 0x49, 0xf1, 0x00, 0xdc, 0xd0, 0xdf, 0xe1, 0x05, 0xe7, 0x00, 0x01, 0xc5, 0x11, 0x29, 0x27, 0x09, 0x00, 0x00, 0x03, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xee, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xe7, 0xdf, 0x1c, 0x23, 0xae, 0x34, 0x1c, 0x35, 0xc3, 0x00, 0x00, 0x05, 0x26, 0x21, 0x00, 0x0b, 0x2c, 0x0a, 0x00, 0x0d, 0x2e, 0x23, 0x07, 0x00, 0x0f, 0x2b, 0x2a, 0x13, 0x35, 0xd6, 0xd6, 0xd9, 0x00, 0x94, 0x34, 0x82, 0xf5, 0xee, 0x40, 0x41, 0x03, 0x07, 0x11, 0xf7, 0x00, 0x35, 0xe7, 0x0b, 0x1c, 0x2f, 0xfb, 0x14, 0x0d, 0x17, 0x18, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xee, 0x00, 0x35, 0x00, 0xd6, 0x00, 0xd6, 0x42, 0x40, 0x35, 0x51, 0xab, 0x34, 0xba, 0x00, 0xc3, 0x00, 0xd9, 0xc7, 0x21, 0x00, 0x10, 0x2b, 0xdc, 0x35, 0x1a, 0x32, 0x17, 0x00, 0x04, 0x1c, 0xc8, 0xfb, 0x05, 0xe7, 0x00, 0x00, 0x35, 0x08, 0x2d, 0xb2, 0x99, 0x6e, 0x4d, 0xb6, 0x3d, 0x42, 0x04, 0x0e, 0x0e, 0x01, 0x07, 0xc6, 0x28, 0x32, 0x2e, 0x28, 0x34, 0x32, 0x29, 0x16, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0xe1, 0x09, 0xee, 0x36, 0x4d, 0x2e, 0xab, 0xca, 0xb6, 0x35, 0x01, 0x24, 0x22, 0x00, 0x15, 0x27, 0x03, 0x03, 0x24, 0x2a, 0x0b, 0x00, 0x0d, 0x29, 0x2a, 0xe8, 0x35, 0x00, 0x00, 0xd6, 0x00, 0xba, 0xb5, 0xa8, 0xb2, 0xad, 0xa5, 0xf5, 0x3b, 0x40, 0x03, 0xf7, 0x13, 0x19, 0x26, 0x2d, 0xc8, 0x2b, 0x2e, 0x34, 0xed, 0xe4, 0x42, 0xc4, 0x07, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc3, 0xd6, 0xc3, 0x0e, 0x00, 0xb6, 0x37, 0x4e, 0xa7, 0xb5, 0xb8, 0x00, 0x01, 0x00, 0xfb, 0x21, 0x35, 0x17, 0xfb, 0x00, 0x0d, 0xed, 0x1d, 0x02, 0xe7, 0x1b, 0x2d, 0xfb, 0x07, 0x00, 0x00, 0x01, 0xd9, 0x00, 0x1d, 0xc1, 0xbf, 0xa5, 0xa7, 0xa9, 0x7b, 0x37, 0xb6, 0x36, 0x42, 0x1b, 0x2c, 0x29, 0x25, 0x28, 0x2c, 0x30, 0x25, 0x5d, 0xdf, 0x0b, 0x09, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x35, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x0b, 0xb7, 0x35, 0x38, 0xa7, 0xc0, 0xb2, 0x1b, 0xb6, 0x35, 0x00, 0xfb, 0x21, 0x01, 0x19, 0x21, 0x00, 0x18, 0xc8, 0x15, 0x00, 0x3d, 0xc7, 0x2b, 0x1c, 0x00, 0x35, 0x00, 0x00, 0x00, 0xb6, 0xbc, 0xb5, 0x99, 0xb6, 0xa2, 0xaa, 0xa6, 0x39, 0xb6, 0xb6, 0xc2, 0x18, 0x2a, 0x27, 0x2a, 0x2b, 0x21, 0x18, 0x0a, 0xea, 0xc5, 0x07, 0xe1, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x00, 0xd6, 0xd6, 0x00, 0x02, 0xc4, 0x40, 0xb6, 0x7b, 0xac, 0xa2, 0xc0, 0xbd, 0x00, 0x00, 0x01, 0xe5, 0x20, 0x02, 0x1f, 0x1c, 0x00, 0xec, 0x29, 0xc4, 0x00, 0x15, 0x2b, 0x28, 0x0e, 0x35, 0x00, 0x00, 0xd6, 0x00, 0x00, 0xbe, 0xb5, 0xaa, 0x99, 0xb0, 0xaa, 0xbf, 0x55, 0x00, 0xb6, 0xf7, 0x14, 0x28, 0x28, 0x20, 0x11, 0x02, 0x00, 0xdc, 0xe1, 0xc5, 0x0a, 0x0d, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x00, 0xd6, 0x00, 0xd6, 0x01, 0x06, 0x49, 0x00, 0x99, 0xbf, 0x3b, 0x82, 0xbe, 0x00, 0x00, 0x35, 0x24, 0x1e, 0x35, 0x21, 0x18, 0x35, 0x26, 0x22, 0x02, 0x00, 0x1b, 0x2d, 0x22, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xb5, 0xb4, 0xb2, 0xb4, 0xb0, 0xa6, 0x60, 0xb6, 0xb7, 0x0f, 0x0b, 0x5d, 0x0b, 0x3d, 0x01, 0x00, 0x00, 0xdf, 0x05, 0x0d, 0x03, 0x1f, 0x1d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x35, 0x03, 0x4e, 0x3b, 0x94, 0xad, 0xa3, 0xab, 0xc0, 0xb6, 0x35, 0x00, 0x26, 0x1c, 0x00, 0x25, 0x13, 0x04, 0xc8, 0x1a, 0x00, 0x05, 0xc7, 0xc8, 0x1a, 0x00, 0x00, 0x35, 0x35, 0x00, 0xd6, 0x00, 0xbb, 0xc1, 0xb4, 0xb4, 0xb4, 0xb0, 0xa7, 0x58, 0x36, 0x0f, 0x51, 0x09, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x35, 0xe7, 0x0b, 0x04, 0x13, 0x33, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x00, 0x00, 0xd6, 0x00, 0xd6, 0xb6, 0xf4, 0x49, 0x8b, 0xac, 0xb5, 0xb5, 0xa8, 0xb7, 0x35, 0xe7, 0x29, 0x1a, 0x01, 0xed, 0x0a, 0x0b, 0x2f, 0x14, 0x00, 0x0f, 0x2b, 0x29, 0x10, 0x00, 0x00, 0x35, 0x00, 0x00, 0xb6, 0x00, 0x1a, 0xc1, 0xb3, 0xb4, 0xb4, 0xaa, 0xa9, 0xb8, 0xf7, 0xb9, 0x42, 0xc5, 0x0c, 0x05, 0x00, 0x02, 0x01, 0x00, 0x00, 0xc5, 0x07, 0x26, 0x33, 0xe5, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0x00, 0x00, 0xb6, 0x41, 0x8b, 0xa9, 0xb3, 0xb5, 0xae, 0x07, 0x00, 0x06, 0x2a, 0xe8, 0xc4, 0x2b, 0x05, 0x15, 0x2d, 0xe1, 0x35, 0x1a, 0x2d, 0xfb, 0x42, 0x00, 0xee, 0x00, 0x00, 0x35, 0x01, 0x00, 0xb9, 0xc0, 0xb2, 0xb5, 0xb4, 0xbd, 0xa2, 0x55, 0x51, 0x3d, 0xc4, 0xdf, 0xe1, 0x05, 0x00, 0x35, 0x35, 0x35, 0xe7, 0x00, 0xe4, 0x2f, 0x2a, 0x29, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x35, 0xf2, 0x55, 0x99, 0xa9, 0x34, 0x2b, 0x04, 0x00, 0x09, 0x2b, 0x11, 0x10, 0x27, 0x01, 0x1a, 0x2a, 0x03, 0xd9, 0x21, 0x2c, 0x1c, 0x01, 0x35, 0xee, 0x00, 0x00, 0xb6, 0xd6, 0x00, 0xf7, 0xbb, 0xbf, 0xa5, 0x67, 0x48, 0x35, 0x35, 0x42, 0xc4, 0x09, 0x0a, 0xdf, 0x42, 0x00, 0x35, 0x00, 0x00, 0x00, 0x5d, 0x2f, 0x2f, 0x2f, 0x2d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0xf4, 0xf0, 0xee, 0x51, 0xc6, 0x12, 0x01, 0x00, 0x10, 0xc8, 0x0b, 0x17, 0x24, 0x00, 0xec, 0xc7, 0x00, 0x0a, 0x28, 0x2a, 0x13, 0x00, 0x00, 0x35, 0x00, 0xb6, 0x00, 0x00, 0xb6, 0x03, 0x51, 0x41, 0x36, 0x35, 0xf0, 0x00, 0x37, 0x04, 0x42, 0xea, 0xea, 0xea, 0x0b, 0xd9, 0x00, 0x00, 0x35, 0x0b, 0xed, 0x2c, 0x2f, 0x32, 0x20, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x3d, 0xf5, 0x00, 0xee, 0xee, 0x00, 0xdd, 0x00, 0x15, 0x2e, 0x09, 0x1c, 0x21, 0x35, 0x24, 0x21, 0x00, 0x13, 0x2c, 0x29, 0xdf, 0x00, 0x35, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x03, 0x00, 0x00, 0xb6, 0x00, 0xf0, 0x37, 0x0a, 0x10, 0x15, 0xe8, 0xe1, 0xe1, 0xc5, 0x0b, 0x35, 0x00, 0x02, 0xf7, 0x26, 0x2b, 0x2b, 0x2f, 0x27, 0x0c, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x00, 0x00, 0x00, 0xc5, 0x03, 0x00, 0x1b, 0x29, 0x42, 0x25, 0x19, 0x04, 0x27, 0x18, 0x00, 0x1c, 0x2b, 0x21, 0x02, 0x00, 0xe7, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x5d, 0x51, 0x00, 0x02, 0x42, 0x0c, 0x1c, 0x33, 0x24, 0xc5, 0x09, 0xe1, 0x03, 0x00, 0xe1, 0x29, 0x2c, 0x24, 0x30, 0x2b, 0xe1, 0x0b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfb, 0x1f, 0x10, 0x03, 0x04, 0x02, 0x00, 0x23, 0x25, 0x42, 0x26, 0x15, 0xc4, 0xc8, 0x14, 0x02, 0xe5, 0xc8, 0x17, 0x35, 0x35, 0x35, 0x03, 0x00, 0x00, 0x42, 0xe8, 0x1e, 0x25, 0x28, 0x28, 0xed, 0x11, 0x00, 0x00, 0xe7, 0x00, 0x1a, 0x33, 0x0a, 0xe1, 0xdf, 0x05, 0xe8, 0xed, 0x2a, 0x26, 0x2d, 0x26, 0xe8, 0x08, 0x0a, 0xdf, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x5d, 0xe1, 0x03, 0x03, 0x35, 0x29, 0x1f, 0x11, 0x30, 0x10, 0xdf, 0x2a, 0xc5, 0x06, 0x27, 0x2d, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x0b, 0x1b, 0xfb, 0x26, 0x26, 0x27, 0x27, 0x27, 0x2b, 0x1f, 0x00, 0x35, 0x00, 0x02, 0x14, 0x2e, 0x15, 0x42, 0x0b, 0x1e, 0x27, 0xed, 0x26, 0x2b, 0x26, 0x12, 0x07, 0x09, 0xea, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x3d, 0x00, 0x01, 0x35, 0x3d, 0x02, 0x0c, 0xc8, 0x19, 0xc6, 0xc8, 0xdc, 0x10, 0x2c, 0x05, 0x0d, 0xed, 0x27, 0x05, 0x00, 0x35, 0x00, 0x0c, 0x11, 0x10, 0x0a, 0x03, 0x01, 0x04, 0x08, 0x1c, 0xed, 0x2c, 0x10, 0x35, 0x00, 0x07, 0x0b, 0x31, 0x17, 0x03, 0x0d, 0xec, 0x29, 0x2b, 0x29, 0x27, 0x13, 0x00, 0xc5, 0x09, 0x0c, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc4, 0x02, 0x00, 0x35, 0x0a, 0x00, 0x12, 0x2b, 0x1b, 0x1c, 0x26, 0x07, 0x17, 0x24, 0x02, 0x19, 0xc8, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x05, 0x26, 0x29, 0x20, 0x35, 0x03, 0x06, 0x11, 0x30, 0x1e, 0x03, 0x08, 0xe8, 0x2a, 0xc8, 0x27, 0x13, 0x35, 0x35, 0x0a, 0x02, 0x1a, 0x26, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x04, 0x01, 0xc4, 0x03, 0x02, 0x20, 0x30, 0x28, 0x2b, 0x30, 0x1f, 0x27, 0x22, 0x00, 0xe6, 0x2f, 0x15, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x02, 0x01, 0x00, 0x35, 0x01, 0x00, 0x1d, 0x2b, 0x2b, 0x42, 0x00, 0x07, 0x0b, 0x31, 0x1b, 0x07, 0x10, 0x0d, 0x25, 0x23, 0x0e, 0x00, 0x00, 0xe7, 0x05, 0x0a, 0x27, 0x2c, 0x03, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0xc4, 0x35, 0x00, 0x01, 0x07, 0x18, 0x2b, 0x2a, 0x27, 0x27, 0x29, 0xed, 0x2d, 0xe5, 0x10, 0x22, 0x2a, 0xe1, 0x00, 0xe7, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2c, 0x2b, 0x18, 0x01, 0x0e, 0x0c, 0x2f, 0xfb, 0x3d, 0x09, 0x1a, 0xfb, 0x0a, 0x35, 0x35, 0xe7, 0x00, 0x3d, 0x1b, 0x31, 0xc8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x00, 0xdf, 0xec, 0x2d, 0xed, 0xfb, 0x2b, 0xed, 0x26, 0x28, 0xed, 0xed, 0x2a, 0x28, 0xc7, 0x02, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x05, 0x0a, 0xea, 0xe7, 0x00, 0x01, 0x00, 0x0a, 0x27, 0x28, 0xfb, 0x09, 0x06, 0x0e, 0x2f, 0x25, 0x0a, 0x0b, 0x21, 0x27, 0x09, 0x00, 0x00, 0x02, 0x00, 0xe1, 0x28, 0x31, 0x31, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0xea, 0x02, 0xec, 0x2b, 0x26, 0x28, 0x29, 0x28, 0x28, 0x28, 0x29, 0x28, 0x28, 0x28, 0x2f, 0x1d, 0x00, 0x01, 0x00, 0x03, 0x00, 0x0e, 0x20, 0x27, 0x2a, 0x25, 0x20, 0xdc, 0x00, 0x00, 0x02, 0x1f, 0x2e, 0xed, 0x14, 0x05, 0x10, 0x30, 0x26, 0x0d, 0x0e, 0x2b, 0xc7, 0x0a, 0xe7, 0x02, 0x00, 0x02, 0x24, 0x32, 0x2b, 0x2f, 0xe8, 0x00, 0xe7, 0x35, 0x00, 0x35, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x35, 0x16, 0xed, 0x26, 0x29, 0x29, 0x28, 0x28, 0x29, 0x28, 0x28, 0x28, 0x29, 0x26, 0x2f, 0x15, 0x02, 0x35, 0x02, 0x04, 0x1a, 0x28, 0x21, 0x20, 0xc7, 0x2b, 0xc8, 0xc6, 0x00, 0x02, 0x35, 0x1b, 0x33, 0x32, 0x17, 0x02, 0x5d, 0x33, 0x26, 0x0b, 0xe8, 0xed, 0x1b, 0x04, 0xc5, 0x00, 0x03, 0x1f, 0x2e, 0x2f, 0x34, 0x1c, 0x07, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x24, 0x2c, 0x24, 0xed, 0x28, 0x29, 0x28, 0x28, 0x28, 0x29, 0x28, 0x28, 0x25, 0x29, 0x27, 0x00, 0x35, 0x00, 0x11, 0x0f, 0xc4, 0x00, 0x00, 0x08, 0x19, 0x2f, 0x25, 0x42, 0x00, 0x3d, 0x18, 0x2e, 0x2d, 0x1e, 0x07, 0x15, 0x2a, 0x19, 0x02, 0x1e, 0x2e, 0xe8, 0x00, 0xe1, 0x10, 0xe5, 0x27, 0x2b, 0x32, 0x22, 0xc4, 0x0b, 0x0b, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x13, 0x2c, 0xc7, 0x26, 0x28, 0x29, 0x28, 0x28, 0x29, 0x28, 0x28, 0x28, 0x29, 0x2b, 0x28, 0xed, 0x12, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd9, 0x35, 0x0a, 0x26, 0x2c, 0x15, 0x05, 0x3d, 0x0f, 0x30, 0x33, 0xec, 0xc4, 0x16, 0xe8, 0x3d, 0x0c, 0xed, 0xed, 0x0a, 0x00, 0x16, 0xfb, 0x2a, 0x2b, 0x34, 0x22, 0x09, 0x09, 0xe1, 0x0a, 0x35, 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0xfb, 0x2a, 0x21, 0xed, 0x28, 0x28, 0x29, 0x28, 0x28, 0x28, 0x29, 0x28, 0x28, 0x29, 0x25, 0x2d, 0xc7, 0x00, 0x35, 0x02, 0x00, 0xe7, 0xe7, 0x00, 0x00, 0x03, 0x21, 0x2f, 0x26, 0x07, 0x0b, 0x0c, 0x2b, 0x32, 0x24, 0x0e, 0xc5, 0xea, 0x00, 0x1b, 0x2f, 0x20, 0xe7, 0x00, 0x1a, 0x2a, 0x22, 0x2f, 0x25, 0x09, 0x3d, 0x0f, 0x06, 0xea, 0xd9, 0x02, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x2c, 0xc7, 0x24, 0xed, 0x27, 0x29, 0x28, 0x28, 0x29, 0x28, 0x28, 0x28, 0x29, 0x27, 0x27, 0x2a, 0x2a, 0x21, 0x09, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x2f, 0x2c, 0x12, 0xdc, 0xdc, 0x26, 0x25, 0x13, 0x07, 0xe1, 0x03, 0x08, 0x26, 0x2b, 0xc6, 0x02, 0x00, 0x19, 0x2b, 0x25, 0x1c, 0xea, 0x05, 0x0c, 0xc4, 0x3d, 0x1b, 0x12, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xd9, 0x21, 0x2a, 0xfb, 0xc7, 0x27, 0x28, 0x28, 0x29, 0x28, 0x28, 0x28, 0x29, 0x28, 0x28, 0x2a, 0xed, 0x26, 0x29, 0x2b, 0x27, 0x17, 0x02, 0x00, 0xe7, 0x01, 0x03, 0xe7, 0x1a, 0x31, 0x2f, 0xc6, 0xc5, 0x0b, 0x16, 0x0d, 0x06, 0x3d, 0x05, 0x00, 0x1a, 0x2f, 0x25, 0xc5, 0x00, 0x00, 0xec, 0x2b, 0xc7, 0xea, 0xea, 0xe1, 0xe1, 0x42, 0x0e, 0x30, 0x22, 0x02, 0x00, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2e, 0x28, 0x25, 0xe5, 0x29, 0xed, 0x28, 0x28, 0x28, 0x29, 0x28, 0x28, 0x28, 0x29, 0x27, 0xed, 0x28, 0x27, 0x29, 0x29, 0x2d, 0x24, 0x0e, 0x00, 0x00, 0x08, 0x06, 0xc6, 0x32, 0x33, 0x20, 0xea, 0x0c, 0xdf, 0x03, 0x06, 0x3d, 0x00, 0xe1, 0x2a, 0x2a, 0x1b, 0x00, 0xd9, 0x35, 0xc7, 0x2a, 0xc7, 0x05, 0x0d, 0x09, 0xdc, 0x09, 0xc7, 0x30, 0x2c, 0x0c, 0x35, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0xec, 0x2d, 0xc7, 0x24, 0x25, 0x28, 0xed, 0x28, 0xed, 0x27, 0x27, 0xed, 0x2b, 0x29, 0x27, 0x29, 0x27, 0x28, 0x29, 0x29, 0x27, 0x27, 0xed, 0x2b, 0x10, 0x00, 0x0b, 0x42, 0x10, 0x30, 0x20, 0x0f, 0x08, 0xdf, 0x02, 0x35, 0x00, 0xe7, 0x02, 0x1f, 0xc8, 0x27, 0x0e, 0x00, 0x00, 0xc4, 0xed, 0x2a, 0xe4, 0x04, 0x05, 0xf7, 0x0c, 0x24, 0x31, 0x2d, 0x2f, 0x1c, 0x00, 0x35, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0xed, 0x26, 0xe5, 0x25, 0x29, 0x28, 0x29, 0x28, 0x28, 0x29, 0xd4, 0x27, 0x26, 0xed, 0xd4, 0x29, 0x28, 0x29, 0x29, 0x27, 0x27, 0x29, 0x29, 0x2a, 0x0d, 0x09, 0x42, 0x0b, 0x17, 0x07, 0xc4, 0x3d, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x16, 0x29, 0x2a, 0x1c, 0x00, 0xd9, 0x00, 0x15, 0x29, 0x2a, 0xe4, 0x35, 0x00, 0x05, 0x1c, 0x32, 0x2b, 0x31, 0x24, 0x0a, 0x42, 0xe7, 0x00, 0x02, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x2e, 0x27, 0x28, 0x23, 0x26, 0xed, 0x27, 0xed, 0x27, 0x29, 0x2a, 0x27, 0xfb, 0x25, 0x2c, 0x2a, 0x29, 0x28, 0x29, 0xed, 0x2a, 0xed, 0xed, 0x29, 0x34, 0x14, 0x42, 0x0d, 0x0c, 0x08, 0x01, 0x03, 0x00, 0x01, 0x35, 0x01, 0x00, 0x0a, 0x27, 0x2d, 0xc7, 0x0a, 0x00, 0x00, 0x00, 0x1b, 0x2a, 0x2a, 0x18, 0x35, 0x02, 0x35, 0x1a, 0xed, 0x31, 0x25, 0x0e, 0xea, 0xe1, 0x03, 0x01, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x2f, 0xed, 0x27, 0xe5, 0x26, 0x2a, 0x27, 0xed, 0x27, 0x29, 0xed, 0xc7, 0xe5, 0x28, 0x2f, 0x2c, 0xed, 0x27, 0x29, 0x2c, 0x2d, 0xc8, 0x2a, 0x30, 0x2e, 0x1b, 0xc4, 0x0d, 0x07, 0x35, 0x04, 0x00, 0x00, 0x01, 0x01, 0x35, 0x05, 0x23, 0x2a, 0xed, 0x18, 0x00, 0x03, 0x00, 0xe7, 0x20, 0x2b, 0x2b, 0x15, 0x00, 0xd9, 0x00, 0x20, 0x26, 0xe5, 0x11, 0x06, 0xea, 0xdf, 0xdf, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x02, 0xc7, 0x2c, 0x2f, 0x29, 0xc7, 0x28, 0x28, 0xed, 0x28, 0x28, 0x29, 0x26, 0xe5, 0xc7, 0xc8, 0x31, 0x2d, 0x29, 0x27, 0xed, 0x2e, 0x30, 0x2e, 0x2b, 0x2d, 0x31, 0x1d, 0xc4, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe7, 0x00, 0x00, 0x20, 0x2b, 0x28, 0x20, 0x06, 0x00, 0x00, 0x02, 0xf7, 0xed, 0x27, 0x28, 0x0e, 0x00, 0x00, 0x03, 0x2a, 0x2a, 0x20, 0x0b, 0xc5, 0x0a, 0x08, 0x13, 0x0f, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x03, 0x27, 0xed, 0x34, 0xc8, 0x27, 0x28, 0x27, 0xed, 0x28, 0x28, 0xed, 0x25, 0x21, 0x27, 0x31, 0x32, 0x2e, 0x29, 0x27, 0x2b, 0x2f, 0x2d, 0x2b, 0x2c, 0x2f, 0x31, 0x0e, 0x03, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x04, 0x19, 0x2d, 0x2a, 0x26, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x18, 0x2c, 0x28, 0xc7, 0x05, 0x00, 0x03, 0x0b, 0x25, 0x29, 0xed, 0x0e, 0xdf, 0x09, 0x05, 0x1c, 0x2f, 0xc5, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x27, 0xed, 0x31, 0x33, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xed, 0x26, 0x21, 0x27, 0x31, 0x32, 0x2c, 0x29, 0x29, 0x2e, 0x2f, 0x2b, 0x2a, 0x2e, 0x34, 0x1f, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe7, 0x1a, 0x30, 0xc7, 0xed, 0xe8, 0x00, 0x00, 0x01, 0x02, 0x35, 0x24, 0x29, 0x2b, 0x1b, 0xe7, 0x00, 0x00, 0x14, 0x2a, 0x2a, 0x24, 0x03, 0xe1, 0xe1, 0x12, 0x29, 0x34, 0xe5, 0xdc, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0xed, 0x2b, 0x34, 0x28, 0x28, 0x29, 0x27, 0x29, 0x28, 0x2a, 0x27, 0x22, 0x26, 0x2f, 0x31, 0x2a, 0x28, 0x2a, 0x31, 0x2f, 0xed, 0x2a, 0x33, 0x26, 0x06, 0x01, 0x00, 0x00, 0x35, 0x00, 0xe7, 0x00, 0x07, 0x1b, 0xed, 0x29, 0x2c, 0x19, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x2a, 0x29, 0xed, 0x15, 0x00, 0x02, 0x00, 0x1a, 0x2a, 0x2a, 0xec, 0xe7, 0x05, 0x21, 0x23, 0x33, 0x2a, 0x33, 0x21, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x33, 0x26, 0x30, 0x2c, 0x28, 0x26, 0x2a, 0x29, 0x26, 0xed, 0x29, 0xfb, 0xfb, 0x2a, 0x2f, 0x2a, 0x27, 0x2d, 0x31, 0xed, 0xc8, 0xed, 0x31, 0x0e, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0xc7, 0x2b, 0x25, 0x2a, 0x1b, 0xd9, 0x00, 0x00, 0x00, 0x35, 0x35, 0x22, 0x2a, 0xed, 0x26, 0x07, 0x00, 0x00, 0x35, 0x20, 0x2a, 0x2b, 0x1c, 0x00, 0x0c, 0xed, 0x28, 0x1f, 0x2c, 0x34, 0x15, 0xdf, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0xe7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x26, 0x2f, 0x26, 0xe5, 0xc8, 0x2a, 0x27, 0xed, 0x27, 0x28, 0x2a, 0x2a, 0x2a, 0xed, 0xc7, 0x28, 0x32, 0x31, 0xed, 0x29, 0xc8, 0x34, 0x22, 0x03, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x05, 0x0f, 0xe5, 0x2a, 0x25, 0x2f, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35, 0x0d, 0x28, 0x2a, 0x28, 0x1c, 0x35, 0x35, 0x00, 0xc4, 0x27, 0x29, 0x2b, 0xc6, 0x00, 0x12, 0x2a, 0x28, 0x16, 0x16, 0x1a, 0xe1, 0x09, 0x0c, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x02, 0x00, 0x00, 0x01, 0x00, 0x35, 0x35, 0x35, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x35, 0xe7, 0x02, 0x00, 0x00, 0x35, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2a, 0x33, 0x2e, 0x27, 0x26, 0xed, 0x26, 0x26, 0xed, 0xed, 0x26, 0x28, 0x2b, 0x2c, 0x2b, 0x33, 0x2d, 0x28, 0x2a, 0x2e, 0x2c, 0x0e, 0x00, 0x00, 0x35, 0x00, 0xe7, 0x0b, 0x1f, 0x2d, 0x2c, 0x27, 0x2d, 0xc6, 0x00, 0x35, 0x00, 0x02, 0x35, 0x01, 0x02, 0x1e, 0x2d, 0x26, 0xed, 0x0c, 0x00, 0x01, 0x00, 0x13, 0x2d, 0x28, 0x28, 0x0e, 0x00, 0x18, 0x2a, 0x2a, 0x0c, 0x00, 0xc4, 0x08, 0x09, 0x42, 0x42, 0xc5, 0x04, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x35, 0x35, 0x00, 0x00, 0x00, 0x35, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0b, 0x1b, 0x2c, 0x32, 0x34, 0xc8, 0x2f, 0x2d, 0xc8, 0x2b, 0x2c, 0x2d, 0x2f, 0x2f, 0x31, 0x2c, 0x2a, 0x2a, 0x2e, 0x34, 0x18, 0x04, 0x02, 0x02, 0x04, 0x0d, 0x1b, 0x27, 0xc8, 0x25, 0x27, 0x29, 0xf7, 0x00, 0x04, 0x00, 0x35, 0x00, 0x00, 0x00, 0x5d, 0x29, 0x2a, 0x28, 0x21, 0x35, 0x35, 0xe7, 0x00, 0x1b, 0x2d, 0x27, 0x26, 0x3d, 0x00, 0x1e, 0xed, 0x2a, 0x0c, 0x00, 0x00, 0x09, 0x1d, 0x13, 0xe1, 0xe1, 0x0b, 0xc5, 0x35, 0x00, 0xe7, 0x02, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe7, 0xe7, 0x03, 0x00, 0x00, 0x01, 0xd9, 0x01, 0x35, 0x00, 0x00, 0xe7, 0x35, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0xc4, 0x5d, 0x1e, 0x30, 0x2e, 0xc8, 0xc8, 0x31, 0x32, 0x30, 0x2c, 0x2c, 0x2a, 0x26, 0xed, 0x2a, 0x2f, 0x2b, 0xc5, 0xe7, 0x11, 0x18, 0x21, 0x2d, 0x2c, 0x26, 0x29, 0x2c, 0x1f, 0x03, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc4, 0x26, 0x29, 0x28, 0x2c, 0x0d, 0x35, 0xe7, 0x00, 0x05, 0xc7, 0x2a, 0x28, 0x22, 0x00, 0xe7, 0x24, 0x29, 0x27, 0x0a, 0x00, 0x00, 0x42, 0x2a, 0x26, 0x21, 0x14, 0x09, 0x0d, 0xe1, 0x05, 0x02, 0x00, 0x35, 0x00, 0x00, 0xd9, 0x35, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x05, 0x06, 0x02, 0x06, 0xc4, 0x06, 0xd9, 0xe8, 0x22, 0x1f, 0x1d, 0x25, 0x1d, 0xe1, 0x08, 0xc4, 0xea, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x35, 0x01, 0x00, 0x01, 0x05, 0x26, 0x29, 0xed, 0x29, 0x28, 0x29, 0x27, 0x27, 0x2a, 0x26, 0x27, 0x2d, 0x31, 0x33, 0x17, 0x00, 0x00, 0x20, 0x2c, 0x26, 0x25, 0x2a, 0x2f, 0x22, 0x0b, 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x35, 0x00, 0x03, 0x1d, 0x2b, 0x27, 0x2b, 0x1e, 0x01, 0x35, 0x35, 0x00, 0x11, 0x2b, 0x28, 0xed, 0x19, 0x00, 0xdf, 0x28, 0x2b, 0x24, 0x3d, 0x35, 0x35, 0x09, 0x28, 0x2c, 0x2d, 0x18, 0x02, 0x05, 0xe1, 0x0e, 0x0e, 0x06, 0x03, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x35, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xe7, 0x03, 0x04, 0x05, 0x05, 0x08, 0x07, 0x05, 0x06, 0x05, 0x00, 0x01, 0x0c, 0x26, 0x2b, 0x2b, 0x2b, 0x28, 0x16, 0x00, 0x00, 0xd9, 0x06, 0xea, 0x42, 0xc4, 0x3d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x00, 0xc6, 0x2a, 0x2d, 0x29, 0x25, 0x27, 0x2b, 0xed, 0x29, 0x2e, 0x30, 0x2f, 0x31, 0xc7, 0xdc, 0x00, 0xe7, 0x1a, 0x2b, 0x2c, 0x2e, 0x21, 0x0f, 0x03, 0x03, 0x35, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x00, 0xc6, 0x2d, 0x26, 0xed, 0x26, 0xe1, 0xe7, 0x00, 0x00, 0xe7, 0x1d, 0x2a, 0xed, 0x27, 0x0b, 0x00, 0x16, 0xed, 0x2b, 0x21, 0x02, 0x35, 0xe7, 0x0d, 0x2c, 0x28, 0x27, 0xe8, 0x35, 0x35, 0x35, 0x02, 0x1e, 0x22, 0x18, 0x12, 0x0c, 0xe7, 0x04, 0x06, 0x03, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe7, 0x04, 0xe7, 0x07, 0x07, 0xc5, 0x08, 0xdf, 0xc5, 0xea, 0x07, 0x06, 0x04, 0x03, 0xd9, 0x05, 0x00, 0x00, 0x01, 0x02, 0x00, 0xe1, 0x22, 0x2b, 0x24, 0x2a, 0x2a, 0x15, 0x35, 0xe7, 0xe7, 0x00, 0x00, 0x01, 0x06, 0x09, 0x0c, 0xdf, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xe7, 0x01, 0x00, 0x00, 0x00, 0xc6, 0x26, 0x32, 0x2f, 0x2f, 0x31, 0x31, 0x31, 0x31, 0x33, 0xed, 0x1c, 0x08, 0x00, 0x01, 0x00, 0x5d, 0x24, 0x18, 0xe1, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x35, 0x00, 0x00, 0x16, 0x2a, 0xed, 0x28, 0x29, 0x1b, 0x35, 0x35, 0x00, 0x00, 0xdc, 0x28, 0x27, 0x2a, 0x24, 0x35, 0x00, 0x1c, 0xd4, 0xed, 0x1e, 0x00, 0x00, 0x00, 0x0d, 0x26, 0x2a, 0xc8, 0x17, 0x00, 0x00, 0x35, 0x00, 0x0f, 0x2c, 0x29, 0x2d, 0x27, 0x0c, 0x3d, 0x03, 0xe1, 0xe8, 0x1f, 0x1e, 0xe8, 0x0b, 0x08, 0x42, 0xc5, 0x04, 0x07, 0x0f, 0xe4, 0x27, 0x26, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x04, 0xc6, 0x2c, 0x28, 0x27, 0xed, 0x1c, 0xe7, 0x00, 0x04, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x0b, 0x3d, 0xd9, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x10, 0x19, 0xe6, 0x20, 0x1e, 0x1d, 0x17, 0x12, 0x08, 0x00, 0x00, 0x35, 0x35, 0x00, 0xc5, 0x03, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x35, 0x35, 0x35, 0x00, 0x00, 0x12, 0xed, 0x2a, 0x26, 0x2a, 0x22, 0xe7, 0x00, 0x06, 0x35, 0x01, 0x15, 0xc8, 0x25, 0x2e, 0x17, 0x00, 0x05, 0x25, 0x28, 0xed, 0xc6, 0x00, 0x01, 0x00, 0x0d, 0x2b, 0x26, 0x2c, 0x18, 0x00, 0x01, 0x00, 0x35, 0x01, 0xe6, 0x2b, 0x26, 0x2c, 0x19, 0x00, 0xe7, 0x00, 0x12, 0x2b, 0x2c, 0x2e, 0x17, 0x00, 0x35, 0x00, 0x04, 0x00, 0x00, 0x1a, 0xed, 0x28, 0x2e, 0x12, 0xd9, 0x00, 0x03, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2a, 0x27, 0xed, 0x29, 0xc7, 0x07, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x35, 0x00, 0x02, 0x0d, 0xfb, 0xec, 0x04, 0x00, 0x05, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0xdc, 0x35, 0x00, 0x01, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x16, 0x2a, 0xed, 0x27, 0x2b, 0xc7, 0x03, 0x01, 0x04, 0x00, 0x35, 0x04, 0xfb, 0x2a, 0x28, 0x28, 0xc5, 0x00, 0x0c, 0x29, 0xed, 0x2b, 0x10, 0x00, 0x35, 0x00, 0xf7, 0x2a, 0x26, 0x2c, 0x19, 0x00, 0xe7, 0x00, 0x35, 0x00, 0x0f, 0x2a, 0x27, 0x29, 0x24, 0x35, 0x01, 0x35, 0x03, 0x19, 0xed, 0x26, 0x29, 0x10, 0x00, 0xe7, 0x00, 0x03, 0x00, 0x07, 0x26, 0x28, 0x29, 0x25, 0x3d, 0x35, 0x00, 0x35, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x1d, 0xed, 0x29, 0xed, 0x28, 0x0f, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x07, 0x17, 0xed, 0x31, 0x33, 0x26, 0xc5, 0x35, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x06, 0x04, 0xe7, 0x35, 0x00, 0x00, 0x00, 0x04, 0xe7, 0x02, 0x00, 0x00, 0xc6, 0x2a, 0x27, 0xed, 0x2a, 0x26, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x2e, 0x26, 0xc8, 0x1b, 0x00, 0x35, 0x17, 0x2b, 0x2a, 0x29, 0xc4, 0x35, 0x00, 0x00, 0x09, 0x29, 0x27, 0x2b, 0x1b, 0x00, 0x35, 0x00, 0x35, 0x00, 0x01, 0x22, 0x2a, 0x26, 0x2d, 0x0d, 0x35, 0x00, 0x35, 0xe7, 0x21, 0xed, 0x2f, 0x24, 0x09, 0x00, 0x00, 0x35, 0x02, 0x00, 0x16, 0x2c, 0x26, 0x30, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x0b, 0x2b, 0x29, 0x29, 0x2c, 0xec, 0x00, 0xe7, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x0c, 0x1f, 0x2a, 0x27, 0xed, 0xc8, 0x31, 0x2e, 0x0a, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x35, 0xe7, 0x05, 0x03, 0x00, 0x00, 0x35, 0x05, 0x02, 0x00, 0x00, 0x00, 0x3d, 0xe4, 0x2e, 0x29, 0x2a, 0x28, 0xc7, 0x11, 0x00, 0x01, 0x04, 0x00, 0xd9, 0x03, 0xc7, 0x28, 0x26, 0x2b, 0xe1, 0x35, 0x02, 0xec, 0xed, 0x2a, 0xe5, 0x35, 0x00, 0x01, 0x00, 0xea, 0x28, 0x29, 0x2a, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x5d, 0x2d, 0x26, 0x2c, 0x1c, 0x00, 0x00, 0x02, 0x00, 0x0f, 0xed, 0x27, 0x2c, 0x1d, 0x35, 0x03, 0x00, 0x35, 0xe7, 0x00, 0xfb, 0xed, 0x28, 0xed, 0x0c, 0x00, 0x02, 0x35, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1c, 0x2c, 0x26, 0x29, 0x27, 0x0d, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x02, 0x35, 0x00, 0x35, 0x16, 0x2a, 0x2d, 0x26, 0x2b, 0xed, 0x2b, 0x2b, 0x2f, 0x2c, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0xd9, 0x00, 0x35, 0x00, 0x00, 0x00, 0x04, 0xe8, 0x2a, 0xed, 0x26, 0xed, 0x26, 0x29, 0x0f, 0x00, 0xe7, 0x00, 0x03, 0x01, 0x00, 0x17, 0x2b, 0x25, 0x2b, 0x1f, 0x35, 0x35, 0xf7, 0x29, 0x28, 0xed, 0x1b, 0x35, 0x00, 0x02, 0x00, 0x42, 0x26, 0xed, 0xed, 0x1f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x35, 0x05, 0x27, 0x27, 0x28, 0x28, 0x03, 0x00, 0x00, 0x3d, 0x00, 0x1a, 0xed, 0x26, 0x2b, 0x15, 0x00, 0x02, 0x00, 0x03, 0x00, 0x0e, 0x2c, 0xc7, 0x2e, 0x1e, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x28, 0x29, 0x25, 0x2c, 0x1d, 0x00, 0x01, 0x00, 0x35, 0x01, 0x00, 0xe7, 0x00, 0x06, 0x1b, 0x2c, 0x2b, 0x26, 0x26, 0x28, 0x26, 0x30, 0x2f, 0x2f, 0x32, 0x2a, 0xdf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x02, 0x04, 0x35, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xfb, 0x2b, 0x29, 0x26, 0x27, 0x2d, 0xc7, 0x05, 0x00, 0x35, 0x00, 0x01, 0x00, 0x01, 0x42, 0x27, 0x26, 0x2b, 0x2b, 0x0d, 0x00, 0x00, 0x18, 0x2d, 0x29, 0xed, 0x12, 0xe7, 0x00, 0x02, 0x00, 0x05, 0xc7, 0x2a, 0x29, 0x23, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x1d, 0x28, 0xed, 0x2a, 0x10, 0x00, 0x00, 0x35, 0x00, 0x08, 0x27, 0x28, 0x2a, 0x25, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0xec, 0x2c, 0x27, 0x29, 0x0e, 0x00, 0x00, 0x00, 0x35, 0x00, 0x02, 0x00, 0x16, 0x2b, 0x26, 0x28, 0x2b, 0x0d, 0x00, 0xe7, 0x35, 0x00, 0x03, 0x01, 0x00, 0xea, 0x22, 0x2d, 0x27, 0x27, 0x29, 0x29, 0xed, 0x2a, 0x24, 0x2a, 0x21, 0x1c, 0x17, 0x0f, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x01, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x42, 0xea, 0x0a, 0xe8, 0x1c, 0x22, 0xed, 0x27, 0x29, 0xed, 0x2a, 0x2b, 0x19, 0x35, 0x02, 0x00, 0x01, 0x00, 0xd9, 0x03, 0x00, 0x20, 0xed, 0x25, 0x2c, 0x1c, 0x02, 0x00, 0x05, 0xc7, 0x2a, 0xed, 0x26, 0xc4, 0x35, 0x35, 0x00, 0x00, 0x01, 0x22, 0x2a, 0x28, 0x26, 0x06, 0x00, 0x01, 0x35, 0x00, 0x00, 0x00, 0x10, 0x29, 0x2a, 0xed, 0x1c, 0x00, 0x04, 0x00, 0xd9, 0x00, 0x18, 0xc8, 0x26, 0x2c, 0x18, 0x02, 0x01, 0x00, 0x35, 0x35, 0x0e, 0x2a, 0x27, 0x28, 0xec, 0x00, 0xd9, 0x00, 0x35, 0x00, 0x35, 0x01, 0x22, 0x29, 0x27, 0x2b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x0b, 0x27, 0x27, 0x28, 0x27, 0x27, 0x2a, 0x2a, 0x25, 0x17, 0x10, 0x01, 0xea, 0xea, 0x05, 0x07, 0x0b, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xed, 0xd4, 0x2a, 0x2b, 0xed, 0xd4, 0x29, 0x2a, 0x2b, 0x24, 0x11, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0xe7, 0x01, 0x14, 0xed, 0x29, 0x2b, 0x26, 0x09, 0x02, 0x00, 0x12, 0xc8, 0x26, 0xed, 0xe5, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0xe4, 0xed, 0x29, 0x28, 0xea, 0x00, 0x02, 0x00, 0x35, 0x00, 0x00, 0x04, 0x27, 0x27, 0x28, 0x25, 0xe7, 0x35, 0x02, 0x00, 0x35, 0xc4, 0x26, 0x29, 0x29, 0x26, 0xf7, 0x00, 0x02, 0x00, 0x35, 0xe7, 0x22, 0x2a, 0x27, 0x29, 0x0c, 0x00, 0x35, 0x00, 0x01, 0x00, 0xea, 0xed, 0x29, 0x27, 0x2d, 0x15, 0x00, 0xe7, 0xe7, 0x00, 0x03, 0x35, 0x08, 0x27, 0xed, 0xed, 0x27, 0xed, 0x2d, 0xc7, 0x14, 0x03, 0x00, 0x00, 0xdf, 0xc5, 0x08, 0xe1, 0xdf, 0x0c, 0x02, 0xe7, 0x35, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2e, 0x26, 0x26, 0x28, 0xed, 0x2c, 0x29, 0x22, 0x16, 0x04, 0x00, 0x00, 0x02, 0x01, 0x00, 0x35, 0x01, 0x00, 0x0c, 0x29, 0x2a, 0x26, 0x2d, 0xc6, 0x00, 0x35, 0x35, 0x22, 0x2a, 0x26, 0x2a, 0x18, 0x00, 0x01, 0x35, 0x00, 0x35, 0x01, 0x1b, 0x2c, 0x2a, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1a, 0x2e, 0x26, 0x2a, 0x0a, 0x00, 0xd9, 0x00, 0x00, 0x02, 0x17, 0x2b, 0x27, 0x2a, 0x1d, 0x00, 0x00, 0x03, 0x00, 0x35, 0x10, 0x2c, 0xed, 0xed, 0xe6, 0x00, 0x00, 0x00, 0x35, 0x00, 0xe8, 0xed, 0x26, 0x2b, 0x26, 0x3d, 0x35, 0x35, 0x00, 0xd9, 0x00, 0x0a, 0x27, 0x2a, 0xed, 0x28, 0x2b, 0x27, 0xc6, 0x03, 0x00, 0x00, 0x02, 0x00, 0x05, 0xdf, 0xea, 0xea, 0x0a, 0xc5, 0xe1, 0x35, 0x01, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2b, 0x2b, 0x2d, 0x2b, 0x22, 0x1c, 0x12, 0x05, 0x00, 0x00, 0xd9, 0x35, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc4, 0x24, 0x2b, 0xc7, 0x2a, 0x22, 0x06, 0xd9, 0x00, 0xe1, 0x26, 0x28, 0x28, 0x28, 0x0d, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x35, 0x19, 0x2b, 0x29, 0x2a, 0x14, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x2b, 0x26, 0x2b, 0xe8, 0x00, 0x01, 0x00, 0x35, 0x00, 0x09, 0x26, 0x28, 0x28, 0x27, 0x0b, 0x00, 0x00, 0x35, 0x00, 0x3d, 0x23, 0xed, 0x2a, 0x25, 0x09, 0x01, 0x35, 0x35, 0x35, 0x1b, 0x2b, 0x28, 0xed, 0x1c, 0x35, 0x00, 0xe7, 0x00, 0x00, 0x09, 0x20, 0x2c, 0x25, 0xed, 0x28, 0x1f, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x35, 0x07, 0x0b, 0x09, 0xea, 0xea, 0xdc, 0xf7, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x16, 0xec, 0x1b, 0xc6, 0x0d, 0x05, 0x01, 0x00, 0x02, 0xe7, 0x00, 0x00, 0x01, 0x35, 0x00, 0x35, 0x35, 0xe7, 0xec, 0x27, 0x28, 0x2a, 0xed, 0x0f, 0x00, 0xe7, 0x35, 0x1b, 0x2b, 0x27, 0x2b, 0xe5, 0x00, 0x35, 0xe7, 0x00, 0x01, 0x35, 0x00, 0x16, 0xed, 0x28, 0x2b, 0x17, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x29, 0x2b, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x35, 0x00, 0x1c, 0x2a, 0x27, 0x2c, 0x1b, 0x00, 0x00, 0x35, 0x00, 0x00, 0xe8, 0x2c, 0x29, 0x2a, 0x18, 0x35, 0x00, 0x00, 0x03, 0xe5, 0x2b, 0xed, 0x29, 0x14, 0x00, 0xe7, 0x00, 0x04, 0x03, 0x1d, 0xc8, 0x27, 0x2b, 0x2c, 0xc6, 0x02, 0x00, 0xe7, 0x01, 0x00, 0x00, 0x00, 0x35, 0x08, 0xdf, 0xdc, 0x07, 0x0c, 0x11, 0x1e, 0xe8, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3d, 0x00, 0x35, 0x01, 0x00, 0x00, 0x00, 0x35, 0xd9, 0x01, 0x00, 0x00, 0x35, 0x02, 0x00, 0x02, 0x20, 0x2a, 0x26, 0x2b, 0x28, 0xc6, 0x00, 0x03, 0x00, 0x0a, 0x27, 0x2a, 0x29, 0x2a, 0x1a, 0x00, 0x02, 0x01, 0x00, 0xe7, 0x35, 0x00, 0x11, 0x2a, 0x27, 0x2c, 0x1c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x2b, 0xed, 0xe5, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0xed, 0x2a, 0x27, 0x27, 0xdf, 0x35, 0x00, 0x00, 0x01, 0x3d, 0x2a, 0x28, 0xed, 0x25, 0x04, 0x00, 0x00, 0xc4, 0x29, 0x29, 0xed, 0x25, 0xc5, 0x35, 0x35, 0xd9, 0x00, 0x19, 0x2b, 0x25, 0x2c, 0x25, 0x13, 0x04, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x35, 0x01, 0xd9, 0x06, 0xea, 0x0c, 0x17, 0x22, 0x2a, 0x33, 0xc7, 0x05, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x07, 0x1f, 0x2b, 0x28, 0x2a, 0x29, 0xe6, 0x02, 0x00, 0xdc, 0x00, 0x1a, 0x2b, 0x27, 0x29, 0x27, 0x0c, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x29, 0x28, 0x2b, 0x21, 0x01, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0x00, 0x18, 0x2c, 0x27, 0x29, 0x0c, 0x00, 0x35, 0x00, 0x35, 0x00, 0x01, 0xfb, 0x2c, 0xc7, 0x2b, 0x17, 0x00, 0x00, 0x35, 0x01, 0x00, 0x1d, 0x2a, 0x27, 0xc8, 0x13, 0x35, 0x02, 0x0f, 0x2c, 0x28, 0x2a, 0x20, 0x35, 0x00, 0x00, 0xe7, 0x0d, 0x2b, 0x28, 0x2b, 0x25, 0x10, 0x00, 0x35, 0x02, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x03, 0xe1, 0x18, 0x27, 0x33, 0x33, 0x2f, 0x31, 0x2c, 0x0e, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xd9, 0xe7, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x01, 0xe7, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x22, 0xed, 0x2a, 0xed, 0x27, 0x24, 0x05, 0xe7, 0x02, 0x00, 0x09, 0x29, 0x27, 0x27, 0x2b, 0x23, 0x01, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x27, 0xed, 0xed, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x0f, 0x2a, 0x26, 0x2b, 0x13, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x18, 0x2b, 0x29, 0x27, 0xc7, 0x35, 0x00, 0x01, 0x35, 0x35, 0x0e, 0x2b, 0x29, 0xed, 0x20, 0x01, 0x00, 0xc6, 0x2b, 0x29, 0x2b, 0x18, 0x00, 0x00, 0x00, 0x03, 0x28, 0x29, 0x2b, 0x29, 0x0a, 0x02, 0xd9, 0x35, 0x00, 0x35, 0x04, 0x35, 0x00, 0x00, 0x00, 0xe8, 0x29, 0x31, 0x30, 0xc8, 0x2c, 0x30, 0x2d, 0x2e, 0xe8, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x08, 0x00, 0x00, 0x35, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x15, 0x24, 0x2c, 0x27, 0x27, 0x2b, 0x27, 0x09, 0x01, 0x00, 0x35, 0x35, 0x1a, 0x2b, 0x27, 0x29, 0x2b, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x06, 0xc7, 0x2a, 0x28, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0xc4, 0x26, 0x28, 0x2b, 0x17, 0x00, 0x35, 0x01, 0x00, 0x01, 0x35, 0xe1, 0x27, 0x2b, 0x27, 0x2b, 0x0d, 0x00, 0x35, 0x01, 0x02, 0xd9, 0xc7, 0x2a, 0x26, 0x28, 0x0a, 0x00, 0x1b, 0x2a, 0xd4, 0xed, 0x10, 0x35, 0x35, 0xe7, 0x1a, 0x2d, 0x26, 0x27, 0x0c, 0x00, 0x00, 0x00, 0xe7, 0xe7, 0x00, 0x00, 0x00, 0x04, 0xe1, 0x22, 0x2b, 0x30, 0x2f, 0x2f, 0x2e, 0x2c, 0x2e, 0x30, 0x32, 0x1c, 0x00, 0x00, 0xe7, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xe7, 0xe7, 0x00, 0x00, 0x35, 0x01, 0x35, 0x03, 0x35, 0x00, 0xc5, 0x1c, 0xed, 0x2b, 0x26, 0x2c, 0x28, 0x25, 0x11, 0x00, 0x35, 0x01, 0x00, 0x11, 0x27, 0x27, 0x2a, 0x27, 0x28, 0x0c, 0x01, 0x00, 0x00, 0x03, 0x00, 0xe7, 0x00, 0x00, 0x01, 0x23, 0x2b, 0x26, 0x2b, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x23, 0x2a, 0x2a, 0x1e, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x24, 0xed, 0x28, 0x2b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x2a, 0x29, 0x2c, 0xe8, 0x01, 0x21, 0xed, 0x29, 0x27, 0x08, 0x35, 0x00, 0x0d, 0x29, 0x26, 0x2b, 0x12, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x02, 0x16, 0xed, 0xed, 0x30, 0x30, 0x2b, 0x2d, 0x2f, 0x2d, 0x2e, 0x2b, 0x33, 0xc7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x03, 0x00, 0x03, 0xe7, 0x00, 0x01, 0x00, 0x01, 0xc4, 0x17, 0x29, 0x2b, 0x26, 0x2a, 0x26, 0xed, 0x29, 0x0b, 0xe7, 0x00, 0x00, 0x01, 0xe7, 0x23, 0xed, 0x27, 0x28, 0xed, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x2b, 0x29, 0x2a, 0xe8, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35, 0x1c, 0x2b, 0x2a, 0x24, 0x02, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x18, 0xc8, 0x28, 0x2a, 0xc7, 0x07, 0x00, 0x00, 0xe7, 0x00, 0x0f, 0x2c, 0x29, 0x29, 0xfb, 0x06, 0x25, 0x28, 0x26, 0x24, 0x02, 0x00, 0x03, 0x1f, 0x2d, 0xed, 0xe8, 0x35, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xe4, 0x2e, 0x27, 0xc8, 0x2e, 0x2f, 0x2d, 0x2d, 0x31, 0x32, 0x33, 0x30, 0x2d, 0x20, 0x04, 0x00, 0x35, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc4, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x17, 0x26, 0x2b, 0x27, 0xed, 0x2b, 0x24, 0x2c, 0x28, 0x42, 0x03, 0x00, 0x04, 0x35, 0x00, 0xe8, 0x27, 0x29, 0x28, 0x27, 0x2b, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x2a, 0x28, 0x2a, 0x1a, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x19, 0x2a, 0xed, 0x26, 0xc4, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2a, 0x27, 0x2a, 0xed, 0x0e, 0x00, 0x01, 0x00, 0x00, 0xdc, 0x25, 0xed, 0x2a, 0x27, 0x11, 0x26, 0xed, 0x2c, 0x1b, 0x00, 0x35, 0x0f, 0x2a, 0x28, 0x1c, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x10, 0x25, 0x2b, 0x27, 0x2a, 0x2d, 0x2e, 0x30, 0x32, 0x31, 0x29, 0x1d, 0xe8, 0x11, 0x0f, 0x0d, 0x02, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x09, 0x16, 0x20, 0xed, 0x2d, 0x2b, 0x29, 0xed, 0x27, 0x25, 0x2b, 0x23, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x25, 0x2b, 0x26, 0xed, 0x27, 0x2b, 0x0b, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x29, 0x28, 0x2a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x5d, 0x2a, 0x27, 0xed, 0x0f, 0xe7, 0x00, 0x00, 0x00, 0x35, 0x00, 0x06, 0x25, 0x27, 0xed, 0x2d, 0x17, 0x01, 0xe7, 0x00, 0x00, 0x00, 0x1d, 0x2b, 0xed, 0x2a, 0xec, 0x26, 0x28, 0x2c, 0xc6, 0x00, 0x03, 0x1e, 0x2e, 0x21, 0x35, 0xd9, 0x00, 0x00, 0xe7, 0x02, 0x03, 0x00, 0x12, 0xed, 0x2d, 0x26, 0x29, 0x30, 0x31, 0x30, 0xed, 0x1e, 0x14, 0xdf, 0xc5, 0x0c, 0xdf, 0x06, 0x09, 0x3d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x12, 0x1c, 0xec, 0x2a, 0xed, 0x2c, 0x28, 0x26, 0x27, 0x26, 0x25, 0xc8, 0x2c, 0xe4, 0xea, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x21, 0x2a, 0x2a, 0x25, 0xed, 0xed, 0x26, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xed, 0x28, 0x2a, 0xc7, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x29, 0x27, 0x2c, 0x16, 0x00, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x1f, 0xed, 0x29, 0x2c, 0xec, 0xd9, 0x00, 0x00, 0xe7, 0x00, 0xe8, 0xc8, 0x27, 0xd4, 0x2b, 0x25, 0x29, 0x27, 0x14, 0x01, 0x0a, 0x2d, 0xc7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x19, 0x2a, 0x2b, 0x27, 0x29, 0x2e, 0x2f, 0x25, 0x19, 0xf7, 0x06, 0x08, 0xea, 0x42, 0xdc, 0xf7, 0xea, 0x0c, 0xd9, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x1a, 0x2d, 0xed, 0xed, 0x26, 0x27, 0x2a, 0x26, 0xed, 0xc8, 0x2a, 0x25, 0x17, 0x35, 0x00, 0x01, 0x01, 0x35, 0x00, 0x00, 0xe8, 0x2a, 0x27, 0xed, 0x26, 0x28, 0x2b, 0xe6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xed, 0xed, 0x28, 0x28, 0x05, 0x00, 0x00, 0x35, 0x00, 0x00, 0x02, 0x00, 0xc4, 0x28, 0x27, 0xc8, 0x18, 0x00, 0x00, 0x01, 0x00, 0x35, 0xe7, 0x00, 0x17, 0x2b, 0x29, 0x27, 0x29, 0xc4, 0x00, 0x35, 0x35, 0x00, 0x0b, 0x2b, 0x25, 0x29, 0xed, 0x27, 0x2b, 0x27, 0x09, 0x00, 0x1b, 0xc8, 0x0e, 0x04, 0x00, 0x35, 0x04, 0x00, 0x02, 0x00, 0x1b, 0x26, 0x2c, 0x26, 0x28, 0x30, 0x26, 0xe8, 0x09, 0xc4, 0xc4, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0xc4, 0x42, 0x0b, 0xe7, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x35, 0x13, 0xed, 0x28, 0x2a, 0x29, 0x28, 0x29, 0x2a, 0x28, 0x29, 0xfb, 0x5d, 0x02, 0xe7, 0xe7, 0x00, 0x35, 0x35, 0x00, 0x0e, 0x2e, 0x25, 0x27, 0xed, 0x29, 0x27, 0x2a, 0x18, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xed, 0x2a, 0x27, 0xed, 0xe1, 0x00, 0x00, 0x35, 0x00, 0x00, 0x01, 0x00, 0x04, 0x25, 0x29, 0x2b, 0x1c, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x0f, 0x2b, 0x28, 0x25, 0x2d, 0x11, 0x00, 0x01, 0x00, 0x00, 0x04, 0xc7, 0x28, 0xed, 0x27, 0xed, 0xed, 0x26, 0x35, 0x04, 0x2b, 0x19, 0xe7, 0x00, 0x01, 0x00, 0x00, 0xd9, 0x00, 0x1b, 0xed, 0x2a, 0x26, 0x27, 0x27, 0x1b, 0x0b, 0xea, 0xc5, 0xc5, 0x09, 0x0a, 0x09, 0xc5, 0x42, 0xc5, 0x0a, 0xc5, 0x0b, 0x04, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x2b, 0x27, 0xc7, 0x29, 0xed, 0x27, 0xed, 0x2b, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x35, 0xe1, 0x26, 0x25, 0xed, 0x28, 0x28, 0xed, 0x28, 0x2a, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x07, 0x28, 0xed, 0x27, 0x2a, 0x13, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe5, 0xed, 0x2a, 0xec, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x29, 0x29, 0x26, 0x2e, 0x19, 0x00, 0x01, 0x00, 0x00, 0x35, 0x1b, 0x2c, 0x28, 0xed, 0x28, 0xed, 0x21, 0x00, 0x12, 0xe5, 0x04, 0x35, 0x00, 0xe7, 0x00, 0x03, 0x35, 0x19, 0x2c, 0x27, 0x27, 0xc8, 0x23, 0x0b, 0x05, 0xe1, 0xc5, 0xea, 0xdf, 0xdf, 0xea, 0xea, 0xdf, 0xc5, 0xea, 0xea, 0x08, 0xea, 0x00, 0x35, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x08, 0x27, 0x2a, 0x29, 0x2a, 0x27, 0x2c, 0x22, 0x0e, 0x00, 0x35, 0x00, 0x00, 0xe7, 0xe7, 0x00, 0xe7, 0x00, 0x20, 0x2b, 0x26, 0xed, 0xd4, 0x25, 0x29, 0xed, 0x2a, 0x1a, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd9, 0x27, 0xed, 0x27, 0x2b, 0xc6, 0x00, 0x01, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0xec, 0xed, 0x2a, 0xfb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x26, 0x28, 0x29, 0x2b, 0x1e, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x17, 0x2d, 0x26, 0xed, 0x27, 0x2e, 0x1d, 0x01, 0x18, 0x0e, 0x00, 0x35, 0x00, 0x35, 0x02, 0x00, 0x17, 0x2b, 0x26, 0x2c, 0x25, 0x16, 0x04, 0x3d, 0xe1, 0x09, 0xea, 0xdf, 0x0a, 0xc5, 0xc4, 0xea, 0x0a, 0x0a, 0xea, 0xc5, 0xe1, 0xe1, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x21, 0x2a, 0x29, 0x2a, 0x25, 0xe8, 0xe7, 0x00, 0x35, 0xe7, 0x00, 0xd9, 0x00, 0x00, 0x35, 0x02, 0x1a, 0x2e, 0x28, 0x29, 0x29, 0x28, 0xc8, 0x26, 0x28, 0x2b, 0x25, 0xc4, 0x00, 0x01, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xe5, 0xed, 0x27, 0x2b, 0x19, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x35, 0x01, 0x1c, 0x2a, 0x29, 0x25, 0x3d, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x2b, 0x27, 0x2a, 0x25, 0x03, 0x35, 0x00, 0x02, 0x00, 0x0e, 0x2d, 0x27, 0x2a, 0x28, 0xed, 0x18, 0xe7, 0xe1, 0x02, 0x00, 0x00, 0x04, 0x00, 0x35, 0x12, 0x2b, 0x29, 0x2a, 0x22, 0x0a, 0x01, 0x0a, 0x09, 0xea, 0x0a, 0xea, 0x08, 0xea, 0x0a, 0x0a, 0xdf, 0xea, 0xdf, 0x09, 0xea, 0xdf, 0x0b, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0xec, 0x2b, 0xe5, 0x17, 0x03, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x1a, 0x2e, 0xc7, 0x26, 0x2a, 0x2a, 0x22, 0x1d, 0x2b, 0x28, 0x27, 0x28, 0x1b, 0x00, 0x01, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0xe7, 0x22, 0xed, 0x28, 0x2b, 0x1b, 0x00, 0x35, 0x00, 0x35, 0x00, 0x00, 0x35, 0x35, 0x1c, 0x2a, 0x29, 0x27, 0xc4, 0x00, 0xe7, 0x00, 0x00, 0x35, 0x00, 0x01, 0x1c, 0x2b, 0x27, 0xed, 0x27, 0x07, 0x00, 0x00, 0x01, 0x00, 0xf7, 0x2a, 0x27, 0x27, 0x27, 0x2c, 0xc6, 0x00, 0x02, 0x00, 0xd9, 0x01, 0x00, 0x02, 0xe1, 0x30, 0x27, 0x28, 0x1c, 0x06, 0x02, 0xc5, 0x0c, 0x08, 0x07, 0x0a, 0xc4, 0xe1, 0x0a, 0x09, 0xea, 0xea, 0xea, 0xc5, 0x09, 0xe1, 0x0c, 0x0c, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x35, 0x00, 0x35, 0xe7, 0x03, 0x15, 0x2b, 0x29, 0xed, 0x2b, 0xed, 0x1a, 0x02, 0x04, 0x1a, 0x2b, 0xed, 0x2c, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x20, 0x2a, 0x27, 0x2b, 0x1f, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x2a, 0xed, 0x28, 0x09, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2b, 0x27, 0xed, 0x2a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x25, 0x28, 0x28, 0x26, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x27, 0x28, 0xed, 0xc6, 0x02, 0x03, 0x07, 0x0a, 0xea, 0x07, 0x0a, 0x0b, 0xea, 0x42, 0xea, 0xea, 0xdf, 0x09, 0xdf, 0xea, 0x08, 0x04, 0xe1, 0x0e, 0xe7, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x07, 0x05, 0x00, 0x35, 0xe7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x17, 0x2e, 0x26, 0x29, 0x2a, 0x26, 0x16, 0x00, 0x00, 0x00, 0x04, 0xe4, 0x2b, 0x28, 0x27, 0x17, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x2b, 0x27, 0x2b, 0x22, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x2a, 0xed, 0xed, 0x0b, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0xe8, 0x2b, 0x28, 0x28, 0x2c, 0x13, 0x00, 0x35, 0x00, 0x00, 0xe7, 0x22, 0xed, 0x29, 0x27, 0x2b, 0x0e, 0x35, 0xe7, 0x00, 0x00, 0x35, 0x03, 0x1e, 0x2d, 0x29, 0x12, 0x00, 0x03, 0xe1, 0xe1, 0x0a, 0xea, 0xdf, 0x09, 0x09, 0x09, 0x08, 0x07, 0x08, 0xea, 0xe1, 0x0d, 0x12, 0x14, 0x11, 0x11, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x3d, 0x42, 0x35, 0x35, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0xd9, 0x18, 0x2a, 0x29, 0xed, 0x2b, 0x25, 0xe1, 0x05, 0x00, 0x04, 0x02, 0x00, 0x0a, 0x27, 0x25, 0x2a, 0xc7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x35, 0x00, 0x1c, 0x2b, 0x27, 0x2a, 0x24, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x2b, 0x29, 0x2b, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x13, 0x2c, 0x29, 0x26, 0x2c, 0xc6, 0x00, 0x35, 0x00, 0x35, 0x00, 0x1d, 0x2b, 0x27, 0xed, 0x2b, 0xdf, 0x00, 0x00, 0xe7, 0x02, 0x35, 0x16, 0x2f, 0x26, 0x0f, 0x02, 0x05, 0x0b, 0x09, 0x0a, 0xea, 0xea, 0x0a, 0xc4, 0x06, 0x42, 0x0f, 0xe8, 0x1d, 0x26, 0x2b, 0xc8, 0x2c, 0x2b, 0xc8, 0x1a, 0xe1, 0x02, 0x35, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0xe7, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x07, 0x1b, 0x2b, 0x28, 0x29, 0xd4, 0x24, 0x0c, 0xd9, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0xc6, 0x2c, 0x2b, 0x26, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x1a, 0x2b, 0x27, 0xed, 0x25, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x1b, 0x2b, 0x28, 0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x10, 0x2b, 0x29, 0x26, 0x2b, 0x1a, 0x00, 0x00, 0x35, 0x00, 0x00, 0x1a, 0x2c, 0x27, 0x2a, 0xed, 0x42, 0x00, 0xe7, 0x00, 0x00, 0x0c, 0x27, 0x26, 0x0c, 0x00, 0x3d, 0x10, 0x06, 0x05, 0x0a, 0x0b, 0x08, 0x06, 0xf7, 0x17, 0x23, 0x2e, 0x30, 0x31, 0x30, 0x2f, 0x2e, 0x30, 0x31, 0x34, 0x18, 0x42, 0x07, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x05, 0xe7, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x08, 0xe6, 0x30, 0x26, 0x28, 0x2b, 0x23, 0x09, 0x35, 0x00, 0x00, 0x00, 0x01, 0x35, 0x02, 0x00, 0x02, 0xc7, 0x2a, 0x29, 0x1a, 0x01, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x1a, 0x2b, 0x28, 0x29, 0x25, 0x02, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x1b, 0x2c, 0x27, 0x2a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x0d, 0x2b, 0x29, 0x27, 0x2b, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x17, 0x2c, 0x29, 0xed, 0x26, 0xea, 0x01, 0x02, 0x00, 0x03, 0x21, 0xed, 0x0c, 0x00, 0x0c, 0x0b, 0xe7, 0xf7, 0x0e, 0x07, 0x03, 0x0c, 0x1c, 0x2a, 0x31, 0x32, 0x2e, 0x2f, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x27, 0x0e, 0x07, 0x0b, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x3d, 0x02, 0xe7, 0x00, 0x00, 0x03, 0x00, 0xc5, 0x29, 0x2d, 0x25, 0xed, 0x2a, 0x21, 0xc4, 0x00, 0x35, 0x00, 0xe7, 0x00, 0x00, 0x35, 0x00, 0x35, 0x02, 0xe8, 0x2b, 0x2a, 0x23, 0x04, 0x00, 0xe7, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x19, 0x2a, 0x29, 0x28, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x1b, 0x2c, 0x27, 0x2a, 0x0f, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x29, 0x28, 0x2c, 0x1c, 0x01, 0x00, 0xe7, 0x00, 0x35, 0x16, 0x2b, 0x28, 0xed, 0xc7, 0x07, 0x00, 0x00, 0xd9, 0x16, 0x2d, 0xe1, 0x03, 0xdf, 0xdf, 0x42, 0xdf, 0x0a, 0x06, 0x0b, 0x1b, 0x2b, 0x32, 0x2f, 0x2c, 0x2c, 0x2d, 0xc8, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0xc7, 0xe1, 0x05, 0x0d, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x03, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x16, 0x2a, 0x2a, 0x27, 0x2b, 0x22, 0xe1, 0x00, 0x35, 0xe7, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x42, 0xc7, 0x2b, 0xed, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x1a, 0x2b, 0x27, 0x2b, 0xfb, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x35, 0xe7, 0x1d, 0x2b, 0x26, 0x2b, 0x0e, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xed, 0xed, 0x27, 0x2b, 0x1d, 0x00, 0x02, 0x00, 0x35, 0x01, 0x12, 0x2c, 0xed, 0x27, 0xc7, 0x06, 0x00, 0x03, 0x07, 0x2a, 0x13, 0x02, 0xc4, 0x09, 0x42, 0x0b, 0xc4, 0x42, 0x18, 0x26, 0x32, 0x30, 0x2d, 0x31, 0x33, 0x31, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x33, 0x34, 0x1a, 0xc5, 0x19, 0xc7, 0x08, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x42, 0xc5, 0xe7, 0xe7, 0xe7, 0x06, 0x19, 0x2e, 0x24, 0x2c, 0x22, 0x05, 0x35, 0x02, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x1c, 0x2b, 0x2b, 0x16, 0x35, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2b, 0x28, 0x2b, 0xfb, 0xd9, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x01, 0x20, 0x2b, 0x26, 0x2a, 0x0d, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xed, 0x29, 0x27, 0x2b, 0x1d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x11, 0x2a, 0x28, 0x2a, 0x24, 0x35, 0x02, 0x00, 0x1c, 0xe8, 0x3d, 0x3d, 0x0c, 0xe1, 0x42, 0x42, 0x0c, 0x1f, 0x2f, 0x34, 0x34, 0x30, 0x2b, 0x26, 0x21, 0x1b, 0x18, 0x17, 0xc6, 0xe8, 0xe8, 0x17, 0x1b, 0x1d, 0x19, 0x23, 0x2f, 0x34, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x42, 0x0b, 0xc5, 0x03, 0x0b, 0x07, 0x1a, 0x2c, 0xed, 0x23, 0xf7, 0x03, 0x00, 0x00, 0x00, 0xe7, 0xe7, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0xd9, 0x00, 0x14, 0x2a, 0x2c, 0x1c, 0xe7, 0x35, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x1a, 0x2c, 0x27, 0x2a, 0xe5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0xfb, 0x2a, 0x28, 0xed, 0x0c, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xed, 0x29, 0x27, 0x2b, 0x1d, 0x00, 0x35, 0x00, 0xe7, 0x00, 0x10, 0x2b, 0x26, 0x2b, 0x23, 0x35, 0x00, 0x0e, 0x1c, 0x07, 0x04, 0x0e, 0xea, 0x3d, 0x3d, 0x11, 0x2b, 0x34, 0x31, 0x25, 0x1b, 0x5d, 0x0c, 0xea, 0x05, 0xd9, 0xdc, 0x3d, 0x3d, 0x3d, 0x05, 0x06, 0xc4, 0x0a, 0x0c, 0x2f, 0x30, 0x26, 0x15, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x04, 0x0a, 0x0c, 0xc4, 0x0d, 0x07, 0x18, 0xc8, 0x29, 0x0c, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x04, 0xdf, 0x0f, 0x00, 0x02, 0xe7, 0x00, 0x01, 0x0a, 0x26, 0x2a, 0xe5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xc8, 0x27, 0x2a, 0xec, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x01, 0xe7, 0x26, 0xed, 0x29, 0x28, 0x0a, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x11, 0xed, 0x28, 0x27, 0x2b, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x12, 0x2b, 0x27, 0x2a, 0x22, 0x35, 0x03, 0x18, 0xe1, 0xc4, 0x0b, 0x3d, 0x07, 0xdf, 0x1b, 0x34, 0x30, 0x1d, 0x12, 0x0c, 0x42, 0xc4, 0x42, 0xdf, 0x0a, 0x0d, 0xc5, 0x09, 0xf7, 0x0b, 0x0b, 0x09, 0x0a, 0xe1, 0x0a, 0xec, 0x18, 0xc5, 0xe1, 0xdc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x02, 0xc4, 0xe1, 0x0b, 0x07, 0xc5, 0x1b, 0x2b, 0x14, 0x00, 0x02, 0x00, 0x00, 0x00, 0x35, 0x03, 0x0a, 0x18, 0x27, 0x26, 0x13, 0x00, 0x01, 0x00, 0x00, 0x02, 0x21, 0x2a, 0x27, 0xc4, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x2c, 0x27, 0x2b, 0x1c, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xdc, 0x28, 0x29, 0x2a, 0xc7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x15, 0x2a, 0x27, 0x29, 0x2a, 0x1c, 0x00, 0x35, 0x00, 0xe7, 0x00, 0x12, 0xed, 0x27, 0x2b, 0x23, 0x01, 0x0d, 0x0c, 0x07, 0xdf, 0x0a, 0xdc, 0x0a, 0xe5, 0x33, 0x22, 0x12, 0x42, 0x08, 0xea, 0x09, 0x0a, 0x09, 0xea, 0xc4, 0x07, 0xea, 0x42, 0xc4, 0xc4, 0x08, 0x42, 0xe1, 0x0d, 0x00, 0x0a, 0x0e, 0x3d, 0xe1, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x02, 0x07, 0x05, 0x0c, 0xdf, 0x06, 0x1c, 0x18, 0x00, 0x35, 0x02, 0x35, 0x01, 0x00, 0x01, 0x15, 0x27, 0x30, 0xed, 0x2b, 0x24, 0x00, 0x00, 0x03, 0x00, 0x35, 0x1c, 0xed, 0x29, 0xf7, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xec, 0x2a, 0x27, 0x2c, 0x18, 0x01, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2a, 0x28, 0x2b, 0x23, 0x03, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x17, 0x2b, 0x27, 0x29, 0x2a, 0x19, 0x35, 0x35, 0x00, 0x35, 0x00, 0x13, 0x2a, 0x28, 0x2b, 0x26, 0x05, 0x0c, 0x3d, 0xc5, 0xdf, 0x0a, 0x42, 0x27, 0xc8, 0x5d, 0x07, 0x3d, 0x0a, 0x0a, 0x0a, 0xc5, 0xc4, 0xea, 0x09, 0xe1, 0xdf, 0xe1, 0x0a, 0xdf, 0xea, 0xea, 0x09, 0x0c, 0x11, 0x06, 0xe7, 0x0b, 0x07, 0x0b, 0x17, 0xea, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x02, 0x05, 0x02, 0xea, 0x0f, 0x06, 0x16, 0x05, 0x00, 0x03, 0x00, 0x02, 0x00, 0x0a, 0xec, 0x2a, 0x27, 0x26, 0x27, 0x26, 0x2a, 0x0e, 0x00, 0x05, 0x00, 0x35, 0x19, 0xc8, 0xed, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x25, 0xed, 0x27, 0x2c, 0x12, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x16, 0x2b, 0x27, 0x2b, 0x20, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x19, 0x2c, 0x27, 0x29, 0x2a, 0xe8, 0x00, 0x35, 0x00, 0x00, 0x00, 0xe8, 0xc8, 0x2b, 0xc8, 0x27, 0xc5, 0x07, 0x0a, 0x42, 0x09, 0xc5, 0x28, 0x22, 0x0d, 0xdf, 0xdf, 0xe1, 0x42, 0x42, 0x42, 0xea, 0xdf, 0x0a, 0x09, 0xea, 0xc4, 0x42, 0xea, 0xdf, 0x09, 0xdf, 0xc5, 0x0a, 0x0c, 0x04, 0x00, 0x09, 0x1b, 0x28, 0x34, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x35, 0x35, 0x02, 0x02, 0x04, 0x0c, 0x0c, 0xc4, 0xd9, 0x00, 0x02, 0x00, 0x00, 0x13, 0x25, 0x2a, 0x26, 0x2a, 0x2e, 0x27, 0xed, 0x2a, 0xe4, 0x01, 0x00, 0x00, 0x35, 0x18, 0x30, 0x2b, 0x14, 0x00, 0x35, 0x00, 0x35, 0x00, 0x03, 0x04, 0x29, 0x29, 0x27, 0x2b, 0x0b, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0xe7, 0x18, 0x2d, 0x27, 0x2b, 0x1e, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1a, 0xc8, 0x28, 0x29, 0x2a, 0x13, 0x00, 0x01, 0x00, 0x01, 0x01, 0x19, 0x31, 0xc8, 0x33, 0x25, 0x07, 0x0b, 0xea, 0x09, 0x09, 0x27, 0x20, 0xc5, 0x05, 0x0c, 0x07, 0x42, 0x09, 0xdf, 0xc5, 0x09, 0xe1, 0x0a, 0xc4, 0x08, 0xc5, 0x3d, 0xdc, 0xc4, 0xc5, 0xdf, 0x09, 0x0b, 0x0e, 0x02, 0x35, 0x0b, 0xc8, 0x34, 0x2d, 0x1a, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xe7, 0x03, 0x3d, 0x02, 0x06, 0x0c, 0x10, 0x00, 0x04, 0x00, 0x35, 0xe8, 0x2a, 0x2a, 0x25, 0x2d, 0x26, 0x1b, 0x25, 0x2a, 0x26, 0x2a, 0xc4, 0x00, 0x00, 0x00, 0x17, 0x2f, 0x32, 0x15, 0x00, 0x01, 0x00, 0xd9, 0x00, 0x00, 0x0f, 0x29, 0xed, 0x26, 0xc7, 0x03, 0x35, 0x00, 0x00, 0x02, 0x35, 0x00, 0xe7, 0xe5, 0x29, 0x2a, 0x27, 0x17, 0x00, 0x35, 0x00, 0x01, 0x00, 0x35, 0x00, 0x00, 0x23, 0x2a, 0x28, 0x2a, 0x29, 0x0e, 0x00, 0x01, 0xe7, 0x42, 0x06, 0x21, 0x2f, 0x30, 0x30, 0x23, 0x0a, 0xc4, 0xc5, 0xc5, 0x26, 0x1c, 0xdc, 0xc4, 0x0d, 0x06, 0x08, 0x0c, 0x08, 0xe1, 0xea, 0x07, 0x07, 0x08, 0x0a, 0x0e, 0x13, 0xe8, 0x15, 0x0e, 0x11, 0x07, 0x07, 0x0c, 0x0b, 0xe7, 0x00, 0x35, 0x20, 0x29, 0x0d, 0xdf, 0xe1, 0x01, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0xe7, 0x3d, 0x00, 0x06, 0x3d, 0x0f, 0x06, 0x00, 0x0a, 0x1c, 0xc8, 0x26, 0x28, 0x2c, 0x1f, 0xdc, 0x01, 0x12, 0xed, 0x2a, 0x2a, 0xe8, 0x00, 0x35, 0x35, 0x18, 0x2e, 0x31, 0x19, 0x06, 0x03, 0x00, 0x00, 0x35, 0x00, 0x16, 0x2a, 0x27, 0x2c, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x08, 0x26, 0x2a, 0x27, 0xed, 0x0f, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0xe7, 0x03, 0xc7, 0x29, 0x27, 0x28, 0x27, 0x06, 0x03, 0xdf, 0x3d, 0x0a, 0xc4, 0x23, 0x31, 0x27, 0x34, 0x2b, 0x07, 0x0b, 0x3d, 0xe5, 0x1d, 0x03, 0x0c, 0xf7, 0x06, 0x0a, 0xf7, 0xdc, 0xe1, 0x03, 0xdf, 0x12, 0x1a, 0x23, 0x2a, 0x2f, 0x2e, 0x30, 0x30, 0x2f, 0x2a, 0xfb, 0x1c, 0x0d, 0x0c, 0x05, 0x00, 0x00, 0x08, 0x0d, 0x42, 0x0b, 0x42, 0x05, 0x02, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x07, 0x00, 0x04, 0xc6, 0x21, 0xe7, 0x07, 0x22, 0x2c, 0x27, 0x2a, 0xed, 0x1a, 0x02, 0x00, 0x01, 0x03, 0x23, 0x2a, 0xed, 0x23, 0xe7, 0x00, 0x02, 0x1a, 0x32, 0x2f, 0x17, 0x42, 0x42, 0x3d, 0x02, 0x02, 0x35, 0x1b, 0x2a, 0x26, 0x2e, 0x12, 0x35, 0x00, 0x00, 0xe7, 0x00, 0x02, 0x00, 0x13, 0x2a, 0xed, 0x27, 0x2a, 0x3d, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x01, 0xe1, 0x28, 0x29, 0xed, 0x2a, 0x26, 0xea, 0xc4, 0xea, 0xea, 0x0c, 0xe1, 0xc7, 0x34, 0x30, 0x2c, 0x26, 0x0b, 0x03, 0x1f, 0xfb, 0x07, 0x0b, 0x05, 0x08, 0x09, 0x09, 0x09, 0x07, 0xea, 0x19, 0x22, 0x2c, 0x31, 0x33, 0x33, 0x31, 0x2d, 0x2f, 0x2f, 0x33, 0x31, 0x34, 0x2f, 0x0c, 0x0a, 0x00, 0x00, 0xe7, 0x01, 0x0c, 0xdf, 0xdc, 0x0d, 0x16, 0x0e, 0x07, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x42, 0x0c, 0x1e, 0x2f, 0x29, 0x13, 0xed, 0x2b, 0x26, 0x27, 0xed, 0x15, 0x00, 0x04, 0x05, 0x00, 0x02, 0xe8, 0x29, 0x29, 0x29, 0xea, 0x00, 0x04, 0x1c, 0x33, 0x2e, 0x14, 0xc4, 0xe1, 0x0a, 0xdf, 0x06, 0xea, 0x24, 0xed, 0x29, 0x25, 0x06, 0x35, 0x00, 0x00, 0x35, 0x00, 0x35, 0x35, 0x1c, 0xed, 0x27, 0x2b, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0xe8, 0x2d, 0x2b, 0x2b, 0x31, 0x21, 0xc4, 0x0b, 0x0a, 0x06, 0x3d, 0x11, 0x2b, 0xc8, 0x2f, 0x31, 0x2b, 0x03, 0x18, 0x24, 0x0c, 0xc5, 0x0a, 0x0b, 0x0b, 0x07, 0x3d, 0xea, 0x16, 0x28, 0x30, 0x33, 0x33, 0xc8, 0xc7, 0x20, 0x1c, 0x1a, 0x17, 0x16, 0x18, 0x19, 0x24, 0x26, 0x0b, 0x0b, 0x05, 0x01, 0x00, 0x00, 0xdc, 0xea, 0x18, 0x2b, 0x2a, 0xc8, 0x2b, 0x25, 0x1a, 0x0f, 0x07, 0x02, 0x00, 0x00, 0x00, 0x35, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x35, 0xea, 0x2b, 0x28, 0x30, 0x33, 0x24, 0x2a, 0xc7, 0x2c, 0x29, 0x0e, 0x00, 0x02, 0x00, 0x00, 0xe7, 0x00, 0xea, 0xc7, 0x2b, 0x2a, 0x15, 0x00, 0x07, 0x22, 0x30, 0xc8, 0x10, 0xdf, 0xea, 0xc4, 0xe1, 0xc4, 0xe8, 0x2e, 0x2b, 0x2e, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x27, 0x27, 0xc8, 0x5d, 0x00, 0x00, 0x35, 0x00, 0x02, 0x01, 0x3d, 0x04, 0x21, 0x31, 0x2e, 0xc8, 0x33, 0x18, 0x06, 0xc4, 0xe1, 0x0a, 0x06, 0x16, 0x2f, 0x2f, 0xc8, 0x31, 0x2a, 0x0c, 0x23, 0xe8, 0xe7, 0x05, 0x3d, 0x07, 0xc5, 0x08, 0x12, 0x24, 0x31, 0x33, 0x28, 0x20, 0xc6, 0x0f, 0xe1, 0x07, 0x03, 0x03, 0x3d, 0x05, 0x05, 0x05, 0xdf, 0x11, 0x07, 0x0b, 0x03, 0x00, 0x02, 0xd9, 0x00, 0xea, 0x2a, 0x2a, 0x29, 0x27, 0x26, 0x2b, 0x2f, 0x2b, 0x22, 0x1a, 0xc5, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x07, 0x27, 0x29, 0x1d, 0x15, 0x1e, 0xed, 0x2a, 0x26, 0x0d, 0x03, 0x00, 0x35, 0x00, 0x00, 0x02, 0x01, 0x35, 0x1c, 0xc8, 0x27, 0x1d, 0x02, 0xc5, 0x26, 0x30, 0x28, 0xe1, 0x09, 0xc5, 0x07, 0xea, 0xc4, 0x21, 0x33, 0x2e, 0x2d, 0x12, 0x07, 0x06, 0x04, 0x05, 0x02, 0x06, 0x00, 0x12, 0xc8, 0x29, 0x2b, 0xed, 0xdf, 0x05, 0x06, 0x07, 0x05, 0xea, 0x42, 0xc4, 0xf7, 0x2a, 0x30, 0x30, 0x2f, 0x2d, 0x0f, 0xea, 0x07, 0xc5, 0x0a, 0x0a, 0xe4, 0x34, 0x2e, 0x2a, 0x19, 0x0d, 0x07, 0x02, 0x3d, 0x09, 0x04, 0x07, 0x35, 0x08, 0x19, 0x2b, 0x30, 0xec, 0xc6, 0x0f, 0xdf, 0x05, 0x07, 0xdf, 0xdf, 0x0a, 0x0b, 0x0b, 0xe1, 0x0a, 0xe1, 0xea, 0x0c, 0xe1, 0x0b, 0x42, 0x00, 0x35, 0xe7, 0x00, 0x07, 0x30, 0x29, 0x27, 0x29, 0xed, 0xed, 0x28, 0xed, 0x2b, 0x2e, 0x27, 0x1a, 0x09, 0x00, 0x00, 0x02, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1b, 0x0c, 0x35, 0x03, 0x15, 0x2c, 0x28, 0x0e, 0x03, 0x00, 0x00, 0x01, 0x00, 0xe7, 0x02, 0x00, 0x00, 0x11, 0xed, 0x28, 0x25, 0xc5, 0x0e, 0x2c, 0x32, 0x1e, 0x3d, 0xea, 0xdf, 0x0a, 0x07, 0x12, 0x2b, 0x32, 0x2e, 0x20, 0x0a, 0xf7, 0xdf, 0x09, 0xdf, 0x08, 0xea, 0xe1, 0x23, 0x30, 0x2b, 0x31, 0x21, 0x07, 0x09, 0x0a, 0x0a, 0x09, 0xe1, 0xe1, 0x07, 0x17, 0x30, 0x2d, 0x2f, 0x31, 0x23, 0x09, 0xc4, 0x0c, 0x0b, 0x03, 0x0b, 0x28, 0x28, 0x17, 0x04, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x06, 0x05, 0x00, 0x18, 0x27, 0x1b, 0x0e, 0x0a, 0x03, 0x07, 0x08, 0xdf, 0xe1, 0x0a, 0x42, 0xc4, 0xdf, 0xc4, 0xea, 0xc4, 0xdf, 0x0a, 0x0d, 0x42, 0x08, 0x04, 0x00, 0x00, 0x00, 0x07, 0x09, 0x2f, 0x30, 0x28, 0x28, 0x28, 0x28, 0x27, 0x27, 0x26, 0x26, 0x2c, 0x2f, 0x28, 0x18, 0xc4, 0x00, 0x35, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x07, 0xe7, 0x00, 0x07, 0x13, 0x29, 0x0e, 0x35, 0x00, 0xe7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x04, 0x26, 0xed, 0x2b, 0x10, 0x16, 0x33, 0x2f, 0x17, 0x07, 0xc5, 0x08, 0x0a, 0xc4, 0x1e, 0x33, 0x2e, 0x2b, 0x12, 0x05, 0xc5, 0x42, 0xdf, 0xdf, 0xc5, 0xc5, 0x5d, 0x32, 0x30, 0x2d, 0x31, 0x17, 0x06, 0xdf, 0xc5, 0xdf, 0x42, 0x42, 0xea, 0x42, 0x22, 0x34, 0x2b, 0x2f, 0x31, 0x19, 0x05, 0xe1, 0x08, 0x08, 0x0d, 0x15, 0x18, 0x05, 0x00, 0x35, 0x00, 0x35, 0x01, 0x35, 0x35, 0x00, 0x02, 0x05, 0x13, 0x15, 0x03, 0x00, 0x3d, 0xc4, 0xe1, 0xdf, 0x09, 0xdf, 0x42, 0x42, 0xdf, 0x09, 0xdf, 0xea, 0xe1, 0x0a, 0x08, 0xdf, 0x10, 0x0a, 0x13, 0x07, 0x00, 0xe7, 0x00, 0x00, 0x05, 0x2f, 0x2c, 0x29, 0x29, 0x29, 0x28, 0x28, 0x29, 0xed, 0x2a, 0x27, 0x26, 0x2b, 0x2e, 0x25, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x07, 0x01, 0x35, 0x35, 0x12, 0x13, 0x00, 0x35, 0x35, 0xe7, 0x00, 0x00, 0x01, 0x35, 0x00, 0xe7, 0x00, 0x01, 0x1b, 0x26, 0x30, 0x1c, 0x08, 0x1a, 0xe5, 0x0c, 0x06, 0x0d, 0x42, 0xe7, 0x17, 0x2e, 0xc8, 0x32, 0x1a, 0x08, 0xe1, 0xe1, 0xdf, 0xc4, 0x42, 0xe1, 0xea, 0x25, 0x31, 0x29, 0x34, 0xe5, 0x42, 0x08, 0xdf, 0x09, 0x42, 0x08, 0xea, 0xea, 0x0f, 0x33, 0x2c, 0x2d, 0x2f, 0x29, 0x0b, 0x42, 0xdf, 0xe1, 0x0b, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x35, 0x02, 0x07, 0x42, 0x0a, 0x42, 0x07, 0xc4, 0xdf, 0x09, 0x09, 0x09, 0x0b, 0x42, 0xe1, 0xe1, 0x04, 0x17, 0x32, 0x2b, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc7, 0x30, 0x2c, 0x27, 0x29, 0x27, 0xed, 0xed, 0x29, 0x28, 0x27, 0xed, 0x27, 0x27, 0x2b, 0x2b, 0x1c, 0x0b, 0x00, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x03, 0x35, 0x35, 0x05, 0x07, 0xea, 0x06, 0x35, 0x00, 0x00, 0x09, 0x11, 0x08, 0x00, 0x35, 0x00, 0x00, 0x00, 0x13, 0xc8, 0x30, 0xfb, 0x04, 0x00, 0x06, 0xea, 0x0d, 0xe1, 0x07, 0x14, 0x24, 0x2d, 0x34, 0x22, 0x0e, 0x04, 0x42, 0x07, 0x08, 0xdf, 0x0b, 0x05, 0x1b, 0x31, 0x2d, 0x31, 0x2e, 0x5d, 0x07, 0xe1, 0xe1, 0xea, 0xe1, 0x0e, 0x0a, 0x02, 0x22, 0x2b, 0x2d, 0x2f, 0x31, 0x19, 0xdf, 0x0b, 0x09, 0xea, 0x05, 0xe7, 0x00, 0x00, 0x35, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x05, 0x00, 0x00, 0xe7, 0xdf, 0xea, 0xe1, 0x0c, 0x0b, 0xe1, 0x0a, 0xc5, 0x06, 0x04, 0x08, 0xc5, 0xc5, 0x0c, 0x1b, 0x2d, 0x31, 0xe8, 0x00, 0x35, 0x00, 0xe7, 0x00, 0x0d, 0x33, 0x2b, 0x34, 0x25, 0x2a, 0x28, 0x28, 0x28, 0x28, 0x2a, 0xed, 0x27, 0x25, 0x27, 0x2c, 0x2c, 0x28, 0x18, 0x00, 0x01, 0x35, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x09, 0x04, 0x00, 0x00, 0x09, 0x42, 0x00, 0x00, 0x42, 0x1c, 0x29, 0x2a, 0x25, 0x18, 0x07, 0x01, 0xe7, 0x02, 0x04, 0x2b, 0x31, 0x1c, 0x35, 0x35, 0x00, 0x01, 0x04, 0x04, 0x0a, 0x1d, 0x30, 0x34, 0x25, 0x10, 0x05, 0xdf, 0x0a, 0xdf, 0xc5, 0x0b, 0x05, 0x5d, 0x2a, 0x2f, 0x2d, 0x32, 0x1c, 0x05, 0xdf, 0x09, 0x42, 0xea, 0x42, 0x05, 0x42, 0x12, 0x2f, 0x2c, 0x34, 0x30, 0x27, 0x0c, 0x09, 0x42, 0x04, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xdc, 0x05, 0x01, 0x00, 0x00, 0xea, 0x05, 0x05, 0xc5, 0xc4, 0x3d, 0x0c, 0x17, 0x1b, 0xe5, 0x26, 0x27, 0x29, 0x1b, 0xe1, 0x0c, 0x0d, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x1e, 0x34, 0x2b, 0x30, 0x26, 0x2b, 0xed, 0x26, 0xed, 0x26, 0x28, 0xd4, 0xed, 0x29, 0x27, 0x27, 0xed, 0x27, 0x1e, 0xe7, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x03, 0x02, 0x02, 0x00, 0xe1, 0x0a, 0x00, 0x17, 0xed, 0x28, 0x27, 0x28, 0x2b, 0x2e, 0xe4, 0x0c, 0x00, 0xe7, 0x00, 0x23, 0x31, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0a, 0x14, 0xc6, 0xea, 0xe1, 0x0e, 0xe1, 0x0a, 0x08, 0x08, 0x15, 0xc8, 0x34, 0x2f, 0x2f, 0x21, 0x0d, 0x07, 0xe1, 0xea, 0x08, 0x0b, 0x0b, 0x05, 0x12, 0x26, 0x33, 0x2b, 0x25, 0x1c, 0x0e, 0xe7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x04, 0x3d, 0x05, 0x03, 0x02, 0x07, 0xc5, 0xe1, 0x17, 0xc7, 0x2f, 0x30, 0x32, 0x32, 0x30, 0x32, 0x34, 0x1b, 0x01, 0xe1, 0xea, 0x35, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04, 0x26, 0x32, 0x2e, 0x2c, 0xed, 0xed, 0x29, 0x29, 0x29, 0x27, 0x28, 0xed, 0xed, 0x27, 0x27, 0x28, 0x2b, 0x2f, 0x22, 0x02, 0x04, 0x01, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0xe1, 0x15, 0x1f, 0xe4, 0x22, 0x1f, 0x1a, 0x2b, 0x27, 0x27, 0x2a, 0x2a, 0x26, 0x27, 0x2c, 0x2d, 0x17, 0x02, 0x00, 0x1f, 0x28, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0x07, 0x07, 0xe1, 0xe1, 0x0f, 0x24, 0x2b, 0xed, 0x2c, 0x24, 0x0f, 0xc4, 0xf7, 0x09, 0x0c, 0x0a, 0x09, 0x0c, 0x0b, 0x12, 0x1a, 0x11, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x35, 0x02, 0x3d, 0x35, 0x00, 0x00, 0xea, 0x1b, 0x2b, 0x34, 0x33, 0x31, 0x31, 0x30, 0x2c, 0x2c, 0x2d, 0x30, 0x1c, 0x07, 0xe1, 0x0e, 0x04, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0xdf, 0xed, 0x34, 0x2f, 0x2a, 0x2a, 0x28, 0x29, 0x2a, 0x29, 0x28, 0x27, 0x29, 0x29, 0xed, 0xed, 0x26, 0x2a, 0x31, 0x25, 0x05, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x11, 0xed, 0x2e, 0x2f, 0x31, 0x29, 0x28, 0x29, 0x2b, 0x2b, 0x25, 0x24, 0x2a, 0xed, 0xc7, 0x27, 0x2d, 0x19, 0x07, 0xe8, 0xc6, 0x00, 0x00, 0xd9, 0x05, 0x02, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x35, 0xe7, 0xd9, 0x35, 0x35, 0x35, 0x00, 0x04, 0x04, 0x35, 0x06, 0x0a, 0xc5, 0x05, 0xdc, 0x0b, 0x3d, 0xdf, 0x07, 0x02, 0x04, 0x05, 0x01, 0x35, 0x35, 0x02, 0x00, 0x01, 0x04, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x02, 0x06, 0x00, 0xd9, 0x16, 0x24, 0x2f, 0x2c, 0x24, 0x21, 0x1c, 0xc6, 0xe8, 0x16, 0x13, 0x11, 0x14, 0x12, 0x09, 0x08, 0xe1, 0x3d, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe1, 0xc8, 0x31, 0x30, 0x2d, 0xc8, 0x27, 0x27, 0x29, 0xed, 0x29, 0x27, 0x28, 0x27, 0x27, 0x28, 0x27, 0x2c, 0x34, 0x26, 0x05, 0x01, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x10, 0x26, 0x1f, 0x1a, 0x1b, 0x1c, 0x2b, 0x27, 0x1b, 0x0f, 0xc5, 0xdf, 0x11, 0x1f, 0x2b, 0xed, 0x25, 0xc8, 0x1f, 0xe1, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe7, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0xea, 0x1d, 0x2b, 0x1d, 0x12, 0x0a, 0xea, 0x07, 0x06, 0xdc, 0x06, 0xea, 0x07, 0x05, 0x07, 0x0a, 0x0c, 0x42, 0x08, 0xe1, 0x03, 0x00, 0x00, 0xe7, 0x00, 0x35, 0x01, 0x00, 0xe1, 0x2b, 0xc8, 0x30, 0x32, 0x29, 0x29, 0x29, 0x28, 0x27, 0x27, 0x28, 0x2b, 0x2d, 0x2e, 0xc8, 0x2a, 0x30, 0x34, 0xc7, 0xe7, 0x03, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x0b, 0x42, 0x35, 0x00, 0x00, 0x14, 0xe4, 0x0d, 0x35, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x16, 0x2a, 0x2b, 0x2b, 0x2e, 0xe8, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x35, 0xe7, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x35, 0x00, 0x01, 0x35, 0x00, 0x35, 0x00, 0x01, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0xe7, 0x35, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x02, 0x00, 0x00, 0xc6, 0x09, 0x02, 0x00, 0x01, 0x42, 0x09, 0x09, 0x09, 0xea, 0x0b, 0xea, 0x0a, 0x09, 0x09, 0x10, 0x0e, 0x13, 0x12, 0x35, 0x02, 0x01, 0x00, 0x00, 0x00, 0x35, 0xe7, 0x00, 0x0b, 0x2b, 0x33, 0xed, 0x30, 0x2b, 0x29, 0x28, 0xed, 0x29, 0x27, 0x27, 0x28, 0xc8, 0x30, 0x31, 0x2d, 0x2d, 0x30, 0x21, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x03, 0xe7, 0x0e, 0x07, 0x00, 0xe7, 0x35, 0x35, 0x02, 0x35, 0x00, 0xe7, 0x0c, 0x28, 0x31, 0x2b, 0x0b, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x01, 0x05, 0x00, 0x35, 0x01, 0xe7, 0xdf, 0x0b, 0x42, 0xc5, 0xea, 0x0b, 0xdf, 0x42, 0xea, 0x24, 0x30, 0x31, 0x31, 0x15, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0xea, 0x25, 0x34, 0x2c, 0x31, 0xc8, 0x26, 0x2a, 0x2a, 0x26, 0xed, 0x27, 0xed, 0x2d, 0x30, 0x32, 0x2a, 0x31, 0x33, 0xc6, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x35, 0xc4, 0xe7, 0x35, 0x00, 0xe7, 0x0a, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x02, 0x0f, 0x2a, 0x20, 0x00, 0x01, 0x04, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x3d, 0x35, 0x02, 0xe7, 0x00, 0x02, 0xea, 0x0a, 0xea, 0x42, 0x07, 0xc5, 0xea, 0xdc, 0xe8, 0x1b, 0xe8, 0x18, 0x0f, 0x02, 0xe7, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0xe7, 0x02, 0x0a, 0x1e, 0x34, 0x30, 0x2d, 0x2f, 0x26, 0x28, 0x2b, 0x24, 0x2b, 0x28, 0xed, 0x2f, 0x32, 0x30, 0x32, 0x33, 0x2a, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x01, 0xc4, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x35, 0x01, 0x00, 0xe7, 0x03, 0x17, 0x0e, 0x00, 0x01, 0xe7, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0xc4, 0x04, 0x00, 0x00, 0x00, 0x03, 0x07, 0xc5, 0x0c, 0x12, 0x0d, 0x13, 0x13, 0x0f, 0x0c, 0x06, 0xdc, 0x08, 0x0b, 0xc4, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x32, 0x30, 0x31, 0x2f, 0x29, 0x28, 0x2b, 0x27, 0x28, 0x29, 0x2b, 0x2f, 0x32, 0x31, 0x30, 0x34, 0x1d, 0x00, 0x35, 0x01, 0x00, 0x00, 0x00, 0x35, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x02, 0x02, 0x00, 0x06, 0x02, 0xc4, 0x0e, 0x01, 0x02, 0xe7, 0x35, 0x00, 0x35, 0x01, 0x00, 0x01, 0x0a, 0xe1, 0x09, 0x35, 0x04, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x01, 0xc4, 0x02, 0x00, 0x00, 0x09, 0x18, 0x24, 0xed, 0x30, 0x2f, 0x30, 0x30, 0x2e, 0xc7, 0x0e, 0xdf, 0x42, 0xc5, 0x0a, 0x00, 0x00, 0x35, 0x35, 0x00, 0x04, 0x35, 0x00, 0x01, 0x35, 0x00, 0x03, 0x1b, 0x34, 0x32, 0x2d, 0x32, 0x2a, 0x28, 0xed, 0x28, 0x2a, 0xed, 0x2b, 0x30, 0x31, 0x2d, 0x31, 0xc8, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x06, 0x5d, 0x17, 0x21, 0xc7, 0x2e, 0x21, 0x03, 0x00, 0x00, 0x00, 0x35, 0x02, 0x35, 0x00, 0x00, 0x08, 0xea, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x1a, 0x24, 0x2b, 0x2e, 0x30, 0x31, 0x30, 0x34, 0x30, 0x31, 0x31, 0x30, 0x16, 0xc4, 0xf7, 0x07, 0x0b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x1b, 0x30, 0x2f, 0x2f, 0x31, 0x27, 0x2c, 0x27, 0xed, 0x26, 0x2c, 0x2f, 0x2f, 0x33, 0x2e, 0x34, 0x1a, 0x00, 0xe7, 0x00, 0x35, 0x00, 0x35, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x42, 0x27, 0x2c, 0xed, 0x29, 0x34, 0x1c, 0x00, 0x04, 0xe1, 0x10, 0x12, 0x0f, 0x0e, 0xe1, 0x08, 0x3d, 0xea, 0x0a, 0x01, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x05, 0x0e, 0x28, 0x2f, 0x29, 0xc7, 0x26, 0x26, 0x20, 0xe5, 0x22, 0x24, 0x24, 0x2f, 0x1e, 0x3d, 0x0d, 0x07, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0xe7, 0xe7, 0x00, 0x00, 0x1a, 0x32, 0x30, 0x2f, 0x32, 0xed, 0xd4, 0x29, 0x25, 0x2e, 0x2d, 0x2b, 0x34, 0x31, 0x33, 0x25, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0xf7, 0x27, 0x2c, 0x2a, 0xc7, 0x28, 0x1b, 0x1b, 0x25, 0x29, 0x2c, 0x2c, 0x2a, 0xed, 0x27, 0xc7, 0xe5, 0x19, 0xd9, 0x00, 0xd9, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x1d, 0x16, 0x09, 0xe7, 0x08, 0x3d, 0x06, 0x07, 0x09, 0xc5, 0x14, 0x0f, 0x0a, 0x0a, 0xea, 0x0a, 0x09, 0x00, 0x35, 0x01, 0x35, 0x00, 0x35, 0x35, 0x00, 0x00, 0x35, 0x00, 0x02, 0x00, 0x00, 0x1b, 0x30, 0x2e, 0x30, 0x2e, 0x2c, 0xed, 0x27, 0x2b, 0xc8, 0x2b, 0x30, 0x31, 0x32, 0x2c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x35, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0x00, 0x0c, 0x1e, 0x14, 0x0a, 0x3d, 0x0a, 0x19, 0xc8, 0xed, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2c, 0x33, 0x29, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x35, 0x00, 0x03, 0x0d, 0xc5, 0x09, 0x0a, 0x08, 0xdf, 0x0a, 0x0b, 0x03, 0x08, 0xc4, 0xea, 0x03, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x1a, 0x32, 0x31, 0x30, 0x2d, 0x2c, 0xed, 0x28, 0x2e, 0x33, 0x2e, 0x2f, 0x33, 0x2e, 0x0b, 0x35, 0x35, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x06, 0x01, 0x00, 0x35, 0x00, 0x3d, 0x1b, 0x27, 0x21, 0x1c, 0x1a, 0xc6, 0xe8, 0x19, 0x1c, 0xc7, 0x33, 0x29, 0x05, 0x00, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x3d, 0x00, 0x02, 0xe7, 0x03, 0xea, 0x09, 0x0a, 0xdc, 0x42, 0x0b, 0x42, 0x14, 0x17, 0xe8, 0xc6, 0x18, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x01, 0x02, 0x00, 0x1a, 0x34, 0x2d, 0x2f, 0x2f, 0x2c, 0x2b, 0x2f, 0x2f, 0x2c, 0x2f, 0x31, 0x33, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x05, 0x04, 0x01, 0xe7, 0x04, 0x08, 0x0b, 0xea, 0x35, 0x00, 0x35, 0xe7, 0xe7, 0x35, 0x00, 0x07, 0x14, 0x1c, 0xdc, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xea, 0xe1, 0x0c, 0x0a, 0x09, 0xc5, 0x2a, 0x31, 0x32, 0x32, 0x26, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x01, 0xc5, 0xfb, 0x33, 0x2f, 0x2f, 0x2e, 0xc8, 0x2f, 0x2f, 0x2f, 0x2e, 0x31, 0x31, 0xdf, 0x00, 0x00, 0x35, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc4, 0x00, 0x00, 0x07, 0x0d, 0x09, 0x04, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0xe7, 0x03, 0xdf, 0x0b, 0x02, 0x00, 0x00, 0x35, 0x01, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x35, 0x35, 0xc4, 0xf7, 0x0d, 0x0b, 0x0a, 0x14, 0x0e, 0x09, 0x42, 0xd9, 0x06, 0x0c, 0x19, 0x1c, 0x1c, 0x1f, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x33, 0x2f, 0x30, 0x30, 0x2e, 0xc8, 0x2f, 0x30, 0x2e, 0x31, 0x30, 0x3d, 0x35, 0x35, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xc4, 0x17, 0x1f, 0x26, 0x2d, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe1, 0xdf, 0x03, 0xe7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x00, 0xe1, 0x24, 0x2a, 0x27, 0x29, 0x2f, 0x2d, 0x2a, 0x27, 0x1f, 0xc6, 0x0b, 0x06, 0x08, 0x05, 0x08, 0x0a, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x35, 0x00, 0x35, 0xe7, 0x25, 0x33, 0x2f, 0x2f, 0x2f, 0xc8, 0x2f, 0x31, 0x2d, 0x30, 0x31, 0xdf, 0x35, 0x35, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xc7, 0x30, 0x2d, 0x34, 0x17, 0xe7, 0x09, 0x15, 0xe8, 0x18, 0xc6, 0x12, 0x0b, 0xea, 0x06, 0x0c, 0x35, 0x35, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0xea, 0xed, 0x2e, 0xed, 0x28, 0x2b, 0x2e, 0x2f, 0x2e, 0x33, 0x2e, 0x1c, 0xea, 0xe1, 0x0a, 0xe1, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x18, 0x34, 0x2f, 0x2d, 0x30, 0x2e, 0x2e, 0x30, 0x2f, 0x2f, 0x34, 0x13, 0x35, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x16, 0x0d, 0x12, 0x12, 0x1f, 0x27, 0x29, 0x29, 0xed, 0x2b, 0x2b, 0x2b, 0xc7, 0x1c, 0x0e, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x02, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x21, 0x20, 0x20, 0x22, 0x26, 0x2d, 0x31, 0x2f, 0x32, 0x28, 0x0c, 0xc5, 0x42, 0x09, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x10, 0x34, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x31, 0x30, 0x2e, 0x34, 0x1a, 0x00, 0x00, 0x35, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x04, 0x35, 0x03, 0x0e, 0xd4, 0xed, 0x2a, 0x2b, 0x2b, 0x2a, 0x29, 0x2d, 0x33, 0x30, 0x0d, 0x02, 0xe7, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x35, 0x00, 0x03, 0x04, 0x00, 0x00, 0xe7, 0x07, 0x0b, 0xe8, 0x1e, 0x29, 0x21, 0xc5, 0x0a, 0x42, 0x07, 0x0a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xd9, 0x00, 0x35, 0x00, 0x01, 0x42, 0x2d, 0x31, 0x30, 0x2e, 0x30, 0x31, 0x31, 0x31, 0x2f, 0x34, 0x20, 0x00, 0x00, 0x35, 0x00, 0x35, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x42, 0xc5, 0x1d, 0x27, 0x1b, 0xc6, 0x15, 0x5d, 0x18, 0xfb, 0x2b, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc4, 0x00, 0x00, 0xe7, 0x00, 0xc5, 0x09, 0x06, 0x04, 0x0b, 0x11, 0x0a, 0x42, 0xe1, 0xf7, 0x09, 0xd9, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x27, 0x31, 0x32, 0x2c, 0x2e, 0x32, 0x31, 0x2f, 0x30, 0x31, 0x23, 0x00, 0xe7, 0x35, 0x00, 0x35, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc4, 0x35, 0x04, 0xe1, 0x10, 0x0b, 0x01, 0x00, 0x35, 0x00, 0x02, 0x07, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0xd9, 0xc4, 0x00, 0x00, 0x00, 0x03, 0x42, 0xe1, 0x42, 0x0a, 0x0b, 0xea, 0x05, 0xea, 0x04, 0x09, 0xea, 0x05, 0xe7, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x34, 0x2f, 0x2e, 0x2e, 0x33, 0x33, 0x30, 0x2e, 0x34, 0x25, 0x00, 0x35, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xe7, 0x05, 0x35, 0x00, 0x05, 0x09, 0x02, 0x00, 0x00, 0x03, 0x05, 0xc5, 0xdf, 0x09, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0xc4, 0x0b, 0x0a, 0xc5, 0x10, 0x14, 0x17, 0x17, 0x1b, 0x22, 0x1b, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x34, 0x30, 0x2f, 0x30, 0x31, 0x30, 0x31, 0x2f, 0x34, 0x26, 0x00, 0x35, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x07, 0x15, 0xe8, 0x1a, 0x1b, 0x14, 0x35, 0x00, 0x00, 0x00, 0xc4, 0x0c, 0xf7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xe7, 0x00, 0xc5, 0x00, 0xe7, 0x35, 0x06, 0x0b, 0x09, 0x3d, 0x0c, 0xc7, 0x2d, 0x31, 0x32, 0x34, 0x34, 0x2a, 0x35, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x2f, 0x31, 0x30, 0x31, 0x31, 0x2f, 0x32, 0x30, 0x33, 0x27, 0xe7, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x0d, 0x27, 0x2d, 0x30, 0x31, 0x24, 0x01, 0x00, 0x35, 0xe7, 0xc4, 0xe1, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x16, 0x14, 0x0e, 0xf7, 0x09, 0x03, 0x06, 0x13, 0xc8, 0xc8, 0x27, 0x23, 0x1e, 0x1c, 0x1c, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe5, 0x33, 0x2d, 0x31, 0x33, 0x2f, 0x32, 0x30, 0x33, 0x29, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x0d, 0x29, 0xc8, 0x2c, 0x30, 0xed, 0x04, 0x06, 0x05, 0x04, 0x09, 0x0b, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x11, 0x2c, 0x2f, 0xc8, 0x2a, 0xc8, 0x25, 0x1c, 0xe8, 0xe1, 0x16, 0x09, 0x3d, 0xc5, 0x04, 0x06, 0x0c, 0x04, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x34, 0x2e, 0x2f, 0x30, 0x30, 0x31, 0x30, 0x32, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x17, 0x15, 0x13, 0x1a, 0x1d, 0x1c, 0x24, 0x26, 0x28, 0x29, 0x1c, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x1e, 0x1d, 0x21, 0x27, 0x2e, 0x34, 0x34, 0x1d, 0x03, 0x0a, 0xea, 0x0a, 0x42, 0xdf, 0x0a, 0xe1, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x30, 0x34, 0x2f, 0x2f, 0x31, 0x31, 0x30, 0x31, 0xc8, 0x3d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x05, 0x03, 0x00, 0x00, 0x06, 0x09, 0x26, 0x2c, 0x2a, 0xc8, 0x34, 0xc7, 0x02, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x02, 0x00, 0x00, 0xc5, 0x15, 0x1f, 0x2a, 0xe8, 0x35, 0xe1, 0xe1, 0xea, 0xea, 0xe1, 0x0a, 0xea, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x21, 0x34, 0x31, 0x2f, 0x32, 0x32, 0x30, 0x31, 0x2f, 0x42, 0x00, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x01, 0x02, 0x04, 0x09, 0xdf, 0xfb, 0x26, 0xe4, 0xc7, 0x33, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x35, 0x07, 0x02, 0x35, 0xe7, 0x06, 0x09, 0x05, 0x0e, 0x07, 0x01, 0x0b, 0x09, 0xc5, 0xdf, 0x08, 0xc4, 0x0c, 0x09, 0x35, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x13, 0x30, 0x31, 0x30, 0x31, 0x2f, 0x31, 0x30, 0x31, 0xdf, 0x35, 0xe7, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x04, 0x00, 0xd9, 0x3d, 0x0d, 0x10, 0x02, 0x35, 0x08, 0x17, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe7, 0x01, 0x35, 0x00, 0x0a, 0xe1, 0xea, 0xea, 0x03, 0x00, 0x0b, 0xf7, 0x42, 0xdf, 0x08, 0xe1, 0x0a, 0xdf, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xfb, 0x34, 0x30, 0x33, 0x2f, 0x32, 0x2c, 0x33, 0x0e, 0x00, 0xd9, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x35, 0x01, 0x00, 0xe7, 0xe1, 0x02, 0x00, 0x03, 0x05, 0xc5, 0x0a, 0x01, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x02, 0x0c, 0x0c, 0xd9, 0x00, 0xe7, 0x06, 0x3d, 0x0d, 0xc5, 0xd9, 0x04, 0x0a, 0x06, 0x0a, 0xc4, 0x07, 0x08, 0x07, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x0f, 0x31, 0x2f, 0x2e, 0x34, 0x32, 0x31, 0x34, 0x13, 0x35, 0xe7, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0f, 0x12, 0x0c, 0x12, 0x11, 0x00, 0x00, 0x35, 0x03, 0xea, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x1a, 0xed, 0x26, 0x23, 0x1c, 0x14, 0xe1, 0x0c, 0x00, 0x00, 0xe7, 0x0a, 0x0f, 0x15, 0xc6, 0x17, 0xc6, 0x15, 0x16, 0x35, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x1b, 0x34, 0x2f, 0x2d, 0x2f, 0x30, 0x33, 0xe8, 0x35, 0x00, 0x00, 0x35, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0xe8, 0xed, 0x28, 0x28, 0x2e, 0x21, 0x0e, 0xe8, 0x17, 0x19, 0x19, 0x0c, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x22, 0x30, 0x2a, 0x2b, 0x31, 0x30, 0x29, 0x16, 0xe7, 0x02, 0x02, 0x19, 0x30, 0x2d, 0x2d, 0x31, 0x32, 0x32, 0x2b, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x28, 0x34, 0x30, 0x30, 0x32, 0x34, 0x20, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x35, 0x1b, 0xc8, 0x28, 0x2c, 0x31, 0x2a, 0x28, 0x2d, 0x28, 0x2f, 0x34, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x3d, 0x0b, 0x13, 0x1b, 0x28, 0x31, 0x34, 0xe8, 0x00, 0x00, 0x00, 0x19, 0x34, 0x30, 0x31, 0x2d, 0x2d, 0x2f, 0x30, 0x14, 0x03, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x01, 0xe7, 0x00, 0xe1, 0x28, 0x34, 0x2f, 0x31, 0x31, 0xed, 0x01, 0x00, 0x01, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x13, 0x0e, 0x12, 0xe8, 0x1c, 0x26, 0x2b, 0xed, 0x30, 0x34, 0x1a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x05, 0x00, 0x00, 0x00, 0xdf, 0x16, 0x21, 0x0e, 0x00, 0x01, 0x00, 0x11, 0x1b, 0x18, 0x14, 0x10, 0x0b, 0x0b, 0x14, 0xe1, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x0e, 0x26, 0x32, 0x33, 0x31, 0x2e, 0xea, 0x00, 0xe7, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x04, 0x11, 0xe8, 0x13, 0x10, 0xc6, 0x21, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xdc, 0x00, 0x00, 0x02, 0xe7, 0x05, 0x42, 0x0b, 0x06, 0x00, 0x35, 0x35, 0xc5, 0x07, 0x06, 0x42, 0x42, 0x0a, 0xc4, 0xdf, 0x0c, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x0a, 0xc7, 0x2d, 0x32, 0x34, 0x1b, 0x01, 0x00, 0x35, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x06, 0x01, 0x02, 0x35, 0x02, 0x0a, 0xea, 0x00, 0x00, 0x02, 0x03, 0xea, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3d, 0x35, 0x35, 0x01, 0x01, 0xc4, 0x42, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x09, 0x09, 0xe1, 0x0a, 0xc4, 0x0a, 0xdf, 0x08, 0x0e, 0x35, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x35, 0x03, 0x00, 0x00, 0xe8, 0x26, 0x34, 0x30, 0x0a, 0x01, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x01, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x06, 0x00, 0x00, 0x35, 0x02, 0xe1, 0x07, 0x03, 0x00, 0x35, 0xe1, 0xe1, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x35, 0x02, 0x00, 0x04, 0xd9, 0x00, 0x35, 0x35, 0x00, 0x06, 0x0b, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x42, 0xe1, 0xdf, 0x09, 0x07, 0x06, 0x3d, 0xc4, 0x42, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x14, 0xe4, 0x22, 0x15, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x01, 0x00, 0x0c, 0x17, 0x15, 0x12, 0xc4, 0x08, 0x06, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 0xc5, 0x35, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe8, 0xe8, 0x16, 0x0d, 0xdc, 0x0a, 0x42, 0xea, 0x00, 0x00, 0x00, 0x00, 0x05, 0xdf, 0x08, 0xf7, 0x0f, 0xe8, 0x1a, 0x1c, 0x1b, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0xe7, 0xc4, 0xdf, 0xc4, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x01, 0x19, 0x27, 0x2c, 0x2c, 0xc7, 0xc7, 0x1a, 0x1a, 0x1d, 0x21, 0x20, 0xe5, 0x22, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe8, 0xc8, 0x2e, 0xed, 0x28, 0x27, 0x28, 0x19, 0x0d, 0x05, 0xe7, 0x00, 0x35, 0x02, 0x14, 0x19, 0x25, 0x2d, 0x34, 0x32, 0x32, 0x33, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x00, 0x35, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x25, 0xed, 0x27, 0x26, 0x28, 0x31, 0xc7, 0x2c, 0xc8, 0x2c, 0x27, 0x2f, 0x33, 0x1d, 0x35, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x35, 0x07, 0x21, 0x25, 0xfb, 0x2a, 0x2f, 0x2c, 0x32, 0x31, 0x5d, 0x02, 0x00, 0x00, 0x01, 0x04, 0x24, 0x34, 0x33, 0x2c, 0x26, 0x1c, 0x19, 0xe6, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x01, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x01, 0x01, 0x0b, 0x28, 0xed, 0x2d, 0xed, 0x2e, 0x2c, 0x1f, 0xfb, 0x21, 0x23, 0xec, 0x29, 0x2f, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0xe7, 0x01, 0x02, 0xc5, 0x04, 0xea, 0x09, 0xc4, 0x0e, 0x1c, 0xed, 0x34, 0x17, 0x00, 0x00, 0x01, 0x00, 0x01, 0x22, 0xc8, 0x1a, 0x0d, 0xea, 0xea, 0x03, 0x06, 0x09, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0x35, 0xea, 0xdf, 0x03, 0xdf, 0x13, 0x22, 0xec, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x04, 0x0c, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x02, 0x00, 0x00, 0x00, 0x35, 0x05, 0x0c, 0x1c, 0x16, 0x01, 0x35, 0x02, 0x00, 0x00, 0x13, 0x0e, 0x42, 0x05, 0xc5, 0x0b, 0xc5, 0x0a, 0x0b, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x35, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x03, 0x04, 0x01, 0x01, 0x01, 0x35, 0x02, 0x42, 0x35, 0xe7, 0x00, 0xe7, 0x01, 0x03, 0x42, 0x0d, 0x03, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x02, 0x04, 0x02, 0x00, 0x01, 0x03, 0x35, 0x05, 0x09, 0xea, 0xc5, 0x09, 0x00, 0x00, 0x35, 0x00, 0xd9, 0x42, 0x07, 0x42, 0xe1, 0x0b, 0x08, 0x06, 0xe1, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0x01, 0x0a, 0x08, 0x00, 0x01, 0x35, 0xc5, 0x0e, 0x1d, 0x1b, 0x1a, 0x17, 0x0e, 0x08, 0x3d, 0x05, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x03, 0x3d, 0x00, 0x00, 0x35, 0x00, 0x05, 0x0a, 0xea, 0x09, 0x09, 0x0a, 0x01, 0x35, 0x00, 0x00, 0x00, 0x02, 0x0d, 0xdf, 0x42, 0xea, 0x0a, 0x0b, 0x09, 0x05, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x35, 0xe7, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x35, 0xc4, 0x1a, 0x27, 0x26, 0xc6, 0x01, 0x03, 0xc4, 0x1f, 0x31, 0x2c, 0x2f, 0x2e, 0x2b, 0xd4, 0xfb, 0x1b, 0xe8, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x35, 0x00, 0x00, 0xdc, 0x07, 0x00, 0x00, 0x04, 0x07, 0x09, 0xe1, 0xdc, 0x3d, 0x0d, 0xea, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x05, 0xf7, 0x42, 0x06, 0x0b, 0x07, 0x0d, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x03, 0x10, 0x21, 0x29, 0x27, 0x2a, 0x2d, 0xec, 0x13, 0x0b, 0x16, 0x18, 0x18, 0x1b, 0x20, 0x24, 0x29, 0x2e, 0x34, 0x30, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x35, 0x02, 0x05, 0x07, 0x00, 0x00, 0x04, 0x0a, 0x09, 0x07, 0xdf, 0x0b, 0xe1, 0x09, 0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x14, 0x0d, 0x0d, 0xea, 0x42, 0x42, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe7, 0x13, 0xec, 0x25, 0x27, 0xed, 0x25, 0x27, 0x2e, 0x26, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdc, 0x0e, 0x1a, 0x2b, 0x31, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x03, 0xe8, 0x15, 0xe7, 0x00, 0x04, 0x07, 0x0a, 0xe1, 0xe1, 0x0b, 0xc5, 0xd9, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x09, 0x27, 0xc8, 0x2d, 0x2b, 0x1d, 0x17, 0xe1, 0x00, 0x35, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x1f, 0xfb, 0x28, 0x28, 0x26, 0x2b, 0x27, 0x2d, 0x32, 0x1a, 0x00, 0x05, 0xe7, 0x35, 0x00, 0x00, 0x00, 0x09, 0x12, 0x1b, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc7, 0x29, 0x29, 0x24, 0x0f, 0x00, 0x0a, 0xdf, 0xc4, 0x05, 0x01, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x35, 0x00, 0x21, 0x2f, 0x33, 0x2f, 0x32, 0x34, 0x30, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1d, 0x27, 0x26, 0x2a, 0x2b, 0x27, 0x28, 0xed, 0x2b, 0x34, 0x26, 0xe1, 0xe7, 0x00, 0x03, 0x02, 0x03, 0x02, 0xc5, 0x04, 0xea, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x3d, 0x17, 0x25, 0x26, 0x27, 0x2a, 0x2c, 0x28, 0x18, 0xc5, 0xea, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x1b, 0x30, 0x2d, 0x2b, 0xc8, 0x2a, 0xc8, 0x2e, 0x34, 0xe8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0xea, 0x1c, 0x21, 0xed, 0x2b, 0x25, 0x27, 0xed, 0xc7, 0x2d, 0x32, 0x24, 0x26, 0x2d, 0x1e, 0xc5, 0x00, 0x00, 0x07, 0xc4, 0x0d, 0x0d, 0x42, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0x00, 0x05, 0x18, 0x24, 0x22, 0x28, 0x28, 0x27, 0x29, 0x26, 0x2f, 0x5d, 0x42, 0x00, 0x35, 0x02, 0xd9, 0x00, 0x00, 0x35, 0x00, 0x01, 0x5d, 0x31, 0x30, 0x32, 0x31, 0x2f, 0x2f, 0xc8, 0x2e, 0x32, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xc6, 0x21, 0x29, 0x29, 0x26, 0xed, 0xed, 0xed, 0x2f, 0x26, 0x1f, 0xe5, 0x2a, 0x27, 0x29, 0x2c, 0xe8, 0xc5, 0x06, 0xea, 0x0a, 0xdf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x03, 0xe8, 0x24, 0x23, 0xed, 0x2a, 0x2b, 0x27, 0x26, 0x2d, 0x30, 0xed, 0x10, 0x00, 0x00, 0x35, 0x00, 0x00, 0xe7, 0xe7, 0x01, 0x0f, 0x33, 0xc8, 0x30, 0xed, 0x2d, 0x2e, 0x30, 0x2e, 0x2d, 0x2c, 0x2d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x35, 0xc5, 0xec, 0x28, 0x27, 0x2a, 0xed, 0x25, 0xed, 0x2b, 0xe5, 0x20, 0x29, 0x2c, 0xc7, 0x2c, 0x28, 0x25, 0x31, 0x1b, 0xc4, 0x0d, 0xe1, 0x35, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x35, 0x14, 0x23, 0x24, 0x2a, 0x27, 0x27, 0x28, 0x29, 0x29, 0x29, 0x2c, 0x33, 0x18, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2e, 0x2f, 0x2d, 0x2f, 0x30, 0x2e, 0x2f, 0x2c, 0x2f, 0x2f, 0x2e, 0x32, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x01, 0x00, 0x02, 0x16, 0x26, 0x27, 0x2a, 0x24, 0x28, 0x2a, 0x2e, 0xec, 0x21, 0x2a, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xed, 0x34, 0x1d, 0x35, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0xe7, 0x42, 0x21, 0xc7, 0x28, 0x29, 0x28, 0x29, 0x29, 0x27, 0x27, 0x2a, 0x2f, 0x30, 0x26, 0x00, 0x00, 0x02, 0x00, 0x35, 0x00, 0x3d, 0x2a, 0x32, 0xc8, 0x30, 0x2e, 0x2e, 0x2d, 0x32, 0xed, 0x30, 0x31, 0x2d, 0x31, 0x20, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xe7, 0x00, 0x03, 0x19, 0x30, 0xc8, 0x27, 0x2f, 0x2d, 0x2f, 0x1d, 0x23, 0x29, 0x29, 0x29, 0xed, 0xed, 0xed, 0x28, 0x29, 0x2a, 0x30, 0x27, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1c, 0x23, 0x24, 0x2a, 0x27, 0x28, 0x29, 0xed, 0xed, 0xed, 0x2c, 0x2f, 0x31, 0x2a, 0x3d, 0x02, 0x35, 0x00, 0x00, 0x00, 0x22, 0x31, 0x2d, 0x2b, 0x2c, 0x2c, 0x30, 0x2e, 0x2b, 0x30, 0x30, 0xed, 0x2c, 0x34, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x17, 0x24, 0xed, 0x2b, 0xed, 0xc7, 0x23, 0x2b, 0xed, 0x27, 0x27, 0x29, 0xed, 0x29, 0xed, 0x2b, 0x2f, 0x2d, 0x34, 0x5d, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x01, 0xdf, 0x23, 0x24, 0x27, 0xed, 0x2a, 0xed, 0x27, 0x27, 0x27, 0x2a, 0x2d, 0x31, 0x2e, 0xc8, 0x05, 0x00, 0x01, 0x02, 0x02, 0x13, 0x33, 0x30, 0x2c, 0x31, 0x31, 0x2d, 0x31, 0x2c, 0x2c, 0x30, 0x2f, 0xc8, 0x34, 0x2e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x35, 0xe7, 0x35, 0x00, 0x00, 0xe7, 0x03, 0x35, 0x1d, 0x24, 0x29, 0x28, 0x27, 0x2a, 0x2a, 0x28, 0x27, 0x27, 0x28, 0x2b, 0xc8, 0xc8, 0x33, 0x10, 0x00, 0xe7, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x24, 0x28, 0x2b, 0x26, 0x26, 0x27, 0x28, 0xed, 0x2c, 0x2c, 0x2d, 0xc8, 0x2d, 0x32, 0xc5, 0x00, 0x00, 0x00, 0x02, 0x23, 0x32, 0x2c, 0xed, 0x30, 0x2d, 0x2b, 0x30, 0x2d, 0x31, 0x33, 0x32, 0x2e, 0x26, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x31, 0x26, 0x25, 0x28, 0x29, 0x27, 0x27, 0x27, 0x2a, 0xc8, 0x2f, 0x30, 0x34, 0xd4, 0xea, 0x00, 0x35, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1c, 0x26, 0x26, 0x28, 0x27, 0x29, 0x28, 0x29, 0x2a, 0x2c, 0x2e, 0x2d, 0xc8, 0x32, 0x28, 0x05, 0x00, 0x35, 0x00, 0x00, 0xc6, 0x2c, 0x31, 0x32, 0x33, 0x32, 0x2f, 0x2f, 0x2c, 0x25, 0x1f, 0x18, 0x0c, 0x03, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x04, 0x00, 0xc4, 0xfb, 0x2d, 0x32, 0x2b, 0x2b, 0x2b, 0x2c, 0x2d, 0x30, 0x31, 0x30, 0x2e, 0x2b, 0x1a, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x17, 0x2c, 0xc8, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x30, 0x32, 0x33, 0x31, 0x2f, 0x21, 0x0e, 0x00, 0x02, 0x01, 0x04, 0x00, 0x00, 0x05, 0x0d, 0x11, 0x0e, 0x12, 0x0f, 0xea, 0x04, 0x03, 0x00, 0x35, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0xe7, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x12, 0x1c, 0x26, 0x2b, 0x2c, 0xc8, 0x2b, 0x2a, 0x27, 0xfb, 0x20, 0x0d, 0x02, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0xe8, 0x1f, 0xed, 0x2d, 0x2b, 0x2c, 0xc8, 0xed, 0xc7, 0x1c, 0x16, 0x0c, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35, 0x00, 0x00, 0x35, 0x35, 0x00, 0xe7, 0x04, 0x07, 0xdc, 0x05, 0x03, 0x35, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xc4, 0x07, 0x06, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0xe7, 0x02, 0x00, 0x35, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x35, 0x35, 0x00, 0x01, 0x00, 0x00, 0xe7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_img_dsc_t image22 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 184,
-  .header.h = 208,
-  .data_size = 39296,
-  .data = image22_map,
-};
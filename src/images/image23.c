@@ -1,499 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE23
-#define LV_ATTRIBUTE_IMG_IMAGE23
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE23 uint8_t image23_map[] = {
-  0xfe, 0xfe, 0xfe, 0xff, 	/*Color of index 0*/
-  0xa6, 0xbe, 0xfc, 0xff, 	/*Color of index 1*/
-  0x9b, 0xaf, 0xfa, 0xff, 	/*Color of index 2*/
-  0x93, 0xa2, 0xfc, 0xff, 	/*Color of index 3*/
-  0x8c, 0x9b, 0xfb, 0xff, 	/*Color of index 4*/
-  0x88, 0x9e, 0xe5, 0xff, 	/*Color of index 5*/
-  0x8d, 0xa2, 0xd4, 0xff, 	/*Color of index 6*/
-  0x86, 0x93, 0xfa, 0xff, 	/*Color of index 7*/
-  0x7e, 0x98, 0xd7, 0xff, 	/*Color of index 8*/
-  0x7c, 0x89, 0xf9, 0xff, 	/*Color of index 9*/
-  0x77, 0x87, 0xd8, 0xff, 	/*Color of index 10*/
-  0x76, 0x8b, 0xc7, 0xff, 	/*Color of index 11*/
-  0x6e, 0x7d, 0xf4, 0xff, 	/*Color of index 12*/
-  0x66, 0x7d, 0xbf, 0xff, 	/*Color of index 13*/
-  0x61, 0x6f, 0xe9, 0xff, 	/*Color of index 14*/
-  0x5d, 0x74, 0xbf, 0xff, 	/*Color of index 15*/
-  0x60, 0x6d, 0xd4, 0xff, 	/*Color of index 16*/
-  0x55, 0x64, 0xdf, 0xff, 	/*Color of index 17*/
-  0x53, 0x70, 0xb6, 0xff, 	/*Color of index 18*/
-  0x58, 0x70, 0xac, 0xff, 	/*Color of index 19*/
-  0x4e, 0x5b, 0xd8, 0xff, 	/*Color of index 20*/
-  0x4e, 0x5d, 0xb6, 0xff, 	/*Color of index 21*/
-  0x44, 0x51, 0xcd, 0xff, 	/*Color of index 22*/
-  0x44, 0x5a, 0xa3, 0xff, 	/*Color of index 23*/
-  0x3d, 0x4d, 0xbb, 0xff, 	/*Color of index 24*/
-  0x34, 0x49, 0xa9, 0xff, 	/*Color of index 25*/
-  0x37, 0x4b, 0x9a, 0xff, 	/*Color of index 26*/
-  0x32, 0x3c, 0xbc, 0xff, 	/*Color of index 27*/
-  0x33, 0x44, 0x8f, 0xff, 	/*Color of index 28*/
-  0x2b, 0x36, 0xa4, 0xff, 	/*Color of index 29*/
-  0x24, 0x2e, 0xb2, 0xff, 	/*Color of index 30*/
-  0x26, 0x37, 0x8e, 0xff, 	/*Color of index 31*/
-  0x1c, 0x25, 0xa1, 0xff, 	/*Color of index 32*/
-  0x1a, 0x2b, 0x80, 0xff, 	/*Color of index 33*/
-  0x18, 0x26, 0x8d, 0xff, 	/*Color of index 34*/
-  0x19, 0x2e, 0x6f, 0xff, 	/*Color of index 35*/
-  0x09, 0x1b, 0x72, 0xff, 	/*Color of index 36*/
-  0x00, 0x0a, 0x6d, 0xff, 	/*Color of index 37*/
-  0x00, 0x0c, 0x59, 0xff, 	/*Color of index 38*/
-  0x00, 0x07, 0x27, 0xff, 	/*Color of index 39*/
-  0x00, 0x01, 0x0d, 0xff, 	/*Color of index 40*/
-  0xec, 0xfb, 0xfd, 0xff, 	/*Color of index 41*/
-  0xe2, 0xf9, 0xfe, 0xff, 	/*Color of index 42*/
-  0xf2, 0xf6, 0xfa, 0xff, 	/*Color of index 43*/
-  0xe9, 0xf4, 0xfc, 0xff, 	/*Color of index 44*/
-  0xdb, 0xf4, 0xfd, 0xff, 	/*Color of index 45*/
-  0xe1, 0xf1, 0xfc, 0xff, 	/*Color of index 46*/
-  0xd4, 0xf2, 0xfd, 0xff, 	/*Color of index 47*/
-  0xd9, 0xed, 0xfc, 0xff, 	/*Color of index 48*/
-  0xe8, 0xed, 0xf5, 0xff, 	/*Color of index 49*/
-  0xcb, 0xeb, 0xfb, 0xff, 	/*Color of index 50*/
-  0xd0, 0xe9, 0xfe, 0xff, 	/*Color of index 51*/
-  0xd5, 0xe7, 0xf2, 0xff, 	/*Color of index 52*/
-  0xcb, 0xe4, 0xfc, 0xff, 	/*Color of index 53*/
-  0xc3, 0xe2, 0xfc, 0xff, 	/*Color of index 54*/
-  0xc3, 0xe2, 0xf5, 0xff, 	/*Color of index 55*/
-  0xcc, 0xe0, 0xf3, 0xff, 	/*Color of index 56*/
-  0xc3, 0xdc, 0xfd, 0xff, 	/*Color of index 57*/
-  0xcf, 0xde, 0xe9, 0xff, 	/*Color of index 58*/
-  0xb9, 0xda, 0xfa, 0xff, 	/*Color of index 59*/
-  0xbe, 0xda, 0xf4, 0xff, 	/*Color of index 60*/
-  0xda, 0xdd, 0xde, 0xff, 	/*Color of index 61*/
-  0xc1, 0xd4, 0xfd, 0xff, 	/*Color of index 62*/
-  0xc4, 0xd9, 0xe9, 0xff, 	/*Color of index 63*/
-  0xb8, 0xd5, 0xf3, 0xff, 	/*Color of index 64*/
-  0xb3, 0xd0, 0xfb, 0xff, 	/*Color of index 65*/
-  0xb2, 0xd1, 0xf2, 0xff, 	/*Color of index 66*/
-  0xbc, 0xd1, 0xe9, 0xff, 	/*Color of index 67*/
-  0xc9, 0xd3, 0xdd, 0xff, 	/*Color of index 68*/
-  0xbc, 0xd0, 0xe0, 0xff, 	/*Color of index 69*/
-  0xab, 0xcb, 0xf5, 0xff, 	/*Color of index 70*/
-  0xb2, 0xcd, 0xeb, 0xff, 	/*Color of index 71*/
-  0xa9, 0xc9, 0xeb, 0xff, 	/*Color of index 72*/
-  0xc9, 0xcc, 0xcd, 0xff, 	/*Color of index 73*/
-  0xb3, 0xc8, 0xdf, 0xff, 	/*Color of index 74*/
-  0xa4, 0xc3, 0xec, 0xff, 	/*Color of index 75*/
-  0xb9, 0xc4, 0xce, 0xff, 	/*Color of index 76*/
-  0xa7, 0xc0, 0xdf, 0xff, 	/*Color of index 77*/
-  0x9b, 0xbc, 0xeb, 0xff, 	/*Color of index 78*/
-  0xb2, 0xbf, 0xcd, 0xff, 	/*Color of index 79*/
-  0x99, 0xb9, 0xe3, 0xff, 	/*Color of index 80*/
-  0xa7, 0xbb, 0xce, 0xff, 	/*Color of index 81*/
-  0x95, 0xb3, 0xe3, 0xff, 	/*Color of index 82*/
-  0x9d, 0xb4, 0xd5, 0xff, 	/*Color of index 83*/
-  0x92, 0xb2, 0xda, 0xff, 	/*Color of index 84*/
-  0x8b, 0xac, 0xe5, 0xff, 	/*Color of index 85*/
-  0x9f, 0xb1, 0xc6, 0xff, 	/*Color of index 86*/
-  0xac, 0xb3, 0xb6, 0xff, 	/*Color of index 87*/
-  0x8e, 0xab, 0xd6, 0xff, 	/*Color of index 88*/
-  0x9d, 0xad, 0xb5, 0xff, 	/*Color of index 89*/
-  0x8e, 0xa7, 0xc5, 0xff, 	/*Color of index 90*/
-  0x81, 0xa3, 0xd5, 0xff, 	/*Color of index 91*/
-  0xa0, 0xaa, 0xac, 0xff, 	/*Color of index 92*/
-  0x81, 0xa0, 0xcb, 0xff, 	/*Color of index 93*/
-  0x92, 0xa2, 0xb0, 0xff, 	/*Color of index 94*/
-  0x87, 0x9e, 0xbc, 0xff, 	/*Color of index 95*/
-  0x73, 0x97, 0xd3, 0xff, 	/*Color of index 96*/
-  0x7b, 0x9a, 0xc6, 0xff, 	/*Color of index 97*/
-  0x8a, 0x9c, 0xab, 0xff, 	/*Color of index 98*/
-  0x93, 0x9b, 0xa0, 0xff, 	/*Color of index 99*/
-  0x7c, 0x96, 0xb8, 0xff, 	/*Color of index 100*/
-  0x71, 0x92, 0xc7, 0xff, 	/*Color of index 101*/
-  0x73, 0x91, 0xb8, 0xff, 	/*Color of index 102*/
-  0x69, 0x8b, 0xc4, 0xff, 	/*Color of index 103*/
-  0x6b, 0x8c, 0xbb, 0xff, 	/*Color of index 104*/
-  0x81, 0x92, 0x9f, 0xff, 	/*Color of index 105*/
-  0x70, 0x8c, 0xb0, 0xff, 	/*Color of index 106*/
-  0x62, 0x84, 0xbf, 0xff, 	/*Color of index 107*/
-  0x68, 0x86, 0xb3, 0xff, 	/*Color of index 108*/
-  0x78, 0x89, 0xa0, 0xff, 	/*Color of index 109*/
-  0x87, 0x8c, 0x8e, 0xff, 	/*Color of index 110*/
-  0x68, 0x83, 0xa8, 0xff, 	/*Color of index 111*/
-  0x77, 0x87, 0x95, 0xff, 	/*Color of index 112*/
-  0x5f, 0x7b, 0xab, 0xff, 	/*Color of index 113*/
-  0x6e, 0x80, 0x94, 0xff, 	/*Color of index 114*/
-  0x63, 0x7a, 0x95, 0xff, 	/*Color of index 115*/
-  0x77, 0x7b, 0x7f, 0xff, 	/*Color of index 116*/
-  0x5a, 0x73, 0x98, 0xff, 	/*Color of index 117*/
-  0x65, 0x73, 0x85, 0xff, 	/*Color of index 118*/
-  0x4e, 0x69, 0xa8, 0xff, 	/*Color of index 119*/
-  0x6e, 0x72, 0x73, 0xff, 	/*Color of index 120*/
-  0x5a, 0x6e, 0x84, 0xff, 	/*Color of index 121*/
-  0x4e, 0x6a, 0x95, 0xff, 	/*Color of index 122*/
-  0x52, 0x69, 0x85, 0xff, 	/*Color of index 123*/
-  0x5b, 0x6b, 0x79, 0xff, 	/*Color of index 124*/
-  0x65, 0x69, 0x6a, 0xff, 	/*Color of index 125*/
-  0x47, 0x62, 0x88, 0xff, 	/*Color of index 126*/
-  0x53, 0x63, 0x76, 0xff, 	/*Color of index 127*/
-  0x3e, 0x59, 0x8c, 0xff, 	/*Color of index 128*/
-  0x43, 0x5b, 0x7d, 0xff, 	/*Color of index 129*/
-  0x4c, 0x5c, 0x6c, 0xff, 	/*Color of index 130*/
-  0x3a, 0x56, 0x7d, 0xff, 	/*Color of index 131*/
-  0x56, 0x5b, 0x5e, 0xff, 	/*Color of index 132*/
-  0x43, 0x55, 0x6b, 0xff, 	/*Color of index 133*/
-  0x34, 0x4f, 0x7e, 0xff, 	/*Color of index 134*/
-  0x39, 0x50, 0x71, 0xff, 	/*Color of index 135*/
-  0x42, 0x50, 0x5d, 0xff, 	/*Color of index 136*/
-  0x30, 0x49, 0x6f, 0xff, 	/*Color of index 137*/
-  0x38, 0x49, 0x5e, 0xff, 	/*Color of index 138*/
-  0x3c, 0x47, 0x50, 0xff, 	/*Color of index 139*/
-  0x2b, 0x42, 0x62, 0xff, 	/*Color of index 140*/
-  0x32, 0x41, 0x50, 0xff, 	/*Color of index 141*/
-  0x29, 0x3c, 0x5c, 0xff, 	/*Color of index 142*/
-  0x20, 0x38, 0x5d, 0xff, 	/*Color of index 143*/
-  0x2f, 0x3b, 0x4b, 0xff, 	/*Color of index 144*/
-  0x22, 0x35, 0x50, 0xff, 	/*Color of index 145*/
-  0x2c, 0x38, 0x3d, 0xff, 	/*Color of index 146*/
-  0x19, 0x2f, 0x50, 0xff, 	/*Color of index 147*/
-  0x24, 0x32, 0x3f, 0xff, 	/*Color of index 148*/
-  0x0f, 0x28, 0x60, 0xff, 	/*Color of index 149*/
-  0x10, 0x27, 0x4b, 0xff, 	/*Color of index 150*/
-  0x1b, 0x2a, 0x3d, 0xff, 	/*Color of index 151*/
-  0x12, 0x25, 0x40, 0xff, 	/*Color of index 152*/
-  0x0b, 0x21, 0x42, 0xff, 	/*Color of index 153*/
-  0x1d, 0x23, 0x2f, 0xff, 	/*Color of index 154*/
-  0x0e, 0x22, 0x31, 0xff, 	/*Color of index 155*/
-  0x04, 0x1a, 0x3e, 0xff, 	/*Color of index 156*/
-  0x09, 0x1a, 0x33, 0xff, 	/*Color of index 157*/
-  0x19, 0x1d, 0x22, 0xff, 	/*Color of index 158*/
-  0x0e, 0x18, 0x27, 0xff, 	/*Color of index 159*/
-  0x01, 0x12, 0x36, 0xff, 	/*Color of index 160*/
-  0x0a, 0x17, 0x1a, 0xff, 	/*Color of index 161*/
-  0x03, 0x12, 0x25, 0xff, 	/*Color of index 162*/
-  0x01, 0x08, 0x17, 0xff, 	/*Color of index 163*/
-  0xf6, 0xfb, 0xfb, 0xff, 	/*Color of index 164*/
-  0xf3, 0xf8, 0xf7, 0xff, 	/*Color of index 165*/
-  0xeb, 0xf8, 0xf5, 0xff, 	/*Color of index 166*/
-  0xf3, 0xf4, 0xf4, 0xff, 	/*Color of index 167*/
-  0xea, 0xf4, 0xf3, 0xff, 	/*Color of index 168*/
-  0xe5, 0xf2, 0xf0, 0xff, 	/*Color of index 169*/
-  0xe2, 0xf0, 0xed, 0xff, 	/*Color of index 170*/
-  0xe2, 0xec, 0xea, 0xff, 	/*Color of index 171*/
-  0xdc, 0xec, 0xe9, 0xff, 	/*Color of index 172*/
-  0xda, 0xe8, 0xe5, 0xff, 	/*Color of index 173*/
-  0xe2, 0xe5, 0xe5, 0xff, 	/*Color of index 174*/
-  0xd8, 0xe4, 0xe2, 0xff, 	/*Color of index 175*/
-  0xd3, 0xe2, 0xe2, 0xff, 	/*Color of index 176*/
-  0xd2, 0xe0, 0xdd, 0xff, 	/*Color of index 177*/
-  0xcc, 0xdd, 0xda, 0xff, 	/*Color of index 178*/
-  0xd1, 0xda, 0xd9, 0xff, 	/*Color of index 179*/
-  0xc9, 0xd8, 0xd4, 0xff, 	/*Color of index 180*/
-  0xcc, 0xd4, 0xd3, 0xff, 	/*Color of index 181*/
-  0xc3, 0xd3, 0xd0, 0xff, 	/*Color of index 182*/
-  0xc0, 0xcf, 0xcc, 0xff, 	/*Color of index 183*/
-  0xbc, 0xcb, 0xc9, 0xff, 	/*Color of index 184*/
-  0xb9, 0xc8, 0xc4, 0xff, 	/*Color of index 185*/
-  0xbd, 0xc3, 0xc3, 0xff, 	/*Color of index 186*/
-  0xb2, 0xc3, 0xbf, 0xff, 	/*Color of index 187*/
-  0xb0, 0xbf, 0xbc, 0xff, 	/*Color of index 188*/
-  0xac, 0xbc, 0xba, 0xff, 	/*Color of index 189*/
-  0xa8, 0xb9, 0xb5, 0xff, 	/*Color of index 190*/
-  0xa2, 0xb4, 0xb0, 0xff, 	/*Color of index 191*/
-  0x9e, 0xb0, 0xac, 0xff, 	/*Color of index 192*/
-  0xa8, 0xac, 0xac, 0xff, 	/*Color of index 193*/
-  0x99, 0xac, 0xa8, 0xff, 	/*Color of index 194*/
-  0x9a, 0xaa, 0xa5, 0xff, 	/*Color of index 195*/
-  0x95, 0xa7, 0xa4, 0xff, 	/*Color of index 196*/
-  0x91, 0xa4, 0xa0, 0xff, 	/*Color of index 197*/
-  0x9d, 0xa2, 0xa1, 0xff, 	/*Color of index 198*/
-  0x8d, 0xa1, 0x9d, 0xff, 	/*Color of index 199*/
-  0x8a, 0x9d, 0x99, 0xff, 	/*Color of index 200*/
-  0x88, 0x9c, 0x94, 0xff, 	/*Color of index 201*/
-  0x84, 0x9a, 0x9b, 0xff, 	/*Color of index 202*/
-  0x85, 0x98, 0x94, 0xff, 	/*Color of index 203*/
-  0x8b, 0x94, 0x93, 0xff, 	/*Color of index 204*/
-  0x80, 0x94, 0x90, 0xff, 	/*Color of index 205*/
-  0x7d, 0x90, 0x8d, 0xff, 	/*Color of index 206*/
-  0x79, 0x8c, 0x89, 0xff, 	/*Color of index 207*/
-  0x75, 0x88, 0x85, 0xff, 	/*Color of index 208*/
-  0x72, 0x83, 0x81, 0xff, 	/*Color of index 209*/
-  0x6c, 0x80, 0x7d, 0xff, 	/*Color of index 210*/
-  0x69, 0x7c, 0x7b, 0xff, 	/*Color of index 211*/
-  0x65, 0x77, 0x74, 0xff, 	/*Color of index 212*/
-  0x62, 0x71, 0x72, 0xff, 	/*Color of index 213*/
-  0x58, 0x6b, 0x69, 0xff, 	/*Color of index 214*/
-  0x58, 0x62, 0x63, 0xff, 	/*Color of index 215*/
-  0x49, 0x5a, 0x5a, 0xff, 	/*Color of index 216*/
-  0x48, 0x53, 0x51, 0xff, 	/*Color of index 217*/
-  0x45, 0x4c, 0x4c, 0xff, 	/*Color of index 218*/
-  0x35, 0x3d, 0x3d, 0xff, 	/*Color of index 219*/
-  0x2d, 0x34, 0x32, 0xff, 	/*Color of index 220*/
-  0x1e, 0x2d, 0x2d, 0xff, 	/*Color of index 221*/
-  0x2a, 0x2c, 0x2c, 0xff, 	/*Color of index 222*/
-  0x11, 0x21, 0x1e, 0xff, 	/*Color of index 223*/
-  0x09, 0x11, 0x11, 0xff, 	/*Color of index 224*/
-  0x06, 0x0a, 0x0a, 0xff, 	/*Color of index 225*/
-  0xed, 0xf1, 0xef, 0xff, 	/*Color of index 226*/
-  0xea, 0xec, 0xeb, 0xff, 	/*Color of index 227*/
-  0xbb, 0xbc, 0xbb, 0xff, 	/*Color of index 228*/
-  0x84, 0x85, 0x84, 0xff, 	/*Color of index 229*/
-  0x20, 0x23, 0x21, 0xff, 	/*Color of index 230*/
-  0x15, 0x19, 0x17, 0xff, 	/*Color of index 231*/
-  0x01, 0x02, 0x01, 0xff, 	/*Color of index 232*/
-  0x55, 0x57, 0x54, 0xff, 	/*Color of index 233*/
-  0x40, 0x45, 0x3f, 0xff, 	/*Color of index 234*/
-  0xf8, 0xfb, 0xe8, 0xff, 	/*Color of index 235*/
-  0xf0, 0xec, 0xd4, 0xff, 	/*Color of index 236*/
-  0xf9, 0xe8, 0xb9, 0xff, 	/*Color of index 237*/
-  0xe6, 0xde, 0xbf, 0xff, 	/*Color of index 238*/
-  0xc7, 0xbd, 0xa3, 0xff, 	/*Color of index 239*/
-  0xbd, 0xb3, 0x98, 0xff, 	/*Color of index 240*/
-  0x98, 0x98, 0x94, 0xff, 	/*Color of index 241*/
-  0x9a, 0x93, 0x70, 0xff, 	/*Color of index 242*/
-  0x65, 0x58, 0x39, 0xff, 	/*Color of index 243*/
-  0x44, 0x3a, 0x21, 0xff, 	/*Color of index 244*/
-  0xfa, 0xf9, 0xf7, 0xff, 	/*Color of index 245*/
-  0xda, 0xcc, 0xad, 0xff, 	/*Color of index 246*/
-  0xb4, 0xa5, 0x89, 0xff, 	/*Color of index 247*/
-  0x8e, 0x81, 0x69, 0xff, 	/*Color of index 248*/
-  0x7b, 0x73, 0x61, 0xff, 	/*Color of index 249*/
-  0x74, 0x67, 0x4e, 0xff, 	/*Color of index 250*/
-  0x33, 0x2d, 0x20, 0xff, 	/*Color of index 251*/
-  0x1c, 0x15, 0x06, 0xff, 	/*Color of index 252*/
-  0x0f, 0x07, 0x01, 0xff, 	/*Color of index 253*/
-  0xf0, 0xee, 0xef, 0xff, 	/*Color of index 254*/
-  0xf9, 0xf6, 0xfa, 0xff, 	/*Color of index 255*/
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf5, 0xf5, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xe2, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0xa7, 0xa7, 0x00, 0x00, 0xa4, 0x00, 0xf5, 0xf5, 0x00, 0x00, 0xe2, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xae, 0x49, 0x57, 0xe4, 0xb5, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa5, 0x00, 0xa7, 0x63, 0xde, 0xe1, 0xe6, 0xe0, 0xe6, 0xe7, 0xe1, 0xda, 0xe4, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa7, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x49, 0x9e, 0xe6, 0x6e, 0xba, 0xe3, 0xa7, 0xa7, 0xae, 0xe4, 0xd9, 0xe8, 0xda, 0xae, 0x00, 0xa4, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf5, 0x00, 0xa4, 0x00, 0xf5, 0x00, 0x00, 0xf5, 0x3d, 0xe5, 0x74, 0x7d, 0xc1, 0xba, 0xe1, 0xd7, 0xff, 0xe2, 0x00, 0xe3, 0xae, 0x00, 0xfe, 0xab, 0x00, 0xba, 0xda, 0xe6, 0x3d, 0x00, 0x00, 0x00, 0xfe, 0xae, 0xae, 0xae, 0x00, 0xe2, 0xf5, 0x00, 0xa4, 0xa7, 0x00, 0xa7, 0x00, 0x00, 0xa4, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0x00, 0xa5, 0x00, 0xe3, 0x00, 0xa5, 0xfe, 0xfe, 0xd9, 0xe8, 0xe6, 0x84, 0xdb, 0xe6, 0xe8, 0x74, 0x00, 0xe3, 0xe3, 0xaf, 0xa4, 0x00, 0xb9, 0xe3, 0x00, 0xab, 0x00, 0xe3, 0xda, 0xde, 0x00, 0xba, 0xd7, 0xde, 0xe1, 0xe7, 0x9e, 0xe7, 0xe6, 0xcc, 0xb5, 0xf5, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0xf5, 0xa7, 0xe4, 0xb3, 0xb3, 0xe7, 0xdb, 0x3d, 0x00, 0xf5, 0xf5, 0xf5, 0x5c, 0xe2, 0xe2, 0xab, 0xe2, 0x3d, 0xab, 0xae, 0x00, 0xa5, 0x3d, 0x3d, 0xab, 0xe2, 0x00, 0xde, 0xda, 0xe1, 0xdb, 0xc6, 0xb5, 0xb5, 0x49, 0x57, 0xe5, 0x9e, 0xe1, 0xe5, 0xe2, 0xa7, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x00, 0xc6, 0xe6, 0xe8, 0x9e, 0xe7, 0xe8, 0xe9, 0x00, 0x00, 0xe2, 0xff, 0xa4, 0xaa, 0x00, 0x00, 0x3d, 0x00, 0xa7, 0xe2, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xaa, 0xae, 0xa7, 0xa4, 0x63, 0xdc, 0xb3, 0x00, 0xb3, 0xb0, 0xae, 0xa7, 0xaa, 0x00, 0xe2, 0xc6, 0xe0, 0xdb, 0x00, 0xe2, 0x2b, 0xf5, 0xa4, 0x00, 0x00, 0xa5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa7, 0xa7, 0x7d, 0xe0, 0xe5, 0xa7, 0xb5, 0xfe, 0x78, 0xa7, 0xa5, 0xae, 0x00, 0xa4, 0x00, 0x00, 0xe2, 0xa5, 0x00, 0xad, 0x00, 0xa5, 0x00, 0x00, 0xa4, 0xa5, 0xa4, 0x00, 0xa4, 0xe3, 0xe2, 0xb5, 0xe3, 0xae, 0xc1, 0xb6, 0xba, 0xc6, 0xbe, 0x57, 0xe4, 0xb0, 0x00, 0xb3, 0xdc, 0xde, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xe5, 0xe8, 0xb3, 0xa7, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0xa5, 0x00, 0xa7, 0xa8, 0x00, 0x00, 0xa4, 0x00, 0xa7, 0xb0, 0xe2, 0xaf, 0x29, 0xaf, 0xaf, 0x49, 0xc0, 0xb7, 0x57, 0xbb, 0xc3, 0x57, 0xbd, 0x00, 0xad, 0xdc, 0xdc, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xae, 0xe8, 0xe4, 0x00, 0xf5, 0xfe, 0x00, 0xa5, 0x00, 0xe2, 0x00, 0xa5, 0x00, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0x00, 0xa4, 0xa7, 0x00, 0xa4, 0x00, 0xa5, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xa5, 0x00, 0xa9, 0xa4, 0xbd, 0xba, 0xbe, 0xba, 0xc0, 0x57, 0xbe, 0x00, 0xaa, 0xe8, 0xc1, 0xe3, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0xf5, 0x00, 0x00, 0x57, 0xc1, 0x5c, 0xd9, 0xea, 0xa4, 0xa4, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa7, 0xe3, 0xa6, 0x00, 0x00, 0xb1, 0xbe, 0xbd, 0xbd, 0x57, 0xbf, 0xc0, 0xb8, 0xa5, 0xcc, 0xe0, 0x3d, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xf5, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xc6, 0x9e, 0x9e, 0xe0, 0xe6, 0xe6, 0xd9, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa4, 0xaf, 0x57, 0xf1, 0xc1, 0xb3, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa7, 0xfe, 0xa7, 0xa4, 0x29, 0xab, 0xb6, 0xb5, 0xbb, 0xbf, 0xbc, 0x57, 0xbf, 0xaa, 0xb3, 0xe1, 0xe4, 0x00, 0xe3, 0xa4, 0xf5, 0xf5, 0x00, 0xa7, 0xff, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xfe, 0x00, 0xd7, 0xfd, 0x74, 0xe3, 0x00, 0x00, 0xae, 0xba, 0xa5, 0xa5, 0x00, 0x00, 0xa5, 0xa4, 0xc1, 0xc6, 0x3d, 0xa7, 0xe4, 0xc1, 0x49, 0xf5, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa7, 0xa8, 0xa8, 0xa8, 0xa9, 0xac, 0xaa, 0xb1, 0xb7, 0xb7, 0xbe, 0xc4, 0xb8, 0x00, 0xe9, 0x84, 0x3d, 0x00, 0x00, 0xa4, 0xf5, 0xa7, 0x00, 0x00, 0xae, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe1, 0xe3, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0xa5, 0xe4, 0x3d, 0xfe, 0xe3, 0x00, 0x00, 0xa5, 0xba, 0xae, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe2, 0xa9, 0xa9, 0xa8, 0xac, 0xa6, 0xaa, 0xb3, 0xbd, 0xc0, 0xc1, 0x00, 0xcc, 0xe8, 0x9e, 0xe6, 0x84, 0xba, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf1, 0xe1, 0xfe, 0x00, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa5, 0xae, 0xa7, 0x00, 0x00, 0xa4, 0xa7, 0x00, 0x00, 0xae, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa8, 0xa9, 0xaa, 0xb0, 0xa6, 0xa6, 0xaf, 0xb7, 0xba, 0xc5, 0xaa, 0x6e, 0x74, 0x49, 0xe5, 0xdb, 0xe0, 0xd9, 0xae, 0x00, 0xa7, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xe0, 0xc1, 0x00, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0xa5, 0xa7, 0xa4, 0x00, 0x00, 0x00, 0xae, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa9, 0xaa, 0xab, 0xac, 0xa9, 0xab, 0xb1, 0xbb, 0xc4, 0x3d, 0xf1, 0xcc, 0xae, 0x00, 0x00, 0x57, 0xda, 0xe1, 0xe4, 0x00, 0xae, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xde, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xa4, 0xa9, 0xa9, 0x29, 0xad, 0xa9, 0xa9, 0xb2, 0x57, 0xc0, 0xb8, 0x63, 0xc6, 0xbd, 0xe4, 0xb7, 0x00, 0xf5, 0xd7, 0xe8, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xea, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa9, 0xa8, 0xaa, 0xb0, 0xa6, 0xac, 0xb4, 0xbf, 0xbc, 0xbc, 0xc0, 0xbe, 0x5c, 0x57, 0xc1, 0xbd, 0xa4, 0x00, 0xd7, 0xe0, 0x00, 0xe2, 0xf5, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xa7, 0x00, 0x74, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa6, 0xaa, 0xad, 0xa6, 0xa8, 0xac, 0xb5, 0xba, 0xba, 0xbb, 0xbf, 0x57, 0xbf, 0x57, 0xc0, 0xbe, 0x5c, 0xc0, 0x00, 0xe3, 0xe7, 0x6e, 0xf5, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xe3, 0x00, 0xf5, 0x00, 0x00, 0xb5, 0xda, 0xea, 0xff, 0x00, 0xa5, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xa9, 0xab, 0xad, 0xaa, 0xaa, 0xb2, 0xbb, 0xbd, 0xbb, 0xbc, 0xb9, 0xbd, 0xbd, 0x5c, 0xbf, 0xc1, 0xc4, 0x49, 0x00, 0x78, 0xe7, 0x00, 0xa4, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xe0, 0xe7, 0xe6, 0xdb, 0xba, 0xf5, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa6, 0xab, 0xb2, 0xb2, 0xa6, 0xac, 0xba, 0xbc, 0xb5, 0xb5, 0xb2, 0xb4, 0xb7, 0xbd, 0xc0, 0xbf, 0xc4, 0xc1, 0xa9, 0x3d, 0xe8, 0x49, 0x00, 0xa4, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xe3, 0xf5, 0xd7, 0xe8, 0x74, 0xb3, 0x00, 0xe3, 0x3d, 0xe3, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa6, 0xaa, 0xb5, 0xb7, 0xab, 0xa6, 0xb4, 0xb6, 0xaa, 0xac, 0xaf, 0xb0, 0xaf, 0xb4, 0xbe, 0xc0, 0xc1, 0xc4, 0xaf, 0xa4, 0xde, 0xf1, 0xae, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x7d, 0xe0, 0x3d, 0xf5, 0xa4, 0xe2, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa9, 0xb5, 0xbb, 0xb2, 0x29, 0xad, 0xab, 0x29, 0xa9, 0xaa, 0xb2, 0xb1, 0xb1, 0xbb, 0xc1, 0xc0, 0xc6, 0xaf, 0xa8, 0xe7, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc6, 0xe8, 0xae, 0x00, 0xff, 0x00, 0xa7, 0x00, 0xa4, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa8, 0xaa, 0xb4, 0xbe, 0xb8, 0xa9, 0xa9, 0xa8, 0xa6, 0xa9, 0x29, 0xb2, 0xb6, 0xb0, 0xb7, 0xbf, 0xc0, 0xc7, 0xb3, 0xaf, 0x92, 0xe1, 0xdb, 0xe3, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xe7, 0xf1, 0x00, 0xf5, 0xa7, 0xfe, 0xf5, 0x00, 0xa7, 0xa5, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa7, 0xff, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0xa5, 0xa8, 0xaa, 0xab, 0xb8, 0x57, 0xbc, 0xad, 0xa8, 0xa9, 0xa9, 0xa9, 0x29, 0xac, 0xb7, 0xb1, 0xb6, 0xbf, 0xc0, 0xc4, 0xae, 0xba, 0xe7, 0xe2, 0xde, 0xdb, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xe6, 0x00, 0x00, 0xe3, 0xa7, 0xfe, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa7, 0xe2, 0xa7, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0xa6, 0xaa, 0xac, 0xac, 0xbb, 0xc0, 0xbc, 0xb0, 0xa6, 0xaa, 0xac, 0x29, 0xaa, 0xaa, 0xb2, 0xb2, 0xb8, 0xc3, 0xc0, 0xc2, 0xa6, 0xd7, 0xea, 0x49, 0x00, 0xe7, 0x78, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xe9, 0xa8, 0x00, 0xa5, 0xab, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0xe2, 0xa8, 0xa4, 0xa6, 0x00, 0x29, 0x00, 0xa6, 0xab, 0xab, 0xab, 0xfe, 0x2e, 0xab, 0x2c, 0xa9, 0x34, 0xa9, 0xaa, 0xb6, 0xc2, 0xbb, 0xc0, 0xad, 0xad, 0xad, 0xa8, 0xaa, 0xb1, 0xaf, 0xb2, 0xad, 0xbd, 0xbf, 0xc2, 0xb9, 0xc0, 0xdd, 0xcc, 0xc8, 0xad, 0xba, 0x28, 0xae, 0x00, 0xa4, 0x2b, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xea, 0xd3, 0x00, 0xaa, 0xad, 0xa5, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xa6, 0xa8, 0x29, 0x29, 0x29, 0xa6, 0x29, 0x29, 0xad, 0xb7, 0xb1, 0xa4, 0xa9, 0xaf, 0xb0, 0xad, 0xa9, 0x2d, 0xb1, 0xbd, 0xc0, 0xbf, 0xc8, 0xb2, 0xac, 0xb2, 0xb1, 0xb2, 0xb1, 0xb3, 0xb8, 0xb7, 0xbf, 0xc2, 0xc4, 0xbe, 0xd9, 0xcd, 0xc8, 0xc8, 0xba, 0x29, 0xdc, 0x74, 0x2b, 0x00, 0x00, 0xa4, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xd6, 0x00, 0xa9, 0xe2, 0xa8, 0xa9, 0xa4, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xe2, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xa4, 0xa4, 0xab, 0xac, 0xa9, 0xa6, 0xa9, 0xa6, 0xa9, 0xb4, 0xbd, 0xb9, 0xad, 0xa6, 0x29, 0xa6, 0xa6, 0xa9, 0xb2, 0xbe, 0xc2, 0xc2, 0xc2, 0xc8, 0xb4, 0xaf, 0xb1, 0xb3, 0xb6, 0xb3, 0xb7, 0xbe, 0xbe, 0xc2, 0xc2, 0xc5, 0xc2, 0xbf, 0xbe, 0xd0, 0xd0, 0xc2, 0x00, 0xdb, 0x6e, 0x00, 0xae, 0x00, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xd4, 0xdb, 0xa4, 0xa9, 0xe2, 0xaa, 0xe2, 0xa8, 0xa5, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xa5, 0x00, 0xa4, 0xb3, 0xa4, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xa4, 0xf5, 0x00, 0x00, 0xa4, 0xa6, 0xad, 0xb6, 0xb4, 0xad, 0xad, 0xb1, 0xb7, 0xbc, 0xbd, 0xbe, 0xbe, 0xb9, 0xb4, 0xb4, 0xb6, 0xb7, 0xbf, 0xc5, 0xc2, 0xc7, 0xc2, 0x5c, 0xb9, 0xb3, 0xb3, 0xb0, 0xb5, 0x44, 0x49, 0x57, 0x59, 0xc2, 0xc0, 0xc2, 0xc4, 0xc4, 0xc5, 0xc7, 0xcf, 0xbc, 0xac, 0xdc, 0xdb, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xe4, 0xe6, 0xb4, 0xe3, 0xad, 0xa4, 0xe2, 0xad, 0xa8, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xba, 0x00, 0x2c, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa6, 0xa4, 0xb1, 0xbb, 0xbb, 0xb9, 0xb9, 0xbc, 0xbf, 0xbf, 0xbe, 0xbe, 0xc3, 0xbf, 0xf0, 0xc3, 0xc3, 0xbf, 0xc3, 0xc9, 0xc7, 0xc4, 0xc7, 0xc5, 0xbb, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0xbc, 0x59, 0xc2, 0x59, 0xc2, 0xc7, 0xc2, 0xc2, 0xcb, 0xce, 0xbb, 0xc3, 0xd7, 0xdf, 0xdc, 0xe3, 0xa7, 0xa4, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xab, 0xe0, 0xd7, 0xab, 0xb3, 0xaa, 0xac, 0xb2, 0xab, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0xa4, 0x3d, 0xe4, 0xa4, 0xff, 0x2b, 0x2b, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa4, 0xa6, 0xaa, 0xb4, 0xbb, 0xbe, 0xbc, 0xbf, 0xbf, 0xbe, 0xbe, 0xc2, 0xc0, 0xbe, 0xc0, 0xbf, 0xc2, 0xc7, 0xc5, 0xc9, 0xc7, 0xc5, 0xc3, 0xce, 0xca, 0x4f, 0xb0, 0x44, 0x49, 0x44, 0xb5, 0x44, 0xb8, 0x5c, 0xc4, 0xc5, 0xc7, 0xcd, 0xc7, 0xcd, 0xca, 0xc7, 0xc8, 0xce, 0xbb, 0x00, 0xde, 0xda, 0xe2, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe7, 0xd7, 0xb7, 0xba, 0xbc, 0xb5, 0xbb, 0xb1, 0xeb, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0xa4, 0xbe, 0xba, 0x3d, 0xab, 0xa8, 0xa7, 0x2b, 0xa4, 0x29, 0x00, 0x00, 0x00, 0x29, 0xa6, 0xa6, 0xaa, 0xb2, 0xbb, 0xbb, 0xbd, 0xbd, 0xbe, 0xbf, 0xbe, 0xbf, 0xc4, 0xc5, 0xc3, 0xc9, 0xc9, 0xc3, 0xc7, 0xc9, 0xc7, 0xc4, 0xc8, 0xd2, 0xd1, 0x5c, 0xbc, 0xb2, 0x49, 0x44, 0x49, 0xb5, 0x49, 0xb8, 0xc7, 0xc7, 0xca, 0xc7, 0x70, 0xdd, 0x94, 0xdb, 0x8d, 0x7d, 0xc4, 0x63, 0xaa, 0xae, 0xfd, 0xae, 0x00, 0xf5, 0x00, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xe6, 0xd4, 0x00, 0xbf, 0xbc, 0xb9, 0xb9, 0xc0, 0xb6, 0xaa, 0xa6, 0xeb, 0x29, 0x00, 0xa4, 0x00, 0x00, 0xa6, 0x00, 0x63, 0xb9, 0xba, 0xb5, 0xa9, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x29, 0xa9, 0xa6, 0xac, 0xbb, 0xbf, 0xbe, 0xbe, 0xc0, 0xbf, 0xc0, 0xc5, 0xc5, 0xc2, 0xc7, 0xce, 0xbf, 0xc5, 0xc5, 0xc5, 0xc5, 0xc2, 0xc7, 0xd5, 0xdb, 0xd3, 0xbb, 0x57, 0xbb, 0x49, 0xb4, 0xb8, 0xb8, 0xb7, 0xbb, 0xcb, 0xc8, 0xca, 0x62, 0xd0, 0x8b, 0x62, 0x76, 0xd8, 0x97, 0xa2, 0x94, 0x57, 0xff, 0xdc, 0xcc, 0xf5, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xe7, 0x3d, 0xae, 0xbe, 0xba, 0xbe, 0xbc, 0xc5, 0xb4, 0xbc, 0xb4, 0x29, 0xeb, 0xac, 0xa4, 0xa9, 0x29, 0xaf, 0x00, 0xd5, 0xba, 0xb4, 0xc0, 0xb9, 0xaf, 0xa6, 0xa9, 0xac, 0xa6, 0xeb, 0xa6, 0xa6, 0xac, 0xb6, 0xbe, 0xbf, 0xbe, 0xbf, 0xc3, 0xbe, 0xc9, 0xbe, 0xc4, 0xc4, 0xc4, 0xd5, 0xa1, 0x85, 0x82, 0x7c, 0x76, 0x7c, 0xd8, 0x94, 0xa1, 0xd1, 0xca, 0xc8, 0xc4, 0xb8, 0xb4, 0xb9, 0xb8, 0xb1, 0xbe, 0xc0, 0xc5, 0xc7, 0xce, 0x62, 0xd3, 0x8c, 0x59, 0x4a, 0x43, 0x43, 0x62, 0x88, 0x28, 0xda, 0xe6, 0xe4, 0x00, 0xe2, 0xf5, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x9e, 0x00, 0xbd, 0xc6, 0xb9, 0xc0, 0xb9, 0xd2, 0xbc, 0xb2, 0xbf, 0xc3, 0xb0, 0xb4, 0xb1, 0xad, 0xac, 0xb4, 0xb9, 0xd8, 0xcd, 0xaf, 0xbe, 0xbe, 0xbf, 0xbb, 0xb6, 0xb1, 0xb1, 0xb6, 0xb7, 0xbb, 0xbf, 0xc2, 0xc4, 0xc2, 0xc0, 0xbf, 0xbf, 0xc9, 0xbf, 0xc5, 0xca, 0x62, 0x5e, 0x94, 0x7c, 0x8c, 0x98, 0x97, 0x91, 0x9b, 0x94, 0x7c, 0xdd, 0x69, 0xcb, 0xca, 0xc7, 0xbd, 0xb9, 0xb7, 0xee, 0xbb, 0xef, 0xc9, 0xc9, 0xce, 0xd3, 0x59, 0x85, 0x7c, 0x53, 0x51, 0x4a, 0x35, 0x39, 0x35, 0x43, 0x84, 0xe8, 0xda, 0x3d, 0x00, 0x00, 0xae, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xa7, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xdc, 0xa4, 0xb9, 0xba, 0xc4, 0xc3, 0xbf, 0xc4, 0xd5, 0xb1, 0xc4, 0xc4, 0xc0, 0xc0, 0xc2, 0xc0, 0xc4, 0xc4, 0xc7, 0xcf, 0xdb, 0xaa, 0xbf, 0xbe, 0xbe, 0xbf, 0xc5, 0xc7, 0xc3, 0xc0, 0xc0, 0xbf, 0xc0, 0xc0, 0xbd, 0xbc, 0xc2, 0xc7, 0xc5, 0xbc, 0xcf, 0x59, 0x69, 0x62, 0x85, 0x8e, 0x62, 0x66, 0x5a, 0x6f, 0x73, 0x5a, 0x5e, 0x5f, 0x88, 0x82, 0xce, 0xca, 0xd1, 0xce, 0xc0, 0xc3, 0xc9, 0xc9, 0xce, 0xcd, 0xcf, 0xca, 0xc5, 0x73, 0x98, 0x56, 0x42, 0x4d, 0x47, 0x39, 0x3e, 0x33, 0x2b, 0x29, 0x4c, 0xde, 0xa1, 0xba, 0xfe, 0x00, 0xff, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xe8, 0xaf, 0xb4, 0x6e, 0xbe, 0xc1, 0xbe, 0xc2, 0xd9, 0xca, 0x29, 0xc4, 0x5e, 0xc2, 0x62, 0xc2, 0xca, 0xc7, 0x5c, 0xbf, 0xdc, 0xc7, 0xad, 0xc7, 0xc2, 0xbe, 0xbe, 0xbf, 0xc0, 0xc2, 0xbf, 0xc2, 0xc4, 0xc5, 0xc5, 0xc5, 0xc9, 0xc7, 0xc4, 0xcf, 0xca, 0x69, 0x51, 0x85, 0x9c, 0x73, 0x64, 0x06, 0x89, 0x93, 0x96, 0x8c, 0x83, 0x5a, 0x76, 0xa3, 0x70, 0xc2, 0xcf, 0xca, 0xce, 0xd2, 0xc7, 0xcf, 0xce, 0xca, 0xcf, 0x69, 0x88, 0x9b, 0x5a, 0x4d, 0x36, 0x3b, 0x39, 0x39, 0x47, 0x40, 0x40, 0x34, 0x2c, 0x2b, 0x76, 0xe8, 0x63, 0xa4, 0x00, 0x00, 0xa4, 0xfe, 0xe3, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe5, 0x00, 0xbf, 0xc3, 0x5c, 0xc7, 0x5c, 0xc2, 0xa1, 0xce, 0x34, 0x59, 0x62, 0xc5, 0x5e, 0x63, 0x62, 0xbf, 0x62, 0xd9, 0xa3, 0xbb, 0xb0, 0xc0, 0xcf, 0xc9, 0xbf, 0xc2, 0xc7, 0xc9, 0xc7, 0xc4, 0xc2, 0xc5, 0xc7, 0xc7, 0xc7, 0xca, 0xca, 0x59, 0x59, 0x96, 0x9d, 0x66, 0x6a, 0x58, 0x06, 0x99, 0x9c, 0x9c, 0x9c, 0xa0, 0x7b, 0x5a, 0x7f, 0x9d, 0x7f, 0x5e, 0xd3, 0xd1, 0x5c, 0xd1, 0x70, 0xca, 0x6d, 0x7f, 0x9b, 0x8e, 0x5a, 0x53, 0x48, 0x39, 0x39, 0x36, 0x33, 0x35, 0x33, 0x33, 0x3f, 0x3a, 0x2e, 0x34, 0x57, 0x28, 0x8d, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc6, 0xe1, 0xbc, 0xa5, 0xc0, 0xc0, 0xcc, 0xc7, 0x62, 0xc7, 0xa3, 0x8b, 0x59, 0x51, 0x56, 0x59, 0x5a, 0x57, 0x76, 0x94, 0x76, 0xd0, 0xa3, 0xd0, 0x59, 0xb8, 0xbf, 0xca, 0xca, 0xc2, 0xbf, 0xc5, 0x5c, 0xc4, 0xc8, 0xcb, 0xc7, 0xc5, 0xca, 0x5e, 0x7f, 0x98, 0x93, 0x6a, 0x71, 0x58, 0x39, 0x3b, 0x52, 0x41, 0x4b, 0x42, 0x5a, 0x6f, 0x4d, 0x5a, 0x8c, 0x9d, 0x8d, 0x7b, 0x70, 0x70, 0x76, 0x7f, 0x87, 0x9d, 0x91, 0x71, 0x5f, 0x61, 0x50, 0x42, 0x39, 0x32, 0x39, 0x37, 0x32, 0x32, 0x37, 0x2f, 0x38, 0x3a, 0x2e, 0xa4, 0x3a, 0x9a, 0x9a, 0xe4, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xdf, 0xc6, 0xaf, 0xbb, 0xbd, 0x59, 0xca, 0x90, 0xd8, 0x90, 0xa2, 0x97, 0x90, 0x8d, 0x8a, 0xa2, 0x9f, 0x73, 0x70, 0x45, 0x5e, 0xa2, 0x90, 0x82, 0xd3, 0x69, 0xc5, 0x72, 0xda, 0x94, 0xd9, 0xd4, 0xce, 0xcb, 0xd1, 0xd6, 0x8b, 0xa2, 0x8d, 0x8a, 0x6a, 0x65, 0x4e, 0x41, 0x41, 0x3b, 0x4b, 0x36, 0x39, 0x40, 0x35, 0x36, 0x48, 0x39, 0x51, 0x73, 0x8e, 0x9b, 0x9d, 0x9f, 0xa0, 0x93, 0x93, 0x96, 0x8f, 0x75, 0x06, 0x66, 0x5f, 0x4e, 0x40, 0x32, 0x2f, 0x32, 0x2f, 0x2f, 0x32, 0x32, 0x30, 0x35, 0x45, 0x3a, 0xff, 0x31, 0x74, 0xe8, 0x74, 0xa7, 0x00, 0xe3, 0xa4, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x57, 0xe1, 0x28, 0xa1, 0x8d, 0x94, 0x97, 0x9b, 0x82, 0x4f, 0x4a, 0x62, 0x7c, 0x87, 0x8a, 0x89, 0x73, 0x5f, 0x5a, 0x38, 0x35, 0x30, 0x4c, 0x7c, 0x9b, 0xa2, 0x9b, 0x9f, 0x9b, 0x8b, 0x88, 0x90, 0x9b, 0xdf, 0x9f, 0x9b, 0x94, 0x8d, 0x79, 0x73, 0x64, 0x61, 0x48, 0x3e, 0x39, 0x3b, 0x39, 0x32, 0x3e, 0x40, 0x35, 0x40, 0x4b, 0x39, 0x3b, 0x42, 0x53, 0x64, 0x6a, 0x73, 0x75, 0x73, 0x71, 0x71, 0x23, 0x89, 0x24, 0x93, 0x0b, 0x5b, 0x5b, 0x50, 0x39, 0x2f, 0x32, 0x2f, 0x2f, 0x2a, 0x32, 0x30, 0x34, 0x2a, 0x3f, 0x3f, 0x2b, 0x2e, 0x59, 0x9e, 0xde, 0xe4, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x28, 0x72, 0x4d, 0x73, 0x7e, 0x7b, 0x98, 0x70, 0x43, 0x30, 0x2a, 0x3c, 0x2f, 0x45, 0x48, 0x4d, 0x48, 0x40, 0x33, 0x33, 0x30, 0x33, 0x2f, 0x38, 0x51, 0x62, 0x73, 0x73, 0x6d, 0x62, 0x64, 0x69, 0x72, 0x73, 0x73, 0x72, 0x6d, 0x66, 0x6a, 0x5b, 0x54, 0x3b, 0x3e, 0x36, 0x36, 0x39, 0x42, 0x54, 0x53, 0x5a, 0x4d, 0x4d, 0x4a, 0x2e, 0x5f, 0x4d, 0x48, 0x47, 0x5a, 0x5d, 0x6f, 0x6c, 0x0d, 0x0f, 0x8c, 0x1a, 0x77, 0x95, 0x26, 0x1a, 0x08, 0x05, 0x01, 0x3b, 0x32, 0x2a, 0x2a, 0xa6, 0x2a, 0x2f, 0x2f, 0x30, 0x34, 0x38, 0x3a, 0x3f, 0x29, 0x34, 0xd7, 0xe8, 0xda, 0xb4, 0x00, 0x00, 0xff, 0x31, 0xa4, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x00, 0xe2, 0x00, 0x00, 0xf5, 0x00, 0x84, 0x28, 0x4d, 0x3f, 0x58, 0x50, 0x5f, 0x66, 0x8e, 0x53, 0x2a, 0x38, 0x37, 0x30, 0x32, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x32, 0x2d, 0x3f, 0x2f, 0x30, 0x2f, 0x30, 0x35, 0x3f, 0x43, 0x47, 0x47, 0x3c, 0x48, 0x4d, 0x56, 0x56, 0x56, 0x54, 0x53, 0x46, 0x40, 0x3b, 0x3b, 0x35, 0x3b, 0x4a, 0x43, 0x64, 0x7b, 0x91, 0x8a, 0x98, 0x79, 0x5f, 0x53, 0x91, 0x48, 0x48, 0x48, 0x46, 0x50, 0x5d, 0x0b, 0x71, 0x0d, 0x1c, 0x1c, 0x0d, 0x1a, 0x26, 0x24, 0x24, 0x17, 0x0a, 0x01, 0x3e, 0x37, 0xaa, 0x2a, 0x2a, 0x2d, 0x2e, 0x32, 0x33, 0x37, 0x38, 0x3c, 0x4a, 0x2a, 0x29, 0xbd, 0x92, 0xe1, 0xd7, 0x3d, 0xa4, 0xff, 0x31, 0x00, 0xff, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0xa7, 0x00, 0xa4, 0x00, 0xa4, 0xda, 0x9a, 0x44, 0xff, 0x47, 0x48, 0x48, 0x58, 0x66, 0x93, 0x56, 0x30, 0x56, 0x62, 0x29, 0x37, 0x51, 0x5a, 0x5f, 0x37, 0x32, 0x37, 0x2d, 0x2e, 0x32, 0x34, 0x2e, 0x29, 0x29, 0x2a, 0x2d, 0x2c, 0x2a, 0x2a, 0x2f, 0x35, 0x37, 0x3c, 0x3c, 0x37, 0x39, 0x3b, 0x3b, 0x36, 0x36, 0x3b, 0x39, 0x43, 0x7f, 0xa2, 0x28, 0x28, 0xa3, 0x28, 0x28, 0x9a, 0x9a, 0x88, 0x4d, 0x36, 0x42, 0x50, 0x41, 0x39, 0x65, 0x0d, 0x6b, 0x86, 0x95, 0x0d, 0x77, 0x95, 0x24, 0x25, 0x25, 0x24, 0x17, 0x05, 0x3e, 0x33, 0x35, 0x33, 0x30, 0x30, 0x30, 0x35, 0x36, 0x39, 0x39, 0x3c, 0x4d, 0x4d, 0x29, 0x29, 0x63, 0xde, 0xa1, 0xd7, 0x44, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x2b, 0xda, 0xde, 0xb3, 0xff, 0x3f, 0x33, 0x4d, 0x4d, 0x48, 0x66, 0x93, 0x51, 0x2a, 0x51, 0x94, 0x4f, 0x72, 0x8d, 0xdd, 0xdd, 0xd6, 0x59, 0x29, 0x3f, 0xac, 0x29, 0x2e, 0x2a, 0x29, 0x29, 0x29, 0x29, 0x00, 0x29, 0x2d, 0x2f, 0x2f, 0x32, 0x30, 0x2f, 0x33, 0x32, 0x32, 0x36, 0x3b, 0x36, 0x42, 0x45, 0x7c, 0x28, 0xdc, 0x74, 0x74, 0xf9, 0xdb, 0xe6, 0x28, 0x28, 0x69, 0x45, 0x4a, 0x48, 0x40, 0x52, 0x5b, 0x54, 0x6c, 0x71, 0x7a, 0x99, 0x13, 0x71, 0x21, 0x1f, 0x1f, 0x22, 0x22, 0x25, 0x26, 0x23, 0x71, 0x52, 0x41, 0x3e, 0x35, 0x33, 0x35, 0x39, 0x3e, 0x3b, 0x39, 0x3e, 0x3e, 0x4d, 0x53, 0x30, 0x2c, 0x5a, 0x92, 0xa2, 0xd7, 0xb6, 0x00, 0xeb, 0xe2, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xff, 0x00, 0x8b, 0x9a, 0xb0, 0x00, 0xb5, 0x34, 0x43, 0x33, 0x42, 0x54, 0x5d, 0x91, 0x51, 0x2e, 0x3f, 0x92, 0x94, 0xe0, 0xe8, 0xe1, 0xe7, 0xe8, 0xdf, 0xbe, 0x29, 0x2c, 0x34, 0x29, 0x29, 0x29, 0x00, 0x00, 0x00, 0xa4, 0x29, 0x2a, 0x2d, 0x2f, 0x2f, 0x2f, 0x32, 0x32, 0x35, 0x2f, 0x3b, 0x33, 0x40, 0x33, 0x72, 0xa3, 0x7d, 0xba, 0xf8, 0xf4, 0xe6, 0xf4, 0xea, 0xfc, 0xfd, 0xe1, 0x4c, 0x32, 0x32, 0x54, 0x7a, 0x52, 0x52, 0x68, 0x75, 0x6a, 0x93, 0x80, 0x6b, 0x23, 0x1f, 0x22, 0x20, 0x20, 0x1d, 0x20, 0x24, 0x24, 0x26, 0x1f, 0x80, 0x13, 0x0b, 0x05, 0x02, 0x01, 0x41, 0x02, 0x01, 0x46, 0x01, 0x41, 0x50, 0x58, 0x47, 0x33, 0xb6, 0xdb, 0xe7, 0xd1, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xff, 0x8b, 0x9e, 0xe2, 0xa4, 0xb1, 0x2a, 0x30, 0x3f, 0x36, 0x3e, 0x54, 0x6a, 0x89, 0x5a, 0x34, 0x34, 0x70, 0xe8, 0xa3, 0xe9, 0xe5, 0xf8, 0xf9, 0xfb, 0xe7, 0x3d, 0xa6, 0xa9, 0x2c, 0x29, 0x00, 0x29, 0x00, 0x00, 0xa4, 0x00, 0x2a, 0x2a, 0x2d, 0x2d, 0x2f, 0x2f, 0x30, 0x32, 0x39, 0x35, 0x33, 0x3c, 0x4a, 0x92, 0x74, 0xa7, 0xf9, 0xf3, 0xf7, 0xf8, 0xfa, 0xf4, 0xfb, 0xe7, 0xe1, 0x9f, 0x76, 0x93, 0x93, 0x52, 0x41, 0x5b, 0x6a, 0x73, 0x5f, 0x89, 0x8c, 0x65, 0x1a, 0x21, 0x1d, 0x1d, 0x20, 0x20, 0x1e, 0x1d, 0x1d, 0x1f, 0x24, 0x26, 0x24, 0x24, 0x24, 0x24, 0x24, 0x21, 0x1c, 0x1a, 0x12, 0x0a, 0x0b, 0x02, 0x46, 0x55, 0x56, 0x51, 0x2a, 0xc0, 0xe0, 0xdc, 0xa4, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa7, 0x00, 0xd9, 0x9a, 0xa7, 0x3a, 0x2c, 0xac, 0xac, 0x3f, 0x33, 0x3b, 0x41, 0x6a, 0x52, 0x8c, 0x5f, 0x29, 0x31, 0x78, 0xe1, 0x78, 0xe4, 0xf7, 0xf3, 0xf4, 0xf4, 0xfc, 0xe5, 0xa8, 0x2a, 0x00, 0x29, 0x29, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x2a, 0x2d, 0x2f, 0x2f, 0x2d, 0x2f, 0x2f, 0x2f, 0x37, 0x2a, 0x33, 0x32, 0x74, 0xd8, 0x00, 0xe4, 0xfa, 0xec, 0x00, 0xf6, 0xe6, 0xfa, 0xe9, 0xf4, 0xe0, 0xa1, 0x9b, 0x75, 0x4d, 0x50, 0x41, 0x58, 0x6a, 0x6f, 0x64, 0x7b, 0x93, 0x71, 0x0f, 0x1f, 0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1b, 0x1b, 0x18, 0x18, 0x19, 0x19, 0x1f, 0x1d, 0x1f, 0x22, 0x22, 0x22, 0x25, 0x25, 0x21, 0x1f, 0x15, 0x05, 0x4b, 0x5a, 0x4a, 0x3f, 0x29, 0xdc, 0xdc, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xdb, 0xde, 0xb3, 0x29, 0x00, 0xac, 0xac, 0x32, 0x34, 0x32, 0x36, 0x61, 0x61, 0x61, 0x9c, 0x7e, 0x51, 0x5e, 0x28, 0xda, 0xb5, 0xf0, 0xf4, 0xf2, 0xf9, 0xea, 0xdc, 0xe6, 0xb0, 0x29, 0x2e, 0x2a, 0x29, 0x00, 0x29, 0x00, 0xeb, 0xa4, 0x29, 0x2a, 0x2d, 0xa9, 0x2f, 0x2e, 0x32, 0x33, 0x2f, 0x36, 0x35, 0x3f, 0xd7, 0xaf, 0x00, 0xfa, 0xe9, 0xeb, 0xeb, 0xf0, 0xfd, 0xfd, 0xfb, 0xe9, 0xde, 0x28, 0x62, 0x3a, 0x42, 0x46, 0x4e, 0x54, 0x6c, 0x6d, 0x6a, 0x5f, 0x93, 0x80, 0x6b, 0x1c, 0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x16, 0x16, 0x16, 0x18, 0x18, 0x1b, 0x18, 0x18, 0x19, 0x19, 0x22, 0x24, 0x21, 0x6b, 0x55, 0x58, 0x5a, 0x34, 0x3a, 0xe0, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xf5, 0x00, 0xe3, 0xdb, 0xdc, 0xb1, 0x00, 0x34, 0xa8, 0x2f, 0x30, 0x2f, 0x2f, 0x40, 0x4e, 0x55, 0x0b, 0x17, 0x27, 0x96, 0x9f, 0x28, 0xe7, 0xb5, 0xec, 0xe9, 0xf7, 0xeb, 0xec, 0xfc, 0xea, 0xe7, 0x59, 0x29, 0x2d, 0x2c, 0x2a, 0x29, 0x00, 0x29, 0x00, 0x29, 0x2a, 0x2a, 0x2d, 0x2d, 0x2e, 0x2f, 0x30, 0x2f, 0x32, 0x30, 0x2f, 0x5e, 0xc4, 0xa4, 0xee, 0xe9, 0xf1, 0xef, 0xf1, 0xe7, 0xfd, 0xe8, 0xe8, 0xfb, 0x84, 0xe0, 0x84, 0x40, 0x43, 0x4b, 0x46, 0x5b, 0x6a, 0x6f, 0x6f, 0x64, 0x83, 0x93, 0x0b, 0x17, 0x1f, 0x14, 0x16, 0x16, 0x16, 0x14, 0x1b, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x14, 0x11, 0x11, 0x11, 0x11, 0x14, 0x16, 0x16, 0x18, 0x18, 0x1d, 0x24, 0x0a, 0x52, 0x5d, 0x5a, 0x2d, 0x59, 0xe0, 0xe3, 0x00, 0xa7, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xeb, 0xb4, 0xe6, 0xe9, 0xb4, 0x00, 0x2a, 0x29, 0x34, 0x34, 0x32, 0x30, 0x36, 0x41, 0x06, 0x0b, 0x77, 0x26, 0xa0, 0x80, 0x3c, 0x7c, 0xe5, 0x00, 0xef, 0xfb, 0xef, 0xeb, 0xef, 0xfd, 0xe0, 0xe7, 0x69, 0x31, 0x2f, 0x2d, 0x2d, 0x29, 0x2a, 0x29, 0x29, 0x29, 0x2a, 0x2d, 0x2a, 0x2d, 0x2d, 0x2e, 0x30, 0x2f, 0x33, 0x32, 0x2e, 0x5e, 0xba, 0x00, 0xef, 0xfa, 0xa7, 0x49, 0xfd, 0xfd, 0xfc, 0xe8, 0xfc, 0xe1, 0xe9, 0xe6, 0x8d, 0x4a, 0x43, 0x48, 0x48, 0x58, 0x6a, 0x6a, 0x6a, 0x66, 0x6a, 0x96, 0x7a, 0x0d, 0x19, 0x18, 0x16, 0x11, 0x14, 0x16, 0x11, 0x14, 0x14, 0x14, 0x14, 0x14, 0x11, 0x11, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x10, 0x11, 0x14, 0x18, 0x18, 0x21, 0x05, 0x55, 0x52, 0x56, 0x30, 0xa1, 0xe4, 0x00, 0xf5, 0xf5, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xa7, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xc7, 0xfd, 0xd6, 0xad, 0x00, 0x29, 0xa9, 0x34, 0x29, 0x2f, 0x2f, 0x32, 0x01, 0x65, 0x03, 0x0f, 0x25, 0x23, 0x24, 0x8c, 0x2c, 0x70, 0xba, 0xeb, 0xf8, 0xf2, 0xef, 0xfa, 0xfc, 0xfd, 0xe1, 0x28, 0xda, 0x29, 0x2e, 0x2d, 0x2d, 0x2a, 0x2a, 0x2a, 0x2a, 0x2d, 0x2a, 0x2d, 0x2d, 0x2d, 0x2e, 0x2f, 0x2f, 0x30, 0x32, 0x35, 0x2d, 0x63, 0xe3, 0xa4, 0xf7, 0x7d, 0xf5, 0x00, 0x92, 0xdf, 0xe8, 0xe8, 0xfd, 0xe8, 0xea, 0xda, 0x9a, 0x4f, 0x40, 0x4d, 0x46, 0x5d, 0x66, 0x6f, 0x6a, 0x73, 0x7c, 0x96, 0x81, 0x0b, 0x1a, 0x15, 0x10, 0x11, 0x0e, 0x11, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x10, 0x11, 0x18, 0x1d, 0x10, 0x05, 0x06, 0x4d, 0x2e, 0x94, 0xcc, 0xf5, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa7, 0xe3, 0x00, 0x00, 0xa4, 0x00, 0xa7, 0x00, 0xf5, 0xa4, 0xb9, 0xdb, 0xe7, 0xcb, 0x00, 0x29, 0x29, 0x2e, 0x29, 0x29, 0x32, 0x2e, 0x4b, 0x46, 0x05, 0x05, 0x15, 0x25, 0x24, 0x21, 0x95, 0x23, 0x30, 0x6d, 0xb7, 0x00, 0xfa, 0xf6, 0xfe, 0xe9, 0xe8, 0xe8, 0xe1, 0xe8, 0x94, 0x29, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2f, 0x30, 0x30, 0x32, 0x33, 0x33, 0x30, 0x62, 0x00, 0x00, 0xf9, 0xf9, 0x57, 0xc6, 0xe0, 0xe8, 0xe8, 0xe0, 0xfd, 0xe8, 0xdc, 0x78, 0x9f, 0x51, 0x43, 0x48, 0x48, 0x61, 0x6c, 0x64, 0x81, 0x88, 0x73, 0x7f, 0x96, 0x6f, 0x0d, 0x1a, 0x10, 0x10, 0x0c, 0x09, 0x0e, 0x09, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x09, 0x0c, 0x09, 0x0c, 0x0c, 0x0e, 0x10, 0x19, 0x15, 0x05, 0x4e, 0x5a, 0x30, 0xde, 0x5c, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xf5, 0xf5, 0x00, 0xe3, 0x00, 0xe2, 0xba, 0xd9, 0xe8, 0xe9, 0xad, 0x00, 0xa4, 0x2a, 0x29, 0x2d, 0x30, 0x2f, 0x39, 0x41, 0x41, 0x08, 0x0a, 0x1d, 0x25, 0x22, 0x22, 0x22, 0x24, 0x23, 0x30, 0x62, 0xae, 0xeb, 0xf3, 0xed, 0x00, 0xf9, 0xe1, 0xe8, 0xe8, 0xe1, 0x92, 0x31, 0x2c, 0x2d, 0x2a, 0x2d, 0x2d, 0x2d, 0x2f, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x2f, 0x30, 0x32, 0x30, 0x33, 0x33, 0x38, 0x5c, 0x00, 0xeb, 0xf9, 0xf8, 0xe7, 0xfd, 0xe1, 0xe8, 0xfc, 0xe1, 0xe8, 0xfd, 0xe6, 0x74, 0x9a, 0x56, 0x47, 0x48, 0x4b, 0x66, 0x64, 0x81, 0x8a, 0xca, 0x4c, 0xbd, 0x8d, 0x8c, 0x06, 0x17, 0x17, 0x09, 0x09, 0x09, 0x09, 0x07, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0c, 0x0c, 0x19, 0x12, 0x02, 0x06, 0x4a, 0x44, 0xe8, 0xb3, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfe, 0x00, 0xa7, 0xfe, 0xa4, 0xe4, 0xe9, 0xde, 0xe0, 0xe9, 0xb8, 0xa7, 0xa6, 0x00, 0x29, 0x29, 0x2d, 0x29, 0x35, 0x42, 0x35, 0x52, 0x05, 0x0f, 0x24, 0x25, 0x22, 0x20, 0x1b, 0x22, 0x21, 0x95, 0x3e, 0x69, 0x00, 0xee, 0xf3, 0xf0, 0x6e, 0xe7, 0xe8, 0xe8, 0xe1, 0xe8, 0xdc, 0x00, 0x2a, 0xa6, 0x2d, 0x2a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2f, 0x2f, 0x30, 0x30, 0x30, 0x33, 0x33, 0x30, 0x38, 0x56, 0xa5, 0x00, 0xf8, 0xf9, 0xdc, 0xfd, 0xe8, 0xe8, 0xe8, 0xe8, 0xfc, 0xe8, 0xfb, 0x74, 0x9a, 0x51, 0x47, 0x46, 0x50, 0x68, 0x6f, 0x9b, 0x62, 0x3a, 0xb7, 0xb7, 0x59, 0x9d, 0x75, 0x55, 0x17, 0x10, 0x07, 0x07, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0a, 0x19, 0x67, 0x06, 0x53, 0x29, 0x94, 0xd7, 0x00, 0x00, 0xf5, 0xf5, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x00, 0xae, 0xa4, 0x00, 0x6e, 0x9e, 0xfd, 0x8b, 0xc6, 0x3d, 0x31, 0x00, 0x00, 0xa4, 0x2c, 0x29, 0x3f, 0x33, 0x39, 0x41, 0x46, 0x67, 0x71, 0x21, 0x26, 0x22, 0x1d, 0x20, 0x20, 0x20, 0x1e, 0x21, 0x1f, 0x36, 0x5e, 0xa6, 0xeb, 0xfa, 0xf3, 0xe1, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xda, 0xa6, 0xa6, 0x2c, 0xa6, 0x2d, 0x2a, 0x2f, 0x2a, 0x2f, 0x2d, 0x2f, 0x2e, 0x2f, 0x30, 0x30, 0x33, 0x33, 0x33, 0x35, 0x33, 0xbd, 0xfe, 0xf5, 0xf7, 0xfa, 0xfa, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xd7, 0x78, 0x94, 0x4f, 0x42, 0x4b, 0x55, 0x64, 0x8c, 0x82, 0xb4, 0xb9, 0xb7, 0xb4, 0xb8, 0xd5, 0x96, 0x06, 0x6b, 0x17, 0x10, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x04, 0x04, 0x07, 0x07, 0x07, 0x07, 0x09, 0x0a, 0x1a, 0x05, 0x58, 0x35, 0xd1, 0xa1, 0xeb, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xff, 0xd7, 0xe0, 0x6e, 0x00, 0xa4, 0x2c, 0xa4, 0x29, 0x30, 0x2e, 0x2e, 0x35, 0x39, 0x39, 0x50, 0x06, 0x0b, 0x1a, 0x23, 0x26, 0x22, 0x1d, 0x20, 0x20, 0x1e, 0x1e, 0x20, 0x19, 0x1f, 0x95, 0x4b, 0x4f, 0xaf, 0xec, 0xfa, 0xf2, 0xe8, 0xfd, 0x28, 0xe8, 0xe8, 0xe1, 0xe9, 0x00, 0xa8, 0xa8, 0x2d, 0x2d, 0x2d, 0x2d, 0x2f, 0x2a, 0x2f, 0x2d, 0x2f, 0x2f, 0x30, 0x32, 0x33, 0x33, 0x33, 0x36, 0x2c, 0x4f, 0xe3, 0xeb, 0xef, 0xfa, 0xf0, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xf1, 0x78, 0x90, 0x43, 0x3e, 0x4e, 0x60, 0x61, 0x8c, 0xd3, 0x45, 0xb7, 0xb4, 0xb1, 0xb4, 0xbe, 0x91, 0x8f, 0x02, 0x0b, 0x17, 0x10, 0x02, 0x07, 0x03, 0x04, 0x03, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05, 0x1a, 0x61, 0x58, 0x2d, 0x73, 0xe1, 0xaf, 0xa4, 0x00, 0xf5, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0xe8, 0x45, 0x29, 0x33, 0x3e, 0x39, 0x3e, 0x01, 0x55, 0x05, 0x65, 0x0f, 0x15, 0x1a, 0x22, 0x24, 0x25, 0x24, 0x22, 0x1d, 0x1b, 0x20, 0x1b, 0x20, 0x1e, 0x1b, 0x1d, 0x19, 0x1a, 0x95, 0x4d, 0x51, 0xe3, 0x00, 0xf3, 0xf7, 0xfb, 0xfd, 0xfd, 0xe1, 0xe8, 0xa3, 0x59, 0x2c, 0x2e, 0x2d, 0x2c, 0x2a, 0x2d, 0x2d, 0x2f, 0x2f, 0x2f, 0x2f, 0x30, 0x30, 0x30, 0x2f, 0x33, 0x35, 0x35, 0x30, 0x38, 0xb3, 0x3d, 0xeb, 0xeb, 0xf3, 0xf6, 0xf2, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xe4, 0xdc, 0x76, 0x3c, 0x4b, 0x4b, 0x61, 0x61, 0x93, 0x6d, 0x4f, 0x3a, 0xb7, 0xaa, 0xaf, 0xbe, 0xc0, 0x97, 0x8a, 0x55, 0x65, 0x1a, 0x10, 0x02, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x04, 0x02, 0x04, 0x03, 0x03, 0x03, 0x02, 0x08, 0x17, 0x6f, 0x4a, 0x30, 0x82, 0x9b, 0x4c, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x74, 0x94, 0xa4, 0x38, 0x53, 0x41, 0x0a, 0x1a, 0x1f, 0x21, 0x24, 0x25, 0x24, 0x24, 0x24, 0x20, 0x20, 0x1d, 0x1b, 0x1b, 0x1b, 0x20, 0x1b, 0x1b, 0x1e, 0x1b, 0x16, 0x18, 0x1c, 0x17, 0x95, 0x4d, 0x56, 0xae, 0xeb, 0xf9, 0xf7, 0xf7, 0xfd, 0xfc, 0xe8, 0xfd, 0xe0, 0x3a, 0x29, 0x2c, 0x2c, 0x2d, 0x2e, 0x2d, 0x2d, 0x2a, 0x2d, 0x2f, 0x30, 0x32, 0x32, 0x2f, 0x33, 0x32, 0x35, 0x33, 0x30, 0x3c, 0x3a, 0xb3, 0xeb, 0xeb, 0xf2, 0xf9, 0xed, 0xef, 0xf3, 0xf4, 0xfa, 0xf0, 0xf6, 0xcf, 0xde, 0x51, 0x42, 0x48, 0x50, 0x5b, 0x6c, 0x8e, 0x7b, 0x4c, 0x45, 0xba, 0xac, 0xad, 0xbc, 0xc2, 0xca, 0x9d, 0x85, 0x50, 0x06, 0x0f, 0x1a, 0x02, 0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x07, 0x02, 0x02, 0x02, 0x02, 0x6b, 0x77, 0x68, 0x33, 0x3a, 0x88, 0x92, 0xbc, 0x29, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x2b, 0x84, 0x82, 0x29, 0x4f, 0x46, 0x0d, 0x21, 0x1f, 0x1c, 0x1d, 0x19, 0x15, 0x16, 0x18, 0x18, 0x16, 0x14, 0x16, 0x16, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x18, 0x18, 0x19, 0x19, 0x0b, 0xa0, 0x53, 0x4a, 0xb5, 0x00, 0xe4, 0xf3, 0xee, 0xf0, 0xfa, 0xfa, 0xf4, 0xcf, 0xa6, 0x2a, 0x2e, 0x2e, 0x30, 0x30, 0x33, 0x2f, 0x32, 0x2f, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x35, 0x33, 0x38, 0x34, 0x3a, 0xaf, 0x00, 0xee, 0xfa, 0xf7, 0xed, 0xf6, 0xed, 0xee, 0xf6, 0xf7, 0xea, 0xd3, 0x3f, 0x47, 0x4b, 0x54, 0x65, 0x06, 0x7b, 0x91, 0x5e, 0x4c, 0xb7, 0xb2, 0xac, 0xb1, 0xc2, 0xbc, 0xd3, 0x98, 0x8f, 0x06, 0x55, 0x06, 0x1a, 0x12, 0x0b, 0x02, 0x02, 0x01, 0x01, 0x01, 0x46, 0x03, 0x05, 0x0b, 0x13, 0x77, 0x06, 0x33, 0x62, 0xe1, 0x92, 0x3a, 0xa4, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0x84, 0xd7, 0x30, 0x51, 0x4a, 0x1f, 0x19, 0x11, 0x10, 0x14, 0x10, 0x14, 0x14, 0x0e, 0x0e, 0x14, 0x14, 0x16, 0x16, 0x16, 0x16, 0x14, 0x16, 0x14, 0x16, 0x18, 0x18, 0x17, 0x12, 0x0f, 0x27, 0x58, 0x3a, 0x4f, 0x00, 0xf5, 0xfa, 0xf2, 0xed, 0xed, 0xf6, 0xf4, 0xec, 0xa6, 0xac, 0x2e, 0x2e, 0x2c, 0x2c, 0x2d, 0x2e, 0x30, 0x32, 0x30, 0x30, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x36, 0x33, 0x35, 0x35, 0x3a, 0xb3, 0x2c, 0xa4, 0xf7, 0xf3, 0xf7, 0xf6, 0xf6, 0xef, 0xf2, 0xdd, 0xd7, 0x3f, 0x4a, 0x4b, 0x48, 0x58, 0x5d, 0x66, 0x82, 0x8b, 0xcd, 0xb9, 0xb8, 0xb9, 0xb6, 0xb2, 0xc2, 0xc8, 0xc4, 0x69, 0x98, 0x9d, 0x75, 0x06, 0x4b, 0x06, 0x71, 0x17, 0x7a, 0x15, 0x13, 0x77, 0x77, 0x7a, 0x13, 0x68, 0x52, 0x30, 0x4b, 0x87, 0xa3, 0x70, 0x00, 0x2a, 0x31, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x63, 0x9f, 0x2c, 0x3f, 0x06, 0x21, 0x07, 0x10, 0x0c, 0x09, 0x0c, 0x09, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0x14, 0x14, 0x10, 0x19, 0x15, 0x08, 0x95, 0xa0, 0x5f, 0x3a, 0x51, 0xe3, 0xa4, 0xec, 0xf3, 0xf2, 0xf7, 0xf4, 0xef, 0xeb, 0xac, 0x29, 0x2e, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x32, 0x32, 0x2f, 0x30, 0x2f, 0x32, 0xaa, 0x32, 0x32, 0x32, 0x33, 0x30, 0x35, 0x35, 0x3c, 0x43, 0x3f, 0xb0, 0x29, 0xf7, 0xea, 0xfc, 0xea, 0xf4, 0xfb, 0xc8, 0x44, 0x3f, 0x47, 0x50, 0x41, 0x06, 0x5b, 0x8c, 0x7f, 0xbe, 0xb2, 0xaa, 0xb2, 0xb2, 0xee, 0xbb, 0xbf, 0xce, 0xc4, 0xce, 0x69, 0x7f, 0x97, 0x8e, 0x73, 0x5a, 0x3e, 0x39, 0x4b, 0x53, 0x58, 0x4e, 0x4d, 0x3e, 0x3e, 0x42, 0x5e, 0x8e, 0xa2, 0x94, 0x49, 0xa4, 0x2c, 0x00, 0x00, 0xa7, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xa1, 0x76, 0x00, 0x4d, 0x17, 0x15, 0x04, 0x04, 0x0c, 0x09, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x10, 0x15, 0x1a, 0x0b, 0x80, 0x8c, 0x9c, 0x64, 0x30, 0x3f, 0x3a, 0x31, 0xf5, 0xee, 0xf2, 0xfc, 0xf9, 0xeb, 0xaa, 0x29, 0xb2, 0x2d, 0x2e, 0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2f, 0x33, 0x33, 0x30, 0x2f, 0x32, 0x32, 0xac, 0x32, 0x35, 0x32, 0x33, 0x35, 0x35, 0x39, 0x38, 0x43, 0x57, 0xbc, 0xbe, 0xf1, 0xce, 0xb8, 0xb0, 0x34, 0x34, 0x48, 0x3c, 0x4b, 0x46, 0x54, 0x7e, 0x8c, 0xbf, 0x29, 0xa9, 0x29, 0xeb, 0xa6, 0xac, 0xb9, 0xbb, 0xc9, 0xce, 0xc5, 0xd0, 0xbd, 0x3f, 0xe8, 0xa2, 0xa2, 0x97, 0x88, 0x72, 0x5f, 0x5a, 0x5e, 0x6d, 0x76, 0x8b, 0x9f, 0x9f, 0x88, 0x57, 0x29, 0x2b, 0x00, 0xa4, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xa4, 0x59, 0xe0, 0x4f, 0x38, 0x08, 0x1f, 0x0a, 0x03, 0x09, 0x03, 0x07, 0x07, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x0c, 0x04, 0x0a, 0x15, 0x1a, 0x0b, 0x0b, 0x99, 0x75, 0x8b, 0x51, 0x29, 0x2e, 0x2e, 0x31, 0xb6, 0xb2, 0xf2, 0xfb, 0x29, 0x29, 0x30, 0x2d, 0x29, 0x2d, 0x2c, 0x2a, 0x2a, 0x2a, 0x2d, 0x30, 0x30, 0x39, 0x35, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x37, 0x35, 0x33, 0x35, 0x33, 0x35, 0x38, 0x30, 0x34, 0x3a, 0x2c, 0xac, 0xb0, 0x3a, 0x45, 0x4a, 0x42, 0x42, 0x41, 0x4b, 0x4e, 0x95, 0x73, 0xad, 0xa9, 0xb4, 0xac, 0xa9, 0xeb, 0xac, 0xb9, 0xc0, 0xc0, 0xc9, 0xcb, 0xc7, 0xbc, 0xd8, 0xd6, 0xa6, 0x4c, 0x74, 0x8b, 0x97, 0x9e, 0x9f, 0x9f, 0x94, 0x9a, 0x82, 0x57, 0x3d, 0x29, 0x00, 0xa5, 0x00, 0xa7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x00, 0x74, 0x28, 0x59, 0x2e, 0x52, 0x1c, 0x0f, 0x01, 0x04, 0x04, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x03, 0x04, 0x05, 0x03, 0x0a, 0x15, 0x1a, 0x55, 0x06, 0x9d, 0x76, 0x7f, 0x70, 0x29, 0x2d, 0x30, 0x34, 0x32, 0x2b, 0xad, 0xfb, 0x4c, 0xa4, 0x3e, 0x30, 0x4e, 0x52, 0x43, 0x3c, 0x34, 0x34, 0x38, 0x3f, 0x4a, 0x50, 0x3e, 0x3e, 0x35, 0x33, 0x32, 0x32, 0x32, 0x32, 0x2f, 0x37, 0x36, 0x33, 0x3b, 0x39, 0x39, 0x39, 0x37, 0x36, 0x3f, 0x37, 0x38, 0x45, 0x37, 0x3c, 0x3b, 0x46, 0x46, 0x46, 0x46, 0x5a, 0x89, 0x73, 0xb2, 0xad, 0x29, 0xeb, 0xaa, 0xaa, 0xa9, 0xb8, 0xbe, 0xc8, 0xcb, 0xcb, 0xcb, 0xc5, 0xfd, 0xc2, 0x00, 0x29, 0x00, 0x00, 0xa4, 0x2b, 0x2c, 0xe2, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0xf5, 0xaa, 0x00, 0xa5, 0x00, 0xae, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x2b, 0x63, 0x28, 0x7f, 0x3f, 0x33, 0x6f, 0x86, 0x0d, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x60, 0x0a, 0x77, 0x1a, 0x0b, 0x41, 0x64, 0x27, 0x27, 0x5e, 0x88, 0xb0, 0x2a, 0x2d, 0x2a, 0x37, 0x34, 0x2a, 0xf9, 0xd5, 0x00, 0x3e, 0x39, 0x0a, 0x0a, 0x55, 0x6c, 0x6d, 0x5e, 0x62, 0x72, 0x64, 0x06, 0x0b, 0x0d, 0x0b, 0x39, 0x35, 0x32, 0x2f, 0x3f, 0x2f, 0x32, 0x32, 0x35, 0x36, 0x36, 0x36, 0x38, 0x36, 0x3b, 0x36, 0x3b, 0x37, 0x3c, 0x3c, 0x40, 0x3c, 0x41, 0x46, 0x46, 0x46, 0x4e, 0x58, 0x91, 0x73, 0xb7, 0xaf, 0xa9, 0xa9, 0xad, 0xac, 0xb1, 0xbb, 0xc1, 0xca, 0xc8, 0xcc, 0xd2, 0xb1, 0xce, 0xdf, 0xa4, 0xad, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa4, 0x2b, 0x00, 0xf5, 0xa5, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x49, 0x63, 0xcc, 0xe5, 0x6e, 0x57, 0xad, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xe2, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0x2b, 0x00, 0xa4, 0xb8, 0xdc, 0xdf, 0x76, 0x2e, 0x35, 0x66, 0x7a, 0x77, 0x13, 0x12, 0x12, 0x0f, 0x0f, 0x0d, 0x71, 0x13, 0x5b, 0x46, 0x4b, 0x87, 0x27, 0x70, 0x8d, 0xea, 0xd8, 0xa6, 0x29, 0xac, 0x37, 0xac, 0x2a, 0x34, 0xdb, 0xb6, 0x34, 0x31, 0x02, 0x15, 0x3e, 0x3e, 0x31, 0x3e, 0x4a, 0x39, 0x2e, 0x35, 0x02, 0x03, 0x0d, 0x15, 0x55, 0x35, 0x35, 0x32, 0x37, 0x32, 0x32, 0x37, 0x32, 0x37, 0x36, 0x37, 0x39, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x40, 0x40, 0x41, 0x48, 0x41, 0x4e, 0x4b, 0x41, 0x5a, 0x8c, 0x8a, 0xb8, 0xb6, 0xb4, 0xb0, 0xb0, 0x44, 0xb9, 0x51, 0xca, 0xc6, 0xc5, 0xcb, 0xcc, 0xcd, 0xab, 0xe7, 0xc3, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xbe, 0xe5, 0xe5, 0xe5, 0xc6, 0xba, 0xa4, 0x00, 0xfe, 0xc1, 0xe6, 0xe0, 0xe7, 0xdc, 0xda, 0xdb, 0xe1, 0xfd, 0xda, 0xc6, 0xf5, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0xa4, 0xa7, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xe2, 0xa5, 0x00, 0xa4, 0x00, 0xc9, 0xdd, 0xe1, 0x88, 0x56, 0x3e, 0x39, 0x4b, 0x4e, 0x53, 0x55, 0x53, 0x4e, 0x46, 0x3e, 0x5a, 0x87, 0x9d, 0x94, 0x56, 0x63, 0x8b, 0xcb, 0xd9, 0x29, 0xa6, 0x2f, 0xb0, 0x2f, 0x2a, 0xc5, 0xea, 0xeb, 0x2e, 0x2e, 0x08, 0x15, 0x07, 0x04, 0x02, 0x3e, 0x35, 0x46, 0x01, 0x04, 0x07, 0x0c, 0x09, 0x1c, 0x0b, 0x39, 0x39, 0x35, 0x32, 0x2f, 0x37, 0x32, 0x36, 0x37, 0x37, 0x37, 0x37, 0x3c, 0x3b, 0x3b, 0x3b, 0x3b, 0x40, 0x42, 0x42, 0x46, 0x4b, 0x3b, 0x4e, 0x4b, 0x4b, 0x6a, 0x6f, 0x8a, 0xc4, 0xbb, 0xb7, 0xb7, 0xb6, 0x4c, 0x57, 0x57, 0x59, 0x69, 0x6e, 0xce, 0xd0, 0xc1, 0xaa, 0xdb, 0x78, 0x00, 0xe2, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xae, 0x78, 0xfc, 0x9e, 0xdc, 0xdc, 0xdb, 0xe7, 0xe8, 0xd9, 0xe4, 0xda, 0xe1, 0x6e, 0xb2, 0x00, 0x00, 0xa4, 0x00, 0xa5, 0xbc, 0xe9, 0xe8, 0xd7, 0x3d, 0x00, 0xe3, 0x00, 0xe2, 0x00, 0xe2, 0x00, 0x00, 0x00, 0xa5, 0xa5, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa7, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xeb, 0xeb, 0xeb, 0xc2, 0xd7, 0xe1, 0x28, 0x94, 0x87, 0x7f, 0x73, 0x6d, 0x75, 0x81, 0x91, 0x99, 0xa2, 0x90, 0x5e, 0x34, 0xff, 0xe6, 0x63, 0xc8, 0xea, 0x29, 0xac, 0x2f, 0x2f, 0x32, 0x2f, 0xd6, 0xcf, 0xeb, 0x2d, 0x35, 0x0b, 0x15, 0x1a, 0x10, 0x05, 0x03, 0x0a, 0x05, 0x07, 0x09, 0x0e, 0x20, 0x0f, 0x1c, 0x65, 0x39, 0x36, 0x36, 0x2f, 0x32, 0x36, 0x37, 0x35, 0x37, 0x37, 0x3c, 0x37, 0x3c, 0x3b, 0x41, 0x3b, 0x42, 0x40, 0x42, 0x46, 0x46, 0x41, 0x01, 0x46, 0x46, 0x61, 0x66, 0x5e, 0x85, 0x8d, 0xcc, 0x57, 0x59, 0xbe, 0xbd, 0xbe, 0xbd, 0xc5, 0xca, 0xcb, 0xcf, 0xd0, 0xcc, 0x00, 0xde, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xe0, 0xde, 0x5c, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xea, 0xe8, 0xea, 0xa9, 0xa6, 0xb4, 0xbb, 0xbe, 0xbf, 0xbd, 0xaf, 0x00, 0x29, 0xb3, 0xde, 0x9e, 0xe2, 0x00, 0x00, 0xb5, 0xe5, 0xd7, 0xdc, 0xdb, 0xda, 0x78, 0x63, 0xb4, 0xa4, 0x00, 0x00, 0xae, 0x00, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xa4, 0xa4, 0xf5, 0xab, 0x31, 0xb8, 0x76, 0x82, 0x88, 0x90, 0x97, 0x94, 0x88, 0x76, 0x69, 0x44, 0x29, 0x29, 0x00, 0xfe, 0x9e, 0x3d, 0xc6, 0xdb, 0x2d, 0x2f, 0x34, 0x32, 0x32, 0x32, 0x85, 0xf0, 0x29, 0xab, 0x33, 0x46, 0x86, 0x1f, 0x21, 0x0a, 0x07, 0x07, 0x03, 0x09, 0x1d, 0x25, 0x18, 0x1f, 0x17, 0x52, 0x35, 0x33, 0x35, 0x36, 0x37, 0x35, 0x36, 0x36, 0x39, 0x39, 0x3c, 0x3c, 0x3c, 0x40, 0x3b, 0x40, 0x40, 0x42, 0x42, 0x46, 0x46, 0x41, 0x4e, 0x46, 0x4e, 0x64, 0x64, 0x79, 0x88, 0xd6, 0x57, 0xb7, 0xbc, 0xbb, 0xbd, 0xc2, 0xc2, 0xc8, 0xce, 0xc7, 0xce, 0xd2, 0xb5, 0xb7, 0xe8, 0xe4, 0x00, 0x00, 0xe3, 0x00, 0x00, 0xf5, 0x49, 0xe1, 0x78, 0xa5, 0x00, 0xb5, 0xb9, 0xba, 0xbe, 0xb7, 0xa4, 0xa6, 0xd8, 0xa6, 0xbb, 0xc2, 0xc7, 0xc5, 0xc4, 0xc0, 0xc2, 0xc7, 0xc5, 0xb7, 0x00, 0xe3, 0xd9, 0xda, 0xb6, 0xea, 0xe8, 0xe6, 0x84, 0x6e, 0xe5, 0x78, 0xda, 0xe7, 0xe8, 0xea, 0x63, 0xa7, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa7, 0xf5, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa5, 0x2b, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa7, 0xae, 0xe7, 0xc1, 0x4c, 0x94, 0x4c, 0x29, 0x32, 0x37, 0x34, 0x2f, 0x8a, 0xbe, 0x29, 0xaa, 0x32, 0x2a, 0x6c, 0x80, 0x23, 0x1d, 0x10, 0x09, 0x10, 0x22, 0x22, 0x24, 0x1a, 0x77, 0x58, 0x39, 0x36, 0x36, 0x36, 0x37, 0x35, 0x36, 0x39, 0x39, 0x39, 0x3c, 0x3c, 0x3c, 0x40, 0x3b, 0x40, 0x40, 0x42, 0x42, 0x47, 0x48, 0x4b, 0x4b, 0x46, 0x01, 0x5d, 0x66, 0x73, 0x8e, 0x6d, 0x34, 0xa6, 0xa9, 0xaa, 0xad, 0xb9, 0xc4, 0xc7, 0xc7, 0xcd, 0xce, 0xcf, 0xc5, 0xa8, 0x8b, 0x84, 0xa7, 0xfe, 0xae, 0xa7, 0xa7, 0xf5, 0x00, 0xdb, 0xe9, 0xa6, 0x49, 0xcb, 0x5c, 0xcc, 0xc7, 0xc6, 0xc8, 0xbc, 0xc3, 0xbb, 0xbf, 0xc4, 0xbf, 0xc5, 0xbf, 0xc2, 0xc5, 0xc3, 0xc2, 0xc0, 0xc0, 0xbf, 0x00, 0x49, 0xe0, 0xe8, 0xe9, 0xad, 0x00, 0x00, 0xa8, 0xa5, 0x00, 0x00, 0xa4, 0xba, 0xd7, 0xe1, 0xea, 0xfe, 0xa7, 0xe2, 0x00, 0xa5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xff, 0xf5, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xfe, 0x00, 0xdb, 0x97, 0xa4, 0xd7, 0x79, 0x32, 0x33, 0x38, 0x36, 0x2e, 0x8e, 0x4f, 0x2c, 0x38, 0x3f, 0x2a, 0x32, 0x4b, 0x05, 0x1f, 0x1d, 0x10, 0x1d, 0x21, 0x0a, 0x52, 0x58, 0x4b, 0x36, 0x33, 0x36, 0x39, 0x37, 0x35, 0x33, 0x36, 0x39, 0x39, 0x3e, 0x3e, 0x3e, 0x3e, 0x40, 0x40, 0x40, 0x42, 0x43, 0x47, 0x48, 0x48, 0x4b, 0x4e, 0x46, 0x58, 0x66, 0x6a, 0x8e, 0x7f, 0x34, 0x29, 0xaa, 0xad, 0xa9, 0xa9, 0xb4, 0xbe, 0xc5, 0xcf, 0xc3, 0xcd, 0xcf, 0xad, 0xd7, 0xa1, 0x6e, 0xe9, 0xde, 0xfd, 0xe7, 0xfc, 0xda, 0xe5, 0xe6, 0xb3, 0x49, 0xc9, 0xc8, 0xc8, 0xc8, 0xbf, 0xcb, 0xc5, 0xcd, 0xc7, 0xbe, 0xc9, 0xbe, 0xce, 0xbd, 0xc9, 0xbf, 0xbd, 0xc2, 0xc4, 0xc2, 0xc2, 0xc6, 0xb6, 0xa4, 0x84, 0xc4, 0x00, 0xb9, 0x5c, 0xc2, 0xc1, 0xc0, 0xc6, 0xc4, 0xb7, 0x00, 0xa4, 0xb5, 0xdc, 0xe8, 0xba, 0x00, 0x3d, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xf5, 0xa7, 0x00, 0xa4, 0xff, 0xa4, 0x00, 0xff, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xf5, 0x00, 0xae, 0x3d, 0x9e, 0x84, 0x56, 0x94, 0x4f, 0x33, 0x3c, 0x3f, 0x2a, 0x8d, 0x5e, 0xa4, 0x34, 0x2a, 0x37, 0x2f, 0x35, 0x36, 0x0a, 0x21, 0x1f, 0x1f, 0x05, 0x35, 0x39, 0x32, 0x33, 0x36, 0x3b, 0x36, 0x35, 0x3c, 0x36, 0x40, 0x39, 0x39, 0x39, 0x3e, 0x3b, 0x3e, 0x40, 0x40, 0x42, 0x43, 0x42, 0x47, 0x47, 0x4b, 0x4b, 0x4e, 0x46, 0x55, 0x6c, 0x61, 0x6a, 0x9b, 0x5f, 0x2a, 0x31, 0xac, 0xa9, 0xa9, 0xac, 0xb4, 0xbc, 0xc9, 0xc3, 0xd2, 0xcd, 0xc9, 0xb7, 0xd8, 0xe1, 0x9a, 0x84, 0xc1, 0x49, 0x49, 0xe4, 0x78, 0xe8, 0xea, 0xad, 0xce, 0xc8, 0xc3, 0xc7, 0xc0, 0xcb, 0xc2, 0xc5, 0xbe, 0xc5, 0xc4, 0xbf, 0xbe, 0xb9, 0xb6, 0xb4, 0xb7, 0xb7, 0xb8, 0xbb, 0xbf, 0xc3, 0xc0, 0xc6, 0xb4, 0xc0, 0xb3, 0xcb, 0x5c, 0xbe, 0xc3, 0x5c, 0xc4, 0xc3, 0x5c, 0xcb, 0xcb, 0xba, 0x00, 0x00, 0x84, 0xe7, 0xe4, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x94, 0xe5, 0xb6, 0x76, 0x88, 0x45, 0x3f, 0x3f, 0x2a, 0x8a, 0x63, 0xaa, 0xac, 0x34, 0x34, 0x32, 0x39, 0x33, 0x36, 0x71, 0x86, 0x4b, 0x30, 0x35, 0x32, 0x37, 0x37, 0x36, 0x32, 0x37, 0x3b, 0x37, 0x39, 0x3b, 0x54, 0x6f, 0x50, 0x33, 0x39, 0x46, 0x42, 0x42, 0x37, 0x47, 0x48, 0x42, 0x4b, 0x4e, 0x4e, 0x01, 0x01, 0x68, 0x68, 0x66, 0x79, 0x91, 0xbc, 0xa9, 0xb0, 0xa6, 0xaa, 0xa6, 0xad, 0xbb, 0xbf, 0xcd, 0xcf, 0xc9, 0xcf, 0xd0, 0xb6, 0xbd, 0xa1, 0xaf, 0xad, 0xb9, 0xbe, 0xbe, 0xbd, 0xb4, 0xb9, 0xd0, 0xbf, 0xc5, 0xc8, 0xc7, 0xc7, 0xc7, 0xc8, 0xc5, 0xc4, 0xc7, 0xc4, 0xbe, 0xb8, 0xb2, 0xb2, 0xb1, 0xb2, 0xb1, 0xb1, 0xb0, 0xaf, 0xb2, 0xbb, 0xc4, 0xc2, 0xbf, 0xbf, 0xc2, 0xc2, 0xc2, 0xc4, 0xc4, 0xc7, 0x5c, 0xc3, 0xc7, 0xc4, 0xc2, 0xc3, 0xc3, 0xaa, 0x00, 0x84, 0xe7, 0x00, 0xfe, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xeb, 0x00, 0x00, 0x00, 0xb5, 0xe8, 0x3d, 0x57, 0xb3, 0x51, 0x63, 0x51, 0x45, 0x34, 0xd0, 0xd8, 0x29, 0xb2, 0x34, 0x2d, 0x3c, 0x32, 0x40, 0x36, 0x61, 0x6f, 0x36, 0x35, 0x37, 0x37, 0x2f, 0x2f, 0x32, 0x3c, 0x36, 0x36, 0x3b, 0x3b, 0x4b, 0x58, 0x93, 0x7e, 0x5d, 0x40, 0x3b, 0x40, 0x42, 0x53, 0x42, 0x3b, 0x4b, 0x4e, 0x01, 0x01, 0x02, 0x65, 0x6b, 0x64, 0x66, 0x62, 0x92, 0xce, 0xac, 0xa6, 0xa9, 0xad, 0xa9, 0xb0, 0xbf, 0xc5, 0xcb, 0xcd, 0xce, 0xd2, 0xce, 0xb2, 0xc2, 0xdb, 0xc7, 0xd2, 0xd2, 0xd0, 0xd0, 0xd0, 0xcb, 0xc5, 0xcb, 0xc7, 0xc8, 0xc8, 0xc4, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xc0, 0xbc, 0xb7, 0xb2, 0xaf, 0xae, 0xae, 0xe3, 0xe3, 0xae, 0xaf, 0xb0, 0xb1, 0xb4, 0xb8, 0xc0, 0xbe, 0xc2, 0xc4, 0xc0, 0xbc, 0xbc, 0xb9, 0xbb, 0xbb, 0xbe, 0xc0, 0xc3, 0xc7, 0xc7, 0xc4, 0xc7, 0xab, 0x00, 0xde, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xf5, 0xe2, 0x00, 0xfe, 0xa1, 0xe3, 0x44, 0xbc, 0x2b, 0x3a, 0x45, 0x34, 0x2a, 0x59, 0xdb, 0xa8, 0xb0, 0x30, 0x43, 0x33, 0x32, 0x33, 0x32, 0x5a, 0x66, 0x32, 0x36, 0x32, 0x3c, 0x32, 0x3c, 0x37, 0x3c, 0x36, 0x40, 0x42, 0x36, 0x42, 0x61, 0x93, 0x71, 0x58, 0x46, 0x42, 0x48, 0x46, 0x36, 0x42, 0x50, 0x4e, 0x01, 0x46, 0x55, 0x67, 0x6c, 0x6b, 0x73, 0x5f, 0x69, 0xa2, 0xca, 0xb4, 0xaa, 0xaa, 0xad, 0xad, 0xb8, 0xc7, 0xcb, 0xcd, 0xca, 0xd1, 0xcd, 0xce, 0xad, 0xd2, 0xa1, 0xcd, 0xcd, 0xcd, 0xcb, 0xc8, 0xcb, 0xcc, 0xc7, 0xc3, 0xcd, 0xc5, 0xbf, 0xbc, 0xbb, 0xb8, 0xb8, 0xb9, 0xbb, 0xb9, 0xb6, 0xb2, 0xae, 0xaa, 0xa7, 0xa5, 0x00, 0x00, 0xa4, 0xe2, 0xaf, 0xb0, 0xb2, 0xb1, 0xc0, 0xbf, 0xc4, 0xc2, 0xb9, 0xb4, 0xb1, 0xad, 0xad, 0xb1, 0xb4, 0xb6, 0xbb, 0xc3, 0xc7, 0xc4, 0xc1, 0xc4, 0x00, 0xc0, 0xe1, 0xb3, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xe2, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xae, 0xdc, 0xc6, 0xae, 0x4c, 0x34, 0x2c, 0x3a, 0x3a, 0x44, 0x2d, 0x92, 0x59, 0x29, 0x3f, 0x30, 0x35, 0x41, 0x42, 0x39, 0x61, 0x75, 0x36, 0x33, 0x35, 0x35, 0x37, 0x39, 0x36, 0x3e, 0x39, 0x46, 0x48, 0x3e, 0x58, 0x89, 0x7a, 0x41, 0x46, 0x42, 0x41, 0x42, 0x42, 0x48, 0x4b, 0x4e, 0x46, 0x50, 0x5b, 0x67, 0x65, 0x68, 0x66, 0x64, 0x5f, 0x8d, 0x82, 0xdb, 0xd1, 0xbd, 0xb6, 0xb4, 0xbb, 0xc4, 0xcb, 0xcb, 0xcd, 0xd3, 0xc9, 0xd2, 0xbe, 0xaf, 0xdb, 0xd8, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xc9, 0xcb, 0xce, 0xc8, 0xc7, 0xbe, 0xb8, 0xb4, 0xb2, 0xad, 0xaf, 0xb1, 0xb2, 0xb2, 0xb2, 0xb1, 0xad, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xad, 0xb1, 0xb2, 0xbb, 0xb9, 0xbb, 0xb8, 0xb1, 0xac, 0xab, 0xa9, 0xa6, 0xaa, 0xaa, 0xaa, 0xb2, 0xb9, 0xbf, 0xc5, 0xc8, 0xc5, 0xb2, 0x00, 0xdb, 0xd1, 0xf5, 0x00, 0xf5, 0xae, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xfe, 0x74, 0x9e, 0x00, 0xba, 0x5c, 0x34, 0xb7, 0xaa, 0x34, 0x29, 0x62, 0x97, 0x29, 0x43, 0x47, 0x39, 0x2d, 0x3b, 0x33, 0x5b, 0x75, 0x36, 0x36, 0x42, 0x36, 0x3b, 0x3b, 0x3e, 0x41, 0x41, 0x3e, 0x01, 0x58, 0x80, 0x99, 0x06, 0x41, 0x41, 0x4b, 0x3b, 0x4b, 0x4b, 0x52, 0x4b, 0x46, 0x52, 0x60, 0x68, 0x6c, 0x6c, 0x6f, 0x64, 0x64, 0x97, 0x70, 0x59, 0xc7, 0xc3, 0xc0, 0xc0, 0xc2, 0xc8, 0xcd, 0xcd, 0xcb, 0xc8, 0xd0, 0xd2, 0xc0, 0xb4, 0xd2, 0xa1, 0xd2, 0xcb, 0xcf, 0xcb, 0xcb, 0xcd, 0xcb, 0xc9, 0xc8, 0xc5, 0xbe, 0xb7, 0xb1, 0xaf, 0xad, 0xac, 0xaa, 0xad, 0xac, 0xaf, 0xb1, 0xb1, 0xab, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0xa8, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xaa, 0xab, 0xab, 0xa8, 0xa6, 0xa8, 0xa4, 0xa6, 0xad, 0xb0, 0xb9, 0xc5, 0xbf, 0xc8, 0xbe, 0xa6, 0xd1, 0xe8, 0xe6, 0xda, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xe2, 0x00, 0xae, 0x9e, 0xd7, 0xa8, 0x00, 0xb8, 0x5e, 0x34, 0xb0, 0xb2, 0x2d, 0x94, 0x72, 0x2d, 0x5a, 0x5a, 0x41, 0x41, 0x41, 0x6c, 0x80, 0x4e, 0x3b, 0x41, 0x36, 0x3e, 0x41, 0x3e, 0x3e, 0x01, 0x02, 0x0b, 0x86, 0x26, 0x77, 0x3b, 0x46, 0x01, 0x4b, 0x46, 0x4e, 0x4b, 0x41, 0x4e, 0x5b, 0x65, 0x66, 0x68, 0x66, 0x66, 0x5a, 0x5a, 0x9b, 0x82, 0x62, 0x4c, 0x2e, 0xac, 0xb2, 0xc2, 0xcd, 0xcd, 0xcb, 0xcd, 0xcf, 0xc7, 0xd2, 0xd7, 0xbe, 0xda, 0xe0, 0xd3, 0xcf, 0xd1, 0xcb, 0xce, 0xce, 0xcd, 0xc5, 0xbe, 0xbe, 0xc0, 0xb5, 0xb1, 0xac, 0xac, 0xaa, 0xac, 0xaa, 0xac, 0xac, 0xac, 0xad, 0xad, 0xe2, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xad, 0xad, 0xaa, 0xab, 0xad, 0xab, 0xae, 0xab, 0x00, 0x00, 0xa4, 0x00, 0xa6, 0xad, 0xaa, 0xb1, 0xbf, 0xc7, 0xc7, 0xbe, 0xa9, 0xc4, 0xdb, 0xcb, 0xda, 0xe8, 0xdb, 0xb9, 0x00, 0xfe, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x49, 0xe7, 0xe0, 0x84, 0x78, 0xbf, 0xc2, 0xbc, 0x3a, 0xb6, 0x34, 0x9b, 0x56, 0x36, 0x73, 0x79, 0x71, 0x6c, 0x95, 0x95, 0x17, 0x65, 0x55, 0x01, 0x01, 0x02, 0x02, 0x02, 0x0d, 0x77, 0x23, 0x26, 0x23, 0x55, 0x3e, 0x01, 0x46, 0x01, 0x46, 0x4b, 0x46, 0x5b, 0x65, 0x0b, 0x68, 0x68, 0x66, 0x64, 0x56, 0x7b, 0x94, 0x9b, 0x76, 0xc0, 0x4c, 0xac, 0xa8, 0xaf, 0xc4, 0xcd, 0xcb, 0xcb, 0xce, 0xcf, 0xbf, 0xd3, 0xdd, 0xdf, 0xdb, 0xd1, 0xce, 0xce, 0xc7, 0xcb, 0xd0, 0xc8, 0xbb, 0xb3, 0xaa, 0xa9, 0xad, 0xaf, 0xad, 0xac, 0xaa, 0xaa, 0xac, 0xac, 0xaa, 0xad, 0xab, 0xac, 0xae, 0xa9, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xab, 0xe3, 0xad, 0xab, 0xaa, 0xae, 0xad, 0xae, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xaa, 0xaa, 0xb7, 0xbe, 0xcb, 0xc4, 0x00, 0xc9, 0xdd, 0x00, 0x00, 0xfe, 0xda, 0x9e, 0xf1, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x5c, 0x84, 0xe8, 0xb3, 0xbc, 0xc5, 0xb2, 0x2a, 0xac, 0x62, 0x9b, 0x4c, 0x36, 0x5a, 0x61, 0x7a, 0x9c, 0x23, 0x95, 0x21, 0x1a, 0x1a, 0x15, 0x15, 0x1c, 0x1f, 0x24, 0x24, 0x24, 0x24, 0x0b, 0x41, 0x02, 0x01, 0x01, 0x4e, 0x4e, 0x5b, 0x65, 0x6b, 0x65, 0x68, 0x6c, 0x5d, 0x53, 0x6f, 0x90, 0x91, 0xd4, 0xd6, 0xd5, 0xc4, 0xc4, 0x44, 0xb6, 0x5c, 0xce, 0xcb, 0xcd, 0xce, 0xce, 0xcb, 0xbb, 0xdd, 0xdb, 0xcb, 0xce, 0xc8, 0xd0, 0xce, 0xd0, 0xce, 0xce, 0xbb, 0xa8, 0xad, 0xb2, 0xad, 0xad, 0xaf, 0xaf, 0xaf, 0xaa, 0xac, 0xad, 0xad, 0xaa, 0xad, 0xaa, 0xad, 0xaf, 0xae, 0xa7, 0x00, 0x00, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0xa5, 0xa7, 0xa6, 0xa4, 0x00, 0xa4, 0xa5, 0xa7, 0xae, 0xe3, 0xa4, 0x00, 0xa7, 0x00, 0x00, 0xab, 0xae, 0xac, 0xb4, 0xc5, 0xc3, 0xc3, 0x29, 0xc8, 0x92, 0xc0, 0xb6, 0x00, 0xa5, 0xe5, 0xe1, 0xba, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xde, 0xd0, 0xa8, 0xc4, 0xbd, 0xb1, 0xaa, 0xa9, 0xd3, 0x9b, 0x45, 0x37, 0x35, 0x46, 0x80, 0x1c, 0x0f, 0x15, 0x1f, 0x1f, 0x21, 0x22, 0x24, 0x1f, 0x19, 0x1f, 0x1f, 0x15, 0x01, 0x02, 0x01, 0x01, 0x52, 0x5b, 0x65, 0x68, 0x65, 0x0b, 0x6c, 0x61, 0x54, 0x6a, 0x8c, 0x92, 0x85, 0xd1, 0x69, 0xd1, 0xd2, 0xce, 0x63, 0xcb, 0x63, 0xcd, 0xc8, 0xd1, 0xcb, 0xcf, 0xcb, 0xbe, 0xd8, 0xdd, 0xd1, 0xd3, 0xce, 0xce, 0xcf, 0xcf, 0xc4, 0xbc, 0xb6, 0xb0, 0xad, 0xad, 0xad, 0xad, 0xab, 0xaa, 0xa6, 0xa8, 0xaa, 0xad, 0xac, 0xac, 0xaa, 0xad, 0xad, 0xe3, 0xab, 0xfe, 0x2b, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa7, 0xfe, 0xf5, 0x00, 0x00, 0x00, 0xaa, 0xad, 0xad, 0xb1, 0xc3, 0xc4, 0xc4, 0x29, 0xd8, 0xd7, 0xbe, 0xd0, 0xbc, 0x00, 0xa7, 0x74, 0xe1, 0xfe, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc1, 0xe0, 0xb9, 0xe2, 0xbb, 0xc0, 0xbb, 0xb9, 0xb4, 0xd8, 0x9b, 0x45, 0x35, 0x4b, 0x4e, 0x86, 0x1c, 0x03, 0x01, 0x01, 0x04, 0x04, 0x09, 0x10, 0x19, 0x1f, 0x17, 0x08, 0x46, 0x02, 0x55, 0x5b, 0x60, 0x68, 0x68, 0x68, 0x68, 0x61, 0x52, 0x64, 0x8c, 0x97, 0x85, 0x72, 0xcd, 0xcf, 0xce, 0xcd, 0xcd, 0xcb, 0xce, 0x6e, 0xce, 0xcf, 0xce, 0xce, 0xc7, 0xce, 0xd9, 0xdd, 0xdd, 0xd3, 0xcd, 0xd0, 0xd4, 0xd3, 0xc0, 0xb6, 0xa9, 0xaf, 0xac, 0xaa, 0xac, 0xaf, 0xad, 0xaa, 0xa9, 0xa4, 0x00, 0x00, 0xa4, 0xa8, 0xa9, 0xaa, 0xad, 0xaa, 0xa8, 0x2b, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe2, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0x2b, 0xa7, 0xa7, 0xa4, 0xa5, 0xab, 0xab, 0xad, 0xb2, 0xc2, 0xc0, 0xb2, 0xb9, 0xda, 0xd2, 0xc7, 0xc5, 0xcc, 0xbe, 0x00, 0xaa, 0xde, 0xd7, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xa5, 0xcc, 0xe7, 0x84, 0xbe, 0xc4, 0xef, 0xc2, 0xc5, 0xbe, 0xd6, 0xe0, 0x56, 0x2c, 0x50, 0x08, 0x13, 0x1a, 0x12, 0x09, 0x07, 0x0c, 0x10, 0x19, 0x1f, 0x15, 0x05, 0x02, 0x02, 0x60, 0x65, 0x67, 0x68, 0x65, 0x61, 0x58, 0x58, 0x6f, 0x91, 0x99, 0x7f, 0x69, 0x70, 0xcf, 0xca, 0xca, 0xcd, 0xcd, 0xcb, 0xce, 0xcf, 0xcd, 0xcc, 0xca, 0xd1, 0xce, 0xc3, 0xd8, 0xdd, 0xd3, 0xcf, 0xd1, 0xd4, 0xcd, 0xd1, 0xc7, 0xb4, 0xaf, 0xad, 0xaa, 0xaa, 0xaa, 0xad, 0xaf, 0xaa, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xe2, 0xad, 0xae, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xe3, 0xe3, 0xe3, 0xab, 0xab, 0xaf, 0xb6, 0xc0, 0xc3, 0xb9, 0xd2, 0xd6, 0xc2, 0xc9, 0xc4, 0xc9, 0xcc, 0xb9, 0x00, 0xe4, 0xe8, 0xb9, 0xa4, 0x00, 0x00, 0x00, 0xe3, 0x00, 0xf5, 0x00, 0xf5, 0xfe, 0xf5, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xc3, 0xd9, 0xe7, 0xfc, 0xdc, 0xeb, 0xc0, 0xc0, 0xc8, 0xd2, 0x9b, 0x69, 0x30, 0x4b, 0x06, 0x08, 0x1a, 0x1a, 0x17, 0x19, 0x1c, 0x19, 0x0d, 0x03, 0x01, 0x05, 0x68, 0x65, 0x6c, 0x68, 0x5d, 0x53, 0x5d, 0x7b, 0x93, 0x91, 0x79, 0x69, 0xca, 0x69, 0xc7, 0xc7, 0xca, 0xc9, 0xcd, 0xcd, 0xcd, 0xd0, 0xce, 0xcd, 0xd2, 0xc8, 0xc9, 0xcb, 0xdd, 0x92, 0xcb, 0xce, 0xd1, 0xcf, 0xd3, 0xce, 0xcd, 0xb8, 0xac, 0xaa, 0xad, 0xb0, 0xad, 0xad, 0xad, 0xac, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe3, 0xaa, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa4, 0x00, 0x00, 0xa5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xe2, 0xab, 0xab, 0xad, 0xad, 0xb1, 0xb8, 0xbd, 0xc2, 0xc8, 0xd2, 0xc5, 0xc0, 0xc5, 0xc8, 0xc8, 0xc2, 0xcb, 0xb3, 0x00, 0xdf, 0xe5, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa7, 0x00, 0xa4, 0x00, 0xb1, 0xe6, 0xea, 0xc6, 0xcd, 0xc7, 0xc5, 0xd1, 0x9b, 0x7f, 0x43, 0x4b, 0x5d, 0x01, 0x02, 0x05, 0x05, 0x03, 0x02, 0x02, 0x08, 0x67, 0x68, 0x5d, 0x64, 0x53, 0x53, 0x6d, 0x8a, 0x97, 0x8c, 0x76, 0x62, 0xc5, 0xc7, 0xca, 0xca, 0xc7, 0xc8, 0xcd, 0xcb, 0xcf, 0xcb, 0xcd, 0xcd, 0xcd, 0xd3, 0xda, 0xdb, 0xdc, 0xdd, 0xd8, 0xd1, 0xd1, 0xd2, 0xd3, 0xd0, 0xcf, 0xd3, 0xcb, 0xac, 0xad, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xab, 0xa6, 0x29, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0xa8, 0xfe, 0x29, 0x00, 0xa4, 0x29, 0x00, 0x00, 0x00, 0xb3, 0xe4, 0xc1, 0xba, 0xe2, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xa8, 0xe3, 0xad, 0xad, 0xb1, 0xb7, 0xb8, 0xb8, 0xbf, 0xbd, 0xc0, 0xc9, 0xc5, 0xc8, 0xcb, 0xc5, 0xcb, 0xbd, 0x00, 0x74, 0xdc, 0xe5, 0x74, 0xc6, 0xb5, 0x00, 0xae, 0x00, 0x00, 0xa4, 0xe2, 0x00, 0xa7, 0xe3, 0x00, 0x00, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xfe, 0x00, 0xf5, 0xf5, 0xf5, 0x00, 0x3d, 0x7d, 0xe8, 0xc6, 0xbe, 0xcb, 0xc8, 0xc8, 0x90, 0x97, 0x56, 0x3e, 0x61, 0x58, 0x65, 0x08, 0x60, 0x60, 0x67, 0x65, 0x65, 0x5a, 0x58, 0x5a, 0x79, 0x91, 0x94, 0x85, 0xce, 0x5e, 0xc7, 0xcd, 0xc8, 0xc8, 0xc8, 0xc9, 0xc7, 0xc9, 0xcb, 0xcb, 0xcd, 0xcd, 0xcd, 0xcb, 0xcb, 0xd1, 0xd8, 0xd2, 0xd7, 0xc3, 0xc8, 0xd2, 0xc9, 0xd0, 0xce, 0xd3, 0xcd, 0xd3, 0xc4, 0xa9, 0xad, 0xb0, 0xad, 0xac, 0xac, 0xad, 0xaf, 0xac, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa7, 0xab, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xb3, 0xc1, 0x49, 0xae, 0xaf, 0xb5, 0xb5, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa8, 0xa9, 0xac, 0xac, 0xad, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xc5, 0xc5, 0xc7, 0xc5, 0xc7, 0xcd, 0xcd, 0xc0, 0x00, 0xbd, 0xe8, 0x84, 0xe9, 0xdc, 0xe7, 0xc6, 0x00, 0x5c, 0x78, 0x74, 0xc1, 0xfe, 0xa4, 0x00, 0x00, 0xe3, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xa4, 0xd7, 0xdb, 0x00, 0xbb, 0xc7, 0xc7, 0xc9, 0xd7, 0x9d, 0x8d, 0x64, 0x50, 0x52, 0x55, 0x55, 0x55, 0x52, 0x53, 0x5d, 0x73, 0x88, 0x98, 0xda, 0x76, 0xcd, 0xca, 0xcc, 0xc8, 0xc5, 0xc5, 0xc7, 0xc9, 0xc3, 0xc4, 0xc9, 0xc9, 0xc7, 0xc7, 0xc9, 0xcd, 0xcd, 0xcb, 0xcd, 0xd0, 0xcd, 0xbf, 0xbf, 0xd1, 0xd3, 0xca, 0xcf, 0xcf, 0xbe, 0xc0, 0xbc, 0xc4, 0xc0, 0xb4, 0xac, 0xac, 0xa6, 0xac, 0xad, 0xaf, 0xaf, 0xaa, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa9, 0xa5, 0x29, 0xa4, 0x29, 0x00, 0xe2, 0xb4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe2, 0xaa, 0xac, 0xaa, 0xac, 0xb2, 0xb2, 0xb6, 0xb4, 0xb4, 0xbf, 0xbf, 0xc5, 0xc7, 0xc5, 0xc5, 0xcd, 0xc8, 0xa8, 0xb8, 0xe7, 0xb1, 0xe2, 0x00, 0xc1, 0xe0, 0xde, 0xe6, 0xdc, 0xda, 0xe7, 0xe0, 0x74, 0x00, 0xfe, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa7, 0x00, 0xa4, 0xff, 0xa4, 0x31, 0xa7, 0xea, 0xe1, 0xf9, 0xd4, 0xd4, 0xc9, 0xcb, 0xcb, 0x7c, 0x9b, 0x97, 0x8d, 0x81, 0x7e, 0x7b, 0x81, 0x8c, 0x94, 0x90, 0x88, 0xd0, 0x70, 0xcb, 0xc8, 0xc5, 0xc4, 0xc6, 0xc5, 0xc5, 0xc7, 0xc5, 0xc9, 0xc7, 0xc9, 0xc7, 0xc7, 0xcb, 0xc9, 0xcb, 0xc7, 0xc9, 0xd2, 0xd2, 0xc7, 0xc4, 0xc4, 0xc4, 0xcd, 0xcb, 0xbd, 0xb6, 0xb6, 0xb7, 0xb7, 0xb6, 0xb9, 0xbc, 0xa8, 0xad, 0xad, 0xac, 0xac, 0xac, 0xaa, 0xa8, 0x00, 0x00, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xe3, 0xb1, 0xb8, 0xbc, 0xb3, 0xa8, 0x00, 0xaa, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xaa, 0xaa, 0xaa, 0xa9, 0xaa, 0xb4, 0xb4, 0xb3, 0xb6, 0xb1, 0xb7, 0xc8, 0xc4, 0xc7, 0xc9, 0xc8, 0xc8, 0xcd, 0xa6, 0xb2, 0xdf, 0xcc, 0xe4, 0xc6, 0xe2, 0x5c, 0x84, 0x00, 0xa4, 0x00, 0x00, 0xc6, 0xe7, 0x84, 0xf5, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xa4, 0x00, 0xf5, 0xcc, 0xe9, 0xdd, 0xde, 0xad, 0xcd, 0xd0, 0xc5, 0xca, 0xd4, 0x7f, 0x88, 0x8a, 0x8d, 0xd9, 0x7f, 0xd3, 0xcd, 0xca, 0xc7, 0xc9, 0xca, 0xc7, 0xc5, 0xc8, 0xc5, 0xc3, 0xc5, 0xc9, 0xc9, 0xc7, 0xc5, 0xc5, 0xc7, 0xc9, 0xcd, 0xcf, 0xd0, 0xd2, 0xd6, 0xd4, 0xc9, 0xbf, 0xc2, 0xc2, 0xc4, 0xc5, 0xbd, 0xb6, 0xb6, 0xbc, 0xb7, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4, 0xac, 0xab, 0xac, 0xab, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0xa7, 0xc3, 0xba, 0x49, 0xb5, 0xba, 0x49, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa6, 0xaa, 0xaa, 0xaa, 0xac, 0xaa, 0xac, 0xb1, 0xb0, 0xb6, 0xb4, 0xb1, 0xb9, 0xc0, 0xc7, 0xc7, 0xc4, 0xcf, 0xc7, 0xc5, 0xaa, 0xb9, 0xe0, 0xbe, 0xbe, 0xb5, 0xb3, 0xb8, 0xba, 0xb9, 0xb9, 0xb8, 0xb4, 0x00, 0x3d, 0xfd, 0xe5, 0x00, 0xa7, 0xf5, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xa5, 0x00, 0x00, 0x00, 0xc6, 0xe1, 0xbf, 0xba, 0xc7, 0xd2, 0xcd, 0xcb, 0xc8, 0xcd, 0xc8, 0xc5, 0xca, 0xcb, 0xc7, 0xc7, 0xca, 0xc8, 0xca, 0xc9, 0xca, 0xc5, 0xc0, 0xc4, 0xcb, 0xbf, 0xc7, 0xcf, 0xcf, 0xce, 0xcd, 0xc7, 0xc0, 0xc2, 0xcf, 0xd4, 0xd2, 0xce, 0xc2, 0xbd, 0xbd, 0xbf, 0xbf, 0xc2, 0xbe, 0xb9, 0xb4, 0xb3, 0xb4, 0xb1, 0xb3, 0xb4, 0xb7, 0xb9, 0xb6, 0xad, 0xac, 0xad, 0xe3, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x3d, 0x49, 0xae, 0xa4, 0x00, 0xff, 0xfe, 0xfe, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa4, 0x00, 0x00, 0xa6, 0xac, 0xa9, 0xa9, 0xac, 0xaf, 0xb0, 0xb4, 0xb7, 0xb4, 0xb4, 0xbb, 0xc3, 0xc5, 0xc4, 0xc7, 0xc2, 0xcb, 0xc9, 0x29, 0xce, 0xe6, 0xb8, 0xbb, 0xac, 0xa6, 0xb1, 0xb4, 0xb0, 0xaf, 0x3d, 0xb3, 0xe4, 0x00, 0xc6, 0xe7, 0xae, 0xf5, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe6, 0xd4, 0x84, 0xc5, 0xc3, 0xc4, 0xbe, 0xd5, 0xd5, 0xad, 0xc5, 0xd2, 0xcb, 0xc2, 0xc8, 0xcd, 0xc7, 0xce, 0xc5, 0xc3, 0xcd, 0xcd, 0xc4, 0xc0, 0xc4, 0xcb, 0xcf, 0xcf, 0xc7, 0xc5, 0xc7, 0xc2, 0xbd, 0xbb, 0xbe, 0xbd, 0xbb, 0xb9, 0xbb, 0xbe, 0xc3, 0xbe, 0xbf, 0xbf, 0xb9, 0xb6, 0xb2, 0xaf, 0xaa, 0xaa, 0xac, 0xaf, 0xb4, 0xb9, 0xb6, 0xaf, 0xad, 0xae, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xb3, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe3, 0xb1, 0xb3, 0xb2, 0xab, 0xa6, 0xa8, 0xad, 0xac, 0xac, 0xb4, 0xb2, 0xb4, 0xb1, 0xb6, 0xbe, 0xc5, 0xc5, 0xc5, 0xc8, 0xc9, 0xcf, 0xbd, 0x00, 0xdc, 0xd3, 0xb1, 0xb8, 0xad, 0xa9, 0xad, 0xad, 0xaa, 0xa8, 0xa6, 0xa7, 0xb4, 0xa4, 0xa7, 0xfd, 0x5c, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x84, 0xde, 0x00, 0xb0, 0x6e, 0xd1, 0xd4, 0xd7, 0xc7, 0xd9, 0xd1, 0xbc, 0xb9, 0xcf, 0xd3, 0xc2, 0xbe, 0xcd, 0xc7, 0xc3, 0xc8, 0xd2, 0xd5, 0xd2, 0xcf, 0xd1, 0xd1, 0xcf, 0xc4, 0xbb, 0xb7, 0xbb, 0xbc, 0xbb, 0xbd, 0xbc, 0xb9, 0xb8, 0xbe, 0xc0, 0xbd, 0xbb, 0xbf, 0xbe, 0xb9, 0xb7, 0xb2, 0xb0, 0xac, 0xa6, 0xa9, 0xaa, 0xac, 0xb2, 0xb7, 0xb5, 0xac, 0xab, 0xae, 0xa7, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0xa4, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa4, 0x00, 0x00, 0xa4, 0xab, 0xb3, 0x49, 0xc1, 0xb7, 0xaa, 0xaa, 0xad, 0xaa, 0xac, 0xb4, 0xb3, 0xb4, 0xb6, 0xb9, 0xc0, 0xc4, 0xc4, 0xc5, 0xc2, 0xcb, 0xc5, 0xb9, 0xc7, 0xe8, 0xd9, 0xb9, 0xb3, 0xb0, 0xaf, 0xad, 0xa8, 0xaa, 0xfe, 0xa8, 0xb1, 0xae, 0xb3, 0xfe, 0x92, 0xe5, 0xae, 0xa7, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xff, 0x00, 0xf5, 0xde, 0xe4, 0xa4, 0xa5, 0xa4, 0xb1, 0xb2, 0xb6, 0xa9, 0xb4, 0xd4, 0xd5, 0xd1, 0xcf, 0xd5, 0xd7, 0xd0, 0xb7, 0x5c, 0xc8, 0x6e, 0xce, 0xc4, 0xbe, 0xc1, 0xca, 0xc3, 0xbe, 0xb8, 0xb6, 0xb6, 0xb4, 0xb6, 0xb7, 0xbb, 0xbe, 0xbe, 0xbd, 0xbf, 0xbe, 0xbb, 0xbc, 0xbc, 0xb7, 0xb2, 0xb2, 0xb1, 0xac, 0xa9, 0xaa, 0xaa, 0xab, 0xab, 0xaf, 0xb4, 0xb1, 0xab, 0xaa, 0xae, 0xa6, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa4, 0xa4, 0xad, 0xb8, 0xb8, 0xaa, 0xa8, 0xad, 0xaf, 0xac, 0xb7, 0xbc, 0xbd, 0xbf, 0xc3, 0xc0, 0xc2, 0xc4, 0xc5, 0xc7, 0xc5, 0xc0, 0xd0, 0xce, 0xe7, 0xda, 0xbd, 0xaf, 0xa6, 0xa5, 0xa4, 0xa5, 0xa9, 0xe2, 0x00, 0x3d, 0xae, 0xe2, 0xe0, 0xa1, 0xe1, 0xdb, 0x5c, 0x00, 0x00, 0xa7, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xae, 0xe8, 0x49, 0x00, 0x00, 0xab, 0xa4, 0x00, 0xac, 0x29, 0xa9, 0xad, 0xb9, 0xbc, 0xb3, 0xb5, 0xc7, 0x78, 0xd6, 0x74, 0xd4, 0xe5, 0xc0, 0xb5, 0xb1, 0xb4, 0xb7, 0xb9, 0xb4, 0xb4, 0xb6, 0xb7, 0xb4, 0xb4, 0xb6, 0xb7, 0xb9, 0xb9, 0xb8, 0xb9, 0xbb, 0xbb, 0xbe, 0xb4, 0xac, 0xa9, 0xac, 0xad, 0xa9, 0xa9, 0xad, 0xaa, 0xab, 0xaa, 0xad, 0xb1, 0xaf, 0xaa, 0xad, 0xab, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x3d, 0xaa, 0xaa, 0xad, 0xac, 0xa9, 0xb4, 0xbc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc4, 0xcb, 0xc4, 0xc9, 0xcd, 0xbb, 0x00, 0xc2, 0xe8, 0x84, 0xbd, 0x00, 0x00, 0x29, 0x00, 0x00, 0xa8, 0xe2, 0xa6, 0xe3, 0xbc, 0xbe, 0xa4, 0xaf, 0xd7, 0xde, 0xc6, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xf5, 0x00, 0xa7, 0x9e, 0xe4, 0xa7, 0xe3, 0x00, 0xae, 0xa9, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa9, 0xe3, 0xa9, 0xe3, 0xb5, 0xba, 0xbf, 0xe4, 0xb8, 0xaf, 0xab, 0xab, 0xab, 0xaa, 0xb1, 0xb1, 0xb0, 0xb2, 0xb3, 0xb4, 0xb4, 0xb6, 0xb7, 0xb9, 0xb9, 0xb9, 0xbb, 0xb7, 0xb1, 0xac, 0xaa, 0xa9, 0xa6, 0xa9, 0xa9, 0xa8, 0xa9, 0xaa, 0xa9, 0xaa, 0xab, 0xab, 0xaf, 0xac, 0xe2, 0xad, 0xe3, 0xaa, 0xa5, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa8, 0xa9, 0xa8, 0xa6, 0xa9, 0xad, 0xab, 0xaa, 0xac, 0xac, 0xb8, 0xbf, 0xbe, 0xbe, 0xc0, 0xc0, 0xc5, 0xc5, 0xc0, 0xc3, 0xcf, 0xc7, 0xc4, 0x00, 0xd5, 0xe0, 0x74, 0xb3, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0xa7, 0xa8, 0xae, 0xb0, 0x00, 0xb1, 0x00, 0xa8, 0xe9, 0xdc, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xfe, 0xdb, 0x84, 0x00, 0xa7, 0xa5, 0x00, 0xa4, 0xa8, 0x00, 0x29, 0xa4, 0xa6, 0xa7, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfe, 0xab, 0xab, 0xe3, 0xe2, 0xa8, 0x00, 0xa6, 0xaa, 0xab, 0xaf, 0xb3, 0xb4, 0x3d, 0xb4, 0xb6, 0xb2, 0xab, 0xaa, 0xa9, 0xa6, 0xaa, 0xa8, 0xaa, 0xac, 0xa9, 0xa8, 0xa9, 0xa9, 0xa9, 0xa8, 0xab, 0xab, 0xac, 0xae, 0xa9, 0xa8, 0xe3, 0xab, 0xe3, 0xe2, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa5, 0xe2, 0xa8, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xad, 0xaa, 0xaa, 0xab, 0xaa, 0xad, 0xac, 0xba, 0xbf, 0xbe, 0xbe, 0xc0, 0xc0, 0xc2, 0xc3, 0xcb, 0xc8, 0xc4, 0xc9, 0xce, 0xb2, 0xa4, 0xe0, 0x84, 0xbe, 0xa7, 0x00, 0x00, 0xa6, 0x00, 0xa4, 0xe2, 0xa6, 0xab, 0xb1, 0xa9, 0xb1, 0xa9, 0xa5, 0xe0, 0xba, 0xa5, 0xa4, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xff, 0x00, 0x00, 0xb5, 0xe1, 0xe0, 0x49, 0x00, 0xa4, 0xa5, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xfe, 0xe2, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xb1, 0xb3, 0xb2, 0xb4, 0xaa, 0x29, 0xa9, 0xac, 0xa8, 0xa9, 0xac, 0xa6, 0xa6, 0x29, 0xa6, 0x29, 0xa6, 0xa6, 0xa6, 0xa6, 0xac, 0xab, 0xa8, 0xa8, 0xa4, 0x00, 0x00, 0xa5, 0xa8, 0xe2, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa5, 0xa4, 0xa5, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa8, 0xa8, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xb9, 0xbf, 0xbf, 0xbf, 0xbf, 0xc0, 0xc2, 0xc4, 0xc7, 0xc5, 0xc5, 0xcb, 0xc7, 0xc5, 0x00, 0xd1, 0xe7, 0x63, 0xb0, 0x00, 0x00, 0xa5, 0x00, 0xa5, 0xa4, 0xa6, 0xa9, 0xaf, 0xac, 0xa8, 0xb6, 0x00, 0xea, 0x78, 0x00, 0xa4, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x00, 0xa7, 0xe3, 0xe7, 0xe5, 0xe4, 0xe5, 0xb3, 0xa4, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0xab, 0xb3, 0xb3, 0xa8, 0xa8, 0xaa, 0xa9, 0xa9, 0xa6, 0x29, 0xa6, 0xa8, 0xa6, 0x29, 0x00, 0x29, 0xa5, 0xa8, 0x29, 0xa8, 0xa4, 0x00, 0xa4, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa5, 0xa5, 0xa7, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa8, 0xa8, 0xa9, 0xa9, 0xaa, 0xab, 0xac, 0xb4, 0xbb, 0xbe, 0xbd, 0xbe, 0xbf, 0xbf, 0xc0, 0xc5, 0xc5, 0xc7, 0xc7, 0xcb, 0xc8, 0xcb, 0xab, 0xbd, 0xe7, 0xd3, 0xb3, 0x00, 0x00, 0xa5, 0x00, 0x00, 0xa6, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xbb, 0xb6, 0xd3, 0xe1, 0xda, 0xa8, 0xa7, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6e, 0xe1, 0xa5, 0x00, 0xc4, 0x49, 0xaf, 0xa5, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0xa5, 0xad, 0x3d, 0xa6, 0xe2, 0xaa, 0xa6, 0xa6, 0xa9, 0xa9, 0xa8, 0x00, 0x29, 0xa9, 0xa6, 0x00, 0x29, 0xa6, 0xa8, 0xa8, 0x29, 0xa5, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0xa5, 0x29, 0xa7, 0xaa, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa5, 0xa5, 0xa8, 0xa9, 0xab, 0xab, 0xad, 0xb8, 0xbe, 0xbe, 0xbd, 0xbe, 0xbf, 0xbf, 0xc2, 0xc4, 0xc5, 0xc7, 0xc8, 0xc9, 0xc8, 0xcf, 0xb7, 0xa8, 0xa1, 0xd7, 0xb7, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa7, 0xab, 0xa8, 0xa9, 0xb1, 0xb4, 0xbe, 0xc8, 0xb8, 0xad, 0xde, 0xdc, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0xf5, 0x00, 0xde, 0x63, 0x00, 0xb5, 0x3d, 0x3d, 0xb3, 0xe3, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0x00, 0x00, 0x00, 0xe2, 0xe3, 0xe2, 0xa9, 0xa5, 0x29, 0xa8, 0xa9, 0xa6, 0x00, 0xa6, 0x29, 0x00, 0x29, 0xa6, 0xa6, 0xa4, 0x00, 0x00, 0xa6, 0xfe, 0xa4, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x29, 0xa4, 0xa6, 0x00, 0x29, 0xa4, 0xa5, 0xa6, 0xe3, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa6, 0xa8, 0xaa, 0xab, 0xac, 0xb7, 0xbd, 0xbe, 0xbd, 0xbe, 0xbf, 0xbf, 0xc0, 0xc5, 0xc7, 0xc7, 0xc8, 0xc8, 0xc4, 0xcf, 0xbb, 0x00, 0xe7, 0xd7, 0xb9, 0xa5, 0x00, 0x00, 0xa4, 0xa4, 0xa5, 0xa8, 0xa6, 0xad, 0xbb, 0xbd, 0xc2, 0xc0, 0xc5, 0xad, 0xad, 0xe0, 0xf1, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xe0, 0xb3, 0xa5, 0xb8, 0xb6, 0xb5, 0xab, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xae, 0xb5, 0xb5, 0xae, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xa4, 0x00, 0xa4, 0xa6, 0xa8, 0xa4, 0x29, 0x00, 0xa8, 0x29, 0xa8, 0xa9, 0xa6, 0xa4, 0xab, 0xb6, 0xa8, 0xa5, 0x29, 0x00, 0x00, 0xa5, 0xa5, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0xa6, 0xa6, 0x29, 0xa8, 0xe3, 0xa6, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa8, 0xaa, 0xab, 0xab, 0xb0, 0xb9, 0xbe, 0xbd, 0xbd, 0xbe, 0xbe, 0xc0, 0xc5, 0xc7, 0xc8, 0xc8, 0xc8, 0xc6, 0xcf, 0xbb, 0x29, 0xe7, 0xd6, 0xb9, 0xa5, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa9, 0xa6, 0xaf, 0xbe, 0xc0, 0xc2, 0xc5, 0xc5, 0xcf, 0x00, 0xd8, 0xea, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xf5, 0x49, 0x9e, 0xb1, 0xa4, 0xb7, 0xb8, 0x49, 0xe2, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x3d, 0xb3, 0x3d, 0xe3, 0xa7, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xa5, 0xa6, 0xaf, 0xb8, 0xc0, 0xc2, 0xc3, 0x5c, 0xb8, 0xab, 0xad, 0xb5, 0xb9, 0xb0, 0x00, 0x00, 0xa6, 0xa5, 0x00, 0xa5, 0xa4, 0xa5, 0xa4, 0x00, 0x00, 0x29, 0xa4, 0x29, 0xa6, 0xa9, 0xa6, 0xa9, 0xe3, 0xa5, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa8, 0xaa, 0xaa, 0xaa, 0xab, 0xb8, 0xbd, 0xbe, 0xbe, 0xbf, 0xbf, 0xc2, 0xc5, 0xc5, 0xc8, 0xc8, 0xcb, 0xc8, 0xcf, 0xb8, 0xaa, 0xa1, 0xd7, 0xb8, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0xad, 0xaa, 0xac, 0xb9, 0xbf, 0xc2, 0xc2, 0xce, 0xc3, 0x29, 0xc6, 0xdf, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xa5, 0x49, 0xe7, 0xaf, 0x00, 0xb9, 0xb3, 0xb6, 0xa9, 0xa4, 0xa5, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0xad, 0xb6, 0xba, 0xe2, 0x29, 0x00, 0xaa, 0xb5, 0xb8, 0xb1, 0xa4, 0xba, 0xe4, 0xb3, 0xa4, 0xe2, 0xa4, 0x00, 0xa5, 0xa4, 0xe2, 0xfe, 0xa9, 0xa8, 0xa6, 0xa6, 0xa6, 0xa8, 0xa9, 0xa9, 0xab, 0xab, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xe2, 0xaa, 0xab, 0xab, 0xac, 0xb6, 0xbb, 0xbb, 0xbe, 0xbf, 0xc2, 0xc5, 0xc5, 0xc7, 0xc7, 0xc8, 0xcb, 0xf1, 0xcb, 0xad, 0xbe, 0xa1, 0xd2, 0xb6, 0x00, 0x00, 0xe2, 0xa5, 0xe2, 0xa5, 0xae, 0xab, 0xac, 0xbb, 0xc0, 0xc3, 0xcb, 0xce, 0xc4, 0xaa, 0xcc, 0xdc, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xe0, 0x49, 0x29, 0xb7, 0xb7, 0x49, 0xa4, 0x00, 0xa4, 0x00, 0xa8, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0xa4, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaf, 0xfe, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0x29, 0xb1, 0xb3, 0xb1, 0xa6, 0xc5, 0x57, 0xa4, 0x00, 0xa8, 0x00, 0xa6, 0xa4, 0xe2, 0xad, 0xab, 0xaa, 0xaa, 0xa9, 0xa8, 0xa6, 0xa9, 0xaa, 0xad, 0xad, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x29, 0xa9, 0xab, 0xab, 0xaa, 0xab, 0xb3, 0xb6, 0xb6, 0xbb, 0xbe, 0xc0, 0xc4, 0xc5, 0xc7, 0xc7, 0xc5, 0xcb, 0xc8, 0xc7, 0x00, 0xd4, 0xdf, 0xc5, 0xb3, 0xa8, 0x29, 0xe3, 0xad, 0x3d, 0xa8, 0xad, 0xad, 0xb2, 0xbf, 0xc7, 0xc5, 0xc8, 0xc8, 0xc6, 0x00, 0xd9, 0xe9, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xf5, 0xdc, 0x84, 0x00, 0x3d, 0xba, 0xb6, 0xab, 0xa4, 0xa4, 0xe2, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa8, 0xb1, 0xa6, 0xb4, 0xc8, 0xb7, 0x00, 0xa8, 0xa4, 0xa6, 0x00, 0xb6, 0xad, 0xad, 0xac, 0xa8, 0xaf, 0xa9, 0xac, 0xad, 0xac, 0xad, 0xaa, 0xa9, 0x29, 0x29, 0x00, 0x00, 0xa6, 0xa4, 0xe3, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa8, 0xaa, 0xab, 0xe2, 0xaa, 0xaa, 0xad, 0xb1, 0xb5, 0xb7, 0xb4, 0xb4, 0xb8, 0xc0, 0xc8, 0xc5, 0xc3, 0xce, 0xcd, 0xc4, 0xcd, 0xb1, 0xad, 0xe0, 0xd7, 0xc5, 0xb2, 0xa9, 0xaf, 0xaa, 0xad, 0xaa, 0xaf, 0xa6, 0xb3, 0xc2, 0xc4, 0xc7, 0xcd, 0xcc, 0xc6, 0xad, 0xb3, 0xe1, 0xe4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf5, 0xc6, 0xe1, 0xb9, 0xa5, 0xb3, 0xb5, 0xb1, 0xa5, 0xa4, 0xaa, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xad, 0xac, 0xb1, 0xc4, 0xbb, 0xa8, 0x29, 0x00, 0xa8, 0xb1, 0xb9, 0xb1, 0xac, 0xad, 0xad, 0xad, 0xad, 0xac, 0xac, 0xac, 0xac, 0xac, 0xaa, 0xa9, 0xa6, 0xa8, 0xa6, 0xe3, 0xa9, 0xae, 0xa6, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe2, 0xab, 0xaa, 0xab, 0xad, 0xaf, 0x3d, 0xb4, 0xb5, 0xb5, 0xb4, 0xb7, 0xbe, 0xc5, 0xc8, 0xc5, 0xc2, 0xc0, 0xcb, 0xc0, 0x29, 0xea, 0xdb, 0xd1, 0xc0, 0xb8, 0xb2, 0xb0, 0xaf, 0xb2, 0xad, 0xb8, 0xbe, 0xc2, 0xc5, 0xcb, 0xce, 0xc3, 0x5c, 0xae, 0xb5, 0xde, 0xea, 0x00, 0xa7, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xd7, 0xe7, 0xc4, 0xab, 0xb5, 0xb5, 0xaa, 0xa5, 0xe3, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x29, 0xaa, 0xac, 0xaf, 0xbf, 0xbb, 0xb1, 0xac, 0xaa, 0xb3, 0xb9, 0xbc, 0xbb, 0xaf, 0xa9, 0xaf, 0xac, 0xad, 0xac, 0xac, 0xac, 0xaa, 0xaa, 0xaa, 0xac, 0xac, 0xab, 0xab, 0xaa, 0xad, 0xae, 0xa8, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe2, 0xaa, 0xab, 0xab, 0xaf, 0xb1, 0xb4, 0xb4, 0xb4, 0xb6, 0xb4, 0xb7, 0xbc, 0xc3, 0xc4, 0xc7, 0xcb, 0xcd, 0xbd, 0xad, 0xdc, 0xdd, 0xd1, 0xc8, 0xbc, 0xb7, 0xb0, 0xad, 0xad, 0xa9, 0xaa, 0xb9, 0xc3, 0xc7, 0xc0, 0xc8, 0xce, 0xb9, 0x6e, 0xdb, 0xe1, 0x78, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x00, 0xb5, 0xe8, 0xd9, 0xab, 0xb5, 0xb8, 0xb3, 0xad, 0xab, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xaa, 0xac, 0xb4, 0xbe, 0xb9, 0xb4, 0xb8, 0xb8, 0xbb, 0xb9, 0xbb, 0xcd, 0xbc, 0x29, 0xaa, 0xac, 0xaa, 0xac, 0xaa, 0xac, 0xaa, 0xaa, 0xaa, 0xac, 0xac, 0xab, 0xaa, 0xaa, 0xb5, 0xb0, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa8, 0xe2, 0xe2, 0xab, 0xad, 0x3d, 0xb4, 0xb5, 0xb5, 0xb6, 0xb5, 0xb6, 0xbb, 0xc5, 0xc3, 0xc2, 0xcb, 0xbf, 0xc0, 0xe1, 0xdc, 0xcd, 0xce, 0xc7, 0xbb, 0xbc, 0xb8, 0xb0, 0xb6, 0xb2, 0xb8, 0xbe, 0xc2, 0xc4, 0xc5, 0xcd, 0xcf, 0xbf, 0xae, 0xe7, 0xc6, 0xf5, 0xf5, 0x00, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x3d, 0xe1, 0xd3, 0xa4, 0xb4, 0xb7, 0xb9, 0x49, 0xb3, 0xaa, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xa6, 0xa9, 0xab, 0xb0, 0xb7, 0xbc, 0xba, 0xb9, 0xbb, 0xba, 0xbb, 0xbc, 0xb4, 0xd3, 0xcf, 0xac, 0xaa, 0xad, 0xaa, 0xaa, 0xac, 0xac, 0xaa, 0xa9, 0xa9, 0xa9, 0xa9, 0xac, 0xa9, 0xb1, 0xbb, 0xb5, 0xa9, 0xa4, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xa7, 0xa6, 0xa7, 0xab, 0xae, 0xb3, 0xb4, 0xb6, 0xb6, 0xb4, 0xb4, 0xbc, 0xc7, 0xcb, 0xc7, 0xc4, 0xce, 0xa6, 0xcf, 0xe1, 0xd1, 0xd0, 0xbf, 0xb6, 0xbf, 0xbe, 0xb4, 0xbc, 0xc0, 0xc4, 0xc7, 0xc0, 0xc3, 0xce, 0xcd, 0xce, 0xcf, 0x00, 0xd9, 0xe9, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xda, 0xdb, 0x00, 0xaa, 0xba, 0xb8, 0xb9, 0xb8, 0xb2, 0xa7, 0xa4, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xe2, 0xaa, 0xaa, 0xad, 0xb0, 0xb4, 0xb8, 0xbe, 0xba, 0xb7, 0xbc, 0xbe, 0xb4, 0xd2, 0xd4, 0xb4, 0xa9, 0xaa, 0xaa, 0xaa, 0xac, 0xac, 0xac, 0xa9, 0xa9, 0xa9, 0xaa, 0xac, 0xa9, 0xbd, 0xbd, 0xb7, 0xab, 0xa8, 0xa4, 0xa6, 0xa6, 0xa8, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0xa4, 0xa7, 0xaa, 0xae, 0xb2, 0xb6, 0xb6, 0xb4, 0xb7, 0xbe, 0xc5, 0xc2, 0xc7, 0xc8, 0xcb, 0xc4, 0x29, 0xda, 0xdb, 0xcd, 0xc3, 0xbb, 0xb9, 0xbb, 0xbd, 0xc3, 0xc0, 0xbf, 0xc3, 0xbe, 0xc3, 0xcf, 0xc8, 0xcb, 0xd1, 0xfe, 0xe5, 0xe9, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xae, 0xe8, 0x49, 0xa4, 0xbc, 0xbb, 0xbb, 0xb9, 0xb5, 0xaa, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa6, 0xa7, 0xa6, 0x00, 0xa8, 0xa6, 0xb0, 0xba, 0xbb, 0xba, 0xbd, 0xbc, 0xc5, 0xd6, 0xcf, 0xb4, 0xaa, 0xa8, 0xaa, 0xaa, 0xac, 0xac, 0xaa, 0xaa, 0xaa, 0xad, 0xb0, 0xb0, 0xb1, 0xd0, 0xbd, 0xb7, 0xb2, 0xad, 0xa6, 0xa8, 0xa9, 0xe2, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa5, 0xe2, 0xaa, 0x3d, 0xb6, 0xb7, 0xb8, 0xbe, 0xc2, 0xc4, 0xc2, 0xcf, 0xc4, 0xc5, 0xc9, 0xad, 0xbe, 0xe8, 0xd1, 0xd1, 0xce, 0xbf, 0xbf, 0xcd, 0xcd, 0xc2, 0xbf, 0xc5, 0xc4, 0xca, 0xd0, 0xcf, 0xcf, 0xc5, 0x00, 0xea, 0x7d, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0x00, 0xe5, 0xde, 0x00, 0xab, 0xbc, 0xba, 0xbc, 0xb9, 0xb1, 0xa4, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa5, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa4, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xb1, 0xbc, 0xbd, 0xbc, 0xb8, 0xd8, 0xdb, 0xc4, 0xac, 0xac, 0xaa, 0xaa, 0xac, 0xac, 0xac, 0xac, 0xaa, 0xad, 0xb1, 0xb4, 0xb4, 0xb9, 0xd8, 0xbd, 0xb8, 0xb7, 0xb4, 0xa6, 0xa6, 0xa8, 0xa8, 0x2b, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa8, 0xe2, 0xb2, 0xb7, 0xb8, 0xbd, 0xc3, 0xc7, 0xc3, 0xc5, 0xc2, 0xce, 0xc8, 0xd0, 0xb4, 0xaa, 0xdf, 0xd7, 0xce, 0xd2, 0xd1, 0xcf, 0xcf, 0xcb, 0xcf, 0xcb, 0xcd, 0xcb, 0xcd, 0xce, 0xd3, 0xcf, 0xb3, 0xb7, 0xe0, 0x49, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xd7, 0x7d, 0xe2, 0xad, 0xbd, 0xba, 0xb9, 0xbd, 0xad, 0x29, 0x00, 0x00, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa8, 0xa7, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x29, 0xa6, 0xb2, 0x57, 0xbf, 0xb8, 0xb7, 0xdd, 0xd4, 0xb2, 0xa9, 0xac, 0xad, 0xaf, 0xb0, 0xad, 0xaa, 0xa9, 0xaa, 0xb2, 0xb4, 0xb6, 0xb8, 0xd7, 0xd0, 0xb2, 0xb8, 0xb2, 0xb6, 0xb3, 0xaf, 0xad, 0xad, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf5, 0xa8, 0xab, 0xb1, 0xb4, 0xb7, 0xbe, 0xc2, 0xc3, 0xc4, 0xc7, 0xc7, 0xc9, 0xc5, 0xce, 0xc0, 0x00, 0xe7, 0xd9, 0xcd, 0xcf, 0xd2, 0xcf, 0xd1, 0xcf, 0xce, 0xcf, 0xcb, 0xd2, 0xd0, 0xcb, 0xc0, 0xaf, 0xb7, 0xe1, 0x74, 0xe3, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xd1, 0x00, 0xb7, 0xbf, 0xbc, 0xbc, 0xb9, 0xaa, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa4, 0x00, 0xad, 0xbc, 0xbe, 0xc0, 0xb1, 0xbf, 0xe0, 0xcb, 0xbb, 0xaa, 0xb0, 0xb4, 0xb0, 0xad, 0xa9, 0xaa, 0xaf, 0xb4, 0xb7, 0xac, 0xbc, 0xce, 0xdb, 0xc2, 0xbe, 0xc2, 0xbc, 0xb7, 0xb2, 0xaf, 0xab, 0xa4, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0xa8, 0xa9, 0xb3, 0xb6, 0xb6, 0xbb, 0xc2, 0xc3, 0xc2, 0xc7, 0xc5, 0xc5, 0xd0, 0xcb, 0xbb, 0xa6, 0xdd, 0xd8, 0xd3, 0xcf, 0xcf, 0xd2, 0xc8, 0xd1, 0xd1, 0xd2, 0xce, 0xcf, 0xc4, 0xd3, 0xd5, 0xea, 0xe0, 0xe5, 0x49, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x78, 0xe2, 0xb1, 0x57, 0xbd, 0xbd, 0xbc, 0xac, 0x29, 0xa4, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa5, 0xa7, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa4, 0x29, 0x00, 0xa8, 0xba, 0xbf, 0xc2, 0xbc, 0x29, 0xea, 0x92, 0xc7, 0xb2, 0xb4, 0xb4, 0xb2, 0xad, 0xad, 0xb0, 0xb2, 0xb6, 0xb6, 0xb9, 0xbc, 0xc4, 0xd6, 0xd8, 0xdb, 0xc8, 0xb6, 0xb8, 0xb1, 0xaa, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xe2, 0xa6, 0xb6, 0xb8, 0xb6, 0xbb, 0xc3, 0xc5, 0xc3, 0xcb, 0xcd, 0xcb, 0xc4, 0xcb, 0xb6, 0xb1, 0xe7, 0xd2, 0xb8, 0xd1, 0xd1, 0xd2, 0xd1, 0xd1, 0xd0, 0x6e, 0xd0, 0x7d, 0xb8, 0xda, 0xdf, 0xd4, 0xb9, 0xab, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x84, 0xd9, 0x00, 0xb2, 0xbe, 0xbc, 0xbd, 0xbe, 0xb6, 0xa9, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa5, 0xa7, 0xa7, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa6, 0xb9, 0xc0, 0xbf, 0xc8, 0xaa, 0xbf, 0xe0, 0xc9, 0xbc, 0xb1, 0xb4, 0xb2, 0xb2, 0xb4, 0xb6, 0xb6, 0xb6, 0xb6, 0xb9, 0xbe, 0xcb, 0xc0, 0x92, 0xd9, 0xb5, 0xb7, 0xb4, 0xab, 0xa8, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa6, 0xaa, 0xa9, 0xb4, 0xb7, 0xb7, 0xbd, 0xc4, 0xc5, 0xc4, 0xc2, 0xc5, 0xd3, 0xcc, 0xc5, 0xa4, 0xc9, 0xe1, 0xdd, 0xdc, 0xdc, 0xc7, 0xc6, 0xd2, 0x6e, 0xd1, 0xd0, 0x6e, 0xb1, 0xc4, 0xe0, 0xc0, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0xe5, 0xe6, 0x00, 0xb5, 0xbf, 0xbe, 0xbd, 0xbc, 0xbb, 0xb3, 0x2a, 0x00, 0xa6, 0xa8, 0xa5, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0xa5, 0xe2, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0x29, 0x00, 0xaa, 0xbb, 0xc2, 0xc2, 0xc0, 0xb6, 0xbf, 0xdf, 0xd3, 0xbf, 0xaf, 0xb1, 0xb2, 0xb6, 0xb7, 0xb7, 0xb6, 0xb7, 0xbb, 0xbe, 0xcb, 0xc0, 0xcd, 0xa1, 0xb9, 0xb5, 0xbd, 0xae, 0xaa, 0xe2, 0xa8, 0x00, 0x00, 0xa4, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xe2, 0xab, 0xaf, 0xb4, 0xb6, 0xbb, 0xbf, 0xc2, 0xc2, 0xc4, 0xcb, 0xc9, 0xbf, 0xc9, 0xba, 0xb6, 0xe7, 0x78, 0x63, 0xd7, 0xda, 0xde, 0xd4, 0xc8, 0xd7, 0x78, 0x63, 0xc6, 0x78, 0xe0, 0xd9, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xe8, 0xc4, 0x00, 0xb8, 0x5c, 0xbf, 0xbb, 0xbe, 0xbb, 0xb1, 0xaf, 0xad, 0xaf, 0xe2, 0xa5, 0xa5, 0xa4, 0x00, 0x00, 0xa5, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa4, 0x00, 0xa4, 0xe2, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa5, 0xa6, 0xaf, 0xbe, 0xc0, 0xbf, 0xc0, 0xb8, 0xbb, 0xe7, 0xd6, 0xbe, 0xb2, 0xb1, 0xb2, 0xb4, 0xb6, 0xb6, 0xb6, 0xbc, 0xc2, 0xc5, 0xcf, 0xbb, 0xd7, 0xe6, 0xb2, 0xc0, 0x49, 0xad, 0xe2, 0xaa, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa4, 0xa6, 0xa9, 0xaa, 0xac, 0xb4, 0xb7, 0xb9, 0xbf, 0xc4, 0xc4, 0xc2, 0xc7, 0xc8, 0xce, 0xcf, 0xba, 0xbe, 0xe7, 0xe9, 0x00, 0x00, 0xa8, 0x00, 0xd4, 0xe6, 0xe6, 0xdc, 0xdf, 0xde, 0xe0, 0xdf, 0xc6, 0x00, 0xaa, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xe2, 0x00, 0xd8, 0xe6, 0x29, 0xa8, 0xbb, 0xbe, 0xbe, 0xbf, 0xbc, 0xb7, 0xb7, 0xb3, 0xb3, 0xab, 0xa5, 0xa5, 0xa6, 0xa5, 0xa5, 0xa8, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xfe, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xe2, 0xab, 0xac, 0xb4, 0xbf, 0xc0, 0xbe, 0xc8, 0xb4, 0xbe, 0xe0, 0xd2, 0xbe, 0xb4, 0xb4, 0xb4, 0xb6, 0xb7, 0xb6, 0xb6, 0xbe, 0xc8, 0xc0, 0xc5, 0xc5, 0xd8, 0xd9, 0xb5, 0xbd, 0xb7, 0xae, 0xa9, 0xfe, 0xe2, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa7, 0xa8, 0xa5, 0xa6, 0xa5, 0xa6, 0xa8, 0xaa, 0xab, 0xac, 0xad, 0xb2, 0xbb, 0xbf, 0xc3, 0xc5, 0xc4, 0xc5, 0xc9, 0xc4, 0xcd, 0xb8, 0xd6, 0xe1, 0xd4, 0xa4, 0xa4, 0x00, 0x00, 0xa5, 0xa7, 0x00, 0xb3, 0xa5, 0x00, 0x3d, 0xae, 0x00, 0xa5, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xa4, 0xa7, 0xe7, 0xd9, 0x00, 0xa9, 0xbc, 0xc0, 0xbf, 0xb9, 0xb3, 0xb7, 0xb3, 0xb6, 0xae, 0xa6, 0xa6, 0xe2, 0xa8, 0xa6, 0xfe, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xa4, 0xa4, 0xa5, 0xa8, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xaf, 0xb3, 0xb1, 0xb8, 0xc2, 0xc0, 0xc4, 0xc3, 0xa9, 0xd8, 0xe0, 0xc7, 0xbe, 0xb4, 0xb6, 0xb4, 0xb7, 0xb8, 0xb8, 0xb7, 0xbd, 0xc5, 0xc8, 0x63, 0xc5, 0x84, 0x92, 0xb6, 0xb9, 0x57, 0xaf, 0xe3, 0xaa, 0xe3, 0xa8, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa7, 0xaa, 0xe3, 0xa9, 0xa8, 0xa9, 0xa9, 0xab, 0xab, 0xad, 0xad, 0xad, 0xa9, 0xb9, 0xc0, 0xc0, 0xc2, 0xc4, 0xc7, 0xca, 0xc8, 0xcd, 0xcd, 0x00, 0xd8, 0xdc, 0x00, 0xa6, 0x00, 0xa5, 0x00, 0x00, 0xa5, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xe3, 0x00, 0xba, 0xe1, 0xd9, 0xae, 0xa5, 0xb6, 0xc6, 0xad, 0xbc, 0xb4, 0xb6, 0xb7, 0xb1, 0xa9, 0x29, 0xa6, 0xa9, 0xa9, 0x29, 0xaa, 0xa9, 0x29, 0x00, 0x29, 0x00, 0x00, 0x2c, 0xa6, 0xa5, 0xa6, 0xa7, 0xa6, 0xa7, 0xa9, 0xe3, 0xa6, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0x00, 0xad, 0x3d, 0xaf, 0xb4, 0xbe, 0xc4, 0xc4, 0xc7, 0xb8, 0xc7, 0xfd, 0xd6, 0xcf, 0xbf, 0xb2, 0xb8, 0xb8, 0xb7, 0xb7, 0xb8, 0xbc, 0xc2, 0xc8, 0xc8, 0xc8, 0xc8, 0xd4, 0xe6, 0xbb, 0xba, 0xbe, 0xbc, 0xaf, 0xa8, 0xab, 0xaa, 0xab, 0xaa, 0x29, 0xa4, 0x29, 0xa6, 0xa8, 0xaa, 0xab, 0xaa, 0xaa, 0xa9, 0xa9, 0xaa, 0xab, 0xac, 0xac, 0xad, 0xb0, 0xad, 0xb1, 0xbf, 0x5c, 0xc5, 0x63, 0xc4, 0x69, 0xca, 0xd0, 0xca, 0xb4, 0xb2, 0xe0, 0xc3, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0x00, 0xa4, 0x00, 0x00, 0xb5, 0xdb, 0xe8, 0x84, 0xe9, 0xb7, 0xb7, 0xbf, 0xb7, 0xb4, 0xb1, 0xb2, 0xb0, 0xa9, 0x29, 0x29, 0xa6, 0xa8, 0xa6, 0xa8, 0x2b, 0x2c, 0x31, 0x2c, 0xa4, 0x2c, 0xa7, 0xa6, 0xa7, 0xa6, 0x2b, 0xa6, 0xe2, 0xaa, 0xa8, 0xa5, 0xa4, 0xa6, 0xa5, 0xa6, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xab, 0xb4, 0xb9, 0xbd, 0xbf, 0xc0, 0xc0, 0xc5, 0xbd, 0xd2, 0xe8, 0xd8, 0xd0, 0xbb, 0xbd, 0xb8, 0xb7, 0xb8, 0xb9, 0xbd, 0xc2, 0xc7, 0xca, 0xc3, 0xce, 0xcf, 0x63, 0xa1, 0xd6, 0xb3, 0xb9, 0xbc, 0xb7, 0xb3, 0xaf, 0xa9, 0xa8, 0xa9, 0xaa, 0xaa, 0xab, 0xaa, 0xac, 0xab, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xb2, 0xbf, 0xc4, 0xc6, 0xca, 0x5e, 0xca, 0x62, 0xcd, 0xce, 0xbf, 0x29, 0xd9, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xe2, 0xe3, 0x00, 0xae, 0xc6, 0xd9, 0xe8, 0xab, 0xb8, 0x5c, 0xc4, 0xb4, 0xb7, 0xb9, 0xb8, 0xb2, 0xa9, 0xa6, 0xa6, 0xa8, 0xa8, 0x2c, 0xa6, 0x2c, 0xab, 0x31, 0x2b, 0xa9, 0x2b, 0xa8, 0xa8, 0xa5, 0xa6, 0xa7, 0xa9, 0xe3, 0xa8, 0xa8, 0xa8, 0xa9, 0xe2, 0xa8, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xa5, 0xa4, 0xa4, 0xa4, 0xad, 0xad, 0xb4, 0xbc, 0xbe, 0xbd, 0xbf, 0xc5, 0xc0, 0xcf, 0xb1, 0xce, 0xe8, 0xd5, 0xd5, 0xc2, 0xbf, 0xbf, 0xbf, 0xc0, 0xc5, 0xc7, 0xc8, 0xc8, 0xcb, 0xcc, 0xcb, 0xce, 0xd6, 0xe7, 0xce, 0xbc, 0xba, 0xbc, 0xb8, 0xb1, 0xad, 0xaa, 0xa9, 0xab, 0xaa, 0xaa, 0xac, 0xac, 0xaa, 0xaa, 0xaa, 0xac, 0xaa, 0xab, 0xaa, 0xab, 0xac, 0xad, 0xad, 0xad, 0xa9, 0xb4, 0xc0, 0xc4, 0xc5, 0x63, 0xc7, 0xca, 0xc8, 0xca, 0xce, 0xca, 0x00, 0xc8, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xc6, 0x92, 0xab, 0xc0, 0xbe, 0x5c, 0xc3, 0xc2, 0xbf, 0xbc, 0xb7, 0xb4, 0xb2, 0xaf, 0xac, 0xb0, 0xad, 0xa8, 0xa4, 0xa8, 0x31, 0x2c, 0xe3, 0x29, 0xa8, 0xa8, 0xa8, 0xa6, 0xa9, 0xe2, 0xa9, 0xa8, 0xe2, 0xaa, 0xfe, 0xab, 0xaa, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa8, 0xad, 0xaf, 0xb5, 0xbc, 0xbc, 0xbb, 0xbf, 0xcb, 0xcd, 0xc1, 0xca, 0x00, 0xd9, 0xa1, 0xcd, 0xcf, 0xc8, 0xc7, 0xc7, 0xc8, 0xc8, 0xca, 0xc7, 0xc7, 0xd0, 0xc5, 0x6e, 0xcb, 0xf1, 0xdb, 0xdf, 0xbb, 0xbd, 0xbe, 0xb8, 0xb2, 0xb5, 0xb4, 0xaf, 0xac, 0xaa, 0xad, 0xaf, 0xad, 0xac, 0xaa, 0xaa, 0xaa, 0xa9, 0xaa, 0xad, 0xac, 0xac, 0xad, 0xad, 0xad, 0xac, 0xb8, 0xc2, 0xc4, 0xc6, 0xcb, 0xcb, 0xca, 0xc9, 0xca, 0xcb, 0xcb, 0xa6, 0xe4, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xae, 0xf5, 0x5c, 0xde, 0x00, 0xb9, 0xc6, 0xc4, 0xc2, 0xc4, 0xc0, 0xbc, 0xb7, 0xb8, 0xb8, 0xb8, 0xb6, 0xb6, 0xb5, 0xaa, 0xa5, 0x2c, 0xa8, 0x2b, 0xa9, 0xa4, 0xa8, 0xa9, 0xa8, 0xa8, 0xe2, 0xa9, 0xa8, 0xa8, 0xaa, 0xa8, 0xa9, 0xa9, 0xab, 0xa9, 0xa5, 0xa4, 0xa4, 0x00, 0x00, 0xa4, 0xa6, 0xfe, 0xad, 0xa8, 0xb1, 0xb9, 0xbd, 0xbc, 0xbc, 0xbf, 0xc5, 0xca, 0xc7, 0xce, 0xb9, 0xb9, 0xe1, 0xd6, 0xcb, 0xc4, 0xc7, 0xc8, 0xc8, 0xc8, 0xc8, 0xca, 0xcb, 0xc8, 0xd0, 0xce, 0xcc, 0xce, 0xea, 0xd9, 0xb6, 0x5c, 0xc3, 0xba, 0xb4, 0xb8, 0xb8, 0xb4, 0xb4, 0xb3, 0xb5, 0xb6, 0xb5, 0xb1, 0xac, 0xab, 0xaa, 0xa8, 0xaf, 0xb1, 0xaf, 0xac, 0xab, 0xaa, 0xac, 0xb6, 0xbe, 0xc4, 0xc4, 0xc5, 0xc7, 0xcd, 0xc9, 0xcd, 0xc9, 0xcf, 0xc0, 0xf5, 0x5c, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xa5, 0xae, 0x00, 0x00, 0x00, 0x3d, 0xe0, 0x3d, 0xb3, 0xc4, 0x57, 0xc5, 0xc0, 0xc0, 0xbf, 0xb9, 0xb7, 0xb7, 0xb7, 0xb9, 0xb7, 0xb7, 0xb0, 0xa9, 0xa9, 0xa8, 0x29, 0xa5, 0xa9, 0xad, 0xab, 0xaa, 0xa8, 0xaa, 0xaa, 0xa8, 0xa9, 0xe2, 0xa9, 0xa8, 0xaa, 0xae, 0xad, 0xab, 0xe2, 0xfe, 0xe2, 0xfe, 0xe3, 0xab, 0xae, 0xac, 0xb1, 0xb7, 0xbd, 0xbb, 0xbb, 0xbd, 0xc3, 0xc7, 0xc8, 0xc5, 0xc8, 0xbe, 0xb4, 0xe0, 0xda, 0xd0, 0xc7, 0xc8, 0xca, 0xc9, 0xc8, 0xc8, 0xcb, 0xcd, 0xc8, 0xd3, 0xcb, 0xd2, 0xce, 0xe0, 0xbf, 0xb9, 0xc7, 0xc5, 0xbe, 0xb7, 0xb4, 0xb4, 0xb6, 0xb8, 0xb6, 0xb7, 0xb8, 0xb8, 0xb6, 0xb3, 0xb1, 0xb0, 0xaf, 0xb4, 0xb7, 0xb6, 0xb4, 0xb5, 0xb7, 0xb7, 0xbe, 0xc5, 0xc4, 0xc7, 0xc5, 0xc7, 0xc9, 0xc9, 0xcb, 0xc7, 0xd1, 0xbb, 0x00, 0x78, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xa5, 0xf5, 0x00, 0x00, 0x00, 0xa7, 0x00, 0xae, 0xe6, 0xbf, 0x00, 0xc5, 0xf1, 0xbe, 0xc2, 0xc5, 0xc3, 0xbf, 0xb9, 0xb7, 0xb6, 0xb7, 0xb8, 0xba, 0xb6, 0xb1, 0xaf, 0xad, 0xac, 0xac, 0xb1, 0xb3, 0xb1, 0xaa, 0xa8, 0xaa, 0xaa, 0xa9, 0xa9, 0xab, 0xaa, 0xa9, 0xab, 0xb2, 0xb3, 0xb1, 0xe3, 0xe3, 0xaa, 0xe3, 0xab, 0xab, 0xad, 0xae, 0xb9, 0xbb, 0xbb, 0xbb, 0xbb, 0xc0, 0xc8, 0xcc, 0xc8, 0xcc, 0xd2, 0xb8, 0xb6, 0xdd, 0xd7, 0xd3, 0xcb, 0xcd, 0xcb, 0xcd, 0xcb, 0xcd, 0xcb, 0xcd, 0xd1, 0xcb, 0xd3, 0xcb, 0xd5, 0xe0, 0xb8, 0xbf, 0xc7, 0xc4, 0xc0, 0xbe, 0xb6, 0xb2, 0xb6, 0xb8, 0xb4, 0xb6, 0xb6, 0xb6, 0xb7, 0xb7, 0xb6, 0xb6, 0xb4, 0xb8, 0xb9, 0xb8, 0xbb, 0xbf, 0xc2, 0xc2, 0xc2, 0xc7, 0xc3, 0xc8, 0xc9, 0xc7, 0xcd, 0xc9, 0xcd, 0xcb, 0xc7, 0xb1, 0xfe, 0xde, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xff, 0xa4, 0x00, 0x00, 0x00, 0xf5, 0x7d, 0xdc, 0xa8, 0xa8, 0xbd, 0xcc, 0xc2, 0xc4, 0xc5, 0xc2, 0xbf, 0xbc, 0xb9, 0xb7, 0xbe, 0xc0, 0xbc, 0xb6, 0xb7, 0xb6, 0xb6, 0xb8, 0xb7, 0xb7, 0xb3, 0xaa, 0xa6, 0xa9, 0xab, 0xaa, 0xa9, 0xab, 0xab, 0xaa, 0xaf, 0xb5, 0xb6, 0xb4, 0xb5, 0xb3, 0x3d, 0xb0, 0x3d, 0xb4, 0x49, 0xb9, 0xb8, 0xb9, 0xb9, 0xbe, 0xc2, 0xc7, 0xc8, 0xca, 0xc8, 0xcb, 0xcd, 0xbe, 0xb6, 0xa1, 0xd8, 0xcd, 0xcb, 0xc8, 0xca, 0xcb, 0xcd, 0xce, 0xcd, 0xcd, 0xd0, 0xd0, 0xd2, 0xcb, 0xd7, 0xdf, 0xb0, 0xc4, 0xc8, 0xc3, 0xc4, 0xc5, 0xbe, 0xb9, 0xb8, 0xb6, 0xb8, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb8, 0xb7, 0xb8, 0xb7, 0xb7, 0xb6, 0xb9, 0xc0, 0xc3, 0xc2, 0xc2, 0xc4, 0xc0, 0xc8, 0xcb, 0xc9, 0xce, 0xcd, 0xc9, 0xd0, 0xb7, 0xa6, 0xc0, 0xe1, 0xb3, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0xa7, 0xe6, 0xea, 0xe2, 0x00, 0xbd, 0xc0, 0xcb, 0xc0, 0xc8, 0xc8, 0xca, 0xc5, 0x59, 0xc4, 0x57, 0xbf, 0xb7, 0xb4, 0xb9, 0xb4, 0xb7, 0xb7, 0xb1, 0xb9, 0xaf, 0xaa, 0xa8, 0xab, 0xa8, 0xaa, 0xaa, 0xab, 0xaf, 0xb3, 0xb6, 0xb6, 0xb5, 0xb7, 0x49, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xba, 0xbb, 0xb4, 0xbe, 0xc7, 0xc5, 0xcb, 0xcd, 0xc8, 0xc7, 0xcf, 0xca, 0xb8, 0xc7, 0xe0, 0xd7, 0xcd, 0xcd, 0xcb, 0xcb, 0xcb, 0xcd, 0xce, 0xcf, 0xcf, 0xce, 0xd3, 0xce, 0xd1, 0xd4, 0xe0, 0xc0, 0xbd, 0xcc, 0xc4, 0xc0, 0xcb, 0xc4, 0xc3, 0xcd, 0xbe, 0xbf, 0xb9, 0xb6, 0xb6, 0xb6, 0xb6, 0xb7, 0xb7, 0xb6, 0xb4, 0xb4, 0xb8, 0xbe, 0xc2, 0xc4, 0xc3, 0xc5, 0xc2, 0xc9, 0xc7, 0xce, 0xcb, 0xce, 0xcf, 0xcf, 0xb7, 0x2d, 0xb8, 0xe8, 0xe5, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xa4, 0xae, 0xe6, 0xdc, 0xd8, 0xe5, 0xbc, 0xc9, 0xc9, 0xbf, 0xcd, 0xca, 0x57, 0xcd, 0xc6, 0xc4, 0xc3, 0xbc, 0xb2, 0xb4, 0xb9, 0xb4, 0xb7, 0xb7, 0xb5, 0xb6, 0xad, 0xab, 0xac, 0xaa, 0xaa, 0xaf, 0xb4, 0xb4, 0xb4, 0xb3, 0xb6, 0xb7, 0xb8, 0xb7, 0xb7, 0xb7, 0xb8, 0xb8, 0xb8, 0xb7, 0xbd, 0xb8, 0xc0, 0xc7, 0xc3, 0xc7, 0xc8, 0xc8, 0xcb, 0xcc, 0xc9, 0xaf, 0xd8, 0xdf, 0xd0, 0xce, 0xcd, 0xcd, 0xce, 0xce, 0xce, 0xcf, 0xcf, 0xd0, 0xd1, 0xd1, 0xd2, 0xd0, 0xcf, 0xdf, 0xd7, 0xac, 0xc3, 0xca, 0xc4, 0xc8, 0xce, 0xc2, 0xc0, 0xca, 0xbf, 0xbd, 0xbb, 0xb9, 0xb8, 0xb7, 0xb7, 0xb8, 0xbb, 0xb9, 0xb9, 0xbb, 0xbf, 0xc2, 0xc3, 0xc3, 0xbf, 0xc9, 0xc8, 0xcd, 0xca, 0x5e, 0xc5, 0x51, 0x45, 0x32, 0xd4, 0x28, 0xdb, 0xd7, 0xff, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xe2, 0x00, 0x3d, 0xe5, 0xdc, 0xe7, 0xbe, 0xbf, 0xcc, 0xd0, 0x6e, 0x63, 0xd0, 0x4c, 0x4c, 0x5e, 0xc4, 0xc5, 0xc0, 0xb9, 0xbe, 0xb8, 0xbe, 0xbf, 0xb1, 0xb9, 0xb4, 0xb4, 0xb6, 0xb3, 0xb3, 0xb6, 0xb7, 0xb7, 0xb4, 0xb4, 0xb5, 0xb7, 0xb9, 0xb8, 0xb7, 0xb8, 0xba, 0xbb, 0xb9, 0xb9, 0xb9, 0xb7, 0xbf, 0xc7, 0xc8, 0xcd, 0xcd, 0xce, 0xc8, 0xce, 0xb9, 0xc0, 0xe1, 0xd9, 0xcb, 0xce, 0xce, 0xcf, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd2, 0xd0, 0xd3, 0xd2, 0xce, 0xea, 0xdf, 0xc3, 0xbe, 0xcb, 0xca, 0xbf, 0xc8, 0xcd, 0xc3, 0xc7, 0xc0, 0xc0, 0xbf, 0xbf, 0xbd, 0xbc, 0xbb, 0xbd, 0xc2, 0xc2, 0xc0, 0xc2, 0xc4, 0xc5, 0xc7, 0xc7, 0xce, 0xcd, 0xc7, 0x6e, 0x82, 0x76, 0x79, 0x73, 0x85, 0xa3, 0x98, 0x82, 0x4a, 0x9f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xdb, 0xdd, 0xb7, 0xc0, 0xc4, 0x59, 0x62, 0x69, 0x59, 0xb2, 0xca, 0x5e, 0xbf, 0xc8, 0xc9, 0xc3, 0xc4, 0xc7, 0xc3, 0xb8, 0xb7, 0xb4, 0xb8, 0xb8, 0xb7, 0xb8, 0xb7, 0xb4, 0xb4, 0xb6, 0xb7, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xb9, 0xbb, 0xbb, 0xbb, 0xbc, 0xb9, 0xc0, 0xc8, 0xce, 0xcd, 0xc4, 0xc7, 0xc8, 0xb4, 0xb9, 0xdd, 0xdc, 0xcb, 0xd2, 0xd4, 0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0xd2, 0xd1, 0xd1, 0xd1, 0xd0, 0xd4, 0xd3, 0xd3, 0xdd, 0xdd, 0xb4, 0xbb, 0xd0, 0xcd, 0xc5, 0xcd, 0xcb, 0xc8, 0xc4, 0xc2, 0xc2, 0xc0, 0xc0, 0xbf, 0xc0, 0xc2, 0xc8, 0xc7, 0xca, 0xc7, 0xc8, 0xc8, 0xca, 0xcb, 0xcd, 0xc3, 0xca, 0x5c, 0xa2, 0x93, 0x9d, 0xa0, 0x96, 0x89, 0x81, 0x85, 0x38, 0x72, 0x9e, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0xab, 0xdc, 0x92, 0xe5, 0x59, 0xc6, 0x5e, 0x84, 0x94, 0x29, 0x56, 0xd1, 0xca, 0xc2, 0xc7, 0xc7, 0xce, 0xc3, 0xbe, 0xc7, 0xb8, 0xb5, 0xb7, 0xb2, 0xb6, 0xb5, 0xb4, 0xb4, 0xb5, 0xb7, 0xb9, 0xb9, 0xb9, 0xb7, 0xb8, 0xb9, 0xb9, 0xb8, 0xb8, 0xb9, 0xbb, 0xbb, 0xbd, 0xc4, 0xc8, 0xce, 0xc7, 0xc4, 0xd1, 0xbb, 0xd6, 0xe1, 0xdd, 0xcb, 0xd4, 0xd0, 0xce, 0xd0, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd3, 0xd0, 0xd5, 0xd3, 0xce, 0xd6, 0xdf, 0xdd, 0xbf, 0xb6, 0xbe, 0xc3, 0xbf, 0xbe, 0xcd, 0xc7, 0xc5, 0xc2, 0xc0, 0xc0, 0xc4, 0xc5, 0xc7, 0xc7, 0xc8, 0xc8, 0xc8, 0xc8, 0xca, 0xc9, 0xcb, 0xc9, 0xcf, 0xca, 0x56, 0x97, 0x7e, 0x7a, 0x13, 0x71, 0x86, 0x7a, 0x75, 0x64, 0x2e, 0x92, 0x57, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa7, 0x00, 0x00, 0x00, 0xe3, 0x00, 0xaf, 0x84, 0xdf, 0x9f, 0xe0, 0xa3, 0x8d, 0x9f, 0x69, 0x2e, 0x4f, 0xcd, 0xc7, 0xc7, 0xc7, 0xc9, 0xbe, 0xb4, 0xce, 0xc1, 0xbc, 0xba, 0xb6, 0xba, 0xb7, 0xb9, 0xbc, 0xbd, 0xba, 0xb7, 0xb7, 0xb7, 0xbb, 0xbd, 0xbe, 0xbe, 0xbb, 0xb9, 0xbb, 0xbd, 0xbc, 0xc0, 0xc8, 0xcd, 0xcd, 0xc4, 0xce, 0xdc, 0xdf, 0xdd, 0xd8, 0xcb, 0xd1, 0xd6, 0xd0, 0xd3, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd3, 0xd3, 0xd2, 0xd4, 0xd1, 0xd5, 0xd3, 0xd4, 0xdd, 0xdf, 0xea, 0xc8, 0xc2, 0xd0, 0xce, 0xc0, 0xcd, 0xcb, 0xc7, 0xc5, 0xc5, 0xc8, 0xcb, 0xca, 0xc8, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcd, 0xcd, 0xcb, 0xd0, 0xb8, 0x7f, 0xa0, 0x7e, 0x17, 0x7a, 0x17, 0x71, 0x6b, 0x6a, 0x75, 0x2d, 0x82, 0xea, 0xa4, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xa4, 0x00, 0x29, 0x2c, 0xdd, 0x8d, 0x7c, 0x7c, 0x82, 0xa2, 0x5e, 0x30, 0xb8, 0xc4, 0xcb, 0xc9, 0xc5, 0xcf, 0xb4, 0xc0, 0xca, 0xc3, 0xc3, 0xbf, 0xc2, 0x57, 0xc2, 0xc6, 0xc4, 0xbf, 0xbd, 0xbc, 0xbb, 0xc2, 0xc4, 0xc5, 0xc3, 0xc2, 0xc0, 0xc2, 0xc4, 0xc8, 0xce, 0xcf, 0xcf, 0xcd, 0xbf, 0xcb, 0xa1, 0xd6, 0xd0, 0xd3, 0xd6, 0xd1, 0xcd, 0x84, 0xce, 0xd3, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd4, 0xd3, 0xd3, 0xd3, 0xd6, 0xd4, 0xcf, 0xd4, 0xea, 0xdd, 0xe0, 0xe0, 0xdf, 0xd7, 0xbd, 0xcb, 0xcd, 0xcd, 0xcb, 0xcb, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xce, 0xcd, 0xcd, 0xcd, 0xbf, 0xbe, 0x93, 0x8c, 0x77, 0x12, 0x12, 0x0f, 0x6b, 0x12, 0x75, 0x6f, 0x45, 0x56, 0x92, 0x2b, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xff, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xa5, 0x00, 0xb0, 0x9e, 0x62, 0xbd, 0x5f, 0x70, 0x85, 0xa2, 0x8a, 0x59, 0x4a, 0xb7, 0x56, 0xc9, 0x92, 0xbc, 0x3d, 0xc8, 0xc6, 0xc8, 0xc6, 0xc4, 0xc8, 0xc5, 0xc5, 0xc5, 0xc8, 0xc8, 0xc7, 0xc5, 0xc7, 0xc7, 0xc8, 0xc8, 0xc9, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xcd, 0xcf, 0xc2, 0xcd, 0xa1, 0xd1, 0xd5, 0xd4, 0xd1, 0xd5, 0xd4, 0xcf, 0xd4, 0xd3, 0xd3, 0xd2, 0xd2, 0xd2, 0xd2, 0xd3, 0xd3, 0xd2, 0xd6, 0xd0, 0xd3, 0xd5, 0xd0, 0xd2, 0xd6, 0xd5, 0xd2, 0xd5, 0xd6, 0xd6, 0x92, 0x9a, 0xc2, 0xc4, 0xca, 0xce, 0xce, 0xcc, 0xcd, 0xcd, 0xcd, 0xce, 0xcd, 0xcd, 0xcd, 0xce, 0xce, 0xcc, 0xcd, 0xbe, 0x4c, 0x91, 0x9d, 0x71, 0x13, 0x0f, 0x0f, 0x6b, 0x0f, 0x6b, 0x6b, 0x73, 0x5a, 0x3a, 0x9e, 0xa8, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xcc, 0x92, 0x29, 0x3f, 0x4f, 0x56, 0x64, 0x7b, 0x93, 0x9d, 0x9d, 0x99, 0x9c, 0xa2, 0x9d, 0x94, 0x31, 0x4c, 0xca, 0xca, 0xc0, 0xc7, 0xc9, 0xc0, 0xc5, 0xcb, 0xc3, 0xc8, 0xc5, 0xc5, 0xc5, 0xc7, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xcb, 0xc9, 0xd0, 0xc9, 0xcc, 0xc9, 0xb9, 0xdb, 0xe9, 0xcd, 0xd4, 0xd6, 0xd4, 0xd1, 0xd4, 0xd5, 0xd4, 0xd4, 0xd0, 0xd0, 0xd6, 0xd0, 0xd4, 0xd6, 0xd1, 0xd4, 0xd4, 0xd2, 0xd4, 0xd4, 0xd6, 0x88, 0xd3, 0x69, 0xd2, 0x70, 0x6e, 0x5e, 0x79, 0x9a, 0x9b, 0x4f, 0x57, 0xcc, 0xca, 0x6e, 0xce, 0x6e, 0xcf, 0x59, 0x62, 0x62, 0x70, 0x5e, 0xca, 0x59, 0xb6, 0x64, 0x98, 0x9c, 0x7a, 0x71, 0x71, 0x6b, 0x0d, 0x6b, 0x67, 0x6b, 0x75, 0x6a, 0x5f, 0x45, 0x9a, 0xae, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xd4, 0x7d, 0x29, 0x2e, 0x4a, 0x45, 0x53, 0x5a, 0x66, 0x75, 0x83, 0x89, 0x81, 0x7a, 0x7f, 0x9d, 0x8a, 0x2b, 0x44, 0xca, 0x6e, 0xcd, 0xc5, 0xcf, 0xc9, 0xcd, 0xc9, 0xc4, 0xd1, 0xc7, 0xcb, 0xc9, 0xc7, 0xc9, 0xf2, 0xcd, 0xf2, 0xc7, 0xcb, 0xd2, 0xcb, 0xce, 0xb9, 0xe5, 0xe8, 0xe6, 0xcf, 0xcb, 0xca, 0xd0, 0xd4, 0xd1, 0xce, 0xc9, 0xca, 0xd5, 0xd2, 0xd0, 0xd4, 0xd3, 0xd0, 0xd6, 0xd3, 0xd4, 0xd4, 0xd3, 0x62, 0x88, 0x28, 0x9d, 0x90, 0x82, 0x7c, 0x88, 0x93, 0x9d, 0x27, 0x98, 0x97, 0x74, 0x4c, 0xe4, 0x5c, 0xbc, 0x59, 0x8d, 0x9b, 0x7c, 0x5e, 0x5f, 0x51, 0x56, 0x70, 0x85, 0xa0, 0x96, 0x7a, 0x6c, 0x71, 0x68, 0x5b, 0x67, 0x6b, 0x6b, 0x67, 0x71, 0x6a, 0x5f, 0x44, 0x9e, 0xe3, 0xf5, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xda, 0x6e, 0x00, 0x34, 0x3f, 0x37, 0x47, 0x4d, 0x54, 0x64, 0x6f, 0x71, 0x75, 0x6f, 0x71, 0x79, 0xa0, 0x91, 0x3f, 0x2a, 0x51, 0xbf, 0xc8, 0xcf, 0xc2, 0xbb, 0xc0, 0x51, 0xce, 0x5e, 0xcd, 0xcc, 0xcb, 0xc8, 0xc5, 0xc8, 0xcd, 0xd1, 0xce, 0x5e, 0x62, 0x3a, 0x72, 0xe8, 0x84, 0xdb, 0xe1, 0xea, 0xd4, 0xce, 0xcb, 0xc8, 0xd0, 0xd6, 0xe6, 0xdf, 0xd5, 0xc0, 0xd3, 0xd6, 0xd2, 0xd2, 0xd2, 0xd3, 0xd1, 0x69, 0x82, 0xa2, 0x85, 0x8a, 0xa0, 0xa2, 0x9d, 0xa0, 0x98, 0x8c, 0x89, 0x87, 0x9c, 0x9d, 0x9b, 0x88, 0x90, 0x92, 0x9b, 0x8b, 0x8d, 0x98, 0x9d, 0x9d, 0x9d, 0xa3, 0xa2, 0xa2, 0x7e, 0x7a, 0x68, 0x64, 0x61, 0x52, 0x52, 0x5b, 0x65, 0x6b, 0x65, 0x6c, 0x6f, 0x56, 0x51, 0x9a, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xdb, 0xcc, 0x29, 0x3f, 0x3a, 0x33, 0x2a, 0x33, 0x42, 0x4b, 0x50, 0x58, 0x5d, 0x66, 0x5d, 0x75, 0x7a, 0x93, 0xa2, 0x70, 0x3f, 0x3f, 0xb2, 0x34, 0xb9, 0xd3, 0x88, 0xd3, 0x5e, 0x69, 0x70, 0xcb, 0xca, 0x6e, 0xd3, 0x74, 0x62, 0x51, 0x5a, 0x51, 0x64, 0x94, 0xa2, 0x76, 0x7d, 0x00, 0xc4, 0xdb, 0xe8, 0xe0, 0xdd, 0xa1, 0xa1, 0xdd, 0xcf, 0xda, 0xe0, 0xd8, 0xcc, 0xc3, 0x6e, 0xce, 0xce, 0x69, 0x6d, 0x98, 0x9d, 0x8e, 0x7a, 0x87, 0x75, 0x83, 0x83, 0x83, 0x81, 0x7e, 0x7a, 0x7a, 0x75, 0x7b, 0x91, 0x88, 0x9e, 0x7c, 0x9a, 0x82, 0x72, 0x79, 0x89, 0x89, 0x87, 0x81, 0x73, 0x6a, 0x6f, 0x66, 0x61, 0x52, 0x50, 0x52, 0x55, 0x52, 0x5b, 0x6b, 0x65, 0x6c, 0x6f, 0x4a, 0x72, 0xda, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xcc, 0x00, 0x44, 0x37, 0x30, 0x2d, 0x30, 0x36, 0x42, 0x4d, 0x54, 0x5a, 0x06, 0x65, 0x08, 0x7a, 0x7a, 0x87, 0x99, 0xa2, 0x9f, 0x90, 0xdf, 0x90, 0x82, 0x7f, 0x94, 0x79, 0x62, 0x5e, 0x5e, 0x69, 0x7c, 0x8d, 0x97, 0x93, 0x91, 0x8f, 0x8e, 0x27, 0x99, 0x72, 0x56, 0xa1, 0x00, 0xa6, 0x00, 0xe2, 0xc0, 0x6e, 0xc3, 0xb5, 0xe2, 0xa8, 0x00, 0xd0, 0xdd, 0xe1, 0xdd, 0xea, 0xd8, 0x8b, 0x98, 0xa3, 0x96, 0x80, 0x89, 0x71, 0x71, 0x7a, 0x80, 0x7a, 0x7a, 0x77, 0x80, 0x77, 0x77, 0x7a, 0x75, 0x58, 0x79, 0x85, 0x29, 0x62, 0xa1, 0x6d, 0x62, 0x66, 0x64, 0x66, 0x6c, 0x66, 0x6a, 0x66, 0x54, 0x4b, 0x50, 0x4e, 0x50, 0x52, 0x52, 0x55, 0x68, 0x67, 0x6a, 0x6f, 0x3f, 0x8d, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xda, 0x74, 0x2e, 0x38, 0x3a, 0x30, 0x2d, 0x2f, 0x32, 0x39, 0x41, 0x4e, 0x4e, 0x50, 0x65, 0x5b, 0x65, 0x7a, 0x6f, 0x7b, 0x85, 0x70, 0x9f, 0x97, 0x51, 0xb8, 0x43, 0x72, 0x90, 0x9b, 0x97, 0x97, 0x97, 0x8a, 0x79, 0x75, 0x81, 0x89, 0x23, 0x8f, 0x80, 0x75, 0x73, 0x4c, 0x8d, 0xe3, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0xdb, 0xa3, 0x8a, 0x8f, 0x7e, 0x7e, 0x80, 0x0d, 0x13, 0x13, 0x6b, 0x6b, 0x71, 0x12, 0x71, 0x12, 0x12, 0x80, 0x13, 0x7e, 0x4d, 0x91, 0x4c, 0xa4, 0x31, 0x88, 0x7c, 0x5a, 0x5f, 0x5a, 0x58, 0x5b, 0x50, 0x46, 0x46, 0x40, 0x4b, 0x54, 0x50, 0x4b, 0x4e, 0x55, 0x4e, 0x67, 0x68, 0x6c, 0x64, 0x4a, 0x9a, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x7d, 0xd8, 0x31, 0x34, 0x3f, 0x35, 0x33, 0x36, 0x3b, 0x40, 0x42, 0x48, 0x4b, 0x52, 0x55, 0x08, 0x67, 0x67, 0x7e, 0x6a, 0x6f, 0x56, 0x9b, 0x7f, 0x2e, 0x30, 0x29, 0x4a, 0x62, 0x69, 0x73, 0xd4, 0x73, 0x6d, 0x6a, 0x64, 0x0b, 0x71, 0x67, 0x13, 0x0b, 0x6f, 0x6a, 0x51, 0x9a, 0x2b, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa5, 0xa4, 0xf5, 0xa7, 0xff, 0x00, 0xa4, 0xdb, 0x7b, 0x4b, 0x75, 0x71, 0x08, 0x6b, 0x13, 0x67, 0x77, 0x67, 0x0d, 0x71, 0x0f, 0x77, 0x12, 0x12, 0x77, 0x6c, 0x64, 0x96, 0xa4, 0x2c, 0x00, 0x57, 0x9b, 0x4f, 0x40, 0x4d, 0x4e, 0x41, 0x41, 0x52, 0x4e, 0x50, 0x4d, 0x48, 0x4b, 0x54, 0x52, 0x4b, 0x52, 0x65, 0x68, 0x6a, 0x5a, 0x5e, 0x8d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xf1, 0xde, 0x29, 0x38, 0x3a, 0x39, 0x3c, 0x3b, 0x3b, 0x41, 0x46, 0x4b, 0x50, 0x50, 0x55, 0x60, 0x67, 0x6b, 0x68, 0x7e, 0x4c, 0x72, 0x28, 0x69, 0x00, 0x2c, 0x2e, 0x34, 0x33, 0x45, 0x4c, 0x51, 0x51, 0x4d, 0x47, 0x4b, 0x58, 0x08, 0x0b, 0x60, 0x68, 0x6c, 0x64, 0x43, 0xdf, 0x2b, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x72, 0x8a, 0x4e, 0x6c, 0x6b, 0x0d, 0x0d, 0x0d, 0x0d, 0x6b, 0x67, 0x77, 0x6b, 0x65, 0x77, 0x17, 0x12, 0x7a, 0x5b, 0x7b, 0x76, 0xa4, 0x2c, 0x00, 0x2b, 0x9a, 0x4f, 0x47, 0x42, 0x46, 0x4e, 0x4e, 0x41, 0x41, 0x48, 0x4b, 0x4b, 0x4d, 0x4b, 0x4b, 0x50, 0x52, 0x65, 0x66, 0x68, 0x56, 0x72, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xa1, 0x49, 0x30, 0x45, 0x43, 0x3c, 0x40, 0x42, 0x42, 0x4b, 0x48, 0x4e, 0x50, 0x55, 0x60, 0x65, 0x71, 0x71, 0x6a, 0x4d, 0x9a, 0xa3, 0x5c, 0x00, 0x3a, 0x31, 0x30, 0x2b, 0x29, 0x2a, 0x2a, 0x32, 0x36, 0x3c, 0x41, 0x01, 0x4e, 0x55, 0x0d, 0x65, 0x6c, 0x64, 0x4c, 0xdd, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x63, 0x97, 0x4e, 0x6f, 0x0b, 0x67, 0x6b, 0x6b, 0x0d, 0x6b, 0x6b, 0x0d, 0x6b, 0x0d, 0x77, 0x12, 0x13, 0x13, 0x53, 0x98, 0x45, 0x00, 0xff, 0xf5, 0x00, 0x84, 0x74, 0x38, 0x40, 0x48, 0x46, 0x3b, 0x46, 0x48, 0x47, 0x48, 0x48, 0x4b, 0x4b, 0x4e, 0x4e, 0x4e, 0x61, 0x66, 0x6f, 0x4d, 0x82, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xdb, 0x69, 0x2c, 0x51, 0x4a, 0x3c, 0x3b, 0x42, 0x42, 0x46, 0x4b, 0x50, 0x52, 0x55, 0x60, 0x67, 0x71, 0x6f, 0x5a, 0x70, 0x7f, 0x8b, 0xe5, 0x2b, 0xa4, 0x31, 0x31, 0x29, 0x29, 0x2a, 0x2d, 0x32, 0x35, 0x3c, 0x46, 0x46, 0x01, 0x55, 0x60, 0x68, 0x66, 0x5f, 0x51, 0xdc, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xf5, 0x00, 0x63, 0x91, 0x50, 0x6c, 0x0b, 0x0b, 0x6b, 0x0b, 0x6b, 0x6b, 0x6b, 0x6b, 0x67, 0x0d, 0x12, 0x0f, 0x77, 0x6a, 0x5a, 0x91, 0xae, 0x00, 0xf5, 0x00, 0x00, 0x78, 0x7c, 0x30, 0x43, 0x47, 0x46, 0x41, 0x46, 0x47, 0x42, 0x47, 0x48, 0x48, 0x4b, 0x4b, 0x4e, 0x4e, 0x65, 0x66, 0x6a, 0x4d, 0x88, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x74, 0xda, 0x29, 0x51, 0x51, 0x4d, 0x4d, 0x4b, 0x48, 0x4b, 0x4d, 0x50, 0x55, 0x55, 0x60, 0x6b, 0x6f, 0x6f, 0x4f, 0x90, 0x57, 0x74, 0x7d, 0x2b, 0x2b, 0x31, 0x2c, 0x00, 0x29, 0x2a, 0x2d, 0x32, 0x37, 0x3b, 0x42, 0x46, 0x4b, 0x4e, 0x5b, 0x68, 0x66, 0x56, 0x5e, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa7, 0x70, 0x8a, 0x53, 0x66, 0x65, 0x0b, 0x6b, 0x67, 0x67, 0x67, 0x6b, 0x68, 0x67, 0x71, 0x13, 0x0d, 0x77, 0x5a, 0x72, 0x85, 0x00, 0x00, 0xeb, 0x00, 0xf5, 0xf1, 0xda, 0x33, 0x3f, 0x40, 0x47, 0x3b, 0x42, 0x40, 0x42, 0x42, 0x47, 0x48, 0x48, 0x4b, 0x4b, 0x50, 0x66, 0x61, 0x6a, 0x4d, 0x8b, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0xba, 0x9a, 0x2a, 0x4c, 0x4a, 0x53, 0x53, 0x50, 0x4d, 0x4b, 0x4e, 0x50, 0x54, 0x5b, 0x60, 0x6c, 0x6c, 0x6a, 0x51, 0x9a, 0x31, 0xf1, 0xea, 0x00, 0xb3, 0x31, 0x00, 0x34, 0x2a, 0x2d, 0x2f, 0x32, 0x37, 0x3c, 0x42, 0x48, 0x4b, 0x4e, 0x55, 0x66, 0x6a, 0x4d, 0x74, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7f, 0x54, 0x66, 0x61, 0x65, 0x65, 0x0b, 0x65, 0x67, 0x68, 0x65, 0x67, 0x71, 0x0f, 0x71, 0x77, 0x4d, 0x8a, 0x6e, 0x00, 0xf5, 0xf5, 0x00, 0x00, 0x57, 0x92, 0x31, 0x3f, 0x3c, 0x3f, 0x3b, 0x3c, 0x40, 0x40, 0x43, 0x42, 0x47, 0x48, 0x48, 0x4b, 0x50, 0x68, 0x64, 0x64, 0x51, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x9a, 0x38, 0x3a, 0x47, 0x4a, 0x48, 0x48, 0x4b, 0x4b, 0x50, 0x50, 0x55, 0x55, 0x60, 0x6b, 0x6c, 0x64, 0x62, 0x90, 0x00, 0xba, 0xe6, 0x2b, 0xae, 0x34, 0x2a, 0x34, 0x2f, 0x32, 0x33, 0x35, 0x37, 0x3c, 0x42, 0x46, 0x4b, 0x4b, 0x5b, 0x61, 0x6a, 0x45, 0x85, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x94, 0x6d, 0x5a, 0x61, 0x61, 0x60, 0x65, 0x65, 0x60, 0x65, 0x67, 0x61, 0x68, 0x71, 0x71, 0x0d, 0x71, 0x4a, 0xdd, 0x49, 0x00, 0xf5, 0x00, 0xf5, 0xf5, 0xb5, 0x9a, 0x30, 0x3f, 0x35, 0x3c, 0x38, 0x37, 0x3c, 0x3c, 0x40, 0x43, 0x47, 0x48, 0x46, 0x4b, 0x50, 0x6a, 0x61, 0x5f, 0x5a, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x9a, 0x44, 0x35, 0x43, 0x3c, 0x40, 0x47, 0x48, 0x4b, 0x4d, 0x50, 0x54, 0x55, 0x60, 0x68, 0x6c, 0x5f, 0x72, 0x82, 0x00, 0xa7, 0x9e, 0xe4, 0x29, 0x3a, 0x34, 0x2f, 0x33, 0x35, 0x35, 0x36, 0x3c, 0x40, 0x42, 0x48, 0x4b, 0x50, 0x5b, 0x5f, 0x66, 0x4a, 0x8d, 0xe4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xfe, 0x9e, 0x5a, 0x58, 0x61, 0x5d, 0x61, 0x08, 0x65, 0x60, 0x65, 0x65, 0x61, 0x67, 0x6c, 0x71, 0x0f, 0x66, 0x56, 0xdd, 0x2b, 0xa5, 0x00, 0x00, 0xf5, 0x00, 0xb3, 0x97, 0x2e, 0x36, 0x35, 0x37, 0x37, 0x37, 0x3b, 0x3c, 0x3c, 0x42, 0x43, 0x47, 0x48, 0x46, 0x54, 0x64, 0x66, 0x56, 0x69, 0x88, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x3d, 0x9a, 0x34, 0x38, 0x3c, 0x3c, 0x40, 0x42, 0x48, 0x48, 0x4b, 0x4e, 0x50, 0x55, 0x08, 0x67, 0x71, 0x53, 0x7f, 0x76, 0xa4, 0x00, 0x7d, 0xd8, 0x2c, 0x3f, 0x37, 0x2f, 0x36, 0x36, 0x39, 0x3c, 0x3c, 0x40, 0x47, 0x48, 0x4b, 0x54, 0x5d, 0x61, 0x5a, 0x53, 0x90, 0x34, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x94, 0x4a, 0x5a, 0x5d, 0x61, 0x60, 0x5b, 0x60, 0x60, 0x61, 0x60, 0x61, 0x68, 0x6b, 0x0d, 0x71, 0x58, 0x6d, 0xda, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x45, 0x94, 0x33, 0x33, 0x33, 0x32, 0x35, 0x32, 0x36, 0x37, 0x3c, 0x3f, 0x42, 0x42, 0x42, 0x46, 0x54, 0x61, 0x6a, 0x53, 0x70, 0x7c, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x49, 0x9a, 0x2b, 0x3a, 0x35, 0x3c, 0x3c, 0x42, 0x42, 0x48, 0x4b, 0x4d, 0x50, 0x52, 0x05, 0x6c, 0x71, 0x4d, 0x82, 0x76, 0x00, 0xa4, 0xba, 0xa3, 0xb7, 0x38, 0x37, 0x3b, 0x36, 0x39, 0x39, 0x3c, 0x40, 0x40, 0x47, 0x48, 0x4b, 0x58, 0x5b, 0x6a, 0x58, 0x62, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0xa4, 0xa5, 0x00, 0x00, 0xd5, 0x8b, 0x40, 0x5d, 0x5d, 0x61, 0x5b, 0x5b, 0x60, 0x5d, 0x60, 0x5b, 0x5b, 0x6b, 0x65, 0x71, 0x12, 0x4d, 0x79, 0x7d, 0x29, 0x00, 0x00, 0xf5, 0x00, 0xa4, 0x4c, 0x94, 0x30, 0x33, 0x32, 0x2e, 0x2f, 0x2f, 0x35, 0x36, 0x3c, 0x3c, 0x40, 0x47, 0x42, 0x42, 0x58, 0x61, 0x6a, 0x4d, 0x73, 0x74, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x63, 0xdc, 0x00, 0x3a, 0x30, 0x37, 0x3c, 0x3c, 0x42, 0x42, 0x48, 0x4b, 0x4e, 0x4e, 0x5b, 0x6c, 0x6a, 0x53, 0x7c, 0x76, 0xa4, 0xa4, 0xa7, 0xdd, 0x5e, 0x5a, 0x51, 0x48, 0x39, 0x40, 0x47, 0x48, 0x4a, 0x4a, 0x48, 0x48, 0x4b, 0x54, 0x5b, 0x61, 0x53, 0x6d, 0x7f, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x34, 0xa4, 0x9a, 0x5e, 0x4e, 0x54, 0x5d, 0x5b, 0x58, 0x5b, 0x5d, 0x5b, 0x58, 0x67, 0x5b, 0x65, 0x6b, 0x68, 0x71, 0x42, 0x8b, 0x5c, 0xa7, 0xa4, 0xa4, 0x00, 0x00, 0xa4, 0x4c, 0x92, 0x2a, 0xac, 0x00, 0x2a, 0x00, 0x2a, 0x30, 0x35, 0x3c, 0x3c, 0x3c, 0x42, 0x46, 0x46, 0x54, 0x66, 0x6a, 0x4a, 0x7f, 0x6e, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x7d, 0x78, 0x29, 0x34, 0x34, 0x34, 0x37, 0x3c, 0x40, 0x42, 0x46, 0x4b, 0x4e, 0x4e, 0x08, 0x6c, 0x6c, 0x51, 0x7c, 0x78, 0xa4, 0x00, 0xa4, 0x8d, 0x59, 0x51, 0x5f, 0x5f, 0x61, 0x5a, 0x5a, 0x51, 0x4a, 0x47, 0x42, 0x48, 0x4e, 0x52, 0x5b, 0x68, 0x53, 0x6d, 0xd7, 0x00, 0xf5, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x62, 0x98, 0x3e, 0x50, 0x58, 0x5b, 0x58, 0x58, 0x06, 0x06, 0x5b, 0x5b, 0x60, 0x5b, 0x65, 0x6b, 0x68, 0x6c, 0x47, 0x94, 0xe4, 0x00, 0x00, 0xff, 0x00, 0xa4, 0x00, 0x57, 0x92, 0xa5, 0xa6, 0x29, 0xa4, 0x00, 0x2c, 0x2e, 0x35, 0x39, 0x3c, 0x3c, 0x42, 0x46, 0x46, 0x58, 0x65, 0x66, 0x4a, 0x7f, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa5, 0xe6, 0xbd, 0x00, 0x34, 0x34, 0x35, 0x37, 0x3c, 0x3c, 0x42, 0x47, 0x48, 0x4b, 0x4e, 0x5b, 0x68, 0x6a, 0x53, 0x76, 0x7f, 0xa4, 0xa7, 0x00, 0xda, 0x59, 0x34, 0x43, 0x40, 0x3c, 0x36, 0x35, 0x3c, 0x37, 0x3f, 0x47, 0x48, 0x4e, 0x50, 0x5b, 0x68, 0x53, 0x6a, 0x84, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x2e, 0x9f, 0x72, 0x30, 0x52, 0x58, 0x5b, 0x58, 0x58, 0x58, 0x5a, 0x55, 0x5b, 0x5b, 0x5b, 0x67, 0x68, 0x6c, 0x68, 0x47, 0x9a, 0xb1, 0x00, 0x00, 0xff, 0x00, 0xa7, 0x00, 0x6e, 0xd9, 0xa6, 0x29, 0x00, 0x29, 0x00, 0x29, 0x2d, 0x35, 0x38, 0x3c, 0x3c, 0x40, 0x42, 0x41, 0x5b, 0x61, 0x66, 0x4d, 0x85, 0x69, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x49, 0xa1, 0xad, 0x29, 0xaa, 0x32, 0x34, 0x35, 0x37, 0x3b, 0x40, 0x42, 0x48, 0x4b, 0x4e, 0x08, 0x67, 0x6a, 0x53, 0x72, 0x84, 0x00, 0xa4, 0x00, 0xd9, 0x63, 0x2a, 0x38, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0x37, 0x3f, 0x40, 0x47, 0x42, 0x4e, 0x5b, 0x68, 0x58, 0x5e, 0x8b, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x74, 0x97, 0x38, 0x3e, 0x58, 0x55, 0x58, 0x52, 0x58, 0x58, 0x58, 0x58, 0x5b, 0x55, 0x5b, 0x67, 0x68, 0x6c, 0x61, 0x51, 0x94, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x7d, 0xd4, 0xa4, 0xa6, 0x29, 0xa6, 0x00, 0x29, 0x2d, 0x33, 0x36, 0x3c, 0x3c, 0x40, 0x41, 0x46, 0x5d, 0x5d, 0x66, 0x4d, 0x88, 0x63, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xe9, 0xd7, 0xa4, 0x2a, 0x30, 0x34, 0x32, 0x35, 0x37, 0x3b, 0x3c, 0x42, 0x46, 0x4b, 0x4e, 0x60, 0x65, 0x6c, 0x53, 0x70, 0x88, 0x00, 0xf5, 0x00, 0xda, 0xc4, 0xa4, 0x34, 0x2d, 0x2d, 0x2d, 0x2a, 0x2c, 0x2d, 0x32, 0x3f, 0x40, 0x46, 0x50, 0x5d, 0x5d, 0x5d, 0x53, 0x94, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0xb0, 0xa3, 0x56, 0x38, 0x48, 0x54, 0x54, 0x52, 0x54, 0x52, 0x58, 0x58, 0x55, 0x5b, 0x52, 0x60, 0x67, 0x67, 0x6c, 0x58, 0x5a, 0xdb, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xa7, 0x00, 0xdc, 0xc6, 0x29, 0xa9, 0x29, 0x29, 0x00, 0x29, 0x2f, 0x33, 0x35, 0x3c, 0x3c, 0x3b, 0x42, 0x41, 0x61, 0x5d, 0x66, 0x4d, 0x8a, 0x63, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xe8, 0xb5, 0x29, 0x31, 0x30, 0x34, 0x32, 0x33, 0x37, 0x39, 0x3c, 0x42, 0x47, 0x4b, 0x02, 0x60, 0x65, 0x6c, 0x53, 0x69, 0x8b, 0x00, 0xa4, 0xf5, 0xea, 0x57, 0x00, 0x2a, 0xa4, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2a, 0x32, 0x3f, 0x48, 0x4e, 0x5d, 0x5b, 0x64, 0x47, 0x94, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xe5, 0x94, 0x2e, 0x43, 0x4d, 0x54, 0x52, 0x52, 0x52, 0x52, 0x54, 0x55, 0x58, 0x55, 0x55, 0x60, 0x68, 0x65, 0x6f, 0x4e, 0x72, 0x8b, 0x00, 0xa4, 0x00, 0x00, 0xf5, 0x00, 0xf5, 0x9e, 0xb9, 0x00, 0x2a, 0x29, 0x29, 0x29, 0x29, 0x30, 0x32, 0x35, 0x3c, 0x3c, 0x40, 0x41, 0x46, 0x61, 0x5d, 0x66, 0x48, 0x8a, 0x5e, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xd2, 0xdb, 0x00, 0x29, 0x2d, 0x34, 0x32, 0x32, 0x35, 0x36, 0x3c, 0x3b, 0x40, 0x47, 0x46, 0x52, 0x60, 0x67, 0x68, 0x53, 0x62, 0x8d, 0x00, 0x00, 0xa7, 0xdc, 0xba, 0x2b, 0xa4, 0x2a, 0x00, 0x29, 0x29, 0x29, 0x2a, 0x2a, 0x30, 0x35, 0x3b, 0x4e, 0x5b, 0x5d, 0x65, 0x43, 0x90, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa8, 0x94, 0x62, 0x3f, 0x47, 0x54, 0x52, 0x52, 0x52, 0x50, 0x52, 0x52, 0x54, 0x55, 0x55, 0x55, 0x67, 0x67, 0x66, 0x6c, 0x47, 0x7b, 0xd7, 0x00, 0xa4, 0x00, 0x00, 0xf5, 0x00, 0xe4, 0xde, 0xac, 0x2a, 0xa6, 0x29, 0x29, 0x29, 0x2d, 0x30, 0x32, 0x35, 0x38, 0x3c, 0x3c, 0x41, 0x4b, 0x61, 0x5d, 0x66, 0x47, 0x8a, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe7, 0xba, 0x29, 0x2c, 0x29, 0x38, 0x2f, 0x33, 0x33, 0x36, 0x36, 0x40, 0x40, 0x47, 0x48, 0x55, 0x60, 0x65, 0x6c, 0x53, 0x5f, 0x90, 0x00, 0xa4, 0xe3, 0xfb, 0xb3, 0xa4, 0x00, 0x29, 0x00, 0x29, 0x00, 0x00, 0x29, 0x29, 0x2d, 0x37, 0x47, 0x4b, 0x58, 0x65, 0x61, 0x47, 0x88, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x29, 0x9e, 0x56, 0x33, 0x5a, 0x50, 0x54, 0x52, 0x52, 0x54, 0x50, 0x50, 0x52, 0x52, 0x52, 0x5b, 0x67, 0x67, 0x66, 0x6c, 0x40, 0x85, 0xd2, 0x00, 0xf5, 0xeb, 0x00, 0xf5, 0xf5, 0x78, 0xd9, 0x29, 0xaa, 0x2f, 0x29, 0x29, 0x2d, 0x2a, 0x32, 0x32, 0x35, 0x37, 0x3c, 0x3b, 0x42, 0x4b, 0x61, 0x5d, 0x68, 0x40, 0x8a, 0x5e, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe6, 0x00, 0x00, 0x2d, 0x2e, 0x32, 0x36, 0x32, 0x35, 0x36, 0x36, 0x40, 0x42, 0x47, 0x46, 0x55, 0x67, 0x65, 0x61, 0x58, 0x5e, 0x92, 0x00, 0x00, 0xe4, 0xdc, 0xe2, 0x00, 0x00, 0xa9, 0x00, 0x00, 0xa4, 0x29, 0x00, 0x29, 0x2d, 0x37, 0x3b, 0x4b, 0x61, 0x5b, 0x64, 0x4d, 0x72, 0x84, 0x00, 0xa7, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa4, 0x2a, 0xdf, 0x56, 0x47, 0x5a, 0x58, 0x58, 0x4b, 0x54, 0x50, 0x53, 0x52, 0x4b, 0x52, 0x55, 0x6b, 0x65, 0x61, 0x64, 0x6f, 0x35, 0x97, 0x57, 0xa4, 0xa7, 0x00, 0xf5, 0x00, 0xff, 0xe6, 0x59, 0x29, 0x34, 0x2a, 0x2d, 0x2f, 0x2e, 0x32, 0x30, 0x37, 0x37, 0x35, 0x3c, 0x42, 0x3e, 0x50, 0x65, 0x06, 0x6c, 0x47, 0x8a, 0x63, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x74, 0x00, 0x2d, 0x34, 0x38, 0x32, 0x2a, 0x36, 0x36, 0x3b, 0x3b, 0x3b, 0x42, 0x47, 0x4b, 0x5b, 0x67, 0x65, 0x75, 0x40, 0x72, 0x8a, 0xe2, 0xa4, 0xf1, 0xea, 0x00, 0xe3, 0x00, 0x00, 0x29, 0x00, 0x00, 0xa4, 0x29, 0x29, 0x2a, 0x35, 0x3c, 0x46, 0x61, 0x5d, 0x61, 0x53, 0x69, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x2b, 0x00, 0xbd, 0xa2, 0x8d, 0x5a, 0x53, 0x6f, 0x66, 0x58, 0x50, 0x48, 0x4b, 0x54, 0x50, 0x52, 0x61, 0x65, 0x65, 0x6c, 0x6f, 0x4d, 0x4a, 0x9b, 0xb0, 0x00, 0x00, 0x00, 0xa7, 0x00, 0xc1, 0xe6, 0x2c, 0x29, 0x34, 0x34, 0x2f, 0x2a, 0x2d, 0x32, 0x35, 0x37, 0x37, 0x36, 0x3c, 0x3b, 0x39, 0x50, 0x5b, 0x6a, 0x5d, 0x2e, 0x91, 0x5c, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xe4, 0x29, 0x29, 0x34, 0x3f, 0x32, 0x40, 0x32, 0x36, 0x40, 0x42, 0x47, 0x3b, 0x47, 0x4d, 0x65, 0x67, 0x06, 0x61, 0x4a, 0x70, 0x84, 0xff, 0x00, 0xea, 0xe5, 0x00, 0xae, 0x00, 0x29, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x29, 0x2a, 0x37, 0x3b, 0x46, 0x5d, 0x5d, 0x61, 0x53, 0x5e, 0xdb, 0xa5, 0x00, 0xe2, 0x00, 0x00, 0xff, 0xa4, 0x00, 0x00, 0x00, 0xab, 0x9a, 0x76, 0x9d, 0x91, 0x93, 0x96, 0x89, 0x6a, 0x58, 0x58, 0x5a, 0x58, 0x58, 0x68, 0x68, 0x65, 0x6c, 0x61, 0x5a, 0x43, 0x82, 0x92, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x84, 0x84, 0x29, 0x29, 0x37, 0x34, 0x37, 0x32, 0x32, 0x35, 0x33, 0x2f, 0x36, 0x3c, 0x40, 0x42, 0x46, 0x5d, 0x61, 0x68, 0x5a, 0x47, 0x90, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x9a, 0x57, 0x2c, 0x34, 0x43, 0x43, 0x32, 0x3b, 0x40, 0x3b, 0x3b, 0x3b, 0x39, 0x3b, 0x50, 0x5f, 0x61, 0x65, 0x66, 0x75, 0x2c, 0x90, 0x74, 0x00, 0xa7, 0xe0, 0xb5, 0xf5, 0xa8, 0x00, 0xa8, 0x29, 0x00, 0x00, 0x29, 0xa4, 0x29, 0x2d, 0x35, 0x3c, 0x41, 0x5d, 0x5b, 0x61, 0x5a, 0x4f, 0x94, 0xab, 0x00, 0xf5, 0x00, 0xff, 0xa4, 0x00, 0x00, 0xff, 0x2b, 0x74, 0x92, 0x62, 0x97, 0x96, 0xa0, 0x27, 0x27, 0x81, 0x6a, 0x64, 0x6a, 0x64, 0x75, 0x8f, 0x8f, 0x5d, 0x61, 0x66, 0x5f, 0x7f, 0x9f, 0x44, 0x00, 0xa6, 0xf5, 0x00, 0x00, 0xfe, 0x94, 0xc1, 0x2c, 0x32, 0x2f, 0x2f, 0x32, 0x32, 0x33, 0x32, 0x3b, 0x33, 0x3b, 0x37, 0x39, 0x39, 0x46, 0x5d, 0x5d, 0x58, 0x5d, 0x38, 0x94, 0x57, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x72, 0xa4, 0x34, 0x4d, 0x4a, 0x3b, 0x39, 0x3b, 0x3b, 0x41, 0x46, 0x48, 0x4b, 0x53, 0x61, 0x61, 0x68, 0x64, 0x47, 0x4f, 0xa3, 0x49, 0x00, 0xf1, 0xdb, 0x00, 0xe3, 0xa4, 0x29, 0x29, 0x29, 0x00, 0x29, 0x00, 0x29, 0x2a, 0x2d, 0x35, 0x3b, 0x46, 0x5b, 0x5d, 0x61, 0x5a, 0x43, 0xdd, 0xb5, 0x00, 0x00, 0xa4, 0xa7, 0x00, 0xa4, 0xa7, 0x00, 0x44, 0xe7, 0x56, 0x88, 0x9d, 0x8e, 0x8f, 0xa0, 0x9c, 0xa0, 0x98, 0x91, 0x91, 0x96, 0x27, 0x27, 0x27, 0x9c, 0x89, 0x91, 0xa2, 0x28, 0x74, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x57, 0x9a, 0x31, 0x29, 0x34, 0x37, 0x36, 0x32, 0x35, 0x36, 0x36, 0x40, 0x36, 0x40, 0x3b, 0x3b, 0x47, 0x52, 0x66, 0x61, 0x66, 0x5a, 0x2a, 0x28, 0xb3, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x70, 0xe7, 0x5e, 0x5e, 0x79, 0x73, 0x48, 0x40, 0x3b, 0x41, 0x41, 0x4b, 0x54, 0x5a, 0x64, 0x64, 0x66, 0x64, 0x58, 0x4a, 0x98, 0x7d, 0xa4, 0xa4, 0xde, 0xc6, 0x00, 0xa4, 0xab, 0x2c, 0x00, 0x2d, 0x00, 0x29, 0x29, 0x29, 0x2a, 0x30, 0x37, 0x3b, 0x46, 0x5b, 0x5b, 0x61, 0x5f, 0x38, 0x92, 0xe4, 0xa4, 0x00, 0xa5, 0x00, 0x00, 0xff, 0xff, 0x00, 0xd7, 0x88, 0xc6, 0x97, 0x97, 0x96, 0xa0, 0x96, 0x83, 0x91, 0x9c, 0x9d, 0xa0, 0x99, 0xa0, 0x99, 0x9c, 0xa0, 0x27, 0x27, 0x85, 0x9a, 0x59, 0x00, 0xa4, 0x00, 0x00, 0xff, 0x00, 0x63, 0x9a, 0xa4, 0x30, 0x38, 0x40, 0x3c, 0x32, 0x3b, 0x36, 0x3b, 0x39, 0x35, 0x3b, 0x39, 0x3b, 0x58, 0x61, 0x61, 0x66, 0x5d, 0x36, 0x72, 0x9b, 0xa4, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x69, 0x28, 0x97, 0x91, 0x93, 0x93, 0x66, 0x52, 0x5d, 0x58, 0x50, 0x52, 0x64, 0x7e, 0x89, 0x8c, 0x79, 0x7a, 0x82, 0x27, 0xa3, 0x56, 0xa7, 0xba, 0xe6, 0xae, 0xf5, 0x29, 0xae, 0x30, 0x29, 0x2c, 0x29, 0x29, 0xa4, 0x2a, 0xa6, 0x32, 0x36, 0x3b, 0x4e, 0x5b, 0x5d, 0x5d, 0x64, 0x35, 0x8b, 0x63, 0xa6, 0x00, 0x2b, 0x00, 0x00, 0xa4, 0xa4, 0xe4, 0xe1, 0x4f, 0x8b, 0x97, 0x8c, 0x8f, 0xa0, 0x8e, 0x8f, 0x91, 0x8e, 0x93, 0x93, 0x8e, 0x99, 0x9c, 0xa0, 0xa0, 0x9c, 0x93, 0x72, 0x9f, 0xe4, 0xa7, 0xa6, 0x00, 0x00, 0xff, 0xa4, 0x63, 0x9a, 0xa4, 0x3a, 0x38, 0x4d, 0x48, 0x2f, 0x3b, 0x32, 0x33, 0x39, 0x39, 0x40, 0x3b, 0x4d, 0x6f, 0x6c, 0x54, 0x61, 0x50, 0x53, 0xa2, 0x63, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x9e, 0x69, 0x69, 0x82, 0x6f, 0x96, 0x9c, 0x83, 0x6c, 0x6f, 0x71, 0x7a, 0x8f, 0xa0, 0x27, 0x27, 0x27, 0x28, 0x27, 0x82, 0x9a, 0x63, 0x00, 0x7d, 0xd7, 0xf5, 0x29, 0x31, 0x30, 0x34, 0x33, 0x29, 0x2a, 0x29, 0x2a, 0x2a, 0x2f, 0x32, 0x37, 0x3b, 0x4e, 0x5b, 0x5b, 0x61, 0x64, 0x34, 0x88, 0x6e, 0xa4, 0x00, 0xa6, 0x00, 0x31, 0x00, 0xa4, 0x90, 0x7d, 0x5c, 0x9a, 0x97, 0x8e, 0x9c, 0xa0, 0x83, 0x8f, 0x97, 0x91, 0x90, 0x93, 0x97, 0xa0, 0x9c, 0x99, 0x27, 0x99, 0x8e, 0x7f, 0x9e, 0x49, 0x00, 0x00, 0xa4, 0x00, 0xff, 0x00, 0x5e, 0x9e, 0x30, 0x33, 0x4a, 0x6d, 0x6f, 0x48, 0x48, 0x36, 0x46, 0x39, 0x3b, 0x4d, 0x54, 0x73, 0x96, 0x93, 0x7a, 0x7e, 0x89, 0x28, 0x9d, 0x31, 0x00, 0xeb, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x00, 0x78, 0x97, 0x2c, 0x6d, 0x73, 0x69, 0x89, 0xa0, 0x8c, 0xa0, 0xa0, 0xa0, 0x9c, 0x98, 0x99, 0x9c, 0x99, 0x9c, 0xa0, 0x98, 0x6d, 0x9f, 0xc6, 0x00, 0xdc, 0xc1, 0x2b, 0x29, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2d, 0x2a, 0x2d, 0x36, 0x3b, 0x3b, 0x3b, 0x58, 0x5b, 0x66, 0x06, 0x5f, 0x38, 0x88, 0x6e, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x31, 0x4f, 0xe0, 0x4a, 0x90, 0x98, 0x8a, 0x99, 0xa0, 0x86, 0x8f, 0x91, 0x91, 0x93, 0x91, 0x91, 0x96, 0x9c, 0x9c, 0x9c, 0x98, 0xa2, 0x7c, 0x84, 0x9a, 0xe2, 0x00, 0xa7, 0x00, 0x00, 0xff, 0x31, 0x31, 0xa2, 0x8a, 0x5a, 0x79, 0x9c, 0x99, 0x75, 0x4d, 0x41, 0x4d, 0x4d, 0x51, 0x64, 0x87, 0xa0, 0x27, 0x27, 0x27, 0x28, 0xa0, 0x82, 0x9f, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa5, 0x00, 0x00, 0xa7, 0xdc, 0x5f, 0x4a, 0x73, 0x75, 0x6f, 0x98, 0x87, 0x6f, 0x81, 0x81, 0x83, 0x87, 0x89, 0x91, 0x97, 0x96, 0x99, 0x9c, 0x98, 0x76, 0xe7, 0xe4, 0x00, 0xe6, 0xbf, 0x00, 0x34, 0x37, 0x38, 0x40, 0x3c, 0x39, 0x32, 0x36, 0x36, 0x36, 0x33, 0x35, 0x46, 0x52, 0x5b, 0x58, 0x5b, 0x58, 0x6a, 0x33, 0x85, 0x6e, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x90, 0x76, 0x69, 0x94, 0x98, 0x8e, 0x9c, 0x99, 0x8e, 0x96, 0x91, 0x91, 0x91, 0x91, 0x96, 0x9c, 0x9d, 0x9c, 0xa2, 0x9d, 0x97, 0x76, 0x92, 0x84, 0x00, 0xff, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x3a, 0x9d, 0x85, 0x9d, 0x8e, 0x7b, 0x93, 0x9c, 0x8f, 0x86, 0x75, 0x7e, 0x8c, 0x9d, 0xa2, 0x9c, 0x93, 0x98, 0xa0, 0x9d, 0x8d, 0x7c, 0x9f, 0xe3, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xc6, 0x9a, 0x29, 0x6d, 0x75, 0x72, 0x7b, 0xa0, 0x73, 0x6f, 0x7a, 0x7e, 0x7e, 0x81, 0x8a, 0x96, 0x9c, 0x99, 0x9c, 0x99, 0x8f, 0x74, 0x9f, 0xaf, 0x00, 0xfb, 0x5c, 0xa8, 0x45, 0x35, 0x33, 0x39, 0x58, 0x33, 0x36, 0x36, 0x40, 0x42, 0x3b, 0x42, 0x50, 0x58, 0x5d, 0x6c, 0x5d, 0x66, 0x53, 0x3a, 0x9f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x31, 0xb3, 0x9a, 0x63, 0x8a, 0x97, 0x91, 0x93, 0xa0, 0x8c, 0x8c, 0x8c, 0x93, 0x8f, 0x8e, 0x93, 0x99, 0x9c, 0x9c, 0x9c, 0x96, 0xa2, 0x8a, 0x70, 0xe0, 0x4f, 0x00, 0x00, 0xa4, 0xf5, 0x00, 0x00, 0x34, 0xe5, 0x82, 0x34, 0x73, 0x79, 0x72, 0x96, 0x93, 0x81, 0x9c, 0xa0, 0xa0, 0x98, 0x93, 0x8f, 0x96, 0x99, 0xa0, 0x99, 0xa0, 0x85, 0x7f, 0x9f, 0x2c, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xda, 0x74, 0x35, 0x81, 0x73, 0x71, 0x8c, 0x9c, 0x6a, 0x86, 0x81, 0x83, 0x83, 0x83, 0x8e, 0x99, 0x9c, 0x99, 0x9c, 0x9c, 0x87, 0x76, 0x9a, 0xf5, 0xa5, 0x74, 0x9e, 0x34, 0x29, 0x43, 0x42, 0x4d, 0x87, 0x50, 0x47, 0x39, 0x36, 0x36, 0x3c, 0x58, 0x7b, 0x8c, 0x5b, 0x4e, 0x61, 0x5a, 0x39, 0x7f, 0x94, 0xff, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x6e, 0x8b, 0x56, 0x9a, 0x91, 0x90, 0x98, 0x98, 0x8c, 0x96, 0x96, 0x93, 0x8e, 0x8f, 0x96, 0x9c, 0xa0, 0x9c, 0x9c, 0x9c, 0x9c, 0x73, 0x85, 0x94, 0xa4, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x8d, 0x6e, 0x38, 0x7f, 0x76, 0x75, 0x9c, 0x7e, 0x75, 0x83, 0x7e, 0x87, 0x83, 0x87, 0x8f, 0x99, 0xa0, 0x9c, 0x99, 0x27, 0x7f, 0x85, 0x9a, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xb5, 0x9e, 0x3d, 0x5f, 0x7e, 0x7a, 0x7b, 0x9c, 0x86, 0x6a, 0x83, 0x81, 0x86, 0x81, 0x81, 0x8f, 0x96, 0x99, 0x96, 0x99, 0xa0, 0x79, 0x90, 0x88, 0x00, 0x00, 0xe4, 0xe8, 0x97, 0x7f, 0x6d, 0x89, 0x99, 0x99, 0x8f, 0x5f, 0x53, 0x4d, 0x5a, 0x6f, 0x8c, 0x9c, 0x27, 0x8c, 0x71, 0x66, 0x6c, 0x7b, 0x28, 0x7c, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x74, 0xa3, 0x74, 0x94, 0x90, 0x9d, 0xa2, 0x8e, 0x8c, 0x8a, 0x8f, 0x91, 0x8e, 0x93, 0x99, 0x9c, 0x9c, 0x99, 0xa0, 0x27, 0x8a, 0x6d, 0xa2, 0x62, 0xa4, 0x00, 0xff, 0x00, 0x00, 0xe2, 0x00, 0x00, 0xe6, 0x56, 0x69, 0x7c, 0x73, 0x87, 0x27, 0x6f, 0x7e, 0x89, 0x86, 0x81, 0x83, 0x8c, 0x99, 0x99, 0x99, 0x96, 0x9d, 0xa0, 0x75, 0x8d, 0x8b, 0x00, 0x2c, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xdc, 0x31, 0x75, 0x7b, 0x7a, 0x83, 0xa0, 0x7a, 0x7a, 0x80, 0x81, 0x86, 0x83, 0x86, 0x96, 0x9c, 0x99, 0x9c, 0x9c, 0x99, 0x6d, 0xa3, 0x5c, 0x00, 0x00, 0x74, 0x8a, 0x69, 0x94, 0x96, 0x89, 0x81, 0x83, 0x27, 0x99, 0x99, 0x93, 0x96, 0x9d, 0x99, 0x8f, 0x8e, 0xa0, 0x27, 0xa0, 0x27, 0x91, 0x8a, 0x84, 0x31, 0x00, 0x00, 0x00, 0xf5, 0x2b, 0xe4, 0x94, 0x28, 0x97, 0x94, 0x9a, 0x99, 0x8d, 0x97, 0x8e, 0x93, 0x8e, 0x91, 0x96, 0x9c, 0x9d, 0x9c, 0xa0, 0xa0, 0x8e, 0x73, 0x98, 0x8d, 0x31, 0xff, 0x00, 0x00, 0xfe, 0x00, 0xf5, 0xa4, 0xb5, 0xa1, 0x30, 0x69, 0x7f, 0x75, 0x91, 0x99, 0x61, 0x89, 0x86, 0x83, 0x8c, 0x86, 0x89, 0x95, 0x9c, 0x96, 0x99, 0xa0, 0x98, 0x72, 0x98, 0x76, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x84, 0x78, 0x45, 0x82, 0x7a, 0x7e, 0x8f, 0x93, 0x75, 0x86, 0x83, 0x81, 0x86, 0x83, 0x89, 0x99, 0x99, 0x96, 0x9c, 0xa0, 0x89, 0x79, 0x9a, 0x31, 0xa4, 0xe3, 0x9a, 0xe4, 0x3c, 0x72, 0x64, 0x6a, 0x6f, 0x8c, 0x9c, 0x6c, 0x83, 0x8c, 0x87, 0x87, 0x7e, 0x87, 0x9c, 0xa0, 0x96, 0xa0, 0x9c, 0x82, 0x90, 0x82, 0x00, 0xf5, 0x00, 0xa7, 0x00, 0xa4, 0x00, 0x44, 0xd9, 0x28, 0x28, 0xa2, 0x97, 0x90, 0x91, 0x91, 0x90, 0x91, 0x97, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x7b, 0x82, 0xa2, 0x51, 0x2b, 0x00, 0xff, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x5c, 0x92, 0x30, 0x7f, 0x73, 0x79, 0x9c, 0x8e, 0x71, 0x83, 0x86, 0x86, 0x7a, 0x86, 0x8f, 0x9c, 0x9c, 0x99, 0x99, 0xa0, 0x91, 0x72, 0x27, 0x59, 0x2c, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xe0, 0x57, 0x57, 0x85, 0x7e, 0x7e, 0x9c, 0x8f, 0x71, 0x87, 0x80, 0x81, 0x86, 0x83, 0x8c, 0x9c, 0x9c, 0x96, 0x9c, 0xa0, 0x79, 0x8d, 0x8a, 0xa4, 0x00, 0x3d, 0x9e, 0x3f, 0x5a, 0x73, 0x58, 0x6f, 0x71, 0xa0, 0x89, 0x64, 0x7a, 0x75, 0x7a, 0x85, 0x83, 0x83, 0x99, 0x93, 0xa0, 0x93, 0xa0, 0x7f, 0x8a, 0x7d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x00, 0x4c, 0xd7, 0x9f, 0x28, 0x28, 0x9d, 0x9f, 0x9b, 0x97, 0x9a, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x97, 0x97, 0xa3, 0x70, 0xf5, 0x2b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0xd4, 0x8b, 0x38, 0x7f, 0x7b, 0x87, 0x9d, 0x80, 0x81, 0x86, 0x83, 0x86, 0x89, 0x8c, 0x95, 0x96, 0x9c, 0x9c, 0xa0, 0x9c, 0x8c, 0x6d, 0xa3, 0x3a, 0xff, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xa5, 0x00, 0xfe, 0xe0, 0xb5, 0xcc, 0x81, 0x79, 0x89, 0xa0, 0x81, 0x83, 0x83, 0x81, 0x86, 0x81, 0x87, 0x93, 0x9c, 0x9c, 0x9c, 0x9d, 0x99, 0x6d, 0xa2, 0x63, 0x00, 0xa4, 0xcc, 0x90, 0x2e, 0x69, 0x73, 0x6f, 0x6f, 0x7e, 0xa0, 0x7a, 0x6c, 0x7e, 0x7e, 0x7b, 0x87, 0x81, 0x87, 0x9c, 0x96, 0x96, 0x9c, 0xa0, 0x6d, 0x9a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x2b, 0x00, 0xae, 0x56, 0x78, 0x8d, 0x9f, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xa2, 0xde, 0x90, 0x74, 0x4c, 0x29, 0x00, 0x2b, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x88, 0x7c, 0x3f, 0x85, 0x7b, 0x89, 0xa0, 0x7a, 0x80, 0x86, 0x86, 0x89, 0x86, 0x8c, 0x93, 0x9c, 0x99, 0x9c, 0x9c, 0x9d, 0x7c, 0x85, 0x97, 0x2b, 0xa4, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xe3, 0xe6, 0xe9, 0x74, 0x82, 0x81, 0x8e, 0xa0, 0x83, 0x81, 0x83, 0x83, 0x87, 0x87, 0x8f, 0x99, 0x98, 0x98, 0x9d, 0x9d, 0x7f, 0x7f, 0x9a, 0xa4, 0x00, 0x31, 0x78, 0x7f, 0x38, 0x72, 0x73, 0x6f, 0x75, 0x83, 0xa0, 0x6f, 0x75, 0x7a, 0x7e, 0x7e, 0x83, 0x85, 0x89, 0x99, 0x9c, 0x96, 0xa0, 0x9b, 0x73, 0xde, 0x69, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa4, 0x00, 0x2c, 0x2e, 0x31, 0x34, 0xe4, 0xba, 0x4c, 0x49, 0xb6, 0x3d, 0x2e, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x2c, 0xff, 0x90, 0x63, 0x5f, 0x85, 0x7e, 0x8e, 0x9c, 0x7a, 0x86, 0x86, 0x86, 0x86, 0x89, 0x8f, 0xa0, 0x99, 0x93, 0x98, 0xa0, 0x9d, 0x6d, 0x9f, 0x69, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xe3, 0x00, 0x5c, 0xe7, 0xa1, 0x8a, 0x8d, 0x91, 0x97, 0x7f, 0x7f, 0x81, 0x87, 0x7b, 0x85, 0x93, 0x9d, 0x9b, 0x98, 0x97, 0x97, 0x82, 0x9f, 0x6e, 0x31, 0xa7, 0x00, 0x94, 0x63, 0x4a, 0x79, 0x71, 0x73, 0x7a, 0x93, 0x99, 0x66, 0x7a, 0x7e, 0x80, 0x81, 0x81, 0x87, 0x8f, 0x99, 0x99, 0x9c, 0x99, 0x98, 0x76, 0x9a, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xff, 0xa4, 0x2b, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8d, 0x69, 0x5a, 0x82, 0x85, 0x96, 0x93, 0x7a, 0x89, 0x86, 0x89, 0x89, 0x89, 0x8f, 0x98, 0x99, 0x9d, 0x27, 0x98, 0x7f, 0x7f, 0xa2, 0x2b, 0x2b, 0x00, 0x00, 0xfe, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0xfe, 0x00, 0x49, 0x7d, 0xa2, 0x28, 0x28, 0xa3, 0x94, 0x91, 0x8d, 0x91, 0x97, 0x97, 0x9b, 0x9d, 0x9f, 0x27, 0xa3, 0x9d, 0x97, 0xe5, 0xa4, 0x00, 0x00, 0xe3, 0x9a, 0x4c, 0x5e, 0x79, 0x75, 0x73, 0x7e, 0x9c, 0x8c, 0x6a, 0x80, 0x7e, 0x83, 0x81, 0x7e, 0x87, 0x93, 0x99, 0x99, 0x9c, 0x99, 0x94, 0x76, 0x9f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0xf5, 0xa4, 0x00, 0x00, 0xf5, 0xa5, 0x00, 0x00, 0x00, 0xff, 0x31, 0x88, 0x84, 0x59, 0x8a, 0x85, 0x99, 0x8e, 0x81, 0x89, 0x87, 0x83, 0x81, 0x91, 0x9b, 0xa0, 0x9b, 0x98, 0x9f, 0x94, 0x7f, 0x9e, 0x7c, 0x00, 0x2b, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xae, 0x59, 0x7c, 0x94, 0x9f, 0x28, 0x28, 0xa3, 0xa3, 0xa3, 0x28, 0xa3, 0x9a, 0x8b, 0x78, 0x5e, 0x3d, 0xa4, 0x31, 0xa7, 0xa4, 0xae, 0x9e, 0x38, 0x70, 0x73, 0x75, 0x7a, 0x81, 0xa0, 0x7e, 0x75, 0x80, 0x80, 0x83, 0x83, 0x7e, 0x8c, 0x96, 0x98, 0x99, 0x99, 0xa2, 0x85, 0x82, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa7, 0x00, 0xff, 0x00, 0xba, 0x9e, 0xa2, 0x94, 0x90, 0xa2, 0x8a, 0x7f, 0x7f, 0x81, 0x8a, 0x8c, 0x98, 0x97, 0x97, 0x97, 0x9a, 0xa2, 0xa1, 0x97, 0x78, 0x31, 0xff, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x44, 0x4c, 0x4f, 0x4f, 0x49, 0x45, 0xae, 0x2b, 0xff, 0xa4, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa4, 0xba, 0xa1, 0x34, 0x76, 0x73, 0x7b, 0x7b, 0x89, 0xa0, 0x75, 0x81, 0x83, 0x80, 0x83, 0x83, 0x81, 0x8c, 0x99, 0x98, 0x9c, 0x97, 0x27, 0x73, 0x97, 0x74, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0xf5, 0x00, 0xff, 0xa7, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xf5, 0xa4, 0x00, 0xb3, 0x7d, 0xdd, 0xa3, 0x28, 0x28, 0xa2, 0xa2, 0x9f, 0xa2, 0xa2, 0x28, 0xa3, 0x28, 0x28, 0xa3, 0x8d, 0x6e, 0x44, 0xfe, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0xe3, 0x00, 0x00, 0xa7, 0x00, 0xf5, 0x00, 0x2b, 0xff, 0xa4, 0x00, 0xa4, 0x00, 0xa4, 0xa4, 0xff, 0xa4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xe3, 0xf5, 0x00, 0x57, 0xd9, 0x3f, 0x7c, 0x75, 0x7b, 0x7e, 0x8f, 0x9c, 0x75, 0x83, 0x80, 0x80, 0x86, 0x81, 0x87, 0x91, 0x99, 0x98, 0x99, 0x9b, 0x93, 0x76, 0x9f, 0x4c, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xfe, 0x00, 0xe2, 0x00, 0x00, 0xab, 0x00, 0x00, 0xa4, 0xb5, 0x59, 0x78, 0x88, 0x92, 0x92, 0x94, 0xda, 0x82, 0x78, 0x70, 0x57, 0x3d, 0xa4, 0x00, 0x00, 0x00, 0xa7, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xe3, 0x00, 0xa4, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0xa4, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xa7, 0xb5, 0xa3, 0x4c, 0x79, 0x7f, 0x7b, 0x81, 0x93, 0x98, 0x7b, 0x81, 0x7e, 0x86, 0x83, 0x83, 0x87, 0x93, 0x9b, 0x99, 0x98, 0xa2, 0x7f, 0x7f, 0x9f, 0x2b, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0xa4, 0xa4, 0xa4, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xe3, 0x00, 0xa5, 0xa5, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa7, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xa4, 0x00, 0x00, 0x3d, 0x7d, 0xe8, 0x88, 0x85, 0x79, 0x85, 0x9d, 0x91, 0x7b, 0x85, 0x83, 0x83, 0x81, 0x85, 0x8e, 0x97, 0x99, 0x97, 0x9b, 0x9a, 0xa2, 0x90, 0x59, 0xff, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x49, 0x70, 0xe1, 0x28, 0xe0, 0x9f, 0xa2, 0x97, 0x8a, 0x8d, 0x8a, 0x8a, 0x8c, 0x90, 0x99, 0xa3, 0xa3, 0xa3, 0x28, 0x8b, 0xe5, 0xe4, 0xff, 0x00, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x59, 0x7c, 0x90, 0xa2, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xa3, 0x9f, 0x92, 0x82, 0x74, 0x49, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xa4, 0xa4, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0x29, 0x34, 0x49, 0x45, 0x44, 0x44, 0x3a, 0xae, 0x34, 0x31, 0x00, 0x00, 0x2b, 0x00, 0x2b, 0xe3, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x2b, 0x00, 0xa4, 0x29, 0x00, 0x31, 0x2e, 0xa4, 0xa7, 0x29, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa5, 0xf5, 0x00, 0x00, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xf5, 0x00, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0x00, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_img_dsc_t image23 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 207,
-  .header.h = 207,
-  .data_size = 43873,
-  .data = image23_map,
-};
@@ -1,500 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE24
-#define LV_ATTRIBUTE_IMG_IMAGE24
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE24 uint8_t image24_map[] = {
-  0xfe, 0xfe, 0xfe, 0xff, 	/*Color of index 0*/
-  0xf0, 0xf3, 0xfb, 0xff, 	/*Color of index 1*/
-  0xc4, 0xcd, 0xfa, 0xff, 	/*Color of index 2*/
-  0x9d, 0x9b, 0xe8, 0xff, 	/*Color of index 3*/
-  0x81, 0x96, 0xd4, 0xff, 	/*Color of index 4*/
-  0x8d, 0x8f, 0xdf, 0xff, 	/*Color of index 5*/
-  0x87, 0x8f, 0xcf, 0xff, 	/*Color of index 6*/
-  0x82, 0x85, 0xcf, 0xff, 	/*Color of index 7*/
-  0x77, 0x76, 0xc0, 0xff, 	/*Color of index 8*/
-  0x6b, 0x78, 0xab, 0xff, 	/*Color of index 9*/
-  0x68, 0x67, 0xa8, 0xff, 	/*Color of index 10*/
-  0x4d, 0x5e, 0xa0, 0xff, 	/*Color of index 11*/
-  0x5c, 0x5d, 0x95, 0xff, 	/*Color of index 12*/
-  0x4f, 0x59, 0x83, 0xff, 	/*Color of index 13*/
-  0x4b, 0x43, 0x8d, 0xff, 	/*Color of index 14*/
-  0x24, 0x28, 0x6f, 0xff, 	/*Color of index 15*/
-  0x10, 0x1c, 0x60, 0xff, 	/*Color of index 16*/
-  0x0c, 0x10, 0x5b, 0xff, 	/*Color of index 17*/
-  0x03, 0x07, 0x4e, 0xff, 	/*Color of index 18*/
-  0xed, 0xf9, 0xfd, 0xff, 	/*Color of index 19*/
-  0xdf, 0xf3, 0xfc, 0xff, 	/*Color of index 20*/
-  0xcf, 0xeb, 0xf9, 0xff, 	/*Color of index 21*/
-  0xc5, 0xdf, 0xf5, 0xff, 	/*Color of index 22*/
-  0xbe, 0xd5, 0xe2, 0xff, 	/*Color of index 23*/
-  0x8b, 0xcf, 0xec, 0xff, 	/*Color of index 24*/
-  0xab, 0xcc, 0xe0, 0xff, 	/*Color of index 25*/
-  0x31, 0xcd, 0xe1, 0xff, 	/*Color of index 26*/
-  0x4d, 0xcb, 0xdc, 0xff, 	/*Color of index 27*/
-  0xa9, 0xbe, 0xdf, 0xff, 	/*Color of index 28*/
-  0x3f, 0xc7, 0xdf, 0xff, 	/*Color of index 29*/
-  0x61, 0xc3, 0xdf, 0xff, 	/*Color of index 30*/
-  0x7f, 0xc0, 0xdd, 0xff, 	/*Color of index 31*/
-  0x31, 0xc4, 0xd8, 0xff, 	/*Color of index 32*/
-  0x93, 0xb7, 0xd4, 0xff, 	/*Color of index 33*/
-  0x2f, 0xbc, 0xd2, 0xff, 	/*Color of index 34*/
-  0x4f, 0xb5, 0xd4, 0xff, 	/*Color of index 35*/
-  0x8e, 0xb4, 0xc0, 0xff, 	/*Color of index 36*/
-  0x65, 0xb3, 0xd0, 0xff, 	/*Color of index 37*/
-  0x3f, 0xb6, 0xcf, 0xff, 	/*Color of index 38*/
-  0x86, 0xad, 0xd4, 0xff, 	/*Color of index 39*/
-  0x62, 0xaf, 0xc1, 0xff, 	/*Color of index 40*/
-  0x2c, 0xb2, 0xc8, 0xff, 	/*Color of index 41*/
-  0x52, 0xa6, 0xc7, 0xff, 	/*Color of index 42*/
-  0x29, 0xaa, 0xc3, 0xff, 	/*Color of index 43*/
-  0x3d, 0xa5, 0xc9, 0xff, 	/*Color of index 44*/
-  0x82, 0x9e, 0xc1, 0xff, 	/*Color of index 45*/
-  0x31, 0xa3, 0xc3, 0xff, 	/*Color of index 46*/
-  0x42, 0xa5, 0xb5, 0xff, 	/*Color of index 47*/
-  0x24, 0xa3, 0xbc, 0xff, 	/*Color of index 48*/
-  0x2e, 0xa0, 0xc0, 0xff, 	/*Color of index 49*/
-  0x4d, 0x9f, 0xb7, 0xff, 	/*Color of index 50*/
-  0x62, 0x9e, 0xb2, 0xff, 	/*Color of index 51*/
-  0x7b, 0x9a, 0xad, 0xff, 	/*Color of index 52*/
-  0x3f, 0x9a, 0xc0, 0xff, 	/*Color of index 53*/
-  0x30, 0x9a, 0xbe, 0xff, 	/*Color of index 54*/
-  0x34, 0x91, 0xc3, 0xff, 	/*Color of index 55*/
-  0x35, 0x93, 0xb9, 0xff, 	/*Color of index 56*/
-  0x49, 0x91, 0xb8, 0xff, 	/*Color of index 57*/
-  0x2a, 0x8f, 0xbd, 0xff, 	/*Color of index 58*/
-  0x64, 0x8e, 0xac, 0xff, 	/*Color of index 59*/
-  0x35, 0x8e, 0xb3, 0xff, 	/*Color of index 60*/
-  0x47, 0x90, 0xa4, 0xff, 	/*Color of index 61*/
-  0x2b, 0x8b, 0xb1, 0xff, 	/*Color of index 62*/
-  0x6d, 0x89, 0x99, 0xff, 	/*Color of index 63*/
-  0x31, 0x84, 0xb4, 0xff, 	/*Color of index 64*/
-  0x54, 0x86, 0x9a, 0xff, 	/*Color of index 65*/
-  0x43, 0x80, 0xa6, 0xff, 	/*Color of index 66*/
-  0x3a, 0x84, 0x90, 0xff, 	/*Color of index 67*/
-  0x2c, 0x7e, 0xa7, 0xff, 	/*Color of index 68*/
-  0x4e, 0x78, 0x96, 0xff, 	/*Color of index 69*/
-  0x20, 0x78, 0xa4, 0xff, 	/*Color of index 70*/
-  0x32, 0x7a, 0x97, 0xff, 	/*Color of index 71*/
-  0x61, 0x71, 0x89, 0xff, 	/*Color of index 72*/
-  0x33, 0x76, 0x86, 0xff, 	/*Color of index 73*/
-  0x48, 0x72, 0x86, 0xff, 	/*Color of index 74*/
-  0x1c, 0x71, 0x96, 0xff, 	/*Color of index 75*/
-  0x32, 0x6a, 0x97, 0xff, 	/*Color of index 76*/
-  0x10, 0x69, 0x92, 0xff, 	/*Color of index 77*/
-  0x33, 0x66, 0x83, 0xff, 	/*Color of index 78*/
-  0x1b, 0x5f, 0x8a, 0xff, 	/*Color of index 79*/
-  0x34, 0x5f, 0x77, 0xff, 	/*Color of index 80*/
-  0x1a, 0x58, 0x75, 0xff, 	/*Color of index 81*/
-  0x44, 0x55, 0x6e, 0xff, 	/*Color of index 82*/
-  0x2b, 0x47, 0x78, 0xff, 	/*Color of index 83*/
-  0x2e, 0x48, 0x58, 0xff, 	/*Color of index 84*/
-  0x13, 0x39, 0x75, 0xff, 	/*Color of index 85*/
-  0x20, 0x39, 0x49, 0xff, 	/*Color of index 86*/
-  0x0a, 0x31, 0x38, 0xff, 	/*Color of index 87*/
-  0x00, 0x0f, 0x1a, 0xff, 	/*Color of index 88*/
-  0x00, 0x06, 0x08, 0xff, 	/*Color of index 89*/
-  0xf6, 0xfd, 0xfb, 0xff, 	/*Color of index 90*/
-  0xe2, 0xfd, 0xfe, 0xff, 	/*Color of index 91*/
-  0xb5, 0xe3, 0xe8, 0xff, 	/*Color of index 92*/
-  0x70, 0xe1, 0xec, 0xff, 	/*Color of index 93*/
-  0xad, 0xe0, 0xca, 0xff, 	/*Color of index 94*/
-  0x96, 0xd4, 0xbb, 0xff, 	/*Color of index 95*/
-  0x23, 0xd1, 0xd7, 0xff, 	/*Color of index 96*/
-  0xaf, 0xc4, 0xc0, 0xff, 	/*Color of index 97*/
-  0x22, 0xca, 0xd9, 0xff, 	/*Color of index 98*/
-  0x2a, 0xc8, 0xd9, 0xff, 	/*Color of index 99*/
-  0x8d, 0xc9, 0xac, 0xff, 	/*Color of index 100*/
-  0x75, 0xbf, 0x9d, 0xff, 	/*Color of index 101*/
-  0x91, 0xb6, 0xa4, 0xff, 	/*Color of index 102*/
-  0x5a, 0xb4, 0x88, 0xff, 	/*Color of index 103*/
-  0x54, 0xb0, 0x84, 0xff, 	/*Color of index 104*/
-  0x4d, 0xad, 0x86, 0xff, 	/*Color of index 105*/
-  0x54, 0xab, 0x81, 0xff, 	/*Color of index 106*/
-  0x70, 0x9f, 0x8b, 0xff, 	/*Color of index 107*/
-  0x5b, 0xa3, 0x84, 0xff, 	/*Color of index 108*/
-  0x5e, 0x93, 0x7a, 0xff, 	/*Color of index 109*/
-  0x20, 0x8a, 0x7e, 0xff, 	/*Color of index 110*/
-  0x47, 0x78, 0x61, 0xff, 	/*Color of index 111*/
-  0x2e, 0x6f, 0x76, 0xff, 	/*Color of index 112*/
-  0x32, 0x70, 0x63, 0xff, 	/*Color of index 113*/
-  0x20, 0x6d, 0x6f, 0xff, 	/*Color of index 114*/
-  0x29, 0x68, 0x5e, 0xff, 	/*Color of index 115*/
-  0x30, 0x60, 0x64, 0xff, 	/*Color of index 116*/
-  0x1a, 0x61, 0x66, 0xff, 	/*Color of index 117*/
-  0x31, 0x5b, 0x55, 0xff, 	/*Color of index 118*/
-  0x2d, 0x59, 0x45, 0xff, 	/*Color of index 119*/
-  0x1c, 0x54, 0x52, 0xff, 	/*Color of index 120*/
-  0x37, 0x4a, 0x42, 0xff, 	/*Color of index 121*/
-  0x1c, 0x48, 0x37, 0xff, 	/*Color of index 122*/
-  0x07, 0x42, 0x39, 0xff, 	/*Color of index 123*/
-  0x06, 0x35, 0x29, 0xff, 	/*Color of index 124*/
-  0x09, 0x21, 0x19, 0xff, 	/*Color of index 125*/
-  0xf4, 0xfd, 0xf4, 0xff, 	/*Color of index 126*/
-  0xeb, 0xfb, 0xec, 0xff, 	/*Color of index 127*/
-  0xf0, 0xf7, 0xf1, 0xff, 	/*Color of index 128*/
-  0xf3, 0xf4, 0xf3, 0xff, 	/*Color of index 129*/
-  0xe4, 0xf4, 0xe9, 0xff, 	/*Color of index 130*/
-  0xed, 0xef, 0xed, 0xff, 	/*Color of index 131*/
-  0xe2, 0xeb, 0xe3, 0xff, 	/*Color of index 132*/
-  0xc9, 0xe6, 0xd4, 0xff, 	/*Color of index 133*/
-  0xdb, 0xe2, 0xdb, 0xff, 	/*Color of index 134*/
-  0xca, 0xd7, 0xcc, 0xff, 	/*Color of index 135*/
-  0xa9, 0xd7, 0xc0, 0xff, 	/*Color of index 136*/
-  0xbd, 0xcb, 0xc0, 0xff, 	/*Color of index 137*/
-  0xae, 0xc0, 0xb1, 0xff, 	/*Color of index 138*/
-  0xa9, 0xb4, 0xa9, 0xff, 	/*Color of index 139*/
-  0x84, 0xb8, 0x99, 0xff, 	/*Color of index 140*/
-  0x76, 0xb8, 0x92, 0xff, 	/*Color of index 141*/
-  0x68, 0xb8, 0x90, 0xff, 	/*Color of index 142*/
-  0x62, 0xb6, 0x8b, 0xff, 	/*Color of index 143*/
-  0x98, 0xaa, 0x9d, 0xff, 	/*Color of index 144*/
-  0x69, 0xb4, 0x89, 0xff, 	/*Color of index 145*/
-  0x74, 0xb1, 0x8c, 0xff, 	/*Color of index 146*/
-  0x63, 0xb1, 0x85, 0xff, 	/*Color of index 147*/
-  0x53, 0xb3, 0x7e, 0xff, 	/*Color of index 148*/
-  0x59, 0xb0, 0x82, 0xff, 	/*Color of index 149*/
-  0x86, 0xa6, 0x92, 0xff, 	/*Color of index 150*/
-  0x6e, 0xab, 0x86, 0xff, 	/*Color of index 151*/
-  0x5b, 0xad, 0x83, 0xff, 	/*Color of index 152*/
-  0x63, 0xa9, 0x82, 0xff, 	/*Color of index 153*/
-  0x5c, 0xaa, 0x7d, 0xff, 	/*Color of index 154*/
-  0x51, 0xa9, 0x7c, 0xff, 	/*Color of index 155*/
-  0x5b, 0xa5, 0x7a, 0xff, 	/*Color of index 156*/
-  0x53, 0xa7, 0x75, 0xff, 	/*Color of index 157*/
-  0x8b, 0x99, 0x8e, 0xff, 	/*Color of index 158*/
-  0x6d, 0xa0, 0x7e, 0xff, 	/*Color of index 159*/
-  0x52, 0xa4, 0x77, 0xff, 	/*Color of index 160*/
-  0x63, 0xa1, 0x7a, 0xff, 	/*Color of index 161*/
-  0x4b, 0xa4, 0x77, 0xff, 	/*Color of index 162*/
-  0x59, 0xa1, 0x74, 0xff, 	/*Color of index 163*/
-  0x53, 0xa0, 0x73, 0xff, 	/*Color of index 164*/
-  0x4a, 0xa0, 0x72, 0xff, 	/*Color of index 165*/
-  0x63, 0x9c, 0x74, 0xff, 	/*Color of index 166*/
-  0x52, 0x9d, 0x70, 0xff, 	/*Color of index 167*/
-  0x5c, 0x99, 0x70, 0xff, 	/*Color of index 168*/
-  0x52, 0x9a, 0x6c, 0xff, 	/*Color of index 169*/
-  0x81, 0x8d, 0x81, 0xff, 	/*Color of index 170*/
-  0x4e, 0x98, 0x6a, 0xff, 	/*Color of index 171*/
-  0x53, 0x95, 0x69, 0xff, 	/*Color of index 172*/
-  0x5c, 0x93, 0x6b, 0xff, 	/*Color of index 173*/
-  0x4c, 0x95, 0x67, 0xff, 	/*Color of index 174*/
-  0x73, 0x8a, 0x7d, 0xff, 	/*Color of index 175*/
-  0x61, 0x8f, 0x6a, 0xff, 	/*Color of index 176*/
-  0x4d, 0x92, 0x64, 0xff, 	/*Color of index 177*/
-  0x51, 0x91, 0x63, 0xff, 	/*Color of index 178*/
-  0x42, 0x92, 0x63, 0xff, 	/*Color of index 179*/
-  0x6b, 0x89, 0x70, 0xff, 	/*Color of index 180*/
-  0x4c, 0x8f, 0x5f, 0xff, 	/*Color of index 181*/
-  0x53, 0x8b, 0x62, 0xff, 	/*Color of index 182*/
-  0x5a, 0x89, 0x65, 0xff, 	/*Color of index 183*/
-  0x4c, 0x8c, 0x5f, 0xff, 	/*Color of index 184*/
-  0x53, 0x89, 0x5c, 0xff, 	/*Color of index 185*/
-  0x4b, 0x8a, 0x5a, 0xff, 	/*Color of index 186*/
-  0x42, 0x86, 0x64, 0xff, 	/*Color of index 187*/
-  0x4b, 0x88, 0x55, 0xff, 	/*Color of index 188*/
-  0x6b, 0x7c, 0x6e, 0xff, 	/*Color of index 189*/
-  0x46, 0x85, 0x59, 0xff, 	/*Color of index 190*/
-  0x52, 0x83, 0x5b, 0xff, 	/*Color of index 191*/
-  0x5b, 0x81, 0x5e, 0xff, 	/*Color of index 192*/
-  0x4b, 0x84, 0x54, 0xff, 	/*Color of index 193*/
-  0x54, 0x83, 0x54, 0xff, 	/*Color of index 194*/
-  0x4b, 0x82, 0x59, 0xff, 	/*Color of index 195*/
-  0x3b, 0x80, 0x5b, 0xff, 	/*Color of index 196*/
-  0x4a, 0x81, 0x4e, 0xff, 	/*Color of index 197*/
-  0x46, 0x7f, 0x53, 0xff, 	/*Color of index 198*/
-  0x50, 0x7b, 0x53, 0xff, 	/*Color of index 199*/
-  0x61, 0x74, 0x64, 0xff, 	/*Color of index 200*/
-  0x3e, 0x7a, 0x52, 0xff, 	/*Color of index 201*/
-  0x4b, 0x7a, 0x4b, 0xff, 	/*Color of index 202*/
-  0x43, 0x7b, 0x48, 0xff, 	/*Color of index 203*/
-  0x31, 0x7a, 0x51, 0xff, 	/*Color of index 204*/
-  0x45, 0x74, 0x55, 0xff, 	/*Color of index 205*/
-  0x48, 0x74, 0x4b, 0xff, 	/*Color of index 206*/
-  0x5a, 0x6c, 0x5d, 0xff, 	/*Color of index 207*/
-  0x38, 0x73, 0x4d, 0xff, 	/*Color of index 208*/
-  0x45, 0x72, 0x44, 0xff, 	/*Color of index 209*/
-  0x4f, 0x6d, 0x4e, 0xff, 	/*Color of index 210*/
-  0x2d, 0x6f, 0x49, 0xff, 	/*Color of index 211*/
-  0x4c, 0x66, 0x54, 0xff, 	/*Color of index 212*/
-  0x3a, 0x6d, 0x42, 0xff, 	/*Color of index 213*/
-  0x47, 0x68, 0x48, 0xff, 	/*Color of index 214*/
-  0x44, 0x6a, 0x40, 0xff, 	/*Color of index 215*/
-  0x38, 0x66, 0x4e, 0xff, 	/*Color of index 216*/
-  0x2b, 0x68, 0x40, 0xff, 	/*Color of index 217*/
-  0x39, 0x63, 0x44, 0xff, 	/*Color of index 218*/
-  0x4b, 0x5b, 0x4e, 0xff, 	/*Color of index 219*/
-  0x3a, 0x61, 0x38, 0xff, 	/*Color of index 220*/
-  0x27, 0x62, 0x39, 0xff, 	/*Color of index 221*/
-  0x45, 0x59, 0x43, 0xff, 	/*Color of index 222*/
-  0x30, 0x5b, 0x34, 0xff, 	/*Color of index 223*/
-  0x3b, 0x55, 0x42, 0xff, 	/*Color of index 224*/
-  0x1f, 0x57, 0x33, 0xff, 	/*Color of index 225*/
-  0x32, 0x52, 0x35, 0xff, 	/*Color of index 226*/
-  0x31, 0x4c, 0x35, 0xff, 	/*Color of index 227*/
-  0x1f, 0x50, 0x2a, 0xff, 	/*Color of index 228*/
-  0x15, 0x4b, 0x25, 0xff, 	/*Color of index 229*/
-  0x20, 0x4a, 0x22, 0xff, 	/*Color of index 230*/
-  0x29, 0x46, 0x27, 0xff, 	/*Color of index 231*/
-  0x2f, 0x40, 0x32, 0xff, 	/*Color of index 232*/
-  0x0a, 0x46, 0x24, 0xff, 	/*Color of index 233*/
-  0x20, 0x42, 0x25, 0xff, 	/*Color of index 234*/
-  0x1d, 0x42, 0x1c, 0xff, 	/*Color of index 235*/
-  0x0d, 0x42, 0x1b, 0xff, 	/*Color of index 236*/
-  0x17, 0x38, 0x25, 0xff, 	/*Color of index 237*/
-  0x09, 0x3b, 0x13, 0xff, 	/*Color of index 238*/
-  0x13, 0x39, 0x14, 0xff, 	/*Color of index 239*/
-  0x0c, 0x31, 0x16, 0xff, 	/*Color of index 240*/
-  0x05, 0x2f, 0x0a, 0xff, 	/*Color of index 241*/
-  0x17, 0x29, 0x18, 0xff, 	/*Color of index 242*/
-  0x06, 0x1c, 0x06, 0xff, 	/*Color of index 243*/
-  0x44, 0x62, 0x3e, 0xff, 	/*Color of index 244*/
-  0x3e, 0x5a, 0x3a, 0xff, 	/*Color of index 245*/
-  0x41, 0x5a, 0x31, 0xff, 	/*Color of index 246*/
-  0x39, 0x56, 0x33, 0xff, 	/*Color of index 247*/
-  0x2f, 0x52, 0x2b, 0xff, 	/*Color of index 248*/
-  0x3a, 0x48, 0x37, 0xff, 	/*Color of index 249*/
-  0x31, 0x4a, 0x2a, 0xff, 	/*Color of index 250*/
-  0x2c, 0x39, 0x2a, 0xff, 	/*Color of index 251*/
-  0x1e, 0x39, 0x1a, 0xff, 	/*Color of index 252*/
-  0x24, 0x32, 0x22, 0xff, 	/*Color of index 253*/
-  0xfa, 0xfa, 0xf7, 0xff, 	/*Color of index 254*/
-  0xfa, 0xf6, 0xfa, 0xff, 	/*Color of index 255*/
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x81, 0x00, 0x00, 0x81, 0xff, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x5a, 0x81, 0x00, 0x5a, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x84, 0x00, 0xff, 0x83, 0x00, 0x00, 0x00, 0x81, 0xff, 0x00, 0x00, 0x86, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x84, 0x00, 0x00, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x83, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x83, 0xff, 0x00, 0x00, 0x00, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0xfe, 0x81, 0xfe, 0x00, 0x00, 0x00, 0x83, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x83, 0x81, 0x00, 0x5a, 0x81, 0xfe, 0x00, 0x81, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0x00, 0x00, 0xfe, 0x81, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0x00, 0x84, 0x00, 0x81, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0xfe, 0x83, 0x00, 0xff, 0x00, 0xfe, 0xff, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x83, 0x81, 0x00, 0x83, 0x80, 0x00, 0x80, 0x00, 0x00, 0x5a, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0xfe, 0x5a, 0x00, 0x86, 0x00, 0x00, 0x84, 0x80, 0x00, 0x82, 0x84, 0x80, 0x00, 0x84, 0x00, 0x5a, 0x80, 0x80, 0x5a, 0x00, 0x80, 0x80, 0x80, 0x5a, 0x5a, 0x80, 0x00, 0x82, 0x00, 0x5a, 0xfe, 0x7e, 0x5a, 0x7e, 0x00, 0x5a, 0x00, 0x00, 0x81, 0x83, 0x5a, 0x5a, 0x81, 0x00, 0x00, 0x00, 0x00, 0x80, 0x81, 0x7e, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0xfe, 0x00, 0x5a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0x00, 0x80, 0x5a, 0x80, 0x7f, 0x00, 0x5a, 0x86, 0x90, 0xc8, 0xbd, 0x8a, 0x5a, 0x7e, 0x5a, 0x82, 0x7e, 0x00, 0x89, 0xbd, 0x79, 0xe8, 0xfb, 0x8b, 0x5a, 0x7e, 0x7e, 0x00, 0x80, 0x87, 0xcf, 0xe0, 0x79, 0xd4, 0x89, 0x7e, 0x80, 0x7e, 0x5a, 0x7e, 0x82, 0x8a, 0x89, 0x87, 0x5a, 0x7f, 0x5a, 0x81, 0x80, 0x5a, 0x00, 0x00, 0x5a, 0x5a, 0x83, 0x5a, 0x00, 0x80, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x84, 0x00, 0x00, 0xff, 0x81, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0x5a, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x81, 0x00, 0x00, 0x83, 0x00, 0x00, 0x86, 0x9e, 0x90, 0x82, 0x5a, 0x5a, 0x7f, 0x00, 0x82, 0x90, 0xe8, 0xfd, 0xe8, 0xfd, 0xfd, 0x89, 0x00, 0x82, 0x00, 0x86, 0xbd, 0xfd, 0xfd, 0xe0, 0xdb, 0xe8, 0xdb, 0x5a, 0x86, 0x7e, 0x84, 0xaf, 0xf2, 0xe8, 0xdb, 0xf9, 0xfb, 0x79, 0x84, 0x82, 0x5a, 0x7e, 0x90, 0xe0, 0x7d, 0xfd, 0xfb, 0x8b, 0x7e, 0x80, 0x7e, 0x5a, 0x7e, 0x87, 0x90, 0x9e, 0x8b, 0x80, 0x00, 0x7e, 0x7e, 0x00, 0x7e, 0x86, 0x89, 0x86, 0xfe, 0x00, 0xff, 0xfe, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x81, 0x9e, 0xfb, 0xfb, 0xf3, 0xaf, 0x7e, 0x7e, 0x5a, 0x82, 0xaa, 0xf2, 0x79, 0xdb, 0xdb, 0xcf, 0xfb, 0x9e, 0x7e, 0x7e, 0x89, 0xdb, 0xfd, 0xdb, 0xcf, 0xdb, 0xdb, 0x79, 0xf9, 0x7e, 0x5a, 0x87, 0xe0, 0xf2, 0xd4, 0xdb, 0xd4, 0xd4, 0xc8, 0xfb, 0x8b, 0x7e, 0x7e, 0xcf, 0xe8, 0xfb, 0xde, 0xcf, 0xf9, 0x79, 0x82, 0x7e, 0x00, 0x89, 0xcf, 0xfd, 0xfb, 0xfb, 0xf3, 0xe0, 0x89, 0x7e, 0x00, 0x8a, 0xcf, 0xfd, 0xfb, 0xe8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0xff, 0x81, 0xfe, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x86, 0x90, 0xaf, 0x89, 0x00, 0x80, 0x81, 0x5a, 0xaf, 0x58, 0xdb, 0xcf, 0xe8, 0x79, 0x7e, 0x7f, 0x7e, 0xb4, 0x7d, 0xd4, 0xd4, 0xdb, 0xdb, 0xcf, 0xed, 0x96, 0x7e, 0x66, 0xe0, 0xfd, 0xe0, 0xd4, 0xe0, 0xe0, 0xde, 0xed, 0xbd, 0x89, 0x8a, 0xe0, 0xf2, 0xdb, 0xe0, 0xde, 0xde, 0xe0, 0xdb, 0xed, 0x90, 0x7e, 0xd2, 0xfd, 0xe0, 0xcf, 0xd4, 0xdb, 0xf4, 0xf2, 0x7f, 0x7e, 0x9e, 0xfb, 0xe8, 0xd4, 0xcf, 0xd4, 0xcf, 0xfd, 0x86, 0x7e, 0xaa, 0xe8, 0xe8, 0x79, 0xcf, 0xe8, 0x79, 0x82, 0x84, 0x80, 0x86, 0x89, 0x86, 0x89, 0x8b, 0x8b, 0x8a, 0x86, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0x00, 0x7e, 0x00, 0x8b, 0xfd, 0xfd, 0xfd, 0xfb, 0x84, 0x80, 0x7e, 0x9e, 0xf3, 0xdb, 0xdb, 0xd4, 0xfb, 0xd2, 0x7f, 0x7e, 0xc0, 0xfd, 0xe2, 0xfa, 0xe3, 0xe2, 0xea, 0xea, 0xfc, 0xe2, 0xde, 0xec, 0xfc, 0xec, 0xe6, 0xea, 0xe6, 0xe7, 0xea, 0xe7, 0xea, 0xea, 0xeb, 0xea, 0xeb, 0xea, 0xeb, 0xe7, 0xeb, 0xeb, 0xef, 0xea, 0xe6, 0xeb, 0xef, 0xe6, 0xef, 0xeb, 0xeb, 0xeb, 0xef, 0xf8, 0xd2, 0xf4, 0xe8, 0xf2, 0xf9, 0xf9, 0xe8, 0xfb, 0xe3, 0xf2, 0xc0, 0xc8, 0xf2, 0xfd, 0xe7, 0xfb, 0xfc, 0xfc, 0xeb, 0xfa, 0xf8, 0xfa, 0xea, 0xfc, 0xea, 0xfd, 0xf2, 0xfb, 0x58, 0xcf, 0x7e, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x81, 0x00, 0x5a, 0x5a, 0x5a, 0x80, 0x5a, 0x90, 0xf2, 0xdb, 0xf9, 0xcf, 0xfb, 0x89, 0x7e, 0x90, 0xf3, 0xf9, 0xb4, 0xe2, 0xdb, 0xfa, 0xe7, 0xc8, 0xd6, 0xfc, 0xf1, 0xea, 0xe5, 0xe4, 0xdf, 0xdc, 0xda, 0xd5, 0xcd, 0xc7, 0xc3, 0xc3, 0xbf, 0xbf, 0xb7, 0xbf, 0xbf, 0xbf, 0xbf, 0xc0, 0xbf, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xc7, 0xc7, 0xce, 0xce, 0xca, 0xc7, 0xc7, 0xd1, 0xd7, 0xd7, 0xdc, 0xd1, 0xdc, 0xdf, 0xdf, 0xd7, 0xf4, 0xe3, 0xfa, 0xe2, 0xe2, 0xf8, 0xfa, 0xe2, 0xe3, 0xf5, 0xfa, 0xe2, 0xf4, 0xf7, 0xfa, 0xd2, 0xf6, 0xd7, 0xd7, 0xf6, 0xf6, 0xf4, 0xd2, 0xf5, 0xcf, 0xc8, 0xde, 0xfb, 0x90, 0xfe, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x81, 0x00, 0x00, 0x5a, 0x80, 0x5a, 0x00, 0xfe, 0x8a, 0xfd, 0x79, 0xdb, 0xdb, 0xf9, 0xea, 0x87, 0x85, 0xf4, 0xe3, 0xd6, 0xf3, 0xea, 0xf1, 0xe7, 0xe2, 0xdc, 0xd6, 0xcd, 0xb0, 0xb0, 0x6d, 0xa8, 0x6d, 0xa8, 0xa6, 0xa8, 0xad, 0xb6, 0xb0, 0xb0, 0xad, 0xb0, 0xb2, 0xb0, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb9, 0xb7, 0xbf, 0xb7, 0xb9, 0xbf, 0xbf, 0xbf, 0xc3, 0xc0, 0xbf, 0xbf, 0xc7, 0xbf, 0xc2, 0xc7, 0xc2, 0xc2, 0xca, 0xce, 0xd2, 0xca, 0xc0, 0xc0, 0xc7, 0xc7, 0xc7, 0xc7, 0xce, 0xc0, 0xcd, 0xce, 0xd2, 0xc0, 0xd2, 0xd6, 0xce, 0xca, 0xd7, 0xd7, 0xd2, 0xd7, 0xd6, 0xf4, 0xc8, 0xde, 0xf2, 0xe8, 0x9e, 0x5a, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x7e, 0x5a, 0x7e, 0x7e, 0x86, 0xe8, 0xe8, 0xdb, 0xe0, 0xdb, 0xdb, 0xed, 0xd6, 0xed, 0xf3, 0xef, 0x7a, 0xe4, 0xc0, 0x6d, 0xb0, 0xa6, 0xb4, 0xa6, 0xb0, 0xa1, 0xb7, 0xa8, 0xad, 0xb6, 0xb2, 0xb6, 0xb2, 0xb6, 0xb6, 0xb8, 0xb6, 0xb6, 0xb6, 0xb6, 0xb9, 0xb9, 0xbf, 0xb9, 0xbf, 0xbf, 0xbf, 0xc3, 0xc3, 0xc2, 0xc3, 0xbf, 0xc3, 0xbf, 0xc6, 0xc7, 0xc6, 0xc7, 0xc6, 0xbf, 0xc2, 0xc7, 0xca, 0xc7, 0xbf, 0xc2, 0xc6, 0xd7, 0xca, 0xc5, 0xd1, 0xd1, 0xd1, 0xd1, 0xd7, 0xd7, 0xd1, 0xca, 0xd7, 0xdc, 0xd1, 0xce, 0xf4, 0xd7, 0xce, 0xd2, 0xd7, 0xd2, 0xc7, 0xd4, 0xea, 0xfd, 0xc8, 0x87, 0x00, 0x7e, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7e, 0x83, 0x84, 0x86, 0x5a, 0x7e, 0x00, 0x7e, 0xcf, 0xf2, 0xde, 0xdb, 0xdb, 0xe3, 0xed, 0xf1, 0xf0, 0xe4, 0xbb, 0xb7, 0xac, 0x8c, 0xb6, 0xad, 0xb0, 0xb7, 0xb6, 0xa1, 0xb6, 0xa6, 0xa8, 0xac, 0xab, 0xb1, 0xb1, 0xb1, 0xac, 0xa9, 0xa7, 0xb6, 0xb2, 0xb2, 0xb2, 0xb6, 0xb2, 0xb6, 0xb5, 0xb6, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0xbf, 0xb9, 0xc3, 0xbf, 0xb9, 0xbf, 0xc3, 0xc3, 0xc3, 0xbf, 0xc6, 0xc3, 0xc6, 0xce, 0xce, 0xca, 0xc9, 0xca, 0xc5, 0xc5, 0xcb, 0xc5, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd1, 0xca, 0xca, 0xd1, 0xd1, 0xca, 0xce, 0xd7, 0xf4, 0xd7, 0xc8, 0xf6, 0xf2, 0xfc, 0xd4, 0x8a, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xbd, 0xe8, 0xf2, 0x89, 0x85, 0x90, 0xc8, 0xfd, 0xcf, 0xe0, 0xe8, 0xf0, 0xe7, 0xe0, 0xcd, 0xb0, 0x9f, 0xa8, 0xa1, 0xa4, 0xac, 0xb3, 0xb0, 0xac, 0xa8, 0xa6, 0xa3, 0xbb, 0xae, 0xb3, 0xac, 0xab, 0xab, 0xae, 0xb5, 0xba, 0xba, 0xba, 0xb8, 0xb8, 0xb9, 0xb8, 0xb8, 0xb8, 0xb5, 0xb6, 0xba, 0xba, 0xbc, 0xbe, 0xc1, 0xbe, 0xbc, 0xbe, 0xc1, 0xc6, 0xc6, 0xc1, 0xc6, 0xc6, 0xcb, 0xc6, 0xca, 0xc6, 0xc2, 0xc6, 0xca, 0xc9, 0xca, 0xcb, 0xc5, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd1, 0xcb, 0xc5, 0xd7, 0xd7, 0xd1, 0xd1, 0xd7, 0xd7, 0xf4, 0xc7, 0xd2, 0xf5, 0xfc, 0xea, 0xc8, 0x89, 0x7e, 0x00, 0x7e, 0x80, 0x5a, 0x00, 0x81, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xde, 0x7d, 0xe2, 0xfb, 0xfc, 0xe8, 0xfc, 0xf3, 0xe3, 0xf0, 0xe7, 0xfa, 0xd2, 0xc7, 0x9f, 0x9f, 0xad, 0x97, 0xa4, 0xac, 0xab, 0x9c, 0xa4, 0xa4, 0xa6, 0xb6, 0xab, 0xac, 0xae, 0xa7, 0xa4, 0xb3, 0xae, 0xae, 0xab, 0xab, 0xab, 0xae, 0xab, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb2, 0xba, 0xb8, 0xba, 0xba, 0xba, 0xbc, 0xbe, 0xbc, 0xba, 0xc1, 0xc1, 0xbc, 0xbc, 0xc5, 0xc1, 0xc1, 0xc9, 0xcb, 0xc6, 0xc1, 0xc1, 0xca, 0xc6, 0xc5, 0xbc, 0xcb, 0xcb, 0xc5, 0xcb, 0xcb, 0xcb, 0xcb, 0xd1, 0xd1, 0xca, 0xd1, 0xd1, 0xc7, 0xca, 0xd6, 0xfc, 0xfd, 0xe3, 0x9e, 0x85, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x00, 0x00, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0xcf, 0xf2, 0xdb, 0xde, 0xe2, 0xfb, 0xb7, 0xde, 0xf0, 0xea, 0xf5, 0xd8, 0x6d, 0x9f, 0x97, 0xa6, 0x9f, 0xa1, 0xa6, 0xab, 0xa1, 0xb3, 0xa0, 0xbb, 0xdd, 0xe1, 0xe9, 0xc6, 0xae, 0xa7, 0xae, 0xae, 0xa9, 0xae, 0xb3, 0xb3, 0xb5, 0xb3, 0xb5, 0xb5, 0xae, 0xb2, 0xb2, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xba, 0xba, 0xba, 0xbc, 0xbc, 0xbc, 0xba, 0xbc, 0xba, 0xc5, 0xc5, 0xbc, 0xc1, 0xc5, 0xc5, 0xc5, 0xbc, 0xc5, 0xcb, 0xc5, 0xca, 0xcb, 0xce, 0xcb, 0xcb, 0xcb, 0xc5, 0xcb, 0xcb, 0xd1, 0xd1, 0xd1, 0xce, 0xc7, 0xca, 0xd6, 0xf6, 0xeb, 0xfc, 0xfa, 0xaa, 0x89, 0x7f, 0x7e, 0x7f, 0x7e, 0x5a, 0x7e, 0x00, 0xfe, 0x5a, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x7e, 0x00, 0x7e, 0x7e, 0x90, 0xf2, 0xde, 0xde, 0xe2, 0xe7, 0xe2, 0xf5, 0xf1, 0xe9, 0xc4, 0xa6, 0x99, 0x9f, 0x9f, 0xa8, 0x9f, 0xa1, 0x97, 0x9c, 0xa8, 0xa9, 0x99, 0xcc, 0xec, 0xe9, 0xee, 0xe9, 0xc1, 0x9c, 0xa3, 0xb1, 0xb3, 0xab, 0xae, 0xae, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb5, 0xba, 0xb5, 0xb2, 0xb1, 0xb1, 0xb5, 0xba, 0xb5, 0xba, 0xba, 0xbe, 0xbc, 0xbe, 0xbc, 0xba, 0xbc, 0xbc, 0xbc, 0xc5, 0xbc, 0xbc, 0xc1, 0xc5, 0xc5, 0xc1, 0xc1, 0xc5, 0xc5, 0xcb, 0xca, 0xc5, 0xca, 0xca, 0xd1, 0xca, 0xc7, 0xc7, 0xc7, 0xce, 0xf4, 0xe2, 0xea, 0xfc, 0xe0, 0xb4, 0x89, 0x82, 0x7e, 0x7e, 0x5a, 0x7e, 0x00, 0x7e, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x82, 0x00, 0x7e, 0x8a, 0xcf, 0x7d, 0xe7, 0xe3, 0xfa, 0xf5, 0xe2, 0xf3, 0xe5, 0xb7, 0xa3, 0x99, 0x93, 0xa1, 0xa9, 0xa1, 0x97, 0xa8, 0xa1, 0xb6, 0xac, 0x9c, 0xa8, 0xac, 0xbe, 0xe5, 0xdd, 0xd9, 0xb8, 0xac, 0xac, 0xb8, 0xb1, 0xa3, 0xae, 0xae, 0xae, 0xae, 0xb2, 0xb1, 0xb2, 0xb2, 0xb1, 0xb5, 0xb8, 0xba, 0xba, 0xb8, 0xb8, 0xb8, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbc, 0xba, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc5, 0xc5, 0xc5, 0xca, 0xca, 0xc5, 0xc7, 0xc2, 0xc2, 0xc7, 0xc0, 0xc7, 0xcd, 0xd6, 0xe2, 0xe7, 0xfb, 0xe7, 0xcf, 0x9e, 0x87, 0x7f, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0xfe, 0x00, 0x00, 0x7e, 0x84, 0x7e, 0x86, 0xcf, 0xe8, 0xf9, 0xf0, 0xde, 0xdf, 0xe3, 0xe9, 0xee, 0xd9, 0xa1, 0xa8, 0x98, 0xa5, 0x9c, 0x9b, 0xa8, 0x98, 0x97, 0xbe, 0xd9, 0xec, 0xd5, 0x99, 0xa3, 0xa8, 0x9c, 0xb8, 0xbe, 0xa8, 0xa1, 0xa8, 0xb1, 0xac, 0xa9, 0xa9, 0xac, 0xac, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb5, 0xb8, 0xb8, 0xb5, 0xb5, 0xb5, 0xb2, 0xb8, 0xb8, 0xba, 0xba, 0xbe, 0xbc, 0xbe, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc2, 0xc5, 0xc5, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xca, 0xd2, 0xd6, 0xe0, 0xe8, 0xfc, 0xfb, 0xd4, 0x9e, 0x8a, 0x7f, 0x7e, 0x7e, 0x00, 0x7e, 0xfe, 0xfe, 0xfe, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x81, 0x00, 0x00, 0xfe, 0xfe, 0x7e, 0x7e, 0x90, 0xea, 0xde, 0x9f, 0xe3, 0xfa, 0xf7, 0xdf, 0xec, 0xe5, 0xb0, 0x99, 0x9f, 0x93, 0x9b, 0xa7, 0xa5, 0x98, 0x9c, 0xae, 0xd0, 0xe4, 0xe9, 0xec, 0xd0, 0xa1, 0xa6, 0xac, 0xa1, 0xa3, 0xa6, 0xa1, 0xa8, 0xb2, 0xac, 0xa1, 0xa7, 0xba, 0xab, 0xac, 0xae, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb5, 0xb3, 0xb5, 0xb1, 0xb2, 0xb8, 0xba, 0xb8, 0xb9, 0xb9, 0xbe, 0xbf, 0xb9, 0xb9, 0xb6, 0xb9, 0xbc, 0xc2, 0xc2, 0xc2, 0xbf, 0xb9, 0xc0, 0xb7, 0xc0, 0xc7, 0xd2, 0xf4, 0xf7, 0xe7, 0xea, 0xe8, 0xcf, 0x9e, 0x89, 0x84, 0x7f, 0x00, 0x7e, 0xfe, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x7e, 0x84, 0xde, 0xe7, 0xbd, 0xb0, 0x9e, 0xf7, 0xeb, 0x7a, 0xee, 0xd2, 0x99, 0x99, 0x9c, 0x9a, 0xa7, 0x9b, 0x9b, 0xa5, 0x9d, 0x9a, 0xd0, 0xe9, 0xe5, 0xe5, 0xd0, 0xac, 0xa6, 0xa7, 0xa8, 0xac, 0xa8, 0xac, 0xa8, 0xa8, 0xad, 0xb1, 0xac, 0xac, 0xab, 0xac, 0xac, 0xb1, 0xac, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb5, 0xb8, 0xb8, 0xba, 0xbe, 0xc3, 0xb6, 0xb9, 0xb9, 0xbf, 0xc3, 0xc7, 0xc7, 0xc7, 0xc7, 0xb7, 0xb7, 0xb0, 0xb7, 0xc7, 0xd6, 0xf4, 0xe7, 0xe7, 0xea, 0xe3, 0xdb, 0xb4, 0x8b, 0x87, 0x80, 0x5a, 0x00, 0x00, 0x5a, 0x00, 0x80, 0x81, 0x00, 0x00, 0xfe, 0x81, 0x81, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x83, 0x00, 0x00, 0x8a, 0xe3, 0xf5, 0x6d, 0x9f, 0xb4, 0xbf, 0xea, 0xee, 0xe4, 0xad, 0x8d, 0xa1, 0x9c, 0x97, 0xa7, 0x9b, 0xa4, 0x98, 0xa7, 0xa4, 0x99, 0xd9, 0xee, 0xe1, 0xdd, 0xa8, 0x99, 0xad, 0xa1, 0x9c, 0xa9, 0xa4, 0xad, 0xa8, 0xa8, 0xa8, 0xab, 0xb1, 0xac, 0xa7, 0xac, 0xab, 0xac, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb1, 0xb8, 0xb8, 0xbb, 0xb8, 0xb2, 0xad, 0xad, 0xb9, 0xb7, 0xb0, 0xb0, 0xb0, 0xb0, 0xb7, 0xc0, 0xc0, 0xd6, 0xe2, 0xfc, 0xed, 0xea, 0xe0, 0xdb, 0xaa, 0x90, 0x89, 0x82, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x5a, 0x81, 0x81, 0x81, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xfe, 0x00, 0x00, 0x8b, 0xfb, 0xdb, 0xb0, 0x9f, 0xb7, 0x96, 0xc7, 0xee, 0xdc, 0x99, 0xa8, 0x92, 0x91, 0xa4, 0xa0, 0xa0, 0x95, 0xa0, 0x93, 0x9c, 0x9c, 0x9a, 0xcc, 0xe1, 0xd9, 0xac, 0x9f, 0x99, 0xa7, 0xa7, 0xa4, 0xab, 0xac, 0xa4, 0xa8, 0xae, 0xa8, 0xa7, 0xa8, 0xab, 0xae, 0xab, 0xae, 0xac, 0xb1, 0xac, 0xb1, 0xb2, 0xac, 0xb8, 0xb8, 0xb6, 0xb3, 0xb0, 0xb2, 0xb6, 0xb6, 0xb0, 0xb7, 0xca, 0xda, 0xdf, 0xe6, 0xe7, 0xe7, 0xea, 0x77, 0xbd, 0x96, 0x61, 0x85, 0x82, 0x7e, 0x7e, 0x5a, 0x00, 0x00, 0x7e, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x80, 0x5a, 0x00, 0x9e, 0x7d, 0xfd, 0xea, 0xeb, 0xc0, 0x9f, 0xc7, 0xec, 0xd9, 0x92, 0x92, 0xa8, 0x9c, 0x99, 0x99, 0x9c, 0xb8, 0xa5, 0x9c, 0xa0, 0xa3, 0xa3, 0x9c, 0xa1, 0x99, 0x97, 0x99, 0xad, 0xb1, 0xa6, 0xa7, 0xa7, 0x6c, 0xa5, 0xa8, 0xa7, 0xa6, 0xae, 0xae, 0xa9, 0xa9, 0xb1, 0xab, 0xab, 0xac, 0xae, 0xb1, 0xb2, 0xac, 0xb2, 0xb6, 0xad, 0xad, 0x6d, 0xb6, 0xc3, 0xd8, 0xdc, 0xe7, 0xe7, 0xfa, 0xf5, 0xc8, 0x9f, 0x8a, 0x88, 0x7f, 0x7e, 0x7e, 0x5a, 0x7e, 0x5a, 0x7e, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x5a, 0x7e, 0x5a, 0x7e, 0xaa, 0xf2, 0xf9, 0xfd, 0xe2, 0xf1, 0xf5, 0xc7, 0xee, 0xc9, 0x93, 0x9c, 0x91, 0xa3, 0x99, 0x8d, 0xa1, 0xe4, 0xf1, 0xc6, 0x9c, 0x9b, 0x9c, 0x9c, 0x9c, 0xa3, 0xa3, 0xa6, 0xa1, 0xa7, 0xa6, 0xa3, 0xa7, 0xa9, 0xa9, 0xa4, 0xab, 0xa7, 0xa7, 0xab, 0xac, 0xa9, 0xa7, 0xab, 0xa9, 0xac, 0xac, 0xb2, 0xad, 0xad, 0xa8, 0x6d, 0x6d, 0x6f, 0xd8, 0x7a, 0xe8, 0xe3, 0xd4, 0xbd, 0x66, 0x89, 0x84, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x5a, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x82, 0x6b, 0xfb, 0xc8, 0xf2, 0xf9, 0xfc, 0xde, 0xfc, 0xee, 0xc4, 0x98, 0xa0, 0x8e, 0xa0, 0x91, 0x99, 0xb2, 0xdd, 0xe4, 0xec, 0xc3, 0x9c, 0x9c, 0x9b, 0xa0, 0xa0, 0xa3, 0xa3, 0xa3, 0xa3, 0xa6, 0xa7, 0xa3, 0xa1, 0xa4, 0xa7, 0xa4, 0xab, 0xa7, 0xa7, 0xa9, 0xae, 0xa9, 0xac, 0xb2, 0xb6, 0xb2, 0xad, 0x6d, 0xa8, 0xb7, 0xd8, 0xe4, 0xfd, 0x79, 0xc8, 0x9e, 0x8a, 0x85, 0x7e, 0x7e, 0x80, 0x7e, 0x7e, 0x00, 0x7e, 0xfe, 0x80, 0x80, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x5a, 0x82, 0x8a, 0xf2, 0xb4, 0xde, 0xfd, 0xe3, 0xe3, 0xe7, 0xf1, 0xe5, 0x99, 0x8f, 0x9c, 0x67, 0xa0, 0x91, 0x9a, 0xc9, 0xe5, 0xec, 0xe4, 0xa8, 0x9c, 0xa0, 0x9c, 0xa0, 0x9c, 0xa0, 0x9c, 0xa3, 0x9d, 0xa7, 0xa7, 0xa3, 0xa0, 0xa1, 0xa7, 0xa7, 0xae, 0xa7, 0xa0, 0xa3, 0xa7, 0xa9, 0xa8, 0xad, 0x9f, 0xa6, 0xb0, 0xd8, 0xe7, 0x7a, 0xd2, 0x6d, 0x87, 0x85, 0x7f, 0x5b, 0x5a, 0x5a, 0x7e, 0x7e, 0x5a, 0x00, 0x7e, 0xfe, 0x5a, 0x7e, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0xfe, 0x7e, 0x7e, 0x89, 0xed, 0xc0, 0x9e, 0xf5, 0xfd, 0xf7, 0xe3, 0xf1, 0xfc, 0xa8, 0x99, 0x9b, 0x67, 0xa2, 0x93, 0x6a, 0x99, 0xe4, 0xe5, 0xec, 0xc9, 0x97, 0x9c, 0xa0, 0x9c, 0xa0, 0xa0, 0xa0, 0xa0, 0x9d, 0xa0, 0xa3, 0xa4, 0xa4, 0xa7, 0xa7, 0xa9, 0xa8, 0x9b, 0xa9, 0xb8, 0xbb, 0xa8, 0xa6, 0xa8, 0xb7, 0xda, 0xe3, 0x7a, 0xd6, 0x96, 0x87, 0x7e, 0x7e, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x7e, 0xfe, 0x80, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0x7e, 0x84, 0xe7, 0xd4, 0x6d, 0x6d, 0xfa, 0xfa, 0xe7, 0xfc, 0xea, 0xdd, 0x99, 0x9c, 0x8e, 0x68, 0x9b, 0x98, 0x93, 0xa0, 0xee, 0xec, 0xdd, 0xa6, 0xa1, 0x6c, 0xa3, 0x9c, 0xa0, 0xa0, 0x9d, 0x9d, 0x9d, 0xa2, 0x9d, 0xa0, 0xa4, 0xa7, 0xa9, 0xa6, 0xa3, 0xac, 0xa9, 0xa6, 0x9c, 0x6d, 0xc3, 0x77, 0x7a, 0xd4, 0x96, 0x85, 0x5a, 0x7e, 0x00, 0x7e, 0x5a, 0x7e, 0x7e, 0x5a, 0x7e, 0x5a, 0x7e, 0x5a, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x81, 0x5a, 0x7e, 0xcf, 0xe2, 0xb4, 0xb0, 0xc0, 0xd6, 0xf0, 0xeb, 0xda, 0xe1, 0xcd, 0x92, 0x93, 0x8f, 0xa2, 0x68, 0x98, 0x95, 0xa3, 0xcc, 0xd9, 0xa7, 0xa1, 0x99, 0xa1, 0x9c, 0x6c, 0xa0, 0xa0, 0xa2, 0xa2, 0x9d, 0xa5, 0x9d, 0x9d, 0xa4, 0xa7, 0xa6, 0xa3, 0xa1, 0xa8, 0x6c, 0x6d, 0xd3, 0xea, 0xe2, 0x6d, 0x85, 0x7e, 0x5a, 0x5a, 0x7e, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x7e, 0x96, 0xfd, 0x6d, 0xb7, 0xb7, 0xad, 0xda, 0xf1, 0xe2, 0xb0, 0xe9, 0xad, 0x8d, 0x93, 0xa2, 0xa2, 0x6a, 0x95, 0x9b, 0x9c, 0x8d, 0x9c, 0x92, 0xa7, 0x99, 0x9c, 0x6c, 0x9c, 0x9c, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x9d, 0xa5, 0xa7, 0xa3, 0xa1, 0xa8, 0xb0, 0xa6, 0xda, 0xea, 0xd8, 0x66, 0x7f, 0x5a, 0x7e, 0x5a, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x84, 0x00, 0x5a, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5a, 0x5a, 0x87, 0xed, 0xc0, 0xb4, 0xb7, 0xa6, 0xb0, 0xdd, 0xf1, 0xc9, 0xc0, 0xe5, 0x92, 0xa7, 0x8e, 0x6a, 0x68, 0x6a, 0x6a, 0x9c, 0x8f, 0x9a, 0xa3, 0x98, 0x99, 0x9c, 0x6c, 0x9c, 0x6c, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0x9d, 0xa2, 0xa7, 0xa9, 0xa1, 0xa6, 0xb0, 0x6f, 0xed, 0xc8, 0x8a, 0x7f, 0x5a, 0x7e, 0x7f, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x5a, 0x80, 0x7e, 0xd4, 0xda, 0xb4, 0xb7, 0xb0, 0xb9, 0xa6, 0xdd, 0xec, 0xa6, 0xd3, 0xdc, 0x65, 0x8d, 0xa4, 0x93, 0x6a, 0x98, 0x95, 0x9a, 0x9a, 0x91, 0x9a, 0x9c, 0x98, 0xa4, 0xa3, 0x97, 0x9c, 0xa4, 0x9b, 0x6a, 0xa2, 0xa5, 0xa5, 0x93, 0xa7, 0xad, 0x97, 0xb7, 0x7a, 0xf4, 0x87, 0x82, 0x5a, 0x7e, 0x80, 0x5a, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x5a, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x5a, 0x5a, 0x8a, 0xe2, 0xc0, 0xb4, 0xa6, 0xad, 0xa6, 0xa6, 0xdf, 0xd9, 0xa1, 0xd2, 0xe9, 0xd0, 0xbb, 0x8e, 0x99, 0x6a, 0x91, 0x95, 0x98, 0x9a, 0x9a, 0xa0, 0x9a, 0x93, 0x9a, 0x99, 0xab, 0x6a, 0x93, 0xa5, 0xa5, 0xa2, 0x98, 0xa7, 0xae, 0x99, 0x97, 0x77, 0xf0, 0x96, 0x7e, 0x82, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x82, 0x7e, 0xd8, 0xe0, 0xa6, 0xb0, 0xb0, 0xda, 0xd1, 0xd1, 0xe9, 0xb6, 0xa1, 0xd6, 0xee, 0xf0, 0xe4, 0x92, 0x99, 0x98, 0x98, 0x9c, 0x91, 0x91, 0x9c, 0x9a, 0x98, 0x98, 0x9b, 0x6a, 0xa7, 0x98, 0x9c, 0x9c, 0x98, 0xa7, 0xa9, 0x6c, 0x97, 0xb7, 0x7c, 0xd2, 0x82, 0x5a, 0x7f, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0x8a, 0xed, 0xc0, 0x6d, 0xad, 0xd1, 0xf1, 0xec, 0xee, 0xe4, 0xa1, 0x9f, 0xda, 0xfc, 0xec, 0xee, 0xb1, 0x97, 0x91, 0xb1, 0xd3, 0xa7, 0x8d, 0xa3, 0x91, 0x95, 0x9d, 0xa2, 0xa0, 0x91, 0xa0, 0xab, 0x98, 0x98, 0xa6, 0x6c, 0x97, 0xd2, 0x7c, 0x96, 0x5a, 0x7e, 0x82, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x5a, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x5a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0x00, 0x00, 0xfe, 0xff, 0x5a, 0x5a, 0x5a, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd2, 0x77, 0x9f, 0xb0, 0xb0, 0xe4, 0xee, 0xeb, 0xee, 0xd1, 0x9f, 0xa8, 0xd2, 0xef, 0xe0, 0xee, 0xd8, 0x92, 0x99, 0xd9, 0xee, 0xd0, 0x93, 0xa4, 0x93, 0x95, 0x9b, 0x6a, 0x9b, 0x68, 0xa5, 0xa0, 0x6c, 0xa8, 0x99, 0x97, 0x77, 0x7a, 0x88, 0x5a, 0x84, 0x5a, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x5a, 0xff, 0xfe, 0xff, 0x00, 0x5a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x5a, 0x00, 0x5a, 0x13, 0x7e, 0x13, 0x5a, 0x5a, 0x5a, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x89, 0xed, 0x6d, 0xbf, 0xb0, 0xb6, 0xeb, 0xf8, 0xe4, 0xef, 0xc6, 0xa6, 0xad, 0xb4, 0xf3, 0xf8, 0xea, 0xe1, 0x92, 0xa1, 0xe9, 0xf1, 0xdd, 0x91, 0xa6, 0x95, 0x9a, 0x9b, 0x94, 0xa2, 0xa2, 0x6a, 0x98, 0xac, 0x6c, 0x9f, 0xe0, 0x77, 0x84, 0x7e, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0x81, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x83, 0x80, 0x5b, 0x82, 0x13, 0x5a, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7e, 0xc8, 0x77, 0xc0, 0xe5, 0xb9, 0xad, 0xeb, 0xe6, 0xe6, 0xf1, 0xc0, 0xa6, 0xad, 0x6d, 0xfc, 0xea, 0xfa, 0xe4, 0x92, 0x9f, 0xec, 0xe9, 0xdd, 0x8d, 0x9c, 0x98, 0x9b, 0x9b, 0x6a, 0x9b, 0xa5, 0x8f, 0xa4, 0xa1, 0x99, 0xcd, 0xdf, 0x84, 0x84, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x84, 0x84, 0x81, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x83, 0x90, 0xcf, 0xbd, 0x61, 0x83, 0x00, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x83, 0x84, 0x86, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x81, 0x5a, 0x00, 0x86, 0x8b, 0xaf, 0xdb, 0x76, 0xe8, 0x79, 0xcf, 0xaf, 0x8b, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7e, 0x86, 0xfc, 0x6d, 0xe6, 0xf3, 0xca, 0xb0, 0xe6, 0xef, 0xf8, 0xeb, 0xad, 0x9f, 0xb0, 0xb0, 0xf5, 0xfc, 0xe5, 0xe6, 0x97, 0x92, 0xe5, 0xe9, 0xe4, 0x91, 0xa1, 0x95, 0x9b, 0x68, 0x9b, 0x94, 0xa5, 0x68, 0xa9, 0x92, 0x6f, 0xf0, 0x87, 0x7e, 0x5a, 0x5a, 0x81, 0x00, 0xff, 0x01, 0x00, 0x00, 0x5a, 0x5a, 0x13, 0x5a, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xdb, 0xfb, 0xfb, 0xe8, 0xbd, 0x8a, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x80, 0x79, 0xfd, 0xfd, 0xfb, 0xfd, 0xfb, 0xaa, 0x81, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x83, 0x86, 0x79, 0xfd, 0xf2, 0xdb, 0x8b, 0x83, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x00, 0x5a, 0x00, 0x83, 0x9e, 0xe8, 0xfb, 0xcf, 0xaf, 0x96, 0x90, 0x96, 0x90, 0xcf, 0x79, 0xbd, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x96, 0xe3, 0xc0, 0xeb, 0xee, 0xf6, 0xa6, 0xe7, 0xeb, 0xfc, 0xe4, 0xb6, 0xa1, 0xb6, 0x9f, 0xd6, 0xf1, 0xe4, 0xe9, 0x99, 0x8c, 0xd3, 0xf3, 0xd9, 0x92, 0x8f, 0xa5, 0x9b, 0x67, 0xa2, 0xa5, 0x94, 0x67, 0xab, 0xa6, 0x7a, 0x66, 0x5a, 0x13, 0x5a, 0x00, 0x5a, 0xff, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x00, 0x81, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0xfe, 0x89, 0xfd, 0xfb, 0x79, 0xdb, 0xe8, 0xfb, 0xfd, 0xdb, 0x89, 0x7e, 0x00, 0x84, 0x7e, 0x00, 0x9e, 0xf2, 0xde, 0xd4, 0xde, 0xde, 0xf9, 0xfb, 0xe3, 0x8b, 0x7e, 0x7e, 0x7e, 0x84, 0x7e, 0x00, 0xde, 0xfd, 0xdb, 0xd4, 0xfb, 0xf2, 0xdb, 0x8a, 0x00, 0x82, 0xfe, 0x00, 0x81, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x5a, 0x00, 0x00, 0xfe, 0x00, 0x5a, 0x81, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xff, 0x00, 0x81, 0x00, 0x5a, 0x5a, 0x7e, 0x7e, 0x5a, 0x5a, 0x5a, 0x80, 0x00, 0x7e, 0x5a, 0x00, 0x5a, 0x5a, 0x82, 0x84, 0x7e, 0x8a, 0x77, 0xf9, 0x6d, 0x8a, 0x6b, 0x97, 0x99, 0x92, 0x97, 0x65, 0x5e, 0x66, 0x71, 0xd4, 0x5b, 0x83, 0x83, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xcf, 0xf5, 0xc0, 0xf8, 0xef, 0xf6, 0xb0, 0xd2, 0xf1, 0xe7, 0xe4, 0xa8, 0xab, 0xac, 0xa6, 0xad, 0xe5, 0xf1, 0xe5, 0x99, 0x99, 0x97, 0xc9, 0xa8, 0xa7, 0xa7, 0x67, 0x69, 0xa5, 0x94, 0x94, 0xa2, 0xb3, 0x92, 0x6f, 0xd4, 0x82, 0x83, 0x5a, 0x00, 0x5a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x83, 0x8b, 0xaa, 0x9e, 0x89, 0x86, 0x00, 0x00, 0x00, 0xfe, 0x80, 0xfe, 0x00, 0xfe, 0x7e, 0xaf, 0xfd, 0xde, 0xde, 0xde, 0xe0, 0xde, 0xdb, 0xe8, 0xfb, 0xbd, 0x7f, 0x5a, 0x7e, 0x5a, 0x90, 0xfc, 0xf4, 0xf4, 0xe0, 0xf4, 0xe0, 0xfa, 0xe2, 0xf3, 0xc8, 0x89, 0x7e, 0x7e, 0x7e, 0x87, 0xfb, 0xc8, 0xe2, 0xe0, 0xc8, 0xd4, 0xfd, 0x79, 0xaa, 0x5a, 0x00, 0x84, 0x00, 0x00, 0x83, 0x00, 0x84, 0x9e, 0xcf, 0xbd, 0x87, 0x00, 0xfe, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfe, 0x00, 0x80, 0x00, 0x5a, 0x7e, 0x83, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x87, 0x9e, 0xcf, 0xdb, 0xd4, 0xe0, 0x76, 0xc8, 0x61, 0x82, 0x7e, 0x84, 0x96, 0xcf, 0xd4, 0xf9, 0x7a, 0xed, 0xed, 0xed, 0xe4, 0xd2, 0xbb, 0x9f, 0x65, 0x98, 0x98, 0x98, 0x99, 0x97, 0x64, 0x88, 0x73, 0xe0, 0x5b, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x83, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x86, 0xfc, 0xc8, 0xc2, 0xe6, 0xee, 0xf8, 0xb0, 0xb0, 0xf0, 0xec, 0xe4, 0xa6, 0xb8, 0xa1, 0xbf, 0x97, 0xc9, 0xf1, 0xe4, 0x8c, 0x9f, 0x92, 0x97, 0x92, 0x8d, 0x92, 0x99, 0x9b, 0x69, 0xa2, 0x94, 0xa5, 0x93, 0xa1, 0xed, 0x8a, 0x5a, 0x00, 0x84, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x81, 0xfe, 0xfe, 0x00, 0x00, 0x83, 0x00, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfb, 0xfd, 0xfd, 0xf2, 0xe8, 0xaa, 0x87, 0x80, 0x5a, 0x00, 0x5a, 0x7e, 0x7e, 0x7f, 0xde, 0xed, 0xf4, 0xe3, 0xea, 0xe8, 0xe3, 0xfa, 0xf9, 0xf0, 0x7d, 0xe0, 0xc8, 0xde, 0xe0, 0xea, 0xf0, 0xea, 0xeb, 0xef, 0xe9, 0xea, 0xee, 0xea, 0xed, 0xea, 0xea, 0xe3, 0xe2, 0xde, 0xdb, 0xf0, 0xea, 0x7a, 0xfa, 0x7a, 0xe0, 0x77, 0xe3, 0xfb, 0xc8, 0x82, 0x5a, 0x7e, 0x80, 0x5a, 0x81, 0xcf, 0x59, 0xdb, 0xfb, 0xfd, 0x9e, 0x00, 0x00, 0x83, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0xfe, 0x83, 0x00, 0x81, 0x81, 0x86, 0xdb, 0xe8, 0xe0, 0xda, 0xc8, 0x6f, 0xbd, 0xcf, 0xd8, 0xf2, 0xe0, 0x7a, 0xed, 0xfa, 0x77, 0xd2, 0xb4, 0xa6, 0x6d, 0x6d, 0xa8, 0xb7, 0xd3, 0xdd, 0xe1, 0xd3, 0xa7, 0x8e, 0x67, 0x92, 0x98, 0x8c, 0x65, 0x88, 0x76, 0xbd, 0x5a, 0x83, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x8b, 0xfd, 0xad, 0xb7, 0xf8, 0xee, 0xdc, 0xb6, 0xb0, 0xdf, 0xef, 0xe5, 0xb2, 0xb2, 0xa8, 0xb9, 0x9f, 0xb0, 0xe1, 0xe4, 0x92, 0x92, 0xc7, 0xdf, 0xdf, 0xb7, 0x97, 0xa1, 0x99, 0x67, 0x6a, 0x6a, 0xa7, 0x97, 0xcd, 0xda, 0x7e, 0x7e, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x83, 0x00, 0xfe, 0x89, 0x87, 0x86, 0x83, 0x7e, 0x00, 0x5a, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x8a, 0xf2, 0xfb, 0xe0, 0xf9, 0x79, 0x79, 0xfb, 0xfb, 0xbd, 0x8a, 0x85, 0x87, 0x8b, 0x9e, 0xaf, 0xf0, 0xee, 0x7a, 0xec, 0x7a, 0xdf, 0xe1, 0xe2, 0x77, 0xc0, 0xcd, 0xd2, 0xbb, 0x6f, 0xc0, 0x6d, 0xa6, 0x9f, 0xa1, 0x6d, 0x99, 0x97, 0x9f, 0x6c, 0x97, 0xa6, 0x6d, 0x6d, 0xb0, 0xb4, 0xc0, 0x6f, 0xda, 0xd8, 0xdd, 0x7a, 0xe6, 0x7a, 0xea, 0xf0, 0xf3, 0xc8, 0x85, 0x7e, 0x7f, 0x5a, 0x90, 0x7d, 0xbd, 0x79, 0xc8, 0xdb, 0xf3, 0xaf, 0x00, 0x82, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x80, 0x82, 0xfe, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0xff, 0x00, 0x00, 0x83, 0x86, 0x00, 0x83, 0x5a, 0x00, 0x5a, 0x5a, 0x9e, 0x7d, 0xde, 0xb4, 0x9f, 0x66, 0x92, 0x96, 0x92, 0x66, 0x96, 0x66, 0xad, 0xe3, 0xe5, 0xc0, 0x65, 0x64, 0x97, 0x6b, 0x8d, 0x8c, 0x8d, 0x92, 0x8d, 0x91, 0x9c, 0xc4, 0xbe, 0xbb, 0xa2, 0x8e, 0x99, 0x6d, 0x6c, 0x64, 0x89, 0x7c, 0x61, 0x5a, 0x5a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0xaa, 0xb6, 0xd5, 0xe4, 0xcb, 0xb2, 0xbf, 0xb7, 0xe4, 0xee, 0xb6, 0xa8, 0xad, 0xa8, 0xad, 0xad, 0xc3, 0xe1, 0xc6, 0xb7, 0xec, 0xef, 0xf1, 0xf0, 0xd7, 0x92, 0x92, 0xa8, 0x93, 0x9c, 0x98, 0xa6, 0xd9, 0x9e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xfe, 0x5a, 0x7e, 0x00, 0x00, 0x83, 0xaa, 0xfd, 0xfd, 0xe8, 0xf9, 0xc8, 0x8b, 0x82, 0x00, 0x7e, 0xfe, 0x7e, 0x00, 0x8b, 0xfd, 0xf9, 0xde, 0xe8, 0xf9, 0xe7, 0xf2, 0x7d, 0x7d, 0xf0, 0xea, 0xe3, 0xe3, 0xe2, 0xda, 0xbb, 0xbb, 0xb2, 0xac, 0xa1, 0x92, 0x99, 0x99, 0x97, 0x6c, 0x97, 0x8c, 0x97, 0x6b, 0x92, 0x99, 0xa1, 0x99, 0x99, 0x9c, 0x99, 0x99, 0x9a, 0x97, 0x97, 0x6c, 0x97, 0x99, 0x97, 0x97, 0x6c, 0x92, 0x8d, 0x97, 0x97, 0x92, 0xa6, 0xbb, 0x6f, 0xb7, 0xcd, 0xf0, 0xea, 0xe3, 0xc0, 0x90, 0xcd, 0xfd, 0xda, 0xdb, 0xd8, 0xd4, 0xdb, 0xf2, 0xc8, 0x7e, 0xfe, 0x7e, 0x00, 0x83, 0xfe, 0x00, 0xfe, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x81, 0x83, 0x5a, 0x00, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x84, 0x00, 0x5a, 0x80, 0x84, 0xcf, 0xf0, 0xb4, 0x8c, 0x8c, 0x9f, 0xa6, 0xad, 0xb0, 0xb0, 0x6d, 0x97, 0xa6, 0x97, 0x8c, 0xbb, 0xe9, 0xc9, 0x8d, 0xa6, 0x98, 0x9c, 0x9d, 0x98, 0x95, 0x9a, 0x95, 0x8e, 0x8f, 0x9b, 0xc4, 0xb3, 0x99, 0x68, 0x6c, 0x92, 0x6c, 0x88, 0x6b, 0x7a, 0x82, 0x5a, 0x13, 0x82, 0x00, 0x7e, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xe0, 0xde, 0xbf, 0xa8, 0xbc, 0xcb, 0xb2, 0xb2, 0xbf, 0xad, 0xc7, 0xf0, 0xc3, 0xa8, 0xad, 0xb0, 0xa8, 0xb6, 0xa1, 0xc6, 0xe4, 0xe5, 0xf1, 0xf8, 0xf8, 0xeb, 0xea, 0xce, 0x9f, 0x97, 0xa1, 0x9c, 0xa1, 0x92, 0xe2, 0x96, 0x7e, 0x7f, 0x87, 0x87, 0x86, 0x86, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x80, 0x7e, 0x9e, 0xf2, 0xfd, 0xf9, 0xfb, 0xe8, 0xfb, 0xfb, 0xf9, 0xaa, 0x87, 0x82, 0x89, 0x9e, 0xd6, 0xf1, 0xf2, 0xec, 0xe3, 0xe9, 0xe3, 0xc3, 0x6d, 0xb0, 0x6d, 0x96, 0x97, 0x6b, 0x97, 0x97, 0x92, 0x95, 0x99, 0x8f, 0x98, 0x9a, 0x9c, 0x99, 0x93, 0x99, 0xa4, 0xa4, 0x99, 0x98, 0x99, 0x6c, 0x9a, 0x6a, 0x98, 0x98, 0x9a, 0x9b, 0x6a, 0x6a, 0x6a, 0x9a, 0x98, 0x98, 0x6c, 0x98, 0x6c, 0x99, 0xa7, 0x9a, 0x99, 0x99, 0x98, 0x92, 0x8d, 0x92, 0x97, 0x97, 0x92, 0xb7, 0x77, 0x77, 0xe4, 0xed, 0xf0, 0xe1, 0xfa, 0xe2, 0xcd, 0xe0, 0xe8, 0x9e, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x80, 0x8b, 0x90, 0x8b, 0x86, 0x5a, 0x5a, 0x7e, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x81, 0x8a, 0xcf, 0xdb, 0x76, 0xc8, 0xe0, 0xda, 0x96, 0x92, 0xa6, 0xc7, 0xca, 0xc9, 0xcd, 0xcd, 0xd3, 0x73, 0xcd, 0x99, 0xad, 0xa1, 0x8d, 0xa3, 0xdd, 0xd9, 0x64, 0x8e, 0x93, 0x95, 0x8f, 0x67, 0x9b, 0x9d, 0x94, 0x9d, 0x8e, 0x8e, 0xa5, 0xa2, 0x8e, 0x8e, 0x6c, 0x97, 0x97, 0x5e, 0xd8, 0xaf, 0x5b, 0x7e, 0x5a, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfb, 0x6f, 0xc0, 0xb6, 0xb1, 0xb5, 0xb5, 0xb2, 0xb8, 0xb7, 0xa8, 0xe1, 0xdc, 0xa6, 0xad, 0xb8, 0xad, 0xac, 0xa1, 0xa6, 0xd0, 0xe4, 0xee, 0xeb, 0xea, 0xf8, 0xef, 0xf1, 0xce, 0x97, 0xa1, 0x92, 0xb6, 0x8c, 0xea, 0x66, 0x82, 0xc8, 0xfb, 0xfd, 0xfd, 0xfb, 0xc8, 0x8b, 0x86, 0x7f, 0x7e, 0x7e, 0x7e, 0xcf, 0xf3, 0xde, 0xde, 0xe8, 0xfa, 0xe7, 0xf2, 0xf1, 0xf2, 0xed, 0xe7, 0x7a, 0xe3, 0x77, 0xb7, 0xad, 0x6d, 0x9f, 0x92, 0x99, 0x9f, 0xa1, 0x9f, 0x99, 0x6c, 0xa1, 0xa6, 0x6c, 0x93, 0x9b, 0x9b, 0x9d, 0x8f, 0xa2, 0x9a, 0x9b, 0x95, 0xa5, 0x8e, 0x67, 0xa0, 0x8e, 0x8e, 0xa0, 0x6a, 0x95, 0x9a, 0x98, 0x95, 0x6a, 0x6a, 0x98, 0x68, 0x98, 0x68, 0x68, 0x68, 0x9b, 0x9b, 0x95, 0x9b, 0x8e, 0x6a, 0x9d, 0x98, 0x98, 0xa0, 0xa3, 0x99, 0x99, 0xa1, 0xa1, 0x92, 0x8d, 0x92, 0x9f, 0xa7, 0xad, 0xd9, 0xe4, 0xe9, 0xea, 0xea, 0xea, 0xf3, 0x89, 0x7f, 0x7f, 0x7e, 0x84, 0xbd, 0xe8, 0xf2, 0x7d, 0xde, 0x90, 0x82, 0x5a, 0x00, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xfe, 0x5a, 0x00, 0x00, 0x5a, 0x00, 0xfe, 0x84, 0x5a, 0x83, 0xcf, 0xfd, 0xfb, 0x79, 0x79, 0xf2, 0x77, 0x8c, 0x9f, 0xca, 0xd5, 0xc6, 0xd0, 0xe1, 0xec, 0x7b, 0x7a, 0x7a, 0xe9, 0x7a, 0xae, 0x97, 0xa4, 0x8d, 0xa2, 0xd3, 0xb3, 0x9d, 0x95, 0x94, 0x95, 0x94, 0x8f, 0x67, 0x95, 0x67, 0x9d, 0x94, 0x8f, 0x68, 0xa2, 0x9b, 0x8e, 0x6c, 0x97, 0x64, 0x64, 0x7c, 0xe2, 0xd8, 0xc0, 0x66, 0x88, 0x7f, 0x7e, 0x7e, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x5a, 0x5a, 0x7e, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xfd, 0xb4, 0xb0, 0xbe, 0xc1, 0xb3, 0xc1, 0xb3, 0xbe, 0xbe, 0xad, 0xb7, 0xee, 0xa6, 0xad, 0xa6, 0xb1, 0xa6, 0xb8, 0xab, 0x97, 0xb6, 0xd9, 0xef, 0xeb, 0xeb, 0xe7, 0xe6, 0xeb, 0xda, 0x92, 0xa1, 0x99, 0x6c, 0xf7, 0x92, 0xc8, 0x7d, 0xe8, 0xe8, 0xf9, 0xf9, 0xfd, 0xf1, 0xfb, 0xb4, 0x8a, 0x89, 0x8a, 0xe2, 0xf2, 0xea, 0xf1, 0xfc, 0xfa, 0xf7, 0xd6, 0x6f, 0xb7, 0x6d, 0xa6, 0x6b, 0x99, 0x97, 0x99, 0xa6, 0x97, 0xa4, 0xa1, 0x99, 0x9c, 0x99, 0x98, 0x9a, 0xa4, 0x9b, 0x93, 0x98, 0xa4, 0x95, 0x9b, 0xa2, 0x8e, 0x9d, 0x67, 0x67, 0x9d, 0x8f, 0xa5, 0x9b, 0x67, 0xa5, 0xa2, 0x95, 0x95, 0x95, 0x9b, 0x9d, 0x6a, 0x9b, 0x6a, 0x68, 0x6a, 0x6a, 0x9b, 0x9b, 0x68, 0xa2, 0xa2, 0x8e, 0x6a, 0x9d, 0x94, 0x67, 0x9b, 0x9b, 0x95, 0x93, 0x9a, 0x9a, 0x9c, 0x91, 0x9c, 0x9c, 0x98, 0xa4, 0x8e, 0x93, 0x98, 0x91, 0x6c, 0xc3, 0xd3, 0x77, 0xef, 0xea, 0x8a, 0x5e, 0x7e, 0x8a, 0x7d, 0xf9, 0xcf, 0xcf, 0xfd, 0xfb, 0x90, 0x80, 0x5a, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x5a, 0x89, 0x9e, 0xaf, 0x90, 0x87, 0x80, 0x5a, 0x5a, 0x82, 0xaf, 0xfd, 0xe8, 0xe0, 0x79, 0x7c, 0x77, 0x9f, 0x9f, 0xbc, 0xc9, 0xc6, 0xd3, 0xe4, 0x76, 0x6b, 0x5c, 0x5c, 0x88, 0x24, 0xdd, 0x7c, 0xcc, 0x97, 0x93, 0x8d, 0xa2, 0xc4, 0x67, 0x67, 0x68, 0x94, 0x68, 0x68, 0x68, 0x67, 0x67, 0x94, 0x95, 0x67, 0x9b, 0x67, 0x8e, 0x6a, 0x8f, 0x6c, 0x8e, 0x88, 0x6d, 0xf0, 0xd8, 0x77, 0xe1, 0xe4, 0xcd, 0x89, 0x7f, 0x5a, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x5a, 0x7e, 0x7e, 0x80, 0x82, 0x00, 0x5a, 0x5a, 0x5a, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x90, 0x7a, 0xb4, 0xb7, 0xbe, 0xab, 0xc5, 0xb3, 0xba, 0xbe, 0xb6, 0xb0, 0xdc, 0xf1, 0xd7, 0xa6, 0xa8, 0xa9, 0xab, 0xb1, 0xab, 0xa3, 0xa3, 0xad, 0xb9, 0xf8, 0xef, 0xef, 0xef, 0xef, 0xe9, 0xd5, 0x99, 0x92, 0x99, 0x6f, 0xfa, 0xfc, 0xfc, 0xe7, 0xf0, 0xfc, 0xeb, 0xfc, 0xef, 0xf0, 0xef, 0xef, 0xe9, 0xe5, 0xdf, 0xcd, 0xc9, 0xc0, 0xad, 0xa8, 0xa1, 0x9f, 0x99, 0x97, 0x6c, 0xa1, 0xa4, 0xa6, 0x99, 0xab, 0x9c, 0x9a, 0x9c, 0x9a, 0xa4, 0x9a, 0x9b, 0x9a, 0xa2, 0x6a, 0x68, 0x9b, 0xa2, 0x6a, 0x9b, 0x9a, 0x9b, 0x9a, 0x9b, 0x9b, 0x9a, 0x93, 0x94, 0x67, 0x9d, 0x94, 0x8f, 0xa0, 0x9d, 0x8f, 0x9a, 0x93, 0x93, 0x93, 0x9a, 0x98, 0x95, 0x6a, 0x67, 0x9b, 0x9b, 0x9b, 0x6a, 0x6a, 0x68, 0x94, 0x9b, 0x9b, 0x94, 0x9d, 0x9a, 0x95, 0x9a, 0x9a, 0x9c, 0x95, 0x93, 0x95, 0x9c, 0x9b, 0x9a, 0x98, 0x9b, 0x9b, 0x9a, 0x93, 0x91, 0x92, 0x9f, 0xa6, 0xd8, 0xe2, 0xe2, 0xd8, 0xde, 0xe3, 0xe3, 0xd4, 0xde, 0xc8, 0xe0, 0xf3, 0x8a, 0x00, 0x7e, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x5a, 0x00, 0xfe, 0x83, 0xc8, 0xf2, 0xfd, 0xfd, 0xfb, 0xfd, 0xcf, 0x8a, 0x5e, 0x9e, 0x7c, 0xf0, 0x7c, 0x77, 0xd8, 0x7b, 0x9f, 0x97, 0xba, 0xc6, 0xb2, 0xcc, 0x7c, 0x6d, 0x5c, 0x5c, 0x5c, 0x5c, 0x15, 0x5c, 0x15, 0x6d, 0x7b, 0x6f, 0x6c, 0x91, 0x65, 0xa5, 0x68, 0x95, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x95, 0x94, 0x95, 0x94, 0x68, 0x94, 0x68, 0x68, 0x68, 0x98, 0x6c, 0x64, 0x64, 0xe1, 0xd0, 0xb0, 0xab, 0xa3, 0xbb, 0xec, 0x92, 0x7f, 0x7e, 0x5a, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x5a, 0x5a, 0x7e, 0x87, 0xaa, 0xd4, 0xe0, 0x79, 0x7a, 0x79, 0xd4, 0xbd, 0x90, 0x86, 0x5a, 0x00, 0x80, 0x00, 0x5a, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xff, 0x00, 0xaa, 0xe8, 0xb4, 0xbb, 0xc6, 0xb5, 0xbe, 0xba, 0xbe, 0xa8, 0xb7, 0xe5, 0xeb, 0xf0, 0xf8, 0xad, 0xb2, 0xae, 0xab, 0xa4, 0xab, 0xb8, 0xb1, 0xa1, 0xa1, 0xa6, 0xb7, 0xca, 0xdf, 0xe5, 0xec, 0xec, 0xe4, 0xe1, 0xe5, 0xe9, 0xee, 0xed, 0xe7, 0xe7, 0xe2, 0xdf, 0xd8, 0xd0, 0xc3, 0xbf, 0xb0, 0xad, 0x9f, 0xa6, 0xa6, 0x99, 0x99, 0xa1, 0xa1, 0xa8, 0xa3, 0xa3, 0xa3, 0xa0, 0xa4, 0xa2, 0xa2, 0x9b, 0xa0, 0xa7, 0x9c, 0xa4, 0xab, 0xa0, 0xa0, 0xa2, 0xa2, 0x6a, 0x9b, 0xa5, 0x9b, 0x94, 0x68, 0x94, 0xa0, 0x93, 0x91, 0x9a, 0x93, 0x93, 0x95, 0xa9, 0xa4, 0x93, 0x9d, 0x9d, 0x9a, 0x95, 0x95, 0xa4, 0x93, 0xac, 0xbe, 0xb1, 0x9c, 0x99, 0x9a, 0xa3, 0xa4, 0x98, 0x67, 0x95, 0x95, 0x67, 0x95, 0xa2, 0x67, 0x9d, 0x9d, 0x93, 0x94, 0xa3, 0x9d, 0x91, 0x91, 0x9a, 0x9d, 0x9a, 0x95, 0x95, 0x6a, 0x6a, 0x94, 0x68, 0xa2, 0xa5, 0xa0, 0x91, 0x92, 0x6c, 0x65, 0x97, 0xb0, 0x6f, 0xda, 0x7a, 0xea, 0x7a, 0xf5, 0xe0, 0xda, 0xdb, 0xf9, 0x86, 0x7e, 0xfe, 0x00, 0x00, 0x83, 0xfe, 0x00, 0x5a, 0x5a, 0xfe, 0x7e, 0xbd, 0xfd, 0x79, 0xc8, 0xd4, 0xdb, 0xd4, 0x7d, 0xf0, 0xea, 0x7a, 0x77, 0x6d, 0x6b, 0x92, 0x6d, 0xbb, 0x6c, 0x97, 0xab, 0xc1, 0xc4, 0xe9, 0x6f, 0x5c, 0x15, 0x5c, 0x02, 0x33, 0x3b, 0x2d, 0x92, 0x61, 0x6d, 0xf2, 0xbb, 0x96, 0xb3, 0x65, 0x98, 0x98, 0x68, 0x68, 0x98, 0x69, 0x98, 0x98, 0x67, 0x95, 0x94, 0x95, 0x94, 0x68, 0x68, 0x67, 0x6a, 0x8e, 0xa0, 0x91, 0x5e, 0x93, 0xf0, 0xbb, 0xb3, 0xc4, 0x6a, 0x97, 0xee, 0x92, 0x5a, 0x7f, 0x80, 0x5a, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x7e, 0x00, 0x7e, 0x8b, 0xd4, 0xed, 0x77, 0xaa, 0x6b, 0x66, 0x61, 0x66, 0x9e, 0xbd, 0x76, 0xe0, 0xc8, 0x61, 0x5a, 0x5b, 0x9e, 0xdb, 0xc8, 0x8b, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0xbd, 0x79, 0xb7, 0xb7, 0xbe, 0xba, 0xb5, 0xba, 0xac, 0xb9, 0xcd, 0xf7, 0xeb, 0xec, 0xef, 0xd5, 0xa8, 0xac, 0xae, 0xab, 0xa7, 0xab, 0xa9, 0xa9, 0xc1, 0xb0, 0xa6, 0xa6, 0xa8, 0xa8, 0xb2, 0xba, 0xbb, 0xb3, 0xbb, 0xbb, 0xb6, 0xad, 0xad, 0xad, 0xb0, 0xa8, 0xa6, 0xa6, 0xa1, 0xa1, 0xa1, 0xa1, 0xa4, 0xa8, 0xa7, 0xa8, 0xac, 0xab, 0xa7, 0x9c, 0xa3, 0xa3, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x9c, 0xa3, 0x98, 0xa7, 0xae, 0x98, 0x9a, 0x9b, 0xa5, 0x9b, 0x9b, 0x9b, 0xa2, 0x9b, 0x9b, 0xa5, 0x9c, 0xa1, 0xa6, 0xa8, 0xa6, 0x93, 0x92, 0x93, 0x9a, 0x9a, 0x93, 0x8d, 0x9d, 0xa7, 0x91, 0x93, 0xd9, 0xe9, 0xf1, 0xf1, 0xe9, 0xdd, 0xa8, 0x65, 0x93, 0x9c, 0xa4, 0x9a, 0x95, 0x98, 0x9b, 0x9a, 0x95, 0x91, 0x8f, 0x93, 0x93, 0x91, 0x93, 0x9a, 0x9a, 0xa0, 0x9c, 0x95, 0x93, 0x95, 0x9b, 0x94, 0x9b, 0x94, 0x8f, 0x68, 0x98, 0x98, 0x93, 0x99, 0xa8, 0x97, 0x8d, 0x8c, 0x97, 0xa6, 0xc9, 0xdd, 0xec, 0xfc, 0xe2, 0xd2, 0xfd, 0xb4, 0x7e, 0x80, 0x7e, 0x80, 0x5a, 0x83, 0x84, 0x00, 0x80, 0x7e, 0x87, 0xf2, 0xe8, 0xd4, 0xcf, 0x79, 0xf2, 0xf0, 0xe2, 0xd8, 0x6b, 0x97, 0x65, 0x8d, 0x98, 0x97, 0x8e, 0x97, 0x99, 0x93, 0xa3, 0xba, 0xd3, 0xe9, 0x24, 0x15, 0x16, 0x18, 0x3b, 0x45, 0x3f, 0x3b, 0x90, 0x2d, 0x96, 0x78, 0x78, 0x6b, 0x97, 0x6c, 0x98, 0x93, 0x69, 0x93, 0x69, 0x98, 0x69, 0x98, 0x95, 0x95, 0x95, 0x95, 0x68, 0x94, 0x68, 0x68, 0x68, 0x67, 0x98, 0x99, 0x8e, 0x85, 0xd9, 0xe9, 0xa5, 0xcc, 0xbe, 0x65, 0x8d, 0xf0, 0x85, 0x5b, 0x5a, 0x00, 0xfe, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x82, 0x81, 0x7e, 0x5a, 0x7e, 0x5a, 0x7f, 0x86, 0xde, 0xed, 0x6f, 0x8c, 0x8a, 0x65, 0x8a, 0x65, 0x96, 0x8c, 0x5f, 0x5e, 0x85, 0x66, 0xaf, 0xcf, 0xd8, 0xdb, 0x76, 0x90, 0xbd, 0xe8, 0x90, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xcf, 0x77, 0xb4, 0xb7, 0xb8, 0xba, 0xac, 0xcb, 0xd5, 0xd1, 0xb7, 0xd2, 0xf1, 0xf7, 0xf8, 0xee, 0xc6, 0xa8, 0xa9, 0xb5, 0xb5, 0xa4, 0xa3, 0xb8, 0xa1, 0xa8, 0xad, 0xa6, 0xa1, 0xa8, 0xac, 0xa9, 0xab, 0xa7, 0xa7, 0xa7, 0xa8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa4, 0xa4, 0xa7, 0xa9, 0xac, 0xa7, 0xa4, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0x9a, 0xa3, 0xa0, 0x9d, 0xa0, 0x9b, 0xa2, 0xa2, 0xa2, 0xa4, 0xa8, 0x99, 0x99, 0x9a, 0x93, 0x9c, 0xa7, 0x9a, 0xa0, 0x9b, 0x6a, 0x6a, 0x9b, 0x94, 0x8f, 0xb6, 0xdc, 0xec, 0xee, 0xec, 0xe4, 0xc1, 0x99, 0x8d, 0xa3, 0xa8, 0x93, 0x9c, 0x9a, 0x93, 0xc1, 0xee, 0xe4, 0xda, 0xd5, 0xe1, 0xee, 0xec, 0xe4, 0x9f, 0x97, 0x93, 0x99, 0x9c, 0x9a, 0x93, 0x93, 0x93, 0xa3, 0xc6, 0xd9, 0xd5, 0xbe, 0xa6, 0xa1, 0x97, 0x93, 0x9a, 0x93, 0x6a, 0x9b, 0x6a, 0x94, 0x9b, 0x9b, 0x9b, 0x98, 0x9b, 0xa4, 0xa4, 0x97, 0x93, 0x97, 0x99, 0xa8, 0x9c, 0x92, 0x8d, 0x8d, 0x9f, 0xbf, 0xe5, 0xfc, 0xed, 0xf0, 0x84, 0x7e, 0x00, 0x86, 0xaa, 0xf9, 0xf2, 0xf9, 0x8b, 0x82, 0x8b, 0xe8, 0xcf, 0xe3, 0x7d, 0xf0, 0xd2, 0x6d, 0x8c, 0x92, 0x8d, 0x6c, 0x99, 0x6c, 0x98, 0x8f, 0x6c, 0x93, 0x98, 0x93, 0xa3, 0xc4, 0xdd, 0x71, 0x14, 0x17, 0x16, 0x3b, 0x52, 0x4c, 0x52, 0x54, 0x17, 0x5b, 0x9e, 0x71, 0xe8, 0x71, 0x92, 0x6c, 0x97, 0x69, 0x97, 0x68, 0x98, 0x93, 0x69, 0x93, 0x68, 0x95, 0x95, 0x68, 0x95, 0x68, 0x68, 0x68, 0x8f, 0xa5, 0x8f, 0x98, 0xa6, 0x64, 0x5f, 0xe4, 0xcc, 0xb3, 0xb3, 0xd3, 0x64, 0xbb, 0xd8, 0x7e, 0x7f, 0x7e, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x5a, 0x00, 0x7e, 0x7e, 0x82, 0x7f, 0x7e, 0x87, 0xf0, 0xd4, 0x92, 0x8c, 0x97, 0x99, 0x6b, 0x98, 0x97, 0x6c, 0x92, 0x64, 0x88, 0x5f, 0x88, 0x5e, 0x5f, 0x96, 0x7b, 0x96, 0x64, 0x89, 0x8a, 0xe8, 0x84, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x83, 0xdb, 0xd8, 0x6f, 0xb7, 0xb9, 0xba, 0xbc, 0xd9, 0xf1, 0xe2, 0xce, 0xc0, 0xfc, 0xef, 0xf7, 0xee, 0xe4, 0xc2, 0xa1, 0xab, 0xba, 0xb2, 0xa9, 0xb1, 0xa8, 0xb2, 0xb6, 0xb6, 0xb2, 0xac, 0xa7, 0xa0, 0xab, 0xab, 0xa9, 0xa9, 0xad, 0xb2, 0xad, 0xac, 0xab, 0xab, 0xae, 0xab, 0xa9, 0xa7, 0xa3, 0xa4, 0xac, 0xa4, 0xa7, 0xa3, 0x99, 0x9c, 0xa7, 0xa7, 0xa3, 0xa3, 0xa0, 0xa4, 0xa2, 0xa2, 0xa2, 0xa0, 0x92, 0xca, 0xe1, 0xe9, 0xe5, 0xd9, 0xbe, 0xa6, 0x97, 0x99, 0x99, 0x9c, 0xab, 0xa0, 0x9c, 0xa8, 0xef, 0xf0, 0xeb, 0xe2, 0xe2, 0xec, 0xee, 0xe6, 0xc6, 0xa6, 0x8d, 0x92, 0xa8, 0x91, 0x91, 0xdd, 0xec, 0xfa, 0xf7, 0xe2, 0xe3, 0xf8, 0xe2, 0xe4, 0xe5, 0xb0, 0x8d, 0x97, 0xa7, 0x9a, 0x93, 0xa3, 0xb6, 0xe1, 0xee, 0xec, 0xe5, 0xec, 0xe4, 0xce, 0x97, 0x97, 0x93, 0x9c, 0x9c, 0x95, 0x68, 0x9b, 0x6a, 0x9a, 0x9b, 0x93, 0x8e, 0x91, 0x99, 0x9c, 0x99, 0x98, 0x99, 0x93, 0x91, 0x95, 0x9b, 0xa4, 0x9c, 0x97, 0x92, 0xa6, 0xcd, 0xe2, 0xfa, 0x96, 0x88, 0xe8, 0xfd, 0xe0, 0xd4, 0xf9, 0xf0, 0xaa, 0x6d, 0xf1, 0xf0, 0xea, 0xb7, 0x9f, 0x8c, 0x97, 0xa1, 0x6c, 0x99, 0x99, 0x8e, 0x98, 0x67, 0x6c, 0x98, 0x6c, 0x8e, 0x91, 0xa9, 0xcc, 0xe9, 0x6c, 0x15, 0x16, 0x1c, 0x53, 0x53, 0x54, 0x59, 0x59, 0x48, 0x19, 0xaf, 0x52, 0x7a, 0x7a, 0x6b, 0x97, 0x93, 0x98, 0x68, 0x95, 0x68, 0x68, 0x68, 0x98, 0x95, 0x95, 0x95, 0x95, 0x68, 0x68, 0x68, 0x68, 0x67, 0x98, 0x9a, 0x93, 0x8d, 0x9d, 0x5e, 0x8e, 0xf1, 0xcc, 0xb3, 0xbe, 0xa3, 0x64, 0xe1, 0x85, 0x5b, 0x7e, 0x82, 0x80, 0x5a, 0x00, 0x00, 0x81, 0x81, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0x7e, 0x82, 0x7f, 0x7f, 0x7f, 0x66, 0xf3, 0x6f, 0x96, 0x92, 0x6c, 0x99, 0x8e, 0x98, 0xa7, 0x6c, 0x8e, 0x8e, 0x64, 0x5e, 0x5f, 0x5e, 0x5e, 0x88, 0x65, 0x64, 0x71, 0x6c, 0x96, 0x5f, 0x77, 0x90, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x86, 0x76, 0x77, 0xb7, 0xc3, 0xb6, 0xbc, 0xc2, 0xdc, 0xeb, 0xfc, 0xfc, 0xc0, 0xb4, 0xeb, 0xf1, 0xe6, 0xf1, 0xe4, 0xce, 0xa8, 0xa6, 0xa8, 0xac, 0xa8, 0xb8, 0xa1, 0x97, 0xa6, 0xb2, 0xb2, 0xae, 0xb1, 0xa5, 0xab, 0xab, 0xa9, 0xa3, 0xa6, 0xa9, 0xa8, 0xa3, 0xa3, 0xa4, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x99, 0xa1, 0xb8, 0xbc, 0xc1, 0xb9, 0xa1, 0x9c, 0x9c, 0x9c, 0x9d, 0xa4, 0xa4, 0xa2, 0x99, 0xd5, 0xfc, 0xec, 0xeb, 0xeb, 0xe9, 0xeb, 0xe5, 0xc6, 0xad, 0x92, 0x97, 0xa1, 0x92, 0x9c, 0xd0, 0xea, 0xe2, 0xf5, 0xf5, 0xe3, 0xf8, 0xe3, 0xe4, 0xee, 0xd5, 0xa6, 0x92, 0xa3, 0x99, 0x99, 0xdd, 0xe3, 0xf5, 0xde, 0xe2, 0xf7, 0xda, 0xdc, 0xe2, 0xef, 0xe4, 0xce, 0xa1, 0x92, 0x91, 0x93, 0x92, 0xe1, 0xe7, 0xe6, 0xda, 0xd6, 0xe4, 0xeb, 0xe9, 0xdf, 0xb9, 0x99, 0x92, 0x98, 0x9a, 0x6a, 0x6a, 0x6c, 0x91, 0x92, 0xa7, 0xb1, 0xa1, 0x93, 0x92, 0x93, 0x9c, 0x9a, 0x98, 0x95, 0x9a, 0x9b, 0x95, 0x8e, 0x93, 0x9c, 0x97, 0x92, 0x8c, 0xd8, 0xda, 0xf2, 0xe3, 0xe3, 0xdb, 0xd4, 0xdb, 0xe0, 0xf2, 0xee, 0x7a, 0xc3, 0x9f, 0x8d, 0x9f, 0x99, 0x6c, 0x91, 0x8d, 0x8e, 0x8f, 0x98, 0xa0, 0x67, 0x8e, 0x8e, 0x6c, 0x67, 0x91, 0xae, 0xc4, 0x7c, 0x66, 0x16, 0x17, 0x34, 0x56, 0x54, 0x59, 0x59, 0x59, 0x59, 0x58, 0x52, 0xd4, 0x76, 0x7c, 0x6c, 0x6c, 0x98, 0x93, 0x95, 0x95, 0x94, 0x95, 0x95, 0x95, 0x93, 0x68, 0x93, 0x68, 0x95, 0x68, 0x68, 0x68, 0x6a, 0x8f, 0x91, 0x99, 0x9c, 0xa8, 0xa1, 0x64, 0x9d, 0xe5, 0xcc, 0xcc, 0xb0, 0xa1, 0x7a, 0x9f, 0x8a, 0x8a, 0x61, 0x87, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x84, 0x61, 0x9e, 0xcf, 0xe0, 0x7a, 0xf0, 0xe2, 0xe2, 0xf3, 0x9f, 0x64, 0xa6, 0x93, 0x8f, 0x93, 0x9b, 0x67, 0x65, 0x67, 0xa2, 0x6c, 0x69, 0x65, 0x5f, 0x5e, 0x5f, 0x64, 0x65, 0x8d, 0x64, 0x65, 0x6c, 0x88, 0xbd, 0xaf, 0x7e, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0x87, 0xdb, 0x76, 0xb7, 0xc0, 0xb9, 0xb9, 0xc2, 0xce, 0xeb, 0xfa, 0xea, 0xfa, 0xb4, 0xc0, 0xf6, 0xef, 0xe6, 0xef, 0xe6, 0xd5, 0xad, 0xb2, 0xc6, 0xd9, 0xdd, 0xce, 0xb9, 0xad, 0xa8, 0xa3, 0xa3, 0xa7, 0xae, 0xab, 0xa9, 0xa8, 0xa9, 0xac, 0xa8, 0x9c, 0xb1, 0xab, 0xa7, 0xa5, 0xa5, 0xa7, 0xa4, 0xa4, 0xa9, 0xa6, 0xcb, 0xe9, 0xee, 0xee, 0xee, 0xdf, 0xca, 0xb9, 0xa8, 0xa1, 0xa3, 0xa3, 0x9c, 0x9c, 0xdf, 0xe7, 0xfa, 0xf7, 0xf7, 0xf8, 0xeb, 0xea, 0xeb, 0xe1, 0xc7, 0xa6, 0x9f, 0x97, 0x99, 0xcd, 0xf1, 0xfb, 0xf9, 0xea, 0xea, 0xfa, 0xe4, 0xea, 0xea, 0xf1, 0xee, 0xd0, 0xb6, 0xb8, 0xc9, 0xe9, 0xed, 0xe7, 0xe7, 0xea, 0xfc, 0xe7, 0xe7, 0xfa, 0xdc, 0xfc, 0xec, 0xc6, 0x99, 0xa6, 0xa7, 0xa1, 0xe4, 0xf5, 0xda, 0xf5, 0xf5, 0xf4, 0xda, 0xf7, 0xef, 0xe4, 0xc3, 0x99, 0x93, 0x9b, 0xa0, 0x98, 0x93, 0x6d, 0xd0, 0xe4, 0xe9, 0xe4, 0xc4, 0x99, 0x92, 0x93, 0x95, 0x93, 0x95, 0x9b, 0x9a, 0x94, 0xa7, 0x94, 0x8e, 0x91, 0xa1, 0xa8, 0x8c, 0x6b, 0xb0, 0x7a, 0xed, 0xea, 0x77, 0xda, 0xed, 0xea, 0xc4, 0x9c, 0x65, 0x99, 0x9c, 0x98, 0x8d, 0x91, 0xb3, 0xcc, 0xd3, 0xa9, 0x67, 0x93, 0x91, 0x69, 0x92, 0x98, 0x6c, 0x8f, 0xb8, 0xc4, 0xe9, 0x61, 0x5b, 0x16, 0x3b, 0x56, 0x57, 0x59, 0x7d, 0x59, 0x59, 0x59, 0x56, 0x57, 0xaf, 0x7a, 0x6f, 0x8d, 0x93, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x98, 0x68, 0x98, 0x68, 0x68, 0x68, 0x68, 0x9a, 0x6a, 0x9c, 0xae, 0xc9, 0xbb, 0xd0, 0xc6, 0x99, 0xbc, 0xf3, 0xec, 0xe9, 0xe9, 0x77, 0xea, 0x7a, 0xe3, 0x79, 0xe8, 0xfd, 0xf9, 0xaa, 0x8b, 0x84, 0x8b, 0xc8, 0xe8, 0xfb, 0x79, 0xbd, 0x6d, 0x66, 0x88, 0x6d, 0xed, 0xbb, 0x92, 0xa6, 0x97, 0x8f, 0x95, 0x6a, 0x6a, 0x69, 0x94, 0x69, 0x67, 0x8f, 0x69, 0xa2, 0x69, 0x8e, 0x8e, 0x8e, 0x8e, 0x69, 0xa2, 0x5f, 0x64, 0x65, 0x6b, 0x77, 0x7f, 0x5a, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x5a, 0x89, 0x76, 0x77, 0xb0, 0x6f, 0xbc, 0xb9, 0xb9, 0xc2, 0xf7, 0xef, 0xfa, 0xfc, 0xd7, 0xb4, 0xb6, 0xc7, 0xf6, 0xe6, 0xeb, 0xec, 0xdf, 0xdd, 0xe6, 0xf1, 0xec, 0xee, 0xec, 0xd1, 0xb2, 0xad, 0xb2, 0xac, 0xae, 0xa9, 0xa7, 0xb9, 0xdc, 0xe6, 0xe4, 0xdc, 0xb5, 0xad, 0xa7, 0xa3, 0xa3, 0xa7, 0xa7, 0xa3, 0xa6, 0xb6, 0xe4, 0xee, 0xf8, 0xdf, 0xeb, 0xee, 0xf1, 0xe4, 0xca, 0xa8, 0x9f, 0x9c, 0x99, 0x9f, 0xf8, 0xea, 0xf7, 0xf8, 0xe7, 0xf8, 0xfa, 0xe4, 0xe6, 0xf3, 0xee, 0xdf, 0xe1, 0xe4, 0xe4, 0xe6, 0xfc, 0xeb, 0xfc, 0xe7, 0xea, 0xe7, 0xe5, 0xe4, 0xdd, 0xe4, 0xe4, 0xe1, 0xe4, 0xe5, 0xd9, 0xe1, 0xf7, 0xe2, 0xe2, 0xf7, 0xf5, 0xe2, 0xe6, 0xfa, 0xe5, 0xe5, 0xec, 0xec, 0xe9, 0xe4, 0xe1, 0xe5, 0xf1, 0xfc, 0xfa, 0xe7, 0xea, 0xe7, 0xe2, 0xdc, 0xd2, 0xe5, 0xe9, 0xc6, 0x97, 0x91, 0x99, 0x99, 0x92, 0xda, 0xee, 0xe4, 0xdf, 0xe9, 0xe9, 0xdf, 0x9c, 0x99, 0x97, 0x9a, 0x9a, 0x95, 0x94, 0x91, 0x94, 0xb3, 0xae, 0xbe, 0xc9, 0xbf, 0xcd, 0xda, 0xd6, 0xcd, 0xc7, 0x77, 0xf1, 0xf0, 0xda, 0xa6, 0x8e, 0x99, 0x98, 0x98, 0x93, 0x93, 0xcc, 0xe4, 0xe1, 0xe9, 0xec, 0xb3, 0x8e, 0x93, 0x6a, 0x6a, 0x6c, 0x65, 0x6c, 0x8e, 0xc4, 0xd3, 0x7a, 0x5f, 0x17, 0x15, 0x45, 0x58, 0x57, 0x58, 0x59, 0xf3, 0x59, 0x58, 0xe8, 0x57, 0xaf, 0x77, 0xd8, 0x6c, 0x93, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x68, 0x93, 0x68, 0x93, 0x98, 0x93, 0x98, 0x9c, 0xb3, 0xcc, 0xcc, 0xbb, 0xd3, 0xe1, 0xe1, 0xe1, 0xd9, 0xa9, 0x92, 0x8d, 0x64, 0x64, 0x64, 0x5f, 0x8a, 0x64, 0x8a, 0x66, 0xaa, 0x79, 0xf2, 0xfb, 0x79, 0xc8, 0x6b, 0x8a, 0x88, 0x64, 0x66, 0xb0, 0xb7, 0xe9, 0xe1, 0x92, 0x8c, 0x6c, 0x91, 0x6a, 0x94, 0x67, 0x8f, 0x67, 0x69, 0x94, 0x67, 0x69, 0x67, 0x67, 0x69, 0x69, 0x67, 0x69, 0x6c, 0x67, 0x69, 0x68, 0x65, 0x64, 0x97, 0x6f, 0x7f, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x89, 0x77, 0xd8, 0x6f, 0xb7, 0xb9, 0xc2, 0xb9, 0xb9, 0xc2, 0xdf, 0xf1, 0xf0, 0xf5, 0xb9, 0xb0, 0xc6, 0xad, 0xb7, 0xb6, 0xc7, 0xdf, 0xf1, 0xef, 0xe6, 0xe6, 0xf8, 0xe6, 0xf0, 0xe6, 0xc7, 0xad, 0xad, 0xac, 0x9f, 0xc6, 0xef, 0xeb, 0xfc, 0xfc, 0xef, 0xf0, 0xeb, 0xf4, 0xbf, 0xa6, 0xa1, 0xa3, 0xad, 0x9f, 0xc7, 0xeb, 0xfc, 0xe4, 0xe6, 0xf6, 0xe6, 0xf7, 0xeb, 0xeb, 0xf8, 0xce, 0xbf, 0xc7, 0xd5, 0xeb, 0xef, 0xef, 0xef, 0xef, 0xec, 0xeb, 0xe6, 0xdc, 0xdd, 0xd9, 0xd0, 0xca, 0xc4, 0xba, 0xb8, 0xad, 0xa8, 0xa8, 0xa8, 0xa6, 0xa4, 0xa6, 0xa3, 0xa3, 0x9c, 0xa0, 0xa0, 0x9c, 0x9d, 0x9c, 0x9c, 0xa1, 0xa1, 0x9f, 0xa1, 0x9f, 0x9c, 0x9f, 0x9c, 0xa1, 0x9c, 0xa3, 0xa7, 0xae, 0xb3, 0xb3, 0xbb, 0xce, 0xd0, 0xd6, 0xdc, 0xe4, 0xe6, 0xec, 0xee, 0xec, 0xec, 0xf1, 0xe5, 0xc6, 0x9f, 0x93, 0x8c, 0xa8, 0xe7, 0xdf, 0xd6, 0xe1, 0xf4, 0xdc, 0xec, 0xdf, 0xb0, 0x8d, 0x97, 0x9a, 0x97, 0xa7, 0xd0, 0xd3, 0xc9, 0xd3, 0xcd, 0xc3, 0xf7, 0xef, 0xfc, 0xea, 0xfc, 0xeb, 0xef, 0xe5, 0xbb, 0x8d, 0x6c, 0x68, 0x6a, 0xa2, 0x91, 0x99, 0xdd, 0xec, 0xd9, 0xe1, 0xe1, 0xd3, 0x6d, 0x67, 0x92, 0x69, 0x69, 0x67, 0x9b, 0x8f, 0x6c, 0xb1, 0x7a, 0x7c, 0x66, 0x5b, 0x5c, 0x89, 0x57, 0x58, 0xed, 0x59, 0x59, 0x59, 0xfd, 0x57, 0x7d, 0x8b, 0x6f, 0x7a, 0x9f, 0x92, 0x98, 0x9a, 0x95, 0x94, 0x8f, 0x94, 0x94, 0x67, 0x67, 0x68, 0x6a, 0x98, 0x91, 0x99, 0xab, 0xc4, 0xc4, 0xcc, 0xd9, 0xdd, 0xd9, 0xc4, 0xa9, 0x8e, 0x8e, 0x8d, 0x8e, 0x91, 0x99, 0x99, 0x99, 0x99, 0x97, 0x9f, 0xb0, 0xcd, 0xdd, 0xda, 0xda, 0x6d, 0x8c, 0x64, 0x97, 0x92, 0x6c, 0x6d, 0xec, 0x7c, 0xe1, 0xdd, 0xe1, 0xdd, 0xc4, 0xa1, 0x97, 0x67, 0x68, 0x68, 0x68, 0x68, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x98, 0x68, 0x68, 0x67, 0x9b, 0x8e, 0xa2, 0x64, 0x6b, 0xe1, 0x5b, 0x5a, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x89, 0x78, 0xd8, 0x6f, 0xb6, 0xbe, 0xbc, 0xb9, 0xbc, 0xb9, 0xd1, 0xe1, 0xe4, 0xd5, 0xb7, 0xb6, 0xc3, 0xb9, 0xb9, 0xb9, 0xb6, 0xbf, 0xd1, 0xf8, 0xe7, 0xef, 0xef, 0xfc, 0xe6, 0xef, 0xf1, 0xf7, 0xa6, 0xad, 0x9f, 0xc7, 0xeb, 0xfa, 0xe7, 0xfa, 0xfa, 0xe7, 0xfc, 0xef, 0xe7, 0xd7, 0xb6, 0xad, 0xa8, 0xb0, 0xc7, 0xe7, 0xeb, 0xeb, 0xf0, 0xef, 0xf1, 0xf1, 0xf0, 0xf1, 0xeb, 0xeb, 0xe4, 0xf8, 0xe1, 0xd5, 0xce, 0xce, 0xc7, 0xbf, 0xb0, 0xa8, 0xa6, 0xa8, 0xa8, 0xa6, 0xa8, 0xa3, 0xa6, 0xa3, 0xa3, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa3, 0x9c, 0xa3, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa0, 0x9c, 0x92, 0x92, 0x97, 0x97, 0x9f, 0xa1, 0xa6, 0xa1, 0xc3, 0xc9, 0xe1, 0xe9, 0xec, 0xe5, 0xe1, 0xd9, 0xd7, 0xf0, 0xf7, 0xd2, 0xf4, 0xd2, 0xda, 0xf8, 0xf1, 0xdd, 0xa6, 0x97, 0xb9, 0xd3, 0xd9, 0xc9, 0xbe, 0xd5, 0xd5, 0xce, 0xfa, 0xfc, 0xf7, 0xd6, 0xd6, 0xfc, 0xf0, 0xd9, 0xa8, 0x97, 0x9a, 0x9a, 0x69, 0x67, 0x69, 0x93, 0xa1, 0xd9, 0xee, 0xe4, 0xdd, 0xc4, 0x97, 0x65, 0x92, 0x6d, 0x6c, 0x8f, 0x69, 0x69, 0x67, 0x6c, 0x92, 0x6d, 0x77, 0x78, 0x76, 0x9e, 0x61, 0x79, 0x7d, 0x7d, 0xf2, 0xf2, 0xf2, 0x58, 0xf3, 0xdb, 0x15, 0xbd, 0x7a, 0x6b, 0x8d, 0x92, 0x67, 0x98, 0x95, 0x94, 0x94, 0x8f, 0x94, 0x6a, 0x68, 0x67, 0x91, 0xa0, 0xb8, 0xcc, 0xd3, 0xd0, 0xcc, 0xbe, 0xa7, 0x99, 0x8e, 0x8e, 0x95, 0x98, 0x68, 0x8f, 0x98, 0x9b, 0x99, 0x8e, 0x91, 0xa8, 0xcc, 0xe1, 0xe1, 0xd3, 0xa6, 0x65, 0x8d, 0x91, 0x6c, 0x6c, 0x92, 0x99, 0xe1, 0xd9, 0x8d, 0x92, 0x97, 0xa6, 0xb0, 0xbb, 0xb0, 0xa6, 0x6c, 0x9b, 0x68, 0x8f, 0x8f, 0x68, 0x67, 0x8f, 0x68, 0x68, 0x68, 0x68, 0x95, 0x68, 0x95, 0x68, 0x68, 0x8f, 0x9b, 0x8f, 0x8f, 0x65, 0x77, 0x88, 0x5a, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x5a, 0x61, 0x77, 0x76, 0xcd, 0xb7, 0xb9, 0xc2, 0xbc, 0xb9, 0xb2, 0xb9, 0xca, 0xcd, 0xc6, 0xb9, 0xb6, 0xbe, 0xc6, 0xbe, 0xb6, 0xb6, 0xb0, 0xad, 0xb0, 0xc7, 0xc7, 0xdf, 0xe6, 0xeb, 0xeb, 0xef, 0xf1, 0xee, 0xdc, 0xd9, 0xe4, 0xf1, 0xef, 0xfc, 0xfc, 0xe7, 0xe7, 0xeb, 0xf0, 0xf1, 0xf1, 0xf1, 0xec, 0xe9, 0xe5, 0xe6, 0xec, 0xe6, 0xe1, 0xdf, 0xd2, 0xd5, 0xc0, 0xb9, 0xb0, 0xb0, 0xb6, 0xb0, 0xad, 0xa6, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xac, 0xa6, 0xa7, 0xa6, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa5, 0xa4, 0xa5, 0xa4, 0xa5, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa4, 0xa0, 0x9c, 0x9c, 0x9c, 0x9c, 0x9a, 0x9c, 0x9a, 0x9a, 0xa7, 0xa6, 0xa7, 0xa6, 0xa3, 0x9c, 0x9c, 0x9c, 0x97, 0x8e, 0x8d, 0x93, 0x9c, 0xb5, 0xcc, 0xc9, 0xdd, 0xee, 0xec, 0xeb, 0xec, 0xe4, 0xf4, 0xd5, 0xd7, 0xf8, 0xe6, 0xda, 0xce, 0xd9, 0xd9, 0xd0, 0xd5, 0xcd, 0xc7, 0xdf, 0xef, 0xf8, 0xd2, 0xf7, 0xfc, 0xe4, 0xd7, 0xb0, 0x8d, 0x99, 0x9c, 0x8e, 0x9b, 0x67, 0x98, 0x98, 0x8e, 0x99, 0xa8, 0xa1, 0x97, 0x9f, 0xa4, 0xa1, 0x67, 0x8e, 0x67, 0x69, 0x94, 0x67, 0x68, 0xcc, 0x6d, 0x8c, 0x6b, 0x6b, 0x6f, 0x78, 0x7a, 0x7c, 0xf2, 0x7d, 0x59, 0x58, 0xf2, 0x7d, 0xf2, 0x96, 0x85, 0x71, 0x7a, 0xbb, 0x6d, 0xa0, 0x93, 0x8f, 0x94, 0x94, 0x94, 0x94, 0x6a, 0x9b, 0x67, 0x8f, 0xa0, 0xbb, 0xd0, 0xcc, 0xb5, 0xa8, 0x9c, 0x97, 0x93, 0x93, 0x99, 0x98, 0x6a, 0x95, 0x6a, 0x98, 0x95, 0x98, 0x93, 0x98, 0xbb, 0xd3, 0xdd, 0xd3, 0xa9, 0x8d, 0x92, 0x99, 0x67, 0x99, 0xa0, 0x98, 0x98, 0x99, 0xe9, 0x99, 0xa6, 0xd3, 0xe5, 0xe4, 0xdd, 0xd6, 0x6d, 0x65, 0x93, 0x98, 0x98, 0x67, 0x67, 0x98, 0x6a, 0x67, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x68, 0x8e, 0xa2, 0x8e, 0xa4, 0x64, 0xcd, 0x6d, 0x7e, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x61, 0x76, 0x76, 0xcd, 0xbb, 0xbf, 0xbc, 0xbc, 0xb9, 0xbc, 0xb9, 0xb6, 0xb9, 0xbf, 0xbe, 0xb9, 0xb8, 0xba, 0xb2, 0xb8, 0xc6, 0xc6, 0xc2, 0xb9, 0xc0, 0xb9, 0xb0, 0xb7, 0xca, 0xd5, 0xce, 0xd1, 0xdd, 0xe4, 0xdd, 0xe4, 0xe4, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xdc, 0xce, 0xc9, 0xc9, 0xc6, 0xbe, 0xb3, 0xb2, 0xad, 0xad, 0xa8, 0xad, 0xad, 0xad, 0xa6, 0xb0, 0xad, 0xad, 0xad, 0xa8, 0xac, 0xa8, 0xa8, 0xac, 0xac, 0xa8, 0xa9, 0xa8, 0xac, 0xac, 0xac, 0xb1, 0xb1, 0xac, 0xac, 0xab, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa0, 0xa0, 0x9c, 0xa0, 0xa0, 0xa3, 0xa4, 0xa4, 0xa4, 0xa7, 0x9c, 0x9c, 0x9a, 0x9c, 0x9a, 0x9c, 0x9a, 0x9a, 0xa7, 0xa0, 0xa0, 0x9a, 0x91, 0x93, 0x9c, 0xa0, 0x97, 0xa6, 0xad, 0xc6, 0xdd, 0xe4, 0xee, 0xee, 0xe4, 0xe5, 0xe6, 0xe1, 0xda, 0xd1, 0xd2, 0xce, 0xdf, 0xc0, 0xce, 0xeb, 0xf8, 0xd2, 0xf8, 0xef, 0xe6, 0xcd, 0xa6, 0x92, 0x8d, 0x92, 0x99, 0x97, 0x68, 0x67, 0x6a, 0x9c, 0x8e, 0x8d, 0x99, 0x99, 0xa8, 0x9a, 0x99, 0x9a, 0x93, 0x8f, 0x94, 0x94, 0x9b, 0x94, 0x8e, 0xae, 0xd0, 0xbb, 0xb7, 0x6d, 0x6b, 0x96, 0x6b, 0x6b, 0x73, 0xd8, 0xde, 0xe2, 0x7d, 0x7c, 0x7c, 0x76, 0x77, 0xed, 0xe9, 0xd8, 0xbb, 0xab, 0x6a, 0x8f, 0x67, 0x94, 0x94, 0x94, 0x68, 0x67, 0x8f, 0x9b, 0xbb, 0xcc, 0xcc, 0xa9, 0xa1, 0x93, 0x91, 0x91, 0x98, 0x9c, 0x9a, 0x6a, 0x95, 0x8f, 0x67, 0x6a, 0x93, 0x8e, 0xa0, 0xc4, 0xd3, 0xc4, 0xab, 0x98, 0x91, 0x92, 0x93, 0x99, 0xa0, 0x68, 0x67, 0x8e, 0x99, 0x8e, 0xe1, 0x92, 0xbb, 0xe5, 0xf3, 0xf3, 0xf1, 0xf1, 0xf8, 0xcd, 0x8d, 0x8f, 0x95, 0x9a, 0x6a, 0x95, 0x95, 0x9b, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x95, 0x94, 0x95, 0x94, 0x68, 0x68, 0x98, 0x8e, 0x6b, 0x77, 0x7f, 0x5a, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x89, 0x76, 0x77, 0x73, 0xc0, 0xb9, 0xc2, 0xbc, 0xbc, 0xc2, 0xc1, 0xb9, 0xb9, 0xb9, 0xbe, 0xbc, 0xb8, 0xba, 0xba, 0xb9, 0xb8, 0xb6, 0xb6, 0xb7, 0xb9, 0xbf, 0xc2, 0xb6, 0xad, 0xad, 0xb9, 0xb5, 0xa6, 0xb6, 0xb2, 0xad, 0xad, 0xa6, 0xa8, 0xb0, 0xa8, 0xad, 0xb0, 0xb6, 0xb6, 0xac, 0xac, 0xb3, 0xbe, 0xb8, 0xb5, 0xac, 0xac, 0xb2, 0xa8, 0xad, 0xac, 0xac, 0xac, 0xb1, 0xb1, 0xac, 0xab, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa9, 0xa7, 0xa9, 0xa3, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa2, 0xa5, 0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0xa0, 0xa4, 0xa4, 0xa3, 0xa3, 0x9c, 0x9c, 0x9c, 0x9c, 0xa0, 0x9d, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x6a, 0x9b, 0xa5, 0xa9, 0x6a, 0x68, 0x95, 0x98, 0xa0, 0x6a, 0x97, 0x93, 0x92, 0xa1, 0xb0, 0xc7, 0xe4, 0xeb, 0xf0, 0xef, 0xf7, 0xd2, 0xce, 0xf4, 0xcd, 0xd2, 0xdc, 0xea, 0xe4, 0xf7, 0xec, 0xf8, 0xcd, 0xa8, 0x92, 0x92, 0xb6, 0xd0, 0xc9, 0xc4, 0x99, 0x68, 0x98, 0x98, 0x9c, 0xab, 0xbe, 0xbe, 0xac, 0x9a, 0x8f, 0x91, 0x9d, 0x94, 0x94, 0x94, 0x95, 0x9d, 0x8e, 0x8f, 0xa8, 0xc9, 0xd3, 0xd9, 0x71, 0xc4, 0xbb, 0x6c, 0x6d, 0x92, 0x96, 0x6d, 0x6b, 0x6d, 0x6b, 0xb0, 0xb7, 0x6c, 0x97, 0x98, 0x99, 0x98, 0x95, 0x6a, 0x94, 0x9b, 0x67, 0x94, 0x68, 0x67, 0x6a, 0xb3, 0xcc, 0xc4, 0xa7, 0x93, 0x8e, 0x99, 0x9c, 0x9c, 0x93, 0x8e, 0x8f, 0x95, 0x95, 0x67, 0x95, 0x98, 0x95, 0xa2, 0xb3, 0xcc, 0xab, 0x9b, 0x93, 0x91, 0x9a, 0x9c, 0x93, 0x8e, 0x69, 0x8f, 0x98, 0x69, 0x93, 0x8e, 0xbb, 0xbe, 0x6d, 0xdf, 0xf1, 0xf3, 0xf3, 0xf3, 0x7d, 0xee, 0xc4, 0xa0, 0x8f, 0x98, 0x98, 0x8f, 0x8f, 0x9a, 0x95, 0x93, 0x94, 0x93, 0x94, 0x93, 0x94, 0x67, 0x94, 0x9b, 0x67, 0x6a, 0x8f, 0x6c, 0x64, 0xe3, 0x87, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x89, 0x74, 0x76, 0xd8, 0xc0, 0xbe, 0xc2, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb9, 0xbc, 0xbe, 0xbc, 0xba, 0xbe, 0xbe, 0xb8, 0xbe, 0xc6, 0xca, 0xc6, 0xb9, 0xad, 0xbf, 0xce, 0xb9, 0xb2, 0xba, 0xc6, 0xc4, 0xb9, 0xb6, 0xc3, 0xb6, 0xc6, 0xbf, 0xbf, 0xb9, 0xb6, 0xb6, 0xb8, 0xb6, 0xb5, 0xb1, 0xac, 0xab, 0xa9, 0xae, 0xa9, 0xb2, 0xb1, 0xac, 0xba, 0xb8, 0xb2, 0xa9, 0xa9, 0xa9, 0xae, 0xb3, 0xab, 0xa5, 0xa9, 0xa9, 0xab, 0xab, 0xae, 0xae, 0xb3, 0xae, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa8, 0xa9, 0xa7, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa4, 0xa2, 0xa4, 0xa4, 0xa4, 0xa0, 0xa3, 0x9c, 0x9c, 0x9c, 0x9a, 0xa2, 0xa2, 0x9b, 0xa2, 0x9b, 0x9d, 0x9b, 0x9b, 0xa2, 0x9b, 0x6a, 0x69, 0x94, 0x9b, 0xa5, 0xa5, 0x6a, 0x93, 0xa5, 0xa4, 0x9c, 0x99, 0x97, 0xa8, 0xd7, 0xd5, 0xdc, 0xf8, 0xfc, 0xef, 0xfa, 0xd6, 0xd7, 0xf5, 0xd2, 0xf7, 0xf1, 0xe6, 0xdd, 0xc7, 0xbe, 0x92, 0x92, 0xc9, 0xe5, 0xe9, 0xe4, 0xe1, 0xa0, 0x93, 0x8f, 0x98, 0xae, 0xc4, 0xae, 0x9c, 0x8d, 0x91, 0x9a, 0x9d, 0x94, 0x91, 0x94, 0x94, 0x91, 0x9a, 0x98, 0x93, 0x97, 0x98, 0x6c, 0xa7, 0xbb, 0xc4, 0xd3, 0xbb, 0xd3, 0xd3, 0xcd, 0xb0, 0x6c, 0xb0, 0x8e, 0x6c, 0x8d, 0x8e, 0x99, 0x98, 0x8e, 0x8f, 0x67, 0x67, 0x95, 0x94, 0x94, 0x68, 0x67, 0x6a, 0xab, 0xbb, 0xb3, 0x9b, 0x93, 0x93, 0x91, 0x8f, 0x98, 0x98, 0x95, 0x68, 0x95, 0x6a, 0x67, 0x9b, 0x95, 0x8e, 0x9b, 0xb3, 0xb3, 0xa2, 0x8f, 0x98, 0x9a, 0x95, 0x8e, 0x8e, 0x93, 0xa0, 0x67, 0x68, 0x69, 0x67, 0x69, 0x98, 0x98, 0xb6, 0x8d, 0xad, 0x77, 0xec, 0xf1, 0xf1, 0xf1, 0xf1, 0xe9, 0xcc, 0x8f, 0x91, 0x98, 0x93, 0x8f, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x95, 0x94, 0x94, 0x67, 0x94, 0x6a, 0x8f, 0x93, 0x6c, 0x64, 0x77, 0x66, 0x7e, 0x5a, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x17, 0xd4, 0x78, 0xd8, 0x6f, 0xbf, 0xc2, 0xbc, 0xbc, 0xbc, 0xc1, 0xc1, 0xb9, 0xba, 0xbe, 0xbc, 0xba, 0xba, 0xb6, 0xc1, 0xdf, 0xee, 0xee, 0xe6, 0xe4, 0xd7, 0xc2, 0xb2, 0xb6, 0xbe, 0xb2, 0xb1, 0xb5, 0xb2, 0xb0, 0xb9, 0xad, 0xc3, 0xad, 0xb2, 0xb2, 0xbe, 0xb2, 0xac, 0xac, 0xb8, 0xb8, 0xb5, 0xae, 0xb5, 0xba, 0xab, 0xb5, 0xb2, 0xa3, 0xac, 0xa9, 0xb2, 0xb1, 0xa9, 0xab, 0xb1, 0xb3, 0xae, 0xab, 0xae, 0xae, 0xab, 0xab, 0xa7, 0xa7, 0xa0, 0xa3, 0xab, 0xac, 0xa9, 0xa9, 0xa8, 0xa3, 0xa6, 0xa3, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9c, 0xa0, 0xa3, 0xa0, 0xa4, 0xa3, 0xa4, 0xa4, 0xa2, 0xa2, 0xa2, 0x9d, 0xa2, 0x9b, 0xa2, 0x9b, 0xa2, 0x6a, 0x9b, 0xa2, 0x9b, 0x9b, 0x6a, 0x67, 0x9b, 0x68, 0x9b, 0x6a, 0x9c, 0x99, 0xa1, 0xc9, 0xb7, 0xc9, 0xd2, 0xce, 0xcd, 0xf4, 0xe6, 0xfc, 0xfa, 0xfa, 0xd2, 0xf8, 0xef, 0xd7, 0xc9, 0xba, 0x9f, 0x65, 0xbe, 0xec, 0xdd, 0xd5, 0xe1, 0xdd, 0x8d, 0x93, 0x9c, 0xb3, 0xd0, 0xcc, 0xa8, 0x93, 0x9c, 0x97, 0x8e, 0x8d, 0x8e, 0x94, 0x9a, 0x9d, 0x9a, 0x95, 0x97, 0x98, 0x93, 0x93, 0x91, 0x6a, 0xa5, 0x8f, 0x8f, 0xa5, 0xa5, 0x8d, 0x91, 0x99, 0x6c, 0xa5, 0x6c, 0x99, 0x98, 0xa4, 0x9b, 0x8e, 0x9b, 0x6a, 0x95, 0x67, 0x8f, 0x67, 0x95, 0x9b, 0x67, 0xa2, 0xab, 0xae, 0x9b, 0x91, 0x91, 0x9a, 0xa0, 0x98, 0x8f, 0x67, 0x6a, 0x9b, 0x68, 0x8f, 0x67, 0x98, 0x67, 0x93, 0xa2, 0xb3, 0x9b, 0x8e, 0x98, 0x67, 0x8f, 0x93, 0x6a, 0x9b, 0x67, 0x8e, 0x69, 0x67, 0x69, 0x8e, 0x6a, 0x6c, 0x8e, 0x93, 0x99, 0x6c, 0xa1, 0xa6, 0xa6, 0xb0, 0xb7, 0xc9, 0xd9, 0xbb, 0x6a, 0x67, 0x98, 0x98, 0x95, 0x95, 0x93, 0x94, 0x93, 0x94, 0x93, 0x94, 0x93, 0x94, 0x94, 0x6a, 0x94, 0x67, 0x98, 0x6c, 0x64, 0xd8, 0x90, 0x7e, 0x7e, 0xff, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x86, 0x74, 0x78, 0x76, 0x6f, 0xbf, 0xc3, 0xbc, 0xbc, 0xbc, 0xc1, 0xc1, 0xba, 0xba, 0xc1, 0xbc, 0xb5, 0xbc, 0xb9, 0xd5, 0xec, 0xec, 0xe4, 0xf8, 0xee, 0xee, 0xdd, 0xb9, 0xb9, 0xbc, 0xb8, 0xb8, 0xbc, 0xc3, 0xb9, 0xc3, 0xad, 0xc6, 0xad, 0xb8, 0xb9, 0xa9, 0xb2, 0xb8, 0xb8, 0xb2, 0xac, 0xb2, 0xb5, 0xb1, 0xb5, 0xa7, 0xb5, 0xb5, 0xa9, 0xb5, 0xb2, 0xa9, 0xb2, 0xb1, 0xb1, 0xab, 0xa9, 0xae, 0xb3, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xae, 0xa9, 0xab, 0xa8, 0xa9, 0xa8, 0xad, 0xa8, 0xa8, 0xa8, 0xa7, 0xa8, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa1, 0xa1, 0xa1, 0xa3, 0xa1, 0x9c, 0xa1, 0xa7, 0xa3, 0xa4, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0x9b, 0xa2, 0x9b, 0xa2, 0xa2, 0xa0, 0xa0, 0xa0, 0x9a, 0x9b, 0xa3, 0xa2, 0x98, 0x6a, 0xa0, 0xa2, 0xa5, 0x6a, 0x9b, 0x98, 0x9c, 0x9c, 0x9c, 0xd0, 0xd5, 0xce, 0xc7, 0xcd, 0xc7, 0xc7, 0xcd, 0xce, 0xe2, 0xeb, 0xe7, 0xef, 0xda, 0xc3, 0xd0, 0xa8, 0x9c, 0x8d, 0xd3, 0xe9, 0xc9, 0xe1, 0xe9, 0xa6, 0x91, 0xa1, 0xb2, 0xcc, 0xd3, 0xbb, 0x6c, 0xa6, 0x6c, 0xa4, 0x6c, 0x6c, 0x98, 0x98, 0x91, 0x67, 0x93, 0x8e, 0x6a, 0x98, 0x93, 0x93, 0x95, 0x94, 0x67, 0x94, 0x94, 0x6a, 0x8f, 0x94, 0xa7, 0x91, 0xa2, 0x65, 0x68, 0x6a, 0x8f, 0x68, 0x95, 0x9b, 0x68, 0x95, 0x68, 0x95, 0x9b, 0x95, 0x95, 0x8f, 0x67, 0xa0, 0xa5, 0x69, 0x93, 0x95, 0x98, 0x93, 0x67, 0x93, 0x68, 0x95, 0x68, 0x67, 0x68, 0x68, 0x9b, 0x8e, 0x67, 0xa5, 0xa7, 0x68, 0x8f, 0x95, 0x67, 0x95, 0x68, 0x68, 0x67, 0x67, 0x95, 0x69, 0x68, 0x8e, 0x9b, 0x69, 0x68, 0x8e, 0x67, 0x6c, 0x91, 0x93, 0x92, 0x93, 0x97, 0x91, 0x92, 0x8d, 0x65, 0x67, 0x6a, 0x98, 0x67, 0x95, 0x98, 0x67, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x93, 0x67, 0x95, 0x67, 0x9c, 0x91, 0xa1, 0x64, 0xda, 0x90, 0x5a, 0x00, 0xfe, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0x50, 0x74, 0x76, 0x6f, 0xcd, 0xc7, 0xb2, 0xc5, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xbc, 0xbc, 0xbf, 0xca, 0xdf, 0xeb, 0xef, 0xe6, 0xe6, 0xf8, 0xee, 0xdc, 0xa8, 0xbf, 0xbc, 0xac, 0xbe, 0xc2, 0xb0, 0xad, 0xb0, 0xb6, 0xad, 0xad, 0xb2, 0xb9, 0xb2, 0xb5, 0xb6, 0xb5, 0xb6, 0xb9, 0xad, 0xae, 0xb5, 0xb5, 0xb5, 0xba, 0xb2, 0xa8, 0xb2, 0xb2, 0xac, 0xa9, 0xae, 0xab, 0xa9, 0xab, 0xb3, 0xae, 0xae, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xac, 0xa3, 0xa6, 0xa8, 0xa8, 0xb0, 0xb7, 0xad, 0xa8, 0xa1, 0xa3, 0xa9, 0xa9, 0xa9, 0xab, 0xa7, 0x9d, 0xa9, 0xa7, 0xa4, 0xab, 0xa9, 0xa3, 0x9c, 0xb0, 0xce, 0xdc, 0xdf, 0xdf, 0xdd, 0xc6, 0xa3, 0xa6, 0x98, 0x99, 0xa5, 0xa4, 0x9b, 0xa0, 0xa0, 0xa5, 0xa0, 0x9b, 0xa3, 0xa7, 0x9c, 0x9c, 0x99, 0x9c, 0x99, 0x9a, 0x97, 0x93, 0x9c, 0xa7, 0x98, 0x9c, 0x9b, 0x98, 0x9c, 0x9c, 0x9c, 0xa8, 0xd0, 0xc9, 0xc9, 0xcd, 0xc7, 0xcd, 0xce, 0xd2, 0xce, 0xc0, 0xf5, 0xeb, 0xce, 0xc7, 0xc9, 0xc9, 0x8d, 0xa7, 0x8e, 0xd9, 0xdd, 0xdd, 0xe5, 0xb6, 0x8d, 0x97, 0xb5, 0xc9, 0xc9, 0xd3, 0x6f, 0xc4, 0x71, 0x70, 0x73, 0x72, 0x71, 0x49, 0xbb, 0x3d, 0x92, 0x69, 0x8e, 0x6a, 0x6c, 0x8f, 0x93, 0x9d, 0x8f, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x94, 0x94, 0x68, 0x94, 0x68, 0x94, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x95, 0x68, 0x93, 0x95, 0x95, 0x93, 0x95, 0x95, 0x95, 0x68, 0x68, 0x68, 0x68, 0x94, 0x68, 0x68, 0x68, 0x95, 0x95, 0x95, 0x68, 0x95, 0x68, 0x95, 0x6a, 0x68, 0x68, 0x67, 0x8f, 0x67, 0x67, 0x95, 0x68, 0x68, 0x68, 0x68, 0x67, 0x68, 0x93, 0x68, 0x98, 0x98, 0x69, 0x93, 0x98, 0x98, 0x98, 0x6a, 0x9b, 0x8e, 0x67, 0x6a, 0x95, 0x6a, 0x95, 0x8e, 0x67, 0x9a, 0x93, 0x8e, 0x91, 0x9d, 0xa4, 0xa0, 0x9a, 0xa4, 0x9c, 0x99, 0x99, 0x8c, 0x6d, 0xe0, 0x86, 0x82, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x83, 0x4a, 0x50, 0x76, 0x73, 0x6f, 0xbe, 0xbc, 0xc5, 0xbc, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xb9, 0xb9, 0xc2, 0xd1, 0xdf, 0xf8, 0xeb, 0xeb, 0xeb, 0xeb, 0xd7, 0xad, 0xbc, 0xbf, 0xb2, 0xb9, 0xb6, 0xca, 0xdc, 0xdc, 0xdd, 0xd7, 0xd0, 0xb9, 0xb2, 0xa8, 0xad, 0xb8, 0xb0, 0xb2, 0xb9, 0xb8, 0xba, 0xb5, 0xb1, 0xac, 0xa8, 0xa8, 0xb2, 0xb9, 0xad, 0xb2, 0xad, 0xa9, 0xac, 0xb5, 0xb3, 0xa3, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xab, 0xac, 0xa3, 0xbf, 0xd5, 0xe1, 0xe6, 0xe6, 0xe6, 0xe6, 0xe4, 0xcc, 0xab, 0xa7, 0xa9, 0xa4, 0xa3, 0xa9, 0xab, 0xa9, 0xa4, 0xa3, 0xa3, 0xa0, 0xb1, 0xd5, 0xee, 0xeb, 0xeb, 0xe6, 0xe6, 0xe6, 0xec, 0xec, 0xba, 0xa6, 0xa0, 0xa7, 0xa5, 0xa0, 0xa2, 0x9b, 0x9c, 0xab, 0xab, 0x99, 0x91, 0xa1, 0xb8, 0xc9, 0xd9, 0xc9, 0xc9, 0xbe, 0xa8, 0x9c, 0xa1, 0x9c, 0x9c, 0x9b, 0x9c, 0x9a, 0xa1, 0x99, 0xac, 0xc9, 0xd0, 0xce, 0xd0, 0xc9, 0xc7, 0xc3, 0xc3, 0xc0, 0xf4, 0xf4, 0xf4, 0xd2, 0xc9, 0xc9, 0xb8, 0x93, 0x99, 0x8e, 0xd9, 0xf1, 0xe1, 0xb8, 0x8d, 0x97, 0xa6, 0xca, 0xce, 0xc9, 0x6f, 0x71, 0x71, 0x72, 0x73, 0x72, 0x72, 0x70, 0x72, 0x72, 0x72, 0x72, 0x6c, 0x69, 0x65, 0x69, 0x99, 0x8e, 0x9d, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x94, 0x68, 0x94, 0x94, 0x94, 0x94, 0x68, 0x94, 0x68, 0x94, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x68, 0x95, 0x68, 0x68, 0x68, 0x68, 0x68, 0x94, 0x68, 0x95, 0x68, 0x95, 0x95, 0x68, 0x95, 0x68, 0x67, 0x67, 0x68, 0x6a, 0x69, 0x6a, 0x6a, 0x68, 0x95, 0x93, 0x68, 0x93, 0x98, 0x68, 0x68, 0x67, 0x68, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x9b, 0x9b, 0x67, 0x8e, 0x67, 0xa5, 0x9b, 0x8e, 0x9a, 0x93, 0x9c, 0xcc, 0xcc, 0xbb, 0xcc, 0xc9, 0xbb, 0xc9, 0x6f, 0xbb, 0x6f, 0xe0, 0xdb, 0x7f, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x41, 0x4a, 0x74, 0x76, 0xbb, 0xbf, 0xc6, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xbe, 0xbc, 0xbc, 0xbc, 0xc2, 0xb9, 0xbf, 0xc2, 0xc7, 0xce, 0xd7, 0xf6, 0xdc, 0xd7, 0xc2, 0xad, 0xb9, 0xbc, 0xb9, 0xb9, 0xbf, 0xdf, 0xec, 0xec, 0xeb, 0xee, 0xee, 0xe6, 0xdd, 0xc2, 0xb6, 0xb9, 0xb5, 0xb0, 0xb2, 0xb6, 0xba, 0xa8, 0xb2, 0xca, 0xd5, 0xdf, 0xe6, 0xf8, 0xe6, 0xe4, 0xdd, 0xca, 0xb5, 0xb1, 0xb2, 0xb1, 0xac, 0xac, 0xac, 0xac, 0xab, 0xac, 0xac, 0xa8, 0xbc, 0xdd, 0xec, 0xe6, 0xeb, 0xeb, 0xe6, 0xeb, 0xec, 0xec, 0xd9, 0xa7, 0xa3, 0xab, 0xa9, 0xa5, 0xae, 0xa5, 0xa3, 0xa7, 0xa4, 0xa3, 0xcc, 0xee, 0xf7, 0xf7, 0xf7, 0xe2, 0xf8, 0xdf, 0xe4, 0xe9, 0xc9, 0xab, 0xa3, 0xa4, 0xa5, 0xa2, 0xa2, 0x9b, 0x93, 0xa7, 0xa6, 0x9c, 0xb8, 0xdf, 0xee, 0xec, 0xe9, 0xe6, 0xec, 0xec, 0xe4, 0xd5, 0xb2, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x99, 0xa8, 0xd0, 0xc6, 0xc9, 0xd0, 0xce, 0xd0, 0xce, 0xd0, 0xd5, 0xf4, 0xd2, 0xc7, 0xce, 0xcd, 0xc4, 0xa8, 0x98, 0x98, 0x98, 0xa5, 0xb3, 0xa4, 0x8d, 0x92, 0xa1, 0xb9, 0xd1, 0xd0, 0x6f, 0x71, 0x71, 0x72, 0x49, 0x6e, 0x38, 0x2f, 0x2f, 0x2f, 0x36, 0x43, 0x43, 0x6e, 0x6e, 0x69, 0x69, 0x69, 0x8f, 0x95, 0x8f, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x68, 0x94, 0x68, 0x94, 0x68, 0x94, 0x94, 0x68, 0x94, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x93, 0x95, 0x93, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x68, 0x68, 0x68, 0x94, 0x68, 0x68, 0x95, 0x68, 0x95, 0x95, 0x68, 0x95, 0x68, 0x95, 0x67, 0x68, 0x68, 0x68, 0x6a, 0x68, 0x68, 0x67, 0x68, 0x93, 0x98, 0x98, 0x95, 0x98, 0x95, 0x68, 0x95, 0x69, 0x68, 0x69, 0x68, 0x68, 0x68, 0x67, 0x8f, 0x8e, 0x8f, 0x6a, 0xa0, 0x6a, 0x8e, 0x8d, 0x6c, 0xa7, 0xc4, 0xcc, 0xb7, 0xc4, 0xd3, 0xd8, 0xd3, 0x77, 0xdd, 0x71, 0xe2, 0x7c, 0x79, 0x85, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x3f, 0x45, 0x70, 0x78, 0x6f, 0xb7, 0xc9, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xc1, 0xbc, 0xbe, 0xbc, 0xc2, 0xc2, 0xc2, 0xc2, 0xb7, 0xb9, 0xb7, 0xc2, 0xb9, 0xb0, 0xb0, 0xb9, 0xb9, 0xbc, 0xb9, 0xba, 0xd5, 0xe6, 0xee, 0xe6, 0xe4, 0xe6, 0xe6, 0xe4, 0xee, 0xd5, 0xb2, 0xb6, 0xb9, 0xb8, 0xb5, 0xad, 0xbc, 0xb9, 0xdd, 0xec, 0xec, 0xef, 0xee, 0xeb, 0xe6, 0xe6, 0xee, 0xee, 0xdd, 0xad, 0xa3, 0xb8, 0xac, 0xb2, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xd0, 0xec, 0xee, 0xe4, 0xe4, 0xf8, 0xf7, 0xe6, 0xe4, 0xee, 0xdd, 0xa7, 0xa3, 0xb1, 0xab, 0xa4, 0xa7, 0xa3, 0xa4, 0xae, 0xab, 0xa4, 0xc6, 0xe9, 0xeb, 0xe7, 0xe6, 0xfa, 0xe4, 0xe6, 0xe9, 0xee, 0xb8, 0xa7, 0x9c, 0xa4, 0xa0, 0xa2, 0xa5, 0x9d, 0xa7, 0xa7, 0x99, 0x97, 0xb9, 0xe1, 0xe5, 0xdd, 0xdf, 0xdf, 0xe1, 0xdc, 0xe1, 0xec, 0xd9, 0xa6, 0x9a, 0xa0, 0x9c, 0x9c, 0x9c, 0x99, 0xa8, 0xc9, 0xc9, 0xcd, 0xc7, 0xc9, 0xc7, 0xc3, 0xc3, 0xc0, 0xc7, 0xd2, 0xc0, 0xd2, 0xc3, 0xc3, 0x9c, 0x98, 0x93, 0xa0, 0x93, 0x65, 0x93, 0xa3, 0x9c, 0xa1, 0xce, 0xc7, 0x6f, 0xcd, 0x73, 0x72, 0x43, 0x2f, 0x29, 0x1e, 0x1b, 0x1e, 0x1b, 0x1e, 0x20, 0x26, 0x6e, 0x6e, 0x6e, 0x69, 0x69, 0x6d, 0x9b, 0x8f, 0x94, 0x94, 0x94, 0x94, 0x94, 0x68, 0x94, 0x68, 0x94, 0x94, 0x94, 0x68, 0x94, 0x68, 0x94, 0x68, 0x95, 0x68, 0x68, 0x68, 0x68, 0x95, 0x68, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x68, 0x95, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x95, 0x68, 0x95, 0x95, 0x68, 0x95, 0x68, 0x9b, 0x68, 0x67, 0x67, 0x67, 0x68, 0x67, 0x95, 0x93, 0x93, 0x98, 0x98, 0x98, 0x93, 0x68, 0x67, 0x68, 0x95, 0x68, 0x68, 0x69, 0x68, 0x69, 0x94, 0x67, 0x9b, 0x95, 0x91, 0x93, 0x91, 0x97, 0xac, 0xb6, 0xd3, 0x6f, 0xcd, 0xed, 0xf0, 0x7a, 0xe2, 0xe2, 0x7a, 0x76, 0xe2, 0x76, 0x9e, 0x89, 0x5a, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x41, 0x41, 0x78, 0x73, 0xbb, 0xc6, 0xc1, 0xc1, 0xc1, 0xc3, 0xc2, 0xc3, 0xc3, 0xc1, 0xc1, 0xb9, 0xc1, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xb7, 0xc2, 0xb0, 0xbc, 0xc7, 0xbc, 0xb6, 0xba, 0xb2, 0xba, 0xd1, 0xe1, 0xec, 0xec, 0xee, 0xee, 0xee, 0xe1, 0xc2, 0xad, 0xb2, 0xb5, 0xb2, 0xb8, 0xb8, 0xa8, 0xb9, 0xe5, 0xf1, 0xe6, 0xf8, 0xe6, 0xfa, 0xe6, 0xe6, 0xef, 0xec, 0xdd, 0xa8, 0xa6, 0xb8, 0xb2, 0xac, 0xad, 0xac, 0xac, 0xac, 0xac, 0xac, 0xb5, 0xe1, 0xe5, 0xe6, 0xef, 0xef, 0xeb, 0xeb, 0xec, 0xdd, 0xac, 0x9c, 0xb1, 0xab, 0x9c, 0xab, 0xa7, 0xa9, 0xa9, 0xa7, 0xa9, 0x9c, 0xa7, 0xba, 0xd5, 0xf7, 0xe6, 0xec, 0xeb, 0xe5, 0xd5, 0xbe, 0xa8, 0x9c, 0xa3, 0xa4, 0xa0, 0xa2, 0xa5, 0xa2, 0xa4, 0xa3, 0xa3, 0x9c, 0xb1, 0xd5, 0xe5, 0xec, 0xe5, 0xe6, 0xe5, 0xe4, 0xe5, 0xee, 0xe1, 0xae, 0x9c, 0xa2, 0xa0, 0x9c, 0x9c, 0x99, 0xa6, 0xb9, 0xd0, 0xce, 0xc9, 0xd2, 0xd5, 0xd6, 0xd5, 0xd6, 0xc7, 0xce, 0xc7, 0xd0, 0xc6, 0xbb, 0x98, 0x99, 0x98, 0x98, 0xa0, 0x9b, 0xa0, 0x98, 0x8e, 0xbb, 0xd2, 0x6f, 0x6f, 0x73, 0x72, 0x6e, 0x2f, 0x26, 0x26, 0x22, 0x1d, 0x20, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x29, 0x6e, 0x49, 0x69, 0x8e, 0x6a, 0x8d, 0x95, 0x93, 0x94, 0x95, 0x94, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x95, 0x68, 0x68, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x68, 0x95, 0x68, 0x93, 0x95, 0x95, 0x95, 0x68, 0x95, 0x68, 0x68, 0x95, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x95, 0x68, 0x95, 0x95, 0x68, 0x95, 0x68, 0x68, 0x95, 0x68, 0x95, 0x68, 0x98, 0x6a, 0x6a, 0x6a, 0x91, 0x93, 0x98, 0x93, 0x98, 0x98, 0x93, 0x93, 0x67, 0x93, 0x93, 0x95, 0x67, 0x67, 0x8f, 0x67, 0x67, 0xa4, 0x93, 0x65, 0x97, 0xab, 0xb7, 0xbb, 0xcd, 0xcd, 0xea, 0xed, 0xbd, 0x5e, 0x87, 0x8a, 0x89, 0x85, 0x5a, 0x88, 0x84, 0x5b, 0x5a, 0x82, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x27, 0x45, 0x33, 0x74, 0x73, 0x6f, 0xbb, 0xc3, 0xc1, 0xc6, 0xc2, 0xc3, 0xc2, 0xc3, 0xc2, 0xbe, 0xbc, 0xba, 0xb9, 0xbc, 0xc2, 0xc5, 0xc2, 0xc2, 0xc2, 0xb9, 0xc2, 0xc1, 0xb5, 0xb2, 0xbc, 0xbc, 0xb8, 0xb9, 0xc6, 0xd1, 0xd1, 0xca, 0xc2, 0xc7, 0xb9, 0xb0, 0xb5, 0xbf, 0xb2, 0xa9, 0xb5, 0xba, 0xbe, 0xc3, 0xd9, 0xe6, 0xe6, 0xeb, 0xef, 0xeb, 0xeb, 0xfa, 0xdc, 0xc7, 0xad, 0xad, 0xb2, 0xb8, 0xad, 0xb2, 0xac, 0xb1, 0xac, 0xae, 0xac, 0xac, 0xa3, 0xc6, 0xd0, 0xd1, 0xdd, 0xf6, 0xf4, 0xd7, 0xc9, 0xba, 0xa3, 0xa3, 0xb1, 0xae, 0xa3, 0xab, 0xa7, 0xab, 0xa7, 0xa3, 0xa9, 0xa9, 0xa3, 0xa3, 0xa8, 0xb0, 0xad, 0xa1, 0xa1, 0xad, 0xac, 0x99, 0xa3, 0x9c, 0xa7, 0xa7, 0xa0, 0xa0, 0xa5, 0xa0, 0xa5, 0xa5, 0xa4, 0x9c, 0x93, 0x92, 0xa3, 0xb0, 0xd0, 0xce, 0xd3, 0xd9, 0xd0, 0xbe, 0xa6, 0x91, 0x9b, 0xa2, 0xa0, 0x9b, 0x9c, 0x9c, 0xa1, 0xad, 0xc9, 0xcd, 0xd5, 0xe2, 0xe6, 0xea, 0xe6, 0xeb, 0xf7, 0xda, 0xbf, 0xce, 0xd3, 0xad, 0x91, 0x9c, 0xa0, 0x8f, 0x6a, 0x93, 0x95, 0x8f, 0x8f, 0xd0, 0xd0, 0x6f, 0x73, 0x71, 0x43, 0x28, 0x26, 0x22, 0x1d, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x60, 0x63, 0x60, 0x1b, 0x1b, 0xd9, 0x7c, 0x7b, 0xe9, 0xbb, 0x93, 0x98, 0x93, 0x95, 0x68, 0x68, 0x68, 0x68, 0x68, 0x95, 0x95, 0x95, 0x68, 0x95, 0x95, 0x95, 0x68, 0x95, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x95, 0x95, 0x95, 0x68, 0x95, 0x95, 0x68, 0x95, 0x68, 0x68, 0x95, 0x68, 0x95, 0x95, 0x95, 0x95, 0x68, 0x95, 0x68, 0x68, 0x95, 0x68, 0x95, 0x95, 0x67, 0x68, 0x98, 0x6a, 0x95, 0x95, 0x67, 0x93, 0x98, 0x9a, 0x9c, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa3, 0xa0, 0x9c, 0x99, 0x9a, 0x99, 0x9a, 0x9a, 0x93, 0x93, 0xac, 0xbe, 0xc4, 0x6f, 0xd6, 0x7a, 0xe8, 0xaa, 0x7f, 0x5a, 0x80, 0x84, 0x89, 0x87, 0x13, 0x5b, 0x87, 0x5b, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x5b, 0x02, 0x4e, 0x28, 0x49, 0x73, 0x6f, 0xbf, 0xc6, 0xc1, 0xc6, 0xc3, 0xc6, 0xc3, 0xc3, 0xc3, 0xc1, 0xbe, 0xc1, 0xbc, 0xb8, 0xb9, 0xbc, 0xc1, 0xb9, 0xb9, 0xc2, 0xba, 0xb9, 0xb5, 0xba, 0xbc, 0xbc, 0xba, 0xae, 0xac, 0xb8, 0xb9, 0xb9, 0xbf, 0xc2, 0xb2, 0xb0, 0xba, 0xc6, 0xb2, 0xae, 0xb3, 0xb3, 0xb8, 0xa8, 0x9f, 0xad, 0xc0, 0xc7, 0xc0, 0xb4, 0xb0, 0xb7, 0xb0, 0xad, 0xad, 0xb6, 0xb2, 0xa8, 0xac, 0xb2, 0xac, 0xac, 0xae, 0xac, 0xae, 0xae, 0xa9, 0xac, 0xa8, 0xa6, 0xad, 0xad, 0xad, 0xa6, 0x97, 0xa8, 0xb8, 0xa9, 0xa7, 0xae, 0xae, 0xa7, 0xa4, 0xab, 0xa7, 0xa3, 0xab, 0xae, 0xa9, 0xac, 0x99, 0xa3, 0xa7, 0xa6, 0xab, 0xac, 0xa9, 0xa3, 0xa7, 0xa3, 0xa7, 0xa7, 0xa0, 0xa4, 0xa7, 0xa0, 0x9b, 0x9b, 0xa2, 0xa7, 0xa9, 0xa7, 0xa6, 0xa3, 0xa1, 0x97, 0x97, 0x9c, 0x97, 0x99, 0xa4, 0xa9, 0xa2, 0xa2, 0x9b, 0x9b, 0xa0, 0x9c, 0x99, 0xa6, 0xc6, 0xcd, 0xdc, 0xe6, 0xe7, 0xf7, 0xf7, 0xf7, 0xe6, 0xe4, 0xd7, 0xc9, 0xd0, 0xa8, 0x91, 0x9c, 0x93, 0x98, 0x98, 0x6a, 0xa2, 0xa5, 0xb3, 0xc4, 0x71, 0xcf, 0x71, 0x49, 0x2f, 0x26, 0x29, 0x20, 0x1a, 0x1a, 0x1a, 0x60, 0x60, 0x60, 0x62, 0x60, 0x60, 0x20, 0x30, 0x6e, 0x78, 0x71, 0xae, 0x6d, 0x93, 0x97, 0x93, 0x98, 0x93, 0x68, 0x98, 0x69, 0x93, 0x98, 0x93, 0x98, 0x93, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x68, 0x68, 0x95, 0x95, 0x95, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x68, 0x68, 0x68, 0x95, 0x68, 0x95, 0x68, 0x95, 0x67, 0x95, 0x6a, 0x98, 0x67, 0x93, 0x98, 0xa2, 0xae, 0xb3, 0xbb, 0xc4, 0xcc, 0xd0, 0xcc, 0xd0, 0xd0, 0xcc, 0xc4, 0xbe, 0xb8, 0xb6, 0xb2, 0xb2, 0xba, 0xb8, 0xc9, 0xd3, 0xc6, 0xc0, 0xda, 0xed, 0xcf, 0x88, 0x5a, 0x7e, 0x81, 0x00, 0x00, 0x86, 0x86, 0x00, 0x87, 0x61, 0x13, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x5a, 0x15, 0x4f, 0x2d, 0x33, 0x74, 0x73, 0xc4, 0xc4, 0xc3, 0xc6, 0xc2, 0xc2, 0xc2, 0xc7, 0xbf, 0xc3, 0xbc, 0xc4, 0xc5, 0xc1, 0xbc, 0xc1, 0xc1, 0xba, 0xbc, 0xc1, 0xbc, 0xb5, 0xbc, 0xc1, 0xba, 0xb3, 0xc1, 0xba, 0xba, 0xba, 0xb9, 0xb9, 0xb9, 0xb6, 0xc2, 0xb2, 0xb5, 0xb5, 0xb5, 0xba, 0xba, 0xb3, 0xb2, 0xbe, 0xb9, 0xb9, 0xb7, 0xad, 0xad, 0xb7, 0xb7, 0xb0, 0xb0, 0xb9, 0xb6, 0xb2, 0xad, 0xb5, 0xb1, 0xac, 0xb1, 0xac, 0xae, 0xae, 0xab, 0xae, 0xb5, 0xab, 0xac, 0xb2, 0xad, 0xb0, 0xb9, 0xb0, 0xb2, 0xa9, 0xa9, 0xab, 0xa7, 0xa4, 0xa9, 0xa7, 0xa7, 0xab, 0xa7, 0xa7, 0xab, 0xa3, 0x9c, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa3, 0x9c, 0xa3, 0xab, 0xa7, 0xa0, 0xa3, 0xa4, 0xa0, 0xa7, 0xa7, 0x9d, 0xa5, 0xa5, 0xa2, 0x9d, 0x9c, 0x9c, 0xa3, 0xa1, 0xa3, 0xa6, 0xa9, 0xa3, 0xa3, 0xa7, 0xa9, 0x6a, 0x9d, 0xa2, 0x9b, 0x9b, 0xa5, 0x9c, 0x99, 0x99, 0xad, 0xc3, 0xdf, 0xe7, 0xeb, 0xf7, 0xf5, 0xf8, 0xf5, 0xec, 0xe5, 0xc6, 0xc6, 0xa1, 0x99, 0x98, 0x6a, 0xa0, 0x8e, 0x95, 0x68, 0x8e, 0xb3, 0xd3, 0x6f, 0x71, 0x70, 0x3d, 0x28, 0x29, 0x29, 0x1a, 0x1a, 0x62, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x29, 0x5d, 0x6e, 0x7b, 0x65, 0x6c, 0x97, 0x93, 0x99, 0x93, 0x98, 0x68, 0x69, 0x68, 0x98, 0x68, 0x98, 0x68, 0x98, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x95, 0x68, 0x93, 0x98, 0x93, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x95, 0x95, 0x95, 0x93, 0x95, 0x93, 0x93, 0x93, 0xa3, 0xb8, 0xcc, 0xcc, 0xd0, 0xd9, 0xdd, 0xe1, 0xe4, 0xe5, 0xe5, 0xe4, 0xe1, 0xdf, 0xd8, 0xd0, 0xcd, 0xcd, 0xc7, 0xc6, 0xc9, 0xc9, 0xb7, 0xd2, 0xea, 0xe2, 0x96, 0x7e, 0xfe, 0x7e, 0x00, 0xfe, 0x00, 0x00, 0x83, 0x61, 0x86, 0x61, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x14, 0x45, 0x33, 0x33, 0x43, 0x73, 0x49, 0x6f, 0xc4, 0xc2, 0xbc, 0xc2, 0xc2, 0xbf, 0xc6, 0xc9, 0xc3, 0xc3, 0xbe, 0xbe, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xba, 0xb8, 0xb9, 0xb8, 0xb8, 0xb8, 0xb5, 0xb3, 0xb5, 0xb8, 0xb5, 0xb6, 0xb8, 0xb6, 0xb2, 0xb6, 0xb2, 0xb6, 0xb2, 0xb6, 0xb2, 0xb2, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xac, 0xac, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xab, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa4, 0xa0, 0xa4, 0xa3, 0xa0, 0xa3, 0xa3, 0x9c, 0xa3, 0x9c, 0xa3, 0xa0, 0xa3, 0xa0, 0x9d, 0xa2, 0x9d, 0x9b, 0x9d, 0x9b, 0x9c, 0x9c, 0x9c, 0xad, 0xc6, 0xd9, 0xe2, 0xe7, 0xe7, 0xea, 0xeb, 0xe6, 0xdf, 0xd0, 0xc9, 0x93, 0x95, 0x95, 0x95, 0x9b, 0x68, 0x9b, 0x98, 0x9b, 0xbb, 0xcc, 0x6f, 0xd8, 0x49, 0x28, 0x2c, 0x2b, 0x1d, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1b, 0x1b, 0x7c, 0x71, 0x6c, 0x92, 0x97, 0x93, 0x93, 0x68, 0x69, 0x69, 0x69, 0x68, 0x98, 0x68, 0x98, 0x68, 0x68, 0x68, 0x67, 0x68, 0x67, 0x67, 0x68, 0x67, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x67, 0x68, 0x67, 0x68, 0x93, 0x68, 0x98, 0x6a, 0x6a, 0x68, 0x68, 0x8f, 0x69, 0x69, 0x67, 0x67, 0x67, 0x94, 0x8f, 0x94, 0x9a, 0x91, 0x93, 0xa8, 0xbb, 0xbe, 0xc9, 0xd3, 0xdf, 0xed, 0xea, 0xdb, 0xc8, 0xbd, 0xaf, 0x90, 0xaa, 0xb4, 0xd4, 0xe2, 0xe7, 0xea, 0xe7, 0xfa, 0xe2, 0xda, 0xd4, 0x7a, 0xed, 0xd4, 0x84, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x17, 0x86, 0xff, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2d, 0x45, 0x25, 0x3d, 0x70, 0x70, 0xc4, 0x6f, 0xc3, 0xc2, 0xc5, 0xc2, 0xc2, 0xc3, 0xc6, 0xc3, 0xc4, 0xc3, 0xbe, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xb8, 0xba, 0xb8, 0xba, 0xb5, 0xb8, 0xb8, 0xb8, 0xb5, 0xb5, 0xb8, 0xb8, 0xb5, 0xb5, 0xb8, 0xb2, 0xb5, 0xb5, 0xb5, 0xb5, 0xb2, 0xb5, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xab, 0xab, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa0, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9d, 0x9d, 0x9d, 0x9d, 0xa0, 0x9b, 0x9c, 0x9c, 0xa3, 0xad, 0xc9, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd2, 0xc9, 0xc6, 0xbe, 0x93, 0x9a, 0x9b, 0x6a, 0x9b, 0x95, 0x6a, 0x98, 0x9a, 0xbe, 0xd0, 0xc4, 0x74, 0x43, 0x2a, 0x2c, 0x29, 0x63, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1a, 0x62, 0x60, 0x60, 0x60, 0x60, 0x62, 0x60, 0x5f, 0x6e, 0xec, 0xbb, 0x6c, 0x99, 0x92, 0x98, 0x67, 0x8e, 0x67, 0x69, 0x68, 0x8f, 0x98, 0x67, 0x69, 0x68, 0x69, 0x69, 0x68, 0x68, 0x68, 0x67, 0x68, 0x67, 0x67, 0x68, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x98, 0x68, 0x93, 0x68, 0x68, 0x98, 0x6a, 0x69, 0x8e, 0x69, 0x6c, 0x67, 0x94, 0x94, 0x94, 0x9a, 0x93, 0x99, 0xad, 0xc9, 0xd8, 0xdd, 0xe1, 0xea, 0x77, 0x90, 0x90, 0x84, 0x5a, 0x87, 0x5a, 0x5a, 0x5a, 0x5a, 0x7e, 0x7f, 0x87, 0x8b, 0xaa, 0xcf, 0xe0, 0x7a, 0xe3, 0xc8, 0x90, 0x84, 0x5a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x13, 0x17, 0x50, 0x25, 0x2a, 0x43, 0x72, 0x72, 0xbb, 0xc7, 0xc7, 0xc7, 0xc5, 0xc2, 0xc1, 0xbe, 0xc3, 0xc3, 0xc3, 0xc1, 0xbe, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb5, 0xba, 0xb8, 0xba, 0xb5, 0xba, 0xb5, 0xb8, 0xb5, 0xb8, 0xb5, 0xb8, 0xb5, 0xb5, 0xb8, 0xb2, 0xb5, 0xb2, 0xb5, 0xb5, 0xb2, 0xb5, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xab, 0xab, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa5, 0xa7, 0xa4, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa3, 0x9d, 0xa3, 0x9d, 0xa3, 0x9d, 0xa3, 0x9d, 0xa3, 0x9d, 0xa0, 0x9d, 0xa0, 0x9b, 0x9d, 0x9d, 0xa0, 0x9a, 0x99, 0x9c, 0xb7, 0xc4, 0xc7, 0xc7, 0xc7, 0xc0, 0xc7, 0xc7, 0xc6, 0xbe, 0x98, 0x9b, 0x9b, 0x68, 0x9b, 0x95, 0x6a, 0x9a, 0x9a, 0xbb, 0xcc, 0x6f, 0x71, 0x41, 0x28, 0x2c, 0x29, 0x1a, 0x60, 0x60, 0x60, 0x60, 0x62, 0x60, 0x1a, 0x60, 0x60, 0x1a, 0x62, 0x60, 0x1a, 0x60, 0x1b, 0x7a, 0x78, 0xbb, 0xb0, 0x97, 0x92, 0x93, 0xa2, 0x69, 0x8f, 0x68, 0x93, 0x68, 0x93, 0x95, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x95, 0x6a, 0x95, 0x8f, 0x67, 0x68, 0x9b, 0x9b, 0x6a, 0x67, 0x8f, 0x6a, 0x98, 0x95, 0x67, 0x95, 0x68, 0x95, 0x68, 0x69, 0x69, 0x68, 0x67, 0x94, 0x94, 0x8f, 0x8f, 0xa1, 0xcc, 0xd8, 0x71, 0x77, 0x7c, 0x79, 0x6b, 0x5a, 0x84, 0x87, 0x7f, 0x84, 0x87, 0x82, 0x5a, 0x13, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x7e, 0x7f, 0x8a, 0x82, 0x5b, 0x82, 0x87, 0x82, 0x81, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x14, 0x48, 0x33, 0x25, 0x36, 0x75, 0x72, 0x70, 0x6f, 0xc0, 0xc0, 0xc2, 0xc7, 0xc1, 0xbe, 0xc1, 0xc3, 0xc1, 0xc3, 0xc1, 0xbe, 0xc1, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xbc, 0xb9, 0xbe, 0xb9, 0xbc, 0xb9, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb5, 0xba, 0xb5, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb5, 0xb8, 0xb5, 0xb8, 0xb2, 0xb5, 0xb5, 0xb2, 0xb5, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xae, 0xae, 0xab, 0xab, 0xae, 0xa9, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0xa0, 0x9d, 0x9d, 0xa0, 0x9d, 0xa0, 0x9b, 0x9c, 0x9a, 0x9c, 0xa6, 0xb9, 0xcd, 0xd0, 0xd2, 0xce, 0xce, 0xce, 0xd0, 0xb8, 0x99, 0x9a, 0x95, 0x6a, 0x9d, 0x68, 0x9a, 0x98, 0x9a, 0xba, 0xd0, 0xc9, 0x71, 0x3d, 0x23, 0x2e, 0x26, 0x1a, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1a, 0x60, 0x60, 0x60, 0x63, 0x1a, 0x1a, 0x60, 0x63, 0x1b, 0x69, 0x7b, 0xd3, 0x71, 0xb7, 0xa6, 0x97, 0x8f, 0x67, 0x94, 0x95, 0x98, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x93, 0x93, 0x93, 0x93, 0x95, 0x94, 0x8f, 0x8f, 0x8f, 0x93, 0x95, 0x95, 0x93, 0x94, 0x95, 0x95, 0x94, 0x93, 0x94, 0x8f, 0x9b, 0x8f, 0x8e, 0x94, 0x9d, 0x94, 0x9a, 0xb5, 0xd0, 0xbb, 0x74, 0x7c, 0x74, 0x90, 0x24, 0xbd, 0x86, 0x83, 0x89, 0x14, 0x82, 0x5c, 0x5b, 0x82, 0x5a, 0x00, 0x00, 0xff, 0x00, 0xff, 0x14, 0x84, 0x88, 0x82, 0x7f, 0x87, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x24, 0x4b, 0x28, 0x30, 0x4f, 0x49, 0x72, 0x71, 0xc8, 0xc0, 0xc0, 0xc5, 0xcb, 0xbc, 0xc1, 0xc5, 0xc1, 0xc1, 0xc1, 0xc2, 0xbe, 0xc3, 0xbf, 0xbe, 0xbf, 0xbe, 0xbf, 0xbe, 0xbe, 0xb9, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb2, 0xb5, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb2, 0xae, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xae, 0xab, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0x9d, 0x9d, 0x9d, 0x9b, 0xa0, 0xa0, 0xa7, 0x9c, 0x99, 0xa8, 0xc6, 0xd0, 0xc9, 0xce, 0xce, 0xc7, 0xd0, 0xac, 0x98, 0x9d, 0x95, 0x6a, 0x9b, 0x95, 0x9b, 0x99, 0x9a, 0xbb, 0xcc, 0x71, 0x6f, 0x3d, 0x2a, 0x2c, 0x29, 0x1a, 0x62, 0x60, 0x60, 0x60, 0x60, 0x62, 0x1a, 0x60, 0x1a, 0x63, 0x1a, 0x62, 0x1a, 0x62, 0x60, 0x60, 0x72, 0x7c, 0x73, 0xb7, 0xc0, 0xb0, 0x93, 0x91, 0x95, 0x67, 0x8f, 0x67, 0x67, 0x95, 0x94, 0x6a, 0x9a, 0x95, 0x95, 0x93, 0x91, 0x93, 0x91, 0x91, 0x91, 0x9a, 0x95, 0x9a, 0x9d, 0xa4, 0xa4, 0xa3, 0x9c, 0x9d, 0x9a, 0x9a, 0x95, 0x9a, 0x94, 0x95, 0x95, 0x91, 0x93, 0x93, 0x93, 0x9a, 0x9a, 0xac, 0xd3, 0xd8, 0x57, 0x7d, 0x54, 0x3b, 0x19, 0x1c, 0x21, 0x3f, 0x15, 0x5b, 0x61, 0x61, 0x84, 0x00, 0x5a, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x13, 0x87, 0x84, 0x7e, 0x87, 0x83, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x4e, 0x36, 0x2e, 0x4b, 0x38, 0x70, 0x4e, 0x71, 0xc8, 0xc3, 0xc7, 0xc5, 0xbc, 0xc5, 0xbc, 0xc5, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xbf, 0xc3, 0xc3, 0xbe, 0xbf, 0xbe, 0xbe, 0xbc, 0xb9, 0xbc, 0xba, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb5, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb5, 0xb5, 0xb2, 0xb5, 0xb5, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa4, 0xa7, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa3, 0xa0, 0xa4, 0xa3, 0xa0, 0xa4, 0xa0, 0xa0, 0xa0, 0xa0, 0x9d, 0xa2, 0x9d, 0xa0, 0xa0, 0xa4, 0xa0, 0x97, 0x99, 0xb6, 0xc9, 0xcd, 0xce, 0xcd, 0xc6, 0xce, 0xa3, 0x97, 0xa0, 0x9a, 0x6a, 0x9d, 0x98, 0x9a, 0x98, 0x9a, 0xba, 0xcc, 0xc9, 0x72, 0x3d, 0x23, 0x31, 0x29, 0x1a, 0x60, 0x60, 0x60, 0x60, 0x62, 0x1a, 0x60, 0x60, 0x60, 0x1a, 0x1a, 0x63, 0x62, 0x60, 0x60, 0x20, 0x1b, 0x7b, 0x7b, 0x76, 0x6f, 0xc0, 0xc7, 0xb2, 0x9a, 0x95, 0x95, 0x94, 0x93, 0x67, 0x91, 0x67, 0x91, 0x91, 0x91, 0x93, 0x93, 0x9a, 0x9c, 0xa1, 0xa3, 0xa8, 0xa9, 0xb2, 0xba, 0xc6, 0xc9, 0xc6, 0xbe, 0xc3, 0xbe, 0xb1, 0xa9, 0xa3, 0xa1, 0xa3, 0xa3, 0x9c, 0xa8, 0xa6, 0xa3, 0xb9, 0xd9, 0xdd, 0x77, 0x7b, 0x56, 0x56, 0x56, 0x53, 0x45, 0x1c, 0x14, 0x3b, 0x4a, 0x5c, 0x15, 0x17, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x13, 0x01, 0x13, 0x13, 0x00, 0x84, 0x89, 0x89, 0x87, 0x5a, 0x00, 0x81, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xff, 0x5b, 0x3b, 0x43, 0x2c, 0x4b, 0x38, 0x3c, 0x49, 0x70, 0x71, 0x6f, 0xc4, 0xc5, 0xc5, 0xbc, 0xc5, 0xbc, 0xc5, 0xc1, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xbf, 0xc3, 0xbe, 0xbe, 0xbc, 0xbe, 0xbc, 0xb9, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xba, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb5, 0xb8, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xb2, 0xb5, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xac, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa0, 0xa3, 0xa4, 0xa0, 0xa4, 0xa3, 0xa0, 0xa3, 0xa0, 0xa0, 0xa0, 0x9d, 0xa0, 0xa0, 0x9b, 0xa0, 0x9c, 0x9a, 0x6c, 0xab, 0xbe, 0xd3, 0xd0, 0xd1, 0xc9, 0xd0, 0x9c, 0x98, 0xa0, 0x95, 0x6a, 0xa0, 0x98, 0x9a, 0x99, 0x9a, 0xbb, 0xcc, 0x6f, 0x71, 0x3d, 0x2c, 0x2c, 0x2b, 0x1d, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x1a, 0x60, 0x60, 0x1a, 0x1a, 0x62, 0x60, 0x1a, 0x60, 0x29, 0x5d, 0x2b, 0x78, 0x7d, 0x7a, 0x6f, 0xcd, 0xd2, 0xc6, 0xb1, 0xb3, 0xab, 0xa5, 0xa3, 0xa0, 0x9c, 0x9d, 0x9c, 0xa3, 0xa4, 0xa9, 0xb1, 0xb8, 0xbe, 0xbe, 0xd8, 0xd0, 0x6f, 0xcd, 0xcd, 0xdd, 0x77, 0xe1, 0x77, 0xda, 0xd8, 0xd8, 0xd0, 0xcd, 0x6f, 0x6f, 0x71, 0xcd, 0xcd, 0xd6, 0x7a, 0xea, 0x78, 0x76, 0x48, 0x4a, 0x0d, 0x10, 0x12, 0x0f, 0x0a, 0x04, 0x18, 0x42, 0x41, 0x15, 0xff, 0x01, 0xff, 0x81, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x01, 0x5a, 0x83, 0x86, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x5b, 0x1c, 0x49, 0x2a, 0x4d, 0x44, 0x23, 0x42, 0x70, 0x72, 0x6f, 0xbb, 0xc6, 0xc5, 0xc5, 0xbc, 0xc5, 0xbc, 0xc5, 0xc1, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb9, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb5, 0xb5, 0xb2, 0xb5, 0xb2, 0xb5, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa9, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa3, 0xa0, 0xa4, 0xa3, 0xa0, 0xa4, 0xa0, 0xa3, 0xa0, 0xa0, 0x9d, 0xa0, 0x9d, 0xa0, 0xa5, 0x9b, 0xa0, 0xa7, 0xa3, 0x99, 0xae, 0xd0, 0xce, 0xcd, 0xc6, 0xd0, 0x99, 0x99, 0xa0, 0x9a, 0x6a, 0xa0, 0x98, 0x9a, 0x98, 0x9a, 0xb8, 0xcc, 0xc4, 0x73, 0x43, 0x2a, 0x2e, 0x2b, 0x1a, 0x1a, 0x60, 0x60, 0x60, 0x1a, 0x62, 0x60, 0x60, 0x60, 0x60, 0x62, 0x60, 0x60, 0x60, 0x62, 0x60, 0x20, 0x1b, 0x2f, 0x78, 0x57, 0x7b, 0x76, 0xcf, 0x6f, 0xcd, 0xcc, 0xc9, 0xc9, 0xc4, 0xc9, 0xc9, 0xc9, 0xc9, 0xc4, 0xc9, 0xc9, 0xc4, 0xc9, 0xc9, 0xcd, 0x6f, 0xd4, 0x77, 0xe8, 0x7c, 0xe8, 0x77, 0xd4, 0x76, 0xe0, 0x7a, 0x7b, 0xed, 0x7b, 0x7b, 0x79, 0x7b, 0x56, 0xed, 0x7b, 0xdb, 0x90, 0x61, 0x24, 0x09, 0x09, 0x09, 0x09, 0x53, 0x12, 0x11, 0x53, 0x42, 0x1f, 0x3b, 0x4e, 0x19, 0xff, 0x01, 0xff, 0x00, 0x5a, 0xfe, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x81, 0x5a, 0x5a, 0x5a, 0xfe, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x5b, 0x45, 0x47, 0x39, 0x4d, 0x37, 0x23, 0x32, 0x70, 0x73, 0xbb, 0xc4, 0xcb, 0xc5, 0xbc, 0xbc, 0xd1, 0xc5, 0xb9, 0xc5, 0xc2, 0xc5, 0xb9, 0xcb, 0xc2, 0xb5, 0xcb, 0xcb, 0xba, 0xc1, 0xc1, 0xc1, 0xbc, 0xb9, 0xbc, 0xba, 0xb9, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb6, 0xb5, 0xb8, 0xb5, 0xb8, 0xb2, 0xb8, 0xb8, 0xac, 0xac, 0xb5, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xae, 0xab, 0xac, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa3, 0xa0, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0x9b, 0x9c, 0xa4, 0xa5, 0x9c, 0x6a, 0xab, 0xc4, 0xc9, 0xce, 0xd0, 0xb2, 0x9c, 0x9a, 0x9b, 0x9d, 0x9b, 0x9b, 0x6a, 0x9c, 0x9a, 0x98, 0xa9, 0xd0, 0xcc, 0x71, 0x49, 0x2a, 0x2c, 0x2e, 0x20, 0x20, 0x60, 0x62, 0x60, 0x62, 0x1a, 0x62, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1a, 0x1a, 0x1a, 0x1b, 0x20, 0x30, 0x75, 0x57, 0x57, 0x56, 0xe8, 0x76, 0xd2, 0x6f, 0xc0, 0x6f, 0x6f, 0x6f, 0xc0, 0x6f, 0xc0, 0x6f, 0xc0, 0x6f, 0xdd, 0x77, 0x7a, 0x56, 0x57, 0x56, 0x76, 0x52, 0x74, 0x48, 0x61, 0x16, 0x17, 0x15, 0x34, 0x54, 0x56, 0x57, 0x58, 0x54, 0x50, 0x48, 0x34, 0x16, 0x5b, 0x02, 0x3b, 0x09, 0x0a, 0x0a, 0x07, 0x0a, 0x0e, 0x11, 0x12, 0x55, 0x0b, 0x27, 0x2d, 0x4e, 0x34, 0x5b, 0x5a, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0x13, 0x13, 0x19, 0x4e, 0x2d, 0x4d, 0x35, 0x35, 0x29, 0x2f, 0x72, 0x75, 0xbb, 0xb7, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xb5, 0xc2, 0xbc, 0xc5, 0xc5, 0xb5, 0xd1, 0xcb, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xbc, 0xb9, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb2, 0xb8, 0xb5, 0xb2, 0xb2, 0xb8, 0xb2, 0xb2, 0xb5, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xab, 0xac, 0xab, 0xae, 0xac, 0xab, 0xab, 0xac, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa0, 0xa4, 0xa0, 0xa0, 0xa4, 0xa0, 0xa0, 0xa0, 0xa0, 0xa2, 0xa4, 0xa0, 0x99, 0xa7, 0xbb, 0xd0, 0xd3, 0xc9, 0xac, 0x99, 0x9a, 0x9a, 0x9b, 0x9a, 0x9b, 0x9a, 0x9b, 0x9a, 0x99, 0xa7, 0xcc, 0xc9, 0x71, 0x70, 0x2f, 0x2c, 0x31, 0x29, 0x63, 0x60, 0x60, 0x63, 0x62, 0x1a, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1a, 0x1a, 0x1a, 0x63, 0x1a, 0x1e, 0x3e, 0x75, 0x56, 0x56, 0x56, 0xfd, 0xed, 0xe8, 0xe8, 0x79, 0xe0, 0x79, 0x79, 0x79, 0x79, 0xe8, 0xf2, 0x7c, 0xe0, 0x77, 0x79, 0x54, 0x52, 0x0d, 0x52, 0x48, 0x0d, 0x0d, 0x2d, 0x16, 0xff, 0x16, 0x34, 0x48, 0x48, 0x52, 0x53, 0x10, 0x56, 0x0c, 0x2d, 0x02, 0x16, 0x27, 0x0a, 0x0a, 0x08, 0x08, 0x0a, 0x08, 0x08, 0x0e, 0x11, 0x12, 0x0f, 0x53, 0x39, 0x27, 0x45, 0x4a, 0x17, 0x14, 0x80, 0xfe, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0x5a, 0x5a, 0xff, 0x3f, 0x42, 0x4c, 0x44, 0x2c, 0x2c, 0x23, 0x2f, 0x72, 0x71, 0x71, 0xb6, 0xcc, 0xc6, 0xc1, 0xbc, 0xc1, 0xcb, 0xbc, 0xc5, 0xc2, 0xbc, 0xcb, 0xb5, 0xd5, 0xd1, 0xbc, 0xc1, 0xc1, 0xbc, 0xc1, 0xb9, 0xbc, 0xba, 0xbc, 0xb9, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xba, 0xb2, 0xb2, 0xb8, 0xb8, 0xb2, 0xb2, 0xb5, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xb1, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xab, 0xae, 0xac, 0xab, 0xac, 0xab, 0xac, 0xa9, 0xac, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa0, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0x9c, 0x9b, 0xa4, 0xae, 0xd0, 0xd0, 0xc4, 0xa9, 0x9c, 0x9a, 0xa0, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9d, 0x98, 0xa4, 0xc4, 0xc9, 0xd0, 0x72, 0x39, 0x23, 0x31, 0x2b, 0x22, 0x1a, 0x62, 0x63, 0x63, 0x62, 0x1a, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x63, 0x1a, 0x62, 0x1a, 0x1a, 0x1a, 0x20, 0x2f, 0x4d, 0x53, 0x56, 0x54, 0x56, 0xe8, 0x54, 0x79, 0x56, 0xe8, 0x56, 0xe8, 0x54, 0xaa, 0x24, 0x89, 0x1c, 0xaf, 0x48, 0x52, 0x48, 0x0d, 0x52, 0x0d, 0x0d, 0x52, 0x0a, 0x1c, 0x01, 0x1c, 0x0c, 0x0a, 0x0a, 0x0c, 0x0c, 0x0c, 0x0f, 0x11, 0x0e, 0x06, 0x1c, 0x06, 0x0a, 0x0a, 0x08, 0x08, 0x0a, 0x08, 0x08, 0x08, 0x0e, 0x10, 0x11, 0x11, 0x55, 0x04, 0x27, 0x33, 0x33, 0x61, 0x17, 0x14, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x13, 0x13, 0x5a, 0x13, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x13, 0x00, 0x00, 0x5a, 0x17, 0x48, 0x4a, 0x4d, 0x2a, 0x36, 0x31, 0x1e, 0x28, 0x43, 0x78, 0xbb, 0x71, 0xbb, 0xcc, 0xc9, 0xbc, 0xc5, 0xcb, 0xbc, 0xc5, 0xbc, 0xcb, 0xc2, 0xd9, 0xd9, 0xc2, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbe, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xb8, 0xb9, 0xb8, 0xb8, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb6, 0xb5, 0xc3, 0xba, 0xb2, 0xb5, 0xba, 0xb2, 0xb2, 0xb8, 0xb5, 0xb1, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xac, 0xae, 0xac, 0xac, 0xae, 0xac, 0xab, 0xac, 0xab, 0xac, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa0, 0xa3, 0xa4, 0xa0, 0xa4, 0xa0, 0x9c, 0xa4, 0xa0, 0x9c, 0xa0, 0xa4, 0xbe, 0xb8, 0xac, 0xa3, 0x9a, 0xa0, 0xa2, 0xa0, 0x9b, 0x9b, 0x9b, 0x9b, 0x9c, 0x9a, 0xa3, 0xba, 0xc9, 0xcd, 0x73, 0x43, 0x2a, 0x2c, 0x2b, 0x29, 0x63, 0x63, 0x63, 0x1a, 0x63, 0x1a, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x63, 0x1a, 0x63, 0x1a, 0x62, 0x62, 0x1a, 0x1a, 0x1e, 0x2a, 0x43, 0x4e, 0x54, 0x54, 0x48, 0x1c, 0x16, 0x21, 0x48, 0x54, 0x52, 0x52, 0x2d, 0xff, 0x13, 0x1c, 0x48, 0x54, 0x0c, 0x0d, 0x09, 0x07, 0x0c, 0x0a, 0x0a, 0x0d, 0x06, 0x02, 0x07, 0x0c, 0x0c, 0x0a, 0x0c, 0x0a, 0x0a, 0x0a, 0x0c, 0x10, 0x0f, 0x0c, 0x07, 0x09, 0x08, 0x0a, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x05, 0x0e, 0x10, 0x11, 0x10, 0x10, 0x4c, 0x27, 0x18, 0x14, 0x1f, 0x6b, 0x34, 0x86, 0x5a, 0x00, 0xff, 0x5a, 0x5a, 0x13, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x7e, 0x00, 0x00, 0x01, 0x00, 0x34, 0x4a, 0x49, 0x3c, 0x36, 0x36, 0x31, 0x23, 0x1e, 0x43, 0x75, 0x73, 0x43, 0xbb, 0x6f, 0xbe, 0xc1, 0xc5, 0xc5, 0xc5, 0xb9, 0xd1, 0xcb, 0xdc, 0xdf, 0xc6, 0xc3, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xb9, 0xba, 0xb9, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xb8, 0xb9, 0xb8, 0xb8, 0xb9, 0xb5, 0xb8, 0xc6, 0xc6, 0xb8, 0xac, 0xb8, 0xb2, 0xac, 0xba, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xac, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xac, 0xae, 0xac, 0xab, 0xac, 0xab, 0xac, 0xa9, 0xac, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa0, 0xa3, 0xa4, 0xa3, 0xa0, 0x9c, 0xa4, 0x9c, 0x9c, 0x9c, 0xa4, 0xa3, 0x9c, 0x9a, 0x9a, 0xa0, 0x9d, 0x9b, 0x9b, 0x9d, 0x9b, 0x9b, 0x9b, 0x9a, 0x9b, 0xb3, 0xcb, 0xc9, 0x71, 0x70, 0x35, 0x23, 0x2b, 0x2b, 0x22, 0x20, 0x1a, 0x1a, 0x1a, 0x20, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x63, 0x1a, 0x62, 0x60, 0x62, 0x62, 0x1a, 0x1a, 0x5d, 0x23, 0x32, 0x4c, 0x51, 0x4e, 0x27, 0x15, 0x17, 0x3b, 0x52, 0x52, 0x52, 0x0d, 0x21, 0x1c, 0x48, 0x52, 0x0d, 0x0d, 0x09, 0x1c, 0x02, 0x3b, 0x0d, 0x0d, 0x0c, 0x0c, 0x07, 0x09, 0x0c, 0x0a, 0x0c, 0x0a, 0x08, 0x0a, 0x0a, 0x0a, 0x09, 0x0e, 0x10, 0x0f, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x0b, 0x11, 0x12, 0x11, 0x10, 0x53, 0x40, 0x16, 0x18, 0x25, 0x41, 0x4a, 0x3f, 0x21, 0x15, 0x13, 0x5b, 0x5a, 0x5a, 0x13, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x14, 0x34, 0x51, 0x47, 0x2c, 0x2c, 0x3a, 0x2e, 0x1e, 0x1e, 0x3d, 0x75, 0x73, 0x71, 0x6f, 0xbb, 0xc6, 0xc1, 0xc5, 0xc5, 0xbc, 0xd1, 0xd7, 0xdf, 0x7a, 0xcd, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xbe, 0xbc, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xb9, 0xba, 0xb9, 0xba, 0xb9, 0xb8, 0xb9, 0xba, 0xb9, 0xb8, 0xb9, 0xb8, 0xb6, 0xb8, 0xc1, 0xd3, 0xc1, 0xac, 0xb5, 0xb2, 0xb2, 0xb8, 0xb5, 0xb2, 0xb5, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xb1, 0xae, 0xb1, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xab, 0xac, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa3, 0xa4, 0xa3, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa0, 0xa2, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9b, 0x9a, 0xa9, 0xcb, 0xca, 0x71, 0x75, 0x43, 0x23, 0x29, 0x2b, 0x2b, 0x22, 0x20, 0x1a, 0x20, 0x62, 0x63, 0x60, 0x62, 0x60, 0x62, 0x62, 0x63, 0x1a, 0x62, 0x62, 0x60, 0x1a, 0x60, 0x22, 0x63, 0x1d, 0x1a, 0x1e, 0x1e, 0x2a, 0x3e, 0x4e, 0x46, 0x3c, 0x42, 0x51, 0x53, 0x53, 0x53, 0x45, 0x09, 0x0d, 0x0c, 0x4c, 0x48, 0x1c, 0x15, 0x14, 0x02, 0x09, 0x0d, 0x0a, 0x0c, 0x0c, 0x0d, 0x0a, 0x0a, 0x0c, 0x0a, 0x0c, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x0d, 0x0f, 0x0c, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0a, 0x03, 0x07, 0x0e, 0x10, 0x12, 0x12, 0x0f, 0x55, 0x4c, 0x27, 0x1f, 0x1f, 0x3b, 0x41, 0x45, 0x24, 0x19, 0x84, 0x5b, 0x5a, 0x5a, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7e, 0x7e, 0x7e, 0x5b, 0x17, 0x4a, 0x4e, 0x39, 0x2c, 0x36, 0x36, 0x3a, 0x20, 0x1f, 0x4b, 0x50, 0x72, 0x71, 0x6f, 0xc3, 0xc5, 0xc5, 0xc2, 0xc2, 0xca, 0xe1, 0x77, 0xed, 0xcd, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbe, 0xbc, 0xbc, 0xbe, 0xbc, 0xbc, 0xba, 0xbc, 0xb9, 0xbe, 0xb9, 0xbe, 0xb9, 0xba, 0xb9, 0xba, 0xb9, 0xb8, 0xb9, 0xba, 0xb9, 0xb8, 0xb9, 0xb8, 0xba, 0xd3, 0xcb, 0xac, 0xb5, 0xb8, 0xb2, 0xb8, 0xb5, 0xb5, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xae, 0xb1, 0xb1, 0xb1, 0xb1, 0xac, 0xb1, 0xac, 0xae, 0xac, 0xac, 0xab, 0xac, 0xa9, 0xac, 0xac, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0x9c, 0xa3, 0xa0, 0x9c, 0xa0, 0xa3, 0x9c, 0xa4, 0xa3, 0xa0, 0xa5, 0xa5, 0xa5, 0xa2, 0x9b, 0x6a, 0xa2, 0x9b, 0x9b, 0x9d, 0x6a, 0x9a, 0x9d, 0xc5, 0xca, 0x6f, 0x74, 0x4d, 0x32, 0x29, 0x2b, 0x29, 0x29, 0x22, 0x20, 0x1d, 0x1a, 0x62, 0x63, 0x62, 0x63, 0x62, 0x62, 0x62, 0x62, 0x60, 0x62, 0x60, 0x60, 0x60, 0x62, 0x62, 0x63, 0x62, 0x1a, 0x22, 0x1d, 0x1d, 0x22, 0x2c, 0x35, 0x37, 0x44, 0x46, 0x4c, 0x4f, 0x51, 0x53, 0x53, 0x51, 0x53, 0x4f, 0x3b, 0x3b, 0x27, 0x21, 0x09, 0x0d, 0x0c, 0x45, 0x0c, 0x0a, 0x0c, 0x09, 0x0a, 0x0a, 0x08, 0x07, 0x09, 0x0a, 0x0a, 0x08, 0x09, 0x0a, 0x0a, 0x0e, 0x0e, 0x0b, 0x0a, 0x08, 0x08, 0x07, 0x05, 0x07, 0x08, 0x08, 0x07, 0x0b, 0x0e, 0x11, 0x12, 0x11, 0x10, 0x55, 0x0b, 0x40, 0x23, 0x23, 0x25, 0x3b, 0x24, 0x17, 0x19, 0x84, 0x5a, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x80, 0x5b, 0x19, 0x51, 0x45, 0x35, 0x37, 0x2e, 0x36, 0x3e, 0x35, 0x42, 0x3d, 0x47, 0x73, 0x71, 0xc4, 0x6f, 0xc6, 0xc2, 0xc6, 0xcd, 0xfa, 0x77, 0xf0, 0xcd, 0xc0, 0xc1, 0xc2, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xbe, 0xbe, 0xbe, 0xbc, 0xbe, 0xba, 0xbc, 0xba, 0xbe, 0xbc, 0xbe, 0xba, 0xbc, 0xbe, 0xba, 0xb9, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xac, 0xd5, 0xd0, 0xac, 0xb5, 0xbe, 0xb2, 0xb5, 0xb5, 0xb2, 0xb5, 0xb2, 0xb5, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xac, 0xae, 0xac, 0xae, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xac, 0xac, 0xac, 0xab, 0xab, 0xa9, 0xa9, 0xab, 0xa9, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0x9c, 0xa4, 0xa3, 0x9c, 0xa1, 0xa0, 0xa3, 0xa4, 0xa3, 0x9c, 0xa0, 0xa0, 0xa0, 0x9d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xa2, 0x9b, 0x95, 0x9c, 0xbc, 0xd1, 0x6f, 0x73, 0x75, 0x3d, 0x2f, 0x26, 0x2b, 0x29, 0x2b, 0x22, 0x20, 0x1a, 0x1a, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x60, 0x63, 0x62, 0x60, 0x60, 0x62, 0x62, 0x62, 0x1a, 0x20, 0x22, 0x1d, 0x1a, 0x1d, 0x1d, 0x1e, 0x1e, 0x23, 0x1e, 0x2a, 0x2c, 0x23, 0x37, 0x39, 0x39, 0x39, 0x44, 0x47, 0x47, 0x4f, 0x4c, 0x4f, 0x0c, 0x45, 0x09, 0x4c, 0x0a, 0x09, 0x0a, 0x27, 0x02, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x08, 0x08, 0x0b, 0x0e, 0x0b, 0x08, 0x07, 0x09, 0x07, 0x08, 0x07, 0x05, 0x07, 0x08, 0x0a, 0x0e, 0x12, 0x11, 0x12, 0x11, 0x0f, 0x53, 0x46, 0x3c, 0x2d, 0x16, 0x15, 0x34, 0x3f, 0x24, 0x13, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x34, 0x4e, 0x42, 0x32, 0x36, 0x3e, 0x2c, 0x37, 0x46, 0x40, 0x28, 0x39, 0x72, 0x50, 0xbb, 0x71, 0xbb, 0x6f, 0xc0, 0xe4, 0xf7, 0xfc, 0xf5, 0xc2, 0xc2, 0xc1, 0xbc, 0xbc, 0xc5, 0xc1, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xb9, 0xbc, 0xbc, 0xba, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb2, 0xcb, 0xe4, 0xac, 0xb8, 0xb2, 0xba, 0xb2, 0xb5, 0xb5, 0xb5, 0xb5, 0xb1, 0xb5, 0xb1, 0xb5, 0xb1, 0xb2, 0xb1, 0xb1, 0xb2, 0xae, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xae, 0xb1, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xab, 0xac, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa3, 0xa0, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9d, 0xa2, 0x9d, 0xa2, 0x9b, 0x9d, 0x9b, 0x9b, 0x9d, 0xa3, 0xce, 0xcd, 0x6f, 0x73, 0x70, 0x3d, 0x25, 0x2b, 0x2b, 0x2b, 0x29, 0x20, 0x20, 0x63, 0x1b, 0x63, 0x63, 0x62, 0x63, 0x62, 0x1a, 0x60, 0x1a, 0x62, 0x62, 0x62, 0x1a, 0x62, 0x62, 0x62, 0x62, 0x1a, 0x62, 0x1a, 0x62, 0x1a, 0x63, 0x20, 0x20, 0x63, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1a, 0x1a, 0x1b, 0x1a, 0x1b, 0x1b, 0x26, 0x35, 0x3e, 0x4f, 0x4f, 0x4e, 0x09, 0x45, 0x09, 0x2d, 0x02, 0x15, 0x1c, 0x3b, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0x05, 0x0a, 0x0b, 0x0f, 0x11, 0x12, 0x11, 0x11, 0x10, 0x55, 0x0b, 0x09, 0x04, 0x33, 0x09, 0x45, 0x16, 0x13, 0x01, 0x01, 0x00, 0x81, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x34, 0x4e, 0x3b, 0x35, 0x2e, 0x40, 0x37, 0x46, 0x46, 0x2a, 0x35, 0x3d, 0x47, 0x78, 0x70, 0x73, 0xd4, 0xd8, 0xe0, 0xeb, 0xef, 0xf8, 0xc7, 0xc2, 0xc5, 0xbc, 0xc5, 0xbc, 0xbc, 0xc5, 0xbe, 0xbe, 0xc3, 0xbe, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbe, 0xbc, 0xb9, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xb2, 0xc5, 0xe1, 0xbc, 0xba, 0xb2, 0xba, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb1, 0xb5, 0xb1, 0xb5, 0xb1, 0xb5, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xac, 0xae, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa4, 0xa7, 0xa3, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0x9c, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9d, 0x9b, 0xa0, 0x9b, 0x9c, 0xa3, 0xc3, 0xd0, 0xcd, 0x71, 0x71, 0x43, 0x32, 0x2a, 0x2c, 0x2b, 0x2b, 0x29, 0x29, 0x22, 0x1b, 0x60, 0x63, 0x62, 0x63, 0x63, 0x62, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x62, 0x63, 0x62, 0x62, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x1a, 0x62, 0x22, 0x62, 0x20, 0x1a, 0x1b, 0x1d, 0x23, 0x32, 0x44, 0x4c, 0x4e, 0x0a, 0x27, 0x15, 0x15, 0x02, 0x2d, 0x09, 0x09, 0x08, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x39, 0x06, 0x06, 0x07, 0x06, 0x07, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x07, 0x08, 0x0b, 0x0e, 0x0f, 0x11, 0x11, 0x12, 0x10, 0x55, 0x0b, 0x04, 0x3b, 0x45, 0x27, 0x13, 0x5a, 0x13, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x13, 0x01, 0x41, 0x4e, 0x2a, 0x35, 0x38, 0x2c, 0x44, 0x4d, 0x38, 0x3e, 0x38, 0x32, 0x43, 0x70, 0x75, 0x78, 0x77, 0x77, 0xfd, 0xfc, 0xe7, 0xce, 0xc7, 0xc2, 0xc5, 0xbc, 0xbc, 0xbc, 0xc5, 0xbe, 0xc3, 0xc3, 0xc3, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbe, 0xbc, 0xba, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb5, 0xbc, 0xdd, 0xd9, 0xbc, 0xb5, 0xb5, 0xba, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb1, 0xb5, 0xb2, 0xb2, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa0, 0xa3, 0xa3, 0xa3, 0xa0, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa2, 0x9d, 0x9b, 0x9d, 0x9b, 0xa1, 0xb2, 0xcd, 0xcd, 0x71, 0x71, 0x70, 0x43, 0x2a, 0x2b, 0x2e, 0x30, 0x29, 0x29, 0x29, 0x29, 0x20, 0x20, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x1a, 0x1a, 0x62, 0x20, 0x63, 0x1d, 0x20, 0x1d, 0x1d, 0x1e, 0x26, 0x2a, 0x38, 0x43, 0x44, 0x42, 0x1f, 0x27, 0x3b, 0x3b, 0x09, 0x09, 0x09, 0x07, 0x09, 0x08, 0x07, 0x07, 0x27, 0x04, 0x07, 0x06, 0x04, 0x06, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x07, 0x07, 0x05, 0x03, 0x03, 0x05, 0x05, 0x08, 0x0a, 0x0f, 0x0f, 0x12, 0x11, 0x53, 0x06, 0x27, 0x45, 0x17, 0x5b, 0x14, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x13, 0x13, 0x15, 0x33, 0x4e, 0x39, 0x2a, 0x35, 0x3a, 0x4f, 0x36, 0x39, 0x38, 0x39, 0x32, 0x42, 0x70, 0x74, 0x74, 0x78, 0xed, 0xe8, 0xf0, 0xd6, 0xca, 0xc2, 0xc5, 0xc5, 0xbc, 0xbc, 0xc5, 0xc3, 0xc3, 0xc3, 0xbf, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xc1, 0xbc, 0xbc, 0xbe, 0xbc, 0xb9, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xb2, 0xd5, 0xe4, 0xc5, 0xb2, 0xb2, 0xba, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb1, 0xb5, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xac, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xab, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa4, 0xa7, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa3, 0xa0, 0xa3, 0xa4, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c, 0x9a, 0xa8, 0xc6, 0xd0, 0x6f, 0x73, 0x74, 0x70, 0x3e, 0x2a, 0x29, 0x31, 0x30, 0x29, 0x29, 0x30, 0x22, 0x29, 0x22, 0x22, 0x20, 0x63, 0x20, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x20, 0x63, 0x20, 0x63, 0x1d, 0x63, 0x1d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x20, 0x22, 0x22, 0x22, 0x20, 0x1d, 0x1a, 0x63, 0x20, 0x20, 0x22, 0x20, 0x1b, 0x1a, 0x1b, 0x22, 0x30, 0x36, 0x49, 0x4b, 0x4a, 0x4c, 0x4c, 0x45, 0x4c, 0x09, 0x06, 0x06, 0x09, 0x04, 0x02, 0x02, 0x2d, 0x07, 0x06, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x06, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x08, 0x11, 0x10, 0x12, 0x56, 0x21, 0x2d, 0x43, 0x5b, 0x5b, 0x13, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x15, 0x3b, 0x4a, 0x3c, 0x32, 0x35, 0x4d, 0x44, 0x2c, 0x35, 0x3e, 0x38, 0x32, 0x39, 0x43, 0x49, 0x74, 0x54, 0x7b, 0x7d, 0xe2, 0xce, 0xc0, 0xc2, 0xcb, 0xc2, 0xbc, 0xc1, 0xc2, 0xc3, 0xc3, 0xbf, 0xc3, 0xc2, 0xbc, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbc, 0xb2, 0xcb, 0xe9, 0xd1, 0xb9, 0xb2, 0xb8, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb1, 0xb5, 0xb1, 0xb5, 0xb1, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa5, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa0, 0xa4, 0xa4, 0xa4, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa2, 0xa0, 0x9b, 0x9c, 0x9a, 0xa1, 0xc3, 0xd0, 0xcd, 0x71, 0x73, 0x72, 0x72, 0x38, 0x2c, 0x29, 0x2c, 0x30, 0x31, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x22, 0x22, 0x22, 0x20, 0x20, 0x1d, 0x20, 0x20, 0x63, 0x20, 0x63, 0x1d, 0x22, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2b, 0x29, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x22, 0x20, 0x63, 0x63, 0x1a, 0x63, 0x63, 0x62, 0x1a, 0x1a, 0x60, 0x1b, 0x1b, 0x20, 0x26, 0x2c, 0x38, 0x3c, 0x46, 0x51, 0x4c, 0x3b, 0x1c, 0x14, 0x01, 0x1c, 0x2d, 0x07, 0x06, 0x07, 0x06, 0x04, 0x04, 0x03, 0x04, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x05, 0x03, 0x0e, 0x12, 0x58, 0x0f, 0x51, 0x18, 0x4e, 0x5c, 0x5b, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x14, 0x14, 0x14, 0x33, 0x4e, 0x42, 0x32, 0x44, 0x4f, 0x3e, 0x35, 0x3e, 0x35, 0x37, 0x35, 0x39, 0x3b, 0x49, 0x50, 0x74, 0x57, 0xea, 0xda, 0xc7, 0xc2, 0xc7, 0xc5, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc2, 0xbc, 0xc2, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xbe, 0xbc, 0xbe, 0xbc, 0xbe, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xc1, 0xb6, 0xb9, 0xe6, 0xd9, 0xc5, 0xb8, 0xb2, 0xb9, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa2, 0xa0, 0x9a, 0xa0, 0xb2, 0xcd, 0xcd, 0xcd, 0x71, 0x72, 0x49, 0x4b, 0x3e, 0x31, 0x26, 0x2c, 0x36, 0x2b, 0x31, 0x30, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x2b, 0x26, 0x29, 0x29, 0x22, 0x29, 0x29, 0x22, 0x29, 0x29, 0x29, 0x29, 0x2b, 0x29, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x30, 0x2b, 0x30, 0x2b, 0x29, 0x29, 0x2b, 0x2b, 0x2b, 0x30, 0x29, 0x2b, 0x22, 0x22, 0x22, 0x20, 0x63, 0x60, 0x63, 0x20, 0x62, 0x63, 0x63, 0x1d, 0x1a, 0x1b, 0x1b, 0x1e, 0x23, 0x3c, 0x4e, 0x4c, 0x21, 0x16, 0x1c, 0x21, 0x04, 0x05, 0x04, 0x05, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x05, 0x07, 0x05, 0x03, 0x08, 0x0e, 0x0a, 0x0e, 0x10, 0x72, 0x5d, 0x3d, 0x19, 0x5b, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x5a, 0x5b, 0x3f, 0x49, 0x47, 0x32, 0x4b, 0x3e, 0x35, 0x37, 0x3a, 0x40, 0x37, 0x39, 0x35, 0x42, 0x4c, 0x41, 0x74, 0x7b, 0xe2, 0xd2, 0xc7, 0xc2, 0xc7, 0xc5, 0xc2, 0xc6, 0xc2, 0xc3, 0xc3, 0xc3, 0xc1, 0xbc, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbe, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xb9, 0xb9, 0xbc, 0xdf, 0xe4, 0xd5, 0xc6, 0xb9, 0xb8, 0xb9, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb2, 0xb5, 0xb5, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb3, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xac, 0xac, 0xac, 0xac, 0xa9, 0xac, 0xac, 0xac, 0xa9, 0xac, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa4, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c, 0xa8, 0xbe, 0xd8, 0xcd, 0x71, 0x73, 0x3d, 0x43, 0x4b, 0x44, 0x2c, 0x2c, 0x31, 0x36, 0x2e, 0x2e, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2b, 0x30, 0x2b, 0x30, 0x2b, 0x2b, 0x30, 0x2b, 0x2b, 0x2e, 0x2b, 0x30, 0x2e, 0x30, 0x30, 0x2b, 0x30, 0x2b, 0x30, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x30, 0x30, 0x2b, 0x2b, 0x29, 0x2b, 0x2b, 0x2b, 0x30, 0x2b, 0x29, 0x29, 0x29, 0x20, 0x1d, 0x1a, 0x62, 0x1a, 0x62, 0x62, 0x20, 0x63, 0x20, 0x22, 0x1b, 0x1b, 0x1e, 0x2f, 0x4b, 0x49, 0x3d, 0x2d, 0x06, 0x06, 0x05, 0x04, 0x04, 0x06, 0x2d, 0x04, 0x21, 0x03, 0x06, 0x07, 0x05, 0x05, 0x05, 0x05, 0x03, 0x0a, 0x0e, 0x07, 0x16, 0x27, 0x51, 0x44, 0x18, 0x2f, 0x24, 0x13, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0xff, 0x5a, 0x01, 0x5b, 0x24, 0x4e, 0x3d, 0x4f, 0x44, 0x37, 0x37, 0x3a, 0x37, 0x40, 0x37, 0x40, 0x40, 0x4f, 0x2a, 0x41, 0x57, 0x7a, 0x77, 0xcd, 0xc0, 0xc5, 0xca, 0xca, 0xc2, 0xc6, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xbe, 0xbc, 0xbe, 0xbc, 0xbc, 0xbe, 0xba, 0xbc, 0xba, 0xba, 0xb9, 0xbf, 0xb0, 0xdd, 0xe6, 0xdd, 0xce, 0xb9, 0xb9, 0xb8, 0xb9, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb2, 0xb2, 0xb5, 0xb2, 0xb5, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xae, 0xb3, 0xae, 0xae, 0xae, 0xae, 0xae, 0xac, 0xac, 0xac, 0xab, 0xac, 0xa9, 0xac, 0xac, 0xad, 0xac, 0xad, 0xa9, 0xad, 0xa8, 0xa8, 0xa8, 0xa7, 0xa8, 0xa9, 0xac, 0xa9, 0xa7, 0xa7, 0xa4, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa4, 0xa7, 0xa3, 0xa4, 0xa3, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9b, 0xa0, 0x9c, 0xb6, 0xd3, 0xd2, 0x71, 0x74, 0x3d, 0x28, 0x38, 0x4b, 0x46, 0x36, 0x2c, 0x2c, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2b, 0x30, 0x2e, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x30, 0x2e, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2e, 0x2b, 0x2b, 0x30, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x2b, 0x22, 0x63, 0x20, 0x20, 0x63, 0x63, 0x20, 0x20, 0x20, 0x1d, 0x1b, 0x1b, 0x26, 0x3d, 0x4d, 0x4c, 0x08, 0x06, 0x04, 0x04, 0x2d, 0x27, 0x21, 0x02, 0x1c, 0x03, 0x04, 0x03, 0x03, 0x05, 0x08, 0x0e, 0x11, 0x0f, 0x02, 0x01, 0x27, 0x4d, 0x29, 0x5d, 0x43, 0x21, 0x5a, 0xff, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5b, 0x19, 0x45, 0x50, 0x4b, 0x42, 0x37, 0x40, 0x37, 0x37, 0x40, 0x37, 0x3e, 0x4b, 0x4b, 0x2a, 0x73, 0x7c, 0xe3, 0xd8, 0xc7, 0xc7, 0xad, 0xca, 0xc6, 0xc5, 0xc9, 0xc6, 0xc6, 0xc1, 0xbc, 0xbc, 0xc1, 0xc1, 0xc1, 0xc3, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xbc, 0xbe, 0xbc, 0xbc, 0xba, 0xbc, 0xba, 0xb9, 0xc2, 0xb9, 0xc5, 0xee, 0xdf, 0xd5, 0xd5, 0xb9, 0xb9, 0xb5, 0xb6, 0xb5, 0xb8, 0xb5, 0xb5, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb2, 0xb2, 0xac, 0xb2, 0xac, 0xb2, 0xb2, 0xb5, 0xb2, 0xb5, 0xb2, 0xb1, 0xb3, 0xb5, 0xb1, 0xae, 0xa9, 0xac, 0xb1, 0xac, 0xb1, 0xb2, 0xb2, 0xac, 0xad, 0xac, 0xad, 0xa8, 0xad, 0xb9, 0xb6, 0xb6, 0xb9, 0xcb, 0xd9, 0xe1, 0xdd, 0xd3, 0xc6, 0xb8, 0xac, 0xa8, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa0, 0xa4, 0xa0, 0xa4, 0xa2, 0xa4, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa2, 0x98, 0xa4, 0xb0, 0xd0, 0x6f, 0x73, 0x71, 0x3d, 0x32, 0x2a, 0x3a, 0x46, 0x4d, 0x3a, 0x2c, 0x2c, 0x2e, 0x31, 0x35, 0x2e, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x2e, 0x2e, 0x31, 0x2b, 0x2e, 0x2b, 0x2e, 0x31, 0x2b, 0x2c, 0x2b, 0x2c, 0x2b, 0x2c, 0x2b, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2b, 0x2c, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1b, 0x20, 0x1b, 0x37, 0x46, 0x4d, 0x4c, 0x42, 0x39, 0x21, 0x16, 0x5b, 0x16, 0x27, 0x0a, 0x0b, 0x0b, 0x0f, 0x11, 0x12, 0x12, 0x0b, 0x1c, 0x3b, 0x4d, 0x23, 0x1b, 0x5d, 0x3d, 0x61, 0xff, 0xff, 0xff, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x13, 0x16, 0x3f, 0x51, 0x4c, 0x39, 0x35, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x46, 0x46, 0x3c, 0x43, 0x7b, 0x7a, 0xda, 0xda, 0xc2, 0xd7, 0xcb, 0xc1, 0xc1, 0xbe, 0xbe, 0xbe, 0xc1, 0xc1, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xbe, 0xbc, 0xbe, 0xbc, 0xb9, 0xb9, 0xc3, 0xb6, 0xbf, 0xeb, 0xe1, 0xd7, 0xd9, 0xc7, 0xb9, 0xb9, 0xb6, 0xba, 0xbe, 0xb8, 0xb5, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb8, 0xb8, 0xb5, 0xb5, 0xb8, 0xb5, 0xb5, 0xb2, 0xb5, 0xb2, 0xab, 0xa8, 0xab, 0xb1, 0xb5, 0xb8, 0xb1, 0xa8, 0xac, 0xac, 0xad, 0xac, 0xad, 0xac, 0xb6, 0xbe, 0xd7, 0xce, 0xc7, 0xce, 0xdd, 0xe4, 0xe5, 0xe4, 0xc5, 0xbe, 0xb5, 0xac, 0xa8, 0xa8, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa7, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa3, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa0, 0xa0, 0xa0, 0xa2, 0x98, 0xa3, 0xa8, 0xcd, 0xcd, 0x73, 0x70, 0x33, 0x32, 0x2c, 0x35, 0x3a, 0x3e, 0x4b, 0x4b, 0x31, 0x35, 0x2e, 0x35, 0x36, 0x36, 0x36, 0x31, 0x31, 0x31, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x31, 0x30, 0x31, 0x31, 0x31, 0x36, 0x36, 0x3a, 0x31, 0x36, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2c, 0x2e, 0x31, 0x2c, 0x2e, 0x35, 0x2e, 0x31, 0x2e, 0x2b, 0x2b, 0x30, 0x2b, 0x22, 0x20, 0x1a, 0x63, 0x20, 0x22, 0x1e, 0x23, 0x2c, 0x2c, 0x38, 0x46, 0x4b, 0x47, 0x3c, 0x3b, 0x4c, 0x0f, 0x11, 0x12, 0x11, 0x10, 0x10, 0x55, 0x51, 0x4c, 0x44, 0x23, 0x1b, 0x20, 0x5d, 0x43, 0x16, 0x01, 0xff, 0xff, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x5a, 0x15, 0x24, 0x4e, 0x4e, 0x40, 0x39, 0x40, 0x40, 0x35, 0x35, 0x46, 0x4d, 0x44, 0x33, 0x70, 0x7d, 0x77, 0xda, 0xd2, 0xc2, 0xc2, 0xc1, 0xc5, 0xbe, 0xbe, 0xbe, 0xbe, 0xc5, 0xc5, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb9, 0xb9, 0xb6, 0xb9, 0xe4, 0xe4, 0xdc, 0xdc, 0xd5, 0xc7, 0xb9, 0xb6, 0xb9, 0xb9, 0xbe, 0xb8, 0xb8, 0xb8, 0xb5, 0xb5, 0xb2, 0xb5, 0xb5, 0xb8, 0xb5, 0xb2, 0xb5, 0xb2, 0xb2, 0xb2, 0xb2, 0xac, 0xbe, 0xb8, 0xac, 0xa8, 0xad, 0xb1, 0xb6, 0xb8, 0xb9, 0xb9, 0xc6, 0xc6, 0xd0, 0xd5, 0xd9, 0xdd, 0xce, 0xce, 0xd5, 0xe1, 0xe6, 0xe4, 0xca, 0xa6, 0xa8, 0xa8, 0xa6, 0xa6, 0xa3, 0xa6, 0xa6, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa0, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9b, 0x9a, 0xa4, 0xa1, 0xc6, 0x71, 0x73, 0x70, 0x28, 0x32, 0x35, 0x36, 0x2c, 0x36, 0x3e, 0x46, 0x4d, 0x44, 0x38, 0x2c, 0x2c, 0x2e, 0x35, 0x2c, 0x35, 0x36, 0x36, 0x35, 0x31, 0x35, 0x2e, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x2b, 0x2c, 0x2e, 0x2c, 0x2b, 0x2c, 0x2e, 0x2e, 0x2b, 0x2c, 0x2e, 0x2c, 0x31, 0x31, 0x36, 0x36, 0x2c, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2c, 0x2e, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x2b, 0x30, 0x30, 0x30, 0x29, 0x22, 0x1d, 0x1d, 0x1d, 0x20, 0x1d, 0x1d, 0x22, 0x22, 0x28, 0x29, 0x39, 0x35, 0x3c, 0x46, 0x4c, 0x4c, 0x0b, 0x46, 0x4b, 0x40, 0x35, 0x23, 0x1e, 0x1d, 0x29, 0x5d, 0x1e, 0x45, 0xff, 0xff, 0xff, 0x00, 0x5a, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x13, 0x5a, 0x13, 0x19, 0x3f, 0x4e, 0x42, 0x39, 0x39, 0x46, 0x40, 0x37, 0x40, 0x4d, 0x3d, 0x3d, 0x7b, 0x7b, 0xe2, 0xf7, 0xc2, 0xca, 0xc5, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xc1, 0xc1, 0xc6, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xbe, 0xbc, 0xbe, 0xb9, 0xbe, 0xbf, 0xb6, 0xb7, 0xdf, 0xe6, 0xdc, 0xdf, 0xdc, 0xd7, 0xc7, 0xb9, 0xb7, 0xb9, 0xb9, 0xba, 0xb8, 0xb8, 0xb8, 0xb5, 0xb5, 0xb2, 0xb2, 0xb2, 0xb2, 0xb5, 0xb2, 0xb2, 0xb5, 0xb2, 0xb5, 0xb6, 0xac, 0xb0, 0xb9, 0xb6, 0xb2, 0xb0, 0xb2, 0xb9, 0xc3, 0xc9, 0xd3, 0xd9, 0xdd, 0xd9, 0xdd, 0xd5, 0xe6, 0xe4, 0xeb, 0xec, 0xee, 0xee, 0xe4, 0xdf, 0xe4, 0xe4, 0xdd, 0xd3, 0xc1, 0xb5, 0xa7, 0xa3, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0xa0, 0xa4, 0x9b, 0xa0, 0xa3, 0x6c, 0xbb, 0x73, 0x73, 0x43, 0x32, 0x35, 0x36, 0x36, 0x36, 0x2c, 0x31, 0x2e, 0x3c, 0x46, 0x4d, 0x4d, 0x3e, 0x35, 0x2c, 0x38, 0x2c, 0x2c, 0x2c, 0x2c, 0x35, 0x31, 0x35, 0x36, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x36, 0x36, 0x36, 0x36, 0x31, 0x31, 0x31, 0x36, 0x35, 0x36, 0x37, 0x36, 0x35, 0x31, 0x2c, 0x2c, 0x36, 0x36, 0x36, 0x31, 0x31, 0x2e, 0x2b, 0x2c, 0x30, 0x31, 0x2e, 0x2b, 0x2e, 0x30, 0x2e, 0x30, 0x30, 0x2b, 0x30, 0x2b, 0x2b, 0x29, 0x29, 0x26, 0x22, 0x20, 0x20, 0x1d, 0x20, 0x1d, 0x1d, 0x1b, 0x1d, 0x1e, 0x23, 0x1e, 0x1e, 0x1e, 0x23, 0x23, 0x1e, 0x1e, 0x1e, 0x23, 0x20, 0x22, 0x22, 0x5d, 0x3d, 0x34, 0x5a, 0x01, 0xff, 0x00, 0x5a, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01, 0x5a, 0x13, 0x15, 0x2d, 0x4e, 0x49, 0x3b, 0x39, 0x39, 0x44, 0x46, 0x4b, 0x41, 0x3d, 0x6b, 0x7a, 0xfb, 0xf4, 0xf7, 0xd1, 0xc5, 0xc5, 0xc1, 0xc6, 0xc6, 0xc6, 0xc5, 0xc2, 0xc1, 0xc2, 0xc6, 0xc2, 0xc1, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xbc, 0xbe, 0xba, 0xb9, 0xb9, 0xb9, 0xd9, 0xeb, 0xdc, 0xf4, 0xdf, 0xdc, 0xd7, 0xce, 0xc6, 0xb9, 0xb9, 0xb6, 0xb8, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb2, 0xb8, 0xb2, 0xb2, 0xb2, 0xb2, 0xb6, 0xb5, 0xb5, 0xb0, 0xb2, 0xb0, 0xb6, 0xbf, 0xc9, 0xd5, 0xdd, 0xdf, 0xe1, 0xe4, 0xec, 0xec, 0xee, 0xec, 0xec, 0xe4, 0xf8, 0xd9, 0xd1, 0xbf, 0xb9, 0xbe, 0xc1, 0xb2, 0xac, 0xb2, 0xac, 0xb1, 0xac, 0xac, 0xab, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa7, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0x9d, 0xa0, 0xa7, 0x99, 0x6f, 0x73, 0x72, 0x43, 0x35, 0x35, 0x2c, 0x2e, 0x36, 0x36, 0x36, 0x35, 0x38, 0x31, 0x36, 0x3e, 0x4d, 0x4f, 0x4b, 0x3e, 0x3e, 0x3c, 0x38, 0x38, 0x35, 0x35, 0x35, 0x2c, 0x31, 0x35, 0x31, 0x35, 0x31, 0x35, 0x31, 0x35, 0x2c, 0x2c, 0x2e, 0x2c, 0x2c, 0x2c, 0x2e, 0x35, 0x2c, 0x2c, 0x2c, 0x2a, 0x2c, 0x35, 0x39, 0x3c, 0x2a, 0x32, 0x32, 0x38, 0x32, 0x38, 0x3d, 0x3c, 0x30, 0x30, 0x2b, 0x2b, 0x30, 0x2e, 0x2b, 0x26, 0x31, 0x2e, 0x2c, 0x2e, 0x2e, 0x31, 0x31, 0x30, 0x26, 0x22, 0x1d, 0x20, 0x22, 0x20, 0x22, 0x26, 0x22, 0x20, 0x20, 0x22, 0x1d, 0x23, 0x22, 0x23, 0x1d, 0x26, 0x1d, 0x1b, 0x29, 0x26, 0x5d, 0x1e, 0x49, 0x17, 0xff, 0xff, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5b, 0x5a, 0x5c, 0x3f, 0x4e, 0x4a, 0x39, 0x39, 0x40, 0x4f, 0x47, 0x41, 0x3f, 0x7c, 0xfb, 0xf5, 0xf6, 0xd7, 0xca, 0xc5, 0xc1, 0xc1, 0xc6, 0xc6, 0xc5, 0xc2, 0xc6, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xbe, 0xbc, 0xbe, 0xb9, 0xc3, 0xb9, 0xd5, 0xeb, 0xdc, 0xd7, 0xf4, 0xdc, 0xdf, 0xdc, 0xd5, 0xc7, 0xbf, 0xb6, 0xb2, 0xb5, 0xb5, 0xb8, 0xb8, 0xb5, 0xb5, 0xb5, 0xb2, 0xb2, 0xb2, 0xb2, 0xac, 0xb2, 0xb2, 0xb6, 0xc7, 0xc7, 0xc6, 0xd1, 0xdf, 0xe6, 0xec, 0xec, 0xec, 0xec, 0xe1, 0xdd, 0xce, 0xc3, 0xb0, 0xad, 0x99, 0xa1, 0xa6, 0xad, 0xad, 0xac, 0xad, 0xa8, 0xb2, 0xb2, 0xb1, 0xae, 0xa9, 0xa7, 0xa4, 0xa3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa4, 0xa4, 0xa7, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa4, 0xa0, 0xa4, 0xa4, 0x6c, 0x6f, 0x73, 0x72, 0x3d, 0x35, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x38, 0x36, 0x36, 0x38, 0x31, 0x2e, 0x36, 0x44, 0x4d, 0x4b, 0x4d, 0x46, 0x46, 0x44, 0x3e, 0x3e, 0x3e, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x3e, 0x40, 0x3e, 0x40, 0x44, 0x3e, 0x4d, 0x4b, 0x46, 0x47, 0x46, 0x49, 0x4b, 0x4e, 0x51, 0x51, 0x51, 0x51, 0x50, 0x51, 0x4e, 0x72, 0x4d, 0x70, 0x4b, 0x49, 0x47, 0x43, 0x3c, 0x32, 0x32, 0x2c, 0x2f, 0x2e, 0x36, 0x31, 0x2e, 0x2c, 0x30, 0x30, 0x29, 0x29, 0x22, 0x1d, 0x1d, 0x1d, 0x20, 0x1d, 0x1d, 0x22, 0x1d, 0x22, 0x22, 0x1a, 0x1d, 0x29, 0x2b, 0x22, 0x30, 0x26, 0x5d, 0x28, 0x6b, 0x5b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xfe, 0x7e, 0x00, 0x00, 0x13, 0x5b, 0x5b, 0x19, 0x41, 0x53, 0x45, 0x39, 0x42, 0x51, 0x50, 0x57, 0xfd, 0xfd, 0xfc, 0xf6, 0xf8, 0xd7, 0xd1, 0xc6, 0xc6, 0xc5, 0xc6, 0xc7, 0xc2, 0xc5, 0xc3, 0xc5, 0xc2, 0xc6, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xbc, 0xbe, 0xbe, 0xb8, 0xc3, 0xb7, 0xca, 0xee, 0xdf, 0xd7, 0xf4, 0xdc, 0xf6, 0xdf, 0xdc, 0xd7, 0xce, 0xca, 0xc1, 0xbe, 0xb9, 0xb5, 0xb2, 0xb2, 0xb6, 0xb5, 0xb6, 0xb5, 0xb5, 0xb8, 0xba, 0xbe, 0xc6, 0xc6, 0xd0, 0xf4, 0xe4, 0xfc, 0xee, 0xe6, 0xdd, 0xd2, 0xb9, 0xb7, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb9, 0xb9, 0xad, 0xb2, 0xb2, 0xb2, 0xae, 0xac, 0xab, 0xab, 0xab, 0xae, 0xae, 0xb3, 0xb3, 0xb3, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa7, 0xa7, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa2, 0xa3, 0x9d, 0xa6, 0x6c, 0x6f, 0x73, 0x49, 0x32, 0x35, 0x36, 0x3a, 0x3a, 0x36, 0x31, 0x2f, 0x31, 0x36, 0x38, 0x36, 0x36, 0x35, 0x2c, 0x2c, 0x2c, 0x3a, 0x3e, 0x3e, 0x44, 0x46, 0x4b, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4b, 0x46, 0x4b, 0x2a, 0x32, 0x3c, 0x42, 0x4b, 0x4e, 0x4e, 0x4e, 0x3b, 0x3b, 0x27, 0x21, 0x19, 0x17, 0x16, 0x15, 0x15, 0x16, 0x19, 0x21, 0x2d, 0x3b, 0x45, 0x49, 0x42, 0x3d, 0x38, 0x35, 0x29, 0x2c, 0x30, 0x30, 0x29, 0x2b, 0x2b, 0x30, 0x30, 0x30, 0x2e, 0x2b, 0x2c, 0x29, 0x2b, 0x29, 0x26, 0x22, 0x29, 0x29, 0x30, 0x29, 0x2b, 0x2b, 0x1b, 0x5d, 0x25, 0x70, 0x17, 0x5b, 0x13, 0x00, 0x00, 0xfe, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x7e, 0x7e, 0x5a, 0x14, 0x5b, 0x5b, 0x19, 0x41, 0x52, 0x56, 0x57, 0x57, 0x7b, 0xe0, 0xfb, 0xfc, 0xfc, 0xf4, 0xf8, 0xdc, 0xd1, 0xc6, 0xc6, 0xc2, 0xc7, 0xc2, 0xc7, 0xc2, 0xc5, 0xc1, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xbc, 0xbe, 0xb9, 0xbe, 0xb6, 0xc7, 0xef, 0xf6, 0xf4, 0xf6, 0xdc, 0xf4, 0xdc, 0xf5, 0xdc, 0xdc, 0xda, 0xd5, 0xd0, 0xc9, 0xbf, 0xba, 0xb6, 0xb9, 0xb9, 0xc3, 0xbf, 0xc6, 0xc7, 0xd0, 0xd5, 0xd9, 0xdd, 0xe6, 0xec, 0xeb, 0xe1, 0xc7, 0xb0, 0xb0, 0xb6, 0xb0, 0xad, 0xb0, 0xad, 0xb0, 0xb6, 0xad, 0xad, 0xac, 0xa8, 0xb2, 0xac, 0xac, 0xac, 0xac, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa4, 0xa4, 0xa4, 0xa7, 0xa4, 0xa7, 0xa3, 0xa4, 0xa3, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0x9d, 0xa1, 0x6c, 0x71, 0x72, 0x49, 0x2a, 0x38, 0x37, 0x36, 0x31, 0x31, 0x36, 0x36, 0x36, 0x36, 0x31, 0x35, 0x36, 0x36, 0x38, 0x38, 0x35, 0x35, 0x2c, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x39, 0x35, 0x35, 0x2a, 0x25, 0x25, 0x1f, 0x18, 0x3d, 0x3d, 0x41, 0x41, 0x34, 0x21, 0x16, 0x15, 0x14, 0x14, 0x5a, 0x13, 0x13, 0x13, 0x13, 0x13, 0xff, 0x13, 0xff, 0x5a, 0x5a, 0x01, 0x16, 0x19, 0x3b, 0x41, 0x49, 0x47, 0x42, 0x31, 0x2c, 0x2c, 0x30, 0x30, 0x30, 0x2b, 0x2b, 0x31, 0x30, 0x2e, 0x31, 0x2c, 0x2e, 0x36, 0x30, 0x2e, 0x30, 0x30, 0x2b, 0x30, 0x30, 0x20, 0x5d, 0x28, 0x49, 0x17, 0x5b, 0x14, 0x13, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x5a, 0x82, 0x5a, 0x5a, 0x8a, 0x79, 0xf2, 0xe8, 0x7a, 0xe0, 0xe0, 0xf9, 0xea, 0xe7, 0xe7, 0xfa, 0xdf, 0xf6, 0xdf, 0xf4, 0xce, 0xc7, 0xc0, 0xc7, 0xc2, 0xc5, 0xc6, 0xc5, 0xc6, 0xc2, 0xc6, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xbc, 0xc1, 0xb5, 0xcb, 0xb5, 0xb9, 0xbc, 0xe6, 0xf8, 0xd7, 0xdc, 0xf4, 0xf6, 0xf4, 0xdc, 0xdc, 0xf5, 0xdc, 0x77, 0xdf, 0xda, 0xdd, 0xda, 0xd9, 0xd5, 0xda, 0xf4, 0xda, 0xf5, 0xf5, 0xf4, 0xd7, 0xf8, 0xf1, 0xe4, 0xd9, 0xbe, 0xad, 0xad, 0xb8, 0xb6, 0xb2, 0xb6, 0xb2, 0xb2, 0xb1, 0xb2, 0xac, 0xb1, 0xb2, 0xac, 0xb2, 0xac, 0xac, 0xac, 0xac, 0xab, 0xac, 0xae, 0xab, 0xa9, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9d, 0x9d, 0xa5, 0xa7, 0xa4, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa7, 0xa3, 0xa4, 0x6c, 0xa5, 0xa4, 0xa4, 0xa9, 0x98, 0x6d, 0x75, 0x72, 0x32, 0x38, 0x36, 0x38, 0x36, 0x36, 0x36, 0x36, 0x31, 0x36, 0x36, 0x37, 0x38, 0x36, 0x38, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x35, 0x35, 0x37, 0x37, 0x37, 0x35, 0x31, 0x35, 0x36, 0x37, 0x35, 0x38, 0x39, 0x35, 0x25, 0x1f, 0x1f, 0x21, 0x39, 0x45, 0x4a, 0x34, 0x8a, 0x16, 0x5b, 0x5b, 0x5a, 0x13, 0x00, 0x13, 0x5a, 0x5a, 0x13, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x5a, 0x00, 0x13, 0x5a, 0xff, 0x13, 0x5a, 0x14, 0x17, 0x24, 0x45, 0x4e, 0x45, 0x3d, 0x32, 0x32, 0x2c, 0x31, 0x31, 0x36, 0x36, 0x36, 0x2e, 0x2e, 0x30, 0x36, 0x36, 0x31, 0x36, 0x31, 0x38, 0x2f, 0x1e, 0x1f, 0x33, 0x43, 0x24, 0x5b, 0x5b, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x83, 0x00, 0x83, 0x7e, 0x00, 0x7e, 0x89, 0xf5, 0xf2, 0xfa, 0xf4, 0xe3, 0xf7, 0xe2, 0xf7, 0xe2, 0xfa, 0xe7, 0xfa, 0xf8, 0xfa, 0xf8, 0xf7, 0xdc, 0xd6, 0xce, 0xce, 0xc7, 0xc2, 0xc2, 0xc1, 0xc2, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbe, 0xbc, 0xba, 0xc5, 0xb2, 0xc2, 0xb9, 0xeb, 0xe6, 0xdc, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xd6, 0xf5, 0xda, 0xf5, 0xda, 0xdc, 0xd9, 0xf4, 0xda, 0xd6, 0xde, 0xde, 0xd6, 0xe2, 0xfc, 0xe6, 0xd1, 0xc1, 0xb8, 0xb2, 0xac, 0xb8, 0xba, 0xba, 0xb8, 0xb2, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xb2, 0xb1, 0xac, 0xac, 0xac, 0xac, 0xae, 0xac, 0xab, 0xac, 0xab, 0xab, 0xae, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa5, 0xa5, 0xa7, 0xa7, 0xa9, 0xa8, 0xa8, 0xa6, 0xa8, 0xa7, 0xa8, 0xa7, 0xa4, 0xa4, 0x6c, 0xa7, 0xa3, 0x9a, 0x6c, 0x71, 0x72, 0x3d, 0x32, 0x3c, 0x35, 0x31, 0x36, 0x38, 0x36, 0x38, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x38, 0x37, 0x35, 0x35, 0x35, 0x3a, 0x3a, 0x36, 0x31, 0x35, 0x38, 0x35, 0x28, 0x1f, 0x21, 0x28, 0x45, 0x4a, 0x34, 0x19, 0x14, 0x13, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x14, 0x19, 0x34, 0x45, 0x4c, 0x4b, 0x44, 0x39, 0x35, 0x2c, 0x2c, 0x2c, 0x36, 0x36, 0x31, 0x2c, 0x2e, 0x2a, 0x2c, 0x32, 0x25, 0x18, 0x33, 0x49, 0x41, 0x5c, 0x5b, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x5a, 0x84, 0xc8, 0xf3, 0xfd, 0xf7, 0xf7, 0xfa, 0xf7, 0xf5, 0xf7, 0xf7, 0xf5, 0xf5, 0xfa, 0xfa, 0xe2, 0xdc, 0xdc, 0xf7, 0xf8, 0xf8, 0xf6, 0xd7, 0xc7, 0xca, 0xc5, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbc, 0xc1, 0xc1, 0xbc, 0xb9, 0xbc, 0xb6, 0xeb, 0xe4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xf5, 0xf4, 0xf4, 0xe3, 0xea, 0xe4, 0xce, 0xb0, 0xa8, 0xac, 0xb5, 0xba, 0xb8, 0xb8, 0xb5, 0xb5, 0xb2, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xac, 0xae, 0xac, 0xae, 0xac, 0xab, 0xae, 0xae, 0xab, 0xab, 0xac, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7, 0xa9, 0xa5, 0xa3, 0xa4, 0xa7, 0xa8, 0xa7, 0xa4, 0xa3, 0xa4, 0xa4, 0xa4, 0xa3, 0xa3, 0xa4, 0xa4, 0xa9, 0x99, 0x6d, 0x73, 0x70, 0x3d, 0x35, 0x35, 0x3c, 0x3c, 0x36, 0x31, 0x36, 0x36, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x38, 0x2e, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x3a, 0x2e, 0x36, 0x38, 0x3c, 0x35, 0x2a, 0x1f, 0x1f, 0x33, 0x43, 0x45, 0x24, 0x15, 0x13, 0x5b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0xff, 0x00, 0xff, 0x00, 0x13, 0xff, 0x13, 0x5a, 0x13, 0x13, 0x15, 0x19, 0x27, 0x41, 0x4c, 0x4e, 0x4e, 0x47, 0x43, 0x42, 0x3d, 0x3d, 0x3d, 0x33, 0x39, 0x33, 0x33, 0x41, 0x50, 0x41, 0x17, 0x5b, 0x5b, 0x14, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x5a, 0x7e, 0x5a, 0x90, 0xfd, 0xe7, 0xe0, 0xdc, 0xf5, 0xf7, 0xf6, 0xdc, 0xf4, 0xda, 0xd6, 0xce, 0xd2, 0xdc, 0xf7, 0xf8, 0xf7, 0xdc, 0xd2, 0xd1, 0xd7, 0xdc, 0xdc, 0xdf, 0xd1, 0xd1, 0xcb, 0xca, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc5, 0xba, 0xba, 0xc3, 0xb7, 0xe9, 0xe3, 0xd8, 0x77, 0xe0, 0xda, 0xde, 0xda, 0xf4, 0xf5, 0xf5, 0xf4, 0xf6, 0xf4, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xf5, 0xf4, 0xe3, 0xfc, 0xe2, 0xb7, 0xa6, 0xbf, 0xb8, 0xba, 0xbe, 0xb8, 0xb2, 0xb1, 0xb2, 0xb5, 0xb2, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xac, 0xb1, 0xac, 0xae, 0xac, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa7, 0xa7, 0xa9, 0xa4, 0xa7, 0xa3, 0xa6, 0xa4, 0xa7, 0xa5, 0xa7, 0x9d, 0xa5, 0x9d, 0xa5, 0xa3, 0xa3, 0xa7, 0xa8, 0x6c, 0x6d, 0x71, 0x70, 0x49, 0x4b, 0x47, 0x35, 0x35, 0x35, 0x3c, 0x3c, 0x3c, 0x3c, 0x36, 0x35, 0x38, 0x38, 0x36, 0x38, 0x36, 0x36, 0x36, 0x36, 0x38, 0x38, 0x36, 0x36, 0x31, 0x36, 0x31, 0x36, 0x3e, 0x36, 0x2f, 0x28, 0x1e, 0x18, 0x32, 0x49, 0x45, 0x19, 0x5b, 0x5b, 0x5b, 0x5a, 0x5a, 0x01, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x5a, 0x01, 0x14, 0x5b, 0x5b, 0x13, 0x14, 0x15, 0x16, 0x19, 0x21, 0x34, 0x3b, 0x41, 0x41, 0x45, 0x41, 0x41, 0x3f, 0x34, 0x34, 0x19, 0x15, 0x5b, 0x14, 0x13, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x83, 0x00, 0x80, 0xbd, 0xfb, 0xe2, 0xe7, 0xe7, 0xf5, 0xf4, 0xf7, 0xf4, 0xce, 0xce, 0xc7, 0xc7, 0xc7, 0xc7, 0xce, 0xce, 0xdc, 0xdf, 0xdc, 0xd7, 0xca, 0xc7, 0xca, 0xd7, 0xd5, 0xd1, 0xd1, 0xcb, 0xcb, 0xc5, 0xc5, 0xc5, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb6, 0xbe, 0x6f, 0xc4, 0x7c, 0x77, 0x73, 0x77, 0x78, 0x77, 0x77, 0xf5, 0x77, 0xf4, 0xd6, 0xf6, 0xf4, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xd2, 0xe7, 0xfc, 0x77, 0xc0, 0x6d, 0xb7, 0xbe, 0xb8, 0xb8, 0xb2, 0xac, 0xb2, 0xb2, 0xb8, 0xb8, 0xb5, 0xb2, 0xb1, 0xb2, 0xb1, 0xb1, 0xae, 0xac, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xac, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xae, 0xab, 0xab, 0xae, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa7, 0xa8, 0x6d, 0xac, 0x6d, 0xa7, 0xa4, 0xa5, 0xa5, 0xa9, 0x9d, 0xa9, 0x9d, 0xa3, 0xa3, 0xa6, 0xa8, 0x6c, 0x71, 0x73, 0x43, 0x3d, 0x47, 0x46, 0x4b, 0x40, 0x3c, 0x37, 0x35, 0x35, 0x35, 0x39, 0x38, 0x38, 0x38, 0x38, 0x36, 0x38, 0x36, 0x38, 0x38, 0x3a, 0x36, 0x38, 0x38, 0x3c, 0x3e, 0x38, 0x38, 0x2f, 0x28, 0x18, 0x18, 0x33, 0x70, 0x3d, 0x17, 0x5b, 0x14, 0x14, 0x5a, 0x00, 0x83, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x01, 0x15, 0x5a, 0xff, 0x00, 0x13, 0x5a, 0x5b, 0x5a, 0x5b, 0x13, 0x13, 0x14, 0x14, 0x14, 0x13, 0x13, 0x5a, 0x15, 0x01, 0x13, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x5a, 0x7e, 0x82, 0xbd, 0x7d, 0xe7, 0xde, 0xf4, 0xf7, 0xf8, 0xf7, 0xd1, 0xca, 0xc7, 0xc7, 0xc7, 0xc7, 0xce, 0xce, 0xc2, 0xc7, 0xca, 0xca, 0xd1, 0xd7, 0xdc, 0xd7, 0xd1, 0xc2, 0xb9, 0xca, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xc1, 0xc5, 0xbc, 0xbf, 0xc4, 0x6f, 0x7c, 0x49, 0xb4, 0x70, 0x73, 0x76, 0x78, 0x78, 0xe2, 0x77, 0x77, 0xf4, 0xf5, 0xf4, 0xdc, 0xf4, 0xdc, 0xf4, 0xf4, 0xf8, 0xfc, 0xe4, 0xc0, 0x6d, 0xbf, 0xc4, 0xad, 0xb8, 0xb2, 0xb2, 0xb2, 0xb8, 0xba, 0xb8, 0xb5, 0xb8, 0xb5, 0xb1, 0xb2, 0xae, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xae, 0xab, 0xab, 0xae, 0xa9, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa6, 0xa8, 0xad, 0xac, 0xab, 0xa7, 0x9d, 0x9d, 0xa5, 0xa5, 0x9d, 0x9d, 0x9d, 0xa3, 0xa6, 0x6d, 0x71, 0x72, 0x49, 0x3d, 0x39, 0x3c, 0x40, 0x4b, 0x4d, 0x4b, 0x40, 0x3c, 0x35, 0x35, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x3a, 0x3a, 0x36, 0x35, 0x38, 0x38, 0x38, 0x2f, 0x2f, 0x25, 0x18, 0x18, 0x33, 0x70, 0x41, 0x5c, 0x5b, 0x5b, 0x5b, 0x5b, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x5a, 0x5a, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0x5a, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x84, 0x7e, 0x5a, 0xc8, 0xf3, 0xdb, 0xf5, 0xfa, 0xfa, 0xf5, 0xd7, 0xca, 0xc7, 0xca, 0xce, 0xca, 0xca, 0xca, 0xd1, 0xce, 0xce, 0xc5, 0xc7, 0xca, 0xce, 0xce, 0xca, 0xca, 0xc7, 0xca, 0xca, 0xc2, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc1, 0xc5, 0xc2, 0xc5, 0xbf, 0xbf, 0x71, 0x7b, 0x6b, 0x2f, 0x3d, 0x3d, 0x43, 0x49, 0x73, 0x75, 0x76, 0x77, 0x76, 0xda, 0xda, 0x77, 0xda, 0x77, 0xda, 0xf5, 0xf1, 0xfa, 0xd7, 0xb7, 0xb6, 0xb6, 0xbb, 0xb1, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb5, 0xb2, 0xb8, 0xb5, 0xb2, 0xb1, 0xb1, 0xb5, 0xb8, 0xb8, 0xb5, 0xb2, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb1, 0xb1, 0xae, 0xae, 0xae, 0xae, 0xae, 0xab, 0xae, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa6, 0xa8, 0xa8, 0xb6, 0xbb, 0xb8, 0xb1, 0xa3, 0xa9, 0x9d, 0xa3, 0xa3, 0xa7, 0xa8, 0xbb, 0xbb, 0x78, 0x43, 0x32, 0x39, 0x39, 0x39, 0x37, 0x37, 0x40, 0x46, 0x4b, 0x4d, 0x4b, 0x46, 0x3c, 0x35, 0x38, 0x38, 0x36, 0x37, 0x35, 0x37, 0x37, 0x37, 0x3a, 0x3a, 0x3c, 0x35, 0x2a, 0x25, 0x1e, 0x1f, 0x33, 0x43, 0x41, 0x19, 0x5b, 0x5b, 0x14, 0x5b, 0x5a, 0xfe, 0x5a, 0x00, 0x00, 0x7e, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x5a, 0x9e, 0xf2, 0xf9, 0xf5, 0xe2, 0xf8, 0xf6, 0xdc, 0xce, 0xca, 0xca, 0xce, 0xca, 0xca, 0xce, 0xcb, 0xc2, 0xc1, 0xce, 0xcb, 0xca, 0xca, 0xc5, 0xc5, 0xca, 0xc5, 0xca, 0xca, 0xca, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xbc, 0xc2, 0xc2, 0xbb, 0x76, 0x7c, 0x32, 0x33, 0x28, 0x2a, 0x32, 0x32, 0x3d, 0x43, 0x49, 0x72, 0x74, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0xeb, 0xe2, 0xca, 0xb7, 0xb6, 0xb6, 0xbb, 0xbb, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb5, 0xb5, 0xb8, 0xb8, 0xb5, 0xb1, 0xb1, 0xb5, 0xb8, 0xbe, 0xbe, 0xb5, 0xb1, 0xb5, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xae, 0xae, 0xae, 0xac, 0xae, 0xab, 0xac, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa6, 0xa7, 0xad, 0xbe, 0xd1, 0xd5, 0xcb, 0xba, 0xa9, 0xa9, 0xac, 0xac, 0xb6, 0x6f, 0x71, 0x75, 0x43, 0x28, 0x32, 0x3e, 0x39, 0x37, 0x40, 0x37, 0x37, 0x37, 0x3e, 0x44, 0x46, 0x4b, 0x4d, 0x4d, 0x4b, 0x46, 0x46, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x46, 0x47, 0x47, 0x42, 0x47, 0x70, 0x51, 0x4a, 0x24, 0x13, 0x5b, 0x5b, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x5a, 0xfb, 0xf9, 0xe3, 0xde, 0xfa, 0xf8, 0xd7, 0xce, 0xd1, 0xca, 0xca, 0xcb, 0xca, 0xcb, 0xcb, 0xcb, 0xca, 0xc5, 0xca, 0xcb, 0xce, 0xca, 0xca, 0xca, 0xc7, 0xca, 0xc7, 0xca, 0xc7, 0xca, 0xc2, 0xc6, 0xc2, 0xc6, 0xc5, 0xca, 0xce, 0xca, 0xca, 0xc5, 0xc1, 0xc2, 0xc6, 0xc5, 0xc2, 0xc2, 0xb9, 0xd1, 0xc6, 0x78, 0x7b, 0x3d, 0x2a, 0x35, 0x35, 0x35, 0x35, 0x32, 0x32, 0x32, 0x32, 0x3d, 0x41, 0x43, 0x51, 0x70, 0x70, 0x74, 0x7c, 0xea, 0xd6, 0xce, 0xc2, 0xb6, 0xb8, 0xc4, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xb1, 0xb5, 0xb3, 0xc1, 0xd3, 0xc3, 0xac, 0xbe, 0xbe, 0xa8, 0xad, 0xb2, 0xa8, 0xac, 0xac, 0xac, 0xb1, 0xb5, 0xa9, 0xae, 0xae, 0xae, 0xae, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xae, 0xae, 0xae, 0xa9, 0xa9, 0xa9, 0xab, 0x9d, 0xc5, 0xd5, 0xc9, 0xce, 0xd7, 0xd5, 0xdc, 0xd7, 0xd0, 0x6f, 0x73, 0x75, 0x72, 0x49, 0x28, 0x2f, 0x35, 0x38, 0x37, 0x37, 0x40, 0x37, 0x3a, 0x37, 0x38, 0x38, 0x3c, 0x3e, 0x40, 0x3e, 0x46, 0x4b, 0x4b, 0x4b, 0x4d, 0x4f, 0x4d, 0x4c, 0x4c, 0x42, 0x42, 0x2d, 0x41, 0x4e, 0x4a, 0x24, 0x13, 0x13, 0x13, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x86, 0xfd, 0xf9, 0xe3, 0xf7, 0xf7, 0xf7, 0xd1, 0xce, 0xd1, 0xca, 0xca, 0xce, 0xcb, 0xce, 0xcb, 0xca, 0xcb, 0xcb, 0xca, 0xca, 0xcb, 0xc5, 0xc7, 0xca, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xca, 0xc7, 0xc2, 0xc2, 0xc2, 0xc2, 0xc5, 0xbf, 0xc2, 0xc7, 0xca, 0xc6, 0xc2, 0xc2, 0xca, 0xc5, 0xb9, 0xd8, 0x7c, 0x75, 0x3d, 0x35, 0x35, 0x35, 0x37, 0x35, 0x35, 0x36, 0x35, 0x38, 0x32, 0x35, 0x42, 0x4b, 0x3d, 0x33, 0x70, 0x7c, 0x7a, 0xd6, 0xca, 0xb9, 0xb9, 0xb9, 0xba, 0xb5, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb8, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb2, 0xc6, 0xab, 0xdd, 0xd0, 0xa8, 0xd5, 0xd0, 0xb2, 0xb0, 0xac, 0xb6, 0xb8, 0xac, 0xae, 0xb1, 0xab, 0xb1, 0xae, 0xae, 0xae, 0xac, 0xab, 0xab, 0xab, 0xab, 0xab, 0xac, 0xab, 0xa9, 0xa9, 0xa9, 0xa7, 0xb5, 0x9d, 0xcb, 0xd9, 0xdc, 0xda, 0xd6, 0xcd, 0xc0, 0xd8, 0xd8, 0x73, 0x73, 0x75, 0x43, 0x23, 0x23, 0x2f, 0x3a, 0x3e, 0x3a, 0x40, 0x37, 0x40, 0x3a, 0x40, 0x38, 0x3c, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3a, 0x3c, 0x37, 0x3c, 0x37, 0x39, 0x2a, 0x18, 0x18, 0x1c, 0x3b, 0x45, 0x34, 0x16, 0x5b, 0x13, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x8b, 0xfd, 0xe2, 0xe2, 0xfa, 0xdc, 0xf6, 0xd1, 0xca, 0xd1, 0xcb, 0xca, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xcb, 0xd1, 0xca, 0xca, 0xca, 0xd1, 0xd7, 0xdc, 0xdc, 0xf6, 0xdf, 0xdc, 0xdc, 0xdc, 0xd7, 0xd7, 0xce, 0xc7, 0xc7, 0xc2, 0xce, 0xc7, 0xc2, 0xca, 0xc7, 0xc2, 0xc2, 0xc7, 0xc2, 0xc0, 0xd1, 0x7c, 0x73, 0x3d, 0x47, 0x38, 0x35, 0x37, 0x37, 0x37, 0x37, 0x35, 0x36, 0x36, 0x2c, 0x37, 0x3e, 0x4b, 0x35, 0x2a, 0x4e, 0x57, 0x77, 0xda, 0xca, 0xb9, 0xb9, 0xbc, 0xb9, 0xb2, 0xba, 0xb8, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb8, 0xac, 0xc9, 0xe1, 0xc6, 0xc9, 0xe6, 0xc6, 0xb6, 0xad, 0xb0, 0xb2, 0xac, 0xac, 0xb1, 0xa9, 0xb1, 0xae, 0xac, 0xae, 0xac, 0xab, 0xac, 0xab, 0xac, 0xab, 0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xa9, 0xab, 0x9d, 0xe1, 0xdd, 0xf7, 0xcd, 0xd4, 0xd4, 0xdb, 0x73, 0x74, 0x75, 0x49, 0x2a, 0x23, 0x28, 0x2a, 0x36, 0x3e, 0x40, 0x3a, 0x37, 0x3a, 0x37, 0x37, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x39, 0x3c, 0x3c, 0x35, 0x25, 0x18, 0x18, 0x21, 0x3b, 0x50, 0x52, 0x16, 0x5b, 0x5a, 0x15, 0x5a, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x81, 0xff, 0x5a, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0x8b, 0xf2, 0xdb, 0xf7, 0xfa, 0xf7, 0xdc, 0xca, 0xca, 0xd1, 0xca, 0xcb, 0xce, 0xca, 0xd1, 0xcb, 0xce, 0xcb, 0xca, 0xca, 0xce, 0xca, 0xdc, 0xdf, 0xf6, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xdf, 0xf5, 0xdc, 0xf4, 0xd7, 0xd6, 0xc2, 0xc7, 0xc7, 0xc7, 0xce, 0xce, 0xce, 0xce, 0xc7, 0xe1, 0xe9, 0x78, 0x33, 0x28, 0x51, 0x38, 0x35, 0x37, 0x37, 0x37, 0x37, 0x36, 0x36, 0x37, 0x37, 0x37, 0x3a, 0x4d, 0x40, 0x32, 0x51, 0x57, 0xd8, 0xdf, 0xd1, 0xb2, 0xbc, 0xc2, 0xba, 0xb9, 0xba, 0xb9, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xa8, 0xc6, 0xad, 0xd9, 0xe4, 0xce, 0xe5, 0xf8, 0xce, 0xb6, 0xa8, 0xad, 0xb2, 0xb6, 0xb8, 0xa8, 0xae, 0xb1, 0xb1, 0xae, 0xae, 0xac, 0xae, 0xac, 0xac, 0xab, 0xac, 0xab, 0xb1, 0xb1, 0xb1, 0xac, 0x9d, 0xb2, 0xe5, 0xe5, 0xe2, 0x71, 0x76, 0x76, 0x78, 0x74, 0x70, 0x47, 0x32, 0x2a, 0x25, 0x23, 0x2c, 0x36, 0x3e, 0x3e, 0x3a, 0x37, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x3c, 0x3c, 0x38, 0x39, 0x37, 0x40, 0x3c, 0x39, 0x2a, 0x18, 0x18, 0x25, 0x3d, 0x49, 0x3d, 0x34, 0x76, 0x54, 0x96, 0x14, 0x13, 0x5a, 0x5a, 0xff, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x13, 0x00, 0x5a, 0x5a, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x8a, 0xf2, 0xde, 0xe3, 0xf7, 0xf8, 0xdc, 0xce, 0xca, 0xd1, 0xd1, 0xcb, 0xce, 0xcb, 0xca, 0xca, 0xca, 0xca, 0xca, 0xd1, 0xd7, 0xdc, 0xf6, 0xdf, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xdf, 0xf5, 0xf8, 0xf8, 0xf7, 0xf5, 0xf7, 0xdc, 0xd7, 0x7b, 0xf0, 0x75, 0x6b, 0x33, 0x3d, 0x44, 0x4d, 0x37, 0x36, 0x37, 0x3a, 0x37, 0x37, 0x36, 0x3a, 0x36, 0x37, 0x37, 0x4d, 0x46, 0x39, 0x51, 0x57, 0xd8, 0xf7, 0xd1, 0xb2, 0xb9, 0xc1, 0xbf, 0xbb, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb8, 0xad, 0xbf, 0xad, 0xdc, 0xec, 0xd1, 0xf1, 0xdf, 0xce, 0xb7, 0xb6, 0xad, 0xb2, 0xb5, 0xb1, 0xb1, 0xae, 0xb1, 0xac, 0xb1, 0xae, 0xae, 0xac, 0xab, 0xac, 0xab, 0xb1, 0xae, 0xb1, 0xac, 0xac, 0xa6, 0xc6, 0xe9, 0xe9, 0x78, 0x78, 0x50, 0x70, 0x49, 0x33, 0x2a, 0x47, 0x4b, 0x35, 0x23, 0x23, 0x38, 0x3c, 0x3c, 0x3a, 0x3a, 0x40, 0x40, 0x3c, 0x3e, 0x39, 0x38, 0x39, 0x3c, 0x3c, 0x40, 0x3c, 0x39, 0x1f, 0x18, 0x18, 0x28, 0x33, 0x43, 0x71, 0x3d, 0x5e, 0x5c, 0x88, 0x6b, 0x78, 0x7a, 0xaf, 0x8a, 0x84, 0x5a, 0x7e, 0x80, 0x00, 0x00, 0x83, 0x83, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x13, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xfd, 0xf9, 0xfa, 0xf5, 0xfa, 0xdc, 0xca, 0xca, 0xd1, 0xcb, 0xce, 0xd1, 0xca, 0xca, 0xca, 0xca, 0xca, 0xce, 0xd7, 0xdc, 0xf8, 0xf8, 0xf6, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf5, 0xf7, 0xf7, 0xf7, 0xe2, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf5, 0xd6, 0xf4, 0xdf, 0xfa, 0x7a, 0x7b, 0x70, 0x3d, 0x2f, 0x3d, 0x3c, 0x35, 0x4f, 0x40, 0x37, 0x37, 0x36, 0x3a, 0x36, 0x38, 0x3a, 0x38, 0x36, 0x37, 0x46, 0x46, 0x39, 0x50, 0x57, 0xd8, 0xf5, 0xd7, 0xc2, 0xb2, 0xb9, 0xb9, 0xbb, 0xb9, 0xba, 0xb9, 0xba, 0xb8, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb5, 0xb8, 0xb6, 0xb6, 0xbf, 0xa6, 0xbf, 0xe6, 0xe2, 0xec, 0xf8, 0xd9, 0xce, 0xc3, 0xad, 0xa6, 0xad, 0xb5, 0xac, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xac, 0xb1, 0xab, 0xb1, 0xae, 0xb1, 0xa9, 0xa9, 0xab, 0xac, 0xb7, 0xe1, 0xf0, 0x7b, 0x70, 0x49, 0x3d, 0x32, 0x23, 0x2a, 0x2b, 0x25, 0x38, 0x4b, 0x46, 0x35, 0x3c, 0x3c, 0x38, 0x37, 0x3c, 0x40, 0x40, 0x3c, 0x39, 0x38, 0x3c, 0x42, 0x3c, 0x39, 0x2a, 0x2a, 0x1f, 0x18, 0x1f, 0x3d, 0x49, 0x73, 0x6e, 0x6b, 0x69, 0x6d, 0x6c, 0x64, 0x64, 0x5e, 0x8c, 0x71, 0x77, 0x7a, 0xe0, 0x6f, 0x90, 0x85, 0x7e, 0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xdb, 0xfc, 0xf9, 0xf6, 0xf8, 0xdc, 0xd1, 0xca, 0xd1, 0xd1, 0xcb, 0xd1, 0xce, 0xd7, 0xd1, 0xca, 0xd1, 0xd7, 0xdf, 0xf6, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xe2, 0xf5, 0xf7, 0xf5, 0xf7, 0xf5, 0xf7, 0xf5, 0xf5, 0xf7, 0xf5, 0xf7, 0xfa, 0xe7, 0xe7, 0xfc, 0xf0, 0x70, 0x2f, 0x32, 0x3d, 0x39, 0x35, 0x38, 0x46, 0x4b, 0x3e, 0x37, 0x38, 0x3c, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x44, 0x4c, 0x3b, 0x4e, 0x7d, 0xde, 0xdc, 0xdc, 0xca, 0xb9, 0xb7, 0xc4, 0xb6, 0xbb, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb5, 0xb5, 0xb8, 0xb2, 0xc3, 0xad, 0xb7, 0xb7, 0xc0, 0xe6, 0xeb, 0xe4, 0xf4, 0xd6, 0xd0, 0xbf, 0xb2, 0xad, 0xb2, 0xae, 0xb1, 0xae, 0xb1, 0xb1, 0xb1, 0xae, 0xb1, 0xac, 0xb1, 0xb1, 0xac, 0xa9, 0xab, 0xb1, 0xb9, 0xcd, 0xed, 0x7d, 0x70, 0x33, 0x28, 0x23, 0x23, 0x23, 0x29, 0x23, 0x29, 0x23, 0x31, 0x44, 0x4d, 0x44, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x40, 0x42, 0x42, 0x3d, 0x2a, 0x25, 0x1f, 0x18, 0x25, 0x41, 0x50, 0x70, 0x6e, 0x6b, 0x6c, 0xae, 0xa3, 0x9b, 0xa7, 0x98, 0x65, 0x8d, 0x65, 0x85, 0x5e, 0x5f, 0x8c, 0x6d, 0x77, 0xe8, 0xcf, 0x8b, 0x7e, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0xaf, 0xfb, 0xf5, 0xe2, 0xf8, 0xf6, 0xd1, 0xca, 0xd1, 0xca, 0xd1, 0xce, 0xd1, 0xdc, 0xd7, 0xd1, 0xd7, 0xdc, 0xf7, 0xf7, 0xdc, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xe2, 0xe2, 0xf7, 0xe2, 0xf7, 0xe0, 0xf7, 0xe0, 0xe3, 0xf7, 0xe8, 0xf0, 0xe8, 0xbd, 0x96, 0x90, 0x49, 0x49, 0x3d, 0x39, 0x38, 0x39, 0x3c, 0x3c, 0x4f, 0x44, 0x3a, 0x38, 0x3e, 0x3c, 0x38, 0x3c, 0x3e, 0x35, 0x38, 0x3c, 0x4f, 0x42, 0x4a, 0x7b, 0xe0, 0xf4, 0xf6, 0xd7, 0xbc, 0xb9, 0xc3, 0xb6, 0xbe, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb6, 0xb6, 0xb0, 0xb9, 0xbf, 0xad, 0xce, 0xf1, 0xeb, 0xda, 0xd1, 0xda, 0xd9, 0xd2, 0xc6, 0xad, 0xb2, 0xac, 0xb1, 0xac, 0xb1, 0xac, 0xb1, 0xac, 0xac, 0xb1, 0xb2, 0xac, 0xac, 0xac, 0xc3, 0xd0, 0x77, 0x7c, 0x57, 0x33, 0x25, 0x23, 0x31, 0x29, 0x2e, 0x29, 0x29, 0x2e, 0x2c, 0x23, 0x2c, 0x44, 0x4b, 0x4d, 0x4d, 0x46, 0x44, 0x40, 0x40, 0x39, 0x39, 0x32, 0x28, 0x1f, 0x18, 0x1f, 0x2a, 0x42, 0x50, 0x70, 0x43, 0x6d, 0x6d, 0xbb, 0xab, 0x6c, 0xa5, 0x9a, 0x95, 0xab, 0x9a, 0x9c, 0x91, 0x9b, 0x98, 0x8d, 0x64, 0x64, 0x5e, 0x88, 0x6b, 0xf9, 0xdb, 0x89, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x89, 0xfd, 0xe3, 0xe7, 0xdc, 0xf6, 0xce, 0xca, 0xd7, 0xcb, 0xcb, 0xd1, 0xcb, 0xd7, 0xf6, 0xf8, 0xf8, 0xf7, 0xf7, 0xf8, 0xe3, 0xf8, 0xe2, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf5, 0xe0, 0xf7, 0xe2, 0xf7, 0xf7, 0xfa, 0xea, 0xea, 0xfb, 0xde, 0x90, 0x86, 0x80, 0x00, 0x83, 0x19, 0x3b, 0x4a, 0x4a, 0x41, 0x3b, 0x39, 0x39, 0x40, 0x4c, 0x46, 0x40, 0x37, 0x46, 0x40, 0x35, 0x3e, 0x3e, 0x3a, 0x37, 0x40, 0x4f, 0x47, 0x56, 0xe3, 0xf6, 0xd7, 0xf6, 0xc5, 0xb2, 0xc6, 0xba, 0xb5, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xb8, 0xb6, 0xb2, 0xb6, 0xb6, 0xb9, 0xc3, 0xee, 0xd9, 0xdc, 0xce, 0xda, 0xdc, 0xd6, 0xce, 0xc9, 0xbe, 0xb2, 0xad, 0xac, 0xad, 0xb2, 0xb2, 0xac, 0xad, 0xad, 0xb6, 0xc3, 0xd0, 0xd3, 0xd0, 0x7c, 0x7b, 0x6d, 0x25, 0x2f, 0x26, 0x23, 0x29, 0x2b, 0x29, 0x26, 0x2b, 0x26, 0x2c, 0x35, 0x3e, 0x3e, 0x37, 0x46, 0x4d, 0x4f, 0x4f, 0x4f, 0x4f, 0x4e, 0x42, 0x42, 0x43, 0x41, 0x70, 0x74, 0x70, 0xbb, 0xb0, 0xb7, 0xad, 0xbb, 0xad, 0xab, 0xa4, 0xa4, 0xa3, 0x9c, 0x9a, 0x9c, 0x9a, 0x9a, 0x97, 0x6c, 0x99, 0xa4, 0xcc, 0xd9, 0xcd, 0x6b, 0x64, 0xb4, 0xfd, 0x8b, 0x5a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0xdb, 0xe7, 0xf7, 0xfa, 0xf7, 0xd1, 0xce, 0xd1, 0xd1, 0xcb, 0xd1, 0xcb, 0xca, 0xdc, 0xf6, 0xf8, 0xf8, 0xfa, 0xfa, 0xf8, 0xf7, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xea, 0xe7, 0xe7, 0xea, 0xf0, 0xf0, 0xfc, 0xe3, 0x8a, 0x7e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0x5a, 0x15, 0x61, 0x34, 0x4a, 0x4e, 0x4c, 0x42, 0x39, 0x46, 0x4c, 0x46, 0x37, 0x37, 0x40, 0x40, 0x37, 0x3a, 0x40, 0x40, 0x40, 0x4d, 0x42, 0x54, 0xed, 0xde, 0xf6, 0xf6, 0xd1, 0xc2, 0xba, 0xba, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xb5, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xb9, 0xb8, 0xb8, 0xb8, 0xba, 0xb8, 0xb5, 0xb2, 0xb5, 0xb6, 0xba, 0xb9, 0xd9, 0xef, 0xd9, 0xf4, 0xd7, 0xdc, 0xd2, 0xf4, 0xda, 0xd9, 0xd5, 0xd0, 0xca, 0xc7, 0xc2, 0xb9, 0xc2, 0xce, 0xd1, 0xd0, 0xd2, 0xd9, 0xda, 0x77, 0x7b, 0x43, 0x25, 0x1e, 0x28, 0x26, 0x26, 0x2b, 0x22, 0x26, 0x2b, 0x2c, 0x26, 0x23, 0x2c, 0x3e, 0x40, 0x40, 0x44, 0x40, 0x37, 0x39, 0x27, 0x27, 0x2a, 0x45, 0x50, 0x52, 0x78, 0x73, 0x49, 0xbb, 0xbb, 0xb8, 0xb1, 0xb1, 0xac, 0xac, 0xac, 0xa9, 0xb1, 0xab, 0xa7, 0xa3, 0x9c, 0x9a, 0x98, 0x98, 0x8e, 0x6c, 0x98, 0x8d, 0x6c, 0xc4, 0xe1, 0xea, 0xcd, 0x96, 0xfd, 0x8b, 0x84, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x7e, 0x8a, 0xfd, 0xf7, 0xfa, 0xf8, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd5, 0xcb, 0xca, 0xd1, 0xdc, 0xf6, 0xf8, 0xf8, 0xfa, 0xfa, 0xe7, 0xeb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xe7, 0xe7, 0xfa, 0xf8, 0xe2, 0xf6, 0xfd, 0xf4, 0x89, 0x7e, 0xfe, 0x81, 0xff, 0xff, 0x13, 0x5a, 0x5b, 0x5b, 0x16, 0x24, 0x41, 0x4e, 0x42, 0x42, 0x44, 0x4c, 0x4c, 0x46, 0x40, 0x44, 0x40, 0x40, 0x40, 0x37, 0x37, 0x44, 0x47, 0x54, 0x7d, 0xd6, 0xf6, 0xdc, 0xdc, 0xd1, 0xb2, 0xba, 0xbc, 0xbc, 0xbc, 0xbc, 0xb5, 0xb5, 0xb8, 0xbc, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xb9, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb5, 0xb8, 0xb6, 0xbf, 0xe5, 0xe6, 0xdf, 0xf4, 0xce, 0xf5, 0xf4, 0xd7, 0xd6, 0xd7, 0xf4, 0xdc, 0xdc, 0xdc, 0xf4, 0xd7, 0xd1, 0xd6, 0xf4, 0xd5, 0xd4, 0xdf, 0x7b, 0x75, 0x1e, 0x28, 0x2f, 0x2b, 0x31, 0x26, 0x29, 0x2e, 0x29, 0x2c, 0x29, 0x2c, 0x2c, 0x36, 0x44, 0x3e, 0x3e, 0x39, 0x25, 0x21, 0x1f, 0x21, 0x2d, 0x41, 0x50, 0x74, 0x74, 0x76, 0x7a, 0xd8, 0xb7, 0xbf, 0xba, 0xb8, 0xb5, 0xac, 0xab, 0xac, 0xb1, 0xa3, 0xa3, 0xa3, 0x9a, 0x9a, 0x98, 0x9a, 0x99, 0xb3, 0xae, 0xa7, 0x6c, 0x8e, 0x8d, 0x92, 0x6c, 0xe3, 0x7a, 0xd4, 0xfd, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x80, 0x7e, 0xcf, 0xf2, 0xf4, 0xf8, 0xf4, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xcb, 0xd1, 0xd1, 0xd1, 0xd7, 0xf4, 0xf7, 0xf8, 0xf8, 0xf7, 0xf7, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf4, 0xf7, 0xfa, 0xf8, 0xf4, 0xd6, 0xf7, 0xf7, 0xfd, 0xf2, 0x8a, 0x83, 0x00, 0xfe, 0x00, 0x00, 0x5a, 0x5b, 0x13, 0x5b, 0x13, 0x16, 0x19, 0x41, 0x45, 0x4e, 0x50, 0x4e, 0x42, 0x3b, 0x39, 0x3d, 0x40, 0x44, 0x40, 0x40, 0x44, 0x42, 0x50, 0x57, 0x79, 0xf5, 0xdc, 0xdc, 0xdc, 0xc6, 0xb8, 0xba, 0xbc, 0xbc, 0xbc, 0xba, 0xb5, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb5, 0xb8, 0xb8, 0xb5, 0xb6, 0xb2, 0xbf, 0xb6, 0xef, 0xe6, 0xd6, 0xd2, 0xf5, 0xd6, 0xf4, 0xf4, 0xd7, 0xf4, 0xd7, 0xd7, 0xd7, 0xf4, 0xd7, 0xf4, 0xf5, 0xda, 0xda, 0xd8, 0x7a, 0x7c, 0x43, 0x28, 0x2f, 0x28, 0x1e, 0x26, 0x2e, 0x2c, 0x29, 0x23, 0x23, 0x23, 0x2c, 0x2a, 0x2a, 0x2a, 0x32, 0x21, 0x1f, 0x1f, 0x3b, 0x42, 0x45, 0x56, 0x54, 0x52, 0x78, 0x54, 0xd8, 0x76, 0x77, 0xcd, 0xb6, 0xb8, 0xb8, 0xb8, 0xb5, 0xb2, 0xae, 0xae, 0xa9, 0xa9, 0xa7, 0xa7, 0xa5, 0xa4, 0xa2, 0xa0, 0x9b, 0xab, 0xd0, 0xdd, 0xd3, 0xa1, 0x8d, 0x8c, 0x5f, 0xb4, 0x7d, 0xf0, 0xdb, 0x82, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x7e, 0x87, 0xfd, 0xe7, 0xfa, 0xdc, 0xd7, 0xca, 0xd1, 0xd1, 0xcb, 0xd1, 0xd1, 0xd1, 0xca, 0xd1, 0xd1, 0xd7, 0xf4, 0xdc, 0xfa, 0xf8, 0xf7, 0xf8, 0xf8, 0xfa, 0xf8, 0xf7, 0xf6, 0xf7, 0xf8, 0xfa, 0xe6, 0xf8, 0xf8, 0xf8, 0xd6, 0xf7, 0xe2, 0xf2, 0x84, 0x7e, 0x00, 0xfe, 0x83, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5b, 0x14, 0x5b, 0x14, 0x19, 0x34, 0x50, 0x52, 0x50, 0x45, 0x42, 0x3b, 0x40, 0x39, 0x40, 0x40, 0x42, 0x4a, 0x56, 0xed, 0xe0, 0xf4, 0xdf, 0xdd, 0xd9, 0xb9, 0xb5, 0xba, 0xbc, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb5, 0xb2, 0xb2, 0xbf, 0xa6, 0xd9, 0xef, 0xd7, 0xdc, 0xd2, 0xf4, 0xf4, 0xf4, 0xf4, 0xd7, 0xd7, 0xd6, 0xd7, 0xd6, 0xd6, 0xd8, 0xd6, 0xd8, 0x7a, 0x7c, 0x77, 0x43, 0x43, 0x4d, 0x44, 0x3e, 0x2c, 0x23, 0x23, 0x23, 0x23, 0x2c, 0x31, 0x2a, 0x23, 0x18, 0x5d, 0x18, 0x1f, 0x33, 0x45, 0x4a, 0x3f, 0x1c, 0x61, 0x3b, 0x7d, 0x79, 0xdb, 0xdb, 0xe2, 0xd6, 0xd6, 0xdc, 0xc6, 0xb9, 0xb5, 0xb2, 0xb5, 0xb2, 0xb2, 0xae, 0xb1, 0xab, 0xa7, 0xa5, 0xa7, 0x9d, 0x9d, 0x93, 0x98, 0x8f, 0x8e, 0xa2, 0xd3, 0xe5, 0xdd, 0xb6, 0xa6, 0x5e, 0x85, 0xe3, 0xf3, 0x89, 0x7e, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0x00, 0x7e, 0x96, 0xf2, 0xfa, 0xe2, 0xd7, 0xce, 0xd1, 0xd1, 0xcb, 0xd1, 0xd1, 0xd1, 0xca, 0xd1, 0xd1, 0xd1, 0xce, 0xd1, 0xd7, 0xd7, 0xd7, 0xf4, 0xf6, 0xf6, 0xdc, 0xf4, 0xf6, 0xf8, 0xf6, 0xd7, 0xf6, 0xe6, 0xe6, 0xd7, 0xe7, 0xf5, 0xe2, 0xf2, 0xd4, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x80, 0x81, 0x13, 0x00, 0x5a, 0x5b, 0x13, 0x14, 0x5b, 0x13, 0x17, 0x34, 0x45, 0x4e, 0x4e, 0x4e, 0x4c, 0x4c, 0x40, 0x3b, 0x39, 0x50, 0x57, 0xe0, 0x77, 0xf4, 0xdc, 0xe1, 0xc9, 0xb9, 0xba, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb5, 0xb8, 0xb5, 0xb6, 0xb5, 0xbf, 0xb0, 0xf8, 0xef, 0xf4, 0xd7, 0xf4, 0xd2, 0xd7, 0xd7, 0xf4, 0xf4, 0xf4, 0xd6, 0xf4, 0xda, 0xd8, 0xd8, 0x7b, 0x7b, 0x77, 0x6b, 0x1f, 0x25, 0x3d, 0x36, 0x47, 0x4d, 0x44, 0x44, 0x44, 0x35, 0x2a, 0x1f, 0x1e, 0x1f, 0x25, 0x3d, 0x47, 0x4a, 0x3f, 0x61, 0x15, 0x14, 0x14, 0x5a, 0x5a, 0xaf, 0x56, 0xf9, 0xcf, 0xde, 0xe2, 0xd2, 0xf7, 0xd5, 0xcb, 0xb9, 0xb2, 0xb2, 0xb2, 0xb1, 0xae, 0xab, 0xa9, 0xa4, 0x9d, 0xa5, 0xa5, 0x9d, 0x9d, 0x9d, 0xa7, 0xa4, 0x9c, 0x9a, 0xb3, 0xd9, 0xe9, 0xd0, 0xc0, 0x8c, 0x88, 0xcf, 0x7a, 0x82, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x81, 0x00, 0x00, 0x82, 0xc8, 0xe7, 0xe7, 0xf5, 0xd1, 0xd5, 0xd1, 0xcb, 0xd5, 0xd1, 0xcb, 0xd1, 0xd1, 0xd1, 0xce, 0xd1, 0xd1, 0xca, 0xca, 0xce, 0xd1, 0xd7, 0xd7, 0xdc, 0xdc, 0xc7, 0xca, 0xc7, 0xc2, 0xd1, 0xf6, 0xf8, 0xf7, 0xd7, 0xf8, 0xf4, 0xde, 0xfd, 0x8a, 0x5a, 0x7e, 0x00, 0x7e, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x13, 0x5a, 0x5a, 0x5b, 0x5a, 0x7e, 0x16, 0x19, 0x34, 0x42, 0x4e, 0x4c, 0x0d, 0x4e, 0x48, 0x54, 0xfb, 0xe0, 0xdc, 0x77, 0xdc, 0xd9, 0xc9, 0xc1, 0xbc, 0xba, 0xbc, 0xbe, 0xbc, 0xba, 0xba, 0xbe, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb7, 0xc1, 0xb0, 0xb7, 0xef, 0xdf, 0xf7, 0xd7, 0xdc, 0xf4, 0xdc, 0xda, 0xd6, 0xd6, 0xd8, 0xd8, 0x77, 0x78, 0x7c, 0x7c, 0x6f, 0x28, 0x64, 0x3d, 0x2f, 0x2a, 0x2a, 0x2a, 0x39, 0x32, 0x39, 0x42, 0x4e, 0x4e, 0x4e, 0x50, 0x70, 0x45, 0x28, 0x19, 0x15, 0x13, 0x5b, 0x5a, 0x5a, 0x13, 0x5a, 0x13, 0x00, 0xaa, 0xe8, 0xfa, 0xde, 0xd6, 0xd7, 0xf4, 0xdc, 0xd5, 0xca, 0xc2, 0xb9, 0xb8, 0xb5, 0xb2, 0xb2, 0xb3, 0xae, 0xae, 0xab, 0xb3, 0xbc, 0xc4, 0xa4, 0x9d, 0x9a, 0x9a, 0x8e, 0x8d, 0xa4, 0xd0, 0xf1, 0xd0, 0xc0, 0x8c, 0x85, 0x7a, 0xd4, 0x7f, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x00, 0x7e, 0x84, 0xe8, 0xfc, 0xf5, 0xd6, 0xd1, 0xd1, 0xce, 0xd5, 0xd1, 0xd1, 0xca, 0xd1, 0xd1, 0xce, 0xd5, 0xdc, 0xd1, 0xd1, 0xce, 0xca, 0xca, 0xd1, 0xf6, 0xe6, 0xd7, 0xd1, 0xca, 0xd1, 0xca, 0xc5, 0xdc, 0xee, 0xd7, 0xf4, 0xe3, 0xf7, 0xe8, 0xe0, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x5a, 0x13, 0x5a, 0x5b, 0x14, 0x13, 0x16, 0x16, 0x2d, 0x2d, 0x3f, 0x76, 0xfd, 0x7a, 0xde, 0xdf, 0xd6, 0xf8, 0xd1, 0xcb, 0xb9, 0xb9, 0xbc, 0xc1, 0xbe, 0xba, 0xbe, 0xba, 0xbe, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xba, 0xba, 0xba, 0xb5, 0xba, 0xb5, 0xba, 0xba, 0xbe, 0xb0, 0xb2, 0xb7, 0xce, 0xef, 0xf7, 0xd6, 0xd6, 0xda, 0xd6, 0xd8, 0xda, 0x77, 0x7a, 0x7b, 0x7c, 0x7b, 0x70, 0x28, 0x24, 0x28, 0x28, 0x28, 0x25, 0x25, 0x2a, 0x28, 0x27, 0x3b, 0x3b, 0x4a, 0x45, 0x41, 0x2d, 0x19, 0x15, 0x5b, 0x5b, 0x5b, 0x5b, 0x5a, 0x01, 0x81, 0x5a, 0x00, 0x00, 0x81, 0x82, 0x00, 0x8b, 0xfb, 0xfa, 0xf4, 0xde, 0xd7, 0xd7, 0xd7, 0xd9, 0xd1, 0xc9, 0xc2, 0xb6, 0xb2, 0xb1, 0xb2, 0xb3, 0xa7, 0x9d, 0xa5, 0xb3, 0xcc, 0xe1, 0xe1, 0xd3, 0xb3, 0x9c, 0x9a, 0x93, 0x8d, 0xbe, 0xf1, 0x77, 0xc0, 0x66, 0x85, 0xfb, 0x9e, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x87, 0xe0, 0xf1, 0xde, 0xce, 0xce, 0xd5, 0xd1, 0xd1, 0xce, 0xd1, 0xd1, 0xd1, 0xca, 0xd1, 0xd7, 0xeb, 0xd1, 0xca, 0xca, 0xc2, 0xdc, 0xc2, 0xdc, 0xeb, 0xd7, 0xc2, 0xd1, 0xd7, 0xca, 0xd1, 0xdc, 0xeb, 0xd2, 0xf4, 0xe2, 0xf9, 0xf2, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x13, 0x5b, 0x14, 0x5b, 0x13, 0x5b, 0x5a, 0xdb, 0xfb, 0xf7, 0xf5, 0xf5, 0xdc, 0xdf, 0xd1, 0xc3, 0xc1, 0xbf, 0xb9, 0xb6, 0xbe, 0xb8, 0xba, 0xba, 0xbe, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xba, 0xb5, 0xba, 0xb8, 0xba, 0xb5, 0xb9, 0xb8, 0xb6, 0xb9, 0xb6, 0xb0, 0xf8, 0xf1, 0xf8, 0xf0, 0xea, 0xf2, 0xf0, 0x7d, 0x7c, 0x7c, 0x78, 0xbd, 0x43, 0x3f, 0x3d, 0x43, 0x43, 0x43, 0x43, 0x49, 0x45, 0x4a, 0x45, 0x41, 0x34, 0x21, 0x17, 0x14, 0x01, 0x13, 0x5a, 0x5b, 0x13, 0x5b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x7e, 0x7e, 0x87, 0xdb, 0xfd, 0xf5, 0xd2, 0xd6, 0xd6, 0xce, 0xd6, 0xd7, 0xd5, 0xc9, 0xbf, 0xb8, 0xb2, 0xac, 0xab, 0xab, 0xa9, 0xa3, 0x9d, 0xae, 0xcb, 0xe9, 0xdd, 0xc6, 0xc1, 0xa6, 0x92, 0x92, 0xd0, 0xee, 0xd4, 0x6d, 0x84, 0x90, 0xfd, 0x86, 0x81, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x86, 0xe2, 0xf2, 0xd6, 0xf4, 0xf7, 0xc7, 0xd7, 0xd1, 0xca, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xdc, 0xe4, 0xdc, 0xd1, 0xd7, 0xd1, 0xca, 0xce, 0xe6, 0xe6, 0xdc, 0xc7, 0xca, 0xca, 0xc2, 0xd1, 0xef, 0xf6, 0xc0, 0xcf, 0xdb, 0xfd, 0x8b, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x13, 0x13, 0x13, 0x5a, 0x5a, 0x89, 0xfd, 0xfa, 0xd6, 0xf6, 0xf6, 0xdc, 0xdd, 0xd5, 0xc3, 0xb9, 0xbf, 0xc1, 0xb6, 0xb9, 0xb9, 0xba, 0xb9, 0xba, 0xb8, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb5, 0xba, 0xb5, 0xba, 0xb5, 0xc1, 0xb2, 0xbf, 0xb6, 0xad, 0xca, 0xf8, 0xdf, 0x90, 0xbd, 0xaf, 0xaf, 0xaf, 0xaf, 0x3f, 0xaa, 0x41, 0x3f, 0x3f, 0x34, 0x34, 0x33, 0x28, 0x21, 0x17, 0x5c, 0x15, 0x5b, 0x14, 0x5a, 0x13, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x7e, 0x7e, 0xaa, 0xf2, 0xf9, 0xf4, 0xd6, 0xd6, 0xd2, 0xd6, 0xd6, 0xd5, 0xd0, 0xd5, 0xd0, 0xc6, 0xba, 0xb5, 0xac, 0xa9, 0xa7, 0xa1, 0x93, 0xa8, 0xec, 0xe5, 0xba, 0xd0, 0xad, 0x92, 0x9f, 0xda, 0xed, 0xed, 0xe2, 0x79, 0x79, 0x84, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x82, 0x86, 0xd4, 0xf3, 0xd6, 0xc0, 0xf4, 0xd2, 0xce, 0xd1, 0xd7, 0xd7, 0xd7, 0xd1, 0xd5, 0xca, 0xe6, 0xf8, 0xc2, 0xd1, 0xc2, 0xd7, 0xce, 0xc2, 0xe6, 0xf8, 0xc7, 0xce, 0xd7, 0xca, 0xd1, 0xf6, 0xea, 0xf5, 0xf2, 0xf2, 0xf3, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x13, 0x00, 0x00, 0xbd, 0xf2, 0xf4, 0xf5, 0xf6, 0xdc, 0xdf, 0xdf, 0xce, 0xbf, 0xbf, 0xbf, 0xb9, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xba, 0xbe, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xb8, 0xba, 0xb2, 0xb9, 0xb9, 0xb0, 0xb0, 0xce, 0xe6, 0x7f, 0x7e, 0x5a, 0x5a, 0x00, 0x5a, 0x5a, 0x13, 0x5a, 0x13, 0x5b, 0x14, 0x14, 0x13, 0x5b, 0x5b, 0x14, 0x14, 0x13, 0x5a, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5a, 0x00, 0x5a, 0x82, 0x7e, 0x87, 0xe0, 0xe8, 0xe3, 0xf4, 0xd4, 0xd2, 0xd2, 0xd2, 0xd6, 0xc7, 0xcd, 0xc9, 0xcd, 0xc9, 0xc6, 0xbe, 0xb6, 0xad, 0xa8, 0xa6, 0xb2, 0xdf, 0xe1, 0xc9, 0xc0, 0xb0, 0x66, 0x6b, 0x7a, 0xaa, 0x90, 0x87, 0x82, 0x83, 0xfe, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x7e, 0x00, 0x7e, 0x9e, 0xf3, 0xfb, 0xd2, 0xd6, 0xd7, 0xd2, 0xd7, 0xd1, 0xd1, 0xce, 0xca, 0xca, 0xd1, 0xef, 0xdf, 0xd1, 0xd7, 0xca, 0xd1, 0xc7, 0xe6, 0xeb, 0xd7, 0xca, 0xd1, 0xc7, 0xc7, 0xcd, 0xf0, 0xe2, 0xaf, 0x8b, 0x87, 0x84, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x7e, 0x86, 0xe2, 0xfd, 0xde, 0xf4, 0xf5, 0xdc, 0xdc, 0xdf, 0xd6, 0xbf, 0xb9, 0xbf, 0xc6, 0xbf, 0xbe, 0xb9, 0xbe, 0xbc, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb5, 0xb5, 0xb6, 0xb9, 0xc1, 0xad, 0xc5, 0xfa, 0xc8, 0x7e, 0x00, 0x80, 0x00, 0xff, 0xff, 0x00, 0xff, 0x13, 0xff, 0x13, 0x13, 0x13, 0x13, 0x13, 0x5a, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x7e, 0x5a, 0x5a, 0x7f, 0xaa, 0xd4, 0xfd, 0xfd, 0xe0, 0xc8, 0xc8, 0xd2, 0xcd, 0xd2, 0xcd, 0xd2, 0xd0, 0xd2, 0xcd, 0xcd, 0xc9, 0xb7, 0xa6, 0x92, 0xcd, 0xec, 0xda, 0x77, 0xd6, 0x6f, 0xe8, 0x7d, 0x8a, 0x5a, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x86, 0x7e, 0x84, 0xd4, 0xfd, 0xf4, 0xd2, 0xd2, 0xce, 0xd6, 0xd7, 0xd7, 0xd7, 0xd7, 0xc2, 0xe6, 0xeb, 0xc7, 0xd1, 0xc7, 0xd2, 0xc7, 0xd2, 0xe6, 0xf7, 0xc7, 0xd2, 0xd2, 0xd6, 0xd2, 0xfa, 0xb4, 0x7e, 0x7f, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5a, 0x00, 0x8a, 0xf2, 0xe8, 0xf4, 0xf5, 0xf4, 0xf4, 0xdf, 0xf5, 0xce, 0xc7, 0xc2, 0xbf, 0xbf, 0xb9, 0xbf, 0xc1, 0xc3, 0xbc, 0xba, 0xb9, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xc1, 0xb5, 0xb2, 0xbf, 0xb2, 0xad, 0xce, 0xf2, 0x8a, 0x7e, 0x80, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x5a, 0x83, 0x00, 0x00, 0x81, 0x5a, 0x00, 0x82, 0x8a, 0xc8, 0xfb, 0xf2, 0xfb, 0xe0, 0xd4, 0xcf, 0xcd, 0xbd, 0xc0, 0xc0, 0xc0, 0x6f, 0xc0, 0xcd, 0xc0, 0xb0, 0x96, 0xd2, 0xf3, 0xde, 0xe2, 0xc8, 0x9e, 0x89, 0x5a, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0xfe, 0x00, 0x00, 0x7e, 0x7f, 0x90, 0xe7, 0xfb, 0xe7, 0xf5, 0xc7, 0xc0, 0xce, 0xd7, 0xd1, 0xc0, 0xd7, 0xef, 0xce, 0xc7, 0xf4, 0xce, 0xd2, 0xc0, 0xea, 0xeb, 0xd6, 0xd7, 0xd2, 0xce, 0xbd, 0xea, 0xde, 0x00, 0x80, 0x00, 0x00, 0x83, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x5a, 0x5a, 0xbd, 0xf2, 0xf9, 0xf4, 0xf5, 0xf5, 0xdc, 0xdc, 0xf5, 0xd7, 0xc7, 0xbf, 0xb9, 0xb9, 0xb9, 0xbc, 0xc1, 0xbc, 0xb9, 0xbc, 0xb9, 0xbc, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbe, 0xb5, 0xac, 0xbe, 0xba, 0xad, 0xb6, 0xe2, 0xde, 0x80, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x5a, 0xfe, 0x00, 0x81, 0x80, 0x81, 0xfe, 0x7e, 0x83, 0x61, 0xaa, 0xd4, 0xfb, 0xed, 0xfb, 0xed, 0xea, 0xf9, 0xe3, 0xe0, 0xe3, 0xe3, 0xea, 0xe3, 0xe3, 0xed, 0xcd, 0x7e, 0x7e, 0x7e, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x80, 0x7e, 0x7f, 0x8a, 0xd2, 0xfc, 0xfc, 0xfa, 0xdc, 0xd2, 0xd1, 0xf4, 0xf8, 0xef, 0xf8, 0xf6, 0xf7, 0xd2, 0xd6, 0xf4, 0xf0, 0xe7, 0xf4, 0xe7, 0xe7, 0xfc, 0xfa, 0xe8, 0xbd, 0x7e, 0xfe, 0x00, 0x00, 0x13, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x5a, 0x5a, 0x5a, 0x86, 0xd4, 0xfb, 0xe0, 0xf7, 0xf5, 0xf4, 0xf5, 0xf7, 0xdf, 0xd2, 0xce, 0xc7, 0xb9, 0xb9, 0xb9, 0xbc, 0xbf, 0xbc, 0xb9, 0xbc, 0xb9, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xb5, 0xbc, 0xb5, 0xb2, 0xbe, 0xc1, 0xba, 0xb7, 0xb7, 0xfd, 0x96, 0x7f, 0x7e, 0x7e, 0x00, 0x80, 0x81, 0x80, 0x80, 0xfe, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0xfe, 0x7e, 0xfe, 0x5a, 0x7e, 0x00, 0x5a, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x7e, 0x5a, 0x7e, 0x7e, 0x7f, 0x86, 0x8a, 0x96, 0xaf, 0xbd, 0xc8, 0xcd, 0xbd, 0xb4, 0xbd, 0x6b, 0x66, 0x85, 0x7e, 0x7f, 0x7f, 0x7e, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0xfe, 0x7e, 0x00, 0x7e, 0x7e, 0x7f, 0x85, 0x96, 0xd6, 0xfa, 0xfc, 0xfc, 0xea, 0xfc, 0xb4, 0xc0, 0xd6, 0xde, 0xfa, 0xf9, 0xe3, 0xd4, 0x89, 0x7f, 0x84, 0x84, 0x5e, 0x84, 0x82, 0x7e, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x5a, 0x13, 0x00, 0x86, 0xfd, 0xf9, 0xf5, 0xde, 0xf5, 0xf5, 0xf5, 0xdc, 0xf7, 0xdc, 0xd1, 0xc7, 0xb9, 0xb9, 0xbf, 0xb9, 0xbf, 0xb9, 0xc2, 0xb9, 0xc2, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb5, 0xb5, 0xb5, 0xb8, 0xb6, 0xad, 0xdc, 0xe3, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x7e, 0x7e, 0x5a, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7f, 0x7e, 0x7e, 0x5a, 0x7e, 0x82, 0x7e, 0x00, 0x00, 0x5a, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x5a, 0x82, 0x86, 0x87, 0x86, 0x84, 0x7e, 0x5a, 0x00, 0x7f, 0x80, 0x80, 0x7e, 0x5a, 0x7e, 0x00, 0x7e, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x83, 0x87, 0xf2, 0xe8, 0xe0, 0xd4, 0xe2, 0xe2, 0xf4, 0xdc, 0xdf, 0xdc, 0xdc, 0xd1, 0xc2, 0xb9, 0xb9, 0xc2, 0xb7, 0xbf, 0xc2, 0xc3, 0xc2, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xb9, 0xa6, 0xc6, 0xe1, 0xdf, 0x9f, 0x88, 0x82, 0x7e, 0x7f, 0x7e, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfe, 0xff, 0x5a, 0x00, 0x00, 0x5a, 0xfe, 0xff, 0xfe, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x83, 0x8b, 0xfd, 0xe8, 0xf9, 0xf4, 0xdb, 0xf7, 0xf5, 0xf6, 0xdf, 0xf6, 0xdc, 0xd5, 0xc7, 0xc0, 0xb7, 0xc0, 0xc0, 0xc0, 0xb9, 0xb9, 0xb9, 0xbc, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xba, 0xb8, 0xcb, 0xad, 0xb9, 0xd5, 0xe6, 0xeb, 0xf5, 0xb4, 0x85, 0x82, 0x7f, 0x81, 0xfe, 0x00, 0x81, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xf2, 0xdb, 0xe0, 0xe2, 0xf5, 0xf5, 0xdc, 0xdc, 0xdc, 0xdf, 0xdf, 0xdc, 0xd5, 0xce, 0xc7, 0xc0, 0xbf, 0xb7, 0xb9, 0xb9, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xb8, 0xb5, 0xc3, 0xb9, 0xa8, 0xb7, 0xda, 0xe3, 0xed, 0xdb, 0x9e, 0x7e, 0x00, 0x83, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x90, 0xf3, 0x79, 0xd4, 0xde, 0xf5, 0xf5, 0xf4, 0xdc, 0xdc, 0xdf, 0xdf, 0xdc, 0xdf, 0xd6, 0xd6, 0xce, 0xce, 0xc7, 0xc6, 0xc5, 0xc1, 0xbc, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0xb2, 0xb2, 0xbf, 0xbf, 0xc0, 0xb0, 0x9f, 0xc8, 0xda, 0xf9, 0xf2, 0xaa, 0x7e, 0x7e, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x8a, 0xf2, 0xfb, 0xde, 0xd6, 0xf5, 0xf6, 0xf5, 0xdc, 0xf4, 0xdc, 0xdc, 0xdf, 0xdf, 0xdf, 0xdc, 0xdc, 0xd5, 0xd1, 0xc6, 0xc5, 0xba, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xba, 0xc6, 0xc3, 0xb8, 0xb0, 0xb6, 0xc0, 0xd2, 0xb0, 0xaf, 0xc0, 0xbd, 0xe8, 0xe3, 0x61, 0x7f, 0x5a, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x7e, 0x00, 0x87, 0xfb, 0xf0, 0xe3, 0xf5, 0xf5, 0xf5, 0xf6, 0xdc, 0xdc, 0xdc, 0xdc, 0xf5, 0xdf, 0xf5, 0xd9, 0xd5, 0xca, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xb2, 0xb8, 0xb6, 0xb6, 0xc6, 0xbf, 0xb6, 0xb7, 0xb0, 0xc0, 0xb4, 0xb0, 0xc0, 0xe2, 0xea, 0x9e, 0x7e, 0x5a, 0x5a, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x81, 0x7e, 0x7e, 0x7e, 0xbd, 0xfd, 0xe0, 0xf7, 0xf6, 0xf5, 0xf6, 0xdf, 0xf6, 0xdf, 0xdc, 0xdc, 0xf4, 0xd1, 0xc6, 0xb9, 0xb9, 0xbc, 0xbc, 0xba, 0xbc, 0xba, 0xbc, 0xba, 0xb9, 0xba, 0xc3, 0xc6, 0xb8, 0xad, 0xb6, 0xc3, 0xc9, 0xdd, 0xbf, 0xb7, 0xbf, 0xc0, 0xb7, 0xb0, 0xc0, 0xf0, 0x96, 0x84, 0x5a, 0x5a, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x80, 0x7e, 0x7e, 0x8b, 0xfc, 0xfa, 0xe2, 0xf5, 0xf5, 0xf6, 0xdc, 0xf4, 0xf5, 0xf5, 0xda, 0xce, 0xbf, 0xb6, 0xc2, 0xc5, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xb9, 0xbc, 0xb9, 0xb2, 0xc6, 0xb9, 0xb8, 0xc3, 0xbe, 0xb6, 0xc9, 0xe5, 0xd5, 0xbf, 0xb6, 0xb7, 0xb6, 0xb7, 0xc0, 0xf2, 0x90, 0x5a, 0x7e, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x7e, 0x7e, 0x82, 0xaa, 0xf2, 0xf7, 0xf7, 0xd6, 0xf6, 0xf4, 0xdf, 0xf5, 0xd7, 0xc7, 0xc2, 0xc2, 0xc1, 0xb9, 0xcb, 0xb9, 0xb5, 0xbc, 0xc1, 0xb6, 0xb8, 0xc3, 0xba, 0xb6, 0xc1, 0xc3, 0xb2, 0xbf, 0xc6, 0xb6, 0xc6, 0xdf, 0xe4, 0xc6, 0xb9, 0xc6, 0xad, 0xb7, 0xd4, 0xfb, 0x87, 0x5a, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x7e, 0x7f, 0x7e, 0x87, 0xfc, 0xf9, 0xea, 0xc8, 0xe7, 0xf4, 0xf5, 0xda, 0xc7, 0xb7, 0xc2, 0xc5, 0xb9, 0xa8, 0xc5, 0xcb, 0xb9, 0xba, 0xc5, 0xc6, 0xb2, 0xca, 0xd3, 0xb2, 0xad, 0xcb, 0xc6, 0xa8, 0xc6, 0xb8, 0xba, 0xdd, 0xee, 0xcb, 0xa6, 0xd1, 0xb6, 0xaa, 0xe0, 0x79, 0x82, 0x5a, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x7f, 0x7e, 0x90, 0xf2, 0xf4, 0xfa, 0xd2, 0xf4, 0xf7, 0xf5, 0xc7, 0xb9, 0xc2, 0xc2, 0xbc, 0xb9, 0xb9, 0xc1, 0xbc, 0xc1, 0xbf, 0xc1, 0xbf, 0xbe, 0xd9, 0xd9, 0xc6, 0xb8, 0xb6, 0xb9, 0xc1, 0xb6, 0xbe, 0xbc, 0xe1, 0xe5, 0xc5, 0xb2, 0xad, 0xc0, 0xbd, 0xe8, 0x61, 0x5a, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x7e, 0x7e, 0x7e, 0x7e, 0xbd, 0xf2, 0xde, 0xf7, 0xde, 0xdf, 0xdc, 0xd7, 0xc7, 0xc2, 0xc2, 0xc2, 0xd5, 0xcb, 0xb9, 0xba, 0xb9, 0xb9, 0xc2, 0xc6, 0xb2, 0xca, 0xdf, 0xdf, 0xcb, 0xb6, 0xb8, 0xc3, 0xb8, 0xca, 0xb2, 0xa6, 0xe4, 0xec, 0xac, 0xb9, 0xaf, 0xb4, 0x79, 0xc8, 0x7e, 0x80, 0x5a, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x7e, 0x84, 0xf9, 0xfb, 0xf9, 0xf5, 0xf4, 0xf4, 0xf4, 0xd1, 0xbf, 0xb9, 0xc5, 0xcb, 0xdc, 0xd9, 0xc1, 0xb9, 0xc6, 0xc6, 0xb9, 0xbe, 0xc3, 0xb8, 0xd5, 0xec, 0xd5, 0xa8, 0xbc, 0xb6, 0xb6, 0xcb, 0xb0, 0xbc, 0xe5, 0xe6, 0xd5, 0xf5, 0xf9, 0xe8, 0x9e, 0x7e, 0x5a, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x7e, 0x86, 0xe8, 0xfb, 0xe2, 0xf4, 0xf4, 0xdf, 0xf4, 0xc5, 0xc2, 0xc2, 0xc2, 0xd1, 0xe1, 0xdf, 0xd5, 0xc5, 0xc2, 0xbf, 0xc5, 0xb9, 0xb2, 0xc1, 0xdd, 0xe5, 0xd5, 0xb6, 0xb9, 0xb0, 0xc2, 0xce, 0xa8, 0xca, 0xee, 0xdc, 0xbd, 0xbd, 0x90, 0x84, 0x5a, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0xfe, 0x80, 0xfe, 0x89, 0xfd, 0xe7, 0xf8, 0xf5, 0xdc, 0xdc, 0xd7, 0xce, 0xc5, 0xc2, 0xbc, 0xd1, 0xe5, 0xe6, 0xd5, 0xc6, 0xd1, 0xc3, 0xb9, 0xd0, 0xc2, 0xa8, 0xdd, 0xee, 0xc6, 0xb9, 0xc7, 0xb6, 0xbf, 0xc2, 0xb7, 0xdd, 0xf7, 0x7f, 0x7e, 0x7e, 0x7e, 0x5a, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0xfe, 0x80, 0x86, 0xfb, 0xea, 0xfa, 0xf4, 0xf5, 0xf8, 0xdc, 0xc7, 0xc7, 0xb9, 0xb9, 0xd5, 0xe4, 0xe6, 0xdf, 0xd1, 0xcb, 0xbe, 0xc1, 0xc1, 0xb6, 0xca, 0xdf, 0xe5, 0xb7, 0xbf, 0xc7, 0xb0, 0xc0, 0xbf, 0xc0, 0xfc, 0x5e, 0x7e, 0x7f, 0x5a, 0x5a, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x84, 0xcf, 0x7d, 0xfb, 0xd4, 0xe2, 0xe3, 0xd6, 0xd2, 0xb4, 0xc7, 0xc0, 0xdc, 0xef, 0xdf, 0xd9, 0xdf, 0xd1, 0xb2, 0xb6, 0xca, 0xb9, 0xc7, 0xeb, 0xce, 0xc0, 0xb7, 0xc0, 0xa8, 0xb4, 0xd6, 0xfc, 0x87, 0x83, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x8b, 0xf9, 0xf3, 0xe8, 0xd4, 0xe2, 0xcf, 0xb7, 0xb4, 0xb4, 0xc7, 0xea, 0xe2, 0xe4, 0xd5, 0xd5, 0xc7, 0xbf, 0xbf, 0xb7, 0xc7, 0xeb, 0xfc, 0xe7, 0xea, 0xf2, 0xf0, 0xfb, 0xe7, 0x79, 0x84, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x7e, 0x7e, 0xfe, 0x8b, 0xde, 0x7d, 0xf3, 0xf0, 0xf9, 0xe0, 0xd2, 0xde, 0xfc, 0xea, 0xfc, 0xfc, 0xf1, 0xfa, 0xd2, 0xcd, 0xc8, 0xda, 0xe7, 0x66, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x89, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x86, 0x89, 0xc8, 0xcf, 0xe3, 0xf9, 0xe0, 0xc8, 0x8a, 0x85, 0x66, 0xb4, 0xcf, 0xe2, 0xfb, 0xe7, 0xd4, 0xbd, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x80, 0x80, 0x00, 0x00, 0x00, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x7e, 0x80, 0x7e, 0x7e, 0x00, 0x82, 0x7f, 0x82, 0x82, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x82, 0x84, 0x84, 0x7e, 0x5a, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x5a, 0x7e, 0x5a, 0x00, 0x00, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_img_dsc_t image24 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 312,
-  .header.h = 208,
-  .data_size = 65920,
-  .data = image24_map,
-};
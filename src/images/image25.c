@@ -1,495 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE25
-#define LV_ATTRIBUTE_IMG_IMAGE25
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE25 uint8_t image25_map[] = {
-  0xfe, 0xfe, 0xfe, 0xff, 	/*Color of index 0*/
-  0x02, 0x02, 0x02, 0xff, 	/*Color of index 1*/
-  0xf3, 0xf3, 0xf4, 0xff, 	/*Color of index 2*/
-  0xc2, 0xc1, 0xc5, 0xff, 	/*Color of index 3*/
-  0xac, 0xae, 0xbc, 0xff, 	/*Color of index 4*/
-  0x9a, 0x9b, 0xb7, 0xff, 	/*Color of index 5*/
-  0x7e, 0x76, 0xeb, 0xff, 	/*Color of index 6*/
-  0x7c, 0x75, 0xd6, 0xff, 	/*Color of index 7*/
-  0x7c, 0x76, 0xc7, 0xff, 	/*Color of index 8*/
-  0x6f, 0x68, 0xe6, 0xff, 	/*Color of index 9*/
-  0x78, 0x73, 0xba, 0xff, 	/*Color of index 10*/
-  0x6b, 0x62, 0xf4, 0xff, 	/*Color of index 11*/
-  0x73, 0x6a, 0xd6, 0xff, 	/*Color of index 12*/
-  0x73, 0x6b, 0xc8, 0xff, 	/*Color of index 13*/
-  0x78, 0x73, 0xa7, 0xff, 	/*Color of index 14*/
-  0x67, 0x62, 0xe5, 0xff, 	/*Color of index 15*/
-  0x6c, 0x64, 0xd8, 0xff, 	/*Color of index 16*/
-  0x71, 0x6b, 0xb4, 0xff, 	/*Color of index 17*/
-  0x64, 0x5c, 0xe8, 0xff, 	/*Color of index 18*/
-  0x6a, 0x63, 0xc8, 0xff, 	/*Color of index 19*/
-  0x64, 0x5d, 0xd7, 0xff, 	/*Color of index 20*/
-  0x5c, 0x54, 0xeb, 0xff, 	/*Color of index 21*/
-  0x6a, 0x65, 0x9f, 0xff, 	/*Color of index 22*/
-  0x70, 0x70, 0x76, 0xff, 	/*Color of index 23*/
-  0x66, 0x5f, 0xb2, 0xff, 	/*Color of index 24*/
-  0x5c, 0x52, 0xcf, 0xff, 	/*Color of index 25*/
-  0x52, 0x49, 0xe5, 0xff, 	/*Color of index 26*/
-  0x68, 0x64, 0x81, 0xff, 	/*Color of index 27*/
-  0x5f, 0x5a, 0x99, 0xff, 	/*Color of index 28*/
-  0x4a, 0x42, 0xd4, 0xff, 	/*Color of index 29*/
-  0x5c, 0x5e, 0x6b, 0xff, 	/*Color of index 30*/
-  0x4c, 0x4c, 0x9b, 0xff, 	/*Color of index 31*/
-  0x4d, 0x45, 0xb0, 0xff, 	/*Color of index 32*/
-  0x56, 0x50, 0x87, 0xff, 	/*Color of index 33*/
-  0x3f, 0x37, 0xd7, 0xff, 	/*Color of index 34*/
-  0x4f, 0x54, 0x60, 0xff, 	/*Color of index 35*/
-  0x3e, 0x36, 0xc4, 0xff, 	/*Color of index 36*/
-  0x4e, 0x4b, 0x74, 0xff, 	/*Color of index 37*/
-  0x48, 0x37, 0xae, 0xff, 	/*Color of index 38*/
-  0x3a, 0x31, 0xbb, 0xff, 	/*Color of index 39*/
-  0x47, 0x40, 0x83, 0xff, 	/*Color of index 40*/
-  0x3b, 0x34, 0xae, 0xff, 	/*Color of index 41*/
-  0x33, 0x2a, 0xc9, 0xff, 	/*Color of index 42*/
-  0x3b, 0x36, 0x9a, 0xff, 	/*Color of index 43*/
-  0x2b, 0x22, 0xda, 0xff, 	/*Color of index 44*/
-  0x30, 0x23, 0xd2, 0xff, 	/*Color of index 45*/
-  0x35, 0x2d, 0xae, 0xff, 	/*Color of index 46*/
-  0x32, 0x29, 0xbc, 0xff, 	/*Color of index 47*/
-  0x43, 0x3f, 0x6c, 0xff, 	/*Color of index 48*/
-  0x2f, 0x1f, 0xde, 0xff, 	/*Color of index 49*/
-  0x24, 0x24, 0xcb, 0xff, 	/*Color of index 50*/
-  0x31, 0x23, 0xc8, 0xff, 	/*Color of index 51*/
-  0x29, 0x21, 0xcc, 0xff, 	/*Color of index 52*/
-  0x19, 0x20, 0xd4, 0xff, 	/*Color of index 53*/
-  0x24, 0x20, 0xd0, 0xff, 	/*Color of index 54*/
-  0x29, 0x1f, 0xd1, 0xff, 	/*Color of index 55*/
-  0x28, 0x1e, 0xd4, 0xff, 	/*Color of index 56*/
-  0x1c, 0x1d, 0xdb, 0xff, 	/*Color of index 57*/
-  0x32, 0x2c, 0x9f, 0xff, 	/*Color of index 58*/
-  0x2a, 0x22, 0xc3, 0xff, 	/*Color of index 59*/
-  0x2a, 0x1b, 0xda, 0xff, 	/*Color of index 60*/
-  0x24, 0x1b, 0xda, 0xff, 	/*Color of index 61*/
-  0x26, 0x1c, 0xd5, 0xff, 	/*Color of index 62*/
-  0x3f, 0x3e, 0x5a, 0xff, 	/*Color of index 63*/
-  0x2b, 0x24, 0xb6, 0xff, 	/*Color of index 64*/
-  0x43, 0x42, 0x46, 0xff, 	/*Color of index 65*/
-  0x30, 0x29, 0x93, 0xff, 	/*Color of index 66*/
-  0x24, 0x1a, 0xc9, 0xff, 	/*Color of index 67*/
-  0x33, 0x2d, 0x7f, 0xff, 	/*Color of index 68*/
-  0x24, 0x15, 0xd4, 0xff, 	/*Color of index 69*/
-  0x25, 0x1a, 0xb8, 0xff, 	/*Color of index 70*/
-  0x35, 0x31, 0x59, 0xff, 	/*Color of index 71*/
-  0x27, 0x24, 0x86, 0xff, 	/*Color of index 72*/
-  0x33, 0x35, 0x45, 0xff, 	/*Color of index 73*/
-  0x25, 0x25, 0x6e, 0xff, 	/*Color of index 74*/
-  0x1f, 0x18, 0x9b, 0xff, 	/*Color of index 75*/
-  0x1f, 0x1d, 0x7f, 0xff, 	/*Color of index 76*/
-  0x29, 0x25, 0x44, 0xff, 	/*Color of index 77*/
-  0x2b, 0x2a, 0x2f, 0xff, 	/*Color of index 78*/
-  0x22, 0x1e, 0x5a, 0xff, 	/*Color of index 79*/
-  0x12, 0x19, 0x66, 0xff, 	/*Color of index 80*/
-  0x1c, 0x16, 0x6a, 0xff, 	/*Color of index 81*/
-  0x13, 0x0d, 0x83, 0xff, 	/*Color of index 82*/
-  0x1c, 0x1e, 0x2b, 0xff, 	/*Color of index 83*/
-  0x13, 0x11, 0x54, 0xff, 	/*Color of index 84*/
-  0x1d, 0x19, 0x35, 0xff, 	/*Color of index 85*/
-  0x09, 0x07, 0x68, 0xff, 	/*Color of index 86*/
-  0x08, 0x0c, 0x45, 0xff, 	/*Color of index 87*/
-  0x05, 0x04, 0x56, 0xff, 	/*Color of index 88*/
-  0x14, 0x11, 0x25, 0xff, 	/*Color of index 89*/
-  0x06, 0x0b, 0x35, 0xff, 	/*Color of index 90*/
-  0x02, 0x01, 0x45, 0xff, 	/*Color of index 91*/
-  0x04, 0x0a, 0x1d, 0xff, 	/*Color of index 92*/
-  0x01, 0x00, 0x37, 0xff, 	/*Color of index 93*/
-  0x01, 0x01, 0x2a, 0xff, 	/*Color of index 94*/
-  0x02, 0x01, 0x1d, 0xff, 	/*Color of index 95*/
-  0x00, 0x01, 0x10, 0xff, 	/*Color of index 96*/
-  0xf9, 0xfb, 0xfc, 0xff, 	/*Color of index 97*/
-  0xf3, 0xf6, 0xfa, 0xff, 	/*Color of index 98*/
-  0x9b, 0xe8, 0xf4, 0xff, 	/*Color of index 99*/
-  0x7e, 0xd9, 0xf5, 0xff, 	/*Color of index 100*/
-  0x92, 0xd9, 0xec, 0xff, 	/*Color of index 101*/
-  0x6c, 0xd5, 0xf6, 0xff, 	/*Color of index 102*/
-  0x59, 0xd3, 0xf7, 0xff, 	/*Color of index 103*/
-  0x43, 0xd1, 0xf7, 0xff, 	/*Color of index 104*/
-  0x1c, 0xd0, 0xfc, 0xff, 	/*Color of index 105*/
-  0x60, 0xca, 0xf1, 0xff, 	/*Color of index 106*/
-  0x4e, 0xca, 0xf3, 0xff, 	/*Color of index 107*/
-  0x16, 0xc9, 0xfd, 0xff, 	/*Color of index 108*/
-  0x81, 0xc7, 0xdc, 0xff, 	/*Color of index 109*/
-  0x3c, 0xc7, 0xf3, 0xff, 	/*Color of index 110*/
-  0x08, 0xc9, 0xfb, 0xff, 	/*Color of index 111*/
-  0x2c, 0xc5, 0xfa, 0xff, 	/*Color of index 112*/
-  0x1b, 0xc5, 0xfc, 0xff, 	/*Color of index 113*/
-  0x50, 0xc6, 0xe6, 0xff, 	/*Color of index 114*/
-  0x6f, 0xc3, 0xe5, 0xff, 	/*Color of index 115*/
-  0x5e, 0xc2, 0xe9, 0xff, 	/*Color of index 116*/
-  0x0c, 0xc3, 0xfd, 0xff, 	/*Color of index 117*/
-  0x2b, 0xc4, 0xee, 0xff, 	/*Color of index 118*/
-  0x04, 0xc3, 0xfc, 0xff, 	/*Color of index 119*/
-  0x3e, 0xc2, 0xeb, 0xff, 	/*Color of index 120*/
-  0x0f, 0xc4, 0xf4, 0xff, 	/*Color of index 121*/
-  0x12, 0xc1, 0xfd, 0xff, 	/*Color of index 122*/
-  0x1a, 0xc1, 0xf2, 0xff, 	/*Color of index 123*/
-  0x12, 0xbe, 0xfd, 0xff, 	/*Color of index 124*/
-  0x1e, 0xbc, 0xfe, 0xff, 	/*Color of index 125*/
-  0x23, 0xbf, 0xef, 0xff, 	/*Color of index 126*/
-  0x0a, 0xbc, 0xfc, 0xff, 	/*Color of index 127*/
-  0x42, 0xbd, 0xe4, 0xff, 	/*Color of index 128*/
-  0x2d, 0xbb, 0xed, 0xff, 	/*Color of index 129*/
-  0x5d, 0xba, 0xdc, 0xff, 	/*Color of index 130*/
-  0x02, 0xbc, 0xf2, 0xff, 	/*Color of index 131*/
-  0x11, 0xbd, 0xe8, 0xff, 	/*Color of index 132*/
-  0x0d, 0xb8, 0xf3, 0xff, 	/*Color of index 133*/
-  0x31, 0xb7, 0xe1, 0xff, 	/*Color of index 134*/
-  0x19, 0xb5, 0xe3, 0xff, 	/*Color of index 135*/
-  0x58, 0xb2, 0xd0, 0xff, 	/*Color of index 136*/
-  0x70, 0xb0, 0xc6, 0xff, 	/*Color of index 137*/
-  0x34, 0xaa, 0xd3, 0xff, 	/*Color of index 138*/
-  0x51, 0xa5, 0xd0, 0xff, 	/*Color of index 139*/
-  0x50, 0xa1, 0xbf, 0xff, 	/*Color of index 140*/
-  0x69, 0xa1, 0xac, 0xff, 	/*Color of index 141*/
-  0x42, 0x96, 0xb7, 0xff, 	/*Color of index 142*/
-  0x0f, 0x96, 0xc8, 0xff, 	/*Color of index 143*/
-  0x3e, 0x8a, 0xae, 0xff, 	/*Color of index 144*/
-  0x3f, 0x83, 0x9d, 0xff, 	/*Color of index 145*/
-  0x15, 0x7a, 0xa3, 0xff, 	/*Color of index 146*/
-  0x31, 0x7a, 0x97, 0xff, 	/*Color of index 147*/
-  0x37, 0x75, 0x88, 0xff, 	/*Color of index 148*/
-  0x1a, 0x65, 0x96, 0xff, 	/*Color of index 149*/
-  0x20, 0x69, 0x82, 0xff, 	/*Color of index 150*/
-  0x34, 0x63, 0x73, 0xff, 	/*Color of index 151*/
-  0x19, 0x57, 0x73, 0xff, 	/*Color of index 152*/
-  0x1c, 0x52, 0x62, 0xff, 	/*Color of index 153*/
-  0x0c, 0x4b, 0x79, 0xff, 	/*Color of index 154*/
-  0x07, 0x43, 0x64, 0xff, 	/*Color of index 155*/
-  0x23, 0x43, 0x4b, 0xff, 	/*Color of index 156*/
-  0x07, 0x3a, 0x51, 0xff, 	/*Color of index 157*/
-  0x2e, 0x32, 0x36, 0xff, 	/*Color of index 158*/
-  0x01, 0x2d, 0x46, 0xff, 	/*Color of index 159*/
-  0x1c, 0x27, 0x35, 0xff, 	/*Color of index 160*/
-  0x02, 0x1d, 0x4c, 0xff, 	/*Color of index 161*/
-  0x00, 0x1f, 0x37, 0xff, 	/*Color of index 162*/
-  0x03, 0x16, 0x27, 0xff, 	/*Color of index 163*/
-  0x04, 0x15, 0x1a, 0xff, 	/*Color of index 164*/
-  0x05, 0x0b, 0x0c, 0xff, 	/*Color of index 165*/
-  0xee, 0xfe, 0xf9, 0xff, 	/*Color of index 166*/
-  0x1b, 0x1f, 0x1e, 0xff, 	/*Color of index 167*/
-  0xf6, 0xf8, 0xf6, 0xff, 	/*Color of index 168*/
-  0xec, 0xf1, 0xe5, 0xff, 	/*Color of index 169*/
-  0xfc, 0xfc, 0xf6, 0xff, 	/*Color of index 170*/
-  0xfa, 0xfc, 0xed, 0xff, 	/*Color of index 171*/
-  0xf4, 0xf3, 0xeb, 0xff, 	/*Color of index 172*/
-  0xeb, 0xeb, 0xea, 0xff, 	/*Color of index 173*/
-  0xeb, 0xe9, 0xe2, 0xff, 	/*Color of index 174*/
-  0xe1, 0xe1, 0xd8, 0xff, 	/*Color of index 175*/
-  0xcf, 0xd1, 0xc1, 0xff, 	/*Color of index 176*/
-  0xc2, 0xc1, 0xba, 0xff, 	/*Color of index 177*/
-  0xbb, 0xba, 0xb7, 0xff, 	/*Color of index 178*/
-  0xa2, 0xa2, 0xa0, 0xff, 	/*Color of index 179*/
-  0x62, 0x62, 0x60, 0xff, 	/*Color of index 180*/
-  0xf9, 0xf6, 0xf2, 0xff, 	/*Color of index 181*/
-  0xda, 0xd7, 0xd2, 0xff, 	/*Color of index 182*/
-  0xd3, 0xd2, 0xd0, 0xff, 	/*Color of index 183*/
-  0xca, 0xc7, 0xc1, 0xff, 	/*Color of index 184*/
-  0xb6, 0xb3, 0xb1, 0xff, 	/*Color of index 185*/
-  0xad, 0xa7, 0x9f, 0xff, 	/*Color of index 186*/
-  0xc5, 0x9e, 0x6d, 0xff, 	/*Color of index 187*/
-  0x97, 0x95, 0x91, 0xff, 	/*Color of index 188*/
-  0xc5, 0x99, 0x60, 0xff, 	/*Color of index 189*/
-  0xd3, 0x9c, 0x51, 0xff, 	/*Color of index 190*/
-  0x95, 0x8f, 0x87, 0xff, 	/*Color of index 191*/
-  0xbb, 0x95, 0x65, 0xff, 	/*Color of index 192*/
-  0xc7, 0x97, 0x54, 0xff, 	/*Color of index 193*/
-  0xd3, 0x99, 0x43, 0xff, 	/*Color of index 194*/
-  0xd9, 0x98, 0x44, 0xff, 	/*Color of index 195*/
-  0xc2, 0x94, 0x56, 0xff, 	/*Color of index 196*/
-  0xd1, 0x96, 0x49, 0xff, 	/*Color of index 197*/
-  0xd9, 0x97, 0x3d, 0xff, 	/*Color of index 198*/
-  0xb2, 0x8f, 0x63, 0xff, 	/*Color of index 199*/
-  0xd2, 0x95, 0x43, 0xff, 	/*Color of index 200*/
-  0xca, 0x93, 0x4a, 0xff, 	/*Color of index 201*/
-  0xbb, 0x90, 0x57, 0xff, 	/*Color of index 202*/
-  0xd4, 0x95, 0x3d, 0xff, 	/*Color of index 203*/
-  0xcb, 0x93, 0x44, 0xff, 	/*Color of index 204*/
-  0xc5, 0x90, 0x4c, 0xff, 	/*Color of index 205*/
-  0xcd, 0x91, 0x3d, 0xff, 	/*Color of index 206*/
-  0x85, 0x83, 0x7f, 0xff, 	/*Color of index 207*/
-  0xbd, 0x8c, 0x4a, 0xff, 	/*Color of index 208*/
-  0xaf, 0x89, 0x58, 0xff, 	/*Color of index 209*/
-  0xa3, 0x86, 0x63, 0xff, 	/*Color of index 210*/
-  0xc6, 0x8c, 0x3f, 0xff, 	/*Color of index 211*/
-  0xb3, 0x84, 0x47, 0xff, 	/*Color of index 212*/
-  0x7b, 0x7a, 0x79, 0xff, 	/*Color of index 213*/
-  0xa2, 0x80, 0x56, 0xff, 	/*Color of index 214*/
-  0x9e, 0x7a, 0x4a, 0xff, 	/*Color of index 215*/
-  0x7c, 0x74, 0x69, 0xff, 	/*Color of index 216*/
-  0x91, 0x70, 0x48, 0xff, 	/*Color of index 217*/
-  0x6e, 0x6a, 0x66, 0xff, 	/*Color of index 218*/
-  0x85, 0x6a, 0x48, 0xff, 	/*Color of index 219*/
-  0x69, 0x61, 0x55, 0xff, 	/*Color of index 220*/
-  0x81, 0x62, 0x3d, 0xff, 	/*Color of index 221*/
-  0x78, 0x5a, 0x33, 0xff, 	/*Color of index 222*/
-  0x5f, 0x53, 0x46, 0xff, 	/*Color of index 223*/
-  0x53, 0x51, 0x50, 0xff, 	/*Color of index 224*/
-  0x6d, 0x50, 0x2c, 0xff, 	/*Color of index 225*/
-  0x4c, 0x43, 0x37, 0xff, 	/*Color of index 226*/
-  0x61, 0x46, 0x25, 0xff, 	/*Color of index 227*/
-  0x3d, 0x3a, 0x39, 0xff, 	/*Color of index 228*/
-  0x4f, 0x3d, 0x27, 0xff, 	/*Color of index 229*/
-  0x5a, 0x3d, 0x1a, 0xff, 	/*Color of index 230*/
-  0x4f, 0x35, 0x15, 0xff, 	/*Color of index 231*/
-  0x3d, 0x32, 0x25, 0xff, 	/*Color of index 232*/
-  0x30, 0x28, 0x20, 0xff, 	/*Color of index 233*/
-  0x44, 0x2b, 0x0e, 0xff, 	/*Color of index 234*/
-  0x3a, 0x22, 0x05, 0xff, 	/*Color of index 235*/
-  0x2e, 0x1f, 0x0f, 0xff, 	/*Color of index 236*/
-  0x23, 0x19, 0x10, 0xff, 	/*Color of index 237*/
-  0x2d, 0x18, 0x01, 0xff, 	/*Color of index 238*/
-  0x17, 0x13, 0x11, 0xff, 	/*Color of index 239*/
-  0x21, 0x11, 0x01, 0xff, 	/*Color of index 240*/
-  0x1c, 0x0a, 0x00, 0xff, 	/*Color of index 241*/
-  0x15, 0x05, 0x00, 0xff, 	/*Color of index 242*/
-  0x0f, 0x02, 0x00, 0xff, 	/*Color of index 243*/
-  0xf2, 0xed, 0xef, 0xff, 	/*Color of index 244*/
-  0xe1, 0xdd, 0xde, 0xff, 	/*Color of index 245*/
-  0xcf, 0xcb, 0xcc, 0xff, 	/*Color of index 246*/
-  0xae, 0xab, 0xac, 0xff, 	/*Color of index 247*/
-  0x5d, 0x59, 0x59, 0xff, 	/*Color of index 248*/
-  0xfc, 0xf6, 0xfc, 0xff, 	/*Color of index 249*/
-  0xe4, 0xe3, 0xe4, 0xff, 	/*Color of index 250*/
-  0x9c, 0x9a, 0x9b, 0xff, 	/*Color of index 251*/
-  0x8a, 0x88, 0x8a, 0xff, 	/*Color of index 252*/
-  0x4b, 0x4a, 0x4b, 0xff, 	/*Color of index 253*/
-  0xda, 0xd9, 0xdc, 0xff, 	/*Color of index 254*/
-  0x8f, 0x8a, 0x98, 0xff, 	/*Color of index 255*/
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x61, 0xf9, 0xf9, 0x61, 0x61, 0xf9, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0xac, 0xab, 0xab, 0xaf, 0xb0, 0xb1, 0x03, 0xb9, 0xf7, 0xff, 0xfc, 0x17, 0x1e, 0x23, 0x23, 0xe0, 0xe0, 0xe0, 0x1e, 0xd5, 0xb3, 0xb1, 0xb6, 0xa9, 0xab, 0xab, 0xac, 0xab, 0xaa, 0xb5, 0x61, 0xf9, 0xf9, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0xa8, 0xb5, 0xaa, 0x00, 0xaa, 0x00, 0xab, 0xac, 0xac, 0xac, 0xf4, 0xad, 0xb9, 0xba, 0xbf, 0xb4, 0xfd, 0x49, 0x4d, 0x55, 0x5f, 0x5e, 0x59, 0x55, 0x4d, 0x4d, 0x55, 0x4d, 0x4d, 0xa0, 0x59, 0x59, 0xa0, 0x41, 0xd5, 0xba, 0xa9, 0xab, 0xaa, 0xaa, 0x00, 0x61, 0xf4, 0xf9, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0xf9, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0xf9, 0xf4, 0xf9, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xac, 0xad, 0xf5, 0x03, 0xbc, 0xda, 0xfd, 0xa7, 0x55, 0x5c, 0x5f, 0x5f, 0x5f, 0x5e, 0x5d, 0x5d, 0x5b, 0x54, 0x4f, 0x47, 0x28, 0x21, 0x1c, 0x21, 0x25, 0x30, 0x30, 0x47, 0x55, 0x55, 0xa0, 0xb4, 0xf7, 0xad, 0x00, 0x61, 0x61, 0x61, 0x61, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x61, 0x00, 0x00, 0x02, 0xf4, 0x02, 0x00, 0xfe, 0xf7, 0x17, 0x41, 0x53, 0x5c, 0x5f, 0x59, 0x5e, 0x5d, 0x5b, 0x54, 0x54, 0x4c, 0x44, 0x42, 0x2b, 0x2b, 0x2b, 0x2b, 0x26, 0x1f, 0x19, 0x11, 0x08, 0x08, 0x0a, 0x0a, 0x11, 0x1c, 0x30, 0x47, 0x5c, 0x4d, 0xfc, 0xfa, 0x00, 0x00, 0x61, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0xf9, 0xb5, 0xf4, 0xf6, 0xfb, 0x17, 0x49, 0x55, 0x5e, 0x5e, 0x5e, 0x5d, 0x5a, 0x54, 0x4a, 0x42, 0x2b, 0x3a, 0x29, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x27, 0x2e, 0x2e, 0x40, 0x2e, 0x2e, 0x19, 0x13, 0x10, 0x13, 0x13, 0x0d, 0x0a, 0x11, 0x25, 0x4d, 0x55, 0xd5, 0xf4, 0xaa, 0xa9, 0xaa, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xab, 0xab, 0xab, 0xaa, 0x00, 0x00, 0xb5, 0xa9, 0xb6, 0xf7, 0x17, 0x49, 0x59, 0x5e, 0x5f, 0x5d, 0x5d, 0x54, 0x4a, 0x44, 0x2b, 0x2b, 0x2e, 0x2e, 0x2f, 0x2f, 0x2f, 0x40, 0x33, 0x33, 0x33, 0x33, 0x2a, 0x2d, 0x2a, 0x33, 0x3b, 0x3b, 0x2f, 0x1d, 0x0f, 0x0f, 0x10, 0x10, 0x0d, 0x13, 0x0a, 0x21, 0x4d, 0x4d, 0xd5, 0xf5, 0xaa, 0xaa, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0xac, 0xb6, 0x03, 0xbc, 0xfd, 0x59, 0x60, 0x5f, 0x5e, 0x5b, 0x4f, 0x48, 0x42, 0x29, 0x2e, 0x27, 0x27, 0x2f, 0x24, 0x32, 0x2a, 0x32, 0x32, 0x2d, 0x2d, 0x38, 0x3e, 0x3e, 0x45, 0x43, 0x45, 0x3e, 0x2c, 0x2d, 0x3b, 0x2a, 0x1d, 0x15, 0x0f, 0x12, 0x10, 0x0c, 0x0d, 0x18, 0x1c, 0x47, 0x59, 0xbc, 0xab, 0xa9, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0xa8, 0xac, 0xf5, 0xf7, 0x17, 0x53, 0x59, 0x5f, 0x5f, 0x5a, 0x4f, 0x44, 0x28, 0x3a, 0x26, 0x24, 0x2f, 0x3b, 0x33, 0x37, 0x43, 0x37, 0x34, 0x43, 0x36, 0x2c, 0x38, 0x3d, 0x45, 0x31, 0x3d, 0x45, 0x3d, 0x3c, 0x31, 0x3d, 0x45, 0x2d, 0x46, 0x2d, 0x15, 0x0b, 0x0b, 0x14, 0x14, 0x07, 0x0d, 0x0e, 0x25, 0x55, 0x41, 0xb9, 0xab, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xab, 0xaa, 0xaa, 0x00, 0x02, 0xf6, 0xff, 0x3f, 0x55, 0x5f, 0x5e, 0x5d, 0x54, 0x4a, 0x2b, 0x2b, 0x2b, 0x29, 0x2e, 0x2f, 0x33, 0x34, 0x38, 0x3c, 0x3d, 0x31, 0x38, 0x36, 0x36, 0x38, 0x3e, 0x38, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x37, 0x34, 0x3b, 0x22, 0x0b, 0x12, 0x12, 0x09, 0x14, 0x13, 0x0a, 0x11, 0x3f, 0xa3, 0xbc, 0xae, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0x03, 0xcf, 0x3f, 0x5a, 0x5f, 0x5e, 0x5b, 0x4c, 0x48, 0x42, 0x29, 0x29, 0x2e, 0x2f, 0x40, 0x33, 0x32, 0x36, 0x38, 0x39, 0x3d, 0x3d, 0x39, 0x38, 0x36, 0x37, 0x38, 0x38, 0x38, 0x3e, 0x38, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x32, 0x3b, 0x22, 0x15, 0x12, 0x0f, 0x0f, 0x14, 0x19, 0x0d, 0x0a, 0x25, 0x55, 0xf8, 0xb0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf4, 0xb5, 0x00, 0x00, 0xae, 0xf6, 0x17, 0x3f, 0x5e, 0x5e, 0x5d, 0x5b, 0x4a, 0x2b, 0x2e, 0x2a, 0x2a, 0x2a, 0x2a, 0x33, 0x34, 0x34, 0x37, 0x36, 0x38, 0x35, 0x38, 0x35, 0x39, 0x35, 0x2d, 0x36, 0x2d, 0x37, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x32, 0x32, 0x2f, 0x1a, 0x12, 0x0f, 0x0f, 0x10, 0x19, 0x13, 0x0a, 0x16, 0x4d, 0x4e, 0x03, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0xa8, 0x62, 0x00, 0x00, 0x61, 0xf4, 0xf6, 0xcf, 0x3f, 0x5f, 0x5f, 0x5e, 0x50, 0x44, 0x2b, 0x29, 0x29, 0x37, 0x38, 0x3c, 0x3c, 0x3c, 0x31, 0x3c, 0x2c, 0x3d, 0x38, 0x35, 0x38, 0x35, 0x36, 0x36, 0x32, 0x36, 0x34, 0x34, 0x37, 0x34, 0x37, 0x34, 0x37, 0x2d, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x37, 0x2d, 0x32, 0x40, 0x1d, 0x0f, 0x0f, 0x0f, 0x09, 0x19, 0x20, 0x08, 0x0e, 0x3f, 0x53, 0xb9, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x61, 0x00, 0x00, 0xa8, 0xa8, 0x02, 0x02, 0x00, 0x00, 0xb7, 0xd5, 0xe4, 0x5c, 0x60, 0x59, 0x54, 0x4a, 0x2b, 0x29, 0x26, 0x40, 0x46, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x38, 0x36, 0x36, 0x32, 0x32, 0x32, 0x36, 0x2d, 0x37, 0x2d, 0x37, 0x2d, 0x37, 0x37, 0x37, 0x2d, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x3c, 0x2d, 0x2d, 0x46, 0x22, 0x09, 0x0f, 0x10, 0x0f, 0x10, 0x42, 0x11, 0x0a, 0x3f, 0x59, 0xfb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0xb5, 0xb8, 0xcf, 0x41, 0xef, 0x60, 0x60, 0x55, 0x47, 0x28, 0x1f, 0x3a, 0x2e, 0x3b, 0x2a, 0x2d, 0x3d, 0x3c, 0x3c, 0x31, 0x3c, 0x3c, 0x3d, 0x3d, 0x3c, 0x3c, 0x38, 0x38, 0x37, 0x36, 0x34, 0x37, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x3c, 0x31, 0x3c, 0x2d, 0x46, 0x24, 0x09, 0x0f, 0x0f, 0x09, 0x14, 0x3a, 0x08, 0x0a, 0x47, 0x59, 0xfc, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0xa8, 0xf5, 0xf7, 0xe0, 0xa5, 0x01, 0xf1, 0x5c, 0x59, 0x4d, 0x28, 0x28, 0x26, 0x29, 0x3b, 0x3b, 0x3d, 0x38, 0x36, 0x37, 0x36, 0x37, 0x2c, 0x38, 0x3e, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x37, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x2c, 0x46, 0x1d, 0x0b, 0x14, 0x09, 0x09, 0x20, 0x26, 0x08, 0x0a, 0x47, 0x55, 0xfb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xaa, 0x00, 0x61, 0x03, 0x17, 0x4e, 0xa5, 0xa4, 0x49, 0x9d, 0x5c, 0x5f, 0x5e, 0x5d, 0x5b, 0x51, 0x3a, 0x2e, 0x33, 0x3b, 0x36, 0x2a, 0x2a, 0x32, 0x2d, 0x37, 0x38, 0x3c, 0x3e, 0x3c, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x45, 0x2c, 0x43, 0x22, 0x09, 0x15, 0x10, 0x0c, 0x42, 0x20, 0x08, 0x16, 0x30, 0x53, 0xb2, 
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x61, 0xf9, 0x61, 0x61, 0x61, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xab, 0xab, 0xaa, 0xab, 0xaa, 0xb5, 0xa9, 0x02, 0xb5, 0x62, 0x02, 0xa8, 0xab, 0xab, 0xab, 0xaa, 0xb5, 0xf9, 0xa8, 0xf9, 0xb5, 0xf9, 0x02, 0xf4, 0xae, 0xac, 0xab, 0xaa, 0xab, 0xab, 0xab, 0xaa, 0xaa, 0x00, 0xf9, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00, 0xa8, 0xab, 0xaa, 0xaa, 0xa6, 0x00, 0xa6, 0xfe, 0xff, 0xe4, 0xa5, 0xa5, 0x9f, 0x94, 0x82, 0x73, 0x8e, 0x95, 0x9b, 0x5d, 0x5e, 0x5b, 0x5d, 0x51, 0x2b, 0x3a, 0x27, 0x2f, 0x2a, 0x46, 0x2d, 0x31, 0x45, 0x31, 0x45, 0x3c, 0x38, 0x37, 0x37, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x36, 0x38, 0x38, 0x3d, 0x3c, 0x3d, 0x3c, 0x38, 0x38, 0x37, 0x36, 0x34, 0x36, 0x34, 0x37, 0x38, 0x2d, 0x43, 0x46, 0x1a, 0x0b, 0x19, 0x06, 0x1f, 0x44, 0x18, 0x0a, 0x18, 0x4d, 0x4e, 0xb8, 
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0xab, 0xa9, 0xa9, 0xb5, 0xa9, 0xb7, 0xb2, 0xb9, 0xf7, 0xf7, 0xb3, 0xb3, 0xb3, 0xb3, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x05, 0xf7, 0xf7, 0xb9, 0x03, 0xb0, 0xfa, 0xac, 0xa9, 0xab, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0x00, 0x00, 0x02, 0xaa, 0xa6, 0x00, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa6, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x61, 0x00, 0xaa, 0xaa, 0xab, 0xaa, 0xab, 0xad, 0xb9, 0xe0, 0xa4, 0xa4, 0xa3, 0x98, 0x8c, 0x64, 0x6b, 0x8a, 0x6e, 0x74, 0x74, 0x89, 0x98, 0x4d, 0x5e, 0x5d, 0x5b, 0x56, 0x20, 0x2e, 0x2a, 0x43, 0x2d, 0x3c, 0x45, 0x31, 0x3c, 0x3c, 0x37, 0x36, 0x34, 0x37, 0x38, 0x3c, 0x3c, 0x36, 0x32, 0x36, 0x38, 0x3d, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x2d, 0x34, 0x2d, 0x34, 0x2d, 0x36, 0x34, 0x34, 0x3b, 0x2a, 0x1a, 0x0b, 0x0f, 0x0d, 0x50, 0x21, 0x0a, 0x08, 0x21, 0x4d, 0xe2, 0xb1, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x61, 0x00, 0xf9, 0x00, 0x00, 0xf9, 0x02, 0xf4, 0xf5, 0x04, 0xff, 0x17, 0x17, 0x23, 0x41, 0xa0, 0x53, 0x53, 0x53, 0x53, 0xa3, 0x5c, 0x59, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x53, 0x55, 0x59, 0x53, 0x4e, 0xe0, 0x17, 0xcf, 0xb3, 0xb2, 0xf6, 0xb6, 0xae, 0xab, 0x00, 0xaa, 0xab, 0xaa, 0x00, 0x00, 0xaa, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xa6, 0xaa, 0xb5, 0x00, 0xf6, 0xd5, 0x9e, 0xa4, 0x60, 0x9f, 0x8e, 0x67, 0x68, 0x68, 0x81, 0x7d, 0x70, 0x70, 0x81, 0x78, 0x6a, 0x88, 0x95, 0x54, 0x5d, 0x58, 0x56, 0x3a, 0x27, 0x2a, 0x33, 0x3c, 0x45, 0x31, 0x45, 0x38, 0x38, 0x34, 0x36, 0x37, 0x37, 0x3c, 0x38, 0x36, 0x36, 0x38, 0x38, 0x38, 0x3c, 0x3e, 0x3c, 0x38, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x37, 0x43, 0x2d, 0x24, 0x0b, 0x14, 0x06, 0x2b, 0x51, 0x0d, 0x08, 0x11, 0x30, 0x59, 0xd5, 0xb0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xf4, 0xfe, 0x05, 0x21, 0x47, 0x5a, 0x5e, 0x5e, 0x5a, 0x5e, 0x5e, 0x5f, 0x5e, 0x5e, 0x5a, 0x5a, 0x5a, 0x57, 0x57, 0x54, 0x4f, 0x4f, 0x4f, 0x47, 0x4a, 0x30, 0x30, 0x30, 0x47, 0x47, 0xa2, 0xa3, 0x5c, 0x55, 0x4d, 0x23, 0xcf, 0xb3, 0x03, 0xaf, 0xa9, 0xaa, 0xab, 0xac, 0xaa, 0x00, 0x00, 0x61, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xa6, 0xa6, 0x00, 0xa9, 0xf7, 0x23, 0x59, 0x60, 0xa2, 0x93, 0x6d, 0x72, 0x68, 0x84, 0x87, 0x6c, 0x69, 0x85, 0x85, 0x7b, 0x7b, 0x76, 0x68, 0x66, 0x8b, 0x1f, 0x58, 0x5b, 0x52, 0x40, 0x27, 0x33, 0x37, 0x3c, 0x31, 0x45, 0x3c, 0x38, 0x36, 0x36, 0x36, 0x37, 0x38, 0x3c, 0x36, 0x37, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x34, 0x1d, 0x09, 0x07, 0x18, 0x56, 0x18, 0x0d, 0x08, 0x1c, 0x47, 0xa7, 0xba, 0xa9, 
-  0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xb5, 0xaa, 0x00, 0xfa, 0xb3, 0x47, 0x57, 0x5e, 0x5e, 0x5b, 0x5b, 0x5b, 0x58, 0x56, 0x51, 0x51, 0x4c, 0x44, 0x48, 0x44, 0x48, 0x42, 0x3a, 0x42, 0x42, 0x3a, 0x3a, 0x3a, 0x2b, 0x42, 0x2b, 0x2b, 0x1c, 0x1f, 0x1c, 0x1f, 0x28, 0x30, 0x4d, 0x5a, 0x5a, 0x53, 0x41, 0xd5, 0xf7, 0xb0, 0xac, 0xaa, 0x00, 0xf9, 0x61, 0x61, 0x61, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xaa, 0x00, 0xa8, 0xa8, 0xa6, 0xfa, 0xfb, 0x53, 0x5c, 0x5c, 0x9b, 0x89, 0x72, 0x78, 0x69, 0x84, 0x6f, 0x6f, 0x79, 0x7c, 0x6f, 0x69, 0x69, 0x6f, 0x83, 0x84, 0x70, 0x6a, 0x82, 0x95, 0x58, 0x58, 0x52, 0x2e, 0x2f, 0x34, 0x38, 0x3c, 0x3d, 0x38, 0x38, 0x36, 0x36, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3e, 0x3c, 0x2d, 0x43, 0x09, 0x13, 0x08, 0x50, 0x4a, 0x0c, 0x13, 0x0d, 0x21, 0x53, 0xe0, 0xb0, 0xa9, 
-  0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0x00, 0xfa, 0xbf, 0xa0, 0x5e, 0x5d, 0x57, 0x51, 0x44, 0x2b, 0x2b, 0x20, 0x29, 0x26, 0x24, 0x26, 0x24, 0x26, 0x24, 0x24, 0x27, 0x2a, 0x2a, 0x2a, 0x2f, 0x2f, 0x2f, 0x2f, 0x27, 0x27, 0x29, 0x27, 0x20, 0x20, 0x14, 0x13, 0x0d, 0x1c, 0x1f, 0x25, 0x47, 0x55, 0xa4, 0xa7, 0xe0, 0xbf, 0xb7, 0xb5, 0xb5, 0xf9, 0xf9, 0x61, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xb5, 0x00, 0x00, 0xa6, 0xb2, 0x97, 0xa3, 0x60, 0xa3, 0x94, 0x73, 0x6a, 0x86, 0x7e, 0x84, 0x6c, 0x6f, 0x6c, 0x83, 0x7f, 0x6f, 0x6f, 0x85, 0x83, 0x69, 0x69, 0x85, 0x8a, 0x6a, 0x73, 0x95, 0x5b, 0x56, 0x3a, 0x2f, 0x33, 0x2d, 0x3c, 0x3c, 0x3c, 0x38, 0x36, 0x36, 0x36, 0x36, 0x38, 0x39, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x3e, 0x3c, 0x3c, 0x3d, 0x3c, 0x3c, 0x3c, 0x43, 0x22, 0x06, 0x0d, 0x28, 0x57, 0x1c, 0x07, 0x13, 0x1c, 0x30, 0xef, 0xbc, 0xa9, 0xab, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0xf5, 0xff, 0xa0, 0x5f, 0x57, 0x51, 0x2b, 0x20, 0x26, 0x29, 0x2e, 0x46, 0x40, 0x32, 0x33, 0x43, 0x46, 0x43, 0x33, 0x43, 0x38, 0x3e, 0x37, 0x3e, 0x3c, 0x38, 0x38, 0x2d, 0x43, 0x43, 0x32, 0x2f, 0x3b, 0x2f, 0x2f, 0x2e, 0x19, 0x13, 0x0d, 0x0d, 0x11, 0x21, 0x30, 0x47, 0xa0, 0x53, 0x49, 0xfc, 0xb7, 0xf9, 0x61, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xb5, 0x02, 0xad, 0x04, 0xfd, 0x60, 0x5c, 0x9d, 0x8b, 0x66, 0x80, 0x81, 0x69, 0x6c, 0x7f, 0x85, 0x7d, 0x71, 0x6c, 0x6c, 0x7f, 0x77, 0x6f, 0x6f, 0x77, 0x85, 0x6c, 0x68, 0x78, 0x72, 0x90, 0x5d, 0x58, 0x3a, 0x2e, 0x33, 0x2d, 0x45, 0x31, 0x38, 0x39, 0x36, 0x36, 0x36, 0x35, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x36, 0x37, 0x36, 0x38, 0x38, 0x3c, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x2d, 0x43, 0x09, 0x14, 0x1c, 0x5b, 0x28, 0x08, 0x0d, 0x18, 0x28, 0x4d, 0x41, 0xb0, 0xab, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0xa0, 0x5f, 0x54, 0x2b, 0x26, 0x29, 0x3a, 0x46, 0x2f, 0x2a, 0x2a, 0x2c, 0x2d, 0x38, 0x3e, 0x45, 0x31, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3e, 0x3c, 0x38, 0x3c, 0x3e, 0x2d, 0x2c, 0x2d, 0x34, 0x43, 0x3b, 0x3b, 0x40, 0x26, 0x19, 0x14, 0x13, 0x07, 0x11, 0x1c, 0x25, 0x47, 0x4d, 0x59, 0xe0, 0xfb, 0xf5, 0xb5, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0xf5, 0xd5, 0xa0, 0x60, 0x9f, 0x96, 0x6a, 0x80, 0x78, 0x7e, 0x85, 0x85, 0x7a, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x7a, 0x7c, 0x7f, 0x7a, 0x7d, 0x70, 0x81, 0x78, 0x72, 0x90, 0x5d, 0x58, 0x3a, 0x2e, 0x2a, 0x34, 0x45, 0x2c, 0x3c, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x3c, 0x3c, 0x3c, 0x37, 0x37, 0x2d, 0x36, 0x37, 0x38, 0x39, 0x3c, 0x3d, 0x3c, 0x3c, 0x3c, 0x38, 0x33, 0x1d, 0x0f, 0x13, 0x50, 0x57, 0x11, 0x08, 0x11, 0x21, 0x47, 0xa7, 0xfb, 0xb0, 0xb5, 0xb5, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x62, 0xfa, 0x30, 0x5e, 0x4f, 0x44, 0x26, 0x33, 0x33, 0x33, 0x34, 0x38, 0x38, 0x39, 0x3d, 0x3d, 0x3d, 0x3e, 0x2d, 0x37, 0x2d, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x37, 0x2d, 0x37, 0x37, 0x2d, 0x34, 0x34, 0x34, 0x32, 0x3b, 0x2a, 0x46, 0x40, 0x27, 0x19, 0x0f, 0x09, 0x0c, 0x0d, 0x18, 0x25, 0x47, 0x55, 0x4e, 0x17, 0xb2, 0xa8, 0xa8, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0xf9, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x61, 0x00, 0xb7, 0x17, 0x5c, 0x60, 0x9d, 0x90, 0x66, 0x80, 0x76, 0x7b, 0x7a, 0x7a, 0x75, 0x7f, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x71, 0x71, 0x7a, 0x7c, 0x71, 0x71, 0x7d, 0x7e, 0x78, 0x80, 0x72, 0x9d, 0x5d, 0x51, 0x2b, 0x27, 0x2a, 0x37, 0x3e, 0x3c, 0x39, 0x38, 0x36, 0x36, 0x36, 0x35, 0x36, 0x3c, 0x3c, 0x3c, 0x3c, 0x37, 0x37, 0x34, 0x36, 0x36, 0x3e, 0x3e, 0x3d, 0x45, 0x45, 0x3c, 0x2d, 0x37, 0x1d, 0x0f, 0x0c, 0x51, 0x5b, 0x1f, 0x08, 0x0a, 0x1c, 0x25, 0x53, 0xda, 0xb6, 0xa9, 0xf4, 0xf9, 
-  0xaa, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x05, 0x55, 0x5d, 0x4a, 0x26, 0x2f, 0x43, 0x43, 0x45, 0x37, 0x31, 0x38, 0x3d, 0x3d, 0x39, 0x38, 0x2c, 0x38, 0x2c, 0x37, 0x34, 0x34, 0x33, 0x32, 0x33, 0x34, 0x33, 0x34, 0x34, 0x37, 0x34, 0x37, 0x37, 0x2d, 0x37, 0x37, 0x2d, 0x2d, 0x33, 0x43, 0x43, 0x33, 0x2a, 0x1a, 0x09, 0x09, 0x0d, 0x0d, 0x16, 0x25, 0xa0, 0x4e, 0x41, 0xfb, 0xad, 0x00, 0xa8, 0xaa, 0x00, 0xac, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xad, 0x61, 0xb2, 0x23, 0x5c, 0xa3, 0x99, 0x8c, 0x6b, 0x86, 0x76, 0x7b, 0x7a, 0x75, 0x7f, 0x77, 0x7f, 0x7c, 0x7c, 0x7d, 0x7a, 0x71, 0x71, 0x7a, 0x79, 0x7c, 0x85, 0x7c, 0x70, 0x81, 0x78, 0x64, 0x98, 0x5a, 0x58, 0x48, 0x2e, 0x27, 0x3b, 0x37, 0x38, 0x3c, 0x38, 0x38, 0x36, 0x36, 0x36, 0x36, 0x38, 0x39, 0x3c, 0x3c, 0x3c, 0x37, 0x37, 0x34, 0x36, 0x37, 0x3e, 0x31, 0x3c, 0x45, 0x2c, 0x2d, 0x2d, 0x40, 0x19, 0x09, 0x44, 0x5d, 0x44, 0x08, 0x08, 0x18, 0x25, 0xa4, 0xe5, 0xb2, 0xb6, 0x00, 0x00, 0x00, 
-  0x00, 0xaa, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf9, 0x61, 0x02, 0x1b, 0x5e, 0x57, 0x28, 0x2b, 0x27, 0x33, 0x22, 0x2a, 0x2a, 0x34, 0x36, 0x37, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x32, 0x33, 0x33, 0x34, 0x33, 0x34, 0x2d, 0x37, 0x37, 0x37, 0x38, 0x38, 0x3e, 0x38, 0x38, 0x3e, 0x37, 0x38, 0x2d, 0x3e, 0x45, 0x43, 0x31, 0x1a, 0x15, 0x12, 0x0c, 0x08, 0x0e, 0x1b, 0x3f, 0x53, 0x47, 0xff, 0xf6, 0x00, 0xaa, 0xa9, 0x00, 0xaa, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x62, 0x61, 0x62, 0xfb, 0x4d, 0x5c, 0x5c, 0x96, 0x6a, 0x67, 0x86, 0x69, 0x7b, 0x7a, 0x7a, 0x7c, 0x75, 0x7c, 0x77, 0x77, 0x77, 0x75, 0x75, 0x75, 0x71, 0x75, 0x79, 0x6f, 0x6f, 0x84, 0x70, 0x78, 0x74, 0x95, 0x57, 0x5d, 0x4c, 0x3a, 0x29, 0x2f, 0x34, 0x38, 0x2c, 0x3d, 0x38, 0x38, 0x32, 0x36, 0x36, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x34, 0x32, 0x36, 0x36, 0x45, 0x31, 0x45, 0x31, 0x2a, 0x33, 0x40, 0x1d, 0x09, 0x1f, 0x5b, 0x54, 0x11, 0x08, 0x11, 0x1c, 0xfd, 0xed, 0xb3, 0xaf, 0x00, 0x02, 0x61, 0x02, 
-  0xaa, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x23, 0x5e, 0x54, 0x28, 0x2b, 0x3a, 0x27, 0x29, 0x27, 0x2f, 0x2f, 0x2f, 0x2a, 0x3b, 0x32, 0x34, 0x37, 0x3e, 0x3e, 0x45, 0x38, 0x37, 0x34, 0x34, 0x2d, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x45, 0x3e, 0x3c, 0x31, 0x31, 0x3c, 0x45, 0x45, 0x1d, 0x12, 0x09, 0x13, 0x0d, 0x0a, 0x16, 0x30, 0x4d, 0x5e, 0x0e, 0xf6, 0x62, 0xaa, 0xab, 0xaa, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x02, 0xf4, 0xa6, 0xfe, 0xfc, 0xa2, 0x60, 0xa2, 0x90, 0x66, 0x68, 0x84, 0x79, 0x79, 0x75, 0x7a, 0x7a, 0x7a, 0x7c, 0x75, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x77, 0x75, 0x6f, 0x77, 0x6f, 0x6f, 0x7b, 0x7e, 0x66, 0x95, 0x5d, 0x5d, 0x51, 0x3a, 0x2e, 0x27, 0x32, 0x34, 0x3e, 0x31, 0x3d, 0x38, 0x36, 0x36, 0x32, 0x36, 0x38, 0x3d, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x34, 0x34, 0x36, 0x38, 0x31, 0x45, 0x3d, 0x2d, 0x34, 0x40, 0x1d, 0x0c, 0x18, 0x58, 0x5b, 0x21, 0x08, 0x11, 0x16, 0x47, 0x59, 0xdc, 0xb0, 0xa9, 0xaa, 0x61, 0xf9, 0x00, 
-  0xa6, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0xab, 0x61, 0x41, 0x5f, 0x4f, 0x28, 0x44, 0x4a, 0x50, 0x50, 0x50, 0x48, 0x3a, 0x2b, 0x2e, 0x27, 0x27, 0x2a, 0x33, 0x3e, 0x45, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x2c, 0x3e, 0x3d, 0x3c, 0x31, 0x31, 0x3c, 0x3e, 0x43, 0x22, 0x12, 0x0f, 0x13, 0x0d, 0x11, 0x11, 0x44, 0x47, 0x59, 0x1b, 0xfe, 0xa9, 0xaa, 0xab, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xa6, 0xb7, 0x97, 0x60, 0x5c, 0x9d, 0x8b, 0x66, 0x80, 0x7e, 0x79, 0x83, 0x6f, 0x75, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0x77, 0x77, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x77, 0x6c, 0x79, 0x87, 0x68, 0x74, 0x92, 0x5d, 0x58, 0x51, 0x3a, 0x29, 0x2a, 0x2a, 0x34, 0x3c, 0x3c, 0x3d, 0x3d, 0x38, 0x36, 0x32, 0x34, 0x37, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x37, 0x36, 0x32, 0x32, 0x36, 0x2c, 0x2c, 0x45, 0x31, 0x2d, 0x46, 0x24, 0x09, 0x18, 0x51, 0x5e, 0x30, 0x0a, 0x0e, 0x0e, 0x21, 0x59, 0xe2, 0xb0, 0xaf, 0xab, 0xf9, 0x00, 0x62, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0xab, 0xab, 0xa9, 0xfd, 0x60, 0x5e, 0x57, 0x5b, 0x5e, 0x57, 0x57, 0x5b, 0x5d, 0x5b, 0x56, 0x50, 0x3a, 0x2e, 0x27, 0x2a, 0x2a, 0x38, 0x31, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3e, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x31, 0x3d, 0x3e, 0x3e, 0x2d, 0x43, 0x46, 0x24, 0x15, 0x09, 0x09, 0x10, 0x0c, 0x11, 0x21, 0x47, 0x59, 0xb4, 0xb6, 0xa9, 0xaa, 0xaa, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf6, 0x9c, 0x01, 0x5c, 0x99, 0x88, 0x80, 0x6b, 0x76, 0x87, 0x79, 0x69, 0x85, 0x77, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x79, 0x6f, 0x77, 0x77, 0x77, 0x7f, 0x75, 0x7a, 0x70, 0x76, 0x67, 0x92, 0x5d, 0x5b, 0x58, 0x26, 0x3a, 0x2f, 0x32, 0x34, 0x31, 0x39, 0x31, 0x3d, 0x3d, 0x36, 0x36, 0x32, 0x34, 0x37, 0x38, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x2d, 0x32, 0x36, 0x36, 0x39, 0x3c, 0x3c, 0x2c, 0x43, 0x2f, 0x10, 0x0d, 0x51, 0x5e, 0x54, 0x11, 0x08, 0x0e, 0x30, 0x53, 0x9e, 0xb9, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x00, 0xb5, 
-  0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0xaa, 0xab, 0xab, 0xa9, 0xfd, 0x01, 0x60, 0x5a, 0x5a, 0xa1, 0x9b, 0x9a, 0x9b, 0xa1, 0x57, 0x5d, 0x5b, 0x51, 0x4c, 0x42, 0x2e, 0x27, 0x2a, 0x32, 0x2d, 0x38, 0x3d, 0x3e, 0x39, 0x38, 0x38, 0x36, 0x36, 0x32, 0x34, 0x32, 0x32, 0x32, 0x32, 0x32, 0x36, 0x43, 0x3e, 0x37, 0x2c, 0x2d, 0x36, 0x36, 0x2d, 0x22, 0x32, 0x46, 0x22, 0x15, 0x0b, 0x15, 0x14, 0x0c, 0x11, 0x21, 0x49, 0xa7, 0xda, 0xaf, 0xac, 0xaa, 0x61, 0xf9, 0x61, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x00, 0x04, 0x49, 0x5c, 0xa3, 0x97, 0x89, 0x6b, 0x76, 0x87, 0x7b, 0x69, 0x7f, 0x85, 0x75, 0x7a, 0x75, 0x75, 0x7a, 0x79, 0x7a, 0x79, 0x7b, 0x7b, 0x71, 0x7c, 0x7c, 0x7f, 0x7c, 0x7d, 0x6e, 0x74, 0x8e, 0x57, 0x5d, 0x58, 0x48, 0x26, 0x2f, 0x2a, 0x37, 0x38, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x36, 0x36, 0x32, 0x34, 0x37, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x36, 0x36, 0x32, 0x32, 0x36, 0x39, 0x45, 0x31, 0x3c, 0x3b, 0x1a, 0x0c, 0x2b, 0x5d, 0x57, 0x1c, 0x08, 0x0a, 0x21, 0x53, 0xe9, 0xbc, 0xb7, 0xf4, 0xfa, 0xf9, 0xf4, 0x00, 0xaa, 0xaa, 
-  0x00, 0x00, 0x00, 0x61, 0xf9, 0x00, 0x00, 0xaa, 0xab, 0xab, 0xb0, 0xe2, 0xa5, 0x9c, 0x0e, 0x8b, 0x8b, 0x73, 0x73, 0x73, 0x82, 0x8e, 0x9a, 0xa1, 0x5e, 0x58, 0x51, 0x3a, 0x2e, 0x27, 0x2f, 0x32, 0x35, 0x3c, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x32, 0x32, 0x3b, 0x32, 0x32, 0x32, 0x36, 0x2c, 0x38, 0x43, 0x43, 0x36, 0x2d, 0x32, 0x2a, 0x43, 0x2a, 0x32, 0x3b, 0x2a, 0x15, 0x0b, 0x0b, 0x10, 0x08, 0x0a, 0x25, 0x4d, 0xe9, 0xd5, 0xab, 0xab, 0xaa, 0xaa, 0xf9, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x9c, 0x5c, 0xa3, 0x97, 0x6d, 0x6a, 0x81, 0x79, 0x6c, 0x71, 0x7c, 0x7a, 0x7a, 0x7a, 0x7f, 0x75, 0x75, 0x75, 0x7c, 0x79, 0x7b, 0x7b, 0x76, 0x79, 0x7a, 0x7a, 0x7c, 0x7d, 0x70, 0x74, 0x8e, 0x5b, 0x5b, 0x54, 0x42, 0x26, 0x24, 0x32, 0x32, 0x31, 0x3d, 0x31, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x36, 0x37, 0x34, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x32, 0x36, 0x32, 0x38, 0x38, 0x3e, 0x2c, 0x43, 0x1d, 0x06, 0x19, 0x56, 0x5d, 0x47, 0x05, 0x11, 0x30, 0x3f, 0xa0, 0xd8, 0xb0, 0xa9, 0x02, 0x61, 0xf4, 0x00, 0x00, 0xab, 0x00, 
-  0x00, 0x00, 0x61, 0x61, 0xf9, 0x61, 0x00, 0x00, 0xab, 0xab, 0xb0, 0xf8, 0x01, 0x97, 0x6a, 0x6a, 0x78, 0x76, 0x76, 0x80, 0x78, 0x6b, 0x72, 0x82, 0x9b, 0x5d, 0x5b, 0x58, 0x3a, 0x29, 0x40, 0x2a, 0x45, 0x31, 0x2c, 0x43, 0x36, 0x2d, 0x39, 0x38, 0x38, 0x33, 0x32, 0x2f, 0x32, 0x34, 0x3d, 0x3d, 0x3c, 0x38, 0x38, 0x38, 0x37, 0x36, 0x36, 0x36, 0x34, 0x32, 0x32, 0x34, 0x32, 0x2c, 0x1a, 0x0b, 0x09, 0x0c, 0x07, 0x18, 0x25, 0x4d, 0xa4, 0xbc, 0xa9, 0xa9, 0xab, 0xab, 0xae, 0x00, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa6, 0x00, 0xa8, 0x00, 0x00, 0xf4, 0xf9, 0xf9, 0x03, 0x3f, 0x60, 0x9f, 0x93, 0x74, 0x64, 0x8a, 0x71, 0x75, 0x75, 0x7f, 0x7a, 0x75, 0x71, 0x7f, 0x7a, 0x7c, 0x7c, 0x7a, 0x71, 0x7a, 0x71, 0x6c, 0x79, 0x84, 0x69, 0x84, 0x85, 0x6e, 0x81, 0x8b, 0xa1, 0x5b, 0x5b, 0x42, 0x29, 0x2a, 0x32, 0x35, 0x38, 0x3e, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2c, 0x36, 0x3e, 0x35, 0x2d, 0x2c, 0x36, 0x43, 0x43, 0x2a, 0x22, 0x12, 0x0b, 0x13, 0x19, 0x1f, 0x08, 0x0e, 0x1b, 0x3f, 0x5c, 0x17, 0xaf, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xaa, 0x00, 0x00, 0xf9, 0x61, 0x61, 0x00, 0xa6, 0xaa, 0xab, 0xa9, 0xda, 0x60, 0x9b, 0x82, 0x72, 0x79, 0x6f, 0x7b, 0x7b, 0x7b, 0x6e, 0x76, 0x80, 0x8a, 0x8e, 0x5b, 0x5b, 0x56, 0x3a, 0x29, 0x40, 0x35, 0x3c, 0x38, 0x36, 0x32, 0x35, 0x3e, 0x31, 0x3e, 0x37, 0x33, 0x33, 0x32, 0x37, 0x3d, 0x3d, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x36, 0x37, 0x32, 0x2d, 0x34, 0x43, 0x2a, 0x22, 0x15, 0x0b, 0x14, 0x10, 0x13, 0x08, 0x21, 0x55, 0xe4, 0xf7, 0xab, 0xab, 0xab, 0xaa, 0x61, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x61, 0xaa, 0x61, 0x61, 0x61, 0x04, 0x49, 0x60, 0xa2, 0x91, 0x74, 0x78, 0x76, 0x7b, 0x7a, 0x75, 0x75, 0x75, 0x7a, 0x71, 0x6c, 0x7a, 0x71, 0x75, 0x7a, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x69, 0x84, 0x69, 0x76, 0x78, 0x8b, 0x50, 0x5b, 0x58, 0x4c, 0x2e, 0x2f, 0x3b, 0x35, 0x39, 0x39, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x36, 0x34, 0x36, 0x43, 0x2c, 0x2c, 0x3e, 0x43, 0x36, 0x2d, 0x2a, 0x3b, 0x24, 0x1a, 0x0f, 0x09, 0x09, 0x10, 0x0d, 0x0e, 0x17, 0x25, 0x5c, 0x1e, 0xf7, 0xfe, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xaa, 0x00, 0x61, 0x00, 0xf9, 0x61, 0x00, 0x00, 0xab, 0xaa, 0xab, 0xfc, 0x01, 0x9f, 0x8c, 0x6e, 0x7b, 0x75, 0x71, 0x7a, 0x7e, 0x71, 0x76, 0x76, 0x66, 0x88, 0x90, 0x58, 0x58, 0x56, 0x3a, 0x2e, 0x34, 0x2c, 0x37, 0x34, 0x2c, 0x36, 0x45, 0x2c, 0x38, 0x36, 0x33, 0x32, 0x33, 0x38, 0x3c, 0x3d, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x36, 0x2d, 0x36, 0x34, 0x34, 0x32, 0x43, 0x22, 0x22, 0x12, 0x0f, 0x14, 0x0c, 0x07, 0x11, 0x47, 0xa0, 0xe2, 0xb1, 0xae, 0xab, 0xaa, 0xf9, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xa8, 0x61, 0x61, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x9c, 0x60, 0x9d, 0x90, 0x67, 0x67, 0x7e, 0x7e, 0x69, 0x7c, 0x7c, 0x7a, 0x85, 0x7f, 0x7f, 0x7f, 0x85, 0x7c, 0x7a, 0x75, 0x71, 0x75, 0x6c, 0x6c, 0x6c, 0x75, 0x6c, 0x70, 0x87, 0x67, 0x88, 0x9d, 0x5e, 0x5b, 0x4a, 0x26, 0x29, 0x2f, 0x37, 0x3d, 0x39, 0x38, 0x37, 0x37, 0x38, 0x37, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x37, 0x36, 0x43, 0x2c, 0x2c, 0x36, 0x45, 0x36, 0x2d, 0x34, 0x22, 0x1a, 0x0b, 0x09, 0x14, 0x0c, 0x0c, 0x08, 0x16, 0x25, 0x59, 0x49, 0xf7, 0xfa, 0xae, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xaa, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0xaa, 0xab, 0xb5, 0xfb, 0xa4, 0xa3, 0x90, 0x6a, 0x7d, 0x7a, 0x7a, 0x7d, 0x7d, 0x7b, 0x7b, 0x76, 0x7e, 0x86, 0x6a, 0x90, 0x58, 0x5b, 0x56, 0x29, 0x27, 0x2d, 0x33, 0x37, 0x2d, 0x38, 0x3e, 0x2c, 0x38, 0x36, 0x36, 0x34, 0x37, 0x37, 0x3c, 0x3c, 0x3e, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x36, 0x2d, 0x36, 0x34, 0x2d, 0x32, 0x34, 0x34, 0x32, 0x1a, 0x09, 0x0b, 0x10, 0x13, 0x18, 0x16, 0x30, 0xa3, 0xf8, 0xb6, 0xab, 0xac, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x61, 0xaa, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xaa, 0x00, 0xb5, 0xaa, 0x00, 0xb9, 0x49, 0x01, 0xa2, 0x91, 0x73, 0x80, 0x87, 0x87, 0x79, 0x79, 0x7b, 0x7d, 0x70, 0x71, 0x70, 0x6c, 0x6c, 0x69, 0x75, 0x6c, 0x75, 0x6f, 0x75, 0x77, 0x77, 0x77, 0x85, 0x69, 0x81, 0x80, 0x82, 0x9b, 0x5d, 0x57, 0x44, 0x2b, 0x29, 0x40, 0x32, 0x2d, 0x3c, 0x3c, 0x37, 0x2d, 0x34, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2c, 0x36, 0x36, 0x38, 0x2c, 0x36, 0x36, 0x43, 0x1a, 0x0b, 0x0b, 0x10, 0x14, 0x0d, 0x0d, 0x11, 0x25, 0x49, 0x53, 0xfb, 0xfe, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xaa, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0xaa, 0xab, 0xac, 0xb2, 0x9e, 0x5c, 0x97, 0x66, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7a, 0x71, 0x79, 0x68, 0x76, 0x6b, 0x95, 0x5b, 0x5b, 0x51, 0x24, 0x2f, 0x3b, 0x34, 0x2c, 0x2c, 0x45, 0x2c, 0x35, 0x38, 0x36, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x36, 0x36, 0x36, 0x32, 0x2d, 0x34, 0x36, 0x46, 0x22, 0x15, 0x12, 0x0b, 0x10, 0x0c, 0x08, 0x21, 0x47, 0x53, 0xff, 0xf4, 0x02, 0x00, 0x61, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x61, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0xaa, 0xaa, 0xa8, 0xae, 0xf7, 0xe4, 0x01, 0x9f, 0x8d, 0x6d, 0x73, 0x72, 0x68, 0x68, 0x7b, 0x7b, 0x7e, 0x76, 0x76, 0x7e, 0x7e, 0x85, 0x84, 0x84, 0x6f, 0x79, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x85, 0x7d, 0x6a, 0x82, 0x9a, 0x5e, 0x57, 0x4a, 0x2b, 0x20, 0x2f, 0x46, 0x2d, 0x2c, 0x3e, 0x3c, 0x34, 0x32, 0x34, 0x32, 0x32, 0x34, 0x2d, 0x36, 0x36, 0x37, 0x38, 0x38, 0x3e, 0x3c, 0x3c, 0x38, 0x2c, 0x43, 0x43, 0x2c, 0x37, 0x43, 0x37, 0x22, 0x15, 0x0b, 0x09, 0x10, 0x0d, 0x07, 0x11, 0x1c, 0x49, 0x59, 0xff, 0xfe, 0x61, 0xb5, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xb6, 0x1e, 0x60, 0x9f, 0x73, 0x70, 0x7d, 0x7f, 0x7d, 0x7f, 0x7f, 0x7d, 0x71, 0x6c, 0x69, 0x6f, 0x86, 0x67, 0x9b, 0x5d, 0x58, 0x42, 0x2e, 0x3b, 0x3b, 0x38, 0x2c, 0x38, 0x35, 0x36, 0x35, 0x39, 0x38, 0x3c, 0x38, 0x2d, 0x34, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x36, 0x2d, 0x36, 0x34, 0x2d, 0x2d, 0x32, 0x34, 0x34, 0x46, 0x1d, 0x15, 0x0b, 0x09, 0x10, 0x07, 0x18, 0x21, 0x4d, 0xa0, 0x04, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x61, 0xa8, 0xa8, 0xaa, 0x61, 0xaa, 0xa8, 0x61, 0xaa, 0x61, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0xaa, 0xae, 0xaf, 0xb9, 0xe4, 0xa5, 0xa0, 0xd5, 0x6d, 0x6d, 0x73, 0x82, 0x74, 0x80, 0x86, 0x80, 0x6e, 0x74, 0x6b, 0x6b, 0x6b, 0x6b, 0x68, 0x68, 0x76, 0x7e, 0x7b, 0x7b, 0x79, 0x84, 0x84, 0x84, 0x70, 0x80, 0x74, 0x9a, 0x5d, 0x5b, 0x4a, 0x3a, 0x29, 0x2a, 0x32, 0x35, 0x35, 0x3e, 0x45, 0x2d, 0x37, 0x34, 0x32, 0x34, 0x32, 0x36, 0x32, 0x34, 0x36, 0x36, 0x37, 0x38, 0x3c, 0x3e, 0x3c, 0x3c, 0x37, 0x43, 0x37, 0x2d, 0x43, 0x43, 0x22, 0x0b, 0x0b, 0x12, 0x10, 0x10, 0x08, 0x0a, 0x1c, 0x30, 0x59, 0x1e, 0xf6, 0xf4, 0x00, 0x61, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xad, 0xbc, 0xa4, 0xa3, 0x90, 0x78, 0x7d, 0x7f, 0x7f, 0x7f, 0x7c, 0x7f, 0x7a, 0x83, 0x6f, 0x84, 0x69, 0x78, 0x88, 0xa1, 0x5d, 0x51, 0x42, 0x27, 0x33, 0x37, 0x31, 0x38, 0x36, 0x35, 0x38, 0x39, 0x3d, 0x3c, 0x3e, 0x33, 0x33, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x37, 0x36, 0x37, 0x36, 0x2d, 0x2d, 0x36, 0x34, 0x34, 0x34, 0x2d, 0x1a, 0x15, 0x12, 0x14, 0x10, 0x08, 0x11, 0x30, 0x5a, 0x23, 0xf6, 0xb5, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x61, 0xaa, 0x61, 0xa8, 0x61, 0xa8, 0xa8, 0x02, 0xf5, 0xf6, 0x03, 0x03, 0xf6, 0xb8, 0x03, 0xfe, 0x02, 0x00, 0x62, 0xa8, 0x61, 0x61, 0xad, 0xfb, 0xe0, 0xe2, 0x4e, 0x01, 0xa5, 0xa7, 0x9e, 0xa3, 0xa0, 0x9f, 0xa2, 0xa2, 0xa1, 0x9d, 0x9b, 0x9a, 0x98, 0x95, 0x94, 0x92, 0x91, 0x8e, 0x8c, 0x74, 0x74, 0x6a, 0x72, 0x6b, 0x6b, 0x6e, 0x6b, 0x72, 0x6a, 0x9a, 0x5d, 0x5d, 0x56, 0x26, 0x2e, 0x3b, 0x43, 0x35, 0x39, 0x39, 0x45, 0x2d, 0x37, 0x37, 0x38, 0x36, 0x36, 0x32, 0x36, 0x32, 0x36, 0x32, 0x37, 0x36, 0x38, 0x38, 0x3c, 0x3c, 0x38, 0x43, 0x2d, 0x2d, 0x43, 0x34, 0x2c, 0x15, 0x0b, 0x0b, 0x0f, 0x10, 0x0d, 0x0a, 0x1c, 0x30, 0x55, 0xfd, 0x03, 0xb7, 0x00, 0xa8, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xb5, 0xad, 0xb2, 0x49, 0x60, 0x98, 0x6a, 0x81, 0x85, 0x77, 0x77, 0x77, 0x7f, 0x7c, 0x75, 0x77, 0x6f, 0x84, 0x69, 0x74, 0x8e, 0x5e, 0x5b, 0x48, 0x29, 0x2a, 0x43, 0x38, 0x36, 0x36, 0x32, 0x35, 0x39, 0x3d, 0x3c, 0x38, 0x33, 0x33, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x2c, 0x34, 0x37, 0x36, 0x36, 0x36, 0x36, 0x2d, 0x32, 0x34, 0x2a, 0x15, 0x0b, 0x0b, 0x14, 0x0c, 0x08, 0x1c, 0x47, 0x55, 0xd5, 0xf4, 0xab, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0xb5, 0x02, 0xf4, 0xf4, 0xad, 0xad, 0xfa, 0xb8, 0xb3, 0xcf, 0xd5, 0xd5, 0xcf, 0xcf, 0xd5, 0xd5, 0xd5, 0x17, 0xd8, 0x17, 0xd5, 0xf8, 0x4e, 0xa7, 0xa7, 0x4e, 0xa7, 0xa7, 0x4e, 0xe0, 0xda, 0xda, 0xda, 0xda, 0xf8, 0x41, 0xa5, 0x01, 0xa5, 0x01, 0xa5, 0xa5, 0x01, 0xa4, 0xa5, 0x60, 0x60, 0x60, 0x5f, 0x60, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x5c, 0x5f, 0x5e, 0xa3, 0x9f, 0x9b, 0x9a, 0x94, 0x90, 0x8b, 0x82, 0x6d, 0x6d, 0x96, 0xa2, 0x5d, 0x54, 0x2b, 0x2e, 0x33, 0x33, 0x3e, 0x2c, 0x39, 0x39, 0x38, 0x2c, 0x43, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x37, 0x2a, 0x34, 0x43, 0x2a, 0x15, 0x0b, 0x15, 0x12, 0x14, 0x0d, 0x08, 0x11, 0x21, 0x47, 0xa3, 0xb2, 0x03, 0x00, 0xac, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0xfa, 0xd5, 0x01, 0xa2, 0x88, 0x78, 0x7b, 0x6f, 0x6f, 0x85, 0x6c, 0x7d, 0x85, 0x77, 0x84, 0x69, 0x84, 0x78, 0x82, 0x9a, 0x5d, 0x54, 0x29, 0x40, 0x2a, 0x37, 0x43, 0x2d, 0x35, 0x39, 0x39, 0x3d, 0x3c, 0x38, 0x33, 0x33, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x37, 0x36, 0x37, 0x37, 0x2d, 0x36, 0x37, 0x36, 0x2d, 0x2d, 0x43, 0x43, 0x22, 0x15, 0x0b, 0x09, 0x0c, 0x19, 0x05, 0x28, 0x4d, 0xa0, 0xf7, 0xac, 0xab, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x02, 0xf4, 0x00, 0x00, 0x02, 0xfe, 0xf6, 0xb8, 0xb2, 0xb2, 0xb2, 0xfb, 0xf8, 0xe4, 0x41, 0x41, 0xe2, 0x9e, 0xa7, 0xa5, 0x01, 0xa5, 0xef, 0xa5, 0xa5, 0xa5, 0x01, 0x01, 0xef, 0xef, 0xa7, 0xef, 0xa7, 0xa7, 0x4e, 0x9e, 0x9e, 0xe4, 0xe4, 0xe4, 0x41, 0xe0, 0xf8, 0xda, 0xd5, 0xcf, 0xcf, 0xfc, 0xfc, 0xfc, 0xbf, 0xbc, 0xbc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xbc, 0xff, 0xff, 0xff, 0xd5, 0x1e, 0xfd, 0x49, 0x49, 0x49, 0xa2, 0x59, 0x60, 0x60, 0x60, 0x5f, 0x5c, 0xa2, 0x47, 0x99, 0x96, 0xa7, 0x60, 0xa1, 0x28, 0x26, 0x26, 0x2f, 0x33, 0x43, 0x35, 0x2c, 0x2c, 0x38, 0x45, 0x3c, 0x3c, 0x3d, 0x31, 0x31, 0x2c, 0x38, 0x3e, 0x43, 0x2c, 0x36, 0x38, 0x37, 0x2c, 0x2c, 0x2c, 0x2d, 0x2d, 0x33, 0x43, 0x2a, 0x1a, 0x15, 0x0b, 0x0f, 0x14, 0x0c, 0x11, 0x0a, 0x21, 0x4d, 0x60, 0x05, 0xb6, 0xae, 0xa8, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x00, 0xaa, 0xad, 0xfb, 0xa0, 0xa5, 0x94, 0x72, 0x84, 0x6f, 0x6f, 0x77, 0x7a, 0x7d, 0x7d, 0x70, 0x83, 0x69, 0x79, 0x84, 0x67, 0x90, 0xa1, 0x5d, 0x48, 0x2e, 0x2a, 0x33, 0x2d, 0x32, 0x36, 0x35, 0x39, 0x3d, 0x3d, 0x38, 0x33, 0x33, 0x2d, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x36, 0x2d, 0x36, 0x43, 0x2a, 0x1d, 0x0b, 0x0b, 0x10, 0x0c, 0x13, 0x0a, 0x30, 0xa0, 0xfd, 0xb0, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x02, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa8, 0xa8, 0xa8, 0x02, 0xf4, 0x02, 0x03, 0xb3, 0xfc, 0xd5, 0x17, 0xb4, 0x41, 0xe4, 0x53, 0xa7, 0xa7, 0xed, 0xa5, 0x01, 0x01, 0xa5, 0x01, 0x01, 0xef, 0xa7, 0x9e, 0x41, 0xb4, 0xda, 0xcf, 0xcf, 0xbf, 0xfb, 0xb9, 0x03, 0xb7, 0xf5, 0xfe, 0xf5, 0xfa, 0xad, 0x02, 0xb5, 0x61, 0xa8, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x61, 0xf9, 0x61, 0xf9, 0xf4, 0xfe, 0x03, 0x05, 0xfc, 0x1e, 0x9e, 0x59, 0x60, 0x60, 0x01, 0xef, 0xa5, 0xa5, 0x4d, 0x44, 0x2b, 0x3a, 0x2f, 0x27, 0x24, 0x2a, 0x3b, 0x43, 0x3e, 0x39, 0x31, 0x31, 0x3c, 0x45, 0x45, 0x45, 0x39, 0x3e, 0x39, 0x38, 0x2c, 0x36, 0x38, 0x37, 0x37, 0x2d, 0x2d, 0x33, 0x3b, 0x33, 0x1d, 0x15, 0x0b, 0x12, 0x14, 0x07, 0x13, 0x08, 0x21, 0x25, 0x59, 0xfc, 0x03, 0xad, 0xa8, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xa6, 0xa8, 0xb8, 0xb4, 0xa5, 0x9f, 0x88, 0x72, 0x79, 0x79, 0x6f, 0x7c, 0x7d, 0x7d, 0x7d, 0x85, 0x6f, 0x79, 0x84, 0x68, 0x6b, 0x9a, 0x5e, 0x56, 0x29, 0x40, 0x3b, 0x2a, 0x37, 0x36, 0x39, 0x39, 0x39, 0x3d, 0x38, 0x37, 0x33, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x38, 0x43, 0x2d, 0x32, 0x34, 0x2a, 0x1a, 0x0b, 0x0f, 0x09, 0x13, 0x07, 0x1c, 0x47, 0x5c, 0xd5, 0xae, 0x00, 0xf4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x02, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xb5, 0x02, 0xfa, 0xfe, 0xf6, 0x03, 0xb9, 0xf7, 0xcf, 0xf8, 0x9e, 0xe9, 0x9e, 0xa7, 0xa5, 0x01, 0xa5, 0xa5, 0x01, 0x01, 0x01, 0xa7, 0x9e, 0x41, 0xe0, 0xda, 0xfc, 0xfb, 0x03, 0xb8, 0xb6, 0xaf, 0xf4, 0xaa, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0xaa, 0x61, 0xaa, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x02, 0x62, 0xf9, 0x61, 0xf9, 0xf9, 0xf9, 0x61, 0xa8, 0xaa, 0xab, 0xaa, 0xab, 0xaa, 0xab, 0xaa, 0xab, 0xaa, 0xaa, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0xa6, 0x62, 0x00, 0xa6, 0x00, 0x62, 0xfe, 0x04, 0xd5, 0xf8, 0xa7, 0xef, 0x60, 0x5e, 0x5e, 0x5b, 0x51, 0x48, 0x48, 0x29, 0x20, 0x27, 0x40, 0x34, 0x2c, 0x31, 0x45, 0x37, 0x38, 0x38, 0x3e, 0x3e, 0x3d, 0x38, 0x39, 0x38, 0x2c, 0x36, 0x37, 0x43, 0x34, 0x2d, 0x3b, 0x3b, 0x22, 0x12, 0x0b, 0x0f, 0x14, 0x13, 0x07, 0x11, 0x1c, 0x25, 0x60, 0x1b, 0xb2, 0xac, 0x00, 0xaa, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa8, 0xa6, 0xa6, 0xae, 0xfb, 0xa7, 0xa5, 0x94, 0x67, 0x76, 0x79, 0x79, 0x6c, 0x7d, 0x7d, 0x7d, 0x7d, 0x6c, 0x6f, 0x83, 0x71, 0x68, 0x8c, 0xa1, 0x5b, 0x48, 0x29, 0x40, 0x2a, 0x43, 0x38, 0x35, 0x39, 0x39, 0x38, 0x38, 0x2d, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x36, 0x2d, 0x43, 0x3b, 0x22, 0x15, 0x12, 0x0f, 0x10, 0x08, 0x11, 0x1c, 0xa0, 0xa0, 0xb3, 0x00, 0x61, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xb5, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x61, 0x02, 0xf4, 0xfa, 0xb8, 0xb3, 0xfc, 0x17, 0xda, 0xb4, 0x9e, 0xe9, 0xa7, 0xef, 0xa5, 0x01, 0x01, 0xa7, 0xef, 0xef, 0x4e, 0xfd, 0xda, 0xcf, 0xfb, 0xb3, 0xf6, 0xfa, 0xb5, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xab, 0xaa, 0xab, 0xaa, 0xab, 0x00, 0xaa, 0xa6, 0xab, 0xa8, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x62, 0xfa, 0xb9, 0xd5, 0x3f, 0x5a, 0x5e, 0x5e, 0x5e, 0x5b, 0x54, 0x4c, 0x42, 0x29, 0x24, 0x32, 0x46, 0x43, 0x3b, 0x33, 0x2d, 0x37, 0x37, 0x3e, 0x31, 0x39, 0x3e, 0x3e, 0x37, 0x2d, 0x2d, 0x32, 0x2a, 0x3b, 0x2a, 0x1a, 0x0b, 0x0b, 0x10, 0x10, 0x0d, 0x0a, 0x16, 0x25, 0x59, 0x49, 0xb9, 0xfe, 0x00, 0xaa, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa6, 0xa6, 0x00, 0x00, 0x00, 0x61, 0x00, 0x02, 0xa6, 0xa6, 0xab, 0xb8, 0xf8, 0x01, 0x9f, 0x82, 0x68, 0x79, 0x77, 0x7a, 0x71, 0x7d, 0x70, 0x7a, 0x75, 0x6f, 0x79, 0x7b, 0x76, 0x6a, 0x98, 0x5d, 0x58, 0x29, 0x27, 0x46, 0x37, 0x38, 0x38, 0x35, 0x35, 0x35, 0x38, 0x3c, 0x3c, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x3c, 0x37, 0x36, 0x3b, 0x32, 0x1d, 0x12, 0x12, 0x0f, 0x14, 0x07, 0x0e, 0x21, 0x5a, 0xfd, 0xb7, 0x00, 0xf4, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x61, 0x02, 0xa8, 0x61, 0xaa, 0xf9, 0xa8, 0xa8, 0xa8, 0xf4, 0x02, 0xf4, 0xf5, 0xb8, 0xb9, 0xba, 0xbc, 0xcf, 0x9e, 0xe4, 0x9e, 0xa7, 0xa5, 0xa5, 0x01, 0x01, 0x01, 0xa5, 0xa7, 0x41, 0xe0, 0xda, 0xbf, 0xb9, 0xfe, 0xfa, 0xad, 0xa8, 0x00, 0x61, 0x00, 0x00, 0xa8, 0x61, 0x61, 0x00, 0x61, 0x61, 0x61, 0x00, 0x61, 0xaa, 0x61, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xaa, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0xaa, 0xa6, 0xab, 0xa6, 0xab, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xf9, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x62, 0xb7, 0x05, 0x1e, 0xa0, 0x5f, 0x5f, 0x5e, 0x5b, 0x54, 0x52, 0x3a, 0x1d, 0x26, 0x2e, 0x40, 0x46, 0x2f, 0x2d, 0x2d, 0x3e, 0x2c, 0x45, 0x3e, 0x2c, 0x2d, 0x2d, 0x33, 0x33, 0x2a, 0x1a, 0x0b, 0x12, 0x10, 0x10, 0x08, 0x08, 0x16, 0x25, 0x4d, 0xa0, 0x04, 0xb6, 0xaa, 0xb5, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x61, 0x00, 0x00, 0x62, 0xa6, 0xa6, 0xab, 0xaf, 0xbc, 0xed, 0x60, 0x94, 0x67, 0x84, 0x69, 0x85, 0x7a, 0x71, 0x71, 0x7a, 0x83, 0x6f, 0x6f, 0x75, 0x7e, 0x6a, 0x8e, 0x57, 0x5d, 0x48, 0x24, 0x40, 0x31, 0x37, 0x3d, 0x36, 0x32, 0x35, 0x36, 0x3c, 0x3c, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x31, 0x45, 0x3e, 0x2d, 0x32, 0x3b, 0x2a, 0x1a, 0x0b, 0x12, 0x09, 0x07, 0x13, 0x16, 0x3f, 0x59, 0x17, 0xfa, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x02, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0xad, 0x00, 0x61, 0x02, 0xad, 0xfa, 0xb7, 0xba, 0xfc, 0x17, 0xb4, 0xfd, 0xa7, 0xed, 0xa4, 0xef, 0xa5, 0xf2, 0xef, 0xef, 0xa7, 0x4e, 0xe0, 0xcf, 0xfb, 0xf7, 0xb8, 0xad, 0x00, 0x00, 0x61, 0x61, 0x00, 0xf4, 0xa8, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x61, 0x61, 0x00, 0x00, 0x61, 0x02, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xa8, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x61, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xb5, 0x02, 0xf4, 0xb5, 0xf9, 0xf9, 0xf9, 0xf9, 0x00, 0x62, 0xa6, 0x61, 0x02, 0xb3, 0x1e, 0x55, 0x5e, 0x5d, 0x5b, 0x57, 0x56, 0x48, 0x3a, 0x26, 0x20, 0x2a, 0x2f, 0x43, 0x2d, 0x31, 0x3e, 0x45, 0x38, 0x2c, 0x32, 0x34, 0x33, 0x1a, 0x15, 0x0b, 0x0f, 0x14, 0x0c, 0x08, 0x11, 0x21, 0xa2, 0x53, 0xfb, 0xfe, 0xaa, 0xac, 0xab, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x61, 0x00, 0x00, 0xa6, 0xa6, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa6, 0xa6, 0xa6, 0xab, 0xab, 0xf6, 0x23, 0x5f, 0x9f, 0x88, 0x6e, 0x69, 0x7f, 0x7a, 0x7a, 0x7c, 0x79, 0x77, 0x79, 0x6f, 0x7b, 0x76, 0x80, 0x82, 0x9b, 0x5d, 0x56, 0x29, 0x33, 0x2d, 0x3c, 0x37, 0x35, 0x32, 0x32, 0x39, 0x3c, 0x3c, 0x3e, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3d, 0x31, 0x45, 0x3d, 0x2c, 0x36, 0x34, 0x32, 0x22, 0x15, 0x15, 0x09, 0x09, 0x0d, 0x18, 0x16, 0x4d, 0xa0, 0xbf, 0xf4, 0x00, 0xa8, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa8, 0x61, 0xa8, 0x00, 0x00, 0xa8, 0x02, 0xad, 0xae, 0xf6, 0xb2, 0xb9, 0xbc, 0x17, 0xfd, 0xe4, 0x4e, 0xed, 0x01, 0x01, 0xf3, 0xa5, 0x01, 0xef, 0xe4, 0xe0, 0xf8, 0xcf, 0xb3, 0xf6, 0xad, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x02, 0x02, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x61, 0x61, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x02, 0x00, 0xaa, 0xab, 0xab, 0xab, 0xa8, 0x00, 0x62, 0xfe, 0xfb, 0x3f, 0x5c, 0x5f, 0x5c, 0x5d, 0x51, 0x42, 0x26, 0x2e, 0x40, 0x3b, 0x2c, 0x2c, 0x3d, 0x3d, 0x2c, 0x37, 0x37, 0x2a, 0x22, 0x15, 0x0b, 0x0b, 0x14, 0x10, 0x08, 0x11, 0x1c, 0x49, 0x5a, 0xcf, 0xf6, 0xb5, 0xaa, 0xac, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x61, 0x00, 0xa6, 0xa6, 0xa6, 0xaa, 0xab, 0xae, 0xbf, 0x55, 0x5f, 0x93, 0x67, 0x87, 0x71, 0x75, 0x75, 0x83, 0x6c, 0x69, 0x77, 0x79, 0x7b, 0x70, 0x86, 0x66, 0x95, 0x57, 0x5b, 0x42, 0x27, 0x43, 0x3e, 0x3c, 0x34, 0x32, 0x32, 0x32, 0x3d, 0x3c, 0x3c, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x45, 0x3c, 0x3c, 0x37, 0x34, 0x32, 0x33, 0x43, 0x22, 0x0b, 0x15, 0x10, 0x0c, 0x08, 0x11, 0x25, 0x55, 0x49, 0xf6, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xa8, 0xa8, 0x62, 0xf5, 0xb7, 0xf7, 0xfc, 0x17, 0xb4, 0x41, 0xa7, 0xef, 0xef, 0x01, 0x01, 0x01, 0xef, 0x53, 0xe4, 0xe0, 0xd5, 0xb3, 0xb2, 0xb7, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xa6, 0x61, 0x61, 0x00, 0xf9, 0xaa, 0xaa, 0xab, 0xab, 0xaa, 0xaa, 0xaa, 0x61, 0x61, 0x61, 0x61, 0xf6, 0xd8, 0x53, 0x5e, 0x5e, 0x5d, 0x58, 0x48, 0x26, 0x27, 0x40, 0x2a, 0x3b, 0x2d, 0x2d, 0x34, 0x34, 0x22, 0x15, 0x0b, 0x15, 0x12, 0x14, 0x07, 0x0a, 0x1c, 0x3f, 0x5a, 0xf8, 0x03, 0x02, 0xa8, 0xb5, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xaa, 0xa8, 0xf6, 0x41, 0x5c, 0xa0, 0x82, 0x80, 0x69, 0x79, 0x75, 0x7a, 0x7a, 0x7a, 0x75, 0x79, 0x6f, 0x79, 0x70, 0x80, 0x80, 0xa1, 0x5d, 0x50, 0x26, 0x40, 0x3c, 0x3c, 0x3c, 0x34, 0x32, 0x32, 0x3d, 0x3c, 0x3e, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x37, 0x32, 0x34, 0x32, 0x34, 0x32, 0x2a, 0x2a, 0x1a, 0x0f, 0x0f, 0x0c, 0x07, 0x0d, 0x1c, 0x30, 0x5f, 0x1e, 0xf6, 0x00, 0xb5, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x61, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0xaa, 0x61, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x02, 0xad, 0xad, 0xf5, 0xb1, 0xf7, 0xbc, 0xb4, 0xfd, 0x9e, 0xa7, 0xa5, 0x01, 0x01, 0xa5, 0xa5, 0xef, 0x9e, 0xf8, 0x17, 0xbc, 0xb8, 0xfa, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x61, 0x00, 0xaa, 0xa6, 0xaa, 0xa6, 0xaa, 0x61, 0xb5, 0xb5, 0xaa, 0xaa, 0xab, 0xa9, 0xff, 0x3f, 0x5f, 0x5f, 0x57, 0x54, 0x44, 0x2b, 0x2b, 0x26, 0x27, 0x40, 0x46, 0x22, 0x1a, 0x0b, 0x12, 0x12, 0x0c, 0x13, 0x11, 0x16, 0x23, 0x55, 0xf8, 0x04, 0xf4, 0xf9, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xaa, 0xa9, 0xfc, 0xf2, 0x5c, 0x91, 0x66, 0x6e, 0x83, 0x79, 0x7a, 0x7d, 0x7a, 0x7a, 0x75, 0x79, 0x71, 0x7b, 0x76, 0x78, 0x95, 0x5e, 0x5b, 0x2b, 0x2e, 0x38, 0x3c, 0x3c, 0x37, 0x32, 0x32, 0x36, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x36, 0x34, 0x36, 0x37, 0x34, 0x36, 0x34, 0x34, 0x3b, 0x22, 0x15, 0x0f, 0x10, 0x14, 0x0d, 0x0d, 0x21, 0x47, 0x59, 0xff, 0xf5, 0x61, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x61, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xaa, 0x00, 0x00, 0xa8, 0x02, 0xa8, 0x02, 0xf5, 0xf6, 0xb8, 0xbc, 0xd5, 0xb4, 0xfd, 0xe9, 0xef, 0xef, 0x01, 0x01, 0xa5, 0xed, 0x4e, 0x41, 0xda, 0xbc, 0xb9, 0xf5, 0x02, 0x61, 0xb5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x61, 0x61, 0x00, 0xa6, 0x00, 0xa6, 0x61, 0xa6, 0x61, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xac, 0x00, 0x61, 0xf7, 0x49, 0x5c, 0x5f, 0x5e, 0x4f, 0x44, 0x2b, 0x3a, 0x3a, 0x24, 0x12, 0x0b, 0x1a, 0x0b, 0x09, 0x0d, 0x08, 0x0e, 0x25, 0x53, 0xe4, 0x04, 0xf4, 0x00, 0xf9, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xaa, 0xb5, 0xb7, 0x41, 0x60, 0x9f, 0x82, 0x6e, 0x79, 0x71, 0x75, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x79, 0x71, 0x81, 0x6e, 0x88, 0x5a, 0x5d, 0x48, 0x2e, 0x2d, 0x3c, 0x3c, 0x34, 0x32, 0x32, 0x38, 0x3c, 0x3e, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x43, 0x33, 0x1d, 0x15, 0x12, 0x14, 0x10, 0x07, 0x0a, 0x25, 0x4d, 0x4d, 0xb3, 0xae, 0xaa, 0xac, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0xaa, 0xa8, 0x00, 0x02, 0xaa, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xf4, 0xb5, 0xf6, 0xba, 0xfb, 0xcf, 0xf8, 0xe4, 0x9e, 0xef, 0x01, 0x01, 0x01, 0x01, 0xef, 0x41, 0xb4, 0xd5, 0xfb, 0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0xa8, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xb5, 0xb5, 0xa8, 0xb5, 0x61, 0xfa, 0xf9, 0xf9, 0x04, 0xfd, 0x5a, 0x5f, 0x5d, 0x4f, 0x2b, 0x20, 0x19, 0x14, 0x0b, 0x09, 0x0f, 0x07, 0x18, 0x0a, 0x25, 0x53, 0x4e, 0xfb, 0xae, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xac, 0xa9, 0xfb, 0x5c, 0xa3, 0x93, 0x6b, 0x76, 0x79, 0x75, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x71, 0x81, 0x81, 0x6a, 0x9b, 0x5d, 0x50, 0x2e, 0x33, 0x3c, 0x37, 0x37, 0x32, 0x32, 0x39, 0x3c, 0x3c, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3c, 0x3e, 0x43, 0x2d, 0x1d, 0x0b, 0x0b, 0x0f, 0x14, 0x07, 0x16, 0x25, 0x55, 0x49, 0x03, 0xac, 0xac, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x61, 0xaa, 0x61, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xfe, 0xb8, 0xb1, 0xfb, 0xda, 0xf8, 0xe4, 0xe9, 0xa4, 0xef, 0x01, 0x01, 0x01, 0xe9, 0xe4, 0xda, 0xbc, 0xb2, 0xf6, 0xf4, 0x00, 0x00, 0x00, 0x61, 0x02, 0xa8, 0x61, 0x00, 0x00, 0x61, 0xa8, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x03, 0x3f, 0x60, 0x5e, 0x5f, 0x5d, 0x28, 0x0d, 0x06, 0x0c, 0x14, 0x0c, 0x18, 0x08, 0x25, 0x4d, 0x5c, 0xbf, 0xfa, 0xb5, 0x00, 0xa8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xac, 0xb7, 0x41, 0x5f, 0x9d, 0x88, 0x6e, 0x76, 0x6f, 0x75, 0x75, 0x75, 0x7a, 0x75, 0x7a, 0x7a, 0x7d, 0x81, 0x6b, 0x93, 0x5d, 0x5b, 0x3a, 0x2f, 0x2d, 0x37, 0x34, 0x32, 0x32, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 0x3e, 0x43, 0x2a, 0x1a, 0x0b, 0x0b, 0x14, 0x0d, 0x08, 0x1c, 0x30, 0x59, 0x23, 0xb8, 0xac, 0xaa, 0xab, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xaa, 0x61, 0xaa, 0xa8, 0xa8, 0xa8, 0x61, 0xaa, 0x61, 0xa8, 0x00, 0x00, 0xaa, 0xf4, 0xfa, 0xb3, 0xfb, 0xcf, 0xf8, 0x41, 0x9e, 0xa7, 0x01, 0x01, 0xa5, 0xef, 0xa7, 0xe4, 0xda, 0xfb, 0xb1, 0xfa, 0x62, 0x00, 0x00, 0x00, 0x00, 0x61, 0xb5, 0x61, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xa8, 0x61, 0x00, 0xa8, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x62, 0x62, 0x02, 0xf4, 0x61, 0xa8, 0x00, 0xaf, 0x17, 0xec, 0xf2, 0xf3, 0xef, 0x5c, 0x5a, 0x47, 0x21, 0x16, 0x0a, 0x0a, 0x0a, 0x08, 0x21, 0x30, 0x59, 0xfc, 0xf6, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xab, 0xae, 0xfb, 0x60, 0x59, 0x93, 0x67, 0x76, 0x79, 0x6f, 0x75, 0x7a, 0x7a, 0x75, 0x75, 0x7f, 0x70, 0x70, 0x81, 0x8b, 0xa1, 0x5e, 0x48, 0x2f, 0x33, 0x37, 0x2d, 0x32, 0x32, 0x3d, 0x3c, 0x3c, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 0x3d, 0x3d, 0x38, 0x37, 0x43, 0x2a, 0x1a, 0x0b, 0x0b, 0x19, 0x07, 0x08, 0x21, 0x30, 0x5c, 0x1e, 0xb0, 0xa6, 0xaa, 0x00, 0xaa, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa8, 0xad, 0xb6, 0xb1, 0xba, 0xfc, 0xb4, 0xe0, 0x9e, 0xef, 0x01, 0x01, 0x01, 0xf3, 0xa7, 0xe4, 0xf8, 0xcf, 0xb1, 0xf5, 0x02, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x61, 0xad, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x62, 0x62, 0x62, 0x61, 0x61, 0x00, 0x61, 0xae, 0xcf, 0xec, 0xf0, 0xee, 0xec, 0xe3, 0xd8, 0xdc, 0xe4, 0x59, 0x55, 0x25, 0x1b, 0x11, 0x0e, 0x16, 0x47, 0x60, 0x17, 0xb7, 0xa6, 0xab, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xb5, 0xfa, 0x41, 0x5f, 0x9d, 0x82, 0x6e, 0x79, 0x6f, 0x75, 0x7a, 0x7c, 0x75, 0x7a, 0x7f, 0x6c, 0x7d, 0x78, 0x82, 0x9a, 0x5e, 0x50, 0x2e, 0x33, 0x33, 0x36, 0x32, 0x35, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x34, 0x37, 0x37, 0x38, 0x38, 0x3e, 0x2c, 0x3e, 0x3e, 0x38, 0x34, 0x34, 0x33, 0x2a, 0x1a, 0x0b, 0x0f, 0x09, 0x07, 0x0d, 0x25, 0x3f, 0x5c, 0x17, 0xb6, 0xac, 0x00, 0xa8, 0xf4, 0x61, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xad, 0xfa, 0xb7, 0xbc, 0xcf, 0xb4, 0x41, 0xa7, 0xef, 0x01, 0x01, 0xa5, 0xef, 0x4e, 0xf8, 0xcf, 0xb3, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xb5, 0xa8, 0xaa, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x61, 0x61, 0xb5, 0x62, 0x02, 0x62, 0x61, 0x61, 0xf4, 0xfe, 0xbf, 0xe8, 0xf2, 0xee, 0xe7, 0xe3, 0xd9, 0xc0, 0xc0, 0xbb, 0xc7, 0xdf, 0xec, 0xef, 0x41, 0x1b, 0x1b, 0x3f, 0x55, 0x49, 0xb2, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xab, 0xb5, 0x00, 0xfb, 0x59, 0x5c, 0x91, 0x78, 0x76, 0x79, 0x6f, 0x7a, 0x7a, 0x7c, 0x77, 0x7a, 0x7c, 0x7d, 0x81, 0x6b, 0x93, 0x5a, 0x58, 0x29, 0x2f, 0x33, 0x32, 0x36, 0x36, 0x3c, 0x3c, 0x3c, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x34, 0x33, 0x33, 0x34, 0x2d, 0x36, 0x38, 0x38, 0x2c, 0x43, 0x38, 0x2d, 0x2d, 0x34, 0x22, 0x15, 0x0b, 0x12, 0x14, 0x07, 0x0a, 0x30, 0x47, 0xef, 0x17, 0xb2, 0xac, 0x00, 0xaa, 0xaa, 0x00, 0xa9, 0xf9, 0xad, 0xb6, 0xb1, 0xb3, 0xd5, 0xe0, 0x9e, 0xa7, 0xa5, 0x01, 0x01, 0x01, 0xa7, 0xfd, 0xda, 0xb3, 0xf6, 0xac, 0x00, 0x61, 0x00, 0x00, 0xa8, 0x61, 0x02, 0x02, 0xa8, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0xf9, 0x61, 0xf9, 0xf9, 0xaa, 0x00, 0x00, 0xfa, 0xf7, 0xf8, 0xe9, 0xf3, 0xee, 0xeb, 0xe3, 0xd7, 0xbd, 0xbd, 0xbd, 0xd0, 0xd6, 0xc7, 0xbb, 0xd6, 0xe5, 0xec, 0xe9, 0xe0, 0xa0, 0x41, 0x04, 0xae, 0x02, 0xab, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xab, 0x62, 0xfa, 0xfd, 0x60, 0x9f, 0x82, 0x68, 0x79, 0x84, 0x71, 0x85, 0x6c, 0x7f, 0x7f, 0x71, 0x7c, 0x81, 0x68, 0x8c, 0x5a, 0x5d, 0x48, 0x24, 0x3b, 0x36, 0x32, 0x38, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x2d, 0x33, 0x2a, 0x33, 0x34, 0x34, 0x37, 0x37, 0x38, 0x2c, 0x38, 0x45, 0x3e, 0x37, 0x3e, 0x2d, 0x2c, 0x1a, 0x0b, 0x09, 0x10, 0x0d, 0x0e, 0x21, 0x49, 0xa4, 0xb4, 0xb1, 0xf5, 0xb6, 0xac, 0xa9, 0xba, 0xb3, 0xda, 0x41, 0x4e, 0xed, 0x01, 0x01, 0xa5, 0xa5, 0x4e, 0xf8, 0xfc, 0xb2, 0xfe, 0x02, 0x00, 0x00, 0x61, 0x00, 0xaa, 0x00, 0x61, 0xaa, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x61, 0xf9, 0x61, 0x00, 0x00, 0x00, 0xb5, 0xb7, 0xbc, 0xdc, 0xe8, 0xf1, 0xf2, 0xf1, 0xea, 0xe1, 0xd6, 0xc0, 0xbd, 0xcd, 0xcd, 0xd3, 0xd3, 0xbe, 0xbe, 0xca, 0xc0, 0xd1, 0xdd, 0xee, 0xe9, 0xef, 0xda, 0xb7, 0xaf, 0xad, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xa6, 0xf4, 0xff, 0x53, 0xa3, 0x91, 0x68, 0x80, 0x79, 0x71, 0x7a, 0x7a, 0x7f, 0x7f, 0x6c, 0x7c, 0x7d, 0x68, 0x88, 0x9f, 0x5b, 0x4c, 0x27, 0x3b, 0x36, 0x32, 0x35, 0x3c, 0x31, 0x3c, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x34, 0x33, 0x34, 0x2d, 0x34, 0x38, 0x38, 0x3e, 0x3c, 0x31, 0x2c, 0x31, 0x3c, 0x38, 0x3c, 0x43, 0x22, 0x1a, 0x15, 0x10, 0x08, 0x08, 0x0e, 0x23, 0x3f, 0xed, 0xfd, 0xb3, 0xba, 0xda, 0xe2, 0xe8, 0xed, 0xa5, 0x01, 0xa5, 0xa7, 0x41, 0xda, 0xfc, 0xf5, 0xae, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0x00, 0x61, 0xf9, 0xf9, 0x61, 0x00, 0x61, 0xf9, 0x02, 0xa8, 0x00, 0xaa, 0x61, 0x62, 0x61, 0x61, 0x00, 0xf4, 0x03, 0xbf, 0xda, 0xe8, 0xec, 0xf0, 0xf1, 0xf0, 0xee, 0xe6, 0xde, 0xd6, 0xd6, 0xc7, 0xc4, 0xd0, 0xd3, 0xcc, 0xc3, 0xc3, 0xc3, 0xcc, 0xd3, 0xcd, 0xc1, 0xd0, 0xd9, 0xeb, 0xee, 0xf1, 0xdc, 0xb1, 0xb5, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x02, 0xf9, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xf9, 0xfa, 0xfd, 0x5c, 0x9d, 0x82, 0x6e, 0x76, 0x7e, 0x71, 0x75, 0x7f, 0x75, 0x75, 0x7a, 0x71, 0x76, 0x80, 0x9b, 0x5d, 0x51, 0x27, 0x2f, 0x35, 0x2c, 0x43, 0x31, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x38, 0x31, 0x3c, 0x3c, 0x3c, 0x45, 0x3c, 0x31, 0x3c, 0x45, 0x3c, 0x37, 0x45, 0x46, 0x2f, 0x19, 0x13, 0x08, 0x0a, 0xff, 0xff, 0x23, 0x53, 0xef, 0xa7, 0xef, 0xf0, 0xa5, 0xf0, 0xa4, 0xe2, 0x17, 0xfb, 0xb8, 0xad, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0xa8, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0xf9, 0xf9, 0x00, 0xf9, 0xf9, 0xf4, 0x02, 0xf9, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0xad, 0x03, 0xfc, 0xf8, 0x9e, 0xed, 0xf0, 0xf1, 0xf1, 0xf1, 0xeb, 0xe6, 0xde, 0xd9, 0xd2, 0xc0, 0xc7, 0xbd, 0xc4, 0xc9, 0xcd, 0xcc, 0xcb, 0xc3, 0xc3, 0xcb, 0xcb, 0xc5, 0xc2, 0xcd, 0xc9, 0xbd, 0xd1, 0xea, 0xee, 0xf1, 0xe5, 0xb9, 0xac, 0xb5, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0x61, 0xf9, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0xa4, 0x93, 0x66, 0x7e, 0x7e, 0x85, 0x7a, 0x7c, 0x75, 0x75, 0x7c, 0x7a, 0x76, 0x72, 0x96, 0x5e, 0x56, 0x2e, 0x2a, 0x35, 0x32, 0x36, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x31, 0x3e, 0x31, 0x2c, 0x2d, 0x45, 0x46, 0x37, 0x33, 0x33, 0x27, 0x26, 0x26, 0x1f, 0x18, 0x21, 0x47, 0x55, 0x59, 0xa5, 0xa5, 0xef, 0xed, 0xe4, 0xd8, 0xbc, 0xaf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0x61, 0xf9, 0x02, 0xf9, 0xf9, 0xf9, 0x00, 0xaa, 0xb0, 0xbc, 0xdc, 0xe9, 0xef, 0xf1, 0xf2, 0xf1, 0xec, 0xeb, 0xea, 0xdd, 0xdb, 0xd6, 0xc0, 0xbb, 0xbd, 0xc4, 0xc4, 0xd0, 0xd0, 0xcd, 0xc5, 0xc5, 0xc3, 0xcb, 0xcb, 0xc6, 0xcb, 0xc6, 0xbe, 0xc3, 0xd3, 0xd3, 0xcd, 0xca, 0xc0, 0xe6, 0xf1, 0xf0, 0xe8, 0xf7, 0x00, 0xaa, 0xb5, 0xaa, 0x00, 0x00, 0xf9, 0x62, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0xaa, 0x00, 0xa8, 0xf6, 0xe0, 0x60, 0x9f, 0x82, 0x6b, 0x84, 0x7a, 0x7f, 0x7a, 0x75, 0x7a, 0x7c, 0x71, 0x84, 0x67, 0x93, 0x5e, 0x56, 0x2e, 0x2a, 0x35, 0x36, 0x36, 0x2d, 0x37, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x3e, 0x31, 0x3c, 0x3c, 0x3c, 0x3c, 0x3e, 0x37, 0x2d, 0x43, 0x3b, 0x33, 0x40, 0x27, 0x24, 0x24, 0x29, 0x2b, 0x4a, 0x50, 0x54, 0x5a, 0x5e, 0x60, 0x5f, 0xa5, 0x53, 0x1e, 0xb3, 0xf6, 0xae, 0xaa, 0xaa, 0x00, 0xaa, 0xa8, 0x02, 0x02, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xaa, 0x61, 0xaa, 0x61, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x62, 0x00, 0x00, 0x02, 0xf9, 0x00, 0x00, 0xa8, 0xaf, 0xba, 0xdf, 0xee, 0xf1, 0xf0, 0xf0, 0xee, 0xea, 0xe6, 0xde, 0xd9, 0xd2, 0xbb, 0xd1, 0xca, 0xc4, 0xc4, 0xcd, 0xcd, 0xd0, 0xcd, 0xbe, 0xc5, 0xc8, 0xcc, 0xce, 0xce, 0xc6, 0xc3, 0xc6, 0xc6, 0xc3, 0xc6, 0xc8, 0xc8, 0xc8, 0xbe, 0xd4, 0xc4, 0xc0, 0xe1, 0xeb, 0xf0, 0xe8, 0xf7, 0xab, 0xb5, 0xab, 0xaa, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0xa6, 0xa9, 0x02, 0xfb, 0x53, 0x60, 0x93, 0x67, 0x81, 0x69, 0x85, 0x7c, 0x6c, 0x79, 0x7a, 0x7a, 0x76, 0x68, 0x91, 0x5e, 0x58, 0x2e, 0x2a, 0x35, 0x32, 0x36, 0x33, 0x34, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x3e, 0x31, 0x3c, 0x3c, 0x3e, 0x37, 0x34, 0x33, 0x2f, 0x40, 0x2e, 0x2e, 0x29, 0x3a, 0x42, 0x4c, 0x51, 0x5b, 0x57, 0x5e, 0x5f, 0x5f, 0xa0, 0x23, 0xcf, 0x03, 0xfa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaf, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0xb8, 0xcf, 0xe9, 0xf2, 0xf2, 0xee, 0xea, 0xe6, 0xd9, 0xd7, 0xc7, 0xbb, 0xbd, 0xbd, 0xcd, 0xd0, 0xc4, 0xc9, 0xcd, 0xd3, 0xcd, 0xce, 0xc5, 0xbe, 0xc2, 0xc2, 0xc2, 0xc8, 0xce, 0xcb, 0xc8, 0xc2, 0xc8, 0xc2, 0xc3, 0xcc, 0xc8, 0xbe, 0xc2, 0xc8, 0xc2, 0xc1, 0xc4, 0xbb, 0xde, 0xf0, 0xee, 0xed, 0xbc, 0xaf, 0xab, 0xaa, 0xab, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xac, 0x00, 0xfe, 0x23, 0x60, 0x9d, 0x88, 0x76, 0x6c, 0x85, 0x71, 0x79, 0x6c, 0x7c, 0x71, 0x79, 0x67, 0x91, 0x5e, 0x56, 0x2e, 0x32, 0x35, 0x32, 0x2d, 0x32, 0x34, 0x36, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x31, 0x38, 0x2d, 0x2d, 0x2d, 0x2f, 0x40, 0x2e, 0x26, 0x2b, 0x42, 0x4a, 0x54, 0x5d, 0x5e, 0x5e, 0x60, 0x5c, 0x9e, 0x17, 0xb9, 0xae, 0x61, 0x62, 0x61, 0x00, 0x61, 0xf9, 0x02, 0xf4, 0x61, 0x00, 0x00, 0x00, 0xaa, 0xa8, 0xaa, 0x61, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xac, 0x00, 0x00, 0xb5, 0x62, 0xa8, 0xb8, 0xcf, 0xa7, 0xf0, 0xf1, 0xec, 0xe3, 0xdd, 0xd6, 0xc7, 0xd0, 0xcd, 0xcd, 0xc9, 0xc9, 0xc5, 0xc1, 0xbe, 0xc5, 0xc3, 0xbe, 0xc3, 0xc3, 0xc8, 0xc6, 0xcb, 0xcb, 0xcb, 0xc6, 0xc2, 0xc2, 0xc2, 0xc8, 0xcc, 0xce, 0xc5, 0xc5, 0xc5, 0xc2, 0xbe, 0xce, 0xd3, 0xc2, 0xc2, 0xcd, 0xd7, 0xbb, 0xd9, 0xec, 0xeb, 0xe9, 0xd2, 0xae, 0xab, 0xab, 0xab, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x02, 0xa6, 0x00, 0xb5, 0xbc, 0x53, 0x5c, 0x92, 0x67, 0x87, 0x71, 0x7a, 0x79, 0x6f, 0x7f, 0x7a, 0x76, 0x72, 0x93, 0x5e, 0x58, 0x2e, 0x2a, 0x35, 0x2c, 0x2c, 0x2a, 0x43, 0x2d, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x38, 0x38, 0x38, 0x37, 0x36, 0x36, 0x34, 0x34, 0x3b, 0x33, 0x2a, 0x27, 0x27, 0x2e, 0x3a, 0x42, 0x50, 0x57, 0x5b, 0x5e, 0x5e, 0x5f, 0x4d, 0x23, 0xfb, 0x03, 0xa6, 0x61, 0xa6, 0xa6, 0xaa, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x61, 0xa8, 0x61, 0xa8, 0x61, 0xa8, 0x00, 0x61, 0xad, 0xf5, 0xb7, 0xb7, 0xb7, 0xb7, 0xaa, 0xaa, 0xaa, 0xaa, 0x61, 0xa8, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x02, 0x00, 0xa9, 0xba, 0xe2, 0xf3, 0xf0, 0xea, 0xe1, 0xd6, 0xc0, 0xc0, 0xca, 0xca, 0xbe, 0xc5, 0xc8, 0xcc, 0xcc, 0xc8, 0xc8, 0xc8, 0xce, 0xc8, 0xc3, 0xc3, 0xc8, 0xc6, 0xc3, 0xc6, 0xc2, 0xc6, 0xc6, 0xcb, 0xcb, 0xc2, 0xc5, 0xc8, 0xc5, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8, 0xc2, 0xc2, 0xc2, 0xcd, 0xc4, 0xc0, 0xc7, 0xdb, 0xeb, 0xf1, 0xe5, 0xbf, 0xb0, 0xab, 0xa6, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0xb6, 0xfd, 0xa5, 0x9d, 0x72, 0x78, 0x70, 0x75, 0x6f, 0x7f, 0x75, 0x87, 0x78, 0x64, 0x9d, 0x5a, 0x51, 0x3a, 0x2a, 0x3d, 0x45, 0x31, 0x3c, 0x37, 0x2d, 0x37, 0x37, 0x37, 0x31, 0x3c, 0x3c, 0x3c, 0x45, 0x2c, 0x2c, 0x36, 0x32, 0x2a, 0x2a, 0x40, 0x29, 0x26, 0x2b, 0x2b, 0x48, 0x4a, 0x57, 0x5d, 0x5e, 0x5f, 0x5c, 0x9e, 0x17, 0x04, 0xf5, 0x62, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x62, 0x61, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xa8, 0x00, 0x00, 0xb5, 0x02, 0x00, 0x02, 0xb8, 0xcf, 0xb4, 0xe8, 0xef, 0xed, 0xed, 0xed, 0xef, 0xea, 0xf8, 0xbf, 0xb8, 0xac, 0x00, 0x00, 0x62, 0x62, 0x00, 0x62, 0x00, 0x00, 0xa8, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x02, 0x61, 0x00, 0x62, 0x02, 0x62, 0x00, 0xac, 0xda, 0xf0, 0xf0, 0xeb, 0xdd, 0xd7, 0xca, 0xbd, 0xc4, 0xc9, 0xcc, 0xc9, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc2, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xcb, 0xc2, 0xc8, 0xc2, 0xc8, 0xc8, 0xc8, 0xc8, 0xc3, 0xc8, 0xc2, 0xcc, 0xc2, 0xc5, 0xcd, 0xcd, 0xca, 0xd1, 0xd1, 0xeb, 0xf0, 0xea, 0xbf, 0xb6, 0x61, 0x02, 0x00, 0xa6, 0x00, 0x61, 0x00, 0x00, 0x61, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x61, 0xf9, 0x61, 0x61, 0xaa, 0xb3, 0xa4, 0xa7, 0x93, 0x67, 0x76, 0x85, 0x77, 0x7f, 0x75, 0x76, 0x74, 0x89, 0x9f, 0x5e, 0x4a, 0x2e, 0x2a, 0x38, 0x45, 0x3c, 0x3c, 0x2d, 0x37, 0x2d, 0x37, 0x38, 0x3e, 0x3c, 0x3c, 0x31, 0x38, 0x2d, 0x2a, 0x3b, 0x40, 0x2f, 0x27, 0x29, 0x2b, 0x4a, 0x50, 0x54, 0x5d, 0x5f, 0x5f, 0x5c, 0x49, 0x17, 0xb2, 0xf4, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xab, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x00, 0x61, 0x61, 0x00, 0x00, 0xfa, 0x00, 0xaa, 0xb3, 0xdc, 0xef, 0xf2, 0xf2, 0xf3, 0xf1, 0xee, 0xec, 0xeb, 0xee, 0xf0, 0xf2, 0xf2, 0xed, 0xe2, 0xfb, 0xad, 0x00, 0x00, 0x62, 0x61, 0x62, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0xa8, 0x00, 0x00, 0x02, 0x62, 0x62, 0xfa, 0xdc, 0xf3, 0xea, 0xe6, 0xd7, 0xd0, 0xc4, 0xc1, 0xc1, 0xcc, 0xcc, 0xc2, 0xcb, 0xc3, 0xcc, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc6, 0xc6, 0xc2, 0xc6, 0xc2, 0xc6, 0xc8, 0xc6, 0xc8, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc8, 0xc8, 0xcc, 0xc2, 0xc5, 0xcc, 0xd3, 0xc9, 0xcd, 0xd1, 0xd4, 0xea, 0xf1, 0xec, 0xbc, 0xb7, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x61, 0x00, 0x02, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0xab, 0xae, 0xf8, 0xa5, 0x9f, 0x82, 0x6b, 0x7d, 0x6c, 0x85, 0x87, 0x67, 0x82, 0x96, 0x5d, 0x5b, 0x2b, 0x29, 0x2a, 0x34, 0x3e, 0x3e, 0x3e, 0x2d, 0x3e, 0x2d, 0x2c, 0x38, 0x38, 0x37, 0x34, 0x43, 0x46, 0x40, 0x2f, 0x24, 0x20, 0x3a, 0x48, 0x4c, 0x57, 0x5d, 0x5e, 0x5f, 0x5e, 0x49, 0x0e, 0x03, 0x62, 0x00, 0x00, 0x00, 0xb5, 0xf4, 0xac, 0xa8, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x02, 0xac, 0x00, 0x00, 0xaa, 0xb5, 0x02, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xae, 0x00, 0xb2, 0xfd, 0xec, 0xf3, 0xf2, 0xea, 0xe5, 0xde, 0xdb, 0xd7, 0xd9, 0xd9, 0xdb, 0xde, 0xe3, 0xea, 0xee, 0xf1, 0xf2, 0xfd, 0xb8, 0x00, 0xa8, 0x62, 0x00, 0x02, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x62, 0x02, 0xa6, 0xf4, 0xf8, 0xf2, 0xf2, 0xe1, 0xd1, 0xc4, 0xc4, 0xc4, 0xc9, 0xd0, 0xcc, 0xc2, 0xc3, 0xc2, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc2, 0xcb, 0xc2, 0xc8, 0xc2, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc3, 0xc2, 0xc2, 0xc2, 0xce, 0xcc, 0xc9, 0xc1, 0xcd, 0xc0, 0xd7, 0xea, 0xf0, 0xea, 0xfb, 0xb6, 0x02, 0xa6, 0xa8, 0x00, 0x00, 0xb5, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0xab, 0xaa, 0xb3, 0xa4, 0xa3, 0x91, 0x67, 0x86, 0x7d, 0x81, 0x78, 0x6a, 0x90, 0xa1, 0x5d, 0x4c, 0x2e, 0x27, 0x3b, 0x3b, 0x32, 0x34, 0x43, 0x2d, 0x38, 0x2c, 0x2d, 0x37, 0x34, 0x2a, 0x2a, 0x40, 0x24, 0x29, 0x42, 0x44, 0x51, 0x58, 0x5d, 0x5d, 0x5e, 0x5a, 0x49, 0x0e, 0x03, 0xf4, 0x62, 0x00, 0x61, 0xa8, 0x02, 0xaa, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0xa8, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x61, 0xa8, 0x61, 0xa8, 0xbc, 0xe9, 0xf3, 0xf2, 0xe5, 0xdb, 0xd2, 0xc7, 0xbb, 0xbb, 0xbb, 0xbd, 0xbd, 0xbd, 0xc0, 0xd2, 0xd2, 0xdb, 0xea, 0xeb, 0xe9, 0xf2, 0xcf, 0x00, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xb5, 0x61, 0x62, 0xda, 0xf0, 0xf0, 0xdd, 0xc0, 0xd4, 0xca, 0xd0, 0xd0, 0xd0, 0xd3, 0xc5, 0xc5, 0xc2, 0xcb, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc6, 0xc6, 0xc6, 0xc2, 0xc2, 0xc2, 0xc1, 0xc1, 0xbd, 0xc0, 0xd7, 0xea, 0xf2, 0xe9, 0xbf, 0xae, 0xa6, 0xaa, 0xa6, 0x00, 0xaa, 0xf9, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0xaa, 0xab, 0xb6, 0x9c, 0xa4, 0x9b, 0x82, 0x74, 0x8a, 0x66, 0x66, 0x91, 0x9f, 0x5d, 0x56, 0x4b, 0x2f, 0x2d, 0x3b, 0x32, 0x2a, 0x3b, 0x34, 0x2d, 0x2d, 0x36, 0x36, 0x46, 0x3b, 0x24, 0x27, 0x2b, 0x3a, 0x4a, 0x51, 0x57, 0x5e, 0x5e, 0x59, 0x47, 0x17, 0x04, 0x02, 0x00, 0x00, 0x61, 0xa6, 0x00, 0x00, 0xaa, 0x00, 0x61, 0xa8, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x61, 0x00, 0x62, 0x00, 0x00, 0x62, 0x02, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x62, 0xf4, 0x02, 0x02, 0xf9, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xf4, 0x61, 0x00, 0x00, 0xd5, 0xef, 0xf0, 0xeb, 0xde, 0xbb, 0xc0, 0xd0, 0xd0, 0xcd, 0xd0, 0xd3, 0xd3, 0xc9, 0xc1, 0xcd, 0xc0, 0xca, 0xc0, 0xc0, 0xe1, 0xee, 0xec, 0xf0, 0xbf, 0xb5, 0xaa, 0x62, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0xbc, 0xf1, 0xf1, 0xde, 0xc0, 0xc4, 0xd4, 0xc1, 0xc5, 0xc9, 0xc5, 0xc5, 0xc5, 0xc8, 0xcb, 0xcb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc5, 0xc9, 0xcc, 0xc5, 0xcc, 0xc5, 0xcc, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc4, 0xd4, 0xc7, 0xd6, 0xe5, 0x01, 0xe8, 0xbc, 0xaf, 0x00, 0xab, 0xac, 0xaa, 0x00, 0xb5, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0xaa, 0xaa, 0xab, 0xab, 0xb3, 0xa4, 0x5c, 0x91, 0x64, 0x73, 0x73, 0x94, 0xa2, 0x5e, 0x5b, 0x3a, 0x3b, 0x37, 0x38, 0x37, 0x34, 0x2a, 0x32, 0x43, 0x32, 0x32, 0x2a, 0x2a, 0x27, 0x27, 0x42, 0x4c, 0x51, 0x57, 0x5d, 0x5f, 0x5f, 0x4d, 0xd5, 0xb2, 0xf4, 0x00, 0x00, 0xa6, 0xa9, 0xa9, 0xaa, 0xaa, 0xab, 0xa9, 0xab, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x62, 0xb6, 0xb9, 0xbf, 0xf8, 0xe8, 0x4e, 0xe2, 0x17, 0xb3, 0x03, 0xfa, 0x62, 0x00, 0x61, 0x61, 0x62, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x02, 0x00, 0xaa, 0xd8, 0xa7, 0xf0, 0xe7, 0xd2, 0xbb, 0xd7, 0xbe, 0xc9, 0xc5, 0xc8, 0xc3, 0xc3, 0xc3, 0xc2, 0xc5, 0xbe, 0xc4, 0xcd, 0xd1, 0xca, 0xbb, 0xd2, 0xea, 0xf0, 0xf3, 0xcf, 0x00, 0xa8, 0xf4, 0xa6, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xb6, 0xea, 0xf0, 0xe6, 0xd1, 0xbd, 0xd4, 0xbe, 0xcc, 0xc5, 0xc5, 0xc5, 0xc5, 0xcc, 0xce, 0xc8, 0xc2, 0xc3, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xcc, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc2, 0xc2, 0xcc, 0xc1, 0xd4, 0xc0, 0xc0, 0xbb, 0xdf, 0xee, 0x01, 0xe9, 0xcf, 0xaf, 0xaa, 0xb5, 0xaa, 0x00, 0xab, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x61, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xab, 0xaa, 0xa6, 0xaf, 0xfd, 0x60, 0x3f, 0x89, 0x89, 0x9a, 0xa3, 0x5e, 0x54, 0x4c, 0x2f, 0x2d, 0x45, 0x31, 0x3d, 0x36, 0x2d, 0x32, 0x3b, 0x33, 0x2f, 0x2e, 0x3a, 0x3a, 0x48, 0x56, 0x5b, 0x5d, 0x5e, 0x55, 0x1e, 0xb3, 0xf5, 0x00, 0x00, 0xaa, 0xae, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0xaa, 0xa8, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x62, 0xad, 0x61, 0xb9, 0xf8, 0xed, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0x41, 0xfc, 0xfe, 0xf4, 0x61, 0x61, 0x61, 0xa8, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xba, 0xef, 0xee, 0xe9, 0xd6, 0xc0, 0xc4, 0xbe, 0xd4, 0xc3, 0xc6, 0xc3, 0xc6, 0xc2, 0xc6, 0xce, 0xce, 0xd3, 0xc5, 0xc5, 0xc9, 0xc1, 0xd1, 0xd4, 0xc7, 0xe6, 0xee, 0xf0, 0xbf, 0x00, 0x02, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0xd8, 0xf1, 0xeb, 0xca, 0xd1, 0xc9, 0xbe, 0xce, 0xcc, 0xc8, 0xce, 0xce, 0xc8, 0xcc, 0xc8, 0xc6, 0xbe, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc9, 0xc5, 0xc9, 0xc8, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc3, 0xc8, 0xc8, 0xc8, 0xc2, 0xc6, 0xcb, 0xc6, 0xc2, 0xc2, 0xc8, 0xcc, 0xc1, 0xbd, 0xd1, 0xd2, 0xe6, 0xe9, 0xf1, 0xed, 0xa5, 0xe4, 0xfc, 0xaf, 0x00, 0xb5, 0xab, 0x00, 0xaa, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x61, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xac, 0xfb, 0xa4, 0x60, 0x97, 0xa2, 0x5f, 0x5a, 0x54, 0x2b, 0x2e, 0x33, 0x38, 0x45, 0x31, 0x31, 0x43, 0x32, 0x2a, 0x2f, 0x2e, 0x26, 0x42, 0x51, 0x58, 0x5d, 0x5e, 0x5a, 0x4d, 0xff, 0x03, 0x00, 0x00, 0xaa, 0xab, 0xb5, 0xab, 0x00, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xaa, 0xab, 0xab, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xad, 0xfe, 0xfd, 0xef, 0xf2, 0xf1, 0xea, 0xe7, 0xe3, 0xe1, 0xde, 0xe3, 0xe6, 0xe7, 0xee, 0xf3, 0xf0, 0xe9, 0xfb, 0xfe, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0xb5, 0xaa, 0xb7, 0xe9, 0xf1, 0xe7, 0xd6, 0xc0, 0xca, 0xd0, 0xd3, 0xc3, 0xc6, 0xc6, 0xc6, 0xc6, 0xcb, 0xc6, 0xc2, 0xbe, 0xc3, 0xc3, 0xc3, 0xcc, 0xd3, 0xbe, 0xbd, 0xca, 0xd6, 0xea, 0xf1, 0xe9, 0xb7, 0x00, 0x62, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa8, 0x61, 0x00, 0xa8, 0xfa, 0xe9, 0xf0, 0xde, 0xbd, 0xd0, 0xc1, 0xd3, 0xcb, 0xc3, 0xc3, 0xce, 0xc8, 0xbe, 0xc2, 0xc3, 0xcb, 0xc6, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc9, 0xc5, 0xc9, 0xc5, 0xc8, 0xc8, 0xc2, 0xc8, 0xc3, 0xc6, 0xc6, 0xc8, 0xc6, 0xc8, 0xc8, 0xc8, 0xc2, 0xcb, 0xce, 0xc3, 0xc8, 0xcd, 0xcd, 0xbd, 0xc7, 0xde, 0xeb, 0xa5, 0x01, 0xa5, 0xef, 0xa7, 0xa7, 0x9e, 0xfb, 0xaa, 0x00, 0xab, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xab, 0xaa, 0xb5, 0xfe, 0xfd, 0x60, 0x60, 0x5e, 0xa1, 0x50, 0x29, 0x27, 0x3b, 0x2d, 0x3c, 0x31, 0x3c, 0x43, 0x37, 0x24, 0x24, 0x3a, 0x48, 0x54, 0x5b, 0x5e, 0x5e, 0x55, 0x23, 0x04, 0x62, 0xa6, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0xa6, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x02, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xfb, 0xed, 0xf1, 0xec, 0xe7, 0xde, 0xd6, 0xbd, 0xbb, 0xc4, 0xbd, 0xbd, 0xc0, 0xd2, 0xd7, 0xe1, 0xeb, 0xf3, 0xf1, 0xe0, 0xa9, 0x00, 0xa6, 0xad, 0xa6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xaa, 0xa9, 0x00, 0xdc, 0xf0, 0xeb, 0xd7, 0xc7, 0xd4, 0xc4, 0xc9, 0xce, 0xbe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xcc, 0xc5, 0xc8, 0xc3, 0xc3, 0xc6, 0xc8, 0xc8, 0xc9, 0xc9, 0xd0, 0xc0, 0xd7, 0xea, 0xf0, 0xdc, 0x61, 0x62, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0xf7, 0xf0, 0xee, 0xd4, 0xbd, 0xcd, 0xcc, 0xc6, 0xc3, 0xc6, 0xc6, 0xc3, 0xc8, 0xc3, 0xc8, 0xc2, 0xc8, 0xc3, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xcb, 0xc3, 0xcb, 0xc6, 0xce, 0xcb, 0xc6, 0xc8, 0xc3, 0xc3, 0xc8, 0xcc, 0xc5, 0xd0, 0xc5, 0xd0, 0xcd, 0xbd, 0xca, 0xdd, 0xe6, 0xa5, 0xa5, 0xf0, 0xa5, 0x01, 0x1e, 0x04, 0xe0, 0xa0, 0x9e, 0xb3, 0xad, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0x61, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xaa, 0xf4, 0xbf, 0xef, 0x5c, 0xa1, 0x28, 0x29, 0x27, 0x33, 0x37, 0x2d, 0x43, 0x43, 0x2a, 0x2a, 0x27, 0x3a, 0x4c, 0x54, 0x5b, 0x5f, 0x5f, 0x4d, 0xfc, 0xf6, 0x00, 0x00, 0xb5, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x61, 0x61, 0x00, 0xa8, 0xac, 0xad, 0xb5, 0x00, 0x00, 0x62, 0x02, 0x62, 0x62, 0x61, 0x00, 0x61, 0xf4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x62, 0x62, 0x62, 0xda, 0xed, 0xf1, 0xe9, 0xde, 0xd2, 0xbb, 0xbd, 0xc4, 0xcd, 0xd0, 0xbe, 0xd0, 0xd0, 0xcd, 0xc0, 0xd1, 0xdb, 0xe1, 0xf0, 0xee, 0xfd, 0xae, 0xa6, 0x00, 0xfa, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xaa, 0xb0, 0xe8, 0xf1, 0xe1, 0xd1, 0xc4, 0xd0, 0xc5, 0xc5, 0xce, 0xc6, 0xc6, 0xc6, 0xc6, 0xc8, 0xcc, 0xc9, 0xc1, 0xc9, 0xc2, 0xc6, 0xc3, 0xc6, 0xc6, 0xc8, 0xcc, 0xcd, 0xca, 0xc0, 0xe1, 0xf2, 0xe9, 0x03, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0xa8, 0x61, 0xcf, 0xf3, 0xe7, 0xca, 0xc4, 0xc9, 0xc5, 0xc3, 0xcb, 0xc6, 0xc6, 0xcb, 0xc8, 0xc8, 0xc8, 0xc6, 0xc6, 0xc2, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc2, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc3, 0xc6, 0xc3, 0xc3, 0xc5, 0xc8, 0xc5, 0xbe, 0xd0, 0xca, 0xca, 0xbd, 0xbd, 0xdd, 0xea, 0xee, 0xf2, 0xec, 0xa7, 0xa4, 0x5c, 0x9d, 0x65, 0x65, 0x89, 0x9c, 0x9d, 0x9e, 0xbc, 0xfa, 0xb5, 0xb5, 0xaa, 0xaa, 0xaa, 0xa8, 0xf9, 0x00, 0x61, 0xf9, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xaa, 0x61, 0xb7, 0x9e, 0x5f, 0x54, 0x2b, 0x27, 0x3b, 0x3c, 0x31, 0x2d, 0x2f, 0x40, 0x2e, 0x29, 0x48, 0x51, 0x5d, 0x5f, 0x5c, 0xfd, 0xbf, 0xfa, 0x00, 0x00, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa6, 0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x61, 0x62, 0xf4, 0x02, 0xaa, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x02, 0x62, 0x02, 0xa8, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x62, 0x62, 0x00, 0xfb, 0xf2, 0xf3, 0xe7, 0xd6, 0xc7, 0xbb, 0xc1, 0xcd, 0xd3, 0xc2, 0xbe, 0xc2, 0xcb, 0xd3, 0xc9, 0xbe, 0xbd, 0xc4, 0xd1, 0xde, 0xf1, 0xf0, 0xdf, 0xa9, 0xa6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xaa, 0xd5, 0x01, 0xea, 0xd4, 0xc4, 0xc1, 0xc9, 0xc9, 0xc3, 0xc6, 0xc6, 0xc6, 0xc2, 0xc8, 0xc5, 0xc9, 0xcd, 0xc4, 0xcd, 0xc3, 0xc3, 0xc6, 0xc6, 0xc6, 0xcb, 0xc8, 0xcc, 0xd0, 0xbb, 0xd1, 0xee, 0xf3, 0xd5, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa8, 0x00, 0x00, 0x02, 0xf8, 0xf3, 0xe3, 0xbb, 0xd4, 0xc5, 0xbe, 0xce, 0xce, 0xc6, 0xc3, 0xc6, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc3, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc2, 0xcb, 0xc3, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xcb, 0xce, 0xc8, 0xc5, 0xc5, 0xd0, 0xcd, 0xc1, 0xc7, 0xc0, 0xbb, 0xd9, 0xea, 0xf0, 0xee, 0xf1, 0xda, 0xbc, 0x53, 0x60, 0x9f, 0x82, 0x73, 0x64, 0x65, 0x6d, 0x9b, 0xa0, 0xa2, 0xcf, 0xf5, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0xf9, 0x61, 0x61, 0x02, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xaa, 0xf4, 0xda, 0x60, 0x57, 0x3a, 0x2e, 0x3b, 0x37, 0x43, 0x3b, 0x2e, 0x26, 0x4a, 0x58, 0x5d, 0x5f, 0x5c, 0x1e, 0xf7, 0xb5, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0xab, 0xab, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x61, 0x00, 0xac, 0xb8, 0xfb, 0xd8, 0xd8, 0xda, 0xd5, 0xbc, 0xb1, 0xad, 0x00, 0x00, 0xf4, 0xa8, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x62, 0x61, 0xf6, 0xe9, 0xf2, 0xe5, 0xd6, 0xbb, 0xc0, 0xd0, 0xd0, 0xc8, 0xbe, 0xc2, 0xcb, 0xc6, 0xc2, 0xc2, 0xc8, 0xcc, 0xcc, 0xc4, 0xc1, 0xc0, 0xde, 0xee, 0xf1, 0xd5, 0xa6, 0xa6, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xe5, 0xf3, 0xe1, 0xc0, 0xcc, 0xc9, 0xc5, 0xce, 0xc8, 0xc3, 0xc8, 0xcb, 0xc8, 0xc8, 0xc9, 0xc9, 0xc4, 0xcd, 0xc4, 0xc8, 0xc3, 0xc3, 0xc6, 0xc6, 0xcb, 0xc8, 0xcc, 0xd0, 0xd0, 0xbb, 0xe1, 0xf2, 0xe8, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x02, 0x00, 0x61, 0x00, 0xf8, 0xf2, 0xe3, 0xbb, 0xd4, 0xcd, 0xbe, 0xce, 0xce, 0xc3, 0xc6, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc6, 0xc2, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc3, 0xc3, 0xc3, 0xcb, 0xc3, 0xcb, 0xcb, 0xcb, 0xc3, 0xc5, 0xcd, 0xc9, 0xc4, 0xc4, 0xca, 0xd1, 0xc7, 0xd9, 0xea, 0xf0, 0xee, 0xf2, 0xe2, 0xb9, 0xf4, 0x41, 0x5f, 0x9f, 0x8c, 0x73, 0x78, 0x72, 0x6a, 0x64, 0x6d, 0x99, 0xa2, 0xa0, 0xcf, 0xf5, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x61, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb2, 0x55, 0x5d, 0x4c, 0x26, 0x2e, 0x27, 0x27, 0x3a, 0x42, 0x5b, 0x57, 0x5e, 0x59, 0x23, 0xb2, 0x02, 0xaa, 0xab, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0xa8, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb5, 0xac, 0xb9, 0xdf, 0xee, 0xee, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xdf, 0xcf, 0xf5, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xad, 0x00, 0xdf, 0xf2, 0xeb, 0xd1, 0xc7, 0xd0, 0xcd, 0xc5, 0xc3, 0xbe, 0xc3, 0xcb, 0xcb, 0xce, 0xc2, 0xc2, 0xc2, 0xce, 0xce, 0xcc, 0xbe, 0xbd, 0xd1, 0xe6, 0xeb, 0xed, 0xb8, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xaa, 0xb0, 0xf0, 0xed, 0xd9, 0xbd, 0xd3, 0xce, 0xbe, 0xd3, 0xcb, 0xc2, 0xc3, 0xc8, 0xc5, 0xc8, 0xc5, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc8, 0xc8, 0xc3, 0xc6, 0xc6, 0xc8, 0xc9, 0xd0, 0xbb, 0xd9, 0xee, 0xf2, 0xb8, 0xa8, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x02, 0xa8, 0x00, 0x00, 0x17, 0xf3, 0xe7, 0xbb, 0xd1, 0xcd, 0xc9, 0xc8, 0xc3, 0xc3, 0xcb, 0xc3, 0xc8, 0xc8, 0xc8, 0xc2, 0xcb, 0xc3, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc3, 0xc8, 0xc3, 0xcb, 0xc8, 0xc8, 0xcc, 0xc9, 0xcd, 0xca, 0xd0, 0xc0, 0xbb, 0xc7, 0xd9, 0xe6, 0xec, 0xf2, 0xf0, 0xe2, 0xba, 0xaa, 0xf4, 0xd5, 0x5c, 0x5f, 0x91, 0x6a, 0x81, 0x68, 0x87, 0x76, 0x67, 0x66, 0x82, 0x97, 0x9d, 0x53, 0x17, 0xfe, 0x00, 0xab, 0xf4, 0x00, 0x00, 0xf9, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0xac, 0xf8, 0x5f, 0x54, 0x28, 0x2b, 0x2b, 0x3a, 0x56, 0x5b, 0x5d, 0x5c, 0xe0, 0xb8, 0x00, 0x00, 0x62, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xad, 0x00, 0xb8, 0xe2, 0xf2, 0xf2, 0xee, 0xf0, 0xe7, 0xe6, 0xe3, 0xe3, 0xea, 0xf0, 0xf1, 0xee, 0x41, 0xba, 0x62, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xb1, 0xf0, 0xee, 0xdb, 0xd1, 0xcd, 0xcd, 0xc5, 0xc8, 0xc5, 0xcb, 0xce, 0xc2, 0xbe, 0xc2, 0xcc, 0xc8, 0xc8, 0xc2, 0xc3, 0xc2, 0xcc, 0xcd, 0xca, 0xc7, 0xea, 0xf3, 0xb4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0xaa, 0xbf, 0xf3, 0xe8, 0xd6, 0xbd, 0xce, 0xc8, 0xbe, 0xce, 0xce, 0xc2, 0xc5, 0xc8, 0xc8, 0xc5, 0xcc, 0xc5, 0xc9, 0xc9, 0xc5, 0xc9, 0xc9, 0xc5, 0xc8, 0xc8, 0xc6, 0xc8, 0xc8, 0xc5, 0xcd, 0xbd, 0xd6, 0xea, 0xf2, 0xb3, 0xaa, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xa8, 0x61, 0x00, 0xbc, 0x01, 0xea, 0xd6, 0xc0, 0xca, 0xcd, 0xc5, 0xc3, 0xc8, 0xc3, 0xc8, 0xc8, 0xc5, 0xc8, 0xc8, 0xc6, 0xc8, 0xc3, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc9, 0xc9, 0xc9, 0xbd, 0xc4, 0xc7, 0xd7, 0xdd, 0xe7, 0xee, 0xf3, 0xec, 0xe2, 0xbc, 0xac, 0xaa, 0xf9, 0xfe, 0x60, 0xa2, 0x9a, 0x82, 0x86, 0x68, 0x87, 0x77, 0x70, 0x70, 0x6e, 0x66, 0x66, 0x99, 0x49, 0xa4, 0x17, 0xb6, 0x00, 0xb5, 0x00, 0x00, 0x61, 0x61, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x00, 0xaa, 0xb3, 0x53, 0x5c, 0x3f, 0x30, 0x4f, 0x5a, 0x5d, 0x5d, 0x3f, 0x04, 0xaa, 0xab, 0xae, 0xa8, 0xf9, 0x02, 0x00, 0x61, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0xa8, 0x61, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xaa, 0x00, 0xbf, 0xed, 0xf1, 0xeb, 0xe5, 0xdb, 0xc7, 0xc7, 0xc0, 0xc7, 0xc0, 0xd2, 0xd9, 0xe6, 0xee, 0xf3, 0x53, 0xbc, 0xf4, 0x02, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xdc, 0xee, 0xe7, 0xbb, 0xd4, 0xcd, 0xc5, 0xd3, 0xce, 0xc3, 0xbe, 0xc2, 0xce, 0xd3, 0xc1, 0xc9, 0xcd, 0xc8, 0xc3, 0xc3, 0xc3, 0xd3, 0xce, 0xbb, 0xbd, 0xde, 0xf2, 0xe8, 0xf6, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xab, 0xda, 0xf2, 0xe5, 0xd2, 0xc5, 0xcc, 0xc2, 0xc2, 0xc8, 0xcc, 0xc2, 0xcc, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc6, 0xc5, 0xc9, 0xcd, 0xc9, 0xc5, 0xc8, 0xc3, 0xc6, 0xc8, 0xcc, 0xbe, 0xd1, 0xc0, 0xe6, 0xf1, 0xd8, 0x00, 0xaa, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xe9, 0xee, 0xe1, 0xc0, 0xd1, 0xc1, 0xc9, 0xc5, 0xce, 0xc8, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc6, 0xc2, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xcc, 0xcc, 0xcc, 0xc5, 0xcc, 0xc5, 0xc9, 0xc5, 0xbb, 0xca, 0xd6, 0xdd, 0xe5, 0xee, 0xf2, 0xf1, 0xfd, 0xfb, 0xae, 0x00, 0xb5, 0x61, 0xfa, 0x23, 0xa2, 0xa3, 0x88, 0x67, 0x76, 0x85, 0x77, 0x69, 0x6f, 0x85, 0x68, 0x66, 0x6d, 0x6d, 0x97, 0x9e, 0xa7, 0xcf, 0xad, 0x00, 0xa6, 0x61, 0xa6, 0xa6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0xf9, 0x61, 0x62, 0x00, 0xad, 0xb7, 0xf8, 0x01, 0xa5, 0xa0, 0x60, 0x5f, 0x4d, 0xff, 0x02, 0x61, 0xab, 0xab, 0xab, 0x00, 0xf9, 0xf9, 0xf9, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf9, 0x61, 0x00, 0xac, 0xb6, 0xb8, 0xb3, 0xf7, 0xf6, 0xae, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0xa8, 0xcf, 0xe8, 0xf3, 0xea, 0xd9, 0xc0, 0xc7, 0xc7, 0xd1, 0xc0, 0xc7, 0xd6, 0xc7, 0xbb, 0xc7, 0xdb, 0xe8, 0xf2, 0xed, 0xfb, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xea, 0xee, 0xe3, 0xc4, 0xbb, 0xd3, 0xc5, 0xc3, 0xce, 0xc3, 0xc8, 0xce, 0xcc, 0xbe, 0xcc, 0xc9, 0xc5, 0xc9, 0xcc, 0xce, 0xc3, 0xbe, 0xce, 0xcd, 0xd0, 0xd6, 0xe7, 0xf2, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xaa, 0xdc, 0xf0, 0xe5, 0xc0, 0xca, 0xcb, 0xcc, 0xc2, 0xcc, 0xc2, 0xcc, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc6, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xbe, 0xd4, 0xbb, 0xe1, 0xf3, 0xe5, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xf1, 0xeb, 0xc7, 0xd6, 0xbd, 0xcd, 0xcc, 0xce, 0xc8, 0xc8, 0xc8, 0xc8, 0xc2, 0xcb, 0xc3, 0xcb, 0xc3, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xcc, 0xcd, 0xcd, 0xcd, 0xc4, 0xc4, 0xc4, 0xc7, 0xd7, 0xe1, 0xea, 0xee, 0xf2, 0xf0, 0xdf, 0xf7, 0xa9, 0xa6, 0xa6, 0xaa, 0x02, 0x02, 0x04, 0x5c, 0x5c, 0x92, 0x67, 0x87, 0x70, 0x79, 0x77, 0x83, 0x77, 0x6f, 0x71, 0x70, 0x66, 0x64, 0x6d, 0x97, 0x53, 0xe4, 0xb3, 0xa8, 0xaa, 0xa6, 0x00, 0x61, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xb5, 0x00, 0xa8, 0xaa, 0xaa, 0xf6, 0xfc, 0xef, 0xa5, 0xa5, 0xef, 0x17, 0xfa, 0x61, 0xf9, 0xa8, 0xaa, 0xaa, 0xaa, 0x00, 0xf9, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0xaf, 0xb3, 0xe4, 0xea, 0xf0, 0xf2, 0xf1, 0xed, 0xe8, 0xd5, 0xf5, 0x02, 0x61, 0xf9, 0x00, 0x02, 0x00, 0x00, 0xa8, 0x00, 0x61, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xfa, 0x00, 0xf7, 0xec, 0xf1, 0xe6, 0xd2, 0xc7, 0xc4, 0xbe, 0xd3, 0xcc, 0xcc, 0xcc, 0xc9, 0xcd, 0xc9, 0xc4, 0xca, 0xd6, 0xe6, 0xf1, 0xf1, 0xb9, 0x00, 0x62, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x61, 0x00, 0xf7, 0xf3, 0xeb, 0xd7, 0xc4, 0xc5, 0xc9, 0xc9, 0xc5, 0xc9, 0xc9, 0xcc, 0xc5, 0xc8, 0xc8, 0xc6, 0xc6, 0xc8, 0xc5, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc5, 0xcd, 0xd1, 0xe3, 0xf0, 0x41, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xdf, 0xf1, 0xfd, 0xc0, 0xc9, 0xcc, 0xc2, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc2, 0xc2, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xbe, 0xd0, 0xc0, 0xdb, 0xf2, 0xe9, 0x61, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xad, 0xfe, 0xf1, 0xf0, 0xe2, 0xc7, 0xd2, 0xcd, 0xbb, 0xd3, 0xc2, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc3, 0xc3, 0xc8, 0xce, 0xc8, 0xc3, 0xc3, 0xc5, 0xcb, 0xbe, 0xce, 0xd3, 0xc3, 0xbe, 0xc8, 0xce, 0xbe, 0xd0, 0xca, 0xc4, 0xc0, 0xc0, 0xd1, 0xdb, 0xe6, 0xee, 0xf1, 0xf2, 0xee, 0xdc, 0xb2, 0xab, 0xaa, 0x61, 0xa6, 0xb5, 0xaa, 0xa8, 0xf4, 0x41, 0x5c, 0x9a, 0x74, 0x70, 0x81, 0x7d, 0x85, 0x6f, 0x6f, 0x79, 0x6f, 0x7b, 0x7d, 0x68, 0x66, 0x64, 0x82, 0x99, 0xa7, 0xe4, 0xb1, 0xa8, 0xaa, 0x02, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xa9, 0xbc, 0x4e, 0xa7, 0xef, 0x41, 0xb2, 0x00, 0x00, 0xad, 0xa8, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x61, 0x00, 0x03, 0xfd, 0xf2, 0xf0, 0xf0, 0xeb, 0xe7, 0xee, 0xeb, 0xf2, 0xf2, 0xe2, 0xfb, 0xf9, 0x61, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xae, 0xdf, 0xf1, 0xea, 0xd9, 0xc0, 0xcd, 0xd3, 0xbe, 0xc6, 0xc6, 0xc8, 0xc8, 0xc8, 0xc5, 0xc5, 0xc5, 0xc1, 0xca, 0xd6, 0xe7, 0xf1, 0xdf, 0xf5, 0xf9, 0x62, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf9, 0xff, 0xf2, 0xea, 0xd1, 0xc4, 0xc1, 0xce, 0xc5, 0xcc, 0xc9, 0xc9, 0xc5, 0xc8, 0xc8, 0xc6, 0xc6, 0xc6, 0xc2, 0xcc, 0xc9, 0xc4, 0xc9, 0xc9, 0xc8, 0xc5, 0xc9, 0xc4, 0xde, 0xf0, 0xe8, 0xf4, 0xa6, 0xaa, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0xaa, 0xaa, 0xdf, 0xf0, 0xe1, 0xc7, 0xc4, 0xc8, 0xc8, 0xc8, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc2, 0xcc, 0xc2, 0xc2, 0xc2, 0xc2, 0xc8, 0xc5, 0xcc, 0xc5, 0xc8, 0xc5, 0xbe, 0xd0, 0xc4, 0xdd, 0xf2, 0xe9, 0xf4, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xf4, 0xbf, 0xf2, 0xf3, 0xdd, 0xc7, 0xc7, 0xd4, 0xbe, 0xd3, 0xcb, 0xc2, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xcb, 0xc8, 0xc8, 0xc3, 0xc8, 0xc5, 0xce, 0xcc, 0xd3, 0xcc, 0xbe, 0xbe, 0xcc, 0xd3, 0xd3, 0xd0, 0xc4, 0xc0, 0xc7, 0xd7, 0xe1, 0xeb, 0xf0, 0xf0, 0xf3, 0xe4, 0xcf, 0xb8, 0xac, 0xaa, 0xaa, 0xa9, 0x62, 0x62, 0x61, 0xac, 0x00, 0xba, 0xa3, 0x5c, 0x92, 0x70, 0x7d, 0x7d, 0x70, 0x85, 0x75, 0x6f, 0x6f, 0x79, 0x71, 0x7b, 0x71, 0x68, 0x67, 0x6a, 0x8d, 0x9c, 0xa7, 0xb4, 0xae, 0xaa, 0x00, 0xb5, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xa9, 0x00, 0xac, 0xb6, 0xd5, 0xe9, 0xed, 0x01, 0xd5, 0x00, 0x61, 0xfa, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0xb5, 0x61, 0x00, 0x03, 0xe8, 0xf1, 0xf1, 0xe3, 0xdb, 0xd6, 0xd6, 0xd2, 0xd9, 0xe3, 0xec, 0xf2, 0xef, 0xbf, 0xa8, 0x61, 0x61, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0xb5, 0x00, 0x00, 0xba, 0x01, 0xee, 0xde, 0xc0, 0xbd, 0xd0, 0xc8, 0xc3, 0xc3, 0xcb, 0xcb, 0xc8, 0xc8, 0xc5, 0xcc, 0xc5, 0xc9, 0xca, 0xbb, 0xdd, 0xeb, 0xf3, 0xbc, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x61, 0x61, 0xda, 0xf2, 0xe6, 0xc7, 0xcd, 0xc5, 0xcc, 0xcc, 0xc2, 0xc9, 0xc5, 0xcc, 0xc8, 0xc8, 0xc6, 0xc6, 0xc6, 0xcb, 0xc5, 0xc9, 0xc9, 0xc9, 0xcc, 0xcc, 0xc3, 0xcd, 0xbd, 0xd9, 0xf0, 0xa7, 0xb6, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xab, 0xdf, 0xf1, 0xdf, 0xd2, 0xcd, 0xc5, 0xcc, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xcc, 0xc5, 0xcc, 0xc2, 0xc2, 0xc2, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc2, 0xc2, 0xd0, 0xc0, 0xe1, 0xf1, 0xe4, 0xf4, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xda, 0xed, 0xf3, 0xe3, 0xc0, 0xbd, 0xd0, 0xcc, 0xbe, 0xc2, 0xc2, 0xcb, 0xc8, 0xc2, 0xc8, 0xc8, 0xc3, 0xc5, 0xc3, 0xc5, 0xc5, 0xc5, 0xbe, 0xc1, 0xc1, 0xd4, 0xd4, 0xca, 0xbd, 0xbd, 0xc7, 0xd1, 0xde, 0xe6, 0xeb, 0xee, 0xf1, 0xec, 0xe4, 0xba, 0xb8, 0xac, 0x00, 0x00, 0xaa, 0xaa, 0xa8, 0x62, 0x00, 0x00, 0xf4, 0x61, 0xe0, 0x60, 0x9d, 0x78, 0x6b, 0x85, 0x7d, 0x70, 0x7d, 0x6f, 0x79, 0x6f, 0x6c, 0x6c, 0x7a, 0x7d, 0x70, 0x6b, 0x66, 0x65, 0x91, 0x9e, 0xa7, 0xfb, 0xae, 0x61, 0xa8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x00, 0xac, 0xf6, 0xfd, 0xed, 0x01, 0xe4, 0xfe, 0x00, 0x02, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x61, 0x61, 0x00, 0xad, 0xe4, 0xf1, 0xec, 0xd7, 0xc0, 0xd2, 0xbb, 0xbb, 0xd1, 0xbb, 0xbb, 0xd9, 0xea, 0xf1, 0xf1, 0xb2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xb4, 0xf3, 0xe5, 0xd6, 0xbb, 0xd0, 0xd0, 0xc3, 0xbe, 0xc6, 0xc8, 0xc3, 0xc8, 0xc5, 0xcc, 0xc2, 0xc8, 0xc5, 0xd0, 0xca, 0xc7, 0xe3, 0xf2, 0xe2, 0x02, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xfd, 0xf2, 0xe3, 0xc0, 0xd0, 0xc5, 0xc2, 0xc3, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc3, 0xcb, 0xc6, 0xc6, 0xc2, 0xcc, 0xc9, 0xc9, 0xc5, 0xc8, 0xcb, 0xc3, 0xd3, 0xc4, 0xd7, 0xee, 0xed, 0xb7, 0x00, 0xaa, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa8, 0x00, 0xaa, 0xda, 0xf2, 0xe5, 0xd2, 0xc4, 0xcc, 0xc5, 0xcc, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc3, 0xc8, 0xc5, 0xc8, 0xc5, 0xcc, 0xc5, 0xc2, 0xc2, 0xcb, 0xc2, 0xc8, 0xc3, 0xcb, 0xc3, 0xc8, 0xcc, 0xc4, 0xbd, 0xe1, 0xf3, 0xf8, 0xf9, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x61, 0x00, 0xf4, 0xf8, 0xeb, 0xf0, 0xeb, 0xd1, 0xc7, 0xca, 0xc4, 0xd0, 0xd4, 0xd3, 0xc1, 0xc5, 0xd3, 0xc5, 0xc8, 0xce, 0xd3, 0xd3, 0xd0, 0xd0, 0xd0, 0xd4, 0xd1, 0xca, 0xbb, 0xbb, 0xc7, 0xdd, 0xe3, 0xee, 0xf0, 0xf2, 0xf0, 0xe9, 0xdc, 0xb9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x02, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xef, 0xa3, 0x90, 0x6b, 0x70, 0x85, 0x7d, 0x7d, 0x7d, 0x69, 0x77, 0x6f, 0x71, 0x75, 0x71, 0x7c, 0x81, 0x6e, 0x64, 0x64, 0x6d, 0x97, 0xa7, 0x9c, 0xb1, 0x02, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xac, 0x00, 0xac, 0xb7, 0x41, 0xf1, 0xa5, 0xda, 0xfa, 0xa8, 0x61, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0xa8, 0x00, 0xaa, 0xd5, 0xf0, 0xee, 0xd8, 0xbb, 0xd1, 0xbb, 0xd7, 0xd4, 0xbd, 0xd4, 0xd1, 0xbb, 0xd6, 0xea, 0xf0, 0xfd, 0xad, 0x61, 0xa8, 0x00, 0x00, 0x61, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xaa, 0xb7, 0xe9, 0xf0, 0xdd, 0xca, 0xc1, 0xd4, 0xc5, 0xc3, 0xcb, 0xc6, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc9, 0xd4, 0xbb, 0xd9, 0xeb, 0xf2, 0xb7, 0x62, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0xfd, 0xf3, 0xe3, 0xc0, 0xd0, 0xc3, 0xc2, 0xc6, 0xc6, 0xc6, 0xc2, 0xc8, 0xc8, 0xc8, 0xc8, 0xc6, 0xc6, 0xc8, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc6, 0xc3, 0xd3, 0xbd, 0xd7, 0xee, 0xa4, 0xb7, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0xaa, 0xcf, 0xf3, 0xe9, 0xd2, 0xca, 0xc9, 0xc9, 0xc5, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc9, 0xc8, 0xc9, 0xc5, 0xcc, 0xc2, 0xc2, 0xc2, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc8, 0xcc, 0xc1, 0xc0, 0xe7, 0xf3, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0xb5, 0x02, 0xb5, 0x00, 0xd8, 0xee, 0xee, 0xf0, 0xde, 0xd6, 0xc0, 0xbd, 0xbd, 0xbd, 0xc1, 0xc4, 0xd0, 0xc5, 0xc9, 0xcd, 0xc1, 0xbd, 0xbd, 0xc4, 0xc0, 0xc0, 0xc7, 0xd9, 0xde, 0xea, 0xf0, 0xf3, 0xf0, 0xf1, 0xe9, 0xdf, 0xba, 0xaf, 0x00, 0x00, 0x62, 0xf9, 0x62, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf9, 0x00, 0xf9, 0x02, 0x00, 0x17, 0x01, 0x9d, 0x82, 0x6e, 0x7b, 0x7d, 0x7a, 0x7d, 0x7a, 0x69, 0x79, 0x6c, 0x75, 0x75, 0x71, 0x7a, 0x7b, 0x70, 0x67, 0x66, 0x65, 0x8d, 0x9c, 0xa4, 0xbf, 0x02, 0x02, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa8, 0xf6, 0x9e, 0xf2, 0xa7, 0xbc, 0xfa, 0xaa, 0x61, 0x02, 0x61, 0x61, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x61, 0x00, 0x00, 0xa8, 0x00, 0xaf, 0xe8, 0xf2, 0xde, 0xbb, 0xd6, 0xbd, 0xcd, 0xbe, 0xbe, 0xbe, 0xc9, 0xc4, 0xd1, 0xd1, 0xd7, 0xee, 0xf0, 0xb2, 0x00, 0xa8, 0x00, 0x61, 0xaa, 0x00, 0x61, 0xa6, 0x00, 0xaa, 0x00, 0xb2, 0xef, 0xf0, 0xd7, 0xc4, 0xc1, 0xc9, 0xc3, 0xc8, 0xd3, 0xc6, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc8, 0xc6, 0xc8, 0xbe, 0xd0, 0xbd, 0xd6, 0xeb, 0xf1, 0xba, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0xb4, 0xf3, 0xe3, 0xc0, 0xcd, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xcb, 0xc2, 0xc8, 0xc8, 0xc2, 0xc6, 0xc8, 0xc8, 0xc8, 0xc8, 0xc6, 0xc6, 0xcb, 0xc3, 0xc9, 0xbd, 0xd9, 0xef, 0xec, 0xb7, 0x00, 0xaa, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x00, 0xb2, 0xf1, 0xee, 0xdb, 0xca, 0xc9, 0xc9, 0xc9, 0xc8, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc9, 0xc9, 0xc8, 0xc8, 0xc2, 0xcb, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xcc, 0xbd, 0xd7, 0xeb, 0xf0, 0xb3, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0xaa, 0xad, 0xaa, 0xb2, 0xe5, 0xf1, 0xf0, 0xea, 0xe3, 0xdb, 0xd6, 0xd1, 0xc7, 0xc7, 0xbb, 0xbd, 0xc1, 0xbd, 0xc4, 0xca, 0xd6, 0xd9, 0xdd, 0xe6, 0xeb, 0xed, 0xf0, 0xf1, 0xf1, 0xe9, 0xe0, 0xb3, 0xb0, 0xb5, 0xaa, 0xa8, 0xf9, 0x61, 0xf9, 0x00, 0x61, 0x00, 0x61, 0x61, 0x61, 0xa6, 0x61, 0x00, 0x61, 0xf9, 0x02, 0x4e, 0x60, 0x96, 0x6a, 0x76, 0x71, 0x6c, 0x7a, 0x7d, 0x7a, 0x6c, 0x77, 0x6c, 0x7a, 0x7a, 0x75, 0x71, 0x7a, 0x76, 0x6e, 0x66, 0x64, 0x65, 0x97, 0xa4, 0xe0, 0xf6, 0xf4, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0xa8, 0xb9, 0xfd, 0x01, 0xe9, 0xf7, 0xfa, 0x00, 0x00, 0x61, 0x61, 0xa8, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa8, 0x00, 0x61, 0x61, 0x00, 0xb9, 0xee, 0xeb, 0xdb, 0xbb, 0xd4, 0xd0, 0xcc, 0xc3, 0xd3, 0xbe, 0xc5, 0xcc, 0xc1, 0xc4, 0xd4, 0xe6, 0xf2, 0x17, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa8, 0x61, 0x00, 0xaa, 0xb5, 0x00, 0xb3, 0x01, 0xeb, 0xd6, 0xc1, 0xc5, 0xc5, 0xc3, 0xcb, 0xce, 0xc8, 0xc8, 0xc5, 0xcc, 0xc5, 0xc8, 0xc8, 0xc6, 0xcb, 0xcb, 0xc1, 0xd0, 0xc7, 0xea, 0xf0, 0xcf, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x61, 0x62, 0xfc, 0xf3, 0xe7, 0xca, 0xc4, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc8, 0xc2, 0xc8, 0xc8, 0xc2, 0xc8, 0xc2, 0xc8, 0xc3, 0xc6, 0xc6, 0xcb, 0xc3, 0xc5, 0xc0, 0xde, 0xf1, 0x9e, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xae, 0xe8, 0xf0, 0xe3, 0xca, 0xc9, 0xc9, 0xc9, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc3, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc8, 0xc8, 0xc2, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc5, 0xc9, 0xca, 0xde, 0xf0, 0xe4, 0xf5, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xaa, 0xb7, 0xbf, 0xe8, 0xf2, 0xf2, 0xf0, 0xea, 0xe3, 0xde, 0xdd, 0xd7, 0xdb, 0xd9, 0xdd, 0xe1, 0xe6, 0xea, 0xee, 0xf0, 0xf0, 0xf1, 0xf0, 0xe8, 0xf8, 0xfb, 0xb6, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x62, 0x00, 0x61, 0x62, 0x62, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x04, 0xa4, 0xa2, 0x8e, 0x72, 0x7e, 0x6f, 0x6c, 0x75, 0x7c, 0x71, 0x75, 0x79, 0x75, 0x75, 0x7c, 0x75, 0x75, 0x75, 0x71, 0x76, 0x68, 0x67, 0x63, 0x8d, 0x9d, 0x53, 0xbc, 0xae, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0x01, 0xa7, 0xb9, 0x00, 0xaa, 0xb5, 0x00, 0x02, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0xa8, 0x61, 0xa8, 0xbf, 0xf2, 0xe7, 0xc0, 0xd6, 0xc4, 0xbe, 0xc8, 0xd3, 0xc6, 0xc6, 0xcb, 0xbe, 0xc9, 0xc1, 0xbd, 0xe1, 0xf1, 0x9e, 0xaa, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0x00, 0xcf, 0x01, 0xe2, 0xc4, 0xc1, 0xc8, 0xce, 0xc8, 0xc3, 0xc3, 0xc8, 0xc5, 0xc5, 0xc5, 0xc9, 0xc8, 0xc8, 0xc6, 0xcb, 0xc8, 0xc5, 0xca, 0xbd, 0xe3, 0xf1, 0xdc, 0xaa, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0xa6, 0x61, 0x00, 0xba, 0xf3, 0xea, 0xd6, 0xc4, 0xc9, 0xc2, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xcb, 0xc6, 0xc6, 0xc6, 0xcb, 0xc8, 0xcd, 0xd1, 0xe3, 0xf1, 0xe4, 0x61, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xdf, 0xef, 0xeb, 0xc7, 0xcd, 0xc9, 0xc9, 0xc9, 0xc8, 0xc8, 0xc3, 0xcb, 0xc6, 0xc8, 0xc6, 0xc8, 0xc8, 0xc8, 0xc5, 0xcc, 0xc2, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc8, 0xcc, 0xc4, 0xd1, 0xe6, 0xf1, 0xf8, 0x00, 0x62, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0xa6, 0xa8, 0x00, 0x02, 0xf9, 0x00, 0x61, 0xf5, 0xbf, 0xdf, 0xef, 0xf2, 0xf1, 0xf1, 0xa5, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xee, 0xe9, 0xdf, 0xfc, 0xb8, 0xf4, 0x00, 0x00, 0x61, 0x62, 0x62, 0xaa, 0x00, 0x61, 0x62, 0x61, 0x61, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x61, 0x17, 0x5c, 0xa2, 0x82, 0x68, 0x79, 0x79, 0x7f, 0x7f, 0x75, 0x6c, 0x83, 0x6c, 0x75, 0x7a, 0x75, 0x75, 0x77, 0x75, 0x6c, 0x7b, 0x68, 0x67, 0x6a, 0x6d, 0x99, 0xe9, 0x1e, 0xf5, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xa8, 0xb5, 0x61, 0xb8, 0x41, 0xf3, 0xa7, 0xb2, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0xd5, 0xf0, 0xe6, 0xbb, 0xbd, 0xd0, 0xbe, 0xbe, 0xce, 0xc3, 0xc6, 0xcb, 0xbe, 0xc9, 0xcd, 0xc1, 0xdb, 0xee, 0x4e, 0x00, 0xb5, 0x00, 0x02, 0x00, 0x02, 0x00, 0xa6, 0xaa, 0x00, 0xaa, 0xcf, 0x01, 0xe5, 0xca, 0xc5, 0xd3, 0xce, 0xc2, 0xc6, 0xcb, 0xc5, 0xc8, 0xc5, 0xc9, 0xc5, 0xc8, 0xc8, 0xc6, 0xc3, 0xc3, 0xd3, 0xd0, 0xc0, 0xe3, 0xf2, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x61, 0x00, 0x61, 0xb7, 0xed, 0xee, 0xdd, 0xc7, 0xbe, 0xd3, 0xc2, 0xc6, 0xcb, 0xc6, 0xc2, 0xc2, 0xc2, 0xcc, 0xc2, 0xcc, 0xce, 0xc8, 0xc8, 0xc8, 0xc6, 0xc3, 0xc3, 0xd4, 0xbd, 0xd1, 0xeb, 0xef, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xaa, 0x00, 0xb5, 0xb6, 0xef, 0xee, 0xde, 0xd0, 0xbe, 0xc1, 0xd3, 0xc9, 0xc3, 0xc6, 0xce, 0xcb, 0xc6, 0xc3, 0xc3, 0xc8, 0xc8, 0xc8, 0xd3, 0xc5, 0xc8, 0xc8, 0xc2, 0xc6, 0xce, 0xbe, 0xcd, 0xca, 0xde, 0xee, 0xf0, 0xb2, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x61, 0x61, 0x61, 0xf9, 0x00, 0xf4, 0xb0, 0xfb, 0xda, 0xdf, 0xe5, 0xe8, 0xec, 0xe9, 0xe5, 0xdf, 0xd8, 0xfb, 0xf6, 0xae, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x61, 0x41, 0x60, 0x94, 0x72, 0x68, 0x79, 0x77, 0x77, 0x77, 0x7a, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x77, 0x75, 0x77, 0x75, 0x79, 0x68, 0x68, 0x64, 0x65, 0x94, 0xa2, 0x9e, 0xf6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xb7, 0x17, 0xef, 0xa5, 0xb3, 0x02, 0x02, 0x00, 0xaa, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x02, 0xa8, 0x00, 0x00, 0xf4, 0x00, 0x61, 0x00, 0x61, 0x00, 0xa8, 0x00, 0xcf, 0xf1, 0xe7, 0xc7, 0xd1, 0xcd, 0xd3, 0xc6, 0xc3, 0xc6, 0xc6, 0xc6, 0xcb, 0xd3, 0xd0, 0xbd, 0xdd, 0xf2, 0xe9, 0xf9, 0xa8, 0x61, 0x61, 0x00, 0x61, 0xa8, 0x00, 0x00, 0xb5, 0x00, 0xba, 0x01, 0xec, 0xd1, 0xc1, 0xc5, 0xc5, 0xc2, 0xc3, 0xd3, 0xc3, 0xc5, 0xcc, 0xc5, 0xcc, 0xc5, 0xc6, 0xc6, 0xc6, 0xcc, 0xc9, 0xc4, 0xc0, 0xe7, 0xf0, 0xcf, 0xaa, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0xa6, 0x61, 0x00, 0xa8, 0xe2, 0xf1, 0xe7, 0xc7, 0xca, 0xbe, 0xd3, 0xc6, 0xc2, 0xc6, 0xc6, 0xce, 0xc5, 0xbe, 0xc5, 0xc8, 0xc8, 0xc2, 0xc3, 0xce, 0xce, 0xc5, 0xc9, 0xc1, 0xc0, 0xdd, 0xee, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa8, 0xb5, 0xda, 0xf3, 0xea, 0xd7, 0xbd, 0xd4, 0xc1, 0xbe, 0xd3, 0xce, 0xbe, 0xc3, 0xc3, 0xc6, 0xcb, 0xcb, 0xc8, 0xc8, 0xbe, 0xc5, 0xd3, 0xce, 0xc2, 0xc5, 0xcc, 0xc4, 0xd4, 0xbb, 0xee, 0xf1, 0xb4, 0xaf, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x61, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x61, 0xb5, 0xac, 0xac, 0xa9, 0xaf, 0xad, 0x62, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xb7, 0x55, 0x5c, 0x91, 0x6b, 0x76, 0x6f, 0x6f, 0x77, 0x75, 0x77, 0x75, 0x75, 0x71, 0x7a, 0x7a, 0x75, 0x75, 0x77, 0x75, 0x6f, 0x79, 0x69, 0x6b, 0x67, 0x64, 0x8d, 0x9e, 0x9e, 0xb9, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xa8, 0xaa, 0x00, 0xf4, 0xbc, 0xed, 0x01, 0xb4, 0x00, 0x00, 0xad, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x62, 0xaa, 0xfb, 0xf2, 0xe7, 0xd2, 0xca, 0xbb, 0xc5, 0xd3, 0xce, 0xcb, 0xc6, 0xc3, 0xc9, 0xd0, 0xbd, 0xc0, 0xe1, 0xf3, 0x41, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xa8, 0xa8, 0x00, 0xa6, 0xac, 0x00, 0xb8, 0xa5, 0xee, 0xd7, 0xbd, 0xc1, 0xd3, 0xbe, 0xc3, 0xce, 0xc3, 0xc8, 0xc5, 0xcc, 0xc5, 0xc8, 0xc8, 0xc3, 0xc8, 0xc5, 0xc4, 0xc4, 0xd6, 0xee, 0xf0, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x61, 0x00, 0x00, 0x00, 0xb9, 0xf3, 0xf0, 0xdd, 0xc7, 0xc0, 0xc9, 0xcc, 0xc6, 0xc2, 0xc2, 0xbe, 0xcc, 0xcc, 0xcc, 0xcc, 0xc5, 0xc2, 0xc5, 0xcc, 0xc9, 0xc9, 0xd4, 0xbd, 0xd2, 0xea, 0xf1, 0xe0, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xb8, 0xe9, 0xf0, 0xe7, 0xc0, 0xbb, 0xd4, 0xc4, 0xbe, 0xd3, 0xce, 0xce, 0xce, 0xce, 0xce, 0xc3, 0xc2, 0xbe, 0xd3, 0xd0, 0xc5, 0xc1, 0xcc, 0xcd, 0xc1, 0xbd, 0xd1, 0xe7, 0xeb, 0xf3, 0xb6, 0x00, 0xa6, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x61, 0x61, 0x61, 0x61, 0xf4, 0xf9, 0x61, 0x00, 0x00, 0x00, 0xa6, 0x61, 0x62, 0x61, 0x61, 0x00, 0x00, 0x62, 0x62, 0x02, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xf7, 0x5c, 0xa2, 0x8c, 0x68, 0x79, 0x79, 0x77, 0x77, 0x77, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x6f, 0x77, 0x71, 0x6c, 0x68, 0x67, 0x64, 0x89, 0x99, 0xe9, 0xbc, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0xb1, 0xf8, 0x01, 0x4e, 0xf5, 0x00, 0x02, 0x61, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0xa8, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0xa8, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0xb8, 0xf0, 0xf0, 0xd9, 0xd2, 0xd0, 0xbd, 0xce, 0xbe, 0xc3, 0xc3, 0xbe, 0xc9, 0xca, 0xbd, 0xd7, 0xeb, 0xf2, 0xfc, 0x00, 0x00, 0x61, 0x00, 0x00, 0xa6, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xb6, 0xe8, 0xf0, 0xde, 0xc0, 0xc4, 0xd4, 0xcc, 0xbe, 0xcb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc9, 0xca, 0xc0, 0xdd, 0xee, 0xed, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x00, 0xfd, 0xf2, 0xe9, 0xd2, 0xd1, 0xd1, 0xc9, 0xc5, 0xc2, 0xce, 0xce, 0xcc, 0xbe, 0xcc, 0xc5, 0xcc, 0xc5, 0xcc, 0xcd, 0xcd, 0xca, 0xc0, 0xc0, 0xe3, 0xec, 0xf1, 0xb7, 0x02, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xa8, 0x00, 0xb3, 0xf1, 0xee, 0xe3, 0xd1, 0xbb, 0xca, 0xd0, 0xc9, 0xc5, 0xc5, 0xc2, 0xc3, 0xbe, 0xc2, 0xc9, 0xce, 0xc4, 0xcd, 0xc1, 0xc1, 0xd0, 0xc4, 0xc4, 0xd6, 0xe1, 0xf3, 0xf2, 0xfb, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xa8, 0x61, 0xa8, 0xa6, 0x61, 0x62, 0x62, 0x62, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xbc, 0x5f, 0x9d, 0x88, 0x6e, 0x6c, 0x79, 0x77, 0x75, 0x77, 0x77, 0x75, 0x75, 0x7a, 0x7a, 0x75, 0x7a, 0x75, 0x6f, 0x75, 0x6f, 0x75, 0x7b, 0x68, 0x68, 0x64, 0x6d, 0x97, 0xa4, 0xcf, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xad, 0xfc, 0xe9, 0xa5, 0xbf, 0x00, 0xf4, 0xf4, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x02, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xa8, 0x00, 0xad, 0xe4, 0xf2, 0xe2, 0xc7, 0xd1, 0xcd, 0xd0, 0xc5, 0xce, 0xcd, 0xcd, 0xd0, 0xc7, 0xc7, 0xde, 0xf0, 0xed, 0xb7, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0xaa, 0x02, 0xda, 0xf2, 0xea, 0xd6, 0xbb, 0xd4, 0xd3, 0xbe, 0xc3, 0xcb, 0xc3, 0xc8, 0xc8, 0xc8, 0xcc, 0xc5, 0xc8, 0xc5, 0xd0, 0xbd, 0xd6, 0xe3, 0xf1, 0xdf, 0xf4, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa8, 0x03, 0xa7, 0xf2, 0xe5, 0xd2, 0xc7, 0xd0, 0xd0, 0xd3, 0xc5, 0xc2, 0xc1, 0xcc, 0xc5, 0xcc, 0xcc, 0xd3, 0xcd, 0xcd, 0xca, 0xc7, 0xbb, 0xde, 0xf0, 0xf0, 0xda, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xad, 0x00, 0xb5, 0xd5, 0xec, 0xf3, 0xe3, 0xd2, 0xc0, 0xca, 0xca, 0xcd, 0xcd, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xd0, 0xc1, 0xd4, 0xd4, 0xd0, 0xc1, 0xbb, 0xd2, 0xe3, 0xf1, 0xf1, 0xb4, 0x00, 0x61, 0xf4, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x61, 0xa8, 0x62, 0x61, 0x61, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x61, 0x62, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa8, 0x61, 0x17, 0x60, 0x9a, 0x82, 0x76, 0x79, 0x75, 0x75, 0x75, 0x75, 0x77, 0x77, 0x71, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x71, 0x7f, 0x68, 0x67, 0x66, 0x65, 0x97, 0xa4, 0xda, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xfe, 0xf8, 0xa5, 0xe4, 0xad, 0x61, 0xa8, 0xa8, 0xa8, 0x62, 0x00, 0x61, 0xf4, 0xa8, 0x62, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x02, 0xf4, 0xad, 0xfa, 0xfa, 0xf5, 0xfe, 0xb7, 0xb7, 0xfe, 0xf5, 0xfa, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xa8, 0x00, 0xfb, 0xf0, 0xf1, 0xdb, 0xc7, 0xbd, 0xc4, 0xd3, 0xcd, 0xc9, 0xbd, 0xc0, 0xc7, 0xdd, 0xec, 0xf2, 0xb4, 0x00, 0x61, 0xa8, 0x00, 0x61, 0x00, 0x00, 0x00, 0xa8, 0x00, 0xaa, 0xa8, 0x00, 0xb2, 0xf2, 0xf1, 0xde, 0xc0, 0xbd, 0xcd, 0xcc, 0xc3, 0xc6, 0xc8, 0xc6, 0xc8, 0xc5, 0xc5, 0xc8, 0xc5, 0xc9, 0xc4, 0xbb, 0xde, 0xee, 0xf2, 0xba, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xf4, 0x00, 0xbc, 0xa5, 0xf3, 0xe2, 0xc7, 0xc7, 0xcd, 0xc9, 0xbe, 0xc5, 0xc9, 0xd3, 0xcc, 0xcc, 0xcc, 0xc9, 0xbe, 0xbd, 0xbd, 0xd2, 0xde, 0xef, 0xf2, 0xfd, 0xb5, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xac, 0x00, 0xa8, 0x62, 0x00, 0x00, 0xd8, 0xed, 0xf0, 0xeb, 0xdb, 0xbb, 0xc0, 0xd0, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc1, 0xc1, 0xcd, 0xca, 0xc1, 0xbd, 0xd1, 0xd7, 0xe6, 0xf1, 0xf1, 0x1e, 0xf9, 0xf4, 0x00, 0x61, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xf9, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa6, 0x41, 0x5f, 0x97, 0x74, 0x70, 0x79, 0x7a, 0x75, 0x75, 0x75, 0x77, 0x75, 0x75, 0x7a, 0x75, 0x75, 0x75, 0x75, 0x79, 0x6c, 0x75, 0x7a, 0x85, 0x68, 0x68, 0x66, 0x65, 0x97, 0xa7, 0xb4, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xb5, 0xb2, 0x9e, 0xf1, 0xcf, 0x00, 0xad, 0x00, 0xa8, 0xad, 0x00, 0x61, 0x00, 0xa8, 0x00, 0x00, 0x61, 0x61, 0x00, 0x61, 0xf4, 0xfa, 0xf5, 0xf6, 0x03, 0xb9, 0xb3, 0xfc, 0xd5, 0x23, 0xe0, 0xe0, 0x41, 0x41, 0x49, 0x9e, 0x4e, 0x53, 0xa7, 0x59, 0xef, 0x59, 0xef, 0x53, 0xa7, 0x9e, 0xe0, 0xd5, 0xb1, 0x00, 0x00, 0xf4, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00, 0x61, 0x02, 0x00, 0xad, 0xda, 0xf3, 0xee, 0xe3, 0xd6, 0xbd, 0xbb, 0xbe, 0xbb, 0xbd, 0xd6, 0xdd, 0xec, 0xf3, 0xe8, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xac, 0xdc, 0xf0, 0xea, 0xdb, 0xc7, 0xc4, 0xcc, 0xc3, 0xcb, 0xc6, 0xc3, 0xc8, 0xc8, 0xc5, 0xcc, 0xc5, 0xcd, 0xbd, 0xd9, 0xeb, 0xf1, 0xdf, 0xad, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x02, 0x00, 0x61, 0x02, 0x17, 0xef, 0xf2, 0xe3, 0xdd, 0xbd, 0xbd, 0xd3, 0xd4, 0xcc, 0xbe, 0xcc, 0xc5, 0xc5, 0xc1, 0xc1, 0xca, 0xd7, 0xde, 0xf1, 0xec, 0xfd, 0xb6, 0x61, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x62, 0x00, 0x00, 0xa6, 0x62, 0x61, 0xf4, 0xcf, 0xed, 0xf0, 0xee, 0xe6, 0xd7, 0xd1, 0xbd, 0xbd, 0xbd, 0xc4, 0xca, 0xd0, 0xca, 0xc4, 0xbd, 0xca, 0xd4, 0xe1, 0xee, 0xf1, 0xec, 0x17, 0xf4, 0x02, 0x61, 0xf9, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa6, 0x02, 0x9e, 0x60, 0x93, 0x6b, 0x6e, 0x75, 0x75, 0x7a, 0x7a, 0x75, 0x77, 0x75, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x75, 0x79, 0x75, 0x71, 0x7a, 0x70, 0x67, 0x6a, 0x65, 0x94, 0xa7, 0xdc, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xae, 0xbc, 0xed, 0xef, 0xf6, 0xa8, 0xb5, 0x00, 0x61, 0x00, 0x00, 0xf4, 0xf9, 0x61, 0x00, 0xad, 0xb2, 0xbc, 0xd5, 0xe0, 0x9e, 0xa7, 0xa4, 0xa7, 0xa4, 0xa4, 0xa4, 0x01, 0x01, 0x60, 0x60, 0x5c, 0x5c, 0x60, 0xa5, 0x60, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0xa5, 0x60, 0xa5, 0x01, 0xa4, 0xf7, 0x62, 0xa8, 0xa8, 0xa8, 0x00, 0x00, 0x61, 0x00, 0x00, 0x02, 0x61, 0x61, 0xf5, 0xdf, 0xee, 0xf1, 0xe7, 0xe1, 0xde, 0xd9, 0xdd, 0xe1, 0xe7, 0xe9, 0xf1, 0xe9, 0xb1, 0x00, 0xad, 0x61, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0xb1, 0xe9, 0xf1, 0xea, 0xd7, 0xc0, 0xc4, 0xc9, 0xd3, 0xc9, 0xcc, 0xc9, 0xc9, 0xcd, 0xc4, 0xcd, 0xca, 0xd6, 0xeb, 0xf0, 0xec, 0xf6, 0x00, 0xf9, 0x62, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x61, 0xf9, 0x62, 0x62, 0xf9, 0xd5, 0xed, 0xf1, 0xeb, 0xe6, 0xd9, 0xc4, 0xbb, 0xc1, 0xd1, 0xbd, 0xbd, 0xbd, 0xca, 0xd4, 0xdd, 0xe7, 0xf1, 0xf0, 0xe4, 0xa9, 0x00, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x61, 0x00, 0x62, 0x62, 0x61, 0xf9, 0xb3, 0xe2, 0xf1, 0xf1, 0xeb, 0xe6, 0xe1, 0xd9, 0xd4, 0xd1, 0xd1, 0xd1, 0xd1, 0xd7, 0xde, 0xe7, 0xeb, 0xee, 0xf2, 0xe2, 0xba, 0x00, 0x00, 0x61, 0x62, 0x61, 0x00, 0xac, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa6, 0xa6, 0xa9, 0xa0, 0x5a, 0x93, 0x74, 0x71, 0x83, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x77, 0x71, 0x75, 0x75, 0x75, 0x75, 0x71, 0x79, 0x71, 0x75, 0x7a, 0x7d, 0x70, 0x67, 0x66, 0x65, 0x97, 0xe8, 0xf8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xfa, 0xd5, 0xf1, 0x4e, 0xa6, 0x02, 0xa6, 0xa8, 0xa6, 0x00, 0xb5, 0xf4, 0x00, 0xb2, 0xd5, 0x9e, 0xa4, 0xa5, 0x60, 0x60, 0x60, 0xa4, 0xa3, 0xa3, 0xa2, 0xa2, 0xa0, 0x9d, 0x9b, 0x96, 0x96, 0x96, 0x93, 0x93, 0x93, 0x90, 0x90, 0x8c, 0x8e, 0x8c, 0x8c, 0x8c, 0x8e, 0x8e, 0x90, 0x93, 0x97, 0xa3, 0xa4, 0x4e, 0xfa, 0xf9, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x61, 0x61, 0xf9, 0x00, 0x00, 0xf5, 0xfc, 0xe9, 0xf3, 0xf3, 0xf0, 0xf2, 0xf0, 0xf1, 0xf3, 0xef, 0xdc, 0x03, 0x00, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x61, 0xaa, 0x61, 0xba, 0xe8, 0xf3, 0xe8, 0xde, 0xd2, 0xbb, 0xc7, 0xd1, 0xbb, 0xc0, 0xd1, 0xc7, 0xbd, 0xd2, 0xdd, 0xec, 0xf2, 0xe9, 0xf7, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xaa, 0x62, 0xf4, 0x61, 0x00, 0xad, 0xb8, 0xe9, 0xf1, 0xf2, 0xee, 0xe7, 0xe5, 0xde, 0xd8, 0xd9, 0xdd, 0xe3, 0xe5, 0xeb, 0xf0, 0xf1, 0xec, 0xbf, 0xb6, 0x00, 0xa6, 0x02, 0xa6, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x02, 0x02, 0x00, 0xaf, 0xcf, 0xe8, 0xf0, 0xf0, 0xf1, 0xf1, 0xec, 0xe8, 0xe5, 0xe8, 0xec, 0xee, 0xf0, 0xf2, 0xf0, 0xe5, 0xbf, 0xb6, 0xaa, 0xa8, 0x61, 0x61, 0x61, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xfa, 0x9e, 0x5f, 0x90, 0x67, 0x7b, 0x6f, 0x75, 0x7c, 0x7c, 0x7c, 0x7a, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x71, 0x79, 0x71, 0x71, 0x70, 0x70, 0x67, 0x6a, 0x65, 0x94, 0xa7, 0xd8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xad, 0xf6, 0xda, 0xef, 0x41, 0xb5, 0x00, 0xa6, 0xa6, 0xad, 0x02, 0x00, 0xb2, 0xfd, 0x59, 0x01, 0x60, 0x5c, 0x9f, 0x99, 0x96, 0x93, 0x8e, 0x8e, 0x8c, 0x88, 0x88, 0x80, 0x72, 0x67, 0x72, 0x6b, 0x67, 0x6b, 0x6b, 0x6b, 0x6b, 0x67, 0x78, 0x67, 0x6e, 0x81, 0x68, 0x68, 0x76, 0x67, 0x65, 0x65, 0x8d, 0x60, 0xa3, 0xfa, 0x61, 0xf5, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xf9, 0x61, 0xf4, 0x00, 0x00, 0xf4, 0xb1, 0xfc, 0xe0, 0x4e, 0x4e, 0xe9, 0x9e, 0xb4, 0xf7, 0xf4, 0x00, 0x00, 0xa8, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0xf7, 0xe8, 0xf3, 0xf0, 0xe5, 0xe1, 0xdb, 0xd6, 0xd2, 0xd2, 0xc7, 0xd6, 0xdd, 0xe7, 0xf2, 0xf3, 0xe4, 0xf7, 0x02, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xaa, 0x00, 0x00, 0xa8, 0xae, 0xfa, 0xbf, 0x4e, 0xf2, 0xa5, 0xed, 0xef, 0xf0, 0xf0, 0xef, 0xee, 0xf0, 0x01, 0xec, 0xd5, 0xb8, 0xae, 0xaa, 0x00, 0xa8, 0xac, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x61, 0x00, 0x00, 0x00, 0xb5, 0xb6, 0xb9, 0xf8, 0xe4, 0xed, 0x01, 0xf3, 0x01, 0xf3, 0xf3, 0xa5, 0xe9, 0xb4, 0xbc, 0xaf, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xfa, 0xa0, 0x5c, 0x90, 0x6b, 0x7b, 0x77, 0x75, 0x7c, 0x7c, 0x7d, 0x7a, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x75, 0x7a, 0x79, 0x71, 0x79, 0x71, 0x7b, 0x70, 0x67, 0x66, 0x65, 0x97, 0xed, 0xd8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xb2, 0x17, 0xf1, 0xe9, 0xd8, 0xb9, 0xfa, 0x00, 0xa6, 0xfe, 0x17, 0xa4, 0x5c, 0x5c, 0x9d, 0x93, 0x8c, 0x73, 0x73, 0x6a, 0x6a, 0x74, 0x72, 0x6b, 0x6e, 0x78, 0x78, 0x78, 0x76, 0x76, 0x76, 0x70, 0x70, 0x7e, 0x81, 0x7e, 0x71, 0x71, 0x85, 0x7b, 0x69, 0x85, 0x7b, 0x68, 0x86, 0x82, 0x6d, 0xa0, 0x60, 0xfd, 0xfa, 0xf9, 0x00, 0xaa, 0x00, 0xa6, 0xa6, 0x00, 0x61, 0x61, 0xf9, 0x02, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x61, 0xfa, 0xfe, 0xad, 0x61, 0x00, 0x00, 0x00, 0x61, 0xf4, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0xa8, 0x00, 0xb7, 0xdc, 0xed, 0xf1, 0xf0, 0xf1, 0xe7, 0xe7, 0xe7, 0xe7, 0xee, 0xf2, 0xf1, 0xec, 0xb4, 0xb2, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xac, 0xb1, 0xd8, 0xe8, 0xec, 0xa7, 0xe9, 0xed, 0xe9, 0xf8, 0xba, 0xaf, 0xac, 0xaa, 0x00, 0x00, 0xaa, 0xa6, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x61, 0xf4, 0xf9, 0x61, 0x00, 0xf4, 0x00, 0xfa, 0xb8, 0xf7, 0xb3, 0xb3, 0xb3, 0xba, 0xb8, 0xae, 0x00, 0x00, 0xa8, 0x02, 0xb5, 0x02, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xf5, 0xa0, 0x5c, 0x90, 0x67, 0x84, 0x75, 0x77, 0x7c, 0x7c, 0x7c, 0x7a, 0x75, 0x75, 0x75, 0x7c, 0x7a, 0x7a, 0x71, 0x75, 0x79, 0x71, 0x7b, 0x71, 0x68, 0x66, 0x66, 0x6d, 0x23, 0xa4, 0xd5, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa6, 0xaa, 0xb1, 0xd5, 0xf1, 0x01, 0xf3, 0xf3, 0xa7, 0x17, 0xd5, 0xa0, 0x60, 0xa3, 0xa2, 0x90, 0x8b, 0x74, 0x6b, 0x6e, 0x78, 0x81, 0x81, 0x70, 0x7d, 0x70, 0x7d, 0x70, 0x7d, 0x7b, 0x85, 0x7a, 0x7a, 0x71, 0x70, 0x7d, 0x70, 0x7c, 0x71, 0x7f, 0x77, 0x83, 0x77, 0x7b, 0x7e, 0x87, 0x6a, 0x89, 0x9c, 0xa3, 0xa3, 0xfc, 0x61, 0xf9, 0xf4, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x61, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xb9, 0xda, 0xe5, 0xec, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xe9, 0xd8, 0xf7, 0x00, 0x00, 0x00, 0x02, 0x02, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xaa, 0x00, 0xaa, 0xb5, 0xa8, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0xae, 0xaf, 0xf4, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x02, 0x61, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x62, 0x62, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x61, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xfa, 0xa0, 0x5c, 0x90, 0x6b, 0x7b, 0x77, 0x75, 0x7c, 0x7c, 0x7c, 0x7a, 0x75, 0x75, 0x75, 0x7a, 0x7c, 0x7a, 0x75, 0x75, 0x71, 0x75, 0x71, 0x71, 0x67, 0x67, 0x64, 0x89, 0x9c, 0xa7, 0xb3, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xab, 0xb1, 0xbf, 0xf1, 0xed, 0xe9, 0x4e, 0xf2, 0x01, 0x5f, 0xa3, 0x9f, 0x96, 0x6a, 0x6e, 0x68, 0x70, 0x7e, 0x85, 0x7c, 0x6c, 0x6c, 0x85, 0x85, 0x85, 0x7d, 0x7c, 0x7a, 0x7a, 0x75, 0x7a, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f, 0x7f, 0x69, 0x69, 0x83, 0x70, 0x6e, 0x74, 0x88, 0x9f, 0x5c, 0x5c, 0x17, 0x00, 0x61, 0x00, 0x00, 0xaa, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x61, 0x00, 0xf4, 0xa8, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xb5, 0xaa, 0xae, 0xb3, 0xba, 0xbc, 0xfb, 0xba, 0xb1, 0xb6, 0xb5, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xa8, 0xaa, 0x00, 0xac, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xb5, 0x00, 0x00, 0xf9, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0xa8, 0xab, 0xa6, 0xaa, 0xa6, 0x00, 0xa6, 0xb5, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xfa, 0x9e, 0x5c, 0x91, 0x67, 0x7e, 0x6f, 0x75, 0x7c, 0x7a, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x7c, 0x7a, 0x75, 0x75, 0x75, 0x79, 0x71, 0x71, 0x68, 0x6b, 0x64, 0x8d, 0x9d, 0x4e, 0xb8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xa9, 0xb6, 0xfb, 0xf1, 0xef, 0xdc, 0xe0, 0x55, 0x5c, 0xa3, 0x9d, 0x90, 0x67, 0x86, 0x87, 0x7c, 0x71, 0x75, 0x6f, 0x6f, 0x6f, 0x7f, 0x6f, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x77, 0x7f, 0x75, 0x75, 0x71, 0x7d, 0x7d, 0x7d, 0x7f, 0x7c, 0x7f, 0x85, 0x77, 0x7b, 0x81, 0x6a, 0x8e, 0xa1, 0x5c, 0xa5, 0xfc, 0x62, 0xf4, 0x61, 0xad, 0xb5, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa8, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x62, 0x62, 0x00, 0x61, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x61, 0xf4, 0x02, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0xac, 0xb5, 0xaa, 0x00, 0x00, 0xb5, 0x61, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0xa6, 0xa6, 0xaa, 0xa6, 0xab, 0x00, 0xaa, 0x00, 0xa6, 0xaa, 0xaa, 0xaa, 0x00, 0xa6, 0x00, 0xa6, 0xaa, 0xa6, 0xab, 0xa6, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xa6, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x02, 0x49, 0x5f, 0x93, 0x6a, 0x76, 0x6f, 0x75, 0x7a, 0x7c, 0x7a, 0x75, 0x77, 0x75, 0x75, 0x7c, 0x7a, 0x7a, 0x75, 0x75, 0x79, 0x75, 0x79, 0x68, 0x68, 0x66, 0x64, 0x91, 0xa7, 0x9e, 0xb8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xb5, 0xab, 0xaf, 0xb2, 0xe8, 0xf3, 0xe4, 0x53, 0x01, 0x5a, 0x94, 0x82, 0x68, 0x6e, 0x7b, 0x71, 0x6c, 0x79, 0x79, 0x77, 0x6f, 0x77, 0x77, 0x77, 0x77, 0x7a, 0x77, 0x7a, 0x77, 0x75, 0x6f, 0x77, 0x77, 0x7f, 0x7a, 0x75, 0x75, 0x75, 0x77, 0x6f, 0x69, 0x7b, 0x78, 0x6a, 0x8e, 0x9d, 0x60, 0xa0, 0x8d, 0x62, 0xf4, 0x61, 0xf9, 0x00, 0xaa, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x62, 0xa8, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x61, 0x00, 0xf4, 0xa8, 0x00, 0xb5, 0xad, 0xaa, 0x61, 0x00, 0x62, 0x02, 0x62, 0x61, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xaa, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x61, 0xf9, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xa8, 0xac, 0xaa, 0x00, 0x00, 0x00, 0xac, 0xa6, 0x00, 0xa6, 0x00, 0xaa, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x61, 0x41, 0x60, 0x94, 0x72, 0x76, 0x71, 0x75, 0x7a, 0x7a, 0x7c, 0x77, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x79, 0x71, 0x68, 0x67, 0x64, 0x82, 0x97, 0xa3, 0xe0, 0xb8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaf, 0xb6, 0xd8, 0x01, 0x01, 0x5c, 0x9f, 0x90, 0x6a, 0x80, 0x81, 0x71, 0x85, 0x6c, 0x79, 0x6c, 0x6f, 0x79, 0x79, 0x6f, 0x6f, 0x6f, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x79, 0x6c, 0x87, 0x72, 0x67, 0x91, 0xa2, 0xa5, 0xa2, 0xb2, 0x62, 0x62, 0x00, 0x02, 0x61, 0xad, 0x00, 0xaa, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x62, 0xb5, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x61, 0x62, 0x61, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xaa, 0xa6, 0x00, 0xa6, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xaa, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0xf9, 0x62, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa6, 0x00, 0xfd, 0x60, 0x97, 0x74, 0x76, 0x79, 0x7a, 0x75, 0x7a, 0x75, 0x75, 0x77, 0x75, 0x75, 0x7c, 0x7a, 0x7a, 0x75, 0x75, 0x79, 0x71, 0x76, 0x68, 0x67, 0x64, 0x8d, 0x99, 0xa4, 0xd5, 0xf5, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x61, 0xb5, 0x00, 0xf4, 0xb7, 0xb2, 0x1e, 0xa5, 0x5c, 0x99, 0x8c, 0x66, 0x6e, 0x81, 0x7d, 0x71, 0x7a, 0x7b, 0x71, 0x79, 0x79, 0x79, 0x77, 0x79, 0x6f, 0x79, 0x6c, 0x6c, 0x83, 0x83, 0x6f, 0x6c, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x6f, 0x79, 0x83, 0x76, 0x69, 0x88, 0x6a, 0x94, 0xa3, 0xa4, 0x9e, 0xb7, 0x62, 0x61, 0x61, 0x61, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xaa, 0x61, 0xaa, 0x61, 0xa8, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xf9, 0xf9, 0xf9, 0xf9, 0x61, 0x61, 0x61, 0x61, 0xf9, 0x61, 0xf9, 0x61, 0xf9, 0xf9, 0xf9, 0xf9, 0x61, 0xf9, 0x61, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x61, 0x00, 0x61, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xa6, 0x61, 0xd5, 0x5c, 0x9f, 0x74, 0x6e, 0x71, 0x71, 0x7a, 0x7a, 0x7a, 0x77, 0x77, 0x75, 0x75, 0x7f, 0x71, 0x7f, 0x7a, 0x6c, 0x7b, 0x7b, 0x68, 0x67, 0x67, 0x63, 0x94, 0xa2, 0x9e, 0xb9, 0xad, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x61, 0x00, 0xf9, 0xb5, 0xb7, 0xf7, 0x9e, 0x60, 0xa2, 0x99, 0x88, 0x6b, 0x68, 0x84, 0x85, 0x75, 0x7a, 0x7a, 0x7a, 0x71, 0x7a, 0x71, 0x75, 0x79, 0x77, 0x79, 0x79, 0x83, 0x71, 0x69, 0x69, 0x71, 0x83, 0x7f, 0x71, 0x85, 0x6f, 0x6f, 0x83, 0x6f, 0x68, 0x87, 0x82, 0x73, 0x97, 0x5c, 0x60, 0x9e, 0xf6, 0x61, 0xa8, 0xa8, 0x61, 0x61, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x61, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0x61, 0x61, 0x61, 0x61, 0xf9, 0xf9, 0xf9, 0xf9, 0x61, 0x61, 0x61, 0xf9, 0x61, 0xf9, 0xf9, 0xf9, 0xf9, 0x61, 0xf9, 0x61, 0x61, 0x61, 0x61, 0x61, 0xf9, 0xf9, 0xf9, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x61, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa6, 0x00, 0xfb, 0x5c, 0x9f, 0x88, 0x68, 0x7e, 0x71, 0x7a, 0x75, 0x7a, 0x77, 0x77, 0x75, 0x75, 0x7c, 0x71, 0x75, 0x7a, 0x6c, 0x7a, 0x87, 0x6e, 0x67, 0x64, 0x6d, 0x99, 0xa4, 0xb4, 0xb7, 0xf9, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x61, 0x00, 0x00, 0xf4, 0xa8, 0xf9, 0xfe, 0xf7, 0xa0, 0x5c, 0x5c, 0x99, 0x72, 0x68, 0x69, 0x79, 0x77, 0x6c, 0x71, 0x7f, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7a, 0x77, 0x7a, 0x77, 0x71, 0x7c, 0x7f, 0x7a, 0x7a, 0x7f, 0x77, 0x75, 0x7f, 0x6c, 0x75, 0x85, 0x79, 0x71, 0x76, 0x6a, 0x73, 0x9b, 0x5f, 0x5c, 0x3f, 0xfa, 0x61, 0x02, 0x00, 0x00, 0xb5, 0xb5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa8, 0x61, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0xaa, 0x61, 0x61, 0x61, 0x61, 0x61, 0xf9, 0xaa, 0x61, 0xaa, 0x61, 0x00, 0x61, 0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0xf9, 0xf9, 0xf9, 0xa8, 0xf9, 0xb5, 0xa8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xaa, 0x00, 0x03, 0x5c, 0xa3, 0x8e, 0x67, 0x84, 0x71, 0x7a, 0x7a, 0x75, 0x77, 0x77, 0x75, 0x7a, 0x75, 0x6c, 0x7c, 0x7f, 0x71, 0x70, 0x6e, 0x67, 0x6a, 0x63, 0x91, 0x9e, 0xa4, 0x04, 0xfa, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xf9, 0xfa, 0xfb, 0x59, 0xa3, 0xa2, 0x93, 0x6a, 0x6a, 0x84, 0x7b, 0x79, 0x6f, 0x6f, 0x75, 0x85, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c, 0x77, 0x7f, 0x77, 0x7c, 0x75, 0x71, 0x71, 0x71, 0x7a, 0x71, 0x75, 0x7c, 0x7c, 0x85, 0x71, 0x71, 0x87, 0x76, 0x6a, 0x8c, 0x9d, 0x5f, 0x59, 0xfd, 0xb7, 0xf9, 0x61, 0xac, 0xb5, 0xb5, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0xb5, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xa8, 0xa8, 0x62, 0xa8, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x62, 0x61, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0xab, 0xa6, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa6, 0x00, 0xad, 0x53, 0x5f, 0x93, 0x67, 0x7e, 0x7b, 0x7a, 0x7a, 0x7a, 0x77, 0x77, 0x7a, 0x7a, 0x75, 0x71, 0x75, 0x7b, 0x7c, 0x70, 0x68, 0x66, 0x64, 0x6d, 0xe0, 0xa0, 0xf8, 0xf6, 0x02, 0xf9, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0xae, 0x00, 0x00, 0xf5, 0xfc, 0x5c, 0xa3, 0xa2, 0x90, 0x6a, 0x67, 0x87, 0x7b, 0x6f, 0x6f, 0x77, 0x7f, 0x7f, 0x7d, 0x6c, 0x7c, 0x7c, 0x75, 0x7f, 0x7a, 0x77, 0x7a, 0x75, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7f, 0x7c, 0x7c, 0x7f, 0x85, 0x7a, 0x71, 0x76, 0x72, 0x8e, 0x9f, 0xa5, 0x60, 0xf3, 0xed, 0xed, 0xd8, 0xbc, 0xb1, 0xac, 0xb5, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xf9, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x62, 0x62, 0x62, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0xf9, 0x62, 0x02, 0xf4, 0xf4, 0xfa, 0xf5, 0xfe, 0xfe, 0xb6, 0xfe, 0xb7, 0xb0, 0xf6, 0xb8, 0x03, 0xb1, 0xb9, 0xb9, 0xf7, 0xf7, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xf7, 0xf7, 0x04, 0xb2, 0xb2, 0xb1, 0x03, 0xb7, 0xb6, 0xb6, 0xaf, 0xae, 0xae, 0xa9, 0xa9, 0x00, 0x61, 0xf9, 0x61, 0x61, 0x61, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xaa, 0x62, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xaa, 0x00, 0x61, 0xfd, 0x5f, 0x98, 0x6a, 0x6e, 0x70, 0x7b, 0x7a, 0x7a, 0x77, 0x77, 0x7a, 0x7a, 0x85, 0x79, 0x6c, 0x71, 0x7b, 0x6e, 0x6a, 0x6a, 0x65, 0x91, 0xa0, 0xe9, 0xb2, 0xb1, 0x00, 0x02, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0xa8, 0x00, 0xfe, 0xb4, 0x60, 0xa2, 0xa2, 0x8e, 0x6a, 0x72, 0x8a, 0x71, 0x7c, 0x6c, 0x75, 0x7f, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x77, 0x77, 0x77, 0x79, 0x79, 0x71, 0x7e, 0x81, 0x70, 0x70, 0x7e, 0x85, 0x71, 0x85, 0x6c, 0x7e, 0x6e, 0x6a, 0x93, 0xa4, 0x01, 0xef, 0xe8, 0xea, 0xf3, 0xec, 0x01, 0xa5, 0xf0, 0xec, 0xe2, 0xd5, 0xf7, 0xb7, 0xae, 0xa8, 0xaa, 0x00, 0xaa, 0x00, 0xb5, 0x02, 0x02, 0xf9, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x61, 0xa8, 0x62, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf9, 0x02, 0xfa, 0xfa, 0xfe, 0xb7, 0xb7, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0xfb, 0xff, 0xfc, 0x1b, 0x1e, 0x3f, 0x3f, 0x49, 0x47, 0x49, 0x47, 0x4d, 0x4f, 0x4d, 0x4f, 0x55, 0x59, 0x59, 0x59, 0x5c, 0x5f, 0x60, 0x60, 0x60, 0x5f, 0x5f, 0x60, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5c, 0x5c, 0x59, 0xa3, 0x55, 0xa3, 0xa3, 0xa3, 0x53, 0x53, 0xa0, 0xa0, 0xa0, 0x9e, 0x4d, 0x49, 0x49, 0x3f, 0x1e, 0x17, 0xff, 0xb3, 0x03, 0xb7, 0xad, 0x61, 0x00, 0x61, 0xa8, 0xa8, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xaa, 0x00, 0xcf, 0x5c, 0x9f, 0x8a, 0x68, 0x7e, 0x7a, 0x7a, 0x7a, 0x77, 0x7a, 0x7c, 0x7a, 0x79, 0x79, 0x71, 0x7a, 0x7e, 0x68, 0x64, 0x64, 0x8d, 0xe0, 0xa5, 0xda, 0xb7, 0xb6, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xb7, 0xda, 0xa5, 0x5c, 0x9d, 0x8c, 0x6a, 0x6b, 0x87, 0x7c, 0x71, 0x7f, 0x7f, 0x7f, 0x7c, 0x71, 0x71, 0x7c, 0x7a, 0x75, 0x75, 0x6f, 0x79, 0x6f, 0x79, 0x79, 0x76, 0x7e, 0x76, 0x6e, 0x81, 0x81, 0x70, 0x6e, 0x7e, 0x6e, 0x81, 0x80, 0x88, 0x97, 0xa4, 0xa5, 0xec, 0xd9, 0xbb, 0xdd, 0xc7, 0xdd, 0xeb, 0xe3, 0xf0, 0xf0, 0xf1, 0xf2, 0xf2, 0xef, 0xe4, 0xb4, 0xcf, 0xb1, 0xb6, 0xf4, 0x00, 0x00, 0x00, 0x61, 0x02, 0xa8, 0xa8, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x61, 0xaa, 0x61, 0xaa, 0xf9, 0xa8, 0x00, 0x62, 0xad, 0xfe, 0x03, 0xff, 0x17, 0x23, 0xe0, 0x41, 0x49, 0xa0, 0x59, 0x5f, 0x60, 0x60, 0x5f, 0x5f, 0x5e, 0x5c, 0x5c, 0x5e, 0x5c, 0x5f, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5b, 0x5d, 0x5b, 0x5d, 0x5b, 0x5b, 0x5b, 0x5b, 0x57, 0x58, 0x57, 0x50, 0x54, 0x51, 0x54, 0x50, 0x54, 0x54, 0x54, 0x4a, 0x4f, 0x4a, 0x47, 0x4a, 0x47, 0x4a, 0x47, 0x47, 0x4d, 0x55, 0x55, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0xa0, 0xe0, 0xd5, 0xfb, 0xf6, 0x02, 0xad, 0x61, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xab, 0xaa, 0xf9, 0xb2, 0xa3, 0xa3, 0x90, 0x6e, 0x7e, 0x7b, 0x7c, 0x75, 0x7f, 0x77, 0x7a, 0x7c, 0x69, 0x79, 0x79, 0x85, 0x70, 0x67, 0x64, 0x6d, 0x97, 0x9d, 0xe8, 0xb2, 0xb0, 0x00, 0xac, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x61, 0x00, 0xf5, 0x1e, 0xa5, 0xa3, 0x9d, 0x88, 0x6a, 0x80, 0x76, 0x71, 0x7b, 0x75, 0x75, 0x7a, 0x7f, 0x7d, 0x71, 0x7c, 0x85, 0x69, 0x75, 0x79, 0x6f, 0x79, 0x79, 0x76, 0x76, 0x76, 0x72, 0x68, 0x8e, 0x9b, 0x9b, 0x8f, 0x6b, 0x78, 0x8a, 0x64, 0x8c, 0x9d, 0xa4, 0xf1, 0xe7, 0xd6, 0xc7, 0xd4, 0xbb, 0xcd, 0xd1, 0xbb, 0xbd, 0xd7, 0xdd, 0xe1, 0xe6, 0xeb, 0xf0, 0xf1, 0xa5, 0xf1, 0xf0, 0xa7, 0xe2, 0xda, 0xbf, 0xb2, 0xfa, 0xa8, 0x00, 0x00, 0x00, 0xaa, 0x61, 0xa8, 0xa8, 0xa8, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xf9, 0xf9, 0xf9, 0x62, 0x02, 0xb3, 0x17, 0x49, 0x53, 0x5c, 0x60, 0x5f, 0x5c, 0x5e, 0x5e, 0x5f, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x57, 0x57, 0x57, 0x57, 0x54, 0x57, 0x57, 0x57, 0x54, 0x54, 0x54, 0x54, 0x4f, 0x4f, 0x4a, 0x4f, 0x4a, 0x4a, 0x4a, 0x44, 0x4a, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3a, 0x42, 0x3a, 0x2b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x4c, 0x48, 0x42, 0x42, 0x2b, 0x2b, 0x2b, 0x2b, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x21, 0x25, 0x25, 0x25, 0x47, 0x4d, 0x55, 0x59, 0x5c, 0x53, 0x41, 0xb9, 0xfa, 0x61, 0x00, 0x61, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa6, 0x00, 0xf9, 0xfa, 0x4d, 0x5c, 0x92, 0x72, 0x70, 0x7b, 0x7a, 0x7a, 0x75, 0x7a, 0x7c, 0x7a, 0x6f, 0x79, 0x79, 0x68, 0x68, 0x66, 0x6a, 0x8e, 0x9c, 0xef, 0xbf, 0xb0, 0xac, 0xaa, 0xaa, 0xf9, 
-  0xf9, 0xf9, 0x61, 0x00, 0x00, 0xaa, 0xab, 0xaa, 0xab, 0xaa, 0x00, 0xb7, 0x1e, 0x60, 0xa3, 0x99, 0x72, 0x72, 0x78, 0x76, 0x76, 0x79, 0x6f, 0x6f, 0x77, 0x6f, 0x6c, 0x6c, 0x7a, 0x7c, 0x7c, 0x71, 0x7a, 0x7f, 0x7f, 0x6f, 0x76, 0x84, 0x78, 0x66, 0x88, 0x96, 0x5c, 0x5a, 0xa3, 0x8e, 0x67, 0x74, 0x64, 0x91, 0x9f, 0x60, 0x01, 0xe1, 0xd2, 0xc1, 0xcd, 0xc8, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xbe, 0xbe, 0xbd, 0xc1, 0xd4, 0xd7, 0xde, 0xe6, 0xe7, 0xee, 0xf0, 0xf1, 0xf3, 0xf3, 0xf1, 0xe9, 0xfd, 0xda, 0xbf, 0xb1, 0xae, 0xa8, 0xaa, 0x00, 0x00, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xa6, 0x00, 0x00, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x61, 0x61, 0x61, 0xf9, 0xf9, 0x61, 0xf9, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0xa6, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0x62, 0x03, 0x1e, 0x59, 0x60, 0x5f, 0x5f, 0x5d, 0x5a, 0x58, 0x54, 0x51, 0x51, 0x4c, 0x4c, 0x4c, 0x48, 0x48, 0x42, 0x42, 0x3a, 0x42, 0x3a, 0x3a, 0x3a, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x27, 0x29, 0x27, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2a, 0x2a, 0x2a, 0x2f, 0x2a, 0x2f, 0x2f, 0x2f, 0x2a, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x27, 0x2f, 0x29, 0x29, 0x20, 0x13, 0x08, 0x0a, 0x11, 0x0a, 0x18, 0x18, 0x18, 0x1c, 0x21, 0x25, 0x3f, 0x4d, 0xa3, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0xf9, 0x61, 0x00, 0xa6, 0x61, 0x61, 0xf9, 0x17, 0xa4, 0x9f, 0x82, 0x76, 0x68, 0x83, 0x71, 0x75, 0x7a, 0x69, 0x7b, 0x6f, 0x7b, 0x7e, 0x68, 0x67, 0x65, 0x89, 0x9c, 0xa4, 0xda, 0xb8, 0xae, 0xab, 0x00, 0x00, 0xaa, 
-  0xf9, 0xf9, 0x00, 0x62, 0xaa, 0xa6, 0xab, 0xaa, 0xaa, 0xaa, 0xb6, 0x1e, 0x5c, 0xa3, 0x98, 0x82, 0x78, 0x7b, 0x76, 0x79, 0x6c, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x83, 0x85, 0x7f, 0x6c, 0x7c, 0x7f, 0x85, 0x69, 0x69, 0x87, 0x7e, 0x66, 0x82, 0x93, 0xa2, 0x5f, 0x5f, 0x98, 0x8e, 0x73, 0x82, 0x88, 0x98, 0x59, 0x60, 0xe9, 0xdd, 0xd6, 0xc4, 0xc9, 0xce, 0xc2, 0xc2, 0xc2, 0xc2, 0xcb, 0xc2, 0xc2, 0xce, 0xcc, 0xc2, 0xbe, 0xbe, 0xc1, 0xc1, 0xca, 0xd7, 0xd9, 0xdd, 0xe3, 0xea, 0xee, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xec, 0xe2, 0xda, 0xbc, 0xb2, 0xae, 0x02, 0x61, 0x00, 0xa6, 0x61, 0xa6, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0xa6, 0xaa, 0x00, 0xa6, 0xaa, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x61, 0xf9, 0x61, 0xf9, 0x61, 0x61, 0xad, 0x61, 0x00, 0xa8, 0xa6, 0xa6, 0x62, 0x02, 0x02, 0x61, 0xfe, 0x1b, 0x5a, 0x5f, 0x5a, 0x57, 0xa1, 0x4f, 0x44, 0x42, 0x2b, 0x29, 0x24, 0x2e, 0x27, 0x2e, 0x27, 0x27, 0x27, 0x2a, 0x27, 0x2f, 0x2f, 0x33, 0x2f, 0x33, 0x2a, 0x33, 0x2a, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x32, 0x34, 0x32, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x36, 0x2d, 0x37, 0x2d, 0x37, 0x2d, 0x34, 0x2d, 0x32, 0x33, 0x32, 0x2a, 0x32, 0x32, 0x32, 0x34, 0x32, 0x3b, 0x2f, 0x27, 0x20, 0x0c, 0x0c, 0x13, 0x0c, 0x06, 0x0c, 0x13, 0x13, 0x0d, 0x11, 0x0e, 0x1e, 0x5c, 0xd5, 0xf9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf9, 0x61, 0x00, 0x00, 0x02, 0xad, 0x03, 0xb3, 0xda, 0xe9, 0x01, 0xa3, 0x91, 0x72, 0x79, 0x7b, 0x71, 0x85, 0x79, 0x71, 0x79, 0x7b, 0x7b, 0x68, 0x66, 0x66, 0x6d, 0x97, 0x4e, 0xfd, 0xfb, 0xaf, 0xac, 0x00, 0x00, 0xaa, 0x61, 
-  0xf9, 0x61, 0x61, 0xa6, 0xa6, 0xa6, 0xab, 0xab, 0xb5, 0xaf, 0x23, 0x60, 0xa3, 0x96, 0x73, 0x68, 0x7b, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x7f, 0x7c, 0x6c, 0x6c, 0x6c, 0x75, 0x6f, 0x6c, 0x69, 0x84, 0x81, 0x6a, 0x73, 0x93, 0x9f, 0x5f, 0x57, 0x9b, 0x8e, 0x82, 0x73, 0x73, 0x8b, 0x99, 0xa5, 0xa5, 0xe8, 0xd9, 0xc7, 0xca, 0xc9, 0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0xc8, 0xc9, 0xc9, 0xc9, 0xcd, 0xc9, 0xcd, 0xc4, 0xcd, 0xc4, 0xca, 0xca, 0xbd, 0xbd, 0xc0, 0xc7, 0xd1, 0xd7, 0xdd, 0xde, 0xe6, 0xea, 0xee, 0xf0, 0xf2, 0xf2, 0xf2, 0xf3, 0xed, 0xe4, 0xb4, 0xbf, 0xb9, 0xb7, 0xae, 0x61, 0x00, 0xf9, 0x61, 0x00, 0x00, 0x62, 0xa8, 0x00, 0x61, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa8, 0x61, 0x61, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf9, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x61, 0x02, 0x00, 0x61, 0xfb, 0x55, 0x5f, 0x57, 0x54, 0x5b, 0x2b, 0x2b, 0x26, 0x26, 0x27, 0x27, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x40, 0x3b, 0x2a, 0x2a, 0x2a, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x2d, 0x34, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x34, 0x34, 0x2d, 0x2d, 0x34, 0x34, 0x2d, 0x32, 0x34, 0x34, 0x34, 0x34, 0x40, 0x24, 0x19, 0x09, 0x10, 0x09, 0x10, 0x0f, 0x14, 0x0c, 0x0d, 0x0a, 0x0a, 0x21, 0x59, 0xf8, 0xa8, 0x61, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xaa, 0x61, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x62, 0xa8, 0x61, 0x00, 0x62, 0x61, 0x00, 0x00, 0x00, 0x62, 0x62, 0x02, 0xf4, 0xa8, 0x00, 0x00, 0x00, 0xb6, 0xb3, 0xd8, 0x41, 0xa7, 0xf0, 0xf2, 0xf3, 0xef, 0xa5, 0x9b, 0x72, 0x6e, 0x7a, 0x6c, 0x85, 0x6c, 0x7a, 0x7b, 0x79, 0x67, 0x68, 0x74, 0x63, 0x97, 0x9c, 0xa7, 0xbc, 0xb0, 0xac, 0xaa, 0xaa, 0x00, 0x00, 0x00, 
-  0x00, 0x61, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xb7, 0x23, 0x5c, 0x59, 0x94, 0x67, 0x72, 0x84, 0x71, 0x77, 0x7f, 0x75, 0x7c, 0x7a, 0x7c, 0x7a, 0x69, 0x71, 0x7c, 0x85, 0x85, 0x7f, 0x7f, 0x7b, 0x84, 0x67, 0x66, 0x8c, 0x9b, 0x5e, 0x5b, 0x9b, 0x90, 0x73, 0x73, 0x73, 0x73, 0x94, 0x5a, 0x60, 0xa5, 0xe3, 0xd1, 0xbd, 0xbd, 0xc5, 0xbe, 0xc3, 0xc2, 0xc3, 0xc3, 0xc5, 0xc5, 0xc9, 0xcd, 0xcd, 0xc1, 0xc4, 0xcd, 0xcd, 0xcd, 0xd0, 0xcd, 0xc4, 0xd0, 0xd0, 0xcd, 0xc1, 0xbb, 0xbe, 0xbd, 0xc4, 0xc7, 0xd2, 0xd7, 0xdd, 0xde, 0xe6, 0xea, 0xeb, 0xf0, 0xf1, 0xf1, 0xf3, 0xf1, 0xed, 0xe8, 0xe2, 0xcf, 0xbf, 0xb9, 0xfa, 0x61, 0xa8, 0x61, 0x00, 0xa8, 0x00, 0x00, 0x61, 0x61, 0x62, 0x62, 0x62, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x62, 0xa8, 0xa6, 0xab, 0xa6, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xa8, 0xf9, 0x61, 0xf4, 0xf4, 0x61, 0xac, 0xf8, 0xa5, 0x5a, 0x54, 0x50, 0x2b, 0x20, 0x29, 0x27, 0x2f, 0x2f, 0x33, 0x3b, 0x43, 0x33, 0x33, 0x3b, 0x2a, 0x3b, 0x3b, 0x3b, 0x34, 0x3b, 0x33, 0x34, 0x34, 0x34, 0x34, 0x43, 0x37, 0x43, 0x2d, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2d, 0x37, 0x2d, 0x37, 0x2d, 0x37, 0x2d, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x2d, 0x34, 0x2d, 0x34, 0x2d, 0x34, 0x2d, 0x2d, 0x34, 0x46, 0x22, 0x0f, 0x0f, 0x12, 0x0f, 0x15, 0x09, 0x12, 0x06, 0x0c, 0x11, 0x0a, 0x25, 0x59, 0xd5, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x62, 0x61, 0x61, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x61, 0x62, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbc, 0xd8, 0xe2, 0xed, 0xf3, 0xf2, 0xf0, 0xf2, 0xeb, 0xe6, 0xe1, 0xdf, 0x01, 0xa2, 0x8c, 0x68, 0x81, 0x7a, 0x7a, 0x6c, 0x7f, 0x7d, 0x78, 0x67, 0x66, 0x6d, 0x91, 0x9c, 0xa4, 0xcf, 0xf6, 0xae, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 
-  0x61, 0x61, 0x00, 0xa6, 0xad, 0x00, 0xa6, 0xfe, 0x1e, 0x5c, 0x60, 0x90, 0x74, 0x86, 0x69, 0x71, 0x7c, 0x7f, 0x7c, 0x7f, 0x7c, 0x7c, 0x7a, 0x7a, 0x85, 0x85, 0x7a, 0x71, 0x70, 0x71, 0x70, 0x76, 0x6d, 0x8e, 0x9b, 0x5e, 0x5e, 0x9b, 0x8e, 0x66, 0x74, 0x6a, 0x73, 0x8c, 0x99, 0xa2, 0x5c, 0xed, 0xdd, 0xca, 0xbd, 0xd0, 0xd3, 0xc5, 0xc8, 0xd3, 0xcb, 0xc2, 0xc8, 0xc3, 0xc9, 0xc5, 0xc9, 0xc9, 0xcd, 0xcd, 0xcd, 0xc9, 0xc4, 0xc5, 0xc1, 0xbe, 0xc9, 0xc5, 0xcc, 0xcc, 0xce, 0xce, 0xcc, 0xd3, 0xca, 0xca, 0xc7, 0xca, 0xc7, 0xca, 0xd2, 0xd1, 0xdb, 0xde, 0xe3, 0xea, 0xeb, 0xf0, 0xf1, 0xf1, 0xf2, 0xf3, 0xf3, 0xec, 0xe4, 0xdf, 0xd5, 0xfb, 0xf6, 0xfe, 0xad, 0x00, 0x00, 0x61, 0xf9, 0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x00, 0xa6, 0x00, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0x00, 0xaa, 0x00, 0xab, 0x00, 0xb5, 0xf4, 0x61, 0xf9, 0x04, 0xa0, 0xa0, 0x5a, 0x57, 0x2b, 0x2b, 0x40, 0x2a, 0x33, 0x2d, 0x38, 0x38, 0x45, 0x3c, 0x31, 0x2c, 0x34, 0x2d, 0x34, 0x32, 0x2d, 0x2d, 0x2d, 0x2d, 0x37, 0x2d, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2c, 0x38, 0x2c, 0x38, 0x2c, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x2d, 0x37, 0x2d, 0x37, 0x2d, 0x37, 0x2d, 0x2d, 0x34, 0x33, 0x1a, 0x0b, 0x0f, 0x15, 0x12, 0x12, 0x0b, 0x0f, 0x10, 0x13, 0x0a, 0x11, 0x3f, 0x59, 0xb2, 0xa8, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xa6, 0x61, 0xa6, 0x61, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x62, 0x61, 0x61, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xad, 0xb1, 0xbf, 0xda, 0xe8, 0xee, 0xf2, 0xf1, 0xf0, 0xf0, 0xeb, 0xe5, 0xdb, 0xdd, 0xd1, 0xd2, 0xbb, 0xd6, 0xe9, 0x01, 0x98, 0x6a, 0x7e, 0x85, 0x71, 0x7f, 0x7d, 0x70, 0x6b, 0x66, 0x63, 0x91, 0x9c, 0xa5, 0xb4, 0xf6, 0xaf, 0xab, 0xaa, 0xaa, 0x00, 0x00, 0x61, 0x00, 
-  0xa6, 0xa6, 0x00, 0x00, 0x61, 0x00, 0xb7, 0x23, 0x60, 0x5c, 0x93, 0x73, 0x78, 0x7e, 0x84, 0x6c, 0x7a, 0x7d, 0x7c, 0x7c, 0x75, 0x7a, 0x75, 0x75, 0x6c, 0x71, 0x7e, 0x76, 0x6e, 0x78, 0x86, 0x8b, 0x9a, 0xa2, 0xa2, 0x96, 0x8b, 0x6a, 0x74, 0x74, 0x82, 0x66, 0x91, 0x9f, 0x01, 0x01, 0xef, 0xf8, 0xc7, 0xbb, 0xc1, 0xd0, 0xc1, 0xbe, 0xc9, 0xcc, 0xc5, 0xc8, 0xcc, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc9, 0xce, 0xd3, 0xd3, 0xd3, 0xcb, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc9, 0xc9, 0xbe, 0xbd, 0xc1, 0xd0, 0xd0, 0xd1, 0xbd, 0xbd, 0xbd, 0xc0, 0xc7, 0xd7, 0xdd, 0xe3, 0xe6, 0xea, 0xec, 0xee, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xe8, 0xf8, 0xcf, 0xbf, 0xf7, 0xb6, 0xf4, 0xf4, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0xa6, 0xa6, 0xa6, 0xa6, 0x00, 0xa6, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0xaa, 0x61, 0xf9, 0x05, 0x4d, 0x5f, 0x5e, 0x4f, 0x2b, 0x29, 0x24, 0x2d, 0x45, 0x3c, 0x31, 0x31, 0x31, 0x31, 0x3c, 0x45, 0x3c, 0x3e, 0x37, 0x38, 0x3e, 0x3e, 0x43, 0x3e, 0x43, 0x38, 0x38, 0x3e, 0x38, 0x38, 0x31, 0x38, 0x31, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2c, 0x37, 0x2c, 0x37, 0x2c, 0x2d, 0x34, 0x3b, 0x24, 0x15, 0x06, 0x12, 0x15, 0x0f, 0x12, 0x0f, 0x0f, 0x10, 0x08, 0x11, 0x30, 0x5a, 0x23, 0xf4, 0x62, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa6, 0x61, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x00, 0x61, 0x61, 0x02, 0xf4, 0xb0, 0xf7, 0xd5, 0xdf, 0xe8, 0xee, 0xf1, 0xf2, 0xf1, 0xee, 0xea, 0xe6, 0xe1, 0xdb, 0xd6, 0xc7, 0xd1, 0xc4, 0xbd, 0xd0, 0xc0, 0xc7, 0xdf, 0xa5, 0xa4, 0x8c, 0x6b, 0x7d, 0x71, 0x85, 0x7d, 0x67, 0x63, 0x64, 0x94, 0x9c, 0xa4, 0xe0, 0xb2, 0xae, 0xb5, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x61, 
-  0x00, 0xaa, 0xa8, 0x00, 0xf9, 0xf6, 0x1e, 0x60, 0x5a, 0x93, 0x82, 0x6b, 0x81, 0x70, 0x70, 0x85, 0x71, 0x75, 0x75, 0x75, 0x6f, 0x79, 0x79, 0x79, 0x76, 0x76, 0x80, 0x6b, 0x74, 0x8c, 0x9a, 0xa1, 0x9f, 0x95, 0x82, 0x6b, 0x72, 0x80, 0x72, 0x82, 0x89, 0x9d, 0x01, 0x01, 0xa7, 0xa5, 0xf0, 0xeb, 0xea, 0xe3, 0xdd, 0xd6, 0xbd, 0xc0, 0xcd, 0xbd, 0xc1, 0xc1, 0xc9, 0xcc, 0xc2, 0xc2, 0xc3, 0xcb, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 0xc2, 0xc2, 0xc2, 0xce, 0xc2, 0xc2, 0xc8, 0xcb, 0xc2, 0xc2, 0xc2, 0xc3, 0xc5, 0xce, 0xd3, 0xd3, 0xcd, 0xbe, 0xbe, 0xc1, 0xcd, 0xd0, 0xd0, 0xd0, 0xc4, 0xbd, 0xbb, 0xbb, 0xd2, 0xd7, 0xdd, 0xe1, 0xe3, 0xe7, 0xea, 0xeb, 0xee, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xec, 0xe8, 0xe2, 0xdc, 0xcf, 0xba, 0xb1, 0xb6, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0xaa, 0xaa, 0xab, 0xb5, 0x00, 0xfa, 0x1b, 0x59, 0x5d, 0x54, 0x42, 0x3a, 0x2e, 0x33, 0x37, 0x3c, 0x31, 0x45, 0x45, 0x3c, 0x31, 0x31, 0x38, 0x2c, 0x37, 0x2c, 0x31, 0x2c, 0x31, 0x38, 0x31, 0x38, 0x3c, 0x3e, 0x3e, 0x3e, 0x3c, 0x3e, 0x3e, 0x3e, 0x3d, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3e, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x2d, 0x34, 0x3b, 0x24, 0x1a, 0x0f, 0x0b, 0x0f, 0x14, 0x09, 0x0f, 0x10, 0x07, 0x08, 0x0a, 0x1c, 0xa2, 0xa0, 0xb2, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xae, 0xb7, 0xb9, 0xcf, 0xe0, 0xe5, 0xec, 0xee, 0xf2, 0xf2, 0xf2, 0xee, 0xea, 0xe6, 0xe1, 0xd9, 0xd1, 0xd1, 0xc7, 0xc0, 0xc0, 0xd0, 0xcd, 0xc5, 0xbe, 0xd4, 0xcd, 0xca, 0xd6, 0xec, 0x60, 0x98, 0x74, 0x78, 0x78, 0x70, 0x6b, 0x66, 0x65, 0x91, 0x9c, 0xa4, 0x23, 0xb1, 0xae, 0xab, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xf9, 0x00, 
-  0xab, 0xaa, 0xb5, 0xf9, 0xfe, 0x1e, 0x5f, 0xa3, 0x93, 0x82, 0x68, 0x81, 0x71, 0x7d, 0x85, 0x70, 0x6c, 0x79, 0x6c, 0x79, 0x79, 0x79, 0x76, 0x76, 0x76, 0x68, 0x6b, 0x8e, 0x9b, 0x9f, 0x9a, 0x93, 0x74, 0x6b, 0x74, 0x8a, 0x78, 0x66, 0x88, 0x94, 0xa3, 0x01, 0xa7, 0xe2, 0xbf, 0xdb, 0xe5, 0xa5, 0xf0, 0xf0, 0xee, 0xeb, 0xe3, 0xdd, 0xd9, 0xc0, 0xc4, 0xc4, 0xc4, 0xc9, 0xc2, 0xc2, 0xc2, 0xcb, 0xc2, 0xc6, 0xc2, 0xc6, 0xc2, 0xc2, 0xc6, 0xc2, 0xcb, 0xc3, 0xc3, 0xce, 0xc8, 0xc3, 0xc3, 0xce, 0xc3, 0xc6, 0xc3, 0xc6, 0xc3, 0xc3, 0xc8, 0xcc, 0xd3, 0xcc, 0xc1, 0xc5, 0xc1, 0xc9, 0xc9, 0xcd, 0xcd, 0xca, 0xc4, 0xbd, 0xbb, 0xbb, 0xc0, 0xd6, 0xd7, 0xd9, 0xde, 0xe1, 0xe5, 0xe7, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf0, 0xec, 0xf8, 0xdc, 0xd5, 0xbc, 0xb9, 0xb7, 0xad, 0x02, 0x61, 0x61, 0xf9, 0x61, 0x61, 0x00, 0xaa, 0x00, 0xac, 0xaa, 0x00, 0xf6, 0x3f, 0x5f, 0x5a, 0x54, 0x42, 0x40, 0x2e, 0x2a, 0x2d, 0x45, 0x3c, 0x45, 0x3c, 0x3c, 0x31, 0x39, 0x36, 0x36, 0x34, 0x36, 0x3e, 0x3e, 0x3d, 0x3e, 0x3d, 0x3d, 0x3c, 0x3d, 0x31, 0x3e, 0x3c, 0x38, 0x3d, 0x3e, 0x3e, 0x3e, 0x3e, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x2c, 0x3c, 0x2c, 0x3c, 0x2c, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x3e, 0x3e, 0x3c, 0x3e, 0x3c, 0x38, 0x3c, 0x38, 0x31, 0x37, 0x2c, 0x37, 0x2d, 0x40, 0x1a, 0x09, 0x12, 0x10, 0x0f, 0x10, 0x0f, 0x0c, 0x13, 0x07, 0x11, 0x1c, 0x9c, 0x59, 0xda, 0xa6, 0x62, 0x62, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xb5, 0xb6, 0xb9, 0xbf, 0xd8, 0xdf, 0xe9, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf0, 0xeb, 0xe7, 0xe1, 0xdd, 0xd7, 0xd2, 0xca, 0xc0, 0xc4, 0xc4, 0xbd, 0xcd, 0xd0, 0xd0, 0xc1, 0xcc, 0xce, 0xc2, 0xc2, 0xc5, 0xd0, 0xbb, 0xe1, 0xef, 0x5c, 0x88, 0x82, 0x78, 0x66, 0x66, 0x73, 0x94, 0xfd, 0xa4, 0xe0, 0xb2, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x00, 
-  0xab, 0xac, 0xb5, 0xfe, 0xfd, 0x5f, 0xa3, 0x96, 0x74, 0x78, 0x7e, 0x7f, 0x7c, 0x7c, 0x7d, 0x71, 0x84, 0x79, 0x7b, 0x6c, 0x76, 0x6e, 0x6e, 0x68, 0x8a, 0x92, 0x9d, 0x9b, 0x92, 0x8a, 0x72, 0x6a, 0x70, 0x86, 0x81, 0x66, 0x82, 0x91, 0x9f, 0xa5, 0x01, 0xe2, 0xbf, 0xb0, 0xaf, 0xb0, 0xb9, 0xba, 0xda, 0xe2, 0xed, 0xf2, 0xf2, 0xf2, 0xeb, 0xe7, 0xe1, 0xdb, 0xd1, 0xca, 0xc1, 0xbe, 0xbe, 0xc2, 0xc2, 0xcc, 0xcc, 0xc2, 0xcc, 0xce, 0xcb, 0xbe, 0xc5, 0xc3, 0xc8, 0xce, 0xce, 0xc8, 0xc8, 0xc3, 0xcb, 0xc6, 0xc6, 0xc6, 0xc6, 0xcb, 0xcb, 0xcb, 0xc3, 0xc3, 0xc3, 0xc5, 0xc8, 0xcc, 0xc5, 0xc5, 0xc9, 0xc5, 0xc9, 0xc9, 0xc9, 0xc4, 0xcd, 0xca, 0xbd, 0xbd, 0xbd, 0xc0, 0xc7, 0xd1, 0xd6, 0xd7, 0xdd, 0xde, 0xe3, 0xe6, 0xea, 0xee, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xec, 0xe8, 0xe5, 0x41, 0xda, 0xff, 0xba, 0xb2, 0xf6, 0xf5, 0xac, 0x62, 0x62, 0xfc, 0x5a, 0x5e, 0x5b, 0x51, 0x2b, 0x2e, 0x33, 0x37, 0x37, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0x38, 0x36, 0x36, 0x32, 0x34, 0x32, 0x36, 0x38, 0x3c, 0x3e, 0x3c, 0x38, 0x3c, 0x38, 0x3e, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x3e, 0x2c, 0x2c, 0x3e, 0x43, 0x2d, 0x37, 0x3b, 0x1d, 0x0f, 0x09, 0x0f, 0x09, 0x10, 0x14, 0x0c, 0x0c, 0x08, 0x0a, 0x1c, 0x30, 0x59, 0x23, 0x62, 0x02, 0x02, 0x61, 0x61, 0x61, 0x61, 0xa8, 0x61, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0xb5, 0xaf, 0xb0, 0xb2, 0xbc, 0xd8, 0xe2, 0xe8, 0xec, 0xf0, 0xf2, 0xf3, 0xf1, 0xf0, 0xee, 0xee, 0xe7, 0xe3, 0xde, 0xd7, 0xd6, 0xca, 0xc0, 0xbd, 0xbd, 0xc4, 0xca, 0xcd, 0xc4, 0xc9, 0xc9, 0xc9, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc2, 0xbe, 0xc5, 0xca, 0xd6, 0xec, 0x01, 0x97, 0x6d, 0x65, 0x64, 0x6d, 0x97, 0x9c, 0xa7, 0xe0, 0xb2, 0xac, 0xb5, 0xaa, 0xab, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xaa, 0xaa, 0xad, 0xf8, 0xa3, 0x5c, 0x96, 0x6a, 0x78, 0x7b, 0x79, 0x75, 0x77, 0x7f, 0x7c, 0x7d, 0x6c, 0x70, 0x76, 0x76, 0x76, 0x8a, 0x92, 0x95, 0x9a, 0x95, 0x8f, 0x78, 0x6b, 0x6b, 0x78, 0x86, 0x6e, 0x6b, 0x82, 0x91, 0x9d, 0xa5, 0xa5, 0xed, 0xda, 0xba, 0xb8, 0xb0, 0xb6, 0xa9, 0xab, 0xaf, 0xb8, 0xb9, 0xbc, 0xd5, 0xdf, 0xe8, 0xf1, 0xf2, 0xf0, 0xee, 0xea, 0xe3, 0xde, 0xd7, 0xd0, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc9, 0xc4, 0xcc, 0xd3, 0xcc, 0xc5, 0xc5, 0xc3, 0xc3, 0xc3, 0xc3, 0xbe, 0xc3, 0xc3, 0xc6, 0xcb, 0xcb, 0xc3, 0xc3, 0xce, 0xce, 0xc8, 0xc8, 0xc8, 0xc3, 0xc3, 0xc3, 0xc6, 0xc6, 0xc2, 0xcb, 0xc8, 0xc8, 0xc5, 0xc9, 0xcc, 0xd0, 0xc1, 0xc4, 0xc4, 0xca, 0xca, 0xca, 0xc0, 0xc0, 0xd1, 0xd1, 0xd6, 0xd7, 0xd9, 0xd9, 0xe3, 0xe1, 0xe6, 0xea, 0xee, 0xee, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xef, 0xf3, 0xef, 0xfd, 0x23, 0x25, 0x5a, 0x5e, 0x58, 0x48, 0x3a, 0x1d, 0x33, 0x37, 0x37, 0x38, 0x3c, 0x3c, 0x3e, 0x38, 0x32, 0x32, 0x32, 0x32, 0x32, 0x36, 0x36, 0x38, 0x38, 0x38, 0x3d, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x38, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3d, 0x3e, 0x3c, 0x3e, 0x31, 0x3e, 0x37, 0x37, 0x37, 0x43, 0x33, 0x22, 0x0b, 0x0b, 0x12, 0x19, 0x0f, 0x09, 0x0c, 0x13, 0x13, 0x08, 0x21, 0x25, 0x5f, 0x41, 0xa6, 0x00, 0xa8, 0x61, 0x00, 0x00, 0xa8, 0xb5, 0xf4, 0xa9, 0xf6, 0xba, 0xcf, 0xd8, 0xda, 0xdf, 0xe9, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xee, 0xee, 0xea, 0xea, 0xe3, 0xe1, 0xdd, 0xd9, 0xd7, 0xd1, 0xc0, 0xbb, 0xca, 0xca, 0xd0, 0xca, 0xcd, 0xc4, 0xc9, 0xc5, 0xc9, 0xc8, 0xc8, 0xc8, 0xc6, 0xcb, 0xc3, 0xc6, 0xd3, 0xc8, 0xc2, 0xc2, 0xc2, 0xcc, 0xc4, 0xbd, 0xdf, 0xf2, 0xa4, 0x8d, 0x63, 0x8d, 0x23, 0x9c, 0xa5, 0xf8, 0xb2, 0xab, 0xaa, 0xab, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 
-  0xaa, 0xb6, 0xb4, 0x01, 0xa4, 0x93, 0x8a, 0x68, 0x7b, 0x79, 0x75, 0x77, 0x7f, 0x77, 0x85, 0x85, 0x81, 0x85, 0x8a, 0x8f, 0x92, 0x92, 0x92, 0x8f, 0x81, 0x6e, 0x6e, 0x86, 0x86, 0x6e, 0x6b, 0x6a, 0x73, 0x91, 0x9d, 0xa3, 0x01, 0xef, 0xe0, 0xba, 0xb0, 0xb0, 0xaf, 0xac, 0xf9, 0xf4, 0xf4, 0xf9, 0x02, 0x02, 0x02, 0xfa, 0xb7, 0xf7, 0xcf, 0xda, 0xe8, 0xed, 0xf0, 0xf1, 0xf1, 0xf0, 0xea, 0xe6, 0xdb, 0xd9, 0xd2, 0xd1, 0xc0, 0xbd, 0xca, 0xca, 0xc4, 0xc1, 0xc1, 0xc8, 0xcc, 0xce, 0xc8, 0xc6, 0xce, 0xce, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc3, 0xce, 0xc3, 0xc3, 0xc3, 0xc8, 0xce, 0xc8, 0xcb, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc6, 0xc8, 0xc8, 0xc8, 0xcc, 0xcc, 0xcc, 0xc9, 0xc9, 0xc1, 0xcd, 0xc4, 0xc4, 0xc4, 0xbd, 0xbd, 0xc0, 0xca, 0xc0, 0xc0, 0xc7, 0xd1, 0xd6, 0xd7, 0xd9, 0xdd, 0xde, 0xe6, 0xea, 0xeb, 0xec, 0xed, 0xf2, 0x60, 0x5f, 0x5e, 0x5e, 0x56, 0x3a, 0x27, 0x40, 0x3b, 0x33, 0x34, 0x37, 0x37, 0x37, 0x36, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x36, 0x38, 0x3d, 0x3c, 0x3d, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x37, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x31, 0x43, 0x37, 0x34, 0x3b, 0x33, 0x22, 0x15, 0x0b, 0x12, 0x12, 0x0b, 0x0f, 0x10, 0x10, 0x07, 0x07, 0x1c, 0x25, 0x4d, 0x49, 0xfa, 0xaf, 0xb2, 0xb9, 0xba, 0xbc, 0xd8, 0xf8, 0xe5, 0xe9, 0xec, 0xec, 0xf0, 0xf3, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xeb, 0xea, 0xe6, 0xe1, 0xde, 0xd9, 0xd7, 0xd4, 0xd1, 0xca, 0xc4, 0xbd, 0xbd, 0xca, 0xca, 0xcd, 0xc1, 0xc1, 0xc9, 0xce, 0xd0, 0xce, 0xc5, 0xc5, 0xc8, 0xc8, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xbe, 0xc5, 0xc8, 0xce, 0xce, 0xc9, 0xc9, 0xc7, 0xc7, 0xe8, 0xa5, 0x9c, 0xcf, 0x17, 0x9e, 0xa7, 0xbf, 0xb1, 0xa9, 0xa9, 0xac, 0xaa, 0x00, 0xab, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 
-  0xb6, 0xcf, 0xa5, 0xa4, 0x96, 0x68, 0x76, 0x69, 0x79, 0x79, 0x75, 0x75, 0x75, 0x83, 0x85, 0x85, 0x8f, 0x8f, 0x8f, 0x87, 0x87, 0x7d, 0x70, 0x6e, 0x6b, 0x6b, 0x80, 0x80, 0x74, 0x74, 0x8e, 0x92, 0xa0, 0xa3, 0x01, 0xa5, 0xfd, 0xb3, 0xb0, 0xb0, 0xaf, 0xab, 0xa6, 0xa8, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xa6, 0xa6, 0x00, 0xa6, 0xb5, 0xfa, 0xb7, 0xb2, 0xb3, 0xd8, 0xe0, 0xe8, 0xef, 0xf2, 0xf2, 0xf1, 0xf0, 0xeb, 0xe5, 0xde, 0xd9, 0xd6, 0xd1, 0xca, 0xc4, 0xc1, 0xc1, 0xc5, 0xcc, 0xcc, 0xcc, 0xc5, 0xc1, 0xbe, 0xbe, 0xc5, 0xc9, 0xd3, 0xcc, 0xcc, 0xc5, 0xc5, 0xc8, 0xc8, 0xce, 0xcc, 0xcb, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc8, 0xcc, 0xce, 0xcc, 0xcc, 0xd3, 0xd0, 0xd3, 0xcd, 0xcd, 0xcd, 0xcd, 0xd0, 0xc4, 0xc4, 0xca, 0xca, 0xca, 0xc0, 0xc4, 0xca, 0xbd, 0xbb, 0xd1, 0xd2, 0xd2, 0xd8, 0x9e, 0x60, 0x5e, 0x5d, 0x4a, 0x2b, 0x24, 0x27, 0x37, 0x43, 0x34, 0x34, 0x2d, 0x34, 0x2d, 0x32, 0x32, 0x32, 0x2a, 0x32, 0x32, 0x32, 0x38, 0x3d, 0x3c, 0x3c, 0x3c, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x3e, 0x2d, 0x2d, 0x46, 0x33, 0x1d, 0x15, 0x0b, 0x15, 0x15, 0x0b, 0x06, 0x12, 0x19, 0x0c, 0x07, 0x28, 0x4f, 0x5a, 0xf3, 0x4e, 0xdf, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xee, 0xf0, 0xee, 0xe7, 0xe3, 0xe1, 0xe1, 0xdb, 0xd2, 0xd1, 0xca, 0xbd, 0xbd, 0xbd, 0xc4, 0xc4, 0xbd, 0xc4, 0xc4, 0xcd, 0xcd, 0xd0, 0xcd, 0xd3, 0xd0, 0xc8, 0xcc, 0xc8, 0xc5, 0xc2, 0xc5, 0xc8, 0xc6, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc3, 0xd3, 0xc9, 0xc5, 0xbe, 0xc2, 0xc9, 0xd0, 0xd6, 0xc0, 0xd8, 0xee, 0x01, 0xa7, 0xa4, 0xe8, 0xba, 0xb8, 0xa9, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xa6, 0xa6, 0x00, 0x00, 0x00, 0x00, 
-  0xba, 0xef, 0xa5, 0x99, 0x72, 0x72, 0x69, 0x84, 0x79, 0x7b, 0x7a, 0x7b, 0x7c, 0x79, 0x83, 0x83, 0x75, 0x71, 0x7a, 0x7b, 0x70, 0x6e, 0x78, 0x86, 0x80, 0x74, 0x73, 0x73, 0x8c, 0x1c, 0xa1, 0x5f, 0x60, 0xef, 0xfd, 0xbf, 0xb1, 0xb8, 0xb6, 0xa9, 0xab, 0xaa, 0x00, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0x00, 0xa6, 0xa6, 0xa6, 0xb5, 0x00, 0x00, 0xa8, 0x02, 0x02, 0xfa, 0xb8, 0xf7, 0xff, 0xda, 0xfd, 0xe8, 0xef, 0xf2, 0xf2, 0xf1, 0xf0, 0xeb, 0xe7, 0xdd, 0xdd, 0xd7, 0xca, 0xbd, 0xbd, 0xbe, 0xbb, 0xca, 0xd0, 0xd0, 0xd0, 0xd0, 0xc9, 0xbd, 0xbe, 0xcd, 0xc9, 0xcc, 0xc9, 0xcc, 0xc5, 0xc3, 0xbe, 0xc2, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc6, 0xc8, 0xcb, 0xc8, 0xc8, 0xc3, 0xc3, 0xc3, 0xc3, 0xbe, 0xc3, 0xc5, 0xc5, 0xc5, 0xc5, 0xc9, 0xc5, 0xc1, 0xc9, 0xcd, 0xcd, 0xc4, 0xc1, 0xc4, 0xc4, 0xd0, 0xca, 0xc0, 0xc0, 0xd8, 0xe9, 0xf3, 0x5f, 0x4d, 0x4a, 0x2b, 0x26, 0x40, 0x3b, 0x2d, 0x2d, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x32, 0x32, 0x32, 0x32, 0x34, 0x36, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x38, 0x36, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x2d, 0x34, 0x2a, 0x22, 0x12, 0x0b, 0x12, 0x0b, 0x12, 0x0b, 0x12, 0x14, 0x0c, 0x08, 0x1c, 0x57, 0x5f, 0xf3, 0xef, 0xf2, 0xf2, 0xee, 0xeb, 0xea, 0xe7, 0xe7, 0xe6, 0xe3, 0xde, 0xdd, 0xd9, 0xd7, 0xd6, 0xd1, 0xc7, 0xc7, 0xc0, 0xc0, 0xca, 0xca, 0xca, 0xc4, 0xc4, 0xcd, 0xd0, 0xcd, 0xd3, 0xc1, 0xcc, 0xcd, 0xcc, 0xc5, 0xc5, 0xbe, 0xbe, 0xce, 0xcb, 0xc8, 0xc2, 0xc3, 0xc2, 0xc3, 0xc8, 0xc8, 0xc8, 0xc3, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xcd, 0xc4, 0xc9, 0xcc, 0xcd, 0xcd, 0xc4, 0xbb, 0xd2, 0xe2, 0xef, 0xa5, 0xed, 0xdf, 0xb3, 0xb6, 0xaf, 0xb5, 0x00, 0x00, 0x00, 0x61, 0xb5, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd8, 0xf3, 0x9f, 0x8d, 0x67, 0x72, 0x69, 0x84, 0x7b, 0x7c, 0x7e, 0x70, 0x7b, 0x70, 0x6c, 0x76, 0x7b, 0x76, 0x6e, 0x76, 0x80, 0x78, 0x67, 0x64, 0x82, 0x8c, 0x94, 0x3f, 0x5c, 0x60, 0x5c, 0x4e, 0xdc, 0xbc, 0xb8, 0xb0, 0xb6, 0xac, 0xaa, 0x00, 0x00, 0xa8, 0xf9, 0x00, 0x61, 0xf9, 0x62, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x61, 0x00, 0x02, 0xad, 0xfa, 0xf6, 0x04, 0xb2, 0xbf, 0xda, 0xdf, 0xe8, 0xed, 0xf2, 0xf2, 0xf0, 0xf0, 0xeb, 0xea, 0xe3, 0xde, 0xdd, 0xd7, 0xca, 0xc0, 0xc0, 0xbd, 0xca, 0xca, 0xd4, 0xd4, 0xc4, 0xc1, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc5, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc8, 0xc8, 0xc8, 0xce, 0xc8, 0xc8, 0xc3, 0xc3, 0xc5, 0xc8, 0xc8, 0xc3, 0xc3, 0xcb, 0xcb, 0xc8, 0xc8, 0xc2, 0xc5, 0xcc, 0xcc, 0xcc, 0xc9, 0xc5, 0xc9, 0xc9, 0xc9, 0xbd, 0xbd, 0xd2, 0xdd, 0xe9, 0xf3, 0x60, 0x55, 0x30, 0x28, 0x1f, 0x2b, 0x2e, 0x2f, 0x2a, 0x33, 0x33, 0x32, 0x34, 0x2d, 0x36, 0x38, 0x37, 0x37, 0x36, 0x34, 0x36, 0x37, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x37, 0x38, 0x36, 0x35, 0x38, 0x35, 0x38, 0x38, 0x38, 0x37, 0x2d, 0x43, 0x3b, 0x22, 0x15, 0x12, 0x12, 0x0f, 0x12, 0x09, 0x0f, 0x19, 0x0c, 0x07, 0x1c, 0x57, 0x60, 0xf3, 0xfd, 0xe1, 0xe1, 0xd9, 0xd9, 0xd6, 0xd6, 0xd6, 0xd1, 0xc7, 0xca, 0xc7, 0xca, 0xc0, 0xca, 0xbd, 0xc4, 0xca, 0xc4, 0xc1, 0xc4, 0xd0, 0xc9, 0xc1, 0xcc, 0xc9, 0xc9, 0xc5, 0xc5, 0xbe, 0xc5, 0xc5, 0xc3, 0xc8, 0xc8, 0xcb, 0xce, 0xd3, 0xc3, 0xc2, 0xc3, 0xc8, 0xc6, 0xc8, 0xc8, 0xc2, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc9, 0xc1, 0xcd, 0xd0, 0xc9, 0xbe, 0xc1, 0xd4, 0xdb, 0xee, 0xec, 0xf2, 0xe9, 0xfc, 0xf6, 0xaf, 0xaf, 0xaa, 0x00, 0xb5, 0xf4, 0xb5, 0x00, 0x00, 0x62, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf8, 0xa4, 0x23, 0x65, 0x88, 0x80, 0x78, 0x68, 0x70, 0x81, 0x70, 0x7d, 0x6e, 0x76, 0x78, 0x76, 0x67, 0x6b, 0x74, 0x6a, 0x74, 0x89, 0x93, 0x98, 0x9f, 0xa3, 0xa5, 0xa5, 0xef, 0x9c, 0xd8, 0xfb, 0xb1, 0xb0, 0xaf, 0xb5, 0x00, 0x00, 0x61, 0x00, 0xf4, 0x00, 0x00, 0xa8, 0xa6, 0xa6, 0xa6, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x61, 0xaa, 0xb5, 0xb5, 0xaa, 0x00, 0x00, 0xa6, 0x61, 0x61, 0x61, 0x61, 0xac, 0xa9, 0xb6, 0xb1, 0xf7, 0xfb, 0xd8, 0xdc, 0xe8, 0xec, 0xf1, 0xf1, 0xf1, 0xf1, 0xee, 0xea, 0xe7, 0xe3, 0xde, 0xd9, 0xd6, 0xca, 0xc0, 0xbd, 0xca, 0xca, 0xc1, 0xc1, 0xc1, 0xcd, 0xc9, 0xcd, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc8, 0xc8, 0xce, 0xc3, 0xcb, 0xcb, 0xcb, 0xc6, 0xc2, 0xc8, 0xc3, 0xc2, 0xbe, 0xc2, 0xbe, 0xbe, 0xcc, 0xd3, 0xcd, 0xc7, 0xd6, 0xe1, 0xee, 0xf1, 0xf1, 0x5c, 0x5c, 0x4f, 0x4f, 0x44, 0x42, 0x3a, 0x29, 0x27, 0x2f, 0x33, 0x34, 0x37, 0x3e, 0x3c, 0x3c, 0x3c, 0x3d, 0x38, 0x38, 0x37, 0x37, 0x37, 0x38, 0x38, 0x3c, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x37, 0x36, 0x38, 0x36, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x32, 0x33, 0x22, 0x15, 0x0b, 0x0f, 0x12, 0x0f, 0x14, 0x09, 0x0c, 0x0d, 0x0d, 0x16, 0x4f, 0x60, 0xef, 0xda, 0xc0, 0xc0, 0xbb, 0xbd, 0xcd, 0xca, 0xc4, 0xc4, 0xbd, 0xc4, 0xc4, 0xca, 0xd0, 0xd0, 0xcd, 0xcd, 0xcd, 0xc9, 0xcc, 0xc9, 0xc5, 0xbe, 0xc5, 0xc5, 0xc5, 0xc9, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xc8, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0xcb, 0xc8, 0xc8, 0xc8, 0xc5, 0xc5, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xcd, 0xc9, 0xd1, 0xd0, 0xcd, 0xbd, 0xc5, 0xd9, 0xe7, 0xf0, 0xf0, 0xef, 0xf8, 0x04, 0x03, 0xfe, 0x02, 0x00, 0xf4, 0xf9, 0x00, 0x00, 0xf9, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 
-  0x17, 0xf3, 0x53, 0x94, 0x89, 0x89, 0x82, 0x8a, 0x74, 0x74, 0x74, 0x74, 0x82, 0x82, 0x88, 0x88, 0x8c, 0x90, 0x94, 0x99, 0x9d, 0xa2, 0xa4, 0x01, 0x01, 0xa4, 0x9e, 0xdc, 0xbc, 0xb1, 0xb0, 0xb0, 0xaf, 0xa9, 0xa6, 0xaa, 0xa8, 0x61, 0x61, 0xf9, 0x61, 0xf9, 0x61, 0x00, 0xa6, 0xa6, 0xab, 0xa6, 0xa6, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xab, 0xa6, 0x00, 0xa6, 0x61, 0xa8, 0xa6, 0x00, 0xaa, 0xaa, 0xae, 0xae, 0xa9, 0xaf, 0xb1, 0xb8, 0xba, 0xfc, 0xda, 0xdf, 0x4e, 0xed, 0xf1, 0xf1, 0xf1, 0xf0, 0xee, 0xeb, 0xe7, 0xe3, 0xde, 0xd9, 0xd6, 0xd1, 0xca, 0xbd, 0xbd, 0xbd, 0xbd, 0xca, 0xca, 0xca, 0xca, 0xcd, 0xc4, 0xcd, 0xcd, 0xc1, 0xc9, 0xc5, 0xc9, 0xc9, 0xc5, 0xc9, 0xc5, 0xc8, 0xc3, 0xc8, 0xc2, 0xc2, 0xc2, 0xcb, 0xce, 0xcb, 0xce, 0xce, 0xc5, 0xcc, 0xc9, 0xc1, 0xbb, 0xd9, 0xe5, 0xf1, 0xa5, 0xa4, 0x5c, 0x5f, 0x5a, 0x5f, 0x5d, 0x5d, 0x5b, 0x56, 0x56, 0x4c, 0x3a, 0x2e, 0x2f, 0x33, 0x33, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3e, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x37, 0x36, 0x37, 0x38, 0x37, 0x38, 0x36, 0x36, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x46, 0x22, 0x15, 0x12, 0x0f, 0x0f, 0x09, 0x14, 0x10, 0x0c, 0x0d, 0x07, 0x1c, 0x55, 0x60, 0xed, 0xdd, 0xbb, 0xd6, 0xd0, 0xc4, 0xcc, 0xd0, 0xbe, 0xc9, 0xc4, 0xcd, 0xcd, 0xcd, 0xcd, 0xc5, 0xbe, 0xbe, 0xce, 0xd3, 0xc3, 0xbe, 0xce, 0xce, 0xc8, 0xd3, 0xcc, 0xc8, 0xc3, 0xc5, 0xc8, 0xc3, 0xc3, 0xc8, 0xc3, 0xc6, 0xcb, 0xce, 0xcb, 0xcb, 0xc6, 0xc6, 0xc6, 0xc3, 0xc2, 0xc3, 0xc2, 0xc8, 0xcc, 0xc5, 0xc9, 0xc9, 0xcd, 0xc4, 0xcd, 0xca, 0xca, 0xbd, 0xbb, 0xd1, 0xde, 0xea, 0xee, 0xee, 0xeb, 0xfd, 0xbc, 0x03, 0xf6, 0xf4, 0xf9, 0x00, 0xf9, 0x00, 0x02, 0x61, 0x00, 0x61, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 
-  0xbc, 0x9e, 0x01, 0xa5, 0xa0, 0xa3, 0xa3, 0x9e, 0x9f, 0x9c, 0x9d, 0x9c, 0x9f, 0xa0, 0xa2, 0xa3, 0xa4, 0xa5, 0x01, 0x01, 0x01, 0xa5, 0xe9, 0x41, 0xd8, 0xbc, 0xb9, 0xb1, 0xb8, 0xaf, 0xa9, 0xab, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0xf4, 0xf4, 0xae, 0xb6, 0x03, 0xb9, 0xfb, 0xbf, 0xf8, 0xe2, 0xe8, 0xed, 0xf1, 0xf1, 0xf2, 0xf2, 0xee, 0xee, 0xeb, 0xe6, 0xe1, 0xde, 0xdb, 0xd6, 0xc7, 0xc7, 0xc0, 0xc0, 0xc0, 0xc7, 0xca, 0xca, 0xca, 0xca, 0xcd, 0xc1, 0xc9, 0xd3, 0xcd, 0xc5, 0xc9, 0xcc, 0xc9, 0xc2, 0xc2, 0xc2, 0xc6, 0xc2, 0xc3, 0xc6, 0xc8, 0xc3, 0xd0, 0xc1, 0xca, 0xdb, 0xe9, 0x60, 0x5c, 0x97, 0x89, 0x8c, 0x90, 0x91, 0x9b, 0x9b, 0xa1, 0x5a, 0x5d, 0x5d, 0x5b, 0x5b, 0x51, 0x42, 0x20, 0x3a, 0x2a, 0x3b, 0x38, 0x2c, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x3d, 0x2a, 0x2c, 0x36, 0x45, 0x3c, 0x2c, 0x2d, 0x43, 0x24, 0x12, 0x0f, 0x10, 0x09, 0x09, 0x0f, 0x0f, 0x0c, 0x07, 0x0a, 0x1c, 0x55, 0xf3, 0xf0, 0xdb, 0xc7, 0xca, 0xc9, 0xc9, 0xcc, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc8, 0xc2, 0xc2, 0xc2, 0xce, 0xcb, 0xc8, 0xc2, 0xcb, 0xc3, 0xcb, 0xc8, 0xcb, 0xc2, 0xc8, 0xc2, 0xcb, 0xc8, 0xcb, 0xcb, 0xc2, 0xc8, 0xcb, 0xce, 0xcb, 0xc2, 0xc6, 0xcb, 0xc6, 0xc6, 0xc6, 0xc6, 0xcb, 0xcb, 0xc2, 0xc2, 0xc5, 0xc9, 0xc4, 0xca, 0xca, 0xc7, 0xca, 0xc7, 0xdb, 0xe1, 0xea, 0xf0, 0xf1, 0xed, 0xe1, 0xcf, 0xb1, 0xb7, 0xad, 0xf9, 0x61, 0x61, 0xf9, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xf5, 0xb3, 0xf8, 0xe9, 0xa7, 0xef, 0xa5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xa5, 0xef, 0xa7, 0xe9, 0xe4, 0xdc, 0xd5, 0xbf, 0xb9, 0xb0, 0xb9, 0xb0, 0xaf, 0xaf, 0xae, 0xac, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x61, 0x02, 0xad, 0xf5, 0xb6, 0xfe, 0xf6, 0xb2, 0xb3, 0xfc, 0xda, 0xdf, 0xe2, 0xec, 0xed, 0xf3, 0xf2, 0xf2, 0xf1, 0xee, 0xee, 0xe7, 0xe7, 0xe3, 0xe1, 0xdb, 0xd7, 0xd2, 0xc7, 0xc0, 0xc0, 0xbd, 0xbb, 0xbd, 0xc4, 0xcd, 0xca, 0xc4, 0xcd, 0xcd, 0xd0, 0xcc, 0xc2, 0xc2, 0xc2, 0xd3, 0xd3, 0xc3, 0xd0, 0xca, 0xc0, 0xe1, 0xa5, 0x01, 0x47, 0x91, 0x82, 0x72, 0x67, 0x6b, 0x6b, 0x6a, 0x74, 0x88, 0x8e, 0x93, 0x9b, 0xa1, 0x5f, 0x5d, 0x5b, 0x44, 0x3a, 0x29, 0x40, 0x32, 0x2c, 0x3e, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x36, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x37, 0x36, 0x32, 0x38, 0x2c, 0x38, 0x43, 0x2d, 0x22, 0x15, 0x12, 0x10, 0x14, 0x10, 0x0f, 0x10, 0x10, 0x13, 0x0a, 0x1c, 0x59, 0x60, 0xec, 0xdd, 0xc0, 0xcd, 0xc1, 0xc5, 0xc5, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xc3, 0xc3, 0xc3, 0xc6, 0xc2, 0xc3, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xbe, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xcb, 0xc3, 0xc6, 0xc6, 0xc6, 0xcb, 0xce, 0xcc, 0xcc, 0xc1, 0xcd, 0xca, 0xc4, 0xc0, 0xd6, 0xdd, 0xe3, 0xec, 0xf3, 0xf3, 0xed, 0xdf, 0xbf, 0xb8, 0xfa, 0xac, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x02, 0xb7, 0xb3, 0xbc, 0xbc, 0xfc, 0xd5, 0xd5, 0xd5, 0x17, 0x17, 0xd5, 0xcf, 0xbf, 0xfb, 0xf7, 0xf7, 0xb2, 0xb8, 0xb8, 0xb8, 0xb0, 0xb6, 0xa9, 0xa8, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x02, 0xb5, 0xf9, 0x02, 0xf4, 0xae, 0xb7, 0xb1, 0xba, 0xb9, 0xfb, 0xd8, 0xdc, 0xe2, 0xe8, 0xee, 0xf2, 0xf2, 0xf1, 0xf1, 0xee, 0xee, 0xeb, 0xeb, 0xeb, 0xe6, 0xe1, 0xe1, 0xd9, 0xd7, 0xd1, 0xca, 0xbd, 0xd1, 0xbd, 0xbd, 0xbd, 0xc1, 0xbd, 0xc1, 0xd0, 0xbe, 0xc4, 0xd4, 0xbb, 0xd2, 0xeb, 0xa5, 0xa5, 0x9b, 0x8e, 0x67, 0x68, 0x84, 0x79, 0x76, 0x84, 0x81, 0x81, 0x70, 0x6b, 0x6b, 0x74, 0x8b, 0x90, 0xa1, 0x5e, 0x58, 0x3a, 0x29, 0x40, 0x2a, 0x43, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x37, 0x38, 0x36, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x36, 0x43, 0x32, 0x2d, 0x33, 0x43, 0x22, 0x15, 0x0b, 0x0f, 0x0f, 0x09, 0x14, 0x10, 0x10, 0x0c, 0x0a, 0x1c, 0x59, 0x60, 0xf1, 0xd9, 0xc0, 0xbd, 0xc9, 0xc8, 0xc6, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc6, 0xc6, 0xc6, 0xc2, 0xc6, 0xcb, 0xc6, 0xc6, 0xc6, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xcb, 0xce, 0xcb, 0xce, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xce, 0xcc, 0xc8, 0xcc, 0xce, 0xce, 0xcc, 0xc5, 0xcc, 0xc5, 0xd3, 0xcc, 0xc9, 0xc1, 0xc1, 0xc1, 0xc4, 0xca, 0xd1, 0xdd, 0xe6, 0xee, 0xf1, 0xf1, 0xf1, 0xe8, 0xda, 0xba, 0xf6, 0xaf, 0xae, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x02, 0x02, 0xa8, 0x02, 0xad, 0xfe, 0xb6, 0xb6, 0xfe, 0xfe, 0xb6, 0xfe, 0xb6, 0xfe, 0xfe, 0xfe, 0xb6, 0xb6, 0xaf, 0xad, 0xac, 0xac, 0xa8, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0xaa, 0xb5, 0xac, 0xaf, 0xaf, 0xb6, 0xb0, 0xb0, 0xb8, 0xba, 0xbc, 0xd2, 0xda, 0xe2, 0xea, 0xed, 0xee, 0xee, 0xee, 0xf0, 0xf1, 0xf0, 0xf0, 0xeb, 0xeb, 0xe7, 0xe7, 0xe3, 0xde, 0xd9, 0xd7, 0xd7, 0xd1, 0xca, 0xc7, 0xd1, 0xc0, 0xbb, 0xdf, 0xf0, 0xa5, 0xa4, 0x94, 0x82, 0x78, 0x76, 0x79, 0x79, 0x6f, 0x6f, 0x84, 0x6c, 0x6c, 0x7b, 0x79, 0x70, 0x70, 0x6e, 0x80, 0x8e, 0x4a, 0x5d, 0x56, 0x3a, 0x2f, 0x2a, 0x36, 0x36, 0x38, 0x3c, 0x38, 0x3c, 0x37, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x37, 0x2a, 0x2d, 0x46, 0x3b, 0x1d, 0x15, 0x0b, 0x0b, 0x15, 0x0b, 0x09, 0x14, 0x0c, 0x07, 0x11, 0x1c, 0x5f, 0xf3, 0xed, 0xd9, 0xd2, 0xbe, 0xcd, 0xc8, 0xc8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xcb, 0xc2, 0xcb, 0xcb, 0xcb, 0xc2, 0xcb, 0xc2, 0xc2, 0xc8, 0xc8, 0xc3, 0xc8, 0xc3, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xc5, 0xc5, 0xc5, 0xc5, 0xbe, 0xbe, 0xc5, 0xbe, 0xcd, 0xc9, 0xc9, 0xc1, 0xcd, 0xca, 0xc4, 0xbd, 0xbd, 0xca, 0xd1, 0xd7, 0xe1, 0xe6, 0xeb, 0xee, 0xf0, 0xeb, 0xe8, 0xe5, 0xbf, 0xf7, 0xb0, 0xb6, 0xaf, 0xae, 0x00, 0x00, 0xb5, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x61, 0x02, 0x02, 0x00, 0xa8, 0x61, 0x61, 0x00, 0x00, 0x61, 0x61, 0xb5, 0x00, 0xaa, 0x61, 0xaa, 0xa8, 0xa8, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xac, 0xa9, 0xa9, 0xae, 0xaf, 0xb8, 0xb8, 0xb8, 0xb2, 0xb9, 0xfb, 0xd5, 0xdc, 0xdf, 0xe2, 0xe5, 0xeb, 0xee, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xf0, 0xea, 0xe6, 0xe5, 0xf8, 0xe9, 0xa4, 0xa5, 0xa2, 0x91, 0x6d, 0x6b, 0x7e, 0x79, 0x69, 0x69, 0x6f, 0x6f, 0x69, 0x83, 0x7f, 0x75, 0x83, 0x79, 0x79, 0x70, 0x6e, 0x6a, 0x90, 0x57, 0x5b, 0x4b, 0x27, 0x2a, 0x34, 0x35, 0x35, 0x37, 0x3c, 0x38, 0x38, 0x38, 0x36, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x2d, 0x34, 0x3b, 0x2f, 0x24, 0x12, 0x09, 0x0b, 0x12, 0x15, 0x12, 0x0f, 0x14, 0x07, 0x0d, 0x21, 0x5f, 0xf2, 0xed, 0xd2, 0xd1, 0xbd, 0xd3, 0xbe, 0xc3, 0xc6, 0xc3, 0xc6, 0xc3, 0xc6, 0xc2, 0xc6, 0xc2, 0xc2, 0xc8, 0xc2, 0xc2, 0xc2, 0xc8, 0xc2, 0xc5, 0xc2, 0xc5, 0xc8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcc, 0xcd, 0xc9, 0xd0, 0xd0, 0xd0, 0xcd, 0xc1, 0xc4, 0xc4, 0xca, 0xc0, 0xc0, 0xd2, 0xd7, 0xdd, 0xe3, 0xea, 0xee, 0xee, 0xee, 0xf0, 0xec, 0xe2, 0xd8, 0xba, 0xb0, 0xb8, 0xaf, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x02, 0xa8, 0xa8, 0x02, 0x02, 0x61, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0xa8, 0xa8, 0xa8, 0xaa, 0x61, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xa8, 0xaa, 0x00, 0xaa, 0x00, 0xb5, 0x02, 0xae, 0xf5, 0xaf, 0xae, 0xaf, 0xb6, 0xb0, 0xb0, 0xb1, 0xf7, 0xb3, 0xbf, 0xcf, 0xd5, 0xe5, 0xe5, 0xe8, 0xea, 0xec, 0xee, 0xf2, 0xf2, 0xf3, 0x01, 0x5c, 0x60, 0x9b, 0x88, 0x73, 0x78, 0x81, 0x7b, 0x79, 0x6f, 0x77, 0x83, 0x85, 0x7f, 0x7c, 0x75, 0x6c, 0x77, 0x77, 0x83, 0x79, 0x7e, 0x6a, 0x82, 0x4a, 0x5b, 0x4c, 0x2f, 0x40, 0x32, 0x32, 0x35, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2d, 0x43, 0x40, 0x1d, 0x0f, 0x0f, 0x0f, 0x12, 0x0f, 0x12, 0x0f, 0x09, 0x07, 0x18, 0x30, 0x5a, 0xf2, 0xea, 0xd6, 0xd2, 0xbd, 0xd3, 0xbe, 0xcb, 0xcb, 0xc6, 0xcb, 0xc8, 0xcb, 0xc8, 0xcb, 0xc8, 0xcc, 0xcc, 0xc9, 0xcc, 0xc9, 0xcc, 0xc9, 0xc9, 0xd3, 0xcd, 0xcc, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xcd, 0xcd, 0xc4, 0xc9, 0xc4, 0xc4, 0xc4, 0xc4, 0xbb, 0xc1, 0xc0, 0xbd, 0xc0, 0xd4, 0xd7, 0xd9, 0xe3, 0xe5, 0xea, 0xee, 0xf1, 0xf1, 0xf0, 0xee, 0xe9, 0xdf, 0xbf, 0xb2, 0xb8, 0xb0, 0xfe, 0xfa, 0xab, 0xaa, 0xaa, 0xab, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0xa8, 0xf9, 0x00, 0xf9, 0xad, 0xfa, 0xfa, 0xaf, 0xb6, 0xf6, 0xb8, 0xb1, 0xb2, 0xb1, 0xb1, 0xb2, 0xb9, 0xb9, 0xba, 0xda, 0xe9, 0x5c, 0x60, 0xa3, 0x93, 0x82, 0x78, 0x6e, 0x81, 0x7e, 0x71, 0x75, 0x83, 0x7f, 0x6c, 0x71, 0x71, 0x7d, 0x7d, 0x75, 0x7f, 0x83, 0x77, 0x7a, 0x76, 0x86, 0x66, 0x9b, 0x5b, 0x52, 0x2e, 0x2f, 0x32, 0x35, 0x35, 0x37, 0x3c, 0x37, 0x3c, 0x38, 0x35, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x36, 0x38, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x2d, 0x2a, 0x1d, 0x12, 0x0b, 0x0f, 0x14, 0x0f, 0x0f, 0x09, 0x0c, 0x07, 0x18, 0x47, 0x5d, 0xf3, 0xe4, 0xd6, 0xc7, 0xca, 0xd0, 0xbe, 0xc5, 0xd3, 0xcc, 0xcc, 0xc9, 0xc9, 0xcd, 0xc9, 0xcd, 0xc9, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xc4, 0xcd, 0xca, 0xcd, 0xc4, 0xc4, 0xbd, 0xc1, 0xbd, 0xc4, 0xc4, 0xbb, 0xbd, 0xbd, 0xc7, 0xca, 0xd1, 0xd1, 0xd6, 0xd9, 0xdd, 0xde, 0xe3, 0xe6, 0xeb, 0xee, 0xf0, 0xf2, 0xf2, 0xf1, 0xee, 0xe8, 0xdf, 0xd5, 0xbc, 0xb8, 0xb1, 0xb1, 0xb6, 0xad, 0x00, 0x00, 0x00, 0xb5, 0xaa, 0xaa, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x02, 0xf4, 0x02, 0xf9, 0xa8, 0xa9, 0xa9, 0xb6, 0xb8, 0xb6, 0xf6, 0x17, 0x5f, 0x5f, 0x9f, 0x90, 0x6b, 0x78, 0x7e, 0x7e, 0x7a, 0x7b, 0x71, 0x6c, 0x75, 0x77, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x77, 0x77, 0x6f, 0x7a, 0x84, 0x72, 0x66, 0x9b, 0x58, 0x56, 0x27, 0x2a, 0x32, 0x32, 0x35, 0x35, 0x38, 0x3c, 0x38, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x38, 0x36, 0x38, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x36, 0x37, 0x34, 0x33, 0x1a, 0x0b, 0x0b, 0x0f, 0x12, 0x09, 0x10, 0x0c, 0x0c, 0x0a, 0x1c, 0x47, 0x5e, 0x60, 0xe4, 0xd8, 0xc0, 0xc0, 0xc7, 0xbd, 0xc1, 0xc4, 0xbe, 0xbd, 0xc1, 0xbd, 0xc4, 0xbd, 0xc0, 0xbd, 0xc0, 0xbd, 0xc0, 0xbd, 0xc0, 0xbd, 0xc0, 0xbd, 0xc0, 0xca, 0xd1, 0xca, 0xd1, 0xd6, 0xd7, 0xd9, 0xd9, 0xde, 0xde, 0xe1, 0xe3, 0xe7, 0xea, 0xeb, 0xeb, 0xee, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xeb, 0xe8, 0xe2, 0xdc, 0xcf, 0xb3, 0xb9, 0xb1, 0xb8, 0xb6, 0xaf, 0xad, 0x00, 0x00, 0x00, 0xa6, 0x61, 0xa6, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0xaa, 0xaa, 0xb5, 0xb7, 0xbc, 0x49, 0x60, 0x5c, 0x9b, 0x88, 0x67, 0x81, 0x70, 0x71, 0x83, 0x6c, 0x75, 0x75, 0x6f, 0x77, 0x77, 0x75, 0x7d, 0x7d, 0x7d, 0x7c, 0x75, 0x77, 0x77, 0x6f, 0x69, 0x84, 0x76, 0x72, 0x4a, 0x5b, 0x52, 0x26, 0x46, 0x32, 0x35, 0x35, 0x38, 0x38, 0x3c, 0x3c, 0x38, 0x35, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x36, 0x3e, 0x43, 0x36, 0x2c, 0x2c, 0x36, 0x45, 0x36, 0x3e, 0x37, 0x2d, 0x34, 0x34, 0x2d, 0x2a, 0x1a, 0x12, 0x0b, 0x0b, 0x0b, 0x0f, 0x09, 0x14, 0x0a, 0x08, 0x1c, 0x55, 0x5f, 0x5c, 0x4e, 0xbf, 0xd8, 0xd2, 0xd6, 0xd6, 0xd6, 0xd4, 0xd7, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xdb, 0xde, 0xde, 0xde, 0xde, 0xe1, 0xe3, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xe7, 0xeb, 0xee, 0xee, 0xf0, 0xf0, 0xee, 0xf0, 0xf1, 0xf1, 0xf2, 0xf0, 0xee, 0xec, 0xee, 0xe9, 0xe2, 0xdf, 0xda, 0xcf, 0xb3, 0xb9, 0xb2, 0xb1, 0xf6, 0xb6, 0xfa, 0xad, 0xf4, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x62, 0x62, 0x61, 0x00, 0xb5, 0xb6, 0xf6, 0xd5, 0xa4, 0x60, 0xa2, 0x96, 0x88, 0x68, 0x76, 0x87, 0x6f, 0x69, 0x83, 0x75, 0x6f, 0x6f, 0x77, 0x6f, 0x77, 0x75, 0x7c, 0x7d, 0x7d, 0x7a, 0x75, 0x77, 0x77, 0x6f, 0x6f, 0x76, 0x68, 0x8c, 0x57, 0x58, 0x4b, 0x26, 0x3b, 0x32, 0x35, 0x35, 0x35, 0x3c, 0x37, 0x3c, 0x36, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x36, 0x36, 0x36, 0x3e, 0x36, 0x38, 0x38, 0x36, 0x38, 0x37, 0x2d, 0x34, 0x34, 0x3b, 0x22, 0x1a, 0x0b, 0x0b, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x07, 0x08, 0x1b, 0x4d, 0xa5, 0x01, 0xf2, 0xa7, 0xf0, 0xec, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xee, 0xee, 0xeb, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf0, 0xf0, 0xee, 0xec, 0xea, 0xe8, 0xe5, 0xe5, 0xdf, 0xdc, 0xd5, 0xbf, 0xbc, 0xf7, 0xb9, 0xb8, 0xf6, 0xb6, 0xfe, 0xae, 0xf4, 0xae, 0xf4, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0xf9, 0xb5, 0xf6, 0xb1, 0xe0, 0x5c, 0xa5, 0x9d, 0x8e, 0x72, 0x69, 0x68, 0x79, 0x84, 0x6c, 0x79, 0x85, 0x6c, 0x79, 0x6f, 0x6f, 0x6f, 0x77, 0x75, 0x7d, 0x7a, 0x7d, 0x7a, 0x77, 0x77, 0x6f, 0x83, 0x7b, 0x6e, 0x67, 0x95, 0x5d, 0x58, 0x3a, 0x2f, 0x32, 0x2a, 0x35, 0x35, 0x38, 0x37, 0x3c, 0x38, 0x38, 0x35, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x36, 0x2c, 0x36, 0x36, 0x43, 0x3e, 0x38, 0x2c, 0x2d, 0x34, 0x34, 0x3b, 0x2a, 0x22, 0x15, 0x0b, 0x09, 0x0f, 0x12, 0x0b, 0x0f, 0x14, 0x0c, 0x0a, 0x21, 0x5f, 0x01, 0xa5, 0xf1, 0xa7, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xeb, 0xeb, 0xeb, 0xea, 0xeb, 0xec, 0xed, 0xf0, 0xef, 0xed, 0xe9, 0xe8, 0xe5, 0xe2, 0xe2, 0xdf, 0xdf, 0xdf, 0xdc, 0xdc, 0xda, 0xd8, 0xd8, 0xd5, 0xcf, 0xbf, 0xba, 0xba, 0xb9, 0xb1, 0xb1, 0xb8, 0xb8, 0xf6, 0xb0, 0xf6, 0xf6, 0xb7, 0xb7, 0xfe, 0xfa, 0x02, 0x62, 0xf9, 0x62, 0xa8, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa8, 0x00, 0x00, 0xac, 0xb6, 0xfb, 0x53, 0x60, 0xa3, 0x99, 0x88, 0x68, 0x76, 0x84, 0x84, 0x6f, 0x69, 0x79, 0x85, 0x7b, 0x6c, 0x71, 0x6f, 0x77, 0x6f, 0x77, 0x75, 0x7a, 0x7d, 0x7d, 0x7a, 0x75, 0x6f, 0x6c, 0x84, 0x81, 0x6b, 0x88, 0xa1, 0x5b, 0x52, 0x26, 0x40, 0x2a, 0x35, 0x35, 0x35, 0x38, 0x3c, 0x37, 0x38, 0x36, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x36, 0x36, 0x2c, 0x37, 0x38, 0x38, 0x37, 0x37, 0x2d, 0x34, 0x46, 0x2a, 0x1d, 0x15, 0x0b, 0x09, 0x14, 0x09, 0x09, 0x10, 0x09, 0x07, 0x18, 0x21, 0x5a, 0xa5, 0xe9, 0xd8, 0xd8, 0xdc, 0xbf, 0xcf, 0xbf, 0xbf, 0xbc, 0xbc, 0xb3, 0xb3, 0xba, 0xb3, 0xb9, 0xb9, 0xb9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xb9, 0xb2, 0xb2, 0xb1, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb1, 0xf6, 0xb6, 0xaf, 0xad, 0xa9, 0xfa, 0xae, 0xad, 0xac, 0xb5, 0xf9, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xf4, 0x02, 0x00, 0xad, 0xb9, 0xcf, 0x53, 0xa3, 0x5c, 0x94, 0x72, 0x84, 0x76, 0x79, 0x69, 0x79, 0x79, 0x75, 0x83, 0x7a, 0x6c, 0x7a, 0x79, 0x71, 0x79, 0x75, 0x75, 0x7c, 0x71, 0x7d, 0x85, 0x7a, 0x75, 0x71, 0x7b, 0x70, 0x78, 0x6a, 0x95, 0x5b, 0x58, 0x42, 0x27, 0x3b, 0x2a, 0x43, 0x39, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x36, 0x36, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x36, 0x37, 0x2c, 0x38, 0x37, 0x37, 0x34, 0x33, 0x2a, 0x1d, 0x12, 0x09, 0x0b, 0x14, 0x10, 0x0c, 0x0c, 0x0d, 0x0d, 0x11, 0x21, 0x47, 0x5c, 0xfd, 0xb9, 0xb0, 0xb0, 0xaf, 0xb0, 0xaf, 0xb7, 0xb7, 0xb0, 0xb6, 0xb0, 0xb0, 0xb0, 0xb7, 0x03, 0xf6, 0xfe, 0xfa, 0xf4, 0x02, 0xab, 0xb5, 0xa9, 0xad, 0xa9, 0xac, 0xad, 0xa9, 0xad, 0xad, 0xf4, 0xad, 0xae, 0xad, 0x02, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x62, 0x62, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xad, 0xf7, 0xe0, 0xa5, 0xa3, 0xa1, 0x8c, 0x6a, 0x78, 0x6e, 0x79, 0x79, 0x69, 0x77, 0x7f, 0x7c, 0x7c, 0x6c, 0x69, 0x83, 0x71, 0x79, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7d, 0x71, 0x7c, 0x71, 0x83, 0x7e, 0x6e, 0x74, 0x8b, 0x54, 0x5d, 0x4c, 0x3a, 0x27, 0x3b, 0x2a, 0x3d, 0x3e, 0x3c, 0x3c, 0x38, 0x38, 0x37, 0x36, 0x36, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x38, 0x38, 0x37, 0x2c, 0x2d, 0x2d, 0x43, 0x3b, 0x22, 0x1a, 0x12, 0x0b, 0x0f, 0x0f, 0x14, 0x06, 0x0d, 0x0d, 0x08, 0x16, 0x30, 0x4d, 0x53, 0xf8, 0xb9, 0xb7, 0xa9, 0xaa, 0xac, 0xab, 0xf4, 0xa8, 0xf9, 0x61, 0xb5, 0xaa, 0xa8, 0xa8, 0xb5, 0x61, 0x61, 0x61, 0x61, 0x00, 0xaa, 0xb5, 0xab, 0xaa, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xaa, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xaa, 0xa8, 0xb6, 0xbf, 0x41, 0xa7, 0xa5, 0x9b, 0x8b, 0x72, 0x78, 0x76, 0x79, 0x6c, 0x7f, 0x85, 0x7d, 0x7d, 0x71, 0x7a, 0x75, 0x77, 0x77, 0x75, 0x71, 0x75, 0x77, 0x77, 0x75, 0x7a, 0x7c, 0x6c, 0x7f, 0x75, 0x7a, 0x85, 0x6b, 0x8a, 0x9a, 0x5b, 0x58, 0x2b, 0x29, 0x2f, 0x32, 0x2c, 0x3e, 0x3c, 0x3c, 0x3c, 0x3c, 0x37, 0x37, 0x32, 0x36, 0x36, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x37, 0x37, 0x38, 0x37, 0x38, 0x2d, 0x2d, 0x22, 0x1a, 0x0b, 0x0b, 0x0f, 0x14, 0x10, 0x10, 0x0c, 0x13, 0x11, 0x16, 0x25, 0x53, 0x49, 0xb4, 0xf6, 0xf5, 0xf4, 0x02, 0x00, 0x00, 0xac, 0x00, 0x61, 0x61, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf9, 0x61, 0xf9, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0xa6, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x61, 0xf9, 0x61, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xf4, 0x03, 0xd5, 0xa3, 0x01, 0xa2, 0x94, 0x82, 0x68, 0x6e, 0x7e, 0x79, 0x75, 0x7f, 0x71, 0x7d, 0x7d, 0x7d, 0x7d, 0x71, 0x7f, 0x7f, 0x6f, 0x77, 0x6f, 0x77, 0x77, 0x75, 0x75, 0x7a, 0x7a, 0x75, 0x83, 0x6f, 0x6c, 0x7e, 0x6b, 0x90, 0x5b, 0x5b, 0x52, 0x26, 0x24, 0x40, 0x2a, 0x43, 0x2c, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x37, 0x36, 0x36, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x2c, 0x43, 0x43, 0x43, 0x2a, 0x22, 0x15, 0x0b, 0x0b, 0x0f, 0x0f, 0x10, 0x09, 0x0c, 0x0d, 0x0a, 0x16, 0x3f, 0xa3, 0x4e, 0xd5, 0xb6, 0xf5, 0xf9, 0x00, 0x61, 0xf4, 0x61, 0x00, 0xb5, 0x00, 0x00, 0x61, 0x61, 0xaa, 0xaa, 0x61, 0x61, 0x00, 0x00, 0x61, 0x00, 0xaa, 0xaa, 0xaa, 0xab, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0xa8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0xa6, 0xa6, 0xab, 0xaa, 0xae, 0xb2, 0xb4, 0xa4, 0xa4, 0x9f, 0x91, 0x66, 0x6e, 0x7e, 0x71, 0x7b, 0x79, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7c, 0x7c, 0x7a, 0x7a, 0x75, 0x77, 0x6f, 0x6f, 0x75, 0x7a, 0x7c, 0x7d, 0x7d, 0x7b, 0x79, 0x6c, 0x6c, 0x84, 0x6b, 0x8b, 0xa1, 0x5e, 0x52, 0x4b, 0x27, 0x27, 0x3b, 0x32, 0x36, 0x31, 0x38, 0x3c, 0x38, 0x38, 0x37, 0x37, 0x36, 0x2d, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3e, 0x3c, 0x3c, 0x38, 0x38, 0x36, 0x36, 0x37, 0x36, 0x2c, 0x3e, 0x3d, 0x3d, 0x31, 0x38, 0x2c, 0x38, 0x43, 0x2d, 0x2d, 0x34, 0x43, 0x2a, 0x1a, 0x0b, 0x09, 0x14, 0x0c, 0x09, 0x13, 0x14, 0x0c, 0x07, 0x0e, 0x1e, 0x9e, 0x59, 0xfd, 0xb3, 0xf5, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x02, 0xf9, 0x00, 0xa6, 0xa8, 0xa6, 0xaa, 0xaf, 0xfb, 0x9e, 0x01, 0xa3, 0x9d, 0x8c, 0x64, 0x86, 0x76, 0x75, 0x71, 0x75, 0x7a, 0x79, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x75, 0x6f, 0x77, 0x75, 0x7a, 0x7d, 0x7d, 0x7d, 0x7b, 0x7b, 0x6c, 0x84, 0x78, 0x6a, 0x9d, 0x5e, 0x57, 0x4b, 0x2f, 0x2a, 0x32, 0x32, 0x2d, 0x2d, 0x3e, 0x38, 0x3e, 0x38, 0x38, 0x38, 0x36, 0x37, 0x36, 0x36, 0x2d, 0x37, 0x37, 0x36, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x3e, 0x38, 0x37, 0x32, 0x36, 0x32, 0x38, 0x38, 0x39, 0x3c, 0x3d, 0x3c, 0x3e, 0x3e, 0x43, 0x2d, 0x37, 0x34, 0x3b, 0x22, 0x1a, 0x12, 0x0f, 0x10, 0x09, 0x13, 0x13, 0x0c, 0x07, 0x06, 0x1c, 0x30, 0xe4, 0xa7, 0xb4, 0xb2, 0xf5, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa6, 0xa8, 0xb5, 0xab, 0xb6, 0xcf, 0xa7, 0x53, 0x5c, 0x9b, 0x6a, 0x66, 0x87, 0x76, 0x71, 0x79, 0x7a, 0x79, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x75, 0x7a, 0x7a, 0x75, 0x77, 0x77, 0x7a, 0x7a, 0x7d, 0x7d, 0x7c, 0x7a, 0x69, 0x87, 0x6b, 0x6a, 0x9a, 0x57, 0x5d, 0x48, 0x2e, 0x2a, 0x2a, 0x3b, 0x32, 0x2d, 0x2d, 0x3e, 0x38, 0x3c, 0x38, 0x38, 0x37, 0x37, 0x36, 0x2d, 0x37, 0x36, 0x36, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x38, 0x38, 0x36, 0x36, 0x32, 0x36, 0x36, 0x36, 0x38, 0x3d, 0x38, 0x38, 0x37, 0x43, 0x37, 0x3e, 0x34, 0x2d, 0x24, 0x15, 0x09, 0x09, 0x14, 0x0f, 0x19, 0x06, 0x0c, 0x0d, 0x11, 0x21, 0x25, 0x53, 0x4e, 0x17, 0x03, 0xad, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xab, 0xab, 0xaa, 0xab, 0xb2, 0xf8, 0xa7, 0x60, 0xa2, 0x91, 0x64, 0x72, 0x86, 0x6e, 0x6c, 0x71, 0x75, 0x71, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x7a, 0x71, 0x7a, 0x7a, 0x7f, 0x75, 0x71, 0x8a, 0x66, 0x94, 0x5e, 0x5b, 0x48, 0x29, 0x2f, 0x2a, 0x3b, 0x43, 0x34, 0x2d, 0x2c, 0x3e, 0x3e, 0x38, 0x38, 0x38, 0x38, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x37, 0x36, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x38, 0x3e, 0x38, 0x3c, 0x36, 0x36, 0x32, 0x32, 0x32, 0x36, 0x36, 0x35, 0x38, 0x2c, 0x37, 0x2d, 0x34, 0x34, 0x43, 0x2a, 0x1a, 0x12, 0x0f, 0x09, 0x09, 0x14, 0x14, 0x06, 0x14, 0x0c, 0x11, 0x21, 0x30, 0x59, 0x9e, 0xb3, 0xb7, 0xf5, 0x61, 0x00, 0x02, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0xaa, 0xa6, 0xab, 0xaa, 0xab, 0xae, 0xb2, 0xe0, 0x01, 0x5c, 0x9d, 0x90, 0x74, 0x78, 0x81, 0x7e, 0x7a, 0x6c, 0x75, 0x71, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x75, 0x7a, 0x75, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x77, 0x7a, 0x87, 0x68, 0x91, 0x57, 0x5b, 0x56, 0x2e, 0x3b, 0x3b, 0x34, 0x32, 0x43, 0x36, 0x38, 0x38, 0x3e, 0x38, 0x3c, 0x38, 0x38, 0x37, 0x37, 0x36, 0x2d, 0x36, 0x37, 0x36, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3d, 0x38, 0x36, 0x36, 0x32, 0x32, 0x32, 0x32, 0x36, 0x36, 0x36, 0x36, 0x43, 0x34, 0x34, 0x2a, 0x2a, 0x1a, 0x0b, 0x09, 0x0f, 0x10, 0x10, 0x09, 0x09, 0x19, 0x0c, 0x18, 0x21, 0x47, 0xa4, 0xf8, 0xf7, 0xb8, 0xa8, 0x00, 0xb5, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0xaa, 0xab, 0xab, 0xae, 0xbf, 0x41, 0xa5, 0xa3, 0x98, 0x88, 0x6a, 0x68, 0x87, 0x85, 0x71, 0x7f, 0x85, 0x7a, 0x75, 0x71, 0x75, 0x75, 0x75, 0x75, 0x75, 0x77, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x77, 0x77, 0x7b, 0x7e, 0x67, 0x8e, 0xa1, 0x5d, 0x58, 0x2e, 0x46, 0x2d, 0x34, 0x32, 0x2d, 0x2d, 0x38, 0x3e, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x3c, 0x38, 0x38, 0x36, 0x32, 0x36, 0x32, 0x36, 0x32, 0x2c, 0x36, 0x36, 0x43, 0x3b, 0x2a, 0x22, 0x15, 0x0b, 0x0f, 0x0f, 0x0f, 0x10, 0x09, 0x0c, 0x0c, 0x07, 0x1f, 0x28, 0x4d, 0x5c, 0xda, 0xb0, 0xaf, 0x00, 0x61, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xab, 0xb0, 0xcf, 0x4e, 0x01, 0x9f, 0x94, 0x88, 0x68, 0x87, 0x7b, 0x6c, 0x6c, 0x75, 0x6c, 0x7c, 0x75, 0x6c, 0x75, 0x75, 0x6f, 0x75, 0x6f, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x77, 0x75, 0x79, 0x76, 0x72, 0x88, 0xa2, 0x57, 0x58, 0x4b, 0x2f, 0x33, 0x2d, 0x34, 0x2c, 0x2d, 0x2c, 0x38, 0x38, 0x3d, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x37, 0x37, 0x36, 0x2d, 0x36, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3d, 0x38, 0x38, 0x32, 0x36, 0x32, 0x36, 0x36, 0x36, 0x36, 0x34, 0x32, 0x2a, 0x1d, 0x15, 0x0b, 0x09, 0x0f, 0x14, 0x10, 0x10, 0x0c, 0x0d, 0x18, 0x16, 0x30, 0x5c, 0x49, 0xb3, 0xb0, 0xa9, 0xb5, 0x00, 0x00, 0x00, 0x02, 0xa8, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x61, 0x61, 0xf6, 0xda, 0xa7, 0xa4, 0xa2, 0x91, 0x68, 0x6e, 0x84, 0x69, 0x6c, 0x83, 0x7f, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x75, 0x71, 0x7b, 0x75, 0x75, 0x77, 0x79, 0x76, 0x72, 0x82, 0x9f, 0x5e, 0x5b, 0x42, 0x24, 0x2a, 0x33, 0x37, 0x2d, 0x3e, 0x3e, 0x38, 0x38, 0x31, 0x3e, 0x31, 0x3e, 0x38, 0x3c, 0x38, 0x38, 0x36, 0x37, 0x36, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x3c, 0x3d, 0x3c, 0x3d, 0x38, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x34, 0x2a, 0x1a, 0x15, 0x09, 0x0f, 0x14, 0x09, 0x14, 0x10, 0x0c, 0x0d, 0x11, 0x28, 0x49, 0x59, 0xfd, 0xb9, 0xb6, 0xae, 0xaa, 0x00, 0x61, 0xb5, 0x61, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa6, 0xa6, 0x00, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0x61, 0xb6, 0x04, 0xfd, 0x53, 0x5c, 0x9d, 0x88, 0x68, 0x76, 0x76, 0x71, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x77, 0x75, 0x77, 0x75, 0x6f, 0x75, 0x6c, 0x75, 0x6c, 0x71, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x79, 0x84, 0x68, 0x6b, 0x8d, 0x9f, 0x5f, 0x58, 0x48, 0x2e, 0x2a, 0x33, 0x33, 0x2d, 0x38, 0x38, 0x3e, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x3e, 0x38, 0x38, 0x37, 0x37, 0x36, 0x37, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x31, 0x3d, 0x2c, 0x2c, 0x2c, 0x36, 0x43, 0x2d, 0x37, 0x36, 0x43, 0x22, 0x15, 0x0b, 0x0b, 0x0f, 0x0f, 0x0c, 0x10, 0x13, 0x07, 0x0d, 0x21, 0x25, 0x59, 0x49, 0xd8, 0xb2, 0xa9, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xb5, 0xac, 0x00, 0xf9, 0x61, 0xf9, 0xb7, 0xff, 0x41, 0x5f, 0x5f, 0x98, 0x82, 0x80, 0x84, 0x76, 0x77, 0x79, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x6f, 0x6f, 0x77, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x77, 0x7c, 0x75, 0x7a, 0x75, 0x7a, 0x7a, 0x71, 0x77, 0x6c, 0x79, 0x80, 0x72, 0x88, 0x9f, 0x5a, 0x54, 0x4c, 0x3a, 0x2a, 0x2a, 0x34, 0x34, 0x33, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x3d, 0x3c, 0x45, 0x45, 0x43, 0x36, 0x2d, 0x2d, 0x43, 0x2d, 0x1a, 0x15, 0x15, 0x12, 0x12, 0x09, 0x09, 0x10, 0x13, 0x07, 0x11, 0x21, 0x30, 0x59, 0xe4, 0xfc, 0xb0, 0xa9, 0xac, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xa6, 0xa6, 0xa6, 0x00, 0xaa, 0x00, 0xb5, 0x00, 0xf9, 0xb7, 0xfb, 0xa0, 0x5f, 0x5c, 0x96, 0x82, 0x6b, 0x68, 0x7b, 0x79, 0x7a, 0x7d, 0x7a, 0x7d, 0x71, 0x75, 0x6f, 0x6f, 0x6f, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x71, 0x7a, 0x71, 0x71, 0x71, 0x77, 0x85, 0x76, 0x6a, 0x89, 0xa2, 0x57, 0x5d, 0x48, 0x40, 0x2f, 0x2a, 0x33, 0x3b, 0x34, 0x32, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x36, 0x38, 0x3c, 0x3c, 0x2c, 0x37, 0x36, 0x34, 0x32, 0x43, 0x22, 0x1a, 0x15, 0x0b, 0x0b, 0x0f, 0x10, 0x10, 0x14, 0x0c, 0x08, 0x1c, 0x25, 0x9e, 0xef, 0xdc, 0xb3, 0xb6, 0x00, 0xa8, 0xb5, 0x00, 0xaa, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0xa8, 0x61, 0xfa, 0xf6, 0x17, 0x5c, 0xa3, 0x9f, 0x92, 0x6b, 0x68, 0x87, 0x84, 0x6c, 0x71, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x75, 0x6f, 0x6f, 0x6f, 0x77, 0x75, 0x7a, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x71, 0x75, 0x71, 0x71, 0x71, 0x7a, 0x7d, 0x85, 0x74, 0x88, 0x9f, 0x5e, 0x5d, 0x48, 0x2f, 0x2f, 0x33, 0x33, 0x33, 0x34, 0x32, 0x36, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2c, 0x3e, 0x37, 0x2a, 0x2d, 0x33, 0x32, 0x22, 0x15, 0x15, 0x0b, 0x12, 0x0f, 0x10, 0x10, 0x13, 0x0c, 0x08, 0x1f, 0x25, 0x53, 0xed, 0xcf, 0xb1, 0xab, 0xb5, 0x02, 0xf9, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa8, 0xb5, 0xb5, 0x61, 0xf5, 0x03, 0x1e, 0x5f, 0x60, 0x9d, 0x8c, 0x67, 0x81, 0x7e, 0x6c, 0x85, 0x75, 0x6c, 0x7f, 0x7d, 0x71, 0x7d, 0x7a, 0x71, 0x77, 0x6f, 0x6f, 0x75, 0x7a, 0x7a, 0x75, 0x7a, 0x75, 0x75, 0x75, 0x75, 0x71, 0x7a, 0x7b, 0x7c, 0x7a, 0x7b, 0x85, 0x81, 0x6b, 0x8b, 0xa2, 0x5d, 0x5b, 0x4c, 0x24, 0x33, 0x37, 0x33, 0x37, 0x34, 0x34, 0x36, 0x36, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x36, 0x37, 0x36, 0x37, 0x37, 0x43, 0x34, 0x46, 0x3b, 0x2a, 0x1a, 0x15, 0x12, 0x0b, 0x0b, 0x14, 0x14, 0x13, 0x0d, 0x08, 0x08, 0x28, 0x3f, 0x59, 0xe4, 0xbc, 0xb0, 0xab, 0xaa, 0x02, 0xf9, 0x61, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0xa6, 0xaa, 0x00, 0x02, 0x03, 0x3f, 0x5c, 0xa3, 0x9b, 0x88, 0x6b, 0x76, 0x83, 0x7b, 0x6c, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x77, 0x75, 0x7a, 0x7a, 0x7a, 0x75, 0x7a, 0x75, 0x7a, 0x7a, 0x75, 0x7a, 0x7f, 0x7b, 0x71, 0x71, 0x81, 0x6b, 0x8b, 0x54, 0x5d, 0x5b, 0x48, 0x24, 0x2f, 0x2d, 0x31, 0x3c, 0x3c, 0x2d, 0x38, 0x34, 0x37, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x36, 0x37, 0x36, 0x37, 0x34, 0x43, 0x2a, 0x2a, 0x2f, 0x2a, 0x19, 0x0b, 0x0f, 0x12, 0x0f, 0x10, 0x10, 0x0d, 0x07, 0x0a, 0x11, 0x47, 0x3f, 0x5c, 0xfd, 0xb2, 0xaf, 0xa9, 0xab, 0xb5, 0x61, 0x00, 0x61, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xac, 0xa8, 0x00, 0x00, 0xf4, 0xfb, 0x41, 0x5c, 0xa3, 0x97, 0x82, 0x72, 0x76, 0x87, 0x69, 0x6c, 0x85, 0x6c, 0x6f, 0x7f, 0x6f, 0x77, 0x77, 0x77, 0x75, 0x7c, 0x7a, 0x7d, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x7a, 0x75, 0x71, 0x71, 0x7b, 0x7a, 0x70, 0x7d, 0x86, 0x8c, 0x5a, 0x5b, 0x58, 0x48, 0x27, 0x2f, 0x33, 0x38, 0x3c, 0x3d, 0x39, 0x3d, 0x3c, 0x37, 0x34, 0x37, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x37, 0x37, 0x37, 0x2d, 0x34, 0x3b, 0x2a, 0x27, 0x1d, 0x15, 0x0f, 0x0f, 0x12, 0x0f, 0x10, 0x14, 0x0d, 0x07, 0x08, 0x1c, 0x30, 0x49, 0xe9, 0x17, 0xb1, 0xfa, 0xb5, 0xb5, 0xaa, 0x00, 0x00, 0x61, 0xa8, 0x61, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xf5, 0xf7, 0x53, 0x5c, 0xa3, 0x94, 0x82, 0x67, 0x68, 0x84, 0x69, 0x83, 0x7a, 0x6c, 0x75, 0x7a, 0x6f, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7a, 0x7c, 0x7d, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x7a, 0x75, 0x71, 0x75, 0x71, 0x71, 0x7e, 0x7e, 0x76, 0x86, 0x8a, 0x57, 0x57, 0x5b, 0x48, 0x24, 0x2f, 0x46, 0x2d, 0x38, 0x3c, 0x3d, 0x39, 0x3d, 0x3d, 0x2d, 0x2d, 0x37, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x2d, 0x32, 0x33, 0x2f, 0x24, 0x52, 0x4b, 0x1d, 0x09, 0x14, 0x14, 0x09, 0x10, 0x09, 0x07, 0x0d, 0x16, 0x21, 0x47, 0x55, 0xe9, 0xbc, 0xaf, 0xf4, 0x61, 0x61, 0x61, 0x61, 0x61, 0xaa, 0x00, 0x00, 0x00, 0xa6, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0xf9, 0xf9, 0x00, 0x61, 0x61, 0x00, 0xac, 0xa6, 0xaa, 0x00, 0xaa, 0xf4, 0xfc, 0xa3, 0x5c, 0xa2, 0x92, 0x67, 0x6e, 0x87, 0x70, 0x85, 0x71, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x77, 0x75, 0x77, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x6c, 0x83, 0x7a, 0x71, 0x71, 0x79, 0x6f, 0x79, 0x79, 0x6c, 0x7b, 0x81, 0x6b, 0x6a, 0x90, 0x57, 0x5b, 0x56, 0x42, 0x2e, 0x2e, 0x2f, 0x2a, 0x33, 0x34, 0x38, 0x3e, 0x39, 0x39, 0x38, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x38, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x37, 0x36, 0x33, 0x32, 0x33, 0x32, 0x2d, 0x2d, 0x31, 0x3c, 0x3c, 0x38, 0x2a, 0x2a, 0x40, 0x3a, 0x51, 0x58, 0x5b, 0x2b, 0x0c, 0x09, 0x12, 0x14, 0x09, 0x13, 0x0d, 0x18, 0x25, 0x4d, 0x9e, 0xfd, 0xb2, 0xfe, 0xb5, 0xaa, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0xf9, 0x61, 0x00, 0x61, 0x00, 0x61, 0xf9, 0x61, 0xa6, 0xa6, 0xab, 0xae, 0xad, 0xbc, 0x59, 0x5c, 0x9f, 0x8e, 0x68, 0x76, 0x84, 0x7a, 0x71, 0x7a, 0x7a, 0x7a, 0x75, 0x7a, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x71, 0x7f, 0x7a, 0x6c, 0x69, 0x79, 0x79, 0x6f, 0x83, 0x6c, 0x71, 0x70, 0x78, 0x6a, 0x91, 0x5a, 0x5a, 0x56, 0x4b, 0x2e, 0x2f, 0x2f, 0x2a, 0x32, 0x34, 0x36, 0x36, 0x36, 0x38, 0x36, 0x35, 0x36, 0x35, 0x38, 0x39, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x37, 0x2d, 0x32, 0x2d, 0x32, 0x34, 0x37, 0x37, 0x45, 0x2d, 0x22, 0x43, 0x40, 0x3a, 0x48, 0x56, 0x5d, 0x5b, 0x4a, 0x18, 0x10, 0x0c, 0x10, 0x06, 0x14, 0x07, 0x1c, 0x25, 0x4d, 0xed, 0xda, 0xb8, 0xad, 0xa8, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa6, 0xad, 0xfe, 0x17, 0x60, 0xa2, 0x9f, 0x8e, 0x67, 0x67, 0x84, 0x7b, 0x7a, 0x85, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7d, 0x7d, 0x6c, 0x79, 0x79, 0x6f, 0x69, 0x79, 0x7f, 0x81, 0x7d, 0x74, 0x95, 0x5a, 0x5a, 0x5b, 0x42, 0x2f, 0x27, 0x2f, 0x2f, 0x32, 0x33, 0x36, 0x38, 0x38, 0x38, 0x39, 0x38, 0x38, 0x35, 0x38, 0x35, 0x36, 0x36, 0x38, 0x36, 0x36, 0x36, 0x36, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x38, 0x38, 0x3d, 0x38, 0x31, 0x38, 0x31, 0x2d, 0x33, 0x3b, 0x40, 0x29, 0x2b, 0x4c, 0x58, 0x5d, 0x54, 0x2b, 0x13, 0x0c, 0x0d, 0x13, 0x0d, 0x0d, 0x08, 0x28, 0x30, 0x55, 0xa0, 0xff, 0xb6, 0xac, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0xa6, 0x00, 0x00, 0xa8, 0x00, 0xac, 0xf6, 0xf8, 0x5c, 0x5c, 0x9d, 0x82, 0x66, 0x78, 0x84, 0x71, 0x6c, 0x7c, 0x7f, 0x7f, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x70, 0x7d, 0x7f, 0x83, 0x83, 0x6f, 0x6f, 0x7b, 0x7e, 0x70, 0x82, 0x9a, 0x58, 0x5d, 0x57, 0x28, 0x2e, 0x2f, 0x2a, 0x3b, 0x34, 0x34, 0x2d, 0x38, 0x3e, 0x3d, 0x38, 0x3d, 0x38, 0x39, 0x38, 0x35, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x31, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x38, 0x33, 0x27, 0x2e, 0x2b, 0x42, 0x54, 0x5d, 0x5b, 0x4a, 0x18, 0x0c, 0x07, 0x0d, 0x0d, 0x0a, 0x0a, 0x16, 0x21, 0x47, 0x5f, 0x3f, 0xb2, 0xfa, 0xa8, 0x00, 0xaa, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa6, 0xa6, 0x00, 0xa6, 0xa6, 0xb5, 0xa8, 0x03, 0xe4, 0x60, 0xa3, 0x98, 0x88, 0x72, 0x6e, 0x76, 0x7b, 0x79, 0x83, 0x7a, 0x71, 0x75, 0x75, 0x77, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7f, 0x7c, 0x6c, 0x77, 0x7f, 0x7b, 0x7e, 0x67, 0x82, 0x9a, 0x5b, 0x5b, 0x56, 0x2b, 0x2e, 0x2f, 0x32, 0x33, 0x34, 0x34, 0x38, 0x2c, 0x3c, 0x3c, 0x3c, 0x3d, 0x3d, 0x39, 0x38, 0x38, 0x36, 0x36, 0x36, 0x32, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x38, 0x37, 0x37, 0x38, 0x37, 0x39, 0x2c, 0x39, 0x3d, 0x45, 0x45, 0x3e, 0x34, 0x40, 0x29, 0x2b, 0x50, 0x5d, 0x5d, 0x4f, 0x1f, 0x08, 0x0c, 0x0c, 0x0c, 0x13, 0x08, 0x08, 0x16, 0x25, 0xa0, 0x59, 0xda, 0xb2, 0xfe, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa8, 0x00, 0x00, 0xa8, 0xa6, 0x00, 0xaa, 0x03, 0x9e, 0x5f, 0xa4, 0x99, 0x72, 0x67, 0x81, 0x87, 0x69, 0x6c, 0x7f, 0x6c, 0x75, 0x83, 0x6c, 0x75, 0x77, 0x75, 0x75, 0x7a, 0x75, 0x7a, 0x7a, 0x7a, 0x7d, 0x7a, 0x7c, 0x7a, 0x7a, 0x75, 0x7a, 0x7a, 0x7f, 0x71, 0x75, 0x7d, 0x7d, 0x6e, 0x6b, 0x8b, 0x9f, 0x5a, 0x5d, 0x51, 0x29, 0x27, 0x46, 0x2d, 0x2d, 0x2d, 0x37, 0x38, 0x2c, 0x3c, 0x3c, 0x3d, 0x3c, 0x3d, 0x38, 0x3d, 0x38, 0x35, 0x38, 0x36, 0x32, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x36, 0x38, 0x36, 0x38, 0x38, 0x38, 0x38, 0x36, 0x2c, 0x39, 0x3d, 0x2c, 0x2c, 0x2a, 0x2f, 0x3a, 0x48, 0x5b, 0x5d, 0x57, 0x28, 0x11, 0x07, 0x0d, 0x10, 0x10, 0x0c, 0x08, 0x11, 0x1b, 0x47, 0xa7, 0x59, 0xbc, 0xb7, 0xae, 0xaa, 0xa8, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xab, 0xaa, 0xa6, 0xb5, 0x00, 0xa9, 0xb2, 0x9e, 0xa0, 0xa3, 0x96, 0x82, 0x6b, 0x76, 0x79, 0x71, 0x6c, 0x85, 0x7f, 0x69, 0x75, 0x85, 0x6f, 0x75, 0x77, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x77, 0x77, 0x6f, 0x7c, 0x7d, 0x81, 0x70, 0x82, 0x90, 0x9f, 0xa2, 0x5f, 0x50, 0x20, 0x40, 0x45, 0x2c, 0x2c, 0x2c, 0x38, 0x38, 0x31, 0x3e, 0x3c, 0x3c, 0x3c, 0x3d, 0x38, 0x3d, 0x36, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x38, 0x36, 0x36, 0x36, 0x3b, 0x32, 0x2a, 0x27, 0x2e, 0x42, 0x4c, 0x5b, 0x57, 0x44, 0x18, 0x08, 0x0c, 0x10, 0x09, 0x0c, 0x0d, 0x0d, 0x11, 0x25, 0x55, 0x4e, 0xfd, 0xb9, 0xb2, 0xab, 0xaa, 0x00, 0x00, 0x61, 0x00, 0x61, 0x61, 0x61, 0xa8, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xa6, 0x00, 0xaa, 0x00, 0xab, 0x00, 0xaa, 0x00, 0x00, 0xb9, 0x49, 0xa5, 0x5a, 0x94, 0x72, 0x68, 0x76, 0x79, 0x71, 0x6c, 0x85, 0x7a, 0x6c, 0x85, 0x7f, 0x69, 0x83, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x77, 0x77, 0x77, 0x77, 0x6c, 0x7a, 0x86, 0x78, 0x73, 0x93, 0x57, 0x5e, 0x5b, 0x44, 0x2b, 0x2e, 0x3b, 0x35, 0x3d, 0x3d, 0x3e, 0x3e, 0x3c, 0x38, 0x3c, 0x3e, 0x31, 0x38, 0x3c, 0x38, 0x38, 0x36, 0x36, 0x32, 0x36, 0x36, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x36, 0x36, 0x32, 0x2a, 0x2f, 0x27, 0x29, 0x3a, 0x4c, 0x58, 0x5b, 0x50, 0x1f, 0x0a, 0x08, 0x13, 0x10, 0x09, 0x10, 0x07, 0x18, 0x1c, 0x25, 0x4d, 0x59, 0xb4, 0xb1, 0xa9, 0xab, 0xab, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0xa6, 0x00, 0xaa, 0xaa, 0xaa, 0xb5, 0xb5, 0x00, 0x61, 0xb2, 0x49, 0xa5, 0xa2, 0x91, 0x72, 0x72, 0x76, 0x7b, 0x83, 0x6c, 0x7a, 0x7c, 0x7c, 0x7d, 0x7c, 0x75, 0x6f, 0x77, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x83, 0x7c, 0x6f, 0x6c, 0x77, 0x77, 0x75, 0x75, 0x87, 0x76, 0x66, 0x88, 0x98, 0x5a, 0x5d, 0x54, 0x48, 0x29, 0x27, 0x2a, 0x32, 0x32, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x38, 0x38, 0x38, 0x37, 0x37, 0x36, 0x36, 0x32, 0x32, 0x36, 0x37, 0x39, 0x38, 0x3d, 0x38, 0x3d, 0x3c, 0x3d, 0x3e, 0x2c, 0x38, 0x37, 0x36, 0x2d, 0x34, 0x3b, 0x40, 0x29, 0x26, 0x48, 0x58, 0x5b, 0x56, 0x44, 0x11, 0x07, 0x07, 0x0c, 0x10, 0x10, 0x10, 0x10, 0x16, 0x1c, 0x47, 0x5e, 0xa0, 0xff, 0xb6, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xaa, 0xaa, 0x00, 0xb5, 0xf4, 0xb2, 0x53, 0xa3, 0xa2, 0x90, 0x72, 0x6e, 0x76, 0x6c, 0x69, 0x83, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x77, 0x77, 0x75, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x75, 0x77, 0x75, 0x6f, 0x79, 0x75, 0x6c, 0x7e, 0x6e, 0x6a, 0x8e, 0x9d, 0x5a, 0x5a, 0x56, 0x42, 0x40, 0x33, 0x37, 0x43, 0x32, 0x2a, 0x32, 0x34, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x36, 0x36, 0x34, 0x32, 0x32, 0x32, 0x34, 0x38, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3e, 0x3c, 0x2c, 0x3e, 0x37, 0x34, 0x32, 0x33, 0x2a, 0x2f, 0x26, 0x2b, 0x51, 0x58, 0x58, 0x51, 0x18, 0x06, 0x06, 0x13, 0x14, 0x0c, 0x0c, 0x07, 0x0d, 0x1c, 0x30, 0x53, 0x53, 0x1e, 0x04, 0xb6, 0xf4, 0x61, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x00, 0xa6, 0x00, 0xaa, 0x00, 0xaa, 0xf4, 0xf5, 0xb3, 0xa0, 0xa3, 0xa3, 0x8e, 0x68, 0x68, 0x76, 0x84, 0x6c, 0x69, 0x7f, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x75, 0x77, 0x77, 0x7c, 0x7a, 0x7c, 0x7a, 0x7a, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x71, 0x7b, 0x7b, 0x7b, 0x70, 0x81, 0x67, 0x82, 0x93, 0xa2, 0x5e, 0x5d, 0x56, 0x3a, 0x2a, 0x2c, 0x2c, 0x45, 0x36, 0x32, 0x2a, 0x40, 0x32, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x37, 0x36, 0x2d, 0x34, 0x34, 0x32, 0x34, 0x32, 0x36, 0x38, 0x3d, 0x3c, 0x3d, 0x3c, 0x3c, 0x3c, 0x3e, 0x43, 0x2c, 0x2a, 0x3b, 0x3b, 0x2f, 0x2a, 0x2e, 0x52, 0x58, 0x5b, 0x51, 0x18, 0x06, 0x07, 0x18, 0x19, 0x06, 0x09, 0x13, 0x08, 0x16, 0x21, 0x9c, 0x53, 0x9e, 0x17, 0x03, 0xa8, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0xaa, 0xa8, 0xf5, 0xff, 0x59, 0x5c, 0x9f, 0x8c, 0x73, 0x76, 0x76, 0x79, 0x84, 0x6f, 0x77, 0x77, 0x6c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x77, 0x75, 0x7a, 0x7d, 0x7a, 0x7c, 0x75, 0x7a, 0x75, 0x79, 0x83, 0x6c, 0x69, 0x7e, 0x81, 0x81, 0x6e, 0x6b, 0x8c, 0x9b, 0x5c, 0x5d, 0x5b, 0x48, 0x24, 0x2a, 0x36, 0x2c, 0x39, 0x39, 0x35, 0x2a, 0x2f, 0x40, 0x34, 0x37, 0x36, 0x37, 0x36, 0x37, 0x2d, 0x36, 0x2d, 0x36, 0x34, 0x36, 0x34, 0x34, 0x34, 0x37, 0x38, 0x3d, 0x3d, 0x3c, 0x38, 0x3e, 0x38, 0x37, 0x2d, 0x33, 0x3b, 0x40, 0x24, 0x27, 0x4b, 0x56, 0x58, 0x51, 0x20, 0x08, 0x0c, 0x0d, 0x10, 0x09, 0x10, 0x19, 0x0c, 0x08, 0x21, 0x25, 0x9c, 0xef, 0xf8, 0xb3, 0xae, 0xab, 0xf4, 0x61, 0x00, 0xf9, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xb5, 0xf5, 0xfb, 0xa3, 0x5f, 0x9f, 0x8e, 0x6a, 0x6e, 0x7e, 0x79, 0x79, 0x6f, 0x6c, 0x83, 0x7f, 0x6c, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x75, 0x7a, 0x7c, 0x7c, 0x7c, 0x7a, 0x7a, 0x77, 0x79, 0x7a, 0x69, 0x81, 0x87, 0x81, 0x67, 0x66, 0x8b, 0x93, 0xa2, 0x5a, 0x5d, 0x58, 0x29, 0x27, 0x46, 0x2c, 0x45, 0x39, 0x35, 0x39, 0x32, 0x2d, 0x2d, 0x33, 0x34, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x3d, 0x38, 0x38, 0x38, 0x38, 0x34, 0x2d, 0x2a, 0x40, 0x2f, 0x26, 0x40, 0x56, 0x58, 0x52, 0x20, 0x13, 0x0d, 0x0c, 0x0c, 0x13, 0x0c, 0x0c, 0x07, 0x07, 0x1c, 0x21, 0x3f, 0xa4, 0xe8, 0xd5, 0xb8, 0xae, 0xaa, 0x00, 0xa8, 0x62, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xa6, 0x00, 0xaa, 0xfa, 0xfc, 0x59, 0xa3, 0x9f, 0x8e, 0x72, 0x78, 0x7e, 0x6c, 0x7a, 0x7a, 0x75, 0x6c, 0x75, 0x79, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7c, 0x7c, 0x7a, 0x75, 0x75, 0x75, 0x79, 0x71, 0x76, 0x6e, 0x6a, 0x74, 0x8e, 0x9a, 0x5d, 0x5e, 0x5b, 0x48, 0x29, 0x40, 0x34, 0x2c, 0x45, 0x39, 0x39, 0x2c, 0x36, 0x36, 0x37, 0x2d, 0x2c, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x2d, 0x34, 0x33, 0x40, 0x27, 0x2e, 0x52, 0x58, 0x56, 0x42, 0x18, 0x13, 0x10, 0x10, 0x0c, 0x10, 0x0c, 0x0d, 0x0d, 0x0a, 0x21, 0x30, 0xa0, 0xef, 0xfd, 0xba, 0xaf, 0xab, 0xaa, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0xaa, 0x00, 0x00, 0xb6, 0xbc, 0x53, 0xa4, 0xa2, 0x8c, 0x6a, 0x81, 0x69, 0x79, 0x6c, 0x7c, 0x7f, 0x71, 0x75, 0x6c, 0x6c, 0x79, 0x6f, 0x6f, 0x77, 0x75, 0x75, 0x7a, 0x7a, 0x7c, 0x7d, 0x7c, 0x7c, 0x7a, 0x77, 0x75, 0x6f, 0x7b, 0x87, 0x6e, 0x6b, 0x8b, 0x9a, 0x57, 0x5e, 0x5b, 0x51, 0x29, 0x29, 0x2f, 0x2f, 0x32, 0x32, 0x2c, 0x2c, 0x2c, 0x38, 0x3e, 0x3e, 0x3d, 0x39, 0x2c, 0x38, 0x38, 0x36, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x36, 0x36, 0x34, 0x34, 0x32, 0x33, 0x2f, 0x40, 0x4b, 0x52, 0x58, 0x4c, 0x18, 0x08, 0x0d, 0x07, 0x09, 0x10, 0x14, 0x0c, 0x07, 0x0a, 0x16, 0x25, 0x41, 0x53, 0xe8, 0xcf, 0xb7, 0xb5, 0xf9, 0xf9, 0x61, 0x00, 0x62, 0xa8, 0x00, 0xa6, 0xa8, 0xa6, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa8, 0xaf, 0xbc, 0x4e, 0xa5, 0xa0, 0x8d, 0x6d, 0x6b, 0x80, 0x79, 0x6f, 0x71, 0x7a, 0x70, 0x6c, 0x7a, 0x79, 0x6c, 0x77, 0x79, 0x6f, 0x77, 0x6f, 0x75, 0x75, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x76, 0x76, 0x67, 0x8b, 0x9a, 0xa1, 0x5b, 0x5d, 0x54, 0x4c, 0x2e, 0x2f, 0x2a, 0x3b, 0x34, 0x32, 0x2c, 0x36, 0x37, 0x43, 0x3c, 0x38, 0x31, 0x3e, 0x39, 0x45, 0x35, 0x37, 0x38, 0x36, 0x38, 0x37, 0x38, 0x3e, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x37, 0x34, 0x33, 0x2f, 0x2f, 0x2e, 0x52, 0x56, 0x56, 0x26, 0x0d, 0x0d, 0x0d, 0x08, 0x10, 0x10, 0x0c, 0x07, 0x0d, 0x11, 0x21, 0x3f, 0x53, 0xa7, 0xdf, 0xb2, 0xa9, 0xac, 0xf4, 0xf9, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0xa6, 0x61, 0xa6, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0xf9, 0x00, 0xac, 0x00, 0xb5, 0xfe, 0xbc, 0xe9, 0xa5, 0xa7, 0x8d, 0x63, 0x6d, 0x72, 0x76, 0x76, 0x7b, 0x70, 0x7b, 0x71, 0x71, 0x6c, 0x6c, 0x75, 0x79, 0x77, 0x75, 0x6f, 0x75, 0x79, 0x6c, 0x71, 0x79, 0x7b, 0x7b, 0x76, 0x81, 0x68, 0x6a, 0x74, 0x8c, 0x9a, 0xa1, 0x5d, 0x5b, 0x58, 0x4a, 0x2b, 0x29, 0x2f, 0x34, 0x2d, 0x34, 0x36, 0x37, 0x36, 0x37, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x3e, 0x35, 0x37, 0x2d, 0x34, 0x37, 0x36, 0x38, 0x38, 0x3c, 0x3c, 0x3d, 0x31, 0x31, 0x31, 0x31, 0x3e, 0x3e, 0x31, 0x31, 0x38, 0x33, 0x2f, 0x40, 0x52, 0x56, 0x56, 0x2b, 0x13, 0x07, 0x0d, 0x10, 0x10, 0x10, 0x0c, 0x07, 0x0d, 0x18, 0x21, 0x30, 0x4d, 0xef, 0xfd, 0xbc, 0xaf, 0xab, 0xaa, 0x00, 0x61, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0xf9, 0x61, 0x61, 0xf9, 0xb5, 0xaa, 0xad, 0xaf, 0xfb, 0x4e, 0xa4, 0x01, 0xa4, 0x99, 0x94, 0x8e, 0x72, 0x6a, 0x6b, 0x6b, 0x76, 0x78, 0x7e, 0x81, 0x7e, 0x7e, 0x7b, 0x7a, 0x70, 0x6c, 0x70, 0x7b, 0x7b, 0x7e, 0x76, 0x7e, 0x76, 0x68, 0x68, 0x6a, 0x8b, 0x93, 0x9d, 0x57, 0x5d, 0x5b, 0x58, 0x51, 0x3a, 0x29, 0x29, 0x40, 0x2d, 0x38, 0x31, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x36, 0x34, 0x2d, 0x34, 0x38, 0x38, 0x3c, 0x31, 0x3c, 0x45, 0x45, 0x45, 0x36, 0x34, 0x37, 0x43, 0x45, 0x33, 0x24, 0x4b, 0x56, 0x56, 0x48, 0x13, 0x0d, 0x0d, 0x13, 0x14, 0x0c, 0x09, 0x0c, 0x0d, 0x18, 0x1c, 0x16, 0x47, 0x5c, 0x4e, 0xd5, 0xb8, 0xae, 0xab, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xab, 0xaf, 0xff, 0x49, 0x5f, 0x5f, 0x54, 0x5e, 0x5e, 0x5f, 0x5a, 0x9b, 0x9a, 0x95, 0x8b, 0x82, 0x80, 0x6b, 0x6b, 0x6b, 0x6e, 0x78, 0x81, 0x81, 0x81, 0x78, 0x78, 0x6e, 0x68, 0x6b, 0x67, 0x74, 0x8c, 0x95, 0x9b, 0xa1, 0x5d, 0x5e, 0x5b, 0x58, 0x52, 0x48, 0x2e, 0x27, 0x2a, 0x2a, 0x32, 0x37, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x38, 0x37, 0x38, 0x3e, 0x45, 0x3d, 0x3c, 0x2c, 0x2d, 0x3b, 0x2a, 0x2f, 0x24, 0x29, 0x4b, 0x52, 0x56, 0x40, 0x19, 0x09, 0x10, 0x09, 0x07, 0x0c, 0x0c, 0x07, 0x0d, 0x0d, 0x1c, 0x1c, 0x47, 0x5f, 0x59, 0x17, 0xb9, 0xb0, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0x62, 0x61, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xab, 0xb6, 0xb3, 0x49, 0x5f, 0x54, 0x4a, 0x28, 0x51, 0x4c, 0x58, 0x5b, 0x5b, 0x5d, 0x5d, 0x57, 0x54, 0x9d, 0x9a, 0x95, 0x90, 0x8e, 0x8b, 0x88, 0x82, 0x74, 0x88, 0x8b, 0x90, 0x92, 0x95, 0x9a, 0xa1, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x51, 0x4c, 0x2b, 0x26, 0x27, 0x2a, 0x3b, 0x43, 0x3e, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3e, 0x38, 0x38, 0x37, 0x38, 0x38, 0x38, 0x3e, 0x37, 0x2d, 0x34, 0x3b, 0x2f, 0x2f, 0x29, 0x42, 0x56, 0x56, 0x4b, 0x20, 0x14, 0x09, 0x09, 0x14, 0x10, 0x10, 0x0c, 0x0d, 0x11, 0x18, 0x1c, 0x3f, 0x59, 0x59, 0x1e, 0x04, 0xb7, 0xae, 0x00, 0xab, 0xab, 0xaa, 0x00, 0x00, 0x00, 0xf9, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xab, 0xab, 0xf7, 0x49, 0x5a, 0x5b, 0x4c, 0x20, 0x2e, 0x26, 0x26, 0x3a, 0x42, 0x4c, 0x51, 0x58, 0x5d, 0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x5a, 0x5a, 0xa1, 0xa1, 0xa1, 0xa1, 0x5a, 0x57, 0x5d, 0x5d, 0x5e, 0x5d, 0x5b, 0x5b, 0x56, 0x51, 0x42, 0x29, 0x26, 0x40, 0x2f, 0x33, 0x2d, 0x3c, 0x45, 0x3d, 0x31, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x38, 0x39, 0x38, 0x3c, 0x3d, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x37, 0x37, 0x2d, 0x34, 0x34, 0x2a, 0x27, 0x40, 0x4b, 0x52, 0x58, 0x4c, 0x2b, 0x13, 0x06, 0x09, 0x14, 0x19, 0x09, 0x0c, 0x0c, 0x0a, 0x11, 0x21, 0x47, 0x55, 0x59, 0xfd, 0xbc, 0xb8, 0xad, 0x00, 0xaa, 0xab, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xab, 0xb2, 0xfd, 0x60, 0x5b, 0x44, 0x3a, 0x24, 0x33, 0x2a, 0x46, 0x40, 0x40, 0x2b, 0x3a, 0x2b, 0x2b, 0x4a, 0x51, 0x4f, 0x58, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5a, 0x5d, 0x5d, 0x5b, 0x57, 0x58, 0x54, 0x4c, 0x42, 0x2b, 0x3a, 0x26, 0x26, 0x2f, 0x4b, 0x33, 0x43, 0x37, 0x3c, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x36, 0x38, 0x35, 0x38, 0x38, 0x39, 0x2c, 0x3e, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x3c, 0x3c, 0x3d, 0x38, 0x38, 0x37, 0x2d, 0x34, 0x43, 0x2a, 0x2a, 0x2f, 0x4b, 0x52, 0x52, 0x52, 0x20, 0x11, 0x06, 0x0d, 0x14, 0x0c, 0x06, 0x0c, 0x0d, 0x0d, 0x11, 0x21, 0x47, 0x4d, 0x53, 0x49, 0xfc, 0xb2, 0xae, 0xa6, 0xab, 0xa9, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x61, 0x61, 0xf9, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xa9, 0xf6, 0x1e, 0x5f, 0x5d, 0x4a, 0x2e, 0x24, 0x46, 0x2d, 0x2d, 0x37, 0x2d, 0x24, 0x27, 0x2e, 0x3a, 0x29, 0x26, 0x26, 0x29, 0x26, 0x3a, 0x42, 0x48, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b, 0x48, 0x2e, 0x26, 0x24, 0x2e, 0x27, 0x40, 0x2f, 0x3b, 0x2a, 0x2a, 0x2a, 0x2d, 0x2d, 0x38, 0x3e, 0x3e, 0x3e, 0x3d, 0x3e, 0x35, 0x37, 0x35, 0x37, 0x39, 0x38, 0x39, 0x38, 0x3d, 0x38, 0x3e, 0x39, 0x38, 0x39, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x34, 0x34, 0x33, 0x2a, 0x2a, 0x46, 0x52, 0x52, 0x4b, 0x29, 0x13, 0x09, 0x10, 0x10, 0x07, 0x0d, 0x13, 0x11, 0x08, 0x16, 0x21, 0x3f, 0x4d, 0x53, 0x41, 0xd5, 0xb2, 0xa9, 0xa9, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0xaa, 0xaa, 0xab, 0xb1, 0xfc, 0x5a, 0x5d, 0x51, 0x20, 0x27, 0x46, 0x22, 0x45, 0x39, 0x45, 0x35, 0x43, 0x3b, 0x27, 0x24, 0x40, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x27, 0x27, 0x27, 0x24, 0x24, 0x24, 0x27, 0x2a, 0x2a, 0x3b, 0x3b, 0x32, 0x32, 0x32, 0x32, 0x2c, 0x35, 0x43, 0x2c, 0x3e, 0x3e, 0x36, 0x2c, 0x36, 0x2d, 0x2d, 0x2d, 0x36, 0x36, 0x38, 0x35, 0x38, 0x2c, 0x39, 0x38, 0x39, 0x3e, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3e, 0x38, 0x37, 0x33, 0x33, 0x33, 0x33, 0x46, 0x4b, 0x52, 0x4b, 0x2f, 0x14, 0x0c, 0x09, 0x14, 0x14, 0x10, 0x13, 0x07, 0x08, 0x16, 0x25, 0x23, 0xa0, 0xa7, 0xe4, 0xd5, 0xb9, 0xaf, 0xaa, 0xab, 0xab, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0xf9, 0xf9, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xf9, 0x61, 0x61, 0x00, 0xa8, 0xaa, 0xab, 0xaa, 0xad, 0xb3, 0x59, 0x5d, 0x51, 0x2b, 0x2e, 0x2f, 0x43, 0x3d, 0x39, 0x39, 0x39, 0x35, 0x35, 0x35, 0x32, 0x32, 0x32, 0x3c, 0x3c, 0x3e, 0x38, 0x34, 0x32, 0x32, 0x32, 0x2f, 0x32, 0x32, 0x36, 0x36, 0x3e, 0x3c, 0x3d, 0x35, 0x35, 0x35, 0x39, 0x35, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x36, 0x34, 0x32, 0x33, 0x32, 0x36, 0x36, 0x35, 0x38, 0x38, 0x39, 0x38, 0x3d, 0x3e, 0x3e, 0x2c, 0x38, 0x3e, 0x37, 0x36, 0x2d, 0x37, 0x37, 0x34, 0x33, 0x2a, 0x2f, 0x46, 0x4b, 0x52, 0x46, 0x22, 0x12, 0x09, 0x09, 0x0c, 0x0c, 0x10, 0x09, 0x0c, 0x0d, 0x16, 0x21, 0x3f, 0x49, 0x01, 0xe4, 0xcf, 0xb1, 0xae, 0xac, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xf9, 0x61, 0x61, 0xa8, 0xaa, 0xa8, 0xaa, 0xad, 0xb2, 0xfd, 0x5e, 0x56, 0x4b, 0x2e, 0x27, 0x43, 0x34, 0x3e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x35, 0x35, 0x35, 0x39, 0x3d, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x34, 0x32, 0x36, 0x32, 0x37, 0x38, 0x3c, 0x3c, 0x3d, 0x3c, 0x3d, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x35, 0x37, 0x34, 0x33, 0x33, 0x33, 0x32, 0x38, 0x36, 0x38, 0x35, 0x38, 0x3d, 0x38, 0x3d, 0x3e, 0x3e, 0x37, 0x36, 0x34, 0x34, 0x34, 0x43, 0x2a, 0x22, 0x3b, 0x4b, 0x52, 0x4b, 0x46, 0x1d, 0x14, 0x0f, 0x10, 0x14, 0x13, 0x0c, 0x07, 0x13, 0x13, 0x18, 0x21, 0x47, 0x4d, 0x53, 0x4e, 0xbf, 0xba, 0xb6, 0xa9, 0xaa, 0xaa, 0x61, 0x61, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x61, 0xf9, 0x61, 0x61, 0xaa, 0xaa, 0xab, 0x00, 0xfe, 0x1b, 0x5f, 0x5b, 0x4c, 0x40, 0x2a, 0x33, 0x3b, 0x3e, 0x2c, 0x31, 0x39, 0x38, 0x39, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x37, 0x37, 0x33, 0x34, 0x33, 0x33, 0x2d, 0x33, 0x37, 0x37, 0x3c, 0x3c, 0x3c, 0x38, 0x38, 0x37, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x38, 0x3d, 0x38, 0x38, 0x37, 0x37, 0x34, 0x36, 0x36, 0x36, 0x35, 0x38, 0x38, 0x39, 0x38, 0x3c, 0x38, 0x3e, 0x43, 0x43, 0x2d, 0x2a, 0x2a, 0x2a, 0x2a, 0x40, 0x46, 0x4b, 0x4b, 0x40, 0x1d, 0x14, 0x10, 0x0f, 0x10, 0x0c, 0x0c, 0x0d, 0x0d, 0x11, 0x16, 0x21, 0x47, 0x55, 0x55, 0x49, 0xd5, 0xb1, 0xae, 0xab, 0xaa, 0x00, 0x00, 0x61, 0x61, 0xf9, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0xaa, 0xaa, 0xaa, 0xad, 0x04, 0x55, 0x5f, 0x51, 0x2e, 0x2a, 0x2a, 0x37, 0x43, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x37, 0x38, 0x2d, 0x37, 0x2d, 0x34, 0x37, 0x33, 0x37, 0x2d, 0x37, 0x38, 0x38, 0x3c, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3e, 0x38, 0x38, 0x38, 0x36, 0x38, 0x38, 0x38, 0x39, 0x38, 0x3c, 0x38, 0x38, 0x37, 0x37, 0x2d, 0x2a, 0x2d, 0x2f, 0x3b, 0x46, 0x4b, 0x4b, 0x27, 0x19, 0x0c, 0x0c, 0x0c, 0x0c, 0x13, 0x13, 0x0d, 0x0d, 0x11, 0x21, 0x21, 0x4d, 0x53, 0x59, 0x41, 0xcf, 0x03, 0xfa, 0x02, 0x61, 0x61, 0x00, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x61, 0xf9, 0x00, 0x00, 0xaa, 0xa9, 0x00, 0xb7, 0x17, 0x5e, 0x5b, 0x44, 0x2f, 0x2d, 0x2d, 0x37, 0x3e, 0x3c, 0x38, 0x3c, 0x38, 0x37, 0x37, 0x2d, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x3d, 0x3c, 0x3e, 0x3c, 0x3e, 0x3c, 0x38, 0x3d, 0x3c, 0x3e, 0x3c, 0x3c, 0x3c, 0x38, 0x37, 0x33, 0x37, 0x33, 0x2d, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x3c, 0x3c, 0x3d, 0x3c, 0x39, 0x38, 0x35, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3e, 0x3e, 0x2d, 0x2d, 0x2a, 0x2a, 0x46, 0x46, 0x4b, 0x40, 0x27, 0x1d, 0x14, 0x0c, 0x0c, 0x0d, 0x0d, 0x08, 0x08, 0x11, 0x11, 0x1c, 0x30, 0x4f, 0x59, 0xa7, 0xdf, 0xb3, 0xf6, 0xfe, 0xad, 0xf9, 0x61, 0x00, 0x61, 0x61, 0xf9, 0x61, 0x61, 0x61, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0xaa, 0xaa, 0xab, 0xac, 0x03, 0x47, 0x5d, 0x4f, 0x3a, 0x2f, 0x32, 0x37, 0x3e, 0x3c, 0x3c, 0x3c, 0x3e, 0x37, 0x37, 0x2d, 0x37, 0x34, 0x38, 0x38, 0x3c, 0x38, 0x39, 0x39, 0x35, 0x39, 0x39, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x38, 0x39, 0x38, 0x37, 0x37, 0x37, 0x34, 0x37, 0x33, 0x2d, 0x34, 0x37, 0x37, 0x38, 0x38, 0x38, 0x3d, 0x3d, 0x39, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x2d, 0x37, 0x3b, 0x46, 0x46, 0x40, 0x27, 0x22, 0x14, 0x12, 0x10, 0x10, 0x13, 0x0d, 0x0a, 0x08, 0x11, 0x1c, 0x25, 0x47, 0x55, 0x55, 0xe4, 0x23, 0xf7, 0xb0, 0xae, 0xac, 0xaa, 0x00, 0x00, 0x61, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0xaa, 0xaa, 0xab, 0xae, 0xb3, 0x5a, 0x57, 0x44, 0x26, 0x2a, 0x36, 0x37, 0x38, 0x31, 0x3c, 0x3c, 0x3c, 0x38, 0x36, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x36, 0x38, 0x37, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x37, 0x37, 0x36, 0x34, 0x36, 0x35, 0x35, 0x35, 0x35, 0x32, 0x36, 0x32, 0x34, 0x32, 0x34, 0x37, 0x36, 0x38, 0x37, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x3e, 0x2d, 0x43, 0x43, 0x46, 0x2f, 0x1d, 0x15, 0x09, 0x12, 0x0f, 0x09, 0x07, 0x07, 0x11, 0x18, 0x21, 0x25, 0x47, 0x55, 0x55, 0x9e, 0xb4, 0xba, 0xaf, 0xa9, 0xaa, 0x00, 0xaa, 0x02, 0xb5, 0x61, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xa6, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0xab, 0xaa, 0xab, 0xae, 0x17, 0x5a, 0x5d, 0x2b, 0x29, 0x2a, 0x32, 0x2c, 0x38, 0x31, 0x3d, 0x31, 0x2c, 0x38, 0x36, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x34, 0x36, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x34, 0x2d, 0x34, 0x32, 0x35, 0x35, 0x35, 0x35, 0x35, 0x32, 0x35, 0x32, 0x32, 0x34, 0x32, 0x37, 0x36, 0x37, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x33, 0x43, 0x2f, 0x22, 0x19, 0x0b, 0x09, 0x09, 0x10, 0x0c, 0x0d, 0x0d, 0x18, 0x1c, 0x21, 0x47, 0x4d, 0x5a, 0x53, 0x3f, 0xbf, 0x03, 0xaf, 0xa9, 0xac, 0x00, 0x61, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x00, 0xaa, 0x00, 0xab, 0xab, 0xae, 0x1e, 0x5f, 0x4a, 0x2b, 0x2e, 0x3b, 0x3e, 0x3c, 0x2c, 0x3c, 0x3e, 0x3c, 0x2c, 0x3e, 0x36, 0x36, 0x36, 0x32, 0x32, 0x32, 0x32, 0x32, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x38, 0x37, 0x2d, 0x2d, 0x32, 0x32, 0x32, 0x32, 0x36, 0x36, 0x36, 0x37, 0x2c, 0x37, 0x2d, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x39, 0x39, 0x2c, 0x2c, 0x36, 0x3b, 0x33, 0x24, 0x1a, 0x14, 0x10, 0x0c, 0x0d, 0x0d, 0x0d, 0x0a, 0x11, 0x1b, 0x21, 0x25, 0x4d, 0x5c, 0xa3, 0x9e, 0xcf, 0xb3, 0xb7, 0xad, 0xa8, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0xaa, 0xaa, 0xab, 0xfa, 0x1e, 0x5f, 0x4a, 0x28, 0x2e, 0x2a, 0x3c, 0x2c, 0x38, 0x31, 0x45, 0x45, 0x45, 0x2c, 0x2c, 0x38, 0x2c, 0x36, 0x32, 0x32, 0x2d, 0x36, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x3c, 0x2c, 0x38, 0x38, 0x37, 0x38, 0x37, 0x36, 0x34, 0x36, 0x32, 0x36, 0x2d, 0x36, 0x2c, 0x2c, 0x2c, 0x38, 0x38, 0x38, 0x37, 0x2d, 0x2d, 0x34, 0x2d, 0x43, 0x43, 0x43, 0x3b, 0x2a, 0x22, 0x19, 0x0f, 0x0c, 0x13, 0x0d, 0x08, 0x08, 0x0a, 0x1c, 0x25, 0x25, 0x49, 0x53, 0xa7, 0x9e, 0xf8, 0xbf, 0xb2, 0xb6, 0xae, 0xac, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0xaa, 0xaa, 0xab, 0xae, 0x1e, 0x60, 0x54, 0x44, 0x26, 0x3b, 0x34, 0x38, 0x37, 0x2c, 0x2c, 0x2c, 0x31, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x36, 0x34, 0x36, 0x36, 0x37, 0x36, 0x38, 0x36, 0x38, 0x38, 0x2d, 0x36, 0x2d, 0x36, 0x34, 0x36, 0x3e, 0x3d, 0x3d, 0x3d, 0x3d, 0x45, 0x45, 0x45, 0x31, 0x2c, 0x38, 0x37, 0x43, 0x3b, 0x43, 0x3b, 0x2a, 0x24, 0x1d, 0x15, 0x0f, 0x0f, 0x0c, 0x0c, 0x0d, 0x0d, 0x11, 0x1c, 0x21, 0x30, 0x4f, 0x4d, 0x59, 0x4e, 0x3f, 0xd5, 0xf7, 0xb7, 0xa9, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0xaa, 0xaa, 0xb5, 0xfc, 0x5a, 0x5f, 0x4f, 0x1f, 0x40, 0x2f, 0x33, 0x3b, 0x43, 0x2d, 0x2d, 0x31, 0x3c, 0x31, 0x3c, 0x3c, 0x3c, 0x3d, 0x3d, 0x3d, 0x38, 0x36, 0x37, 0x36, 0x37, 0x38, 0x38, 0x38, 0x3e, 0x3e, 0x38, 0x2c, 0x2d, 0x2c, 0x2d, 0x38, 0x3d, 0x3d, 0x3c, 0x31, 0x31, 0x31, 0x31, 0x2c, 0x38, 0x43, 0x43, 0x46, 0x3b, 0x2a, 0x24, 0x24, 0x19, 0x14, 0x13, 0x0c, 0x07, 0x0d, 0x0d, 0x11, 0x1f, 0x21, 0x30, 0x47, 0x55, 0x55, 0x4d, 0x49, 0xd5, 0x05, 0xb8, 0xf4, 0x62, 0x00, 0xaa, 0xa8, 0xaa, 0xaa, 0xab, 0xa8, 0xaa, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0xaa, 0xab, 0xaa, 0x03, 0x23, 0x5a, 0x5d, 0x51, 0x2b, 0x27, 0x26, 0x24, 0x2f, 0x2f, 0x3b, 0x3b, 0x34, 0x38, 0x38, 0x3c, 0x3d, 0x3c, 0x45, 0x45, 0x3c, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x31, 0x31, 0x2c, 0x3c, 0x38, 0x31, 0x31, 0x3c, 0x3e, 0x45, 0x37, 0x43, 0x34, 0x46, 0x3b, 0x27, 0x1d, 0x1d, 0x14, 0x0f, 0x0c, 0x07, 0x08, 0x08, 0x11, 0x18, 0x21, 0x30, 0x47, 0x47, 0x4d, 0x55, 0x53, 0x3f, 0xd5, 0xb3, 0x03, 0xf5, 0x02, 0x61, 0x00, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x61, 0xf9, 0x61, 0x61, 0x00, 0xa8, 0x00, 0xa9, 0x05, 0xfd, 0x5e, 0x5f, 0x58, 0x50, 0x4c, 0x2b, 0x2b, 0x29, 0x26, 0x24, 0x27, 0x2f, 0x2a, 0x33, 0x33, 0x2d, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x31, 0x31, 0x2c, 0x31, 0x37, 0x38, 0x37, 0x37, 0x43, 0x3b, 0x43, 0x3b, 0x3b, 0x2f, 0x27, 0x27, 0x1d, 0x19, 0x13, 0x10, 0x08, 0x0d, 0x0d, 0x11, 0x1c, 0x21, 0x25, 0x47, 0x4d, 0x55, 0x55, 0x55, 0x53, 0x41, 0xcf, 0xf7, 0xfe, 0xf4, 0xaa, 0xf4, 0x62, 0xf9, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x00, 0x00, 0xaa, 0x00, 0xfa, 0xb3, 0x1e, 0x4d, 0x5a, 0x5e, 0x5e, 0x5a, 0x54, 0x50, 0x4a, 0x44, 0x42, 0x3a, 0x3a, 0x29, 0x26, 0x27, 0x26, 0x27, 0x2f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2a, 0x33, 0x2a, 0x2f, 0x2e, 0x2e, 0x26, 0x20, 0x19, 0x13, 0x13, 0x0d, 0x18, 0x11, 0x16, 0x1c, 0x1c, 0x25, 0x30, 0x3f, 0x4d, 0x4e, 0x55, 0x59, 0xa0, 0xfd, 0xd5, 0xff, 0xb2, 0xfe, 0xad, 0xa9, 0xae, 0xac, 0xaa, 0xaa, 0x00, 0x00, 0x61, 0x61, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x61, 0xf9, 0x61, 0x61, 0x61, 0x00, 0xaa, 0xaa, 0x00, 0x02, 0xb7, 0xb3, 0x1e, 0xe4, 0x59, 0x5c, 0x5f, 0x60, 0x5e, 0x5d, 0x57, 0x54, 0x54, 0x4a, 0x4a, 0x44, 0x44, 0x42, 0x2b, 0x29, 0x3a, 0x26, 0x2e, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x29, 0x26, 0x26, 0x20, 0x18, 0x18, 0x18, 0x11, 0x1c, 0x1c, 0x21, 0x21, 0x25, 0x30, 0x3f, 0x4d, 0xa0, 0x59, 0xa3, 0x59, 0x4e, 0xfd, 0x17, 0xbc, 0xb9, 0xb7, 0xfa, 0xf4, 0xac, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x61, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xb5, 0xae, 0xf6, 0xb3, 0xcf, 0x1e, 0xfd, 0x53, 0x59, 0x59, 0x60, 0x5f, 0x5f, 0x5e, 0x5e, 0x5a, 0x5e, 0x57, 0x57, 0x4f, 0x54, 0x4f, 0x51, 0x4f, 0x4a, 0x44, 0x44, 0x28, 0x28, 0x21, 0x28, 0x21, 0x21, 0x30, 0x30, 0x3f, 0x47, 0x4d, 0x55, 0x55, 0x55, 0x53, 0x53, 0x53, 0x4e, 0xfd, 0xda, 0xfc, 0xfb, 0xb2, 0xb8, 0xfe, 0xad, 0xac, 0xb5, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xb5, 0xab, 0xab, 0xac, 0xa9, 0xae, 0xb7, 0xb9, 0xfb, 0xfc, 0x1e, 0xe0, 0x49, 0xe4, 0x53, 0x53, 0x60, 0x60, 0x60, 0x5f, 0x59, 0x59, 0x59, 0x55, 0x4d, 0x55, 0x4d, 0x55, 0xa0, 0x55, 0x55, 0x59, 0x55, 0xa5, 0x59, 0x53, 0x4e, 0x49, 0xe4, 0x41, 0xf8, 0xd5, 0xbc, 0xb3, 0xb9, 0xb7, 0xae, 0xf4, 0xb5, 0xad, 0xac, 0xaa, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf4, 0xf9, 0xb7, 0xf6, 0xb2, 0x03, 0xf7, 0xba, 0xbc, 0xd5, 0xd5, 0xda, 0xda, 0xb4, 0xf8, 0xe0, 0x23, 0xfd, 0xfd, 0xf8, 0xf8, 0xb4, 0xda, 0xda, 0x17, 0xbf, 0xfb, 0xba, 0xb9, 0xb9, 0xb1, 0xf6, 0xf6, 0xfa, 0xad, 0xf4, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_img_dsc_t image25 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 203,
-  .data_size = 65984,
-  .data = image25_map,
-};
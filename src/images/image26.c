@@ -1,500 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE26
-#define LV_ATTRIBUTE_IMG_IMAGE26
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE26 uint8_t image26_map[] = {
-  0xfc, 0xfc, 0xfc, 0xff, 	/*Color of index 0*/
-  0xf4, 0xf4, 0xfb, 0xff, 	/*Color of index 1*/
-  0xf5, 0xf5, 0xf6, 0xff, 	/*Color of index 2*/
-  0xee, 0xf2, 0xfe, 0xff, 	/*Color of index 3*/
-  0xf0, 0xee, 0xfd, 0xff, 	/*Color of index 4*/
-  0xee, 0xef, 0xf3, 0xff, 	/*Color of index 5*/
-  0xea, 0xea, 0xfd, 0xff, 	/*Color of index 6*/
-  0xe3, 0xe4, 0xfd, 0xff, 	/*Color of index 7*/
-  0xe5, 0xe5, 0xf1, 0xff, 	/*Color of index 8*/
-  0xdd, 0xdc, 0xfa, 0xff, 	/*Color of index 9*/
-  0xd3, 0xd4, 0xf9, 0xff, 	/*Color of index 10*/
-  0xd3, 0xd8, 0xe6, 0xff, 	/*Color of index 11*/
-  0xcb, 0xcb, 0xf7, 0xff, 	/*Color of index 12*/
-  0xca, 0xcb, 0xe7, 0xff, 	/*Color of index 13*/
-  0xbf, 0xbe, 0xf7, 0xff, 	/*Color of index 14*/
-  0xc2, 0xc2, 0xe5, 0xff, 	/*Color of index 15*/
-  0xba, 0xc0, 0xd2, 0xff, 	/*Color of index 16*/
-  0xb9, 0xba, 0xe1, 0xff, 	/*Color of index 17*/
-  0xb9, 0xab, 0xfd, 0xff, 	/*Color of index 18*/
-  0xae, 0xae, 0xe0, 0xff, 	/*Color of index 19*/
-  0xb6, 0xa2, 0xfc, 0xff, 	/*Color of index 20*/
-  0xad, 0xaf, 0xce, 0xff, 	/*Color of index 21*/
-  0xab, 0xa1, 0xfd, 0xff, 	/*Color of index 22*/
-  0xb2, 0x9c, 0xfa, 0xff, 	/*Color of index 23*/
-  0xa5, 0x9b, 0xfd, 0xff, 	/*Color of index 24*/
-  0xa3, 0x9f, 0xe8, 0xff, 	/*Color of index 25*/
-  0xa9, 0x98, 0xfd, 0xff, 	/*Color of index 26*/
-  0xa4, 0xa2, 0xda, 0xff, 	/*Color of index 27*/
-  0xa9, 0x98, 0xf2, 0xff, 	/*Color of index 28*/
-  0xa4, 0x93, 0xfb, 0xff, 	/*Color of index 29*/
-  0xa1, 0xa2, 0xc9, 0xff, 	/*Color of index 30*/
-  0x9a, 0x90, 0xfd, 0xff, 	/*Color of index 31*/
-  0xa3, 0x90, 0xec, 0xff, 	/*Color of index 32*/
-  0x96, 0x8a, 0xfd, 0xff, 	/*Color of index 33*/
-  0x97, 0x98, 0xc9, 0xff, 	/*Color of index 34*/
-  0x99, 0x8c, 0xe2, 0xff, 	/*Color of index 35*/
-  0x95, 0x96, 0xba, 0xff, 	/*Color of index 36*/
-  0x91, 0x83, 0xfb, 0xff, 	/*Color of index 37*/
-  0x92, 0x83, 0xe3, 0xff, 	/*Color of index 38*/
-  0x88, 0x7d, 0xfa, 0xff, 	/*Color of index 39*/
-  0x8c, 0x8b, 0xc2, 0xff, 	/*Color of index 40*/
-  0x89, 0x7c, 0xe0, 0xff, 	/*Color of index 41*/
-  0x87, 0x89, 0xae, 0xff, 	/*Color of index 42*/
-  0x7d, 0x72, 0xf6, 0xff, 	/*Color of index 43*/
-  0x86, 0x7b, 0xd0, 0xff, 	/*Color of index 44*/
-  0x82, 0x71, 0xde, 0xff, 	/*Color of index 45*/
-  0x7d, 0x7c, 0xb6, 0xff, 	/*Color of index 46*/
-  0x73, 0x69, 0xf4, 0xff, 	/*Color of index 47*/
-  0x66, 0x66, 0xfb, 0xff, 	/*Color of index 48*/
-  0x7c, 0x72, 0xc8, 0xff, 	/*Color of index 49*/
-  0x7b, 0x7c, 0xa5, 0xff, 	/*Color of index 50*/
-  0x62, 0x63, 0xfe, 0xff, 	/*Color of index 51*/
-  0x65, 0x63, 0xf3, 0xff, 	/*Color of index 52*/
-  0x7b, 0x6b, 0xcc, 0xff, 	/*Color of index 53*/
-  0x77, 0x66, 0xdd, 0xff, 	/*Color of index 54*/
-  0x5d, 0x5c, 0xfb, 0xff, 	/*Color of index 55*/
-  0x74, 0x73, 0x9b, 0xff, 	/*Color of index 56*/
-  0x68, 0x5e, 0xe5, 0xff, 	/*Color of index 57*/
-  0x71, 0x65, 0xc8, 0xff, 	/*Color of index 58*/
-  0x6b, 0x69, 0xa7, 0xff, 	/*Color of index 59*/
-  0x5a, 0x57, 0xe6, 0xff, 	/*Color of index 60*/
-  0x52, 0x52, 0xf9, 0xff, 	/*Color of index 61*/
-  0x6d, 0x62, 0xba, 0xff, 	/*Color of index 62*/
-  0x6a, 0x5d, 0xcb, 0xff, 	/*Color of index 63*/
-  0x69, 0x6a, 0x95, 0xff, 	/*Color of index 64*/
-  0x6d, 0x59, 0xc8, 0xff, 	/*Color of index 65*/
-  0x52, 0x51, 0xeb, 0xff, 	/*Color of index 66*/
-  0x5b, 0x52, 0xde, 0xff, 	/*Color of index 67*/
-  0x4c, 0x4c, 0xf4, 0xff, 	/*Color of index 68*/
-  0x49, 0x4a, 0xec, 0xff, 	/*Color of index 69*/
-  0x60, 0x5c, 0xa7, 0xff, 	/*Color of index 70*/
-  0x63, 0x56, 0xb6, 0xff, 	/*Color of index 71*/
-  0x5d, 0x4f, 0xca, 0xff, 	/*Color of index 72*/
-  0x61, 0x5e, 0x96, 0xff, 	/*Color of index 73*/
-  0x53, 0x4a, 0xde, 0xff, 	/*Color of index 74*/
-  0x49, 0x4b, 0xde, 0xff, 	/*Color of index 75*/
-  0x44, 0x43, 0xee, 0xff, 	/*Color of index 76*/
-  0x5a, 0x5c, 0x87, 0xff, 	/*Color of index 77*/
-  0x4f, 0x47, 0xcf, 0xff, 	/*Color of index 78*/
-  0x5d, 0x4b, 0xb8, 0xff, 	/*Color of index 79*/
-  0x5a, 0x4f, 0xa8, 0xff, 	/*Color of index 80*/
-  0x46, 0x41, 0xdd, 0xff, 	/*Color of index 81*/
-  0x3d, 0x3b, 0xe5, 0xff, 	/*Color of index 82*/
-  0x37, 0x34, 0xfb, 0xff, 	/*Color of index 83*/
-  0x38, 0x36, 0xf3, 0xff, 	/*Color of index 84*/
-  0x42, 0x3f, 0xcf, 0xff, 	/*Color of index 85*/
-  0x50, 0x44, 0xb9, 0xff, 	/*Color of index 86*/
-  0x3a, 0x37, 0xeb, 0xff, 	/*Color of index 87*/
-  0x53, 0x4d, 0x92, 0xff, 	/*Color of index 88*/
-  0x40, 0x3a, 0xd7, 0xff, 	/*Color of index 89*/
-  0x34, 0x2f, 0xfb, 0xff, 	/*Color of index 90*/
-  0x50, 0x45, 0xa5, 0xff, 	/*Color of index 91*/
-  0x32, 0x30, 0xf1, 0xff, 	/*Color of index 92*/
-  0x39, 0x35, 0xdc, 0xff, 	/*Color of index 93*/
-  0x31, 0x31, 0xeb, 0xff, 	/*Color of index 94*/
-  0x33, 0x33, 0xe3, 0xff, 	/*Color of index 95*/
-  0x32, 0x2e, 0xf2, 0xff, 	/*Color of index 96*/
-  0x2e, 0x2c, 0xf9, 0xff, 	/*Color of index 97*/
-  0x3b, 0x31, 0xe2, 0xff, 	/*Color of index 98*/
-  0x4e, 0x4c, 0x80, 0xff, 	/*Color of index 99*/
-  0x2d, 0x2c, 0xf2, 0xff, 	/*Color of index 100*/
-  0x39, 0x34, 0xd3, 0xff, 	/*Color of index 101*/
-  0x3a, 0x35, 0xca, 0xff, 	/*Color of index 102*/
-  0x2f, 0x2c, 0xec, 0xff, 	/*Color of index 103*/
-  0x2d, 0x2f, 0xe2, 0xff, 	/*Color of index 104*/
-  0x31, 0x31, 0xd8, 0xff, 	/*Color of index 105*/
-  0x29, 0x28, 0xf5, 0xff, 	/*Color of index 106*/
-  0x31, 0x2c, 0xe4, 0xff, 	/*Color of index 107*/
-  0x3b, 0x36, 0xbd, 0xff, 	/*Color of index 108*/
-  0x2d, 0x2a, 0xe9, 0xff, 	/*Color of index 109*/
-  0x47, 0x3a, 0xa8, 0xff, 	/*Color of index 110*/
-  0x4c, 0x3f, 0x94, 0xff, 	/*Color of index 111*/
-  0x2b, 0x2c, 0xdc, 0xff, 	/*Color of index 112*/
-  0x2b, 0x29, 0xe4, 0xff, 	/*Color of index 113*/
-  0x34, 0x2f, 0xca, 0xff, 	/*Color of index 114*/
-  0x2a, 0x26, 0xe9, 0xff, 	/*Color of index 115*/
-  0x2a, 0x23, 0xf3, 0xff, 	/*Color of index 116*/
-  0x49, 0x47, 0x6f, 0xff, 	/*Color of index 117*/
-  0x2a, 0x2c, 0xd4, 0xff, 	/*Color of index 118*/
-  0x33, 0x2a, 0xd7, 0xff, 	/*Color of index 119*/
-  0x25, 0x28, 0xe2, 0xff, 	/*Color of index 120*/
-  0x3f, 0x3b, 0x97, 0xff, 	/*Color of index 121*/
-  0x25, 0x24, 0xe9, 0xff, 	/*Color of index 122*/
-  0x24, 0x28, 0xda, 0xff, 	/*Color of index 123*/
-  0x41, 0x3e, 0x86, 0xff, 	/*Color of index 124*/
-  0x28, 0x25, 0xe2, 0xff, 	/*Color of index 125*/
-  0x32, 0x2d, 0xbf, 0xff, 	/*Color of index 126*/
-  0x2b, 0x29, 0xcb, 0xff, 	/*Color of index 127*/
-  0x35, 0x32, 0xa7, 0xff, 	/*Color of index 128*/
-  0x25, 0x22, 0xe1, 0xff, 	/*Color of index 129*/
-  0x2b, 0x24, 0xd8, 0xff, 	/*Color of index 130*/
-  0x24, 0x23, 0xdb, 0xff, 	/*Color of index 131*/
-  0x3f, 0x3d, 0x77, 0xff, 	/*Color of index 132*/
-  0x2a, 0x29, 0xbf, 0xff, 	/*Color of index 133*/
-  0x23, 0x23, 0xd3, 0xff, 	/*Color of index 134*/
-  0x32, 0x2b, 0xb2, 0xff, 	/*Color of index 135*/
-  0x1f, 0x20, 0xd8, 0xff, 	/*Color of index 136*/
-  0x21, 0x1d, 0xdd, 0xff, 	/*Color of index 137*/
-  0x1c, 0x20, 0xd2, 0xff, 	/*Color of index 138*/
-  0x1c, 0x22, 0xcb, 0xff, 	/*Color of index 139*/
-  0x3c, 0x2e, 0x96, 0xff, 	/*Color of index 140*/
-  0x23, 0x1f, 0xca, 0xff, 	/*Color of index 141*/
-  0x1f, 0x1d, 0xd2, 0xff, 	/*Color of index 142*/
-  0x24, 0x22, 0xbe, 0xff, 	/*Color of index 143*/
-  0x27, 0x24, 0xb3, 0xff, 	/*Color of index 144*/
-  0x37, 0x2e, 0x88, 0xff, 	/*Color of index 145*/
-  0x1c, 0x18, 0xda, 0xff, 	/*Color of index 146*/
-  0x1b, 0x1a, 0xd2, 0xff, 	/*Color of index 147*/
-  0x37, 0x32, 0x77, 0xff, 	/*Color of index 148*/
-  0x26, 0x24, 0xa7, 0xff, 	/*Color of index 149*/
-  0x1b, 0x19, 0xcb, 0xff, 	/*Color of index 150*/
-  0x1b, 0x1b, 0xc4, 0xff, 	/*Color of index 151*/
-  0x21, 0x1c, 0xbe, 0xff, 	/*Color of index 152*/
-  0x35, 0x35, 0x62, 0xff, 	/*Color of index 153*/
-  0x14, 0x19, 0xc9, 0xff, 	/*Color of index 154*/
-  0x17, 0x15, 0xd2, 0xff, 	/*Color of index 155*/
-  0x21, 0x1c, 0xb4, 0xff, 	/*Color of index 156*/
-  0x26, 0x23, 0x97, 0xff, 	/*Color of index 157*/
-  0x16, 0x17, 0xc4, 0xff, 	/*Color of index 158*/
-  0x18, 0x15, 0xc9, 0xff, 	/*Color of index 159*/
-  0x1b, 0x18, 0xbb, 0xff, 	/*Color of index 160*/
-  0x2d, 0x27, 0x7f, 0xff, 	/*Color of index 161*/
-  0x16, 0x15, 0xc3, 0xff, 	/*Color of index 162*/
-  0x13, 0x17, 0xbb, 0xff, 	/*Color of index 163*/
-  0x12, 0x12, 0xca, 0xff, 	/*Color of index 164*/
-  0x1a, 0x18, 0xb2, 0xff, 	/*Color of index 165*/
-  0x18, 0x1b, 0xa8, 0xff, 	/*Color of index 166*/
-  0x22, 0x1a, 0xa6, 0xff, 	/*Color of index 167*/
-  0x32, 0x20, 0x8a, 0xff, 	/*Color of index 168*/
-  0x13, 0x13, 0xc0, 0xff, 	/*Color of index 169*/
-  0x29, 0x29, 0x6d, 0xff, 	/*Color of index 170*/
-  0x13, 0x13, 0xbc, 0xff, 	/*Color of index 171*/
-  0x22, 0x1b, 0x98, 0xff, 	/*Color of index 172*/
-  0x0f, 0x10, 0xc3, 0xff, 	/*Color of index 173*/
-  0x30, 0x22, 0x78, 0xff, 	/*Color of index 174*/
-  0x13, 0x13, 0xb4, 0xff, 	/*Color of index 175*/
-  0x31, 0x27, 0x66, 0xff, 	/*Color of index 176*/
-  0x12, 0x0c, 0xc4, 0xff, 	/*Color of index 177*/
-  0x0d, 0x0f, 0xba, 0xff, 	/*Color of index 178*/
-  0x17, 0x16, 0x9d, 0xff, 	/*Color of index 179*/
-  0x15, 0x12, 0xab, 0xff, 	/*Color of index 180*/
-  0x27, 0x25, 0x5e, 0xff, 	/*Color of index 181*/
-  0x1a, 0x18, 0x8d, 0xff, 	/*Color of index 182*/
-  0x0d, 0x0b, 0xbb, 0xff, 	/*Color of index 183*/
-  0x0c, 0x0d, 0xb3, 0xff, 	/*Color of index 184*/
-  0x15, 0x11, 0xa1, 0xff, 	/*Color of index 185*/
-  0x26, 0x19, 0x7e, 0xff, 	/*Color of index 186*/
-  0x0c, 0x0b, 0xac, 0xff, 	/*Color of index 187*/
-  0x14, 0x12, 0x8f, 0xff, 	/*Color of index 188*/
-  0x26, 0x18, 0x6e, 0xff, 	/*Color of index 189*/
-  0x19, 0x0b, 0x9a, 0xff, 	/*Color of index 190*/
-  0x15, 0x13, 0x7f, 0xff, 	/*Color of index 191*/
-  0x0a, 0x09, 0xa3, 0xff, 	/*Color of index 192*/
-  0x1e, 0x1a, 0x5e, 0xff, 	/*Color of index 193*/
-  0x05, 0x04, 0xb0, 0xff, 	/*Color of index 194*/
-  0x09, 0x0a, 0x97, 0xff, 	/*Color of index 195*/
-  0x20, 0x1c, 0x51, 0xff, 	/*Color of index 196*/
-  0x17, 0x13, 0x6e, 0xff, 	/*Color of index 197*/
-  0x0c, 0x09, 0x86, 0xff, 	/*Color of index 198*/
-  0x18, 0x0c, 0x72, 0xff, 	/*Color of index 199*/
-  0x19, 0x12, 0x5d, 0xff, 	/*Color of index 200*/
-  0x02, 0x02, 0x96, 0xff, 	/*Color of index 201*/
-  0x0c, 0x07, 0x78, 0xff, 	/*Color of index 202*/
-  0x16, 0x14, 0x44, 0xff, 	/*Color of index 203*/
-  0x16, 0x0e, 0x51, 0xff, 	/*Color of index 204*/
-  0x01, 0x00, 0x85, 0xff, 	/*Color of index 205*/
-  0x13, 0x09, 0x60, 0xff, 	/*Color of index 206*/
-  0x0d, 0x06, 0x6a, 0xff, 	/*Color of index 207*/
-  0x0a, 0x0b, 0x50, 0xff, 	/*Color of index 208*/
-  0x02, 0x00, 0x77, 0xff, 	/*Color of index 209*/
-  0x0a, 0x05, 0x5d, 0xff, 	/*Color of index 210*/
-  0x02, 0x00, 0x6b, 0xff, 	/*Color of index 211*/
-  0x03, 0x00, 0x62, 0xff, 	/*Color of index 212*/
-  0x0c, 0x07, 0x45, 0xff, 	/*Color of index 213*/
-  0x02, 0x00, 0x5a, 0xff, 	/*Color of index 214*/
-  0x02, 0x00, 0x52, 0xff, 	/*Color of index 215*/
-  0x03, 0x00, 0x4b, 0xff, 	/*Color of index 216*/
-  0x0f, 0x04, 0x36, 0xff, 	/*Color of index 217*/
-  0x02, 0x00, 0x43, 0xff, 	/*Color of index 218*/
-  0x01, 0x00, 0x37, 0xff, 	/*Color of index 219*/
-  0x04, 0x00, 0x28, 0xff, 	/*Color of index 220*/
-  0xf5, 0xf9, 0xfd, 0xff, 	/*Color of index 221*/
-  0xe6, 0xe8, 0xe8, 0xff, 	/*Color of index 222*/
-  0xee, 0xf9, 0xf3, 0xff, 	/*Color of index 223*/
-  0xf4, 0xfa, 0xec, 0xff, 	/*Color of index 224*/
-  0xf5, 0xf7, 0xf2, 0xff, 	/*Color of index 225*/
-  0xec, 0xee, 0xeb, 0xff, 	/*Color of index 226*/
-  0xfb, 0xfc, 0xf3, 0xff, 	/*Color of index 227*/
-  0xfa, 0xfc, 0xec, 0xff, 	/*Color of index 228*/
-  0xfa, 0xfc, 0xe1, 0xff, 	/*Color of index 229*/
-  0xf1, 0xf3, 0xec, 0xff, 	/*Color of index 230*/
-  0xf4, 0xf2, 0xe1, 0xff, 	/*Color of index 231*/
-  0xea, 0xed, 0xe2, 0xff, 	/*Color of index 232*/
-  0xf0, 0xed, 0xd0, 0xff, 	/*Color of index 233*/
-  0xe2, 0xe5, 0xd6, 0xff, 	/*Color of index 234*/
-  0xdc, 0xd6, 0xc7, 0xff, 	/*Color of index 235*/
-  0xf9, 0xf5, 0xf4, 0xff, 	/*Color of index 236*/
-  0xf8, 0xe3, 0xbb, 0xff, 	/*Color of index 237*/
-  0xcb, 0xbf, 0xad, 0xff, 	/*Color of index 238*/
-  0xc5, 0xae, 0x8d, 0xff, 	/*Color of index 239*/
-  0xa2, 0x97, 0x8a, 0xff, 	/*Color of index 240*/
-  0xb5, 0x92, 0x60, 0xff, 	/*Color of index 241*/
-  0x8f, 0x7e, 0x68, 0xff, 	/*Color of index 242*/
-  0xaf, 0x7c, 0x39, 0xff, 	/*Color of index 243*/
-  0x9d, 0x7a, 0x44, 0xff, 	/*Color of index 244*/
-  0x91, 0x75, 0x49, 0xff, 	/*Color of index 245*/
-  0xa6, 0x71, 0x30, 0xff, 	/*Color of index 246*/
-  0x84, 0x6c, 0x4b, 0xff, 	/*Color of index 247*/
-  0x93, 0x6c, 0x33, 0xff, 	/*Color of index 248*/
-  0x65, 0x5c, 0x55, 0xff, 	/*Color of index 249*/
-  0x80, 0x63, 0x32, 0xff, 	/*Color of index 250*/
-  0xf9, 0xf2, 0xfb, 0xff, 	/*Color of index 251*/
-  0xf9, 0xee, 0xfe, 0xff, 	/*Color of index 252*/
-  0xf1, 0xec, 0xf2, 0xff, 	/*Color of index 253*/
-  0x38, 0x0f, 0x95, 0xff, 	/*Color of index 254*/
-  0x10, 0x03, 0x23, 0xff, 	/*Color of index 255*/
-
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xec, 0xe1, 0xec, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x02, 0xdf, 0x02, 0xdf, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0xe0, 0xe1, 0xdf, 0xe3, 0xe1, 0xec, 0x05, 0x02, 0xdd, 0xec, 0x02, 0xe1, 0xec, 0xe1, 0xec, 0xfb, 0xfc, 0xfb, 0xfb, 0xec, 0xec, 0xec, 0xe0, 0xe0, 0xe4, 0xe4, 0xe5, 0xe4, 0xe5, 0xe5, 0xe4, 0xe1, 0x01, 0x02, 0x02, 0xe1, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe1, 0xe1, 0x02, 0x02, 0xfb, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xec, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3, 0xe1, 0xe0, 0xe1, 0xdf, 0xe1, 0xdf, 0x02, 0xdf, 0x02, 0xdf, 0xdd, 0xdf, 0x02, 0x02, 0xe1, 0xdd, 0xe1, 0xdd, 0xe1, 0xdd, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xdd, 0x02, 0xdd, 0xec, 0x02, 0x05, 0xec, 0xfb, 0xe6, 0x05, 0x05, 0xfb, 0xfb, 0xfb, 0xec, 0xfb, 0xec, 0xec, 0xe1, 0xe3, 0xe0, 0xe0, 0xe4, 0xe0, 0xe4, 0xe4, 0xe0, 0x02, 0x01, 0x01, 0x02, 0xdf, 0x02, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0xdd, 0xec, 0xdd, 0x02, 0xe1, 0xdd, 0xe1, 0x02, 0xe6, 0x05, 0xe2, 0xe1, 0xe1, 0x02, 0xec, 0x01, 0xec, 0x01, 0xdd, 0xfc, 0x05, 0xfb, 0x01, 0xec, 0x00, 0x00, 0x00, 0xec, 0x01, 0xec, 0xdd, 0xdd, 0xec, 0xdd, 0xec, 0x02, 0xec, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0x02, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0x02, 0xdf, 0x02, 0xdf, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0xec, 0x02, 0xec, 0x02, 0xec, 0x02, 0xec, 0xec, 0xec, 0xec, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xec, 0xdd, 0x02, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0xdd, 0xfb, 0xec, 0xfb, 0xec, 0x05, 0xec, 0xec, 0xe1, 0xec, 0xec, 0xec, 0x01, 0xec, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0x02, 0xdf, 0x02, 0x02, 0x02, 0xdd, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x03, 0xfb, 0xec, 0xe1, 0xec, 0xec, 0xec, 0xec, 0xec, 0xe1, 0xe1, 0xe1, 0xe1, 0xe6, 0xe6, 0xe6, 0xe6, 0xec, 0x05, 0x02, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xec, 0xec, 0xec, 0xec, 0xe3, 0xe3, 0xe0, 0xe1, 0xe1, 0xec, 0xe1, 0x02, 0x02, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe3, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0x02, 0xdf, 0x02, 0xdf, 0x02, 0xdf, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0xe3, 0xe1, 0xe4, 0xe1, 0xe4, 0xec, 0xe1, 0xec, 0xe3, 0xec, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x03, 0x03, 0xfb, 0x03, 0xfb, 0x01, 0xfb, 0x04, 0xfb, 0xfb, 0x01, 0xec, 0x05, 0xec, 0xe3, 0xe1, 0xe0, 0xe0, 0xe6, 0xe1, 0xe6, 0x02, 0xec, 0x02, 0xec, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xec, 0x02, 0xec, 0x02, 0x02, 0xfb, 0x02, 0xfb, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xdf, 0xe0, 0xdf, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0x02, 0xdf, 0x02, 0xe1, 0xdf, 0xe1, 0xdf, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xec, 0xe5, 0xe1, 0xe4, 0xe1, 0xe3, 0xe1, 0xe3, 0x05, 0x02, 0x01, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x03, 0x03, 0x03, 0x01, 0x01, 0x03, 0xdd, 0xdd, 0x00, 0xdd, 0xdd, 0x01, 0xdd, 0x00, 0xe6, 0xdf, 0xdf, 0xe3, 0xdf, 0xdf, 0xe1, 0xec, 0xe1, 0xe1, 0xec, 0xe1, 0xec, 0xe4, 0xec, 0xe4, 0xe1, 0xe0, 0xe3, 0xe1, 0xe1, 0xec, 0x02, 0xec, 0x02, 0xec, 0x02, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe3, 0xe1, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xe6, 0xe6, 0xe1, 0xec, 0x02, 0xdd, 0xdd, 0xdd, 0x01, 0x03, 0x06, 0x09, 0x0f, 0x11, 0x22, 0x22, 0x2a, 0x32, 0x40, 0x49, 0x49, 0x40, 0x49, 0x49, 0x4d, 0x40, 0x32, 0x24, 0x1e, 0x15, 0x0f, 0x0d, 0x04, 0x04, 0xdd, 0xdd, 0xdd, 0xdd, 0x03, 0x05, 0x02, 0xe1, 0xe1, 0xe4, 0xe4, 0xe4, 0xe5, 0xe4, 0xe4, 0xe4, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xec, 0x02, 0xec, 0x02, 0x02, 0xe1, 0xdf, 0xe1, 0xdf, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xec, 0xec, 0xe2, 0xe6, 0xe3, 0xe3, 0xe6, 0xe4, 0xe1, 0xe0, 0xe3, 0xe1, 0xe6, 0xe6, 0x02, 0x01, 0xdd, 0xdd, 0xdd, 0x03, 0x09, 0x13, 0x22, 0x3b, 0x58, 0xaa, 0xc1, 0xce, 0xd6, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd0, 0xd7, 0xd8, 0xda, 0xda, 0xda, 0xd0, 0xd0, 0xb5, 0x84, 0x4d, 0x2e, 0x22, 0x0f, 0x09, 0xdd, 0x01, 0x00, 0x00, 0xe6, 0xe6, 0xe4, 0xe4, 0xe4, 0xe5, 0xe4, 0xe4, 0xe4, 0xe0, 0xe6, 0xe1, 0xe1, 0x00, 0xec, 0xdd, 0x00, 0x02, 0x05, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xdd, 0x00, 0x00, 0x00, 0xe3, 0xe1, 0xe6, 0xe6, 0xe1, 0xe1, 0xe1, 0xec, 0x00, 0x00, 0x00, 0xdd, 0x01, 0x0c, 0x22, 0x3b, 0x94, 0xc1, 0xd8, 0xd8, 0xd6, 0xd6, 0xd4, 0xd1, 0xc6, 0xc6, 0xb3, 0xac, 0x95, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x95, 0x9d, 0x9d, 0xb6, 0xbf, 0xbf, 0xbf, 0xbf, 0xd4, 0xd3, 0xd6, 0xd6, 0xd6, 0xce, 0xaa, 0x94, 0x2e, 0x13, 0x07, 0xdd, 0x00, 0xdf, 0xe1, 0xe0, 0xdf, 0xe0, 0xe0, 0xdf, 0xe3, 0x00, 0xe3, 0xe1, 0xe1, 0xec, 0xe2, 0xe2, 0x05, 0x00, 0xdd, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xdd, 0xfd, 0x05, 0xec, 0x00, 0xec, 0xec, 0x00, 0xe6, 0xdd, 0xdd, 0x03, 0x01, 0x07, 0x10, 0x2a, 0x94, 0xa1, 0xcf, 0xd6, 0xd4, 0xca, 0xb6, 0x9d, 0x87, 0x7e, 0x66, 0x5d, 0x59, 0x57, 0x52, 0x4c, 0x51, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x51, 0x4c, 0x51, 0x52, 0x51, 0x59, 0x65, 0x66, 0x72, 0x85, 0x8f, 0xa7, 0xbe, 0xcd, 0xd1, 0xd1, 0xd3, 0xd2, 0xd8, 0xcc, 0x63, 0x1e, 0x0a, 0x03, 0x03, 0x03, 0xdd, 0xdd, 0x02, 0xe2, 0x02, 0xe3, 0x00, 0xe0, 0xdd, 0xe3, 0x05, 0x02, 0xdd, 0xdd, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0xec, 0xec, 0x00, 0xdd, 0xfd, 0xde, 0x04, 0x06, 0xdd, 0x01, 0x0a, 0x24, 0x63, 0xc4, 0xda, 0xd4, 0xd1, 0xc6, 0x9d, 0x87, 0x6c, 0x51, 0x51, 0x52, 0x5d, 0x57, 0x57, 0x67, 0x6d, 0x6d, 0x5a, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x67, 0x60, 0x5c, 0x54, 0x54, 0x57, 0x54, 0x57, 0x57, 0x4c, 0x57, 0x4c, 0x52, 0x5d, 0x7e, 0x85, 0xb3, 0xbc, 0xbf, 0xd3, 0xd8, 0xd0, 0x7c, 0x2e, 0x0c, 0x07, 0xdd, 0xdd, 0x03, 0x03, 0xdd, 0x05, 0xe6, 0x00, 0x00, 0x00, 0x02, 0x05, 0x04, 0x01, 0x01, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xdd, 0x01, 0x05, 0xfd, 0x01, 0xdd, 0x01, 0x03, 0x13, 0x49, 0xc1, 0xd8, 0xd7, 0xc7, 0x9d, 0x6c, 0x66, 0x55, 0x51, 0x51, 0x51, 0x59, 0x5d, 0x4c, 0x4c, 0x57, 0x54, 0x54, 0x54, 0x53, 0x5c, 0x64, 0x64, 0x6a, 0x61, 0x6a, 0x61, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x64, 0x6a, 0x64, 0x64, 0x64, 0x60, 0x67, 0x67, 0x6d, 0x60, 0x5e, 0x5e, 0x62, 0x4c, 0x65, 0x7e, 0x87, 0x9d, 0xc6, 0xd1, 0xcf, 0xc5, 0x46, 0x19, 0x0a, 0x04, 0xdd, 0xdd, 0x01, 0x02, 0xe6, 0xe1, 0x00, 0x02, 0x05, 0x05, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0x02, 0xfd, 0x04, 0xdd, 0xdd, 0x0a, 0x1b, 0x63, 0xc1, 0xd7, 0xd3, 0xac, 0x80, 0x66, 0x55, 0x59, 0x51, 0x4a, 0x45, 0x3d, 0x37, 0x33, 0x33, 0x37, 0x37, 0x3d, 0x3d, 0x44, 0x44, 0x54, 0x6b, 0x53, 0x5a, 0x5c, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x5c, 0x64, 0x64, 0x60, 0x5a, 0x54, 0x54, 0x54, 0x57, 0x52, 0x4c, 0x45, 0x66, 0x90, 0xa6, 0xd1, 0xd6, 0xd6, 0x91, 0x28, 0x0a, 0x03, 0x01, 0x00, 0x00, 0xe2, 0xe1, 0xe1, 0x02, 0x01, 0xdd, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0xdd, 0x07, 0x1e, 0x63, 0xcc, 0xda, 0xca, 0x8c, 0x55, 0x51, 0x5d, 0x4c, 0x3d, 0x33, 0x37, 0x33, 0x33, 0x30, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x37, 0x44, 0x57, 0x5e, 0x54, 0x5e, 0x5c, 0x5c, 0x60, 0x60, 0x64, 0x67, 0x64, 0x67, 0x64, 0x5e, 0x5c, 0x5e, 0x68, 0x5e, 0x54, 0x54, 0x54, 0x5c, 0x64, 0x60, 0x64, 0x67, 0x71, 0x7d, 0x68, 0x57, 0x4c, 0x4c, 0x51, 0x66, 0x9d, 0xcf, 0xd7, 0xb0, 0x28, 0x06, 0x08, 0xe3, 0x00, 0xe1, 0xe1, 0x02, 0x00, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x05, 0xdd, 0xdd, 0x11, 0x63, 0xd5, 0xda, 0xc5, 0x80, 0x56, 0x55, 0x4b, 0x44, 0x3d, 0x37, 0x33, 0x37, 0x30, 0x37, 0x33, 0x33, 0x30, 0x33, 0x33, 0x37, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x33, 0x52, 0x57, 0x54, 0x5e, 0x54, 0x5e, 0x5c, 0x5e, 0x5c, 0x5e, 0x5c, 0x54, 0x5e, 0x54, 0x5e, 0x54, 0x5e, 0x57, 0x5e, 0x5e, 0x5c, 0x5c, 0x60, 0x53, 0x64, 0x53, 0x53, 0x5c, 0x67, 0x5c, 0x5e, 0x5e, 0x5f, 0x59, 0x51, 0x55, 0x95, 0xc5, 0xd0, 0xc1, 0x1e, 0x09, 0x00, 0xdd, 0xe2, 0xe1, 0x00, 0xec, 0xec, 0x02, 0xec, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xec, 0x02, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe0, 0xe1, 0xdf, 0x02, 0x01, 0x01, 0x01, 0x01, 0xfb, 0xdd, 0x02, 0xe1, 0xe3, 0xe4, 0xe4, 0x05, 0xdd, 0x0c, 0x3b, 0xd0, 0xda, 0xbf, 0x80, 0x6c, 0x4e, 0x45, 0x3c, 0x37, 0x30, 0x33, 0x33, 0x37, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x30, 0x37, 0x37, 0x30, 0x30, 0x34, 0x34, 0x30, 0x4c, 0x54, 0x67, 0x5c, 0x67, 0x53, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5e, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x5c, 0x5c, 0x60, 0x5c, 0x5c, 0x5c, 0x60, 0x67, 0x5e, 0x57, 0x51, 0x65, 0xa6, 0xbf, 0xd7, 0x7c, 0x13, 0x01, 0x06, 0xe2, 0xe3, 0xe6, 0xfd, 0xdd, 0xfb, 0xfb, 0x00, 0x03, 0xe2, 0x00, 0xdf, 0xdf, 0xdf, 0xe1, 0xe1, 0xec, 0xec, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0xe0, 0xe1, 0x02, 0x01, 0x01, 0xfb, 0x01, 0xfd, 0xe2, 0x00, 0xe1, 0xe6, 0xe1, 0xe6, 0x00, 0x28, 0xa1, 0xda, 0xcf, 0x80, 0x55, 0x55, 0x42, 0x3d, 0x37, 0x37, 0x33, 0x30, 0x30, 0x30, 0x34, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x34, 0x30, 0x4c, 0x5a, 0x5c, 0x64, 0x60, 0x5c, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x61, 0x64, 0x64, 0x60, 0x54, 0x57, 0x5d, 0x72, 0x95, 0xd1, 0xd2, 0x3b, 0x06, 0xdd, 0x02, 0xec, 0xec, 0xfb, 0xfb, 0x05, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe1, 0xec, 0xec, 0xec, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0xe1, 0xdf, 0x02, 0x02, 0x01, 0x02, 0xe1, 0xe1, 0x00, 0xe1, 0xe2, 0x04, 0xdd, 0x09, 0x63, 0xd2, 0xd4, 0xbf, 0x6c, 0x48, 0x4e, 0x3d, 0x2b, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x33, 0x33, 0x30, 0x30, 0x33, 0x54, 0x5c, 0x64, 0x60, 0x60, 0x53, 0x60, 0x64, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x5c, 0x64, 0x60, 0x6d, 0x5e, 0x57, 0x4c, 0x55, 0x6c, 0xbf, 0xd7, 0x84, 0x13, 0x04, 0xfb, 0xfc, 0xe2, 0xec, 0xec, 0x05, 0x02, 0xdd, 0x05, 0xdf, 0x01, 0x02, 0x01, 0x02, 0xec, 0xec, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xdf, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe4, 0xe3, 0xe6, 0xe1, 0x03, 0x01, 0x13, 0xc8, 0xd6, 0xc7, 0x87, 0x48, 0x43, 0x3c, 0x33, 0x30, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x33, 0x33, 0x30, 0x33, 0x3d, 0x5e, 0x60, 0x64, 0x60, 0x5c, 0x60, 0x60, 0x64, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x54, 0x5c, 0x67, 0x6d, 0x68, 0x5f, 0x5d, 0x4e, 0x4e, 0x8c, 0xd6, 0xce, 0x2c, 0x04, 0xdd, 0x00, 0xec, 0xe2, 0xe1, 0xe1, 0xe1, 0xdd, 0x01, 0x01, 0x03, 0xfb, 0xfb, 0xec, 0xec, 0xe1, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0x02, 0x02, 0xe1, 0xec, 0xe0, 0xe4, 0xe4, 0xe8, 0xdf, 0x01, 0x03, 0x2e, 0xda, 0xd3, 0xac, 0x66, 0x51, 0x42, 0x37, 0x33, 0x30, 0x33, 0x37, 0x33, 0x37, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x33, 0x33, 0x33, 0x30, 0x3d, 0x4c, 0x67, 0x67, 0x60, 0x60, 0x5a, 0x5c, 0x60, 0x64, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x6d, 0x5e, 0x5e, 0x53, 0x54, 0x53, 0x5c, 0x5e, 0x68, 0x5d, 0x69, 0x4e, 0x4e, 0xca, 0xd4, 0x50, 0x0a, 0x00, 0x00, 0xde, 0xe0, 0xe3, 0xe6, 0xdd, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe0, 0xe4, 0xe0, 0xe4, 0xe3, 0x03, 0x07, 0x58, 0xda, 0xca, 0x6c, 0x66, 0x51, 0x3d, 0x37, 0x33, 0x37, 0x37, 0x37, 0x30, 0x33, 0x33, 0x30, 0x30, 0x30, 0x33, 0x34, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x37, 0x4c, 0x57, 0x67, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x5c, 0x54, 0x5e, 0x5e, 0x60, 0x5c, 0x5a, 0x60, 0x64, 0x5c, 0x54, 0x5f, 0x5d, 0x4a, 0x59, 0xb9, 0xd6, 0x7c, 0x10, 0xdd, 0x00, 0xdf, 0xe0, 0xe6, 0xe3, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0xe1, 0xe0, 0xe4, 0xe0, 0xe4, 0x02, 0x01, 0x0c, 0x94, 0xda, 0x9d, 0x6c, 0x66, 0x44, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x30, 0x37, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x3d, 0x4c, 0x57, 0x6b, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x54, 0x57, 0x5c, 0x67, 0x64, 0x6a, 0x6a, 0x6a, 0x5a, 0x7a, 0x5c, 0x54, 0x86, 0x52, 0x45, 0x7e, 0xd4, 0x84, 0x1b, 0x03, 0xdd, 0xe7, 0xe0, 0xe4, 0xec, 0xfb, 0xfc, 0xfc, 0xfb, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0xe4, 0xe0, 0xe4, 0x02, 0x03, 0x11, 0xbd, 0xd8, 0x95, 0x55, 0x65, 0x45, 0x37, 0x37, 0x37, 0x37, 0x33, 0x37, 0x33, 0x33, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x37, 0x3d, 0x54, 0x6b, 0x60, 0x5c, 0x5c, 0x5a, 0x5c, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5e, 0x5c, 0x5c, 0x5c, 0x61, 0x61, 0x61, 0x5a, 0x61, 0x53, 0x5a, 0x5c, 0x5e, 0x57, 0x57, 0x65, 0x6c, 0xd7, 0xaa, 0x0e, 0x03, 0x02, 0xe3, 0xe0, 0xe1, 0xec, 0xfb, 0xfb, 0xfb, 0x01, 0x02, 0xdf, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0xde, 0xe6, 0xe3, 0xe7, 0x00, 0x01, 0x1b, 0xd6, 0xd3, 0x9c, 0x51, 0x52, 0x51, 0x37, 0x33, 0x33, 0x37, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x37, 0x33, 0x37, 0x37, 0x30, 0x33, 0x30, 0x33, 0x30, 0x30, 0x34, 0x30, 0x30, 0x33, 0x37, 0x4c, 0x5e, 0x6b, 0x60, 0x53, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x5c, 0x5c, 0x5a, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x5c, 0x5c, 0x5e, 0x5f, 0x57, 0x52, 0x7e, 0xd1, 0xc1, 0x13, 0x00, 0xe0, 0xe4, 0xe7, 0xe0, 0xe1, 0x00, 0xde, 0xdd, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xde, 0x00, 0xdf, 0xe0, 0x00, 0x08, 0x11, 0xce, 0xca, 0x9c, 0x77, 0x6b, 0x4c, 0x37, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x33, 0x3d, 0x44, 0x54, 0x57, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x60, 0x5c, 0x5c, 0x5e, 0x54, 0x5e, 0x5c, 0x62, 0x66, 0xca, 0xaa, 0x0f, 0x01, 0xe6, 0xe5, 0xe3, 0xe7, 0xe1, 0x00, 0x05, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0xdf, 0xdd, 0x06, 0x11, 0xd0, 0xd3, 0x9c, 0x57, 0x54, 0x67, 0x3d, 0x30, 0x30, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x37, 0x33, 0x37, 0x33, 0x33, 0x33, 0x30, 0x33, 0x33, 0x37, 0x45, 0x4c, 0x57, 0x5e, 0x60, 0x5c, 0x61, 0x64, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x5a, 0x60, 0x5a, 0x61, 0x61, 0x5a, 0x60, 0x5c, 0x5c, 0x5e, 0x5e, 0x5e, 0x5c, 0x6a, 0x53, 0x62, 0x85, 0xcf, 0x94, 0x0a, 0x00, 0xe6, 0xe4, 0xe4, 0xe7, 0xe1, 0xec, 0x00, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0xde, 0xdd, 0x06, 0x13, 0xc8, 0xd4, 0x7e, 0x5d, 0x54, 0x53, 0x4c, 0x33, 0x33, 0x34, 0x2b, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x37, 0x33, 0x33, 0x33, 0x30, 0x33, 0x37, 0x3d, 0x4c, 0x57, 0x5e, 0x5e, 0x67, 0x5c, 0x60, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x61, 0x60, 0x5a, 0x60, 0x60, 0x5c, 0x5c, 0x5c, 0x5e, 0x5e, 0x5c, 0x74, 0x5a, 0x89, 0x45, 0x87, 0xd6, 0x49, 0x07, 0x00, 0xea, 0xe3, 0xe0, 0xe8, 0x00, 0xdd, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe6, 0x05, 0xdd, 0x0e, 0xc8, 0xd3, 0x95, 0x65, 0x57, 0x7d, 0x54, 0x37, 0x33, 0x37, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x33, 0x33, 0x37, 0x3d, 0x44, 0x57, 0x5e, 0x5e, 0x5e, 0x5c, 0x5c, 0x60, 0x64, 0x60, 0x5a, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x5c, 0x5c, 0x5e, 0x5a, 0x61, 0x74, 0x53, 0x67, 0x59, 0x95, 0xd6, 0x3b, 0xdd, 0xde, 0xe8, 0xe3, 0xe3, 0x00, 0xde, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xdd, 0x07, 0xaa, 0xd6, 0x90, 0x59, 0x70, 0x57, 0x7b, 0x4c, 0x33, 0x37, 0x37, 0x2f, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x33, 0x3d, 0x45, 0x57, 0x57, 0x5e, 0x6d, 0x60, 0x60, 0x53, 0x53, 0x60, 0x64, 0x60, 0x53, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x74, 0x53, 0x73, 0x57, 0x52, 0xc6, 0xcf, 0x2a, 0xdd, 0xe2, 0xe0, 0x00, 0xe6, 0xde, 0x00, 0xfb, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe6, 0xdd, 0x84, 0xd6, 0x95, 0x65, 0x57, 0x54, 0x5f, 0x5f, 0x4b, 0x37, 0x33, 0x30, 0x33, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x33, 0x30, 0x33, 0x34, 0x37, 0x42, 0x45, 0x51, 0x57, 0x5f, 0x5e, 0x67, 0x60, 0x60, 0x5a, 0x5a, 0x5a, 0x61, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x61, 0x60, 0x5a, 0x61, 0x5a, 0x61, 0x60, 0x5e, 0x54, 0x81, 0x53, 0x53, 0x62, 0x65, 0xbc, 0xc8, 0x0c, 0xdd, 0xe6, 0xe6, 0xe6, 0xfb, 0xdd, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x01, 0xdd, 0x40, 0xda, 0xc7, 0x51, 0x62, 0x5e, 0x5c, 0x57, 0x52, 0x52, 0x42, 0x2b, 0x37, 0x3d, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x33, 0x33, 0x33, 0x37, 0x37, 0x45, 0x4b, 0x5d, 0x5f, 0x5f, 0x5f, 0x5e, 0x54, 0x64, 0x64, 0x5a, 0x60, 0x61, 0x64, 0x53, 0x5c, 0x5a, 0x67, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x5e, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x60, 0x5a, 0x60, 0x61, 0x60, 0x61, 0x61, 0x61, 0x60, 0x67, 0x54, 0x54, 0x73, 0x5a, 0x5a, 0x62, 0x72, 0xd3, 0x7c, 0x07, 0xdf, 0xe0, 0x00, 0xfb, 0xfb, 0xec, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xfb, 0xfb, 0xe1, 0xe0, 0xe4, 0xe1, 0xfb, 0xfb, 0x04, 0x00, 0xe0, 0xe0, 0xe0, 0xe3, 0x08, 0xdd, 0x28, 0xd7, 0xd1, 0x4e, 0x66, 0x62, 0x54, 0x54, 0x5c, 0x5e, 0x68, 0x4c, 0x3d, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x33, 0x33, 0x33, 0x37, 0x37, 0x3d, 0x44, 0x4c, 0x52, 0x52, 0x57, 0x5e, 0x5e, 0x5e, 0x5c, 0x5e, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x5c, 0x5e, 0x5e, 0x5e, 0x60, 0x61, 0x5e, 0x85, 0xd7, 0x24, 0xdd, 0xe0, 0xe6, 0xfb, 0x06, 0x01, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfc, 0x01, 0xec, 0xe4, 0xe0, 0xe1, 0xfb, 0xfc, 0x04, 0x00, 0xe7, 0xe4, 0xe4, 0xde, 0x00, 0x13, 0xbf, 0xd1, 0x95, 0x55, 0x52, 0x52, 0x54, 0x64, 0x5a, 0x61, 0x64, 0x5c, 0x4c, 0x44, 0x44, 0x42, 0x37, 0x33, 0x33, 0x37, 0x37, 0x37, 0x3d, 0x3d, 0x4c, 0x4c, 0x57, 0x57, 0x5e, 0x5e, 0x68, 0x5e, 0x5c, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x57, 0x5f, 0x57, 0x60, 0x61, 0x61, 0x76, 0xb3, 0xc4, 0x0b, 0xdf, 0xdf, 0x06, 0xfc, 0xec, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xfb, 0xfb, 0xe1, 0xe1, 0xe4, 0xec, 0xfb, 0xfb, 0xfb, 0xe1, 0xe7, 0xe3, 0xe3, 0xde, 0x06, 0x7c, 0xd7, 0x90, 0x55, 0x65, 0x62, 0x57, 0x53, 0x60, 0x61, 0x64, 0x6a, 0x67, 0x5e, 0x5e, 0x52, 0x5d, 0x4c, 0x52, 0x4c, 0x52, 0x52, 0x57, 0x5f, 0x5f, 0x5f, 0x5e, 0x68, 0x5e, 0x6b, 0x5e, 0x5c, 0x5c, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x5c, 0x61, 0x61, 0x64, 0x5e, 0x5f, 0x5e, 0x60, 0x61, 0x61, 0x52, 0x7e, 0xd5, 0x4d, 0x00, 0xfb, 0x06, 0xdd, 0x01, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfb, 0x01, 0xe1, 0xe1, 0xe1, 0xec, 0xfb, 0xfb, 0x00, 0xe6, 0xe0, 0xe0, 0xe6, 0xdd, 0x2e, 0xd8, 0xb3, 0x55, 0x59, 0x5d, 0x57, 0x7d, 0x5c, 0x5a, 0x61, 0x61, 0x61, 0x64, 0x67, 0x5e, 0x5e, 0x5f, 0x68, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x68, 0x67, 0x5e, 0x5c, 0x5c, 0x60, 0x5c, 0x5c, 0x5c, 0x53, 0x6d, 0x64, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6a, 0x64, 0x67, 0x68, 0x5e, 0x67, 0x64, 0x6a, 0x52, 0x66, 0x91, 0xd0, 0x10, 0xdd, 0xfb, 0xfc, 0xec, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xe1, 0xec, 0x02, 0xfb, 0x02, 0x00, 0xe6, 0xe0, 0xe3, 0x03, 0x0f, 0xc8, 0xd3, 0x7e, 0x70, 0x77, 0x57, 0x54, 0x73, 0x5a, 0x6a, 0x6a, 0x61, 0x61, 0x61, 0x64, 0x60, 0x5c, 0x54, 0x5e, 0x60, 0x5e, 0x5c, 0x5c, 0x5c, 0x5c, 0x54, 0x5c, 0x60, 0x60, 0x60, 0x64, 0x60, 0x64, 0x60, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x67, 0x64, 0x64, 0x6a, 0x64, 0x5e, 0x67, 0x5e, 0x67, 0x60, 0x67, 0x7b, 0x51, 0x55, 0xd2, 0x84, 0x04, 0x00, 0xfd, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xec, 0x01, 0xfb, 0x01, 0x02, 0xe1, 0xe0, 0xe0, 0x00, 0x07, 0x7c, 0xd6, 0x95, 0x5d, 0x6b, 0x6b, 0x54, 0x73, 0x73, 0x53, 0x64, 0x6a, 0x61, 0x61, 0x5a, 0x64, 0x61, 0x64, 0x60, 0x6a, 0x6d, 0x64, 0x6d, 0x67, 0x67, 0x6a, 0x6d, 0x64, 0x64, 0x6a, 0x60, 0x6a, 0x64, 0x6a, 0x64, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x60, 0x61, 0x5c, 0x5c, 0x5e, 0x5c, 0x5e, 0x5c, 0x5e, 0x4c, 0x85, 0x9d, 0xd7, 0x1b, 0x00, 0x05, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x01, 0xfb, 0x02, 0x02, 0xe0, 0xe0, 0xdf, 0x03, 0x28, 0xd8, 0xbc, 0x59, 0x57, 0x53, 0x54, 0x73, 0x81, 0x5c, 0x5a, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6a, 0x64, 0x60, 0x5a, 0x60, 0x61, 0x64, 0x61, 0x60, 0x61, 0x64, 0x6a, 0x60, 0x6a, 0x60, 0x64, 0x64, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x64, 0x60, 0x64, 0x60, 0x60, 0x5e, 0x5e, 0x67, 0x54, 0x5e, 0x77, 0x66, 0xbf, 0x7c, 0x03, 0x00, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe0, 0x02, 0x01, 0xfb, 0xfb, 0x02, 0xe1, 0xe3, 0xdf, 0xdd, 0x09, 0xaa, 0xd4, 0x7e, 0x77, 0x7d, 0x73, 0x53, 0x73, 0x5a, 0x54, 0x81, 0x6d, 0x67, 0x6d, 0x73, 0x64, 0x64, 0x64, 0x64, 0x6a, 0x6a, 0x6a, 0x6a, 0x73, 0x6a, 0x73, 0x6a, 0x67, 0x6a, 0x67, 0x6a, 0x60, 0x64, 0x67, 0x64, 0x6d, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6d, 0x64, 0x6a, 0x6d, 0x6d, 0x6d, 0x68, 0x6b, 0x73, 0x6d, 0x60, 0x52, 0xbc, 0xce, 0x10, 0x00, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe0, 0xe1, 0x02, 0xfb, 0xfb, 0x01, 0x02, 0xe1, 0xdf, 0xe2, 0xdd, 0x40, 0xd7, 0xa7, 0x59, 0x6b, 0x67, 0x64, 0x64, 0x67, 0x67, 0x5c, 0x67, 0x67, 0x5e, 0x67, 0x5e, 0x67, 0x67, 0x67, 0x64, 0x64, 0x6d, 0x6a, 0x6d, 0x64, 0x6d, 0x64, 0x6d, 0x67, 0x67, 0x64, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x64, 0x6d, 0x64, 0x6a, 0x60, 0x6b, 0x5e, 0x68, 0x64, 0x6a, 0x74, 0x6d, 0x66, 0xd6, 0x63, 0xdd, 0x00, 0xde, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe0, 0x02, 0x01, 0xfb, 0x01, 0xe1, 0xdf, 0xe3, 0x03, 0x0f, 0xae, 0xd3, 0x65, 0x82, 0x6d, 0x6a, 0x67, 0x64, 0x67, 0x67, 0x67, 0x68, 0x5e, 0x68, 0x5e, 0x68, 0x67, 0x5e, 0x67, 0x67, 0x67, 0x64, 0x6d, 0x64, 0x6d, 0x64, 0x6d, 0x67, 0x6d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x64, 0x6a, 0x67, 0x67, 0x67, 0x5f, 0x68, 0x64, 0x6a, 0x74, 0x74, 0x59, 0xc6, 0xb5, 0x0d, 0x00, 0xfd, 0x02, 0x00, 0x02, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe3, 0xe1, 0x01, 0xfb, 0x01, 0xec, 0xdf, 0xe1, 0xdf, 0x03, 0x3b, 0xd6, 0x95, 0x4c, 0x82, 0x60, 0x67, 0x67, 0x67, 0x67, 0x5e, 0x68, 0x5e, 0x6b, 0x68, 0x67, 0x68, 0x5e, 0x68, 0x67, 0x5e, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x67, 0x6b, 0x5e, 0x6b, 0x5e, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x64, 0x6a, 0x67, 0x5e, 0x68, 0x5e, 0x64, 0x74, 0x61, 0x89, 0x4c, 0x87, 0xd8, 0x2a, 0xdd, 0x02, 0x05, 0x02, 0x05, 0x02, 0xec, 0xdd, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0x02, 0x01, 0x02, 0xe1, 0xe0, 0xdf, 0x04, 0x09, 0xc5, 0xca, 0x59, 0x6b, 0x54, 0x73, 0x67, 0x67, 0x68, 0x67, 0x6b, 0x67, 0x68, 0x6b, 0x5e, 0x6b, 0x68, 0x67, 0x68, 0x67, 0x68, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6a, 0x6d, 0x67, 0x6b, 0x68, 0x68, 0x64, 0x74, 0x61, 0x74, 0x62, 0x55, 0xd6, 0x84, 0x07, 0x00, 0x05, 0x02, 0x02, 0x02, 0x02, 0xdd, 0xec, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x01, 0x02, 0xe1, 0xe1, 0xe4, 0xdf, 0x03, 0x2e, 0xd6, 0x90, 0x62, 0x7d, 0x5e, 0x78, 0x67, 0x68, 0x67, 0x68, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x68, 0x67, 0x68, 0x67, 0x68, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x67, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6d, 0x67, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6d, 0x64, 0x6d, 0x64, 0x6d, 0x67, 0x6b, 0x5e, 0x73, 0x6a, 0x6a, 0x64, 0x82, 0x51, 0xac, 0xd7, 0x0f, 0x00, 0x05, 0x02, 0x05, 0xdd, 0xe6, 0xdd, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe4, 0xe0, 0xdf, 0x07, 0xc1, 0xca, 0x77, 0x82, 0x53, 0x71, 0x67, 0x68, 0x68, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6b, 0x68, 0x67, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6d, 0x6d, 0x6d, 0x6b, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6b, 0x6d, 0x6d, 0x6a, 0x6a, 0x60, 0x88, 0x59, 0x66, 0xd7, 0x32, 0xdd, 0x01, 0xdd, 0x05, 0xdd, 0x05, 0xdd, 0xec, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0xe0, 0xe4, 0xe4, 0xdf, 0x24, 0xd7, 0x95, 0x62, 0x7d, 0x53, 0x78, 0x57, 0x68, 0x67, 0x68, 0x6d, 0x67, 0x73, 0x67, 0x74, 0x6d, 0x74, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6d, 0x67, 0x6d, 0x6d, 0x6d, 0x64, 0x73, 0x6d, 0x73, 0x6d, 0x6d, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x6d, 0x64, 0x6d, 0x67, 0x6d, 0x6d, 0x6b, 0x6d, 0x68, 0x64, 0x78, 0x64, 0x5e, 0x7b, 0x5d, 0x59, 0xd3, 0x75, 0xde, 0x01, 0x00, 0xfd, 0x00, 0xe6, 0xdd, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xfb, 0x01, 0xec, 0xe0, 0xe0, 0xe0, 0x03, 0x99, 0xcf, 0x7e, 0x62, 0x61, 0x92, 0x5e, 0x68, 0x68, 0x68, 0x6d, 0x67, 0x6d, 0x6d, 0x73, 0x67, 0x73, 0x67, 0x73, 0x67, 0x6d, 0x6b, 0x68, 0x6b, 0x68, 0x67, 0x6b, 0x67, 0x6d, 0x67, 0x6a, 0x6d, 0x74, 0x6d, 0x6a, 0x73, 0x6a, 0x74, 0x64, 0x74, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x68, 0x6d, 0x6b, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6b, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x67, 0x6d, 0x64, 0x6d, 0x57, 0x68, 0x69, 0xbc, 0xcc, 0x0b, 0x01, 0x00, 0xde, 0x00, 0xfb, 0x02, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfb, 0x00, 0x05, 0xe1, 0xe6, 0x00, 0x00, 0x13, 0xda, 0x95, 0x5d, 0x73, 0x60, 0x6a, 0x7d, 0x5e, 0x6d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x6d, 0x68, 0x6b, 0x68, 0x6b, 0x68, 0x68, 0x5f, 0x68, 0x68, 0x6d, 0x6d, 0x74, 0x6a, 0x74, 0x61, 0x74, 0x73, 0x74, 0x6a, 0x61, 0x6a, 0x6a, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5e, 0x68, 0x67, 0x71, 0x6d, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x67, 0x6d, 0x6a, 0x74, 0x74, 0x74, 0x6d, 0x6d, 0x68, 0x68, 0x67, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x71, 0x67, 0x5e, 0x71, 0x8f, 0xd2, 0x2e, 0xdd, 0xe6, 0xe3, 0xe3, 0x05, 0x00, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0xec, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfb, 0x00, 0xec, 0xe6, 0x00, 0x05, 0x03, 0x32, 0xd4, 0x87, 0x5d, 0x73, 0x64, 0x64, 0x7d, 0x5e, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6b, 0x6b, 0x68, 0x6b, 0x6b, 0x68, 0x6b, 0x68, 0x6d, 0x68, 0x70, 0x68, 0x68, 0x5c, 0x64, 0x64, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x6d, 0x73, 0x74, 0x7a, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6b, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6d, 0x78, 0x6d, 0x73, 0x5e, 0x67, 0x68, 0x67, 0x68, 0x71, 0x6d, 0x6d, 0x74, 0x6a, 0x74, 0x6a, 0x73, 0x67, 0x6b, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6d, 0x6d, 0x6d, 0x5e, 0x71, 0x7f, 0xd3, 0x46, 0xdd, 0xe6, 0xe4, 0xe4, 0xfb, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x03, 0xfb, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfb, 0x01, 0xec, 0xe6, 0x00, 0x06, 0x07, 0xaa, 0xbf, 0x7e, 0x5f, 0x73, 0x73, 0x64, 0x7d, 0x6b, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x6d, 0x67, 0x6d, 0x6d, 0x6d, 0x6d, 0x67, 0x6d, 0x78, 0x70, 0x78, 0x6d, 0x73, 0x73, 0x73, 0x7d, 0x71, 0x6b, 0x70, 0x69, 0x68, 0x5f, 0x70, 0x71, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x6d, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x78, 0x6d, 0x78, 0x78, 0x73, 0x73, 0x74, 0x73, 0x6d, 0x71, 0x6b, 0x71, 0x73, 0x7a, 0x74, 0x7a, 0x7a, 0x6d, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6a, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x67, 0x6d, 0x71, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x71, 0x76, 0xd1, 0x94, 0x09, 0xe3, 0xe6, 0xe0, 0xec, 0xfb, 0x02, 0x02, 0xdf, 0x01, 0x01, 0x01, 0xec, 0xec, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0xfd, 0xe3, 0x05, 0x00, 0x03, 0x13, 0xd7, 0x9d, 0x65, 0x68, 0x7a, 0x73, 0x67, 0x71, 0x6b, 0x6b, 0x6b, 0x6b, 0x71, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x73, 0x6d, 0x6a, 0x73, 0x6a, 0x74, 0x73, 0x5c, 0x5e, 0x64, 0x73, 0x64, 0x6d, 0x67, 0x5e, 0x68, 0x69, 0x69, 0x69, 0x5f, 0x69, 0x5f, 0x68, 0x6d, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x6a, 0x73, 0x73, 0x74, 0x73, 0x7a, 0x73, 0x74, 0x67, 0x6b, 0x68, 0x67, 0x64, 0x6a, 0x6a, 0x64, 0x64, 0x6b, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x74, 0x6a, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x78, 0x6d, 0x6d, 0x71, 0x73, 0x78, 0x6d, 0x69, 0xbc, 0xd2, 0x0f, 0x00, 0xe0, 0xe6, 0xdd, 0xfb, 0xec, 0xe1, 0x02, 0x02, 0x01, 0x01, 0xec, 0xe1, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0xde, 0x00, 0x02, 0xfd, 0x01, 0x2e, 0xd6, 0x6c, 0x65, 0x6b, 0x7a, 0x73, 0x6d, 0x71, 0x70, 0x6b, 0x68, 0x71, 0x68, 0x6d, 0x6d, 0x73, 0x6d, 0x73, 0x6a, 0x73, 0x74, 0x74, 0x74, 0x74, 0x6a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x73, 0x6d, 0x6b, 0x68, 0x70, 0x70, 0x70, 0x70, 0x78, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6d, 0x6d, 0x73, 0x6a, 0x74, 0x6a, 0x74, 0x74, 0x73, 0x74, 0x73, 0x74, 0x6d, 0x73, 0x7b, 0x70, 0x71, 0x73, 0x64, 0x73, 0x73, 0x78, 0x68, 0x69, 0x69, 0x68, 0x68, 0x73, 0x6a, 0x74, 0x6a, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x7d, 0x6d, 0x6d, 0x6d, 0x71, 0x7d, 0x73, 0x5d, 0xa7, 0xda, 0x1e, 0x00, 0xe6, 0xe1, 0xdd, 0xfb, 0x02, 0xe1, 0xdf, 0x02, 0x01, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0xe2, 0x00, 0xe1, 0x06, 0x04, 0x94, 0xca, 0x66, 0x69, 0x73, 0x73, 0x73, 0x71, 0x6b, 0x71, 0x68, 0x6b, 0x68, 0x6b, 0x6d, 0x6b, 0x6d, 0x6d, 0x74, 0x73, 0x74, 0x73, 0x74, 0x74, 0x74, 0x73, 0x7a, 0x7d, 0x6d, 0x6d, 0x67, 0x6b, 0x6b, 0x5f, 0x68, 0x5d, 0x68, 0x70, 0x73, 0x7a, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6b, 0x6d, 0x6d, 0x6a, 0x73, 0x6a, 0x74, 0x74, 0x74, 0x6a, 0x73, 0x6d, 0x71, 0x7d, 0x77, 0x62, 0x68, 0x69, 0x68, 0x70, 0x68, 0x70, 0x69, 0x69, 0x69, 0x69, 0x70, 0x78, 0x6a, 0x7a, 0x74, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x6d, 0x71, 0x7d, 0x71, 0x5f, 0x87, 0xd6, 0x38, 0x00, 0x02, 0xe3, 0xfb, 0xfb, 0xec, 0xe1, 0xe1, 0xdf, 0x01, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe3, 0xe6, 0x00, 0x05, 0xdd, 0x0e, 0xc5, 0xac, 0x5d, 0x71, 0x7d, 0x6d, 0x7d, 0x71, 0x6b, 0x71, 0x70, 0x71, 0x6b, 0x71, 0x6b, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x71, 0x52, 0x5d, 0x69, 0x77, 0x72, 0x76, 0x72, 0x69, 0x72, 0x76, 0x5d, 0x6b, 0x6d, 0x74, 0x74, 0x74, 0x74, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x71, 0x6b, 0x71, 0x6d, 0x73, 0x74, 0x74, 0x74, 0x74, 0x73, 0x6d, 0x6b, 0x62, 0x77, 0x77, 0x7f, 0x5d, 0x69, 0x72, 0x72, 0x66, 0x6c, 0x55, 0x55, 0x69, 0x69, 0x70, 0x68, 0x71, 0x6d, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x73, 0x71, 0x67, 0x6d, 0x73, 0x7d, 0x68, 0x87, 0xd3, 0x75, 0x03, 0x05, 0x00, 0xfb, 0xfb, 0xe1, 0xe1, 0xdf, 0xe1, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x05, 0xe3, 0xe3, 0xfd, 0xdd, 0x1b, 0xd4, 0x90, 0x62, 0x81, 0x7a, 0x6d, 0x78, 0x78, 0x6b, 0x71, 0x71, 0x71, 0x78, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x6d, 0x71, 0x71, 0x6b, 0x6b, 0x70, 0x69, 0x7e, 0x90, 0xb3, 0xc6, 0xcd, 0xcd, 0xc3, 0xbc, 0x90, 0x87, 0x72, 0x69, 0x6b, 0x73, 0x74, 0x74, 0x73, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x71, 0x73, 0x70, 0x71, 0x71, 0x71, 0x73, 0x73, 0x74, 0x73, 0x73, 0x73, 0x62, 0x62, 0x66, 0x66, 0x7e, 0x7e, 0xbb, 0xc0, 0xc3, 0xc6, 0xc6, 0xb6, 0x9d, 0x95, 0x66, 0x69, 0x70, 0x71, 0x6d, 0x71, 0x71, 0x71, 0x71, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x71, 0x73, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x67, 0x78, 0x73, 0x6d, 0x67, 0x78, 0x7d, 0x70, 0x85, 0xd3, 0xb5, 0x06, 0x05, 0x00, 0x05, 0xfb, 0xec, 0xe1, 0xe0, 0xe1, 0x02, 0x02, 0xe1, 0xe0, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe3, 0xe1, 0xe3, 0x01, 0xfb, 0x3b, 0xd3, 0x72, 0x6b, 0x73, 0x73, 0x6d, 0x71, 0x68, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6b, 0x71, 0x5f, 0x70, 0x76, 0x76, 0x65, 0x69, 0x90, 0xca, 0xcf, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xd4, 0xd6, 0xd1, 0xbf, 0xa6, 0x85, 0x76, 0x77, 0x71, 0x6d, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x71, 0x6b, 0x70, 0x71, 0x71, 0x6d, 0x73, 0x6d, 0x73, 0x6b, 0x5f, 0x72, 0x85, 0x95, 0xbc, 0xd1, 0xd3, 0xd1, 0xd1, 0xd3, 0xd4, 0xd6, 0xd4, 0xd1, 0xca, 0xb3, 0x85, 0x5d, 0x6b, 0x70, 0x6d, 0x5f, 0x71, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6b, 0x72, 0xca, 0xc8, 0x0d, 0x00, 0x02, 0xfb, 0x01, 0xec, 0xe3, 0xe1, 0xdf, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe3, 0x02, 0x04, 0x46, 0xd1, 0x77, 0x71, 0x74, 0x6d, 0x78, 0x68, 0x78, 0x6d, 0x73, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x71, 0x71, 0x6b, 0x70, 0x70, 0x69, 0x65, 0x59, 0x72, 0xb3, 0xcd, 0xd3, 0xd4, 0xd4, 0xd6, 0xd6, 0xd4, 0xd2, 0xce, 0xce, 0xd2, 0xd4, 0xd6, 0xd1, 0xc3, 0x85, 0x5d, 0x6b, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x6d, 0x71, 0x68, 0x71, 0x71, 0x6d, 0x71, 0x6d, 0x6b, 0x68, 0x76, 0xb4, 0xcd, 0xd1, 0xd3, 0xd4, 0xd4, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xd3, 0xd1, 0xc9, 0x9c, 0x76, 0x62, 0x70, 0x71, 0x6b, 0x71, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x73, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6d, 0x71, 0x6b, 0x65, 0xc6, 0xd0, 0x11, 0xdd, 0x02, 0xfb, 0xfb, 0xe1, 0xe1, 0xe0, 0xe1, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe6, 0x01, 0x07, 0x94, 0xc6, 0x77, 0x73, 0x74, 0x78, 0x68, 0x70, 0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x71, 0x73, 0x71, 0x71, 0x70, 0x70, 0x76, 0x72, 0x59, 0x6c, 0xb9, 0xd1, 0xd3, 0xd1, 0xd1, 0xcd, 0xc6, 0xc6, 0xd1, 0xd3, 0xd6, 0xd6, 0xd6, 0xd4, 0xd4, 0xd1, 0xca, 0xa6, 0x85, 0x70, 0x71, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x71, 0x71, 0x71, 0x71, 0x78, 0x71, 0x71, 0x71, 0x70, 0x5d, 0x7f, 0xc3, 0xd1, 0xd3, 0xd3, 0xd4, 0xd4, 0xd6, 0xd4, 0xd3, 0xc6, 0xca, 0xc6, 0xd1, 0xd1, 0xd1, 0xd3, 0xcd, 0x9c, 0x65, 0x62, 0x82, 0x6d, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x71, 0x73, 0x71, 0x71, 0x73, 0x71, 0x73, 0x71, 0x73, 0x71, 0x73, 0x71, 0x73, 0x71, 0x73, 0x71, 0x73, 0x70, 0x5d, 0xc6, 0xd5, 0x1e, 0xdd, 0x05, 0xfb, 0xdd, 0xec, 0xe0, 0xe1, 0xdf, 0x01, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0xe1, 0x02, 0x07, 0xc8, 0xb3, 0x77, 0x73, 0x74, 0x78, 0x70, 0x70, 0x70, 0x73, 0x74, 0x7a, 0x73, 0x73, 0x73, 0x73, 0x71, 0x78, 0x70, 0x68, 0x7f, 0x69, 0x7e, 0xb4, 0xd1, 0xd1, 0xc3, 0x9c, 0x8f, 0x7e, 0x66, 0x7e, 0x90, 0xac, 0xbc, 0xca, 0xca, 0xd3, 0xd3, 0xd3, 0xcd, 0x95, 0x72, 0x70, 0x7a, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x78, 0x71, 0x78, 0x71, 0x78, 0x71, 0x78, 0x70, 0x76, 0x8f, 0xc0, 0xd1, 0xd1, 0xd3, 0xd3, 0xd3, 0xbf, 0xb6, 0x95, 0x87, 0x7e, 0x7e, 0x90, 0x90, 0xb3, 0xcd, 0xd3, 0xc9, 0x9c, 0x77, 0x6b, 0x71, 0x7d, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7d, 0x73, 0x78, 0x73, 0x78, 0x73, 0x78, 0x73, 0x78, 0x73, 0x78, 0x73, 0x78, 0x73, 0x78, 0x73, 0x70, 0x5d, 0xbc, 0xd7, 0x2a, 0xdd, 0xfb, 0x01, 0xfb, 0xe1, 0xe1, 0xe0, 0xe1, 0x01, 0x01, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0xe1, 0x01, 0x0a, 0xd8, 0x95, 0x62, 0x74, 0x7a, 0x78, 0x70, 0x76, 0x70, 0x7a, 0x74, 0x7a, 0x78, 0x73, 0x7d, 0x73, 0x7d, 0x71, 0x71, 0x70, 0x69, 0x7f, 0xb4, 0xcd, 0xcd, 0xb3, 0x72, 0x5d, 0x67, 0x67, 0x6b, 0x6b, 0x62, 0x5d, 0x65, 0x90, 0x9c, 0xbc, 0xc9, 0xc9, 0xb4, 0x85, 0x52, 0x71, 0x71, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x78, 0x73, 0x78, 0x73, 0x78, 0x73, 0x78, 0x71, 0x7b, 0x5f, 0x76, 0x98, 0xc9, 0xc3, 0xc3, 0xac, 0x95, 0x6c, 0x6c, 0x66, 0x59, 0x59, 0x5d, 0x69, 0x66, 0x72, 0x90, 0xc3, 0xcd, 0xc9, 0x98, 0x69, 0x6b, 0x71, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x73, 0x71, 0x7d, 0x71, 0x7d, 0x71, 0x7d, 0x71, 0x7d, 0x71, 0x7d, 0x71, 0x7d, 0x71, 0x73, 0x78, 0x71, 0x5d, 0xb3, 0xd8, 0x32, 0xdd, 0x01, 0xfb, 0xec, 0xec, 0xe4, 0xe1, 0xe1, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xdd, 0xe1, 0xdd, 0x0c, 0xd8, 0x87, 0x77, 0x73, 0x7a, 0x78, 0x76, 0x69, 0x7b, 0x74, 0x74, 0x7a, 0x78, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x7d, 0x86, 0x68, 0x8d, 0xc9, 0xc9, 0x90, 0x55, 0x72, 0x7d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x77, 0x70, 0x65, 0x76, 0x65, 0x69, 0x69, 0x70, 0x7b, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x7a, 0x7d, 0x73, 0x73, 0x7d, 0x7a, 0x78, 0x7d, 0x78, 0x70, 0x57, 0x69, 0x76, 0x72, 0x72, 0x66, 0x59, 0x72, 0x70, 0x77, 0x7b, 0x82, 0x82, 0x82, 0x82, 0x76, 0x59, 0x72, 0xc0, 0xcd, 0xc0, 0x7f, 0x69, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x7a, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x7d, 0x7d, 0x78, 0x69, 0xa6, 0xd7, 0x40, 0x00, 0x01, 0xdd, 0xfc, 0xe1, 0xe0, 0xe1, 0xe1, 0x03, 0xfb, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x01, 0xfb, 0xfb, 0xdf, 0x00, 0x0f, 0xd0, 0x87, 0x6b, 0x7a, 0x7a, 0x7b, 0x76, 0x76, 0x78, 0x89, 0x74, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x8e, 0xb7, 0xc2, 0xa0, 0x65, 0x59, 0x7f, 0x7b, 0x78, 0x6d, 0x67, 0x6a, 0x73, 0x81, 0x88, 0x68, 0x70, 0x76, 0x7b, 0x7b, 0x7d, 0x81, 0x81, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x7a, 0x9b, 0x7d, 0x6b, 0x71, 0x62, 0x6b, 0x77, 0x82, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x73, 0x71, 0x71, 0x83, 0x71, 0x5f, 0x86, 0xb2, 0xc9, 0xa6, 0x65, 0x7b, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7b, 0x70, 0x95, 0xd0, 0x4d, 0xdd, 0x01, 0xfb, 0xec, 0xec, 0xe3, 0xe1, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfb, 0x05, 0x00, 0xdd, 0x11, 0xce, 0x87, 0x77, 0x7a, 0x7a, 0x7b, 0x76, 0x76, 0x7b, 0x74, 0x74, 0x81, 0x70, 0x78, 0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x5c, 0xb1, 0xc2, 0x93, 0x62, 0x77, 0x8d, 0x70, 0x7b, 0x78, 0x83, 0x7a, 0x81, 0x7a, 0x7a, 0x73, 0x7d, 0x78, 0x70, 0x71, 0x71, 0x78, 0x7a, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x81, 0x7a, 0x7a, 0x81, 0x7a, 0x7d, 0x7a, 0x7d, 0x73, 0x67, 0x81, 0x92, 0x81, 0x7d, 0x7d, 0x73, 0x74, 0x89, 0x74, 0x81, 0x7a, 0x81, 0x81, 0x89, 0x6a, 0x92, 0x81, 0x57, 0x69, 0xc0, 0xc0, 0x7e, 0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x77, 0x90, 0xd7, 0x4d, 0xdd, 0xfb, 0x01, 0xfb, 0xe1, 0xe0, 0xe1, 0xe1, 0x03, 0xfb, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xe1, 0xe3, 0x05, 0x01, 0x0e, 0xd6, 0x87, 0x82, 0x81, 0x7a, 0x78, 0x78, 0x7b, 0x78, 0x81, 0x81, 0x7b, 0x7b, 0x7b, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0xa4, 0xa4, 0x93, 0x82, 0x71, 0x81, 0x81, 0x7d, 0x71, 0x78, 0x81, 0x74, 0x89, 0x74, 0x7a, 0x81, 0x78, 0x7b, 0x7b, 0x76, 0x7b, 0x7d, 0x78, 0x73, 0x7d, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x73, 0x7d, 0x73, 0x78, 0x7d, 0x71, 0x7d, 0x71, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x73, 0x71, 0x73, 0x73, 0x7a, 0x7a, 0x7a, 0x81, 0x81, 0x71, 0x77, 0x86, 0xa0, 0xb8, 0x7b, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x81, 0x7a, 0x81, 0x7a, 0x7d, 0x73, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x82, 0x87, 0xd2, 0x4d, 0xdd, 0x05, 0xfb, 0xec, 0xe4, 0xe0, 0xe4, 0xe1, 0x01, 0x03, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe3, 0xec, 0x01, 0x0e, 0xd2, 0xa7, 0x77, 0x73, 0x7a, 0x7a, 0x7b, 0x78, 0x7b, 0x7d, 0x7d, 0x78, 0x76, 0x78, 0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x93, 0x93, 0x8e, 0x78, 0x71, 0x7d, 0x81, 0x7a, 0x83, 0x7d, 0x7d, 0x7a, 0x74, 0x7a, 0x74, 0x7a, 0x78, 0x78, 0x70, 0x7b, 0x7b, 0x78, 0x7d, 0x7d, 0x73, 0x78, 0x7d, 0x78, 0x7d, 0x78, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x71, 0x7d, 0x71, 0x88, 0x81, 0x81, 0x7d, 0x7a, 0x7a, 0x81, 0x7a, 0x71, 0x70, 0x7d, 0x7d, 0x7d, 0x81, 0x7a, 0x81, 0x7a, 0x81, 0x7d, 0x7d, 0x7b, 0x82, 0x8d, 0x9f, 0x82, 0x78, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7a, 0x81, 0x73, 0x7d, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x77, 0x90, 0xd2, 0x4d, 0xdd, 0x05, 0xfb, 0xec, 0xe1, 0xe4, 0xe0, 0xe1, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe3, 0xe0, 0xec, 0xdd, 0x0e, 0xd2, 0xb3, 0x5d, 0x81, 0x7a, 0x7a, 0x78, 0x7b, 0x78, 0x7d, 0x7d, 0x78, 0x7b, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x86, 0x86, 0x82, 0x70, 0x71, 0x7d, 0x7d, 0x71, 0x78, 0x70, 0x78, 0x7d, 0x7a, 0x81, 0x7a, 0x81, 0x81, 0x7a, 0x7d, 0x73, 0x73, 0x7a, 0x74, 0x7a, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x73, 0x7a, 0x73, 0x7d, 0x78, 0x7d, 0x78, 0x71, 0x83, 0x7b, 0x7d, 0x71, 0x71, 0x71, 0x7d, 0x7d, 0x71, 0x71, 0x78, 0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x78, 0x7d, 0x83, 0x82, 0x71, 0x77, 0x82, 0x82, 0x78, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x73, 0x81, 0x7a, 0x81, 0x7a, 0x7d, 0x73, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x6b, 0x90, 0xd7, 0x4d, 0xdd, 0x05, 0xfb, 0xfb, 0xe4, 0xe4, 0xe4, 0xdf, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xec, 0x00, 0x0c, 0xbd, 0xc6, 0x5d, 0x7d, 0x81, 0x7a, 0x7b, 0x78, 0x7b, 0x7d, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7b, 0x7b, 0x70, 0x7b, 0x76, 0x7b, 0x70, 0x7b, 0x78, 0x78, 0x7b, 0x70, 0x78, 0x70, 0x78, 0x78, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7b, 0x71, 0x78, 0x70, 0x78, 0x71, 0x78, 0x7b, 0x7d, 0x81, 0x7a, 0x81, 0x7d, 0x7d, 0x78, 0x70, 0x70, 0x70, 0x7b, 0x7b, 0x7b, 0x7d, 0x71, 0x71, 0x7d, 0x7d, 0x82, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x81, 0x7a, 0x81, 0x7a, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x7d, 0x62, 0x9c, 0xd7, 0x4d, 0xdd, 0x04, 0xfb, 0xec, 0xec, 0xe0, 0xe0, 0xe1, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xe3, 0xe1, 0xec, 0xdd, 0x09, 0xae, 0xd1, 0x66, 0x7d, 0x81, 0x7d, 0x78, 0x7b, 0x7b, 0x81, 0x7a, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7b, 0x7b, 0x7b, 0x70, 0x76, 0x70, 0x76, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x83, 0x76, 0x76, 0x69, 0x69, 0x69, 0x69, 0x70, 0x7b, 0x78, 0x81, 0x7d, 0x81, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x83, 0x7b, 0x83, 0x7b, 0x86, 0x7b, 0x7b, 0x7b, 0x89, 0x89, 0x7a, 0x7d, 0x78, 0x70, 0x7b, 0x7b, 0x7b, 0x76, 0x7b, 0x7b, 0x71, 0x7d, 0x73, 0x81, 0x7d, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7a, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x82, 0x62, 0xa7, 0xd7, 0x40, 0xdd, 0x04, 0xfb, 0xfb, 0xe1, 0xe4, 0xe0, 0xdf, 0x01, 0x01, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xec, 0xe1, 0xe1, 0xdd, 0x07, 0x7c, 0xcf, 0x72, 0x77, 0x81, 0x78, 0x83, 0x7b, 0x81, 0x7d, 0x81, 0x81, 0x7a, 0x81, 0x81, 0x83, 0x7b, 0x7b, 0x7b, 0x76, 0x70, 0x70, 0x7b, 0x7b, 0x7b, 0x7b, 0x83, 0x78, 0x78, 0x7b, 0x7f, 0x7f, 0x85, 0x7f, 0x8b, 0x69, 0x7b, 0x7b, 0x78, 0x7b, 0x7b, 0x7b, 0x7b, 0x83, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x78, 0x7d, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x70, 0x81, 0x7a, 0x81, 0x71, 0x78, 0x70, 0x70, 0x76, 0x76, 0x7b, 0x7b, 0x78, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x81, 0x7d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x77, 0xa7, 0xd7, 0x38, 0xdd, 0xfb, 0xfc, 0xfb, 0xe1, 0xe0, 0xe1, 0xe1, 0x01, 0x01, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x01, 0xfb, 0x49, 0xd4, 0x6c, 0x82, 0x7b, 0x83, 0x78, 0x83, 0x7b, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7b, 0x7b, 0x7b, 0x7b, 0x83, 0x7b, 0x7b, 0x83, 0x7b, 0x78, 0x7b, 0x83, 0x81, 0x89, 0x93, 0x9e, 0xa5, 0xb4, 0xb4, 0xb4, 0xa0, 0x97, 0x8a, 0x83, 0x7b, 0x7b, 0x76, 0x86, 0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x78, 0x78, 0x78, 0x7b, 0x7b, 0x8b, 0x8a, 0x93, 0x93, 0x93, 0x8e, 0x8a, 0x86, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7d, 0x81, 0x81, 0x7a, 0x81, 0x81, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x81, 0x81, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x81, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x81, 0x7d, 0x82, 0x77, 0xb3, 0xd6, 0x2a, 0xdd, 0xfb, 0xfc, 0xfb, 0xec, 0xe1, 0xe0, 0xdf, 0x01, 0x01, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0x02, 0xdd, 0x3b, 0xd4, 0x87, 0x7f, 0x7b, 0x83, 0x7b, 0x7b, 0x83, 0x7d, 0x81, 0x7a, 0x81, 0x81, 0x83, 0x7b, 0x7b, 0x7b, 0x7b, 0x88, 0x78, 0x78, 0x7d, 0x83, 0x71, 0x7b, 0x83, 0xb1, 0xb1, 0xb7, 0xc2, 0xc0, 0xc3, 0xb9, 0xc0, 0xc0, 0xbb, 0xa2, 0x8a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x7b, 0x82, 0x78, 0x83, 0x7d, 0x7a, 0x81, 0x7a, 0x81, 0x81, 0x78, 0x7b, 0x86, 0x97, 0xab, 0xb8, 0xbb, 0xbb, 0xc2, 0xbb, 0xb7, 0x9e, 0x8a, 0x83, 0x7b, 0x7d, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x71, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x81, 0x83, 0x81, 0x83, 0x7d, 0x83, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x83, 0x81, 0x83, 0x81, 0x83, 0x81, 0x83, 0x82, 0x77, 0xb3, 0xd0, 0x2a, 0xdd, 0xfb, 0x04, 0xfb, 0xec, 0xe1, 0xe1, 0xe1, 0x01, 0x01, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0x05, 0x02, 0xe3, 0xe1, 0x01, 0x1e, 0xd7, 0x9d, 0x65, 0x86, 0x86, 0x78, 0x83, 0x83, 0x7d, 0x73, 0x81, 0x81, 0x7d, 0x7b, 0x7b, 0x7b, 0x7b, 0x78, 0x81, 0x81, 0x6a, 0x81, 0x92, 0x83, 0x82, 0xc2, 0xc2, 0xc2, 0xb8, 0xb4, 0xb9, 0xbe, 0xbe, 0xb3, 0xb4, 0xbb, 0xc2, 0xb7, 0x93, 0x89, 0x88, 0x7a, 0x83, 0x81, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x82, 0x7b, 0x82, 0x81, 0x83, 0x81, 0x81, 0x81, 0x81, 0x71, 0x6b, 0x86, 0xb2, 0xc2, 0xc0, 0xa5, 0xb3, 0xb9, 0xc3, 0xc0, 0xc0, 0xc2, 0xb7, 0xad, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x88, 0x83, 0x71, 0x83, 0x7d, 0x81, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x81, 0x83, 0x7d, 0x71, 0x78, 0x81, 0x88, 0x89, 0x83, 0x7d, 0x71, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x71, 0x83, 0x7d, 0x7d, 0x71, 0x78, 0x7d, 0x82, 0x7f, 0xc6, 0xd0, 0x15, 0x00, 0xfd, 0xfd, 0xdd, 0xec, 0xe0, 0xe1, 0xdf, 0x02, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0xec, 0xe6, 0xe1, 0x00, 0x0f, 0xce, 0xc6, 0x66, 0x86, 0x7b, 0x7b, 0x88, 0x83, 0x78, 0x81, 0x7d, 0x83, 0x7b, 0x82, 0x7b, 0x7b, 0x7b, 0x81, 0x81, 0x6a, 0x92, 0x89, 0x5e, 0x96, 0xc2, 0x8f, 0xa7, 0xbe, 0xc6, 0xc6, 0xa8, 0x9d, 0xa8, 0xca, 0xc6, 0xbe, 0xbe, 0xc2, 0xb7, 0x89, 0x81, 0x92, 0x7d, 0x83, 0x83, 0x81, 0x83, 0x81, 0x83, 0x81, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7b, 0x7b, 0x86, 0x7b, 0x83, 0x83, 0x81, 0x81, 0x81, 0x89, 0x83, 0x8d, 0xaf, 0xb4, 0xa6, 0xb9, 0xc6, 0xb6, 0xba, 0xb6, 0xac, 0xa7, 0xa7, 0xc2, 0xc2, 0xc2, 0x92, 0x6b, 0x6b, 0x83, 0x7b, 0x7b, 0x86, 0x7d, 0x81, 0x81, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x83, 0x83, 0x7d, 0x83, 0x8e, 0x9b, 0x93, 0x88, 0x7d, 0x7d, 0x83, 0x83, 0x7d, 0x7d, 0x83, 0x7d, 0x83, 0x83, 0x83, 0x83, 0x7d, 0x83, 0x77, 0x8f, 0xd1, 0xc1, 0x0d, 0x00, 0xdd, 0xfd, 0xfb, 0xec, 0xe1, 0xdf, 0xe1, 0x01, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0x02, 0xe6, 0xe0, 0x00, 0x06, 0xaa, 0xcf, 0x72, 0x7f, 0x7b, 0x88, 0x7b, 0x7d, 0x81, 0x81, 0x81, 0x83, 0x7b, 0x7b, 0x7b, 0x7b, 0x83, 0x81, 0x7a, 0x89, 0x7a, 0x81, 0x8d, 0xaf, 0xb9, 0xc6, 0xc5, 0x99, 0x58, 0x38, 0x28, 0x1e, 0x1b, 0x22, 0x31, 0x6f, 0xbf, 0xc6, 0xc9, 0xa9, 0x81, 0x7d, 0x81, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x81, 0x83, 0x7b, 0x7b, 0x7b, 0x7b, 0x83, 0x7d, 0x83, 0x7d, 0x5f, 0x7f, 0x9c, 0xb9, 0xc6, 0xc6, 0xbf, 0x91, 0xaa, 0x84, 0xa1, 0xbd, 0xca, 0xc6, 0xbe, 0xb4, 0xbb, 0xb8, 0x9e, 0x7b, 0x70, 0x7b, 0x7b, 0x7b, 0x83, 0x83, 0x81, 0x83, 0x81, 0x83, 0x83, 0x83, 0x83, 0x88, 0x83, 0x83, 0x83, 0x96, 0xa4, 0xb1, 0x8e, 0x88, 0x7d, 0x88, 0x83, 0x83, 0x7d, 0x7d, 0x88, 0x81, 0x83, 0x81, 0x83, 0x83, 0x81, 0x77, 0x8f, 0xd2, 0xaa, 0x04, 0xdd, 0x00, 0xfc, 0xfb, 0x02, 0xe1, 0xdf, 0x02, 0x02, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfb, 0x01, 0xe3, 0xe0, 0xe8, 0xdd, 0x58, 0xcf, 0x87, 0x76, 0x7f, 0x88, 0x86, 0x78, 0x88, 0x89, 0x83, 0x83, 0x82, 0x86, 0x7b, 0x86, 0x83, 0x81, 0x81, 0x89, 0x73, 0x82, 0xc0, 0xb9, 0xac, 0xc8, 0x4d, 0xf0, 0x0d, 0xde, 0x07, 0x06, 0x04, 0x06, 0x09, 0x15, 0x3b, 0x91, 0xc6, 0xc3, 0x98, 0x71, 0x82, 0x81, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x88, 0x81, 0x83, 0x81, 0x83, 0x83, 0x83, 0x83, 0x7b, 0x83, 0x7b, 0x81, 0x7d, 0x83, 0x7d, 0x7b, 0x7f, 0x9c, 0xbc, 0xc6, 0xae, 0x6f, 0x31, 0x1b, 0x11, 0x0c, 0x0e, 0x1b, 0x3b, 0x5b, 0xa8, 0xd1, 0xfe, 0xc0, 0xb4, 0x98, 0x7f, 0x7b, 0x86, 0x70, 0x83, 0x81, 0x81, 0x83, 0x81, 0x83, 0x81, 0x83, 0x83, 0x83, 0x83, 0x83, 0x8e, 0xa4, 0xb7, 0xb7, 0x92, 0x83, 0x83, 0x83, 0x88, 0x81, 0x7d, 0x83, 0x83, 0x83, 0x83, 0x83, 0x88, 0x81, 0x82, 0x70, 0x87, 0xd6, 0x4d, 0x03, 0x02, 0xe6, 0xdd, 0xfb, 0xe1, 0xe1, 0xdf, 0xe1, 0x01, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0xdd, 0xe4, 0xe0, 0xe8, 0x00, 0x2e, 0xd6, 0xa7, 0x7f, 0x7b, 0x8a, 0x83, 0x7d, 0x89, 0x89, 0x83, 0x83, 0x86, 0x7b, 0x86, 0x7b, 0x83, 0x81, 0x89, 0x73, 0x96, 0xb4, 0xb3, 0xc7, 0x91, 0x32, 0xeb, 0xe9, 0xe7, 0xe8, 0xea, 0xea, 0xea, 0xeb, 0xe9, 0xe2, 0x08, 0x24, 0x7c, 0xc7, 0xb9, 0x98, 0x7b, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x81, 0x83, 0x83, 0x82, 0x7b, 0x7f, 0x90, 0xb3, 0xba, 0x91, 0x2e, 0x0f, 0x07, 0x07, 0x0b, 0x08, 0x08, 0x09, 0x09, 0x11, 0x28, 0x58, 0xc5, 0xb6, 0xac, 0xa6, 0x98, 0x7f, 0x7b, 0x8e, 0x83, 0x81, 0x88, 0x81, 0x83, 0x83, 0x83, 0x83, 0x83, 0x88, 0x88, 0x83, 0x8a, 0xa4, 0xb1, 0xb7, 0x88, 0x83, 0x7d, 0x83, 0x83, 0x83, 0x83, 0x88, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x77, 0xb3, 0xd6, 0x2a, 0x01, 0xe1, 0xe8, 0x00, 0xfb, 0xe1, 0xe1, 0xdf, 0xe1, 0x01, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0xe6, 0xe4, 0xe4, 0x00, 0x13, 0xd8, 0xbc, 0x85, 0x76, 0x8e, 0x83, 0x7b, 0x92, 0x81, 0x89, 0x83, 0x86, 0x86, 0x86, 0x86, 0x83, 0x89, 0x89, 0x82, 0x98, 0xc3, 0xc7, 0x7c, 0x28, 0x0b, 0xe8, 0xe9, 0xe9, 0xea, 0xea, 0xe7, 0xe8, 0xe9, 0xe9, 0xe9, 0xe7, 0x0b, 0x24, 0x91, 0xca, 0x9c, 0x86, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x88, 0x81, 0x89, 0x81, 0x89, 0x81, 0x86, 0x7f, 0x85, 0x90, 0xa8, 0x7c, 0x22, 0x0a, 0xfd, 0xea, 0xea, 0xe6, 0xe8, 0xea, 0x0b, 0xe8, 0x06, 0x09, 0x0f, 0x3b, 0x94, 0xcf, 0xbc, 0x9c, 0x8b, 0x88, 0x81, 0x81, 0x89, 0x81, 0x88, 0x81, 0x88, 0x83, 0x88, 0x83, 0x88, 0x88, 0x82, 0x8e, 0x96, 0xad, 0xa4, 0x88, 0x7d, 0x7b, 0x83, 0x88, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7d, 0x83, 0x7f, 0xd1, 0xce, 0x0f, 0x05, 0x00, 0xe6, 0x00, 0x05, 0xec, 0xdf, 0xe1, 0x02, 0x01, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x01, 0xfb, 0x01, 0xe7, 0xe4, 0xe4, 0x00, 0x0a, 0xc8, 0xcd, 0x8f, 0x76, 0x8a, 0x83, 0x83, 0x92, 0x81, 0x81, 0x88, 0x83, 0x86, 0x86, 0x83, 0x88, 0x83, 0x88, 0xa2, 0xa5, 0xb6, 0x91, 0x22, 0x06, 0xde, 0xe8, 0xe7, 0xdd, 0xfb, 0xfc, 0xfc, 0x00, 0xe3, 0xe5, 0xe9, 0xeb, 0xe2, 0x09, 0x31, 0xb6, 0xa7, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x7f, 0x7e, 0xbf, 0x79, 0x28, 0x09, 0xe6, 0xe9, 0xed, 0xe5, 0xed, 0xea, 0xe9, 0xe9, 0xe9, 0xe9, 0xe8, 0xe2, 0x0b, 0x32, 0xa1, 0xbf, 0xa7, 0xab, 0x93, 0x6d, 0x89, 0x88, 0x89, 0x89, 0x88, 0x83, 0x88, 0x83, 0x83, 0x88, 0x86, 0x83, 0x86, 0x8e, 0x8e, 0x8e, 0x8e, 0x83, 0x83, 0x83, 0x88, 0x83, 0x83, 0x88, 0x83, 0x88, 0x88, 0x88, 0x78, 0x83, 0x88, 0x98, 0xd1, 0x94, 0x07, 0xdf, 0xe3, 0xe4, 0xec, 0xec, 0xe1, 0xe1, 0xe1, 0xdf, 0x01, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x01, 0xe6, 0xe3, 0xe0, 0xde, 0xdd, 0x7c, 0xd3, 0x90, 0x69, 0x93, 0x83, 0x83, 0x93, 0x83, 0x88, 0x89, 0x86, 0x88, 0x83, 0x88, 0x88, 0x89, 0x82, 0xa5, 0xd1, 0xa1, 0x22, 0x0b, 0xe2, 0xea, 0xdf, 0xfb, 0xfb, 0xdd, 0xfb, 0xfb, 0xfb, 0x00, 0xe5, 0xe4, 0xe7, 0xea, 0x06, 0x11, 0x5b, 0xca, 0x7f, 0x86, 0x88, 0x89, 0x88, 0x88, 0x88, 0x86, 0x88, 0x83, 0x89, 0x88, 0x88, 0x83, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x86, 0x85, 0x87, 0xbd, 0x28, 0x09, 0x05, 0xea, 0xe9, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe4, 0xe5, 0xe9, 0xe9, 0xea, 0xe2, 0x09, 0x24, 0x94, 0xd1, 0xb4, 0x82, 0x92, 0x89, 0x83, 0x89, 0x83, 0x89, 0x88, 0x88, 0x83, 0x83, 0x88, 0x88, 0x83, 0x83, 0x88, 0x8b, 0x7b, 0x8d, 0x8a, 0x83, 0x89, 0x89, 0x88, 0x83, 0x82, 0x86, 0x8e, 0x93, 0x88, 0x82, 0x7b, 0x8d, 0x9c, 0xd6, 0x49, 0xdd, 0x02, 0xe6, 0xe3, 0xfd, 0x00, 0x02, 0xdf, 0xe1, 0x02, 0x02, 0x01, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0xe6, 0xec, 0x00, 0xe2, 0x01, 0x04, 0x24, 0xd7, 0xbc, 0x76, 0x81, 0x9b, 0x81, 0x76, 0x97, 0x83, 0x83, 0x83, 0x8a, 0x92, 0x89, 0x89, 0x89, 0xa5, 0xac, 0xc8, 0x2a, 0x0b, 0x0b, 0xe6, 0x00, 0xdd, 0x00, 0xdd, 0xdd, 0x00, 0xdd, 0x00, 0x00, 0xe3, 0xe3, 0xe7, 0xdf, 0x08, 0x08, 0x1e, 0xc1, 0xb6, 0x76, 0x89, 0x92, 0x7a, 0x83, 0x9a, 0x7b, 0x88, 0x89, 0x89, 0x89, 0x88, 0x88, 0x83, 0x88, 0x89, 0x89, 0x88, 0x93, 0x81, 0x8e, 0x66, 0xbf, 0x49, 0x0d, 0x05, 0xeb, 0x05, 0xe3, 0xe5, 0xe5, 0xe4, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x02, 0x05, 0xea, 0xea, 0xe8, 0x24, 0xb5, 0xbf, 0xab, 0x89, 0x88, 0x89, 0x92, 0x89, 0x81, 0x89, 0x86, 0x86, 0x86, 0x88, 0x89, 0x89, 0x81, 0x8a, 0x8b, 0x9c, 0xb2, 0xa9, 0x9b, 0x92, 0x7a, 0x7d, 0x8a, 0xab, 0xb2, 0xb7, 0x8e, 0x9b, 0x86, 0x86, 0x7e, 0xc6, 0xdb, 0x11, 0x01, 0x05, 0x00, 0x05, 0xec, 0xdd, 0x02, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdd, 0xdf, 0xfb, 0x00, 0xfd, 0x00, 0x00, 0x11, 0xd0, 0xca, 0x72, 0x93, 0x92, 0x78, 0x86, 0x7f, 0x88, 0x83, 0x83, 0x88, 0x89, 0x89, 0x89, 0x89, 0xb9, 0xba, 0x4d, 0x10, 0xe8, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0x00, 0x00, 0xe1, 0x05, 0xde, 0xeb, 0x63, 0xb6, 0x7f, 0x83, 0x92, 0x7a, 0x88, 0x8b, 0x86, 0x83, 0x89, 0x89, 0x89, 0x89, 0x82, 0x86, 0x88, 0x82, 0x83, 0x8a, 0x8a, 0x78, 0x8d, 0x90, 0xae, 0x1e, 0xea, 0xec, 0xe8, 0x00, 0x00, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe0, 0xe7, 0xea, 0xeb, 0x2a, 0xbd, 0xbe, 0x8e, 0x82, 0x88, 0x89, 0x89, 0x89, 0x89, 0x86, 0x8b, 0x86, 0x88, 0x89, 0x89, 0x81, 0x8e, 0x98, 0xa5, 0xaf, 0xb2, 0xa4, 0x92, 0x81, 0x89, 0x9e, 0xaf, 0xa3, 0xc2, 0xb7, 0x93, 0x86, 0x85, 0x87, 0xd6, 0x99, 0x0b, 0xdd, 0xfc, 0x01, 0xfd, 0x01, 0xdd, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0xe6, 0x02, 0xec, 0xdd, 0xec, 0xec, 0x00, 0x06, 0xaa, 0xd3, 0x8f, 0x9b, 0x81, 0x81, 0x8d, 0x7b, 0x86, 0x88, 0x88, 0x88, 0x81, 0x7a, 0x89, 0x98, 0xc3, 0x91, 0x22, 0xe2, 0xe6, 0xe0, 0x00, 0x00, 0x01, 0x00, 0x00, 0xdd, 0xe6, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0xe3, 0x00, 0xde, 0xde, 0x2a, 0xbf, 0x8f, 0x7d, 0x92, 0x81, 0x88, 0x8b, 0x7f, 0x88, 0x89, 0x89, 0x89, 0x89, 0x86, 0x83, 0x88, 0x82, 0x78, 0x93, 0x8a, 0x68, 0x86, 0xac, 0x50, 0x09, 0xe2, 0xe7, 0xe1, 0x00, 0x00, 0xe4, 0xe3, 0xe3, 0xe3, 0x00, 0xe3, 0xdd, 0xdd, 0x00, 0x00, 0xe3, 0xe5, 0xe9, 0xe6, 0x0a, 0x58, 0xcd, 0x9c, 0x86, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x86, 0x86, 0x86, 0x88, 0x89, 0x81, 0x89, 0x8a, 0xa3, 0xa5, 0xaf, 0xb8, 0xad, 0x93, 0x81, 0x9a, 0xab, 0xb8, 0xa3, 0xb2, 0xc2, 0x96, 0x8f, 0x85, 0x9d, 0xda, 0x2a, 0xfb, 0xdd, 0xfd, 0xdd, 0xfb, 0x02, 0x01, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0x02, 0xfb, 0xec, 0xe6, 0x02, 0xdd, 0x3b, 0xd7, 0xa6, 0x8d, 0x83, 0x89, 0x8d, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x78, 0x7d, 0x8e, 0xaf, 0xc6, 0x46, 0x0c, 0xdf, 0xe6, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe0, 0xe4, 0x00, 0xe3, 0x00, 0xe3, 0x05, 0xe2, 0x15, 0xba, 0xa6, 0x7b, 0x92, 0x89, 0x8a, 0x7b, 0x8b, 0x83, 0x89, 0x92, 0x89, 0x89, 0x86, 0x88, 0x88, 0x8e, 0x7d, 0x9a, 0x8a, 0x70, 0x7f, 0xac, 0x23, 0xfd, 0xe8, 0xe7, 0xe3, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe3, 0xe8, 0x0b, 0x1b, 0xa8, 0xbc, 0x8f, 0x86, 0x83, 0x89, 0x89, 0x89, 0x86, 0x86, 0x86, 0x88, 0x89, 0x81, 0x89, 0x8e, 0xa3, 0xb4, 0xaf, 0xb8, 0xad, 0x8a, 0x86, 0x9a, 0xb8, 0xaf, 0xb8, 0x9e, 0xc2, 0xa9, 0x8f, 0x6c, 0xcf, 0xc1, 0x0d, 0x00, 0x01, 0x04, 0xdd, 0xfb, 0x02, 0xdd, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0xdd, 0x02, 0xec, 0xe3, 0xe6, 0xe2, 0xdd, 0x13, 0xd7, 0xcd, 0x7f, 0x82, 0x93, 0x83, 0x8e, 0x83, 0x88, 0x8e, 0x88, 0x86, 0x7b, 0xa0, 0xb3, 0xbf, 0x13, 0x09, 0xe2, 0xe0, 0xe3, 0x00, 0x00, 0x00, 0x05, 0xe1, 0x00, 0x00, 0xe4, 0xe3, 0xe3, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 0x00, 0xe6, 0x0d, 0x79, 0xb3, 0x77, 0x89, 0x88, 0x8a, 0x7f, 0x8b, 0x88, 0x89, 0x89, 0x89, 0x88, 0x86, 0x88, 0x88, 0x93, 0x7b, 0x93, 0x8b, 0x86, 0x85, 0x79, 0x0e, 0x08, 0xe7, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe4, 0x00, 0xe3, 0xe3, 0xe1, 0x00, 0x00, 0xe0, 0xe3, 0xde, 0x0b, 0x07, 0x3b, 0xc7, 0x9c, 0x8b, 0x83, 0x89, 0x89, 0x89, 0x86, 0x86, 0x86, 0x8a, 0x81, 0x89, 0x81, 0x93, 0xa3, 0xb8, 0xaf, 0xb8, 0xb2, 0x86, 0x7f, 0x97, 0xaf, 0xa3, 0xc2, 0xa9, 0xb1, 0xab, 0x87, 0x9d, 0xda, 0x40, 0x06, 0x00, 0xfb, 0x05, 0xdd, 0xdd, 0x01, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0xfb, 0x02, 0xec, 0xe3, 0xe3, 0xe6, 0xdd, 0x09, 0xaa, 0xd3, 0x7e, 0x8d, 0x8e, 0x71, 0x93, 0x89, 0x88, 0x88, 0x8a, 0x82, 0x8b, 0xa5, 0xbc, 0x5b, 0x0a, 0x06, 0xe6, 0xe3, 0xe3, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xe4, 0xea, 0xee, 0xee, 0xe9, 0xe7, 0xe4, 0xe3, 0xe3, 0xe1, 0xe3, 0xe6, 0x09, 0x46, 0xbc, 0x7f, 0x8e, 0x88, 0x93, 0x76, 0x8b, 0x88, 0x89, 0x89, 0x89, 0x88, 0x8a, 0x88, 0x88, 0x8e, 0x7d, 0x8a, 0x86, 0x8b, 0x87, 0x47, 0x09, 0x0b, 0xe5, 0xe3, 0xe3, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe0, 0xe4, 0xe3, 0xe3, 0xe3, 0x00, 0xe3, 0x00, 0xfd, 0x07, 0x11, 0xaa, 0xac, 0x8f, 0x86, 0x83, 0x92, 0x88, 0x83, 0x86, 0x86, 0x86, 0x89, 0x89, 0x89, 0x8e, 0xa3, 0xb8, 0xb8, 0xb7, 0xab, 0x8b, 0x7f, 0x97, 0xa3, 0xaf, 0xb2, 0xc2, 0xb7, 0x8f, 0x87, 0xcf, 0xd0, 0x11, 0xdd, 0xfb, 0x05, 0xfb, 0x01, 0x01, 0xdd, 0xec, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xfd, 0x00, 0xec, 0xe4, 0xe3, 0xe6, 0xdd, 0x03, 0x3b, 0xd6, 0xa7, 0x8f, 0x77, 0x89, 0x81, 0x89, 0x88, 0x89, 0x8a, 0x86, 0x8f, 0x95, 0xbf, 0x28, 0x09, 0x02, 0xe3, 0xe3, 0xe3, 0x00, 0xdd, 0xec, 0x00, 0xea, 0xee, 0xf0, 0xf2, 0xf9, 0xf7, 0xef, 0xe9, 0xe4, 0xe4, 0xe4, 0xe3, 0xe6, 0x06, 0x2c, 0xb6, 0x7f, 0x8e, 0x7b, 0x9a, 0x7f, 0x8b, 0x8a, 0x89, 0x92, 0x89, 0x88, 0x8a, 0x8a, 0x88, 0x83, 0x88, 0x8a, 0x76, 0x8f, 0x80, 0x26, 0x07, 0xe2, 0xe5, 0xe3, 0xe3, 0x00, 0xdd, 0xdd, 0xdd, 0x02, 0xdd, 0xea, 0xee, 0xee, 0xed, 0xe5, 0xe3, 0xe3, 0x00, 0xe2, 0x00, 0xdf, 0x0b, 0x08, 0x40, 0xbf, 0x98, 0x7f, 0x88, 0x89, 0x89, 0x86, 0x86, 0x86, 0x86, 0x89, 0x89, 0x89, 0x8e, 0x9e, 0xaf, 0xb7, 0xa9, 0x97, 0x7f, 0x8b, 0x8f, 0xa3, 0xb2, 0xad, 0xb7, 0x9e, 0x85, 0x9d, 0xd7, 0x4d, 0x06, 0xdd, 0xfd, 0xdd, 0xdd, 0x02, 0xec, 0xdd, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0xfd, 0x00, 0xe1, 0xe8, 0xe4, 0xe7, 0x02, 0xdd, 0x1b, 0xd7, 0xbf, 0x90, 0x77, 0x9b, 0x81, 0x92, 0x88, 0x88, 0x86, 0x86, 0x85, 0x9d, 0xae, 0x0e, 0x09, 0xe1, 0xe3, 0xe3, 0xe3, 0xec, 0x00, 0x00, 0xe3, 0xee, 0xef, 0xea, 0xe5, 0xef, 0xf7, 0xfa, 0xf0, 0xe5, 0xe5, 0xe3, 0xe4, 0xe3, 0x01, 0x1b, 0xb6, 0x85, 0x8d, 0x7d, 0x96, 0x7b, 0x8b, 0x86, 0x88, 0x89, 0x89, 0x8a, 0x86, 0x88, 0x88, 0x88, 0x8e, 0x8a, 0x7b, 0x7e, 0x80, 0x13, 0x07, 0xe3, 0xe4, 0xe4, 0xe3, 0x00, 0x00, 0xdd, 0x00, 0xfd, 0xef, 0xf2, 0xf2, 0xf7, 0xfa, 0xf0, 0xe5, 0xe3, 0x00, 0x02, 0x00, 0xdd, 0xe6, 0xe8, 0x15, 0xc5, 0x95, 0x7f, 0x82, 0x93, 0x89, 0x83, 0x8a, 0x86, 0x86, 0x88, 0x89, 0x88, 0x93, 0x97, 0xb2, 0xb1, 0x96, 0x86, 0x7f, 0x7f, 0x8b, 0x97, 0xb2, 0xb7, 0x93, 0x7f, 0x90, 0xc7, 0xd0, 0x11, 0x01, 0xdd, 0xfd, 0x00, 0x00, 0x05, 0x02, 0xdd, 0xec, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdd, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdd, 0x00, 0x00, 0x02, 0x02, 0xe6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x01, 0xfb, 0x01, 0x02, 0xe1, 0xe0, 0xe4, 0xe1, 0xdf, 0x03, 0x07, 0xaa, 0xd4, 0x95, 0x7f, 0x92, 0x81, 0x93, 0x89, 0x83, 0x93, 0x7f, 0x7e, 0xca, 0x46, 0x0a, 0xfd, 0x00, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0xe3, 0xeb, 0xf2, 0xe5, 0xe7, 0xe5, 0xe9, 0xf5, 0xf7, 0xf8, 0xee, 0xe4, 0xe4, 0xe4, 0xec, 0x00, 0x19, 0xa1, 0x90, 0x86, 0x86, 0x86, 0x8b, 0x76, 0x8a, 0x88, 0x89, 0x88, 0x86, 0x8a, 0x88, 0x88, 0x83, 0x88, 0x8a, 0x76, 0x90, 0x5b, 0x0e, 0x06, 0xe3, 0xe4, 0xe4, 0xe0, 0x00, 0xdd, 0x00, 0xfd, 0xf0, 0xee, 0xe3, 0xe9, 0xef, 0xf7, 0xf8, 0xf0, 0xe7, 0x00, 0xfb, 0x00, 0xe3, 0xe3, 0xe9, 0x0b, 0x79, 0xbc, 0x7f, 0x8d, 0x7d, 0x81, 0x93, 0x8e, 0x86, 0x88, 0x88, 0x89, 0x89, 0x88, 0x8d, 0x86, 0x89, 0x92, 0x96, 0x8b, 0x7f, 0x8b, 0x8b, 0x88, 0x93, 0x7b, 0x8f, 0xac, 0xd2, 0x63, 0x01, 0xfd, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe6, 0x05, 0xe2, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0xe1, 0xe3, 0xe0, 0xe0, 0xe0, 0x02, 0xfb, 0x04, 0x49, 0xd8, 0x9d, 0x85, 0x8e, 0x89, 0x92, 0x88, 0x89, 0x93, 0x86, 0x87, 0xbf, 0x2e, 0x0a, 0x02, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0xe4, 0xee, 0xf7, 0xe9, 0xe5, 0xe5, 0xed, 0xf1, 0xf7, 0xf7, 0xf1, 0xe7, 0xe4, 0xe3, 0xe3, 0x03, 0x11, 0x8c, 0x87, 0x86, 0x8e, 0x88, 0x8b, 0x8b, 0x88, 0x8a, 0x89, 0x8a, 0x8a, 0x86, 0x8a, 0x88, 0x8a, 0x83, 0x8e, 0x76, 0x95, 0x47, 0x0e, 0xfd, 0xe1, 0xe3, 0xe4, 0xe4, 0x00, 0xe3, 0xfb, 0xee, 0xf2, 0xe3, 0xe5, 0xe5, 0xed, 0xf4, 0xf7, 0xf5, 0xeb, 0xe3, 0xfb, 0x00, 0x00, 0xe4, 0xe5, 0xea, 0x46, 0xb6, 0x85, 0x8d, 0x88, 0x89, 0x88, 0x8a, 0x8a, 0x86, 0x88, 0x89, 0x8e, 0x88, 0x86, 0x86, 0x89, 0x92, 0x8e, 0x86, 0x7f, 0x8a, 0x8a, 0x88, 0x86, 0x8d, 0x90, 0xc7, 0xce, 0x0f, 0xfc, 0xdd, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0xec, 0xdd, 0x02, 0xdd, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0xe1, 0xe1, 0xe0, 0xe3, 0xe1, 0x02, 0x04, 0xdd, 0x15, 0xdb, 0xbf, 0x90, 0x86, 0x93, 0x88, 0x8e, 0x89, 0x93, 0x7f, 0x90, 0xba, 0x28, 0x07, 0xe1, 0x00, 0xe3, 0xe3, 0x00, 0x00, 0xe3, 0xe5, 0xf0, 0xf7, 0xef, 0xed, 0xed, 0xef, 0xf8, 0xf4, 0xf8, 0xf5, 0xed, 0xe3, 0xe3, 0x00, 0x03, 0x0e, 0x91, 0x87, 0x8d, 0x88, 0x88, 0x8a, 0x8b, 0x8a, 0x88, 0x88, 0x8a, 0x86, 0x8b, 0x88, 0x88, 0x8a, 0x83, 0x8e, 0x86, 0x95, 0x3e, 0x0c, 0xfc, 0xe3, 0xe3, 0xe3, 0x00, 0xe3, 0xe3, 0xfd, 0xf0, 0xf2, 0xe5, 0xe5, 0xe5, 0xed, 0xf4, 0xf4, 0xfa, 0xf0, 0xe7, 0xfb, 0x00, 0xdd, 0xe3, 0xe5, 0xde, 0x28, 0xb6, 0x90, 0x7f, 0x93, 0x92, 0x88, 0x88, 0x8b, 0x8a, 0x88, 0x88, 0x89, 0x88, 0x8e, 0x86, 0x92, 0x89, 0x88, 0x86, 0x86, 0x8a, 0x8e, 0x8e, 0x86, 0x8f, 0xb6, 0xda, 0x3b, 0x01, 0x01, 0x01, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0xec, 0x02, 0x05, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xec, 0xe1, 0xe0, 0xdf, 0xe0, 0x02, 0x02, 0xfb, 0xdd, 0x06, 0xb5, 0xd2, 0x9d, 0x86, 0x8e, 0x88, 0x93, 0x92, 0x8e, 0x86, 0x90, 0xa1, 0x13, 0x04, 0x00, 0xe3, 0x00, 0xe3, 0x00, 0x00, 0xe3, 0xe5, 0xf2, 0xfa, 0xf2, 0xf1, 0xf1, 0xf6, 0xf8, 0xf4, 0xf5, 0xf7, 0xed, 0xe3, 0xe4, 0x00, 0xdd, 0x0c, 0x79, 0x90, 0x8d, 0x8e, 0x89, 0x8a, 0x86, 0x8a, 0x88, 0x8e, 0x86, 0x8b, 0x86, 0x8e, 0x88, 0x8e, 0x7b, 0x8e, 0x86, 0x95, 0x3a, 0x09, 0xfc, 0x00, 0x00, 0xe3, 0xe3, 0xe3, 0xe3, 0xe7, 0xf2, 0xfa, 0xef, 0xed, 0xed, 0xf1, 0xf6, 0xf4, 0xf5, 0xf2, 0xe9, 0xdd, 0x00, 0xdd, 0xe3, 0xe4, 0xe7, 0x1b, 0x9d, 0x95, 0x69, 0x96, 0x92, 0x83, 0x8a, 0x8b, 0x86, 0x8a, 0x89, 0x8e, 0x89, 0x8d, 0x88, 0x92, 0x92, 0x88, 0x8a, 0x8a, 0x93, 0x93, 0x86, 0x8f, 0x90, 0xcf, 0xcc, 0x07, 0x01, 0xdd, 0x05, 0xec, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xdd, 0x02, 0xdd, 0x02, 0x02, 0x02, 0x05, 0xec, 0xdd, 0xdd, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0x01, 0x02, 0xe1, 0xe0, 0xdf, 0xe1, 0x01, 0xfb, 0xdd, 0x06, 0x00, 0x38, 0xda, 0xb6, 0x85, 0x8e, 0x7b, 0x9a, 0x92, 0x89, 0x8d, 0x9c, 0xa1, 0x0e, 0x03, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xe3, 0xe5, 0xf5, 0xf5, 0xf4, 0xf8, 0xf8, 0xf6, 0xf6, 0xf4, 0xf6, 0xf7, 0xed, 0xe3, 0xe0, 0x00, 0xdd, 0x0c, 0x91, 0x87, 0x8d, 0x92, 0x81, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8e, 0x8b, 0x8b, 0x8e, 0x88, 0x96, 0x7b, 0x92, 0x8d, 0x95, 0x35, 0x09, 0xfb, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xe4, 0xfd, 0xf7, 0xf5, 0xf6, 0xf1, 0xf3, 0xf8, 0xf3, 0xf8, 0xf6, 0xf5, 0xe9, 0x00, 0xdd, 0xdd, 0x00, 0xe4, 0xdf, 0x0e, 0x91, 0x95, 0x65, 0x93, 0x9b, 0x83, 0x93, 0x8b, 0x8a, 0x8e, 0x88, 0x92, 0x88, 0x8e, 0x8a, 0x8e, 0x88, 0x8a, 0x8d, 0x8e, 0x8e, 0x8e, 0x82, 0x9c, 0xbf, 0xda, 0x1e, 0xdd, 0xdd, 0xfb, 0xdd, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0xec, 0x01, 0x02, 0x02, 0x02, 0x02, 0xde, 0xfd, 0x05, 0x02, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xdf, 0xe0, 0xdf, 0x02, 0xfb, 0xfb, 0xdd, 0x08, 0x00, 0x0f, 0xc4, 0xca, 0x90, 0x8e, 0x8b, 0x93, 0x92, 0x89, 0x8e, 0x90, 0x91, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe5, 0xf1, 0xf8, 0xf4, 0xf6, 0xf6, 0xf3, 0xf6, 0xf3, 0xf8, 0xf5, 0xed, 0xe3, 0x00, 0x00, 0x03, 0x0c, 0x91, 0x87, 0x8e, 0x92, 0x92, 0x93, 0x8a, 0x8e, 0x8e, 0x8e, 0x8d, 0x8b, 0x8d, 0x8e, 0x8e, 0x8e, 0x86, 0x92, 0x8e, 0x90, 0x3a, 0x09, 0xfc, 0xdd, 0x00, 0x00, 0x00, 0xe4, 0xe4, 0xe9, 0xf7, 0xf8, 0xf3, 0xf8, 0xfa, 0xf6, 0xf6, 0xf6, 0xf3, 0xf5, 0xe9, 0x00, 0xdd, 0xfb, 0x00, 0xe3, 0x01, 0x0c, 0x91, 0x95, 0x72, 0x8e, 0x92, 0x83, 0x93, 0x8a, 0x8b, 0x8a, 0x8e, 0x8e, 0x89, 0x8e, 0x8e, 0x88, 0x8a, 0x8a, 0x8b, 0x8e, 0x86, 0x82, 0x8d, 0xac, 0xd7, 0x75, 0xdd, 0xe2, 0xdf, 0x02, 0xdd, 0xec, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0x02, 0xe0, 0xdf, 0xdf, 0x01, 0xfb, 0xfc, 0xfb, 0xfd, 0xec, 0x04, 0x75, 0xd4, 0xa6, 0x8b, 0x8b, 0x8a, 0x89, 0x92, 0x8d, 0x98, 0x91, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe5, 0xef, 0xf8, 0xf4, 0xf3, 0xf3, 0xf6, 0xf6, 0xf6, 0xf8, 0xf1, 0xe7, 0xe4, 0x00, 0x00, 0x03, 0x11, 0x91, 0x87, 0x86, 0x92, 0x92, 0x9b, 0x8a, 0x8e, 0x88, 0x8e, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e, 0x8d, 0x86, 0x92, 0x8e, 0x95, 0x3e, 0x09, 0xfb, 0xfb, 0x00, 0x00, 0xe3, 0xe4, 0xe5, 0xe7, 0xf2, 0xf6, 0xf3, 0xf6, 0xf6, 0xf3, 0xf6, 0xf3, 0xf6, 0xf1, 0xe5, 0x00, 0xfb, 0xdd, 0x01, 0xdd, 0xdd, 0x0c, 0x79, 0x95, 0x7f, 0x8e, 0x92, 0x88, 0x8e, 0x8b, 0x8a, 0x8a, 0x8e, 0x89, 0x8e, 0x8e, 0x8a, 0x8a, 0x86, 0x8b, 0x8b, 0x8a, 0x82, 0x8e, 0xa5, 0xcd, 0xc1, 0x11, 0x00, 0xe7, 0xe7, 0x00, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xec, 0xe1, 0xec, 0xec, 0xec, 0x05, 0x05, 0x02, 0x03, 0xfb, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x15, 0x2a, 0x2a, 0x24, 0x15, 0x0f, 0x04, 0x04, 0x03, 0x01, 0x02, 0xdf, 0xe1, 0xe1, 0xe1, 0xec, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xe1, 0xe0, 0xdf, 0x02, 0x03, 0xfc, 0xfd, 0xdd, 0xfb, 0xdd, 0x38, 0xd7, 0xbc, 0x8b, 0x8b, 0x93, 0x89, 0x89, 0x8e, 0x90, 0x91, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe4, 0xed, 0xf5, 0xf8, 0xf3, 0xf6, 0xf3, 0xf3, 0xf8, 0xf8, 0xef, 0xe3, 0xe4, 0x00, 0xdf, 0xdd, 0x13, 0x9d, 0x90, 0x86, 0x92, 0x89, 0x93, 0x88, 0x8e, 0x93, 0x8e, 0x8e, 0x8d, 0x8d, 0x8e, 0x8e, 0x8b, 0x8a, 0x9b, 0x88, 0x90, 0x41, 0x0a, 0xfb, 0xdd, 0x00, 0x00, 0xdd, 0xe3, 0xe3, 0xe4, 0xef, 0xf8, 0xf6, 0xf3, 0xf3, 0xf6, 0xf3, 0xf3, 0xf8, 0xf1, 0xe4, 0xe3, 0xdd, 0xdd, 0xdd, 0xec, 0xdd, 0x0c, 0x79, 0x95, 0x8f, 0x93, 0x92, 0x81, 0x88, 0x8a, 0x8b, 0x8a, 0x8e, 0x8e, 0x8e, 0x8e, 0x8a, 0x8a, 0x8a, 0x9a, 0x8d, 0x8d, 0x8d, 0x9c, 0xfe, 0xd7, 0x28, 0xdd, 0xe0, 0xe3, 0xe0, 0xdf, 0xfb, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xe4, 0xe4, 0xe1, 0xec, 0x01, 0xfb, 0x03, 0x01, 0x01, 0x05, 0xec, 0xe3, 0xe6, 0xec, 0xe3, 0xe4, 0xe1, 0x00, 0x00, 0x03, 0x06, 0x0c, 0x28, 0x7c, 0xc8, 0xce, 0xd6, 0xd6, 0xd7, 0xd7, 0xd6, 0xd6, 0xa1, 0x46, 0x11, 0xdd, 0xdd, 0xe0, 0xe5, 0xe4, 0xe4, 0x00, 0x08, 0x00, 0xfc, 0x01, 0x00, 0x05, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xec, 0xe3, 0xe0, 0xe1, 0xe1, 0xfb, 0xfb, 0xfc, 0xfb, 0x05, 0xdd, 0x0c, 0xc8, 0xbf, 0xa6, 0x7b, 0x92, 0x9b, 0x7b, 0x9c, 0x87, 0xa1, 0x13, 0x06, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xef, 0xf4, 0xf8, 0xf3, 0xf3, 0xf8, 0xfa, 0xef, 0xe6, 0xfb, 0xfb, 0x00, 0xe6, 0xdd, 0x26, 0xa6, 0x85, 0x7f, 0xa2, 0x8a, 0x93, 0x8e, 0x8e, 0x89, 0x8e, 0x8e, 0x8e, 0x8a, 0x8e, 0x8b, 0x8b, 0x8b, 0x9b, 0x8e, 0x8f, 0x5b, 0x0c, 0xfb, 0x00, 0xe3, 0x03, 0x00, 0xdd, 0xe3, 0xe0, 0xed, 0xf8, 0xf6, 0xf6, 0xf3, 0xf6, 0xf6, 0xf6, 0xf5, 0xed, 0xe4, 0xdd, 0x00, 0xdd, 0x00, 0x00, 0x01, 0x0c, 0x8c, 0x87, 0x86, 0x9b, 0x92, 0x89, 0x93, 0x8b, 0x8b, 0x8d, 0x8d, 0x8d, 0x8e, 0x8b, 0x8a, 0x9b, 0x71, 0x9a, 0x8d, 0x8f, 0x90, 0x9d, 0xd7, 0x63, 0x07, 0x00, 0xe6, 0xe4, 0xe6, 0x00, 0x02, 0xec, 0xe3, 0xe1, 0xe1, 0xec, 0xe1, 0xec, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xe4, 0xe0, 0xec, 0x02, 0xfb, 0x03, 0xfb, 0x03, 0x05, 0x00, 0xec, 0xe7, 0x00, 0xe3, 0xe6, 0xfd, 0x00, 0xdd, 0x09, 0x24, 0x63, 0xd0, 0xd6, 0xd4, 0xca, 0xc6, 0xb3, 0x95, 0x95, 0xa6, 0xb6, 0xbc, 0xd1, 0xd6, 0xd7, 0x4d, 0x10, 0xdf, 0x00, 0xe5, 0xe2, 0xec, 0xdd, 0xfd, 0xfc, 0x01, 0x01, 0xdf, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x02, 0xec, 0xe0, 0xe0, 0xe0, 0xe1, 0x01, 0xfb, 0xec, 0xfd, 0xec, 0xdd, 0x07, 0x58, 0xd7, 0xac, 0x86, 0x89, 0x9b, 0x7b, 0x98, 0x80, 0x9d, 0x22, 0x04, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x00, 0xe0, 0xee, 0xf4, 0xf8, 0xf8, 0xf5, 0xef, 0xeb, 0xdd, 0xdd, 0xdd, 0x00, 0xe6, 0x07, 0x36, 0xa6, 0x8b, 0x7f, 0x97, 0x86, 0x96, 0x8e, 0x8e, 0x93, 0x89, 0x93, 0x88, 0x8e, 0x8e, 0x8a, 0x8b, 0x8b, 0x92, 0x93, 0x98, 0x80, 0x11, 0x03, 0xe4, 0xe3, 0xec, 0xdd, 0xdd, 0xdd, 0x00, 0xe5, 0xef, 0xf4, 0xfa, 0xf3, 0xf4, 0xfa, 0xf4, 0xef, 0xe5, 0xe3, 0x00, 0xdd, 0x00, 0x01, 0x00, 0x03, 0x0e, 0x8c, 0x90, 0x86, 0x9b, 0x92, 0x89, 0x93, 0x8b, 0x8f, 0x8b, 0x8d, 0x86, 0x8d, 0x8b, 0x8a, 0x81, 0x9b, 0x89, 0x86, 0x7e, 0x9d, 0xd6, 0xc1, 0x11, 0x00, 0xec, 0xe1, 0x00, 0xe6, 0x02, 0x05, 0xe3, 0xec, 0xe1, 0xec, 0xe1, 0xe1, 0xec, 0xe1, 0xec, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3, 0xe1, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xe0, 0xe1, 0xec, 0x02, 0xfb, 0x01, 0x01, 0x02, 0x05, 0xe3, 0x00, 0xe1, 0xe6, 0xec, 0xec, 0x00, 0x09, 0x2a, 0xaa, 0xda, 0xd7, 0xca, 0x9d, 0x6c, 0x66, 0x66, 0x59, 0x51, 0x51, 0x55, 0x55, 0x59, 0x7e, 0x87, 0xca, 0xda, 0xc4, 0x2a, 0x0b, 0x00, 0xdd, 0x08, 0xdd, 0xfd, 0x01, 0x01, 0xe6, 0x00, 0xdf, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0x02, 0xec, 0xe1, 0xe0, 0xe0, 0xdf, 0xec, 0x02, 0xec, 0xe6, 0xe3, 0xdf, 0xdd, 0x15, 0xda, 0xbf, 0x8f, 0x88, 0x96, 0x86, 0x97, 0x7e, 0x9d, 0x31, 0x06, 0x01, 0xe3, 0xe3, 0xe3, 0xe3, 0xdd, 0x00, 0xfc, 0xdd, 0xdd, 0xec, 0xea, 0xee, 0xee, 0xeb, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xdf, 0x0b, 0x56, 0xa3, 0x8f, 0x8b, 0x8d, 0x7b, 0x96, 0x93, 0x8e, 0x89, 0x8e, 0x8e, 0x8e, 0x8e, 0x8a, 0x8b, 0x8b, 0x8a, 0x81, 0x92, 0x98, 0x95, 0x23, 0x03, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x01, 0x00, 0xe3, 0xe7, 0xef, 0xf5, 0xf7, 0xf8, 0xf2, 0xef, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xdd, 0x19, 0x9d, 0x85, 0x82, 0x9b, 0x92, 0x89, 0x93, 0x8b, 0x8b, 0x8d, 0x8d, 0x8e, 0x8e, 0x8a, 0x8a, 0x92, 0x92, 0x9f, 0x8f, 0x87, 0xd1, 0xd7, 0x28, 0xfb, 0xdd, 0x08, 0x02, 0x00, 0x05, 0x01, 0x01, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0x02, 0xec, 0x02, 0xec, 0xec, 0xe1, 0xe1, 0xe1, 0x02, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xe1, 0xec, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0xe1, 0xe2, 0xe3, 0xdd, 0xfd, 0xdd, 0x06, 0x15, 0xaa, 0xd2, 0xd4, 0xa8, 0x56, 0x4e, 0x55, 0x59, 0x4c, 0x52, 0x57, 0x5f, 0x68, 0x5f, 0x5d, 0x5d, 0x52, 0x51, 0x55, 0x9d, 0xce, 0xdb, 0x4d, 0x09, 0xdd, 0x0b, 0xfb, 0xdd, 0xfb, 0xe1, 0x00, 0xe6, 0xdf, 0xe4, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0xe1, 0x01, 0x01, 0xe1, 0xe3, 0xe0, 0xdf, 0x02, 0x02, 0xe3, 0xe6, 0xe4, 0xe4, 0xdd, 0x07, 0xb5, 0xd2, 0xa6, 0x8b, 0x8e, 0x8e, 0x96, 0x7f, 0xac, 0x50, 0x0a, 0x04, 0xe3, 0xe4, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x00, 0xdd, 0xdd, 0x00, 0x00, 0xec, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe3, 0x13, 0x80, 0x98, 0x8b, 0x97, 0x8b, 0x82, 0x9f, 0x89, 0x93, 0x92, 0x93, 0x8e, 0x8e, 0x8e, 0x8e, 0x8a, 0x8a, 0x93, 0x81, 0x92, 0x96, 0x87, 0x3e, 0x09, 0x00, 0xe4, 0xe4, 0xe3, 0x00, 0xdd, 0xdd, 0x00, 0xe3, 0xe3, 0xe7, 0xeb, 0xeb, 0xe8, 0x00, 0x00, 0xe3, 0x00, 0xdd, 0x00, 0x00, 0xe3, 0xe3, 0x01, 0x2c, 0x9d, 0x85, 0x8e, 0x92, 0x9b, 0x89, 0x8a, 0x8b, 0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x8a, 0x93, 0x9b, 0x88, 0x97, 0x7e, 0xc6, 0xda, 0x3b, 0xfb, 0x04, 0xdd, 0xfd, 0x05, 0xe6, 0x02, 0x00, 0xe6, 0x02, 0xec, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x01, 0x02, 0x01, 0x02, 0xec, 0xec, 0xe3, 0xe3, 0xe1, 0xe2, 0x03, 0xdd, 0x06, 0x32, 0xd0, 0xd3, 0xbc, 0x6c, 0x55, 0x66, 0x76, 0x68, 0x4c, 0x6d, 0x67, 0x64, 0x64, 0x60, 0x5e, 0x67, 0x67, 0x6d, 0x6b, 0x62, 0x4b, 0x6c, 0xd3, 0xd2, 0x49, 0x09, 0x01, 0xfc, 0x00, 0xec, 0xe3, 0x00, 0xe6, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0x01, 0xfb, 0xfb, 0x02, 0x02, 0xdf, 0xe1, 0x01, 0x02, 0xec, 0xe4, 0xe5, 0xe4, 0xe2, 0xdd, 0x38, 0xd8, 0xb6, 0x8f, 0x8b, 0x93, 0x93, 0x82, 0x9c, 0x80, 0x13, 0x06, 0x00, 0xe4, 0xe5, 0xe3, 0x00, 0x00, 0xe4, 0xe4, 0xe4, 0xe3, 0xec, 0xec, 0xec, 0xe1, 0xe4, 0xe4, 0xe5, 0xe4, 0x00, 0xdd, 0x0b, 0x3b, 0x95, 0x8b, 0x8b, 0x9e, 0x8e, 0x86, 0x9b, 0x88, 0x92, 0x8e, 0x93, 0x8e, 0x8e, 0x8e, 0x8e, 0x8a, 0x8e, 0x9b, 0x92, 0x92, 0x8d, 0x8f, 0x5b, 0x13, 0x03, 0xe3, 0xe5, 0xe5, 0xe3, 0x00, 0x00, 0xdd, 0xe1, 0xe3, 0x00, 0x00, 0xdd, 0x00, 0xdd, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xe3, 0x07, 0x46, 0x95, 0x85, 0x8e, 0x92, 0x9b, 0x88, 0x93, 0x8b, 0x8b, 0x8e, 0x8e, 0x92, 0x92, 0x93, 0x8a, 0x86, 0x98, 0x7e, 0x8c, 0xda, 0x84, 0x09, 0x01, 0x06, 0x00, 0x00, 0x00, 0xe2, 0xe0, 0xe3, 0xe6, 0xe1, 0x01, 0x02, 0x01, 0xec, 0xfb, 0x02, 0xfb, 0x02, 0x01, 0x02, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0x02, 0xdf, 0x02, 0xdf, 0x02, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x01, 0x01, 0x01, 0x02, 0xec, 0xe1, 0xe1, 0xe0, 0xe1, 0xe3, 0x03, 0xdd, 0x09, 0x3b, 0xda, 0xcf, 0x95, 0x65, 0x51, 0x4c, 0x57, 0x57, 0x54, 0x64, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x5a, 0x53, 0x5a, 0x53, 0x53, 0x5c, 0x71, 0x5d, 0x66, 0xb6, 0xd8, 0x3b, 0xdd, 0x01, 0xde, 0xe1, 0xe3, 0xe2, 0x00, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xdf, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x01, 0xfc, 0xfc, 0xfb, 0x02, 0x01, 0x01, 0x01, 0xfb, 0xe1, 0xe3, 0xe7, 0xe4, 0xe8, 0xdd, 0x11, 0xd0, 0xc6, 0x9c, 0x8b, 0x8e, 0x92, 0x88, 0x8f, 0x95, 0x2c, 0x0a, 0x00, 0xe3, 0xe5, 0xe3, 0x00, 0xe3, 0xe5, 0xe5, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0xe3, 0xe4, 0xe5, 0xe5, 0xe3, 0x00, 0x06, 0x1b, 0x8c, 0x90, 0x8b, 0x8d, 0x96, 0x8e, 0x8e, 0x93, 0x8e, 0x92, 0x93, 0x93, 0x93, 0x8e, 0x8e, 0x8d, 0x93, 0x93, 0x93, 0x92, 0x9b, 0x93, 0x85, 0x95, 0x31, 0x07, 0x00, 0xe0, 0xe5, 0xe3, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xdd, 0xfb, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xdf, 0xe3, 0x00, 0x0f, 0x5b, 0x90, 0x8d, 0x93, 0x89, 0x9b, 0x89, 0x8b, 0x8b, 0x8d, 0x93, 0x92, 0x92, 0x92, 0x93, 0x8a, 0x8b, 0x7e, 0x9d, 0xd8, 0xb5, 0x0f, 0xdd, 0x02, 0x00, 0xe6, 0x02, 0xe3, 0xe3, 0xe0, 0xe4, 0xe5, 0x02, 0xec, 0x01, 0xec, 0x01, 0x02, 0x02, 0x02, 0x01, 0xec, 0xfb, 0x02, 0xfb, 0x01, 0xfb, 0x02, 0xe1, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x01, 0x02, 0x01, 0x02, 0xe1, 0xec, 0xe4, 0xe0, 0xe1, 0x05, 0xdd, 0x0a, 0x3b, 0xd8, 0xd4, 0x4e, 0x65, 0x52, 0x57, 0x70, 0x71, 0x71, 0x67, 0x64, 0x53, 0x61, 0x61, 0x74, 0x6a, 0x6a, 0x6a, 0x61, 0x6a, 0x74, 0x74, 0x4c, 0x53, 0x69, 0xa6, 0xca, 0xc1, 0x11, 0x00, 0xe2, 0xe1, 0xe3, 0xe2, 0x00, 0xfb, 0x03, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0x01, 0xfb, 0xfb, 0xfc, 0xec, 0xec, 0xe5, 0xe4, 0x05, 0xdd, 0x07, 0x7c, 0xd1, 0xb3, 0x7f, 0x93, 0x93, 0x92, 0x8b, 0x90, 0x50, 0x1b, 0x03, 0x00, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x00, 0xe3, 0xe4, 0xe5, 0xe4, 0xdd, 0x06, 0x12, 0x47, 0x95, 0x8f, 0x8e, 0x96, 0x8e, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x8e, 0x8e, 0x93, 0x8d, 0x8e, 0x93, 0x81, 0x9b, 0x8e, 0x96, 0x8b, 0xa6, 0x6e, 0x19, 0x03, 0x00, 0xe4, 0xe4, 0xe4, 0xfb, 0xdd, 0xe0, 0x00, 0x00, 0xdd, 0x00, 0xdd, 0x00, 0x05, 0x00, 0xe3, 0xe4, 0xe3, 0xdd, 0xdd, 0x07, 0x28, 0x8c, 0x90, 0x8d, 0x9f, 0x81, 0x9b, 0x8a, 0x8a, 0x9a, 0x8a, 0x93, 0x92, 0x92, 0x92, 0x93, 0x8d, 0x90, 0x95, 0xd4, 0xd5, 0x1e, 0x00, 0xe2, 0xe3, 0x00, 0xe2, 0xfd, 0xec, 0x00, 0xe0, 0xe5, 0xe4, 0xdf, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0x01, 0xec, 0x01, 0x02, 0xfb, 0x01, 0x01, 0xe1, 0xe3, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3, 0xe1, 0xe3, 0xe0, 0xdf, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x01, 0x01, 0x02, 0xe1, 0xe1, 0xe4, 0xe1, 0xe4, 0x00, 0x08, 0x06, 0x28, 0xda, 0xca, 0x43, 0x7e, 0x59, 0x5f, 0x69, 0x5f, 0x57, 0x5f, 0x5e, 0x6b, 0x6d, 0x5e, 0x5c, 0x54, 0x5c, 0x54, 0x5c, 0x5c, 0x61, 0x5a, 0x53, 0x74, 0x74, 0x53, 0x52, 0xac, 0xd7, 0x4d, 0x04, 0x00, 0xe1, 0xec, 0x00, 0x05, 0xfb, 0xfc, 0x03, 0xfb, 0x03, 0xfb, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfb, 0xfc, 0xfb, 0xfb, 0x02, 0xfb, 0x01, 0xfc, 0xfb, 0xfb, 0xec, 0xe4, 0xe0, 0x00, 0x04, 0xfb, 0x46, 0xd3, 0xb4, 0x8f, 0x8a, 0x93, 0x9b, 0x7f, 0x8f, 0x9d, 0x2c, 0x0c, 0x03, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0xfb, 0x01, 0x00, 0x00, 0xe4, 0xe0, 0x00, 0x03, 0x0e, 0x3a, 0xb3, 0x85, 0x96, 0x96, 0x96, 0x88, 0x8e, 0x9b, 0x8e, 0x93, 0x93, 0x93, 0x93, 0x8e, 0x93, 0x8d, 0x8e, 0x8e, 0x9b, 0x7d, 0x96, 0x8d, 0x97, 0x7f, 0x98, 0x90, 0x48, 0x0e, 0x03, 0xdd, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0xe3, 0xe3, 0xe4, 0x00, 0xdd, 0x03, 0x0e, 0x6f, 0x95, 0x8f, 0x8e, 0xa4, 0x81, 0x9b, 0x8a, 0x8b, 0x8b, 0x8a, 0x93, 0x92, 0x92, 0x93, 0x8d, 0x8f, 0x87, 0xd1, 0xd8, 0x2e, 0x03, 0x02, 0xe0, 0xe6, 0xe1, 0xfb, 0xfb, 0xfb, 0xfb, 0xe3, 0xe7, 0xe4, 0xe1, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0x02, 0xec, 0x02, 0x02, 0x02, 0xec, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0xec, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xdf, 0x02, 0xe1, 0xe1, 0xec, 0xe4, 0xe1, 0x05, 0xdd, 0x0f, 0xc8, 0xd4, 0x6e, 0x55, 0x7e, 0x65, 0x66, 0x65, 0x51, 0x4b, 0x42, 0x42, 0x42, 0x3d, 0x51, 0x45, 0x4c, 0x7f, 0x69, 0x52, 0x5f, 0x68, 0x53, 0x61, 0x74, 0x61, 0x64, 0x68, 0x66, 0xc7, 0xd5, 0x0f, 0xdd, 0xdd, 0xe6, 0x00, 0xfb, 0xfb, 0xfb, 0xfc, 0xfd, 0xfd, 0xdd, 0xec, 0x05, 0x00, 0xe3, 0xe1, 0xec, 0xe3, 0xec, 0xe1, 0xfb, 0xec, 0xfd, 0xe6, 0xe1, 0xe3, 0x01, 0xfb, 0xfc, 0xec, 0xec, 0xe4, 0xe4, 0xe3, 0x04, 0xfb, 0x31, 0xd3, 0xb4, 0x7f, 0x97, 0x9a, 0x9a, 0x9a, 0x85, 0x90, 0x6e, 0x29, 0x0a, 0x01, 0x04, 0x02, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x00, 0x01, 0xdd, 0x00, 0xdd, 0xdd, 0x06, 0x0e, 0x3a, 0x95, 0xb4, 0x82, 0x96, 0x93, 0x93, 0x8e, 0x8e, 0x93, 0x8e, 0x92, 0x93, 0x93, 0x8e, 0x96, 0x8e, 0x96, 0x8d, 0x96, 0x92, 0x93, 0x8d, 0x8b, 0x8f, 0x8b, 0x8e, 0x8d, 0xb9, 0x39, 0x0e, 0x01, 0x00, 0xe6, 0xe1, 0x00, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe4, 0xe4, 0xe4, 0xe0, 0x03, 0x03, 0x0a, 0x2c, 0x9d, 0x90, 0x8d, 0x93, 0x93, 0x92, 0x93, 0x8b, 0x9a, 0x8a, 0x9a, 0x92, 0x92, 0x81, 0xb7, 0x7f, 0x90, 0xc6, 0xd7, 0x58, 0x04, 0xdd, 0xe2, 0xe3, 0xde, 0xfd, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xe1, 0xe1, 0x02, 0x02, 0xdd, 0x00, 0x00, 0xe1, 0xe6, 0xe1, 0xe3, 0xe3, 0xe6, 0xe2, 0xe1, 0x00, 0x00, 0x05, 0xec, 0xfb, 0xdd, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0x06, 0xfc, 0xfb, 0xfb, 0xdd, 0x01, 0x01, 0x01, 0xdd, 0xe1, 0xdd, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xdf, 0xec, 0xe1, 0xe3, 0xe1, 0xe1, 0xec, 0x00, 0x06, 0x49, 0xda, 0x9d, 0x48, 0x42, 0x37, 0x2f, 0x27, 0x21, 0x21, 0x21, 0x21, 0x1f, 0x1f, 0x1d, 0x18, 0x21, 0x2f, 0x2b, 0x42, 0x66, 0x59, 0x68, 0x57, 0x64, 0x6a, 0x6a, 0x61, 0x71, 0x59, 0xb6, 0xd0, 0x2a, 0x03, 0xdd, 0xec, 0x05, 0xec, 0xfd, 0xfb, 0xdd, 0xdd, 0xdd, 0xe3, 0x00, 0xe3, 0xe7, 0xe1, 0xe4, 0xe1, 0xe6, 0xe6, 0xe3, 0x00, 0x00, 0xec, 0xe6, 0xe0, 0xe6, 0x05, 0xfb, 0xfb, 0xdd, 0xec, 0xe5, 0xe4, 0xe6, 0xdd, 0x07, 0x58, 0xd1, 0xaf, 0x7f, 0x98, 0x8b, 0x97, 0x8b, 0x8b, 0x9c, 0x95, 0x6e, 0x29, 0x0c, 0x03, 0xdd, 0xdd, 0x01, 0xfb, 0xfb, 0xdd, 0x00, 0x00, 0xdd, 0xdd, 0x03, 0x09, 0x19, 0x48, 0x95, 0x8f, 0x86, 0x93, 0x96, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x8e, 0x93, 0x93, 0x93, 0x8e, 0x96, 0x8e, 0x96, 0x8e, 0x93, 0x8e, 0x8b, 0x90, 0x8b, 0x8f, 0x93, 0x92, 0x82, 0x8f, 0x3f, 0x0e, 0x03, 0x00, 0x01, 0x00, 0xe1, 0xe3, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xe4, 0xe5, 0xe6, 0x00, 0xdd, 0x0c, 0x35, 0x80, 0x90, 0x8f, 0x96, 0x93, 0x92, 0x93, 0x93, 0x8d, 0x8b, 0x8b, 0x93, 0x88, 0x9b, 0x9f, 0x8d, 0x7e, 0xb6, 0xd2, 0x7c, 0x0e, 0xfb, 0x04, 0x00, 0xe1, 0xe3, 0xdd, 0xfb, 0xfc, 0x06, 0x06, 0xfc, 0xec, 0xec, 0xdd, 0x05, 0xe2, 0xde, 0xe2, 0xe6, 0xe3, 0xe3, 0xe6, 0xe0, 0xe3, 0xe3, 0xe3, 0xe1, 0xe6, 0x05, 0xec, 0xdd, 0xdd, 0x00, 0xdd, 0xfb, 0xfb, 0xfc, 0xdd, 0xdd, 0xfb, 0xfc, 0xfd, 0xfd, 0xfd, 0xfb, 0xec, 0x01, 0xec, 0xdd, 0xe1, 0x02, 0x02, 0xe6, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xdf, 0xe1, 0xe1, 0xe1, 0xec, 0xe1, 0xec, 0xe1, 0x04, 0x06, 0xb5, 0xc1, 0x3a, 0x25, 0x2b, 0x2b, 0x3f, 0x47, 0x79, 0xae, 0xc5, 0xce, 0xc5, 0xae, 0x50, 0x21, 0x16, 0x1a, 0x18, 0x1f, 0x39, 0x55, 0x65, 0x5f, 0x5e, 0x6a, 0x61, 0x6a, 0x68, 0x69, 0x80, 0xd6, 0x84, 0x07, 0x00, 0xdd, 0xfd, 0x00, 0xec, 0xe4, 0xec, 0xe0, 0xe6, 0xe7, 0xe7, 0xe4, 0xe3, 0xe4, 0xe0, 0xe0, 0xe1, 0xe6, 0x05, 0xe6, 0x02, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0x03, 0x03, 0xfd, 0xe6, 0xe4, 0xe4, 0xec, 0x00, 0x1e, 0xcc, 0xbe, 0xa0, 0x8b, 0x8f, 0x97, 0x8b, 0x97, 0x8b, 0x8d, 0xa0, 0xa7, 0x80, 0x3a, 0x19, 0x0a, 0x07, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0a, 0x16, 0x2c, 0x6c, 0xa6, 0xa5, 0x9e, 0x8d, 0x93, 0x96, 0x9b, 0x96, 0x93, 0x93, 0x93, 0x96, 0x93, 0x96, 0x93, 0x96, 0x96, 0x8e, 0x97, 0x8e, 0x96, 0x93, 0x96, 0x8f, 0x8f, 0x90, 0x97, 0x9b, 0x9b, 0x92, 0xa9, 0x9c, 0x47, 0x19, 0x0a, 0x03, 0xdd, 0xdd, 0x00, 0xdd, 0xdd, 0xec, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x03, 0x0e, 0x31, 0x80, 0xa7, 0x8f, 0x97, 0x8d, 0x9b, 0x93, 0x9b, 0x93, 0x97, 0x97, 0x8a, 0x9a, 0x92, 0x96, 0x9e, 0x7e, 0xac, 0xd7, 0xc1, 0x15, 0x00, 0xfb, 0xe0, 0xe7, 0xe0, 0xe3, 0xec, 0xfc, 0xfc, 0xfc, 0xfb, 0x02, 0xe3, 0x00, 0x01, 0x01, 0xdd, 0x00, 0x00, 0x00, 0xe3, 0xe6, 0xe0, 0xe0, 0xe4, 0xe3, 0xe1, 0xe6, 0xe3, 0x00, 0xe4, 0xe6, 0xe7, 0xe2, 0xe6, 0x00, 0xec, 0x00, 0xfd, 0xfb, 0xec, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xec, 0x05, 0x05, 0xe2, 0xfb, 0xe1, 0xdd, 0x00, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0xec, 0xe1, 0x01, 0xdd, 0x01, 0x75, 0xdc, 0xc8, 0xd2, 0xd1, 0xd4, 0xd8, 0xdb, 0xdb, 0xd5, 0xc4, 0xc1, 0xc4, 0xcc, 0xda, 0xc8, 0x3e, 0x12, 0x18, 0x18, 0x18, 0x39, 0x55, 0x5d, 0x70, 0x5c, 0x6a, 0x6a, 0x67, 0x69, 0x6c, 0xcf, 0xd0, 0x0d, 0xdd, 0x01, 0xe2, 0xe3, 0xe3, 0xe7, 0xe7, 0xe4, 0xe4, 0xe3, 0xe4, 0xe3, 0xe7, 0xe6, 0xdd, 0x00, 0x00, 0xdd, 0xdd, 0x04, 0x08, 0x0b, 0x10, 0x10, 0x10, 0x0d, 0x0a, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x49, 0xd2, 0xb9, 0x8d, 0x8f, 0x97, 0x8b, 0x8b, 0x9a, 0x9a, 0x8d, 0x86, 0x8f, 0xb9, 0xac, 0x5b, 0x31, 0x22, 0x0f, 0x0d, 0x0b, 0x0d, 0x0f, 0x13, 0x22, 0x35, 0x56, 0xa6, 0xa5, 0x97, 0x86, 0x96, 0x9e, 0x9a, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x8d, 0x8f, 0x8f, 0x8f, 0x97, 0x9b, 0x9b, 0xb1, 0x92, 0x98, 0x95, 0x79, 0x31, 0x1b, 0x0c, 0x09, 0x06, 0xfc, 0xfc, 0xfb, 0xdd, 0x01, 0x03, 0x09, 0x0a, 0x19, 0x47, 0x80, 0x90, 0x7f, 0x96, 0x97, 0x93, 0x9b, 0x9b, 0x96, 0x96, 0x8d, 0x97, 0x9a, 0x9a, 0xa4, 0x82, 0x8f, 0x95, 0xd6, 0xcc, 0x24, 0x00, 0x00, 0xdf, 0xe3, 0xe4, 0xe0, 0xe6, 0x02, 0xfb, 0x01, 0x01, 0x01, 0x05, 0xde, 0xde, 0xdd, 0x03, 0x03, 0xfd, 0x05, 0xe6, 0xe1, 0xe0, 0xe3, 0xe0, 0xe2, 0xe6, 0xe4, 0xec, 0xe1, 0xe3, 0xe3, 0xe4, 0xe3, 0xe3, 0xe3, 0xec, 0xe2, 0xfd, 0x00, 0x02, 0xe2, 0xe2, 0xe2, 0xe6, 0xe0, 0xe1, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x02, 0xdd, 0xec, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xe1, 0xe1, 0xec, 0xec, 0x02, 0x02, 0x01, 0x02, 0x05, 0x00, 0x10, 0x4d, 0x99, 0xc1, 0x94, 0x94, 0x40, 0x32, 0x24, 0x0f, 0x09, 0x07, 0x0a, 0x0d, 0x38, 0xdb, 0xc4, 0x23, 0x18, 0x26, 0x14, 0x1f, 0x3c, 0x5d, 0x70, 0x5e, 0x64, 0x6a, 0x5e, 0x5f, 0x55, 0xbf, 0xd7, 0x22, 0xdd, 0xfd, 0xe3, 0xe0, 0xe4, 0xe4, 0xe4, 0xe4, 0xe3, 0xe0, 0xe6, 0xdf, 0x01, 0xdd, 0x03, 0x09, 0x11, 0x2e, 0x49, 0x84, 0xb5, 0xc4, 0xcb, 0xd9, 0xd0, 0xc4, 0xaa, 0xaa, 0x63, 0x38, 0x1e, 0x0d, 0x04, 0x1b, 0xd0, 0xd7, 0x90, 0x8d, 0x8d, 0x97, 0x8b, 0x8a, 0x9a, 0x93, 0x93, 0x8d, 0x8d, 0x8f, 0x9c, 0x95, 0x95, 0x9d, 0x80, 0x6e, 0x5b, 0x56, 0x5b, 0x6e, 0x95, 0xbe, 0xb4, 0x8d, 0x82, 0x9f, 0x9f, 0x8a, 0x8b, 0x97, 0x9a, 0x96, 0x9f, 0x9a, 0x9f, 0x96, 0x9a, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x8d, 0x97, 0x8f, 0x8f, 0x97, 0x9b, 0x9b, 0x92, 0xa4, 0xa2, 0x90, 0x95, 0x9d, 0x6e, 0x47, 0x26, 0x20, 0x12, 0x0e, 0x0c, 0x0e, 0x13, 0x19, 0x2c, 0x47, 0x8c, 0x95, 0x8f, 0x8f, 0x98, 0x9a, 0x9a, 0x9a, 0x93, 0x9b, 0x96, 0x96, 0x97, 0x97, 0x9a, 0x96, 0xad, 0x76, 0x90, 0xd3, 0xd0, 0x32, 0x00, 0xe3, 0xdf, 0xea, 0xe6, 0x00, 0x08, 0x00, 0x00, 0xdd, 0x01, 0xdd, 0xdd, 0xdd, 0x00, 0xdd, 0x07, 0x04, 0x03, 0x03, 0x03, 0xdd, 0x00, 0x00, 0xe1, 0xe1, 0xe1, 0xe3, 0xe3, 0xe6, 0xe2, 0xe8, 0xe3, 0xe0, 0xdf, 0xdf, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x02, 0xe2, 0x05, 0x01, 0xec, 0xdd, 0x02, 0xec, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xec, 0xe1, 0xec, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x05, 0x00, 0xdd, 0x04, 0x09, 0x06, 0x07, 0xfc, 0x01, 0xdd, 0x01, 0x01, 0x01, 0x01, 0xdd, 0xfb, 0x40, 0xdc, 0x6f, 0x19, 0x18, 0x1a, 0x1d, 0x2f, 0x52, 0x77, 0x5e, 0x6d, 0x6a, 0x5e, 0x70, 0x59, 0xac, 0xd6, 0x2e, 0xdd, 0xfd, 0xe3, 0xe5, 0xe0, 0xe3, 0xe3, 0xe1, 0xe2, 0x02, 0x03, 0xdd, 0x01, 0x11, 0x49, 0xaa, 0xd6, 0xd2, 0xd4, 0xd4, 0xcf, 0xca, 0xc5, 0xc5, 0xbf, 0xc5, 0xd1, 0xd4, 0xd6, 0xd2, 0xd5, 0xc4, 0x7c, 0xaa, 0xd8, 0x80, 0x90, 0x8d, 0x97, 0x9a, 0x88, 0x9b, 0xa4, 0x93, 0x9b, 0xa2, 0x9e, 0x8d, 0x85, 0xa3, 0xa6, 0x98, 0x9c, 0x98, 0x8f, 0x9c, 0x8f, 0x8f, 0x8f, 0x8d, 0x93, 0x8e, 0x92, 0xa4, 0xa4, 0x9a, 0x97, 0x97, 0x8d, 0x9a, 0x97, 0x9f, 0x9e, 0x9e, 0x97, 0x9a, 0x97, 0x96, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x96, 0x93, 0x9b, 0x9f, 0x97, 0x8f, 0x85, 0x9c, 0xa6, 0xa6, 0xb3, 0x9d, 0x80, 0x6e, 0x6e, 0x79, 0x6e, 0x8c, 0x87, 0xb3, 0xaf, 0x8f, 0x8d, 0x9e, 0xa9, 0x8b, 0x9a, 0x9a, 0x9b, 0x9b, 0x96, 0x96, 0x98, 0x97, 0x97, 0x8a, 0xa2, 0x8b, 0xc6, 0xd6, 0x4d, 0x06, 0x05, 0x05, 0x00, 0xdd, 0xdd, 0x07, 0x0f, 0x13, 0x28, 0x2a, 0x32, 0x2e, 0x2a, 0x28, 0x1e, 0x11, 0x07, 0x03, 0x01, 0x01, 0x03, 0x03, 0x04, 0xe2, 0x05, 0xe3, 0x00, 0xe1, 0x05, 0xec, 0x00, 0x00, 0xdd, 0x03, 0xdd, 0x03, 0x07, 0x0f, 0x15, 0x1e, 0x24, 0x1e, 0x11, 0x0f, 0x09, 0x07, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x02, 0x00, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xec, 0xec, 0xec, 0x01, 0xfb, 0x01, 0x01, 0xdf, 0x00, 0xe8, 0xe2, 0xe6, 0xe1, 0xdd, 0x00, 0xfb, 0xfd, 0x01, 0xdd, 0x00, 0x05, 0xe6, 0xfb, 0xdd, 0xdd, 0x09, 0xb0, 0xcc, 0x2c, 0x12, 0x1a, 0x21, 0x25, 0x4c, 0x77, 0x5e, 0x73, 0x6a, 0x5c, 0x7b, 0x59, 0x95, 0xd4, 0x3b, 0x03, 0x02, 0xe4, 0xe4, 0xe6, 0x02, 0x02, 0x03, 0xdd, 0x03, 0x09, 0x11, 0x94, 0xbd, 0xcf, 0xc6, 0x80, 0x55, 0x4a, 0x51, 0x59, 0x55, 0x66, 0x90, 0xa6, 0xa5, 0xa5, 0xa6, 0xa7, 0xb6, 0xc7, 0xd6, 0xd2, 0xd6, 0xd1, 0x7e, 0x8f, 0x8f, 0x9e, 0x96, 0x92, 0x9b, 0xa4, 0x92, 0x96, 0x96, 0x97, 0x97, 0xa2, 0x9e, 0x93, 0x7b, 0x93, 0x9a, 0x9a, 0x97, 0xa3, 0xa3, 0x97, 0x7f, 0x8b, 0xb2, 0xb1, 0x93, 0x8e, 0xa4, 0xb1, 0x88, 0x96, 0x8d, 0x9a, 0x97, 0x9e, 0x9a, 0x97, 0x96, 0x97, 0x9a, 0x96, 0x9a, 0x96, 0x9a, 0x96, 0x9a, 0x96, 0x97, 0x9a, 0x8d, 0x97, 0x8e, 0x97, 0x8e, 0xaf, 0x8b, 0x8b, 0xa3, 0xa3, 0x86, 0x88, 0x9f, 0x8b, 0x85, 0x90, 0x95, 0x95, 0x90, 0x95, 0x98, 0xa0, 0x8e, 0x89, 0x9b, 0x9f, 0x9e, 0x8b, 0x8b, 0x9a, 0x9a, 0x9b, 0x9f, 0x96, 0x9e, 0x97, 0x97, 0x97, 0x8a, 0x96, 0x9c, 0xd1, 0xc5, 0x11, 0xdd, 0xdd, 0x03, 0x1e, 0x2e, 0x6f, 0xc8, 0xc5, 0xd6, 0xce, 0xd4, 0xd6, 0xd2, 0xd2, 0xce, 0xcf, 0xbd, 0xc1, 0x75, 0x2a, 0x11, 0x06, 0x00, 0xdd, 0xfd, 0x01, 0xdd, 0x02, 0xe2, 0xfd, 0x00, 0xdd, 0x06, 0x07, 0x13, 0x3b, 0x84, 0xc1, 0xd8, 0xda, 0xd7, 0xd7, 0xd7, 0xda, 0xd8, 0xcc, 0x94, 0x46, 0x32, 0x0d, 0x08, 0x01, 0x00, 0x01, 0xe6, 0x05, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xec, 0xec, 0xec, 0xfb, 0x01, 0x01, 0x01, 0x02, 0xe6, 0x00, 0xe0, 0xe3, 0xe7, 0xe6, 0xe3, 0xe1, 0x02, 0x02, 0xec, 0xec, 0xe3, 0xe1, 0xe0, 0xe2, 0x08, 0x01, 0x40, 0xd5, 0x3e, 0x1c, 0x18, 0x1a, 0x1f, 0x45, 0x77, 0x67, 0x71, 0x6d, 0x5c, 0x78, 0x69, 0x90, 0xd4, 0x3b, 0x06, 0x00, 0xe7, 0xe4, 0xe4, 0xdd, 0x03, 0x03, 0x03, 0x0e, 0x49, 0xda, 0xc5, 0x9d, 0x48, 0x34, 0x3c, 0x42, 0x44, 0x44, 0x3d, 0x3d, 0x4c, 0x76, 0xab, 0xb8, 0xad, 0xa2, 0xa0, 0xa7, 0x80, 0xb6, 0xc6, 0xd1, 0x9c, 0xa5, 0x8f, 0x98, 0x9e, 0x96, 0x89, 0x9b, 0xb1, 0x93, 0x96, 0x97, 0x97, 0x97, 0x9a, 0x93, 0x9b, 0xa4, 0x92, 0x93, 0x9a, 0x9a, 0xa3, 0xb8, 0xa5, 0x8f, 0x9c, 0x8b, 0x8b, 0x9e, 0x9b, 0x89, 0x89, 0x9b, 0x8e, 0x97, 0x97, 0x97, 0x9e, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9e, 0x97, 0x96, 0x9e, 0x96, 0x98, 0x97, 0x96, 0x96, 0x93, 0x8d, 0x8b, 0x8b, 0x8f, 0x97, 0xa3, 0x97, 0x93, 0x9f, 0xa4, 0x9b, 0x9e, 0x9a, 0x8b, 0x8f, 0x8f, 0x8f, 0x97, 0x9f, 0x93, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0x97, 0x9a, 0x9a, 0x9a, 0x9b, 0x96, 0x9e, 0x97, 0x97, 0x9a, 0x97, 0x97, 0xb4, 0xd1, 0x6f, 0x03, 0x0f, 0x49, 0xaa, 0xd2, 0xd6, 0xd1, 0xc6, 0xcd, 0xa7, 0xbc, 0xac, 0x80, 0x48, 0x3c, 0x48, 0x4e, 0x4f, 0x79, 0x94, 0xc8, 0xc8, 0x7c, 0x22, 0x09, 0x01, 0x04, 0x03, 0xfc, 0x05, 0x00, 0xdd, 0x0d, 0x24, 0xa1, 0xcf, 0xd6, 0xd4, 0xca, 0xb6, 0xb6, 0xac, 0xac, 0x9d, 0xac, 0xb6, 0xca, 0xd3, 0xd4, 0xd6, 0xd5, 0x75, 0x24, 0x0b, 0xdd, 0xdd, 0xdd, 0x01, 0x02, 0xe1, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0xec, 0x02, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xe1, 0xe1, 0x02, 0x01, 0x01, 0x01, 0xe2, 0xe1, 0xe4, 0xe4, 0xe0, 0xde, 0xdd, 0x22, 0xd8, 0x5b, 0x18, 0x17, 0x1a, 0x1f, 0x30, 0x82, 0x6b, 0x68, 0x68, 0x81, 0x6d, 0x71, 0x90, 0xd6, 0x4d, 0x04, 0x00, 0x05, 0xe0, 0xe4, 0xe8, 0x00, 0x07, 0x22, 0xc5, 0xd8, 0x87, 0x3f, 0x3c, 0x3c, 0x43, 0x42, 0x45, 0x44, 0x44, 0x4c, 0x45, 0x3d, 0x59, 0x8d, 0xb2, 0x9f, 0xb1, 0xa9, 0xaf, 0x90, 0xc6, 0xd3, 0xc3, 0x9c, 0x98, 0x8d, 0x9a, 0xa2, 0xa2, 0x8b, 0x70, 0x52, 0x52, 0x45, 0x51, 0x5d, 0x76, 0x97, 0xad, 0xa4, 0x9b, 0x9b, 0x93, 0xa4, 0x9a, 0x8f, 0xc0, 0xcd, 0xa7, 0xa6, 0x87, 0x8f, 0x98, 0xa4, 0xa4, 0x92, 0x92, 0x82, 0x5f, 0x59, 0x77, 0x8f, 0xab, 0x98, 0x8d, 0x98, 0xa0, 0xa0, 0xa0, 0x98, 0x98, 0x98, 0xa0, 0xa5, 0x9c, 0x77, 0x62, 0x4c, 0x57, 0x7f, 0xa0, 0x97, 0xa3, 0xa4, 0x96, 0x96, 0xa0, 0xb4, 0xc0, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x9f, 0x9b, 0x92, 0x93, 0x9b, 0x9a, 0x9a, 0x8b, 0x9a, 0x8e, 0x96, 0x96, 0x9e, 0x96, 0x9a, 0x9a, 0x9a, 0xa2, 0x8b, 0xb4, 0xd1, 0xbf, 0x91, 0xce, 0xd3, 0xcd, 0xc3, 0xb3, 0x9c, 0x9c, 0x9c, 0xa5, 0xa0, 0x85, 0x4c, 0x3c, 0x42, 0x4b, 0x3c, 0x3c, 0x39, 0x3c, 0x34, 0x4e, 0xb3, 0xd1, 0x91, 0x2c, 0xfc, 0xfb, 0x08, 0xdd, 0x04, 0x2a, 0x94, 0xd8, 0xd1, 0xc3, 0x90, 0x72, 0x59, 0x52, 0x52, 0x57, 0x52, 0x5e, 0x52, 0x52, 0x69, 0x65, 0x76, 0xa6, 0xc6, 0xd4, 0xda, 0xc1, 0x32, 0x09, 0xdd, 0x05, 0xde, 0x00, 0xdd, 0xe6, 0x00, 0x00, 0xe6, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0xfb, 0x02, 0xe1, 0xe4, 0xe5, 0xe5, 0xdf, 0x01, 0x13, 0xd6, 0x91, 0x14, 0x1c, 0x1d, 0x1d, 0x2f, 0x82, 0x6b, 0x69, 0x70, 0x81, 0x6d, 0x67, 0x85, 0xd6, 0x4d, 0x03, 0xdd, 0xfd, 0xec, 0xe0, 0xdf, 0x06, 0x28, 0xd8, 0xd1, 0x48, 0x4b, 0x4b, 0x4b, 0x43, 0x42, 0x42, 0x45, 0x45, 0x4c, 0x4c, 0x3d, 0x3d, 0x4b, 0xa0, 0xb8, 0xb1, 0xa4, 0xa9, 0xaf, 0x90, 0xcd, 0xd1, 0xb9, 0x9c, 0x97, 0xa2, 0x9e, 0x86, 0x52, 0x45, 0x44, 0x42, 0x3d, 0x3d, 0x42, 0x3d, 0x3d, 0x52, 0x70, 0x86, 0xa4, 0x9b, 0x93, 0x9a, 0xa0, 0x8f, 0xc3, 0xd1, 0xc6, 0xb6, 0x9d, 0x90, 0x90, 0x97, 0x9b, 0x92, 0x9b, 0xa9, 0x8f, 0x5d, 0x51, 0x51, 0x51, 0x59, 0x59, 0x66, 0x72, 0x72, 0x72, 0x65, 0x66, 0x65, 0x66, 0x51, 0x51, 0x52, 0x5d, 0x6b, 0x8d, 0x8f, 0xa3, 0x8f, 0x98, 0x8d, 0x8d, 0xa5, 0xbe, 0xc6, 0xc3, 0x8f, 0x9a, 0x96, 0x9a, 0x96, 0x9a, 0x96, 0x96, 0xa2, 0x9a, 0x96, 0x8a, 0x8e, 0x9a, 0xad, 0xad, 0xa9, 0xa2, 0x9e, 0x96, 0x96, 0x8d, 0x9a, 0x96, 0x8a, 0xa2, 0x8f, 0xa5, 0xd1, 0xd1, 0xc5, 0xca, 0xb9, 0xaf, 0xaf, 0xa3, 0xa3, 0xa3, 0xa9, 0xab, 0xb8, 0x8d, 0x4c, 0x37, 0x44, 0x45, 0x3d, 0x42, 0x42, 0x4b, 0x45, 0x3d, 0x37, 0x42, 0x95, 0xd6, 0x94, 0x13, 0xfb, 0x0c, 0x63, 0xd8, 0xd4, 0x95, 0x66, 0x52, 0x4c, 0x52, 0x68, 0x71, 0x6d, 0x6d, 0x5c, 0x54, 0x5c, 0x54, 0x54, 0x5f, 0x70, 0x52, 0x66, 0x87, 0x9d, 0xcf, 0xda, 0xb5, 0x24, 0xdd, 0x00, 0xdd, 0xde, 0x00, 0xe3, 0xe6, 0xe3, 0xe6, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x05, 0x01, 0xec, 0xe1, 0xe0, 0xe0, 0xe0, 0x03, 0xdd, 0x23, 0xce, 0xba, 0x2d, 0x12, 0x23, 0x18, 0x2b, 0x77, 0x6b, 0x5f, 0x68, 0x7a, 0x6d, 0x5e, 0x8f, 0xd7, 0x4d, 0xdd, 0x05, 0xfb, 0x01, 0x05, 0xdd, 0x40, 0xdb, 0xd3, 0x95, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x44, 0x44, 0x3d, 0x44, 0x45, 0x65, 0xa5, 0xb2, 0xa9, 0x9f, 0xa9, 0xaf, 0xa6, 0xcd, 0xcd, 0xb3, 0x8f, 0x98, 0x9e, 0x86, 0x5f, 0x3d, 0x37, 0x3d, 0x3d, 0x37, 0x42, 0x3d, 0x37, 0x3d, 0x3d, 0x44, 0x5f, 0x9a, 0xa4, 0x93, 0x9a, 0xa0, 0x8f, 0xb9, 0xd1, 0xd6, 0xd1, 0xc7, 0xac, 0x9d, 0x9c, 0x8f, 0x96, 0x96, 0xa5, 0x98, 0x90, 0x72, 0x66, 0x51, 0x51, 0x4b, 0x4a, 0x42, 0x43, 0x42, 0x43, 0x4a, 0x43, 0x42, 0x4c, 0x52, 0x69, 0x82, 0x98, 0x98, 0x98, 0x8f, 0x90, 0x95, 0x95, 0xac, 0xc6, 0xd3, 0xca, 0xbc, 0x98, 0x97, 0x96, 0x97, 0x96, 0x9a, 0x96, 0x9a, 0x96, 0x9e, 0xa2, 0xa9, 0x9a, 0x8d, 0x86, 0x8b, 0x8e, 0x8d, 0x96, 0x97, 0x9a, 0x9a, 0x9a, 0x96, 0x8a, 0xb2, 0x97, 0x90, 0xcd, 0xd3, 0xca, 0x9d, 0xa6, 0xa3, 0xa3, 0xa3, 0xa3, 0xab, 0xa9, 0xa9, 0xb2, 0x97, 0x52, 0x44, 0x44, 0x42, 0x45, 0x4c, 0x42, 0x37, 0x42, 0x52, 0x45, 0x30, 0x39, 0x41, 0xd2, 0x7c, 0x49, 0x94, 0xd6, 0xbf, 0x80, 0x59, 0x52, 0x5f, 0x5e, 0x5f, 0x5c, 0x4c, 0x54, 0x57, 0x68, 0x52, 0x70, 0x97, 0x69, 0x59, 0x65, 0x59, 0x59, 0x51, 0x55, 0x6c, 0xca, 0xd6, 0xc1, 0x49, 0x09, 0x03, 0x02, 0xe3, 0xe6, 0xe0, 0xe3, 0xe0, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x01, 0xdd, 0xec, 0xe1, 0xe0, 0xe3, 0xdd, 0x38, 0xd0, 0xc5, 0xc7, 0xd6, 0x50, 0x14, 0x18, 0x2b, 0x70, 0x6b, 0x69, 0x68, 0x78, 0x73, 0x6b, 0x90, 0xd7, 0x4d, 0x00, 0x05, 0xdd, 0xfb, 0x03, 0x32, 0xda, 0xd6, 0x80, 0x55, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x44, 0x3d, 0x3d, 0x52, 0x72, 0x9c, 0xaf, 0xa3, 0x9f, 0xad, 0xa9, 0xaf, 0xb3, 0xcd, 0xd1, 0x9c, 0x90, 0x9e, 0x97, 0x68, 0x44, 0x3d, 0x44, 0x45, 0x45, 0x42, 0x45, 0x45, 0x44, 0x3d, 0x44, 0x3d, 0x4c, 0x83, 0xa9, 0x9a, 0x9a, 0x97, 0x8f, 0xa7, 0xc6, 0xd6, 0xd7, 0xd6, 0xce, 0xbf, 0xb6, 0xac, 0x9c, 0x9c, 0x8f, 0x9c, 0xb4, 0xb4, 0xa5, 0x90, 0x7e, 0x7e, 0x7e, 0x72, 0x66, 0x72, 0x7e, 0x72, 0x7e, 0x72, 0x98, 0x96, 0x98, 0x98, 0x9c, 0x9c, 0x9c, 0x95, 0xac, 0xb6, 0xc5, 0xcf, 0xd8, 0xd7, 0xca, 0x95, 0x98, 0x9a, 0x96, 0x9a, 0x9a, 0x96, 0x9a, 0x97, 0x9a, 0x97, 0x8a, 0x86, 0x76, 0x57, 0x4c, 0x4c, 0x4c, 0x52, 0x69, 0x7b, 0x9e, 0xa2, 0x9e, 0x9a, 0x9a, 0xab, 0x98, 0x8f, 0xbc, 0xd1, 0xbf, 0x80, 0xa5, 0xaf, 0xab, 0xaf, 0xab, 0xab, 0xa2, 0xa2, 0xa2, 0xab, 0x8d, 0x5d, 0x45, 0x3d, 0x3d, 0x45, 0x4b, 0x45, 0x3d, 0x37, 0x37, 0x42, 0x39, 0x3f, 0x5b, 0xce, 0xd8, 0xd6, 0xb6, 0x4e, 0x51, 0x5f, 0x6b, 0x5c, 0x5e, 0x5e, 0x5f, 0x68, 0x5d, 0x69, 0x72, 0x51, 0x4b, 0x43, 0x3c, 0x39, 0x43, 0x4a, 0x4a, 0x59, 0x51, 0x55, 0x6c, 0x95, 0xcf, 0xda, 0x4d, 0x0d, 0x00, 0xe6, 0xe2, 0xe3, 0xdf, 0xe6, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe6, 0xfb, 0x01, 0xec, 0xec, 0xe1, 0x00, 0x15, 0xd9, 0x91, 0x3a, 0x2d, 0x8c, 0xd7, 0x26, 0x16, 0x27, 0x65, 0x6b, 0x69, 0x68, 0x73, 0x73, 0x5e, 0xa7, 0xd8, 0x38, 0xdd, 0x05, 0x00, 0x06, 0x22, 0xda, 0xd6, 0x6e, 0xb9, 0xa5, 0x4c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x44, 0x44, 0x4c, 0x44, 0x52, 0x7f, 0xaf, 0xaf, 0xb8, 0xa0, 0x9e, 0xb1, 0xab, 0xaf, 0xb9, 0xd1, 0xc6, 0x95, 0x98, 0x98, 0xa9, 0x57, 0x3d, 0x3d, 0x45, 0x44, 0x3d, 0x3d, 0x3d, 0x3d, 0x44, 0x44, 0x44, 0x3d, 0x44, 0x7b, 0x9e, 0x9a, 0x97, 0xa2, 0x98, 0x8f, 0xbc, 0xd4, 0xda, 0xda, 0xda, 0xd5, 0xce, 0xc7, 0xbf, 0xb3, 0xb4, 0xa5, 0xa5, 0xa0, 0x9c, 0xaf, 0xb4, 0xb4, 0x9c, 0x98, 0x8f, 0x8f, 0x98, 0x9c, 0x98, 0x98, 0xa0, 0xaf, 0xa6, 0xa7, 0x95, 0xac, 0xb6, 0xc6, 0xcf, 0xd2, 0xda, 0xdb, 0xdb, 0xd7, 0xba, 0x87, 0x98, 0x9f, 0x9a, 0x96, 0x9a, 0x97, 0x9a, 0x97, 0xa9, 0x76, 0x4c, 0x44, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x44, 0x52, 0x76, 0x8b, 0x9a, 0x9a, 0x9f, 0x9a, 0x97, 0x90, 0xb4, 0xd1, 0xca, 0xac, 0x9c, 0xa2, 0xa3, 0xa9, 0xab, 0xa9, 0xb2, 0xa9, 0xa9, 0xb7, 0xb2, 0x8b, 0x68, 0x45, 0x3d, 0x3d, 0x33, 0x3d, 0x45, 0x44, 0x45, 0x42, 0x4b, 0x39, 0x80, 0xd3, 0xbf, 0x87, 0x59, 0x5d, 0x7d, 0x5a, 0x6a, 0x53, 0x53, 0x57, 0x6b, 0x69, 0x51, 0x3c, 0x2f, 0x2f, 0x27, 0x1d, 0x21, 0x25, 0x1a, 0x18, 0x18, 0x1d, 0x25, 0x2b, 0x2f, 0x43, 0x80, 0xbd, 0xda, 0x4d, 0x07, 0xdd, 0x05, 0x00, 0xfd, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0xe1, 0x02, 0xfb, 0xec, 0xdd, 0xdd, 0x04, 0x75, 0xc4, 0x91, 0x8c, 0x56, 0x3f, 0xc7, 0x50, 0x16, 0x27, 0x69, 0x6b, 0x70, 0x68, 0x7d, 0x73, 0x62, 0xa7, 0xda, 0x2a, 0x03, 0xdd, 0x00, 0x11, 0xc8, 0xd6, 0x9d, 0xa6, 0xb9, 0xad, 0x9f, 0x5e, 0x57, 0x4c, 0x4c, 0x4c, 0x4c, 0x57, 0x6b, 0x82, 0x9f, 0xb2, 0xa3, 0x98, 0xaf, 0xb2, 0xad, 0xb1, 0xa3, 0xa5, 0xc3, 0xd1, 0xc3, 0x90, 0x8f, 0xa0, 0xa2, 0x5f, 0x3d, 0x3d, 0x44, 0x3d, 0x3d, 0x42, 0x3d, 0x42, 0x3d, 0x3d, 0x3d, 0x3d, 0x4c, 0x7b, 0x97, 0x97, 0x9a, 0x9e, 0xab, 0x98, 0xac, 0xd3, 0xd8, 0xdb, 0xdc, 0xdc, 0xdb, 0xd8, 0xd2, 0xcf, 0xcd, 0xbe, 0xbe, 0xa7, 0xa7, 0xa7, 0xb9, 0xa7, 0xbe, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xa6, 0xb3, 0xbf, 0xbf, 0xbf, 0xc7, 0xcf, 0xd6, 0xd8, 0xdb, 0xdc, 0xdc, 0xda, 0xc5, 0xac, 0x9c, 0x97, 0x9e, 0x9f, 0x9a, 0x9e, 0x9a, 0x9e, 0x97, 0x86, 0x52, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x44, 0x44, 0x3d, 0x37, 0x3d, 0x44, 0x5f, 0x8b, 0x9a, 0x9e, 0x8d, 0x97, 0x9c, 0x90, 0xc6, 0xd1, 0xbc, 0xa5, 0xab, 0xa2, 0xa9, 0x9e, 0xa9, 0xa9, 0xad, 0xab, 0xb2, 0xa2, 0xa2, 0xb8, 0x9a, 0x69, 0x52, 0x5d, 0x45, 0x3d, 0x37, 0x3d, 0x3c, 0x4b, 0x6c, 0xd1, 0xd1, 0xa7, 0x51, 0x52, 0x53, 0x74, 0x5a, 0x61, 0x73, 0x7d, 0x62, 0x44, 0x2f, 0x25, 0x1d, 0x16, 0x18, 0x1a, 0x1f, 0x1d, 0x12, 0x14, 0x26, 0x36, 0x35, 0x2b, 0x25, 0x1a, 0x1f, 0x2d, 0x48, 0xc1, 0xdb, 0x32, 0x01, 0x01, 0x01, 0x06, 0xdd, 0x01, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe3, 0xdd, 0x05, 0xfb, 0x00, 0x04, 0x08, 0xc4, 0xb0, 0xd6, 0xca, 0x41, 0x48, 0xce, 0x5b, 0x16, 0x25, 0x65, 0x77, 0x70, 0x5e, 0x81, 0x73, 0x77, 0xb3, 0xda, 0x15, 0x03, 0xdd, 0x0b, 0x4d, 0xd6, 0xc6, 0x95, 0xa5, 0xb8, 0x96, 0xa4, 0xc2, 0xa4, 0x9f, 0x9a, 0x8d, 0x9e, 0xab, 0xb7, 0xc2, 0xb1, 0xb7, 0xa3, 0x97, 0xa3, 0xb2, 0xad, 0xad, 0xa9, 0xa3, 0xb9, 0xd1, 0xc3, 0x87, 0xa0, 0x97, 0x9e, 0x82, 0x57, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x3d, 0x4c, 0x4c, 0x62, 0x8b, 0x97, 0x9e, 0x96, 0x9f, 0xb1, 0x98, 0x9c, 0xbf, 0xd8, 0xdb, 0xdc, 0xff, 0xdc, 0xdc, 0xd9, 0xd8, 0xd6, 0xd4, 0xd4, 0xcf, 0xcf, 0xc7, 0xbf, 0xbf, 0xba, 0xb6, 0xba, 0xa8, 0xba, 0xb6, 0xba, 0xbf, 0xc5, 0xce, 0xd2, 0xd5, 0xd8, 0xda, 0xda, 0xda, 0xdc, 0xdb, 0xdc, 0xdb, 0xd7, 0xb6, 0x9c, 0xa9, 0x9e, 0x9f, 0x9a, 0x9e, 0x9a, 0x9e, 0x97, 0x9e, 0x4c, 0x44, 0x3d, 0x45, 0x45, 0x45, 0x3d, 0x42, 0x44, 0x44, 0x3d, 0x3d, 0x37, 0x4c, 0x76, 0xad, 0xa2, 0x96, 0xab, 0xa0, 0x87, 0xc3, 0xd1, 0xac, 0xaf, 0xb2, 0xb2, 0xb2, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa4, 0x97, 0xa2, 0xc2, 0xc2, 0xa2, 0x97, 0x82, 0x70, 0x76, 0x8b, 0x65, 0x51, 0x90, 0xcd, 0xcd, 0x8f, 0x65, 0x57, 0x67, 0x74, 0x74, 0x61, 0x53, 0x62, 0x57, 0x3d, 0x27, 0x1f, 0x1a, 0x1a, 0x20, 0x14, 0x17, 0x20, 0x12, 0x1c, 0x4f, 0xc5, 0xd7, 0xd6, 0xd4, 0xa8, 0x41, 0x1a, 0x14, 0x1d, 0x31, 0xcc, 0xc4, 0x1e, 0x01, 0x01, 0x01, 0xdd, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe6, 0xe3, 0x00, 0x05, 0xfb, 0x00, 0x06, 0x0d, 0xcb, 0xaa, 0xd4, 0xd6, 0x4f, 0x2d, 0xd2, 0x50, 0x14, 0x25, 0x65, 0x6b, 0x7b, 0x68, 0x7a, 0x7d, 0x7f, 0xfe, 0xd5, 0x0d, 0x00, 0x03, 0x15, 0xdb, 0xd1, 0x90, 0xb4, 0xaf, 0x8d, 0xc2, 0xb1, 0x93, 0xa4, 0xad, 0xa9, 0xb2, 0xab, 0xa9, 0xa9, 0x9f, 0x96, 0xb1, 0xb2, 0x9e, 0xa3, 0xa2, 0xa4, 0xb1, 0xad, 0xa0, 0xc3, 0xcd, 0xc3, 0x85, 0xa0, 0x97, 0x96, 0xb2, 0x97, 0x52, 0x3d, 0x44, 0x44, 0x37, 0x37, 0x44, 0x3d, 0x3d, 0x52, 0x7b, 0x97, 0xad, 0x97, 0xa9, 0x93, 0x93, 0xb1, 0x96, 0x87, 0xac, 0xd7, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xd9, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd0, 0xd8, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc, 0xff, 0xff, 0xd9, 0xdc, 0xdb, 0xd4, 0xa7, 0x8d, 0x9f, 0x9f, 0x96, 0x9e, 0x96, 0x9e, 0x9a, 0x9e, 0x97, 0x4c, 0x44, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x45, 0x37, 0x44, 0x45, 0x44, 0x3d, 0x44, 0x7b, 0xb2, 0x9a, 0x96, 0xaf, 0xa0, 0x7e, 0xcd, 0xd3, 0xb3, 0x98, 0x9e, 0xa2, 0xa9, 0xad, 0xa9, 0xa9, 0x9f, 0xa2, 0xb2, 0xa2, 0x96, 0x9e, 0x96, 0x97, 0xad, 0xb7, 0xa4, 0x96, 0xab, 0x9c, 0x9c, 0xb9, 0xcd, 0xc9, 0x5d, 0x5f, 0x54, 0x5a, 0x6a, 0x5a, 0x61, 0x82, 0x4c, 0x2b, 0x1d, 0x17, 0x1d, 0x1d, 0x1c, 0x1c, 0x14, 0x20, 0x17, 0x12, 0x5b, 0xd7, 0xa1, 0x47, 0x31, 0x5b, 0xcf, 0xc7, 0x3f, 0x1a, 0x1a, 0x16, 0x31, 0xdc, 0x75, 0x06, 0x00, 0xdf, 0xe0, 0xdf, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe3, 0xe3, 0xdd, 0x05, 0xfb, 0xfc, 0xfc, 0x09, 0xb5, 0x94, 0x6e, 0x8c, 0x36, 0x4f, 0xd7, 0x31, 0x16, 0x25, 0x65, 0x7d, 0x70, 0x78, 0x89, 0x6d, 0x72, 0xd1, 0xb5, 0x06, 0xdd, 0x09, 0xc4, 0xd6, 0x9d, 0xaf, 0xa5, 0xa9, 0xa2, 0xa4, 0xa4, 0xb1, 0xa2, 0xa2, 0xa9, 0xa3, 0xa0, 0x9e, 0xa0, 0xad, 0xb1, 0xa4, 0x9f, 0xab, 0xad, 0xa9, 0xa4, 0xad, 0xb1, 0xa3, 0xb9, 0xcd, 0xcd, 0x9c, 0x98, 0x96, 0x9e, 0x96, 0x9e, 0x97, 0x8d, 0x7f, 0x69, 0x69, 0x5d, 0x5d, 0x69, 0x82, 0x8b, 0x97, 0xa2, 0xa9, 0x97, 0x9a, 0xa4, 0x9b, 0x9b, 0x9f, 0x98, 0x95, 0xba, 0xda, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xd9, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xff, 0xff, 0xdc, 0xdc, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd6, 0xbc, 0x8f, 0x96, 0xa4, 0x9f, 0x9e, 0x9f, 0x9e, 0x9a, 0x9e, 0x97, 0x9e, 0x5d, 0x45, 0x3d, 0x3d, 0x45, 0x44, 0x42, 0x45, 0x44, 0x45, 0x4c, 0x37, 0x3d, 0x52, 0x8b, 0xad, 0x96, 0x97, 0xb2, 0x98, 0x90, 0xc9, 0xd3, 0xb9, 0xa0, 0xad, 0xa9, 0xad, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x9e, 0xa2, 0x96, 0x9f, 0xa4, 0x92, 0x96, 0xaf, 0x72, 0x90, 0xd1, 0xc9, 0x7f, 0x4c, 0x6b, 0x67, 0x53, 0x6a, 0x5a, 0x5e, 0x51, 0x2f, 0x1a, 0x14, 0x21, 0x1d, 0x12, 0x14, 0x12, 0x1c, 0x19, 0x12, 0x23, 0xc7, 0x79, 0x35, 0x41, 0x6e, 0x41, 0x3a, 0xbf, 0x8c, 0x18, 0x18, 0x17, 0x20, 0x7c, 0xd9, 0x15, 0x00, 0xe5, 0xe4, 0xe0, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0xe3, 0x02, 0xfb, 0xfb, 0xdd, 0xfb, 0x04, 0x75, 0xc8, 0x41, 0x27, 0x36, 0xba, 0xba, 0x26, 0x17, 0x27, 0x72, 0x71, 0x70, 0x78, 0x83, 0x6b, 0x8f, 0xd3, 0x4d, 0x01, 0x03, 0x2a, 0xd0, 0xc7, 0xa6, 0xaf, 0xab, 0xab, 0xa9, 0xad, 0xb2, 0xad, 0xb2, 0xab, 0xa3, 0xa3, 0xa0, 0xa3, 0xa3, 0xa9, 0xb1, 0xb1, 0xad, 0xb2, 0xb2, 0xa9, 0xa4, 0xb1, 0x9f, 0xa0, 0xa6, 0xcd, 0xcd, 0xa6, 0x97, 0x97, 0xa2, 0xa2, 0xa9, 0xa2, 0xa2, 0x9e, 0x97, 0x97, 0x97, 0x9e, 0x9e, 0xa3, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0x9f, 0x9b, 0xa4, 0x9b, 0xa4, 0xa0, 0x9c, 0xa8, 0xce, 0xdb, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xc7, 0xa6, 0x98, 0x9f, 0xa4, 0x9f, 0x9f, 0x9e, 0x9a, 0xa2, 0x9e, 0x9e, 0x9e, 0x8b, 0x5d, 0x45, 0x44, 0x3d, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x52, 0x8b, 0x9e, 0x9a, 0xa2, 0x96, 0xab, 0x98, 0x8f, 0xc9, 0xd1, 0xbe, 0xa3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x9f, 0xa2, 0x9f, 0x9e, 0x9b, 0x9b, 0x9b, 0x96, 0x98, 0x85, 0xb3, 0xcd, 0xc0, 0x69, 0x57, 0x54, 0x5c, 0x54, 0x5e, 0x70, 0x4c, 0x2b, 0x1a, 0x21, 0x1d, 0x12, 0x17, 0x23, 0x35, 0x28, 0x20, 0x2e, 0x6f, 0xce, 0xd7, 0xbd, 0x2d, 0xbf, 0xd3, 0xba, 0x3a, 0x91, 0xce, 0x29, 0x17, 0x1d, 0x12, 0x3e, 0xd5, 0x38, 0xdf, 0xe9, 0xe5, 0xe0, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe6, 0xe6, 0x02, 0xfb, 0xfb, 0xdd, 0xdd, 0xfc, 0x11, 0xcc, 0x91, 0xa8, 0xca, 0xcf, 0x35, 0x1c, 0x16, 0x2b, 0x77, 0x7d, 0x78, 0x78, 0x83, 0x62, 0xb4, 0xd4, 0x2a, 0xdd, 0x0a, 0x99, 0xd7, 0xac, 0xa5, 0xa0, 0xab, 0xab, 0xb2, 0xb8, 0xb8, 0xb8, 0xbb, 0xb8, 0xab, 0xa3, 0xa3, 0xa3, 0xa0, 0xab, 0x9b, 0xa4, 0x9f, 0x97, 0x97, 0xb2, 0xb1, 0xb7, 0xab, 0xa5, 0x90, 0xc6, 0xd1, 0xb9, 0xa0, 0xa9, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa9, 0xab, 0xa9, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa2, 0xa2, 0x9e, 0xa2, 0x9f, 0xb1, 0x9b, 0xb1, 0xa4, 0x9f, 0x9c, 0x90, 0xba, 0xd6, 0xdb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xd9, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd4, 0x9d, 0x8f, 0xa3, 0xa3, 0x9a, 0xa2, 0xa2, 0xa4, 0xa2, 0x9e, 0xa2, 0xa2, 0x9e, 0xb2, 0x8b, 0x69, 0x52, 0x4c, 0x44, 0x3d, 0x44, 0x44, 0x45, 0x4c, 0x52, 0x7f, 0xb2, 0xab, 0x97, 0xad, 0x97, 0x9e, 0x98, 0x9c, 0xc3, 0xd1, 0xb9, 0xaf, 0xa4, 0xa9, 0xad, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0x9e, 0x9f, 0x9e, 0x9b, 0x9b, 0x9b, 0x8d, 0x98, 0x90, 0xcd, 0xcd, 0x85, 0x52, 0x68, 0x54, 0x5c, 0x5e, 0x52, 0x65, 0x39, 0x1d, 0x14, 0x17, 0x14, 0x26, 0x8c, 0xc8, 0xd5, 0xce, 0x94, 0xce, 0xdb, 0xc8, 0x91, 0xd0, 0x79, 0xa8, 0xd4, 0x8c, 0x91, 0xd8, 0xd8, 0xce, 0x50, 0x25, 0x12, 0x2d, 0xd6, 0x75, 0xdd, 0xe0, 0xe0, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0x02, 0x02, 0x05, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0x94, 0xd6, 0xc7, 0x8c, 0x48, 0x14, 0x17, 0x18, 0x2b, 0x7f, 0x73, 0x78, 0x78, 0x7b, 0x70, 0xb3, 0xd7, 0x22, 0xdd, 0x2a, 0xd7, 0xd3, 0x90, 0xa3, 0xa9, 0xab, 0xab, 0xb8, 0xbb, 0xbb, 0xc2, 0xc0, 0xb8, 0xaf, 0xa3, 0xa3, 0xaf, 0xab, 0xa3, 0x9f, 0xb1, 0xab, 0xab, 0xaf, 0xab, 0x97, 0x86, 0xab, 0xb9, 0x87, 0xac, 0xcd, 0xc3, 0xa5, 0xab, 0x9e, 0x9e, 0x9e, 0x9e, 0x96, 0x9e, 0x9e, 0x9e, 0x97, 0x96, 0x97, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0x9f, 0xa4, 0x9f, 0xa4, 0x9b, 0xa4, 0xa2, 0xa0, 0x90, 0xb3, 0xc7, 0xd7, 0xdb, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xd9, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xff, 0xd9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xff, 0xff, 0xdc, 0xd8, 0xbf, 0x95, 0x8f, 0xa3, 0xa3, 0xa3, 0x9a, 0xa2, 0xa2, 0x9e, 0xa2, 0x9e, 0x9e, 0x9e, 0xab, 0x9e, 0x97, 0x97, 0x8b, 0x76, 0x69, 0x69, 0x68, 0x82, 0x97, 0x97, 0xa3, 0x9e, 0xab, 0x9a, 0xa9, 0xa2, 0xa0, 0x98, 0x9c, 0xcd, 0xcd, 0xb9, 0xa3, 0xa9, 0xad, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa2, 0xa2, 0x9e, 0x96, 0x9f, 0x9b, 0x9b, 0x8d, 0x85, 0xb3, 0xd1, 0xc9, 0x65, 0x52, 0x7a, 0x5c, 0x5c, 0x5f, 0x59, 0x4b, 0x21, 0x16, 0x20, 0x12, 0x2c, 0xbd, 0xce, 0x91, 0x5b, 0x94, 0xd8, 0xd0, 0x31, 0x07, 0x07, 0x49, 0xd5, 0xd2, 0xd2, 0xc8, 0xd9, 0x49, 0x28, 0xdb, 0xd8, 0x8c, 0x29, 0x26, 0xcf, 0xb0, 0x09, 0x01, 0x00, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0x02, 0x01, 0xfb, 0xfb, 0xec, 0xec, 0x03, 0x09, 0xc4, 0xbd, 0x29, 0x17, 0x1a, 0x17, 0x1c, 0x18, 0x36, 0x82, 0x6d, 0x7d, 0x7b, 0x83, 0x72, 0xbe, 0xd7, 0x13, 0xdd, 0x84, 0xd6, 0xb3, 0x98, 0xa9, 0xa2, 0xa9, 0xaf, 0xbb, 0xc0, 0xc0, 0xc0, 0xc2, 0xbb, 0xa3, 0xa2, 0xab, 0xab, 0xab, 0xa2, 0xb7, 0xa9, 0x98, 0x8f, 0x98, 0xb4, 0xbb, 0xbb, 0x85, 0xc3, 0x9d, 0x9d, 0xd1, 0xcd, 0xb9, 0x8f, 0x97, 0xa2, 0xa2, 0xa2, 0xa2, 0x9e, 0x97, 0x96, 0x9e, 0xa2, 0xa2, 0xa2, 0x9e, 0x9e, 0x9e, 0x9a, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0xa2, 0x9a, 0xa2, 0x98, 0xa5, 0xb3, 0xd3, 0xd8, 0xdb, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xdc, 0xdb, 0xd7, 0xc7, 0xa7, 0x9c, 0xa3, 0x9a, 0xa3, 0xa3, 0x9e, 0xa2, 0x9f, 0xa2, 0x9e, 0x9e, 0xa2, 0x9e, 0x9e, 0xa2, 0xa9, 0xab, 0xa9, 0x9e, 0x9e, 0xa2, 0x96, 0xb2, 0xb7, 0xb2, 0x97, 0x97, 0x9e, 0xa3, 0x96, 0xab, 0xa2, 0x8f, 0xa5, 0xcd, 0xd1, 0xb3, 0xa3, 0xa9, 0xa9, 0xa9, 0xa2, 0xab, 0xa9, 0xa3, 0xa9, 0xa3, 0xab, 0x9e, 0x9e, 0x9f, 0x9e, 0x9b, 0x9b, 0xa4, 0x8b, 0x85, 0xc3, 0xd3, 0xa6, 0x51, 0x5e, 0x5c, 0x74, 0x53, 0x68, 0x55, 0x2b, 0x18, 0x16, 0x1c, 0x23, 0xba, 0xd2, 0x47, 0x29, 0x31, 0x29, 0xbd, 0x58, 0xfc, 0x06, 0x09, 0x04, 0x0f, 0x2e, 0x4d, 0x38, 0x0d, 0x06, 0x01, 0x0a, 0x63, 0xda, 0xd2, 0xae, 0xd8, 0x58, 0x0a, 0xfc, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0x02, 0x01, 0x01, 0xec, 0xec, 0xe1, 0x00, 0x10, 0xd9, 0x94, 0x12, 0x1a, 0x1d, 0x1c, 0x17, 0x18, 0x34, 0x8d, 0x6a, 0x83, 0x78, 0x7b, 0x7f, 0xc6, 0xd2, 0x0a, 0x0a, 0xd5, 0xc7, 0x9c, 0xad, 0xa2, 0xad, 0xa9, 0xb8, 0xbb, 0xc0, 0xc0, 0xc0, 0xbb, 0xb8, 0xab, 0xab, 0xa9, 0xb2, 0xa9, 0xa9, 0xab, 0xab, 0xa5, 0xb4, 0xa6, 0x9c, 0x8f, 0x9c, 0x7e, 0xc6, 0xca, 0xca, 0xd4, 0xd3, 0xcd, 0x9c, 0x97, 0x9e, 0x9e, 0xa2, 0xa2, 0xa2, 0x9e, 0x96, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa2, 0xa2, 0xa2, 0x9e, 0x9e, 0x9e, 0x97, 0x9a, 0x9a, 0x9e, 0x9a, 0xa9, 0x97, 0xa7, 0xbe, 0xd6, 0xda, 0xdc, 0xff, 0xdc, 0xff, 0xd9, 0xd9, 0xd5, 0xcc, 0xc8, 0xc8, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xcc, 0xce, 0xd5, 0xd8, 0xd9, 0xd9, 0xff, 0xdc, 0xdc, 0xd9, 0xda, 0xcf, 0xa7, 0x90, 0xa2, 0xa9, 0x97, 0x8b, 0xa3, 0x9a, 0x9e, 0x9e, 0x9e, 0x9a, 0xa2, 0x9a, 0x9e, 0xa2, 0x9e, 0x9e, 0x9a, 0x9a, 0x9e, 0xa2, 0xad, 0xad, 0xad, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x8b, 0xab, 0xab, 0x98, 0xbe, 0xcd, 0xcd, 0xa7, 0xa0, 0xad, 0xa9, 0xa9, 0xa9, 0xa3, 0xa9, 0xa3, 0xab, 0xa3, 0x9e, 0x9e, 0x9e, 0x97, 0x9f, 0x96, 0x93, 0x9f, 0x8f, 0x90, 0xd1, 0xd1, 0x87, 0x51, 0x5c, 0x53, 0x74, 0x5a, 0x62, 0x4a, 0x1f, 0x16, 0x20, 0x14, 0x3e, 0xd4, 0x5b, 0x27, 0xa8, 0xc7, 0x6f, 0xbd, 0x94, 0xfb, 0x04, 0x00, 0x00, 0xdd, 0xfc, 0xdd, 0xfc, 0x00, 0xdd, 0x05, 0x03, 0x09, 0x40, 0xc4, 0xcc, 0x99, 0x11, 0xfc, 0xfb, 0x07, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0x01, 0xfb, 0x01, 0xec, 0xec, 0xe3, 0xe3, 0x2a, 0xcb, 0x46, 0x16, 0x1d, 0x17, 0x14, 0x1c, 0x1a, 0x39, 0x93, 0x64, 0x89, 0x7b, 0x70, 0x7f, 0xd1, 0xd2, 0x09, 0x2a, 0xda, 0xb6, 0x97, 0xb1, 0xb1, 0xad, 0xa9, 0xb8, 0xc0, 0xc0, 0xc0, 0xc0, 0xaf, 0xaf, 0xab, 0xa2, 0xad, 0xa2, 0xad, 0xad, 0x98, 0x98, 0xb3, 0xa6, 0x7e, 0x43, 0x3c, 0x4b, 0xbc, 0xd1, 0xca, 0xcf, 0xc7, 0xca, 0xcd, 0xc3, 0x98, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x9f, 0xa2, 0x9a, 0x9f, 0x9e, 0xa2, 0xa2, 0xa9, 0xa9, 0xa9, 0xa2, 0x9e, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa4, 0x9b, 0xa0, 0xa7, 0xbf, 0xd5, 0xdb, 0xdc, 0xdb, 0xd8, 0xcc, 0xc7, 0xbd, 0xba, 0xae, 0xfe, 0xa8, 0xfe, 0xa8, 0xfe, 0xa8, 0xfe, 0xbd, 0xfe, 0xce, 0xcc, 0xd9, 0xff, 0xff, 0xdc, 0xda, 0xcf, 0xfe, 0xa5, 0x96, 0xa4, 0xa4, 0xa4, 0x9b, 0x9b, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xad, 0xa2, 0x9f, 0x96, 0x96, 0x9a, 0x9f, 0xa2, 0xb1, 0x9f, 0x8e, 0x9a, 0x9e, 0xa9, 0xa3, 0x9e, 0x9e, 0xa9, 0x97, 0xb4, 0xc9, 0xcd, 0xbc, 0xa7, 0xa3, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9e, 0x9e, 0x9a, 0x96, 0x96, 0x93, 0x9a, 0x8f, 0x95, 0xd1, 0xc6, 0x55, 0x59, 0x5a, 0x61, 0x61, 0x61, 0x57, 0x2f, 0x18, 0x1c, 0x16, 0x16, 0x8c, 0xca, 0x2d, 0x48, 0xd3, 0xd4, 0xba, 0xa1, 0x49, 0x06, 0xfb, 0x00, 0xe9, 0xe3, 0xec, 0x00, 0x00, 0xde, 0xdf, 0xe3, 0xdf, 0x00, 0xdd, 0xeb, 0x15, 0x0b, 0x00, 0x00, 0x05, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0x01, 0x01, 0x02, 0xec, 0xe6, 0xe1, 0x00, 0x4d, 0xcb, 0x2c, 0x17, 0x16, 0x17, 0x20, 0x14, 0x1d, 0x3c, 0x9f, 0x67, 0x83, 0x7b, 0x70, 0x72, 0xc6, 0xd2, 0x0c, 0x84, 0xd8, 0xac, 0x8b, 0xb7, 0xb1, 0xad, 0xab, 0xb4, 0xbb, 0xc3, 0xc0, 0xbb, 0xa3, 0xad, 0xb1, 0xad, 0xa9, 0xa9, 0xa3, 0xa5, 0xb4, 0x6c, 0x39, 0x27, 0x18, 0x25, 0x4e, 0xcd, 0xd1, 0xcd, 0xbf, 0xac, 0x80, 0x80, 0xc6, 0xcd, 0xb4, 0xaf, 0xa3, 0xa9, 0xa0, 0xa9, 0xa9, 0xad, 0xad, 0xad, 0xad, 0xa9, 0xad, 0xa2, 0x9e, 0x9e, 0xa2, 0xa9, 0xa3, 0xa3, 0xa3, 0xa3, 0x9a, 0xa9, 0xa4, 0xad, 0x9e, 0x8f, 0xac, 0xc7, 0xd8, 0xda, 0xce, 0xc7, 0xba, 0xa8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xa8, 0xae, 0xb5, 0xcb, 0xdc, 0xdb, 0xce, 0xbc, 0x9c, 0xa9, 0xb1, 0xa4, 0xb1, 0xb1, 0xa4, 0xa4, 0xa4, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0x9f, 0xa2, 0xad, 0xad, 0xb1, 0xb7, 0xad, 0xa4, 0xb1, 0xad, 0xb1, 0xa9, 0xa9, 0x9e, 0xa3, 0xab, 0xaf, 0x98, 0x8f, 0xc0, 0xcd, 0xc6, 0xa7, 0x95, 0xa3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa3, 0x9e, 0xa3, 0x97, 0x9e, 0x9a, 0x9a, 0x8e, 0x8b, 0x90, 0xb3, 0xd1, 0xbc, 0x51, 0x69, 0x5a, 0x74, 0x53, 0x74, 0x51, 0x21, 0x14, 0x1c, 0x18, 0x16, 0xba, 0xa8, 0x36, 0x56, 0xd1, 0xc7, 0xbd, 0xd5, 0x1e, 0xdd, 0x05, 0xe7, 0xe3, 0xe7, 0xe6, 0x00, 0xe2, 0xe0, 0x00, 0xe8, 0xe0, 0xe0, 0xe6, 0x00, 0xe0, 0x00, 0xe1, 0xe3, 0xe6, 0xe3, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 
-  0xe1, 0xe1, 0xe1, 0xec, 0xe1, 0xec, 0xec, 0xec, 0xec, 0xe1, 0xec, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0x04, 0x01, 0x01, 0xe1, 0xe1, 0xe3, 0x02, 0x06, 0x99, 0xc4, 0x16, 0x12, 0x16, 0x20, 0x12, 0x1c, 0x1d, 0x55, 0x77, 0x73, 0x86, 0x7b, 0x76, 0x72, 0xcd, 0xcf, 0x31, 0xd0, 0xd1, 0xa6, 0xb8, 0x96, 0xb1, 0xa9, 0xa0, 0x9c, 0xa6, 0xa6, 0xa6, 0xa0, 0xb1, 0x9b, 0xb1, 0xb1, 0xa2, 0xa7, 0xa7, 0x80, 0x2d, 0x20, 0x16, 0x12, 0x26, 0x9d, 0xd4, 0xcd, 0xb4, 0xaf, 0x97, 0x98, 0x98, 0xa5, 0xa6, 0xc3, 0xcd, 0xc0, 0x90, 0x98, 0xa3, 0x9e, 0xa2, 0xad, 0xb1, 0xa4, 0xa4, 0x9f, 0xa4, 0xa4, 0xad, 0xb1, 0x9a, 0x9b, 0x9a, 0xa4, 0x9a, 0xad, 0xad, 0xad, 0xa4, 0xa2, 0xa0, 0x9c, 0x9c, 0xac, 0xbc, 0xca, 0xfe, 0xb6, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xc7, 0xa8, 0xa8, 0xba, 0xca, 0xca, 0xbe, 0x9c, 0xa0, 0xa2, 0x9f, 0x9f, 0xa4, 0x9f, 0xb1, 0x9f, 0xa2, 0xa2, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa4, 0xa2, 0xa4, 0xad, 0xa4, 0xa4, 0xa4, 0xa4, 0xb1, 0xb1, 0xa4, 0xa4, 0xa9, 0xa3, 0xa0, 0x98, 0xa5, 0x90, 0xb9, 0xcd, 0xd1, 0xc3, 0xac, 0x95, 0xaf, 0xa2, 0xa4, 0xa4, 0xb1, 0xb1, 0xb1, 0x9f, 0xad, 0x9e, 0x9e, 0x8b, 0x97, 0x9a, 0x9a, 0x9a, 0x97, 0x8f, 0x85, 0xcd, 0xd1, 0x90, 0x5d, 0x53, 0x53, 0x6a, 0x6d, 0x52, 0x39, 0x1a, 0x1d, 0x14, 0x16, 0x16, 0x5b, 0xcf, 0x4f, 0x2d, 0x4f, 0xae, 0xdb, 0x32, 0x08, 0x00, 0xe1, 0xe1, 0xdd, 0x01, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xdf, 0x02, 0xdf, 0x02, 0x02, 0x02, 0x02, 0xec, 0x02, 0xec, 0x02, 0xec, 0x01, 0x01, 0x02, 0xfb, 0x02, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 
-  0xe1, 0xe1, 0xec, 0xe1, 0xec, 0xe1, 0xec, 0xec, 0xec, 0xec, 0x02, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x03, 0xdd, 0x02, 0xe1, 0xe0, 0x02, 0xdd, 0x0f, 0xd5, 0xc1, 0x47, 0x35, 0x26, 0x1c, 0x19, 0x1c, 0x1f, 0x55, 0x86, 0x77, 0x88, 0x77, 0x76, 0x7f, 0xc6, 0xd3, 0xa1, 0xd2, 0xc6, 0x9c, 0x98, 0xb8, 0xb1, 0xab, 0xa5, 0xa6, 0xb3, 0xb3, 0xb4, 0xa3, 0xad, 0xb1, 0xb1, 0xb1, 0x98, 0xa7, 0x56, 0x1a, 0x1c, 0x17, 0x12, 0x31, 0xc7, 0xd6, 0xb3, 0xb3, 0xa0, 0x96, 0x96, 0xa4, 0xa9, 0x97, 0x9c, 0xa6, 0xc3, 0xcd, 0xc0, 0xa6, 0x98, 0xa3, 0xab, 0xa2, 0x9f, 0x9f, 0xa4, 0xad, 0xa4, 0xa2, 0x9f, 0x9a, 0x9f, 0xa4, 0xad, 0xad, 0xad, 0xa4, 0x93, 0x8a, 0x9e, 0xa9, 0xab, 0xa0, 0x9c, 0xa5, 0xb9, 0xc3, 0xbe, 0xfe, 0xb3, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x9d, 0xfe, 0xbc, 0xbe, 0xbe, 0xb4, 0xa5, 0xa0, 0xa2, 0xa2, 0xa9, 0xa4, 0xa2, 0x9f, 0xa2, 0xa2, 0xa2, 0xa0, 0xa2, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xad, 0x9f, 0xad, 0xa4, 0xa4, 0xa4, 0x93, 0x93, 0x9f, 0xa9, 0xab, 0xa0, 0x9c, 0x9c, 0x90, 0xc9, 0xd1, 0xcd, 0xd1, 0xd1, 0xcd, 0xa7, 0x9c, 0xb8, 0xbb, 0xa4, 0x9b, 0xb1, 0xb1, 0xb1, 0x9f, 0xab, 0xb2, 0xb8, 0xb2, 0x9a, 0x8a, 0x86, 0x8b, 0x85, 0x90, 0xcd, 0xcd, 0x7f, 0x5f, 0x64, 0x74, 0x6a, 0x57, 0x51, 0x2b, 0x17, 0x1a, 0x20, 0x19, 0x0e, 0x3e, 0xd6, 0xba, 0xc7, 0xce, 0xc8, 0x32, 0x0d, 0x00, 0xe3, 0xdf, 0x02, 0x03, 0x04, 0x01, 0xdf, 0x02, 0xdf, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0xfb, 0x02, 0xfb, 0xec, 0xfb, 0x02, 0x01, 0xec, 0x01, 0xec, 0x01, 0xec, 0x02, 0x01, 0x02, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 
-  0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0xec, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0xdd, 0x02, 0xe3, 0x05, 0x00, 0x22, 0xd5, 0xbd, 0xd4, 0xd4, 0xa8, 0x29, 0x12, 0x16, 0x21, 0x59, 0x82, 0x7d, 0x83, 0x82, 0x77, 0x7f, 0xc3, 0xd3, 0xd4, 0xd6, 0xa6, 0xb4, 0x86, 0xc2, 0xa9, 0xa9, 0xaf, 0xbb, 0xc0, 0xc3, 0xbb, 0xb4, 0x93, 0xc2, 0xb1, 0xa0, 0x9c, 0x43, 0x1d, 0x16, 0x14, 0x14, 0x3a, 0xba, 0xd4, 0xca, 0x95, 0x8f, 0x8f, 0x8e, 0x9f, 0xad, 0xad, 0xa3, 0x98, 0x8f, 0xa5, 0xc9, 0xc9, 0xc0, 0xa3, 0xa0, 0xab, 0xa9, 0x97, 0xa2, 0x9e, 0xa9, 0xa3, 0xab, 0xa3, 0xa0, 0xa3, 0x97, 0x9e, 0x9e, 0xa2, 0xa9, 0xb2, 0xb7, 0x9e, 0x9e, 0xab, 0xa3, 0xa3, 0xa3, 0xa5, 0xaf, 0xbe, 0xbe, 0xbe, 0xb9, 0xfe, 0xbe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc9, 0xbe, 0xb4, 0xa0, 0x98, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa2, 0xa2, 0x9e, 0xa2, 0x9e, 0xa9, 0xa2, 0xa9, 0xab, 0xab, 0xa0, 0x98, 0x8f, 0x9c, 0xa6, 0xc3, 0xd1, 0xcd, 0xb9, 0xb3, 0xcd, 0xd1, 0xcd, 0xb3, 0x95, 0x90, 0xb9, 0xc0, 0xa0, 0xa0, 0xaf, 0xaf, 0xa0, 0x8f, 0x8d, 0x86, 0x8d, 0x96, 0x9f, 0x8d, 0x8f, 0xa6, 0xcd, 0xc9, 0x65, 0x54, 0x64, 0x53, 0x60, 0x77, 0x51, 0x1f, 0x14, 0x12, 0x17, 0x20, 0x12, 0x47, 0xda, 0x91, 0x6f, 0x46, 0x1e, 0x07, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x01, 0x03, 0x01, 0xdf, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfb, 0xec, 0xfb, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 
-  0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0xe6, 0x00, 0xfd, 0xdd, 0x40, 0xd5, 0x6e, 0x47, 0x56, 0xd4, 0xa8, 0x17, 0x18, 0x25, 0x66, 0x88, 0x7d, 0x89, 0x82, 0x7d, 0x7f, 0xb4, 0xd1, 0xd4, 0xca, 0x90, 0xbb, 0x8d, 0xb7, 0xad, 0xab, 0xb8, 0xc0, 0xc0, 0xc0, 0xbb, 0xb8, 0xa0, 0xa2, 0xaf, 0x9c, 0x4a, 0x1a, 0x12, 0x26, 0x14, 0x3a, 0xc7, 0xd4, 0x9d, 0x87, 0xa6, 0x8f, 0xa3, 0x9e, 0x9f, 0x9e, 0x9e, 0x9e, 0xa3, 0xa3, 0xa5, 0xa3, 0xc0, 0xc9, 0xc2, 0xa5, 0x97, 0xb4, 0xb8, 0xaf, 0xaf, 0xa5, 0xa3, 0xa5, 0xaf, 0xb4, 0xaf, 0xb4, 0xa5, 0xa3, 0xa0, 0xa3, 0xab, 0xab, 0x97, 0xa9, 0xa9, 0xa9, 0x9e, 0xa0, 0x9e, 0xa0, 0xb4, 0xb9, 0xbe, 0xbe, 0xc9, 0xbe, 0xbe, 0xb4, 0xfe, 0xb4, 0xfe, 0xb9, 0xfe, 0xb9, 0xfe, 0xb9, 0xc9, 0xc0, 0xb4, 0xb4, 0xab, 0xaf, 0xad, 0xa9, 0xa9, 0xa4, 0xa9, 0xa2, 0xa2, 0xa9, 0xa0, 0xa9, 0xa0, 0xa9, 0xa3, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xb2, 0xab, 0xa9, 0xa3, 0xa2, 0xa9, 0xa9, 0xab, 0xb4, 0xaf, 0x9c, 0x8f, 0x90, 0xa6, 0xc3, 0xc9, 0xcd, 0xcd, 0xb9, 0x90, 0x7e, 0x8f, 0xbe, 0xcd, 0xd3, 0xc6, 0x9d, 0xac, 0x9d, 0x95, 0x87, 0x90, 0x87, 0x8f, 0xa5, 0xaf, 0xaf, 0xa2, 0x8d, 0x8d, 0x8d, 0x7f, 0xb4, 0xcd, 0xc9, 0x69, 0x4c, 0x61, 0x53, 0x5c, 0x5d, 0x34, 0x18, 0x20, 0x1c, 0x19, 0x19, 0x19, 0x7c, 0xce, 0x23, 0xfc, 0x06, 0xfb, 0xfb, 0xdd, 0xe6, 0xe7, 0xdf, 0xe3, 0x02, 0xdd, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0x02, 0xec, 0xec, 0x02, 0xe1, 0xdf, 0xe1, 0xdf, 0xe3, 0xe1, 0xdf, 0xe3, 0xe1, 0xdf, 0xe1, 0xe0, 0xdf, 0xe0, 0xdf, 
-  0x03, 0x03, 0x03, 0x01, 0xdd, 0x02, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0x02, 0xe1, 0x02, 0x02, 0xdd, 0x05, 0xfb, 0x02, 0x02, 0x00, 0x04, 0xfc, 0x84, 0xc8, 0x79, 0x3f, 0x27, 0x6e, 0xd4, 0x2c, 0x18, 0x27, 0x65, 0x89, 0x73, 0x89, 0x81, 0x81, 0x82, 0xa5, 0xd1, 0xd1, 0xbf, 0xa5, 0xbb, 0xb7, 0xad, 0xa9, 0xb2, 0xb7, 0xc2, 0xc2, 0xbb, 0xb8, 0xa5, 0xbb, 0x9c, 0x9c, 0x48, 0x1a, 0x1d, 0x21, 0x14, 0x29, 0xa8, 0xd3, 0xbc, 0xa7, 0x9c, 0x8f, 0xa0, 0xa9, 0xa9, 0x9e, 0x9e, 0x9e, 0xa2, 0xa9, 0xab, 0xb2, 0xa0, 0xab, 0xc2, 0xc9, 0xc0, 0xaf, 0xa5, 0x90, 0x9c, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x9c, 0x90, 0xa6, 0x9c, 0xa6, 0xa5, 0xa5, 0x98, 0xa0, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0x9f, 0xad, 0xa9, 0x98, 0xa0, 0xaf, 0xbb, 0xc0, 0xc0, 0xc0, 0xbe, 0xc0, 0xbe, 0xbe, 0xbe, 0xc0, 0xbe, 0xc0, 0xbe, 0xc0, 0xb8, 0xa9, 0x97, 0xa9, 0xad, 0xad, 0xa2, 0xa4, 0xa9, 0xa2, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa9, 0xa2, 0xa2, 0xa9, 0xa2, 0xab, 0xa2, 0xa3, 0xab, 0xaf, 0xa3, 0xa0, 0xa3, 0xa0, 0xa5, 0xa3, 0x90, 0x90, 0x95, 0xa6, 0xc3, 0xcd, 0xcd, 0xd1, 0xc3, 0xa6, 0x9c, 0x90, 0x8f, 0x72, 0x8f, 0xa6, 0xc6, 0xd3, 0xb6, 0x3a, 0x21, 0x26, 0x2d, 0x26, 0x2b, 0x36, 0x3c, 0x4e, 0x65, 0x7e, 0x98, 0xa5, 0x7f, 0x7f, 0xb9, 0xcd, 0xb4, 0x5d, 0x54, 0x64, 0x73, 0x57, 0x51, 0x27, 0x16, 0x1c, 0x14, 0x12, 0x12, 0x20, 0xc8, 0xda, 0x32, 0x04, 0x06, 0x08, 0x02, 0xe3, 0xe6, 0xe0, 0xe3, 0xe3, 0xe6, 0xe1, 0xdf, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xec, 0x02, 0xec, 0xec, 0x02, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xe1, 0xdf, 0xe1, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0xe0, 
-  0x03, 0x01, 0x01, 0x01, 0x02, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0xe1, 0x02, 0x02, 0xdd, 0x02, 0xdd, 0xec, 0x02, 0xfb, 0x0a, 0xc4, 0xae, 0xd3, 0xd3, 0x56, 0x36, 0xd3, 0x47, 0x12, 0x27, 0x7f, 0x8e, 0x7a, 0x92, 0x81, 0x89, 0x82, 0x8d, 0xd1, 0xd1, 0xc6, 0x9c, 0x97, 0xb7, 0xa9, 0xa9, 0xad, 0xb7, 0xb7, 0xc2, 0xb7, 0xaf, 0xa0, 0x9c, 0xc6, 0x56, 0x21, 0x1a, 0x1d, 0x16, 0x20, 0xb6, 0xd1, 0xc6, 0xa7, 0x8f, 0xa0, 0xa9, 0x9f, 0x97, 0xa9, 0xa3, 0xa3, 0x9e, 0xa9, 0xa9, 0x9f, 0xa2, 0xa9, 0xa0, 0xa0, 0xbb, 0xc9, 0xb9, 0x90, 0x90, 0xa6, 0xa6, 0xc3, 0xc3, 0xc9, 0xc3, 0xc3, 0xb3, 0xb3, 0xa6, 0xa6, 0x9c, 0xa6, 0xaf, 0xb4, 0xab, 0xab, 0xa2, 0xa9, 0xa4, 0xad, 0xb1, 0xad, 0xb2, 0xa3, 0xa3, 0xa0, 0xab, 0xaf, 0xbb, 0xbb, 0xc0, 0xc0, 0xbb, 0xb9, 0xb9, 0xb4, 0xb9, 0xb4, 0xab, 0xab, 0xb7, 0xab, 0xad, 0xa2, 0xa4, 0xad, 0xad, 0x9e, 0xa9, 0xa3, 0xa9, 0xa3, 0xa3, 0xa3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa3, 0xab, 0xa0, 0x98, 0xa0, 0x9c, 0xa0, 0x9c, 0xa5, 0xa5, 0xb3, 0xb9, 0xcd, 0xcd, 0xd1, 0xcd, 0xc9, 0xc3, 0x9c, 0xa6, 0xa5, 0xa5, 0xa0, 0x98, 0x8d, 0x72, 0x95, 0xd1, 0xd6, 0x80, 0x23, 0x12, 0x16, 0x18, 0x17, 0x14, 0x17, 0x1d, 0x25, 0x2f, 0x4e, 0x6c, 0x8f, 0x90, 0xc9, 0xcd, 0x8f, 0x5d, 0x54, 0x6d, 0x60, 0x52, 0x51, 0x27, 0x16, 0x12, 0x26, 0x3b, 0x35, 0x3e, 0xc8, 0xd0, 0x84, 0xdd, 0x03, 0x02, 0xdf, 0xe3, 0xe1, 0xe1, 0xe3, 0xe6, 0xe6, 0xe3, 0xdd, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 
-  0x01, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0x00, 0xe1, 0xe1, 0xe1, 0xfb, 0x00, 0x15, 0xcc, 0xae, 0xcf, 0xd1, 0x48, 0x2d, 0xd6, 0x5b, 0x12, 0x2b, 0x72, 0x89, 0x73, 0x89, 0x89, 0x81, 0x89, 0x7f, 0xc9, 0xd1, 0xc6, 0xa5, 0x8d, 0xa9, 0xa9, 0xab, 0xa9, 0xb7, 0xb1, 0xb1, 0xad, 0xab, 0x9c, 0x95, 0x95, 0x2d, 0x16, 0x23, 0x16, 0x17, 0x80, 0xd6, 0xbc, 0xa7, 0xaf, 0x77, 0x92, 0xb7, 0x9f, 0x96, 0xa3, 0xa3, 0xa0, 0xa2, 0xa9, 0xa4, 0x96, 0xa2, 0xab, 0xa0, 0x98, 0xa5, 0xb9, 0xc3, 0xb3, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd1, 0xcd, 0xcd, 0xb9, 0xb9, 0xa6, 0x9c, 0xa0, 0xaf, 0xa3, 0xa9, 0xa9, 0xa9, 0xb1, 0xad, 0xad, 0xb7, 0xb8, 0xb2, 0xb2, 0xa0, 0xab, 0xa5, 0xa0, 0xa5, 0xb4, 0xa5, 0xa5, 0xa5, 0xa6, 0xa5, 0xa5, 0xb4, 0xb7, 0xbb, 0xb7, 0xad, 0xa2, 0xa2, 0xad, 0xa9, 0xa9, 0xa9, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xab, 0xab, 0xa0, 0xa0, 0xa5, 0xa5, 0xb4, 0xb9, 0xc0, 0xc0, 0xc3, 0xcd, 0xcd, 0xcd, 0xcd, 0xc9, 0xb9, 0xa6, 0x85, 0xa5, 0xb4, 0xbb, 0xaf, 0xa0, 0xb8, 0xab, 0x8d, 0x72, 0x90, 0xcd, 0xd3, 0x79, 0x1c, 0x0e, 0x19, 0x17, 0x1d, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x21, 0x43, 0x6c, 0xcd, 0xcd, 0x85, 0x52, 0x54, 0x67, 0x5c, 0x77, 0x3c, 0x1d, 0x16, 0x35, 0xbd, 0xd6, 0xce, 0xd2, 0xd6, 0xcb, 0xb5, 0x09, 0x05, 0xe6, 0xe0, 0xe3, 0xec, 0xec, 0xdd, 0xe6, 0xe0, 0xe3, 0xe1, 0x01, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0xe1, 0xec, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe1, 0xe1, 0xe1, 0xec, 0xec, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0xdd, 0x15, 0xd5, 0x91, 0xbf, 0xb6, 0x36, 0x4f, 0xcf, 0x3e, 0x14, 0x2b, 0x7e, 0x8e, 0x7d, 0x89, 0x88, 0x81, 0x89, 0x7f, 0xc0, 0xd1, 0xc3, 0xb9, 0xb2, 0x98, 0xb2, 0xa3, 0xa9, 0xad, 0xad, 0xb1, 0xa4, 0xab, 0xa5, 0xbc, 0x36, 0x18, 0x18, 0x16, 0x16, 0x4f, 0xd4, 0xc6, 0xb3, 0x7f, 0x7f, 0xc2, 0xb1, 0x92, 0xb1, 0xa4, 0xab, 0xaf, 0x98, 0x98, 0xa9, 0xb1, 0xa4, 0xab, 0xab, 0xb4, 0xb4, 0xb4, 0xa6, 0xc3, 0xd1, 0xcd, 0xcd, 0xb3, 0x95, 0x85, 0x7e, 0x7e, 0x7e, 0x90, 0xb3, 0xc9, 0xcd, 0xcd, 0xc9, 0xc0, 0xa5, 0xa5, 0xa3, 0xab, 0xab, 0xb2, 0xb2, 0xad, 0xa2, 0xa2, 0xab, 0xb8, 0xc2, 0xc2, 0xbb, 0xb2, 0xa5, 0xa0, 0x98, 0xa5, 0xa5, 0xb4, 0xb4, 0xb4, 0xb9, 0xc2, 0xc0, 0xab, 0xa0, 0xa3, 0xa9, 0xa9, 0xa3, 0xa9, 0xa3, 0xa9, 0xa3, 0xa9, 0xa3, 0xa3, 0xa3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xa0, 0xa3, 0xbb, 0xc0, 0xc9, 0xc9, 0xcd, 0xcd, 0xcd, 0xcd, 0xc9, 0xc9, 0xb9, 0xa5, 0x90, 0x85, 0x8f, 0x9c, 0xa0, 0xaf, 0xc2, 0xbb, 0xc2, 0xab, 0x9e, 0x8d, 0x97, 0x77, 0xa7, 0xd1, 0xc7, 0x3e, 0x1c, 0x12, 0x16, 0x17, 0x1c, 0x1a, 0x17, 0x16, 0x18, 0x1d, 0x1a, 0x36, 0xc6, 0xcd, 0x66, 0x5d, 0x54, 0x60, 0x54, 0x77, 0x2b, 0x1f, 0x26, 0xae, 0xcf, 0x47, 0x47, 0xa8, 0xd2, 0xd8, 0xcb, 0x10, 0x00, 0xe3, 0xe4, 0xe3, 0x01, 0xfb, 0xdd, 0xec, 0xe6, 0xe4, 0xe1, 0x01, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0xe1, 0xec, 0x02, 0x02, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 
-  0xe7, 0xe4, 0x00, 0xe3, 0xe2, 0xe3, 0x00, 0x02, 0xe1, 0xe2, 0xde, 0xfd, 0x02, 0x00, 0xec, 0x05, 0x00, 0xe1, 0xe6, 0xe3, 0xde, 0x01, 0x11, 0xd9, 0x91, 0x35, 0x3f, 0x2b, 0xa8, 0xc7, 0x23, 0x1c, 0x27, 0x7e, 0x82, 0x89, 0x86, 0x6b, 0x9b, 0x81, 0x69, 0xb4, 0xcd, 0xcd, 0xc0, 0xb8, 0xa0, 0x8f, 0xaf, 0xab, 0x96, 0xa4, 0xb1, 0xb7, 0xa0, 0xb9, 0x56, 0x29, 0x19, 0x18, 0x12, 0x47, 0xca, 0xd3, 0x95, 0x9c, 0x98, 0xa4, 0x9b, 0xb1, 0xa4, 0xa4, 0x9f, 0xa3, 0xa3, 0x8f, 0x97, 0xa9, 0xb1, 0xb1, 0xaf, 0xb4, 0xa5, 0xb9, 0xc9, 0xd1, 0xcd, 0xa6, 0x6c, 0x4e, 0x3c, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x4b, 0x72, 0xa6, 0xc0, 0xc9, 0xc9, 0xcd, 0xaf, 0xa5, 0xa0, 0xa0, 0xaf, 0xab, 0xaf, 0x9e, 0xa3, 0xa9, 0xab, 0xb2, 0xbb, 0xc2, 0xc9, 0xc9, 0xc9, 0xc0, 0xc9, 0xc9, 0xc9, 0xc9, 0xc3, 0xc0, 0xb4, 0xa5, 0xa5, 0xa5, 0xa3, 0xa5, 0xa3, 0xa0, 0xa3, 0xaf, 0xb2, 0xaf, 0xa3, 0xa3, 0xa0, 0xa0, 0xa9, 0xad, 0xa9, 0xa9, 0xab, 0xb2, 0xc0, 0xc2, 0xc9, 0xc9, 0xc9, 0xc9, 0xc0, 0xb9, 0xb9, 0xb4, 0xa5, 0xa0, 0xa0, 0xa0, 0x98, 0x97, 0x98, 0x97, 0x97, 0xab, 0xb8, 0xb8, 0xb8, 0xc2, 0xa3, 0x96, 0x8e, 0x77, 0x98, 0xa7, 0xd3, 0xba, 0x23, 0x19, 0x19, 0x12, 0x17, 0x17, 0x16, 0x1c, 0x16, 0x1d, 0x18, 0x2d, 0xd3, 0xc6, 0x51, 0x5d, 0x54, 0x67, 0x4c, 0x77, 0x2b, 0x16, 0x4f, 0xd6, 0x3f, 0x41, 0x4f, 0x8c, 0xbf, 0xc8, 0xd5, 0x32, 0x00, 0xe6, 0xe4, 0xe1, 0xfb, 0xfc, 0xfc, 0xfb, 0xe4, 0xe0, 0xec, 0x01, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe3, 0xe1, 0xe3, 0xe1, 0xe3, 0xdd, 0x02, 0xe6, 0xe1, 0xe4, 0xe1, 0xe3, 0xec, 0xec, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 
-  0xe3, 0xe7, 0xe7, 0xe3, 0x00, 0x05, 0x08, 0x04, 0xdd, 0xdd, 0xdd, 0xdd, 0x01, 0xfb, 0x01, 0xfb, 0x05, 0xe2, 0x00, 0xe8, 0x00, 0x00, 0x24, 0xcb, 0xd8, 0x91, 0x4f, 0x8c, 0xcf, 0x5b, 0x23, 0x12, 0x27, 0x7e, 0x7f, 0x88, 0x86, 0x70, 0x93, 0x83, 0x82, 0x8f, 0xbc, 0xcd, 0xcd, 0xa0, 0x90, 0xb4, 0x8f, 0x97, 0xab, 0xb1, 0xad, 0xa2, 0xa0, 0xa7, 0x48, 0x1f, 0x12, 0x18, 0x47, 0xca, 0xd4, 0xac, 0x9c, 0x9c, 0x9e, 0x9f, 0xa4, 0x9b, 0xb1, 0x9b, 0xa4, 0xa0, 0xa3, 0xa0, 0xa3, 0xab, 0xad, 0xab, 0x8f, 0xa5, 0xc9, 0xcd, 0xcd, 0xa6, 0x55, 0x48, 0x3c, 0x3c, 0x3c, 0x42, 0x45, 0x42, 0x44, 0x44, 0x44, 0x3c, 0x45, 0x85, 0xaf, 0xb4, 0xb4, 0xc0, 0xc9, 0xbb, 0xb4, 0xa3, 0x98, 0x98, 0xa3, 0xaf, 0xa9, 0xab, 0xa3, 0xab, 0xab, 0xb8, 0xb8, 0xbb, 0xc0, 0xc0, 0xc0, 0xbb, 0xb4, 0xa6, 0xa5, 0xa6, 0xa6, 0xa6, 0x9c, 0xa6, 0xb4, 0xb4, 0xa5, 0xa5, 0x98, 0x98, 0xa0, 0xaf, 0xa0, 0xa0, 0xa0, 0xb2, 0xa2, 0xa9, 0xa9, 0xa2, 0x9e, 0xab, 0xb2, 0xbb, 0xb8, 0xaf, 0xb4, 0xaf, 0xb4, 0xa5, 0xa5, 0xa5, 0xa2, 0xa9, 0xa2, 0xa2, 0x9e, 0x96, 0x97, 0x96, 0x97, 0x9e, 0xa9, 0xa9, 0xa3, 0x97, 0xa3, 0xa2, 0xb7, 0x9f, 0x98, 0x7e, 0xd1, 0xd4, 0x3e, 0x12, 0x12, 0x19, 0x20, 0x1c, 0x16, 0x16, 0x18, 0x17, 0x14, 0x47, 0xd3, 0xbc, 0x55, 0x52, 0x54, 0x54, 0x6b, 0x59, 0x27, 0x16, 0x79, 0xc7, 0x36, 0x4f, 0xd1, 0xc7, 0xb6, 0xd6, 0xda, 0x75, 0xdd, 0xe3, 0xe0, 0xe1, 0xfb, 0xfc, 0xfc, 0xfb, 0xe1, 0xe4, 0x02, 0x02, 0x01, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe3, 0x02, 0xe2, 0xfd, 0x02, 0x00, 0x00, 0xe3, 0xe0, 0xe1, 0xe6, 0xe6, 0xdd, 0x00, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xdd, 0x00, 0x00, 0xec, 
-  0xe7, 0xe3, 0xe6, 0xde, 0xfb, 0xdd, 0x01, 0x01, 0x0c, 0x13, 0x22, 0x24, 0x13, 0x0c, 0x07, 0x01, 0xdd, 0x05, 0x00, 0xe2, 0x00, 0x00, 0x1e, 0xd5, 0xc1, 0xc5, 0xd3, 0xcf, 0x8c, 0x1c, 0x17, 0x12, 0x27, 0x6c, 0x8d, 0x86, 0x86, 0x7b, 0x93, 0x83, 0x8d, 0x76, 0x95, 0xcd, 0xcd, 0xb4, 0x9c, 0xb4, 0xb9, 0xaf, 0xab, 0xa0, 0x8d, 0xa0, 0xb9, 0x90, 0x1f, 0x12, 0x1f, 0x5b, 0xca, 0xd3, 0xc6, 0x90, 0x9c, 0xa3, 0x9e, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa2, 0x9e, 0xa3, 0xaf, 0xaf, 0xab, 0xa0, 0xa0, 0xa5, 0xc3, 0xc9, 0xc3, 0x87, 0x4b, 0x39, 0x37, 0x3c, 0x3c, 0x42, 0x45, 0x45, 0x44, 0x44, 0x44, 0x52, 0x37, 0x3d, 0x7f, 0xaf, 0xa0, 0x8f, 0xb8, 0xc0, 0xc9, 0xc0, 0xb4, 0x9c, 0x8f, 0xa0, 0xaf, 0xab, 0xa0, 0xa2, 0xa0, 0xa0, 0xa0, 0xa0, 0xaf, 0xaf, 0xb4, 0xb4, 0xa5, 0xa5, 0xa5, 0xb4, 0xb9, 0xc9, 0xc3, 0xc9, 0xc9, 0xcd, 0xcd, 0xc9, 0xcd, 0xc9, 0xc9, 0xaf, 0x8f, 0xa0, 0xc0, 0xbb, 0x7f, 0xa9, 0xa9, 0xa2, 0xa2, 0xa2, 0x97, 0xab, 0xa3, 0xa0, 0x98, 0xa0, 0x9c, 0xa5, 0xa5, 0xa5, 0xaf, 0xa2, 0xb1, 0xa4, 0x9f, 0x9f, 0x9f, 0x9b, 0x96, 0x96, 0x9f, 0xa9, 0xb2, 0x9e, 0x8b, 0x97, 0xb8, 0xa3, 0xb2, 0xb4, 0x85, 0xac, 0xd3, 0xba, 0x31, 0x31, 0x2c, 0x23, 0x1c, 0x17, 0x16, 0x21, 0x1d, 0x16, 0x8c, 0xd6, 0x95, 0x55, 0x5f, 0x5e, 0x5c, 0x62, 0x4a, 0x21, 0x1a, 0x8c, 0xba, 0x36, 0x80, 0xd4, 0xca, 0xac, 0xd3, 0xce, 0xb0, 0x07, 0xe2, 0xdf, 0xdf, 0xfc, 0xfc, 0xfc, 0xfc, 0xe1, 0xe1, 0xec, 0xfb, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x00, 0xe6, 0x02, 0x02, 0xdd, 0x01, 0x04, 0x05, 0xe6, 0xe3, 0xe3, 0xe2, 0xe6, 0x05, 0xec, 0xfd, 0x00, 0xec, 0xec, 0xec, 0xe7, 0xe6, 0xe7, 0xe4, 
-  0xe5, 0xe3, 0xe3, 0xdd, 0x01, 0x07, 0x22, 0x58, 0xc1, 0xd2, 0xd8, 0xd7, 0xd8, 0xcc, 0x58, 0x28, 0x09, 0xdd, 0x04, 0xdd, 0xde, 0x01, 0x10, 0xdc, 0x58, 0x2c, 0x47, 0x29, 0x1a, 0x14, 0x14, 0x1c, 0x25, 0x6c, 0x7f, 0x8d, 0x8b, 0x76, 0x92, 0x83, 0x93, 0x7f, 0x85, 0xbc, 0xc9, 0xcd, 0xc3, 0xa6, 0xa5, 0x8f, 0xa5, 0xbb, 0xa5, 0xbb, 0x90, 0x39, 0x1a, 0x36, 0x8c, 0xd3, 0xd1, 0xa6, 0x7e, 0xa5, 0xa0, 0x9e, 0x9e, 0xa2, 0xa4, 0xa4, 0xa4, 0xa4, 0xad, 0xa2, 0xab, 0xab, 0xa0, 0x98, 0xa0, 0xb4, 0xc9, 0xcd, 0xb9, 0x55, 0x34, 0x3c, 0x4b, 0x42, 0x4b, 0x44, 0x45, 0x45, 0x44, 0x3d, 0x44, 0x44, 0x4c, 0x3d, 0x44, 0x8d, 0xb8, 0xa3, 0x98, 0xaf, 0xaf, 0xbb, 0xc0, 0xc0, 0xb8, 0xa5, 0xa3, 0xaf, 0xa3, 0xa9, 0xa0, 0xa9, 0xa0, 0xab, 0xaf, 0xaf, 0x98, 0xa0, 0xa5, 0xaf, 0xb4, 0xc0, 0xc0, 0xc9, 0xc3, 0xb9, 0xc3, 0xc3, 0xc0, 0xb4, 0xb4, 0xb9, 0xb4, 0xc9, 0xcd, 0xc9, 0xaf, 0x9c, 0xa0, 0xaf, 0xab, 0xa9, 0xb2, 0xa9, 0xa9, 0xa9, 0xa2, 0xab, 0xab, 0xa3, 0xab, 0xa3, 0xaf, 0xa3, 0xaf, 0xab, 0xad, 0xa4, 0xa4, 0xa4, 0x9b, 0x9b, 0x96, 0x9b, 0x96, 0x96, 0xb7, 0xc2, 0xb8, 0x97, 0x97, 0xaf, 0xa3, 0xb4, 0xb8, 0xb9, 0x85, 0xbc, 0xd4, 0xba, 0xd8, 0xd8, 0xd5, 0xcc, 0x5b, 0x29, 0x21, 0x17, 0x1a, 0xc5, 0xd3, 0x80, 0x5d, 0x5f, 0x5c, 0x64, 0x62, 0x37, 0x1f, 0x1a, 0x8c, 0xba, 0x41, 0x41, 0xca, 0xb6, 0xac, 0xc6, 0xc7, 0xd7, 0x0f, 0x00, 0xdf, 0xe1, 0x03, 0xfc, 0xfc, 0xfc, 0xe1, 0xe3, 0xec, 0x01, 0xec, 0x02, 0xec, 0xe1, 0xe1, 0xe1, 0xe3, 0x02, 0x02, 0x00, 0x00, 0x04, 0x03, 0xdd, 0xdd, 0xdd, 0xdd, 0x00, 0xdd, 0x00, 0x00, 0xdd, 0xfb, 0x05, 0xe2, 0xe3, 0xe3, 0xe4, 0xe5, 0xe4, 
-  0xe3, 0xde, 0x01, 0xdd, 0x13, 0x58, 0xd2, 0xd6, 0xc6, 0xbf, 0xac, 0x9d, 0xbf, 0xd4, 0xd6, 0xce, 0x3b, 0x03, 0x06, 0x01, 0x06, 0xdd, 0x15, 0xd9, 0x94, 0x0e, 0x16, 0x12, 0x17, 0x23, 0x14, 0x20, 0x21, 0x55, 0x98, 0x86, 0x86, 0x86, 0x88, 0x89, 0x8e, 0x8d, 0x85, 0x90, 0xc0, 0xcd, 0xcd, 0xb9, 0xb3, 0x85, 0xa6, 0xa5, 0xa7, 0xa7, 0x95, 0x3c, 0x80, 0xcd, 0xd3, 0xcd, 0xb3, 0x9c, 0x8f, 0x97, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa9, 0x9f, 0xa9, 0xa9, 0xab, 0x98, 0xa0, 0xb9, 0xc9, 0xc9, 0xb9, 0x72, 0x3c, 0x37, 0x45, 0x51, 0x44, 0x45, 0x44, 0x3d, 0x44, 0x44, 0x45, 0x44, 0x4c, 0x3d, 0x44, 0x68, 0x97, 0xb2, 0xa3, 0xa3, 0xa3, 0x98, 0xa3, 0xbb, 0xbb, 0xbb, 0xaf, 0xa3, 0xa0, 0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xaf, 0xab, 0xa3, 0xa0, 0xaf, 0xaf, 0xb8, 0xbb, 0xb4, 0x98, 0xa5, 0x9c, 0x7f, 0x55, 0x42, 0x42, 0x4a, 0x51, 0x55, 0xa5, 0xcd, 0xcd, 0xb4, 0x9c, 0xb4, 0xab, 0xab, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa3, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa4, 0xa4, 0xa4, 0x9f, 0x9f, 0x9b, 0x96, 0x96, 0x8e, 0xad, 0xc2, 0xc2, 0xa3, 0x8b, 0xa3, 0xc0, 0xb4, 0x98, 0xbb, 0x85, 0xa7, 0xd4, 0xcf, 0x94, 0x84, 0xb5, 0xdb, 0xdb, 0xc8, 0x5b, 0x1d, 0x29, 0xd4, 0xc6, 0x55, 0x5d, 0x57, 0x61, 0x5c, 0x77, 0x34, 0x18, 0x1c, 0x3e, 0xcf, 0x6e, 0x25, 0x3a, 0x5b, 0xc3, 0xfe, 0xbc, 0xd6, 0x28, 0xdd, 0xdf, 0xdf, 0x01, 0xfc, 0x04, 0xfb, 0xec, 0xe0, 0x01, 0xec, 0x01, 0xec, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xdd, 0x01, 0x05, 0x04, 0xdd, 0xdd, 0x04, 0x0f, 0x28, 0x40, 0x63, 0x49, 0x38, 0x13, 0x09, 0xdd, 0xdd, 0x00, 0x05, 0xe6, 0xe3, 0xe4, 0xe5, 
-  0xe2, 0x00, 0x01, 0x24, 0xc8, 0xd8, 0xbc, 0x6c, 0x66, 0x51, 0x51, 0x65, 0x4e, 0x4e, 0x95, 0xd6, 0xd0, 0x40, 0x07, 0x01, 0xdd, 0x01, 0x0f, 0xd9, 0x99, 0x20, 0x1d, 0x1f, 0x17, 0x14, 0x17, 0x17, 0x1f, 0x4e, 0x8d, 0x86, 0x86, 0x8a, 0x81, 0x92, 0x89, 0x86, 0x85, 0x85, 0x98, 0xbb, 0xcd, 0xd1, 0xcd, 0xcd, 0xc9, 0xb9, 0xb3, 0xc6, 0xd1, 0xcd, 0xd1, 0xd1, 0xc3, 0x90, 0x8f, 0xaf, 0xa3, 0x9a, 0x9f, 0xa4, 0xa2, 0xa2, 0xa3, 0xa3, 0xa0, 0xa9, 0xa2, 0xad, 0xb1, 0x9e, 0xa0, 0xb4, 0xc9, 0xcd, 0xb9, 0x65, 0x42, 0x42, 0x4c, 0x45, 0x3d, 0x3d, 0x44, 0x44, 0x3d, 0x4c, 0x45, 0x44, 0x3d, 0x3d, 0x3d, 0x57, 0x8d, 0xa9, 0xa3, 0xa3, 0xab, 0xa3, 0xa3, 0xa0, 0xa3, 0xab, 0xb2, 0xab, 0xa9, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xb2, 0xab, 0xa2, 0xa3, 0xab, 0xaf, 0x9e, 0x97, 0xa0, 0xaf, 0xa3, 0x69, 0x45, 0x3d, 0x42, 0x42, 0x42, 0x3c, 0x3c, 0x55, 0xc3, 0xd1, 0xc9, 0x90, 0xa0, 0xa9, 0xa0, 0xa2, 0xab, 0xad, 0xa9, 0xa9, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xad, 0xa9, 0xa2, 0xa9, 0xa2, 0x9f, 0x9f, 0x96, 0x9f, 0x96, 0x9f, 0x8e, 0x8d, 0x9e, 0xa9, 0x97, 0x8b, 0x8f, 0x97, 0xa3, 0x97, 0xa3, 0x8d, 0x8f, 0xd1, 0xc7, 0x13, 0x06, 0x07, 0x10, 0x49, 0xd9, 0xd7, 0x91, 0x6e, 0xd4, 0xbc, 0x55, 0x5f, 0x5c, 0x61, 0x53, 0x70, 0x2f, 0x18, 0x17, 0x19, 0xbd, 0xc7, 0x8c, 0x3a, 0x80, 0xd1, 0x7e, 0x87, 0xcf, 0x49, 0x06, 0xdf, 0xe0, 0x01, 0x03, 0xfc, 0x01, 0xe1, 0xe3, 0xec, 0xfb, 0xec, 0x02, 0xec, 0xe1, 0xec, 0xe1, 0x05, 0x02, 0x01, 0xfb, 0xdd, 0xfc, 0x15, 0x4d, 0xd2, 0xd6, 0xd6, 0xcf, 0xc8, 0xd2, 0xd0, 0xc1, 0x2e, 0x0c, 0x01, 0xdd, 0xde, 0xe6, 0xe4, 0xe0, 
-  0x03, 0xdd, 0x1e, 0xc1, 0xd6, 0x80, 0x55, 0x65, 0x7b, 0x54, 0x54, 0x70, 0x70, 0x52, 0x51, 0x6c, 0xc7, 0xdb, 0x28, 0x01, 0x04, 0x04, 0x07, 0xcb, 0x94, 0x19, 0x12, 0x14, 0x1d, 0x17, 0x20, 0x14, 0x1a, 0x4a, 0x8d, 0x82, 0x86, 0x8a, 0x89, 0x92, 0x92, 0x88, 0x8f, 0x8f, 0x8d, 0x8f, 0xb4, 0xc9, 0xcd, 0xcd, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xc6, 0x90, 0x85, 0x98, 0xa3, 0x97, 0x93, 0xad, 0xa4, 0xa4, 0xa2, 0xa3, 0xa0, 0xa5, 0xa0, 0xab, 0x9f, 0xb1, 0x9f, 0x9e, 0xaf, 0xc9, 0xcd, 0xc3, 0xa5, 0x59, 0x37, 0x44, 0x4c, 0x3d, 0x3d, 0x44, 0x4c, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42, 0x5f, 0x8b, 0xb2, 0xab, 0xa3, 0xab, 0xaf, 0xa3, 0xa3, 0xa9, 0xa3, 0xa2, 0xa2, 0xa9, 0xad, 0xad, 0xa9, 0xad, 0xa9, 0xad, 0xa9, 0xa9, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa9, 0xb2, 0xa9, 0xa9, 0xa9, 0x9a, 0xb7, 0x9a, 0x52, 0x44, 0x45, 0x4c, 0x4b, 0x37, 0x4b, 0x4b, 0x34, 0x43, 0xa6, 0xcd, 0xc9, 0xaf, 0xab, 0x9e, 0xa2, 0xa9, 0xab, 0xa9, 0xa9, 0xa2, 0xa9, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb2, 0xa2, 0xa3, 0xa3, 0x9e, 0x9e, 0x9a, 0x96, 0x96, 0x96, 0x8e, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x69, 0x97, 0x96, 0x89, 0x8e, 0x77, 0xb9, 0xd4, 0x2e, 0xdd, 0x00, 0x00, 0xdd, 0x1e, 0x63, 0xdb, 0xc7, 0xd3, 0xa6, 0x5d, 0x5f, 0x61, 0x61, 0x60, 0x5d, 0x2b, 0x1a, 0x19, 0x12, 0x31, 0xa8, 0xc7, 0xd7, 0xd6, 0xc6, 0x55, 0x7e, 0xd4, 0xaa, 0xdd, 0xdf, 0xe0, 0xe1, 0x01, 0x03, 0x01, 0xe1, 0xe0, 0xec, 0xec, 0xfb, 0xec, 0x02, 0xec, 0xe1, 0xe1, 0x02, 0x05, 0x01, 0xdd, 0x06, 0x24, 0x99, 0xdb, 0xca, 0xb9, 0x90, 0x6c, 0x7e, 0x9d, 0xbf, 0xcf, 0xdb, 0x94, 0x22, 0x06, 0xdd, 0x00, 0xdf, 0xe6, 
-  0x00, 0x10, 0xaa, 0xda, 0x80, 0x4b, 0x7f, 0x4c, 0x54, 0x5c, 0x67, 0x5e, 0x57, 0x5f, 0x5f, 0x59, 0x80, 0xd2, 0xc4, 0x0a, 0x03, 0x03, 0x07, 0xb5, 0xcc, 0x23, 0x2c, 0x8c, 0x91, 0x35, 0x17, 0x1d, 0x1a, 0x43, 0x8d, 0x7f, 0x86, 0x8a, 0x81, 0x92, 0x92, 0x93, 0x98, 0x8f, 0x8d, 0x8d, 0x85, 0x7e, 0xaf, 0xb4, 0xb4, 0xb9, 0xc3, 0xb3, 0x95, 0x90, 0x90, 0x8f, 0xa0, 0xa2, 0x9e, 0x9f, 0xad, 0x9a, 0xa4, 0xa4, 0xa2, 0xa3, 0xa3, 0xa5, 0xa3, 0xa3, 0xab, 0xb2, 0xa9, 0x97, 0xb4, 0xc9, 0xc3, 0x90, 0x9c, 0x5d, 0x45, 0x44, 0x3d, 0x3d, 0x44, 0x4c, 0x44, 0x44, 0x44, 0x44, 0x3d, 0x42, 0x51, 0x69, 0xa3, 0xad, 0xb2, 0xab, 0xa3, 0xa3, 0xa3, 0x9e, 0xa3, 0xa2, 0xab, 0xa9, 0xad, 0xad, 0xad, 0xad, 0x9f, 0xa2, 0x9f, 0xad, 0xa9, 0xad, 0xad, 0xad, 0x9e, 0xa9, 0xad, 0xa9, 0x9f, 0x9e, 0xa2, 0xad, 0xad, 0xb1, 0x8e, 0x4c, 0x37, 0x4c, 0x45, 0x3d, 0x42, 0x42, 0x3c, 0x4b, 0x43, 0x4b, 0x95, 0xcd, 0xb4, 0xaf, 0xa0, 0xa0, 0xa9, 0xa9, 0xad, 0xa2, 0xad, 0xad, 0xad, 0xa4, 0xad, 0xa4, 0xa4, 0xa4, 0xa9, 0xa3, 0x9e, 0xa3, 0x9a, 0x9e, 0x96, 0x96, 0x8e, 0x96, 0x96, 0x8d, 0x8a, 0x97, 0x8b, 0x76, 0x8b, 0x8a, 0x6d, 0x7d, 0x92, 0x77, 0x7e, 0xd6, 0x7c, 0x03, 0xdd, 0xe6, 0x00, 0x00, 0x0d, 0x84, 0xd6, 0xc6, 0x85, 0x52, 0x5e, 0x53, 0x61, 0x5c, 0x5d, 0x21, 0x16, 0x20, 0x13, 0x12, 0x20, 0x3a, 0x94, 0xc5, 0xc6, 0x59, 0x51, 0xd1, 0xc8, 0x11, 0xdf, 0xe0, 0xdf, 0xe1, 0x01, 0x01, 0xdf, 0xe1, 0x02, 0xfb, 0xec, 0x02, 0xe1, 0xe1, 0xec, 0xec, 0x00, 0xde, 0xfb, 0x00, 0x1e, 0xcb, 0xd9, 0x8c, 0x59, 0x52, 0x4c, 0x69, 0x65, 0x51, 0x4e, 0x6c, 0x8c, 0xd6, 0xce, 0x28, 0x06, 0x03, 0xde, 0x00, 
-  0xdd, 0x40, 0xd6, 0xa6, 0x4c, 0x70, 0x4c, 0x5d, 0x77, 0x52, 0x52, 0x77, 0x52, 0x5f, 0x78, 0x57, 0x52, 0x95, 0xda, 0x32, 0xdd, 0x06, 0x07, 0x63, 0xd8, 0x7c, 0xd5, 0xc8, 0xc1, 0xce, 0x8c, 0x25, 0x1f, 0x25, 0x72, 0x98, 0x8d, 0x86, 0x86, 0x93, 0x8a, 0x8b, 0x8b, 0x8b, 0x8d, 0x8d, 0x8d, 0x8e, 0x97, 0x8e, 0x97, 0x8d, 0x97, 0x97, 0x97, 0x97, 0x9e, 0x9e, 0x9a, 0x9f, 0x9f, 0xa4, 0x9b, 0xa4, 0x9b, 0xa4, 0xa4, 0xad, 0xa9, 0xa9, 0xab, 0xa3, 0x8f, 0xbb, 0xbb, 0x85, 0xcd, 0xc9, 0x8f, 0x9c, 0xa3, 0x7b, 0x52, 0x3d, 0x44, 0x44, 0x4c, 0x44, 0x44, 0x3d, 0x3d, 0x44, 0x52, 0x69, 0x97, 0xa3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xad, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xb7, 0xa2, 0x70, 0x4c, 0x3d, 0x44, 0x45, 0x45, 0x45, 0x3d, 0x42, 0x42, 0x42, 0x3c, 0x59, 0xa6, 0xcd, 0xc0, 0xa5, 0xa3, 0xb8, 0xa9, 0x8e, 0xb7, 0xb7, 0xad, 0xa4, 0x9f, 0xa4, 0xa4, 0xb1, 0xb1, 0x9f, 0xa2, 0xa4, 0xa4, 0xa4, 0x9b, 0x9b, 0x9b, 0x92, 0x93, 0x93, 0x8a, 0x8d, 0x8b, 0x8b, 0x8b, 0x8a, 0x83, 0x89, 0x92, 0x89, 0x62, 0x9c, 0xbf, 0xd0, 0x0c, 0x03, 0xdf, 0x03, 0x00, 0xfb, 0x63, 0xd4, 0xb4, 0x5d, 0x5f, 0x5c, 0x64, 0x5e, 0x5f, 0x4a, 0x25, 0x1d, 0x14, 0x12, 0x1c, 0x16, 0x12, 0x46, 0xd7, 0xb3, 0x4a, 0x59, 0xb9, 0xd6, 0x28, 0xdd, 0xe6, 0xe4, 0xe8, 0xe3, 0x00, 0xe8, 0xdd, 0x01, 0x02, 0xe1, 0xe1, 0xdf, 0xe1, 0x02, 0xec, 0x00, 0xec, 0x02, 0x08, 0xc4, 0xd6, 0x80, 0x59, 0x5e, 0x53, 0x67, 0x6b, 0x57, 0x62, 0x62, 0x52, 0x4c, 0x90, 0xd1, 0xd6, 0x13, 0xdd, 0x00, 0xe5, 
-  0x0b, 0x99, 0xd3, 0x7f, 0x44, 0x78, 0x65, 0x51, 0x3c, 0x3c, 0x51, 0x59, 0x59, 0x57, 0x6d, 0x64, 0x67, 0x66, 0xcf, 0x99, 0x0b, 0xfb, 0xfb, 0x3b, 0xd2, 0xda, 0x7c, 0x28, 0x2e, 0x79, 0xcf, 0xa7, 0x1d, 0x21, 0x55, 0x85, 0x8d, 0x8d, 0x8a, 0x8a, 0x8a, 0x8b, 0x8a, 0x8b, 0x8d, 0x8e, 0x96, 0x8e, 0x93, 0x93, 0x93, 0x9b, 0x96, 0x9b, 0x96, 0x9f, 0x96, 0x9f, 0x9f, 0x9f, 0xa4, 0x9f, 0xa4, 0xa4, 0xad, 0x9a, 0x9b, 0x9f, 0xad, 0xa2, 0xa3, 0xa3, 0xb9, 0xa6, 0x85, 0xa6, 0xc9, 0xa5, 0x8f, 0xb8, 0xb8, 0xa2, 0x86, 0x52, 0x4c, 0x44, 0x3d, 0x3d, 0x4c, 0x52, 0x70, 0x8d, 0x9e, 0xab, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x9e, 0xa9, 0x8d, 0x52, 0x3d, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x45, 0x45, 0x3d, 0x42, 0x59, 0xcd, 0xcd, 0x90, 0x9c, 0xaf, 0x9e, 0xa9, 0xb1, 0x9a, 0x96, 0x9a, 0xa2, 0xa9, 0xad, 0xad, 0xa4, 0xad, 0xad, 0xad, 0x9b, 0x93, 0x92, 0x9b, 0x9b, 0x9b, 0x92, 0x8e, 0x8e, 0x8a, 0x8d, 0x8b, 0x86, 0x8a, 0x7d, 0x89, 0x92, 0x81, 0x77, 0x85, 0xac, 0xd6, 0x3b, 0x03, 0xdd, 0x01, 0x01, 0x24, 0xcc, 0xca, 0x97, 0x62, 0x5e, 0x5c, 0x5c, 0x5e, 0x5d, 0x51, 0x25, 0x14, 0x14, 0x23, 0x20, 0x14, 0x1c, 0x58, 0xd4, 0xb6, 0x51, 0x5d, 0x9c, 0xd3, 0x46, 0x04, 0xe3, 0xe3, 0xe7, 0xe4, 0xe1, 0x03, 0xdf, 0x03, 0xec, 0xdf, 0xe0, 0xdf, 0xe1, 0x02, 0xec, 0xec, 0x00, 0xfb, 0x32, 0xd5, 0xb6, 0x5d, 0x5c, 0x5a, 0x64, 0x6d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5f, 0x5d, 0xa6, 0xd3, 0x94, 0x0a, 0xec, 0xe4, 
-  0x24, 0xd8, 0xbc, 0x45, 0x5f, 0x76, 0x34, 0x25, 0x1f, 0x1f, 0x25, 0x2f, 0x51, 0x5f, 0x64, 0x6a, 0x5a, 0x5d, 0x9d, 0xd9, 0x24, 0x00, 0xfc, 0x1b, 0xd7, 0xc8, 0x3a, 0x50, 0x50, 0x29, 0x56, 0xd4, 0x36, 0x18, 0x39, 0x66, 0xa0, 0x97, 0x88, 0x93, 0x88, 0x8e, 0x8a, 0x93, 0x8a, 0x96, 0x8d, 0x96, 0x96, 0x93, 0x96, 0x96, 0x96, 0x9a, 0x9f, 0x9a, 0x9f, 0x9e, 0x9f, 0x9e, 0x9f, 0xa2, 0x9e, 0x9a, 0xa4, 0x9a, 0x9a, 0xad, 0xb2, 0xa3, 0x98, 0xa5, 0xc9, 0x55, 0x39, 0xb3, 0xc9, 0x9c, 0xa0, 0xa0, 0x97, 0xa2, 0xa2, 0xa2, 0x8d, 0x8d, 0x97, 0xa2, 0x8b, 0x8d, 0x9e, 0xab, 0xb2, 0xb2, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa9, 0x96, 0xb7, 0xab, 0x68, 0x3d, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x45, 0x45, 0x42, 0x3d, 0x3c, 0x90, 0xd1, 0xb3, 0xa6, 0xb8, 0x8f, 0xb2, 0x8d, 0xaf, 0xb2, 0xaf, 0xaf, 0xab, 0xaf, 0x97, 0x98, 0x8b, 0x97, 0xab, 0xad, 0xa9, 0x96, 0x93, 0x9b, 0x93, 0x8e, 0x93, 0x8a, 0x8e, 0x8a, 0x8b, 0x8b, 0x7b, 0x88, 0x89, 0x89, 0x83, 0x71, 0x72, 0x87, 0xd3, 0xce, 0x19, 0x07, 0x09, 0x1b, 0xcc, 0xd7, 0xa7, 0x77, 0x57, 0x67, 0x5c, 0x5c, 0x5e, 0x5d, 0x43, 0x1a, 0x1d, 0x20, 0x12, 0x14, 0x12, 0x12, 0x79, 0xd3, 0x90, 0x51, 0x57, 0x72, 0xd1, 0xb5, 0x09, 0x00, 0xe0, 0xe5, 0xe6, 0xe1, 0xdd, 0x03, 0x02, 0xe1, 0xe0, 0xdf, 0xe0, 0xdf, 0x02, 0x02, 0xfd, 0x00, 0x0d, 0xcb, 0xd4, 0x66, 0x54, 0x6a, 0x53, 0x71, 0x62, 0x51, 0x3d, 0x3c, 0x3d, 0x51, 0x5d, 0x51, 0x55, 0xac, 0xdb, 0x22, 0xfb, 0xec, 
-  0x3b, 0xd8, 0x6c, 0x59, 0x7f, 0x2f, 0x1f, 0x3a, 0x91, 0x47, 0x21, 0x25, 0x4a, 0x76, 0x53, 0x61, 0x53, 0x57, 0x80, 0xda, 0x4d, 0x00, 0x07, 0x0a, 0xd0, 0xa1, 0x79, 0xd3, 0xa8, 0x3a, 0x36, 0xc7, 0xa8, 0x16, 0x21, 0x4e, 0x9c, 0x96, 0x82, 0x92, 0x92, 0x92, 0x8e, 0x93, 0x8d, 0x9a, 0x8d, 0x97, 0x96, 0x97, 0x96, 0x96, 0x97, 0x9f, 0x97, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0x9a, 0x9e, 0xad, 0xa9, 0xab, 0xaf, 0xa5, 0xa7, 0x6c, 0x27, 0x39, 0xc9, 0xc3, 0x98, 0x98, 0x8b, 0x8d, 0x9e, 0xab, 0xab, 0xa2, 0x9e, 0xa2, 0xab, 0xb7, 0xb2, 0xa9, 0x97, 0x97, 0x97, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xb2, 0xb2, 0x86, 0x52, 0x44, 0x44, 0x4c, 0x44, 0x44, 0x44, 0x42, 0x44, 0x45, 0x42, 0x42, 0x43, 0xd1, 0xc9, 0xb3, 0x9c, 0x8f, 0xa5, 0xaf, 0xa5, 0xa5, 0x9c, 0xa5, 0xa7, 0xb4, 0xa7, 0xb4, 0xb4, 0xb4, 0xa0, 0x98, 0x97, 0x8d, 0x96, 0xa9, 0x96, 0x8e, 0x8e, 0x8e, 0x8a, 0x8e, 0x8a, 0x8a, 0x7b, 0x86, 0x88, 0x89, 0x81, 0x82, 0x77, 0x66, 0x87, 0xd6, 0xcf, 0x50, 0x5b, 0xc7, 0xd6, 0xac, 0x72, 0x62, 0x57, 0x6d, 0x5c, 0x54, 0x68, 0x5d, 0x3c, 0x1d, 0x1a, 0x17, 0x17, 0x47, 0x8c, 0x5b, 0xba, 0xd1, 0x85, 0x62, 0x5f, 0x59, 0xc6, 0xd8, 0x15, 0x01, 0xe8, 0xe1, 0xe1, 0xec, 0x04, 0xdd, 0xe1, 0xe1, 0xdf, 0xe1, 0xdf, 0xdf, 0x02, 0x02, 0x01, 0xdd, 0x2a, 0xda, 0x9d, 0x52, 0x53, 0x61, 0x5c, 0x68, 0x51, 0x30, 0x21, 0x1d, 0x1d, 0x21, 0x30, 0x4b, 0x4b, 0x8c, 0xd4, 0x63, 0xfc, 0xfc, 
-  0x79, 0xd4, 0x6c, 0x66, 0x39, 0x1f, 0x5b, 0xda, 0xda, 0xd8, 0x47, 0x1d, 0x34, 0x69, 0x5a, 0x6a, 0x61, 0x71, 0x66, 0xc1, 0xb5, 0x08, 0x03, 0x04, 0x84, 0xc7, 0xbf, 0xd4, 0xd1, 0x87, 0x36, 0x8c, 0xce, 0x1c, 0x16, 0x2b, 0x66, 0x8d, 0x92, 0x89, 0x92, 0x92, 0x92, 0x93, 0x8e, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x97, 0x9e, 0x97, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa0, 0x9e, 0xa3, 0x9e, 0xb2, 0xb2, 0x9e, 0x8f, 0xa0, 0xb9, 0x95, 0x6c, 0x25, 0x1d, 0x80, 0xd1, 0x90, 0x8f, 0x8b, 0xa9, 0x97, 0x97, 0x97, 0x9e, 0x97, 0x97, 0x8d, 0x97, 0x97, 0x97, 0xa2, 0xa9, 0xab, 0xa9, 0xab, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa9, 0xb2, 0xa9, 0xa9, 0xa9, 0x76, 0x4c, 0x3d, 0x44, 0x44, 0x45, 0x45, 0x44, 0x42, 0x45, 0x45, 0x4b, 0x3c, 0xbc, 0xd1, 0xa6, 0x95, 0xb9, 0xa6, 0xbe, 0xb9, 0xa7, 0x90, 0x87, 0x6c, 0x6c, 0x6c, 0x6c, 0x87, 0x7e, 0x90, 0xa7, 0xb4, 0x9c, 0x98, 0x8d, 0x97, 0x8d, 0x8e, 0x8e, 0x8e, 0x93, 0x88, 0x8a, 0x7b, 0x86, 0x88, 0x7d, 0x81, 0x83, 0x82, 0x65, 0x72, 0xa7, 0xd1, 0xd1, 0xd3, 0xd1, 0x90, 0x66, 0x69, 0x57, 0x67, 0x64, 0x5c, 0x5c, 0x68, 0x5d, 0x2f, 0x1f, 0x17, 0x29, 0xba, 0xd2, 0xbf, 0xcf, 0xd1, 0xd1, 0x7f, 0x62, 0x6b, 0x4c, 0xa6, 0xd7, 0x4d, 0x06, 0x00, 0xec, 0xec, 0x00, 0xfd, 0xdd, 0x02, 0xec, 0x02, 0x01, 0x01, 0x02, 0xdf, 0xdf, 0xdd, 0x07, 0x84, 0xd7, 0x55, 0x57, 0x6a, 0x61, 0x6b, 0x5d, 0x39, 0x1d, 0x16, 0x26, 0x26, 0x14, 0x18, 0x27, 0x4b, 0x80, 0xba, 0xd8, 0x0a, 0xfb, 
-  0x91, 0xcf, 0x6c, 0x36, 0x21, 0x79, 0xdb, 0x99, 0x28, 0xcc, 0x94, 0x16, 0x25, 0x5d, 0x73, 0x6a, 0x74, 0x5a, 0x55, 0xb6, 0xdc, 0x15, 0x00, 0xdd, 0x28, 0xd8, 0x9d, 0xd1, 0xd1, 0x56, 0x2d, 0x6e, 0xcc, 0x23, 0x16, 0x1f, 0x39, 0x7f, 0xb1, 0x82, 0x92, 0x92, 0x93, 0x93, 0x9a, 0x9a, 0x97, 0x97, 0x96, 0x97, 0x96, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa0, 0x9e, 0xa0, 0x9e, 0xa3, 0xa0, 0xa3, 0xa3, 0xab, 0xa5, 0xa5, 0xb9, 0xa7, 0x48, 0x25, 0x16, 0x1f, 0xc6, 0xd1, 0x7e, 0xa0, 0x8b, 0xa9, 0x9e, 0x97, 0x97, 0x97, 0xab, 0xb2, 0xb2, 0xb2, 0x97, 0x9e, 0x9e, 0xa9, 0xa9, 0xa9, 0xa2, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x96, 0xa9, 0xc2, 0xa9, 0x5d, 0x44, 0x3d, 0x3d, 0x45, 0x45, 0x45, 0x44, 0x45, 0x44, 0x42, 0x43, 0x80, 0xcd, 0xc6, 0xbc, 0xb3, 0x6c, 0x6c, 0x3c, 0x36, 0x2b, 0x21, 0x1f, 0x1a, 0x1a, 0x18, 0x27, 0x2b, 0x39, 0x55, 0x87, 0x90, 0x9c, 0xa5, 0x98, 0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x89, 0x8a, 0x86, 0x86, 0x7b, 0x83, 0x7d, 0x89, 0x82, 0x82, 0x7f, 0x7f, 0x66, 0x7e, 0x8f, 0x65, 0x62, 0x62, 0x6b, 0x67, 0x67, 0x67, 0x54, 0x5e, 0x5f, 0x51, 0x2b, 0x14, 0x29, 0xba, 0xcf, 0x6e, 0x2c, 0x41, 0xb6, 0xd1, 0x77, 0x54, 0x67, 0x57, 0x6c, 0xca, 0xd0, 0x10, 0xdd, 0xfb, 0xfd, 0xec, 0xec, 0xec, 0xec, 0x02, 0xfb, 0x04, 0x03, 0x01, 0xdf, 0x02, 0x00, 0x0f, 0xcc, 0xca, 0x59, 0x5f, 0x61, 0x61, 0x5e, 0x51, 0x27, 0x18, 0x3e, 0xc8, 0xbd, 0x5b, 0x1f, 0x16, 0x2b, 0x3f, 0xba, 0xdb, 0x11, 0xfc, 
-  0x50, 0xd2, 0x6e, 0x27, 0x47, 0xda, 0xb5, 0x0c, 0xfc, 0xc4, 0xc8, 0x1d, 0x21, 0x55, 0x5a, 0x61, 0x6a, 0x53, 0x59, 0x95, 0xd8, 0x38, 0xdd, 0xdd, 0x0c, 0xc4, 0xba, 0x6e, 0x56, 0x3f, 0x36, 0xae, 0xb0, 0x19, 0x1c, 0x1a, 0x25, 0x43, 0x8f, 0x96, 0x8e, 0x96, 0x93, 0x96, 0x96, 0x96, 0x9a, 0x9a, 0x9a, 0x96, 0x9f, 0x9a, 0x9f, 0x9f, 0xa2, 0xa2, 0xa2, 0x9e, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa3, 0x8f, 0x9c, 0xb4, 0xb4, 0x87, 0x43, 0x25, 0x14, 0x1a, 0x2d, 0xca, 0xc6, 0x85, 0xaf, 0xa9, 0x8a, 0xa9, 0x9e, 0x8d, 0x97, 0x8d, 0x97, 0x8d, 0x8d, 0xb2, 0xa9, 0x9e, 0x97, 0x8d, 0x97, 0x9e, 0x9e, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa9, 0xa2, 0xa9, 0xad, 0xb2, 0xb2, 0x97, 0x69, 0x52, 0x45, 0x44, 0x44, 0x44, 0x45, 0x44, 0x3d, 0x42, 0x4b, 0x87, 0xcd, 0xd1, 0x9d, 0x48, 0x36, 0x27, 0x1d, 0x1d, 0x18, 0x17, 0x18, 0x18, 0x1a, 0x1a, 0x18, 0x17, 0x17, 0x1d, 0x27, 0x36, 0x6c, 0xb9, 0x90, 0x8f, 0x8d, 0x8d, 0x8e, 0x8e, 0x92, 0x88, 0x86, 0x86, 0x82, 0x81, 0x81, 0x7d, 0x7d, 0x83, 0x62, 0x8e, 0x69, 0x5f, 0x62, 0x71, 0x7d, 0x60, 0x6d, 0x5c, 0x5c, 0x64, 0x54, 0x5e, 0x5d, 0x45, 0x25, 0x17, 0x56, 0xcf, 0x47, 0x29, 0x3f, 0x4f, 0x6e, 0xcd, 0x77, 0x54, 0x60, 0x5c, 0x59, 0x9d, 0xd7, 0x4d, 0x0a, 0xfc, 0xfd, 0xec, 0xe3, 0xe0, 0xec, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xdf, 0xdf, 0xdd, 0x2a, 0xd7, 0x9d, 0x59, 0x68, 0x54, 0x5e, 0x52, 0x51, 0x1f, 0x23, 0xcc, 0xdb, 0xb5, 0xda, 0x6f, 0x25, 0x16, 0x25, 0x91, 0xd8, 0x1b, 0x06, 
-  0x28, 0xd8, 0x79, 0x6f, 0xd5, 0xb5, 0x0f, 0x01, 0x09, 0xcc, 0xc1, 0x16, 0x1f, 0x51, 0x54, 0x6a, 0x61, 0x53, 0x5f, 0x7e, 0xc5, 0xaa, 0x07, 0x03, 0x00, 0x4d, 0xd8, 0x8c, 0x3f, 0x3f, 0x3e, 0xd2, 0x7c, 0x12, 0x14, 0x1d, 0x17, 0x25, 0x4a, 0x9c, 0x8f, 0x8d, 0x98, 0x8d, 0x9a, 0x96, 0x9a, 0x9b, 0x9f, 0x96, 0x9f, 0x9f, 0xa4, 0x9f, 0xa4, 0xa4, 0x9f, 0x9f, 0xa2, 0x9e, 0xa2, 0xa2, 0xab, 0xa0, 0xa5, 0xa5, 0xb3, 0x87, 0x36, 0x1a, 0x14, 0x20, 0x14, 0x41, 0xd4, 0xc6, 0x90, 0x85, 0xb7, 0x8a, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9e, 0x9e, 0xab, 0xa2, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xb7, 0xb2, 0x96, 0xa9, 0xb7, 0xb8, 0x8b, 0x52, 0x44, 0x3d, 0x44, 0x44, 0x44, 0x44, 0x45, 0x7e, 0xa6, 0xc6, 0xd1, 0x48, 0x18, 0x1d, 0x16, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1c, 0x18, 0x17, 0x1a, 0x1a, 0x1d, 0x1d, 0x1a, 0x1a, 0x25, 0x39, 0x87, 0x8f, 0x8f, 0x8d, 0x8e, 0x8e, 0x92, 0x88, 0x8a, 0x7b, 0x82, 0x89, 0x89, 0x73, 0x73, 0x81, 0x7d, 0x6b, 0x83, 0x6d, 0x73, 0x81, 0x53, 0x74, 0x64, 0x5c, 0x5c, 0x5c, 0x57, 0x68, 0x51, 0x42, 0x14, 0x27, 0xc7, 0xa8, 0x2d, 0x47, 0xc7, 0xc7, 0x56, 0xd3, 0x98, 0x62, 0x6a, 0x67, 0x4c, 0x85, 0xcf, 0xd8, 0x28, 0x03, 0xfb, 0xe6, 0xe3, 0xe5, 0xec, 0xfb, 0xfc, 0xfc, 0xfc, 0x01, 0xe1, 0xdf, 0x00, 0x63, 0xd7, 0x6c, 0x51, 0x70, 0x54, 0x57, 0x5d, 0x4a, 0x12, 0x31, 0xdb, 0x63, 0x15, 0xb5, 0xda, 0x5b, 0x14, 0x23, 0x91, 0xda, 0x22, 0x04, 
-  0x09, 0x63, 0xdc, 0xda, 0x75, 0x0f, 0xfb, 0x07, 0x63, 0xcc, 0xbd, 0x2d, 0x18, 0x4b, 0x6b, 0x53, 0x53, 0x5e, 0x62, 0x45, 0xcd, 0xd2, 0x13, 0x00, 0xdd, 0x10, 0xd9, 0xcc, 0xbd, 0xc7, 0xce, 0xbd, 0x23, 0x17, 0x12, 0x1a, 0x1a, 0x1a, 0x27, 0x39, 0x95, 0x90, 0x9c, 0xa0, 0x97, 0x96, 0x92, 0xa4, 0x9a, 0x9b, 0x9f, 0x9b, 0xa4, 0xa4, 0xa4, 0xad, 0xb1, 0xa4, 0x9a, 0x9f, 0xb2, 0xb2, 0xab, 0xa0, 0xb4, 0xb3, 0x6c, 0x2b, 0x17, 0x17, 0x1d, 0x1d, 0x14, 0x5b, 0xcf, 0x9d, 0x90, 0xa3, 0x9a, 0x9a, 0xab, 0x8d, 0x8b, 0x97, 0xb2, 0xaf, 0xa9, 0x97, 0x97, 0x9e, 0x9e, 0xa2, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xad, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xb2, 0xa9, 0xab, 0x9e, 0x8b, 0x70, 0x4c, 0x45, 0x4c, 0x5d, 0x7f, 0x98, 0xb9, 0xb4, 0xd1, 0x80, 0x16, 0x1f, 0x16, 0x1d, 0x1d, 0x1d, 0x14, 0x14, 0x17, 0x1c, 0x17, 0x17, 0x23, 0x1a, 0x12, 0x1d, 0x1d, 0x17, 0x1d, 0x27, 0x6c, 0x9c, 0x8f, 0x8d, 0x8a, 0x81, 0x93, 0x88, 0x86, 0x88, 0x81, 0x81, 0x81, 0x7a, 0x81, 0x7d, 0x78, 0x78, 0x78, 0x6d, 0x6a, 0x6a, 0x6a, 0x64, 0x60, 0x5c, 0x5e, 0x68, 0x5d, 0x4a, 0x2f, 0x14, 0x36, 0xc7, 0x56, 0x35, 0x8c, 0xd3, 0xcf, 0x9d, 0xd1, 0x98, 0x54, 0x6a, 0x61, 0x5e, 0x52, 0x6c, 0xd4, 0xc5, 0x1b, 0xdd, 0x00, 0xe7, 0xe5, 0xe4, 0xfd, 0xfc, 0xdd, 0xfb, 0x05, 0xe0, 0x00, 0x06, 0xcb, 0xcf, 0x55, 0x5d, 0x57, 0x57, 0x5f, 0x52, 0x30, 0x16, 0x3e, 0xd5, 0x4d, 0xfb, 0x11, 0xc4, 0xd5, 0x50, 0x12, 0x94, 0xd5, 0x0f, 0x03, 
-  0xdd, 0x10, 0x24, 0x1e, 0x10, 0xfc, 0xdd, 0x15, 0xd5, 0xda, 0xce, 0x23, 0x18, 0x34, 0x5d, 0x7d, 0x68, 0x54, 0x67, 0x57, 0x90, 0xd1, 0x58, 0x06, 0x07, 0xdd, 0x40, 0xdb, 0xc8, 0xae, 0x58, 0x23, 0x14, 0x20, 0x20, 0x17, 0x1d, 0x16, 0x14, 0x1f, 0x36, 0x56, 0xa6, 0x87, 0x7f, 0x96, 0xb1, 0x89, 0xb1, 0x9f, 0xa4, 0xa4, 0xa4, 0xa4, 0x9b, 0x9b, 0x9a, 0xad, 0xb1, 0xb2, 0xa9, 0xab, 0xab, 0xb4, 0x87, 0x43, 0x21, 0x1a, 0x1a, 0x1a, 0x14, 0x14, 0x12, 0x5b, 0xd4, 0xac, 0x87, 0x98, 0xa9, 0xb1, 0xb2, 0x98, 0x9e, 0xaf, 0xb8, 0xb8, 0xab, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0x9f, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa9, 0xa9, 0xad, 0xab, 0xad, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xad, 0xa9, 0xad, 0xa9, 0xa9, 0xa9, 0xa9, 0xb2, 0xb7, 0xb2, 0xa9, 0x97, 0x97, 0x9a, 0xab, 0x8b, 0x98, 0xb3, 0xd3, 0x9d, 0x16, 0x16, 0x17, 0x0e, 0x12, 0x17, 0x1c, 0x1a, 0x1c, 0x14, 0x16, 0x12, 0x17, 0x14, 0x17, 0x1c, 0x1a, 0x17, 0x1d, 0x21, 0x27, 0x4e, 0x98, 0x7f, 0x86, 0x93, 0x88, 0x88, 0x88, 0x89, 0x83, 0x81, 0x81, 0x81, 0x7d, 0x7a, 0x78, 0x73, 0x71, 0x6d, 0x6d, 0x64, 0x6a, 0x64, 0x73, 0x5c, 0x57, 0x5d, 0x72, 0x3c, 0x21, 0x18, 0x2d, 0xd6, 0x4f, 0x3a, 0x8c, 0xd6, 0xcf, 0xba, 0xca, 0x85, 0x57, 0x6a, 0x61, 0x6a, 0x57, 0x7f, 0x95, 0xd3, 0xbd, 0x11, 0xdd, 0xe4, 0xe9, 0xe4, 0xe3, 0xec, 0xde, 0x00, 0x00, 0xe6, 0xdd, 0x1e, 0xd0, 0xbc, 0x51, 0x62, 0x67, 0x5c, 0x5f, 0x5d, 0x2b, 0x17, 0x3a, 0xcc, 0x75, 0x09, 0xfb, 0x0d, 0xb0, 0xff, 0x99, 0xd9, 0x99, 0x09, 0x03, 
-  0xdd, 0xdd, 0xdd, 0xfb, 0x01, 0xdd, 0xfb, 0x4d, 0x94, 0xae, 0xd4, 0x29, 0x1f, 0x2b, 0x51, 0x62, 0x57, 0x57, 0x54, 0x7d, 0x62, 0xc6, 0xd7, 0x2e, 0x06, 0xdd, 0x0f, 0xc4, 0xc1, 0x31, 0x0e, 0x1c, 0x12, 0x1d, 0x17, 0x14, 0x21, 0x20, 0x16, 0x18, 0x16, 0x25, 0x41, 0x87, 0xb9, 0xb8, 0xa2, 0x8e, 0x8d, 0x8d, 0x96, 0x9e, 0x9f, 0xad, 0xad, 0xb7, 0xad, 0x9a, 0x97, 0xa0, 0xaf, 0xaf, 0x8f, 0x7e, 0x2b, 0x1f, 0x16, 0x1a, 0x20, 0x1d, 0x1c, 0x1c, 0x12, 0x5b, 0xd4, 0x9d, 0x7e, 0x8b, 0xc2, 0xc2, 0xb2, 0xa3, 0xa0, 0xb7, 0xbb, 0xc2, 0xab, 0x9e, 0x97, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x9a, 0xa2, 0xad, 0xb2, 0xa2, 0x9e, 0x97, 0x9a, 0xa9, 0xa0, 0xa5, 0xd1, 0xba, 0x46, 0x46, 0x58, 0x50, 0x31, 0x1c, 0x17, 0x17, 0x1c, 0x17, 0x17, 0x20, 0x20, 0x17, 0x17, 0x1c, 0x17, 0x16, 0x1a, 0x1d, 0x16, 0x2b, 0x6c, 0x8f, 0x8d, 0x8d, 0x88, 0x88, 0x89, 0x83, 0x89, 0x81, 0x81, 0x7d, 0x7d, 0x78, 0x78, 0x78, 0x78, 0x6d, 0x6d, 0x67, 0x67, 0x73, 0x67, 0x5e, 0x52, 0x5d, 0x55, 0x2f, 0x16, 0x21, 0x25, 0xd6, 0x4f, 0x2d, 0x41, 0x8c, 0x80, 0xca, 0xac, 0x65, 0x57, 0x6a, 0x61, 0x6a, 0x53, 0x5f, 0x51, 0xc6, 0xd4, 0xb5, 0x13, 0x00, 0xe3, 0xe8, 0xe4, 0xe7, 0xe7, 0xe3, 0xe3, 0x05, 0x01, 0x84, 0xd2, 0x90, 0x4c, 0x73, 0x5a, 0x6a, 0x62, 0x4c, 0x27, 0x18, 0x3e, 0xd8, 0xc4, 0x38, 0xfc, 0xfb, 0x0f, 0x75, 0xff, 0xb5, 0x1e, 0xdd, 0x06, 
-  0xdf, 0xdf, 0xdd, 0x05, 0xe3, 0x02, 0xdd, 0x63, 0x94, 0x8c, 0xd7, 0x47, 0x12, 0x25, 0x59, 0x5d, 0x4c, 0x78, 0x53, 0x6d, 0x6b, 0x8f, 0xd3, 0xc8, 0x3b, 0x1e, 0x04, 0x3b, 0xd7, 0xae, 0x20, 0x20, 0x26, 0x1d, 0x17, 0x14, 0x14, 0x12, 0x12, 0x1c, 0x1c, 0x16, 0x18, 0x36, 0x48, 0x66, 0x8f, 0xbb, 0xaf, 0xa0, 0xa0, 0x98, 0x97, 0x98, 0x9e, 0xa0, 0x98, 0xa0, 0xaf, 0xc0, 0xb9, 0x7e, 0x39, 0x25, 0x1a, 0x1d, 0x1d, 0x1d, 0x17, 0x14, 0x14, 0x17, 0x1c, 0x5b, 0xd4, 0x9d, 0x7e, 0xa5, 0xc2, 0xc2, 0xb8, 0xab, 0x98, 0xaf, 0xc2, 0xbb, 0xa9, 0x97, 0x97, 0x9e, 0x96, 0x9e, 0x9f, 0x9f, 0x9f, 0x9e, 0x9f, 0xa2, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0x9a, 0x9e, 0x9e, 0x9e, 0x9e, 0x9a, 0x9e, 0xa2, 0xa4, 0x97, 0x9c, 0xca, 0xd6, 0xda, 0xd5, 0xd9, 0xd9, 0xc1, 0x6f, 0x35, 0x1c, 0x12, 0x16, 0x1d, 0x12, 0x12, 0x17, 0x1c, 0x14, 0x14, 0x17, 0x17, 0x18, 0x1a, 0x1d, 0x2f, 0x7e, 0x8f, 0x76, 0x8d, 0x89, 0x88, 0x89, 0x83, 0x83, 0x7d, 0x83, 0x7d, 0x78, 0x7d, 0x71, 0x71, 0x68, 0x6d, 0x68, 0x67, 0x6d, 0x54, 0x57, 0x77, 0x66, 0x2f, 0x21, 0x1a, 0x14, 0x20, 0xba, 0xc7, 0x47, 0x36, 0x41, 0x9d, 0xca, 0x87, 0x51, 0x6d, 0x61, 0x61, 0x6a, 0x5a, 0x57, 0x68, 0x51, 0xc6, 0xd4, 0xc1, 0x1e, 0x03, 0x00, 0xe2, 0x00, 0xe3, 0xde, 0x01, 0x04, 0x13, 0xd6, 0xc6, 0x65, 0x57, 0x64, 0x5a, 0x61, 0x67, 0x39, 0x21, 0x14, 0x4f, 0xd8, 0xc8, 0xc4, 0x1e, 0x06, 0xdd, 0xfd, 0x10, 0xe2, 0x00, 0x04, 0xdd, 
-  0xe1, 0x02, 0xe6, 0xe1, 0xe3, 0xe6, 0x00, 0x4d, 0xae, 0x6f, 0xd6, 0x79, 0x12, 0x18, 0x4a, 0x59, 0x57, 0x71, 0x60, 0x60, 0x54, 0x52, 0x85, 0xd1, 0xd6, 0xd7, 0xae, 0xbd, 0xcf, 0xd3, 0x79, 0x12, 0x14, 0x12, 0x1d, 0x3a, 0x41, 0x3e, 0x29, 0x12, 0x16, 0x1c, 0x18, 0x16, 0x18, 0x27, 0x43, 0x4e, 0x90, 0x9c, 0xa7, 0xb4, 0xb9, 0xb4, 0xa7, 0xb4, 0xa7, 0xb4, 0x95, 0x6c, 0x39, 0x27, 0x1d, 0x17, 0x1d, 0x17, 0x1a, 0x14, 0x17, 0x17, 0x1c, 0x17, 0x16, 0x50, 0xd4, 0xb6, 0x90, 0x98, 0xb7, 0xb7, 0xc2, 0xa3, 0x97, 0xa3, 0xbb, 0xc2, 0xb2, 0x97, 0x9a, 0x97, 0x9e, 0x96, 0x9e, 0x9a, 0x9f, 0x9f, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa9, 0xa9, 0xa2, 0xa2, 0xa2, 0xa2, 0x9e, 0x9e, 0xad, 0xa9, 0xa2, 0x9a, 0x96, 0x9a, 0xad, 0xad, 0x9b, 0x96, 0xa6, 0xca, 0xd0, 0x84, 0x38, 0x32, 0x4d, 0xc4, 0xd9, 0xd8, 0x5b, 0x29, 0x35, 0x41, 0x41, 0x2d, 0x20, 0x14, 0x14, 0x1c, 0x20, 0x12, 0x1c, 0x1f, 0x16, 0x1a, 0x43, 0x7e, 0x7e, 0x8d, 0x88, 0x89, 0x88, 0x83, 0x83, 0x7b, 0x7d, 0x7b, 0x78, 0x78, 0x78, 0x71, 0x6d, 0x68, 0x68, 0x68, 0x6b, 0x5e, 0x77, 0x65, 0x43, 0x25, 0x1a, 0x1d, 0x16, 0x1d, 0x35, 0xbd, 0xd3, 0xba, 0xbf, 0xd3, 0xb3, 0x55, 0x57, 0x73, 0x5a, 0x5a, 0x61, 0x60, 0x73, 0x4c, 0x82, 0x51, 0xb3, 0xd3, 0xd8, 0x3b, 0x09, 0x07, 0x00, 0x00, 0x00, 0x01, 0x13, 0xd2, 0xd3, 0x8f, 0x52, 0x67, 0x64, 0x53, 0x74, 0x6b, 0x2f, 0x1f, 0x12, 0x6e, 0xd6, 0x58, 0xb0, 0x38, 0xdd, 0x0b, 0x02, 0x00, 0xe2, 0x08, 0x05, 0x00, 
-  0x01, 0xfb, 0x05, 0xe1, 0xe4, 0xe8, 0x00, 0x1e, 0xc1, 0x79, 0xbd, 0xc5, 0x1c, 0x16, 0x2f, 0x52, 0x62, 0x54, 0x6a, 0x64, 0x53, 0x57, 0x5d, 0x66, 0xa6, 0xac, 0xd1, 0xd1, 0xca, 0xd3, 0xd6, 0x3a, 0x16, 0x2c, 0xa8, 0xcf, 0xd4, 0xd4, 0xcf, 0x79, 0x23, 0x1c, 0x16, 0x16, 0x1a, 0x1a, 0x1d, 0x1d, 0x2b, 0x36, 0x43, 0x56, 0x6c, 0x6c, 0x6c, 0x55, 0x4e, 0x41, 0x2b, 0x21, 0x14, 0x14, 0x17, 0x20, 0x1c, 0x14, 0x14, 0x1c, 0x1c, 0x14, 0x14, 0x17, 0x12, 0x3a, 0xd3, 0xbc, 0x90, 0x85, 0xb7, 0xb7, 0xbb, 0xa3, 0x8b, 0x98, 0xab, 0xaf, 0x9e, 0x97, 0x97, 0x96, 0x96, 0x96, 0x9f, 0x96, 0x9f, 0x96, 0xa9, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0x9e, 0x9e, 0x9e, 0x9e, 0x9a, 0x9a, 0x96, 0x96, 0x96, 0x93, 0x8d, 0x93, 0xa4, 0x8e, 0xa6, 0xd3, 0xc1, 0x11, 0xdd, 0x00, 0x01, 0x0c, 0x2e, 0xbd, 0xd8, 0xcf, 0xcf, 0xd3, 0xd3, 0xc7, 0x6e, 0x3a, 0x20, 0x17, 0x14, 0x1c, 0x1c, 0x17, 0x18, 0x1a, 0x21, 0x4e, 0xa5, 0x7f, 0x86, 0x89, 0x88, 0x83, 0x7b, 0x7b, 0x7b, 0x7d, 0x78, 0x7d, 0x71, 0x71, 0x71, 0x6b, 0x68, 0x6b, 0x54, 0x77, 0x77, 0x43, 0x27, 0x1d, 0x17, 0x17, 0x20, 0x1c, 0x16, 0x2d, 0x8c, 0x9d, 0xd6, 0xd1, 0x7e, 0x4c, 0x67, 0x6a, 0x5a, 0x61, 0x5a, 0x60, 0x54, 0x6d, 0x54, 0x70, 0x45, 0xb3, 0xd1, 0xd6, 0xc5, 0x3b, 0x1b, 0x15, 0x28, 0x63, 0xc5, 0xd1, 0xa5, 0x5d, 0x54, 0x71, 0x5e, 0x54, 0x6b, 0x59, 0x25, 0x1a, 0x1a, 0xba, 0xd4, 0x35, 0xa1, 0x49, 0x03, 0x01, 0x00, 0xe4, 0xe3, 0x00, 0x00, 0x09, 
-  0xfb, 0xfb, 0xfb, 0xe3, 0xe5, 0xe7, 0x00, 0x07, 0x94, 0xce, 0xc5, 0xd0, 0x2c, 0x16, 0x21, 0x51, 0x67, 0x53, 0x73, 0x5c, 0x54, 0x78, 0x68, 0x4c, 0x69, 0x59, 0x59, 0x55, 0x6c, 0x87, 0xc6, 0xd1, 0x31, 0xa1, 0xce, 0x6e, 0x3a, 0x41, 0x8c, 0xd4, 0xa8, 0x31, 0x12, 0x14, 0x1c, 0x16, 0x16, 0x1d, 0x14, 0x17, 0x1d, 0x21, 0x21, 0x1f, 0x1d, 0x1a, 0x18, 0x16, 0x14, 0x17, 0x17, 0x20, 0x17, 0x14, 0x14, 0x17, 0x17, 0x1c, 0x17, 0x14, 0x20, 0x29, 0x31, 0x5b, 0xd3, 0xbc, 0x90, 0x7f, 0xa9, 0xb2, 0xab, 0xa0, 0xa0, 0xa3, 0xa3, 0x9e, 0xa0, 0xa9, 0x97, 0x97, 0x96, 0x96, 0x96, 0x9f, 0x96, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa2, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa2, 0x9e, 0x9e, 0x9a, 0x9a, 0xa2, 0x9f, 0xa2, 0xa4, 0x9e, 0x9f, 0x9a, 0x93, 0x9b, 0x86, 0xa6, 0xd3, 0xcb, 0x0a, 0xdd, 0x05, 0x04, 0xfb, 0xfc, 0x46, 0xce, 0x8c, 0x5b, 0x3f, 0x3f, 0x8c, 0xc7, 0xc7, 0x5b, 0x20, 0x12, 0x20, 0x1c, 0x14, 0x1d, 0x1d, 0x1a, 0x2b, 0x6c, 0x8f, 0x86, 0x88, 0x83, 0x86, 0x82, 0x7b, 0x7b, 0x7b, 0x7d, 0x73, 0x7d, 0x73, 0x6d, 0x6b, 0x6b, 0x62, 0x5e, 0x62, 0x44, 0x2b, 0x1d, 0x1d, 0x1a, 0x14, 0x12, 0x20, 0x20, 0x16, 0x12, 0x2d, 0xca, 0xc6, 0x52, 0x54, 0x74, 0x61, 0x5a, 0x74, 0x5c, 0x5e, 0x54, 0x5e, 0x5c, 0x53, 0x7d, 0x52, 0x7e, 0xb9, 0xd1, 0xd3, 0xda, 0xd8, 0xc1, 0xd7, 0xd3, 0x90, 0x69, 0x54, 0x5e, 0x68, 0x52, 0x69, 0x5d, 0x42, 0x18, 0x14, 0x26, 0xca, 0xcf, 0x3f, 0xbd, 0x3b, 0x04, 0x00, 0xe7, 0xea, 0xe4, 0xe1, 0x08, 0x00, 
-  0x06, 0xfc, 0xfb, 0xec, 0xe4, 0xe0, 0xdd, 0x04, 0x0c, 0xaa, 0xd5, 0xd0, 0x58, 0x1c, 0x16, 0x34, 0x62, 0x67, 0x54, 0x53, 0x64, 0x5c, 0x53, 0x68, 0x54, 0x68, 0x70, 0x5d, 0x59, 0x7e, 0xb4, 0xd1, 0xcf, 0xd2, 0x5b, 0x29, 0x3a, 0x3a, 0x2d, 0x47, 0xd4, 0x6e, 0x29, 0x14, 0x16, 0x1c, 0x19, 0x14, 0x1c, 0x1d, 0x17, 0x1a, 0x17, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x17, 0x17, 0x14, 0x17, 0x1c, 0x14, 0x1c, 0x1c, 0x12, 0x23, 0x50, 0xc5, 0xd7, 0xd4, 0xcf, 0xd6, 0xc6, 0x90, 0x8f, 0x8d, 0x86, 0xa3, 0xaf, 0xbb, 0xc2, 0xb8, 0xa3, 0xab, 0xc2, 0x8d, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x9f, 0x96, 0x9f, 0x9a, 0xa2, 0x9e, 0x9f, 0xa2, 0x9f, 0xa2, 0xa2, 0xa2, 0xa2, 0xa9, 0xad, 0xa2, 0xa9, 0xa9, 0xa9, 0xa3, 0xa9, 0xa3, 0xab, 0xa3, 0xab, 0xa3, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa2, 0xa4, 0xa2, 0xa4, 0x9e, 0x9f, 0x9e, 0x9a, 0x9f, 0x9a, 0x9a, 0x9a, 0x9f, 0x96, 0x96, 0x93, 0xa4, 0x96, 0x95, 0xbf, 0xcb, 0x09, 0xdf, 0x00, 0x03, 0x01, 0x09, 0x6f, 0xbd, 0x3f, 0x2d, 0x39, 0x36, 0x36, 0x36, 0x8c, 0xd4, 0x79, 0x20, 0x14, 0x14, 0x1c, 0x18, 0x18, 0x1d, 0x1a, 0x2b, 0x7e, 0x8b, 0x86, 0x86, 0x86, 0x7b, 0x7b, 0x82, 0x7d, 0x7d, 0x7d, 0x73, 0x71, 0x6b, 0x6b, 0x62, 0x69, 0x77, 0x42, 0x2b, 0x1d, 0x1d, 0x17, 0x17, 0x1c, 0x20, 0x12, 0x18, 0x20, 0x16, 0x8c, 0xd6, 0x87, 0x52, 0x53, 0x74, 0x5a, 0x5a, 0x74, 0x60, 0x5c, 0x6b, 0x54, 0x5c, 0x73, 0x54, 0x67, 0x77, 0x4c, 0x72, 0x85, 0x9d, 0xbc, 0xba, 0x87, 0x55, 0x62, 0x5c, 0x53, 0x78, 0x5e, 0x4c, 0x69, 0x51, 0x2f, 0x18, 0x19, 0x2c, 0xce, 0xa8, 0x46, 0xc1, 0x1e, 0x03, 0x00, 0xe6, 0xe3, 0xe3, 0xe2, 0xdd, 0xfb, 
-  0xfc, 0xfb, 0xfb, 0xec, 0xe1, 0xe1, 0xe1, 0x02, 0x03, 0x07, 0x24, 0xd9, 0xaa, 0x19, 0x1a, 0x21, 0x51, 0x69, 0x54, 0x54, 0x6a, 0x6a, 0x53, 0x61, 0x53, 0x5c, 0x5e, 0x70, 0x62, 0x69, 0x8d, 0xa5, 0xd3, 0xd4, 0x5b, 0x5b, 0xba, 0xa8, 0x48, 0x2d, 0x4f, 0xcf, 0x4f, 0x1a, 0x14, 0x12, 0x23, 0x19, 0x14, 0x1d, 0x1d, 0x17, 0x20, 0x14, 0x1a, 0x14, 0x1d, 0x12, 0x20, 0x1c, 0x12, 0x1c, 0x14, 0x1c, 0x14, 0x1c, 0x17, 0x29, 0xa1, 0xd7, 0xbd, 0x46, 0x47, 0x50, 0xd3, 0xd1, 0x90, 0xa5, 0x86, 0x8d, 0xaf, 0xaf, 0xaf, 0xbb, 0xb8, 0xb8, 0xb2, 0xb8, 0x9a, 0x97, 0x96, 0x96, 0x96, 0x96, 0x9f, 0x96, 0x93, 0xb1, 0xa9, 0x8d, 0xa9, 0x9f, 0x93, 0x9f, 0xa0, 0xab, 0xa0, 0x96, 0x9f, 0xad, 0xb2, 0x9a, 0xa3, 0xa3, 0xb2, 0x97, 0xa3, 0xa3, 0xaf, 0x97, 0x98, 0x97, 0xa3, 0x97, 0x96, 0x9a, 0x9f, 0xa4, 0x9f, 0x9f, 0x9f, 0x9a, 0x9f, 0x9a, 0x96, 0x96, 0x9f, 0x96, 0x9f, 0x96, 0x96, 0x96, 0x96, 0x93, 0x8e, 0x97, 0x90, 0xd2, 0xaa, 0x07, 0x00, 0x00, 0x01, 0xdd, 0x0e, 0xd8, 0x5b, 0x36, 0x48, 0x36, 0x36, 0x3f, 0x41, 0x2f, 0x56, 0xca, 0x4f, 0x1a, 0x20, 0x1c, 0x16, 0x17, 0x18, 0x16, 0x1f, 0x2b, 0x6c, 0x7f, 0x8f, 0x76, 0x77, 0x82, 0x7d, 0x5e, 0x5c, 0x7d, 0x77, 0x62, 0x69, 0x7e, 0x72, 0x4e, 0x2f, 0x25, 0x21, 0x14, 0x17, 0x14, 0x12, 0x12, 0x19, 0x16, 0x18, 0x12, 0x2d, 0xd3, 0xb6, 0x3f, 0x65, 0x52, 0x53, 0x6a, 0x74, 0x6a, 0x61, 0x6a, 0x64, 0x5e, 0x5e, 0x5f, 0x57, 0x57, 0x5c, 0x62, 0x62, 0x52, 0x59, 0x59, 0x59, 0x5d, 0x57, 0x60, 0x74, 0x5a, 0x61, 0x6d, 0x57, 0x59, 0x42, 0x21, 0x1d, 0x12, 0x6f, 0xd0, 0x99, 0xb5, 0x75, 0x06, 0x01, 0x01, 0xe1, 0xe3, 0xe1, 0xe1, 0xec, 0xe1, 
-  0x01, 0x01, 0x01, 0x02, 0xec, 0xe1, 0xe1, 0xe1, 0x00, 0x00, 0x03, 0x4d, 0xd9, 0x58, 0x12, 0x18, 0x2f, 0x4b, 0x76, 0x5e, 0x53, 0x5a, 0x61, 0x74, 0x61, 0x64, 0x6b, 0x6b, 0x62, 0x62, 0x6b, 0x8d, 0xc6, 0xd1, 0x80, 0x8c, 0xd6, 0xd6, 0xa1, 0x48, 0x41, 0xc6, 0x6e, 0x14, 0x14, 0x23, 0x12, 0x19, 0x17, 0x17, 0x17, 0x12, 0x20, 0x26, 0x29, 0x23, 0x17, 0x17, 0x12, 0x20, 0x20, 0x14, 0x14, 0x14, 0x20, 0x12, 0x20, 0xba, 0xc7, 0x4f, 0x29, 0x2d, 0x31, 0x2d, 0x8c, 0xd3, 0xb3, 0x8f, 0x77, 0xa2, 0xb8, 0xb4, 0xaf, 0xbb, 0xb8, 0xb2, 0xa2, 0xa9, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x97, 0x9f, 0x9b, 0xad, 0x8b, 0x7f, 0x9e, 0xb1, 0xb1, 0x9f, 0xa5, 0x98, 0xa5, 0xb2, 0xb1, 0xa4, 0x97, 0xa3, 0xab, 0x9e, 0xa3, 0xab, 0xaf, 0xaf, 0x98, 0x8f, 0xbb, 0xaf, 0xb2, 0xab, 0xad, 0xad, 0xa4, 0x9b, 0x9f, 0x9a, 0x9f, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x96, 0x93, 0x96, 0x93, 0x96, 0x93, 0x8b, 0x95, 0xd4, 0x84, 0x03, 0xdd, 0x00, 0x00, 0x06, 0x13, 0xc1, 0x47, 0x36, 0x36, 0x4e, 0x4f, 0x41, 0x36, 0x41, 0x48, 0x87, 0xca, 0x27, 0x12, 0x17, 0x1c, 0x19, 0x1c, 0x1c, 0x1a, 0x1a, 0x39, 0x4e, 0x72, 0x7f, 0x76, 0x77, 0x8e, 0x8e, 0x82, 0x86, 0x8d, 0x72, 0x59, 0x43, 0x2b, 0x21, 0x1a, 0x14, 0x1d, 0x17, 0x2c, 0x3b, 0x6f, 0x7c, 0x29, 0x26, 0x1d, 0x1f, 0x9d, 0xd6, 0x47, 0x1f, 0x43, 0x59, 0x5f, 0x53, 0x5a, 0x74, 0x74, 0x61, 0x53, 0x5e, 0x57, 0x5f, 0x5f, 0x5e, 0x64, 0x60, 0x54, 0x62, 0x54, 0x57, 0x5e, 0x5c, 0x60, 0x61, 0x5a, 0x61, 0x6a, 0x5c, 0x52, 0x65, 0x39, 0x16, 0x12, 0x2c, 0xaa, 0xd5, 0xdc, 0x4d, 0x0b, 0xdd, 0x01, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe3, 0xe1, 
-  0x01, 0xec, 0xfb, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe2, 0xdd, 0x01, 0x10, 0xcc, 0xcc, 0x23, 0x1a, 0x1f, 0x34, 0x5d, 0x77, 0x67, 0x61, 0x6a, 0x53, 0x6a, 0x5c, 0x67, 0x68, 0x67, 0x62, 0x5c, 0x77, 0x59, 0xd1, 0xd1, 0x9d, 0xbf, 0xd6, 0xba, 0x3a, 0x29, 0xc7, 0xa8, 0x1a, 0x1a, 0x20, 0x0e, 0x1c, 0x1c, 0x17, 0x26, 0x4f, 0xba, 0xc7, 0xd2, 0xd6, 0xbd, 0x8c, 0x23, 0x14, 0x14, 0x17, 0x20, 0x14, 0x1c, 0x14, 0x6e, 0xc7, 0x56, 0x36, 0x36, 0x5b, 0x56, 0x47, 0x6e, 0xd3, 0xb9, 0x72, 0x8d, 0xa2, 0xbb, 0xb8, 0xaf, 0xb8, 0xb8, 0xab, 0x97, 0x8d, 0x97, 0x96, 0x8d, 0x96, 0x96, 0x96, 0x9a, 0x96, 0x9a, 0x8b, 0xa5, 0xa5, 0xaf, 0xa0, 0x7f, 0x8f, 0x7e, 0xa7, 0xb4, 0xa0, 0x8d, 0x9e, 0xa3, 0xb2, 0xb2, 0x9b, 0xa4, 0xb7, 0xb7, 0x9e, 0xa3, 0xb2, 0x97, 0x8b, 0x8d, 0x9f, 0xa4, 0x9b, 0x9b, 0xb1, 0x9b, 0x9f, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x96, 0x8e, 0x96, 0x93, 0x8e, 0x8e, 0x8e, 0x8e, 0x9f, 0x65, 0xb3, 0xd6, 0x49, 0xdd, 0x02, 0xe3, 0x00, 0x00, 0x0f, 0xd5, 0x6f, 0x2d, 0x56, 0xcf, 0xcf, 0x8c, 0x41, 0x36, 0x2d, 0x41, 0xd2, 0x6e, 0x1a, 0x17, 0x1c, 0x14, 0x16, 0x17, 0x1d, 0x1d, 0x12, 0x21, 0x36, 0x43, 0x4a, 0x51, 0x4a, 0x51, 0x51, 0x4a, 0x34, 0x34, 0x27, 0x21, 0x1d, 0x1d, 0x25, 0x17, 0x26, 0x5b, 0xcf, 0xd4, 0xd2, 0xc7, 0xd7, 0xa8, 0x23, 0x3a, 0xd6, 0xa1, 0x23, 0x18, 0x25, 0x3c, 0x59, 0x5d, 0x54, 0x61, 0x6a, 0x6a, 0x5c, 0x5e, 0x5f, 0x5e, 0x5e, 0x5c, 0x5a, 0x5a, 0x5a, 0x5a, 0x60, 0x5c, 0x5c, 0x5c, 0x61, 0x61, 0x5a, 0x74, 0x54, 0x57, 0x72, 0x43, 0x1f, 0x18, 0x1d, 0x31, 0xda, 0x63, 0x15, 0x09, 0x08, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 
-  0x02, 0xfb, 0x02, 0x02, 0xec, 0xe1, 0xec, 0xe1, 0xdd, 0x05, 0x07, 0x01, 0x38, 0xd8, 0x6f, 0x21, 0x1a, 0x21, 0x39, 0x51, 0x52, 0x62, 0x73, 0x5c, 0x5c, 0x5c, 0x5c, 0x5e, 0x6d, 0x6d, 0x73, 0x71, 0x59, 0x85, 0xb9, 0xc6, 0xa8, 0x8c, 0x50, 0x31, 0x5b, 0xd4, 0x4f, 0x1d, 0x17, 0x12, 0x20, 0x20, 0x12, 0x29, 0x91, 0xce, 0xc7, 0x8c, 0x47, 0x4f, 0x8c, 0xc7, 0xc7, 0x3a, 0x12, 0x17, 0x1c, 0x1c, 0x12, 0x1c, 0xba, 0xbf, 0x36, 0x36, 0x87, 0xca, 0xd3, 0x80, 0x4f, 0xd1, 0xc6, 0x9c, 0x7f, 0xa9, 0xbb, 0xb4, 0xaf, 0xbb, 0xb2, 0xab, 0x8d, 0x86, 0x96, 0x8e, 0x96, 0x8e, 0x97, 0x96, 0x97, 0x96, 0x9e, 0x98, 0xa6, 0x90, 0x4e, 0x2f, 0x27, 0x2b, 0x27, 0x36, 0x4e, 0x85, 0xaf, 0xbb, 0xaf, 0x8f, 0x9f, 0x9f, 0xad, 0xa9, 0x9e, 0x98, 0x97, 0xb4, 0xb8, 0xaf, 0xab, 0xb7, 0xa9, 0x93, 0x93, 0x9b, 0x96, 0x96, 0x96, 0x96, 0x93, 0x96, 0x93, 0x96, 0x93, 0x93, 0x8e, 0x8e, 0x93, 0x8e, 0x8e, 0x8e, 0x9e, 0x5d, 0xc6, 0xd7, 0x2a, 0xdd, 0xe1, 0xe3, 0x00, 0x01, 0x07, 0xb5, 0x94, 0x2d, 0xc7, 0xd4, 0xd6, 0xd2, 0xa8, 0x3a, 0x41, 0x41, 0x8c, 0xba, 0x14, 0x14, 0x12, 0x17, 0x17, 0x17, 0x17, 0x1a, 0x1f, 0x1a, 0x1a, 0x1d, 0x21, 0x21, 0x25, 0x27, 0x21, 0x1f, 0x1f, 0x1f, 0x1d, 0x1a, 0x1a, 0x1a, 0x12, 0x26, 0x6e, 0xc7, 0xa8, 0x41, 0x41, 0x3f, 0x4f, 0xd4, 0xa8, 0xbd, 0xd7, 0x3a, 0x12, 0x18, 0x18, 0x27, 0x39, 0x55, 0x65, 0x62, 0x57, 0x5c, 0x67, 0x67, 0x5c, 0x5c, 0x64, 0x61, 0x61, 0x5a, 0x61, 0x61, 0x61, 0x5a, 0x61, 0x60, 0x61, 0x60, 0x64, 0x5c, 0x57, 0x59, 0x55, 0x27, 0x16, 0x18, 0x1c, 0xbd, 0xda, 0x13, 0x01, 0xdd, 0x05, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xe1, 0xe1, 0x00, 0x05, 0x00, 0xfb, 0x22, 0xdb, 0xd2, 0x50, 0x18, 0x12, 0x25, 0x48, 0x59, 0x59, 0x62, 0x57, 0x5e, 0x5e, 0x53, 0x5c, 0x61, 0x74, 0x74, 0x74, 0x89, 0x69, 0x85, 0xc6, 0xd1, 0xc5, 0xae, 0x91, 0xd2, 0x91, 0x23, 0x1a, 0x1a, 0x17, 0x1d, 0x12, 0x20, 0xa1, 0xce, 0x4f, 0x26, 0x35, 0x36, 0x3a, 0x2d, 0x47, 0xcf, 0xbf, 0x31, 0x16, 0x1c, 0x14, 0x19, 0x23, 0xc7, 0x80, 0x2f, 0x55, 0xd3, 0xd3, 0xd6, 0x6e, 0x4f, 0xd3, 0xd1, 0xb4, 0x5d, 0xb7, 0xbb, 0xb8, 0xb8, 0xb8, 0xb8, 0xa2, 0x8d, 0x8a, 0x8d, 0x96, 0x8d, 0x96, 0x8e, 0x96, 0x96, 0x97, 0x98, 0xa3, 0x80, 0x39, 0x21, 0x18, 0x1a, 0x1a, 0x16, 0x16, 0x25, 0x4e, 0xa7, 0xa5, 0x95, 0x9c, 0x9c, 0xb7, 0xaf, 0xa0, 0xa5, 0xa5, 0x90, 0x72, 0x55, 0x51, 0x51, 0x7f, 0x98, 0xa2, 0x97, 0x96, 0x93, 0x96, 0x93, 0x96, 0x8e, 0x93, 0x8e, 0x8e, 0x96, 0x8e, 0x96, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8b, 0x72, 0xc6, 0xda, 0x13, 0x00, 0xe3, 0xe4, 0xe0, 0x00, 0xdd, 0x4d, 0xd0, 0x3e, 0xba, 0xd4, 0xce, 0xd7, 0xce, 0x35, 0x3e, 0x3f, 0x50, 0xcf, 0x20, 0x1c, 0x16, 0x14, 0x14, 0x17, 0x1d, 0x1d, 0x20, 0x1a, 0x16, 0x18, 0x1a, 0x1a, 0x18, 0x16, 0x18, 0x1d, 0x1a, 0x17, 0x1a, 0x1a, 0x1a, 0x17, 0x14, 0xa1, 0xd4, 0x8c, 0x36, 0x2b, 0x39, 0x36, 0x2d, 0x79, 0xd7, 0xd6, 0xd5, 0x46, 0x19, 0x19, 0x1d, 0x1a, 0x21, 0x39, 0x55, 0x72, 0x62, 0x57, 0x60, 0x60, 0x5a, 0x61, 0x61, 0x6a, 0x74, 0x74, 0x6a, 0x61, 0x61, 0x61, 0x60, 0x61, 0x5c, 0x5c, 0x54, 0x4c, 0x72, 0x66, 0x27, 0x1d, 0x20, 0x14, 0x50, 0xd8, 0x3b, 0x04, 0x0a, 0x06, 0x00, 0xe6, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0x02, 0x02, 0x05, 0xdd, 0x06, 0x04, 0x58, 0xc4, 0xce, 0xd7, 0x46, 0x23, 0x12, 0x21, 0x36, 0x51, 0x51, 0x52, 0x62, 0x68, 0x6b, 0x5c, 0x64, 0x74, 0x74, 0x6a, 0x57, 0x62, 0x85, 0x6c, 0x95, 0xcf, 0xd7, 0xd7, 0x94, 0x2c, 0x14, 0x12, 0x18, 0x20, 0x21, 0x20, 0x31, 0xc7, 0x91, 0x31, 0x2d, 0x48, 0x4f, 0x36, 0x48, 0x2d, 0x36, 0xc7, 0x5b, 0x12, 0x1c, 0x19, 0x14, 0x28, 0xbf, 0x8c, 0x36, 0x4e, 0xcd, 0xca, 0xa8, 0xbd, 0xce, 0xcf, 0xd4, 0xb3, 0x65, 0xb2, 0xb8, 0xaf, 0xb8, 0xb2, 0xb2, 0x97, 0x8d, 0x8e, 0x96, 0x8a, 0x8e, 0x8e, 0x8d, 0x8e, 0x97, 0x8d, 0x7f, 0xb3, 0x4e, 0x1f, 0x18, 0x21, 0x1f, 0x1f, 0x31, 0x46, 0x79, 0x8c, 0x87, 0xac, 0xac, 0xb6, 0xa7, 0xa7, 0xa7, 0x95, 0xac, 0xac, 0x80, 0x39, 0x1f, 0x18, 0x16, 0x27, 0x51, 0x9c, 0xa5, 0x98, 0x8d, 0x93, 0x8e, 0x93, 0x8e, 0x93, 0x8e, 0x8e, 0x8e, 0x93, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x72, 0x90, 0xcf, 0xbd, 0x0a, 0xec, 0xe3, 0xe4, 0xe4, 0x00, 0x00, 0x0f, 0xc1, 0x94, 0x5b, 0xc5, 0xd2, 0xd7, 0xc5, 0x3a, 0x2d, 0x35, 0x91, 0xc7, 0x17, 0x20, 0x1c, 0x14, 0x14, 0x1c, 0x1a, 0x14, 0x12, 0x14, 0x17, 0x1c, 0x16, 0x16, 0x16, 0x17, 0x1d, 0x1c, 0x18, 0x14, 0x14, 0x1c, 0x1c, 0x17, 0x46, 0xc5, 0x6e, 0x2d, 0x2f, 0x87, 0xfe, 0x87, 0x4f, 0x47, 0xda, 0x7c, 0xc1, 0xdb, 0x3b, 0x14, 0x14, 0x14, 0x1a, 0x1f, 0x2b, 0x43, 0x59, 0x65, 0x6b, 0x67, 0x6a, 0x61, 0x61, 0x61, 0x61, 0x6a, 0x6a, 0x61, 0x61, 0x61, 0x60, 0x5c, 0x5e, 0x5e, 0x62, 0x7f, 0x4a, 0x2b, 0x21, 0x12, 0x17, 0x3e, 0xda, 0xc8, 0x13, 0x03, 0x01, 0xdd, 0xe6, 0xe3, 0xe4, 0xe0, 0xe1, 0xe1, 0x02, 0x01, 0x02, 0x01, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0x02, 0x02, 0x00, 0x09, 0x01, 0x4d, 0x94, 0x58, 0xc8, 0xd8, 0x79, 0x26, 0x12, 0x1d, 0x27, 0x3c, 0x51, 0x51, 0x59, 0x5d, 0x5f, 0x5f, 0x6b, 0x6d, 0x6b, 0x8e, 0x5d, 0x7f, 0x7e, 0x56, 0x56, 0x91, 0xd8, 0xda, 0xae, 0x6f, 0x31, 0x1a, 0x14, 0x12, 0x12, 0x47, 0xc5, 0x3a, 0x2d, 0x6e, 0xca, 0xca, 0xd1, 0x48, 0x48, 0x3f, 0xbf, 0x8c, 0x12, 0x18, 0x20, 0x1b, 0x12, 0x5b, 0xd3, 0x8c, 0x36, 0x47, 0x91, 0x94, 0xc1, 0x84, 0x50, 0xd4, 0xc3, 0x8f, 0x8b, 0xaf, 0xb2, 0xb8, 0xb2, 0xa9, 0x8d, 0x8e, 0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8e, 0x96, 0x8d, 0x97, 0x8f, 0x9c, 0x36, 0x16, 0x16, 0x18, 0x1c, 0x2c, 0xd0, 0xdb, 0xdb, 0xd8, 0xd6, 0xd6, 0xd6, 0xce, 0xcf, 0xd6, 0xd4, 0xd2, 0xd6, 0xd6, 0xce, 0xa1, 0x50, 0x2d, 0x1f, 0x18, 0x27, 0x4e, 0x87, 0x8f, 0x8d, 0x8e, 0x93, 0x8e, 0x8e, 0x8e, 0x8a, 0x8e, 0x8e, 0x8a, 0x8e, 0x8e, 0x88, 0x8a, 0x88, 0x8b, 0x72, 0xac, 0xd4, 0x49, 0x06, 0x00, 0xe4, 0xe4, 0xe3, 0xde, 0x09, 0x03, 0x2e, 0xce, 0x79, 0x6e, 0xcf, 0xd4, 0xc7, 0xba, 0x8c, 0x6e, 0xc7, 0xa1, 0x16, 0x14, 0x1c, 0x20, 0x20, 0x14, 0x14, 0x17, 0x35, 0x50, 0xae, 0xbd, 0xbd, 0x79, 0x3a, 0x23, 0x17, 0x14, 0x17, 0x1c, 0x20, 0x20, 0x17, 0x12, 0x6f, 0xc8, 0x3f, 0x36, 0x87, 0xc6, 0xd1, 0xd6, 0x47, 0xaa, 0xb5, 0x09, 0x0c, 0xb0, 0xda, 0x7c, 0x26, 0x1d, 0x17, 0x14, 0x18, 0x25, 0x36, 0x51, 0x51, 0x62, 0x67, 0x67, 0x5a, 0x53, 0x53, 0x5c, 0x61, 0x64, 0x60, 0x5c, 0x5e, 0x5f, 0x57, 0x59, 0x65, 0x51, 0x27, 0x1a, 0x1d, 0x1a, 0x31, 0xc8, 0xcc, 0xd7, 0x28, 0x01, 0x06, 0x01, 0xe6, 0xe0, 0xe0, 0xe0, 0xe3, 0x02, 0x02, 0x01, 0xfb, 0x01, 
-  0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfb, 0xdd, 0x07, 0x1e, 0xcc, 0x2e, 0x50, 0xce, 0xd2, 0xba, 0x41, 0x21, 0x18, 0x18, 0x27, 0x34, 0x43, 0x4b, 0x4a, 0x51, 0x59, 0x65, 0x59, 0x51, 0x42, 0x43, 0x2b, 0x21, 0x1d, 0x1d, 0x3e, 0x91, 0xda, 0xd7, 0xd2, 0xae, 0x50, 0x3a, 0x23, 0x2c, 0xd6, 0x5b, 0x4f, 0xbf, 0xd3, 0xd1, 0xd1, 0xcd, 0xd1, 0xc6, 0xca, 0xb6, 0x3a, 0x18, 0x16, 0x19, 0x19, 0x2c, 0xc5, 0xc7, 0xcf, 0xce, 0xd5, 0xcb, 0x40, 0x08, 0x0e, 0xd8, 0xc6, 0xa5, 0x76, 0xb2, 0xb2, 0xb2, 0xb2, 0x9e, 0x86, 0x86, 0x93, 0x8e, 0x8e, 0x8a, 0x8e, 0x8a, 0x8d, 0x8e, 0x97, 0xa0, 0x66, 0x25, 0x16, 0x1f, 0x14, 0x26, 0xcb, 0xcb, 0x2a, 0x0c, 0x1b, 0x3b, 0x3e, 0x49, 0x7c, 0x84, 0x94, 0xb5, 0xb0, 0x99, 0x99, 0xb5, 0xc4, 0xdb, 0xc1, 0x47, 0x16, 0x12, 0x27, 0x56, 0x90, 0x8d, 0x93, 0x8e, 0x8e, 0x93, 0x8e, 0x8e, 0x8e, 0x88, 0x8e, 0x88, 0x88, 0x8e, 0x88, 0x88, 0x7f, 0x7e, 0xb6, 0xd7, 0x2e, 0xfb, 0x00, 0xe3, 0xe4, 0xfd, 0x00, 0xfc, 0x0c, 0x26, 0xce, 0xd4, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 0xd3, 0xbf, 0x6e, 0x26, 0x12, 0x1c, 0x17, 0x14, 0x2c, 0x91, 0xd2, 0xcf, 0xba, 0x91, 0xa8, 0xc8, 0xce, 0xc7, 0x31, 0x20, 0x14, 0x17, 0x17, 0x17, 0x14, 0x1d, 0x6f, 0xd2, 0x3a, 0x2d, 0xa7, 0xd3, 0xd1, 0xc7, 0x7c, 0xc4, 0x38, 0x01, 0x03, 0x13, 0xd5, 0xce, 0x79, 0x31, 0x14, 0x18, 0x20, 0x16, 0x18, 0x25, 0x39, 0x4a, 0x52, 0x65, 0x5d, 0x59, 0x65, 0x69, 0x5d, 0x5f, 0x62, 0x5d, 0x5d, 0x59, 0x59, 0x59, 0x34, 0x1f, 0x21, 0x21, 0x14, 0x3a, 0xd2, 0xd7, 0x7c, 0xb0, 0x49, 0x04, 0x04, 0xdf, 0xe6, 0xe3, 0xe4, 0xe0, 0xe1, 0xe1, 0x02, 0x01, 0x01, 0x03, 
-  0xe1, 0x02, 0xec, 0x01, 0x02, 0x01, 0xec, 0x02, 0x02, 0x00, 0x06, 0xdd, 0x07, 0x63, 0xc8, 0x2e, 0x41, 0xba, 0xd6, 0xd4, 0x9d, 0x3f, 0x25, 0x12, 0x18, 0x16, 0x1f, 0x27, 0x1f, 0x21, 0x29, 0x1f, 0x21, 0x21, 0x1a, 0x18, 0x16, 0x16, 0x16, 0x19, 0x3a, 0xce, 0xd7, 0xda, 0xce, 0xd7, 0xd7, 0xce, 0xa8, 0xc5, 0xd3, 0xd3, 0xd1, 0xbc, 0x87, 0x6c, 0x6c, 0x87, 0x95, 0xbc, 0xd1, 0xd3, 0xb6, 0x6e, 0x91, 0xae, 0xd7, 0xd7, 0xd7, 0xd5, 0xb5, 0x38, 0x0b, 0x00, 0xdd, 0x0d, 0xc8, 0xd3, 0x7e, 0x8d, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8e, 0x8a, 0x8e, 0x8a, 0x8e, 0x8e, 0x8e, 0x8d, 0x8e, 0x8d, 0x8d, 0x98, 0x59, 0x1f, 0x1a, 0x1c, 0x12, 0x50, 0xd9, 0x4d, 0xdd, 0xdd, 0x03, 0xfb, 0x03, 0x03, 0x03, 0x03, 0x06, 0x07, 0x06, 0x06, 0x04, 0x07, 0x09, 0x38, 0xc8, 0xd8, 0x3e, 0x1d, 0x16, 0x39, 0x87, 0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x88, 0x8e, 0x88, 0x8e, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7e, 0xcf, 0xc5, 0x0e, 0x04, 0xfb, 0x01, 0xdd, 0xdd, 0x0c, 0x2e, 0xae, 0xd6, 0xd3, 0xc6, 0xcd, 0xb3, 0xa6, 0x95, 0x90, 0x56, 0x6c, 0xac, 0xca, 0xd4, 0xd3, 0x5b, 0x1a, 0x12, 0x26, 0xc5, 0xc7, 0x5b, 0x36, 0x35, 0x3f, 0x35, 0x35, 0x41, 0xae, 0xd6, 0x3e, 0x14, 0x1c, 0x1a, 0x14, 0x1d, 0x14, 0x79, 0xc7, 0x3f, 0x36, 0x56, 0xa8, 0xa1, 0x94, 0xcb, 0x99, 0xdd, 0x09, 0xfb, 0x13, 0xda, 0xa1, 0xd7, 0xba, 0x46, 0x23, 0x12, 0x12, 0x20, 0x18, 0x1f, 0x1f, 0x27, 0x2f, 0x39, 0x39, 0x48, 0x4e, 0x43, 0x7e, 0x51, 0x43, 0x4a, 0x39, 0x27, 0x25, 0x1f, 0x1f, 0x16, 0x1d, 0x6e, 0xd4, 0xcf, 0xae, 0x2c, 0xc4, 0x2a, 0xdd, 0x03, 0xe6, 0xe4, 0xe4, 0xe4, 0xe0, 0xe3, 0xe1, 0x01, 0x01, 0xfb, 0x01, 
-  0x02, 0xe1, 0x02, 0x02, 0xfb, 0x02, 0xfb, 0xec, 0x00, 0x01, 0xfd, 0x01, 0x01, 0x15, 0x75, 0xc1, 0x47, 0x35, 0x47, 0xba, 0xd7, 0xd6, 0xae, 0x79, 0x35, 0x3a, 0x1d, 0x16, 0x1c, 0x16, 0x12, 0x16, 0x18, 0x12, 0x18, 0x1f, 0x1d, 0x35, 0x8c, 0xae, 0xd7, 0xc8, 0xc8, 0x6f, 0x46, 0xbd, 0xd2, 0xce, 0xd7, 0xd4, 0xca, 0x80, 0x48, 0x34, 0x2f, 0x34, 0x2f, 0x39, 0x3c, 0x43, 0x87, 0xbc, 0xc6, 0xd3, 0xd4, 0xd8, 0xa1, 0x58, 0x31, 0x24, 0xdd, 0x00, 0xe5, 0xe7, 0x00, 0x0a, 0xcc, 0xd3, 0x7e, 0x7f, 0x8b, 0x8b, 0x8a, 0x8d, 0x8a, 0x8a, 0x8e, 0x8e, 0x8e, 0x8e, 0x8a, 0x8e, 0x8a, 0x8d, 0x8a, 0x8d, 0x98, 0x59, 0x1d, 0x1d, 0x18, 0x16, 0x84, 0xd9, 0x10, 0xdd, 0xfb, 0x04, 0x01, 0x06, 0x04, 0xdd, 0xdd, 0xdd, 0x02, 0x01, 0xdd, 0xdd, 0x03, 0x04, 0x0f, 0xb5, 0xda, 0xc5, 0x26, 0x16, 0x2b, 0x66, 0x8d, 0x93, 0x8e, 0x88, 0x8e, 0x88, 0x8e, 0x88, 0x8e, 0x88, 0x88, 0x88, 0x88, 0x83, 0x88, 0x7f, 0x95, 0xc7, 0xbd, 0x0a, 0x03, 0xfb, 0xfc, 0x09, 0x2a, 0x94, 0xd7, 0xd3, 0xbc, 0xb3, 0x90, 0x59, 0x7f, 0x65, 0x51, 0x42, 0x30, 0x2f, 0x39, 0x43, 0x6e, 0xca, 0xca, 0xa8, 0x3a, 0x91, 0xc5, 0x47, 0x3f, 0x36, 0x41, 0x2d, 0x36, 0x41, 0x3f, 0x35, 0xa8, 0xa8, 0x31, 0x14, 0x14, 0x1d, 0x20, 0x12, 0x23, 0xc5, 0xba, 0x50, 0x35, 0x50, 0xb5, 0xc4, 0x75, 0x08, 0x08, 0x03, 0x03, 0x22, 0xb0, 0x3e, 0x91, 0xd4, 0xd7, 0xae, 0x3e, 0x20, 0x19, 0x0e, 0x1a, 0x1a, 0x1f, 0x1f, 0x1f, 0x1d, 0x20, 0x18, 0x27, 0x1a, 0x21, 0x25, 0x21, 0x1f, 0x18, 0x1d, 0x18, 0x18, 0x41, 0xcf, 0xd4, 0xcf, 0xa8, 0x2c, 0x84, 0xc4, 0x0a, 0x01, 0x0b, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0x02, 0x02, 0x01, 0x01, 0x01, 
-  0xe1, 0x02, 0x02, 0x01, 0x02, 0xfb, 0x02, 0x02, 0xec, 0xe6, 0x01, 0x01, 0x00, 0xfb, 0x11, 0x4d, 0xd0, 0xaa, 0x94, 0xb5, 0xc4, 0xaa, 0xb5, 0xda, 0xd0, 0xc5, 0x91, 0x5b, 0x6e, 0x47, 0x50, 0x50, 0x46, 0x46, 0x7c, 0xc5, 0xce, 0xd2, 0xd7, 0xcc, 0xbd, 0x58, 0x3b, 0x31, 0x58, 0xc1, 0x91, 0x91, 0xd3, 0xac, 0x48, 0x39, 0x2f, 0x2f, 0x34, 0x39, 0x37, 0x34, 0x33, 0x3c, 0x4e, 0x66, 0x90, 0xb3, 0xd1, 0xd3, 0x5b, 0x0c, 0x06, 0xdd, 0x02, 0xe8, 0xe4, 0xe5, 0x00, 0x09, 0xc8, 0xca, 0x85, 0x97, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8e, 0x88, 0x8a, 0x8a, 0x8e, 0x8e, 0x8a, 0x8e, 0x8a, 0x8e, 0x8d, 0x96, 0x4a, 0x1f, 0x1a, 0x16, 0x20, 0xc8, 0xc4, 0x06, 0x02, 0xe6, 0x02, 0xdd, 0xfd, 0xe1, 0xe3, 0xe3, 0xdf, 0xdf, 0xdf, 0xdd, 0x01, 0xdd, 0x04, 0x11, 0xc4, 0x91, 0xd8, 0x48, 0x1d, 0x25, 0x59, 0x8d, 0x88, 0x8e, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x83, 0x88, 0x83, 0x88, 0x83, 0x7f, 0x85, 0xcf, 0xbf, 0x0e, 0x06, 0x0e, 0x3b, 0x94, 0xd7, 0xd6, 0xc6, 0x95, 0x66, 0x59, 0x65, 0x76, 0x77, 0x71, 0x4c, 0x37, 0x33, 0x34, 0x2f, 0x2f, 0x39, 0x4e, 0xb6, 0xd4, 0xbf, 0xc7, 0x91, 0x2d, 0x3f, 0x36, 0x48, 0x4f, 0x48, 0x41, 0x2d, 0x3f, 0x47, 0xd6, 0x47, 0x12, 0x12, 0x12, 0x1c, 0x2c, 0x50, 0xd7, 0xd8, 0xd2, 0xd0, 0xd5, 0x99, 0x32, 0x08, 0xdd, 0x00, 0x04, 0xdd, 0x0c, 0xd5, 0x50, 0x29, 0x56, 0xb6, 0xd4, 0xd6, 0xa1, 0x50, 0x26, 0x14, 0x20, 0x14, 0x12, 0x1a, 0x1a, 0x16, 0x26, 0x1f, 0x16, 0x1d, 0x18, 0x14, 0x18, 0x16, 0x23, 0x3e, 0xbd, 0xd0, 0xc5, 0xbd, 0x47, 0x29, 0x47, 0xc4, 0x24, 0x04, 0xdd, 0xdd, 0xe3, 0xe6, 0xe0, 0xe4, 0xe1, 0xe1, 0x02, 0x02, 0x01, 0x02, 0x01, 
-  0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0xec, 0xfb, 0xe1, 0xe6, 0x00, 0x02, 0x04, 0xdd, 0xdd, 0x09, 0x1e, 0x40, 0x75, 0x4d, 0x0f, 0x03, 0x0f, 0x32, 0xcc, 0xda, 0xd8, 0xd7, 0xd6, 0xd4, 0xd6, 0xd2, 0xd5, 0xdc, 0xd5, 0xcc, 0xb5, 0x6f, 0x63, 0xda, 0x99, 0x63, 0x58, 0xd5, 0xc1, 0x3e, 0x6f, 0xd6, 0x80, 0x4e, 0x2f, 0x2f, 0x39, 0x34, 0x39, 0x37, 0x3c, 0x37, 0x33, 0x42, 0x5d, 0x72, 0x65, 0x66, 0x85, 0xd1, 0xd3, 0x91, 0x0c, 0x06, 0x00, 0xe4, 0xe0, 0xe8, 0x00, 0x13, 0xd2, 0xc6, 0x8f, 0x76, 0x8a, 0x86, 0x8a, 0x86, 0x88, 0x8a, 0x88, 0x8e, 0x88, 0x8a, 0x8e, 0x8a, 0x8a, 0x8e, 0x8b, 0x8d, 0x98, 0x43, 0x1d, 0x1d, 0x16, 0x2c, 0xda, 0x75, 0x03, 0xde, 0x00, 0xe1, 0x01, 0xe1, 0xe3, 0xe4, 0xe0, 0x02, 0xe1, 0xec, 0xe6, 0x01, 0x01, 0x01, 0x2a, 0xc4, 0x3e, 0xd2, 0xbc, 0x1f, 0x25, 0x65, 0x8d, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x83, 0x88, 0x83, 0x88, 0x83, 0x83, 0x83, 0x86, 0x85, 0xc6, 0xd3, 0x79, 0x8c, 0xbd, 0xd6, 0xd7, 0xca, 0x6c, 0x4e, 0x65, 0x7f, 0x5f, 0x5d, 0x82, 0x67, 0x81, 0x4c, 0x37, 0x3d, 0x42, 0x37, 0x39, 0x30, 0x2b, 0x3c, 0x80, 0xd6, 0xcf, 0x50, 0x3a, 0x2d, 0x56, 0xc6, 0xd4, 0xd3, 0xa8, 0x48, 0x3a, 0x35, 0xc7, 0x50, 0x2c, 0x58, 0x7c, 0xc8, 0xd5, 0xd0, 0xcc, 0x7c, 0x38, 0x1b, 0x0d, 0x0a, 0x00, 0x00, 0xdf, 0x00, 0xde, 0x01, 0xfb, 0x32, 0xcc, 0x4f, 0x36, 0x36, 0x6e, 0xbf, 0xcf, 0xcf, 0xce, 0x8c, 0x46, 0x2d, 0x20, 0x20, 0x1d, 0x17, 0x14, 0x14, 0x20, 0x20, 0x20, 0x31, 0x47, 0x91, 0xcc, 0xda, 0xd0, 0xda, 0xb5, 0x3e, 0x46, 0xba, 0xd0, 0x2e, 0x01, 0x06, 0x04, 0x00, 0xe6, 0xe6, 0xe3, 0xe1, 0xe1, 0x02, 0x02, 0x01, 0x02, 0xdf, 0x02, 
-  0xe1, 0x02, 0x02, 0x01, 0x02, 0xfb, 0x02, 0xec, 0xe3, 0xe3, 0xe6, 0xe6, 0x01, 0xfb, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xdd, 0x00, 0xdd, 0x4d, 0xb5, 0x6f, 0x47, 0x8c, 0x8c, 0x6e, 0x91, 0xd9, 0x99, 0x24, 0x0c, 0x0a, 0xfb, 0x09, 0x2a, 0x75, 0x99, 0x75, 0x3b, 0x0a, 0x2c, 0xd4, 0xb6, 0x3c, 0x34, 0x34, 0x3c, 0x37, 0x30, 0x30, 0x37, 0x37, 0x30, 0x30, 0x3d, 0x76, 0x86, 0x76, 0x82, 0x7f, 0x65, 0xd1, 0xcf, 0x7c, 0x0a, 0xdd, 0xdd, 0xdd, 0xdd, 0x06, 0x46, 0xd4, 0xbc, 0x8f, 0x5f, 0x86, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8e, 0x88, 0x8e, 0x8a, 0x8a, 0x8a, 0x8d, 0xa0, 0x34, 0x1d, 0x1a, 0x16, 0x35, 0xda, 0x49, 0x01, 0xe2, 0x00, 0x02, 0x02, 0x02, 0xe4, 0xe0, 0xe1, 0xdd, 0x00, 0x02, 0x02, 0xfb, 0x01, 0xdd, 0x22, 0xc4, 0x3e, 0xc5, 0xd4, 0x25, 0x1a, 0x72, 0x86, 0x88, 0x88, 0x88, 0x83, 0x88, 0x83, 0x88, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7b, 0x7b, 0x72, 0x9c, 0xcd, 0xd1, 0xd4, 0xd3, 0xb6, 0x7e, 0x55, 0x65, 0x6b, 0x7b, 0x7d, 0x83, 0x6b, 0x5e, 0x6d, 0x7a, 0x54, 0x37, 0x33, 0x33, 0x33, 0x34, 0x33, 0x39, 0x34, 0x2f, 0xbc, 0xd4, 0x9d, 0x3a, 0x36, 0xac, 0xd6, 0xd3, 0xca, 0xd4, 0x8c, 0x29, 0x31, 0xd8, 0xda, 0xcc, 0xd5, 0xd5, 0xc4, 0x75, 0x38, 0x13, 0x06, 0x01, 0x01, 0x01, 0xde, 0x01, 0xe6, 0x00, 0x02, 0x04, 0x00, 0x06, 0xfb, 0x49, 0xce, 0x9d, 0x35, 0x2d, 0x3a, 0x5b, 0xbd, 0xd7, 0xda, 0xc8, 0xdb, 0xda, 0x8c, 0x8c, 0xac, 0x8c, 0x8c, 0xba, 0xba, 0xd6, 0xd6, 0xce, 0xdb, 0xb5, 0x49, 0x1e, 0x40, 0xc4, 0xc4, 0xcc, 0x94, 0x0e, 0x01, 0x04, 0x00, 0xdd, 0xe2, 0xe3, 0xe6, 0xe3, 0xec, 0x02, 0x02, 0x01, 0x02, 0x02, 0xe1, 0xdf, 
-  0x02, 0x02, 0x02, 0x01, 0x01, 0xfb, 0xec, 0xec, 0xec, 0xe3, 0xe1, 0xe2, 0x00, 0xdd, 0x08, 0xfd, 0x08, 0xe1, 0x00, 0xe3, 0xe3, 0xe0, 0xe2, 0x08, 0x0f, 0x63, 0xc1, 0xae, 0x6f, 0x5b, 0xa1, 0xcc, 0x99, 0x15, 0xfb, 0xfc, 0xfb, 0xdd, 0x00, 0xdd, 0x01, 0xdd, 0xdd, 0x03, 0x12, 0xc5, 0xd1, 0x48, 0x30, 0x30, 0x33, 0x37, 0x3c, 0x33, 0x34, 0x3d, 0x33, 0x3d, 0x44, 0x52, 0x70, 0x70, 0x67, 0x7d, 0x6b, 0x77, 0x66, 0xd3, 0xd0, 0x49, 0x07, 0x01, 0xfc, 0x07, 0x2c, 0xc7, 0xd1, 0x85, 0x7f, 0x8b, 0x8a, 0x86, 0x88, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8e, 0x8a, 0x8e, 0x8a, 0x8a, 0x8b, 0x9c, 0x39, 0x16, 0x1d, 0x16, 0x50, 0xd8, 0x49, 0x01, 0xdd, 0x01, 0x05, 0xdd, 0x05, 0xe4, 0xe4, 0xe1, 0xec, 0xdd, 0xe1, 0xec, 0x02, 0x01, 0xdd, 0x0d, 0xc4, 0x58, 0xbd, 0xd3, 0x36, 0x1a, 0x59, 0x8d, 0x83, 0x88, 0x83, 0x83, 0x83, 0x88, 0x83, 0x83, 0x83, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7b, 0x68, 0x76, 0x8f, 0x9c, 0x85, 0x66, 0x51, 0x65, 0x70, 0x89, 0x89, 0x64, 0x53, 0x71, 0x7d, 0x71, 0x73, 0x81, 0x5e, 0x3d, 0x33, 0x33, 0x33, 0x37, 0x37, 0x37, 0x34, 0x2f, 0x39, 0xc6, 0xd4, 0x80, 0x3a, 0x6e, 0xcf, 0xd6, 0xd6, 0xc7, 0x5b, 0x3e, 0xbd, 0xc8, 0xb5, 0x63, 0x2a, 0x15, 0x0d, 0x04, 0xdd, 0xdd, 0x01, 0x03, 0x05, 0xdd, 0x02, 0x00, 0x00, 0xde, 0x01, 0x00, 0x01, 0xfb, 0xfd, 0xdd, 0x28, 0x84, 0xd2, 0xc8, 0x79, 0x6f, 0xae, 0xb5, 0x22, 0x2e, 0x63, 0x84, 0xd5, 0xd8, 0xcf, 0xd3, 0xd4, 0xd4, 0xcf, 0xd4, 0x91, 0xbd, 0xaa, 0x09, 0x01, 0x04, 0x06, 0x0d, 0x15, 0x0c, 0xfb, 0x06, 0xdd, 0x01, 0x02, 0xdf, 0xe6, 0xe1, 0xe1, 0x05, 0x01, 0x01, 0xfb, 0x01, 0x02, 0xdf, 0xe0, 0xe0, 
-  0xe1, 0x02, 0x02, 0x01, 0xec, 0x01, 0xec, 0xe1, 0xe6, 0xe3, 0xe4, 0xe0, 0xe3, 0xe1, 0xdd, 0xdd, 0xfc, 0xfc, 0xfb, 0xfd, 0xe6, 0xe1, 0x00, 0x00, 0x00, 0x09, 0x24, 0x63, 0x84, 0x84, 0x63, 0x2a, 0x0d, 0xdd, 0xdd, 0xfd, 0x01, 0xec, 0xde, 0xe1, 0xdf, 0xe2, 0x03, 0x03, 0x58, 0xd7, 0xac, 0x43, 0x3d, 0x37, 0x33, 0x33, 0x37, 0x37, 0x37, 0x30, 0x33, 0x45, 0x5f, 0x70, 0x83, 0x7d, 0x7a, 0x81, 0x74, 0x89, 0x65, 0x6c, 0xd6, 0xd0, 0x84, 0x3b, 0x3b, 0x5b, 0xcf, 0xd3, 0xb9, 0x69, 0x69, 0x9a, 0x86, 0x83, 0x8a, 0x83, 0x88, 0x83, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8b, 0x8d, 0x90, 0x36, 0x16, 0x18, 0x16, 0x6f, 0xd7, 0x94, 0x15, 0x01, 0xfb, 0x01, 0x01, 0xfb, 0xe6, 0xe3, 0xe1, 0xec, 0xe1, 0xec, 0xe6, 0xec, 0x02, 0xfb, 0x09, 0x75, 0x99, 0xc8, 0xc8, 0x2d, 0x1f, 0x4e, 0x7f, 0x88, 0x83, 0x83, 0x83, 0x81, 0x83, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x7d, 0x83, 0x78, 0x7d, 0x83, 0x68, 0x5f, 0x7b, 0x7f, 0x86, 0x8d, 0x6d, 0x7a, 0x6a, 0x6a, 0x74, 0x7a, 0x67, 0x67, 0x6b, 0x5c, 0x5e, 0x57, 0x4c, 0x37, 0x30, 0x33, 0x34, 0x37, 0x30, 0x2b, 0x42, 0x27, 0x56, 0xd1, 0xd3, 0x5b, 0x3a, 0x5b, 0x91, 0x91, 0x47, 0x47, 0x94, 0xd0, 0x22, 0x07, 0x01, 0xdd, 0x00, 0x00, 0x02, 0x05, 0x05, 0xe8, 0x00, 0xe0, 0xe3, 0xe6, 0x02, 0xfd, 0x00, 0x01, 0x04, 0xfd, 0x00, 0xe3, 0xe1, 0x00, 0x0b, 0x1e, 0x38, 0x75, 0x75, 0x32, 0x0d, 0xdd, 0x03, 0x00, 0x03, 0x49, 0xd5, 0x5b, 0x47, 0x4f, 0x41, 0x41, 0x2d, 0x3e, 0xae, 0x58, 0x09, 0x09, 0x04, 0x00, 0x00, 0xfb, 0xfb, 0xfb, 0x09, 0x08, 0x00, 0xde, 0xe6, 0x00, 0xe2, 0xec, 0xdd, 0xfb, 0x01, 0xfb, 0x01, 0x02, 0xe1, 0xe0, 0xe0, 
-  0x02, 0x02, 0x02, 0x02, 0x01, 0xec, 0x02, 0xec, 0x00, 0xe7, 0xe1, 0xe3, 0xe1, 0xe6, 0xdd, 0xfb, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0xe6, 0xe2, 0xe1, 0x04, 0x04, 0xdd, 0xdd, 0x06, 0x03, 0xdd, 0x00, 0x00, 0xfb, 0xfd, 0xfb, 0xdd, 0x00, 0xe4, 0xe0, 0xe0, 0xdd, 0x03, 0x13, 0xd7, 0xb6, 0x87, 0x4a, 0x30, 0x37, 0x3d, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x45, 0x69, 0x70, 0x68, 0x6d, 0x7a, 0x73, 0x74, 0x7a, 0x7a, 0x76, 0x85, 0x80, 0xca, 0xd6, 0xd6, 0xd4, 0xd3, 0xd1, 0x9c, 0x72, 0x97, 0x76, 0x7b, 0x88, 0x88, 0x83, 0x88, 0x83, 0x88, 0x88, 0x83, 0x88, 0x88, 0x88, 0x8e, 0x88, 0x8a, 0x8a, 0x8b, 0x90, 0x36, 0x16, 0x1c, 0x16, 0x79, 0xd7, 0xcc, 0x99, 0x09, 0x01, 0x01, 0xfb, 0xec, 0xe1, 0xe3, 0xe1, 0xec, 0xec, 0xe1, 0xe3, 0xec, 0xe1, 0x05, 0x00, 0x24, 0xcb, 0xcb, 0xce, 0x18, 0x21, 0x6c, 0x86, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7d, 0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x6d, 0x81, 0x81, 0x7b, 0x54, 0x62, 0x81, 0x73, 0x6a, 0x74, 0x74, 0x74, 0x6a, 0x60, 0x6b, 0x71, 0x6d, 0x54, 0x70, 0x5f, 0x3d, 0x33, 0x37, 0x33, 0x33, 0x37, 0x30, 0x37, 0x34, 0x30, 0xbc, 0xd1, 0xd4, 0xc5, 0xb0, 0x7c, 0x94, 0xcb, 0xcc, 0xc4, 0x1b, 0xfc, 0x04, 0x03, 0x03, 0x05, 0x00, 0xe6, 0xdf, 0x00, 0xe6, 0xe3, 0xe6, 0xe4, 0xe3, 0x02, 0xdd, 0x04, 0xfb, 0x01, 0x05, 0xe1, 0xe3, 0xe7, 0xe0, 0xe1, 0x00, 0x01, 0xfb, 0xdd, 0xdd, 0x00, 0xe1, 0x00, 0xea, 0xdd, 0x0b, 0x75, 0xc4, 0x7c, 0x47, 0x3e, 0x50, 0x6f, 0xc8, 0xb0, 0x0c, 0xfb, 0x00, 0xdd, 0xe8, 0xe2, 0x00, 0x02, 0xfd, 0x00, 0x00, 0xde, 0x00, 0xe1, 0xe1, 0x00, 0xe2, 0x00, 0x01, 0xfb, 0x01, 0x01, 0x02, 0xdf, 0xe0, 0xe0, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xfb, 0xfc, 0xfc, 0xfb, 0xec, 0xe1, 0xe0, 0xe0, 0xe1, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0xdf, 0xe1, 0x01, 0xfb, 0xfb, 0xfb, 0xe1, 0xe1, 0xe1, 0xfd, 0x03, 0x7c, 0xd6, 0x7e, 0x66, 0x62, 0x4c, 0x4c, 0x44, 0x3d, 0x3d, 0x4c, 0x52, 0x5d, 0x70, 0x70, 0x70, 0x71, 0x71, 0x73, 0x73, 0x7a, 0x7d, 0x7d, 0x70, 0x69, 0x7f, 0x85, 0x9c, 0xa5, 0xa5, 0x9c, 0x8d, 0x86, 0x77, 0x7b, 0x7b, 0x83, 0x88, 0x81, 0x88, 0x88, 0x86, 0x86, 0x86, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x7f, 0x9d, 0x25, 0x1d, 0x18, 0x1a, 0xba, 0xd4, 0x47, 0xcb, 0x1e, 0xdd, 0xdf, 0xe6, 0xe3, 0xe6, 0x00, 0xec, 0xec, 0xec, 0x02, 0xfb, 0xdd, 0x02, 0xdf, 0x02, 0xdf, 0x4d, 0xd9, 0x94, 0x1a, 0x2d, 0x66, 0x7f, 0x7b, 0x70, 0x78, 0x83, 0x88, 0x83, 0x7d, 0x7b, 0x82, 0x70, 0x7d, 0x7d, 0x89, 0x81, 0x7a, 0x73, 0x6d, 0x67, 0x71, 0x71, 0x73, 0x71, 0x73, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6b, 0x62, 0x6b, 0x5e, 0x64, 0x5e, 0x67, 0x57, 0x4c, 0x37, 0x30, 0x30, 0x30, 0x33, 0x33, 0x37, 0x42, 0x8f, 0xcd, 0xd4, 0x50, 0x75, 0x99, 0x75, 0xf9, 0x1e, 0xfc, 0xfc, 0x04, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0xdf, 0x02, 0xe0, 0xdf, 0xe0, 0xdf, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0xdf, 0xe6, 0xdd, 0x00, 0xde, 0x2a, 0x99, 0xcb, 0xb5, 0xc4, 0x99, 0x38, 0x0c, 0xdd, 0x04, 0x01, 0x01, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfc, 0xfb, 0x01, 0xe1, 0xe4, 0xe0, 0xe3, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xe0, 0xdf, 0x01, 0xfb, 0xfc, 0xfb, 0xec, 0xe1, 0xe3, 0x04, 0x0c, 0xba, 0xd3, 0x66, 0x65, 0x5f, 0x70, 0x67, 0x5e, 0x5e, 0x5e, 0x68, 0x78, 0x7b, 0x70, 0x68, 0x71, 0x71, 0x73, 0x73, 0x73, 0x73, 0x7d, 0x78, 0x71, 0x7b, 0x78, 0x82, 0x86, 0x8a, 0x82, 0x70, 0x77, 0x70, 0x70, 0x82, 0x82, 0x88, 0x81, 0x89, 0x81, 0x88, 0x86, 0x86, 0x86, 0x86, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x8a, 0x8f, 0x87, 0x25, 0x17, 0x18, 0x20, 0xc7, 0xcf, 0x47, 0xb0, 0x40, 0xdd, 0xe6, 0xe4, 0xe3, 0x05, 0xfb, 0xec, 0xec, 0xfb, 0x01, 0xfb, 0x02, 0x02, 0x02, 0xde, 0x00, 0x32, 0xdc, 0x5b, 0x16, 0x27, 0x72, 0x7f, 0x7b, 0x7b, 0x7b, 0x7d, 0x78, 0x70, 0x70, 0x68, 0x7b, 0x86, 0x77, 0x71, 0x6d, 0x73, 0x73, 0x6d, 0x6d, 0x6d, 0x78, 0x73, 0x71, 0x6d, 0x67, 0x6b, 0x67, 0x6b, 0x62, 0x6b, 0x62, 0x5e, 0x62, 0x5c, 0x67, 0x5c, 0x60, 0x67, 0x54, 0x4c, 0x44, 0x37, 0x33, 0x33, 0x37, 0x3d, 0x44, 0x70, 0xa5, 0xd4, 0x2c, 0x01, 0x08, 0xe3, 0x00, 0xe3, 0xfd, 0xfc, 0x04, 0xfb, 0x01, 0x02, 0x02, 0x02, 0xfb, 0x01, 0x01, 0x01, 0x02, 0xdf, 0xe1, 0xdf, 0xe0, 0xdf, 0xe0, 0xe1, 0xe1, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x00, 0x00, 0xe2, 0xe2, 0x01, 0xe3, 0x05, 0x08, 0x09, 0x0b, 0x09, 0xfb, 0x00, 0x00, 0x04, 0x01, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x01, 0xfb, 0xfb, 0xec, 0xe1, 0xe0, 0xe0, 0xe0, 0xe1, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0xdf, 0x01, 0x04, 0xfb, 0xfb, 0xe1, 0xe1, 0xdd, 0x01, 0x28, 0xd4, 0xc6, 0x59, 0x52, 0x68, 0x68, 0x5e, 0x6b, 0x5e, 0x68, 0x5e, 0x68, 0x5e, 0x68, 0x6b, 0x71, 0x6d, 0x71, 0x73, 0x73, 0x73, 0x71, 0x71, 0x78, 0x7d, 0x7b, 0x78, 0x71, 0x71, 0x6b, 0x71, 0x7b, 0x7d, 0x7b, 0x83, 0x7b, 0x7d, 0x89, 0x81, 0x89, 0x83, 0x86, 0x86, 0x86, 0x86, 0x88, 0x83, 0x81, 0x81, 0x81, 0x88, 0x8a, 0x8d, 0x56, 0x27, 0x14, 0x17, 0x2d, 0xcf, 0xd4, 0x35, 0x94, 0x75, 0xdd, 0xe6, 0x00, 0xe3, 0xfb, 0xfb, 0x01, 0xec, 0xec, 0xfb, 0xec, 0x01, 0x02, 0x02, 0xdd, 0xdd, 0x40, 0xdb, 0x3e, 0x18, 0x27, 0x90, 0x76, 0x7b, 0x7b, 0x78, 0x78, 0x6b, 0x71, 0x70, 0x76, 0x5d, 0x5d, 0x69, 0x8d, 0xb2, 0x9f, 0x83, 0x67, 0x68, 0x6d, 0x6d, 0x73, 0x6d, 0x6d, 0x60, 0x67, 0x60, 0x60, 0x60, 0x5c, 0x5c, 0x5c, 0x5c, 0x5e, 0x5e, 0x54, 0x5c, 0x5e, 0x67, 0x5f, 0x57, 0x4c, 0x45, 0x45, 0x4c, 0x4c, 0x52, 0x5e, 0x7f, 0xd3, 0x94, 0x03, 0x06, 0x00, 0xe3, 0xe6, 0xfb, 0x01, 0xfc, 0x01, 0x01, 0xe1, 0x02, 0xec, 0x02, 0x01, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xdf, 0xe1, 0xe3, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe2, 0xdd, 0x00, 0xdd, 0xec, 0x02, 0x02, 0x01, 0xfb, 0xfc, 0xfc, 0xdd, 0xdd, 0x04, 0xfd, 0xfd, 0x01, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0xe1, 0xe1, 0xe4, 0xe1, 0xe1, 0xe1, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0xec, 0x02, 0xdf, 0xdf, 0x03, 0x03, 0xfb, 0xfb, 0xe1, 0xe4, 0x02, 0x04, 0x46, 0xd6, 0x85, 0x51, 0x57, 0x68, 0x5e, 0x6b, 0x6b, 0x71, 0x73, 0x6d, 0x67, 0x5e, 0x6d, 0x6d, 0x6b, 0x71, 0x6d, 0x73, 0x73, 0x73, 0x6d, 0x73, 0x71, 0x81, 0x7d, 0x81, 0x7d, 0x7d, 0x83, 0x88, 0x83, 0x83, 0x83, 0x83, 0x71, 0x71, 0x81, 0x81, 0x81, 0x83, 0x83, 0x86, 0x83, 0x83, 0x88, 0x81, 0x89, 0x81, 0x88, 0x88, 0x8e, 0x8d, 0x55, 0x25, 0x1a, 0x16, 0x3f, 0xd7, 0xa8, 0x31, 0x94, 0x4d, 0xdd, 0x05, 0xe3, 0xe1, 0x01, 0xfc, 0xdd, 0xec, 0x01, 0xec, 0x02, 0x02, 0x02, 0x01, 0xdd, 0x1e, 0x99, 0xd8, 0x29, 0x16, 0x2f, 0x87, 0x70, 0x7b, 0x7d, 0x7d, 0x71, 0x7d, 0x86, 0x96, 0xb8, 0xa3, 0x85, 0x7f, 0x98, 0xa3, 0x97, 0x69, 0x71, 0x6d, 0x67, 0x5e, 0x67, 0x6d, 0x73, 0x67, 0x64, 0x67, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5c, 0x67, 0x5e, 0x54, 0x5e, 0x54, 0x67, 0x5e, 0x5f, 0x5f, 0x57, 0x5d, 0x5f, 0x6b, 0x5e, 0x60, 0x5d, 0xac, 0xd8, 0x11, 0x03, 0xe3, 0xe7, 0xde, 0x00, 0xfb, 0x03, 0x01, 0x02, 0xdf, 0xe1, 0x02, 0xec, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xdf, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0xec, 0xe2, 0xec, 0xdd, 0x00, 0x02, 0x05, 0x01, 0x04, 0x04, 0xfb, 0xfb, 0xfd, 0x01, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0x01, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0x02, 0xe1, 0xdf, 0xdf, 0x03, 0x03, 0x03, 0x01, 0xe0, 0xe1, 0xdf, 0x0a, 0xaa, 0xd3, 0x55, 0x69, 0x78, 0x5e, 0x67, 0x68, 0x6d, 0x6d, 0x73, 0x73, 0x6a, 0x6d, 0x6d, 0x67, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x73, 0x73, 0x6d, 0x73, 0x73, 0x7a, 0x7d, 0x81, 0x81, 0x71, 0x73, 0x78, 0x78, 0x7d, 0x7d, 0x83, 0x81, 0x81, 0x81, 0x83, 0x83, 0x86, 0x7b, 0x86, 0x83, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x8f, 0x4a, 0x1d, 0x1f, 0x16, 0x50, 0xd6, 0x6f, 0x35, 0xc8, 0x28, 0xdd, 0x02, 0xe1, 0x02, 0xfb, 0x04, 0xfb, 0x02, 0xec, 0xe1, 0xe1, 0xe1, 0xdd, 0x01, 0x0d, 0x99, 0xd8, 0xd2, 0x21, 0x16, 0x36, 0x72, 0x69, 0x71, 0x78, 0x73, 0x7d, 0x89, 0xa4, 0xb7, 0xb2, 0xc0, 0xc0, 0x9c, 0x7e, 0x72, 0x8f, 0x97, 0x93, 0x88, 0x7d, 0x5e, 0x5c, 0x67, 0x73, 0x67, 0x64, 0x64, 0x64, 0x64, 0x61, 0x61, 0x61, 0x64, 0x5e, 0x5e, 0x57, 0x5c, 0x54, 0x5c, 0x54, 0x54, 0x5e, 0x5f, 0x5e, 0x67, 0x5e, 0x5a, 0x5a, 0x57, 0xac, 0xd8, 0x2e, 0xdd, 0xe1, 0xe1, 0xe8, 0x02, 0xfb, 0x01, 0x02, 0x02, 0xe3, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x05, 0x02, 0x02, 0x02, 0x00, 0x00, 0xfb, 0xfb, 0xdd, 0x01, 0x01, 0xfb, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0x02, 0xfb, 0xfc, 0xfb, 0xfb, 0x01, 0xe1, 0xe3, 0xdf, 0x01, 0x03, 0x03, 0x01, 0x02, 0xe0, 0xe0, 0x00, 0x0d, 0xd0, 0xc6, 0x51, 0x70, 0x6d, 0x54, 0x5e, 0x57, 0x5c, 0x5c, 0x5a, 0x61, 0x64, 0x64, 0x67, 0x67, 0x68, 0x6b, 0x6b, 0x6d, 0x6d, 0x73, 0x73, 0x73, 0x6d, 0x6d, 0x73, 0x73, 0x7a, 0x7a, 0x73, 0x73, 0x6d, 0x73, 0x71, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x7d, 0x83, 0x7b, 0x83, 0x83, 0x83, 0x89, 0x81, 0x89, 0x89, 0x89, 0x88, 0x88, 0x7f, 0x34, 0x1a, 0x1f, 0x1c, 0x8c, 0xd7, 0x50, 0x46, 0xcc, 0x0f, 0x03, 0x02, 0xe6, 0x02, 0x01, 0xfc, 0x04, 0x02, 0x02, 0xe1, 0xdf, 0xe1, 0xdd, 0x03, 0x38, 0xd5, 0xd2, 0xc5, 0x26, 0x16, 0x2b, 0x6c, 0x69, 0x71, 0x73, 0x71, 0x7a, 0x89, 0xb1, 0xc2, 0xa2, 0xbb, 0xbb, 0x90, 0x85, 0x8f, 0xb4, 0xbb, 0xb7, 0xb1, 0x92, 0x6b, 0x5c, 0x67, 0x67, 0x67, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x5c, 0x5a, 0x5c, 0x54, 0x5f, 0x5c, 0x5e, 0x60, 0x60, 0x5c, 0x54, 0x54, 0x5c, 0x5e, 0x5c, 0x5a, 0x5a, 0x5a, 0x60, 0x6c, 0xcf, 0x63, 0x04, 0x02, 0xe3, 0x00, 0xe3, 0xfb, 0x01, 0x02, 0xdf, 0xe0, 0xdf, 0xe1, 0xe1, 0xe1, 0xe4, 0xe1, 0xec, 0xec, 0x02, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0xec, 0x02, 0x00, 0xdd, 0xe6, 0xde, 0xe2, 0x05, 0xdd, 0xdd, 0x01, 0x02, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe0, 0xdf, 0xe1, 0x02, 0x02, 0xec, 0xe1, 0xe1, 0xec, 0xfb, 0xfb, 0xfc, 0xfb, 0xec, 0xe4, 0xe0, 0xdf, 0xdf, 0x03, 0x01, 0x01, 0xe1, 0xe4, 0xe0, 0x00, 0x15, 0xd8, 0xb6, 0x51, 0x5e, 0x5c, 0x53, 0x68, 0x67, 0x67, 0x6a, 0x6a, 0x74, 0x74, 0x7a, 0x5e, 0x68, 0x68, 0x5f, 0x68, 0x6b, 0x6b, 0x67, 0x73, 0x67, 0x73, 0x64, 0x6d, 0x6a, 0x6d, 0x73, 0x81, 0x7a, 0x7a, 0x7d, 0x7a, 0x78, 0x7a, 0x7d, 0x81, 0x7d, 0x83, 0x7b, 0x83, 0x7b, 0x83, 0x81, 0x7a, 0x89, 0x89, 0x89, 0x89, 0x83, 0x7b, 0x7f, 0x27, 0x1a, 0x17, 0x26, 0xc8, 0xcc, 0x6f, 0x94, 0x49, 0x07, 0x04, 0xdd, 0xdf, 0x02, 0xdd, 0x04, 0x01, 0x01, 0xdf, 0xe3, 0xe0, 0xe1, 0x03, 0x06, 0x84, 0xaa, 0xc7, 0xbf, 0x27, 0x1a, 0x29, 0x6c, 0x69, 0x71, 0x73, 0x6d, 0x73, 0x81, 0x92, 0xa4, 0xb7, 0xb8, 0xa0, 0x8b, 0x8f, 0xb8, 0xb4, 0x9e, 0xc2, 0xb7, 0x93, 0x6b, 0x54, 0x5f, 0x67, 0x57, 0x5e, 0x5e, 0x5e, 0x5e, 0x54, 0x5e, 0x54, 0x5e, 0x57, 0x57, 0x5e, 0x60, 0x64, 0x61, 0x5a, 0x61, 0x60, 0x5c, 0x60, 0x5c, 0x60, 0x61, 0x6a, 0x62, 0x66, 0xd4, 0xc1, 0x07, 0x00, 0xe6, 0xe2, 0xec, 0x02, 0x02, 0xdf, 0xe1, 0xdf, 0xe0, 0xe1, 0xec, 0xe4, 0xe1, 0xe3, 0xe1, 0xec, 0xec, 0x02, 0xfb, 0x01, 0x01, 0x02, 0x02, 0xe1, 0xe3, 0xe1, 0xe3, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0xdd, 0x05, 0xe2, 0x02, 0x00, 0x00, 0x00, 0xec, 0xdd, 0xec, 0x05, 0xe2, 0xec, 0xdd, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0xe1, 0x02, 0x01, 0x02, 0x02, 0xe1, 0xe4, 0xec, 0x02, 0xfb, 0xfc, 0xfb, 0x02, 0xe4, 0xe5, 0xdf, 0x02, 0x01, 0x01, 0xec, 0xe3, 0xe0, 0xe4, 0xdd, 0x1e, 0xd8, 0xb6, 0x51, 0x57, 0x53, 0x73, 0x5e, 0x5e, 0x5c, 0x64, 0x61, 0x61, 0x60, 0x5c, 0x68, 0x5f, 0x5d, 0x65, 0x69, 0x5d, 0x6b, 0x68, 0x6b, 0x6d, 0x6d, 0x71, 0x73, 0x7d, 0x73, 0x73, 0x6a, 0x6d, 0x7a, 0x73, 0x7a, 0x7a, 0x81, 0x7a, 0x81, 0x7d, 0x7d, 0x83, 0x78, 0x83, 0x81, 0x83, 0x7a, 0x81, 0x81, 0x81, 0x83, 0x7b, 0x77, 0x66, 0x1f, 0x21, 0x12, 0x31, 0xdb, 0xc1, 0xb0, 0xc4, 0x0c, 0xfb, 0x01, 0xe1, 0xe3, 0xe6, 0xdd, 0xfb, 0x01, 0xdd, 0xe3, 0xdf, 0xe4, 0xdf, 0x05, 0x07, 0xb5, 0x50, 0xcf, 0xc7, 0x25, 0x16, 0x1f, 0x48, 0x76, 0x70, 0x6d, 0x6d, 0x64, 0x73, 0x7a, 0x7d, 0x83, 0x8a, 0x8b, 0x76, 0x8b, 0xab, 0xc2, 0xb2, 0xb1, 0xb1, 0x93, 0x68, 0x57, 0x5f, 0x5f, 0x52, 0x62, 0x5d, 0x62, 0x5d, 0x5d, 0x5f, 0x5d, 0x5f, 0x57, 0x5e, 0x5e, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x54, 0x5c, 0x5a, 0x67, 0x61, 0x5c, 0x66, 0xca, 0xc8, 0x0d, 0x01, 0xe3, 0xe6, 0x00, 0xec, 0x02, 0xe1, 0xdf, 0xe0, 0xdf, 0xe1, 0xe1, 0xe1, 0xe4, 0xec, 0xe1, 0xec, 0x01, 0xfb, 0x01, 0xec, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe2, 0xec, 0x00, 0x02, 0x05, 0xec, 0x02, 0xe2, 0x02, 0xe1, 0xe1, 0x00, 0xe3, 0x02, 0xe1, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xdf, 0x01, 0x01, 0xfb, 0xec, 0xe1, 0xe4, 0xe0, 0x00, 0xfb, 0x04, 0x00, 0x02, 0xe5, 0xe4, 0xe0, 0x02, 0x02, 0xfb, 0xe3, 0xe3, 0xe4, 0xe0, 0x00, 0x24, 0xd7, 0xac, 0x52, 0x57, 0x73, 0x54, 0x5e, 0x54, 0x5c, 0x74, 0x61, 0x5a, 0x60, 0x5e, 0x5d, 0x51, 0x66, 0x55, 0x4b, 0x51, 0x8d, 0x5d, 0x5f, 0x82, 0x77, 0x6b, 0x88, 0x7d, 0x54, 0x6d, 0x73, 0x7a, 0x7a, 0x81, 0x89, 0x81, 0x81, 0x73, 0x7d, 0x7d, 0x7d, 0x7b, 0x7d, 0x7b, 0x7d, 0x81, 0x81, 0x81, 0x89, 0x88, 0x86, 0x97, 0x72, 0x34, 0x1d, 0x14, 0x19, 0x84, 0xcb, 0x99, 0x49, 0x09, 0x06, 0x03, 0x02, 0xe0, 0xe0, 0xe3, 0x02, 0x01, 0x01, 0xdd, 0xdf, 0xe0, 0xe0, 0xe6, 0x04, 0x06, 0xb0, 0x7c, 0x8c, 0xd4, 0x27, 0x1a, 0x18, 0x36, 0x72, 0x68, 0x70, 0x7d, 0x73, 0x53, 0x53, 0x73, 0x7a, 0xa4, 0xb7, 0xc2, 0x9a, 0x83, 0x7b, 0x7d, 0x70, 0x68, 0x57, 0x52, 0x5d, 0x69, 0x65, 0x51, 0x51, 0x43, 0x37, 0x34, 0x3c, 0x3c, 0x4a, 0x72, 0x5d, 0x57, 0x5c, 0x6d, 0x5a, 0x61, 0x6a, 0x61, 0x61, 0x60, 0x5c, 0x5c, 0x5e, 0x5c, 0x5c, 0x62, 0x59, 0xc6, 0xd7, 0x13, 0x00, 0xe2, 0xe8, 0x00, 0x02, 0xe6, 0x00, 0xe8, 0xe0, 0x00, 0xe2, 0x02, 0xe1, 0xe2, 0x00, 0xec, 0xfd, 0x00, 0xdd, 0xfb, 0x01, 0x01, 0x02, 0x02, 0xe1, 0xe3, 0xe1, 0xe3, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0xe1, 0x03, 0xfb, 0x03, 0xec, 0xe4, 0xe4, 0xe0, 0x00, 0x04, 0x01, 0x0d, 0xdd, 0xe3, 0xdf, 0x00, 0xe1, 0xfb, 0x00, 0xec, 0xe6, 0xe7, 0xe3, 0x06, 0x22, 0xd6, 0xa7, 0x59, 0x54, 0x5e, 0x60, 0x67, 0x5e, 0x60, 0x5a, 0x64, 0x6d, 0x5e, 0x5d, 0x55, 0x6c, 0x39, 0x2b, 0x1f, 0x1f, 0x2b, 0x33, 0x51, 0x69, 0x69, 0x52, 0x52, 0x7b, 0x83, 0x7d, 0x78, 0x73, 0x73, 0x7a, 0x73, 0x73, 0x7a, 0x81, 0x7a, 0x7d, 0x7d, 0x7d, 0x7b, 0x7d, 0x83, 0x7d, 0x89, 0x5e, 0x88, 0x96, 0x5d, 0x7f, 0x72, 0x21, 0x1f, 0x18, 0x22, 0xcc, 0xcb, 0x0b, 0x01, 0xfb, 0x04, 0x03, 0xe1, 0xe4, 0xe4, 0xe0, 0xe1, 0x02, 0x01, 0x02, 0xe1, 0xdf, 0xe0, 0xdf, 0x01, 0x04, 0x75, 0x58, 0xbd, 0xd6, 0x2d, 0x1a, 0x16, 0x1f, 0x4b, 0x65, 0x70, 0x57, 0x54, 0x89, 0x89, 0x61, 0x89, 0xa4, 0xc2, 0xb1, 0xa4, 0x78, 0x54, 0x57, 0x4c, 0x57, 0x65, 0x69, 0x59, 0x4a, 0x34, 0x2b, 0x1f, 0x21, 0x1a, 0x1a, 0x21, 0x21, 0x25, 0x2f, 0x42, 0x62, 0x70, 0x54, 0x73, 0x61, 0x5a, 0x6a, 0x61, 0x5c, 0x5c, 0x5e, 0x5c, 0x5e, 0x5c, 0x57, 0x51, 0xb3, 0xd8, 0x13, 0xdd, 0xe1, 0xe3, 0xec, 0xe1, 0x05, 0xe2, 0x00, 0xe8, 0xe2, 0x00, 0x00, 0x01, 0x00, 0x00, 0xdd, 0x00, 0xfb, 0xfd, 0xfb, 0x02, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xdf, 0x01, 0x04, 0xfb, 0x01, 0xe4, 0xe5, 0xe4, 0x05, 0x06, 0x24, 0x84, 0x24, 0xdd, 0xe6, 0xe2, 0xec, 0xfb, 0xfd, 0xec, 0xe1, 0xe1, 0xec, 0x01, 0x28, 0xd6, 0xa7, 0x52, 0x62, 0x67, 0x5c, 0x5e, 0x54, 0x64, 0x53, 0x60, 0x6d, 0x52, 0x66, 0x87, 0xd3, 0xc5, 0xba, 0x4f, 0x21, 0x16, 0x1d, 0x25, 0x2b, 0x51, 0x85, 0x7f, 0x59, 0x5f, 0x68, 0x6b, 0x71, 0x78, 0x73, 0x6d, 0x73, 0x7a, 0x81, 0x7d, 0x7d, 0x7d, 0x78, 0x83, 0x78, 0x83, 0x7d, 0x83, 0x83, 0x77, 0x7f, 0x7f, 0x6c, 0x2f, 0x18, 0x1d, 0x12, 0x58, 0xff, 0x38, 0xdd, 0xdd, 0x04, 0x03, 0x01, 0xe0, 0xe0, 0xe4, 0xe4, 0xe1, 0x02, 0x02, 0x01, 0xe1, 0xdf, 0xe3, 0xdd, 0xdd, 0xfb, 0x40, 0xb5, 0x46, 0xd7, 0xa8, 0x14, 0x18, 0x1f, 0x27, 0x51, 0x85, 0x5d, 0x52, 0x5e, 0x6d, 0x54, 0x67, 0x78, 0x81, 0x81, 0x6b, 0x5e, 0x5c, 0x62, 0x69, 0x65, 0x59, 0x43, 0x34, 0x2b, 0x21, 0x1a, 0x1d, 0x21, 0x1d, 0x1a, 0x1d, 0x1a, 0x17, 0x1d, 0x27, 0x45, 0x69, 0x57, 0x54, 0x64, 0x64, 0x5a, 0x5c, 0x5c, 0x5e, 0x5c, 0x57, 0x5e, 0x5e, 0x5f, 0x4c, 0xa7, 0xd6, 0x22, 0x03, 0x02, 0x00, 0xe2, 0xec, 0xdd, 0xdf, 0x00, 0xe6, 0xdd, 0x00, 0x08, 0x08, 0x03, 0xfd, 0x0b, 0x00, 0x05, 0x01, 0x00, 0x01, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xdf, 0xe1, 0x03, 0xfc, 0x03, 0x01, 0xe4, 0xe4, 0xe3, 0x05, 0x11, 0xd5, 0xd8, 0xd0, 0x1e, 0xdd, 0xdd, 0xdd, 0xfb, 0xfb, 0xfb, 0xec, 0x02, 0x06, 0xfb, 0x46, 0xd4, 0x7f, 0x52, 0x60, 0x6b, 0x54, 0x5c, 0x53, 0x64, 0x60, 0x5c, 0x62, 0x51, 0x95, 0xcf, 0xce, 0xc1, 0xd8, 0xd7, 0xa1, 0x3f, 0x1a, 0x1f, 0x17, 0x25, 0x3c, 0x55, 0x7f, 0x7f, 0x5d, 0x5f, 0x68, 0x78, 0x73, 0x7a, 0x81, 0x7a, 0x7a, 0x73, 0x7d, 0x78, 0x78, 0x7b, 0x7d, 0x7b, 0x7d, 0x6b, 0x8e, 0x69, 0x7f, 0x90, 0x43, 0x1a, 0x1f, 0x1d, 0x2c, 0xd9, 0x99, 0x08, 0x05, 0x0b, 0xdd, 0xfb, 0x02, 0xe0, 0xe4, 0xe5, 0xe4, 0xe1, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xdd, 0xdd, 0x01, 0x0c, 0xc4, 0x84, 0xae, 0xcc, 0x23, 0x1d, 0x1a, 0x18, 0x2b, 0x55, 0x85, 0x69, 0x57, 0x57, 0x5e, 0x57, 0x57, 0x52, 0x57, 0x52, 0x62, 0x62, 0x77, 0x51, 0x3c, 0x2b, 0x21, 0x1a, 0x18, 0x1a, 0x1a, 0x17, 0x1a, 0x17, 0x14, 0x17, 0x1a, 0x1a, 0x1d, 0x18, 0x18, 0x30, 0x65, 0x62, 0x54, 0x6d, 0x5a, 0x5c, 0x5c, 0x5c, 0x5e, 0x5e, 0x5e, 0x5e, 0x57, 0x69, 0x90, 0xd4, 0x2e, 0xdd, 0xe2, 0x00, 0xe1, 0x05, 0xe1, 0x00, 0xe2, 0xdf, 0x00, 0x06, 0x03, 0xdd, 0xdd, 0xdd, 0x06, 0x00, 0x03, 0x05, 0xdd, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xdf, 0xe4, 0xdf, 0x01, 0x04, 0xfc, 0x02, 0xe4, 0xe5, 0xe6, 0xdd, 0x58, 0xcf, 0x79, 0xbf, 0xaa, 0x07, 0x03, 0xfd, 0x06, 0xfb, 0x00, 0xfb, 0x03, 0x03, 0x13, 0xc5, 0xcd, 0x59, 0x71, 0x54, 0x5e, 0x5c, 0x5c, 0x54, 0x6a, 0x67, 0x54, 0x59, 0x7e, 0xd3, 0xd2, 0x22, 0x07, 0x0f, 0x58, 0xd8, 0xd4, 0x3a, 0x1d, 0x17, 0x1a, 0x1f, 0x2b, 0x4e, 0x85, 0x69, 0x69, 0x68, 0x6b, 0x67, 0x71, 0x7a, 0x73, 0x5c, 0x73, 0x73, 0x78, 0x78, 0x7d, 0x78, 0x83, 0x82, 0x82, 0x77, 0x7f, 0x7e, 0x43, 0x25, 0x1a, 0x18, 0x20, 0xa1, 0xd9, 0x24, 0xdd, 0xdd, 0x00, 0x01, 0x01, 0x02, 0xe0, 0xe4, 0xe0, 0xe4, 0xdf, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xfb, 0xe1, 0x2a, 0xd9, 0xd9, 0xd0, 0x5b, 0x16, 0x18, 0x1a, 0x1d, 0x27, 0x48, 0x72, 0x72, 0x65, 0x69, 0x65, 0x65, 0x7f, 0x7e, 0x72, 0x51, 0x45, 0x39, 0x25, 0x21, 0x1f, 0x1d, 0x1a, 0x1a, 0x1a, 0x1a, 0x14, 0x1c, 0x17, 0x20, 0x26, 0x2d, 0x2c, 0x2d, 0x29, 0x16, 0x18, 0x43, 0x66, 0x57, 0x4c, 0x67, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5e, 0x68, 0x7e, 0xd3, 0x58, 0xdd, 0xe2, 0xfd, 0xe3, 0x01, 0xe2, 0xdd, 0xe6, 0xdd, 0x08, 0xdd, 0x07, 0x15, 0x15, 0xdd, 0xdd, 0x03, 0xdd, 0x02, 0xe2, 0xe1, 0xdf, 0xe1, 0xe1, 0x02, 0xec, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe0, 0xe0, 0x03, 0xfc, 0x03, 0xfb, 0xe4, 0xe0, 0xdf, 0x07, 0xbd, 0x95, 0x4e, 0x4e, 0xca, 0x50, 0x07, 0xdd, 0xdd, 0x09, 0x07, 0x01, 0x03, 0x0c, 0x94, 0xd6, 0x90, 0x52, 0x81, 0x53, 0x54, 0x78, 0x6a, 0x53, 0x5a, 0x5e, 0x57, 0x65, 0xbc, 0xd7, 0x22, 0x06, 0x03, 0xdd, 0x07, 0x49, 0xd8, 0xd7, 0x47, 0x26, 0x1a, 0x1a, 0x1f, 0x25, 0x39, 0x65, 0x7f, 0x7b, 0x70, 0x5e, 0x67, 0x7d, 0x73, 0x6d, 0x73, 0x73, 0x78, 0x7d, 0x78, 0x83, 0x7b, 0x82, 0x77, 0x98, 0x7e, 0x39, 0x25, 0x14, 0x14, 0x1c, 0x5b, 0xda, 0x84, 0x06, 0x03, 0xdf, 0xdd, 0x05, 0x01, 0x02, 0xe1, 0xe0, 0xe4, 0xe0, 0x02, 0x02, 0xe1, 0x02, 0x02, 0x01, 0xfb, 0xfb, 0x05, 0xfb, 0x05, 0x08, 0x2a, 0x99, 0xd9, 0xcc, 0x26, 0x1a, 0x1a, 0x18, 0x1a, 0x25, 0x2f, 0x43, 0x4a, 0x51, 0x51, 0x55, 0x4a, 0x43, 0x39, 0x2b, 0x25, 0x21, 0x1d, 0x1a, 0x1d, 0x1d, 0x1d, 0x17, 0x14, 0x14, 0x20, 0x31, 0x50, 0xa1, 0xce, 0xd7, 0xd4, 0xd7, 0xae, 0x79, 0x29, 0x18, 0x39, 0x65, 0x52, 0x5e, 0x5e, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x5c, 0x57, 0x66, 0xcf, 0xb5, 0x06, 0x00, 0xe2, 0xec, 0x02, 0x02, 0x05, 0x00, 0x03, 0x08, 0xdd, 0x4d, 0xd9, 0xc4, 0x1e, 0x03, 0x06, 0xdd, 0xdd, 0xdf, 0xdf, 0xe0, 0xe1, 0xe1, 0xe1, 0x01, 0xec, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xdf, 0xe4, 0xe0, 0x01, 0x04, 0xfc, 0x01, 0xe4, 0xe0, 0x00, 0x11, 0xcf, 0x87, 0x65, 0x52, 0x66, 0xd4, 0x4d, 0x15, 0x03, 0x04, 0x09, 0x0f, 0x40, 0xcb, 0xd6, 0xb6, 0x65, 0x54, 0x6a, 0x61, 0x53, 0x6d, 0x64, 0x64, 0x53, 0x67, 0x4c, 0x85, 0xd3, 0xae, 0x0a, 0xdd, 0x08, 0x04, 0x06, 0x84, 0xb0, 0xbd, 0xda, 0x6f, 0x20, 0x14, 0x1a, 0x1d, 0x27, 0x34, 0x51, 0x69, 0x7b, 0x71, 0x6d, 0x73, 0x81, 0x73, 0x73, 0x6d, 0x73, 0x78, 0x78, 0x78, 0x7b, 0x82, 0x57, 0x72, 0x37, 0x21, 0x1d, 0x14, 0x23, 0x5b, 0xd7, 0xcf, 0x99, 0x0a, 0xdd, 0x05, 0xfd, 0x00, 0xfb, 0x01, 0xe1, 0xe0, 0xe1, 0xe1, 0x01, 0x02, 0xdd, 0xe1, 0x02, 0xfb, 0xfb, 0xfb, 0xfb, 0xec, 0x00, 0x02, 0xe3, 0x09, 0x3b, 0xd5, 0xa1, 0x20, 0x17, 0x1c, 0x1a, 0x17, 0x1a, 0x21, 0x2b, 0x2b, 0x2b, 0x27, 0x25, 0x1f, 0x1d, 0x1a, 0x1a, 0x17, 0x1a, 0x17, 0x14, 0x14, 0x12, 0x14, 0x26, 0x31, 0xae, 0xbd, 0xd2, 0xd7, 0xd6, 0xc5, 0xba, 0xc5, 0xda, 0xda, 0xa1, 0x2d, 0x27, 0x43, 0x76, 0x57, 0x5e, 0x5c, 0x5c, 0x61, 0x60, 0x61, 0x61, 0x5a, 0x57, 0x59, 0xbf, 0xd0, 0x1e, 0x00, 0x05, 0xec, 0x02, 0x00, 0xdd, 0x01, 0xdd, 0xdd, 0x15, 0xdc, 0xcb, 0xcb, 0x75, 0x09, 0x03, 0xdd, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe1, 0xec, 0x01, 0xfb, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe0, 0xdf, 0x01, 0xfb, 0x03, 0x02, 0xe0, 0xdf, 0xdd, 0x0e, 0xd4, 0x66, 0x44, 0x82, 0x57, 0x7e, 0xd6, 0xcb, 0xc1, 0xaa, 0xc1, 0xd0, 0xd7, 0xd2, 0x9d, 0x4b, 0x65, 0x67, 0x53, 0x7a, 0x5c, 0x53, 0x53, 0x73, 0x53, 0x68, 0x59, 0x95, 0xd4, 0x49, 0x03, 0x00, 0x00, 0xdf, 0x07, 0xb5, 0x58, 0x50, 0xc8, 0xd8, 0xae, 0x2d, 0x17, 0x18, 0x1f, 0x1f, 0x30, 0x4a, 0x69, 0x76, 0x69, 0x6b, 0x6b, 0x62, 0x6d, 0x73, 0x71, 0x70, 0x82, 0x76, 0x7f, 0x72, 0x4a, 0x21, 0x17, 0x1f, 0x1a, 0x20, 0x6f, 0xd9, 0xc7, 0x3a, 0xdb, 0x1e, 0x00, 0x02, 0x00, 0xe2, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0x01, 0xe1, 0xe3, 0x01, 0x01, 0xfb, 0xfb, 0x02, 0xe3, 0xe8, 0xe3, 0x02, 0x04, 0x06, 0x84, 0xda, 0x8c, 0x17, 0x14, 0x17, 0x1a, 0x1d, 0x1d, 0x1a, 0x1a, 0x18, 0x1a, 0x16, 0x1a, 0x16, 0x1a, 0x1a, 0x1d, 0x1c, 0x1a, 0x17, 0x19, 0x20, 0x2e, 0x94, 0xd9, 0xce, 0xc8, 0xa1, 0x5b, 0x3e, 0x2d, 0x3e, 0x79, 0xb5, 0x63, 0xd5, 0xd8, 0x2d, 0x27, 0x59, 0x69, 0x5e, 0x5c, 0x60, 0x61, 0x61, 0x61, 0x61, 0x60, 0x67, 0x59, 0x9d, 0xd7, 0x4d, 0xdd, 0x01, 0xec, 0xec, 0xec, 0xdd, 0xfd, 0x03, 0x07, 0xb5, 0xb0, 0x50, 0xa1, 0xdb, 0x13, 0xdd, 0x05, 0xdd, 0xdf, 0xe0, 0xdf, 0xe0, 0xe1, 0xe1, 0x01, 0xfb, 0xfb, 0x01, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0x02, 0x01, 0x01, 0x02, 0xec, 0xe1, 0x01, 0x01, 0x13, 0xc5, 0x6c, 0x5d, 0x54, 0x74, 0x54, 0x9c, 0xb9, 0xd1, 0xcd, 0xcd, 0xb9, 0x90, 0x66, 0x59, 0x52, 0x68, 0x6d, 0x64, 0x6a, 0x5a, 0x61, 0x64, 0x6a, 0x4c, 0x65, 0x85, 0xcf, 0xd0, 0x11, 0x00, 0xe4, 0xe8, 0xdd, 0xfb, 0x49, 0xcc, 0x26, 0x4f, 0xa8, 0xd6, 0xcf, 0x3f, 0x1d, 0x18, 0x1a, 0x18, 0x25, 0x39, 0x4e, 0x72, 0x7e, 0x66, 0x69, 0x62, 0x8e, 0x77, 0x62, 0x85, 0x4a, 0x2b, 0x2b, 0x1f, 0x12, 0x16, 0x16, 0x29, 0x94, 0xd8, 0xbd, 0x47, 0x35, 0xd5, 0x11, 0x00, 0xe6, 0xe0, 0xe0, 0xe1, 0x02, 0x02, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xec, 0xec, 0xfb, 0xfb, 0xfb, 0xec, 0xe4, 0xe4, 0xe8, 0x00, 0x03, 0xfb, 0x46, 0xda, 0xcf, 0xae, 0x31, 0x12, 0x17, 0x20, 0x17, 0x14, 0x1c, 0x16, 0x17, 0x16, 0x17, 0x1d, 0x17, 0x17, 0x1d, 0x1a, 0x14, 0x1c, 0x3b, 0x99, 0xd9, 0xcb, 0xcb, 0xd5, 0x58, 0x2c, 0x2c, 0x3a, 0x47, 0x91, 0xd5, 0x24, 0x04, 0x22, 0xdb, 0xd6, 0x27, 0x39, 0x52, 0x57, 0x67, 0x74, 0x5a, 0x5a, 0x53, 0x5a, 0x67, 0x54, 0x76, 0x72, 0xbf, 0xd2, 0x22, 0xdd, 0xe2, 0xe3, 0xe6, 0xe8, 0xdd, 0x07, 0x46, 0xce, 0x6c, 0x55, 0x55, 0xd3, 0x49, 0xdd, 0xdf, 0xdf, 0xe0, 0xdf, 0xe1, 0xdf, 0xe1, 0x02, 0x02, 0xfb, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0xe1, 0xec, 0xe1, 0x01, 0xdd, 0x11, 0xc5, 0x80, 0x51, 0x5e, 0x53, 0x6a, 0x4c, 0x52, 0x77, 0x69, 0x77, 0x5d, 0x5f, 0x57, 0x5e, 0x5e, 0x67, 0x5c, 0x5c, 0x5a, 0x60, 0x61, 0x60, 0x4c, 0x78, 0x65, 0xbc, 0xd7, 0x84, 0x01, 0xe1, 0xe5, 0xe4, 0xe3, 0xdd, 0x13, 0x94, 0xc5, 0x3a, 0x41, 0x91, 0xd6, 0xd6, 0x79, 0x29, 0x12, 0x1a, 0x18, 0x18, 0x27, 0x36, 0x39, 0x43, 0x4a, 0x4a, 0x37, 0x39, 0x2f, 0x25, 0x21, 0x21, 0x16, 0x16, 0x18, 0x23, 0x50, 0xce, 0xda, 0xba, 0x35, 0x31, 0xc1, 0x49, 0xfb, 0x05, 0xe0, 0xe4, 0xe0, 0xe0, 0xe1, 0x01, 0xfb, 0x01, 0x02, 0xe1, 0xe3, 0xe1, 0xe1, 0x01, 0xfb, 0xfb, 0xfb, 0xec, 0xe4, 0xe3, 0xe4, 0xe8, 0xfb, 0x06, 0xb5, 0x91, 0xbd, 0xd4, 0xc7, 0x5b, 0x1d, 0x12, 0x1c, 0x20, 0x14, 0x1c, 0x19, 0x17, 0x1c, 0x20, 0x1a, 0x14, 0x14, 0x1f, 0x3a, 0xa1, 0xd0, 0xd9, 0x99, 0x2a, 0x04, 0x49, 0xc1, 0xd7, 0xbd, 0xc8, 0xd5, 0x6f, 0x15, 0xdd, 0x00, 0x07, 0x32, 0xd8, 0xa8, 0x27, 0x59, 0x62, 0x60, 0x5a, 0x61, 0x6a, 0x61, 0x54, 0x64, 0x54, 0x57, 0x59, 0xa6, 0xd6, 0xa1, 0x15, 0xfb, 0x02, 0x05, 0xdd, 0x09, 0x7c, 0xc7, 0x6c, 0x51, 0x57, 0x62, 0xd1, 0x7c, 0x06, 0x05, 0xe1, 0xe3, 0xe3, 0x02, 0xe1, 0xe1, 0xe1, 0x02, 0xfb, 0xfb, 0x01, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0xe1, 0xec, 0xe1, 0xec, 0x01, 0xdd, 0x0c, 0xc8, 0x9d, 0x55, 0x68, 0x53, 0x6a, 0x54, 0x57, 0x52, 0x57, 0x4c, 0x57, 0x54, 0x5e, 0x5c, 0x5c, 0x5c, 0x5a, 0x5c, 0x5a, 0x64, 0x64, 0x53, 0x67, 0x8d, 0xa6, 0xca, 0xd8, 0x24, 0xdd, 0xe3, 0xe7, 0xe3, 0xe6, 0xfb, 0xfb, 0x1b, 0xb0, 0x7c, 0x50, 0x31, 0x50, 0xc8, 0xda, 0xbd, 0x58, 0x1c, 0x1c, 0x1a, 0x16, 0x16, 0x1d, 0x21, 0x1d, 0x21, 0x1f, 0x18, 0x1a, 0x18, 0x16, 0x12, 0x16, 0x20, 0x50, 0xc5, 0xcf, 0xba, 0x56, 0x35, 0x41, 0xae, 0xc1, 0x0f, 0xfb, 0xde, 0xe4, 0xe3, 0xe4, 0xe1, 0x02, 0xfb, 0x01, 0x01, 0x02, 0xe1, 0xe1, 0xe3, 0xe1, 0xec, 0xfb, 0xfb, 0xfb, 0xec, 0xe3, 0xe7, 0xe4, 0xe1, 0x01, 0xfb, 0x49, 0xb0, 0x35, 0xba, 0xcf, 0xd4, 0xbd, 0x47, 0x26, 0x16, 0x14, 0x12, 0x17, 0x14, 0x14, 0x14, 0x1d, 0x2d, 0x4f, 0xfe, 0xd4, 0xd6, 0xcc, 0xc4, 0x0c, 0xdd, 0x07, 0x06, 0x11, 0x2e, 0x38, 0x28, 0x0f, 0x06, 0xdd, 0xdd, 0x01, 0xdd, 0x09, 0x58, 0xd8, 0x3f, 0x2f, 0x5d, 0x67, 0x53, 0x5a, 0x7a, 0x61, 0x53, 0x67, 0x61, 0x54, 0x54, 0x72, 0xb3, 0xd4, 0xbd, 0x2e, 0x0a, 0x11, 0x2e, 0x91, 0xd3, 0xb3, 0x52, 0x5f, 0x54, 0x5d, 0xc6, 0xb5, 0x09, 0xdf, 0xe1, 0xe3, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xfb, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xec, 0x01, 0x09, 0xb5, 0xc5, 0x6c, 0x65, 0x78, 0x53, 0x5e, 0x68, 0x6b, 0x68, 0x5c, 0x5c, 0x5c, 0x64, 0x53, 0x64, 0x64, 0x67, 0x64, 0x60, 0x5c, 0x5c, 0x5e, 0x9a, 0x8f, 0xc3, 0xd4, 0xaa, 0x07, 0x06, 0x00, 0xe7, 0xe3, 0xe1, 0x08, 0xdd, 0xfb, 0x11, 0x84, 0xc4, 0xcb, 0xc4, 0xc4, 0xc4, 0xc4, 0xdb, 0xc1, 0x46, 0x26, 0x20, 0x1a, 0x18, 0x1a, 0x16, 0x16, 0x16, 0x12, 0x16, 0x23, 0x23, 0x2e, 0x6f, 0xd0, 0xd8, 0xd7, 0xce, 0x8c, 0x5b, 0x8c, 0xcf, 0x6f, 0x13, 0xfb, 0xfc, 0x00, 0xe0, 0xe0, 0xe0, 0xe1, 0x02, 0x01, 0xfb, 0x01, 0xec, 0xe1, 0xe0, 0xe0, 0xe1, 0xec, 0x01, 0xfb, 0xfb, 0xec, 0xec, 0xe0, 0xe7, 0x00, 0x05, 0x01, 0x11, 0xcc, 0x6f, 0x26, 0x4f, 0xc7, 0xd4, 0xd4, 0xce, 0xae, 0x79, 0x3a, 0x3a, 0x35, 0x3e, 0x6e, 0xba, 0xc7, 0xd4, 0xd1, 0xca, 0x5b, 0x58, 0xc4, 0x0f, 0xdd, 0x03, 0x04, 0xfb, 0xfb, 0x01, 0xdd, 0x00, 0x02, 0xe2, 0xe2, 0x02, 0x01, 0xdd, 0x0f, 0xc1, 0xd6, 0x2b, 0x51, 0x62, 0x5a, 0x53, 0x6a, 0x61, 0x53, 0x7a, 0x6a, 0x61, 0x54, 0x57, 0x51, 0xa7, 0xd1, 0xcf, 0xd8, 0xc7, 0xd6, 0xd1, 0x51, 0x3d, 0x7d, 0x6d, 0x54, 0x65, 0xbf, 0xc8, 0x09, 0x00, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0xe1, 0x01, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xe1, 0xec, 0xe1, 0xec, 0x03, 0xdd, 0x49, 0xd8, 0x9d, 0x66, 0x97, 0x4c, 0x52, 0x54, 0x5e, 0x5e, 0x64, 0x5c, 0x61, 0x61, 0x6a, 0x6a, 0x64, 0x64, 0x5c, 0x54, 0x5e, 0x57, 0xa9, 0x7f, 0xb4, 0xc7, 0xd7, 0x22, 0xdd, 0x05, 0xdd, 0xe6, 0xe0, 0x00, 0xe6, 0x05, 0xdd, 0x00, 0x01, 0x0b, 0x24, 0x2a, 0x24, 0x0a, 0x11, 0x40, 0xdb, 0xdb, 0xda, 0xbd, 0x79, 0x47, 0x3f, 0x36, 0x31, 0x35, 0x50, 0x7c, 0x7c, 0xc1, 0xdb, 0xdb, 0xb0, 0x49, 0x49, 0xaa, 0xc4, 0xbd, 0x58, 0x2c, 0x09, 0xfb, 0xfb, 0x01, 0xe3, 0xe6, 0xe3, 0xe1, 0x02, 0x01, 0x03, 0xfb, 0x01, 0x02, 0xe0, 0xe3, 0xe0, 0xe0, 0xec, 0xec, 0xfb, 0xfb, 0x01, 0xec, 0xe3, 0xe0, 0xdf, 0xe1, 0x09, 0xfb, 0x24, 0xc8, 0xa1, 0x3e, 0x29, 0x3e, 0x91, 0xbd, 0xd2, 0xda, 0xda, 0xda, 0xd7, 0xd7, 0xd8, 0xd7, 0xc7, 0xba, 0x6e, 0x35, 0x3a, 0xb0, 0x4d, 0x04, 0x06, 0x08, 0x03, 0x04, 0x01, 0x00, 0xe3, 0xe6, 0xe5, 0xe4, 0x00, 0xe2, 0xdd, 0x00, 0x06, 0x32, 0xdb, 0x5b, 0x39, 0x52, 0x60, 0x5a, 0x61, 0x61, 0x54, 0x64, 0x61, 0x5a, 0x60, 0x5c, 0x62, 0x52, 0x59, 0x90, 0x87, 0x87, 0x7e, 0x65, 0x62, 0x73, 0x61, 0x53, 0x57, 0x7e, 0xca, 0xc4, 0x07, 0x00, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0xe3, 0xe0, 0xec, 0xec, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xec, 0xe1, 0xe1, 0xe4, 0xec, 0x05, 0xdd, 0x11, 0xdb, 0xc7, 0x9d, 0x90, 0x7f, 0x5f, 0x5f, 0x54, 0x5e, 0x5c, 0x53, 0x64, 0x6a, 0x61, 0x5c, 0x53, 0x54, 0x5e, 0x70, 0x8b, 0x97, 0xb4, 0x90, 0xd1, 0xd7, 0x58, 0x06, 0x03, 0x04, 0xec, 0x00, 0xe2, 0xdd, 0x00, 0xe2, 0xe6, 0xdf, 0xde, 0xdd, 0x00, 0xdd, 0xdd, 0x00, 0xdd, 0x09, 0x0d, 0x2a, 0x99, 0xd5, 0xda, 0xd7, 0xce, 0xd7, 0xd4, 0xd8, 0xd6, 0xd7, 0xdb, 0xd5, 0x49, 0x1e, 0x0c, 0xfb, 0x04, 0x0a, 0x0a, 0x09, 0x09, 0x01, 0xdd, 0x07, 0xfd, 0x05, 0xe1, 0xe3, 0xe6, 0x00, 0x02, 0xfb, 0xfb, 0x03, 0x01, 0x02, 0xe1, 0xe0, 0xe4, 0xe1, 0xe1, 0x02, 0xfb, 0xfb, 0xfb, 0xec, 0xec, 0xe6, 0xe1, 0x00, 0xdd, 0x01, 0x01, 0x1b, 0x94, 0xcc, 0xb0, 0x6f, 0x84, 0xcc, 0x84, 0x28, 0x28, 0x2e, 0x49, 0x94, 0xc8, 0xc1, 0x58, 0x3e, 0x3e, 0xae, 0xcc, 0x63, 0x11, 0x00, 0xfd, 0x00, 0xdd, 0x00, 0x02, 0xea, 0xde, 0xe4, 0xe4, 0xe5, 0xe3, 0xe2, 0xe1, 0xe6, 0x02, 0x09, 0x99, 0xd2, 0x2f, 0x4a, 0x60, 0x6a, 0x61, 0x61, 0x64, 0x53, 0x53, 0x6a, 0x5a, 0x53, 0x73, 0x54, 0x4c, 0x4c, 0x52, 0x76, 0x57, 0x57, 0x7a, 0x74, 0x53, 0x74, 0x62, 0x95, 0xd2, 0x99, 0x07, 0xdf, 0x00, 0xe1, 0x02, 0xe1, 0xdf, 0xe0, 0xdf, 0xe1, 0x02, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xec, 0xec, 0xec, 0xe1, 0xec, 0xe1, 0x05, 0x00, 0x07, 0x4d, 0xd0, 0xcf, 0x9d, 0xa6, 0x8f, 0x86, 0x68, 0x68, 0x5e, 0x54, 0x53, 0x60, 0x5c, 0x67, 0x68, 0x7b, 0x7f, 0x98, 0xb4, 0xb9, 0xac, 0xd1, 0xce, 0x94, 0x0d, 0xdd, 0x01, 0xfd, 0x01, 0x00, 0x08, 0x05, 0x00, 0xdf, 0xe0, 0xe0, 0x00, 0xdf, 0xe2, 0xe2, 0x02, 0xe2, 0x05, 0xdd, 0x06, 0x01, 0x01, 0x28, 0xb5, 0xc1, 0x84, 0xae, 0x91, 0xba, 0x4f, 0x58, 0xc8, 0x3b, 0x09, 0x04, 0xdd, 0x00, 0x01, 0xe6, 0x00, 0xe3, 0xe6, 0xe1, 0xfd, 0xdd, 0x00, 0xe6, 0xe3, 0xe3, 0xde, 0x00, 0x01, 0x03, 0xfc, 0xfb, 0x01, 0x02, 0xe0, 0xe0, 0xe0, 0xe4, 0xec, 0xec, 0xfb, 0xfb, 0xfb, 0x02, 0x02, 0xe6, 0x00, 0xe6, 0x00, 0x09, 0x04, 0x01, 0x06, 0x22, 0x4d, 0x99, 0x75, 0x4d, 0x11, 0x03, 0x07, 0x03, 0x01, 0x09, 0x32, 0x99, 0xc4, 0xb5, 0xcb, 0x75, 0x24, 0x09, 0x03, 0x02, 0xe6, 0xdf, 0xe6, 0xdd, 0x00, 0x00, 0xe3, 0xde, 0xe7, 0x00, 0xfd, 0x00, 0xe3, 0xe7, 0x00, 0xdf, 0x32, 0xda, 0x80, 0x4a, 0x52, 0x73, 0x5a, 0x61, 0x64, 0x54, 0x53, 0x64, 0x5c, 0x53, 0x5c, 0x64, 0x7a, 0x81, 0x78, 0x54, 0x54, 0x67, 0x5c, 0x53, 0x61, 0x54, 0x8f, 0xb6, 0xd6, 0x49, 0xdd, 0x05, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe0, 0xe4, 0xe1, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xe1, 0xec, 0xec, 0xec, 0xe1, 0xe1, 0xe1, 0xec, 0xdd, 0x06, 0x0a, 0xc1, 0xd0, 0xba, 0xb6, 0xb3, 0xa5, 0x98, 0x97, 0x8d, 0x86, 0x83, 0x86, 0x86, 0x8d, 0xa0, 0xa5, 0xa6, 0xa6, 0xac, 0x9d, 0xbf, 0xda, 0x94, 0x0f, 0x03, 0x01, 0x02, 0x00, 0xfd, 0x00, 0xfc, 0xdd, 0x01, 0xe8, 0xe3, 0xe5, 0xe6, 0xdf, 0xdf, 0xe6, 0x00, 0xe3, 0x05, 0xe1, 0x00, 0x0b, 0x00, 0x01, 0x38, 0xcb, 0x99, 0x58, 0x3e, 0x3e, 0x58, 0xc8, 0xb0, 0x13, 0xfb, 0x07, 0x03, 0xde, 0xe6, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe0, 0xe2, 0xe3, 0xe6, 0xe0, 0xe2, 0x00, 0x02, 0xfb, 0xfb, 0x03, 0xfb, 0x01, 0xe1, 0xe1, 0xe4, 0xe0, 0xe4, 0xec, 0x02, 0xfb, 0x01, 0xfb, 0x01, 0xdd, 0x00, 0xe2, 0xe3, 0x05, 0xe1, 0x00, 0x08, 0x04, 0xdd, 0x01, 0xdd, 0x01, 0x00, 0xdd, 0x03, 0xdd, 0x03, 0x06, 0xdd, 0xdd, 0x06, 0x0b, 0x10, 0x0d, 0xdd, 0x06, 0x00, 0xe1, 0xe3, 0xe6, 0xe3, 0xe1, 0x02, 0x05, 0x05, 0x01, 0x00, 0xe1, 0x05, 0xdd, 0xfb, 0xe2, 0xe3, 0xe4, 0xe2, 0xdd, 0x84, 0xd6, 0x55, 0x4c, 0x67, 0x53, 0x53, 0x78, 0x5c, 0x67, 0x54, 0x60, 0x6a, 0x5a, 0x61, 0x61, 0x53, 0x53, 0x5c, 0x64, 0x78, 0x54, 0x54, 0x78, 0x97, 0xa7, 0xbf, 0xd0, 0x24, 0xdd, 0xe2, 0x02, 0x05, 0x02, 0x02, 0xe0, 0xe0, 0xe0, 0xe0, 0x02, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xec, 0xe1, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xe1, 0xe1, 0x05, 0x01, 0xdd, 0x15, 0xb5, 0xdb, 0xc5, 0xb6, 0xa6, 0x95, 0xa6, 0xb9, 0xb4, 0xaf, 0xb4, 0xb4, 0xb4, 0xb3, 0x95, 0x9d, 0xa8, 0xc7, 0xd7, 0xdb, 0x49, 0x0d, 0x01, 0xdd, 0xdf, 0xe3, 0x05, 0xfb, 0xfc, 0xfc, 0xfc, 0x01, 0xdf, 0xe0, 0xe0, 0xdf, 0xdf, 0xe1, 0xe1, 0xdf, 0xe1, 0xe1, 0x02, 0x02, 0x01, 0x01, 0xdd, 0x04, 0x15, 0x40, 0x99, 0xc4, 0xcb, 0xb0, 0x40, 0x0f, 0xdd, 0xdd, 0x08, 0x02, 0xe1, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0x01, 0xfb, 0x03, 0xfb, 0x01, 0x02, 0xe1, 0xe1, 0xe0, 0xe4, 0xe1, 0xe1, 0xec, 0x01, 0x01, 0xfb, 0x01, 0x02, 0xe1, 0x02, 0xdf, 0xe1, 0x02, 0x01, 0x02, 0x01, 0x02, 0xdd, 0x02, 0x02, 0xdf, 0x02, 0xdf, 0xe1, 0xe6, 0xe1, 0x02, 0x02, 0xdd, 0x01, 0xdd, 0x01, 0x01, 0x02, 0xe1, 0xdf, 0xe0, 0xe0, 0xe1, 0xe1, 0x02, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xec, 0xe0, 0xe4, 0xe3, 0x06, 0x0f, 0xd7, 0xca, 0x7e, 0x4c, 0x5e, 0x5e, 0x54, 0x78, 0x67, 0x5c, 0x5c, 0x5c, 0x61, 0x5a, 0x5a, 0x61, 0x61, 0x6a, 0x67, 0x67, 0x5f, 0x76, 0x8b, 0xb3, 0xac, 0xd6, 0xb5, 0x09, 0x00, 0xdd, 0xfd, 0x02, 0x01, 0x02, 0xdf, 0xe0, 0xe4, 0xe1, 0xec, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xec, 0xe1, 0xec, 0xec, 0xec, 0xec, 0xec, 0xe1, 0x00, 0xe1, 0x05, 0x01, 0x06, 0x1e, 0x75, 0xd8, 0xce, 0xc7, 0xbf, 0xb6, 0xac, 0x9d, 0x95, 0xac, 0xac, 0x9d, 0x9d, 0xc5, 0xd6, 0xda, 0xd0, 0xaa, 0x1e, 0x0d, 0x00, 0xdd, 0xe8, 0xe6, 0xe3, 0xe3, 0xfb, 0xfb, 0xfc, 0xfb, 0x03, 0x01, 0xe0, 0xdf, 0x02, 0x01, 0x01, 0x02, 0x02, 0xe1, 0xec, 0xe1, 0xec, 0x05, 0x05, 0x01, 0x00, 0x00, 0x05, 0x09, 0x0b, 0x0a, 0xfd, 0xfb, 0x01, 0xdd, 0x00, 0x00, 0xdf, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xe1, 0xe0, 0xe4, 0xe0, 0xe0, 0xe1, 0xe1, 0x02, 0x02, 0x01, 0xfb, 0x01, 0xfb, 0x02, 0xe1, 0xe1, 0xe3, 0xe1, 0xe0, 0xec, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3, 0xdd, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3, 0xe1, 0x02, 0x02, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0xec, 0xe6, 0xe0, 0xe3, 0xdd, 0x07, 0x2e, 0xcf, 0xc6, 0x59, 0x72, 0x62, 0x44, 0x52, 0x54, 0x54, 0x54, 0x64, 0x6d, 0x6a, 0x6a, 0x6a, 0x6a, 0x64, 0x54, 0x52, 0x76, 0xa6, 0xb3, 0x9d, 0xd6, 0xd5, 0x1b, 0x01, 0x05, 0xe6, 0x00, 0xfd, 0x01, 0x02, 0xdf, 0xe0, 0xe0, 0xe0, 0x02, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xec, 0x02, 0x02, 0xfb, 0x02, 0xec, 0xec, 0xe3, 0xdd, 0xe1, 0x04, 0x00, 0xdd, 0x0f, 0x40, 0xd0, 0xd7, 0xd7, 0xd2, 0xce, 0xce, 0xd4, 0xd6, 0xd6, 0xd7, 0xda, 0xd8, 0xc4, 0x58, 0x1b, 0x09, 0xdd, 0x00, 0x00, 0xe1, 0xe6, 0xe0, 0xe3, 0xdd, 0x01, 0xfc, 0x03, 0xfc, 0xfb, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0xec, 0x00, 0xe1, 0xec, 0x05, 0x02, 0x01, 0x00, 0x00, 0x05, 0x02, 0xdd, 0xdd, 0xe6, 0xe2, 0xe2, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x01, 0x01, 0x01, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xec, 0xe1, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xec, 0xec, 0xec, 0x02, 0xec, 0x02, 0xec, 0xec, 0xec, 0xec, 0xec, 0x02, 0xec, 0x02, 0xec, 0xfb, 0xec, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x02, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x01, 0xfc, 0xdd, 0x01, 0xe6, 0xe6, 0xdf, 0x00, 0x01, 0x07, 0x58, 0xd8, 0xbf, 0x55, 0x55, 0x72, 0x65, 0x62, 0x6b, 0x6b, 0x6d, 0x5e, 0x53, 0x54, 0x53, 0x6d, 0x5e, 0x86, 0xb8, 0xc3, 0x95, 0xb6, 0xcf, 0xd0, 0x40, 0xdd, 0x04, 0x00, 0xfd, 0x00, 0xfb, 0x01, 0x01, 0xdf, 0xe0, 0xe0, 0xe1, 0xec, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xec, 0xe1, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0xec, 0xe6, 0x00, 0xdf, 0xfd, 0xdd, 0xdd, 0x06, 0x0c, 0x1e, 0x49, 0x84, 0xb5, 0xc1, 0xb5, 0xb0, 0x84, 0x63, 0x32, 0x1e, 0x0a, 0x04, 0x03, 0x03, 0x05, 0xe2, 0xe6, 0xe0, 0xe3, 0xe3, 0xe1, 0xec, 0xfb, 0x01, 0xfb, 0x03, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0xec, 0x02, 0xec, 0xe6, 0xec, 0x00, 0x00, 0xe1, 0xe6, 0x05, 0xe2, 0x00, 0xe1, 0xe6, 0xe1, 0xe3, 0x00, 0xe3, 0x00, 0xe1, 0xe1, 0x02, 0x02, 0x01, 0xfb, 0x01, 0x02, 0xe1, 0xe4, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xe1, 0xe1, 0xec, 0x02, 0xec, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdd, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xec, 0xe1, 0xec, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x05, 0x01, 0x00, 0x01, 0xe6, 0x02, 0x01, 0x04, 0x01, 0x0c, 0x46, 0xda, 0xcf, 0x80, 0x4e, 0x4e, 0x52, 0x52, 0x52, 0x5d, 0x69, 0x69, 0x7b, 0x7f, 0x8a, 0xbb, 0xbb, 0x87, 0x95, 0xcf, 0xd7, 0xd0, 0x2e, 0x09, 0x06, 0xdd, 0x00, 0xe6, 0xfb, 0xfb, 0xfb, 0x01, 0xe1, 0xe0, 0xe0, 0xe1, 0x01, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0x02, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0xdf, 0xe2, 0xe1, 0x00, 0xe6, 0xfd, 0xdd, 0xdd, 0xfb, 0xfc, 0xfc, 0xfc, 0x06, 0x09, 0x0a, 0x09, 0x04, 0x03, 0x01, 0xdd, 0x01, 0x03, 0x01, 0x01, 0xe3, 0xe0, 0xe6, 0xe1, 0x02, 0x05, 0x05, 0xdd, 0x02, 0x02, 0x02, 0x02, 0x01, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0xec, 0xec, 0xe6, 0xec, 0xe1, 0xe3, 0xdd, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0xe6, 0xe2, 0xe6, 0xe6, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0x02, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0x01, 0x02, 0x01, 0x02, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xec, 0x01, 0xfb, 0x02, 0x02, 0xe1, 0xe1, 0xdf, 0xdf, 0xe1, 0x02, 0x02, 0x02, 0x02, 0xec, 0xec, 0xec, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0xdd, 0x01, 0x01, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x01, 0x01, 0xe1, 0xe1, 0xe1, 0xe0, 0xe3, 0xe0, 0xe1, 0xdf, 0x05, 0x01, 0xdd, 0x01, 0x01, 0x01, 0x05, 0xfd, 0x04, 0xdd, 0x07, 0x32, 0xd0, 0xda, 0xbf, 0xb6, 0x87, 0x87, 0x90, 0x87, 0x87, 0x95, 0xa7, 0xb3, 0xb3, 0xc6, 0xc6, 0xca, 0xd7, 0xd8, 0x63, 0x1e, 0x03, 0xdd, 0xde, 0x00, 0xe8, 0xe3, 0x00, 0xfd, 0x03, 0x01, 0xdf, 0xdf, 0xe0, 0xe1, 0xfb, 0xfb, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0xdd, 0xe6, 0xe1, 0xe3, 0xe1, 0xec, 0x05, 0xfd, 0xfb, 0xfc, 0x04, 0xfc, 0x03, 0xfb, 0xdd, 0x00, 0x03, 0xdd, 0xdd, 0xdd, 0x05, 0x02, 0x02, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x01, 0x05, 0x04, 0x00, 0x02, 0xdf, 0xe1, 0xe1, 0xe1, 0xfb, 0xfb, 0xfb, 0x01, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xe1, 0xec, 0x00, 0xe3, 0x02, 0x05, 0xe6, 0x05, 0xe6, 0x05, 0x05, 0x02, 0x01, 0xdd, 0x02, 0x02, 0xe1, 0x00, 0xe1, 0x02, 0xe1, 0xe1, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe1, 0x02, 0x02, 0xfb, 0xfb, 0x01, 0x02, 0xe1, 0xdf, 0xe1, 0xdf, 0x02, 0x02, 0x02, 0x01, 0x02, 0xfb, 0xec, 0xec, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0xfb, 0x02, 0xfb, 0x02, 0xe1, 0xe1, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0xdf, 0xe1, 0xe0, 0xe1, 0xdf, 0xe1, 0xe1, 0xdf, 0xe1, 0x05, 0xfb, 0x01, 0x01, 0xdd, 0xec, 0xe6, 0xe1, 0x00, 0xdd, 0x13, 0x84, 0xd2, 0xd6, 0xca, 0xd3, 0xcf, 0xcf, 0xc5, 0xc7, 0xc5, 0xc7, 0xd4, 0xc7, 0xce, 0xd8, 0xb0, 0x2a, 0x09, 0xdd, 0xdd, 0x03, 0x00, 0xe7, 0xe7, 0x00, 0xfd, 0xdd, 0xfc, 0x01, 0x02, 0xe0, 0xdf, 0xe1, 0xfb, 0xfb, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0x02, 0x01, 0xfb, 0x03, 0x01, 0x03, 0x02, 0x00, 0xe3, 0xe0, 0xe1, 0xe3, 0xec, 0xe3, 0xfd, 0xec, 0x00, 0x00, 0xe1, 0xe1, 0xe6, 0xe8, 0xe0, 0xe0, 0xe6, 0xe0, 0xdf, 0xe3, 0xdf, 0xe6, 0xe6, 0xe6, 0x02, 0x01, 0x01, 0x04, 0x04, 0x01, 0xdf, 0xe0, 0xe4, 0xe4, 0xe1, 0xec, 0xfb, 0xfb, 0x02, 0xdf, 0xe1, 0xdf, 0xe1, 0xe1, 0xe1, 0xec, 0xe3, 0xe1, 0x02, 0xe3, 0xdd, 0xdd, 0x01, 0x05, 0x00, 0xe1, 0xec, 0xe1, 0xdd, 0xe3, 0x02, 0xe6, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0xfb, 0x01, 0xfb, 0x02, 0x02, 0xe1, 0xe0, 0xe1, 0xe4, 0xe1, 0xe1, 0x02, 0x01, 0xfb, 0xfb, 0x01, 0x02, 0xe1, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0x01, 0x01, 0x01, 0xec, 0xfb, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x02, 0xe1, 0xdd, 0x02, 0xe3, 0x02, 0xe1, 0xe1, 0xe1, 0xe1, 0xdf, 0xe4, 0xe4, 0xe0, 0xe3, 0xec, 0x02, 0x01, 0x02, 0xe1, 0xe1, 0xe1, 0xdf, 0xe1, 0x02, 0x01, 0xdd, 0xdf, 0xdf, 0xe6, 0x04, 0xfb, 0xfb, 0xec, 0xe3, 0xe7, 0xe3, 0xe5, 0xde, 0x00, 0x04, 0x13, 0x2e, 0x94, 0xaa, 0xcc, 0xd5, 0xd5, 0xdb, 0xd5, 0xd5, 0x99, 0x94, 0x49, 0x13, 0x06, 0x00, 0x02, 0xe2, 0xde, 0xdf, 0xe3, 0xe8, 0xe3, 0xe3, 0x08, 0x00, 0x03, 0x01, 0xdf, 0xdf, 0xe0, 0x02, 0xfb, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0x02, 0xdf, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x05, 0x00, 0xe6, 0xe6, 0xe3, 0xe3, 0xe2, 0xec, 0xec, 0xe3, 0xe1, 0xe7, 0xe6, 0xe4, 0xe3, 0xe4, 0xe0, 0xe4, 0xe4, 0xe4, 0xe0, 0xe6, 0xe0, 0xe3, 0xe3, 0xe3, 0xfb, 0x04, 0xfc, 0x03, 0x04, 0x04, 0xe1, 0xe4, 0xe5, 0xe4, 0xe4, 0xec, 0xfb, 0xfb, 0xe1, 0xdf, 0xe0, 0xdf, 0xe0, 0xe1, 0xe1, 0xe1, 0xec, 0xec, 0xec, 0x02, 0xfb, 0x02, 0x01, 0x02, 0xec, 0xec, 0xe3, 0xe1, 0xe6, 0x05, 0xe1, 0x00, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0xfb, 0x01, 0xfb, 0x01, 0xfb, 0xfb, 0x01, 0x01, 0xe1, 0xe1, 0xe0, 0xe4, 0xe0, 0xe1, 0xe1, 0x02, 0x01, 0xfc, 0xfc, 0xfb, 0x02, 0xdf, 0xe0, 0xdf, 0xe0, 0xdf, 0x02, 0x02, 0x01, 0xfb, 0xfb, 0xfb, 0xec, 0xe1, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xe1, 0xdf, 0xdf, 0xe1, 0xdf, 0xe1, 0xdf, 0xe0, 0xdf, 0xe4, 0xe5, 0xe5, 0xe4, 0xe0, 0xe1, 0xe1, 0x02, 0x02, 0xdf, 0x02, 0xdf, 0x02, 0x02, 0x01, 0x01, 0x01, 0xdf, 0xe0, 0x01, 0xdd, 0x03, 0xfc, 0xec, 0xe1, 0xe5, 0xe9, 0xe5, 0xe3, 0x05, 0x06, 0xfc, 0x06, 0x06, 0x0a, 0x11, 0x15, 0x1e, 0x1e, 0x15, 0x11, 0x0a, 0x06, 0xfb, 0xdd, 0xfc, 0x02, 0xe0, 0xe3, 0x00, 0xdf, 0xe8, 0xe4, 0xe4, 0xe7, 0x00, 0x08, 0xfb, 0x03, 0x02, 0xdf, 0xe1, 0x02, 0xfb, 0xfc, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-};
-
-const lv_img_dsc_t image26 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 256,
-  .header.h = 208,
-  .data_size = 54272,
-  .data = image26_map,
-};
@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE3
-#define LV_ATTRIBUTE_IMG_IMAGE3
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE3 uint8_t image3_map[] = {
-  0x0d, 0x0d, 0x0d, 0xff, 	/*Color of index 0*/
-  0x07, 0x07, 0x07, 0xff, 	/*Color of index 1*/
-  0x20, 0x5c, 0xfa, 0xff, 	/*Color of index 2*/
-  0x1a, 0x5a, 0xf4, 0xff, 	/*Color of index 3*/
-  0x1b, 0x58, 0xfa, 0xff, 	/*Color of index 4*/
-  0x16, 0x56, 0xf3, 0xff, 	/*Color of index 5*/
-  0x19, 0x53, 0xf3, 0xff, 	/*Color of index 6*/
-  0x1a, 0x53, 0xe2, 0xff, 	/*Color of index 7*/
-  0x17, 0x50, 0xeb, 0xff, 	/*Color of index 8*/
-  0x17, 0x4f, 0xe5, 0xff, 	/*Color of index 9*/
-  0x19, 0x51, 0xda, 0xff, 	/*Color of index 10*/
-  0x17, 0x4d, 0xe1, 0xff, 	/*Color of index 11*/
-  0x17, 0x4c, 0xdb, 0xff, 	/*Color of index 12*/
-  0x16, 0x4a, 0xda, 0xff, 	/*Color of index 13*/
-  0x18, 0x4c, 0xd2, 0xff, 	/*Color of index 14*/
-  0x16, 0x48, 0xd7, 0xff, 	/*Color of index 15*/
-  0x19, 0x49, 0xcd, 0xff, 	/*Color of index 16*/
-  0x16, 0x47, 0xcf, 0xff, 	/*Color of index 17*/
-  0x16, 0x46, 0xcb, 0xff, 	/*Color of index 18*/
-  0x16, 0x44, 0xc9, 0xff, 	/*Color of index 19*/
-  0x16, 0x41, 0xc4, 0xff, 	/*Color of index 20*/
-  0x18, 0x45, 0xb3, 0xff, 	/*Color of index 21*/
-  0x17, 0x41, 0xac, 0xff, 	/*Color of index 22*/
-  0x17, 0x3f, 0xa3, 0xff, 	/*Color of index 23*/
-  0x14, 0x3a, 0x9a, 0xff, 	/*Color of index 24*/
-  0x16, 0x37, 0x91, 0xff, 	/*Color of index 25*/
-  0x14, 0x33, 0x83, 0xff, 	/*Color of index 26*/
-  0x13, 0x31, 0x89, 0xff, 	/*Color of index 27*/
-  0x17, 0x31, 0x7a, 0xff, 	/*Color of index 28*/
-  0x10, 0x2b, 0x81, 0xff, 	/*Color of index 29*/
-  0x0e, 0x29, 0x80, 0xff, 	/*Color of index 30*/
-  0x10, 0x2a, 0x7b, 0xff, 	/*Color of index 31*/
-  0x12, 0x2a, 0x72, 0xff, 	/*Color of index 32*/
-  0x0d, 0x28, 0x7a, 0xff, 	/*Color of index 33*/
-  0x15, 0x2b, 0x69, 0xff, 	/*Color of index 34*/
-  0x0e, 0x27, 0x75, 0xff, 	/*Color of index 35*/
-  0x0c, 0x26, 0x77, 0xff, 	/*Color of index 36*/
-  0x0d, 0x26, 0x72, 0xff, 	/*Color of index 37*/
-  0x0c, 0x25, 0x70, 0xff, 	/*Color of index 38*/
-  0x13, 0x28, 0x5b, 0xff, 	/*Color of index 39*/
-  0x0e, 0x24, 0x69, 0xff, 	/*Color of index 40*/
-  0x0c, 0x23, 0x6d, 0xff, 	/*Color of index 41*/
-  0x0e, 0x23, 0x62, 0xff, 	/*Color of index 42*/
-  0x0b, 0x1f, 0x68, 0xff, 	/*Color of index 43*/
-  0x0d, 0x20, 0x63, 0xff, 	/*Color of index 44*/
-  0x12, 0x23, 0x53, 0xff, 	/*Color of index 45*/
-  0x0c, 0x20, 0x5b, 0xff, 	/*Color of index 46*/
-  0x0b, 0x1c, 0x60, 0xff, 	/*Color of index 47*/
-  0x0c, 0x1e, 0x53, 0xff, 	/*Color of index 48*/
-  0x0b, 0x1b, 0x5b, 0xff, 	/*Color of index 49*/
-  0x09, 0x19, 0x5e, 0xff, 	/*Color of index 50*/
-  0x0b, 0x1b, 0x4b, 0xff, 	/*Color of index 51*/
-  0x10, 0x1d, 0x3c, 0xff, 	/*Color of index 52*/
-  0x0b, 0x1a, 0x43, 0xff, 	/*Color of index 53*/
-  0x0c, 0x18, 0x3c, 0xff, 	/*Color of index 54*/
-  0x0e, 0x19, 0x34, 0xff, 	/*Color of index 55*/
-  0x0a, 0x16, 0x38, 0xff, 	/*Color of index 56*/
-  0x0c, 0x16, 0x32, 0xff, 	/*Color of index 57*/
-  0x0b, 0x14, 0x2a, 0xff, 	/*Color of index 58*/
-  0x0b, 0x12, 0x24, 0xff, 	/*Color of index 59*/
-  0x08, 0x0f, 0x20, 0xff, 	/*Color of index 60*/
-  0x08, 0x0e, 0x1f, 0xff, 	/*Color of index 61*/
-  0xbd, 0xf7, 0xff, 0xff, 	/*Color of index 62*/
-  0xc1, 0xf5, 0xfe, 0xff, 	/*Color of index 63*/
-  0xcc, 0xf2, 0xfe, 0xff, 	/*Color of index 64*/
-  0xbb, 0xf2, 0xfe, 0xff, 	/*Color of index 65*/
-  0xb7, 0xef, 0xfe, 0xff, 	/*Color of index 66*/
-  0xc5, 0xec, 0xfe, 0xff, 	/*Color of index 67*/
-  0xba, 0xec, 0xf8, 0xff, 	/*Color of index 68*/
-  0xba, 0xeb, 0xfb, 0xff, 	/*Color of index 69*/
-  0xb5, 0xea, 0xfd, 0xff, 	/*Color of index 70*/
-  0xc2, 0xe7, 0xfd, 0xff, 	/*Color of index 71*/
-  0xae, 0xe7, 0xff, 0xff, 	/*Color of index 72*/
-  0xb5, 0xe8, 0xf7, 0xff, 	/*Color of index 73*/
-  0xb6, 0xe7, 0xfa, 0xff, 	/*Color of index 74*/
-  0xc8, 0xe6, 0xf2, 0xff, 	/*Color of index 75*/
-  0xb2, 0xe4, 0xfa, 0xff, 	/*Color of index 76*/
-  0xaa, 0xe3, 0xff, 0xff, 	/*Color of index 77*/
-  0xb0, 0xe2, 0xf7, 0xff, 	/*Color of index 78*/
-  0xac, 0xdf, 0xfc, 0xff, 	/*Color of index 79*/
-  0xb6, 0xdc, 0xff, 0xff, 	/*Color of index 80*/
-  0xac, 0xdf, 0xf7, 0xff, 	/*Color of index 81*/
-  0xa8, 0xdb, 0xfb, 0xff, 	/*Color of index 82*/
-  0xa2, 0xda, 0xfe, 0xff, 	/*Color of index 83*/
-  0xa4, 0xd9, 0xfa, 0xff, 	/*Color of index 84*/
-  0xa2, 0xd6, 0xfa, 0xff, 	/*Color of index 85*/
-  0xaa, 0xd8, 0xee, 0xff, 	/*Color of index 86*/
-  0xb9, 0xda, 0xe1, 0xff, 	/*Color of index 87*/
-  0xa2, 0xd6, 0xf4, 0xff, 	/*Color of index 88*/
-  0xb1, 0xd5, 0xe3, 0xff, 	/*Color of index 89*/
-  0x9d, 0xd1, 0xf5, 0xff, 	/*Color of index 90*/
-  0x90, 0xcb, 0xfe, 0xff, 	/*Color of index 91*/
-  0x98, 0xcd, 0xf4, 0xff, 	/*Color of index 92*/
-  0xa2, 0xcf, 0xe5, 0xff, 	/*Color of index 93*/
-  0x93, 0xc9, 0xf3, 0xff, 	/*Color of index 94*/
-  0xb0, 0xcc, 0xd8, 0xff, 	/*Color of index 95*/
-  0xa0, 0xca, 0xdf, 0xff, 	/*Color of index 96*/
-  0x89, 0xc3, 0xfe, 0xff, 	/*Color of index 97*/
-  0x91, 0xc5, 0xf1, 0xff, 	/*Color of index 98*/
-  0x8b, 0xc2, 0xf1, 0xff, 	/*Color of index 99*/
-  0x84, 0xbc, 0xfa, 0xff, 	/*Color of index 100*/
-  0xa4, 0xc4, 0xd2, 0xff, 	/*Color of index 101*/
-  0x88, 0xbd, 0xf0, 0xff, 	/*Color of index 102*/
-  0x81, 0xb9, 0xf4, 0xff, 	/*Color of index 103*/
-  0x82, 0xb8, 0xed, 0xff, 	/*Color of index 104*/
-  0x94, 0xbc, 0xcf, 0xff, 	/*Color of index 105*/
-  0x7d, 0xb4, 0xf0, 0xff, 	/*Color of index 106*/
-  0x7f, 0xb4, 0xed, 0xff, 	/*Color of index 107*/
-  0x83, 0xb5, 0xe2, 0xff, 	/*Color of index 108*/
-  0x7c, 0xb2, 0xec, 0xff, 	/*Color of index 109*/
-  0xa0, 0xb9, 0xc4, 0xff, 	/*Color of index 110*/
-  0x75, 0xb0, 0xf0, 0xff, 	/*Color of index 111*/
-  0x7e, 0xb1, 0xdf, 0xff, 	/*Color of index 112*/
-  0x79, 0xae, 0xea, 0xff, 	/*Color of index 113*/
-  0x71, 0xac, 0xed, 0xff, 	/*Color of index 114*/
-  0x79, 0xad, 0xe0, 0xff, 	/*Color of index 115*/
-  0x8d, 0xb2, 0xc4, 0xff, 	/*Color of index 116*/
-  0x6a, 0xa7, 0xee, 0xff, 	/*Color of index 117*/
-  0x9d, 0xb2, 0xb7, 0xff, 	/*Color of index 118*/
-  0x64, 0xa3, 0xef, 0xff, 	/*Color of index 119*/
-  0x92, 0xac, 0xb8, 0xff, 	/*Color of index 120*/
-  0x79, 0xa6, 0xd3, 0xff, 	/*Color of index 121*/
-  0x5a, 0x9a, 0xef, 0xff, 	/*Color of index 122*/
-  0x72, 0x9e, 0xc9, 0xff, 	/*Color of index 123*/
-  0x5b, 0x97, 0xe8, 0xff, 	/*Color of index 124*/
-  0x81, 0xa3, 0xb2, 0xff, 	/*Color of index 125*/
-  0x40, 0x91, 0xff, 0xff, 	/*Color of index 126*/
-  0x52, 0x93, 0xef, 0xff, 	/*Color of index 127*/
-  0x85, 0x9f, 0xa7, 0xff, 	/*Color of index 128*/
-  0x48, 0x8b, 0xf0, 0xff, 	/*Color of index 129*/
-  0x7c, 0x9a, 0xa7, 0xff, 	/*Color of index 130*/
-  0x3c, 0x84, 0xfb, 0xff, 	/*Color of index 131*/
-  0x45, 0x84, 0xeb, 0xff, 	/*Color of index 132*/
-  0x2a, 0x80, 0xff, 0xff, 	/*Color of index 133*/
-  0x3c, 0x80, 0xee, 0xff, 	/*Color of index 134*/
-  0x66, 0x8d, 0xaf, 0xff, 	/*Color of index 135*/
-  0x1a, 0x7b, 0xff, 0xff, 	/*Color of index 136*/
-  0x7c, 0x90, 0x96, 0xff, 	/*Color of index 137*/
-  0x5b, 0x84, 0xc3, 0xff, 	/*Color of index 138*/
-  0x73, 0x8e, 0x99, 0xff, 	/*Color of index 139*/
-  0x21, 0x77, 0xff, 0xff, 	/*Color of index 140*/
-  0x34, 0x79, 0xee, 0xff, 	/*Color of index 141*/
-  0x21, 0x73, 0xfe, 0xff, 	/*Color of index 142*/
-  0x1d, 0x70, 0xfe, 0xff, 	/*Color of index 143*/
-  0x2a, 0x71, 0xed, 0xff, 	/*Color of index 144*/
-  0x1d, 0x6d, 0xfd, 0xff, 	/*Color of index 145*/
-  0x5d, 0x80, 0x9e, 0xff, 	/*Color of index 146*/
-  0x1b, 0x6a, 0xfd, 0xff, 	/*Color of index 147*/
-  0x6d, 0x83, 0x8b, 0xff, 	/*Color of index 148*/
-  0x18, 0x68, 0xfe, 0xff, 	/*Color of index 149*/
-  0x1b, 0x66, 0xfe, 0xff, 	/*Color of index 150*/
-  0x1e, 0x68, 0xf5, 0xff, 	/*Color of index 151*/
-  0x21, 0x6a, 0xec, 0xff, 	/*Color of index 152*/
-  0x67, 0x80, 0x8a, 0xff, 	/*Color of index 153*/
-  0x16, 0x65, 0xfe, 0xff, 	/*Color of index 154*/
-  0x1a, 0x65, 0xf9, 0xff, 	/*Color of index 155*/
-  0x1c, 0x66, 0xf3, 0xff, 	/*Color of index 156*/
-  0x1e, 0x66, 0xeb, 0xff, 	/*Color of index 157*/
-  0x6f, 0x7d, 0x82, 0xff, 	/*Color of index 158*/
-  0x1a, 0x63, 0xf2, 0xff, 	/*Color of index 159*/
-  0x13, 0x5e, 0xfd, 0xff, 	/*Color of index 160*/
-  0x19, 0x61, 0xee, 0xff, 	/*Color of index 161*/
-  0x18, 0x60, 0xf0, 0xff, 	/*Color of index 162*/
-  0x1e, 0x62, 0xe4, 0xff, 	/*Color of index 163*/
-  0x18, 0x5f, 0xeb, 0xff, 	/*Color of index 164*/
-  0x12, 0x5c, 0xf2, 0xff, 	/*Color of index 165*/
-  0x54, 0x72, 0x91, 0xff, 	/*Color of index 166*/
-  0x05, 0x59, 0xff, 0xff, 	/*Color of index 167*/
-  0x0a, 0x5a, 0xf9, 0xff, 	/*Color of index 168*/
-  0x1d, 0x60, 0xdc, 0xff, 	/*Color of index 169*/
-  0x1a, 0x5c, 0xea, 0xff, 	/*Color of index 170*/
-  0x0e, 0x58, 0xf2, 0xff, 	/*Color of index 171*/
-  0x14, 0x59, 0xec, 0xff, 	/*Color of index 172*/
-  0x19, 0x58, 0xe5, 0xff, 	/*Color of index 173*/
-  0x61, 0x71, 0x76, 0xff, 	/*Color of index 174*/
-  0x19, 0x5a, 0xdb, 0xff, 	/*Color of index 175*/
-  0x09, 0x55, 0xf1, 0xff, 	/*Color of index 176*/
-  0x1d, 0x5c, 0xd2, 0xff, 	/*Color of index 177*/
-  0x51, 0x6d, 0x86, 0xff, 	/*Color of index 178*/
-  0x15, 0x55, 0xe9, 0xff, 	/*Color of index 179*/
-  0x0a, 0x55, 0xec, 0xff, 	/*Color of index 180*/
-  0x1d, 0x59, 0xcb, 0xff, 	/*Color of index 181*/
-  0x58, 0x6c, 0x77, 0xff, 	/*Color of index 182*/
-  0x26, 0x5c, 0xbc, 0xff, 	/*Color of index 183*/
-  0x18, 0x56, 0xd4, 0xff, 	/*Color of index 184*/
-  0x04, 0x50, 0xee, 0xff, 	/*Color of index 185*/
-  0x1a, 0x56, 0xc3, 0xff, 	/*Color of index 186*/
-  0x02, 0x4a, 0xed, 0xff, 	/*Color of index 187*/
-  0x17, 0x51, 0xca, 0xff, 	/*Color of index 188*/
-  0x55, 0x65, 0x6c, 0xff, 	/*Color of index 189*/
-  0x1c, 0x53, 0xba, 0xff, 	/*Color of index 190*/
-  0x17, 0x4e, 0xc4, 0xff, 	/*Color of index 191*/
-  0x48, 0x60, 0x74, 0xff, 	/*Color of index 192*/
-  0x1c, 0x50, 0xb1, 0xff, 	/*Color of index 193*/
-  0x18, 0x4a, 0xba, 0xff, 	/*Color of index 194*/
-  0x18, 0x4a, 0xb1, 0xff, 	/*Color of index 195*/
-  0x19, 0x4b, 0xaa, 0xff, 	/*Color of index 196*/
-  0x19, 0x4a, 0xa5, 0xff, 	/*Color of index 197*/
-  0x4c, 0x59, 0x5e, 0xff, 	/*Color of index 198*/
-  0x1b, 0x48, 0x9c, 0xff, 	/*Color of index 199*/
-  0x46, 0x55, 0x5e, 0xff, 	/*Color of index 200*/
-  0x17, 0x44, 0x9a, 0xff, 	/*Color of index 201*/
-  0x18, 0x43, 0x93, 0xff, 	/*Color of index 202*/
-  0x38, 0x4d, 0x5d, 0xff, 	/*Color of index 203*/
-  0x41, 0x4e, 0x52, 0xff, 	/*Color of index 204*/
-  0x19, 0x41, 0x8b, 0xff, 	/*Color of index 205*/
-  0x18, 0x3c, 0x8b, 0xff, 	/*Color of index 206*/
-  0x19, 0x3e, 0x81, 0xff, 	/*Color of index 207*/
-  0x38, 0x48, 0x53, 0xff, 	/*Color of index 208*/
-  0x3e, 0x47, 0x4c, 0xff, 	/*Color of index 209*/
-  0x17, 0x39, 0x79, 0xff, 	/*Color of index 210*/
-  0x1a, 0x3a, 0x72, 0xff, 	/*Color of index 211*/
-  0x34, 0x42, 0x4b, 0xff, 	/*Color of index 212*/
-  0x38, 0x40, 0x43, 0xff, 	/*Color of index 213*/
-  0x16, 0x33, 0x71, 0xff, 	/*Color of index 214*/
-  0x18, 0x34, 0x6b, 0xff, 	/*Color of index 215*/
-  0x2e, 0x3b, 0x42, 0xff, 	/*Color of index 216*/
-  0x16, 0x32, 0x63, 0xff, 	/*Color of index 217*/
-  0x17, 0x2f, 0x5b, 0xff, 	/*Color of index 218*/
-  0x2b, 0x35, 0x3a, 0xff, 	/*Color of index 219*/
-  0x16, 0x2c, 0x53, 0xff, 	/*Color of index 220*/
-  0x29, 0x30, 0x34, 0xff, 	/*Color of index 221*/
-  0x16, 0x29, 0x4a, 0xff, 	/*Color of index 222*/
-  0x17, 0x26, 0x42, 0xff, 	/*Color of index 223*/
-  0x11, 0x24, 0x49, 0xff, 	/*Color of index 224*/
-  0x22, 0x29, 0x2e, 0xff, 	/*Color of index 225*/
-  0x12, 0x24, 0x44, 0xff, 	/*Color of index 226*/
-  0x14, 0x22, 0x3a, 0xff, 	/*Color of index 227*/
-  0x1c, 0x21, 0x26, 0xff, 	/*Color of index 228*/
-  0x12, 0x1d, 0x32, 0xff, 	/*Color of index 229*/
-  0x0f, 0x19, 0x2c, 0xff, 	/*Color of index 230*/
-  0x15, 0x1a, 0x1e, 0xff, 	/*Color of index 231*/
-  0x0f, 0x16, 0x26, 0xff, 	/*Color of index 232*/
-  0x10, 0x16, 0x21, 0xff, 	/*Color of index 233*/
-  0x11, 0x15, 0x19, 0xff, 	/*Color of index 234*/
-  0x0a, 0x11, 0x1a, 0xff, 	/*Color of index 235*/
-  0x0b, 0x10, 0x14, 0xff, 	/*Color of index 236*/
-  0x08, 0x0e, 0x1b, 0xff, 	/*Color of index 237*/
-  0x08, 0x0e, 0x17, 0xff, 	/*Color of index 238*/
-  0x07, 0x0e, 0x15, 0xff, 	/*Color of index 239*/
-  0x06, 0x0b, 0x12, 0xff, 	/*Color of index 240*/
-  0x05, 0x09, 0x0b, 0xff, 	/*Color of index 241*/
-  0x04, 0x08, 0x09, 0xff, 	/*Color of index 242*/
-  0x01, 0x06, 0x0f, 0xff, 	/*Color of index 243*/
-  0x02, 0x06, 0x08, 0xff, 	/*Color of index 244*/
-  0xe3, 0xfe, 0xfe, 0xff, 	/*Color of index 245*/
-  0xda, 0xfe, 0xfe, 0xff, 	/*Color of index 246*/
-  0xd2, 0xfa, 0xfe, 0xff, 	/*Color of index 247*/
-  0xc3, 0xfa, 0xff, 0xff, 	/*Color of index 248*/
-  0xb0, 0xc5, 0xbf, 0xff, 	/*Color of index 249*/
-  0x03, 0x06, 0x04, 0xff, 	/*Color of index 250*/
-  0x46, 0x48, 0x3b, 0xff, 	/*Color of index 251*/
-  0x44, 0x3e, 0x2e, 0xff, 	/*Color of index 252*/
-  0x07, 0x07, 0x01, 0xff, 	/*Color of index 253*/
-  0x01, 0x01, 0x00, 0xff, 	/*Color of index 254*/
-  0x07, 0x01, 0x00, 0xff, 	/*Color of index 255*/
-
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xfa, 0xfa, 0xee, 0xf1, 0xfe, 0xfd, 0xfa, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xfd, 0xfe, 0xfa, 0xfa, 0xfe, 0xfd, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xfa, 0xee, 0x28, 0x1b, 0x1e, 0x1d, 0x1d, 0x2c, 0x38, 0xf1, 0xfd, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xfd, 0xfa, 0x3c, 0x33, 0x28, 0x1d, 0x1d, 0x1d, 0x2c, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0x1d, 0x24, 0x26, 0x26, 0x29, 0x25, 0x25, 0x24, 0x21, 0x2c, 0x3b, 0xfa, 0xfa, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfa, 0xf0, 0x33, 0x1f, 0x21, 0x24, 0x25, 0x25, 0x25, 0x26, 0x25, 0x1e, 0xfa, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0x01, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xfd, 0x2c, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x21, 0x23, 0x38, 0xfd, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xfd, 0x3c, 0x2a, 0x1d, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x24, 0x30, 0xfa, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0x1d, 0x25, 0x25, 0x25, 0x26, 0x29, 0x29, 0x26, 0x25, 0x25, 0x25, 0x25, 0x23, 0x21, 0x1f, 0x36, 0xfa, 0xfa, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfa, 0x3b, 0x26, 0x1e, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x23, 0x25, 0x25, 0x25, 0x25, 0x1d, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xfa, 0x38, 0x24, 0x25, 0x25, 0x29, 0x23, 0x17, 0x1b, 0x32, 0x29, 0x25, 0x25, 0x26, 0x25, 0x24, 0x23, 0x24, 0x21, 0x39, 0xfe, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0x01, 0xfa, 0x3c, 0x29, 0x1e, 0x23, 0x26, 0x23, 0x25, 0x26, 0x25, 0x29, 0x2b, 0x32, 0x29, 0x2f, 0x29, 0x26, 0x25, 0x21, 0x39, 0xfa, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xfd, 0x2c, 0x23, 0x25, 0x29, 0x1b, 0x8c, 0x95, 0x91, 0x91, 0x15, 0x2c, 0x29, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25, 0x21, 0x25, 0x3d, 0xfa, 0x01, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfd, 0xf0, 0x2a, 0x1e, 0x23, 0x26, 0x23, 0x26, 0x26, 0x25, 0x26, 0x2f, 0x19, 0xaf, 0x8c, 0x8e, 0x8f, 0x1d, 0x28, 0x25, 0x23, 0x2c, 0xfd, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xfe, 0x1d, 0x26, 0x25, 0x2b, 0x8e, 0x9f, 0x97, 0x9c, 0x97, 0x93, 0x8f, 0x18, 0x2f, 0x29, 0x26, 0x26, 0x26, 0x26, 0x23, 0x25, 0x1d, 0x30, 0x01, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xfd, 0x33, 0x1e, 0x23, 0x26, 0x25, 0x26, 0x23, 0x26, 0x25, 0x2c, 0x23, 0xa3, 0x91, 0x97, 0x9c, 0x97, 0x9b, 0x8f, 0x2f, 0x29, 0x26, 0x1f, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xeb, 0x1e, 0x26, 0x2c, 0xc2, 0x93, 0x9c, 0x97, 0x9c, 0x97, 0x97, 0x9b, 0x8f, 0xa3, 0x25, 0x28, 0x26, 0x25, 0x29, 0x26, 0x25, 0x26, 0x24, 0x1d, 0x3a, 0xfa, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xfa, 0x3c, 0x1f, 0x21, 0x29, 0x23, 0x25, 0x23, 0x26, 0x25, 0x29, 0x2f, 0xc2, 0x8e, 0x97, 0x9c, 0x9c, 0x9c, 0x9f, 0x97, 0x95, 0xc3, 0x2b, 0x26, 0x1e, 0xed, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfa, 0x36, 0x23, 0x26, 0x2f, 0x91, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9c, 0x97, 0x9f, 0x93, 0x8f, 0x17, 0x31, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x21, 0x2a, 0x01, 0x01, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x01, 0xfa, 0x30, 0x1d, 0x25, 0x25, 0x26, 0x23, 0x25, 0x26, 0x23, 0x2b, 0x25, 0x9d, 0x91, 0x9c, 0x97, 0x9c, 0x97, 0x9f, 0x9c, 0x9c, 0x97, 0x91, 0x32, 0x25, 0x24, 0x38, 0xfa, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xfa, 0x30, 0x24, 0x29, 0x19, 0x91, 0x9c, 0x97, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x91, 0xaf, 0x2f, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x24, 0x1e, 0x3b, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xff, 0xfe, 0xff, 0xfa, 0x01, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfd, 0xee, 0x21, 0x23, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x32, 0x18, 0x8e, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9c, 0x91, 0x19, 0x29, 0x23, 0x30, 0xfa, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0x01, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xfa, 0x26, 0x25, 0x2b, 0xba, 0x95, 0x97, 0x9f, 0x97, 0x9f, 0x97, 0x9f, 0x9c, 0x9c, 0x9f, 0x97, 0x9c, 0x97, 0x93, 0x25, 0x29, 0x29, 0x25, 0x26, 0x25, 0x26, 0x26, 0x23, 0x1d, 0x30, 0xfd, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0x01, 0xeb, 0xb5, 0xb1, 0xc1, 0xd7, 0xf0, 0xff, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfa, 0x36, 0x1d, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x31, 0xbf, 0x8f, 0x9f, 0x9c, 0x97, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x93, 0xbf, 0x28, 0x25, 0x29, 0xfa, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0x01, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xfe, 0x1f, 0x23, 0x2f, 0x93, 0x9c, 0x97, 0x9c, 0x9c, 0x97, 0x9f, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0x9c, 0x91, 0x19, 0x2f, 0x26, 0x25, 0x26, 0x26, 0x26, 0x25, 0x26, 0x24, 0x1f, 0xf0, 0xfd, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xcf, 0x91, 0x9b, 0x96, 0x95, 0x8c, 0xb5, 0xe9, 0xfe, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfd, 0x28, 0x21, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x2f, 0xa3, 0x93, 0x9f, 0x9c, 0x9c, 0x9f, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x97, 0x97, 0x97, 0x2f, 0x26, 0x1d, 0xfa, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0x01, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf0, 0x1e, 0x26, 0x23, 0x8e, 0x97, 0x9c, 0x97, 0x97, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x97, 0x8f, 0x16, 0x2f, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x1d, 0x39, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xfe, 0xb7, 0x91, 0x9f, 0x9c, 0x9c, 0x9b, 0x8c, 0xc5, 0xff, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfd, 0xf0, 0x21, 0x25, 0x23, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x2b, 0x9d, 0x93, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x97, 0x8f, 0x26, 0x26, 0x1d, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0x3b, 0x21, 0x29, 0x18, 0x91, 0x97, 0x97, 0x9c, 0x9c, 0x9c, 0x97, 0x9f, 0x9c, 0x9f, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x8f, 0xc3, 0x32, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x1e, 0x30, 0xfd, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xbe, 0x91, 0x9f, 0x9f, 0x9c, 0x9f, 0x95, 0x97, 0xec, 0xfe, 0x00, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfd, 0x3b, 0x1e, 0x25, 0x25, 0x25, 0x26, 0x23, 0x26, 0x24, 0x26, 0x29, 0x29, 0x97, 0x93, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x97, 0x97, 0x9c, 0x97, 0x9c, 0x97, 0x9f, 0x93, 0x18, 0x2b, 0x21, 0x3a, 0xfa, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0x01, 0x38, 0x24, 0x28, 0xc2, 0x93, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x97, 0x9f, 0x9f, 0x97, 0x9f, 0x9f, 0x91, 0xc2, 0x31, 0x25, 0x26, 0x26, 0x26, 0x25, 0x25, 0x26, 0x23, 0x24, 0x26, 0xfa, 0x01, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xfa, 0xfe, 0xfa, 0x01, 0xfe, 0xb7, 0x91, 0x9f, 0x9c, 0x9f, 0x9c, 0x9b, 0x8f, 0xe7, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0x35, 0x1e, 0x23, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x29, 0x29, 0x91, 0x97, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9c, 0x97, 0x93, 0xc3, 0x29, 0x21, 0x39, 0xfa, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0x01, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xfd, 0x33, 0x25, 0x2b, 0xaf, 0x97, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9f, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x91, 0xc2, 0x2f, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x24, 0x1f, 0xf0, 0xfa, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xfa, 0xfe, 0xf1, 0xde, 0xd9, 0xd9, 0xda, 0xe8, 0xfe, 0xfe, 0xba, 0x93, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x8e, 0xeb, 0xfa, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfa, 0x30, 0x1e, 0x26, 0x26, 0x25, 0x26, 0x25, 0x23, 0x25, 0x26, 0x29, 0x26, 0x91, 0x97, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x97, 0x9c, 0x9c, 0x97, 0x93, 0xb8, 0x2c, 0x24, 0x35, 0xfa, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xfd, 0x30, 0x23, 0x2f, 0x97, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x91, 0xc2, 0x32, 0x25, 0x25, 0x25, 0x29, 0x26, 0x26, 0x25, 0x25, 0x25, 0x1d, 0x3c, 0xfa, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xd9, 0xa3, 0x8c, 0x95, 0x93, 0x93, 0x93, 0x91, 0x8e, 0xc5, 0xec, 0xb1, 0x9b, 0x9f, 0x9c, 0x9f, 0x9c, 0x9b, 0x8f, 0xff, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfa, 0x2a, 0x21, 0x26, 0x26, 0x25, 0x23, 0x25, 0x25, 0x26, 0x26, 0x29, 0x26, 0x91, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9f, 0x97, 0x31, 0x23, 0x30, 0xfa, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xfa, 0x2c, 0x25, 0x2b, 0x8e, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x97, 0x9c, 0x9b, 0x9c, 0x97, 0x9f, 0x97, 0x9f, 0x97, 0x9c, 0x9c, 0x9f, 0x8f, 0x15, 0x2f, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x1d, 0x3a, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xfe, 0xcd, 0x88, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9b, 0x95, 0x91, 0xb1, 0x9b, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x95, 0xba, 0xfe, 0x01, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfd, 0x28, 0x21, 0x26, 0x26, 0x25, 0x23, 0x26, 0x25, 0x23, 0x25, 0x26, 0x29, 0x93, 0x97, 0x9b, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x97, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x97, 0x9c, 0x8f, 0x2f, 0x25, 0x2c, 0xfd, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xfd, 0x28, 0x25, 0x23, 0x8f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0xaa, 0x0a, 0xa4, 0x93, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x8f, 0x17, 0x2c, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x24, 0x1e, 0x3a, 0xfd, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xe2, 0xc1, 0x8e, 0x95, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x91, 0xd7, 0xf0, 0xff, 0xfe, 0xff, 0xfa, 0x01, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfd, 0x26, 0x24, 0x25, 0x26, 0x25, 0x25, 0x23, 0x25, 0x25, 0x25, 0x26, 0x2b, 0x97, 0x97, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x93, 0xa4, 0x0a, 0xa4, 0x97, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x8f, 0x26, 0x26, 0x28, 0xfd, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x01, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xfe, 0x23, 0x26, 0x1a, 0x91, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x93, 0x13, 0x13, 0x13, 0x10, 0x9b, 0x97, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x8f, 0x1b, 0x28, 0x25, 0x26, 0x23, 0x25, 0x25, 0x26, 0x25, 0x23, 0x25, 0x1d, 0x3c, 0xfa, 0xf1, 0xf1, 0xf1, 0xf2, 0xfa, 0xff, 0xfe, 0xff, 0xeb, 0xfe, 0xff, 0xe3, 0xb5, 0x8f, 0x9b, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x93, 0x8c, 0x8e, 0xa3, 0xc4, 0xd3, 0xe9, 0xfe, 0xff, 0x01, 0xf1, 0xf1, 0xf2, 0x23, 0x23, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x23, 0x26, 0x2f, 0x9d, 0x9b, 0x97, 0x9f, 0x9c, 0x9f, 0x97, 0x9c, 0x9c, 0x9c, 0x93, 0x10, 0x14, 0x13, 0x14, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9c, 0x91, 0x1b, 0x26, 0x26, 0xfa, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfd, 0x23, 0x29, 0x18, 0x93, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x91, 0x13, 0x13, 0x12, 0x12, 0x14, 0xaa, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x91, 0x25, 0x29, 0x23, 0x26, 0x23, 0x25, 0x26, 0x25, 0x25, 0x26, 0x24, 0x1b, 0xee, 0xf2, 0xfa, 0xff, 0xfa, 0xda, 0xc5, 0x98, 0x8c, 0x8e, 0x8e, 0xba, 0xd3, 0xe5, 0x34, 0xb5, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x95, 0x95, 0x8e, 0x91, 0xc4, 0xe2, 0xff, 0xff, 0x3b, 0x2a, 0x1d, 0x21, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x31, 0xb8, 0x93, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x97, 0xa1, 0x14, 0x12, 0x12, 0x13, 0x13, 0x97, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x97, 0x9c, 0x9c, 0x93, 0x19, 0x26, 0x25, 0xfa, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xfa, 0x23, 0x2b, 0x17, 0x91, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x97, 0x97, 0x0e, 0x12, 0x13, 0x12, 0x12, 0x13, 0x0a, 0x93, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x97, 0x97, 0x2f, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x21, 0x1e, 0x2e, 0xed, 0xff, 0xff, 0xd9, 0xb5, 0x8c, 0x95, 0x95, 0x9b, 0x9f, 0x9f, 0x9f, 0x95, 0x95, 0x93, 0x8f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9b, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x95, 0x91, 0x8f, 0xc9, 0xea, 0xfe, 0xfa, 0x35, 0x1f, 0x24, 0x25, 0x25, 0x26, 0x25, 0x2c, 0x16, 0x91, 0x9f, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x93, 0xad, 0x14, 0x12, 0x13, 0x13, 0x11, 0x13, 0x91, 0x9c, 0x97, 0x9f, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x93, 0x18, 0x26, 0x21, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfd, 0x21, 0x29, 0x16, 0x93, 0x9c, 0x9c, 0x9c, 0x97, 0x97, 0x9c, 0x9c, 0x9c, 0x97, 0xad, 0x14, 0x12, 0x13, 0x11, 0x12, 0x13, 0x10, 0x93, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x93, 0xbc, 0x2f, 0x23, 0x25, 0x25, 0x23, 0x1d, 0x33, 0x01, 0xfe, 0xe9, 0xc4, 0x8c, 0x93, 0x9b, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0x8e, 0xb1, 0xde, 0xff, 0xfe, 0x35, 0x1f, 0x24, 0x25, 0x29, 0x1e, 0x8e, 0x9f, 0x97, 0x9f, 0x9c, 0x9b, 0x9f, 0x9c, 0x97, 0x07, 0x14, 0x13, 0x13, 0x10, 0x12, 0x13, 0x0e, 0x97, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x91, 0x17, 0x29, 0x1f, 0xfe, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xfd, 0x1d, 0x28, 0x15, 0x93, 0x9c, 0x97, 0x97, 0x9c, 0x9c, 0x97, 0x9c, 0x97, 0x9c, 0xa1, 0x14, 0x12, 0x13, 0x12, 0x12, 0x12, 0x13, 0x12, 0x97, 0x9b, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x91, 0x1b, 0x26, 0x24, 0x1d, 0x30, 0x01, 0xff, 0xe3, 0xb5, 0x8e, 0x93, 0x9c, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x97, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x97, 0xa2, 0x97, 0x91, 0x98, 0xdc, 0xff, 0xfa, 0x35, 0x1e, 0x2b, 0x93, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x97, 0xad, 0x14, 0x10, 0x13, 0x12, 0x13, 0x12, 0x13, 0xad, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x95, 0xc3, 0x2b, 0x1d, 0xfd, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xfd, 0x21, 0x29, 0xc3, 0x93, 0x9f, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x91, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x93, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9b, 0x9c, 0x29, 0x28, 0xf0, 0xff, 0xe6, 0xb1, 0x8e, 0x9b, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9b, 0x9f, 0x8f, 0xa3, 0xe5, 0xfe, 0xfd, 0xb1, 0x91, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x97, 0xad, 0x14, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x14, 0x9c, 0x97, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x93, 0x15, 0x29, 0x1f, 0xfe, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xfd, 0x21, 0x28, 0xc2, 0x93, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9f, 0x9c, 0x9f, 0x97, 0x0a, 0x13, 0x13, 0x12, 0x12, 0x13, 0x13, 0x12, 0x12, 0x10, 0x93, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x93, 0x8e, 0xe0, 0xfe, 0x01, 0xc1, 0x8e, 0x9b, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9b, 0x8e, 0xbe, 0x01, 0xff, 0xda, 0x8f, 0x96, 0x9c, 0x9c, 0x9f, 0x9f, 0xa2, 0x14, 0x13, 0x12, 0x12, 0x13, 0x13, 0x12, 0x13, 0x0e, 0x93, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x93, 0xc2, 0x28, 0x1f, 0xfd, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfd, 0x1f, 0x2b, 0xc2, 0x93, 0x9c, 0x9f, 0x97, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x97, 0x14, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x14, 0x07, 0x97, 0x9c, 0x9f, 0x9b, 0x91, 0xb1, 0x01, 0xfe, 0xd9, 0x8e, 0x95, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x95, 0x8e, 0xd9, 0xfe, 0x00, 0xa3, 0x93, 0x9c, 0x97, 0x9f, 0x14, 0x13, 0x10, 0x12, 0x12, 0x13, 0x12, 0x13, 0x14, 0x9f, 0x9c, 0x97, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x97, 0x9f, 0x9c, 0x93, 0x15, 0x29, 0x1f, 0xfe, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xfa, 0x25, 0x28, 0x15, 0x97, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x97, 0x0a, 0x13, 0x12, 0x13, 0x13, 0x13, 0x13, 0x12, 0x13, 0x14, 0xa4, 0x9f, 0x97, 0x8e, 0xd2, 0xff, 0xf1, 0xb1, 0x8f, 0x9b, 0x9c, 0xa2, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x91, 0xb1, 0xfd, 0xff, 0xc5, 0x8f, 0x95, 0x13, 0x13, 0x12, 0x13, 0x13, 0x12, 0x12, 0x12, 0x13, 0x0e, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x97, 0x9c, 0x95, 0xc3, 0x2b, 0x1f, 0xfa, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xfa, 0x23, 0x28, 0x16, 0x93, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x97, 0x9c, 0x9c, 0x9f, 0x93, 0x14, 0x12, 0x12, 0x12, 0x13, 0x12, 0x13, 0x12, 0x14, 0x14, 0x93, 0x8e, 0x37, 0xfe, 0xe0, 0x8c, 0x9b, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x96, 0x8f, 0x37, 0xfe, 0xd3, 0x02, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x14, 0x9c, 0x9b, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x93, 0x16, 0x29, 0x20, 0xfe, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xfa, 0x29, 0x29, 0x17, 0x93, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x97, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0xa1, 0x14, 0x13, 0x13, 0x12, 0x12, 0x13, 0x13, 0x13, 0x11, 0x0e, 0x00, 0xfe, 0xc7, 0x8e, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x97, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x8e, 0xd9, 0xfe, 0x33, 0x07, 0x12, 0x13, 0x13, 0x13, 0x13, 0x12, 0x13, 0x07, 0x97, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x93, 0x17, 0x29, 0x26, 0xfd, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x01, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0x01, 0xfa, 0x28, 0x29, 0x18, 0x91, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x97, 0x0a, 0x13, 0x13, 0x12, 0x12, 0x13, 0x13, 0x0d, 0x17, 0xff, 0xfd, 0xa3, 0x95, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x97, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x8e, 0xca, 0xfe, 0x36, 0x09, 0x13, 0x12, 0x12, 0x12, 0x13, 0x12, 0x93, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x93, 0x18, 0x26, 0x2c, 0xfd, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0x01, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xfd, 0x2c, 0x25, 0x1b, 0x93, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x93, 0x0e, 0x13, 0x13, 0x12, 0x13, 0x0c, 0x19, 0xfe, 0xeb, 0x8f, 0x9b, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xc1, 0xfe, 0x38, 0x09, 0x13, 0x13, 0x13, 0x14, 0x9b, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x93, 0x19, 0x29, 0x31, 0xfd, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xfd, 0x30, 0x23, 0x1f, 0x91, 0x9f, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x97, 0x0e, 0x14, 0x14, 0x0a, 0x1d, 0xff, 0x34, 0x8e, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x91, 0xc1, 0xfe, 0x37, 0x09, 0x12, 0x13, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x91, 0x1d, 0x25, 0x33, 0xfd, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xfd, 0x33, 0x25, 0x29, 0x8f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x97, 0x07, 0x0f, 0x1a, 0xff, 0xe2, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x91, 0xc4, 0xfe, 0x35, 0x05, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x91, 0x29, 0x23, 0x36, 0xfa, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xfa, 0x39, 0x21, 0x32, 0x8f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x93, 0xc1, 0xfe, 0xe2, 0x8e, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x97, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x91, 0xcd, 0xff, 0xcf, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x91, 0x2f, 0x21, 0x3a, 0xfa, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0x3b, 0x1e, 0x2c, 0xa3, 0x9b, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x95, 0xb1, 0xfe, 0x37, 0x8c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x8e, 0xd9, 0xfe, 0xc1, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9b, 0xa4, 0x2f, 0x1e, 0xed, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0x1d, 0x2c, 0xbc, 0x97, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x96, 0x9d, 0xff, 0xec, 0x8e, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0xa2, 0x8c, 0x39, 0xfe, 0xa3, 0x96, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x93, 0xbf, 0x2b, 0x1d, 0x01, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0x01, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xfe, 0x1f, 0x28, 0x16, 0x95, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x8f, 0x00, 0xff, 0x91, 0x9b, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x97, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x8f, 0xf1, 0x01, 0x8e, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x96, 0x16, 0x29, 0x1f, 0xfe, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xfd, 0x28, 0x26, 0x1a, 0x95, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x8f, 0xe2, 0xfe, 0xb1, 0x96, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9b, 0xa3, 0xff, 0xe2, 0x8e, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x93, 0x1b, 0x26, 0x2e, 0xfd, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfd, 0x33, 0x24, 0x2b, 0x91, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9b, 0x9f, 0x93, 0xc7, 0xfe, 0xcd, 0x91, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x93, 0xc7, 0xfe, 0xc7, 0x95, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0x8f, 0x2b, 0x24, 0x35, 0xfa, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0x3a, 0x21, 0x2e, 0xa4, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x97, 0xa1, 0x9b, 0x97, 0xff, 0x37, 0x8e, 0x9f, 0xa1, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x8e, 0xe2, 0xff, 0x97, 0x97, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa4, 0x2f, 0x1e, 0xeb, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0x01, 0x1d, 0x2b, 0xc2, 0x97, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xe9, 0xff, 0x8f, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x97, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xff, 0xe8, 0x8f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xc2, 0x29, 0x1f, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xfd, 0x26, 0x26, 0x19, 0x95, 0x9f, 0x9c, 0xa2, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x93, 0xca, 0xfe, 0xc4, 0x95, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x95, 0xbe, 0xff, 0xc9, 0x95, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x95, 0x19, 0x29, 0x2c, 0xfd, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xfa, 0x35, 0x24, 0x2b, 0x91, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x97, 0xff, 0xe6, 0x8e, 0x9f, 0x9c, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x8f, 0x34, 0xff, 0x93, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x8e, 0x2f, 0x24, 0x38, 0xfa, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0x01, 0xee, 0x1e, 0x2c, 0xaf, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xe2, 0xfe, 0x98, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0xa2, 0x9b, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x97, 0xfe, 0xdc, 0x91, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9b, 0xb8, 0x2b, 0x1d, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xfe, 0x20, 0x29, 0x17, 0x93, 0x9f, 0x9c, 0xa1, 0x9f, 0xa2, 0x93, 0xb5, 0xfe, 0xd7, 0x93, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9b, 0x96, 0x8f, 0x93, 0x97, 0x91, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0xa1, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x91, 0x91, 0x91, 0x91, 0x95, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x93, 0xd2, 0xfe, 0xa3, 0x97, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0x18, 0x26, 0x26, 0xfd, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xfa, 0x35, 0x24, 0x2f, 0x8f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xeb, 0xff, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0xa2, 0x95, 0x9c, 0xcd, 0x35, 0x3b, 0x3b, 0x2d, 0x97, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9b, 0x97, 0x27, 0x3c, 0x3b, 0xe0, 0xca, 0x93, 0x95, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x8f, 0xfd, 0xe5, 0x8f, 0x9f, 0x9f, 0x9c, 0x9f, 0x91, 0x2f, 0x1f, 0x38, 0xfa, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0x1d, 0x2b, 0xbc, 0x97, 0x9f, 0x9f, 0x9f, 0x96, 0xc1, 0xfe, 0xca, 0x95, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xc9, 0x3b, 0x34, 0xe2, 0x34, 0xe3, 0xe6, 0xce, 0x95, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9b, 0xca, 0x3a, 0xe3, 0x34, 0x34, 0x34, 0xe8, 0xc9, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x96, 0xc7, 0xfe, 0xb5, 0x9b, 0x9f, 0x9f, 0x9b, 0xbf, 0x2b, 0x1d, 0x01, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfd, 0x2e, 0x25, 0x1d, 0x91, 0x9f, 0x9f, 0x9f, 0x8e, 0x00, 0x01, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xd6, 0x37, 0x34, 0x37, 0x37, 0x27, 0xd2, 0xd6, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0xa1, 0xd6, 0xd7, 0xe0, 0x39, 0x34, 0x34, 0x39, 0xd6, 0x91, 0xa2, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x8f, 0xf1, 0x37, 0x91, 0x9c, 0x9f, 0x91, 0x1f, 0x23, 0x2e, 0xfd, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xed, 0x1e, 0x2f, 0xa3, 0x9f, 0x9f, 0x96, 0xc4, 0xfe, 0xc7, 0x95, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x96, 0xc3, 0x39, 0x39, 0x27, 0xba, 0x91, 0x91, 0x9a, 0x95, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x95, 0x93, 0x91, 0x93, 0xbe, 0x27, 0xe6, 0x39, 0xc5, 0x96, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x93, 0xc7, 0xff, 0xb1, 0x9b, 0x9f, 0xaf, 0x2f, 0x1d, 0xf0, 0xf4, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xfa, 0x28, 0x25, 0x1b, 0x93, 0x9f, 0x8f, 0xec, 0x01, 0x8c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xe5, 0x39, 0xb5, 0x91, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0x91, 0xba, 0x37, 0x39, 0x91, 0xa2, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x8e, 0xfe, 0xe3, 0x93, 0x8f, 0x1d, 0x25, 0x2c, 0xfd, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xed, 0x1d, 0x31, 0xaa, 0x9b, 0xbe, 0xfe, 0xca, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x93, 0xd2, 0x93, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x97, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9a, 0x91, 0xd7, 0x93, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x95, 0xcf, 0xfe, 0x9d, 0xaf, 0x2c, 0x1d, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xfa, 0x2c, 0x26, 0x23, 0x8c, 0xe6, 0xff, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x96, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x96, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9b, 0x8f, 0xfe, 0xd3, 0x1e, 0x24, 0x2e, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0x01, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0x01, 0x1d, 0x29, 0x19, 0xfe, 0xd2, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x93, 0xdc, 0xfa, 0x1e, 0x1e, 0x01, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xfa, 0x38, 0x1d, 0x39, 0xff, 0x98, 0x9b, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9b, 0xb5, 0xff, 0x29, 0x39, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xfe, 0x20, 0xfa, 0xde, 0x91, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8e, 0xf0, 0x3d, 0xfa, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfe, 0xb1, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x96, 0xcf, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xe8, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9b, 0x97, 0xff, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xff, 0xc1, 0x95, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0x96, 0x93, 0x8e, 0x8e, 0x91, 0x96, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x96, 0x95, 0x93, 0x91, 0x93, 0x96, 0x9b, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xe0, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0x00, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xa3, 0xd2, 0xe5, 0xee, 0xee, 0xe3, 0xcf, 0x97, 0x93, 0x9b, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0x8e, 0xbe, 0xda, 0xe3, 0xe6, 0xe2, 0xd2, 0xa9, 0x91, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xba, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xff, 0xca, 0x95, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0x97, 0xe0, 0xff, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xff, 0xd7, 0x91, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x91, 0xb5, 0xeb, 0xff, 0xf1, 0xf1, 0xef, 0xf0, 0xf2, 0xff, 0xe5, 0xa3, 0x95, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8e, 0xee, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xfe, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x95, 0xb1, 0xff, 0xf1, 0xf3, 0xfe, 0xfe, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xf4, 0xec, 0x8f, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xca, 0xfe, 0xf0, 0xec, 0xee, 0xeb, 0xee, 0xef, 0xef, 0xee, 0xf0, 0xff, 0xc4, 0x8f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9a, 0xc9, 0xff, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xfe, 0xd3, 0x95, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x97, 0xa9, 0xff, 0xf3, 0xfe, 0xcc, 0x82, 0x89, 0xe4, 0xfe, 0xec, 0xee, 0xef, 0xeb, 0xf1, 0x00, 0x8f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xc7, 0xff, 0xf3, 0xfe, 0xfe, 0xf3, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf4, 0xff, 0xc1, 0x95, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x8e, 0xfd, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xff, 0x8f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa2, 0x9f, 0x8f, 0xf1, 0xfe, 0xe9, 0x4b, 0xf6, 0x40, 0x40, 0xf5, 0xdb, 0xf3, 0xee, 0xef, 0xef, 0xee, 0xf2, 0xe0, 0x91, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9b, 0xa9, 0xff, 0xfe, 0xc6, 0x59, 0x5f, 0xdd, 0xf0, 0xf0, 0xec, 0xef, 0xf0, 0xe1, 0x9e, 0xfe, 0xff, 0x97, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9a, 0xcd, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xfe, 0xd2, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x96, 0xd2, 0xfe, 0xea, 0xf6, 0x43, 0x47, 0x47, 0x47, 0x40, 0x6e, 0xfe, 0xee, 0xef, 0xee, 0xee, 0xef, 0xff, 0xb5, 0x9b, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xed, 0xfe, 0xc8, 0xf5, 0x43, 0x40, 0xf6, 0xfe, 0xee, 0xee, 0xef, 0xed, 0xfe, 0x9e, 0x78, 0xfe, 0xe3, 0x91, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8e, 0xff, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xff, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xff, 0xfe, 0x4b, 0x43, 0x47, 0x40, 0x47, 0x47, 0x40, 0x6e, 0xfe, 0xed, 0xef, 0xee, 0xee, 0xee, 0xf1, 0xe5, 0x8f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xc4, 0xfd, 0xfe, 0x6e, 0x40, 0x47, 0x47, 0xf5, 0xf0, 0xf0, 0xee, 0xef, 0xef, 0xed, 0xfe, 0xf5, 0xc6, 0xfe, 0xa9, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9a, 0xc9, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xc5, 0x9a, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x96, 0xc5, 0xfe, 0xb6, 0xf7, 0x47, 0xf6, 0x94, 0xf5, 0xf6, 0xf5, 0xe4, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xff, 0x9d, 0xa2, 0x9c, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x8f, 0xe8, 0xf0, 0xf3, 0x9e, 0xf6, 0x40, 0xf7, 0x65, 0xfe, 0xec, 0xee, 0xee, 0xef, 0xee, 0xfe, 0x8b, 0xf5, 0xfe, 0xd3, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x8e, 0x00, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xfa, 0xe6, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0xa1, 0x95, 0xda, 0xfe, 0x40, 0x43, 0x43, 0x76, 0xfe, 0xf4, 0xdd, 0xfe, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0xeb, 0xee, 0x01, 0xc9, 0x96, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x97, 0xff, 0xef, 0xef, 0xfe, 0xae, 0x76, 0x94, 0xff, 0xef, 0xee, 0xef, 0xec, 0xee, 0xee, 0xf3, 0xd1, 0xf6, 0xc6, 0xed, 0x8f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xb1, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xff, 0x91, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xe8, 0xdd, 0xf6, 0x47, 0xf7, 0xd1, 0xf3, 0xf0, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xec, 0xf1, 0xd9, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xbe, 0xfd, 0xee, 0xee, 0xef, 0xf3, 0xfe, 0xf4, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xf0, 0xe4, 0xf5, 0x76, 0xfe, 0x8c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xd7, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xfe, 0xbe, 0x96, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x8f, 0xf0, 0xbd, 0xf7, 0x47, 0xf6, 0xee, 0xf0, 0xee, 0xec, 0xee, 0xec, 0xee, 0xec, 0xee, 0xee, 0xef, 0xed, 0xef, 0xf0, 0xde, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x96, 0xc9, 0xfa, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xed, 0xf0, 0xe4, 0xf6, 0x47, 0xfe, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xe8, 0xfd, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xfe, 0xcd, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0xa1, 0x9f, 0x9f, 0x91, 0xf0, 0x89, 0x40, 0x47, 0xf6, 0xfe, 0xee, 0xef, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xef, 0xee, 0xec, 0xee, 0xf0, 0xe2, 0x93, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9c, 0xa1, 0x9f, 0xa2, 0x9c, 0xa2, 0x9c, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa1, 0x9f, 0x95, 0xca, 0xf2, 0xee, 0xee, 0xec, 0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xef, 0xef, 0xed, 0xec, 0xf3, 0xdb, 0xf6, 0xf5, 0xfe, 0x8e, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x8f, 0x01, 0xfa, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xfe, 0xd2, 0x8f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x95, 0x34, 0x89, 0x40, 0x47, 0xf6, 0xfe, 0xef, 0xee, 0xef, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf1, 0xda, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xc5, 0xfa, 0xeb, 0xef, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xee, 0xeb, 0xee, 0xec, 0xee, 0xee, 0xf3, 0xb6, 0xf7, 0xf5, 0xfe, 0x91, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0x91, 0xfd, 0xfa, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xfa, 0xfe, 0xc7, 0x8f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x95, 0x1a, 0x9e, 0x40, 0x47, 0xf6, 0xe4, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xed, 0xec, 0xee, 0xee, 0xec, 0xf1, 0xce, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa1, 0x9c, 0xa2, 0x9c, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x97, 0xb5, 0xfd, 0xee, 0xed, 0xef, 0xeb, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfe, 0x5f, 0x43, 0x4b, 0x38, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0x91, 0xeb, 0xfe, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xfe, 0x00, 0xa9, 0x93, 0xa2, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa2, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xfc, 0xf7, 0x47, 0xf7, 0xbd, 0xf3, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xff, 0xa9, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa2, 0x9f, 0x9f, 0x9f, 0xa1, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x91, 0xff, 0xec, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xef, 0xee, 0xec, 0xf0, 0xe7, 0xf6, 0x43, 0x76, 0x18, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8e, 0xd3, 0xfe, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0x01, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xfe, 0xca, 0x8f, 0x9b, 0xa2, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x95, 0xe0, 0xf5, 0x47, 0x43, 0x57, 0xfe, 0xee, 0xee, 0xee, 0xeb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xe9, 0x91, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xa2, 0xa8, 0xa5, 0xab, 0xa8, 0xa5, 0xa5, 0xa2, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xda, 0xf1, 0xee, 0xee, 0xef, 0xee, 0xec, 0xee, 0xee, 0xee, 0xef, 0xeb, 0xee, 0xfe, 0x76, 0x43, 0xf7, 0xae, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0x98, 0xe0, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xfe, 0x8c, 0x93, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x07, 0x76, 0x40, 0x47, 0xf6, 0xcc, 0xfe, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xfe, 0xba, 0x9b, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0xab, 0xb4, 0x90, 0x7f, 0x75, 0x73, 0x6c, 0x73, 0x75, 0x7f, 0x8d, 0xb4, 0xab, 0xa5, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x97, 0xff, 0xef, 0xef, 0xee, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xf3, 0xd5, 0xf6, 0x47, 0xf5, 0xc7, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0x8e, 0xff, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xfd, 0xb1, 0x91, 0x9b, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0xa2, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0x9b, 0xb7, 0xf6, 0x47, 0x47, 0xf6, 0xef, 0xf3, 0xec, 0xed, 0xec, 0xee, 0xef, 0xec, 0xee, 0xfe, 0xd7, 0x8f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xb0, 0x98, 0x72, 0x4c, 0x4a, 0x4f, 0x4f, 0x4d, 0x4d, 0x48, 0x4f, 0x4f, 0x4c, 0x45, 0x63, 0x81, 0xb9, 0xa5, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xbe, 0xfe, 0xef, 0xed, 0xec, 0xef, 0xee, 0xec, 0xee, 0xef, 0xf3, 0xec, 0xf6, 0x43, 0x40, 0x79, 0xa8, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0x8f, 0xc1, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xfa, 0xfe, 0xde, 0x98, 0x8f, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa8, 0x7c, 0xf5, 0x47, 0x43, 0xf7, 0xe4, 0xfe, 0xf3, 0xee, 0xef, 0xec, 0xf3, 0xfe, 0xd3, 0x8f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0xb0, 0x9d, 0x63, 0x45, 0x52, 0x4f, 0x4d, 0x3e, 0x4e, 0x69, 0x7d, 0x74, 0x5d, 0xf8, 0x48, 0x4d, 0x53, 0x4a, 0x51, 0x86, 0xb0, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x93, 0xbe, 0xff, 0xf3, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfe, 0xe4, 0xf7, 0x43, 0x40, 0x58, 0xb9, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0xa2, 0xa2, 0xa5, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0x8e, 0xa9, 0xe5, 0xfe, 0x01, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xfa, 0xfe, 0xe2, 0xbe, 0x91, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xa2, 0xab, 0xb0, 0xb9, 0xa4, 0x98, 0x90, 0x90, 0x90, 0xa1, 0xb4, 0xb9, 0xb0, 0xa5, 0xa2, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0xb4, 0x86, 0xf7, 0x40, 0x43, 0xf5, 0x80, 0xe4, 0xfe, 0xfe, 0xfe, 0xfb, 0x8a, 0x9a, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0xb9, 0x75, 0x42, 0x52, 0x55, 0x48, 0x4f, 0xb6, 0xef, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xcc, 0x65, 0x42, 0x53, 0x52, 0x46, 0x67, 0xb0, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0x98, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xf4, 0x8b, 0xf5, 0x43, 0xf6, 0x6d, 0xbb, 0xa2, 0xa2, 0xa1, 0x9f, 0x9f, 0xa2, 0xa5, 0xab, 0xb9, 0xb4, 0xa2, 0x90, 0x90, 0x8d, 0x98, 0xa5, 0xb4, 0xb0, 0xab, 0xa2, 0xa2, 0x9f, 0x9f, 0x9f, 0x93, 0x93, 0xc7, 0xe8, 0xfe, 0xfa, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfa, 0xfe, 0xff, 0xfe, 0xff, 0xe5, 0xa3, 0xa2, 0xa5, 0xb0, 0xb4, 0x8d, 0x77, 0x5e, 0x4c, 0x45, 0x4a, 0x45, 0x4a, 0x46, 0x45, 0x4a, 0x58, 0x68, 0x7f, 0x90, 0xb9, 0xa5, 0xa2, 0x9f, 0x9f, 0x9f, 0xa5, 0xb4, 0x75, 0x43, 0xf5, 0xf6, 0xf5, 0xf5, 0xf7, 0x50, 0x83, 0xa8, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa5, 0xa4, 0x5a, 0x4c, 0x55, 0x53, 0x41, 0x94, 0xfe, 0xf4, 0xe6, 0xe2, 0xe0, 0xde, 0xde, 0xe2, 0xe5, 0xf3, 0xfe, 0xc6, 0x42, 0x54, 0x54, 0x4f, 0x58, 0xac, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0x91, 0x63, 0xf9, 0xf9, 0x57, 0xf5, 0xf5, 0xf7, 0x5e, 0x98, 0xb0, 0xa2, 0x9f, 0x9f, 0xa2, 0xa5, 0xb9, 0x9d, 0x7f, 0x6a, 0x58, 0x4a, 0x46, 0x4a, 0x4a, 0x4a, 0x4a, 0x44, 0x4e, 0x5e, 0x77, 0x8d, 0xb4, 0xb0, 0xa5, 0x9a, 0xc1, 0xe3, 0x00, 0xfa, 0xfe, 0xfe, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xfa, 0xd9, 0xc1, 0xaf, 0x9a, 0x95, 0xa8, 0xb0, 0x8d, 0x77, 0x5e, 0x46, 0x4a, 0x4e, 0x52, 0x52, 0x54, 0x54, 0x54, 0x54, 0x55, 0x54, 0x52, 0x52, 0x4f, 0x4f, 0x4a, 0x51, 0x6f, 0x8d, 0xb9, 0xab, 0xa2, 0x9f, 0x9f, 0xab, 0xb9, 0x9d, 0x86, 0x84, 0x90, 0xb4, 0xab, 0xa5, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa5, 0x9d, 0x4a, 0x52, 0x52, 0x54, 0x42, 0xbd, 0xfe, 0xeb, 0xdc, 0xdc, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xda, 0xed, 0xfe, 0xcc, 0x42, 0x53, 0x52, 0x4f, 0x51, 0xb0, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0xa2, 0xa8, 0x05, 0x8d, 0x7f, 0x81, 0x90, 0xb4, 0xb0, 0xa5, 0x9f, 0x9f, 0xa5, 0xb9, 0x98, 0x77, 0x54, 0x45, 0x4e, 0x4f, 0x54, 0x54, 0x55, 0x52, 0x54, 0x52, 0x54, 0x52, 0x53, 0x52, 0x4f, 0x4a, 0x4a, 0x5e, 0x77, 0x8d, 0xab, 0xa7, 0x9a, 0x95, 0x9c, 0xb1, 0xdc, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xfa, 0xcf, 0x85, 0x83, 0x7a, 0x68, 0x55, 0x45, 0x4a, 0x4f, 0x52, 0x52, 0x54, 0x53, 0x54, 0x54, 0x52, 0x53, 0x52, 0x54, 0x52, 0x52, 0x55, 0x54, 0x54, 0x52, 0x54, 0x53, 0x4f, 0x4a, 0x51, 0x77, 0xa1, 0xb0, 0xa5, 0x9f, 0x9f, 0xa2, 0xa5, 0xa5, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0xa2, 0xa2, 0xa1, 0x45, 0x54, 0x54, 0x53, 0x4f, 0x60, 0xfe, 0xed, 0xeb, 0xda, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdc, 0xdc, 0xef, 0xee, 0xfe, 0x60, 0x4f, 0x54, 0x54, 0x4f, 0x58, 0xb9, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0xa5, 0xa5, 0xa5, 0xa2, 0x9f, 0x9f, 0x9f, 0xab, 0xb0, 0x81, 0x5a, 0x45, 0x4f, 0x52, 0x54, 0x54, 0x52, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x55, 0x52, 0x54, 0x54, 0x53, 0x52, 0x4f, 0x4a, 0x46, 0x58, 0x67, 0x77, 0x81, 0x7e, 0xe0, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xfe, 0x57, 0x46, 0x4d, 0x52, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x53, 0x55, 0x55, 0x54, 0x54, 0x54, 0x54, 0x52, 0x53, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x4f, 0x44, 0x63, 0x86, 0xbb, 0xab, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa1, 0x9c, 0xa2, 0xab, 0xa4, 0x4c, 0x52, 0x55, 0x52, 0x55, 0x4d, 0x8b, 0xfe, 0xef, 0xee, 0xeb, 0xdf, 0xdc, 0xda, 0xdc, 0xda, 0xde, 0xe3, 0xf0, 0xef, 0xed, 0xfe, 0x82, 0x4d, 0x54, 0x54, 0x53, 0x4f, 0x62, 0xbb, 0xa2, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa5, 0xb9, 0x98, 0x72, 0x45, 0x4c, 0x52, 0x52, 0x54, 0x52, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x52, 0x52, 0x52, 0x52, 0x54, 0x54, 0x52, 0x54, 0x53, 0x54, 0x54, 0x54, 0x52, 0x4f, 0x4f, 0x41, 0x80, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xfa, 0x41, 0x54, 0x55, 0x53, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x53, 0x52, 0x53, 0x54, 0x54, 0x54, 0x54, 0x52, 0x55, 0x54, 0x54, 0x54, 0x52, 0x53, 0x52, 0x4c, 0x49, 0x72, 0x8d, 0xb9, 0xab, 0xab, 0xa5, 0xaa, 0xa2, 0xa5, 0xac, 0xab, 0xb9, 0xa1, 0x77, 0x44, 0x52, 0x54, 0x52, 0x55, 0x52, 0x4f, 0x69, 0xfe, 0xed, 0xec, 0xed, 0xf0, 0xf1, 0xef, 0xef, 0xf1, 0xef, 0xf0, 0xed, 0xeb, 0xee, 0xfe, 0x56, 0x53, 0x54, 0x53, 0x54, 0x55, 0x4d, 0x58, 0x8d, 0xb9, 0xb0, 0xa5, 0xa5, 0xa2, 0xa2, 0xa2, 0xa5, 0xab, 0xb9, 0x9d, 0x7a, 0x5a, 0x44, 0x4f, 0x54, 0x54, 0x54, 0x55, 0x54, 0x54, 0x55, 0x52, 0x54, 0x53, 0x52, 0x54, 0x52, 0x54, 0x54, 0x53, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x53, 0x52, 0x54, 0x4f, 0x56, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xfe, 0xd8, 0x3e, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x53, 0x52, 0x55, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x4a, 0x4c, 0x66, 0x77, 0x7f, 0x83, 0x86, 0x81, 0x7a, 0x6f, 0x5a, 0x45, 0x4f, 0x54, 0x53, 0x54, 0x53, 0x54, 0x54, 0x53, 0x41, 0xdb, 0xf4, 0xed, 0xec, 0xef, 0xeb, 0xee, 0xee, 0xee, 0xef, 0xeb, 0xef, 0xed, 0xfe, 0xbd, 0x46, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x4a, 0x4e, 0x68, 0x7a, 0x81, 0x83, 0x86, 0x81, 0x7a, 0x6d, 0x58, 0x46, 0x4f, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x52, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x41, 0xfa, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xfe, 0xae, 0x41, 0x54, 0x55, 0x52, 0x54, 0x54, 0x52, 0x55, 0x52, 0x54, 0x52, 0x54, 0x52, 0x55, 0x52, 0x55, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x4c, 0x4c, 0x4a, 0x4c, 0x4c, 0x4f, 0x52, 0x52, 0x54, 0x53, 0x52, 0x54, 0x54, 0x54, 0x52, 0x53, 0x54, 0x53, 0x42, 0xe7, 0xfe, 0xed, 0xee, 0xee, 0xee, 0xeb, 0xee, 0xeb, 0xee, 0xee, 0xfe, 0xd4, 0x3f, 0x53, 0x54, 0x55, 0x54, 0x55, 0x53, 0x54, 0x52, 0x55, 0x52, 0x4f, 0x4f, 0x4c, 0x4e, 0x4c, 0x4c, 0x4c, 0x52, 0x52, 0x54, 0x54, 0x53, 0x54, 0x54, 0x52, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x52, 0x55, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x55, 0x52, 0x54, 0x53, 0xf8, 0xe1, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xfe, 0x82, 0x46, 0x53, 0x54, 0x53, 0x52, 0x55, 0x53, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x55, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x52, 0x54, 0x54, 0x53, 0x55, 0x52, 0x54, 0x54, 0x52, 0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x55, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x53, 0x52, 0x3f, 0xcc, 0xfe, 0xf0, 0xeb, 0xee, 0xef, 0xed, 0xef, 0xf3, 0xfe, 0x94, 0x3e, 0x54, 0x54, 0x54, 0x52, 0x53, 0x54, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x53, 0x52, 0x55, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x53, 0x54, 0x53, 0x3e, 0xcc, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xfe, 0x7b, 0x52, 0x53, 0x54, 0x54, 0x52, 0x55, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x53, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x53, 0x54, 0x54, 0x4d, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x53, 0x41, 0x69, 0xe4, 0xfe, 0xf0, 0xed, 0xf4, 0xfe, 0xc6, 0x4c, 0x48, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x53, 0x54, 0x54, 0x55, 0x52, 0x54, 0x52, 0x54, 0x53, 0x54, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x54, 0x53, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x52, 0x54, 0x52, 0x54, 0x53, 0x54, 0x52, 0x52, 0x54, 0x54, 0x54, 0x52, 0x55, 0x52, 0x54, 0x54, 0x4f, 0x4d, 0xc0, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0x01, 0xfe, 0x7b, 0x61, 0x4f, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x53, 0x54, 0x52, 0x55, 0x52, 0x55, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4f, 0x7d, 0x4f, 0x52, 0x54, 0x54, 0x54, 0x53, 0x54, 0x53, 0x4f, 0x3e, 0x5d, 0xe4, 0xfe, 0xb6, 0x3f, 0x48, 0x53, 0x54, 0x55, 0x52, 0x54, 0x54, 0x53, 0x52, 0x60, 0x5d, 0x52, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x55, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x52, 0x52, 0x5b, 0xa6, 0xfe, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf4, 0xfe, 0x79, 0x6a, 0x55, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x55, 0x52, 0x55, 0x52, 0x54, 0x52, 0x54, 0x52, 0x53, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x52, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x3e, 0xfe, 0xdb, 0x41, 0x55, 0x54, 0x54, 0x54, 0x54, 0x55, 0x54, 0x54, 0x42, 0xd0, 0xfe, 0x69, 0x4d, 0x52, 0x54, 0x52, 0x53, 0x54, 0x54, 0x54, 0x53, 0x41, 0xfe, 0xdd, 0x46, 0x53, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x52, 0x54, 0x53, 0x54, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4f, 0x55, 0x64, 0x92, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf4, 0xfe, 0xfe, 0xfe, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0x01, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xfe, 0x79, 0x67, 0x5e, 0x4f, 0x54, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x53, 0x54, 0x52, 0x55, 0x52, 0x54, 0x54, 0x52, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x55, 0x54, 0x52, 0x53, 0x54, 0x42, 0xd8, 0xfe, 0x56, 0x4f, 0x54, 0x53, 0x54, 0x53, 0x52, 0x54, 0x54, 0x46, 0xd1, 0xfe, 0x74, 0x4f, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x54, 0x41, 0xc6, 0xfe, 0xb6, 0x4d, 0x54, 0x55, 0x52, 0x55, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x55, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x53, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x53, 0x4f, 0x62, 0x64, 0x87, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xfe, 0xfe, 0xfe, 0xfe, 0xf1, 0xdd, 0xd5, 0xd5, 0xdb, 0xea, 0xfe, 0xfe, 0xfe, 0xfe, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0x01, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf4, 0xfe, 0x7b, 0x64, 0x6b, 0x4f, 0x52, 0x52, 0x55, 0x52, 0x54, 0x54, 0x53, 0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x55, 0x52, 0x54, 0x4d, 0x7d, 0xfe, 0xe4, 0xf8, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0xf8, 0xe1, 0xfe, 0x82, 0x46, 0x53, 0x52, 0x52, 0x54, 0x52, 0x54, 0x48, 0x74, 0xfe, 0xfe, 0x51, 0x52, 0x53, 0x54, 0x53, 0x55, 0x53, 0x54, 0x54, 0x52, 0x54, 0x54, 0x53, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x53, 0x54, 0x54, 0x55, 0x54, 0x52, 0x52, 0x52, 0x68, 0x61, 0x92, 0xfe, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xfe, 0xfe, 0xc6, 0x82, 0x59, 0x41, 0xf8, 0x3f, 0x42, 0x42, 0x3f, 0xf8, 0x3f, 0x51, 0x7d, 0xd1, 0xfe, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xfe, 0x87, 0x64, 0x6d, 0x5c, 0x4f, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x52, 0x55, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x55, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x53, 0x54, 0x54, 0x3e, 0xe1, 0xfe, 0xd4, 0xf8, 0x4d, 0x52, 0x53, 0x53, 0x4d, 0xf8, 0x99, 0xfe, 0xf3, 0xfe, 0x7d, 0x3e, 0x4d, 0x52, 0x53, 0x4f, 0x3e, 0x74, 0xfe, 0xfe, 0x99, 0x48, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x52, 0x54, 0x54, 0x53, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x4f, 0x5a, 0x71, 0x5b, 0xb2, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xfe, 0xfe, 0xc6, 0x69, 0xf8, 0x45, 0x48, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x4f, 0x4f, 0x48, 0xf6, 0xe4, 0xf4, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xb2, 0x5b, 0x71, 0x68, 0x4f, 0x52, 0x53, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x52, 0x53, 0x42, 0xec, 0xfe, 0xea, 0x82, 0x42, 0xf8, 0x45, 0x7d, 0xe4, 0xfe, 0xfe, 0xbd, 0xfe, 0xfe, 0xdd, 0x7d, 0x56, 0x56, 0x74, 0xd0, 0xfe, 0xfe, 0xbd, 0x41, 0x52, 0x54, 0x54, 0x53, 0x54, 0x54, 0x55, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x55, 0x52, 0x54, 0x55, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x53, 0x54, 0x52, 0x52, 0x66, 0x71, 0x5b, 0xcb, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xfe, 0x99, 0xf8, 0x42, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x3f, 0xae, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xfe, 0xd4, 0x5b, 0x6a, 0x6d, 0x5c, 0x4f, 0x52, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x52, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x53, 0x41, 0xd1, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xe1, 0x56, 0x3e, 0x7d, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x82, 0x42, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x55, 0x52, 0x54, 0x52, 0x54, 0x54, 0x53, 0x52, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x52, 0x54, 0x52, 0x55, 0x52, 0x54, 0x54, 0x54, 0x52, 0x4f, 0x5c, 0x71, 0x6f, 0x5b, 0xe4, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xfe, 0x94, 0xf8, 0x46, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x48, 0x7d, 0xfe, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xfe, 0xea, 0x66, 0x64, 0x71, 0x68, 0x54, 0x4f, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x53, 0x52, 0x42, 0x5d, 0xbd, 0xdd, 0xef, 0xe4, 0xc6, 0x74, 0x41, 0x52, 0x53, 0x4d, 0x41, 0x8b, 0xd0, 0xe7, 0xe7, 0xd4, 0x8b, 0x42, 0x48, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x52, 0x52, 0x54, 0x54, 0x52, 0x53, 0x4f, 0x55, 0x68, 0x71, 0x61, 0x70, 0xff, 0xfe, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xfe, 0xcc, 0x42, 0x46, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x4c, 0xfe, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfa, 0xfe, 0x87, 0x61, 0x6d, 0x71, 0x63, 0x4f, 0x52, 0x52, 0x54, 0x54, 0x52, 0x54, 0x53, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x53, 0x54, 0x54, 0x52, 0x52, 0x52, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x53, 0x4f, 0x48, 0x42, 0x3e, 0x41, 0x48, 0x4f, 0x53, 0x54, 0x54, 0x54, 0x53, 0x4d, 0x46, 0x3e, 0x41, 0x46, 0x4d, 0x53, 0x55, 0x53, 0x52, 0x55, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x53, 0x54, 0x53, 0x52, 0x54, 0x54, 0x52, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x52, 0x52, 0x66, 0x71, 0x6d, 0x5b, 0xa6, 0xfe, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xfe, 0x74, 0x3f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x3f, 0xd5, 0xfe, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xd4, 0x5b, 0x67, 0x71, 0x6d, 0x5c, 0x4f, 0x52, 0x52, 0x54, 0x54, 0x54, 0x52, 0x53, 0x54, 0x52, 0x53, 0x52, 0x54, 0x54, 0x54, 0x52, 0x52, 0x53, 0x54, 0x54, 0x52, 0x54, 0x54, 0x55, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x53, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x52, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x55, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x53, 0x52, 0x52, 0x4f, 0x62, 0x71, 0x6d, 0x67, 0x61, 0xe1, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xe7, 0x45, 0x48, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x5d, 0xfe, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xfe, 0x87, 0x5b, 0x6a, 0x71, 0x6d, 0x5c, 0x4f, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x53, 0x55, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x55, 0x52, 0x54, 0x52, 0x54, 0x54, 0x53, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x55, 0x52, 0x54, 0x54, 0x55, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x52, 0x55, 0x54, 0x52, 0x52, 0x53, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x53, 0x54, 0x54, 0x52, 0x4f, 0x5c, 0x71, 0x6d, 0x6a, 0x5b, 0x92, 0xfe, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xd1, 0xf8, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x54, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x42, 0xcc, 0xfe, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf4, 0xfe, 0xe1, 0x6c, 0x61, 0x6a, 0x71, 0x6d, 0x5c, 0x4f, 0x52, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x53, 0x54, 0x54, 0x52, 0x53, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x53, 0x54, 0x52, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x55, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x52, 0x52, 0x4d, 0x5e, 0x71, 0x6d, 0x6d, 0x61, 0x70, 0xe4, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xbd, 0xf8, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x54, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x3f, 0xfe, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xfe, 0xcb, 0x63, 0x61, 0x6d, 0x6d, 0x71, 0x62, 0x52, 0x4f, 0x52, 0x53, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x53, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x53, 0x55, 0x53, 0x54, 0x54, 0x53, 0x54, 0x54, 0x53, 0x52, 0x54, 0x52, 0x4f, 0x54, 0x63, 0x71, 0x6d, 0x6a, 0x64, 0x61, 0xcb, 0xfe, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xae, 0xf8, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x48, 0x7d, 0xfe, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xfe, 0xc0, 0x61, 0x64, 0x6b, 0x6d, 0x71, 0x66, 0x5a, 0x4f, 0x52, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x55, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x55, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x53, 0x54, 0x52, 0x52, 0x54, 0x52, 0x54, 0x54, 0x53, 0x54, 0x55, 0x54, 0x54, 0x54, 0x53, 0x54, 0x54, 0x52, 0x54, 0x52, 0x52, 0x54, 0x53, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x55, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x52, 0x52, 0x4f, 0x5c, 0x68, 0x71, 0x6b, 0x6b, 0x61, 0x5b, 0xc0, 0xfe, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xc6, 0xf8, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x48, 0xbd, 0xfe, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xfe, 0xc0, 0x5b, 0x64, 0x67, 0x6d, 0x71, 0x6b, 0x62, 0x54, 0x4f, 0x52, 0x52, 0x55, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x53, 0x52, 0x54, 0x53, 0x54, 0x53, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x55, 0x52, 0x53, 0x52, 0x54, 0x54, 0x54, 0x55, 0x54, 0x53, 0x54, 0x54, 0x4f, 0x4f, 0x55, 0x63, 0x6d, 0x71, 0x6b, 0x6a, 0x61, 0x5b, 0xc0, 0xfe, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xfe, 0xdb, 0xf8, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x54, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x42, 0xd5, 0xfe, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xfe, 0xd0, 0x79, 0x5b, 0x64, 0x6a, 0x6d, 0x71, 0x6d, 0x62, 0x55, 0x4f, 0x4f, 0x52, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x53, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x53, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x53, 0x4f, 0x4f, 0x55, 0x63, 0x6b, 0x71, 0x6b, 0x6b, 0x64, 0x5b, 0x6c, 0xc8, 0xfe, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xfa, 0x3f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x3f, 0xea, 0xfa, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xfe, 0xe7, 0x92, 0x5b, 0x61, 0x67, 0x6b, 0x71, 0x71, 0x6d, 0x66, 0x5c, 0x55, 0x4f, 0x52, 0x53, 0x52, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x55, 0x52, 0x54, 0x52, 0x54, 0x52, 0x55, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x53, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x54, 0x5e, 0x63, 0x71, 0x71, 0x6d, 0x6d, 0x64, 0x61, 0x5b, 0x92, 0xe1, 0xfe, 0xfe, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xfe, 0x60, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x4f, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0xf8, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xfe, 0xfe, 0xd5, 0x87, 0x5b, 0x61, 0x64, 0x6b, 0x6a, 0x6d, 0x71, 0x6d, 0x66, 0x62, 0x5a, 0x52, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x53, 0x52, 0x55, 0x53, 0x55, 0x54, 0x54, 0x52, 0x53, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x5a, 0x5e, 0x66, 0x6d, 0x71, 0x6b, 0x6b, 0x68, 0x64, 0x61, 0x5b, 0x87, 0xcb, 0xfe, 0xfe, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xfe, 0xbd, 0x42, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x3f, 0x00, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xfe, 0xfe, 0xd8, 0x92, 0x66, 0x5b, 0x61, 0x64, 0x6b, 0x6d, 0x6b, 0x6f, 0x71, 0x6d, 0x68, 0x63, 0x5e, 0x5a, 0x55, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x54, 0x5a, 0x5e, 0x62, 0x66, 0x68, 0x6d, 0x6a, 0x6d, 0x6d, 0x6b, 0x67, 0x64, 0x5b, 0x63, 0x92, 0xd1, 0xfe, 0xfe, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xfe, 0xf8, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x54, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x3f, 0x00, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xfe, 0xfe, 0xe7, 0xc8, 0x87, 0x66, 0x5a, 0x64, 0x64, 0x67, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x71, 0x71, 0x68, 0x68, 0x66, 0x63, 0x63, 0x5e, 0x5e, 0x5c, 0x5e, 0x5c, 0x5c, 0x5e, 0x5c, 0x5e, 0x5e, 0x5e, 0x63, 0x63, 0x68, 0x68, 0x6d, 0x71, 0x71, 0x6d, 0x6a, 0x6b, 0x6d, 0x6b, 0x67, 0x64, 0x64, 0x5b, 0x61, 0x87, 0xc0, 0xe4, 0xfe, 0xfe, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0x8b, 0x48, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x41, 0xe4, 0xfa, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xca, 0xe3, 0xfe, 0xfe, 0xfe, 0xfe, 0xf0, 0xd0, 0xa6, 0x7b, 0x61, 0x61, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x6d, 0x6a, 0x6d, 0x6b, 0x6d, 0x68, 0x6b, 0x6b, 0x6b, 0x6b, 0x6d, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x68, 0x6b, 0x6b, 0x6b, 0x64, 0x5b, 0x79, 0xa6, 0xcb, 0xea, 0xfe, 0xfe, 0xfe, 0xfe, 0xe3, 0xce, 0xd9, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf4, 0xfe, 0xf8, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x46, 0xcc, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0x01, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xfe, 0xd7, 0xa0, 0xa0, 0x93, 0xad, 0x15, 0x1a, 0xcb, 0xd4, 0xd8, 0xdb, 0xdb, 0xb6, 0x73, 0x68, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x68, 0x6b, 0x68, 0x6b, 0x68, 0x6d, 0x68, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6d, 0x6b, 0x6b, 0x68, 0x70, 0xae, 0xdb, 0xdd, 0xd8, 0xd8, 0x27, 0xce, 0x15, 0xaf, 0x95, 0xa0, 0x04, 0x9b, 0xff, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xae, 0x48, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x48, 0x9e, 0xfe, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xfe, 0xb8, 0x03, 0xac, 0xb3, 0xac, 0x03, 0xa5, 0x5b, 0x61, 0x61, 0x61, 0x61, 0x64, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x68, 0x6b, 0x6b, 0x6b, 0x6b, 0x68, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x68, 0x6b, 0x6b, 0x6a, 0x68, 0x64, 0x61, 0x61, 0x61, 0x5b, 0xa0, 0x03, 0xac, 0x03, 0xac, 0xb3, 0xb3, 0xa0, 0xda, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0x56, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x54, 0x4d, 0x74, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfa, 0xef, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0x08, 0x84, 0x68, 0x6d, 0x6b, 0x68, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x68, 0x6d, 0x6b, 0x6b, 0x68, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x68, 0x6b, 0x6b, 0x68, 0x6b, 0x6b, 0x6b, 0x68, 0x6b, 0x6b, 0x6b, 0x84, 0x08, 0xac, 0xb3, 0xb3, 0xac, 0xac, 0x05, 0xad, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfa, 0xe7, 0xf8, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x54, 0x52, 0x52, 0x52, 0x3f, 0xfe, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xfe, 0xd2, 0xa0, 0xb3, 0xb3, 0xac, 0xb3, 0xbb, 0x58, 0x62, 0x66, 0x6b, 0x71, 0x71, 0x6d, 0x6d, 0x6d, 0x6b, 0x6b, 0x68, 0x68, 0x6b, 0x6b, 0x6b, 0x6b, 0x68, 0x68, 0x6b, 0x6d, 0x68, 0x6b, 0x6b, 0x6d, 0x68, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x68, 0x6d, 0x6b, 0x68, 0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x6b, 0x66, 0x5e, 0x5a, 0x5c, 0xbb, 0xac, 0xb3, 0xac, 0xb3, 0xb3, 0xb3, 0xa0, 0xe5, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xae, 0x46, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x41, 0xd5, 0xfe, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0x01, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xfe, 0xa9, 0x97, 0x9c, 0x9f, 0xaa, 0xab, 0x90, 0x45, 0x52, 0x4f, 0x4c, 0x4d, 0x55, 0x5a, 0x5c, 0x62, 0x66, 0x68, 0x6d, 0x71, 0x71, 0x71, 0x6f, 0x71, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x6d, 0x6d, 0x6f, 0x71, 0x71, 0x71, 0x6b, 0x66, 0x66, 0x5e, 0x5c, 0x5a, 0x52, 0x4f, 0x4c, 0x4f, 0x4f, 0x52, 0x3f, 0x08, 0xb3, 0xb3, 0xb3, 0xb3, 0xac, 0xac, 0x02, 0xbe, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0x78, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4c, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x7d, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xfa, 0x00, 0x8e, 0x9f, 0xa2, 0x9f, 0x9f, 0xa5, 0x77, 0x4c, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x4f, 0x4c, 0x4d, 0x4f, 0x52, 0x58, 0x55, 0x5a, 0x5a, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x5a, 0x5a, 0x58, 0x54, 0x52, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x86, 0xa5, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x8e, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfe, 0x46, 0x52, 0x4f, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x45, 0x7f, 0x5e, 0x4f, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0xf8, 0xfe, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xfa, 0xd2, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0xa5, 0x67, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x4f, 0x52, 0x4f, 0x4f, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4c, 0x7a, 0xa5, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x91, 0xcf, 0xfa, 0xf4, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf4, 0xfa, 0x3f, 0x4f, 0x54, 0x52, 0x54, 0x4f, 0x54, 0x52, 0x52, 0x4a, 0x7a, 0xbb, 0x7f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x54, 0x52, 0x52, 0x48, 0xae, 0xfe, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xfe, 0xb1, 0x9b, 0x9f, 0x9c, 0xa1, 0x9c, 0xb0, 0x5e, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x54, 0x4c, 0x77, 0xa5, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9b, 0x98, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfa, 0xe4, 0x3f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x5e, 0xb9, 0x9f, 0xa1, 0x43, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x4f, 0x46, 0xfe, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xfa, 0x8e, 0x97, 0x9f, 0x9f, 0x9f, 0x9f, 0xb0, 0x62, 0x4f, 0x4f, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x4f, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4c, 0x7a, 0xa2, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x8f, 0xe5, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xfe, 0xdb, 0x42, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x4a, 0xb4, 0x9b, 0x9f, 0xb9, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x4c, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x42, 0xcc, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xff, 0xda, 0x93, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0xa8, 0x68, 0x4f, 0x52, 0x4c, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x54, 0x4f, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x54, 0x4f, 0x51, 0x52, 0x4c, 0x81, 0xa5, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x95, 0xca, 0xff, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xfa, 0xde, 0x41, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x42, 0x8d, 0xa5, 0x9f, 0x9f, 0xa5, 0x77, 0x4c, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x6a, 0x75, 0x45, 0x54, 0x52, 0x52, 0x54, 0x52, 0x52, 0x4f, 0x60, 0xfe, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xfe, 0xc3, 0x93, 0x9f, 0x9c, 0x9c, 0xa2, 0x9f, 0xa5, 0x7a, 0x4c, 0x4a, 0x75, 0x6a, 0x4d, 0x54, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x46, 0x90, 0x4c, 0x3f, 0xa4, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x91, 0xfe, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfa, 0x33, 0x48, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4c, 0x6f, 0xb9, 0x9f, 0x9f, 0x9f, 0xa2, 0x98, 0x45, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x7a, 0xbb, 0x7f, 0x42, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x3e, 0xe7, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xff, 0x8f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9c, 0xa2, 0xa4, 0x3f, 0x6f, 0xbb, 0x62, 0x4f, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x43, 0x98, 0xa5, 0x81, 0xa5, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xe8, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfa, 0x2e, 0x67, 0x4c, 0x54, 0x52, 0x54, 0x52, 0x54, 0xb9, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0xb9, 0x5c, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4e, 0x7f, 0xa5, 0xb0, 0x7f, 0x45, 0x52, 0x52, 0x52, 0x52, 0x52, 0x42, 0xc1, 0xfe, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0x01, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0x01, 0xea, 0x8f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xb4, 0xab, 0xab, 0x67, 0x4e, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x90, 0xa5, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xd3, 0xfa, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfa, 0x27, 0x95, 0x42, 0x54, 0x52, 0x52, 0x45, 0xa1, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x86, 0x4a, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x4a, 0x86, 0xa5, 0x9f, 0xb9, 0x7a, 0x45, 0x54, 0x52, 0x54, 0x52, 0x45, 0x8f, 0xff, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xd9, 0x93, 0x9f, 0x9f, 0xa2, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa5, 0x72, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x44, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9b, 0xba, 0xff, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfa, 0xde, 0x9a, 0x7a, 0x45, 0x4f, 0x45, 0x90, 0xa5, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0xb9, 0x54, 0x4f, 0x54, 0x52, 0x52, 0x54, 0x52, 0x54, 0x45, 0x90, 0xa5, 0x9c, 0x9f, 0xb9, 0x72, 0x4a, 0x54, 0x52, 0x52, 0x4c, 0xa0, 0xd3, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xfe, 0xc5, 0x93, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa5, 0x7f, 0x4c, 0x54, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x45, 0xb4, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8c, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xfa, 0xe3, 0x91, 0xb0, 0x75, 0x5c, 0x98, 0xa5, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x8d, 0x44, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x42, 0xac, 0xa1, 0xa2, 0x9f, 0x9f, 0xb9, 0x67, 0x4c, 0x52, 0x4f, 0x5e, 0xa8, 0xa9, 0xfe, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xff, 0xa9, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x90, 0x45, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0xb9, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xe9, 0x01, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xfa, 0x3b, 0x8f, 0xa2, 0xab, 0xab, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xb0, 0x5e, 0x4f, 0x52, 0x54, 0x54, 0x52, 0x52, 0x52, 0xb4, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0xb9, 0x63, 0x4c, 0x4c, 0x7a, 0xa5, 0x8e, 0xf0, 0x01, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xfe, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xb9, 0x4c, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4f, 0x71, 0xab, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xd9, 0xfd, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0x8e, 0xa2, 0x9c, 0xa1, 0x9c, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xab, 0x44, 0x52, 0x52, 0x52, 0x54, 0x4f, 0x66, 0xab, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xb9, 0x75, 0x52, 0xac, 0xa2, 0x93, 0xd3, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xeb, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xab, 0x6f, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x46, 0x86, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xca, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xff, 0x91, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa5, 0x90, 0x42, 0x52, 0x54, 0x52, 0x4e, 0x7f, 0xa5, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9c, 0xa2, 0xab, 0xb0, 0xa2, 0x9f, 0x9b, 0xba, 0xfe, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xfa, 0xe3, 0x91, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x90, 0x45, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x54, 0x4f, 0x52, 0x52, 0x52, 0x52, 0x4e, 0xb9, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xba, 0xff, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xfe, 0xa9, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0xab, 0x90, 0x41, 0x4f, 0x54, 0x41, 0xb4, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x8e, 0xfe, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xda, 0x95, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0xa2, 0xa2, 0xa2, 0xb9, 0x62, 0x4f, 0x52, 0x54, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x52, 0x52, 0x4f, 0x58, 0x52, 0x52, 0x54, 0x4a, 0x7a, 0xa5, 0xa2, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9b, 0xa3, 0xfe, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xff, 0xc7, 0x95, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa1, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9c, 0x9f, 0xa1, 0x9f, 0xa5, 0xa4, 0x66, 0x42, 0x7a, 0xa5, 0x9c, 0xa2, 0x9f, 0xa2, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x93, 0xe5, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xfa, 0xd3, 0x95, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0xa1, 0x41, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x5a, 0x75, 0x51, 0x52, 0x4f, 0x51, 0xb9, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x8e, 0xff, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xd2, 0x96, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xab, 0xb9, 0xa5, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xd3, 0xfe, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xff, 0xca, 0x96, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0xab, 0x7a, 0x4a, 0x54, 0x52, 0x52, 0x55, 0x52, 0x54, 0x54, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x52, 0x4f, 0x77, 0x7f, 0x4c, 0x52, 0x42, 0x90, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0xa2, 0x8c, 0xfe, 0xfd, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfd, 0xdf, 0x91, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0x95, 0xc3, 0xfd, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xfd, 0xc9, 0x96, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xb9, 0x63, 0x4c, 0x54, 0x4e, 0x7c, 0x4a, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x52, 0x54, 0x54, 0x54, 0x52, 0x45, 0x9d, 0xa4, 0x41, 0x40, 0x81, 0xab, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xf0, 0xe3, 0xf0, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xee, 0x8f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0xaf, 0xff, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfa, 0xfe, 0x01, 0xfd, 0xc3, 0x96, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0xb9, 0x5c, 0x4c, 0x4d, 0x8d, 0x63, 0x4f, 0x52, 0x52, 0x54, 0x54, 0x52, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x52, 0x54, 0x54, 0x52, 0x54, 0x4f, 0x66, 0xb0, 0xb0, 0x77, 0x8d, 0xab, 0xa2, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x8e, 0xf1, 0xd9, 0x8c, 0xce, 0xff, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0x01, 0x8e, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xfe, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x01, 0xfe, 0xe6, 0xbe, 0x91, 0xff, 0xc1, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0xb9, 0x75, 0xf6, 0x98, 0x9c, 0x41, 0x55, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x44, 0xac, 0xa2, 0x9f, 0xa5, 0xa5, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x8e, 0xf0, 0xdc, 0x95, 0x91, 0x91, 0xe0, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xff, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9c, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0x8e, 0xff, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 
-  0xf1, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xfe, 0x00, 0xba, 0x8f, 0x93, 0xa9, 0xff, 0xc5, 0x96, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xab, 0xac, 0xa5, 0xab, 0x77, 0x4c, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x52, 0x54, 0x52, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x46, 0x84, 0xa5, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9c, 0xa2, 0x8c, 0xf2, 0xdc, 0x95, 0xa2, 0x9f, 0x8f, 0xc1, 0xfe, 0x01, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xff, 0x91, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x93, 0xeb, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0xd7, 0x8e, 0x95, 0x9f, 0x9f, 0x9d, 0xff, 0xc7, 0x96, 0xa1, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xb9, 0x5a, 0x4f, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x52, 0x52, 0x54, 0x52, 0x54, 0x52, 0x4f, 0x67, 0xb9, 0x9c, 0x9f, 0xa1, 0xa1, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0xa2, 0x9f, 0xa1, 0x9f, 0xa2, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x8c, 0xff, 0xda, 0x9a, 0x9f, 0x9f, 0x9f, 0x95, 0x98, 0xff, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xff, 0x91, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9a, 0xe5, 0xfa, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0x01, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xfe, 0xc1, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x93, 0xff, 0xcd, 0x95, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xab, 0x4e, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x4f, 0x58, 0xb9, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x8e, 0xfe, 0xd3, 0x93, 0x9f, 0x9f, 0x9f, 0xa2, 0x9a, 0x98, 0xff, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfd, 0x8e, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa0, 0x34, 0xfa, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xfe, 0xb7, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x8c, 0xfe, 0xd3, 0x95, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9d, 0x4a, 0x54, 0x52, 0x52, 0x52, 0x54, 0x52, 0x54, 0x54, 0x52, 0x54, 0x54, 0x54, 0x4c, 0xac, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x93, 0xff, 0xcd, 0x96, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xa9, 0xfe, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x02, 0x34, 0xfa, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xc7, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x8e, 0xfe, 0xdc, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa5, 0x9d, 0x46, 0x54, 0x54, 0x54, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x52, 0x44, 0x9d, 0xa2, 0x9f, 0xa2, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xb1, 0xff, 0xc5, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xcd, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xfd, 0xdf, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0x04, 0xe5, 0xfa, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xfa, 0xe2, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xeb, 0xe5, 0x93, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0xa2, 0xa2, 0x9d, 0x45, 0x52, 0x52, 0x54, 0x54, 0x54, 0x52, 0x54, 0x54, 0x43, 0x90, 0xab, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9b, 0xc5, 0xff, 0xb5, 0x9b, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x8c, 0x00, 0xf2, 0xf1, 0xf1, 0xf1, 0xfe, 0xd2, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x04, 0xe9, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0x01, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xff, 0x8f, 0x9f, 0x9f, 0xa2, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x95, 0xde, 0xf1, 0x8e, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0xa2, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa5, 0xa1, 0x4c, 0x52, 0x54, 0x52, 0x54, 0x54, 0x54, 0x44, 0x90, 0xab, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0xa2, 0x9c, 0xa2, 0x9f, 0x9f, 0x93, 0xd2, 0xfe, 0x8f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9b, 0xbe, 0xfe, 0xf1, 0xf1, 0xf1, 0xff, 0xb5, 0x9b, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xaa, 0x02, 0x01, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0x01, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xfa, 0xd2, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x96, 0xd3, 0xfe, 0x97, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9c, 0x9b, 0x9f, 0x9f, 0xa2, 0xa5, 0x56, 0x4d, 0x54, 0x53, 0x54, 0x45, 0x8d, 0x03, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xa1, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xa2, 0x95, 0xe3, 0xf3, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x8f, 0x01, 0xf2, 0xf1, 0xf2, 0x01, 0x8f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xb3, 0x02, 0xff, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xff, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9a, 0xc4, 0xff, 0xb5, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xb5, 0xb5, 0x9b, 0x9f, 0xa2, 0xa2, 0xb9, 0x63, 0x4c, 0x52, 0x49, 0x8d, 0xab, 0xa2, 0x9f, 0x9f, 0x9d, 0xc5, 0x9b, 0x9f, 0x9f, 0x9f, 0xa2, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9b, 0xb7, 0x9b, 0x8e, 0xff, 0xdc, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x95, 0xd3, 0xfd, 0xf1, 0xff, 0xcf, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0x0d, 0x0a, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xfa, 0xdf, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa9, 0xfe, 0xcd, 0x93, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa3, 0xd6, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0xb9, 0x7a, 0x45, 0x9d, 0xa5, 0xa1, 0x9f, 0xa2, 0x96, 0xc9, 0xb5, 0x9c, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xd3, 0x93, 0xaf, 0xff, 0xca, 0x9b, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9b, 0xba, 0xff, 0xf2, 0xff, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0x0b, 0x16, 0xff, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xff, 0xc9, 0x95, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0xa2, 0x9c, 0x9f, 0xa2, 0x9f, 0x8e, 0xff, 0xdc, 0x95, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xa1, 0x9f, 0x9f, 0x91, 0xe9, 0x91, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa5, 0xb4, 0xa2, 0x9f, 0xa2, 0x9f, 0x9c, 0x93, 0xe0, 0x98, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xc1, 0xce, 0x91, 0xcd, 0xfe, 0xa3, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0xfe, 0xfe, 0xbe, 0x96, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x0c, 0x08, 0xd6, 0xfe, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0x01, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xfe, 0xa9, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xe3, 0xfd, 0x8e, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xed, 0x97, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0xa2, 0xa2, 0xa2, 0x9f, 0xa2, 0x9f, 0xa2, 0x8f, 0x00, 0x8f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0xa1, 0x9f, 0xa1, 0x9c, 0xa2, 0x9f, 0x9c, 0xa2, 0x9f, 0x95, 0xe2, 0xb5, 0x8f, 0xe5, 0x01, 0x8e, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x8f, 0xef, 0xe3, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9c, 0xaa, 0x0c, 0x06, 0xe6, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xff, 0x8f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x96, 0xd2, 0xfe, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xa2, 0x9f, 0x96, 0xde, 0xc4, 0x9b, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0x9c, 0x9f, 0xa2, 0x9f, 0xa1, 0x9b, 0xa3, 0xea, 0x91, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9c, 0xa1, 0x8e, 0xff, 0x8c, 0x97, 0xfe, 0xd7, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x91, 0xe5, 0xe8, 0x91, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x0d, 0x0b, 0x04, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0x01, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xb5, 0xff, 0xca, 0x95, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa1, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x95, 0xd2, 0xd9, 0x96, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9b, 0xc7, 0xdf, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0xa1, 0xa2, 0x9f, 0xa1, 0x9f, 0x9b, 0xbe, 0xec, 0x8f, 0xc9, 0xff, 0xb8, 0x9b, 0xa2, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x93, 0xe0, 0xec, 0x8f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x07, 0x0c, 0x09, 0x17, 0xff, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0x01, 0xf0, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x91, 0xfe, 0xdf, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0xa2, 0x9f, 0xa2, 0x9f, 0x9b, 0xc4, 0xe9, 0x93, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9a, 0xd9, 0xd6, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xda, 0xda, 0x8c, 0xe8, 0xec, 0x96, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x93, 0xe2, 0xee, 0x8f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0x0c, 0x0b, 0x06, 0xe2, 0xfa, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0x01, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x8e, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x93, 0xe0, 0xfe, 0x8e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xb1, 0xff, 0x8c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x91, 0xe9, 0xc7, 0x95, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x8e, 0xf4, 0xc5, 0x9d, 0xff, 0x19, 0xb3, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0x34, 0xea, 0x91, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0xa2, 0xa2, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x0f, 0x0c, 0x0b, 0xaa, 0xff, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0x01, 0x01, 0x8e, 0x9f, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9b, 0xc5, 0xff, 0xc3, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9c, 0xff, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x8e, 0xff, 0xb8, 0x9c, 0x9f, 0xa1, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa9, 0xff, 0x97, 0xd9, 0xff, 0x03, 0x08, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xee, 0xdf, 0x93, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x0c, 0x0b, 0x0c, 0x08, 0x1a, 0xfa, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xfe, 0x91, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x96, 0xff, 0xde, 0x93, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9c, 0xa2, 0x9f, 0x91, 0xff, 0xba, 0x9a, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9b, 0xa9, 0xff, 0x93, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x95, 0xcd, 0xff, 0x85, 0xfe, 0x27, 0x04, 0x0b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x8f, 0xff, 0xd7, 0x95, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x97, 0x0c, 0x0c, 0x0c, 0x0b, 0x04, 0x01, 0x01, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xff, 0xb1, 0x9b, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x96, 0xe0, 0xfe, 0x8f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x8e, 0x01, 0xc9, 0x9b, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x96, 0xc5, 0xfd, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x91, 0xe6, 0xe0, 0xc9, 0xfe, 0x0a, 0x09, 0x09, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xaf, 0xff, 0xc7, 0x96, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x97, 0x0c, 0x0c, 0x0b, 0x0c, 0x08, 0x18, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xff, 0xca, 0x9a, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xc2, 0xff, 0xca, 0x96, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x93, 0xe8, 0xd7, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x95, 0xd7, 0xe8, 0x91, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa1, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x91, 0xfe, 0xc5, 0xfd, 0x34, 0x04, 0x0b, 0xad, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x95, 0xcd, 0xfe, 0xa9, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x0b, 0x0d, 0x0c, 0x0c, 0x0b, 0x03, 0xfd, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xfa, 0xe3, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0xa0, 0xf2, 0xeb, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xa2, 0x95, 0xe0, 0xdf, 0x95, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x95, 0xe3, 0xdc, 0x95, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9b, 0xc3, 0xfd, 0xdc, 0xff, 0x0a, 0x09, 0x09, 0xad, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0x9f, 0x91, 0xe5, 0x01, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa1, 0x0d, 0x0c, 0x0c, 0x0d, 0x0c, 0x05, 0x20, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfe, 0x8f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x03, 0x1a, 0xff, 0xb5, 0x9b, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9a, 0xd7, 0xea, 0x93, 0xa2, 0x9f, 0x9f, 0xa2, 0xa1, 0x9f, 0x9f, 0x9f, 0x8c, 0xff, 0xcf, 0x96, 0xa2, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9f, 0xa2, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x93, 0xdc, 0xf2, 0xfe, 0xda, 0x06, 0x09, 0x0c, 0xa2, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9d, 0xfe, 0xd6, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa2, 0x9f, 0x97, 0xac, 0x0d, 0x0c, 0x0c, 0x0c, 0x0b, 0x0c, 0x0a, 0xff, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xcf, 0x96, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0xaa, 0x02, 0xfe, 0xde, 0x93, 0xa2, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0xa1, 0xa2, 0xa1, 0xa2, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9a, 0xcd, 0xfe, 0x8c, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x91, 0xff, 0xc4, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0xa2, 0xa1, 0x9f, 0xa2, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x8e, 0xff, 0xf0, 0x01, 0x04, 0x09, 0x0b, 0x07, 0x9f, 0xa2, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0xd3, 0xff, 0xa3, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9b, 0x0a, 0x0f, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x02, 0xf0, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xff, 0x8e, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x05, 0x22, 0xfe, 0x9d, 0x9b, 0xa2, 0x9c, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xc3, 0xff, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0xb5, 0xff, 0xb8, 0x9f, 0x9f, 0xa2, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x97, 0xba, 0xff, 0xfa, 0x15, 0x09, 0x07, 0x0b, 0xa4, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x91, 0xfe, 0x37, 0x9a, 0x9b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xad, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x05, 0x2e, 0xfd, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xfe, 0xda, 0x91, 0x9f, 0xa2, 0x9f, 0x9b, 0x95, 0x95, 0x91, 0x93, 0x95, 0x96, 0x9c, 0x9f, 0xb3, 0xad, 0xfe, 0xd7, 0x93, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0xa2, 0x97, 0xb5, 0xff, 0xb8, 0x9f, 0x9f, 0xa2, 0x9f, 0xa2, 0x9f, 0x9f, 0x95, 0xc9, 0xff, 0x8f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9a, 0xd9, 0xfa, 0x2d, 0x04, 0x0c, 0x09, 0x09, 0x96, 0x93, 0x95, 0x95, 0x93, 0x96, 0x9b, 0x9f, 0x9f, 0xa1, 0x9f, 0x91, 0xdc, 0xff, 0x0e, 0x09, 0xad, 0x97, 0x9f, 0x9f, 0x9f, 0xa2, 0xa1, 0x9f, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0xad, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x08, 0x18, 0xfe, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfe, 0xb5, 0x96, 0x93, 0x8f, 0xc1, 0xd2, 0xda, 0xde, 0xdc, 0xd7, 0xc7, 0x9f, 0x8f, 0xa0, 0x06, 0x2d, 0xff, 0x97, 0x9f, 0x9f, 0xa1, 0xa2, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x93, 0xfe, 0xc7, 0x96, 0xa1, 0x9f, 0x9f, 0x9f, 0x9c, 0xa2, 0x95, 0xd7, 0xf4, 0x8e, 0xa2, 0x9f, 0xa2, 0x9c, 0x9f, 0x9b, 0x9c, 0x9b, 0x9f, 0x9b, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa2, 0x8c, 0xfa, 0xec, 0x04, 0x0b, 0x08, 0x06, 0x97, 0xbe, 0xcf, 0xd7, 0xda, 0xd3, 0xca, 0xb5, 0x8e, 0x95, 0x9b, 0x96, 0xbe, 0xfe, 0x22, 0x06, 0x0d, 0x0c, 0x0c, 0xa1, 0x9b, 0x9c, 0x9c, 0xa2, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0xad, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x08, 0xc2, 0xff, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xff, 0xb5, 0xe0, 0xff, 0xff, 0xf1, 0x3b, 0x3a, 0xeb, 0xf0, 0xfe, 0xff, 0x3a, 0xc5, 0x04, 0x07, 0xff, 0xd2, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9b, 0x93, 0x91, 0xaf, 0xbf, 0xc2, 0xc2, 0xc2, 0xbc, 0xaf, 0x97, 0x91, 0x96, 0x9f, 0x8e, 0xfe, 0xcf, 0x9b, 0xa1, 0xa2, 0xa2, 0xa2, 0xaa, 0xac, 0x9a, 0xe5, 0xe6, 0x93, 0x9b, 0x95, 0x8f, 0x97, 0xad, 0xbc, 0xbc, 0xbc, 0xb8, 0xa4, 0x8f, 0x95, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9a, 0xbe, 0xff, 0x14, 0x09, 0x04, 0x17, 0x34, 0xff, 0xff, 0xf1, 0xeb, 0x3c, 0xed, 0xf1, 0xff, 0xfa, 0xda, 0xb1, 0x98, 0xff, 0xed, 0x05, 0x0d, 0x0c, 0x0c, 0x0d, 0x0f, 0x0d, 0xad, 0xa1, 0x9b, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x97, 0x9f, 0xa4, 0xb3, 0x0c, 0x0f, 0x0f, 0x0c, 0x0b, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0c, 0x06, 0x15, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xff, 0xef, 0x30, 0x1f, 0x1f, 0x24, 0x24, 0x24, 0x1f, 0x20, 0x2e, 0xe8, 0xff, 0xe9, 0x08, 0x27, 0xff, 0x91, 0x9f, 0xa1, 0x9b, 0x93, 0xc2, 0x1f, 0x32, 0x2c, 0x2c, 0x2b, 0x2c, 0x2b, 0x2c, 0x2f, 0x32, 0x26, 0x17, 0x9f, 0x8f, 0xec, 0x2d, 0x0d, 0x13, 0x12, 0x13, 0x11, 0x11, 0x11, 0x06, 0xff, 0xda, 0x8f, 0xb8, 0x18, 0x2b, 0x31, 0x31, 0x2a, 0x2c, 0x2a, 0x2c, 0x2c, 0x32, 0x19, 0xb8, 0x93, 0x9f, 0xa2, 0x9f, 0x93, 0xe0, 0xfa, 0x02, 0x10, 0xeb, 0xfa, 0x3b, 0x2e, 0x20, 0x1e, 0x24, 0x21, 0x24, 0x1f, 0x25, 0x33, 0xf1, 0xfe, 0xfa, 0x01, 0x07, 0x0b, 0x0d, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0d, 0x0f, 0x0d, 0x0c, 0xad, 0x07, 0xad, 0xad, 0xad, 0xb3, 0x07, 0x07, 0x0f, 0x0d, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x06, 0x15, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0x33, 0x23, 0x24, 0x28, 0x26, 0x26, 0x26, 0x29, 0x29, 0x26, 0x26, 0x21, 0x25, 0x3b, 0xff, 0xce, 0xff, 0xcd, 0x9a, 0x91, 0xbf, 0x2f, 0x2c, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x29, 0x29, 0x28, 0x32, 0x15, 0xdf, 0x3b, 0x09, 0x11, 0x0f, 0x11, 0x0f, 0x11, 0x10, 0x0e, 0xfe, 0xcf, 0x1b, 0x2f, 0x28, 0x29, 0x26, 0x26, 0x26, 0x26, 0x26, 0x29, 0x25, 0x29, 0x29, 0x2f, 0x1f, 0xa1, 0x9b, 0x9f, 0x91, 0xff, 0x20, 0x19, 0xff, 0x39, 0x21, 0x21, 0x26, 0x26, 0x29, 0x26, 0x29, 0x26, 0x25, 0x26, 0x25, 0x1e, 0x33, 0xfd, 0xe8, 0x06, 0x0d, 0x0d, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0c, 0x0f, 0x0d, 0x0f, 0x0c, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x04, 0x19, 0xfe, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0x2d, 0x24, 0x25, 0x29, 0x29, 0x26, 0x26, 0x26, 0x29, 0x25, 0x29, 0x26, 0x26, 0x29, 0x1e, 0x30, 0xfd, 0xf0, 0x3b, 0x8c, 0x18, 0x2f, 0x26, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x29, 0x29, 0x26, 0x26, 0x25, 0x29, 0x26, 0x26, 0x38, 0xf3, 0xad, 0x11, 0x10, 0x11, 0x11, 0x11, 0x0f, 0x16, 0xff, 0x2e, 0x29, 0x26, 0x29, 0x23, 0x26, 0x29, 0x26, 0x26, 0x25, 0x29, 0x25, 0x25, 0x26, 0x26, 0x29, 0x31, 0xbc, 0x93, 0xce, 0xfd, 0x3a, 0xfd, 0x2a, 0x1f, 0x25, 0x26, 0x26, 0x26, 0x26, 0x28, 0x25, 0x26, 0x26, 0x26, 0x26, 0x29, 0x25, 0x28, 0xfd, 0x30, 0x06, 0x0d, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x09, 0x02, 0x2d, 0xfe, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x01, 0x35, 0x24, 0x26, 0x26, 0x26, 0x29, 0x25, 0x29, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x23, 0x28, 0xf2, 0xfd, 0x17, 0x2b, 0x25, 0x26, 0x25, 0x29, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x23, 0x33, 0xff, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x11, 0x0c, 0x1b, 0xfd, 0x25, 0x26, 0x25, 0x26, 0x26, 0x29, 0x25, 0x26, 0x26, 0x29, 0x25, 0x29, 0x26, 0x25, 0x25, 0x26, 0x26, 0x32, 0x9f, 0xe9, 0xf1, 0xf1, 0x23, 0x23, 0x25, 0x25, 0x26, 0x29, 0x26, 0x26, 0x26, 0x29, 0x26, 0x26, 0x28, 0x26, 0x26, 0x26, 0x26, 0x2a, 0xff, 0x0e, 0x0d, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0f, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x0c, 0x0a, 0x0b, 0x0c, 0x0c, 0x0c, 0x09, 0x0c, 0x08, 0x0a, 0x00, 0xfa, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xed, 0x1e, 0x26, 0x26, 0x23, 0x2e, 0x26, 0x28, 0x26, 0x29, 0x24, 0x28, 0x26, 0x29, 0x29, 0x28, 0x23, 0x29, 0x25, 0x33, 0x01, 0x30, 0x23, 0x26, 0x26, 0x26, 0x25, 0x26, 0x26, 0x29, 0x26, 0x25, 0x25, 0x25, 0x29, 0x26, 0x26, 0x26, 0x26, 0x25, 0x2e, 0xfd, 0x16, 0x0f, 0x10, 0x11, 0x11, 0x10, 0x0f, 0xd6, 0xff, 0x1d, 0x29, 0x25, 0x26, 0x25, 0x26, 0x25, 0x29, 0x23, 0x29, 0x25, 0x29, 0x26, 0x26, 0x26, 0x25, 0x26, 0x26, 0x1f, 0xf1, 0xf1, 0x20, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x24, 0x29, 0x26, 0x26, 0x26, 0x2e, 0x25, 0x26, 0x26, 0x23, 0x3b, 0x2d, 0x08, 0x0c, 0x0d, 0x0d, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0c, 0x0a, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0a, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x02, 0x1f, 0xff, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfd, 0x2a, 0x23, 0x26, 0x23, 0xf0, 0x2a, 0x26, 0x29, 0x29, 0x23, 0x30, 0x35, 0x25, 0x26, 0x26, 0x26, 0x29, 0x26, 0x26, 0x1d, 0xef, 0x36, 0x23, 0x26, 0x26, 0x26, 0x29, 0x26, 0x29, 0x26, 0x26, 0x25, 0x29, 0x29, 0x26, 0x25, 0x29, 0x25, 0x26, 0x23, 0x29, 0xfd, 0x18, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0d, 0xe0, 0xf1, 0x1f, 0x25, 0x29, 0x26, 0x25, 0x29, 0x26, 0x26, 0x29, 0x25, 0x26, 0x26, 0x25, 0x26, 0x26, 0x26, 0x23, 0x26, 0x2a, 0xfd, 0x2e, 0x25, 0x29, 0x26, 0x26, 0x29, 0x25, 0x28, 0x23, 0x33, 0x35, 0x23, 0x29, 0x28, 0x26, 0x2e, 0xeb, 0x24, 0x29, 0x26, 0x28, 0xff, 0x05, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0a, 0x0c, 0x0c, 0x09, 0x04, 0x16, 0x01, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0x1e, 0x26, 0x26, 0x33, 0xeb, 0x24, 0x25, 0x29, 0x26, 0x23, 0xfd, 0x25, 0x26, 0x26, 0x29, 0x25, 0x28, 0x26, 0x26, 0x23, 0x3a, 0x3b, 0x24, 0x26, 0x26, 0x29, 0x26, 0x26, 0x25, 0x29, 0x26, 0x25, 0x26, 0x26, 0x26, 0x25, 0x26, 0x29, 0x26, 0x26, 0x1f, 0xfa, 0x1a, 0x0f, 0x11, 0x10, 0x11, 0x11, 0x07, 0x3c, 0xeb, 0x1e, 0x28, 0x25, 0x26, 0x26, 0x26, 0x29, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x29, 0x24, 0x36, 0xfd, 0x1d, 0x29, 0x29, 0x26, 0x26, 0x25, 0x29, 0x25, 0x29, 0x25, 0xfd, 0x1f, 0x28, 0x26, 0x26, 0x21, 0x00, 0x2e, 0x25, 0x29, 0x1f, 0xff, 0x0e, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x0c, 0x0d, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0a, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0a, 0x08, 0x02, 0x17, 0xee, 0xff, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0x3a, 0x24, 0x29, 0x23, 0x3b, 0x35, 0x25, 0x29, 0x26, 0x26, 0x2e, 0xf1, 0x1f, 0x29, 0x28, 0x26, 0x26, 0x26, 0x29, 0x26, 0x23, 0x35, 0xf0, 0x1f, 0x26, 0x29, 0x26, 0x26, 0x29, 0x26, 0x26, 0x26, 0x25, 0x26, 0x26, 0x29, 0x26, 0x26, 0x25, 0x26, 0x26, 0x1d, 0xfd, 0xd6, 0x0f, 0x12, 0x12, 0x12, 0x10, 0x0c, 0xfd, 0x39, 0x25, 0x25, 0x29, 0x26, 0x25, 0x29, 0x26, 0x26, 0x25, 0x26, 0x29, 0x26, 0x26, 0x29, 0x26, 0x29, 0x26, 0x21, 0x3d, 0x3b, 0x24, 0x26, 0x25, 0x26, 0x26, 0x26, 0x29, 0x26, 0x26, 0x21, 0xfd, 0x2a, 0x26, 0x26, 0x26, 0x25, 0x3a, 0x38, 0x23, 0x26, 0x1f, 0xfd, 0x05, 0x08, 0x0b, 0x0f, 0x0f, 0x0d, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x06, 0x05, 0x0e, 0x22, 0xfa, 0xfe, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xeb, 0x24, 0x26, 0x24, 0xef, 0x33, 0x23, 0x26, 0x26, 0x25, 0x33, 0xeb, 0x21, 0x29, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x2e, 0xfd, 0x23, 0x25, 0x26, 0x29, 0x26, 0x25, 0x29, 0x28, 0x29, 0x26, 0x26, 0x29, 0x26, 0x2c, 0x25, 0x29, 0x25, 0x29, 0x21, 0xef, 0x27, 0x0d, 0x12, 0x10, 0x12, 0x11, 0x0e, 0xff, 0x35, 0x25, 0x29, 0x25, 0x25, 0x2e, 0x26, 0x26, 0x29, 0x25, 0x29, 0x23, 0x2a, 0x26, 0x26, 0x29, 0x26, 0x29, 0x1f, 0xfd, 0x36, 0x23, 0x26, 0x26, 0x26, 0x29, 0x26, 0x26, 0x28, 0x26, 0x21, 0x00, 0x2e, 0x25, 0x26, 0x29, 0x24, 0x37, 0x3a, 0x24, 0x26, 0x1f, 0xfa, 0xe8, 0x1c, 0x15, 0x06, 0x03, 0x09, 0x09, 0x08, 0x09, 0x09, 0x09, 0x08, 0x09, 0xb3, 0x08, 0x06, 0x02, 0x0b, 0x17, 0x27, 0x00, 0xfe, 0xfa, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfa, 0x23, 0x26, 0x21, 0xec, 0x36, 0x24, 0x29, 0x26, 0x26, 0x35, 0xeb, 0x21, 0x28, 0x26, 0x26, 0x29, 0x26, 0x26, 0x26, 0x25, 0x26, 0xfd, 0x28, 0x25, 0x29, 0x26, 0x25, 0x38, 0x2e, 0x26, 0x26, 0x26, 0x29, 0x28, 0x24, 0xeb, 0x30, 0x23, 0x26, 0x25, 0x23, 0x3b, 0x27, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0xfa, 0x30, 0x26, 0x26, 0x23, 0x30, 0x3b, 0x25, 0x25, 0x26, 0x26, 0x29, 0x24, 0x39, 0x30, 0x26, 0x26, 0x29, 0x26, 0x2e, 0xfd, 0x30, 0x23, 0x29, 0x25, 0x26, 0x26, 0x25, 0x28, 0x26, 0x29, 0x23, 0xf1, 0x2c, 0x26, 0x26, 0x26, 0x24, 0x3a, 0x39, 0x24, 0x21, 0x33, 0xfa, 0x01, 0xfe, 0xfe, 0xff, 0x01, 0x35, 0x2e, 0x22, 0x1c, 0x1a, 0x1a, 0x1c, 0x20, 0x2e, 0x2d, 0x3b, 0xfd, 0xff, 0xfe, 0xfd, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xfa, 0xf1, 0x1f, 0x21, 0x36, 0xef, 0x1e, 0x29, 0x26, 0x25, 0x30, 0x01, 0x1d, 0x26, 0x29, 0x26, 0x29, 0x26, 0x26, 0x25, 0x26, 0x1f, 0xfd, 0x35, 0x24, 0x26, 0x29, 0x21, 0xec, 0x2c, 0x26, 0x26, 0x28, 0x26, 0x26, 0x24, 0x37, 0x36, 0x25, 0x26, 0x25, 0x21, 0x3b, 0xe8, 0x20, 0x1a, 0x19, 0x18, 0x18, 0x17, 0xff, 0x33, 0x25, 0x28, 0x24, 0x39, 0x35, 0x23, 0x29, 0x26, 0x26, 0x29, 0x24, 0x35, 0x39, 0x25, 0x29, 0x29, 0x21, 0x3a, 0xfd, 0x28, 0x24, 0x26, 0x25, 0x26, 0x29, 0x26, 0x26, 0x29, 0x26, 0x23, 0xfd, 0x26, 0x28, 0x25, 0x28, 0x1e, 0xf2, 0x30, 0x1d, 0x30, 0xfa, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf4, 0xfa, 0xfa, 0xfe, 0xfa, 0xfe, 0xfe, 0xfe, 0xfa, 0xfe, 0xfa, 0xfa, 0xfa, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xfa, 0xfa, 0x30, 0x1d, 0x01, 0x2a, 0x25, 0x29, 0x26, 0x20, 0xfd, 0x2c, 0x25, 0x29, 0x26, 0x25, 0x26, 0x23, 0x24, 0x1f, 0x1d, 0xed, 0xed, 0x1f, 0x26, 0x26, 0x23, 0xef, 0x2e, 0x26, 0x26, 0x25, 0x29, 0x26, 0x23, 0x35, 0x39, 0x23, 0x26, 0x26, 0x1d, 0xfa, 0xf2, 0xfd, 0xfe, 0xfd, 0xfe, 0xfa, 0xfe, 0xf4, 0x38, 0x23, 0x29, 0x24, 0x3a, 0x33, 0x23, 0x25, 0x26, 0x26, 0x29, 0x24, 0x38, 0x38, 0x23, 0x26, 0x26, 0x23, 0xfa, 0xf1, 0xf1, 0x33, 0x25, 0x1f, 0x21, 0x24, 0x23, 0x25, 0x26, 0x23, 0x35, 0xee, 0x21, 0x25, 0x26, 0x21, 0x33, 0xec, 0x25, 0xed, 0xfa, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xfa, 0xf2, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0xfa, 0xf4, 0xfa, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0x01, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0xf2, 0x01, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xfe, 0xf4, 0xee, 0xf0, 0x2c, 0x22, 0x1f, 0x1d, 0x35, 0xed, 0x1d, 0x20, 0x20, 0x28, 0x2a, 0x31, 0x34, 0x3d, 0xfa, 0xfa, 0xfa, 0x2e, 0x25, 0x26, 0x24, 0x39, 0x39, 0x24, 0x29, 0x29, 0x26, 0x26, 0x25, 0x36, 0x36, 0x26, 0x26, 0x21, 0x35, 0xfd, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xfa, 0x1f, 0x26, 0x25, 0x3a, 0x35, 0x25, 0x29, 0x26, 0x26, 0x26, 0x21, 0xec, 0x33, 0x25, 0x29, 0x1d, 0x3d, 0xfa, 0xf4, 0xf2, 0xfa, 0xfe, 0x01, 0x3d, 0x39, 0x33, 0x31, 0x28, 0x2a, 0xfd, 0x27, 0x23, 0x2a, 0x2e, 0x35, 0x01, 0xf2, 0xfe, 0xfa, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xfa, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0x01, 0xf4, 0xfa, 0xfe, 0xfe, 0xfe, 0xfa, 0x01, 0xfa, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xfa, 0xf4, 0xfa, 0xfe, 0x2a, 0x1f, 0x26, 0x2e, 0xf2, 0x21, 0x26, 0x25, 0x29, 0x29, 0x24, 0x3a, 0x35, 0x25, 0x1f, 0x30, 0xfe, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xfa, 0xee, 0x21, 0x21, 0x36, 0x3a, 0x24, 0x26, 0x29, 0x26, 0x25, 0x29, 0xfd, 0x21, 0x24, 0x1f, 0xed, 0xfe, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xfa, 0xfa, 0xfe, 0xfa, 0xfe, 0xfe, 0xf2, 0xfe, 0xfe, 0xfa, 0xfe, 0xfa, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf4, 0xfa, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xfe, 0x3b, 0x28, 0x1b, 0x39, 0x36, 0x1e, 0x25, 0x23, 0x24, 0x23, 0xfa, 0x1b, 0x2a, 0x3b, 0xfe, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf1, 0xfa, 0xfa, 0x35, 0x20, 0xf1, 0x1e, 0x25, 0x21, 0x24, 0x1e, 0xed, 0x27, 0x26, 0x38, 0xfa, 0xfa, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xfa, 0xfe, 0xfe, 0xed, 0xfa, 0x3b, 0x38, 0x36, 0x36, 0xf0, 0xef, 0xf4, 0xfe, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfe, 0x01, 0xf0, 0x39, 0x3a, 0x3a, 0xef, 0xfa, 0xf4, 0xfe, 0xfa, 0x01, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0x01, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0x01, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0x01, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0x01, 0xf4, 0xf4, 0xf2, 0xfa, 0xf4, 0xfa, 0xfa, 0xfa, 0xfe, 0xf2, 0xfa, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0x01, 0xf4, 0xf2, 0xf4, 0xf4, 0xfa, 0xfa, 0xfa, 0xfa, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0x01, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xfa, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0x01, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0x01, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 
-};
-
-const lv_img_dsc_t image3 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image3_map,
-};
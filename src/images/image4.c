@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE4
-#define LV_ATTRIBUTE_IMG_IMAGE4
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE4 uint8_t image4_map[] = {
-  0xfb, 0xfb, 0xfb, 0xff, 	/*Color of index 0*/
-  0x4a, 0x76, 0xee, 0xff, 	/*Color of index 1*/
-  0x11, 0x10, 0x18, 0xff, 	/*Color of index 2*/
-  0x00, 0x09, 0x25, 0xff, 	/*Color of index 3*/
-  0x0a, 0x0a, 0x14, 0xff, 	/*Color of index 4*/
-  0x01, 0x04, 0x16, 0xff, 	/*Color of index 5*/
-  0x02, 0x02, 0x0c, 0xff, 	/*Color of index 6*/
-  0xf5, 0xf8, 0xfc, 0xff, 	/*Color of index 7*/
-  0xde, 0xf9, 0xfe, 0xff, 	/*Color of index 8*/
-  0xb7, 0xeb, 0xfc, 0xff, 	/*Color of index 9*/
-  0x7c, 0xdd, 0xfc, 0xff, 	/*Color of index 10*/
-  0x6c, 0xd5, 0xfb, 0xff, 	/*Color of index 11*/
-  0x60, 0xd3, 0xfc, 0xff, 	/*Color of index 12*/
-  0x8a, 0xd1, 0xec, 0xff, 	/*Color of index 13*/
-  0xb2, 0xcc, 0xe8, 0xff, 	/*Color of index 14*/
-  0x6e, 0xcf, 0xf2, 0xff, 	/*Color of index 15*/
-  0x4b, 0xcc, 0xf8, 0xff, 	/*Color of index 16*/
-  0x5e, 0xca, 0xf6, 0xff, 	/*Color of index 17*/
-  0x65, 0xca, 0xe4, 0xff, 	/*Color of index 18*/
-  0x4c, 0xc3, 0xf2, 0xff, 	/*Color of index 19*/
-  0x5c, 0xbf, 0xf7, 0xff, 	/*Color of index 20*/
-  0x4c, 0xc7, 0xe1, 0xff, 	/*Color of index 21*/
-  0x70, 0xc0, 0xe9, 0xff, 	/*Color of index 22*/
-  0x3f, 0xbf, 0xee, 0xff, 	/*Color of index 23*/
-  0x38, 0xbb, 0xf5, 0xff, 	/*Color of index 24*/
-  0x54, 0xc0, 0xd8, 0xff, 	/*Color of index 25*/
-  0x74, 0xbc, 0xd9, 0xff, 	/*Color of index 26*/
-  0x46, 0xbf, 0xde, 0xff, 	/*Color of index 27*/
-  0x32, 0xb8, 0xf5, 0xff, 	/*Color of index 28*/
-  0x38, 0xbd, 0xe2, 0xff, 	/*Color of index 29*/
-  0x23, 0xba, 0xf3, 0xff, 	/*Color of index 30*/
-  0x59, 0xb8, 0xe7, 0xff, 	/*Color of index 31*/
-  0x22, 0xb7, 0xfa, 0xff, 	/*Color of index 32*/
-  0x36, 0xb9, 0xeb, 0xff, 	/*Color of index 33*/
-  0x10, 0xba, 0xf4, 0xff, 	/*Color of index 34*/
-  0x28, 0xb4, 0xf9, 0xff, 	/*Color of index 35*/
-  0x1d, 0xb4, 0xfb, 0xff, 	/*Color of index 36*/
-  0x24, 0xb8, 0xeb, 0xff, 	/*Color of index 37*/
-  0x29, 0xb5, 0xf3, 0xff, 	/*Color of index 38*/
-  0x23, 0xb4, 0xf8, 0xff, 	/*Color of index 39*/
-  0x59, 0xb9, 0xd3, 0xff, 	/*Color of index 40*/
-  0x1d, 0xb5, 0xf4, 0xff, 	/*Color of index 41*/
-  0x24, 0xb3, 0xf6, 0xff, 	/*Color of index 42*/
-  0x13, 0xb3, 0xfb, 0xff, 	/*Color of index 43*/
-  0x48, 0xb0, 0xef, 0xff, 	/*Color of index 44*/
-  0x2d, 0xb4, 0xea, 0xff, 	/*Color of index 45*/
-  0x26, 0xab, 0xf8, 0xff, 	/*Color of index 46*/
-  0x50, 0xae, 0xdd, 0xff, 	/*Color of index 47*/
-  0x34, 0xa8, 0xf7, 0xff, 	/*Color of index 48*/
-  0x18, 0xa8, 0xfa, 0xff, 	/*Color of index 49*/
-  0x1c, 0xa7, 0xf1, 0xff, 	/*Color of index 50*/
-  0x5d, 0xab, 0xcb, 0xff, 	/*Color of index 51*/
-  0x26, 0xa2, 0xf8, 0xff, 	/*Color of index 52*/
-  0x35, 0xa5, 0xe8, 0xff, 	/*Color of index 53*/
-  0x45, 0xa3, 0xe5, 0xff, 	/*Color of index 54*/
-  0x23, 0xa2, 0xe7, 0xff, 	/*Color of index 55*/
-  0x13, 0xa1, 0xef, 0xff, 	/*Color of index 56*/
-  0x4b, 0xa7, 0xc7, 0xff, 	/*Color of index 57*/
-  0x5e, 0xa1, 0xd4, 0xff, 	/*Color of index 58*/
-  0x2c, 0x9a, 0xee, 0xff, 	/*Color of index 59*/
-  0x1f, 0x9a, 0xef, 0xff, 	/*Color of index 60*/
-  0x45, 0x9d, 0xd6, 0xff, 	/*Color of index 61*/
-  0x10, 0x98, 0xf2, 0xff, 	/*Color of index 62*/
-  0x1e, 0x95, 0xf4, 0xff, 	/*Color of index 63*/
-  0x19, 0x97, 0xea, 0xff, 	/*Color of index 64*/
-  0x4d, 0xa1, 0xb6, 0xff, 	/*Color of index 65*/
-  0x34, 0x97, 0xde, 0xff, 	/*Color of index 66*/
-  0x12, 0x96, 0xe9, 0xff, 	/*Color of index 67*/
-  0x26, 0x94, 0xdf, 0xff, 	/*Color of index 68*/
-  0x0d, 0x92, 0xec, 0xff, 	/*Color of index 69*/
-  0x1a, 0x92, 0xe3, 0xff, 	/*Color of index 70*/
-  0x11, 0x92, 0xe4, 0xff, 	/*Color of index 71*/
-  0x48, 0x93, 0xc8, 0xff, 	/*Color of index 72*/
-  0x1a, 0x8a, 0xee, 0xff, 	/*Color of index 73*/
-  0x4c, 0x95, 0xb6, 0xff, 	/*Color of index 74*/
-  0x67, 0x8b, 0xc5, 0xff, 	/*Color of index 75*/
-  0x10, 0x8b, 0xe1, 0xff, 	/*Color of index 76*/
-  0x21, 0x82, 0xf3, 0xff, 	/*Color of index 77*/
-  0x2e, 0x89, 0xd2, 0xff, 	/*Color of index 78*/
-  0x3f, 0x8b, 0xc5, 0xff, 	/*Color of index 79*/
-  0x4e, 0x82, 0xdb, 0xff, 	/*Color of index 80*/
-  0x1e, 0x82, 0xea, 0xff, 	/*Color of index 81*/
-  0x0f, 0x81, 0xf0, 0xff, 	/*Color of index 82*/
-  0x32, 0x7a, 0xf7, 0xff, 	/*Color of index 83*/
-  0x32, 0x7b, 0xe5, 0xff, 	/*Color of index 84*/
-  0x1e, 0x78, 0xf5, 0xff, 	/*Color of index 85*/
-  0x0c, 0x81, 0xdc, 0xff, 	/*Color of index 86*/
-  0x48, 0x8c, 0xa1, 0xff, 	/*Color of index 87*/
-  0x43, 0x80, 0xc1, 0xff, 	/*Color of index 88*/
-  0x31, 0x7d, 0xb2, 0xff, 	/*Color of index 89*/
-  0x46, 0x7d, 0xa8, 0xff, 	/*Color of index 90*/
-  0x05, 0x77, 0xd2, 0xff, 	/*Color of index 91*/
-  0x14, 0x76, 0xcf, 0xff, 	/*Color of index 92*/
-  0x35, 0x76, 0xc2, 0xff, 	/*Color of index 93*/
-  0x39, 0x7f, 0x9d, 0xff, 	/*Color of index 94*/
-  0x21, 0x75, 0xc4, 0xff, 	/*Color of index 95*/
-  0x0c, 0x6f, 0xd9, 0xff, 	/*Color of index 96*/
-  0x48, 0x7a, 0x97, 0xff, 	/*Color of index 97*/
-  0x18, 0x6d, 0xbe, 0xff, 	/*Color of index 98*/
-  0x4b, 0x79, 0x84, 0xff, 	/*Color of index 99*/
-  0x16, 0x68, 0xce, 0xff, 	/*Color of index 100*/
-  0x2d, 0x6d, 0xaf, 0xff, 	/*Color of index 101*/
-  0x07, 0x66, 0xd1, 0xff, 	/*Color of index 102*/
-  0x06, 0x6b, 0xbf, 0xff, 	/*Color of index 103*/
-  0x36, 0x6e, 0x9d, 0xff, 	/*Color of index 104*/
-  0x31, 0x6a, 0x87, 0xff, 	/*Color of index 105*/
-  0x30, 0x64, 0x73, 0xff, 	/*Color of index 106*/
-  0x07, 0x57, 0xa8, 0xff, 	/*Color of index 107*/
-  0x2a, 0x5b, 0x85, 0xff, 	/*Color of index 108*/
-  0x1e, 0x51, 0x7b, 0xff, 	/*Color of index 109*/
-  0x24, 0x50, 0x68, 0xff, 	/*Color of index 110*/
-  0x1a, 0x46, 0x67, 0xff, 	/*Color of index 111*/
-  0x14, 0x38, 0x5b, 0xff, 	/*Color of index 112*/
-  0x0d, 0x36, 0x49, 0xff, 	/*Color of index 113*/
-  0x0a, 0x29, 0x55, 0xff, 	/*Color of index 114*/
-  0x0d, 0x2c, 0x47, 0xff, 	/*Color of index 115*/
-  0x06, 0x23, 0x33, 0xff, 	/*Color of index 116*/
-  0x06, 0x1f, 0x3f, 0xff, 	/*Color of index 117*/
-  0x02, 0x15, 0x2b, 0xff, 	/*Color of index 118*/
-  0x0d, 0x13, 0x14, 0xff, 	/*Color of index 119*/
-  0x01, 0x0b, 0x17, 0xff, 	/*Color of index 120*/
-  0x04, 0x08, 0x0a, 0xff, 	/*Color of index 121*/
-  0x61, 0xc1, 0xc2, 0xff, 	/*Color of index 122*/
-  0x71, 0xc0, 0xb9, 0xff, 	/*Color of index 123*/
-  0x4f, 0xbe, 0xc8, 0xff, 	/*Color of index 124*/
-  0x5f, 0xbc, 0xa6, 0xff, 	/*Color of index 125*/
-  0x70, 0xb8, 0xa7, 0xff, 	/*Color of index 126*/
-  0x5c, 0xac, 0xb4, 0xff, 	/*Color of index 127*/
-  0x60, 0xa8, 0x9d, 0xff, 	/*Color of index 128*/
-  0x95, 0x97, 0x97, 0xff, 	/*Color of index 129*/
-  0x5e, 0x97, 0x9b, 0xff, 	/*Color of index 130*/
-  0x56, 0x82, 0x82, 0xff, 	/*Color of index 131*/
-  0x58, 0x82, 0x6e, 0xff, 	/*Color of index 132*/
-  0x4e, 0x73, 0x6e, 0xff, 	/*Color of index 133*/
-  0x68, 0x6c, 0x6c, 0xff, 	/*Color of index 134*/
-  0x28, 0x2a, 0x2a, 0xff, 	/*Color of index 135*/
-  0xe1, 0xe5, 0xe2, 0xff, 	/*Color of index 136*/
-  0xd5, 0xd8, 0xd5, 0xff, 	/*Color of index 137*/
-  0x72, 0xb6, 0x94, 0xff, 	/*Color of index 138*/
-  0x8b, 0xb1, 0x9a, 0xff, 	/*Color of index 139*/
-  0x75, 0xae, 0x85, 0xff, 	/*Color of index 140*/
-  0x67, 0xa1, 0x84, 0xff, 	/*Color of index 141*/
-  0x68, 0x96, 0x69, 0xff, 	/*Color of index 142*/
-  0x75, 0x78, 0x76, 0xff, 	/*Color of index 143*/
-  0x5c, 0x79, 0x59, 0xff, 	/*Color of index 144*/
-  0x5e, 0x64, 0x5f, 0xff, 	/*Color of index 145*/
-  0xf7, 0xf8, 0xf5, 0xff, 	/*Color of index 146*/
-  0xc3, 0xc4, 0xc2, 0xff, 	/*Color of index 147*/
-  0x7b, 0xac, 0x72, 0xff, 	/*Color of index 148*/
-  0x7e, 0xa5, 0x67, 0xff, 	/*Color of index 149*/
-  0x8b, 0xa8, 0x57, 0xff, 	/*Color of index 150*/
-  0x83, 0x9e, 0x59, 0xff, 	/*Color of index 151*/
-  0x85, 0x88, 0x84, 0xff, 	/*Color of index 152*/
-  0x6d, 0x8c, 0x57, 0xff, 	/*Color of index 153*/
-  0x6e, 0x7f, 0x56, 0xff, 	/*Color of index 154*/
-  0x61, 0x7b, 0x45, 0xff, 	/*Color of index 155*/
-  0x56, 0x5a, 0x54, 0xff, 	/*Color of index 156*/
-  0x13, 0x17, 0x10, 0xff, 	/*Color of index 157*/
-  0x0d, 0x16, 0x0c, 0xff, 	/*Color of index 158*/
-  0xfb, 0xfd, 0xf4, 0xff, 	/*Color of index 159*/
-  0xfd, 0xfe, 0xe9, 0xff, 	/*Color of index 160*/
-  0xfd, 0xfc, 0xd8, 0xff, 	/*Color of index 161*/
-  0xf0, 0xf1, 0xec, 0xff, 	/*Color of index 162*/
-  0xf8, 0xf5, 0xc6, 0xff, 	/*Color of index 163*/
-  0xee, 0xea, 0xb8, 0xff, 	/*Color of index 164*/
-  0xe8, 0xe3, 0xa5, 0xff, 	/*Color of index 165*/
-  0xde, 0xd9, 0xba, 0xff, 	/*Color of index 166*/
-  0xdd, 0xd6, 0x9a, 0xff, 	/*Color of index 167*/
-  0xd4, 0xcb, 0x89, 0xff, 	/*Color of index 168*/
-  0xbe, 0xbf, 0xae, 0xff, 	/*Color of index 169*/
-  0xcc, 0xc4, 0x79, 0xff, 	/*Color of index 170*/
-  0xad, 0xad, 0xa6, 0xff, 	/*Color of index 171*/
-  0xc0, 0xb8, 0x75, 0xff, 	/*Color of index 172*/
-  0xae, 0xab, 0x77, 0xff, 	/*Color of index 173*/
-  0xb8, 0xb0, 0x59, 0xff, 	/*Color of index 174*/
-  0xc1, 0xb5, 0x35, 0xff, 	/*Color of index 175*/
-  0x9a, 0xa1, 0x7e, 0xff, 	/*Color of index 176*/
-  0xcc, 0xb5, 0x21, 0xff, 	/*Color of index 177*/
-  0xc3, 0xb3, 0x24, 0xff, 	/*Color of index 178*/
-  0xbb, 0xb1, 0x2d, 0xff, 	/*Color of index 179*/
-  0xc3, 0xb1, 0x2a, 0xff, 	/*Color of index 180*/
-  0xb2, 0xb3, 0x28, 0xff, 	/*Color of index 181*/
-  0xbb, 0xb3, 0x24, 0xff, 	/*Color of index 182*/
-  0xb1, 0xad, 0x34, 0xff, 	/*Color of index 183*/
-  0xc0, 0xac, 0x31, 0xff, 	/*Color of index 184*/
-  0xb7, 0xaa, 0x3a, 0xff, 	/*Color of index 185*/
-  0x9d, 0xa9, 0x44, 0xff, 	/*Color of index 186*/
-  0xcc, 0xac, 0x29, 0xff, 	/*Color of index 187*/
-  0xae, 0xa5, 0x46, 0xff, 	/*Color of index 188*/
-  0xbe, 0xac, 0x27, 0xff, 	/*Color of index 189*/
-  0xa3, 0x9e, 0x5f, 0xff, 	/*Color of index 190*/
-  0xb4, 0xac, 0x2a, 0xff, 	/*Color of index 191*/
-  0xbb, 0xa9, 0x2f, 0xff, 	/*Color of index 192*/
-  0xbf, 0xaa, 0x2a, 0xff, 	/*Color of index 193*/
-  0xbc, 0xaa, 0x2b, 0xff, 	/*Color of index 194*/
-  0xaf, 0xa6, 0x3a, 0xff, 	/*Color of index 195*/
-  0xb9, 0xa9, 0x26, 0xff, 	/*Color of index 196*/
-  0xa8, 0xa7, 0x32, 0xff, 	/*Color of index 197*/
-  0x93, 0xa2, 0x48, 0xff, 	/*Color of index 198*/
-  0xb9, 0xa6, 0x2b, 0xff, 	/*Color of index 199*/
-  0xb1, 0xa2, 0x33, 0xff, 	/*Color of index 200*/
-  0xb4, 0xa2, 0x2a, 0xff, 	/*Color of index 201*/
-  0x85, 0x9b, 0x4e, 0xff, 	/*Color of index 202*/
-  0xb3, 0xa1, 0x25, 0xff, 	/*Color of index 203*/
-  0xa2, 0x9a, 0x41, 0xff, 	/*Color of index 204*/
-  0xab, 0x9b, 0x2c, 0xff, 	/*Color of index 205*/
-  0x97, 0x8e, 0x57, 0xff, 	/*Color of index 206*/
-  0xad, 0x9a, 0x21, 0xff, 	/*Color of index 207*/
-  0x9d, 0x93, 0x2d, 0xff, 	/*Color of index 208*/
-  0xa2, 0x93, 0x23, 0xff, 	/*Color of index 209*/
-  0x99, 0x8a, 0x40, 0xff, 	/*Color of index 210*/
-  0xa7, 0x90, 0x1e, 0xff, 	/*Color of index 211*/
-  0xa1, 0x90, 0x19, 0xff, 	/*Color of index 212*/
-  0xa0, 0x8c, 0x24, 0xff, 	/*Color of index 213*/
-  0x9f, 0x8a, 0x29, 0xff, 	/*Color of index 214*/
-  0x8d, 0x83, 0x41, 0xff, 	/*Color of index 215*/
-  0x9b, 0x88, 0x2a, 0xff, 	/*Color of index 216*/
-  0x9b, 0x89, 0x24, 0xff, 	/*Color of index 217*/
-  0x92, 0x84, 0x33, 0xff, 	/*Color of index 218*/
-  0x9a, 0x85, 0x2b, 0xff, 	/*Color of index 219*/
-  0x93, 0x85, 0x2b, 0xff, 	/*Color of index 220*/
-  0x9c, 0x8a, 0x17, 0xff, 	/*Color of index 221*/
-  0x94, 0x84, 0x23, 0xff, 	/*Color of index 222*/
-  0x72, 0x7c, 0x48, 0xff, 	/*Color of index 223*/
-  0x85, 0x7f, 0x31, 0xff, 	/*Color of index 224*/
-  0x80, 0x7a, 0x3f, 0xff, 	/*Color of index 225*/
-  0x95, 0x83, 0x15, 0xff, 	/*Color of index 226*/
-  0x84, 0x7c, 0x1f, 0xff, 	/*Color of index 227*/
-  0x7a, 0x76, 0x2f, 0xff, 	/*Color of index 228*/
-  0x6a, 0x6a, 0x3e, 0xff, 	/*Color of index 229*/
-  0x75, 0x6b, 0x2b, 0xff, 	/*Color of index 230*/
-  0x5f, 0x62, 0x2c, 0xff, 	/*Color of index 231*/
-  0x4d, 0x4f, 0x46, 0xff, 	/*Color of index 232*/
-  0x5e, 0x53, 0x26, 0xff, 	/*Color of index 233*/
-  0x3c, 0x3c, 0x39, 0xff, 	/*Color of index 234*/
-  0x47, 0x41, 0x18, 0xff, 	/*Color of index 235*/
-  0x39, 0x31, 0x12, 0xff, 	/*Color of index 236*/
-  0x23, 0x22, 0x1d, 0xff, 	/*Color of index 237*/
-  0x2b, 0x23, 0x06, 0xff, 	/*Color of index 238*/
-  0x1d, 0x16, 0x02, 0xff, 	/*Color of index 239*/
-  0x13, 0x13, 0x0d, 0xff, 	/*Color of index 240*/
-  0x01, 0x01, 0x00, 0xff, 	/*Color of index 241*/
-  0xf7, 0xf5, 0xf2, 0xff, 	/*Color of index 242*/
-  0x1d, 0x18, 0x13, 0xff, 	/*Color of index 243*/
-  0x18, 0x13, 0x12, 0xff, 	/*Color of index 244*/
-  0x20, 0x14, 0x0b, 0xff, 	/*Color of index 245*/
-  0x1b, 0x13, 0x0d, 0xff, 	/*Color of index 246*/
-  0x14, 0x0e, 0x03, 0xff, 	/*Color of index 247*/
-  0x0b, 0x09, 0x08, 0xff, 	/*Color of index 248*/
-  0x08, 0x06, 0x04, 0xff, 	/*Color of index 249*/
-  0x20, 0x11, 0x13, 0xff, 	/*Color of index 250*/
-  0x16, 0x11, 0x11, 0xff, 	/*Color of index 251*/
-  0x1a, 0x11, 0x17, 0xff, 	/*Color of index 252*/
-  0x1c, 0x0e, 0x15, 0xff, 	/*Color of index 253*/
-  0x10, 0x0d, 0x0f, 0xff, 	/*Color of index 254*/
-  0xfa, 0xf5, 0xfd, 0xff, 	/*Color of index 255*/
-
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x77, 0x77, 0x77, 0xf3, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xf3, 0x77, 0xf3, 0x77, 0x77, 0x77, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfe, 0xf7, 0xfe, 0xf0, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x06, 0x79, 0x79, 0x79, 0x79, 0x79, 0xfe, 0xfe, 0xf0, 0xfb, 0xf4, 0xf4, 0x9d, 0xf4, 0x9d, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xfb, 0x9d, 0xf3, 0x77, 0x02, 0xfe, 0x79, 0x06, 0x06, 0x78, 0x77, 0x76, 0x87, 0x71, 0x6e, 0x6e, 0x69, 0x63, 0x61, 0x57, 0x57, 0x82, 0x41, 0x82, 0x4a, 0x82, 0x4a, 0x83, 0x57, 0x63, 0x69, 0x6a, 0x6e, 0x6f, 0x71, 0x74, 0x76, 0x78, 0x05, 0x79, 0x06, 0x79, 0x04, 0x77, 0xfc, 0xfb, 0xf6, 0x9d, 0xf6, 0x9d, 0xf3, 0x9d, 0xfb, 0x9d, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xfb, 0xfb, 0xf4, 0x9d, 0xf6, 0xf0, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf4, 0xfb, 0x02, 0x77, 0x9d, 0x9d, 0x9d, 0xf5, 0xf3, 0xfa, 0xf3, 0xfa, 0xf0, 0xfb, 0x9d, 0x77, 0xf0, 0x77, 0xf9, 0x06, 0x78, 0x74, 0x71, 0x6e, 0x63, 0x61, 0x4a, 0x33, 0x1a, 0x16, 0x0f, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x0f, 0x12, 0x12, 0x28, 0x41, 0x57, 0x69, 0x6e, 0x71, 0x76, 0x78, 0x78, 0x04, 0xfe, 0x9d, 0xf3, 0x9d, 0xf0, 0xf4, 0xf0, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xfc, 0xfc, 0xfb, 0xf6, 0xf0, 0xf6, 0x9d, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf5, 0xfb, 0xf6, 0xfb, 0x77, 0x77, 0x78, 0x04, 0x06, 0x78, 0x87, 0x6f, 0x63, 0x57, 0x33, 0x1a, 0x12, 0x0d, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x0b, 0x0b, 0x0b, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0d, 0x0d, 0x1a, 0x41, 0x63, 0x6e, 0x73, 0x78, 0x06, 0x05, 0x02, 0xfc, 0xfc, 0xfc, 0xfa, 0xfa, 0xf6, 0xf4, 0xf5, 0xfa, 0xf4, 0xfa, 0xf4, 0xfb, 0xfc, 0x77, 0x77, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x9e, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0x77, 0x9d, 0x77, 0x78, 0x78, 0x76, 0x71, 0x69, 0x4a, 0x3a, 0x1a, 0x12, 0x0b, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x0b, 0x0c, 0x0c, 0x0b, 0x0b, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0b, 0x0a, 0x0c, 0x0b, 0x0b, 0x0b, 0x0a, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x16, 0x33, 0x61, 0x6f, 0x74, 0x03, 0x78, 0x04, 0xfd, 0xfc, 0xfa, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xfa, 0xf4, 0xfc, 0x02, 0x02, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xf4, 0xf0, 0xf5, 0xf5, 0xf5, 0xf5, 0xfa, 0xfc, 0x02, 0x78, 0x05, 0x79, 0x71, 0x6a, 0x57, 0x39, 0x1a, 0x16, 0x0f, 0x0b, 0x0b, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0f, 0x0c, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0c, 0x0c, 0x0c, 0x0b, 0x0c, 0x0c, 0x0c, 0x0b, 0x11, 0x0f, 0x16, 0x1a, 0x57, 0x6e, 0x76, 0x05, 0x05, 0x02, 0x77, 0xf4, 0xf6, 0xf5, 0xf5, 0xf5, 0xfa, 0xfc, 0x02, 0x02, 0xfb, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xfb, 0xf6, 0xf5, 0xf5, 0xf5, 0x77, 0x02, 0x78, 0x03, 0x74, 0x6a, 0x4a, 0x33, 0x1a, 0x12, 0x0b, 0x0a, 0x0a, 0x0c, 0x0b, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c, 0x0b, 0x0b, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0f, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x10, 0x12, 0x0b, 0x0d, 0x12, 0x57, 0x6e, 0x76, 0x03, 0x78, 0x02, 0xf4, 0xf5, 0xf5, 0xf6, 0xfd, 0xfb, 0x02, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xf4, 0xfc, 0xfd, 0xfa, 0xfd, 0xf3, 0xf0, 0x77, 0x79, 0x05, 0x74, 0x6a, 0x39, 0x33, 0x19, 0x0d, 0x0a, 0x0a, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0f, 0x0c, 0x0f, 0x0c, 0x0b, 0x0c, 0x0c, 0x0c, 0x0b, 0x10, 0x11, 0x10, 0x10, 0x13, 0x10, 0x13, 0x10, 0x13, 0x10, 0x13, 0x10, 0x13, 0x10, 0x13, 0x10, 0x10, 0x10, 0x0c, 0x10, 0x0c, 0x0c, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0b, 0x0b, 0x0c, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0c, 0x12, 0x0f, 0x12, 0x13, 0x41, 0x6d, 0x76, 0x05, 0x78, 0x9d, 0x9d, 0xf5, 0xfa, 0xf3, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfd, 0xf3, 0xfc, 0x78, 0x77, 0x05, 0x71, 0x61, 0x28, 0x16, 0x12, 0x0b, 0x0a, 0x0b, 0x0c, 0x0b, 0x0b, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x13, 0x17, 0x17, 0x21, 0x21, 0x2d, 0x21, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x26, 0x21, 0x21, 0x17, 0x17, 0x13, 0x13, 0x10, 0x11, 0x0c, 0x11, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x13, 0x16, 0x0f, 0x1f, 0x69, 0x74, 0x78, 0x78, 0x77, 0xf3, 0xf5, 0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0x04, 0x02, 0x05, 0x74, 0x69, 0x33, 0x19, 0x12, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x10, 0x11, 0x17, 0x17, 0x18, 0x21, 0x25, 0x2d, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x1c, 0x26, 0x1c, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x23, 0x1c, 0x23, 0x1c, 0x23, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x2d, 0x1c, 0x1c, 0x13, 0x18, 0x11, 0x11, 0x0f, 0x0c, 0x0f, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0b, 0x0c, 0x11, 0x16, 0x0f, 0x33, 0x69, 0x74, 0x05, 0x77, 0x77, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x9d, 0x78, 0x05, 0x6c, 0x33, 0x0f, 0x11, 0x0b, 0x0a, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x10, 0x10, 0x13, 0x18, 0x1c, 0x2c, 0x32, 0x21, 0x2a, 0x25, 0x26, 0x26, 0x29, 0x26, 0x2a, 0x29, 0x27, 0x2a, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x27, 0x23, 0x2a, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x20, 0x1e, 0x29, 0x27, 0x2a, 0x29, 0x26, 0x26, 0x2a, 0x26, 0x2d, 0x2d, 0x2c, 0x17, 0x13, 0x10, 0x11, 0x0c, 0x0b, 0x0b, 0x0b, 0x0f, 0x0a, 0x0c, 0x11, 0x11, 0x16, 0x28, 0x6e, 0x02, 0x05, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0x77, 0xf0, 0x78, 0x87, 0x57, 0x0d, 0x0f, 0x11, 0x0b, 0x0c, 0x0c, 0x0c, 0x0b, 0x10, 0x13, 0x17, 0x2d, 0x2d, 0x26, 0x2e, 0x23, 0x2e, 0x23, 0x27, 0x1e, 0x23, 0x27, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x24, 0x23, 0x24, 0x2a, 0x24, 0x2e, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x2e, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x27, 0x23, 0x23, 0x24, 0x22, 0x20, 0x29, 0x2a, 0x2d, 0x21, 0x17, 0x13, 0x11, 0x0c, 0x0a, 0x0f, 0x0c, 0x0b, 0x0c, 0x11, 0x14, 0x0d, 0x41, 0x71, 0x78, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0xfd, 0x77, 0x9e, 0x9e, 0x9d, 0xf7, 0xfa, 0xfc, 0x05, 0x05, 0x6e, 0x0f, 0x0a, 0x12, 0x0c, 0x0c, 0x10, 0x0c, 0x10, 0x13, 0x17, 0x26, 0x2d, 0x26, 0x26, 0x23, 0x23, 0x23, 0x23, 0x24, 0x2e, 0x20, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2e, 0x23, 0x2e, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x27, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x23, 0x23, 0x23, 0x24, 0x2a, 0x2a, 0x24, 0x24, 0x24, 0x29, 0x27, 0x1e, 0x26, 0x26, 0x2d, 0x2d, 0x18, 0x17, 0x10, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x16, 0x16, 0x1a, 0x61, 0x76, 0x05, 0x77, 0x02, 0xf0, 0x9d, 0xf5, 0x9d, 0xfa, 0xfc, 0xfd, 0x9d, 0x9d, 0xf0, 0x9d, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xfa, 0xfd, 0xfd, 0x9e, 0x9e, 0x9e, 0xf5, 0xf3, 0x04, 0x05, 0x74, 0x4a, 0x0b, 0x0f, 0x1b, 0x0c, 0x0c, 0x0c, 0x10, 0x18, 0x21, 0x2d, 0x26, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x23, 0x26, 0x23, 0x26, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x27, 0x23, 0x2a, 0x27, 0x2a, 0x2a, 0x2a, 0x23, 0x2a, 0x2a, 0x23, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x2d, 0x2d, 0x21, 0x17, 0x10, 0x0c, 0x0c, 0x0b, 0x11, 0x11, 0x1f, 0x33, 0x70, 0x03, 0x02, 0x9d, 0xf5, 0xf3, 0xf5, 0xfe, 0xfd, 0xf3, 0x9d, 0x9e, 0x9d, 0x9d, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfc, 0xfb, 0x77, 0x9e, 0x9d, 0xf0, 0xfe, 0x06, 0x75, 0x33, 0x0f, 0x11, 0x10, 0x0b, 0x0c, 0x10, 0x18, 0x21, 0x1c, 0x21, 0x18, 0x20, 0x23, 0x23, 0x23, 0x27, 0x23, 0x23, 0x27, 0x26, 0x23, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x27, 0x23, 0x23, 0x2a, 0x23, 0x26, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x27, 0x2a, 0x27, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x26, 0x23, 0x23, 0x23, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x1c, 0x25, 0x1c, 0x2d, 0x21, 0x21, 0x10, 0x10, 0x0c, 0x0c, 0x11, 0x12, 0x1a, 0x69, 0x06, 0x05, 0x9d, 0xf4, 0x9d, 0xf3, 0xfb, 0xfb, 0x9e, 0xf5, 0x9d, 0xf5, 0x9d, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0x9d, 0x9e, 0x9e, 0xf0, 0xfb, 0xf4, 0x78, 0x78, 0x6e, 0x0f, 0x11, 0x10, 0x0c, 0x0c, 0x18, 0x21, 0x18, 0x1c, 0x18, 0x1c, 0x1c, 0x2a, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x26, 0x2a, 0x23, 0x2a, 0x2a, 0x23, 0x23, 0x26, 0x23, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x27, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x2a, 0x27, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x29, 0x26, 0x1e, 0x1e, 0x1e, 0x26, 0x2d, 0x18, 0x1e, 0x10, 0x10, 0x10, 0x13, 0x12, 0x4a, 0x73, 0x06, 0x76, 0x9e, 0xfe, 0xee, 0xf3, 0xf6, 0xf4, 0xf6, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0x9e, 0x9e, 0xf4, 0xfb, 0x78, 0x78, 0x6a, 0x0c, 0x17, 0x10, 0x13, 0x18, 0x18, 0x25, 0x18, 0x26, 0x26, 0x23, 0x2a, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x27, 0x27, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x2a, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x2a, 0x20, 0x20, 0x29, 0x29, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x10, 0x10, 0x17, 0x0f, 0x3a, 0x71, 0x05, 0x77, 0x9d, 0x9e, 0xef, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf6, 0x9d, 0xfc, 0x78, 0x05, 0x57, 0x11, 0x10, 0x13, 0x1c, 0x20, 0x29, 0x1e, 0x20, 0x26, 0x20, 0x23, 0x23, 0x23, 0x23, 0x2e, 0x23, 0x26, 0x23, 0x23, 0x23, 0x23, 0x26, 0x23, 0x26, 0x27, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x26, 0x23, 0x26, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x27, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x23, 0x27, 0x27, 0x20, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x20, 0x27, 0x27, 0x24, 0x20, 0x23, 0x20, 0x20, 0x20, 0x20, 0x29, 0x1e, 0x22, 0x1e, 0x18, 0x14, 0x14, 0x1f, 0x6d, 0x05, 0x9d, 0xf5, 0xf3, 0xf4, 0xfb, 0xfb, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xfd, 0x04, 0x76, 0x5e, 0x0c, 0x13, 0x1e, 0x20, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x26, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x23, 0x27, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x2a, 0x20, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x27, 0x23, 0x23, 0x23, 0x24, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x20, 0x18, 0x18, 0x10, 0x1f, 0x6a, 0x06, 0xf3, 0xfd, 0xf3, 0xf4, 0xf4, 0xfb, 0xfa, 0xf4, 0xf4, 0xf4, 0x9d, 0xf4, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0x04, 0x03, 0x4a, 0x0b, 0x17, 0x1e, 0x20, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x24, 0x23, 0x24, 0x23, 0x23, 0x26, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x27, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x23, 0x2a, 0x20, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x23, 0x27, 0x24, 0x23, 0x23, 0x23, 0x23, 0x24, 0x20, 0x1e, 0x13, 0x16, 0x6c, 0x06, 0x02, 0x77, 0x02, 0xf3, 0xfe, 0xf3, 0xf4, 0xfa, 0x9d, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x04, 0x76, 0x57, 0x0c, 0x21, 0x1e, 0x20, 0x20, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x27, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x27, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x2a, 0x20, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x27, 0x23, 0x27, 0x24, 0x27, 0x27, 0x23, 0x23, 0x23, 0x24, 0x24, 0x29, 0x18, 0x17, 0x16, 0x6c, 0x03, 0x77, 0x9d, 0x02, 0xf3, 0xfe, 0xfa, 0xf4, 0xf4, 0x9d, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfe, 0x03, 0x5e, 0x11, 0x17, 0x1e, 0x20, 0x23, 0x23, 0x20, 0x22, 0x1e, 0x29, 0x27, 0x27, 0x2a, 0x20, 0x26, 0x27, 0x23, 0x23, 0x23, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x23, 0x26, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x27, 0x23, 0x27, 0x2a, 0x27, 0x2a, 0x27, 0x2a, 0x23, 0x27, 0x27, 0x27, 0x20, 0x29, 0x20, 0x29, 0x20, 0x29, 0x20, 0x29, 0x20, 0x26, 0x27, 0x26, 0x27, 0x2a, 0x20, 0x29, 0x27, 0x29, 0x27, 0x29, 0x20, 0x20, 0x23, 0x24, 0x27, 0x29, 0x2a, 0x21, 0x18, 0x1f, 0x6d, 0xf1, 0xed, 0xfe, 0x77, 0xfc, 0xf4, 0xfa, 0x9d, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x78, 0x69, 0x0b, 0x1d, 0x1e, 0x22, 0x23, 0x23, 0x23, 0x27, 0x22, 0x22, 0x20, 0x26, 0x20, 0x27, 0x26, 0x20, 0x26, 0x27, 0x26, 0x23, 0x20, 0x23, 0x26, 0x23, 0x26, 0x23, 0x26, 0x23, 0x26, 0x2a, 0x26, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2a, 0x2a, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x27, 0x23, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x27, 0x27, 0x2a, 0x1e, 0x23, 0x27, 0x27, 0x20, 0x24, 0x20, 0x27, 0x20, 0x27, 0x27, 0x29, 0x20, 0x29, 0x20, 0x29, 0x27, 0x29, 0x27, 0x29, 0x24, 0x29, 0x2b, 0x29, 0x23, 0x23, 0x27, 0x20, 0x26, 0x1c, 0x1e, 0x19, 0x6e, 0x06, 0x77, 0x02, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf6, 0xfa, 0xfd, 0x02, 0xf0, 0x9e, 0xfa, 0xf3, 0x06, 0x6f, 0x12, 0x17, 0x17, 0x1e, 0x22, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x1e, 0x20, 0x20, 0x20, 0x27, 0x20, 0x27, 0x27, 0x27, 0x20, 0x24, 0x2a, 0x2a, 0x2a, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x2a, 0x23, 0x2a, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x23, 0x2a, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x2a, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x26, 0x1c, 0x26, 0x24, 0x24, 0x2b, 0x2b, 0x2b, 0x2b, 0x24, 0x29, 0x20, 0x29, 0x29, 0x29, 0x26, 0x29, 0x26, 0x2a, 0x2a, 0x27, 0x2a, 0x2b, 0x27, 0x24, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x23, 0x18, 0x15, 0x73, 0x05, 0xfd, 0xf3, 0x9e, 0x9d, 0xf6, 0xfa, 0xfd, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9e, 0xf4, 0xfd, 0xfd, 0x02, 0x77, 0xf3, 0xf7, 0x05, 0x70, 0x28, 0x18, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x22, 0x1e, 0x1c, 0x1c, 0x1e, 0x20, 0x20, 0x20, 0x26, 0x26, 0x26, 0x26, 0x23, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x23, 0x26, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x24, 0x23, 0x27, 0x24, 0x23, 0x24, 0x24, 0x24, 0x24, 0x20, 0x1e, 0x20, 0x29, 0x24, 0x24, 0x29, 0x2a, 0x26, 0x2a, 0x2a, 0x2a, 0x2a, 0x24, 0x2a, 0x23, 0x2a, 0x27, 0x29, 0x26, 0x29, 0x27, 0x24, 0x24, 0x27, 0x21, 0x33, 0x72, 0x06, 0xf3, 0x9d, 0x9e, 0x9d, 0xf4, 0xfd, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf0, 0x77, 0xfb, 0xf4, 0xf6, 0x9d, 0x77, 0x76, 0x41, 0x14, 0x20, 0x20, 0x1e, 0x1e, 0x1e, 0x1e, 0x18, 0x1e, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x27, 0x1e, 0x26, 0x1e, 0x26, 0x23, 0x27, 0x20, 0x2a, 0x26, 0x23, 0x27, 0x27, 0x24, 0x2a, 0x24, 0x27, 0x2a, 0x27, 0x23, 0x2a, 0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x2a, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x24, 0x2b, 0x24, 0x24, 0x23, 0x26, 0x26, 0x1e, 0x26, 0x29, 0x20, 0x24, 0x2b, 0x24, 0x27, 0x27, 0x24, 0x2a, 0x27, 0x2a, 0x24, 0x24, 0x27, 0x2a, 0x27, 0x29, 0x24, 0x29, 0x24, 0x27, 0x24, 0x2a, 0x2a, 0x2d, 0x1f, 0x41, 0x03, 0x04, 0xf4, 0x9d, 0x9e, 0xfa, 0xfa, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x77, 0x77, 0xfa, 0xf4, 0x9d, 0x78, 0x5e, 0x0c, 0x21, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x21, 0x1e, 0x20, 0x20, 0x2b, 0x24, 0x20, 0x20, 0x20, 0x26, 0x1e, 0x26, 0x26, 0x26, 0x23, 0x27, 0x27, 0x24, 0x24, 0x24, 0x2b, 0x2b, 0x24, 0x24, 0x2a, 0x26, 0x26, 0x2a, 0x24, 0x2a, 0x27, 0x2a, 0x26, 0x27, 0x26, 0x27, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x27, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x24, 0x24, 0x24, 0x23, 0x25, 0x21, 0x21, 0x26, 0x26, 0x24, 0x24, 0x2b, 0x24, 0x24, 0x24, 0x27, 0x27, 0x27, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x2b, 0x24, 0x2b, 0x24, 0x29, 0x26, 0x26, 0x26, 0x26, 0x2d, 0x10, 0x69, 0x05, 0xfd, 0xfc, 0x9d, 0xf4, 0xfa, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf0, 0x77, 0xf0, 0xf5, 0xfa, 0x79, 0x6e, 0x15, 0x25, 0x18, 0x25, 0x1e, 0x21, 0x1e, 0x1e, 0x20, 0x20, 0x20, 0x24, 0x2b, 0x20, 0x25, 0x17, 0x21, 0x1d, 0x21, 0x1d, 0x21, 0x21, 0x21, 0x21, 0x23, 0x2a, 0x24, 0x24, 0x2b, 0x2e, 0x24, 0x2a, 0x1c, 0x2d, 0x21, 0x2a, 0x23, 0x24, 0x27, 0x27, 0x29, 0x27, 0x2a, 0x23, 0x2a, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x2a, 0x27, 0x2a, 0x27, 0x2a, 0x27, 0x2a, 0x27, 0x27, 0x2a, 0x27, 0x26, 0x26, 0x26, 0x26, 0x1e, 0x26, 0x20, 0x20, 0x24, 0x24, 0x26, 0x1c, 0x2d, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1c, 0x21, 0x1c, 0x2a, 0x27, 0x24, 0x24, 0x24, 0x27, 0x29, 0x25, 0x25, 0x21, 0x21, 0x2b, 0x25, 0x25, 0x1f, 0x6f, 0x05, 0xfd, 0xf4, 0xf5, 0xf5, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf3, 0x77, 0x9d, 0xfe, 0xfd, 0x76, 0x19, 0x10, 0x29, 0x29, 0x17, 0x25, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x26, 0x18, 0x17, 0x15, 0x12, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x19, 0x19, 0x1b, 0x17, 0x21, 0x2d, 0x2a, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x23, 0x2a, 0x2a, 0x24, 0x27, 0x27, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x2a, 0x27, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x2a, 0x27, 0x2a, 0x27, 0x2a, 0x27, 0x2a, 0x27, 0x2a, 0x2a, 0x25, 0x26, 0x20, 0x20, 0x2a, 0x20, 0x26, 0x25, 0x21, 0x17, 0x19, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7a, 0x7b, 0x7c, 0x7b, 0x19, 0x19, 0x15, 0x1b, 0x17, 0x1d, 0x2d, 0x25, 0x1e, 0x1e, 0x1e, 0x29, 0x2b, 0x29, 0x1e, 0x17, 0x33, 0x76, 0x03, 0xfa, 0xfa, 0x9e, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfc, 0xfb, 0x9d, 0xf3, 0x05, 0x61, 0x11, 0x2d, 0x1e, 0x2a, 0x1e, 0x1e, 0x20, 0x20, 0x20, 0x18, 0x1b, 0x12, 0x7b, 0x8a, 0x8c, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x8c, 0x8a, 0x8a, 0x7b, 0x7a, 0x19, 0x1b, 0x26, 0x2a, 0x24, 0x20, 0x2a, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x27, 0x2a, 0x23, 0x26, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x27, 0x29, 0x27, 0x29, 0x27, 0x29, 0x27, 0x29, 0x24, 0x2a, 0x20, 0x20, 0x24, 0x20, 0x20, 0x26, 0x21, 0x19, 0x7a, 0x7e, 0x8a, 0x94, 0x94, 0x95, 0x95, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x95, 0x8c, 0x8c, 0x8a, 0x7b, 0x7a, 0x15, 0x1b, 0x2d, 0x29, 0x2b, 0x2b, 0x22, 0x29, 0x29, 0x25, 0x17, 0x68, 0x05, 0xfd, 0xf5, 0x9e, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfa, 0xf6, 0xfe, 0x78, 0x70, 0x16, 0x18, 0x1c, 0x20, 0x29, 0x2b, 0x24, 0x20, 0x1e, 0x13, 0x12, 0x7b, 0x8c, 0x96, 0x96, 0xb7, 0xba, 0xb7, 0xba, 0xb7, 0xb7, 0xb7, 0xc5, 0xb7, 0xb9, 0xb7, 0xba, 0xc6, 0x96, 0x95, 0x8c, 0x8a, 0x7c, 0x19, 0x18, 0x24, 0x31, 0x2d, 0x2d, 0x26, 0x1c, 0x29, 0x2a, 0x27, 0x27, 0x23, 0x26, 0x26, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x27, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x27, 0x29, 0x27, 0x29, 0x27, 0x29, 0x27, 0x29, 0x27, 0x2a, 0x2b, 0x20, 0x20, 0x1d, 0x15, 0x7a, 0x8a, 0x95, 0x97, 0xba, 0xba, 0xaf, 0xb7, 0xb3, 0xb7, 0xb3, 0xaf, 0xb7, 0xb7, 0xb8, 0xb7, 0xba, 0xba, 0xc6, 0x95, 0x94, 0x80, 0x7a, 0x10, 0x25, 0x2b, 0x22, 0x24, 0x20, 0x29, 0x1e, 0x25, 0x1b, 0x75, 0x03, 0xf3, 0x9d, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xf3, 0x78, 0x77, 0x33, 0x17, 0x26, 0x23, 0x29, 0x1e, 0x20, 0x1e, 0x13, 0x7a, 0x7b, 0x95, 0x97, 0xba, 0xb7, 0xb4, 0xb6, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb2, 0xb1, 0xb2, 0xb2, 0xbd, 0xb4, 0xb3, 0xc4, 0xb7, 0xc5, 0x97, 0x97, 0x80, 0x7e, 0x28, 0x15, 0x21, 0x21, 0x2d, 0x26, 0x26, 0x20, 0x27, 0x2a, 0x2a, 0x26, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x2a, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x29, 0x29, 0x27, 0x27, 0x29, 0x27, 0x29, 0x27, 0x29, 0x27, 0x1e, 0x21, 0x1d, 0x7a, 0x7e, 0x94, 0xca, 0xc6, 0xc5, 0xb3, 0xb3, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xbd, 0xb4, 0xb3, 0xb8, 0xba, 0xba, 0x8e, 0x8c, 0x7a, 0x15, 0x1d, 0x26, 0x1e, 0x20, 0x22, 0x1e, 0x13, 0x57, 0x78, 0xfe, 0xf3, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf3, 0x78, 0x6a, 0x13, 0x1e, 0x2e, 0x2e, 0x18, 0x1e, 0x21, 0x15, 0x7a, 0x8a, 0x95, 0xba, 0xb7, 0xb3, 0xb3, 0xaf, 0xb6, 0xb3, 0xb4, 0xb6, 0xb4, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb8, 0xb3, 0xbd, 0xb3, 0xb3, 0xba, 0xc6, 0x95, 0x8c, 0x7e, 0x1f, 0x21, 0x21, 0x2d, 0x2a, 0x26, 0x27, 0x27, 0x23, 0x2a, 0x2a, 0x2a, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x23, 0x2a, 0x2a, 0x23, 0x2a, 0x27, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x23, 0x27, 0x27, 0x27, 0x29, 0x27, 0x27, 0x29, 0x27, 0x29, 0x24, 0x24, 0x25, 0x19, 0x7b, 0x8c, 0x97, 0xba, 0xb3, 0xb1, 0xb1, 0xb4, 0xb4, 0xb3, 0xb3, 0xb3, 0xb6, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xbd, 0xb3, 0xb4, 0xb4, 0xbb, 0xb1, 0xc0, 0xb7, 0x97, 0x95, 0x7d, 0x7a, 0x18, 0x26, 0x22, 0x1e, 0x1e, 0x21, 0x13, 0x71, 0x78, 0xf6, 0xfa, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0x9d, 0x9e, 0xfe, 0x74, 0x2f, 0x1d, 0x1e, 0x29, 0x1c, 0x29, 0x1d, 0x12, 0x7d, 0x94, 0xc6, 0xc3, 0xb3, 0xb4, 0xb2, 0xaf, 0xb4, 0xb3, 0xb5, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb8, 0xb8, 0xb7, 0xb7, 0xb3, 0xb4, 0xb2, 0xb2, 0xb2, 0xb7, 0xb7, 0xba, 0xc6, 0x80, 0x7f, 0x19, 0x21, 0x26, 0x20, 0x29, 0x26, 0x26, 0x2a, 0x23, 0x23, 0x26, 0x2a, 0x23, 0x23, 0x2a, 0x24, 0x24, 0x23, 0x2a, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x27, 0x24, 0x29, 0x25, 0x25, 0x29, 0x24, 0x2b, 0x24, 0x21, 0x1b, 0x7b, 0x8c, 0x97, 0xc6, 0xb7, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xaf, 0xb6, 0xb3, 0xb5, 0xb3, 0xb5, 0xaf, 0xb7, 0xb3, 0xb2, 0xb1, 0xb1, 0xb1, 0xb4, 0xb3, 0xba, 0xba, 0x8c, 0x7a, 0x15, 0x1e, 0x22, 0x24, 0x26, 0x1d, 0x41, 0x05, 0xfc, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x9d, 0xf4, 0x9d, 0xf5, 0xf6, 0x78, 0x6c, 0x10, 0x25, 0x1e, 0x1d, 0x17, 0x1d, 0x15, 0x8a, 0xae, 0xba, 0xb3, 0xaf, 0xb1, 0xb4, 0xaf, 0xb2, 0xb1, 0xb2, 0xb4, 0xb3, 0xb6, 0xb4, 0xb4, 0xb3, 0xb4, 0xb8, 0xb3, 0xb8, 0xb3, 0xb3, 0xb3, 0xb4, 0xb6, 0xb6, 0xb6, 0xb5, 0xb3, 0xb3, 0xb7, 0xba, 0x94, 0x7e, 0x1b, 0x17, 0x29, 0x25, 0x21, 0x26, 0x23, 0x2a, 0x26, 0x1c, 0x26, 0x20, 0x27, 0x24, 0x24, 0x24, 0x23, 0x26, 0x27, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x24, 0x2b, 0x2b, 0x25, 0x1d, 0x1e, 0x2b, 0x31, 0x26, 0x19, 0x7e, 0x96, 0xb7, 0xc5, 0xb5, 0xb3, 0xb6, 0xb2, 0xb1, 0xb1, 0xb6, 0xb2, 0xb6, 0xb4, 0xb3, 0xb2, 0xb6, 0xb2, 0xb4, 0xb2, 0xb6, 0xb4, 0xb6, 0xb3, 0xb4, 0xb3, 0xb2, 0xb6, 0xb2, 0xb6, 0xb3, 0xb8, 0xb8, 0xbc, 0x8c, 0x7b, 0x15, 0x22, 0x24, 0x24, 0x18, 0x1b, 0x71, 0x05, 0xfc, 0xfc, 0x9d, 0x9d, 0x9d, 0xfb, 0xfc, 0xfd, 0xfc, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf6, 0xf4, 0xfe, 0x74, 0x39, 0x17, 0x26, 0x1c, 0x22, 0x15, 0x15, 0x80, 0x96, 0xba, 0xb7, 0xaf, 0xb1, 0xb4, 0xb4, 0xb3, 0xb3, 0xaf, 0xb4, 0xb3, 0xb8, 0xb3, 0xb3, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xb5, 0xb2, 0xb5, 0xb2, 0xb6, 0xb4, 0xb3, 0xaf, 0xb8, 0xb7, 0xb9, 0xc6, 0x95, 0x80, 0x7c, 0x1b, 0x21, 0x26, 0x23, 0x23, 0x23, 0x20, 0x27, 0x26, 0x26, 0x24, 0x24, 0x24, 0x24, 0x27, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x24, 0x2b, 0x24, 0x23, 0x2e, 0x2a, 0x29, 0x17, 0x7a, 0x8c, 0x96, 0xb7, 0xb5, 0xb5, 0xb5, 0xb6, 0xb6, 0xb2, 0xb6, 0xb4, 0xb4, 0xb3, 0xb8, 0xb4, 0xb4, 0xb4, 0xb8, 0xb3, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4, 0xb3, 0xb3, 0xb4, 0xb3, 0xb3, 0xb4, 0xb8, 0xb9, 0xca, 0x94, 0x7a, 0x15, 0x26, 0x20, 0x25, 0x10, 0x5e, 0x78, 0x02, 0xfc, 0x9d, 0x9e, 0x9d, 0xf4, 0xfc, 0xfc, 0xfd, 0x9d, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0x05, 0x69, 0x15, 0x2d, 0x1c, 0x23, 0x1e, 0x7c, 0x8a, 0x97, 0xba, 0xaf, 0xaf, 0xb2, 0xb2, 0xb4, 0xb3, 0xb7, 0xb3, 0xb5, 0xb3, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4, 0xb4, 0xb2, 0xb2, 0xb2, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xb4, 0xb8, 0xaf, 0xb8, 0xaf, 0xb9, 0xba, 0x96, 0x94, 0x7f, 0x19, 0x18, 0x2e, 0x2e, 0x20, 0x24, 0x27, 0x24, 0x23, 0x27, 0x23, 0x27, 0x27, 0x20, 0x23, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x27, 0x23, 0x23, 0x2e, 0x2e, 0x23, 0x15, 0x7d, 0x94, 0xba, 0xb5, 0xb5, 0xb6, 0xb6, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb8, 0xb4, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb3, 0xb4, 0xb3, 0xb4, 0xb6, 0xb8, 0xbc, 0x96, 0x94, 0x7a, 0x19, 0x1e, 0x29, 0x1d, 0x28, 0x71, 0x79, 0xf4, 0x9d, 0x9d, 0xf5, 0xf4, 0xfc, 0xfd, 0xfc, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x02, 0x02, 0x03, 0x7c, 0x1d, 0x2d, 0x23, 0x1c, 0x1d, 0x7d, 0x97, 0xb9, 0xb3, 0xb4, 0xb4, 0xb2, 0xb4, 0xb4, 0xb7, 0xb3, 0xb7, 0xb3, 0xb3, 0xb8, 0xb8, 0xb4, 0xb8, 0xb4, 0xb4, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb2, 0xb4, 0xb4, 0xaf, 0xb8, 0xaf, 0xb2, 0xaf, 0xb1, 0xb9, 0xbc, 0x94, 0x7f, 0x15, 0x18, 0x2e, 0x2b, 0x24, 0x24, 0x24, 0x27, 0x26, 0x1e, 0x23, 0x26, 0x20, 0x27, 0x27, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x29, 0x21, 0x2a, 0x24, 0x20, 0x17, 0x7d, 0x94, 0xb7, 0xb5, 0xb6, 0xb2, 0xb4, 0xb4, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb6, 0xb2, 0xb6, 0xb1, 0xb6, 0xb2, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb3, 0xb4, 0xb6, 0xb1, 0xb4, 0xbb, 0xc3, 0xc6, 0x8a, 0x7a, 0x2d, 0x22, 0x22, 0x15, 0x69, 0x79, 0x77, 0xf3, 0x9d, 0xf5, 0xf6, 0xfc, 0xfc, 0xf4, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x77, 0xf4, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0x05, 0x6e, 0x10, 0x25, 0x20, 0x2d, 0x1b, 0x7d, 0x95, 0xb7, 0xb2, 0xb1, 0xb4, 0xbd, 0xb4, 0xb4, 0xb3, 0xb3, 0xb8, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb8, 0xb3, 0xb8, 0xb3, 0xb3, 0xb3, 0xb4, 0xb3, 0xb8, 0xaf, 0xb8, 0xb4, 0xaf, 0xb2, 0xaf, 0xb2, 0xaf, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xaf, 0xbc, 0x95, 0x8b, 0x1b, 0x17, 0x29, 0x24, 0x24, 0x24, 0x24, 0x26, 0x26, 0x21, 0x26, 0x20, 0x27, 0x24, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x15, 0x7d, 0x95, 0xb7, 0xb8, 0xb1, 0xb4, 0xb3, 0xbb, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb1, 0xb6, 0xb1, 0xb6, 0xb2, 0xb4, 0xb8, 0xb8, 0xbb, 0xb4, 0xb4, 0xb2, 0xb6, 0xb1, 0xbb, 0xb2, 0xaf, 0xca, 0x7e, 0x12, 0x22, 0x29, 0x17, 0x28, 0x76, 0x9e, 0x77, 0xef, 0xf3, 0xf6, 0xfa, 0x02, 0xf4, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x9d, 0x77, 0xfb, 0x9d, 0xf6, 0xf3, 0xf4, 0xfe, 0xfc, 0x02, 0x78, 0x57, 0x13, 0x2b, 0x1e, 0x21, 0x7a, 0x94, 0xba, 0xb4, 0xb1, 0xbb, 0xb4, 0xb4, 0xb3, 0xb8, 0xb3, 0xb3, 0xb2, 0xb4, 0xb4, 0xb2, 0xb6, 0xaf, 0xb3, 0xb3, 0xb8, 0xc5, 0xc3, 0xc8, 0xc8, 0xc8, 0xc3, 0xcc, 0xc8, 0xc8, 0xb9, 0xb8, 0xaf, 0xb2, 0xaf, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xaf, 0xb4, 0xaf, 0xba, 0x95, 0x7e, 0x15, 0x2d, 0x26, 0x2a, 0x2b, 0x2a, 0x20, 0x26, 0x25, 0x26, 0x27, 0x24, 0x24, 0x27, 0x24, 0x27, 0x24, 0x27, 0x24, 0x27, 0x24, 0x27, 0x20, 0x29, 0x25, 0x15, 0x7d, 0x94, 0xba, 0xb8, 0xb1, 0xb4, 0xb4, 0xb3, 0xb4, 0xb4, 0xb4, 0xb3, 0xb4, 0xb7, 0xbf, 0xc5, 0xc9, 0xc9, 0xc5, 0xc8, 0xc5, 0xc9, 0xc5, 0xc7, 0xbf, 0xb6, 0xb5, 0xb1, 0xb6, 0xb1, 0xb6, 0xb2, 0xb4, 0xb4, 0xb8, 0xb4, 0xb4, 0xb2, 0xb2, 0xb2, 0xb1, 0xb2, 0xb5, 0xc6, 0x95, 0x7a, 0x25, 0x22, 0x25, 0x13, 0x6f, 0x79, 0x9d, 0xf3, 0xf5, 0xf6, 0xf4, 0xfc, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0x02, 0x02, 0x05, 0x71, 0x28, 0x2a, 0x27, 0x29, 0x7c, 0x8c, 0xba, 0xb4, 0xb4, 0xb1, 0xb3, 0xb8, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb3, 0xbf, 0xc5, 0xc3, 0xae, 0xae, 0xac, 0xaa, 0xa8, 0xa7, 0xa8, 0xa8, 0xa8, 0xac, 0xae, 0xae, 0xc3, 0xb9, 0xaf, 0xaf, 0xaf, 0xb6, 0xaf, 0xb3, 0xaf, 0xb4, 0xb1, 0xb1, 0xb9, 0x95, 0x7d, 0x7a, 0x1d, 0x2d, 0x29, 0x24, 0x2b, 0x26, 0x21, 0x26, 0x29, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x2b, 0x21, 0x7d, 0x94, 0xb5, 0xb5, 0xb1, 0xb1, 0xb2, 0xb4, 0xb2, 0xb6, 0xb6, 0xb5, 0xb7, 0xc3, 0xbc, 0xae, 0xac, 0xa8, 0xa8, 0xa7, 0xa7, 0xa7, 0xa7, 0xa8, 0xaa, 0xae, 0xbc, 0xbc, 0xc5, 0xb7, 0xb5, 0xaf, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb2, 0xb2, 0xb6, 0xb7, 0x97, 0x8d, 0x15, 0x2d, 0x2d, 0x14, 0x61, 0x77, 0x77, 0xf4, 0xf5, 0xfa, 0xf4, 0x77, 0xfc, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x77, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0x02, 0x02, 0x06, 0x69, 0x14, 0x2d, 0x1e, 0x1b, 0x7d, 0x96, 0xb8, 0xb4, 0xb1, 0xaf, 0xb3, 0xb8, 0xb7, 0xb8, 0xb7, 0xb4, 0xb4, 0xbb, 0xb8, 0xb9, 0xc3, 0xc5, 0xae, 0xaa, 0xa5, 0xa4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa0, 0xa1, 0xa1, 0xa3, 0xa4, 0xa5, 0xaa, 0xae, 0xba, 0xba, 0xaf, 0xaf, 0xae, 0xb7, 0xaf, 0xb1, 0xb1, 0xaf, 0xba, 0x94, 0x7b, 0x19, 0x1d, 0x26, 0x24, 0x2b, 0x27, 0x25, 0x26, 0x26, 0x2b, 0x24, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x23, 0x28, 0x8c, 0xbc, 0xb2, 0xb1, 0xb1, 0xb5, 0xb5, 0xb2, 0xaf, 0xb5, 0xb7, 0xb7, 0xaa, 0xa7, 0xa3, 0xa3, 0xa1, 0xa0, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa0, 0xa0, 0xa1, 0xa3, 0xa5, 0xa8, 0xae, 0xba, 0xc3, 0xb7, 0xb8, 0xaf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb3, 0xb6, 0xb6, 0xb8, 0xbc, 0x97, 0x7d, 0x15, 0x21, 0x1c, 0x39, 0x74, 0x78, 0xfc, 0xfa, 0xfa, 0xf4, 0x02, 0x77, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0xf4, 0xf6, 0xf3, 0xf6, 0xf4, 0x02, 0x78, 0x05, 0x48, 0x2e, 0x1e, 0x1d, 0x7a, 0x95, 0xba, 0xb5, 0xb1, 0xaf, 0xb8, 0xb4, 0xb3, 0xb7, 0xb7, 0xb3, 0xb4, 0xb4, 0xb8, 0xc3, 0xbc, 0xad, 0xa7, 0xa3, 0xa1, 0xa0, 0xa0, 0xa0, 0xf2, 0x9f, 0x9f, 0x9f, 0x9f, 0xa0, 0x9f, 0x9f, 0xa0, 0x9f, 0xa0, 0xa0, 0xa1, 0xa5, 0xac, 0xae, 0xbc, 0xb9, 0xaf, 0xaf, 0xb1, 0xb1, 0xaf, 0xaf, 0xc3, 0x94, 0x7b, 0x1b, 0x2d, 0x2b, 0x2b, 0x24, 0x26, 0x1e, 0x29, 0x24, 0x24, 0x20, 0x29, 0x20, 0x24, 0x20, 0x29, 0x20, 0x24, 0x24, 0x1e, 0x7a, 0x8c, 0xbe, 0xaf, 0xb1, 0xb1, 0xb1, 0xb5, 0xaf, 0xbf, 0xc3, 0xae, 0xa5, 0xa3, 0xa1, 0xa0, 0xa0, 0x9f, 0x9f, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0xa0, 0xa0, 0xa4, 0xaa, 0xbc, 0xbc, 0xc0, 0xb8, 0xb4, 0xb4, 0xbb, 0xb3, 0xb8, 0xb3, 0xb3, 0xb4, 0xb4, 0xb8, 0xbc, 0x94, 0x7a, 0x1b, 0x26, 0x16, 0x6e, 0x05, 0x02, 0xfa, 0xf4, 0xfc, 0x77, 0x77, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0xf4, 0xf6, 0xf5, 0xfb, 0xf3, 0x77, 0x05, 0x74, 0x2c, 0x2e, 0x22, 0x7c, 0x8a, 0x96, 0xb7, 0xaf, 0xb5, 0xb3, 0xbb, 0xb4, 0xb4, 0xb3, 0xb3, 0xb3, 0xbd, 0xb4, 0xc8, 0xae, 0xa8, 0xa1, 0xa0, 0x9f, 0x9f, 0xff, 0x00, 0xff, 0xff, 0x00, 0x07, 0x07, 0x92, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x9f, 0x00, 0xa0, 0xa4, 0xaa, 0xae, 0xaf, 0xb4, 0xaf, 0xaf, 0xaf, 0xb8, 0xaf, 0xc6, 0x8a, 0x19, 0x21, 0x2b, 0x2b, 0x24, 0x29, 0x26, 0x29, 0x24, 0x24, 0x27, 0x24, 0x20, 0x29, 0x24, 0x20, 0x24, 0x24, 0x20, 0x25, 0xaa, 0x96, 0xaf, 0xb6, 0xb1, 0xb1, 0xb1, 0xb9, 0xc3, 0xae, 0xa7, 0xa1, 0x9f, 0x9f, 0x9f, 0x00, 0x9f, 0x9f, 0x9f, 0x92, 0x9f, 0xa0, 0x9f, 0x92, 0x92, 0x92, 0x07, 0xf2, 0x00, 0x9f, 0x9f, 0x9f, 0xa0, 0xa0, 0xa4, 0xaa, 0xbc, 0xc0, 0xbb, 0xb4, 0xb4, 0xb4, 0xb8, 0xb8, 0xb8, 0xb4, 0xbb, 0xbb, 0xb9, 0xc6, 0x7d, 0x15, 0x2d, 0x17, 0x5a, 0x05, 0x02, 0xfd, 0xfd, 0x77, 0x77, 0x9d, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xfa, 0xf4, 0xf4, 0x9d, 0xf6, 0xfb, 0xfc, 0x78, 0x6f, 0x14, 0x31, 0x1d, 0x7a, 0x94, 0xb9, 0xb3, 0xb6, 0xaf, 0xb3, 0xb7, 0xb2, 0xb4, 0xb4, 0xc2, 0xb8, 0xb9, 0xcc, 0xaa, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0xff, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x9f, 0x00, 0xa0, 0xa0, 0xa4, 0xae, 0xb9, 0xaf, 0xaf, 0xaf, 0xaf, 0xbb, 0xaf, 0x96, 0x7d, 0x15, 0x2a, 0x2b, 0x29, 0x20, 0x29, 0x24, 0x29, 0x20, 0x29, 0x23, 0x24, 0x20, 0x29, 0x24, 0x2b, 0x29, 0x1b, 0x7b, 0xba, 0xb5, 0xaf, 0xb5, 0xb1, 0xaf, 0xc3, 0xbc, 0xa7, 0xa1, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x92, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x9f, 0x9f, 0xa0, 0x9f, 0xa1, 0xa4, 0xae, 0xcc, 0xb8, 0xb3, 0xb1, 0xb2, 0xb3, 0xb4, 0xb4, 0xbb, 0xbb, 0xbb, 0xc5, 0x94, 0x7a, 0x18, 0x18, 0x3a, 0x76, 0x9e, 0xfd, 0xf4, 0x77, 0x9e, 0x9d, 0xf6, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xfc, 0xf4, 0xf4, 0x9d, 0xf6, 0xfa, 0x02, 0x05, 0x5e, 0x18, 0x32, 0x15, 0x7d, 0x96, 0xb7, 0xb2, 0xb4, 0xbb, 0xb7, 0xb5, 0xb5, 0xb2, 0xb8, 0xaf, 0xc3, 0xbc, 0xa8, 0xa0, 0x9f, 0x00, 0x07, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x9f, 0xa1, 0xa5, 0xae, 0xb9, 0xaf, 0xaf, 0xaf, 0xb2, 0xb6, 0x94, 0x7a, 0x21, 0x2d, 0x29, 0x2b, 0x2b, 0x24, 0x29, 0x1e, 0x23, 0x23, 0x24, 0x22, 0x20, 0x2b, 0x2b, 0x1e, 0x7a, 0x94, 0xaf, 0xb1, 0xaf, 0xaf, 0xaf, 0xcc, 0xaa, 0xa3, 0xa0, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa3, 0xa8, 0xbc, 0xb8, 0xb2, 0xb2, 0xaf, 0xb4, 0xb4, 0xb8, 0xb8, 0xb4, 0xb7, 0xba, 0x7d, 0x18, 0x2c, 0x1b, 0x71, 0x9e, 0xf5, 0xfc, 0x77, 0x9e, 0xef, 0xfa, 0xfd, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xf4, 0xfc, 0x9d, 0x9d, 0xf0, 0xfa, 0x04, 0x76, 0x4a, 0x1c, 0x2a, 0x7c, 0x8a, 0xba, 0xb7, 0xb6, 0xaf, 0xbb, 0xaf, 0xb5, 0xb5, 0xb4, 0xaf, 0xcd, 0xbc, 0xa5, 0xa1, 0xa0, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x92, 0x9f, 0xf2, 0xa1, 0xa0, 0xa4, 0xac, 0xc0, 0xaf, 0xb1, 0xaf, 0xaf, 0x96, 0x8a, 0x1b, 0x21, 0x29, 0x22, 0x2b, 0x24, 0x29, 0x26, 0x27, 0x24, 0x2b, 0x22, 0x20, 0x2b, 0x2e, 0x15, 0x8a, 0x96, 0xaf, 0xb6, 0xaf, 0xb3, 0xcc, 0xa5, 0xa3, 0xa0, 0x9f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x9f, 0x00, 0x9f, 0x07, 0x00, 0x9f, 0x9f, 0xa1, 0xa8, 0xcc, 0xb8, 0xaf, 0xb4, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4, 0xbd, 0xba, 0x8c, 0x1b, 0x2c, 0x13, 0x6a, 0x9e, 0xfe, 0xfc, 0x77, 0x9e, 0xef, 0xfa, 0x02, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfa, 0xf4, 0xf0, 0xf3, 0xfa, 0x05, 0x71, 0x28, 0x2e, 0x1c, 0x7d, 0x94, 0xc5, 0xb3, 0xb5, 0xb8, 0xb3, 0xb2, 0xb6, 0xb2, 0xb3, 0xc8, 0xae, 0xa4, 0xa0, 0xa0, 0x9f, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x92, 0x00, 0x00, 0x00, 0x07, 0xa0, 0xa1, 0xa8, 0xb7, 0xaf, 0xb1, 0xaf, 0xaf, 0x96, 0x7e, 0x15, 0x29, 0x2b, 0x2b, 0x29, 0x29, 0x23, 0x20, 0x2b, 0x22, 0x22, 0x20, 0x24, 0x18, 0x7b, 0x94, 0xaf, 0xb1, 0xaf, 0xb7, 0xae, 0xa5, 0xa1, 0xa0, 0x9f, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x07, 0x00, 0xff, 0xff, 0x9f, 0xa0, 0xa0, 0xa7, 0xbe, 0xc3, 0xaf, 0xb2, 0xb4, 0xb4, 0xb3, 0xbd, 0xb4, 0xba, 0x95, 0x7b, 0x1f, 0x17, 0x82, 0x78, 0xfd, 0xfc, 0xfb, 0x9e, 0xf5, 0xf0, 0xfc, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfa, 0xf4, 0x9d, 0x9d, 0xfb, 0x06, 0x6c, 0x1b, 0x32, 0x1d, 0x7e, 0xba, 0xb3, 0xb3, 0xb7, 0xaf, 0xb3, 0xb2, 0xb1, 0xb5, 0xc8, 0xbc, 0xa4, 0xa0, 0x9f, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0xff, 0xff, 0xff, 0x00, 0xa0, 0xa1, 0xa8, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0x94, 0x7a, 0x1e, 0x24, 0x2b, 0x1e, 0x2b, 0x23, 0x24, 0x22, 0x22, 0x22, 0x29, 0x1e, 0x1f, 0x8b, 0xba, 0xaf, 0xaf, 0xbf, 0xbc, 0xa4, 0xa1, 0x9f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x9f, 0xa0, 0xa0, 0xa7, 0xcc, 0xb8, 0xb4, 0xb2, 0xb3, 0xb3, 0xb4, 0xbd, 0xb7, 0x97, 0x8a, 0x1b, 0x21, 0x39, 0x74, 0x04, 0xfd, 0xfd, 0x9d, 0xf6, 0xf4, 0x77, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfa, 0x9d, 0x9d, 0x9d, 0x04, 0x05, 0x5e, 0x1b, 0x2e, 0x19, 0x8c, 0xc5, 0xb2, 0xb5, 0xb7, 0xb7, 0xb3, 0xb2, 0xb2, 0xb9, 0xc3, 0xa4, 0xa1, 0x9f, 0x07, 0xff, 0xff, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x9f, 0x00, 0x07, 0xff, 0x08, 0xff, 0x9f, 0xa0, 0xa1, 0xa7, 0xbc, 0xaf, 0xb1, 0xaf, 0xba, 0x7d, 0x1b, 0x29, 0x29, 0x29, 0x22, 0x23, 0x2b, 0x22, 0x22, 0x1e, 0x22, 0x17, 0x7d, 0xb0, 0xaf, 0xb1, 0xb9, 0xae, 0xa3, 0xa0, 0x9f, 0x07, 0xff, 0xff, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9f, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x07, 0x00, 0x07, 0x07, 0x07, 0x00, 0x9f, 0xa0, 0xa0, 0xa7, 0xc8, 0xaf, 0xb4, 0xb5, 0xb3, 0xb4, 0xb4, 0xc1, 0xba, 0x96, 0x28, 0x1b, 0x1b, 0x6e, 0x05, 0xfd, 0xfa, 0xf4, 0xf6, 0x77, 0x9d, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfa, 0xf4, 0x9e, 0x9d, 0x77, 0x05, 0x4a, 0x18, 0x2d, 0x7c, 0x96, 0xb8, 0xb1, 0xb6, 0xb7, 0xb3, 0xb3, 0xb2, 0xb8, 0xc3, 0xa8, 0xa1, 0xa0, 0x00, 0x07, 0xff, 0x07, 0x00, 0x9f, 0x9f, 0xf2, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x9f, 0x9f, 0xf2, 0xa7, 0xbc, 0xb1, 0xb1, 0xaf, 0x8c, 0x7a, 0x21, 0x1e, 0x29, 0x22, 0x24, 0x20, 0x22, 0x22, 0x22, 0x1d, 0x15, 0x8c, 0xbe, 0xaf, 0xaf, 0xbc, 0xa4, 0xa1, 0x9f, 0x00, 0x07, 0xff, 0x07, 0x00, 0x9f, 0x9f, 0x00, 0x92, 0x00, 0x00, 0x92, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x92, 0x9f, 0x9f, 0x00, 0x00, 0x07, 0x07, 0x00, 0x9f, 0x9f, 0x9f, 0xa1, 0xaa, 0xc8, 0xb8, 0xaf, 0xb3, 0xbf, 0xb4, 0xbb, 0xc5, 0x96, 0x7b, 0x1b, 0x15, 0x69, 0x06, 0xfd, 0xfa, 0xf6, 0xf4, 0x9d, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0x9d, 0x9e, 0x77, 0x02, 0x76, 0x3a, 0x2d, 0x1d, 0x7d, 0xbc, 0xb2, 0xb1, 0xbf, 0xb7, 0xb3, 0xb6, 0xaf, 0xc8, 0xac, 0xa1, 0xa0, 0x9f, 0x07, 0xff, 0x07, 0x07, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x00, 0xf2, 0xff, 0xff, 0xf2, 0xa8, 0xb8, 0xaf, 0xaf, 0x96, 0x8a, 0x19, 0x21, 0x22, 0x22, 0x22, 0x2b, 0x22, 0x22, 0x1e, 0x1b, 0x7d, 0x96, 0xae, 0xb9, 0xbc, 0xa6, 0xa0, 0x9f, 0x00, 0x07, 0x07, 0x07, 0x00, 0x9f, 0xa0, 0x9f, 0x00, 0x00, 0x07, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0xa3, 0xbc, 0xb7, 0xb3, 0xaf, 0xc1, 0xb4, 0xbb, 0xc4, 0xba, 0x8a, 0x1b, 0x15, 0x57, 0x05, 0xfa, 0xf5, 0xf4, 0xfc, 0xf4, 0x9d, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xf4, 0xf4, 0x9d, 0x9e, 0x9e, 0x04, 0x75, 0x2f, 0x26, 0x1b, 0x8a, 0xc3, 0xb4, 0xb1, 0xb5, 0xb3, 0xb2, 0xb2, 0xc0, 0xcc, 0xa4, 0xa0, 0xa0, 0x9f, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x98, 0x91, 0xe8, 0xe8, 0x9c, 0x86, 0x81, 0x93, 0xf2, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x9f, 0x00, 0x9f, 0x9f, 0x92, 0x00, 0x00, 0xff, 0x9f, 0xa1, 0xaa, 0xb8, 0xaf, 0xaf, 0x94, 0x7a, 0x1d, 0x22, 0x22, 0x22, 0x22, 0x20, 0x24, 0x25, 0x19, 0x8a, 0xba, 0xaf, 0xbc, 0xa7, 0x9f, 0x92, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xab, 0x8f, 0x9c, 0xe8, 0xea, 0xe8, 0x9c, 0x81, 0x89, 0x00, 0x00, 0x00, 0x92, 0x92, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0xa7, 0xb9, 0xaf, 0xb7, 0xb3, 0xbb, 0xb4, 0xc2, 0xc5, 0x8d, 0x19, 0x15, 0x39, 0x76, 0xf6, 0xf5, 0xfc, 0xfc, 0xf4, 0x9d, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x77, 0xf4, 0xf4, 0x9d, 0x9d, 0x77, 0x79, 0x70, 0x1f, 0x26, 0x7c, 0x8c, 0xc8, 0xb1, 0xb5, 0xb7, 0xb3, 0xb1, 0xb1, 0xc8, 0xac, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xe8, 0xf8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x9d, 0xea, 0x81, 0x88, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xff, 0x00, 0x92, 0x07, 0x9f, 0x9f, 0x9f, 0x9f, 0xa3, 0xae, 0xaf, 0xaf, 0x96, 0x7e, 0x1b, 0x22, 0x22, 0x22, 0x22, 0x2a, 0x23, 0x25, 0x7a, 0x94, 0xaf, 0xaf, 0xaa, 0x9f, 0x92, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x91, 0xf3, 0x79, 0x79, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xfb, 0x91, 0x89, 0x00, 0x00, 0x92, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xff, 0x00, 0xa3, 0xae, 0xbf, 0xb3, 0xb8, 0xbb, 0xbb, 0xb3, 0xc5, 0x8d, 0x7a, 0x1b, 0x1b, 0x74, 0xf0, 0xf5, 0xfc, 0x02, 0xfc, 0xf5, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xf4, 0xf4, 0x9d, 0x9e, 0x9d, 0x05, 0x6e, 0x1f, 0x26, 0x7c, 0x94, 0xc0, 0xb1, 0xb5, 0xb3, 0xaf, 0xb1, 0xb2, 0xbc, 0xa4, 0x00, 0x00, 0x00, 0x92, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x9c, 0xf1, 0x06, 0xea, 0x98, 0xab, 0x89, 0xa9, 0x81, 0x9c, 0xf4, 0xf8, 0xf1, 0xf1, 0xfe, 0x86, 0x89, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0x9f, 0x9f, 0xa0, 0xa0, 0x92, 0xa0, 0xa4, 0xb7, 0xaf, 0xaf, 0x8c, 0x19, 0x22, 0x22, 0x22, 0x22, 0x23, 0x2a, 0x21, 0x7d, 0x96, 0xaf, 0xae, 0xa1, 0x92, 0x07, 0x00, 0x92, 0x9f, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x93, 0x87, 0x79, 0xf1, 0xf1, 0xfe, 0xf8, 0xea, 0x81, 0x93, 0x89, 0xa9, 0x98, 0x87, 0xf1, 0xf9, 0x86, 0x92, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa0, 0xa5, 0xc4, 0xb7, 0xb4, 0xbb, 0xbb, 0xb3, 0xb7, 0x95, 0x7b, 0x1b, 0x1b, 0x6f, 0xf7, 0xf5, 0xf4, 0x02, 0xfa, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xfa, 0xf4, 0x9d, 0x77, 0x9d, 0xf5, 0x05, 0x6c, 0x17, 0x1b, 0x7e, 0x96, 0xb5, 0xb6, 0xbd, 0xb4, 0xb2, 0xb1, 0xc3, 0xaa, 0xa1, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x89, 0xea, 0xf1, 0xea, 0xab, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x91, 0xf0, 0xfe, 0xfb, 0xf1, 0xf1, 0xed, 0xab, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x00, 0xa0, 0xa0, 0xa8, 0xbc, 0xaf, 0x94, 0x7a, 0x1e, 0x25, 0x22, 0x29, 0x29, 0x25, 0x15, 0x8c, 0xbc, 0xbe, 0xa3, 0x9f, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0xff, 0x00, 0x00, 0x8f, 0xfe, 0xf1, 0xf9, 0xfe, 0xed, 0xed, 0x91, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x81, 0xf3, 0xf1, 0xe8, 0x88, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa0, 0xa1, 0xbc, 0xb7, 0xb4, 0xb2, 0xbb, 0xbd, 0xb7, 0x96, 0x7d, 0x1f, 0x2c, 0x6a, 0xf9, 0xf4, 0xf4, 0x77, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf6, 0x77, 0x77, 0xf6, 0xf5, 0x05, 0x68, 0x13, 0x19, 0x8a, 0xbc, 0xb5, 0xb5, 0xb2, 0xbb, 0xb1, 0xb3, 0xbc, 0xa4, 0xa0, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x07, 0x00, 0x93, 0x87, 0xf9, 0x81, 0x00, 0x00, 0x00, 0xff, 0x9f, 0xf2, 0x93, 0x81, 0xe8, 0xf1, 0xf8, 0xf0, 0xf8, 0x79, 0xfb, 0xf1, 0xf1, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0xa1, 0xac, 0xaf, 0x96, 0x7d, 0x1d, 0x25, 0x26, 0x2b, 0x22, 0x1d, 0x7a, 0x95, 0xbc, 0xa5, 0xf2, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xea, 0xf1, 0xf8, 0x9d, 0xed, 0x87, 0x87, 0xea, 0xea, 0x8f, 0x89, 0x00, 0x00, 0x92, 0xf2, 0x9f, 0x00, 0xa2, 0x8f, 0xf1, 0xf3, 0x89, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9f, 0xa1, 0xa8, 0xc5, 0xb8, 0xb2, 0xb4, 0xb4, 0xc0, 0xc6, 0x8a, 0x1f, 0x14, 0x68, 0x79, 0xf4, 0xf4, 0x9d, 0xf4, 0xfa, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xfa, 0xf6, 0x9d, 0x77, 0xf5, 0xf3, 0x02, 0x59, 0x17, 0x19, 0x8b, 0xc6, 0xb5, 0xb6, 0xb4, 0xb4, 0xb2, 0xb7, 0xbc, 0xa1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xa2, 0xea, 0xf1, 0xa9, 0x00, 0x00, 0xff, 0xf2, 0x00, 0xa4, 0x91, 0xea, 0xf9, 0xf1, 0xfb, 0xf0, 0xfe, 0xfe, 0xfe, 0x79, 0xfe, 0xf8, 0xf1, 0x8f, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9f, 0xa0, 0x9f, 0xa5, 0xae, 0x96, 0x8a, 0x1d, 0x25, 0x2b, 0x31, 0x25, 0x1b, 0x7d, 0xbe, 0xad, 0xa1, 0x9f, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x07, 0x00, 0x88, 0x87, 0xf1, 0xf4, 0x77, 0xf3, 0xf0, 0xfe, 0xf8, 0xfb, 0x77, 0xf3, 0xec, 0x98, 0x92, 0x9f, 0x9f, 0x92, 0x00, 0x00, 0x00, 0x98, 0xf1, 0xea, 0xa2, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x9f, 0xa0, 0xa5, 0xc3, 0xb8, 0xb2, 0xbd, 0xb4, 0xbf, 0xba, 0x8c, 0x1f, 0x18, 0x57, 0xfe, 0xf4, 0xf4, 0x77, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf6, 0xf4, 0x77, 0x9d, 0xf5, 0x76, 0x4a, 0x18, 0x7c, 0x8c, 0xc3, 0xb5, 0xb6, 0xb2, 0xb4, 0xb1, 0xb7, 0xaa, 0x9f, 0xa0, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x8f, 0xf1, 0xab, 0x00, 0x92, 0xf2, 0x00, 0xa0, 0x8b, 0xeb, 0x9d, 0xf7, 0xfe, 0xf0, 0xf8, 0xf9, 0xf1, 0xf1, 0xf1, 0xfe, 0xf8, 0xf8, 0xfb, 0xf1, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x07, 0xf2, 0x9f, 0x92, 0x9f, 0xa0, 0xaa, 0xba, 0x94, 0x7c, 0x25, 0x2b, 0x2b, 0x25, 0x7a, 0x8c, 0x95, 0xa4, 0x9f, 0xa0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x88, 0x87, 0xf1, 0xf4, 0xf9, 0xfe, 0xf1, 0xf1, 0xf1, 0xf9, 0xf8, 0xfb, 0xed, 0xf3, 0xef, 0x9a, 0xa2, 0xa0, 0x00, 0x92, 0x00, 0x00, 0x00, 0x81, 0xf1, 0x86, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xa0, 0xa3, 0xae, 0xc0, 0xb4, 0xb2, 0xb4, 0xc0, 0xba, 0x8c, 0x1f, 0x1f, 0x4a, 0x77, 0xfb, 0xfc, 0x77, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0xf6, 0xf4, 0x77, 0xf4, 0xf7, 0x76, 0x3a, 0x1d, 0x19, 0x94, 0xc5, 0xb5, 0xb6, 0xb4, 0xb4, 0xb2, 0xc3, 0xa4, 0xa0, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfe, 0x86, 0x00, 0xf2, 0x00, 0x9f, 0x9f, 0xa9, 0xad, 0x9b, 0xef, 0xf0, 0xfe, 0x9d, 0xf1, 0xe8, 0x98, 0x8f, 0xea, 0xf1, 0xf8, 0xfe, 0xf8, 0xf8, 0xf8, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x9f, 0x9f, 0x92, 0x00, 0xa4, 0xae, 0x96, 0x7d, 0x25, 0x31, 0x2b, 0x2d, 0x7b, 0x95, 0xac, 0xa0, 0x00, 0x9f, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xff, 0x9c, 0xf1, 0x9d, 0xf8, 0xfe, 0xf9, 0xed, 0x91, 0x86, 0x87, 0xfe, 0xfe, 0xf7, 0xef, 0xec, 0xe5, 0xce, 0xa6, 0x9f, 0x9f, 0x92, 0x07, 0x00, 0x00, 0x91, 0xf8, 0x89, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xf2, 0x9f, 0xa1, 0xac, 0xc0, 0xb4, 0xb2, 0xb4, 0xbf, 0xba, 0x95, 0x1f, 0x1c, 0x39, 0x77, 0xfb, 0xfc, 0x77, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0x77, 0xf4, 0xf0, 0x76, 0x2f, 0x21, 0x19, 0x94, 0xc5, 0xb6, 0xb6, 0xb4, 0xb2, 0xb3, 0xae, 0xa3, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x86, 0xf9, 0x9f, 0x00, 0x00, 0x92, 0x9f, 0xa9, 0xa4, 0xa1, 0xa7, 0xee, 0xf9, 0xfe, 0xf1, 0xea, 0x00, 0x00, 0x00, 0x00, 0x87, 0xf9, 0x79, 0xf9, 0xfe, 0xf1, 0x87, 0xf2, 0x00, 0x00, 0x00, 0x9f, 0x07, 0x00, 0x92, 0x92, 0x00, 0x08, 0x9f, 0xaa, 0xbc, 0x7e, 0x2d, 0x32, 0x2b, 0x28, 0x8b, 0xbe, 0xa4, 0x00, 0x00, 0x9f, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x98, 0xf1, 0xfb, 0x79, 0xf0, 0xf1, 0x87, 0xa2, 0x00, 0x00, 0xa2, 0xed, 0xfe, 0x79, 0xec, 0xe7, 0xad, 0xd7, 0x9a, 0xac, 0x9f, 0xa0, 0x9f, 0x9f, 0x00, 0x88, 0xf4, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xff, 0x92, 0xa0, 0xa8, 0xc8, 0xb4, 0xb2, 0xb6, 0xb8, 0xba, 0x94, 0x1f, 0x1f, 0x28, 0x76, 0xfe, 0xfc, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf5, 0xf4, 0xfc, 0xfb, 0xf0, 0x74, 0x2f, 0x1d, 0x19, 0x96, 0xbf, 0xb5, 0xb4, 0xb4, 0xb4, 0xb6, 0xae, 0xa1, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xed, 0x86, 0x00, 0x00, 0x07, 0x9f, 0x88, 0xa6, 0xa1, 0xa1, 0xa6, 0xef, 0xf8, 0xf8, 0xf1, 0x81, 0x00, 0x00, 0x92, 0x00, 0x8f, 0xf1, 0xf8, 0xf8, 0xfe, 0xf9, 0xf1, 0x81, 0x00, 0x9f, 0x00, 0x07, 0x00, 0xff, 0x9f, 0x9f, 0x00, 0x08, 0x00, 0xa5, 0xae, 0x8c, 0x28, 0x29, 0x2d, 0x28, 0x8c, 0xac, 0xa0, 0x00, 0x07, 0x9f, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xed, 0xf1, 0xf9, 0xfe, 0xf1, 0xfe, 0xab, 0x00, 0x00, 0x00, 0xa2, 0xe8, 0xf1, 0xf9, 0xdf, 0xa5, 0xa3, 0xad, 0xe6, 0xdf, 0xb0, 0xa0, 0xa0, 0x9f, 0x00, 0x00, 0x91, 0xfb, 0x88, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xff, 0x9f, 0x9f, 0xa7, 0xc8, 0xb3, 0xb2, 0xb2, 0xbf, 0xb7, 0x95, 0x28, 0x18, 0x28, 0x74, 0x04, 0xfc, 0x77, 0xf0, 0xfa, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x9d, 0xf5, 0xf4, 0xfc, 0xfc, 0xf7, 0x73, 0x2f, 0x21, 0x7c, 0x94, 0xbd, 0xbf, 0xb3, 0xb4, 0xb6, 0xb5, 0xaa, 0xa0, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xf1, 0x93, 0x00, 0x00, 0xf2, 0x00, 0xb0, 0xab, 0xa0, 0xa1, 0xdf, 0xf1, 0xf8, 0xf0, 0xf1, 0x8f, 0x00, 0x92, 0x00, 0x00, 0x86, 0xf1, 0xf9, 0xfe, 0xf8, 0xfe, 0xf1, 0xe8, 0xa2, 0x00, 0x00, 0x92, 0x00, 0x07, 0x9f, 0x9f, 0x9f, 0x08, 0x00, 0xa0, 0xaa, 0x95, 0x7f, 0x25, 0x39, 0x7e, 0xb0, 0xa6, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xf1, 0xf8, 0xf8, 0xfe, 0xf8, 0xf1, 0xa9, 0x00, 0x92, 0x00, 0x89, 0xfe, 0xf9, 0xf1, 0xe8, 0xa8, 0xa3, 0xa3, 0xe0, 0xe1, 0xe4, 0xa6, 0xa0, 0x9f, 0x9f, 0x00, 0x93, 0xf1, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x9f, 0xa5, 0xbc, 0xb6, 0xb2, 0xb6, 0xb3, 0xb7, 0x95, 0x28, 0x17, 0x19, 0x74, 0x04, 0xfc, 0x02, 0x9d, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9e, 0xf5, 0xfa, 0xfc, 0x77, 0xfe, 0x73, 0x1f, 0x1b, 0x19, 0x96, 0xbf, 0xb5, 0xb8, 0xb4, 0xb6, 0xbf, 0xa8, 0x9f, 0x07, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x87, 0xa2, 0x00, 0xf2, 0x00, 0x9f, 0xeb, 0xe9, 0xb0, 0x9c, 0xf8, 0xf1, 0xf8, 0xfe, 0xf9, 0xf3, 0x93, 0x00, 0x00, 0x89, 0xfb, 0xf1, 0xfe, 0xf9, 0xf8, 0xf1, 0xf9, 0xf9, 0x93, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xa0, 0x9f, 0x00, 0x08, 0xa0, 0xa6, 0x95, 0x7e, 0x33, 0x28, 0x8b, 0xb0, 0xf2, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xea, 0xf1, 0xf8, 0x79, 0xf9, 0xf9, 0xf9, 0xea, 0x92, 0x00, 0x88, 0xea, 0xf1, 0xfe, 0xf9, 0xf9, 0xea, 0xb0, 0xd2, 0xe7, 0xe1, 0xd7, 0xe1, 0xa1, 0x9f, 0x00, 0x00, 0x07, 0xed, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0xa4, 0xc3, 0xb3, 0xb2, 0xb6, 0xb3, 0xb7, 0x96, 0x28, 0x21, 0x15, 0x71, 0x05, 0xfc, 0x77, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x9d, 0x9d, 0xf6, 0xfc, 0xfc, 0xfe, 0x71, 0x1f, 0x21, 0x7a, 0x96, 0xb3, 0xbf, 0xb8, 0xb3, 0xb6, 0xb5, 0xa8, 0x9f, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe8, 0xe8, 0x00, 0x00, 0xff, 0x00, 0x89, 0xee, 0xee, 0xef, 0xf7, 0xf9, 0xfe, 0xf0, 0xf9, 0xf0, 0xf1, 0xf3, 0xe8, 0xea, 0xed, 0xf1, 0xf8, 0xf9, 0xf9, 0xf0, 0xf8, 0xf8, 0xf9, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xa0, 0x9f, 0xff, 0x00, 0xa3, 0xad, 0x8c, 0x7c, 0x7b, 0xb0, 0xa9, 0x00, 0xff, 0x00, 0x9f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfe, 0xfe, 0xf9, 0x79, 0xfe, 0xf9, 0x79, 0xf1, 0xea, 0xe8, 0x87, 0xf1, 0xfe, 0xf1, 0xf9, 0xf9, 0xf1, 0xf9, 0xf5, 0xe9, 0xda, 0xe1, 0xdf, 0xa6, 0x92, 0x00, 0x00, 0x00, 0xe8, 0xea, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x07, 0x9f, 0xa3, 0xbc, 0xb3, 0xb6, 0xb6, 0xb8, 0xb3, 0x97, 0x28, 0x17, 0x15, 0x71, 0x04, 0x02, 0xfc, 0xf0, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0x9d, 0xfa, 0xfc, 0xfc, 0x9e, 0xfe, 0x71, 0x1f, 0x1b, 0x15, 0x96, 0xbf, 0xb3, 0xb8, 0xb3, 0xb6, 0xbf, 0xa7, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x92, 0x00, 0x87, 0x91, 0x00, 0xff, 0x00, 0x00, 0xa9, 0xef, 0xef, 0xef, 0xf8, 0x04, 0xf8, 0xf9, 0xf8, 0xf8, 0xfe, 0x79, 0xf1, 0x79, 0xf1, 0x79, 0xf8, 0xf8, 0xfe, 0xf9, 0xf8, 0xf1, 0xf8, 0x86, 0x00, 0x00, 0x07, 0x92, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x08, 0x07, 0xa0, 0x8b, 0xb0, 0x7b, 0x7b, 0x98, 0x88, 0x00, 0xff, 0x00, 0x9f, 0x00, 0x00, 0x07, 0x07, 0x00, 0x07, 0x00, 0x00, 0x81, 0xf8, 0xf8, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf1, 0xf1, 0xf1, 0xf8, 0xf9, 0xf8, 0xf9, 0x06, 0xf8, 0xf9, 0xf7, 0xec, 0xe0, 0xd7, 0xe6, 0xb0, 0x00, 0x00, 0x07, 0x00, 0x98, 0xf3, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x07, 0x00, 0xa4, 0xbc, 0xb5, 0xb2, 0xb6, 0xb8, 0xb7, 0x97, 0x7c, 0x17, 0x15, 0x6f, 0x05, 0xfc, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf4, 0xfa, 0xfd, 0xf4, 0x9d, 0x79, 0x70, 0x1b, 0x1b, 0x7c, 0x94, 0xc5, 0xc1, 0xb8, 0xb3, 0xb6, 0xb3, 0xa7, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xea, 0x91, 0x00, 0x00, 0xf2, 0x00, 0xab, 0xef, 0xee, 0xf7, 0xf7, 0xfe, 0x79, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0x91, 0x00, 0x00, 0x07, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0xff, 0x00, 0x92, 0x9f, 0xa7, 0xb0, 0xa9, 0xab, 0x81, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x98, 0xf9, 0xf9, 0xf8, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0x79, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xee, 0xe1, 0xd2, 0xe0, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x81, 0x77, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x07, 0xff, 0x00, 0xa3, 0xbc, 0xb3, 0xb2, 0xb3, 0xb8, 0xb9, 0x96, 0x7c, 0x1d, 0x14, 0x6f, 0xf9, 0x9d, 0x9d, 0xfb, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf3, 0xfd, 0xfc, 0x9d, 0x9d, 0x79, 0x70, 0x19, 0x1d, 0x15, 0x94, 0xc5, 0xb8, 0xb8, 0xb3, 0xb5, 0xc0, 0xa7, 0x00, 0x07, 0x9f, 0x92, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x87, 0x91, 0x00, 0x00, 0x00, 0x00, 0xab, 0xef, 0xee, 0xef, 0xf7, 0x79, 0x79, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x07, 0x07, 0xff, 0x00, 0x00, 0xa0, 0x88, 0xb0, 0xa9, 0x8b, 0xab, 0x9f, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0xff, 0x00, 0x00, 0x8f, 0xf1, 0xf7, 0xf1, 0xf7, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xef, 0xe1, 0xda, 0xe0, 0xe1, 0x9f, 0x00, 0x00, 0x00, 0x81, 0xf4, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x9f, 0xa3, 0xbc, 0xb3, 0xb2, 0xb3, 0xb8, 0xb9, 0x97, 0x7d, 0x17, 0x14, 0x6e, 0x06, 0x9d, 0xf0, 0xfb, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0xfc, 0xf4, 0x9d, 0x79, 0x70, 0x1b, 0x1b, 0x15, 0x94, 0xb7, 0xc1, 0xb4, 0xb3, 0xb6, 0xc2, 0xa7, 0x9f, 0x00, 0x9f, 0x9f, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe8, 0xe8, 0x00, 0x00, 0xf2, 0x00, 0xa9, 0xef, 0xee, 0xf5, 0xf7, 0xf8, 0x79, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0xf9, 0xf8, 0xf9, 0xf7, 0x91, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x9f, 0x9f, 0xa1, 0xb0, 0xa9, 0x8b, 0x93, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x92, 0x07, 0x00, 0x98, 0x79, 0xfe, 0xf9, 0x79, 0xf9, 0xf8, 0x79, 0xf8, 0x79, 0xf8, 0x79, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0x06, 0xf9, 0xf9, 0xee, 0xe1, 0xda, 0xd2, 0xe6, 0x9f, 0x9f, 0x00, 0x00, 0x8f, 0xed, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x07, 0x9f, 0xa4, 0xc8, 0xb3, 0xb2, 0xb3, 0xb8, 0xb9, 0x96, 0x7c, 0x1d, 0x14, 0x6e, 0x79, 0x9e, 0x9d, 0x77, 0xfa, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf4, 0xfc, 0xfd, 0x9d, 0x9e, 0xfe, 0x70, 0x13, 0x1d, 0x15, 0x94, 0xc3, 0xc1, 0xbd, 0xb5, 0xb2, 0xc9, 0xa8, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x87, 0x00, 0xf2, 0x07, 0x00, 0x89, 0xee, 0xee, 0xef, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x04, 0x79, 0xf8, 0xf9, 0xf9, 0xf7, 0x98, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x07, 0x00, 0x9f, 0x08, 0x88, 0x88, 0x88, 0x92, 0x00, 0x92, 0x00, 0x07, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0x92, 0x00, 0x00, 0x81, 0xfe, 0xf9, 0x79, 0xf8, 0xf8, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf8, 0xf9, 0x79, 0xf9, 0xf9, 0x06, 0x04, 0xf1, 0xf8, 0xec, 0xd7, 0xda, 0xd7, 0xe1, 0xa0, 0x9f, 0x00, 0x00, 0xe8, 0xe8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa0, 0xa7, 0xc3, 0xb3, 0xb2, 0xb4, 0xb7, 0xb9, 0x96, 0x7a, 0x1d, 0x11, 0x6e, 0xf9, 0x9d, 0x9e, 0x02, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xfd, 0xfc, 0xf4, 0x9d, 0x79, 0x6f, 0x1f, 0x17, 0x15, 0x8c, 0xba, 0xbd, 0xb4, 0xb6, 0xb3, 0xc1, 0xac, 0xa0, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x81, 0xed, 0x88, 0x00, 0x00, 0x9f, 0xa2, 0xec, 0xed, 0xef, 0xef, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x79, 0x79, 0x79, 0xf9, 0xf8, 0xf9, 0xf3, 0x81, 0x00, 0x9f, 0xf2, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x07, 0x08, 0x08, 0x09, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x07, 0x00, 0x92, 0x00, 0x92, 0x07, 0x00, 0x00, 0xa9, 0xfc, 0x79, 0xf8, 0x79, 0xf9, 0xf8, 0xf8, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0x06, 0x04, 0xf1, 0xf7, 0xeb, 0xd7, 0xda, 0xe0, 0xce, 0x9f, 0x9f, 0x00, 0x92, 0xed, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x9f, 0xa0, 0xa8, 0xc3, 0xb3, 0xb2, 0xaf, 0xb3, 0xb9, 0x95, 0x7a, 0x1d, 0x14, 0x6e, 0x79, 0x9e, 0x9d, 0x77, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf4, 0xfc, 0xfc, 0x9d, 0x9d, 0x79, 0x70, 0x17, 0x18, 0x15, 0x8a, 0xc6, 0xbf, 0xb6, 0xb6, 0xb8, 0xc4, 0xac, 0xa1, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x89, 0xf9, 0xa9, 0x00, 0xf2, 0x00, 0x9f, 0x9c, 0xee, 0xee, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0x79, 0xf8, 0xf9, 0xf7, 0xf8, 0xec, 0x89, 0x9f, 0x00, 0x92, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x09, 0x09, 0x0d, 0x16, 0x1f, 0x1f, 0x1f, 0x16, 0x16, 0x0e, 0x0a, 0x08, 0x08, 0x08, 0x92, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x89, 0x87, 0xfe, 0xf8, 0xfe, 0xf9, 0xf9, 0xf8, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf8, 0xf9, 0xf8, 0x06, 0x79, 0xf7, 0xf8, 0xe9, 0xd2, 0xd7, 0xe4, 0xad, 0x9f, 0x9f, 0x00, 0x89, 0xf1, 0xa9, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xf2, 0x9f, 0xa1, 0xaa, 0xb9, 0xb3, 0xb6, 0xb3, 0xb7, 0xb7, 0x95, 0x7a, 0x21, 0x11, 0x6e, 0xf9, 0x9d, 0x9e, 0x77, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xfd, 0xfc, 0xf4, 0x9d, 0x79, 0x70, 0x17, 0x17, 0x17, 0x7e, 0xc6, 0xbf, 0xb6, 0xb3, 0xbd, 0xbb, 0xbc, 0xa4, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0xea, 0x91, 0x00, 0xf2, 0x00, 0x00, 0xa9, 0xec, 0xef, 0xef, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x79, 0xf9, 0x79, 0xf9, 0x79, 0xf7, 0xf9, 0xf8, 0xf9, 0x9d, 0x86, 0xf2, 0x9f, 0x00, 0x00, 0xf2, 0x08, 0x00, 0x08, 0x09, 0x0d, 0x1f, 0x2f, 0x30, 0x2c, 0x2e, 0x23, 0x30, 0x2c, 0x30, 0x2c, 0x3a, 0x1f, 0x0d, 0x08, 0x08, 0xff, 0x07, 0x07, 0x00, 0x07, 0x92, 0x00, 0x91, 0xfe, 0xf8, 0xf7, 0xf9, 0xfe, 0xf8, 0xf9, 0xf8, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xfe, 0xf9, 0xf7, 0xee, 0xe4, 0xd2, 0xda, 0xe1, 0xa4, 0x00, 0x9f, 0x00, 0x8f, 0xed, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xa0, 0xa3, 0xae, 0xc0, 0xb3, 0xb2, 0xb3, 0xaf, 0xba, 0x94, 0x7c, 0x21, 0x14, 0x6e, 0x79, 0x9e, 0x9d, 0x02, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x9d, 0xfd, 0xfc, 0xf5, 0x9d, 0x79, 0x70, 0x1f, 0x1e, 0x13, 0x7e, 0x97, 0xbf, 0xb5, 0xbd, 0xb8, 0xc1, 0xbc, 0xa5, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x92, 0x07, 0x00, 0x98, 0xed, 0x00, 0x00, 0x92, 0x00, 0xa0, 0x9c, 0xee, 0xef, 0xef, 0xf8, 0xf8, 0xf8, 0xf8, 0x79, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf8, 0xf7, 0xf7, 0xed, 0xab, 0x00, 0x92, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0d, 0x2f, 0x2f, 0x2c, 0x2c, 0x2e, 0x23, 0x2e, 0x23, 0x2e, 0x23, 0x30, 0x2c, 0x30, 0x2f, 0x2f, 0x16, 0x09, 0x08, 0x08, 0x07, 0x07, 0x07, 0x00, 0x00, 0xab, 0xf5, 0xed, 0xf9, 0xf8, 0xf9, 0xf9, 0xf8, 0xf8, 0xf9, 0xf8, 0xf8, 0xf8, 0xf9, 0xf8, 0xf8, 0xf7, 0xf9, 0xeb, 0xd2, 0xda, 0xe1, 0xbe, 0xa1, 0x00, 0x00, 0x00, 0x87, 0x86, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9f, 0xa0, 0xa4, 0xbc, 0xb7, 0xb4, 0xb4, 0xb5, 0xb3, 0xba, 0x94, 0x7c, 0x1e, 0x14, 0x6e, 0xf9, 0x9d, 0x9e, 0xfb, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x9d, 0xfd, 0xfc, 0xf0, 0x9d, 0xf8, 0x72, 0x18, 0x1c, 0x18, 0x7b, 0x95, 0xb7, 0xb5, 0xbf, 0xb8, 0xbb, 0xc8, 0xa8, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xa2, 0xf3, 0xab, 0x00, 0x00, 0x92, 0x9f, 0xa6, 0xe9, 0xef, 0xf7, 0xf7, 0xf8, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf9, 0xf7, 0x87, 0xea, 0xf2, 0x9f, 0x00, 0x07, 0x07, 0x08, 0x09, 0x16, 0x2f, 0x36, 0x23, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x23, 0x2c, 0x3d, 0x1f, 0x0d, 0x07, 0x08, 0xff, 0x08, 0xf2, 0x07, 0x92, 0xea, 0x87, 0xef, 0xf7, 0xf9, 0xf9, 0xf8, 0xfe, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xee, 0xe0, 0xe4, 0xd2, 0xe4, 0xa3, 0x00, 0x00, 0x00, 0xab, 0xf3, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9f, 0xa0, 0xa7, 0xbc, 0xb8, 0xb3, 0xb4, 0xb3, 0xb5, 0xc6, 0x8c, 0x1b, 0x26, 0x14, 0x6f, 0xf9, 0x9d, 0x9d, 0xfb, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xf4, 0xfc, 0xfd, 0x9d, 0xf5, 0x04, 0x72, 0x1f, 0x20, 0x17, 0x1a, 0x95, 0xc5, 0xb5, 0xbd, 0xb8, 0xbb, 0xc3, 0x96, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xf2, 0x00, 0x92, 0x00, 0xab, 0x87, 0xa2, 0x07, 0x9f, 0x9f, 0xa0, 0xab, 0xe9, 0xee, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0x87, 0xeb, 0xab, 0x00, 0x92, 0x00, 0x08, 0x00, 0x09, 0x16, 0x36, 0x35, 0x2e, 0x34, 0x31, 0x31, 0x31, 0x2e, 0x30, 0x2a, 0x2a, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x2c, 0x2f, 0x0e, 0x07, 0x08, 0xff, 0x07, 0x92, 0x00, 0xab, 0x87, 0xec, 0xf3, 0xf8, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xee, 0xe6, 0xd7, 0xdc, 0xe0, 0xaa, 0xa0, 0x92, 0x00, 0x00, 0x87, 0x81, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x9f, 0xa1, 0xac, 0xc3, 0xb7, 0xb4, 0xb4, 0xb5, 0xaf, 0xc6, 0x8a, 0x19, 0x27, 0x14, 0x6f, 0x79, 0x9d, 0xf0, 0xfc, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xfa, 0xfc, 0xf4, 0x9d, 0x04, 0x73, 0x1f, 0x1e, 0x20, 0x19, 0x8c, 0xcc, 0xb3, 0xc5, 0xb8, 0xb8, 0xbb, 0xc8, 0xa4, 0x00, 0x9f, 0x00, 0xff, 0x00, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0xff, 0x00, 0xea, 0x91, 0x00, 0xf2, 0x92, 0xa0, 0x9f, 0xab, 0xe5, 0xed, 0xef, 0xf1, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0xf7, 0xee, 0xeb, 0xeb, 0x84, 0xf2, 0x9f, 0xf2, 0x00, 0x08, 0x09, 0x1f, 0x36, 0x30, 0x2a, 0x2e, 0x2e, 0x34, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x31, 0x2e, 0x2e, 0x2e, 0x24, 0x31, 0x2e, 0x2e, 0x30, 0x30, 0x2f, 0x0d, 0x08, 0x92, 0xf2, 0x9f, 0xf2, 0x9f, 0x98, 0xec, 0xe9, 0xec, 0xef, 0xf9, 0xf7, 0xf9, 0xf7, 0xf7, 0xf7, 0xf9, 0xef, 0xec, 0xe6, 0xd7, 0xe0, 0xe1, 0xac, 0x9f, 0xa0, 0xf2, 0x00, 0x98, 0xea, 0x92, 0x00, 0x9f, 0x07, 0x00, 0x00, 0x07, 0x9f, 0x9f, 0x00, 0x07, 0xa0, 0xa1, 0xc3, 0xba, 0xb3, 0xb3, 0xb2, 0xaf, 0xb7, 0x95, 0x7e, 0x1b, 0x26, 0x14, 0x70, 0xf8, 0xf5, 0xf5, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xfa, 0xfa, 0x77, 0x77, 0x04, 0x74, 0x28, 0x18, 0x20, 0x1d, 0x8a, 0xcc, 0xc0, 0xbf, 0xb7, 0xb8, 0xb1, 0xc9, 0xa8, 0x9f, 0x9f, 0x00, 0x00, 0x07, 0xff, 0x00, 0x9f, 0x9f, 0x00, 0xff, 0x00, 0x00, 0x88, 0x87, 0x81, 0x00, 0x00, 0x92, 0xa0, 0xa0, 0xa9, 0x9a, 0xe5, 0xeb, 0xee, 0xef, 0xf7, 0xf7, 0xf7, 0xef, 0xec, 0xeb, 0xe6, 0xe7, 0x90, 0xa1, 0x9f, 0xa0, 0x00, 0x00, 0x09, 0x1f, 0x35, 0x34, 0x2e, 0x32, 0x2e, 0x31, 0x30, 0x34, 0x34, 0x30, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x2e, 0x34, 0x2e, 0x31, 0x34, 0x2e, 0x2c, 0x3b, 0x2c, 0x0d, 0x08, 0x9f, 0xa2, 0xf2, 0x9f, 0xf2, 0x9a, 0xeb, 0xe7, 0xe7, 0xeb, 0xec, 0xee, 0xef, 0xee, 0xec, 0xeb, 0xe7, 0xdc, 0xd0, 0xe4, 0xce, 0xac, 0x9f, 0xa0, 0x9f, 0x00, 0xab, 0xea, 0xa2, 0x00, 0xf2, 0x00, 0x92, 0x00, 0xff, 0xff, 0x9f, 0x9f, 0x9f, 0x00, 0xa1, 0xa7, 0xc3, 0xb7, 0xb3, 0xb6, 0xb4, 0xb4, 0xbc, 0x95, 0x7e, 0x17, 0x2c, 0x14, 0x71, 0xf8, 0xf5, 0xf4, 0xfb, 0x77, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x77, 0xfa, 0xfc, 0xf4, 0x77, 0xfe, 0x74, 0x2f, 0x17, 0x2b, 0x13, 0x7d, 0xcc, 0xc0, 0xc1, 0xb7, 0xb3, 0xb4, 0xc4, 0xbe, 0xa1, 0x9f, 0x92, 0x00, 0xff, 0x07, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x92, 0x00, 0x88, 0x87, 0x81, 0x00, 0x00, 0x9f, 0xa0, 0xa0, 0xa7, 0xbe, 0xd7, 0xe1, 0xe5, 0xe6, 0xe5, 0xe4, 0xe1, 0xe1, 0xe1, 0xe9, 0xe5, 0x88, 0x9f, 0x00, 0xf2, 0x00, 0x08, 0x16, 0x3d, 0x34, 0x30, 0x31, 0x2e, 0x2e, 0x32, 0x34, 0x30, 0x30, 0x35, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x35, 0x30, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x36, 0x3a, 0x0a, 0xff, 0x08, 0xa2, 0xf2, 0xf2, 0xa0, 0xce, 0xe9, 0xe7, 0xe6, 0xe6, 0xe6, 0xe4, 0xe6, 0xe4, 0xe0, 0xda, 0xe1, 0xe0, 0xce, 0xa6, 0xa0, 0x9f, 0x9f, 0x00, 0x93, 0x87, 0x88, 0x00, 0x00, 0x9f, 0x9f, 0x92, 0x00, 0xff, 0x00, 0x00, 0x9f, 0x00, 0x9f, 0xa1, 0xae, 0xb9, 0xb7, 0xb5, 0xb5, 0xb1, 0xb8, 0xb9, 0x8d, 0x7a, 0x17, 0x23, 0x1f, 0x73, 0xf8, 0xf3, 0xf6, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xfa, 0xfa, 0x9d, 0x77, 0xfe, 0x76, 0x33, 0x18, 0x24, 0x18, 0x7a, 0xbe, 0xc7, 0xb2, 0xb3, 0xbf, 0xbf, 0xb3, 0xcc, 0xa8, 0x9f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x9f, 0x00, 0xff, 0x00, 0x92, 0xf2, 0x00, 0xff, 0x86, 0x86, 0x89, 0x92, 0xf2, 0x92, 0xa1, 0xa4, 0xad, 0xbe, 0xd7, 0xe1, 0xe4, 0xe5, 0xe6, 0xe6, 0xe1, 0xab, 0x9f, 0x9f, 0x92, 0xff, 0x08, 0x08, 0x16, 0x3d, 0x30, 0x34, 0x31, 0x34, 0x30, 0x34, 0x31, 0x31, 0x38, 0x2c, 0x2c, 0x68, 0x72, 0x76, 0x75, 0x70, 0x61, 0x14, 0x2c, 0x30, 0x34, 0x30, 0x30, 0x30, 0x30, 0x36, 0x2f, 0x0a, 0x08, 0x07, 0xf2, 0xf2, 0x00, 0xa0, 0xa7, 0xe4, 0xe6, 0xe6, 0xe6, 0xe4, 0xe4, 0xe0, 0xe0, 0xd2, 0xbe, 0xa6, 0xa0, 0x9f, 0x9f, 0x00, 0x07, 0x81, 0x9c, 0xff, 0x00, 0x00, 0x00, 0xf2, 0x92, 0x9f, 0x00, 0x07, 0xff, 0x07, 0x07, 0x9f, 0x9f, 0xa7, 0xbc, 0xb7, 0xaf, 0xb3, 0xb2, 0xb1, 0xb9, 0xbc, 0x8c, 0x28, 0x18, 0x1c, 0x2c, 0x74, 0xf8, 0xf5, 0xfa, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x9d, 0xfa, 0xfa, 0xf4, 0x77, 0xfe, 0x76, 0x39, 0x13, 0x24, 0x1c, 0x19, 0x95, 0xc7, 0xbd, 0xb3, 0xbf, 0xb7, 0xb3, 0xc8, 0xae, 0xa1, 0x9f, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x92, 0xf2, 0xa2, 0xff, 0x00, 0x93, 0x81, 0xab, 0x88, 0x9f, 0xa0, 0xa0, 0xa1, 0xa6, 0xac, 0xb0, 0xce, 0xb0, 0xad, 0xa6, 0xa3, 0x9f, 0x9f, 0xff, 0xff, 0xff, 0x08, 0x0d, 0x36, 0x35, 0x34, 0x34, 0x31, 0x30, 0x34, 0x34, 0x31, 0x31, 0x23, 0x2c, 0x6d, 0x03, 0x06, 0x06, 0x06, 0x06, 0x03, 0x6c, 0x1f, 0x30, 0x3b, 0x3b, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x1f, 0x09, 0xa2, 0xf2, 0xa2, 0x00, 0xf2, 0xa0, 0xa3, 0xa8, 0xad, 0xce, 0xce, 0xbe, 0xad, 0xa7, 0xa4, 0xa0, 0x9f, 0xf2, 0x9f, 0x00, 0x89, 0x81, 0x93, 0xa2, 0xff, 0xff, 0xff, 0x07, 0x9f, 0x9f, 0x9f, 0x92, 0x00, 0x07, 0xff, 0x00, 0x9f, 0xa1, 0xae, 0xb9, 0xc0, 0xb3, 0xb5, 0xb1, 0xb4, 0xb9, 0xc6, 0x80, 0x19, 0x26, 0x23, 0x1f, 0x74, 0xfe, 0x9d, 0xf6, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xfa, 0xfa, 0x9d, 0x77, 0x77, 0x02, 0x39, 0x17, 0x23, 0x23, 0x15, 0x8c, 0xc8, 0xb2, 0xbf, 0xb7, 0xb7, 0xc4, 0xb8, 0xcd, 0xa8, 0xa0, 0xa0, 0x00, 0x00, 0x07, 0x00, 0x9f, 0x00, 0xff, 0x00, 0x92, 0x92, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xa2, 0xa2, 0xff, 0xff, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x07, 0x00, 0x92, 0xff, 0xff, 0xff, 0x09, 0x2f, 0x37, 0x31, 0x34, 0x31, 0x31, 0x34, 0x30, 0x34, 0x31, 0x31, 0x32, 0x18, 0x72, 0x05, 0x02, 0xf5, 0xfe, 0x04, 0x05, 0x70, 0x1f, 0x2c, 0x36, 0x49, 0x3b, 0x2e, 0x34, 0x34, 0x30, 0x36, 0x1a, 0x08, 0xf2, 0x92, 0xf2, 0xff, 0xff, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0xa0, 0x9f, 0x9f, 0x9f, 0xf2, 0x92, 0x9f, 0xff, 0x88, 0xa2, 0x00, 0xff, 0x00, 0xff, 0x07, 0x07, 0xff, 0x9f, 0xf2, 0x9f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xa0, 0xa7, 0xcc, 0xaf, 0xbd, 0xaf, 0xb2, 0xb1, 0xb4, 0xbc, 0x97, 0x7b, 0x17, 0x23, 0x1c, 0x2f, 0x76, 0xf0, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x9d, 0xfa, 0xfa, 0xf4, 0x9d, 0xfc, 0x78, 0x4a, 0x17, 0x23, 0x24, 0x17, 0x7e, 0xc6, 0xb7, 0xbd, 0xbf, 0xb7, 0xbf, 0xb4, 0xc0, 0xbe, 0xa4, 0xa0, 0xa0, 0x00, 0x92, 0x9f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x92, 0x07, 0xff, 0xff, 0x3a, 0x48, 0x38, 0x34, 0x3e, 0x34, 0x31, 0x30, 0x34, 0x34, 0x31, 0x31, 0x32, 0x18, 0x5a, 0x76, 0x06, 0xfa, 0xf9, 0x77, 0x06, 0x5a, 0x14, 0x36, 0x2c, 0x3b, 0x30, 0x35, 0x32, 0x34, 0x34, 0x30, 0x4b, 0x1a, 0x00, 0x00, 0xf2, 0xff, 0xff, 0xff, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0xff, 0x07, 0x00, 0x9f, 0x9f, 0x9f, 0x00, 0x92, 0x9f, 0x9f, 0xa3, 0xae, 0xc9, 0xaf, 0xb4, 0xb3, 0xb2, 0xb4, 0xbd, 0xba, 0xb0, 0x7c, 0x18, 0x23, 0x18, 0x3a, 0x02, 0x77, 0xf6, 0xfc, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x9d, 0xfa, 0xf6, 0xf4, 0xf0, 0x02, 0x78, 0x57, 0x13, 0x23, 0x23, 0x18, 0x7a, 0x95, 0xc3, 0xb7, 0xb5, 0xbf, 0xc1, 0xbd, 0xbd, 0xcc, 0xae, 0xa3, 0xa0, 0xa0, 0x9f, 0x00, 0x9f, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x9f, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x07, 0x9f, 0x92, 0x00, 0x08, 0x0e, 0x4e, 0x4e, 0x45, 0x34, 0x34, 0x31, 0x34, 0x2e, 0x34, 0x30, 0x31, 0x31, 0x2e, 0x35, 0x2c, 0x5a, 0x06, 0x06, 0x06, 0x06, 0x6c, 0x16, 0x2c, 0x30, 0x30, 0x34, 0x34, 0x35, 0x34, 0x30, 0x34, 0x3f, 0x58, 0x5a, 0x88, 0x00, 0x92, 0x00, 0xff, 0x07, 0x07, 0x92, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x92, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x9f, 0x9f, 0x00, 0x9f, 0xff, 0x00, 0x00, 0x9f, 0x9f, 0x07, 0x9f, 0xf2, 0xa0, 0xa1, 0xac, 0xc8, 0xb8, 0xb4, 0xb3, 0xb3, 0xb3, 0xb2, 0xb9, 0x97, 0x8d, 0x15, 0x18, 0x23, 0x18, 0x4a, 0x78, 0x9e, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x9d, 0xfa, 0xfa, 0x9d, 0xf4, 0xfb, 0x78, 0x68, 0x13, 0x23, 0x2e, 0x23, 0x19, 0x8a, 0xcc, 0xb7, 0xbf, 0xb3, 0xc1, 0xbb, 0xbf, 0xb7, 0xcd, 0xac, 0xa1, 0xa0, 0x9f, 0x9f, 0x9f, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x9f, 0x9f, 0x00, 0x9f, 0x9f, 0x9f, 0x92, 0x9f, 0x07, 0x09, 0x4b, 0x50, 0x4d, 0x4d, 0x3f, 0x3f, 0x34, 0x34, 0x34, 0x2e, 0x32, 0x31, 0x30, 0x34, 0x30, 0x36, 0x1f, 0x58, 0x6c, 0x6d, 0x4a, 0x16, 0x2c, 0x36, 0x34, 0x30, 0x34, 0x34, 0x30, 0x34, 0x34, 0x3f, 0x51, 0x50, 0x58, 0x4b, 0x07, 0x92, 0xf2, 0x9f, 0x00, 0x9f, 0x9f, 0x00, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x9f, 0x9f, 0x92, 0x00, 0x9f, 0x92, 0x00, 0x92, 0x9f, 0x00, 0x07, 0x92, 0x9f, 0xa0, 0xa1, 0xa8, 0xcc, 0xb9, 0xaf, 0xbd, 0xaf, 0xb3, 0xb3, 0xb3, 0xba, 0x95, 0x7e, 0x1b, 0x20, 0x23, 0x18, 0x57, 0x78, 0xf6, 0xf4, 0xfc, 0x77, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x9e, 0xfa, 0xf5, 0xf4, 0x9d, 0xfb, 0x78, 0x6c, 0x13, 0x1c, 0x2e, 0x23, 0x15, 0x7e, 0x97, 0xb9, 0xb5, 0xbd, 0xbb, 0xc0, 0xbf, 0xc4, 0xb8, 0xcc, 0xa8, 0xa0, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x07, 0x00, 0x3a, 0x58, 0x53, 0x55, 0x55, 0x4d, 0x3f, 0x34, 0x34, 0x32, 0x32, 0x2e, 0x2e, 0x34, 0x30, 0x34, 0x34, 0x34, 0x14, 0x2c, 0x14, 0x2c, 0x2c, 0x30, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x3b, 0x49, 0x49, 0x51, 0x54, 0x68, 0x0e, 0x00, 0xa0, 0x9f, 0x9f, 0x00, 0x07, 0x07, 0xff, 0x00, 0x07, 0x9f, 0x9f, 0x9f, 0x9f, 0x92, 0x9f, 0x00, 0x9f, 0x92, 0x00, 0x92, 0x07, 0x92, 0x00, 0x9f, 0x92, 0x00, 0x07, 0x00, 0x92, 0xa0, 0xa7, 0xcc, 0xb9, 0xb8, 0xb4, 0xb4, 0xb3, 0xbf, 0xb3, 0xb3, 0xba, 0x95, 0x7b, 0x17, 0x26, 0x24, 0x14, 0x5e, 0x79, 0xf5, 0xf6, 0x02, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xfa, 0xfa, 0xf4, 0xf4, 0xfb, 0x05, 0x6e, 0x13, 0x23, 0x23, 0x1c, 0x25, 0x7a, 0x95, 0xbc, 0xb6, 0xbd, 0xbb, 0xc0, 0xb7, 0xb6, 0xb4, 0xc3, 0xcc, 0xa8, 0xa0, 0xa0, 0x9f, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x9f, 0x00, 0x9f, 0x81, 0x68, 0x50, 0x55, 0x53, 0x55, 0x55, 0x4d, 0x3b, 0x34, 0x34, 0x32, 0x32, 0x2e, 0x34, 0x34, 0x30, 0x34, 0x2b, 0x34, 0x34, 0x30, 0x30, 0x35, 0x34, 0x31, 0x34, 0x34, 0x34, 0x34, 0x34, 0x49, 0x49, 0x51, 0x49, 0x4d, 0x51, 0x6b, 0x61, 0xff, 0xa0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x9f, 0x92, 0x00, 0x92, 0x9f, 0x92, 0x00, 0x92, 0x07, 0xff, 0x07, 0xff, 0x00, 0x9f, 0x07, 0x00, 0xff, 0x92, 0xa0, 0xa7, 0xbc, 0xc3, 0xb8, 0xb3, 0xbd, 0xb2, 0xbf, 0xaf, 0xb7, 0xb7, 0xc6, 0x8c, 0x19, 0x17, 0x20, 0x23, 0x13, 0x69, 0x79, 0x9d, 0xfa, 0xf4, 0x77, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9e, 0xfa, 0xfa, 0xfa, 0x9d, 0x9d, 0xfe, 0x70, 0x14, 0x20, 0x1e, 0x1e, 0x20, 0x1f, 0x8b, 0xc6, 0xbd, 0xb2, 0xc4, 0xb8, 0xb9, 0xb8, 0xbf, 0xb9, 0xc3, 0xcc, 0xa7, 0xa1, 0x9f, 0x07, 0xff, 0xff, 0x9f, 0x92, 0x92, 0x00, 0x00, 0x92, 0x9f, 0x9f, 0xa0, 0x9f, 0x9f, 0x07, 0x07, 0xff, 0xff, 0xff, 0x07, 0x9f, 0x9f, 0xa0, 0xa0, 0x00, 0xa7, 0xe8, 0x69, 0x50, 0x55, 0x4d, 0x53, 0x53, 0x4d, 0x49, 0x3c, 0x34, 0x32, 0x34, 0x2e, 0x34, 0x34, 0x2e, 0x31, 0x2e, 0x34, 0x30, 0x34, 0x2e, 0x32, 0x31, 0x34, 0x34, 0x34, 0x30, 0x34, 0x45, 0x49, 0x53, 0x4d, 0x4d, 0x49, 0x56, 0x5d, 0x6d, 0xa9, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x9f, 0xa0, 0xa0, 0xa0, 0x9f, 0x9f, 0x00, 0x00, 0x07, 0x00, 0x07, 0x07, 0xff, 0x00, 0x92, 0x00, 0x92, 0x00, 0x9f, 0xf2, 0xa7, 0xcc, 0xb9, 0xb2, 0xb6, 0xbb, 0xb2, 0xb2, 0xb5, 0xb7, 0xb4, 0xb9, 0xc6, 0x7d, 0x13, 0x23, 0x1e, 0x1c, 0x15, 0x6c, 0x78, 0xfa, 0xfa, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0x9d, 0xf4, 0xfc, 0xfa, 0x9d, 0x9d, 0x79, 0x74, 0x1f, 0x20, 0x1e, 0x22, 0x23, 0x18, 0x7b, 0x97, 0xb7, 0xb6, 0xbd, 0xc0, 0xb9, 0xbf, 0xb7, 0xb3, 0xb8, 0xb7, 0xd0, 0xaa, 0xa1, 0xa0, 0x00, 0x92, 0x92, 0x00, 0x00, 0x00, 0xf2, 0x07, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0x9f, 0x00, 0xff, 0x00, 0xff, 0x00, 0x9f, 0xa0, 0x9f, 0xa6, 0xe5, 0xe6, 0x9c, 0x58, 0x4d, 0x54, 0x53, 0x53, 0x4d, 0x4d, 0x45, 0x3f, 0x34, 0x34, 0x34, 0x31, 0x34, 0x2e, 0x30, 0x31, 0x30, 0x34, 0x34, 0x34, 0x31, 0x30, 0x34, 0x34, 0x34, 0x34, 0x3f, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x5c, 0x65, 0x6a, 0xe5, 0xa7, 0x9f, 0x9f, 0x9f, 0x92, 0x07, 0x07, 0x07, 0x00, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x07, 0x00, 0x00, 0x92, 0x00, 0x9f, 0x92, 0x9f, 0x9f, 0x9f, 0xa0, 0xa1, 0xac, 0xcc, 0xc8, 0xb8, 0xb2, 0xb4, 0xb8, 0xb4, 0xb6, 0xb6, 0xb3, 0xc0, 0xbc, 0x95, 0x7a, 0x18, 0x24, 0x1c, 0x1e, 0x1b, 0x6f, 0x06, 0xfc, 0xfa, 0x9d, 0x9d, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x9e, 0xfa, 0xfd, 0xf4, 0x9d, 0xf0, 0xfe, 0x76, 0x2f, 0x18, 0x22, 0x24, 0x24, 0x18, 0x28, 0x8c, 0xc6, 0xc0, 0xb3, 0xc7, 0xb7, 0xb3, 0xbd, 0xb3, 0xb3, 0xb7, 0xb9, 0xd0, 0xac, 0xa4, 0xa0, 0xa0, 0x9f, 0x9f, 0x00, 0x07, 0x07, 0xff, 0x07, 0xff, 0x07, 0x07, 0x07, 0x9f, 0x9f, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x88, 0xd7, 0xe6, 0xe6, 0x9c, 0x5a, 0x50, 0x53, 0x53, 0x53, 0x4d, 0x49, 0x4d, 0x3f, 0x3f, 0x34, 0x34, 0x34, 0x2e, 0x34, 0x2e, 0x34, 0x34, 0x34, 0x2e, 0x34, 0x32, 0x34, 0x34, 0x34, 0x34, 0x3f, 0x51, 0x49, 0x4d, 0x49, 0x51, 0x49, 0x60, 0x50, 0x68, 0x86, 0xe0, 0xd2, 0xa5, 0xa1, 0xa0, 0xa0, 0x9f, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x9f, 0x9f, 0x07, 0x9f, 0x92, 0x92, 0x9f, 0x9f, 0x9f, 0xa0, 0x9f, 0xa0, 0xa1, 0xa4, 0xae, 0xc8, 0xb9, 0xaf, 0xb3, 0xc1, 0xb8, 0xb9, 0xb3, 0xb4, 0xb6, 0xb3, 0xc3, 0x97, 0x8b, 0x15, 0x1c, 0x20, 0x20, 0x21, 0x19, 0x70, 0x05, 0xfa, 0xf4, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9e, 0xf4, 0xfc, 0xf4, 0xf4, 0xf0, 0xfe, 0x03, 0x39, 0x18, 0x24, 0x24, 0x20, 0x29, 0x1d, 0x7a, 0x8e, 0xc8, 0xc1, 0xbd, 0xb7, 0xbf, 0xb5, 0xbd, 0xb6, 0xbd, 0xbf, 0xb9, 0xcd, 0xcc, 0xa7, 0xa3, 0xa0, 0x9f, 0x9f, 0x92, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0x07, 0x00, 0x07, 0x00, 0x00, 0x92, 0x9f, 0x9f, 0xa0, 0xa7, 0xce, 0xda, 0xe3, 0xe0, 0xe6, 0x91, 0x50, 0x53, 0x01, 0x53, 0x4d, 0x4d, 0x4d, 0x49, 0x4d, 0x3f, 0x3f, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x34, 0x34, 0x34, 0x34, 0x3f, 0x4d, 0x4d, 0x4d, 0x51, 0x46, 0x49, 0x51, 0x54, 0x5d, 0x86, 0xdf, 0xe3, 0xdd, 0xd2, 0xaa, 0xa3, 0xa0, 0xa0, 0x9f, 0x00, 0x07, 0xff, 0xff, 0x08, 0x07, 0x08, 0x00, 0x08, 0x07, 0x00, 0x9f, 0x92, 0xa0, 0x9f, 0xa0, 0xa3, 0xaa, 0xc5, 0xcb, 0xb5, 0xb6, 0xb6, 0xb8, 0xb8, 0xb9, 0xb9, 0xb7, 0xb3, 0xb2, 0xbf, 0xc6, 0x8d, 0x19, 0x17, 0x1e, 0x23, 0x1c, 0x17, 0x2f, 0x74, 0x78, 0xfa, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0x9d, 0xfc, 0xfc, 0xfc, 0x9d, 0xf6, 0x77, 0xf1, 0x4f, 0x13, 0x24, 0x20, 0x1e, 0x22, 0x1e, 0x19, 0x80, 0xcc, 0xb8, 0xbd, 0xb5, 0xbf, 0xbd, 0xbd, 0xb6, 0xbd, 0xb3, 0xc4, 0xaf, 0xc3, 0xcd, 0xae, 0xa7, 0xa3, 0xa0, 0xa0, 0xa0, 0x9f, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x9f, 0x9f, 0xa0, 0xa1, 0xa4, 0xaa, 0xcc, 0xbc, 0xcd, 0xde, 0xe3, 0xe4, 0xe5, 0x4b, 0x01, 0x53, 0x54, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x4d, 0x3f, 0x3f, 0x3f, 0x34, 0x34, 0x34, 0x34, 0x32, 0x34, 0x34, 0x34, 0x34, 0x34, 0x3f, 0x4d, 0x51, 0x4d, 0x4d, 0x51, 0x49, 0x49, 0x55, 0x50, 0x69, 0x90, 0xe3, 0xe2, 0xcf, 0xb7, 0xcd, 0xae, 0xa5, 0xa3, 0xa0, 0xa0, 0x9f, 0x00, 0x07, 0x07, 0x07, 0xff, 0xff, 0x07, 0x00, 0x9f, 0x9f, 0xa0, 0x9f, 0xa3, 0xa8, 0xbe, 0xc8, 0xc5, 0xb5, 0xb1, 0xb6, 0xb6, 0xc1, 0xc0, 0xb9, 0xb7, 0xb7, 0xbf, 0xb1, 0xb7, 0xc6, 0x7f, 0x13, 0x20, 0x1c, 0x1c, 0x1c, 0x17, 0x39, 0x76, 0x02, 0xfa, 0xf6, 0x9d, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf4, 0xfc, 0xf4, 0x77, 0xf0, 0xf4, 0x06, 0x69, 0x11, 0x24, 0x20, 0x20, 0x1e, 0x22, 0x17, 0x7b, 0xca, 0xb9, 0xbd, 0xb5, 0xb7, 0xc2, 0xbf, 0xbd, 0xbd, 0xb4, 0xb3, 0xc4, 0xbf, 0xb7, 0xc8, 0xcc, 0xae, 0xaa, 0xa4, 0xa1, 0xa1, 0xa0, 0xa0, 0x9f, 0xa0, 0x9f, 0x9f, 0xa0, 0xa0, 0xa3, 0xa5, 0xaa, 0xb9, 0xcd, 0xb3, 0xbf, 0xc7, 0xde, 0xe3, 0xe3, 0xe7, 0x68, 0x01, 0x01, 0x53, 0x54, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x3f, 0x3f, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x3f, 0x49, 0x51, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x52, 0x53, 0x5d, 0x86, 0xda, 0xe2, 0xe2, 0xcd, 0xc4, 0xc5, 0xc9, 0xd0, 0xae, 0xa7, 0xa3, 0xa1, 0xa0, 0xa0, 0xa0, 0x9f, 0x9f, 0x9f, 0x9f, 0xa0, 0xa0, 0xa3, 0xa6, 0xaa, 0xce, 0xcc, 0xc9, 0xb9, 0xb3, 0xbd, 0xb5, 0xb2, 0xb4, 0xc1, 0xb8, 0xb8, 0xc0, 0xb7, 0xb4, 0xbd, 0xb7, 0x95, 0x19, 0x18, 0x24, 0x18, 0x26, 0x18, 0x17, 0x4a, 0x78, 0x02, 0xfa, 0x9d, 0x9e, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x9d, 0xfc, 0xfc, 0x02, 0xf0, 0xf6, 0xf0, 0x06, 0x6e, 0x11, 0x23, 0x18, 0x1e, 0x1e, 0x22, 0x1c, 0x19, 0xb0, 0xc6, 0xb7, 0xbf, 0xc0, 0xc0, 0xc0, 0xc0, 0xc1, 0xc2, 0xbd, 0xb3, 0xc1, 0xbd, 0xc0, 0xb9, 0xc8, 0xcd, 0xcc, 0xcc, 0xac, 0xaa, 0xa7, 0xa7, 0xa5, 0xa7, 0xa7, 0xaa, 0xac, 0xbc, 0xc8, 0xc3, 0xc7, 0xbd, 0xb2, 0xb2, 0xb7, 0xd4, 0xde, 0xe3, 0xe4, 0x86, 0x50, 0x01, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x49, 0x52, 0x4d, 0x49, 0x49, 0x3f, 0x3f, 0x34, 0x34, 0x34, 0x34, 0x3f, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x51, 0x49, 0x55, 0x4d, 0x50, 0x69, 0x90, 0xdd, 0xe2, 0xe2, 0xcd, 0xb4, 0xbd, 0xc0, 0xc8, 0xc8, 0xd0, 0xbc, 0xae, 0xaa, 0xa7, 0xa5, 0xa5, 0xa5, 0xa7, 0xa7, 0xaa, 0xae, 0xbc, 0xcc, 0xcc, 0xb9, 0xb8, 0xb8, 0xb8, 0xc0, 0xb8, 0xb8, 0xc0, 0xb8, 0xb8, 0xbd, 0xb3, 0xbf, 0xb8, 0xc1, 0xb9, 0xc6, 0x8a, 0x15, 0x20, 0x20, 0x21, 0x18, 0x2d, 0x13, 0x5e, 0x05, 0xfd, 0xf5, 0x9d, 0x9e, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x9d, 0xf4, 0xfc, 0x02, 0x9e, 0x9d, 0xf7, 0x06, 0x73, 0x16, 0x18, 0x1c, 0x1e, 0x1e, 0x20, 0x1e, 0x1b, 0x7b, 0x99, 0xae, 0xc5, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xb8, 0xc1, 0xbd, 0xc2, 0xbd, 0xc4, 0xb8, 0xb3, 0xb9, 0xc8, 0xc8, 0xcd, 0xcc, 0xc8, 0xcc, 0xcd, 0xcf, 0xcf, 0xcb, 0xc0, 0xb8, 0xcb, 0xc1, 0xb8, 0xbb, 0xc4, 0xc2, 0xcd, 0xde, 0xe3, 0xe0, 0x9c, 0x61, 0x50, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x4d, 0x49, 0x4d, 0x49, 0x49, 0x3f, 0x34, 0x49, 0x49, 0x51, 0x49, 0x4d, 0x4d, 0x53, 0x49, 0x51, 0x51, 0x54, 0x59, 0x86, 0xe4, 0xd4, 0xe2, 0xe2, 0xc3, 0xbb, 0xbd, 0xc1, 0xc1, 0xc0, 0xb9, 0xc0, 0xc8, 0xc8, 0xcd, 0xcd, 0xc8, 0xc8, 0xc8, 0xcd, 0xcd, 0xc9, 0xb8, 0xb3, 0xb2, 0xb6, 0xb6, 0xb4, 0xc1, 0xb8, 0xb9, 0xb9, 0xc0, 0xc0, 0xb8, 0xb3, 0xbd, 0xb4, 0xc2, 0xb9, 0xcc, 0x95, 0x7a, 0x10, 0x20, 0x20, 0x18, 0x1c, 0x1c, 0x13, 0x6a, 0x05, 0xf6, 0xfa, 0x9e, 0x9d, 0x77, 0xfa, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x9d, 0xfc, 0xfc, 0x02, 0x9d, 0xf6, 0xf5, 0x04, 0x76, 0x39, 0x10, 0x18, 0x20, 0x20, 0x20, 0x20, 0x26, 0x1b, 0x80, 0xca, 0xc3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0xbf, 0xb8, 0xc1, 0xb3, 0xb2, 0xbd, 0xc4, 0xc0, 0xc1, 0xb9, 0xc0, 0xc0, 0xc7, 0xc7, 0xb4, 0xb5, 0xb6, 0xbf, 0xbd, 0xb8, 0xbd, 0xb8, 0xc7, 0xc7, 0xc0, 0xc2, 0xc5, 0xd5, 0xe3, 0xe3, 0xe4, 0x91, 0x48, 0x01, 0x01, 0x01, 0x01, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x4d, 0x4d, 0x4d, 0x51, 0x49, 0x49, 0x49, 0x56, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x51, 0x55, 0x42, 0x5a, 0x85, 0x9b, 0xe3, 0xdd, 0xe2, 0xd1, 0xb3, 0xbf, 0xbd, 0xbd, 0xb8, 0xbb, 0xc1, 0xc1, 0xc2, 0xc0, 0xb3, 0xb3, 0xb3, 0xb3, 0xbd, 0xc4, 0xbd, 0xbd, 0xb6, 0xc4, 0xb6, 0xb2, 0xb2, 0xb4, 0xbd, 0xb8, 0xc0, 0xc0, 0xb8, 0xc0, 0xb3, 0xc2, 0xb3, 0xbd, 0xc0, 0xb9, 0x99, 0x7e, 0x15, 0x17, 0x1e, 0x1e, 0x1c, 0x26, 0x21, 0x13, 0x6f, 0x06, 0xfa, 0xf5, 0x9d, 0x9e, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x9d, 0xf4, 0xfc, 0x02, 0x77, 0xf6, 0xf5, 0xfe, 0x03, 0x5e, 0x10, 0x20, 0x24, 0x23, 0x23, 0x20, 0x20, 0x1e, 0x7c, 0x8e, 0xbc, 0xc7, 0xbf, 0xbf, 0xbf, 0xc0, 0xbf, 0xc0, 0xbf, 0xb8, 0xbf, 0xc2, 0xbd, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xc4, 0xbf, 0xb3, 0xb3, 0xbd, 0xc2, 0xc2, 0xbd, 0xbd, 0xbd, 0xb3, 0xc1, 0xc2, 0xc0, 0xc1, 0xc1, 0xc2, 0xcd, 0xe0, 0xe2, 0xe3, 0xe6, 0x57, 0x50, 0x01, 0x01, 0x01, 0x53, 0x54, 0x4d, 0x4d, 0x52, 0x4d, 0x52, 0x4d, 0x4d, 0x4d, 0x51, 0x4d, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x55, 0x4d, 0x50, 0x63, 0x9b, 0xe2, 0xde, 0xe3, 0xde, 0xcf, 0xb5, 0xbf, 0xbf, 0xb3, 0xbd, 0xbd, 0xc1, 0xb4, 0xb4, 0xb8, 0xc2, 0xc0, 0xc1, 0xc0, 0xb8, 0xb8, 0xc0, 0xc0, 0xc1, 0xbd, 0xbd, 0xbd, 0xbd, 0xb4, 0xb6, 0xb4, 0xb6, 0xb4, 0xb5, 0xc2, 0xb8, 0xc0, 0xb7, 0xbf, 0xb8, 0xbc, 0x8d, 0x12, 0x21, 0x1e, 0x1e, 0x18, 0x20, 0x23, 0x18, 0x2f, 0x71, 0x04, 0xf5, 0xf5, 0x9e, 0x9d, 0x77, 0xfa, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf3, 0xfc, 0x77, 0x77, 0x9e, 0xf5, 0xf5, 0xfd, 0x06, 0x6c, 0x0c, 0x1c, 0x26, 0x2c, 0x1c, 0x20, 0x22, 0x1e, 0x13, 0x80, 0xce, 0xc3, 0xbf, 0xbd, 0xbd, 0xbf, 0xc5, 0xb9, 0xc0, 0xc2, 0xbd, 0xbf, 0xb8, 0xc2, 0xc2, 0xc2, 0xb8, 0xbf, 0xb8, 0xbd, 0xbd, 0xbd, 0xc0, 0xc7, 0xc7, 0xc0, 0xb8, 0xc1, 0xbf, 0xbd, 0xbf, 0xb4, 0xbf, 0xbb, 0xc0, 0xc3, 0xdb, 0xe3, 0xe2, 0xe4, 0x86, 0x50, 0x50, 0x01, 0x01, 0x54, 0x01, 0x4d, 0x53, 0x4d, 0x55, 0x4d, 0x4d, 0x4d, 0x51, 0x51, 0x51, 0x52, 0x4d, 0x4d, 0x4d, 0x51, 0x51, 0x4d, 0x52, 0x4d, 0x42, 0x68, 0x9b, 0xe0, 0xe2, 0xd5, 0xe3, 0xdd, 0xbd, 0xb6, 0xbf, 0xc2, 0xbf, 0xb8, 0xc1, 0xc1, 0xc4, 0xc2, 0xbd, 0xb8, 0xb8, 0xb8, 0xb8, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xb8, 0xc2, 0xb8, 0xbf, 0xb8, 0xbd, 0xb3, 0xbd, 0xb6, 0xbd, 0xb3, 0xbf, 0xb7, 0xc0, 0xbb, 0xc6, 0x97, 0x7b, 0x13, 0x1e, 0x18, 0x1d, 0x21, 0x1c, 0x21, 0x21, 0x39, 0x76, 0xf8, 0xf3, 0xef, 0x9e, 0x9e, 0xf4, 0xfc, 0xf4, 0xf4, 0x77, 0xf4, 0xfc, 0xf4, 0xfa, 0xf4, 0xfc, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xfd, 0xfd, 0x9d, 0x9e, 0x9d, 0xf5, 0xfa, 0xfc, 0x78, 0x74, 0x12, 0x10, 0x12, 0x0f, 0x12, 0x17, 0x22, 0x1e, 0x17, 0x33, 0x82, 0xca, 0xb9, 0xb2, 0xb2, 0xbf, 0xc3, 0xc3, 0xc0, 0xc1, 0xbd, 0xbd, 0xbd, 0xbf, 0xc1, 0xbf, 0xc1, 0xc2, 0xbd, 0xbf, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xb8, 0xbd, 0xc2, 0xc1, 0xb8, 0xc9, 0xb9, 0xd0, 0xe2, 0xe2, 0xe4, 0xe5, 0x8f, 0x3a, 0x01, 0x54, 0x01, 0x54, 0x53, 0x53, 0x4d, 0x53, 0x4d, 0x55, 0x49, 0x51, 0x49, 0x51, 0x55, 0x4d, 0x55, 0x53, 0x4d, 0x4d, 0x52, 0x49, 0x44, 0x5a, 0x85, 0xe4, 0xda, 0xe2, 0xd5, 0xe2, 0xd3, 0xc1, 0xc1, 0xc2, 0xb8, 0xc2, 0xc2, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xbf, 0xc2, 0xbf, 0xb8, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0xb8, 0xbf, 0xb7, 0xbd, 0xb9, 0xce, 0x8a, 0x11, 0x1d, 0x2d, 0x21, 0x1d, 0x1b, 0x1d, 0x21, 0x16, 0x5e, 0x05, 0xfc, 0xf5, 0xef, 0x9e, 0x9d, 0xfb, 0xfa, 0xf4, 0x77, 0xf4, 0x77, 0xfb, 0xfa, 0xfd, 0xfa, 0xfa, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfd, 0xf4, 0xfe, 0x9d, 0xf7, 0xfa, 0xfd, 0x05, 0x05, 0x73, 0x13, 0x0b, 0x0a, 0x09, 0x09, 0x0a, 0x17, 0x25, 0x21, 0x15, 0x80, 0x8e, 0xbc, 0xbd, 0xbd, 0xb3, 0xc3, 0xc3, 0xc0, 0xc1, 0xbd, 0xbf, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xb8, 0xc2, 0xc2, 0xb8, 0xc1, 0xbb, 0xc0, 0xc8, 0xc8, 0xd9, 0xe2, 0xe3, 0xe1, 0x9c, 0x5a, 0x50, 0x01, 0x01, 0x01, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x4d, 0x52, 0x51, 0x4d, 0x4d, 0x52, 0x4d, 0x51, 0x51, 0x49, 0x57, 0x6a, 0x9b, 0xe0, 0xdd, 0xd5, 0xe2, 0xd9, 0xc8, 0xb8, 0xb8, 0xc0, 0xc2, 0xc0, 0xb8, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xbf, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xc2, 0xb8, 0xc2, 0xbd, 0xc0, 0xb8, 0xc0, 0xc0, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xb9, 0xcc, 0x94, 0x0d, 0x1d, 0x25, 0x10, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x16, 0x71, 0x79, 0xfe, 0x9e, 0xf0, 0xf3, 0xf4, 0xfa, 0xf6, 0xf4, 0xf0, 0xfb, 0xf4, 0xfa, 0xfa, 0xfa, 0xfc, 0xf4, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xfb, 0xf0, 0xf3, 0xfc, 0x04, 0x78, 0x70, 0x4a, 0x15, 0x11, 0x13, 0x14, 0x0f, 0x0a, 0x0a, 0x0a, 0x13, 0x18, 0x1d, 0x1b, 0x8d, 0xca, 0xb7, 0xb2, 0xbd, 0xc0, 0xc3, 0xc1, 0xc1, 0xbf, 0xbf, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xb8, 0xc2, 0xc2, 0xbd, 0xbd, 0xc1, 0xc7, 0xb7, 0xcf, 0xe2, 0xe2, 0xe0, 0xe5, 0x91, 0x4b, 0x01, 0x01, 0x01, 0x53, 0x55, 0x4d, 0x51, 0x49, 0x4d, 0x55, 0x55, 0x55, 0x55, 0x51, 0x51, 0x52, 0x52, 0x51, 0x51, 0x50, 0x58, 0x85, 0xe5, 0xe0, 0xde, 0xdd, 0xdd, 0xe2, 0xd1, 0xb9, 0xc0, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xbf, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xbf, 0xc2, 0xb8, 0xc1, 0xc1, 0xb8, 0xbf, 0xb8, 0xbf, 0xb4, 0xbd, 0xb8, 0xb9, 0xcc, 0x97, 0x89, 0x7a, 0x15, 0x10, 0x0a, 0x0c, 0x0c, 0x10, 0x10, 0x10, 0x17, 0x10, 0x12, 0x4a, 0x74, 0x79, 0x02, 0xfb, 0xfa, 0xf6, 0xfa, 0xf5, 0xf6, 0xf4, 0xf0, 0xf4, 0xfc, 0xf4, 0xfc, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf0, 0xf3, 0xfa, 0x04, 0x06, 0x76, 0x5a, 0x19, 0x11, 0x17, 0x23, 0x23, 0x21, 0x28, 0x1f, 0x0f, 0x0b, 0x0a, 0x11, 0x2d, 0x15, 0x7e, 0x97, 0xc3, 0xb4, 0xbd, 0xc2, 0xc2, 0xc1, 0xbd, 0xbf, 0xbf, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xb8, 0xc2, 0xc2, 0xb8, 0xbd, 0xbb, 0xbd, 0xc4, 0xb7, 0xc5, 0xdd, 0xdd, 0xe3, 0xe0, 0xe5, 0x86, 0x4b, 0x01, 0x01, 0x01, 0x55, 0x55, 0x49, 0x51, 0x4d, 0x55, 0x55, 0x55, 0x55, 0x51, 0x51, 0x52, 0x52, 0x52, 0x4e, 0x4b, 0x69, 0xe6, 0xda, 0xd9, 0xdd, 0xdd, 0xdd, 0xdd, 0xc8, 0xb9, 0xc7, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xc0, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xbf, 0xc1, 0xc1, 0xc2, 0xc0, 0xb7, 0xbf, 0xb4, 0xbd, 0xb8, 0xc0, 0xc3, 0xbe, 0x7e, 0x12, 0x1d, 0x10, 0x0c, 0x10, 0x17, 0x21, 0x2d, 0x2d, 0x1e, 0x2d, 0x1e, 0x1d, 0x15, 0x19, 0x6d, 0x06, 0x04, 0xf4, 0xfa, 0xf5, 0xf6, 0xf6, 0xf6, 0xf0, 0xf4, 0x9d, 0xf4, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xfc, 0x05, 0x71, 0x33, 0x11, 0x17, 0x21, 0x1e, 0x20, 0x20, 0x1e, 0x17, 0x1d, 0x1f, 0x2c, 0x14, 0x11, 0x11, 0x1c, 0x1a, 0x8d, 0xc6, 0xc9, 0xbd, 0xb4, 0xc2, 0xbd, 0xbd, 0xbf, 0xc5, 0xb8, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc2, 0xc0, 0xb8, 0xc2, 0xb8, 0xbd, 0xbd, 0xbf, 0xc5, 0xb7, 0xcb, 0xe2, 0xdd, 0xde, 0xe3, 0xe5, 0x86, 0x4b, 0x50, 0x01, 0x55, 0x55, 0x55, 0x4d, 0x4d, 0x55, 0x55, 0x55, 0x55, 0x54, 0x52, 0x52, 0x52, 0x51, 0x48, 0x63, 0xe5, 0xe0, 0xd9, 0xe2, 0xdd, 0xd4, 0xdd, 0xcd, 0xb9, 0xc7, 0xbf, 0xbd, 0xc0, 0xc2, 0xc0, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xc0, 0xc2, 0xb8, 0xbf, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xbf, 0xb8, 0xbb, 0xc0, 0xb8, 0xb7, 0xbf, 0xb6, 0xbd, 0xb4, 0xc3, 0xbc, 0x8c, 0x0d, 0x28, 0x1d, 0x18, 0x1e, 0x26, 0x21, 0x2d, 0x1c, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x17, 0x0f, 0x5e, 0x74, 0x79, 0x02, 0xf6, 0xf4, 0xf5, 0xf6, 0x9d, 0xf0, 0x9d, 0x77, 0xf4, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0x77, 0x06, 0x70, 0x33, 0x13, 0x17, 0x1e, 0x20, 0x1c, 0x23, 0x20, 0x22, 0x22, 0x25, 0x17, 0x1f, 0x2c, 0x2c, 0x18, 0x2d, 0x12, 0x80, 0xca, 0xc0, 0xb8, 0xbd, 0xbd, 0xb2, 0xbd, 0xbf, 0xc5, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc7, 0xc2, 0xc7, 0xc2, 0xc7, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc2, 0xb8, 0xc2, 0xc0, 0xc2, 0xc1, 0xbd, 0xb8, 0xb8, 0xc5, 0xc9, 0xc5, 0xd4, 0xe2, 0xd9, 0xe2, 0xe4, 0xe5, 0x8f, 0x4b, 0x01, 0x01, 0x55, 0x53, 0x55, 0x4d, 0x4d, 0x55, 0x4d, 0x51, 0x55, 0x55, 0x4d, 0x55, 0x4f, 0x5e, 0xe5, 0xe1, 0xde, 0xde, 0xd9, 0xd3, 0xdd, 0xcd, 0xcd, 0xc9, 0xc2, 0xbd, 0xb4, 0xb8, 0xc0, 0xc2, 0xb8, 0xb8, 0xc0, 0xc2, 0xb8, 0xc2, 0xb8, 0xbf, 0xc2, 0xbf, 0xc2, 0xbf, 0xc2, 0xbf, 0xb8, 0xbf, 0xb8, 0xc1, 0xc1, 0xc0, 0xbf, 0xb7, 0xb5, 0xbd, 0xb4, 0xb3, 0xcc, 0xbe, 0x7b, 0x1f, 0x21, 0x1e, 0x29, 0x26, 0x26, 0x1c, 0x1c, 0x26, 0x1e, 0x29, 0x1e, 0x26, 0x26, 0x1c, 0x1e, 0x21, 0x12, 0x41, 0x76, 0x04, 0x77, 0xf3, 0xf4, 0xf6, 0xf3, 0x9d, 0x9e, 0x9d, 0xf4, 0xfc, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0x02, 0x05, 0x70, 0x0f, 0x13, 0x1e, 0x1e, 0x22, 0x1c, 0x23, 0x23, 0x23, 0x1c, 0x22, 0x22, 0x22, 0x1e, 0x25, 0x1c, 0x1c, 0x23, 0x2d, 0x7f, 0x97, 0xbc, 0xc7, 0xc2, 0xb3, 0xc4, 0xc4, 0xbf, 0xc0, 0xc0, 0xc2, 0xc0, 0xb8, 0xb8, 0xc0, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc7, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xb8, 0xc7, 0xc9, 0xc9, 0xc9, 0xc5, 0xc7, 0xdd, 0xe2, 0xdd, 0xe2, 0xe3, 0xe5, 0x8f, 0x4b, 0x01, 0x01, 0x55, 0x53, 0x55, 0x4d, 0x51, 0x51, 0x51, 0x55, 0x55, 0x54, 0x50, 0x5a, 0x9c, 0xe0, 0xde, 0xde, 0xd5, 0xd9, 0xd9, 0xd9, 0xc8, 0xc0, 0xc0, 0xc4, 0xc4, 0xc4, 0xc2, 0xb8, 0xb8, 0xc2, 0xc2, 0xc2, 0xb8, 0xc2, 0xc0, 0xc2, 0xb8, 0xc0, 0xb8, 0xc0, 0xb8, 0xc0, 0xc0, 0xc2, 0xc0, 0xc0, 0xc2, 0xbb, 0xc0, 0xb9, 0xc5, 0xbf, 0xb6, 0xb4, 0xc5, 0xca, 0x99, 0x7f, 0x1c, 0x26, 0x26, 0x1e, 0x20, 0x1e, 0x26, 0x26, 0x20, 0x29, 0x1e, 0x29, 0x23, 0x2e, 0x23, 0x29, 0x22, 0x1d, 0x10, 0x41, 0x73, 0x79, 0x77, 0x77, 0xfa, 0xf6, 0x9d, 0x9d, 0x9e, 0x77, 0xfa, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0x02, 0x05, 0x73, 0x33, 0x13, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x23, 0x1c, 0x2c, 0x23, 0x20, 0x22, 0x1e, 0x22, 0x1e, 0x1e, 0x1e, 0x20, 0x2d, 0x28, 0x8e, 0xc8, 0xc3, 0xcb, 0xbf, 0xbd, 0xb2, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xc0, 0xb8, 0xb8, 0xc0, 0xc0, 0xb8, 0xc0, 0xc0, 0xc9, 0xc9, 0xcb, 0xc7, 0xb8, 0xc0, 0xb9, 0xcf, 0xe2, 0xdd, 0xdd, 0xdd, 0xe3, 0xe5, 0x98, 0x4b, 0x01, 0x01, 0x55, 0x53, 0x4d, 0x49, 0x51, 0x55, 0x55, 0x54, 0x50, 0x5a, 0x9c, 0x9b, 0xdc, 0xdd, 0xd9, 0xd9, 0xd9, 0xd9, 0xcd, 0xc8, 0xc0, 0xc4, 0xc4, 0xc4, 0xc4, 0xc9, 0xc7, 0xc2, 0xb8, 0xc2, 0xb8, 0xc0, 0xc2, 0xc7, 0xc7, 0xc0, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xb8, 0xb7, 0xb9, 0xb7, 0xb7, 0xbd, 0xcb, 0xba, 0x97, 0x8d, 0x28, 0x1c, 0x26, 0x20, 0x29, 0x29, 0x23, 0x23, 0x26, 0x26, 0x1e, 0x22, 0x23, 0x23, 0x23, 0x23, 0x20, 0x22, 0x25, 0x25, 0x11, 0x4a, 0x76, 0x77, 0x02, 0xf4, 0xfa, 0xf6, 0x9e, 0x9d, 0x9d, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x04, 0x76, 0x2f, 0x11, 0x1e, 0x26, 0x24, 0x23, 0x23, 0x23, 0x1e, 0x1c, 0x1c, 0x1c, 0x23, 0x20, 0x20, 0x22, 0x22, 0x22, 0x1e, 0x1e, 0x20, 0x28, 0x94, 0xcc, 0xc3, 0xc8, 0xc9, 0xc4, 0xc4, 0xc7, 0xc0, 0xc0, 0xb8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xc9, 0xcb, 0xcb, 0xc9, 0xc4, 0xbd, 0xb4, 0xbd, 0xbd, 0xc7, 0xc0, 0xcd, 0xe2, 0xdd, 0xde, 0xe2, 0xe3, 0xe5, 0x8f, 0x4b, 0x01, 0x64, 0x53, 0x51, 0x54, 0x51, 0x55, 0x52, 0x4e, 0x5a, 0x91, 0xe4, 0xe3, 0xde, 0xde, 0xd5, 0xd9, 0xd9, 0xcd, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc2, 0xcb, 0xc9, 0xcb, 0xc2, 0xc2, 0xc2, 0xb8, 0xb8, 0xb3, 0xb8, 0xc0, 0xc0, 0xb8, 0xc0, 0xb8, 0xc0, 0xb8, 0xc0, 0xb8, 0xc2, 0xc2, 0xc7, 0xc3, 0xcd, 0xc9, 0xc4, 0xc2, 0xba, 0x8e, 0x80, 0x17, 0x26, 0x20, 0x1e, 0x29, 0x20, 0x27, 0x23, 0x23, 0x26, 0x25, 0x26, 0x20, 0x26, 0x23, 0x23, 0x27, 0x20, 0x1e, 0x18, 0x2d, 0x13, 0x5e, 0x78, 0x02, 0x02, 0xfa, 0xf4, 0x9d, 0x9e, 0x9d, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0x78, 0x5e, 0x11, 0x21, 0x20, 0x24, 0x23, 0x30, 0x23, 0x20, 0x1e, 0x22, 0x22, 0x20, 0x23, 0x23, 0x23, 0x20, 0x1e, 0x1e, 0x25, 0x1c, 0x20, 0x19, 0x8b, 0xca, 0xbc, 0xb7, 0xc5, 0xc4, 0xcb, 0xcb, 0xcb, 0xc9, 0xc7, 0xc0, 0xc2, 0xb8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xc7, 0xc7, 0xcb, 0xcb, 0xcb, 0xcb, 0xc7, 0xc7, 0xc0, 0xc0, 0xbf, 0xbd, 0xb2, 0xbd, 0xc4, 0xbd, 0xc5, 0xc7, 0xd1, 0xe2, 0xdb, 0xe2, 0xdd, 0xe3, 0xe5, 0x61, 0x58, 0x01, 0x55, 0x4d, 0x55, 0x55, 0x55, 0x4d, 0x4f, 0x6a, 0xe6, 0xde, 0xe2, 0xd9, 0xdc, 0xd3, 0xdd, 0xcd, 0xc0, 0xc0, 0xbb, 0xc1, 0xbb, 0xc1, 0xc0, 0xc0, 0xc2, 0xc0, 0xc4, 0xc7, 0xcb, 0xc9, 0xcb, 0xc7, 0xcb, 0xc7, 0xc7, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc7, 0xc7, 0xc7, 0xc9, 0xc7, 0xcb, 0xc8, 0xcd, 0xc3, 0xc7, 0xb8, 0xb8, 0x96, 0x8e, 0x7c, 0x1d, 0x26, 0x26, 0x1e, 0x1e, 0x20, 0x24, 0x24, 0x27, 0x1c, 0x25, 0x1e, 0x23, 0x29, 0x20, 0x27, 0x20, 0x23, 0x2e, 0x2a, 0x24, 0x1c, 0x12, 0x6e, 0x03, 0xfc, 0xfd, 0xfa, 0x9d, 0x9e, 0x9d, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf6, 0xfc, 0xfc, 0x77, 0x9d, 0xfb, 0xf3, 0x02, 0x79, 0x6e, 0x18, 0x18, 0x26, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1e, 0x22, 0x1e, 0x20, 0x23, 0x23, 0x23, 0x23, 0x1e, 0x1c, 0x1c, 0x1c, 0x20, 0x1d, 0x7a, 0x8e, 0xc6, 0xc3, 0xb3, 0xb2, 0xb6, 0xc7, 0xc7, 0xcb, 0xcb, 0xcb, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcb, 0xcb, 0xc7, 0xc7, 0xc1, 0xc0, 0xc1, 0xc2, 0xc0, 0xc2, 0xc2, 0xbd, 0xbd, 0xbd, 0xbd, 0xc2, 0xb8, 0xc0, 0xc9, 0xd3, 0xdd, 0xd3, 0xdd, 0xde, 0xe3, 0xe5, 0x8f, 0x58, 0x5d, 0x55, 0x55, 0x55, 0x4d, 0x4a, 0x85, 0xe7, 0xe4, 0xe2, 0xd9, 0xd5, 0xd1, 0xdd, 0xcf, 0xc7, 0xc0, 0xc7, 0xc1, 0xc1, 0xbd, 0xb8, 0xc0, 0xb8, 0xc2, 0xc2, 0xc0, 0xc1, 0xc2, 0xc7, 0xc7, 0xc7, 0xcb, 0xc7, 0xcb, 0xcf, 0xcb, 0xcf, 0xcb, 0xcf, 0xcf, 0xcb, 0xcb, 0xcb, 0xcb, 0xc4, 0xc5, 0xc3, 0xb9, 0xb8, 0xbb, 0xbc, 0x99, 0x80, 0x17, 0x21, 0x20, 0x26, 0x26, 0x29, 0x27, 0x27, 0x23, 0x20, 0x26, 0x1e, 0x26, 0x27, 0x20, 0x29, 0x20, 0x27, 0x23, 0x23, 0x2a, 0x20, 0x29, 0x17, 0x28, 0x75, 0x05, 0xfd, 0xf5, 0xef, 0x9e, 0x9d, 0xfd, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0x9d, 0xf6, 0xfa, 0x02, 0x77, 0xf0, 0xf3, 0xf9, 0x02, 0x76, 0x2f, 0x1c, 0x23, 0x23, 0x23, 0x20, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x27, 0x20, 0x23, 0x23, 0x21, 0x15, 0x8d, 0x97, 0xc8, 0xb4, 0xb2, 0xbf, 0xc0, 0xc0, 0xc2, 0xc2, 0xb8, 0xbd, 0xb8, 0xc4, 0xc2, 0xc4, 0xc2, 0xc4, 0xc1, 0xc1, 0xc1, 0xc1, 0xb8, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc7, 0xc1, 0xc0, 0xc1, 0xc7, 0xcb, 0xd4, 0xdd, 0xd4, 0xd9, 0xdd, 0xe0, 0xe6, 0x8f, 0x58, 0x54, 0x55, 0x55, 0x4f, 0x85, 0xe7, 0xda, 0xe3, 0xdb, 0xd5, 0xd4, 0xd4, 0xcf, 0xcb, 0xb8, 0xc1, 0xc1, 0xb8, 0xc1, 0xb8, 0xc1, 0xb8, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xb8, 0xb3, 0xb4, 0xb7, 0xb9, 0xc0, 0xbb, 0xb8, 0xba, 0x84, 0x28, 0x21, 0x2a, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x27, 0x27, 0x20, 0x27, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x1e, 0x29, 0x17, 0x58, 0x03, 0xfd, 0xf5, 0x9d, 0xef, 0xf4, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf6, 0xfa, 0xfc, 0x77, 0x9d, 0xfe, 0xfa, 0x05, 0x69, 0x11, 0x2a, 0x23, 0x2a, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x27, 0x20, 0x23, 0x23, 0x27, 0x20, 0x26, 0x20, 0x23, 0x20, 0x23, 0x20, 0x2a, 0x1e, 0x15, 0x7d, 0x99, 0xbc, 0xc1, 0xb2, 0xb6, 0xc0, 0xb8, 0xc2, 0xc2, 0xc2, 0xb8, 0xbf, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc7, 0xcf, 0xdd, 0xdd, 0xd1, 0xd5, 0xdd, 0xe4, 0xe5, 0x85, 0x4b, 0x58, 0x4b, 0x69, 0xe7, 0x9b, 0xe3, 0xdb, 0xd6, 0xd5, 0xd1, 0xd4, 0xcb, 0xbb, 0xb8, 0xc1, 0xb8, 0xc1, 0xb8, 0xc1, 0xb8, 0xc1, 0xb8, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc7, 0xc7, 0xc7, 0xc7, 0xc2, 0xbd, 0xb7, 0xc3, 0xb9, 0xbb, 0xc0, 0xca, 0x8e, 0x17, 0x2d, 0x20, 0x23, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x20, 0x27, 0x20, 0x20, 0x20, 0x27, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x1e, 0x21, 0x16, 0x72, 0x78, 0xfb, 0xef, 0x9d, 0x9d, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf6, 0x9d, 0x9d, 0xf0, 0x04, 0x73, 0x16, 0x2c, 0x23, 0x2a, 0x23, 0x23, 0x20, 0x23, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x23, 0x23, 0x20, 0x29, 0x1d, 0x7a, 0x8e, 0xcc, 0xc0, 0xb2, 0xb6, 0xb8, 0xc0, 0xb3, 0xb8, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xb8, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xb8, 0xc1, 0xc1, 0xc0, 0xc1, 0xb8, 0xc1, 0xc1, 0xc7, 0xb8, 0xc0, 0xc7, 0xd1, 0xd5, 0xdd, 0xdd, 0xd4, 0xdd, 0xdc, 0xe5, 0x90, 0x98, 0x91, 0xe7, 0xe4, 0xe3, 0xd5, 0xd5, 0xd6, 0xd9, 0xd4, 0xc5, 0xb8, 0xc0, 0xc1, 0xc7, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb8, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xb8, 0xc1, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xc2, 0xc2, 0xbd, 0xc0, 0xc3, 0xc0, 0xc0, 0xb9, 0x99, 0x80, 0x15, 0x2a, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x20, 0x20, 0x27, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x20, 0x20, 0x27, 0x20, 0x1e, 0x26, 0x13, 0x4a, 0x76, 0x77, 0xf3, 0xef, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xf4, 0xf4, 0xf5, 0xf5, 0x9d, 0xf3, 0x05, 0x5a, 0x14, 0x26, 0x23, 0x2a, 0x23, 0x23, 0x1c, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x25, 0x19, 0x8d, 0xd2, 0xb7, 0xbd, 0xb6, 0xc2, 0xb8, 0xc7, 0xc4, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xb8, 0xc1, 0xc2, 0xc7, 0xc1, 0xc0, 0xc1, 0xc2, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc0, 0xc9, 0xd1, 0xd4, 0xd4, 0xd4, 0xdd, 0xdd, 0xe3, 0xe4, 0xe6, 0xe6, 0xe6, 0xe2, 0xd4, 0xd1, 0xd3, 0xd5, 0xd5, 0xcd, 0xb7, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xb8, 0xc1, 0xb8, 0xc1, 0xb8, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xb8, 0xc1, 0xb8, 0xc1, 0xb8, 0xc2, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc2, 0xbd, 0xb7, 0xc3, 0xc0, 0xc0, 0xc3, 0x99, 0x7f, 0x17, 0x2a, 0x24, 0x20, 0x26, 0x20, 0x20, 0x20, 0x27, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x20, 0x20, 0x27, 0x27, 0x27, 0x20, 0x27, 0x23, 0x26, 0x2d, 0x13, 0x6f, 0x78, 0xf0, 0xf5, 0xf5, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xfc, 0xf5, 0x9d, 0xf5, 0x9d, 0x05, 0x70, 0x1f, 0x18, 0x2e, 0x23, 0x23, 0x23, 0x23, 0x20, 0x23, 0x23, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x24, 0x20, 0x1e, 0x1b, 0x80, 0x99, 0xc8, 0xb6, 0xb6, 0xb8, 0xc0, 0xbd, 0xb8, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xb8, 0xc1, 0xb8, 0xc2, 0xc1, 0xb8, 0xc2, 0xc2, 0xc1, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc2, 0xc7, 0xbb, 0xb7, 0xc9, 0xd1, 0xd4, 0xd4, 0xd4, 0xdd, 0xd4, 0xdd, 0xe3, 0xe3, 0xe2, 0xd4, 0xd4, 0xd1, 0xd1, 0xd3, 0xcd, 0xb8, 0xb8, 0xc7, 0xc2, 0xc1, 0xb8, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc2, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xc0, 0xc2, 0xc2, 0xb8, 0xbd, 0xc2, 0xc0, 0xc3, 0xb9, 0xc8, 0xc6, 0x99, 0x28, 0x2d, 0x24, 0x24, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x20, 0x20, 0x26, 0x27, 0x26, 0x20, 0x29, 0x13, 0x39, 0x76, 0x04, 0xfa, 0xf5, 0x9d, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0x77, 0x9d, 0xf5, 0xef, 0x02, 0x78, 0x5e, 0x14, 0x2e, 0x23, 0x23, 0x1c, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x23, 0x20, 0x24, 0x22, 0x17, 0x7f, 0xd7, 0xd0, 0xb5, 0xbd, 0xb4, 0xc7, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc2, 0xc1, 0xc2, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc7, 0xc2, 0xc2, 0xc1, 0xc1, 0xc7, 0xc0, 0xc9, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd9, 0xdd, 0xd5, 0xcf, 0xd1, 0xd1, 0xd3, 0xcd, 0xb8, 0xb8, 0xc4, 0xc1, 0xb8, 0xc2, 0xc1, 0xb8, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc2, 0xc7, 0xc3, 0xc0, 0xc8, 0xcc, 0x84, 0x19, 0x26, 0x20, 0x24, 0x20, 0x26, 0x20, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x20, 0x27, 0x27, 0x20, 0x20, 0x27, 0x23, 0x20, 0x29, 0x1e, 0x13, 0x70, 0x05, 0xfa, 0xf6, 0xf3, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xfc, 0x9e, 0x9d, 0x77, 0x02, 0x75, 0x1f, 0x1c, 0x20, 0x2e, 0x20, 0x23, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x23, 0x24, 0x2b, 0x1d, 0x28, 0x99, 0xd0, 0xb6, 0xb6, 0xbd, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc4, 0xc1, 0xbd, 0xb7, 0xc9, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd1, 0xd0, 0xd1, 0xd0, 0xd1, 0xd1, 0xcf, 0xb8, 0xc1, 0xc1, 0xbb, 0xb8, 0xc1, 0xb8, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb8, 0xc2, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc2, 0xc2, 0xc0, 0xc8, 0xc3, 0xc8, 0xca, 0x84, 0x19, 0x23, 0x20, 0x20, 0x27, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x20, 0x27, 0x20, 0x2a, 0x23, 0x20, 0x22, 0x20, 0x10, 0x5e, 0x76, 0x78, 0xf4, 0xf0, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0xf4, 0x9d, 0x9e, 0xf4, 0x05, 0x6c, 0x14, 0x2a, 0x2a, 0x20, 0x23, 0x20, 0x20, 0x23, 0x20, 0x1c, 0x20, 0x1c, 0x20, 0x1c, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x1c, 0x24, 0x22, 0x18, 0x28, 0x99, 0xd0, 0xc4, 0xb6, 0xc2, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xb8, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xb8, 0xc1, 0xb8, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb8, 0xc0, 0xc9, 0xd1, 0xdd, 0xd0, 0xd4, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xcf, 0xc7, 0xb8, 0xb8, 0xbb, 0xb8, 0xc1, 0xc1, 0xc1, 0xb8, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xb8, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc5, 0xc8, 0xc0, 0xc8, 0x99, 0x8e, 0x21, 0x1c, 0x24, 0x29, 0x20, 0x26, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x26, 0x27, 0x24, 0x24, 0x26, 0x2f, 0x71, 0x06, 0xf3, 0xfb, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0x77, 0x9e, 0x9e, 0x02, 0x76, 0x48, 0x18, 0x20, 0x2a, 0x23, 0x20, 0x23, 0x23, 0x20, 0x23, 0x23, 0x23, 0x20, 0x23, 0x23, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x23, 0x23, 0x21, 0x24, 0x22, 0x26, 0x12, 0x84, 0xd0, 0xcb, 0xb6, 0xc2, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc0, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc7, 0xc0, 0xb7, 0xc2, 0xc1, 0xc4, 0xc0, 0xb8, 0xcd, 0xd3, 0xd1, 0xd4, 0xd1, 0xd1, 0xd1, 0xd1, 0xcd, 0xc0, 0xb8, 0xc4, 0xbd, 0xb8, 0xb8, 0xb8, 0xc1, 0xb8, 0xc1, 0xb8, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc2, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc2, 0xb8, 0xc8, 0xc3, 0xc8, 0xc8, 0xd2, 0x83, 0x1b, 0x26, 0x20, 0x2a, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x27, 0x20, 0x26, 0x27, 0x1c, 0x20, 0x20, 0x20, 0x23, 0x14, 0x69, 0x05, 0x77, 0xfa, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfc, 0x9d, 0x77, 0x04, 0x6f, 0x1f, 0x2c, 0x2a, 0x26, 0x1e, 0x23, 0x27, 0x23, 0x23, 0x23, 0x20, 0x1c, 0x23, 0x20, 0x1c, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x1c, 0x29, 0x20, 0x20, 0x19, 0x99, 0xd0, 0xcf, 0xc4, 0xbd, 0xb8, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc1, 0xc0, 0xc0, 0xb7, 0xc1, 0xc1, 0xc1, 0xc7, 0xb8, 0xcd, 0xd4, 0xd3, 0xcf, 0xd4, 0xcf, 0xcf, 0xc7, 0xb8, 0xc1, 0xbd, 0xc1, 0xb8, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc7, 0xc8, 0xc8, 0xc8, 0x99, 0x84, 0x13, 0x26, 0x1e, 0x29, 0x26, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x27, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x20, 0x27, 0x1e, 0x20, 0x2a, 0x23, 0x23, 0x13, 0x39, 0x03, 0x77, 0xfe, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xfc, 0xfd, 0xf5, 0x77, 0x06, 0x59, 0x2c, 0x23, 0x2e, 0x26, 0x1e, 0x23, 0x27, 0x27, 0x27, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x1e, 0x1e, 0x20, 0x26, 0x10, 0x84, 0xd0, 0xcf, 0xcb, 0xb3, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc7, 0xc1, 0xc1, 0xc7, 0xc1, 0xc7, 0xb8, 0xc7, 0xcb, 0xd4, 0xd4, 0xd3, 0xcf, 0xc8, 0xc0, 0xc0, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xb8, 0xbd, 0xb8, 0xbd, 0xb8, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc8, 0xc0, 0xc8, 0xd1, 0x99, 0x83, 0x17, 0x26, 0x1e, 0x25, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x26, 0x20, 0x26, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x27, 0x20, 0x23, 0x20, 0x23, 0x23, 0x2e, 0x23, 0x29, 0x17, 0x73, 0x04, 0xf5, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xfa, 0xfa, 0xfe, 0x76, 0x39, 0x18, 0x30, 0x2e, 0x1e, 0x26, 0x27, 0x23, 0x27, 0x23, 0x2a, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x20, 0x1e, 0x20, 0x20, 0x13, 0x8e, 0xd0, 0xd1, 0xcb, 0xbf, 0xb4, 0xc4, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc1, 0xc0, 0xc1, 0xc0, 0xc7, 0xc1, 0xc7, 0xcb, 0xdd, 0xcf, 0xc9, 0xb8, 0xb8, 0xc0, 0xc1, 0xb8, 0xbd, 0xbb, 0xbd, 0xc1, 0xbd, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc7, 0xc1, 0xbd, 0xbd, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc7, 0xc0, 0xc8, 0xc9, 0xcd, 0xdf, 0x83, 0x13, 0x26, 0x1e, 0x25, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x27, 0x20, 0x26, 0x20, 0x27, 0x20, 0x27, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x29, 0x27, 0x29, 0x23, 0x2c, 0x23, 0x22, 0x13, 0x69, 0x03, 0x9d, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xfc, 0xfd, 0xf3, 0x79, 0x71, 0x14, 0x18, 0x2e, 0x23, 0x26, 0x1e, 0x27, 0x23, 0x27, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x20, 0x1e, 0x20, 0x1c, 0x17, 0x8e, 0xdc, 0xcf, 0xcf, 0xc2, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc7, 0xc7, 0xb8, 0xc7, 0xcf, 0xcd, 0xb8, 0xc0, 0xc0, 0xb8, 0xc1, 0xbd, 0xbd, 0xc1, 0xbd, 0xc1, 0xb8, 0xc1, 0xb4, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xb8, 0xc1, 0xb8, 0xc1, 0xc7, 0xc0, 0xc7, 0xd0, 0xcd, 0xdf, 0x83, 0x1f, 0x26, 0x29, 0x1e, 0x27, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x26, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x27, 0x20, 0x27, 0x20, 0x23, 0x23, 0x23, 0x22, 0x18, 0x4a, 0x03, 0x9d, 0x9e, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x77, 0xfb, 0xfd, 0x78, 0x69, 0x13, 0x2e, 0x2e, 0x23, 0x20, 0x1e, 0x27, 0x23, 0x27, 0x23, 0x2a, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x24, 0x20, 0x20, 0x20, 0x1b, 0x8e, 0xdc, 0xcf, 0xd4, 0xc9, 0xb8, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc0, 0xc7, 0xc1, 0xb8, 0xc7, 0xb8, 0xc7, 0xc0, 0xc0, 0xc7, 0xc1, 0xc2, 0xb8, 0xc1, 0xbd, 0xbb, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xb8, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xbd, 0xbd, 0xbd, 0xc1, 0xc1, 0xbd, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xc7, 0xc5, 0xc8, 0xd1, 0xd0, 0xd7, 0x84, 0x1f, 0x20, 0x27, 0x1e, 0x27, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x27, 0x20, 0x27, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x29, 0x20, 0x2a, 0x23, 0x27, 0x22, 0x18, 0x1f, 0x73, 0x04, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xfe, 0xfe, 0x76, 0x4a, 0x13, 0x2a, 0x23, 0x23, 0x29, 0x1e, 0x27, 0x26, 0x27, 0x2a, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x24, 0x20, 0x20, 0x1c, 0x1b, 0x8e, 0xdc, 0xcf, 0xd1, 0xcd, 0xb8, 0xc1, 0xbd, 0xc2, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xc1, 0xc0, 0xc2, 0xc2, 0xc2, 0xbd, 0xc0, 0xc4, 0xb8, 0xbd, 0xc0, 0xc0, 0xc0, 0xb8, 0xc0, 0xc1, 0xc1, 0xbd, 0xbd, 0xc1, 0xbd, 0xb8, 0xbd, 0xb8, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xbd, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc7, 0xb7, 0xcd, 0xd1, 0xd0, 0xd7, 0x85, 0x1f, 0x1c, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x27, 0x27, 0x29, 0x27, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x27, 0x20, 0x29, 0x20, 0x27, 0x29, 0x20, 0x26, 0x16, 0x6e, 0x78, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x77, 0x77, 0x04, 0x73, 0x2f, 0x21, 0x2a, 0x2e, 0x23, 0x29, 0x1e, 0x20, 0x23, 0x27, 0x23, 0x27, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x24, 0x20, 0x26, 0x1c, 0x19, 0x99, 0xd9, 0xcf, 0xd3, 0xcd, 0xc7, 0xb8, 0xbd, 0xc2, 0xc1, 0xc2, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xc1, 0xc2, 0xc2, 0xc1, 0xb8, 0xc4, 0xc1, 0xc2, 0xc1, 0xc2, 0xc2, 0xc0, 0xc1, 0xb8, 0xc2, 0xc1, 0xb8, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xc2, 0xc1, 0xc2, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xc1, 0xbd, 0xc2, 0xc1, 0xc2, 0xc2, 0xc2, 0xc0, 0xc7, 0xc2, 0xc2, 0xc8, 0xcd, 0xd1, 0xd5, 0xd7, 0x90, 0x28, 0x1c, 0x27, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x2a, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x20, 0x20, 0x29, 0x27, 0x20, 0x27, 0x29, 0x20, 0x20, 0x1c, 0x17, 0x57, 0x05, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x9d, 0x77, 0x05, 0x6e, 0x1f, 0x26, 0x27, 0x23, 0x2a, 0x20, 0x1e, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x24, 0x20, 0x26, 0x18, 0x28, 0x99, 0xd1, 0xd3, 0xd3, 0xd0, 0xc9, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc2, 0xc1, 0xc1, 0xc2, 0xc2, 0xc2, 0xc1, 0xc2, 0xc1, 0xbd, 0xc2, 0xbb, 0xb8, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc2, 0xbd, 0xc1, 0xc2, 0xc2, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc1, 0xbd, 0xbd, 0xc4, 0xc1, 0xc4, 0xc0, 0xc1, 0xc7, 0xc7, 0xc7, 0xc0, 0xc9, 0xd0, 0xd1, 0xd1, 0xda, 0x90, 0x33, 0x18, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x27, 0x20, 0x27, 0x29, 0x20, 0x20, 0x2b, 0x27, 0x23, 0x17, 0x48, 0x76, 0x02, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf0, 0x77, 0x05, 0x68, 0x17, 0x1c, 0x24, 0x23, 0x23, 0x20, 0x20, 0x20, 0x23, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x24, 0x20, 0x18, 0x17, 0x7c, 0xdf, 0xd1, 0xcf, 0xd4, 0xd0, 0xcd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xbd, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xb4, 0xc2, 0xbd, 0xb8, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc1, 0xc4, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc4, 0xc7, 0xcd, 0xd0, 0xd1, 0xd5, 0xd6, 0x9b, 0x41, 0x1b, 0x2a, 0x1e, 0x27, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x20, 0x20, 0x26, 0x20, 0x22, 0x20, 0x2a, 0x32, 0x17, 0x2f, 0x73, 0x05, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0x9e, 0xfb, 0x03, 0x4a, 0x2c, 0x24, 0x2a, 0x2e, 0x2a, 0x20, 0x1e, 0x23, 0x23, 0x20, 0x23, 0x23, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x24, 0x20, 0x1e, 0x18, 0x1d, 0x7f, 0x9b, 0xcf, 0xd4, 0xd3, 0xd5, 0xcf, 0xc4, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1, 0xbf, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1, 0xc1, 0xb8, 0xbb, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xbd, 0xc1, 0xc1, 0xbd, 0xc7, 0xc1, 0xc7, 0xc7, 0xc7, 0xc0, 0xd1, 0xd0, 0xd1, 0xd1, 0xd6, 0x9b, 0x82, 0x1b, 0x26, 0x1e, 0x20, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x26, 0x20, 0x26, 0x27, 0x26, 0x27, 0x22, 0x20, 0x2e, 0x37, 0x2d, 0x21, 0x6f, 0x05, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0x9d, 0xfe, 0x76, 0x3a, 0x2c, 0x2b, 0x32, 0x32, 0x2e, 0x1c, 0x20, 0x20, 0x23, 0x23, 0x23, 0x20, 0x23, 0x20, 0x26, 0x20, 0x26, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x24, 0x2a, 0x17, 0x1d, 0x41, 0xe0, 0xcf, 0xd4, 0xcf, 0xd5, 0xcd, 0xcb, 0xbd, 0xc1, 0xc1, 0xc4, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1, 0xbd, 0xbd, 0xc2, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xb8, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc0, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0, 0xc1, 0xc7, 0xc7, 0xc9, 0xd1, 0xd6, 0xd1, 0xd3, 0xd5, 0xdf, 0x83, 0x1b, 0x18, 0x1e, 0x27, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x20, 0x26, 0x27, 0x26, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x20, 0x23, 0x23, 0x20, 0x22, 0x24, 0x23, 0x35, 0x37, 0x1b, 0x6c, 0x05, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0x9d, 0x78, 0x73, 0x3a, 0x23, 0x2e, 0x38, 0x32, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x23, 0x23, 0x20, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x29, 0x1c, 0x1b, 0x8d, 0xe0, 0xd4, 0xd3, 0xd1, 0xd1, 0xcf, 0xc9, 0xc2, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xbd, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc4, 0xc1, 0xc4, 0xc0, 0xc4, 0xc7, 0xc7, 0xc8, 0xd5, 0xd1, 0xd5, 0xd3, 0xd6, 0xda, 0x84, 0x7c, 0x18, 0x24, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x26, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x27, 0x27, 0x2a, 0x20, 0x26, 0x27, 0x1e, 0x24, 0x18, 0x32, 0x37, 0x2c, 0x65, 0x05, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf0, 0x78, 0x70, 0x36, 0x30, 0x34, 0x3e, 0x32, 0x23, 0x27, 0x20, 0x20, 0x29, 0x27, 0x20, 0x20, 0x27, 0x24, 0x23, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x27, 0x27, 0x27, 0x27, 0x1e, 0x2a, 0x2a, 0x19, 0x99, 0xd4, 0xd1, 0xd6, 0xd2, 0xd1, 0xcf, 0xcf, 0xb3, 0xc7, 0xb3, 0xbd, 0xbd, 0xbd, 0xbd, 0xc0, 0xc1, 0xc1, 0xc1, 0xb8, 0xbd, 0xb8, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc4, 0xc1, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc2, 0xbd, 0xbd, 0xc4, 0xc2, 0xc0, 0xc9, 0xc0, 0xd0, 0xd1, 0xd3, 0xd1, 0xd6, 0xd6, 0xda, 0x99, 0x7e, 0x1c, 0x24, 0x20, 0x1e, 0x20, 0x1e, 0x20, 0x20, 0x2a, 0x27, 0x2a, 0x24, 0x27, 0x20, 0x29, 0x1e, 0x1e, 0x29, 0x20, 0x2a, 0x24, 0x24, 0x24, 0x20, 0x20, 0x26, 0x29, 0x27, 0x20, 0x2e, 0x44, 0x35, 0x58, 0x03, 0x02, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0x78, 0x70, 0x2c, 0x37, 0x34, 0x43, 0x34, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x24, 0x20, 0x20, 0x24, 0x23, 0x24, 0x23, 0x20, 0x23, 0x20, 0x23, 0x20, 0x27, 0x27, 0x27, 0x2a, 0x20, 0x26, 0x31, 0x18, 0x7f, 0x99, 0xd1, 0xd3, 0xd6, 0xd0, 0xd4, 0xcf, 0xcf, 0xc2, 0xc2, 0xbf, 0xbd, 0xbd, 0xbd, 0xc1, 0xc1, 0xc1, 0xc0, 0xbd, 0xbd, 0xb8, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc0, 0xc7, 0xc1, 0xc1, 0xc4, 0xc1, 0xbf, 0xc7, 0xc2, 0xc7, 0xb9, 0xd0, 0xd5, 0xd3, 0xd1, 0xd6, 0xd8, 0xd8, 0x9b, 0x80, 0x18, 0x24, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x27, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x20, 0x2a, 0x24, 0x2e, 0x24, 0x24, 0x29, 0x26, 0x26, 0x20, 0x24, 0x20, 0x46, 0x36, 0x4f, 0x76, 0x78, 0xf3, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0x78, 0x6e, 0x36, 0x37, 0x3e, 0x43, 0x31, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x31, 0x20, 0x20, 0x20, 0x23, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x27, 0x20, 0x27, 0x27, 0x1e, 0x2a, 0x18, 0x7f, 0x9b, 0xd1, 0xd3, 0xd6, 0xd6, 0xd1, 0xcf, 0xd4, 0xc7, 0xc2, 0xbd, 0xc4, 0xbd, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xb8, 0xbd, 0xb8, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc4, 0xc1, 0xc1, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc4, 0xc1, 0xbd, 0xc7, 0xc2, 0xc0, 0xc0, 0xd6, 0xd5, 0xd3, 0xd5, 0xd0, 0xd6, 0xd8, 0x9b, 0x8d, 0x21, 0x18, 0x20, 0x1e, 0x20, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x24, 0x2e, 0x24, 0x24, 0x2a, 0x27, 0x20, 0x27, 0x20, 0x20, 0x46, 0x35, 0x48, 0x75, 0x79, 0xf3, 0x02, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0x78, 0x6d, 0x2f, 0x40, 0x3e, 0x43, 0x2e, 0x20, 0x20, 0x20, 0x23, 0x20, 0x31, 0x32, 0x20, 0x20, 0x23, 0x24, 0x20, 0x23, 0x20, 0x27, 0x27, 0x20, 0x27, 0x20, 0x27, 0x24, 0x27, 0x27, 0x20, 0x24, 0x26, 0x1c, 0x8d, 0x9b, 0xd1, 0xd3, 0xd6, 0xd5, 0xd4, 0xd4, 0xd1, 0xcf, 0xc2, 0xc2, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xb8, 0xc1, 0xbd, 0xb8, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc4, 0xc1, 0xc1, 0xc4, 0xc1, 0xc1, 0xc0, 0xc1, 0xc4, 0xc1, 0xc4, 0xbf, 0xc7, 0xc7, 0xb9, 0xcd, 0xd5, 0xd5, 0xd3, 0xd5, 0xd6, 0xd8, 0xd0, 0xe0, 0x84, 0x28, 0x18, 0x1e, 0x20, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x29, 0x20, 0x20, 0x27, 0x27, 0x23, 0x38, 0x31, 0x32, 0x2b, 0x26, 0x23, 0x23, 0x24, 0x20, 0x47, 0x42, 0x42, 0x75, 0xfe, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x9d, 0x78, 0x6d, 0x36, 0x40, 0x40, 0x3e, 0x2e, 0x20, 0x24, 0x24, 0x23, 0x23, 0x43, 0x32, 0x20, 0x24, 0x20, 0x24, 0x20, 0x24, 0x23, 0x20, 0x20, 0x27, 0x20, 0x20, 0x27, 0x27, 0x27, 0x24, 0x27, 0x20, 0x1c, 0x1f, 0x84, 0x99, 0xd4, 0xd4, 0xd5, 0xd5, 0xcf, 0xd4, 0xcf, 0xd1, 0xc7, 0xc2, 0xb3, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xb8, 0xbd, 0xb8, 0xbd, 0xc1, 0xc2, 0xc1, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xc1, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xc1, 0xc2, 0xc1, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc4, 0xc2, 0xc7, 0xc1, 0xc1, 0xc1, 0xc4, 0xc2, 0xc7, 0xc7, 0xc0, 0xcd, 0xd9, 0xd1, 0xd5, 0xd5, 0xd8, 0xd6, 0xd6, 0xda, 0x90, 0x7f, 0x18, 0x1c, 0x20, 0x20, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x24, 0x20, 0x20, 0x20, 0x2a, 0x2a, 0x27, 0x23, 0x40, 0x32, 0x2b, 0x2e, 0x20, 0x23, 0x20, 0x24, 0x31, 0x47, 0x42, 0x3d, 0x70, 0x79, 0xf3, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x78, 0x6c, 0x36, 0x40, 0x3e, 0x45, 0x2e, 0x20, 0x23, 0x20, 0x2e, 0x38, 0x47, 0x2e, 0x24, 0x24, 0x20, 0x23, 0x24, 0x2a, 0x24, 0x20, 0x20, 0x20, 0x27, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x21, 0x28, 0x90, 0xd0, 0xd4, 0xd3, 0xd3, 0xd5, 0xd4, 0xd4, 0xd3, 0xd1, 0xcb, 0xb8, 0xc2, 0xbd, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xb8, 0xbd, 0xb8, 0xbd, 0xc1, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xbd, 0xc2, 0xc1, 0xc4, 0xc1, 0xc4, 0xc1, 0xc4, 0xc1, 0xc2, 0xc2, 0xbd, 0xc2, 0xc1, 0xc7, 0xc1, 0xc4, 0xc2, 0xc2, 0xc2, 0xc9, 0xb9, 0xc8, 0xd5, 0xd5, 0xd5, 0xd3, 0xd5, 0xd8, 0xd5, 0xd8, 0xd0, 0x9b, 0x80, 0x1b, 0x20, 0x1c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x32, 0x1e, 0x2a, 0x27, 0x20, 0x27, 0x23, 0x24, 0x38, 0x38, 0x29, 0x38, 0x32, 0x23, 0x24, 0x24, 0x38, 0x47, 0x37, 0x3d, 0x70, 0x79, 0x77, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x77, 0x78, 0x6c, 0x36, 0x40, 0x40, 0x3e, 0x40, 0x32, 0x32, 0x23, 0x34, 0x40, 0x47, 0x31, 0x20, 0x24, 0x20, 0x20, 0x24, 0x32, 0x2a, 0x20, 0x20, 0x20, 0x27, 0x20, 0x20, 0x27, 0x20, 0x27, 0x24, 0x2b, 0x17, 0x80, 0x9a, 0xdc, 0xd1, 0xd4, 0xd5, 0xd5, 0xd1, 0xd1, 0xd1, 0xd1, 0xcf, 0xb8, 0xc2, 0xc2, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xb8, 0xbd, 0xb8, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc7, 0xc1, 0xc1, 0xc2, 0xc0, 0xc7, 0xc8, 0xc9, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd8, 0xd6, 0xd3, 0xd8, 0xdf, 0x84, 0x12, 0x26, 0x20, 0x20, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x38, 0x24, 0x20, 0x20, 0x2a, 0x2a, 0x23, 0x2e, 0x43, 0x38, 0x24, 0x2e, 0x47, 0x37, 0x23, 0x31, 0x3e, 0x47, 0x44, 0x36, 0x70, 0x79, 0xf4, 0x77, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x78, 0x6c, 0x36, 0x40, 0x3f, 0x3f, 0x40, 0x43, 0x40, 0x32, 0x3c, 0x43, 0x47, 0x24, 0x23, 0x2b, 0x24, 0x20, 0x2a, 0x32, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x20, 0x24, 0x20, 0x29, 0x2b, 0x1b, 0x82, 0xdf, 0xd9, 0xd4, 0xd4, 0xd5, 0xd3, 0xd5, 0xd3, 0xd1, 0xd3, 0xcf, 0xc7, 0xc2, 0xc2, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xb8, 0xbd, 0xb8, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc4, 0xc1, 0xc1, 0xc4, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc7, 0xc1, 0xc4, 0xc2, 0xc2, 0xc7, 0xc0, 0xc8, 0xcd, 0xd5, 0xd5, 0xd3, 0xd5, 0xd0, 0xd8, 0xd5, 0xd5, 0xd1, 0xda, 0x84, 0x28, 0x23, 0x18, 0x20, 0x20, 0x20, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x38, 0x20, 0x20, 0x2a, 0x23, 0x20, 0x2e, 0x43, 0x38, 0x24, 0x24, 0x37, 0x43, 0x2e, 0x38, 0x43, 0x43, 0x42, 0x35, 0x6f, 0x79, 0x77, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0x05, 0x6c, 0x36, 0x44, 0x45, 0x3f, 0x40, 0x40, 0x40, 0x37, 0x40, 0x40, 0x40, 0x31, 0x20, 0x20, 0x24, 0x20, 0x32, 0x37, 0x20, 0x20, 0x20, 0x20, 0x29, 0x24, 0x24, 0x27, 0x20, 0x29, 0x24, 0x22, 0x1b, 0x84, 0xda, 0xd0, 0xd4, 0xd4, 0xd3, 0xd6, 0xd0, 0xd5, 0xd1, 0xd5, 0xd3, 0xc9, 0xc7, 0xc2, 0xbd, 0xbd, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xb8, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xbd, 0xc1, 0xc1, 0xc7, 0xbd, 0xc2, 0xc1, 0xc0, 0xc8, 0xc8, 0xd3, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd8, 0xd6, 0xd3, 0xdd, 0xd2, 0x9b, 0x41, 0x18, 0x20, 0x1c, 0x20, 0x1e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x2e, 0x38, 0x2e, 0x20, 0x23, 0x23, 0x23, 0x32, 0x3e, 0x38, 0x2e, 0x31, 0x30, 0x46, 0x47, 0x3e, 0x43, 0x43, 0x44, 0x36, 0x6f, 0x06, 0x9d, 0x02, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x78, 0x6c, 0x36, 0x3b, 0x3f, 0x3f, 0x40, 0x40, 0x38, 0x46, 0x45, 0x3c, 0x43, 0x34, 0x24, 0x20, 0x24, 0x29, 0x43, 0x38, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x29, 0x20, 0x24, 0x20, 0x20, 0x22, 0x39, 0x84, 0xe0, 0xd1, 0xd4, 0xd1, 0xd3, 0xd6, 0xd5, 0xd6, 0xd1, 0xd3, 0xd4, 0xcb, 0xc0, 0xc2, 0xbd, 0xbd, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc4, 0xc1, 0xc1, 0xc4, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xbd, 0xc0, 0xc1, 0xc1, 0xc4, 0xc2, 0xc7, 0xc0, 0xc0, 0xc8, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd8, 0xd0, 0xd9, 0xd3, 0xd3, 0xdc, 0xdf, 0x57, 0x1c, 0x1c, 0x20, 0x20, 0x22, 0x20, 0x22, 0x20, 0x20, 0x20, 0x24, 0x20, 0x47, 0x32, 0x23, 0x20, 0x20, 0x32, 0x3e, 0x40, 0x3c, 0x31, 0x34, 0x37, 0x3c, 0x40, 0x43, 0x43, 0x43, 0x44, 0x36, 0x6f, 0x79, 0x77, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0x05, 0x6d, 0x36, 0x40, 0x3f, 0x45, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3e, 0x38, 0x23, 0x31, 0x40, 0x43, 0x37, 0x20, 0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x1e, 0x2a, 0x2a, 0x24, 0x18, 0x41, 0x9b, 0xd9, 0xd3, 0xd4, 0xd5, 0xd4, 0xd3, 0xd0, 0xd5, 0xd5, 0xd1, 0xd3, 0xcf, 0xc7, 0xc2, 0xc2, 0xbd, 0xc1, 0xc2, 0xc4, 0xb4, 0xb3, 0xc1, 0xc4, 0xb8, 0xbd, 0xc1, 0xc1, 0xbd, 0xc2, 0xc1, 0xbd, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xb8, 0xc1, 0xc0, 0xc1, 0xc2, 0xc7, 0xc1, 0xc2, 0xc2, 0xc2, 0xbd, 0xbd, 0xc1, 0xc1, 0xbd, 0xbd, 0xc4, 0xc1, 0xbd, 0xbd, 0xbd, 0xbd, 0xc1, 0xbd, 0xbd, 0xc4, 0xbd, 0xbd, 0xc4, 0xbd, 0xb8, 0xbd, 0xc1, 0xc1, 0xc4, 0xc4, 0xc1, 0xc4, 0xc1, 0xbd, 0xc1, 0xc2, 0xc4, 0xc7, 0xbd, 0xb8, 0xc2, 0xc0, 0xc3, 0xcd, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd8, 0xd6, 0xd5, 0xd5, 0xd6, 0xd7, 0x84, 0x2c, 0x2d, 0x24, 0x29, 0x1e, 0x1e, 0x24, 0x24, 0x20, 0x1e, 0x20, 0x23, 0x3e, 0x38, 0x32, 0x23, 0x2e, 0x38, 0x43, 0x40, 0x3e, 0x40, 0x3c, 0x46, 0x40, 0x40, 0x3c, 0x45, 0x43, 0x43, 0x36, 0x70, 0xf8, 0xf4, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfc, 0x05, 0x6d, 0x36, 0x40, 0x40, 0x3f, 0x46, 0x40, 0x40, 0x43, 0x3c, 0x40, 0x3c, 0x40, 0x40, 0x3c, 0x3c, 0x43, 0x43, 0x34, 0x1c, 0x24, 0x24, 0x20, 0x2b, 0x29, 0x1e, 0x26, 0x32, 0x24, 0x2e, 0x21, 0x83, 0xdf, 0xd9, 0xd1, 0xd6, 0xd5, 0xd5, 0xd3, 0xd3, 0xd5, 0xd0, 0xd5, 0xd1, 0xd1, 0xc7, 0xc2, 0xc4, 0xc2, 0xc2, 0xc4, 0xb8, 0xc7, 0xc4, 0xc2, 0xbd, 0xc4, 0xc2, 0xc4, 0xc2, 0xc4, 0xc1, 0xcb, 0xc1, 0xc1, 0xc4, 0xb8, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 0xc7, 0xc7, 0xc4, 0xc7, 0xcb, 0xc0, 0xc2, 0xc7, 0xc7, 0xbf, 0xbd, 0xbf, 0xbd, 0xbd, 0xbf, 0xbd, 0xc4, 0xc4, 0xb3, 0xc4, 0xbf, 0xbd, 0xc4, 0xbd, 0xbd, 0xb4, 0xbf, 0xbd, 0xb3, 0xbd, 0xcb, 0xc4, 0xc4, 0xc4, 0xc2, 0xc4, 0xc2, 0xc4, 0xbd, 0xc2, 0xbd, 0xc2, 0xb8, 0xc2, 0xbf, 0xc7, 0xc7, 0xc0, 0xc8, 0xd1, 0xd5, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd8, 0xd6, 0x9a, 0x41, 0x2d, 0x29, 0x29, 0x1e, 0x18, 0x24, 0x2b, 0x20, 0x1e, 0x23, 0x2e, 0x40, 0x3e, 0x3c, 0x38, 0x38, 0x40, 0x43, 0x43, 0x40, 0x3e, 0x40, 0x40, 0x40, 0x43, 0x3f, 0x43, 0x43, 0x37, 0x36, 0x70, 0xf8, 0x9d, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0x78, 0x6f, 0x36, 0x40, 0x40, 0x40, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x3c, 0x40, 0x3c, 0x38, 0x23, 0x20, 0x20, 0x24, 0x2b, 0x20, 0x27, 0x38, 0x32, 0x20, 0x23, 0x2f, 0x84, 0xe0, 0xd1, 0xd3, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd0, 0xd5, 0xd1, 0xd5, 0xd3, 0xc9, 0xc2, 0xc2, 0xc4, 0xc1, 0xc2, 0xc4, 0xb8, 0xb3, 0xc0, 0xc2, 0xb8, 0xc2, 0xc4, 0xc7, 0xc4, 0xc7, 0xcb, 0xc7, 0xc1, 0xb8, 0xc1, 0xc7, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc7, 0xc7, 0xc2, 0xc7, 0xc7, 0xcb, 0xc7, 0xb8, 0xc7, 0xc2, 0xc1, 0xbd, 0xc2, 0xc2, 0xc2, 0xc1, 0xbd, 0xc2, 0xcb, 0xb4, 0xc2, 0xc4, 0xc2, 0xbd, 0xc2, 0xbf, 0xc4, 0xb8, 0xbd, 0xc2, 0xc2, 0xbd, 0xcb, 0xc7, 0xc2, 0xc7, 0xc2, 0xc7, 0xc2, 0xc0, 0xc2, 0xc2, 0xc7, 0xc2, 0xc2, 0xcb, 0xc7, 0xc0, 0xc0, 0xcd, 0xd1, 0xd6, 0xd5, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xdf, 0x57, 0x2d, 0x32, 0x2b, 0x32, 0x1e, 0x20, 0x2b, 0x24, 0x1e, 0x23, 0x2e, 0x3e, 0x32, 0x3e, 0x43, 0x43, 0x43, 0x40, 0x40, 0x3e, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x43, 0x43, 0x36, 0x70, 0xf8, 0xf3, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfd, 0x78, 0x70, 0x36, 0x44, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x43, 0x3c, 0x40, 0x3c, 0x40, 0x40, 0x3c, 0x40, 0x43, 0x43, 0x34, 0x20, 0x20, 0x24, 0x24, 0x24, 0x23, 0x38, 0x43, 0x2e, 0x23, 0x2e, 0x41, 0x90, 0xe0, 0xd3, 0xdd, 0xd5, 0xd5, 0xd3, 0xd5, 0xd1, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xcb, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xb8, 0xcb, 0xcf, 0xc0, 0xb8, 0xc2, 0xc0, 0xc2, 0xc0, 0xcb, 0xcb, 0xd3, 0xc7, 0xc1, 0xc7, 0xc7, 0xc1, 0xc0, 0xc7, 0xc0, 0xc7, 0xc7, 0xc4, 0xb8, 0xcb, 0xcb, 0xc2, 0xc7, 0xcb, 0xc7, 0xb8, 0xc7, 0xc7, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc2, 0xcb, 0xcf, 0xc2, 0xc7, 0xc7, 0xc7, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xb8, 0xb8, 0xc7, 0xcf, 0xd4, 0xc9, 0xcb, 0xcb, 0xc0, 0xb8, 0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0xc7, 0xcb, 0xc9, 0xc7, 0xc7, 0xc8, 0xcd, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd8, 0xd6, 0xdf, 0x84, 0x39, 0x37, 0x31, 0x31, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x43, 0x38, 0x3c, 0x3e, 0x40, 0x3e, 0x40, 0x43, 0x47, 0x3e, 0x40, 0x40, 0x43, 0x3e, 0x46, 0x3e, 0x43, 0x37, 0x36, 0x73, 0xf8, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x78, 0x70, 0x3d, 0x3b, 0x40, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x40, 0x40, 0x3c, 0x2e, 0x20, 0x20, 0x2a, 0x20, 0x23, 0x34, 0x43, 0x3e, 0x2e, 0x2e, 0x2d, 0x57, 0x9b, 0xdc, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd3, 0xd1, 0xd6, 0xd5, 0xd5, 0xd3, 0xd4, 0xd1, 0xb8, 0xc7, 0xc2, 0xc2, 0xc1, 0xc7, 0xc7, 0xcf, 0xd4, 0xcf, 0xc7, 0xc7, 0xcb, 0xcf, 0xd4, 0xd4, 0xc1, 0xdd, 0xd3, 0xaf, 0xc7, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0xc7, 0xcf, 0xcf, 0xcb, 0xc2, 0xc2, 0xcb, 0xcb, 0xc7, 0xc7, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0xcb, 0xcf, 0xc7, 0xc9, 0xcb, 0xc9, 0xc7, 0xb8, 0xc0, 0xc7, 0xc0, 0xb8, 0xc0, 0xb8, 0xcf, 0xcf, 0xc7, 0xc0, 0xcb, 0xd1, 0xcf, 0xcb, 0xc9, 0xcb, 0xcb, 0xc9, 0xd4, 0xd4, 0xcf, 0xc9, 0xc0, 0xc0, 0xc8, 0xd1, 0xd9, 0xd5, 0xd6, 0xd6, 0xd6, 0xd5, 0xd6, 0xd5, 0xd5, 0xd6, 0xd5, 0xd8, 0xd6, 0xd7, 0x90, 0x41, 0x36, 0x3e, 0x31, 0x31, 0x2b, 0x22, 0x20, 0x24, 0x23, 0x2e, 0x43, 0x38, 0x3e, 0x40, 0x3c, 0x40, 0x40, 0x40, 0x43, 0x40, 0x3f, 0x40, 0x40, 0x40, 0x45, 0x3f, 0x43, 0x37, 0x3d, 0x73, 0xfe, 0x9d, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x78, 0x73, 0x3d, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x40, 0x3c, 0x40, 0x40, 0x43, 0x40, 0x40, 0x47, 0x2e, 0x20, 0x20, 0x20, 0x23, 0x34, 0x43, 0x45, 0x3e, 0x32, 0x32, 0x2f, 0x84, 0xd7, 0xd5, 0xd3, 0xd3, 0xd5, 0xd6, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xc0, 0xc0, 0xc2, 0xc2, 0xc1, 0xc0, 0xb8, 0xb8, 0xc7, 0xd4, 0xe2, 0xdd, 0xdd, 0xd4, 0xc9, 0xc0, 0xc0, 0xc7, 0xcf, 0xdd, 0xd3, 0xcb, 0xc9, 0xc9, 0xc9, 0xcf, 0xcf, 0xd4, 0xcf, 0xc4, 0xb8, 0xcb, 0xb8, 0xc2, 0xcb, 0xcb, 0xcf, 0xc0, 0xb8, 0xb8, 0xb8, 0xc7, 0xc9, 0xd3, 0xcb, 0xb8, 0xc9, 0xcf, 0xcf, 0xcb, 0xc9, 0xc0, 0xb8, 0xc7, 0xc7, 0xcf, 0xdd, 0xcf, 0xb8, 0xc0, 0xc7, 0xc0, 0xc0, 0xcb, 0xdd, 0xdd, 0xe2, 0xe2, 0xe2, 0xcf, 0xc7, 0xb8, 0xc0, 0xc9, 0xc9, 0xc8, 0xd3, 0xd9, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd8, 0xd8, 0x9b, 0x82, 0x3d, 0x3f, 0x3e, 0x2b, 0x32, 0x29, 0x2e, 0x23, 0x2e, 0x31, 0x43, 0x3e, 0x40, 0x43, 0x43, 0x43, 0x43, 0x43, 0x40, 0x43, 0x40, 0x40, 0x43, 0x3e, 0x46, 0x40, 0x43, 0x37, 0x3d, 0x75, 0xfe, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf6, 0x04, 0x75, 0x3d, 0x42, 0x3c, 0x3e, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x40, 0x43, 0x3c, 0x2e, 0x2a, 0x2e, 0x37, 0x40, 0x45, 0x3f, 0x45, 0x37, 0x35, 0x39, 0x90, 0xdc, 0xd5, 0xd4, 0xd5, 0xd6, 0xd5, 0xd5, 0xd3, 0xd5, 0xd6, 0xd5, 0xd5, 0xd3, 0xd5, 0xdd, 0xc8, 0xc0, 0xc0, 0xc1, 0xc2, 0xc2, 0xc0, 0xc0, 0xc0, 0xb8, 0xb8, 0xc9, 0xb8, 0xb8, 0xc0, 0xc7, 0xc7, 0xb8, 0xc0, 0xcb, 0xd4, 0xdd, 0xe2, 0xdd, 0xdd, 0xdd, 0xd4, 0xcb, 0xb8, 0xc2, 0xc7, 0xc2, 0xc2, 0xb8, 0xc7, 0xcf, 0xcf, 0xdd, 0xdd, 0xdd, 0xd4, 0xdd, 0xd4, 0xcb, 0xb8, 0xb8, 0xc0, 0xb8, 0xcf, 0xd3, 0xd4, 0xdd, 0xe2, 0xd4, 0xdd, 0xd4, 0xc0, 0xc0, 0xc9, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xb8, 0xc7, 0xc9, 0xc7, 0xc0, 0xc0, 0xc0, 0xc9, 0xc0, 0xc0, 0xc8, 0xcd, 0xd5, 0xd6, 0xd9, 0xdb, 0xd8, 0xd8, 0xd6, 0xd6, 0xd9, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd8, 0xda, 0x84, 0x33, 0x49, 0x52, 0x31, 0x2b, 0x29, 0x32, 0x31, 0x31, 0x34, 0x43, 0x40, 0x3e, 0x40, 0x43, 0x40, 0x40, 0x40, 0x43, 0x40, 0x43, 0x40, 0x3e, 0x40, 0x3f, 0x45, 0x37, 0x44, 0x3d, 0x76, 0xfb, 0xf0, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0x78, 0x03, 0x48, 0x42, 0x40, 0x43, 0x43, 0x3e, 0x44, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x40, 0x40, 0x43, 0x3c, 0x43, 0x44, 0x46, 0x46, 0x3e, 0x45, 0x40, 0x44, 0x2f, 0x82, 0x9b, 0xd8, 0xd3, 0xd3, 0xd5, 0xd8, 0xd6, 0xd3, 0xd3, 0xd5, 0xd6, 0xd1, 0xd5, 0xd5, 0xd5, 0xd3, 0xcd, 0xc0, 0xc7, 0xc2, 0xc1, 0xc2, 0xc0, 0xc0, 0xb8, 0xc0, 0xc0, 0xb8, 0xb8, 0xb8, 0xc0, 0xc7, 0xc7, 0xc9, 0xc7, 0xc7, 0xc7, 0xc1, 0xc1, 0xc9, 0xc7, 0xb8, 0xb3, 0xb8, 0xb8, 0xc7, 0xc7, 0xc2, 0xc7, 0xc7, 0xb8, 0xb8, 0xc7, 0xc7, 0xc7, 0xcb, 0xcb, 0xc7, 0xb8, 0xb8, 0xb8, 0xc7, 0xc7, 0xb8, 0xb8, 0xb8, 0xc9, 0xcb, 0xcb, 0xcb, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xc8, 0xc0, 0xc7, 0xc0, 0xc8, 0xc0, 0xc0, 0xc0, 0xc9, 0xc7, 0xc8, 0xc0, 0xc8, 0xc0, 0xc8, 0xd1, 0xd9, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd6, 0xd5, 0xd5, 0xd6, 0xd5, 0xd8, 0xd0, 0xdc, 0x9a, 0x80, 0x42, 0x4c, 0x4c, 0x40, 0x32, 0x23, 0x31, 0x38, 0x3c, 0x43, 0x40, 0x40, 0x43, 0x43, 0x40, 0x43, 0x40, 0x40, 0x43, 0x40, 0x43, 0x38, 0x3e, 0x3f, 0x40, 0x47, 0x37, 0x48, 0x03, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf0, 0xfe, 0x03, 0x58, 0x36, 0x46, 0x3e, 0x43, 0x40, 0x40, 0x44, 0x3f, 0x40, 0x46, 0x40, 0x46, 0x40, 0x47, 0x46, 0x40, 0x46, 0x43, 0x43, 0x46, 0x44, 0x43, 0x43, 0x45, 0x40, 0x42, 0x39, 0x83, 0xe0, 0xd6, 0xd3, 0xd3, 0xd6, 0xd8, 0xd8, 0xd3, 0xd5, 0xd5, 0xd6, 0xd5, 0xd5, 0xd3, 0xd5, 0xd5, 0xd1, 0xc7, 0xc0, 0xc1, 0xc4, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc2, 0xc0, 0xc2, 0xc0, 0xc1, 0xc0, 0xc7, 0xc7, 0xc7, 0xc9, 0xc7, 0xc1, 0xb8, 0xc7, 0xcb, 0xc7, 0xc7, 0xc7, 0xc7, 0xc2, 0xc9, 0xc2, 0xc2, 0xb8, 0xc2, 0xc0, 0xc7, 0xc0, 0xb8, 0xc0, 0xc7, 0xc7, 0xc0, 0xc7, 0xc0, 0xb8, 0xc0, 0xc7, 0xc0, 0xc7, 0xb8, 0xc0, 0xc2, 0xc0, 0xc7, 0xc7, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xc0, 0xc7, 0xc0, 0xc7, 0xc8, 0xc9, 0xc8, 0xc0, 0xc8, 0xcd, 0xd3, 0xd6, 0xd6, 0xd6, 0xd8, 0xd8, 0xdb, 0xd6, 0xd6, 0xd9, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd8, 0xd6, 0xe1, 0x8d, 0x3d, 0x4c, 0x49, 0x4c, 0x44, 0x40, 0x3e, 0x3e, 0x43, 0x43, 0x3c, 0x43, 0x43, 0x40, 0x40, 0x43, 0x40, 0x43, 0x43, 0x40, 0x40, 0x43, 0x3e, 0x45, 0x3c, 0x43, 0x37, 0x5a, 0x03, 0xf0, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf0, 0x02, 0x05, 0x65, 0x36, 0x46, 0x3e, 0x43, 0x3c, 0x44, 0x3f, 0x40, 0x46, 0x40, 0x46, 0x46, 0x40, 0x46, 0x47, 0x47, 0x3c, 0x49, 0x46, 0x46, 0x46, 0x47, 0x45, 0x45, 0x43, 0x3d, 0x41, 0x84, 0xd7, 0xd5, 0xd3, 0xd5, 0xd8, 0xd2, 0xd6, 0xd5, 0xd3, 0xd6, 0xd8, 0xd1, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3, 0xc8, 0xc0, 0xc4, 0xc1, 0xc4, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xc7, 0xc4, 0xc7, 0xc4, 0xc7, 0xc4, 0xcb, 0xc7, 0xc4, 0xc7, 0xc4, 0xc7, 0xc1, 0xc7, 0xc2, 0xc2, 0xc2, 0xc7, 0xcb, 0xc0, 0xc2, 0xc9, 0xc2, 0xc2, 0xc2, 0xc7, 0xc4, 0xc2, 0xc0, 0xc2, 0xc2, 0xb8, 0xc2, 0xc7, 0xc2, 0xb8, 0xc2, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xb8, 0xc2, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0xc0, 0xc7, 0xc7, 0xc0, 0xc0, 0xc9, 0xc8, 0xc0, 0xc8, 0xcd, 0xd9, 0xd5, 0xd6, 0xdb, 0xd6, 0xdb, 0xd8, 0xdb, 0xd9, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd8, 0xe0, 0x99, 0x41, 0x46, 0x52, 0x49, 0x44, 0x47, 0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x40, 0x43, 0x40, 0x43, 0x40, 0x40, 0x43, 0x43, 0x40, 0x3e, 0x3e, 0x3f, 0x47, 0x37, 0x35, 0x59, 0x05, 0x9d, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0x9d, 0x77, 0x05, 0x6c, 0x36, 0x3f, 0x43, 0x3e, 0x40, 0x3f, 0x44, 0x3f, 0x40, 0x46, 0x40, 0x47, 0x46, 0x43, 0x46, 0x47, 0x46, 0x45, 0x49, 0x46, 0x44, 0x40, 0x43, 0x45, 0x47, 0x39, 0x82, 0x90, 0xda, 0xd3, 0xd3, 0xd3, 0xd6, 0xda, 0xd6, 0xd5, 0xd3, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xc9, 0xc0, 0xc7, 0xc4, 0xc1, 0xc2, 0xc2, 0xc4, 0xc2, 0xc2, 0xc2, 0xc4, 0xc7, 0xc4, 0xc2, 0xc4, 0xc4, 0xc4, 0xcb, 0xbd, 0xc7, 0xc4, 0xc7, 0xc4, 0xc1, 0xc4, 0xc2, 0xc7, 0xc7, 0xc2, 0xc7, 0xc2, 0xc7, 0xc7, 0xc2, 0xc7, 0xc2, 0xb8, 0xb3, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xc2, 0xc4, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xc0, 0xc2, 0xc2, 0xc2, 0xc7, 0xc2, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xc0, 0xc8, 0xc7, 0xc8, 0xc8, 0xd1, 0xd9, 0xd5, 0xd6, 0xdb, 0xd8, 0xd8, 0xd8, 0xd6, 0xd8, 0xd5, 0xd9, 0xd5, 0xd6, 0xd5, 0xd6, 0xd6, 0xd8, 0xd2, 0x9b, 0x80, 0x44, 0x4c, 0x49, 0x46, 0x4c, 0x43, 0x43, 0x43, 0x40, 0x43, 0x40, 0x40, 0x40, 0x43, 0x40, 0x40, 0x40, 0x43, 0x40, 0x43, 0x38, 0x43, 0x3f, 0x43, 0x38, 0x3d, 0x6c, 0x05, 0xfc, 0x9d, 0xfc, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xfc, 0x05, 0x6f, 0x36, 0x40, 0x45, 0x3f, 0x46, 0x40, 0x40, 0x40, 0x40, 0x40, 0x45, 0x46, 0x45, 0x46, 0x45, 0x46, 0x45, 0x45, 0x45, 0x46, 0x44, 0x46, 0x45, 0x45, 0x44, 0x33, 0x84, 0xd7, 0xd6, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd5, 0xd1, 0xc0, 0xc7, 0xc7, 0xc1, 0xc0, 0xc1, 0xc7, 0xc7, 0xc2, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc2, 0xc1, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xbd, 0xc4, 0xc4, 0xc4, 0xc4, 0xc2, 0xc4, 0xc4, 0xc2, 0xc4, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc7, 0xc2, 0xc2, 0xc2, 0xc0, 0xc0, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xc7, 0xc2, 0xc2, 0xc2, 0xc7, 0xc2, 0xc2, 0xc2, 0xc0, 0xb8, 0xc0, 0xc7, 0xc7, 0xc0, 0xc9, 0xb9, 0xcd, 0xd9, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd9, 0xd8, 0xd9, 0xd6, 0xd9, 0xd9, 0xd6, 0xd6, 0xd5, 0xd5, 0xd0, 0xe0, 0x82, 0x4a, 0x4e, 0x4c, 0x51, 0x47, 0x43, 0x47, 0x43, 0x43, 0x47, 0x43, 0x40, 0x47, 0x47, 0x43, 0x40, 0x43, 0x40, 0x45, 0x38, 0x43, 0x3f, 0x3e, 0x45, 0x37, 0x35, 0x6e, 0x05, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf6, 0xf3, 0x05, 0x73, 0x3d, 0x40, 0x3f, 0x3f, 0x49, 0x3b, 0x43, 0x40, 0x47, 0x45, 0x40, 0x45, 0x46, 0x45, 0x46, 0x43, 0x47, 0x45, 0x45, 0x46, 0x44, 0x46, 0x45, 0x45, 0x42, 0x41, 0x9a, 0xd7, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd5, 0xd3, 0xc9, 0xc7, 0xc7, 0xc7, 0xc0, 0xc0, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xc0, 0xc7, 0xc9, 0xc4, 0xc7, 0xc4, 0xc2, 0xc2, 0xc7, 0xc4, 0xc7, 0xc4, 0xc7, 0xc4, 0xc7, 0xc2, 0xc2, 0xc4, 0xc2, 0xc4, 0xc2, 0xc4, 0xc2, 0xc4, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0xc0, 0xc0, 0xc7, 0xc7, 0xc4, 0xbf, 0xb8, 0xbf, 0xc0, 0xc2, 0xc0, 0xc0, 0xc7, 0xc7, 0xc0, 0xc0, 0xc5, 0xc8, 0xd1, 0xd8, 0xd9, 0xd8, 0xd8, 0xdb, 0xd6, 0xdb, 0xd9, 0xd8, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd9, 0xd6, 0xd5, 0xd3, 0xdc, 0xd7, 0x84, 0x80, 0x4e, 0x46, 0x45, 0x49, 0x4c, 0x40, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x47, 0x43, 0x45, 0x43, 0x43, 0x40, 0x3c, 0x3f, 0x3e, 0x43, 0x39, 0x72, 0x04, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf3, 0xfa, 0x04, 0x75, 0x48, 0x37, 0x3f, 0x3f, 0x3b, 0x40, 0x3c, 0x43, 0x4c, 0x47, 0x40, 0x46, 0x45, 0x47, 0x47, 0x45, 0x47, 0x45, 0x45, 0x46, 0x46, 0x47, 0x45, 0x47, 0x3d, 0x57, 0x9a, 0xd8, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xd5, 0xd9, 0xdd, 0xcf, 0xc7, 0xc1, 0xc7, 0xc7, 0xc7, 0xc0, 0xc0, 0xc7, 0xc7, 0xc0, 0xc7, 0xc7, 0xcb, 0xc7, 0xc4, 0xc7, 0xc7, 0xc4, 0xc7, 0xc4, 0xc7, 0xc4, 0xc7, 0xc7, 0xc7, 0xb8, 0xc7, 0xc7, 0xc0, 0xc2, 0xc7, 0xc2, 0xc7, 0xc7, 0xc4, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xc2, 0xc7, 0xc7, 0xc7, 0xc7, 0xc0, 0xc0, 0xc0, 0xc8, 0xc0, 0xc7, 0xb7, 0xc7, 0xb9, 0xcd, 0xd9, 0xd9, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd9, 0xd6, 0xd9, 0xd6, 0xd9, 0xd9, 0xd8, 0xd6, 0xd6, 0xd6, 0xd5, 0xdc, 0xd0, 0x9a, 0x82, 0x48, 0x56, 0x45, 0x4c, 0x46, 0x43, 0x47, 0x47, 0x47, 0x47, 0x4c, 0x47, 0x47, 0x47, 0x47, 0x43, 0x3f, 0x43, 0x38, 0x40, 0x3f, 0x3e, 0x3e, 0x43, 0x3d, 0x75, 0x04, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf6, 0xf4, 0x02, 0x03, 0x68, 0x30, 0x44, 0x3f, 0x3f, 0x40, 0x40, 0x47, 0x4c, 0x45, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x45, 0x46, 0x47, 0x46, 0x45, 0x45, 0x46, 0x3d, 0x84, 0xd7, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd9, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd3, 0xc9, 0xc0, 0xc0, 0xc7, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xc9, 0xcb, 0xcf, 0xc7, 0xc9, 0xc0, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc9, 0xc0, 0xcb, 0xcb, 0xc7, 0xc7, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xc7, 0xc4, 0xc7, 0xc7, 0xc7, 0xc2, 0xc0, 0xc2, 0xc0, 0xc2, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xc8, 0xc0, 0xc8, 0xc7, 0xc3, 0xd1, 0xd9, 0xd5, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd8, 0xd2, 0xd9, 0xd6, 0xe1, 0x8e, 0x48, 0x47, 0x52, 0x45, 0x4c, 0x46, 0x43, 0x3c, 0x34, 0x3c, 0x40, 0x47, 0x47, 0x47, 0x47, 0x43, 0x45, 0x43, 0x43, 0x40, 0x3e, 0x45, 0x3e, 0x37, 0x4f, 0x76, 0x02, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xf4, 0xf0, 0xfb, 0xf4, 0x02, 0x03, 0x6d, 0x2f, 0x3b, 0x3c, 0x3f, 0x3c, 0x40, 0x4c, 0x47, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4c, 0x46, 0x45, 0x4c, 0x45, 0x44, 0x4a, 0x84, 0xe0, 0xd3, 0xd5, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd9, 0xd9, 0xd9, 0xd9, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd5, 0xdd, 0xcd, 0xc7, 0xc0, 0xcf, 0xcf, 0xcf, 0xcb, 0xcf, 0xcf, 0xcf, 0xcf, 0xc9, 0xc7, 0xc9, 0xc7, 0xc9, 0xc7, 0xc0, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc0, 0xc9, 0xcf, 0xcf, 0xc7, 0xc0, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc0, 0xc7, 0xc0, 0xc2, 0xc7, 0xc0, 0xc7, 0xc0, 0xc7, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xc9, 0xcf, 0xc9, 0xc0, 0xb8, 0xc8, 0xc0, 0xc3, 0xc0, 0xc3, 0xc0, 0xd1, 0xc8, 0xc8, 0xd5, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xdb, 0xd6, 0xd8, 0xd6, 0xda, 0xd5, 0xd5, 0xda, 0x90, 0x57, 0x47, 0x45, 0x49, 0x46, 0x47, 0x40, 0x2e, 0x2e, 0x34, 0x31, 0x3c, 0x4c, 0x4c, 0x47, 0x4c, 0x40, 0x47, 0x38, 0x40, 0x3e, 0x3e, 0x40, 0x35, 0x68, 0x78, 0x02, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf3, 0x05, 0x70, 0x2f, 0x3b, 0x40, 0x3e, 0x3c, 0x49, 0x4c, 0x47, 0x40, 0x47, 0x4c, 0x4c, 0x47, 0x47, 0x4c, 0x47, 0x45, 0x46, 0x45, 0x4c, 0x45, 0x46, 0x42, 0x61, 0x90, 0xd6, 0xd3, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xdd, 0xd3, 0xc8, 0xc0, 0xc0, 0xcb, 0xcb, 0xcf, 0xcf, 0xcb, 0xc9, 0xc7, 0xc0, 0xb8, 0xcb, 0xcd, 0xc7, 0xc0, 0xc9, 0xc9, 0xc7, 0xc8, 0xc7, 0xc8, 0xc7, 0xc9, 0xcf, 0xd1, 0xcb, 0xcd, 0xc7, 0xc8, 0xc7, 0xc7, 0xc0, 0xc7, 0xc7, 0xc0, 0xc0, 0xc7, 0xc7, 0xc7, 0xc0, 0xc0, 0xcb, 0xb8, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xcf, 0xcf, 0xcf, 0xd1, 0xc9, 0xc7, 0xc8, 0xc0, 0xc3, 0xcf, 0xd1, 0xcd, 0xc8, 0xcd, 0xde, 0xd6, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xd8, 0xd8, 0xda, 0xda, 0xd6, 0xd5, 0xd2, 0xe7, 0x6c, 0x44, 0x4c, 0x56, 0x46, 0x4c, 0x34, 0x30, 0x34, 0x40, 0x3c, 0x34, 0x38, 0x4c, 0x4c, 0x4c, 0x47, 0x3c, 0x40, 0x43, 0x3e, 0x3e, 0x43, 0x36, 0x6c, 0x78, 0xfe, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf4, 0x77, 0x04, 0x75, 0x3a, 0x36, 0x40, 0x3c, 0x3f, 0x46, 0x4c, 0x43, 0x47, 0x4c, 0x37, 0x2e, 0x2e, 0x2e, 0x40, 0x4c, 0x46, 0x4c, 0x47, 0x45, 0x4c, 0x46, 0x3a, 0x71, 0xe5, 0xd0, 0xd3, 0xd5, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xcd, 0xc7, 0xc7, 0xc7, 0xc7, 0xc0, 0xc7, 0xc0, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xcb, 0xd1, 0xcf, 0xc9, 0xc0, 0xc7, 0xc9, 0xc9, 0xcf, 0xcf, 0xd1, 0xc9, 0xc7, 0xc0, 0xcf, 0xcf, 0xc9, 0xc0, 0xc7, 0xc9, 0xc0, 0xc0, 0xc7, 0xc9, 0xc0, 0xc0, 0xc7, 0xcf, 0xb8, 0xc9, 0xcf, 0xc7, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xb8, 0xc7, 0xcb, 0xcf, 0xc9, 0xb8, 0xc7, 0xcf, 0xd4, 0xdd, 0xdd, 0xdd, 0xd4, 0xd3, 0xcf, 0xc3, 0xcd, 0xd9, 0xd9, 0xd6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdb, 0xd8, 0xdb, 0xdb, 0xd8, 0xda, 0xdb, 0xdb, 0xd5, 0xd2, 0xeb, 0x74, 0x48, 0x4c, 0x49, 0x4c, 0x47, 0x3c, 0x2e, 0x34, 0x47, 0x40, 0x3c, 0x34, 0x34, 0x47, 0x56, 0x4c, 0x43, 0x37, 0x43, 0x38, 0x3e, 0x3b, 0x36, 0x6f, 0x04, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xfe, 0x02, 0x05, 0x5a, 0x36, 0x38, 0x3e, 0x3f, 0x51, 0x56, 0x40, 0x4c, 0x37, 0x23, 0x18, 0x38, 0x46, 0x47, 0x40, 0x49, 0x46, 0x45, 0x47, 0x47, 0x42, 0x4f, 0xf1, 0xe7, 0xd2, 0xd9, 0xd9, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd8, 0xd6, 0xd5, 0xd5, 0xd5, 0xc9, 0xc7, 0xc7, 0xc7, 0xc0, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xcb, 0xc8, 0xc0, 0xcf, 0xdd, 0xdd, 0xd4, 0xd4, 0xd4, 0xd3, 0xd3, 0xcb, 0xc0, 0xc8, 0xc9, 0xc0, 0xcd, 0xcf, 0xcd, 0xc7, 0xb8, 0xc0, 0xc7, 0xc0, 0xc0, 0xc7, 0xc7, 0xd3, 0xcb, 0xc7, 0xc9, 0xc9, 0xcf, 0xcf, 0xcf, 0xcf, 0xcb, 0xcf, 0xcf, 0xcf, 0xcf, 0xcb, 0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0xc0, 0xc7, 0xc7, 0xb9, 0xc0, 0xb9, 0xb9, 0xd5, 0xde, 0xd6, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdb, 0xd8, 0xd8, 0xdb, 0xd8, 0xda, 0xd6, 0xdb, 0xd7, 0xee, 0x79, 0x68, 0x4e, 0x44, 0x4c, 0x4c, 0x3c, 0x30, 0x3c, 0x56, 0x3c, 0x34, 0x3c, 0x2e, 0x3c, 0x47, 0x56, 0x4c, 0x3c, 0x43, 0x38, 0x3e, 0x3c, 0x3a, 0x75, 0x77, 0x9e, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x9d, 0x77, 0xf3, 0x05, 0x69, 0x2f, 0x38, 0x3e, 0x3f, 0x56, 0x4c, 0x47, 0x4c, 0x18, 0x18, 0x46, 0x47, 0x3c, 0x3c, 0x43, 0x56, 0x45, 0x47, 0x4c, 0x44, 0x48, 0x6f, 0x79, 0xec, 0xcc, 0xdc, 0xd8, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd5, 0xd5, 0xd9, 0xcf, 0xc7, 0xc0, 0xc7, 0xc7, 0xc7, 0xc0, 0xc7, 0xc0, 0xc0, 0xc7, 0xc7, 0xc9, 0xc7, 0xc0, 0xb8, 0xc9, 0xc9, 0xc9, 0xc0, 0xc0, 0xb8, 0xb8, 0xc7, 0xc7, 0xc9, 0xc0, 0xb8, 0xc7, 0xcf, 0xcf, 0xd3, 0xcf, 0xcb, 0xcf, 0xcf, 0xd3, 0xd1, 0xcf, 0xb8, 0xc0, 0xc7, 0xb8, 0xb8, 0xc7, 0xc9, 0xcb, 0xcf, 0xcb, 0xcb, 0xc9, 0xb8, 0xb8, 0xb8, 0xbf, 0xc2, 0xc7, 0xc7, 0xc0, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xd1, 0xd9, 0xd6, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xd9, 0xd2, 0xd7, 0xe7, 0xf7, 0x04, 0x71, 0x48, 0x44, 0x56, 0x4c, 0x47, 0x34, 0x34, 0x56, 0x47, 0x30, 0x40, 0x34, 0x30, 0x34, 0x4c, 0x56, 0x44, 0x38, 0x3e, 0x38, 0x3b, 0x58, 0x76, 0x9e, 0x9e, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf0, 0xf3, 0x05, 0x70, 0x36, 0x38, 0x3e, 0x3f, 0x51, 0x47, 0x4c, 0x38, 0x18, 0x38, 0x37, 0x43, 0x47, 0x43, 0x45, 0x56, 0x49, 0x47, 0x47, 0x44, 0x59, 0x03, 0xfb, 0xee, 0xd7, 0xd2, 0xd8, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xd6, 0xd6, 0xd5, 0xd5, 0xd9, 0xd4, 0xcb, 0xc7, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xc7, 0xc9, 0xc7, 0xc0, 0xc7, 0xc9, 0xc0, 0xb8, 0xc0, 0xc7, 0xc9, 0xc7, 0xc9, 0xc0, 0xc0, 0xc0, 0xc7, 0xc7, 0xc7, 0xb8, 0xc7, 0xcb, 0xcb, 0xcf, 0xcb, 0xcb, 0xc0, 0xb8, 0xc0, 0xc7, 0xc0, 0xc0, 0xc7, 0xc7, 0xc0, 0xc2, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xc7, 0xc7, 0xb8, 0xb3, 0xb8, 0xc4, 0xc9, 0xb8, 0xc7, 0xcb, 0xc9, 0xc9, 0xd5, 0xd5, 0xd8, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xd9, 0xd5, 0xdc, 0xd7, 0xec, 0xf7, 0xfe, 0x03, 0x68, 0x42, 0x4c, 0x4c, 0x46, 0x3c, 0x30, 0x56, 0x5b, 0x34, 0x34, 0x3c, 0x34, 0x40, 0x47, 0x5b, 0x46, 0x38, 0x38, 0x3e, 0x34, 0x68, 0x03, 0x9e, 0x9e, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0x9d, 0x9d, 0xf4, 0x04, 0x75, 0x48, 0x37, 0x38, 0x49, 0x56, 0x4c, 0x46, 0x23, 0x37, 0x4c, 0x46, 0x38, 0x3c, 0x3c, 0x4c, 0x4c, 0x49, 0x47, 0x44, 0x42, 0x6f, 0x05, 0xfd, 0xf7, 0xe9, 0xd7, 0xdb, 0xd6, 0xd9, 0xd8, 0xd6, 0xd8, 0xdb, 0xd8, 0xdb, 0xd6, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd5, 0xdd, 0xd3, 0xc0, 0xc0, 0xc7, 0xb8, 0xc1, 0xc7, 0xc0, 0xc7, 0xc0, 0xcb, 0xc0, 0xc2, 0xc9, 0xb8, 0xc7, 0xc7, 0xc7, 0xc0, 0xc0, 0xb8, 0xc7, 0xc7, 0xc7, 0xcb, 0xc0, 0xc7, 0xc0, 0xc2, 0xc7, 0xb8, 0xb8, 0xc0, 0xc0, 0xc0, 0xc7, 0xc9, 0xc7, 0xc0, 0xc7, 0xc7, 0xc0, 0xb8, 0xc0, 0xb8, 0xc0, 0xc0, 0xc0, 0xb8, 0xb8, 0xc0, 0xb8, 0xb3, 0xc7, 0xc4, 0xc0, 0xc4, 0xb8, 0xc2, 0xc0, 0xb9, 0xc0, 0xcf, 0xd9, 0xd6, 0xde, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xde, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdb, 0xd8, 0xd8, 0xdb, 0xd9, 0xd5, 0xd7, 0xe5, 0xf9, 0xf3, 0xf4, 0x04, 0x75, 0x3d, 0x46, 0x4c, 0x43, 0x3c, 0x3c, 0x4c, 0x5b, 0x3c, 0x2e, 0x40, 0x30, 0x3c, 0x37, 0x56, 0x56, 0x38, 0x3e, 0x38, 0x36, 0x70, 0x05, 0x9d, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0x9e, 0x9e, 0x77, 0x03, 0x68, 0x2c, 0x3e, 0x4c, 0x49, 0x4c, 0x40, 0x30, 0x56, 0x4c, 0x3f, 0x3f, 0x3f, 0x37, 0x4c, 0x56, 0x45, 0x4c, 0x3d, 0x5e, 0x03, 0x78, 0xfa, 0xf7, 0xec, 0xe1, 0xda, 0xd6, 0xd9, 0xd5, 0xde, 0xd6, 0xdb, 0xdb, 0xdb, 0xd9, 0xd9, 0xd8, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd5, 0xcd, 0xc0, 0xc7, 0xc2, 0xc7, 0xc1, 0xc7, 0xc7, 0xc0, 0xc7, 0xc7, 0xc1, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xcb, 0xb8, 0xc4, 0xc0, 0xc2, 0xc7, 0xcb, 0xc7, 0xc0, 0xc0, 0xc9, 0xc0, 0xc7, 0xc0, 0xc7, 0xc0, 0xc7, 0xc7, 0xc0, 0xc0, 0xb8, 0xc0, 0xc0, 0xb8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xc2, 0xc2, 0xbf, 0xc0, 0xc7, 0xc8, 0xc8, 0xd9, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd9, 0xdb, 0xdb, 0xda, 0xda, 0xdb, 0xd8, 0xd8, 0xd8, 0xda, 0xdb, 0xdb, 0xd7, 0xeb, 0xf7, 0x9d, 0xfe, 0x77, 0x05, 0x6c, 0x3a, 0x56, 0x4c, 0x40, 0x3b, 0x3b, 0x67, 0x37, 0x34, 0x37, 0x2e, 0x40, 0x46, 0x46, 0x56, 0x3f, 0x3e, 0x37, 0x33, 0x75, 0xfd, 0xfe, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfa, 0xf4, 0x9d, 0x9d, 0x77, 0x05, 0x6d, 0x1f, 0x3c, 0x4c, 0x49, 0x4c, 0x46, 0x46, 0x5b, 0x46, 0x3f, 0x3f, 0x3f, 0x40, 0x4c, 0x56, 0x49, 0x44, 0x3d, 0x72, 0x78, 0x02, 0xfa, 0xef, 0xf7, 0xe9, 0xd2, 0xdb, 0xd8, 0xd5, 0xd9, 0xd8, 0xdb, 0xdb, 0xd8, 0xd9, 0xd5, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd5, 0xd5, 0xdd, 0xcd, 0xb8, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc9, 0xc1, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc9, 0xc2, 0xc7, 0xc4, 0xc9, 0xc7, 0xc7, 0xc4, 0xb8, 0xc2, 0xb8, 0xc0, 0xc7, 0xc7, 0xb8, 0xc0, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc0, 0xb8, 0xc0, 0xc0, 0xb8, 0xc0, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xc2, 0xc2, 0xc4, 0xc0, 0xc7, 0xb9, 0xc8, 0xd5, 0xd9, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd9, 0xdb, 0xda, 0xda, 0xda, 0xdb, 0xd8, 0xd8, 0xdb, 0xdb, 0xdb, 0xd2, 0xe9, 0xef, 0x9e, 0xf0, 0xf3, 0xfe, 0x02, 0x03, 0x5a, 0x4e, 0x4c, 0x46, 0x3c, 0x43, 0x5b, 0x4c, 0x34, 0x3c, 0x2e, 0x4c, 0x4c, 0x3b, 0x49, 0x49, 0x3e, 0x35, 0x4a, 0x78, 0xfc, 0x77, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0x9e, 0xf4, 0xf4, 0x05, 0x73, 0x36, 0x35, 0x4c, 0x45, 0x45, 0x40, 0x4e, 0x67, 0x3b, 0x3f, 0x3f, 0x3f, 0x3f, 0x56, 0x4c, 0x4c, 0x36, 0x6c, 0x78, 0x02, 0x77, 0xf0, 0xf3, 0xf7, 0xee, 0xd2, 0xda, 0xd8, 0xd9, 0xd9, 0xd6, 0xdb, 0xdb, 0xdb, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd8, 0xd5, 0xd5, 0xd3, 0xc8, 0xc0, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc7, 0xc7, 0xc1, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc4, 0xc4, 0xc2, 0xc2, 0xc7, 0xcb, 0xc2, 0xb8, 0xc9, 0xc7, 0xc7, 0xc9, 0xc7, 0xc0, 0xc9, 0xcf, 0xc0, 0xc7, 0xc0, 0xc7, 0xc7, 0xc0, 0xb8, 0xc0, 0xc7, 0xb8, 0xc7, 0xc9, 0xc2, 0xc7, 0xc0, 0xc2, 0xc2, 0xbf, 0xc4, 0xc2, 0xc0, 0xc7, 0xc3, 0xcd, 0xde, 0xde, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdc, 0xdb, 0xda, 0xdb, 0xdb, 0xd8, 0xd9, 0xd8, 0xda, 0xd7, 0xe1, 0xec, 0xf7, 0x9d, 0xfc, 0xf0, 0xf3, 0x78, 0x03, 0x76, 0x4e, 0x4e, 0x44, 0x40, 0x43, 0x5b, 0x56, 0x34, 0x3b, 0x2e, 0x47, 0x5b, 0x40, 0x3f, 0x3e, 0x3e, 0x2c, 0x69, 0x05, 0x02, 0xf4, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf6, 0xf4, 0xfa, 0x03, 0x76, 0x4f, 0x35, 0x4c, 0x45, 0x3f, 0x46, 0x56, 0x5c, 0x3b, 0x3f, 0x3f, 0x3e, 0x52, 0x5b, 0x4c, 0x36, 0x59, 0x76, 0x78, 0x77, 0x9e, 0x9e, 0x9e, 0xf5, 0xf7, 0xe9, 0xd2, 0xda, 0xd8, 0xd6, 0xd6, 0xdb, 0xd8, 0xd9, 0xd9, 0xd5, 0xd8, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd9, 0xcd, 0xc7, 0xc7, 0xc7, 0xc1, 0xc4, 0xc4, 0xc7, 0xc0, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc7, 0xc1, 0xc4, 0xc4, 0xc4, 0xc4, 0xc2, 0xcf, 0xcf, 0xc9, 0xb8, 0xb8, 0xc0, 0xb8, 0xc0, 0xcf, 0xd3, 0xc9, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc0, 0xc7, 0xc7, 0xc0, 0xc7, 0xcb, 0xc7, 0xb8, 0xc7, 0xc0, 0xbf, 0xc4, 0xc2, 0xc4, 0xc0, 0xc7, 0xc3, 0xcd, 0xd5, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xd9, 0xdb, 0xda, 0xdb, 0xda, 0xd8, 0xd8, 0xd8, 0xda, 0xdb, 0xd7, 0xe9, 0xef, 0xf0, 0xfe, 0xfb, 0xfa, 0xf6, 0xf3, 0x77, 0x05, 0x70, 0x4f, 0x4e, 0x47, 0x38, 0x67, 0x56, 0x34, 0x3b, 0x34, 0x37, 0x67, 0x43, 0x3f, 0x3e, 0x43, 0x2f, 0x6f, 0x05, 0x77, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf4, 0xfa, 0xfa, 0xfd, 0x05, 0x68, 0x36, 0x47, 0x3e, 0x3e, 0x4c, 0x5f, 0x5c, 0x35, 0x3f, 0x3f, 0x3e, 0x52, 0x5b, 0x44, 0x48, 0x72, 0x05, 0xfa, 0xf5, 0x9e, 0x9e, 0x9e, 0xfb, 0xf5, 0xee, 0xe1, 0xd2, 0xdc, 0xd6, 0xd9, 0xd8, 0xdb, 0xd6, 0xd9, 0xd5, 0xd8, 0xd6, 0xd8, 0xd6, 0xd9, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd5, 0xd9, 0xcf, 0xc0, 0xc0, 0xc4, 0xc1, 0xc4, 0xc7, 0xc7, 0xc2, 0xc0, 0xc7, 0xc2, 0xc7, 0xc2, 0xc7, 0xc2, 0xc4, 0xbd, 0xc4, 0xc4, 0xc4, 0xb8, 0xb3, 0xc9, 0xd4, 0xdd, 0xd3, 0xd4, 0xdd, 0xdd, 0xd1, 0xb8, 0xb8, 0xc7, 0xc7, 0xc0, 0xc8, 0xc0, 0xc7, 0xc9, 0xc2, 0xb8, 0xcb, 0xcb, 0xc0, 0xb8, 0xc0, 0xc7, 0xc2, 0xbd, 0xbf, 0xc2, 0xc0, 0xc3, 0xc9, 0xd6, 0xde, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xdc, 0xda, 0xda, 0xdb, 0xd8, 0xd8, 0xd8, 0xda, 0xd7, 0xe5, 0xee, 0xfe, 0xf0, 0xfc, 0xfb, 0xfa, 0xf6, 0xf6, 0x77, 0x77, 0x03, 0x70, 0x48, 0x44, 0x47, 0x5b, 0x60, 0x34, 0x3f, 0x30, 0x40, 0x67, 0x47, 0x3e, 0x3e, 0x37, 0x3d, 0x73, 0x04, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0x9d, 0xfa, 0xfa, 0xfa, 0xfe, 0x05, 0x70, 0x2f, 0x47, 0x3e, 0x3e, 0x47, 0x67, 0x44, 0x3b, 0x3c, 0x3e, 0x45, 0x56, 0x5b, 0x36, 0x6d, 0x05, 0xfc, 0xf5, 0xef, 0x9e, 0x9e, 0x9e, 0xfd, 0xf5, 0xf7, 0xe9, 0xce, 0xda, 0xdc, 0xd8, 0xd8, 0xd8, 0xd6, 0xd5, 0xd9, 0xd9, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd5, 0xd5, 0xcd, 0xc0, 0xc7, 0xc1, 0xc4, 0xc7, 0xc2, 0xc0, 0xc1, 0xc7, 0xc7, 0xc1, 0xc7, 0xc2, 0xc7, 0xc4, 0xbd, 0xcb, 0xc4, 0xc4, 0xc2, 0xc0, 0xb8, 0xb8, 0xc9, 0xcd, 0xcf, 0xc9, 0xc7, 0xb8, 0xb9, 0xb8, 0xc0, 0xc9, 0xcf, 0xcb, 0xc9, 0xc0, 0xc0, 0xcb, 0xcb, 0xcf, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xbf, 0xc4, 0xc4, 0xc0, 0xc0, 0xc3, 0xd0, 0xd6, 0xde, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdc, 0xdc, 0xdb, 0xda, 0xdb, 0xdc, 0xd8, 0xda, 0xe0, 0xce, 0xeb, 0xf7, 0xf4, 0xfc, 0x02, 0xfa, 0xf4, 0xf5, 0xf6, 0xf5, 0x77, 0x02, 0x03, 0x6c, 0x48, 0x46, 0x5b, 0x60, 0x3f, 0x3b, 0x34, 0x3c, 0x67, 0x47, 0x43, 0x3c, 0x35, 0x5a, 0x78, 0x77, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x77, 0xfa, 0xfc, 0xfa, 0xf3, 0xfe, 0x76, 0x48, 0x42, 0x45, 0x43, 0x46, 0x6b, 0x44, 0x3b, 0x3e, 0x3c, 0x47, 0x5f, 0x3d, 0x6d, 0x76, 0x78, 0xfa, 0xf5, 0xf5, 0x9d, 0x9e, 0x77, 0xf4, 0xfd, 0xef, 0xef, 0xe7, 0xd2, 0xda, 0xd6, 0xdb, 0xd8, 0xd8, 0xd6, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd5, 0xd3, 0xcd, 0xb8, 0xc9, 0xc1, 0xc7, 0xc7, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc7, 0xc7, 0xc7, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xb8, 0xc4, 0xc0, 0xc0, 0xb8, 0xb8, 0xb8, 0xc0, 0xb8, 0xb8, 0xb8, 0xb8, 0xc0, 0xc0, 0xc9, 0xcf, 0xd3, 0xcf, 0xd1, 0xcf, 0xcf, 0xb8, 0xb8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0xbf, 0xc7, 0xb7, 0xc8, 0xcd, 0xd9, 0xd6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdc, 0xda, 0xdb, 0xdb, 0xdb, 0xdc, 0xda, 0xd7, 0xe9, 0xef, 0xfb, 0xfc, 0xf4, 0xfc, 0xfc, 0xfa, 0xf6, 0xf3, 0xf5, 0xf5, 0x77, 0x02, 0x05, 0x6d, 0x48, 0x4e, 0x67, 0x46, 0x3b, 0x3c, 0x3c, 0x6b, 0x56, 0x38, 0x40, 0x1f, 0x6f, 0x78, 0xfc, 0xf0, 0xfe, 0xf3, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9e, 0xf4, 0xfd, 0xfc, 0xf4, 0x9d, 0x77, 0x06, 0x68, 0x36, 0x45, 0x37, 0x56, 0x6b, 0x3b, 0x3b, 0x3c, 0x4c, 0x56, 0x48, 0x65, 0x76, 0x05, 0x77, 0xf3, 0xf7, 0xf5, 0xf6, 0x77, 0xfb, 0xfb, 0xf4, 0xfb, 0xef, 0xee, 0xd7, 0xd2, 0xdb, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd5, 0xd9, 0xd1, 0xc9, 0xc0, 0xc7, 0xc7, 0xc7, 0xc7, 0xc1, 0xc0, 0xc1, 0xc7, 0xc1, 0xc7, 0xc7, 0xc7, 0xc4, 0xc4, 0xc7, 0xc2, 0xc2, 0xb8, 0xc2, 0xc0, 0xb8, 0xb8, 0xb8, 0xc0, 0xb8, 0xb8, 0xc0, 0xc0, 0xb8, 0xb8, 0xb8, 0xc4, 0xc7, 0xcb, 0xc2, 0xb8, 0xb8, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xb8, 0xb9, 0xcd, 0xd9, 0xde, 0xd8, 0xd8, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdc, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xd7, 0xe5, 0xec, 0xf5, 0xf4, 0xfc, 0xf4, 0xfa, 0xfb, 0xfc, 0xfc, 0xf6, 0x9d, 0xf5, 0x9d, 0x77, 0x78, 0x03, 0x6d, 0x58, 0x5f, 0x46, 0x34, 0x3f, 0x3c, 0x6b, 0x56, 0x38, 0x37, 0x36, 0x75, 0x04, 0xf3, 0xf4, 0xfe, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0x9d, 0xfd, 0xfc, 0x9d, 0x9e, 0xf3, 0x06, 0x70, 0x36, 0x44, 0x40, 0x5f, 0x6b, 0x3b, 0x3b, 0x3f, 0x56, 0x48, 0x68, 0x76, 0x04, 0xfd, 0xf4, 0x9d, 0x9d, 0xf0, 0xfc, 0xfd, 0xfc, 0xfb, 0xf4, 0x02, 0xfb, 0xef, 0xe9, 0xd2, 0xdb, 0xdb, 0xdb, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd9, 0xd6, 0xd3, 0xd5, 0xc0, 0xc0, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc4, 0xc7, 0xc7, 0xc7, 0xc2, 0xc7, 0xb8, 0xc2, 0xb8, 0xb8, 0xb8, 0xc0, 0xc2, 0xbd, 0xc2, 0xc2, 0xc4, 0xc2, 0xc4, 0xc2, 0xc2, 0xb8, 0xb8, 0xb3, 0xc0, 0xc7, 0xc0, 0xaf, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xb9, 0xcd, 0xd9, 0xd9, 0xdb, 0xdb, 0xd6, 0xd8, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xda, 0xdb, 0xdb, 0xda, 0xe0, 0xd7, 0xeb, 0xf7, 0xf6, 0xf4, 0xf4, 0xf6, 0xf4, 0xfc, 0xf4, 0x02, 0xf4, 0xf4, 0xf5, 0x9d, 0x9e, 0xf3, 0x05, 0x05, 0x6d, 0x4f, 0x44, 0x40, 0x3c, 0x34, 0x6b, 0x5c, 0x43, 0x35, 0x59, 0x03, 0xfd, 0xf0, 0xf3, 0xfe, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9e, 0xf4, 0xfd, 0x02, 0x9e, 0x9e, 0x9e, 0x02, 0x03, 0x4e, 0x3b, 0x42, 0x67, 0x6b, 0x50, 0x3f, 0x4c, 0x44, 0x59, 0x75, 0x04, 0xfa, 0xfa, 0xf6, 0x9e, 0x9d, 0x77, 0xfd, 0xfd, 0xfd, 0xf0, 0xf6, 0x78, 0xf4, 0xef, 0xee, 0xe6, 0xd2, 0xdb, 0xdb, 0xdb, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd3, 0xd1, 0xc9, 0xc0, 0xc1, 0xcb, 0xc7, 0xc9, 0xc1, 0xc7, 0xc1, 0xc9, 0xc7, 0xc9, 0xc7, 0xc7, 0xc0, 0xc0, 0xc2, 0xc7, 0xc2, 0xb8, 0xbf, 0xb8, 0xb4, 0xbf, 0xbd, 0xbf, 0xbd, 0xb3, 0xbd, 0xb4, 0xbf, 0xb4, 0xbf, 0xb8, 0xc0, 0xb8, 0xc0, 0xcb, 0xc0, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xb9, 0xcd, 0xd5, 0xd9, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd9, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xd2, 0xe7, 0xef, 0xf6, 0xfb, 0x9d, 0xf6, 0xf3, 0xf6, 0xf4, 0x02, 0x02, 0x77, 0xfa, 0x9d, 0x9e, 0x9e, 0xfa, 0xfd, 0x03, 0x03, 0x6c, 0x37, 0x40, 0x3f, 0x3f, 0x6b, 0x67, 0x43, 0x35, 0x6d, 0x05, 0xfc, 0xf5, 0xf0, 0xfc, 0x02, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xf4, 0xfc, 0xf4, 0x9d, 0x9e, 0xf3, 0x04, 0x05, 0x6c, 0x3a, 0x42, 0x62, 0x6b, 0x4e, 0x4e, 0x48, 0x59, 0x72, 0x06, 0xfc, 0xfd, 0xfa, 0x9d, 0xfb, 0x77, 0xfc, 0xfb, 0xfd, 0xfc, 0xf6, 0xfb, 0x02, 0xfc, 0xf3, 0xf7, 0xee, 0xd2, 0xd7, 0xda, 0xd6, 0xd6, 0xd5, 0xd6, 0xd5, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd6, 0xd8, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd9, 0xd5, 0xc7, 0xc0, 0xc0, 0xcb, 0xcb, 0xc4, 0xcb, 0xc4, 0xc7, 0xc7, 0xc4, 0xc0, 0xc0, 0xc2, 0xc2, 0xc2, 0xb8, 0xbf, 0xc1, 0xc2, 0xbd, 0xb8, 0xbd, 0xb3, 0xc1, 0xb3, 0xbd, 0xbf, 0xbd, 0xb3, 0xc1, 0xbf, 0xc0, 0xc2, 0xc2, 0xb3, 0xb8, 0xbf, 0xc2, 0xb8, 0xc7, 0xc0, 0xb9, 0xc8, 0xd6, 0xd9, 0xd8, 0xd6, 0xd8, 0xdb, 0xd8, 0xdc, 0xdb, 0xdb, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xd8, 0xde, 0xdb, 0xdb, 0xd7, 0xe1, 0xee, 0xfe, 0xf3, 0xfb, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0xfc, 0xf4, 0xfc, 0xf4, 0xf4, 0x9d, 0x9e, 0xf5, 0xfa, 0xfa, 0x78, 0x03, 0x69, 0x35, 0x3b, 0x3b, 0x62, 0x6b, 0x35, 0x4f, 0x75, 0x05, 0xfc, 0xfa, 0xfb, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0xf4, 0x9d, 0xf5, 0x77, 0xf4, 0x76, 0x05, 0x76, 0x4b, 0x4e, 0x65, 0x6b, 0x58, 0x48, 0x68, 0x75, 0x05, 0x02, 0xfc, 0xf6, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xfc, 0xfc, 0xfa, 0xf5, 0xf7, 0xeb, 0xd7, 0xd2, 0xdb, 0xd5, 0xd1, 0xd5, 0xd5, 0xd6, 0xd6, 0xda, 0xd8, 0xd8, 0xd6, 0xd5, 0xd5, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd1, 0xc9, 0xb7, 0xbd, 0xbf, 0xc4, 0xbd, 0xc4, 0xc1, 0xc1, 0xb8, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xbd, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xbf, 0xc2, 0xbf, 0xc2, 0xbf, 0xc1, 0xbf, 0xc2, 0xbf, 0xc2, 0xc0, 0xc0, 0xbd, 0xbf, 0xbd, 0xbf, 0xc2, 0xbf, 0xb9, 0xc7, 0xcc, 0xd8, 0xdb, 0xdb, 0xd8, 0xdb, 0xdc, 0xdb, 0xdb, 0xdb, 0xd8, 0xd9, 0xd9, 0xd9, 0xdb, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xde, 0xd5, 0xd9, 0xda, 0xd7, 0xeb, 0xf9, 0xfa, 0x9d, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x02, 0xf4, 0xf5, 0xf5, 0x9d, 0x78, 0x03, 0x6f, 0x36, 0x36, 0x67, 0x68, 0x3a, 0x70, 0x05, 0x02, 0x02, 0xfa, 0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xfc, 0x77, 0xf4, 0xf4, 0xf6, 0x9d, 0xf4, 0xf0, 0x77, 0x02, 0x78, 0x70, 0x4b, 0x5a, 0x6d, 0x4b, 0x6d, 0x76, 0x03, 0x76, 0xfb, 0xfe, 0xf5, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfe, 0xf4, 0xf3, 0xf7, 0xef, 0xe9, 0xce, 0xde, 0xd6, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd8, 0xd8, 0xd6, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd3, 0xcf, 0xc9, 0xb8, 0xbf, 0xc4, 0xbd, 0xbd, 0xc2, 0xb8, 0xbd, 0xc0, 0xbd, 0xc2, 0xc2, 0xc2, 0xb8, 0xc2, 0xb8, 0xbf, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xbf, 0xb8, 0xc2, 0xb3, 0xbd, 0xb8, 0xc4, 0xc0, 0xb7, 0xc0, 0xcd, 0xd5, 0xdb, 0xdc, 0xd6, 0xd8, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xd8, 0xdc, 0xdb, 0xdb, 0xdb, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xdc, 0xd8, 0xe0, 0xd2, 0xe9, 0xf5, 0xf5, 0xfc, 0x9d, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x02, 0xfb, 0xf6, 0xf6, 0xf0, 0x9d, 0x76, 0x05, 0x70, 0x5a, 0x68, 0x6c, 0x6f, 0x03, 0x02, 0x02, 0xf6, 0xf6, 0xf6, 0x9d, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x77, 0xf4, 0x9d, 0xf6, 0xf6, 0xf3, 0xfe, 0x77, 0x02, 0x05, 0x02, 0x75, 0x75, 0x76, 0x05, 0x78, 0x02, 0xf8, 0xf3, 0xf3, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfd, 0xfa, 0xfa, 0xf5, 0xef, 0xe6, 0xce, 0xdb, 0xd9, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd8, 0xd8, 0xd6, 0xd6, 0xd9, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd8, 0xd6, 0xd5, 0xd5, 0xd1, 0xc9, 0xb8, 0xc2, 0xc4, 0xc2, 0xbd, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xbd, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xbf, 0xc2, 0xbf, 0xc2, 0xbf, 0xc2, 0xbf, 0xc2, 0xbf, 0xb8, 0xbf, 0xc2, 0xc2, 0xb8, 0xbf, 0xc0, 0xb8, 0xc3, 0xcd, 0xd5, 0xd9, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xd8, 0xdc, 0xd2, 0xe6, 0xef, 0xf7, 0xed, 0xf6, 0xf4, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x02, 0xfb, 0xf4, 0xf6, 0xfa, 0xf6, 0xfe, 0xfb, 0x79, 0x78, 0x03, 0x76, 0x05, 0xfc, 0xfe, 0xf6, 0xf5, 0xf5, 0x9e, 0x9e, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0x02, 0xf4, 0xf4, 0xf5, 0xf0, 0xf6, 0xf3, 0x77, 0xfe, 0x77, 0x77, 0x77, 0x02, 0x04, 0x04, 0xfc, 0xfc, 0xf3, 0xf0, 0xef, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf5, 0xf3, 0xfb, 0xfd, 0xfc, 0xfa, 0xef, 0xee, 0xd7, 0xda, 0xd0, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd9, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd1, 0xc9, 0xc0, 0xc2, 0xc2, 0xbf, 0xc1, 0xbd, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xb8, 0xc2, 0xc2, 0xc2, 0xc2, 0xbf, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xc2, 0xb8, 0xc2, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xbf, 0xc0, 0xb9, 0xc8, 0xcd, 0xd9, 0xde, 0xd6, 0xd8, 0xd8, 0xdb, 0xdb, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd8, 0xdb, 0xe3, 0xd2, 0xe1, 0xec, 0xef, 0xf3, 0xfe, 0xf4, 0xf3, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x77, 0xfb, 0xfb, 0xf4, 0xfb, 0xf6, 0xf6, 0xf6, 0xf3, 0xf5, 0x02, 0x02, 0xfc, 0xfe, 0xf5, 0xf5, 0xf5, 0xf5, 0x9e, 0x9e, 0x9e, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x02, 0x9d, 0xf4, 0xf4, 0xf4, 0xf5, 0xf3, 0xf7, 0xf3, 0xf3, 0xfb, 0x9d, 0xf6, 0xfe, 0xf3, 0xfa, 0xfa, 0xfa, 0xfe, 0x9d, 0x9d, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0x9e, 0xf0, 0x02, 0xfc, 0x02, 0xfd, 0xf5, 0xf7, 0xec, 0xce, 0xda, 0xd8, 0xd6, 0xdb, 0xd6, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd0, 0xd5, 0xd5, 0xd5, 0xc9, 0xc0, 0xc0, 0xc2, 0xc4, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xbd, 0xb8, 0xbf, 0xb8, 0xc2, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xbf, 0xb8, 0xc4, 0xb8, 0xbf, 0xc2, 0xc0, 0xc0, 0xb9, 0xc8, 0xd0, 0xd9, 0xd8, 0xd6, 0xd8, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xd8, 0xdb, 0xd8, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdc, 0xd8, 0xdc, 0xdb, 0xdc, 0xdb, 0xde, 0xd2, 0xd7, 0xec, 0xef, 0xf0, 0x77, 0xf4, 0xf3, 0xf7, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf6, 0xf4, 0xfb, 0xfc, 0xfc, 0xfa, 0xfa, 0xf3, 0xf7, 0xf5, 0xf4, 0xfb, 0xf6, 0xfa, 0xf5, 0xf6, 0xf5, 0xf4, 0xf6, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xfb, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xfa, 0xfa, 0xfa, 0xfa, 0xf4, 0xf4, 0x77, 0x9d, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0x9d, 0xf4, 0x02, 0xfd, 0x02, 0xfd, 0xef, 0xef, 0xeb, 0xce, 0xda, 0xda, 0xd6, 0xdb, 0xd9, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd9, 0xd8, 0xd6, 0xd6, 0xd6, 0xd5, 0xd5, 0xd1, 0xd5, 0xcf, 0xc0, 0xc0, 0xc4, 0xc7, 0xbf, 0xc1, 0xb8, 0xc2, 0xc2, 0xb8, 0xb8, 0xb8, 0xb3, 0xb8, 0xbf, 0xc0, 0xb8, 0xc2, 0xbf, 0xb8, 0xbf, 0xb8, 0xb3, 0xb8, 0xc0, 0xc0, 0xc0, 0xb9, 0xc8, 0xc8, 0xd5, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xda, 0xdb, 0xdb, 0xde, 0xdc, 0xdc, 0xd8, 0xda, 0xda, 0xda, 0xd7, 0xe9, 0xef, 0xf0, 0x9d, 0x77, 0xf4, 0xf4, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf6, 0xfc, 0x02, 0x02, 0x02, 0xfd, 0xfb, 0xfa, 0xf6, 0x77, 0xf4, 0x77, 0xf6, 0xfb, 0xfa, 0xf4, 0xf4, 0xfc, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xfa, 0xf6, 0xfa, 0xfa, 0xfb, 0xfb, 0x77, 0x77, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf0, 0xf6, 0xfb, 0xfc, 0x02, 0xfc, 0xf8, 0xf3, 0xef, 0xf7, 0xe9, 0xd2, 0xd2, 0xda, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd6, 0xd6, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xcf, 0xc9, 0xc0, 0xc2, 0xc2, 0xc2, 0xc4, 0xc2, 0xb8, 0xbd, 0xb8, 0xbd, 0xb8, 0xc2, 0xb8, 0xc0, 0xc0, 0xb8, 0xc0, 0xc0, 0xc0, 0xb8, 0xb8, 0xc0, 0xc0, 0xc8, 0xb8, 0xc3, 0xcd, 0xd9, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xdb, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xdb, 0xe0, 0xdb, 0xdb, 0xd9, 0xdb, 0xde, 0xdc, 0xda, 0xda, 0xe0, 0xd2, 0xe9, 0xf7, 0xf5, 0xfb, 0x77, 0x9d, 0xf4, 0x9d, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf6, 0xf4, 0xfd, 0x02, 0x02, 0x02, 0x02, 0x02, 0x77, 0x77, 0x77, 0x77, 0x02, 0xf4, 0xf4, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf6, 0xf6, 0xf4, 0xfb, 0xfc, 0xfb, 0xf3, 0xfe, 0xf5, 0xf3, 0xef, 0xe9, 0xce, 0xe0, 0xd2, 0xd8, 0xd6, 0xd5, 0xd6, 0xd6, 0xd8, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd8, 0xd8, 0xd6, 0xd9, 0xd6, 0xd6, 0xd6, 0xd6, 0xd0, 0xd5, 0xd5, 0xd3, 0xc9, 0xc0, 0xc2, 0xc4, 0xc0, 0xc2, 0xb8, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xb8, 0xc0, 0xb8, 0xc0, 0xb8, 0xc0, 0xb8, 0xc0, 0xc0, 0xc2, 0xc0, 0xc8, 0xc8, 0xd1, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xde, 0xdb, 0xde, 0xdc, 0xdc, 0xe0, 0xda, 0xd2, 0xe7, 0xef, 0xf5, 0xf3, 0xfc, 0xf4, 0x9d, 0x9d, 0xf6, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf4, 0xf4, 0x02, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x02, 0x77, 0xf0, 0x77, 0xf0, 0x77, 0xf4, 0xf4, 0xf4, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0xfb, 0xfb, 0xfc, 0xfb, 0xf4, 0xfb, 0xf4, 0xf0, 0xf4, 0xf0, 0x9e, 0xf4, 0xfb, 0xfa, 0xfa, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfa, 0xfa, 0xf6, 0xf4, 0xf0, 0xf0, 0xf0, 0xf3, 0xfe, 0xfb, 0xf3, 0xef, 0xe6, 0xce, 0xda, 0xd6, 0xd6, 0xd5, 0xd9, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd5, 0xd9, 0xd6, 0xd6, 0xd6, 0xde, 0xd5, 0xd0, 0xdd, 0xd5, 0xcf, 0xc4, 0xc2, 0xc2, 0xc2, 0xc4, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc0, 0xbf, 0xb8, 0xc0, 0xb8, 0xc0, 0xc2, 0xb8, 0xc0, 0xb8, 0xb8, 0xcd, 0xd1, 0xde, 0xd8, 0xd6, 0xd8, 0xda, 0xdb, 0xd8, 0xd8, 0xd8, 0xdb, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xde, 0xd9, 0xde, 0xd8, 0xda, 0xda, 0xd2, 0xe6, 0xee, 0xef, 0xf4, 0x04, 0xfc, 0xfb, 0xef, 0x9d, 0xf6, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xfb, 0xf4, 0xfa, 0xfb, 0xfa, 0xf4, 0xf4, 0xf4, 0xf0, 0xfb, 0xf4, 0xfb, 0xf4, 0xf0, 0xf4, 0x9d, 0xf4, 0x9d, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xfc, 0xfb, 0x02, 0xfb, 0xfb, 0xf4, 0xfa, 0xf4, 0xf4, 0xf0, 0x9d, 0xf0, 0xf0, 0xf6, 0xf6, 0xfa, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfb, 0xf4, 0xf6, 0xf0, 0xf6, 0xf0, 0xfb, 0xf4, 0xfd, 0xf3, 0xef, 0xee, 0xe7, 0xd2, 0xd8, 0xd6, 0xd5, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xd6, 0xd8, 0xd6, 0xd6, 0xd8, 0xd6, 0xd6, 0xd6, 0xd6, 0xd9, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd9, 0xd5, 0xd1, 0xd3, 0xd4, 0xcb, 0xc9, 0xb8, 0xc0, 0xb8, 0xc2, 0xc0, 0xbf, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0xc0, 0xb7, 0xc0, 0xcd, 0xd1, 0xd5, 0xd6, 0xd6, 0xd8, 0xdb, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xdb, 0xdb, 0xdc, 0xdb, 0xdc, 0xdb, 0xdb, 0xde, 0xd8, 0xde, 0xd8, 0xd8, 0xdc, 0xd2, 0xe6, 0xee, 0xef, 0xf0, 0xf4, 0xfc, 0xfd, 0x9d, 0x9d, 0xef, 0x9d, 0xfc, 0x02, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x02, 0xfb, 0xf4, 0xfa, 0xf5, 0xf6, 0xf6, 0xf5, 0xf0, 0xf6, 0xf6, 0xfa, 0xf6, 0xf4, 0xfb, 0x9d, 0xf4, 0x9d, 0xf6, 0x9d, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf0, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf6, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0xfe, 0xf3, 0xf7, 0xee, 0xe1, 0xd2, 0xd8, 0xd6, 0xd6, 0xdc, 0xd2, 0xd6, 0xd6, 0xd8, 0xd9, 0xd8, 0xd8, 0xd9, 0xd6, 0xd9, 0xd6, 0xd9, 0xd9, 0xd3, 0xd9, 0xd1, 0xd6, 0xd6, 0xda, 0xd8, 0xd6, 0xd5, 0xd1, 0xd5, 0xd9, 0xd3, 0xd0, 0xc9, 0xc3, 0xc0, 0xb9, 0xc0, 0xb8, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0xc3, 0xc8, 0xcd, 0xd0, 0xd5, 0xd5, 0xd8, 0xd6, 0xda, 0xdb, 0xd8, 0xd6, 0xd5, 0xd9, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xde, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xd6, 0xde, 0xe0, 0xda, 0xda, 0xda, 0xdb, 0xd2, 0xe4, 0xec, 0xf7, 0x9d, 0xf4, 0xf4, 0xfc, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf6, 0xf4, 0xf6, 0xfb, 0xf4, 0xfb, 0xf6, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf0, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfe, 0xf3, 0xef, 0xee, 0xe6, 0xce, 0xdb, 0xd8, 0xd6, 0xd9, 0xd5, 0xd6, 0xd5, 0xd6, 0xd8, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd8, 0xd6, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd8, 0xd5, 0xd5, 0xd9, 0xd9, 0xdd, 0xd5, 0xd1, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xd1, 0xd5, 0xd5, 0xd9, 0xd9, 0xd9, 0xd8, 0xd6, 0xd0, 0xda, 0xd8, 0xdb, 0xd8, 0xd9, 0xd9, 0xd9, 0xdc, 0xda, 0xe0, 0xda, 0xda, 0xda, 0xda, 0xe0, 0xdb, 0xda, 0xdb, 0xd8, 0xd8, 0xe2, 0xd5, 0xd6, 0xe0, 0xda, 0xe0, 0xda, 0xe6, 0xec, 0xf7, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf6, 0xf0, 0xef, 0xee, 0xe6, 0xce, 0xdb, 0xd8, 0xd3, 0xd5, 0xd6, 0xdb, 0xda, 0xd7, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xda, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xdb, 0xd6, 0xd8, 0xd9, 0xd9, 0xd0, 0xd5, 0xd5, 0xd5, 0xd5, 0xd9, 0xd9, 0xdd, 0xd9, 0xdd, 0xd5, 0xd5, 0xd5, 0xd9, 0xd6, 0xd6, 0xd6, 0xd6, 0xd8, 0xdc, 0xd6, 0xda, 0xdb, 0xdb, 0xd8, 0xd9, 0xda, 0xe0, 0xe1, 0xe1, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xe1, 0xe0, 0xda, 0xdb, 0xd8, 0xd9, 0xd9, 0xd6, 0xd8, 0xdc, 0xd2, 0xe1, 0xee, 0xf7, 0x9d, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0x9d, 0xf0, 0x77, 0x77, 0xf8, 0x9d, 0xe5, 0xd7, 0xd6, 0xd5, 0xda, 0xdf, 0xdf, 0x90, 0x86, 0x63, 0x63, 0x61, 0x63, 0x61, 0x63, 0x63, 0x84, 0x90, 0xd7, 0xe0, 0xd8, 0xdb, 0xdb, 0xdb, 0xd6, 0xd6, 0xd6, 0xd9, 0xd9, 0xd9, 0xd6, 0xd9, 0xd9, 0xd5, 0xd9, 0xd6, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd6, 0xd8, 0xd8, 0xd6, 0xd8, 0xda, 0xda, 0xda, 0xda, 0xd7, 0x9b, 0xdf, 0x90, 0x85, 0x63, 0x63, 0x63, 0x63, 0x83, 0x84, 0x84, 0x90, 0xdf, 0xe1, 0xe0, 0xdc, 0xde, 0xd6, 0xd2, 0xe6, 0xee, 0xef, 0x9e, 0xf3, 0x02, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf0, 0xf4, 0xf3, 0x04, 0xf3, 0xf7, 0xef, 0xe5, 0xd7, 0xd7, 0x90, 0x84, 0x63, 0x5e, 0x5a, 0x5d, 0x5d, 0x5f, 0x5d, 0x5f, 0x59, 0x5e, 0x5e, 0x83, 0x84, 0x9a, 0xdf, 0xe1, 0xd7, 0xd8, 0xd6, 0xd5, 0xd5, 0xd8, 0xd9, 0xdc, 0xd9, 0xd6, 0xd9, 0xdb, 0xdb, 0xde, 0xd8, 0xd6, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xd6, 0xda, 0xd8, 0xd8, 0xd6, 0xd6, 0xdc, 0xd7, 0xe1, 0xdf, 0x90, 0x84, 0x83, 0x61, 0x5e, 0x59, 0x59, 0x59, 0x5f, 0x59, 0x59, 0x5e, 0x61, 0x63, 0x63, 0x90, 0x9a, 0xe1, 0xd2, 0xe6, 0xee, 0xef, 0x78, 0xed, 0x04, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x9d, 0xf6, 0xf6, 0xfa, 0xfa, 0xf4, 0xfe, 0xf1, 0x9c, 0x83, 0x5e, 0x59, 0x58, 0x5f, 0x5c, 0x60, 0x60, 0x60, 0x60, 0x5b, 0x5b, 0x5c, 0x59, 0x59, 0x5a, 0x61, 0x83, 0x83, 0xdf, 0xe0, 0xd5, 0xdd, 0xd8, 0xd6, 0xd8, 0xd6, 0xdc, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdb, 0xd9, 0xdb, 0xd8, 0xdb, 0xd8, 0xd8, 0xdb, 0xd8, 0xdc, 0xdb, 0xd5, 0xdb, 0xe0, 0xdf, 0x90, 0x8f, 0x83, 0x5e, 0x59, 0x59, 0x5c, 0x5f, 0x5b, 0x60, 0x5b, 0x60, 0x5b, 0x60, 0x5f, 0x65, 0x65, 0x61, 0x85, 0x98, 0xe9, 0xef, 0xef, 0x77, 0x02, 0x78, 0xfc, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0x77, 0xf6, 0xf5, 0xf5, 0xf5, 0xfb, 0x02, 0x03, 0x68, 0x4f, 0x59, 0x5f, 0x5c, 0x5b, 0x60, 0x60, 0x60, 0x60, 0x5b, 0x5b, 0x5b, 0x5c, 0x60, 0x5c, 0x5f, 0x5f, 0x59, 0x57, 0x82, 0x99, 0xe0, 0xd0, 0xd8, 0xd8, 0xdc, 0xd9, 0xdc, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xd8, 0xdb, 0xdc, 0xd8, 0xda, 0xd8, 0xdb, 0xd9, 0xda, 0xe1, 0x90, 0x63, 0x61, 0x59, 0x59, 0x5c, 0x5b, 0x5b, 0x5c, 0x56, 0x5b, 0x52, 0x5b, 0x60, 0x66, 0x60, 0x64, 0x64, 0x65, 0x65, 0x57, 0x6e, 0x06, 0xf4, 0x03, 0x02, 0xfc, 0xfa, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x77, 0xf6, 0xf5, 0xef, 0xf5, 0xfb, 0x03, 0x6d, 0x4e, 0x5c, 0x5b, 0x5c, 0x5c, 0x5c, 0x5b, 0x56, 0x49, 0x40, 0x3b, 0x37, 0x3b, 0x4c, 0x5b, 0x60, 0x60, 0x60, 0x5c, 0x5f, 0x57, 0x8e, 0x9a, 0xdc, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdb, 0xd8, 0xdb, 0xd8, 0xd8, 0xdb, 0xd8, 0xdb, 0xdb, 0xd8, 0xdb, 0xd8, 0xdc, 0xd8, 0xdc, 0xdb, 0xda, 0x9a, 0x85, 0x61, 0x59, 0x62, 0x5c, 0x5b, 0x60, 0x5b, 0x44, 0x42, 0x30, 0x3b, 0x34, 0x51, 0x5b, 0x66, 0x64, 0x64, 0x64, 0x5f, 0x5d, 0x68, 0x72, 0x05, 0x03, 0xfc, 0xfd, 0xfa, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf6, 0xf5, 0x77, 0x05, 0x70, 0x58, 0x60, 0x60, 0x60, 0x5c, 0x5c, 0x5b, 0x56, 0x34, 0x37, 0x30, 0x32, 0x30, 0x30, 0x2a, 0x45, 0x56, 0x5b, 0x60, 0x5b, 0x5b, 0x5f, 0x4a, 0x83, 0x9a, 0xda, 0xd8, 0xdc, 0xd8, 0xdc, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xdc, 0xdb, 0xdc, 0xdb, 0xdc, 0xdb, 0xdc, 0xdc, 0xd8, 0xdc, 0xdb, 0xda, 0xdf, 0x85, 0x5e, 0x5f, 0x62, 0x5f, 0x60, 0x67, 0x4c, 0x34, 0x2c, 0x30, 0x35, 0x35, 0x35, 0x35, 0x4c, 0x67, 0x64, 0x60, 0x66, 0x66, 0x64, 0x5d, 0x65, 0x03, 0x02, 0xf4, 0xf5, 0xf5, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0x77, 0x02, 0x03, 0x68, 0x5d, 0x64, 0x55, 0x66, 0x60, 0x60, 0x5b, 0x3c, 0x31, 0x32, 0x31, 0x32, 0x31, 0x31, 0x29, 0x2e, 0x4c, 0x5c, 0x5c, 0x60, 0x56, 0x5c, 0x59, 0x58, 0x84, 0xdb, 0xdc, 0xdc, 0xdc, 0xde, 0xdc, 0xd9, 0xde, 0xd9, 0xd9, 0xde, 0xdb, 0xdb, 0xdc, 0xde, 0xdc, 0xd9, 0xdc, 0xde, 0xd9, 0xdc, 0xd7, 0xdf, 0x63, 0x5e, 0x62, 0x67, 0x60, 0x62, 0x5c, 0x36, 0x32, 0x32, 0x38, 0x32, 0x32, 0x35, 0x2e, 0x3b, 0x56, 0x66, 0x66, 0x66, 0x66, 0x60, 0x64, 0x58, 0x70, 0x05, 0xf5, 0xf5, 0x9d, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0x77, 0x77, 0x03, 0x75, 0x5d, 0x5f, 0x64, 0x64, 0x60, 0x60, 0x66, 0x52, 0x34, 0x38, 0x38, 0x31, 0x31, 0x31, 0x31, 0x32, 0x20, 0x37, 0x5c, 0x5c, 0x56, 0x5c, 0x5c, 0x5c, 0x5f, 0x57, 0xd7, 0xda, 0xda, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xdb, 0xd8, 0xd8, 0xd8, 0xdc, 0xd8, 0xdc, 0xdc, 0xe0, 0xe1, 0x85, 0x61, 0x62, 0x67, 0x5c, 0x62, 0x67, 0x4e, 0x1f, 0x35, 0x38, 0x38, 0x32, 0x37, 0x37, 0x37, 0x30, 0x4c, 0x66, 0x66, 0x64, 0x66, 0x66, 0x60, 0x62, 0x6c, 0x04, 0x9d, 0xf5, 0x77, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x02, 0xf6, 0xf5, 0x77, 0x03, 0x72, 0x5d, 0x64, 0x60, 0x64, 0x60, 0x64, 0x60, 0x56, 0x31, 0x31, 0x32, 0x32, 0x32, 0x31, 0x31, 0x31, 0x23, 0x3c, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x5c, 0x60, 0x61, 0xe1, 0xe0, 0xe0, 0xda, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe0, 0xde, 0xe3, 0xde, 0xe3, 0xdc, 0xe3, 0xe0, 0xe0, 0xda, 0xda, 0xd7, 0x9a, 0x63, 0x65, 0x67, 0x62, 0x62, 0x62, 0x67, 0x46, 0x14, 0x37, 0x32, 0x38, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x66, 0x66, 0x64, 0x64, 0x66, 0x64, 0x5f, 0x6c, 0x03, 0xfb, 0xf3, 0xfc, 0x02, 0xfb, 0xf4, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x02, 0xf6, 0xf6, 0xf4, 0x05, 0x72, 0x5d, 0x64, 0x64, 0x60, 0x64, 0x60, 0x66, 0x52, 0x34, 0x38, 0x38, 0x32, 0x38, 0x34, 0x38, 0x38, 0x32, 0x3f, 0x5b, 0x60, 0x5b, 0x5c, 0x5c, 0x5f, 0x5c, 0x61, 0x90, 0xe5, 0xe1, 0xe1, 0xe1, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xe1, 0xe1, 0xe5, 0xe5, 0x91, 0x61, 0x65, 0x62, 0x5f, 0x62, 0x67, 0x67, 0x4c, 0x1c, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x38, 0x37, 0x66, 0x66, 0x64, 0x66, 0x66, 0x66, 0x5c, 0x6c, 0x76, 0xfe, 0xf6, 0xfc, 0xfe, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x02, 0xf6, 0xf5, 0xf6, 0x78, 0x75, 0x65, 0x5d, 0x66, 0x66, 0x60, 0x66, 0x66, 0x56, 0x3f, 0x3e, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x34, 0x4c, 0x5b, 0x60, 0x5b, 0x60, 0x5c, 0x62, 0x4e, 0x6c, 0xf5, 0xee, 0xf3, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf3, 0xee, 0xef, 0xef, 0xef, 0x9e, 0x6a, 0x65, 0x62, 0x67, 0x62, 0x67, 0x67, 0x56, 0x30, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x34, 0x60, 0x66, 0x66, 0x66, 0x66, 0x64, 0x5d, 0x6c, 0x05, 0xf6, 0xf6, 0xf4, 0x02, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0x02, 0xf0, 0xf5, 0xf3, 0xfe, 0x03, 0x6c, 0x5d, 0x64, 0x60, 0x66, 0x66, 0x66, 0x60, 0x3f, 0x45, 0x3e, 0x3e, 0x3f, 0x3c, 0x3c, 0x37, 0x3c, 0x56, 0x60, 0x60, 0x60, 0x5b, 0x5c, 0x62, 0x58, 0x6f, 0x79, 0x77, 0x9d, 0xf0, 0xf6, 0xf5, 0xf6, 0xfb, 0xfb, 0xfb, 0xf0, 0xf6, 0xf0, 0xf6, 0xfe, 0xf0, 0xf0, 0xfe, 0xfb, 0xfe, 0x77, 0xf1, 0x6f, 0x59, 0x62, 0x67, 0x62, 0x67, 0x67, 0x5b, 0x34, 0x3b, 0x3b, 0x3b, 0x3f, 0x3b, 0x3b, 0x38, 0x37, 0x3b, 0x67, 0x66, 0x66, 0x66, 0x66, 0x64, 0x58, 0x70, 0x06, 0xf3, 0xf6, 0xfc, 0x77, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf6, 0xf5, 0xf5, 0xf4, 0x05, 0x72, 0x5d, 0x64, 0x64, 0x66, 0x64, 0x64, 0x5c, 0x3f, 0x4c, 0x45, 0x45, 0x45, 0x3f, 0x40, 0x45, 0x46, 0x56, 0x60, 0x5b, 0x60, 0x60, 0x5c, 0x5f, 0x58, 0x75, 0x78, 0x02, 0xfc, 0xfb, 0xf3, 0xfb, 0xfc, 0xfc, 0x02, 0x02, 0xfc, 0xfb, 0xf4, 0xfb, 0xfc, 0x77, 0xfc, 0x77, 0x02, 0x02, 0x02, 0x02, 0x76, 0x68, 0x65, 0x62, 0x65, 0x67, 0x62, 0x5c, 0x3b, 0x3c, 0x37, 0x3c, 0x3b, 0x3e, 0x3c, 0x3c, 0x37, 0x42, 0x6b, 0x62, 0x64, 0x66, 0x64, 0x5d, 0x68, 0x03, 0x77, 0xf5, 0xf6, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf6, 0xf5, 0xf4, 0x04, 0x03, 0x6d, 0x5d, 0x64, 0x64, 0x64, 0x62, 0x5f, 0x42, 0x4c, 0x4c, 0x52, 0x45, 0x4c, 0x4c, 0x46, 0x44, 0x5c, 0x5c, 0x60, 0x60, 0x5b, 0x62, 0x4e, 0x6c, 0x03, 0x77, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xfb, 0x02, 0xfc, 0x02, 0xfb, 0xf4, 0xf4, 0xfb, 0xfc, 0xfb, 0x02, 0xfc, 0x77, 0xfc, 0x77, 0x02, 0x03, 0x70, 0x58, 0x6b, 0x65, 0x65, 0x65, 0x5f, 0x3b, 0x3c, 0x37, 0x3e, 0x38, 0x3e, 0x3c, 0x3c, 0x3d, 0x3b, 0x6f, 0x65, 0x5f, 0x64, 0x5d, 0x65, 0x72, 0x05, 0x77, 0xf5, 0xf5, 0xf4, 0x77, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf6, 0xf6, 0xf3, 0x78, 0x03, 0x6c, 0x58, 0x65, 0x65, 0x72, 0x6d, 0x4e, 0x4e, 0x4c, 0x45, 0x52, 0x4c, 0x4c, 0x44, 0x58, 0x72, 0x65, 0x58, 0x5d, 0x62, 0x58, 0x65, 0x75, 0x03, 0xf5, 0x9d, 0xf5, 0x9d, 0xf5, 0xf6, 0xf6, 0xf6, 0xfb, 0xf6, 0xfb, 0xf6, 0xf6, 0xf4, 0xf6, 0x9d, 0xf6, 0xf0, 0xf4, 0xf0, 0xf4, 0x77, 0x02, 0x03, 0x6d, 0x5a, 0x65, 0x69, 0x72, 0x75, 0x42, 0x36, 0x43, 0x38, 0x43, 0x3e, 0x38, 0x42, 0x3d, 0x68, 0x03, 0x75, 0x6d, 0x65, 0x6c, 0x72, 0x05, 0x77, 0xf4, 0x9d, 0xf6, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf6, 0xf4, 0xfb, 0x77, 0xfb, 0xf4, 0xf3, 0x05, 0x76, 0x72, 0x70, 0x76, 0x03, 0x76, 0x5a, 0x4f, 0x56, 0x52, 0x4c, 0x4c, 0x4e, 0x36, 0x6d, 0x03, 0x75, 0x6d, 0x68, 0x58, 0x65, 0x72, 0x05, 0xfb, 0x9d, 0xf5, 0x9d, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x9d, 0xf5, 0x9d, 0xf4, 0x77, 0x02, 0x04, 0x75, 0x70, 0x72, 0x76, 0x78, 0x03, 0x6d, 0x36, 0x37, 0x43, 0x38, 0x43, 0x44, 0x42, 0x33, 0x72, 0x05, 0x03, 0x03, 0x76, 0x76, 0x05, 0x78, 0x77, 0xf4, 0xf4, 0x9d, 0xf6, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf5, 0xf4, 0x02, 0x77, 0x02, 0xf3, 0xf6, 0xf4, 0x02, 0x03, 0x05, 0x05, 0x02, 0x06, 0x76, 0x48, 0x4e, 0x56, 0x49, 0x56, 0x4e, 0x5a, 0x75, 0x05, 0x04, 0xf1, 0x76, 0x76, 0x76, 0x05, 0x02, 0xf3, 0xfa, 0xf5, 0xf4, 0xf6, 0xf4, 0xf6, 0xf4, 0xf6, 0xf0, 0xf6, 0xf4, 0xfa, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf0, 0xf4, 0xf6, 0xf5, 0xf5, 0x04, 0x03, 0x05, 0x02, 0xf6, 0x79, 0x03, 0x59, 0x3d, 0x44, 0x46, 0x4c, 0x42, 0x3a, 0x6f, 0x05, 0x77, 0xfb, 0x77, 0x78, 0xfe, 0xf4, 0xf3, 0xfe, 0xf4, 0x77, 0xf4, 0x9d, 0xf6, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf6, 0xf5, 0x77, 0x02, 0x02, 0x02, 0xf6, 0xf3, 0xf5, 0xf4, 0x02, 0xfd, 0xfa, 0xf6, 0xed, 0x05, 0x70, 0x4e, 0x49, 0x5c, 0x4e, 0x4e, 0x70, 0x05, 0xf4, 0xf5, 0xf5, 0xf3, 0x04, 0x03, 0xf3, 0xf5, 0xf5, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xfc, 0xfd, 0xfc, 0xfc, 0x02, 0xf4, 0x77, 0xf4, 0xf4, 0x77, 0xf5, 0xf3, 0xef, 0xf3, 0x02, 0x78, 0xf5, 0xef, 0xf3, 0x05, 0x75, 0x4f, 0x36, 0x4e, 0x42, 0x42, 0x6c, 0x03, 0x78, 0xf3, 0xf6, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0x77, 0x77, 0x77, 0xf6, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf4, 0x77, 0x02, 0xfb, 0x9d, 0xf5, 0xf3, 0xfb, 0xf4, 0xf3, 0xfb, 0xf5, 0xfe, 0x77, 0x03, 0x73, 0x5a, 0x3a, 0x5a, 0x6e, 0x05, 0x02, 0xf3, 0xf7, 0xf5, 0xfe, 0xf4, 0x77, 0xfb, 0xf6, 0xfa, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xfc, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0xfc, 0xfb, 0xfc, 0xf4, 0xfc, 0xfb, 0xf4, 0xf4, 0xf0, 0xf5, 0xf5, 0xf4, 0x02, 0xf4, 0xfb, 0xf5, 0xf5, 0x02, 0x03, 0x75, 0x61, 0x3a, 0x4a, 0x6c, 0x05, 0x76, 0x9d, 0xf4, 0xf5, 0xf3, 0xf5, 0xf6, 0xf5, 0xf4, 0xf0, 0xf4, 0xfc, 0xf4, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x77, 0x02, 0x77, 0x78, 0xed, 0x76, 0x74, 0x05, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf0, 0x02, 0x78, 0x03, 0x87, 0xed, 0x79, 0x77, 0x77, 0x77, 0xf4, 0x9d, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xfa, 0xf4, 0xfc, 0x02, 0x02, 0x78, 0x04, 0x78, 0x77, 0x02, 0xf0, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xfb, 0xf4, 0x77, 0x78, 0x02, 0x78, 0x78, 0x02, 0x77, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xfa, 0xfa, 0xf4, 0xfc, 0xf4, 0xfc, 0x04, 0x02, 0x02, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xfc, 0x02, 0xfe, 0xfd, 0xf4, 0xfc, 0xfa, 0xf4, 0xfa, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xfa, 0xfa, 0xfa, 0xfb, 0xf4, 0xf3, 0xfa, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xfb, 0xfa, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xfa, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-};
-
-const lv_img_dsc_t image4 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image4_map,
-};
@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE5
-#define LV_ATTRIBUTE_IMG_IMAGE5
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE5 uint8_t image5_map[] = {
-  0xfb, 0xfb, 0xfb, 0xff, 	/*Color of index 0*/
-  0xed, 0xed, 0xed, 0xff, 	/*Color of index 1*/
-  0xe8, 0xe8, 0xe8, 0xff, 	/*Color of index 2*/
-  0xe6, 0xe6, 0xe6, 0xff, 	/*Color of index 3*/
-  0xe1, 0xe1, 0xe1, 0xff, 	/*Color of index 4*/
-  0xc9, 0xc9, 0xc9, 0xff, 	/*Color of index 5*/
-  0xc0, 0xc0, 0xc0, 0xff, 	/*Color of index 6*/
-  0xb1, 0xb1, 0xb1, 0xff, 	/*Color of index 7*/
-  0xf8, 0xf6, 0xfe, 0xff, 	/*Color of index 8*/
-  0xf3, 0xf3, 0xfc, 0xff, 	/*Color of index 9*/
-  0xf0, 0xf0, 0xfc, 0xff, 	/*Color of index 10*/
-  0xef, 0xed, 0xfd, 0xff, 	/*Color of index 11*/
-  0xeb, 0xea, 0xfc, 0xff, 	/*Color of index 12*/
-  0xec, 0xeb, 0xf2, 0xff, 	/*Color of index 13*/
-  0xe9, 0xe6, 0xfc, 0xff, 	/*Color of index 14*/
-  0xe4, 0xe3, 0xfa, 0xff, 	/*Color of index 15*/
-  0xe3, 0xe3, 0xec, 0xff, 	/*Color of index 16*/
-  0xe0, 0xdf, 0xf8, 0xff, 	/*Color of index 17*/
-  0xe1, 0xdc, 0xfa, 0xff, 	/*Color of index 18*/
-  0xdb, 0xd9, 0xf4, 0xff, 	/*Color of index 19*/
-  0xd9, 0xda, 0xe7, 0xff, 	/*Color of index 20*/
-  0xd9, 0xd4, 0xf7, 0xff, 	/*Color of index 21*/
-  0xd3, 0xd2, 0xf4, 0xff, 	/*Color of index 22*/
-  0xd5, 0xd4, 0xec, 0xff, 	/*Color of index 23*/
-  0xd0, 0xcd, 0xf5, 0xff, 	/*Color of index 24*/
-  0xd4, 0xd4, 0xd9, 0xff, 	/*Color of index 25*/
-  0xd3, 0xcc, 0xf0, 0xff, 	/*Color of index 26*/
-  0xcb, 0xc9, 0xe9, 0xff, 	/*Color of index 27*/
-  0xc8, 0xc3, 0xf3, 0xff, 	/*Color of index 28*/
-  0xcc, 0xcb, 0xd2, 0xff, 	/*Color of index 29*/
-  0xc4, 0xc2, 0xe8, 0xff, 	/*Color of index 30*/
-  0xc1, 0xba, 0xf7, 0xff, 	/*Color of index 31*/
-  0xc1, 0xbb, 0xeb, 0xff, 	/*Color of index 32*/
-  0xc4, 0xc3, 0xca, 0xff, 	/*Color of index 33*/
-  0xbd, 0xbb, 0xe2, 0xff, 	/*Color of index 34*/
-  0xb8, 0xb4, 0xf7, 0xff, 	/*Color of index 35*/
-  0xbb, 0xb6, 0xe9, 0xff, 	/*Color of index 36*/
-  0xb1, 0xb0, 0xf5, 0xff, 	/*Color of index 37*/
-  0xb9, 0xb4, 0xe0, 0xff, 	/*Color of index 38*/
-  0xb0, 0xaa, 0xfb, 0xff, 	/*Color of index 39*/
-  0xaf, 0xac, 0xf3, 0xff, 	/*Color of index 40*/
-  0xaf, 0xae, 0xea, 0xff, 	/*Color of index 41*/
-  0xb3, 0xaf, 0xe3, 0xff, 	/*Color of index 42*/
-  0xac, 0xa9, 0xf5, 0xff, 	/*Color of index 43*/
-  0xab, 0xa8, 0xf8, 0xff, 	/*Color of index 44*/
-  0xa7, 0xa8, 0xf5, 0xff, 	/*Color of index 45*/
-  0xb2, 0xae, 0xdc, 0xff, 	/*Color of index 46*/
-  0xad, 0xaa, 0xeb, 0xff, 	/*Color of index 47*/
-  0xa6, 0xa6, 0xfa, 0xff, 	/*Color of index 48*/
-  0xab, 0xa4, 0xfb, 0xff, 	/*Color of index 49*/
-  0xac, 0xaa, 0xe4, 0xff, 	/*Color of index 50*/
-  0xaa, 0xa5, 0xf4, 0xff, 	/*Color of index 51*/
-  0xb6, 0xb4, 0xbc, 0xff, 	/*Color of index 52*/
-  0xaf, 0xa9, 0xdb, 0xff, 	/*Color of index 53*/
-  0xa6, 0xa4, 0xea, 0xff, 	/*Color of index 54*/
-  0xac, 0xa4, 0xe5, 0xff, 	/*Color of index 55*/
-  0xae, 0xa8, 0xd1, 0xff, 	/*Color of index 56*/
-  0xa8, 0xa2, 0xdb, 0xff, 	/*Color of index 57*/
-  0xa4, 0x99, 0xf3, 0xff, 	/*Color of index 58*/
-  0xa8, 0xa2, 0xd3, 0xff, 	/*Color of index 59*/
-  0x9f, 0x94, 0xf3, 0xff, 	/*Color of index 60*/
-  0xa5, 0x98, 0xe3, 0xff, 	/*Color of index 61*/
-  0xa4, 0x9a, 0xdb, 0xff, 	/*Color of index 62*/
-  0xa2, 0x9b, 0xd2, 0xff, 	/*Color of index 63*/
-  0x9d, 0x90, 0xf8, 0xff, 	/*Color of index 64*/
-  0x9c, 0x90, 0xf3, 0xff, 	/*Color of index 65*/
-  0xa0, 0x90, 0xeb, 0xff, 	/*Color of index 66*/
-  0x9a, 0x90, 0xec, 0xff, 	/*Color of index 67*/
-  0x9d, 0x8d, 0xf5, 0xff, 	/*Color of index 68*/
-  0x9e, 0x92, 0xe3, 0xff, 	/*Color of index 69*/
-  0xa0, 0x99, 0xc8, 0xff, 	/*Color of index 70*/
-  0x9a, 0x8c, 0xf4, 0xff, 	/*Color of index 71*/
-  0x9b, 0x8a, 0xf9, 0xff, 	/*Color of index 72*/
-  0x9d, 0x93, 0xd9, 0xff, 	/*Color of index 73*/
-  0x9c, 0x93, 0xd2, 0xff, 	/*Color of index 74*/
-  0x9a, 0x8b, 0xec, 0xff, 	/*Color of index 75*/
-  0x97, 0x89, 0xf2, 0xff, 	/*Color of index 76*/
-  0x95, 0x8b, 0xeb, 0xff, 	/*Color of index 77*/
-  0x9b, 0x93, 0xc9, 0xff, 	/*Color of index 78*/
-  0x99, 0x8b, 0xe4, 0xff, 	/*Color of index 79*/
-  0x97, 0x83, 0xfa, 0xff, 	/*Color of index 80*/
-  0x99, 0x8c, 0xdb, 0xff, 	/*Color of index 81*/
-  0x96, 0x84, 0xf3, 0xff, 	/*Color of index 82*/
-  0x97, 0x8c, 0xd2, 0xff, 	/*Color of index 83*/
-  0x95, 0x86, 0xe4, 0xff, 	/*Color of index 84*/
-  0x93, 0x83, 0xed, 0xff, 	/*Color of index 85*/
-  0x95, 0x89, 0xd7, 0xff, 	/*Color of index 86*/
-  0x94, 0x8c, 0xc5, 0xff, 	/*Color of index 87*/
-  0x8d, 0x7f, 0xe9, 0xff, 	/*Color of index 88*/
-  0x90, 0x83, 0xd7, 0xff, 	/*Color of index 89*/
-  0x8e, 0x7b, 0xf2, 0xff, 	/*Color of index 90*/
-  0x8d, 0x84, 0xd0, 0xff, 	/*Color of index 91*/
-  0x8b, 0x7b, 0xea, 0xff, 	/*Color of index 92*/
-  0x8a, 0x78, 0xf0, 0xff, 	/*Color of index 93*/
-  0x8a, 0x7b, 0xe4, 0xff, 	/*Color of index 94*/
-  0x8c, 0x7d, 0xdc, 0xff, 	/*Color of index 95*/
-  0x86, 0x79, 0xe4, 0xff, 	/*Color of index 96*/
-  0x86, 0x77, 0xe9, 0xff, 	/*Color of index 97*/
-  0x88, 0x75, 0xec, 0xff, 	/*Color of index 98*/
-  0x88, 0x73, 0xf2, 0xff, 	/*Color of index 99*/
-  0x89, 0x7e, 0xcb, 0xff, 	/*Color of index 100*/
-  0x88, 0x7a, 0xd3, 0xff, 	/*Color of index 101*/
-  0x83, 0x73, 0xeb, 0xff, 	/*Color of index 102*/
-  0x87, 0x7e, 0xc3, 0xff, 	/*Color of index 103*/
-  0x86, 0x74, 0xe3, 0xff, 	/*Color of index 104*/
-  0x85, 0x74, 0xd7, 0xff, 	/*Color of index 105*/
-  0x7e, 0x6b, 0xf3, 0xff, 	/*Color of index 106*/
-  0x85, 0x7b, 0xb9, 0xff, 	/*Color of index 107*/
-  0x82, 0x74, 0xc8, 0xff, 	/*Color of index 108*/
-  0x7b, 0x69, 0xd8, 0xff, 	/*Color of index 109*/
-  0x7b, 0x6f, 0xbb, 0xff, 	/*Color of index 110*/
-  0x76, 0x75, 0x92, 0xff, 	/*Color of index 111*/
-  0x6f, 0x67, 0xa1, 0xff, 	/*Color of index 112*/
-  0x59, 0x53, 0x83, 0xff, 	/*Color of index 113*/
-  0x42, 0x3c, 0x64, 0xff, 	/*Color of index 114*/
-  0x38, 0x35, 0x51, 0xff, 	/*Color of index 115*/
-  0x26, 0x23, 0x45, 0xff, 	/*Color of index 116*/
-  0x1b, 0x17, 0x38, 0xff, 	/*Color of index 117*/
-  0x13, 0x12, 0x1c, 0xff, 	/*Color of index 118*/
-  0x0c, 0x09, 0x25, 0xff, 	/*Color of index 119*/
-  0x03, 0x04, 0x0a, 0xff, 	/*Color of index 120*/
-  0x02, 0x00, 0x15, 0xff, 	/*Color of index 121*/
-  0xf7, 0xf9, 0xfa, 0xff, 	/*Color of index 122*/
-  0xb8, 0xbb, 0xbf, 0xff, 	/*Color of index 123*/
-  0xf3, 0xf4, 0xf4, 0xff, 	/*Color of index 124*/
-  0xf0, 0xf1, 0xf1, 0xff, 	/*Color of index 125*/
-  0xf1, 0xf8, 0xf3, 0xff, 	/*Color of index 126*/
-  0xe4, 0xe8, 0xe6, 0xff, 	/*Color of index 127*/
-  0xf5, 0xfb, 0xee, 0xff, 	/*Color of index 128*/
-  0xf5, 0xf9, 0xf4, 0xff, 	/*Color of index 129*/
-  0xde, 0xe2, 0xdb, 0xff, 	/*Color of index 130*/
-  0xd8, 0xda, 0xd4, 0xff, 	/*Color of index 131*/
-  0xcd, 0xd0, 0xcc, 0xff, 	/*Color of index 132*/
-  0x04, 0x08, 0x02, 0xff, 	/*Color of index 133*/
-  0xfb, 0xfc, 0xf5, 0xff, 	/*Color of index 134*/
-  0xfd, 0xfd, 0xe8, 0xff, 	/*Color of index 135*/
-  0xf7, 0xf7, 0xf6, 0xff, 	/*Color of index 136*/
-  0xf0, 0xf1, 0xed, 0xff, 	/*Color of index 137*/
-  0xf4, 0xf2, 0xd3, 0xff, 	/*Color of index 138*/
-  0xe8, 0xea, 0xd5, 0xff, 	/*Color of index 139*/
-  0xe3, 0xe2, 0xc7, 0xff, 	/*Color of index 140*/
-  0xd6, 0xd6, 0xd5, 0xff, 	/*Color of index 141*/
-  0xdc, 0xdc, 0xb6, 0xff, 	/*Color of index 142*/
-  0xc8, 0xca, 0xc3, 0xff, 	/*Color of index 143*/
-  0xcf, 0xc9, 0xab, 0xff, 	/*Color of index 144*/
-  0xd2, 0xcb, 0xa2, 0xff, 	/*Color of index 145*/
-  0xc3, 0xc3, 0xc2, 0xff, 	/*Color of index 146*/
-  0xc2, 0xc1, 0xbc, 0xff, 	/*Color of index 147*/
-  0xb9, 0xb8, 0xb5, 0xff, 	/*Color of index 148*/
-  0xc4, 0xc2, 0x8d, 0xff, 	/*Color of index 149*/
-  0xc7, 0xbb, 0x9c, 0xff, 	/*Color of index 150*/
-  0xb3, 0xb1, 0xa9, 0xff, 	/*Color of index 151*/
-  0xc0, 0xc3, 0x64, 0xff, 	/*Color of index 152*/
-  0xbe, 0xb7, 0x81, 0xff, 	/*Color of index 153*/
-  0xb4, 0xad, 0x95, 0xff, 	/*Color of index 154*/
-  0xb2, 0xaa, 0x68, 0xff, 	/*Color of index 155*/
-  0xa6, 0x9f, 0x82, 0xff, 	/*Color of index 156*/
-  0x98, 0x97, 0x94, 0xff, 	/*Color of index 157*/
-  0xae, 0xa7, 0x4f, 0xff, 	/*Color of index 158*/
-  0x9f, 0x9b, 0x5f, 0xff, 	/*Color of index 159*/
-  0xa4, 0x9b, 0x4c, 0xff, 	/*Color of index 160*/
-  0xaa, 0x9d, 0x3e, 0xff, 	/*Color of index 161*/
-  0x96, 0x90, 0x6d, 0xff, 	/*Color of index 162*/
-  0x8a, 0x89, 0x85, 0xff, 	/*Color of index 163*/
-  0x95, 0x90, 0x55, 0xff, 	/*Color of index 164*/
-  0x9c, 0x95, 0x41, 0xff, 	/*Color of index 165*/
-  0xa0, 0x94, 0x32, 0xff, 	/*Color of index 166*/
-  0x89, 0x84, 0x6c, 0xff, 	/*Color of index 167*/
-  0x93, 0x8b, 0x3f, 0xff, 	/*Color of index 168*/
-  0x8d, 0x82, 0x5c, 0xff, 	/*Color of index 169*/
-  0x90, 0x8b, 0x24, 0xff, 	/*Color of index 170*/
-  0x8c, 0x80, 0x3a, 0xff, 	/*Color of index 171*/
-  0x77, 0x74, 0x61, 0xff, 	/*Color of index 172*/
-  0x80, 0x7a, 0x37, 0xff, 	/*Color of index 173*/
-  0x8d, 0x7c, 0x2b, 0xff, 	/*Color of index 174*/
-  0x7b, 0x72, 0x40, 0xff, 	/*Color of index 175*/
-  0x73, 0x72, 0x22, 0xff, 	/*Color of index 176*/
-  0x71, 0x62, 0x35, 0xff, 	/*Color of index 177*/
-  0x6a, 0x6b, 0x18, 0xff, 	/*Color of index 178*/
-  0x6d, 0x62, 0x1f, 0xff, 	/*Color of index 179*/
-  0x60, 0x56, 0x34, 0xff, 	/*Color of index 180*/
-  0x5f, 0x56, 0x19, 0xff, 	/*Color of index 181*/
-  0x53, 0x48, 0x26, 0xff, 	/*Color of index 182*/
-  0x43, 0x3b, 0x28, 0xff, 	/*Color of index 183*/
-  0x43, 0x3d, 0x1b, 0xff, 	/*Color of index 184*/
-  0x3a, 0x34, 0x1c, 0xff, 	/*Color of index 185*/
-  0x3e, 0x31, 0x0e, 0xff, 	/*Color of index 186*/
-  0x28, 0x27, 0x24, 0xff, 	/*Color of index 187*/
-  0x2a, 0x24, 0x0f, 0xff, 	/*Color of index 188*/
-  0x18, 0x17, 0x0b, 0xff, 	/*Color of index 189*/
-  0x1d, 0x15, 0x02, 0xff, 	/*Color of index 190*/
-  0x0f, 0x0f, 0x0c, 0xff, 	/*Color of index 191*/
-  0x0e, 0x0f, 0x03, 0xff, 	/*Color of index 192*/
-  0x0f, 0x0c, 0x03, 0xff, 	/*Color of index 193*/
-  0xe9, 0xe8, 0xe6, 0xff, 	/*Color of index 194*/
-  0xdf, 0xde, 0xdd, 0xff, 	/*Color of index 195*/
-  0xd3, 0xd2, 0xd1, 0xff, 	/*Color of index 196*/
-  0xbb, 0xba, 0xb9, 0xff, 	/*Color of index 197*/
-  0xab, 0xaa, 0xa9, 0xff, 	/*Color of index 198*/
-  0xa3, 0xa2, 0xa1, 0xff, 	/*Color of index 199*/
-  0xa0, 0x9e, 0x9d, 0xff, 	/*Color of index 200*/
-  0x92, 0x91, 0x90, 0xff, 	/*Color of index 201*/
-  0x77, 0x75, 0x74, 0xff, 	/*Color of index 202*/
-  0x70, 0x65, 0x50, 0xff, 	/*Color of index 203*/
-  0x59, 0x57, 0x54, 0xff, 	/*Color of index 204*/
-  0x53, 0x51, 0x50, 0xff, 	/*Color of index 205*/
-  0x4c, 0x4b, 0x49, 0xff, 	/*Color of index 206*/
-  0x41, 0x3f, 0x3c, 0xff, 	/*Color of index 207*/
-  0x3c, 0x3a, 0x39, 0xff, 	/*Color of index 208*/
-  0x37, 0x35, 0x34, 0xff, 	/*Color of index 209*/
-  0x33, 0x31, 0x30, 0xff, 	/*Color of index 210*/
-  0x2f, 0x2d, 0x2c, 0xff, 	/*Color of index 211*/
-  0x24, 0x22, 0x20, 0xff, 	/*Color of index 212*/
-  0x1f, 0x1d, 0x1c, 0xff, 	/*Color of index 213*/
-  0x1c, 0x1a, 0x19, 0xff, 	/*Color of index 214*/
-  0x1b, 0x16, 0x15, 0xff, 	/*Color of index 215*/
-  0x17, 0x16, 0x14, 0xff, 	/*Color of index 216*/
-  0x18, 0x13, 0x12, 0xff, 	/*Color of index 217*/
-  0x17, 0x14, 0x0d, 0xff, 	/*Color of index 218*/
-  0x13, 0x0f, 0x0e, 0xff, 	/*Color of index 219*/
-  0x10, 0x0d, 0x0c, 0xff, 	/*Color of index 220*/
-  0x0b, 0x08, 0x05, 0xff, 	/*Color of index 221*/
-  0x07, 0x05, 0x04, 0xff, 	/*Color of index 222*/
-  0xe4, 0xe3, 0xe3, 0xff, 	/*Color of index 223*/
-  0xdb, 0xda, 0xda, 0xff, 	/*Color of index 224*/
-  0xd0, 0xcf, 0xcf, 0xff, 	/*Color of index 225*/
-  0xcc, 0xcb, 0xcb, 0xff, 	/*Color of index 226*/
-  0xc7, 0xc6, 0xc6, 0xff, 	/*Color of index 227*/
-  0xbe, 0xbd, 0xbd, 0xff, 	/*Color of index 228*/
-  0xb8, 0xb7, 0xb7, 0xff, 	/*Color of index 229*/
-  0xb7, 0xb6, 0xb6, 0xff, 	/*Color of index 230*/
-  0xb4, 0xb3, 0xb3, 0xff, 	/*Color of index 231*/
-  0xb0, 0xae, 0xae, 0xff, 	/*Color of index 232*/
-  0x9b, 0x9a, 0x9a, 0xff, 	/*Color of index 233*/
-  0x8c, 0x8b, 0x8b, 0xff, 	/*Color of index 234*/
-  0x84, 0x82, 0x82, 0xff, 	/*Color of index 235*/
-  0x7d, 0x7b, 0x7b, 0xff, 	/*Color of index 236*/
-  0x72, 0x6f, 0x6f, 0xff, 	/*Color of index 237*/
-  0x6a, 0x69, 0x69, 0xff, 	/*Color of index 238*/
-  0x63, 0x62, 0x62, 0xff, 	/*Color of index 239*/
-  0x5d, 0x5b, 0x5b, 0xff, 	/*Color of index 240*/
-  0x45, 0x43, 0x43, 0xff, 	/*Color of index 241*/
-  0x2b, 0x29, 0x29, 0xff, 	/*Color of index 242*/
-  0x1c, 0x11, 0x12, 0xff, 	/*Color of index 243*/
-  0x16, 0x11, 0x11, 0xff, 	/*Color of index 244*/
-  0x13, 0x0e, 0x10, 0xff, 	/*Color of index 245*/
-  0x0b, 0x09, 0x09, 0xff, 	/*Color of index 246*/
-  0x02, 0x00, 0x00, 0xff, 	/*Color of index 247*/
-  0xda, 0xd6, 0xda, 0xff, 	/*Color of index 248*/
-  0xa7, 0xa5, 0xa6, 0xff, 	/*Color of index 249*/
-  0x19, 0x11, 0x18, 0xff, 	/*Color of index 250*/
-  0x15, 0x0e, 0x14, 0xff, 	/*Color of index 251*/
-  0x0e, 0x07, 0x0e, 0xff, 	/*Color of index 252*/
-  0x0a, 0x05, 0x08, 0xff, 	/*Color of index 253*/
-  0xd0, 0xce, 0xd2, 0xff, 	/*Color of index 254*/
-  0x0f, 0x0a, 0x12, 0xff, 	/*Color of index 255*/
-
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xda, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xda, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd8, 0xd9, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf3, 0xf3, 0xf4, 0xd7, 0xd9, 0xd9, 0xd8, 0xf4, 0xf5, 0xd8, 0xda, 0xf4, 0xda, 0xda, 0xf4, 0xd8, 0xda, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xf4, 0xd9, 0xd8, 0xda, 0xda, 0xda, 0xda, 0xfa, 0xfa, 0xfb, 0xfa, 0xd9, 0xd9, 0xda, 0xbd, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xf4, 0xd9, 0xf3, 0xf6, 0xf7, 0xf6, 0xde, 0xf7, 0xf6, 0xf4, 0xf4, 0xf4, 0xd7, 0xf3, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf5, 0xd7, 0xf5, 0xf5, 0xf7, 0xf7, 0xf7, 0xfd, 0xf4, 0xd7, 0xf4, 0xd9, 0xdb, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xf4, 0xd9, 0xf5, 0xdc, 0xce, 0xc5, 0x92, 0xc6, 0xed, 0xd2, 0xf5, 0xfd, 0xff, 0xfa, 0xfb, 0xfa, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xff, 0x78, 0xff, 0xf2, 0xf0, 0xeb, 0x9d, 0xef, 0xd7, 0xdc, 0xd7, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xfb, 0xd9, 0xf4, 0xf6, 0xf1, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x88, 0xe8, 0xcc, 0xf7, 0xf7, 0xfb, 0xfa, 0xd9, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xda, 0xda, 0xdc, 0xf7, 0xd6, 0xed, 0x1d, 0x7d, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xd7, 0xdc, 0xfa, 0xfa, 0xf4, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xf6, 0x03, 0x00, 0x88, 0x86, 0x80, 0x86, 0x81, 0x00, 0x00, 0xc3, 0xed, 0xd9, 0xf7, 0xdb, 0xd7, 0xdb, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xdb, 0xd7, 0xf4, 0xf3, 0xf5, 0xde, 0xd2, 0x9d, 0x89, 0x00, 0x86, 0x86, 0x7c, 0x86, 0x81, 0x81, 0x00, 0xc7, 0xfc, 0xfa, 0xfa, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xdd, 0xf0, 0x00, 0x00, 0x7c, 0x88, 0x7c, 0x88, 0x00, 0x08, 0x09, 0x00, 0x00, 0x8f, 0xcd, 0xf7, 0xf6, 0xf4, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xf4, 0xd5, 0xdb, 0xf4, 0xf7, 0xfa, 0xc9, 0x89, 0x86, 0x86, 0x86, 0x86, 0x7a, 0x7a, 0x0a, 0x88, 0x81, 0x81, 0x7d, 0xcf, 0xfd, 0xfa, 0xf4, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xdc, 0xe5, 0x00, 0x88, 0x7c, 0x7a, 0x09, 0x0c, 0x0e, 0x09, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x93, 0xd2, 0xf7, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xdd, 0xfc, 0xeb, 0x09, 0x00, 0x7a, 0x09, 0x7a, 0x09, 0x0a, 0x0b, 0x0b, 0x08, 0x0a, 0x7c, 0x88, 0x00, 0xe9, 0xde, 0xfb, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xdc, 0xf2, 0x7f, 0x00, 0x7c, 0x81, 0x08, 0x15, 0x3e, 0x57, 0x35, 0x1a, 0x0a, 0x08, 0x7e, 0x00, 0x00, 0x02, 0xeb, 0xf6, 0xdd, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xdc, 0xde, 0xcf, 0xe3, 0x00, 0x08, 0x88, 0x08, 0x08, 0x12, 0x1e, 0x3d, 0x4a, 0x3b, 0x13, 0x08, 0x7d, 0x7a, 0x86, 0xc3, 0xf7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xfa, 0xd8, 0xdd, 0xcd, 0x00, 0x00, 0x81, 0x7a, 0x0b, 0x45, 0x64, 0x59, 0x64, 0x5b, 0x3f, 0x18, 0x08, 0x08, 0x7c, 0x00, 0x00, 0x05, 0xcf, 0xf7, 0xf4, 0xd9, 0xd8, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdd, 0xf4, 0xa3, 0x00, 0x00, 0x88, 0x7c, 0x7a, 0x12, 0x2a, 0x5b, 0x6c, 0x69, 0x60, 0x6b, 0x4e, 0x0e, 0x08, 0x7a, 0x81, 0x00, 0xd5, 0xc0, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0x76, 0xbd, 0xde, 0xeb, 0x00, 0x86, 0x80, 0x08, 0x18, 0x65, 0x5e, 0x5f, 0x58, 0x65, 0x59, 0x5b, 0x2f, 0x11, 0x09, 0x09, 0x7a, 0x00, 0x00, 0xec, 0xd9, 0xfc, 0xd8, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd8, 0xf3, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xda, 0xf4, 0xd8, 0xf4, 0xdb, 0xf4, 0xd8, 0xd9, 0xdb, 0xdb, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xfb, 0xfa, 0xfb, 0xf6, 0xd1, 0xe3, 0x00, 0x86, 0x7c, 0x0a, 0x09, 0x20, 0x51, 0x69, 0x60, 0x5c, 0x60, 0x60, 0x66, 0x69, 0x1c, 0x08, 0x88, 0x08, 0x00, 0xd0, 0xc0, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xfb, 0xd8, 0x85, 0xe8, 0x00, 0x86, 0x80, 0x09, 0x29, 0x60, 0x60, 0x5c, 0x5c, 0x5c, 0x5e, 0x65, 0x59, 0x53, 0x15, 0x08, 0x0b, 0x88, 0x00, 0x00, 0xe4, 0xd5, 0x78, 0xdb, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd7, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0x76, 0xff, 0xf7, 0xee, 0x80, 0x00, 0x7a, 0x09, 0x00, 0x0e, 0x39, 0x64, 0x5f, 0x62, 0x5d, 0x62, 0x61, 0x61, 0x5d, 0x69, 0x3e, 0x08, 0x81, 0x0a, 0x00, 0xef, 0xc0, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xfa, 0xbd, 0x85, 0xfe, 0x00, 0x7e, 0x81, 0x0a, 0x3e, 0x68, 0x5c, 0x5d, 0x62, 0x62, 0x5a, 0x58, 0x5e, 0x5f, 0x67, 0x20, 0x0a, 0x09, 0x7a, 0x86, 0x00, 0x7f, 0xcd, 0xf6, 0xdb, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xdb, 0xdb, 0xdc, 0xdc, 0xdb, 0xdb, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xfc, 0xd7, 0x94, 0x00, 0x86, 0x7a, 0x0b, 0x08, 0x16, 0x51, 0x65, 0x60, 0x62, 0x63, 0x63, 0x63, 0x62, 0x61, 0x68, 0x5e, 0x53, 0x0a, 0x88, 0x00, 0x00, 0xa3, 0xc0, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xfa, 0x76, 0xc0, 0xbd, 0xe0, 0x00, 0x7e, 0x86, 0x0f, 0x53, 0x60, 0x5c, 0x62, 0x62, 0x5d, 0x66, 0x62, 0x61, 0x5e, 0x5f, 0x64, 0x2a, 0x09, 0x00, 0x7c, 0x88, 0x00, 0x88, 0xca, 0xf7, 0xf4, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xdc, 0xf7, 0xf7, 0xf7, 0xd9, 0xd9, 0xdb, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xf7, 0xd3, 0x05, 0x00, 0x86, 0x81, 0x0a, 0x08, 0x1c, 0x53, 0x69, 0x60, 0x62, 0x63, 0x63, 0x63, 0x63, 0x61, 0x61, 0x5c, 0x5e, 0x51, 0x0e, 0x81, 0x09, 0x00, 0xf9, 0xc0, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xfa, 0xda, 0xbb, 0x0d, 0x08, 0x7e, 0x00, 0x18, 0x49, 0x41, 0x40, 0x4c, 0x58, 0x5d, 0x5c, 0x5a, 0x5c, 0x5d, 0x5d, 0x58, 0x6c, 0x32, 0x0c, 0x09, 0x88, 0x7a, 0x00, 0x00, 0xe7, 0xd9, 0xbf, 0xd9, 0xd7, 0xdb, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xdb, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd7, 0xdb, 0xdd, 0xdc, 0xd2, 0xed, 0xe8, 0x8d, 0x02, 0x88, 0x7a, 0xe5, 0xd1, 0xdc, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd8, 0xfd, 0xcd, 0x00, 0x00, 0x88, 0x88, 0x0a, 0x08, 0x20, 0x65, 0x69, 0x5d, 0x5d, 0x5d, 0x63, 0x66, 0x62, 0x58, 0x4c, 0x47, 0x44, 0x4c, 0x59, 0x12, 0x7a, 0x88, 0x00, 0x92, 0xbf, 0xd8, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xfa, 0x76, 0xc0, 0xb7, 0x01, 0x00, 0x09, 0x86, 0x18, 0x45, 0x3a, 0x3c, 0x3a, 0x40, 0x44, 0x5e, 0x60, 0x58, 0x5c, 0x63, 0x5c, 0x5f, 0x67, 0x39, 0x09, 0x08, 0x00, 0x88, 0x00, 0x00, 0x84, 0xbf, 0xde, 0xd8, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xdb, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xdd, 0xdd, 0xcd, 0xe5, 0x02, 0x7a, 0x00, 0x88, 0x00, 0xdf, 0xee, 0xd4, 0xdc, 0xdb, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xdb, 0xd9, 0xd9, 0xdb, 0xf7, 0xed, 0x00, 0x00, 0x7c, 0x08, 0x09, 0x09, 0x1c, 0x65, 0x5f, 0x68, 0x5c, 0x62, 0x5c, 0x66, 0x5c, 0x55, 0x44, 0x41, 0x4d, 0x41, 0x4c, 0x5f, 0x13, 0x7a, 0x88, 0x08, 0x1d, 0xda, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0x76, 0xc0, 0xcf, 0x00, 0x08, 0x88, 0x00, 0x1f, 0x45, 0x3c, 0x3c, 0x41, 0x3c, 0x40, 0x41, 0x55, 0x60, 0x5c, 0x5c, 0x62, 0x5c, 0x58, 0x64, 0x37, 0x0b, 0x08, 0x00, 0x81, 0x00, 0x00, 0x8d, 0xd2, 0xf7, 0xf4, 0xd8, 0xf4, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd7, 0xf4, 0xf4, 0xd7, 0xd7, 0xdb, 0xde, 0xd0, 0xe2, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0xec, 0xf4, 0xf7, 0xdc, 0xd8, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd7, 0xbf, 0xfd, 0x9d, 0x00, 0x88, 0x88, 0x00, 0x0b, 0x08, 0x20, 0x64, 0x5f, 0x66, 0x62, 0x62, 0x61, 0x68, 0x55, 0x47, 0x41, 0x41, 0x43, 0x4d, 0x41, 0x4c, 0x54, 0x1c, 0x7a, 0x81, 0x08, 0xe0, 0xd5, 0xf4, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xfa, 0xfa, 0xc0, 0xce, 0x86, 0x08, 0x7a, 0x7a, 0x24, 0x42, 0x3c, 0x3c, 0x3c, 0x3c, 0x40, 0x3c, 0x40, 0x55, 0x60, 0x60, 0x5a, 0x5a, 0x61, 0x58, 0x64, 0x26, 0x08, 0x00, 0x00, 0x7e, 0x00, 0x00, 0xc3, 0xd3, 0xde, 0xd8, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd7, 0xd4, 0xdb, 0xf6, 0xca, 0x01, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xe0, 0xf1, 0xf7, 0xff, 0xf4, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf6, 0xdc, 0xc8, 0x00, 0x88, 0x86, 0x7e, 0x09, 0x7a, 0x18, 0x64, 0x5f, 0x60, 0x62, 0x66, 0x66, 0x61, 0x58, 0x47, 0x40, 0x41, 0x4c, 0x47, 0x41, 0x43, 0x48, 0x54, 0x20, 0x00, 0x7e, 0x08, 0x02, 0xd4, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xfa, 0xc1, 0xcd, 0x00, 0x09, 0x7a, 0x00, 0x2a, 0x41, 0x3c, 0x40, 0x40, 0x41, 0x40, 0x48, 0x40, 0x40, 0x52, 0x5e, 0x60, 0x5a, 0x62, 0x5d, 0x59, 0x67, 0x1e, 0x00, 0x7e, 0x7e, 0x7c, 0x00, 0x00, 0xc3, 0xd1, 0xf7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd8, 0xdb, 0xea, 0xd9, 0xd5, 0xc7, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x19, 0xd5, 0x78, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xdb, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xf4, 0xd9, 0xd7, 0xdd, 0xdc, 0xe7, 0x00, 0x88, 0x7c, 0x7c, 0x88, 0x00, 0x13, 0x53, 0x65, 0x60, 0x66, 0x61, 0x63, 0x61, 0x52, 0x40, 0x40, 0x47, 0x44, 0x47, 0x47, 0x47, 0x43, 0x48, 0x4b, 0x2a, 0x00, 0x81, 0x08, 0x7d, 0xd3, 0xdb, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xc1, 0xcc, 0x00, 0x08, 0x7e, 0x00, 0x32, 0x3c, 0x3c, 0x3c, 0x3c, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40, 0x4c, 0x60, 0x5c, 0x5a, 0x5e, 0x5e, 0x65, 0x5b, 0x18, 0x00, 0x7a, 0x7c, 0x00, 0x7c, 0x00, 0x03, 0xd2, 0xf6, 0xd8, 0xd9, 0xd7, 0xf4, 0xf3, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xf4, 0xd7, 0xd9, 0xf4, 0xde, 0xc7, 0xc9, 0xd3, 0xe0, 0x00, 0x00, 0x00, 0x7a, 0x88, 0x00, 0xe0, 0xd5, 0xf6, 0xd9, 0xf3, 0xf4, 0xf3, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xf6, 0xd6, 0xc6, 0x00, 0x00, 0x08, 0x88, 0x86, 0x88, 0x0a, 0x49, 0x65, 0x5e, 0x60, 0x60, 0x61, 0x68, 0x55, 0x40, 0x47, 0x44, 0x40, 0x47, 0x40, 0x47, 0x44, 0x4d, 0x48, 0x4b, 0x2e, 0x08, 0x7a, 0x0a, 0x7c, 0xd2, 0xbf, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xfa, 0xd9, 0xc0, 0xcc, 0x00, 0x09, 0x7e, 0x00, 0x35, 0x3c, 0x3c, 0x3c, 0x41, 0x3c, 0x3c, 0x41, 0x40, 0x41, 0x40, 0x40, 0x55, 0x68, 0x5a, 0x58, 0x58, 0x59, 0x5f, 0x53, 0x0a, 0x08, 0x08, 0x00, 0x88, 0x00, 0x00, 0xc3, 0xd6, 0xf6, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xf3, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xdd, 0xcd, 0x00, 0xca, 0x03, 0x00, 0x7a, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0xd0, 0xf7, 0xd9, 0xd9, 0xf3, 0xf3, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xf4, 0xd9, 0xf7, 0xc5, 0x00, 0x00, 0x09, 0x08, 0x86, 0x00, 0x08, 0x22, 0x6c, 0x60, 0x66, 0x60, 0x61, 0x61, 0x58, 0x40, 0x40, 0x4c, 0x40, 0x40, 0x47, 0x47, 0x44, 0x41, 0x47, 0x48, 0x4b, 0x2e, 0x08, 0x08, 0x08, 0x7c, 0xb7, 0xdc, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xc1, 0xcc, 0x00, 0x08, 0x81, 0x00, 0x32, 0x3c, 0x3a, 0x41, 0x3c, 0x41, 0x3c, 0x41, 0x40, 0x41, 0x40, 0x40, 0x44, 0x58, 0x61, 0x61, 0x5c, 0x60, 0x5f, 0x64, 0x35, 0x08, 0x08, 0x88, 0x86, 0x86, 0x7a, 0x00, 0xf8, 0xd4, 0xdc, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xdc, 0xf4, 0xd5, 0xc3, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xdd, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xff, 0xc8, 0x00, 0x00, 0x88, 0x7a, 0x7a, 0x7a, 0x00, 0x18, 0x64, 0x5f, 0x5c, 0x68, 0x61, 0x68, 0x58, 0x48, 0x47, 0x47, 0x40, 0x47, 0x47, 0x44, 0x40, 0x47, 0x47, 0x43, 0x48, 0x4b, 0x35, 0x08, 0x88, 0x09, 0x7a, 0xd0, 0xdc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xfa, 0xd9, 0x85, 0xcd, 0x08, 0x08, 0x7e, 0x00, 0x35, 0x3c, 0x3c, 0x3c, 0x41, 0x3c, 0x40, 0x41, 0x41, 0x40, 0x41, 0x41, 0x40, 0x48, 0x5c, 0x5d, 0x61, 0x5c, 0x61, 0x5f, 0x67, 0x16, 0x08, 0x7a, 0x86, 0x86, 0x86, 0x08, 0x00, 0x06, 0xf7, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd7, 0xf7, 0xec, 0x00, 0x01, 0x7c, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xf7, 0xeb, 0x00, 0x7a, 0x7e, 0x81, 0x81, 0x00, 0x08, 0x09, 0x49, 0x65, 0x61, 0x63, 0x66, 0x68, 0x5e, 0x52, 0x40, 0x4c, 0x47, 0x47, 0x44, 0x47, 0x40, 0x47, 0x40, 0x47, 0x41, 0x48, 0x4b, 0x35, 0x08, 0x08, 0x08, 0x7c, 0xb7, 0xdc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xc1, 0xce, 0x00, 0x08, 0x86, 0x00, 0x29, 0x42, 0x3a, 0x41, 0x3c, 0x41, 0x3c, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x44, 0x52, 0x5c, 0x62, 0x5a, 0x5a, 0x5c, 0x65, 0x53, 0x0e, 0x00, 0x86, 0x86, 0x00, 0x09, 0x08, 0x00, 0xf9, 0xf7, 0xf4, 0xd8, 0xd9, 0xd9, 0xd7, 0xdb, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xdb, 0xde, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0xed, 0xf6, 0xd6, 0xd8, 0xdc, 0xde, 0xf7, 0xde, 0xf7, 0xde, 0xf7, 0xde, 0xf6, 0xdb, 0xf4, 0xd8, 0xdb, 0xd7, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xf4, 0xf6, 0xf0, 0x00, 0x00, 0x00, 0x7a, 0x86, 0x86, 0x7a, 0x09, 0x20, 0x69, 0x5c, 0x63, 0x63, 0x62, 0x68, 0x4c, 0x40, 0x47, 0x40, 0x47, 0x44, 0x47, 0x40, 0x47, 0x40, 0x47, 0x41, 0x47, 0x48, 0x54, 0x2a, 0x08, 0x88, 0x08, 0x7c, 0xd1, 0xbf, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xc0, 0xd0, 0x08, 0x08, 0x86, 0x00, 0x26, 0x3c, 0x3c, 0x3c, 0x41, 0x3c, 0x40, 0x41, 0x41, 0x40, 0x40, 0x41, 0x40, 0x44, 0x48, 0x58, 0x5d, 0x5c, 0x5d, 0x61, 0x58, 0x6c, 0x24, 0x08, 0x00, 0x86, 0x00, 0x00, 0x08, 0x00, 0x00, 0xed, 0xf7, 0xdb, 0xf4, 0xd7, 0xdc, 0xd6, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xd9, 0xf6, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x02, 0xd2, 0xd7, 0xdc, 0xbf, 0xf2, 0xcd, 0xa3, 0xc7, 0x94, 0xe7, 0xc7, 0xca, 0xf1, 0xdc, 0xdd, 0xbf, 0xd6, 0xd8, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xdb, 0xd9, 0xdd, 0xd2, 0x7d, 0x00, 0x7a, 0x08, 0x00, 0x80, 0x86, 0x09, 0x11, 0x56, 0x60, 0x61, 0x63, 0x63, 0x66, 0x5e, 0x4b, 0x47, 0x47, 0x47, 0x40, 0x47, 0x40, 0x47, 0x40, 0x44, 0x44, 0x41, 0x47, 0x44, 0x55, 0x26, 0x7a, 0x08, 0x08, 0x7c, 0xd1, 0xf4, 0xd9, 0xd7, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xbf, 0xd2, 0x7c, 0x08, 0x7e, 0x00, 0x1f, 0x42, 0x3a, 0x41, 0x3c, 0x41, 0x3c, 0x41, 0x40, 0x41, 0x41, 0x40, 0x41, 0x44, 0x40, 0x4c, 0x5c, 0x61, 0x5d, 0x62, 0x5d, 0x69, 0x64, 0x0b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xf6, 0xd8, 0xdc, 0xd7, 0xdb, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xde, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x06, 0xf4, 0xf2, 0xa3, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xeb, 0xd8, 0xde, 0xd9, 0xdb, 0xd7, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xf4, 0xd9, 0xdc, 0xe1, 0x00, 0x00, 0x08, 0x08, 0x00, 0x86, 0x86, 0x7a, 0x2f, 0x69, 0x60, 0x61, 0x63, 0x62, 0x61, 0x4c, 0x41, 0x47, 0x4c, 0x40, 0x47, 0x40, 0x47, 0x40, 0x47, 0x40, 0x47, 0x47, 0x43, 0x48, 0x4b, 0x26, 0x7a, 0x08, 0x08, 0x89, 0xd3, 0xda, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xfa, 0xbe, 0xd4, 0x0a, 0x08, 0x81, 0x00, 0x1c, 0x3c, 0x3c, 0x3c, 0x41, 0x3c, 0x40, 0x41, 0x41, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x44, 0x58, 0x5c, 0x5c, 0x62, 0x62, 0x58, 0x6c, 0x20, 0x08, 0x7a, 0x00, 0x86, 0x86, 0x7e, 0x00, 0x00, 0xe2, 0xdc, 0xdc, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xeb, 0x88, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xef, 0xbf, 0xdb, 0xd8, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf7, 0x9d, 0x00, 0x81, 0x86, 0x08, 0x08, 0x00, 0x86, 0x00, 0x0e, 0x64, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x58, 0x4b, 0x41, 0x47, 0x48, 0x47, 0x40, 0x47, 0x40, 0x47, 0x40, 0x47, 0x40, 0x47, 0x41, 0x48, 0x54, 0x20, 0x7a, 0x08, 0x08, 0x03, 0xd4, 0xf4, 0xd9, 0xd8, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xbf, 0xd6, 0x02, 0x00, 0x88, 0x7a, 0x1c, 0x3c, 0x3c, 0x3c, 0x41, 0x3c, 0x41, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x44, 0x47, 0x40, 0x4c, 0x5e, 0x5c, 0x5c, 0x5d, 0x60, 0x69, 0x4a, 0x0e, 0x00, 0x7a, 0x86, 0x86, 0x00, 0x86, 0x00, 0x00, 0xc9, 0xf7, 0xd8, 0xd9, 0xdb, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xbb, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe1, 0xc5, 0xc9, 0xeb, 0xe9, 0x84, 0xa3, 0xd4, 0xde, 0xd7, 0xdc, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xde, 0xf1, 0x00, 0x88, 0x88, 0x86, 0x7a, 0x08, 0x08, 0x86, 0x00, 0x26, 0x5f, 0x62, 0x5e, 0x60, 0x61, 0x60, 0x4c, 0x41, 0x4b, 0x40, 0x4c, 0x44, 0x47, 0x44, 0x47, 0x44, 0x47, 0x44, 0x47, 0x47, 0x41, 0x48, 0x54, 0x20, 0x00, 0x7a, 0x88, 0x04, 0xd5, 0xda, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xf4, 0xdc, 0xc3, 0x00, 0x09, 0x08, 0x16, 0x3e, 0x3c, 0x3c, 0x41, 0x3c, 0x3c, 0x3c, 0x41, 0x41, 0x44, 0x41, 0x41, 0x41, 0x44, 0x44, 0x4c, 0x55, 0x60, 0x5c, 0x5e, 0x63, 0x5d, 0x69, 0x1c, 0x7a, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd0, 0xf6, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xdc, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x7c, 0xe0, 0x92, 0xc8, 0xec, 0xee, 0xd0, 0xf2, 0xbf, 0xf7, 0xf2, 0xf0, 0xce, 0xdc, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xf5, 0xd6, 0xf5, 0xd9, 0xf5, 0xe1, 0x00, 0x7a, 0x7a, 0x00, 0x7a, 0x00, 0x86, 0x08, 0x0b, 0x53, 0x60, 0x5d, 0x5e, 0x5c, 0x60, 0x58, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x44, 0x48, 0x47, 0x44, 0x48, 0x47, 0x47, 0x40, 0x4c, 0x41, 0x54, 0x18, 0x08, 0x80, 0x86, 0xfe, 0xfb, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xf7, 0x84, 0x00, 0x81, 0x09, 0x15, 0x3e, 0x3c, 0x3c, 0x41, 0x3c, 0x41, 0x40, 0x41, 0x41, 0x44, 0x41, 0x40, 0x47, 0x44, 0x47, 0x47, 0x4c, 0x58, 0x60, 0x60, 0x5d, 0x63, 0x69, 0x4a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf7, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd8, 0xdd, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7c, 0x7a, 0x88, 0x00, 0x00, 0x7a, 0x7a, 0x03, 0xe2, 0xc8, 0xca, 0xd0, 0xd9, 0xd6, 0xdb, 0xd7, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xf4, 0xd7, 0xfd, 0xee, 0x00, 0x00, 0x00, 0x7a, 0x86, 0x7a, 0x86, 0x7a, 0x00, 0x1a, 0x5b, 0x5e, 0x5d, 0x5c, 0x5e, 0x60, 0x55, 0x44, 0x47, 0x47, 0x47, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47, 0x44, 0x48, 0x41, 0x4f, 0x15, 0x00, 0x86, 0x86, 0x93, 0xfc, 0xd8, 0xd8, 0xf4, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xf7, 0x07, 0x00, 0x7a, 0x09, 0x0e, 0x39, 0x3c, 0x3c, 0x41, 0x3c, 0x41, 0x3c, 0x40, 0x44, 0x41, 0x40, 0x41, 0x41, 0x44, 0x47, 0x47, 0x47, 0x55, 0x60, 0x5c, 0x63, 0x5d, 0x5e, 0x67, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xf6, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf7, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7d, 0xc3, 0xe4, 0xf9, 0xe9, 0xc9, 0xc8, 0xf9, 0xc5, 0xc5, 0xf9, 0xee, 0xd5, 0xdb, 0xd6, 0xdb, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xdc, 0xdc, 0x7d, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x00, 0x86, 0x08, 0x00, 0x35, 0x64, 0x5c, 0x5d, 0x5c, 0x60, 0x5e, 0x48, 0x47, 0x47, 0x47, 0x41, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47, 0x47, 0x4d, 0x3d, 0x12, 0x08, 0x86, 0x00, 0xc8, 0xfc, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xda, 0xd9, 0xf7, 0xea, 0x00, 0x7a, 0x08, 0x0b, 0x35, 0x3c, 0x3c, 0x3c, 0x41, 0x40, 0x40, 0x41, 0x44, 0x44, 0x41, 0x40, 0x47, 0x47, 0x44, 0x47, 0x48, 0x4c, 0x5e, 0x58, 0x61, 0x5d, 0x58, 0x64, 0x22, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7b, 0xde, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xde, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x02, 0x05, 0xf9, 0xeb, 0xcc, 0xbb, 0xf7, 0xf7, 0xf7, 0xf6, 0xdc, 0xf6, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd7, 0xfd, 0xef, 0x00, 0x7a, 0x88, 0x00, 0x7a, 0x7a, 0x86, 0x7a, 0x00, 0x0c, 0x4e, 0x5f, 0x58, 0x61, 0x5c, 0x60, 0x58, 0x44, 0x47, 0x47, 0x47, 0x47, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x4d, 0x3e, 0x0c, 0x7a, 0x81, 0x00, 0xeb, 0xfc, 0xd9, 0xd7, 0xf4, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xda, 0xbf, 0xd6, 0xf7, 0xee, 0x00, 0x81, 0x7a, 0x09, 0x20, 0x45, 0x3c, 0x3c, 0x3c, 0x44, 0x40, 0x41, 0x40, 0x41, 0x41, 0x41, 0x47, 0x47, 0x44, 0x4c, 0x47, 0x4c, 0x5e, 0x58, 0x5a, 0x63, 0x5c, 0x5f, 0x39, 0x09, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf6, 0xd9, 0xd9, 0xd7, 0xd9, 0xf4, 0xd7, 0xf4, 0xd8, 0xf4, 0xd9, 0xd8, 0xd9, 0xf4, 0xf4, 0x85, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xc8, 0xcc, 0xf4, 0xf7, 0xdd, 0xf4, 0xd9, 0xd7, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xdb, 0xfa, 0xdc, 0xf4, 0xe0, 0x00, 0x88, 0x7a, 0x7a, 0x7a, 0x00, 0x81, 0x00, 0x08, 0x1a, 0x64, 0x5f, 0x61, 0x5c, 0x5e, 0x60, 0x48, 0x48, 0x4c, 0x47, 0x47, 0x41, 0x47, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47, 0x47, 0x45, 0x32, 0x0b, 0x7a, 0x86, 0x00, 0xf0, 0x78, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xda, 0xd9, 0xfd, 0xf1, 0x00, 0x86, 0x88, 0x09, 0x18, 0x45, 0x3a, 0x3c, 0x40, 0x40, 0x44, 0x40, 0x41, 0x40, 0x41, 0x41, 0x47, 0x47, 0x47, 0x47, 0x47, 0x48, 0x58, 0x58, 0x5c, 0x5d, 0x5d, 0x5e, 0x5b, 0x0e, 0x08, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xf6, 0xd7, 0xd8, 0xd8, 0xd9, 0xd9, 0xf4, 0xdb, 0xd9, 0xd9, 0xd7, 0xdb, 0xdc, 0xf6, 0xdd, 0xf7, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc9, 0xbb, 0xde, 0xde, 0xdb, 0xf4, 0xd7, 0xd8, 0xd9, 0xd8, 0xd9, 0xf5, 0xde, 0xf0, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0x88, 0x7a, 0x81, 0x86, 0x00, 0x24, 0x65, 0x5c, 0x5c, 0x58, 0x61, 0x58, 0x4c, 0x44, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x41, 0x45, 0x22, 0x00, 0x00, 0x88, 0x00, 0xd0, 0xdc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xdb, 0xfb, 0xd4, 0xc2, 0x7e, 0x7e, 0x09, 0x12, 0x45, 0x3a, 0x3c, 0x40, 0x48, 0x40, 0x44, 0x40, 0x41, 0x41, 0x41, 0x47, 0x47, 0x47, 0x47, 0x44, 0x47, 0x55, 0x58, 0x5c, 0x5d, 0x5d, 0x5a, 0x6c, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xbb, 0xdc, 0xf4, 0xd9, 0xd9, 0xd7, 0xd8, 0xd7, 0xdb, 0xde, 0xf7, 0xdb, 0xd3, 0xee, 0xf9, 0xc4, 0x7c, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xce, 0xf6, 0xf7, 0xdc, 0xdb, 0xd9, 0xf4, 0xd7, 0xd9, 0xf7, 0xe3, 0x00, 0x88, 0x7a, 0x7a, 0x7a, 0x88, 0x08, 0x86, 0x7a, 0x00, 0x3e, 0x5f, 0x5d, 0x58, 0x5e, 0x5e, 0x58, 0x48, 0x47, 0x44, 0x47, 0x44, 0x41, 0x44, 0x47, 0x44, 0x47, 0x47, 0x44, 0x44, 0x44, 0x44, 0x48, 0x41, 0x53, 0x16, 0x00, 0x81, 0x00, 0x00, 0xf4, 0xf5, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xbd, 0xf3, 0xd7, 0xfb, 0x8f, 0x86, 0x86, 0x7a, 0x0e, 0x36, 0x43, 0x3c, 0x40, 0x48, 0x48, 0x40, 0x40, 0x41, 0x41, 0x41, 0x47, 0x47, 0x47, 0x48, 0x44, 0x47, 0x4c, 0x58, 0x5c, 0x5d, 0x63, 0x5d, 0x65, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xf6, 0xd9, 0xf4, 0xd7, 0xdb, 0xf6, 0xf6, 0xd7, 0xcc, 0x9d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xed, 0xd6, 0xf7, 0xf4, 0xd9, 0xdb, 0xdc, 0xd4, 0x00, 0x00, 0x7c, 0x7a, 0x7a, 0x88, 0x7a, 0x88, 0x86, 0x86, 0x0b, 0x53, 0x5c, 0x5d, 0x5c, 0x5e, 0x5e, 0x55, 0x40, 0x48, 0x40, 0x47, 0x44, 0x41, 0x47, 0x44, 0x47, 0x44, 0x44, 0x47, 0x47, 0x44, 0x44, 0x48, 0x47, 0x49, 0x0c, 0x7a, 0x86, 0x00, 0xe0, 0xf7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xfb, 0xdd, 0xe9, 0x00, 0x7c, 0x7a, 0x0b, 0x28, 0x45, 0x40, 0x40, 0x48, 0x40, 0x44, 0x41, 0x40, 0x41, 0x44, 0x47, 0x47, 0x47, 0x47, 0x44, 0x44, 0x47, 0x58, 0x5c, 0x5d, 0x5d, 0x66, 0x5f, 0x3d, 0x7a, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xd9, 0xd8, 0xd9, 0xf7, 0xde, 0xd2, 0xea, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x88, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xec, 0xf6, 0xf7, 0xd9, 0xdd, 0xeb, 0x00, 0x7a, 0x7a, 0x7a, 0x88, 0x7a, 0x00, 0x08, 0x86, 0x00, 0x11, 0x5b, 0x5c, 0x5d, 0x5c, 0x58, 0x5c, 0x52, 0x40, 0x47, 0x40, 0x47, 0x44, 0x47, 0x44, 0x47, 0x47, 0x41, 0x41, 0x44, 0x44, 0x47, 0x47, 0x44, 0x4b, 0x39, 0x09, 0x7e, 0x86, 0x00, 0xf9, 0xf7, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xf6, 0xcc, 0x00, 0x7e, 0x88, 0x7a, 0x1b, 0x45, 0x40, 0x48, 0x48, 0x3c, 0x43, 0x44, 0x48, 0x44, 0x40, 0x4c, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x55, 0x5d, 0x5a, 0x5e, 0x5c, 0x68, 0x54, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x88, 0xc3, 0xd0, 0xf7, 0xd6, 0xef, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xed, 0xdc, 0xde, 0xe6, 0x02, 0x7c, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x08, 0x81, 0x00, 0x18, 0x69, 0x58, 0x58, 0x58, 0x5d, 0x58, 0x4c, 0x40, 0x47, 0x47, 0x44, 0x41, 0x41, 0x44, 0x44, 0x41, 0x43, 0x43, 0x41, 0x44, 0x40, 0x47, 0x43, 0x42, 0x24, 0x00, 0x81, 0x00, 0x00, 0xee, 0xf7, 0xbd, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xdc, 0xd4, 0x00, 0x88, 0x7a, 0x7a, 0x12, 0x3d, 0x40, 0x48, 0x40, 0x43, 0x3c, 0x47, 0x44, 0x44, 0x44, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x44, 0x58, 0x5d, 0x5d, 0x5e, 0x5e, 0x5c, 0x65, 0x11, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x7a, 0x02, 0xf8, 0x8d, 0xef, 0xec, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xe3, 0xcf, 0xe5, 0xe0, 0xc3, 0x04, 0x7d, 0x7a, 0x7a, 0x7c, 0x08, 0x7e, 0x00, 0x1c, 0x65, 0x58, 0x58, 0x58, 0x5d, 0x58, 0x4c, 0x44, 0x47, 0x47, 0x41, 0x41, 0x41, 0x41, 0x48, 0x43, 0x3c, 0x43, 0x47, 0x40, 0x47, 0x47, 0x43, 0x45, 0x13, 0x00, 0x86, 0x86, 0x0c, 0xd2, 0xdb, 0xbd, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xdb, 0xf7, 0xe1, 0x00, 0x86, 0x7c, 0x0b, 0x2f, 0x42, 0x48, 0x48, 0x3c, 0x43, 0x41, 0x48, 0x44, 0x40, 0x4c, 0x44, 0x47, 0x44, 0x47, 0x44, 0x47, 0x52, 0x5d, 0x5a, 0x5c, 0x5c, 0x5a, 0x65, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xc3, 0xc4, 0x8d, 0x03, 0x7c, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x00, 0x7c, 0x02, 0xe0, 0xc4, 0xe0, 0xe0, 0xdf, 0x7d, 0x88, 0x7a, 0x7e, 0x00, 0x29, 0x69, 0x58, 0x58, 0x58, 0x5d, 0x58, 0x4c, 0x40, 0x47, 0x47, 0x44, 0x41, 0x41, 0x47, 0x44, 0x41, 0x43, 0x43, 0x44, 0x48, 0x48, 0x47, 0x4f, 0x39, 0x0a, 0x7a, 0x80, 0x00, 0xe5, 0xff, 0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xf7, 0xea, 0x00, 0x7e, 0x08, 0x0a, 0x1c, 0x4f, 0x40, 0x44, 0x41, 0x41, 0x44, 0x44, 0x44, 0x44, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4c, 0x5d, 0x5d, 0x5c, 0x58, 0x61, 0x60, 0x1e, 0x00, 0x00, 0x00, 0x88, 0x03, 0xe0, 0xf8, 0xdf, 0x7c, 0x7c, 0x7a, 0x7a, 0x88, 0x88, 0x00, 0x88, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x88, 0x88, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x01, 0xe0, 0x8d, 0xe0, 0xc3, 0x0d, 0x88, 0x7a, 0x09, 0x39, 0x5e, 0x58, 0x58, 0x58, 0x5d, 0x58, 0x4c, 0x44, 0x47, 0x44, 0x47, 0x41, 0x41, 0x44, 0x47, 0x41, 0x43, 0x41, 0x48, 0x48, 0x47, 0x41, 0x51, 0x1b, 0x08, 0x81, 0x86, 0x00, 0xca, 0xfd, 0xd7, 0xda, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xd9, 0xf6, 0xcf, 0x88, 0x00, 0x7c, 0x08, 0x11, 0x3e, 0x3c, 0x43, 0x40, 0x41, 0x47, 0x44, 0x44, 0x40, 0x4c, 0x44, 0x47, 0x44, 0x47, 0x44, 0x47, 0x4c, 0x5d, 0x5d, 0x5c, 0x5c, 0x62, 0x65, 0x24, 0x00, 0x00, 0x7c, 0xc3, 0x8d, 0x04, 0x7c, 0x00, 0x00, 0x00, 0x7a, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x8d, 0xe0, 0x02, 0x7e, 0x0a, 0x3f, 0x60, 0x5c, 0x58, 0x58, 0x5d, 0x58, 0x4c, 0x44, 0x47, 0x44, 0x44, 0x41, 0x44, 0x41, 0x47, 0x41, 0x43, 0x44, 0x48, 0x48, 0x48, 0x4f, 0x49, 0x0b, 0x00, 0x81, 0x86, 0x86, 0xd3, 0xfc, 0xd6, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xdb, 0xbf, 0x92, 0x00, 0x7c, 0x08, 0x0b, 0x24, 0x45, 0x3c, 0x44, 0x44, 0x47, 0x41, 0x44, 0x44, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4c, 0x5d, 0x5a, 0x5c, 0x61, 0x5a, 0x69, 0x26, 0x00, 0x7d, 0x8d, 0xc3, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x03, 0xf8, 0xf8, 0x89, 0x09, 0x53, 0x5c, 0x5c, 0x58, 0x58, 0x5d, 0x58, 0x4c, 0x40, 0x4c, 0x41, 0x47, 0x41, 0x41, 0x41, 0x47, 0x47, 0x41, 0x48, 0x48, 0x44, 0x3c, 0x51, 0x26, 0x00, 0x7a, 0x86, 0x00, 0x8f, 0xdd, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xde, 0xed, 0x00, 0x81, 0x7c, 0x08, 0x15, 0x4a, 0x3c, 0x40, 0x44, 0x44, 0x41, 0x44, 0x44, 0x47, 0x47, 0x44, 0x47, 0x44, 0x47, 0x44, 0x4c, 0x5d, 0x5d, 0x5c, 0x5c, 0x5d, 0x68, 0x2e, 0x0d, 0x8d, 0x03, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7c, 0xe0, 0xc3, 0x0c, 0x49, 0x5c, 0x5a, 0x58, 0x58, 0x5a, 0x5e, 0x52, 0x40, 0x47, 0x40, 0x47, 0x41, 0x41, 0x44, 0x47, 0x41, 0x47, 0x47, 0x48, 0x40, 0x45, 0x4a, 0x12, 0x00, 0x00, 0x88, 0x00, 0xed, 0x85, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xdb, 0xbf, 0xd8, 0x7c, 0x86, 0x81, 0x08, 0x0b, 0x37, 0x42, 0x48, 0x48, 0x41, 0x41, 0x44, 0x44, 0x47, 0x47, 0x4c, 0x47, 0x47, 0x47, 0x47, 0x4c, 0x5d, 0x5a, 0x5c, 0x5a, 0x63, 0x60, 0x3f, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x7f, 0x0f, 0x49, 0x61, 0x5a, 0x58, 0x58, 0x5a, 0x5e, 0x55, 0x40, 0x47, 0x41, 0x47, 0x41, 0x41, 0x41, 0x47, 0x47, 0x44, 0x48, 0x44, 0x41, 0x51, 0x24, 0x08, 0x81, 0x00, 0x08, 0x04, 0xd4, 0xbd, 0xd7, 0xda, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xdb, 0xf7, 0xc6, 0x00, 0x88, 0x7d, 0x08, 0x1a, 0x51, 0x40, 0x44, 0x40, 0x43, 0x44, 0x44, 0x47, 0x47, 0x44, 0x47, 0x47, 0x48, 0x47, 0x4d, 0x62, 0x5a, 0x5d, 0x5c, 0x5c, 0x65, 0x26, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x3e, 0x69, 0x58, 0x58, 0x5a, 0x5a, 0x5e, 0x58, 0x40, 0x48, 0x44, 0x47, 0x41, 0x41, 0x47, 0x44, 0x41, 0x47, 0x44, 0x48, 0x4b, 0x49, 0x0f, 0x7a, 0x88, 0x88, 0x00, 0xc9, 0x78, 0xdb, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd7, 0xdc, 0xd3, 0x7c, 0x00, 0x7c, 0x7a, 0x0a, 0x35, 0x42, 0x47, 0x40, 0x4b, 0x44, 0x44, 0x43, 0x41, 0x43, 0x44, 0x48, 0x48, 0x47, 0x54, 0x5d, 0x5a, 0x63, 0x58, 0x67, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x4a, 0x5b, 0x58, 0x63, 0x5a, 0x58, 0x58, 0x50, 0x48, 0x48, 0x41, 0x41, 0x44, 0x44, 0x44, 0x41, 0x41, 0x40, 0x48, 0x54, 0x1f, 0x00, 0x87, 0x00, 0x00, 0x01, 0xd4, 0xdc, 0xd7, 0xd9, 0xf3, 0xf3, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xf7, 0xc7, 0x00, 0x88, 0x86, 0x09, 0x15, 0x51, 0x41, 0x4b, 0x40, 0x47, 0x44, 0x41, 0x43, 0x47, 0x47, 0x47, 0x48, 0x48, 0x55, 0x5d, 0x63, 0x5a, 0x65, 0x35, 0x0c, 0x00, 0x08, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x08, 0x00, 0x13, 0x53, 0x5f, 0x5a, 0x5d, 0x58, 0x58, 0x5a, 0x48, 0x48, 0x41, 0x41, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x43, 0x3d, 0x0e, 0x00, 0x86, 0x86, 0x00, 0x9d, 0xde, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf5, 0xd4, 0x09, 0x00, 0x89, 0x7a, 0x08, 0x37, 0x45, 0x44, 0x44, 0x47, 0x47, 0x44, 0x44, 0x4b, 0x47, 0x44, 0x48, 0x4c, 0x5d, 0x5d, 0x5a, 0x65, 0x49, 0x0b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x08, 0x00, 0x15, 0x53, 0x5f, 0x5c, 0x58, 0x5a, 0x5d, 0x52, 0x40, 0x43, 0x44, 0x44, 0x48, 0x44, 0x48, 0x44, 0x43, 0x4a, 0x15, 0x00, 0x7a, 0x00, 0x00, 0x89, 0xd5, 0xdc, 0xd9, 0xd8, 0xf3, 0xd9, 0xf3, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xde, 0xea, 0x00, 0x7e, 0x7e, 0x00, 0x12, 0x3d, 0x42, 0x48, 0x47, 0x44, 0x47, 0x41, 0x47, 0x44, 0x44, 0x47, 0x52, 0x63, 0x5a, 0x60, 0x4a, 0x11, 0x08, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x86, 0x86, 0x00, 0x08, 0x18, 0x59, 0x59, 0x5a, 0x5c, 0x5a, 0x58, 0x47, 0x41, 0x41, 0x48, 0x48, 0x40, 0x44, 0x40, 0x45, 0x22, 0x00, 0x81, 0x08, 0x08, 0x00, 0xeb, 0xf7, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xfc, 0xd5, 0xdf, 0x86, 0x7e, 0x88, 0x00, 0x1c, 0x51, 0x42, 0x44, 0x44, 0x47, 0x44, 0x44, 0x4c, 0x40, 0x4c, 0x5c, 0x63, 0x5e, 0x5b, 0x11, 0x00, 0x00, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x08, 0x00, 0x86, 0x80, 0x86, 0x7a, 0x08, 0x1c, 0x5b, 0x58, 0x61, 0x52, 0x5c, 0x4c, 0x43, 0x40, 0x40, 0x48, 0x43, 0x40, 0x4f, 0x32, 0x09, 0x86, 0x80, 0x00, 0x00, 0xc3, 0xd7, 0xd9, 0xdc, 0xd7, 0xd8, 0xf3, 0xd9, 0xf3, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf7, 0xed, 0x00, 0x86, 0x86, 0x09, 0x09, 0x24, 0x51, 0x43, 0x4b, 0x44, 0x47, 0x4c, 0x48, 0x47, 0x52, 0x60, 0x5c, 0x65, 0x1b, 0x7a, 0x00, 0x00, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7c, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x86, 0x86, 0x80, 0x00, 0x08, 0x09, 0x26, 0x65, 0x54, 0x5c, 0x5c, 0x58, 0x55, 0x41, 0x44, 0x40, 0x45, 0x45, 0x37, 0x0e, 0x00, 0x80, 0x87, 0x00, 0x00, 0xcd, 0xdd, 0xd8, 0xd6, 0xf4, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xda, 0xda, 0xdc, 0xc4, 0x00, 0x7e, 0x00, 0x09, 0x0b, 0x39, 0x4f, 0x41, 0x41, 0x4c, 0x48, 0x40, 0x52, 0x5c, 0x58, 0x6c, 0x24, 0x08, 0x08, 0x00, 0x00, 0x00, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x86, 0x86, 0x00, 0x08, 0x00, 0x0a, 0x49, 0x65, 0x5e, 0x52, 0x5d, 0x58, 0x4c, 0x3c, 0x41, 0x3d, 0x49, 0x12, 0x08, 0x00, 0x81, 0x86, 0x00, 0x94, 0xf7, 0xd8, 0xd8, 0xdb, 0xd8, 0xd8, 0xf3, 0xd9, 0xf3, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xc0, 0xbf, 0xcf, 0x00, 0x00, 0x80, 0x86, 0x08, 0x12, 0x3a, 0x4f, 0x41, 0x4c, 0x48, 0x48, 0x5a, 0x5a, 0x60, 0x49, 0x0c, 0x08, 0x86, 0x00, 0x7a, 0x7a, 0x00, 0x86, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7d, 0xe5, 0xeb, 0xed, 0xa3, 0xe5, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x7d, 0x05, 0xf9, 0xc7, 0xc5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x08, 0x00, 0x00, 0x7a, 0x00, 0x7c, 0x00, 0x13, 0x51, 0x5e, 0x5a, 0x5d, 0x5a, 0x58, 0x43, 0x3c, 0x3e, 0x16, 0x00, 0x00, 0x7c, 0x08, 0x00, 0x82, 0xd4, 0xbf, 0xf4, 0xdb, 0xd5, 0xf4, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xbd, 0xdb, 0x78, 0xf9, 0x00, 0x80, 0x7e, 0x08, 0x08, 0x18, 0x45, 0x43, 0x48, 0x48, 0x52, 0x5a, 0x5c, 0x5f, 0x1a, 0x08, 0x00, 0x86, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xd2, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xd2, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xbb, 0xf7, 0xf7, 0xf7, 0xf7, 0xd6, 0xee, 0x7d, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x08, 0x00, 0x08, 0x08, 0x08, 0x7a, 0x86, 0x00, 0x09, 0x1c, 0x69, 0x5a, 0x63, 0x5a, 0x5e, 0x56, 0x51, 0x1a, 0x08, 0x7a, 0x81, 0x88, 0x00, 0x00, 0xce, 0xc0, 0xd9, 0xd9, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf3, 0xdc, 0xd9, 0xf8, 0x00, 0x88, 0x7c, 0x88, 0x00, 0x1a, 0x45, 0x48, 0x48, 0x5a, 0x58, 0x5f, 0x37, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xf7, 0xf6, 0xf1, 0xeb, 0xea, 0xa3, 0xca, 0xcf, 0xcd, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xd2, 0xd1, 0xce, 0xcd, 0xcf, 0xd3, 0xde, 0xf7, 0xf7, 0xc9, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3f, 0x59, 0x5d, 0x5d, 0x5e, 0x67, 0x26, 0x00, 0x81, 0x7a, 0x00, 0x88, 0x00, 0xea, 0xf7, 0xdb, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf5, 0xd7, 0xd6, 0xde, 0xf1, 0x00, 0x7c, 0x88, 0x88, 0x7a, 0x09, 0x20, 0x54, 0x4c, 0x5c, 0x5f, 0x5f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xf7, 0xee, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x01, 0x00, 0x00, 0x7a, 0x00, 0x02, 0x92, 0xeb, 0xd6, 0xf7, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x15, 0x56, 0x60, 0x60, 0x65, 0x2a, 0x1b, 0x7e, 0x00, 0x7a, 0x00, 0x00, 0x06, 0xd8, 0xdc, 0xd6, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf3, 0xdb, 0xd9, 0xf7, 0xc9, 0x00, 0x88, 0x7c, 0x01, 0x0a, 0x08, 0x24, 0x59, 0x58, 0x64, 0x24, 0x08, 0x00, 0x88, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xcd, 0x04, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc9, 0xf6, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x88, 0x08, 0x08, 0x24, 0x67, 0x64, 0x24, 0x1a, 0x1d, 0xc3, 0x7a, 0x7c, 0x00, 0x7d, 0xd4, 0xdd, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf3, 0xd9, 0xd9, 0xd7, 0xd9, 0xf4, 0xe4, 0x00, 0x01, 0x7d, 0xc2, 0x89, 0x0e, 0x39, 0x65, 0x53, 0x0e, 0x7a, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xe1, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x88, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x88, 0x7a, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0xe0, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x08, 0x0c, 0x57, 0x35, 0x16, 0xfe, 0x84, 0x84, 0x01, 0x00, 0x00, 0xcd, 0xf7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf3, 0xd9, 0xf4, 0xd9, 0xf6, 0xd3, 0x88, 0x7d, 0x0d, 0x8b, 0x8b, 0x02, 0x12, 0x67, 0x22, 0x00, 0x86, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x88, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x7a, 0x00, 0x1b, 0x1d, 0x1d, 0x8d, 0x84, 0x84, 0xe0, 0x00, 0xeb, 0xf7, 0xd9, 0xf4, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xf7, 0xef, 0x7d, 0xc2, 0x7f, 0x8b, 0xe0, 0x11, 0x22, 0x0e, 0x7a, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x00, 0x88, 0x1b, 0xc4, 0x8f, 0x84, 0xe1, 0xdf, 0xea, 0xde, 0xf5, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf3, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xf7, 0xe9, 0x7e, 0x82, 0x7f, 0xc3, 0x21, 0x14, 0x08, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x86, 0x86, 0x00, 0xf8, 0xe1, 0x84, 0x84, 0xc3, 0xe5, 0xdc, 0xf4, 0xd9, 0xd9, 0xd9, 0xf3, 0xfa, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf3, 0xd9, 0xd9, 0xd7, 0xf4, 0xd8, 0xdb, 0x85, 0x93, 0x01, 0x14, 0xfe, 0xe2, 0xc2, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x08, 0x7a, 0x86, 0x00, 0x00, 0x0d, 0x1d, 0xe2, 0x83, 0xe7, 0xd7, 0xdc, 0xd7, 0xd7, 0xd9, 0xfa, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf4, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xdc, 0xf2, 0x03, 0x10, 0x1d, 0xe3, 0x86, 0x86, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x86, 0x00, 0x7a, 0x1d, 0xf8, 0xe2, 0xd5, 0xdc, 0xd7, 0xd9, 0xd9, 0xf3, 0xd9, 0xf3, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf7, 0xcc, 0x01, 0x05, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x7d, 0x02, 0x04, 0xc3, 0xe0, 0x83, 0xe0, 0xe0, 0xdf, 0x02, 0x7c, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x7a, 0x88, 0x89, 0x01, 0x02, 0x02, 0x01, 0x7d, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x02, 0xe8, 0xbb, 0xf6, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xfb, 0xf6, 0xea, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x01, 0xc3, 0x8d, 0x8d, 0x8d, 0x84, 0xe1, 0x84, 0xe1, 0xc4, 0x84, 0x84, 0xc4, 0xc3, 0x01, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7d, 0x03, 0xe0, 0x8d, 0x84, 0xe2, 0x84, 0xe1, 0xe2, 0xc4, 0x8d, 0xc3, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7c, 0xd4, 0xdc, 0xd9, 0xd7, 0xd7, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xdc, 0xf6, 0xe0, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x88, 0xc3, 0xc4, 0xc4, 0xc4, 0xe2, 0x05, 0x84, 0xe2, 0x84, 0xe2, 0x84, 0xe2, 0xe1, 0x84, 0xc4, 0xe1, 0xdf, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xc3, 0x84, 0x84, 0xe1, 0x84, 0xc4, 0xc4, 0xe1, 0xe1, 0xc4, 0xe1, 0xe1, 0xe2, 0xe1, 0xc3, 0x02, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0xd6, 0xbf, 0xd7, 0xd9, 0xd9, 0xd7, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd7, 0xd9, 0xf7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xe0, 0xc4, 0xe1, 0xe1, 0xe2, 0xe1, 0xe1, 0xe1, 0x8d, 0x8d, 0x8d, 0xc4, 0xc4, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x03, 0xc4, 0xe1, 0xe1, 0xe1, 0xc4, 0xe2, 0xe2, 0xe2, 0xc4, 0xc4, 0xe1, 0xe1, 0xe2, 0xe1, 0xe2, 0x05, 0xe2, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xef, 0xfd, 0xd8, 0xd7, 0xd7, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf5, 0xfd, 0xdf, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x88, 0x00, 0x00, 0x00, 0x8d, 0xe2, 0xe1, 0xe2, 0x8d, 0xc3, 0x8d, 0xe4, 0xc6, 0xe9, 0xc9, 0xc8, 0x07, 0x05, 0x03, 0xe0, 0xc4, 0xc4, 0xe1, 0x8d, 0xe0, 0x7a, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0xdf, 0xe1, 0xc4, 0xe1, 0xe2, 0x05, 0xe1, 0xe0, 0xc3, 0x8d, 0xe3, 0xe3, 0x05, 0xe0, 0xdf, 0xe0, 0xc4, 0xe2, 0xc5, 0xe0, 0x00, 0x7c, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0xe7, 0xde, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xfd, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x7c, 0x04, 0xe2, 0xe2, 0xe2, 0xe1, 0xf9, 0xef, 0xd3, 0xd8, 0xdd, 0xdd, 0xfd, 0xf7, 0xdd, 0xd9, 0xd0, 0xec, 0xe1, 0xe0, 0xc4, 0xc4, 0xc4, 0xc3, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe1, 0xe1, 0xe1, 0xe2, 0x8d, 0x8d, 0xf9, 0xed, 0xd0, 0xd5, 0xd9, 0xf4, 0xd8, 0xbb, 0xce, 0x9d, 0xe3, 0x8d, 0xc6, 0x06, 0x88, 0x88, 0x00, 0x88, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x01, 0xbb, 0xf4, 0xd7, 0xd9, 0xd9, 0xd7, 0xf4, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xde, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0xe5, 0xcc, 0xc3, 0x8d, 0x07, 0xce, 0xf4, 0xde, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xde, 0xdd, 0xf2, 0xe9, 0xc3, 0x8d, 0xc4, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc4, 0xe2, 0xe1, 0xc4, 0xdf, 0xf9, 0xf1, 0xdc, 0xf7, 0xde, 0xde, 0xde, 0xdd, 0xfd, 0xf6, 0xdd, 0xfd, 0xd4, 0xec, 0xe3, 0x8d, 0x00, 0x04, 0xea, 0x7d, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x7a, 0x00, 0xf0, 0xf7, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdc, 0xfa, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0xe8, 0xf2, 0x02, 0xee, 0xf7, 0xde, 0xde, 0xde, 0xd9, 0xcd, 0xec, 0xc6, 0xe6, 0xf9, 0xc9, 0xf0, 0xbb, 0xf7, 0xdd, 0xf7, 0xef, 0xe0, 0xc4, 0x8d, 0xe1, 0x88, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe1, 0xc4, 0xf8, 0x93, 0xf1, 0xf7, 0xf7, 0xde, 0xd5, 0xd0, 0xcd, 0xf0, 0xcd, 0xcf, 0xd8, 0xfd, 0xf7, 0xdd, 0xf7, 0xf6, 0xec, 0xe2, 0xcc, 0xef, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xc5, 0xf7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xfc, 0xbb, 0x01, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x05, 0xd5, 0xf0, 0xde, 0xbf, 0xf7, 0xd3, 0x9d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc7, 0xd2, 0xf6, 0xf7, 0xef, 0x02, 0x8d, 0xc4, 0xdf, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe1, 0xc4, 0xe0, 0x07, 0xf2, 0xf7, 0xdd, 0xf1, 0xc8, 0x83, 0x7a, 0x00, 0x00, 0x00, 0x7c, 0x03, 0xe8, 0xcd, 0xbf, 0xf7, 0xde, 0xf7, 0xd6, 0xf7, 0xc4, 0x00, 0x7d, 0xe2, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x03, 0xf7, 0xdb, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xdd, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x88, 0x00, 0x00, 0xef, 0xed, 0x00, 0x03, 0xd5, 0xf7, 0xdd, 0xd6, 0xe9, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xdc, 0xf7, 0xca, 0xc2, 0xc4, 0xe0, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0xe0, 0xc4, 0x83, 0xc6, 0xbf, 0xf7, 0xce, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xee, 0x78, 0xde, 0xfd, 0xf7, 0xc3, 0x00, 0xc6, 0xc5, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xdc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf7, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd5, 0xcc, 0xf0, 0xf6, 0xdd, 0xbb, 0x04, 0x00, 0x08, 0x09, 0x08, 0x86, 0x00, 0x8a, 0x92, 0x9c, 0xc9, 0xc8, 0x84, 0x7d, 0x00, 0x00, 0xe1, 0xd3, 0xf7, 0xe8, 0xc3, 0x8d, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7c, 0xc4, 0x8d, 0x93, 0xd4, 0xc1, 0xea, 0x81, 0x00, 0x00, 0x81, 0xc2, 0x82, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd6, 0x85, 0xde, 0xd3, 0x04, 0xee, 0x01, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xde, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf7, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x7c, 0x7c, 0x00, 0x00, 0x9d, 0xfb, 0xf7, 0xdd, 0xbb, 0xc3, 0x00, 0x08, 0x7c, 0x7a, 0x00, 0x8f, 0xa9, 0xb8, 0xb8, 0xb9, 0xba, 0xbc, 0xbc, 0xbb, 0xa3, 0x89, 0x00, 0xdf, 0xd9, 0xd3, 0xc2, 0xe1, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x01, 0xe1, 0x04, 0xd0, 0xf7, 0xf9, 0x86, 0x00, 0x8f, 0xca, 0xd1, 0xbc, 0xd4, 0xd3, 0xcf, 0xcb, 0x9a, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf4, 0xfd, 0xdc, 0xf4, 0xec, 0x7a, 0xe6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xde, 0xd7, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf7, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x88, 0xe8, 0x02, 0x00, 0xdf, 0xd6, 0xdc, 0xdd, 0x83, 0x00, 0x7c, 0x81, 0x87, 0x8b, 0xa9, 0xb6, 0xb5, 0xb4, 0xb4, 0xb7, 0xb9, 0xbb, 0xbc, 0xbc, 0xbd, 0xd4, 0xe1, 0x00, 0x06, 0xde, 0xe9, 0x04, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x04, 0xc3, 0xc7, 0xf7, 0xc8, 0x00, 0x8d, 0xcc, 0xc1, 0xc1, 0xbd, 0xdb, 0xc0, 0xbd, 0xbc, 0xb9, 0xb9, 0xb7, 0xa7, 0x89, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xf6, 0xde, 0xde, 0xcd, 0xef, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xfd, 0xd8, 0xf4, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xf6, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x88, 0x00, 0xe0, 0xf0, 0xdf, 0xa3, 0xf7, 0xde, 0xee, 0x00, 0x08, 0x7e, 0x86, 0x8e, 0xb0, 0xad, 0xad, 0xb6, 0xb8, 0xbc, 0xb7, 0xc8, 0x90, 0xed, 0xdb, 0xd7, 0xdc, 0xd9, 0xe7, 0x00, 0xf0, 0xd1, 0xc2, 0xe0, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0xc3, 0xdf, 0xd2, 0xef, 0x00, 0xc5, 0xbc, 0xf7, 0xc0, 0xdb, 0xc1, 0xf7, 0xda, 0xc1, 0xc0, 0xb8, 0xb6, 0xb6, 0xb7, 0xcb, 0x83, 0x86, 0x86, 0x86, 0x00, 0xef, 0xf7, 0xf6, 0xf7, 0xe9, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xd6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0xe2, 0x06, 0xd8, 0xf4, 0xf4, 0xd4, 0x01, 0x00, 0x7d, 0x86, 0x8e, 0xb0, 0x9e, 0x9e, 0xa5, 0xb4, 0xde, 0xf7, 0x97, 0x00, 0x00, 0x00, 0xca, 0xf7, 0xdb, 0xde, 0xf7, 0x07, 0xe0, 0xd7, 0xe3, 0xe0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc7, 0xd4, 0x00, 0xf9, 0xf7, 0xf7, 0xc1, 0xdc, 0xf7, 0xd2, 0xe6, 0xc2, 0xc2, 0xca, 0xcb, 0xa2, 0xb6, 0xb4, 0xb1, 0xb1, 0x8c, 0x86, 0x86, 0x00, 0x7c, 0xf7, 0xf6, 0xf6, 0xf1, 0xcd, 0xf0, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xd4, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf6, 0xd3, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0xe7, 0x06, 0xcd, 0xd7, 0xf7, 0xee, 0x00, 0x08, 0x08, 0x87, 0xaf, 0xb2, 0x98, 0x98, 0x9b, 0xb9, 0x85, 0xf7, 0x07, 0x00, 0x00, 0x00, 0xec, 0xf7, 0xdd, 0xf6, 0xf6, 0xd5, 0x8d, 0xf0, 0xa3, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x02, 0xee, 0xec, 0x82, 0xd6, 0xde, 0xdc, 0xdd, 0xdd, 0xf7, 0xc5, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xb6, 0xba, 0xb3, 0xb1, 0xaf, 0xa9, 0x87, 0x86, 0x7a, 0x00, 0xce, 0xde, 0xde, 0xd6, 0xa3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd2, 0xdc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xdd, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x02, 0xd1, 0xf4, 0xf7, 0xe2, 0x00, 0x7a, 0x00, 0x9a, 0xb5, 0xb5, 0xb3, 0xa4, 0xbc, 0xde, 0xc0, 0xde, 0xf1, 0x00, 0x00, 0xc4, 0xd8, 0xde, 0xdc, 0xde, 0xde, 0xf7, 0xed, 0xe8, 0xcc, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x04, 0xf1, 0xc3, 0xce, 0xf7, 0xc1, 0xf7, 0xf6, 0xdc, 0xf7, 0x07, 0x00, 0x00, 0x00, 0x07, 0xf7, 0xfd, 0xa4, 0x99, 0xae, 0xab, 0xb1, 0x96, 0x00, 0x00, 0x00, 0xc7, 0xf7, 0xf7, 0xcc, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xdd, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xdb, 0xdc, 0x07, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xd1, 0xf4, 0xd6, 0x02, 0x86, 0x81, 0x00, 0xaf, 0xb5, 0xb2, 0xba, 0xde, 0x85, 0x85, 0xdd, 0xdd, 0xf7, 0xf1, 0xca, 0xd6, 0xf7, 0xc1, 0xde, 0xdc, 0xdd, 0xf7, 0xd5, 0x84, 0xce, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x7c, 0x92, 0xed, 0x93, 0xf7, 0xdc, 0xdd, 0xfd, 0xbf, 0xf7, 0xde, 0xd6, 0xf9, 0xdf, 0xe9, 0xf5, 0xf7, 0xf7, 0xb4, 0x95, 0xa5, 0xae, 0xab, 0xa9, 0x86, 0x00, 0x00, 0xc4, 0xf5, 0xf7, 0xce, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xf7, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xf4, 0xd7, 0xf5, 0xd7, 0xde, 0xd0, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xfd, 0xd1, 0x00, 0x00, 0x86, 0x87, 0xb2, 0xb2, 0xb1, 0xbe, 0xf7, 0x85, 0xdd, 0xfd, 0xdd, 0xfd, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xc1, 0xfd, 0xfc, 0xdd, 0xde, 0x97, 0xcc, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x7c, 0x94, 0x9d, 0xee, 0xf7, 0xdd, 0xfd, 0xfd, 0xdd, 0xf6, 0xf6, 0xf7, 0xf7, 0xde, 0xf7, 0xde, 0xf6, 0xc0, 0xdd, 0xb4, 0xa9, 0xae, 0xaa, 0xab, 0x8c, 0x00, 0x00, 0x04, 0xd5, 0xf7, 0xce, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xfd, 0xf5, 0xd9, 0xd9, 0xfa, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xf4, 0xf4, 0xd9, 0xdc, 0xd7, 0xf7, 0xe8, 0x00, 0x00, 0x7a, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xde, 0xf1, 0x00, 0x00, 0x00, 0x8c, 0xb3, 0xb0, 0xb2, 0xbe, 0xde, 0x85, 0xf6, 0xdd, 0xf6, 0xdd, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xdd, 0xf6, 0xfc, 0xdd, 0xde, 0x9c, 0xed, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x81, 0x97, 0x9d, 0xd3, 0xde, 0xf6, 0xf6, 0xf6, 0xdd, 0xfd, 0xf6, 0xfd, 0xf6, 0xf7, 0xdc, 0xf6, 0xfd, 0x85, 0xc1, 0xf7, 0xba, 0xae, 0xa6, 0xad, 0x90, 0x00, 0x00, 0x7d, 0xf2, 0xf7, 0xcc, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xfa, 0xd8, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf4, 0xd9, 0xf4, 0xf4, 0xd8, 0xf7, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xf7, 0xf1, 0x00, 0x00, 0x00, 0x8e, 0xb2, 0xaa, 0xb0, 0xbe, 0x78, 0x78, 0xfd, 0xdd, 0xf6, 0xfd, 0xf6, 0xf6, 0xf6, 0xde, 0xdd, 0xf6, 0xf6, 0xf6, 0xfd, 0x85, 0xec, 0xa7, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7c, 0x97, 0xc9, 0xbc, 0xdd, 0xf6, 0xf7, 0xdd, 0xf6, 0xf6, 0xf6, 0xdd, 0xf6, 0xbf, 0xde, 0xfd, 0xfd, 0xf6, 0x85, 0xdd, 0xbe, 0xab, 0xaa, 0xab, 0x96, 0x00, 0x00, 0x7d, 0xd1, 0xf7, 0xec, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0xca, 0xf7, 0xd7, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xfb, 0xd9, 0xf4, 0xde, 0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xf7, 0xd0, 0x00, 0x00, 0x00, 0x8c, 0xb0, 0xaa, 0xb0, 0xbe, 0xf6, 0x78, 0xf6, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd, 0xdd, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xdd, 0xf7, 0xac, 0xa7, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x94, 0xac, 0xd8, 0xde, 0xdd, 0xdc, 0xfd, 0xdd, 0xdd, 0xfd, 0xf6, 0xde, 0xde, 0xde, 0xf6, 0xfc, 0xdd, 0xf6, 0x78, 0xbe, 0xad, 0xa6, 0xab, 0x96, 0x00, 0x00, 0x7d, 0xd3, 0xdc, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x88, 0xcf, 0xfd, 0xd9, 0xd9, 0xfa, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf5, 0xde, 0xd3, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd2, 0xd5, 0x88, 0x00, 0x00, 0x82, 0xb0, 0xaa, 0xaa, 0xbc, 0xde, 0x78, 0xdd, 0xfd, 0xf6, 0xfd, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x85, 0xde, 0xdc, 0xc1, 0x85, 0xa7, 0xa3, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x93, 0xca, 0xbc, 0xdd, 0xde, 0xf6, 0xf6, 0xfd, 0xdd, 0xfd, 0xdd, 0xdd, 0xf6, 0xf6, 0xfd, 0xfd, 0x78, 0xbf, 0x78, 0xbe, 0xab, 0xa6, 0xab, 0x91, 0x00, 0x00, 0xdf, 0xbb, 0xd5, 0x03, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x8d, 0xd6, 0xf6, 0xd9, 0xd7, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xf4, 0xdd, 0xd0, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xf7, 0x83, 0x00, 0x00, 0x88, 0xab, 0xaa, 0xa6, 0xb8, 0xdd, 0x85, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xdd, 0xf6, 0xf6, 0xdd, 0xde, 0xbd, 0xa7, 0x97, 0x86, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x8b, 0xa3, 0xb7, 0xf7, 0xdd, 0xf6, 0xf6, 0xdd, 0xf6, 0xf6, 0xf6, 0xfd, 0xf6, 0xdd, 0xfd, 0xfc, 0xde, 0x85, 0xf7, 0xbc, 0xa8, 0xa1, 0xa8, 0x8c, 0x00, 0x00, 0xe2, 0xdb, 0xca, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x7a, 0x00, 0xc3, 0xd4, 0xf6, 0xf4, 0xf4, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xf7, 0xf0, 0x01, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xbf, 0x94, 0x00, 0x08, 0x00, 0x9f, 0xaa, 0xa6, 0xb0, 0xc1, 0xc0, 0xf6, 0xdd, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xbf, 0xde, 0xdd, 0xf7, 0xce, 0xa2, 0x8c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x00, 0x9a, 0xcc, 0xf7, 0xc1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xfd, 0xfc, 0xf6, 0xc0, 0xde, 0xb6, 0xa1, 0xa6, 0xa4, 0x89, 0x00, 0x00, 0xc7, 0xd8, 0xc4, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x00, 0x00, 0xe1, 0xf2, 0xdd, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf5, 0xde, 0xec, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xcc, 0x86, 0x7a, 0x00, 0x91, 0xa6, 0xa6, 0xa8, 0xba, 0x85, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 0xf7, 0xbc, 0xa7, 0x9a, 0x00, 0x86, 0x08, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x86, 0x86, 0x8b, 0xea, 0xbd, 0xf7, 0xbf, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xfc, 0xfc, 0xf6, 0x85, 0xc0, 0xab, 0xa1, 0xa6, 0x99, 0x86, 0x00, 0x00, 0xce, 0xef, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x7a, 0xd0, 0xde, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xdb, 0xd9, 0xdb, 0xd9, 0xdb, 0xdc, 0xc9, 0x00, 0x88, 0x7c, 0x88, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x88, 0xce, 0x82, 0x00, 0x00, 0x8a, 0xa4, 0xa6, 0xa5, 0xab, 0xbe, 0xdd, 0xc0, 0xf6, 0xf6, 0xf6, 0xde, 0xf6, 0xf6, 0xf6, 0xc0, 0xf7, 0xbd, 0xac, 0x9c, 0x8a, 0x87, 0x00, 0x08, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x00, 0x86, 0x00, 0x86, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x90, 0xf0, 0xc0, 0x85, 0xc1, 0xdc, 0xc1, 0xf6, 0xdc, 0xf6, 0xf6, 0xf6, 0xfc, 0x78, 0xc0, 0xc0, 0xb5, 0xa0, 0xa1, 0xa5, 0x8c, 0x00, 0x00, 0x01, 0xbb, 0x04, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xec, 0xdd, 0xf6, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xd7, 0xdb, 0xd6, 0xe8, 0x00, 0x00, 0x7d, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x08, 0x00, 0x7a, 0x81, 0x00, 0xe1, 0xe8, 0x7a, 0x00, 0x87, 0x8e, 0xad, 0xa0, 0xa1, 0xae, 0xbc, 0xf7, 0xc1, 0xc1, 0xf6, 0xf6, 0xdc, 0xde, 0xde, 0xdd, 0xb9, 0xaf, 0xa7, 0x8c, 0x86, 0x86, 0x86, 0x7a, 0x09, 0x00, 0x00, 0x86, 0x00, 0x08, 0x7a, 0x00, 0x86, 0x00, 0x86, 0x00, 0x86, 0x00, 0x00, 0x00, 0x08, 0x00, 0x86, 0x00, 0x08, 0x09, 0x00, 0x00, 0x9a, 0xb4, 0xda, 0x85, 0xc0, 0xc0, 0xbf, 0xf6, 0xfc, 0xfc, 0xfc, 0xf6, 0x85, 0xc1, 0xb3, 0xa1, 0xa1, 0xa8, 0x99, 0x87, 0x00, 0x00, 0xec, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0xc6, 0xd5, 0xf7, 0xd9, 0xd9, 0xf4, 0xf3, 0xf4, 0xf3, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xdb, 0xf4, 0xd8, 0xdd, 0xcc, 0x7d, 0x01, 0x01, 0x7d, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x0d, 0x00, 0x7a, 0x87, 0x87, 0x95, 0xab, 0xa1, 0xa0, 0xa4, 0xb1, 0xbc, 0xbe, 0xbe, 0xc1, 0xc1, 0xbe, 0xb9, 0xb1, 0xad, 0xa7, 0x8c, 0x86, 0x86, 0x00, 0x08, 0x08, 0x00, 0x86, 0x00, 0x00, 0x00, 0x08, 0x08, 0x09, 0x0a, 0x0b, 0x0b, 0x0a, 0x08, 0x08, 0x00, 0x00, 0x00, 0x7a, 0x86, 0x00, 0x00, 0x7a, 0x00, 0x87, 0x80, 0x9c, 0xac, 0xb7, 0xc0, 0xdd, 0xde, 0xde, 0xc1, 0xdd, 0xde, 0xc1, 0xba, 0xad, 0x9e, 0xa1, 0xa5, 0x9b, 0x87, 0x00, 0x00, 0xe1, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd, 0xf7, 0xd9, 0xf4, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xf4, 0xd4, 0xd3, 0xf2, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x86, 0x86, 0x00, 0x7a, 0x7c, 0x00, 0x7a, 0x00, 0x09, 0x7a, 0x89, 0x87, 0x87, 0x99, 0xab, 0xa8, 0xa5, 0xa0, 0xa0, 0xa8, 0xab, 0xad, 0xad, 0xab, 0xa8, 0xab, 0xa2, 0x8a, 0x87, 0x00, 0x00, 0x08, 0x09, 0x00, 0x86, 0x86, 0x00, 0x0a, 0x15, 0x1b, 0x22, 0x24, 0x24, 0x24, 0x2a, 0x26, 0x26, 0x22, 0x1b, 0x13, 0x0b, 0x00, 0x00, 0x81, 0x00, 0x86, 0x86, 0x86, 0x86, 0x87, 0x9c, 0xa9, 0xa9, 0xb4, 0xb8, 0xba, 0xba, 0xba, 0xb4, 0xab, 0xa0, 0x9e, 0xa5, 0xa8, 0x9b, 0x8a, 0x80, 0x00, 0x7a, 0x02, 0x00, 0x00, 0x7a, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x08, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x88, 0xc6, 0x9d, 0xc7, 0xe5, 0xe0, 0x7c, 0xef, 0xdb, 0xd9, 0xf3, 0xd9, 0xf3, 0xd9, 0xd8, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd7, 0xdc, 0xd8, 0xd9, 0xf5, 0xbf, 0xf7, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x86, 0x86, 0x00, 0x00, 0x00, 0x86, 0x86, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x7a, 0x00, 0x7a, 0x87, 0x86, 0x8c, 0x99, 0xa5, 0xa8, 0xa5, 0xa8, 0xa8, 0xa5, 0xa8, 0xa8, 0x9f, 0x91, 0x87, 0x87, 0x7a, 0x00, 0x00, 0x08, 0x00, 0x7a, 0x00, 0x09, 0x1a, 0x26, 0x24, 0x24, 0x24, 0x24, 0x23, 0x1c, 0x1f, 0x1c, 0x1c, 0x1c, 0x20, 0x2e, 0x35, 0x1e, 0x0c, 0x00, 0x00, 0x86, 0x86, 0x86, 0x80, 0x00, 0x87, 0x96, 0xa4, 0x9f, 0x9f, 0x9e, 0x9b, 0x9e, 0x9e, 0x9e, 0xa5, 0xa5, 0xa0, 0x95, 0x87, 0x80, 0x7e, 0x08, 0x09, 0x08, 0x00, 0x7d, 0x88, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0xe7, 0xf4, 0xf7, 0xf7, 0xde, 0xdc, 0xd4, 0xd9, 0xf4, 0xf4, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd7, 0xf5, 0xf4, 0xf6, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x0c, 0x11, 0x0e, 0x0f, 0x0f, 0x0e, 0x0a, 0x0a, 0x00, 0x00, 0x86, 0x80, 0x8a, 0x91, 0x9a, 0x9b, 0x9c, 0x9c, 0x96, 0x8e, 0x87, 0x86, 0x86, 0x00, 0x08, 0x08, 0x08, 0x00, 0x86, 0x00, 0x08, 0x18, 0x29, 0x28, 0x23, 0x23, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x23, 0x2f, 0x35, 0x0e, 0x7a, 0x00, 0x81, 0x00, 0x08, 0x00, 0x86, 0x87, 0x8a, 0x99, 0x9f, 0xa4, 0xa5, 0xa5, 0xa1, 0xa0, 0x9e, 0x99, 0x8a, 0x87, 0x86, 0x86, 0x7a, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7a, 0x08, 0x7a, 0x7a, 0x00, 0x86, 0x86, 0x7a, 0x86, 0x00, 0x00, 0x7a, 0x86, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x7c, 0x00, 0x05, 0xd4, 0xdc, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xdb, 0xde, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x08, 0x08, 0x08, 0x0e, 0x16, 0x1e, 0x22, 0x26, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2a, 0x24, 0x20, 0x1a, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x7a, 0x00, 0x86, 0x80, 0x86, 0x0f, 0x4a, 0x31, 0x31, 0x27, 0x25, 0x23, 0x23, 0x23, 0x1f, 0x1f, 0x1f, 0x23, 0x25, 0x23, 0x27, 0x31, 0x3a, 0x59, 0x39, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x86, 0x86, 0x00, 0x87, 0x8b, 0x8c, 0x8e, 0x8c, 0x8a, 0x87, 0x87, 0x86, 0x00, 0x7a, 0x09, 0x0c, 0x11, 0x1b, 0x1e, 0x1e, 0x1e, 0x22, 0x1e, 0x1e, 0x18, 0x13, 0x11, 0x09, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x86, 0x86, 0x81, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xe2, 0xdd, 0xbf, 0xd9, 0xd9, 0xd8, 0xd9, 0xf3, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xf6, 0xd3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x86, 0x00, 0x08, 0x7a, 0x0a, 0x12, 0x1c, 0x2a, 0x2e, 0x29, 0x29, 0x29, 0x28, 0x28, 0x29, 0x29, 0x29, 0x2f, 0x25, 0x2f, 0x32, 0x2a, 0x1c, 0x0e, 0x08, 0x00, 0x00, 0x86, 0x86, 0x86, 0x86, 0x00, 0x00, 0x08, 0x08, 0x00, 0x7a, 0x00, 0x86, 0x86, 0x86, 0x00, 0x13, 0x6e, 0x58, 0x52, 0x48, 0x3c, 0x3a, 0x31, 0x31, 0x27, 0x27, 0x31, 0x31, 0x3a, 0x3c, 0x48, 0x58, 0x66, 0x5f, 0x53, 0x0a, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x09, 0x00, 0x00, 0x7a, 0x86, 0x00, 0x00, 0x00, 0x86, 0x80, 0x00, 0x7a, 0x0a, 0x15, 0x1c, 0x26, 0x26, 0x26, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x22, 0x1b, 0x11, 0x0a, 0x00, 0x7a, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x7a, 0x00, 0xed, 0xdc, 0xdb, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xf3, 0xd8, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xf7, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x08, 0x0c, 0x1b, 0x2e, 0x33, 0x28, 0x27, 0x28, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x25, 0x27, 0x2c, 0x33, 0x30, 0x28, 0x2f, 0x32, 0x24, 0x13, 0x00, 0x00, 0x80, 0x87, 0x86, 0x00, 0x00, 0x08, 0x7a, 0x00, 0x86, 0x86, 0x86, 0x86, 0x7a, 0x7a, 0x00, 0x0e, 0x67, 0x5c, 0x5a, 0x61, 0x58, 0x5e, 0x63, 0x63, 0x5a, 0x5a, 0x61, 0x5d, 0x5d, 0x61, 0x61, 0x61, 0x5a, 0x6d, 0x37, 0x00, 0x86, 0x86, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x86, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x16, 0x20, 0x2f, 0x2f, 0x28, 0x25, 0x25, 0x25, 0x27, 0x28, 0x2c, 0x25, 0x27, 0x2b, 0x2b, 0x2b, 0x2f, 0x32, 0x32, 0x22, 0x13, 0x09, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd4, 0xdc, 0xd9, 0xf4, 0xd8, 0xf3, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xf6, 0x06, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x12, 0x24, 0x39, 0x25, 0x2b, 0x27, 0x2b, 0x2c, 0x2c, 0x2c, 0x27, 0x30, 0x27, 0x2d, 0x2c, 0x2c, 0x30, 0x27, 0x2c, 0x2b, 0x28, 0x2f, 0x2e, 0x16, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x86, 0x86, 0x86, 0x00, 0x7a, 0x08, 0x08, 0x00, 0x1b, 0x65, 0x66, 0x5a, 0x5a, 0x5d, 0x63, 0x63, 0x5d, 0x63, 0x63, 0x63, 0x6a, 0x66, 0x62, 0x61, 0x6d, 0x59, 0x12, 0x08, 0x86, 0x86, 0x86, 0x00, 0x86, 0x86, 0x86, 0x00, 0x86, 0x86, 0x86, 0x86, 0x00, 0x00, 0x7a, 0x0f, 0x1e, 0x2a, 0x29, 0x25, 0x2b, 0x2c, 0x25, 0x30, 0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x28, 0x2f, 0x32, 0x1c, 0x0e, 0x08, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xea, 0xf7, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xf3, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xdc, 0xbb, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0e, 0x32, 0x2d, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x27, 0x2b, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x29, 0x2f, 0x18, 0x09, 0x7a, 0x86, 0x00, 0x00, 0x08, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x64, 0x69, 0x66, 0x5d, 0x5d, 0x60, 0x61, 0x61, 0x6a, 0x6a, 0x6a, 0x6a, 0x60, 0x6d, 0x67, 0x13, 0x00, 0x08, 0x00, 0x00, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00, 0x08, 0x00, 0x86, 0x86, 0x86, 0x00, 0x0b, 0x23, 0x2f, 0x25, 0x28, 0x28, 0x28, 0x27, 0x2c, 0x2b, 0x27, 0x28, 0x2b, 0x27, 0x2b, 0x2b, 0x2b, 0x2d, 0x2c, 0x2b, 0x2d, 0x28, 0x2c, 0x2d, 0x36, 0x20, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xdc, 0xd7, 0xdb, 0xd8, 0xf3, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf6, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x22, 0x36, 0x25, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x2b, 0x28, 0x2b, 0x28, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x2f, 0x32, 0x12, 0x00, 0x00, 0x86, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x08, 0x00, 0x0b, 0x39, 0x64, 0x69, 0x6a, 0x63, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x6e, 0x3e, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x88, 0x00, 0x7a, 0x08, 0x1a, 0x2f, 0x23, 0x28, 0x2f, 0x28, 0x27, 0x2b, 0x27, 0x2c, 0x28, 0x27, 0x28, 0x2b, 0x28, 0x2c, 0x28, 0x2b, 0x2b, 0x2b, 0x28, 0x2d, 0x2b, 0x30, 0x28, 0x39, 0x1a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xdc, 0xd9, 0xd9, 0xd9, 0xf3, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xde, 0xca, 0x00, 0x88, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x32, 0x27, 0x27, 0x2b, 0x28, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x30, 0x28, 0x37, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x86, 0x00, 0x7a, 0x1b, 0x5f, 0x6d, 0x6a, 0x6a, 0x6a, 0x6a, 0x6d, 0x6d, 0x6e, 0x20, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x86, 0x00, 0x08, 0x0e, 0x22, 0x2f, 0x28, 0x28, 0x28, 0x2b, 0x28, 0x27, 0x2c, 0x2b, 0x27, 0x28, 0x27, 0x28, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x28, 0x2c, 0x27, 0x33, 0x29, 0x2e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xf7, 0xd7, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xde, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x08, 0x20, 0x2f, 0x27, 0x31, 0x28, 0x28, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x30, 0x2c, 0x2b, 0x35, 0x0f, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x08, 0x81, 0x86, 0x86, 0x86, 0x00, 0x0b, 0x1f, 0x5f, 0x6d, 0x68, 0x6d, 0x6c, 0x37, 0x12, 0x00, 0x00, 0x86, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x16, 0x32, 0x28, 0x28, 0x28, 0x28, 0x2b, 0x2b, 0x27, 0x2b, 0x27, 0x28, 0x27, 0x28, 0x27, 0x28, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x2d, 0x2c, 0x30, 0x31, 0x28, 0x32, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x92, 0xdc, 0xf4, 0xd8, 0xf3, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xde, 0xc8, 0x00, 0x00, 0x7d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x86, 0x7a, 0x00, 0x2a, 0x2b, 0x31, 0x27, 0x28, 0x29, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x31, 0x2c, 0x33, 0x35, 0x13, 0x00, 0x81, 0x7a, 0x00, 0x7a, 0x00, 0x7c, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x00, 0x86, 0x86, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x2f, 0x70, 0x6b, 0x1c, 0x09, 0x00, 0x00, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x8d, 0x0d, 0x7a, 0x00, 0x7a, 0x09, 0x1c, 0x2f, 0x25, 0x28, 0x25, 0x2b, 0x28, 0x27, 0x28, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x2d, 0x28, 0x2d, 0x2c, 0x30, 0x30, 0x33, 0x36, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x00, 0x8d, 0xf4, 0xf4, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xdd, 0x9d, 0x00, 0x00, 0xe4, 0xe4, 0x00, 0x00, 0x88, 0x00, 0x86, 0x7a, 0x08, 0x20, 0x2f, 0x27, 0x31, 0x28, 0x28, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2d, 0x2c, 0x30, 0x31, 0x33, 0x32, 0x13, 0x00, 0x00, 0x00, 0x00, 0x88, 0x7d, 0xed, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x08, 0x08, 0x08, 0x00, 0x86, 0x80, 0x86, 0x00, 0x6f, 0x19, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x86, 0x00, 0x00, 0x7a, 0x00, 0x88, 0x7a, 0x00, 0x7c, 0xf0, 0x88, 0x00, 0x7a, 0x08, 0x09, 0x20, 0x29, 0x27, 0x25, 0x27, 0x28, 0x27, 0x2b, 0x2b, 0x28, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x2b, 0x2d, 0x30, 0x31, 0x2c, 0x2f, 0x22, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0xec, 0x8d, 0xc2, 0xd7, 0xdb, 0xd9, 0xf4, 0xf3, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xde, 0xeb, 0x00, 0x00, 0xca, 0xca, 0x00, 0x7a, 0x7a, 0x7a, 0x00, 0x7a, 0x7a, 0x1e, 0x2f, 0x27, 0x27, 0x28, 0x28, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x30, 0x33, 0x28, 0x39, 0x13, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0xcd, 0xee, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x86, 0x80, 0x86, 0x00, 0x9d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x00, 0x7a, 0x88, 0x7a, 0x88, 0x86, 0x00, 0xf0, 0xa3, 0x00, 0x81, 0x86, 0x88, 0x08, 0x22, 0x29, 0x27, 0x2b, 0x27, 0x2c, 0x2b, 0x27, 0x28, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x27, 0x2c, 0x2b, 0x28, 0x2d, 0x2c, 0x30, 0x2b, 0x36, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0xee, 0xeb, 0xdf, 0xf4, 0xf4, 0xd9, 0xf4, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xde, 0xf0, 0x00, 0x00, 0xcd, 0xbb, 0x00, 0x00, 0x7a, 0x88, 0x7a, 0x00, 0x08, 0x13, 0x2a, 0x2b, 0x2c, 0x2c, 0x28, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2d, 0x2b, 0x2d, 0x35, 0x0f, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0xe3, 0xf7, 0x9d, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x01, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0xca, 0xd5, 0x03, 0x00, 0x81, 0x86, 0x7a, 0x08, 0x16, 0x2f, 0x27, 0x27, 0x27, 0x2b, 0x2c, 0x28, 0x2b, 0x27, 0x28, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x28, 0x28, 0x2d, 0x30, 0x2d, 0x32, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7a, 0x00, 0xec, 0xd0, 0xe2, 0xdb, 0xdb, 0xd9, 0xf4, 0xf3, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xdc, 0xf2, 0x88, 0x88, 0xd1, 0xf7, 0x8d, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x22, 0x29, 0x27, 0x2c, 0x27, 0x2c, 0x28, 0x2b, 0x2b, 0x2b, 0x28, 0x2b, 0x2b, 0x28, 0x28, 0x28, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2d, 0x30, 0x28, 0x37, 0x1c, 0x0a, 0x00, 0x7a, 0x86, 0x7a, 0x7a, 0x00, 0x00, 0xef, 0xf7, 0xca, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x81, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xed, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x7c, 0xed, 0xf7, 0xc7, 0x00, 0x00, 0x88, 0x86, 0x00, 0x7a, 0x0e, 0x26, 0x28, 0x28, 0x2b, 0x27, 0x2b, 0x27, 0x2b, 0x28, 0x28, 0x2d, 0x28, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x2b, 0x2b, 0x2d, 0x2d, 0x2d, 0x30, 0x2d, 0x2f, 0x20, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x7a, 0x00, 0xed, 0xd4, 0xee, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xdb, 0xf6, 0x05, 0x00, 0xf2, 0xf7, 0xed, 0x88, 0x7d, 0x00, 0x86, 0x86, 0x7a, 0x7a, 0x0e, 0x2a, 0x2f, 0x27, 0x31, 0x27, 0x2b, 0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x2b, 0x28, 0x2b, 0x2b, 0x27, 0x2d, 0x30, 0x2b, 0x27, 0x27, 0x36, 0x2a, 0x0e, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x88, 0x00, 0x02, 0xd8, 0xf7, 0xd1, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x0d, 0xfb, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xd1, 0xf7, 0xce, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x7a, 0x00, 0x14, 0x32, 0x25, 0x28, 0x2d, 0x2c, 0x27, 0x28, 0x28, 0x25, 0x2b, 0x28, 0x2b, 0x28, 0x2b, 0x28, 0x2c, 0x2b, 0x28, 0x28, 0x2d, 0x30, 0x30, 0x27, 0x36, 0x2a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x04, 0x89, 0x00, 0xed, 0xf6, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf7, 0xed, 0x7c, 0xd4, 0xf4, 0xdc, 0x06, 0x89, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x26, 0x32, 0x25, 0x2b, 0x28, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x31, 0x27, 0x27, 0x2b, 0x33, 0x2f, 0x2f, 0x26, 0x12, 0x00, 0x00, 0x86, 0x86, 0x86, 0x7a, 0x00, 0x88, 0x00, 0x00, 0xe6, 0xdd, 0xf7, 0xf7, 0xd4, 0xee, 0xc5, 0x04, 0x7d, 0x88, 0x7a, 0x7d, 0x02, 0xc6, 0xd3, 0xf7, 0xd4, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc6, 0xce, 0xfd, 0xf7, 0xd2, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x88, 0x00, 0x08, 0x18, 0x35, 0x2f, 0x25, 0x2c, 0x27, 0x30, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x30, 0x33, 0x30, 0x2c, 0x2d, 0x2f, 0x20, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xe2, 0xcf, 0x8d, 0x01, 0x88, 0xce, 0xdc, 0xdb, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdc, 0xd4, 0x06, 0xbb, 0xdc, 0xf6, 0xf1, 0x88, 0xdf, 0x7d, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x0f, 0x22, 0x35, 0x2f, 0x28, 0x28, 0x27, 0x2b, 0x2c, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x27, 0x33, 0x27, 0x28, 0x2f, 0x29, 0x22, 0x0f, 0x08, 0x08, 0x00, 0x00, 0x86, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x00, 0x00, 0xee, 0xf7, 0xf6, 0xf7, 0xf7, 0x78, 0xd8, 0xd2, 0xd0, 0xf1, 0xd2, 0xd4, 0xde, 0x85, 0x85, 0xc0, 0xc0, 0xcd, 0xec, 0x9d, 0xc9, 0xeb, 0xee, 0xf1, 0xd6, 0xf7, 0xf7, 0xf7, 0xd6, 0xe1, 0x00, 0x00, 0x00, 0x88, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x18, 0x29, 0x2f, 0x2c, 0x27, 0x30, 0x27, 0x30, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x31, 0x36, 0x29, 0x1e, 0x0c, 0x00, 0x00, 0x86, 0x00, 0x00, 0x7d, 0x7f, 0xc9, 0x85, 0x05, 0x89, 0x7c, 0xd4, 0xf4, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf6, 0xd2, 0xd6, 0xd9, 0xd9, 0xde, 0xec, 0x01, 0xc3, 0x01, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x12, 0x20, 0x35, 0x2a, 0x32, 0x2f, 0x28, 0x2c, 0x2c, 0x2c, 0x2b, 0x28, 0x2b, 0x2f, 0x2f, 0x32, 0x2e, 0x20, 0x13, 0x08, 0x00, 0x00, 0x00, 0x86, 0x86, 0x00, 0x7a, 0x00, 0x88, 0x00, 0x88, 0x00, 0x00, 0x00, 0xd2, 0xf7, 0xfc, 0xfc, 0xfc, 0xdd, 0x85, 0x85, 0xf7, 0xf7, 0x79, 0xfc, 0xf6, 0xbf, 0xf6, 0x78, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xde, 0xdc, 0xf7, 0xbf, 0x03, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x08, 0x00, 0x0f, 0x1e, 0x29, 0x2f, 0x2b, 0x2b, 0x27, 0x28, 0x2b, 0x2b, 0x2b, 0x28, 0x2b, 0x2b, 0x28, 0x33, 0x37, 0x32, 0x22, 0x13, 0x7a, 0x00, 0x00, 0x86, 0x86, 0x00, 0x7d, 0xc4, 0x8d, 0xf2, 0xde, 0x07, 0x7a, 0x94, 0xf7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xdb, 0xd9, 0xd9, 0xdb, 0xd9, 0xdc, 0xc6, 0x02, 0x8d, 0x01, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x1a, 0x22, 0x26, 0x2a, 0x2a, 0x32, 0x29, 0x2a, 0x2a, 0x2e, 0x2a, 0x22, 0x1a, 0x0f, 0x09, 0x00, 0x00, 0x00, 0x88, 0x86, 0x00, 0x00, 0x86, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0xe1, 0xd5, 0xde, 0xff, 0xdc, 0xf6, 0xbf, 0xdd, 0x78, 0x78, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0xdc, 0xc0, 0xc1, 0xdc, 0xf6, 0xf4, 0xf7, 0xd6, 0x06, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x86, 0x00, 0x08, 0x08, 0x12, 0x1c, 0x24, 0x29, 0x32, 0x2f, 0x32, 0x32, 0x2f, 0x2f, 0x32, 0x37, 0x2f, 0x29, 0x1e, 0x13, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc4, 0x02, 0xec, 0xde, 0xf6, 0xf9, 0x88, 0xf0, 0xdd, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd7, 0xd7, 0xdc, 0xd8, 0xe4, 0x7f, 0x8d, 0xc3, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x0f, 0x0f, 0x13, 0x13, 0x11, 0x11, 0x0e, 0x0a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x92, 0xfd, 0xf6, 0xfb, 0x78, 0x78, 0x79, 0x75, 0x72, 0x71, 0x70, 0x6e, 0x6e, 0x70, 0x71, 0x74, 0x79, 0xf7, 0x78, 0xdc, 0xdb, 0xdc, 0xde, 0xde, 0x05, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00, 0x08, 0x0b, 0x0f, 0x13, 0x1a, 0x1b, 0x1c, 0x1e, 0x1e, 0x1b, 0x15, 0x12, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0xe1, 0xdf, 0xf9, 0xdc, 0xf4, 0xdd, 0xe8, 0xc5, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xd7, 0xf5, 0xd9, 0xdc, 0xd4, 0x92, 0xe0, 0xc4, 0x8d, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x86, 0x86, 0x86, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd4, 0x76, 0x74, 0x71, 0x6b, 0x56, 0x45, 0x4f, 0x45, 0x55, 0x4f, 0x55, 0x54, 0x56, 0x67, 0x72, 0x77, 0x79, 0xde, 0xfd, 0xf4, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x00, 0x7a, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x7a, 0x00, 0x08, 0x00, 0x7a, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x09, 0xc3, 0x1d, 0xc3, 0xe6, 0xf4, 0xdc, 0xd9, 0xdc, 0xcc, 0xf2, 0xdb, 0xd9, 0xd9, 0xd8, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf3, 0xf3, 0xf3, 0xd7, 0xdb, 0xf3, 0xd9, 0xf3, 0xdd, 0xd3, 0x92, 0x04, 0xe2, 0x1d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x08, 0x00, 0x08, 0x00, 0x00, 0x86, 0x00, 0x00, 0x08, 0x08, 0x7a, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x7b, 0x73, 0x6b, 0x4f, 0x58, 0x5a, 0x5d, 0x62, 0x5c, 0x61, 0x5c, 0x5c, 0x5c, 0x58, 0x55, 0x51, 0x65, 0x72, 0xf2, 0xf2, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x8d, 0x84, 0x7f, 0xe7, 0xd6, 0xde, 0xd7, 0xd8, 0xf4, 0xdb, 0xdc, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xf3, 0xf4, 0xd7, 0xf4, 0xc1, 0xf5, 0xe6, 0xc3, 0xf8, 0x05, 0x19, 0x01, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0f, 0x57, 0x67, 0x5e, 0x62, 0x63, 0x63, 0x63, 0x5d, 0x66, 0x63, 0x66, 0x66, 0x68, 0x59, 0x65, 0x6b, 0xc9, 0x7d, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x86, 0x00, 0x00, 0x86, 0x7a, 0x86, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0a, 0xe0, 0x19, 0x84, 0x7f, 0xc6, 0xc1, 0xdc, 0xd7, 0xd7, 0xdb, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xdc, 0xd7, 0xf6, 0xd6, 0xc9, 0x89, 0x8d, 0xe1, 0xe1, 0x8d, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3b, 0x6e, 0x65, 0x5e, 0x63, 0x5d, 0x62, 0x5d, 0x5d, 0x62, 0x68, 0x5f, 0x6c, 0x6e, 0x3b, 0x7c, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xe1, 0xe1, 0x8d, 0x01, 0xc9, 0xbf, 0xf5, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xd9, 0xf4, 0xf7, 0xcc, 0xe2, 0xe0, 0xe2, 0xe2, 0xe2, 0x8d, 0x01, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x13, 0x39, 0x67, 0x64, 0x6c, 0x64, 0x65, 0x6c, 0x64, 0x67, 0x67, 0x3b, 0x13, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x03, 0xe2, 0xe2, 0xc4, 0xe0, 0x8d, 0xef, 0xf7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xd9, 0xd9, 0xdb, 0xd8, 0xde, 0xd1, 0x94, 0xdf, 0x8d, 0x05, 0xe2, 0xe1, 0x8d, 0x02, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x08, 0x08, 0x09, 0x11, 0x1e, 0x26, 0x2e, 0x3b, 0x35, 0x2a, 0x1b, 0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xdf, 0xe1, 0x05, 0xe1, 0x8d, 0x04, 0xe3, 0xf1, 0xfd, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xf6, 0xde, 0xed, 0xe2, 0xc3, 0xe1, 0xe1, 0xe2, 0xe2, 0xe1, 0xe0, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x81, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x88, 0x01, 0xe0, 0xe2, 0xe2, 0xe1, 0x8d, 0xe0, 0xe0, 0xeb, 0xd9, 0xde, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xdd, 0xbb, 0xe9, 0x8d, 0xe0, 0xc4, 0xe1, 0xe1, 0xe1, 0xc4, 0x8d, 0x04, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7c, 0xc3, 0xe1, 0xe1, 0xe2, 0xe1, 0x8d, 0x8d, 0xc3, 0x07, 0xd0, 0xdd, 0xf5, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf6, 0xfd, 0xd1, 0xe8, 0xc3, 0xc3, 0xc4, 0xc4, 0xfe, 0xc4, 0x8d, 0xe1, 0x8d, 0x04, 0x01, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xc4, 0xe1, 0xe1, 0xe1, 0xc4, 0x8d, 0xc3, 0x03, 0x92, 0xcc, 0xde, 0xf6, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf5, 0xf6, 0xff, 0xcf, 0xc7, 0x19, 0xc3, 0xc4, 0x8d, 0xe1, 0xe1, 0x19, 0xc4, 0xe1, 0xe1, 0xc3, 0x03, 0x89, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7c, 0x03, 0xc3, 0xc4, 0xe1, 0xc4, 0xc4, 0xe1, 0xe1, 0x8d, 0xc3, 0x04, 0xe6, 0xcc, 0xf4, 0xfd, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xfa, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xd9, 0xf5, 0xf4, 0xd9, 0xf4, 0xdb, 0xde, 0xfd, 0xcf, 0x9d, 0xc3, 0x04, 0xc3, 0xe1, 0xc4, 0x8d, 0x8d, 0x19, 0xe1, 0xe1, 0xe1, 0x8d, 0xc3, 0x03, 0x7d, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x02, 0xdf, 0x8d, 0xe1, 0xe1, 0xc4, 0xc4, 0x8d, 0x8d, 0xc4, 0xf8, 0xc2, 0xdf, 0x07, 0xcd, 0xdc, 0xfd, 0xf4, 0xdb, 0xf4, 0xf4, 0xd7, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xf4, 0xd7, 0xf4, 0xd9, 0xdb, 0xdc, 0xde, 0xd4, 0xed, 0xc5, 0xc3, 0x04, 0x8d, 0xc4, 0xc4, 0x8d, 0x8d, 0x8d, 0xc4, 0xe1, 0xe1, 0xe1, 0xe1, 0x8d, 0xc3, 0x03, 0x01, 0x7d, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x00, 0x86, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x86, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7c, 0x7d, 0x02, 0xe0, 0xc4, 0xe1, 0xe1, 0xe1, 0xc4, 0x8d, 0x8d, 0xc4, 0xc4, 0x8d, 0xc3, 0x04, 0xe1, 0xeb, 0xd2, 0xf7, 0xfd, 0xd7, 0xf4, 0xd8, 0xd7, 0xd7, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xdb, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xdc, 0xde, 0xf4, 0xce, 0xe9, 0xc4, 0xc2, 0xc3, 0x8d, 0xe1, 0xc4, 0xc4, 0x8d, 0xc4, 0xe1, 0xc4, 0xc4, 0xe1, 0xe1, 0xe1, 0xc4, 0x8d, 0xe0, 0xc3, 0xdf, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x7c, 0x01, 0x02, 0x04, 0xf8, 0xc4, 0xe1, 0xe1, 0x8d, 0xc4, 0xc4, 0xc4, 0xc4, 0x8d, 0xe1, 0x8d, 0xe0, 0x89, 0xe0, 0x07, 0xef, 0xd5, 0xf7, 0xdb, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xfa, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xfa, 0xf4, 0xf4, 0xf3, 0xf4, 0xd9, 0xf3, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xdc, 0xde, 0xf7, 0xd8, 0xce, 0x9d, 0xe2, 0x03, 0xdf, 0xe0, 0xc4, 0xc4, 0x8d, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xe1, 0xe1, 0xe2, 0xe2, 0xe1, 0xe2, 0xe1, 0xe1, 0xe1, 0x8d, 0xc3, 0x04, 0x02, 0x01, 0x01, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x02, 0x03, 0xdf, 0xe0, 0xf8, 0xc4, 0xe1, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0x8d, 0xc4, 0xc4, 0x8d, 0xe1, 0x8d, 0xc4, 0x8d, 0x04, 0x03, 0xc4, 0xc7, 0xf0, 0xd4, 0xf7, 0xf7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf5, 0xf4, 0xf5, 0xdc, 0xf6, 0xf6, 0xf6, 0xfd, 0xf5, 0xf4, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xf4, 0xf6, 0xf6, 0xf6, 0xd4, 0xcc, 0xc9, 0x05, 0x04, 0xc3, 0xe0, 0xc4, 0xc4, 0x8d, 0xe1, 0xc4, 0xc4, 0xc4, 0xc4, 0xe1, 0xe1, 0xc4, 0xc4, 0xc4, 0xc4, 0xe1, 0xe2, 0xe2, 0x05, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xc4, 0xe1, 0xe1, 0xe2, 0xe1, 0xc4, 0xc4, 0xe1, 0xc4, 0xe1, 0xe1, 0xe1, 0xc4, 0xe1, 0xe1, 0xc4, 0xc4, 0xe1, 0xc4, 0xc4, 0x8d, 0xe0, 0x04, 0x04, 0xc4, 0xf9, 0xef, 0xbb, 0xdc, 0xdd, 0xdb, 0xd9, 0xd7, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xdc, 0xf5, 0xf6, 0xde, 0xf5, 0xbb, 0xd2, 0xd2, 0xf2, 0xf5, 0xfd, 0xf7, 0xf6, 0xf5, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd6, 0xf4, 0xd9, 0xf6, 0xdc, 0xf7, 0xf5, 0xd3, 0xed, 0xc7, 0xe2, 0xe0, 0x8d, 0xf8, 0xe1, 0xc4, 0xe1, 0xe1, 0xc4, 0xc4, 0xe1, 0xe1, 0xe1, 0xe2, 0xe1, 0xc4, 0xc4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xc4, 0xc4, 0xc4, 0xe1, 0xe1, 0xc4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0x8d, 0xe0, 0xe0, 0xc5, 0xec, 0xce, 0xd7, 0xf7, 0xdd, 0xf4, 0xd9, 0xd8, 0xf4, 0xd8, 0xd9, 0xf4, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf6, 0xf7, 0xd6, 0xed, 0xe5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x89, 0x06, 0xeb, 0xd1, 0xde, 0xde, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xdb, 0xde, 0xf6, 0xd9, 0xcf, 0xc8, 0x05, 0xe1, 0xe2, 0xe1, 0xe1, 0xc4, 0xe1, 0xc4, 0xe1, 0xe1, 0xe1, 0xc4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe1, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xc4, 0xe1, 0xc4, 0xc4, 0xe1, 0xe1, 0xc4, 0xe1, 0xe1, 0xe1, 0xe1, 0xc4, 0xe1, 0xe2, 0x92, 0xeb, 0xd4, 0xf5, 0xf6, 0xdc, 0xf4, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd7, 0xf7, 0xd4, 0xc9, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x92, 0xce, 0xf6, 0xdc, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf5, 0xd9, 0xdc, 0xf5, 0xe9, 0x06, 0xc5, 0xe5, 0xe4, 0x92, 0x92, 0xe3, 0x05, 0x05, 0xe1, 0xe1, 0xc4, 0xe1, 0xe1, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xc4, 0xc4, 0xc4, 0xe1, 0xc4, 0xc4, 0xe1, 0xe1, 0xe1, 0xe2, 0x05, 0x92, 0x92, 0x06, 0xe4, 0xe5, 0xe7, 0xe8, 0x06, 0xcc, 0xf6, 0xd7, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf7, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x88, 0x88, 0x7a, 0x88, 0x88, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xe6, 0xd8, 0xf6, 0xd8, 0xd9, 0xdb, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xd9, 0xd7, 0xd9, 0xd8, 0xf4, 0xdc, 0xeb, 0xe2, 0xe6, 0xe6, 0xc5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe7, 0xe6, 0xe5, 0xc5, 0xe5, 0xe7, 0xe3, 0xe1, 0xc4, 0xc4, 0xc4, 0xe1, 0xc4, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe1, 0x92, 0xe6, 0xc5, 0xc5, 0xe6, 0xe5, 0xe5, 0xe6, 0xe7, 0xe6, 0xe6, 0xc5, 0xe5, 0xe6, 0xe6, 0x05, 0xf0, 0xf6, 0xd7, 0xd9, 0xd7, 0xf3, 0xd9, 0xf3, 0xd9, 0xf3, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xdc, 0xd7, 0xc6, 0x00, 0x00, 0x7a, 0x00, 0x88, 0x7c, 0x00, 0x88, 0x7a, 0x7a, 0x7a, 0x7a, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x03, 0xce, 0xde, 0xd9, 0xdb, 0xd7, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xde, 0xcd, 0x06, 0xe4, 0xe6, 0xe4, 0xc5, 0xc5, 0xc5, 0xe5, 0xc5, 0xc5, 0xe5, 0xe5, 0xe7, 0xe6, 0x05, 0x04, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0xc3, 0xe5, 0xe7, 0xc5, 0xc5, 0xe5, 0xc5, 0xe5, 0xe4, 0xc5, 0xe5, 0xe6, 0xc5, 0xe7, 0xc5, 0xe5, 0xe4, 0xd2, 0xf5, 0xd9, 0xf3, 0xd9, 0xf3, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xf7, 0xe5, 0x00, 0x88, 0x00, 0x00, 0x88, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x7c, 0x00, 0x00, 0x01, 0xcf, 0xf7, 0xd6, 0xdb, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf5, 0xd6, 0xdc, 0xbb, 0xe7, 0x92, 0xe6, 0x06, 0xe6, 0xc5, 0xc5, 0xe5, 0xc5, 0xe6, 0xe5, 0xc5, 0xe5, 0xe6, 0xe2, 0x01, 0x01, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x92, 0xe6, 0xc5, 0xc5, 0xc5, 0xc5, 0xe5, 0xe5, 0xc5, 0xe5, 0xc5, 0xc5, 0xe5, 0xe6, 0x92, 0xc6, 0xd7, 0xdb, 0xd7, 0xd8, 0xd9, 0xd9, 0xd9, 0xf3, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xf6, 0xf9, 0x00, 0x7a, 0x7c, 0x88, 0x7c, 0x7c, 0x00, 0x00, 0x7d, 0x92, 0xc7, 0xe9, 0xe9, 0xe5, 0x7f, 0x00, 0x00, 0x86, 0x7c, 0x81, 0x7c, 0x00, 0x7d, 0xd0, 0xf7, 0xd7, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd7, 0xdb, 0xf7, 0xeb, 0x06, 0xc5, 0xc5, 0xc5, 0xc5, 0xe5, 0xe5, 0xc5, 0xe5, 0xc5, 0xe5, 0xe5, 0xe6, 0x92, 0x03, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0xe0, 0xe4, 0xc5, 0xe4, 0xe6, 0xe4, 0xc5, 0xc5, 0xe5, 0xc5, 0xc5, 0xe5, 0xe6, 0xc5, 0xc5, 0x05, 0xee, 0xdc, 0xdc, 0xd6, 0xd9, 0xd9, 0xd8, 0xf3, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xde, 0xef, 0x00, 0x00, 0x7c, 0x88, 0x88, 0x88, 0x00, 0x00, 0xeb, 0xd2, 0xdc, 0xde, 0xde, 0xde, 0xf6, 0xd5, 0xed, 0x01, 0x00, 0x7e, 0x88, 0x7c, 0x7a, 0x00, 0xe3, 0xf4, 0xf6, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xbf, 0xf6, 0xd1, 0xe3, 0xe4, 0x94, 0xc5, 0xc5, 0xc5, 0xe5, 0xc5, 0xe5, 0xc5, 0xc5, 0xe6, 0xe5, 0xe5, 0xdf, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0xc4, 0xe7, 0xe4, 0xc5, 0xe5, 0xc5, 0xe5, 0xc5, 0xc5, 0xe5, 0xc5, 0xc5, 0xe5, 0xe5, 0xc5, 0x92, 0xd2, 0xf4, 0xf4, 0xd8, 0xd9, 0xd9, 0xf3, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdd, 0xd1, 0x7d, 0x00, 0x88, 0x88, 0x88, 0x88, 0x00, 0xc4, 0xd3, 0xf7, 0xdc, 0xd9, 0xd9, 0xf5, 0xd8, 0xff, 0xf5, 0xf7, 0xd6, 0xf9, 0x00, 0x7a, 0x09, 0x7c, 0x88, 0x00, 0xa3, 0xf6, 0xf4, 0xd9, 0xfa, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xdb, 0xbf, 0xc9, 0xe3, 0x94, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xe5, 0xc5, 0xe5, 0xe5, 0xe2, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x06, 0xe5, 0xe4, 0xc5, 0xe5, 0xc5, 0xe5, 0xc5, 0xc5, 0xe5, 0xc5, 0xc5, 0xc5, 0xe6, 0x92, 0xc8, 0xde, 0xd7, 0xd9, 0xd9, 0xd7, 0xf3, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xf6, 0xe4, 0x00, 0x88, 0x7c, 0x88, 0x88, 0x00, 0xe1, 0xf2, 0xf7, 0xd8, 0xf5, 0xd8, 0xd9, 0xd9, 0xff, 0xfa, 0xfa, 0xf4, 0xfc, 0xf7, 0xe8, 0x00, 0x08, 0x09, 0x00, 0x00, 0x7a, 0xd6, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xdb, 0xdd, 0xf1, 0xe3, 0xe7, 0xe4, 0x94, 0xc5, 0xc5, 0xc5, 0xe5, 0xe5, 0xc5, 0xe5, 0xc5, 0xe5, 0xe4, 0x04, 0x02, 0x02, 0x02, 0x03, 0xdf, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x8d, 0xe5, 0xe4, 0xc5, 0xc5, 0xe5, 0xc5, 0xe5, 0xe5, 0xc5, 0xc5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe1, 0xf1, 0xdd, 0xd9, 0xd9, 0xd9, 0xf3, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdd, 0xcd, 0x00, 0x00, 0x7c, 0x00, 0x88, 0x7a, 0x00, 0xd3, 0xf7, 0xdb, 0xd7, 0xdb, 0xd9, 0xdc, 0xd8, 0xf4, 0xdc, 0xf5, 0xf5, 0xf4, 0xdc, 0xf6, 0xe4, 0x00, 0x88, 0x88, 0x7a, 0x00, 0xed, 0xfd, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd7, 0xd9, 0xd7, 0xf4, 0xf7, 0xc6, 0x06, 0xe5, 0xc5, 0xc5, 0xe4, 0xc5, 0xc5, 0xe5, 0xc5, 0xc5, 0xe6, 0xe5, 0xe6, 0xe1, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x92, 0xc5, 0xe4, 0xe5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xe5, 0xe5, 0xe5, 0xc5, 0x94, 0xe4, 0xc6, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xdb, 0xf4, 0x06, 0x89, 0x7c, 0x7c, 0x88, 0x7d, 0x00, 0xeb, 0xf7, 0xd8, 0xf5, 0xd8, 0xf4, 0xf4, 0xdc, 0xdd, 0xde, 0xdd, 0xde, 0xdd, 0xde, 0xdd, 0xde, 0xd1, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x05, 0xf6, 0xf4, 0xf5, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd6, 0xdb, 0xd9, 0xf4, 0xf6, 0xd1, 0xc4, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xe4, 0xe4, 0xc5, 0xc5, 0xe5, 0xe5, 0xe5, 0xdf, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x8d, 0xe5, 0xe4, 0x06, 0xc5, 0xc5, 0xe5, 0xc5, 0xc5, 0xe5, 0xc5, 0xe5, 0xe4, 0xe6, 0xe4, 0x06, 0xf0, 0xdd, 0xd9, 0xd6, 0xdc, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd7, 0xdd, 0xce, 0x04, 0xe0, 0xe0, 0x01, 0x04, 0x01, 0xe0, 0xd4, 0xdc, 0xf5, 0xf4, 0xdb, 0xf6, 0xf7, 0xd6, 0xcc, 0xeb, 0xc7, 0x97, 0x9d, 0xef, 0xd1, 0xf7, 0xf7, 0x93, 0x86, 0x7a, 0x7a, 0x00, 0x7d, 0xbb, 0xdc, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xf6, 0x9d, 0x06, 0xc5, 0xc5, 0xc5, 0xe4, 0xe4, 0xc5, 0xe7, 0xe6, 0xe5, 0xc5, 0xe4, 0xe6, 0x92, 0x01, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0xe4, 0xe5, 0x06, 0xe4, 0xe4, 0xe4, 0xc5, 0xe4, 0x7b, 0xc5, 0xe5, 0xe5, 0xc5, 0xe6, 0xe4, 0xc5, 0xf6, 0xd7, 0xdb, 0xf3, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd8, 0xf4, 0xf7, 0x9d, 0xdf, 0x8d, 0x8d, 0xc4, 0x83, 0xdf, 0xc8, 0xf6, 0xdc, 0xf4, 0xbf, 0xf6, 0xd0, 0x07, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc9, 0xc8, 0x7a, 0x88, 0x00, 0x7c, 0x00, 0xce, 0xfd, 0xd9, 0xf5, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xf4, 0xf6, 0xd0, 0x92, 0xe5, 0xc5, 0xe4, 0xc5, 0xe5, 0xc5, 0x05, 0x83, 0xc3, 0xe0, 0xe2, 0xe7, 0xe5, 0xe0, 0x01, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe1, 0xe5, 0xe4, 0x06, 0xe4, 0xe5, 0xe5, 0xe5, 0xc5, 0xc5, 0xe5, 0xc5, 0xe5, 0x94, 0x94, 0xe1, 0xcd, 0xdd, 0xd9, 0xd6, 0xdb, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xdb, 0xde, 0xe4, 0x04, 0x05, 0xe0, 0x8d, 0x8d, 0x7d, 0xec, 0xde, 0xd9, 0xde, 0xf7, 0xea, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x0a, 0x08, 0x00, 0x00, 0x09, 0x88, 0x7c, 0x88, 0x00, 0xee, 0xf7, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd7, 0xd8, 0xde, 0xea, 0xe4, 0xe4, 0xc5, 0x94, 0xe4, 0xc3, 0x88, 0x88, 0x88, 0x7c, 0x88, 0x8d, 0xe7, 0xe4, 0x03, 0xc2, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x04, 0xe4, 0xe4, 0x06, 0x04, 0x01, 0xdf, 0xf8, 0xe2, 0x06, 0xc5, 0xe7, 0xe5, 0xc5, 0xc5, 0xe4, 0xf9, 0xd6, 0xf5, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xdb, 0xd9, 0xc3, 0xc4, 0x8d, 0x8d, 0x8d, 0x8d, 0x01, 0xce, 0xf6, 0xf6, 0xd5, 0xc4, 0x00, 0x00, 0x7a, 0x7a, 0x08, 0x0f, 0x1a, 0x20, 0x2a, 0x2a, 0x2e, 0x20, 0x1b, 0x11, 0x09, 0x7a, 0x7d, 0x88, 0x00, 0xec, 0xf7, 0xd9, 0xf4, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xf3, 0xd8, 0xd9, 0xd9, 0xd9, 0xbf, 0xd6, 0xe4, 0xe4, 0xc5, 0xe5, 0xe3, 0x01, 0x00, 0x00, 0x88, 0x7c, 0x7a, 0x88, 0x8d, 0x07, 0xe3, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x92, 0x7b, 0xc5, 0x01, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0xdf, 0xe1, 0xc5, 0xe5, 0xc5, 0xc5, 0xe3, 0xf1, 0xf6, 0xf3, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xdb, 0xd6, 0xc2, 0xe0, 0xc4, 0xc4, 0x8d, 0x8d, 0xc2, 0xd3, 0xde, 0xf4, 0xe7, 0x00, 0x88, 0x7e, 0x08, 0x09, 0x1c, 0x25, 0x32, 0x28, 0x2f, 0x27, 0x28, 0x28, 0x29, 0x24, 0x18, 0x09, 0x88, 0x81, 0x00, 0xed, 0x78, 0xfa, 0xda, 0xbd, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd8, 0xd9, 0xdc, 0xef, 0xe3, 0xe4, 0xe5, 0x92, 0x7c, 0x00, 0x88, 0x88, 0x00, 0x7a, 0x7a, 0x00, 0xf8, 0x07, 0x8d, 0x01, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xe2, 0xc5, 0xc5, 0x7d, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x01, 0xe3, 0xe7, 0xc5, 0xe3, 0xc9, 0xfd, 0xd7, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd7, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xdb, 0xd7, 0xc2, 0xc4, 0x8d, 0xc4, 0x83, 0xe0, 0xf8, 0xd6, 0xf7, 0xea, 0x00, 0x7c, 0x88, 0x00, 0x0a, 0x22, 0x32, 0x28, 0x29, 0x28, 0x2b, 0x28, 0x2b, 0x25, 0x29, 0x29, 0x2e, 0x1b, 0x09, 0x0d, 0x7a, 0xf1, 0xfc, 0xfa, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xdc, 0xd9, 0xc6, 0xe4, 0xc5, 0xe4, 0x03, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe6, 0xc3, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xc3, 0xe6, 0xe4, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x7a, 0x7d, 0x92, 0xe6, 0x06, 0xe4, 0xbb, 0xff, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xdc, 0xdc, 0xc3, 0xe0, 0xc4, 0xe0, 0xe1, 0xc3, 0xe6, 0xde, 0xd7, 0x88, 0x00, 0x7a, 0x7a, 0x7a, 0x1e, 0x2e, 0x28, 0x28, 0x28, 0x29, 0x27, 0x2c, 0x27, 0x2b, 0x28, 0x28, 0x29, 0x2a, 0x16, 0x08, 0x8d, 0xda, 0xd9, 0xf4, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf3, 0xd9, 0xd9, 0xd7, 0xf6, 0xf1, 0xe3, 0xc5, 0xe6, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x88, 0x00, 0xc3, 0xc5, 0xdf, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0xe5, 0x06, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x88, 0x00, 0x03, 0xc5, 0xc5, 0x05, 0xf0, 0xdd, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xdb, 0xde, 0xc5, 0xc3, 0x8d, 0xe0, 0xc4, 0x04, 0xeb, 0xf7, 0xee, 0x00, 0x86, 0x7d, 0x00, 0x0f, 0x2a, 0x28, 0x33, 0x28, 0x28, 0x28, 0x2b, 0x27, 0x2c, 0x2c, 0x2c, 0x28, 0x28, 0x2b, 0x20, 0x00, 0xef, 0x85, 0xd9, 0xf5, 0xf4, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf3, 0xd9, 0xd9, 0xd8, 0xf4, 0xf6, 0xea, 0xe3, 0xe4, 0xe6, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x02, 0xe4, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0xe5, 0xc4, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xe0, 0x07, 0x06, 0xc8, 0xf3, 0xf4, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf7, 0xee, 0x03, 0x8d, 0xc4, 0xc3, 0xc4, 0xd0, 0xf7, 0xc5, 0x00, 0x7a, 0x7e, 0x7a, 0x1e, 0x2f, 0x2c, 0x2c, 0x2c, 0x28, 0x2b, 0x2b, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x1c, 0xea, 0xff, 0xbd, 0xda, 0xd9, 0xfa, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf3, 0xd9, 0xd9, 0xdb, 0xd5, 0xc5, 0xe4, 0x06, 0xe2, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x01, 0x92, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0xc5, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7d, 0xe4, 0xe5, 0xe3, 0xf2, 0xdb, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xd5, 0xc5, 0x7d, 0x03, 0x89, 0xec, 0xde, 0xbb, 0x03, 0x00, 0x81, 0x7a, 0x0a, 0x20, 0x33, 0x31, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x27, 0x2c, 0x2b, 0x27, 0x25, 0x35, 0x75, 0xbf, 0xda, 0xd8, 0xd9, 0xfa, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf3, 0xd9, 0xd9, 0xd9, 0xdc, 0xef, 0x05, 0xe4, 0xc5, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7d, 0x05, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x06, 0xdf, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe5, 0x05, 0xca, 0xf7, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf6, 0xd6, 0xca, 0xeb, 0xce, 0xf7, 0xf6, 0xce, 0x00, 0x08, 0x81, 0x81, 0x0c, 0x2a, 0x31, 0x31, 0x31, 0x2f, 0x2c, 0x2c, 0x33, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x28, 0x1c, 0x72, 0x78, 0xd8, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf3, 0xd8, 0xf4, 0xdb, 0xc8, 0x06, 0x92, 0x06, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0xe1, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0xe3, 0x7d, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xe4, 0xe4, 0xc7, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd6, 0xdb, 0xde, 0xde, 0xbf, 0xf4, 0xde, 0xea, 0x00, 0x08, 0x81, 0x81, 0x0c, 0x32, 0x31, 0x3a, 0x2b, 0x28, 0x31, 0x33, 0x2d, 0x33, 0x2f, 0x2b, 0x2f, 0x28, 0x1f, 0x6f, 0x79, 0xfa, 0xd9, 0xd9, 0xf3, 0xfa, 0xda, 0xbd, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd7, 0xd9, 0xdb, 0xd2, 0x05, 0x92, 0xe4, 0xe3, 0x88, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0xe2, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe7, 0xe4, 0xc5, 0xd0, 0xdc, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xdb, 0xd8, 0xf7, 0xe3, 0x00, 0x7a, 0x88, 0x08, 0x0e, 0x2a, 0x3a, 0x31, 0x31, 0x33, 0x2d, 0x30, 0x30, 0x2c, 0x33, 0x25, 0x36, 0x1f, 0x6b, 0x79, 0xfb, 0xd8, 0xdb, 0xd7, 0xd9, 0xd9, 0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdd, 0xee, 0x05, 0x06, 0x92, 0xe3, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0xe0, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc5, 0xc5, 0x06, 0xed, 0xde, 0xd7, 0xd9, 0xd8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdd, 0x01, 0x00, 0x88, 0x08, 0x0a, 0x0c, 0x2a, 0x2f, 0x31, 0x3a, 0x31, 0x2c, 0x33, 0x31, 0x31, 0x2b, 0x28, 0x1c, 0x70, 0x77, 0xdb, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd8, 0xdc, 0xc8, 0x92, 0x93, 0xe3, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x88, 0x00, 0x7c, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0xc3, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xe4, 0xe5, 0xe4, 0xf9, 0xdc, 0xdb, 0xd7, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xf4, 0xd8, 0xf6, 0xd3, 0x00, 0x86, 0x88, 0x7c, 0x09, 0x0c, 0x38, 0x24, 0x2f, 0x2b, 0x33, 0x33, 0x33, 0x2b, 0x23, 0x1f, 0x46, 0x72, 0x78, 0xff, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xd7, 0xf6, 0xd1, 0x06, 0x93, 0x06, 0xe4, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x01, 0xdf, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0xdf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xe5, 0xe5, 0xc5, 0xe4, 0xd2, 0xdc, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf7, 0xed, 0x00, 0x86, 0x88, 0x88, 0x08, 0x0d, 0x73, 0x71, 0x4e, 0x39, 0x35, 0x37, 0x32, 0x3f, 0x70, 0x72, 0x77, 0x78, 0xd8, 0xda, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xdb, 0xde, 0xef, 0xe3, 0x06, 0x92, 0x93, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x7c, 0x02, 0x03, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc5, 0xe4, 0xe5, 0xe3, 0xf0, 0xdc, 0xf4, 0xf4, 0xd8, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xf4, 0xdd, 0xf9, 0x00, 0x7a, 0x86, 0x88, 0x00, 0x10, 0x76, 0x79, 0x76, 0x74, 0x74, 0x74, 0x75, 0x77, 0x79, 0x79, 0xdc, 0xd7, 0xbe, 0xbd, 0xda, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xdb, 0xde, 0xc8, 0x92, 0x93, 0x92, 0x92, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x7d, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0xdf, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xe4, 0xe6, 0xe5, 0x06, 0xc9, 0xd9, 0xdb, 0xd6, 0xdb, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xd5, 0x04, 0x00, 0x86, 0x7e, 0x00, 0x00, 0xe2, 0xfb, 0xf4, 0x77, 0xfb, 0xff, 0xf4, 0xbf, 0xf4, 0xd9, 0xd9, 0xfa, 0xd9, 0xd9, 0xda, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xdb, 0xd7, 0xe4, 0x92, 0x06, 0x92, 0x93, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02, 0xdf, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xe4, 0xe5, 0xe5, 0xe5, 0xe7, 0xbb, 0xdb, 0xd7, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xde, 0xcd, 0x00, 0x81, 0x7c, 0x88, 0x88, 0x00, 0xe9, 0xf7, 0xd8, 0xd9, 0xd9, 0xd9, 0xbd, 0xbd, 0xbd, 0xbd, 0xd9, 0xd9, 0xf3, 0xf3, 0xf3, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xfd, 0xd0, 0xe1, 0xe4, 0x92, 0xe3, 0x92, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x04, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x06, 0xc5, 0xe5, 0xe5, 0x06, 0xcc, 0xdc, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf7, 0xe4, 0x00, 0x88, 0x00, 0x88, 0x88, 0x00, 0xce, 0xde, 0xd9, 0xf3, 0xd9, 0xd9, 0xbd, 0xbd, 0xbd, 0xbd, 0xda, 0xd9, 0xd9, 0xfa, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf6, 0xef, 0xe1, 0xe4, 0x92, 0x92, 0x92, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x06, 0xe5, 0xc5, 0xe5, 0xc5, 0xc9, 0xdd, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd8, 0xd9, 0xd8, 0xdc, 0xd3, 0x01, 0x7a, 0x81, 0x7c, 0x88, 0x00, 0xc2, 0xd5, 0xdb, 0xf3, 0xd9, 0xf3, 0xf3, 0xf3, 0xfa, 0xd9, 0xd9, 0xda, 0xd8, 0xda, 0xda, 0xda, 0xd9, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd8, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xf4, 0xdb, 0xa3, 0x8f, 0x93, 0x92, 0x8f, 0x92, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x92, 0xe5, 0xc5, 0xc5, 0xe5, 0x06, 0xbf, 0xd8, 0xf4, 0xd7, 0xd9, 0xda, 0xd8, 0xfa, 0xd7, 0xf4, 0xda, 0xd8, 0xda, 0xd7, 0xda, 0xd8, 0xf3, 0xd9, 0xd9, 0xde, 0xc8, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0xc6, 0xf7, 0xd9, 0xd9, 0xf3, 0xf3, 0xd9, 0xfa, 0xd9, 0xfa, 0xd9, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xf3, 0xd9, 0xf3, 0xd9, 0xf3, 0xd9, 0xd8, 0xd9, 0xd8, 0xdc, 0xd7, 0xf4, 0xf5, 0xf6, 0xdc, 0xf6, 0xf5, 0xd7, 0xdb, 0xd6, 0xc8, 0x8f, 0x93, 0x8f, 0x92, 0x92, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xc3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe5, 0xc5, 0xc5, 0x34, 0x21, 0xcf, 0xda, 0xda, 0xf5, 0xf5, 0xdb, 0xdd, 0x78, 0xf7, 0xf6, 0xc0, 0xda, 0xda, 0xdb, 0xd7, 0xf3, 0xd9, 0xd7, 0xfd, 0xd0, 0x7c, 0x7a, 0x7a, 0x7a, 0x88, 0x7a, 0x00, 0xce, 0xf6, 0xd7, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xf3, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xf7, 0xd6, 0xf1, 0xce, 0xd0, 0xd7, 0xf7, 0xf7, 0xd2, 0xc5, 0x06, 0x06, 0xe3, 0x05, 0x92, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x06, 0xe5, 0xc5, 0xe5, 0x34, 0xe4, 0xa3, 0xf7, 0xf7, 0xfc, 0xd6, 0xd0, 0xf0, 0xec, 0xec, 0xef, 0xd3, 0xf7, 0xd9, 0xf3, 0xfa, 0xfb, 0xf4, 0xf3, 0xfd, 0x92, 0x00, 0x7c, 0x7a, 0x7a, 0x7a, 0x00, 0xe1, 0xde, 0xf4, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xd8, 0xeb, 0xc2, 0x00, 0x00, 0x00, 0x02, 0xe8, 0xce, 0xf1, 0x07, 0xe5, 0x92, 0x21, 0xe3, 0x21, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xc3, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xe4, 0xc5, 0xe5, 0x7b, 0x94, 0x94, 0xe8, 0xee, 0xe9, 0xc7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xc9, 0xf5, 0xfb, 0x76, 0xfa, 0xd7, 0xf7, 0xeb, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0x7a, 0x00, 0xcd, 0xde, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf7, 0xf9, 0x00, 0x00, 0x81, 0x7a, 0x00, 0x00, 0x00, 0x86, 0xc4, 0xe1, 0xf8, 0x92, 0x21, 0x05, 0xe3, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x06, 0xe5, 0xc5, 0x94, 0x94, 0x92, 0xc3, 0x0a, 0x0d, 0x05, 0x02, 0x00, 0x7a, 0x86, 0x86, 0x00, 0x00, 0x00, 0x9d, 0x78, 0xfa, 0xfb, 0xde, 0xf2, 0x7d, 0x00, 0x7c, 0x7a, 0x7a, 0x00, 0x00, 0x07, 0xdc, 0xdc, 0xd8, 0xf4, 0xd8, 0xf3, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xf4, 0xd6, 0xdb, 0xf4, 0xd8, 0xf6, 0xbf, 0xf4, 0x85, 0xd1, 0x00, 0x00, 0x88, 0x88, 0x7c, 0x7a, 0x7a, 0x7c, 0x00, 0x00, 0x00, 0x7a, 0x08, 0x02, 0xe3, 0x05, 0xc4, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0xc3, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x01, 0xc5, 0xe4, 0xc5, 0xc5, 0x83, 0x89, 0x09, 0x00, 0x88, 0x00, 0x80, 0x81, 0x00, 0x81, 0x81, 0x7e, 0x7c, 0x88, 0x00, 0xee, 0xf7, 0xbf, 0xd2, 0xe7, 0x88, 0x7d, 0x7a, 0x88, 0x88, 0x00, 0x7c, 0xd9, 0xdc, 0xd9, 0xd7, 0xdb, 0xd9, 0xf4, 0xf3, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd7, 0xd8, 0xf4, 0xd6, 0xf7, 0xcd, 0xe7, 0xe1, 0x07, 0xe9, 0x7a, 0x7c, 0x7e, 0x09, 0x00, 0x7c, 0x04, 0x04, 0x0e, 0x14, 0x0f, 0x0a, 0x08, 0x00, 0x02, 0x8f, 0x84, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x8d, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x02, 0xe6, 0xe4, 0xc5, 0xc4, 0x7c, 0x09, 0x0f, 0x0c, 0x00, 0x7e, 0x80, 0x81, 0x7a, 0x7a, 0x7c, 0x09, 0x7c, 0x7d, 0x00, 0x92, 0xe9, 0xe6, 0x92, 0x8d, 0x04, 0x7d, 0x7c, 0x88, 0x88, 0x00, 0xf0, 0xf7, 0xd7, 0xf6, 0xd8, 0xd9, 0xd9, 0xf3, 0xf4, 0xf3, 0xd8, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd7, 0xdd, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x0a, 0x7a, 0x0a, 0x7a, 0x0d, 0x10, 0x11, 0x3b, 0x4a, 0x3f, 0x2e, 0x1e, 0x09, 0x00, 0x82, 0x8f, 0x01, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xe1, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x7d, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0xc3, 0xc5, 0xe5, 0xe0, 0x7c, 0x13, 0x2e, 0x4a, 0x39, 0x12, 0x00, 0x89, 0x81, 0x08, 0x0a, 0x11, 0x14, 0x0f, 0x09, 0x09, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x83, 0x7f, 0x88, 0x7a, 0x00, 0xcd, 0xf7, 0xd8, 0xdb, 0xd6, 0xdb, 0xd9, 0xd9, 0xf4, 0xf3, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd6, 0x03, 0x00, 0x7c, 0x88, 0x7a, 0x09, 0x09, 0x7d, 0x0a, 0x7a, 0x09, 0x0a, 0x10, 0x13, 0x51, 0x51, 0x45, 0x3d, 0x4e, 0x16, 0x08, 0x7a, 0x05, 0xc3, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x05, 0x04, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xc5, 0xe3, 0x88, 0x04, 0x3b, 0x49, 0x3c, 0x51, 0x3b, 0x09, 0x7c, 0x00, 0x0b, 0x46, 0x4e, 0x4e, 0x57, 0x1b, 0x0b, 0x09, 0x00, 0x7e, 0x00, 0x7f, 0x19, 0xc3, 0x7d, 0x02, 0xf0, 0xf7, 0xd9, 0xd9, 0xd8, 0xbf, 0xf4, 0xd9, 0xf4, 0xf3, 0xd9, 0xf3, 0xd9, 0xd7, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xda, 0xbf, 0xce, 0x00, 0x88, 0x7c, 0x7c, 0x0a, 0x0b, 0x38, 0x46, 0x46, 0x22, 0x0f, 0x0a, 0x0d, 0x16, 0x56, 0x4d, 0x3c, 0x4f, 0x3d, 0x57, 0x0c, 0x00, 0x04, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc4, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x8d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x7a, 0x05, 0xe4, 0x10, 0x0a, 0x26, 0x46, 0x43, 0x47, 0x42, 0x4e, 0x10, 0x08, 0x09, 0x38, 0x59, 0x45, 0x49, 0x3e, 0x4e, 0x12, 0x08, 0x7a, 0x00, 0x7e, 0xe1, 0x7b, 0x06, 0xc6, 0xd3, 0xde, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd7, 0xc1, 0xf1, 0x86, 0x7d, 0x0a, 0x0c, 0x0c, 0x20, 0x53, 0x51, 0x42, 0x51, 0x49, 0x18, 0x0a, 0x1b, 0x56, 0x4f, 0x4d, 0x4d, 0x4f, 0x53, 0x1a, 0x00, 0x7d, 0x05, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe2, 0xdf, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x7d, 0x05, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x08, 0x00, 0x02, 0x93, 0xe2, 0x0a, 0x11, 0x46, 0x3e, 0x43, 0x48, 0x4d, 0x4e, 0x14, 0x00, 0x1b, 0x57, 0x41, 0x42, 0x44, 0x42, 0x53, 0x24, 0x08, 0x7a, 0x7e, 0x7a, 0x7d, 0xc6, 0xee, 0xd8, 0xdc, 0xd9, 0xda, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xfa, 0xf3, 0xf4, 0xd6, 0x8d, 0x7c, 0x0d, 0x09, 0x11, 0x56, 0x45, 0x4f, 0x3c, 0x4b, 0x3d, 0x3f, 0x0e, 0x1a, 0x56, 0x43, 0x52, 0x48, 0x4c, 0x51, 0x26, 0x00, 0x00, 0xe0, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xc4, 0x7d, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0xe0, 0x06, 0xc3, 0x08, 0x1b, 0x4e, 0x45, 0x41, 0x50, 0x42, 0x57, 0x17, 0x09, 0x3f, 0x49, 0x42, 0x42, 0x42, 0x42, 0x51, 0x39, 0x0a, 0x09, 0x7f, 0x7a, 0x00, 0xc9, 0xf7, 0xd9, 0xd8, 0xf4, 0xd6, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xfb, 0xfa, 0xfb, 0xd9, 0xee, 0x88, 0x0d, 0x0d, 0x17, 0x56, 0x4b, 0x44, 0x48, 0x48, 0x42, 0x49, 0x24, 0x12, 0x56, 0x4b, 0x52, 0x50, 0x52, 0x51, 0x26, 0x00, 0x00, 0x89, 0x05, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xe3, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xe2, 0xe2, 0x0d, 0x7a, 0x26, 0x4a, 0x41, 0x48, 0x4c, 0x4d, 0x57, 0x14, 0x1a, 0x56, 0x42, 0x45, 0x42, 0x4b, 0x4b, 0x42, 0x4a, 0x0c, 0x10, 0x94, 0x00, 0x7e, 0xbb, 0xbf, 0xd9, 0xda, 0xd7, 0xda, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xfa, 0xf6, 0xd6, 0x7b, 0x7d, 0x7d, 0xdf, 0x7c, 0x22, 0x59, 0x47, 0x48, 0x50, 0x48, 0x44, 0x3d, 0x39, 0x12, 0x3d, 0x51, 0x4b, 0x52, 0x4c, 0x59, 0x1a, 0x00, 0x7c, 0x00, 0x05, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe4, 0xc3, 0x01, 0x02, 0x02, 0x02, 0x02, 0x92, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x8d, 0x08, 0x08, 0x22, 0x46, 0x43, 0x4b, 0x4b, 0x51, 0x46, 0x0f, 0x1e, 0x49, 0x42, 0x43, 0x43, 0x47, 0x4b, 0x4f, 0x4a, 0x0e, 0x0d, 0xf9, 0x00, 0xc9, 0xf7, 0xbf, 0xd8, 0xda, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xbd, 0xbf, 0xc5, 0x00, 0x0d, 0x7d, 0x10, 0x7d, 0x1b, 0x59, 0x42, 0x48, 0x48, 0x40, 0x4b, 0x3d, 0x49, 0x0f, 0x16, 0x57, 0x53, 0x51, 0x53, 0x39, 0x0b, 0x7a, 0x86, 0x00, 0xe0, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0xe3, 0xc4, 0x02, 0x01, 0x01, 0x01, 0xe0, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x21, 0x03, 0x7a, 0x08, 0x13, 0x4e, 0x49, 0x49, 0x4a, 0x3b, 0x17, 0x00, 0x1b, 0x4a, 0x45, 0x4b, 0x4b, 0x4b, 0x42, 0x56, 0x2a, 0x0a, 0x7a, 0x06, 0xe0, 0x10, 0xee, 0xc0, 0xd8, 0xbd, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xc1, 0xcf, 0x86, 0x0d, 0x0a, 0x0e, 0x0b, 0x0b, 0x0f, 0x53, 0x51, 0x3c, 0x4c, 0x44, 0x42, 0x3e, 0x3b, 0x0b, 0x08, 0x1b, 0x38, 0x38, 0x2e, 0x0e, 0x08, 0x86, 0x81, 0x00, 0x01, 0x05, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xe3, 0xdf, 0x02, 0x02, 0x01, 0xe2, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x05, 0x1d, 0x7d, 0x7a, 0x7a, 0x09, 0x1b, 0x38, 0x35, 0x22, 0x11, 0x08, 0x09, 0x0c, 0x46, 0x4a, 0x4f, 0x42, 0x45, 0x51, 0x49, 0x11, 0x0c, 0x1a, 0x0a, 0x0a, 0x08, 0x09, 0xd1, 0xdc, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf7, 0xa3, 0x08, 0x0c, 0x1e, 0x2e, 0x2e, 0x29, 0x0e, 0x12, 0x4a, 0x51, 0x3d, 0x45, 0x3f, 0x46, 0x17, 0x08, 0x08, 0x00, 0x7a, 0x0a, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0x7a, 0x7a, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0xdf, 0xe4, 0x8d, 0x01, 0x02, 0x01, 0xe4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0xc4, 0x00, 0x80, 0x88, 0x7a, 0x08, 0x08, 0x08, 0x00, 0x7a, 0x08, 0x09, 0x00, 0x0e, 0x26, 0x3e, 0x57, 0x46, 0x2a, 0x0e, 0x15, 0x39, 0x57, 0x3e, 0x15, 0x0b, 0x7a, 0xe9, 0xf7, 0xbd, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xf7, 0xc8, 0x08, 0x16, 0x39, 0x37, 0x3d, 0x45, 0x37, 0x0b, 0x11, 0x35, 0x3e, 0x3e, 0x2e, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x00, 0x0a, 0x08, 0x88, 0x00, 0xc3, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xc5, 0xe3, 0x01, 0x02, 0x03, 0xe4, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x21, 0x04, 0x00, 0x80, 0x80, 0x7c, 0x7a, 0x00, 0x00, 0x00, 0x08, 0x09, 0x7a, 0x09, 0x00, 0x00, 0x11, 0x16, 0x11, 0x09, 0x13, 0x3e, 0x49, 0x40, 0x4b, 0x46, 0x11, 0x09, 0x1d, 0xfd, 0xda, 0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0x78, 0xc6, 0x08, 0x20, 0x37, 0x3a, 0x3c, 0x3a, 0x4f, 0x3f, 0x0a, 0x7c, 0x0c, 0x0c, 0x0a, 0x09, 0x13, 0x22, 0x2a, 0x26, 0x15, 0x7a, 0x7a, 0x81, 0x00, 0x88, 0x08, 0x00, 0x00, 0x01, 0x92, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x06, 0x06, 0x03, 0x01, 0x8d, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x7e, 0x92, 0x1d, 0x10, 0x00, 0x80, 0x86, 0x86, 0x88, 0x08, 0x0c, 0x22, 0x38, 0x3f, 0x3f, 0x3b, 0x1c, 0x15, 0x00, 0x08, 0x00, 0x0c, 0x46, 0x4f, 0x40, 0x52, 0x48, 0x56, 0x20, 0x08, 0x04, 0xd6, 0xf5, 0xd9, 0xd9, 0xda, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xf7, 0xc8, 0x00, 0x26, 0x3d, 0x3a, 0x3a, 0x3c, 0x3c, 0x54, 0x1e, 0x80, 0x7e, 0x0a, 0x1c, 0x3e, 0x5b, 0x59, 0x54, 0x54, 0x59, 0x3e, 0x11, 0x00, 0x7c, 0x00, 0x7a, 0x00, 0x00, 0x7c, 0xe3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0xf8, 0x01, 0xe2, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe4, 0x1d, 0x0a, 0x08, 0x7a, 0x88, 0x7a, 0x00, 0x1c, 0x53, 0x51, 0x4f, 0x4f, 0x4b, 0x4f, 0x5f, 0x51, 0x20, 0x0a, 0x7a, 0x14, 0x53, 0x48, 0x50, 0x48, 0x47, 0x55, 0x37, 0x7a, 0x82, 0xda, 0xff, 0xfa, 0xd7, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0x78, 0xec, 0x00, 0x22, 0x3d, 0x3a, 0x40, 0x3c, 0x41, 0x4f, 0x22, 0x00, 0x08, 0x20, 0x51, 0x51, 0x3a, 0x4d, 0x48, 0x55, 0x4d, 0x5b, 0x4e, 0x12, 0x00, 0x09, 0x00, 0x00, 0x7a, 0x00, 0x05, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x92, 0xe4, 0x84, 0x01, 0x06, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xe4, 0x19, 0x00, 0x88, 0x00, 0x08, 0x00, 0x1b, 0x56, 0x4f, 0x4f, 0x4d, 0x47, 0x4c, 0x4b, 0x43, 0x4d, 0x57, 0x1a, 0x08, 0x18, 0x49, 0x48, 0x50, 0x50, 0x47, 0x54, 0x32, 0x00, 0xe4, 0x85, 0xfb, 0xfa, 0xd9, 0xda, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xde, 0xf1, 0x0a, 0x1b, 0x3e, 0x3a, 0x3c, 0x41, 0x42, 0x4f, 0x1b, 0x08, 0x13, 0x56, 0x4c, 0x4c, 0x55, 0x50, 0x50, 0x48, 0x52, 0x52, 0x54, 0x53, 0x0e, 0x08, 0x7a, 0x00, 0x88, 0x00, 0xe0, 0xe3, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xe4, 0x92, 0x02, 0xc5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x06, 0x04, 0x00, 0x81, 0x7a, 0x00, 0x18, 0x5b, 0x4b, 0x4c, 0x52, 0x48, 0x52, 0x52, 0x48, 0x55, 0x54, 0x54, 0x4a, 0x0b, 0x12, 0x51, 0x44, 0x50, 0x48, 0x4b, 0x56, 0x20, 0x00, 0xed, 0xde, 0xf4, 0xfa, 0xf4, 0xda, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xbf, 0xd8, 0x1d, 0x0e, 0x3e, 0x3d, 0x42, 0x3a, 0x42, 0x49, 0x11, 0x00, 0x39, 0x54, 0x48, 0x52, 0x50, 0x50, 0x52, 0x50, 0x50, 0x50, 0x55, 0x59, 0x20, 0x00, 0x00, 0x88, 0x00, 0x00, 0x04, 0x92, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xc5, 0xe4, 0xc3, 0x07, 0x7d, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xe3, 0x06, 0x02, 0x86, 0x80, 0x00, 0x0e, 0x3e, 0x4f, 0x4c, 0x4c, 0x52, 0x52, 0x48, 0x52, 0x4c, 0x4c, 0x4c, 0x42, 0x64, 0x11, 0x0e, 0x3e, 0x42, 0x41, 0x42, 0x59, 0x3f, 0x0c, 0x7d, 0xd4, 0xbf, 0xfa, 0xdb, 0xd9, 0xda, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xda, 0xde, 0xef, 0x00, 0x1a, 0x53, 0x3e, 0x3e, 0x4a, 0x2e, 0x00, 0x0a, 0x53, 0x4b, 0x52, 0x4c, 0x50, 0x50, 0x48, 0x4c, 0x52, 0x52, 0x52, 0x54, 0x3f, 0x0c, 0x86, 0x00, 0x88, 0x00, 0x01, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc5, 0x06, 0xe3, 0xc5, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x21, 0x7c, 0x86, 0x81, 0x00, 0x20, 0x56, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x52, 0x4b, 0x4c, 0x4d, 0x4b, 0x4b, 0x5b, 0x1a, 0x08, 0x22, 0x46, 0x3f, 0x3e, 0x2e, 0x0b, 0x00, 0xec, 0x78, 0xd7, 0xd9, 0xd9, 0xd9, 0xda, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xbf, 0x85, 0xe0, 0x08, 0x16, 0x1c, 0x1e, 0x1a, 0x0e, 0x00, 0x11, 0x57, 0x4c, 0x4c, 0x4c, 0x4c, 0x50, 0x52, 0x4b, 0x4d, 0x52, 0x52, 0x55, 0x57, 0x13, 0x00, 0x00, 0x7a, 0x00, 0x7d, 0xe3, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x7b, 0xc5, 0xe4, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x06, 0x05, 0x7e, 0x00, 0x00, 0x0a, 0x3f, 0x54, 0x48, 0x4b, 0x4d, 0x4b, 0x4d, 0x4b, 0x4d, 0x4f, 0x43, 0x4d, 0x4b, 0x56, 0x1e, 0x08, 0x08, 0x0c, 0x0d, 0x0c, 0x0a, 0x00, 0x10, 0xfb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd8, 0xc1, 0xcf, 0x09, 0x08, 0x08, 0x08, 0x00, 0x00, 0x88, 0x17, 0x64, 0x48, 0x4c, 0x4d, 0x4c, 0x50, 0x4c, 0x4b, 0x4f, 0x4c, 0x52, 0x52, 0x56, 0x22, 0x00, 0x00, 0x88, 0x7a, 0x88, 0x05, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7c, 0xc5, 0xe4, 0xe7, 0xe4, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xfe, 0x00, 0x08, 0x00, 0x13, 0x53, 0x4b, 0x48, 0x4d, 0x4d, 0x4d, 0x4b, 0x4d, 0x4b, 0x4d, 0x4d, 0x4c, 0x4b, 0x59, 0x1e, 0x08, 0x00, 0x86, 0x00, 0x08, 0x08, 0x00, 0xef, 0xfd, 0xfb, 0xfa, 0xda, 0xd8, 0xda, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 
-  0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xfb, 0xda, 0xbd, 0x85, 0xee, 0x00, 0x7d, 0x7e, 0x88, 0x7d, 0x88, 0x17, 0x59, 0x50, 0x4c, 0x47, 0x4d, 0x50, 0x50, 0x4c, 0x4f, 0x4d, 0x5a, 0x48, 0x5f, 0x2a, 0x08, 0x00, 0x88, 0x7a, 0x7c, 0xe2, 0xe3, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc5, 0xe6, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xe4, 0x92, 0xf8, 0x00, 0x09, 0x00, 0x1e, 0x53, 0x4b, 0x50, 0x4d, 0x4d, 0x4c, 0x4d, 0x4d, 0x4d, 0x4c, 0x4c, 0x4c, 0x48, 0x59, 0x1a, 0x00, 0x86, 0x80, 0x80, 0x00, 0x00, 0x9d, 0xc1, 0xfa, 0xfa, 0xd9, 0xd9, 0xda, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xda, 0xda, 0xf7, 0xea, 0x00, 0x86, 0x7e, 0x88, 0x88, 0x0c, 0x5b, 0x48, 0x50, 0x52, 0x4d, 0x48, 0x50, 0x52, 0x4d, 0x4d, 0x4c, 0x50, 0x5f, 0x39, 0x08, 0x7a, 0x7a, 0x7a, 0x7c, 0xe2, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe6, 0xe7, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x88, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xc3, 0xe4, 0xe3, 0x8d, 0x00, 0x09, 0x08, 0x2a, 0x53, 0x43, 0x4c, 0x4c, 0x4c, 0x47, 0x4c, 0x4b, 0x4c, 0x4b, 0x4c, 0x4c, 0x47, 0x5b, 0x13, 0x7c, 0x00, 0x86, 0x7e, 0x00, 0x82, 0x85, 0xbf, 0xd9, 0xd7, 0xfa, 0xda, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xdc, 0xdd, 0x9d, 0x00, 0x7d, 0x7c, 0x88, 0x00, 0x4e, 0x54, 0x50, 0x50, 0x43, 0x55, 0x50, 0x4c, 0x4d, 0x4d, 0x48, 0x58, 0x4f, 0x3f, 0x08, 0x7a, 0x00, 0x00, 0x03, 0xe2, 0xe3, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xe5, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0xe1, 0x06, 0x93, 0xe0, 0x00, 0x08, 0x0a, 0x2e, 0x51, 0x43, 0x47, 0x47, 0x47, 0x4b, 0x47, 0x4b, 0x4b, 0x4b, 0x4b, 0x4c, 0x4b, 0x4a, 0x09, 0x7a, 0x7a, 0x09, 0x00, 0x83, 0xd3, 0xc1, 0xd8, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xe3, 0x00, 0x88, 0x7c, 0x00, 0x26, 0x56, 0x50, 0x50, 0x52, 0x4d, 0x50, 0x4d, 0x4d, 0x4d, 0x50, 0x52, 0x54, 0x39, 0x08, 0x00, 0x7a, 0x00, 0xf8, 0xe2, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe7, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x88, 0x88, 0x06, 0xc5, 0x06, 0xe0, 0x00, 0x08, 0x08, 0x35, 0x45, 0x4b, 0x48, 0x43, 0x43, 0x43, 0x4b, 0x4b, 0x47, 0x4c, 0x48, 0x4c, 0x51, 0x2a, 0x7a, 0x00, 0x7c, 0x09, 0x08, 0xcf, 0xc0, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf6, 0xd5, 0xe3, 0x08, 0x89, 0x00, 0x0c, 0x4a, 0x54, 0x48, 0x4c, 0x47, 0x4d, 0x4d, 0x4d, 0x4c, 0x50, 0x5a, 0x56, 0x2a, 0x08, 0x00, 0x00, 0x7d, 0xe2, 0xe2, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xe7, 0xe8, 0xe1, 0x00, 0x7a, 0x7a, 0x00, 0x00, 0xe3, 0x07, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xe0, 0xe3, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x04, 0xe6, 0x06, 0x7b, 0x8d, 0x86, 0x00, 0x00, 0x26, 0x51, 0x48, 0x50, 0x43, 0x4d, 0x43, 0x4b, 0x47, 0x4c, 0x47, 0x52, 0x4b, 0x3f, 0x0e, 0x00, 0x89, 0x89, 0x10, 0xf1, 0xf7, 0xbd, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xdd, 0xd0, 0xf8, 0x88, 0x7c, 0x00, 0x1a, 0x53, 0x4b, 0x52, 0x44, 0x4c, 0x4c, 0x4c, 0x50, 0x50, 0x48, 0x56, 0x1b, 0x00, 0x7a, 0x7a, 0xe0, 0xe1, 0x05, 0x05, 0xe1, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0xe4, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe7, 0x07, 0xc4, 0x00, 0x00, 0x88, 0x00, 0x00, 0xa3, 0x8d, 0x00, 0x7a, 0x00, 0x7a, 0x7a, 0x00, 0xe5, 0xe3, 0x00, 0x00, 0x7a, 0x00, 0x7d, 0xe6, 0x07, 0xe5, 0x7b, 0xe3, 0x86, 0x86, 0x08, 0x1b, 0x51, 0x44, 0x48, 0x4c, 0x47, 0x4c, 0x48, 0x4c, 0x4b, 0x4b, 0x4b, 0x51, 0x16, 0x00, 0x7c, 0x89, 0x7f, 0xf0, 0x78, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 
-  0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xfd, 0xd0, 0xc3, 0x89, 0x08, 0x08, 0x1e, 0x53, 0x45, 0x42, 0x4c, 0x48, 0x48, 0x50, 0x4c, 0x4f, 0x46, 0x0e, 0x00, 0x7a, 0xdf, 0xe2, 0xe1, 0xe2, 0xc4, 0xe9, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xc9, 0x00, 0x7a, 0x88, 0x7a, 0x00, 0x02, 0xea, 0x00, 0x7a, 0x7a, 0x00, 0x7c, 0xc3, 0xe6, 0xe7, 0x06, 0x7d, 0x7a, 0x7a, 0x00, 0x02, 0xef, 0x88, 0x00, 0x7c, 0x00, 0x7a, 0x00, 0x00, 0xa3, 0x7d, 0x7a, 0x00, 0x00, 0x7c, 0x92, 0x92, 0x06, 0xe7, 0x34, 0xe4, 0xdf, 0x81, 0x7a, 0x0e, 0x3f, 0x4f, 0x44, 0x50, 0x48, 0x48, 0x48, 0x42, 0x42, 0x49, 0x53, 0x18, 0x08, 0x7a, 0x03, 0x82, 0xcc, 0xde, 0xd8, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf7, 0xcd, 0x8d, 0x7c, 0x0a, 0x09, 0x18, 0x4e, 0x53, 0x42, 0x54, 0x54, 0x4b, 0x51, 0x57, 0x16, 0x00, 0x00, 0x01, 0xe2, 0xc4, 0xe1, 0xf8, 0xc9, 0xce, 0xe3, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf0, 0x7a, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x9d, 0xe1, 0x7a, 0x02, 0x01, 0x04, 0xf8, 0xc7, 0xeb, 0xe4, 0xe2, 0x03, 0x7c, 0x00, 0x06, 0xca, 0x00, 0x88, 0x7a, 0x7a, 0x00, 0x00, 0xe0, 0xa3, 0x00, 0x7c, 0x00, 0x88, 0xe2, 0xe2, 0x07, 0xed, 0x92, 0x34, 0xe6, 0x93, 0x7f, 0x00, 0x08, 0x15, 0x53, 0x51, 0x42, 0x4b, 0x42, 0x42, 0x45, 0x4e, 0x3b, 0x12, 0x00, 0x7d, 0xdf, 0xc4, 0xcc, 0xde, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 
-  0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xfd, 0xd1, 0x8d, 0xc2, 0x09, 0x00, 0x0b, 0x1e, 0x3f, 0x4a, 0x4e, 0x3f, 0x26, 0x0e, 0x00, 0x88, 0xdf, 0xc4, 0xe2, 0x8d, 0xe0, 0x9d, 0xdc, 0xd7, 0xc7, 0x8d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xc8, 0x00, 0x88, 0x88, 0x88, 0x00, 0xe4, 0xf9, 0x01, 0x02, 0xc3, 0x03, 0xc4, 0xd3, 0xf4, 0xc9, 0xe3, 0x05, 0xe0, 0x00, 0xe9, 0xc8, 0x00, 0x7c, 0x88, 0x88, 0x88, 0x00, 0xc9, 0x92, 0x00, 0x00, 0x01, 0xf8, 0x8d, 0xe2, 0xd0, 0xde, 0xcd, 0xe7, 0x92, 0xe6, 0x93, 0xe0, 0x0d, 0x08, 0x10, 0x2e, 0x3f, 0x4e, 0x4e, 0x46, 0x38, 0x1b, 0x08, 0x08, 0x02, 0x04, 0x92, 0xf2, 0xff, 0xd8, 0xda, 0xda, 0xd7, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xda, 0xda, 0xdb, 0xf7, 0xd3, 0xc8, 0x82, 0x82, 0x7c, 0x7c, 0x00, 0x0b, 0x0d, 0x08, 0x86, 0x7c, 0xc3, 0x19, 0xe3, 0xfe, 0xe0, 0xe4, 0xcc, 0xf6, 0xf5, 0xf4, 0xd4, 0x06, 0x8d, 0x02, 0x88, 0x7c, 0x00, 0x02, 0xcd, 0x01, 0x7a, 0x7c, 0x7c, 0x7a, 0x02, 0xeb, 0x02, 0xc3, 0x02, 0x06, 0xd1, 0xfd, 0xbf, 0xf6, 0xef, 0xe6, 0xc4, 0xc3, 0xa3, 0x7b, 0x00, 0x7c, 0x88, 0x7d, 0x7a, 0xc3, 0xec, 0x7a, 0x7d, 0x01, 0xc3, 0xdf, 0xc6, 0xd2, 0xde, 0xd6, 0xfd, 0xbb, 0xeb, 0xe4, 0x06, 0xe4, 0xe3, 0xf8, 0x01, 0x7c, 0x7c, 0x0a, 0x0c, 0x09, 0x08, 0x00, 0xdf, 0xe0, 0x82, 0xa7, 0xd6, 0xfc, 0xfb, 0xf4, 0xd8, 0xd6, 0xdb, 0xd7, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xfb, 0xf6, 0xc0, 0xef, 0x94, 0x8d, 0xc4, 0xc4, 0x83, 0xe0, 0x8d, 0xc4, 0x8f, 0xe2, 0xe1, 0xe0, 0xe3, 0xed, 0xd4, 0xfd, 0xf4, 0xd8, 0xd9, 0xdd, 0xd1, 0xc8, 0x02, 0xc2, 0x01, 0x02, 0x7c, 0xea, 0x9d, 0x00, 0x7d, 0x00, 0x88, 0x01, 0xed, 0x04, 0x02, 0xc6, 0xd6, 0xf6, 0xd9, 0xd8, 0xbf, 0xdd, 0xd4, 0xca, 0x05, 0xea, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xc5, 0x00, 0x01, 0xc2, 0xc4, 0xa3, 0xd9, 0xdc, 0xd9, 0xf4, 0xd8, 0xdc, 0xdd, 0xcd, 0xc7, 0xe2, 0xe3, 0x93, 0xe4, 0x8f, 0xc4, 0x83, 0xf8, 0xc4, 0x1d, 0xfe, 0xc3, 0x94, 0xcd, 0xdd, 0xdc, 0xfa, 0xd9, 0xfa, 0xda, 0xda, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf7, 0xd9, 0xce, 0xc9, 0x07, 0x06, 0xe4, 0x92, 0x92, 0xe4, 0xe7, 0xa3, 0xf1, 0xf4, 0xf7, 0xdc, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xdc, 0xde, 0xce, 0xc8, 0xc4, 0x01, 0xc2, 0xc2, 0xef, 0xc4, 0x01, 0x04, 0xc3, 0x8d, 0xee, 0xef, 0xbb, 0xf7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xdc, 0xd9, 0xf7, 0xdb, 0xd2, 0xef, 0xf9, 0xe3, 0xe3, 0x8d, 0x9d, 0x9d, 0xe2, 0xc6, 0xa3, 0xf0, 0xd7, 0xf7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xde, 0xf7, 0xd1, 0xed, 0xf9, 0xc5, 0xc5, 0x93, 0x92, 0x92, 0x92, 0x94, 0x9d, 0xf1, 0xdd, 0xde, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xde, 0xdc, 0xd5, 0xcf, 0xce, 0xcd, 0xf1, 0xd2, 0xd7, 0xf6, 0xdc, 0xf4, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd7, 0xdc, 0xdd, 0xf6, 0xd2, 0xee, 0xea, 0x9d, 0xec, 0xcc, 0xec, 0xeb, 0xee, 0xf1, 0xd8, 0xdd, 0xf5, 0xd8, 0xdb, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xf4, 0xd8, 0xdb, 0xdc, 0xdc, 0xdd, 0xd8, 0xd5, 0xd5, 0xd4, 0xf2, 0xd9, 0xf5, 0xdd, 0xde, 0xdb, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd8, 0xdc, 0xd9, 0xf4, 0xdc, 0xf6, 0xd9, 0xbb, 0xcf, 0xce, 0xcd, 0xf1, 0xd1, 0xd5, 0xdd, 0xde, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd8, 0xd9, 0xf4, 0xdd, 0xf6, 0xde, 0xdd, 0xdc, 0xdb, 0xd9, 0xf4, 0xf4, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xf4, 0xdb, 0xf7, 0xf7, 0xf7, 0xf7, 0xde, 0xf7, 0xf7, 0xf7, 0xdc, 0xf4, 0xf4, 0xf4, 0xdb, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xf4, 0xf4, 0xd9, 0xd8, 0xf4, 0xd8, 0xdb, 0xd9, 0xf6, 0xdb, 0xdc, 0xdb, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xf4, 0xd7, 0xd7, 0xf4, 0xf4, 0xd9, 0xf4, 0xdb, 0xdc, 0xf6, 0xdd, 0xdd, 0xdc, 0xdb, 0xd9, 0xd7, 0xf4, 0xd8, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xd8, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xdb, 0xd8, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xd7, 0xf4, 0xd6, 0xd9, 0xd9, 0xd7, 0xf4, 0xf4, 0xd9, 0xd7, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xf4, 0xd9, 0xf4, 0xf4, 0xdb, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd8, 0xd8, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd8, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf3, 0xd9, 0xf3, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xd9, 0xf3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xf4, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xf4, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf4, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd9, 0xd7, 0xd9, 0xd7, 0xf4, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 
-};
-
-const lv_img_dsc_t image5 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image5_map,
-};
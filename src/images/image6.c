@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE6
-#define LV_ATTRIBUTE_IMG_IMAGE6
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE6 uint8_t image6_map[] = {
-  0xfb, 0xfb, 0xfb, 0xff, 	/*Color of index 0*/
-  0xf6, 0xf6, 0xf6, 0xff, 	/*Color of index 1*/
-  0xf3, 0xf3, 0xf3, 0xff, 	/*Color of index 2*/
-  0xee, 0xee, 0xee, 0xff, 	/*Color of index 3*/
-  0xe7, 0xe7, 0xe7, 0xff, 	/*Color of index 4*/
-  0xd4, 0xd4, 0xd4, 0xff, 	/*Color of index 5*/
-  0xd1, 0xd1, 0xd1, 0xff, 	/*Color of index 6*/
-  0xcf, 0xcf, 0xcf, 0xff, 	/*Color of index 7*/
-  0xcb, 0xcb, 0xcb, 0xff, 	/*Color of index 8*/
-  0xf3, 0xf3, 0xfd, 0xff, 	/*Color of index 9*/
-  0xee, 0xeb, 0xfd, 0xff, 	/*Color of index 10*/
-  0xe3, 0xe1, 0xfa, 0xff, 	/*Color of index 11*/
-  0xda, 0xd7, 0xf6, 0xff, 	/*Color of index 12*/
-  0xd1, 0xcd, 0xf0, 0xff, 	/*Color of index 13*/
-  0xc4, 0xc1, 0xec, 0xff, 	/*Color of index 14*/
-  0xc2, 0xbd, 0xe1, 0xff, 	/*Color of index 15*/
-  0xb9, 0xb6, 0xe3, 0xff, 	/*Color of index 16*/
-  0xb5, 0xb2, 0xed, 0xff, 	/*Color of index 17*/
-  0xad, 0xa9, 0xf3, 0xff, 	/*Color of index 18*/
-  0xb2, 0xac, 0xe2, 0xff, 	/*Color of index 19*/
-  0xae, 0xa8, 0xe9, 0xff, 	/*Color of index 20*/
-  0xa9, 0xa1, 0xf9, 0xff, 	/*Color of index 21*/
-  0xa8, 0xa2, 0xf4, 0xff, 	/*Color of index 22*/
-  0xaf, 0xa9, 0xd9, 0xff, 	/*Color of index 23*/
-  0xa8, 0xa3, 0xed, 0xff, 	/*Color of index 24*/
-  0xa5, 0xa1, 0xf2, 0xff, 	/*Color of index 25*/
-  0xa5, 0x9e, 0xf9, 0xff, 	/*Color of index 26*/
-  0xac, 0xa0, 0xee, 0xff, 	/*Color of index 27*/
-  0xa7, 0x9e, 0xf5, 0xff, 	/*Color of index 28*/
-  0xa9, 0xa3, 0xe2, 0xff, 	/*Color of index 29*/
-  0xa3, 0x9d, 0xf1, 0xff, 	/*Color of index 30*/
-  0xa8, 0xa2, 0xdb, 0xff, 	/*Color of index 31*/
-  0xa6, 0x9d, 0xe8, 0xff, 	/*Color of index 32*/
-  0xa8, 0xa5, 0xc8, 0xff, 	/*Color of index 33*/
-  0xa7, 0xa0, 0xd3, 0xff, 	/*Color of index 34*/
-  0xa3, 0x99, 0xe2, 0xff, 	/*Color of index 35*/
-  0xa2, 0x99, 0xda, 0xff, 	/*Color of index 36*/
-  0xa2, 0x98, 0xd2, 0xff, 	/*Color of index 37*/
-  0xa0, 0x8c, 0xf5, 0xff, 	/*Color of index 38*/
-  0xa0, 0x9a, 0xc5, 0xff, 	/*Color of index 39*/
-  0xa0, 0x8d, 0xee, 0xff, 	/*Color of index 40*/
-  0x9c, 0x93, 0xdb, 0xff, 	/*Color of index 41*/
-  0x98, 0x8f, 0xe8, 0xff, 	/*Color of index 42*/
-  0x97, 0x90, 0xe2, 0xff, 	/*Color of index 43*/
-  0x96, 0x8d, 0xe4, 0xff, 	/*Color of index 44*/
-  0x95, 0x8b, 0xeb, 0xff, 	/*Color of index 45*/
-  0x94, 0x8a, 0xe4, 0xff, 	/*Color of index 46*/
-  0x98, 0x8e, 0xd3, 0xff, 	/*Color of index 47*/
-  0x99, 0x90, 0xcb, 0xff, 	/*Color of index 48*/
-  0x99, 0x94, 0xbd, 0xff, 	/*Color of index 49*/
-  0x96, 0x8a, 0xdb, 0xff, 	/*Color of index 50*/
-  0x92, 0x88, 0xe2, 0xff, 	/*Color of index 51*/
-  0x91, 0x86, 0xe2, 0xff, 	/*Color of index 52*/
-  0x91, 0x82, 0xeb, 0xff, 	/*Color of index 53*/
-  0x90, 0x7f, 0xf4, 0xff, 	/*Color of index 54*/
-  0x8f, 0x83, 0xe4, 0xff, 	/*Color of index 55*/
-  0x94, 0x8c, 0xbd, 0xff, 	/*Color of index 56*/
-  0x92, 0x81, 0xdc, 0xff, 	/*Color of index 57*/
-  0x91, 0x82, 0xd2, 0xff, 	/*Color of index 58*/
-  0x91, 0x7c, 0xe2, 0xff, 	/*Color of index 59*/
-  0x93, 0x89, 0xb5, 0xff, 	/*Color of index 60*/
-  0x91, 0x7d, 0xdb, 0xff, 	/*Color of index 61*/
-  0x90, 0x84, 0xc3, 0xff, 	/*Color of index 62*/
-  0x8f, 0x7a, 0xdb, 0xff, 	/*Color of index 63*/
-  0x8e, 0x7c, 0xd4, 0xff, 	/*Color of index 64*/
-  0x89, 0x84, 0xb1, 0xff, 	/*Color of index 65*/
-  0x8e, 0x7c, 0xca, 0xff, 	/*Color of index 66*/
-  0x8d, 0x76, 0xdd, 0xff, 	/*Color of index 67*/
-  0x8a, 0x7a, 0xc1, 0xff, 	/*Color of index 68*/
-  0x86, 0x72, 0xcf, 0xff, 	/*Color of index 69*/
-  0x84, 0x72, 0xc2, 0xff, 	/*Color of index 70*/
-  0x82, 0x79, 0xaa, 0xff, 	/*Color of index 71*/
-  0x81, 0x6a, 0xce, 0xff, 	/*Color of index 72*/
-  0x7d, 0x68, 0xca, 0xff, 	/*Color of index 73*/
-  0x7b, 0x6a, 0xc2, 0xff, 	/*Color of index 74*/
-  0x7b, 0x71, 0xa3, 0xff, 	/*Color of index 75*/
-  0x7b, 0x65, 0xca, 0xff, 	/*Color of index 76*/
-  0x76, 0x73, 0x95, 0xff, 	/*Color of index 77*/
-  0x78, 0x67, 0xb7, 0xff, 	/*Color of index 78*/
-  0x77, 0x61, 0xc3, 0xff, 	/*Color of index 79*/
-  0x71, 0x6a, 0x93, 0xff, 	/*Color of index 80*/
-  0x70, 0x62, 0xa5, 0xff, 	/*Color of index 81*/
-  0x6c, 0x61, 0x96, 0xff, 	/*Color of index 82*/
-  0x68, 0x64, 0x87, 0xff, 	/*Color of index 83*/
-  0x64, 0x5c, 0x87, 0xff, 	/*Color of index 84*/
-  0x5e, 0x5b, 0x7a, 0xff, 	/*Color of index 85*/
-  0x5c, 0x50, 0x8b, 0xff, 	/*Color of index 86*/
-  0x56, 0x4f, 0x75, 0xff, 	/*Color of index 87*/
-  0x51, 0x4c, 0x67, 0xff, 	/*Color of index 88*/
-  0x49, 0x45, 0x68, 0xff, 	/*Color of index 89*/
-  0x47, 0x45, 0x5a, 0xff, 	/*Color of index 90*/
-  0x43, 0x39, 0x64, 0xff, 	/*Color of index 91*/
-  0x3e, 0x3a, 0x56, 0xff, 	/*Color of index 92*/
-  0x39, 0x34, 0x56, 0xff, 	/*Color of index 93*/
-  0x39, 0x36, 0x47, 0xff, 	/*Color of index 94*/
-  0x35, 0x31, 0x4d, 0xff, 	/*Color of index 95*/
-  0x33, 0x30, 0x3b, 0xff, 	/*Color of index 96*/
-  0x31, 0x2d, 0x44, 0xff, 	/*Color of index 97*/
-  0x32, 0x28, 0x50, 0xff, 	/*Color of index 98*/
-  0x2b, 0x29, 0x3c, 0xff, 	/*Color of index 99*/
-  0x29, 0x25, 0x3c, 0xff, 	/*Color of index 100*/
-  0x24, 0x1e, 0x45, 0xff, 	/*Color of index 101*/
-  0x26, 0x23, 0x33, 0xff, 	/*Color of index 102*/
-  0x23, 0x23, 0x2c, 0xff, 	/*Color of index 103*/
-  0x23, 0x1f, 0x38, 0xff, 	/*Color of index 104*/
-  0x1f, 0x1b, 0x30, 0xff, 	/*Color of index 105*/
-  0x1b, 0x1d, 0x24, 0xff, 	/*Color of index 106*/
-  0x1b, 0x13, 0x34, 0xff, 	/*Color of index 107*/
-  0x18, 0x17, 0x1d, 0xff, 	/*Color of index 108*/
-  0x15, 0x12, 0x2a, 0xff, 	/*Color of index 109*/
-  0x18, 0x14, 0x22, 0xff, 	/*Color of index 110*/
-  0x13, 0x0c, 0x24, 0xff, 	/*Color of index 111*/
-  0x0c, 0x05, 0x1d, 0xff, 	/*Color of index 112*/
-  0x04, 0x02, 0x11, 0xff, 	/*Color of index 113*/
-  0xb8, 0xbc, 0xc0, 0xff, 	/*Color of index 114*/
-  0x05, 0x06, 0x08, 0xff, 	/*Color of index 115*/
-  0xf8, 0xf9, 0xf9, 0xff, 	/*Color of index 116*/
-  0x2e, 0x31, 0x31, 0xff, 	/*Color of index 117*/
-  0xf7, 0xf8, 0xf7, 0xff, 	/*Color of index 118*/
-  0xee, 0xef, 0xee, 0xff, 	/*Color of index 119*/
-  0x25, 0x28, 0x25, 0xff, 	/*Color of index 120*/
-  0xd6, 0xd8, 0xd4, 0xff, 	/*Color of index 121*/
-  0x37, 0x3a, 0x32, 0xff, 	/*Color of index 122*/
-  0xfa, 0xfc, 0xf5, 0xff, 	/*Color of index 123*/
-  0xfd, 0xfe, 0xec, 0xff, 	/*Color of index 124*/
-  0xff, 0xff, 0xc0, 0xff, 	/*Color of index 125*/
-  0xf3, 0xf2, 0xea, 0xff, 	/*Color of index 126*/
-  0xf7, 0xf7, 0xbc, 0xff, 	/*Color of index 127*/
-  0xf0, 0xed, 0xd8, 0xff, 	/*Color of index 128*/
-  0xe9, 0xe9, 0xe5, 0xff, 	/*Color of index 129*/
-  0xe3, 0xe3, 0xe2, 0xff, 	/*Color of index 130*/
-  0xe0, 0xe1, 0xd9, 0xff, 	/*Color of index 131*/
-  0xda, 0xda, 0xd9, 0xff, 	/*Color of index 132*/
-  0xdf, 0xdc, 0xc7, 0xff, 	/*Color of index 133*/
-  0xda, 0xd8, 0xac, 0xff, 	/*Color of index 134*/
-  0xca, 0xc9, 0xc6, 0xff, 	/*Color of index 135*/
-  0xcf, 0xcb, 0xab, 0xff, 	/*Color of index 136*/
-  0xc5, 0xc0, 0x9e, 0xff, 	/*Color of index 137*/
-  0xb0, 0xad, 0x90, 0xff, 	/*Color of index 138*/
-  0xaf, 0xab, 0x76, 0xff, 	/*Color of index 139*/
-  0xa3, 0xa1, 0x84, 0xff, 	/*Color of index 140*/
-  0x9b, 0x97, 0x71, 0xff, 	/*Color of index 141*/
-  0x9a, 0x9a, 0x40, 0xff, 	/*Color of index 142*/
-  0x9c, 0x92, 0x52, 0xff, 	/*Color of index 143*/
-  0x91, 0x89, 0x55, 0xff, 	/*Color of index 144*/
-  0x94, 0x8a, 0x41, 0xff, 	/*Color of index 145*/
-  0x86, 0x80, 0x66, 0xff, 	/*Color of index 146*/
-  0x8b, 0x86, 0x35, 0xff, 	/*Color of index 147*/
-  0x84, 0x7e, 0x50, 0xff, 	/*Color of index 148*/
-  0x7a, 0x75, 0x42, 0xff, 	/*Color of index 149*/
-  0x6a, 0x68, 0x63, 0xff, 	/*Color of index 150*/
-  0x7b, 0x75, 0x31, 0xff, 	/*Color of index 151*/
-  0x6e, 0x67, 0x4e, 0xff, 	/*Color of index 152*/
-  0x74, 0x6c, 0x32, 0xff, 	/*Color of index 153*/
-  0x6a, 0x65, 0x2e, 0xff, 	/*Color of index 154*/
-  0x5b, 0x56, 0x39, 0xff, 	/*Color of index 155*/
-  0x5d, 0x57, 0x27, 0xff, 	/*Color of index 156*/
-  0x45, 0x42, 0x38, 0xff, 	/*Color of index 157*/
-  0x47, 0x41, 0x1f, 0xff, 	/*Color of index 158*/
-  0x3e, 0x3b, 0x33, 0xff, 	/*Color of index 159*/
-  0x3a, 0x3a, 0x2a, 0xff, 	/*Color of index 160*/
-  0x37, 0x37, 0x2d, 0xff, 	/*Color of index 161*/
-  0x37, 0x34, 0x2c, 0xff, 	/*Color of index 162*/
-  0x3a, 0x35, 0x22, 0xff, 	/*Color of index 163*/
-  0x30, 0x32, 0x29, 0xff, 	/*Color of index 164*/
-  0x33, 0x32, 0x22, 0xff, 	/*Color of index 165*/
-  0x3d, 0x34, 0x0d, 0xff, 	/*Color of index 166*/
-  0x2f, 0x2c, 0x24, 0xff, 	/*Color of index 167*/
-  0x2e, 0x2d, 0x18, 0xff, 	/*Color of index 168*/
-  0x28, 0x25, 0x1d, 0xff, 	/*Color of index 169*/
-  0x2b, 0x27, 0x0b, 0xff, 	/*Color of index 170*/
-  0x20, 0x1f, 0x1c, 0xff, 	/*Color of index 171*/
-  0x20, 0x1f, 0x13, 0xff, 	/*Color of index 172*/
-  0x27, 0x1d, 0x01, 0xff, 	/*Color of index 173*/
-  0x1d, 0x1c, 0x07, 0xff, 	/*Color of index 174*/
-  0x16, 0x18, 0x10, 0xff, 	/*Color of index 175*/
-  0x1a, 0x18, 0x0e, 0xff, 	/*Color of index 176*/
-  0x0f, 0x12, 0x08, 0xff, 	/*Color of index 177*/
-  0x0f, 0x0d, 0x03, 0xff, 	/*Color of index 178*/
-  0x07, 0x08, 0x04, 0xff, 	/*Color of index 179*/
-  0xcf, 0xce, 0xcc, 0xff, 	/*Color of index 180*/
-  0xc4, 0xc3, 0xc2, 0xff, 	/*Color of index 181*/
-  0xbe, 0xbc, 0xbb, 0xff, 	/*Color of index 182*/
-  0xb8, 0xb6, 0xb5, 0xff, 	/*Color of index 183*/
-  0xb3, 0xb1, 0xb0, 0xff, 	/*Color of index 184*/
-  0xac, 0xab, 0xaa, 0xff, 	/*Color of index 185*/
-  0xa7, 0xa6, 0xa5, 0xff, 	/*Color of index 186*/
-  0x9c, 0x9a, 0x99, 0xff, 	/*Color of index 187*/
-  0x91, 0x8f, 0x8c, 0xff, 	/*Color of index 188*/
-  0x8b, 0x8a, 0x88, 0xff, 	/*Color of index 189*/
-  0x84, 0x82, 0x81, 0xff, 	/*Color of index 190*/
-  0x7d, 0x7b, 0x7a, 0xff, 	/*Color of index 191*/
-  0x74, 0x73, 0x72, 0xff, 	/*Color of index 192*/
-  0x6d, 0x6b, 0x6a, 0xff, 	/*Color of index 193*/
-  0x64, 0x62, 0x60, 0xff, 	/*Color of index 194*/
-  0x5d, 0x5b, 0x5a, 0xff, 	/*Color of index 195*/
-  0x5e, 0x59, 0x53, 0xff, 	/*Color of index 196*/
-  0x55, 0x54, 0x53, 0xff, 	/*Color of index 197*/
-  0x57, 0x52, 0x4b, 0xff, 	/*Color of index 198*/
-  0x50, 0x4d, 0x4a, 0xff, 	/*Color of index 199*/
-  0x4b, 0x48, 0x46, 0xff, 	/*Color of index 200*/
-  0x47, 0x43, 0x42, 0xff, 	/*Color of index 201*/
-  0x40, 0x3d, 0x3b, 0xff, 	/*Color of index 202*/
-  0x3d, 0x39, 0x38, 0xff, 	/*Color of index 203*/
-  0x3a, 0x37, 0x33, 0xff, 	/*Color of index 204*/
-  0x3d, 0x35, 0x33, 0xff, 	/*Color of index 205*/
-  0x38, 0x35, 0x32, 0xff, 	/*Color of index 206*/
-  0x35, 0x32, 0x31, 0xff, 	/*Color of index 207*/
-  0x33, 0x2f, 0x2d, 0xff, 	/*Color of index 208*/
-  0x31, 0x2d, 0x2b, 0xff, 	/*Color of index 209*/
-  0x2d, 0x2a, 0x29, 0xff, 	/*Color of index 210*/
-  0x2b, 0x28, 0x26, 0xff, 	/*Color of index 211*/
-  0x28, 0x25, 0x23, 0xff, 	/*Color of index 212*/
-  0x23, 0x20, 0x1d, 0xff, 	/*Color of index 213*/
-  0x20, 0x1d, 0x1b, 0xff, 	/*Color of index 214*/
-  0x1f, 0x1c, 0x15, 0xff, 	/*Color of index 215*/
-  0x1d, 0x19, 0x18, 0xff, 	/*Color of index 216*/
-  0x1a, 0x17, 0x15, 0xff, 	/*Color of index 217*/
-  0x18, 0x13, 0x12, 0xff, 	/*Color of index 218*/
-  0x18, 0x14, 0x0b, 0xff, 	/*Color of index 219*/
-  0x16, 0x11, 0x10, 0xff, 	/*Color of index 220*/
-  0x13, 0x0f, 0x0e, 0xff, 	/*Color of index 221*/
-  0x0f, 0x0d, 0x0c, 0xff, 	/*Color of index 222*/
-  0x0b, 0x09, 0x05, 0xff, 	/*Color of index 223*/
-  0x08, 0x05, 0x03, 0xff, 	/*Color of index 224*/
-  0xf1, 0xf0, 0xf0, 0xff, 	/*Color of index 225*/
-  0xeb, 0xea, 0xea, 0xff, 	/*Color of index 226*/
-  0xe6, 0xe5, 0xe5, 0xff, 	/*Color of index 227*/
-  0xe1, 0xe0, 0xe0, 0xff, 	/*Color of index 228*/
-  0xde, 0xdd, 0xdd, 0xff, 	/*Color of index 229*/
-  0xd7, 0xd6, 0xd6, 0xff, 	/*Color of index 230*/
-  0xc8, 0xc7, 0xc7, 0xff, 	/*Color of index 231*/
-  0xa2, 0xa0, 0xa0, 0xff, 	/*Color of index 232*/
-  0x95, 0x93, 0x93, 0xff, 	/*Color of index 233*/
-  0x5a, 0x57, 0x57, 0xff, 	/*Color of index 234*/
-  0x25, 0x21, 0x21, 0xff, 	/*Color of index 235*/
-  0x1e, 0x11, 0x15, 0xff, 	/*Color of index 236*/
-  0x17, 0x0e, 0x12, 0xff, 	/*Color of index 237*/
-  0x0c, 0x09, 0x09, 0xff, 	/*Color of index 238*/
-  0x0a, 0x07, 0x08, 0xff, 	/*Color of index 239*/
-  0x01, 0x00, 0x00, 0xff, 	/*Color of index 240*/
-  0xcf, 0xcc, 0xcf, 0xff, 	/*Color of index 241*/
-  0x38, 0x34, 0x38, 0xff, 	/*Color of index 242*/
-  0x36, 0x2e, 0x33, 0xff, 	/*Color of index 243*/
-  0x31, 0x2b, 0x31, 0xff, 	/*Color of index 244*/
-  0x29, 0x24, 0x28, 0xff, 	/*Color of index 245*/
-  0x22, 0x1b, 0x20, 0xff, 	/*Color of index 246*/
-  0x19, 0x13, 0x18, 0xff, 	/*Color of index 247*/
-  0x12, 0x0d, 0x10, 0xff, 	/*Color of index 248*/
-  0xf9, 0xf7, 0xfd, 0xff, 	/*Color of index 249*/
-  0xe0, 0xdc, 0xe7, 0xff, 	/*Color of index 250*/
-  0xdd, 0xd3, 0xdf, 0xff, 	/*Color of index 251*/
-  0xd1, 0xc8, 0xda, 0xff, 	/*Color of index 252*/
-  0x2b, 0x27, 0x33, 0xff, 	/*Color of index 253*/
-  0x14, 0x0e, 0x1a, 0xff, 	/*Color of index 254*/
-  0x0b, 0x08, 0x11, 0xff, 	/*Color of index 255*/
-
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xdd, 0xdc, 0xda, 0xda, 0xd9, 0xd9, 0xdd, 0xd9, 0xda, 0xdd, 0xdd, 0xef, 0xdc, 0xdc, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xde, 0xee, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xde, 0xc8, 0xbb, 0xd2, 0xee, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xee, 0xd0, 0xc5, 0xd5, 0xef, 0xee, 0xda, 0xdc, 0xdc, 0xda, 0xee, 0xc7, 0x00, 0xb7, 0xf0, 0xd9, 0xda, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xdd, 0xdc, 0xdc, 0xbe, 0x82, 0xe9, 0xcc, 0xda, 0xee, 0xef, 0xdf, 0x75, 0xe4, 0x00, 0xea, 0xe0, 0xf8, 0xd9, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xec, 0xda, 0xec, 0xda, 0xec, 0xda, 0xec, 0xda, 0xec, 0xda, 0xec, 0xda, 0xed, 0xdc, 0xd9, 0xed, 0xd9, 0xf7, 0xda, 0xda, 0xed, 0xda, 0xdc, 0xee, 0xea, 0x02, 0x00, 0xf1, 0xe8, 0xc1, 0xeb, 0xb5, 0x00, 0x03, 0xd8, 0x73, 0xda, 0xda, 0xda, 0xf8, 0xdc, 0xda, 0xec, 0xdc, 0xdc, 0xec, 0xdc, 0xec, 0xdc, 0xda, 0xda, 0xec, 0xda, 0xec, 0xda, 0xda, 0xec, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xec, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xed, 0xd9, 0xda, 0xf8, 0xdc, 0xf8, 0xef, 0xef, 0x73, 0xe0, 0xf0, 0xab, 0xb6, 0x00, 0x00, 0x00, 0x03, 0x76, 0x00, 0x08, 0xf0, 0xd9, 0xda, 0xdd, 0xda, 0xf7, 0xda, 0xf8, 0xdd, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xdc, 0xec, 0xda, 0xda, 0xda, 0xda, 0xda, 0xec, 0xda, 0xec, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xec, 0xda, 0xec, 0xda, 0xda, 0xf7, 0xda, 0xed, 0xdc, 0xdc, 0xed, 0xd8, 0xee, 0xf0, 0xef, 0xd8, 0xcb, 0xc5, 0xc1, 0xbf, 0xbc, 0xbe, 0xbf, 0xe1, 0x76, 0x76, 0x02, 0x00, 0x00, 0xba, 0xf0, 0xf0, 0x73, 0xde, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xec, 0xdc, 0xda, 0xda, 0xec, 0xda, 0xec, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xf7, 0xda, 0xf8, 0xef, 0xef, 0xf0, 0xf5, 0xbc, 0x08, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x76, 0x76, 0x76, 0x00, 0xf1, 0x96, 0xc3, 0xc9, 0x75, 0xd6, 0xda, 0xde, 0xde, 0xde, 0xef, 0xde, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xdc, 0xda, 0xd9, 0xdc, 0xd9, 0xd9, 0xdc, 0xdd, 0xe0, 0xf0, 0xef, 0xd1, 0xc5, 0xbf, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe2, 0xe5, 0xb6, 0xbf, 0xea, 0xc5, 0xcb, 0xd4, 0xee, 0xf0, 0xf0, 0xee, 0xda, 0xd9, 0xd9, 0xda, 0xd9, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xdc, 0xde, 0xee, 0xf0, 0xdd, 0xcf, 0x96, 0xb8, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x06, 0xba, 0xc1, 0xca, 0xde, 0xf0, 0xe0, 0xdc, 0xdd, 0xd9, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xde, 0xee, 0xdf, 0xef, 0xce, 0xbf, 0xb5, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x87, 0xbc, 0xc9, 0xde, 0xf0, 0xef, 0xde, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xd9, 0xdc, 0xdc, 0xe0, 0xe0, 0xd2, 0xbf, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe8, 0xca, 0xe0, 0xf0, 0xee, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdd, 0xe0, 0xef, 0xc8, 0xb8, 0x02, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x76, 0x05, 0xc0, 0xeb, 0xf0, 0xde, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xdd, 0xd9, 0xda, 0xdc, 0xd8, 0xde, 0xda, 0xf0, 0xe0, 0xc3, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xe2, 0xbb, 0xcf, 0xf0, 0xef, 0xda, 0xdd, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xf8, 0xda, 0xf7, 0xde, 0xed, 0xee, 0x96, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xcb, 0x73, 0xf8, 0xdc, 0xf7, 0xdc, 0xdd, 0xda, 0xec, 0xdc, 0xec, 0xdc, 0xda, 0xda, 0xda, 0xec, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xee, 0xf0, 0xc8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xb9, 0xeb, 0xf0, 0xee, 0xd9, 0xf7, 0xdc, 0xdc, 0xec, 0xdc, 0xec, 0xda, 0xec, 0xda, 0xec, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xf7, 0xf0, 0xf2, 0xb5, 0x00, 0x00, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x76, 0x00, 0x00, 0xe8, 0xd4, 0xf0, 0xde, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xde, 0xef, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x76, 0x00, 0x00, 0x00, 0x04, 0xc2, 0x73, 0xee, 0xdc, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xdd, 0xdd, 0xdc, 0xd9, 0xd6, 0xeb, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 0xeb, 0xd8, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xd9, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdd, 0xf0, 0xc9, 0x08, 0x00, 0x76, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xca, 0xe0, 0xee, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xdd, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xd8, 0xab, 0xeb, 0xeb, 0xd4, 0xd4, 0xeb, 0xab, 0xd9, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xd9, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xd6, 0xd3, 0xd0, 0xcb, 0xcb, 0xca, 0xca, 0xca, 0xcb, 0xca, 0xca, 0xca, 0xcb, 0xcc, 0xd1, 0xeb, 0xd8, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xd9, 0xdc, 0xee, 0xdd, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x01, 0x00, 0x00, 0x02, 0xbd, 0xda, 0xdf, 0xda, 0xdd, 0xd9, 0xd9, 0xd8, 0xdc, 0xda, 0xda, 0xdc, 0xdc, 0xdd, 0xda, 0xda, 0xda, 0xd9, 0xd8, 0xeb, 0xd1, 0xcb, 0xcb, 0xcb, 0xca, 0xca, 0xca, 0xca, 0xcb, 0xca, 0xcf, 0xd3, 0xeb, 0xd9, 0xdd, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xde, 0xd8, 0xd4, 0xcf, 0xcb, 0xca, 0xcb, 0xcb, 0xcb, 0xca, 0xcb, 0xca, 0xcb, 0xcc, 0xcb, 0xcc, 0xcb, 0xcc, 0xcb, 0xcc, 0xd0, 0xd4, 0xd8, 0xdd, 0xdc, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdd, 0xe0, 0xeb, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0xb5, 0xcb, 0xf0, 0xdd, 0xda, 0xdc, 0xde, 0xd9, 0xdc, 0xda, 0xdc, 0xda, 0xd9, 0xdc, 0xda, 0xab, 0xd2, 0xcb, 0xca, 0xcc, 0xcb, 0xcc, 0xc9, 0xcb, 0xca, 0xcb, 0xca, 0xca, 0xcb, 0xca, 0xca, 0xcb, 0xcc, 0xd0, 0xd5, 0xdd, 0xdd, 0xda, 0xda, 0xd9, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xdd, 0xda, 0xd4, 0xcd, 0xcb, 0xcb, 0xcc, 0xf2, 0xcc, 0xd0, 0xd2, 0xd4, 0xd5, 0xd6, 0xd8, 0xd8, 0xd8, 0xab, 0xeb, 0xd3, 0xd0, 0xcf, 0xcf, 0xd0, 0xd1, 0xd4, 0xda, 0xdd, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xee, 0xc5, 0x81, 0x00, 0x00, 0x00, 0x76, 0x74, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xde, 0xee, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xd9, 0xdc, 0xda, 0xab, 0xd2, 0xcd, 0xcb, 0xce, 0xce, 0xcf, 0xd0, 0xd4, 0xd6, 0xd6, 0xd6, 0xd8, 0xd5, 0xeb, 0xd2, 0xd0, 0xcb, 0xcb, 0xca, 0xca, 0xca, 0xcf, 0xeb, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xee, 0xeb, 0xcc, 0xcb, 0xcb, 0xcb, 0xf2, 0xd0, 0xeb, 0xd9, 0xd9, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd5, 0xd0, 0xcf, 0xd0, 0xd2, 0xd8, 0xda, 0xda, 0xd9, 0xd9, 0xdc, 0xf0, 0xc1, 0x00, 0x00, 0x74, 0x00, 0x76, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x74, 0x00, 0x76, 0x74, 0x00, 0x00, 0x00, 0xba, 0xd8, 0xe0, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0xdc, 0xd4, 0xd0, 0xcf, 0xce, 0xcf, 0xd0, 0xd6, 0xd9, 0xdd, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdd, 0xd9, 0xd6, 0xd4, 0xd0, 0xcb, 0xcb, 0xcb, 0xcc, 0xcf, 0xd5, 0xdd, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xde, 0xd9, 0xdd, 0xd8, 0xd0, 0xa1, 0x9f, 0x7a, 0xce, 0xa9, 0xd8, 0xdb, 0xdc, 0xd9, 0xf7, 0xf7, 0xf7, 0xf7, 0xd9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xda, 0xd9, 0xf7, 0xf7, 0xf7, 0xeb, 0xf4, 0xcf, 0xd1, 0xd5, 0xda, 0xdc, 0xdc, 0xee, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x74, 0x00, 0x00, 0x00, 0x84, 0xce, 0x73, 0xda, 0xda, 0xdb, 0xda, 0xd0, 0xcf, 0xa2, 0xce, 0xd2, 0xd7, 0xdc, 0xdb, 0xaf, 0xb0, 0xd7, 0xb0, 0xaf, 0xb0, 0xaf, 0xb0, 0xaf, 0xd9, 0xf7, 0xf7, 0xdc, 0xf7, 0xd9, 0xd2, 0xcb, 0xcb, 0xcc, 0xcb, 0xeb, 0xda, 0xda, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdd, 0xd9, 0xda, 0xda, 0xd0, 0xa1, 0xcc, 0xcc, 0xa7, 0xd9, 0xda, 0xaf, 0xd8, 0xd9, 0xd9, 0xda, 0x6c, 0xda, 0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xf7, 0xd9, 0xf7, 0xd9, 0xf7, 0xf7, 0xf7, 0xf7, 0xd6, 0xd3, 0xa4, 0xa7, 0xeb, 0x73, 0xee, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xc7, 0xf0, 0xdc, 0xdb, 0xd0, 0xa7, 0xd0, 0xa2, 0xd5, 0xdb, 0xda, 0xd7, 0xd9, 0xd9, 0xaf, 0xaf, 0xaf, 0xb0, 0xaf, 0xb0, 0xaf, 0xaf, 0xf7, 0xd9, 0xf7, 0xf7, 0xd9, 0xf7, 0xda, 0xd7, 0xd0, 0xcb, 0xcb, 0xcb, 0xd2, 0xde, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xde, 0xd9, 0xce, 0xcc, 0xcb, 0xd1, 0xac, 0xda, 0xaf, 0xd9, 0xd9, 0xd9, 0xaf, 0xd9, 0xb0, 0xb0, 0xb0, 0xaf, 0xb0, 0xaf, 0xb0, 0xb0, 0xb0, 0xb0, 0xaf, 0xd9, 0xd9, 0xf7, 0xd9, 0xf7, 0xf7, 0xd6, 0xd1, 0xa4, 0xd2, 0xd5, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x96, 0x73, 0xd3, 0xd0, 0xd0, 0xd1, 0xdc, 0xda, 0xd8, 0xd8, 0xda, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xd9, 0xf7, 0xf7, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xf7, 0xd9, 0xd8, 0xcf, 0xcb, 0xca, 0xcf, 0xda, 0xdd, 0xda, 0xd9, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xde, 0xd9, 0xcf, 0xf2, 0xcc, 0xd2, 0xd9, 0xdc, 0xd7, 0xd8, 0xaf, 0xd9, 0xb0, 0xd9, 0xb0, 0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xb0, 0xb0, 0xd9, 0xd9, 0xf7, 0xda, 0xd8, 0xda, 0xd8, 0xd3, 0xf7, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x74, 0x00, 0xe1, 0xbd, 0xd7, 0xa4, 0xd5, 0xdb, 0xd9, 0xd7, 0xd8, 0xda, 0xd8, 0xec, 0x6e, 0xfe, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xd9, 0xaf, 0xd9, 0xb0, 0xda, 0xd9, 0xd9, 0xd8, 0xd8, 0xd9, 0xda, 0xd8, 0xd1, 0xca, 0xce, 0xd1, 0xda, 0xdd, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xd8, 0xd1, 0xcb, 0xcb, 0xd4, 0xda, 0xda, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xaf, 0xd9, 0xd9, 0xf7, 0xf7, 0xfe, 0xfe, 0xf7, 0xfe, 0xfe, 0xfe, 0xf7, 0xf7, 0xaf, 0xb0, 0xaf, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdc, 0xd6, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x02, 0x74, 0x00, 0x00, 0xbd, 0xd9, 0xda, 0xd8, 0xd8, 0xd9, 0xda, 0xd9, 0xd9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xd9, 0xda, 0xaf, 0xb0, 0xda, 0xaf, 0xda, 0xb0, 0xaf, 0xd9, 0xd9, 0xda, 0xd9, 0x6c, 0xd9, 0xdc, 0xd1, 0xcb, 0xcc, 0xd1, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xdd, 0xda, 0xdd, 0xda, 0xd1, 0xcc, 0xce, 0xd4, 0xda, 0xf7, 0xd9, 0x6c, 0xd9, 0xf7, 0xd7, 0xd9, 0xda, 0xd7, 0xd9, 0xda, 0xec, 0x6c, 0x6c, 0xfe, 0x6e, 0xf7, 0xf7, 0xf7, 0xd9, 0xd9, 0xdc, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xef, 0xbb, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xbf, 0xee, 0xd9, 0xd8, 0xdd, 0xd8, 0xda, 0xda, 0xb0, 0xb0, 0xd7, 0xda, 0xd9, 0xd8, 0xb0, 0xb0, 0xb0, 0xac, 0xd9, 0xd9, 0xaf, 0xd9, 0xb0, 0xb0, 0xd9, 0xd9, 0xf7, 0xf7, 0xd9, 0xd9, 0xd8, 0xd2, 0xcb, 0xce, 0xd4, 0xee, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xdc, 0xeb, 0xd0, 0xcb, 0xd3, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xda, 0xd8, 0xd9, 0xf7, 0xda, 0xb0, 0xb0, 0xd9, 0xd9, 0xd9, 0xdc, 0xd9, 0xd9, 0xb0, 0xb0, 0xd9, 0xd9, 0xd9, 0xda, 0xaf, 0xd8, 0xdb, 0xef, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xc3, 0xee, 0xd8, 0xd8, 0xd9, 0xd6, 0xd9, 0xac, 0xae, 0xdb, 0xdb, 0xd9, 0xd9, 0xd8, 0xb0, 0xb0, 0xaf, 0xf7, 0xf7, 0xd9, 0xd8, 0xdb, 0xaf, 0xb0, 0xf7, 0xf7, 0xf7, 0xd9, 0xd9, 0xda, 0xd6, 0xd2, 0xcc, 0xd1, 0xd5, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xdd, 0xd8, 0xce, 0xce, 0xd2, 0xd9, 0xd9, 0xd9, 0xd8, 0xb0, 0xd8, 0xd8, 0xd9, 0xd8, 0xf7, 0xf7, 0xf7, 0x6c, 0xd9, 0xd8, 0xda, 0xf8, 0xff, 0xf7, 0xff, 0xde, 0xdc, 0xdc, 0xf7, 0x6e, 0xf7, 0xf7, 0xd8, 0xda, 0xde, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xc9, 0x73, 0xab, 0xd9, 0xf7, 0xd8, 0xaf, 0xaf, 0x6c, 0x6c, 0x6f, 0xff, 0x70, 0x70, 0xfe, 0x6e, 0xfe, 0x6e, 0x6c, 0xd8, 0xda, 0xb0, 0xd9, 0xd9, 0xf7, 0xf7, 0xd9, 0xd8, 0xda, 0xda, 0xd6, 0xcf, 0xce, 0xcf, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xdd, 0xd3, 0xf2, 0xcc, 0xd8, 0xd9, 0xd8, 0xd8, 0xd7, 0xb0, 0xaf, 0xb0, 0xd8, 0xf7, 0xd9, 0xf6, 0xf7, 0xff, 0x70, 0x6f, 0x6b, 0x62, 0x5b, 0x57, 0x5b, 0x5d, 0x68, 0x70, 0x70, 0xfe, 0xf7, 0x6c, 0xd9, 0xee, 0xa9, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x74, 0x00, 0x79, 0xeb, 0xde, 0xab, 0xd9, 0xd9, 0x6c, 0xfe, 0x70, 0x6b, 0x62, 0x5b, 0x5b, 0x5b, 0x62, 0x6b, 0x6f, 0x71, 0xfe, 0xec, 0xd8, 0xaf, 0xd9, 0xd9, 0xf7, 0xd9, 0xf7, 0xd9, 0xd9, 0xd9, 0xda, 0xd3, 0xcf, 0xcf, 0xd4, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xdd, 0xeb, 0xd0, 0xcf, 0xeb, 0xd8, 0xd9, 0xd8, 0xd8, 0xd7, 0xb0, 0xd7, 0xaf, 0xd9, 0xf7, 0x6e, 0xfe, 0x6f, 0x61, 0x56, 0x4e, 0x39, 0x40, 0x3f, 0x48, 0x45, 0x42, 0x42, 0x4e, 0x57, 0x64, 0x6f, 0x6e, 0xec, 0xd6, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x08, 0xde, 0xf7, 0xd8, 0xfe, 0x6d, 0x5b, 0x50, 0x3e, 0x44, 0x46, 0x42, 0x42, 0x46, 0x44, 0x50, 0x59, 0x6d, 0xff, 0xd9, 0xd9, 0xb0, 0xd9, 0xd9, 0xf7, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xda, 0xd1, 0xcf, 0xd0, 0xd6, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xdd, 0xd2, 0xce, 0xd0, 0xd8, 0xd8, 0xd9, 0xd9, 0xd8, 0xf7, 0x6c, 0xae, 0xae, 0xae, 0x6c, 0x70, 0x6b, 0x56, 0x46, 0x45, 0x45, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4a, 0x4a, 0x51, 0x5d, 0x6d, 0xee, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x7b, 0x00, 0xbf, 0xff, 0x70, 0x65, 0x4e, 0x44, 0x46, 0x4a, 0x4e, 0x4a, 0x4e, 0x4e, 0x4c, 0x4a, 0x4a, 0x44, 0x51, 0x62, 0x70, 0xf7, 0xd9, 0xd8, 0xec, 0x6c, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xeb, 0xce, 0xd0, 0xd3, 0xdc, 0xd9, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xdc, 0xd8, 0xcf, 0xcf, 0xeb, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xfe, 0xf6, 0xdb, 0xac, 0xb0, 0x6f, 0x62, 0x4e, 0x40, 0x45, 0x49, 0x48, 0x49, 0x49, 0x49, 0x4c, 0x4c, 0x4c, 0x4f, 0x4f, 0x4f, 0x4e, 0x4b, 0x5f, 0xbf, 0x00, 0x74, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x74, 0x00, 0x76, 0x7b, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x76, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x58, 0x62, 0x3e, 0x46, 0x4a, 0x49, 0x49, 0x4c, 0x4a, 0x4a, 0x4a, 0x49, 0x4f, 0x49, 0x4c, 0x46, 0x44, 0x5b, 0x70, 0xf7, 0xdd, 0xf6, 0xf8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd1, 0xf2, 0xd1, 0xd8, 0xdc, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xcc, 0xd0, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0x6c, 0xf7, 0xd8, 0xaf, 0xfe, 0x61, 0x44, 0x42, 0x4a, 0x45, 0x49, 0x48, 0x49, 0x49, 0x49, 0x4c, 0x4c, 0x4c, 0x4c, 0x4f, 0x4f, 0x4e, 0x52, 0x4d, 0xe1, 0x00, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x7b, 0x76, 0x00, 0xfa, 0x47, 0x47, 0x46, 0x4a, 0x49, 0x4c, 0x49, 0x4c, 0x4a, 0x4a, 0x4c, 0x49, 0x4c, 0x4a, 0x45, 0x4e, 0x41, 0x5b, 0x71, 0xf7, 0xdc, 0xd7, 0xf7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd5, 0xcb, 0xd0, 0xeb, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xd2, 0xcf, 0xd2, 0xda, 0xd8, 0xd9, 0xd8, 0xd8, 0xd9, 0xd6, 0xdd, 0xd5, 0x70, 0x61, 0x46, 0x44, 0x48, 0x48, 0x48, 0x49, 0x48, 0x49, 0x49, 0x49, 0x4c, 0x4c, 0x4f, 0x4f, 0x4f, 0x4f, 0x51, 0x52, 0xb5, 0x00, 0x74, 0x00, 0x01, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x7b, 0x0f, 0x4b, 0x46, 0x4a, 0x4c, 0x4c, 0x4c, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x4c, 0x4c, 0x4a, 0x4a, 0x46, 0x47, 0x65, 0xff, 0xd9, 0xb0, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xdd, 0xd8, 0xcf, 0xce, 0xd4, 0xdc, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd8, 0xcf, 0xd0, 0xeb, 0xda, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xd9, 0xfe, 0x6b, 0x51, 0x42, 0x48, 0x48, 0x48, 0x48, 0x49, 0x48, 0x49, 0x49, 0x4c, 0x4c, 0x49, 0x45, 0x43, 0x43, 0x45, 0x46, 0x31, 0x09, 0x00, 0xf9, 0x74, 0x00, 0x76, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x79, 0xb6, 0xb9, 0xbb, 0xbd, 0xe9, 0xbb, 0xb9, 0x08, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe6, 0xb6, 0xba, 0xe9, 0xbb, 0xe8, 0xb9, 0xb5, 0xe4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x74, 0x7b, 0x76, 0xf9, 0x09, 0x31, 0x4e, 0x46, 0x49, 0x4c, 0x48, 0x4c, 0x4a, 0x4a, 0x49, 0x4c, 0x4c, 0x49, 0x4f, 0x49, 0x4a, 0x42, 0x52, 0x6d, 0xf7, 0xb0, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd2, 0xce, 0xd3, 0xd9, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xd9, 0xdc, 0xda, 0xdd, 0xd3, 0xd0, 0xcf, 0xd6, 0xda, 0xd8, 0xd8, 0xd9, 0xd8, 0xd9, 0xd7, 0xd8, 0x70, 0x5b, 0x42, 0x45, 0x48, 0x4c, 0x48, 0x48, 0x49, 0x48, 0x48, 0x4c, 0x45, 0x3f, 0x3b, 0x3b, 0x3b, 0x39, 0x39, 0x3e, 0x0c, 0xf9, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x76, 0x01, 0x74, 0x00, 0x00, 0x00, 0x76, 0xb6, 0xbe, 0xc8, 0xcf, 0xd4, 0xeb, 0xd6, 0xab, 0xd6, 0xab, 0xeb, 0xd3, 0xcb, 0xc1, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x76, 0x00, 0x00, 0x00, 0x84, 0xbc, 0xc7, 0xd1, 0xd4, 0xeb, 0xab, 0xd6, 0xd6, 0xd4, 0xd3, 0xd0, 0xc7, 0xbf, 0xb7, 0x76, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0xf9, 0x00, 0x74, 0x76, 0x00, 0x09, 0xf9, 0x0d, 0x44, 0x32, 0x39, 0x35, 0x3b, 0x3f, 0x45, 0x49, 0x4e, 0x4c, 0x4c, 0x4c, 0x49, 0x4c, 0x4c, 0x4a, 0x42, 0x5d, 0xff, 0xb0, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xdc, 0xf5, 0xce, 0xd0, 0xd8, 0xdc, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xdc, 0xda, 0xdd, 0xd3, 0xcf, 0xd0, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd7, 0xed, 0x6b, 0x51, 0x45, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x45, 0x48, 0x45, 0x3b, 0x37, 0x3b, 0x3d, 0x3b, 0x3d, 0x3d, 0x42, 0x17, 0x09, 0xf9, 0x74, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x04, 0xbd, 0xcc, 0xd5, 0xd6, 0xd4, 0xd3, 0xd2, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xd3, 0xeb, 0xab, 0xc7, 0xb5, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xe4, 0xc0, 0xeb, 0xd6, 0xeb, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xcf, 0xd0, 0xd4, 0xab, 0xd5, 0xcf, 0xbe, 0x05, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x00, 0xf9, 0xf9, 0x76, 0x00, 0x74, 0xf9, 0x09, 0x22, 0x3e, 0x34, 0x3f, 0x3b, 0x34, 0x34, 0x40, 0x45, 0x49, 0x4f, 0x49, 0x49, 0x49, 0x4c, 0x4c, 0x45, 0x52, 0x6f, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdc, 0xd4, 0xcf, 0xcf, 0xd8, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xdc, 0xd1, 0xcf, 0xd1, 0xd8, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd9, 0xd9, 0xfe, 0x62, 0x44, 0x45, 0x48, 0x48, 0x45, 0x48, 0x48, 0x4f, 0x43, 0x3b, 0x39, 0x3b, 0x3f, 0x3b, 0x3b, 0x3b, 0x40, 0x3e, 0x0d, 0x00, 0x00, 0x7b, 0x7b, 0x74, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x74, 0x00, 0x7b, 0xbb, 0xa2, 0xab, 0xd3, 0xd1, 0xa7, 0xd0, 0xa4, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xa4, 0xd1, 0x78, 0xf5, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xb5, 0xc8, 0xd5, 0xd3, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd1, 0xd1, 0xd0, 0xa4, 0xd1, 0xcf, 0xa2, 0xd0, 0xd0, 0xa7, 0xd5, 0xd0, 0xbe, 0x03, 0x00, 0x76, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x00, 0xf9, 0xf9, 0x00, 0x74, 0x74, 0x09, 0x09, 0x0c, 0x3e, 0x3a, 0x39, 0x37, 0x3d, 0x39, 0x39, 0x3d, 0x43, 0x4c, 0x4f, 0x4a, 0x4a, 0x4c, 0x4c, 0x4a, 0x44, 0x68, 0xf7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xda, 0xeb, 0xcf, 0xcf, 0xd6, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd0, 0xcf, 0xd3, 0xda, 0xd6, 0xda, 0xd8, 0xd9, 0xd8, 0xd8, 0xd9, 0xf7, 0x57, 0x42, 0x4a, 0x45, 0x46, 0x48, 0x46, 0x48, 0x43, 0x3d, 0x37, 0x3f, 0x37, 0x3f, 0x3b, 0x3d, 0x3b, 0x45, 0x17, 0xf9, 0xf9, 0x7b, 0x7b, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x76, 0x74, 0x00, 0xb5, 0xcc, 0xd8, 0xd2, 0xd0, 0xd1, 0xd0, 0xcf, 0xd0, 0xd1, 0xd1, 0xd0, 0xa4, 0xd0, 0xa4, 0xd0, 0xa2, 0xd0, 0xd1, 0xa2, 0xd1, 0xd2, 0xce, 0xdc, 0xc1, 0x01, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0xb7, 0xd4, 0xd6, 0xcf, 0xcf, 0xcf, 0xd0, 0xd1, 0xd0, 0xd0, 0xcf, 0xd0, 0xd0, 0xd1, 0xa2, 0xd2, 0xd0, 0xa2, 0xd0, 0xd0, 0xd0, 0xa7, 0xeb, 0x78, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x7b, 0x7b, 0x00, 0xf9, 0xf9, 0x00, 0x01, 0x7b, 0x00, 0x00, 0x09, 0x1f, 0x3e, 0x39, 0x3d, 0x37, 0x39, 0x3d, 0x39, 0x35, 0x43, 0x48, 0x4a, 0x46, 0x49, 0x48, 0x4f, 0x42, 0x5b, 0xfe, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xd8, 0xd9, 0xd6, 0xd0, 0xce, 0xd5, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xcf, 0xcf, 0xd3, 0xda, 0xd8, 0xd9, 0xd8, 0xd8, 0xd8, 0xd9, 0xda, 0x6f, 0x54, 0x3a, 0x4a, 0x45, 0x4a, 0x4a, 0x48, 0x45, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3d, 0x40, 0x0c, 0xf9, 0x74, 0x7b, 0x7b, 0x7b, 0x7b, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xbd, 0x78, 0xd3, 0xa4, 0xd0, 0xa7, 0xd0, 0xa4, 0xd1, 0xa7, 0xd1, 0xa4, 0xd0, 0xd0, 0xd0, 0xa4, 0xd1, 0xa2, 0xd1, 0xa2, 0xd1, 0xd1, 0xcf, 0x75, 0xd1, 0xeb, 0xc0, 0x00, 0x74, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xf2, 0xd4, 0xcf, 0xd1, 0xd0, 0xcf, 0xd2, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xa4, 0xd0, 0xd1, 0xd1, 0xa2, 0xd1, 0xd0, 0xcf, 0xd1, 0xd0, 0x6a, 0xc2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x00, 0xf9, 0xf9, 0x74, 0x7b, 0x76, 0x00, 0xf9, 0x09, 0x0d, 0x3e, 0x32, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3b, 0x3b, 0x3f, 0x46, 0x4e, 0x49, 0x4c, 0x48, 0x46, 0x56, 0x70, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xda, 0xd8, 0xda, 0xd6, 0xd0, 0xf2, 0xd5, 0xda, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xd8, 0xdd, 0xd9, 0xd0, 0xcf, 0xd3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0x6c, 0x6f, 0x4b, 0x46, 0x45, 0x4c, 0x45, 0x49, 0x45, 0x3b, 0x39, 0x3d, 0x3d, 0x39, 0x3b, 0x43, 0x3b, 0x39, 0x42, 0x22, 0xf9, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x74, 0x00, 0x74, 0x76, 0x00, 0x02, 0xc1, 0xaf, 0xd2, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xeb, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x74, 0x00, 0x00, 0x00, 0xcf, 0xd3, 0xcf, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0x75, 0xd6, 0xce, 0xe7, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x09, 0x25, 0x40, 0x3d, 0x39, 0x3a, 0x3a, 0x3a, 0x39, 0x43, 0x3b, 0x42, 0x4a, 0x49, 0x4c, 0x4c, 0x44, 0x52, 0x70, 0xd9, 0xd8, 0xd8, 0xd9, 0xd8, 0xd9, 0xd8, 0xda, 0xd8, 0xd1, 0xce, 0xab, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdd, 0xda, 0xd1, 0xcf, 0xd4, 0xda, 0xd9, 0xd8, 0xd8, 0xd9, 0xd8, 0xd9, 0xf7, 0x6b, 0x4b, 0x46, 0x48, 0x48, 0x48, 0x48, 0x3f, 0x39, 0x3b, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3a, 0x42, 0x0d, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x01, 0x00, 0x00, 0x02, 0xc3, 0xd7, 0xd1, 0xa4, 0xd0, 0xa4, 0xd0, 0xa4, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xa4, 0xd0, 0xd0, 0xd0, 0xd0, 0xa4, 0xd0, 0xa4, 0xd0, 0x75, 0xd0, 0x75, 0xd0, 0x78, 0xcb, 0xe4, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xbe, 0xd6, 0xce, 0xd1, 0xd0, 0xd0, 0xd0, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xce, 0xd4, 0xce, 0xd5, 0xd2, 0xb7, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0xf9, 0x0f, 0x42, 0x3d, 0x3d, 0x39, 0x3a, 0x3a, 0x3d, 0x3b, 0x3d, 0x40, 0x45, 0x49, 0x4c, 0x4c, 0x46, 0x51, 0x70, 0xd8, 0xd9, 0xd9, 0xd8, 0xd8, 0xda, 0xd8, 0xda, 0xd8, 0xd1, 0xce, 0xd6, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xd1, 0xcf, 0xd3, 0xd9, 0xd8, 0xd9, 0xd8, 0xd8, 0xd9, 0xd8, 0xf7, 0x6b, 0x47, 0x45, 0x48, 0x48, 0x48, 0x45, 0x39, 0x39, 0x3d, 0x3d, 0x3d, 0x39, 0x3b, 0x3b, 0x3b, 0x42, 0x2f, 0x0a, 0xf9, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x76, 0x00, 0x02, 0x00, 0x96, 0xda, 0xce, 0xd0, 0xa4, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd0, 0xa4, 0xd0, 0xa4, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0x75, 0xd0, 0xd0, 0xcf, 0xd6, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0xe6, 0xcf, 0xcf, 0xd1, 0xcf, 0xce, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xcf, 0xd1, 0xd1, 0xd2, 0xd6, 0xb6, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xf9, 0x0b, 0x3a, 0x40, 0x3d, 0x39, 0x3a, 0x3d, 0x39, 0x3b, 0x3f, 0x39, 0x40, 0x48, 0x4c, 0x48, 0x46, 0x4b, 0x6f, 0xd9, 0xd8, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd6, 0xd0, 0xcf, 0xd8, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xd3, 0xd0, 0xd3, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xd8, 0xf7, 0x6b, 0x4b, 0x46, 0x48, 0x48, 0x48, 0x3f, 0x39, 0x3d, 0x3d, 0x3d, 0x39, 0x3b, 0x3b, 0x3b, 0x3d, 0x42, 0x10, 0x09, 0xf9, 0x74, 0x00, 0x74, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x76, 0x00, 0xc0, 0xda, 0xce, 0xd3, 0xce, 0xd3, 0xd0, 0xd0, 0xd0, 0xa4, 0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xa4, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xa4, 0xd0, 0x75, 0xd0, 0xd0, 0x75, 0xd0, 0x75, 0xd0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xbf, 0xd2, 0xd2, 0xcc, 0xd2, 0xd1, 0xcf, 0xd0, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0x75, 0xd2, 0xd0, 0xd1, 0xd1, 0xd3, 0xd3, 0xb8, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x00, 0xf9, 0x22, 0x42, 0x3d, 0x40, 0x3d, 0x3d, 0x3f, 0x3b, 0x3d, 0x3a, 0x40, 0x43, 0x48, 0x4c, 0x46, 0x50, 0x6f, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xda, 0xd9, 0xd9, 0xd6, 0xcf, 0xd0, 0xd8, 0xdd, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xd4, 0xd0, 0xd1, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0x6e, 0x6f, 0x4b, 0x45, 0x48, 0x48, 0x45, 0x3f, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3b, 0x3f, 0x3d, 0x3e, 0x0d, 0xf9, 0xf9, 0x00, 0x00, 0x74, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0xe8, 0xeb, 0x75, 0xd0, 0xd1, 0xa7, 0xa2, 0xd0, 0xd0, 0xa4, 0xd0, 0xd1, 0xd0, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xa4, 0xd0, 0xd0, 0xd0, 0xd0, 0x75, 0xd0, 0xd0, 0xd0, 0xd1, 0xd2, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x76, 0x00, 0x00, 0xcb, 0xd1, 0xd1, 0xd0, 0xce, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0x75, 0xd2, 0xd3, 0xd2, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x74, 0x00, 0x0e, 0x42, 0x3a, 0x3d, 0x3d, 0x3f, 0x3d, 0x3f, 0x39, 0x40, 0x40, 0x3f, 0x48, 0x4c, 0x44, 0x52, 0x6f, 0xd9, 0xd8, 0xd8, 0xd9, 0xd8, 0xda, 0xd8, 0xd9, 0xd6, 0xcf, 0xcf, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xdc, 0xab, 0xd1, 0xd0, 0xd6, 0xd6, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd9, 0x6f, 0x54, 0x44, 0x45, 0x48, 0x43, 0x39, 0x3d, 0x3d, 0x3d, 0x39, 0x3b, 0x39, 0x3d, 0x39, 0x42, 0x1f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x00, 0x08, 0xd8, 0xd2, 0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0xa7, 0xcf, 0xa7, 0xd1, 0xa4, 0xd1, 0xd1, 0xa4, 0xcf, 0xa4, 0xd3, 0xa2, 0xd1, 0xd1, 0xd0, 0xd0, 0x75, 0xd0, 0x75, 0xd0, 0xcf, 0xd1, 0xd4, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xd4, 0x75, 0xcf, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xd0, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xcf, 0xd2, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd1, 0xd2, 0x75, 0xd1, 0xd6, 0xc9, 0xe3, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0xf9, 0x0b, 0x38, 0x3a, 0x3f, 0x3d, 0x3f, 0x3d, 0x3f, 0x40, 0x3a, 0x39, 0x3b, 0x45, 0x48, 0x44, 0x57, 0xfe, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd9, 0xd9, 0xda, 0xd2, 0xcd, 0xd2, 0xd9, 0xdd, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xdc, 0xd8, 0xd0, 0xd0, 0xeb, 0xda, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xfe, 0x5b, 0x2f, 0x4a, 0x45, 0x43, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x39, 0x42, 0x0f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc7, 0xeb, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xa4, 0xd0, 0xd1, 0xa4, 0xd0, 0xd0, 0xd1, 0xcf, 0xcf, 0xa7, 0xd1, 0xd3, 0xd3, 0xd2, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0x75, 0xd0, 0x75, 0xd1, 0xcf, 0xd2, 0xc8, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0xe8, 0xd5, 0xcf, 0xcf, 0xcf, 0xd0, 0xcf, 0xd0, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd3, 0xd3, 0xd2, 0xd2, 0xd1, 0xd1, 0xd0, 0xcf, 0xd1, 0xd1, 0xd1, 0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0xd1, 0xd1, 0xce, 0xd8, 0xc0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0xf9, 0x09, 0x22, 0x42, 0x3d, 0x3f, 0x3b, 0x3f, 0x3d, 0x3d, 0x3a, 0x40, 0x3b, 0x43, 0x4f, 0x3e, 0x5f, 0xfe, 0xd9, 0xd8, 0xd8, 0xd9, 0xd8, 0xd8, 0xda, 0xd9, 0xd2, 0xcb, 0xd4, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd2, 0xd0, 0xd3, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd9, 0xac, 0xda, 0x6b, 0x47, 0x46, 0x48, 0x3f, 0x39, 0x39, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3a, 0x3e, 0x0b, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xd8, 0xcf, 0xd1, 0xd0, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xa4, 0xcf, 0xa4, 0xd6, 0xaf, 0xee, 0xdf, 0xdf, 0xee, 0xdb, 0xd9, 0xd5, 0xd3, 0xd1, 0xa2, 0x75, 0xd0, 0xd0, 0x75, 0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xd4, 0xcf, 0xcf, 0xcf, 0xd0, 0xd0, 0xcf, 0xd0, 0xd0, 0xcf, 0xd0, 0xd2, 0xd3, 0xd9, 0xde, 0xdd, 0xe0, 0xf0, 0xde, 0xda, 0xd8, 0xd3, 0xd1, 0xd1, 0xd1, 0xd0, 0xd1, 0xd0, 0xd0, 0xd1, 0xd0, 0xd1, 0xcf, 0xd2, 0x75, 0xd9, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x10, 0x42, 0x3d, 0x3d, 0x3f, 0x40, 0x3f, 0x40, 0x3a, 0x40, 0x3d, 0x45, 0x42, 0x4b, 0x6e, 0xda, 0xd8, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xda, 0xd6, 0xd0, 0xce, 0xd8, 0xde, 0xd8, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xd6, 0xd0, 0xd0, 0xd6, 0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xac, 0xac, 0x6f, 0x5b, 0x40, 0x46, 0x3f, 0x3d, 0x39, 0x3b, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x40, 0x25, 0x0a, 0x00, 0x7c, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xda, 0xcf, 0xf5, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd0, 0xa7, 0xd0, 0xd8, 0xe0, 0xdf, 0xd8, 0xa2, 0xc9, 0xc8, 0xca, 0xa7, 0xee, 0xdf, 0xda, 0xd4, 0xa7, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0x06, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0xc7, 0xd1, 0xcf, 0xcf, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xd0, 0xd2, 0xd9, 0xef, 0xee, 0xeb, 0xd1, 0xca, 0xcb, 0xd9, 0xe0, 0xf0, 0xdf, 0xd8, 0xd2, 0xd2, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0x75, 0xd4, 0xd0, 0xd1, 0xd0, 0xd2, 0xc9, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x74, 0x00, 0x0c, 0x44, 0x3d, 0x3f, 0x3d, 0x40, 0x3f, 0x40, 0x40, 0x40, 0x3f, 0x3f, 0x3a, 0x5d, 0xfe, 0xac, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd9, 0xd9, 0xd4, 0xcf, 0xd2, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xd1, 0xd0, 0xd4, 0xd9, 0xd8, 0xd9, 0xd8, 0xd8, 0xac, 0xac, 0x6d, 0x6f, 0x52, 0x42, 0x42, 0x3d, 0x3f, 0x3b, 0x3b, 0x3b, 0x3d, 0x3d, 0x39, 0x42, 0x10, 0xf9, 0x7b, 0x7c, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xd6, 0xf3, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xa7, 0xa4, 0xa2, 0xd5, 0xdf, 0xd6, 0xc3, 0xb8, 0x79, 0xe1, 0x00, 0x00, 0x76, 0xe3, 0xb9, 0xc1, 0xd5, 0xee, 0xd8, 0xd0, 0xcf, 0xcf, 0xd1, 0xcf, 0xd1, 0xce, 0xd0, 0xd3, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc9, 0xd0, 0x75, 0xcf, 0xcf, 0xd0, 0xcf, 0xf4, 0xcf, 0xd0, 0xd6, 0xe0, 0xd1, 0xc0, 0xb6, 0x81, 0x02, 0x76, 0x02, 0xe5, 0xb8, 0xc2, 0xd6, 0xf0, 0xde, 0xab, 0xd0, 0xd2, 0x75, 0xd1, 0xd0, 0xd2, 0x75, 0xd1, 0x75, 0xd0, 0x75, 0xf7, 0xe8, 0x00, 0x76, 0x76, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x7b, 0xf9, 0x09, 0x44, 0x40, 0x3b, 0x40, 0x3d, 0x43, 0x40, 0x40, 0x3a, 0x40, 0x29, 0x56, 0x6f, 0xd8, 0xac, 0xd8, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8, 0xd2, 0xcf, 0xd5, 0xdc, 0xd9, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xdc, 0xdc, 0xd5, 0xd1, 0xd0, 0xd8, 0xd8, 0xd8, 0xd9, 0xd6, 0xab, 0xf7, 0xf6, 0x6f, 0x6b, 0x54, 0x3e, 0x3a, 0x3f, 0x3b, 0x43, 0x3b, 0x3b, 0x3b, 0x3a, 0x38, 0x0d, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x84, 0xd0, 0xd2, 0xd1, 0xd0, 0xd1, 0xd2, 0xd0, 0xd0, 0xcf, 0xa7, 0xa2, 0xa5, 0xae, 0xac, 0xc0, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xbc, 0x78, 0xaf, 0xa4, 0xd1, 0xa2, 0xd1, 0xce, 0xd0, 0xcf, 0xd4, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcb, 0xd2, 0xcf, 0xa2, 0xcf, 0xa2, 0xd0, 0x75, 0xd0, 0xeb, 0xa9, 0xbe, 0x7e, 0x7b, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc0, 0xdf, 0xe0, 0xd9, 0xcf, 0x78, 0xd0, 0xd1, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0xd3, 0xc9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7b, 0x7b, 0x7b, 0x00, 0x30, 0x40, 0x43, 0x3f, 0x40, 0x43, 0x3b, 0x45, 0x3a, 0x30, 0x50, 0x6d, 0xfe, 0xd6, 0xaf, 0xd8, 0xd9, 0xd9, 0xd8, 0xd9, 0xda, 0xeb, 0xce, 0xd2, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xd2, 0xcf, 0xeb, 0xd8, 0xd8, 0xd6, 0xd8, 0xd8, 0xd8, 0xab, 0xab, 0x6e, 0x6d, 0x59, 0x3e, 0x2c, 0x39, 0x3d, 0x39, 0x3b, 0x40, 0x32, 0x38, 0x0b, 0x00, 0x01, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x74, 0x00, 0xbe, 0xd6, 0xcf, 0xd0, 0xcf, 0xd2, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xa7, 0xa9, 0xb1, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x00, 0x7b, 0x7e, 0x83, 0x85, 0x85, 0x7c, 0x00, 0x80, 0xc2, 0xb2, 0xa2, 0xce, 0xd0, 0xa2, 0xcf, 0xf2, 0xd5, 0xb9, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xe4, 0xcf, 0xd0, 0xd0, 0xa2, 0xd0, 0xa2, 0xd0, 0xcf, 0xd8, 0xa7, 0x85, 0x00, 0x00, 0x7c, 0x80, 0x05, 0x88, 0xb4, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xd8, 0xf0, 0xda, 0x75, 0xd0, 0xd1, 0xd0, 0xd1, 0xd0, 0xd0, 0xd1, 0xd0, 0xf4, 0xeb, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x7c, 0x74, 0x00, 0x24, 0x40, 0x3b, 0x39, 0x40, 0x40, 0x40, 0x2b, 0x30, 0x52, 0x6b, 0xfe, 0x6a, 0xdd, 0xd5, 0xd8, 0xd9, 0xd6, 0xd8, 0xd9, 0xd8, 0xd4, 0xcf, 0xeb, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xd8, 0xd0, 0xd0, 0xd5, 0xd9, 0xd8, 0xd8, 0xac, 0xd5, 0xd7, 0xd7, 0xd6, 0xf7, 0x6d, 0x6b, 0x54, 0x47, 0x25, 0x2f, 0x2f, 0x2f, 0x3e, 0x21, 0x09, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xd0, 0xd0, 0xd1, 0xcf, 0xd3, 0xce, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xf5, 0xf7, 0xb5, 0x00, 0x00, 0x00, 0x76, 0x7c, 0x7c, 0x86, 0x8b, 0x94, 0x99, 0x9a, 0x9c, 0x9b, 0x9b, 0x9b, 0x8c, 0x87, 0xbc, 0xd7, 0xa7, 0x7a, 0xce, 0xcf, 0xce, 0xeb, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xe4, 0xd0, 0x75, 0xd0, 0xcf, 0xa2, 0xd0, 0xa2, 0xa9, 0xc6, 0x7e, 0x80, 0x89, 0x8c, 0x98, 0x98, 0x9d, 0x98, 0x9b, 0x9b, 0x8c, 0x85, 0x7c, 0x7b, 0x7b, 0x00, 0x84, 0xd6, 0xf0, 0xab, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd1, 0xd0, 0xd1, 0xd1, 0xd3, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x74, 0xf9, 0x11, 0x42, 0x42, 0x3a, 0x2f, 0x2f, 0x30, 0x4b, 0x5b, 0x70, 0x6f, 0x6e, 0xd9, 0xeb, 0xaf, 0xd8, 0xd8, 0xd9, 0xda, 0xd9, 0xd4, 0xce, 0xd3, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xd9, 0xdc, 0xdd, 0xeb, 0xcf, 0xd2, 0xd6, 0xd8, 0xd8, 0xd7, 0xac, 0xa9, 0xac, 0xac, 0xd5, 0xda, 0x6e, 0x6d, 0x68, 0x59, 0x54, 0x47, 0x41, 0x31, 0x21, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xab, 0xd1, 0xd1, 0xcc, 0xd2, 0xd0, 0xd0, 0xd0, 0xcf, 0xd0, 0xd3, 0x71, 0xe9, 0x00, 0xf9, 0x00, 0x7b, 0x00, 0x88, 0x8d, 0x94, 0x94, 0x95, 0x95, 0x9c, 0xa6, 0xa6, 0x9e, 0xad, 0xe0, 0xae, 0xc1, 0xc0, 0xd4, 0xce, 0xce, 0xcf, 0xcf, 0xeb, 0xb9, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x75, 0xd1, 0xcf, 0xd0, 0xa2, 0xcf, 0xa7, 0xa8, 0xb4, 0x8a, 0x92, 0x98, 0x9b, 0x9b, 0x9b, 0xa6, 0xdb, 0xa3, 0x9b, 0x9c, 0x9a, 0x89, 0x7c, 0x7b, 0x7b, 0x00, 0xb8, 0xee, 0xdf, 0x78, 0x75, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xf4, 0xd2, 0xf3, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0x00, 0x00, 0xf9, 0x0d, 0x25, 0x29, 0x30, 0x41, 0x54, 0x5f, 0x6b, 0x6f, 0x6d, 0x6e, 0xf6, 0xf7, 0xdb, 0xd6, 0xd8, 0xd8, 0xd9, 0xd9, 0xd6, 0xd0, 0xd0, 0xd8, 0xdd, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd4, 0xcf, 0xd2, 0xd6, 0xd8, 0xd5, 0xd8, 0xd7, 0xd7, 0xd5, 0xac, 0xeb, 0xd5, 0xf6, 0xeb, 0x6c, 0x6e, 0x6d, 0x6b, 0x6f, 0xe8, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xbe, 0xeb, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xcf, 0xd0, 0xd0, 0xd0, 0xec, 0xea, 0x00, 0xf9, 0x00, 0x7b, 0x7c, 0x8b, 0x97, 0x91, 0x90, 0x9a, 0x9c, 0xa6, 0x90, 0x80, 0x8a, 0xdf, 0xb2, 0xdb, 0xb2, 0xf0, 0x9d, 0xc3, 0xa9, 0xcc, 0xcf, 0xcf, 0xd3, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xf2, 0xd1, 0xd0, 0xce, 0xd0, 0xd0, 0xd1, 0xbf, 0xa9, 0xb2, 0xac, 0x9d, 0x92, 0x83, 0x00, 0xb4, 0xa9, 0xe0, 0x9e, 0x97, 0x89, 0x7f, 0x89, 0x80, 0x00, 0x7b, 0x00, 0xe8, 0xf0, 0xdd, 0xce, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xcf, 0xd0, 0xeb, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x74, 0x00, 0x00, 0xfa, 0x57, 0x5f, 0x65, 0x6f, 0xfe, 0x6e, 0xf6, 0xf6, 0xf6, 0xf6, 0xd8, 0xd5, 0xd6, 0xd9, 0xd6, 0xd8, 0xd9, 0xab, 0xd1, 0xd0, 0xd6, 0xdc, 0xdd, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xd4, 0xcf, 0xf5, 0xd6, 0xf6, 0xd6, 0xf6, 0xd6, 0xd8, 0xab, 0xd5, 0xeb, 0xeb, 0xd4, 0xd5, 0xd4, 0x6a, 0x66, 0xff, 0xb8, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xea, 0xd4, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0xd1, 0xd0, 0xd3, 0xde, 0xb6, 0x00, 0x00, 0x7b, 0x7c, 0x8b, 0x95, 0x91, 0x8f, 0x9c, 0xad, 0xe0, 0x9d, 0x7e, 0x7b, 0x00, 0xbe, 0x73, 0xee, 0xde, 0xb2, 0xe0, 0xc8, 0xcb, 0xa2, 0xcf, 0xcf, 0xd3, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xcb, 0xd2, 0x75, 0xcc, 0xa4, 0xd1, 0x9f, 0xca, 0xf0, 0xb2, 0xe0, 0xb2, 0xb4, 0x00, 0x7b, 0x00, 0xbe, 0xf0, 0xad, 0x8b, 0x7d, 0x86, 0x8f, 0x8d, 0x7e, 0x7b, 0x00, 0x00, 0xd1, 0xf0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xf3, 0xd1, 0xeb, 0xbe, 0x00, 0x76, 0x00, 0x00, 0x00, 0x74, 0x7b, 0x7b, 0x00, 0x00, 0xe1, 0x5e, 0xfe, 0xf7, 0x6a, 0xd6, 0xd6, 0xd6, 0xd8, 0xd6, 0xd8, 0xd7, 0xd8, 0xd8, 0xd6, 0xd9, 0xd9, 0xd8, 0xd2, 0xd0, 0xeb, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xdc, 0xda, 0xd3, 0xcb, 0xd3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xeb, 0xeb, 0xd4, 0xeb, 0xa9, 0xa9, 0xeb, 0xf5, 0xf8, 0x87, 0x00, 0x7b, 0x00, 0xf9, 0x74, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xe2, 0xcc, 0xd3, 0xd0, 0xd1, 0xd0, 0xd0, 0xd1, 0xd1, 0xd0, 0xcf, 0xd9, 0xd0, 0x00, 0x00, 0x00, 0x7b, 0x86, 0x9a, 0x8e, 0x93, 0x9a, 0x9c, 0xb0, 0xb3, 0xc7, 0x00, 0x01, 0x00, 0xe7, 0x71, 0x71, 0xdf, 0xb3, 0xb2, 0xe0, 0xc4, 0xcf, 0xce, 0xcf, 0xd2, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xca, 0xd0, 0xcc, 0xd3, 0xcc, 0xd2, 0xcc, 0xf0, 0x73, 0xde, 0x73, 0xf0, 0xe8, 0x00, 0x00, 0xf9, 0xc9, 0xe0, 0xe0, 0x9e, 0x90, 0x97, 0x91, 0x97, 0x8c, 0x7c, 0x00, 0x00, 0xbb, 0xf0, 0xeb, 0x75, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xd0, 0xf3, 0xd4, 0xc3, 0x00, 0x00, 0x76, 0x74, 0x00, 0x7b, 0x7b, 0x7b, 0x76, 0x00, 0x00, 0xc7, 0xd9, 0xd5, 0xd5, 0xd7, 0xd6, 0xac, 0xd6, 0xd5, 0xd7, 0xd8, 0xd9, 0xd7, 0xd6, 0xda, 0xd6, 0xd1, 0xcf, 0xd4, 0xda, 0xdd, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xdd, 0xd9, 0xd4, 0xce, 0xf5, 0xeb, 0xd8, 0xf6, 0xeb, 0xf6, 0xeb, 0xeb, 0xd4, 0xeb, 0xa8, 0xa9, 0xf5, 0xeb, 0xdd, 0x82, 0x7b, 0x7b, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd2, 0xd2, 0xd0, 0xd1, 0xd0, 0xd1, 0xd1, 0xcf, 0xd0, 0xd0, 0xdd, 0xc1, 0x00, 0x00, 0x7b, 0x7c, 0x90, 0x93, 0x91, 0x9c, 0xad, 0xa2, 0xb2, 0xf0, 0xef, 0x72, 0x00, 0x00, 0xc5, 0xf0, 0xee, 0xdd, 0xdf, 0xb1, 0xf0, 0xcb, 0x9d, 0xcf, 0xcf, 0xcc, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xea, 0xd2, 0x75, 0xce, 0xd0, 0xa1, 0xda, 0x73, 0xde, 0xee, 0xb3, 0xf0, 0xca, 0xe2, 0x00, 0x96, 0xf0, 0xb2, 0xee, 0xe0, 0x9e, 0x8e, 0x91, 0x91, 0x95, 0x80, 0x00, 0x00, 0x84, 0xd8, 0xd9, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xf3, 0xd0, 0xf3, 0xd3, 0xc9, 0x03, 0x00, 0x74, 0x76, 0x00, 0x7b, 0x7b, 0x74, 0xf9, 0x00, 0x00, 0xc2, 0xb1, 0xa9, 0xa9, 0xd6, 0xd6, 0xd5, 0xd6, 0xd6, 0xd5, 0xd6, 0xd6, 0xd8, 0xd8, 0xd6, 0xd0, 0xd0, 0xd4, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdd, 0xda, 0xd4, 0xd0, 0xd1, 0xd4, 0xab, 0xab, 0xd5, 0xeb, 0xd4, 0xd4, 0xa9, 0xa9, 0xa9, 0xd3, 0xd4, 0xda, 0x7e, 0x7c, 0x7b, 0x74, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xd5, 0x75, 0xd1, 0xd0, 0xd0, 0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0xdc, 0xe9, 0x00, 0x00, 0x00, 0x80, 0x99, 0x91, 0x8f, 0xa6, 0xdb, 0xf0, 0xb3, 0xee, 0xee, 0xda, 0xbb, 0xc0, 0xf0, 0xde, 0xde, 0xdf, 0xb2, 0xdf, 0xb3, 0xdd, 0xc7, 0xd0, 0xd0, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x74, 0x76, 0x00, 0xc0, 0xd2, 0xcf, 0xcc, 0xa2, 0xd3, 0xe0, 0xee, 0xee, 0xb3, 0xde, 0xdf, 0xe0, 0x78, 0x78, 0x71, 0xb3, 0xb3, 0xef, 0x71, 0xe0, 0x97, 0x8e, 0x8e, 0x9a, 0x88, 0x00, 0x00, 0x76, 0xce, 0xdc, 0xd0, 0x75, 0xd0, 0xd0, 0xd0, 0xd1, 0xcf, 0xd0, 0xd2, 0xca, 0xe4, 0x00, 0x00, 0x74, 0x00, 0x7b, 0x74, 0xf9, 0xf9, 0xf9, 0x00, 0xbd, 0xe0, 0xa9, 0xd6, 0xf6, 0xd5, 0xf6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xab, 0xa9, 0xd2, 0xd1, 0xeb, 0xdd, 0xdc, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xd9, 0xdc, 0xdc, 0xab, 0x78, 0xd1, 0xd2, 0xd4, 0xeb, 0xeb, 0xa9, 0xd4, 0xa9, 0xd4, 0xa9, 0xf5, 0xeb, 0xd8, 0x7b, 0x7b, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xd6, 0xd1, 0xd1, 0xd1, 0xd0, 0xd1, 0xd0, 0xd2, 0xd1, 0xd2, 0xdd, 0xe8, 0x00, 0x00, 0x00, 0x88, 0x9a, 0x91, 0x8f, 0xad, 0xe0, 0xee, 0xef, 0xb2, 0xe0, 0xee, 0xf0, 0xf0, 0xde, 0xdf, 0xdf, 0xb2, 0xde, 0xb2, 0xdf, 0xdf, 0xc8, 0xcf, 0xd0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x74, 0x00, 0x00, 0xbd, 0xd3, 0xcc, 0xd0, 0xca, 0xdb, 0xee, 0xee, 0xde, 0xb2, 0xb3, 0xb1, 0xdf, 0xe0, 0xe0, 0xb3, 0xb2, 0xb1, 0x71, 0x6f, 0xf0, 0xa6, 0x8e, 0x93, 0x99, 0x8c, 0x00, 0x00, 0x00, 0xea, 0xee, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xf4, 0xcf, 0xf3, 0xd2, 0xcf, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xf9, 0xf9, 0xf9, 0x00, 0xe8, 0xf0, 0xeb, 0xd8, 0xeb, 0xf6, 0xf6, 0xf6, 0xeb, 0xd6, 0xd6, 0xd6, 0x78, 0xd0, 0xd2, 0xd6, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd8, 0xd4, 0xd1, 0xd2, 0xd3, 0xd4, 0xeb, 0xd4, 0xd4, 0xd4, 0xd3, 0xd4, 0xd4, 0xd5, 0x00, 0x00, 0x74, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xeb, 0x75, 0xd1, 0xd0, 0xd1, 0xd0, 0xd2, 0xd0, 0xd2, 0xd0, 0xdc, 0xbb, 0x00, 0x00, 0x7b, 0x88, 0x99, 0x90, 0x8f, 0xae, 0xdf, 0x73, 0xdf, 0xee, 0xee, 0xdf, 0xdf, 0xef, 0xe0, 0x73, 0x73, 0xde, 0xde, 0xdf, 0xdf, 0xe0, 0xcb, 0x9f, 0xd2, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xd3, 0xcf, 0xcf, 0x7a, 0xdc, 0xb3, 0xde, 0xee, 0xee, 0xee, 0xee, 0xdf, 0xb2, 0xdf, 0xb2, 0xb2, 0xb2, 0xb3, 0x71, 0x73, 0xad, 0x90, 0x91, 0x9a, 0x8b, 0x00, 0x00, 0x00, 0xea, 0xdf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xf3, 0xd0, 0xd2, 0xcf, 0x06, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x74, 0x00, 0x00, 0xb7, 0xe0, 0xeb, 0xeb, 0xd8, 0xd5, 0xeb, 0xd5, 0xd6, 0xd6, 0xd4, 0xd2, 0xd2, 0xeb, 0xd8, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xd8, 0xd4, 0xd3, 0xd3, 0xd2, 0xd4, 0xd4, 0xf5, 0xd3, 0xd2, 0xeb, 0xd2, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xbd, 0xeb, 0xd0, 0xd1, 0xd1, 0xd0, 0xd0, 0xd1, 0xd0, 0xd1, 0xce, 0xda, 0xbe, 0x00, 0x00, 0x00, 0x88, 0x99, 0x91, 0x8f, 0xaa, 0xe0, 0x73, 0xee, 0xef, 0xee, 0xef, 0xee, 0xdf, 0xef, 0xee, 0xb3, 0xde, 0xb3, 0xb2, 0xee, 0xe0, 0xcf, 0x9d, 0xd1, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x77, 0xd4, 0xce, 0xce, 0xca, 0xb2, 0xee, 0xee, 0xde, 0xee, 0xde, 0xee, 0xee, 0xee, 0xee, 0xee, 0xb2, 0xb2, 0xff, 0xff, 0xdf, 0xb2, 0x91, 0x93, 0x9a, 0x8a, 0x00, 0x00, 0x00, 0xc9, 0xd9, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xf4, 0xd0, 0xf3, 0xd2, 0x06, 0x00, 0x74, 0x00, 0x76, 0x74, 0x00, 0x74, 0x74, 0x00, 0x00, 0x08, 0xee, 0xd5, 0xeb, 0xd4, 0xd5, 0xd6, 0xeb, 0xd4, 0xd2, 0xd2, 0xd5, 0xd8, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xd6, 0xab, 0xd4, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xab, 0xd3, 0x00, 0x00, 0x74, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x00, 0xbd, 0x6a, 0xd1, 0xd0, 0xd0, 0xd1, 0xd1, 0xd0, 0xd0, 0xd1, 0xcf, 0xd9, 0xc4, 0x00, 0xf9, 0x00, 0x85, 0x99, 0x8e, 0x8e, 0xa6, 0xf0, 0xff, 0xee, 0x73, 0xee, 0xef, 0xee, 0xee, 0xef, 0xb3, 0xee, 0xdf, 0xdf, 0xee, 0xb2, 0xe0, 0xcd, 0xcd, 0x9d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xc9, 0xd0, 0xce, 0xca, 0xdc, 0xb2, 0xff, 0xee, 0xde, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xb3, 0xae, 0x91, 0x93, 0x9a, 0x88, 0x00, 0x00, 0xe2, 0xd0, 0xd8, 0x75, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xf4, 0xd1, 0xf3, 0xd1, 0xf1, 0x00, 0x00, 0x00, 0x76, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x84, 0xed, 0xd6, 0xeb, 0xeb, 0xeb, 0xd3, 0xd2, 0xd1, 0xd4, 0xd8, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xdc, 0xdc, 0xda, 0xd9, 0xda, 0xdd, 0xdc, 0xd9, 0xd8, 0xd6, 0xeb, 0xeb, 0xd2, 0xd6, 0x75, 0x00, 0x76, 0x74, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xeb, 0xd1, 0xd0, 0xd1, 0xd0, 0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0xd2, 0xa9, 0xe2, 0x00, 0x00, 0x80, 0x95, 0x93, 0x8e, 0x9e, 0xf0, 0xff, 0x73, 0xee, 0xee, 0x73, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdf, 0xde, 0xb2, 0xdf, 0xde, 0xc9, 0xd3, 0xbe, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xbd, 0xd1, 0xd0, 0x9f, 0xab, 0xe0, 0xde, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xff, 0xee, 0xff, 0xff, 0xff, 0xdf, 0xb2, 0xa6, 0x91, 0x97, 0x95, 0x80, 0x00, 0x00, 0xb7, 0xd6, 0xd4, 0x75, 0xd1, 0xd0, 0xd1, 0xd0, 0xd0, 0xf3, 0xd1, 0xd1, 0xce, 0x84, 0x00, 0x01, 0x74, 0x74, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0xe3, 0xd9, 0xeb, 0xf5, 0xd4, 0xd2, 0xeb, 0xd6, 0xdc, 0xde, 0xda, 0xd9, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xdc, 0xd9, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xd8, 0xda, 0xd4, 0x00, 0x76, 0x74, 0x00, 0x7b, 0x74, 0x00, 0x00, 0x00, 0x74, 0x76, 0x00, 0xba, 0xab, 0xd2, 0xd0, 0xd0, 0xd1, 0xd1, 0xd0, 0xd2, 0xd0, 0xd2, 0xce, 0xb1, 0xbb, 0x00, 0xf9, 0x7b, 0x8d, 0x93, 0x8e, 0x95, 0xb2, 0xef, 0xb1, 0xb3, 0x73, 0xee, 0xff, 0x73, 0xef, 0xde, 0xb2, 0xdf, 0xb2, 0xde, 0xe0, 0xd7, 0xc9, 0xd1, 0xb5, 0x00, 0x00, 0x01, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x74, 0x76, 0x00, 0x00, 0x07, 0xd2, 0xcc, 0xcb, 0xa2, 0xe0, 0xee, 0xee, 0xee, 0xde, 0xef, 0xf8, 0xff, 0xef, 0xef, 0xff, 0xff, 0x71, 0xb1, 0xb2, 0x9c, 0x93, 0x99, 0x8d, 0x7c, 0x7b, 0x00, 0xc1, 0xd6, 0xd2, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xd1, 0xf4, 0xcb, 0xe5, 0x00, 0x00, 0x76, 0x00, 0x00, 0x76, 0x00, 0x74, 0x00, 0x00, 0xe2, 0xd8, 0xf6, 0xd6, 0xd8, 0xda, 0xdc, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdd, 0xd3, 0x00, 0x76, 0x7b, 0x00, 0x00, 0x74, 0x74, 0x76, 0x74, 0x74, 0x00, 0x00, 0xb5, 0xeb, 0xd2, 0xd0, 0xd1, 0xd0, 0xd1, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xa7, 0xa7, 0xe6, 0x00, 0x7b, 0x86, 0x99, 0x91, 0x8f, 0xa3, 0xe0, 0xb2, 0xb3, 0xdf, 0xde, 0xee, 0xff, 0xee, 0xee, 0xee, 0xb2, 0xb2, 0xb3, 0xb2, 0xcf, 0xc9, 0xc4, 0x00, 0x00, 0x00, 0x76, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x84, 0xb6, 0xb9, 0xe8, 0xe8, 0xb7, 0x87, 0x81, 0x00, 0x00, 0x00, 0x76, 0x74, 0x00, 0x02, 0x00, 0x00, 0x76, 0xc2, 0xd3, 0xd0, 0xc8, 0xb0, 0xee, 0xb2, 0xee, 0xde, 0xef, 0xe0, 0xee, 0xff, 0xff, 0xef, 0xf8, 0xb2, 0xb2, 0xaa, 0x8f, 0x97, 0x9a, 0x85, 0x7b, 0x00, 0xe4, 0xab, 0xd2, 0xcf, 0xd0, 0x75, 0xd0, 0x75, 0xd0, 0xf3, 0xcf, 0xf4, 0xd2, 0xc9, 0x03, 0x00, 0x74, 0x00, 0x74, 0x74, 0x74, 0x00, 0x74, 0x00, 0x00, 0xe2, 0xd6, 0xed, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xdc, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xab, 0x00, 0x00, 0x00, 0x74, 0x7b, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x04, 0x75, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xa7, 0xa9, 0xc7, 0x09, 0x7b, 0x7b, 0x8b, 0x99, 0x90, 0x94, 0xb2, 0xb2, 0xb2, 0xb2, 0xb3, 0xee, 0xee, 0xde, 0xde, 0xb3, 0xb2, 0xb2, 0xb2, 0xd5, 0xc7, 0xd0, 0xb8, 0x00, 0x00, 0x01, 0x74, 0x7b, 0x00, 0x00, 0x84, 0xbc, 0xc4, 0x9d, 0xcc, 0xce, 0xa2, 0xcd, 0xce, 0xcc, 0xc8, 0xc1, 0xb8, 0x02, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd7, 0xce, 0xca, 0x9d, 0xdd, 0xdf, 0xb2, 0xde, 0xde, 0xee, 0xee, 0xee, 0xff, 0xee, 0xb1, 0xe0, 0xae, 0x95, 0x95, 0x9a, 0x8a, 0x7c, 0x01, 0x02, 0xc1, 0xd6, 0xd0, 0xd1, 0xd0, 0xd0, 0x75, 0xd0, 0xd0, 0xd0, 0xcf, 0xd2, 0xd3, 0xc3, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0xe1, 0xf6, 0xdd, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xd6, 0x00, 0x00, 0x7b, 0x74, 0x76, 0x74, 0x74, 0x00, 0x74, 0x76, 0x00, 0x76, 0x01, 0xc8, 0xd3, 0xd0, 0xd1, 0xd0, 0xd1, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd1, 0xab, 0xc0, 0x00, 0x7b, 0x7e, 0x8d, 0x99, 0x8f, 0x9a, 0xad, 0xe0, 0xb1, 0xb2, 0xee, 0xee, 0xde, 0xde, 0xde, 0xb3, 0xb3, 0xa9, 0xc7, 0x9f, 0xc8, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0xbc, 0xca, 0xd0, 0xcc, 0xcf, 0xce, 0xc9, 0xc5, 0xc5, 0xc4, 0xc8, 0xd3, 0xd5, 0xd4, 0xc5, 0xb7, 0x00, 0x00, 0x01, 0x74, 0x76, 0x00, 0x00, 0xc9, 0xd3, 0xa2, 0xc6, 0x9d, 0xb1, 0xe0, 0xdf, 0xdf, 0xdf, 0xee, 0xee, 0xef, 0xb2, 0xe0, 0xaa, 0x94, 0x95, 0x9c, 0x8a, 0x7c, 0x7e, 0x00, 0xbe, 0xd6, 0xd0, 0x75, 0xd2, 0x75, 0xd0, 0xd0, 0x75, 0xd0, 0xf3, 0xcf, 0xf3, 0xeb, 0xbe, 0x00, 0x00, 0x74, 0x00, 0x74, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0xe1, 0xd8, 0xdd, 0xf7, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xdc, 0xda, 0xd9, 0xda, 0xd9, 0xd9, 0xda, 0xdc, 0xdc, 0x00, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x74, 0x74, 0x00, 0x74, 0x74, 0x76, 0x00, 0xbe, 0xeb, 0xd0, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xf3, 0xd2, 0xa2, 0xaf, 0x96, 0x03, 0x00, 0x7b, 0x8b, 0x97, 0x91, 0x95, 0xa8, 0xb2, 0xe0, 0xee, 0xee, 0x73, 0x73, 0xe0, 0xb1, 0xa1, 0xc4, 0x9d, 0xcd, 0xb9, 0x00, 0x76, 0x00, 0x00, 0x00, 0xb4, 0xc8, 0xd5, 0xce, 0xa4, 0xc8, 0xbd, 0xb5, 0x84, 0x82, 0x81, 0xe4, 0x83, 0xe5, 0xe9, 0xa2, 0xda, 0xb2, 0xbe, 0x02, 0x00, 0x00, 0x01, 0x74, 0x00, 0xb7, 0xd1, 0xa2, 0xa7, 0x98, 0xc4, 0xac, 0xdb, 0xb2, 0xdf, 0xb2, 0xe0, 0xee, 0xae, 0x9c, 0x98, 0x95, 0x94, 0x85, 0x7c, 0x7c, 0x03, 0xc0, 0xf6, 0xcb, 0xd1, 0xd0, 0xcf, 0xd0, 0x75, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xf3, 0xd4, 0xb7, 0x00, 0x00, 0x76, 0x74, 0x74, 0x00, 0x74, 0x74, 0x74, 0x74, 0x00, 0xe2, 0xf7, 0xdd, 0xf7, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xf7, 0xda, 0xda, 0xee, 0x00, 0x00, 0x00, 0x74, 0x00, 0x7b, 0x74, 0x74, 0xf9, 0x00, 0xf9, 0x00, 0x00, 0xb8, 0xeb, 0xd0, 0xd0, 0xf4, 0xd0, 0xf4, 0xd2, 0xd2, 0xf4, 0xd0, 0xd2, 0xd1, 0xd2, 0xa4, 0x6a, 0xc9, 0xfb, 0x00, 0x7c, 0x86, 0x95, 0x95, 0x95, 0x9b, 0x9e, 0xb1, 0xb2, 0xb2, 0xb0, 0xa3, 0x96, 0xc1, 0x9d, 0xa2, 0xc2, 0x7b, 0x00, 0x74, 0x74, 0x00, 0x81, 0xd3, 0xd9, 0xd2, 0xa2, 0xbd, 0x81, 0x00, 0x01, 0x01, 0x7b, 0x00, 0x00, 0x00, 0x87, 0xc1, 0xa9, 0xdd, 0xdc, 0xe0, 0xe9, 0x00, 0x74, 0x76, 0x00, 0x00, 0x76, 0xea, 0xd4, 0x9f, 0xa5, 0x96, 0x92, 0xa0, 0xaa, 0xa6, 0xac, 0xaa, 0xa3, 0x9e, 0x98, 0x94, 0x88, 0x80, 0x7b, 0x7c, 0xb6, 0xc9, 0xa7, 0xce, 0xd0, 0xd1, 0xd0, 0xcc, 0x75, 0xd1, 0xcf, 0x75, 0xa4, 0xd0, 0xce, 0xd2, 0x75, 0xe3, 0x00, 0xf9, 0xf9, 0x00, 0xf9, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xdc, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xf7, 0xda, 0xf7, 0xda, 0xf0, 0x04, 0x74, 0x00, 0x00, 0x74, 0x7b, 0x00, 0x74, 0xf9, 0x09, 0xf9, 0xf9, 0x00, 0x01, 0xa4, 0xd0, 0xd1, 0xd0, 0xd1, 0xd0, 0xcf, 0xd0, 0xd1, 0xd2, 0xd1, 0xd1, 0xd1, 0xf4, 0xf4, 0x67, 0xf7, 0xc3, 0xe7, 0x04, 0x7c, 0x86, 0x8d, 0x8d, 0x94, 0x92, 0x94, 0x92, 0x8c, 0xbc, 0x98, 0xa5, 0x9d, 0xa5, 0xe4, 0x7b, 0x74, 0x01, 0x00, 0x00, 0xc3, 0xe0, 0xdc, 0xdd, 0xda, 0xeb, 0xca, 0xbf, 0xb7, 0xb5, 0xb9, 0xbb, 0xc9, 0xd8, 0xee, 0xde, 0xde, 0xd9, 0xda, 0xef, 0xeb, 0xe2, 0x00, 0x00, 0x74, 0x03, 0x00, 0x04, 0x78, 0xd2, 0x9f, 0xa7, 0x9b, 0x8c, 0x8d, 0x92, 0x90, 0x92, 0x8c, 0x88, 0x80, 0x7b, 0x00, 0x85, 0xe8, 0xc9, 0xa9, 0xa4, 0xa7, 0xa4, 0xa2, 0xcf, 0x75, 0xd3, 0x75, 0x75, 0xd1, 0xd1, 0xa2, 0xa1, 0xa4, 0x78, 0xc1, 0x00, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe0, 0xf7, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xf7, 0xda, 0xdc, 0xf0, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x74, 0x00, 0xf9, 0xf9, 0xf9, 0x76, 0x76, 0x00, 0x96, 0xd5, 0xa4, 0xa4, 0xa7, 0xa2, 0xa7, 0xd1, 0xa7, 0xa4, 0xd1, 0xd2, 0xf3, 0xd1, 0xd1, 0xd2, 0xd0, 0xeb, 0xd3, 0xc8, 0x96, 0x8d, 0x8a, 0x8a, 0x8a, 0x8c, 0xe9, 0x92, 0xc4, 0x9f, 0xa7, 0x9d, 0xa7, 0xbd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0xd0, 0xee, 0xdc, 0xde, 0xdd, 0xde, 0xef, 0xe0, 0xde, 0xdd, 0xe0, 0xf0, 0xe0, 0xdc, 0xee, 0xde, 0xdd, 0xda, 0xdc, 0xdd, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xbc, 0xeb, 0xcd, 0xd1, 0xa2, 0xa0, 0x98, 0x8c, 0x88, 0x83, 0x85, 0x79, 0x89, 0xbc, 0xc3, 0xcc, 0xd4, 0xd1, 0x75, 0xd0, 0xa1, 0xd0, 0xa4, 0xd1, 0xd0, 0xf3, 0xd0, 0xf3, 0xcf, 0xcf, 0xcf, 0xd1, 0xf2, 0xd4, 0xba, 0x00, 0x00, 0x74, 0xf9, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xf0, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0xf0, 0xb7, 0x00, 0x01, 0x74, 0x00, 0xf9, 0x00, 0x74, 0x7b, 0x74, 0x7b, 0x74, 0x74, 0x00, 0xf1, 0xd1, 0xa7, 0xd0, 0xa7, 0xcf, 0xd0, 0xa2, 0xcf, 0xd0, 0xd1, 0xf4, 0xd1, 0xd0, 0xd0, 0xa5, 0xa4, 0xd0, 0xd1, 0xf5, 0xd4, 0xa9, 0xd5, 0xd4, 0xd2, 0xd2, 0xd2, 0xd3, 0xd2, 0xd0, 0x9f, 0xa9, 0x96, 0x7b, 0x7b, 0x00, 0x00, 0x74, 0x00, 0x04, 0xf5, 0xde, 0xdd, 0xdd, 0xde, 0xde, 0xdd, 0xde, 0xee, 0xde, 0xee, 0xda, 0xde, 0xdd, 0xdc, 0xdd, 0xdc, 0xde, 0xdd, 0xdd, 0xee, 0x05, 0x00, 0x00, 0x74, 0x74, 0x76, 0x00, 0x00, 0xc3, 0x6a, 0xf2, 0xd1, 0xa2, 0xa7, 0xa7, 0xa9, 0xd3, 0xd4, 0xeb, 0xd4, 0xd5, 0xd4, 0xf4, 0xd1, 0xf4, 0xf3, 0xd1, 0xf3, 0xa4, 0xcf, 0xcf, 0xf3, 0xf4, 0xf4, 0xf4, 0xfd, 0xf4, 0xfd, 0xf3, 0x66, 0xc9, 0x02, 0x7b, 0x7b, 0x7b, 0x74, 0x74, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xf0, 0xed, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xdc, 0xed, 0xd9, 0xf0, 0xbd, 0x00, 0x76, 0x76, 0x00, 0xf9, 0xf9, 0x76, 0x7b, 0x7c, 0x00, 0x74, 0xf9, 0xf9, 0x09, 0xc1, 0x6a, 0xfd, 0xfd, 0xfd, 0xfd, 0x66, 0x67, 0xfd, 0xfd, 0x63, 0xf3, 0xd0, 0xa4, 0xa7, 0xa5, 0xa7, 0xf3, 0xf3, 0xf4, 0xd1, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf2, 0xa7, 0xc6, 0x76, 0x7b, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe0, 0xdc, 0xdc, 0xde, 0xdc, 0xdd, 0xda, 0xdd, 0xde, 0xde, 0xee, 0xdc, 0xdc, 0xdd, 0xdd, 0xdc, 0xde, 0xd9, 0xf0, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x82, 0x5e, 0xd3, 0xd0, 0xce, 0xd0, 0xd0, 0xd2, 0xf4, 0xf4, 0xf3, 0xd0, 0xcf, 0xf3, 0xd1, 0xf4, 0xf3, 0xd1, 0xf3, 0xd0, 0xf4, 0xfd, 0x67, 0x66, 0x63, 0x5f, 0x5f, 0x5c, 0x5f, 0x64, 0x64, 0x69, 0xba, 0x00, 0x76, 0x7c, 0x7b, 0x7b, 0x74, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf0, 0xda, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xf7, 0xda, 0xdc, 0xd9, 0xef, 0xc2, 0x00, 0x00, 0x74, 0x74, 0xf9, 0xf9, 0x00, 0x7b, 0x7b, 0x00, 0xf9, 0x09, 0x09, 0x0a, 0x0f, 0x3c, 0x38, 0x31, 0x38, 0x41, 0x47, 0x54, 0x59, 0x62, 0x68, 0x69, 0x67, 0xd0, 0xa2, 0xa4, 0xcf, 0xf4, 0xfd, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xd1, 0xf3, 0x75, 0xd6, 0xc3, 0xe2, 0x00, 0x7b, 0x74, 0x74, 0x00, 0x00, 0x74, 0x00, 0xe7, 0xf0, 0xda, 0xde, 0xdc, 0xdd, 0xde, 0xdd, 0xde, 0xda, 0xda, 0xdc, 0xee, 0xde, 0xdc, 0xd9, 0xee, 0xdc, 0xdd, 0xf0, 0xbb, 0x00, 0x76, 0x01, 0x00, 0x74, 0x76, 0x00, 0x74, 0x00, 0x06, 0xd2, 0xd0, 0xd1, 0xd0, 0xd1, 0xf3, 0xcf, 0xf3, 0xd2, 0xa2, 0xd1, 0xd1, 0xcf, 0xd1, 0xf4, 0x60, 0xf4, 0x67, 0x69, 0x5c, 0x4d, 0x3c, 0x22, 0x17, 0x11, 0x13, 0x17, 0x25, 0x47, 0x3c, 0x0a, 0xf9, 0x00, 0x7b, 0x7b, 0x7b, 0x00, 0x76, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0xc2, 0xf0, 0xf7, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xde, 0xcb, 0x02, 0x00, 0x00, 0x76, 0xf9, 0x00, 0x74, 0xf9, 0x74, 0x09, 0x09, 0x0c, 0x10, 0x13, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x14, 0x38, 0x53, 0x5c, 0x64, 0xfd, 0xf4, 0xf4, 0xf3, 0xf4, 0xd2, 0xf4, 0xd0, 0x75, 0xd0, 0x75, 0xd0, 0xa4, 0xab, 0xc1, 0x77, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0xda, 0xde, 0xde, 0xdd, 0xde, 0xee, 0xde, 0xdd, 0xdc, 0xdd, 0xde, 0xde, 0xde, 0xd9, 0xdd, 0xf0, 0x96, 0x00, 0x74, 0x00, 0x00, 0x76, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0xb5, 0xa1, 0xa7, 0xa2, 0xa2, 0xa2, 0xd0, 0xd3, 0x9f, 0xa7, 0xa4, 0xce, 0xd2, 0x75, 0xf4, 0x64, 0xfd, 0x55, 0x27, 0x11, 0x11, 0x11, 0x12, 0x12, 0x14, 0x12, 0x12, 0x12, 0x11, 0x10, 0x0e, 0x0c, 0x0a, 0x00, 0xf9, 0x74, 0x00, 0x74, 0x00, 0x74, 0x76, 0x00, 0x00, 0x03, 0xcf, 0xee, 0xdc, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xec, 0xda, 0xf7, 0xda, 0xdc, 0xda, 0xe5, 0x74, 0x00, 0x74, 0x7b, 0x01, 0x00, 0x00, 0xf9, 0x0a, 0x10, 0x13, 0x13, 0x12, 0x19, 0x15, 0x15, 0x15, 0x16, 0x15, 0x19, 0x1a, 0x1a, 0x12, 0x11, 0x11, 0x13, 0x47, 0x5d, 0x68, 0x64, 0xfd, 0xf4, 0xf3, 0xa4, 0xd0, 0xcf, 0xd1, 0xd1, 0xa9, 0xeb, 0xe9, 0x7b, 0x00, 0x01, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x96, 0xf0, 0xee, 0xdd, 0xdd, 0xde, 0xdd, 0xee, 0xdc, 0xdd, 0xde, 0xdc, 0xda, 0xdc, 0xdd, 0xf0, 0xc9, 0x74, 0x00, 0x01, 0x74, 0x00, 0x00, 0x74, 0x00, 0x74, 0x74, 0x00, 0x7b, 0x7b, 0x79, 0x7a, 0xac, 0xa7, 0xa4, 0xce, 0xa4, 0xd3, 0xa5, 0xcf, 0xd2, 0x75, 0x66, 0x68, 0x59, 0x21, 0x10, 0x11, 0x12, 0x18, 0x16, 0x12, 0x19, 0x15, 0x16, 0x16, 0x18, 0x12, 0x18, 0x1d, 0x22, 0x10, 0x0c, 0x09, 0x00, 0xf9, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x05, 0xf8, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0x73, 0xe8, 0x00, 0x00, 0x7b, 0x7b, 0x7b, 0x00, 0x09, 0x0d, 0x17, 0x1d, 0x18, 0x12, 0x16, 0x12, 0x15, 0x16, 0x16, 0x16, 0x16, 0x15, 0x19, 0x16, 0x19, 0x18, 0x18, 0x16, 0x11, 0x11, 0x4b, 0x5d, 0xfd, 0xd2, 0xd0, 0xd0, 0xa2, 0xd4, 0xa9, 0xa7, 0xc3, 0x84, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd9, 0xf0, 0xdd, 0xdc, 0xee, 0xdd, 0xdc, 0xee, 0xda, 0xde, 0xee, 0xe0, 0xe0, 0xbd, 0x00, 0x00, 0x74, 0x00, 0x02, 0x00, 0x76, 0x00, 0x74, 0x74, 0x00, 0x76, 0x7b, 0x00, 0x00, 0x7e, 0xbe, 0xa4, 0xab, 0xa7, 0xa4, 0xa2, 0xcf, 0xd1, 0x67, 0x63, 0x5c, 0x31, 0x0e, 0x12, 0x16, 0x12, 0x16, 0x19, 0x15, 0x15, 0x1a, 0x16, 0x15, 0x16, 0x16, 0x16, 0x19, 0x12, 0x12, 0x18, 0x1f, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0xe9, 0xe0, 0xd9, 0xed, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xec, 0xda, 0xf7, 0xdc, 0xf7, 0xb3, 0xc5, 0x00, 0x00, 0x00, 0x7c, 0x7b, 0xf9, 0x0b, 0x13, 0x14, 0x12, 0x16, 0x16, 0x12, 0x16, 0x12, 0x18, 0x19, 0x18, 0x16, 0x12, 0x18, 0x16, 0x12, 0x19, 0x19, 0x1a, 0x1e, 0x16, 0x11, 0x17, 0xc3, 0x66, 0xa9, 0xd6, 0xa9, 0xd0, 0xc4, 0xb7, 0x01, 0x00, 0x00, 0x01, 0x74, 0x00, 0x76, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xca, 0xf0, 0xf0, 0xee, 0xde, 0xde, 0xdd, 0xde, 0xf0, 0xf0, 0xc9, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x74, 0x76, 0x00, 0x00, 0x74, 0x00, 0x74, 0x74, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x08, 0xc0, 0x9f, 0xa9, 0xd6, 0xeb, 0x67, 0x67, 0x55, 0x10, 0x11, 0x16, 0x15, 0x1a, 0x15, 0x12, 0x15, 0x15, 0x15, 0x15, 0x1c, 0x15, 0x19, 0x16, 0x19, 0x1a, 0x1a, 0x1a, 0x16, 0x20, 0x17, 0x0d, 0x00, 0x00, 0x74, 0x74, 0x74, 0x74, 0x00, 0xc7, 0xef, 0xf7, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xf8, 0xd6, 0x00, 0x00, 0x76, 0x00, 0x00, 0x0a, 0x0e, 0x1f, 0x12, 0x16, 0x12, 0x12, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1b, 0x19, 0x19, 0x16, 0x19, 0x16, 0x1c, 0x20, 0x1b, 0x1d, 0x0d, 0xfc, 0xbb, 0xb9, 0xe7, 0xe3, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x74, 0x74, 0x00, 0x74, 0x00, 0x76, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc3, 0xd9, 0xf0, 0xe0, 0xf0, 0xd8, 0xc2, 0x87, 0x00, 0x00, 0x00, 0x00, 0x76, 0x74, 0x00, 0x00, 0x74, 0x00, 0x76, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xb5, 0xbb, 0xbf, 0xc3, 0x4d, 0x0e, 0x11, 0x16, 0x16, 0x15, 0x15, 0x1c, 0x16, 0x16, 0x16, 0x1c, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x18, 0x16, 0x16, 0x15, 0x23, 0x14, 0x0a, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x73, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xe0, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x13, 0x12, 0x16, 0x12, 0x16, 0x18, 0x18, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x19, 0x16, 0x19, 0x1c, 0x16, 0x24, 0x17, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x74, 0x74, 0x00, 0x76, 0x00, 0x76, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xbc, 0xf2, 0xe9, 0x84, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x01, 0x00, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x0c, 0x14, 0x19, 0x15, 0x15, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x1a, 0x18, 0x14, 0x16, 0x1a, 0x1a, 0x23, 0x0c, 0x00, 0x00, 0x00, 0x7b, 0x00, 0xb6, 0xf0, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xef, 0xc1, 0x00, 0x00, 0xf9, 0x00, 0x0d, 0x1f, 0x12, 0x15, 0x15, 0x16, 0x12, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x19, 0x19, 0x1c, 0x1c, 0x16, 0x22, 0x0c, 0xf9, 0x00, 0x74, 0x00, 0x00, 0x74, 0x74, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x76, 0x76, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x7b, 0x00, 0xf9, 0x0f, 0x1d, 0x12, 0x15, 0x15, 0x15, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1a, 0x16, 0x16, 0x18, 0x1c, 0x1a, 0x15, 0x1f, 0x0e, 0x00, 0x00, 0x74, 0x00, 0x00, 0xc5, 0xef, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xdc, 0xda, 0xd5, 0xe3, 0x00, 0x7b, 0x00, 0x0e, 0x1d, 0x15, 0x15, 0x1a, 0x15, 0x18, 0x12, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x19, 0x18, 0x16, 0x19, 0x1a, 0x1a, 0x16, 0x1d, 0x0d, 0xf9, 0x76, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x74, 0x74, 0x00, 0x74, 0x76, 0x00, 0xb6, 0xe3, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x74, 0x00, 0x00, 0x74, 0x76, 0x76, 0x74, 0x00, 0xb5, 0xe8, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x74, 0x00, 0x74, 0x00, 0x09, 0x13, 0x13, 0x19, 0x15, 0x16, 0x16, 0x16, 0x12, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x1a, 0x16, 0x18, 0x15, 0x1a, 0x15, 0x20, 0x0d, 0xf9, 0x00, 0x74, 0x00, 0x79, 0xd9, 0xd9, 0xda, 0xdc, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd8, 0xe0, 0xe9, 0x00, 0x7b, 0xf9, 0x0d, 0x14, 0x15, 0x1a, 0x15, 0x15, 0x18, 0x18, 0x16, 0x16, 0x16, 0x19, 0x16, 0x19, 0x19, 0x19, 0x19, 0x16, 0x18, 0x19, 0x16, 0x1a, 0x1a, 0x1a, 0x16, 0x24, 0x0d, 0xf9, 0x76, 0x76, 0x74, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x76, 0x74, 0x00, 0x00, 0xc1, 0xc5, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x74, 0x00, 0x00, 0x76, 0x00, 0x01, 0x74, 0x00, 0x06, 0xd9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x76, 0x00, 0x74, 0x00, 0x0a, 0x17, 0x1d, 0x12, 0x16, 0x15, 0x16, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x16, 0x16, 0x15, 0x1a, 0x1c, 0x1f, 0x0d, 0xf9, 0x00, 0x00, 0x00, 0xc0, 0xef, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xde, 0xd1, 0x02, 0x7b, 0xf9, 0x0c, 0x14, 0x16, 0x15, 0x1a, 0x15, 0x12, 0x16, 0x16, 0x12, 0x16, 0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x18, 0x16, 0x1a, 0x1a, 0x19, 0x1d, 0x0d, 0x00, 0x74, 0x74, 0x74, 0x00, 0x74, 0x74, 0x00, 0x74, 0x74, 0x00, 0x01, 0x76, 0x00, 0xe7, 0xe0, 0xc0, 0x76, 0x00, 0x76, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x74, 0x76, 0x74, 0x00, 0x76, 0x74, 0x00, 0x01, 0x02, 0x00, 0xe7, 0xde, 0xc9, 0x00, 0x76, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x0a, 0x22, 0x11, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x15, 0x15, 0x16, 0x15, 0x16, 0x14, 0x1d, 0x0b, 0x00, 0x74, 0x00, 0xe2, 0xaf, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xde, 0xd8, 0xde, 0xba, 0x7b, 0x00, 0x0b, 0x10, 0x18, 0x12, 0x15, 0x1c, 0x12, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x19, 0x16, 0x1c, 0x15, 0x15, 0x20, 0x13, 0x0c, 0x00, 0x00, 0x74, 0x00, 0x74, 0x74, 0x00, 0x74, 0x00, 0x74, 0x74, 0x00, 0x00, 0x01, 0x00, 0x96, 0xf0, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x06, 0xd1, 0x01, 0x00, 0x01, 0x76, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xd9, 0xf0, 0xb7, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xf9, 0x09, 0xf9, 0x17, 0x1f, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x1e, 0x16, 0x16, 0x12, 0x1f, 0x10, 0x09, 0x09, 0x00, 0x00, 0xbd, 0xf0, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd8, 0xdd, 0xdd, 0xd1, 0x7e, 0x03, 0x00, 0x0c, 0x17, 0x14, 0x12, 0x12, 0x16, 0x15, 0x12, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1a, 0x16, 0x16, 0x16, 0x1e, 0x12, 0x1f, 0x0d, 0x00, 0xf9, 0x74, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x74, 0x74, 0x00, 0x01, 0x76, 0x01, 0x00, 0x00, 0xeb, 0xf0, 0xd9, 0xbc, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xd8, 0xf0, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xbb, 0xd8, 0xe0, 0xf0, 0xc5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x0e, 0x13, 0x14, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x12, 0x12, 0x1f, 0x10, 0x0b, 0x00, 0x74, 0x00, 0x05, 0xd6, 0xee, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdd, 0xd8, 0xda, 0xe0, 0xe8, 0x00, 0x09, 0xf9, 0x0e, 0x17, 0x1d, 0x12, 0x16, 0x15, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x19, 0x19, 0x19, 0x15, 0x1a, 0x16, 0x19, 0x16, 0x18, 0x23, 0x13, 0x0a, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x72, 0xe0, 0xf0, 0xf0, 0xd9, 0xc5, 0xbe, 0xe8, 0xb9, 0xba, 0xbf, 0xc5, 0x73, 0xe0, 0x73, 0xf0, 0xca, 0xbd, 0xe9, 0xe9, 0xbc, 0xc0, 0xc7, 0xab, 0xf0, 0x73, 0xee, 0xf0, 0x05, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x0b, 0x10, 0x1f, 0x12, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1c, 0x1d, 0x13, 0x0c, 0xf9, 0x76, 0x7b, 0x00, 0xc2, 0xf0, 0xd9, 0xde, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xdd, 0xdc, 0xd2, 0x84, 0x02, 0xf9, 0xf9, 0x0d, 0x13, 0x1d, 0x16, 0x16, 0x12, 0x15, 0x16, 0x16, 0x16, 0x1c, 0x19, 0x19, 0x19, 0x1c, 0x1a, 0x15, 0x19, 0x18, 0x1d, 0x0e, 0x0b, 0xf9, 0x7b, 0x7b, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x00, 0x76, 0x00, 0x76, 0x76, 0x01, 0x00, 0xbd, 0xf0, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xb3, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 0xdd, 0xdd, 0xf0, 0xbf, 0x00, 0x00, 0x76, 0x00, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x7b, 0x09, 0x00, 0x0c, 0x11, 0x1d, 0x16, 0x16, 0x15, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1b, 0x16, 0x1b, 0x20, 0x11, 0x0b, 0xf9, 0x00, 0x7b, 0x7b, 0xb9, 0xde, 0xde, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xee, 0x96, 0x02, 0x01, 0x74, 0xf9, 0x0b, 0x0f, 0x17, 0x14, 0x18, 0x18, 0x16, 0x15, 0x1a, 0x1c, 0x1c, 0x16, 0x1b, 0x1b, 0x1e, 0x18, 0x1f, 0x10, 0x0d, 0x0a, 0xf9, 0xf9, 0x74, 0x01, 0x00, 0x00, 0x74, 0x74, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x74, 0x74, 0x00, 0x02, 0xc7, 0xf0, 0xde, 0xb2, 0xde, 0xb3, 0xde, 0xff, 0xe0, 0x71, 0xf0, 0x71, 0xf0, 0xf0, 0xe0, 0xee, 0xde, 0xf8, 0xdc, 0xec, 0xff, 0xed, 0xf8, 0xf0, 0xd1, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0b, 0x0f, 0x1d, 0x14, 0x18, 0x16, 0x16, 0x16, 0x16, 0x1c, 0x1c, 0x16, 0x16, 0x1e, 0x18, 0x1d, 0x17, 0x13, 0x0c, 0x09, 0x00, 0x00, 0x01, 0x76, 0xe3, 0xd2, 0xde, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xf8, 0xe0, 0xb6, 0x03, 0x01, 0x00, 0x00, 0x0a, 0x0c, 0x0f, 0x13, 0x1f, 0x1d, 0x20, 0x1b, 0x1b, 0x20, 0x1d, 0x1d, 0x1d, 0x14, 0x11, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x74, 0x00, 0x74, 0x74, 0x74, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd2, 0xf0, 0xdd, 0x73, 0x73, 0x71, 0x71, 0x70, 0x6f, 0x6b, 0x65, 0x65, 0x65, 0x6b, 0x70, 0x71, 0x71, 0xff, 0xdc, 0xda, 0xde, 0x73, 0xb3, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x74, 0x00, 0x09, 0x0c, 0x10, 0x14, 0x1d, 0x1d, 0x20, 0x18, 0x18, 0x18, 0x20, 0x20, 0x1f, 0x14, 0x0f, 0x0d, 0x09, 0xf9, 0x00, 0x00, 0x7b, 0xe1, 0x02, 0xc0, 0xf0, 0xdd, 0xdc, 0xd9, 0xdd, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xee, 0xa7, 0x06, 0x81, 0x03, 0xf9, 0xf9, 0xf9, 0x09, 0x0a, 0x0c, 0x0d, 0x0e, 0x0e, 0x0f, 0x0e, 0x0e, 0x0d, 0x0c, 0x0b, 0x09, 0xf9, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x7b, 0x00, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x84, 0xf2, 0x71, 0x6f, 0x65, 0x5b, 0x52, 0x46, 0x3a, 0x32, 0x29, 0x2a, 0x2a, 0x32, 0x44, 0x56, 0x62, 0x6d, 0xf0, 0xee, 0xb3, 0xee, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x74, 0x00, 0x00, 0x09, 0x0b, 0x0d, 0x0e, 0x0f, 0x10, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0a, 0x09, 0x00, 0xf9, 0x00, 0x00, 0x7b, 0x81, 0x02, 0xbc, 0xde, 0xdd, 0xd9, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xe0, 0xc9, 0x7e, 0xe3, 0x02, 0xf9, 0xf9, 0x09, 0x00, 0x00, 0x00, 0xf9, 0x09, 0xf9, 0x09, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0x00, 0x00, 0x7b, 0x7b, 0x7c, 0x74, 0x7b, 0x7b, 0x74, 0x00, 0x74, 0x00, 0x74, 0x74, 0x00, 0x74, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xe4, 0x5a, 0x54, 0x30, 0x2b, 0x28, 0x26, 0x35, 0x35, 0x35, 0x35, 0x2d, 0x35, 0x26, 0x28, 0x1e, 0x3e, 0x57, 0x6d, 0xf7, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x7b, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x09, 0x09, 0x09, 0x09, 0xf9, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0xf9, 0x00, 0x00, 0x81, 0x01, 0x87, 0xd6, 0xee, 0xd9, 0xda, 0xdd, 0xdc, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xf7, 0xda, 0xda, 0xf0, 0x96, 0x83, 0x84, 0x03, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xf9, 0x7b, 0x00, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x74, 0x74, 0x74, 0x74, 0x00, 0x76, 0x74, 0x00, 0x74, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x74, 0x01, 0x01, 0x00, 0x00, 0x0a, 0x27, 0x3e, 0x2e, 0x3b, 0x36, 0x36, 0x36, 0x36, 0x3b, 0x35, 0x35, 0x36, 0x36, 0x35, 0x34, 0x20, 0x3e, 0xfc, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x7c, 0x7b, 0x00, 0x00, 0x74, 0x00, 0xf9, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x7b, 0x82, 0x7e, 0xb5, 0xd2, 0xee, 0xf7, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xec, 0xda, 0xdd, 0xb2, 0xbe, 0xe2, 0x79, 0xe1, 0x7b, 0x7b, 0x7b, 0x7b, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x7b, 0x7b, 0x00, 0x7b, 0x00, 0x76, 0x7b, 0x00, 0xf9, 0xf9, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x76, 0x00, 0x74, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x0a, 0x30, 0x40, 0x35, 0x36, 0x36, 0x36, 0x36, 0x35, 0x2d, 0x36, 0x36, 0x36, 0x26, 0x39, 0x3a, 0x13, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0xf9, 0x7b, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x00, 0x00, 0x02, 0x82, 0x81, 0x82, 0x7a, 0xb3, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xec, 0xdc, 0xda, 0xda, 0xde, 0xdf, 0xbc, 0x81, 0x87, 0xe2, 0x7b, 0x00, 0x76, 0x76, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x76, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x74, 0xe1, 0xe2, 0x74, 0x00, 0x00, 0x00, 0x00, 0x76, 0x74, 0x74, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x0a, 0x13, 0x3e, 0x3a, 0x34, 0x2e, 0x37, 0x35, 0x36, 0x35, 0x35, 0x34, 0x3a, 0x30, 0x0d, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x76, 0x7e, 0x84, 0xe3, 0x06, 0xc8, 0xe0, 0x6c, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xee, 0xdd, 0xe8, 0x81, 0x07, 0x79, 0x76, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x74, 0x00, 0x00, 0x00, 0x07, 0xbd, 0xea, 0xca, 0xca, 0xc5, 0xc2, 0xbd, 0xb9, 0x02, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x09, 0x0d, 0x17, 0x30, 0x30, 0x3a, 0x33, 0x37, 0x39, 0x3a, 0x29, 0x10, 0x0b, 0x00, 0x7b, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xf9, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0x74, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x01, 0x82, 0x79, 0x83, 0xe4, 0xc7, 0xf0, 0xd8, 0xdd, 0xda, 0xf7, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xec, 0xdc, 0xed, 0xda, 0xee, 0xde, 0xbb, 0x81, 0x06, 0x79, 0x81, 0x7b, 0x00, 0x7b, 0x00, 0x74, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb9, 0xc3, 0x78, 0xf5, 0xd3, 0xeb, 0xd2, 0xd0, 0xd3, 0xf6, 0xdd, 0xca, 0xb6, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0a, 0x0d, 0xfc, 0x11, 0x0e, 0x0e, 0x0c, 0x0a, 0x00, 0x00, 0x7b, 0x7b, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x81, 0x79, 0x79, 0xe2, 0x06, 0xc9, 0xe0, 0xda, 0xed, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xdc, 0xf7, 0xdc, 0xf8, 0xef, 0xbb, 0xe4, 0x79, 0xb4, 0x81, 0x76, 0x00, 0x00, 0x00, 0x00, 0x74, 0x7b, 0x00, 0x7b, 0x00, 0x02, 0xbb, 0xc8, 0xa5, 0xa7, 0xa1, 0xf2, 0xd4, 0xf4, 0xcb, 0xf2, 0xca, 0xcb, 0xd6, 0xd9, 0xeb, 0xbb, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x76, 0x7b, 0x7b, 0x7b, 0x00, 0x00, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x84, 0x79, 0x84, 0x81, 0x72, 0xc9, 0xe0, 0xf7, 0xdc, 0xda, 0xdd, 0xd8, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xdd, 0xee, 0xbf, 0xe2, 0x05, 0xb4, 0x79, 0x02, 0x00, 0x76, 0x00, 0x00, 0x7b, 0x00, 0x00, 0xb8, 0xc8, 0xd3, 0xa4, 0xcc, 0xcc, 0xcb, 0xa7, 0xeb, 0x9f, 0xce, 0x9f, 0xca, 0xd1, 0xd7, 0xd1, 0xcf, 0xd7, 0xb8, 0x00, 0x02, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x7b, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x02, 0x84, 0xe6, 0xe5, 0x84, 0xe2, 0xb6, 0xd3, 0xe0, 0xda, 0xdc, 0xf7, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdd, 0xf0, 0xea, 0x06, 0x06, 0x87, 0x07, 0x81, 0x00, 0x00, 0x7b, 0x00, 0xe2, 0xc3, 0xa9, 0xcf, 0xcc, 0xce, 0xcc, 0xcc, 0xce, 0xd4, 0xd0, 0xcc, 0xcb, 0xcc, 0xcb, 0xab, 0xa9, 0xcc, 0xcc, 0xd0, 0xa9, 0xba, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0x05, 0x79, 0x79, 0x05, 0xe1, 0xbe, 0xda, 0xef, 0xd8, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xde, 0xde, 0x78, 0x87, 0x82, 0xe7, 0xb5, 0x79, 0x02, 0x00, 0xb5, 0xcc, 0xd0, 0xcf, 0xce, 0xcc, 0xce, 0xcc, 0xcc, 0xcf, 0xa9, 0xce, 0xce, 0x9f, 0xcc, 0xd3, 0xd7, 0xce, 0xcb, 0xcc, 0x9d, 0xd0, 0xd3, 0x81, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x00, 0x00, 0x00, 0x01, 0x04, 0x05, 0x05, 0xe6, 0xe6, 0x84, 0x04, 0xc1, 0xe0, 0xde, 0xd8, 0xd9, 0xda, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xde, 0xde, 0xf0, 0xbf, 0x84, 0x05, 0x87, 0x84, 0xbd, 0xd6, 0xd0, 0xa2, 0xcb, 0x7a, 0xcd, 0xce, 0xcc, 0x9f, 0xd2, 0xd4, 0xce, 0xcc, 0xcb, 0xa2, 0xd6, 0xd1, 0xcb, 0xce, 0xca, 0xcc, 0xd5, 0xd5, 0xc7, 0x03, 0x00, 0x00, 0x76, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe4, 0x05, 0x07, 0x06, 0x79, 0x79, 0x82, 0xb7, 0xd5, 0xf0, 0xd6, 0xda, 0xdc, 0xda, 0xd8, 0xd8, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xde, 0xda, 0xde, 0xee, 0xc7, 0xb6, 0x05, 0xbf, 0xd3, 0xa2, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xcc, 0xd0, 0x9f, 0xcc, 0x9f, 0xcf, 0xa9, 0xd3, 0x9f, 0xcc, 0xcc, 0xce, 0xa7, 0xab, 0xcb, 0xd3, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x74, 0xe1, 0xe4, 0x05, 0x06, 0x05, 0x05, 0x84, 0xe5, 0x84, 0xbf, 0xdd, 0xdd, 0xd9, 0xdc, 0xda, 0xd9, 0xd9, 0xdd, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xdc, 0xda, 0xf0, 0xd8, 0xc8, 0xd4, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xcb, 0xd0, 0xd3, 0xce, 0xce, 0xcc, 0xca, 0xa2, 0xd5, 0xa7, 0xcb, 0xd1, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x05, 0x05, 0xb4, 0x84, 0x06, 0x06, 0xe5, 0xe5, 0xe8, 0xd4, 0xe0, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdd, 0xd9, 0xd9, 0xde, 0xd6, 0xd0, 0xcf, 0xcb, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xa2, 0xce, 0xcc, 0xce, 0xce, 0x9f, 0xce, 0xce, 0xcc, 0xd4, 0xd4, 0xce, 0xcb, 0xcb, 0xd4, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x74, 0x00, 0x76, 0x76, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x76, 0xe2, 0xe5, 0x06, 0xf1, 0xb4, 0x07, 0xe6, 0xb4, 0xe5, 0xe4, 0xb5, 0xc8, 0xee, 0xde, 0xda, 0xda, 0xda, 0xda, 0xec, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xdc, 0xdd, 0xd6, 0xce, 0xce, 0xd0, 0xcb, 0xcf, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xcf, 0xce, 0x9f, 0xce, 0xce, 0xcf, 0x9f, 0xcf, 0xa9, 0xd0, 0xca, 0x9f, 0xcb, 0xd2, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x03, 0xe5, 0x05, 0x07, 0x08, 0xb4, 0x06, 0x06, 0xf1, 0xe5, 0x82, 0xb6, 0xc5, 0xde, 0xf0, 0xd9, 0xdd, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xd9, 0xdd, 0xd6, 0xcf, 0xcd, 0xcb, 0xcb, 0xcf, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xd3, 0xa7, 0xcc, 0xcb, 0xcc, 0xce, 0xd1, 0xc0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe3, 0x84, 0x07, 0x87, 0x08, 0x07, 0xb4, 0x07, 0x05, 0x05, 0x84, 0x06, 0xba, 0xc8, 0xdc, 0xde, 0xdd, 0xd9, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xec, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xdc, 0xde, 0xd8, 0xd0, 0xcb, 0xcf, 0xce, 0xd0, 0xcd, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcf, 0xce, 0xce, 0xce, 0x9f, 0xf2, 0xcf, 0xea, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xe1, 0x77, 0xe3, 0xe4, 0x05, 0x06, 0xb4, 0xf1, 0x08, 0xf1, 0x06, 0x06, 0x06, 0x05, 0xf1, 0xb5, 0xb7, 0xbc, 0xdc, 0xee, 0xd8, 0xda, 0xd9, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xdb, 0xd0, 0xcc, 0xa2, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xcf, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xa1, 0xcd, 0xcb, 0xcc, 0xcb, 0xce, 0xca, 0x84, 0xe5, 0xe5, 0x04, 0xe2, 0x77, 0xe1, 0xe1, 0x02, 0x02, 0x76, 0x01, 0x76, 0x74, 0x76, 0x76, 0x76, 0x76, 0x01, 0x76, 0x02, 0x01, 0x02, 0xe1, 0x03, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x07, 0x06, 0x06, 0xf1, 0x87, 0xb5, 0xb6, 0xb5, 0x08, 0x06, 0xe2, 0xc7, 0xda, 0xd4, 0xda, 0xd9, 0xd9, 0xdc, 0xda, 0xda, 0xd9, 0xd9, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xd4, 0x9f, 0xd0, 0xcb, 0xa2, 0xce, 0xa2, 0xce, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xcf, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcf, 0xcc, 0xcd, 0xcd, 0xcc, 0xcb, 0xd1, 0xc9, 0x84, 0xe6, 0x05, 0x05, 0x05, 0xe6, 0xe6, 0xe6, 0xe6, 0x05, 0x05, 0xe6, 0xe6, 0x84, 0xe6, 0x84, 0xe6, 0x84, 0x84, 0xe6, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x05, 0xe6, 0x06, 0x06, 0x07, 0xb5, 0xb5, 0xb5, 0x07, 0xe4, 0x02, 0x00, 0x76, 0xe4, 0xb8, 0xd4, 0xab, 0xd4, 0xd3, 0xd3, 0xd2, 0xd4, 0xd9, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xdc, 0xd7, 0xcb, 0xce, 0xce, 0xa2, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xcf, 0x9f, 0xcd, 0xcf, 0xce, 0xcc, 0xf5, 0xc6, 0xe6, 0x84, 0x84, 0xe6, 0x84, 0x79, 0x05, 0xe6, 0x05, 0xe6, 0x05, 0x05, 0x05, 0xe6, 0xe6, 0xe6, 0xe6, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xe6, 0xe6, 0x05, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x06, 0xb4, 0x08, 0xe7, 0xe7, 0x87, 0x07, 0x84, 0x77, 0x00, 0x00, 0x82, 0xb6, 0xc0, 0xc8, 0xd1, 0xeb, 0xeb, 0xcd, 0xce, 0xcb, 0xcf, 0xcc, 0xcd, 0xd1, 0xd8, 0xdd, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd1, 0x9f, 0xd0, 0x7a, 0xd0, 0xce, 0xa2, 0xce, 0xa2, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xcd, 0xcd, 0xce, 0xcd, 0xd6, 0xc3, 0xe3, 0x05, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x84, 0x79, 0x84, 0xe6, 0x84, 0xe6, 0xe6, 0xe6, 0xe6, 0x79, 0xe6, 0x05, 0x05, 0xe6, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x06, 0xb4, 0x08, 0x87, 0x87, 0x08, 0x05, 0xe6, 0xe4, 0xe2, 0x02, 0x00, 0x00, 0xe4, 0xe8, 0xc1, 0xc9, 0xcd, 0xd1, 0xd0, 0xcf, 0xcb, 0xcc, 0xf2, 0xce, 0xcd, 0xcf, 0xcf, 0xce, 0xcb, 0xd2, 0xd8, 0xdd, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xeb, 0xcc, 0xcf, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcc, 0xcd, 0xcc, 0xcd, 0xd0, 0xd9, 0xbf, 0x00, 0x03, 0xe2, 0xe4, 0xe4, 0x84, 0x84, 0x84, 0x84, 0xe6, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x07, 0x06, 0xe6, 0x84, 0xe4, 0xe2, 0x77, 0x02, 0x74, 0x00, 0x00, 0x00, 0x84, 0xbb, 0xc3, 0xd0, 0xd3, 0xd2, 0xce, 0xcf, 0xcb, 0xcb, 0xf2, 0xcc, 0xf2, 0xcc, 0xcc, 0xcf, 0xcd, 0xce, 0xcf, 0xd0, 0xcc, 0xd2, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xdc, 0xd9, 0xdc, 0xda, 0xce, 0xa2, 0xcf, 0xa1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xa1, 0xcf, 0xcb, 0xd4, 0xda, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0xe2, 0xe2, 0x04, 0x04, 0x04, 0xe2, 0x04, 0x04, 0x04, 0xe2, 0x03, 0x03, 0x02, 0x01, 0x74, 0x76, 0x74, 0x00, 0x74, 0x76, 0x00, 0x00, 0x01, 0x05, 0xbb, 0xc5, 0xcc, 0xcf, 0xd1, 0xce, 0xcb, 0xcb, 0xcb, 0xcb, 0xcc, 0xcb, 0xcc, 0xcb, 0xce, 0xcd, 0xf2, 0xce, 0xce, 0xf2, 0xce, 0xf2, 0xce, 0xcf, 0xeb, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xdc, 0xdd, 0xeb, 0xcf, 0xce, 0xcf, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xcf, 0xcd, 0xcb, 0xd5, 0xd9, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xbd, 0xc5, 0xa7, 0xd2, 0xa2, 0xd0, 0xce, 0x9f, 0xcb, 0x9f, 0xcb, 0xcb, 0xcc, 0xf2, 0xcc, 0xf2, 0xcc, 0xf2, 0xcc, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcc, 0xcf, 0xcc, 0xcf, 0xab, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xd9, 0xd0, 0xce, 0xa2, 0xcf, 0xa1, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcf, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xa2, 0xcd, 0xd0, 0xd9, 0xeb, 0xb4, 0x03, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x01, 0x00, 0x00, 0x76, 0x06, 0xc0, 0xc9, 0xd3, 0xd2, 0xcf, 0xca, 0xa2, 0xcf, 0x9f, 0xcc, 0xcc, 0xcc, 0xcb, 0xcc, 0xcc, 0xf2, 0xcc, 0xcd, 0xce, 0xcb, 0xce, 0xcc, 0xf2, 0xce, 0xf2, 0xce, 0xf2, 0xce, 0xcf, 0xcf, 0xca, 0xd3, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xdd, 0xd5, 0xcf, 0xcf, 0xce, 0xa2, 0xcf, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xcf, 0xcd, 0xa2, 0xcf, 0xcd, 0xd3, 0xdc, 0xc8, 0xe4, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0xe1, 0xb9, 0xc8, 0x75, 0xd2, 0xd1, 0xf2, 0xcc, 0xa2, 0xce, 0xcc, 0x9f, 0xcb, 0x9f, 0xce, 0xcc, 0x9f, 0xcc, 0xcd, 0xcc, 0xf2, 0xce, 0xf2, 0xcc, 0xf2, 0xcd, 0xce, 0xce, 0xce, 0xf2, 0xce, 0xcc, 0xcf, 0xcf, 0xcd, 0xcf, 0xd8, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xdc, 0xd3, 0xcd, 0xcf, 0xa2, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcf, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xcd, 0xcf, 0xd8, 0xda, 0xbd, 0xe5, 0xe2, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xbf, 0xd1, 0xd8, 0x75, 0xcf, 0xce, 0xcb, 0xcc, 0xcc, 0xcc, 0x9f, 0xcc, 0xce, 0xa2, 0xce, 0x7a, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0x75, 0xcb, 0xd4, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xd1, 0xcb, 0xcf, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcb, 0xd4, 0xd9, 0xd6, 0xb6, 0x06, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x00, 0x74, 0x74, 0x76, 0x00, 0x00, 0xbd, 0xcc, 0xd4, 0xa2, 0xcf, 0x9f, 0xcc, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xce, 0xcb, 0xcc, 0xcc, 0xcc, 0x7a, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xcf, 0x7a, 0xd0, 0xcc, 0xa7, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd8, 0xd0, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcf, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcf, 0xcb, 0xda, 0xdd, 0xc7, 0x84, 0xe6, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x08, 0xc7, 0xd6, 0xcb, 0x9f, 0xce, 0xca, 0xa2, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0x7a, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xcf, 0x7a, 0xce, 0xd8, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xdc, 0xd8, 0xce, 0xcf, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xcf, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcb, 0xd6, 0xd8, 0xf0, 0xba, 0x84, 0x06, 0xe2, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xba, 0xeb, 0xd0, 0xcb, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0xcc, 0x9f, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xa2, 0xcc, 0xcc, 0xd4, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdd, 0xd6, 0xcb, 0xd0, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcf, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xa2, 0xce, 0xcc, 0xd1, 0xd9, 0xda, 0xeb, 0xe4, 0xb4, 0x05, 0x81, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x7b, 0x00, 0x00, 0xbf, 0xd8, 0xca, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x9f, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xcc, 0xce, 0xce, 0xd1, 0xdc, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd6, 0xce, 0xcf, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xcf, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcf, 0xce, 0xcc, 0xd0, 0xd8, 0xd8, 0xe0, 0xbf, 0xe5, 0x05, 0x05, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xd4, 0xcb, 0xcf, 0xcb, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xa2, 0xce, 0xcc, 0xce, 0xce, 0xcf, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xdd, 0xd6, 0xcf, 0xcf, 0xcb, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcf, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xa2, 0xcf, 0xce, 0xce, 0xd5, 0xd9, 0xde, 0xd2, 0x87, 0xe6, 0xb4, 0x05, 0x7e, 0x00, 0x7b, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xd4, 0xcb, 0xcd, 0xcb, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xd9, 0xdc, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd8, 0xcf, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcd, 0xcf, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xa2, 0xd3, 0xdb, 0xd8, 0xf0, 0xbb, 0xe5, 0x08, 0xb4, 0x84, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x00, 0xb8, 0xd4, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcb, 0xd8, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xd2, 0xcc, 0xcf, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcf, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xd2, 0xda, 0xd9, 0xe0, 0xca, 0x84, 0xb4, 0x05, 0x06, 0x82, 0x74, 0x00, 0x7b, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xcb, 0xcf, 0xcd, 0xf2, 0xcd, 0xf2, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcb, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xdd, 0xd4, 0xce, 0xcf, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xd3, 0xaf, 0xda, 0xdb, 0xda, 0xb6, 0xe6, 0x08, 0x05, 0x07, 0x03, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xd0, 0xcc, 0xcb, 0xce, 0xcd, 0xcd, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xa2, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xde, 0xd6, 0xcc, 0xce, 0xce, 0xce, 0xcf, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcc, 0xce, 0xcf, 0xce, 0xcb, 0xd3, 0xd8, 0xda, 0xda, 0xe0, 0xc0, 0x84, 0xb4, 0x06, 0x06, 0xe6, 0x02, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb6, 0xeb, 0xd4, 0xd4, 0xd4, 0xeb, 0xd4, 0xd4, 0xeb, 0xd4, 0xd3, 0xd1, 0xa2, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xd0, 0xcc, 0xa2, 0xcc, 0xd0, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd4, 0xcb, 0xce, 0xcf, 0xcb, 0xce, 0xcf, 0xce, 0xf2, 0xce, 0xf2, 0xce, 0xce, 0xf2, 0xcc, 0xcf, 0xcc, 0xcc, 0xce, 0xf2, 0xcc, 0xf2, 0xcf, 0xcb, 0xce, 0xeb, 0xdc, 0xd9, 0xdc, 0xef, 0xc9, 0x06, 0x06, 0x07, 0x06, 0x07, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x76, 0x00, 0xc3, 0xd6, 0xd0, 0xd0, 0xd0, 0xce, 0xcf, 0xcf, 0xcf, 0xd0, 0xa7, 0xd0, 0xce, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xa2, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcf, 0xce, 0xce, 0xcf, 0xce, 0xd3, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdd, 0xd0, 0xcb, 0xce, 0xd0, 0xcf, 0xcc, 0xcf, 0xcc, 0xce, 0xcd, 0xce, 0xf2, 0xce, 0xce, 0xf2, 0xcc, 0xf2, 0xcf, 0xcf, 0xcf, 0xce, 0xce, 0xd1, 0xd6, 0xd9, 0xda, 0xda, 0xda, 0xd8, 0xb5, 0x84, 0xe7, 0x07, 0x07, 0xe6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xd2, 0xca, 0xcb, 0xca, 0xca, 0xcc, 0xcf, 0xd0, 0xd0, 0xd0, 0xce, 0xcc, 0x9f, 0xcc, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xcf, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xa2, 0xcc, 0xa2, 0xcc, 0xd0, 0xd8, 0xdc, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xd9, 0xdc, 0xdc, 0xd9, 0xdc, 0xd9, 0xd4, 0xcb, 0xcb, 0xce, 0xf2, 0xce, 0xf2, 0xce, 0xf2, 0xce, 0xcd, 0xce, 0xcd, 0xce, 0xcf, 0xcf, 0xcc, 0xcb, 0xcb, 0xcf, 0xd4, 0xd8, 0xdc, 0xd9, 0xda, 0xee, 0xdd, 0xb7, 0x79, 0x08, 0xb4, 0x07, 0xe7, 0xe4, 0x74, 0x76, 0x76, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xbc, 0xeb, 0xcb, 0xd3, 0xd3, 0xd3, 0xeb, 0xd4, 0xd3, 0xd2, 0xcf, 0xce, 0xce, 0xcc, 0xcc, 0x9f, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xa2, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xcf, 0xd0, 0xcb, 0xa9, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xdc, 0xd9, 0xdc, 0xda, 0xd4, 0xce, 0xcb, 0xcf, 0xcc, 0xce, 0xce, 0xcd, 0xce, 0xf2, 0xce, 0xce, 0xce, 0xcf, 0xcd, 0xcb, 0xd0, 0xd4, 0xd8, 0xda, 0xdc, 0xd9, 0xda, 0xde, 0xd9, 0xb7, 0xe6, 0x07, 0x08, 0x06, 0x08, 0x06, 0x02, 0x76, 0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xc1, 0xde, 0xda, 0xeb, 0xeb, 0xd3, 0xcf, 0xcc, 0xcb, 0xca, 0xcb, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xcf, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xa2, 0xcc, 0xd0, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xd0, 0xcf, 0xcd, 0xca, 0xcb, 0xf2, 0xcc, 0xcc, 0xcc, 0xcb, 0xcb, 0xcc, 0xcf, 0xd3, 0xd8, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xe0, 0xab, 0xba, 0x82, 0xb4, 0xb4, 0x08, 0xb4, 0xe7, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xbe, 0xd2, 0xd1, 0xce, 0xcf, 0xcc, 0xcd, 0xce, 0xcd, 0xcf, 0xce, 0xce, 0xcc, 0xcc, 0xce, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xa2, 0xcf, 0xa2, 0xce, 0xcf, 0xcc, 0xd7, 0xdd, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd8, 0xee, 0xda, 0xd8, 0xab, 0xd5, 0xd3, 0xd2, 0xd2, 0xd3, 0xd5, 0xd8, 0xd8, 0xdc, 0xde, 0xd8, 0xda, 0xda, 0xd9, 0xda, 0xe0, 0xc9, 0x87, 0x82, 0xe7, 0x08, 0x87, 0x07, 0xe7, 0xe6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x74, 0x00, 0xb6, 0xd8, 0xcf, 0xcd, 0xcc, 0xf2, 0xcb, 0xcc, 0xf2, 0xce, 0xcc, 0xcb, 0xcc, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x9f, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcc, 0xcc, 0xcf, 0xa2, 0xcc, 0x9f, 0xd6, 0xaf, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xd8, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xdd, 0xda, 0xda, 0xd9, 0xdd, 0xd9, 0xd8, 0xdc, 0xd9, 0xd8, 0xef, 0xb3, 0xc1, 0x06, 0x84, 0xb5, 0x07, 0x08, 0xb4, 0x08, 0x87, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe2, 0xab, 0xce, 0xf2, 0xcc, 0xcc, 0xcf, 0xcc, 0xcb, 0xcb, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0x9f, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x9f, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xcf, 0xa2, 0xce, 0xa2, 0xcf, 0xa7, 0xdd, 0xdc, 0xaf, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xde, 0xd9, 0xd9, 0xde, 0xdd, 0xdd, 0xda, 0xd8, 0xd6, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xd8, 0xd9, 0xda, 0xde, 0xe0, 0xee, 0xc8, 0xb7, 0x82, 0xb4, 0x06, 0x07, 0x87, 0xb4, 0xf1, 0x87, 0x82, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x76, 0x00, 0x00, 0xc7, 0xd1, 0xce, 0xce, 0xcb, 0xcb, 0xcf, 0xd1, 0xd3, 0xd4, 0xd1, 0xce, 0xcc, 0xcb, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xa2, 0xcf, 0xce, 0xce, 0xd4, 0xdc, 0xdb, 0xda, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xdd, 0xc6, 0xd8, 0xde, 0xee, 0xde, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xdd, 0xee, 0xdf, 0xef, 0xab, 0xea, 0xbb, 0x05, 0x84, 0x87, 0xe7, 0x87, 0xb4, 0x08, 0x06, 0xb5, 0xe4, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x76, 0x00, 0x00, 0xc0, 0xd3, 0xcf, 0xd3, 0xd4, 0xd5, 0xd5, 0xeb, 0xd3, 0xd0, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x9f, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcf, 0xce, 0xa2, 0xeb, 0xaf, 0xda, 0xdc, 0xdc, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xdc, 0xb5, 0xb6, 0xbd, 0xc5, 0xd0, 0xf6, 0xd8, 0xd9, 0xdc, 0xf7, 0xd4, 0xce, 0xc3, 0xbd, 0xb5, 0xe6, 0xe6, 0x08, 0x08, 0x08, 0xb4, 0xf1, 0x06, 0x08, 0xe7, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xbb, 0xd6, 0xd5, 0xd6, 0xd6, 0xd1, 0xd0, 0xcf, 0xcc, 0xcb, 0xcc, 0xce, 0xcb, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcf, 0xce, 0xcf, 0xd3, 0xdc, 0xdc, 0xd9, 0xde, 0xd2, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xdc, 0xd9, 0xed, 0xd9, 0xf1, 0xe4, 0xe5, 0x84, 0x07, 0xb5, 0xb7, 0xb8, 0xb8, 0xb6, 0xb5, 0x07, 0xe6, 0x06, 0xb4, 0xf1, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x87, 0xf1, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x03, 0xb5, 0xbf, 0xab, 0xcb, 0xcb, 0xcc, 0xcd, 0xce, 0xce, 0xcd, 0xf2, 0xce, 0xcf, 0xcd, 0xcb, 0xce, 0xf2, 0xcd, 0xf2, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xf2, 0xce, 0xf2, 0xce, 0xcf, 0xcf, 0xce, 0xf2, 0xce, 0xd0, 0xce, 0xcf, 0xd5, 0xdd, 0xda, 0xda, 0xe0, 0xc2, 0xe9, 0xf0, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xed, 0xd6, 0xe6, 0xe6, 0x06, 0x05, 0xe6, 0x06, 0x07, 0x07, 0x07, 0x07, 0xb4, 0x08, 0x87, 0x08, 0x08, 0x08, 0x08, 0x87, 0x07, 0xb4, 0xe7, 0xb5, 0x06, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xe2, 0xb6, 0x84, 0xc1, 0xd2, 0xcb, 0xcb, 0xce, 0xf2, 0xcc, 0xf2, 0xce, 0xcb, 0xcd, 0xce, 0xcc, 0xcd, 0xcc, 0xcc, 0xcc, 0xf2, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcc, 0xce, 0xce, 0xcf, 0xce, 0xcf, 0xcf, 0xcf, 0xcb, 0xd1, 0xab, 0xde, 0xda, 0xd9, 0xf0, 0xcb, 0x04, 0xe9, 0xf0, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xde, 0xf6, 0xe4, 0x05, 0xe6, 0xe6, 0x05, 0xe6, 0xe6, 0x06, 0x08, 0xe7, 0xe7, 0xe7, 0x08, 0x87, 0x08, 0x08, 0xb4, 0xf1, 0xb5, 0x08, 0x07, 0xe3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xe2, 0xb5, 0xe7, 0x84, 0xc1, 0xdc, 0xd1, 0xd0, 0xcf, 0xcf, 0xcf, 0xd0, 0xd2, 0xd4, 0xd1, 0xf2, 0xcc, 0xf2, 0xcc, 0xf2, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xf2, 0xcf, 0xcc, 0xcf, 0xcf, 0xcc, 0xcb, 0x75, 0xd4, 0xd9, 0xde, 0xd9, 0xda, 0xf0, 0xc7, 0x06, 0x82, 0xe8, 0xf0, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xec, 0xda, 0xd9, 0xe3, 0xe6, 0x05, 0x84, 0x05, 0x05, 0x05, 0xe6, 0x05, 0x06, 0x07, 0x08, 0xe7, 0xe7, 0xe7, 0xe7, 0x87, 0x07, 0x84, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xe1, 0xe7, 0xe7, 0xe7, 0x07, 0xc6, 0xf0, 0xd6, 0xeb, 0xd4, 0xd6, 0xd5, 0xd4, 0xd0, 0xcc, 0xce, 0xcc, 0xcc, 0xce, 0xcd, 0xf2, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xce, 0xf2, 0xce, 0xcc, 0xf2, 0xd3, 0xd6, 0xda, 0xda, 0xdc, 0xd9, 0xf0, 0xc7, 0x08, 0xe5, 0xe5, 0xe9, 0xf0, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xf8, 0xd5, 0xe5, 0xe6, 0xe6, 0x05, 0x05, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x05, 0x05, 0xe3, 0x82, 0xe2, 0xe1, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x87, 0x08, 0x87, 0xf1, 0xe5, 0xc0, 0xee, 0xda, 0xeb, 0xcf, 0xcf, 0xcc, 0xcf, 0xcd, 0xcf, 0xcf, 0xf2, 0xce, 0xcb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x9f, 0xcc, 0xcf, 0xf2, 0xce, 0xce, 0xce, 0xd3, 0xd8, 0xdd, 0xd9, 0xda, 0xdc, 0xee, 0xdd, 0xbf, 0xe5, 0x84, 0x06, 0xe4, 0xbd, 0xf0, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xf7, 0xdd, 0xf6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0x05, 0x05, 0x05, 0xe6, 0xe6, 0x05, 0x05, 0x02, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x06, 0xe7, 0x07, 0x87, 0x08, 0x05, 0xe8, 0xd8, 0xf0, 0xd6, 0xd2, 0xcf, 0xce, 0xcb, 0xce, 0xcc, 0xcc, 0xcd, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xcc, 0xcc, 0xcc, 0xcb, 0xcc, 0xcc, 0x75, 0xeb, 0xd8, 0xda, 0xda, 0xd8, 0xda, 0xde, 0xef, 0xd4, 0xb9, 0x84, 0xe6, 0x06, 0x06, 0xe4, 0xbd, 0xf0, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xf8, 0xd6, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x79, 0xe6, 0x79, 0xe6, 0x05, 0x03, 0x74, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x81, 0xb5, 0xb4, 0x87, 0x87, 0x08, 0x84, 0xb5, 0x96, 0xb3, 0xef, 0xd8, 0xd4, 0xd1, 0xcf, 0xce, 0xcb, 0xcc, 0xcb, 0xcb, 0xcb, 0x9f, 0xcb, 0x9f, 0xcb, 0x9f, 0xce, 0xd0, 0xa7, 0xd4, 0xd8, 0xda, 0xda, 0xd9, 0xd6, 0xda, 0xde, 0xe0, 0xdc, 0xbf, 0x05, 0xe3, 0x05, 0x05, 0x05, 0x06, 0xe4, 0xbe, 0xf0, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xf8, 0xd6, 0x84, 0xe6, 0xe6, 0xe6, 0xe6, 0x05, 0x79, 0x84, 0xe6, 0xe6, 0x79, 0xe6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x08, 0x08, 0xb4, 0xe7, 0x87, 0x06, 0x84, 0xb9, 0xc5, 0xdd, 0xef, 0xda, 0xd9, 0xab, 0xeb, 0xd4, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd6, 0xd7, 0xda, 0xaf, 0xda, 0xd9, 0xd8, 0xde, 0xe0, 0xee, 0xda, 0x96, 0xb5, 0x84, 0x79, 0x07, 0x05, 0x05, 0x06, 0x05, 0xe4, 0xbf, 0xf0, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xdc, 0xdc, 0xf6, 0xe6, 0x84, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x84, 0xe6, 0x84, 0x06, 0xe1, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x03, 0xb4, 0x08, 0xb4, 0xb4, 0xb4, 0x87, 0x06, 0x79, 0xe5, 0xb8, 0x96, 0xeb, 0xe0, 0xe0, 0xee, 0xde, 0xdc, 0xda, 0xdb, 0xda, 0xda, 0xdb, 0xda, 0xaf, 0xda, 0xda, 0xda, 0xdd, 0xde, 0xef, 0xf0, 0xee, 0xcb, 0xbf, 0xb5, 0xe6, 0x84, 0xe6, 0x06, 0xe6, 0x05, 0xe6, 0x06, 0x05, 0xe4, 0xbf, 0xf0, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xed, 0xda, 0xd9, 0xe6, 0x84, 0x05, 0xe6, 0xe6, 0x05, 0xe6, 0x05, 0xe6, 0xe6, 0x79, 0xe6, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x08, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0xe4, 0xe6, 0xb8, 0xc0, 0xca, 0xd4, 0xd9, 0xdd, 0xda, 0xde, 0xee, 0xde, 0xde, 0xee, 0xde, 0xdc, 0xd8, 0xeb, 0xcb, 0xea, 0xe9, 0xb5, 0x84, 0x84, 0x05, 0xe6, 0x05, 0x05, 0xe6, 0x05, 0x05, 0x05, 0xe6, 0x05, 0xe4, 0xc2, 0x73, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xf7, 0xdc, 0xda, 0xf7, 0x06, 0x84, 0xe6, 0xe6, 0xe6, 0xe6, 0x05, 0xe6, 0xe6, 0xe6, 0x84, 0x05, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xe3, 0x08, 0xf1, 0x06, 0xf1, 0x87, 0xf1, 0xb4, 0xf1, 0xb4, 0x06, 0x79, 0xe4, 0xe6, 0x07, 0x72, 0xb9, 0xbb, 0xe9, 0xbc, 0xbd, 0xbc, 0xe9, 0xe8, 0xb8, 0xb5, 0xe7, 0x84, 0x82, 0x06, 0x08, 0x08, 0x08, 0x07, 0x06, 0x84, 0x84, 0x05, 0x05, 0x05, 0x05, 0xe6, 0x05, 0xe4, 0xc3, 0xef, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xda, 0x87, 0x84, 0x05, 0xe6, 0xe6, 0xe6, 0xe6, 0x05, 0x79, 0xe6, 0xe6, 0xe6, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xe3, 0x07, 0x08, 0xb4, 0x07, 0x87, 0x08, 0xb4, 0x08, 0x08, 0xe7, 0x08, 0xb4, 0x07, 0x07, 0x05, 0xe6, 0x79, 0xe6, 0x84, 0x84, 0xe6, 0x05, 0x07, 0x07, 0x05, 0xf1, 0xe7, 0x07, 0x06, 0x08, 0xe4, 0xe2, 0x84, 0x05, 0x05, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x05, 0xe5, 0xc7, 0xee, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xec, 0xdc, 0xed, 0xb5, 0x84, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x79, 0xe6, 0xe4, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xe1, 0xe6, 0xe7, 0x08, 0xf1, 0x07, 0x08, 0x08, 0x07, 0xb4, 0x08, 0x06, 0xb4, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xb4, 0x08, 0xb4, 0x08, 0x08, 0x07, 0x07, 0xe7, 0x08, 0xe3, 0x76, 0x04, 0xe6, 0x84, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 0xc9, 0xef, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xf8, 0xda, 0xb6, 0x84, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x05, 0x79, 0xe6, 0x84, 0xe6, 0xe5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x82, 0x05, 0x08, 0x08, 0xb4, 0x07, 0xb4, 0x07, 0x08, 0x08, 0x08, 0x07, 0x08, 0xb4, 0xb4, 0xb4, 0x07, 0x08, 0xf1, 0xb4, 0xf1, 0xb4, 0x08, 0xe7, 0x08, 0xe5, 0x02, 0x00, 0x01, 0x84, 0x84, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0x84, 0xe6, 0xe6, 0x84, 0xcb, 0xee, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xf7, 0xe0, 0xb6, 0x84, 0xe6, 0x05, 0x05, 0x05, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x79, 0xe6, 0x02, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe3, 0xe6, 0x07, 0x08, 0x08, 0x08, 0xf1, 0xb4, 0xf1, 0xb4, 0x07, 0xb4, 0xf1, 0x08, 0x08, 0x08, 0x08, 0xe7, 0x87, 0x07, 0x05, 0xe3, 0x02, 0x00, 0x00, 0x00, 0xe3, 0xe6, 0xe5, 0x84, 0xe6, 0x84, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x84, 0xd2, 0xee, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xf8, 0xdc, 0x73, 0xba, 0xe5, 0x05, 0x05, 0x05, 0x05, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe3, 0x84, 0x05, 0xb4, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x84, 0x04, 0x02, 0x76, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe4, 0xe4, 0xe5, 0xe6, 0x84, 0xe6, 0xe6, 0x84, 0xe6, 0xe6, 0x84, 0x08, 0xd6, 0xde, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xee, 0xe9, 0xe4, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xe6, 0x05, 0x05, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x76, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x74, 0x02, 0xe1, 0xe2, 0x04, 0xe3, 0xe3, 0xe2, 0x03, 0x02, 0x02, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xe2, 0xe5, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe6, 0x05, 0x84, 0x84, 0xe5, 0xb6, 0xd8, 0xf8, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xee, 0xbf, 0x82, 0x05, 0x05, 0xe6, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x84, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x76, 0x76, 0x74, 0x00, 0x00, 0x02, 0x82, 0x04, 0xe2, 0x03, 0x03, 0xe3, 0x04, 0x04, 0xe4, 0x84, 0x05, 0xe4, 0xb7, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xdc, 0xd9, 0xda, 0xf7, 0xda, 0xdc, 0xf7, 0xf8, 0xee, 0xc1, 0xe4, 0xe6, 0x05, 0x05, 0x84, 0xe4, 0xe5, 0xe5, 0xe5, 0x05, 0x06, 0x06, 0xe6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x76, 0x00, 0x02, 0x03, 0x84, 0xe8, 0xc0, 0xc2, 0xc3, 0xc1, 0xbb, 0xb4, 0xe4, 0x84, 0xe4, 0xba, 0xee, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xaf, 0xb0, 0xda, 0xda, 0xdc, 0xed, 0xdd, 0xf8, 0xdc, 0xf7, 0xfe, 0xda, 0xde, 0xea, 0xe3, 0xf1, 0x84, 0x04, 0x87, 0xb9, 0xbb, 0xba, 0xb5, 0xfa, 0xe3, 0x79, 0xb4, 0x77, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x01, 0x00, 0x74, 0xe9, 0xca, 0xeb, 0xf4, 0xd1, 0x9d, 0x9b, 0xc1, 0xbd, 0x08, 0x83, 0x83, 0xe9, 0xee, 0xed, 0xda, 0xb1, 0xda, 0x6c, 0xf7, 0xfe, 0xda, 0xda, 0xdb, 0xdb, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xdc, 0xaf, 0xdc, 0xd8, 0xdd, 0xda, 0xdc, 0xed, 0xf8, 0x71, 0xf7, 0xee, 0xca, 0x82, 0xe2, 0xb6, 0xea, 0xa2, 0xa9, 0xa8, 0xd1, 0xcb, 0xc2, 0xe8, 0x85, 0x79, 0x84, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0xc3, 0xd9, 0xd4, 0xd1, 0xa9, 0xd3, 0xa7, 0xa5, 0xc6, 0xbf, 0xba, 0xe4, 0x00, 0xc0, 0xf0, 0xec, 0xda, 0xdb, 0xde, 0xee, 0xdc, 0xf7, 0xda, 0xda, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd8, 0xda, 0xd8, 0xde, 0xdd, 0xd3, 0xcb, 0xc7, 0xc7, 0xc8, 0xcb, 0xcf, 0xd9, 0xd1, 0x84, 0xe9, 0xf3, 0xf5, 0xd0, 0xa1, 0xa5, 0xa5, 0xd2, 0xd0, 0x9f, 0xbf, 0xb6, 0x83, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xc4, 0xd7, 0xd3, 0xa7, 0xd1, 0xa1, 0xcd, 0xa5, 0xcd, 0xd4, 0xca, 0xbb, 0xbb, 0xbd, 0xc7, 0xc7, 0xc7, 0xc6, 0xc6, 0xc7, 0xce, 0xda, 0xde, 0xdd, 0xda, 0xd9, 0xdb, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xdc, 0xdc, 0xda, 0xee, 0xeb, 0xc6, 0xc4, 0xc4, 0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0x96, 0xc7, 0xc7, 0xa9, 0xa4, 0xa1, 0xd0, 0xa3, 0xa3, 0xa3, 0xa1, 0xa7, 0xa5, 0xa8, 0x9d, 0xb8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xc0, 0xee, 0xa4, 0xa7, 0xa2, 0xa4, 0xa7, 0xa2, 0xd0, 0xf3, 0xd0, 0xd5, 0x96, 0x9d, 0xa1, 0xc7, 0xc6, 0xc7, 0xc7, 0xc7, 0xc4, 0xc2, 0xc4, 0x75, 0xd8, 0xdc, 0xdb, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xed, 0xf8, 0xf4, 0xea, 0xea, 0xc5, 0xc6, 0xc7, 0x9d, 0x9f, 0xa0, 0x9f, 0x9d, 0xc8, 0xc6, 0xa0, 0xa3, 0xa3, 0xa2, 0xa2, 0xa3, 0xa4, 0xd0, 0xd0, 0xa1, 0xa3, 0xa3, 0x9d, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xbf, 0xb0, 0xd0, 0xa7, 0xcf, 0xa7, 0xd0, 0xce, 0xd0, 0xf3, 0xf3, 0xa2, 0xa5, 0xa8, 0xa1, 0x9f, 0xcc, 0xcb, 0x9f, 0xcd, 0x9f, 0x9d, 0xc9, 0xc6, 0xc2, 0x9d, 0xd8, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xdc, 0xdc, 0xd9, 0xda, 0xf8, 0xd5, 0xea, 0xc4, 0xc7, 0xc8, 0x9f, 0xa2, 0xa2, 0xa0, 0x9d, 0xce, 0xf2, 0xcf, 0xca, 0x9e, 0xa3, 0xa3, 0xa5, 0xa7, 0xeb, 0xf6, 0xf5, 0xf4, 0xcd, 0xa4, 0xa3, 0xa1, 0x9f, 0x08, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x76, 0x00, 0x00, 0xb8, 0xd7, 0xa9, 0xd0, 0xd2, 0xf3, 0xf5, 0x67, 0xfd, 0x67, 0x69, 0xf4, 0xa4, 0xa3, 0xa5, 0xa1, 0xcd, 0x60, 0x75, 0xf2, 0xcb, 0x5e, 0xcb, 0xca, 0x9d, 0xc7, 0xc4, 0xc8, 0xda, 0xdd, 0xdc, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xdc, 0xdd, 0xd7, 0xc8, 0xea, 0xc7, 0xca, 0xa2, 0xa1, 0xcc, 0x9f, 0x9f, 0xcc, 0x60, 0x61, 0x63, 0xf4, 0xa1, 0xa5, 0xa0, 0xd4, 0xc9, 0x47, 0xbd, 0x56, 0x60, 0x68, 0x9f, 0xd0, 0xa0, 0xd1, 0xc7, 0x04, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe6, 0xce, 0xa9, 0xd0, 0xf5, 0xf3, 0x68, 0x5c, 0x4d, 0x27, 0x31, 0x58, 0xfd, 0xa7, 0xa8, 0xa3, 0xa4, 0x66, 0x63, 0x5b, 0x5a, 0x5f, 0x60, 0x5e, 0xca, 0xcb, 0x9d, 0xc8, 0xc7, 0xc9, 0x6c, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0xdd, 0xa4, 0xc6, 0xc7, 0x9d, 0xa2, 0x9f, 0xcb, 0x9f, 0xcc, 0xcf, 0x5f, 0x53, 0x4b, 0x52, 0x58, 0xeb, 0x7a, 0xd3, 0x60, 0x31, 0x22, 0x29, 0x17, 0x3c, 0x5c, 0xfd, 0xcb, 0xcf, 0xcd, 0xf5, 0xbe, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xc2, 0xd6, 0xa7, 0xd1, 0xf3, 0x69, 0x5c, 0x31, 0x17, 0x30, 0x24, 0x27, 0x5a, 0x78, 0xa4, 0xa3, 0x69, 0x5b, 0x44, 0x25, 0x27, 0x41, 0x5a, 0x61, 0xcb, 0xcb, 0x9d, 0x9d, 0x9d, 0xc8, 0xcf, 0xdd, 0xdc, 0xd9, 0xdd, 0xd9, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xdc, 0xd7, 0xc9, 0xc6, 0x9d, 0x9f, 0x9f, 0xcc, 0xcc, 0xcc, 0xcc, 0x5a, 0x27, 0x1b, 0x23, 0x1b, 0x17, 0x55, 0xeb, 0x68, 0x58, 0x22, 0x32, 0x32, 0x32, 0x24, 0x27, 0x5e, 0xf4, 0xcd, 0xf3, 0xcd, 0xd2, 0xb9, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb9, 0xd5, 0xcf, 0xa7, 0xcf, 0x67, 0x63, 0x27, 0x22, 0x2f, 0x2b, 0x33, 0x23, 0x4d, 0x6e, 0xd2, 0x6a, 0x58, 0x24, 0x2e, 0x3d, 0x34, 0x30, 0x31, 0x5f, 0x60, 0xca, 0x9f, 0x9d, 0xc9, 0xc9, 0xca, 0xeb, 0xdd, 0xd8, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xdc, 0x78, 0x9d, 0xc8, 0x9f, 0xcc, 0x9f, 0xcb, 0x9f, 0xcb, 0xcd, 0x5a, 0x25, 0x29, 0x32, 0x28, 0x25, 0x27, 0x61, 0x6e, 0x58, 0x24, 0x33, 0x34, 0x32, 0x32, 0x17, 0x55, 0xfd, 0xf3, 0xcb, 0xcf, 0xd1, 0xc9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xca, 0xf5, 0xa2, 0xa4, 0xce, 0xfd, 0x58, 0x22, 0x29, 0x32, 0x33, 0x28, 0x29, 0x47, 0x69, 0x67, 0x64, 0x38, 0x2e, 0x3b, 0x3b, 0x39, 0x3a, 0x30, 0x5b, 0x60, 0xca, 0x9d, 0x9f, 0xc9, 0xf2, 0xcb, 0xcf, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xdc, 0xd9, 0xd0, 0x9f, 0xca, 0xc9, 0xcb, 0xca, 0x9f, 0xcc, 0xcb, 0x61, 0x59, 0x22, 0x29, 0x37, 0x2a, 0x23, 0x21, 0x5a, 0x6e, 0x58, 0x22, 0x32, 0x34, 0x34, 0x2e, 0x24, 0x50, 0x63, 0xf2, 0xcd, 0xcd, 0xcc, 0xab, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xbd, 0xd8, 0xcf, 0xcc, 0xa7, 0x9f, 0x67, 0x4d, 0x1f, 0x29, 0x2a, 0x2c, 0x32, 0x23, 0x47, 0x6b, 0x6d, 0x53, 0x24, 0x37, 0x36, 0x35, 0x37, 0x3b, 0x32, 0x62, 0xa2, 0xa0, 0x9d, 0xcd, 0xf3, 0xcf, 0xa2, 0xcc, 0xd6, 0xde, 0xd9, 0xdd, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xdc, 0xab, 0xce, 0xa4, 0xd0, 0xcf, 0xcd, 0x9d, 0x9d, 0xa0, 0xcc, 0xf2, 0x61, 0x24, 0x2d, 0x26, 0x35, 0x32, 0x17, 0x5c, 0x6d, 0x5c, 0x25, 0x33, 0x33, 0x33, 0x3a, 0x14, 0x55, 0x60, 0xcf, 0xcc, 0xce, 0xcc, 0xd0, 0xa4, 0x08, 0x00, 0x76, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xe5, 0xf2, 0xd2, 0xf3, 0xcc, 0xcc, 0xf4, 0x63, 0x53, 0x1d, 0x24, 0x2b, 0x2f, 0x29, 0x1f, 0x50, 0x6f, 0x67, 0x4d, 0x24, 0x39, 0x36, 0x3b, 0x37, 0x34, 0x3e, 0x64, 0xa4, 0xa3, 0xa7, 0xd2, 0xd3, 0xd3, 0xa1, 0xcc, 0xd5, 0xdd, 0xda, 0xdc, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xd3, 0xcc, 0xa4, 0xd1, 0xd2, 0xf4, 0xd1, 0x7a, 0x9d, 0x7a, 0xa0, 0x64, 0x47, 0x1c, 0x28, 0x28, 0x23, 0x22, 0x63, 0x68, 0x66, 0x3c, 0x29, 0x32, 0x2c, 0x29, 0x22, 0x5e, 0x60, 0xa1, 0x9f, 0xa0, 0xcd, 0xca, 0xd4, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xbe, 0xab, 0xcb, 0xd0, 0x60, 0xf2, 0xf2, 0x60, 0x5a, 0x17, 0x25, 0x24, 0x24, 0x22, 0x27, 0x5e, 0xd6, 0x6a, 0x53, 0x22, 0x34, 0x37, 0x35, 0x39, 0x1f, 0x57, 0x67, 0x78, 0xa9, 0xab, 0x67, 0x67, 0xa7, 0xa0, 0x9f, 0xd2, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xdc, 0xd0, 0xcb, 0xcc, 0xfd, 0x5e, 0x5e, 0x69, 0x67, 0xa2, 0x7a, 0x7a, 0xd1, 0x5d, 0x38, 0x25, 0x25, 0x31, 0x58, 0x6a, 0xd1, 0xd5, 0x58, 0x24, 0x22, 0x25, 0x38, 0x55, 0xfd, 0x7a, 0x9d, 0xa1, 0x9f, 0xce, 0xce, 0xa2, 0xd8, 0x08, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf2, 0xd2, 0xf3, 0xcb, 0xcf, 0x60, 0xcb, 0x63, 0x66, 0x4d, 0x22, 0x17, 0x17, 0x27, 0x5a, 0x6c, 0x75, 0xeb, 0x63, 0x47, 0x24, 0x2b, 0x29, 0x20, 0x4d, 0xfd, 0x78, 0xd6, 0x69, 0x69, 0x69, 0x6d, 0xd0, 0x7a, 0xca, 0xd0, 0xdc, 0xdc, 0xd9, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xcf, 0xf2, 0x63, 0x53, 0x31, 0x41, 0x50, 0x5c, 0x6c, 0x75, 0xce, 0x7a, 0xa5, 0x75, 0x5e, 0x5c, 0x60, 0x6a, 0x78, 0xeb, 0xd4, 0x6a, 0x5e, 0x59, 0x58, 0x5d, 0xfd, 0xcb, 0xa2, 0x7a, 0x7a, 0xcd, 0xcc, 0xcb, 0xcb, 0xd8, 0xc1, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x74, 0x00, 0xb7, 0xda, 0xf2, 0xd0, 0xcb, 0xf4, 0xca, 0xcb, 0xf2, 0xf2, 0x63, 0x5c, 0x57, 0x59, 0x64, 0x6e, 0x6a, 0x6a, 0x6a, 0x66, 0x64, 0x59, 0x54, 0x50, 0x58, 0xfd, 0x78, 0x6a, 0x61, 0x4d, 0x3c, 0x3c, 0x50, 0xfd, 0xf2, 0x9d, 0xf2, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xdc, 0xda, 0xd8, 0xcc, 0x60, 0x5a, 0x22, 0x30, 0x32, 0x1d, 0x25, 0x57, 0x66, 0xf2, 0xa4, 0xa0, 0xa2, 0x78, 0x6e, 0x6b, 0x61, 0x5c, 0x5c, 0x5d, 0x64, 0x6a, 0xfd, 0x64, 0xf4, 0xca, 0x7a, 0x9f, 0xca, 0xf2, 0xcb, 0x7a, 0xcb, 0x7a, 0xd2, 0xab, 0xe7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x74, 0xc2, 0xab, 0xce, 0xf2, 0xf2, 0xca, 0xa4, 0x75, 0x9d, 0xcf, 0x5e, 0x64, 0x69, 0x6b, 0x63, 0x5a, 0x58, 0x58, 0x5c, 0x64, 0x6b, 0x68, 0x64, 0x67, 0xfd, 0x75, 0x66, 0x5e, 0x27, 0x22, 0x24, 0x24, 0x13, 0x4d, 0x60, 0xcb, 0xcb, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd6, 0xcc, 0xf3, 0x53, 0x24, 0x32, 0x2a, 0x2e, 0x23, 0x38, 0x5f, 0x63, 0xf2, 0x75, 0x67, 0x64, 0x55, 0x4b, 0x3e, 0x2f, 0x24, 0x2f, 0x38, 0x53, 0x61, 0x68, 0x60, 0xcb, 0xce, 0xa1, 0xcc, 0xf2, 0xca, 0xcd, 0x9f, 0xcc, 0xcf, 0xee, 0xbf, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x84, 0xd2, 0xd3, 0xf2, 0xcf, 0xcb, 0xcf, 0x7a, 0x9f, 0xa1, 0xf2, 0x60, 0x65, 0x5d, 0x4b, 0x27, 0x17, 0x21, 0x17, 0x1f, 0x3c, 0x53, 0x65, 0x6a, 0xf2, 0xa4, 0x75, 0x6a, 0x4d, 0x13, 0x32, 0x29, 0x29, 0x25, 0x27, 0x5f, 0xf2, 0xcb, 0xd9, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd6, 0xce, 0x60, 0x4d, 0x24, 0x2a, 0x35, 0x2d, 0x2a, 0x1d, 0x57, 0xfd, 0x61, 0x65, 0x57, 0x30, 0x29, 0x2a, 0x34, 0x35, 0x39, 0x34, 0x2f, 0x24, 0x1f, 0x4b, 0x5b, 0x66, 0xca, 0xca, 0xcd, 0x5e, 0xcf, 0x9f, 0xcb, 0xcc, 0xcc, 0xda, 0xce, 0xe5, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe9, 0xd9, 0xd0, 0xf2, 0xcd, 0xf2, 0xcd, 0xcc, 0xce, 0xce, 0x63, 0x5d, 0x4b, 0x12, 0x1f, 0x29, 0x24, 0x29, 0x2b, 0x2b, 0x23, 0x1d, 0x17, 0x55, 0x66, 0xfd, 0xfd, 0x61, 0x27, 0x2f, 0x23, 0x2b, 0x24, 0x25, 0x27, 0x5f, 0xcf, 0xcb, 0xd9, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd8, 0xce, 0xf4, 0x53, 0x1f, 0x2a, 0x35, 0x2d, 0x2d, 0x1d, 0x57, 0x60, 0x64, 0x56, 0x24, 0x2f, 0x29, 0x39, 0x37, 0x35, 0x37, 0x32, 0x34, 0x37, 0x37, 0x23, 0x3e, 0x55, 0xf4, 0xcf, 0xca, 0xcb, 0xcb, 0xcc, 0x9f, 0xcc, 0xca, 0xd8, 0xda, 0xb6, 0x82, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0xea, 0xd9, 0xcf, 0xcb, 0xf2, 0xce, 0xf2, 0x60, 0xca, 0xfd, 0x5a, 0x31, 0x23, 0x2b, 0x2d, 0x2a, 0x2b, 0x2b, 0x2a, 0x26, 0x28, 0x2b, 0x2f, 0x17, 0x53, 0x65, 0x60, 0x64, 0x27, 0x29, 0x2f, 0x32, 0x25, 0x22, 0x31, 0x64, 0xf3, 0xcc, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xd8, 0xcf, 0x75, 0x59, 0x1f, 0x2b, 0x35, 0x26, 0x2b, 0x1d, 0x57, 0x68, 0x55, 0x2b, 0x29, 0x32, 0x33, 0x33, 0x34, 0x34, 0x39, 0x32, 0x37, 0x35, 0x35, 0x39, 0x2b, 0x30, 0x54, 0x64, 0xcb, 0xcc, 0x9f, 0xcb, 0xcc, 0xcc, 0xcb, 0xab, 0xe0, 0xe9, 0x82, 0xe5, 0x01, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe2, 0xe4, 0xd2, 0xd8, 0xf2, 0xcb, 0xcf, 0xf2, 0xcf, 0x5e, 0x69, 0x54, 0x31, 0x20, 0x29, 0x2a, 0x2a, 0x2a, 0x2c, 0x2b, 0x2d, 0x2d, 0x37, 0x28, 0x2b, 0x29, 0x14, 0x56, 0x68, 0x61, 0x38, 0x25, 0x23, 0x23, 0x24, 0x17, 0x4d, 0x64, 0xf2, 0xd0, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd0, 0xcf, 0x63, 0x47, 0x12, 0x2e, 0x33, 0x23, 0x30, 0x62, 0x5d, 0x29, 0x2c, 0x34, 0x33, 0x34, 0x34, 0x37, 0x34, 0x37, 0x34, 0x37, 0x37, 0x34, 0x34, 0x34, 0x2d, 0x2f, 0x57, 0x61, 0xa0, 0x9f, 0x9f, 0xcd, 0xcb, 0xcb, 0xeb, 0xe0, 0xc0, 0xe3, 0x84, 0xe4, 0xe2, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x76, 0x00, 0x00, 0x74, 0x00, 0x00, 0x01, 0xe4, 0xe3, 0xb5, 0xda, 0xd9, 0xce, 0xf2, 0xcf, 0xcd, 0xf3, 0x60, 0x5b, 0x25, 0x23, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2e, 0x2b, 0x29, 0x29, 0x5d, 0x68, 0x4d, 0x11, 0x2f, 0x2b, 0x24, 0x17, 0x5e, 0xd2, 0xce, 0xd3, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xd2, 0xce, 0x60, 0x68, 0x50, 0x25, 0x22, 0x22, 0x59, 0x65, 0x4b, 0x24, 0x33, 0x33, 0x34, 0x37, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x34, 0x34, 0x34, 0x34, 0x2c, 0x38, 0x61, 0xa1, 0x9d, 0xcc, 0xcd, 0xcc, 0xcb, 0xeb, 0xee, 0xea, 0xe5, 0xe5, 0xe6, 0x84, 0xe3, 0x01, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x84, 0x84, 0xe3, 0xb8, 0x73, 0xf6, 0xcc, 0xf2, 0xcd, 0xf2, 0xf3, 0x61, 0x3c, 0x24, 0x2b, 0x32, 0x2b, 0x29, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2e, 0x2a, 0x2a, 0x33, 0x2b, 0x2b, 0x20, 0x41, 0x6d, 0x5f, 0x41, 0x17, 0x1f, 0x27, 0x58, 0xfd, 0xce, 0xcf, 0xeb, 0xdc, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xd9, 0xdc, 0xeb, 0xce, 0xa1, 0xf2, 0x68, 0x61, 0x5d, 0x60, 0x63, 0x5c, 0x31, 0x29, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x34, 0x34, 0x34, 0x37, 0x37, 0x32, 0x24, 0x58, 0xf2, 0xcc, 0x9f, 0xcd, 0xcb, 0xcb, 0xeb, 0xdd, 0xc7, 0xe4, 0xe5, 0xe6, 0xe5, 0xe6, 0x84, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0xe6, 0x84, 0x84, 0x82, 0xba, 0xe0, 0xab, 0xcb, 0xf2, 0xcf, 0xcb, 0x63, 0x57, 0x17, 0x2f, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a, 0x2c, 0x2e, 0x2a, 0x2b, 0x23, 0x32, 0x21, 0x5d, 0x67, 0x63, 0x5a, 0x58, 0x63, 0xfd, 0xcf, 0xa4, 0xa2, 0xd8, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xd9, 0xdc, 0xd6, 0xcc, 0xa0, 0xcf, 0xf2, 0xf3, 0x75, 0xce, 0xf4, 0x59, 0x1f, 0x3a, 0x33, 0x33, 0x34, 0x34, 0x37, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x33, 0x24, 0x50, 0x60, 0xcd, 0x9f, 0xcd, 0xcc, 0xcb, 0xeb, 0xf8, 0xc8, 0xe4, 0x84, 0xe6, 0x84, 0xe5, 0xe6, 0x84, 0x82, 0x02, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x01, 0x03, 0x84, 0x05, 0x79, 0xe5, 0x84, 0xe4, 0xbb, 0xf0, 0xd6, 0xca, 0xcf, 0xf2, 0xcd, 0x66, 0x47, 0x1d, 0x32, 0x2a, 0x2e, 0x2a, 0x29, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2a, 0x2a, 0x2b, 0x2c, 0x2b, 0x2b, 0x1f, 0x53, 0x69, 0x75, 0x78, 0x78, 0xce, 0xf2, 0x9f, 0xa2, 0xd1, 0xda, 0xdc, 0xd9, 0xdc, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd0, 0xa1, 0xcc, 0xcd, 0xcf, 0xa0, 0xa4, 0x78, 0x50, 0x29, 0x33, 0x33, 0x33, 0x33, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x33, 0x33, 0x34, 0x34, 0x35, 0x37, 0x34, 0x2f, 0x47, 0x61, 0xcb, 0xcd, 0xcb, 0xcd, 0xcb, 0xeb, 0xdd, 0xc8, 0xe5, 0x84, 0xe5, 0x84, 0x84, 0x84, 0x84, 0x05, 0x84, 0x82, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x76, 0xe2, 0xe5, 0x05, 0xe6, 0xe5, 0xe5, 0x84, 0x84, 0x04, 0xe9, 0x73, 0xd6, 0xcb, 0xcf, 0xcd, 0xf2, 0x61, 0x25, 0x29, 0x32, 0x28, 0x2e, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2a, 0x2b, 0x2c, 0x2e, 0x2a, 0x2c, 0x2b, 0x24, 0x47, 0x69, 0x75, 0xa1, 0x7a, 0xd0, 0xcf, 0xd1, 0xcd, 0xd3, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xd9, 0xdc, 0xd4, 0xa1, 0xcd, 0xcd, 0xcd, 0xa0, 0xa0, 0xf5, 0x50, 0x29, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x33, 0x33, 0x34, 0x33, 0x33, 0x33, 0x34, 0x37, 0x35, 0x34, 0x32, 0x3c, 0x61, 0xcb, 0xce, 0xca, 0xcf, 0xcb, 0xd5, 0xf8, 0xc7, 0xe4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0x84, 0x05, 0x84, 0xe4, 0x03, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x01, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x84, 0x79, 0xe6, 0xe5, 0x84, 0x84, 0x84, 0x84, 0x84, 0x04, 0xe9, 0xe0, 0xd8, 0xcb, 0xcf, 0xce, 0xf3, 0x5e, 0x24, 0x29, 0x2a, 0x2a, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2a, 0x2c, 0x2c, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x2d, 0x23, 0x41, 0x69, 0xf2, 0xa4, 0xa1, 0xa2, 0xcf, 0xf2, 0xcf, 0xeb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdd, 0xda, 0xda, 0xd9, 0xce, 0xcb, 0xf3, 0xcd, 0xa2, 0xa1, 0xd3, 0x52, 0x23, 0x35, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x34, 0x33, 0x34, 0x34, 0x33, 0x2e, 0x33, 0x34, 0x35, 0x37, 0x37, 0x2f, 0x41, 0x5e, 0x60, 0xcc, 0xcb, 0xcd, 0xcc, 0xd8, 0xde, 0xea, 0x04, 0xe6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0xe5, 0x84, 0x05, 0xe6, 0x84, 0xe5, 0xe2, 0xe1, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x76, 0xe1, 0x04, 0xe5, 0x84, 0xe6, 0xe6, 0xe6, 0x84, 0x84, 0x84, 0xe5, 0x84, 0x84, 0xe5, 0xe3, 0xbb, 0xf0, 0xd8, 0xcb, 0xf2, 0xcf, 0xcf, 0x5c, 0x23, 0x29, 0x2a, 0x2d, 0x2a, 0x2c, 0x2b, 0x2b, 0x2c, 0x2a, 0x2a, 0x2a, 0x2b, 0x2c, 0x2b, 0x2a, 0x2c, 0x2d, 0x2d, 0x29, 0x47, 0x6b, 0xcb, 0xa2, 0xa1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf7, 0xdc, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0x78, 0xcf, 0xf2, 0xcd, 0xa1, 0x7a, 0x78, 0x57, 0x23, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x34, 0x34, 0x35, 0x34, 0x2f, 0x41, 0x5f, 0xcc, 0xcd, 0xcb, 0xcc, 0xcf, 0xd8, 0xef, 0xc0, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0x84, 0xe6, 0x05, 0xe6, 0x84, 0xe5, 0xe4, 0xe3, 0x04, 0x04, 0x04, 0xe3, 0xe3, 0x82, 0xe5, 0x84, 0xe6, 0xe6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0xb9, 0xe0, 0xda, 0xf2, 0xcd, 0xcf, 0xd0, 0x5c, 0x24, 0x29, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2c, 0x2a, 0x2d, 0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x2d, 0x2d, 0x2d, 0x20, 0x54, 0x66, 0x75, 0xa1, 0xa1, 0xa2, 0xcf, 0xf2, 0xd3, 0xdc, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xdc, 0xdc, 0xaf, 0xce, 0xf2, 0xcd, 0xa1, 0xa1, 0xd0, 0x61, 0x2f, 0x2c, 0x34, 0x33, 0x33, 0x33, 0x33, 0x34, 0x33, 0x33, 0x34, 0x33, 0x2e, 0x33, 0x34, 0x37, 0x37, 0x2e, 0x2f, 0x47, 0x60, 0xf2, 0x9f, 0xcd, 0xcb, 0xd0, 0xd8, 0xb3, 0xe9, 0xe4, 0xe4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0x84, 0xe5, 0x84, 0x79, 0xe6, 0x05, 0x05, 0xe6, 0xe6, 0xe6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe6, 0x84, 0x84, 0x84, 0x84, 0xe5, 0x84, 0xe5, 0xe6, 0x82, 0xb6, 0x73, 0xdd, 0xf2, 0xcc, 0xf2, 0xcd, 0x5f, 0x24, 0x29, 0x2c, 0x2a, 0x2c, 0x2b, 0x2b, 0x2b, 0x2d, 0x2c, 0x2a, 0x2a, 0x2b, 0x2c, 0x2b, 0x2d, 0x2c, 0x2d, 0x2d, 0x1f, 0x5f, 0xfd, 0xa1, 0xa1, 0xa5, 0xcc, 0xd0, 0xcc, 0xd8, 0xdc, 0xd9, 0xdd, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xeb, 0xcc, 0xa2, 0x9f, 0xd0, 0xcb, 0x68, 0x50, 0x24, 0x2e, 0x33, 0x34, 0x2e, 0x2c, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x34, 0x35, 0x36, 0x36, 0x2d, 0x25, 0x50, 0xf4, 0xcb, 0xcd, 0xcb, 0xcd, 0xd1, 0xdc, 0xde, 0xb8, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x79, 0x84, 0xe4, 0xe7, 0xd8, 0xef, 0xd1, 0xcb, 0xcf, 0xcd, 0x64, 0x30, 0x29, 0x2b, 0x2a, 0x2d, 0x2d, 0x2a, 0x2b, 0x2b, 0x2b, 0x29, 0x2b, 0x2b, 0x2c, 0x2b, 0x2e, 0x2b, 0x33, 0x20, 0x41, 0x6a, 0x75, 0xd0, 0xcc, 0xce, 0xce, 0xcc, 0xd3, 0xaf, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd0, 0x7a, 0xa2, 0xce, 0x60, 0x60, 0x64, 0x27, 0x2a, 0x33, 0x2a, 0x2c, 0x34, 0x33, 0x33, 0x34, 0x33, 0x32, 0x33, 0x34, 0x36, 0x36, 0x35, 0x34, 0x14, 0x5c, 0x75, 0xcb, 0xcc, 0xf2, 0xcc, 0xd4, 0xdd, 0xd9, 0x87, 0xe5, 0x84, 0x84, 0x84, 0xe5, 0x84, 0xe5, 0x79, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0xe4, 0x82, 0xd2, 0xef, 0x78, 0xca, 0xcf, 0xf2, 0x63, 0x50, 0x1f, 0x32, 0x2a, 0x2d, 0x2d, 0x2d, 0x2a, 0x2b, 0x29, 0x2b, 0x2b, 0x2c, 0x2d, 0x2e, 0x2a, 0x2b, 0x24, 0x24, 0x58, 0xeb, 0xf2, 0xf3, 0xf2, 0xd1, 0xcb, 0xce, 0xaf, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xaf, 0xa2, 0xa1, 0xcc, 0xcf, 0xf2, 0xfd, 0x58, 0x2f, 0x23, 0x39, 0x33, 0x2d, 0x37, 0x35, 0x34, 0x35, 0x34, 0x2e, 0x37, 0x35, 0x35, 0x37, 0x23, 0x41, 0x64, 0xca, 0xd1, 0xcb, 0xcc, 0xcf, 0xd9, 0xdc, 0xc9, 0x03, 0xe5, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe4, 0x06, 0x02, 0xc2, 0xe0, 0xf6, 0xcb, 0xcb, 0xcd, 0x63, 0x5d, 0x27, 0x29, 0x2b, 0x2d, 0x26, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2d, 0x2d, 0x2d, 0x2a, 0x2b, 0x29, 0x18, 0x54, 0x69, 0xcb, 0xf3, 0xcf, 0xf3, 0xce, 0xf2, 0xd5, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xde, 0xd5, 0x9f, 0xa1, 0xcb, 0xf3, 0xcb, 0x68, 0x57, 0x20, 0x29, 0x2e, 0x3b, 0x36, 0x35, 0x35, 0x2d, 0x35, 0x2d, 0x37, 0x33, 0x2e, 0x23, 0x27, 0x5b, 0x75, 0xce, 0x9f, 0xcb, 0xf2, 0xd2, 0xda, 0xde, 0xc0, 0x02, 0x05, 0xe5, 0x84, 0x84, 0xe5, 0x84, 0xe5, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0xe2, 0xe8, 0xf0, 0xda, 0xcf, 0xca, 0xf2, 0xf2, 0x63, 0x57, 0x10, 0x29, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x26, 0x2d, 0x2d, 0x2d, 0x2a, 0x29, 0x14, 0x41, 0x6b, 0x63, 0xce, 0xcf, 0xf2, 0xcf, 0xcb, 0xd4, 0xda, 0xd9, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xec, 0xd9, 0xda, 0xb1, 0xa9, 0x7a, 0xa1, 0xcc, 0xce, 0xf2, 0x68, 0x59, 0x38, 0x23, 0x2a, 0x34, 0x2d, 0x33, 0x2e, 0x2e, 0x33, 0x2e, 0x32, 0x25, 0x27, 0x5c, 0xf4, 0xcc, 0x7a, 0xcc, 0xcd, 0xce, 0xd9, 0xdc, 0xd4, 0xb5, 0x82, 0x84, 0xe5, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0xe5, 0xe3, 0xc7, 0xf0, 0xeb, 0xcb, 0xcb, 0xf2, 0xf2, 0x66, 0x50, 0x22, 0x20, 0x23, 0x2a, 0x23, 0x2a, 0x2d, 0x2d, 0x2d, 0x2e, 0x29, 0x24, 0x22, 0x53, 0x69, 0x61, 0xf2, 0xcf, 0xf3, 0xcf, 0xf2, 0xd3, 0xdc, 0xf7, 0xd9, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xd9, 0xdb, 0xdb, 0xa9, 0x9f, 0x9f, 0xcc, 0xcc, 0xf2, 0x63, 0x5f, 0x4b, 0x2f, 0x20, 0x23, 0x2b, 0x29, 0x29, 0x2c, 0x29, 0x1d, 0x41, 0x5c, 0x63, 0xf2, 0xce, 0x9f, 0x9f, 0xcb, 0xd3, 0xdd, 0xe0, 0xc2, 0xe3, 0x84, 0x79, 0x79, 0x84, 0x84, 0xe5, 0xe5, 0xe5, 0xe6, 0x84, 0x84, 0x84, 0xe5, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0xe5, 0xe6, 0x79, 0xe1, 0xb8, 0xf0, 0xd9, 0xf2, 0xcd, 0xcb, 0xcf, 0x60, 0x63, 0x55, 0x27, 0x1d, 0x20, 0x23, 0x23, 0x20, 0x2a, 0x23, 0x20, 0x1f, 0x38, 0x57, 0x6a, 0xf2, 0xd0, 0xcc, 0xf3, 0xcf, 0xf2, 0xd1, 0xd9, 0xda, 0xf7, 0xda, 0xf7, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xda, 0xb1, 0xdb, 0xa9, 0x9f, 0x7a, 0xa2, 0xa0, 0x7a, 0xf4, 0x64, 0x62, 0x57, 0x4b, 0x41, 0x41, 0x41, 0x47, 0x52, 0x5d, 0x64, 0xf5, 0xf2, 0x9f, 0x7a, 0xa2, 0xcc, 0xd2, 0xda, 0xd9, 0xee, 0xc8, 0xb8, 0xe4, 0xe2, 0xe5, 0xe4, 0xe5, 0xe6, 0xe6, 0x84, 0xe4, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe4, 0x04, 0x82, 0x07, 0xf2, 0xef, 0xd4, 0xf2, 0xca, 0xa2, 0xf2, 0xf2, 0x64, 0x5f, 0x57, 0x4d, 0x3e, 0x3c, 0x3e, 0x41, 0x4b, 0x53, 0x5c, 0x68, 0x67, 0xcb, 0xa1, 0xa0, 0xa2, 0xcc, 0xf2, 0xd3, 0xd8, 0xf7, 0xda, 0xf7, 0xda, 0xf7, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xaf, 0xd9, 0xb1, 0xd6, 0xa2, 0x9f, 0xa1, 0xa2, 0x9f, 0xca, 0xf3, 0x66, 0x64, 0x66, 0x64, 0x61, 0x65, 0x69, 0x61, 0xf2, 0xf2, 0xcd, 0xcf, 0xcd, 0xcc, 0xcf, 0xd9, 0xdc, 0xd9, 0xda, 0xde, 0xde, 0xca, 0xbc, 0x08, 0x82, 0xe3, 0x82, 0x84, 0x84, 0x84, 0x84, 0xe5, 0xe5, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0x84, 0x84, 0xe6, 0xe6, 0x84, 0xe5, 0xe4, 0xe4, 0x04, 0x84, 0xb9, 0xc8, 0xd9, 0xee, 0xda, 0xdc, 0xd2, 0xcb, 0xcb, 0xce, 0xf2, 0xf2, 0x60, 0x64, 0x64, 0x64, 0x62, 0x63, 0x64, 0x68, 0xfd, 0xfd, 0xf2, 0xf3, 0xa2, 0xa2, 0xa1, 0xce, 0xce, 0xd2, 0xd8, 0xed, 0xda, 0xf7, 0xda, 0xf7, 0xf7, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xaf, 0xda, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xdd, 0xd6, 0xd0, 0xcd, 0x9f, 0xa2, 0xa2, 0xa2, 0xcd, 0xcc, 0xf2, 0x60, 0xf3, 0xce, 0xcc, 0xcf, 0xcf, 0xcd, 0xd0, 0xcd, 0xcb, 0xd2, 0xd9, 0xdc, 0xd9, 0xd9, 0xdc, 0xda, 0xdc, 0xb3, 0xe0, 0xd8, 0xc5, 0xbd, 0xf1, 0x04, 0xe2, 0x04, 0xe3, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe6, 0xe6, 0xe5, 0xe4, 0x82, 0xe2, 0xe2, 0x84, 0xb5, 0xc0, 0x78, 0xf0, 0x73, 0xdd, 0xda, 0xdc, 0xdc, 0xf7, 0xd3, 0xcb, 0xcf, 0xce, 0xcb, 0x7a, 0xcc, 0xcb, 0xf2, 0xf3, 0x60, 0xf2, 0xcc, 0xf2, 0xf2, 0xce, 0xce, 0xcd, 0xd0, 0xcd, 0xcc, 0xa9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xf7, 0xf7, 0xf7, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xaf, 0xda, 0xda, 0xda, 0xed, 0xf7, 0xda, 0xdc, 0xf7, 0xf6, 0xf2, 0xcc, 0xa0, 0xa0, 0xa0, 0xa2, 0xd0, 0xf3, 0xcd, 0xa3, 0xa1, 0xa1, 0xa2, 0xcd, 0xcd, 0xf2, 0xeb, 0x6c, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0x73, 0xe0, 0xdd, 0x75, 0xc0, 0xe9, 0xb6, 0x84, 0xe4, 0xe3, 0xe3, 0x82, 0xe4, 0xe5, 0xe5, 0xe5, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe3, 0xe3, 0xe5, 0xe6, 0xb5, 0xbb, 0xc1, 0xd1, 0x73, 0x73, 0xde, 0x6c, 0xdc, 0xda, 0xd8, 0xdd, 0xdc, 0xf8, 0xdc, 0xeb, 0xcb, 0x7a, 0xa2, 0x9f, 0x7a, 0xa1, 0xcd, 0xcc, 0xa1, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xf2, 0xf2, 0x60, 0xf4, 0xf6, 0xaf, 0xda, 0xd9, 0xda, 0xda, 0xf7, 0xf7, 0xf7, 0xf7, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xed, 0xd9, 0xd5, 0xd0, 0x9f, 0xcd, 0xcc, 0xcd, 0xcd, 0xd0, 0xa2, 0xcc, 0x9f, 0xcd, 0xcd, 0xd2, 0xd6, 0xf8, 0xdc, 0xd9, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xdd, 0xee, 0xf0, 0xee, 0xdd, 0xd3, 0xc7, 0xc0, 0xe9, 0xb8, 0xe7, 0x06, 0xe5, 0x82, 0xe3, 0xe2, 0x03, 0x03, 0xe2, 0x03, 0x03, 0xe2, 0xe2, 0x04, 0x82, 0xe4, 0x84, 0x87, 0xb6, 0xe8, 0xbf, 0xea, 0xce, 0xd8, 0xe0, 0xf0, 0xee, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0xdc, 0xd9, 0xda, 0xdc, 0xdc, 0xd9, 0xd2, 0xce, 0x7a, 0xcc, 0xcc, 0xa2, 0xa2, 0xce, 0xcc, 0xce, 0xcc, 0xcc, 0xcb, 0xf2, 0xd0, 0xf5, 0xec, 0xdc, 0xda, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xdc, 0xda, 0xd9, 0xd4, 0xd4, 0xd1, 0xcf, 0xce, 0xcf, 0xd0, 0xd2, 0xeb, 0xd8, 0xdc, 0xdc, 0xdd, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xdc, 0xee, 0xe0, 0xf0, 0xf0, 0xf0, 0xe0, 0xdd, 0xd5, 0xd0, 0xcb, 0xc9, 0xc7, 0xc7, 0xc5, 0xc5, 0xc7, 0xc7, 0xc9, 0xcb, 0xcf, 0xeb, 0xd9, 0xef, 0xe0, 0xf0, 0xf0, 0xef, 0xee, 0xde, 0xdc, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd8, 0xd3, 0xd0, 0xf2, 0xcb, 0xf2, 0xcc, 0xcb, 0xcd, 0xcf, 0xcf, 0xd4, 0xab, 0xdc, 0xde, 0xda, 0xd9, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xdd, 0xda, 0xda, 0xd9, 0xd8, 0xda, 0xd9, 0xda, 0xdc, 0xdd, 0xda, 0xdc, 0xd9, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xdc, 0xdd, 0xdd, 0xdd, 0xee, 0xe0, 0xe0, 0xee, 0xe0, 0xef, 0xf0, 0xef, 0xe0, 0x73, 0xe0, 0xef, 0xdf, 0xee, 0xde, 0xdc, 0xdc, 0xda, 0xd8, 0xd9, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xd8, 0xd6, 0xd5, 0xd5, 0xab, 0xd6, 0xd9, 0xdc, 0xdc, 0xda, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdd, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdd, 0xdc, 0xda, 0xd9, 0xd9, 0xd9, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdd, 0xda, 0xdc, 0xdc, 0xdc, 0xda, 0xd9, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xdd, 0xd9, 0xda, 0xdc, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xdc, 0xda, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xdc, 0xdc, 0xda, 0xdc, 0xdc, 0xda, 0xda, 0xdd, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xd9, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xdc, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xec, 0xda, 0xec, 0xda, 0xec, 0xda, 0xec, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xec, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xec, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xda, 0xd9, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 
-};
-
-const lv_img_dsc_t image6 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image6_map,
-};
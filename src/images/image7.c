@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE7
-#define LV_ATTRIBUTE_IMG_IMAGE7
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE7 uint8_t image7_map[] = {
-  0xf7, 0xf7, 0xf7, 0xff, 	/*Color of index 0*/
-  0xd4, 0xd4, 0xd4, 0xff, 	/*Color of index 1*/
-  0xa2, 0xb9, 0xf3, 0xff, 	/*Color of index 2*/
-  0x9c, 0xab, 0xf1, 0xff, 	/*Color of index 3*/
-  0x9a, 0xac, 0xe9, 0xff, 	/*Color of index 4*/
-  0x9a, 0xa3, 0xfb, 0xff, 	/*Color of index 5*/
-  0x99, 0xa4, 0xf4, 0xff, 	/*Color of index 6*/
-  0x95, 0xa5, 0xe8, 0xff, 	/*Color of index 7*/
-  0x97, 0x9e, 0xf9, 0xff, 	/*Color of index 8*/
-  0x82, 0x99, 0xd0, 0xff, 	/*Color of index 9*/
-  0x83, 0x88, 0xf3, 0xff, 	/*Color of index 10*/
-  0x5f, 0x84, 0xe7, 0xff, 	/*Color of index 11*/
-  0x67, 0x84, 0xd3, 0xff, 	/*Color of index 12*/
-  0x6f, 0x84, 0xbf, 0xff, 	/*Color of index 13*/
-  0x69, 0x73, 0xf9, 0xff, 	/*Color of index 14*/
-  0x63, 0x76, 0xe7, 0xff, 	/*Color of index 15*/
-  0x65, 0x7a, 0xd0, 0xff, 	/*Color of index 16*/
-  0x5a, 0x6d, 0xd9, 0xff, 	/*Color of index 17*/
-  0x5d, 0x71, 0xbc, 0xff, 	/*Color of index 18*/
-  0x7f, 0x7f, 0x80, 0xff, 	/*Color of index 19*/
-  0x5a, 0x70, 0xa8, 0xff, 	/*Color of index 20*/
-  0x52, 0x64, 0xd0, 0xff, 	/*Color of index 21*/
-  0x50, 0x64, 0xb4, 0xff, 	/*Color of index 22*/
-  0x4c, 0x5a, 0xa9, 0xff, 	/*Color of index 23*/
-  0x52, 0x56, 0x97, 0xff, 	/*Color of index 24*/
-  0x3d, 0x4a, 0x7c, 0xff, 	/*Color of index 25*/
-  0x3a, 0x40, 0x87, 0xff, 	/*Color of index 26*/
-  0x29, 0x35, 0x72, 0xff, 	/*Color of index 27*/
-  0x1a, 0x29, 0x61, 0xff, 	/*Color of index 28*/
-  0x10, 0x15, 0x7f, 0xff, 	/*Color of index 29*/
-  0x0e, 0x15, 0x73, 0xff, 	/*Color of index 30*/
-  0x0e, 0x15, 0x64, 0xff, 	/*Color of index 31*/
-  0x0b, 0x16, 0x50, 0xff, 	/*Color of index 32*/
-  0x09, 0x0c, 0x6e, 0xff, 	/*Color of index 33*/
-  0x14, 0x15, 0x19, 0xff, 	/*Color of index 34*/
-  0x01, 0x05, 0x46, 0xff, 	/*Color of index 35*/
-  0x02, 0x02, 0x0b, 0xff, 	/*Color of index 36*/
-  0xea, 0xfb, 0xfd, 0xff, 	/*Color of index 37*/
-  0xe3, 0xf9, 0xfe, 0xff, 	/*Color of index 38*/
-  0xf1, 0xf7, 0xfa, 0xff, 	/*Color of index 39*/
-  0xdd, 0xf7, 0xfe, 0xff, 	/*Color of index 40*/
-  0xd4, 0xf6, 0xfe, 0xff, 	/*Color of index 41*/
-  0xe7, 0xf5, 0xfa, 0xff, 	/*Color of index 42*/
-  0xda, 0xf3, 0xfc, 0xff, 	/*Color of index 43*/
-  0xe2, 0xf2, 0xfa, 0xff, 	/*Color of index 44*/
-  0xd2, 0xf0, 0xfb, 0xff, 	/*Color of index 45*/
-  0xcb, 0xef, 0xfd, 0xff, 	/*Color of index 46*/
-  0xc3, 0xef, 0xfe, 0xff, 	/*Color of index 47*/
-  0xd7, 0xed, 0xfb, 0xff, 	/*Color of index 48*/
-  0xda, 0xed, 0xf4, 0xff, 	/*Color of index 49*/
-  0xcc, 0xee, 0xf5, 0xff, 	/*Color of index 50*/
-  0xce, 0xec, 0xfb, 0xff, 	/*Color of index 51*/
-  0xd1, 0xec, 0xf5, 0xff, 	/*Color of index 52*/
-  0xc5, 0xeb, 0xfc, 0xff, 	/*Color of index 53*/
-  0xcb, 0xea, 0xfa, 0xff, 	/*Color of index 54*/
-  0xcc, 0xea, 0xf6, 0xff, 	/*Color of index 55*/
-  0xd1, 0xe7, 0xfd, 0xff, 	/*Color of index 56*/
-  0xbc, 0xe9, 0xfd, 0xff, 	/*Color of index 57*/
-  0xc9, 0xe6, 0xfc, 0xff, 	/*Color of index 58*/
-  0xc5, 0xe8, 0xf6, 0xff, 	/*Color of index 59*/
-  0xc2, 0xe6, 0xfb, 0xff, 	/*Color of index 60*/
-  0xd0, 0xe8, 0xed, 0xff, 	/*Color of index 61*/
-  0xd3, 0xe5, 0xef, 0xff, 	/*Color of index 62*/
-  0xba, 0xe4, 0xfa, 0xff, 	/*Color of index 63*/
-  0xb3, 0xe4, 0xfb, 0xff, 	/*Color of index 64*/
-  0xc3, 0xe4, 0xf3, 0xff, 	/*Color of index 65*/
-  0xca, 0xe3, 0xf1, 0xff, 	/*Color of index 66*/
-  0xad, 0xe1, 0xfc, 0xff, 	/*Color of index 67*/
-  0xbb, 0xe1, 0xf3, 0xff, 	/*Color of index 68*/
-  0xb1, 0xde, 0xf4, 0xff, 	/*Color of index 69*/
-  0xb2, 0xdb, 0xfb, 0xff, 	/*Color of index 70*/
-  0xa9, 0xda, 0xfb, 0xff, 	/*Color of index 71*/
-  0xbe, 0xd7, 0xfb, 0xff, 	/*Color of index 72*/
-  0xbb, 0xdb, 0xec, 0xff, 	/*Color of index 73*/
-  0xaa, 0xda, 0xf2, 0xff, 	/*Color of index 74*/
-  0xa1, 0xd8, 0xfa, 0xff, 	/*Color of index 75*/
-  0xce, 0xda, 0xe0, 0xff, 	/*Color of index 76*/
-  0xaf, 0xd6, 0xec, 0xff, 	/*Color of index 77*/
-  0xa3, 0xd5, 0xf3, 0xff, 	/*Color of index 78*/
-  0x99, 0xd2, 0xfb, 0xff, 	/*Color of index 79*/
-  0x9a, 0xd3, 0xf2, 0xff, 	/*Color of index 80*/
-  0xa5, 0xd2, 0xec, 0xff, 	/*Color of index 81*/
-  0xc0, 0xd3, 0xdb, 0xff, 	/*Color of index 82*/
-  0x9a, 0xd1, 0xec, 0xff, 	/*Color of index 83*/
-  0x92, 0xd0, 0xf1, 0xff, 	/*Color of index 84*/
-  0xac, 0xd1, 0xe3, 0xff, 	/*Color of index 85*/
-  0x9f, 0xca, 0xfc, 0xff, 	/*Color of index 86*/
-  0x91, 0xcd, 0xf2, 0xff, 	/*Color of index 87*/
-  0xb2, 0xc8, 0xf7, 0xff, 	/*Color of index 88*/
-  0x9c, 0xcb, 0xf2, 0xff, 	/*Color of index 89*/
-  0x9c, 0xcd, 0xea, 0xff, 	/*Color of index 90*/
-  0x8a, 0xcb, 0xf2, 0xff, 	/*Color of index 91*/
-  0x91, 0xc7, 0xfa, 0xff, 	/*Color of index 92*/
-  0xad, 0xc9, 0xe8, 0xff, 	/*Color of index 93*/
-  0x93, 0xca, 0xea, 0xff, 	/*Color of index 94*/
-  0x8b, 0xc9, 0xec, 0xff, 	/*Color of index 95*/
-  0xb0, 0xcb, 0xd7, 0xff, 	/*Color of index 96*/
-  0x86, 0xc7, 0xf2, 0xff, 	/*Color of index 97*/
-  0x9b, 0xc9, 0xe3, 0xff, 	/*Color of index 98*/
-  0x8b, 0xc5, 0xeb, 0xff, 	/*Color of index 99*/
-  0x8b, 0xc2, 0xf4, 0xff, 	/*Color of index 100*/
-  0x92, 0xc6, 0xe4, 0xff, 	/*Color of index 101*/
-  0x83, 0xc4, 0xed, 0xff, 	/*Color of index 102*/
-  0x91, 0xc3, 0xea, 0xff, 	/*Color of index 103*/
-  0xb8, 0xc7, 0xcb, 0xff, 	/*Color of index 104*/
-  0x9e, 0xc2, 0xdd, 0xff, 	/*Color of index 105*/
-  0xa5, 0xbd, 0xea, 0xff, 	/*Color of index 106*/
-  0xaf, 0xc4, 0xcf, 0xff, 	/*Color of index 107*/
-  0x8c, 0xc2, 0xe0, 0xff, 	/*Color of index 108*/
-  0x83, 0xc0, 0xe6, 0xff, 	/*Color of index 109*/
-  0x81, 0xbb, 0xec, 0xff, 	/*Color of index 110*/
-  0x9e, 0xbd, 0xd0, 0xff, 	/*Color of index 111*/
-  0x80, 0xba, 0xe1, 0xff, 	/*Color of index 112*/
-  0xae, 0xbc, 0xc4, 0xff, 	/*Color of index 113*/
-  0x91, 0xb1, 0xe3, 0xff, 	/*Color of index 114*/
-  0x7b, 0xb4, 0xdd, 0xff, 	/*Color of index 115*/
-  0x7c, 0xaf, 0xec, 0xff, 	/*Color of index 116*/
-  0x7e, 0xb5, 0xd2, 0xff, 	/*Color of index 117*/
-  0x71, 0xb2, 0xe0, 0xff, 	/*Color of index 118*/
-  0x91, 0xb4, 0xce, 0xff, 	/*Color of index 119*/
-  0x6b, 0xad, 0xe1, 0xff, 	/*Color of index 120*/
-  0x9f, 0xb2, 0xbd, 0xff, 	/*Color of index 121*/
-  0xb0, 0xb2, 0xb5, 0xff, 	/*Color of index 122*/
-  0x6b, 0xac, 0xd9, 0xff, 	/*Color of index 123*/
-  0x8d, 0xae, 0xc4, 0xff, 	/*Color of index 124*/
-  0x71, 0xa7, 0xe2, 0xff, 	/*Color of index 125*/
-  0x80, 0xa4, 0xdf, 0xff, 	/*Color of index 126*/
-  0x6e, 0xa9, 0xd0, 0xff, 	/*Color of index 127*/
-  0x7d, 0xa7, 0xca, 0xff, 	/*Color of index 128*/
-  0x8a, 0xa7, 0xb7, 0xff, 	/*Color of index 129*/
-  0x61, 0xa1, 0xd1, 0xff, 	/*Color of index 130*/
-  0x71, 0xa2, 0xc1, 0xff, 	/*Color of index 131*/
-  0xa0, 0xa4, 0xa5, 0xff, 	/*Color of index 132*/
-  0x6e, 0x96, 0xe5, 0xff, 	/*Color of index 133*/
-  0x6b, 0x9c, 0xcb, 0xff, 	/*Color of index 134*/
-  0x57, 0x9c, 0xd1, 0xff, 	/*Color of index 135*/
-  0x59, 0x9b, 0xcb, 0xff, 	/*Color of index 136*/
-  0x8d, 0x9f, 0xa9, 0xff, 	/*Color of index 137*/
-  0x4e, 0x97, 0xd1, 0xff, 	/*Color of index 138*/
-  0x54, 0x97, 0xca, 0xff, 	/*Color of index 139*/
-  0x5c, 0x98, 0xc3, 0xff, 	/*Color of index 140*/
-  0x57, 0x91, 0xd6, 0xff, 	/*Color of index 141*/
-  0x76, 0x97, 0xb5, 0xff, 	/*Color of index 142*/
-  0x53, 0x94, 0xc3, 0xff, 	/*Color of index 143*/
-  0x53, 0x8d, 0xd4, 0xff, 	/*Color of index 144*/
-  0x4f, 0x91, 0xc5, 0xff, 	/*Color of index 145*/
-  0x75, 0x95, 0xaa, 0xff, 	/*Color of index 146*/
-  0x55, 0x8a, 0xd9, 0xff, 	/*Color of index 147*/
-  0x85, 0x96, 0x9f, 0xff, 	/*Color of index 148*/
-  0x54, 0x8b, 0xcc, 0xff, 	/*Color of index 149*/
-  0x4f, 0x86, 0xd7, 0xff, 	/*Color of index 150*/
-  0x59, 0x8b, 0xb8, 0xff, 	/*Color of index 151*/
-  0x46, 0x89, 0xc4, 0xff, 	/*Color of index 152*/
-  0x75, 0x8e, 0x9d, 0xff, 	/*Color of index 153*/
-  0x4b, 0x85, 0xc8, 0xff, 	/*Color of index 154*/
-  0x46, 0x89, 0xbc, 0xff, 	/*Color of index 155*/
-  0x40, 0x85, 0xc2, 0xff, 	/*Color of index 156*/
-  0x82, 0x8a, 0x91, 0xff, 	/*Color of index 157*/
-  0x5b, 0x87, 0xa7, 0xff, 	/*Color of index 158*/
-  0x40, 0x82, 0xba, 0xff, 	/*Color of index 159*/
-  0x45, 0x83, 0xb2, 0xff, 	/*Color of index 160*/
-  0x3d, 0x7e, 0xb8, 0xff, 	/*Color of index 161*/
-  0x6e, 0x82, 0x91, 0xff, 	/*Color of index 162*/
-  0x65, 0x7b, 0xaa, 0xff, 	/*Color of index 163*/
-  0x42, 0x7e, 0xa9, 0xff, 	/*Color of index 164*/
-  0x3b, 0x79, 0xa9, 0xff, 	/*Color of index 165*/
-  0x49, 0x6f, 0xc4, 0xff, 	/*Color of index 166*/
-  0x5e, 0x79, 0x8b, 0xff, 	/*Color of index 167*/
-  0x76, 0x77, 0x79, 0xff, 	/*Color of index 168*/
-  0x50, 0x70, 0x8d, 0xff, 	/*Color of index 169*/
-  0x65, 0x72, 0x79, 0xff, 	/*Color of index 170*/
-  0x54, 0x6a, 0x7c, 0xff, 	/*Color of index 171*/
-  0x56, 0x64, 0x70, 0xff, 	/*Color of index 172*/
-  0x3f, 0x5f, 0x77, 0xff, 	/*Color of index 173*/
-  0x4c, 0x5b, 0x67, 0xff, 	/*Color of index 174*/
-  0x37, 0x51, 0x65, 0xff, 	/*Color of index 175*/
-  0x47, 0x52, 0x5a, 0xff, 	/*Color of index 176*/
-  0x48, 0x4b, 0x4e, 0xff, 	/*Color of index 177*/
-  0x33, 0x46, 0x57, 0xff, 	/*Color of index 178*/
-  0x38, 0x42, 0x49, 0xff, 	/*Color of index 179*/
-  0x29, 0x3c, 0x4c, 0xff, 	/*Color of index 180*/
-  0x20, 0x34, 0x43, 0xff, 	/*Color of index 181*/
-  0x30, 0x33, 0x37, 0xff, 	/*Color of index 182*/
-  0x1c, 0x2c, 0x3a, 0xff, 	/*Color of index 183*/
-  0x15, 0x24, 0x36, 0xff, 	/*Color of index 184*/
-  0x1a, 0x1f, 0x23, 0xff, 	/*Color of index 185*/
-  0x0d, 0x1d, 0x2b, 0xff, 	/*Color of index 186*/
-  0x12, 0x18, 0x21, 0xff, 	/*Color of index 187*/
-  0x04, 0x12, 0x25, 0xff, 	/*Color of index 188*/
-  0x09, 0x11, 0x1b, 0xff, 	/*Color of index 189*/
-  0x09, 0x10, 0x13, 0xff, 	/*Color of index 190*/
-  0x01, 0x0a, 0x1a, 0xff, 	/*Color of index 191*/
-  0x07, 0x0b, 0x12, 0xff, 	/*Color of index 192*/
-  0x02, 0x07, 0x12, 0xff, 	/*Color of index 193*/
-  0xfd, 0xfe, 0xfe, 0xff, 	/*Color of index 194*/
-  0xf2, 0xfc, 0xfd, 0xff, 	/*Color of index 195*/
-  0xd8, 0xde, 0xdd, 0xff, 	/*Color of index 196*/
-  0xc7, 0xc8, 0xc8, 0xff, 	/*Color of index 197*/
-  0xea, 0xeb, 0xea, 0xff, 	/*Color of index 198*/
-  0x04, 0x07, 0x03, 0xff, 	/*Color of index 199*/
-  0xfc, 0xfa, 0xed, 0xff, 	/*Color of index 200*/
-  0xf2, 0xf2, 0xf0, 0xff, 	/*Color of index 201*/
-  0xf6, 0xed, 0xcb, 0xff, 	/*Color of index 202*/
-  0xe1, 0xe2, 0xdc, 0xff, 	/*Color of index 203*/
-  0xd1, 0xd2, 0xbe, 0xff, 	/*Color of index 204*/
-  0xca, 0xc3, 0xaa, 0xff, 	/*Color of index 205*/
-  0xb0, 0xa8, 0x94, 0xff, 	/*Color of index 206*/
-  0x89, 0x88, 0x85, 0xff, 	/*Color of index 207*/
-  0x92, 0x89, 0x6a, 0xff, 	/*Color of index 208*/
-  0x7a, 0x7b, 0x69, 0xff, 	/*Color of index 209*/
-  0x7d, 0x75, 0x55, 0xff, 	/*Color of index 210*/
-  0x6a, 0x65, 0x49, 0xff, 	/*Color of index 211*/
-  0x6f, 0x5e, 0x29, 0xff, 	/*Color of index 212*/
-  0x57, 0x52, 0x43, 0xff, 	/*Color of index 213*/
-  0x70, 0x57, 0x19, 0xff, 	/*Color of index 214*/
-  0x5f, 0x52, 0x27, 0xff, 	/*Color of index 215*/
-  0x4c, 0x4a, 0x29, 0xff, 	/*Color of index 216*/
-  0x5e, 0x4b, 0x14, 0xff, 	/*Color of index 217*/
-  0x52, 0x44, 0x18, 0xff, 	/*Color of index 218*/
-  0x47, 0x3c, 0x19, 0xff, 	/*Color of index 219*/
-  0x48, 0x38, 0x07, 0xff, 	/*Color of index 220*/
-  0xbf, 0xbd, 0xbb, 0xff, 	/*Color of index 221*/
-  0xaf, 0xac, 0xa9, 0xff, 	/*Color of index 222*/
-  0x9c, 0x9b, 0x9a, 0xff, 	/*Color of index 223*/
-  0x92, 0x91, 0x8f, 0xff, 	/*Color of index 224*/
-  0x3d, 0x39, 0x37, 0xff, 	/*Color of index 225*/
-  0x3c, 0x2c, 0x0c, 0xff, 	/*Color of index 226*/
-  0x23, 0x1e, 0x1d, 0xff, 	/*Color of index 227*/
-  0x28, 0x19, 0x14, 0xff, 	/*Color of index 228*/
-  0x22, 0x19, 0x15, 0xff, 	/*Color of index 229*/
-  0x1d, 0x19, 0x16, 0xff, 	/*Color of index 230*/
-  0x2a, 0x1b, 0x04, 0xff, 	/*Color of index 231*/
-  0x1a, 0x11, 0x09, 0xff, 	/*Color of index 232*/
-  0x0d, 0x08, 0x05, 0xff, 	/*Color of index 233*/
-  0x13, 0x07, 0x01, 0xff, 	/*Color of index 234*/
-  0x09, 0x03, 0x02, 0xff, 	/*Color of index 235*/
-  0x69, 0x68, 0x68, 0xff, 	/*Color of index 236*/
-  0x44, 0x42, 0x42, 0xff, 	/*Color of index 237*/
-  0x2d, 0x2c, 0x2c, 0xff, 	/*Color of index 238*/
-  0x26, 0x21, 0x22, 0xff, 	/*Color of index 239*/
-  0x24, 0x1a, 0x1b, 0xff, 	/*Color of index 240*/
-  0x1f, 0x19, 0x19, 0xff, 	/*Color of index 241*/
-  0x22, 0x18, 0x18, 0xff, 	/*Color of index 242*/
-  0x29, 0x16, 0x19, 0xff, 	/*Color of index 243*/
-  0x22, 0x16, 0x19, 0xff, 	/*Color of index 244*/
-  0x1c, 0x16, 0x18, 0xff, 	/*Color of index 245*/
-  0x20, 0x16, 0x16, 0xff, 	/*Color of index 246*/
-  0x1b, 0x13, 0x13, 0xff, 	/*Color of index 247*/
-  0x17, 0x11, 0x11, 0xff, 	/*Color of index 248*/
-  0x17, 0x0d, 0x0d, 0xff, 	/*Color of index 249*/
-  0x14, 0x0b, 0x0c, 0xff, 	/*Color of index 250*/
-  0x0b, 0x08, 0x09, 0xff, 	/*Color of index 251*/
-  0x0f, 0x05, 0x08, 0xff, 	/*Color of index 252*/
-  0x03, 0x00, 0x01, 0xff, 	/*Color of index 253*/
-  0x5b, 0x5a, 0x5b, 0xff, 	/*Color of index 254*/
-  0x13, 0x0d, 0x11, 0xff, 	/*Color of index 255*/
-
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xf2, 0xf2, 0xf2, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf7, 0xf0, 0xf6, 0xf1, 0xf1, 0xf0, 0xf1, 0xf6, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf5, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf1, 0xf1, 0xf1, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf7, 0xf0, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf0, 0xf0, 0xf6, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf6, 0xf1, 0xf2, 0xf2, 0xf6, 0xf2, 0xf6, 0xf2, 0xf4, 0xe5, 0xf5, 0xf2, 0xf5, 0xf2, 0xf5, 0xf2, 0xf2, 0xf6, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf5, 0xf2, 0xf5, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf1, 0xf2, 0xf0, 0xe3, 0xf2, 0xf6, 0xf6, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf6, 0xf0, 0xf2, 0xf7, 0xf6, 0xf9, 0xf8, 0xf2, 0xe3, 0xf7, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xe5, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf6, 0xf6, 0xf2, 0xed, 0xb6, 0xf9, 0xf7, 0xe3, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf7, 0xef, 0xf0, 0xf7, 0xef, 0xf7, 0xef, 0xf8, 0xee, 0xc5, 0xe0, 0xfd, 0xf2, 0xf0, 0xf6, 0xf1, 0xf4, 0xf4, 0xf2, 0xf4, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf2, 0xf0, 0xf0, 0xf6, 0xf8, 0xf6, 0xf8, 0xf5, 0xe3, 0xf5, 0xe6, 0xf7, 0xf8, 0xfc, 0xa8, 0xc2, 0xdd, 0xfa, 0xe3, 0xf0, 0xf5, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf2, 0xee, 0xe1, 0xee, 0xfb, 0xfb, 0xf8, 0x22, 0xf5, 0xf7, 0xe3, 0xfa, 0xef, 0xc6, 0xc2, 0xdf, 0xfd, 0xf7, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xfa, 0xed, 0xc4, 0xc2, 0xc6, 0x13, 0xef, 0xfb, 0xf1, 0x22, 0xf6, 0xf7, 0xeb, 0x7a, 0xc2, 0xc2, 0xed, 0xf8, 0xf5, 0xf4, 0xf4, 0xf2, 0xf3, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf2, 0xf2, 0xf2, 0xf6, 0xf0, 0xf7, 0xf8, 0xf2, 0xf8, 0xf7, 0xec, 0xc6, 0xc2, 0xcb, 0xfe, 0xeb, 0xf7, 0xf8, 0xf4, 0xfa, 0xec, 0xc2, 0xc2, 0xdd, 0xff, 0xf5, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf5, 0xf5, 0xf1, 0xf0, 0xe6, 0xf1, 0xf0, 0xe3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf1, 0xf1, 0xf1, 0xf2, 0xf7, 0xf0, 0xf1, 0xf6, 0xf0, 0xff, 0xfa, 0xef, 0x01, 0xc3, 0xc2, 0xdd, 0xff, 0xf8, 0xf7, 0xfc, 0xfe, 0xc2, 0xc2, 0x00, 0xe1, 0xf7, 0xf5, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xe3, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xe6, 0xf6, 0xf0, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf2, 0xf0, 0xf0, 0xf5, 0xf0, 0xf5, 0xf5, 0xf1, 0xf0, 0xf1, 0xe3, 0xf5, 0xf5, 0xf0, 0xe6, 0xf7, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf6, 0xf2, 0xf6, 0xf2, 0xf2, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xe6, 0xf8, 0xc0, 0xee, 0x01, 0x00, 0xc2, 0xc5, 0xf5, 0xf8, 0xfa, 0xed, 0xc2, 0xc9, 0xc2, 0xa8, 0xfb, 0xf0, 0xf5, 0xf2, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe3, 0xe6, 0xf8, 0xf1, 0xe6, 0xf1, 0xf0, 0xf1, 0xf5, 0xf5, 0xf1, 0xe6, 0xf7, 0xf1, 0xe3, 0xf0, 0xf1, 0xf0, 0xf1, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf6, 0xf2, 0xf2, 0xf6, 0xf2, 0xf6, 0xf2, 0xf6, 0xf2, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf5, 0xf2, 0xf5, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xef, 0xf5, 0xf1, 0xf0, 0xf1, 0xf5, 0xf1, 0xf5, 0xf5, 0xf5, 0xf7, 0xf1, 0xe3, 0xf1, 0xe6, 0xf0, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf6, 0xf2, 0xf6, 0xf2, 0xf6, 0xf2, 0xf5, 0xe6, 0xfb, 0xee, 0xc2, 0xc2, 0xc2, 0xdd, 0xfc, 0xc7, 0xb6, 0xc2, 0xc9, 0xc2, 0x84, 0xfd, 0xf1, 0xf1, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf0, 0xe3, 0xf5, 0xf6, 0xf5, 0xf5, 0xe6, 0xe6, 0xe6, 0xf5, 0xf6, 0xe3, 0xf1, 0xf6, 0xe6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xff, 0xe3, 0xf8, 0xc7, 0xff, 0xfa, 0xfb, 0xfb, 0xf9, 0xf5, 0xe3, 0xe3, 0xf1, 0xe6, 0xf1, 0xe6, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf2, 0xf6, 0xf2, 0xf7, 0xf1, 0xf7, 0xf1, 0xfd, 0xa8, 0x00, 0xc3, 0xc2, 0xec, 0xeb, 0xb0, 0xc2, 0xc2, 0xc2, 0xc5, 0xfd, 0xf5, 0xf1, 0xf7, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xe6, 0xf0, 0xe3, 0xf7, 0xf9, 0xf8, 0xfa, 0xfa, 0xf9, 0xfb, 0xf7, 0xe6, 0xf7, 0xf2, 0xf2, 0xf6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf8, 0xfb, 0xfd, 0xee, 0xec, 0xdf, 0xde, 0xde, 0xe0, 0xec, 0xee, 0xe9, 0xeb, 0xfa, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf6, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf2, 0xf6, 0xf4, 0xf3, 0xff, 0xe3, 0xff, 0xe6, 0xc4, 0xc3, 0xc9, 0x27, 0xfd, 0xaa, 0xc2, 0xc2, 0xc2, 0xcb, 0xeb, 0x22, 0xf0, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf9, 0xc7, 0xfd, 0xf8, 0xed, 0xfe, 0xa8, 0xa8, 0xec, 0xb1, 0xf7, 0xfd, 0xfb, 0xf7, 0xf6, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf3, 0xf6, 0xf2, 0xf2, 0xf0, 0xf5, 0xf5, 0xf5, 0xfc, 0xb6, 0x13, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc6, 0xde, 0xfe, 0xf0, 0xfa, 0xf7, 0xf6, 0xe6, 0xf0, 0xf4, 0xf7, 0xe3, 0xf0, 0xf6, 0xf2, 0xf6, 0xf2, 0xf2, 0xf0, 0xf1, 0xf6, 0xf0, 0xf0, 0xf6, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf7, 0xf9, 0xfc, 0xf7, 0xfd, 0xff, 0xfd, 0xec, 0xc2, 0xc3, 0xc2, 0xec, 0x7a, 0xc2, 0xc2, 0xc2, 0xc9, 0xfd, 0xeb, 0xfb, 0xf8, 0xf8, 0xf6, 0xf6, 0xf1, 0xf6, 0xf5, 0xf6, 0xf1, 0xf6, 0xf1, 0xf1, 0xf4, 0xf1, 0xf6, 0xf6, 0xf2, 0xf0, 0xf2, 0xf6, 0xf0, 0xf0, 0xf0, 0xf4, 0xf2, 0xf0, 0xf1, 0xf8, 0xfa, 0xf5, 0xed, 0xe0, 0x01, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xdd, 0xec, 0xf0, 0xeb, 0xf5, 0xf6, 0xf0, 0xf0, 0xf6, 0xf0, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf3, 0xef, 0xf4, 0xf0, 0xf7, 0xf5, 0xf7, 0xf8, 0x9d, 0xc9, 0xc2, 0xc2, 0xc2, 0x00, 0xc2, 0x00, 0xc2, 0xc3, 0xc3, 0xc3, 0xc2, 0xc3, 0xc2, 0xc4, 0xcf, 0xef, 0xf8, 0xf7, 0xf4, 0xf3, 0xef, 0xf7, 0xf7, 0xf0, 0xf0, 0xf4, 0xf0, 0xf6, 0xf7, 0xe6, 0xf6, 0xf7, 0xf7, 0xf0, 0xf2, 0xf7, 0xf9, 0xea, 0xeb, 0xf6, 0xb6, 0xb1, 0xfe, 0xa8, 0x13, 0xcf, 0xe0, 0xc2, 0x00, 0xc2, 0xc4, 0xc6, 0xc2, 0x00, 0xc2, 0x00, 0xcf, 0xa8, 0xb0, 0xee, 0xf7, 0xfa, 0xc7, 0xeb, 0xf8, 0xe6, 0xf5, 0xf5, 0xf1, 0xf5, 0x22, 0xf5, 0xf4, 0xf1, 0xf0, 0xe6, 0xf6, 0xe5, 0xf6, 0xe4, 0xf7, 0xf7, 0xf0, 0xe3, 0xf7, 0xfa, 0xe8, 0xfe, 0xc5, 0xc9, 0xc2, 0xc2, 0xc2, 0xc3, 0xc2, 0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xa8, 0xff, 0xfa, 0xf7, 0xf7, 0xe3, 0xf8, 0xe3, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe3, 0xf3, 0xf9, 0xf3, 0xf1, 0xf0, 0xfb, 0xe1, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0x00, 0xc3, 0xc3, 0xc3, 0x25, 0x25, 0x26, 0x26, 0x28, 0x25, 0x26, 0x25, 0xc2, 0xc3, 0x84, 0xed, 0xfc, 0xc1, 0xf8, 0xf0, 0xf0, 0xf3, 0xf6, 0xf6, 0xf2, 0xe3, 0xe6, 0xe6, 0xe3, 0xf2, 0xf7, 0xfc, 0xe9, 0xee, 0xfe, 0xdf, 0xc5, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0x27, 0xc2, 0xc3, 0x25, 0xc2, 0x27, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0x01, 0xde, 0xec, 0xb6, 0xfc, 0xfa, 0xfa, 0xf0, 0xf1, 0xf0, 0xe3, 0xf4, 0xf1, 0xe5, 0xe6, 0xe5, 0xe5, 0xf2, 0xf0, 0xf0, 0xf0, 0xff, 0xfc, 0xe6, 0xec, 0x31, 0xc3, 0xc2, 0x25, 0x25, 0x28, 0x28, 0x26, 0x26, 0x25, 0xc3, 0xc3, 0xc2, 0x00, 0xc2, 0xc2, 0xc2, 0xc2, 0xcb, 0xfe, 0xfc, 0xf7, 0xf7, 0xe3, 0xf7, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xe3, 0xe5, 0xef, 0xf9, 0xfb, 0xaa, 0x00, 0xc2, 0x00, 0x00, 0xc3, 0xc3, 0xc3, 0x25, 0x28, 0x2b, 0x3b, 0x44, 0x49, 0x4a, 0x41, 0x41, 0x33, 0x26, 0x2b, 0x25, 0xc2, 0x2c, 0x7a, 0xb1, 0xc0, 0xbe, 0xf1, 0xf1, 0xf2, 0xf0, 0xf6, 0xe5, 0xf0, 0xe6, 0xf7, 0xc7, 0xef, 0xec, 0xdd, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 0xc2, 0xc3, 0xc3, 0xc3, 0x25, 0xc3, 0x25, 0x25, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x25, 0xc2, 0x25, 0x27, 0xc2, 0xc3, 0xc2, 0xc2, 0xc2, 0xc9, 0x01, 0xa8, 0xee, 0xfc, 0xf8, 0xf7, 0xf4, 0xf4, 0xf0, 0xf7, 0xe5, 0xe3, 0xf7, 0xe6, 0xf1, 0xf7, 0xc0, 0xf8, 0xac, 0xc4, 0xc3, 0x26, 0x28, 0x2b, 0x36, 0x3a, 0x49, 0x44, 0x44, 0x44, 0x3b, 0x2d, 0x28, 0xc3, 0xc3, 0xc3, 0xc3, 0x00, 0xc3, 0xc2, 0x00, 0xdf, 0xf4, 0xf9, 0xf2, 0xf0, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xe3, 0xe6, 0xf9, 0xe9, 0xdf, 0xc2, 0xc2, 0x00, 0xc2, 0x27, 0xc3, 0x25, 0x2b, 0x36, 0x44, 0x4a, 0x43, 0x43, 0x40, 0x43, 0x40, 0x4a, 0x45, 0x44, 0x3b, 0x32, 0x29, 0x25, 0xc3, 0x25, 0x84, 0xee, 0xc7, 0xf1, 0xf1, 0xf7, 0xe5, 0xe3, 0xf9, 0xe9, 0xe1, 0xdf, 0xc6, 0xc2, 0xc2, 0xc2, 0xc3, 0x26, 0x26, 0x26, 0x26, 0x28, 0x2b, 0x2c, 0x2b, 0x31, 0x2d, 0x31, 0x2b, 0x3d, 0x2c, 0x32, 0x31, 0x34, 0x2d, 0x2b, 0x31, 0x30, 0x2c, 0x28, 0x2a, 0xc3, 0x27, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xde, 0xfe, 0xeb, 0xfa, 0xf9, 0xe3, 0xe5, 0xf6, 0xe5, 0xe6, 0xf1, 0xc7, 0xbd, 0xfe, 0x52, 0xc3, 0x26, 0x28, 0x3b, 0x3b, 0x45, 0x46, 0x3f, 0x43, 0x39, 0x39, 0x43, 0x4a, 0x4d, 0x49, 0x2e, 0x26, 0x25, 0xc3, 0x27, 0x00, 0x00, 0x00, 0xc2, 0xc5, 0xef, 0xe8, 0xf7, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf0, 0xe6, 0xf1, 0xf0, 0xe6, 0xe9, 0xef, 0xdd, 0xc2, 0xc2, 0x00, 0xc2, 0x27, 0xc2, 0x26, 0x33, 0x41, 0x3f, 0x46, 0x47, 0x5b, 0x6d, 0x6e, 0x6d, 0x5b, 0x4b, 0x43, 0x43, 0x45, 0x40, 0x44, 0x35, 0x2d, 0x29, 0x25, 0x28, 0xaa, 0x22, 0xbe, 0xef, 0xf9, 0xff, 0xed, 0xdd, 0xc2, 0xc2, 0xc2, 0x25, 0xc3, 0x26, 0x2a, 0x2b, 0x30, 0x34, 0x33, 0x34, 0x37, 0x34, 0x33, 0x34, 0x30, 0x34, 0x3d, 0x2b, 0x2d, 0x30, 0x34, 0x2d, 0x34, 0x34, 0x37, 0x34, 0x37, 0x3e, 0x36, 0x38, 0x38, 0x31, 0x30, 0x27, 0x2a, 0xc2, 0xc2, 0xc2, 0x01, 0xec, 0xf4, 0xfa, 0xf0, 0xf1, 0xe6, 0xc0, 0xbe, 0xb0, 0x68, 0xc3, 0x29, 0x2d, 0x3b, 0x45, 0x40, 0x40, 0x43, 0x4b, 0x61, 0x73, 0x7f, 0x7f, 0x76, 0x57, 0x4b, 0x4e, 0x4d, 0x3f, 0x29, 0x26, 0xc3, 0xc3, 0xc3, 0xc2, 0x00, 0xc2, 0xc6, 0xe1, 0xc7, 0xe3, 0xe6, 0xf0, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf4, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf5, 0xf0, 0xf5, 0xf1, 0xc7, 0xef, 0x01, 0xc2, 0xc2, 0xc2, 0x27, 0xc3, 0x25, 0x2c, 0x35, 0x3c, 0x43, 0x47, 0x70, 0x91, 0xa5, 0xa5, 0xa1, 0xa5, 0xa0, 0xa0, 0x8f, 0x6d, 0x47, 0x43, 0x40, 0x4a, 0x39, 0x2f, 0x2e, 0x28, 0x25, 0x68, 0xb6, 0xfd, 0xe1, 0xdd, 0xc2, 0xc2, 0xc3, 0x25, 0x2a, 0x2c, 0x31, 0x31, 0x37, 0x34, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x37, 0x35, 0x33, 0x36, 0x33, 0x36, 0x36, 0x34, 0x36, 0x3d, 0x34, 0x2c, 0x26, 0xc3, 0xc2, 0x01, 0xfe, 0x24, 0xc7, 0xc7, 0xb6, 0x81, 0xc3, 0x2d, 0x36, 0x3b, 0x45, 0x45, 0x39, 0x43, 0x50, 0x7b, 0x91, 0x9b, 0xa0, 0x9b, 0x9f, 0xa0, 0x9b, 0x7f, 0x57, 0x53, 0x53, 0x2f, 0x29, 0x2a, 0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0xc2, 0xc6, 0xfe, 0xfd, 0xf5, 0xf0, 0xe6, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xe3, 0xf7, 0xf1, 0xe9, 0xed, 0xcb, 0xc2, 0x00, 0xc3, 0xc3, 0x27, 0x28, 0x30, 0x37, 0x39, 0x4a, 0x47, 0x7f, 0xa5, 0xa1, 0x9f, 0x9c, 0x9f, 0x9f, 0xa4, 0x9f, 0xa0, 0xa4, 0xa0, 0x7f, 0x50, 0x43, 0x50, 0x45, 0x39, 0x29, 0x3b, 0x26, 0xc6, 0x52, 0xc2, 0xc3, 0xc3, 0x2b, 0x31, 0x31, 0x31, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x35, 0x35, 0x36, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x35, 0x36, 0x35, 0x35, 0x35, 0x39, 0x35, 0x35, 0x35, 0x33, 0x37, 0x37, 0x3d, 0x32, 0x2c, 0x25, 0xc2, 0x31, 0xec, 0xa7, 0x2c, 0x25, 0x41, 0x2e, 0x44, 0x45, 0x43, 0x40, 0x57, 0x88, 0x9b, 0x9f, 0xa0, 0x9b, 0x9c, 0x9b, 0x98, 0x9c, 0x9b, 0x9f, 0x8f, 0x63, 0x54, 0x4e, 0x2f, 0x2e, 0x30, 0x26, 0x25, 0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0xaa, 0xfa, 0xf7, 0xf5, 0xe6, 0xf5, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf0, 0xf1, 0xf1, 0xe9, 0xee, 0xc9, 0xc2, 0x00, 0x27, 0xc3, 0x26, 0x2a, 0x32, 0x3b, 0x2f, 0x43, 0x4b, 0x6d, 0xa0, 0x9f, 0x9c, 0xa1, 0xa1, 0xa1, 0x9c, 0x9b, 0x9f, 0xa1, 0x9f, 0x9f, 0xa4, 0x9b, 0x70, 0x40, 0x4b, 0x4d, 0x44, 0x33, 0x2b, 0x26, 0xc3, 0x26, 0x26, 0x2c, 0x33, 0x33, 0x30, 0x33, 0x33, 0x37, 0x2e, 0x36, 0x2e, 0x35, 0x33, 0x35, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x38, 0x33, 0x36, 0x36, 0x35, 0x36, 0x36, 0x35, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x2f, 0x32, 0x35, 0x35, 0x3b, 0x32, 0x42, 0x3e, 0x25, 0x25, 0x2a, 0x37, 0x2e, 0x3c, 0x45, 0x43, 0x39, 0x43, 0x7b, 0x9b, 0x9b, 0x9b, 0x98, 0x9c, 0x98, 0x98, 0x98, 0x9c, 0x98, 0x98, 0x9c, 0xa1, 0x82, 0x54, 0x65, 0x43, 0x2d, 0x33, 0x2d, 0x2a, 0x26, 0xc2, 0x27, 0xc3, 0xc2, 0xc2, 0x13, 0xfd, 0xf7, 0xe3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xe5, 0xf0, 0xf4, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf1, 0xe5, 0xf1, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf5, 0xe6, 0xeb, 0xfe, 0x00, 0xc2, 0x27, 0xc2, 0x27, 0x27, 0x2c, 0x38, 0x3b, 0x35, 0x39, 0x50, 0x4f, 0x88, 0xa5, 0x9c, 0xa1, 0x9c, 0x9c, 0xa1, 0xa1, 0xa1, 0xa1, 0x9b, 0x9c, 0xa1, 0x9f, 0xa4, 0xa5, 0x8f, 0x54, 0x43, 0x4a, 0x3c, 0x32, 0x2b, 0x2c, 0x3d, 0x30, 0x3b, 0x3a, 0x2e, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x35, 0x32, 0x35, 0x32, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x35, 0x36, 0x3b, 0x3c, 0x35, 0x36, 0x2f, 0x3b, 0x2e, 0x32, 0x37, 0x41, 0x37, 0x3b, 0x45, 0x44, 0x40, 0x39, 0x70, 0x91, 0xa0, 0x98, 0x9c, 0x9c, 0x98, 0x9c, 0x9c, 0x98, 0x9c, 0x9f, 0x9a, 0x9c, 0x9a, 0x9c, 0xa0, 0x7f, 0x4b, 0x54, 0x2f, 0x2f, 0x35, 0x30, 0x2c, 0x2a, 0xc2, 0xc2, 0xc3, 0xc2, 0xc2, 0xdf, 0xf9, 0xf8, 0xf1, 0xf0, 0xe6, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf4, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf4, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf4, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe6, 0xf1, 0xe6, 0xf0, 0xe6, 0xf1, 0xeb, 0xfe, 0x00, 0x00, 0x00, 0xc3, 0x27, 0x27, 0x2a, 0x38, 0x3b, 0x39, 0x2f, 0x4a, 0x4b, 0x6d, 0x9b, 0x9f, 0xa1, 0x9c, 0xa1, 0xa1, 0xa1, 0xa1, 0x9f, 0x9f, 0xa1, 0xa1, 0x9f, 0x9f, 0x9f, 0x9b, 0xa0, 0xa0, 0x5e, 0x3f, 0x2f, 0x37, 0x37, 0x3d, 0x30, 0x3b, 0x35, 0x35, 0x3a, 0x35, 0x36, 0x35, 0x36, 0x35, 0x33, 0x2e, 0x35, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x38, 0x33, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3c, 0x36, 0x3a, 0x35, 0x35, 0x3b, 0x2f, 0x2f, 0x37, 0x33, 0x41, 0x33, 0x3c, 0x39, 0x4a, 0x83, 0xa0, 0x97, 0x9b, 0x9c, 0x98, 0x9c, 0x9c, 0x9c, 0x98, 0x9f, 0x98, 0x9a, 0x9c, 0x9a, 0x9f, 0x98, 0x9f, 0x91, 0x66, 0x54, 0x43, 0x2f, 0x2e, 0x3b, 0x30, 0x2c, 0x25, 0xc3, 0xc3, 0xc2, 0x00, 0xc2, 0xdf, 0xfa, 0xf8, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf0, 0xe3, 0xf7, 0xe3, 0xe6, 0xe6, 0xfd, 0xa8, 0xc2, 0xc3, 0xc2, 0xc3, 0xc3, 0xc3, 0x29, 0x34, 0x36, 0x3b, 0x39, 0x2f, 0x50, 0x4f, 0x78, 0xa1, 0xa1, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0xa0, 0xa0, 0xa0, 0x9b, 0xa1, 0x9c, 0x9f, 0x9f, 0xa4, 0x9e, 0x6c, 0x35, 0x35, 0x36, 0x33, 0x33, 0x35, 0x36, 0x36, 0x36, 0x35, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x35, 0x36, 0x35, 0x36, 0x33, 0x36, 0x35, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x3b, 0x36, 0x36, 0x3b, 0x35, 0x33, 0x43, 0x7f, 0xa0, 0x9b, 0x9a, 0x9c, 0x9a, 0x9c, 0x9c, 0x9b, 0x9b, 0x9c, 0x98, 0x9c, 0x9c, 0x9c, 0x9c, 0x98, 0xa0, 0x76, 0x57, 0x50, 0x2f, 0x2f, 0x36, 0x36, 0x3a, 0x30, 0x28, 0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0xdd, 0xf0, 0xfa, 0xf0, 0xf1, 0xf1, 0xf5, 0xf2, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xe6, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xe6, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xe6, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xe6, 0xe8, 0xef, 0xf7, 0xf7, 0xfa, 0xe0, 0xc2, 0xc2, 0xc3, 0x00, 0xc2, 0xc3, 0x2d, 0x32, 0x36, 0x3b, 0x3c, 0x35, 0x40, 0x53, 0x4f, 0x8c, 0xa1, 0x9f, 0xa1, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa0, 0x9f, 0x9f, 0xa1, 0x9f, 0xa4, 0x8c, 0x4e, 0x2e, 0x35, 0x36, 0x36, 0x36, 0x35, 0x36, 0x36, 0x35, 0x33, 0x36, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x33, 0x36, 0x33, 0x36, 0x35, 0x36, 0x33, 0x36, 0x33, 0x3b, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x2f, 0x39, 0x6c, 0x97, 0x9b, 0x9c, 0x9c, 0x9c, 0x9b, 0x9b, 0x9c, 0x98, 0x9c, 0x9c, 0x9a, 0x9c, 0x98, 0x9f, 0x9f, 0x87, 0x61, 0x53, 0x43, 0x35, 0x35, 0x36, 0x35, 0x3a, 0x30, 0x28, 0xc2, 0xc3, 0xc2, 0x00, 0xc2, 0xdd, 0xb6, 0xeb, 0xe3, 0x22, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf0, 0xf3, 0xf2, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xe3, 0xf6, 0xf9, 0xe3, 0xde, 0xc2, 0xc2, 0x27, 0x00, 0xc3, 0x25, 0x2b, 0x34, 0x3b, 0x37, 0x3c, 0x35, 0x39, 0x45, 0x54, 0x57, 0x9c, 0xa0, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x9b, 0xa0, 0xa4, 0x83, 0x3f, 0x2e, 0x3f, 0x36, 0x36, 0x33, 0x35, 0x33, 0x35, 0x36, 0x33, 0x36, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x35, 0x33, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x2f, 0x50, 0x8f, 0x9b, 0x9b, 0x98, 0x9c, 0x9c, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x98, 0x9f, 0x98, 0x9f, 0x66, 0x54, 0x45, 0x2f, 0x32, 0x35, 0x35, 0x3a, 0x33, 0x2d, 0x26, 0x27, 0xc2, 0xc3, 0x00, 0xc2, 0xc9, 0xe1, 0xeb, 0xf6, 0xe6, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf4, 0xf0, 0xf4, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf7, 0xfa, 0xed, 0xcb, 0xc2, 0xc2, 0x27, 0x27, 0x27, 0x25, 0x31, 0x3b, 0x32, 0x2f, 0x35, 0x35, 0x35, 0x3f, 0x4e, 0x5e, 0x64, 0xa0, 0x9f, 0xa1, 0x9c, 0xa1, 0x9f, 0x9f, 0x9f, 0xa1, 0x9c, 0xa1, 0x9c, 0xa4, 0xa4, 0x70, 0x35, 0x2f, 0x3a, 0x38, 0x36, 0x35, 0x36, 0x36, 0x3b, 0x33, 0x36, 0x35, 0x33, 0x36, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x33, 0x36, 0x33, 0x35, 0x36, 0x33, 0x36, 0x33, 0x3b, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3a, 0x33, 0x3f, 0x2e, 0x40, 0x83, 0xa0, 0x9b, 0x98, 0x9c, 0x9c, 0x9b, 0x98, 0x9c, 0x9a, 0x9c, 0x9c, 0x9c, 0x98, 0x9f, 0x76, 0x53, 0x50, 0x2f, 0x2f, 0x2e, 0x35, 0x2f, 0x35, 0x34, 0x3d, 0x2a, 0x25, 0x00, 0xc3, 0x00, 0xc2, 0xc2, 0xe0, 0xe8, 0xf9, 0xf6, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf4, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xfa, 0xfd, 0xa8, 0xc9, 0xc2, 0x00, 0x27, 0x27, 0x2a, 0x27, 0x3d, 0x37, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x43, 0x59, 0x54, 0x6e, 0xa4, 0x9f, 0xa0, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa1, 0x9f, 0xa4, 0x75, 0x29, 0x2f, 0x36, 0x38, 0x38, 0x36, 0x33, 0x35, 0x36, 0x36, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x33, 0x35, 0x36, 0x35, 0x36, 0x36, 0x3b, 0x36, 0x3b, 0x36, 0x3b, 0x36, 0x3b, 0x36, 0x36, 0x33, 0x3b, 0x3b, 0x2f, 0x39, 0x75, 0xa4, 0x9c, 0x9c, 0x9a, 0x98, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x98, 0x98, 0x9f, 0x82, 0x50, 0x53, 0x35, 0x3b, 0x35, 0x35, 0x39, 0x35, 0x32, 0x32, 0x31, 0x31, 0xc3, 0xc3, 0x00, 0x00, 0xc2, 0xc2, 0xdd, 0xe1, 0xeb, 0xf7, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf0, 0xf2, 0xf1, 0xf0, 0xe3, 0xf5, 0xf5, 0xf8, 0xfa, 0xb1, 0x01, 0xc2, 0x00, 0xc2, 0xc3, 0xc2, 0xc3, 0x2a, 0x31, 0x37, 0x33, 0x35, 0x35, 0x2f, 0x35, 0x3c, 0x33, 0x46, 0x5e, 0x4f, 0x76, 0xa4, 0xa1, 0xa1, 0x9f, 0xa1, 0xa1, 0x9f, 0x9f, 0xa1, 0x9a, 0x9f, 0xa5, 0x65, 0x2f, 0x2f, 0x32, 0x34, 0x36, 0x38, 0x38, 0x35, 0x36, 0x36, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x35, 0x36, 0x36, 0x33, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x37, 0x38, 0x37, 0x32, 0x32, 0x2f, 0x2f, 0x70, 0xa4, 0x9f, 0x98, 0x9b, 0x98, 0x98, 0x9c, 0x9a, 0x9c, 0x9c, 0x98, 0x9f, 0x8b, 0x54, 0x53, 0x39, 0x2f, 0x2e, 0x35, 0x2f, 0x35, 0x2f, 0x32, 0x2d, 0x32, 0x2c, 0x26, 0xc3, 0xc2, 0x00, 0xc2, 0xc2, 0xc2, 0x84, 0xef, 0xc7, 0xe6, 0xf1, 0xf5, 0xf6, 0xf0, 0xf0, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xe3, 0xf7, 0xef, 0xf0, 0xf8, 0xf7, 0xf7, 0xeb, 0xee, 0x7a, 0xc2, 0xc2, 0x00, 0xc2, 0xc2, 0x25, 0x25, 0x2c, 0x30, 0x37, 0x30, 0x35, 0x2f, 0x35, 0x2f, 0x35, 0x3a, 0x35, 0x46, 0x5e, 0x57, 0x76, 0xa5, 0xa1, 0x9f, 0x9f, 0xa1, 0x9c, 0x9f, 0x9f, 0x9f, 0xa1, 0xa5, 0x73, 0x29, 0x39, 0x32, 0x32, 0x32, 0x38, 0x38, 0x36, 0x36, 0x33, 0x35, 0x36, 0x35, 0x33, 0x33, 0x33, 0x35, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x36, 0x35, 0x36, 0x35, 0x33, 0x36, 0x35, 0x36, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x37, 0x37, 0x34, 0x37, 0x3b, 0x2f, 0x39, 0x73, 0xa0, 0xa0, 0x9b, 0x9c, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x8f, 0x54, 0x54, 0x3b, 0x35, 0x32, 0x35, 0x35, 0x35, 0x35, 0x32, 0x33, 0x34, 0x34, 0x2b, 0x28, 0x25, 0xc3, 0xc3, 0xc2, 0xc2, 0xc2, 0xc6, 0xa8, 0xfa, 0xe9, 0xf7, 0xef, 0xf7, 0xf7, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xe3, 0xf7, 0xf7, 0xf7, 0xff, 0xe1, 0x7a, 0xc2, 0xc2, 0xc2, 0xc3, 0xc2, 0xc2, 0x26, 0x25, 0x30, 0x37, 0x37, 0x36, 0x35, 0x36, 0x35, 0x35, 0x2f, 0x35, 0x35, 0x33, 0x4e, 0x5f, 0x57, 0x78, 0xa5, 0xa0, 0x9f, 0xa1, 0x9c, 0xa1, 0xa1, 0x9f, 0xa0, 0xa5, 0x70, 0x2f, 0x39, 0x2e, 0x32, 0x32, 0x37, 0x34, 0x36, 0x36, 0x35, 0x36, 0x36, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x35, 0x36, 0x33, 0x36, 0x33, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x38, 0x37, 0x37, 0x37, 0x35, 0x3c, 0x35, 0x39, 0x77, 0xa0, 0x9b, 0x9b, 0x9f, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x8b, 0x5b, 0x53, 0x40, 0x2e, 0x33, 0x33, 0x35, 0x35, 0x33, 0x33, 0x35, 0x33, 0x36, 0x33, 0x34, 0x2b, 0x25, 0xc3, 0x27, 0xc2, 0x00, 0xc2, 0xc2, 0xcb, 0xa8, 0xf8, 0xfc, 0xf0, 0xf2, 0xf6, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf2, 0xe3, 0xff, 0xf8, 0xf5, 0xed, 0xdd, 0x00, 0xc2, 0xc2, 0xc2, 0x00, 0xc3, 0x27, 0x25, 0x2a, 0x31, 0x34, 0x33, 0x33, 0x36, 0x36, 0x36, 0x35, 0x35, 0x32, 0x35, 0x33, 0x35, 0x4e, 0x5e, 0x5b, 0x7b, 0xa5, 0xa1, 0x9f, 0x9f, 0xa1, 0x9f, 0x9c, 0xa1, 0xa5, 0x80, 0x35, 0x2e, 0x33, 0x3b, 0x33, 0x36, 0x34, 0x36, 0x36, 0x36, 0x36, 0x33, 0x35, 0x36, 0x35, 0x33, 0x33, 0x33, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x36, 0x35, 0x36, 0x35, 0x33, 0x36, 0x35, 0x36, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x35, 0x37, 0x35, 0x3a, 0x3a, 0x3a, 0x33, 0x3c, 0x39, 0x3c, 0x7f, 0xa4, 0x98, 0x98, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x91, 0x5b, 0x54, 0x44, 0x2e, 0x37, 0x33, 0x36, 0x3a, 0x33, 0x38, 0x33, 0x35, 0x33, 0x35, 0x33, 0x3b, 0x2a, 0x26, 0xc3, 0xc3, 0xc2, 0xc2, 0x00, 0xc2, 0xc2, 0xc5, 0xfe, 0xea, 0xf7, 0xf6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf7, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf7, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf7, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf4, 0xf6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf7, 0xfb, 0xee, 0xdd, 0xc2, 0xc2, 0xc2, 0xc2, 0x00, 0x00, 0xc2, 0xc3, 0x25, 0x2c, 0x3d, 0x30, 0x32, 0x33, 0x35, 0x35, 0x2f, 0x38, 0x2e, 0x37, 0x2e, 0x32, 0x33, 0x33, 0x5a, 0x63, 0x57, 0x7b, 0xa5, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1, 0x9f, 0xa5, 0x88, 0x39, 0x29, 0x3b, 0x36, 0x37, 0x38, 0x36, 0x36, 0x37, 0x35, 0x36, 0x35, 0x36, 0x36, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x35, 0x35, 0x3a, 0x3a, 0x38, 0x38, 0x3a, 0x35, 0x2e, 0x43, 0x88, 0xa5, 0x91, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x91, 0x5b, 0x5e, 0x45, 0x2e, 0x36, 0x33, 0x38, 0x33, 0x38, 0x38, 0x35, 0x38, 0x35, 0x36, 0x35, 0x32, 0x33, 0x31, 0x2c, 0xc3, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0xc2, 0xc2, 0xdd, 0xb6, 0xfa, 0xf6, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf2, 0xf4, 0xe3, 0xf0, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf4, 0xe3, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xe5, 0xe6, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf2, 0xf4, 0xe3, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf2, 0xf2, 0xe3, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf7, 0xf0, 0xf7, 0xf0, 0x22, 0x22, 0xcf, 0x00, 0xc2, 0xc2, 0xc2, 0xc3, 0xc2, 0xc2, 0xc3, 0x25, 0x29, 0x30, 0x32, 0x33, 0x2d, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x36, 0x2e, 0x37, 0x2e, 0x35, 0x35, 0x59, 0x5e, 0x5b, 0x73, 0xa4, 0x9f, 0xa1, 0xa1, 0xa1, 0x9c, 0xa5, 0x97, 0x45, 0x2e, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x35, 0x38, 0x35, 0x36, 0x36, 0x36, 0x35, 0x2f, 0x46, 0x97, 0xa0, 0x98, 0x9c, 0x98, 0x9c, 0x98, 0x9b, 0x8f, 0x57, 0x5f, 0x43, 0x2f, 0x36, 0x32, 0x33, 0x33, 0x36, 0x33, 0x36, 0x35, 0x35, 0x35, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x2a, 0xc3, 0xc3, 0xc2, 0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0x13, 0xff, 0xe6, 0xf7, 0xf0, 0xf0, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe6, 0xf2, 0xf0, 0xf4, 0xf3, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf0, 0xf4, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe6, 0xf2, 0xf0, 0xf4, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe6, 0xf2, 0xf0, 0xf3, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe5, 0xe6, 0xf2, 0xf1, 0xf3, 0xe3, 0xf7, 0xb9, 0xf1, 0xff, 0x7a, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 0xc2, 0xc3, 0x25, 0x2c, 0x2d, 0x2e, 0x35, 0x35, 0x33, 0x35, 0x33, 0x35, 0x32, 0x35, 0x2e, 0x35, 0x33, 0x35, 0x33, 0x33, 0x35, 0x39, 0x5e, 0x63, 0x5b, 0x70, 0xa4, 0x9f, 0xa1, 0x9c, 0xa1, 0xa5, 0xa4, 0x5a, 0x2e, 0x36, 0x36, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x36, 0x36, 0x33, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x36, 0x2e, 0x3b, 0x62, 0xa4, 0x9b, 0x9c, 0x9a, 0x9c, 0x98, 0x9b, 0x8b, 0x54, 0x63, 0x43, 0x35, 0x2f, 0x33, 0x33, 0x33, 0x38, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x36, 0x33, 0x31, 0x2c, 0x25, 0xc3, 0xc3, 0xc2, 0xc2, 0x00, 0xc2, 0xc2, 0xcf, 0xf9, 0xf1, 0xe3, 0xf8, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xe6, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xe6, 0xe6, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xe6, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xe6, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe6, 0xf1, 0xf2, 0xf2, 0xf4, 0xf0, 0xf4, 0xfa, 0xde, 0xc2, 0xc2, 0x27, 0xc3, 0xc2, 0xc3, 0x25, 0x28, 0x31, 0x30, 0x34, 0x33, 0x35, 0x37, 0x35, 0x2e, 0x35, 0x2e, 0x33, 0x2e, 0x33, 0x35, 0x36, 0x2e, 0x32, 0x33, 0x2f, 0x39, 0x5e, 0x5e, 0x61, 0x6d, 0xa0, 0x9f, 0xa1, 0xa1, 0x9f, 0xa5, 0x80, 0x29, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x35, 0x36, 0x3b, 0x2e, 0x35, 0x73, 0xa0, 0x98, 0x98, 0x98, 0x98, 0x9c, 0x88, 0x4f, 0x5f, 0x46, 0x39, 0x2e, 0x33, 0x32, 0x33, 0x35, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x36, 0x37, 0x34, 0x31, 0x2c, 0x2a, 0xc3, 0x00, 0xc2, 0xc2, 0xc2, 0xc2, 0x13, 0xe9, 0xf7, 0xe3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xe6, 0xf1, 0xf2, 0xf0, 0xf3, 0xf0, 0xf1, 0xf1, 0xe5, 0xf1, 0xf2, 0xf0, 0xf3, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xe6, 0xf1, 0xf2, 0xf0, 0xf3, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xe6, 0xf1, 0xf2, 0xf0, 0xf3, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf0, 0xf3, 0xf0, 0xf1, 0xf7, 0xb1, 0x00, 0xc3, 0xc3, 0xc2, 0xc2, 0xc3, 0x25, 0x2c, 0x34, 0x37, 0x30, 0x2e, 0x35, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x35, 0x32, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x35, 0x3c, 0x5e, 0x63, 0x61, 0x66, 0x9b, 0xa1, 0xa1, 0x9f, 0xa5, 0x97, 0x40, 0x2f, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x33, 0x35, 0x33, 0x33, 0x39, 0x40, 0x97, 0x9f, 0x98, 0x98, 0x98, 0x98, 0x82, 0x54, 0x63, 0x4a, 0x35, 0x2f, 0x33, 0x33, 0x33, 0x38, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x36, 0x33, 0x36, 0x34, 0x34, 0x31, 0xc3, 0xc2, 0x27, 0x27, 0xc2, 0xc2, 0x00, 0xf7, 0xe6, 0xf0, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe6, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe6, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe6, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe6, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf6, 0xfc, 0x84, 0xc2, 0xc2, 0x00, 0xc3, 0x25, 0x31, 0x34, 0x37, 0x33, 0x36, 0x35, 0x38, 0x2e, 0x33, 0x2e, 0x33, 0x35, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x35, 0x36, 0x2e, 0x32, 0x33, 0x2f, 0x3c, 0x65, 0x63, 0x63, 0x61, 0x98, 0xa0, 0xa1, 0xa0, 0xa5, 0x51, 0x2e, 0x36, 0x37, 0x36, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x35, 0x36, 0x36, 0x37, 0x35, 0x2f, 0x5e, 0xa0, 0x98, 0x98, 0x98, 0x98, 0x78, 0x4f, 0x63, 0x4a, 0x39, 0x2e, 0x35, 0x32, 0x33, 0x35, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x35, 0x35, 0x36, 0x34, 0x3e, 0x2c, 0xc2, 0xc3, 0xc2, 0x00, 0xc2, 0xec, 0xf7, 0xf5, 0xe6, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf2, 0xf0, 0xf3, 0xf2, 0xf1, 0xf1, 0xe6, 0xf1, 0xf2, 0xf0, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf2, 0xf0, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf2, 0xf0, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf2, 0xf1, 0xf3, 0xf0, 0xf7, 0xf7, 0xc4, 0xc2, 0xc2, 0xc2, 0xc3, 0x2c, 0x31, 0x34, 0x36, 0x2e, 0x36, 0x35, 0x35, 0x33, 0x2e, 0x33, 0x35, 0x33, 0x2e, 0x35, 0x32, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x35, 0x40, 0x65, 0x67, 0x61, 0x61, 0x8f, 0xa1, 0xa0, 0xa5, 0x8c, 0x2f, 0x3c, 0x33, 0x34, 0x33, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x33, 0x33, 0x3a, 0x2f, 0x3c, 0x82, 0x97, 0x98, 0x91, 0x91, 0x6e, 0x5b, 0x5f, 0x4e, 0x2f, 0x2f, 0x33, 0x33, 0x33, 0x38, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x35, 0x3a, 0x2f, 0x36, 0x33, 0x34, 0x31, 0x2a, 0xc3, 0xc2, 0xc2, 0xc2, 0xde, 0xfa, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf0, 0xf6, 0xf0, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf0, 0xf6, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xe5, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf0, 0xf6, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf0, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xe6, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf5, 0xc9, 0xc2, 0xc2, 0xc3, 0x25, 0x31, 0x33, 0x33, 0x35, 0x35, 0x35, 0x35, 0x36, 0x33, 0x35, 0x33, 0x2e, 0x33, 0x35, 0x2e, 0x33, 0x2e, 0x33, 0x35, 0x36, 0x2e, 0x32, 0x35, 0x2e, 0x40, 0x65, 0x63, 0x61, 0x5c, 0x87, 0xa0, 0xa5, 0x9e, 0x4e, 0x2d, 0x35, 0x2d, 0x34, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x35, 0x36, 0x3b, 0x30, 0x33, 0x35, 0x2f, 0x4e, 0xa0, 0x8f, 0x9f, 0x8a, 0x64, 0x61, 0x65, 0x4e, 0x35, 0x35, 0x33, 0x32, 0x33, 0x35, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2f, 0x35, 0x35, 0x35, 0x35, 0x30, 0x34, 0x31, 0xc3, 0xc2, 0xc2, 0xc2, 0xc5, 0xe6, 0xf5, 0xf6, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xe5, 0xf1, 0xf2, 0xf1, 0xf3, 0xf6, 0xf2, 0xf1, 0xe5, 0xf1, 0xf2, 0xf1, 0xf3, 0xf6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xe5, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xe5, 0xf1, 0xf2, 0xf1, 0xf3, 0xf6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xe5, 0xf1, 0xf2, 0xf1, 0xf3, 0xf6, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xe5, 0xf1, 0xf2, 0xf0, 0xf4, 0xf4, 0xf7, 0xf4, 0xc2, 0x27, 0xc2, 0xc3, 0x2c, 0x34, 0x2d, 0x2e, 0x35, 0x33, 0x33, 0x33, 0x35, 0x2e, 0x33, 0x2e, 0x35, 0x33, 0x2e, 0x35, 0x32, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x35, 0x45, 0x65, 0x67, 0x61, 0x5b, 0x78, 0xa4, 0xa5, 0x70, 0x2e, 0x3c, 0x36, 0x32, 0x37, 0x33, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x33, 0x36, 0x36, 0x33, 0x33, 0x3a, 0x35, 0x2f, 0x80, 0x97, 0x9b, 0x82, 0x61, 0x5f, 0x63, 0x50, 0x35, 0x35, 0x2e, 0x33, 0x33, 0x38, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x2f, 0x33, 0x2e, 0x34, 0x31, 0x2a, 0xc2, 0xc2, 0xc2, 0xc5, 0xe6, 0xf5, 0xf2, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe6, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf1, 0xe6, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe6, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe6, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe6, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe6, 0xf1, 0xf2, 0xf0, 0xf6, 0xf4, 0x22, 0xc2, 0xc2, 0xc2, 0x25, 0x31, 0x2d, 0x33, 0x2e, 0x35, 0x2e, 0x37, 0x32, 0x33, 0x35, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x35, 0x35, 0x36, 0x2e, 0x32, 0x35, 0x35, 0x45, 0x6c, 0x5f, 0x63, 0x5c, 0x70, 0xa5, 0x9e, 0x3c, 0x2e, 0x3a, 0x33, 0x37, 0x34, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x36, 0x36, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x35, 0x36, 0x36, 0x38, 0x33, 0x33, 0x35, 0x35, 0x45, 0x9e, 0x91, 0x7b, 0x5c, 0x61, 0x65, 0x53, 0x39, 0x35, 0x33, 0x32, 0x33, 0x35, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x32, 0x32, 0x33, 0x35, 0x35, 0x2e, 0x36, 0x31, 0x2c, 0xc3, 0xc2, 0xc2, 0xdd, 0xf1, 0xe6, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xe5, 0xf1, 0xf2, 0xf2, 0xf3, 0xf4, 0xf5, 0xf8, 0xcb, 0xc2, 0xc3, 0x26, 0x31, 0x2d, 0x32, 0x35, 0x32, 0x36, 0x32, 0x31, 0x32, 0x33, 0x35, 0x32, 0x35, 0x32, 0x35, 0x32, 0x35, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x36, 0x2e, 0x4a, 0x6c, 0x5f, 0x61, 0x5b, 0x67, 0xa4, 0x70, 0x35, 0x35, 0x33, 0x33, 0x37, 0x33, 0x36, 0x38, 0x36, 0x38, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x33, 0x33, 0x36, 0x2e, 0x33, 0x35, 0x2f, 0x75, 0xa0, 0x76, 0x5b, 0x5f, 0x63, 0x5a, 0x3f, 0x35, 0x2e, 0x33, 0x33, 0x36, 0x36, 0x35, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x32, 0x32, 0x33, 0x32, 0x2e, 0x36, 0x30, 0x37, 0x2c, 0x27, 0xc2, 0xc2, 0xde, 0xf8, 0xf0, 0xf5, 0xf0, 0xe6, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf1, 0xf0, 0xf5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xe3, 0xfb, 0xc5, 0xc2, 0xc3, 0x27, 0x2d, 0x32, 0x35, 0x35, 0x33, 0x33, 0x33, 0x32, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x36, 0x33, 0x32, 0x35, 0x39, 0x51, 0x65, 0x63, 0x61, 0x61, 0x63, 0x83, 0x44, 0x2e, 0x3a, 0x37, 0x35, 0x32, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x2e, 0x3b, 0x2e, 0x2e, 0x2e, 0x2e, 0x36, 0x36, 0x3b, 0x2e, 0x3b, 0x2d, 0x3b, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x29, 0x3b, 0x3b, 0x36, 0x33, 0x36, 0x37, 0x33, 0x36, 0x3a, 0x2d, 0x3b, 0x2e, 0x41, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x38, 0x2e, 0x38, 0x35, 0x36, 0x35, 0x2e, 0x46, 0x97, 0x6d, 0x5b, 0x5b, 0x5f, 0x5a, 0x44, 0x2f, 0x33, 0x32, 0x33, 0x36, 0x36, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x34, 0x33, 0x36, 0x35, 0x37, 0x2f, 0x34, 0x31, 0x25, 0xc2, 0xc2, 0xcf, 0xfa, 0xe3, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf1, 0xf0, 0xf0, 0xf2, 0xf4, 0xf2, 0xf4, 0xf1, 0xf1, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf1, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf4, 0xe3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf1, 0xf2, 0xf1, 0xf7, 0xfa, 0xdf, 0xc2, 0xc2, 0x25, 0x32, 0x32, 0x32, 0x35, 0x33, 0x36, 0x36, 0x36, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x35, 0x32, 0x35, 0x33, 0x35, 0x2e, 0x39, 0x5a, 0x67, 0x63, 0x5b, 0x5f, 0x67, 0x65, 0x35, 0x35, 0x32, 0x2f, 0x32, 0x33, 0x36, 0x38, 0x35, 0x36, 0x35, 0x36, 0x36, 0x3d, 0x29, 0x37, 0x33, 0x33, 0x30, 0x28, 0x28, 0x2b, 0x37, 0x2d, 0x37, 0x33, 0x2d, 0x33, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x44, 0x2d, 0x2f, 0x33, 0x2e, 0x3b, 0x30, 0x33, 0x2b, 0x2d, 0x36, 0x2d, 0x36, 0x32, 0x32, 0x41, 0x36, 0x36, 0x36, 0x36, 0x38, 0x36, 0x35, 0x33, 0x35, 0x33, 0x3a, 0x35, 0x77, 0x70, 0x57, 0x5b, 0x5f, 0x5e, 0x4a, 0x2f, 0x33, 0x33, 0x37, 0x30, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x38, 0x36, 0x38, 0x36, 0x35, 0x35, 0x32, 0x2d, 0x27, 0xc2, 0xc2, 0xfe, 0xfa, 0xf0, 0xf1, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf0, 0xf4, 0xf1, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf0, 0xf4, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf0, 0xf1, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf1, 0xf0, 0xf7, 0x22, 0xec, 0xc2, 0xc2, 0x25, 0x31, 0x32, 0x2f, 0x35, 0x33, 0x36, 0x36, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x2e, 0x33, 0x35, 0x2f, 0x3f, 0x62, 0x63, 0x63, 0x61, 0x5f, 0x63, 0x4a, 0x33, 0x36, 0x35, 0x32, 0x32, 0x36, 0x36, 0x36, 0x35, 0x33, 0x36, 0x36, 0x37, 0x37, 0x3b, 0x28, 0x26, 0x2d, 0x6b, 0x89, 0x81, 0x42, 0x28, 0x2b, 0x36, 0x2d, 0x3b, 0x33, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x2e, 0x3b, 0x32, 0x41, 0x3b, 0x28, 0x26, 0x37, 0x52, 0x42, 0x28, 0x28, 0x2d, 0x2d, 0x41, 0x2d, 0x36, 0x36, 0x36, 0x36, 0x38, 0x33, 0x36, 0x35, 0x33, 0x35, 0x38, 0x2e, 0x47, 0x70, 0x57, 0x5f, 0x5b, 0x65, 0x4d, 0x2f, 0x33, 0x32, 0x33, 0x33, 0x37, 0x33, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x38, 0x33, 0x36, 0x35, 0x2f, 0x32, 0x31, 0x25, 0xc3, 0xc2, 0xef, 0xf8, 0xe3, 0xf4, 0xf1, 0xf1, 0xf4, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf6, 0xee, 0xc6, 0xc2, 0x27, 0x2b, 0x32, 0x32, 0x35, 0x33, 0x33, 0x36, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x32, 0x35, 0x35, 0x2f, 0x4a, 0x65, 0x63, 0x5f, 0x61, 0x5b, 0x6c, 0x3f, 0x35, 0x35, 0x32, 0x32, 0x35, 0x36, 0x38, 0x35, 0x36, 0x35, 0x36, 0x33, 0x37, 0x30, 0x25, 0x52, 0xab, 0xbd, 0x24, 0xfd, 0xfd, 0x24, 0xab, 0x3e, 0x2c, 0x2d, 0x38, 0x37, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x33, 0x41, 0x29, 0x41, 0x29, 0x2b, 0x7c, 0xb5, 0xbf, 0xc1, 0xc1, 0xba, 0xab, 0x60, 0x25, 0x42, 0x33, 0x36, 0x36, 0x36, 0x35, 0x33, 0x38, 0x33, 0x35, 0x33, 0x35, 0x38, 0x35, 0x3c, 0x5e, 0x5f, 0x5b, 0x5f, 0x65, 0x5a, 0x3f, 0x2f, 0x35, 0x33, 0x34, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x36, 0x33, 0x38, 0x33, 0x35, 0x2e, 0x32, 0x31, 0xc3, 0xc2, 0xcb, 0xfc, 0xf5, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf4, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf4, 0xf2, 0xf4, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf4, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf4, 0xf2, 0xf4, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf4, 0xf2, 0xf4, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf1, 0xf2, 0xf1, 0x22, 0xf2, 0xdd, 0xc2, 0x25, 0x31, 0x32, 0x2e, 0x2e, 0x36, 0x36, 0x36, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x35, 0x35, 0x35, 0x39, 0x53, 0x65, 0x5f, 0x61, 0x63, 0x5f, 0x65, 0x3f, 0x3a, 0x33, 0x35, 0x32, 0x32, 0x36, 0x36, 0x36, 0x35, 0x36, 0x36, 0x36, 0x36, 0x28, 0x81, 0xba, 0x24, 0xbc, 0xb4, 0xac, 0xac, 0xb2, 0xb8, 0x94, 0x33, 0x42, 0x2b, 0x33, 0x37, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x34, 0x2e, 0x37, 0x2d, 0xaa, 0xba, 0xb4, 0xae, 0xad, 0xb2, 0xb5, 0xbf, 0xbf, 0x94, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x35, 0x36, 0x35, 0x33, 0x33, 0x3a, 0x33, 0x3c, 0x50, 0x5f, 0x5b, 0x5f, 0x5e, 0x65, 0x4a, 0x2f, 0x35, 0x33, 0x35, 0x32, 0x36, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x2e, 0x2e, 0x32, 0x2c, 0x25, 0xc2, 0xdf, 0xfb, 0xf5, 0xf5, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf4, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf4, 0xf1, 0xf4, 0xe3, 0xf1, 0xf7, 0xff, 0xec, 0xc2, 0xc3, 0x2a, 0x2d, 0x37, 0x2e, 0x33, 0x36, 0x33, 0x36, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x2f, 0x39, 0x39, 0x65, 0x65, 0x61, 0x5f, 0x66, 0x63, 0x5e, 0x39, 0x36, 0x2e, 0x32, 0x32, 0x35, 0x36, 0x36, 0x35, 0x35, 0x36, 0x36, 0x36, 0x26, 0x79, 0xeb, 0xb8, 0x89, 0x38, 0x27, 0xc3, 0x25, 0xc3, 0x25, 0x42, 0x30, 0x2d, 0x36, 0x37, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x3b, 0x30, 0x3b, 0x60, 0x44, 0x25, 0x26, 0xc3, 0xc3, 0x30, 0x6b, 0xac, 0xbf, 0xa2, 0xc3, 0x33, 0x3a, 0x36, 0x36, 0x35, 0x38, 0x35, 0x33, 0x35, 0x33, 0x38, 0x36, 0x39, 0x4a, 0x65, 0x5b, 0x57, 0x5f, 0x65, 0x53, 0x39, 0x2f, 0x35, 0x2d, 0x35, 0x33, 0x35, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x32, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x32, 0x2d, 0x34, 0xc2, 0x00, 0xfe, 0xff, 0xe3, 0xf5, 0xf0, 0xf2, 0xf1, 0xf2, 0xf4, 0xe5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf0, 0xf4, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf1, 0xf1, 0xf1, 0xf5, 0xf5, 0xee, 0xc9, 0xc2, 0x31, 0x32, 0x2d, 0x36, 0x33, 0x33, 0x36, 0x35, 0x36, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x2e, 0x35, 0x35, 0x35, 0x4e, 0x67, 0x63, 0x5f, 0x61, 0x5f, 0x65, 0x53, 0x35, 0x33, 0x2d, 0x32, 0x32, 0x2e, 0x36, 0x33, 0x35, 0x33, 0x35, 0x36, 0x30, 0x42, 0xb4, 0xa7, 0x30, 0x2a, 0x30, 0x38, 0x33, 0x37, 0x36, 0x2e, 0x33, 0x2e, 0x35, 0x32, 0x35, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x37, 0x37, 0x37, 0x30, 0x2b, 0x2d, 0x30, 0x33, 0x33, 0x33, 0x30, 0x2c, 0x30, 0x79, 0xb8, 0x55, 0x2b, 0x33, 0x33, 0x33, 0x3a, 0x36, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x3c, 0x43, 0x6c, 0x5b, 0x57, 0x5f, 0x63, 0x5e, 0x4a, 0x2f, 0x35, 0x35, 0x32, 0x36, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x32, 0x33, 0x33, 0x33, 0x33, 0x29, 0x34, 0x2a, 0xc2, 0x01, 0xef, 0xf7, 0xe3, 0xf7, 0xf0, 0xf1, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf1, 0xf2, 0xf0, 0xf5, 0xf1, 0xf5, 0xff, 0xde, 0xc2, 0x25, 0x32, 0x2d, 0x2e, 0x33, 0x33, 0x36, 0x36, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x39, 0x35, 0x39, 0x65, 0x63, 0x61, 0x66, 0x63, 0x5b, 0x6c, 0x4a, 0x2e, 0x33, 0x37, 0x32, 0x32, 0x33, 0x35, 0x38, 0x36, 0x35, 0x33, 0x33, 0x2d, 0x6f, 0x79, 0x26, 0x30, 0x38, 0x34, 0x36, 0x32, 0x36, 0x32, 0x36, 0x32, 0x35, 0x32, 0x35, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x37, 0x37, 0x33, 0x30, 0x33, 0x36, 0x34, 0x36, 0x34, 0x36, 0x37, 0x30, 0x28, 0x60, 0x89, 0x36, 0x33, 0x33, 0x35, 0x33, 0x3a, 0x33, 0x35, 0x33, 0x33, 0x38, 0x33, 0x3c, 0x40, 0x65, 0x63, 0x5b, 0x5b, 0x5f, 0x63, 0x5a, 0x40, 0x2f, 0x39, 0x2e, 0x33, 0x35, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x32, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x3d, 0x2b, 0x2c, 0xc2, 0xcf, 0xfb, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf1, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf4, 0xf4, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf0, 0xf5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf4, 0xf4, 0xf0, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xe5, 0xf4, 0xf4, 0xf4, 0xf0, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf1, 0xf0, 0xf5, 0xf1, 0xe3, 0xff, 0xed, 0xc2, 0xc3, 0x34, 0x37, 0x33, 0x33, 0x33, 0x36, 0x35, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x36, 0x2e, 0x35, 0x2e, 0x39, 0x53, 0x5f, 0x5f, 0x61, 0x63, 0x61, 0x66, 0x6c, 0x40, 0x2e, 0x36, 0x34, 0x32, 0x32, 0x35, 0x33, 0x36, 0x35, 0x33, 0x35, 0x33, 0x35, 0x2b, 0x2b, 0x33, 0x37, 0x30, 0x37, 0x35, 0x35, 0x32, 0x35, 0x37, 0x36, 0x37, 0x36, 0x34, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x37, 0x36, 0x37, 0x37, 0x33, 0x37, 0x33, 0x37, 0x36, 0x37, 0x37, 0x30, 0x37, 0x36, 0x29, 0x41, 0x3b, 0x33, 0x3a, 0x2e, 0x33, 0x35, 0x35, 0x33, 0x35, 0x30, 0x36, 0x38, 0x35, 0x39, 0x5e, 0x66, 0x61, 0x5b, 0x5f, 0x5f, 0x5e, 0x53, 0x2f, 0x2f, 0x2f, 0x33, 0x36, 0x33, 0x35, 0x33, 0x36, 0x33, 0x36, 0x36, 0x33, 0x2e, 0x32, 0x33, 0x30, 0x2e, 0x32, 0x32, 0x2b, 0xc3, 0xc2, 0xee, 0xf7, 0xf1, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf6, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf6, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf1, 0xf2, 0xf1, 0xf7, 0xf1, 0xf1, 0xf5, 0xf8, 0xc5, 0xc2, 0x2d, 0x29, 0x36, 0x33, 0x33, 0x33, 0x35, 0x36, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x35, 0x45, 0x65, 0x59, 0x61, 0x66, 0x61, 0x61, 0x70, 0x6c, 0x2f, 0x35, 0x33, 0x34, 0x2e, 0x32, 0x36, 0x2e, 0x38, 0x33, 0x35, 0x33, 0x33, 0x33, 0x3b, 0x3b, 0x2d, 0x36, 0x37, 0x35, 0x32, 0x36, 0x33, 0x33, 0x37, 0x37, 0x38, 0x37, 0x36, 0x37, 0x33, 0x37, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x33, 0x37, 0x36, 0x37, 0x36, 0x37, 0x37, 0x36, 0x37, 0x36, 0x32, 0x37, 0x37, 0x2e, 0x36, 0x33, 0x2d, 0x33, 0x36, 0x33, 0x36, 0x38, 0x35, 0x35, 0x33, 0x33, 0x36, 0x38, 0x35, 0x39, 0x5a, 0x6d, 0x5b, 0x5b, 0x61, 0x5f, 0x5e, 0x62, 0x4a, 0x39, 0x32, 0x36, 0x33, 0x33, 0x33, 0x35, 0x36, 0x35, 0x36, 0x33, 0x35, 0x32, 0x2e, 0x34, 0x33, 0x33, 0x3b, 0x29, 0x2d, 0xc2, 0x7a, 0xfa, 0xf0, 0xf1, 0xf5, 0xf1, 0xf1, 0xf0, 0xf1, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf4, 0xf5, 0xf0, 0xf5, 0xf6, 0xfb, 0xb1, 0x25, 0x2b, 0x41, 0x35, 0x33, 0x35, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x5a, 0x65, 0x66, 0x5f, 0x66, 0x61, 0x61, 0x7b, 0x65, 0x2f, 0x35, 0x36, 0x34, 0x32, 0x32, 0x35, 0x36, 0x36, 0x36, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x36, 0x3b, 0x33, 0x36, 0x36, 0x33, 0x37, 0x36, 0x37, 0x38, 0x34, 0x38, 0x31, 0x38, 0x36, 0x35, 0x36, 0x33, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x35, 0x37, 0x33, 0x36, 0x33, 0x36, 0x37, 0x36, 0x36, 0x37, 0x33, 0x37, 0x37, 0x36, 0x37, 0x35, 0x36, 0x35, 0x35, 0x41, 0x2d, 0x35, 0x41, 0x32, 0x41, 0x36, 0x37, 0x33, 0x33, 0x36, 0x35, 0x33, 0x33, 0x33, 0x33, 0x38, 0x33, 0x35, 0x35, 0x53, 0x70, 0x5b, 0x5b, 0x63, 0x5b, 0x5b, 0x5f, 0x65, 0x4a, 0x39, 0x33, 0x2f, 0x36, 0x33, 0x34, 0x2e, 0x32, 0x33, 0x37, 0x32, 0x32, 0x32, 0x2e, 0x33, 0x33, 0x2d, 0x3d, 0xc3, 0x27, 0xe1, 0xf8, 0xf5, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf6, 0xf2, 0xf6, 0x22, 0xe6, 0x79, 0x26, 0x36, 0x3f, 0x39, 0x33, 0x33, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x38, 0x36, 0x38, 0x36, 0x35, 0x35, 0x3c, 0x46, 0x59, 0x5f, 0x5f, 0x66, 0x57, 0x63, 0x5c, 0x6d, 0x7b, 0x62, 0x2f, 0x36, 0x33, 0x33, 0x33, 0x2f, 0x36, 0x2e, 0x38, 0x33, 0x33, 0x36, 0x33, 0x35, 0x2e, 0x33, 0x33, 0x38, 0x38, 0x37, 0x36, 0x37, 0x38, 0x37, 0x38, 0x36, 0x33, 0x37, 0x38, 0x33, 0x35, 0x35, 0x36, 0x37, 0x36, 0x38, 0x33, 0x36, 0x32, 0x37, 0x33, 0x37, 0x33, 0x37, 0x33, 0x37, 0x33, 0x37, 0x33, 0x37, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x35, 0x36, 0x35, 0x37, 0x36, 0x34, 0x36, 0x37, 0x33, 0x37, 0x37, 0x32, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x35, 0x33, 0x35, 0x37, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x32, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x36, 0x33, 0x3a, 0x35, 0x4e, 0x6e, 0x61, 0x5b, 0x54, 0x61, 0x5b, 0x5b, 0x63, 0x5e, 0x4d, 0x3f, 0x35, 0x2e, 0x32, 0x3b, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x36, 0x35, 0x2e, 0x41, 0x2b, 0xc3, 0x84, 0xf9, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf6, 0xf1, 0xc0, 0xee, 0x25, 0x3c, 0x3f, 0x46, 0x3c, 0x35, 0x33, 0x2e, 0x32, 0x2e, 0x2e, 0x33, 0x35, 0x3a, 0x2f, 0x35, 0x43, 0x4a, 0x59, 0x67, 0x5f, 0x5b, 0x5b, 0x61, 0x63, 0x66, 0x76, 0x7b, 0x5a, 0x35, 0x33, 0x36, 0x33, 0x33, 0x32, 0x35, 0x32, 0x36, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x2e, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x35, 0x33, 0x35, 0x36, 0x35, 0x36, 0x36, 0x38, 0x37, 0x33, 0x36, 0x35, 0x32, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x35, 0x36, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x37, 0x33, 0x36, 0x33, 0x36, 0x36, 0x33, 0x36, 0x36, 0x3a, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x32, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x35, 0x4a, 0x66, 0x70, 0x54, 0x57, 0x5f, 0x61, 0x5b, 0x5b, 0x63, 0x65, 0x5e, 0x4a, 0x39, 0x2e, 0x35, 0x32, 0x35, 0x2e, 0x2f, 0x35, 0x35, 0x35, 0x2f, 0x35, 0x40, 0x3c, 0x2b, 0x31, 0xee, 0xf8, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xe6, 0x24, 0x99, 0x2b, 0x3f, 0x45, 0x4a, 0x4a, 0x39, 0x39, 0x2f, 0x35, 0x2f, 0x35, 0x35, 0x39, 0x40, 0x4a, 0x53, 0x5e, 0x5c, 0x5b, 0x5b, 0x5b, 0x5f, 0x63, 0x57, 0x70, 0x7b, 0x7b, 0x5a, 0x2f, 0x2e, 0x38, 0x2e, 0x36, 0x2f, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x2e, 0x36, 0x2f, 0x33, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x35, 0x35, 0x35, 0x3b, 0x2f, 0x35, 0x35, 0x36, 0x33, 0x36, 0x37, 0x36, 0x36, 0x37, 0x33, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x38, 0x33, 0x38, 0x36, 0x36, 0x36, 0x32, 0x36, 0x32, 0x36, 0x33, 0x2e, 0x36, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x38, 0x36, 0x33, 0x37, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x36, 0x33, 0x33, 0x33, 0x38, 0x33, 0x36, 0x35, 0x4a, 0x61, 0x7f, 0x75, 0x50, 0x54, 0x61, 0x61, 0x5b, 0x5b, 0x5e, 0x65, 0x5e, 0x53, 0x45, 0x39, 0x2f, 0x2f, 0x2f, 0x2f, 0x35, 0x39, 0x2f, 0x40, 0x45, 0x4e, 0x45, 0x29, 0xaa, 0xff, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf6, 0xf2, 0xf6, 0xf2, 0xf6, 0xf7, 0xbb, 0x52, 0x44, 0x45, 0x4e, 0x50, 0x5a, 0x53, 0x45, 0x45, 0x45, 0x4a, 0x4b, 0x4e, 0x53, 0x59, 0x5e, 0x57, 0x64, 0x5c, 0x61, 0x5b, 0x66, 0x57, 0x63, 0x7b, 0x76, 0x76, 0x5a, 0x2f, 0x33, 0x36, 0x33, 0x33, 0x32, 0x35, 0x32, 0x36, 0x33, 0x38, 0x33, 0x35, 0x36, 0x2e, 0x35, 0x33, 0x36, 0x36, 0x33, 0x30, 0x2d, 0x2d, 0x2d, 0x2e, 0x32, 0x35, 0x32, 0x35, 0x32, 0x36, 0x36, 0x36, 0x38, 0x37, 0x33, 0x36, 0x36, 0x36, 0x33, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x37, 0x35, 0x34, 0x35, 0x33, 0x33, 0x33, 0x2d, 0x2d, 0x2b, 0x2c, 0x2b, 0x2c, 0x30, 0x30, 0x33, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x35, 0x33, 0x33, 0x33, 0x38, 0x2e, 0x3a, 0x2e, 0x47, 0x4f, 0x7f, 0xad, 0x5e, 0x53, 0x57, 0x5b, 0x61, 0x5b, 0x54, 0x57, 0x5f, 0x65, 0x5e, 0x53, 0x47, 0x45, 0x43, 0x40, 0x43, 0x40, 0x4b, 0x54, 0x50, 0x4e, 0x39, 0x60, 0xbb, 0xf8, 0xf3, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf6, 0xf6, 0xf0, 0xf1, 0xbe, 0xb7, 0x29, 0x4a, 0x4a, 0x54, 0x50, 0x54, 0x5e, 0x53, 0x54, 0x5e, 0x5e, 0x57, 0x5e, 0x5f, 0x57, 0x61, 0x5c, 0x5b, 0x5b, 0x5f, 0x5a, 0x4e, 0x83, 0x88, 0x76, 0x7b, 0x5a, 0x2f, 0x33, 0x36, 0x2e, 0x35, 0x35, 0x2e, 0x33, 0x33, 0x36, 0x35, 0x33, 0x36, 0x2e, 0x36, 0x36, 0x2e, 0x37, 0x2e, 0x26, 0x31, 0x49, 0x52, 0x4c, 0x49, 0x2b, 0x29, 0x32, 0x37, 0x37, 0x33, 0x34, 0x36, 0x37, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x37, 0x38, 0x38, 0x38, 0x36, 0x37, 0x35, 0x37, 0x33, 0x33, 0x36, 0x30, 0x33, 0x2d, 0x28, 0x31, 0x49, 0x68, 0x6b, 0x68, 0x52, 0x3e, 0x28, 0x28, 0x30, 0x38, 0x2d, 0x30, 0x37, 0x38, 0x30, 0x36, 0x2e, 0x36, 0x33, 0x33, 0x38, 0x36, 0x33, 0x35, 0x2f, 0x45, 0x54, 0x65, 0xba, 0xad, 0x4d, 0x5a, 0x61, 0x5b, 0x5b, 0x5b, 0x5b, 0x61, 0x5b, 0x61, 0x5e, 0x63, 0x5e, 0x59, 0x5e, 0x59, 0x5f, 0x5b, 0x54, 0x50, 0x4a, 0x40, 0xb3, 0xbf, 0xf4, 0xf3, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe3, 0xf7, 0x22, 0x24, 0xa2, 0x41, 0x4a, 0x50, 0x5b, 0x5b, 0x54, 0x57, 0x5e, 0x5b, 0x57, 0x5f, 0x5b, 0x5b, 0x5f, 0x57, 0x61, 0x5c, 0x54, 0x6c, 0x3f, 0x80, 0xb4, 0x76, 0x76, 0x78, 0x53, 0x35, 0x35, 0x38, 0x33, 0x37, 0x2f, 0x32, 0x2e, 0x33, 0x2d, 0x30, 0x36, 0x37, 0x34, 0x26, 0x2d, 0x2b, 0x25, 0x2d, 0x9d, 0xb1, 0xbd, 0xc1, 0xc1, 0xb8, 0xb0, 0x79, 0x25, 0x25, 0x34, 0x3e, 0x33, 0x34, 0x30, 0x3b, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x38, 0x38, 0x33, 0x38, 0x35, 0x3b, 0x2d, 0x33, 0x37, 0x33, 0x30, 0xc3, 0x2c, 0x94, 0xb3, 0xb9, 0xfb, 0xfd, 0xfd, 0xbe, 0xb6, 0xaa, 0x79, 0xc3, 0x25, 0x2a, 0xaa, 0x99, 0x26, 0x30, 0x33, 0x33, 0x3b, 0x33, 0x33, 0x36, 0x36, 0x33, 0x35, 0x35, 0x4a, 0x4f, 0x65, 0xb4, 0xc1, 0xab, 0x4d, 0x4e, 0x63, 0x57, 0x5f, 0x5b, 0x57, 0x5b, 0x63, 0x66, 0x5b, 0x5b, 0x5e, 0x59, 0x57, 0x5c, 0x5f, 0x4b, 0x50, 0x2f, 0xa7, 0xc0, 0xbb, 0xf5, 0xf3, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf7, 0xe3, 0xf7, 0xef, 0x22, 0x24, 0x99, 0x3c, 0x51, 0x54, 0x50, 0x5b, 0x57, 0x5b, 0x57, 0x5b, 0x5b, 0x5b, 0x57, 0x5b, 0x66, 0x57, 0x5e, 0x62, 0x3f, 0x89, 0xbf, 0xb7, 0x73, 0x76, 0x7b, 0x5a, 0x2f, 0x33, 0x36, 0x33, 0x3b, 0x2e, 0x35, 0x2d, 0x36, 0x37, 0x42, 0x2b, 0x30, 0x2c, 0xac, 0x4c, 0x2a, 0xaa, 0x24, 0xfd, 0x22, 0xb1, 0xaa, 0x13, 0xec, 0xb6, 0xfd, 0xbb, 0x7a, 0x2a, 0x30, 0x31, 0x37, 0x36, 0x37, 0x3a, 0x33, 0x3a, 0x38, 0x3a, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x37, 0x38, 0x38, 0x36, 0x35, 0x37, 0x2e, 0x3b, 0x37, 0x30, 0x2c, 0x2a, 0xa8, 0x24, 0xc7, 0xb1, 0xa8, 0x84, 0xdd, 0xde, 0x13, 0xb4, 0xfb, 0xfd, 0xb8, 0x84, 0x3e, 0xa2, 0xb2, 0x2a, 0x31, 0x52, 0x3b, 0x2e, 0x33, 0x36, 0x30, 0x3a, 0x2e, 0x3a, 0x2e, 0x4a, 0x54, 0x62, 0xb4, 0xbc, 0x24, 0xb2, 0x69, 0x4a, 0x5e, 0x5f, 0x5f, 0x61, 0x5b, 0x5b, 0x57, 0x57, 0x5b, 0x5b, 0x57, 0x57, 0x54, 0x4b, 0x65, 0x2f, 0x92, 0xc0, 0xbb, 0xbb, 0xf4, 0xf4, 0xf4, 0xe5, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xef, 0xe5, 0xf6, 0xf6, 0xe6, 0xbe, 0x89, 0x3f, 0x51, 0x63, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x54, 0x5b, 0x5f, 0x5f, 0x5f, 0x65, 0x4a, 0x49, 0xa7, 0xc0, 0xbf, 0xb7, 0x73, 0x7b, 0x76, 0x50, 0x35, 0x35, 0x38, 0x36, 0x37, 0x2f, 0x32, 0x2e, 0x36, 0x25, 0x99, 0x99, 0xc2, 0x2c, 0xfe, 0x89, 0xef, 0xeb, 0xb6, 0xde, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0x01, 0xfe, 0xc0, 0xaa, 0xc3, 0x34, 0x34, 0x42, 0x2d, 0x35, 0x36, 0x38, 0x35, 0x38, 0x33, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x38, 0x33, 0x36, 0x36, 0x35, 0x2d, 0x37, 0x42, 0x2a, 0x3e, 0xb3, 0xc7, 0x13, 0xc4, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc4, 0xcf, 0xfd, 0xfd, 0x94, 0xc4, 0x9d, 0xc2, 0xae, 0xa2, 0x29, 0x36, 0x33, 0x30, 0x33, 0x36, 0x33, 0x35, 0x35, 0x47, 0x54, 0x4a, 0xb7, 0x22, 0xf1, 0xbf, 0xb5, 0x69, 0x45, 0x5a, 0x5e, 0x5f, 0x5f, 0x4f, 0x66, 0x5b, 0x5b, 0x5f, 0x5f, 0x57, 0x59, 0x65, 0x2e, 0x99, 0xbb, 0xbe, 0xe3, 0xf7, 0xef, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xe3, 0xf8, 0xe5, 0xe3, 0xe4, 0xf7, 0xbb, 0xc1, 0xa7, 0x48, 0x43, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x66, 0x5f, 0x57, 0x57, 0x47, 0x3f, 0x81, 0xb5, 0xc7, 0xe3, 0xbb, 0xbb, 0x80, 0x76, 0x76, 0x5a, 0x2f, 0x33, 0x36, 0x33, 0x3b, 0x2e, 0x35, 0x2d, 0x36, 0x26, 0x60, 0xbe, 0xdf, 0x3e, 0xb1, 0xeb, 0xef, 0xde, 0xc2, 0xc2, 0xc2, 0xc6, 0xc5, 0xde, 0xde, 0xdd, 0xc9, 0xc2, 0xc4, 0xb9, 0xaa, 0x2c, 0x30, 0x37, 0x36, 0x36, 0x35, 0x3a, 0x38, 0x3a, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x38, 0x35, 0x36, 0x35, 0x33, 0x3a, 0x26, 0x38, 0xb8, 0xed, 0xc9, 0xc2, 0xcb, 0xde, 0xe0, 0xcf, 0xde, 0x01, 0xc2, 0xc2, 0xc2, 0xc2, 0xc9, 0xb1, 0xfd, 0xed, 0x4c, 0xb0, 0xc1, 0x3e, 0x2d, 0x3b, 0x2e, 0x33, 0x36, 0x38, 0x33, 0x35, 0x35, 0x45, 0x54, 0x62, 0xb5, 0xf7, 0xf2, 0xf3, 0xc1, 0xbc, 0xab, 0x51, 0x4a, 0x4b, 0x65, 0x5b, 0x57, 0x5b, 0x5b, 0x57, 0x57, 0x54, 0x47, 0x40, 0xa9, 0x24, 0x22, 0xf2, 0xe4, 0xe3, 0xf7, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe6, 0xe3, 0xe8, 0xe3, 0xe4, 0xf1, 0xbd, 0xbf, 0xb2, 0x77, 0x4f, 0x4b, 0x4b, 0x50, 0x4b, 0x50, 0x50, 0x47, 0x53, 0x7c, 0xb2, 0xbc, 0xbe, 0xf1, 0xf1, 0xf1, 0xbf, 0x9e, 0x70, 0x78, 0x53, 0x2f, 0x35, 0x36, 0x37, 0x36, 0x32, 0x2e, 0x33, 0x33, 0x3d, 0x25, 0x94, 0xc1, 0xe3, 0xfd, 0xd5, 0xc6, 0xc2, 0xc2, 0xdd, 0xec, 0xe8, 0xc7, 0xfd, 0xfd, 0xeb, 0xbe, 0xfe, 0xc9, 0xc2, 0xb8, 0x94, 0x2b, 0x2d, 0x37, 0x35, 0x36, 0x38, 0x36, 0x38, 0x33, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x35, 0x35, 0x33, 0x3e, 0x2c, 0xac, 0xfe, 0xc2, 0xcc, 0xd5, 0xfa, 0xfd, 0xfd, 0xfd, 0xfd, 0xea, 0xe1, 0xde, 0xc2, 0xc2, 0xc2, 0xc2, 0xec, 0xfd, 0xbe, 0xff, 0x71, 0x30, 0x3b, 0x33, 0x33, 0x3a, 0x33, 0x36, 0x35, 0x35, 0x35, 0x45, 0x4b, 0x62, 0xb9, 0xf7, 0xe4, 0xf3, 0xbb, 0xbc, 0xc1, 0xb7, 0xa2, 0x65, 0x4a, 0x47, 0x4b, 0x4b, 0x4b, 0x4b, 0x4a, 0x4a, 0x7c, 0xb4, 0xc1, 0xbb, 0xf6, 0xe4, 0xe4, 0xf0, 0xe6, 0xb9, 0xe6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xe5, 0xe6, 0xf1, 0xe6, 0xf5, 0xff, 0xc0, 0xb5, 0xa7, 0x92, 0x81, 0x81, 0x8e, 0xa2, 0xac, 0xb8, 0xbf, 0xbe, 0x22, 0xf1, 0xf0, 0xf0, 0xf1, 0xc0, 0xa9, 0x70, 0x76, 0x4e, 0x2f, 0x35, 0x35, 0x2e, 0x36, 0x2d, 0x37, 0x36, 0x30, 0x2a, 0x2a, 0xc2, 0xaa, 0xeb, 0xe0, 0xc2, 0xc2, 0xc4, 0xb0, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc7, 0xfd, 0xfd, 0xeb, 0xa8, 0xcb, 0xed, 0x4c, 0x30, 0x33, 0x35, 0x35, 0x35, 0x38, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x33, 0x3b, 0x36, 0x3b, 0x35, 0x36, 0x36, 0x28, 0x7a, 0xb6, 0xc2, 0xdf, 0xeb, 0xfd, 0xfd, 0xfd, 0xfd, 0xeb, 0xeb, 0xeb, 0xfd, 0xeb, 0xfe, 0xc9, 0xc2, 0xc2, 0xc2, 0x13, 0xfd, 0xa8, 0xc2, 0x37, 0x3b, 0x35, 0x36, 0x36, 0x33, 0x3a, 0x33, 0x35, 0x2f, 0x43, 0x4e, 0x75, 0xbb, 0xf7, 0xe4, 0xf3, 0xf3, 0xf5, 0xf1, 0xbd, 0xc1, 0xbc, 0xb3, 0xa7, 0x9d, 0x92, 0x94, 0x94, 0xab, 0xb5, 0xfb, 0xbe, 0xf1, 0xe6, 0xe6, 0xf2, 0xf1, 0xe6, 0xf1, 0xe6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xe6, 0xe6, 0xf5, 0xbd, 0xc1, 0xc0, 0xbd, 0xbe, 0xbd, 0xc0, 0xbf, 0x22, 0xbb, 0xf6, 0xe6, 0xf1, 0xf0, 0xf0, 0xe3, 0xc0, 0xb2, 0x75, 0x76, 0x51, 0x2f, 0x2f, 0x35, 0x2e, 0x32, 0x36, 0x33, 0x2d, 0x49, 0x52, 0x3d, 0x7a, 0xb0, 0x71, 0xc8, 0xc8, 0xcd, 0xe1, 0xfd, 0xfd, 0xc7, 0xfd, 0xc7, 0xfd, 0xfb, 0xeb, 0xeb, 0xfd, 0xe6, 0xec, 0xdd, 0xe1, 0x9d, 0x2a, 0x38, 0x35, 0x35, 0x36, 0x36, 0x38, 0x32, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x37, 0x37, 0x36, 0x3a, 0x3a, 0x34, 0x31, 0xfe, 0xc5, 0xce, 0xfd, 0xeb, 0xfd, 0xeb, 0xeb, 0xeb, 0xfc, 0xeb, 0xeb, 0xeb, 0xea, 0xe4, 0xd5, 0xc8, 0xc9, 0xc2, 0xc2, 0xec, 0xc1, 0x89, 0x2b, 0x35, 0x33, 0x35, 0x36, 0x3a, 0x37, 0x35, 0x36, 0x2f, 0x45, 0x4b, 0x81, 0xbe, 0xe6, 0xe4, 0xf3, 0xf2, 0xf5, 0xf1, 0xf1, 0xf0, 0xff, 0xbd, 0xc0, 0xbd, 0xbe, 0xbe, 0xc0, 0xc0, 0x22, 0xf5, 0xe5, 0xe6, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xe6, 0xe6, 0xf5, 0xf1, 0xf0, 0xe6, 0x22, 0xb9, 0x22, 0x22, 0xf5, 0xf5, 0xf6, 0xe6, 0xf1, 0xf1, 0xf3, 0xf0, 0xf0, 0xbb, 0xb8, 0x80, 0x73, 0x4a, 0x35, 0x2e, 0x35, 0x35, 0x36, 0x37, 0x36, 0x2d, 0x3a, 0x13, 0xfe, 0xb5, 0x7a, 0xc2, 0xc8, 0xcc, 0xce, 0xc9, 0xdf, 0xf8, 0xfd, 0xeb, 0xeb, 0xeb, 0xfb, 0xfd, 0xfb, 0xfd, 0xeb, 0xdf, 0xc2, 0xcf, 0xbb, 0x3e, 0x2b, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x33, 0x37, 0x36, 0x3a, 0x36, 0x3a, 0x2c, 0x52, 0xd5, 0xc9, 0xfd, 0xeb, 0xeb, 0xfd, 0xfc, 0xeb, 0xfc, 0xfd, 0xeb, 0xfd, 0xea, 0xe1, 0xec, 0xd0, 0xd1, 0xc2, 0xc8, 0xc2, 0xc3, 0xb3, 0xc0, 0x60, 0x29, 0x36, 0x3b, 0x36, 0x33, 0x3b, 0x2e, 0x3b, 0x2f, 0x45, 0x4a, 0x92, 0x24, 0xe6, 0xf6, 0xf3, 0xf4, 0xf5, 0xf2, 0x22, 0xf3, 0xf0, 0xf4, 0x22, 0x22, 0xbb, 0xb9, 0xbb, 0xbb, 0x22, 0xf1, 0xe6, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf5, 0xf1, 0xf1, 0xf2, 0xe4, 0xe5, 0xf1, 0xe6, 0xf7, 0xe6, 0xe3, 0xe3, 0xe4, 0xf0, 0xe5, 0xf2, 0xf1, 0xf4, 0xf3, 0xf0, 0xf0, 0xbc, 0x9e, 0x6c, 0x44, 0x2e, 0x2f, 0x36, 0x35, 0x36, 0x2e, 0x41, 0x33, 0x2b, 0x2a, 0xe1, 0x9d, 0xc2, 0xc2, 0xcc, 0xd2, 0xca, 0xc8, 0xc2, 0x84, 0xfb, 0xfd, 0xc7, 0xfd, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xfd, 0xdd, 0xcb, 0x24, 0x71, 0x34, 0x33, 0x35, 0x36, 0x36, 0x38, 0x33, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x38, 0x37, 0x38, 0x36, 0x36, 0x2c, 0xa2, 0xcf, 0xb0, 0xeb, 0xeb, 0xfd, 0xea, 0xfd, 0xfd, 0xfd, 0xfa, 0xfd, 0xfe, 0xdd, 0xce, 0xd0, 0xcd, 0xd3, 0xd0, 0xc2, 0xc2, 0xc2, 0xc4, 0xbb, 0x79, 0x29, 0x3c, 0x42, 0x3a, 0x33, 0x36, 0x35, 0x35, 0x2e, 0x45, 0x45, 0xa9, 0xc7, 0xf1, 0xe5, 0xf6, 0xf4, 0xf5, 0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf0, 0xf1, 0xf8, 0xf7, 0xf0, 0xf3, 0xf1, 0xe6, 0xe6, 0xe6, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf0, 0xf0, 0xe4, 0xe4, 0xe5, 0xe5, 0xe3, 0xe6, 0xe4, 0xf6, 0xe4, 0xe4, 0xf2, 0xf4, 0xf0, 0xf4, 0xf3, 0xe4, 0xbb, 0xbd, 0xa9, 0x5d, 0x35, 0x33, 0x2e, 0x3b, 0x35, 0x35, 0x36, 0x3a, 0x33, 0x2b, 0x52, 0xb1, 0xc4, 0xc2, 0xc2, 0xd0, 0xd4, 0xca, 0xc8, 0xc2, 0xcb, 0xf8, 0xeb, 0xfd, 0xfd, 0xc7, 0xeb, 0xc7, 0xeb, 0xeb, 0xfd, 0xfc, 0xa8, 0xf7, 0xaa, 0x26, 0x37, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x2c, 0xb0, 0xec, 0xea, 0xeb, 0xea, 0xeb, 0xfd, 0xeb, 0xeb, 0xfb, 0xfd, 0xea, 0x01, 0xc8, 0xde, 0xca, 0xcd, 0xd9, 0xdb, 0xc8, 0xc2, 0xc3, 0xc2, 0xa8, 0x94, 0x2d, 0x36, 0x36, 0x3b, 0x3b, 0x36, 0x33, 0x3b, 0x2e, 0x45, 0x45, 0xab, 0xfb, 0xe6, 0xe4, 0xf4, 0xf4, 0xf5, 0xe6, 0xf2, 0xf3, 0xf4, 0xf3, 0xf0, 0xf1, 0xf1, 0xf0, 0xf0, 0xf4, 0xf2, 0xf4, 0xe6, 0xf5, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf1, 0xf4, 0xf1, 0xf5, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xe4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xe3, 0xc1, 0xac, 0x29, 0x2b, 0x33, 0x36, 0x3a, 0x35, 0x35, 0x35, 0x35, 0x36, 0x29, 0x84, 0x9d, 0xc2, 0xc2, 0xc8, 0xd7, 0xd7, 0xca, 0xc8, 0xcd, 0xec, 0xeb, 0xfa, 0xfd, 0xeb, 0xfd, 0xeb, 0xfd, 0xeb, 0xeb, 0xeb, 0xfd, 0xfd, 0xfc, 0xb3, 0x2a, 0x2d, 0x37, 0x2e, 0x3a, 0x36, 0x33, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x38, 0x36, 0x38, 0x30, 0x3e, 0xee, 0xfb, 0xfd, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xfd, 0xfd, 0xfc, 0xfd, 0xe0, 0xc2, 0xc9, 0xde, 0xd4, 0xd9, 0xd9, 0xd0, 0xc2, 0x00, 0xc2, 0x7a, 0xae, 0x2b, 0x3a, 0x36, 0x36, 0x3b, 0x36, 0x35, 0x33, 0x36, 0x3c, 0x49, 0xb0, 0xfb, 0xe6, 0xe5, 0xf2, 0xf4, 0xf5, 0xf1, 0xf2, 0xf2, 0xf6, 0xf2, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xbb, 0xf4, 0xbb, 0xf5, 0xf0, 0xf4, 0xbb, 0xf4, 0xf1, 0xf4, 0xf2, 0xf0, 0xf4, 0xf4, 0xf0, 0xf6, 0xf7, 0xef, 0x6b, 0xc3, 0x2b, 0x30, 0x36, 0x36, 0x35, 0x3c, 0x36, 0x35, 0x3a, 0x2b, 0x13, 0xdd, 0xc2, 0xc8, 0xcb, 0xda, 0xd6, 0xd0, 0xd8, 0xfd, 0xfd, 0xeb, 0xe9, 0xfd, 0xe9, 0xfd, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xfc, 0xb6, 0x3d, 0x2d, 0x32, 0x33, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x37, 0x38, 0x36, 0x38, 0x38, 0x33, 0x30, 0x4c, 0x22, 0xeb, 0xfd, 0xea, 0xeb, 0xeb, 0xeb, 0xfd, 0xeb, 0xeb, 0xfc, 0xfd, 0xfa, 0xb6, 0xee, 0xea, 0xe8, 0xd6, 0xd9, 0xd3, 0xc9, 0xc3, 0xc2, 0xc4, 0xb0, 0x42, 0x33, 0x3b, 0x36, 0x3b, 0x3b, 0x36, 0x35, 0x33, 0x2e, 0x25, 0xaa, 0xeb, 0xe6, 0xe5, 0xf5, 0xf4, 0xf5, 0xf2, 0xe5, 0xf2, 0xf1, 0xf1, 0xe6, 0xe6, 0xe6, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf4, 0xf4, 0xf0, 0xf5, 0xf4, 0xf4, 0xf1, 0xf4, 0xf1, 0xe4, 0xf1, 0xbb, 0xf4, 0xf0, 0xf0, 0xea, 0x7a, 0xc2, 0x2b, 0x2a, 0x30, 0x33, 0x3a, 0x35, 0x3c, 0x35, 0x3a, 0x36, 0x2e, 0xa2, 0xcb, 0xc2, 0xc2, 0xcd, 0xdc, 0xd4, 0xe7, 0xfd, 0xeb, 0xfb, 0xfd, 0xeb, 0xfb, 0xfd, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xfd, 0xeb, 0xfa, 0xee, 0xc4, 0x2b, 0x34, 0x2f, 0x38, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x35, 0x36, 0x33, 0x2c, 0x52, 0xc0, 0xfd, 0xeb, 0xfd, 0xeb, 0xeb, 0xc7, 0xfd, 0xeb, 0xfc, 0xfd, 0xeb, 0xeb, 0xfd, 0xfd, 0xeb, 0xea, 0xd6, 0xd4, 0xd9, 0xcb, 0xc2, 0xc3, 0xc9, 0xb0, 0x60, 0x30, 0x3a, 0x36, 0x35, 0x36, 0x3b, 0x36, 0x33, 0x2d, 0x25, 0x31, 0xe1, 0xc7, 0xe3, 0xf1, 0x22, 0xf4, 0xf2, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xe5, 0xf1, 0xf1, 0xbb, 0xf5, 0xe9, 0xcf, 0xc2, 0x25, 0x27, 0x26, 0x2c, 0x37, 0x3a, 0x39, 0x3c, 0x39, 0x3c, 0x3c, 0x2d, 0x9d, 0xc6, 0xc2, 0xc2, 0xcd, 0xdc, 0xd4, 0xe7, 0xeb, 0x24, 0xeb, 0xeb, 0xfd, 0xeb, 0xfd, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xfd, 0xeb, 0xeb, 0xfc, 0xee, 0x4c, 0x2b, 0x32, 0x2e, 0x35, 0x33, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x37, 0x36, 0x33, 0x3a, 0x35, 0x36, 0x37, 0x2d, 0x52, 0xbe, 0xfd, 0xfb, 0xfd, 0xeb, 0xeb, 0xeb, 0xeb, 0xfd, 0xeb, 0xeb, 0xfb, 0xe9, 0xc7, 0x24, 0xc7, 0xe8, 0xd9, 0xd4, 0xdc, 0xcc, 0xc2, 0xc3, 0x00, 0xac, 0x60, 0x30, 0x3b, 0x35, 0x36, 0x35, 0x36, 0x3b, 0x38, 0x33, 0x2c, 0xc2, 0x01, 0xe1, 0xfd, 0xf5, 0xf4, 0xf5, 0xf6, 0xe5, 0xf1, 0xe6, 0xf1, 0xf5, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe5, 0xe5, 0xe4, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xf1, 0xbb, 0xf5, 0xfc, 0x13, 0xc2, 0xc2, 0xc9, 0x2a, 0x27, 0x2c, 0x30, 0x3a, 0x3c, 0x39, 0x3c, 0x3c, 0x3b, 0x33, 0x94, 0x3d, 0xc3, 0xc2, 0xcd, 0xdc, 0xd4, 0xe7, 0xea, 0x24, 0x24, 0xeb, 0xfc, 0xeb, 0xeb, 0xeb, 0xfd, 0xeb, 0xfd, 0xeb, 0xfd, 0xfc, 0xeb, 0xea, 0xee, 0xc4, 0x2b, 0x32, 0x2e, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0x3a, 0x33, 0x31, 0xc4, 0xb9, 0xfd, 0xc7, 0xfd, 0xeb, 0xeb, 0xeb, 0xfd, 0xeb, 0xfc, 0xfb, 0xfd, 0xeb, 0xeb, 0xc1, 0xfd, 0xe8, 0xd9, 0xd6, 0xdc, 0xcc, 0xc2, 0xc3, 0x00, 0xaa, 0x60, 0x30, 0x33, 0x36, 0x35, 0x3b, 0x33, 0x33, 0x36, 0x36, 0x2c, 0x25, 0xc2, 0xc6, 0xd5, 0x24, 0x22, 0xf4, 0xe5, 0xe5, 0xf5, 0xf1, 0xf4, 0xf2, 0xf4, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf5, 0xf0, 0xf5, 0xf0, 0xf1, 0xf1, 0xf1, 0xe6, 0xfa, 0xe0, 0xc2, 0xc2, 0xc3, 0x25, 0x25, 0x2a, 0x28, 0x37, 0x3a, 0x3c, 0x3c, 0x3f, 0x3c, 0x3c, 0x30, 0x89, 0xc4, 0xc2, 0xc2, 0xcc, 0xdc, 0xd4, 0xdc, 0xfd, 0x24, 0x24, 0x24, 0x24, 0xfd, 0xeb, 0xeb, 0xeb, 0xeb, 0x24, 0x24, 0xc1, 0x24, 0xeb, 0xfa, 0xd8, 0xc9, 0x2d, 0x33, 0x35, 0x38, 0x33, 0x33, 0x3a, 0x3a, 0x38, 0x30, 0x34, 0x31, 0x3d, 0x3e, 0x42, 0x38, 0x3a, 0x37, 0x30, 0x33, 0x36, 0x33, 0x33, 0x38, 0x36, 0x38, 0x38, 0x33, 0x36, 0x2d, 0x34, 0xb4, 0xfd, 0xfd, 0xeb, 0xeb, 0xeb, 0xeb, 0xfd, 0xeb, 0xfd, 0xfd, 0x24, 0x24, 0x24, 0x24, 0xc7, 0xe8, 0xd6, 0xd6, 0xda, 0xcb, 0xc2, 0xc3, 0xc6, 0xaa, 0x49, 0x3a, 0x3a, 0x36, 0x3a, 0x36, 0x36, 0x36, 0x36, 0x33, 0x30, 0x2a, 0xc3, 0xc2, 0xc2, 0xcf, 0xfa, 0xf8, 0xe5, 0xf0, 0xf0, 0xf7, 0xf4, 0xf0, 0xf3, 0xf2, 0xf4, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf1, 0xf2, 0xe3, 0xf1, 0xf5, 0xe3, 0xf1, 0xf5, 0xb9, 0xfb, 0xff, 0x84, 0xc2, 0xc2, 0xc2, 0xc3, 0x27, 0x25, 0x26, 0x28, 0x36, 0x3c, 0x3c, 0x3f, 0x3f, 0x3c, 0x3a, 0x33, 0x81, 0x01, 0xc2, 0xc2, 0xcb, 0xdc, 0xd6, 0xd7, 0xea, 0x24, 0x24, 0x24, 0xfd, 0xeb, 0xeb, 0xea, 0xeb, 0xeb, 0xfd, 0xfd, 0x24, 0x24, 0xeb, 0xe7, 0xd5, 0x25, 0x32, 0x35, 0x35, 0x38, 0x30, 0x33, 0x36, 0x33, 0x38, 0x42, 0x3e, 0x31, 0x2a, 0x2b, 0x2c, 0x30, 0x2c, 0x37, 0x42, 0x42, 0x34, 0x33, 0x36, 0x3a, 0x3a, 0x30, 0x30, 0x36, 0x33, 0x30, 0x2b, 0xae, 0xf7, 0xfd, 0xea, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xfd, 0xeb, 0xeb, 0x24, 0xfd, 0xe7, 0xd6, 0xd9, 0xd7, 0xc9, 0xc3, 0xc3, 0xc6, 0xab, 0x34, 0x36, 0x36, 0x36, 0x3a, 0x36, 0x3a, 0x36, 0x33, 0x38, 0x30, 0x26, 0x27, 0xc3, 0xc2, 0xc2, 0xc5, 0xf7, 0xe9, 0xf1, 0xf7, 0xf0, 0xf0, 0xf6, 0xf3, 0xf0, 0xf3, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf1, 0xf2, 0xf5, 0xf5, 0xf0, 0xf1, 0xe3, 0xfb, 0xe1, 0xcb, 0xc2, 0x00, 0xc2, 0x00, 0x26, 0x27, 0x26, 0x25, 0x2c, 0x37, 0x3a, 0x3c, 0x3c, 0x3f, 0x3a, 0x39, 0x30, 0x71, 0x60, 0xc2, 0xc2, 0xc8, 0xd7, 0xd7, 0xd4, 0xe7, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xeb, 0xeb, 0xea, 0xeb, 0xeb, 0xea, 0xeb, 0xfd, 0xea, 0xe8, 0xdf, 0x25, 0x33, 0x35, 0x35, 0x33, 0x32, 0x32, 0x32, 0x38, 0x42, 0x2d, 0x25, 0x25, 0xc3, 0xc3, 0x25, 0x25, 0x25, 0x28, 0x26, 0x29, 0x3d, 0x3d, 0x3d, 0x2b, 0x32, 0x38, 0x33, 0x36, 0x33, 0x34, 0x29, 0xde, 0xe6, 0xea, 0xeb, 0xea, 0xea, 0xc7, 0xc7, 0xc7, 0xeb, 0xc7, 0xc7, 0xc7, 0xeb, 0xe9, 0xea, 0xdb, 0xd6, 0xdc, 0xd0, 0xc2, 0xc3, 0xc3, 0x7a, 0x94, 0x29, 0x36, 0x3a, 0x33, 0x3a, 0x36, 0x38, 0x36, 0x33, 0x37, 0x38, 0x2c, 0x25, 0xc3, 0xc3, 0xc2, 0xc2, 0x00, 0xec, 0xfb, 0xf7, 0xf7, 0xe3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xe6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xe5, 0xf4, 0xf2, 0xf1, 0xf0, 0xf5, 0xe3, 0xf7, 0xe3, 0xf8, 0xfd, 0xac, 0xc6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 0x27, 0x28, 0x25, 0x28, 0x30, 0x3b, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x3a, 0x2e, 0x52, 0x68, 0x25, 0xc2, 0xc2, 0xd2, 0xda, 0xd4, 0xd8, 0xea, 0xeb, 0xeb, 0xeb, 0xeb, 0xfd, 0xeb, 0xfd, 0xeb, 0xeb, 0xeb, 0xea, 0xeb, 0xe4, 0xee, 0xc4, 0x2d, 0x2e, 0x39, 0x2e, 0x33, 0x2b, 0x32, 0x32, 0x3d, 0x28, 0xc3, 0x25, 0x25, 0x25, 0x2b, 0x2a, 0x2b, 0x28, 0xc3, 0x25, 0x25, 0x25, 0x2d, 0x42, 0x32, 0x32, 0x30, 0x36, 0x33, 0x33, 0x33, 0x2b, 0x3d, 0xee, 0xe3, 0xfd, 0xea, 0xc7, 0xc7, 0xeb, 0x24, 0xfd, 0xfd, 0xeb, 0xeb, 0xc7, 0xea, 0xe7, 0xd9, 0xd6, 0xe2, 0xcd, 0xc2, 0x26, 0xc3, 0x94, 0x68, 0x33, 0x3a, 0x3a, 0x33, 0x36, 0x3a, 0x36, 0x36, 0x33, 0x38, 0x37, 0x30, 0x25, 0xc3, 0xc3, 0x00, 0xc2, 0xc2, 0xc2, 0xe0, 0xf1, 0xfb, 0xf0, 0xf7, 0xf0, 0xf3, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf1, 0xf1, 0xf5, 0xf1, 0xf0, 0xf7, 0xf5, 0xe0, 0xc2, 0xc2, 0x00, 0xc3, 0x00, 0xc3, 0x2a, 0x2a, 0x26, 0x25, 0x2d, 0x42, 0x36, 0x3a, 0x3c, 0x3c, 0x3c, 0x3a, 0x3c, 0x33, 0x34, 0x71, 0x31, 0xc3, 0xc2, 0xcc, 0xda, 0xd4, 0xd4, 0xe2, 0xeb, 0xfd, 0xfd, 0x24, 0x24, 0x24, 0x24, 0x24, 0xfd, 0xeb, 0xeb, 0xe8, 0xe2, 0x13, 0x2a, 0x2e, 0x35, 0x2f, 0x35, 0x32, 0x32, 0x3d, 0x2d, 0xc3, 0x30, 0x7c, 0xa7, 0xa7, 0xa7, 0xaa, 0xa2, 0xa2, 0xa7, 0xab, 0x99, 0x81, 0x3a, 0xc3, 0x2b, 0x3d, 0x34, 0x33, 0x35, 0x33, 0x35, 0x34, 0x32, 0x25, 0xcf, 0xe1, 0xe8, 0xfd, 0xeb, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0xfd, 0xeb, 0xea, 0xda, 0xd4, 0xdb, 0xd7, 0xc2, 0xc2, 0x25, 0x3d, 0x94, 0x2d, 0x3a, 0x3b, 0x36, 0x3b, 0x3a, 0x35, 0x3a, 0x35, 0x35, 0x33, 0x38, 0x30, 0x2b, 0xc3, 0xc3, 0xc2, 0xc2, 0xc3, 0xc2, 0xc2, 0xc4, 0xe1, 0xfa, 0xe3, 0xf4, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf1, 0xf0, 0xf1, 0xf5, 0xf5, 0xf7, 0xde, 0xc2, 0xc2, 0x27, 0xc2, 0x27, 0x27, 0xc3, 0x2a, 0x26, 0x26, 0x30, 0x37, 0x3a, 0x3b, 0x36, 0x3a, 0x3c, 0x3a, 0x3c, 0x3a, 0x3b, 0x2b, 0x68, 0x4c, 0xc2, 0x27, 0xc2, 0xd2, 0xda, 0xd4, 0xd4, 0xe7, 0xfd, 0xc7, 0xfd, 0x24, 0x24, 0x24, 0x24, 0xfd, 0xeb, 0xea, 0xdb, 0xe1, 0xcb, 0x30, 0x33, 0x35, 0x35, 0x33, 0x2d, 0x34, 0x2c, 0x26, 0x77, 0x1a, 0xa9, 0x09, 0x5d, 0x38, 0x2c, 0x30, 0x2c, 0x38, 0x48, 0x09, 0x14, 0xaf, 0x0d, 0x2c, 0x2b, 0x37, 0x36, 0x35, 0x36, 0x33, 0x33, 0x32, 0x25, 0xc4, 0xd3, 0xe1, 0xe5, 0xfd, 0xfc, 0x24, 0xfc, 0x24, 0xfc, 0xeb, 0xeb, 0xea, 0xdc, 0xd7, 0xd9, 0xda, 0xde, 0xc2, 0x27, 0x25, 0x71, 0x60, 0x2d, 0x36, 0x3a, 0x36, 0x3a, 0x35, 0x3a, 0x36, 0x3a, 0x33, 0x36, 0x36, 0x33, 0x30, 0x2a, 0xc3, 0x2a, 0x27, 0xc2, 0xc2, 0xc2, 0xc2, 0xc9, 0xed, 0xfa, 0xf0, 0xf4, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf1, 0xf1, 0xf5, 0xe3, 0xfb, 0xa8, 0xc2, 0xc9, 0x68, 0xdd, 0x89, 0xc6, 0x27, 0x2a, 0x2a, 0x26, 0x28, 0x37, 0x3a, 0x3b, 0x3a, 0x35, 0x3a, 0x36, 0x35, 0x38, 0x36, 0x35, 0x32, 0x32, 0x6b, 0x2c, 0xc3, 0xc2, 0xc4, 0xd8, 0xd8, 0xd4, 0xd7, 0xe2, 0xea, 0xea, 0xea, 0xea, 0xeb, 0xea, 0xe8, 0xe7, 0xdb, 0xe2, 0xde, 0x25, 0x33, 0x2d, 0x35, 0x2e, 0x33, 0x36, 0x2d, 0x38, 0xad, 0x1c, 0x1a, 0x1b, 0x1f, 0x1f, 0x1c, 0x18, 0x0d, 0x04, 0x09, 0x1a, 0x1f, 0x1c, 0x1a, 0x20, 0x1b, 0x49, 0x2b, 0x33, 0x35, 0x33, 0x35, 0x36, 0x2d, 0x3d, 0xc3, 0x60, 0xd8, 0xed, 0xdb, 0xea, 0xfd, 0xea, 0xeb, 0xea, 0xea, 0xe7, 0xdb, 0xd7, 0xd7, 0xe2, 0xd0, 0xc2, 0xc9, 0xc3, 0x42, 0x60, 0x2b, 0x36, 0x35, 0x36, 0x35, 0x3a, 0x36, 0x3a, 0x3b, 0x3a, 0x35, 0x38, 0x35, 0x33, 0x30, 0x2b, 0x26, 0xc3, 0xc3, 0x27, 0xc4, 0x7a, 0xdd, 0x01, 0x01, 0xed, 0xff, 0xf6, 0xf4, 0xf2, 0xf5, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf1, 0xf0, 0xf5, 0xf1, 0xf5, 0xe1, 0xef, 0xf0, 0xbf, 0xbd, 0xdf, 0x27, 0x25, 0x2a, 0x28, 0x28, 0x2d, 0x3b, 0x3b, 0x36, 0x35, 0x38, 0x35, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x2e, 0x32, 0x49, 0x4c, 0x2c, 0xc3, 0xc3, 0xcc, 0xd8, 0xda, 0xd4, 0xd4, 0xda, 0xe2, 0xe7, 0xe7, 0xe2, 0xe2, 0xda, 0xda, 0xdb, 0xdd, 0xc3, 0x30, 0x33, 0x36, 0x33, 0x33, 0x33, 0x35, 0x28, 0xa3, 0x20, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1c, 0x1e, 0x1f, 0x1e, 0x21, 0x1f, 0x20, 0x20, 0xb2, 0x38, 0x33, 0x35, 0x36, 0x36, 0x36, 0x33, 0x2d, 0x3d, 0xc3, 0x68, 0xd3, 0xd8, 0xd5, 0xd8, 0xdc, 0xdb, 0xdc, 0xd9, 0xd4, 0xd7, 0xd7, 0xdb, 0xd1, 0xc8, 0xc9, 0x25, 0x30, 0x42, 0x36, 0x3c, 0x35, 0x33, 0x35, 0x36, 0x3a, 0x35, 0x3c, 0x3a, 0x35, 0x36, 0x35, 0x35, 0x35, 0x33, 0x2b, 0x26, 0x3d, 0x2c, 0xc2, 0x31, 0xb1, 0xeb, 0x22, 0xb1, 0xfe, 0xf2, 0xf4, 0xf4, 0xf2, 0xf1, 0xf4, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xfa, 0xf8, 0xf0, 0xc1, 0xac, 0xc2, 0x2a, 0x2c, 0x2a, 0x26, 0x2b, 0x37, 0x3a, 0x35, 0x35, 0x36, 0x35, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x2c, 0x42, 0x31, 0x29, 0x25, 0xc3, 0xc4, 0xd2, 0xe2, 0xda, 0xd7, 0xd4, 0xd6, 0xd7, 0xd9, 0xd8, 0xe2, 0xd3, 0xcc, 0xc3, 0x34, 0x33, 0x2e, 0x2d, 0x34, 0x31, 0x36, 0x3a, 0x29, 0xab, 0x20, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0x1d, 0x1f, 0x1e, 0x1d, 0x21, 0x21, 0x21, 0x1e, 0x20, 0x1c, 0x48, 0x30, 0x33, 0x35, 0x38, 0x35, 0x38, 0x36, 0x34, 0x2d, 0x26, 0x3d, 0xdf, 0xd8, 0xd8, 0xd7, 0xd7, 0xd4, 0xd4, 0xd8, 0xdc, 0xd3, 0x7a, 0xc2, 0xc3, 0x28, 0x3d, 0x32, 0x37, 0x33, 0x3c, 0x38, 0x35, 0x36, 0x35, 0x3a, 0x36, 0x3a, 0x3b, 0x3a, 0x36, 0x35, 0x35, 0x35, 0x33, 0x2d, 0x25, 0x2a, 0x3e, 0x2a, 0xc3, 0x2a, 0xb1, 0xc7, 0xf9, 0xff, 0xf8, 0xf2, 0xf4, 0xf1, 0xf5, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf1, 0xf1, 0xf2, 0xf5, 0xf1, 0xf5, 0xe3, 0xc1, 0xb4, 0x4c, 0xc2, 0x27, 0x25, 0x26, 0x25, 0x2e, 0x3b, 0x35, 0x36, 0x35, 0x36, 0x33, 0x33, 0x33, 0x38, 0x33, 0x35, 0x36, 0x35, 0x2e, 0x30, 0x30, 0x31, 0x32, 0x32, 0x29, 0xc9, 0xc3, 0xcc, 0xcf, 0xd7, 0xd5, 0xd8, 0xd5, 0xd5, 0xd2, 0x68, 0x25, 0x25, 0x3d, 0x2e, 0x35, 0x35, 0x38, 0x31, 0x31, 0x38, 0x3c, 0x2d, 0x77, 0x23, 0x1e, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x21, 0x1d, 0x1e, 0x1f, 0x23, 0xa3, 0x2c, 0x38, 0x33, 0x38, 0x33, 0x38, 0x3a, 0x33, 0x37, 0x3b, 0x31, 0x2c, 0x2c, 0x2c, 0xcc, 0xe0, 0xd0, 0xd2, 0xd1, 0xce, 0xcb, 0xc8, 0xc3, 0x31, 0x29, 0x49, 0x29, 0x2b, 0x2d, 0x3a, 0x3a, 0x3f, 0x3a, 0x39, 0x36, 0x35, 0x35, 0x3c, 0x35, 0x3c, 0x35, 0x35, 0x35, 0x35, 0x36, 0x2d, 0x28, 0x2a, 0x2a, 0x3e, 0x25, 0x27, 0x01, 0xb6, 0x22, 0xf7, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf7, 0xf1, 0xf5, 0xf1, 0xfd, 0x94, 0xc2, 0x2c, 0x26, 0x2c, 0x26, 0x26, 0x36, 0x36, 0x35, 0x2e, 0x36, 0x2e, 0x2e, 0x33, 0x35, 0x33, 0x33, 0x38, 0x38, 0x38, 0x3a, 0x38, 0x30, 0x2d, 0x29, 0x2d, 0x32, 0x32, 0xc9, 0xc3, 0xc3, 0x25, 0xcb, 0xcb, 0xc4, 0xc6, 0x25, 0x26, 0x32, 0x37, 0x2d, 0x35, 0x2d, 0x2e, 0x33, 0x34, 0x34, 0x36, 0x3a, 0x3a, 0x26, 0x19, 0x23, 0x1e, 0x1d, 0x21, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0x1e, 0x20, 0x1c, 0x38, 0x30, 0x33, 0x38, 0x36, 0x38, 0x35, 0x33, 0x33, 0x37, 0x3a, 0x37, 0x38, 0x30, 0x30, 0x26, 0x25, 0x25, 0x25, 0x25, 0xc3, 0x26, 0x2b, 0x2b, 0x2b, 0x33, 0x3a, 0x48, 0x6a, 0x02, 0x72, 0x02, 0x02, 0x02, 0x48, 0x48, 0x35, 0x33, 0x3f, 0x3c, 0x35, 0x3b, 0x3b, 0x35, 0x35, 0x35, 0x2d, 0x2b, 0x26, 0x2a, 0xc6, 0x31, 0x2a, 0x2a, 0xb0, 0xc0, 0x22, 0xe3, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xe6, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xe6, 0xe6, 0xf5, 0xf2, 0xf2, 0xf4, 0xf0, 0xf5, 0xf1, 0x24, 0xb1, 0xc2, 0x2a, 0x2a, 0x2c, 0x2b, 0x28, 0x2d, 0x3a, 0x33, 0x36, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x3a, 0x48, 0x02, 0x04, 0x04, 0x04, 0x04, 0x03, 0x72, 0x58, 0x48, 0x2e, 0x29, 0x32, 0x32, 0x32, 0x29, 0x2b, 0x2d, 0x29, 0x29, 0x2e, 0x30, 0x33, 0x33, 0x36, 0x2d, 0x36, 0x41, 0x32, 0x35, 0x36, 0x36, 0x36, 0x41, 0x2b, 0x2b, 0x1b, 0x23, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x21, 0x1e, 0x23, 0x1b, 0x38, 0x33, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x41, 0x2b, 0x2d, 0x36, 0x36, 0x36, 0x33, 0x2e, 0x32, 0x32, 0x32, 0x29, 0x2e, 0x33, 0x2d, 0x2e, 0x38, 0x46, 0x02, 0x06, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x04, 0x6a, 0x58, 0x3a, 0x38, 0x3c, 0x32, 0x32, 0x3a, 0x36, 0x2f, 0x33, 0x29, 0x2a, 0x2c, 0xc3, 0x31, 0x2a, 0xc3, 0x60, 0xe3, 0x22, 0xf2, 0xf6, 0xf3, 0xf4, 0xf3, 0xf4, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xe6, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf7, 0xf5, 0x22, 0x7a, 0xc2, 0x27, 0x26, 0x31, 0x34, 0x28, 0x3b, 0x3a, 0x35, 0x36, 0x35, 0x33, 0x2e, 0x35, 0x33, 0x48, 0x6a, 0x07, 0x07, 0x03, 0x04, 0x07, 0x07, 0x07, 0x03, 0x07, 0x07, 0x5d, 0x48, 0x33, 0x2d, 0x33, 0x32, 0x32, 0x2b, 0x32, 0x33, 0x30, 0x2e, 0x33, 0x30, 0x3a, 0x2d, 0x36, 0x2d, 0x32, 0x2e, 0x36, 0x35, 0x3a, 0x3b, 0x36, 0x3a, 0x42, 0x19, 0x23, 0x23, 0x21, 0x21, 0x1e, 0x21, 0x1e, 0x1d, 0x1e, 0x1f, 0x23, 0x1a, 0x4d, 0x38, 0x30, 0x34, 0x38, 0x33, 0x37, 0x33, 0x36, 0x33, 0x33, 0x37, 0x36, 0x30, 0x33, 0x36, 0x33, 0x2d, 0x2e, 0x32, 0x2d, 0x2d, 0x33, 0x33, 0x33, 0x36, 0x48, 0x72, 0x04, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x03, 0x04, 0x04, 0x72, 0x58, 0x3f, 0x3a, 0x2e, 0x32, 0x3a, 0x35, 0x35, 0x2e, 0x30, 0x28, 0x27, 0x2c, 0x25, 0x25, 0x26, 0xc2, 0xaa, 0xc0, 0xf6, 0xf0, 0xf3, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xe6, 0xf5, 0xf2, 0xf2, 0xf4, 0xf6, 0xf1, 0xfb, 0xfe, 0x27, 0xc3, 0x4c, 0x4c, 0x25, 0x2d, 0x2d, 0x41, 0x41, 0x2e, 0x36, 0x2e, 0x3b, 0x33, 0x36, 0x58, 0x72, 0x04, 0x04, 0x03, 0x06, 0x06, 0x06, 0x05, 0x06, 0x08, 0x06, 0x03, 0x07, 0x04, 0x58, 0x38, 0x2d, 0x3a, 0x37, 0x2d, 0x32, 0x30, 0x32, 0x30, 0x33, 0x38, 0x30, 0x3a, 0x30, 0x2d, 0x3b, 0x34, 0x35, 0x36, 0x35, 0x3a, 0x2d, 0x38, 0x3a, 0x28, 0xa3, 0x20, 0x23, 0x23, 0x1f, 0x20, 0x21, 0x20, 0x23, 0x20, 0xa3, 0x2c, 0x2b, 0x38, 0x38, 0x42, 0x33, 0x36, 0x33, 0x36, 0x36, 0x37, 0x28, 0x3b, 0x28, 0x3a, 0x33, 0x38, 0x33, 0x33, 0x2d, 0x33, 0x2d, 0x35, 0x33, 0x2d, 0x38, 0x58, 0x07, 0x04, 0x03, 0x06, 0x06, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x03, 0x06, 0x03, 0x07, 0x58, 0x38, 0x35, 0x37, 0x36, 0x3a, 0x2f, 0x35, 0x2d, 0x28, 0x27, 0x26, 0x31, 0x4c, 0x25, 0x25, 0x4c, 0xf7, 0xf1, 0xf1, 0xf2, 0xf4, 0xf1, 0xf4, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xe6, 0xf2, 0xf6, 0xf2, 0xf2, 0xf6, 0xf5, 0xfa, 0x84, 0xc2, 0x52, 0xfe, 0x4c, 0x31, 0x32, 0x2d, 0x44, 0x33, 0x33, 0x2e, 0x2e, 0x33, 0x33, 0x48, 0x6a, 0x02, 0x07, 0x06, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x06, 0x07, 0x07, 0x58, 0x30, 0x33, 0x33, 0x33, 0x2d, 0x2e, 0x33, 0x33, 0x33, 0x41, 0x30, 0x42, 0x28, 0x42, 0x2b, 0x32, 0x34, 0x35, 0x36, 0x36, 0x3a, 0x3c, 0x2b, 0x44, 0x26, 0x4d, 0xa9, 0x1c, 0x23, 0x23, 0x23, 0x23, 0x19, 0x5d, 0x2b, 0x33, 0x3b, 0x37, 0x38, 0x30, 0x33, 0x37, 0x33, 0x37, 0x33, 0x2d, 0x6b, 0x2b, 0x42, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x3a, 0x33, 0x38, 0x6a, 0x02, 0x03, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x03, 0x48, 0x33, 0x32, 0x3a, 0x35, 0x3b, 0x2f, 0x33, 0x2c, 0x2c, 0x2c, 0x28, 0xae, 0x89, 0xc3, 0x27, 0xb1, 0xfb, 0xf2, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe6, 0xf2, 0xf2, 0xf2, 0xf4, 0xf7, 0xf4, 0x22, 0xc4, 0xc9, 0xee, 0xb6, 0x26, 0x28, 0x2b, 0x35, 0x3b, 0x35, 0x35, 0x2d, 0x2e, 0x2e, 0x3a, 0x58, 0x04, 0x07, 0x05, 0x05, 0x05, 0x08, 0x05, 0x06, 0x05, 0x05, 0x08, 0x08, 0x06, 0x06, 0x05, 0x06, 0x72, 0x48, 0x2d, 0x38, 0x35, 0x33, 0x2e, 0x2d, 0x36, 0x33, 0x30, 0x36, 0x2b, 0x60, 0xa2, 0x34, 0x34, 0x37, 0x33, 0x3b, 0x2e, 0x3a, 0x33, 0x41, 0x2b, 0x37, 0x28, 0x25, 0x38, 0x7c, 0x19, 0x19, 0x69, 0x26, 0x2b, 0x33, 0x34, 0x32, 0x34, 0x3a, 0x3a, 0x37, 0x30, 0x37, 0x30, 0x37, 0x2b, 0xb2, 0x89, 0x2e, 0x29, 0x38, 0x36, 0x38, 0x2e, 0x33, 0x33, 0x33, 0x38, 0x33, 0x48, 0x04, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x03, 0x05, 0x05, 0x08, 0x05, 0x06, 0x6a, 0x35, 0x36, 0x36, 0x35, 0x35, 0x41, 0x41, 0x26, 0x2a, 0x31, 0x28, 0x81, 0xc7, 0x94, 0xc2, 0xec, 0xf8, 0xf2, 0xf1, 0xf4, 0xf5, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe6, 0xf1, 0xf2, 0xf0, 0xf3, 0xe3, 0xfa, 0xe3, 0x01, 0xfe, 0xc1, 0xed, 0x26, 0x2b, 0x2d, 0x35, 0x2e, 0x3b, 0x2e, 0x33, 0x2e, 0x30, 0x3f, 0x6a, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x06, 0x7e, 0x5d, 0x36, 0x38, 0x2e, 0x33, 0x33, 0x2e, 0x32, 0x2e, 0x30, 0x33, 0x26, 0xa7, 0xbe, 0x42, 0x2c, 0x34, 0x41, 0x2d, 0x44, 0x38, 0x36, 0x34, 0x32, 0x32, 0x32, 0x33, 0x2d, 0x25, 0x48, 0x30, 0x2c, 0x3a, 0x2d, 0x34, 0x32, 0x32, 0x37, 0x37, 0x3a, 0x36, 0x41, 0x30, 0x42, 0x2a, 0x49, 0x24, 0x89, 0x25, 0x3b, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x35, 0x38, 0x33, 0x5d, 0x04, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x05, 0x05, 0x03, 0x02, 0x3a, 0x33, 0x36, 0x35, 0x2f, 0x49, 0x4d, 0x30, 0x26, 0x34, 0x42, 0x2d, 0xb3, 0xfd, 0x13, 0xfe, 0xf9, 0xf0, 0xf2, 0xf1, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf2, 0xf0, 0xe5, 0xf4, 0xf4, 0xf1, 0xef, 0xb0, 0xf5, 0xf8, 0xb1, 0xc3, 0x29, 0x3b, 0x39, 0x35, 0x35, 0x35, 0x2e, 0x2e, 0x33, 0x48, 0x72, 0x03, 0x06, 0x05, 0x05, 0x08, 0x05, 0x05, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x7c, 0x58, 0x2e, 0x36, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x36, 0x33, 0x2b, 0x79, 0xbe, 0xac, 0xc3, 0x34, 0x30, 0x37, 0x2d, 0x38, 0x36, 0x33, 0x32, 0x32, 0x2b, 0x32, 0x3b, 0x33, 0x49, 0x42, 0x38, 0x2b, 0x42, 0x2d, 0x34, 0x37, 0x36, 0x3b, 0x37, 0x37, 0x37, 0x3e, 0x2b, 0x25, 0xb3, 0xb7, 0x26, 0x41, 0x29, 0x36, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x38, 0x33, 0x33, 0x58, 0x07, 0x05, 0x05, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x03, 0x72, 0x3a, 0x2e, 0x3b, 0x33, 0x2f, 0x49, 0x4d, 0x2b, 0x28, 0x3d, 0x79, 0x25, 0xa2, 0xc0, 0xbe, 0xf7, 0xf1, 0xe5, 0xf0, 0xf4, 0xf4, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xe6, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf1, 0xff, 0xf5, 0x22, 0xf9, 0xb0, 0xc2, 0x2d, 0x49, 0x2f, 0x39, 0x3b, 0x3b, 0x29, 0x2e, 0x2e, 0x48, 0x02, 0x03, 0x03, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x44, 0x2b, 0x36, 0x2e, 0x32, 0x2e, 0x32, 0x2e, 0x33, 0x2e, 0x3b, 0x29, 0xc3, 0x6b, 0x24, 0xaa, 0xc3, 0x3e, 0x30, 0x3a, 0x33, 0x33, 0x36, 0x33, 0x37, 0x34, 0x33, 0x2d, 0x2b, 0x49, 0x3e, 0x33, 0x36, 0x36, 0x38, 0x3a, 0x33, 0x3b, 0x36, 0x3b, 0x3b, 0x2d, 0x2d, 0x31, 0xb2, 0xb4, 0x25, 0x2d, 0x2d, 0x32, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x35, 0x33, 0x38, 0x49, 0x07, 0x06, 0x05, 0x03, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x06, 0x05, 0x05, 0x07, 0x02, 0x46, 0x33, 0x3b, 0x35, 0x2f, 0x49, 0x4d, 0x30, 0x30, 0x29, 0x81, 0x44, 0xdf, 0x24, 0xef, 0xf5, 0xf3, 0xf2, 0xf3, 0xf4, 0xf0, 0xf4, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf6, 0xf1, 0xef, 0x22, 0xe3, 0xf8, 0xed, 0xc3, 0x29, 0x35, 0x2f, 0x35, 0x2f, 0x3b, 0x2f, 0x32, 0x33, 0x3a, 0x58, 0x03, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x6a, 0x44, 0x2e, 0x35, 0x2e, 0x32, 0x2e, 0x32, 0x33, 0x33, 0x2f, 0x2e, 0x2d, 0x42, 0xc3, 0x52, 0xbd, 0xac, 0xc3, 0x26, 0x33, 0x33, 0x38, 0x33, 0x33, 0x33, 0x38, 0x33, 0x33, 0x2d, 0x49, 0x52, 0x29, 0x38, 0x3a, 0x38, 0x38, 0x3a, 0x3a, 0x3b, 0x37, 0x32, 0x29, 0x42, 0xb5, 0xb0, 0x2a, 0x31, 0x30, 0x34, 0x37, 0x2d, 0x2e, 0x32, 0x2d, 0x32, 0x33, 0x33, 0x33, 0x38, 0x3a, 0x02, 0x05, 0x06, 0x05, 0x03, 0x05, 0x03, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x58, 0x3a, 0x38, 0x35, 0x3b, 0x35, 0x44, 0x44, 0x34, 0x2d, 0x49, 0x60, 0x42, 0x89, 0x24, 0x22, 0xf7, 0xf0, 0xf3, 0xf2, 0xf3, 0xf1, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf5, 0xf0, 0xe6, 0xf8, 0xee, 0x30, 0x3e, 0x2e, 0x7c, 0x45, 0x2f, 0x37, 0x2e, 0x33, 0x2e, 0x38, 0x48, 0x02, 0x03, 0x03, 0x05, 0x03, 0x05, 0x05, 0x08, 0x05, 0x08, 0x05, 0x08, 0x06, 0x06, 0x07, 0x07, 0x46, 0x2e, 0x36, 0x2e, 0x33, 0x32, 0x33, 0x2e, 0x33, 0x2e, 0x3b, 0x2e, 0x32, 0x29, 0x3e, 0x28, 0x26, 0xb3, 0xba, 0x79, 0xc2, 0x26, 0xc3, 0x2b, 0x2c, 0x2c, 0x2b, 0x25, 0xc3, 0xc3, 0x31, 0x3d, 0x3d, 0xc3, 0x2a, 0x38, 0x38, 0x38, 0x38, 0x2d, 0x29, 0x26, 0x81, 0x22, 0x99, 0xc2, 0x3e, 0x2b, 0x3d, 0x2d, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x30, 0x2e, 0x3a, 0x2b, 0x58, 0x02, 0x07, 0x03, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x03, 0x04, 0x02, 0x48, 0x33, 0x35, 0x37, 0x3b, 0x2f, 0x4a, 0x3f, 0x33, 0x4d, 0x99, 0x89, 0x60, 0x9d, 0xfb, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf1, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xe6, 0x22, 0x60, 0x2c, 0x44, 0xaf, 0x4d, 0x33, 0x36, 0x36, 0x35, 0x35, 0x36, 0x33, 0x48, 0x72, 0x04, 0x03, 0x06, 0x05, 0x05, 0x05, 0x08, 0x08, 0x08, 0x05, 0x03, 0x07, 0x04, 0x58, 0x30, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x37, 0x30, 0x26, 0xab, 0xc0, 0xb6, 0xa2, 0x84, 0x71, 0x6b, 0x6b, 0x7a, 0x94, 0x13, 0xb1, 0xb9, 0xe6, 0xee, 0xac, 0x79, 0x52, 0x38, 0x38, 0x37, 0x3d, 0x68, 0xb3, 0xc0, 0x71, 0x25, 0x2c, 0x2d, 0x33, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x48, 0x04, 0x03, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x06, 0x03, 0x03, 0x02, 0x48, 0x3a, 0x35, 0x38, 0x37, 0x2e, 0x40, 0x53, 0x50, 0x51, 0x69, 0xb5, 0xbd, 0xdf, 0xcf, 0xfd, 0xf0, 0xe6, 0xe3, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xe6, 0xf8, 0xb0, 0x79, 0x4d, 0xb5, 0x77, 0x2e, 0x3c, 0x3a, 0x35, 0x33, 0x3a, 0x38, 0x38, 0x38, 0x6a, 0x02, 0x07, 0x07, 0x03, 0x07, 0x03, 0x06, 0x03, 0x07, 0x07, 0x6a, 0x48, 0x30, 0x2e, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x36, 0x36, 0x35, 0x32, 0x33, 0x2d, 0x30, 0xc3, 0x79, 0xbb, 0x24, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc1, 0xc7, 0xfd, 0xfd, 0xfd, 0xfd, 0xbe, 0x22, 0xef, 0xc7, 0xfd, 0xb9, 0x68, 0xc3, 0x31, 0x34, 0x37, 0x2d, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x38, 0x3a, 0x58, 0x02, 0x03, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x02, 0x58, 0x3a, 0x33, 0x35, 0x36, 0x32, 0x33, 0x35, 0x53, 0x5a, 0x57, 0x69, 0x7c, 0xbc, 0x24, 0xed, 0xed, 0xf9, 0xe3, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf0, 0xf4, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf0, 0xe5, 0xf1, 0xfb, 0xb5, 0x6b, 0xaf, 0x9e, 0x3c, 0x3f, 0x35, 0x35, 0x33, 0x2e, 0x3a, 0x38, 0x38, 0x38, 0x48, 0x58, 0x58, 0x72, 0x6a, 0x72, 0x6a, 0x6a, 0x58, 0x3a, 0x38, 0x2b, 0x3a, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x2d, 0x34, 0x28, 0x28, 0x79, 0xc1, 0xbe, 0xbe, 0xe9, 0xbe, 0xc7, 0xc0, 0xfb, 0xc1, 0xc1, 0x24, 0xc1, 0xfc, 0xc7, 0xc7, 0xc7, 0xe8, 0xeb, 0xbd, 0xbb, 0x52, 0x25, 0x34, 0x2b, 0x34, 0x30, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x3a, 0x3a, 0x48, 0x58, 0x58, 0x6a, 0x6a, 0x5d, 0x58, 0x48, 0x48, 0x33, 0x38, 0x36, 0x3a, 0x32, 0x32, 0x37, 0x2e, 0x40, 0x5e, 0x54, 0x5e, 0x5a, 0x8e, 0xc0, 0x22, 0xf7, 0xf5, 0xf7, 0xe3, 0xf5, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xe5, 0xf7, 0xb9, 0xc0, 0xab, 0xa7, 0xad, 0x46, 0x47, 0x39, 0x35, 0x36, 0x2e, 0x33, 0x30, 0x38, 0x38, 0x30, 0x30, 0x38, 0x36, 0x42, 0x3a, 0x3a, 0x30, 0x33, 0x2e, 0x33, 0x32, 0x2d, 0x32, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x3b, 0x33, 0x37, 0x3b, 0x2b, 0x2c, 0xb2, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0xc1, 0xc1, 0xbf, 0x24, 0x24, 0x24, 0x24, 0xc7, 0xfb, 0xc1, 0x24, 0x71, 0x25, 0x37, 0x32, 0x3b, 0x2d, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x2d, 0x37, 0x33, 0x30, 0x33, 0x38, 0x36, 0x38, 0x33, 0x38, 0x35, 0x3a, 0x36, 0x33, 0x3a, 0x38, 0x36, 0x41, 0x34, 0x32, 0x36, 0x3c, 0x4e, 0x5f, 0x54, 0x54, 0x51, 0xac, 0xc1, 0xe3, 0xf6, 0xf0, 0xe3, 0xf5, 0xe6, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf6, 0xf2, 0xf1, 0x22, 0xba, 0x9d, 0xad, 0x46, 0x5e, 0x43, 0x2f, 0x35, 0x32, 0x33, 0x32, 0x2d, 0x37, 0x38, 0x38, 0x33, 0x33, 0x2e, 0x2d, 0x33, 0x3a, 0x33, 0x2d, 0x33, 0x32, 0x32, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x2e, 0x33, 0x2f, 0x28, 0x71, 0xb8, 0x19, 0x19, 0x1a, 0x18, 0x18, 0x17, 0x18, 0x18, 0x18, 0x1a, 0x1b, 0x1f, 0x20, 0x23, 0xbc, 0xbf, 0xac, 0x2a, 0x2d, 0x2d, 0x32, 0x2d, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x32, 0x33, 0x36, 0x35, 0x33, 0x36, 0x33, 0x33, 0x2d, 0x33, 0x2e, 0x35, 0x33, 0x36, 0x36, 0x36, 0x33, 0x3b, 0x35, 0x2e, 0x47, 0x63, 0x54, 0x54, 0x53, 0x6f, 0xb7, 0x22, 0xf3, 0xf6, 0xf6, 0xf1, 0xf0, 0xf0, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf5, 0xf1, 0xfb, 0xaf, 0xa2, 0x69, 0x59, 0x67, 0x39, 0x2e, 0x35, 0x37, 0x32, 0x34, 0x32, 0x34, 0x33, 0x33, 0x32, 0x34, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x32, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x36, 0x35, 0x33, 0x28, 0x0d, 0x17, 0x10, 0x0e, 0x0e, 0x0a, 0x0a, 0x0a, 0x07, 0x0a, 0x08, 0x0a, 0x0a, 0x11, 0x15, 0x16, 0x1b, 0x6f, 0x28, 0x35, 0x32, 0x2e, 0x37, 0x2f, 0x33, 0x33, 0x36, 0x33, 0x36, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x32, 0x33, 0x36, 0x35, 0x33, 0x36, 0x33, 0x38, 0x35, 0x35, 0x35, 0x43, 0x59, 0x5f, 0x5f, 0x5a, 0x45, 0xa7, 0xbf, 0xf0, 0xf4, 0xf3, 0xe6, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xe6, 0xf4, 0xf2, 0xf6, 0xf2, 0xf1, 0xc0, 0xae, 0x6f, 0x4e, 0x75, 0x51, 0x39, 0x2f, 0x35, 0x3b, 0x33, 0x32, 0x33, 0x32, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x36, 0x33, 0x36, 0x36, 0x35, 0x35, 0x3c, 0x2b, 0x2b, 0x12, 0x15, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0b, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x15, 0x12, 0x2e, 0x2e, 0x32, 0x35, 0x33, 0x35, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x38, 0x36, 0x38, 0x35, 0x38, 0x35, 0x33, 0x36, 0x36, 0x35, 0x35, 0x35, 0x38, 0x33, 0x38, 0x39, 0x3c, 0x39, 0x43, 0x4f, 0x63, 0x54, 0x5e, 0x45, 0x81, 0xbb, 0xbe, 0xf0, 0xf6, 0xf0, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf6, 0xe5, 0xe4, 0xf7, 0xf5, 0xbf, 0x99, 0x5d, 0x69, 0x5e, 0x4e, 0x3f, 0x2f, 0x35, 0x35, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x35, 0x33, 0x33, 0x38, 0x33, 0x38, 0x33, 0x38, 0x36, 0x2e, 0x3c, 0x33, 0x58, 0x17, 0x15, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x11, 0x17, 0x58, 0x2e, 0x2d, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0x35, 0x38, 0x33, 0x38, 0x33, 0x38, 0x33, 0x38, 0x33, 0x35, 0x36, 0x33, 0x36, 0x35, 0x35, 0x2f, 0x43, 0x50, 0x5e, 0x5b, 0x5e, 0x50, 0x55, 0xb4, 0xc0, 0xf0, 0xf4, 0xe5, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0x22, 0xf1, 0xe5, 0xe4, 0xe4, 0xe3, 0xf8, 0xb8, 0x81, 0x5a, 0x67, 0x5a, 0x4e, 0x3f, 0x2f, 0x35, 0x35, 0x35, 0x35, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x32, 0x33, 0x33, 0x33, 0x33, 0x38, 0x38, 0x38, 0x36, 0x38, 0x35, 0x2d, 0x36, 0x30, 0x46, 0x16, 0x16, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x15, 0x17, 0x02, 0x30, 0x37, 0x32, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x36, 0x3a, 0x35, 0x33, 0x36, 0x33, 0x33, 0x2f, 0x40, 0x50, 0x5f, 0x5b, 0x54, 0x5f, 0x45, 0xaf, 0x24, 0xf0, 0xf3, 0xe4, 0xf1, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf1, 0x22, 0xe6, 0xe5, 0xe4, 0xe4, 0xe5, 0xf5, 0xbd, 0xb7, 0x6f, 0x5e, 0x50, 0x59, 0x51, 0x43, 0x35, 0x35, 0x35, 0x35, 0x33, 0x35, 0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x35, 0x33, 0x33, 0x38, 0x30, 0x38, 0x33, 0x38, 0x38, 0x33, 0x37, 0x32, 0x2d, 0x37, 0x41, 0x0d, 0x17, 0x11, 0x11, 0x0e, 0x0f, 0x0f, 0x11, 0x17, 0x12, 0x58, 0x30, 0x38, 0x32, 0x31, 0x33, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x36, 0x33, 0x36, 0x38, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x35, 0x2f, 0x40, 0x50, 0x5e, 0x5f, 0x54, 0x5f, 0x40, 0xad, 0xc0, 0x22, 0xf3, 0xf3, 0xe4, 0xe3, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xe5, 0xe6, 0xe6, 0xf1, 0xe9, 0xb3, 0x69, 0x51, 0x59, 0x5e, 0x5e, 0x47, 0x39, 0x2f, 0x2e, 0x32, 0x35, 0x2f, 0x2e, 0x32, 0x32, 0x32, 0x35, 0x33, 0x38, 0x38, 0x35, 0x38, 0x35, 0x36, 0x35, 0x36, 0x36, 0x36, 0x33, 0x38, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2d, 0x2b, 0x6a, 0x8e, 0x12, 0x16, 0x16, 0x14, 0x0d, 0x69, 0x30, 0x30, 0x38, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x38, 0x38, 0x33, 0x38, 0x33, 0x36, 0x33, 0x35, 0x33, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x32, 0x35, 0x2f, 0x35, 0x33, 0x31, 0x32, 0x2e, 0x39, 0x47, 0x5b, 0x5b, 0x5f, 0x61, 0x54, 0x49, 0xaa, 0xc1, 0xbb, 0xe6, 0xe5, 0xe4, 0xe5, 0xe5, 0xe6, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf4, 0xf4, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xe3, 0xfb, 0xb4, 0x5d, 0x5d, 0x59, 0x54, 0x5e, 0x53, 0x40, 0x2f, 0x35, 0x36, 0x36, 0x33, 0x32, 0x33, 0x32, 0x33, 0x33, 0x35, 0x35, 0x36, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x32, 0x33, 0x35, 0x33, 0x30, 0x3a, 0x42, 0x48, 0x48, 0x3a, 0x38, 0x30, 0x3a, 0x35, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x35, 0x36, 0x33, 0x33, 0x33, 0x37, 0x33, 0x2e, 0x2e, 0x35, 0x33, 0x33, 0x2e, 0x39, 0x4b, 0x57, 0x5b, 0x6d, 0x5b, 0x50, 0x4e, 0xae, 0xbf, 0xbb, 0x22, 0xf1, 0xe5, 0xe5, 0xe5, 0xe6, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf5, 0xe6, 0xf0, 0xf5, 0xe6, 0xe3, 0xbf, 0xb4, 0x5d, 0x49, 0x65, 0x5a, 0x5e, 0x62, 0x45, 0x35, 0x30, 0x38, 0x38, 0x38, 0x36, 0x36, 0x33, 0x33, 0x36, 0x33, 0x36, 0x30, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x32, 0x33, 0x33, 0x38, 0x38, 0x3a, 0x38, 0x38, 0x30, 0x3a, 0x36, 0x2d, 0x34, 0x32, 0x32, 0x32, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x38, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x35, 0x33, 0x35, 0x2e, 0x33, 0x33, 0x38, 0x38, 0x2e, 0x2f, 0x43, 0x4e, 0x5f, 0x6d, 0x5f, 0x5e, 0x4a, 0x6c, 0xad, 0xc1, 0xbb, 0x22, 0xe3, 0xf1, 0xf0, 0xf2, 0xe5, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf4, 0xf4, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe3, 0xf8, 0xef, 0xf5, 0xf5, 0xf0, 0xc0, 0xb8, 0x81, 0x46, 0x62, 0x5e, 0x5e, 0x63, 0x53, 0x48, 0x38, 0x38, 0x30, 0x33, 0x36, 0x32, 0x33, 0x32, 0x33, 0x2d, 0x34, 0x33, 0x34, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x32, 0x36, 0x36, 0x38, 0x3a, 0x33, 0x36, 0x35, 0x2d, 0x2d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0x33, 0x38, 0x33, 0x35, 0x32, 0x2f, 0x32, 0x35, 0x35, 0x35, 0x35, 0x38, 0x43, 0x4b, 0x5f, 0x5b, 0x5b, 0x54, 0x5e, 0x4d, 0x77, 0xb7, 0xc1, 0xe6, 0xbb, 0xe3, 0xf0, 0xf6, 0xf2, 0xf4, 0xf4, 0xf5, 0xf4, 0xe5, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xe6, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xe6, 0xf6, 0xe6, 0xf0, 0xf0, 0xbe, 0xbc, 0x99, 0x46, 0x5a, 0x5e, 0x5f, 0x67, 0x62, 0x48, 0x46, 0x35, 0x35, 0x35, 0x35, 0x33, 0x35, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x37, 0x33, 0x33, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x36, 0x32, 0x32, 0x32, 0x33, 0x2e, 0x3a, 0x36, 0x33, 0x2d, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x33, 0x32, 0x33, 0x34, 0x33, 0x34, 0x38, 0x34, 0x36, 0x33, 0x33, 0x35, 0x2f, 0x39, 0x2f, 0x2f, 0x3f, 0x4e, 0x59, 0x61, 0x61, 0x5b, 0x5b, 0x54, 0x43, 0x92, 0xba, 0xff, 0xbb, 0xf1, 0xe6, 0xf0, 0xf5, 0xf3, 0xf0, 0xf4, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe5, 0xe4, 0xe4, 0xf1, 0x22, 0xbf, 0xb4, 0x69, 0x46, 0x5e, 0x63, 0x5e, 0x5f, 0x5a, 0x54, 0x40, 0x39, 0x2f, 0x2e, 0x33, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0x33, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x33, 0x34, 0x33, 0x36, 0x33, 0x33, 0x36, 0x36, 0x33, 0x35, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x2e, 0x32, 0x2e, 0x34, 0x33, 0x33, 0x36, 0x33, 0x33, 0x30, 0x33, 0x30, 0x33, 0x33, 0x39, 0x2f, 0x40, 0x50, 0x5a, 0x5e, 0x5b, 0x5b, 0x61, 0x54, 0x4b, 0x6c, 0xaf, 0x24, 0x22, 0xf4, 0xf3, 0xe5, 0xf1, 0xe5, 0xf0, 0xf4, 0xf4, 0xf0, 0xf4, 0xf4, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe4, 0xe4, 0xe5, 0xf5, 0xbb, 0xbf, 0xba, 0xa2, 0x4d, 0x4d, 0x5a, 0x5f, 0x6c, 0x50, 0x5e, 0x50, 0x4a, 0x3c, 0x35, 0x2e, 0x33, 0x35, 0x36, 0x36, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x36, 0x33, 0x33, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x36, 0x36, 0x36, 0x38, 0x38, 0x38, 0x38, 0x35, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x33, 0x33, 0x35, 0x33, 0x35, 0x38, 0x35, 0x33, 0x33, 0x38, 0x33, 0x3f, 0x43, 0x53, 0x54, 0x5e, 0x5f, 0x5e, 0x54, 0x5e, 0x50, 0x45, 0x9e, 0xba, 0xc1, 0xbb, 0xe3, 0xf4, 0xe3, 0xe4, 0xe5, 0xf0, 0xf2, 0xf4, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe5, 0xe5, 0xe4, 0xe5, 0xf1, 0xf4, 0xbb, 0xbb, 0x24, 0xb5, 0x89, 0x4a, 0x53, 0x53, 0x5e, 0x5e, 0x5e, 0x65, 0x65, 0x51, 0x46, 0x39, 0x35, 0x2f, 0x35, 0x35, 0x3c, 0x35, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x34, 0x33, 0x32, 0x32, 0x32, 0x33, 0x33, 0x33, 0x38, 0x35, 0x38, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x2e, 0x2e, 0x35, 0x35, 0x2f, 0x35, 0x35, 0x3c, 0x45, 0x47, 0x5a, 0x63, 0x5f, 0x5f, 0x5f, 0x5f, 0x5a, 0x4e, 0x44, 0x81, 0xb4, 0x24, 0xbb, 0xb9, 0xf4, 0xf7, 0xf0, 0xe4, 0xe5, 0xe5, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf2, 0xe6, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf4, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf4, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf0, 0xe5, 0xf0, 0xe4, 0xf8, 0xe3, 0xc0, 0xbe, 0xb2, 0x7c, 0x55, 0x51, 0x53, 0x63, 0x5f, 0x5f, 0x67, 0x67, 0x5a, 0x4e, 0x43, 0x39, 0x2f, 0x2e, 0x2e, 0x2d, 0x2e, 0x37, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x37, 0x32, 0x32, 0x32, 0x32, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x32, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x33, 0x2e, 0x35, 0x35, 0x35, 0x35, 0x39, 0x40, 0x47, 0x4e, 0x54, 0x5f, 0x5f, 0x5b, 0x61, 0x5f, 0x57, 0x47, 0x4e, 0x7c, 0xb0, 0xc0, 0xbe, 0xf1, 0xf7, 0xf3, 0xe3, 0xf0, 0xe3, 0xf0, 0xe6, 0xe5, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xe6, 0xe5, 0xe5, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf2, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xe5, 0xf2, 0xe4, 0xe4, 0xe4, 0xe4, 0xe3, 0xe6, 0xc1, 0xbd, 0xb4, 0x7c, 0x4e, 0x4b, 0x59, 0x61, 0x5f, 0x61, 0x5e, 0x5e, 0x5a, 0x59, 0x4a, 0x45, 0x3c, 0x2e, 0x2e, 0x2d, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x33, 0x32, 0x33, 0x32, 0x32, 0x32, 0x32, 0x33, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x3c, 0x40, 0x4a, 0x50, 0x62, 0x5e, 0x5f, 0x5b, 0x61, 0x5b, 0x61, 0x57, 0x4b, 0x46, 0x80, 0x19, 0xbd, 0xbe, 0xe6, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0x22, 0xe6, 0xe5, 0xf1, 0xf1, 0xf1, 0xf5, 0xf1, 0xf1, 0xe5, 0xe5, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf4, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf4, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xe5, 0xe5, 0xf2, 0xf0, 0x22, 0xbe, 0xc1, 0xb5, 0x99, 0x62, 0x4d, 0x51, 0x53, 0x65, 0x5e, 0x5f, 0x63, 0x61, 0x64, 0x57, 0x57, 0x4a, 0x40, 0x40, 0x35, 0x2f, 0x2f, 0x35, 0x35, 0x33, 0x35, 0x36, 0x36, 0x36, 0x35, 0x35, 0x33, 0x35, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x36, 0x2d, 0x32, 0x2d, 0x32, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x36, 0x32, 0x33, 0x32, 0x36, 0x36, 0x36, 0x2f, 0x2e, 0x2f, 0x35, 0x40, 0x43, 0x47, 0x57, 0x5e, 0x5b, 0x63, 0x5b, 0x61, 0x54, 0x61, 0x5f, 0x5f, 0x50, 0x4b, 0x62, 0x99, 0xb7, 0xbf, 0xc0, 0x22, 0xf1, 0xf1, 0xf2, 0xe4, 0xf2, 0xf3, 0xe5, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xe5, 0xe5, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xe5, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf7, 0xef, 0xe6, 0xc1, 0xc0, 0xb8, 0xab, 0x81, 0x49, 0x45, 0x51, 0x59, 0x5f, 0x5c, 0x61, 0x5b, 0x5f, 0x5e, 0x53, 0x4d, 0x53, 0x4e, 0x45, 0x44, 0x39, 0x35, 0x35, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x35, 0x36, 0x35, 0x33, 0x35, 0x33, 0x36, 0x33, 0x35, 0x36, 0x35, 0x35, 0x35, 0x2f, 0x2e, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x35, 0x2f, 0x39, 0x3f, 0x45, 0x4e, 0x51, 0x5e, 0x5f, 0x5e, 0x57, 0x57, 0x4f, 0x6d, 0x57, 0x54, 0x5b, 0x50, 0x46, 0x43, 0x77, 0xad, 0xba, 0xbf, 0xc1, 0x22, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe5, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf2, 0xe5, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf2, 0xe5, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf2, 0xe5, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xe5, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf6, 0xe3, 0xf6, 0xf5, 0xb9, 0xbb, 0xbd, 0xbf, 0xc1, 0xba, 0xae, 0x8e, 0x55, 0x4d, 0x48, 0x4a, 0x65, 0x62, 0x50, 0x6c, 0x65, 0x53, 0x62, 0x5e, 0x5a, 0x62, 0x5a, 0x5a, 0x51, 0x4e, 0x4a, 0x47, 0x45, 0x43, 0x3c, 0x39, 0x39, 0x39, 0x2f, 0x35, 0x2f, 0x2f, 0x2f, 0x2f, 0x35, 0x2f, 0x39, 0x3c, 0x40, 0x43, 0x45, 0x43, 0x45, 0x51, 0x53, 0x62, 0x5e, 0x65, 0x5f, 0x65, 0x63, 0x5f, 0x57, 0x5f, 0x5b, 0x5e, 0x67, 0x53, 0x43, 0x51, 0x55, 0x7c, 0xab, 0xb8, 0x24, 0xc0, 0x22, 0x22, 0xe6, 0xe6, 0xe3, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xe5, 0xf3, 0xf0, 0xf3, 0xf0, 0xf7, 0xf4, 0xf5, 0x22, 0xff, 0xbb, 0xbf, 0xbd, 0xb8, 0xb2, 0x9d, 0x79, 0x49, 0x46, 0x4e, 0x4f, 0x54, 0x57, 0x5b, 0x5e, 0x63, 0x5e, 0x5e, 0x5e, 0x65, 0x65, 0x65, 0x65, 0x62, 0x5e, 0x5a, 0x62, 0x5e, 0x62, 0x62, 0x5a, 0x62, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5e, 0x65, 0x5e, 0x65, 0x5e, 0x6c, 0x5f, 0x65, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5b, 0x57, 0x5b, 0x5b, 0x57, 0x57, 0x4f, 0x46, 0x51, 0x81, 0xac, 0xb5, 0xbe, 0xc0, 0xbe, 0x22, 0xb9, 0xe6, 0xe3, 0xe3, 0xe5, 0xe7, 0xe3, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe3, 0xf7, 0xf2, 0xf0, 0xf0, 0xe3, 0xf3, 0xf0, 0xef, 0xf7, 0xbb, 0xbb, 0x22, 0xf7, 0xfb, 0xc1, 0xb8, 0xb4, 0xa9, 0x7b, 0x73, 0x6e, 0x61, 0x5c, 0x4f, 0x57, 0x57, 0x57, 0x5c, 0x57, 0x5b, 0x5b, 0x5f, 0x5f, 0x63, 0x5f, 0x63, 0x5e, 0x63, 0x65, 0x63, 0x5e, 0x63, 0x5f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x61, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x66, 0x6e, 0x6e, 0x7b, 0x82, 0x83, 0xad, 0xc1, 0x24, 0xc0, 0xf8, 0xf1, 0xf0, 0xe3, 0xf6, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe5, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xe6, 0xf1, 0xe6, 0xf4, 0xf2, 0xe5, 0xf2, 0xe4, 0xf0, 0xf4, 0xf2, 0xf0, 0xe4, 0xf0, 0xe6, 0xbd, 0xbc, 0x9e, 0x91, 0x91, 0x8b, 0x8f, 0x87, 0x82, 0x78, 0x76, 0x6e, 0x66, 0x5b, 0x61, 0x61, 0x5b, 0x5b, 0x57, 0x57, 0x61, 0x5f, 0x66, 0x5f, 0x63, 0x66, 0x63, 0x61, 0x61, 0x61, 0x66, 0x5c, 0x61, 0x5c, 0x61, 0x5c, 0x61, 0x66, 0x6e, 0x6e, 0x76, 0x78, 0x82, 0x8a, 0x8b, 0x8b, 0x8f, 0x8b, 0x8c, 0x8c, 0x97, 0xba, 0xbc, 0xe6, 0xf0, 0xe4, 0xf2, 0xf6, 0xf0, 0xf1, 0xe5, 0xf0, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xe6, 0xe6, 0xe6, 0xf1, 0xe6, 0xf1, 0xe5, 0xf2, 0xe5, 0xf2, 0xf2, 0xf0, 0xe4, 0xf6, 0xe4, 0xbb, 0xbd, 0xa3, 0x8c, 0x87, 0x87, 0x87, 0x8b, 0x91, 0x8b, 0x91, 0x91, 0x8f, 0x8b, 0x8b, 0x82, 0x7f, 0x78, 0x76, 0x76, 0x6e, 0x6d, 0x66, 0x61, 0x66, 0x66, 0x66, 0x64, 0x66, 0x6e, 0x76, 0x76, 0x76, 0x78, 0x7b, 0x82, 0x82, 0x88, 0x8b, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8b, 0x88, 0x8a, 0x8b, 0x8b, 0x8b, 0x8c, 0x75, 0xad, 0xc1, 0xf0, 0xf6, 0xe4, 0xf0, 0xf4, 0xf2, 0xf4, 0xf1, 0xf0, 0xf5, 0xf0, 0xbb, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xf1, 0xf1, 0xf2, 0xf1, 0xf3, 0xf0, 0xe4, 0xf0, 0xf0, 0xf0, 0xbf, 0xaf, 0x80, 0x86, 0x8a, 0x8b, 0x8a, 0x8b, 0x8a, 0x8b, 0x8b, 0x88, 0x8b, 0x8b, 0x8b, 0x8f, 0x91, 0x8f, 0x91, 0x8f, 0x91, 0x91, 0x8f, 0x8f, 0x8c, 0x8f, 0x88, 0x8c, 0x8b, 0x8f, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x88, 0x87, 0x87, 0x87, 0x88, 0x87, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8b, 0x86, 0x8e, 0xb7, 0x22, 0xf3, 0xf0, 0xf4, 0xf1, 0xf4, 0xf1, 0xf4, 0xbb, 0xf0, 0xbb, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xe6, 0xe6, 0xe6, 0xe6, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xe3, 0xf7, 0xf0, 0xbb, 0xbf, 0xb8, 0x8e, 0x86, 0x88, 0x87, 0x8a, 0x88, 0x87, 0x87, 0x8b, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87, 0x88, 0x8b, 0x8b, 0x88, 0x88, 0x8b, 0x8f, 0x8f, 0x8f, 0x8f, 0x91, 0x8f, 0x8c, 0x88, 0x88, 0x88, 0x87, 0x88, 0x82, 0x87, 0x87, 0x88, 0x8b, 0x8b, 0x8b, 0x88, 0x88, 0x87, 0x88, 0x8b, 0x87, 0x8a, 0x8a, 0x8a, 0x88, 0x80, 0xad, 0xc1, 0xff, 0xe3, 0xf4, 0xf1, 0xf5, 0xf1, 0xf1, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xe4, 0xf2, 0xe4, 0xf2, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf0, 0xf5, 0xf0, 0xbd, 0xbf, 0xa9, 0x80, 0x88, 0x87, 0x8a, 0x8a, 0x87, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x88, 0x88, 0x87, 0x88, 0x88, 0x87, 0x87, 0x88, 0x88, 0x8b, 0x82, 0x7b, 0x7b, 0x76, 0x73, 0x73, 0x7b, 0x82, 0x82, 0x82, 0x88, 0x88, 0x87, 0x82, 0x88, 0x87, 0x87, 0x82, 0x87, 0x82, 0x82, 0x88, 0x88, 0x8b, 0x88, 0x8a, 0x8a, 0x8a, 0x87, 0x8a, 0x86, 0x80, 0xb8, 0xbd, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe4, 0xf0, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xe5, 0xf1, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xbb, 0xbd, 0xb7, 0x8e, 0x82, 0x88, 0x87, 0x8a, 0x8a, 0x88, 0x8b, 0x88, 0x87, 0x87, 0x88, 0x8b, 0x88, 0x87, 0x82, 0x8c, 0x8c, 0x82, 0x7b, 0x6d, 0x66, 0x5b, 0x5b, 0x4f, 0x4f, 0x50, 0x4f, 0x54, 0x57, 0x5f, 0x70, 0x70, 0x7f, 0x82, 0x8c, 0x88, 0x82, 0x88, 0x87, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x87, 0x8b, 0x8a, 0x8a, 0x8a, 0x8c, 0x80, 0xad, 0xbc, 0xbd, 0xe5, 0xf0, 0xe4, 0xf4, 0xf0, 0xe5, 0xf0, 0xe5, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf1, 0xf1, 0xf2, 0xf0, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf4, 0xf2, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xbb, 0xc1, 0xa9, 0x7f, 0x82, 0x87, 0x87, 0x8a, 0x87, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x82, 0x82, 0x88, 0x82, 0x7b, 0x6d, 0x54, 0x4f, 0x4f, 0x54, 0x57, 0x54, 0x5b, 0x54, 0x57, 0x57, 0x54, 0x57, 0x54, 0x4f, 0x54, 0x54, 0x5f, 0x5f, 0x7f, 0x7f, 0x8c, 0x88, 0x82, 0x87, 0x87, 0x87, 0x82, 0x88, 0x87, 0x87, 0x87, 0x8a, 0x8a, 0x87, 0x8a, 0x83, 0x8c, 0xb8, 0x22, 0xe3, 0xe4, 0xf3, 0xf3, 0xf2, 0xf0, 0xe6, 0xf0, 0xe4, 0xf0, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf4, 0xf1, 0xf1, 0xe6, 0xf1, 0xe6, 0xe6, 0xe6, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf4, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf4, 0xf0, 0xf6, 0xf0, 0xbb, 0xbc, 0x83, 0x80, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x87, 0x88, 0x8f, 0x82, 0x73, 0x5b, 0x4f, 0x4f, 0x54, 0x57, 0x5b, 0x57, 0x57, 0x57, 0x57, 0x57, 0x53, 0x54, 0x5a, 0x54, 0x54, 0x57, 0x54, 0x57, 0x4f, 0x54, 0x4b, 0x54, 0x6d, 0x76, 0x82, 0x82, 0x88, 0x88, 0x87, 0x88, 0x88, 0x87, 0x87, 0x87, 0x8a, 0x87, 0x8f, 0x88, 0x80, 0xad, 0xbf, 0xf0, 0xf2, 0xf3, 0xf0, 0xf3, 0xf1, 0xe3, 0xe6, 0xf0, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xe6, 0xe6, 0xe5, 0xe5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xe4, 0xf0, 0xc1, 0xaf, 0x7b, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x7b, 0x66, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x57, 0x57, 0x50, 0x57, 0x57, 0x57, 0x54, 0x57, 0x54, 0x54, 0x54, 0x54, 0x54, 0x5b, 0x54, 0x54, 0x57, 0x57, 0x54, 0x50, 0x4b, 0x50, 0x57, 0x70, 0x76, 0x82, 0x82, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x87, 0x8a, 0x82, 0x8f, 0x80, 0x97, 0xbc, 0x22, 0xe3, 0xf6, 0xf3, 0xf0, 0xe6, 0xe6, 0xf0, 0xe4, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf4, 0xf1, 0xf1, 0xf1, 0xe5, 0xe5, 0xe5, 0xe4, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xe4, 0xf2, 0xbf, 0x9e, 0x7f, 0x87, 0x87, 0x8a, 0x87, 0x87, 0x88, 0x88, 0x88, 0x7f, 0x76, 0x63, 0x4f, 0x4f, 0x57, 0x59, 0x57, 0x57, 0x4f, 0x54, 0x4f, 0x5b, 0x57, 0x57, 0x5a, 0x57, 0x5a, 0x50, 0x54, 0x50, 0x54, 0x54, 0x57, 0x54, 0x54, 0x4f, 0x54, 0x50, 0x53, 0x50, 0x50, 0x4b, 0x4b, 0x4b, 0x5b, 0x6c, 0x7f, 0x7f, 0x86, 0x88, 0x86, 0x87, 0x87, 0x87, 0x87, 0x88, 0x86, 0xb2, 0x22, 0xf1, 0xf3, 0xf0, 0xf2, 0xf0, 0xe6, 0xf0, 0xe5, 0xf0, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf0, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf0, 0xf4, 0xf1, 0xf1, 0xf1, 0xe5, 0xe5, 0xe4, 0xf2, 0xf0, 0xe6, 0xf0, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf3, 0xf7, 0xb5, 0x83, 0x82, 0x87, 0x85, 0x87, 0x87, 0x8c, 0x86, 0x7b, 0x66, 0x57, 0x4f, 0x4f, 0x54, 0x5a, 0x54, 0x53, 0x4f, 0x57, 0x5b, 0x57, 0x57, 0x54, 0x53, 0x5a, 0x53, 0x4e, 0x4e, 0x50, 0x5a, 0x53, 0x53, 0x54, 0x5a, 0x54, 0x50, 0x54, 0x50, 0x53, 0x4a, 0x50, 0x54, 0x50, 0x54, 0x4b, 0x47, 0x43, 0x4b, 0x54, 0x70, 0x7f, 0x8c, 0x8c, 0x88, 0x88, 0x87, 0x86, 0x82, 0xab, 0xbe, 0x22, 0xe3, 0xf0, 0xe5, 0xf0, 0xe6, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf5, 0xf1, 0xf0, 0xf5, 0xf5, 0xf4, 0xf7, 0xf5, 0xf8, 0xe3, 0xf5, 0xe3, 0xf6, 0xf3, 0xf2, 0xf1, 0xf1, 0xf5, 0xe3, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xe3, 0xfc, 0xad, 0x83, 0x7b, 0x82, 0x87, 0x88, 0x86, 0x6c, 0x54, 0x43, 0x47, 0x4b, 0x4e, 0x4b, 0x4b, 0x4b, 0x4e, 0x50, 0x53, 0x54, 0x59, 0x53, 0x5a, 0x53, 0x5a, 0x53, 0x40, 0x39, 0x39, 0x51, 0x51, 0x4a, 0x40, 0x40, 0x4e, 0x50, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x50, 0x50, 0x4e, 0x4b, 0x4a, 0x45, 0x47, 0x43, 0x43, 0x4e, 0x6d, 0x7b, 0x82, 0x88, 0x8c, 0x86, 0x8e, 0xba, 0xbd, 0xf0, 0xf2, 0xe4, 0xe5, 0xe3, 0xe5, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf1, 0xf1, 0xf5, 0xe3, 0x22, 0xbb, 0xbb, 0xef, 0xb7, 0x22, 0xfb, 0xfb, 0xef, 0x22, 0xf6, 0xf1, 0xf1, 0xe6, 0xf5, 0xf0, 0xf0, 0xe6, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0x24, 0x89, 0x7f, 0x8c, 0x88, 0x7e, 0x67, 0x47, 0x43, 0x45, 0x47, 0x4b, 0x4a, 0x47, 0x43, 0x47, 0x47, 0x4e, 0x50, 0x54, 0x5a, 0x50, 0x53, 0x4b, 0x45, 0x4a, 0x3f, 0x2f, 0x29, 0x35, 0x3f, 0x3f, 0x2f, 0x2f, 0x2f, 0x45, 0x51, 0x5a, 0x4e, 0x4e, 0x51, 0x53, 0x53, 0x50, 0x50, 0x50, 0x50, 0x4a, 0x45, 0x45, 0x40, 0x43, 0x45, 0x46, 0x39, 0x39, 0x47, 0x5e, 0x7b, 0x86, 0x8e, 0xb5, 0xbd, 0xf5, 0xf2, 0xe3, 0xe5, 0xe6, 0xf0, 0xf0, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf5, 0xe3, 0xe6, 0xf1, 0xf8, 0xae, 0x52, 0xc4, 0x3e, 0xc5, 0x99, 0xb6, 0xfd, 0xff, 0x22, 0xf1, 0xf5, 0xf0, 0xf0, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf4, 0xbd, 0xb8, 0x80, 0x75, 0x6c, 0x43, 0x3f, 0x3a, 0x3f, 0x40, 0x39, 0x3f, 0x3f, 0x3f, 0x45, 0x4a, 0x47, 0x4e, 0x53, 0x50, 0x4e, 0x4a, 0x4e, 0x4a, 0x39, 0x2f, 0x2f, 0x2e, 0x2e, 0x35, 0x32, 0x2e, 0x2e, 0x2e, 0x35, 0x3c, 0x2e, 0x3c, 0x3c, 0x2e, 0x2e, 0x39, 0x4a, 0x50, 0x4e, 0x50, 0x4b, 0x4e, 0x45, 0x40, 0x3c, 0x3f, 0x3c, 0x3a, 0x3a, 0x3f, 0x43, 0x39, 0x2f, 0x39, 0x39, 0x55, 0xab, 0xc0, 0x22, 0xf0, 0xe4, 0xe5, 0xe3, 0xe6, 0xf0, 0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf4, 0xe6, 0xf0, 0xf1, 0xfb, 0x13, 0x2b, 0x2b, 0x33, 0x34, 0x34, 0xc3, 0x25, 0x52, 0xb0, 0xbe, 0xff, 0xf1, 0xe6, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf0, 0xf2, 0xf4, 0xf0, 0x24, 0xab, 0x2f, 0x40, 0x39, 0x3f, 0x3a, 0x38, 0x36, 0x35, 0x35, 0x36, 0x3c, 0x3c, 0x39, 0x40, 0x4a, 0x53, 0x54, 0x4b, 0x43, 0x40, 0x4e, 0x4a, 0x2f, 0x35, 0x2e, 0x2e, 0x32, 0x32, 0x2d, 0x2e, 0x30, 0x33, 0x2e, 0x2e, 0x2d, 0x33, 0x35, 0x33, 0x2f, 0x35, 0x39, 0x4a, 0x4e, 0x50, 0x4e, 0x50, 0x45, 0x3c, 0x35, 0x39, 0x3b, 0x3a, 0x3b, 0x36, 0x3b, 0x39, 0x39, 0x39, 0x40, 0x29, 0x77, 0xbb, 0x22, 0xf0, 0xe5, 0xe3, 0xe5, 0xf0, 0xf4, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf3, 0xf0, 0xf2, 0xf4, 0xf0, 0xf0, 0xf1, 0xbe, 0xf5, 0x68, 0x28, 0x3b, 0x3b, 0x36, 0x32, 0x37, 0x34, 0x2b, 0x2c, 0x89, 0xef, 0xfa, 0xef, 0xe6, 0xf5, 0xe6, 0xf1, 0xf1, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf1, 0xf5, 0xe6, 0xf2, 0xbb, 0x77, 0x2b, 0x39, 0x39, 0x3b, 0x36, 0x30, 0x36, 0x2f, 0x32, 0x2e, 0x33, 0x35, 0x3c, 0x40, 0x4e, 0x51, 0x4e, 0x43, 0x39, 0x43, 0x55, 0x3f, 0x2d, 0x2e, 0x33, 0x2d, 0x2d, 0x32, 0x31, 0x2d, 0x2d, 0x33, 0x30, 0x2d, 0x33, 0x2e, 0x30, 0x36, 0x33, 0x35, 0x39, 0x46, 0x4a, 0x4a, 0x50, 0x51, 0x4a, 0x3c, 0x39, 0x3a, 0x2f, 0x33, 0x33, 0x3a, 0x35, 0x35, 0x3c, 0x39, 0x33, 0x2e, 0x41, 0xb4, 0xc1, 0xe3, 0xe3, 0xe4, 0xe5, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf8, 0xe3, 0x3e, 0x34, 0x29, 0x3b, 0x2e, 0x36, 0x3b, 0x3c, 0x37, 0x38, 0x25, 0x4c, 0xee, 0xfb, 0x22, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf4, 0xf4, 0xf0, 0xf4, 0xf1, 0xf4, 0xf1, 0xf5, 0xe3, 0xe8, 0xb5, 0x49, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x39, 0x39, 0x43, 0x51, 0x5a, 0x45, 0x39, 0x39, 0x4a, 0x4d, 0x35, 0x2e, 0x32, 0x2d, 0x30, 0x2d, 0x2d, 0x2d, 0x33, 0x33, 0x2d, 0x33, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x33, 0x3c, 0x49, 0x40, 0x40, 0x51, 0x4e, 0x4e, 0x3c, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x35, 0x3a, 0x3a, 0xac, 0xbd, 0xf6, 0xf0, 0xe4, 0xf0, 0xf1, 0xbb, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xf5, 0xf7, 0xf0, 0x68, 0x25, 0x44, 0x2d, 0x3b, 0x36, 0x35, 0x36, 0x36, 0x3a, 0x3b, 0x28, 0x79, 0xb9, 0xbd, 0xe3, 0xf2, 0xf4, 0xf2, 0xf4, 0xf1, 0xf1, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf0, 0xf7, 0xe3, 0xc7, 0xab, 0x2d, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x35, 0x36, 0x39, 0x44, 0x5a, 0x5a, 0x40, 0x39, 0x45, 0x51, 0x44, 0x2f, 0x33, 0x2e, 0x32, 0x2d, 0x34, 0x2d, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x33, 0x35, 0x49, 0x46, 0x2f, 0x51, 0x51, 0x4a, 0x3c, 0x35, 0x3a, 0x33, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x36, 0x2e, 0x29, 0xa2, 0x24, 0xe3, 0xf0, 0xe4, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xfc, 0xed, 0x6b, 0x25, 0x37, 0x3b, 0x36, 0x35, 0x35, 0x3a, 0x3b, 0x36, 0x36, 0x26, 0x99, 0x24, 0xf1, 0xf4, 0xf2, 0xf4, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf0, 0xe5, 0xf2, 0xe5, 0xf7, 0xe3, 0xf5, 0xc7, 0x81, 0x28, 0x3b, 0x36, 0x3b, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x35, 0x35, 0x40, 0x51, 0x5a, 0x39, 0x2f, 0x51, 0x4d, 0x35, 0x2e, 0x2e, 0x30, 0x2d, 0x30, 0x2d, 0x2d, 0x33, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x33, 0x2e, 0x44, 0x4a, 0x2f, 0x4e, 0x51, 0x46, 0x39, 0x3a, 0x35, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x3f, 0x29, 0x7c, 0xc0, 0xbd, 0xe6, 0xf0, 0xe4, 0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf5, 0xf1, 0xf7, 0xe3, 0xe3, 0xfb, 0xae, 0x2b, 0x2d, 0x33, 0x35, 0x38, 0x35, 0x36, 0x3a, 0x3b, 0x3b, 0x33, 0x26, 0xb1, 0xbe, 0xf1, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe6, 0xf1, 0xe5, 0xe5, 0xe5, 0xf0, 0xe6, 0xf0, 0xc7, 0xb9, 0x68, 0x29, 0x33, 0x2e, 0x37, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x35, 0x39, 0x51, 0x51, 0x39, 0x39, 0x51, 0x45, 0x2e, 0x2f, 0x2e, 0x33, 0x2d, 0x34, 0x30, 0x2d, 0x33, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x33, 0x2d, 0x3c, 0x4a, 0x39, 0x4d, 0x51, 0x44, 0x3c, 0x35, 0x38, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x3b, 0x99, 0xb3, 0xfd, 0xf1, 0xf0, 0xf0, 0xf3, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf5, 0xf1, 0xfb, 0xb1, 0x28, 0x2d, 0x33, 0x36, 0x36, 0x35, 0x3a, 0x3a, 0x36, 0x36, 0x33, 0x30, 0x68, 0xbb, 0x22, 0xf4, 0xf0, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe6, 0xe3, 0xe6, 0xe5, 0xe4, 0xf7, 0xf1, 0xc7, 0xb1, 0x7a, 0x3b, 0x36, 0x36, 0x33, 0x37, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2f, 0x49, 0x5a, 0x39, 0x3f, 0x51, 0x3f, 0x2e, 0x33, 0x2d, 0x2d, 0x30, 0x30, 0x33, 0x30, 0x33, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x33, 0x2d, 0x2e, 0x35, 0x4d, 0x3f, 0x4a, 0x51, 0x3f, 0x35, 0x35, 0x35, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x35, 0x2d, 0x55, 0x41, 0x28, 0xac, 0xbe, 0xf1, 0xf0, 0xf3, 0xf0, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf7, 0xe3, 0xf1, 0xf1, 0xf1, 0x22, 0xaa, 0x2c, 0x3b, 0x36, 0x35, 0x35, 0x36, 0x3a, 0x3b, 0x3b, 0x37, 0x37, 0x26, 0xaa, 0xc1, 0xf0, 0xf6, 0xf0, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe3, 0xf8, 0xe5, 0xe5, 0xe5, 0xe6, 0xeb, 0xec, 0x34, 0x3e, 0x44, 0x30, 0x2e, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x33, 0x36, 0x36, 0x33, 0x35, 0x35, 0x2e, 0x45, 0x55, 0x3f, 0x40, 0x51, 0x3c, 0x2e, 0x2e, 0x36, 0x2d, 0x30, 0x2d, 0x30, 0x33, 0x33, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2d, 0x33, 0x2e, 0x45, 0x3f, 0x45, 0x4d, 0x3c, 0x35, 0x36, 0x33, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x35, 0x49, 0x60, 0x35, 0x26, 0xa7, 0xfd, 0xf0, 0xf3, 0xe4, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xe6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xf1, 0xf5, 0xf5, 0x22, 0x22, 0x6b, 0x26, 0x41, 0x35, 0x35, 0x3c, 0x36, 0x3a, 0x35, 0x35, 0x3b, 0x2b, 0x60, 0xff, 0xbb, 0xf7, 0xf0, 0xe4, 0xe6, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf5, 0xe6, 0xe3, 0xe8, 0xf6, 0xff, 0xdf, 0xc2, 0x30, 0x55, 0x41, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x35, 0x36, 0x4a, 0x46, 0x3f, 0x51, 0x33, 0x2e, 0x2d, 0x34, 0x2d, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x33, 0x2d, 0x33, 0x2e, 0x4d, 0x3f, 0x4a, 0x45, 0x35, 0x35, 0x35, 0x3a, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x35, 0x35, 0x4a, 0x69, 0x4a, 0x29, 0xc3, 0xac, 0xf8, 0xf3, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xf1, 0xf7, 0x22, 0xfb, 0xfe, 0x28, 0x2d, 0x36, 0x35, 0x35, 0x3a, 0x36, 0x35, 0x44, 0x2e, 0x42, 0xc3, 0xb3, 0xc0, 0xf0, 0xf7, 0xe4, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf5, 0xf1, 0xf6, 0xe6, 0xfa, 0x84, 0xc3, 0x28, 0x3c, 0x62, 0x41, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x36, 0x33, 0x33, 0x3b, 0x2e, 0x3f, 0x4d, 0x40, 0x4d, 0x35, 0x2d, 0x2d, 0x33, 0x30, 0x30, 0x2d, 0x33, 0x33, 0x33, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2d, 0x33, 0x2e, 0x4d, 0x3f, 0x4d, 0x3f, 0x2f, 0x35, 0x38, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x35, 0x4a, 0x6c, 0x53, 0x39, 0x2f, 0x3e, 0xb6, 0xfa, 0xef, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xf1, 0xf5, 0xf5, 0xf1, 0x22, 0xae, 0x31, 0x36, 0x35, 0x35, 0x3a, 0x3a, 0x3a, 0x3b, 0x39, 0x33, 0x42, 0x26, 0xa2, 0xc1, 0xf1, 0xe6, 0xe5, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xe3, 0xf5, 0xfa, 0xa8, 0xc2, 0x25, 0x32, 0x51, 0x62, 0x3f, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x33, 0x33, 0x32, 0x36, 0x2e, 0x36, 0x43, 0x43, 0x4a, 0x36, 0x2e, 0x30, 0x34, 0x2d, 0x33, 0x30, 0x38, 0x33, 0x2e, 0x30, 0x33, 0x30, 0x33, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x36, 0x2e, 0x4d, 0x44, 0x45, 0x35, 0x35, 0x35, 0x33, 0x35, 0x36, 0x36, 0x36, 0x36, 0x33, 0x36, 0x33, 0x36, 0x33, 0x3a, 0x2f, 0x4a, 0x6c, 0x54, 0x4a, 0x39, 0x28, 0x7a, 0xfc, 0xf6, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf5, 0xf1, 0xf5, 0xf5, 0xf0, 0xf7, 0xee, 0x52, 0x29, 0x35, 0x35, 0x35, 0x3a, 0x3a, 0x2e, 0x3c, 0x41, 0x38, 0x2c, 0x79, 0xbd, 0x22, 0xe6, 0xe6, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xf7, 0xfa, 0xed, 0xc9, 0xc3, 0x2b, 0x3f, 0x5a, 0x5e, 0x44, 0x2e, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x35, 0x3c, 0x45, 0x4a, 0x41, 0x2e, 0x2d, 0x34, 0x2d, 0x30, 0x30, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x2d, 0x33, 0x30, 0x2e, 0x30, 0x33, 0x33, 0x2d, 0x36, 0x2e, 0x4d, 0x3f, 0x45, 0x2f, 0x35, 0x36, 0x35, 0x33, 0x36, 0x35, 0x36, 0x35, 0x36, 0x36, 0x36, 0x35, 0x36, 0x36, 0x35, 0x45, 0x6c, 0x5f, 0x4b, 0x40, 0x2e, 0x3e, 0xb1, 0xff, 0xf0, 0xf4, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xe6, 0xf4, 0xf6, 0xfb, 0xb1, 0x52, 0x2d, 0x35, 0x35, 0x35, 0x3c, 0x36, 0x3c, 0x3b, 0x3a, 0x35, 0x30, 0x6b, 0xbb, 0x22, 0xe3, 0xf7, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xf5, 0xf1, 0xeb, 0x7a, 0xc2, 0x2b, 0x29, 0x4a, 0x53, 0x5e, 0x46, 0x33, 0x36, 0x33, 0x3a, 0x30, 0x36, 0x33, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x41, 0x4d, 0x44, 0x2d, 0x32, 0x2d, 0x2d, 0x32, 0x2d, 0x33, 0x2e, 0x33, 0x2d, 0x2d, 0x32, 0x2d, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x35, 0x2e, 0x44, 0x49, 0x49, 0x2e, 0x35, 0x33, 0x35, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x36, 0x43, 0x6d, 0x5b, 0x4b, 0x43, 0x35, 0x26, 0x84, 0xbe, 0xf0, 0xf7, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf8, 0x22, 0x79, 0x28, 0x35, 0x35, 0x35, 0x35, 0x3b, 0x38, 0x3a, 0x3b, 0x39, 0x29, 0x60, 0xbb, 0xff, 0xf5, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xe3, 0xff, 0xe1, 0xc2, 0x27, 0x28, 0x2f, 0x4e, 0x5a, 0x5e, 0x45, 0x35, 0x36, 0x36, 0x36, 0x33, 0x33, 0x36, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x33, 0x36, 0x49, 0x49, 0x2e, 0x2d, 0x2d, 0x32, 0x31, 0x2d, 0x30, 0x2e, 0x33, 0x2d, 0x32, 0x2e, 0x32, 0x2d, 0x33, 0x33, 0x33, 0x2d, 0x33, 0x2e, 0x2f, 0x44, 0x45, 0x3c, 0x35, 0x2e, 0x32, 0x2e, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x43, 0x70, 0x5f, 0x4f, 0x4b, 0x39, 0x2e, 0x2c, 0xb6, 0xf7, 0xf0, 0xf0, 0xf6, 0xf0, 0xf2, 0xe5, 0xf1, 0xe5, 0xe6, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf4, 0xf0, 0xf4, 0xf4, 0xf0, 0xf1, 0xc0, 0x99, 0x26, 0x33, 0x35, 0x35, 0x36, 0x36, 0x3a, 0x3a, 0x35, 0x35, 0x29, 0x52, 0xb8, 0xf5, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xe6, 0xf9, 0xe0, 0xc2, 0x27, 0x29, 0x3b, 0x53, 0x54, 0x5a, 0x4e, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x2e, 0x33, 0x41, 0x49, 0x35, 0x2d, 0x2d, 0x2d, 0x30, 0x2d, 0x33, 0x2e, 0x33, 0x2d, 0x2d, 0x30, 0x2d, 0x30, 0x33, 0x30, 0x33, 0x33, 0x33, 0x2e, 0x3c, 0x45, 0x41, 0x35, 0x33, 0x35, 0x33, 0x35, 0x2e, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x33, 0x43, 0x70, 0x5b, 0x54, 0x50, 0x3c, 0x33, 0xc3, 0x13, 0xc7, 0xf1, 0xe3, 0xf7, 0xe3, 0xf4, 0xe5, 0xe6, 0xe6, 0xf1, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf3, 0xf5, 0xc0, 0xb3, 0x2d, 0x2e, 0x36, 0x35, 0x3b, 0x36, 0x38, 0x3b, 0x35, 0x35, 0x29, 0x68, 0xb9, 0xf7, 0xf5, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf7, 0xb9, 0xc4, 0xc2, 0x2c, 0x2d, 0x45, 0x53, 0x53, 0x5e, 0x51, 0x2e, 0x3a, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x36, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x36, 0x33, 0x33, 0x2e, 0x36, 0x41, 0x41, 0x2d, 0x33, 0x2d, 0x2d, 0x33, 0x30, 0x2e, 0x30, 0x2e, 0x34, 0x2d, 0x30, 0x2d, 0x36, 0x33, 0x33, 0x33, 0x33, 0x35, 0x44, 0x44, 0x3c, 0x2e, 0x35, 0x32, 0x2e, 0x33, 0x33, 0x36, 0x33, 0x35, 0x33, 0x35, 0x36, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x43, 0x70, 0x5f, 0x57, 0x4b, 0x45, 0x35, 0x2b, 0x52, 0xef, 0x22, 0xe6, 0xf1, 0xf1, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xef, 0x24, 0xb0, 0x26, 0x33, 0x33, 0x36, 0x36, 0x3a, 0x33, 0x3a, 0x35, 0x2f, 0x29, 0x71, 0x22, 0x22, 0xf4, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf3, 0xf0, 0xf3, 0xf0, 0xf4, 0xf3, 0xf2, 0xf3, 0xf1, 0xfb, 0xfe, 0xc2, 0x27, 0x2c, 0x2d, 0x4a, 0x53, 0x54, 0x5e, 0x5a, 0x2e, 0x3b, 0x35, 0x33, 0x37, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x36, 0x2e, 0x36, 0x41, 0x33, 0x2e, 0x2d, 0x33, 0x30, 0x2e, 0x30, 0x33, 0x30, 0x30, 0x30, 0x2d, 0x30, 0x33, 0x30, 0x33, 0x33, 0x33, 0x3c, 0x45, 0x44, 0x2e, 0x35, 0x33, 0x35, 0x33, 0x36, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x36, 0x37, 0x35, 0x2e, 0x43, 0x70, 0x61, 0x4f, 0x4f, 0x4a, 0x2e, 0x2d, 0x2a, 0xb1, 0xf8, 0x22, 0xe3, 0xe6, 0xf2, 0xe5, 0xe5, 0xe6, 0xe6, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf6, 0xf0, 0xfb, 0xaa, 0x26, 0x33, 0x35, 0x36, 0x37, 0x38, 0x33, 0x35, 0x35, 0x32, 0x26, 0x79, 0x22, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf1, 0xf4, 0xf0, 0xf7, 0xf4, 0xf0, 0xf2, 0xf4, 0xf6, 0xf2, 0xc7, 0xde, 0xc2, 0x27, 0x28, 0x3c, 0x53, 0x53, 0x54, 0x54, 0x51, 0x35, 0x35, 0x33, 0x2e, 0x36, 0x33, 0x33, 0x33, 0x35, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x36, 0x33, 0x33, 0x2e, 0x2e, 0x44, 0x29, 0x36, 0x33, 0x2e, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x36, 0x30, 0x33, 0x33, 0x36, 0x2e, 0x33, 0x55, 0x44, 0x33, 0x2f, 0x38, 0x35, 0x33, 0x36, 0x35, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x36, 0x36, 0x36, 0x35, 0x36, 0x33, 0x39, 0x45, 0x70, 0x57, 0x57, 0x4f, 0x4a, 0x3f, 0x32, 0x26, 0xde, 0xfd, 0xf1, 0xf4, 0xf2, 0xf0, 0xf0, 0xf0, 0xe4, 0xf0, 0xf0, 0xf1, 0xf0, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 0xf1, 0xc0, 0x9d, 0x26, 0x33, 0x33, 0x36, 0x33, 0x36, 0x38, 0x33, 0x35, 0x37, 0x26, 0x13, 0xc0, 0xf0, 0xf7, 0xf5, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf5, 0xf4, 0xf1, 0xe3, 0xf0, 0xf5, 0xf5, 0xe3, 0xe3, 0xf8, 0xe6, 0xc4, 0x27, 0x2a, 0x2b, 0x44, 0x53, 0x50, 0x54, 0x54, 0x5a, 0x39, 0x35, 0x35, 0x33, 0x37, 0x33, 0x33, 0x33, 0x35, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x33, 0x36, 0x36, 0x49, 0x2e, 0x2e, 0x33, 0x36, 0x30, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x2e, 0x36, 0x35, 0x30, 0x45, 0x49, 0x3c, 0x33, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x36, 0x36, 0x33, 0x39, 0x4a, 0x70, 0x61, 0x57, 0x4f, 0x4e, 0x39, 0x2d, 0x30, 0xc6, 0xb9, 0x22, 0xf4, 0xf0, 0xf7, 0xf7, 0xf0, 0xe3, 0xf4, 0xf2, 0xf0, 0xf1, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf2, 0xf2, 0x22, 0xbe, 0x52, 0x29, 0x36, 0x35, 0x36, 0x33, 0x33, 0x3b, 0x3b, 0x35, 0x2e, 0xc3, 0xab, 0xff, 0xf7, 0xf0, 0xf6, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xb9, 0xf7, 0xf5, 0xf5, 0xf1, 0xf0, 0xf5, 0xf5, 0xf7, 0xb1, 0xc3, 0x27, 0x2a, 0x2d, 0x4e, 0x53, 0x54, 0x54, 0x54, 0x62, 0x3c, 0x35, 0x2e, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x2e, 0x3b, 0x2e, 0x55, 0x4d, 0x2d, 0x33, 0x33, 0x2d, 0x30, 0x2d, 0x33, 0x36, 0x2d, 0x41, 0x44, 0x2e, 0x2e, 0x3f, 0x55, 0x3a, 0x35, 0x2e, 0x36, 0x36, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x36, 0x36, 0x36, 0x35, 0x36, 0x35, 0x35, 0x53, 0x6c, 0x63, 0x4f, 0x4f, 0x4b, 0x45, 0x2f, 0x2b, 0xc3, 0xb0, 0xff, 0xbb, 0xf0, 0xb9, 0xf0, 0xf4, 0xf4, 0xe3, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf1, 0xef, 0xc7, 0xfe, 0x34, 0x2d, 0x35, 0x33, 0x35, 0x36, 0x38, 0x2e, 0x33, 0x32, 0x32, 0x28, 0xb6, 0xf8, 0xf4, 0xf2, 0xe6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf5, 0x22, 0xe3, 0xf5, 0xc0, 0xf7, 0xfb, 0xff, 0xe3, 0xfa, 0x84, 0xc2, 0x27, 0x2c, 0x2d, 0x51, 0x54, 0x50, 0x54, 0x54, 0x62, 0x44, 0x2f, 0x2e, 0x35, 0x33, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x2d, 0x3b, 0x2e, 0x3a, 0x6f, 0x44, 0x2d, 0x30, 0x30, 0x33, 0x30, 0x36, 0x33, 0x2e, 0x4d, 0x55, 0x29, 0x35, 0x4d, 0x45, 0x35, 0x33, 0x2e, 0x3a, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x36, 0x37, 0x2f, 0x39, 0x62, 0x6d, 0x66, 0x4f, 0x4b, 0x4e, 0x43, 0x29, 0x28, 0x25, 0x94, 0x24, 0xbb, 0xc0, 0xbb, 0xef, 0xbb, 0x22, 0x22, 0xf0, 0xf4, 0xf0, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf1, 0xf7, 0xc0, 0x71, 0x28, 0x32, 0x2f, 0x35, 0x35, 0x33, 0x36, 0x36, 0x3b, 0x2e, 0x29, 0x68, 0xbd, 0xf7, 0xf0, 0xf6, 0xe6, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xe5, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xc0, 0x22, 0x84, 0x01, 0x9d, 0xb3, 0xff, 0x22, 0x01, 0xc2, 0x25, 0x2a, 0x3c, 0x5a, 0x4e, 0x54, 0x54, 0x50, 0x62, 0x45, 0x2e, 0x2e, 0x33, 0x32, 0x36, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x36, 0x2d, 0x3a, 0x2d, 0x69, 0x5d, 0x29, 0x36, 0x30, 0x36, 0x30, 0x33, 0x33, 0x2e, 0x60, 0x55, 0x39, 0x45, 0x4d, 0x35, 0x2e, 0x33, 0x35, 0x3a, 0x35, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x35, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x39, 0x65, 0x6c, 0x6d, 0x4f, 0x4f, 0x4b, 0x4a, 0x40, 0x44, 0x3b, 0x71, 0xb4, 0xba, 0xa2, 0x6b, 0x52, 0x71, 0xae, 0xc0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf1, 0xeb, 0xaa, 0x2a, 0x2b, 0x32, 0x35, 0x2f, 0x36, 0x35, 0x36, 0x2d, 0x3b, 0x35, 0x25, 0xaa, 0xc1, 0xf7, 0xf0, 0xf4, 0xe6, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf4, 0xf1, 0xf4, 0xf1, 0xf1, 0xf1, 0xf1, 0xe6, 0xe5, 0xe5, 0xf2, 0x22, 0xef, 0x4c, 0x26, 0x2f, 0x29, 0x25, 0x3a, 0x69, 0x33, 0x2d, 0x33, 0x44, 0x70, 0x6c, 0x54, 0x4b, 0x5b, 0x6d, 0x70, 0x4a, 0x2f, 0x32, 0x2d, 0x33, 0x36, 0x35, 0x35, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x33, 0x35, 0x3c, 0x6f, 0x49, 0x29, 0x36, 0x33, 0x30, 0x33, 0x2e, 0x40, 0x65, 0x5e, 0x45, 0x51, 0x3b, 0x2e, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x32, 0x33, 0x34, 0x35, 0x33, 0x33, 0x35, 0x33, 0x35, 0x35, 0x3b, 0x70, 0x6d, 0x6d, 0x4f, 0x4b, 0x57, 0x6e, 0x6a, 0x67, 0x70, 0x64, 0x6e, 0x56, 0x56, 0x58, 0x48, 0x38, 0x30, 0xab, 0xfb, 0xe3, 0xf7, 0xf0, 0xf3, 0xf0, 0xe3, 0xf1, 0xf1, 0x24, 0xb0, 0x2d, 0x2b, 0x32, 0x35, 0x33, 0x36, 0x33, 0x36, 0x38, 0x35, 0x2e, 0x30, 0x42, 0xb6, 0xff, 0xf1, 0xf3, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xe6, 0xe5, 0xf2, 0xf2, 0x24, 0x94, 0x25, 0x40, 0x3b, 0x39, 0x4e, 0x3c, 0x33, 0x4d, 0x4d, 0x58, 0x64, 0x58, 0x63, 0x61, 0x5f, 0x76, 0x82, 0x73, 0x51, 0x2e, 0x33, 0x34, 0x32, 0x35, 0x36, 0x35, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x35, 0x38, 0x35, 0x3c, 0x55, 0x69, 0x3b, 0x2f, 0x2e, 0x36, 0x33, 0x2e, 0x4e, 0x65, 0x65, 0x53, 0x40, 0x2e, 0x35, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x32, 0x33, 0x32, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x2f, 0x40, 0x6c, 0x6d, 0x6e, 0x4f, 0x5b, 0x66, 0x56, 0x56, 0x5c, 0x58, 0x56, 0x5c, 0x02, 0x95, 0x04, 0x47, 0x48, 0x3a, 0x79, 0xff, 0x22, 0xe3, 0xf3, 0xf0, 0xe3, 0xf7, 0xef, 0xeb, 0xe1, 0x49, 0x25, 0x3b, 0x33, 0x36, 0x35, 0x33, 0x36, 0x33, 0x36, 0x35, 0x3b, 0x25, 0x84, 0xc1, 0xf4, 0xf2, 0xf3, 0xf0, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf0, 0xbb, 0x24, 0x79, 0x35, 0x40, 0x4e, 0x97, 0x97, 0x8c, 0x6a, 0x46, 0x58, 0x6e, 0x07, 0x74, 0x56, 0x64, 0x5c, 0x6e, 0x78, 0x7b, 0x5a, 0x29, 0x37, 0x32, 0x33, 0x35, 0x35, 0x35, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x35, 0x35, 0x2e, 0x45, 0x6f, 0x62, 0x3f, 0x35, 0x30, 0x2e, 0x35, 0x62, 0x65, 0x65, 0x51, 0x2f, 0x35, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x35, 0x33, 0x33, 0x35, 0x33, 0x35, 0x2f, 0x4d, 0x70, 0x6d, 0x6e, 0x66, 0x61, 0x56, 0x56, 0x7e, 0x0c, 0x10, 0x03, 0x4f, 0x56, 0x72, 0x70, 0x47, 0x4a, 0x2f, 0x79, 0x24, 0xbb, 0xef, 0xf1, 0xf1, 0xf7, 0xbb, 0xfd, 0xae, 0xc3, 0x28, 0x41, 0x3b, 0x2e, 0x36, 0x35, 0x33, 0x35, 0x33, 0x38, 0x35, 0x2d, 0x28, 0xb7, 0xbd, 0xf4, 0xf4, 0xf2, 0xf1, 0xf1, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf4, 0xf4, 0xf4, 0xf2, 0xf3, 0x22, 0xbd, 0xb2, 0x81, 0x46, 0x5e, 0x5c, 0x8c, 0x97, 0xa3, 0x6e, 0x48, 0x85, 0x0c, 0x93, 0x85, 0x5c, 0x64, 0x64, 0x6e, 0x7d, 0x76, 0x65, 0x2f, 0x2e, 0x34, 0x33, 0x33, 0x35, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x35, 0x35, 0x35, 0x62, 0x6c, 0x50, 0x40, 0x2e, 0x2f, 0x4a, 0x6c, 0x62, 0x5a, 0x39, 0x2f, 0x3b, 0x3b, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x32, 0x33, 0x32, 0x33, 0x33, 0x35, 0x33, 0x35, 0x2e, 0x39, 0x53, 0x70, 0x6e, 0x6e, 0x64, 0x57, 0x56, 0x72, 0x0c, 0x0d, 0x11, 0x12, 0x09, 0x47, 0x4b, 0x4f, 0x4b, 0x51, 0x4a, 0xac, 0xc1, 0xbb, 0xb9, 0xb9, 0x22, 0xbe, 0xbe, 0x94, 0x2c, 0x34, 0x36, 0x2e, 0x32, 0x35, 0x2f, 0x33, 0x35, 0x33, 0x35, 0x33, 0x3b, 0x25, 0x89, 0xff, 0xf5, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xf4, 0xf4, 0xff, 0xab, 0x30, 0x46, 0x59, 0x4f, 0x4b, 0x47, 0x6e, 0x7b, 0x56, 0x5c, 0x93, 0x85, 0x93, 0x85, 0x02, 0x5c, 0x64, 0x64, 0x74, 0x7b, 0x6d, 0x35, 0x2e, 0x37, 0x33, 0x35, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x35, 0x2f, 0x47, 0x6c, 0x63, 0x5e, 0x46, 0x2f, 0x5a, 0x65, 0x62, 0x4e, 0x2f, 0x39, 0x33, 0x2e, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x33, 0x2e, 0x33, 0x35, 0x33, 0x33, 0x35, 0x33, 0x35, 0x2f, 0x5e, 0x70, 0x6e, 0x6e, 0x64, 0x4f, 0x64, 0x09, 0x0d, 0x10, 0x0c, 0x12, 0xa3, 0x56, 0x56, 0x56, 0x64, 0x64, 0x4f, 0x6c, 0xb2, 0xbf, 0xbd, 0xc0, 0xbe, 0xac, 0x4c, 0x26, 0x36, 0x2d, 0x35, 0x32, 0x39, 0x37, 0x35, 0x2f, 0x35, 0x35, 0x33, 0x36, 0x28, 0x42, 0xb6, 0xbe, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xe5, 0xf2, 0xf7, 0xef, 0xf4, 0xbc, 0xb7, 0x55, 0x46, 0x50, 0x56, 0x5c, 0x5c, 0x5c, 0x43, 0x43, 0x57, 0x56, 0x8d, 0x0c, 0x85, 0x8d, 0x6e, 0x5c, 0x64, 0x64, 0x70, 0x73, 0x73, 0x35, 0x35, 0x32, 0x36, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x3c, 0x39, 0x67, 0x5f, 0x5f, 0x4e, 0x43, 0x65, 0x5e, 0x62, 0x39, 0x39, 0x2e, 0x2e, 0x2e, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x32, 0x33, 0x33, 0x36, 0x36, 0x2e, 0x36, 0x35, 0x39, 0x6d, 0x6e, 0x6e, 0x74, 0x4f, 0x4f, 0x56, 0x09, 0x0c, 0x0c, 0x0c, 0x10, 0x80, 0x4b, 0x5c, 0x74, 0x08, 0x85, 0x02, 0x48, 0x48, 0x92, 0xb5, 0xaa, 0x6b, 0x31, 0x2b, 0x36, 0x36, 0x3c, 0x36, 0x35, 0x35, 0x2f, 0x35, 0x35, 0x32, 0x36, 0x33, 0x37, 0xc3, 0xaa, 0x24, 0xf1, 0xf5, 0xf2, 0xe5, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xe5, 0xe4, 0xf0, 0xf0, 0xff, 0xbb, 0xc1, 0xb0, 0x5d, 0x46, 0x56, 0x56, 0x7d, 0x90, 0x90, 0x76, 0x40, 0x65, 0x4f, 0x7d, 0x9a, 0x9a, 0x85, 0x5c, 0x5c, 0x63, 0x5f, 0x6e, 0x73, 0x73, 0x40, 0x35, 0x33, 0x36, 0x35, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x3c, 0x2f, 0x54, 0x67, 0x61, 0x54, 0x57, 0x65, 0x65, 0x5a, 0x39, 0x35, 0x2e, 0x2e, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x2e, 0x33, 0x33, 0x35, 0x36, 0x35, 0x33, 0x35, 0x35, 0x43, 0x70, 0x6e, 0x6e, 0x6e, 0x4f, 0x4f, 0x56, 0x7e, 0x0d, 0x10, 0x12, 0x09, 0x4f, 0x4f, 0x64, 0x0b, 0x0f, 0x0b, 0x0b, 0x5c, 0x48, 0x48, 0x38, 0x28, 0x2d, 0x34, 0x37, 0x35, 0x3a, 0x39, 0x35, 0x35, 0x35, 0x32, 0x35, 0x2f, 0x41, 0x2d, 0x3b, 0x26, 0x7a, 0xbe, 0x22, 0xe3, 0xf0, 0xe5, 0xf0, 0xe5, 0xf1, 0xf1, 0xe6, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe6, 0xf1, 0xe5, 0xe5, 0xe5, 0xe5, 0xf5, 0xb9, 0xbc, 0xbc, 0x8e, 0x80, 0x7e, 0x56, 0x74, 0x0b, 0x93, 0x8d, 0x8d, 0x50, 0x4b, 0x66, 0x5c, 0x5c, 0x64, 0x64, 0x5c, 0x5b, 0x5f, 0x63, 0x67, 0x70, 0x76, 0x46, 0x35, 0x2e, 0x33, 0x35, 0x35, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x34, 0x2e, 0x3c, 0x35, 0x43, 0x70, 0x5f, 0x5b, 0x5f, 0x63, 0x62, 0x46, 0x2f, 0x35, 0x33, 0x35, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x32, 0x33, 0x36, 0x2e, 0x36, 0x33, 0x2e, 0x4e, 0x70, 0x6e, 0x6e, 0x6e, 0x4f, 0x4f, 0x47, 0x56, 0x02, 0x7e, 0x03, 0x47, 0x59, 0x4f, 0x74, 0x0b, 0x0b, 0x0b, 0x0c, 0x64, 0x3a, 0x46, 0x3f, 0x38, 0x33, 0x37, 0x37, 0x36, 0x39, 0x3a, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3b, 0x2e, 0x36, 0x26, 0x6b, 0xb9, 0xf8, 0xf0, 0xf1, 0xf6, 0xe3, 0xe5, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xe5, 0xe5, 0xe4, 0xe5, 0xf1, 0x22, 0xbf, 0xae, 0x3a, 0x72, 0x17, 0x85, 0x0b, 0x0b, 0x0b, 0x0b, 0x90, 0x4f, 0x4b, 0x43, 0x47, 0x4f, 0x56, 0x4f, 0x5c, 0x59, 0x67, 0x5c, 0x6e, 0x6e, 0x73, 0x53, 0x2f, 0x33, 0x33, 0x35, 0x35, 0x35, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x34, 0x32, 0x33, 0x35, 0x39, 0x6c, 0x66, 0x66, 0x61, 0x63, 0x67, 0x39, 0x35, 0x33, 0x33, 0x36, 0x32, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x33, 0x32, 0x33, 0x35, 0x33, 0x33, 0x35, 0x33, 0x2e, 0x65, 0x70, 0x6e, 0x6e, 0x61, 0x4f, 0x4b, 0x4f, 0x47, 0x4f, 0x48, 0x46, 0x43, 0x4b, 0x4b, 0x7d, 0x0f, 0x0b, 0x10, 0x74, 0x3c, 0x3f, 0x3c, 0x46, 0x35, 0x3b, 0x36, 0x3b, 0x36, 0x3a, 0x39, 0x36, 0x35, 0x35, 0x35, 0x33, 0x35, 0x37, 0x25, 0x4c, 0xb7, 0xc0, 0xf5, 0xf6, 0xef, 0xf6, 0xe5, 0xe5, 0xe6, 0xf1, 0xf1, 0xe6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xe5, 0xe5, 0xe6, 0xe6, 0xbb, 0xbc, 0x99, 0x6a, 0x02, 0x0c, 0x15, 0x0e, 0x0e, 0x0b, 0x0b, 0x85, 0x47, 0x43, 0x63, 0x8c, 0x95, 0x7e, 0x74, 0x56, 0x5c, 0x64, 0x6e, 0x64, 0x6e, 0x6e, 0x65, 0x2e, 0x35, 0x35, 0x35, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x35, 0x33, 0x34, 0x32, 0x34, 0x2e, 0x3b, 0x35, 0x65, 0x67, 0x66, 0x66, 0x6d, 0x50, 0x3c, 0x35, 0x35, 0x36, 0x33, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x32, 0x33, 0x33, 0x36, 0x33, 0x2e, 0x36, 0x2e, 0x3c, 0x6c, 0x6d, 0x6d, 0x76, 0x57, 0x54, 0x4b, 0x5f, 0x7d, 0x86, 0x93, 0x86, 0x6d, 0x4a, 0x4f, 0x5c, 0x96, 0x11, 0x7e, 0x46, 0x59, 0x9a, 0x7e, 0x8f, 0x6f, 0x29, 0x3b, 0x37, 0x3b, 0x35, 0x3a, 0x35, 0x38, 0x35, 0x36, 0x35, 0x33, 0x26, 0x77, 0xba, 0xc0, 0xf5, 0xf0, 0xe4, 0xf7, 0xe3, 0xe4, 0xe6, 0xe5, 0xe6, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xe5, 0xe5, 0xf1, 0xe3, 0xbf, 0x92, 0x48, 0x5c, 0x11, 0x11, 0x0e, 0x0b, 0x0f, 0x8d, 0x64, 0x43, 0x6e, 0x91, 0x95, 0x95, 0x95, 0x9a, 0x7d, 0x64, 0x64, 0x6e, 0x64, 0x6e, 0x70, 0x67, 0x40, 0x2e, 0x35, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x2e, 0x34, 0x37, 0x30, 0x36, 0x2f, 0x51, 0x6d, 0x66, 0x66, 0x6c, 0x46, 0x39, 0x33, 0x33, 0x36, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x36, 0x32, 0x34, 0x36, 0x35, 0x3f, 0x73, 0x6d, 0x6d, 0x6e, 0x4f, 0x4f, 0x6e, 0x8b, 0x91, 0x95, 0x95, 0x95, 0x95, 0x87, 0x56, 0x43, 0x02, 0x78, 0x56, 0x56, 0xa6, 0x15, 0x0b, 0x0d, 0x80, 0x2e, 0x39, 0x37, 0x35, 0x36, 0x3f, 0x35, 0x2e, 0x36, 0x37, 0x28, 0xc3, 0x94, 0xbb, 0xbd, 0xbb, 0xf5, 0xf2, 0xf2, 0xe3, 0xe5, 0xe5, 0xe5, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf1, 0xe4, 0xf0, 0xf1, 0xbd, 0x99, 0x58, 0x7d, 0x15, 0x0f, 0x0e, 0x11, 0x93, 0x64, 0x39, 0x6e, 0x98, 0x95, 0x93, 0x93, 0x93, 0x93, 0x9a, 0x8d, 0x74, 0x6e, 0x64, 0x66, 0x6e, 0x70, 0x46, 0x2f, 0x33, 0x2e, 0x32, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x2e, 0x33, 0x33, 0x36, 0x30, 0x3a, 0x2e, 0x4a, 0x6c, 0x66, 0x63, 0x6c, 0x40, 0x35, 0x2e, 0x33, 0x33, 0x36, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x36, 0x32, 0x35, 0x35, 0x35, 0x33, 0x34, 0x32, 0x32, 0x39, 0x45, 0x73, 0x70, 0x6d, 0x6e, 0x4f, 0x78, 0x91, 0x90, 0x8d, 0x90, 0x8d, 0x8d, 0x96, 0x96, 0x85, 0x6e, 0x43, 0x43, 0x47, 0x0b, 0x11, 0x11, 0x11, 0x10, 0x86, 0x29, 0x2f, 0x2d, 0x35, 0x3a, 0x3a, 0x36, 0x41, 0x29, 0xc3, 0x60, 0xb0, 0xfd, 0xbb, 0xf7, 0xf4, 0xf0, 0xe5, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf4, 0xf1, 0xe5, 0xe5, 0xf6, 0xbf, 0xa9, 0x48, 0x82, 0x16, 0x10, 0x11, 0x06, 0x56, 0x43, 0x5b, 0x8f, 0x8d, 0x8d, 0x93, 0x93, 0x96, 0x93, 0x93, 0x9a, 0x87, 0x6e, 0x64, 0x64, 0x6e, 0x70, 0x4e, 0x2f, 0x2e, 0x33, 0x2d, 0x33, 0x2e, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x36, 0x32, 0x35, 0x32, 0x33, 0x33, 0x38, 0x2f, 0x45, 0x6c, 0x66, 0x6d, 0x65, 0x40, 0x35, 0x35, 0x32, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x35, 0x35, 0x33, 0x34, 0x32, 0x33, 0x2e, 0x50, 0x70, 0x70, 0x66, 0x64, 0x64, 0x91, 0x95, 0x8d, 0x90, 0x90, 0x8d, 0x90, 0x93, 0x96, 0x95, 0x86, 0x50, 0x4b, 0x5c, 0xa6, 0x11, 0x11, 0x0b, 0x95, 0x77, 0x2f, 0x32, 0x32, 0x37, 0x38, 0x33, 0x28, 0xc3, 0x49, 0xa8, 0xbd, 0xfb, 0xbb, 0xf5, 0xe3, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf5, 0xf4, 0xe5, 0xe4, 0xf0, 0xbd, 0xb2, 0x3a, 0x48, 0x6e, 0x16, 0xa6, 0x5c, 0x46, 0x47, 0x82, 0x95, 0x96, 0x93, 0x96, 0x93, 0x96, 0x96, 0x93, 0x8d, 0x9a, 0x7d, 0x64, 0x64, 0x66, 0x70, 0x5a, 0x35, 0x35, 0x2e, 0x33, 0x2e, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x35, 0x40, 0x6c, 0x6d, 0x66, 0x5e, 0x39, 0x35, 0x2e, 0x33, 0x36, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x32, 0x35, 0x33, 0x35, 0x33, 0x32, 0x34, 0x33, 0x2f, 0x67, 0x70, 0x6e, 0x6e, 0x64, 0x78, 0x95, 0x8d, 0x8d, 0x8d, 0x90, 0x8d, 0x90, 0x93, 0x93, 0x85, 0x95, 0x70, 0x4b, 0x5c, 0x9a, 0xa6, 0xa6, 0x7d, 0x09, 0x51, 0x29, 0x29, 0x28, 0x25, 0x25, 0x38, 0x79, 0xae, 0x22, 0xc1, 0x22, 0xe3, 0xf8, 0xe6, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf5, 0xf4, 0xf5, 0xe5, 0xe5, 0xe4, 0xbd, 0xbb, 0x5d, 0x46, 0x46, 0x7e, 0x14, 0x59, 0x43, 0x6d, 0x98, 0x8d, 0x93, 0x93, 0x93, 0x96, 0x96, 0x96, 0x96, 0x93, 0x9a, 0x8d, 0x6e, 0x64, 0x64, 0x70, 0x5a, 0x39, 0x2e, 0x33, 0x2d, 0x33, 0x2e, 0x36, 0x33, 0x36, 0x36, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x36, 0x32, 0x37, 0x35, 0x30, 0x38, 0x30, 0x39, 0x2f, 0x6c, 0x6d, 0x6d, 0x5e, 0x2f, 0x35, 0x35, 0x32, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x32, 0x33, 0x35, 0x35, 0x35, 0x34, 0x2d, 0x3b, 0x2f, 0x6c, 0x73, 0x6d, 0x6e, 0x64, 0x8b, 0x8d, 0x90, 0x93, 0x8d, 0x93, 0x90, 0x90, 0x93, 0x93, 0x90, 0x91, 0x86, 0x4f, 0x4f, 0x74, 0x12, 0x9a, 0x02, 0x5f, 0x35, 0x32, 0xc4, 0x68, 0x94, 0xfe, 0xb8, 0xf8, 0xc0, 0xbe, 0xf5, 0x22, 0xf5, 0xef, 0xf5, 0xe5, 0xe3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf0, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf2, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xe8, 0xe8, 0xfa, 0x24, 0x7c, 0x46, 0x46, 0x46, 0x59, 0x4b, 0x4b, 0x7f, 0x91, 0x93, 0x0b, 0x93, 0x93, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x74, 0x5c, 0x66, 0x67, 0x6c, 0x3c, 0x2e, 0x2e, 0x33, 0x2e, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x32, 0x33, 0x33, 0x33, 0x3a, 0x39, 0x6c, 0x70, 0x66, 0x5e, 0x2f, 0x2f, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x32, 0x35, 0x2e, 0x35, 0x2d, 0x37, 0x35, 0x39, 0x70, 0x70, 0x6e, 0x6e, 0x6e, 0x90, 0x8d, 0x8d, 0x8d, 0x93, 0x93, 0x8d, 0x90, 0x90, 0x93, 0x8d, 0x90, 0x88, 0x67, 0x46, 0x56, 0x5c, 0x4f, 0x43, 0x3f, 0x99, 0xb6, 0xb9, 0x22, 0xc7, 0xc1, 0xf8, 0xf1, 0xe3, 0xf0, 0xf0, 0xe3, 0xe3, 0xf7, 0xe4, 0xf0, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf7, 0xf6, 0xf7, 0xf7, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xe8, 0xf9, 0xe8, 0xf8, 0x24, 0xb0, 0x4d, 0x51, 0x62, 0x51, 0x53, 0x47, 0x88, 0x8d, 0x93, 0x96, 0x93, 0x93, 0x96, 0x93, 0x96, 0x96, 0x96, 0x93, 0x9a, 0x74, 0x5c, 0x6d, 0x67, 0x70, 0x3f, 0x2e, 0x33, 0x2d, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x32, 0x2e, 0x33, 0x33, 0x30, 0x33, 0x39, 0x2f, 0x6c, 0x70, 0x6d, 0x5e, 0x2f, 0x35, 0x2e, 0x33, 0x33, 0x33, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x35, 0x35, 0x35, 0x2e, 0x37, 0x35, 0x43, 0x70, 0x70, 0x70, 0x61, 0x74, 0x90, 0x8d, 0x93, 0x8d, 0x93, 0x90, 0x90, 0x8d, 0x93, 0x8d, 0x90, 0x90, 0x91, 0x6e, 0x47, 0x4f, 0x48, 0x4b, 0x4d, 0x69, 0xbb, 0xeb, 0xfb, 0xfa, 0xff, 0xf8, 0xff, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf6, 0xf6, 0xf0, 0xe4, 0xf0, 0xf2, 0xf1, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf2, 0xf0, 0xf0, 0xf0, 0xf6, 0xf7, 0xf8, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xe8, 0xe8, 0xfa, 0xf8, 0x24, 0x7c, 0x49, 0x55, 0x51, 0x47, 0x4f, 0x91, 0x90, 0x93, 0x93, 0x93, 0x90, 0x93, 0x96, 0x96, 0x93, 0x96, 0x95, 0x9a, 0x7d, 0x5c, 0x64, 0x63, 0x69, 0x45, 0x2e, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x2e, 0x33, 0x2e, 0x33, 0x30, 0x38, 0x35, 0x2f, 0x65, 0x70, 0x66, 0x5a, 0x39, 0x2f, 0x36, 0x32, 0x36, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x32, 0x2e, 0x35, 0x2f, 0x36, 0x32, 0x36, 0x2f, 0x47, 0x73, 0x6e, 0x6d, 0x64, 0x74, 0x95, 0x8d, 0x8d, 0x93, 0x8d, 0x93, 0x8d, 0x8d, 0x8d, 0x90, 0x8d, 0x90, 0x95, 0x73, 0x47, 0x47, 0x51, 0x45, 0x2e, 0xae, 0xfd, 0xbe, 0xf9, 0xe8, 0xfa, 0xf9, 0xff, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf6, 0xf2, 0xf0, 0xf2, 0xf0, 0xf0, 0xf6, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf0, 0xf2, 0xf6, 0xf6, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xe8, 0xe8, 0xe8, 0xf9, 0xc0, 0xb4, 0x44, 0x45, 0x51, 0x59, 0x4f, 0x85, 0x90, 0x93, 0x93, 0x90, 0x90, 0x93, 0x93, 0x96, 0x93, 0x96, 0x90, 0x9a, 0x74, 0x64, 0x61, 0x67, 0x6c, 0x4d, 0x33, 0x2e, 0x32, 0x2d, 0x36, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x32, 0x2e, 0x2e, 0x33, 0x2d, 0x3a, 0x35, 0x2f, 0x6c, 0x73, 0x6d, 0x50, 0x2f, 0x2f, 0x33, 0x33, 0x33, 0x33, 0x35, 0x36, 0x33, 0x33, 0x36, 0x33, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x37, 0x33, 0x35, 0x35, 0x35, 0x33, 0x35, 0x5a, 0x73, 0x70, 0x6d, 0x61, 0x74, 0x8d, 0x8d, 0x93, 0x8d, 0x90, 0x8d, 0x90, 0x90, 0x8d, 0x90, 0x8d, 0x90, 0x8d, 0x74, 0x47, 0x51, 0x49, 0x44, 0xaa, 0xfd, 0xff, 0xf9, 0xe8, 0xf9, 0xf9, 0xf9, 0xff, 0xe8, 0xff, 0xf9, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf8, 0xf8, 0xf6, 0xf6, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf7, 0xf8, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xea, 0xe8, 0xe8, 0xfa, 0xc0, 0xbf, 0x8e, 0x3f, 0x4e, 0x56, 0x4b, 0x7d, 0x93, 0x90, 0x90, 0x90, 0x90, 0x90, 0x96, 0x93, 0x93, 0x96, 0x95, 0x9a, 0x74, 0x5c, 0x64, 0x5e, 0x69, 0x51, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x32, 0x33, 0x30, 0x3a, 0x2e, 0x39, 0x6c, 0x76, 0x63, 0x54, 0x39, 0x35, 0x35, 0x32, 0x36, 0x33, 0x33, 0x33, 0x36, 0x33, 0x35, 0x33, 0x33, 0x36, 0x36, 0x35, 0x36, 0x32, 0x33, 0x2f, 0x35, 0x33, 0x37, 0x2e, 0x3c, 0x63, 0x73, 0x6d, 0x6d, 0x61, 0x6e, 0x8d, 0x8d, 0x90, 0x8d, 0x90, 0x8d, 0x90, 0x8d, 0x8d, 0x90, 0x8d, 0x93, 0x90, 0x73, 0x47, 0x4a, 0x44, 0x94, 0xc1, 0xc0, 0xff, 0xf8, 0xfa, 0xf9, 0xf9, 0xfa, 0xfb, 0xbe, 0xf9, 0xbe, 0xf9, 0xff, 0xf8, 0xf8, 0xff, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xf8, 0xf8, 0xf7, 0xf6, 0xf0, 0xf2, 0xf6, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf7, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xf8, 0xf9, 0xe8, 0xea, 0xe8, 0xe8, 0xc0, 0x24, 0xb7, 0x55, 0x49, 0x4f, 0x4b, 0x6e, 0x95, 0x90, 0x8d, 0x90, 0x90, 0x93, 0x90, 0x96, 0x96, 0x90, 0x95, 0x8d, 0x6e, 0x64, 0x5c, 0x64, 0x6c, 0x5a, 0x35, 0x35, 0x2e, 0x32, 0x2f, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x2e, 0x36, 0x33, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x33, 0x2f, 0x40, 0x75, 0x70, 0x66, 0x4e, 0x51, 0x4d, 0x33, 0x36, 0x33, 0x33, 0x35, 0x35, 0x2e, 0x3b, 0x2d, 0x35, 0x35, 0x33, 0x33, 0x32, 0x33, 0x33, 0x2f, 0x36, 0x2f, 0x3c, 0x36, 0x2f, 0x3c, 0x73, 0x76, 0x6d, 0x63, 0x66, 0x5c, 0x82, 0x9a, 0x8d, 0x8d, 0x8d, 0x90, 0x93, 0x90, 0x8d, 0x90, 0x8d, 0x8d, 0x8a, 0x5c, 0x43, 0x3f, 0x52, 0xbe, 0xfb, 0xf8, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf8, 0xf6, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf6, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0x24, 0xac, 0x36, 0x51, 0x54, 0x4b, 0x78, 0x90, 0x96, 0x93, 0x93, 0x93, 0x96, 0x90, 0x90, 0x90, 0x9f, 0x7e, 0x64, 0x56, 0x5c, 0x59, 0x6a, 0x65, 0x3c, 0x35, 0x35, 0x35, 0x35, 0x32, 0x33, 0x32, 0x33, 0x37, 0x33, 0x3b, 0x2e, 0x44, 0x36, 0x2e, 0x2e, 0x32, 0x2d, 0x31, 0x30, 0x42, 0x44, 0x2f, 0x43, 0x8c, 0x70, 0x6d, 0x4f, 0x77, 0x67, 0x33, 0x3a, 0x2e, 0x35, 0x2e, 0x3b, 0x2d, 0x4d, 0x2e, 0x35, 0x32, 0x35, 0x32, 0x33, 0x32, 0x39, 0x45, 0x35, 0x35, 0x41, 0x2d, 0x3f, 0x4e, 0x73, 0x6e, 0x6d, 0x63, 0x63, 0x61, 0x73, 0x8d, 0x8a, 0x90, 0x96, 0x93, 0x8d, 0x93, 0x93, 0x8d, 0x8d, 0x91, 0x76, 0x43, 0x46, 0x4d, 0xb0, 0xfd, 0xfa, 0xfa, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xe9, 0xf8, 0xf6, 0xf2, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf6, 0xfa, 0xf9, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xff, 0xfc, 0xc1, 0xa2, 0x2f, 0x46, 0x4f, 0x56, 0x8a, 0x95, 0x93, 0x90, 0x93, 0x90, 0x96, 0x96, 0x9a, 0x8d, 0x6e, 0x56, 0x64, 0x6e, 0x5c, 0x65, 0x70, 0x43, 0x2f, 0x35, 0x29, 0x49, 0x41, 0x2d, 0x35, 0x33, 0x33, 0x35, 0x36, 0x29, 0x69, 0x41, 0x2e, 0x2e, 0x33, 0x2d, 0x30, 0x2d, 0x42, 0x4d, 0x39, 0x39, 0xa4, 0x75, 0x5f, 0x47, 0x8e, 0x4d, 0x35, 0x3a, 0x33, 0x33, 0x36, 0x35, 0x39, 0x60, 0x35, 0x2e, 0x35, 0x32, 0x35, 0x32, 0x2e, 0x41, 0x62, 0x3a, 0x35, 0x3a, 0x39, 0x3f, 0x53, 0x7f, 0x76, 0x6d, 0x63, 0x5f, 0x5c, 0x5c, 0x82, 0x9a, 0x90, 0x8d, 0x8d, 0x93, 0x8d, 0x8d, 0x90, 0x91, 0x7d, 0x4b, 0x46, 0x3a, 0xaf, 0xfd, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf7, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf8, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf8, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xff, 0xfb, 0x24, 0xa2, 0x44, 0x46, 0x50, 0x56, 0x82, 0x95, 0x96, 0x95, 0x96, 0x95, 0x95, 0x7d, 0x64, 0x56, 0x64, 0x5c, 0x57, 0x5f, 0x5e, 0x7c, 0x55, 0x3c, 0x3a, 0x2d, 0x49, 0x41, 0x2d, 0x33, 0x32, 0x35, 0x33, 0x35, 0x29, 0x77, 0x55, 0x2d, 0x2e, 0x2d, 0x2e, 0x2e, 0x2f, 0x35, 0x62, 0x40, 0x40, 0xa9, 0x9e, 0x65, 0x4e, 0x9e, 0x43, 0x3c, 0x3a, 0x35, 0x38, 0x38, 0x2e, 0x49, 0x6f, 0x2f, 0x2d, 0x35, 0x35, 0x32, 0x35, 0x37, 0x4a, 0x69, 0x2f, 0x35, 0x35, 0x35, 0x3f, 0x75, 0x7f, 0x66, 0x6d, 0x63, 0x64, 0x63, 0x5c, 0x64, 0x7d, 0x90, 0x95, 0x90, 0x95, 0x90, 0x91, 0x8d, 0x6e, 0x4b, 0x46, 0x4d, 0xae, 0xfd, 0xc0, 0xf9, 0xf7, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf9, 0xfa, 0xf8, 0xf9, 0xfa, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xfa, 0xf8, 0xc1, 0x24, 0xac, 0x3a, 0x43, 0x4f, 0x56, 0x64, 0x7d, 0x82, 0x85, 0x7d, 0x6e, 0x5c, 0x5c, 0x64, 0x5c, 0x63, 0x63, 0x59, 0x4b, 0x7c, 0x80, 0x2d, 0x3a, 0x33, 0x49, 0x41, 0x2e, 0x33, 0x35, 0x36, 0x2f, 0x35, 0x29, 0x6f, 0x6f, 0x29, 0x30, 0x2e, 0x2e, 0x2f, 0x2f, 0x2f, 0x65, 0x3c, 0x51, 0xaf, 0xb4, 0x92, 0x7c, 0x92, 0x4a, 0x39, 0x39, 0x35, 0x38, 0x33, 0x2e, 0x62, 0x62, 0x2e, 0x2f, 0x32, 0x35, 0x35, 0x3b, 0x35, 0x62, 0x4d, 0x39, 0x35, 0x3c, 0x2f, 0x55, 0x75, 0x6c, 0x70, 0x6d, 0x6d, 0x63, 0x64, 0x61, 0x5c, 0x5c, 0x6e, 0x74, 0x82, 0x87, 0x82, 0x76, 0x4f, 0x4b, 0x46, 0x49, 0xaf, 0xfd, 0xf8, 0xe9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xf8, 0xf9, 0xf8, 0xf9, 0xf8, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf8, 0xfb, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf8, 0xf9, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xfa, 0xc0, 0xfd, 0xb5, 0x7c, 0x3f, 0x47, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x5c, 0x61, 0x59, 0x5f, 0x5d, 0x4e, 0x69, 0xa7, 0xba, 0xbc, 0x6f, 0x41, 0x35, 0x44, 0x4d, 0x2e, 0x35, 0x2e, 0x35, 0x35, 0x2f, 0x35, 0x55, 0x7c, 0x29, 0x33, 0x2e, 0x2f, 0x2f, 0x2f, 0x29, 0x75, 0x33, 0x92, 0xc1, 0x24, 0x24, 0xc0, 0xae, 0x44, 0x3b, 0x39, 0x3c, 0x35, 0x35, 0x2f, 0x6f, 0x55, 0x2f, 0x3b, 0x35, 0x2e, 0x35, 0x35, 0x3f, 0x75, 0x40, 0x2f, 0x3f, 0x3b, 0x41, 0xb7, 0xb7, 0x83, 0x69, 0x5e, 0x67, 0x67, 0x5f, 0x67, 0x61, 0x57, 0x4f, 0x4f, 0x4f, 0x4b, 0x4b, 0x47, 0x4b, 0x46, 0x7c, 0xba, 0xfd, 0xfa, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xf8, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf7, 0xf0, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf6, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xe8, 0xfa, 0xf9, 0xfa, 0xfa, 0x24, 0xc1, 0xa7, 0x55, 0x43, 0x47, 0x4b, 0x56, 0x57, 0x4f, 0x59, 0x54, 0x4b, 0x4a, 0x48, 0x89, 0xb8, 0x24, 0x24, 0x24, 0xaf, 0x3b, 0x40, 0x39, 0x4d, 0x29, 0x2f, 0x3b, 0x35, 0x39, 0x3b, 0x35, 0x45, 0x92, 0x29, 0x2e, 0x29, 0x2f, 0x2f, 0x2f, 0x32, 0x6f, 0x81, 0xbc, 0x24, 0xff, 0xfa, 0xc1, 0xba, 0x79, 0x2f, 0x40, 0x45, 0x39, 0x40, 0x2f, 0x75, 0x51, 0x35, 0x2f, 0x37, 0x2f, 0x3b, 0x2f, 0x45, 0x75, 0x39, 0x39, 0x29, 0x41, 0xac, 0xfd, 0xbf, 0xc1, 0xaf, 0x8e, 0x6c, 0x4e, 0x53, 0x5e, 0x5a, 0x57, 0x5e, 0x54, 0x54, 0x4e, 0x46, 0x4e, 0x55, 0xab, 0xc0, 0x24, 0xff, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf8, 0xf6, 0xf0, 0xf0, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf6, 0xf7, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xff, 0xbd, 0xfd, 0xc0, 0xaf, 0x92, 0x69, 0x4d, 0x3f, 0x45, 0x4d, 0x55, 0x77, 0xa2, 0xba, 0x24, 0x24, 0xbd, 0xff, 0xbf, 0xfd, 0xa7, 0x32, 0x40, 0x4d, 0x41, 0x2f, 0x3b, 0x2f, 0x2e, 0x39, 0x2f, 0x39, 0x92, 0x40, 0x2e, 0x3b, 0x3c, 0x35, 0x35, 0x25, 0xa7, 0xc1, 0xc1, 0xf7, 0xfa, 0xf9, 0xf7, 0xfd, 0xb7, 0x52, 0x2f, 0x41, 0x40, 0x40, 0x40, 0x7c, 0x4a, 0x3b, 0x2f, 0x2e, 0x35, 0x35, 0x35, 0x65, 0x62, 0x2f, 0x2f, 0x3b, 0xb2, 0xfd, 0xc0, 0xff, 0xbf, 0x24, 0x24, 0xbc, 0xb2, 0xa7, 0x7c, 0x55, 0x4d, 0x44, 0x45, 0x4d, 0x62, 0x81, 0xae, 0xbf, 0xfd, 0xbe, 0xc0, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xe9, 0xf9, 0xf7, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf8, 0xf8, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xfc, 0xfa, 0xff, 0xc0, 0x24, 0xc1, 0xbd, 0xb8, 0xb5, 0xb5, 0xb7, 0xb8, 0xbd, 0x24, 0xfb, 0xff, 0xfa, 0xfc, 0xff, 0xf8, 0x24, 0xc1, 0xa7, 0x25, 0x55, 0x49, 0x35, 0x35, 0x39, 0x39, 0x3f, 0x39, 0x2f, 0x83, 0x62, 0x2f, 0x35, 0x3c, 0x2d, 0x2d, 0x89, 0xbd, 0xfb, 0xfb, 0xfa, 0xf9, 0xfa, 0xfa, 0xf7, 0xfd, 0xb5, 0x71, 0x35, 0x41, 0x39, 0x47, 0x83, 0x4a, 0x35, 0x3b, 0x3b, 0x3c, 0x39, 0x3f, 0x75, 0x45, 0x2f, 0x60, 0xb5, 0xfd, 0xfa, 0xfa, 0xfa, 0xff, 0xfc, 0xc0, 0xc0, 0x24, 0xc1, 0xc1, 0xb9, 0xb7, 0xb4, 0xb5, 0xb7, 0xbb, 0x24, 0x24, 0xc1, 0xbe, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf7, 0xf7, 0xf6, 0xf0, 0xf2, 0xf6, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xe5, 0xf0, 0xf4, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf6, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xff, 0xfa, 0xe8, 0xfa, 0xe9, 0xf6, 0xfa, 0xf9, 0xfa, 0xf9, 0xfb, 0xfc, 0xc1, 0xfc, 0x24, 0x24, 0xc7, 0xfb, 0xf9, 0xbe, 0xfa, 0xf8, 0xf6, 0xfa, 0xfa, 0xf7, 0x24, 0xfd, 0xb0, 0x6f, 0x49, 0x2f, 0x29, 0x40, 0x3f, 0x39, 0x39, 0x39, 0x6f, 0x83, 0x29, 0x2f, 0x29, 0x77, 0xb2, 0x24, 0x24, 0xf9, 0xe8, 0xe8, 0xe8, 0xe8, 0xf7, 0xfd, 0xf7, 0x24, 0x24, 0xb2, 0x79, 0x45, 0x43, 0x75, 0x4a, 0x2f, 0x2f, 0x2f, 0x2e, 0x2f, 0x40, 0x6c, 0x5d, 0xab, 0xbd, 0xfd, 0xff, 0xf8, 0xfa, 0xf9, 0xfa, 0xf8, 0xf7, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0x24, 0xfb, 0x24, 0xc1, 0xff, 0xff, 0xfa, 0xf8, 0xe9, 0xe8, 0xf9, 0xfa, 0xfa, 0xff, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf8, 0xf6, 0xf0, 0xf0, 0xf6, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf7, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xfa, 0xf9, 0xfa, 0xe8, 0xfa, 0xf9, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xfa, 0xf9, 0xf9, 0xf9, 0xe8, 0xe9, 0xbe, 0xe9, 0xf9, 0xe8, 0xf9, 0xf9, 0xff, 0xff, 0x24, 0xc1, 0xaf, 0x89, 0x60, 0x44, 0x33, 0x3b, 0x35, 0x49, 0x77, 0xab, 0x8e, 0xaa, 0xb8, 0xc1, 0xfd, 0xc0, 0xf9, 0xe8, 0xe8, 0xe8, 0xe8, 0xf8, 0xe9, 0xf6, 0xff, 0xff, 0xff, 0x24, 0xfd, 0xba, 0xaf, 0xad, 0x89, 0x60, 0x60, 0x52, 0x60, 0x77, 0xa7, 0xb5, 0xbc, 0x24, 0xc1, 0xff, 0xfa, 0xf9, 0xf9, 0xe8, 0xe9, 0xe8, 0xea, 0xf9, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xff, 0xfa, 0xff, 0xfa, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf8, 0xf7, 0xf2, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf4, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf7, 0xf7, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xc0, 0xfd, 0xfd, 0xc0, 0xb7, 0xb3, 0xb1, 0xb3, 0xee, 0xbd, 0xc7, 0xfd, 0xfd, 0xeb, 0xfb, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfb, 0xc7, 0xfd, 0xfd, 0x24, 0xbe, 0xbe, 0xfb, 0xfd, 0xfd, 0xfd, 0xfb, 0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf4, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf4, 0xf2, 0xf2, 0xf0, 0xf0, 0xf0, 0xf2, 0xf6, 0xf7, 0xf8, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xc0, 0xff, 0xc0, 0xeb, 0xfd, 0x24, 0xeb, 0x24, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xbe, 0xf9, 0xfb, 0xeb, 0xe9, 0xc7, 0xfa, 0xff, 0xf8, 0xff, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf8, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 0xf7, 0xf6, 0xf6, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf0, 0xf2, 0xf2, 0xf6, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf7, 0xf8, 0xf6, 0xf6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf0, 0xf1, 0xf2, 0xf6, 0xf6, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xf8, 0xf9, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfc, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfb, 0xfa, 0xfb, 0xfa, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xfa, 0xe9, 0xfa, 0xfa, 0xfa, 0xf9, 0xf8, 0xf8, 0xf7, 0xf7, 0xf6, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf2, 0xf1, 0xf2, 0xf6, 0xf6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf6, 0xf5, 0xf2, 0xf5, 0xe3, 0xf0, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf6, 0xf7, 0xf7, 0xf8, 0xf8, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xfa, 0xfa, 0xe8, 0xf8, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf8, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xf7, 0xf7, 0xf6, 0xf1, 0xf1, 0xf6, 0xf6, 0xf2, 0xe3, 0xf0, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf5, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xe6, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf6, 0xf7, 0xf7, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xf9, 0xfa, 0xff, 0xfa, 0xf9, 0xf9, 0xff, 0xf9, 0xf8, 0xf8, 0xf7, 0xf7, 0xf5, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf0, 0xf6, 0xf2, 0xf6, 0xf2, 0xf2, 0xf6, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xe8, 0xbe, 0xe8, 0xbe, 0xe8, 0xf9, 0xe8, 0xf9, 0xe8, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xf8, 0xf9, 0xf8, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf4, 0xf4, 0xf5, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf2, 0xf6, 0xf2, 0xf6, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf1, 0xe6, 0xe6, 0xe6, 0xe6, 0xf5, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf0, 0xf0, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf4, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xe6, 0xf2, 0xe6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf4, 0xf6, 0xf4, 0xf4, 0xf6, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf0, 0xf4, 0xf2, 0xf4, 0xf2, 0xf0, 0xf0, 0xf4, 0xf2, 0xf4, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xe5, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf6, 0xf2, 0xf2, 0xf6, 0xf2, 0xf6, 0xf2, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf1, 0xf5, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf6, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xe5, 0xf2, 0xf2, 0xf0, 0xf2, 0xe5, 0xf2, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xe5, 0xf2, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xe5, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf2, 0xf2, 0xf0, 0xe5, 0xf1, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe5, 0xf1, 0xe5, 0xf1, 0xe5, 0xf1, 0xe5, 0xf1, 0xe5, 0xf1, 0xe5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xe5, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xe5, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf6, 0xf2, 0xf1, 0xf6, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf1, 0xf0, 0xf2, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xf2, 
-  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf2, 0xf6, 0xf2, 0xf5, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 
-  0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 
-};
-
-const lv_img_dsc_t image7 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image7_map,
-};
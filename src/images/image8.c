@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE8
-#define LV_ATTRIBUTE_IMG_IMAGE8
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE8 uint8_t image8_map[] = {
-  0xb9, 0xc7, 0xf3, 0xff, 	/*Color of index 0*/
-  0xae, 0xb8, 0xf4, 0xff, 	/*Color of index 1*/
-  0xae, 0xb5, 0xe6, 0xff, 	/*Color of index 2*/
-  0xab, 0xaa, 0xf8, 0xff, 	/*Color of index 3*/
-  0xb7, 0xb9, 0xc1, 0xff, 	/*Color of index 4*/
-  0xa2, 0xa8, 0xe6, 0xff, 	/*Color of index 5*/
-  0xac, 0xa8, 0xe2, 0xff, 	/*Color of index 6*/
-  0x9d, 0xa2, 0xf6, 0xff, 	/*Color of index 7*/
-  0x97, 0xa4, 0xe1, 0xff, 	/*Color of index 8*/
-  0xa6, 0xa4, 0xcf, 0xff, 	/*Color of index 9*/
-  0x9a, 0x99, 0xf0, 0xff, 	/*Color of index 10*/
-  0x97, 0x95, 0xfb, 0xff, 	/*Color of index 11*/
-  0xa6, 0xa4, 0xbe, 0xff, 	/*Color of index 12*/
-  0x91, 0x93, 0xfb, 0xff, 	/*Color of index 13*/
-  0x9e, 0x9a, 0xdf, 0xff, 	/*Color of index 14*/
-  0x90, 0x97, 0xed, 0xff, 	/*Color of index 15*/
-  0x93, 0x93, 0xf4, 0xff, 	/*Color of index 16*/
-  0x8e, 0x8f, 0xfb, 0xff, 	/*Color of index 17*/
-  0x8d, 0x91, 0xf4, 0xff, 	/*Color of index 18*/
-  0x8e, 0x97, 0xde, 0xff, 	/*Color of index 19*/
-  0x91, 0x8c, 0xfc, 0xff, 	/*Color of index 20*/
-  0x9a, 0x96, 0xc1, 0xff, 	/*Color of index 21*/
-  0x80, 0x8f, 0xde, 0xff, 	/*Color of index 22*/
-  0x85, 0x87, 0xf4, 0xff, 	/*Color of index 23*/
-  0x92, 0x91, 0xb2, 0xff, 	/*Color of index 24*/
-  0x7c, 0x7d, 0xec, 0xff, 	/*Color of index 25*/
-  0x8c, 0x89, 0xbe, 0xff, 	/*Color of index 26*/
-  0x8d, 0x8e, 0x9c, 0xff, 	/*Color of index 27*/
-  0x7d, 0x7b, 0xda, 0xff, 	/*Color of index 28*/
-  0x6b, 0x79, 0xe5, 0xff, 	/*Color of index 29*/
-  0x81, 0x81, 0xc1, 0xff, 	/*Color of index 30*/
-  0x72, 0x74, 0xe5, 0xff, 	/*Color of index 31*/
-  0x86, 0x84, 0x9d, 0xff, 	/*Color of index 32*/
-  0x79, 0x76, 0xcd, 0xff, 	/*Color of index 33*/
-  0x7a, 0x7b, 0xae, 0xff, 	/*Color of index 34*/
-  0x7f, 0x80, 0x90, 0xff, 	/*Color of index 35*/
-  0x52, 0x65, 0xd9, 0xff, 	/*Color of index 36*/
-  0x70, 0x70, 0x99, 0xff, 	/*Color of index 37*/
-  0x2b, 0x5c, 0xd8, 0xff, 	/*Color of index 38*/
-  0x71, 0x71, 0x78, 0xff, 	/*Color of index 39*/
-  0x4b, 0x61, 0xa4, 0xff, 	/*Color of index 40*/
-  0x5e, 0x5e, 0x7c, 0xff, 	/*Color of index 41*/
-  0x31, 0x4e, 0x94, 0xff, 	/*Color of index 42*/
-  0x4c, 0x51, 0x61, 0xff, 	/*Color of index 43*/
-  0x17, 0x3a, 0xa8, 0xff, 	/*Color of index 44*/
-  0x18, 0x29, 0x7e, 0xff, 	/*Color of index 45*/
-  0x0f, 0x16, 0x59, 0xff, 	/*Color of index 46*/
-  0x0e, 0x15, 0x44, 0xff, 	/*Color of index 47*/
-  0x18, 0x1b, 0x29, 0xff, 	/*Color of index 48*/
-  0x06, 0x09, 0x5f, 0xff, 	/*Color of index 49*/
-  0x01, 0x04, 0x4c, 0xff, 	/*Color of index 50*/
-  0x0a, 0x09, 0x1a, 0xff, 	/*Color of index 51*/
-  0xe6, 0xf9, 0xfc, 0xff, 	/*Color of index 52*/
-  0xe3, 0xf2, 0xfa, 0xff, 	/*Color of index 53*/
-  0xdb, 0xf2, 0xfc, 0xff, 	/*Color of index 54*/
-  0xd5, 0xf0, 0xfb, 0xff, 	/*Color of index 55*/
-  0xce, 0xee, 0xfc, 0xff, 	/*Color of index 56*/
-  0xd6, 0xec, 0xfb, 0xff, 	/*Color of index 57*/
-  0xd1, 0xec, 0xf6, 0xff, 	/*Color of index 58*/
-  0xd9, 0xec, 0xf3, 0xff, 	/*Color of index 59*/
-  0xcd, 0xea, 0xfc, 0xff, 	/*Color of index 60*/
-  0xd1, 0xea, 0xfa, 0xff, 	/*Color of index 61*/
-  0xc5, 0xe9, 0xfc, 0xff, 	/*Color of index 62*/
-  0xcc, 0xea, 0xf5, 0xff, 	/*Color of index 63*/
-  0xd2, 0xe6, 0xfe, 0xff, 	/*Color of index 64*/
-  0xd4, 0xe9, 0xec, 0xff, 	/*Color of index 65*/
-  0xcb, 0xe5, 0xfb, 0xff, 	/*Color of index 66*/
-  0xd2, 0xe6, 0xf2, 0xff, 	/*Color of index 67*/
-  0xae, 0xe5, 0xfd, 0xff, 	/*Color of index 68*/
-  0xc9, 0xe5, 0xf3, 0xff, 	/*Color of index 69*/
-  0xcb, 0xe1, 0xe4, 0xff, 	/*Color of index 70*/
-  0x99, 0xd9, 0xfb, 0xff, 	/*Color of index 71*/
-  0xc3, 0xd5, 0xf8, 0xff, 	/*Color of index 72*/
-  0xc0, 0xd3, 0xdb, 0xff, 	/*Color of index 73*/
-  0x74, 0xc6, 0xf5, 0xff, 	/*Color of index 74*/
-  0xb8, 0xc6, 0xd8, 0xff, 	/*Color of index 75*/
-  0x95, 0xc3, 0xde, 0xff, 	/*Color of index 76*/
-  0xb6, 0xc4, 0xc6, 0xff, 	/*Color of index 77*/
-  0x9e, 0xb6, 0xe2, 0xff, 	/*Color of index 78*/
-  0x7f, 0xb8, 0xdd, 0xff, 	/*Color of index 79*/
-  0xa4, 0xb5, 0xc1, 0xff, 	/*Color of index 80*/
-  0x57, 0xb0, 0xea, 0xff, 	/*Color of index 81*/
-  0x7c, 0xad, 0xce, 0xff, 	/*Color of index 82*/
-  0x16, 0xa6, 0xfc, 0xff, 	/*Color of index 83*/
-  0x08, 0xa9, 0xf6, 0xff, 	/*Color of index 84*/
-  0x41, 0xa3, 0xe7, 0xff, 	/*Color of index 85*/
-  0x15, 0x98, 0xf0, 0xff, 	/*Color of index 86*/
-  0x94, 0x9a, 0x9e, 0xff, 	/*Color of index 87*/
-  0x3b, 0x95, 0xcd, 0xff, 	/*Color of index 88*/
-  0x16, 0x8d, 0xda, 0xff, 	/*Color of index 89*/
-  0x2e, 0x82, 0xef, 0xff, 	/*Color of index 90*/
-  0x55, 0x86, 0xc7, 0xff, 	/*Color of index 91*/
-  0x0a, 0x7f, 0xea, 0xff, 	/*Color of index 92*/
-  0x86, 0x89, 0x8b, 0xff, 	/*Color of index 93*/
-  0x2d, 0x71, 0xf6, 0xff, 	/*Color of index 94*/
-  0x15, 0x81, 0xc7, 0xff, 	/*Color of index 95*/
-  0x7a, 0x7c, 0x80, 0xff, 	/*Color of index 96*/
-  0x08, 0x6a, 0xe3, 0xff, 	/*Color of index 97*/
-  0x23, 0x71, 0xb9, 0xff, 	/*Color of index 98*/
-  0x1c, 0x4f, 0xa7, 0xff, 	/*Color of index 99*/
-  0x32, 0x37, 0x42, 0xff, 	/*Color of index 100*/
-  0x26, 0x2b, 0x30, 0xff, 	/*Color of index 101*/
-  0xe3, 0xf4, 0xf0, 0xff, 	/*Color of index 102*/
-  0xda, 0xf1, 0xf3, 0xff, 	/*Color of index 103*/
-  0xcf, 0xdb, 0xdb, 0xff, 	/*Color of index 104*/
-  0x97, 0xaa, 0xa7, 0xff, 	/*Color of index 105*/
-  0x5f, 0x61, 0x61, 0xff, 	/*Color of index 106*/
-  0x43, 0x46, 0x45, 0xff, 	/*Color of index 107*/
-  0x16, 0x1a, 0x19, 0xff, 	/*Color of index 108*/
-  0xfa, 0xfe, 0xfc, 0xff, 	/*Color of index 109*/
-  0xe8, 0xf7, 0xec, 0xff, 	/*Color of index 110*/
-  0xdd, 0xe8, 0xdd, 0xff, 	/*Color of index 111*/
-  0xc4, 0xcc, 0xc6, 0xff, 	/*Color of index 112*/
-  0xa7, 0xb6, 0xa7, 0xff, 	/*Color of index 113*/
-  0xf6, 0xfa, 0xf2, 0xff, 	/*Color of index 114*/
-  0xe6, 0xf0, 0xe0, 0xff, 	/*Color of index 115*/
-  0xd9, 0xe3, 0xcc, 0xff, 	/*Color of index 116*/
-  0xd2, 0xda, 0xc1, 0xff, 	/*Color of index 117*/
-  0xca, 0xd0, 0xbe, 0xff, 	/*Color of index 118*/
-  0xc0, 0xc8, 0xae, 0xff, 	/*Color of index 119*/
-  0xb2, 0xb5, 0xaf, 0xff, 	/*Color of index 120*/
-  0xf2, 0xf8, 0xde, 0xff, 	/*Color of index 121*/
-  0xfa, 0xf9, 0xc3, 0xff, 	/*Color of index 122*/
-  0xe3, 0xeb, 0xd0, 0xff, 	/*Color of index 123*/
-  0xec, 0xe1, 0xac, 0xff, 	/*Color of index 124*/
-  0xe1, 0xd9, 0xaf, 0xff, 	/*Color of index 125*/
-  0xe8, 0xdb, 0x97, 0xff, 	/*Color of index 126*/
-  0xe0, 0xd6, 0xa1, 0xff, 	/*Color of index 127*/
-  0xcd, 0xd2, 0xb2, 0xff, 	/*Color of index 128*/
-  0xde, 0xd1, 0x96, 0xff, 	/*Color of index 129*/
-  0xdf, 0xd3, 0x8a, 0xff, 	/*Color of index 130*/
-  0xcd, 0xcb, 0xa6, 0xff, 	/*Color of index 131*/
-  0xd7, 0xcd, 0x80, 0xff, 	/*Color of index 132*/
-  0xcc, 0xc6, 0x97, 0xff, 	/*Color of index 133*/
-  0xbf, 0xc2, 0xa0, 0xff, 	/*Color of index 134*/
-  0xcf, 0xc5, 0x8b, 0xff, 	/*Color of index 135*/
-  0xd0, 0xc5, 0x7d, 0xff, 	/*Color of index 136*/
-  0xb8, 0xbb, 0x9c, 0xff, 	/*Color of index 137*/
-  0xc3, 0xbe, 0x8d, 0xff, 	/*Color of index 138*/
-  0xc0, 0xc0, 0x81, 0xff, 	/*Color of index 139*/
-  0xcc, 0xc1, 0x73, 0xff, 	/*Color of index 140*/
-  0xb9, 0xba, 0x8e, 0xff, 	/*Color of index 141*/
-  0xc8, 0xbb, 0x7a, 0xff, 	/*Color of index 142*/
-  0xb0, 0xb5, 0x95, 0xff, 	/*Color of index 143*/
-  0xc4, 0xc0, 0x69, 0xff, 	/*Color of index 144*/
-  0xce, 0xbe, 0x6b, 0xff, 	/*Color of index 145*/
-  0xc0, 0xb8, 0x7d, 0xff, 	/*Color of index 146*/
-  0xaf, 0xaf, 0x9f, 0xff, 	/*Color of index 147*/
-  0xc9, 0xba, 0x71, 0xff, 	/*Color of index 148*/
-  0xc8, 0xba, 0x6b, 0xff, 	/*Color of index 149*/
-  0xc7, 0xbe, 0x5c, 0xff, 	/*Color of index 150*/
-  0xb6, 0xb1, 0x8d, 0xff, 	/*Color of index 151*/
-  0xce, 0xbb, 0x63, 0xff, 	/*Color of index 152*/
-  0xc2, 0xb7, 0x72, 0xff, 	/*Color of index 153*/
-  0xc2, 0xba, 0x64, 0xff, 	/*Color of index 154*/
-  0xba, 0xb3, 0x7d, 0xff, 	/*Color of index 155*/
-  0xc4, 0xb7, 0x6b, 0xff, 	/*Color of index 156*/
-  0xb2, 0xb1, 0x83, 0xff, 	/*Color of index 157*/
-  0xc8, 0xb7, 0x64, 0xff, 	/*Color of index 158*/
-  0xc3, 0xb5, 0x6a, 0xff, 	/*Color of index 159*/
-  0xbe, 0xb3, 0x72, 0xff, 	/*Color of index 160*/
-  0xc9, 0xb4, 0x6a, 0xff, 	/*Color of index 161*/
-  0xbc, 0xb3, 0x6b, 0xff, 	/*Color of index 162*/
-  0xb3, 0xb2, 0x71, 0xff, 	/*Color of index 163*/
-  0xc2, 0xb3, 0x64, 0xff, 	/*Color of index 164*/
-  0xb2, 0xad, 0x7b, 0xff, 	/*Color of index 165*/
-  0xab, 0xa7, 0x91, 0xff, 	/*Color of index 166*/
-  0xc0, 0xaf, 0x6b, 0xff, 	/*Color of index 167*/
-  0xb2, 0xab, 0x71, 0xff, 	/*Color of index 168*/
-  0xbe, 0xaf, 0x5c, 0xff, 	/*Color of index 169*/
-  0xad, 0xa5, 0x7f, 0xff, 	/*Color of index 170*/
-  0xba, 0xac, 0x62, 0xff, 	/*Color of index 171*/
-  0xbb, 0xad, 0x51, 0xff, 	/*Color of index 172*/
-  0xb7, 0xa6, 0x5e, 0xff, 	/*Color of index 173*/
-  0xa0, 0x9d, 0x7e, 0xff, 	/*Color of index 174*/
-  0xa7, 0x9f, 0x6f, 0xff, 	/*Color of index 175*/
-  0xb0, 0x9f, 0x51, 0xff, 	/*Color of index 176*/
-  0xa4, 0x99, 0x5f, 0xff, 	/*Color of index 177*/
-  0xae, 0x9b, 0x44, 0xff, 	/*Color of index 178*/
-  0x98, 0x91, 0x6c, 0xff, 	/*Color of index 179*/
-  0x95, 0x8d, 0x5d, 0xff, 	/*Color of index 180*/
-  0xa2, 0x92, 0x41, 0xff, 	/*Color of index 181*/
-  0x88, 0x86, 0x6e, 0xff, 	/*Color of index 182*/
-  0x99, 0x8c, 0x45, 0xff, 	/*Color of index 183*/
-  0x8a, 0x81, 0x5d, 0xff, 	/*Color of index 184*/
-  0x98, 0x88, 0x3a, 0xff, 	/*Color of index 185*/
-  0xa2, 0x8a, 0x28, 0xff, 	/*Color of index 186*/
-  0x86, 0x7e, 0x50, 0xff, 	/*Color of index 187*/
-  0x7b, 0x75, 0x61, 0xff, 	/*Color of index 188*/
-  0x9a, 0x82, 0x29, 0xff, 	/*Color of index 189*/
-  0x9c, 0x82, 0x22, 0xff, 	/*Color of index 190*/
-  0x83, 0x7b, 0x3f, 0xff, 	/*Color of index 191*/
-  0x8e, 0x7b, 0x2e, 0xff, 	/*Color of index 192*/
-  0x79, 0x71, 0x4e, 0xff, 	/*Color of index 193*/
-  0x90, 0x79, 0x21, 0xff, 	/*Color of index 194*/
-  0x7e, 0x72, 0x3d, 0xff, 	/*Color of index 195*/
-  0x6a, 0x68, 0x63, 0xff, 	/*Color of index 196*/
-  0x84, 0x71, 0x2b, 0xff, 	/*Color of index 197*/
-  0x6f, 0x6d, 0x3e, 0xff, 	/*Color of index 198*/
-  0x6d, 0x67, 0x4d, 0xff, 	/*Color of index 199*/
-  0x8a, 0x71, 0x21, 0xff, 	/*Color of index 200*/
-  0x8c, 0x70, 0x1b, 0xff, 	/*Color of index 201*/
-  0x77, 0x6b, 0x2e, 0xff, 	/*Color of index 202*/
-  0x84, 0x6d, 0x1f, 0xff, 	/*Color of index 203*/
-  0x62, 0x65, 0x3f, 0xff, 	/*Color of index 204*/
-  0x7c, 0x69, 0x1e, 0xff, 	/*Color of index 205*/
-  0x62, 0x5d, 0x4f, 0xff, 	/*Color of index 206*/
-  0x6c, 0x61, 0x3d, 0xff, 	/*Color of index 207*/
-  0x65, 0x65, 0x31, 0xff, 	/*Color of index 208*/
-  0x73, 0x62, 0x2c, 0xff, 	/*Color of index 209*/
-  0x74, 0x63, 0x1c, 0xff, 	/*Color of index 210*/
-  0x5b, 0x55, 0x40, 0xff, 	/*Color of index 211*/
-  0x63, 0x58, 0x2e, 0xff, 	/*Color of index 212*/
-  0x6c, 0x5c, 0x1a, 0xff, 	/*Color of index 213*/
-  0x5e, 0x53, 0x1a, 0xff, 	/*Color of index 214*/
-  0x55, 0x4a, 0x29, 0xff, 	/*Color of index 215*/
-  0x4c, 0x42, 0x22, 0xff, 	/*Color of index 216*/
-  0x52, 0x44, 0x0f, 0xff, 	/*Color of index 217*/
-  0x5b, 0x45, 0x03, 0xff, 	/*Color of index 218*/
-  0x42, 0x3a, 0x25, 0xff, 	/*Color of index 219*/
-  0x4c, 0x3b, 0x12, 0xff, 	/*Color of index 220*/
-  0x3f, 0x33, 0x14, 0xff, 	/*Color of index 221*/
-  0x31, 0x27, 0x09, 0xff, 	/*Color of index 222*/
-  0x95, 0x91, 0x8c, 0xff, 	/*Color of index 223*/
-  0x35, 0x2b, 0x16, 0xff, 	/*Color of index 224*/
-  0x28, 0x21, 0x19, 0xff, 	/*Color of index 225*/
-  0x2a, 0x1f, 0x07, 0xff, 	/*Color of index 226*/
-  0x24, 0x1c, 0x13, 0xff, 	/*Color of index 227*/
-  0x22, 0x19, 0x16, 0xff, 	/*Color of index 228*/
-  0x1e, 0x19, 0x15, 0xff, 	/*Color of index 229*/
-  0x22, 0x1a, 0x0c, 0xff, 	/*Color of index 230*/
-  0x24, 0x1a, 0x03, 0xff, 	/*Color of index 231*/
-  0x1e, 0x13, 0x0a, 0xff, 	/*Color of index 232*/
-  0x20, 0x14, 0x02, 0xff, 	/*Color of index 233*/
-  0x19, 0x11, 0x02, 0xff, 	/*Color of index 234*/
-  0x16, 0x0c, 0x02, 0xff, 	/*Color of index 235*/
-  0x08, 0x04, 0x01, 0xff, 	/*Color of index 236*/
-  0x25, 0x1c, 0x1b, 0xff, 	/*Color of index 237*/
-  0x1f, 0x19, 0x19, 0xff, 	/*Color of index 238*/
-  0x22, 0x18, 0x18, 0xff, 	/*Color of index 239*/
-  0x22, 0x16, 0x19, 0xff, 	/*Color of index 240*/
-  0x28, 0x14, 0x1b, 0xff, 	/*Color of index 241*/
-  0x20, 0x16, 0x16, 0xff, 	/*Color of index 242*/
-  0x1b, 0x13, 0x14, 0xff, 	/*Color of index 243*/
-  0x17, 0x11, 0x11, 0xff, 	/*Color of index 244*/
-  0x17, 0x0c, 0x0c, 0xff, 	/*Color of index 245*/
-  0x14, 0x0b, 0x0b, 0xff, 	/*Color of index 246*/
-  0x13, 0x03, 0x0a, 0xff, 	/*Color of index 247*/
-  0x13, 0x02, 0x02, 0xff, 	/*Color of index 248*/
-  0x04, 0x00, 0x01, 0xff, 	/*Color of index 249*/
-  0xa8, 0xa3, 0xa8, 0xff, 	/*Color of index 250*/
-  0x22, 0x19, 0x1e, 0xff, 	/*Color of index 251*/
-  0x1e, 0x16, 0x1a, 0xff, 	/*Color of index 252*/
-  0x20, 0x14, 0x1f, 0xff, 	/*Color of index 253*/
-  0x15, 0x09, 0x11, 0xff, 	/*Color of index 254*/
-  0x09, 0x06, 0x08, 0xff, 	/*Color of index 255*/
-
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xe4, 0xe4, 0xe5, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xe5, 0xe4, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xe4, 0xe3, 0xe3, 0xe3, 0xe6, 0xe5, 0xee, 0xfd, 0xfc, 0xe3, 0xe4, 0xe4, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xe3, 0xe5, 0xee, 0xfc, 0xfc, 0xfd, 0xfb, 0xed, 0xef, 0xfb, 0xfd, 0xfb, 0xf0, 0xe4, 0xe3, 0xe5, 0xe3, 0xf2, 0xfc, 0xfd, 0xf2, 0xe3, 0xe3, 0xe3, 0xf3, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xe4, 0xe3, 0xe5, 0xee, 0xfb, 0xfc, 0xfb, 0xef, 0xf5, 0xef, 0xe4, 0xfd, 0xfd, 0xfd, 0xfb, 0xf2, 0xed, 0xf3, 0xed, 0xfb, 0xfc, 0xe3, 0xe9, 0xea, 0xe8, 0xe1, 0xf4, 0xef, 0xfb, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf2, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe5, 0xe3, 0xee, 0xe4, 0xfb, 0xf0, 0xf1, 0xed, 0x6b, 0xe3, 0xea, 0xfb, 0xfb, 0xf1, 0xfd, 0xfd, 0xf3, 0xfb, 0xed, 0xe8, 0xeb, 0xe2, 0xdb, 0xce, 0xd3, 0xe8, 0xed, 0xf0, 0xfc, 0xee, 0xee, 0xe5, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf2, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xe5, 0xe3, 0x6c, 0xef, 0xef, 0xf0, 0xef, 0xe8, 0x6b, 0x8f, 0xd7, 0xf5, 0xe6, 0xfb, 0xfc, 0xfd, 0xf0, 0xed, 0xea, 0xe2, 0xc7, 0xaa, 0x89, 0xb8, 0xe1, 0xe8, 0xef, 0xf0, 0xfb, 0xef, 0xee, 0xe5, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xf2, 0xf2, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe5, 0xe3, 0xe5, 0xef, 0xfb, 0xef, 0xed, 0xe8, 0xe2, 0x93, 0x83, 0xdb, 0xeb, 0xe1, 0xfc, 0xfb, 0xf2, 0xf7, 0xdd, 0xaf, 0x81, 0x81, 0xb3, 0xde, 0xe9, 0xe3, 0xf0, 0xef, 0xfc, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xe3, 0x6c, 0xe4, 0xf0, 0xed, 0xf3, 0xe1, 0xeb, 0xcf, 0x83, 0x85, 0xdd, 0xe7, 0xf2, 0xed, 0xea, 0xd3, 0x8a, 0x81, 0x88, 0xb1, 0xe0, 0xe9, 0xe1, 0xe8, 0xed, 0xef, 0xfb, 0xed, 0xf2, 0xe5, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 
-  0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xe3, 0xe3, 0xe4, 0xe4, 0xef, 0xef, 0xe4, 0xe3, 0xe6, 0xe0, 0x97, 0x7f, 0xb4, 0xe9, 0xe4, 0xe9, 0xd8, 0x8a, 0x84, 0x99, 0x8e, 0xd8, 0xe2, 0xe6, 0xe1, 0xe6, 0xe8, 0xe8, 0xeb, 0xf5, 0xf3, 0xe1, 0xe4, 0xe4, 0xe4, 0xef, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xf1, 0xf0, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xe5, 0xee, 0xe5, 0xee, 0xe4, 0xee, 0xe4, 0xe4, 0xee, 0xef, 0xee, 0xe4, 0xee, 0xf0, 0xfd, 0xfb, 0xf3, 0xed, 0xe1, 0xea, 0xbc, 0x87, 0x7f, 0xcf, 0xeb, 0xe2, 0x8a, 0x84, 0x94, 0x84, 0xb4, 0xe9, 0xe7, 0xea, 0xe7, 0xe1, 0xdb, 0x6b, 0xc4, 0x6a, 0xe1, 0xf3, 0xe4, 0xe3, 0xe4, 0xe4, 0xee, 0xe4, 0xef, 0xee, 0xef, 0xfb, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xef, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xe5, 0xe3, 0xe5, 0xe3, 0xee, 0xe3, 0xe4, 0xe5, 0xee, 0xe4, 0xee, 0xfc, 0xfb, 0xfd, 0xfd, 0xfd, 0xfd, 0xe4, 0xed, 0xea, 0xdb, 0x8a, 0x87, 0x97, 0xe2, 0xb8, 0x81, 0x88, 0x90, 0x94, 0xdc, 0xdc, 0xcc, 0xb8, 0x97, 0x89, 0x76, 0x68, 0xa6, 0x64, 0xfb, 0xf2, 0xee, 0xe5, 0xe4, 0xe5, 0xe4, 0xe4, 0xee, 0xef, 0xee, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xe4, 0xe5, 0xe4, 0xe5, 0xe3, 0x6c, 0xe4, 0x6c, 0xe3, 0x6c, 0xee, 0xfb, 0xfc, 0xfd, 0xfd, 0xfd, 0xfb, 0xef, 0xe4, 0xe3, 0xe9, 0xb1, 0x87, 0x81, 0xc3, 0x88, 0x88, 0x9a, 0x84, 0x9f, 0xb1, 0x8a, 0x7c, 0x8a, 0x89, 0x7d, 0x83, 0xd3, 0xf8, 0xe8, 0xf3, 0xf3, 0xee, 0xee, 0xe5, 0xee, 0xe5, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xe4, 0xfb, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xe4, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xe5, 0xe5, 0xee, 0xef, 0xee, 0xe4, 0xe4, 0xe8, 0xe6, 0xe9, 0xeb, 0xd5, 0x8e, 0x87, 0x8e, 0x84, 0x84, 0x8c, 0x84, 0x88, 0x87, 0x87, 0xb7, 0x87, 0x87, 0xb8, 0xdd, 0xeb, 0xe6, 0xe8, 0xfb, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xef, 0xf2, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xef, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xef, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xef, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xef, 0xf2, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfd, 0xfd, 0xf0, 0xfb, 0xfc, 0xee, 0xef, 0xe5, 0xee, 0xee, 0xe3, 0xe2, 0xe9, 0xe9, 0xe9, 0xea, 0xe7, 0xde, 0xdd, 0xd7, 0xd0, 0xbf, 0x99, 0x88, 0x82, 0x82, 0x90, 0x84, 0x84, 0x8c, 0x87, 0xad, 0xb9, 0xab, 0xbf, 0xdd, 0xde, 0xde, 0xe7, 0xea, 0xea, 0xf8, 0xf5, 0xf3, 0xe4, 0xe4, 0xee, 0xf3, 0xfb, 0xee, 0xfc, 0xfb, 0xfc, 0xee, 0xed, 0xf2, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xee, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xee, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xee, 0xef, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xef, 0xfd, 0xfd, 0xfb, 0xf1, 0xef, 0xed, 0xed, 0xe3, 0xe8, 0xea, 0xe9, 0xde, 0xdd, 0xd4, 0xc1, 0xaf, 0x9b, 0x85, 0x7f, 0x7c, 0x7f, 0x7e, 0x82, 0x84, 0x84, 0x84, 0x82, 0x84, 0x8c, 0x88, 0x8c, 0x88, 0x84, 0x84, 0x7e, 0x7e, 0x81, 0x85, 0x8d, 0xa5, 0xb6, 0xc1, 0xd7, 0xdb, 0xe6, 0xea, 0xe8, 0xf2, 0xe5, 0xf2, 0xee, 0xfc, 0xf2, 0xee, 0xf2, 0xf3, 0xed, 0xf2, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xe4, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf2, 0xef, 0xe4, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xfb, 0xfb, 0xfb, 0xf2, 0xe3, 0xea, 0xe9, 0xe9, 0xde, 0xd7, 0xbb, 0xaf, 0x81, 0x7f, 0x7f, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x82, 0x7e, 0x82, 0x82, 0x82, 0x88, 0x8c, 0x8c, 0x91, 0x88, 0x82, 0x7e, 0x82, 0x82, 0x7c, 0x7e, 0x7f, 0x7c, 0x7c, 0x7c, 0x7d, 0x86, 0xaa, 0xbc, 0xd7, 0xe3, 0xeb, 0xe8, 0xe6, 0xe8, 0xe1, 0xf2, 0xef, 0xef, 0xee, 0xf3, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xf2, 0xe4, 0xe4, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xf2, 0xef, 0xe4, 0xf2, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xf2, 0xe4, 0xe4, 0xf2, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf2, 0xe4, 0xe4, 0xf2, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xf2, 0xe4, 0xf2, 0xe4, 
-  0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe5, 0xf2, 0xe6, 0xe7, 0xe9, 0xdd, 0xcf, 0xaf, 0x85, 0x7c, 0x7c, 0x7c, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x84, 0x84, 0x91, 0x88, 0x84, 0x94, 0x94, 0x95, 0x90, 0x90, 0x95, 0x91, 0x88, 0x82, 0x84, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x81, 0xae, 0xd4, 0xe0, 0xe9, 0xea, 0xf2, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xf0, 0xf2, 0xf0, 0xf2, 0xef, 0xf2, 0xed, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xf2, 0xf0, 0xf2, 0xed, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xf2, 0xf0, 0xf2, 0xed, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xf2, 0xf0, 0xf2, 0xf0, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xf0, 0xf2, 0xf0, 0xf0, 0xf0, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xe8, 0xe6, 0xe7, 0xd7, 0xb3, 0x85, 0x7f, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x88, 0x91, 0x91, 0x94, 0x9c, 0x9f, 0x95, 0x99, 0x9c, 0x9b, 0x8e, 0x99, 0x90, 0x90, 0x96, 0x99, 0x94, 0x95, 0x95, 0x95, 0x9e, 0x90, 0x84, 0x84, 0x7e, 0x82, 0x7e, 0x7e, 0x7c, 0x7e, 0x7c, 0x7c, 0x7d, 0x86, 0xb8, 0xd7, 0xf0, 0xf6, 0xef, 0xed, 0xf2, 0xe4, 0xef, 0xef, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf2, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf2, 0xf0, 0xf2, 
-  0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xfc, 0xf3, 0xee, 0xfb, 0xe4, 0xe4, 0xe5, 0xea, 0xea, 0xde, 0xbb, 0x8d, 0x7c, 0x7c, 0x7e, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x82, 0x87, 0x8c, 0x99, 0xa1, 0xa4, 0xa4, 0xa1, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x94, 0x94, 0x9c, 0x94, 0x94, 0x95, 0x91, 0x95, 0x95, 0x9f, 0x9f, 0x9c, 0x9c, 0x95, 0x9e, 0xa4, 0x9e, 0xa4, 0x91, 0x8c, 0x84, 0x82, 0x7e, 0x7e, 0x7c, 0x7f, 0x7e, 0x7c, 0x7d, 0xa6, 0xcf, 0xe7, 0xea, 0xe6, 0xe3, 0xed, 0xed, 0xfc, 0xfd, 0xef, 0xef, 0xe3, 0xe4, 0xe4, 0xe5, 0xe5, 0xe4, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xe4, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xf0, 0xfc, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xfc, 0xef, 0xf0, 0xf0, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0x6c, 0xfc, 0x6c, 0xee, 0xe5, 0xee, 0xe5, 0xed, 0xef, 0xee, 0xf3, 0xed, 0xed, 0xfc, 0xfc, 0xf2, 0xe4, 0xe8, 0xe9, 0xdb, 0xb4, 0x81, 0x7c, 0x7c, 0x81, 0x7e, 0x7e, 0x7e, 0x7e, 0x84, 0x88, 0x9c, 0x95, 0x9f, 0xa4, 0x9f, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x95, 0x95, 0x9c, 0x95, 0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x99, 0xa7, 0xa7, 0xa0, 0x99, 0x8e, 0x84, 0x7e, 0x7e, 0x7e, 0x82, 0x7f, 0x7c, 0x97, 0xc6, 0xe1, 0xe9, 0xe4, 0xf4, 0xfc, 0xfb, 0xfb, 0xe4, 0xe4, 0xe4, 0xe5, 0xe3, 0x6c, 0xe3, 0xe5, 0xe4, 0xe4, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xfb, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0x6c, 0xf3, 0xfc, 0xe5, 0xe3, 0xe3, 0xeb, 0xe6, 0xb8, 0x80, 0x7d, 0x7f, 0x81, 0x7e, 0x7e, 0x7e, 0x82, 0x88, 0x9f, 0xa4, 0x9f, 0x9c, 0x9c, 0x95, 0x94, 0x94, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x94, 0x9c, 0x94, 0x9c, 0x95, 0x95, 0x95, 0x95, 0x94, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0xa2, 0x99, 0xa1, 0x99, 0xa7, 0xa7, 0xa1, 0x8e, 0x82, 0x7c, 0x7f, 0x81, 0x7d, 0x7d, 0x8a, 0xd3, 0xe9, 0xe6, 0xf2, 0xf4, 0xef, 0xe4, 0xe4, 0xe4, 0xe5, 0x6c, 0xe3, 0x6c, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xef, 0xe4, 0xf0, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xfc, 0xfc, 0xee, 0xee, 0xe3, 0xe5, 0xe3, 0xe8, 0xe7, 0xc7, 0x7d, 0x7d, 0x81, 0x81, 0x7e, 0x7e, 0x82, 0x88, 0x99, 0xab, 0xa2, 0x95, 0x94, 0xa4, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x95, 0x9c, 0x94, 0x95, 0x95, 0x95, 0x9c, 0x94, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x94, 0x9c, 0x99, 0xa4, 0x9f, 0x9c, 0x99, 0x9f, 0xa4, 0xa4, 0x88, 0x81, 0x7e, 0x81, 0x7f, 0x7d, 0x89, 0xd7, 0xe7, 0xe2, 0xe3, 0xef, 0xef, 0xee, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xee, 0xed, 0xef, 0xfb, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xe4, 0xee, 0xf0, 0xef, 0xf0, 0xfc, 0xfb, 0xfc, 0xee, 0xee, 0xe5, 0xe6, 0xe1, 0xec, 0xdd, 0x97, 0x7d, 0x7f, 0x7e, 0x7f, 0x7e, 0x81, 0x8c, 0xa0, 0xab, 0x9f, 0x8c, 0x95, 0x9f, 0xa4, 0x95, 0x95, 0x9c, 0x9c, 0x9c, 0x95, 0x94, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x94, 0x9c, 0x94, 0x9c, 0x94, 0x95, 0x95, 0x94, 0x95, 0x94, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0xa4, 0x9f, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9f, 0x95, 0x94, 0x9f, 0x9c, 0x88, 0x82, 0x7f, 0x81, 0x83, 0x7f, 0xb3, 0xde, 0xeb, 0xe4, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xfb, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xef, 0xef, 0xef, 0xf0, 0xfb, 0xfb, 0xf2, 0xee, 0xee, 0xed, 0xe3, 0xe9, 0xe7, 0xb6, 0x7c, 0x7d, 0x7f, 0x7e, 0x82, 0x82, 0x91, 0xa4, 0xa4, 0x94, 0x95, 0x9c, 0x9f, 0x9f, 0x9a, 0x95, 0x9e, 0x9f, 0x95, 0x9c, 0x9c, 0x9f, 0xa4, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x95, 0x95, 0x9c, 0x9f, 0xa4, 0xa4, 0x9a, 0xa4, 0xa4, 0x8c, 0x7e, 0x7e, 0x81, 0x7c, 0x85, 0xc7, 0xeb, 0xe6, 0xe1, 0xe5, 0xee, 0xee, 0xfc, 0x6c, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xee, 0xe4, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xef, 0xf0, 0xf0, 0xfb, 0xf0, 0xef, 0xe4, 0xe3, 0xe8, 0xea, 0xdb, 0xae, 0x7d, 0x7f, 0x81, 0x7e, 0x82, 0x8c, 0x9e, 0x9e, 0xa1, 0x9c, 0xa1, 0x9c, 0x9e, 0x95, 0x9e, 0x9c, 0x9e, 0x9a, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9a, 0x9c, 0x9a, 0x9c, 0x9e, 0x9f, 0x9a, 0x9c, 0x9a, 0x9e, 0x9e, 0x9e, 0x9c, 0xa2, 0x99, 0x84, 0x81, 0x7e, 0x7e, 0x85, 0xae, 0xe8, 0xe9, 0xe8, 0xe1, 0xfc, 0xee, 0xee, 0xfc, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xf0, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xf0, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xee, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xe4, 0xf0, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xf0, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xee, 0xf0, 0xfb, 0xf0, 0xf0, 0xe4, 0xe3, 0xe6, 0xe9, 0xcf, 0x85, 0x7c, 0x7f, 0x7e, 0x82, 0x88, 0x9e, 0xa4, 0x9e, 0x9e, 0x95, 0x9e, 0x95, 0x9e, 0x9c, 0x9e, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9a, 0x9f, 0x9e, 0x9f, 0xa4, 0xa7, 0x94, 0x84, 0x7e, 0x7f, 0x7d, 0x8d, 0xd8, 0xea, 0xe3, 0xe5, 0xf2, 0xed, 0xf2, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 
-  0xee, 0xef, 0xed, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xe4, 0xef, 0xe4, 0xfb, 0xe4, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xed, 0xef, 0xed, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xfc, 0xef, 0xef, 0xed, 0xe6, 0xe6, 0xe7, 0xbc, 0x7f, 0x7e, 0x81, 0x7e, 0x82, 0x95, 0xa4, 0x9e, 0x91, 0x95, 0x9e, 0x9e, 0x95, 0xa1, 0x95, 0x9f, 0x95, 0x9c, 0x9e, 0x9c, 0x9e, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9e, 0x9c, 0x9e, 0xa1, 0x9c, 0x9f, 0x9c, 0x9c, 0xa7, 0xa2, 0x88, 0x82, 0x7e, 0x7f, 0x83, 0xd7, 0xe9, 0xe5, 0xe1, 0xed, 0xed, 0xf2, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xfc, 0xef, 0xf0, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xe4, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xef, 0xf0, 0xf0, 0xe4, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xf0, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xfc, 0xef, 0xf0, 0xef, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xe4, 0xf0, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xe4, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xee, 0xef, 0xed, 0xef, 0xe4, 0xf0, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xf2, 0xf0, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0x6c, 0xee, 0x6c, 0xfb, 0xf2, 0xe4, 0xe8, 0xea, 0xb3, 0x7c, 0x7f, 0x7e, 0x7e, 0x8c, 0xa4, 0x9a, 0x95, 0x95, 0x9a, 0x9f, 0x9f, 0x9c, 0x9e, 0x9c, 0x9e, 0x9c, 0x9e, 0xa1, 0x9c, 0xa1, 0x9c, 0xa1, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xab, 0x94, 0x94, 0x9f, 0xa2, 0x91, 0x82, 0x7e, 0x7f, 0x80, 0xc7, 0xec, 0xf2, 0xf3, 0xed, 0xe1, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xee, 0xe5, 0xee, 0xe5, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xf0, 0xee, 0xe5, 0xee, 0xe5, 0xfb, 0xe4, 0xfb, 0xe4, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xe5, 0xef, 0xe5, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xee, 0xe5, 0xef, 
-  0xef, 0xed, 0xef, 0xed, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xef, 0xf0, 0xef, 0xed, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xee, 0xe5, 0x6c, 0x6c, 0xee, 0xf2, 0xed, 0xe8, 0xde, 0xae, 0x7c, 0x7f, 0x82, 0x82, 0x95, 0x9f, 0x91, 0x9c, 0x9a, 0x95, 0x9f, 0x9f, 0x95, 0xa1, 0x95, 0xa1, 0x9c, 0xa1, 0x9c, 0x9c, 0xa1, 0x9c, 0xa1, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x99, 0x9c, 0x9c, 0x9c, 0x95, 0x95, 0x9c, 0x99, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0xa0, 0xa1, 0xa0, 0x99, 0xa2, 0x9f, 0x9c, 0x95, 0xa4, 0x9a, 0x88, 0x81, 0x7f, 0x7d, 0xc1, 0xea, 0xe3, 0xe4, 0xf2, 0xfb, 0xef, 0xf0, 0xed, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xfc, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xfc, 0xe5, 0xee, 0xee, 0xee, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfb, 0xe4, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xee, 0xee, 0xee, 0xe4, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xf0, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xee, 0xee, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xe4, 0xfb, 0xe4, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xe4, 0xfb, 0xe4, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xfb, 0xf0, 0xf0, 0xf0, 0xef, 0xe4, 0xe4, 0xe4, 0xe3, 0xe4, 0xee, 0x6c, 0xee, 0xf2, 0xed, 0xe8, 0xe7, 0xae, 0x7f, 0x81, 0x82, 0x84, 0x96, 0x9a, 0x9a, 0x94, 0x9a, 0x9f, 0x99, 0xa1, 0xa1, 0xa1, 0x9f, 0xa4, 0x9c, 0xa1, 0x99, 0xa1, 0x99, 0xa1, 0x9f, 0xa4, 0x9c, 0x95, 0x9c, 0x9c, 0x99, 0x99, 0x9c, 0x9c, 0x9c, 0x98, 0x9e, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x99, 0x99, 0x99, 0x9c, 0x9c, 0x95, 0x9e, 0x95, 0x9f, 0xa1, 0x9c, 0x99, 0xa1, 0xa2, 0xa1, 0x9f, 0x9a, 0x9c, 0x9a, 0x9c, 0x9f, 0xa0, 0xa1, 0xa0, 0xa1, 0x9f, 0x9a, 0x9a, 0x9a, 0xa2, 0x9c, 0x84, 0x82, 0x7f, 0x7d, 0xcc, 0xeb, 0xe5, 0xee, 0xfb, 0xfb, 0xfc, 0xed, 0xe4, 0xe4, 0xe4, 0xe4, 0xef, 0xfb, 0xe4, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xf0, 0x6c, 0xed, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xf0, 0x6c, 0xed, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xee, 0xf0, 0xed, 0x6c, 0xf3, 0xe1, 0xe8, 0xde, 0xae, 0x7c, 0x7e, 0x82, 0x84, 0x9e, 0x9e, 0xa4, 0x95, 0x95, 0x9c, 0x9c, 0x9e, 0x9e, 0x9e, 0x9e, 0x91, 0x95, 0x9c, 0xa1, 0x9f, 0xa1, 0x9c, 0x95, 0x91, 0x95, 0x98, 0x95, 0x9a, 0x95, 0x9a, 0x95, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x95, 0x95, 0x95, 0x9e, 0x9e, 0x95, 0x9e, 0xa1, 0xa1, 0x9c, 0x95, 0x9e, 0x95, 0x98, 0x9a, 0x9e, 0x9c, 0xa1, 0xa1, 0xa1, 0x9f, 0x9c, 0xa2, 0x9a, 0x9f, 0x9c, 0x9f, 0xa4, 0x88, 0x82, 0x7f, 0x7d, 0xbc, 0xeb, 0xed, 0xf3, 0xfc, 0xfb, 0xf3, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xfc, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xfc, 0xed, 0x6c, 0xe6, 0xea, 0xb3, 0x7c, 0x81, 0x81, 0x88, 0xa1, 0xa7, 0x9f, 0xa1, 0x95, 0x9e, 0x9e, 0x98, 0x98, 0x95, 0x9e, 0x9a, 0x9e, 0x9c, 0x9c, 0x95, 0x94, 0x94, 0x9c, 0x9f, 0x9c, 0x9a, 0x95, 0x98, 0x9e, 0x98, 0x98, 0x98, 0x95, 0x95, 0x9c, 0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x95, 0x98, 0x98, 0x9e, 0x95, 0x9e, 0x9c, 0x98, 0x90, 0x98, 0x91, 0x9c, 0x95, 0x94, 0x9c, 0x9c, 0x9e, 0x95, 0x9e, 0x9e, 0x9e, 0xa1, 0x9e, 0xa1, 0x9f, 0x9f, 0x9c, 0xa2, 0xa2, 0x99, 0x9f, 0xa4, 0xa2, 0x8e, 0x81, 0x7f, 0x83, 0xd3, 0xeb, 0xed, 0xfb, 0xf0, 0xed, 0xf0, 0xf2, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfc, 0xef, 0xfc, 0xf0, 0xee, 0xf0, 0xee, 0xef, 0xfc, 0xf0, 0xfc, 0xf0, 0xfc, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfc, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfc, 0xf0, 0xfc, 0xf0, 0xee, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfc, 0xf0, 0xfc, 0xf0, 0xfc, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xf0, 0xe3, 0xe4, 0xe3, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf3, 0xe3, 0xe9, 0xb4, 0x7c, 0x7e, 0x82, 0x88, 0xa4, 0xa2, 0x94, 0xa0, 0x94, 0xa1, 0x9e, 0x98, 0x9e, 0x9e, 0x9a, 0x9c, 0x9c, 0xa2, 0xa3, 0xa2, 0xa8, 0xa8, 0xa8, 0xa8, 0xa7, 0xa3, 0xa2, 0x99, 0xa1, 0x95, 0x9e, 0x98, 0x98, 0x98, 0x9a, 0x9c, 0x99, 0x99, 0x99, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9e, 0x99, 0x99, 0x95, 0x9c, 0xa2, 0xa2, 0xa3, 0xa7, 0xa8, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c, 0x9c, 0xa1, 0x9e, 0xa4, 0x9e, 0x9c, 0x9c, 0xa2, 0xa0, 0x99, 0xa1, 0x9f, 0x95, 0xa4, 0xa4, 0x8e, 0x81, 0x80, 0x7f, 0xd3, 0xf8, 0xed, 0xfb, 0xf3, 0xfc, 0xee, 0xf0, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0x6c, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xf0, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xf0, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xef, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe3, 0xe5, 0xe3, 0xee, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xeb, 0xc6, 0x7d, 0x7e, 0x7e, 0x90, 0x9e, 0x94, 0x99, 0xa1, 0x99, 0xa1, 0x9e, 0x98, 0x9e, 0x98, 0xa1, 0xa0, 0xa5, 0xa5, 0x9d, 0x8a, 0x86, 0x83, 0x83, 0x83, 0x83, 0x83, 0x8a, 0x8d, 0xa5, 0xa5, 0xa0, 0xa0, 0x95, 0x9e, 0x98, 0x98, 0x95, 0x9a, 0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x98, 0x98, 0x98, 0x95, 0x9c, 0xa0, 0xa3, 0xa5, 0xa3, 0xa5, 0x8d, 0x8a, 0x86, 0x85, 0x86, 0x85, 0x89, 0x97, 0xa5, 0xa5, 0xa3, 0xa7, 0xa2, 0x9a, 0x9f, 0x9e, 0x9c, 0xa1, 0xa7, 0xa0, 0xa7, 0x9c, 0x9f, 0x9f, 0x9f, 0x88, 0x81, 0x7f, 0x83, 0xe0, 0xf6, 0xe1, 0xf3, 0xfb, 0xfc, 0xfb, 0xee, 0xee, 0xe4, 0xe4, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xef, 0xf0, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xef, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf0, 0xef, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xe4, 0xef, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe3, 0xe3, 0xe3, 0xed, 0xee, 0xfc, 0xed, 0xed, 0xe4, 0xe5, 0xe3, 0xea, 0xd8, 0x7f, 0x7e, 0x7e, 0x90, 0x98, 0x9a, 0x9c, 0x9f, 0x95, 0xa4, 0x95, 0x9e, 0xa1, 0xa1, 0xa7, 0xa5, 0xaa, 0x86, 0x74, 0x73, 0x73, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x73, 0x73, 0x74, 0x76, 0x89, 0x9b, 0xa5, 0xa1, 0x95, 0x95, 0x9a, 0x95, 0x9a, 0x9c, 0x9c, 0x9f, 0x95, 0x9c, 0x9c, 0x95, 0x95, 0x95, 0x9c, 0x94, 0x94, 0x9c, 0x95, 0x98, 0x95, 0xa1, 0xa2, 0xa8, 0xa5, 0x8d, 0x80, 0x75, 0x7b, 0x73, 0x6e, 0x73, 0x6e, 0x66, 0x66, 0x73, 0x73, 0x74, 0x75, 0x86, 0x9d, 0xa8, 0xa2, 0xa2, 0x95, 0xa1, 0xa1, 0xa1, 0xa0, 0x9f, 0xa1, 0x9f, 0x9e, 0x9f, 0x9c, 0x8b, 0x82, 0x7f, 0xa6, 0xe3, 0xe6, 0xf2, 0xee, 0xfc, 0xfb, 0xef, 0xef, 0xe4, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0x6c, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xf0, 0xef, 0xe4, 0xfb, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf2, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xe3, 0xe4, 0xed, 0xef, 0xfb, 0xef, 0xf3, 0xe1, 0xe8, 0xe6, 0xe2, 0x85, 0x7f, 0x7e, 0x8c, 0x96, 0x90, 0x98, 0x9c, 0x9f, 0x9e, 0x90, 0x9a, 0xa1, 0xa0, 0xa8, 0x9d, 0x77, 0x73, 0x72, 0x3b, 0x67, 0x37, 0x3a, 0x39, 0x39, 0x3d, 0x3d, 0x3b, 0x39, 0x67, 0x36, 0x66, 0x66, 0x74, 0x80, 0x8d, 0x9b, 0x9c, 0x99, 0x95, 0x95, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x99, 0x95, 0x95, 0x9c, 0xa2, 0x94, 0x99, 0x99, 0xa0, 0xa5, 0x9d, 0x83, 0x7b, 0x73, 0x6e, 0x67, 0x34, 0x35, 0x3b, 0x39, 0x39, 0x39, 0x39, 0x39, 0x35, 0x35, 0x66, 0x6e, 0x74, 0x80, 0x9d, 0xa3, 0xa7, 0xa1, 0xa1, 0xa1, 0xa0, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x94, 0x88, 0x81, 0x7f, 0xb3, 0xea, 0xe3, 0xe5, 0xfb, 0xfc, 0xfc, 0xee, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xee, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xee, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xee, 0xee, 0x6c, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xee, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xee, 0xee, 0x6c, 0xee, 
-  0xed, 0xee, 0xef, 0xef, 0xee, 0xf0, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xf3, 0xef, 0xf0, 0xe4, 0xef, 0xf0, 0xef, 0xf0, 0xf3, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xf0, 0xe4, 0xef, 0xfc, 0xe4, 0xf0, 0xf2, 0xf0, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xe4, 0xef, 0xfc, 0xe4, 0xf0, 0xf2, 0xf2, 0xed, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xe3, 0xe3, 0xed, 0xef, 0xfb, 0xf0, 0xe1, 0xe6, 0xe3, 0xe6, 0xea, 0xb4, 0x7c, 0x82, 0x84, 0x9e, 0x9a, 0x98, 0x9a, 0x9f, 0x9f, 0x95, 0xa4, 0x95, 0x9b, 0xa8, 0x86, 0x74, 0x72, 0x3b, 0x43, 0x39, 0x3d, 0x3c, 0x3c, 0x40, 0x3c, 0x40, 0x3c, 0x40, 0x3c, 0x3c, 0x45, 0x3f, 0x67, 0x34, 0x6e, 0x7b, 0x80, 0x9d, 0xa8, 0x99, 0x99, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x94, 0x95, 0x95, 0x94, 0x9c, 0x95, 0x99, 0x99, 0x92, 0xa5, 0x9d, 0x77, 0x7b, 0x6e, 0x6e, 0x6e, 0x3a, 0x43, 0x3f, 0x40, 0x3c, 0x39, 0x40, 0x40, 0x3d, 0x40, 0x3d, 0x3c, 0x3f, 0x37, 0x34, 0x6e, 0x73, 0x83, 0xa5, 0xa8, 0xa1, 0xa0, 0xa2, 0x99, 0x9f, 0x9c, 0x9f, 0x95, 0x9c, 0x9f, 0x8c, 0x84, 0x81, 0x7d, 0xd8, 0xe6, 0xe5, 0xee, 0xfb, 0xef, 0xef, 0xe4, 0xe4, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0x6c, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xed, 0xef, 0xed, 0xf0, 0xe5, 0xe5, 0xee, 0xef, 0xf0, 0xed, 0xfb, 0xf2, 0xee, 0xe5, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xed, 0xef, 0xef, 0xe5, 0xe5, 0xef, 0xef, 0xed, 0xef, 0xed, 0xf0, 0xe5, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xe5, 0xee, 0xf0, 0xef, 0xfb, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xe5, 0xe5, 0xee, 0xef, 0xf0, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xe4, 0xfc, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xe4, 0xef, 0xfb, 0xef, 0xf0, 0xf0, 0xe1, 0xe6, 0xe9, 0xc6, 0x7e, 0x82, 0x84, 0x9c, 0x95, 0x9e, 0x95, 0x9e, 0x9c, 0xa1, 0x9f, 0x99, 0xa8, 0x9d, 0x76, 0x72, 0x66, 0x3a, 0x3a, 0x36, 0x3d, 0x3d, 0x3c, 0x3c, 0x3c, 0x40, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0x37, 0x39, 0x42, 0x3f, 0x3f, 0x67, 0x34, 0x73, 0x83, 0x9d, 0xa5, 0x94, 0x9c, 0x95, 0x9c, 0x94, 0x9c, 0x9c, 0x95, 0x9c, 0x94, 0x9c, 0x9c, 0xa0, 0xa5, 0x86, 0x73, 0x34, 0x66, 0x36, 0x3b, 0x3a, 0x3a, 0x38, 0x38, 0x38, 0x40, 0x40, 0x3c, 0x3c, 0x3c, 0x3a, 0x3c, 0x3d, 0x39, 0x3c, 0x40, 0x40, 0x35, 0x72, 0x7b, 0x83, 0xa5, 0xa3, 0xa0, 0x9f, 0xa2, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x94, 0x82, 0x7e, 0x86, 0xde, 0xe6, 0xee, 0xfc, 0xfb, 0xef, 0xe4, 0xef, 0xed, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xf0, 
-  0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xe5, 0xfc, 0xe4, 0xf0, 0xf0, 0xef, 0xef, 0xe4, 0xe5, 0xf0, 0xe4, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xef, 0xfc, 0xe3, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xed, 0xef, 0xee, 0xf0, 0xe4, 0xe5, 0xf0, 0xe4, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xf2, 0xe4, 0xe5, 0xfc, 0xe4, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xe5, 0xe5, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xe4, 0xef, 0xee, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xe3, 0xed, 0xef, 0xfb, 0xfb, 0xfb, 0xf3, 0xe3, 0xe7, 0xde, 0x83, 0x82, 0x82, 0x9c, 0x9e, 0x95, 0xa1, 0x9e, 0x9f, 0x9f, 0x9f, 0xa0, 0xa8, 0x8d, 0x74, 0x6e, 0x3a, 0x3a, 0x38, 0x3a, 0x45, 0x3a, 0x3a, 0x3f, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3b, 0x3d, 0x38, 0x38, 0x38, 0x3f, 0x34, 0x6e, 0x75, 0x97, 0xa2, 0x9c, 0x94, 0x95, 0x95, 0x95, 0x95, 0x9c, 0x95, 0x9c, 0x95, 0xa1, 0x9b, 0x7d, 0x6e, 0x66, 0x37, 0x38, 0x3c, 0x38, 0x39, 0x3a, 0x3a, 0x3a, 0x3d, 0x38, 0x3a, 0x38, 0x67, 0x38, 0x67, 0x3a, 0x37, 0x42, 0x40, 0x40, 0x40, 0x3d, 0x39, 0x67, 0x79, 0x75, 0xa3, 0xa2, 0x99, 0x9f, 0x9f, 0x9f, 0x9c, 0xa4, 0x9c, 0x95, 0x9c, 0x84, 0x82, 0x7f, 0xc1, 0xea, 0xfc, 0xfb, 0xfc, 0xfb, 0xe4, 0xe4, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0x6c, 0xee, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xee, 0x6c, 0xee, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xee, 0x6c, 0xee, 0xee, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xf0, 0xf0, 0xee, 0xef, 
-  0xef, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xe5, 0xe5, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xe5, 0xe5, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xf0, 0xe5, 0xe5, 0xef, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xe5, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xe5, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xe5, 0xe5, 0xee, 0xef, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xef, 0xe4, 0xe5, 0xfc, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xef, 0xe4, 0xe3, 0xe4, 0xfc, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xf0, 0xef, 0xee, 0xed, 0xf2, 0xfb, 0xfd, 0xfd, 0xfd, 0xef, 0xe2, 0xe7, 0xb4, 0x7c, 0x7e, 0x90, 0x99, 0xa2, 0x99, 0x9e, 0x9e, 0x95, 0xa7, 0xa0, 0xaa, 0x86, 0x6f, 0x6e, 0x67, 0x3f, 0x3e, 0x3c, 0x3e, 0x3a, 0x3a, 0x37, 0x3d, 0x3d, 0x3d, 0x3f, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3b, 0x3d, 0x3d, 0x3d, 0x3c, 0x3c, 0x38, 0x45, 0x67, 0x66, 0x6f, 0x85, 0xa3, 0x99, 0xa0, 0x94, 0x94, 0x9c, 0x94, 0x95, 0x9a, 0xa3, 0x89, 0x7b, 0x6e, 0x6e, 0x3f, 0x3d, 0x38, 0x3e, 0x42, 0x38, 0x38, 0x3a, 0x3a, 0x3a, 0x3a, 0x37, 0x3d, 0x3f, 0x37, 0x3a, 0x37, 0x3f, 0x38, 0x38, 0x3c, 0x42, 0x39, 0x3a, 0x3b, 0x67, 0x6e, 0x75, 0x9d, 0xa5, 0x99, 0xa2, 0x98, 0x95, 0x9e, 0x9f, 0x99, 0xa0, 0x99, 0x84, 0x81, 0x7f, 0xdb, 0xe7, 0xf3, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfc, 0xee, 0xee, 0xfc, 0xed, 0xf2, 0xe5, 0xe5, 0xee, 0xee, 0xfb, 0xee, 0xee, 0xe5, 0xe4, 0xe3, 0xe4, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0x6c, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xed, 0xee, 0xee, 0xed, 0xee, 0xee, 0x6c, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xed, 0x6c, 0xed, 0xef, 0xef, 0xef, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe5, 0xf0, 0xe4, 0xf1, 0xef, 0xee, 0xef, 0xe5, 0xe5, 0xf0, 0xe4, 0xf0, 0xfb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe5, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe5, 0xf0, 0xe4, 0xf0, 0xfb, 0xef, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xe5, 0xe5, 0xfc, 0xe4, 0xf0, 0xef, 0xfb, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xee, 0xe5, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xfb, 0xee, 0xfc, 0xef, 0xee, 0xe4, 0xe5, 0xe3, 0xe5, 0xee, 0xfb, 0xfb, 0xee, 0xee, 0xfc, 0xed, 0xed, 0xe4, 0xf3, 0xe5, 0xee, 0xfc, 0x30, 0xfd, 0xfd, 0xe0, 0xeb, 0xd4, 0x81, 0x84, 0x84, 0x95, 0xa3, 0x99, 0x9c, 0xa1, 0x9e, 0xa1, 0x99, 0xa8, 0x78, 0x6f, 0x35, 0x3b, 0x3d, 0x3d, 0x38, 0x3c, 0x39, 0x37, 0x3f, 0x3d, 0x3d, 0x42, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x39, 0x3d, 0x3a, 0x39, 0x3a, 0x39, 0x3d, 0x3c, 0x36, 0x7b, 0x85, 0xa5, 0x99, 0xa0, 0x91, 0xa1, 0x94, 0x95, 0xa3, 0x85, 0x6f, 0x6e, 0x41, 0x39, 0x39, 0x40, 0x3c, 0x3d, 0x38, 0x3a, 0x3d, 0x3a, 0x38, 0x3d, 0x39, 0x43, 0x39, 0x36, 0x3d, 0x3d, 0x37, 0x38, 0x3f, 0x3d, 0x3a, 0x37, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x6e, 0x75, 0x9d, 0xa5, 0x9c, 0x9e, 0x98, 0x9a, 0x9c, 0x99, 0xa0, 0xa1, 0x8b, 0x84, 0x7e, 0xb8, 0xe7, 0xe1, 0xfc, 0xfb, 0xf3, 0xfb, 0xfc, 0xfc, 0xfb, 0xed, 0x6c, 0xf2, 0x6c, 0xe3, 0x6c, 0xe5, 0xfb, 0xfc, 0xef, 0x6c, 0xe3, 0xe5, 0xe3, 0xe3, 0xe4, 0xe4, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xed, 0xf0, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xe5, 0xe5, 0xee, 0xef, 0xef, 0xfb, 0xe4, 0xfc, 0xe5, 0xe5, 0xee, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xe5, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xe5, 0xe5, 0xee, 0xef, 0xf0, 0xed, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe5, 0xee, 0xef, 0xf0, 0xfb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xe5, 0xe5, 0xfc, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xf0, 0xfb, 0xfc, 0xfb, 0xef, 0xee, 0xe3, 0xee, 0xfc, 0xfc, 0xf3, 0xfc, 0xfb, 0xef, 0xef, 0xef, 0xed, 0xed, 0xe6, 0xe3, 0xee, 0xfc, 0xfb, 0xed, 0xe1, 0xeb, 0x8a, 0x7e, 0x82, 0x98, 0xa4, 0xa2, 0x99, 0x9f, 0x98, 0xa1, 0x94, 0xa8, 0x89, 0x73, 0x66, 0x35, 0x41, 0x37, 0x42, 0x42, 0x42, 0x37, 0x3b, 0x3b, 0x39, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3a, 0x39, 0x39, 0x3a, 0x39, 0x3d, 0x39, 0x3d, 0x3a, 0x34, 0x73, 0x83, 0xa5, 0x95, 0x9a, 0x91, 0x94, 0xa5, 0x85, 0x73, 0x6e, 0x67, 0x41, 0x39, 0x39, 0x3d, 0x3c, 0x39, 0x3a, 0x38, 0x3a, 0x3c, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x43, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3a, 0x45, 0x3a, 0x3a, 0x3a, 0x37, 0x3a, 0x67, 0x6d, 0x75, 0xaa, 0xa0, 0x9c, 0x9c, 0x9e, 0x9c, 0x9c, 0xa0, 0x99, 0xa7, 0x84, 0x81, 0x7f, 0xdd, 0xe3, 0xe6, 0xed, 0xf3, 0xed, 0xed, 0xfc, 0xee, 0xfb, 0xfb, 0xe1, 0xed, 0xef, 0xf2, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xed, 0xfc, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xed, 0xfc, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xee, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xed, 0xfc, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe5, 0xf0, 0xe4, 0xf0, 0xf0, 0xee, 0xef, 0xe5, 0xe5, 0xf0, 0xe4, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe5, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe5, 0xf0, 0xe4, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xee, 0xe5, 0xfc, 0xe4, 0xf0, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe5, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xee, 0xee, 0xf0, 0xfc, 0xfb, 0xfc, 0xee, 0xee, 0x6c, 0xee, 0xf0, 0xfb, 0xed, 0xf2, 0xe8, 0xf3, 0xe6, 0xe8, 0xe9, 0xe8, 0xe9, 0xe9, 0xe8, 0xe8, 0xe5, 0xe3, 0xe9, 0xcf, 0x7e, 0x82, 0x8c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9e, 0xa1, 0x94, 0xa8, 0x8f, 0x7b, 0x66, 0x3b, 0x43, 0x39, 0x3d, 0x39, 0x39, 0x37, 0x43, 0x35, 0x34, 0x34, 0x35, 0x34, 0x39, 0x39, 0x39, 0x3d, 0x39, 0x3c, 0x3d, 0x3d, 0x3a, 0x39, 0x3a, 0x3d, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3d, 0x42, 0x35, 0x73, 0x81, 0x99, 0x9a, 0x99, 0xa8, 0x77, 0x3b, 0x66, 0x3b, 0x67, 0x39, 0x39, 0x40, 0x40, 0x3c, 0x3c, 0x3a, 0x3a, 0x3a, 0x39, 0x3a, 0x38, 0x3a, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x39, 0x36, 0x35, 0x39, 0x39, 0x36, 0x3a, 0x39, 0x3a, 0x3a, 0x38, 0x41, 0x67, 0x79, 0x75, 0xa5, 0xa0, 0x99, 0x9c, 0x95, 0x9c, 0x95, 0xa0, 0x9f, 0x99, 0x82, 0x7f, 0xb8, 0xe9, 0xe0, 0xe1, 0xde, 0xe3, 0xe6, 0xe3, 0xe4, 0xe8, 0xe8, 0xf4, 0xe8, 0xf2, 0xe4, 0xe3, 0xe3, 0xe3, 0xee, 0xee, 0xfd, 0xfd, 0xfd, 0xfb, 0xee, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xee, 0xe5, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xe5, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xee, 0xe5, 0xee, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xf0, 0xe5, 0xe5, 0xee, 0xef, 0xef, 0xf2, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xe5, 0xe5, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xe5, 0xe5, 0xfc, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xe4, 0xee, 0xee, 0xfb, 0xfc, 0xfb, 0xfc, 0xee, 0xee, 0xe4, 0xf2, 0xeb, 0xeb, 0xe3, 0xdb, 0xd3, 0xce, 0xbc, 0xb8, 0xb6, 0xbc, 0xc7, 0xd3, 0xdb, 0xe7, 0xea, 0xe7, 0xa8, 0x81, 0x82, 0xa4, 0x95, 0x95, 0x9c, 0x9e, 0xa1, 0xa1, 0xa7, 0xaa, 0x7b, 0x72, 0x41, 0x3b, 0x3a, 0x39, 0x3d, 0x3c, 0x3d, 0x36, 0x6d, 0x46, 0x69, 0x60, 0x27, 0x5d, 0x49, 0x34, 0x37, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x39, 0x3d, 0x39, 0x38, 0x39, 0x39, 0x3d, 0x39, 0x3a, 0x3c, 0x40, 0x42, 0x34, 0x79, 0x85, 0x92, 0xa3, 0x89, 0x6f, 0x35, 0x3d, 0x39, 0x39, 0x3d, 0x42, 0x39, 0x40, 0x39, 0x3d, 0x39, 0x3a, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x6d, 0x36, 0x43, 0x3b, 0x34, 0x6d, 0x39, 0x3a, 0x3d, 0x3d, 0x39, 0x3c, 0x36, 0x45, 0x67, 0x6e, 0x83, 0xaa, 0x92, 0xa0, 0x94, 0x9c, 0xa1, 0x94, 0x9c, 0x9f, 0x88, 0x81, 0x8a, 0xde, 0xe7, 0xea, 0xe7, 0xe7, 0xe0, 0xdd, 0xd8, 0xd8, 0xd7, 0xdb, 0xe1, 0xe9, 0xe9, 0xeb, 0xe9, 0xe6, 0xe5, 0xef, 0xfd, 0xfd, 0xfd, 0xfb, 0xee, 0xee, 0xe5, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xed, 0xfc, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xed, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xed, 0xfc, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xed, 0xfc, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xee, 0xef, 0xee, 0xee, 0xee, 
-  0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xe5, 0xe5, 0xf0, 0xe4, 0xf0, 0xf3, 0xef, 0xef, 0xee, 0xe5, 0xf0, 0xe4, 0xf0, 0xf0, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfc, 0xe3, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xe5, 0xf0, 0xe4, 0xf0, 0xf2, 0xef, 0xef, 0xed, 0xee, 0xef, 0xef, 0xe4, 0xee, 0xfc, 0xe4, 0xf0, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xe5, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xe3, 0xe4, 0xf2, 0xef, 0xef, 0xee, 0xe4, 0xe5, 0xe6, 0xe8, 0xe7, 0xdb, 0xbc, 0x97, 0x83, 0x74, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x80, 0x9d, 0xbf, 0x82, 0x7e, 0x9a, 0x90, 0x9c, 0x9c, 0x9e, 0xa1, 0x95, 0xa0, 0xaa, 0x74, 0x6e, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x42, 0x3d, 0x34, 0x49, 0x2b, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0x33, 0x57, 0x35, 0x39, 0x39, 0x3d, 0x3c, 0x3c, 0x3a, 0x39, 0x3a, 0x3d, 0x39, 0x3a, 0x38, 0x3a, 0x39, 0x3c, 0x3e, 0x3e, 0x43, 0x6e, 0x79, 0x8f, 0x71, 0x73, 0x36, 0x42, 0x38, 0x3d, 0x3c, 0x39, 0x3c, 0x40, 0x3c, 0x3d, 0x3d, 0x3d, 0x39, 0x3f, 0x38, 0x3a, 0x38, 0x3a, 0x3d, 0x45, 0x34, 0x45, 0x27, 0x30, 0x33, 0xf4, 0x64, 0x57, 0x43, 0x35, 0x3d, 0x39, 0x3d, 0x3d, 0x42, 0x37, 0x43, 0x67, 0x73, 0x86, 0xa5, 0x9b, 0xa1, 0x95, 0x95, 0x94, 0xa2, 0x90, 0x99, 0x84, 0x85, 0xc1, 0xbb, 0xae, 0x92, 0x83, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7f, 0x83, 0xaa, 0xbb, 0xd7, 0xde, 0xe9, 0xe6, 0xf0, 0xfb, 0xfd, 0xfd, 0xf2, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xef, 0xef, 
-  0xef, 0xef, 0xef, 0xed, 0xef, 0xf0, 0xee, 0xe5, 0xee, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xee, 0xe5, 0xfc, 0xe4, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xee, 0xe5, 0xef, 0xef, 0xed, 0xef, 0xed, 0xf0, 0xe5, 0xef, 0xee, 0xef, 0xed, 0xef, 0xf0, 0xe4, 0xe5, 0xee, 0xef, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xee, 0xf0, 0xe4, 0xe5, 0xfc, 0xe4, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xed, 0xef, 0xf0, 0xe5, 0xe5, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xed, 0xe4, 0xe4, 0xed, 0xe4, 0xe4, 0xe6, 0xe6, 0xea, 0xd7, 0xa6, 0x85, 0x7c, 0x7d, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7c, 0x7c, 0x7f, 0x7f, 0x7f, 0x7c, 0x7e, 0x84, 0x82, 0x9a, 0x9a, 0x94, 0xa4, 0x95, 0x9e, 0x99, 0xa8, 0x83, 0x73, 0x67, 0x37, 0x3d, 0x3d, 0x3c, 0x3d, 0x3d, 0x34, 0x4d, 0x33, 0xec, 0x65, 0x27, 0x57, 0x69, 0x1b, 0x6a, 0x27, 0x38, 0x3d, 0x39, 0x3d, 0x40, 0x39, 0x39, 0x3d, 0x39, 0x38, 0x39, 0x39, 0x3d, 0x39, 0x3a, 0x3c, 0x3e, 0x3e, 0x38, 0x3b, 0x35, 0x68, 0x68, 0x35, 0x3a, 0x37, 0x38, 0x3c, 0x3c, 0x3c, 0x40, 0x3c, 0x3d, 0x3d, 0x39, 0x3d, 0x3b, 0x39, 0x3a, 0x39, 0x3d, 0x3d, 0x37, 0x36, 0x49, 0x6b, 0xf7, 0x30, 0x64, 0x65, 0x33, 0xf9, 0x65, 0x49, 0x36, 0x3d, 0x37, 0x42, 0x3c, 0x40, 0x3d, 0x3b, 0x66, 0x6f, 0x97, 0xa5, 0x99, 0x9c, 0x98, 0x94, 0x9c, 0x95, 0x95, 0x84, 0x81, 0x7f, 0x7c, 0x7c, 0x7c, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x97, 0xc7, 0xe2, 0xeb, 0xe8, 0xfb, 0xf2, 0xf2, 0xe1, 0xe5, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xef, 0xee, 0xed, 
-  0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xee, 0xef, 0xf0, 0xe4, 0xee, 0xef, 0xed, 0xef, 0xee, 0xe4, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xee, 0xf0, 0xe4, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xe5, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xed, 0xf2, 0xe3, 0xe6, 0xe9, 0xd8, 0x8a, 0x7d, 0x7c, 0x7e, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x91, 0x9a, 0x9a, 0x95, 0x9c, 0x9f, 0x94, 0xa8, 0x97, 0x6e, 0x67, 0x3a, 0x3f, 0x3c, 0x42, 0x3c, 0x3d, 0x38, 0x4b, 0x30, 0x2b, 0x4b, 0x6d, 0x34, 0x34, 0x6d, 0x36, 0x6d, 0x34, 0x39, 0x3d, 0x3d, 0x3c, 0x3d, 0x3c, 0x3a, 0x39, 0x3a, 0x3d, 0x39, 0x3a, 0x39, 0x38, 0x3d, 0x38, 0x3a, 0x38, 0x3a, 0x40, 0x40, 0x40, 0x39, 0x40, 0x3f, 0x3f, 0x3a, 0x3c, 0x3d, 0x3c, 0x39, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x3d, 0x38, 0x3a, 0x39, 0x45, 0x39, 0x49, 0x52, 0x36, 0x34, 0x6d, 0x6d, 0x3b, 0x50, 0x6b, 0x33, 0x4d, 0x36, 0x43, 0x39, 0x39, 0x3d, 0x3c, 0x3d, 0x3b, 0x66, 0x75, 0x9d, 0x92, 0xa1, 0x94, 0x94, 0x99, 0x90, 0x9a, 0x8e, 0x82, 0x7c, 0x7d, 0x7f, 0x7e, 0x82, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x81, 0x81, 0x81, 0x7f, 0x83, 0xc1, 0xde, 0xea, 0xe6, 0xe3, 0xf4, 0xe4, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xfc, 0xed, 0xee, 0xef, 0xee, 0xee, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xfc, 0xed, 0xee, 0xef, 0xee, 0xee, 0xf0, 0xed, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xef, 0xef, 0x6c, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xfc, 0xed, 0xee, 0xef, 0xee, 0xee, 0xf0, 0xed, 0xef, 0xef, 
-  0xef, 0xef, 0xed, 0xef, 0xed, 0xe4, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xfc, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xfc, 0xe4, 0xef, 0xe4, 0xfb, 0xe4, 0xef, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xfc, 0xe4, 0xf0, 0xee, 0xed, 0xef, 0xef, 0xe4, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xf2, 0xed, 0xe6, 0xe6, 0xe7, 0xb8, 0x83, 0x7f, 0x7f, 0x82, 0x82, 0x88, 0x8c, 0x94, 0x95, 0x95, 0x91, 0x95, 0x9a, 0x9e, 0x9a, 0x9e, 0x95, 0x8c, 0x88, 0x84, 0x82, 0x7e, 0x9e, 0x91, 0xab, 0x95, 0x95, 0x95, 0xa2, 0x9d, 0x75, 0x67, 0x3a, 0x37, 0x43, 0x39, 0x38, 0x3d, 0x3d, 0x39, 0x4b, 0x50, 0x34, 0x34, 0x3f, 0x3b, 0x43, 0x45, 0x3d, 0x39, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x38, 0x39, 0x39, 0x3d, 0x39, 0x3d, 0x3a, 0x3a, 0x67, 0x3c, 0x3d, 0x40, 0x40, 0x40, 0x39, 0x37, 0x3a, 0x3f, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3a, 0x39, 0x3a, 0x3c, 0x39, 0x3d, 0x45, 0x36, 0x35, 0x3b, 0x3d, 0x39, 0x37, 0x39, 0x35, 0x34, 0x1b, 0x69, 0x3c, 0x36, 0x43, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x67, 0x66, 0x86, 0xa5, 0x99, 0x91, 0x99, 0xa1, 0x94, 0x9a, 0x9c, 0x84, 0x7e, 0x87, 0x88, 0x88, 0x94, 0x9c, 0x95, 0x9c, 0x9f, 0xa4, 0x94, 0x95, 0x94, 0x8c, 0x88, 0x82, 0x81, 0x87, 0x81, 0x81, 0xaa, 0xd8, 0xe7, 0xe6, 0xe3, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xfc, 0xee, 0xef, 0xee, 0xef, 0xfc, 0xf0, 0xef, 0xee, 0xed, 0xef, 0xef, 0xee, 0xee, 0xf0, 0xfc, 0xef, 0xee, 0xee, 0xf0, 0xfc, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xf0, 0xfc, 0xef, 0xee, 0xee, 0xf0, 0xfc, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xfc, 0xf0, 0xef, 0xee, 0xed, 0xf0, 0xee, 0xee, 0xf0, 0xfc, 0xee, 0xef, 0xee, 0xef, 0xfc, 0xf0, 0xef, 0xef, 0xef, 0xee, 
-  0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xfc, 0xed, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xf0, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xed, 0xfb, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xed, 0xfb, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xee, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xf3, 0xee, 0xef, 0xe8, 0xe0, 0xae, 0x85, 0x81, 0x84, 0x94, 0x91, 0x95, 0x94, 0x95, 0x95, 0x95, 0x95, 0x9c, 0x9e, 0x9c, 0x9e, 0x91, 0x96, 0x98, 0x9e, 0x98, 0x9e, 0x8c, 0x8c, 0xa2, 0x95, 0x9c, 0x95, 0x95, 0x9c, 0xa7, 0x86, 0x6e, 0x3f, 0x3c, 0x3d, 0x3b, 0x39, 0x3d, 0x3d, 0x3d, 0x3f, 0x38, 0x34, 0x45, 0x38, 0x43, 0x3c, 0x39, 0x43, 0x40, 0x45, 0x39, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3a, 0x38, 0x3a, 0x39, 0x3d, 0x3b, 0x3a, 0x3a, 0x3a, 0x38, 0x38, 0x38, 0x42, 0x40, 0x39, 0x39, 0x39, 0x3a, 0x3a, 0x3a, 0x39, 0x3a, 0x3d, 0x38, 0x3d, 0x3c, 0x3d, 0x38, 0x3a, 0x39, 0x3a, 0x39, 0x3d, 0x45, 0x3d, 0x39, 0x3d, 0x39, 0x43, 0x3d, 0x45, 0x37, 0x34, 0x43, 0x37, 0x43, 0x3b, 0x3b, 0x43, 0x3d, 0x42, 0x3d, 0x43, 0x6e, 0x74, 0x9d, 0x8e, 0x94, 0x99, 0x94, 0x95, 0x95, 0x9c, 0x99, 0x8e, 0xa0, 0xa0, 0x94, 0x99, 0x94, 0x99, 0x99, 0x94, 0x99, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0xa7, 0x91, 0x88, 0x84, 0x88, 0x84, 0x87, 0xcf, 0xe9, 0xe8, 0xed, 0xf0, 0xef, 0xef, 0xf2, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xf0, 0xe4, 0xee, 0xef, 0xf0, 0xf0, 0xee, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xf0, 0xe4, 0xee, 0xef, 0xf0, 0xf0, 0xee, 0xe4, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xee, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xe4, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 
-  0xef, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xfc, 0xef, 0xe4, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xfc, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xef, 0xf0, 0xee, 0xef, 0xe3, 0xe4, 0xef, 0xee, 0xee, 0xe4, 0xee, 0xfb, 0xed, 0xea, 0xdd, 0xaa, 0x85, 0x87, 0x8e, 0x95, 0x91, 0x98, 0x95, 0x9e, 0x91, 0x94, 0x95, 0x9c, 0x95, 0x95, 0x98, 0x95, 0x96, 0x98, 0x98, 0x98, 0x98, 0x96, 0x8c, 0x98, 0x94, 0x9f, 0x95, 0x95, 0x9c, 0x9f, 0xa5, 0x74, 0x67, 0x37, 0x3c, 0x3d, 0x67, 0x43, 0x3f, 0x3d, 0x3a, 0x39, 0x39, 0x3f, 0x3d, 0x3d, 0x3d, 0x3c, 0x3c, 0x3c, 0x42, 0x39, 0x45, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3a, 0x38, 0x3a, 0x3f, 0x3a, 0x38, 0x39, 0x40, 0x39, 0x3a, 0x3a, 0x39, 0x3a, 0x3a, 0x38, 0x3d, 0x38, 0x3c, 0x38, 0x3d, 0x3d, 0x39, 0x3a, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x43, 0x43, 0x3c, 0x43, 0x39, 0x3f, 0x3d, 0x3a, 0x3b, 0x3f, 0x67, 0x3f, 0x3b, 0x39, 0x3d, 0x3c, 0x3d, 0x3b, 0x79, 0x83, 0xa3, 0x99, 0x8e, 0x94, 0x9c, 0x94, 0x95, 0x94, 0x8e, 0xa1, 0x99, 0x91, 0x9c, 0xa1, 0xa0, 0x9c, 0xa0, 0x9c, 0xa1, 0x9c, 0x9e, 0x95, 0x98, 0xa1, 0xab, 0x9e, 0x9e, 0x8c, 0x84, 0x8b, 0x85, 0xc1, 0xe6, 0xe8, 0xed, 0xf2, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xf0, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 
-  0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xfd, 0xfd, 0xfc, 0xe5, 0xe3, 0xee, 0xef, 0xfc, 0xee, 0xe5, 0xe5, 0xf0, 0xe8, 0xde, 0xaf, 0x87, 0x8e, 0x99, 0x99, 0x98, 0x91, 0x96, 0x98, 0x98, 0x95, 0x94, 0x94, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x95, 0x9f, 0x91, 0x96, 0x96, 0x96, 0x95, 0x9c, 0x90, 0x9a, 0x98, 0x99, 0xa3, 0x89, 0x66, 0x3b, 0x40, 0x40, 0x3f, 0x3a, 0x3a, 0x3f, 0x3a, 0x3f, 0x3c, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3c, 0x3a, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x39, 0x38, 0x39, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x40, 0x3b, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x40, 0x3c, 0x45, 0x66, 0x74, 0x9d, 0x99, 0x95, 0x94, 0x94, 0x94, 0x95, 0x95, 0x94, 0x9c, 0x99, 0x90, 0x95, 0x91, 0x94, 0x94, 0x94, 0x99, 0x94, 0x95, 0x98, 0x96, 0x96, 0xa1, 0xa0, 0xa0, 0x99, 0x9a, 0x90, 0x90, 0x84, 0x87, 0xcf, 0xe7, 0xe3, 0xe6, 0xfc, 0xfb, 0xfc, 0xee, 0xe5, 0xe4, 0xe4, 0xf0, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xef, 0xe4, 0xfc, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xfc, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xfc, 0xef, 0xf0, 0xee, 0xef, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfc, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xe4, 0xfc, 0xef, 0xf0, 0xee, 0xee, 0xf0, 0xfd, 0xfb, 0xe3, 0xe5, 0xe3, 0xee, 0xfb, 0xfc, 0x6c, 0xe3, 0xe8, 0xde, 0xb3, 0x81, 0x9f, 0x94, 0x99, 0xa1, 0x94, 0x98, 0x90, 0x95, 0x99, 0x9b, 0xa5, 0xaa, 0xaa, 0xae, 0xaf, 0xaf, 0xa8, 0xa8, 0xa5, 0x97, 0x92, 0x91, 0x96, 0x96, 0x9c, 0x99, 0x99, 0x90, 0x9e, 0x94, 0xa5, 0x74, 0x66, 0x3d, 0x40, 0x40, 0x3a, 0x3a, 0x3a, 0x3c, 0x3a, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x38, 0x3d, 0x38, 0x3d, 0x3d, 0x3a, 0x3a, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x39, 0x39, 0x39, 0x38, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x39, 0x3d, 0x3d, 0x43, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x40, 0x3c, 0x3c, 0x67, 0x73, 0x8a, 0x9b, 0x95, 0x94, 0x94, 0x94, 0x91, 0x95, 0x94, 0x94, 0xa0, 0xa3, 0xa5, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa5, 0xa8, 0xa0, 0xa0, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0xa4, 0x8c, 0x95, 0x88, 0x8a, 0xc6, 0xeb, 0xe3, 0xf3, 0xfc, 0xfc, 0x6c, 0xe4, 0xe5, 0xe4, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xfc, 0xef, 0xf0, 0xee, 0xe4, 0xfd, 0xfb, 0xe4, 0xe5, 0xe3, 0xe5, 0xef, 0xfd, 0xee, 0xe3, 0xe6, 0xe9, 0xc7, 0x87, 0xa2, 0x94, 0x95, 0xa1, 0x94, 0x99, 0x95, 0xa0, 0xa5, 0xaa, 0xae, 0xdf, 0x5d, 0x60, 0x23, 0x27, 0x27, 0x27, 0x60, 0x60, 0xdf, 0xaa, 0x99, 0x90, 0x95, 0xa0, 0x99, 0x99, 0x95, 0x95, 0xa3, 0x8d, 0x79, 0x66, 0x3d, 0x40, 0x40, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x38, 0x3d, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3d, 0x38, 0x3d, 0x3d, 0x3c, 0x39, 0x3d, 0x3d, 0x38, 0x39, 0x38, 0x39, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x42, 0x3c, 0x40, 0x3c, 0x40, 0x3d, 0x3c, 0x3d, 0x40, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x3d, 0x3d, 0x3c, 0x40, 0x39, 0x41, 0x6e, 0x80, 0xa5, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x94, 0x92, 0x9d, 0xaa, 0xa6, 0xdf, 0xdf, 0xdf, 0x5d, 0x5d, 0xdf, 0xdf, 0xdf, 0xae, 0xaa, 0xa3, 0x9a, 0x9a, 0x9a, 0x9e, 0x94, 0xab, 0x99, 0x8e, 0x94, 0x9b, 0xdd, 0xea, 0xe4, 0xfc, 0xfb, 0xee, 0xe5, 0xe5, 0xef, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xef, 0xe4, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xed, 0xfc, 0xe4, 0xee, 0xee, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xe4, 0xe3, 0xe5, 0xe5, 0xfb, 0xfc, 0xef, 0xee, 0xe7, 0xd8, 0x8a, 0x8e, 0x95, 0x9a, 0x91, 0x95, 0xa0, 0x9b, 0xa7, 0xa6, 0xdf, 0x1b, 0x20, 0x18, 0x15, 0x13, 0x0e, 0x0e, 0x13, 0x16, 0x1a, 0x22, 0x25, 0x23, 0xae, 0x8e, 0x99, 0x9b, 0xa0, 0x99, 0x95, 0x9c, 0xa3, 0x80, 0x6e, 0x67, 0x3d, 0x3d, 0x40, 0x3a, 0x3a, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x3d, 0x3d, 0x3c, 0x3c, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x39, 0x39, 0x39, 0x38, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x3e, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x40, 0x3c, 0x40, 0x40, 0x3d, 0x3a, 0x3a, 0x3d, 0x3d, 0x42, 0x3c, 0x42, 0x66, 0x74, 0x8f, 0x99, 0x94, 0x95, 0x90, 0x94, 0x91, 0x94, 0x92, 0xaa, 0x5d, 0x23, 0x25, 0x22, 0x22, 0x1a, 0x1a, 0x1e, 0x20, 0x22, 0x20, 0x20, 0xae, 0xa3, 0xa3, 0x9c, 0x9c, 0xa1, 0xa0, 0xa1, 0x99, 0x90, 0x84, 0xb3, 0xde, 0xe6, 0xf2, 0xf2, 0xee, 0xe5, 0xe4, 0xee, 0xf0, 0xfb, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xee, 0xef, 0xed, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xfb, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf0, 0xf0, 0xe4, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf0, 0xe4, 0xee, 0xef, 0xed, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xef, 0xef, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xef, 0xe4, 0xe5, 0xe3, 0xe5, 0xee, 0xfc, 0xfc, 0xef, 0xe6, 0xe2, 0xb4, 0x8b, 0xa2, 0x98, 0x9e, 0x98, 0xa1, 0xa0, 0xaa, 0xae, 0xdf, 0x1a, 0x18, 0x13, 0x0e, 0x0f, 0x10, 0x0d, 0x10, 0x0d, 0x10, 0x0a, 0x0a, 0x0e, 0x15, 0xa6, 0x92, 0x99, 0x99, 0xa0, 0x94, 0x9a, 0x94, 0xa5, 0x7b, 0x6e, 0x3a, 0x3d, 0x40, 0x39, 0x3f, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3a, 0x3c, 0x3f, 0x3a, 0x3d, 0x3a, 0x3f, 0x39, 0x3d, 0x3d, 0x38, 0x3c, 0x3c, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x38, 0x3c, 0x38, 0x3c, 0x3c, 0x3c, 0x42, 0x3c, 0x3c, 0x3c, 0x3c, 0x40, 0x40, 0x3c, 0x40, 0x40, 0x40, 0x3c, 0x3a, 0x3f, 0x3b, 0x40, 0x3c, 0x40, 0x3d, 0x3b, 0x66, 0x89, 0x9b, 0x94, 0x95, 0x90, 0x95, 0x94, 0x95, 0x9b, 0xa6, 0x20, 0x1e, 0x16, 0x0f, 0x0a, 0x0a, 0x0f, 0x0f, 0x0a, 0x13, 0x16, 0x1a, 0x5d, 0x57, 0xaa, 0xa0, 0xa1, 0xa1, 0xa1, 0x99, 0x9c, 0x90, 0xa2, 0x8a, 0xcf, 0xea, 0xed, 0xf2, 0xee, 0xe3, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xf0, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xef, 0xe4, 0xfb, 0xe4, 0xef, 0xe4, 0xf0, 0xef, 0xe4, 0xfb, 0xe4, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xf2, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xe4, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xee, 0xe4, 0xe3, 0xe3, 0x6c, 0xe4, 0xfb, 0xfb, 0xe4, 0xe9, 0xd7, 0x92, 0x9f, 0x9f, 0x9e, 0x96, 0x9e, 0xa0, 0xa5, 0xae, 0x57, 0x15, 0x13, 0x0a, 0x0f, 0x10, 0x14, 0x11, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0d, 0x0f, 0x15, 0x93, 0x99, 0x99, 0x99, 0x99, 0x95, 0x9a, 0xa3, 0x8a, 0x79, 0x3a, 0x3a, 0x3c, 0x3a, 0x3a, 0x3a, 0x3d, 0x38, 0x3d, 0x45, 0x3c, 0x37, 0x45, 0x38, 0x38, 0x45, 0x38, 0x36, 0x36, 0x34, 0x34, 0x36, 0x39, 0x43, 0x39, 0x3d, 0x38, 0x3f, 0x38, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x38, 0x38, 0x3d, 0x3a, 0x3c, 0x3a, 0x38, 0x3a, 0x3d, 0x37, 0x37, 0x39, 0x3d, 0x3f, 0x42, 0x3f, 0x43, 0x40, 0x45, 0x40, 0x39, 0x40, 0x3a, 0x3a, 0x3d, 0x3d, 0x3c, 0x3c, 0x40, 0x39, 0x3b, 0x76, 0xa5, 0x94, 0x90, 0x9a, 0x94, 0x95, 0x95, 0x92, 0xa6, 0x1e, 0x1c, 0x11, 0x14, 0x12, 0x11, 0x11, 0x12, 0x12, 0x12, 0x10, 0x10, 0x10, 0x1a, 0x57, 0xa6, 0xa0, 0x99, 0xa1, 0x9e, 0x95, 0x9a, 0x9a, 0x92, 0xaa, 0xde, 0xe6, 0xf2, 0xe4, 0xe5, 0xe5, 0xfc, 0xfd, 0xee, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 
-  0xef, 0xed, 0xef, 0xed, 0xee, 0xe4, 0xf0, 0xef, 0xef, 0xee, 0xee, 0xf0, 0xef, 0xe4, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xee, 0xee, 0xf2, 0xee, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xef, 0xef, 0xee, 0xee, 0xf2, 0xef, 0xfb, 0xe4, 0xfb, 0xe4, 0xef, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xe4, 0xe5, 0xe3, 0xe5, 0xe4, 0x6c, 0xfd, 0xed, 0xe3, 0xe9, 0xb3, 0x99, 0x9c, 0x9e, 0x98, 0x9e, 0x9e, 0x9b, 0xaa, 0x57, 0x15, 0x0e, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x11, 0x11, 0x17, 0x0d, 0x10, 0x18, 0xa6, 0x99, 0x90, 0x9c, 0x94, 0x9a, 0x90, 0xa3, 0x80, 0x6e, 0x37, 0x3c, 0x3c, 0x39, 0x3a, 0x3a, 0x3d, 0x3a, 0x45, 0x37, 0x3f, 0x3c, 0x3f, 0x3a, 0x36, 0x34, 0x34, 0x46, 0x49, 0x4d, 0x4d, 0x46, 0x35, 0x34, 0x35, 0x39, 0x3f, 0x37, 0x3f, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x3c, 0x3d, 0x3d, 0x38, 0x3d, 0x38, 0x43, 0x3b, 0x37, 0x34, 0x34, 0x35, 0x41, 0x3b, 0x34, 0x35, 0x34, 0x3d, 0x43, 0x3b, 0x43, 0x36, 0x39, 0x3a, 0x3d, 0x3a, 0x3b, 0x3a, 0x40, 0x3c, 0x42, 0x3d, 0x67, 0x68, 0xa5, 0x8e, 0x90, 0x95, 0x94, 0x99, 0x9a, 0x8e, 0xa6, 0x1a, 0x1c, 0x17, 0x14, 0x14, 0x11, 0x14, 0x14, 0x14, 0x14, 0x11, 0x14, 0x14, 0x10, 0x16, 0xfa, 0xaa, 0xa0, 0x9e, 0x9a, 0x9a, 0x9f, 0x99, 0x99, 0x9b, 0xcf, 0xe9, 0xe3, 0xf2, 0xe5, 0xe5, 0xfc, 0xfc, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xef, 0xef, 0xee, 0xe4, 0xe4, 0xe4, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xe4, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xe4, 0xe4, 0xe4, 0xe4, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xef, 0xe4, 0xe5, 0xe5, 0x6c, 0xfb, 0xfc, 0xef, 0xe6, 0xdd, 0x8a, 0x9c, 0x9c, 0x9e, 0x9e, 0x9e, 0x9f, 0xa5, 0xa6, 0x15, 0x0e, 0x0b, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x1c, 0x18, 0x8f, 0x9c, 0x90, 0x95, 0x9c, 0x91, 0x9a, 0xa3, 0x75, 0x6e, 0x38, 0x3c, 0x3c, 0x3a, 0x67, 0x3d, 0x3d, 0x38, 0x36, 0x36, 0x45, 0x3f, 0x34, 0x46, 0x46, 0x57, 0x2b, 0x6c, 0xf6, 0xf6, 0xff, 0x30, 0x64, 0x60, 0x49, 0x6d, 0x36, 0x41, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3a, 0x3d, 0x3d, 0x37, 0x37, 0x34, 0x3b, 0x69, 0xc4, 0x64, 0x64, 0x65, 0x2b, 0x5d, 0x4d, 0x35, 0x34, 0x39, 0x3b, 0x46, 0x43, 0x39, 0x38, 0x3b, 0x3b, 0x3a, 0x3d, 0x42, 0x3c, 0x3d, 0x3b, 0x73, 0x97, 0x99, 0x90, 0x99, 0x92, 0x99, 0x91, 0x90, 0x97, 0x1a, 0x21, 0x19, 0x14, 0x11, 0x14, 0x11, 0x11, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x15, 0xfa, 0xa5, 0x9c, 0x96, 0x9a, 0xa0, 0x9c, 0x9f, 0x8e, 0xb3, 0xe7, 0xe4, 0xe4, 0xe5, 0xee, 0xfc, 0xfc, 0xee, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 
-  0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xee, 0xfc, 0xfb, 0xfc, 0xe3, 0xe9, 0xcf, 0x8e, 0xa2, 0xa4, 0xa1, 0xa4, 0xa1, 0xa0, 0xaa, 0xfa, 0x09, 0x14, 0x14, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x10, 0x12, 0x0d, 0x19, 0x21, 0x18, 0x8f, 0x9a, 0x9a, 0x95, 0x99, 0x9a, 0x99, 0xa3, 0x7b, 0x35, 0x40, 0x42, 0x3c, 0x3a, 0x67, 0x3a, 0x3d, 0x45, 0x57, 0x43, 0x34, 0x34, 0x3b, 0x27, 0xff, 0xf9, 0x6c, 0x6b, 0x60, 0x5d, 0x5d, 0x27, 0x6b, 0xf6, 0x33, 0x27, 0x3b, 0x35, 0x3a, 0x3d, 0x3c, 0x39, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3b, 0x40, 0x66, 0x23, 0x65, 0xf9, 0xdb, 0x6b, 0xd3, 0x6b, 0xe3, 0xf9, 0xf9, 0x65, 0x57, 0x68, 0x6d, 0x27, 0x5d, 0x36, 0x3d, 0x3a, 0x3b, 0x67, 0x3a, 0x38, 0x3c, 0x3f, 0x3f, 0x66, 0x86, 0xa3, 0x90, 0x94, 0x9b, 0x99, 0x90, 0x96, 0x8d, 0x15, 0x21, 0x1f, 0x17, 0x11, 0x11, 0x11, 0x12, 0x11, 0x12, 0x14, 0x14, 0x12, 0x14, 0x14, 0x0b, 0x15, 0xa6, 0xa3, 0x9a, 0x9a, 0xa1, 0x95, 0xa4, 0xa4, 0x97, 0xd8, 0xea, 0xe4, 0xee, 0xe5, 0xfc, 0xfd, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xe4, 0xef, 0xe4, 0xee, 0xef, 0xf0, 0xef, 0xee, 0xfb, 0xfd, 0xfb, 0xf2, 0xe7, 0xbb, 0x8b, 0xa4, 0xa2, 0xa4, 0xa7, 0xa1, 0xa8, 0xa6, 0xfa, 0x0a, 0x14, 0x14, 0x12, 0x10, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x14, 0x1f, 0x21, 0x15, 0x97, 0x95, 0x90, 0x9c, 0x99, 0x99, 0x99, 0xa3, 0x73, 0x67, 0x42, 0x3e, 0x3c, 0x3a, 0x67, 0x3a, 0x39, 0x40, 0x64, 0x29, 0x6d, 0x4b, 0x65, 0xf9, 0x64, 0x57, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x70, 0x2b, 0xf9, 0xc4, 0x3b, 0x36, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x42, 0x34, 0x46, 0x64, 0xf6, 0xce, 0x70, 0x6e, 0x6d, 0x6d, 0x72, 0x6f, 0x04, 0xbc, 0xe1, 0xf9, 0x6c, 0xfa, 0x6b, 0x60, 0x36, 0x36, 0x36, 0x67, 0x3b, 0x38, 0x3f, 0x3e, 0x3f, 0x3b, 0x66, 0x83, 0xa3, 0x8c, 0x99, 0x97, 0xa1, 0x91, 0x96, 0x8b, 0x15, 0x21, 0x1f, 0x19, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x14, 0x12, 0x13, 0x0f, 0x11, 0x14, 0x0e, 0xfa, 0x9d, 0x96, 0x9a, 0xa1, 0xa1, 0x98, 0xa2, 0x92, 0xc4, 0xeb, 0xe4, 0xe5, 0xee, 0xfc, 0xfc, 0xfb, 0xe4, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xfb, 0xf0, 0xef, 0xfd, 0xee, 0xfb, 0xe9, 0xdd, 0xaf, 0x94, 0xa2, 0xa7, 0xa1, 0xa1, 0xa4, 0xa8, 0xfa, 0x09, 0x0a, 0x11, 0x14, 0x12, 0x10, 0x12, 0x10, 0x12, 0x12, 0x11, 0x12, 0x14, 0x11, 0x1d, 0x1f, 0x1c, 0xfa, 0x9b, 0x90, 0x9a, 0x99, 0x9c, 0x99, 0x99, 0x9d, 0x6e, 0x39, 0x3e, 0x3c, 0x3a, 0x38, 0x3a, 0x36, 0x34, 0x72, 0x69, 0xec, 0x65, 0xec, 0x65, 0x04, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x57, 0x27, 0xc4, 0x57, 0x6f, 0x6d, 0x78, 0xec, 0x64, 0x6d, 0x37, 0x3a, 0x3a, 0x38, 0x3d, 0x3c, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x40, 0x39, 0x40, 0x37, 0x3c, 0x3f, 0x42, 0x35, 0x4b, 0x30, 0x2b, 0x66, 0x6d, 0x73, 0x76, 0x93, 0x76, 0x72, 0x6d, 0x6d, 0x6d, 0x6d, 0x78, 0x6b, 0xf9, 0x6c, 0x4b, 0x6d, 0x68, 0x4d, 0x3b, 0x67, 0x3a, 0x3f, 0x3f, 0x3a, 0x3a, 0x67, 0x75, 0xa3, 0x94, 0x99, 0x99, 0x94, 0x91, 0x91, 0x92, 0xfa, 0x1e, 0x1f, 0x1d, 0x14, 0x0d, 0x11, 0x12, 0x11, 0x12, 0x11, 0x12, 0x10, 0x10, 0x12, 0x10, 0x0f, 0x09, 0xa6, 0xa3, 0x9a, 0xa1, 0xa1, 0x9a, 0x95, 0x9b, 0xb1, 0xe7, 0xe6, 0xf2, 0xfc, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf1, 0xfb, 0xe5, 0xe8, 0xdc, 0xa8, 0x94, 0xa7, 0xa0, 0xa7, 0x9e, 0xa4, 0xa8, 0xfa, 0x0e, 0x14, 0x10, 0x12, 0x10, 0x12, 0x10, 0x12, 0x10, 0x12, 0x12, 0x11, 0x11, 0x17, 0x1d, 0x1d, 0x1c, 0xfa, 0x9b, 0x9a, 0x95, 0x99, 0x95, 0x9c, 0xa0, 0x97, 0x6e, 0x3c, 0x3e, 0x38, 0x3f, 0x37, 0x3e, 0x57, 0x70, 0x6d, 0x72, 0xdb, 0xf9, 0x2b, 0x6d, 0x6d, 0x7a, 0x79, 0x72, 0x57, 0x65, 0xf8, 0xf9, 0xf9, 0xf9, 0xfc, 0x5d, 0x6d, 0x77, 0xe8, 0x5d, 0x34, 0x43, 0x37, 0x3f, 0x38, 0x3c, 0x3d, 0x39, 0x3d, 0x3b, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3a, 0x38, 0x3a, 0x3d, 0x3d, 0x3c, 0x39, 0x3c, 0x42, 0x39, 0x38, 0x3b, 0x35, 0x64, 0x27, 0x6d, 0x70, 0xbc, 0xe1, 0xfe, 0xff, 0xf5, 0xe0, 0xdf, 0x73, 0x6d, 0x6d, 0x6d, 0x66, 0x27, 0xf9, 0x64, 0xfa, 0x2b, 0x78, 0x6d, 0x34, 0x43, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x75, 0x9d, 0x99, 0x92, 0x94, 0x90, 0x94, 0x8e, 0x92, 0xfa, 0x1e, 0x1f, 0x1f, 0x17, 0x0b, 0x11, 0x11, 0x12, 0x11, 0x12, 0x14, 0x14, 0x11, 0x10, 0x0f, 0x10, 0x09, 0xfa, 0xa5, 0x99, 0x9e, 0x9c, 0x9e, 0x9c, 0xa0, 0xaf, 0xde, 0xe8, 0xf0, 0xfc, 0xee, 0xe5, 0xe4, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xfb, 0xee, 0xe9, 0xd7, 0x9b, 0xa4, 0xa2, 0xa4, 0xa1, 0xa4, 0x9f, 0xaa, 0x0c, 0x0e, 0x10, 0x10, 0x12, 0x12, 0x10, 0x10, 0x10, 0x12, 0x10, 0x12, 0x14, 0x0b, 0x19, 0x1d, 0x1d, 0x1c, 0xfa, 0x92, 0x9a, 0x95, 0x99, 0x95, 0x95, 0xa0, 0x8d, 0x6e, 0x38, 0x3c, 0x3d, 0x37, 0x45, 0x34, 0x57, 0xdb, 0x5d, 0xfa, 0xe0, 0x57, 0x6d, 0x6d, 0x72, 0x79, 0x7c, 0xbc, 0xf8, 0xf9, 0xf9, 0xec, 0xec, 0xff, 0xf9, 0xec, 0x65, 0x6f, 0x74, 0xf6, 0x69, 0x34, 0x43, 0x3a, 0x3c, 0x3c, 0x3c, 0x3d, 0x39, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x3a, 0x38, 0x3d, 0x39, 0x3d, 0x3c, 0x40, 0x3d, 0x3c, 0x3f, 0x3d, 0x34, 0x6a, 0x6a, 0x72, 0x27, 0xf8, 0xf9, 0xf8, 0xec, 0xf9, 0xf9, 0xf9, 0xf9, 0xe1, 0x83, 0x72, 0x6e, 0x6d, 0x6d, 0x69, 0xff, 0xec, 0x60, 0x6d, 0x41, 0x50, 0x3f, 0x3d, 0x3d, 0x3f, 0x3d, 0x3a, 0x74, 0x92, 0x99, 0x8e, 0x94, 0x90, 0x94, 0x8e, 0x8e, 0xfa, 0x1e, 0x1f, 0x1f, 0x17, 0x11, 0x12, 0x11, 0x12, 0x11, 0x12, 0x11, 0x14, 0x12, 0x10, 0x10, 0x10, 0x0e, 0x0c, 0xa5, 0x9c, 0x95, 0xa1, 0x9c, 0x9f, 0xa0, 0xa8, 0xdb, 0xe8, 0xf2, 0xfc, 0xee, 0xe3, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xf1, 0xee, 0xee, 0xea, 0xd4, 0x92, 0xa1, 0xa4, 0x9a, 0xa7, 0xa1, 0xa7, 0xa6, 0x0c, 0x0a, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x0d, 0x19, 0x1f, 0x1d, 0x1c, 0xfa, 0x92, 0x9a, 0x95, 0x99, 0x95, 0x99, 0xa0, 0x8d, 0x6e, 0x38, 0x3e, 0x3a, 0x43, 0x38, 0x3c, 0x34, 0x57, 0xeb, 0xff, 0x5d, 0x6d, 0x72, 0x6d, 0x7b, 0x84, 0x8b, 0xe9, 0xf8, 0xec, 0xf8, 0xf9, 0xf6, 0xf9, 0xf9, 0xf6, 0xf9, 0xe1, 0x70, 0x6a, 0x65, 0x34, 0x37, 0x3f, 0x39, 0x3c, 0x38, 0x3d, 0x3d, 0x39, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3a, 0x39, 0x3d, 0x3c, 0x3c, 0x3d, 0x3d, 0x37, 0x45, 0x34, 0x50, 0x64, 0x73, 0x6a, 0xec, 0xf9, 0xec, 0xec, 0xec, 0xff, 0xff, 0xf7, 0xec, 0xe7, 0xdd, 0xa5, 0x6d, 0x72, 0x6d, 0x6d, 0x78, 0xf6, 0x64, 0x6b, 0x64, 0x1b, 0x37, 0x3f, 0x3d, 0x3d, 0x3f, 0x3a, 0x6f, 0x8d, 0x99, 0x92, 0x94, 0x90, 0x91, 0x8e, 0x92, 0xfa, 0x1e, 0x1f, 0x1c, 0x19, 0x14, 0x0d, 0x11, 0x0d, 0x11, 0x0d, 0x11, 0x12, 0x0d, 0x10, 0x12, 0x11, 0x0a, 0x0c, 0xa6, 0xa3, 0x9c, 0xa1, 0x95, 0xa4, 0xa0, 0xa5, 0xd8, 0xe8, 0xf0, 0xfc, 0xee, 0xe5, 0xe4, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xfc, 0xef, 0xea, 0xcf, 0x9b, 0xa4, 0x9a, 0xa4, 0x9f, 0xa7, 0xa0, 0xa6, 0x09, 0x0a, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x12, 0x0d, 0x14, 0x1d, 0x1d, 0x1d, 0x1c, 0xfa, 0x92, 0x9a, 0x95, 0x99, 0x95, 0x95, 0xa0, 0x8a, 0x6e, 0x37, 0x3c, 0x3a, 0x37, 0x38, 0x45, 0x67, 0x6d, 0x6b, 0x6a, 0x6d, 0x6d, 0x72, 0x7b, 0xb4, 0x7c, 0xb1, 0xe9, 0xeb, 0xf9, 0xeb, 0xf9, 0xf9, 0xff, 0xff, 0xec, 0xf9, 0xf9, 0xc4, 0x72, 0x30, 0x69, 0x34, 0x43, 0x37, 0x3c, 0x3d, 0x3c, 0x3d, 0x3a, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x3a, 0x39, 0x3a, 0x3c, 0x39, 0x3c, 0x3c, 0x43, 0x42, 0x36, 0x34, 0x64, 0xdf, 0x5d, 0xf9, 0xf5, 0xf9, 0xec, 0xff, 0xec, 0xff, 0xf9, 0xf9, 0xeb, 0xde, 0xd9, 0xdc, 0xaa, 0x72, 0x6d, 0x6d, 0x6d, 0x5d, 0xf4, 0x27, 0x78, 0x3b, 0x37, 0x43, 0x43, 0x3f, 0x3f, 0x3f, 0x6f, 0x92, 0x92, 0x99, 0x8c, 0x91, 0x8c, 0x94, 0x8e, 0xa6, 0x1e, 0x1f, 0x1f, 0x1c, 0x17, 0x0d, 0x0d, 0x12, 0x0d, 0x10, 0x0d, 0x10, 0x12, 0x10, 0x11, 0x14, 0x0f, 0x09, 0xa6, 0xa3, 0x9f, 0xa1, 0x9c, 0x9f, 0xa0, 0x9d, 0xd7, 0xe8, 0xf2, 0xfc, 0xee, 0xe3, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xf1, 0xfb, 0xee, 0xea, 0xcf, 0x9b, 0xa1, 0x96, 0x9a, 0xa4, 0xa7, 0xa5, 0xa6, 0x09, 0x0a, 0x14, 0x10, 0x0f, 0x10, 0x0b, 0x10, 0x10, 0x10, 0x10, 0x14, 0x0d, 0x17, 0x1d, 0x1d, 0x1d, 0x1c, 0xfa, 0x92, 0x90, 0x95, 0x99, 0x95, 0x99, 0x99, 0x8d, 0x79, 0x38, 0x3c, 0x3a, 0x41, 0x38, 0x3c, 0x34, 0x70, 0x65, 0x70, 0x6d, 0x79, 0x6d, 0xb4, 0xab, 0x7a, 0x7c, 0xad, 0xd3, 0xeb, 0xf9, 0xec, 0xec, 0xf9, 0xec, 0xf9, 0xec, 0xf9, 0x6b, 0x72, 0xc4, 0x2b, 0x35, 0x3b, 0x37, 0x3d, 0x38, 0x3c, 0x38, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x3a, 0x3d, 0x3d, 0x3c, 0x3c, 0x3d, 0x3c, 0x43, 0x34, 0x4b, 0xe1, 0x69, 0xeb, 0xf9, 0xec, 0xf6, 0xec, 0xf9, 0xff, 0xff, 0xf9, 0x6b, 0x89, 0x75, 0xae, 0xd6, 0xd1, 0xb8, 0x79, 0x6d, 0x6d, 0x6d, 0x6b, 0xc4, 0x6d, 0x3b, 0x3b, 0x3f, 0x3f, 0x3f, 0x3f, 0x3a, 0x74, 0x8d, 0xa0, 0x92, 0x94, 0x90, 0x91, 0x8e, 0x8e, 0xfa, 0x1e, 0x1f, 0x1c, 0x1f, 0x17, 0x0b, 0x0d, 0x0d, 0x0d, 0x12, 0x10, 0x12, 0x0f, 0x12, 0x0d, 0x14, 0x10, 0x09, 0xa6, 0xa3, 0x99, 0xa1, 0xa4, 0x9f, 0xa0, 0x9b, 0xd7, 0xe8, 0xf0, 0xfc, 0xee, 0xe5, 0xe5, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 
-  0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xfc, 0xed, 0xea, 0xd4, 0x92, 0xa4, 0x9a, 0x9a, 0x9f, 0xa7, 0xa7, 0xa6, 0x09, 0x0a, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x12, 0x0d, 0x17, 0x1f, 0x1d, 0x19, 0x1c, 0xfa, 0x92, 0x9a, 0x94, 0x99, 0x95, 0x94, 0x99, 0x9b, 0x6e, 0x67, 0x3c, 0x3a, 0x3b, 0x3d, 0x38, 0x46, 0x6a, 0x6a, 0x6d, 0x72, 0x72, 0x7a, 0xd9, 0x7a, 0x7a, 0x8a, 0x81, 0x97, 0xbc, 0xf9, 0xec, 0xf9, 0xec, 0xec, 0xf9, 0xec, 0xf9, 0xf9, 0xd3, 0x60, 0xf5, 0x68, 0x35, 0x3f, 0x38, 0x3c, 0x38, 0x3c, 0x38, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x38, 0x3c, 0x3d, 0x3f, 0x39, 0x34, 0x60, 0x65, 0xce, 0xf9, 0xec, 0xec, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0x77, 0x6f, 0x76, 0x6f, 0xd4, 0xd6, 0xcd, 0x8e, 0x72, 0x6d, 0x6d, 0x70, 0x6c, 0x69, 0x6d, 0x43, 0x3a, 0x43, 0x3f, 0x3a, 0x37, 0x74, 0x9b, 0x8e, 0xa0, 0x8c, 0x90, 0x94, 0x8e, 0x8e, 0xa6, 0x1e, 0x1d, 0x1f, 0x1c, 0x19, 0x0b, 0x0b, 0x0b, 0x10, 0x0d, 0x10, 0x0d, 0x0f, 0x10, 0x11, 0x14, 0x10, 0x09, 0xa6, 0xa3, 0x9c, 0x9c, 0x9f, 0xa4, 0xa0, 0xa5, 0xd7, 0xe8, 0xf0, 0xfc, 0xee, 0xe5, 0xed, 0xf0, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 
-  0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xee, 0xee, 0xee, 0xef, 0xf1, 0xfb, 0xf2, 0xea, 0xd7, 0x9b, 0xa4, 0x9a, 0xa4, 0xa4, 0xa1, 0xa8, 0xa6, 0x0c, 0x0a, 0x12, 0x10, 0x10, 0x10, 0x0b, 0x10, 0x10, 0x10, 0x10, 0x11, 0x0d, 0x17, 0x1f, 0x1d, 0x1d, 0x1c, 0xfa, 0x92, 0x9a, 0x95, 0x99, 0x95, 0x94, 0x99, 0x9b, 0x79, 0x37, 0x3a, 0x3a, 0x3b, 0x3d, 0x34, 0x4b, 0xdb, 0x4d, 0x6d, 0x35, 0x6d, 0xaf, 0xc5, 0xb9, 0xeb, 0xe9, 0xb8, 0x83, 0xdf, 0xf9, 0xec, 0xec, 0xf9, 0xf9, 0xff, 0xec, 0xec, 0xec, 0xf9, 0xf9, 0xf9, 0x69, 0x35, 0x37, 0x3d, 0x3d, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x3c, 0x38, 0x3f, 0x3b, 0x35, 0x6b, 0xec, 0xff, 0xec, 0xf9, 0xf5, 0xf9, 0xec, 0xf9, 0xec, 0xf9, 0xeb, 0x86, 0x6e, 0x68, 0xdf, 0xf6, 0xde, 0xc2, 0xd5, 0x7d, 0x6d, 0x6d, 0x6d, 0xc4, 0x64, 0x6d, 0x3a, 0x3b, 0x3a, 0x3f, 0x3f, 0x67, 0x74, 0x9d, 0x94, 0x99, 0x94, 0x90, 0x91, 0x8e, 0x92, 0xfa, 0x1e, 0x1c, 0x1d, 0x1c, 0x19, 0x0b, 0x0b, 0x0d, 0x10, 0x12, 0x10, 0x0d, 0x10, 0x10, 0x0d, 0x11, 0x0a, 0x0c, 0x97, 0xa3, 0x9c, 0xa1, 0x9e, 0x9f, 0xa7, 0xa5, 0xdb, 0xe6, 0xf0, 0xfc, 0xfc, 0xe5, 0xe5, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 
-  0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xe4, 0xf0, 0xfb, 0xfc, 0xee, 0xe9, 0xd8, 0xa0, 0x9f, 0xa4, 0x9f, 0xa7, 0x9e, 0xa7, 0xa5, 0x0c, 0x0e, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0b, 0x12, 0x0d, 0x17, 0x1d, 0x1d, 0x19, 0x1c, 0xfa, 0x92, 0x9a, 0x94, 0x99, 0x95, 0x94, 0x99, 0x9b, 0x7b, 0x34, 0x3a, 0x39, 0x67, 0x3d, 0x3c, 0x46, 0x2b, 0x6f, 0x6d, 0x72, 0x72, 0xbf, 0xbf, 0xd6, 0xeb, 0xf8, 0xf6, 0xe0, 0xe6, 0xec, 0xec, 0xf9, 0xec, 0xec, 0xec, 0xf9, 0xec, 0xf8, 0xec, 0xec, 0xf9, 0x5d, 0x6d, 0x3b, 0x3a, 0x3c, 0x3d, 0x3d, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x39, 0x3c, 0x3c, 0x3c, 0x3a, 0x3a, 0x35, 0x41, 0x65, 0xf9, 0xec, 0xeb, 0xf9, 0xec, 0xff, 0xf9, 0xf9, 0xec, 0xf9, 0xf9, 0xe1, 0xce, 0x2b, 0xf6, 0xec, 0xde, 0xca, 0xcd, 0xb3, 0x6d, 0x72, 0x6d, 0x70, 0x65, 0x68, 0x34, 0x3f, 0x3f, 0x3f, 0x3a, 0x3a, 0x74, 0x92, 0x94, 0x99, 0x90, 0x8c, 0x94, 0x8e, 0x92, 0xfa, 0x1e, 0x1c, 0x1d, 0x1c, 0x19, 0x0b, 0x0b, 0x0b, 0x0d, 0x10, 0x10, 0x11, 0x0d, 0x10, 0x12, 0x0b, 0x0e, 0x0c, 0x97, 0x9c, 0xa1, 0xa4, 0x9c, 0x9c, 0xa0, 0xa5, 0xdd, 0xe8, 0xf0, 0xfc, 0xee, 0xe5, 0xe4, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xee, 0xee, 0xee, 0xf0, 0xf1, 0xfb, 0xed, 0xe6, 0xdd, 0xaf, 0xa1, 0xa2, 0xa7, 0xa1, 0xa4, 0x9f, 0xa5, 0x0c, 0x0e, 0x0b, 0x10, 0x12, 0x10, 0x0b, 0x10, 0x10, 0x10, 0x10, 0x11, 0x0d, 0x17, 0x1f, 0x1d, 0x1d, 0x1c, 0xfa, 0x92, 0x9a, 0x95, 0x99, 0x95, 0x94, 0x99, 0xa3, 0x75, 0x37, 0x38, 0x67, 0x3b, 0x3d, 0x37, 0x4b, 0xce, 0x6d, 0x72, 0x6d, 0x79, 0xd1, 0xb9, 0xd9, 0xf8, 0xf7, 0xec, 0xf9, 0xec, 0xec, 0xf9, 0xec, 0xec, 0xf9, 0xf9, 0xff, 0xf8, 0xf9, 0xec, 0xec, 0xf9, 0xc4, 0x6d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3c, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x38, 0x3a, 0x37, 0x67, 0x68, 0xe1, 0xf9, 0xec, 0xf9, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xec, 0xec, 0xec, 0xf8, 0xf9, 0xf9, 0xec, 0xec, 0xe7, 0xd5, 0xc3, 0xd6, 0x7a, 0x6d, 0x6d, 0x72, 0x2b, 0x78, 0x36, 0x3b, 0x3a, 0x41, 0x3a, 0x67, 0x80, 0xa3, 0x9c, 0x8e, 0x95, 0x90, 0x8c, 0x92, 0x92, 0xfa, 0x1e, 0x1f, 0x1c, 0x1f, 0x1c, 0x0b, 0x10, 0x0b, 0x10, 0x10, 0x0d, 0x11, 0x11, 0x10, 0x0f, 0x0f, 0x08, 0xfa, 0x9d, 0x9c, 0x9f, 0xa4, 0xa4, 0x9c, 0x99, 0xaf, 0xde, 0xe6, 0xf0, 0xfc, 0xfc, 0xe5, 0xe4, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 
-  0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xef, 0xef, 0xef, 0xfc, 0xf0, 0xee, 0xe6, 0xde, 0xb4, 0x94, 0xa0, 0xa7, 0xa1, 0xa4, 0x9e, 0xa5, 0x93, 0x09, 0x10, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x17, 0x1f, 0x1d, 0x19, 0x1c, 0xfa, 0x92, 0x90, 0x95, 0x99, 0x94, 0x95, 0x94, 0xa3, 0x80, 0x66, 0x3a, 0x3a, 0x3a, 0x38, 0x36, 0x4b, 0xc4, 0x6d, 0x72, 0x6d, 0x74, 0xd6, 0xb9, 0xd9, 0xf9, 0xf7, 0xff, 0xec, 0xec, 0xec, 0xec, 0xec, 0xf9, 0xff, 0xf9, 0xf9, 0xf9, 0xec, 0xf8, 0xec, 0xf9, 0xc4, 0x6d, 0x43, 0x3a, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x3c, 0x3c, 0x3d, 0x3f, 0x35, 0x68, 0x65, 0xf9, 0xec, 0xff, 0xec, 0xec, 0xff, 0xf9, 0xec, 0xf9, 0xec, 0xf8, 0xff, 0xff, 0xec, 0xea, 0xec, 0xeb, 0xcf, 0xc3, 0xd1, 0x7f, 0x72, 0x6d, 0x6d, 0x60, 0x57, 0x34, 0x3a, 0x3f, 0x3f, 0x3a, 0x67, 0x77, 0xa0, 0x94, 0x94, 0x95, 0x8c, 0x91, 0x8e, 0x97, 0xfa, 0x1e, 0x1f, 0x1f, 0x1c, 0x19, 0x10, 0x0b, 0x0f, 0x0b, 0x12, 0x0d, 0x0d, 0x0d, 0x10, 0x10, 0x0a, 0x09, 0x69, 0x9b, 0x9a, 0xa4, 0xa1, 0x9e, 0xa4, 0x92, 0xb4, 0xe7, 0xf2, 0xf2, 0xfc, 0xee, 0xe5, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xf0, 0xf0, 0xed, 0xef, 0xee, 0x6c, 0xed, 0xe6, 0xe7, 0xc3, 0x8b, 0xa1, 0x9f, 0xa1, 0xa1, 0x9f, 0xa2, 0xa6, 0x93, 0x0e, 0x0b, 0x14, 0x10, 0x10, 0x10, 0x10, 0x0a, 0x10, 0x10, 0x0d, 0x17, 0x1f, 0x1f, 0x1d, 0x1c, 0x18, 0x97, 0x90, 0x90, 0x99, 0x99, 0x91, 0x90, 0x99, 0x8d, 0x6e, 0x3b, 0x38, 0x3c, 0x3c, 0x36, 0x70, 0x27, 0x6d, 0x6d, 0x6d, 0x75, 0xd5, 0xc0, 0xd6, 0xf8, 0xf9, 0xff, 0xec, 0xec, 0xf8, 0xf9, 0xf8, 0xf9, 0xec, 0xec, 0xec, 0xec, 0xec, 0xf8, 0xf8, 0xf9, 0x27, 0x34, 0x37, 0x3a, 0x39, 0x3f, 0x3d, 0x3a, 0x3a, 0x43, 0x3f, 0x43, 0x3b, 0x39, 0x3b, 0x43, 0x39, 0x3b, 0x3d, 0x3a, 0x3d, 0x3d, 0x3c, 0x3c, 0x39, 0x3d, 0x39, 0x43, 0x65, 0xf9, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xf9, 0xf8, 0xf7, 0xf8, 0xec, 0xec, 0xec, 0xf9, 0xf8, 0xd4, 0xc0, 0xd5, 0x8d, 0x6d, 0x72, 0x6d, 0x57, 0x57, 0x34, 0x40, 0x3f, 0x3e, 0x3f, 0x67, 0x8d, 0x99, 0x8e, 0x8e, 0x94, 0x91, 0x90, 0x90, 0x8d, 0x18, 0x1c, 0x1f, 0x19, 0x1f, 0x1c, 0x0a, 0x0a, 0x0a, 0x0f, 0x0d, 0x11, 0x12, 0x0d, 0x11, 0x14, 0x0e, 0x0c, 0x9b, 0xa2, 0x96, 0x9c, 0x9e, 0x98, 0xa2, 0x9b, 0xbc, 0xeb, 0xe6, 0xe3, 0xe5, 0xe5, 0xf0, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xf0, 0xe4, 0xe5, 0xee, 0xee, 0xf2, 0xe3, 0xe9, 0xd7, 0x8e, 0xa2, 0x9f, 0x9f, 0xa1, 0xa4, 0xa2, 0xa5, 0x93, 0x09, 0x0e, 0x10, 0x10, 0x11, 0x11, 0x0d, 0x10, 0x0f, 0x0f, 0x10, 0x17, 0x1f, 0x19, 0x1f, 0x19, 0x1a, 0x93, 0x8b, 0x90, 0x91, 0x94, 0x9c, 0x90, 0x9c, 0x92, 0x7b, 0x66, 0x3e, 0x38, 0x38, 0x36, 0x49, 0x27, 0x6d, 0x72, 0x6d, 0x75, 0xd6, 0xbf, 0xd2, 0xf9, 0xfe, 0xf9, 0xec, 0xf9, 0xec, 0xec, 0xec, 0xec, 0xf9, 0xec, 0xf9, 0xec, 0xf9, 0xf8, 0xf8, 0xf9, 0x57, 0x34, 0x3a, 0x3d, 0x3c, 0x3d, 0x3c, 0x45, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x43, 0x42, 0x3d, 0x37, 0x3a, 0x42, 0x3a, 0x3c, 0x38, 0x3c, 0x3c, 0x42, 0x36, 0x3b, 0x3b, 0x6b, 0xf9, 0xff, 0xec, 0xec, 0xec, 0xff, 0xec, 0xec, 0xec, 0xf9, 0xf9, 0xf8, 0xec, 0xeb, 0xec, 0xf8, 0xe9, 0xd1, 0xc2, 0xd5, 0x8a, 0x6d, 0x6d, 0x6d, 0xdf, 0x69, 0x35, 0x3d, 0x38, 0x3f, 0x37, 0x6f, 0xa5, 0xa0, 0x94, 0x8e, 0x94, 0x91, 0x90, 0x8b, 0x8f, 0x1a, 0x21, 0x1c, 0x1f, 0x1f, 0x19, 0x0d, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0b, 0x0d, 0x10, 0x0a, 0x09, 0x93, 0xa3, 0xa4, 0x95, 0xa7, 0xa1, 0x9e, 0xa7, 0x97, 0xd7, 0xe9, 0xe3, 0xe5, 0xe5, 0xe5, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xe4, 0xe4, 0x6c, 0xee, 0xf3, 0xed, 0xe9, 0xde, 0xa5, 0x94, 0xa4, 0x9f, 0xa1, 0x9c, 0x9c, 0xa5, 0xa6, 0x0c, 0x09, 0x0a, 0x10, 0x11, 0x11, 0x0d, 0x0d, 0x10, 0x0f, 0x0f, 0x10, 0x1c, 0x1d, 0x1f, 0x1f, 0x16, 0xfa, 0x92, 0x90, 0x96, 0x95, 0x99, 0x94, 0x9a, 0xa3, 0x80, 0x6e, 0x3a, 0x38, 0x38, 0x67, 0x68, 0x60, 0x6d, 0x34, 0x6d, 0x74, 0xd7, 0xc2, 0xc3, 0xeb, 0xf8, 0xf9, 0xff, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xf9, 0xec, 0xf9, 0xf7, 0xf9, 0xf8, 0xf9, 0x4b, 0x36, 0x3c, 0x38, 0x40, 0x3c, 0x3c, 0x38, 0x3e, 0x3e, 0x38, 0x38, 0x36, 0x36, 0x36, 0x38, 0x38, 0x3e, 0x38, 0x3f, 0x3f, 0x3e, 0x38, 0x3c, 0x45, 0x38, 0x3a, 0x34, 0x6a, 0xf9, 0xec, 0xf9, 0xff, 0xff, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xff, 0xff, 0xf9, 0xf8, 0xe2, 0xc8, 0xc2, 0xd5, 0x83, 0x6d, 0x6d, 0x6d, 0x1b, 0x04, 0x36, 0x39, 0x3f, 0x67, 0x6e, 0x76, 0xa7, 0x8e, 0x94, 0x8e, 0x8e, 0x94, 0x8c, 0x8e, 0x69, 0x1e, 0x1e, 0x1e, 0x1c, 0x1f, 0x19, 0x14, 0x0b, 0x0d, 0x0b, 0x10, 0x10, 0x0d, 0x0d, 0x0e, 0x09, 0x93, 0x9d, 0xa2, 0x9a, 0xa4, 0xa0, 0xa7, 0x9e, 0xa2, 0xa5, 0xde, 0xe5, 0xe3, 0xe5, 0xe5, 0xee, 0xfc, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xe4, 0xe5, 0xfb, 0xfb, 0xef, 0xe3, 0xeb, 0xbb, 0x99, 0xa4, 0x9f, 0x9c, 0x9e, 0x95, 0xa7, 0xa5, 0xa6, 0x78, 0x09, 0x0f, 0x10, 0x0d, 0x11, 0x11, 0x12, 0x0b, 0x0f, 0x12, 0x1d, 0x1d, 0x1f, 0x19, 0x21, 0x1b, 0x92, 0x90, 0x96, 0x98, 0x99, 0x95, 0x90, 0xa2, 0x8d, 0x6f, 0x34, 0x3a, 0x3f, 0x3a, 0x45, 0x1b, 0x41, 0x6d, 0x34, 0x73, 0xcf, 0xd5, 0xbd, 0xdc, 0xec, 0xf7, 0xf9, 0xec, 0xec, 0xec, 0xec, 0xec, 0xf9, 0xf7, 0xf9, 0xf7, 0xf9, 0xf8, 0xf9, 0x64, 0x3b, 0x37, 0x3c, 0x3c, 0x42, 0x40, 0x3c, 0x3e, 0x38, 0x45, 0x47, 0x4c, 0x4f, 0x4f, 0x4c, 0x4c, 0x47, 0x3e, 0x37, 0x37, 0x38, 0x3f, 0x3e, 0x38, 0x37, 0x3a, 0x3f, 0x34, 0x5d, 0xf9, 0xf7, 0xf9, 0xf7, 0xf7, 0xf9, 0xec, 0xf9, 0xec, 0xec, 0xec, 0xf9, 0xf9, 0xf9, 0xf8, 0xf8, 0xda, 0xc9, 0xc2, 0xd2, 0x73, 0x6d, 0x6d, 0x35, 0xdf, 0x49, 0x36, 0x38, 0x41, 0x66, 0x7b, 0x8d, 0x99, 0x8c, 0x91, 0x94, 0x99, 0x8e, 0x8e, 0x97, 0xfa, 0x22, 0x1c, 0x1c, 0x21, 0x1f, 0x17, 0x0d, 0x0d, 0x0b, 0x0b, 0x11, 0x0b, 0x14, 0x0e, 0x09, 0x71, 0x9d, 0x9a, 0x9a, 0x9f, 0xa1, 0xa7, 0xa7, 0x9c, 0x99, 0xc1, 0xe9, 0xe6, 0xe5, 0xe5, 0xee, 0xf0, 0xfd, 0xee, 0xe4, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xe4, 0xe3, 0xee, 0xfc, 0xfd, 0xf1, 0xe4, 0xe8, 0xd8, 0xa0, 0xa2, 0x9c, 0x9f, 0x9e, 0x9f, 0x9c, 0x99, 0xaa, 0xa5, 0x78, 0x09, 0x0e, 0x0f, 0x10, 0x0d, 0x11, 0x10, 0x0d, 0x11, 0x1d, 0x1f, 0x1f, 0x19, 0x22, 0x57, 0x8a, 0x90, 0x96, 0x90, 0x95, 0x91, 0x9a, 0x94, 0xa5, 0x76, 0x66, 0x3a, 0x67, 0x38, 0x39, 0x57, 0x49, 0x6d, 0x35, 0x6d, 0xbc, 0xd5, 0xc2, 0xcd, 0xea, 0xec, 0xf7, 0xf9, 0xec, 0xf9, 0xec, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf9, 0xec, 0x60, 0x34, 0x67, 0x3d, 0x3c, 0x40, 0x3c, 0x38, 0x44, 0x4c, 0x4f, 0x50, 0x4c, 0x4c, 0x49, 0x4c, 0x4c, 0x52, 0x52, 0x4c, 0x3e, 0x36, 0x3c, 0x45, 0x3c, 0x38, 0x37, 0x43, 0x34, 0x4d, 0xeb, 0xe8, 0xeb, 0xf9, 0xf8, 0xf7, 0xf9, 0xf7, 0xec, 0xec, 0xec, 0xff, 0xf9, 0xf7, 0xf7, 0xf8, 0xcb, 0xc2, 0xc9, 0xbf, 0x72, 0x6d, 0x6d, 0x73, 0x1b, 0x43, 0x36, 0x3c, 0x67, 0x6e, 0x7c, 0xa5, 0x94, 0x91, 0x9a, 0x8c, 0x8e, 0x8e, 0x8e, 0x97, 0x57, 0x22, 0x1c, 0x1f, 0x1f, 0x1f, 0x17, 0x0b, 0x0b, 0x0a, 0x0b, 0x11, 0x14, 0x0a, 0x09, 0x78, 0xa5, 0x99, 0x9a, 0x95, 0x9c, 0xa1, 0xa4, 0xa1, 0x99, 0x92, 0xdb, 0xe7, 0xe3, 0xe5, 0xe5, 0xef, 0xfc, 0xfd, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xee, 0xf2, 0xfb, 0xfd, 0xfd, 0xfb, 0xe6, 0xe6, 0xbf, 0x8b, 0xa7, 0xa4, 0x95, 0xa4, 0x9c, 0x9c, 0x95, 0xa0, 0x9d, 0xfa, 0x0c, 0x09, 0x0e, 0x0f, 0x0a, 0x0d, 0x11, 0x17, 0x1f, 0x1f, 0x1c, 0x22, 0x57, 0x89, 0x92, 0x94, 0x91, 0x96, 0x90, 0x9a, 0x9a, 0xa3, 0xa6, 0x77, 0x66, 0x36, 0x45, 0x3a, 0x38, 0x4b, 0x04, 0x6d, 0x6d, 0x72, 0x80, 0xda, 0xc9, 0xbd, 0xda, 0xeb, 0xf9, 0xf7, 0xf7, 0xf9, 0xf7, 0xf7, 0xff, 0xf8, 0xf6, 0xec, 0xec, 0xea, 0xe1, 0x68, 0x66, 0x36, 0x43, 0x3d, 0x40, 0x37, 0x4f, 0x52, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3e, 0x47, 0x4e, 0x52, 0x00, 0x37, 0x3e, 0x37, 0x3d, 0x3d, 0x3b, 0x39, 0x34, 0xdb, 0xdd, 0xea, 0xeb, 0xec, 0xf7, 0xf7, 0xf7, 0xf9, 0xff, 0xff, 0xeb, 0xf9, 0xf7, 0xf8, 0xd9, 0xc9, 0xc2, 0xd5, 0x8d, 0x6d, 0x72, 0x6d, 0x49, 0x57, 0x34, 0x3d, 0x3e, 0x66, 0x73, 0x97, 0xa5, 0x9c, 0x90, 0x96, 0x91, 0x8c, 0x94, 0x8e, 0x92, 0xdf, 0x20, 0x21, 0x1f, 0x1f, 0x1f, 0x11, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0xfa, 0xa6, 0xa3, 0x9a, 0x99, 0xa7, 0xa0, 0xa1, 0x96, 0xa4, 0x92, 0xb4, 0xe9, 0xe8, 0xe4, 0xe5, 0xe5, 0xee, 0xf0, 0xfd, 0xee, 0xe4, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xed, 0xe5, 0xe4, 0xee, 0xfd, 0xfd, 0xf1, 0xe4, 0xe7, 0xdd, 0x9b, 0xa8, 0x94, 0xa9, 0x95, 0x9e, 0x9c, 0x9c, 0x95, 0x9c, 0x9d, 0x97, 0xfa, 0x0c, 0x09, 0x0e, 0x0a, 0x12, 0x19, 0x1f, 0x19, 0x22, 0x57, 0x85, 0x8b, 0x94, 0x99, 0x95, 0x9a, 0x96, 0x90, 0xa3, 0x8d, 0x74, 0x6e, 0x3a, 0x67, 0x3a, 0x38, 0x39, 0x45, 0x69, 0x34, 0x72, 0x72, 0x6d, 0xd6, 0xd5, 0xc9, 0xcd, 0xde, 0xeb, 0xf7, 0xf7, 0xf7, 0xf7, 0xf9, 0xf8, 0xec, 0xeb, 0xec, 0xea, 0xe0, 0xc4, 0x6d, 0x41, 0x41, 0x3d, 0x40, 0x3c, 0x52, 0x4c, 0x44, 0x44, 0x47, 0x44, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x44, 0x44, 0x47, 0x52, 0x4f, 0x37, 0x42, 0x42, 0x3d, 0x39, 0x39, 0x34, 0xdf, 0xde, 0xd7, 0xeb, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf9, 0xf9, 0xec, 0xff, 0xf8, 0xe2, 0xca, 0xc9, 0xc9, 0xcd, 0x7b, 0x72, 0x34, 0x6d, 0x57, 0x04, 0x34, 0x42, 0x37, 0x3a, 0x77, 0xae, 0x9d, 0x99, 0x9a, 0x90, 0x90, 0x91, 0x94, 0x8c, 0x8c, 0x97, 0xdf, 0x22, 0x21, 0x1f, 0x1f, 0x17, 0x0b, 0x0f, 0x08, 0x09, 0x09, 0x0c, 0x93, 0x97, 0xa0, 0xa2, 0x9c, 0x99, 0xa8, 0xa7, 0xa7, 0x96, 0x9a, 0x9d, 0xd8, 0xea, 0xe1, 0xf2, 0xe4, 0xe5, 0xe5, 0xf0, 0xfd, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xfb, 0xf0, 0xe4, 0xe4, 0xe4, 0xee, 0xfd, 0xfb, 0xfc, 0xe3, 0xe3, 0xe9, 0xc1, 0x92, 0xab, 0x91, 0x9e, 0x9c, 0xa1, 0x95, 0x9a, 0x98, 0x94, 0xa0, 0x97, 0xa6, 0xfa, 0xfa, 0x0c, 0x15, 0x1a, 0x21, 0x25, 0x57, 0x85, 0x84, 0x9a, 0x94, 0x99, 0x9f, 0x90, 0x90, 0xa8, 0x86, 0x79, 0x66, 0x3b, 0x39, 0x38, 0x3a, 0x38, 0x39, 0x38, 0x4b, 0x68, 0x6d, 0x79, 0x72, 0x83, 0xd9, 0xd2, 0xd2, 0xd2, 0xe2, 0xeb, 0xf8, 0xf8, 0xf8, 0xf8, 0xeb, 0xec, 0xeb, 0xde, 0xdb, 0xd3, 0x74, 0x34, 0x41, 0x3c, 0x3e, 0x36, 0x52, 0x52, 0x44, 0x44, 0x47, 0x4a, 0x51, 0x55, 0x58, 0x58, 0x58, 0x58, 0x55, 0x55, 0x4a, 0x47, 0x47, 0x52, 0x52, 0x38, 0x3e, 0x39, 0x42, 0x39, 0x39, 0x6e, 0xc7, 0xdd, 0xd3, 0xe9, 0xeb, 0xf8, 0xf8, 0xf8, 0xf8, 0xeb, 0xec, 0xeb, 0xe2, 0xd1, 0xcb, 0xcb, 0xd5, 0x8f, 0x6d, 0x34, 0x6d, 0x67, 0x57, 0x46, 0x37, 0x3a, 0x38, 0x67, 0x41, 0x76, 0x97, 0xaa, 0x99, 0x9a, 0x90, 0x8c, 0x8c, 0x91, 0x91, 0x8b, 0x8f, 0x57, 0x20, 0x22, 0x21, 0x10, 0x0a, 0x06, 0x09, 0x93, 0x93, 0x9d, 0xa5, 0xa3, 0x99, 0x9a, 0xa0, 0xa1, 0xa5, 0x8e, 0xab, 0x9a, 0x88, 0xc7, 0xea, 0xe1, 0xf3, 0xfb, 0xe4, 0xe5, 0xe5, 0xe5, 0xfc, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xfc, 0xe4, 0xe3, 0xe4, 0xe4, 0xf0, 0xfb, 0xef, 0xe3, 0xe6, 0xf3, 0xe2, 0xb3, 0x8e, 0xa4, 0x9a, 0x9f, 0xa1, 0x9f, 0x9c, 0x9e, 0x9a, 0x95, 0xa0, 0x9b, 0x9b, 0xa5, 0xa6, 0xa6, 0xfa, 0x20, 0x1b, 0x83, 0x82, 0x96, 0x90, 0x91, 0xa1, 0x90, 0xa2, 0xa8, 0x75, 0x6e, 0x67, 0x39, 0x40, 0x3c, 0x3c, 0x3c, 0x3a, 0x3c, 0x42, 0x42, 0x49, 0x67, 0x72, 0x66, 0x6d, 0x93, 0xd9, 0xd5, 0xd6, 0xd5, 0xd8, 0xdd, 0xde, 0xe7, 0xe9, 0xe2, 0xde, 0xd8, 0xd8, 0xd4, 0x76, 0x34, 0x45, 0x3a, 0x3e, 0x38, 0x4f, 0x52, 0x47, 0x47, 0x51, 0x59, 0x59, 0x5f, 0x59, 0x56, 0x59, 0x56, 0x58, 0x59, 0x5f, 0x5f, 0x5f, 0x51, 0x47, 0x4f, 0x52, 0x44, 0x38, 0x3e, 0x39, 0x3c, 0x66, 0x6f, 0xd3, 0xd8, 0xd7, 0xdd, 0xe2, 0xe9, 0xeb, 0xeb, 0xeb, 0xe2, 0xdd, 0xd1, 0xcd, 0xc9, 0xd2, 0xb3, 0x6d, 0x35, 0x72, 0x34, 0x50, 0x49, 0x66, 0x67, 0x3d, 0x3d, 0x39, 0x67, 0x6e, 0x6f, 0x77, 0xaa, 0xa3, 0x8c, 0x8e, 0x94, 0x91, 0x8c, 0x90, 0x8a, 0x8d, 0xa6, 0x27, 0x23, 0x15, 0x0c, 0x0c, 0x93, 0xa5, 0xa5, 0x9c, 0x99, 0x94, 0x9c, 0x9c, 0x9f, 0xa2, 0xa1, 0xa0, 0xa0, 0x8e, 0xaf, 0xe7, 0xe3, 0xf3, 0xef, 0xf0, 0xef, 0xe5, 0xe3, 0xe5, 0xe5, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 
-  0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xfb, 0xf0, 0xe4, 0xe4, 0xe3, 0xee, 0xf0, 0xee, 0xe5, 0xe3, 0xe3, 0xf1, 0xf2, 0xdc, 0xa3, 0x95, 0x9f, 0xa1, 0xa0, 0xa0, 0x9f, 0x9a, 0x9a, 0x9e, 0x9a, 0x9e, 0x95, 0x9a, 0x9f, 0xa0, 0xa5, 0xaa, 0x8f, 0x87, 0x90, 0x96, 0x91, 0x9e, 0x95, 0x96, 0xa2, 0x83, 0x72, 0x67, 0x39, 0x40, 0x42, 0x40, 0x3e, 0x38, 0x3c, 0x38, 0x40, 0x40, 0x45, 0x46, 0x34, 0x6d, 0x3b, 0x6d, 0x8d, 0xd6, 0xd6, 0xda, 0xd6, 0xda, 0xda, 0xd9, 0xd6, 0xd6, 0xd6, 0xd9, 0xc1, 0x7d, 0x72, 0x3a, 0x3e, 0x3e, 0x38, 0x4f, 0x5b, 0x47, 0x4a, 0x58, 0x5f, 0x59, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x56, 0x56, 0x62, 0x5f, 0x4a, 0x4f, 0x4f, 0x3e, 0x38, 0x3e, 0x38, 0x39, 0x34, 0x68, 0xc1, 0xdc, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd7, 0xd5, 0xd1, 0xcd, 0xd2, 0xd5, 0xad, 0x79, 0x35, 0x35, 0x34, 0x46, 0x49, 0x67, 0x41, 0x3b, 0x67, 0x3f, 0x3a, 0x3f, 0x3b, 0x72, 0x66, 0x74, 0x92, 0xa8, 0x99, 0x94, 0x8c, 0x96, 0x90, 0x94, 0x8a, 0x92, 0xae, 0xaa, 0xa6, 0x93, 0x9d, 0xa5, 0xa0, 0x95, 0x95, 0x9c, 0x9c, 0x9c, 0x95, 0x9a, 0x9e, 0x9a, 0xa7, 0x8e, 0xaf, 0xd8, 0xea, 0xe5, 0xf3, 0xfb, 0xfc, 0xf2, 0xe3, 0xe6, 0xe3, 0xe5, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xf0, 0xee, 0xe4, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xe3, 0xe5, 0xf2, 0xed, 0xea, 0xd7, 0xa8, 0x92, 0xa0, 0xa7, 0xa1, 0x98, 0x9e, 0x95, 0x95, 0x95, 0x9c, 0xa4, 0x9c, 0x94, 0xa1, 0xa0, 0xa8, 0x8e, 0x8e, 0x98, 0x98, 0x98, 0x9e, 0x8c, 0xa8, 0x75, 0x6d, 0x40, 0x40, 0x3c, 0x3c, 0x3d, 0x3e, 0x3c, 0x3c, 0x42, 0x3c, 0x3c, 0x40, 0x39, 0x3f, 0x3f, 0x37, 0x34, 0x39, 0x6d, 0x7b, 0xb3, 0xd0, 0xd6, 0xd5, 0xd6, 0xd5, 0xd6, 0xd4, 0xc7, 0x93, 0x6e, 0x34, 0x3a, 0x42, 0x3e, 0x44, 0x4a, 0x55, 0x4a, 0x55, 0x59, 0x59, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x59, 0x62, 0x55, 0x51, 0x4f, 0x44, 0x42, 0x3d, 0x3a, 0x37, 0x35, 0x66, 0x69, 0xd3, 0xd7, 0xd7, 0xd5, 0xd4, 0xd2, 0xd4, 0xd4, 0xd1, 0xbf, 0x87, 0x72, 0x66, 0x40, 0x3b, 0x3b, 0x45, 0x38, 0x36, 0x3a, 0x67, 0x3f, 0x3a, 0x3d, 0x39, 0x3d, 0x3d, 0x43, 0x72, 0x73, 0x89, 0xa5, 0x94, 0x98, 0x91, 0x90, 0x88, 0x94, 0x8b, 0xa0, 0x92, 0x9b, 0xa0, 0xa0, 0x9c, 0x9c, 0x9c, 0xa1, 0x99, 0xa0, 0xa1, 0x9f, 0x9a, 0x90, 0xa2, 0x8e, 0xaa, 0xd7, 0xeb, 0xed, 0xf2, 0xee, 0xfd, 0xef, 0xee, 0xe4, 0xe5, 0xe4, 0xe4, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xef, 0xee, 0xee, 0xed, 0xf3, 0xe3, 0xea, 0xd7, 0xaa, 0x9b, 0x8e, 0x9a, 0x9e, 0x9e, 0x9e, 0x9e, 0xa4, 0xa1, 0x94, 0x99, 0x99, 0xa0, 0xa0, 0xab, 0x88, 0x91, 0x95, 0x98, 0x9e, 0x90, 0xa3, 0x86, 0x6e, 0x40, 0x40, 0x40, 0x40, 0x37, 0x37, 0x38, 0x42, 0x40, 0x40, 0x42, 0x48, 0x48, 0x48, 0x48, 0x00, 0x48, 0x40, 0x34, 0x3b, 0x34, 0x34, 0x75, 0x8f, 0xaf, 0xb6, 0xb3, 0xaa, 0x77, 0x73, 0x6d, 0x37, 0x40, 0x40, 0x42, 0x3e, 0x4a, 0x58, 0x51, 0x55, 0x5c, 0x59, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x56, 0x61, 0x5b, 0x55, 0x4f, 0x36, 0x3d, 0x3c, 0x3f, 0x3d, 0x39, 0x6d, 0x46, 0x71, 0xb6, 0xc1, 0xc6, 0xc3, 0xbb, 0xb3, 0x89, 0x73, 0x72, 0x3b, 0x39, 0x35, 0x39, 0x38, 0x37, 0x37, 0x38, 0x3d, 0x3d, 0x37, 0x3a, 0x37, 0x3a, 0x39, 0x43, 0x3c, 0x3e, 0x34, 0x6f, 0x8d, 0xa3, 0x91, 0x91, 0x91, 0x8c, 0x8e, 0x8c, 0xa2, 0x9f, 0x9c, 0x9c, 0x9c, 0x99, 0x9c, 0x99, 0x99, 0xa7, 0x94, 0x95, 0x9c, 0x9a, 0x94, 0x8e, 0xa5, 0xd4, 0xea, 0xe3, 0xf2, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xfc, 0xee, 0xe4, 0xe6, 0xe9, 0xe0, 0xb4, 0x92, 0xa0, 0x9c, 0x9c, 0x9a, 0x95, 0x95, 0x9c, 0x9e, 0x9c, 0x95, 0xa4, 0xa1, 0xa4, 0x8c, 0x95, 0x95, 0x98, 0x95, 0xa2, 0x8b, 0x73, 0x6e, 0x40, 0x39, 0x40, 0x39, 0x3d, 0x38, 0x3c, 0x39, 0x48, 0x01, 0x05, 0x08, 0x13, 0x13, 0x16, 0x13, 0x0e, 0x05, 0x00, 0x40, 0x39, 0x3b, 0x66, 0x34, 0x34, 0x72, 0x72, 0x6d, 0x72, 0x6e, 0x3f, 0x3a, 0x38, 0x38, 0x38, 0x47, 0x58, 0x51, 0x5c, 0x5c, 0x56, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x56, 0x54, 0x53, 0x5f, 0x5f, 0x58, 0x4f, 0x44, 0x38, 0x38, 0x39, 0x3b, 0x3b, 0x66, 0x6d, 0x72, 0x72, 0x79, 0x79, 0x6e, 0x6d, 0x72, 0x66, 0x39, 0x39, 0x40, 0x00, 0x01, 0x4e, 0x01, 0x01, 0x00, 0x48, 0x42, 0x40, 0x3c, 0x3f, 0x3b, 0x67, 0x3a, 0x3d, 0x39, 0x3a, 0x6e, 0x7b, 0x8b, 0xa2, 0x8c, 0x90, 0x8c, 0x90, 0x8c, 0xa4, 0x9c, 0x9c, 0x9c, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0xa4, 0x9f, 0x95, 0xa3, 0x9b, 0xaf, 0xdb, 0xeb, 0xe3, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfb, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xe3, 0xe4, 0xe2, 0xe7, 0xe2, 0xcf, 0x92, 0x92, 0x99, 0x9f, 0x9f, 0x95, 0x95, 0x9a, 0x9e, 0x9e, 0x9a, 0xa4, 0x96, 0x8c, 0x9a, 0x98, 0xa1, 0xa1, 0xa8, 0x80, 0x72, 0x67, 0x3c, 0x40, 0x39, 0x37, 0x45, 0x3d, 0x40, 0x48, 0x03, 0x13, 0x08, 0x0f, 0x0f, 0x0d, 0x0b, 0x0b, 0x0f, 0x13, 0x13, 0x4e, 0x48, 0x40, 0x36, 0x3c, 0x39, 0x37, 0x3b, 0x3b, 0x67, 0x3a, 0x38, 0x38, 0x3e, 0x44, 0x44, 0x58, 0x55, 0x53, 0x59, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x5f, 0x58, 0x58, 0x4a, 0x38, 0x3e, 0x42, 0x35, 0x35, 0x67, 0x67, 0x34, 0x34, 0x67, 0x36, 0x6e, 0x3b, 0x3a, 0x35, 0x40, 0x01, 0x05, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x08, 0x01, 0x48, 0x40, 0x3d, 0x41, 0x67, 0x67, 0x3d, 0x3d, 0x3f, 0x67, 0x72, 0x83, 0xa0, 0x94, 0x91, 0x91, 0x91, 0x90, 0xa4, 0x9a, 0x9a, 0x9e, 0x9a, 0x9c, 0x9a, 0x9c, 0x9a, 0x9a, 0x9a, 0x94, 0x8e, 0x92, 0xb8, 0xe0, 0xeb, 0xef, 0xf1, 0xf1, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xf3, 0xed, 0xf3, 0xe6, 0xe3, 0xe2, 0xe9, 0xe0, 0xbb, 0xa5, 0x8b, 0x8e, 0x99, 0xa0, 0x9c, 0x9c, 0x9a, 0x9e, 0xa9, 0x9e, 0x90, 0x96, 0x95, 0x95, 0xa7, 0x9d, 0x7b, 0x6e, 0x3f, 0x38, 0x3e, 0x3d, 0x39, 0x38, 0x39, 0x48, 0x08, 0x0f, 0x0f, 0x10, 0x0f, 0x11, 0x11, 0x11, 0x0d, 0x11, 0x10, 0x0f, 0x13, 0x08, 0x00, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x38, 0x3f, 0x3c, 0x37, 0x3e, 0x38, 0x47, 0x58, 0x5f, 0x56, 0x56, 0x53, 0x54, 0x53, 0x53, 0x54, 0x54, 0x54, 0x53, 0x54, 0x53, 0x54, 0x53, 0x54, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x59, 0x53, 0x58, 0x51, 0x3e, 0x3c, 0x40, 0x39, 0x3b, 0x3b, 0x3a, 0x3c, 0x3e, 0x3c, 0x3f, 0x38, 0x36, 0x00, 0x05, 0x0f, 0x0f, 0x0f, 0x0b, 0x0f, 0x0d, 0x0d, 0x10, 0x12, 0x13, 0x08, 0x48, 0x3c, 0x39, 0x41, 0x67, 0x3b, 0x45, 0x39, 0x38, 0x73, 0x7b, 0x8d, 0x99, 0x94, 0x91, 0x98, 0x90, 0x96, 0xa4, 0x9a, 0x9a, 0x9f, 0x9e, 0x9c, 0x9e, 0x9f, 0x8c, 0x99, 0x92, 0xaf, 0xd8, 0xe9, 0xe8, 0xfb, 0xf1, 0xfb, 0xfb, 0xf2, 0xef, 0xf2, 0xf2, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xed, 0xef, 0xed, 0xe4, 0xef, 0xe6, 0xe3, 0xe7, 0xe8, 0xdd, 0xc6, 0xaf, 0x9d, 0x92, 0x92, 0x99, 0x99, 0x99, 0xa4, 0xa4, 0x8c, 0x9a, 0x98, 0xa1, 0xa7, 0x8d, 0x73, 0x41, 0x37, 0x3e, 0x3c, 0x3d, 0x3d, 0x3d, 0x40, 0x05, 0x13, 0x0b, 0x0b, 0x0d, 0x0d, 0x0d, 0x11, 0x11, 0x14, 0x0d, 0x0b, 0x0b, 0x0a, 0x0f, 0x13, 0x00, 0x3e, 0x3c, 0x3c, 0x3c, 0x40, 0x3d, 0x3e, 0x42, 0x38, 0x4e, 0x5b, 0x5e, 0x5a, 0x5c, 0x56, 0x54, 0x53, 0x54, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x5c, 0x5c, 0x62, 0x5b, 0x44, 0x39, 0x3d, 0x36, 0x3a, 0x38, 0x38, 0x3c, 0x3e, 0x38, 0x42, 0x00, 0x0a, 0x0f, 0x0f, 0x0a, 0x10, 0x11, 0x11, 0x11, 0x14, 0x0b, 0x10, 0x0a, 0x13, 0x08, 0x48, 0x40, 0x3a, 0x3a, 0x3b, 0x39, 0x3c, 0x45, 0x37, 0x6e, 0x8a, 0xa3, 0x91, 0x98, 0x90, 0x90, 0xa9, 0x9a, 0x9f, 0x9c, 0xa2, 0xa2, 0x9c, 0x8e, 0x94, 0xa8, 0xb1, 0xd4, 0xe2, 0xe8, 0xef, 0xef, 0xfb, 0xef, 0xf2, 0xee, 0xf2, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xe4, 0xef, 0xee, 0xfb, 0xf0, 0xee, 0xe5, 0xe3, 0xe3, 0xe6, 0xea, 0xe2, 0xd8, 0xc7, 0xb3, 0xaa, 0x9b, 0x8a, 0x92, 0xa0, 0x94, 0x9a, 0x95, 0xa4, 0xa0, 0x89, 0x72, 0x3b, 0x38, 0x38, 0x3f, 0x3f, 0x3d, 0x39, 0x48, 0x08, 0x0f, 0x0b, 0x11, 0x11, 0x0d, 0x10, 0x10, 0x10, 0x0d, 0x11, 0x0d, 0x0d, 0x12, 0x0a, 0x16, 0x03, 0x3c, 0x37, 0x3c, 0x3d, 0x38, 0x3d, 0x3d, 0x40, 0x4b, 0x2a, 0x2a, 0x26, 0x5a, 0x5c, 0x5c, 0x61, 0x56, 0x56, 0x53, 0x56, 0x54, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x56, 0x5c, 0x61, 0x61, 0x5c, 0x5a, 0x62, 0x25, 0x47, 0x35, 0x3f, 0x67, 0x38, 0x3a, 0x3e, 0x3c, 0x37, 0x48, 0x13, 0x0f, 0x0a, 0x10, 0x0b, 0x10, 0x0d, 0x11, 0x0d, 0x10, 0x0d, 0x12, 0x10, 0x0a, 0x13, 0x05, 0x40, 0x40, 0x40, 0x3b, 0x39, 0x3c, 0x3e, 0x3a, 0x6e, 0x86, 0xa0, 0x94, 0x98, 0x91, 0x90, 0xa9, 0x99, 0xa0, 0x99, 0x92, 0x92, 0x9b, 0xb1, 0xc6, 0xdc, 0xe9, 0xea, 0xe4, 0xe4, 0xf1, 0xfc, 0xef, 0xe4, 0xe3, 0xe3, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 
-  0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xee, 0xe3, 0xee, 0xee, 0xfc, 0xfb, 0xfc, 0xee, 0xee, 0xee, 0xe5, 0xe4, 0xe4, 0xe8, 0xea, 0xe9, 0xe2, 0xdd, 0xd7, 0xd7, 0xd7, 0xaf, 0x8c, 0x9e, 0xa4, 0xa0, 0x8d, 0x72, 0x3b, 0x38, 0x38, 0x3d, 0x3f, 0x3c, 0x39, 0x00, 0x13, 0x0a, 0x0d, 0x11, 0x0d, 0x11, 0x0f, 0x0f, 0x0f, 0x10, 0x10, 0x12, 0x0b, 0x12, 0x0b, 0x12, 0x08, 0x3e, 0x67, 0x3a, 0x37, 0x3a, 0x40, 0x39, 0x39, 0x40, 0x49, 0x13, 0x63, 0x2c, 0x26, 0x5e, 0x5a, 0x61, 0x61, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x54, 0x53, 0x53, 0x56, 0x5c, 0x61, 0x61, 0x5a, 0x5a, 0x61, 0x28, 0x2a, 0x28, 0x4e, 0x36, 0x37, 0x3a, 0x3a, 0x37, 0x39, 0x39, 0x42, 0x05, 0x13, 0x0b, 0x0b, 0x10, 0x0a, 0x0f, 0x0b, 0x14, 0x10, 0x10, 0x10, 0x0d, 0x10, 0x10, 0x0f, 0x0e, 0x48, 0x40, 0x40, 0x39, 0x39, 0x3c, 0x3c, 0x67, 0x6e, 0x8a, 0xa0, 0x91, 0x90, 0x9c, 0x9c, 0xaf, 0xb1, 0xb4, 0xb8, 0xcf, 0xd7, 0xde, 0xe7, 0xe9, 0xe6, 0xed, 0xef, 0xf0, 0xfb, 0xfc, 0xfb, 0xe5, 0xe3, 0xe3, 0xe3, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xf0, 0xe4, 0xe3, 0xe5, 0xe4, 0xee, 0xf0, 0xfc, 0xfb, 0xfc, 0xfc, 0xee, 0xee, 0xef, 0xf0, 0xed, 0xed, 0xed, 0xe3, 0xe8, 0xe9, 0xea, 0xea, 0xbf, 0x8e, 0x9e, 0x9a, 0xa2, 0x8d, 0x6e, 0x37, 0x39, 0x3c, 0x38, 0x43, 0x3c, 0x3d, 0x00, 0x13, 0x0a, 0x11, 0x0d, 0x11, 0x10, 0x0f, 0x0f, 0x0f, 0x10, 0x10, 0x11, 0x0d, 0x10, 0x0f, 0x0a, 0x08, 0x42, 0x3b, 0x3a, 0x3a, 0x3a, 0x39, 0x3c, 0x39, 0x40, 0x37, 0x3c, 0x38, 0x4f, 0x63, 0x2c, 0x61, 0x5e, 0x5a, 0x61, 0x61, 0x59, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x56, 0x5c, 0x61, 0x61, 0x5c, 0x5a, 0x62, 0x63, 0x63, 0x5b, 0x4c, 0x3e, 0x36, 0x38, 0x39, 0x67, 0x38, 0x3b, 0x39, 0x39, 0x45, 0x08, 0x0a, 0x0b, 0x0b, 0x0b, 0x0f, 0x0a, 0x10, 0x0b, 0x10, 0x0f, 0x10, 0x10, 0x0d, 0x10, 0x0a, 0x13, 0x48, 0x40, 0x39, 0x3a, 0x3a, 0x3c, 0x3a, 0x67, 0x79, 0x8a, 0x99, 0x90, 0x98, 0x94, 0xa8, 0xdc, 0xde, 0xe7, 0xe9, 0xe6, 0xe6, 0xe2, 0xe7, 0xe6, 0xe4, 0xfb, 0xef, 0xf0, 0xf0, 0xf0, 0xef, 0xe4, 0xe3, 0xe3, 0xe3, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 
-  0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xe5, 0xe3, 0xef, 0xef, 0xfd, 0xfc, 0xfb, 0xfc, 0xef, 0xfb, 0xfc, 0xf2, 0xfc, 0xee, 0xf2, 0xee, 0xed, 0xee, 0xed, 0xe5, 0xd8, 0x99, 0xa4, 0x9a, 0xa4, 0x9d, 0x7b, 0x3b, 0x3d, 0x3d, 0x3a, 0x3f, 0x40, 0x39, 0x00, 0x08, 0x0a, 0x0d, 0x0d, 0x10, 0x0f, 0x0f, 0x10, 0x10, 0x0d, 0x0d, 0x12, 0x0b, 0x0f, 0x10, 0x13, 0x03, 0x40, 0x39, 0x3c, 0x39, 0x38, 0x3e, 0x3a, 0x3e, 0x3c, 0x37, 0x37, 0x45, 0x38, 0x34, 0x05, 0x2c, 0x2c, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x5e, 0x56, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x5c, 0x61, 0x61, 0x5e, 0x5a, 0x26, 0x2c, 0x2a, 0x15, 0x3e, 0x34, 0x36, 0x40, 0x39, 0x3d, 0x38, 0x3a, 0x38, 0x38, 0x39, 0x39, 0x48, 0x08, 0x0a, 0x14, 0x0d, 0x10, 0x0a, 0x0f, 0x0a, 0x0d, 0x0d, 0x10, 0x0d, 0x11, 0x10, 0x10, 0x13, 0x08, 0x48, 0x3d, 0x3f, 0x3a, 0x3f, 0x38, 0x3a, 0x6e, 0x7b, 0x9b, 0x94, 0x9a, 0x9a, 0x8e, 0xc1, 0xe7, 0xe2, 0xe3, 0xed, 0xf3, 0xfc, 0xfb, 0x6c, 0xed, 0xfb, 0xfb, 0xf0, 0xed, 0xe4, 0xed, 0xe4, 0xee, 0xfc, 0xfc, 0xf0, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xe3, 0xe3, 0xe5, 0xee, 0xfc, 0xee, 0xf0, 0xee, 0xf0, 0xfb, 0xf2, 0xef, 0xee, 0xee, 0xf3, 0xfb, 0xee, 0xee, 0xed, 0xfb, 0xe5, 0xe2, 0xa8, 0x9c, 0x9a, 0x9a, 0xa8, 0x74, 0x3b, 0x39, 0x3d, 0x3a, 0x3f, 0x42, 0x3d, 0x48, 0x07, 0x0f, 0x0d, 0x0d, 0x10, 0x10, 0x0d, 0x11, 0x0d, 0x11, 0x11, 0x0d, 0x10, 0x0a, 0x0a, 0x13, 0x00, 0x40, 0x39, 0x40, 0x3c, 0x38, 0x38, 0x3e, 0x38, 0x37, 0x3e, 0x67, 0x67, 0x67, 0x38, 0x37, 0x05, 0x2e, 0x2d, 0x26, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x5c, 0x56, 0x56, 0x5c, 0x5c, 0x61, 0x61, 0x61, 0x5e, 0x5e, 0x26, 0x2c, 0x31, 0x28, 0x44, 0x37, 0x34, 0x43, 0x37, 0x39, 0x3b, 0x43, 0x39, 0x38, 0x38, 0x3c, 0x3d, 0x39, 0x42, 0x05, 0x0f, 0x0d, 0x11, 0x0b, 0x0f, 0x0a, 0x10, 0x11, 0x0d, 0x11, 0x0d, 0x11, 0x0d, 0x10, 0x13, 0x02, 0x40, 0x39, 0x67, 0x3f, 0x3a, 0x3a, 0x67, 0x6e, 0x7d, 0xa8, 0x95, 0x9a, 0x90, 0x9b, 0xdb, 0xe2, 0xe8, 0xe1, 0xfd, 0xfb, 0xfd, 0xfc, 0xfb, 0xfb, 0xf2, 0xed, 0xed, 0xf2, 0xe3, 0xe4, 0xe4, 0xee, 0xfc, 0xfd, 0xfb, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xe4, 0xfb, 0xee, 0xee, 0xe4, 0xe8, 0xc6, 0x8e, 0xa9, 0x9a, 0xab, 0x86, 0x6e, 0x3a, 0x3e, 0x3e, 0x67, 0x3a, 0x3d, 0x40, 0x00, 0x0e, 0x0f, 0x0b, 0x0b, 0x11, 0x11, 0x0d, 0x11, 0x11, 0x10, 0x10, 0x0a, 0x13, 0x13, 0x02, 0x42, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x3a, 0x3c, 0x3a, 0x3c, 0x39, 0x3d, 0x3d, 0x3a, 0x3a, 0x38, 0x38, 0x29, 0x32, 0x31, 0x2d, 0x26, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x26, 0x61, 0x61, 0x5e, 0x5e, 0x5e, 0x26, 0x2c, 0x31, 0x32, 0x2a, 0x3c, 0x35, 0x37, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x38, 0x3d, 0x3c, 0x3d, 0x3d, 0x39, 0x3c, 0x40, 0x01, 0x13, 0x07, 0x0a, 0x0d, 0x0b, 0x11, 0x0d, 0x11, 0x14, 0x14, 0x14, 0x11, 0x10, 0x13, 0x07, 0x48, 0x39, 0x3a, 0x3b, 0x39, 0x3c, 0x38, 0x3b, 0x6e, 0x86, 0xa0, 0x94, 0x90, 0x8c, 0xb8, 0xe4, 0xf3, 0xe1, 0xef, 0xed, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xe4, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xf2, 0xed, 0xef, 0xed, 0xef, 0xe4, 0xe6, 0xdb, 0x9b, 0xa9, 0x98, 0xab, 0x92, 0x74, 0x66, 0x38, 0x3f, 0x3a, 0x37, 0x42, 0x40, 0x40, 0x01, 0x0e, 0x13, 0x0b, 0x07, 0x12, 0x0f, 0x0b, 0x0a, 0x10, 0x0f, 0x0e, 0x13, 0x4e, 0x48, 0x39, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3d, 0x3a, 0x3a, 0x36, 0x4b, 0x2e, 0x32, 0x32, 0x31, 0x2d, 0x2c, 0x24, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x26, 0x26, 0x26, 0x2c, 0x31, 0x31, 0x31, 0x31, 0x4b, 0x34, 0x3a, 0x39, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x39, 0x48, 0x4e, 0x13, 0x0e, 0x0b, 0x10, 0x0b, 0x11, 0x0b, 0x11, 0x0b, 0x0b, 0x0a, 0x0f, 0x08, 0x00, 0x39, 0x39, 0x43, 0x67, 0x42, 0x39, 0x45, 0x34, 0x75, 0x9b, 0xa0, 0x95, 0x9f, 0x92, 0xd8, 0xf6, 0xf0, 0xef, 0xf2, 0xed, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xe4, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xe3, 0xe7, 0xc6, 0x8b, 0xa4, 0xa2, 0xab, 0x83, 0x6e, 0x34, 0x45, 0x38, 0x3f, 0x45, 0x42, 0x40, 0x40, 0x00, 0x05, 0x13, 0x13, 0x0e, 0x0f, 0x13, 0x0f, 0x13, 0x0e, 0x08, 0x00, 0x40, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x3c, 0x3a, 0x3d, 0x3c, 0x37, 0x25, 0x2e, 0x31, 0x31, 0x31, 0x2e, 0x31, 0x2d, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2d, 0x31, 0x31, 0x31, 0x31, 0x32, 0x25, 0x35, 0x3d, 0x36, 0x45, 0x3c, 0x38, 0x3d, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x40, 0x39, 0x48, 0x02, 0x13, 0x0e, 0x0f, 0x0f, 0x0f, 0x0a, 0x0a, 0x0e, 0x13, 0x13, 0x05, 0x48, 0x40, 0x39, 0x3d, 0x3f, 0x3a, 0x43, 0x3c, 0x66, 0x6e, 0x8a, 0xa8, 0x8c, 0x9f, 0x87, 0xc6, 0xe7, 0xed, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xed, 0xee, 0xed, 0xef, 0xef, 0xe3, 0xe6, 0xe2, 0xa5, 0xa0, 0x91, 0xa9, 0xa3, 0x75, 0x6e, 0x42, 0x3d, 0x3e, 0x38, 0x38, 0x3a, 0x3e, 0x3d, 0x42, 0x00, 0x01, 0x4e, 0x05, 0x4e, 0x02, 0x01, 0x00, 0x42, 0x39, 0x39, 0x3c, 0x38, 0x3d, 0x3c, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3c, 0x3c, 0x3c, 0x3a, 0x3a, 0x38, 0x36, 0x01, 0x2a, 0x32, 0x31, 0x2f, 0x30, 0x2e, 0x2f, 0x32, 0x31, 0x31, 0x31, 0x32, 0x2e, 0x2e, 0x31, 0x31, 0x32, 0x2d, 0x43, 0x40, 0x35, 0x45, 0x37, 0x3e, 0x3d, 0x3c, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3a, 0x3c, 0x39, 0x40, 0x48, 0x03, 0x05, 0x05, 0x0e, 0x08, 0x0e, 0x08, 0x02, 0x00, 0x42, 0x37, 0x3c, 0x3f, 0x3f, 0x38, 0x3f, 0x3c, 0x3a, 0x6e, 0x80, 0xa8, 0x9c, 0x95, 0x92, 0xa5, 0xde, 0xe3, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xfb, 0xee, 0xee, 0xfb, 0xe3, 0xe1, 0xeb, 0xd3, 0x92, 0xa2, 0x9a, 0xa9, 0x85, 0x73, 0x3b, 0x40, 0x3c, 0x3a, 0x3f, 0x3a, 0x3f, 0x3d, 0x39, 0x39, 0x40, 0x40, 0x42, 0x42, 0x42, 0x3c, 0x39, 0x40, 0x42, 0x38, 0x3a, 0x3a, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x38, 0x3e, 0x38, 0x3c, 0x39, 0x3d, 0x40, 0x1a, 0x2d, 0x32, 0x2f, 0x2e, 0x2f, 0x31, 0x2e, 0x31, 0x31, 0x2e, 0x31, 0x2f, 0x31, 0x31, 0x32, 0x2e, 0x15, 0x40, 0x40, 0x3a, 0x3a, 0x3f, 0x38, 0x3c, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3a, 0x3a, 0x3d, 0x3d, 0x42, 0x40, 0x42, 0x42, 0x48, 0x48, 0x00, 0x48, 0x48, 0x40, 0x37, 0x3c, 0x3a, 0x3f, 0x3f, 0x3f, 0x3f, 0x42, 0x3d, 0x67, 0x7b, 0x9d, 0x99, 0x90, 0x9c, 0x8b, 0xcc, 0xea, 0xe5, 0xef, 0xed, 0xed, 0xfc, 0xe1, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xf2, 0xed, 0xe8, 0xc1, 0x87, 0x9a, 0x9a, 0xa8, 0x83, 0x35, 0x40, 0x42, 0x39, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3c, 0x40, 0x3d, 0x40, 0x3c, 0x40, 0x39, 0x3c, 0x3d, 0x3a, 0x3a, 0x67, 0x67, 0x3f, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3c, 0x3e, 0x38, 0x3f, 0x38, 0x3a, 0x40, 0x36, 0x00, 0x22, 0x2d, 0x32, 0x32, 0x31, 0x2e, 0x2f, 0x2f, 0x2f, 0x2e, 0x2f, 0x31, 0x31, 0x32, 0x2d, 0x25, 0x44, 0x40, 0x3d, 0x39, 0x3a, 0x3a, 0x3a, 0x39, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3a, 0x67, 0x3f, 0x39, 0x3c, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x40, 0x3d, 0x40, 0x3d, 0x3a, 0x3a, 0x3f, 0x3f, 0x3c, 0x3c, 0x3d, 0x67, 0x73, 0x8f, 0xa3, 0x9f, 0x9a, 0x87, 0xbb, 0xe9, 0xe1, 0xfc, 0xee, 0xee, 0xef, 0xf2, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 
-  0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xfb, 0xfc, 0xf0, 0xe8, 0xe0, 0xb1, 0x8b, 0xa2, 0x8b, 0xaf, 0x75, 0x35, 0x3b, 0x43, 0x36, 0x3f, 0x3f, 0x39, 0x3c, 0x39, 0x40, 0x3d, 0x3d, 0x39, 0x38, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x67, 0x3a, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x3c, 0x3c, 0x38, 0x3a, 0x3c, 0x39, 0x42, 0x36, 0x09, 0x22, 0x2a, 0x31, 0x32, 0x32, 0x2f, 0x2f, 0x2f, 0x2f, 0x32, 0x32, 0x2e, 0x2c, 0x28, 0x13, 0x42, 0x3c, 0x3c, 0x3d, 0x3a, 0x3b, 0x67, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x37, 0x3a, 0x3d, 0x3d, 0x3c, 0x3c, 0x3c, 0x40, 0x40, 0x40, 0x3d, 0x3c, 0x3f, 0x38, 0x38, 0x45, 0x37, 0x43, 0x3d, 0x73, 0x77, 0xa8, 0x99, 0x95, 0x8e, 0xa5, 0xde, 0xe5, 0xf3, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xfc, 0xfb, 0xfb, 0xf2, 0xe9, 0xe0, 0xaa, 0x8b, 0xa8, 0x92, 0x9d, 0x76, 0x6e, 0x66, 0x41, 0x39, 0x3c, 0x40, 0x3c, 0x40, 0x39, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3c, 0x3c, 0x3d, 0x3a, 0x38, 0x3f, 0x37, 0x42, 0x37, 0x08, 0x21, 0x24, 0x28, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x2d, 0x2a, 0x28, 0x24, 0x16, 0x44, 0x38, 0x3e, 0x3c, 0x39, 0x3d, 0x39, 0x3b, 0x39, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x42, 0x3f, 0x39, 0x41, 0x3b, 0x6e, 0x86, 0xa5, 0x92, 0xa8, 0x8b, 0x9d, 0xdd, 0xe8, 0x6c, 0xfb, 0xfb, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 
-  0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xee, 0xfc, 0xfb, 0x6c, 0xe6, 0xe3, 0xe9, 0xdb, 0x97, 0x92, 0x9f, 0x99, 0x9d, 0x80, 0x73, 0x66, 0x3d, 0x40, 0x40, 0x40, 0x3d, 0x3a, 0x39, 0x3d, 0x3d, 0x3d, 0x3a, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x3c, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x40, 0x3c, 0x3d, 0x38, 0x3a, 0x38, 0x45, 0x39, 0x42, 0x3e, 0x08, 0x21, 0x24, 0x1d, 0x24, 0x24, 0x24, 0x1f, 0x24, 0x24, 0x24, 0x16, 0x42, 0x3c, 0x3f, 0x38, 0x38, 0x3c, 0x40, 0x3d, 0x3a, 0x3d, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x38, 0x3a, 0x38, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3f, 0x3a, 0x3a, 0x3c, 0x3c, 0x42, 0x3d, 0x3b, 0x66, 0x6e, 0x77, 0xa5, 0x92, 0xa0, 0x88, 0x9b, 0xd7, 0xf6, 0x6c, 0xfd, 0xed, 0xf2, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xfb, 0xfc, 0xe6, 0xe3, 0xe3, 0xed, 0xf5, 0xdb, 0x8a, 0x88, 0x96, 0x99, 0x9b, 0x77, 0x73, 0x39, 0x40, 0x40, 0x40, 0x39, 0x3a, 0x39, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3c, 0x39, 0x3c, 0x3a, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x3c, 0x40, 0x39, 0x3a, 0x3a, 0x38, 0x3f, 0x38, 0x3c, 0x42, 0x3e, 0x01, 0x16, 0x24, 0x24, 0x24, 0x5e, 0x26, 0x24, 0x1c, 0x4e, 0x40, 0x40, 0x3f, 0x67, 0x67, 0x3a, 0x3c, 0x40, 0x3c, 0x40, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x39, 0x3c, 0x3a, 0x3c, 0x3a, 0x3c, 0x3c, 0x40, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3b, 0x3b, 0x3a, 0x3d, 0x40, 0x3c, 0x39, 0x66, 0x73, 0x86, 0x9d, 0x99, 0xa2, 0x8e, 0x92, 0xd7, 0xea, 0x30, 0x30, 0xfc, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xee, 0xe5, 0x6c, 0xe3, 0xe5, 0xf4, 0xed, 0xeb, 0xd7, 0xa5, 0x8b, 0x90, 0x99, 0x9d, 0x86, 0x6f, 0x35, 0x39, 0x39, 0x3c, 0x3f, 0x3f, 0x67, 0x37, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3a, 0x39, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x38, 0x45, 0x3c, 0x3c, 0x38, 0x3c, 0x42, 0x01, 0x03, 0x0f, 0x0a, 0x05, 0x00, 0x48, 0x40, 0x40, 0x39, 0x3f, 0x3a, 0x3a, 0x3d, 0x3d, 0x3c, 0x3d, 0x38, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 0x39, 0x40, 0x39, 0x40, 0x39, 0x40, 0x3d, 0x39, 0x3a, 0x3a, 0x67, 0x3a, 0x3f, 0x3a, 0x3f, 0x3a, 0x3f, 0x3c, 0x3c, 0x40, 0x3d, 0x35, 0x74, 0x86, 0xa8, 0x8b, 0xa3, 0x8a, 0xa5, 0xd7, 0xea, 0xe4, 0xfc, 0xfc, 0xfc, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xe4, 0xe4, 0xef, 0xfb, 0xef, 0xed, 0xe3, 0xea, 0xdb, 0x8b, 0x84, 0x8e, 0x92, 0xa5, 0x89, 0x74, 0x35, 0x3b, 0x40, 0x38, 0x38, 0x67, 0x3f, 0x3a, 0x38, 0x37, 0x3c, 0x3d, 0x3a, 0x3a, 0x3a, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x40, 0x39, 0x3c, 0x37, 0x38, 0x3a, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x40, 0x3c, 0x40, 0x39, 0x40, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3b, 0x3a, 0x67, 0x3f, 0x3a, 0x3a, 0x38, 0x3c, 0x3c, 0x38, 0x3e, 0x3d, 0x67, 0x66, 0x75, 0x8f, 0x9b, 0x8b, 0xa2, 0x8a, 0x97, 0xdd, 0xea, 0xe4, 0xe4, 0xfb, 0xfc, 0xee, 0xee, 0xfc, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xf0, 0xe3, 0xe4, 0xed, 0xf0, 0xf0, 0xfb, 0xf2, 0xe3, 0xe1, 0xe9, 0xe0, 0xb4, 0x87, 0x8b, 0x9b, 0x9b, 0x9d, 0x80, 0x6f, 0x34, 0x3b, 0x3f, 0x3f, 0x3c, 0x39, 0x3c, 0x40, 0x40, 0x3d, 0x39, 0x3d, 0x3b, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x40, 0x40, 0x39, 0x40, 0x3d, 0x40, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3c, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x39, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3c, 0x40, 0x3c, 0x39, 0x40, 0x42, 0x42, 0x42, 0x42, 0x67, 0x6e, 0x74, 0x86, 0x9d, 0xa3, 0x9b, 0x8b, 0x87, 0xb8, 0xe0, 0xe9, 0xe3, 0xe4, 0xf0, 0xf0, 0xfc, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xe4, 0xe3, 0xef, 0xef, 0xfb, 0xf0, 0xed, 0xe4, 0xe6, 0xe3, 0xe9, 0xde, 0xc1, 0x97, 0x87, 0x8e, 0x92, 0x92, 0x86, 0x75, 0x66, 0x35, 0x3c, 0x38, 0x3c, 0x39, 0x40, 0x3d, 0x40, 0x39, 0x3d, 0x39, 0x43, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x38, 0x39, 0x38, 0x3d, 0x3c, 0x39, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x3d, 0x38, 0x3a, 0x3a, 0x67, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x39, 0x35, 0x41, 0x80, 0x8b, 0x90, 0x8b, 0x90, 0x87, 0x8a, 0xc1, 0xe2, 0xe9, 0xe6, 0xe3, 0xf0, 0xef, 0xf0, 0xfb, 0xe5, 0x6c, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xe4, 0xe4, 0xe3, 0xe4, 0xfb, 0xf0, 0xfd, 0xf3, 0xfb, 0xed, 0xe3, 0xef, 0xf2, 0xeb, 0xdb, 0xb1, 0x87, 0x8b, 0x92, 0x9d, 0x97, 0x86, 0x74, 0x67, 0x34, 0x3b, 0x3b, 0x39, 0x39, 0x40, 0x39, 0x40, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x39, 0x3b, 0x3d, 0x3b, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3f, 0x3d, 0x38, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3c, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x67, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x3a, 0x38, 0x38, 0x3a, 0x38, 0x3c, 0x3c, 0x3c, 0x40, 0x40, 0x40, 0x3d, 0x35, 0x3b, 0x41, 0x70, 0x8d, 0x8f, 0x90, 0x8b, 0x8c, 0x87, 0xaf, 0xdd, 0xeb, 0xe6, 0xe6, 0xe1, 0xf3, 0xed, 0xfb, 0xfc, 0xee, 0xee, 0xe5, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe3, 0xee, 0xee, 0xfc, 0xfc, 0xfb, 0xfb, 0xf2, 0xee, 0xf0, 0xfb, 0xe4, 0xe8, 0xe2, 0xc7, 0x9d, 0x8d, 0x8d, 0x92, 0x97, 0x97, 0x77, 0x75, 0x6e, 0x66, 0x66, 0x3b, 0x3b, 0x39, 0x3c, 0x40, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x38, 0x3a, 0x3f, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3c, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x38, 0x3d, 0x3d, 0x38, 0x3c, 0x3c, 0x3c, 0x38, 0x3a, 0x3c, 0x40, 0x40, 0x39, 0x35, 0x66, 0x6f, 0x75, 0x89, 0x8d, 0x97, 0x92, 0x8b, 0x8b, 0x92, 0xc6, 0xe2, 0xe8, 0xed, 0xf2, 0xef, 0xef, 0xf0, 0xf0, 0xfc, 0xfb, 0xef, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xe4, 0xe4, 0xee, 0xf0, 0xfb, 0xf0, 0xfc, 0xfb, 0xf0, 0xee, 0xf0, 0xfb, 0xf1, 0xf1, 0xf7, 0xe1, 0xbc, 0xa6, 0x8a, 0x8b, 0x8d, 0x9d, 0x8d, 0x86, 0x80, 0x73, 0x66, 0x67, 0x3a, 0x38, 0x38, 0x38, 0x39, 0x3d, 0x42, 0x3c, 0x39, 0x39, 0x40, 0x3c, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x37, 0x3a, 0x37, 0x3a, 0x38, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x39, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x42, 0x3c, 0x3d, 0x38, 0x3f, 0x3a, 0x37, 0x36, 0x66, 0x41, 0x74, 0x77, 0x8d, 0x9d, 0x8b, 0x8b, 0x8b, 0x85, 0x97, 0xb8, 0xe0, 0xf8, 0xf3, 0xf1, 0xf4, 0xfb, 0xef, 0xf0, 0xee, 0xfd, 0xfc, 0xf0, 0xee, 0xee, 0xe5, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xef, 0xf0, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xef, 0xf0, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xef, 0xf0, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xef, 0xf0, 0xe4, 0xf0, 0xef, 0xef, 0xef, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xe3, 0xe4, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xf0, 0xfd, 0xfd, 0xfd, 0xf1, 0xf6, 0xe0, 0xbb, 0xa5, 0x8a, 0x87, 0x8a, 0x9d, 0x89, 0x8f, 0x77, 0x68, 0x6f, 0x3a, 0x67, 0x3a, 0x67, 0x38, 0x67, 0x39, 0x3d, 0x3c, 0x40, 0x3c, 0x40, 0x3c, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x38, 0x3a, 0x3a, 0x37, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x3a, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3c, 0x40, 0x3d, 0x3d, 0x42, 0x3d, 0x3d, 0x3d, 0x39, 0x3b, 0x67, 0x41, 0x75, 0x70, 0x89, 0x8f, 0x8d, 0x8b, 0x8b, 0x8b, 0x87, 0x8d, 0xb8, 0xe0, 0xfe, 0xfe, 0xfd, 0xfb, 0xfd, 0xed, 0xf0, 0xfc, 0xfb, 0xf0, 0xef, 0xfc, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 
-  0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xfd, 0xfd, 0xfd, 0xfb, 0xe4, 0xf2, 0xea, 0xe0, 0xc6, 0xaa, 0x85, 0x86, 0x8a, 0x8f, 0x8f, 0x8f, 0x71, 0x77, 0x75, 0x6f, 0x67, 0x66, 0x67, 0x66, 0x37, 0x37, 0x39, 0x3c, 0x3c, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x39, 0x39, 0x38, 0x3d, 0x38, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x38, 0x38, 0x39, 0x3a, 0x39, 0x67, 0x35, 0x67, 0x3b, 0x41, 0x68, 0x70, 0x71, 0x8f, 0x8f, 0x8d, 0x8a, 0x8a, 0x85, 0x85, 0x9d, 0xbb, 0xe0, 0xeb, 0xf3, 0xf1, 0xfd, 0xfb, 0xfd, 0xf3, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xee, 0x6c, 0xe4, 0xf0, 0xef, 0xfb, 0xef, 0xef, 0xee, 0x6c, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xee, 0xee, 0xee, 0xf0, 0xfb, 0xef, 0xef, 0xee, 0x6c, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xf0, 0xfb, 0xef, 0xef, 0xee, 0x6c, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xf0, 0xfb, 0xef, 0xef, 0xee, 0x6c, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xee, 0x6c, 0xe4, 0xf0, 0xef, 0xfb, 0xef, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xef, 0xe4, 0xf0, 0xfb, 0xe4, 0xe3, 0xe3, 0xe3, 0xe5, 0xe4, 0xf3, 0xf3, 0xf5, 0xe2, 0xd3, 0xb6, 0x8f, 0x86, 0x8a, 0x89, 0x8d, 0x97, 0x93, 0x8f, 0x89, 0x76, 0x75, 0x46, 0x73, 0x3b, 0x3b, 0x37, 0x36, 0x37, 0x39, 0x38, 0x39, 0x38, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x3c, 0x3d, 0x3c, 0x39, 0x3c, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x38, 0x3d, 0x39, 0x39, 0x38, 0x3d, 0x38, 0x36, 0x36, 0x67, 0x3b, 0x46, 0x68, 0x70, 0x78, 0x71, 0x93, 0x8f, 0x89, 0x86, 0x8a, 0x85, 0x85, 0x89, 0xb3, 0xd3, 0xe6, 0xeb, 0xf4, 0xe1, 0xef, 0xee, 0xed, 0xee, 0xe5, 0xed, 0xe1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0x6c, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0x6c, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xe5, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xee, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe3, 0xef, 0xfb, 0xf0, 0xe3, 0xe3, 0xe3, 0xe2, 0xe3, 0xee, 0xfb, 0xfd, 0xfb, 0xf3, 0xf5, 0xe6, 0xdb, 0xb8, 0xa6, 0x86, 0x85, 0x89, 0x8a, 0x8f, 0x8f, 0x93, 0x8f, 0x93, 0x71, 0x04, 0x70, 0x49, 0x46, 0x3f, 0x37, 0x37, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x38, 0x39, 0x38, 0x39, 0x37, 0x39, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x67, 0x3f, 0x46, 0x49, 0x4d, 0x04, 0x71, 0x71, 0x71, 0x71, 0x89, 0x71, 0x89, 0x89, 0x86, 0x7f, 0x89, 0xb4, 0xdb, 0xe6, 0xea, 0xf1, 0xf1, 0xfb, 0xf0, 0xf2, 0xe3, 0xe6, 0xe3, 0xe3, 0xe6, 0x6c, 0xe5, 0xee, 0xee, 0xe5, 0xe5, 0xe5, 0xe4, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xf0, 0xef, 0xf0, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xfc, 0xef, 0xf0, 0xf0, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xf0, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xe4, 0xe4, 0xe4, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xee, 0xe5, 0xee, 0xe5, 0xee, 0xef, 0xef, 0xfb, 0xef, 0xed, 0xe4, 0xe5, 0xeb, 0xea, 0xdb, 0xc4, 0xdf, 0x93, 0x86, 0x89, 0x8f, 0x93, 0x89, 0x93, 0x71, 0x93, 0xfa, 0xa6, 0x69, 0x69, 0x78, 0x50, 0x4d, 0x4d, 0x70, 0x49, 0x49, 0x68, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x41, 0x41, 0x46, 0x41, 0x46, 0x46, 0x46, 0x46, 0x68, 0x68, 0x49, 0x49, 0x70, 0x4d, 0x04, 0x71, 0x69, 0x69, 0x69, 0x69, 0x71, 0x71, 0x71, 0x71, 0x89, 0x71, 0x89, 0x77, 0x77, 0x8f, 0x5d, 0xd3, 0xf5, 0xeb, 0xf5, 0xe3, 0xe4, 0xe4, 0xfb, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xe4, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xe4, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xfb, 0xef, 0xed, 0xe4, 0xee, 0xed, 0xe8, 0xf5, 0xe1, 0xe0, 0xcf, 0xaa, 0x97, 0x86, 0x89, 0x89, 0x89, 0x8f, 0x8f, 0x71, 0x71, 0x71, 0x71, 0xa6, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x71, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x71, 0x69, 0x69, 0x71, 0x71, 0x71, 0x71, 0x71, 0x86, 0x71, 0x86, 0x86, 0x86, 0x86, 0x86, 0x89, 0xb3, 0xd3, 0xdd, 0xe9, 0xe8, 0xe4, 0xf2, 0xe4, 0xe1, 0xe3, 0xe3, 0xef, 0xed, 0xef, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xe4, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xfc, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xfb, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xef, 0xef, 0xef, 0xe4, 0xed, 0xef, 0xfb, 0xed, 0xfc, 0xe3, 0xe0, 0xe6, 0xe2, 0xd9, 0xca, 0xd1, 0xca, 0xb4, 0xb4, 0xa8, 0x97, 0x8a, 0x86, 0x89, 0x89, 0x71, 0x89, 0x93, 0x89, 0x93, 0x71, 0x93, 0x71, 0x71, 0x71, 0x71, 0x71, 0x69, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x89, 0x78, 0x86, 0x86, 0x83, 0x86, 0x89, 0x8d, 0x9d, 0xaf, 0xb4, 0xbf, 0xd4, 0xd6, 0xde, 0xe7, 0xea, 0xe1, 0xe3, 0xfb, 0xed, 0xed, 0xef, 0xe4, 0xe4, 0xfb, 0xe4, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xe4, 0xee, 0xf0, 0xee, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xe4, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xe4, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xe4, 0xee, 0xf0, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6c, 0xe4, 0xee, 0xf0, 0xee, 0xf0, 
-  0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe3, 0xe3, 0xee, 0xfb, 0xfd, 0xfb, 0xef, 0xe1, 0xe7, 0xe2, 0xd6, 0xcb, 0xcb, 0xc5, 0xd2, 0xd2, 0xd1, 0xcd, 0xca, 0xc3, 0xbf, 0xb4, 0xaf, 0xaa, 0xa5, 0x8d, 0x8f, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x71, 0x71, 0x89, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x8f, 0x71, 0x89, 0x89, 0x89, 0x89, 0x8f, 0x8f, 0xaa, 0xaa, 0xb4, 0xb7, 0xbb, 0xc5, 0xd0, 0xd2, 0xd2, 0xd2, 0xcd, 0xd2, 0xcd, 0xc5, 0xd9, 0xde, 0xe2, 0xf2, 0xfb, 0xfb, 0xf0, 0xf2, 0xed, 0xe4, 0xed, 0xee, 0xed, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xf0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xf0, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xef, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xf0, 0xf0, 
-  0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xe3, 0xe3, 0x6c, 0xfb, 0xfb, 0xfd, 0xed, 0xe6, 0xe2, 0xd6, 0xc3, 0xc8, 0xc8, 0xc9, 0xc8, 0xcb, 0xcb, 0xcb, 0xcd, 0xcd, 0xcd, 0xd2, 0xd1, 0xd1, 0xd0, 0xca, 0xc3, 0xbf, 0xbb, 0xb8, 0xb4, 0xb3, 0xb3, 0xae, 0xaf, 0xae, 0xae, 0xaa, 0xaa, 0xaa, 0xae, 0xaa, 0xaf, 0xaf, 0xb3, 0xb4, 0xb8, 0xbb, 0xbf, 0xc6, 0xca, 0xd0, 0xd1, 0xd2, 0xd1, 0xcd, 0xcd, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcd, 0xc5, 0xd6, 0xe9, 0xe3, 0xed, 0xee, 0xfb, 0xed, 0xe4, 0xe4, 0xee, 0xfb, 0xee, 0xfb, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xe5, 0xf0, 0xef, 0xfb, 0xef, 0xf0, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xef, 0xf0, 0xef, 0xfb, 0xf0, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xe5, 0xf0, 0xef, 0xfb, 0xf0, 0xee, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xef, 0xf0, 0xef, 0xfb, 0xf0, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0x6c, 0xee, 0xe5, 0xf0, 0xef, 0xfb, 0xef, 
-  0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xed, 0xe3, 0xed, 0xfc, 0xfd, 0xef, 0xe3, 0xe7, 0xd4, 0xc3, 0xcb, 0xc9, 0xc9, 0xc9, 0xc8, 0xcb, 0xc8, 0xcb, 0xc8, 0xcb, 0xcb, 0xc5, 0xcb, 0xca, 0xcb, 0xca, 0xd1, 0xca, 0xd1, 0xca, 0xd1, 0xd1, 0xd1, 0xd4, 0xd1, 0xd5, 0xd1, 0xd1, 0xd4, 0xd5, 0xd1, 0xd1, 0xd1, 0xd2, 0xca, 0xcd, 0xcd, 0xca, 0xcb, 0xc5, 0xcb, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc9, 0xc9, 0xc9, 0xcd, 0xca, 0xd7, 0xe7, 0xe3, 0xf2, 0xef, 0xf0, 0xed, 0xed, 0xee, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xe4, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xf0, 0xf0, 0xef, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 
-  0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xed, 0xee, 0xee, 0xe4, 0xed, 0xed, 0xfc, 0xe4, 0xe1, 0xe9, 0xd8, 0xc0, 0xc5, 0xc8, 0xc8, 0xc9, 0xc8, 0xc9, 0xc8, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xc8, 0xc5, 0xc8, 0xc5, 0xc5, 0xcd, 0xca, 0xca, 0xc5, 0xc5, 0xca, 0xcd, 0xd1, 0xd5, 0xd5, 0xd2, 0xd1, 0xcd, 0xd1, 0xcb, 0xcb, 0xc5, 0xc8, 0xc8, 0xc2, 0xcd, 0xc9, 0xc8, 0xc2, 0xc9, 0xcb, 0xcb, 0xcb, 0xcb, 0xc8, 0xcb, 0xcb, 0xc9, 0xcb, 0xc9, 0xc9, 0xc9, 0xcb, 0xc5, 0xd1, 0xd8, 0xe9, 0xe1, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xfc, 0xf0, 0xf0, 0xef, 0xee, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xfc, 0xf0, 0xf0, 0xef, 0xee, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xfc, 0xf0, 0xf0, 0xef, 0xef, 0xfc, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xfc, 0xf0, 0xf0, 0xef, 0xee, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 
-  0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xed, 0xee, 0xe1, 0xe1, 0xe9, 0xdc, 0xbb, 0xcd, 0xc8, 0xc9, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xcb, 0xc8, 0xcb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xcb, 0xcb, 0xc5, 0xc5, 0xcd, 0xd2, 0xcd, 0xc5, 0xc0, 0xb9, 0xb7, 0xb7, 0xb7, 0xb9, 0xbf, 0xc0, 0xcb, 0xcd, 0xc8, 0xcb, 0xc8, 0xcb, 0xc2, 0xc8, 0xc9, 0xc9, 0xc9, 0xc8, 0xcb, 0xc8, 0xcb, 0xc9, 0xcb, 0xc9, 0xcb, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xcd, 0xc5, 0xca, 0xdd, 0xe7, 0xe6, 0xed, 0xfd, 0xfb, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xe4, 0xef, 0xef, 0xf0, 0xf0, 0xe4, 0xee, 0xee, 0xf0, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xe4, 0xe4, 0xf0, 0xf0, 0xe4, 0xee, 0xee, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xe4, 0xe4, 0xf0, 0xf0, 0xe4, 0xee, 0xef, 0xee, 0xf0, 0xe4, 0xee, 0xef, 0xe4, 0xe4, 0xe4, 0xef, 0xef, 0xf0, 0xe4, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xe4, 0xe4, 
-  0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xfb, 0xfb, 0xf2, 0xe3, 0xe2, 0xde, 0xc3, 0xcd, 0xc5, 0xc9, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xcb, 0xc8, 0xcb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xcb, 0xc5, 0xc5, 0xb7, 0xad, 0xa7, 0x99, 0x99, 0x94, 0x99, 0x8e, 0x8c, 0x8e, 0x94, 0xa1, 0xa7, 0xb0, 0xb9, 0xc5, 0xcb, 0xc8, 0xcd, 0xc8, 0xc2, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xcd, 0xc9, 0xc5, 0xd1, 0xe2, 0xe7, 0xed, 0xfb, 0xfb, 0xe4, 0xef, 0xe4, 0xee, 0xe4, 0xfb, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xe4, 0xef, 0xee, 0xe4, 0xfb, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xe4, 0xef, 0xef, 
-  0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xfb, 0xef, 0xfb, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xfb, 0xf1, 0xed, 0xe9, 0xe2, 0xca, 0xc3, 0xcb, 0xc2, 0xc9, 0xc9, 0xc9, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc5, 0xc8, 0xc8, 0xb9, 0xab, 0x8e, 0x8c, 0x8e, 0x99, 0x99, 0x99, 0x99, 0x8e, 0x99, 0xa0, 0x99, 0x99, 0x92, 0x8e, 0x8e, 0x88, 0x8e, 0xad, 0xb7, 0xc0, 0xd2, 0xc8, 0xc5, 0xcb, 0xc8, 0xc8, 0xc9, 0xc8, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xcb, 0xc5, 0xd4, 0xe2, 0xf2, 0x30, 0xfc, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xed, 0xe4, 0xed, 0xe4, 0xe3, 0xe4, 0xe3, 0xed, 0xe4, 0xfd, 0xfd, 0xe3, 0xe7, 0xd6, 0xc3, 0xc9, 0xc5, 0xc9, 0xc9, 0xc9, 0xc2, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xcb, 0xc8, 0xc8, 0xc9, 0xc2, 0xc9, 0xcb, 0xb7, 0xab, 0x92, 0x8e, 0x99, 0x9b, 0x99, 0x8e, 0x8e, 0x94, 0x92, 0x99, 0x92, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x99, 0x92, 0x8e, 0xa8, 0xb5, 0xc5, 0xcd, 0xc2, 0xcb, 0xc9, 0xc8, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xc3, 0xd9, 0xe6, 0xed, 0xe5, 0xe4, 0xee, 0xf0, 0xfd, 0xe4, 0xe4, 0xe3, 0xee, 0xee, 0xfc, 0xfb, 0xe4, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xed, 0xee, 0xed, 0xe5, 0xed, 0xe4, 0xe4, 0xe3, 0xef, 0xe3, 0xfd, 0xfb, 0xe7, 0xdd, 0xc5, 0xc2, 0xc8, 0xc8, 0xc9, 0xc2, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xcb, 0xc8, 0xc8, 0xcb, 0xc8, 0xc8, 0xc9, 0xcd, 0xc0, 0xb0, 0x99, 0x8b, 0xa3, 0x92, 0x9b, 0x92, 0x99, 0x99, 0x9c, 0x8e, 0x94, 0x8e, 0x8e, 0x99, 0x8e, 0x99, 0x94, 0x9c, 0x94, 0x95, 0x92, 0x99, 0x8b, 0x8c, 0x8e, 0xa9, 0xc0, 0xc9, 0xcb, 0xc2, 0xcb, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc0, 0xd1, 0xe0, 0xe6, 0xe3, 0xed, 0xf0, 0xfd, 0xfd, 0xf0, 0xee, 0xe3, 0xee, 0xee, 0xfd, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xed, 0xe5, 0xed, 0xe5, 0xed, 0xe4, 0xed, 0xef, 0xed, 0xf0, 0xf2, 0xe7, 0xd1, 0xc0, 0xcb, 0xc8, 0xc9, 0xc8, 0xc9, 0xc9, 0xc2, 0xc9, 0xc8, 0xc9, 0xc8, 0xc8, 0xc8, 0xc2, 0xcb, 0xc8, 0xc8, 0xc0, 0xab, 0x88, 0x8c, 0x99, 0x94, 0x94, 0x99, 0x94, 0x99, 0x8e, 0x8e, 0x99, 0x9b, 0xa0, 0x92, 0x92, 0x99, 0x92, 0x94, 0x8e, 0x90, 0x94, 0x95, 0x99, 0x99, 0x8e, 0x99, 0x8e, 0x8c, 0xb7, 0xcd, 0xcb, 0xc8, 0xc9, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xcb, 0xc5, 0xd4, 0xe2, 0xe3, 0xe3, 0xfc, 0xfd, 0xfd, 0xf0, 0xef, 0xe3, 0xe5, 0xfb, 0xfc, 0xf0, 0xe4, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 
-  0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xe5, 0xed, 0xee, 0xee, 0xee, 0xef, 0xfb, 0xef, 0xef, 0xfb, 0xed, 0xe6, 0xdd, 0xbf, 0xc0, 0xc9, 0xc2, 0xc9, 0xc2, 0xc9, 0xc2, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xc9, 0xc8, 0xc8, 0xcb, 0xc0, 0xa8, 0x88, 0x9c, 0x9f, 0x90, 0x95, 0x94, 0x94, 0x94, 0x92, 0x8e, 0x9b, 0x92, 0x92, 0x92, 0x92, 0x9b, 0x9b, 0x9b, 0x92, 0x99, 0x99, 0x94, 0x94, 0x94, 0x9c, 0x99, 0x8c, 0x92, 0x8b, 0x8a, 0xb5, 0xcb, 0xc8, 0xc9, 0xc9, 0xc9, 0xc2, 0xc9, 0xc9, 0xc9, 0xc9, 0xc8, 0xc9, 0xc8, 0xc9, 0xc2, 0xc9, 0xc9, 0xc5, 0xc3, 0xdc, 0xe7, 0xe5, 0xef, 0xfd, 0xfd, 0xfb, 0xef, 0xe4, 0xe4, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xe3, 0x6c, 0xe4, 0xfb, 0xee, 0xfb, 0xef, 0xfb, 0xfb, 0xf0, 0xe4, 0xe2, 0xc3, 0xc3, 0xc8, 0xc8, 0xc9, 0xc9, 0xc8, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xbd, 0xa7, 0x8b, 0x99, 0x94, 0x8c, 0x9c, 0x95, 0x94, 0x92, 0x9b, 0x9b, 0xa5, 0x97, 0x8f, 0x89, 0x8f, 0x89, 0x89, 0x89, 0x8d, 0x97, 0x9d, 0x92, 0x9b, 0x92, 0x8e, 0x8e, 0x8e, 0xa3, 0x92, 0x92, 0x9b, 0x88, 0xb0, 0xc2, 0xc0, 0xbe, 0xbe, 0xc2, 0xbe, 0xc2, 0xc2, 0xc2, 0xc9, 0xc2, 0xc9, 0xc2, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc3, 0xde, 0xe6, 0xe4, 0xfb, 0xfd, 0xfd, 0xf0, 0xe4, 0xe4, 0xef, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 
-  0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xe3, 0xee, 0xef, 0xee, 0xfb, 0xfb, 0xfb, 0xf0, 0xf0, 0xfb, 0xe9, 0xd7, 0xbf, 0xc2, 0xc9, 0xc2, 0xc2, 0xbd, 0xbe, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xbe, 0xbe, 0xbd, 0xbd, 0xc2, 0xad, 0x8c, 0x99, 0x9c, 0x8c, 0x95, 0x94, 0x8e, 0x9b, 0x9d, 0x8f, 0x86, 0x76, 0x75, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73, 0x6f, 0x6f, 0x75, 0x80, 0x89, 0x9d, 0x9b, 0x9b, 0x8e, 0x8e, 0xa0, 0x8b, 0x92, 0x99, 0x9c, 0xb7, 0xbd, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xbd, 0xc2, 0xbe, 0xc2, 0xbe, 0xc2, 0xc8, 0xc0, 0xd7, 0xe2, 0xe3, 0xf0, 0xfd, 0xfd, 0xf0, 0xef, 0xe4, 0xf0, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xe3, 0x6c, 0xed, 0xfc, 0xfb, 0xfb, 0xf0, 0xef, 0xef, 0xe4, 0xe2, 0xbb, 0xc0, 0xc0, 0xba, 0xba, 0xba, 0xbd, 0xbd, 0xbe, 0xbd, 0xba, 0xbe, 0xba, 0xbe, 0xba, 0xba, 0xbe, 0xc2, 0xb5, 0x91, 0x9c, 0x91, 0x8e, 0x91, 0x8e, 0x9b, 0x9d, 0x86, 0x76, 0x41, 0x66, 0x34, 0x36, 0x36, 0x36, 0x37, 0x35, 0x39, 0x35, 0x67, 0x66, 0x34, 0x34, 0x6e, 0x6f, 0x83, 0x8f, 0xa5, 0x92, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0xa9, 0xbd, 0xbd, 0xba, 0xba, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0xc0, 0xbb, 0xdc, 0xe7, 0xe3, 0xf1, 0xfb, 0xfb, 0xf0, 0xe4, 0xf0, 0xf0, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 
-  0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xe3, 0xe3, 0xe5, 0xed, 0xf0, 0xfb, 0xfb, 0xf0, 0xe1, 0xe3, 0xf2, 0xd6, 0xb1, 0xb9, 0xba, 0xba, 0xbe, 0xba, 0xbd, 0xbe, 0xba, 0xbe, 0xbe, 0xbd, 0xba, 0xbe, 0xbe, 0xbe, 0xbd, 0xc2, 0xab, 0x94, 0x8c, 0x9c, 0x95, 0x92, 0x9b, 0x89, 0x75, 0x6f, 0x34, 0x37, 0x38, 0x38, 0x39, 0x3c, 0x39, 0x40, 0x3c, 0x39, 0x3c, 0x38, 0x38, 0x38, 0x3f, 0x3a, 0x34, 0x66, 0x74, 0x86, 0x97, 0x92, 0x8e, 0x94, 0x8e, 0x92, 0x8c, 0xb5, 0xbd, 0xba, 0xbe, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc0, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xb9, 0xc3, 0xe2, 0xe8, 0xed, 0xfd, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 
-  0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xef, 0xee, 0xe3, 0xee, 0xee, 0xfb, 0xfc, 0xed, 0xf2, 0xe3, 0xe3, 0xe2, 0xb1, 0xb2, 0xc0, 0xba, 0xba, 0xbe, 0xba, 0xbe, 0xba, 0xbe, 0xbe, 0xbd, 0xba, 0xbd, 0xbe, 0xba, 0xbe, 0xbd, 0xc2, 0x8c, 0x95, 0x8e, 0x94, 0x92, 0x9d, 0x86, 0x73, 0x6e, 0x37, 0x3f, 0x3e, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3e, 0x40, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x3c, 0x38, 0x38, 0x37, 0x66, 0x66, 0x80, 0x8d, 0x9b, 0x8e, 0x8a, 0xa0, 0x87, 0xac, 0xbd, 0xba, 0xba, 0xba, 0xbe, 0xba, 0xbe, 0xbe, 0xbe, 0xc0, 0xbe, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xc0, 0xb7, 0xdc, 0xe9, 0xe4, 0xef, 0xfb, 0xee, 0xef, 0xef, 0xf0, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xe3, 0xe3, 0xfb, 0xfc, 0xed, 0xf2, 0xe3, 0xe7, 0xe2, 0xd4, 0xa5, 0xb9, 0xba, 0xba, 0xba, 0xba, 0xbe, 0xba, 0xbd, 0xbe, 0xba, 0xbd, 0xbd, 0xbe, 0xba, 0xbe, 0xbe, 0xbd, 0xb9, 0x88, 0x99, 0x92, 0x9b, 0x9d, 0x80, 0x72, 0x3a, 0x3f, 0x3c, 0x3c, 0x3c, 0x37, 0x3c, 0x39, 0x3c, 0x3c, 0x3c, 0x40, 0x3c, 0x3c, 0x3c, 0x3c, 0x3a, 0x39, 0x3d, 0x3e, 0x3c, 0x38, 0x67, 0x34, 0x74, 0x8d, 0x97, 0x92, 0x92, 0x8b, 0x95, 0xb5, 0xbe, 0xba, 0xbe, 0xbe, 0xbe, 0xbe, 0xba, 0xbe, 0xbe, 0xc0, 0xc2, 0xbe, 0xbe, 0xbe, 0xc2, 0xbe, 0xc2, 0xb9, 0xca, 0xe2, 0xe8, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xef, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xef, 0xed, 0xe3, 0x6c, 0xe3, 0xfb, 0xee, 0xfb, 0xe3, 0xe3, 0xe2, 0xaf, 0xb1, 0xbe, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbe, 0xba, 0xbe, 0xb9, 0xb2, 0xac, 0xa9, 0xb2, 0xbe, 0xc2, 0xb0, 0x8c, 0x8e, 0x92, 0x97, 0x80, 0x72, 0x67, 0x3a, 0x3c, 0x38, 0x3c, 0x3d, 0x3d, 0x37, 0x39, 0x38, 0x3d, 0x39, 0x3c, 0x3d, 0x3d, 0x3d, 0x3a, 0x39, 0x3b, 0x3d, 0x3c, 0x38, 0x42, 0x3e, 0x66, 0x6e, 0x74, 0x89, 0x9d, 0x8a, 0x99, 0x84, 0xb2, 0xbe, 0xba, 0xba, 0xba, 0xb2, 0xba, 0xba, 0xbe, 0xc2, 0xc2, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xc2, 0xbe, 0xc2, 0xb7, 0xdc, 0xe6, 0xf2, 0xfb, 0xee, 0xee, 0xee, 0xe5, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xe3, 0xe3, 0xe3, 0xfb, 0xfb, 0xf1, 0xeb, 0xcf, 0xa0, 0xb5, 0xbd, 0xba, 0xba, 0xbe, 0xba, 0xba, 0xba, 0xbd, 0xba, 0xb2, 0x9e, 0x9e, 0xa4, 0x9e, 0xa9, 0xb5, 0xc8, 0xa4, 0x94, 0x8b, 0xaa, 0x70, 0x72, 0x3b, 0x3a, 0x38, 0x3c, 0x3c, 0x3c, 0x39, 0x3a, 0x39, 0x3c, 0x39, 0x3d, 0x38, 0x39, 0x39, 0x38, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x38, 0x3c, 0x38, 0x37, 0x38, 0x3a, 0x34, 0x49, 0x8f, 0x8d, 0x8b, 0x88, 0xa9, 0xba, 0xba, 0xb5, 0xac, 0x91, 0x98, 0x98, 0x96, 0xb0, 0xba, 0xc2, 0xc2, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0xc2, 0xb7, 0xc3, 0xe9, 0xe4, 0xfb, 0xfd, 0xfc, 0xe3, 0xe3, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xf0, 0xf0, 0xfb, 0xf0, 0xef, 0xf0, 0xfb, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xef, 0xed, 0xe3, 0xe3, 0x6c, 0xef, 0xfb, 0xef, 0xe9, 0xaf, 0xab, 0xbd, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbe, 0xbe, 0xb5, 0xa9, 0x91, 0x9e, 0xa1, 0xa4, 0xa1, 0xa4, 0xba, 0xc0, 0x9e, 0x8e, 0x92, 0x86, 0x6f, 0x66, 0x3b, 0x3a, 0x3c, 0x38, 0x3c, 0x38, 0x3a, 0x38, 0x39, 0x38, 0x3d, 0x38, 0x3d, 0x38, 0x3d, 0x39, 0x38, 0x39, 0x3c, 0x39, 0x38, 0x3d, 0x39, 0x39, 0x3f, 0x37, 0x37, 0x36, 0x34, 0x77, 0x8d, 0x8b, 0x88, 0x98, 0xba, 0xba, 0xb2, 0xb2, 0x98, 0x9e, 0x9a, 0x9a, 0x90, 0x9e, 0xac, 0xbe, 0xc2, 0xc2, 0xc2, 0xbe, 0xbe, 0xc2, 0xb9, 0xb7, 0xde, 0xe3, 0xfb, 0xfd, 0xfc, 0xe5, 0xe3, 0xe3, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xfb, 0xef, 0x6c, 0xed, 0xe4, 0xfb, 0xfb, 0xe8, 0xd7, 0x85, 0xb2, 0xc0, 0xba, 0xba, 0xbe, 0xba, 0xbe, 0xb5, 0xac, 0x98, 0x9e, 0xa4, 0xa1, 0xa4, 0xa7, 0xa4, 0x9e, 0xb5, 0xbd, 0x8c, 0x92, 0x9b, 0x74, 0x35, 0x67, 0x3a, 0x39, 0x3c, 0x3c, 0x3c, 0x3d, 0x39, 0x3a, 0x39, 0x3c, 0x39, 0x39, 0x39, 0x39, 0x38, 0x39, 0x3c, 0x39, 0x39, 0x38, 0x39, 0x39, 0x3c, 0x39, 0x38, 0x3a, 0x38, 0x3a, 0x37, 0x73, 0x86, 0x8d, 0x8b, 0x88, 0xb5, 0xba, 0xb5, 0xac, 0x9e, 0x9a, 0x9e, 0xa9, 0xa4, 0x9e, 0x91, 0x98, 0xb2, 0xbe, 0xc2, 0xc2, 0xbd, 0xc2, 0xc0, 0xb1, 0xd4, 0xe9, 0xf0, 0xfd, 0xfd, 0xe5, 0xe3, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xfb, 0xfb, 0xee, 0xee, 0xe4, 0xf2, 0xe7, 0xb3, 0x99, 0xb9, 0xbd, 0xbe, 0xbd, 0xba, 0xbd, 0xb0, 0x9e, 0x98, 0xa1, 0xab, 0xa1, 0xa1, 0xa4, 0xa1, 0xa9, 0x95, 0xb5, 0xb9, 0x8e, 0x92, 0x8a, 0x73, 0x35, 0x3b, 0x40, 0x39, 0x3c, 0x3c, 0x3c, 0x39, 0x39, 0x3b, 0x38, 0x39, 0x38, 0x3d, 0x38, 0x3d, 0x39, 0x38, 0x39, 0x38, 0x3d, 0x39, 0x38, 0x3d, 0x39, 0x39, 0x38, 0x3f, 0x37, 0x37, 0x3f, 0x6d, 0x75, 0x8f, 0x8b, 0x84, 0xb5, 0xba, 0xb2, 0x96, 0x9e, 0xa4, 0xa9, 0x95, 0x9e, 0xa4, 0x9e, 0x98, 0x91, 0xb0, 0xbd, 0xc2, 0xbe, 0xbd, 0xc2, 0xb5, 0xb8, 0xe7, 0xf0, 0xfd, 0xfb, 0xf0, 0xe3, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 
-  0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xfb, 0xfc, 0xfb, 0xfc, 0xed, 0xe3, 0xe8, 0xd8, 0x87, 0xb0, 0xbd, 0xbd, 0xba, 0xbd, 0xba, 0xac, 0x98, 0x9e, 0xa4, 0xa1, 0x9f, 0xa7, 0xa4, 0xa1, 0x9c, 0xa4, 0x9e, 0xb2, 0xb5, 0x94, 0x8d, 0x83, 0x6d, 0x3d, 0x3d, 0x38, 0x40, 0x3c, 0x3c, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3c, 0x39, 0x39, 0x39, 0x39, 0x38, 0x39, 0x38, 0x39, 0x38, 0x39, 0x39, 0x39, 0x38, 0x39, 0x3d, 0x39, 0x3d, 0x38, 0x37, 0x3b, 0x67, 0x86, 0x8a, 0x87, 0xb2, 0xba, 0xac, 0x98, 0x9e, 0x9e, 0x9f, 0xa4, 0x9f, 0x9e, 0x95, 0xa4, 0x9e, 0x91, 0xa4, 0xbd, 0xc2, 0xbe, 0xc0, 0xb9, 0x9b, 0xd8, 0xe8, 0xf1, 0xfb, 0xfb, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 
-  0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfb, 0xfc, 0xfb, 0xfb, 0xe3, 0xea, 0xb4, 0x87, 0xb9, 0xbe, 0xbd, 0xba, 0xbd, 0xa9, 0x98, 0xa1, 0xa7, 0xa1, 0xa7, 0xa0, 0xa7, 0xa1, 0xa1, 0x9f, 0x9e, 0x9e, 0xb0, 0xb2, 0x8a, 0x97, 0x7b, 0x36, 0x3d, 0x3c, 0x39, 0x3c, 0x3c, 0x3c, 0x3d, 0x3d, 0x39, 0x3b, 0x39, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3d, 0x35, 0x75, 0x97, 0x81, 0xb2, 0xb5, 0xac, 0x91, 0xa9, 0x9e, 0x9f, 0x9f, 0xa1, 0xa1, 0xa4, 0xa1, 0xa4, 0xa4, 0x91, 0xa9, 0xbd, 0xc2, 0xbd, 0xc0, 0x9b, 0xb8, 0xeb, 0xf2, 0xfb, 0xfb, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 
-  0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xfd, 0xed, 0xe8, 0xde, 0x9b, 0x91, 0xbd, 0xc2, 0xba, 0xbd, 0xb2, 0x98, 0xa4, 0x9e, 0xa7, 0xa1, 0xa7, 0xa1, 0xa7, 0xa1, 0xa1, 0x9f, 0x9f, 0x9e, 0xac, 0xb7, 0x8b, 0x89, 0x73, 0x39, 0x39, 0x3c, 0x3c, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3c, 0x40, 0x39, 0x39, 0x6f, 0x89, 0x87, 0xb0, 0xb5, 0x9e, 0x98, 0x9e, 0x9c, 0xa1, 0x9f, 0xa1, 0xa1, 0xa1, 0xa4, 0x95, 0xa4, 0x95, 0x8c, 0xb2, 0xc2, 0xc2, 0xc5, 0xa7, 0x9d, 0xde, 0xe4, 0xfb, 0xfc, 0xfc, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 
-  0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xe4, 0xe8, 0xfb, 0xf3, 0xed, 0xe9, 0xd4, 0x84, 0xad, 0xc2, 0xba, 0xbe, 0xb9, 0x98, 0x95, 0xa1, 0xa4, 0xa1, 0xa2, 0xa1, 0xa1, 0xa1, 0xa7, 0xa7, 0x9f, 0xa4, 0x98, 0xa9, 0xb2, 0x97, 0x80, 0x35, 0x37, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x3c, 0x3c, 0x3c, 0x40, 0x3c, 0x39, 0x66, 0x77, 0x87, 0xb0, 0xb2, 0x96, 0xa4, 0x95, 0x9f, 0xa1, 0xa4, 0xa1, 0x9f, 0x9e, 0xa1, 0x95, 0xa4, 0xa4, 0x9e, 0x9e, 0xbd, 0xc8, 0xc2, 0xb7, 0x81, 0xd3, 0xea, 0xef, 0xed, 0xfc, 0xe4, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 
-  0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xe3, 0xf2, 0xfb, 0xf0, 0xe7, 0xb3, 0x88, 0xb2, 0xc2, 0xbd, 0xbe, 0xb0, 0x91, 0xa4, 0x91, 0xab, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa7, 0xa2, 0x9f, 0x9a, 0xa4, 0xb1, 0x9d, 0x75, 0x35, 0x3d, 0x38, 0x3d, 0x39, 0x39, 0x39, 0x3d, 0x3d, 0x38, 0x3d, 0x3c, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3c, 0x39, 0x3d, 0x3c, 0x40, 0x40, 0x3c, 0x40, 0x3c, 0x3c, 0x6e, 0x80, 0x8b, 0xb0, 0xac, 0x98, 0xa4, 0x9c, 0xa4, 0xa1, 0xa1, 0xa4, 0xa1, 0x9e, 0x9c, 0x9e, 0x9e, 0x95, 0xa4, 0x91, 0xb5, 0xcb, 0xc2, 0xbf, 0x87, 0xb3, 0xea, 0xe5, 0xed, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe5, 0xe1, 0xe5, 0xed, 0xf6, 0xd8, 0x8a, 0x9c, 0xbd, 0xc2, 0xbe, 0xbd, 0x9e, 0x9e, 0xa4, 0x9f, 0x99, 0x9f, 0x9c, 0x9e, 0x9e, 0xa1, 0xa1, 0xa7, 0xa1, 0x9e, 0x9e, 0x9e, 0xb0, 0x9d, 0x68, 0x34, 0x3c, 0x39, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x3c, 0x3d, 0x3c, 0x3c, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3a, 0x39, 0x3d, 0x3d, 0x39, 0x3c, 0x3c, 0x40, 0x3c, 0x40, 0x3c, 0x3f, 0x66, 0x74, 0x87, 0xac, 0xa9, 0x96, 0x9e, 0xa4, 0x9f, 0xa4, 0xa1, 0x9e, 0x9f, 0xa4, 0x95, 0xa4, 0x9a, 0x9a, 0x9e, 0xa1, 0xab, 0xc9, 0xc8, 0xc2, 0xa8, 0x85, 0xe0, 0xe3, 0xe5, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xfb, 0xe4, 0xf2, 0xe1, 0xf2, 0xed, 0xeb, 0xc1, 0x87, 0xac, 0xc2, 0xbe, 0xc2, 0xb5, 0x9f, 0x95, 0xa4, 0xa4, 0x95, 0x9f, 0x9f, 0xa1, 0x9e, 0xa1, 0xa1, 0xa1, 0x9f, 0x9e, 0x9e, 0x95, 0xad, 0xaa, 0x74, 0x39, 0x3d, 0x3c, 0x39, 0x3d, 0x3a, 0x39, 0x3a, 0x3d, 0x38, 0x3d, 0x3c, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x37, 0x66, 0x7b, 0x8d, 0xab, 0x9e, 0x98, 0x9e, 0x9f, 0x9f, 0x9e, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9a, 0x9e, 0x9e, 0x9f, 0x98, 0xab, 0xc2, 0xcb, 0xc5, 0xb0, 0x81, 0xcf, 0xea, 0xf2, 0xfb, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xef, 0xfb, 0xed, 0xef, 0xed, 0xf2, 0xe1, 0xe5, 0xf2, 0xe2, 0xaf, 0x84, 0xb2, 0xc9, 0xbd, 0xc5, 0xb0, 0xa1, 0x95, 0xa2, 0xa4, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0xa1, 0xa1, 0x9f, 0x9e, 0x9e, 0x9c, 0xa8, 0xaa, 0x6f, 0x36, 0x40, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x39, 0x67, 0x7b, 0x8d, 0xab, 0x9e, 0x9e, 0x9e, 0x9f, 0xa2, 0x9e, 0x9e, 0x9a, 0x9e, 0x9a, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x95, 0x95, 0xc0, 0xcb, 0xcb, 0xb5, 0x81, 0xb4, 0xe7, 0xf2, 0xfd, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe5, 0xed, 0xf2, 0xe6, 0xdb, 0x92, 0x88, 0xbd, 0xc2, 0xc2, 0xc0, 0xad, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0xa1, 0xa1, 0x9f, 0x9c, 0x9e, 0xa1, 0xa2, 0xaa, 0x74, 0x34, 0x42, 0x3c, 0x3d, 0x3d, 0x39, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x42, 0x67, 0x73, 0x8d, 0xa7, 0x9e, 0x9e, 0xa1, 0x9c, 0x9f, 0x9c, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9c, 0x9e, 0x9c, 0x9e, 0x9e, 0x91, 0xb9, 0xcd, 0xcb, 0xc0, 0x88, 0x92, 0xe0, 0xf2, 0xfd, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 
-  0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xe4, 0xed, 0xef, 0xed, 0x6c, 0xe3, 0xea, 0xcf, 0x8a, 0x8c, 0xc2, 0xc2, 0xc2, 0xb9, 0xa1, 0x9c, 0xa4, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0xa1, 0x9f, 0x9e, 0x9c, 0x9e, 0x9e, 0x99, 0xaa, 0x80, 0x34, 0x41, 0x3c, 0x39, 0x3c, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3c, 0x3c, 0x3d, 0x67, 0x7b, 0x8d, 0xa2, 0xa1, 0x9e, 0x9e, 0x9f, 0x9f, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9c, 0xa4, 0x8c, 0xb5, 0xcd, 0xc8, 0xc5, 0x8c, 0x8a, 0xd7, 0xe8, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xfb, 0xee, 0xfb, 0xee, 0xee, 0xee, 0xe3, 0xe9, 0xb8, 0x87, 0xad, 0xc9, 0xc2, 0xc2, 0xb9, 0x95, 0x9f, 0x9c, 0xa4, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0xa1, 0x9f, 0x9f, 0x9c, 0x9e, 0x9f, 0x9f, 0xa8, 0x89, 0x73, 0x3b, 0x3a, 0x3a, 0x39, 0x3d, 0x3c, 0x3d, 0x3d, 0x38, 0x3d, 0x3d, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x39, 0x3c, 0x3d, 0x3c, 0x40, 0x3f, 0x34, 0x75, 0xa5, 0x9f, 0xa1, 0x9e, 0xa1, 0x9e, 0x9c, 0x9c, 0x9e, 0x9c, 0x9e, 0x9c, 0x9e, 0x9c, 0x9e, 0x9c, 0x9e, 0x9c, 0x91, 0xb0, 0xcb, 0xc8, 0xcb, 0xab, 0x87, 0xb8, 0xeb, 0xfb, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xe5, 0xe3, 0xe2, 0xb1, 0x87, 0xb0, 0xcd, 0xc2, 0xc2, 0xb5, 0x95, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9a, 0x95, 0xa1, 0xa8, 0x97, 0x7b, 0x66, 0x37, 0x3f, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x38, 0x3f, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3e, 0x3d, 0x6e, 0x83, 0xa8, 0x99, 0xa1, 0xa1, 0x9e, 0x9c, 0x9e, 0x9e, 0x9f, 0x9e, 0x9c, 0x9e, 0x9c, 0x9e, 0x9c, 0x9e, 0x9f, 0x95, 0x95, 0xad, 0xcb, 0xc5, 0xcb, 0xad, 0x8b, 0xaa, 0xeb, 0xe4, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xfc, 0xe7, 0xe0, 0x9b, 0x88, 0xb7, 0xc9, 0xc2, 0xc2, 0xb2, 0x91, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x95, 0x9f, 0x9c, 0x9c, 0x9c, 0x9e, 0xa1, 0xa2, 0xa5, 0x83, 0x72, 0x67, 0x3b, 0x3a, 0x3d, 0x39, 0x3c, 0x3c, 0x38, 0x3a, 0x38, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x37, 0x7b, 0x8d, 0xa3, 0x95, 0x9f, 0xa1, 0xa1, 0x9e, 0x9e, 0x9c, 0xa1, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0x9e, 0x9c, 0x91, 0xad, 0xcd, 0xc2, 0xcd, 0xb2, 0x87, 0x8d, 0xe2, 0xe4, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xfb, 0xe6, 0xd8, 0x94, 0x88, 0xbd, 0xcb, 0xc0, 0xc8, 0xb0, 0x91, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9e, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa4, 0x95, 0x9c, 0xa8, 0x8b, 0x73, 0x67, 0x3f, 0x36, 0x42, 0x39, 0x40, 0x3c, 0x3c, 0x38, 0x3f, 0x3c, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x39, 0x3c, 0x3d, 0x3d, 0x66, 0x80, 0xa3, 0x95, 0x9a, 0xa1, 0xa1, 0xa1, 0x9e, 0x9e, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9f, 0x9e, 0x9f, 0x9c, 0x95, 0xad, 0xcb, 0xc8, 0xc8, 0xb9, 0x88, 0x8a, 0xdb, 0xe6, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 
-  0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xe4, 0xee, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xef, 0xfc, 0xfb, 0xea, 0xcf, 0x8e, 0x8c, 0xc8, 0xc8, 0xc0, 0xc2, 0xac, 0x91, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9a, 0x9c, 0x9f, 0x9c, 0x9c, 0x9e, 0xa4, 0x9e, 0xa0, 0xa3, 0x74, 0x6e, 0x3b, 0x67, 0x45, 0x39, 0x3c, 0x3c, 0x38, 0x3f, 0x38, 0x3a, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x36, 0x73, 0x8d, 0xa2, 0x98, 0x9e, 0x9f, 0xa0, 0x9f, 0xa1, 0x9e, 0x9f, 0x9c, 0xa1, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x95, 0xad, 0xcb, 0xc8, 0xc8, 0xbd, 0x88, 0x85, 0xcf, 0xea, 0xe4, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xee, 0xfb, 0xfc, 0xea, 0xbf, 0x88, 0x9e, 0xcb, 0xc2, 0xc0, 0xc2, 0xa9, 0x9a, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x95, 0x9c, 0x9c, 0xa2, 0x9c, 0x95, 0x9e, 0xa4, 0x9c, 0xab, 0x77, 0x67, 0x67, 0x3a, 0x3d, 0x39, 0x40, 0x3c, 0x3c, 0x38, 0x3a, 0x3c, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x67, 0x75, 0xa5, 0x98, 0x98, 0x98, 0x9e, 0xa0, 0xa1, 0xa1, 0x9e, 0xa1, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0xab, 0xcb, 0xc8, 0xc2, 0xc0, 0x8c, 0x87, 0xc1, 0xeb, 0xed, 0xf0, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xe4, 0xef, 0xe4, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xfb, 0xef, 0xf2, 0xed, 0xe4, 0xf2, 0xef, 0xfb, 0xf0, 0xfb, 0xe4, 0xee, 0xef, 0xef, 0xef, 0xe4, 0xe4, 0xef, 0xee, 0xef, 0xfb, 0xef, 0xee, 0xe4, 0xee, 0xe5, 0xfb, 0xef, 0xfb, 0xe4, 0xfd, 0xf4, 0xe9, 0xb4, 0x88, 0xa9, 0xcb, 0xc0, 0xc5, 0xbe, 0xa9, 0x9a, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c, 0x9e, 0x98, 0x9e, 0x9c, 0xab, 0x8d, 0x68, 0x66, 0x3b, 0x3c, 0x3c, 0x3c, 0x3d, 0x3c, 0x3a, 0x38, 0x3a, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3c, 0x3d, 0x3c, 0x3a, 0x3c, 0x3d, 0x3c, 0x3c, 0x39, 0x3d, 0x73, 0x89, 0xa3, 0x91, 0x96, 0x98, 0x9f, 0x9f, 0xa0, 0x9e, 0x9e, 0x9f, 0x9f, 0xa1, 0x9f, 0xa1, 0x9f, 0x9f, 0xa1, 0x9c, 0x9f, 0x9c, 0x9c, 0xab, 0xcb, 0xc8, 0xc9, 0xc0, 0x94, 0x87, 0xc1, 0xe7, 0xe4, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf0, 0xfb, 0xee, 0xe3, 0xe3, 0xe5, 0xee, 0xfb, 0xfc, 0xee, 0xee, 0xfd, 0xfd, 0xfb, 0xe4, 0xf2, 0xe8, 0xf2, 0xe4, 0xfd, 0xfd, 0xfb, 0xe4, 0xed, 0xfb, 0xfb, 0xed, 0xe4, 0xe3, 0xe3, 0xfb, 0xf1, 0xfd, 0xfd, 0x6c, 0x6c, 0xe3, 0x6c, 0xed, 0xf1, 0xfc, 0xfb, 0xfb, 0xfd, 0xe6, 0xb1, 0x87, 0xb0, 0xc8, 0xc0, 0xc2, 0xc0, 0x9e, 0x9a, 0xa1, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0x83, 0x6e, 0x67, 0x38, 0x3e, 0x38, 0x3a, 0x3b, 0x3c, 0x3c, 0x3c, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3c, 0x40, 0x3c, 0x39, 0x3a, 0x3a, 0x3e, 0x38, 0x3c, 0x37, 0x35, 0x7d, 0xa2, 0xa2, 0x94, 0x9f, 0x9c, 0x9c, 0x9c, 0x95, 0x9e, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0xa1, 0x94, 0xad, 0xc5, 0xcb, 0xc8, 0xc2, 0x91, 0x88, 0xb4, 0xe2, 0xe6, 0xed, 0xed, 0xed, 0xee, 0xfb, 0x6c, 0xfb, 0xfc, 0xee, 0xee, 0x6c, 0xee, 0x6c, 0xfc, 0x6c, 0xfc, 0xee, 0xee, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xfd, 0xfc, 0xe4, 0xe5, 0xe3, 0xe3, 0xfc, 0xfc, 0xfb, 0x6c, 0xee, 0x6c, 0xf3, 0xea, 0xe9, 0xe7, 0xde, 0xe2, 0xea, 0xe8, 0xed, 0x6c, 0xe3, 0xf3, 0xfb, 0xfb, 0xfb, 0xe3, 0xe3, 0xe3, 0xfb, 0xfd, 0xfd, 0xfd, 0x6c, 0xe3, 0x6c, 0xe3, 0xef, 0xf1, 0xfb, 0xee, 0xf3, 0xf0, 0xe6, 0xb1, 0x84, 0xb0, 0xcd, 0xc0, 0xc5, 0xc0, 0x9e, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0xa0, 0x8d, 0x73, 0x67, 0x3f, 0x3e, 0x38, 0x3b, 0x3a, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x40, 0x3d, 0x3d, 0x3a, 0x38, 0x3e, 0x38, 0x3f, 0x37, 0x66, 0x92, 0xa2, 0x94, 0x94, 0x9c, 0x9c, 0x9c, 0x9e, 0x9c, 0x9e, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0xa1, 0x91, 0xad, 0xcd, 0xc8, 0xc8, 0xc8, 0x8c, 0x88, 0xb1, 0xe2, 0xe1, 0xe6, 0xe5, 0xf2, 0xe5, 0xee, 0xee, 0xee, 0xe5, 0xe4, 0x6c, 0xe5, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xee, 0xfb, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xfb, 0xee, 0xe3, 0xe3, 0xe5, 0xfb, 0xfc, 0xee, 0xe4, 0xe3, 0xe7, 0xde, 0xd7, 0xb4, 0xa5, 0x9b, 0x9d, 0xaf, 0xd4, 0xe2, 0xe7, 0xe1, 0xed, 0xed, 0xfd, 0xed, 0xe4, 0xe3, 0xed, 0xef, 0xfb, 0xf1, 0xf1, 0xf0, 0xe3, 0xe3, 0xe3, 0xe8, 0xe4, 0xef, 0xf5, 0xed, 0x6c, 0xe0, 0xa5, 0x88, 0xac, 0xcd, 0xc2, 0xc2, 0xc0, 0xa1, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x99, 0xa8, 0x75, 0x6e, 0x38, 0x3e, 0x3c, 0x3d, 0x39, 0x3a, 0x3c, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3c, 0x38, 0x3c, 0x39, 0x3d, 0x3c, 0x3c, 0x3e, 0x3a, 0x6e, 0x75, 0xa8, 0x94, 0x95, 0x99, 0x9c, 0xa4, 0x9c, 0x95, 0x9c, 0x9c, 0x9e, 0x95, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0xa1, 0x94, 0xad, 0xcd, 0xc5, 0xc8, 0xc8, 0x8c, 0x8b, 0xaf, 0xde, 0xe5, 0xee, 0xed, 0xed, 0xe4, 0xe4, 0xed, 0xe4, 0xe4, 0xe6, 0xe4, 0xe3, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xef, 0xfc, 0xfb, 0xe5, 0xe3, 0xe5, 0xe5, 0xfc, 0xee, 0xe4, 0xe5, 0xe2, 0xe2, 0xbf, 0x92, 0x99, 0xab, 0xa7, 0xa7, 0xa3, 0x92, 0xbb, 0xe2, 0xe8, 0xed, 0xfb, 0xf3, 0xed, 0xe4, 0xe3, 0xe5, 0xed, 0xfd, 0xf1, 0xf1, 0xef, 0xe5, 0xe3, 0xe4, 0xe1, 0xf3, 0x33, 0x65, 0x30, 0x6c, 0xde, 0x9d, 0x84, 0xac, 0xcd, 0xc2, 0xc5, 0xc0, 0xa7, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa3, 0x86, 0x73, 0x37, 0x3c, 0x40, 0x3c, 0x3d, 0x3a, 0x3a, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x3a, 0x3d, 0x39, 0x40, 0x3c, 0x40, 0x3f, 0x36, 0x73, 0x89, 0xa0, 0x9c, 0xa2, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9e, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0xa1, 0x94, 0xb0, 0xcd, 0xc2, 0xc9, 0xc2, 0xa1, 0x8a, 0xae, 0xeb, 0xf4, 0xfd, 0xf4, 0xf4, 0xe1, 0xed, 0xe4, 0xe4, 0xef, 0xe4, 0xe4, 0xe5, 0xe5, 0xe4, 0xee, 0xe3, 0xe4, 0xee, 0xef, 0xee, 0xee, 0xe4, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xfb, 0xf0, 0xe4, 0xe5, 0xe3, 0xee, 0xfc, 0xef, 0xe4, 0xe6, 0xe2, 0xbf, 0x88, 0xa2, 0xab, 0x9e, 0xad, 0xa4, 0xa9, 0xa7, 0x99, 0xbb, 0xe3, 0xe6, 0xed, 0xfb, 0xf0, 0xed, 0xe3, 0xed, 0xee, 0xfb, 0xef, 0xef, 0xf2, 0xf3, 0x6c, 0xfc, 0xfe, 0x30, 0x25, 0x09, 0x01, 0x50, 0x50, 0x89, 0x83, 0x99, 0xcb, 0xc2, 0xc2, 0xc0, 0xa9, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x90, 0xa8, 0x74, 0x66, 0x40, 0x40, 0x40, 0x3c, 0x38, 0x3a, 0x39, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3a, 0x3a, 0x38, 0x3a, 0x40, 0x40, 0x3c, 0x3d, 0x6e, 0x75, 0xa3, 0x99, 0x9f, 0x9c, 0x9f, 0xa4, 0x9c, 0x9c, 0x9c, 0x95, 0x9c, 0x95, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa4, 0x94, 0xb0, 0xcd, 0xc2, 0xc8, 0xc8, 0x8e, 0x85, 0xc4, 0x64, 0x29, 0x23, 0x29, 0x64, 0x33, 0xfd, 0xfd, 0xfd, 0xf3, 0xfd, 0xfc, 0xee, 0xee, 0xe4, 0xe3, 0xe4, 0xe4, 0xe4, 0xef, 0xee, 0xfc, 0xfb, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xef, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xfb, 0xee, 0xe3, 0xee, 0xee, 0xfb, 0xee, 0xe3, 0xea, 0xd4, 0xa3, 0xa4, 0xa9, 0xa9, 0xa9, 0x9e, 0xa9, 0xa9, 0xab, 0xab, 0xa8, 0xdb, 0xe8, 0xed, 0xfb, 0xfc, 0xed, 0xe5, 0xe1, 0xee, 0xfb, 0xe5, 0xf6, 0xe1, 0x30, 0x30, 0xff, 0x29, 0x50, 0x05, 0x03, 0x07, 0x05, 0x01, 0x04, 0xdf, 0x87, 0xbf, 0xc9, 0xc0, 0xc2, 0xad, 0x95, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9a, 0x9a, 0xa3, 0x86, 0x6d, 0x43, 0x40, 0x40, 0x3c, 0x3a, 0x67, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3f, 0x38, 0x3a, 0x3d, 0x3c, 0x40, 0x3c, 0x3b, 0x6e, 0x8d, 0xa3, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x8e, 0xb2, 0xcd, 0xc2, 0xc2, 0xc5, 0x8a, 0xb6, 0x60, 0x4b, 0x00, 0x01, 0x00, 0x02, 0x29, 0x33, 0xfd, 0x65, 0x64, 0x2f, 0x33, 0xfd, 0xfc, 0xf2, 0xe1, 0xe8, 0xe3, 0xe3, 0xe4, 0xfb, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xee, 0xee, 0xee, 0xfb, 0xe4, 0xe6, 0xe7, 0xb4, 0xa0, 0xa9, 0xa4, 0xa4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0x9b, 0xd3, 0xe6, 0xe4, 0xf1, 0xee, 0xed, 0xe3, 0xf3, 0xed, 0xf3, 0xf4, 0x57, 0x4b, 0x46, 0x50, 0x64, 0x00, 0x06, 0x0a, 0x0f, 0x0d, 0x0f, 0x0e, 0x06, 0x57, 0xb3, 0xb9, 0xcb, 0xc2, 0xc8, 0xad, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9a, 0x9a, 0xa2, 0x9d, 0x7b, 0x3b, 0x40, 0x40, 0x3e, 0x39, 0x3a, 0x3a, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x38, 0x3a, 0x38, 0x3d, 0x3d, 0x3c, 0x3d, 0x66, 0x75, 0x9b, 0x9f, 0x9a, 0x9c, 0x9e, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x94, 0xb5, 0xcb, 0xc2, 0xcb, 0xc5, 0xb3, 0x27, 0x00, 0x02, 0x0a, 0x03, 0x05, 0x02, 0x09, 0x64, 0x13, 0x00, 0x01, 0x02, 0x25, 0x33, 0xfb, 0xf3, 0xe4, 0xe3, 0xe3, 0xe4, 0xed, 0xfc, 0xfd, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf0, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf0, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xfc, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf0, 0x6c, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xed, 0xe3, 0xee, 0xe4, 0x6c, 0xfb, 0xfb, 0xed, 0xe7, 0xdd, 0xa5, 0xa1, 0xab, 0xa9, 0xa9, 0xa4, 0xa9, 0xa4, 0xa9, 0xa9, 0xab, 0xa0, 0xd3, 0xe2, 0xed, 0xef, 0xfb, 0xfb, 0xe1, 0xed, 0x6c, 0xf4, 0x57, 0x46, 0x4b, 0x02, 0x00, 0x00, 0x23, 0x09, 0x13, 0x17, 0x17, 0x11, 0x16, 0x0e, 0x04, 0xbc, 0xbf, 0xc9, 0xc2, 0xc9, 0xb0, 0x94, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x9f, 0x9c, 0xa8, 0x83, 0x72, 0x39, 0x3e, 0x3c, 0x3a, 0x3a, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x3c, 0x3d, 0x3c, 0x39, 0x3a, 0x67, 0x6e, 0x8d, 0xa0, 0x9c, 0x98, 0x9f, 0x95, 0x9c, 0x95, 0x9c, 0x9f, 0x9c, 0x9c, 0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x94, 0xb9, 0xc8, 0xc8, 0xc0, 0xca, 0xc7, 0xfa, 0x06, 0x07, 0x07, 0x07, 0x07, 0x02, 0x28, 0x06, 0x00, 0x02, 0x01, 0x01, 0x00, 0x25, 0x33, 0xfd, 0xe5, 0xf2, 0xe3, 0xe3, 0xef, 0xfb, 0xfc, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0x6c, 0xee, 0xee, 0xf0, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0x6c, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xe4, 0xed, 0xee, 0xee, 0xfb, 0xfc, 0xee, 0xe7, 0xd8, 0x92, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xa8, 0xd8, 0xe6, 0xed, 0xfb, 0xed, 0xee, 0xed, 0xe1, 0xf4, 0x64, 0x49, 0x00, 0x4e, 0x4e, 0x0c, 0x4b, 0x4b, 0x29, 0x1a, 0x0f, 0x1d, 0x12, 0x0f, 0x13, 0x04, 0xae, 0xc5, 0xc9, 0xc9, 0xc2, 0xb5, 0x8c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0xa1, 0xa0, 0x8d, 0x73, 0x67, 0x3e, 0x3c, 0x3c, 0x3a, 0x39, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3e, 0x3c, 0x39, 0x3a, 0x67, 0x66, 0x75, 0xa5, 0x99, 0x98, 0x9e, 0x9c, 0x9e, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0xc0, 0xcb, 0xc2, 0xcb, 0xc6, 0xc4, 0x09, 0x01, 0x0d, 0x07, 0x07, 0x07, 0x16, 0x28, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x09, 0x30, 0xfd, 0xf3, 0xe1, 0xe6, 0xe3, 0xf0, 0xfb, 0xfd, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xfc, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xe4, 0xe3, 0x6c, 0xfb, 0xfb, 0xfd, 0xe3, 0xe7, 0xd7, 0x92, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa4, 0xa9, 0xa9, 0xa9, 0xa8, 0xd8, 0xe2, 0xe3, 0xfb, 0xed, 0xed, 0xed, 0x6c, 0xe5, 0x64, 0x48, 0x02, 0x02, 0x05, 0x02, 0x02, 0x70, 0x29, 0x25, 0x13, 0x0f, 0x16, 0x13, 0x0e, 0x04, 0xa6, 0xcb, 0xcd, 0xc9, 0xcd, 0xb7, 0x8e, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0xa0, 0x99, 0xa7, 0x99, 0xa8, 0x75, 0x66, 0x38, 0x3e, 0x3d, 0x3a, 0x3d, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x39, 0x3c, 0x3c, 0x40, 0x3c, 0x3f, 0x67, 0x67, 0x73, 0x89, 0x9d, 0x99, 0x98, 0x9e, 0x9e, 0x9c, 0x9e, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0xc8, 0xc8, 0xc2, 0xc5, 0xd1, 0x60, 0x02, 0x0b, 0x07, 0x0d, 0x07, 0x03, 0x28, 0x1e, 0x00, 0x01, 0x03, 0x00, 0x03, 0x08, 0x01, 0x64, 0x33, 0x6c, 0xe5, 0xe3, 0xe4, 0xed, 0xfd, 0xfb, 0xf0, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xfb, 0xef, 0xfb, 0x6c, 0xee, 0xe3, 0xe7, 0xdc, 0x92, 0xab, 0xa9, 0xa9, 0xa4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xd8, 0xe2, 0xe3, 0xed, 0xfd, 0xf4, 0xf4, 0xf3, 0xeb, 0xed, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x4b, 0x4b, 0xc4, 0x27, 0x0e, 0x16, 0x17, 0x16, 0x13, 0x04, 0xae, 0xca, 0xd2, 0xcd, 0xcd, 0xb9, 0x94, 0x95, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa1, 0xa0, 0xa1, 0xa1, 0xa7, 0x8a, 0x6e, 0x3a, 0x38, 0x3e, 0x3d, 0x3d, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x38, 0x37, 0x3e, 0x37, 0x3f, 0x6e, 0x74, 0xa5, 0x92, 0xa4, 0x94, 0x9e, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x94, 0xab, 0xc8, 0xc2, 0xc2, 0xc0, 0xcc, 0x5d, 0x09, 0x07, 0x0d, 0x0b, 0x0a, 0x08, 0x2b, 0x15, 0x02, 0x03, 0x16, 0x07, 0x4e, 0x4e, 0x02, 0x64, 0x33, 0x6c, 0xf3, 0xe3, 0xed, 0xe5, 0xfc, 0xf0, 0xfb, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xf0, 0xfc, 0xfb, 0xfc, 0xee, 0xe3, 0xe3, 0xe7, 0xe0, 0xa5, 0xa7, 0xa9, 0xab, 0xa9, 0xa4, 0xa9, 0xa9, 0xab, 0xa9, 0xab, 0x99, 0xd4, 0xe7, 0xe1, 0x33, 0x65, 0x20, 0x48, 0x50, 0x2b, 0x33, 0x29, 0x40, 0x02, 0x08, 0x03, 0x00, 0xfa, 0xce, 0xbc, 0x0c, 0x05, 0x13, 0x08, 0x09, 0x4d, 0xb6, 0xd2, 0xcd, 0xd2, 0xcd, 0xc0, 0x94, 0x94, 0x99, 0x9f, 0x9f, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9f, 0xa1, 0x99, 0xa1, 0x9c, 0xa0, 0x99, 0xa1, 0x98, 0xa1, 0x9b, 0x74, 0x67, 0x3c, 0x40, 0x40, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x38, 0x36, 0x3e, 0x38, 0x3a, 0x6e, 0x86, 0xa7, 0x94, 0x95, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x94, 0xb0, 0xcd, 0xc2, 0xc8, 0xc8, 0xcf, 0xae, 0x09, 0x13, 0x0a, 0x0a, 0x02, 0x60, 0x64, 0xfa, 0x02, 0x0a, 0x07, 0x03, 0x08, 0x48, 0x18, 0x30, 0xfd, 0x65, 0x65, 0xff, 0xf3, 0xfb, 0xe4, 0xf2, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0x6c, 0xee, 0xee, 0xee, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xfb, 0xf0, 0xfb, 0xfc, 0x6c, 0xe5, 0xe3, 0xe2, 0xe7, 0xb4, 0xa7, 0xa9, 0xa4, 0xac, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xb8, 0xe7, 0xf1, 0x2f, 0x06, 0x00, 0x05, 0x01, 0x00, 0x29, 0x32, 0xfa, 0x00, 0x4b, 0x00, 0x04, 0x27, 0xc6, 0xc7, 0xbc, 0x23, 0x1b, 0x18, 0xfa, 0x57, 0xc7, 0xd4, 0xcd, 0xd2, 0xd2, 0xc8, 0xa1, 0x94, 0x9c, 0x9f, 0x9f, 0xa1, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x99, 0x9f, 0x9c, 0x9f, 0x99, 0xa2, 0x9c, 0x9e, 0xa1, 0xa5, 0x83, 0x66, 0x3a, 0x3c, 0x3c, 0x3c, 0x39, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3a, 0x38, 0x37, 0x45, 0x34, 0x7b, 0xa5, 0xa0, 0xa1, 0x95, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x8c, 0xb7, 0xcd, 0xc8, 0xc8, 0xc5, 0xd1, 0xb3, 0xdf, 0x6a, 0x29, 0x6a, 0xc4, 0xcf, 0xc6, 0xbc, 0x4d, 0x01, 0x02, 0x01, 0x00, 0x15, 0x2b, 0x28, 0x15, 0x50, 0x15, 0x29, 0xfd, 0xfd, 0xf3, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xe4, 0xef, 0xe4, 0xee, 0xfc, 0xfb, 0xee, 0xee, 0xe3, 0xe3, 0xea, 0xcf, 0xa1, 0xa4, 0xa9, 0xa9, 0xac, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xaf, 0xd7, 0xf8, 0x29, 0x01, 0x07, 0x07, 0x07, 0x07, 0x03, 0x1e, 0x64, 0x27, 0x4d, 0x04, 0x5d, 0xce, 0xbf, 0xc3, 0xc1, 0xcc, 0xc7, 0xc7, 0xc7, 0xc1, 0xcf, 0xd4, 0xcd, 0xd2, 0xd2, 0xcd, 0xa7, 0x94, 0x9c, 0x99, 0x9f, 0x9f, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0xa1, 0x99, 0x9c, 0x99, 0x9f, 0x99, 0xa1, 0x95, 0xa1, 0xa3, 0x8f, 0x73, 0x37, 0x3c, 0x40, 0x3c, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3d, 0x3c, 0x3f, 0x38, 0x3a, 0x34, 0x77, 0xaa, 0x94, 0x9f, 0x95, 0x95, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x94, 0xc0, 0xcd, 0xc5, 0xcb, 0xc5, 0xca, 0xd1, 0xd4, 0xc7, 0xc7, 0xcf, 0xc6, 0xc3, 0xc6, 0xc6, 0xc1, 0xdf, 0x04, 0x00, 0x20, 0x2e, 0x25, 0x01, 0x02, 0x06, 0x02, 0x01, 0x29, 0x33, 0xfd, 0xee, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0x6c, 0xee, 0x6c, 0xee, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0x6c, 0xee, 0x6c, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0x6c, 0xee, 0x6c, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0x6c, 0xee, 0x6c, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0x6c, 0xee, 0x6c, 0xee, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xed, 0xef, 0xee, 0xfc, 0xfc, 0xfb, 0xef, 0xe4, 0xe8, 0xe0, 0xb1, 0xa1, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xad, 0xe2, 0xc4, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x23, 0xd3, 0xc7, 0xc7, 0xc1, 0xcf, 0xc6, 0xcc, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc3, 0xd1, 0xcd, 0xd2, 0xd2, 0xd2, 0xad, 0x99, 0x94, 0x9c, 0x94, 0x9c, 0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x99, 0x9c, 0xa1, 0x9f, 0x99, 0x9c, 0x9f, 0x9e, 0x9c, 0xa0, 0xaa, 0x74, 0x66, 0x3d, 0x3c, 0x3c, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3d, 0x38, 0x3f, 0x34, 0x74, 0x97, 0xa5, 0x94, 0x9c, 0x9a, 0x9a, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9f, 0x95, 0xa7, 0xc5, 0xcd, 0xc5, 0xc5, 0xc5, 0xca, 0xc6, 0xcf, 0xc7, 0xcf, 0x6a, 0xce, 0xce, 0xcf, 0xc7, 0xc6, 0xcc, 0xc7, 0xbc, 0x65, 0x29, 0x01, 0x07, 0x03, 0x03, 0x03, 0x06, 0x09, 0x33, 0xfd, 0xe4, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf0, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xf0, 0xee, 0xee, 0xef, 0xee, 
-  0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xe4, 0xe4, 0xef, 0xee, 0xfc, 0xfb, 0xfb, 0xef, 0xf0, 0xed, 0xea, 0xd1, 0xa1, 0xab, 0xac, 0xa4, 0xac, 0xa9, 0xa9, 0xa9, 0xad, 0x96, 0xac, 0x9a, 0xb4, 0xd3, 0x02, 0x03, 0x07, 0x0b, 0x07, 0x0b, 0x0b, 0x05, 0x50, 0xcc, 0xc6, 0xc7, 0xce, 0xce, 0x60, 0x23, 0x1b, 0x1b, 0x27, 0xc4, 0xce, 0xc6, 0xc3, 0xcb, 0xd2, 0xd5, 0xd5, 0xb2, 0x94, 0x94, 0x9c, 0x99, 0x9c, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0xa1, 0x9c, 0x99, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa0, 0xa8, 0x77, 0x6e, 0x37, 0x40, 0x3c, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3c, 0x38, 0x3f, 0x72, 0x77, 0xa5, 0xa0, 0x9c, 0x95, 0x9a, 0x9e, 0x95, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x95, 0xad, 0xd2, 0xc8, 0xc5, 0xcb, 0xc5, 0xd1, 0xcf, 0xce, 0x27, 0x1b, 0x1a, 0x15, 0x1a, 0x25, 0x6a, 0xcc, 0xc6, 0xc3, 0xc6, 0xd6, 0x57, 0x01, 0x07, 0x07, 0x03, 0x03, 0x06, 0x0e, 0xfd, 0xf4, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xee, 0xee, 0xf0, 0xf0, 0xee, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xee, 0xee, 0xfc, 0xfc, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xee, 0xef, 0xf0, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xee, 0xee, 0xfc, 0xf0, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xf0, 0xee, 0xee, 0xfc, 0xf0, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xfb, 0xef, 0xf0, 0xe4, 0xe2, 0xb4, 0xa0, 0xad, 0xab, 0xa9, 0xac, 0xa9, 0xac, 0xa9, 0xac, 0xac, 0xac, 0xa8, 0xcf, 0x23, 0x05, 0x07, 0x07, 0x0b, 0x07, 0x0b, 0x05, 0x27, 0xcc, 0xc1, 0xce, 0x23, 0xfa, 0x09, 0x0e, 0x0a, 0x07, 0x06, 0x15, 0x23, 0xc7, 0xd0, 0xc0, 0xd2, 0xd2, 0xd2, 0xb9, 0x8e, 0x9c, 0x9f, 0x9f, 0x9c, 0x99, 0x9c, 0x9c, 0x9c, 0x99, 0xa1, 0x9f, 0xa1, 0x9f, 0xa1, 0x9c, 0x99, 0x9c, 0xa1, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9b, 0x97, 0x73, 0x67, 0x3c, 0x3d, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3c, 0x66, 0x6e, 0x97, 0xa3, 0xa0, 0x9c, 0x9c, 0x9a, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0xa4, 0x8c, 0xb7, 0xd2, 0xcb, 0xc5, 0xc5, 0xd0, 0xce, 0x60, 0x15, 0x08, 0x0a, 0x0a, 0x0b, 0x0b, 0x07, 0x15, 0x60, 0xce, 0xc6, 0xc3, 0xca, 0xfa, 0x05, 0x01, 0x03, 0x03, 0x03, 0x05, 0x09, 0x33, 0x30, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xf0, 0xe4, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xf0, 0xef, 0xef, 0xee, 
-  0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xe4, 0xe4, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf0, 0xe4, 0xe7, 0xdc, 0xaf, 0xa5, 0xa9, 0xad, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xac, 0xa9, 0xa8, 0xb3, 0x2b, 0x02, 0x07, 0x0b, 0x0b, 0x0b, 0x03, 0x22, 0x2b, 0xc7, 0xce, 0x57, 0x09, 0x02, 0x0a, 0x14, 0x14, 0x14, 0x14, 0x07, 0x09, 0x1b, 0xc7, 0xd0, 0xc5, 0xd2, 0xd5, 0xc5, 0x94, 0x9f, 0x94, 0xa1, 0x99, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x9f, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0xa1, 0x9c, 0x99, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0xa1, 0xa0, 0xa8, 0x74, 0x67, 0x3c, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3d, 0x3d, 0x3e, 0x72, 0x75, 0xa5, 0xa0, 0x9f, 0x9c, 0x9f, 0x9f, 0x9a, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9c, 0x9f, 0x9f, 0x8c, 0xc0, 0xcd, 0xca, 0xc5, 0xd4, 0xc7, 0x1b, 0x09, 0x07, 0x14, 0x14, 0x14, 0x11, 0x11, 0x14, 0x07, 0x06, 0x20, 0xd3, 0xc7, 0xcf, 0xdf, 0x02, 0x05, 0x03, 0x03, 0x03, 0x02, 0x25, 0xf7, 0xfb, 0xf2, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xe6, 0xe9, 0xd8, 0xa8, 0xaf, 0xa9, 0xab, 0xac, 0xab, 0xac, 0xad, 0xad, 0xad, 0xad, 0x9b, 0xdb, 0x2b, 0x06, 0x03, 0x05, 0x05, 0x1a, 0x2b, 0xce, 0xc4, 0x18, 0x02, 0x0a, 0x13, 0x0b, 0x0b, 0x14, 0x14, 0x0d, 0x11, 0x10, 0x06, 0x18, 0xc4, 0xcf, 0xca, 0xd5, 0xcd, 0xa7, 0x94, 0x94, 0x9f, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x99, 0xa1, 0x99, 0xa1, 0x9c, 0x9f, 0x9c, 0x99, 0x9c, 0x9f, 0xa1, 0x9c, 0x9a, 0x9f, 0x9f, 0x9f, 0x9c, 0xa1, 0xa8, 0x80, 0x66, 0x3d, 0x3c, 0x3d, 0x3d, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x3c, 0x3d, 0x3c, 0x37, 0x6e, 0x8a, 0xa7, 0x9c, 0x9c, 0x9c, 0xa2, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9c, 0x95, 0x9f, 0x9c, 0x9c, 0xcd, 0xcd, 0xca, 0xcf, 0x6a, 0x18, 0x05, 0x0f, 0x11, 0x14, 0x11, 0x11, 0x0d, 0x0d, 0x11, 0x12, 0x0f, 0x06, 0x60, 0x6a, 0xc1, 0xce, 0x0c, 0x02, 0x05, 0x07, 0x01, 0x0c, 0x30, 0x6c, 0xfc, 0xed, 0xf0, 0xe4, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xe5, 0xe4, 0xe5, 0xe3, 0xe4, 0xe5, 0xe5, 0xee, 0x6c, 0xed, 0xe3, 0xe7, 0xd7, 0xa0, 0xa7, 0xad, 0xa9, 0xad, 0xab, 0xad, 0xad, 0xa9, 0xac, 0xa4, 0xd4, 0xdb, 0x29, 0x18, 0x09, 0x20, 0x6a, 0xcf, 0xce, 0x20, 0x03, 0x0b, 0x0b, 0x0f, 0x0f, 0x0d, 0x0b, 0x0f, 0x14, 0x11, 0x11, 0x10, 0x06, 0x23, 0xc7, 0xca, 0xd2, 0xd5, 0xb0, 0x8c, 0x9c, 0x99, 0x9f, 0x9c, 0x99, 0x9c, 0x99, 0x9c, 0x9f, 0x9f, 0x9f, 0x99, 0x9c, 0x9f, 0x9c, 0x9f, 0x99, 0x9c, 0x9f, 0x9a, 0x9c, 0x9f, 0x9f, 0x9e, 0xa1, 0xa7, 0x8f, 0x67, 0x38, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x37, 0x74, 0x9d, 0xa2, 0x95, 0x9e, 0x9f, 0x9c, 0xa2, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x94, 0xb0, 0xd2, 0xca, 0xcf, 0xd3, 0x1a, 0x03, 0x10, 0x11, 0x11, 0x0d, 0x12, 0x0b, 0x12, 0x12, 0x11, 0x0d, 0x10, 0x08, 0x15, 0x6a, 0xc6, 0xcc, 0x27, 0x0c, 0x01, 0x02, 0x05, 0x64, 0xf3, 0xe1, 0xe4, 0xf1, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xe4, 0xe4, 0xe4, 0xe4, 0xe3, 0xe5, 0xe3, 0x6c, 0xe4, 0x6c, 0xe1, 0xe3, 0xe9, 0xd7, 0xb1, 0xa7, 0xad, 0xad, 0xa9, 0xab, 0xad, 0xac, 0xac, 0x96, 0xc0, 0xd4, 0xd3, 0xce, 0x6a, 0xc7, 0xc6, 0xcc, 0xbc, 0x02, 0x0a, 0x0b, 0x0d, 0x0f, 0x0f, 0x0f, 0x0a, 0x13, 0x10, 0x11, 0x14, 0x14, 0x0b, 0x06, 0x27, 0xc7, 0xca, 0xd5, 0xc0, 0x88, 0xa7, 0x94, 0x9f, 0x99, 0xa1, 0x9c, 0x9c, 0x99, 0x9c, 0x9c, 0x9c, 0x9f, 0xa1, 0x99, 0xa1, 0x9f, 0xa1, 0x9c, 0x9e, 0x9c, 0x9f, 0xa2, 0x9c, 0x9e, 0x9e, 0xa0, 0xaa, 0x6f, 0x36, 0x39, 0x3d, 0x3d, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x3a, 0x34, 0x77, 0xa5, 0x9e, 0x98, 0x9e, 0x9a, 0xa2, 0x9c, 0x9c, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x9c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x95, 0x9f, 0x9c, 0x8c, 0xb7, 0xd5, 0xc5, 0xd3, 0x25, 0x06, 0x17, 0x14, 0x14, 0x0d, 0x10, 0x0f, 0x10, 0x10, 0x0d, 0x10, 0x12, 0x0b, 0x0a, 0x09, 0x60, 0xc6, 0xd0, 0xce, 0x6a, 0x29, 0x29, 0x2f, 0x6c, 0x6c, 0xe3, 0xed, 0xf0, 0xf0, 0xe4, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xe4, 0xe4, 0xee, 0xef, 0xe4, 0xe5, 0xe5, 0xe3, 0xe2, 0xe9, 0xdd, 0xb8, 0xa8, 0xab, 0xab, 0xac, 0xac, 0xac, 0xac, 0xac, 0xab, 0xd5, 0xd1, 0xbb, 0xc6, 0xc3, 0xca, 0xc7, 0x20, 0x03, 0x14, 0x0b, 0x0b, 0x0a, 0x0a, 0x0d, 0x10, 0x0f, 0x0b, 0x14, 0x14, 0x0d, 0x10, 0x0a, 0x15, 0xc7, 0xca, 0xd2, 0xc5, 0x99, 0x91, 0x9c, 0x95, 0x9c, 0x9c, 0x99, 0x99, 0x99, 0x9a, 0x9a, 0x9c, 0x95, 0x99, 0xa1, 0x99, 0xa1, 0x9f, 0x95, 0x9e, 0x98, 0x99, 0x99, 0xa2, 0x9a, 0xa9, 0x91, 0xaf, 0x74, 0x3a, 0x3b, 0x3a, 0x3a, 0x3a, 0x3d, 0x38, 0x38, 0x3a, 0x3f, 0x3b, 0x67, 0x6e, 0x9d, 0xa8, 0xa2, 0x9a, 0x9a, 0x90, 0x9a, 0x9e, 0x9e, 0xa4, 0x90, 0x9c, 0xa7, 0x99, 0xa1, 0x9c, 0xa1, 0x9e, 0x9a, 0x9c, 0xa1, 0x9f, 0x9f, 0x9f, 0x9f, 0x94, 0x9f, 0xa2, 0x8e, 0xc5, 0xd2, 0xcf, 0x29, 0x0e, 0x0a, 0x0a, 0x11, 0x14, 0x12, 0x12, 0x11, 0x0d, 0x11, 0x11, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x23, 0xd0, 0xc5, 0xc1, 0xcf, 0xe1, 0xfe, 0xfc, 0xfc, 0xee, 0x6c, 0xed, 0xfb, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xe4, 0xe4, 0xef, 0xe3, 0xe8, 0xe2, 0xd7, 0xb1, 0xa0, 0xad, 0xad, 0xad, 0xac, 0xad, 0xa4, 0xbf, 0xd6, 0xc3, 0xbb, 0xc3, 0xca, 0xc7, 0x15, 0x07, 0x0b, 0x0d, 0x0b, 0x0a, 0x0f, 0x0d, 0x0d, 0x0f, 0x0d, 0x11, 0x0d, 0x10, 0x0f, 0x0a, 0x08, 0x60, 0xcc, 0xcd, 0xd2, 0xad, 0x8c, 0xa2, 0x9c, 0x9c, 0x9c, 0x9c, 0xa1, 0x99, 0x9c, 0x95, 0x9c, 0x9c, 0xa1, 0xa1, 0x9c, 0x94, 0x9c, 0x9f, 0x95, 0xa1, 0xa8, 0xa8, 0xa8, 0xa3, 0xab, 0xa2, 0xaa, 0x76, 0x67, 0x39, 0x3d, 0x39, 0x3c, 0x3c, 0x3e, 0x40, 0x3c, 0x38, 0x3d, 0x67, 0x74, 0xa6, 0xaf, 0xa3, 0xa8, 0xab, 0xa3, 0xa2, 0x9f, 0xa1, 0x9c, 0x9c, 0x9f, 0x9a, 0xa1, 0xa1, 0xa1, 0x9f, 0x9c, 0x9f, 0x9a, 0xa0, 0xa1, 0x9f, 0x9f, 0x9f, 0x9c, 0x9f, 0x8c, 0xb1, 0xcd, 0xd0, 0xcf, 0x25, 0x0a, 0x0f, 0x0f, 0x11, 0x11, 0x10, 0x0d, 0x11, 0x0d, 0x11, 0x11, 0x0d, 0x0f, 0x0f, 0x12, 0x07, 0x20, 0xd0, 0xc5, 0xca, 0xbb, 0xdb, 0xed, 0xfb, 0xfb, 0xee, 0xed, 0xee, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xfb, 0xf0, 0xef, 0xf1, 0xe1, 0xe6, 0xe7, 0xe2, 0xd7, 0xb4, 0xaf, 0xa7, 0xa8, 0xad, 0xaf, 0xb1, 0xd7, 0xbf, 0xc3, 0xbf, 0xc6, 0xc7, 0x0c, 0x07, 0x0b, 0x11, 0x0b, 0x0a, 0x0b, 0x11, 0x0d, 0x10, 0x0d, 0x14, 0x0d, 0x0f, 0x10, 0x10, 0x07, 0x18, 0xce, 0xca, 0xd5, 0xb7, 0x94, 0x9f, 0x9c, 0x95, 0x9c, 0x95, 0x9c, 0xa1, 0x99, 0xa1, 0x99, 0x9c, 0x9c, 0x94, 0xa2, 0xa2, 0x99, 0xa3, 0xa8, 0x9d, 0x86, 0x77, 0x76, 0x75, 0x7f, 0xaa, 0xaa, 0x78, 0x66, 0x39, 0x3c, 0x3e, 0x3c, 0x3e, 0x42, 0x3e, 0x3c, 0x3c, 0x39, 0x39, 0x77, 0xdf, 0x86, 0x75, 0x75, 0x80, 0x89, 0x9d, 0xaa, 0xa5, 0xa2, 0x9c, 0x9c, 0xa1, 0x9e, 0x95, 0x9c, 0x9c, 0x9f, 0x99, 0xa0, 0x9f, 0x9f, 0x9f, 0x9e, 0x9c, 0xa4, 0x99, 0x8c, 0xbf, 0xd2, 0xca, 0xce, 0x13, 0x0a, 0x10, 0x10, 0x11, 0x11, 0x10, 0x12, 0x0d, 0x0d, 0x0d, 0x11, 0x0d, 0x0f, 0x0d, 0x10, 0x07, 0x1b, 0xd0, 0xc5, 0xd0, 0xbb, 0xd8, 0xe3, 0xf0, 0xee, 0xed, 0xe5, 0xed, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xf0, 0xf0, 0xfb, 0xfd, 0xf1, 0xfb, 0xf1, 0xe3, 0xe6, 0xea, 0xe7, 0xdc, 0xcc, 0xb4, 0xa8, 0xa5, 0xa5, 0xd6, 0xc6, 0xbf, 0xc0, 0xc6, 0xc7, 0x09, 0x08, 0x0b, 0x11, 0x0b, 0x0b, 0x10, 0x0b, 0x11, 0x0b, 0x0d, 0x0d, 0x0b, 0x0f, 0x0f, 0x0b, 0x16, 0x09, 0x27, 0xcc, 0xd2, 0xc5, 0x94, 0x9c, 0x95, 0x95, 0x9e, 0x95, 0xa1, 0xa1, 0xa0, 0xa0, 0xa1, 0x9c, 0x9c, 0x9f, 0x94, 0xa3, 0xa8, 0x9d, 0x80, 0x74, 0x6e, 0x6d, 0x34, 0x72, 0x79, 0x83, 0xae, 0x89, 0x6f, 0x36, 0x39, 0x39, 0x3c, 0x38, 0x3c, 0x3c, 0x40, 0x3c, 0x38, 0x41, 0xa6, 0x57, 0x74, 0x72, 0x72, 0x72, 0x6e, 0x73, 0x80, 0x97, 0xa8, 0xa7, 0x8e, 0x9c, 0xa4, 0x9e, 0x9a, 0x9c, 0x99, 0x99, 0xa0, 0x9f, 0x9f, 0x9c, 0x9a, 0x9c, 0x9a, 0x95, 0xab, 0xcd, 0xca, 0xd0, 0xc4, 0x0e, 0x14, 0x12, 0x0d, 0x11, 0x0d, 0x10, 0x0b, 0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x05, 0x20, 0xd0, 0xc5, 0xd0, 0xc1, 0xdb, 0xed, 0xed, 0xee, 0xee, 0xed, 0xee, 0xfb, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 
-  0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xe4, 0xe4, 0xf0, 0xfb, 0xfd, 0xfc, 0xfb, 0xfb, 0xf2, 0xed, 0xe1, 0xe8, 0xe9, 0xe9, 0xde, 0xd7, 0xb8, 0xcf, 0xd1, 0xbf, 0xc3, 0xc3, 0xce, 0x0c, 0x05, 0x0b, 0x0d, 0x0d, 0x0b, 0x0b, 0x11, 0x0d, 0x0b, 0x11, 0x0d, 0x10, 0x0a, 0x0f, 0x11, 0x0b, 0x0a, 0x20, 0xd3, 0xca, 0xd5, 0xad, 0x94, 0x95, 0x9e, 0x95, 0xa1, 0x94, 0xa1, 0x99, 0xa1, 0x99, 0x9c, 0x99, 0xa3, 0xa5, 0xa5, 0x77, 0x7b, 0x72, 0x72, 0x36, 0x3d, 0x40, 0x39, 0x72, 0x7b, 0xa6, 0x9b, 0x74, 0x72, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x34, 0x66, 0x6e, 0x76, 0xae, 0xa6, 0x66, 0x40, 0x39, 0x39, 0x67, 0x34, 0x72, 0x72, 0x76, 0x97, 0xaf, 0xa3, 0x99, 0x9a, 0x95, 0x9a, 0x95, 0x9c, 0x99, 0x9f, 0x9f, 0x9a, 0x9f, 0x9a, 0x9a, 0x99, 0xb5, 0xd5, 0xc5, 0xcc, 0x60, 0x0a, 0x0d, 0x11, 0x0b, 0x11, 0x11, 0x0b, 0x0f, 0x0d, 0x0f, 0x0b, 0x0d, 0x0d, 0x11, 0x11, 0x0b, 0x06, 0x60, 0xd0, 0xca, 0xc3, 0xcc, 0xe0, 0xe6, 0xed, 0xfb, 0xe3, 0xe5, 0xfb, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xe3, 0xe4, 0xe3, 0xee, 0xed, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xe3, 0xe3, 0xe2, 0xe7, 0xe2, 0xde, 0xd4, 0xbf, 0xbf, 0xca, 0xc7, 0x1b, 0x05, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0d, 0x0b, 0x0d, 0x0d, 0x0b, 0x0f, 0x0a, 0x11, 0x0d, 0x0a, 0x1a, 0xd3, 0xca, 0xd5, 0xb7, 0x94, 0x95, 0x95, 0x95, 0x95, 0x9c, 0x94, 0x99, 0xa1, 0x94, 0xa2, 0xa3, 0x9d, 0x83, 0x76, 0x6f, 0x35, 0x66, 0x66, 0x38, 0x37, 0x38, 0x35, 0x35, 0x79, 0xaf, 0xb4, 0xb5, 0x9d, 0x86, 0x75, 0x7b, 0x73, 0x79, 0x7b, 0x7b, 0x74, 0x89, 0xb3, 0xb3, 0x71, 0x66, 0x39, 0x40, 0x35, 0x3d, 0x67, 0x34, 0x66, 0x6d, 0x74, 0x76, 0x8a, 0xa5, 0xa3, 0xa2, 0x95, 0x95, 0xa1, 0x9c, 0x9f, 0x9c, 0x9f, 0xa4, 0x95, 0x9f, 0x95, 0xcd, 0xcd, 0xc5, 0xcc, 0x23, 0x0b, 0x0d, 0x11, 0x0d, 0x11, 0x0d, 0x10, 0x0b, 0x0d, 0x0d, 0x0f, 0x0d, 0x0d, 0x14, 0x11, 0x0a, 0x4e, 0xbc, 0xd0, 0xca, 0xbf, 0xd7, 0xe2, 0xe1, 0xed, 0xe5, 0xee, 0xee, 0xfb, 0xf0, 0xee, 0xe4, 0xee, 0xef, 0xee, 0xed, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 
-  0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe5, 0xe3, 0xe3, 0xe3, 0xe5, 0xe5, 0xee, 0xe5, 0xed, 0x6c, 0xed, 0xfb, 0xfb, 0xfb, 0xe3, 0xe5, 0xe3, 0xe3, 0xe7, 0xdd, 0xc3, 0xbf, 0xc6, 0xcf, 0x60, 0x02, 0x13, 0x07, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0d, 0x0d, 0x0a, 0x0f, 0x0d, 0x11, 0x11, 0x0a, 0x1a, 0xce, 0xd1, 0xd1, 0xca, 0x94, 0xa4, 0x95, 0x9c, 0x99, 0x99, 0xa3, 0x99, 0xa3, 0xa3, 0x8a, 0x7c, 0x79, 0x6e, 0x6d, 0x49, 0x4b, 0x34, 0x67, 0x34, 0x38, 0x3c, 0x39, 0x3b, 0x79, 0xb3, 0xb9, 0xb5, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbb, 0xb7, 0xbf, 0xbf, 0xb9, 0xb4, 0xb1, 0x86, 0x66, 0x39, 0x39, 0x3d, 0x36, 0x66, 0x41, 0x34, 0x4b, 0x39, 0x6d, 0x72, 0x74, 0x8a, 0x9b, 0xa0, 0xa7, 0x94, 0x9c, 0x95, 0xa2, 0x9c, 0x94, 0x9a, 0x94, 0xb2, 0xd2, 0xcd, 0xca, 0xcf, 0x20, 0x0b, 0x14, 0x0d, 0x0d, 0x11, 0x0d, 0x10, 0x10, 0x0d, 0x0f, 0x0d, 0x0f, 0x11, 0x11, 0x0d, 0x0e, 0x0c, 0xc7, 0xc3, 0xc3, 0xcc, 0xde, 0xea, 0xf5, 0xf4, 0xe5, 0xe5, 0xe4, 0xfb, 0xed, 0xfb, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xe3, 0xe3, 0xe5, 0xe3, 0xe3, 0xed, 0xe3, 0xee, 0xe3, 0xfc, 0xf3, 0xf4, 0xf4, 0xea, 0xf6, 0xec, 0xe8, 0xea, 0xcf, 0xbb, 0xc3, 0xd0, 0xce, 0x0c, 0x08, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0d, 0x0d, 0x0b, 0x0f, 0x10, 0x11, 0x14, 0x0a, 0x15, 0xce, 0xd1, 0xd1, 0xd5, 0xb0, 0x94, 0x94, 0x99, 0xa0, 0x9b, 0x92, 0xa5, 0x8d, 0x7d, 0x79, 0x72, 0x6e, 0x3b, 0x35, 0x48, 0x50, 0x36, 0x37, 0x37, 0x38, 0x38, 0x39, 0x67, 0x7b, 0xb4, 0xb9, 0xb5, 0xb5, 0xb5, 0xb7, 0xb5, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb7, 0xb5, 0xb7, 0x77, 0x6e, 0x3d, 0x36, 0x3f, 0x35, 0x41, 0x34, 0x68, 0x4b, 0x34, 0x3a, 0x3b, 0x6d, 0x72, 0x7b, 0x8a, 0xa8, 0xa0, 0xa0, 0xa2, 0xa2, 0x9c, 0x9c, 0x9f, 0x99, 0xc5, 0xd5, 0xca, 0xcd, 0xcf, 0x23, 0x0a, 0x14, 0x0b, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b, 0x0d, 0x0d, 0x0b, 0x0f, 0x0b, 0x0d, 0x10, 0x01, 0x5d, 0xc6, 0xca, 0xc3, 0xd7, 0xeb, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf4, 0xf3, 0xf3, 0xf2, 0xef, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfc, 0xe5, 0xee, 0xe3, 0xed, 0xf2, 0xe5, 0xf3, 0xf4, 0xf5, 0xf5, 0xfe, 0xf5, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6, 0xeb, 0xe0, 0xc1, 0xbf, 0xca, 0xc7, 0x60, 0x02, 0x08, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0f, 0x0b, 0x0d, 0x10, 0x0a, 0x0b, 0x14, 0x0b, 0x0a, 0x18, 0xd3, 0xcf, 0xd5, 0xca, 0xd1, 0x88, 0x9c, 0x92, 0xa3, 0xa5, 0x8d, 0xa6, 0x79, 0x72, 0x66, 0x67, 0x36, 0x35, 0x3d, 0x6d, 0x4b, 0x4b, 0x34, 0x3b, 0x39, 0x37, 0x37, 0x66, 0x74, 0xbb, 0xb5, 0xba, 0xb5, 0xb5, 0xb9, 0xb7, 0xb9, 0xb7, 0xb9, 0xb7, 0xb9, 0xb5, 0xb5, 0xb7, 0x97, 0x66, 0x39, 0x38, 0x67, 0x66, 0x34, 0x46, 0x50, 0x34, 0x37, 0x36, 0x34, 0x35, 0x66, 0x6e, 0x74, 0x80, 0x8d, 0xa5, 0xa7, 0x99, 0x99, 0x9c, 0x8e, 0xb2, 0xd5, 0xd2, 0xca, 0xca, 0xcf, 0x23, 0x0a, 0x0d, 0x0a, 0x0f, 0x0d, 0x0b, 0x10, 0x0b, 0x11, 0x0d, 0x0b, 0x0a, 0x0a, 0x10, 0x07, 0x50, 0xc7, 0xc6, 0xca, 0xc6, 0xe7, 0xeb, 0xf4, 0xfe, 0xfe, 0xf6, 0xf5, 0xf5, 0xf6, 0xfe, 0xf5, 0xf4, 0xf3, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xfb, 0xfb, 0xfd, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xfe, 0xf5, 0xf5, 0xe8, 0xf6, 0xf5, 0xfe, 0xf6, 0xeb, 0xeb, 0xd7, 0xc0, 0xca, 0xc6, 0x2b, 0x18, 0x05, 0x0b, 0x0a, 0x0d, 0x0b, 0x0a, 0x0a, 0x0d, 0x0d, 0x0d, 0x10, 0x0b, 0x14, 0x0b, 0x08, 0x20, 0xd3, 0xd1, 0xd1, 0xd1, 0xd5, 0xad, 0x8e, 0xa3, 0x85, 0x7c, 0x79, 0x77, 0x68, 0x35, 0x35, 0x40, 0x39, 0x40, 0x36, 0x67, 0x34, 0x57, 0x43, 0x35, 0x35, 0x39, 0x36, 0x6d, 0xae, 0xbb, 0xb5, 0xba, 0xb5, 0xb5, 0xb9, 0xb5, 0xb5, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb3, 0x6f, 0x36, 0x39, 0x36, 0x66, 0x34, 0x50, 0x49, 0x35, 0x34, 0x35, 0x43, 0x39, 0x35, 0x46, 0x4b, 0x6d, 0x79, 0x75, 0x88, 0xa3, 0xa2, 0x8e, 0x8e, 0xd2, 0xd5, 0xca, 0xd1, 0xca, 0xcf, 0xc4, 0x0e, 0x0b, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0d, 0x14, 0x0b, 0x0a, 0x0a, 0x0a, 0x05, 0x23, 0xcc, 0xc3, 0xc3, 0xdd, 0xeb, 0xf4, 0xfe, 0xfe, 0xfe, 0xf4, 0xf5, 0xea, 0xf5, 0xf6, 0xfe, 0xf5, 0xf5, 0xf4, 0xf5, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf3, 0xf4, 0xf4, 0xfe, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfe, 0xf5, 0xf5, 0xeb, 0xe9, 0xd1, 0xc5, 0xc6, 0xcf, 0x27, 0x0c, 0x06, 0x0a, 0x0b, 0x0b, 0x0d, 0x08, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x10, 0x0a, 0x09, 0x27, 0xd7, 0xca, 0xca, 0xd5, 0xd1, 0xbf, 0x8a, 0x80, 0x79, 0x6e, 0x6d, 0x46, 0x4b, 0x35, 0x39, 0x39, 0x36, 0x39, 0x36, 0x3b, 0x34, 0x50, 0x4b, 0x39, 0x35, 0x3b, 0x6d, 0x6e, 0xb4, 0xbb, 0xb5, 0xb5, 0xb9, 0xb9, 0xb5, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb2, 0xb0, 0xad, 0xc6, 0x78, 0x34, 0x37, 0x3b, 0x35, 0x49, 0x4d, 0x35, 0x35, 0x3b, 0x36, 0x36, 0x35, 0x36, 0x4b, 0x43, 0x34, 0x67, 0x72, 0x79, 0x83, 0x97, 0x8b, 0xb1, 0xd6, 0xd5, 0xcd, 0xcd, 0xd1, 0xcf, 0xce, 0x15, 0x06, 0x12, 0x07, 0x0d, 0x0d, 0x0f, 0x0a, 0x0b, 0x11, 0x0d, 0x0b, 0x0e, 0x03, 0x1b, 0xc4, 0xc3, 0xc3, 0xd6, 0xeb, 0xeb, 0xf4, 0xf6, 0xfe, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xfe, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf4, 0xf4, 0xf2, 0xfb, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xfb, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xee, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xea, 0xd0, 0xc6, 0xc6, 0xcf, 0xbc, 0x0c, 0x02, 0x10, 0x14, 0x11, 0x0f, 0x0b, 0x0b, 0x0d, 0x14, 0x12, 0x0e, 0x02, 0x27, 0xce, 0xcf, 0xd5, 0xd4, 0xca, 0xd1, 0xd6, 0xae, 0x6d, 0x41, 0x35, 0x45, 0x34, 0x4d, 0x46, 0x35, 0x39, 0x39, 0x36, 0x39, 0x36, 0x36, 0x49, 0x50, 0x34, 0x41, 0x72, 0x73, 0x89, 0xb4, 0xb4, 0xb2, 0xb5, 0xb2, 0xb5, 0xb5, 0xb7, 0xb9, 0xb7, 0xb9, 0xbf, 0xc5, 0xca, 0xd2, 0xda, 0xd9, 0xdd, 0x77, 0x6d, 0x43, 0x34, 0x50, 0x3b, 0x35, 0x37, 0x36, 0x3d, 0x34, 0x37, 0x46, 0x4b, 0x36, 0x3d, 0x37, 0x36, 0x3b, 0x72, 0x75, 0xc1, 0xd6, 0xd6, 0xd2, 0xca, 0xd2, 0xca, 0xca, 0xd3, 0xc4, 0x09, 0x07, 0x12, 0x11, 0x0d, 0x0d, 0x0f, 0x0f, 0x11, 0x0d, 0x07, 0x06, 0x5d, 0xc7, 0xc6, 0xbf, 0xd8, 0xea, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xfe, 0xf6, 0xfe, 0xf6, 0xfe, 0xf6, 0xf5, 0xf4, 0xf3, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf2, 0xf5, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xec, 0xe2, 0xd7, 0xc3, 0xd0, 0xc6, 0xbc, 0x57, 0x02, 0x0a, 0x0b, 0x0d, 0x11, 0x17, 0x14, 0x10, 0x07, 0x06, 0x20, 0xce, 0xd3, 0xd1, 0xd1, 0xd1, 0xd4, 0xd0, 0xd7, 0xe6, 0x75, 0x72, 0x39, 0x35, 0x37, 0x46, 0x4d, 0x34, 0x35, 0x37, 0x39, 0x36, 0x39, 0x36, 0x3d, 0x69, 0x34, 0x6d, 0x72, 0xae, 0xd7, 0xd9, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd6, 0xda, 0xd9, 0xd8, 0x78, 0x6d, 0x43, 0x50, 0x36, 0x35, 0x39, 0x37, 0x39, 0x37, 0x36, 0x4b, 0x49, 0x34, 0x3f, 0x36, 0x3b, 0x67, 0x6d, 0xb6, 0xec, 0xdd, 0xcf, 0xd5, 0xd5, 0xcd, 0xd1, 0xd1, 0xcf, 0xce, 0x23, 0x06, 0x07, 0x0d, 0x14, 0x14, 0x14, 0x0d, 0x0b, 0x07, 0x0c, 0x5d, 0xc6, 0xc6, 0xbb, 0xd7, 0xea, 0xf8, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfe, 0xf5, 0xf5, 0xf4, 0xf4, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 
-  0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xf0, 0xee, 0xe4, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xf0, 0xe4, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xe4, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xf3, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf4, 0xeb, 0xdc, 0xd0, 0xc6, 0xcc, 0xc7, 0x5d, 0x0c, 0x06, 0x0a, 0x07, 0x07, 0x06, 0x0e, 0x15, 0x27, 0xce, 0xd0, 0xc6, 0xd0, 0xd1, 0xd4, 0xcf, 0xd7, 0xeb, 0xeb, 0xed, 0x68, 0x34, 0x3b, 0x35, 0x3b, 0x50, 0x46, 0x35, 0x35, 0x35, 0x39, 0x35, 0x39, 0x34, 0x78, 0x78, 0xa6, 0xdb, 0xdb, 0xdc, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd8, 0xdd, 0x5d, 0x70, 0x50, 0x34, 0x39, 0x36, 0x3b, 0x34, 0x3b, 0x67, 0x50, 0x67, 0x39, 0x67, 0x3b, 0x67, 0x6d, 0x60, 0xf9, 0xea, 0xeb, 0xdd, 0xd7, 0xcf, 0xd4, 0xd1, 0xca, 0xcd, 0xcf, 0xd3, 0x27, 0x15, 0x06, 0x07, 0x07, 0x07, 0x07, 0x09, 0x57, 0xc4, 0xc6, 0xc3, 0xc6, 0xdb, 0xff, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfe, 0xf6, 0xfe, 0xf6, 0xfe, 0xf6, 0xf6, 0xf6, 0xfe, 0xf6, 0xf5, 0xf3, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 
-  0xee, 0xef, 0xed, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xe4, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xf0, 0xf0, 0xe4, 0xef, 0xe4, 0xfb, 0xe4, 0xef, 0xf0, 0xe4, 0xef, 0xe4, 0xfb, 0xe4, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xf0, 0xf0, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xf0, 0xef, 0xef, 0xed, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xf4, 0xf5, 0xf5, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfe, 0xf6, 0xf5, 0xeb, 0xe9, 0xd4, 0xcc, 0xc7, 0xd3, 0xc1, 0x60, 0x1b, 0x1b, 0x1b, 0x60, 0x27, 0xc7, 0xd3, 0xcf, 0xd0, 0xd1, 0xd0, 0xd0, 0xcf, 0xdd, 0xe9, 0xf6, 0xf4, 0xf9, 0x65, 0x70, 0x35, 0x34, 0x3b, 0x43, 0x69, 0x67, 0x35, 0x3b, 0x35, 0x39, 0x34, 0x6d, 0x78, 0xe5, 0xec, 0xe3, 0xe0, 0xdb, 0xd8, 0xd9, 0xdc, 0xd9, 0xdc, 0xd9, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xd9, 0xdc, 0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xdc, 0xdc, 0xe0, 0xe1, 0x23, 0x34, 0x34, 0x35, 0x67, 0x35, 0x36, 0x70, 0x4b, 0x34, 0x43, 0x3b, 0x35, 0x34, 0x57, 0xea, 0xff, 0xf6, 0xea, 0xf8, 0xe2, 0xdc, 0xd4, 0xd4, 0xd1, 0xd1, 0xc6, 0xcc, 0xce, 0x6a, 0xc4, 0x60, 0x20, 0x5d, 0x23, 0xbc, 0xcc, 0xd0, 0xc6, 0xcc, 0xe0, 0xf8, 0xf7, 0xf4, 0xeb, 0xea, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf3, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 
-  0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xfb, 0xef, 0xfb, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xe4, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xf3, 0xf4, 0xf5, 0xf6, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf6, 0xf4, 0xeb, 0xff, 0xe0, 0xd7, 0xcc, 0xc6, 0xd0, 0xd0, 0xd4, 0xd0, 0xd0, 0xd4, 0xd0, 0xd0, 0xc6, 0xcf, 0xc6, 0xd4, 0xd7, 0xe7, 0xeb, 0xf5, 0xf7, 0xfe, 0xf4, 0xf9, 0xf6, 0x60, 0x46, 0x6d, 0x6d, 0x04, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x68, 0x60, 0xf2, 0xec, 0xf5, 0xea, 0xeb, 0xe9, 0xe7, 0xde, 0xe0, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdc, 0xdc, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xe7, 0xe9, 0xeb, 0xff, 0x2b, 0x4b, 0x6d, 0x6d, 0x6d, 0x46, 0x04, 0x34, 0x6d, 0x34, 0x6d, 0x34, 0x5d, 0xec, 0xff, 0xf4, 0xfe, 0xfe, 0xf5, 0xf5, 0xea, 0xde, 0xd8, 0xd4, 0xd1, 0xcf, 0xd1, 0xd0, 0xd0, 0xc6, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xc3, 0xcc, 0xd8, 0xe8, 0xf8, 0xfe, 0xf4, 0xeb, 0xea, 0xeb, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf3, 0xed, 0xef, 0xf2, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 
-  0xef, 0xed, 0xef, 0xed, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xef, 0xf0, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xee, 0xef, 0xed, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xf2, 0xf3, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xfe, 0xf6, 0xf6, 0xf5, 0xeb, 0xeb, 0xeb, 0xe0, 0xd8, 0xd3, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xd4, 0xd7, 0xe0, 0xe2, 0xe9, 0xeb, 0xea, 0xf5, 0xf7, 0xfe, 0xfe, 0xf5, 0xff, 0xf9, 0x6c, 0x60, 0x78, 0x4d, 0x5d, 0x57, 0x1b, 0x27, 0x64, 0xf4, 0xf9, 0xff, 0xf6, 0xf6, 0xf6, 0xf5, 0xeb, 0xea, 0xeb, 0xea, 0xeb, 0xe9, 0xe8, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xea, 0xf5, 0xeb, 0xeb, 0xeb, 0xea, 0xe8, 0xf5, 0xf9, 0xf4, 0x6a, 0x57, 0x70, 0x04, 0x4d, 0x68, 0x4d, 0x78, 0x57, 0x64, 0xec, 0xeb, 0xf6, 0xfe, 0xfe, 0xfe, 0xfe, 0xf4, 0xeb, 0xeb, 0xe7, 0xe2, 0xdd, 0xd7, 0xd4, 0xcf, 0xd0, 0xd0, 0xd0, 0xca, 0xd0, 0xd0, 0xd6, 0xdc, 0xe9, 0xf7, 0xfe, 0xf5, 0xeb, 0xeb, 0xeb, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf3, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xee, 0xef, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfb, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xe4, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xee, 0xef, 0xed, 0xef, 0xee, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf2, 0xef, 0xef, 0xf3, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0x33, 0xfe, 0xfe, 0xf6, 0xea, 0xeb, 0xea, 0xe8, 0xf8, 0xfe, 0xe8, 0xe1, 0xe0, 0xdd, 0xdd, 0xdd, 0xe0, 0xe7, 0xea, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xf5, 0xf5, 0xfe, 0xfe, 0xfe, 0xf6, 0xf5, 0xf6, 0xff, 0xf9, 0xf9, 0xf6, 0xf4, 0xec, 0xf9, 0xf9, 0xff, 0xff, 0x33, 0xfe, 0xfe, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf6, 0xf6, 0xeb, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xff, 0xeb, 0xfe, 0xfe, 0xfe, 0xfe, 0xf5, 0xf5, 0xeb, 0xf5, 0xeb, 0x6c, 0xff, 0xec, 0xf9, 0xff, 0xf6, 0x6c, 0xfc, 0xf6, 0xf9, 0xf9, 0xf9, 0xf6, 0xf6, 0xeb, 0xf6, 0xfe, 0xfe, 0xfe, 0xf5, 0xf4, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xe6, 0xde, 0xdd, 0xdb, 0xdd, 0xdd, 0xe2, 0xe2, 0xe9, 0xeb, 0xf7, 0xf4, 0xf7, 0xe9, 0xe9, 0xea, 0xf5, 0x33, 0xfe, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xfe, 0xf6, 0xff, 0xf5, 0xf0, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xf2, 0xee, 0xed, 0xef, 0xf2, 0xf3, 0xf3, 0xf4, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfe, 0xfe, 0xfe, 0xeb, 0xea, 0xea, 0xea, 0xe8, 0xfe, 0xf7, 0xfe, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xeb, 0xf6, 0xe8, 0xf5, 0xeb, 0xf6, 0xe8, 0xf4, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xeb, 0xf4, 0xff, 0xff, 0xf4, 0xf6, 0xff, 0xfe, 0xf5, 0xfe, 0xfe, 0xfe, 0xf6, 0xf6, 0xea, 0xf5, 0xf6, 0xf5, 0xf6, 0xfe, 0xf5, 0xf5, 0xfe, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfe, 0xf5, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf3, 0xf5, 0xec, 0xf6, 0xf6, 0xf4, 0xff, 0xf6, 0xf6, 0xec, 0xff, 0xf6, 0xf4, 0xff, 0xf5, 0xeb, 0xf5, 0xf5, 0xf5, 0xf5, 0xfe, 0xf5, 0xf5, 0xf4, 0xe8, 0xf6, 0xea, 0xf5, 0xf6, 0xf6, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xfe, 0xf7, 0xfe, 0xfe, 0xf6, 0xea, 0xe9, 0xea, 0xea, 0xfe, 0x33, 0xfe, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xfe, 0xf6, 0xfe, 0xf6, 0xf5, 0xf4, 0xf2, 0xfb, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xf3, 0xf3, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xfe, 0xf5, 0xf5, 0xfe, 0xf5, 0xf5, 0xf6, 0xf5, 0xf4, 0xfe, 0xf6, 0xfe, 0xf6, 0xf4, 0xfe, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xeb, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xeb, 0xf5, 0xf6, 0xf5, 0xf4, 0xf6, 0xf5, 0xf4, 0xfe, 0xf5, 0xf5, 0xeb, 0xf5, 0xea, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xeb, 0xeb, 0xf5, 0xf6, 0xfe, 0xf6, 0xf7, 0xf3, 0xf5, 0xeb, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf6, 0xeb, 0xf5, 0xeb, 0xf4, 0xf5, 0xf6, 0xfe, 0xfe, 0xf4, 0xf6, 0xf6, 0xf6, 0xfe, 0xf5, 0xfe, 0xfe, 0xfe, 0xf5, 0xf4, 0xfe, 0xf7, 0xf5, 0xe8, 0xec, 0xeb, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xf6, 0xf5, 0xf5, 0xf3, 0xf3, 0xf0, 0xfb, 0xed, 0xf0, 0xf0, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf3, 0xf2, 0xf3, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xea, 0xea, 0xf5, 0xfe, 0xfe, 0x33, 0xfe, 0xfe, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf5, 0xf6, 0xf4, 0xfe, 0xf6, 0xfe, 0xfe, 0xf5, 0xfe, 0xf5, 0xf5, 0xf6, 0xeb, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xea, 0xf5, 0xea, 0xf5, 0xeb, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xea, 0xea, 0xea, 0xf6, 0xf6, 0xf6, 0xfe, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf4, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xea, 0xf5, 0xeb, 0xf4, 0xf5, 0xfe, 0xf4, 0xff, 0xf4, 0xf6, 0xf4, 0xf5, 0xfe, 0xf6, 0xf5, 0xea, 0xea, 0xeb, 0xf6, 0xf6, 0xeb, 0xeb, 0xf4, 0xfe, 0x33, 0xfe, 0xf6, 0xea, 0xea, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf3, 0xf0, 0xef, 0xf0, 0xf2, 0xf2, 0xf0, 0xf0, 0xf0, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xe4, 0xf0, 0xf0, 0xee, 0xe4, 0xfb, 0xe4, 0xef, 0xe4, 0xf0, 0xee, 0xe4, 0xfb, 0xe4, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xe4, 0xfb, 0xe4, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xe4, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xf0, 0xed, 0xfb, 0xef, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xfe, 0xf5, 0xf4, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf6, 0xf5, 0xf6, 0xf6, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xfe, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf3, 0xf3, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xfb, 0xef, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xfb, 0xf0, 0xfb, 0xe4, 0xef, 0xed, 0xef, 0xee, 0xef, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xfb, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xfb, 0xef, 0xef, 0xf0, 0xfb, 0xef, 0xef, 0xef, 0xef, 0xfb, 0xef, 0xef, 0xf0, 0xf2, 0xef, 0xef, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xff, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf3, 0xf2, 0xf2, 0xef, 0xef, 0xef, 0xed, 0xf0, 0xef, 0xfb, 0xef, 0xf0, 0xef, 0xef, 0xef, 0xfb, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xef, 0xef, 0xef, 0xef, 0xed, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xe4, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xed, 0xe4, 0xf0, 0xf0, 0xef, 0xee, 0xed, 0xef, 0xed, 0xe4, 0xf0, 0xef, 0xee, 0xed, 0xef, 0xed, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xed, 0xef, 0xed, 0xf2, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xf0, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xfb, 0xef, 0xef, 0xef, 0xfb, 0xef, 0xef, 0xf0, 0xf0, 0xef, 0xf0, 0xfb, 0xef, 0xef, 0xee, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xef, 0xef, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xee, 0xef, 0xef, 0xef, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xf0, 0xee, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 
-  0xef, 0xed, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xe4, 0xfb, 0xe4, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xfb, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xef, 0xef, 0xfb, 0xef, 0xee, 0xef, 0xef, 0xf2, 0xf2, 0xee, 0xed, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xf2, 0xef, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf3, 0xf2, 0xef, 0xf2, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xf2, 0xed, 0xef, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 
-  0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xe4, 0xef, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfb, 0xed, 0xfb, 0xee, 0xee, 0xef, 0xf2, 0xee, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xf2, 0xef, 0xf2, 0xee, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf5, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xee, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf2, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 
-  0xef, 0xed, 0xee, 0xe4, 0xfb, 0xe4, 0xef, 0xe4, 0xee, 0xe4, 0xee, 0xef, 0xee, 0xef, 0xfb, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xe4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf2, 0xef, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xf2, 0xee, 0xef, 0xee, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xee, 0xf2, 0xef, 0xef, 0xee, 0xee, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xf2, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 
-  0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xee, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xed, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xef, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xee, 0xef, 0xee, 0xef, 
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xee, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xee, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 
-  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xed, 0xee, 0xef, 0xed, 0xef, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 
-  0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xe4, 0xef, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xe4, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xe4, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xef, 0xef, 0xee, 0xef, 0xef, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xed, 0xef, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 0xee, 0xed, 0xef, 
-};
-
-const lv_img_dsc_t image8 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image8_map,
-};
@@ -1,502 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMAGE9
-#define LV_ATTRIBUTE_IMG_IMAGE9
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMAGE9 uint8_t image9_map[] = {
-  0xc7, 0xcc, 0xfa, 0xff, 	/*Color of index 0*/
-  0xb5, 0xba, 0xef, 0xff, 	/*Color of index 1*/
-  0xa6, 0xb5, 0xf8, 0xff, 	/*Color of index 2*/
-  0xa3, 0xb4, 0xe8, 0xff, 	/*Color of index 3*/
-  0x9d, 0xa6, 0xf9, 0xff, 	/*Color of index 4*/
-  0x8d, 0xa4, 0xf9, 0xff, 	/*Color of index 5*/
-  0x98, 0xa6, 0xe7, 0xff, 	/*Color of index 6*/
-  0xaf, 0x9b, 0xec, 0xff, 	/*Color of index 7*/
-  0x79, 0x98, 0xfb, 0xff, 	/*Color of index 8*/
-  0x92, 0x92, 0xfb, 0xff, 	/*Color of index 9*/
-  0x8c, 0x94, 0xf4, 0xff, 	/*Color of index 10*/
-  0x8b, 0x92, 0xfa, 0xff, 	/*Color of index 11*/
-  0x83, 0x92, 0xfb, 0xff, 	/*Color of index 12*/
-  0x89, 0x98, 0xdf, 0xff, 	/*Color of index 13*/
-  0x8b, 0x94, 0xeb, 0xff, 	/*Color of index 14*/
-  0x6a, 0x8f, 0xf9, 0xff, 	/*Color of index 15*/
-  0x8a, 0x89, 0xfb, 0xff, 	/*Color of index 16*/
-  0x84, 0x8a, 0xf7, 0xff, 	/*Color of index 17*/
-  0x76, 0x89, 0xfa, 0xff, 	/*Color of index 18*/
-  0x88, 0x87, 0xf5, 0xff, 	/*Color of index 19*/
-  0x85, 0x94, 0xc7, 0xff, 	/*Color of index 20*/
-  0x85, 0x84, 0xf8, 0xff, 	/*Color of index 21*/
-  0x79, 0x81, 0xf2, 0xff, 	/*Color of index 22*/
-  0x65, 0x80, 0xf0, 0xff, 	/*Color of index 23*/
-  0x72, 0x79, 0xe9, 0xff, 	/*Color of index 24*/
-  0x55, 0x7b, 0xeb, 0xff, 	/*Color of index 25*/
-  0x6a, 0x75, 0xed, 0xff, 	/*Color of index 26*/
-  0x6f, 0x80, 0xc4, 0xff, 	/*Color of index 27*/
-  0x47, 0x73, 0xe7, 0xff, 	/*Color of index 28*/
-  0x65, 0x6c, 0xe2, 0xff, 	/*Color of index 29*/
-  0x56, 0x6e, 0xdf, 0xff, 	/*Color of index 30*/
-  0x3b, 0x6a, 0xeb, 0xff, 	/*Color of index 31*/
-  0x46, 0x6b, 0xdc, 0xff, 	/*Color of index 32*/
-  0x54, 0x6e, 0xc5, 0xff, 	/*Color of index 33*/
-  0x42, 0x66, 0xd2, 0xff, 	/*Color of index 34*/
-  0x60, 0x6d, 0xa6, 0xff, 	/*Color of index 35*/
-  0x43, 0x62, 0xae, 0xff, 	/*Color of index 36*/
-  0x2c, 0x4a, 0xb0, 0xff, 	/*Color of index 37*/
-  0x0b, 0x3f, 0xb9, 0xff, 	/*Color of index 38*/
-  0x27, 0x44, 0x90, 0xff, 	/*Color of index 39*/
-  0x27, 0x33, 0xb5, 0xff, 	/*Color of index 40*/
-  0x27, 0x35, 0xa7, 0xff, 	/*Color of index 41*/
-  0x1a, 0x2e, 0x86, 0xff, 	/*Color of index 42*/
-  0x12, 0x26, 0x5f, 0xff, 	/*Color of index 43*/
-  0x08, 0x17, 0x48, 0xff, 	/*Color of index 44*/
-  0x18, 0x19, 0x21, 0xff, 	/*Color of index 45*/
-  0x12, 0x0e, 0x1f, 0xff, 	/*Color of index 46*/
-  0x01, 0x0a, 0x2f, 0xff, 	/*Color of index 47*/
-  0x02, 0x08, 0x22, 0xff, 	/*Color of index 48*/
-  0x0a, 0x0a, 0x16, 0xff, 	/*Color of index 49*/
-  0x01, 0x01, 0x17, 0xff, 	/*Color of index 50*/
-  0x02, 0x01, 0x0b, 0xff, 	/*Color of index 51*/
-  0xe5, 0xfa, 0xfd, 0xff, 	/*Color of index 52*/
-  0xe1, 0xf3, 0xfc, 0xff, 	/*Color of index 53*/
-  0xd3, 0xf2, 0xfc, 0xff, 	/*Color of index 54*/
-  0xd9, 0xef, 0xfb, 0xff, 	/*Color of index 55*/
-  0xca, 0xef, 0xfc, 0xff, 	/*Color of index 56*/
-  0xd8, 0xed, 0xf3, 0xff, 	/*Color of index 57*/
-  0xcf, 0xeb, 0xfb, 0xff, 	/*Color of index 58*/
-  0xc5, 0xea, 0xfd, 0xff, 	/*Color of index 59*/
-  0xd2, 0xeb, 0xf5, 0xff, 	/*Color of index 60*/
-  0xcd, 0xea, 0xfa, 0xff, 	/*Color of index 61*/
-  0xc6, 0xec, 0xf5, 0xff, 	/*Color of index 62*/
-  0xba, 0xea, 0xfe, 0xff, 	/*Color of index 63*/
-  0xcf, 0xe7, 0xfd, 0xff, 	/*Color of index 64*/
-  0xcb, 0xe8, 0xf5, 0xff, 	/*Color of index 65*/
-  0xc9, 0xe5, 0xfb, 0xff, 	/*Color of index 66*/
-  0xb2, 0xe4, 0xfe, 0xff, 	/*Color of index 67*/
-  0xd4, 0xe5, 0xeb, 0xff, 	/*Color of index 68*/
-  0xc5, 0xe1, 0xf9, 0xff, 	/*Color of index 69*/
-  0xc9, 0xe1, 0xea, 0xff, 	/*Color of index 70*/
-  0xa8, 0xdc, 0xfc, 0xff, 	/*Color of index 71*/
-  0xbd, 0xd8, 0xf1, 0xff, 	/*Color of index 72*/
-  0xc6, 0xda, 0xe5, 0xff, 	/*Color of index 73*/
-  0x93, 0xd3, 0xfb, 0xff, 	/*Color of index 74*/
-  0xa0, 0xd2, 0xf8, 0xff, 	/*Color of index 75*/
-  0xb6, 0xcb, 0xf7, 0xff, 	/*Color of index 76*/
-  0xc7, 0xd1, 0xd9, 0xff, 	/*Color of index 77*/
-  0xb8, 0xcf, 0xde, 0xff, 	/*Color of index 78*/
-  0x8d, 0xc9, 0xf4, 0xff, 	/*Color of index 79*/
-  0x7e, 0xc8, 0xf9, 0xff, 	/*Color of index 80*/
-  0xb0, 0xc5, 0xe7, 0xff, 	/*Color of index 81*/
-  0x69, 0xc3, 0xfa, 0xff, 	/*Color of index 82*/
-  0x80, 0xc2, 0xf0, 0xff, 	/*Color of index 83*/
-  0xb8, 0xc5, 0xcc, 0xff, 	/*Color of index 84*/
-  0x59, 0xbc, 0xfc, 0xff, 	/*Color of index 85*/
-  0x8f, 0xb9, 0xf2, 0xff, 	/*Color of index 86*/
-  0x78, 0xbb, 0xf0, 0xff, 	/*Color of index 87*/
-  0x81, 0xbd, 0xe4, 0xff, 	/*Color of index 88*/
-  0x6d, 0xb7, 0xfc, 0xff, 	/*Color of index 89*/
-  0x6d, 0xb6, 0xf1, 0xff, 	/*Color of index 90*/
-  0x72, 0xb7, 0xe7, 0xff, 	/*Color of index 91*/
-  0x55, 0xb4, 0xf9, 0xff, 	/*Color of index 92*/
-  0x64, 0xb2, 0xf6, 0xff, 	/*Color of index 93*/
-  0x67, 0xb5, 0xea, 0xff, 	/*Color of index 94*/
-  0x4a, 0xb2, 0xfc, 0xff, 	/*Color of index 95*/
-  0xad, 0xb9, 0xc0, 0xff, 	/*Color of index 96*/
-  0x87, 0xb5, 0xd7, 0xff, 	/*Color of index 97*/
-  0x58, 0xa9, 0xfa, 0xff, 	/*Color of index 98*/
-  0x46, 0xaa, 0xfc, 0xff, 	/*Color of index 99*/
-  0x65, 0xaa, 0xe9, 0xff, 	/*Color of index 100*/
-  0xa0, 0xaf, 0xbe, 0xff, 	/*Color of index 101*/
-  0x71, 0xac, 0xd7, 0xff, 	/*Color of index 102*/
-  0x56, 0xa8, 0xeb, 0xff, 	/*Color of index 103*/
-  0x47, 0xa6, 0xef, 0xff, 	/*Color of index 104*/
-  0x3b, 0xa3, 0xfa, 0xff, 	/*Color of index 105*/
-  0x8b, 0xa4, 0xda, 0xff, 	/*Color of index 106*/
-  0x36, 0xa2, 0xf1, 0xff, 	/*Color of index 107*/
-  0x59, 0xa3, 0xe1, 0xff, 	/*Color of index 108*/
-  0x57, 0x9a, 0xf7, 0xff, 	/*Color of index 109*/
-  0x93, 0xa5, 0xb3, 0xff, 	/*Color of index 110*/
-  0x46, 0x97, 0xfc, 0xff, 	/*Color of index 111*/
-  0x6e, 0xa2, 0xc8, 0xff, 	/*Color of index 112*/
-  0x33, 0x9a, 0xf6, 0xff, 	/*Color of index 113*/
-  0x4a, 0x9d, 0xe4, 0xff, 	/*Color of index 114*/
-  0x2b, 0x99, 0xfa, 0xff, 	/*Color of index 115*/
-  0x2c, 0x9b, 0xf2, 0xff, 	/*Color of index 116*/
-  0x23, 0x9b, 0xf3, 0xff, 	/*Color of index 117*/
-  0x22, 0x99, 0xfa, 0xff, 	/*Color of index 118*/
-  0x39, 0x96, 0xf8, 0xff, 	/*Color of index 119*/
-  0x46, 0x97, 0xee, 0xff, 	/*Color of index 120*/
-  0x53, 0x98, 0xde, 0xff, 	/*Color of index 121*/
-  0x29, 0x93, 0xfa, 0xff, 	/*Color of index 122*/
-  0x37, 0x96, 0xeb, 0xff, 	/*Color of index 123*/
-  0x1e, 0x92, 0xfd, 0xff, 	/*Color of index 124*/
-  0x32, 0x92, 0xf6, 0xff, 	/*Color of index 125*/
-  0x2b, 0x93, 0xf4, 0xff, 	/*Color of index 126*/
-  0x25, 0x90, 0xfa, 0xff, 	/*Color of index 127*/
-  0x22, 0x91, 0xf4, 0xff, 	/*Color of index 128*/
-  0x2c, 0x92, 0xec, 0xff, 	/*Color of index 129*/
-  0x3b, 0x93, 0xe3, 0xff, 	/*Color of index 130*/
-  0x22, 0x93, 0xeb, 0xff, 	/*Color of index 131*/
-  0x3c, 0x8a, 0xfd, 0xff, 	/*Color of index 132*/
-  0x54, 0x95, 0xcf, 0xff, 	/*Color of index 133*/
-  0x49, 0x8b, 0xf4, 0xff, 	/*Color of index 134*/
-  0x29, 0x8c, 0xfb, 0xff, 	/*Color of index 135*/
-  0x44, 0x92, 0xdd, 0xff, 	/*Color of index 136*/
-  0x23, 0x8d, 0xf8, 0xff, 	/*Color of index 137*/
-  0x64, 0x98, 0xbb, 0xff, 	/*Color of index 138*/
-  0x23, 0x8d, 0xf6, 0xff, 	/*Color of index 139*/
-  0x29, 0x8d, 0xf2, 0xff, 	/*Color of index 140*/
-  0x1f, 0x8b, 0xfb, 0xff, 	/*Color of index 141*/
-  0x36, 0x8d, 0xeb, 0xff, 	/*Color of index 142*/
-  0x57, 0x86, 0xf0, 0xff, 	/*Color of index 143*/
-  0x29, 0x8b, 0xea, 0xff, 	/*Color of index 144*/
-  0x37, 0x8b, 0xdf, 0xff, 	/*Color of index 145*/
-  0x25, 0x84, 0xf8, 0xff, 	/*Color of index 146*/
-  0x8c, 0x94, 0x9c, 0xff, 	/*Color of index 147*/
-  0x47, 0x81, 0xef, 0xff, 	/*Color of index 148*/
-  0x35, 0x83, 0xea, 0xff, 	/*Color of index 149*/
-  0x56, 0x8d, 0xbc, 0xff, 	/*Color of index 150*/
-  0x46, 0x85, 0xd1, 0xff, 	/*Color of index 151*/
-  0x23, 0x7d, 0xec, 0xff, 	/*Color of index 152*/
-  0x24, 0x7a, 0xf4, 0xff, 	/*Color of index 153*/
-  0x47, 0x7b, 0xe3, 0xff, 	/*Color of index 154*/
-  0x79, 0x89, 0xa0, 0xff, 	/*Color of index 155*/
-  0x37, 0x7e, 0xdb, 0xff, 	/*Color of index 156*/
-  0x2a, 0x7c, 0xdf, 0xff, 	/*Color of index 157*/
-  0x59, 0x85, 0xa9, 0xff, 	/*Color of index 158*/
-  0x1d, 0x73, 0xee, 0xff, 	/*Color of index 159*/
-  0x43, 0x7f, 0xb7, 0xff, 	/*Color of index 160*/
-  0x2c, 0x6f, 0xf2, 0xff, 	/*Color of index 161*/
-  0x7b, 0x84, 0x87, 0xff, 	/*Color of index 162*/
-  0x1f, 0x72, 0xe0, 0xff, 	/*Color of index 163*/
-  0x2e, 0x6f, 0xe3, 0xff, 	/*Color of index 164*/
-  0x30, 0x71, 0xd3, 0xff, 	/*Color of index 165*/
-  0x14, 0x6c, 0xec, 0xff, 	/*Color of index 166*/
-  0x4f, 0x7c, 0x9d, 0xff, 	/*Color of index 167*/
-  0x0f, 0x6d, 0xe2, 0xff, 	/*Color of index 168*/
-  0x1c, 0x67, 0xec, 0xff, 	/*Color of index 169*/
-  0x1e, 0x66, 0xe2, 0xff, 	/*Color of index 170*/
-  0x3c, 0x72, 0xa9, 0xff, 	/*Color of index 171*/
-  0x68, 0x76, 0x8b, 0xff, 	/*Color of index 172*/
-  0x0f, 0x63, 0xe1, 0xff, 	/*Color of index 173*/
-  0x1d, 0x65, 0xd1, 0xff, 	/*Color of index 174*/
-  0x2d, 0x5f, 0xcf, 0xff, 	/*Color of index 175*/
-  0x13, 0x59, 0xe2, 0xff, 	/*Color of index 176*/
-  0x6a, 0x70, 0x75, 0xff, 	/*Color of index 177*/
-  0x19, 0x58, 0xd9, 0xff, 	/*Color of index 178*/
-  0x42, 0x69, 0x8d, 0xff, 	/*Color of index 179*/
-  0x13, 0x55, 0xdb, 0xff, 	/*Color of index 180*/
-  0x14, 0x56, 0xd3, 0xff, 	/*Color of index 181*/
-  0x17, 0x56, 0xc7, 0xff, 	/*Color of index 182*/
-  0x21, 0x59, 0xb5, 0xff, 	/*Color of index 183*/
-  0x57, 0x67, 0x72, 0xff, 	/*Color of index 184*/
-  0x0d, 0x50, 0xcb, 0xff, 	/*Color of index 185*/
-  0x30, 0x58, 0x96, 0xff, 	/*Color of index 186*/
-  0x2f, 0x5a, 0x85, 0xff, 	/*Color of index 187*/
-  0x3a, 0x59, 0x72, 0xff, 	/*Color of index 188*/
-  0x53, 0x59, 0x5b, 0xff, 	/*Color of index 189*/
-  0x27, 0x4d, 0x73, 0xff, 	/*Color of index 190*/
-  0x41, 0x4d, 0x5a, 0xff, 	/*Color of index 191*/
-  0x1f, 0x3a, 0x71, 0xff, 	/*Color of index 192*/
-  0x21, 0x3d, 0x5c, 0xff, 	/*Color of index 193*/
-  0x39, 0x3e, 0x41, 0xff, 	/*Color of index 194*/
-  0x13, 0x31, 0x5a, 0xff, 	/*Color of index 195*/
-  0x21, 0x33, 0x44, 0xff, 	/*Color of index 196*/
-  0x12, 0x29, 0x43, 0xff, 	/*Color of index 197*/
-  0x08, 0x24, 0x47, 0xff, 	/*Color of index 198*/
-  0x22, 0x28, 0x2f, 0xff, 	/*Color of index 199*/
-  0x14, 0x1e, 0x33, 0xff, 	/*Color of index 200*/
-  0x07, 0x1a, 0x38, 0xff, 	/*Color of index 201*/
-  0x13, 0x17, 0x1d, 0xff, 	/*Color of index 202*/
-  0x02, 0x14, 0x2c, 0xff, 	/*Color of index 203*/
-  0x06, 0x11, 0x22, 0xff, 	/*Color of index 204*/
-  0x0a, 0x11, 0x18, 0xff, 	/*Color of index 205*/
-  0x01, 0x0a, 0x18, 0xff, 	/*Color of index 206*/
-  0xf1, 0xfc, 0xfb, 0xff, 	/*Color of index 207*/
-  0xe6, 0xf3, 0xf1, 0xff, 	/*Color of index 208*/
-  0x9e, 0xa5, 0xa2, 0xff, 	/*Color of index 209*/
-  0x48, 0x4e, 0x48, 0xff, 	/*Color of index 210*/
-  0x19, 0x23, 0x1d, 0xff, 	/*Color of index 211*/
-  0x13, 0x15, 0x13, 0xff, 	/*Color of index 212*/
-  0xfd, 0xfe, 0xfa, 0xff, 	/*Color of index 213*/
-  0xf6, 0xf5, 0xe4, 0xff, 	/*Color of index 214*/
-  0xe2, 0xe2, 0xdb, 0xff, 	/*Color of index 215*/
-  0xe5, 0xe1, 0xc0, 0xff, 	/*Color of index 216*/
-  0xd2, 0xd0, 0xbc, 0xff, 	/*Color of index 217*/
-  0xb7, 0xb8, 0x9e, 0xff, 	/*Color of index 218*/
-  0x99, 0x92, 0x61, 0xff, 	/*Color of index 219*/
-  0x7b, 0x7d, 0x75, 0xff, 	/*Color of index 220*/
-  0x9e, 0x86, 0x3b, 0xff, 	/*Color of index 221*/
-  0x8f, 0x7f, 0x22, 0xff, 	/*Color of index 222*/
-  0x82, 0x71, 0x2f, 0xff, 	/*Color of index 223*/
-  0x67, 0x69, 0x4e, 0xff, 	/*Color of index 224*/
-  0x6a, 0x67, 0x35, 0xff, 	/*Color of index 225*/
-  0x7e, 0x6a, 0x1e, 0xff, 	/*Color of index 226*/
-  0x5a, 0x5a, 0x34, 0xff, 	/*Color of index 227*/
-  0x68, 0x55, 0x1a, 0xff, 	/*Color of index 228*/
-  0x3e, 0x3b, 0x29, 0xff, 	/*Color of index 229*/
-  0x41, 0x35, 0x0d, 0xff, 	/*Color of index 230*/
-  0x27, 0x21, 0x1c, 0xff, 	/*Color of index 231*/
-  0x23, 0x1e, 0x13, 0xff, 	/*Color of index 232*/
-  0x31, 0x1e, 0x0d, 0xff, 	/*Color of index 233*/
-  0x1d, 0x1a, 0x15, 0xff, 	/*Color of index 234*/
-  0x22, 0x19, 0x16, 0xff, 	/*Color of index 235*/
-  0x29, 0x19, 0x13, 0xff, 	/*Color of index 236*/
-  0x24, 0x1a, 0x0e, 0xff, 	/*Color of index 237*/
-  0x1a, 0x10, 0x09, 0xff, 	/*Color of index 238*/
-  0x13, 0x09, 0x05, 0xff, 	/*Color of index 239*/
-  0x21, 0x1c, 0x1e, 0xff, 	/*Color of index 240*/
-  0x28, 0x19, 0x1b, 0xff, 	/*Color of index 241*/
-  0x1f, 0x19, 0x19, 0xff, 	/*Color of index 242*/
-  0x22, 0x18, 0x18, 0xff, 	/*Color of index 243*/
-  0x22, 0x16, 0x19, 0xff, 	/*Color of index 244*/
-  0x20, 0x16, 0x16, 0xff, 	/*Color of index 245*/
-  0x1a, 0x12, 0x12, 0xff, 	/*Color of index 246*/
-  0x17, 0x0d, 0x0d, 0xff, 	/*Color of index 247*/
-  0x14, 0x0b, 0x0b, 0xff, 	/*Color of index 248*/
-  0x0e, 0x04, 0x08, 0xff, 	/*Color of index 249*/
-  0x09, 0x02, 0x02, 0xff, 	/*Color of index 250*/
-  0x03, 0x00, 0x01, 0xff, 	/*Color of index 251*/
-  0x1d, 0x16, 0x1b, 0xff, 	/*Color of index 252*/
-  0x21, 0x14, 0x1f, 0xff, 	/*Color of index 253*/
-  0x13, 0x09, 0x10, 0xff, 	/*Color of index 254*/
-  0x09, 0x08, 0x0b, 0xff, 	/*Color of index 255*/
-
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xeb, 0xec, 0xeb, 0xf2, 0x2d, 0xfc, 0xf2, 0xf1, 0xec, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf1, 0xf2, 0xf2, 0xeb, 0xeb, 0xf5, 0xeb, 0xeb, 0xec, 0xf5, 0xeb, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xeb, 0xe9, 0xed, 0xe8, 0xf5, 0xca, 0x2d, 0xca, 0xf5, 0xec, 0xf1, 0xca, 0xca, 0x2d, 0xf4, 0xfd, 0xf2, 0xca, 0xea, 0xf1, 0xeb, 0xf0, 0xed, 0xe8, 0xed, 0xf1, 0xf3, 0xfc, 0xfc, 0xf2, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xfd, 0xfc, 0xf1, 0xec, 0xf5, 0xf0, 0xcc, 0x2d, 0xfd, 0xf1, 0xec, 0xf4, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf2, 0xca, 0xf0, 0xf7, 0x31, 0xca, 0xea, 0xed, 0xed, 0xf1, 0xf4, 0x2d, 0xf2, 0xeb, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf2, 0xfd, 0xfd, 0xfc, 0xf6, 0xeb, 0x2d, 0x2e, 0xce, 0x2e, 0xf0, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf2, 0xfc, 0xca, 0xca, 0xc4, 0xc2, 0xcc, 0xd4, 0xf2, 0xec, 0xf5, 0xf2, 0xfc, 0xfc, 0xeb, 0xeb, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xca, 0xfd, 0xfc, 0xfc, 0xf1, 0xbf, 0x6e, 0xb8, 0xc8, 0x32, 0xcc, 0xf2, 0xf4, 0xf1, 0xec, 0xea, 0xd4, 0x2d, 0x2e, 0xc5, 0x8a, 0x6e, 0xc8, 0xcd, 0xea, 0xeb, 0xf2, 0xf4, 0x2d, 0xf4, 0xeb, 0xeb, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf5, 0xca, 0xcd, 0xac, 0x03, 0x61, 0xb3, 0x2c, 0xcd, 0xfd, 0xf4, 0xec, 0xea, 0xea, 0x2d, 0x30, 0xb3, 0x53, 0x61, 0xc8, 0xcc, 0xf2, 0xf5, 0xf3, 0xf2, 0xfc, 0xf2, 0xf4, 0xeb, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf5, 0xf5, 0xf3, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf5, 0xf5, 0xf5, 
-  0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xea, 0xed, 0xea, 0xea, 0xea, 0xcc, 0x2d, 0x96, 0x61, 0x59, 0x96, 0xc5, 0x32, 0xf1, 0xf6, 0xd3, 0xca, 0xcc, 0xc9, 0x70, 0x5b, 0x58, 0xc4, 0xcc, 0xfc, 0xf5, 0xf4, 0xf4, 0xfc, 0xf4, 0xf3, 0xeb, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xed, 0xe9, 0xed, 0xea, 0xca, 0x2d, 0xce, 0xc9, 0x64, 0x6c, 0x59, 0x5b, 0xbe, 0x32, 0x2d, 0xca, 0xca, 0xcb, 0xbe, 0x57, 0x5d, 0x58, 0xc8, 0xcc, 0xf2, 0xeb, 0xec, 0xf3, 0xfc, 0xfc, 0xf3, 0xf5, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xec, 0xed, 0xea, 0xfc, 0xea, 0xca, 0xca, 0x30, 0xbb, 0x64, 0x68, 0x5a, 0x64, 0xc1, 0xcc, 0x2d, 0x2d, 0xcb, 0x9e, 0x5e, 0x62, 0x58, 0xcb, 0xca, 0xd4, 0xe9, 0xf6, 0xf3, 0xf5, 0xfc, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf3, 0xfc, 0xfd, 0xfc, 0xf5, 0xf0, 0x31, 0xcb, 0xa0, 0x5d, 0x68, 0x55, 0x66, 0xc3, 0xcd, 0xcc, 0xc1, 0x5b, 0x72, 0x52, 0x8a, 0xcc, 0xcd, 0xf5, 0xed, 0xec, 0xec, 0xfc, 0xfc, 0xfc, 0xf2, 0xf5, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xeb, 0xf3, 0xf3, 0xf3, 0xf1, 0xf4, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xfd, 0xfd, 0xfd, 0xfd, 0xf4, 0xec, 0xf0, 0x30, 0xc6, 0x64, 0x5f, 0x68, 0x52, 0x9e, 0xcb, 0x32, 0xa7, 0x5b, 0x68, 0x52, 0xab, 0xce, 0xcd, 0xe7, 0xed, 0xec, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xeb, 0xf3, 0xf3, 0xf5, 0xeb, 0xeb, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xeb, 0xf4, 0xfd, 0xfd, 0xfd, 0xf4, 0xf3, 0xea, 0xed, 0xea, 0xe8, 0xeb, 0xed, 0xeb, 0xe8, 0xf4, 0xec, 0xf1, 0xec, 0xfd, 0xfd, 0x2e, 0x31, 0x31, 0x31, 0x33, 0xce, 0x32, 0x32, 0xbe, 0x62, 0x67, 0x5e, 0x52, 0xc0, 0x2f, 0x5e, 0x67, 0x5c, 0x5c, 0xc3, 0x32, 0x32, 0xcd, 0x2e, 0xd4, 0xf4, 0xeb, 0xf5, 0xec, 0xed, 0xf5, 0xed, 0xed, 0xed, 0xe8, 0xec, 0xe7, 0xf5, 0xfc, 0xf2, 0xea, 0xeb, 0xea, 0xea, 0xea, 0xeb, 0xeb, 0xeb, 0xe8, 0xed, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xe8, 0xf2, 0xf2, 0xfc, 0xfd, 0xfd, 0xf2, 0xf5, 0xed, 0xea, 0xed, 0xeb, 0xea, 0xf2, 0xf5, 0xfc, 0xf0, 0xfc, 0x31, 0xff, 0x31, 0xcc, 0xc8, 0xc4, 0xc1, 0xbe, 0xbb, 0xb3, 0x9e, 0x9e, 0x85, 0x67, 0x5c, 0x67, 0x52, 0x88, 0xab, 0x55, 0x6c, 0x5c, 0x68, 0xa7, 0xb3, 0xbc, 0xc1, 0xc8, 0xce, 0xce, 0x31, 0xd4, 0xf5, 0xd4, 0xf2, 0xe8, 0xf0, 0xec, 0xec, 0xed, 0xec, 0xf5, 0xf2, 0xfc, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xea, 0xeb, 0xeb, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf3, 0xf5, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf3, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf3, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf3, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf5, 0xf3, 0xf5, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf5, 0xea, 0xf0, 0xea, 0xd3, 0xd4, 0xea, 0xf5, 0xec, 0xf1, 0xfc, 0xfc, 0xcd, 0xcd, 0xce, 0x32, 0xcc, 0xc5, 0xbc, 0xa7, 0x70, 0x66, 0x53, 0x53, 0x50, 0x50, 0x50, 0x52, 0x50, 0x52, 0x55, 0x5f, 0x67, 0x5c, 0x5d, 0x5c, 0x67, 0x5f, 0x5c, 0x5c, 0x52, 0x50, 0x4f, 0x58, 0x66, 0x8a, 0xa7, 0xbc, 0xc4, 0xc8, 0xff, 0x32, 0xff, 0xcd, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf4, 0xf5, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf2, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf2, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf2, 0xf3, 
-  0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xec, 0xeb, 0xe8, 0xea, 0xd3, 0xea, 0xe8, 0xf5, 0xf4, 0xfd, 0x2d, 0x31, 0x30, 0xcc, 0xc3, 0xb8, 0x96, 0x5b, 0x50, 0x50, 0x52, 0x52, 0x52, 0x55, 0x55, 0x55, 0x55, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5f, 0x5f, 0x55, 0x5c, 0x5c, 0x63, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x50, 0x50, 0x50, 0x53, 0x5b, 0x8a, 0xac, 0xc1, 0xc8, 0xcc, 0xce, 0x31, 0xca, 0xf1, 0xf4, 0xf1, 0xf4, 0xf4, 0xf3, 0xf3, 0xfc, 0xf4, 0x2d, 0xfc, 0x2d, 0xca, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf5, 0xeb, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf5, 0xf3, 0xeb, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf4, 0xf1, 0xf3, 0xea, 0xe8, 0xed, 0xe8, 0xea, 0xca, 0xfd, 0x31, 0x32, 0xc9, 0xbc, 0x9e, 0x61, 0x53, 0x57, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5f, 0x5f, 0x5f, 0x69, 0x63, 0x69, 0x63, 0x6b, 0x69, 0x63, 0x63, 0x7b, 0x74, 0x6b, 0x69, 0x63, 0x5f, 0x5f, 0x55, 0x55, 0x55, 0x55, 0x52, 0x52, 0x52, 0x50, 0x50, 0x58, 0x70, 0xb3, 0xbf, 0xc9, 0xce, 0x31, 0x2d, 0x2e, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf4, 0xf3, 0xf2, 0xfc, 0xfc, 0xfc, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf5, 0xeb, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf5, 0xf3, 0xeb, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf5, 0xeb, 0xeb, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf5, 0xeb, 0xeb, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf5, 0xeb, 0xf5, 0xeb, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf0, 0xec, 0xec, 0xec, 0xeb, 0x2e, 0xce, 0x30, 0xc3, 0x9e, 0x66, 0x4f, 0x50, 0x59, 0x5c, 0x59, 0x5f, 0x55, 0x5f, 0x5f, 0x63, 0x63, 0x69, 0x71, 0x7b, 0x7e, 0x8e, 0x8c, 0x81, 0x8c, 0x83, 0x90, 0x80, 0x81, 0x81, 0x7e, 0x90, 0x83, 0x83, 0x83, 0x83, 0x80, 0x83, 0x7e, 0x7e, 0x6b, 0x63, 0x63, 0x55, 0x5c, 0x55, 0x52, 0x55, 0x50, 0x50, 0x53, 0x61, 0xa7, 0xc1, 0xcc, 0xcc, 0xf6, 0x2d, 0xf2, 0xf5, 0xf3, 0xec, 0xf5, 0xf5, 0xf1, 0xf2, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf5, 0xf4, 0xf5, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf3, 0xf5, 0xf4, 0xf5, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf5, 0xf4, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf5, 0xf4, 0xf5, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf5, 0xf4, 0xf4, 0xf4, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xd4, 0xd4, 0xf1, 0xf4, 0xf1, 0x31, 0x32, 0xc1, 0xa7, 0x5b, 0x53, 0x52, 0x5a, 0x5c, 0x5c, 0x5c, 0x5f, 0x63, 0x69, 0x71, 0x71, 0x81, 0x81, 0x81, 0x90, 0x81, 0x8c, 0x81, 0x80, 0x8c, 0x80, 0x80, 0x80, 0x80, 0x8c, 0x80, 0x8c, 0x7e, 0x80, 0x7e, 0x80, 0x8b, 0x8b, 0x8b, 0x8c, 0x7e, 0x8c, 0x90, 0x7e, 0x71, 0x69, 0x63, 0x5f, 0x55, 0x55, 0x55, 0x55, 0x57, 0x4f, 0x58, 0x9e, 0xbe, 0xcc, 0xcd, 0xcd, 0x2d, 0xea, 0xeb, 0xed, 0xec, 0xf5, 0xf6, 0xe7, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf3, 0xf4, 0xf4, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf5, 0xf4, 0xf5, 0xf4, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xd4, 0x2d, 0xf0, 0x2d, 0x2e, 0x32, 0xc3, 0x9e, 0x56, 0x50, 0x55, 0x5c, 0x5f, 0x5f, 0x5f, 0x63, 0x71, 0x7d, 0x8b, 0x8c, 0x92, 0x80, 0x83, 0x80, 0x83, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x89, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x87, 0x87, 0x87, 0x8c, 0x87, 0x7d, 0x7d, 0x8c, 0x90, 0x8c, 0x83, 0x83, 0x6b, 0x69, 0x5f, 0x5c, 0x5c, 0x55, 0x5e, 0x50, 0x53, 0x70, 0xc1, 0xcb, 0xcd, 0xca, 0xea, 0xea, 0xe8, 0xe8, 0xec, 0xf5, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xca, 0xce, 0xc6, 0xb3, 0x58, 0x57, 0x59, 0x5c, 0x5d, 0x5f, 0x5f, 0x69, 0x71, 0x81, 0x7e, 0x80, 0x8c, 0x89, 0x7a, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7c, 0x80, 0x7c, 0x80, 0x7c, 0x7e, 0x7f, 0x7f, 0x87, 0x7f, 0x87, 0x89, 0x89, 0x7f, 0x7e, 0x87, 0x89, 0x87, 0x87, 0x8b, 0x89, 0x8b, 0x8b, 0x80, 0x7f, 0x8c, 0x80, 0x90, 0x80, 0x75, 0x71, 0x63, 0x5c, 0x55, 0x5c, 0x5e, 0x52, 0x53, 0x8a, 0xc1, 0xcc, 0xcd, 0xf0, 0xd4, 0xf5, 0xeb, 0xf3, 0xeb, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xe8, 0xf6, 0xce, 0xc4, 0x66, 0x50, 0x55, 0x55, 0x5f, 0x5c, 0x63, 0x69, 0x7e, 0x80, 0x90, 0x8c, 0x80, 0x80, 0x80, 0x80, 0x89, 0x89, 0x87, 0x87, 0x87, 0x7a, 0x87, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x87, 0x7f, 0x87, 0x87, 0x7f, 0x87, 0x7f, 0x8c, 0x7f, 0x7f, 0x89, 0x89, 0x80, 0x89, 0x80, 0x80, 0x80, 0x8b, 0x80, 0x7f, 0x80, 0x8b, 0x8b, 0x80, 0x80, 0x6b, 0x69, 0x55, 0x5f, 0x5c, 0x5c, 0x52, 0x53, 0xa7, 0xc5, 0xce, 0xca, 0xf2, 0xf5, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf6, 0xf1, 0xf2, 0xf0, 0xca, 0xcd, 0xcb, 0xa7, 0x4f, 0x52, 0x5c, 0x55, 0x5f, 0x63, 0x6b, 0x81, 0x7e, 0x8c, 0x7d, 0x7f, 0x7e, 0x7f, 0x8b, 0x7f, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x87, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7d, 0x7f, 0x7f, 0x7f, 0x87, 0x7f, 0x87, 0x7f, 0x7f, 0x7f, 0x7f, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x7c, 0x8b, 0x7c, 0x80, 0x89, 0x8c, 0x7f, 0x8b, 0x7f, 0x8b, 0x80, 0x80, 0x8c, 0x74, 0x71, 0x5c, 0x55, 0x5c, 0x5e, 0x50, 0x61, 0xb3, 0xcc, 0xcd, 0x2d, 0xf0, 0xe8, 0xec, 0xf3, 0xf3, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x2d, 0xf4, 0xf3, 0xf4, 0xf0, 0xf6, 0xf2, 0xca, 0xff, 0xc5, 0x8a, 0x50, 0x5a, 0x55, 0x5c, 0x5f, 0x69, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x89, 0x8b, 0x89, 0x8b, 0x7f, 0x8b, 0x7f, 0x7f, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x89, 0x7a, 0x7b, 0x63, 0x5c, 0x5c, 0x5c, 0x57, 0x50, 0xa7, 0xc5, 0xce, 0xd4, 0xed, 0xe8, 0xf2, 0xf5, 0xf0, 0xfc, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xfc, 0xf4, 0xf1, 0xec, 0xec, 0xf3, 0xf2, 0xca, 0xce, 0xbc, 0x61, 0x50, 0x55, 0x5d, 0x55, 0x63, 0x73, 0x8c, 0x80, 0x7e, 0x80, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x90, 0x7b, 0x71, 0x63, 0x5f, 0x5c, 0x5d, 0x4a, 0x61, 0xc1, 0xcc, 0xd4, 0xd4, 0xea, 0xf2, 0xf0, 0xeb, 0xf3, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4, 0xeb, 0xec, 0xea, 0xf0, 0xcd, 0xcc, 0xbb, 0x53, 0x52, 0x5d, 0x5d, 0x5c, 0x71, 0x81, 0x80, 0x7a, 0x73, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x7a, 0x8c, 0x80, 0x7a, 0x63, 0x5f, 0x55, 0x64, 0x52, 0x58, 0xbb, 0xcb, 0xcd, 0x2d, 0xf0, 0xeb, 0xeb, 0xec, 0xeb, 0xf3, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf1, 0xf4, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf1, 0xf4, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf1, 0xeb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xec, 0xeb, 0xea, 0xcd, 0xce, 0x9e, 0x53, 0x52, 0x5d, 0x5c, 0x63, 0x71, 0x81, 0x80, 0x7a, 0x7a, 0x8b, 0x80, 0x7a, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x89, 0x7f, 0x7f, 0x7f, 0x8b, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x8b, 0x8b, 0x89, 0x7f, 0x89, 0x7f, 0x7f, 0x8b, 0x80, 0x74, 0x63, 0x55, 0x59, 0x55, 0x4f, 0x9e, 0xcb, 0xcc, 0xca, 0xd4, 0xec, 0xeb, 0xec, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xeb, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf5, 0xf0, 0xea, 0xca, 0xcc, 0xa7, 0x50, 0x55, 0x5f, 0x5f, 0x69, 0x81, 0x7e, 0x7a, 0x7a, 0x80, 0x89, 0x7a, 0x7a, 0x8b, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x89, 0x7a, 0x87, 0x89, 0x8b, 0x7a, 0x83, 0x74, 0x69, 0x5f, 0x55, 0x5a, 0x4f, 0x8a, 0xc5, 0xce, 0xf0, 0xeb, 0xeb, 0xf1, 0xf4, 0xfd, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xeb, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf1, 0xf0, 0xf6, 0xcc, 0xcd, 0xa7, 0x4a, 0x5c, 0x55, 0x63, 0x73, 0x80, 0x7f, 0x7a, 0x7f, 0x7c, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x87, 0x7d, 0x7f, 0x7e, 0x7a, 0x83, 0x7b, 0x6b, 0x5c, 0x55, 0x59, 0x53, 0x70, 0xc5, 0xff, 0xd3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xeb, 0xf2, 0xeb, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf5, 0xf2, 0xf2, 0xea, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xeb, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xeb, 0xf5, 
-  0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xfc, 0xcb, 0xcc, 0xa7, 0x53, 0x55, 0x5f, 0x5f, 0x80, 0x7a, 0x80, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x89, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x71, 0x83, 0x90, 0x69, 0x5f, 0x5c, 0x55, 0x50, 0x70, 0xc3, 0xce, 0x2d, 0xf6, 0xfd, 0xf4, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xfc, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfc, 0xea, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0xfc, 0xea, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xfc, 0xea, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xeb, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xeb, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xeb, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xfc, 0x2d, 0x32, 0xb3, 0x50, 0x55, 0x55, 0x63, 0x7e, 0x8b, 0x73, 0x7f, 0x7f, 0x7a, 0x7a, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x87, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x87, 0x7f, 0x7d, 0x7e, 0x8c, 0x7e, 0x77, 0x7e, 0x8c, 0x7e, 0x5c, 0x5f, 0x55, 0x53, 0x70, 0xc9, 0xce, 0xc8, 0xeb, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x2d, 0xff, 0xbb, 0x50, 0x55, 0x5f, 0x69, 0x7a, 0x7a, 0x77, 0x8c, 0x7a, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7d, 0x7f, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x87, 0x73, 0x87, 0x8d, 0x7f, 0x7f, 0x80, 0x83, 0x5f, 0x5c, 0x55, 0x50, 0x8a, 0xc5, 0xce, 0xf2, 0xeb, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xeb, 0xf3, 0xeb, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0x2d, 0xf2, 0xfc, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xeb, 0xf0, 0x31, 0xc4, 0x53, 0x53, 0x5f, 0x63, 0x76, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7a, 0x7a, 0x7f, 0x7d, 0x89, 0x7d, 0x7f, 0x7d, 0x7f, 0x7d, 0x8c, 0x7d, 0x8c, 0x8c, 0x8c, 0x8c, 0x7e, 0x8c, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7a, 0x7f, 0x7a, 0x7a, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8c, 0x80, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x80, 0x7f, 0x7f, 0x8d, 0x7c, 0x8d, 0x7f, 0x7f, 0x87, 0x87, 0x87, 0x87, 0x7f, 0x7f, 0x80, 0x75, 0x63, 0x55, 0x5a, 0x50, 0x9e, 0xcc, 0xca, 0xea, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf1, 0xeb, 0xf3, 0xeb, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xeb, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xfc, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xfc, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf6, 0xf3, 0xe8, 0xea, 0xf2, 0xf2, 0xfc, 0xca, 0xcd, 0xcd, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xcd, 0xcd, 0xd4, 0xf0, 0xd4, 0xeb, 0xf0, 0xec, 0xd4, 0xc8, 0x66, 0x59, 0x55, 0x69, 0x7a, 0x7e, 0x7e, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f, 0x8d, 0x87, 0x7f, 0x7d, 0x8e, 0x8e, 0x91, 0x8e, 0x72, 0x6d, 0x67, 0x67, 0x67, 0x68, 0x72, 0x82, 0x82, 0x91, 0x91, 0x7d, 0x7f, 0x7f, 0x7c, 0x7a, 0x7d, 0x7e, 0x7d, 0x7d, 0x7f, 0x7f, 0x87, 0x7c, 0x87, 0x7c, 0x7f, 0x7c, 0x7a, 0x7c, 0x7c, 0x8d, 0x8d, 0x8d, 0x89, 0x80, 0x8e, 0x8e, 0x88, 0x7b, 0x72, 0x72, 0x67, 0x67, 0x6c, 0x72, 0x82, 0x90, 0x8e, 0x7f, 0x8d, 0x7f, 0x7a, 0x87, 0x7d, 0x7d, 0x7d, 0x7f, 0x7c, 0x8d, 0x7f, 0x89, 0x7e, 0x81, 0x63, 0x55, 0x59, 0x50, 0xab, 0xce, 0xcb, 0xe7, 0xf2, 0xe8, 0xf0, 0xea, 0xea, 0xf2, 0xfc, 0xfd, 0xfd, 0xfd, 0xcd, 0xca, 0x2e, 0xca, 0x2d, 0xfc, 0xf3, 0xf1, 0xec, 0xec, 0xe8, 0xea, 0xe8, 0xf2, 0xf2, 0xf2, 0xf3, 0xeb, 0xeb, 0xe8, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf2, 0xeb, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0xf4, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf4, 0xf6, 0xf1, 0xf2, 0xfc, 0xca, 0xcd, 0xce, 0xcd, 0xcb, 0xc5, 0xbf, 0xbc, 0xb3, 0xac, 0xa7, 0xac, 0xb3, 0xbc, 0xbf, 0xc5, 0xcd, 0xcc, 0xcd, 0x2d, 0xcd, 0xff, 0x96, 0x4f, 0x5c, 0x5f, 0x7f, 0x7a, 0x73, 0x7d, 0x7e, 0x7c, 0x7f, 0x7f, 0x7f, 0x7f, 0x87, 0x7f, 0x7d, 0x91, 0x88, 0x72, 0x5a, 0x4f, 0x4a, 0x47, 0x3f, 0x43, 0x3f, 0x43, 0x43, 0x47, 0x4a, 0x4f, 0x5d, 0x72, 0x82, 0x8e, 0x77, 0x7a, 0x8c, 0x7f, 0x7a, 0x7a, 0x7f, 0x7d, 0x7f, 0x7f, 0x7f, 0x7c, 0x7f, 0x7f, 0x7f, 0x7a, 0x8d, 0x7f, 0x7c, 0x7a, 0x7e, 0x8e, 0x82, 0x6c, 0x64, 0x50, 0x4b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x4f, 0x5e, 0x79, 0x82, 0x8e, 0x8e, 0x7d, 0x7f, 0x89, 0x7f, 0x7f, 0x7f, 0x7c, 0x87, 0x7a, 0x7d, 0x81, 0x71, 0x63, 0x55, 0x59, 0x58, 0xbe, 0xcc, 0xca, 0xf0, 0xf0, 0xca, 0xca, 0xcd, 0xcc, 0xcc, 0xcc, 0xcb, 0xc8, 0xc8, 0xc9, 0xcb, 0xcc, 0x30, 0xcd, 0xcd, 0xcd, 0xca, 0xf2, 0xea, 0xf0, 0xf5, 0xf5, 0xf1, 0xf2, 0xf3, 0xea, 0xea, 0xea, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf4, 0xf1, 0xf4, 0xf1, 0xf3, 0xf1, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xeb, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf4, 0xf1, 0xf4, 0xf1, 0xf3, 0xf1, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xeb, 0xf2, 0xf1, 0x2d, 0xcd, 0x30, 0x33, 0xc3, 0xb8, 0x8a, 0x61, 0x4f, 0x4a, 0x4a, 0x4a, 0x4a, 0x4f, 0x4a, 0x4a, 0x4a, 0x4a, 0x58, 0x70, 0xb3, 0xc5, 0x30, 0x33, 0xbc, 0x4a, 0x57, 0x55, 0x81, 0x7a, 0x7a, 0x7e, 0x7d, 0x7a, 0x7f, 0x8d, 0x7f, 0x7f, 0x7d, 0x90, 0x88, 0x88, 0x5a, 0x4f, 0x43, 0x3b, 0x3b, 0x38, 0x3d, 0x3d, 0x41, 0x3c, 0x3c, 0x38, 0x37, 0x36, 0x38, 0x3f, 0x43, 0x4f, 0x6c, 0x88, 0x8e, 0x77, 0x7a, 0x8d, 0x87, 0x7f, 0x7f, 0x7f, 0x7d, 0x7a, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x81, 0x91, 0x79, 0x64, 0x4f, 0x47, 0x38, 0x38, 0x38, 0x36, 0x37, 0x36, 0x39, 0x3c, 0x3d, 0x3e, 0x38, 0x3f, 0x3f, 0x53, 0x64, 0x88, 0x8e, 0x7a, 0x7f, 0x7c, 0x7f, 0x7a, 0x7d, 0x7f, 0x7f, 0x7a, 0x81, 0x81, 0x7b, 0x5f, 0x5c, 0x53, 0x66, 0xc5, 0x2e, 0xcc, 0x32, 0xcc, 0xc4, 0xb8, 0xa7, 0x70, 0x61, 0x58, 0x58, 0x58, 0x61, 0x66, 0x70, 0x9e, 0xb3, 0xc1, 0xcb, 0xce, 0x33, 0xca, 0xf0, 0xfc, 0xe7, 0xf5, 0xec, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xeb, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf1, 0xf4, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xca, 0x32, 0xcc, 0xbb, 0x70, 0x53, 0x50, 0x4a, 0x50, 0x52, 0x53, 0x52, 0x52, 0x52, 0x50, 0x52, 0x52, 0x52, 0x52, 0x50, 0x50, 0x4a, 0x50, 0x70, 0xbb, 0x66, 0x52, 0x55, 0x7b, 0x71, 0x7e, 0x73, 0x7d, 0x7a, 0x87, 0x7c, 0x8d, 0x7c, 0x87, 0x8e, 0x79, 0x64, 0x47, 0x43, 0x36, 0x3b, 0x3b, 0x36, 0x3c, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x39, 0x3c, 0x3d, 0x3b, 0x38, 0x3b, 0x43, 0x4f, 0x64, 0x91, 0x8c, 0x73, 0x8d, 0x7f, 0x7f, 0x7f, 0x7d, 0x7a, 0x7d, 0x7e, 0x7d, 0x7e, 0x7f, 0x7d, 0x8e, 0x88, 0x64, 0x4a, 0x3b, 0x38, 0x36, 0x38, 0x3c, 0x3e, 0x39, 0x39, 0x39, 0xd0, 0x39, 0xd0, 0x3c, 0x3c, 0x3d, 0x42, 0x38, 0x43, 0x4f, 0x67, 0x8e, 0x7e, 0x7f, 0x7a, 0x7a, 0x7e, 0x7d, 0x7f, 0x7f, 0x77, 0x83, 0x74, 0x7b, 0x55, 0x5d, 0x50, 0x8a, 0x30, 0xc5, 0xa7, 0x61, 0x4f, 0x53, 0x50, 0x50, 0x52, 0x50, 0x50, 0x50, 0x52, 0x50, 0x52, 0x53, 0x50, 0x4f, 0x58, 0x8a, 0xbe, 0xcb, 0x32, 0x2d, 0xf6, 0xea, 0xe8, 0xea, 0xea, 0xea, 0xca, 0xea, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf5, 0xf3, 0xf4, 0xeb, 0xf2, 0xf4, 0xf3, 0xf4, 0xf5, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xeb, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xeb, 0xf3, 0xf2, 0xeb, 0xf1, 0xf6, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xeb, 0xf2, 0xf4, 0xf3, 0xf4, 0xf5, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xcd, 0x33, 0xbc, 0x66, 0x4f, 0x50, 0x52, 0x55, 0x52, 0x52, 0x52, 0x55, 0x55, 0x5c, 0x55, 0x5f, 0x55, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x50, 0x50, 0x50, 0x55, 0x6b, 0x7b, 0x7e, 0x7e, 0x77, 0x7a, 0x7a, 0x7f, 0x87, 0x7f, 0x7f, 0x91, 0x78, 0x4f, 0x3b, 0x38, 0x3a, 0x3d, 0x3d, 0x38, 0x42, 0x38, 0x38, 0x38, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3c, 0x3a, 0x41, 0x3a, 0x3a, 0x3b, 0x47, 0x57, 0x8e, 0x8e, 0x7a, 0x7f, 0x87, 0x7f, 0x7f, 0x7f, 0x7a, 0x7d, 0x7a, 0x7d, 0x7e, 0x91, 0x72, 0x50, 0x3f, 0x38, 0x3c, 0x37, 0x39, 0x39, 0x37, 0x37, 0x3b, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3a, 0x3f, 0x43, 0x53, 0x82, 0x7b, 0x7e, 0x7e, 0x73, 0x7f, 0x87, 0x7f, 0x7e, 0x7e, 0x7e, 0x83, 0x74, 0x52, 0x5a, 0x5e, 0x8a, 0x56, 0x4a, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x55, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x50, 0x50, 0x53, 0x70, 0xbe, 0xce, 0xce, 0xf2, 0xea, 0xec, 0xea, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xea, 0xea, 0xfc, 0xeb, 0xf4, 0xf1, 0xf1, 0xf5, 0xea, 0xea, 0xf4, 0xeb, 0xf4, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf4, 0xea, 0xea, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf5, 0xea, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf5, 0xea, 0xea, 0xfc, 0xf3, 0xf4, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xea, 0xea, 0xf4, 0xea, 0xf4, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0xfc, 0xeb, 0xf4, 0xf5, 0xf4, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf4, 0xf1, 0xfc, 0xf0, 0xce, 0xc4, 0x8a, 0x4f, 0x52, 0x55, 0x55, 0x5c, 0x5f, 0x69, 0x74, 0x83, 0x83, 0x83, 0x75, 0x83, 0x83, 0x83, 0x83, 0x83, 0x74, 0x63, 0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x63, 0x7e, 0x7e, 0x71, 0x77, 0x7f, 0x7a, 0x7f, 0x87, 0x7a, 0x77, 0x88, 0x5d, 0x43, 0x3f, 0x3a, 0x41, 0x3c, 0x3c, 0x3a, 0x41, 0x3b, 0x3b, 0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x40, 0x3b, 0x40, 0x3b, 0x3a, 0x3a, 0x39, 0x3c, 0x3a, 0x38, 0x38, 0x4a, 0x64, 0x91, 0x7d, 0x7f, 0x7a, 0x87, 0x7c, 0x7f, 0x8b, 0x77, 0x81, 0x7b, 0x57, 0x43, 0x38, 0x3b, 0x3d, 0x39, 0x39, 0x39, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x3b, 0x42, 0x38, 0x43, 0x3a, 0x38, 0x38, 0x3b, 0x3f, 0x47, 0x64, 0x88, 0x77, 0x7f, 0x7a, 0x7f, 0x7a, 0x80, 0x7e, 0x80, 0x7c, 0x7e, 0x6b, 0x55, 0x5a, 0x52, 0x52, 0x52, 0x52, 0x55, 0x5f, 0x5f, 0x69, 0x6b, 0x75, 0x74, 0x75, 0x75, 0x75, 0x6b, 0x69, 0x5f, 0x5c, 0x55, 0x52, 0x52, 0x53, 0x4a, 0x66, 0xbf, 0xcc, 0xd4, 0xca, 0xf3, 0xfd, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xeb, 0xea, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf2, 0xeb, 0xea, 0xf2, 0xf3, 0xf4, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xeb, 0xea, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xeb, 0xea, 0xf4, 0xeb, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0xeb, 0xea, 0xf2, 0xf3, 0xf4, 0xf4, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf4, 0xea, 0xea, 0xf3, 0xf3, 0xf4, 0xf0, 0xf6, 0xf2, 0xf2, 0xf2, 0xf5, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xfd, 0xca, 0x32, 0xbc, 0x61, 0x53, 0x52, 0x5c, 0x5f, 0x63, 0x75, 0x7b, 0x83, 0x74, 0x75, 0x74, 0x75, 0x7e, 0x73, 0x71, 0x73, 0x71, 0x75, 0x7b, 0x83, 0x7b, 0x74, 0x5f, 0x52, 0x52, 0x52, 0x7e, 0x80, 0x71, 0x77, 0x7e, 0x7a, 0x7a, 0x7d, 0x77, 0x7b, 0x97, 0x57, 0x43, 0x3f, 0x3a, 0x41, 0x39, 0x3c, 0x41, 0x3d, 0x38, 0x41, 0x38, 0x3d, 0x3b, 0x41, 0x40, 0x3a, 0x3a, 0x40, 0x3a, 0x40, 0x3b, 0x3a, 0x3a, 0x39, 0x37, 0x40, 0x43, 0x38, 0x43, 0x5d, 0x8e, 0x7d, 0x7f, 0x7a, 0x8d, 0x87, 0x7d, 0x8e, 0x88, 0x52, 0x43, 0x3b, 0x3b, 0x3a, 0x37, 0x3c, 0x3c, 0x38, 0x3b, 0x3b, 0x3b, 0x3b, 0x40, 0x3a, 0x40, 0x3a, 0x3d, 0x3a, 0x3d, 0x42, 0x3a, 0x3b, 0x45, 0x41, 0x37, 0x39, 0x38, 0x3f, 0x5a, 0x91, 0x7a, 0x7a, 0x7f, 0x7d, 0x7e, 0x7e, 0x7f, 0x76, 0x7c, 0x7e, 0x5f, 0x55, 0x52, 0x55, 0x55, 0x63, 0x6b, 0x75, 0x7e, 0x83, 0x7e, 0x83, 0x7e, 0x83, 0x7e, 0x83, 0x76, 0x74, 0x83, 0x74, 0x6b, 0x5f, 0x5f, 0x52, 0x55, 0x57, 0x50, 0xb3, 0xcc, 0xcc, 0xf0, 0xfd, 0xf6, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf3, 
-  0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xea, 0xea, 0xfc, 0xeb, 0xf4, 0xf1, 0xf3, 0xf4, 0xea, 0xea, 0xf4, 0xeb, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xea, 0xea, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xea, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xea, 0xea, 0xfc, 0xeb, 0xf4, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xea, 0xea, 0xf4, 0xeb, 0xf4, 0xf3, 0xf1, 0xeb, 0xf1, 0xf2, 0xf1, 0xf3, 0xeb, 0xea, 0xfc, 0xeb, 0xf4, 0xf3, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0x2d, 0xca, 0x30, 0xb3, 0x58, 0x5d, 0x5c, 0x69, 0x6b, 0x75, 0x83, 0x6b, 0x73, 0x74, 0x73, 0x75, 0x73, 0x76, 0x73, 0x7e, 0x73, 0x7e, 0x7e, 0x7e, 0x71, 0x74, 0x74, 0x7b, 0x83, 0x6b, 0x5c, 0x68, 0x89, 0x7a, 0x7d, 0x7e, 0x7a, 0x7a, 0x7a, 0x77, 0x82, 0x79, 0x57, 0x3b, 0x38, 0x45, 0x38, 0x3c, 0x3c, 0x37, 0x3a, 0x3a, 0x3c, 0xcf, 0xcf, 0x34, 0x39, 0x3c, 0x39, 0x3c, 0x39, 0x39, 0x39, 0x3a, 0x3b, 0x3a, 0x3a, 0x3a, 0x41, 0x3c, 0x37, 0x3b, 0x40, 0x3f, 0x5a, 0x91, 0x78, 0x8d, 0x7a, 0x7a, 0x7d, 0x72, 0x4a, 0x3b, 0x38, 0x3a, 0x41, 0x3a, 0x37, 0x3a, 0x3d, 0x3b, 0x3b, 0x3b, 0x3b, 0x3a, 0x39, 0x3a, 0x39, 0x39, 0x3c, 0x39, 0x39, 0x35, 0x39, 0x3d, 0x36, 0x37, 0x39, 0x44, 0x3c, 0x42, 0x3f, 0x52, 0x88, 0x8c, 0x7d, 0x7a, 0x71, 0x7a, 0x7a, 0x7c, 0x7c, 0x73, 0x77, 0x55, 0x5f, 0x68, 0x75, 0x74, 0x83, 0x7a, 0x7a, 0x7a, 0x7e, 0x73, 0x71, 0x73, 0x73, 0x7a, 0x73, 0x73, 0x73, 0x71, 0x81, 0x7b, 0x74, 0x68, 0x55, 0x55, 0x5e, 0x50, 0x8a, 0xc9, 0x32, 0xc8, 0xf1, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf4, 0xea, 0xea, 0xf2, 0xf3, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xeb, 0xea, 0xf3, 0xf3, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xf2, 0xf3, 0xf4, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xea, 0xea, 0xf3, 0xf3, 0xf4, 0xf3, 0xf5, 0xf5, 0xf2, 0xf2, 0xf5, 0xf0, 0xf2, 0xf2, 0xf1, 0xca, 0xce, 0xb3, 0x5b, 0x5d, 0x5f, 0x73, 0x75, 0x76, 0x74, 0x74, 0x73, 0x75, 0x73, 0x75, 0x73, 0x76, 0x74, 0x76, 0x7a, 0x71, 0x7a, 0x7d, 0x7d, 0x7a, 0x7e, 0x7e, 0x75, 0x7b, 0x6b, 0x69, 0x7b, 0x7a, 0x77, 0x7d, 0x7d, 0x7a, 0x7a, 0x7c, 0x7b, 0x88, 0x5b, 0x3f, 0x40, 0x3b, 0x3d, 0x41, 0x41, 0x41, 0x3d, 0x35, 0x36, 0x46, 0x60, 0xd1, 0x6e, 0x3c, 0x35, 0x3c, 0x3a, 0x39, 0x39, 0x39, 0x3a, 0x3b, 0x3a, 0x3a, 0x3c, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3b, 0x3b, 0x64, 0x88, 0x7d, 0x7d, 0x8c, 0x72, 0x4a, 0x3b, 0x41, 0x37, 0x3a, 0x37, 0x3d, 0x3b, 0x3a, 0x3b, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3a, 0x3c, 0x3c, 0x35, 0xcf, 0x35, 0xcf, 0x34, 0x35, 0x3a, 0x46, 0x39, 0x37, 0x3c, 0x3d, 0x43, 0x43, 0x57, 0x79, 0x7a, 0x7e, 0x77, 0x7e, 0x7c, 0x7f, 0x7c, 0x7a, 0x81, 0x63, 0x5f, 0x6b, 0x83, 0x73, 0x7a, 0x7a, 0x7a, 0x76, 0x7e, 0x73, 0x7e, 0x73, 0x7e, 0x7a, 0x7a, 0x7a, 0x76, 0x73, 0x76, 0x74, 0x75, 0x6b, 0x75, 0x5f, 0x55, 0x59, 0x52, 0x8a, 0xc8, 0x31, 0xf0, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xfc, 0xeb, 0xf4, 0xf1, 0xf2, 0xf3, 0xea, 0xea, 0xf4, 0xeb, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xfc, 0xeb, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xea, 0xea, 0xf4, 0xeb, 0xf4, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xfc, 0xeb, 0xf1, 0xf1, 0xf7, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xce, 0xbc, 0x5b, 0x5e, 0x63, 0x75, 0x7c, 0x76, 0x7a, 0x71, 0x71, 0x74, 0x73, 0x75, 0x73, 0x75, 0x73, 0x73, 0x69, 0x73, 0x69, 0x77, 0x77, 0x7a, 0x77, 0x7a, 0x73, 0x73, 0x73, 0x63, 0x77, 0x77, 0x7a, 0x77, 0x7d, 0x7d, 0x7a, 0x7f, 0x73, 0x8e, 0x67, 0x43, 0x38, 0x3b, 0x40, 0x3b, 0x3b, 0x3d, 0x36, 0x34, 0x60, 0xbd, 0xca, 0x33, 0xfb, 0x33, 0xcd, 0x6e, 0x38, 0x40, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x38, 0x43, 0x6c, 0x88, 0x8e, 0x8e, 0x4a, 0x43, 0x3c, 0xd0, 0x39, 0x41, 0x3a, 0x3a, 0x42, 0x3b, 0x3a, 0x3a, 0x3c, 0x39, 0x3a, 0x40, 0x40, 0x40, 0x3a, 0x35, 0x49, 0xa7, 0xb1, 0xb8, 0x9b, 0x54, 0x34, 0x34, 0x40, 0x40, 0x40, 0x3b, 0x42, 0x3b, 0x42, 0x5d, 0x7e, 0x77, 0x7e, 0x7d, 0x7f, 0x7a, 0x7c, 0x7f, 0x7d, 0x7e, 0x5c, 0x69, 0x7b, 0x7e, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x74, 0x71, 0x7e, 0x73, 0x73, 0x7a, 0x76, 0x7a, 0x76, 0x7a, 0x76, 0x7e, 0x74, 0x74, 0x74, 0x69, 0x5f, 0x5c, 0x4f, 0x8a, 0xc8, 0xcd, 0xea, 0xf3, 0xf2, 0xf1, 0xeb, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xf4, 0xeb, 0xf4, 0xf4, 0xf2, 0xf4, 0xea, 0xea, 0xf2, 0xf3, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xeb, 0xea, 0xf2, 0xf3, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xf3, 0xf3, 0xf4, 0xf0, 0xf7, 0x2e, 0xfd, 0xca, 0xca, 0xf1, 0xec, 0xf0, 0xce, 0xc1, 0x72, 0x55, 0x68, 0x75, 0x69, 0x75, 0x76, 0x76, 0x73, 0x74, 0x73, 0x77, 0x71, 0x6f, 0x77, 0x86, 0x95, 0x94, 0x9a, 0x94, 0x94, 0x86, 0x84, 0x6f, 0x6f, 0x77, 0x7d, 0x73, 0x69, 0x7e, 0x7e, 0x7d, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f, 0x78, 0x79, 0x4b, 0x3b, 0x3b, 0x38, 0x3a, 0x3d, 0x3a, 0x3a, 0x35, 0xac, 0xce, 0xcb, 0xbf, 0xa2, 0x9b, 0x9b, 0xb8, 0x9b, 0x42, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3b, 0x48, 0x85, 0x96, 0x50, 0x43, 0x3f, 0x3d, 0x39, 0x3c, 0x3d, 0x3a, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x39, 0x3a, 0x3a, 0x3b, 0x3a, 0x38, 0x60, 0xc8, 0x31, 0xcd, 0xcd, 0x33, 0xff, 0xc4, 0x54, 0x37, 0x37, 0x3a, 0x3d, 0x3b, 0x3b, 0x3b, 0x43, 0x64, 0x82, 0x7d, 0x7a, 0x7f, 0x7a, 0x7f, 0x7a, 0x7a, 0x80, 0x69, 0x5f, 0x73, 0x7e, 0x7a, 0x7a, 0x77, 0x6f, 0x6f, 0x77, 0x86, 0x6f, 0x86, 0x84, 0x77, 0x6f, 0x73, 0x7a, 0x76, 0x76, 0x75, 0x73, 0x74, 0x7e, 0x75, 0x63, 0x5c, 0x5d, 0x53, 0x9e, 0x30, 0xc8, 0xfc, 0xeb, 0xea, 0xe8, 0xf5, 0xf1, 0xfd, 0xfc, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xea, 0xea, 0xfc, 0xeb, 0xf1, 0xf5, 0xf4, 0xf3, 0xeb, 0xea, 0xf4, 0xeb, 0xf1, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xea, 0xea, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf4, 0xea, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf4, 0xea, 0xea, 0xfc, 0xeb, 0xf4, 0xf5, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xea, 0xea, 0xf4, 0xeb, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xea, 0xea, 0xfc, 0xeb, 0xf4, 0xf1, 0xf7, 0xf6, 0xfd, 0xcb, 0xf0, 0xe8, 0xec, 0xfd, 0xcc, 0x85, 0x5f, 0x6b, 0x6b, 0x74, 0x74, 0x75, 0x6b, 0x75, 0x74, 0x73, 0x69, 0x6f, 0x86, 0xa4, 0x22, 0x22, 0x22, 0xaf, 0x22, 0x22, 0x22, 0xaf, 0xaf, 0x20, 0x1c, 0x77, 0x6f, 0x69, 0x73, 0x73, 0x7e, 0x7d, 0x7d, 0x7c, 0x87, 0x7c, 0x77, 0x91, 0x53, 0x42, 0x3f, 0x40, 0x3d, 0x3d, 0x3a, 0x3a, 0x34, 0xac, 0xcc, 0xac, 0x49, 0x35, 0x34, 0x36, 0x34, 0x36, 0x36, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3c, 0x3d, 0x3d, 0x3d, 0x41, 0x3a, 0x3b, 0x3b, 0x61, 0x61, 0x3b, 0x3b, 0x38, 0x42, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x38, 0x3a, 0x3d, 0x41, 0x4e, 0x65, 0x54, 0x49, 0x4e, 0x60, 0xac, 0xf0, 0x33, 0x65, 0x34, 0x3a, 0x3a, 0x3d, 0x40, 0x3b, 0x3f, 0x4f, 0x72, 0x7d, 0x7f, 0x7f, 0x7f, 0x7d, 0x7e, 0x7a, 0x7a, 0x74, 0x69, 0x69, 0x76, 0x77, 0x6f, 0x94, 0xaa, 0xaf, 0xb6, 0xb6, 0x25, 0xaf, 0xae, 0xa4, 0x9d, 0x84, 0x77, 0x73, 0x73, 0x80, 0x73, 0x73, 0x76, 0x83, 0x74, 0x63, 0x5c, 0x5a, 0x57, 0xbe, 0x32, 0xf2, 0xf2, 0xe8, 0xf6, 0xe7, 0xf4, 0xfc, 0xfc, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xeb, 0xea, 0xf4, 0xeb, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xea, 0xfc, 0xeb, 0xf4, 0xf5, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xeb, 0xea, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xea, 0xf4, 0xeb, 0xf4, 0xf5, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xea, 0xf5, 0xf1, 0xf4, 0xfc, 0xee, 0x2e, 0xfd, 0x2d, 0xd4, 0xe7, 0xf4, 0x2e, 0xbb, 0x52, 0x69, 0x74, 0x74, 0x75, 0x6b, 0x74, 0x73, 0x73, 0x6f, 0x77, 0x9a, 0xae, 0xaf, 0xaf, 0x20, 0x22, 0x1d, 0x22, 0x1d, 0x20, 0x22, 0x22, 0x22, 0x22, 0xb6, 0xb6, 0x95, 0x69, 0x8c, 0x71, 0x7d, 0x77, 0x7a, 0x7f, 0x7c, 0x87, 0x82, 0x79, 0x3f, 0x38, 0x3b, 0x3a, 0x41, 0x38, 0x3a, 0x3d, 0x4e, 0xb8, 0x4e, 0xcf, 0x37, 0x40, 0x41, 0x3a, 0x40, 0x41, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x42, 0x38, 0x45, 0x43, 0x3b, 0x3f, 0x42, 0x3d, 0x38, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x37, 0x3a, 0x37, 0x36, 0x35, 0x35, 0x35, 0x35, 0x34, 0x35, 0xa2, 0xc5, 0x54, 0x35, 0x3a, 0x3d, 0x3a, 0x42, 0x3b, 0x3f, 0x5a, 0x82, 0x73, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x71, 0x6b, 0x63, 0x77, 0xa3, 0xb6, 0x26, 0x25, 0x25, 0xb6, 0x22, 0x20, 0x20, 0x1e, 0x20, 0xae, 0x22, 0xae, 0x95, 0x84, 0x6f, 0x7e, 0x7e, 0x75, 0x76, 0x75, 0x74, 0x63, 0x55, 0x5e, 0x5e, 0xc6, 0xca, 0xd4, 0xe7, 0xed, 0xeb, 0xf1, 0xfc, 0x2d, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf4, 0xf2, 0xea, 0xfc, 0xeb, 0xf4, 0xf4, 0xf3, 0xf4, 0xf2, 0xeb, 0xfc, 0xeb, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xea, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xea, 0xfc, 0xeb, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf4, 0xeb, 0xf2, 0xf5, 0xf3, 0xf3, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xea, 0xea, 0xfc, 0xeb, 0xf1, 0xf5, 0xf7, 0xf6, 0xfd, 0xf2, 0xd3, 0xf6, 0xca, 0xc6, 0x70, 0x6b, 0x7b, 0x6b, 0x75, 0x6b, 0x76, 0x73, 0x71, 0x6f, 0x6f, 0xa4, 0xaf, 0x22, 0x1e, 0x17, 0x16, 0x10, 0x11, 0x10, 0x10, 0x15, 0x15, 0x16, 0x1a, 0x1d, 0xaf, 0x25, 0x8e, 0x6f, 0x7d, 0x77, 0x7d, 0x7e, 0x7a, 0x7a, 0x7f, 0x7d, 0x82, 0x53, 0x36, 0x3f, 0x37, 0x3d, 0x3a, 0x3a, 0x3a, 0x41, 0x46, 0x42, 0x35, 0x37, 0x42, 0x3c, 0x3d, 0x3a, 0x3a, 0x3a, 0x37, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x37, 0x3d, 0x3a, 0x3b, 0x3b, 0x3b, 0x42, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x41, 0x37, 0x3a, 0x41, 0x41, 0x3c, 0x35, 0x3c, 0xcf, 0x60, 0x6e, 0x36, 0x3a, 0x3d, 0x40, 0x40, 0x3b, 0x43, 0x4a, 0x82, 0x71, 0x76, 0x7a, 0x76, 0x7e, 0x7a, 0x7a, 0x7b, 0x81, 0x69, 0x6d, 0xb6, 0xaf, 0x22, 0x1a, 0x16, 0x12, 0x11, 0x12, 0x0c, 0x12, 0x12, 0x17, 0x19, 0x1c, 0x22, 0x1c, 0x95, 0x6f, 0x73, 0x7a, 0x75, 0x75, 0x75, 0x6b, 0x5f, 0x5c, 0x5a, 0xa7, 0x32, 0xca, 0xf0, 0xec, 0xeb, 0xf4, 0xfc, 0xfc, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf3, 0xf1, 
-  0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf4, 0xf4, 0xf2, 0xf3, 0xf2, 0xf4, 0xf3, 0xf2, 0xf3, 0xf4, 0xeb, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf5, 0xf1, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf4, 0xf3, 0xf2, 0xf4, 0xf4, 0xeb, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf4, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xeb, 0xf2, 0xf3, 0xf3, 0xf4, 0xf1, 0xf6, 0xf6, 0xf2, 0xec, 0xe8, 0xf0, 0xff, 0xab, 0x5d, 0x74, 0x75, 0x73, 0x75, 0x76, 0x75, 0x71, 0x6f, 0x86, 0x20, 0x22, 0x18, 0x11, 0x10, 0x09, 0x10, 0x15, 0x10, 0x10, 0x10, 0x10, 0x15, 0x15, 0x10, 0x10, 0x17, 0x20, 0x6d, 0x6f, 0x7e, 0x77, 0x8c, 0x73, 0x7a, 0x7a, 0x7a, 0x82, 0x64, 0x43, 0x3b, 0x3a, 0x38, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x37, 0x42, 0x41, 0x35, 0x44, 0x3a, 0x41, 0x3a, 0x3a, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x41, 0x3d, 0x41, 0x3d, 0x3d, 0x3d, 0x41, 0x3a, 0x41, 0x40, 0x3b, 0x40, 0x38, 0x3a, 0x3d, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x37, 0x38, 0x3a, 0x3a, 0x3c, 0x3a, 0x3e, 0x41, 0x37, 0x41, 0x36, 0x41, 0x41, 0x3a, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x43, 0x57, 0x82, 0x75, 0x76, 0x7a, 0x7c, 0x7a, 0x7a, 0x73, 0x7e, 0x69, 0x62, 0x20, 0x1d, 0x09, 0x10, 0x15, 0x10, 0x11, 0x13, 0x13, 0x13, 0x15, 0x10, 0x10, 0x12, 0x16, 0x1c, 0x20, 0x95, 0x7d, 0x71, 0x7a, 0x76, 0x75, 0x75, 0x6b, 0x5f, 0x5f, 0x5b, 0xc5, 0xcb, 0xf5, 0xeb, 0xec, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 
-  0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xeb, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xfc, 0xeb, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xfc, 0xeb, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf4, 0xf2, 0xf4, 0xf2, 0xf5, 0xf6, 0xe8, 0xec, 0xed, 0xca, 0xc9, 0x6c, 0x6b, 0x73, 0x73, 0x75, 0x73, 0x75, 0x73, 0x6f, 0x86, 0x20, 0x1e, 0x16, 0x10, 0x10, 0x10, 0x15, 0x10, 0x10, 0x13, 0x10, 0x13, 0x10, 0x10, 0x15, 0x15, 0x10, 0x17, 0x9a, 0x6d, 0x7a, 0x7a, 0x7a, 0x7e, 0x7a, 0x7c, 0x7a, 0x71, 0x91, 0x4a, 0x3f, 0x3a, 0x38, 0x39, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x37, 0x3a, 0x42, 0x37, 0x3d, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3c, 0x37, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3c, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3d, 0x3b, 0x3a, 0x3a, 0x3a, 0x41, 0x3c, 0x3c, 0x3a, 0x3a, 0x3a, 0x40, 0x3d, 0x40, 0x3c, 0x3a, 0x42, 0x4a, 0x88, 0x74, 0x75, 0x7c, 0x76, 0x7a, 0x7a, 0x73, 0x74, 0x7d, 0x62, 0x8f, 0x22, 0x15, 0x10, 0x15, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x15, 0x15, 0x15, 0x12, 0x15, 0x17, 0x1c, 0x9a, 0x6f, 0x77, 0x73, 0x73, 0x75, 0x74, 0x63, 0x63, 0x52, 0xb3, 0xce, 0x2d, 0xe8, 0xf5, 0xeb, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3, 0xfc, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf4, 0xf2, 0xf3, 0xfc, 0xf4, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3, 0xfc, 0xf4, 0xf3, 0xf2, 0xf1, 0xf3, 
-  0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf1, 0xf4, 0xf2, 0xf4, 0xf0, 0xf3, 0xf3, 0xf4, 0xf1, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf1, 0xf4, 0xf2, 0xf3, 0xf0, 0xf1, 0xeb, 0xf2, 0xf1, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf0, 0xf1, 0xf3, 0xeb, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf7, 0xf6, 0xe8, 0xed, 0xf2, 0xce, 0xbc, 0x67, 0x74, 0x76, 0x76, 0x76, 0x73, 0x73, 0x71, 0x6f, 0x9a, 0x1e, 0x15, 0x10, 0x10, 0x10, 0x13, 0x10, 0x13, 0x10, 0x13, 0x10, 0x13, 0x13, 0x15, 0x15, 0x10, 0x16, 0x1e, 0x86, 0x6f, 0x7e, 0x7a, 0x76, 0x7a, 0x7c, 0x7a, 0x7e, 0x7b, 0x79, 0x43, 0x3b, 0x39, 0x3c, 0x39, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x41, 0x3d, 0x41, 0x3d, 0x41, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3a, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3b, 0x3d, 0x3a, 0x3b, 0x38, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x40, 0x3a, 0x40, 0x3a, 0x3b, 0x3f, 0x6c, 0x72, 0x76, 0x76, 0x7c, 0x7a, 0x7e, 0x76, 0x76, 0x8c, 0x69, 0x6d, 0x22, 0x1a, 0x10, 0x10, 0x10, 0x13, 0x13, 0x13, 0x13, 0x10, 0x15, 0x10, 0x15, 0x15, 0x12, 0x12, 0x17, 0x1c, 0x94, 0x6f, 0x7d, 0x73, 0x71, 0x75, 0x69, 0x63, 0x5c, 0x96, 0xcb, 0x2d, 0xf5, 0xec, 0xea, 0xea, 0xf2, 0xf3, 0xf4, 0xeb, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf4, 0xf3, 0xf1, 0xeb, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf4, 0xf2, 0xf2, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf2, 0xf2, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf2, 0xf3, 0xf2, 0xf4, 0xf3, 0xf1, 0xeb, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf1, 0xeb, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 
-  0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf5, 0xf2, 0xeb, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xf4, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xeb, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf4, 0xf1, 0xf4, 0xf2, 0xf4, 0xf5, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf1, 0xf4, 0xf2, 0xf3, 0xf0, 0xf6, 0xd4, 0xe8, 0xec, 0xfc, 0xcb, 0xa0, 0x6b, 0x76, 0x76, 0x76, 0x73, 0x73, 0x71, 0x6f, 0x86, 0x1c, 0x16, 0x0c, 0x10, 0x13, 0x13, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x10, 0x11, 0x1a, 0xa5, 0x6f, 0x77, 0x7c, 0x76, 0x76, 0x7c, 0x7a, 0x7f, 0x7d, 0x91, 0x57, 0x3f, 0x3a, 0x37, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3c, 0x3a, 0x3a, 0x3c, 0x3a, 0x3c, 0x3a, 0x3a, 0x3a, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x40, 0x3b, 0x3a, 0x3b, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x37, 0x40, 0x38, 0x53, 0x82, 0x74, 0x7c, 0x76, 0x7a, 0x73, 0x80, 0x76, 0x80, 0x77, 0x62, 0x1c, 0x22, 0x18, 0x10, 0x10, 0x13, 0x11, 0x13, 0x11, 0x13, 0x15, 0x13, 0x15, 0x10, 0x15, 0x10, 0x10, 0x12, 0x1c, 0x94, 0x6f, 0x7d, 0x73, 0x74, 0x71, 0x69, 0x5f, 0x66, 0xc3, 0x31, 0xf1, 0xe8, 0xe8, 0xf2, 0xea, 0xf4, 0xf1, 0xeb, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf1, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xeb, 0xfc, 0xf1, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xfc, 0xf1, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf5, 0xfc, 0xea, 0xe8, 0xfc, 0xfd, 0xc9, 0x6c, 0x6b, 0x76, 0x76, 0x76, 0x75, 0x7d, 0x69, 0x86, 0x9a, 0x19, 0x11, 0x10, 0x13, 0x10, 0x13, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x11, 0x12, 0x18, 0x20, 0x19, 0x6f, 0x7f, 0x76, 0x7c, 0x76, 0x7a, 0x7c, 0x7a, 0x7d, 0x88, 0x4a, 0x38, 0x3c, 0x39, 0x3c, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x40, 0x40, 0x3a, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x40, 0x38, 0x4a, 0x79, 0x77, 0x7a, 0x7c, 0x7a, 0x7e, 0x7f, 0x73, 0x76, 0x7e, 0x69, 0x78, 0x22, 0x1e, 0x16, 0x10, 0x15, 0x11, 0x13, 0x13, 0x15, 0x10, 0x13, 0x10, 0x15, 0x11, 0x10, 0x15, 0x15, 0x8f, 0x1c, 0x6f, 0x77, 0x71, 0x74, 0x76, 0x6b, 0x6b, 0x5c, 0xbe, 0x31, 0xf3, 0xec, 0xe8, 0xea, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf0, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xfc, 0xf3, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xea, 0xea, 0xf2, 0x30, 0xc0, 0x67, 0x75, 0x75, 0x76, 0x75, 0x76, 0x77, 0x6f, 0x8f, 0x9a, 0x13, 0x11, 0x13, 0x13, 0x10, 0x13, 0x10, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x12, 0x16, 0x1e, 0x1e, 0x94, 0x6f, 0x7d, 0x7a, 0x7c, 0x7a, 0x7a, 0x7f, 0x7a, 0x8e, 0x72, 0x43, 0x3b, 0x39, 0x39, 0x3c, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3a, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x3a, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3a, 0x3d, 0x3a, 0x3b, 0x3a, 0x40, 0x3a, 0x40, 0x47, 0x6c, 0x7d, 0x7a, 0x7c, 0x73, 0x7e, 0x7a, 0x7a, 0x7a, 0x76, 0x77, 0x6d, 0x9a, 0x1e, 0x1d, 0x15, 0x10, 0x13, 0x10, 0x13, 0x13, 0x13, 0x10, 0x13, 0x13, 0x13, 0x10, 0x15, 0x15, 0x12, 0x94, 0x8e, 0x77, 0x73, 0x75, 0x74, 0x75, 0x6b, 0x5c, 0xab, 0x32, 0xf4, 0xec, 0xe8, 0xea, 0xea, 0xf1, 0xf4, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf1, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xeb, 0xfc, 0xf1, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xfc, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf1, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xfc, 0xf1, 0xf4, 0xf2, 0xf3, 0xf0, 0xf2, 0xea, 0xe8, 0xfd, 0x32, 0xbb, 0x67, 0x75, 0x74, 0x7e, 0x75, 0x73, 0x77, 0x6f, 0x9a, 0x19, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x15, 0x11, 0x18, 0x1e, 0x20, 0x86, 0x6f, 0x7a, 0x73, 0x7f, 0x7a, 0x7a, 0x7f, 0x7a, 0x82, 0x64, 0x3f, 0x3b, 0x37, 0x3c, 0x3a, 0x3b, 0x3a, 0x3d, 0x3a, 0x36, 0x3d, 0x3d, 0x38, 0x41, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x41, 0x41, 0x3d, 0x37, 0x3a, 0x3d, 0x3a, 0x40, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x3d, 0x3d, 0x3a, 0x3d, 0x40, 0x37, 0x40, 0x40, 0x42, 0x37, 0x42, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x41, 0x3a, 0x38, 0x3a, 0x3a, 0x3b, 0x45, 0x5a, 0x8e, 0x7a, 0x7c, 0x7e, 0x73, 0x7d, 0x7d, 0x7c, 0x74, 0x7a, 0x62, 0x9a, 0x20, 0x1d, 0x1a, 0x15, 0x11, 0x15, 0x10, 0x15, 0x13, 0x15, 0x13, 0x11, 0x13, 0x15, 0x15, 0x15, 0x12, 0x8f, 0x94, 0x77, 0x73, 0x75, 0x74, 0x75, 0x75, 0x5f, 0x96, 0x32, 0xf3, 0xe8, 0xea, 0xea, 0xea, 0xf3, 0xec, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xeb, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xeb, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf0, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xeb, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf2, 0xfc, 0xea, 0xe8, 0xea, 0x32, 0xa0, 0x72, 0x75, 0x74, 0x74, 0x74, 0x73, 0x71, 0x86, 0x19, 0x16, 0x11, 0x10, 0x11, 0x13, 0x11, 0x15, 0x13, 0x13, 0x13, 0x10, 0x13, 0x15, 0x10, 0x15, 0x16, 0x1d, 0x20, 0xa4, 0x6f, 0x77, 0x7f, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7d, 0x88, 0x53, 0x3b, 0x38, 0x3a, 0x38, 0x3c, 0x3c, 0x3a, 0x36, 0x41, 0x41, 0x3a, 0x3a, 0x35, 0x36, 0x35, 0x35, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37, 0x3c, 0x40, 0x3c, 0x3a, 0x3a, 0x3d, 0x3e, 0x3a, 0x3d, 0x40, 0x3c, 0x40, 0x3c, 0x40, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x38, 0x3a, 0x3a, 0x3a, 0x3c, 0x3d, 0x40, 0x40, 0x40, 0x3b, 0x38, 0x38, 0x3d, 0x3d, 0x3c, 0x37, 0x35, 0x35, 0x35, 0x35, 0x37, 0x3c, 0x3d, 0x37, 0x3d, 0x37, 0x3a, 0x41, 0x37, 0x40, 0x3c, 0x3a, 0x3c, 0x3c, 0x3f, 0x53, 0x91, 0x73, 0x7f, 0x76, 0x7e, 0x7a, 0x7a, 0x76, 0x80, 0x7e, 0x69, 0x8f, 0x22, 0x1d, 0x1d, 0x16, 0x10, 0x15, 0x15, 0x13, 0x15, 0x15, 0x13, 0x15, 0x11, 0x13, 0x15, 0x15, 0x15, 0x12, 0x19, 0x86, 0x73, 0x76, 0x75, 0x71, 0x75, 0x68, 0x70, 0xce, 0xca, 0xec, 0xf3, 0xf2, 0xf2, 0xe8, 0xeb, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf3, 0xf4, 0xf1, 0xf4, 0xf2, 0xf4, 0xf2, 0xf3, 0xf3, 0xf4, 0xf1, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xeb, 0xf2, 0xf1, 0xf2, 0xeb, 0xf3, 0xf4, 0xf1, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xeb, 0xf3, 0xf2, 0xf3, 0xf3, 0xf4, 0xf1, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xea, 0xe8, 0xfc, 0x30, 0xa0, 0x6b, 0x75, 0x7e, 0x74, 0x73, 0x74, 0x6f, 0x86, 0x19, 0x16, 0x15, 0x10, 0x13, 0x11, 0x13, 0x15, 0x13, 0x13, 0x13, 0x13, 0x13, 0x15, 0x10, 0x15, 0x1a, 0x1d, 0x1e, 0x9a, 0x6f, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7e, 0x88, 0x4f, 0x38, 0x3a, 0x38, 0x3a, 0x3a, 0x3c, 0x37, 0x41, 0x36, 0x41, 0x36, 0x37, 0x46, 0x35, 0x4d, 0x65, 0xa2, 0xb1, 0xb8, 0xa2, 0x6e, 0x49, 0x37, 0x37, 0x41, 0x41, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3c, 0x40, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x3d, 0x3d, 0x40, 0x3d, 0x3e, 0x41, 0x3a, 0x36, 0x34, 0x44, 0x4e, 0x54, 0x54, 0x49, 0x35, 0x35, 0x35, 0x41, 0x37, 0x3c, 0x3a, 0x3d, 0x37, 0x3a, 0x37, 0x3c, 0x39, 0x37, 0x3b, 0x4f, 0x82, 0x77, 0x7c, 0x7a, 0x7a, 0x7a, 0x7e, 0x7c, 0x7e, 0x73, 0x6f, 0x6d, 0x20, 0x1d, 0x1d, 0x1a, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x13, 0x13, 0x13, 0x12, 0x13, 0x15, 0x15, 0x12, 0x19, 0x86, 0x73, 0x76, 0x74, 0x73, 0x75, 0x63, 0x6c, 0xcc, 0xea, 0xeb, 0xf3, 0xf3, 0xf2, 0xec, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xeb, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf2, 0xf3, 0xf2, 0xf5, 0xea, 0xe8, 0xfc, 0x2f, 0x96, 0x6b, 0x75, 0x75, 0x71, 0x74, 0x71, 0x77, 0x86, 0x19, 0x12, 0x15, 0x13, 0x13, 0x11, 0x11, 0x15, 0x11, 0x13, 0x13, 0x13, 0x10, 0x13, 0x10, 0x16, 0x1d, 0x1d, 0x20, 0x94, 0x6f, 0x73, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7e, 0x79, 0x47, 0x38, 0x38, 0x3c, 0x37, 0x39, 0x37, 0x3c, 0x37, 0x3c, 0x3c, 0xcf, 0x60, 0x2d, 0xc2, 0xd3, 0xff, 0xc7, 0xd2, 0xd2, 0xc4, 0xc7, 0xc4, 0xb8, 0x49, 0x35, 0x37, 0x3c, 0x41, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3a, 0x3c, 0x34, 0x37, 0x6e, 0xb8, 0xc7, 0x2d, 0x2d, 0xca, 0xd3, 0xbf, 0x65, 0x44, 0x35, 0x49, 0x37, 0x40, 0x3c, 0x40, 0x34, 0x37, 0x3d, 0x37, 0x37, 0x38, 0x4a, 0x91, 0x7e, 0x7a, 0x7a, 0x73, 0x7d, 0x7a, 0x76, 0x7e, 0x7e, 0x77, 0x6d, 0x1e, 0x20, 0x1d, 0x1d, 0x18, 0x10, 0x15, 0x15, 0x15, 0x15, 0x13, 0x15, 0x11, 0x13, 0x15, 0x15, 0x15, 0x15, 0x94, 0x94, 0x73, 0x73, 0x76, 0x74, 0x76, 0x68, 0x6c, 0xcb, 0xca, 0xeb, 0xf1, 0xfc, 0xf3, 0xea, 0xeb, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xeb, 0xf4, 0xf3, 0xf3, 0xf2, 0xf2, 0xf5, 0xf1, 0xeb, 0xf4, 0xf3, 0xf3, 0xf2, 0xf2, 0xf5, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf5, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xeb, 0xf4, 0xf3, 0xf3, 0xf2, 0xf2, 0xf5, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf4, 0xd4, 0xea, 0xea, 0xfc, 0xcb, 0x97, 0x6b, 0x75, 0x76, 0x73, 0x74, 0x71, 0x77, 0x8f, 0x19, 0x10, 0x15, 0x13, 0x10, 0x11, 0x15, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x15, 0x1a, 0x1d, 0x1d, 0x20, 0x86, 0x6f, 0x7a, 0x7a, 0x73, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x79, 0x43, 0x38, 0x3e, 0x37, 0x39, 0x37, 0x34, 0x54, 0xa2, 0x35, 0xcf, 0x93, 0xd3, 0xee, 0xc2, 0x93, 0xd7, 0xd0, 0xcf, 0xd5, 0xd5, 0xd6, 0x65, 0xbd, 0xc4, 0x6e, 0x35, 0x39, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3e, 0x37, 0x35, 0x6e, 0xc2, 0xca, 0xd2, 0x93, 0x54, 0x4d, 0x54, 0x93, 0xbd, 0x2d, 0xc2, 0xc4, 0xb1, 0x35, 0x37, 0x37, 0x35, 0x60, 0x46, 0x37, 0x39, 0x37, 0x38, 0x47, 0x82, 0x7d, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7e, 0x77, 0x6d, 0x19, 0x1e, 0x1d, 0x1d, 0x1a, 0x15, 0x15, 0x15, 0x15, 0x15, 0x13, 0x11, 0x15, 0x11, 0x15, 0x15, 0x15, 0x12, 0x17, 0x95, 0x71, 0x73, 0x74, 0x71, 0x76, 0x6b, 0x64, 0xcb, 0xd4, 0xf1, 0xf3, 0xfd, 0xfc, 0xf1, 0xeb, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xf3, 0xf2, 0xf3, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xeb, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xeb, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xeb, 0xeb, 0xeb, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf2, 0xf5, 0xf5, 0xf2, 0xe8, 0xca, 0x2f, 0x85, 0x72, 0x76, 0x75, 0x7e, 0x74, 0x77, 0x77, 0x94, 0x17, 0x12, 0x15, 0x10, 0x10, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x13, 0x10, 0x16, 0x1d, 0x1d, 0x1d, 0x20, 0x6f, 0x6f, 0x7a, 0x7a, 0x73, 0x7a, 0x73, 0x7a, 0x7a, 0x71, 0x6c, 0x43, 0x38, 0x37, 0x39, 0x36, 0x39, 0x35, 0xcf, 0xbc, 0xdc, 0x9b, 0xfb, 0xe5, 0x54, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd7, 0xd7, 0x44, 0xd5, 0xd5, 0x60, 0xc2, 0xa2, 0xcf, 0x3c, 0x40, 0x41, 0x3a, 0x41, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x40, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3c, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3e, 0x3c, 0x36, 0x39, 0xa2, 0xfa, 0xbd, 0x49, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0x44, 0xb1, 0xff, 0xce, 0xac, 0xcf, 0xcf, 0x93, 0xc4, 0x49, 0x38, 0x37, 0x39, 0x38, 0x47, 0x88, 0x7e, 0x73, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7e, 0x7e, 0x7d, 0x6f, 0x86, 0x20, 0x1d, 0x1d, 0x1d, 0x16, 0x10, 0x15, 0x15, 0x15, 0x13, 0x15, 0x13, 0x13, 0x15, 0x15, 0x15, 0x15, 0x17, 0x95, 0x77, 0x73, 0x73, 0x71, 0x76, 0x6b, 0x6c, 0xc9, 0xcd, 0xf0, 0xfc, 0x2d, 0xf4, 0xf1, 0xeb, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf2, 0xf4, 0xea, 0xea, 0xfd, 0xcb, 0x97, 0x6b, 0x75, 0x76, 0x73, 0x7e, 0x71, 0x6f, 0x94, 0x19, 0x11, 0x15, 0x15, 0x13, 0x11, 0x11, 0x11, 0x10, 0x13, 0x11, 0x11, 0x13, 0x10, 0x18, 0x1d, 0x1d, 0x1e, 0x1c, 0x6f, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x73, 0x7a, 0x82, 0x72, 0x3f, 0x38, 0x3e, 0x39, 0x34, 0x6e, 0xc2, 0x4d, 0x44, 0xca, 0xfa, 0xdc, 0xd5, 0xd5, 0xd6, 0xd5, 0xd8, 0xdc, 0xe5, 0xef, 0xfa, 0xf7, 0xe5, 0xa2, 0xd7, 0x34, 0xbd, 0x6e, 0x34, 0x42, 0x37, 0x3d, 0x42, 0x37, 0x3d, 0x3d, 0x40, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3c, 0x3d, 0x3d, 0x3d, 0x3b, 0x3a, 0x41, 0x35, 0x36, 0xd2, 0xc7, 0x54, 0xd6, 0x65, 0xdc, 0xbd, 0xbd, 0xbd, 0x93, 0x4d, 0xd5, 0xd5, 0xd5, 0x49, 0xd2, 0xcd, 0xbf, 0xb1, 0xc4, 0x4d, 0x34, 0x37, 0x35, 0x39, 0x38, 0x43, 0x72, 0x81, 0x7f, 0x73, 0x7a, 0x7a, 0x7a, 0x7d, 0x7a, 0x7e, 0x7e, 0x6d, 0x86, 0x1e, 0x1d, 0x1d, 0x1d, 0x1a, 0x10, 0x15, 0x15, 0x13, 0x13, 0x13, 0x13, 0x15, 0x10, 0x15, 0x15, 0x10, 0x19, 0x94, 0x73, 0x73, 0x73, 0x71, 0x73, 0x6b, 0x6c, 0xcc, 0xca, 0xf4, 0xf1, 0xfd, 0xfc, 0xf2, 0xeb, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf1, 0xf3, 0xf2, 0xe8, 0xca, 0x2f, 0x96, 0x7b, 0x75, 0x76, 0x71, 0x75, 0x77, 0x77, 0x8f, 0x19, 0x12, 0x15, 0x10, 0x13, 0x13, 0x11, 0x10, 0x11, 0x13, 0x11, 0x13, 0x13, 0x11, 0x1a, 0x1d, 0x1d, 0x1e, 0x1c, 0x6f, 0x77, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x6c, 0x43, 0x38, 0x37, 0x39, 0x34, 0x49, 0xff, 0x2d, 0xbd, 0xca, 0xa2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xe7, 0xf9, 0xfb, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xf2, 0xd1, 0xd5, 0xbd, 0x4d, 0x34, 0x3a, 0x45, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x37, 0x37, 0xdc, 0xc7, 0xd0, 0x65, 0xe5, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xee, 0x93, 0xd5, 0xd5, 0xd5, 0xd5, 0xbd, 0xcd, 0xff, 0x65, 0xd5, 0x34, 0x36, 0x41, 0xd0, 0x36, 0x43, 0x72, 0x7d, 0x7e, 0x76, 0x7a, 0x7c, 0x7a, 0x7a, 0x7d, 0x7e, 0x7e, 0x73, 0x6f, 0x1e, 0x1e, 0x1d, 0x1d, 0x1a, 0x13, 0x15, 0x15, 0x10, 0x15, 0x15, 0x13, 0x15, 0x13, 0x15, 0x15, 0x15, 0x94, 0x86, 0x77, 0x73, 0x74, 0x71, 0x76, 0x6b, 0x6c, 0xcc, 0xcd, 0xf1, 0xf4, 0xfc, 0xfc, 0xf3, 0xeb, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xea, 0xea, 0xfc, 0x30, 0xa0, 0x7b, 0x75, 0x73, 0x71, 0x75, 0x71, 0x77, 0x86, 0x19, 0x12, 0x10, 0x13, 0x13, 0x11, 0x12, 0x10, 0x13, 0x11, 0x11, 0x13, 0x11, 0x13, 0x1d, 0x1d, 0x1d, 0x1e, 0x9a, 0x6f, 0x7a, 0x73, 0x76, 0x7a, 0x7a, 0x73, 0x7a, 0x7a, 0x77, 0x6c, 0x43, 0x3b, 0x39, 0x41, 0x37, 0x34, 0x36, 0xc2, 0xfb, 0xd1, 0xd5, 0xd5, 0xd5, 0xda, 0xe5, 0xfb, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xef, 0xfa, 0xf9, 0xf8, 0xf9, 0xd2, 0x49, 0xb8, 0x35, 0x41, 0x37, 0x41, 0x41, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3c, 0x3c, 0x3a, 0x3d, 0x40, 0x3a, 0x46, 0x34, 0xd1, 0xf0, 0xd0, 0xb1, 0xfb, 0xfb, 0xef, 0xf9, 0xef, 0xfa, 0xfa, 0xfa, 0xef, 0xfa, 0xd2, 0xd7, 0xd5, 0xd5, 0xd5, 0xdc, 0xc7, 0x60, 0xa2, 0xac, 0x41, 0x35, 0x37, 0x3d, 0x3f, 0x72, 0x7b, 0x7a, 0x7a, 0x8b, 0x76, 0x7a, 0x7d, 0x7d, 0x77, 0x7e, 0x77, 0x6f, 0x1c, 0x1d, 0x1d, 0x1d, 0x1a, 0x16, 0x15, 0x15, 0x15, 0x13, 0x13, 0x15, 0x13, 0x15, 0x15, 0x15, 0x12, 0x19, 0x86, 0x73, 0x76, 0x73, 0x74, 0x7e, 0x63, 0x96, 0xce, 0xf2, 0xeb, 0xf1, 0xfc, 0xf2, 0xea, 0xeb, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xea, 0xe8, 0xf2, 0x30, 0x24, 0x68, 0x75, 0x74, 0x71, 0x75, 0x71, 0x77, 0x86, 0x19, 0x16, 0x10, 0x10, 0x13, 0x11, 0x11, 0x11, 0x13, 0x11, 0x11, 0x13, 0x11, 0x16, 0x1d, 0x1d, 0x1e, 0x1e, 0x19, 0x6f, 0x77, 0x76, 0x7a, 0x76, 0x7a, 0x73, 0x7a, 0x7a, 0x71, 0x6c, 0x43, 0x38, 0x3e, 0x35, 0x39, 0x39, 0xd5, 0xa2, 0xb8, 0xd5, 0xd5, 0xd6, 0xda, 0xe7, 0xe3, 0xc2, 0xfa, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xf8, 0xfa, 0xef, 0xfb, 0xe0, 0xac, 0x4e, 0x3a, 0x37, 0x45, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3c, 0x38, 0x3d, 0x3d, 0x3b, 0x40, 0x37, 0x37, 0xc4, 0x54, 0xdc, 0xfb, 0xfa, 0xf8, 0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xf8, 0xfb, 0xfb, 0xe7, 0xdb, 0xd7, 0xd5, 0xd5, 0xd5, 0xbd, 0xee, 0xd2, 0x4e, 0x3c, 0x37, 0xd0, 0x36, 0x43, 0x6c, 0x77, 0x7e, 0x76, 0x7a, 0x7c, 0x7a, 0x7d, 0x7d, 0x7d, 0x7e, 0x73, 0x6f, 0x9a, 0x1d, 0x1d, 0x1d, 0x1d, 0x16, 0x15, 0x15, 0x10, 0x13, 0x15, 0x13, 0x15, 0x13, 0x16, 0x15, 0x15, 0x94, 0x86, 0x69, 0x76, 0x74, 0x73, 0x71, 0x72, 0xa0, 0x32, 0xfc, 0xec, 0xf3, 0xf3, 0xf2, 0xea, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xea, 0xed, 0xf4, 0x30, 0xbe, 0x68, 0x75, 0x71, 0x74, 0x71, 0x75, 0x77, 0x6f, 0x19, 0x17, 0x10, 0x10, 0x15, 0x0c, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x1d, 0x1d, 0x1d, 0x20, 0x94, 0x6d, 0x7a, 0x73, 0x76, 0x7a, 0x7a, 0x73, 0x7a, 0x73, 0x77, 0x72, 0x47, 0x38, 0x38, 0x39, 0x41, 0x34, 0x65, 0xb8, 0xd5, 0xd5, 0xd5, 0xda, 0xe5, 0xd9, 0xd5, 0xd5, 0xe7, 0xfb, 0xfa, 0x33, 0xf9, 0xfa, 0xfa, 0xfa, 0xf5, 0xe5, 0xf8, 0xfb, 0xbd, 0xac, 0x37, 0x41, 0x3a, 0x41, 0x3d, 0x3a, 0x3d, 0x3e, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3c, 0x3c, 0x3d, 0x3d, 0x40, 0x40, 0x35, 0x93, 0xbd, 0x60, 0xfb, 0xf9, 0xfb, 0xf9, 0xfa, 0xef, 0xfa, 0xfa, 0xfa, 0xfb, 0xc2, 0xe0, 0xe3, 0xa2, 0xdb, 0xd9, 0xd5, 0xd5, 0xd5, 0xbd, 0x93, 0xcf, 0x36, 0x37, 0x37, 0x36, 0x43, 0x72, 0x7b, 0x73, 0x7a, 0x7a, 0x76, 0x7a, 0x7d, 0x7d, 0x7d, 0x76, 0x7e, 0x6f, 0x9a, 0x1d, 0x1a, 0x1d, 0x1d, 0x18, 0x10, 0x15, 0x13, 0x15, 0x13, 0x15, 0x13, 0x16, 0x15, 0x12, 0x16, 0x94, 0x6f, 0x73, 0x73, 0x75, 0x74, 0x73, 0x72, 0xab, 0x33, 0xf2, 0xec, 0xf1, 0xf2, 0xf2, 0xe8, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xfd, 0xcc, 0xc6, 0x64, 0x6b, 0x74, 0x73, 0x75, 0x75, 0x73, 0x77, 0x86, 0x17, 0x15, 0x10, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x1d, 0x1d, 0x1e, 0x1e, 0x9a, 0x6f, 0x77, 0x73, 0x7a, 0x73, 0x7a, 0x73, 0x7a, 0x7c, 0x73, 0x79, 0x47, 0x36, 0x38, 0x3c, 0x35, 0x60, 0xc4, 0x54, 0xd5, 0xd5, 0xd6, 0xe2, 0xda, 0xd5, 0xcf, 0xd5, 0xc2, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xe7, 0x35, 0xa2, 0xfa, 0xfb, 0xc2, 0x49, 0x35, 0x41, 0x3a, 0x3a, 0x3d, 0x3d, 0x3c, 0x3e, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3c, 0x3a, 0x40, 0x40, 0x40, 0x37, 0x39, 0xbd, 0xdc, 0xc7, 0xfa, 0xfb, 0xfa, 0xfa, 0xfb, 0xfa, 0xfa, 0xf7, 0xfb, 0xdc, 0xd5, 0xcf, 0xd7, 0xdb, 0xdd, 0xe1, 0xd9, 0xd5, 0xd5, 0xd7, 0xc2, 0x49, 0x3d, 0x35, 0xd0, 0x36, 0x47, 0x72, 0x7a, 0x7f, 0x7a, 0x74, 0x7d, 0x7a, 0x7d, 0x7a, 0x7a, 0x80, 0x7a, 0x6d, 0x9a, 0x1e, 0x1e, 0x1d, 0x1e, 0x18, 0x10, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x94, 0x86, 0x71, 0x6b, 0x6b, 0x75, 0x74, 0x74, 0x6c, 0xbe, 0xce, 0xea, 0xeb, 0xfc, 0x2d, 0xfc, 0xec, 0xea, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xfd, 0xca, 0xcb, 0x8a, 0x72, 0x7e, 0x76, 0x74, 0x75, 0x73, 0x73, 0x86, 0x19, 0x16, 0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x1d, 0x1d, 0x1e, 0x20, 0x9a, 0x6d, 0x7a, 0x77, 0x73, 0x7a, 0x73, 0x7a, 0x73, 0x8d, 0x73, 0x88, 0x4b, 0x36, 0x39, 0x37, 0xcf, 0xa2, 0xbd, 0x35, 0xcf, 0xd5, 0xda, 0xe4, 0xd8, 0xd5, 0xd5, 0x44, 0xed, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xe7, 0xd5, 0xd5, 0xfb, 0xfb, 0xe7, 0xd1, 0x35, 0x3e, 0x41, 0x3d, 0x40, 0x3c, 0x3e, 0x3c, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x40, 0x40, 0x40, 0x39, 0x44, 0xca, 0xee, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfb, 0x60, 0xd5, 0xd5, 0xd5, 0xdf, 0xdf, 0xdd, 0xdd, 0xd6, 0xcf, 0xd5, 0xa2, 0xb1, 0x34, 0x35, 0x35, 0x38, 0x4b, 0x82, 0x73, 0x7c, 0x7e, 0x71, 0x7a, 0x7d, 0x7a, 0x7a, 0x76, 0x80, 0x77, 0x6f, 0x9a, 0x1e, 0x1e, 0x1a, 0x1d, 0x18, 0x10, 0x10, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x17, 0x94, 0x7d, 0x69, 0x74, 0x6b, 0x75, 0x74, 0x74, 0x79, 0xc6, 0xcd, 0xea, 0xec, 0x2d, 0xfd, 0x2d, 0xec, 0xec, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xca, 0xce, 0xb3, 0x68, 0x74, 0x76, 0x76, 0x74, 0x73, 0x6f, 0x6f, 0x94, 0x19, 0x16, 0x10, 0x10, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0x1c, 0x6f, 0x77, 0x76, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7c, 0x73, 0x79, 0x53, 0x36, 0x38, 0x39, 0x34, 0xa2, 0x6e, 0xd5, 0xd5, 0xd6, 0xdb, 0xe2, 0xe4, 0xb1, 0x93, 0xc2, 0xfa, 0xf8, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xc2, 0xc2, 0xfa, 0xfa, 0xfb, 0xdc, 0x34, 0x38, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3e, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3c, 0x3a, 0x40, 0x40, 0x40, 0x35, 0x54, 0xfb, 0xfa, 0xef, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xf9, 0xfb, 0xf0, 0xa2, 0x93, 0xd2, 0xfb, 0xe4, 0xdd, 0xdf, 0xda, 0xd5, 0xcf, 0x44, 0xb1, 0x44, 0x35, 0x35, 0x38, 0x4f, 0x82, 0x7a, 0x73, 0x7a, 0x71, 0x7d, 0x7a, 0x7a, 0x73, 0x7a, 0x7a, 0x7d, 0x6d, 0x1c, 0x1d, 0x1e, 0x1e, 0x1d, 0x18, 0x11, 0x15, 0x10, 0x15, 0x15, 0x15, 0x15, 0x15, 0x10, 0x19, 0x86, 0x6f, 0x71, 0x6b, 0x73, 0x74, 0x71, 0x68, 0xa0, 0x30, 0xca, 0xed, 0xeb, 0xf1, 0xca, 0xfc, 0xeb, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xea, 0xea, 0xe8, 0xce, 0xc1, 0x72, 0x69, 0x76, 0x75, 0x71, 0x73, 0x6f, 0x6f, 0x86, 0x94, 0x19, 0x10, 0x15, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x6f, 0x73, 0x73, 0x76, 0x76, 0x73, 0x7a, 0x73, 0x7c, 0x73, 0x72, 0x5b, 0x38, 0x36, 0x35, 0x35, 0xdc, 0x4d, 0xd5, 0xd5, 0xd6, 0xdf, 0xde, 0xe6, 0xfb, 0xfb, 0xfb, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xff, 0xef, 0xfb, 0xbd, 0x34, 0x41, 0x3d, 0x3d, 0x40, 0x3d, 0x3c, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x40, 0x40, 0x40, 0x35, 0xd1, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfb, 0xfa, 0xe5, 0xdd, 0xde, 0xdb, 0xd5, 0x35, 0xd5, 0x93, 0x54, 0x34, 0x35, 0x38, 0x5b, 0x82, 0x7a, 0x76, 0x73, 0x7e, 0x73, 0x7a, 0x73, 0x7e, 0x73, 0x7e, 0x7d, 0x6f, 0x1e, 0x1a, 0x1d, 0x1a, 0x1d, 0x18, 0x10, 0x10, 0x15, 0x15, 0x15, 0x15, 0x15, 0x13, 0x17, 0x17, 0x6f, 0x6f, 0x73, 0x73, 0x74, 0x73, 0x71, 0x5d, 0xbe, 0xcc, 0xea, 0xee, 0xec, 0xf4, 0xfd, 0xfc, 0xeb, 0xeb, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xea, 0xea, 0xe8, 0xed, 0xf1, 0x32, 0xa0, 0x69, 0x75, 0x75, 0x75, 0x77, 0x73, 0x77, 0x73, 0x77, 0x86, 0x19, 0x15, 0x10, 0x10, 0x11, 0x10, 0x11, 0x10, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x6d, 0x77, 0x76, 0x76, 0x76, 0x73, 0x74, 0x73, 0x7c, 0x7a, 0x7b, 0x6c, 0x43, 0x38, 0x3c, 0x39, 0xb1, 0xd7, 0xd5, 0xd5, 0xd8, 0xdf, 0xde, 0xe6, 0xfa, 0x33, 0xff, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xff, 0xfa, 0xfb, 0xfa, 0xfb, 0xd2, 0x34, 0x36, 0x41, 0x40, 0x3d, 0x3d, 0x3d, 0x3e, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3c, 0x3a, 0x40, 0x40, 0x40, 0x35, 0xd1, 0xfb, 0xef, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xfa, 0xf9, 0xfb, 0xf9, 0xef, 0xff, 0xfb, 0xe9, 0xde, 0xde, 0xdd, 0xd5, 0xcf, 0xd5, 0x60, 0x60, 0xcf, 0x36, 0x43, 0x6c, 0x7b, 0x73, 0x7c, 0x7a, 0x73, 0x7a, 0x7a, 0x7e, 0x7a, 0x73, 0x7d, 0x7d, 0x6d, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x15, 0x10, 0x15, 0x15, 0x13, 0x13, 0x12, 0x8f, 0x19, 0x78, 0x6f, 0x71, 0x76, 0x76, 0x76, 0x74, 0x6b, 0x85, 0xc9, 0xcc, 0xea, 0xed, 0xec, 0xf1, 0xf2, 0xf2, 0xf3, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xea, 0xea, 0xe8, 0xec, 0xf1, 0x32, 0xbe, 0x72, 0x6b, 0x75, 0x74, 0x73, 0x69, 0x76, 0x76, 0x76, 0x77, 0x94, 0x19, 0x16, 0x15, 0x0b, 0x11, 0x13, 0x10, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x20, 0x6f, 0x73, 0x76, 0x75, 0x76, 0x75, 0x73, 0x73, 0x7a, 0x73, 0x71, 0x72, 0x4a, 0x38, 0x36, 0x44, 0xb1, 0xd6, 0xcf, 0xd5, 0xd9, 0xe2, 0xde, 0xe6, 0xf9, 0xfa, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xbd, 0x34, 0x36, 0x41, 0x40, 0x40, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x40, 0x40, 0x40, 0x34, 0x93, 0xfb, 0xef, 0xfa, 0xfa, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfb, 0xfa, 0xfb, 0xfb, 0xfb, 0xfa, 0x33, 0xfa, 0xe9, 0xde, 0xde, 0xdd, 0xd5, 0x35, 0xd5, 0x4d, 0x54, 0x34, 0x34, 0x4f, 0x79, 0x71, 0x7a, 0x76, 0x7a, 0x73, 0x76, 0x7a, 0x73, 0x7e, 0x73, 0x7e, 0x6f, 0x86, 0x1c, 0x1d, 0x1d, 0x1a, 0x1d, 0x1a, 0x10, 0x15, 0x13, 0x10, 0x13, 0x16, 0x17, 0x8f, 0x8e, 0x6d, 0x71, 0x76, 0x76, 0x76, 0x75, 0x6b, 0x68, 0xb3, 0xce, 0xca, 0xe8, 0xec, 0xec, 0xeb, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xea, 0xe8, 0xec, 0xf5, 0xf0, 0x2f, 0xa0, 0x68, 0x6b, 0x6b, 0x75, 0x75, 0x76, 0x76, 0x76, 0x73, 0x6f, 0x8f, 0x19, 0x19, 0x18, 0x12, 0x11, 0x0c, 0x16, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0xa5, 0x95, 0x69, 0x76, 0x76, 0x76, 0x73, 0x73, 0x73, 0x7a, 0x73, 0x77, 0x7b, 0x57, 0x3f, 0x36, 0x44, 0xa2, 0xcf, 0xd5, 0xd5, 0xd8, 0xe2, 0xde, 0xe6, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfb, 0xb8, 0xcf, 0x36, 0x3d, 0x40, 0x3a, 0x40, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3c, 0x3a, 0x40, 0x40, 0x40, 0x35, 0x6e, 0xfa, 0xfb, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xf9, 0xfb, 0xe9, 0xdd, 0xde, 0xde, 0xd5, 0x35, 0xd5, 0xd7, 0x54, 0x34, 0x38, 0x57, 0x7b, 0x71, 0x76, 0x7c, 0x76, 0x7e, 0x76, 0x76, 0x7e, 0x73, 0x71, 0x71, 0x7d, 0x20, 0x19, 0x1d, 0x1d, 0x1d, 0x1d, 0x16, 0x10, 0x12, 0x10, 0x12, 0x17, 0x17, 0x8f, 0x77, 0x71, 0x69, 0x6b, 0x75, 0x76, 0x76, 0x75, 0x72, 0x85, 0xc5, 0xcd, 0xfd, 0xf2, 0xf5, 0xe8, 0xf1, 0xeb, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xeb, 0xec, 0xec, 0x2e, 0xcc, 0xc6, 0x66, 0x74, 0x74, 0x6b, 0x69, 0x75, 0x75, 0x76, 0x73, 0x71, 0x6f, 0x86, 0x8f, 0x19, 0x9a, 0x19, 0x19, 0x1a, 0x1d, 0x1e, 0x1d, 0x22, 0xb6, 0xb7, 0x8e, 0x69, 0x73, 0x76, 0x73, 0x7a, 0x73, 0x7a, 0x73, 0x7a, 0x73, 0x7b, 0x67, 0x47, 0x36, 0x46, 0xa2, 0xcf, 0xcf, 0xd5, 0xd8, 0xe2, 0xde, 0xe4, 0xfa, 0xff, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfa, 0xfb, 0xfb, 0xfa, 0xfb, 0x93, 0x34, 0x3e, 0x3d, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x40, 0x40, 0x3a, 0x37, 0x54, 0xfa, 0xfb, 0xef, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfb, 0xfb, 0x33, 0xfa, 0xe6, 0xdd, 0xe2, 0xdd, 0xd5, 0x34, 0xcf, 0xd6, 0x54, 0x34, 0x47, 0x6c, 0x7b, 0x73, 0x7a, 0x76, 0x7e, 0x76, 0x7a, 0x76, 0x73, 0x74, 0x7e, 0x71, 0x98, 0x25, 0xb2, 0x1a, 0x1a, 0x1e, 0x1d, 0x17, 0x0f, 0x12, 0x8f, 0x8f, 0x8f, 0x8f, 0x6f, 0x71, 0x71, 0x74, 0x6b, 0x75, 0x76, 0x75, 0x74, 0x5e, 0xbb, 0xce, 0x2d, 0xf0, 0xf3, 0xf3, 0xec, 0xeb, 0xec, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf0, 0xd4, 0xc8, 0x33, 0xb3, 0x72, 0x68, 0x83, 0x6b, 0x75, 0x69, 0x76, 0x71, 0x73, 0x71, 0x69, 0x6f, 0x6f, 0x86, 0x9a, 0x19, 0x9a, 0x1c, 0x22, 0xb9, 0x26, 0xa5, 0x78, 0x55, 0x69, 0x75, 0x73, 0x77, 0x73, 0x7a, 0x73, 0x7a, 0x73, 0x73, 0x7a, 0x82, 0x4a, 0x38, 0x46, 0x93, 0x34, 0xcf, 0xcf, 0xd6, 0xdf, 0xde, 0xe2, 0xfb, 0xf9, 0xfa, 0xfa, 0xf9, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xef, 0x60, 0xcf, 0x3e, 0x38, 0x40, 0x40, 0x3d, 0x3d, 0x40, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3c, 0x3a, 0x40, 0x40, 0x40, 0x35, 0x4d, 0xd3, 0xfb, 0xf9, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfb, 0xfb, 0x33, 0xfa, 0xef, 0xe4, 0xdd, 0xe4, 0xdb, 0xd5, 0xcf, 0xcf, 0xd0, 0x49, 0x34, 0x50, 0x8e, 0x71, 0x76, 0x76, 0x7c, 0x76, 0x7e, 0x76, 0x76, 0x73, 0x74, 0x74, 0x71, 0xae, 0x26, 0xb9, 0xb6, 0x22, 0x20, 0x22, 0xaf, 0xaf, 0xa5, 0x86, 0x86, 0x78, 0x71, 0x71, 0x76, 0x73, 0x74, 0x74, 0x6b, 0x76, 0x71, 0x5d, 0xab, 0xcb, 0xcd, 0xf1, 0xfd, 0x2d, 0xf0, 0xf5, 0xeb, 0xec, 0xeb, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xfd, 0xfd, 0xf4, 0xca, 0xf0, 0xd4, 0xfc, 0x2f, 0x24, 0x62, 0x6b, 0x6b, 0x6b, 0x71, 0x71, 0x71, 0x74, 0x75, 0x76, 0x73, 0x71, 0x6f, 0x6f, 0x6f, 0x94, 0xaf, 0x26, 0x25, 0xae, 0x69, 0x5f, 0x69, 0x75, 0x71, 0x73, 0x77, 0x7a, 0x73, 0x7a, 0x73, 0x73, 0x76, 0x73, 0x7b, 0x64, 0x47, 0x39, 0x93, 0x37, 0xcf, 0xd5, 0xd6, 0xdb, 0xe2, 0xdd, 0xed, 0xfb, 0xff, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfa, 0xfa, 0xfb, 0xfb, 0xc2, 0xd7, 0x39, 0x36, 0x41, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x40, 0x40, 0x40, 0x37, 0x39, 0xbd, 0xfa, 0xfa, 0xfb, 0xfa, 0xfb, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfb, 0xfb, 0xfa, 0x32, 0xfa, 0xed, 0xdf, 0xdf, 0xe4, 0xda, 0xd5, 0x34, 0xcf, 0xd0, 0xd0, 0x47, 0x6c, 0x7b, 0x73, 0x7c, 0x7c, 0x76, 0x7e, 0x76, 0x80, 0x76, 0x7e, 0x69, 0x69, 0x63, 0xa3, 0xb9, 0xb6, 0x26, 0x25, 0xb9, 0xb6, 0xb6, 0x9a, 0x6f, 0x6f, 0x71, 0x73, 0x74, 0x76, 0x7c, 0x71, 0x74, 0x6b, 0x74, 0x77, 0x6b, 0x97, 0xc9, 0x2e, 0xf0, 0xfd, 0xfd, 0xfd, 0xca, 0xf1, 0xeb, 0xec, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf1, 0xf4, 0xf2, 0xd4, 0xf0, 0xf0, 0x31, 0x2f, 0x96, 0x67, 0x6b, 0x71, 0x7a, 0x73, 0x69, 0x69, 0x75, 0x75, 0x73, 0x74, 0x71, 0x71, 0x71, 0x69, 0x77, 0x8c, 0x92, 0x71, 0x63, 0x63, 0x63, 0x7e, 0x7e, 0x77, 0x73, 0x77, 0x7c, 0x7a, 0x7c, 0x7a, 0x73, 0x73, 0x78, 0x85, 0x58, 0x3b, 0x8a, 0x44, 0x34, 0xcf, 0xd5, 0xd9, 0xe4, 0xdd, 0xe3, 0xfa, 0xef, 0xfa, 0x33, 0x33, 0x33, 0xfb, 0xfb, 0x33, 0xf9, 0xfb, 0xf9, 0xfb, 0xfb, 0xfb, 0x93, 0xcf, 0x3c, 0x3c, 0x3d, 0x40, 0x42, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x42, 0x42, 0x3d, 0x3a, 0x42, 0x41, 0x3e, 0x40, 0x40, 0x42, 0x40, 0x40, 0x41, 0x35, 0x93, 0xee, 0xef, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfb, 0x33, 0xfa, 0xe6, 0xdd, 0xe2, 0xe4, 0xd8, 0xd5, 0x34, 0x34, 0x34, 0x34, 0x53, 0x88, 0x83, 0x73, 0x7c, 0x76, 0x7c, 0x73, 0x7e, 0x76, 0x7e, 0x76, 0x73, 0x5f, 0x5f, 0x5c, 0x9d, 0x9d, 0x84, 0x99, 0x92, 0x7d, 0x73, 0x71, 0x73, 0x77, 0x73, 0x73, 0x75, 0x76, 0x73, 0x7a, 0x71, 0x71, 0x82, 0x68, 0x85, 0xc3, 0xce, 0xf0, 0xec, 0xf1, 0xf0, 0xfd, 0xfc, 0xf2, 0xf3, 0xeb, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf2, 0xcc, 0x30, 0xab, 0x5d, 0x71, 0x69, 0x76, 0x76, 0x76, 0x6b, 0x69, 0x73, 0x6b, 0x73, 0x6b, 0x71, 0x74, 0x73, 0x83, 0x83, 0x63, 0x5f, 0x69, 0x77, 0x7d, 0x7a, 0x7e, 0x73, 0x73, 0x7a, 0x7a, 0x7a, 0x77, 0x7d, 0x7b, 0x82, 0x6c, 0x70, 0x58, 0x70, 0x4e, 0xcf, 0xd0, 0xd5, 0xd6, 0xdb, 0xe4, 0xdb, 0xe6, 0xfa, 0xf7, 0xf7, 0xfb, 0x33, 0xf9, 0xf9, 0xfa, 0xfa, 0xef, 0xef, 0xfa, 0xef, 0xd2, 0xd0, 0x35, 0x39, 0x41, 0x3a, 0x38, 0x38, 0x42, 0x41, 0x38, 0x3c, 0x3d, 0x3a, 0x41, 0x3d, 0x45, 0x42, 0x38, 0x36, 0x3e, 0x42, 0x42, 0x3a, 0x3d, 0x3a, 0x3a, 0x35, 0x44, 0xc2, 0xe8, 0xef, 0xfa, 0xfa, 0xfb, 0xfb, 0xff, 0x33, 0x33, 0xfb, 0xfb, 0xfa, 0xfa, 0xe9, 0xdf, 0xe2, 0xe4, 0xdb, 0xd5, 0x34, 0x35, 0xcf, 0x34, 0x58, 0x96, 0x68, 0x71, 0x76, 0x76, 0x7a, 0x7a, 0x73, 0x7a, 0x7e, 0x73, 0x80, 0x7a, 0x73, 0x5f, 0x55, 0x5f, 0x83, 0x75, 0x73, 0x7c, 0x76, 0x75, 0x6b, 0x74, 0x74, 0x77, 0x73, 0x73, 0x76, 0x7f, 0x73, 0x7e, 0x74, 0x67, 0x85, 0xc6, 0xce, 0x2d, 0xec, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf0, 0xea, 0xcc, 0xcc, 0xba, 0x5d, 0x69, 0x71, 0x73, 0x69, 0x76, 0x76, 0x71, 0x73, 0x73, 0x73, 0x73, 0x77, 0x7d, 0x8c, 0x7d, 0x63, 0x5f, 0x71, 0x7e, 0x7a, 0x7a, 0x77, 0x7e, 0x71, 0x77, 0x7d, 0x82, 0x78, 0x67, 0x59, 0x4a, 0x47, 0x47, 0x47, 0x61, 0x6e, 0x36, 0xcf, 0xd0, 0xd5, 0xd8, 0xe1, 0xdf, 0xdb, 0xe9, 0xfa, 0xef, 0xef, 0xfa, 0xfa, 0xfb, 0xfa, 0xef, 0xfa, 0xef, 0xef, 0xd2, 0x60, 0xcf, 0x3c, 0x39, 0x3a, 0x36, 0x41, 0x41, 0x36, 0x3e, 0x49, 0x49, 0x48, 0x49, 0x45, 0x41, 0x41, 0x42, 0x49, 0x4e, 0x41, 0x38, 0x36, 0x3b, 0x36, 0x38, 0x3c, 0x45, 0x34, 0x65, 0xd3, 0xd3, 0xee, 0xfb, 0xfb, 0xff, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xef, 0xe3, 0xdf, 0xe4, 0xe4, 0xd7, 0xd5, 0x35, 0x35, 0xcf, 0x44, 0x65, 0x66, 0x6c, 0x82, 0x81, 0x71, 0x7e, 0x71, 0x7a, 0x80, 0x7a, 0x7a, 0x76, 0x89, 0x76, 0x6b, 0x63, 0x55, 0x69, 0x83, 0x73, 0x7e, 0x74, 0x74, 0x6b, 0x74, 0x71, 0x77, 0x73, 0x74, 0x74, 0x76, 0x73, 0x6b, 0x5d, 0xa0, 0xc6, 0x30, 0xc8, 0xf6, 0xea, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xeb, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xec, 0xed, 0xf2, 0xcd, 0xcb, 0xc3, 0x85, 0x62, 0x69, 0x71, 0x71, 0x69, 0x76, 0x73, 0x76, 0x73, 0x73, 0x7a, 0x8c, 0x86, 0x69, 0x62, 0x6b, 0x71, 0x7a, 0x73, 0x7f, 0x7a, 0x71, 0x7b, 0x82, 0x72, 0x57, 0x4a, 0x3f, 0x3f, 0x3f, 0x3f, 0x42, 0x38, 0x35, 0x4e, 0x48, 0x34, 0xcf, 0xd6, 0xd5, 0xd8, 0xe3, 0xe3, 0xdb, 0xe3, 0xed, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xd4, 0xe9, 0xbd, 0xd9, 0xcf, 0x37, 0x41, 0x3a, 0x3d, 0x41, 0x38, 0x3d, 0x48, 0x48, 0x34, 0x35, 0x37, 0x3c, 0x46, 0x49, 0x49, 0x49, 0x3d, 0x36, 0x46, 0x51, 0x48, 0x36, 0x3e, 0x3e, 0x42, 0x37, 0x42, 0x35, 0xd1, 0xc4, 0xe5, 0xe7, 0xef, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xef, 0xed, 0xdf, 0xdf, 0xe4, 0xe4, 0xd9, 0xd5, 0x37, 0x35, 0x37, 0xcf, 0x39, 0x3a, 0x3a, 0x47, 0x43, 0x57, 0x67, 0x72, 0x82, 0x74, 0x73, 0x7a, 0x7a, 0x7c, 0x7c, 0x7c, 0x7a, 0x6b, 0x5f, 0x5f, 0x75, 0x81, 0x71, 0x74, 0x74, 0x75, 0x73, 0x76, 0x7a, 0x7a, 0x71, 0x74, 0x75, 0x68, 0x72, 0xbb, 0x2f, 0x30, 0xfd, 0xf6, 0x2d, 0xe7, 0xf5, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf2, 0xf0, 0xeb, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xe9, 0xec, 0xd4, 0xcc, 0xcc, 0x2c, 0xab, 0x85, 0x62, 0x68, 0x74, 0x75, 0x75, 0x76, 0x76, 0x76, 0x7c, 0x80, 0x7e, 0x63, 0x69, 0x6b, 0x7e, 0x7a, 0x7c, 0x7f, 0x7a, 0x82, 0x82, 0x64, 0x50, 0x3b, 0x38, 0x3f, 0x3e, 0x3f, 0x3a, 0x3b, 0x37, 0x40, 0x37, 0x40, 0x44, 0x34, 0xd0, 0xcf, 0xd5, 0xd9, 0xe0, 0xe3, 0xe1, 0xe0, 0xe3, 0xe5, 0xe5, 0xe6, 0xe5, 0xe5, 0xd2, 0xdc, 0xd7, 0xd0, 0x39, 0x40, 0x37, 0x3a, 0x3a, 0x3a, 0x45, 0x45, 0x42, 0x4c, 0x14, 0x23, 0x23, 0x23, 0xa7, 0x9b, 0x96, 0x9b, 0x23, 0x23, 0x6a, 0x51, 0x4f, 0x4e, 0x38, 0x3d, 0x3a, 0x42, 0x40, 0x40, 0x37, 0xd1, 0xe5, 0xe5, 0xe3, 0xe5, 0xe6, 0xe6, 0xe6, 0xe6, 0xe4, 0xdf, 0xe1, 0xe4, 0xe3, 0xda, 0xd5, 0x37, 0x35, 0x3a, 0x37, 0xd6, 0xd0, 0x3c, 0x40, 0x38, 0x43, 0x3f, 0x43, 0x50, 0x5e, 0x72, 0x81, 0x7e, 0x7f, 0x7c, 0x7c, 0x7c, 0x7e, 0x74, 0x69, 0x5f, 0x69, 0x8b, 0x80, 0x73, 0x76, 0x76, 0x7c, 0x7c, 0x7c, 0x7a, 0x71, 0x6b, 0x6c, 0xa0, 0xc3, 0x2f, 0x2e, 0xfd, 0xf1, 0xf1, 0xfc, 0xd4, 0xf0, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xeb, 0xf5, 0xec, 0xec, 0xec, 0xeb, 0xca, 0xcd, 0x30, 0xc9, 0xba, 0x96, 0x6c, 0x5f, 0x68, 0x6b, 0x69, 0x74, 0x75, 0x83, 0x6b, 0x6b, 0x6b, 0x6b, 0x7a, 0x7c, 0x87, 0x7f, 0x71, 0x88, 0x5e, 0x4b, 0x3f, 0x3b, 0x38, 0x3e, 0x3d, 0x3c, 0x38, 0x3e, 0x3d, 0x3c, 0x3a, 0x37, 0x37, 0x37, 0x35, 0xd0, 0x34, 0xcf, 0xd6, 0xd1, 0xdc, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdc, 0x60, 0xcf, 0x34, 0x39, 0x37, 0x3d, 0x38, 0x41, 0x38, 0x40, 0x37, 0x01, 0x24, 0x27, 0x2a, 0x25, 0x21, 0x0d, 0x03, 0x03, 0x51, 0x03, 0x1b, 0x25, 0x2a, 0x2a, 0x23, 0x56, 0x4c, 0x38, 0x45, 0x40, 0x45, 0x3a, 0x3c, 0xd0, 0xd8, 0xe3, 0xe5, 0xe5, 0xe3, 0xe3, 0xe3, 0xe1, 0xe4, 0xe4, 0xe3, 0xdb, 0xd8, 0xd5, 0xd0, 0x37, 0x37, 0x38, 0xd0, 0x39, 0xd0, 0x35, 0x37, 0x38, 0x3e, 0x38, 0x38, 0x38, 0x3f, 0x50, 0x67, 0x7b, 0x7e, 0x7f, 0x7c, 0x7c, 0x7c, 0x7e, 0x74, 0x63, 0x5f, 0x90, 0x8d, 0x7c, 0x73, 0x7c, 0x73, 0x7a, 0x69, 0x62, 0x72, 0xa0, 0xc0, 0x2f, 0xcb, 0xcd, 0xf0, 0xec, 0xe7, 0xf5, 0xf0, 0xfc, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xeb, 0xf2, 0xca, 0xcc, 0xce, 0xc9, 0xc1, 0xbb, 0xa0, 0x85, 0x79, 0x72, 0x72, 0x91, 0x6b, 0x6b, 0x6b, 0x73, 0x7a, 0x7a, 0x7a, 0x77, 0x7b, 0x64, 0x47, 0x3f, 0x40, 0x3d, 0x3c, 0x37, 0x3d, 0x36, 0x37, 0x3a, 0x3e, 0x38, 0x36, 0x38, 0x37, 0x35, 0x36, 0x36, 0x37, 0x39, 0xd0, 0xcf, 0xd7, 0xd9, 0xda, 0xda, 0xda, 0x65, 0xd9, 0x39, 0x34, 0x36, 0x41, 0x3e, 0x3a, 0x3b, 0x3a, 0x3e, 0x40, 0x40, 0x03, 0xc0, 0x29, 0x29, 0x28, 0x29, 0x28, 0x29, 0x29, 0x27, 0x25, 0x29, 0x29, 0x29, 0x28, 0x25, 0x2a, 0x24, 0x48, 0x4b, 0x40, 0x42, 0x45, 0x40, 0x3a, 0x44, 0xd0, 0x39, 0xda, 0xdc, 0xe0, 0xe3, 0xe1, 0xe0, 0xdb, 0xda, 0xd7, 0xcf, 0xd0, 0xd0, 0xd0, 0x36, 0x38, 0x36, 0x36, 0x39, 0x39, 0x3e, 0x3e, 0x3e, 0x36, 0x39, 0xd0, 0x3e, 0x3b, 0x3f, 0x47, 0x62, 0x82, 0x7a, 0x7a, 0x7c, 0x7c, 0x73, 0x74, 0x69, 0x63, 0x83, 0x80, 0x74, 0x68, 0x72, 0x72, 0x88, 0xa0, 0xbb, 0xc3, 0xcb, 0x30, 0x2e, 0xfd, 0x2d, 0xe8, 0xe8, 0xe8, 0xea, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf5, 0x2d, 0xfc, 0xf4, 0xe8, 0xed, 0xe7, 0xe8, 0xf0, 0xca, 0xcd, 0x30, 0x2f, 0x2f, 0xcb, 0xc6, 0xc6, 0x2b, 0xbb, 0x68, 0x6b, 0x69, 0x73, 0x7a, 0x7f, 0x77, 0x7b, 0x6c, 0x47, 0x3f, 0x40, 0x40, 0x3d, 0x3a, 0x3a, 0x40, 0x40, 0x40, 0x40, 0x38, 0x3a, 0x43, 0x48, 0x00, 0x48, 0x40, 0x3a, 0x37, 0x37, 0x40, 0x39, 0x35, 0xd0, 0x34, 0xd0, 0x34, 0xd0, 0x34, 0x35, 0x38, 0x41, 0x38, 0x3b, 0x3b, 0x38, 0x3e, 0x3d, 0x3b, 0x37, 0xc0, 0x27, 0x29, 0x28, 0x28, 0x28, 0x28, 0x28, 0x29, 0x28, 0x29, 0x29, 0x28, 0x28, 0x28, 0x28, 0x29, 0x2a, 0x48, 0x48, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x3d, 0x3c, 0x3a, 0x36, 0x44, 0x46, 0x44, 0xd0, 0xd0, 0xd0, 0x39, 0x40, 0x3c, 0x37, 0x36, 0x36, 0x36, 0x38, 0x37, 0x37, 0x35, 0x36, 0x36, 0x38, 0x3e, 0x39, 0xd0, 0x44, 0x39, 0x3a, 0x38, 0x43, 0x64, 0x78, 0x7a, 0x7f, 0x7c, 0x76, 0x7e, 0x73, 0x63, 0x69, 0xab, 0xba, 0xbb, 0xbe, 0xc1, 0xc5, 0xcb, 0xce, 0xee, 0xf4, 0xfd, 0xfd, 0xf4, 0xea, 0xe8, 0xe8, 0xe8, 0xea, 0xf2, 0xf4, 0xf3, 0xeb, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xea, 0xea, 0xeb, 0xed, 0xeb, 0xe8, 0xe7, 0xeb, 0xf4, 0xfd, 0xf1, 0xfd, 0x2e, 0x2f, 0x2f, 0xba, 0x62, 0x72, 0x73, 0x7a, 0x7a, 0x7d, 0x78, 0x79, 0x4a, 0x3f, 0x38, 0x40, 0x3a, 0x3d, 0x3d, 0x3b, 0x40, 0x40, 0x42, 0x00, 0x56, 0x06, 0x6a, 0x0d, 0x6a, 0x0d, 0x06, 0x02, 0x00, 0x40, 0x3a, 0x40, 0x37, 0x39, 0x36, 0x39, 0x36, 0x39, 0x3e, 0x38, 0x3d, 0x3a, 0x3a, 0x3a, 0x3b, 0x3d, 0x3d, 0x3e, 0x3d, 0x35, 0x23, 0x2b, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x29, 0x29, 0x27, 0x3a, 0x45, 0x48, 0x3d, 0x42, 0x3d, 0x41, 0x42, 0x45, 0x42, 0x40, 0x40, 0x40, 0x37, 0x45, 0x40, 0x45, 0x40, 0x40, 0x40, 0x37, 0x40, 0x4c, 0x01, 0x03, 0x6a, 0x06, 0x03, 0x02, 0x48, 0x45, 0x40, 0x40, 0x3d, 0x3c, 0x39, 0x39, 0x41, 0x3a, 0x3b, 0x43, 0x72, 0x7b, 0x7a, 0x7a, 0x7a, 0x75, 0x71, 0x69, 0x5c, 0xbe, 0x2f, 0xcc, 0x31, 0xf6, 0xd4, 0xe8, 0xe8, 0xed, 0xe9, 0xf4, 0xf4, 0xf1, 0xf2, 0xf2, 0xea, 0xea, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf5, 0xeb, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe8, 0xf0, 0xf3, 0xec, 0xec, 0xf1, 0xfd, 0xcb, 0xba, 0x68, 0x73, 0x69, 0x7f, 0x80, 0x7d, 0x72, 0x67, 0x3f, 0x38, 0x42, 0x3c, 0x40, 0x3e, 0x41, 0x37, 0x40, 0x45, 0x02, 0x06, 0x0e, 0x0e, 0x0c, 0x0a, 0x0c, 0x0a, 0x0e, 0x0d, 0x0d, 0x4c, 0x37, 0x3a, 0x3e, 0x36, 0x3e, 0x41, 0x3e, 0x3a, 0x3a, 0x3a, 0x3a, 0x36, 0x40, 0x40, 0x40, 0x3b, 0x3a, 0x3c, 0x3e, 0x36, 0x48, 0xc0, 0x29, 0x29, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x29, 0x26, 0x2b, 0x0d, 0x40, 0x3b, 0x46, 0x41, 0x3e, 0x42, 0x42, 0x42, 0x40, 0x42, 0x41, 0x42, 0x3c, 0x42, 0x42, 0x40, 0x40, 0x40, 0x3a, 0x3a, 0x48, 0x06, 0x0d, 0x0e, 0x0e, 0x0a, 0x0e, 0x0c, 0x0d, 0x0d, 0x06, 0x4c, 0x42, 0x40, 0x40, 0x3c, 0x37, 0x37, 0x3a, 0x3d, 0x36, 0x53, 0x78, 0x7a, 0x7a, 0x76, 0x7e, 0x73, 0x69, 0x5c, 0xbb, 0xcb, 0x2d, 0xf1, 0xe8, 0xea, 0xd4, 0xf0, 0xf1, 0xf5, 0xeb, 0xeb, 0xeb, 0xfc, 0xf1, 0xfd, 0xf4, 0xf4, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xeb, 0xe8, 0xea, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xea, 0xea, 0xea, 0xe8, 0xe8, 0xe8, 0xca, 0xcb, 0xb3, 0x68, 0x69, 0x76, 0x7f, 0x7a, 0x7d, 0x79, 0x4a, 0x3f, 0x3f, 0x3a, 0x3a, 0x37, 0x3c, 0x3e, 0x40, 0x45, 0x06, 0x0d, 0x0a, 0x0a, 0x09, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0e, 0x0d, 0x0d, 0x03, 0x3b, 0x38, 0x38, 0x3b, 0x37, 0x38, 0x3d, 0x3a, 0x38, 0x42, 0x3a, 0x37, 0x37, 0x3a, 0x40, 0x40, 0x3c, 0x3c, 0x3e, 0x3a, 0x45, 0xc0, 0x2a, 0x27, 0x29, 0x29, 0x29, 0x28, 0x28, 0x28, 0x29, 0x29, 0x29, 0x29, 0x2b, 0x14, 0x3f, 0x38, 0x41, 0x44, 0x46, 0x3d, 0x42, 0x3b, 0x42, 0x38, 0x3c, 0x3e, 0x36, 0x41, 0x3e, 0x39, 0x3a, 0x42, 0x40, 0x45, 0x01, 0x0d, 0x0e, 0x0b, 0x09, 0x10, 0x09, 0x10, 0x0c, 0x11, 0x07, 0x0e, 0x0e, 0x04, 0x48, 0x40, 0x40, 0x3d, 0x3a, 0x3a, 0x37, 0x3b, 0x43, 0x62, 0x82, 0x73, 0x73, 0x7a, 0x73, 0x69, 0x5d, 0xbb, 0xcb, 0x2e, 0xf1, 0xec, 0xfc, 0xca, 0xca, 0x2e, 0xf0, 0xea, 0xe8, 0xca, 0xf1, 0xfd, 0xf1, 0xfd, 0xf1, 0xf3, 0xeb, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf4, 0xf1, 0xf4, 0xf2, 0xea, 0xea, 0xca, 0xcc, 0xbb, 0x64, 0x69, 0x73, 0x7e, 0x73, 0x83, 0x67, 0x3f, 0x38, 0x3a, 0x3b, 0x40, 0x40, 0x38, 0x42, 0x42, 0x02, 0x0d, 0x0e, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0e, 0x0d, 0x01, 0x37, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x41, 0x3c, 0x3c, 0x35, 0x60, 0x3a, 0x40, 0x3d, 0x40, 0x41, 0x40, 0x42, 0x36, 0x00, 0xac, 0x2a, 0x29, 0x29, 0x28, 0x28, 0x28, 0x28, 0x28, 0x29, 0x2a, 0x2a, 0x14, 0x42, 0x40, 0x42, 0x3b, 0x38, 0x45, 0x45, 0x45, 0x34, 0x37, 0x3d, 0x41, 0x3a, 0x3e, 0x39, 0x3c, 0x38, 0x42, 0x40, 0x45, 0x04, 0x0e, 0x0a, 0x0a, 0x0a, 0x09, 0x0b, 0x09, 0x0b, 0x10, 0x0b, 0x0e, 0x0b, 0x0e, 0x0e, 0x06, 0x45, 0x40, 0x3d, 0x3d, 0x3d, 0x3a, 0x37, 0x43, 0x4b, 0x82, 0x73, 0x7c, 0x7c, 0x73, 0x68, 0x5a, 0xbe, 0xcb, 0xfd, 0xec, 0xec, 0xe8, 0x2d, 0xfc, 0xfd, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf1, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf1, 0xf2, 0xf2, 0xea, 0x2d, 0xcd, 0xbe, 0x67, 0x77, 0x69, 0x7e, 0x7a, 0x7e, 0x5e, 0x3f, 0x3e, 0x3a, 0x3b, 0x40, 0x37, 0x45, 0x3a, 0x4c, 0x6a, 0x0e, 0x05, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x11, 0x0a, 0x0e, 0x0d, 0x48, 0x3a, 0x40, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3c, 0x37, 0xbc, 0x6e, 0x3a, 0x40, 0x37, 0x40, 0x41, 0x40, 0x3a, 0x42, 0x3a, 0x3a, 0x6a, 0x27, 0x2a, 0x2a, 0x29, 0x29, 0x29, 0x2a, 0x2a, 0x24, 0x01, 0x38, 0x3a, 0x45, 0x38, 0x40, 0x3b, 0x42, 0x3a, 0x49, 0xa2, 0x48, 0x35, 0x42, 0x3d, 0x3a, 0x3e, 0x3e, 0x39, 0x42, 0x40, 0x01, 0x0e, 0x11, 0x0e, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0b, 0x0b, 0x0a, 0x0d, 0x03, 0x40, 0x42, 0x38, 0x3a, 0x3a, 0x40, 0x3b, 0x47, 0x79, 0x77, 0x76, 0x7c, 0x73, 0x68, 0x59, 0xc1, 0x30, 0xfd, 0xec, 0xec, 0xeb, 0xea, 0x2d, 0xf4, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xeb, 0x2d, 0xcd, 0xc0, 0x64, 0x74, 0x73, 0x74, 0x80, 0x7e, 0x57, 0x3f, 0x37, 0x3a, 0x40, 0x3b, 0x3c, 0x40, 0x38, 0x03, 0x0d, 0x0a, 0x0b, 0x09, 0x09, 0x0b, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x10, 0x09, 0x09, 0x0e, 0x0d, 0x51, 0x37, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x37, 0x60, 0x33, 0x3c, 0x35, 0x42, 0x42, 0x3d, 0x3a, 0x3a, 0x40, 0x45, 0x3a, 0x3a, 0x3d, 0x4c, 0x14, 0xba, 0x2a, 0x2a, 0x27, 0x23, 0x0d, 0x45, 0x40, 0x45, 0x42, 0x42, 0x42, 0x45, 0x3d, 0x3d, 0x37, 0x45, 0xc4, 0xbf, 0x38, 0x3a, 0x42, 0x3a, 0x41, 0x3c, 0x3d, 0x40, 0x48, 0x06, 0x0e, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0b, 0x0e, 0x0b, 0x09, 0x11, 0x0b, 0x0e, 0x0d, 0x48, 0x37, 0x3d, 0x38, 0x3d, 0x3a, 0x3b, 0x3f, 0x72, 0x71, 0x7c, 0x7c, 0x76, 0x69, 0x5a, 0xc6, 0x30, 0xf0, 0xec, 0xec, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0x2e, 0xc3, 0x79, 0x69, 0x76, 0x74, 0x80, 0x7e, 0x57, 0x3b, 0x3c, 0x3a, 0x40, 0x3a, 0x39, 0x38, 0x40, 0x03, 0x0d, 0x05, 0x10, 0x09, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x10, 0x10, 0x10, 0x11, 0x0d, 0x03, 0x38, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x41, 0x3a, 0x4e, 0xcb, 0x65, 0x34, 0x3a, 0x40, 0x3c, 0x3a, 0x41, 0x3a, 0x3a, 0x45, 0x42, 0x40, 0x38, 0x35, 0x45, 0x6a, 0x70, 0x4c, 0x40, 0x3a, 0x3a, 0x40, 0x3b, 0x42, 0x43, 0x3a, 0x42, 0x3d, 0x41, 0x37, 0x44, 0xca, 0xac, 0x38, 0x35, 0x3b, 0x41, 0x3a, 0x3e, 0x42, 0x37, 0x4c, 0x06, 0x0e, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0a, 0x0b, 0x11, 0x10, 0x0b, 0x0a, 0x0d, 0x4c, 0x36, 0x41, 0x38, 0x3a, 0x3a, 0x3b, 0x3f, 0x64, 0x7b, 0x73, 0x7c, 0x73, 0x69, 0x6c, 0xcb, 0xcc, 0xf0, 0xf6, 0xec, 0xf3, 0xf2, 0xfc, 0xf1, 0xf4, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf2, 0xf0, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf3, 0xf4, 0xf1, 0x2e, 0x2c, 0x96, 0x69, 0x6b, 0x75, 0x7a, 0x81, 0x57, 0x3a, 0x40, 0x3a, 0x3a, 0x3b, 0x39, 0x40, 0x38, 0x01, 0x0d, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x09, 0x10, 0x10, 0x09, 0x0d, 0x01, 0x3a, 0x40, 0x3a, 0x3a, 0x3d, 0x38, 0x3d, 0x3a, 0x36, 0x4d, 0xc5, 0x6e, 0x35, 0x37, 0x41, 0x41, 0x37, 0x41, 0x3d, 0x3a, 0x3b, 0x45, 0x39, 0x3b, 0x36, 0x4e, 0x51, 0x36, 0x3a, 0x40, 0x41, 0x3e, 0x42, 0x3b, 0x45, 0x3b, 0x42, 0x42, 0x37, 0x37, 0xbf, 0xb8, 0xcf, 0x36, 0x3d, 0x37, 0x42, 0x3a, 0x37, 0x3a, 0x40, 0x48, 0x0d, 0x0a, 0x0a, 0x0b, 0x09, 0x09, 0x0b, 0x0b, 0x0a, 0x0e, 0x0a, 0x0e, 0x11, 0x09, 0x10, 0x10, 0x0a, 0x0d, 0x00, 0x3a, 0x3e, 0x37, 0x3d, 0x37, 0x42, 0x3f, 0x64, 0x71, 0x73, 0x76, 0x73, 0x63, 0x96, 0x32, 0xcc, 0xfc, 0xec, 0xeb, 0xf4, 0xf2, 0xfc, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf1, 0xf1, 0xfd, 0x2f, 0xab, 0x68, 0x74, 0x6b, 0x76, 0x90, 0x5a, 0x42, 0x3a, 0x40, 0x3a, 0x38, 0x39, 0x41, 0x3a, 0x00, 0x06, 0x0a, 0x09, 0x0b, 0x10, 0x09, 0x0a, 0x0a, 0x0e, 0x0a, 0x0b, 0x0b, 0x10, 0x09, 0x11, 0x0d, 0x48, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x41, 0x3a, 0x3c, 0xcf, 0x6e, 0xce, 0x60, 0x35, 0x34, 0x44, 0x3a, 0x3c, 0x41, 0x42, 0x3d, 0x41, 0x3e, 0x36, 0x38, 0x4e, 0x61, 0x3d, 0x42, 0x42, 0x3b, 0x3d, 0x38, 0x42, 0x3b, 0x42, 0x45, 0x35, 0x34, 0xb8, 0xc2, 0x34, 0x44, 0x38, 0x41, 0x3a, 0x40, 0x3a, 0x3a, 0x40, 0x40, 0x45, 0x06, 0x0e, 0x09, 0x09, 0x0b, 0x09, 0x0b, 0x09, 0x0b, 0x0b, 0x0a, 0x0a, 0x0b, 0x0b, 0x10, 0x09, 0x11, 0x6a, 0x45, 0x40, 0x3d, 0x38, 0x3c, 0x37, 0x3b, 0x3f, 0x64, 0x7b, 0x7a, 0x76, 0x73, 0x62, 0xbb, 0xcc, 0xcd, 0xf0, 0xf1, 0xeb, 0xf4, 0x2d, 0xf4, 0xf2, 0xeb, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xea, 0xf2, 0xf2, 0xec, 0xf1, 0xfd, 0xce, 0xc0, 0x5e, 0x74, 0x6b, 0x80, 0x77, 0x6c, 0x42, 0x3a, 0x40, 0x3b, 0x41, 0x3e, 0x3a, 0x3b, 0x40, 0x01, 0x0d, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0d, 0x03, 0x42, 0x3a, 0x40, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x34, 0x60, 0x33, 0xb8, 0x46, 0xcf, 0x36, 0x39, 0x41, 0x3c, 0x37, 0x3a, 0x41, 0x3d, 0x36, 0x49, 0x51, 0x37, 0x3a, 0x41, 0x42, 0x3b, 0x41, 0x42, 0x37, 0x3a, 0xcf, 0x54, 0xbf, 0xbf, 0x34, 0x37, 0x36, 0x3c, 0x3a, 0x3a, 0x40, 0x3a, 0x3a, 0x3a, 0x40, 0x40, 0x4c, 0x0a, 0x0e, 0x0a, 0x09, 0x0b, 0x10, 0x0b, 0x10, 0x0a, 0x11, 0x0a, 0x0a, 0x0a, 0x0b, 0x0e, 0x0d, 0x4c, 0x40, 0x3a, 0x38, 0x37, 0x3a, 0x3a, 0x3b, 0x47, 0x6c, 0x74, 0x73, 0x77, 0x69, 0x6c, 0xc6, 0xcd, 0xf0, 0xea, 0xeb, 0xf1, 0xfd, 0xf4, 0xfc, 0xea, 0xea, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf2, 0xeb, 0xec, 0xf1, 0xcb, 0xc9, 0x85, 0x72, 0x6b, 0x7c, 0x73, 0x79, 0x47, 0x3a, 0x3a, 0x40, 0x3b, 0x39, 0x3c, 0x40, 0x40, 0x45, 0x02, 0x6a, 0x0e, 0x07, 0x08, 0x07, 0x08, 0x0a, 0x0a, 0x0d, 0x0e, 0x0d, 0x0d, 0x03, 0x45, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x38, 0x41, 0x3a, 0x3c, 0x41, 0xcf, 0x6e, 0xce, 0xc4, 0x6e, 0x44, 0x34, 0x34, 0x35, 0x35, 0x35, 0x34, 0x37, 0x34, 0x46, 0x6e, 0x3c, 0x34, 0x37, 0x36, 0x36, 0x36, 0xcf, 0x35, 0x37, 0x93, 0xc8, 0xb8, 0x35, 0x36, 0x3a, 0x3c, 0x38, 0x3a, 0x40, 0x3a, 0x3a, 0x3a, 0x38, 0x3a, 0x40, 0x40, 0x06, 0x0d, 0x0e, 0x0e, 0x0a, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0e, 0x0e, 0x0e, 0x0d, 0x06, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x38, 0x4a, 0x82, 0x73, 0x73, 0x7e, 0x5d, 0xab, 0xcb, 0xf6, 0xf0, 0xea, 0xeb, 0xf3, 0xf1, 0xfd, 0xf2, 0xf2, 0xe8, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xeb, 0xea, 0xe8, 0xf5, 0xe8, 0x2e, 0xcb, 0xbb, 0x64, 0x71, 0x7f, 0x73, 0x82, 0x58, 0x38, 0x3b, 0x3b, 0x40, 0x37, 0x3c, 0x3d, 0x40, 0x40, 0x40, 0x4c, 0x03, 0x0d, 0x0e, 0x0e, 0x0b, 0x0a, 0x0e, 0x0d, 0x6a, 0x6a, 0x4c, 0x45, 0x3a, 0x41, 0x38, 0x40, 0x3a, 0x3a, 0x3a, 0x3e, 0x3a, 0x38, 0x38, 0x3a, 0x3c, 0x45, 0xcf, 0x4e, 0xd3, 0xfb, 0xc7, 0xb8, 0x93, 0x54, 0x54, 0x4d, 0x54, 0x54, 0x93, 0xc4, 0x33, 0xc7, 0x9b, 0x60, 0x4d, 0x4e, 0x54, 0x93, 0xb8, 0xc7, 0x33, 0x65, 0xcf, 0x35, 0x41, 0x36, 0x3e, 0x3c, 0x3a, 0x3a, 0x40, 0x3a, 0x3e, 0x39, 0x41, 0x3a, 0x40, 0x42, 0x01, 0x6a, 0x0d, 0x0e, 0x0a, 0x0a, 0x0b, 0x0a, 0x0b, 0x0e, 0x0e, 0x0d, 0x0d, 0x01, 0x40, 0x36, 0x38, 0x3e, 0x38, 0x40, 0x3a, 0x38, 0x3f, 0x57, 0x7b, 0x76, 0x7c, 0x69, 0x57, 0xc3, 0x2e, 0xf4, 0xea, 0xea, 0xea, 0xf4, 0xfd, 0xfd, 0xfc, 0xea, 0xea, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf4, 0xf2, 0xea, 0xea, 0xe8, 0xeb, 0xca, 0xcc, 0xc6, 0x79, 0x78, 0x76, 0x7f, 0x72, 0x6c, 0x3f, 0x3f, 0x3b, 0x40, 0x39, 0x3a, 0x3c, 0x41, 0x3a, 0x3a, 0x40, 0x45, 0x01, 0x02, 0x04, 0x05, 0x09, 0x06, 0x02, 0x51, 0x48, 0x42, 0x3a, 0x40, 0x3e, 0x39, 0x3a, 0x40, 0x3a, 0x3a, 0x3a, 0x41, 0x38, 0x37, 0x41, 0x3a, 0x37, 0x3c, 0x34, 0x46, 0xbf, 0xfb, 0xfb, 0xfb, 0xf9, 0x31, 0x2e, 0x31, 0xf9, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfa, 0xcd, 0xff, 0xff, 0xfb, 0x33, 0xfb, 0x93, 0xd5, 0x3c, 0x38, 0x3a, 0x3e, 0x38, 0x3e, 0x3a, 0x40, 0x3a, 0x3a, 0x39, 0x3e, 0x39, 0x3a, 0x40, 0x3b, 0x42, 0x4c, 0x03, 0x06, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x02, 0x4c, 0x3a, 0x38, 0x38, 0x39, 0x3e, 0x3a, 0x3a, 0x3d, 0x38, 0x47, 0x6c, 0x74, 0x76, 0x76, 0x63, 0x96, 0xcc, 0xcd, 0xf1, 0xea, 0xe8, 0xea, 0xf2, 0xfd, 0xfd, 0xf1, 0xea, 0xe8, 0xf5, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xeb, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xea, 0xeb, 0xeb, 0xfc, 0xca, 0x2e, 0xbc, 0x6c, 0x69, 0x7c, 0x7e, 0x7b, 0x4f, 0x3f, 0x40, 0x42, 0x42, 0x3a, 0x3a, 0x3c, 0x3a, 0x3d, 0x40, 0x40, 0x37, 0x40, 0x45, 0x45, 0x45, 0x45, 0x42, 0x3a, 0x3a, 0x3a, 0x40, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x41, 0x3d, 0x3d, 0x38, 0x41, 0x42, 0x3a, 0x35, 0x3c, 0xc2, 0xfa, 0xee, 0xef, 0xee, 0xfb, 0xfb, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfb, 0xf9, 0x31, 0xfb, 0xc7, 0x39, 0x37, 0x37, 0x3c, 0x3d, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3c, 0x3e, 0x3a, 0x3a, 0x40, 0x3a, 0x3a, 0x42, 0x48, 0x4c, 0x51, 0x56, 0x01, 0x01, 0x4c, 0x45, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x3e, 0x38, 0x38, 0x38, 0x3e, 0x36, 0x57, 0x78, 0x76, 0x76, 0x6b, 0x64, 0xbe, 0x31, 0xfd, 0xf5, 0xf1, 0xea, 0xf2, 0xf4, 0xf1, 0xf4, 0xf4, 0xf2, 0xea, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xc8, 0x96, 0x78, 0x71, 0x7c, 0x73, 0x6c, 0x47, 0x3a, 0x42, 0x42, 0x40, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x41, 0x3a, 0x42, 0x34, 0x93, 0xcd, 0xcd, 0xf8, 0xff, 0xcd, 0xf7, 0xf7, 0xff, 0xff, 0x31, 0xff, 0x33, 0x33, 0x31, 0x31, 0x32, 0xfe, 0x32, 0x93, 0xcf, 0x3e, 0x3e, 0x38, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x40, 0x40, 0x40, 0x3a, 0x37, 0x3a, 0x37, 0x3a, 0x36, 0x37, 0x3a, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3a, 0x38, 0x3e, 0x3e, 0x36, 0x47, 0x72, 0x73, 0x76, 0x75, 0x5f, 0xa7, 0xcc, 0x2e, 0xf1, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf5, 0xce, 0xc3, 0x5d, 0x77, 0x73, 0x7e, 0x88, 0x53, 0x3b, 0x3a, 0x41, 0x3d, 0x40, 0x3a, 0x3d, 0x3a, 0x3d, 0x3b, 0x3d, 0x3b, 0x3d, 0x3d, 0x3a, 0x3e, 0x3a, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x3e, 0x3b, 0x40, 0x40, 0x34, 0xc1, 0x32, 0x30, 0x2f, 0x32, 0xce, 0xcc, 0xcc, 0x2f, 0xc8, 0x2c, 0xc8, 0x2c, 0x2f, 0x30, 0x32, 0x32, 0xc8, 0x34, 0x36, 0x3c, 0x38, 0x3e, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x3d, 0x40, 0x3b, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3a, 0x3b, 0x38, 0x3b, 0x3b, 0x38, 0x40, 0x41, 0x3b, 0x43, 0x5e, 0x82, 0x69, 0x73, 0x6b, 0x64, 0xc9, 0x2e, 0xfd, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf1, 0xeb, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xfc, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf0, 0xca, 0x2f, 0xbb, 0x6c, 0x68, 0x77, 0x6b, 0x85, 0x4f, 0x36, 0x39, 0x3d, 0x3d, 0x3b, 0x3a, 0x3b, 0x40, 0x3b, 0x40, 0x40, 0x3b, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x41, 0x36, 0x41, 0x3a, 0x40, 0x35, 0x54, 0xc0, 0x24, 0x24, 0x25, 0xba, 0x24, 0x24, 0x1d, 0x18, 0x13, 0x15, 0x16, 0x18, 0x1d, 0x23, 0xc1, 0x54, 0x35, 0x45, 0x36, 0x3e, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3a, 0x3a, 0x40, 0x3d, 0x40, 0x3a, 0x40, 0x3a, 0x38, 0x3e, 0x38, 0x38, 0x3b, 0x40, 0x37, 0x42, 0x57, 0x74, 0x6b, 0x75, 0x6b, 0x64, 0xc0, 0x30, 0xca, 0xf0, 0xea, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf0, 0xf2, 0xf5, 0xf2, 0xf3, 0xcd, 0xc9, 0x30, 0xab, 0x64, 0x71, 0x7a, 0x81, 0x72, 0x47, 0x38, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x40, 0x3b, 0x40, 0x42, 0x3b, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x3d, 0x41, 0x40, 0x3d, 0x42, 0x36, 0x9b, 0x21, 0x18, 0x15, 0x13, 0x16, 0x13, 0x16, 0x16, 0x16, 0x18, 0x18, 0x18, 0x18, 0x23, 0x9b, 0x35, 0x40, 0x36, 0x42, 0x38, 0x3e, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3c, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x40, 0x3d, 0x38, 0x3e, 0x3e, 0x38, 0x3b, 0x40, 0x3b, 0x4c, 0x7b, 0x75, 0x69, 0x6b, 0x62, 0xb3, 0x32, 0xc8, 0xf6, 0xe8, 0xea, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xfc, 0xcd, 0xcc, 0x96, 0x68, 0x7f, 0x73, 0x81, 0x64, 0x47, 0x3b, 0x3b, 0x42, 0x3d, 0x41, 0x41, 0x3c, 0x3d, 0x3d, 0x40, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x42, 0x3a, 0x40, 0x42, 0x38, 0x42, 0x40, 0x1b, 0x21, 0x16, 0x18, 0x17, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x18, 0x18, 0x21, 0x1b, 0x40, 0x3a, 0x40, 0x38, 0x3d, 0x3b, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3e, 0x3c, 0x3e, 0x3c, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3d, 0x40, 0x38, 0x3a, 0x3c, 0x39, 0x37, 0x38, 0x3f, 0x3f, 0x4f, 0x68, 0x71, 0x69, 0x83, 0x5c, 0xab, 0x2f, 0x2e, 0xfd, 0xec, 0xea, 0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 
-  0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf0, 0xcd, 0xc9, 0x97, 0x71, 0x73, 0x73, 0x82, 0x5d, 0x47, 0x38, 0x3f, 0x41, 0x3d, 0x3c, 0x41, 0x3c, 0x3c, 0x3c, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x40, 0x40, 0x3d, 0x3e, 0x3b, 0x36, 0x47, 0x0d, 0x21, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x18, 0x17, 0x21, 0x1b, 0x4c, 0x3a, 0x40, 0x3b, 0x3a, 0x3b, 0x38, 0x3a, 0x3a, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3e, 0x3c, 0x3a, 0x3c, 0x3d, 0x3c, 0x3a, 0x3d, 0x3d, 0x3d, 0x3b, 0x3b, 0x3a, 0x3a, 0x37, 0x40, 0x3b, 0x3f, 0x4a, 0x67, 0x7b, 0x69, 0x71, 0x5c, 0xa0, 0xcb, 0x2e, 0xfd, 0xf4, 0xea, 0xe8, 0xea, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 
-  0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf6, 0xe7, 0x30, 0xc6, 0x97, 0x69, 0x77, 0x7e, 0x82, 0x64, 0x4b, 0x3f, 0x3f, 0x3b, 0x41, 0x3c, 0x3c, 0x39, 0x3c, 0x3c, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x40, 0x40, 0x40, 0x3a, 0x3e, 0x38, 0x41, 0x3b, 0x3a, 0x06, 0x1a, 0x1d, 0x1d, 0x1a, 0x1a, 0x1a, 0x21, 0x21, 0x03, 0x45, 0x3a, 0x40, 0x42, 0x3b, 0x3a, 0x42, 0x3a, 0x3d, 0x3a, 0x3a, 0x40, 0x38, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3e, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x40, 0x3a, 0x3b, 0x3a, 0x40, 0x40, 0x40, 0x3b, 0x4f, 0x72, 0x6b, 0x68, 0x6b, 0x62, 0xab, 0xc9, 0xcc, 0xfd, 0xfd, 0xf1, 0xf3, 0xe8, 0xea, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xeb, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf1, 0xf7, 0xe7, 0xce, 0xc9, 0xa0, 0x72, 0x6d, 0x71, 0x72, 0x6c, 0x50, 0x43, 0x3b, 0x3b, 0x41, 0x3c, 0x3c, 0x3c, 0x3c, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x40, 0x41, 0x38, 0x3c, 0x3e, 0x3a, 0x3a, 0x3a, 0x42, 0x4c, 0x06, 0x14, 0x14, 0x14, 0x51, 0x40, 0x42, 0x41, 0x3b, 0x40, 0x3b, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x40, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3c, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x3d, 0x3a, 0x38, 0x3b, 0x3b, 0x3b, 0x47, 0x53, 0x67, 0x72, 0x6b, 0x6b, 0x5d, 0xab, 0x30, 0xcd, 0xf5, 0xf2, 0xfc, 0xca, 0xf2, 0xeb, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x2d, 0x2e, 0xfd, 0xf4, 0xec, 0xeb, 0xcd, 0xcb, 0xab, 0x62, 0x78, 0x69, 0x7b, 0x6c, 0x57, 0x47, 0x3f, 0x40, 0x40, 0x3c, 0x40, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3c, 0x3d, 0x40, 0x40, 0x3a, 0x3c, 0x41, 0x3c, 0x40, 0x40, 0x3a, 0x37, 0x37, 0x40, 0x42, 0x40, 0x37, 0x45, 0x35, 0x36, 0x41, 0x3a, 0x37, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x38, 0x3a, 0x38, 0x3f, 0x4a, 0x50, 0x72, 0x68, 0x71, 0x63, 0x62, 0xbb, 0x30, 0xfd, 0xf6, 0xec, 0xea, 0xca, 0x2d, 0xca, 0xf4, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0x2d, 0xf1, 0xf5, 0xed, 0xec, 0xec, 0xcd, 0x32, 0xbe, 0x79, 0x6b, 0x69, 0x78, 0x82, 0x67, 0x4a, 0x43, 0x3f, 0x40, 0x3e, 0x39, 0x3e, 0x3a, 0x3b, 0x40, 0x3b, 0x40, 0x41, 0x3a, 0x3c, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3c, 0x3a, 0x3c, 0x38, 0x3e, 0x3b, 0x40, 0x40, 0x42, 0x3a, 0x36, 0x41, 0x3a, 0x3e, 0x39, 0x3a, 0x3d, 0x40, 0x3a, 0x40, 0x42, 0x40, 0x41, 0x3d, 0x38, 0x41, 0x3b, 0x3a, 0x3a, 0x38, 0x3d, 0x3a, 0x3a, 0x3b, 0x3d, 0x38, 0x3e, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3b, 0x3a, 0x3b, 0x40, 0x40, 0x40, 0x3a, 0x3a, 0x3c, 0x3a, 0x3c, 0x38, 0x3e, 0x40, 0x40, 0x43, 0x4a, 0x67, 0x7b, 0x6b, 0x68, 0x5d, 0x88, 0xc0, 0x30, 0xcc, 0xf5, 0xec, 0xec, 0xe8, 0xca, 0x2d, 0xfc, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0xf5, 0xeb, 0xec, 0xea, 0xd4, 0xca, 0xca, 0x32, 0xc5, 0xa0, 0x62, 0x68, 0x6f, 0x71, 0x78, 0x5d, 0x47, 0x38, 0x38, 0x44, 0x3e, 0x3e, 0x3b, 0x42, 0x45, 0x3b, 0x42, 0x3a, 0x39, 0x3e, 0x3d, 0x3b, 0x3b, 0x3b, 0x3a, 0x3d, 0x3c, 0x3e, 0x39, 0x3e, 0x3c, 0x3b, 0x3a, 0x3b, 0x3a, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3d, 0x3b, 0x3d, 0x3b, 0x3d, 0x3b, 0x3e, 0x3b, 0x3e, 0x3d, 0x3e, 0x3e, 0x3e, 0x3e, 0x3d, 0x3d, 0x3d, 0x40, 0x3b, 0x3b, 0x3b, 0x45, 0x40, 0x40, 0x37, 0x3c, 0xd0, 0x39, 0x3e, 0x3e, 0x36, 0x3f, 0x4c, 0x64, 0x78, 0x6b, 0x69, 0x5f, 0x5c, 0xa0, 0xc8, 0x30, 0xf2, 0xf3, 0xf1, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xeb, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xeb, 0xea, 0xeb, 0xeb, 0xf0, 0xfc, 0x2e, 0x2d, 0x30, 0x2f, 0xc0, 0x85, 0x67, 0x68, 0x6b, 0x6b, 0x72, 0x64, 0x4b, 0x3f, 0x3a, 0x3d, 0x41, 0x40, 0x3a, 0x40, 0x3a, 0x3a, 0x38, 0x41, 0x3a, 0x3c, 0x3c, 0x3c, 0x3d, 0x3d, 0x3d, 0x40, 0x3d, 0x40, 0x3a, 0x40, 0x3a, 0x40, 0x3a, 0x40, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3a, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3a, 0x40, 0x3c, 0x40, 0x40, 0x3a, 0x3e, 0x38, 0x3d, 0x3c, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x3e, 0x3a, 0x3e, 0x37, 0x38, 0x3d, 0x42, 0x3f, 0x38, 0x3f, 0x4b, 0x5e, 0x68, 0x68, 0x68, 0x68, 0x67, 0x79, 0xbe, 0x32, 0xfd, 0xf6, 0xf1, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf2, 0xf3, 0xfc, 0xeb, 0xf3, 0xf5, 0xf5, 0xf0, 0x2d, 0xca, 0xfd, 0x2e, 0x32, 0xc9, 0xb3, 0x67, 0x67, 0x6b, 0x7b, 0x78, 0x6d, 0x64, 0x4b, 0x43, 0x38, 0x3c, 0x3c, 0x39, 0x41, 0x40, 0x42, 0x42, 0x39, 0x3c, 0x39, 0x3c, 0x3a, 0x40, 0x3a, 0x40, 0x42, 0x40, 0x40, 0x3a, 0x40, 0x3a, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3b, 0x3b, 0x3d, 0x3a, 0x3d, 0x3c, 0x3c, 0x39, 0x39, 0x39, 0x39, 0x3e, 0x3e, 0x38, 0x3f, 0x38, 0x43, 0x50, 0x5d, 0x79, 0x72, 0x6b, 0x6b, 0x5c, 0x64, 0xab, 0x2c, 0x32, 0xc8, 0xf6, 0xf1, 0xec, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xfc, 0xf4, 0xf4, 0xf3, 0xf3, 0xf1, 0xf8, 0xf1, 0xf2, 0xfc, 0xf5, 0xf1, 0xcd, 0x30, 0xc5, 0xab, 0x6c, 0x62, 0x6d, 0x7d, 0x6f, 0x86, 0x64, 0x57, 0x47, 0x38, 0x3b, 0x37, 0x3d, 0x42, 0x40, 0x3c, 0x39, 0x3c, 0x3c, 0x3c, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x3d, 0x38, 0x3e, 0x3a, 0x38, 0x3d, 0x38, 0x3e, 0x3b, 0x3b, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x40, 0x3e, 0x3b, 0x3e, 0x38, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3c, 0x39, 0x3e, 0x3c, 0x3e, 0x36, 0x38, 0x43, 0x47, 0x52, 0x67, 0x78, 0x72, 0x69, 0x68, 0x5f, 0x5e, 0xa0, 0xc6, 0x32, 0x2e, 0xfd, 0xec, 0xec, 0xe9, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf4, 0xf3, 0xf4, 0xf2, 0xf2, 0xf3, 0xf4, 0xeb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf3, 0xf4, 0xf2, 0xf2, 0xf3, 0xf4, 0xeb, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf4, 0xf3, 0xf4, 0xf2, 0xf2, 0xf3, 0xf4, 0xeb, 0xf4, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf4, 0xf3, 0xf4, 0xf2, 0xf2, 0xf3, 0xf4, 0xeb, 0xf4, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf4, 0xf3, 0xf4, 0xf2, 0xf2, 0xf3, 0xf4, 0xeb, 0xf4, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf4, 0xf5, 0xf5, 0xeb, 0xf5, 0xeb, 0xfc, 0x30, 0x30, 0x2b, 0xab, 0x88, 0x68, 0x69, 0x6f, 0x77, 0x78, 0x67, 0x5e, 0x4f, 0x47, 0x3f, 0x40, 0x3b, 0x3a, 0x3b, 0x3d, 0x3b, 0x3a, 0x3a, 0x3d, 0x3d, 0x40, 0x3a, 0x3e, 0x3e, 0x38, 0x3e, 0x38, 0x3e, 0x3e, 0x3f, 0x38, 0x3e, 0x38, 0x3e, 0x38, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f, 0x3e, 0x38, 0x3e, 0x38, 0x3e, 0x3e, 0x3e, 0x3e, 0x3b, 0x3e, 0x3b, 0x3d, 0x3a, 0x40, 0x3c, 0x40, 0x3d, 0x40, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x47, 0x4f, 0x5a, 0x6c, 0x78, 0x72, 0x6b, 0x68, 0x63, 0x6c, 0x9e, 0xc3, 0x30, 0xcc, 0xfd, 0xfd, 0xf1, 0xeb, 0xea, 0xea, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xfc, 0xf2, 0xfc, 0xf1, 0xf3, 0xf1, 0xf4, 0xec, 0xf3, 0xf2, 0xf2, 0xf3, 0xf4, 0xf1, 0x2e, 0x2e, 0x30, 0xc6, 0xb3, 0x79, 0x6d, 0x69, 0x69, 0x74, 0x74, 0x72, 0x6c, 0x5e, 0x4f, 0x4a, 0x3f, 0x43, 0x3f, 0x3f, 0x3f, 0x3f, 0x3d, 0x3e, 0x3c, 0x39, 0x38, 0x36, 0x38, 0x38, 0x3e, 0x3e, 0x38, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x38, 0x3e, 0x38, 0x3e, 0x3e, 0x3e, 0x3e, 0x3d, 0x3e, 0x3a, 0x3b, 0x41, 0x42, 0x41, 0x41, 0x41, 0x40, 0x3b, 0x3b, 0x3f, 0x38, 0x3f, 0x47, 0x4f, 0x5a, 0x6d, 0x72, 0x6d, 0x78, 0x68, 0x68, 0x5c, 0x5e, 0xab, 0xc3, 0x30, 0x30, 0x2d, 0xfc, 0xf5, 0xea, 0xea, 0xea, 0xea, 0xca, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf3, 0xf1, 0xf3, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf1, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf1, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf1, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf3, 0xf1, 0xf3, 
-  0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xfc, 0xfc, 0xf3, 0xf3, 0xec, 0xf3, 0xf4, 0xfd, 0xfd, 0xeb, 0xea, 0xea, 0xea, 0xd4, 0xcd, 0x31, 0xcb, 0xc1, 0xa7, 0x79, 0x67, 0x69, 0x69, 0x69, 0x77, 0x72, 0x72, 0x6c, 0x5e, 0x50, 0x4a, 0x43, 0x43, 0x3f, 0x38, 0x36, 0x38, 0x41, 0x40, 0x40, 0x40, 0x40, 0x3a, 0x40, 0x3a, 0x40, 0x40, 0x40, 0x3a, 0x3a, 0x3a, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3d, 0x40, 0x3a, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x38, 0x3b, 0x3f, 0x47, 0x47, 0x4f, 0x57, 0x5d, 0x72, 0x6c, 0x71, 0x69, 0x69, 0x62, 0x5c, 0x64, 0x85, 0xbb, 0xc9, 0x30, 0xcd, 0xf6, 0xf4, 0xf2, 0xea, 0xea, 0xea, 0xea, 0x2d, 0xfd, 0x2d, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xeb, 0xeb, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xeb, 0xec, 0xfd, 0xfd, 0xfc, 0xea, 0xea, 0xea, 0xea, 0xed, 0xec, 0xec, 0xf5, 0xcd, 0xcc, 0xc5, 0xba, 0x97, 0x62, 0x62, 0x63, 0x69, 0x71, 0x68, 0x72, 0x72, 0x72, 0x64, 0x5e, 0x53, 0x4f, 0x47, 0x47, 0x43, 0x40, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x45, 0x47, 0x47, 0x4b, 0x4f, 0x57, 0x5b, 0x67, 0x6c, 0x68, 0x67, 0x68, 0x62, 0x5f, 0x5c, 0x55, 0x79, 0xab, 0xc0, 0xc9, 0x32, 0x2e, 0x2e, 0xf6, 0xf0, 0xe8, 0xea, 0xea, 0xea, 0xea, 0xf3, 0xf1, 0xfd, 0xfd, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf4, 0xf4, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf4, 0xfc, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf4, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf4, 0xf4, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xec, 0xe8, 0xeb, 0xf2, 0xca, 0xf2, 0xca, 0xf2, 0xea, 0xeb, 0xeb, 0xf4, 0xf5, 0xf2, 0xca, 0xd4, 0xf2, 0xf2, 0xf3, 0xf5, 0xf3, 0xea, 0xfc, 0xca, 0xce, 0x32, 0x2c, 0xc0, 0xab, 0x88, 0x72, 0x6d, 0x5f, 0x62, 0x5f, 0x68, 0x68, 0x72, 0x6c, 0x68, 0x67, 0x64, 0x64, 0x57, 0x50, 0x4f, 0x4a, 0x4b, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x43, 0x47, 0x47, 0x4b, 0x4b, 0x4a, 0x4f, 0x50, 0x57, 0x59, 0x5e, 0x64, 0x64, 0x68, 0x68, 0x68, 0x68, 0x63, 0x5f, 0x62, 0x63, 0x5d, 0x69, 0x96, 0xbb, 0xc3, 0xcb, 0xce, 0xcd, 0xd4, 0xfd, 0xf1, 0xf1, 0xf0, 0xeb, 0xd4, 0xf5, 0xf0, 0xf5, 0xf2, 0xf4, 0xf3, 0xf3, 0xf1, 0xeb, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xfc, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xec, 0xeb, 0xeb, 0xf2, 0xf2, 0x2d, 0xf2, 0xf2, 0xf3, 0xea, 0xe8, 0xea, 0xea, 0xf4, 0xf4, 0xf4, 0xfd, 0xfc, 0xf2, 0x2d, 0xca, 0x2d, 0x2d, 0xf4, 0xf4, 0xf4, 0xfd, 0xcc, 0x2f, 0x2c, 0x2b, 0xb7, 0x9d, 0x77, 0x62, 0x5f, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x64, 0x64, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5b, 0x5a, 0x5b, 0x5a, 0x5b, 0x5e, 0x5e, 0x5e, 0x67, 0x5e, 0x67, 0x67, 0x67, 0x68, 0x5f, 0x68, 0x5f, 0x63, 0x63, 0x63, 0x63, 0x5f, 0x5f, 0x63, 0x78, 0x91, 0x9c, 0x2a, 0x2f, 0xcc, 0x2e, 0xcd, 0xf4, 0xeb, 0xf5, 0xea, 0xea, 0xd4, 0xea, 0xf0, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf3, 0xf2, 0xea, 0xea, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf4, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf4, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf4, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xeb, 0xeb, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xea, 0xeb, 0xeb, 0xf1, 0xf4, 0xf1, 0xf4, 0xf3, 0xfc, 0xf2, 0xf2, 0xfd, 0x2d, 0xfc, 0xf3, 0xec, 0xec, 0xf4, 0xcb, 0x2f, 0x2a, 0xae, 0xb5, 0xb6, 0xb2, 0xae, 0x98, 0x95, 0x77, 0x69, 0x62, 0x63, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x68, 0x68, 0x68, 0x68, 0x63, 0x68, 0x5f, 0x63, 0x5f, 0x63, 0x5f, 0x63, 0x5f, 0x5f, 0x5f, 0x63, 0x6f, 0x78, 0x95, 0xa4, 0xad, 0xb6, 0xb9, 0xb9, 0xb6, 0x26, 0x2f, 0xcc, 0xfd, 0xe8, 0xec, 0xf1, 0xfc, 0x2d, 0xf2, 0xea, 0xea, 0xf2, 0xf2, 0xf3, 0xf1, 0xf4, 0xf3, 0xf2, 0xf3, 0xea, 0xf2, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf4, 0xf2, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xfc, 0xf2, 0xf4, 0xf4, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xeb, 0xf1, 0xeb, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0xf2, 0xeb, 0xf2, 0xf3, 0xeb, 0xf4, 0xf2, 0xfc, 0x2d, 0xeb, 0xec, 0xe8, 0xfd, 0xcb, 0x2b, 0x24, 0xb5, 0xb4, 0xb5, 0xb5, 0xb6, 0xb5, 0xb6, 0xb6, 0xb6, 0xa8, 0xa5, 0x9d, 0x95, 0x7d, 0x62, 0x69, 0x62, 0x63, 0x62, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x5f, 0x63, 0x5f, 0x5f, 0x63, 0x5f, 0x63, 0x5f, 0x63, 0x5c, 0x63, 0x62, 0x63, 0x6f, 0x8e, 0x9d, 0xa5, 0xae, 0xae, 0xb9, 0xb9, 0xb9, 0xb5, 0xb9, 0xb5, 0xb6, 0xb2, 0xaf, 0xc0, 0x2f, 0xfd, 0xf1, 0xec, 0xf3, 0xf4, 0xca, 0xf2, 0xea, 0xeb, 0xf3, 0xf3, 0xf2, 0xeb, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf4, 0xf3, 0xf4, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xfc, 0xf2, 0xeb, 0xeb, 0xf3, 0xcc, 0x2c, 0x24, 0xae, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb9, 0xb2, 0xb2, 0xb2, 0xb6, 0xb9, 0xb6, 0xb6, 0xb6, 0xb6, 0xae, 0xae, 0xaa, 0x9d, 0x9d, 0x98, 0x95, 0x95, 0x8e, 0x84, 0x8e, 0x8e, 0x8e, 0x86, 0x90, 0x86, 0x98, 0x9a, 0xa3, 0xa5, 0xae, 0xae, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb5, 0xb2, 0xb5, 0xb2, 0xb2, 0xb5, 0xb9, 0xb2, 0x24, 0xc3, 0x2f, 0xfd, 0xec, 0xec, 0xeb, 0xf2, 0xf2, 0xf2, 0xeb, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf4, 0xf1, 0xf3, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf3, 0xf1, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf3, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf4, 0xf1, 0xf3, 0xf1, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xea, 0xeb, 0xea, 0xeb, 0xeb, 0xf4, 0x2e, 0x2f, 0xba, 0x22, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb5, 0xb5, 0xb5, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb5, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb5, 0xb5, 0xb5, 0xb5, 0xb2, 0xb2, 0xb2, 0xb5, 0xb5, 0xb2, 0xb5, 0xb4, 0xb5, 0xb4, 0xb2, 0xb9, 0xaf, 0x24, 0x2c, 0xcc, 0xf0, 0xed, 0xe8, 0xeb, 0xf2, 0xfc, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xe8, 0xeb, 0xec, 0xf2, 0xfd, 0x2f, 0xc0, 0x1e, 0xb6, 0xb0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb0, 0xb4, 0xb0, 0xb0, 0xb4, 0xb2, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb5, 0xb5, 0xb5, 0xb9, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xb4, 0xb2, 0xb2, 0xb5, 0xb5, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xaf, 0xba, 0x2c, 0x31, 0xe8, 0xed, 0xec, 0xf3, 0xf1, 0xfc, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf4, 0xf4, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe8, 0xea, 0xe8, 0xf5, 0x2d, 0x32, 0xc0, 0x21, 0xaf, 0xb0, 0xb0, 0xb4, 0xb2, 0xb2, 0xb4, 0xb4, 0xb0, 0xb4, 0xb0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb0, 0xb0, 0xb0, 0xb0, 0xb4, 0xb4, 0xb4, 0xb2, 0xb5, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb9, 0xb6, 0xb9, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xaf, 0x27, 0x2f, 0xca, 0xf0, 0xe8, 0xf1, 0x2e, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xeb, 0xf3, 0xf3, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xeb, 0xeb, 0xf4, 0xf4, 0xf2, 0xf2, 0xf3, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xeb, 0xeb, 0xf4, 0xf4, 0xf2, 0xf2, 0xf3, 0xf2, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xeb, 0xf3, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xeb, 0xeb, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xeb, 0xe7, 0xeb, 0xcd, 0x30, 0x2c, 0x24, 0x22, 0xb4, 0xb4, 0xb0, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb0, 0xb2, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb4, 0xb2, 0xb0, 0xad, 0xb5, 0xb5, 0xb5, 0xaf, 0xae, 0xa5, 0x9c, 0x9c, 0x95, 0x9c, 0x9a, 0xa5, 0xae, 0xb6, 0xb9, 0xb5, 0xb2, 0xb2, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0x21, 0xc3, 0x2f, 0xca, 0xf5, 0xf3, 0xf1, 0xfc, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xeb, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xea, 0xd4, 0xf0, 0x2e, 0x2c, 0xba, 0xa4, 0xb2, 0xb0, 0xb4, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb4, 0xb0, 0xad, 0xb2, 0xad, 0xb5, 0xae, 0xb6, 0xae, 0x9d, 0x78, 0x62, 0x5d, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5d, 0x62, 0x6d, 0x91, 0xae, 0xae, 0xb6, 0xae, 0xb2, 0xb2, 0xb2, 0xb0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb0, 0xb9, 0xaf, 0x22, 0xc6, 0x2f, 0xe7, 0xf5, 0xf1, 0xf3, 0xeb, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xd4, 0x2d, 0x30, 0xc0, 0x21, 0xb2, 0xb0, 0xb0, 0xb4, 0xb2, 0xb2, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb0, 0xb2, 0xb0, 0xb0, 0xad, 0xb2, 0xb6, 0xae, 0x9d, 0x78, 0x5d, 0x59, 0x59, 0x5a, 0x5d, 0x5a, 0x5a, 0x5a, 0x5e, 0x5a, 0x5d, 0x5a, 0x59, 0x5a, 0x59, 0x59, 0x72, 0x9c, 0xae, 0xb6, 0xae, 0xb2, 0xb2, 0xb4, 0xb2, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb9, 0xb0, 0xb5, 0xae, 0xba, 0x2c, 0x2e, 0xf0, 0xeb, 0xeb, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xeb, 0xf3, 0xeb, 0xf1, 0xf3, 0xf2, 0xf0, 0x2e, 0xc8, 0x21, 0xae, 0xb0, 0xb0, 0xb0, 0xb4, 0xaf, 0xb4, 0xb0, 0xb4, 0xb0, 0xb4, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb2, 0xb5, 0xb5, 0x9d, 0x78, 0x5d, 0x59, 0x59, 0x5a, 0x5e, 0x5a, 0x5b, 0x5e, 0x5b, 0x5e, 0x57, 0x5e, 0x5b, 0x5e, 0x5e, 0x5b, 0x5e, 0x57, 0x59, 0x59, 0x6d, 0x95, 0xaf, 0xb6, 0xb2, 0xb2, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xb2, 0xb4, 0xb4, 0xb0, 0xb9, 0x20, 0xc0, 0x30, 0xf2, 0xe8, 0xeb, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xeb, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf2, 0xeb, 0xeb, 0xeb, 0xf3, 0xf4, 0xfc, 0xf2, 0xfc, 0xeb, 0xf5, 0xf0, 0x2f, 0xba, 0x22, 0xaf, 0xb0, 0xb0, 0xb0, 0xb2, 0xb4, 0xb0, 0xb4, 0xb0, 0xb0, 0xb0, 0xb0, 0xb4, 0xb0, 0xb0, 0xb0, 0xae, 0xb2, 0xa5, 0x78, 0x5d, 0x59, 0x5a, 0x5a, 0x5b, 0x57, 0x5b, 0x5e, 0x5a, 0x57, 0x57, 0x5b, 0x57, 0x5e, 0x5b, 0x5a, 0x5e, 0x57, 0x5b, 0x5b, 0x5e, 0x5b, 0x57, 0x5d, 0x6d, 0x9d, 0xb6, 0xaa, 0xb2, 0xb0, 0xb0, 0xb0, 0xb2, 0xb5, 0xb2, 0xb2, 0xb4, 0xb4, 0xb2, 0xb2, 0xb4, 0xb4, 0xb4, 0xaf, 0x21, 0x2b, 0x2e, 0xe8, 0xe9, 0xeb, 0xf2, 0xf2, 0xfc, 0xf2, 0xf3, 0xeb, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xea, 0xeb, 0xec, 0xeb, 0xfd, 0xca, 0xfd, 0xf1, 0xeb, 0xec, 0x2e, 0x2b, 0x22, 0xad, 0xb0, 0xb0, 0xb2, 0xb2, 0xb0, 0xb0, 0xb2, 0xb0, 0xb0, 0xb0, 0xb0, 0xb4, 0xa9, 0xb0, 0xad, 0xb2, 0xb6, 0x9d, 0x62, 0x59, 0x5a, 0x5b, 0x5b, 0x5b, 0x5b, 0x5e, 0x5e, 0x57, 0x5a, 0x5a, 0x5e, 0x5a, 0x5e, 0x5a, 0x5e, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e, 0x5b, 0x5b, 0x5b, 0x5a, 0x59, 0x62, 0x9c, 0xaf, 0xa6, 0xa9, 0xa6, 0xa9, 0xa6, 0xad, 0xad, 0xad, 0xb0, 0xb4, 0xb4, 0xb4, 0xb5, 0xb2, 0xb5, 0xb4, 0xaf, 0x25, 0x2f, 0xe8, 0xe8, 0xec, 0xeb, 0x2d, 0xfc, 0x2d, 0xeb, 0xf3, 0xec, 0xf3, 0xf2, 0xf3, 0xeb, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xea, 0xeb, 0xeb, 0xeb, 0xf4, 0xfc, 0xfc, 0xf2, 0xeb, 0xf0, 0x30, 0x24, 0xae, 0xb2, 0xb0, 0xb2, 0xb0, 0xaa, 0xad, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xb0, 0xad, 0xb0, 0xaa, 0xb2, 0xa3, 0x78, 0x59, 0x59, 0x5d, 0x5a, 0x5a, 0x5b, 0x5a, 0x55, 0x5e, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5d, 0x5a, 0x5a, 0x5a, 0x5b, 0x59, 0x5a, 0x59, 0x59, 0x91, 0xae, 0x9f, 0xa1, 0x9f, 0xa6, 0x99, 0x9f, 0x9f, 0xa6, 0xa1, 0xa9, 0xa9, 0xad, 0xb5, 0xb5, 0xb0, 0xb5, 0x9a, 0xc0, 0xce, 0xea, 0xed, 0xf2, 0xf2, 0xfc, 0xf2, 0xf3, 0xeb, 0xeb, 0xf3, 0xf2, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xeb, 0xec, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xea, 0x2e, 0xc3, 0x21, 0xaf, 0xad, 0xb0, 0xa9, 0xa9, 0xa9, 0xa1, 0xa9, 0xa1, 0xa9, 0xa9, 0xa9, 0xa9, 0xaa, 0xad, 0xae, 0xae, 0x86, 0x59, 0x5a, 0x5a, 0x5a, 0x5e, 0x5a, 0x5a, 0x5c, 0x5a, 0x5c, 0x5a, 0x5a, 0x5a, 0x5e, 0x5a, 0x5a, 0x5a, 0x57, 0x5a, 0x57, 0x5a, 0x5a, 0x5d, 0x59, 0x5a, 0x5a, 0x5a, 0x57, 0x5a, 0x5e, 0x57, 0x5d, 0x9d, 0xaa, 0x9f, 0xa1, 0x9f, 0xa6, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0xa6, 0xa6, 0xad, 0xb0, 0xb2, 0xb7, 0xab, 0xc9, 0xcd, 0xeb, 0xeb, 0xf2, 0xf2, 0xf2, 0xeb, 0xeb, 0xf3, 0xf4, 0xf2, 0xf1, 0xeb, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xea, 0xf2, 0xf2, 0xf4, 0xeb, 0xec, 0xec, 0xf2, 0xf2, 0xca, 0x2f, 0xa0, 0x9a, 0x9f, 0xa1, 0xa6, 0xa1, 0xa1, 0xa6, 0xa9, 0xa6, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xad, 0xaa, 0xae, 0x78, 0x59, 0x5a, 0x57, 0x57, 0x5e, 0x5a, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b, 0x58, 0x57, 0x58, 0x57, 0x58, 0x5b, 0x5b, 0x5b, 0x5b, 0x56, 0x5d, 0x5a, 0x59, 0x5a, 0x5e, 0x55, 0x53, 0x57, 0x55, 0x62, 0xa5, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa6, 0xa1, 0xa6, 0x9f, 0x9f, 0x99, 0xa1, 0x99, 0xa6, 0xae, 0x9c, 0xbe, 0x2f, 0xea, 0xf2, 0xeb, 0xec, 0xec, 0xeb, 0xf1, 0xfc, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xea, 0xf2, 0xf2, 0xf2, 0xeb, 0xec, 0xec, 0xe8, 0xca, 0xce, 0xc0, 0x86, 0x1c, 0x99, 0xa6, 0xa6, 0xa6, 0xa9, 0xa6, 0xa6, 0xa6, 0xa6, 0xa9, 0xa9, 0xa9, 0xa9, 0xaa, 0xae, 0x86, 0x5d, 0x59, 0x5a, 0x5b, 0x5e, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x57, 0x58, 0x4f, 0x4b, 0x47, 0x43, 0x43, 0x43, 0x3f, 0x47, 0x43, 0x4b, 0x4b, 0x4f, 0x58, 0x56, 0x5b, 0x5a, 0x57, 0x5a, 0x5e, 0x57, 0x5b, 0x57, 0x55, 0x91, 0xae, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa6, 0x9f, 0xa6, 0x9f, 0xa6, 0xa6, 0xa6, 0x99, 0x99, 0xa5, 0xa5, 0xc6, 0xca, 0xfc, 0xeb, 0xed, 0xec, 0xeb, 0xfc, 0xf2, 0xfc, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xeb, 0xeb, 0xf2, 0xf2, 0xf3, 0xe8, 0xec, 0xea, 0xcc, 0xcb, 0xa0, 0x86, 0xa3, 0xa9, 0xa6, 0xa9, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xad, 0xa6, 0xa6, 0xa9, 0xaa, 0xa5, 0x62, 0x5d, 0x59, 0x5e, 0x57, 0x5a, 0x57, 0x57, 0x5e, 0x58, 0x4f, 0x48, 0x3f, 0x36, 0x38, 0x38, 0x3b, 0x3b, 0x38, 0x3b, 0x38, 0x3b, 0x38, 0x38, 0x38, 0x43, 0x4b, 0x4f, 0x58, 0x5e, 0x57, 0x57, 0x57, 0x5a, 0x5a, 0x52, 0x62, 0xa5, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa8, 0x9f, 0x9f, 0xa1, 0xa6, 0x9f, 0x99, 0x98, 0x95, 0xba, 0xcc, 0xcc, 0xe8, 0xec, 0xec, 0xf2, 0xfc, 0x2d, 0xf3, 0xf1, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xeb, 0xec, 0xeb, 0xfc, 0x2d, 0xf4, 0xe8, 0xec, 0xd4, 0xce, 0xbe, 0x6d, 0x9f, 0xa1, 0x9f, 0xa9, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa8, 0x9f, 0x99, 0x99, 0x99, 0xa4, 0xae, 0x8e, 0x59, 0x59, 0x5b, 0x55, 0x5a, 0x5e, 0x57, 0x57, 0x4b, 0x47, 0x3f, 0x36, 0x36, 0x38, 0x3e, 0x3d, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3a, 0x3e, 0x38, 0x36, 0x38, 0x47, 0x4f, 0x58, 0x57, 0x5a, 0x57, 0x57, 0x57, 0x59, 0x95, 0xa3, 0x9f, 0x9f, 0x99, 0x92, 0x99, 0x92, 0x98, 0x98, 0x9f, 0xa6, 0xa6, 0xa6, 0x9f, 0x9f, 0x9f, 0x92, 0x97, 0xc6, 0xcb, 0xfc, 0xe9, 0xf6, 0xf3, 0x2d, 0xfc, 0xf4, 0xec, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xec, 0xeb, 0xfc, 0x2d, 0xf2, 0xf5, 0xe8, 0xca, 0x32, 0x96, 0x78, 0xa9, 0x9f, 0x9f, 0xa9, 0x9f, 0xa6, 0xa6, 0xa6, 0x99, 0x92, 0x87, 0x92, 0x87, 0x99, 0xa8, 0xae, 0x6d, 0x59, 0x52, 0x5e, 0x5b, 0x5a, 0x5b, 0x58, 0x47, 0x3b, 0x38, 0x3d, 0x3c, 0x38, 0x39, 0x3a, 0x3c, 0x3a, 0x3c, 0x3a, 0x3c, 0x3a, 0x3c, 0x3a, 0x3e, 0x38, 0x3e, 0x3b, 0x38, 0x38, 0x3b, 0x4b, 0x58, 0x57, 0x57, 0x5a, 0x5e, 0x52, 0x6d, 0xa3, 0x9f, 0x99, 0x92, 0x7f, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x9f, 0xa6, 0x9f, 0xa8, 0xa8, 0x98, 0x92, 0x86, 0xbb, 0x30, 0xca, 0xf1, 0xec, 0xf2, 0xca, 0xfd, 0xf3, 0xec, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf1, 0xed, 0xeb, 0x2d, 0xca, 0x2d, 0xec, 0xeb, 0xce, 0xc3, 0x64, 0x95, 0xa6, 0xa1, 0x9f, 0xa4, 0xa6, 0x9f, 0x99, 0x92, 0x87, 0x92, 0x8c, 0x92, 0x92, 0x98, 0xaa, 0xa3, 0x5d, 0x5d, 0x57, 0x5b, 0x53, 0x5b, 0x4f, 0x38, 0x38, 0x41, 0x3c, 0x3c, 0x38, 0x41, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x40, 0x3c, 0x37, 0x3c, 0x3a, 0x3a, 0x43, 0x58, 0x5b, 0x53, 0x5b, 0x59, 0x5d, 0xa4, 0x9f, 0x9f, 0x92, 0x87, 0x89, 0x89, 0x80, 0x7f, 0x87, 0x84, 0x99, 0xa6, 0xa8, 0x9f, 0xa6, 0x9f, 0x8f, 0x85, 0xc6, 0xcd, 0xec, 0xe8, 0xfd, 0x2d, 0xca, 0xf3, 0xec, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf1, 0xeb, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xe8, 0xec, 0x2d, 0xfd, 0xfc, 0xea, 0xea, 0xce, 0xa7, 0x6d, 0xa3, 0xa6, 0x99, 0xa4, 0x99, 0xa3, 0x92, 0x92, 0x8d, 0x92, 0x8b, 0x8b, 0x8c, 0x87, 0x98, 0xa8, 0xa5, 0x59, 0x59, 0x5e, 0x53, 0x5b, 0x4f, 0x43, 0x3b, 0x3a, 0x39, 0x39, 0x3c, 0x3d, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3a, 0x40, 0x40, 0x39, 0x39, 0x3c, 0x38, 0x38, 0x47, 0x53, 0x5b, 0x53, 0x5e, 0x5d, 0x95, 0x9f, 0x98, 0x92, 0x7f, 0x8b, 0x89, 0x80, 0x8b, 0x87, 0x87, 0x84, 0x92, 0x9f, 0xa8, 0xa8, 0xa6, 0x9d, 0x79, 0xbe, 0x30, 0xe8, 0xeb, 0xfc, 0x2d, 0xfd, 0xf3, 0xec, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf1, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xfc, 0xf4, 0xf2, 0xe8, 0xea, 0xea, 0xc6, 0x64, 0x95, 0xa6, 0x9f, 0x9f, 0x9f, 0x98, 0x87, 0x8d, 0x8b, 0x8d, 0x8b, 0x92, 0x8d, 0x92, 0x87, 0x98, 0xae, 0x9d, 0x59, 0x59, 0x57, 0x58, 0x61, 0x42, 0x38, 0x3d, 0x3a, 0x41, 0x3a, 0x3a, 0x3a, 0x38, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x37, 0x40, 0x3a, 0x3d, 0x38, 0x38, 0x38, 0x46, 0x58, 0x58, 0x59, 0x5d, 0x78, 0xa3, 0x99, 0x92, 0x87, 0x87, 0x89, 0x80, 0x80, 0x8b, 0x89, 0x8d, 0x7f, 0x8d, 0x98, 0xa8, 0xa8, 0xa8, 0x86, 0x97, 0xcb, 0xe8, 0xe8, 0xec, 0xf2, 0xca, 0xfd, 0xfc, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf4, 0xf3, 0xf1, 0xeb, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xfc, 0xfc, 0xf1, 0xf3, 0xec, 0xea, 0xff, 0xb3, 0x59, 0xa4, 0x9f, 0x9f, 0x99, 0x98, 0x8d, 0x87, 0x92, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8d, 0x87, 0x98, 0xa8, 0x9c, 0x59, 0x59, 0x57, 0x58, 0x4b, 0x37, 0x3d, 0x42, 0x38, 0x3d, 0x3a, 0x38, 0x3a, 0x3e, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x38, 0x3d, 0x38, 0x3b, 0x48, 0x5b, 0x57, 0x59, 0x78, 0x9d, 0x98, 0x87, 0x92, 0x7f, 0x87, 0x80, 0x89, 0x80, 0x80, 0x89, 0x87, 0x87, 0x8d, 0x99, 0xa8, 0x9f, 0xa3, 0x64, 0xc1, 0xcd, 0xe8, 0xe8, 0xeb, 0xf2, 0xfc, 0x2d, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xeb, 0xea, 0xea, 0xcc, 0x66, 0x79, 0x9f, 0x9f, 0x9f, 0x99, 0x92, 0x87, 0x87, 0x8b, 0x8b, 0x8b, 0x8d, 0x8b, 0x8d, 0x89, 0x92, 0x92, 0xae, 0x95, 0x59, 0x5a, 0x5b, 0x53, 0x3f, 0x3a, 0x41, 0x3a, 0x38, 0x3d, 0x3a, 0x3c, 0x38, 0x3a, 0x38, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x38, 0x3e, 0x38, 0x38, 0x4f, 0x5e, 0x57, 0x78, 0x9d, 0x99, 0x87, 0x8d, 0x89, 0x8b, 0x80, 0x80, 0x80, 0x89, 0x89, 0x87, 0x7f, 0x87, 0x8d, 0x9f, 0xa8, 0xa3, 0x6d, 0x9e, 0x33, 0xf0, 0xea, 0xf5, 0xf2, 0xfc, 0xf4, 0xf3, 0xf3, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xfc, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xec, 0xeb, 0xf2, 0xce, 0xbf, 0x59, 0x9c, 0x9f, 0x9f, 0x99, 0x92, 0x87, 0x87, 0x92, 0x8b, 0x8b, 0x8b, 0x89, 0x8b, 0x89, 0x8b, 0x8d, 0x92, 0xa3, 0x9d, 0x59, 0x59, 0x58, 0x4a, 0x3b, 0x40, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x3a, 0x38, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x41, 0x38, 0x3a, 0x3b, 0x38, 0x43, 0x61, 0x59, 0x68, 0x9d, 0x92, 0x89, 0x8d, 0x80, 0x8b, 0x80, 0x7f, 0x80, 0x7f, 0x89, 0x7f, 0x8d, 0x87, 0x7a, 0x92, 0xa8, 0xa3, 0x91, 0x56, 0xc5, 0xcd, 0xea, 0xf2, 0xeb, 0xf4, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xec, 0xeb, 0xec, 0xeb, 0xca, 0xce, 0x9e, 0x64, 0xa5, 0xa6, 0x9f, 0x92, 0x87, 0x87, 0x87, 0x89, 0x8b, 0x89, 0x8b, 0x89, 0x89, 0x8b, 0x8c, 0x92, 0x89, 0xa3, 0x9d, 0x59, 0x57, 0x58, 0x47, 0x38, 0x3d, 0x3a, 0x3d, 0x3d, 0x38, 0x3a, 0x3c, 0x38, 0x3a, 0x38, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x41, 0x3d, 0x38, 0x3e, 0x38, 0x3f, 0x4f, 0x5b, 0x62, 0x9d, 0x92, 0x7f, 0x8b, 0x8b, 0x80, 0x80, 0x8b, 0x80, 0x7f, 0x89, 0x89, 0x8d, 0x87, 0x7f, 0x87, 0x92, 0xa8, 0x9d, 0x5a, 0xb3, 0xce, 0xf0, 0xea, 0xeb, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xea, 0xec, 0xec, 0xeb, 0xcd, 0xc9, 0x57, 0x91, 0x98, 0xa6, 0x92, 0x87, 0x87, 0x87, 0x8b, 0x89, 0x89, 0x8b, 0x8b, 0x8d, 0x89, 0x7f, 0x8b, 0x89, 0x87, 0x98, 0x9d, 0x5d, 0x52, 0x53, 0x38, 0x3b, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3e, 0x3d, 0x3e, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x3b, 0x3d, 0x3d, 0x38, 0x41, 0x47, 0x5b, 0x68, 0x95, 0x89, 0x8d, 0x89, 0x80, 0x80, 0x8b, 0x7f, 0x89, 0x7f, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x87, 0x8d, 0xa8, 0xa3, 0x88, 0x06, 0xc9, 0xca, 0xca, 0xe8, 0xeb, 0xf1, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xe8, 0xec, 0xf0, 0xce, 0xbe, 0x53, 0x9d, 0xa3, 0xa6, 0x92, 0x87, 0x8d, 0x8b, 0x89, 0x8b, 0x80, 0x89, 0x8b, 0x8d, 0x89, 0x8c, 0x8c, 0x87, 0x7f, 0x98, 0x9d, 0x5d, 0x53, 0x4f, 0x38, 0x3b, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3e, 0x3a, 0x3e, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x3a, 0x3a, 0x3a, 0x38, 0x41, 0x3f, 0x57, 0x72, 0x90, 0x87, 0x8d, 0x89, 0x8b, 0x80, 0x8b, 0x89, 0x7f, 0x8b, 0x7f, 0x89, 0x7f, 0x89, 0x7f, 0x89, 0x7c, 0x9f, 0xa3, 0x95, 0x57, 0xbe, 0xce, 0xf0, 0xeb, 0xeb, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf0, 0xec, 0xf2, 0x32, 0x8a, 0x62, 0xa3, 0xa8, 0x99, 0x84, 0x8d, 0x89, 0x89, 0x80, 0x8b, 0x80, 0x89, 0x89, 0x8d, 0x87, 0x8c, 0x8c, 0x89, 0x89, 0x8b, 0x9d, 0x68, 0x50, 0x47, 0x3b, 0x38, 0x40, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3e, 0x3a, 0x3e, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3e, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x38, 0x3a, 0x3e, 0x38, 0x3f, 0x53, 0x72, 0x90, 0x8d, 0x8d, 0x8d, 0x89, 0x8b, 0x8c, 0x7f, 0x89, 0x7f, 0x89, 0x8b, 0x7f, 0x8b, 0x80, 0x89, 0x7f, 0x92, 0xa8, 0x9d, 0x5d, 0x70, 0x32, 0xca, 0xea, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xe7, 0xf5, 0xf6, 0xc9, 0x5a, 0x79, 0xa8, 0xa6, 0x99, 0x92, 0x89, 0x89, 0x8b, 0x80, 0x8b, 0x80, 0x89, 0x8b, 0x87, 0x8b, 0x8c, 0x8c, 0x7f, 0x8d, 0x8b, 0x9d, 0x72, 0x53, 0x43, 0x38, 0x3a, 0x3b, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3e, 0x3a, 0x3e, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x38, 0x3a, 0x3a, 0x3a, 0x3c, 0x38, 0x38, 0x4f, 0x82, 0x8c, 0x8d, 0x8d, 0x8d, 0x89, 0x8c, 0x89, 0x87, 0x89, 0x7f, 0x89, 0x80, 0x80, 0x80, 0x8b, 0x80, 0x89, 0x8d, 0xa8, 0xa8, 0x6d, 0x5b, 0xc5, 0xcd, 0xf5, 0xf0, 0xfc, 0xf2, 0xeb, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x2d, 0xf2, 0xf2, 0x31, 0xbf, 0x56, 0x95, 0xa8, 0xa8, 0x92, 0x84, 0x8d, 0x8b, 0x80, 0x8b, 0x80, 0x8b, 0x80, 0x89, 0x87, 0x89, 0x8c, 0x80, 0x89, 0x8b, 0x8b, 0x90, 0x72, 0x50, 0x42, 0x3e, 0x37, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3e, 0x3a, 0x3e, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3e, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3c, 0x3e, 0x3f, 0x4a, 0x91, 0x8c, 0x8d, 0x92, 0x8d, 0x87, 0x87, 0x8c, 0x89, 0x8c, 0x89, 0x7f, 0x8b, 0x7f, 0x80, 0x80, 0x80, 0x89, 0x87, 0xa8, 0xa3, 0x88, 0x56, 0xbc, 0xcd, 0xf0, 0xf2, 0xfc, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xfc, 0xf0, 0xce, 0x9e, 0x5d, 0xa5, 0xa6, 0xa6, 0x84, 0x8d, 0x8b, 0x89, 0x89, 0x8b, 0x8b, 0x89, 0x89, 0x8b, 0x8d, 0x89, 0x8c, 0x8b, 0x89, 0x89, 0x8b, 0x90, 0x88, 0x50, 0x43, 0x37, 0x3c, 0x3d, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x38, 0x3a, 0x3a, 0x38, 0x39, 0x3b, 0x50, 0x91, 0x8b, 0x8d, 0x8d, 0x8d, 0x87, 0x8b, 0x87, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x8b, 0x89, 0x87, 0xa6, 0xa8, 0x98, 0x59, 0x8a, 0xcd, 0xd3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xfd, 0xf4, 0xca, 0xcc, 0x6a, 0x6d, 0xaa, 0xa9, 0x9f, 0x8d, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x89, 0x8d, 0x89, 0x89, 0x8b, 0x8b, 0x8c, 0x91, 0x53, 0x3b, 0x39, 0x3c, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x3d, 0x38, 0x3d, 0x3b, 0x38, 0x3c, 0x39, 0x38, 0x57, 0x91, 0x8d, 0x7f, 0x8d, 0x7f, 0x8b, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x8d, 0x8c, 0x87, 0x9f, 0xad, 0xa3, 0x62, 0x66, 0xc7, 0xd4, 0xf0, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 
-  0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xfd, 0xf4, 0xcd, 0xc4, 0x4f, 0x88, 0xad, 0xa6, 0x9f, 0x87, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x8b, 0x89, 0x8c, 0x8c, 0x91, 0x5a, 0x38, 0x41, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x38, 0x3d, 0x38, 0x3a, 0x3a, 0x38, 0x41, 0x3f, 0x64, 0x90, 0x89, 0x8d, 0x89, 0x89, 0x8b, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x8b, 0x8d, 0x8c, 0x87, 0x99, 0xad, 0xa3, 0x69, 0x53, 0xbc, 0xff, 0xf0, 0xf5, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xeb, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf1, 0xfc, 0xff, 0xbb, 0x56, 0x9a, 0xaa, 0xa9, 0x99, 0x87, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x7f, 0x8b, 0x87, 0x8c, 0x91, 0x6c, 0x3f, 0x42, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3b, 0x38, 0x3a, 0x38, 0x47, 0x79, 0x81, 0x7f, 0x89, 0x89, 0x7f, 0x8b, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x8d, 0x8b, 0x8b, 0x87, 0x9f, 0xa8, 0xad, 0x82, 0x57, 0x9e, 0xff, 0xf2, 0xf4, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 
-  0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf0, 0x33, 0x8a, 0x5a, 0xa5, 0xa6, 0xad, 0x99, 0x87, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x87, 0x81, 0x88, 0x4f, 0x3b, 0x3b, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x3a, 0x38, 0x3d, 0x38, 0x3b, 0x3f, 0x4f, 0x91, 0x81, 0x7f, 0x8d, 0x7f, 0x8b, 0x7f, 0x89, 0x7f, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x8b, 0x8d, 0x8c, 0x7f, 0x9f, 0xa6, 0xa8, 0x9d, 0x5a, 0x70, 0xcc, 0x2d, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xfc, 0xcb, 0x70, 0x05, 0xa3, 0xaa, 0xa9, 0x99, 0x8d, 0x89, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x80, 0x89, 0x89, 0x89, 0x7d, 0x91, 0x5e, 0x3b, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3f, 0x3f, 0x64, 0x88, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x8d, 0x8b, 0x89, 0x87, 0x9f, 0xa8, 0xa8, 0xa3, 0x59, 0x66, 0xc8, 0xd4, 0xf1, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf5, 0xca, 0xc5, 0x6a, 0x68, 0xae, 0xaa, 0xa9, 0x99, 0x87, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x80, 0x8b, 0x8c, 0x8b, 0x7f, 0x89, 0x8c, 0x82, 0x79, 0x47, 0x3f, 0x3a, 0x3a, 0x41, 0x3a, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x38, 0x3a, 0x41, 0x38, 0x3d, 0x3f, 0x43, 0x88, 0x7b, 0x90, 0x7f, 0x89, 0x8b, 0x89, 0x8b, 0x8d, 0x7f, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x8b, 0x8d, 0x8b, 0x89, 0x98, 0xad, 0xa8, 0xa3, 0x62, 0x57, 0xc1, 0xcd, 0xf1, 0xf5, 0xf3, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xec, 0xcd, 0xc1, 0x5a, 0x86, 0xae, 0xa9, 0xaa, 0x99, 0x87, 0x8d, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x7f, 0x80, 0x80, 0x89, 0x89, 0x8d, 0x7f, 0x8e, 0x82, 0x53, 0x3f, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3b, 0x3d, 0x38, 0x3f, 0x50, 0x91, 0x8e, 0x89, 0x89, 0x8b, 0x89, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x8d, 0x8b, 0x8b, 0x87, 0x98, 0xad, 0x9f, 0xa8, 0x69, 0x59, 0xbe, 0xcd, 0xf3, 0xf5, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf2, 0xec, 0xcd, 0xbe, 0x5a, 0x8e, 0xaa, 0xaa, 0xa9, 0x99, 0x87, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x80, 0x8c, 0x80, 0x8b, 0x7c, 0x89, 0x7a, 0x8c, 0x82, 0x64, 0x43, 0x3d, 0x38, 0x3a, 0x3d, 0x3d, 0x3e, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x38, 0x3f, 0x67, 0x91, 0x8c, 0x7f, 0x89, 0x89, 0x8b, 0x8b, 0x89, 0x8d, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x8b, 0x8b, 0x89, 0x8d, 0x98, 0xaa, 0xa8, 0xa8, 0x77, 0x52, 0xb3, 0xcd, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xe8, 0xff, 0xb3, 0x5d, 0x95, 0xad, 0xaa, 0xa9, 0x99, 0x87, 0x8d, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8b, 0x7f, 0x80, 0x80, 0x8b, 0x7f, 0x8d, 0x7c, 0x8c, 0x8e, 0x79, 0x4b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3b, 0x3a, 0x3d, 0x4b, 0x82, 0x7b, 0x7f, 0x89, 0x89, 0x89, 0x8c, 0x8b, 0x89, 0x89, 0x8d, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x8d, 0x8b, 0x8b, 0x7f, 0x98, 0xad, 0x9f, 0xad, 0x80, 0x59, 0x96, 0xce, 0xf2, 0xeb, 0xf5, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf2, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xea, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf5, 0xf2, 0xea, 0xf5, 0xec, 0x33, 0xa7, 0x5d, 0x95, 0xad, 0xa9, 0xa9, 0x99, 0x87, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x89, 0x80, 0x8b, 0x89, 0x89, 0x8d, 0x89, 0x8b, 0x81, 0x82, 0x57, 0x36, 0x3b, 0x37, 0x3a, 0x3e, 0x3b, 0x3b, 0x3b, 0x3c, 0x3c, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3a, 0x3d, 0x38, 0x3b, 0x3d, 0x3d, 0x3a, 0x3b, 0x38, 0x53, 0x91, 0x7d, 0x8b, 0x8b, 0x8d, 0x7f, 0x8c, 0x8b, 0x8b, 0x8d, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x8b, 0x8b, 0x89, 0x89, 0x98, 0xad, 0xa6, 0xad, 0x90, 0x55, 0x8a, 0xce, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf4, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xeb, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf2, 0xf4, 0xfc, 0xf4, 0xf4, 0xf4, 0xf1, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xe8, 0xeb, 0xe8, 0xf1, 0x31, 0x9e, 0x5a, 0x9d, 0xad, 0xa9, 0xb0, 0x99, 0x87, 0x89, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x7f, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x88, 0x3f, 0x45, 0x37, 0x39, 0x3a, 0x3b, 0x43, 0x3a, 0x39, 0x39, 0x3c, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x39, 0x39, 0x3a, 0x3f, 0x3f, 0x3a, 0x40, 0x3a, 0x42, 0x3f, 0x72, 0x8b, 0x8b, 0x89, 0x8b, 0x8b, 0x8b, 0x89, 0x89, 0x8b, 0x8b, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x8b, 0x7a, 0xa6, 0xad, 0xa9, 0xa6, 0x98, 0x5d, 0x70, 0xcb, 0xfd, 0xf4, 0xf1, 0xf6, 0xf5, 0xfc, 0xf2, 0xf2, 0xca, 0xf2, 0xca, 0xf3, 0xea, 0xf2, 0xf2, 0x2d, 0xfd, 0xfc, 0xf1, 0xf2, 0xeb, 0xe8, 0xf4, 0xeb, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf4, 0xf1, 0xf4, 0xf5, 0xf3, 0xeb, 0xd4, 0xeb, 0xfd, 0x32, 0x9e, 0x59, 0x9c, 0xb0, 0xa9, 0xa9, 0x99, 0x87, 0x8b, 0x8b, 0x8b, 0x7f, 0x89, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x7f, 0x91, 0x4f, 0x38, 0x39, 0x39, 0x3a, 0x3b, 0x3f, 0x3b, 0x39, 0x39, 0x3d, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x40, 0x38, 0x3f, 0x38, 0x3a, 0x40, 0x3a, 0x3f, 0x4f, 0x88, 0x8b, 0x89, 0x8b, 0x7f, 0x8b, 0x89, 0x8b, 0x89, 0x8b, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x7f, 0x9f, 0xad, 0xa6, 0xad, 0x98, 0x62, 0x66, 0xc9, 0xf6, 0xf4, 0xf5, 0xeb, 0xeb, 0xeb, 0xea, 0xe8, 0xeb, 0xeb, 0xf3, 0xeb, 0xe8, 0xf2, 0xf2, 0xf4, 0xfc, 0xfc, 0xf2, 0xeb, 0xeb, 0xea, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xeb, 0xf2, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xeb, 0xf3, 0xeb, 0xf2, 0xeb, 0xf2, 0xeb, 0xf2, 0xf3, 0xf3, 0xf4, 0xf4, 0xfc, 0xca, 0x2d, 0xca, 0x2d, 0x30, 0x8a, 0x64, 0x95, 0xad, 0xa9, 0xb0, 0x99, 0x87, 0x7f, 0x8b, 0x89, 0x8b, 0x89, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x89, 0x89, 0x7f, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x8e, 0x6c, 0x3f, 0x3b, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x3d, 0x3c, 0x3d, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x38, 0x3b, 0x3e, 0x3a, 0x3c, 0x42, 0x3f, 0x5e, 0x91, 0x80, 0x89, 0x89, 0x8b, 0x89, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x87, 0xa8, 0xa9, 0xa9, 0xa8, 0x95, 0x5c, 0x66, 0xc9, 0xca, 0xfd, 0xf4, 0xf2, 0xeb, 0xed, 0xec, 0xe8, 0xed, 0xe8, 0xec, 0xe8, 0xeb, 0xeb, 0xeb, 0xf4, 0xf1, 0xf4, 0xf2, 0xf3, 0xea, 0xeb, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf4, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf4, 0xf3, 
-  0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xeb, 0xeb, 0xeb, 0xeb, 0xea, 0xf2, 0xea, 0xea, 0xeb, 0xf2, 0xf2, 0xf2, 0xfd, 0xca, 0x2e, 0xce, 0x2e, 0x30, 0x32, 0x70, 0x64, 0x9c, 0xad, 0xa9, 0xa9, 0x9f, 0x87, 0x7f, 0x8b, 0x8b, 0x7f, 0x89, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x81, 0x88, 0x4a, 0x3b, 0x39, 0x39, 0x3e, 0x40, 0x3b, 0x3b, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x40, 0x40, 0x3b, 0x3e, 0x38, 0x39, 0x3a, 0x3b, 0x4a, 0x79, 0x81, 0x89, 0x8b, 0x7f, 0x8b, 0x7f, 0x89, 0x8b, 0x89, 0x8b, 0x8b, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x7f, 0x92, 0xa6, 0xad, 0xa9, 0xa8, 0x98, 0x62, 0x53, 0xc6, 0x32, 0x31, 0x2e, 0xcd, 0xf2, 0xeb, 0xea, 0xec, 0xe8, 0xec, 0xec, 0xec, 0xeb, 0xeb, 0xf3, 0xf3, 0xf3, 0xf4, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf0, 0xf2, 0xf0, 0xf3, 0xfc, 0xf3, 0xf3, 0xeb, 0xeb, 0xeb, 0xe8, 0xfc, 0xea, 0xf2, 0xd4, 0xf6, 0xd4, 0x2d, 0xfd, 0x2e, 0xc8, 0xbc, 0x9b, 0x9b, 0xbe, 0xc9, 0x6a, 0x5d, 0x95, 0xae, 0xa9, 0xad, 0xa1, 0x87, 0x7f, 0x8b, 0x89, 0x8b, 0x89, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x89, 0x89, 0x7f, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x91, 0x5d, 0x3f, 0x3a, 0x39, 0x39, 0x3d, 0x3b, 0x3b, 0x3b, 0x3d, 0x3a, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3b, 0x3b, 0x3b, 0x3a, 0x39, 0x39, 0x36, 0x3f, 0x53, 0x91, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x7f, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x89, 0x87, 0x92, 0xa8, 0xa9, 0xa6, 0xad, 0x8e, 0x5d, 0x5a, 0xbe, 0xac, 0x9b, 0xb3, 0x2d, 0x30, 0x2d, 0xca, 0xf6, 0xf7, 0xf7, 0xf6, 0xfc, 0xf0, 0xeb, 0xeb, 0xeb, 0xeb, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf0, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xeb, 0xeb, 0xeb, 0xe8, 0xeb, 0xf2, 0xf0, 0xcd, 0x2d, 0xc7, 0xc7, 0xe7, 0x32, 0x2d, 0xc8, 0x6e, 0x00, 0x01, 0x01, 0x01, 0x14, 0x64, 0x64, 0x78, 0xb2, 0xa9, 0xad, 0xa6, 0x87, 0x87, 0x8b, 0x8b, 0x7f, 0x89, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x8d, 0x8c, 0x82, 0x47, 0x3b, 0x3c, 0x39, 0x3c, 0x3d, 0x3b, 0x3b, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x3b, 0x3b, 0x3d, 0x3a, 0x39, 0x3c, 0x38, 0x43, 0x72, 0x90, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x87, 0x92, 0xad, 0xad, 0x9f, 0xad, 0x95, 0x62, 0x5d, 0x56, 0x4b, 0x02, 0x01, 0x6a, 0xc1, 0x30, 0x30, 0xc8, 0xc4, 0xc1, 0xc8, 0x31, 0x2d, 0xf2, 0xf3, 0xeb, 0xeb, 0xec, 0xeb, 0xf3, 0xfc, 0xfc, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf0, 0xeb, 0xf0, 0xf3, 0xfc, 0xf3, 0xeb, 0xec, 0xeb, 0xf0, 0xf6, 0xca, 0xc8, 0x93, 0x4d, 0x51, 0x65, 0xc4, 0x32, 0x23, 0x00, 0x02, 0x02, 0x02, 0x06, 0x0d, 0x05, 0x64, 0x0f, 0xae, 0xad, 0xaa, 0xad, 0x84, 0x8d, 0x8c, 0x89, 0x8b, 0x89, 0x8b, 0x89, 0x8b, 0x89, 0x8b, 0x8b, 0x89, 0x89, 0x7f, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x8b, 0x82, 0x57, 0x3f, 0x3b, 0x39, 0x3c, 0x3d, 0x3b, 0x3b, 0x3d, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x3b, 0x40, 0x3a, 0x3a, 0x41, 0x38, 0x50, 0x88, 0x8c, 0x7f, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x7f, 0x89, 0x89, 0x8b, 0x87, 0x99, 0xad, 0xa6, 0xa6, 0xaa, 0x8e, 0x62, 0x08, 0x06, 0x02, 0x08, 0x0d, 0x04, 0x14, 0x2f, 0x23, 0x03, 0x00, 0x00, 0x03, 0xac, 0x32, 0x2d, 0xfc, 0xf5, 0xe8, 0xec, 0xea, 0xf3, 0xf2, 0xfc, 0xeb, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xeb, 0xeb, 0xeb, 0xf5, 0xf4, 0x2e, 0xfd, 0x9b, 0x37, 0x51, 0x01, 0x00, 0x01, 0xc8, 0x14, 0x03, 0x06, 0x02, 0x04, 0x04, 0x0d, 0x21, 0x08, 0x6d, 0xaa, 0xb0, 0xa9, 0xad, 0x99, 0x87, 0x89, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x89, 0x8b, 0x89, 0x8b, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x7c, 0x92, 0x90, 0x72, 0x47, 0x38, 0x3d, 0x3c, 0x3c, 0x3d, 0x3b, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x38, 0x3a, 0x3a, 0x40, 0x3a, 0x3f, 0x3f, 0x67, 0x91, 0x7f, 0x8d, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x8d, 0x99, 0xad, 0xa6, 0xa6, 0xa8, 0x94, 0x0f, 0x8f, 0x08, 0x08, 0x0f, 0x08, 0x0e, 0x0d, 0x06, 0x48, 0x01, 0x03, 0x02, 0x01, 0x00, 0xac, 0xcc, 0xca, 0xd4, 0xf5, 0xe8, 0xeb, 0xf1, 0xfc, 0xfc, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xeb, 0xf3, 0xf1, 0x2e, 0x2e, 0xc8, 0x00, 0x00, 0x01, 0x01, 0x03, 0x00, 0xb3, 0x1b, 0x0d, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x0f, 0x0f, 0xa4, 0xb2, 0xa6, 0xad, 0x99, 0x87, 0x89, 0x8b, 0x8b, 0x89, 0x8b, 0x89, 0x7f, 0x8b, 0x8b, 0x8b, 0x89, 0x89, 0x7f, 0x89, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x7f, 0x8d, 0x89, 0x8c, 0x82, 0x50, 0x3f, 0x3a, 0x3c, 0x3c, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3e, 0x38, 0x40, 0x40, 0x40, 0x3b, 0x4a, 0x85, 0x81, 0x7a, 0x92, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x7f, 0x89, 0x89, 0x8b, 0x87, 0xa6, 0xa6, 0xa8, 0xa6, 0xaa, 0x94, 0x0f, 0x08, 0x05, 0x0c, 0x0f, 0x12, 0x08, 0x1b, 0x02, 0x02, 0x02, 0x0d, 0x02, 0x02, 0x01, 0x61, 0xc9, 0x2e, 0xca, 0xea, 0xeb, 0xec, 0xf2, 0xf4, 0xfc, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xfc, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xf4, 0xf3, 0xf3, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xeb, 0xeb, 0xf3, 0xf1, 0xfd, 0x2e, 0xc8, 0x00, 0x00, 0x01, 0x03, 0x01, 0x07, 0x14, 0x1b, 0x0d, 0x0e, 0x04, 0x04, 0x04, 0x05, 0x04, 0x08, 0x8f, 0xaf, 0xb4, 0xa9, 0xb0, 0xa1, 0x87, 0x89, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x7f, 0x7f, 0x91, 0x6c, 0x43, 0x3b, 0x3e, 0x39, 0x3c, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x38, 0x3c, 0x3a, 0x40, 0x40, 0x3f, 0x5e, 0x88, 0x81, 0x87, 0x8d, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x7f, 0x89, 0x89, 0x8d, 0x87, 0xa6, 0xad, 0xa6, 0xa6, 0xa4, 0xa1, 0x17, 0x0c, 0x10, 0x0c, 0x12, 0x0f, 0x0e, 0x08, 0x01, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x65, 0xc3, 0xce, 0xf0, 0xf5, 0xe8, 0xeb, 0xf4, 0xf1, 0xfc, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf4, 0xf1, 0xf2, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xfc, 0xf2, 0xf2, 0xeb, 0xeb, 0xea, 0xf6, 0xcb, 0xc8, 0x51, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x05, 0x18, 0x0f, 0x05, 0x04, 0x05, 0x04, 0x08, 0x19, 0xa1, 0xb5, 0xa9, 0xb0, 0xa9, 0x84, 0x89, 0x8c, 0x7a, 0x80, 0x80, 0x80, 0x89, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x8b, 0x89, 0x8d, 0x89, 0x90, 0x7b, 0x4f, 0x3b, 0x3d, 0x3a, 0x3b, 0x3b, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x41, 0x3a, 0x41, 0x37, 0x43, 0x47, 0x7b, 0x91, 0x7a, 0x8c, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x8b, 0x7f, 0x8d, 0x87, 0x92, 0xa6, 0xad, 0xa6, 0xa6, 0xa9, 0xaf, 0x1f, 0x0c, 0x0c, 0x0b, 0x0c, 0x08, 0x8f, 0x0e, 0x56, 0x04, 0x02, 0x04, 0x02, 0x56, 0x02, 0x6a, 0xc9, 0xcd, 0xea, 0xe8, 0xed, 0xec, 0xeb, 0xf2, 0xf2, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xeb, 0xf4, 0xf3, 0xf4, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xfc, 0xeb, 0xf3, 0xe8, 0xca, 0xf0, 0x32, 0x30, 0x6a, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0x04, 0x9a, 0x12, 0x08, 0x0f, 0x12, 0x0f, 0x8f, 0x1c, 0x1f, 0xb4, 0xb0, 0xaa, 0xa9, 0x92, 0x7a, 0x89, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x89, 0x89, 0x89, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x89, 0x8d, 0x7f, 0x8b, 0x91, 0x64, 0x3f, 0x42, 0x3a, 0x3a, 0x3b, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3d, 0x40, 0x38, 0x3d, 0x42, 0x3b, 0x5a, 0x91, 0x89, 0x7f, 0x8b, 0x7e, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x89, 0x7f, 0x7f, 0x89, 0x80, 0x7f, 0x80, 0x8b, 0x7f, 0x87, 0x87, 0x92, 0xa8, 0xad, 0xa6, 0xa1, 0xaa, 0xa9, 0x1c, 0x0c, 0x0f, 0x12, 0x12, 0x08, 0x8f, 0x9c, 0x05, 0x02, 0x04, 0x02, 0x02, 0x02, 0x56, 0x1b, 0xbf, 0xcc, 0xd4, 0xeb, 0xe8, 0xec, 0xf5, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf1, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xfc, 0xf5, 0xf5, 0xf0, 0xf2, 0xcd, 0x2e, 0xc5, 0xc3, 0xba, 0x00, 0x04, 0x04, 0x07, 0x04, 0x0a, 0x05, 0x05, 0x9a, 0x1e, 0x1c, 0x1e, 0x1f, 0x1f, 0x1f, 0xa1, 0xa1, 0xb0, 0xb2, 0xb0, 0xaa, 0x99, 0x7a, 0x87, 0x80, 0x8b, 0x80, 0x80, 0x8b, 0x80, 0x8d, 0x7f, 0x89, 0x7f, 0x8b, 0x7f, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x8d, 0x7f, 0x90, 0x88, 0x4b, 0x3b, 0x3a, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3b, 0x43, 0x79, 0x8e, 0x80, 0x89, 0x89, 0x89, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x87, 0x7f, 0x7f, 0x99, 0xad, 0xad, 0xa6, 0xa9, 0xad, 0xa9, 0x99, 0x1c, 0x19, 0x1c, 0x1c, 0x1f, 0x8f, 0x19, 0x94, 0x08, 0x05, 0x08, 0x08, 0x0d, 0x0e, 0x6a, 0x00, 0xb3, 0xc7, 0x31, 0xf6, 0xf0, 0xf5, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf2, 0xf1, 0xfc, 0xf6, 0xcb, 0xac, 0x01, 0x01, 0x0d, 0x24, 0x05, 0x04, 0x05, 0x04, 0x08, 0x08, 0x94, 0x9a, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0xa1, 0xa1, 0xa9, 0xb4, 0xb0, 0xb0, 0x99, 0x7a, 0x7f, 0x8b, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x89, 0x89, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x7a, 0x8b, 0x89, 0x8d, 0x8c, 0x91, 0x57, 0x3f, 0x3a, 0x41, 0x39, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3c, 0x3b, 0x38, 0x4f, 0x91, 0x8e, 0x8b, 0x8d, 0x7c, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x89, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x89, 0x87, 0x7f, 0x9f, 0xad, 0xa9, 0xa6, 0xa9, 0xa9, 0xa1, 0xa1, 0xa1, 0xa4, 0x9d, 0x1c, 0x19, 0xa1, 0x17, 0x94, 0x1c, 0x9a, 0x94, 0x21, 0x97, 0x07, 0x4c, 0x07, 0x06, 0x06, 0xbf, 0x30, 0x2e, 0xfc, 0xeb, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xf4, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf4, 0xf4, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf4, 0xf1, 0xf2, 0xcd, 0x2e, 0xac, 0x00, 0x02, 0x05, 0x05, 0x0b, 0x22, 0x1e, 0x11, 0x0f, 0x6d, 0x19, 0x9a, 0x20, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xa1, 0xb0, 0xb4, 0xb0, 0x9f, 0x92, 0x7f, 0x7f, 0x8b, 0x80, 0x80, 0x8b, 0x80, 0x89, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x8c, 0x80, 0x7f, 0x8d, 0x8d, 0x90, 0x79, 0x47, 0x3b, 0x39, 0x39, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x3d, 0x3d, 0x43, 0x64, 0x91, 0x8e, 0x7f, 0x8d, 0x8d, 0x7c, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x7f, 0x89, 0x80, 0x80, 0x8b, 0x7f, 0x8b, 0x87, 0x87, 0x9f, 0xad, 0xad, 0xa6, 0xa9, 0xa6, 0xa1, 0xa1, 0xa1, 0xa4, 0x1c, 0xa4, 0x9a, 0x1f, 0x1c, 0x19, 0x84, 0x84, 0x94, 0x9a, 0x04, 0x00, 0x0a, 0x07, 0x07, 0x06, 0x02, 0xbf, 0x2e, 0xfc, 0xf5, 0xec, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf4, 0xf3, 0xf3, 0xf2, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf0, 0xfd, 0xfe, 0x14, 0x4c, 0x04, 0x05, 0x0b, 0x08, 0x05, 0x17, 0x1e, 0x8f, 0x17, 0x9a, 0x1e, 0x1c, 0x12, 0x11, 0x0c, 0x0c, 0x12, 0x16, 0x1f, 0x1f, 0x1f, 0xa1, 0xb0, 0xb0, 0xad, 0x87, 0x87, 0x87, 0x8b, 0x7f, 0x8b, 0x80, 0x8b, 0x7f, 0x89, 0x89, 0x8b, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x7f, 0x8c, 0x8c, 0x89, 0x8d, 0x8d, 0x7f, 0x91, 0x57, 0x3b, 0x3a, 0x39, 0x3d, 0x3d, 0x3a, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x39, 0x3a, 0x3f, 0x4b, 0x88, 0x90, 0x8c, 0x89, 0x8d, 0x8d, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x8b, 0x87, 0x8d, 0x8d, 0xa8, 0xad, 0xa6, 0xa9, 0xa9, 0xa1, 0x1f, 0x1f, 0x1c, 0x19, 0x8f, 0x0f, 0x0f, 0x12, 0x1a, 0x1f, 0x1f, 0x86, 0x9a, 0x8f, 0x06, 0x13, 0x0e, 0x11, 0x0a, 0x09, 0x01, 0x14, 0xc8, 0xf6, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf5, 0xf4, 0x2d, 0x2e, 0x6e, 0x00, 0x04, 0x05, 0x05, 0x0c, 0x09, 0x08, 0x8f, 0x8f, 0x19, 0x1c, 0x12, 0x09, 0x09, 0x10, 0x0b, 0x0a, 0x0b, 0x08, 0x10, 0x17, 0x1f, 0x1f, 0xa9, 0xb0, 0xad, 0x92, 0x92, 0x87, 0x89, 0x7f, 0x80, 0x8b, 0x7a, 0x8b, 0x87, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x80, 0x8c, 0x7f, 0x89, 0x8d, 0x89, 0x8e, 0x72, 0x3f, 0x3d, 0x39, 0x3a, 0x3d, 0x3a, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3a, 0x3b, 0x5e, 0x91, 0x8c, 0x8b, 0x89, 0x89, 0x7f, 0x89, 0x7f, 0x8b, 0x7f, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x89, 0x80, 0x80, 0x8b, 0x80, 0x87, 0x89, 0x92, 0xad, 0xad, 0xad, 0xa9, 0x1f, 0x1f, 0x1f, 0x16, 0x12, 0x0c, 0x0c, 0x08, 0x08, 0x0c, 0x0c, 0x0c, 0x8f, 0x20, 0x9a, 0x9a, 0x16, 0x0d, 0x09, 0x07, 0x04, 0x09, 0x07, 0x03, 0xc8, 0xfc, 0xf5, 0xf1, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf0, 0xfc, 0xf2, 0x30, 0xac, 0x4c, 0x02, 0x04, 0x08, 0x08, 0x05, 0x0f, 0x8f, 0x19, 0x1c, 0x15, 0x0b, 0x09, 0x10, 0x09, 0x0a, 0x0e, 0x0e, 0x09, 0x0b, 0x0c, 0x17, 0x1f, 0x1f, 0xad, 0xb0, 0x9f, 0x87, 0x87, 0x89, 0x8b, 0x80, 0x80, 0x8b, 0x89, 0x87, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x89, 0x8c, 0x8b, 0x89, 0x89, 0x89, 0x8c, 0x91, 0x4a, 0x38, 0x3d, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x38, 0x43, 0x88, 0x90, 0x89, 0x89, 0x89, 0x7f, 0x89, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x8b, 0x87, 0x7f, 0x98, 0xad, 0xa8, 0xa9, 0xaa, 0x1f, 0x1c, 0x15, 0x0b, 0x09, 0x10, 0x0b, 0x0a, 0x0c, 0x0b, 0x0c, 0x0c, 0x0c, 0x8f, 0x18, 0x9a, 0x08, 0x04, 0x05, 0x09, 0x09, 0x0a, 0x02, 0x9b, 0xca, 0xf2, 0xf6, 0xf1, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xf3, 0xeb, 0xf1, 0xf2, 0xf0, 0x31, 0xc1, 0x01, 0x06, 0x05, 0x05, 0x05, 0x08, 0x8f, 0x9a, 0x9a, 0x12, 0x08, 0x10, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x0a, 0x11, 0x0b, 0x08, 0x19, 0x1f, 0xa1, 0xb2, 0xa8, 0x92, 0x87, 0x87, 0x8b, 0x8b, 0x8b, 0x7f, 0x87, 0x8c, 0x7f, 0x89, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x8b, 0x89, 0x7f, 0x8c, 0x7d, 0x8b, 0x89, 0x7d, 0x95, 0x5e, 0x43, 0x40, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x37, 0x3b, 0x4f, 0x95, 0x8c, 0x7f, 0x8d, 0x8b, 0x8b, 0x7f, 0x7f, 0x89, 0x89, 0x7f, 0x89, 0x8b, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x87, 0x7f, 0xa8, 0xad, 0xad, 0xaa, 0x1f, 0x20, 0x12, 0x09, 0x0b, 0x09, 0x0b, 0x09, 0x09, 0x09, 0x0c, 0x0b, 0x0c, 0x11, 0x09, 0x17, 0x1e, 0x8f, 0x08, 0x08, 0x05, 0x09, 0x04, 0x01, 0xbe, 0xf6, 0xca, 0xf1, 0xfd, 0xf3, 0xeb, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xea, 0xf2, 0xf2, 0x2d, 0x32, 0xbc, 0x03, 0x02, 0x05, 0x08, 0x08, 0x8f, 0x9a, 0x8f, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x0c, 0x0c, 0x09, 0x09, 0x09, 0x0c, 0x0b, 0x0f, 0x19, 0xa4, 0xaa, 0xad, 0x92, 0x92, 0x7f, 0x8b, 0x7f, 0x8b, 0x8c, 0x87, 0x89, 0x8b, 0x7f, 0x8b, 0x7f, 0x80, 0x7f, 0x8b, 0x7f, 0x8b, 0x7f, 0x89, 0x89, 0x8c, 0x8c, 0x8e, 0x7f, 0x8c, 0x81, 0x88, 0x4b, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x38, 0x42, 0x64, 0x90, 0x8d, 0x8d, 0x8d, 0x8b, 0x7d, 0x8c, 0x7f, 0x8b, 0x89, 0x8b, 0x7f, 0x89, 0x7f, 0x7f, 0x7f, 0x7f, 0x89, 0x7f, 0x89, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x87, 0x8d, 0xa8, 0xad, 0xa9, 0xaa, 0xa4, 0x12, 0x08, 0x0c, 0x0b, 0x0a, 0x0a, 0x0a, 0x09, 0x10, 0x0c, 0x0c, 0x0b, 0x09, 0x09, 0x0b, 0x94, 0xa4, 0x6d, 0x0a, 0x0c, 0x09, 0x04, 0x1b, 0x2e, 0xea, 0xf0, 0xfc, 0xfd, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf1, 0xf4, 0xf1, 0xca, 0xf0, 0x2d, 0x30, 0xc0, 0x21, 0x8f, 0x0f, 0x86, 0x8f, 0x9a, 0x12, 0x0c, 0x0c, 0x0b, 0x09, 0x09, 0x09, 0x0b, 0x0b, 0x0c, 0x0b, 0x09, 0x0b, 0x11, 0x08, 0x12, 0x20, 0xa4, 0xad, 0x99, 0x87, 0x89, 0x7f, 0x8b, 0x80, 0x7f, 0x8c, 0x7f, 0x7f, 0x89, 0x7f, 0x89, 0x89, 0x89, 0x7f, 0x8b, 0x7e, 0x8c, 0x7f, 0x7f, 0x7e, 0x7d, 0x89, 0x89, 0x89, 0x8c, 0x91, 0x53, 0x38, 0x38, 0x38, 0x41, 0x3b, 0x40, 0x3a, 0x3a, 0x3d, 0x3c, 0x38, 0x37, 0x43, 0x85, 0x8e, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8c, 0x7f, 0x7f, 0x87, 0x7f, 0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x92, 0xad, 0xad, 0xaa, 0xaa, 0x17, 0x08, 0x09, 0x0b, 0x0b, 0x0c, 0x08, 0x0a, 0x09, 0x09, 0x0c, 0x0b, 0x0a, 0x0b, 0x10, 0x0c, 0x0f, 0x9d, 0x9a, 0x9c, 0x05, 0x04, 0x23, 0xc8, 0x2e, 0xf0, 0xe8, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xfd, 0xfd, 0x2d, 0xf2, 0xf2, 0xd4, 0xc9, 0x27, 0xae, 0x95, 0x84, 0x94, 0x1a, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x09, 0x09, 0x0c, 0x08, 0x9a, 0xa4, 0xad, 0x99, 0x87, 0x8b, 0x7e, 0x80, 0x80, 0x7e, 0x7f, 0x8c, 0x80, 0x80, 0x80, 0x7f, 0x7c, 0x7f, 0x7f, 0x7f, 0x8c, 0x7e, 0x8c, 0x8b, 0x8c, 0x8c, 0x87, 0x8d, 0x7f, 0x87, 0x88, 0x6c, 0x43, 0x38, 0x3a, 0x3b, 0x3b, 0x40, 0x3a, 0x3a, 0x3d, 0x39, 0x3e, 0x38, 0x53, 0x97, 0x73, 0x92, 0x7f, 0x87, 0x80, 0x8c, 0x8b, 0x7c, 0x7c, 0x7c, 0x80, 0x7e, 0x80, 0x7d, 0x7f, 0x7f, 0x87, 0x7c, 0x87, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x87, 0x7f, 0x9f, 0xad, 0xa9, 0xaa, 0x1c, 0x08, 0x0c, 0x09, 0x0b, 0x0b, 0x0c, 0x0a, 0x0c, 0x0b, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0c, 0x08, 0x0f, 0x94, 0x98, 0x95, 0xa5, 0x2b, 0x32, 0xcc, 0xf0, 0xf2, 0xeb, 0xea, 0xec, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf1, 0xfc, 0xfd, 0xf2, 0xf0, 0xfc, 0x2f, 0x1b, 0x86, 0x84, 0x84, 0x94, 0x1c, 0x09, 0x0b, 0x09, 0x0c, 0x0b, 0x0b, 0x09, 0x09, 0x0b, 0x0b, 0x0a, 0x09, 0x09, 0x09, 0x0c, 0x0c, 0x17, 0xa4, 0xa6, 0xa3, 0x87, 0x89, 0x80, 0x80, 0x80, 0x7f, 0x87, 0x7f, 0x81, 0x81, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8d, 0x7f, 0x8c, 0x8c, 0x87, 0x92, 0x8d, 0x90, 0x91, 0x4a, 0x3f, 0x3b, 0x36, 0x3d, 0x3d, 0x3a, 0x37, 0x41, 0x3d, 0x3b, 0x3f, 0x6c, 0x91, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x7f, 0x7c, 0x8d, 0x89, 0x87, 0x89, 0x87, 0x7f, 0x7f, 0x80, 0x80, 0x76, 0x80, 0x7c, 0x87, 0x7f, 0x7f, 0x7f, 0x7f, 0x7c, 0x87, 0x9f, 0xad, 0xad, 0xa9, 0x19, 0x08, 0x0b, 0x0a, 0x0b, 0x0c, 0x0c, 0x0c, 0x0a, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x08, 0x94, 0x98, 0x98, 0x97, 0x2b, 0x30, 0xe7, 0x2d, 0xea, 0xf0, 0xec, 0xeb, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 
-  0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf5, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf0, 0xeb, 0xf2, 0xf5, 0x2d, 0xf2, 0xf3, 0xf5, 0xfc, 0xcb, 0xba, 0x9d, 0x6f, 0x84, 0x19, 0x19, 0x09, 0x10, 0x09, 0x09, 0x0b, 0x0a, 0x0b, 0x09, 0x0b, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x08, 0x0f, 0x1c, 0xa3, 0xa6, 0x98, 0x7f, 0x8b, 0x7f, 0x7f, 0x7f, 0x89, 0x7f, 0x81, 0x81, 0x81, 0x7e, 0x7f, 0x7f, 0x7f, 0x89, 0x7f, 0x89, 0x7f, 0x7f, 0x8c, 0x7d, 0x7d, 0x7d, 0x8b, 0x7a, 0x7a, 0x9d, 0x5d, 0x3b, 0x3b, 0x37, 0x41, 0xd0, 0x39, 0x3a, 0x3a, 0x38, 0x38, 0x50, 0x9d, 0x81, 0x8c, 0x87, 0x8c, 0x8c, 0x7d, 0x7f, 0x8d, 0x8d, 0x87, 0x87, 0x87, 0x7f, 0x87, 0x7c, 0x80, 0x7e, 0x83, 0x75, 0x80, 0x7f, 0x7f, 0x7c, 0x7f, 0x89, 0x7a, 0x92, 0xad, 0xad, 0xa9, 0xa4, 0x12, 0x08, 0x0a, 0x09, 0x0b, 0x09, 0x0c, 0x0a, 0x0c, 0x0b, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x08, 0x86, 0x99, 0x98, 0x78, 0xc3, 0xfd, 0xfd, 0xe8, 0xea, 0xf2, 0xf4, 0xf4, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xea, 0xea, 0xfc, 0xf4, 0xf4, 0xec, 0xf4, 0x32, 0xba, 0x91, 0x84, 0x7d, 0x8f, 0x1c, 0x0c, 0x10, 0x09, 0x09, 0x0b, 0x0a, 0x0a, 0x0b, 0x09, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x0c, 0x0c, 0x1c, 0x9f, 0xa3, 0x99, 0x7f, 0x8d, 0x7f, 0x7f, 0x7f, 0x7f, 0x89, 0x7d, 0x80, 0x7d, 0x8b, 0x8c, 0x7f, 0x7f, 0x7f, 0x7d, 0x8c, 0x7d, 0x8e, 0x91, 0x88, 0x88, 0x88, 0x91, 0x90, 0x7d, 0x8d, 0x82, 0x4b, 0x38, 0x3b, 0x3c, 0x39, 0x39, 0x3a, 0x38, 0x38, 0x4a, 0x68, 0x95, 0x90, 0x8e, 0x7b, 0x91, 0x88, 0x91, 0x90, 0x8c, 0x7a, 0x80, 0x7f, 0x8d, 0x7c, 0x8d, 0x8d, 0x7f, 0x7f, 0x7e, 0x7b, 0x80, 0x7f, 0x7f, 0x80, 0x7c, 0x89, 0x7a, 0x9f, 0xad, 0xad, 0xaa, 0x1f, 0x0f, 0x0c, 0x09, 0x0b, 0x09, 0x0c, 0x0c, 0x0c, 0x0a, 0x0c, 0x0b, 0x0c, 0x0b, 0x0b, 0x09, 0x09, 0x0c, 0x08, 0x8f, 0x99, 0x98, 0x88, 0xc3, 0xfd, 0xf5, 0xe9, 0xf0, 0xeb, 0xf1, 0xfc, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 
-  0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf0, 0xf2, 0xf1, 0xea, 0xea, 0xea, 0xea, 0xfc, 0xec, 0xf5, 0xe7, 0x30, 0xc3, 0x79, 0x95, 0x6f, 0x86, 0x19, 0x12, 0x09, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x09, 0x10, 0x0b, 0x10, 0x0f, 0x1c, 0xa4, 0x9f, 0x9f, 0x87, 0x8d, 0x7c, 0x89, 0x7f, 0x7f, 0x7f, 0x8d, 0x7c, 0x89, 0x7a, 0x8c, 0x7d, 0x8e, 0x78, 0x8e, 0x91, 0x88, 0x64, 0x57, 0x4f, 0x47, 0x47, 0x4b, 0x6c, 0x91, 0x87, 0x8e, 0x57, 0x38, 0x38, 0x3a, 0x3a, 0x3a, 0x3a, 0x3f, 0x4b, 0x6c, 0x8e, 0x81, 0x9c, 0x57, 0x47, 0x47, 0x4b, 0x57, 0x6c, 0x88, 0x91, 0x82, 0x83, 0x7e, 0x89, 0x8d, 0x8d, 0x87, 0x87, 0x7d, 0x87, 0x80, 0x80, 0x7c, 0x7f, 0x7f, 0x87, 0x87, 0xa8, 0xad, 0xa9, 0x1f, 0x1f, 0x0f, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0a, 0x0c, 0x0c, 0x0c, 0x0c, 0x0a, 0x0b, 0x0b, 0x0b, 0x0c, 0x08, 0x86, 0x98, 0x95, 0x88, 0x2c, 0xfc, 0xec, 0xe9, 0xec, 0xf2, 0xfc, 0xfd, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf0, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xea, 0xe8, 0xf2, 0xfc, 0xf4, 0xec, 0xf4, 0xcd, 0xc9, 0x85, 0x9c, 0x6f, 0x86, 0x8f, 0x17, 0x0c, 0x09, 0x09, 0x09, 0x0a, 0x08, 0x09, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x09, 0x10, 0x0c, 0x0f, 0x19, 0x9f, 0xa3, 0x9f, 0x92, 0x8d, 0x89, 0x7f, 0x7f, 0x7e, 0x7a, 0x8d, 0x8d, 0x7f, 0x7a, 0x77, 0x8e, 0x82, 0x88, 0x79, 0x5d, 0x4f, 0x3b, 0x38, 0x36, 0x35, 0x34, 0x36, 0x3f, 0x88, 0x8e, 0x8e, 0x6c, 0x4f, 0x43, 0x3b, 0x36, 0x38, 0x3f, 0x43, 0x64, 0x88, 0x86, 0x82, 0x79, 0x43, 0x36, 0x36, 0x38, 0x36, 0x43, 0x47, 0x5b, 0x5e, 0x91, 0x88, 0x81, 0x8c, 0x7a, 0x87, 0x7f, 0x87, 0x7f, 0x7a, 0x7e, 0x80, 0x7f, 0x8d, 0x7a, 0x92, 0xad, 0xad, 0xa9, 0xaa, 0x1a, 0x12, 0x0c, 0x09, 0x09, 0x0b, 0x0b, 0x0c, 0x0c, 0x08, 0x0b, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0f, 0x08, 0x8f, 0x9d, 0x81, 0xab, 0x2f, 0xf3, 0xe7, 0xe9, 0xe8, 0xf2, 0xf1, 0x2d, 0xeb, 0xf2, 0xf3, 0xf5, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xe8, 0xea, 0xea, 0xfc, 0xf6, 0xec, 0xee, 0x2d, 0x32, 0xb3, 0x79, 0xa5, 0x6f, 0x8f, 0x94, 0x12, 0x0c, 0x09, 0x09, 0x0a, 0x0a, 0x0b, 0x09, 0x0c, 0x0a, 0x09, 0x09, 0x09, 0x0c, 0x0c, 0x0f, 0x1c, 0x9f, 0xa1, 0xa8, 0x92, 0x87, 0x8b, 0x8c, 0x8c, 0x81, 0x7e, 0x73, 0x8b, 0x7e, 0x9c, 0x79, 0x72, 0x56, 0x4f, 0x66, 0x4b, 0x35, 0x35, 0x35, 0x35, 0xd0, 0xd0, 0x36, 0xcf, 0x79, 0x91, 0x84, 0x78, 0x88, 0x6c, 0x5a, 0x57, 0x56, 0x59, 0x64, 0x82, 0x6d, 0x8e, 0x97, 0x56, 0x37, 0x35, 0xd0, 0x39, 0x35, 0x36, 0x36, 0x36, 0x48, 0x61, 0x56, 0x64, 0x79, 0x8e, 0x90, 0x76, 0x7c, 0x7c, 0x7e, 0x83, 0x80, 0x7f, 0x7f, 0x7f, 0x99, 0xad, 0xaa, 0xa9, 0x1f, 0xa1, 0x0f, 0x0c, 0x0a, 0x09, 0x0c, 0x09, 0x08, 0x0b, 0x0a, 0x0c, 0x0c, 0x0c, 0x0a, 0x0b, 0x0b, 0x0c, 0x08, 0x08, 0x95, 0x9d, 0x6c, 0xc0, 0x30, 0xf6, 0xec, 0xed, 0xea, 0xf2, 0xf2, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf5, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf6, 0xf6, 0xcd, 0xf7, 0xee, 0xef, 0xee, 0x32, 0x2c, 0x0d, 0xa5, 0x91, 0x6f, 0x95, 0x8f, 0x0f, 0x0b, 0x09, 0x09, 0x0a, 0x09, 0x08, 0x09, 0x0c, 0x0a, 0x09, 0x09, 0x0c, 0x08, 0x8f, 0x1c, 0x99, 0x9f, 0xa6, 0x98, 0x87, 0x8c, 0x8c, 0x7b, 0x7b, 0x82, 0x91, 0x88, 0x64, 0x53, 0x47, 0x3b, 0x3f, 0x35, 0x51, 0x65, 0x34, 0x35, 0x35, 0xcf, 0xd0, 0xd6, 0xd0, 0x34, 0x66, 0x95, 0x7d, 0x84, 0x7d, 0x8e, 0x88, 0x88, 0x88, 0x82, 0x86, 0x7d, 0x6f, 0x95, 0x9c, 0x4f, 0x35, 0x39, 0xd6, 0xd0, 0x34, 0x39, 0x37, 0x3c, 0x9b, 0x40, 0x37, 0x40, 0x47, 0x4f, 0x64, 0x82, 0x83, 0x75, 0x83, 0x73, 0x77, 0x7f, 0x7a, 0x92, 0x9f, 0xad, 0xa6, 0xa8, 0xa9, 0x1a, 0x12, 0x08, 0x09, 0x0b, 0x0b, 0x0c, 0x0c, 0x0b, 0x08, 0x09, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0c, 0x08, 0x86, 0x9c, 0x78, 0xa7, 0x2f, 0xce, 0xf8, 0xef, 0xee, 0xee, 0xf7, 0xf6, 0xf6, 0xf6, 0xf3, 0xf5, 0xf3, 0xf0, 0xf1, 0xf2, 0xf1, 0xf3, 0xf5, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf1, 0xf3, 0xf5, 0xf6, 0xf7, 0xee, 0xf7, 0xf7, 0xce, 0xf7, 0xee, 0xed, 0xef, 0x31, 0x32, 0xb3, 0x6d, 0xa5, 0x7b, 0x6f, 0x86, 0x0f, 0x11, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0c, 0x0a, 0x0b, 0x0b, 0x0b, 0x0c, 0x0f, 0x17, 0x99, 0xa1, 0x9f, 0x9f, 0x9f, 0x87, 0x7d, 0x81, 0x90, 0x82, 0x82, 0x58, 0x58, 0x47, 0x36, 0x36, 0x35, 0x37, 0x37, 0x34, 0x65, 0x4d, 0xcf, 0x35, 0x39, 0xd0, 0xcf, 0x35, 0x36, 0x79, 0x95, 0x87, 0x87, 0x87, 0x7d, 0x87, 0x7d, 0x7d, 0x7d, 0x77, 0x7d, 0x7d, 0x84, 0xab, 0x56, 0x35, 0xd0, 0xd0, 0x39, 0x35, 0x39, 0x34, 0x54, 0x6e, 0xcf, 0x35, 0x39, 0x34, 0x35, 0x43, 0x58, 0x67, 0x88, 0x90, 0x90, 0x80, 0x7f, 0x7a, 0x98, 0xad, 0xad, 0x9f, 0xa9, 0xa1, 0xa1, 0x0f, 0x0c, 0x0c, 0x0a, 0x0c, 0x0c, 0x0c, 0x0a, 0x09, 0x0b, 0x0c, 0x0c, 0x0c, 0x0a, 0x0c, 0x08, 0x08, 0x86, 0x95, 0x6c, 0xc0, 0x32, 0xfe, 0xf6, 0xee, 0xff, 0xee, 0xf7, 0xee, 0xee, 0xf7, 0xf8, 0xf6, 0xf6, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf2, 0xeb, 0xf2, 0xeb, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf2, 0xeb, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf2, 0xeb, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf2, 0xeb, 0xf2, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf5, 0xf5, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x31, 0xf7, 0xee, 0xef, 0xee, 0xff, 0x31, 0x2f, 0x97, 0x97, 0x9c, 0x90, 0x6f, 0x94, 0x0f, 0x0c, 0x09, 0x0a, 0x09, 0x08, 0x09, 0x0a, 0x0b, 0x0b, 0x0c, 0x0c, 0x0f, 0x9a, 0x99, 0x9f, 0x9f, 0x9f, 0xa8, 0x90, 0x8e, 0x82, 0x64, 0x50, 0x43, 0x36, 0x41, 0x4e, 0xcf, 0x37, 0xd0, 0x35, 0xd0, 0x34, 0x46, 0x60, 0x35, 0x35, 0x35, 0x35, 0xd0, 0x36, 0x36, 0x97, 0x95, 0x87, 0x92, 0x87, 0x87, 0x87, 0x7a, 0x87, 0x87, 0x87, 0x92, 0x7d, 0x6f, 0xae, 0x64, 0x36, 0x37, 0x35, 0xd0, 0x3a, 0x35, 0x35, 0x6e, 0x49, 0x36, 0x34, 0xd0, 0xd0, 0x37, 0x34, 0x4c, 0x45, 0x43, 0x52, 0x68, 0x8e, 0x7d, 0x87, 0xad, 0xad, 0xa8, 0xa6, 0xa8, 0xa1, 0x1c, 0x0f, 0x0c, 0x08, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x08, 0x09, 0x0c, 0x0b, 0x0a, 0x08, 0x0c, 0x08, 0x86, 0x95, 0x78, 0xab, 0x33, 0xce, 0x31, 0xef, 0xf7, 0xee, 0xcd, 0xee, 0xee, 0xee, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 0xf6, 0xf6, 0xf5, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf5, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xee, 0xf7, 0xf7, 0xfe, 0x33, 0xc6, 0x66, 0x97, 0xa5, 0x84, 0x84, 0x86, 0x8f, 0x0a, 0x05, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x0b, 0x0c, 0x0f, 0x94, 0x99, 0x92, 0xa6, 0x9f, 0x9f, 0xa5, 0x9c, 0x59, 0x4b, 0x3b, 0x36, 0x37, 0x35, 0x39, 0x54, 0x34, 0x39, 0x35, 0x35, 0x35, 0x35, 0x37, 0x60, 0x40, 0x39, 0x35, 0xd0, 0x35, 0x37, 0x45, 0x9c, 0x86, 0x84, 0x77, 0x7d, 0x6f, 0x7d, 0x77, 0x7d, 0x6f, 0x7d, 0x6f, 0x7d, 0x6f, 0x22, 0x97, 0x36, 0x40, 0x35, 0x35, 0xd0, 0x35, 0x44, 0x9b, 0x35, 0x34, 0xd0, 0x35, 0x35, 0x37, 0x35, 0x4e, 0x37, 0x37, 0x3a, 0x43, 0x53, 0x64, 0x95, 0xae, 0xad, 0xad, 0xa6, 0xa6, 0xa3, 0x98, 0x94, 0x08, 0x08, 0x0b, 0x0b, 0x09, 0x0c, 0x0c, 0x0c, 0x0c, 0x09, 0x0b, 0x09, 0x08, 0x6d, 0x6d, 0x91, 0x88, 0x97, 0xc6, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xef, 0xf7, 0xf5, 0xf5, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf2, 0xeb, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf4, 0xf3, 0xf3, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xf3, 0xeb, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf5, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0x33, 0xc1, 0x70, 0x9c, 0xa5, 0x7d, 0x84, 0x0f, 0x86, 0x0f, 0x0c, 0x08, 0x0c, 0x0c, 0x11, 0x12, 0x8f, 0x94, 0x99, 0x98, 0x99, 0x9f, 0x9f, 0x9d, 0xa5, 0x24, 0x4f, 0x35, 0x36, 0x39, 0xd0, 0x37, 0x35, 0x54, 0x3c, 0x37, 0x37, 0x37, 0x37, 0x35, 0x37, 0x48, 0x4e, 0x39, 0xd0, 0xd0, 0x37, 0x34, 0x6a, 0x25, 0xae, 0xa1, 0xa1, 0xa6, 0xa1, 0xa1, 0xa1, 0x99, 0xa1, 0xa1, 0xa9, 0xa9, 0xaf, 0xb6, 0x27, 0x47, 0x3a, 0x37, 0x44, 0x34, 0x3a, 0x65, 0x60, 0xcf, 0x35, 0x37, 0x35, 0x35, 0x36, 0x37, 0x4e, 0x35, 0x35, 0x3c, 0x36, 0x36, 0x47, 0xa5, 0xae, 0xaa, 0x9f, 0xa6, 0xad, 0x9f, 0x9f, 0x94, 0x86, 0x08, 0x0c, 0x08, 0x09, 0x08, 0x0b, 0x08, 0x0c, 0x08, 0x0b, 0x08, 0x08, 0x6f, 0x9d, 0x91, 0x79, 0x2b, 0x33, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf7, 0xf5, 0xf2, 0xf0, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf1, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xff, 0x31, 0xce, 0xc0, 0x6c, 0x9c, 0xa5, 0x99, 0x84, 0x86, 0x84, 0x8f, 0x0f, 0x8f, 0x0f, 0x8f, 0x8f, 0x94, 0x94, 0x94, 0x99, 0xa6, 0xa1, 0xa4, 0x9a, 0xab, 0x2b, 0xb3, 0x34, 0x39, 0xd0, 0x39, 0x37, 0x35, 0x4e, 0x4e, 0x35, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x60, 0xd0, 0x35, 0x34, 0xd5, 0x4e, 0xba, 0x27, 0x29, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0xb7, 0xba, 0x1b, 0x37, 0x37, 0x3c, 0x35, 0x40, 0x9b, 0x45, 0x34, 0x37, 0x35, 0x35, 0x35, 0x35, 0x41, 0x4e, 0x37, 0x3a, 0xd0, 0x3c, 0x34, 0x8a, 0xc0, 0xa5, 0xa5, 0xa6, 0xa6, 0xa6, 0xa6, 0xa1, 0x99, 0x94, 0x0f, 0x08, 0x08, 0x08, 0x0a, 0x08, 0x0a, 0x6d, 0x08, 0x08, 0x0f, 0x86, 0x98, 0x91, 0x88, 0xc1, 0x32, 0xfe, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xef, 0xf8, 0xf8, 0xf7, 0xf6, 0xf5, 0xf2, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xeb, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf5, 0xf6, 0xf7, 0xf7, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xee, 0x33, 0x33, 0xc0, 0x85, 0x9c, 0xa5, 0xa6, 0xa1, 0x84, 0x94, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0x99, 0x9f, 0x9f, 0x9f, 0xa4, 0x9a, 0x9c, 0x2b, 0x30, 0x30, 0x93, 0xd5, 0xd0, 0xd0, 0x37, 0x35, 0x46, 0x65, 0x35, 0x36, 0x37, 0x37, 0x37, 0x37, 0x38, 0x49, 0x46, 0xcf, 0xcf, 0x93, 0xc6, 0xc3, 0x27, 0x27, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0xb6, 0x25, 0xb6, 0xba, 0x25, 0xbb, 0xc0, 0xac, 0x35, 0xd5, 0x34, 0x48, 0x9b, 0x34, 0x37, 0x37, 0x35, 0x35, 0x36, 0x34, 0x49, 0x46, 0x3a, 0x37, 0xd0, 0xd5, 0x54, 0xcb, 0x2f, 0x2a, 0xb7, 0x9d, 0xa6, 0xa6, 0xa9, 0xa6, 0x99, 0xa1, 0x84, 0x86, 0x6d, 0x08, 0x08, 0x08, 0x08, 0x6d, 0x6d, 0x86, 0x95, 0x9d, 0x95, 0x82, 0xc0, 0x33, 0xf7, 0xee, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 0xf7, 0xef, 0xf8, 0xf7, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xeb, 0xf1, 0xf2, 0xf1, 0xf3, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf4, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xeb, 0xf1, 0xf2, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xeb, 0xf0, 0xf2, 0xf2, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 0xf7, 0xf6, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xee, 0xff, 0x31, 0x33, 0xc6, 0xab, 0x97, 0xa5, 0xa4, 0xaa, 0x9f, 0xa1, 0x99, 0x99, 0x9f, 0x9f, 0x9f, 0x9f, 0xa4, 0xa3, 0x9a, 0x9a, 0xba, 0x2c, 0x32, 0xce, 0xff, 0xee, 0x93, 0xcf, 0xcf, 0x40, 0x37, 0x3d, 0x6e, 0x3a, 0x37, 0x37, 0x35, 0x3a, 0x37, 0x37, 0x46, 0x4d, 0x54, 0xd2, 0xfb, 0x33, 0x32, 0x2f, 0x2c, 0x2b, 0x2b, 0xc3, 0x2b, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0x2b, 0x2b, 0x2c, 0x2f, 0x2f, 0x32, 0x33, 0xc2, 0x93, 0x4d, 0x60, 0x6e, 0xcf, 0x35, 0x35, 0x35, 0x37, 0x35, 0x35, 0x54, 0x3a, 0x35, 0x34, 0xd0, 0x65, 0xc7, 0x32, 0x30, 0x32, 0x2c, 0x27, 0x21, 0x9d, 0xa4, 0xa6, 0xa1, 0x99, 0x99, 0x95, 0x92, 0x86, 0x84, 0x0f, 0x86, 0x95, 0x90, 0x9c, 0x97, 0x91, 0xa0, 0x2b, 0x32, 0x31, 0xee, 0xef, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xf7, 0xf6, 0xf8, 0xf6, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-  0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xeb, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xeb, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xeb, 0xf4, 0xf3, 0xf4, 0xf4, 0xf3, 0xf4, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf2, 0xf3, 0xf5, 0xf6, 0xf8, 0xf8, 0xf6, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xef, 0xf7, 0xf7, 0xff, 0x32, 0x2f, 0xbe, 0x1b, 0x97, 0xa5, 0xa4, 0xa4, 0xa4, 0xa3, 0xa3, 0x9f, 0xa3, 0xa3, 0x9a, 0x94, 0x21, 0xc0, 0x2f, 0x32, 0x31, 0xf7, 0xee, 0xf9, 0xf9, 0xb1, 0x39, 0xd5, 0x35, 0x37, 0x6e, 0x60, 0x37, 0x3a, 0x35, 0x37, 0x34, 0xd5, 0x49, 0xbd, 0xff, 0xfb, 0xef, 0xf7, 0x31, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x30, 0x32, 0x31, 0xfe, 0xfb, 0xfa, 0xd3, 0xc7, 0xb8, 0x44, 0xd5, 0xd5, 0x34, 0xcf, 0x34, 0x44, 0x44, 0xd5, 0x35, 0x54, 0xbd, 0xf6, 0xfb, 0xf7, 0xff, 0x31, 0x32, 0x2f, 0x2b, 0x24, 0x97, 0x1c, 0x9d, 0x9d, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x9d, 0x95, 0x88, 0x79, 0xb3, 0xc9, 0x32, 0xce, 0xfe, 0xee, 0xef, 0xf7, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf8, 0xf6, 0xf7, 0xf8, 0xf6, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xff, 0x32, 0x30, 0xc0, 0xb3, 0x9c, 0xa5, 0x9c, 0xa5, 0x9c, 0x9c, 0x9c, 0x9c, 0x24, 0x2a, 0x2c, 0x32, 0x33, 0xcd, 0xef, 0xf6, 0xef, 0xf8, 0xfe, 0xfa, 0xc8, 0x9b, 0x4e, 0x39, 0x4e, 0x93, 0x4d, 0x46, 0xd0, 0x37, 0x54, 0x93, 0x2e, 0xfb, 0xfe, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf7, 0xf8, 0xf8, 0xee, 0xef, 0xef, 0xfb, 0xfb, 0xd3, 0xb1, 0x60, 0x4d, 0x49, 0x4d, 0x93, 0xac, 0xbd, 0xc7, 0x33, 0xfb, 0xf9, 0xf6, 0xef, 0xf7, 0xee, 0xf7, 0x33, 0x33, 0x30, 0xc6, 0x27, 0xab, 0x97, 0x97, 0x91, 0x91, 0x95, 0x95, 0x95, 0x8e, 0x94, 0x91, 0xba, 0xc5, 0x33, 0xf9, 0xfe, 0xfe, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf6, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xfe, 0xf8, 0xee, 0xf8, 0xee, 0xf8, 0xff, 0x33, 0x32, 0x30, 0x2c, 0xc0, 0x27, 0xba, 0x27, 0x27, 0xc0, 0x2c, 0x2f, 0x30, 0x32, 0xff, 0xd4, 0xef, 0xee, 0xee, 0xee, 0xf8, 0xfe, 0xfd, 0x33, 0xfa, 0xca, 0xc7, 0xc4, 0xc7, 0xc2, 0xc2, 0xc2, 0xc2, 0xca, 0x33, 0xf9, 0xfe, 0xfe, 0xf7, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf7, 0xf8, 0xf8, 0xf8, 0xee, 0xef, 0xf8, 0xee, 0xee, 0xee, 0xfa, 0xfa, 0xff, 0xd4, 0xf0, 0xd4, 0xf8, 0xff, 0x33, 0xfb, 0xf9, 0x2e, 0xf7, 0xff, 0xee, 0xef, 0xef, 0xee, 0xf7, 0xfe, 0xff, 0x32, 0x2f, 0x2c, 0xc3, 0xba, 0xab, 0xa0, 0x97, 0x97, 0xa0, 0x24, 0x27, 0x2c, 0x30, 0xff, 0xf8, 0xee, 0xef, 0xf7, 0xfe, 0xf8, 0xfe, 0xf8, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf6, 0xf5, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xee, 0xef, 0xf8, 0xf7, 0xf7, 0xf8, 0xfe, 0x33, 0x33, 0x33, 0x33, 0x32, 0x33, 0x32, 0x32, 0x31, 0x31, 0xf8, 0xf8, 0xef, 0xee, 0xf8, 0xee, 0xef, 0xf8, 0xf6, 0xfa, 0xf6, 0xf8, 0xf9, 0xef, 0xef, 0xfa, 0xfa, 0xfb, 0xfa, 0xfb, 0xf8, 0xef, 0xef, 0xf7, 0xf7, 0xf8, 0xf6, 0xee, 0xf7, 0xf8, 0xf8, 0xf7, 0xfe, 0xf7, 0xfe, 0xf7, 0xfe, 0xf7, 0xfe, 0xf7, 0xfe, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0xf7, 0xf7, 0xff, 0xef, 0xf6, 0xf8, 0xef, 0xf8, 0xef, 0xff, 0xf8, 0xf7, 0xf9, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xef, 0xf7, 0xee, 0xf8, 0xef, 0xf7, 0xf8, 0xf7, 0x31, 0xff, 0x33, 0x32, 0x32, 0x32, 0x2f, 0xcb, 0x2f, 0x30, 0x32, 0x32, 0x32, 0xcd, 0xff, 0xee, 0xee, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf5, 0xf2, 0xf1, 0xf3, 0xf2, 0xeb, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xeb, 0xf4, 0xf4, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xeb, 0xf4, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xeb, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xeb, 0xf5, 0xf2, 0xf3, 0xf6, 0xf5, 0xf6, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xff, 0xf9, 0xee, 0xee, 0xee, 0xf8, 0xf9, 0xfe, 0xee, 0xf8, 0xee, 0xee, 0xee, 0xee, 0xf7, 0xf7, 0xf7, 0xef, 0xf6, 0xef, 0xef, 0xee, 0xee, 0xee, 0xf6, 0xef, 0xf6, 0xfa, 0xee, 0xf8, 0xee, 0xef, 0xf6, 0xee, 0xf6, 0xef, 0xf7, 0xf7, 0xff, 0xfe, 0xfe, 0x31, 0xfe, 0xfe, 0xee, 0xf8, 0xee, 0xf8, 0xee, 0xf8, 0xee, 0xf8, 0xee, 0xf8, 0xee, 0xf8, 0xf7, 0xfe, 0xfe, 0x31, 0x31, 0xf8, 0xfe, 0xf7, 0xef, 0xf8, 0xee, 0xf8, 0xef, 0xee, 0xf7, 0xf7, 0xf8, 0xfe, 0xf8, 0xef, 0xf7, 0xf6, 0xf8, 0xf8, 0xf7, 0xf8, 0xff, 0xfe, 0x31, 0xf7, 0xef, 0xef, 0xf8, 0xfe, 0xfe, 0xf9, 0x33, 0xf9, 0xfe, 0xf8, 0xf8, 0xef, 0xef, 0xef, 0xee, 0xff, 0xfe, 0xfe, 0xf8, 0xee, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf6, 0xf5, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf4, 0xf1, 0xf3, 0xf1, 0xf4, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xeb, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xeb, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf2, 0xf3, 0xf5, 0xf5, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xef, 0xee, 0xef, 0xf7, 0xee, 0xf7, 0xf8, 0xee, 0xef, 0xee, 0xef, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xee, 0xee, 0xef, 0xee, 0xf7, 0xf7, 0xf8, 0xee, 0xf7, 0xf7, 0xee, 0xf7, 0xf8, 0xf7, 0xef, 0xee, 0xee, 0xf7, 0xf7, 0xf7, 0xf7, 0xfe, 0xfe, 0xfe, 0xfe, 0xee, 0xf8, 0xee, 0xf8, 0xee, 0xf8, 0xee, 0xf8, 0xee, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xfe, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xee, 0xf6, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0xf8, 0xfe, 0xf8, 0xf8, 0xf7, 0xf7, 0xf8, 0xef, 0xf8, 0xf7, 0xf8, 0xf8, 0xef, 0xf7, 0xef, 0xf8, 0xf8, 0xee, 0xf8, 0xf8, 0xfe, 0xf8, 0xf7, 0xef, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf6, 0xf6, 0xf6, 0xf3, 0xf5, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xeb, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xeb, 0xf4, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf5, 0xd4, 0xf6, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf9, 0xf8, 0xfe, 0xf7, 0xf7, 0xf6, 0xf4, 0xf5, 0xf4, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xeb, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf5, 0xf0, 0xf2, 0xf3, 0xd4, 0xf5, 0xf6, 0xf6, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xef, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xef, 0xf7, 0xef, 0xf7, 0xf8, 0xf6, 0xf6, 0xf6, 0xf4, 0xf4, 0xf1, 0xf4, 0xf4, 0xf4, 0xf5, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xeb, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xeb, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xeb, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf5, 0xf5, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf8, 0xf7, 0xef, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xef, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf5, 0xf3, 0xf3, 0xf4, 0xf1, 0xf3, 0xf1, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf3, 0xeb, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf0, 0xf0, 0xf2, 0xf2, 0xf0, 0xf2, 0xf2, 0xea, 0xf3, 0xf3, 0xf0, 0xf1, 0xf0, 0xf0, 0xf5, 0xf5, 0xf5, 0xf7, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xef, 0xf8, 0xf8, 0xf7, 0xf7, 0xf6, 0xf7, 0xf6, 0xf6, 0xf6, 0xf5, 0xf2, 0xf3, 0xf1, 0xf2, 0xf2, 0xf1, 0xf2, 0xf2, 0xfc, 0xf5, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0xf2, 0xea, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf5, 0xf3, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf5, 0xf2, 0xf6, 0xf5, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xef, 0xf8, 0xf8, 0xf8, 0xef, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xf2, 0xf2, 0xf3, 0xf0, 0xf2, 0xf3, 0xf2, 0xf3, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xfc, 0xf5, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf0, 0xf3, 0xf2, 0xf5, 0xf5, 0xf5, 0xf5, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xef, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 
-  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf0, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf5, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf6, 0xf7, 0xf6, 0xf6, 0xf5, 0xf6, 0xf5, 0xf6, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf5, 0xf5, 0xf3, 0xf3, 0xeb, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf1, 0xf1, 0xf1, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf5, 0xf3, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf7, 0xf6, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf5, 0xf1, 0xf2, 0xf1, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf4, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xeb, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf1, 0xf2, 0xf1, 0xf5, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xeb, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xeb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 
-  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0xf2, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf1, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf2, 0xf1, 0xf2, 0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 
-  0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xd4, 0xf6, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf2, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf2, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf1, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 0xf2, 0xf3, 
-};
-
-const lv_img_dsc_t image9 = {
-  .header.cf = LV_IMG_CF_INDEXED_8BIT,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 320,
-  .header.h = 210,
-  .data_size = 68224,
-  .data = image9_map,
-};
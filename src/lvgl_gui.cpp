@@ -12,21 +12,49 @@
 #include <Arduino.h>
 #include <M5Unified.h>
 #include <lvgl.h>
+#include <atomic>
 #include "app_config.hpp"
+#include "audio_spectrum.hpp"
+#include "image_lz.hpp"
+#include "smile_images.hpp"
+#include "smile_transition.hpp"
 #include "lvgl_gui.hpp"
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
-
+#define SPECTRUM_WIDTH 160
+#define SPECTRUM_HEIGHT 120
+#define SPECTRUM_BAR_WIDTH 8
+#define SPECTRUM_BAR_FALL 6          /* Pixels a bar drops per frame */
+#define SPECTRUM_BUDGET_MS 1000      /* Load is measured and the period adjusted this often */
+#define SPECTRUM_LOG_MS 10000
+#define DISPLAY_LOG_MS 10000
+#define DISPLAY_BUF_PIXELS (LV_HOR_RES_MAX * LVGL_DRAW_BUF_LINES)
 
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
 /******************************************************************************/
 
 static lv_disp_draw_buf_t draw_buf;
-static lv_color_t buf[LV_HOR_RES_MAX * LV_VER_RES_MAX / 10];
+static lv_color_t buf[1 + LVGL_DRAW_BUF_DOUBLE][DISPLAY_BUF_PIXELS] __attribute__((aligned(4)));    /* Internal RAM, DMA capable */
+
+/* Strip handed to the flush task, until it calls lv_disp_flush_ready() */
+static TaskHandle_t lvgl_task_handle = NULL;
+static TaskHandle_t flush_task_handle = NULL;
+static lv_disp_drv_t *flush_disp = NULL;
+static lv_area_t flush_area;
+static lv_color_t *flush_colors = NULL;
+
+/* Display statistics, logged every DISPLAY_LOG_MS */
+static uint32_t display_frames = 0;
+static uint32_t display_frame_ms = 0;       /* Refresh time, rendering and waits for flushes */
+static uint32_t display_pixels = 0;
+static uint32_t display_flushes = 0;
+static uint32_t display_flush_us = 0;       /* Bus taken to bus given back */
+static uint32_t display_wait_us = 0;        /* GUI task blocked on a flush */
+static uint32_t display_log_ms = 0;
 
 static lv_obj_t *ui_bar_bat;
 static lv_obj_t *ui_label_bat;
@@ -38,13 +66,34 @@ static lv_obj_t *ui_label_menu;
 static lv_obj_t *ui_music_screen;
 static lv_obj_t *ui_image_play_music;
 static lv_obj_t *ui_label_song;
+static lv_obj_t *ui_label_speed;
+static lv_obj_t *ui_image_radio;
+static lv_obj_t *ui_spectrum;
+static lv_obj_t *ui_spectrum_bars[SPECTRUM_BARS];
+
+/* Spectrum, shown on the music screen while playing. Other tasks set the
+ * screen and play state, the GUI task shows or hides it. */
+static lv_timer_t *spectrum_timer;
+static lv_timer_t *spectrum_state_timer;
+static std::atomic<bool> spectrum_screen(false);
+static std::atomic<bool> spectrum_playing(false);
+static bool spectrum_visible = false;
+static uint8_t spectrum_heights[SPECTRUM_BARS];
+static uint32_t spectrum_busy_us = 0;
+static uint32_t spectrum_frames = 0;
+static uint32_t spectrum_window_ms = 0;
+static uint32_t spectrum_log_ms = 0;
 
 static lv_obj_t *ui_smile_screen;
 static lv_obj_t *ui_image_smile;
 
-static const lv_img_dsc_t *image_src_list[32];
-static int smile_image_max = 0;
-static int smile_index = 0;
+/* Slideshow, images are switched by the GUI task once they are in RAM */
+static lv_timer_t *smile_timer;
+static uint32_t smile_index = 0;
+static bool smile_active = false;          /* Images are in RAM */
+static std::atomic<int32_t> smile_pending(-1);
+static std::atomic<bool> smile_forward(true);
+static std::atomic<bool> smile_release(false);    /* Images to free on the GUI task */
 
 /******************************************************************************/
 /*                              EXPORTED DATA                                 */
@@ -59,40 +108,25 @@ extern const lv_img_dsc_t ui_img_pause_button_png;
 extern const lv_img_dsc_t ui_img_play_button_png;
 extern const lv_img_dsc_t ui_img_image_radio_png;
 
-/* Image list */
-extern const lv_img_dsc_t image1;
-extern const lv_img_dsc_t image2;
-extern const lv_img_dsc_t image3;
-extern const lv_img_dsc_t image4;
-extern const lv_img_dsc_t image5;
-extern const lv_img_dsc_t image6;
-extern const lv_img_dsc_t image7;
-extern const lv_img_dsc_t image8;
-extern const lv_img_dsc_t image9;
-extern const lv_img_dsc_t image10;
-extern const lv_img_dsc_t image11;
-extern const lv_img_dsc_t image12;
-extern const lv_img_dsc_t image13;
-extern const lv_img_dsc_t image14;
-extern const lv_img_dsc_t image15;
-extern const lv_img_dsc_t image16;
-extern const lv_img_dsc_t image17;
-extern const lv_img_dsc_t image18;
-extern const lv_img_dsc_t image19;
-extern const lv_img_dsc_t image20;
-extern const lv_img_dsc_t image21;
-
 /******************************************************************************/
 /*                                FUNCTIONS                                   */
 /******************************************************************************/
 
 static void lvgl_task(void *arg);
 static void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p);
+static void my_disp_wait(lv_disp_drv_t *disp);
+static void my_disp_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px);
+static void lvgl_flush_task(void *arg);
 static void lv_tick_inc_cb(void *data);
 static void lvgl_tick_init(void);
 
 static void lvgl_top_header_init(void);
 static void lvgl_ui_init(void);
+static void lvgl_spectrum_init(lv_obj_t *parent);
+static void lvgl_spectrum_cb(lv_timer_t *timer);
+static void lvgl_spectrum_update(lv_timer_t *timer);
+static void lvgl_show_smile(uint32_t index, bool forward);
+static void lvgl_smile_cb(lv_timer_t *timer);
 
 /******************************************************************************/
 
@@ -100,7 +134,9 @@ static void lvgl_ui_init(void);
  * @brief  Task for update lvgl
  */
 static void lvgl_task(void *arg) {
-    lv_disp_draw_buf_init(&draw_buf, buf, NULL, LV_HOR_RES_MAX * LV_VER_RES_MAX / 10);
+    lvgl_task_handle = xTaskGetCurrentTaskHandle();
+    xTaskCreatePinnedToCore(lvgl_flush_task, "FLUSH", 2048, NULL, LVGL_FLUSH_PRIORITY, &flush_task_handle, 1);
+    lv_disp_draw_buf_init(&draw_buf, buf[0], LVGL_DRAW_BUF_DOUBLE ? buf[LVGL_DRAW_BUF_DOUBLE] : NULL, DISPLAY_BUF_PIXELS);
 
     /* Initialize the display */
     lv_disp_drv_t disp_drv;
@@ -108,6 +144,8 @@ static void lvgl_task(void *arg) {
     disp_drv.hor_res = LV_HOR_RES_MAX;
     disp_drv.ver_res = LV_VER_RES_MAX;
     disp_drv.flush_cb = my_disp_flush;
+    disp_drv.wait_cb = my_disp_wait;
+    disp_drv.monitor_cb = my_disp_monitor;
     disp_drv.draw_buf = &draw_buf;
     lv_disp_drv_register(&disp_drv);
 
@@ -117,29 +155,113 @@ static void lvgl_task(void *arg) {
     indev_drv.type = LV_INDEV_TYPE_NONE;
     lv_indev_drv_register(&indev_drv);
 
-    /* Create UI */
+    /* Create UI, the slideshow images are compressed */
+    image_lz_init();
     lvgl_ui_init();
     lvgl_top_header_init();    /* Should be called last */
 
     while (1) {
+        uint32_t start = micros();
         lv_task_handler();    /* Let the GUI do its work */
+        if (spectrum_visible) {
+            spectrum_busy_us += micros() - start;
+        }
         delay(LVGL_TICK_HANDLER);
     }
 }
 
 /**
- * @brief  Display flushing
+ * @brief  The panel takes the high byte first, swap in place so the DMA reads the buffer as is
+ */
+static void my_disp_swap(lv_color_t *color_p, uint32_t count) {
+    uint32_t *pairs = (uint32_t *) color_p;
+
+    for (uint32_t i = 0; i < count / 2; i++) {
+        pairs[i] = ((pairs[i] & 0x00FF00FF) << 8) | ((pairs[i] >> 8) & 0x00FF00FF);
+    }
+    if (count & 1) {
+        color_p[count - 1].full = __builtin_bswap16(color_p[count - 1].full);
+    }
+}
+
+/**
+ * @brief  Display flushing, the strip is sent by the flush task while the next one is rendered
  */
 static void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
-    int32_t w = (area->x2 - area->x1 + 1);
-    int32_t h = (area->y2 - area->y1 + 1);
+    flush_area = *area;
+    flush_colors = color_p;
+    flush_disp = disp;
+    xTaskNotifyGive(flush_task_handle);
+}
+
+/**
+ * @brief  Called while LVGL needs the buffer being flushed, sleeps until the flush task is done
+ */
+static void my_disp_wait(lv_disp_drv_t *disp) {
+    uint32_t start = micros();
+    ulTaskNotifyTake(pdTRUE, 1);
+    display_wait_us += micros() - start;
+}
+
+/**
+ * @brief  Count the time of every refresh and log the display throughput
+ */
+static void my_disp_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px) {
+    display_frames++;
+    display_frame_ms += time;
+    display_pixels += px;
+
+    uint32_t now = lv_tick_get();
+    if (now - display_log_ms < DISPLAY_LOG_MS) {
+        return;
+    }
 
-    M5.Lcd.startWrite();
-    M5.Lcd.setAddrWindow(area->x1, area->y1, w, h);
-    M5.Lcd.pushPixels((uint16_t *) &color_p->full, (int32_t) (w * h), true);
-    M5.Lcd.endWrite();
+    if (display_flushes > 0) {
+        Serial.printf("Display: %u frames, %u ms per frame, %u kpx/s, flush %u us, waited %u us per frame\r\n",
+                      display_frames, display_frame_ms / display_frames,
+                      display_frame_ms ? display_pixels / display_frame_ms : 0,
+                      display_flush_us / display_flushes, display_wait_us / display_frames);
+    }
 
-    lv_disp_flush_ready(disp);
+    display_log_ms = now;
+    display_frames = 0;
+    display_frame_ms = 0;
+    display_pixels = 0;
+    display_flushes = 0;
+    display_flush_us = 0;
+    display_wait_us = 0;
+}
+
+/**
+ * @brief  Send each strip by DMA, the SPI bus is taken for the transfer only
+ *         and given back to the SD card as soon as it is done
+ */
+static void lvgl_flush_task(void *arg) {
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        lv_disp_drv_t *disp = flush_disp;
+        if (disp == NULL) {
+            continue;
+        }
+
+        int32_t w = (flush_area.x2 - flush_area.x1 + 1);
+        int32_t h = (flush_area.y2 - flush_area.y1 + 1);
+        my_disp_swap(flush_colors, w * h);
+
+        uint32_t start = micros();
+        M5.Lcd.startWrite();
+        M5.Lcd.pushImageDMA(flush_area.x1, flush_area.y1, w, h, (const lgfx::swap565_t *) flush_colors);
+        while (M5.Lcd.dmaBusy()) {
+            vTaskDelay(1);    /* M5GFX has no completion callback, rendering goes on meanwhile */
+        }
+        M5.Lcd.endWrite();
+        display_flush_us += micros() - start;
+        display_flushes++;
+
+        flush_disp = NULL;
+        lv_disp_flush_ready(disp);
+        xTaskNotifyGive(lvgl_task_handle);
+    }
 }
 
 /**
@@ -250,15 +372,17 @@ static void lvgl_ui_init(void) {
     lv_obj_set_style_bg_opa(ui_music_screen, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_music_screen, LV_OBJ_FLAG_HIDDEN);
 
-    image = lv_img_create(ui_music_screen);
-    lv_img_set_src(image, &ui_img_image_radio_png);
-    lv_obj_set_width(image, LV_SIZE_CONTENT);
-    lv_obj_set_height(image, LV_SIZE_CONTENT);
-    lv_obj_set_x(image, 0);
-    lv_obj_set_y(image, 74);
-    lv_obj_set_align(image, LV_ALIGN_TOP_MID);
-    lv_obj_add_flag(image, LV_OBJ_FLAG_ADV_HITTEST);
-    lv_obj_clear_flag(image, LV_OBJ_FLAG_SCROLLABLE);
+    ui_image_radio = lv_img_create(ui_music_screen);
+    lv_img_set_src(ui_image_radio, &ui_img_image_radio_png);
+    lv_obj_set_width(ui_image_radio, LV_SIZE_CONTENT);
+    lv_obj_set_height(ui_image_radio, LV_SIZE_CONTENT);
+    lv_obj_set_x(ui_image_radio, 0);
+    lv_obj_set_y(ui_image_radio, 74);
+    lv_obj_set_align(ui_image_radio, LV_ALIGN_TOP_MID);
+    lv_obj_add_flag(ui_image_radio, LV_OBJ_FLAG_ADV_HITTEST);
+    lv_obj_clear_flag(ui_image_radio, LV_OBJ_FLAG_SCROLLABLE);
+
+    lvgl_spectrum_init(ui_music_screen);
 
     image = lv_img_create(ui_music_screen);
     lv_img_set_src(image, &ui_img_left_arrow_png);
@@ -297,6 +421,17 @@ static void lvgl_ui_init(void) {
     lv_obj_add_flag(ui_image_play_music, LV_OBJ_FLAG_ADV_HITTEST);
     lv_obj_clear_flag(ui_image_play_music, LV_OBJ_FLAG_SCROLLABLE);
 
+    ui_label_speed = lv_label_create(ui_music_screen);
+    lv_obj_set_width(ui_label_speed, LV_SIZE_CONTENT);
+    lv_obj_set_height(ui_label_speed, LV_SIZE_CONTENT);
+    lv_obj_set_x(ui_label_speed, 60);
+    lv_obj_set_y(ui_label_speed, 38);
+    lv_obj_set_align(ui_label_speed, LV_ALIGN_TOP_MID);
+    lv_label_set_text(ui_label_speed, "");
+    lv_obj_set_style_text_color(ui_label_speed, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_opa(ui_label_speed, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_flag(ui_label_speed, LV_OBJ_FLAG_HIDDEN);
+
     /* Smiles screen */
     ui_smile_screen = lv_obj_create(main_scr);
     lv_obj_remove_style_all(ui_smile_screen);
@@ -309,37 +444,172 @@ static void lvgl_ui_init(void) {
     lv_obj_set_style_bg_opa(ui_smile_screen, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_smile_screen, LV_OBJ_FLAG_HIDDEN);
 
-    ui_image_smile = lv_img_create(ui_smile_screen);
-    lv_obj_set_width(ui_image_smile, LV_SIZE_CONTENT);
-    lv_obj_set_height(ui_image_smile, LV_SIZE_CONTENT);
-    lv_obj_set_align(ui_image_smile, LV_ALIGN_BOTTOM_MID);
-    lv_obj_add_flag(ui_image_smile, LV_OBJ_FLAG_ADV_HITTEST);
-    lv_obj_clear_flag(ui_image_smile, LV_OBJ_FLAG_SCROLLABLE);
-
-    smile_index = 0;
-    smile_image_max = 0;
-    image_src_list[smile_image_max++] = &image1;
-    image_src_list[smile_image_max++] = &image2;
-    image_src_list[smile_image_max++] = &image3;
-    image_src_list[smile_image_max++] = &image4;
-    image_src_list[smile_image_max++] = &image5;
-    image_src_list[smile_image_max++] = &image6;
-    image_src_list[smile_image_max++] = &image7;
-    image_src_list[smile_image_max++] = &image8;
-    image_src_list[smile_image_max++] = &image9;
-    image_src_list[smile_image_max++] = &image10;
-    image_src_list[smile_image_max++] = &image11;
-    image_src_list[smile_image_max++] = &image12;
-    image_src_list[smile_image_max++] = &image13;
-    image_src_list[smile_image_max++] = &image14;
-    image_src_list[smile_image_max++] = &image15;
-    image_src_list[smile_image_max++] = &image16;
-    image_src_list[smile_image_max++] = &image17;
-    image_src_list[smile_image_max++] = &image18;
-    image_src_list[smile_image_max++] = &image19;
-    image_src_list[smile_image_max++] = &image20;
-    image_src_list[smile_image_max++] = &image21;
-    lv_img_set_src(ui_image_smile, image_src_list[0]);
+    ui_image_smile = smile_transition_create(ui_smile_screen);
+    smile_timer = lv_timer_create(lvgl_smile_cb, LVGL_TICK_HANDLER, NULL);
+
+}
+
+/**
+ * @brief  Create the spectrum bars in place of the radio image
+ */
+static void lvgl_spectrum_init(lv_obj_t *parent) {
+    ui_spectrum = lv_obj_create(parent);
+    lv_obj_remove_style_all(ui_spectrum);
+    lv_obj_set_width(ui_spectrum, SPECTRUM_WIDTH);
+    lv_obj_set_height(ui_spectrum, SPECTRUM_HEIGHT);
+    lv_obj_set_x(ui_spectrum, 0);
+    lv_obj_set_y(ui_spectrum, 74);
+    lv_obj_set_align(ui_spectrum, LV_ALIGN_TOP_MID);
+    lv_obj_clear_flag(ui_spectrum, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(ui_spectrum, LV_OBJ_FLAG_HIDDEN);
+
+    for (int i = 0; i < SPECTRUM_BARS; i++) {
+        lv_obj_t *bar = lv_obj_create(ui_spectrum);
+        lv_obj_remove_style_all(bar);
+        lv_obj_set_width(bar, SPECTRUM_BAR_WIDTH);
+        lv_obj_set_height(bar, 0);
+        lv_obj_set_x(bar, i * SPECTRUM_WIDTH / SPECTRUM_BARS);
+        lv_obj_set_align(bar, LV_ALIGN_BOTTOM_LEFT);
+        lv_obj_clear_flag(bar, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_set_style_bg_color(bar, lv_color_hex(0x72E086), LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_bg_opa(bar, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+        ui_spectrum_bars[i] = bar;
+        spectrum_heights[i] = 0;
+    }
+
+    spectrum_timer = lv_timer_create(lvgl_spectrum_cb, LVGL_SPECTRUM_PERIOD_MS, NULL);
+    lv_timer_pause(spectrum_timer);
+    spectrum_state_timer = lv_timer_create(lvgl_spectrum_update, LVGL_TICK_HANDLER, NULL);
+}
+
+/**
+ * @brief  Redraw the bars that changed, and keep the cost within budget
+ */
+static void lvgl_spectrum_cb(lv_timer_t *timer) {
+    uint8_t levels[SPECTRUM_BARS];
+    bool fresh = audio_spectrum_compute(levels);
+
+    /* Bars jump up and fall slowly, with no new samples they all fall */
+    for (int i = 0; i < SPECTRUM_BARS; i++) {
+        int32_t target = fresh ? levels[i] * SPECTRUM_HEIGHT / SPECTRUM_LEVEL_MAX : 0;
+        int32_t height = spectrum_heights[i];
+
+        if (target < height - SPECTRUM_BAR_FALL) {
+            target = height - SPECTRUM_BAR_FALL;
+        }
+        if (target != height) {
+            lv_obj_set_height(ui_spectrum_bars[i], target);
+            spectrum_heights[i] = target;
+        }
+    }
+    spectrum_frames++;
+
+    uint32_t now = lv_tick_get();
+    uint32_t elapsed = now - spectrum_window_ms;
+    if (elapsed < SPECTRUM_BUDGET_MS) {
+        return;
+    }
+
+    /* Share of the GUI core spent while the spectrum is shown, drawing included */
+    uint32_t load = spectrum_busy_us / (elapsed * 10);
+    uint32_t period = timer->period;
+    if ((load > LVGL_SPECTRUM_BUDGET) && (period < LVGL_SPECTRUM_MAX_PERIOD_MS)) {
+        period = (period * 2 < LVGL_SPECTRUM_MAX_PERIOD_MS) ? period * 2 : LVGL_SPECTRUM_MAX_PERIOD_MS;
+    }
+    else if ((load < LVGL_SPECTRUM_BUDGET / 2) && (period > LVGL_SPECTRUM_PERIOD_MS)) {
+        period = (period / 2 > LVGL_SPECTRUM_PERIOD_MS) ? period / 2 : LVGL_SPECTRUM_PERIOD_MS;
+    }
+    lv_timer_set_period(timer, period);
+
+    if (now - spectrum_log_ms >= SPECTRUM_LOG_MS) {
+        uint32_t fft_us, bins_us;
+        audio_spectrum_cost(&fft_us, &bins_us);
+        Serial.printf("Spectrum: %u fps, %u%% of the GUI core, FFT %u us, bands %u us\r\n",
+                      spectrum_frames * 1000 / elapsed, load, fft_us, bins_us);
+        spectrum_log_ms = now;
+    }
+
+    spectrum_window_ms = now;
+    spectrum_busy_us = 0;
+    spectrum_frames = 0;
+}
+
+/**
+ * @brief  Show the spectrum or the radio image, the tap only runs while shown.
+ *         Polled on the GUI task, as the state is set from the loop task.
+ */
+static void lvgl_spectrum_update(lv_timer_t *timer) {
+    bool visible = spectrum_screen.load() && spectrum_playing.load();
+
+    if (visible == spectrum_visible) {
+        return;
+    }
+    spectrum_visible = visible;
+    audio_spectrum_enable(visible);
+
+    if (visible) {
+        for (int i = 0; i < SPECTRUM_BARS; i++) {
+            lv_obj_set_height(ui_spectrum_bars[i], 0);
+            spectrum_heights[i] = 0;
+        }
+        spectrum_window_ms = lv_tick_get();
+        spectrum_log_ms = spectrum_window_ms;
+        spectrum_busy_us = 0;
+        spectrum_frames = 0;
+        lv_obj_add_flag(ui_image_radio, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(ui_spectrum, LV_OBJ_FLAG_HIDDEN);
+        lv_timer_resume(spectrum_timer);
+    }
+    else {
+        lv_timer_pause(spectrum_timer);
+        lv_obj_add_flag(ui_spectrum, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(ui_image_radio, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/**
+ * @brief  Ask for a slideshow image, the last one stays on screen until it is read
+ */
+static void lvgl_show_smile(uint32_t index, bool forward) {
+    if (index < smile_images_count()) {
+        smile_images_request(index);
+        smile_forward.store(forward);
+        smile_pending.store(index);
+    }
+}
+
+/**
+ * @brief  Switch to the requested slideshow image once it is in RAM, and free
+ *         the images after leaving the slideshow. Both run on the GUI task so
+ *         they never land in the middle of a refresh.
+ */
+static void lvgl_smile_cb(lv_timer_t *timer) {
+    bool released = smile_release.exchange(false);
+    if (released) {
+        smile_transition_clear();
+        smile_images_release();
+    }
+
+    /* The image before the one shown can go once the transition is over */
+    if (!smile_transition_running()) {
+        smile_images_settle();
+    }
+
+    int32_t index = smile_pending.load();
+    if (index < 0) {
+        return;
+    }
+
+    /* Back in the slideshow before the release, which dropped the request */
+    if (released) {
+        smile_images_request(index);
+    }
+
+    const lv_img_dsc_t *image = smile_images_take(index);
+    if (image != NULL) {
+        smile_transition_start(image, smile_forward.load());
+        smile_pending.compare_exchange_strong(index, -1);
+    }
 }
 
 /**
@@ -394,7 +664,15 @@ void lvgl_set_menu_mode(uint8_t mode, uint8_t sub_mode) {
     lv_obj_add_flag(ui_home_screen, LV_OBJ_FLAG_HIDDEN);
     lv_obj_add_flag(ui_smile_screen, LV_OBJ_FLAG_HIDDEN);
     lv_obj_add_flag(ui_music_screen, LV_OBJ_FLAG_HIDDEN);
-    
+    spectrum_screen.store(mode == SCREEN_PLAY_MUSIC);
+
+    /* Give the slideshow memory back to the player, once the GUI task stops drawing it */
+    if (smile_active && (mode != SCREEN_SMILE)) {
+        smile_pending.store(-1);
+        smile_release.store(true);
+        smile_active = false;
+    }
+
     switch (mode) {
         case SCREEN_PLAY_MUSIC:
             lv_obj_clear_flag(ui_music_screen, LV_OBJ_FLAG_HIDDEN);
@@ -403,6 +681,8 @@ void lvgl_set_menu_mode(uint8_t mode, uint8_t sub_mode) {
         case SCREEN_SMILE:
             lv_obj_clear_flag(ui_smile_screen, LV_OBJ_FLAG_HIDDEN);
             smile_index = 0;
+            smile_active = true;
+            lvgl_show_smile(smile_index, true);
             break;
 
         case SCREEN_HOME:
@@ -424,16 +704,24 @@ void lvgl_set_menu_mode(uint8_t mode, uint8_t sub_mode) {
  * @brief  Change image resource
  */
 void lvgl_change_next_smile(void) {
-    smile_index = (smile_index + 1) % smile_image_max;  /* smile_image_max is always > 0 */
-    lv_img_set_src(ui_image_smile, image_src_list[smile_index]);
+    uint32_t count = smile_images_count();
+
+    if (count > 0) {
+        smile_index = (smile_index + 1) % count;
+        lvgl_show_smile(smile_index, true);
+    }
 }
 
 /**
  * @brief  Change image resource
  */
 void lvgl_change_prev_smile(void) {
-    smile_index = (smile_index + smile_image_max - 1) % smile_image_max;  /* smile_image_max is always > 0 */
-    lv_img_set_src(ui_image_smile, image_src_list[smile_index]);
+    uint32_t count = smile_images_count();
+
+    if (count > 0) {
+        smile_index = (smile_index + count - 1) % count;
+        lvgl_show_smile(smile_index, false);
+    }
 }
 
 /**
@@ -446,6 +734,24 @@ void lvgl_set_play_state(bool playing) {
     else {
         lv_img_set_src(ui_image_play_music, &ui_img_pause_button_png);
     }
+
+    spectrum_playing.store(playing);
+}
+
+/**
+ * @brief  Show the playback speed
+ */
+void lvgl_set_play_speed(uint16_t speed) {
+    char buff[16];
+
+    if (speed == 100) {
+        lv_obj_add_flag(ui_label_speed, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+
+    sprintf(buff, "%u.%02ux", speed / 100, speed % 100);
+    lv_label_set_text(ui_label_speed, buff);
+    lv_obj_clear_flag(ui_label_speed, LV_OBJ_FLAG_HIDDEN);
 }
 
 /**
@@ -459,6 +765,7 @@ void lvgl_set_song_name(const char *name) {
  * @brief  Initialize LVGL for gui
  */
 void lvgl_gui_init(void) {
+    smile_images_init();
     lv_init();
     lvgl_tick_init();
 
@@ -19,7 +19,33 @@
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
-
+/* Spectrum redraw period, stretched up to the max while it costs more than the budget */
+#ifndef LVGL_SPECTRUM_PERIOD_MS
+#define LVGL_SPECTRUM_PERIOD_MS 33
+#endif
+#ifndef LVGL_SPECTRUM_MAX_PERIOD_MS
+#define LVGL_SPECTRUM_MAX_PERIOD_MS 100
+#endif
+#ifndef LVGL_SPECTRUM_BUDGET
+#define LVGL_SPECTRUM_BUDGET 10      /* Percent of the GUI core for analysis and drawing */
+#endif
+
+/* Screen lines rendered per strip, each draw buffer holds one strip */
+#ifndef LVGL_DRAW_BUF_LINES
+#define LVGL_DRAW_BUF_LINES 24
+#endif
+
+/* Render the next strip while the last one is sent, 0 waits for every flush */
+#ifndef LVGL_DRAW_BUF_DOUBLE
+#define LVGL_DRAW_BUF_DOUBLE 1
+#endif
+
+/* Strips are sent by a task of their own, which takes the SPI bus shared with
+ * the SD card for each transfer and gives it back as soon as the DMA is done,
+ * so the card is never kept waiting while a strip is rendered */
+#ifndef LVGL_FLUSH_PRIORITY
+#define LVGL_FLUSH_PRIORITY 5        /* Above the GUI task, it sleeps while the DMA runs */
+#endif
 
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
@@ -72,6 +98,13 @@ void lvgl_change_prev_smile(void);
  */
 void lvgl_set_play_state(bool playing);
 
+/**
+ * @brief  Show the playback speed, hidden at normal speed
+ * @param  Speed in percent
+ * @retval None
+ */
+void lvgl_set_play_speed(uint16_t speed);
+
 /**
  * @brief  Set song name
  * @param  Song name
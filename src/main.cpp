@@ -16,6 +16,7 @@
 #include <EEPROM.h>
 #include <M5Unified.h>
 #include "app_config.hpp"
+#include "config_journal.hpp"
 #include "audio.hpp"
 #include "lvgl_gui.hpp"
 
@@ -30,6 +31,7 @@
 /******************************************************************************/
 
 static uint8_t current_volume = 255;
+static uint16_t current_speed = AUDIO_SPEED_NORMAL;
 static bool audio_running = false;
 static bool has_changed = false;
 
@@ -41,10 +43,14 @@ static uint32_t last_time_change_smile_ms = 0;
 static bool is_save_A = false;
 static bool is_save_C = false;
 static bool is_holding_A = false;
+static bool is_holding_B = false;
 static bool is_holding_C = false;
 static uint32_t hold_start_time_A = 0;
 static uint32_t hold_start_time_C = 0;
 
+/* Playback speeds Button B steps through, in percent */
+static const uint16_t speed_steps[] = { 100, 125, 150, 200, 50, 75 };
+
 /******************************************************************************/
 /*                              EXPORTED DATA                                 */
 /******************************************************************************/
@@ -60,34 +66,50 @@ static void control_loop(void);
 /******************************************************************************/
 
 /*!
- * @brief  Load configuration from EEPROM
+ * @brief  Load configuration from the config journal
  */
 void load_configuration(void) {
     memset(&system_config, 0, sizeof(system_config));
 
-    /* Initialize EEPROM */
-    if (!EEPROM.begin(128)) {
-        Serial.println("Failed to initialize EEPROM");
-        return;
+    if (!config_journal_init(&system_config, sizeof(system_config))) {
+        /* Migrate the configuration saved to EEPROM by older firmware */
+        if (EEPROM.begin(128)) {
+            EEPROM.get(0, system_config);
+            EEPROM.end();
+        }
+
+        if (system_config.magic != MAGIC_NUMBER) {
+            memset(&system_config, 0, sizeof(system_config));
+        }
+        else {
+            /* Older layout has no resume position, equalizer, crossfade or speed */
+            system_config.play_offset = 0;
+            system_config.play_key = 0;
+            system_config.eq_preset = AUDIO_EQ_PRESET_SPEAKER;
+            system_config.crossfade_ms = 0;
+            system_config.play_speed = AUDIO_SPEED_NORMAL;
+            config_journal_mark_dirty();
+        }
     }
 
-    /* Read the struct from EEPROM */
-    EEPROM.get(0, system_config);
     if (system_config.magic == MAGIC_NUMBER) {
         current_volume = system_config.volume;
         Serial.printf("Volume %d\r\n", current_volume);
+        if ((system_config.play_speed >= AUDIO_SPEED_MIN) && (system_config.play_speed <= AUDIO_SPEED_MAX)) {
+            current_speed = system_config.play_speed;
+        }
     }
 }
 
 /*!
- * @brief  Save configuration to EEPROM
+ * @brief  Save configuration, the journal writes it once changes settle
  */
 void save_configuration(void) {
+    config_journal_lock();
     system_config.magic = MAGIC_NUMBER;
     system_config.volume = current_volume;
-    EEPROM.put(0, system_config);
-    EEPROM.commit();
-    Serial.printf("Save configuration. Volume %d\r\n", current_volume);
+    config_journal_unlock();
+    config_journal_mark_dirty();
 }
 
 /*!
@@ -124,12 +146,14 @@ void setup() {
     lvgl_gui_init();
     lvgl_set_battery(M5.Power.getBatteryLevel());
     lvgl_set_play_state(false);
+    lvgl_set_play_speed(current_speed);
     last_active_ms = millis();
 }
 
 void loop() {
     M5.update();
     control_loop();
+    config_journal_poll();
     M5.delay(9);  /* Small delay for stability */
 }
 
@@ -196,12 +220,28 @@ static void sdcard_menu_loop(void) {
         }
     }
 
-    /* --- Button B: Toggle Play/Pause --- */
-    if (M5.BtnB.wasPressed()) {
-        audio_running = !audio_running;
-        audio_set_running(audio_running);
-        has_changed = true;
-        lvgl_set_play_state(audio_running);
+    /* --- Button B: Toggle Play/Pause OR Next Speed on Hold --- */
+    if (M5.BtnB.pressedFor(HOLDING_TIME_MS) && !is_holding_B) {
+        is_holding_B = true;
+
+        uint32_t step = 0;
+        while ((step < sizeof(speed_steps) / sizeof(speed_steps[0])) && (speed_steps[step] != current_speed)) {
+            step++;
+        }
+        current_speed = speed_steps[(step + 1) % (sizeof(speed_steps) / sizeof(speed_steps[0]))];
+        audio_set_speed(current_speed);
+        lvgl_set_play_speed(current_speed);
+        Serial.printf("Speed %u%%\r\n", current_speed);
+    }
+
+    if (M5.BtnB.wasReleased()) {
+        if (!is_holding_B) {
+            audio_running = !audio_running;
+            audio_set_running(audio_running);
+            has_changed = true;
+            lvgl_set_play_state(audio_running);
+        }
+        is_holding_B = false;
     }
 
     /* --- Button C: Next Audio --- */
@@ -293,6 +333,7 @@ static void control_loop(void) {
     elapsed = now - last_active_ms;
     if (elapsed > 10000) {
         last_active_ms = now;
+        config_journal_flush();
         M5.Power.powerOff();
     }
 
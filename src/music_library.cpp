@@ -0,0 +1,619 @@
+/*
+ *  music_library.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <SD.h>
+#include <atomic>
+#include "crc32.hpp"
+#include "wav_parser.hpp"
+#include "audio_flac.hpp"
+#include "audio_reader.hpp"
+#include "audio_loudness.hpp"
+#include "music_library.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define MUSIC_INDEX_TMP_PATH MUSIC_INDEX_PATH ".tmp"
+#define MUSIC_TRACKS_MAX 10000
+#define MUSIC_POOL_MAX (MUSIC_TRACKS_MAX * 64)
+
+/* Analyzed tracks are written to the index at most this often */
+#ifndef MUSIC_ANALYZE_COMMIT_MS
+#define MUSIC_ANALYZE_COMMIT_MS 60000
+#endif
+
+typedef struct {
+    music_index_header_t header;
+    uint8_t *blob;               /* Track records followed by the string pool */
+} library_t;
+
+/* State of the second directory pass */
+typedef struct {
+    library_t *lib;
+    uint32_t index;              /* Next record to fill */
+    uint32_t pool_pos;           /* Next free byte of the string pool */
+    uint32_t old_cursor;         /* Where the next unchanged file is expected in the old index */
+    bool overflow;               /* Directory grew between the two passes */
+} library_build_t;
+
+typedef void (*library_entry_cb_t)(const char *name, uint32_t size, void *arg);
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static library_t library;                    /* Read by the audio task only */
+static library_t pending;                    /* Built by the refresh task */
+static std::atomic<bool> pending_ready(false);
+static void (*library_on_change)(void) = NULL;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static inline music_track_t *library_records(const library_t *lib) {
+    return (music_track_t *)lib->blob;
+}
+
+static inline uint8_t *library_offsets(const library_t *lib) {
+    return lib->blob + lib->header.track_count * sizeof(music_track_t);
+}
+
+static inline uint8_t *library_pool(const library_t *lib) {
+    return library_offsets(lib) + lib->header.track_count * lib->header.offset_size;
+}
+
+static inline size_t library_blob_size(const music_index_header_t *header) {
+    return header->track_count * (sizeof(music_track_t) + header->offset_size) + header->pool_size;
+}
+
+/*!
+ * @brief  Offset of a name in the string pool
+ */
+static inline uint32_t library_name_offset(const library_t *lib, uint32_t index) {
+    const uint8_t *offsets = library_offsets(lib);
+
+    if (lib->header.offset_size == 2) {
+        return ((const uint16_t *)offsets)[index];
+    }
+
+    return ((const uint32_t *)offsets)[index];
+}
+
+/*!
+ * @brief  Store the offset of a name in the string pool
+ */
+static inline void library_set_name_offset(const library_t *lib, uint32_t index, uint32_t offset) {
+    uint8_t *offsets = library_offsets(lib);
+
+    if (lib->header.offset_size == 2) {
+        ((uint16_t *)offsets)[index] = offset;
+    }
+    else {
+        ((uint32_t *)offsets)[index] = offset;
+    }
+}
+
+/*!
+ * @brief  Length prefixed name entry of a track
+ */
+static inline const uint8_t *library_name_entry(const library_t *lib, uint32_t index) {
+    return library_pool(lib) + library_name_offset(lib, index);
+}
+
+/*!
+ * @brief  FNV-1a step over a buffer
+ */
+static uint32_t library_hash(uint32_t hash, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+
+    while (len--) {
+        hash = (hash ^ *p++) * 16777619u;
+    }
+
+    return hash;
+}
+
+/*!
+ * @brief  Check that every name lies inside the string pool and is terminated
+ */
+static bool library_check(const library_t *lib) {
+    const uint8_t *pool = library_pool(lib);
+    uint32_t pool_size = lib->header.pool_size;
+
+    for (uint32_t i = 0; i < lib->header.track_count; i++) {
+        uint32_t offset = library_name_offset(lib, i);
+        if ((offset >= pool_size) || (offset + pool[offset] + 2 > pool_size) || (pool[offset + pool[offset] + 1] != '\0')) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * @brief  Print memory used by the library
+ */
+static void library_report(const library_t *lib) {
+    uint32_t count = lib->header.track_count;
+    size_t size = library_blob_size(&lib->header);
+
+    Serial.printf("Music library: %u tracks, %u bytes, %u bytes per track, free heap %u, min free heap %u\r\n",
+                  count, size, count ? size / count : 0, ESP.getFreeHeap(), ESP.getMinFreeHeap());
+}
+
+/*!
+ * @brief  Check the extension of a directory entry
+ */
+static bool library_is_track(const char *name, size_t len) {
+    return ((len > 4) && !strcasecmp(name + len - 4, ".wav")) || ((len > 5) && !strcasecmp(name + len - 5, ".flac"));
+}
+
+/*!
+ * @brief  Walk the music directory, calling back for every .wav and .flac file
+ */
+static bool library_scan(library_entry_cb_t cb, void *arg, uint32_t *count, uint32_t *pool_size, uint32_t *signature) {
+    File dir = SD.open(MUSIC_DIR);
+
+    if (!dir) {
+        return false;
+    }
+
+    *count = 0;
+    *pool_size = 0;
+    *signature = 2166136261u;
+    while (true) {
+        File entry = dir.openNextFile();
+        if (!entry) {
+            break;
+        }
+
+        if (!entry.isDirectory()) {
+            const char *name = entry.name();
+            size_t len = strlen(name);
+            if ((len <= MUSIC_NAME_MAX) && library_is_track(name, len)) {
+                uint32_t size = entry.size();
+                *signature = library_hash(*signature, name, len + 1);
+                *signature = library_hash(*signature, &size, sizeof(size));
+                *pool_size += len + 2;
+                (*count)++;
+                if (cb != NULL) {
+                    cb(name, size, arg);
+                }
+            }
+        }
+
+        entry.close();
+    }
+
+    dir.close();
+    return true;
+}
+
+/*!
+ * @brief  Find an unchanged file in the current index
+ */
+static const music_track_t *library_find(library_build_t *build, const char *name, size_t len, uint32_t size) {
+    const music_track_t *records = library_records(&library);
+    uint32_t count = music_library_count();
+
+    if (count == 0) {
+        return NULL;
+    }
+
+    /* Directory order is stable, so the expected slot almost always matches */
+    for (uint32_t n = 0; n < count; n++) {
+        uint32_t i = (build->old_cursor + n) % count;
+        const uint8_t *entry = library_name_entry(&library, i);
+        if ((records[i].file_size == size) && (entry[0] == len) && !memcmp(entry + 1, name, len)) {
+            build->old_cursor = i + 1;
+            return &records[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief  Parse the header of a new file
+ */
+static bool library_parse_track(const char *name, uint32_t size, music_track_t *track) {
+    char path[AUDIO_PATH_MAX];
+    uint8_t buf[256];
+    wav_parser_t parser;
+    wav_parse_result_t result = WAV_PARSE_NEED_MORE;
+
+    snprintf(path, sizeof(path), MUSIC_DIR "/%s", name);
+    File file = SD.open(path);
+    if (!file) {
+        return false;
+    }
+
+    wav_parser_init(&parser);
+    while (result == WAV_PARSE_NEED_MORE) {
+        int len = file.read(buf, sizeof(buf));
+        if (len <= 0) {
+            break;
+        }
+
+        if ((parser.offset == 0) && flac_probe(buf, len, size, &parser.info)) {
+            result = WAV_PARSE_DONE;
+            break;
+        }
+
+        result = wav_parser_feed(&parser, buf, len, NULL);
+        uint32_t skip = wav_parser_skip(&parser, sizeof(buf));
+        if (skip && !file.seek(skip, SeekMode::SeekCur)) {
+            break;
+        }
+    }
+    file.close();
+
+    if (result != WAV_PARSE_DONE) {
+        return false;
+    }
+
+    wav_info_t *info = &parser.info;
+    uint32_t file_left = size > info->data_offset ? size - info->data_offset : 0;
+    if (info->data_size > file_left) {
+        info->data_size = file_left - file_left % info->block_align;
+    }
+
+    track->file_size = size;
+    track->data_offset = info->data_offset;
+    track->data_size = info->data_size;
+    track->sample_rate = info->sample_rate;
+    uint32_t frames = (info->format == WAV_FORMAT_FLAC) ? info->fact_frames : wav_frames(info);
+    track->duration_ms = (uint64_t)frames * 1000 / info->sample_rate;
+    track->format = info->format;
+    track->channels = info->channels;
+    track->bits = info->bits;
+    track->loudness = MUSIC_LOUDNESS_UNKNOWN;
+    track->peak = 0;
+    return true;
+}
+
+/*!
+ * @brief  Fill one record during the second directory pass
+ */
+static void library_build_entry(const char *name, uint32_t size, void *arg) {
+    library_build_t *build = (library_build_t *)arg;
+    library_t *lib = build->lib;
+    size_t len = strlen(name);
+
+    if ((build->index >= lib->header.track_count) || (build->pool_pos + len + 2 > lib->header.pool_size)) {
+        build->overflow = true;
+        return;
+    }
+
+    music_track_t *track = &library_records(lib)[build->index];
+    const music_track_t *old = library_find(build, name, len, size);
+    if (old != NULL) {
+        *track = *old;
+    }
+    else if (!library_parse_track(name, size, track)) {
+        Serial.printf("Skip invalid music file %s\r\n", name);
+        return;
+    }
+
+    uint8_t *entry = library_pool(lib) + build->pool_pos;
+    entry[0] = len;
+    memcpy(entry + 1, name, len + 1);
+    library_set_name_offset(lib, build->index, build->pool_pos);
+    build->pool_pos += len + 2;
+    build->index++;
+}
+
+/*!
+ * @brief  Write the index file, replacing the old one
+ */
+static bool library_write(const library_t *lib) {
+    size_t blob_size = library_blob_size(&lib->header);
+    File file = SD.open(MUSIC_INDEX_TMP_PATH, FILE_WRITE);
+
+    if (!file) {
+        return false;
+    }
+
+    bool ok = (file.write((const uint8_t *)&lib->header, sizeof(lib->header)) == sizeof(lib->header)) &&
+              (file.write(lib->blob, blob_size) == blob_size);
+    file.close();
+
+    if (!ok) {
+        SD.remove(MUSIC_INDEX_TMP_PATH);
+        return false;
+    }
+
+    SD.remove(MUSIC_INDEX_PATH);
+    return SD.rename(MUSIC_INDEX_TMP_PATH, MUSIC_INDEX_PATH);
+}
+
+/*!
+ * @brief  Rebuild the library from the directory
+ */
+static bool library_build(library_t *lib, uint32_t count, uint32_t pool_size, uint32_t signature) {
+    library_build_t build;
+    uint32_t scan_count, scan_pool, scan_signature;
+
+    memset(lib, 0, sizeof(library_t));
+    lib->header.magic = MUSIC_INDEX_MAGIC;
+    lib->header.version = MUSIC_INDEX_VERSION;
+    lib->header.record_size = sizeof(music_track_t);
+    lib->header.track_count = count;
+    lib->header.pool_size = pool_size;
+    lib->header.offset_size = (pool_size <= 0xFFFF) ? 2 : 4;
+    lib->header.signature = signature;
+    lib->blob = (uint8_t *)malloc(library_blob_size(&lib->header) + 1);
+    if (lib->blob == NULL) {
+        return false;
+    }
+
+    memset(&build, 0, sizeof(build));
+    build.lib = lib;
+    if (!library_scan(library_build_entry, &build, &scan_count, &scan_pool, &scan_signature) ||
+        build.overflow || (scan_signature != signature)) {
+        free(lib->blob);
+        lib->blob = NULL;
+        return false;
+    }
+
+    /* Close the gaps left by invalid files */
+    if (build.index < count) {
+        uint8_t *offsets = library_offsets(lib);
+        uint8_t *pool = library_pool(lib);
+        lib->header.track_count = build.index;
+        lib->header.pool_size = build.pool_pos;
+        memmove(library_offsets(lib), offsets, build.index * lib->header.offset_size);
+        memmove(library_pool(lib), pool, build.pool_pos);
+    }
+
+    return true;
+}
+
+/*!
+ * @brief  Write a library built by the refresh task and hand it to the audio task
+ */
+static void library_publish(library_t *lib) {
+    lib->header.crc = crc32(lib->blob, library_blob_size(&lib->header));
+    library_write(lib);
+
+    pending_ready.store(true);
+    if (library_on_change != NULL) {
+        library_on_change();
+    }
+}
+
+/*!
+ * @brief  Copy the current library so records can be updated
+ */
+static bool library_clone(library_t *dst, const library_t *src) {
+    size_t size = library_blob_size(&src->header);
+
+    dst->header = src->header;
+    dst->blob = (uint8_t *)malloc(size + 1);
+    if (dst->blob == NULL) {
+        return false;
+    }
+
+    memcpy(dst->blob, src->blob, size);
+    return true;
+}
+
+/*!
+ * @brief  Measure the loudness of every track not analyzed yet, publishing
+ *         the results in batches
+ */
+static void library_analyze(void) {
+    uint32_t next = 0;
+
+    while (true) {
+        /* The current library is freed once the audio task applies a pending one */
+        while (pending_ready.load()) {
+            vTaskDelay(pdMS_TO_TICKS(500));
+        }
+
+        const music_track_t *records = library_records(&library);
+        uint32_t count = music_library_count();
+        while ((next < count) && (records[next].loudness != MUSIC_LOUDNESS_UNKNOWN)) {
+            next++;
+        }
+        if ((next >= count) || !library_clone(&pending, &library)) {
+            return;
+        }
+
+        uint32_t start = millis();
+        while ((next < count) && (millis() - start < MUSIC_ANALYZE_COMMIT_MS)) {
+            char path[AUDIO_PATH_MAX];
+            music_track_t *track = &library_records(&pending)[next];
+
+            if (track->loudness == MUSIC_LOUDNESS_UNKNOWN) {
+                music_library_path(next, path, sizeof(path));
+                if (!audio_loudness_analyze(path, track)) {
+                    track->loudness = MUSIC_LOUDNESS_NONE;
+                }
+            }
+            next++;
+        }
+
+        library_publish(&pending);
+    }
+}
+
+/*!
+ * @brief  Low priority task checking the directory against the index
+ */
+static void library_refresh_task(void *arg) {
+    uint32_t start = millis();
+    uint32_t count, pool_size, signature;
+
+    /* First pass only lists names and sizes, no file is opened */
+    if (library_scan(NULL, NULL, &count, &pool_size, &signature) &&
+        ((library.blob == NULL) || (signature != library.header.signature)) &&
+        (count <= MUSIC_TRACKS_MAX) && (pool_size <= MUSIC_POOL_MAX)) {
+        if (library_build(&pending, count, pool_size, signature)) {
+            Serial.printf("Music index rebuilt: %u tracks in %u ms\r\n", pending.header.track_count, millis() - start);
+            library_publish(&pending);
+        }
+    }
+
+    /* Loudness is measured once per file, in the background */
+    library_analyze();
+
+    vTaskDelete(NULL);
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Load the library from the index file with one sequential read
+ */
+bool music_library_load(void) {
+    uint32_t start = millis();
+    music_index_header_t header;
+    library_t lib;
+    bool ok;
+
+    File file = SD.open(MUSIC_INDEX_PATH);
+    if (!file) {
+        return false;
+    }
+
+    ok = (file.read((uint8_t *)&header, sizeof(header)) == sizeof(header)) &&
+         (header.magic == MUSIC_INDEX_MAGIC) &&
+         (header.version == MUSIC_INDEX_VERSION) &&
+         (header.record_size == sizeof(music_track_t)) &&
+         ((header.offset_size == 2) || (header.offset_size == 4)) &&
+         (header.track_count <= MUSIC_TRACKS_MAX) &&
+         (header.pool_size <= MUSIC_POOL_MAX) &&
+         (file.size() == sizeof(header) + library_blob_size(&header));
+
+    lib.header = header;
+    lib.blob = ok ? (uint8_t *)malloc(library_blob_size(&header) + 1) : NULL;
+    ok = (lib.blob != NULL) &&
+         (file.read(lib.blob, library_blob_size(&header)) == library_blob_size(&header)) &&
+         (crc32(lib.blob, library_blob_size(&header)) == header.crc) &&
+         library_check(&lib);
+    file.close();
+
+    if (!ok) {
+        free(lib.blob);
+        Serial.println("Music index invalid");
+        return false;
+    }
+
+    free(library.blob);
+    library = lib;
+    Serial.printf("Music index: %u tracks loaded in %u ms\r\n", header.track_count, millis() - start);
+    library_report(&library);
+    return true;
+}
+
+/*!
+ * @brief  Check the music directory in a low priority task
+ */
+void music_library_refresh(void (*on_change)(void)) {
+    library_on_change = on_change;
+    xTaskCreatePinnedToCore(library_refresh_task, "LIBRARY", 6144, NULL, 1, NULL, 0);
+}
+
+/*!
+ * @brief  Switch to the library built by the refresh task, if any
+ */
+bool music_library_apply(void) {
+    if (!pending_ready.load()) {
+        return false;
+    }
+
+    free(library.blob);
+    library = pending;
+    memset(&pending, 0, sizeof(pending));
+    pending_ready.store(false);
+    library_report(&library);
+    return true;
+}
+
+/*!
+ * @brief  Get number of tracks
+ */
+uint32_t music_library_count(void) {
+    return library.blob ? library.header.track_count : 0;
+}
+
+/*!
+ * @brief  Get track metadata
+ */
+const music_track_t *music_library_track(uint32_t index) {
+    if (index >= music_library_count()) {
+        return NULL;
+    }
+
+    return &library_records(&library)[index];
+}
+
+/*!
+ * @brief  Get track file name, relative to MUSIC_DIR
+ */
+const char *music_library_name(uint32_t index) {
+    if (index >= music_library_count()) {
+        return NULL;
+    }
+
+    return (const char *)library_name_entry(&library, index) + 1;
+}
+
+/*!
+ * @brief  Build the full path of a track without allocating
+ */
+size_t music_library_path(uint32_t index, char *buf, size_t size) {
+    static const size_t dir_len = sizeof(MUSIC_DIR) - 1;
+
+    if (index >= music_library_count()) {
+        return 0;
+    }
+
+    const uint8_t *entry = library_name_entry(&library, index);
+    size_t len = dir_len + 1 + entry[0];
+    if (len + 1 > size) {
+        return 0;
+    }
+
+    memcpy(buf, MUSIC_DIR, dir_len);
+    buf[dir_len] = '/';
+    memcpy(buf + dir_len + 1, entry + 1, entry[0] + 1);
+    return len;
+}
+
+/*!
+ * @brief  Identify a track file across index rebuilds
+ */
+uint32_t music_library_key(uint32_t index) {
+    if (index >= music_library_count()) {
+        return 0;
+    }
+
+    const uint8_t *entry = library_name_entry(&library, index);
+    uint32_t hash = library_hash(2166136261u, entry + 1, entry[0]);
+    hash = library_hash(hash, &library_records(&library)[index].file_size, sizeof(uint32_t));
+    return hash ? hash : 1;
+}
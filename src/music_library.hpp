@@ -0,0 +1,141 @@
+/*
+ *  music_library.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __MUSIC_LIBRARY_HPP_
+#define __MUSIC_LIBRARY_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define MUSIC_DIR "/music"
+#define MUSIC_INDEX_PATH "/music/.index"
+#define MUSIC_INDEX_MAGIC 0x58494853    /* "SHIX" */
+#define MUSIC_INDEX_VERSION 4
+#define MUSIC_NAME_MAX 255
+
+#define MUSIC_LOUDNESS_UNKNOWN INT16_MIN          /* Not analyzed yet */
+#define MUSIC_LOUDNESS_NONE (INT16_MIN + 1)       /* Silent or unreadable, played at unity gain */
+
+/*
+ * Index file and in-memory arena: header, track records, name offsets, then
+ * the string pool. Offsets are 16-bit while the pool fits, 32-bit otherwise.
+ * Each name is stored as a length byte, the name and a NUL.
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;        /* sizeof(music_track_t) */
+    uint32_t track_count;
+    uint32_t pool_size;          /* Bytes of length prefixed names */
+    uint16_t offset_size;        /* 2 or 4 */
+    uint16_t reserved;
+    uint32_t signature;          /* Hash of the track names and sizes in directory order */
+    uint32_t crc;                /* CRC-32 of everything after the header */
+} music_index_header_t;
+
+/* Metadata of one track */
+typedef struct __attribute__((packed)) {
+    uint32_t file_size;
+    uint32_t data_offset;        /* File offset of the first sample */
+    uint32_t data_size;
+    uint32_t sample_rate;
+    uint32_t duration_ms;
+    uint16_t format;
+    uint8_t channels;
+    uint8_t bits;
+    int16_t loudness;            /* Integrated loudness in LUFS x 100, MUSIC_LOUDNESS_xxx */
+    uint16_t peak;               /* Largest sample of the mono mix */
+} music_track_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Load the library from the index file with one sequential read
+ * @param  None
+ * @retval True if the index was valid
+ */
+bool music_library_load(void);
+
+/*!
+ * @brief  Check the music directory in a low priority task and rebuild the
+ *         index when it changed, reusing records of unchanged files. The
+ *         loudness of new tracks is measured afterwards, in batches.
+ * @param  Called from the refresh task once a new library is pending
+ * @retval None
+ */
+void music_library_refresh(void (*on_change)(void));
+
+/*!
+ * @brief  Switch to the library built by the refresh task, if any.
+ *         Must be called from the task reading the library.
+ * @param  None
+ * @retval True if the library changed
+ */
+bool music_library_apply(void);
+
+/*!
+ * @brief  Get number of tracks
+ * @param  None
+ * @retval Track count
+ */
+uint32_t music_library_count(void);
+
+/*!
+ * @brief  Get track metadata
+ * @param  Track index
+ * @retval Track or NULL if out of range
+ */
+const music_track_t *music_library_track(uint32_t index);
+
+/*!
+ * @brief  Get track file name, relative to MUSIC_DIR
+ * @param  Track index
+ * @retval Name or NULL if out of range
+ */
+const char *music_library_name(uint32_t index);
+
+/*!
+ * @brief  Build the full path of a track without allocating
+ * @param  Track index, destination buffer and its size
+ * @retval Path length, 0 if out of range or the buffer is too small
+ */
+size_t music_library_path(uint32_t index, char *buf, size_t size);
+
+/*!
+ * @brief  Identify a track file across index rebuilds, from its name and size
+ * @param  Track index
+ * @retval Key, never 0, or 0 if out of range
+ */
+uint32_t music_library_key(uint32_t index);
+
+/******************************************************************************/
+
+#endif /* __MUSIC_LIBRARY_HPP_ */
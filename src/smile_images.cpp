@@ -0,0 +1,477 @@
+/*
+ *  smile_images.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <SD.h>
+#include <SPIFFS.h>
+#include "image_lz.hpp"
+#include "smile_images.hpp"
+#include "smile_manifest.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* The images of the file system image, generated by tools/smile_assets.py,
+ * must all be listed and the ones drawn together must fit the cache */
+static_assert(SMILE_MANIFEST_COUNT <= SMILE_IMAGES_MAX, "SMILE_IMAGES_MAX is too small for the manifest");
+static_assert(SMILE_CACHE_ENTRIES * SMILE_MANIFEST_MAX_SIZE <= SMILE_CACHE_BYTES, "SMILE_CACHE_BYTES is too small for the largest images");
+
+typedef struct {
+    lv_img_dsc_t dsc;            /* data is NULL while the entry is free or being read */
+    int32_t index;               /* Image held or being read, -1 if the entry is free */
+    uint32_t used;               /* Access stamp for LRU */
+} smile_entry_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static fs::FS *smile_fs = NULL;
+static char smile_names[SMILE_IMAGES_MAX][SMILE_NAME_MAX];
+static uint32_t smile_count = 0;
+static size_t smile_cache_bytes = SMILE_CACHE_BYTES;    /* Raised so the largest images fit two at a time */
+static TaskHandle_t smile_task_handle = NULL;
+
+/* Shared with the prefetch task, under the lock. Only the task reads files. */
+static SemaphoreHandle_t smile_lock = NULL;
+static smile_entry_t smile_entries[SMILE_CACHE_ENTRIES];
+static uint32_t smile_stamp = 0;
+static size_t smile_resident = 0;            /* Entries being read included */
+static int32_t smile_shown = -1;             /* Taken for display, never dropped */
+static int32_t smile_last_shown = -1;        /* Still drawn while the transition runs */
+static int32_t smile_target = -1;            /* Requested, -1 after a release */
+static uint32_t smile_request_ms = 0;
+static bool smile_waiting = false;           /* Requested image not taken yet */
+
+/* Statistic counters, a hit is a request for an image already in RAM */
+static uint32_t smile_hits = 0;
+static uint32_t smile_misses = 0;
+static uint32_t smile_switches = 0;
+static uint32_t smile_switch_total_ms = 0;
+static uint32_t smile_switch_max_ms = 0;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Compare names with their digits as numbers, image2 comes before image10
+ */
+static int smile_name_cmp(const void *a, const void *b) {
+    const char *x = (const char *)a;
+    const char *y = (const char *)b;
+
+    while (*x && *y) {
+        if (isdigit((uint8_t)*x) && isdigit((uint8_t)*y)) {
+            char *x_end;
+            char *y_end;
+            unsigned long nx = strtoul(x, &x_end, 10);
+            unsigned long ny = strtoul(y, &y_end, 10);
+            if (nx != ny) {
+                return (nx < ny) ? -1 : 1;
+            }
+            x = x_end;
+            y = y_end;
+        }
+        else {
+            int diff = tolower((uint8_t)*x) - tolower((uint8_t)*y);
+            if (diff) {
+                return diff;
+            }
+            x++;
+            y++;
+        }
+    }
+
+    return (uint8_t)*x - (uint8_t)*y;
+}
+
+/*!
+ * @brief  List the LVGL binary images of the smiles directory, the largest data size is returned in largest
+ */
+static uint32_t smile_scan(fs::FS &fs, size_t *largest) {
+    File dir = fs.open(SMILE_DIR);
+    uint32_t count = 0;
+
+    *largest = 0;
+    if (!dir || !dir.isDirectory()) {
+        return 0;
+    }
+
+    while (count < SMILE_IMAGES_MAX) {
+        File entry = dir.openNextFile();
+        if (!entry) {
+            break;
+        }
+
+        const char *name = entry.name();
+        size_t len = strlen(name);
+        size_t size = entry.size();
+        if (!entry.isDirectory() && (len > 4) && (len < SMILE_NAME_MAX) && !strcasecmp(name + len - 4, ".bin")) {
+            /* The image shown and the next one must fit the cache together */
+            if ((size <= sizeof(lv_img_header_t)) || (size - sizeof(lv_img_header_t) > SMILE_CACHE_BYTES)) {
+                Serial.printf("Smile %s skipped, %u bytes do not fit the cache\r\n", name, size);
+            }
+            else {
+                memcpy(smile_names[count++], name, len + 1);
+                if (size - sizeof(lv_img_header_t) > *largest) {
+                    *largest = size - sizeof(lv_img_header_t);
+                }
+            }
+        }
+
+        entry.close();
+    }
+
+    dir.close();
+    return count;
+}
+
+/*!
+ * @brief  Entry holding or reading an image, the lock must be held
+ */
+static smile_entry_t *smile_find(int32_t index) {
+    for (int i = 0; i < SMILE_CACHE_ENTRIES; i++) {
+        if (smile_entries[i].index == index) {
+            return &smile_entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief  Check if an image is requested or next to it, the lock must be held
+ */
+static bool smile_wanted(int32_t index) {
+    int32_t count = smile_count;
+    int32_t next = (smile_target + 1) % count;
+    int32_t prev = (smile_target + count - 1) % count;
+
+    return (index == smile_target) || (index == next) || (index == prev);
+}
+
+/*!
+ * @brief  Drop an image and give its memory back, the lock must be held
+ */
+static void smile_drop(smile_entry_t *entry) {
+    image_lz_forget(entry->dsc.data);
+    free((void *)entry->dsc.data);
+    smile_resident -= entry->dsc.data_size;
+    entry->dsc.data = NULL;
+    entry->index = -1;
+}
+
+/*!
+ * @brief  Drop least recently used images until size more bytes fit, the lock must be held
+ * @retval Free entry or NULL if the images in the way are drawn or, for a
+ *         neighbour, wanted
+ */
+static smile_entry_t *smile_make_room(size_t size, bool target) {
+    while (1) {
+        smile_entry_t *free_entry = NULL;
+        smile_entry_t *oldest = NULL;
+
+        for (int i = 0; i < SMILE_CACHE_ENTRIES; i++) {
+            smile_entry_t *entry = &smile_entries[i];
+            if (entry->index < 0) {
+                free_entry = entry;
+            }
+            else if ((entry->dsc.data != NULL) && (entry->index != smile_shown) && (entry->index != smile_last_shown) &&
+                     (target || !smile_wanted(entry->index)) &&
+                     ((oldest == NULL) || ((int32_t)(entry->used - oldest->used) < 0))) {
+                oldest = entry;
+            }
+        }
+
+        if ((free_entry != NULL) && (smile_resident + size <= smile_cache_bytes)) {
+            return free_entry;
+        }
+
+        if (oldest == NULL) {
+            return NULL;
+        }
+
+        smile_drop(oldest);
+    }
+}
+
+/*!
+ * @brief  Read an image into a free entry unless it is cached
+ * @param  Image index, and true for the requested image, which may push out
+ *         any image but the one shown
+ * @retval False if the image can't be cached
+ */
+static bool smile_load(int32_t index, bool target) {
+    char path[sizeof(SMILE_DIR) + SMILE_NAME_MAX];
+    lv_img_header_t header;
+
+    xSemaphoreTake(smile_lock, portMAX_DELAY);
+    smile_entry_t *entry = smile_find(index);
+    bool released = (smile_target < 0);
+    if (entry != NULL) {
+        entry->used = ++smile_stamp;
+    }
+    xSemaphoreGive(smile_lock);
+    if ((entry != NULL) || released) {
+        return true;
+    }
+
+    snprintf(path, sizeof(path), SMILE_DIR "/%s", smile_names[index]);
+    File file = smile_fs->open(path);
+    if (!file) {
+        return false;
+    }
+
+    size_t size = file.size();
+    if ((size <= sizeof(header)) || (size - sizeof(header) > smile_cache_bytes) ||
+        (file.read((uint8_t *)&header, sizeof(header)) != sizeof(header)) ||
+        (header.cf == LV_IMG_CF_UNKNOWN) || (header.always_zero != 0) || (header.w == 0) || (header.h == 0)) {
+        file.close();
+        return false;
+    }
+    size -= sizeof(header);
+
+    xSemaphoreTake(smile_lock, portMAX_DELAY);
+    entry = smile_make_room(size, target);
+    if (entry != NULL) {
+        entry->index = index;
+        entry->dsc.data_size = size;
+        smile_resident += size;
+    }
+    xSemaphoreGive(smile_lock);
+    if (entry == NULL) {
+        file.close();
+        return false;
+    }
+
+    uint8_t *data = (uint8_t *)malloc(size);
+    bool ok = (data != NULL) && (file.read(data, size) == size);
+    file.close();
+
+    /* Images read across a release are not kept */
+    xSemaphoreTake(smile_lock, portMAX_DELAY);
+    if (ok && (smile_target >= 0)) {
+        entry->dsc.header = header;
+        entry->dsc.data = data;
+        entry->used = ++smile_stamp;
+    }
+    else {
+        free(data);
+        smile_resident -= size;
+        entry->index = -1;
+    }
+    xSemaphoreGive(smile_lock);
+
+    return ok;
+}
+
+/*!
+ * @brief  Get the requested image, -1 if there is none
+ */
+static int32_t smile_get_target(void) {
+    xSemaphoreTake(smile_lock, portMAX_DELAY);
+    int32_t target = smile_target;
+    xSemaphoreGive(smile_lock);
+
+    return target;
+}
+
+/*!
+ * @brief  Read the requested image, then its neighbours while the slideshow waits.
+ *         A requested image the drawn ones leave no room for is read again once
+ *         the previous image is let go.
+ */
+static void smile_prefetch_task(void *arg) {
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        int32_t target = smile_get_target();
+        if (target < 0) {
+            continue;
+        }
+
+        uint32_t start = millis();
+        if (!smile_load(target, true)) {
+            Serial.printf("Smile %s not loaded\r\n", smile_names[target]);
+        }
+        else if (millis() - start > 1) {
+            Serial.printf("Smile %s read in %u ms\r\n", smile_names[target], millis() - start);
+        }
+
+        /* A newer request goes first */
+        int32_t count = smile_count;
+        if ((count > 1) && (smile_get_target() == target)) {
+            smile_load((target + 1) % count, false);
+        }
+        if ((count > 2) && (smile_get_target() == target)) {
+            smile_load((target + count - 1) % count, false);
+        }
+    }
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  List the images and start the prefetch task
+ */
+uint32_t smile_images_init(void) {
+    smile_lock = xSemaphoreCreateMutex();
+    for (int i = 0; i < SMILE_CACHE_ENTRIES; i++) {
+        smile_entries[i].index = -1;
+    }
+
+    size_t largest;
+    smile_fs = &SD;
+    smile_count = smile_scan(SD, &largest);
+    if (smile_count == 0) {
+        smile_fs = &SPIFFS;
+        smile_count = smile_scan(SPIFFS, &largest);
+    }
+    if (2 * largest > smile_cache_bytes) {
+        smile_cache_bytes = 2 * largest;
+        Serial.printf("Smiles: cache raised to %u bytes for the largest images\r\n", smile_cache_bytes);
+    }
+    qsort(smile_names, smile_count, SMILE_NAME_MAX, smile_name_cmp);
+    Serial.printf("Smiles: %u images in %s%s\r\n", smile_count, (smile_fs == &SD) ? "SD" : "SPIFFS", SMILE_DIR);
+    if ((smile_fs == &SPIFFS) && (smile_count != SMILE_MANIFEST_COUNT)) {
+        Serial.printf("Smiles: %u images built, upload the file system image\r\n", SMILE_MANIFEST_COUNT);
+    }
+
+    xTaskCreatePinnedToCore(smile_prefetch_task, "SMILE", 4096, NULL, 1, &smile_task_handle, 0);
+    return smile_count;
+}
+
+/*!
+ * @brief  Get number of images
+ */
+uint32_t smile_images_count(void) {
+    return smile_count;
+}
+
+/*!
+ * @brief  Ask for an image to be shown
+ */
+void smile_images_request(uint32_t index) {
+    if (index >= smile_count) {
+        return;
+    }
+
+    xSemaphoreTake(smile_lock, portMAX_DELAY);
+    smile_entry_t *entry = smile_find(index);
+    if ((entry != NULL) && (entry->dsc.data != NULL)) {
+        smile_hits++;
+    }
+    else {
+        smile_misses++;
+    }
+    smile_target = index;
+    smile_request_ms = millis();
+    smile_waiting = true;
+    xSemaphoreGive(smile_lock);
+
+    xTaskNotifyGive(smile_task_handle);
+}
+
+/*!
+ * @brief  Take an image to show if it is in RAM
+ */
+const lv_img_dsc_t *smile_images_take(uint32_t index) {
+    xSemaphoreTake(smile_lock, portMAX_DELAY);
+    smile_entry_t *entry = smile_find(index);
+    if ((entry == NULL) || (entry->dsc.data == NULL)) {
+        xSemaphoreGive(smile_lock);
+        return NULL;
+    }
+
+    if (smile_shown != (int32_t)index) {
+        smile_last_shown = smile_shown;
+        smile_shown = index;
+    }
+    entry->used = ++smile_stamp;
+    if (smile_waiting && (smile_target == (int32_t)index)) {
+        uint32_t elapsed = millis() - smile_request_ms;
+        smile_waiting = false;
+        smile_switches++;
+        smile_switch_total_ms += elapsed;
+        if (elapsed > smile_switch_max_ms) {
+            smile_switch_max_ms = elapsed;
+        }
+    }
+    xSemaphoreGive(smile_lock);
+
+    return &entry->dsc;
+}
+
+/*!
+ * @brief  Let go of the image shown before, the transition no longer draws it
+ */
+void smile_images_settle(void) {
+    xSemaphoreTake(smile_lock, portMAX_DELAY);
+    bool held = (smile_last_shown >= 0);
+    smile_last_shown = -1;
+    bool waiting = held && smile_waiting;
+    xSemaphoreGive(smile_lock);
+
+    /* The requested image may have waited for its room */
+    if (waiting) {
+        xTaskNotifyGive(smile_task_handle);
+    }
+}
+
+/*!
+ * @brief  Free every cached image
+ */
+void smile_images_release(void) {
+    xSemaphoreTake(smile_lock, portMAX_DELAY);
+    for (int i = 0; i < SMILE_CACHE_ENTRIES; i++) {
+        if (smile_entries[i].dsc.data != NULL) {
+            smile_drop(&smile_entries[i]);
+        }
+    }
+    smile_shown = -1;
+    smile_last_shown = -1;
+    smile_target = -1;
+    smile_waiting = false;
+    xSemaphoreGive(smile_lock);
+
+    smile_images_report();
+}
+
+/*!
+ * @brief  Log hit rate, switch latency and resident bytes
+ */
+void smile_images_report(void) {
+    xSemaphoreTake(smile_lock, portMAX_DELAY);
+    uint32_t hits = smile_hits;
+    uint32_t total = smile_hits + smile_misses;
+    uint32_t switches = smile_switches;
+    uint32_t average_ms = switches ? smile_switch_total_ms / switches : 0;
+    uint32_t max_ms = smile_switch_max_ms;
+    size_t resident = smile_resident;
+    xSemaphoreGive(smile_lock);
+
+    Serial.printf("Smile cache: %u hits %u misses (%u%%), %u switches avg %u ms max %u ms, %u of %u bytes resident\r\n",
+                  hits, total - hits, total ? hits * 100 / total : 0, switches, average_ms, max_ms,
+                  resident, smile_cache_bytes);
+}
@@ -0,0 +1,115 @@
+/*
+ *  smile_images.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef __SMILE_IMAGES_HPP_
+#define __SMILE_IMAGES_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* LVGL binary images, looked up on SD first and in SPIFFS otherwise */
+#define SMILE_DIR "/smiles"
+#define SMILE_IMAGES_MAX 64
+#define SMILE_NAME_MAX 32
+
+/* Image bytes kept in RAM, the image shown and next to the requested one are kept first.
+ * Raised at start to twice the largest image, larger images are skipped. */
+#ifndef SMILE_CACHE_BYTES
+#define SMILE_CACHE_BYTES (128 * 1024)
+#endif
+
+/* Number of images kept: the one shown and two prefetch slots, next and
+ * previous. The image shown before is kept too while it is drawn, going
+ * forward it is the previous one. */
+#ifndef SMILE_CACHE_ENTRIES
+#define SMILE_CACHE_ENTRIES 3
+#endif
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  List the images of the smiles directory in natural order and start
+ *         the prefetch task. The file system must be mounted.
+ * @param  None
+ * @retval Number of images found
+ */
+uint32_t smile_images_init(void);
+
+/*!
+ * @brief  Get number of images
+ * @param  None
+ * @retval Number of images
+ */
+uint32_t smile_images_count(void);
+
+/*!
+ * @brief  Ask for an image to be shown, it is read in the background with its
+ *         neighbours unless it was prefetched already
+ * @param  Image index
+ * @retval None
+ */
+void smile_images_request(uint32_t index);
+
+/*!
+ * @brief  Take an image to show if it is in RAM, never waits for a read.
+ *         The image and the one taken before it stay in RAM until another
+ *         one is taken, a settle or a release.
+ * @param  Image index
+ * @retval Image descriptor or NULL if it is not read yet
+ */
+const lv_img_dsc_t *smile_images_take(uint32_t index);
+
+/*!
+ * @brief  Let the image taken before the one shown be dropped, once it is no
+ *         longer drawn. A requested image waiting for its room is read then.
+ * @param  None
+ * @retval None
+ */
+void smile_images_settle(void);
+
+/*!
+ * @brief  Free every cached image, no image returned before may be drawn after
+ * @param  None
+ * @retval None
+ */
+void smile_images_release(void);
+
+/*!
+ * @brief  Log hit rate, switch latency and resident bytes
+ * @param  None
+ * @retval None
+ */
+void smile_images_report(void);
+
+/******************************************************************************/
+
+#endif /* __SMILE_IMAGES_HPP_ */
@@ -0,0 +1,55 @@
+/*
+ *  smile_manifest.hpp
+ *
+ *  Generated by tools/smile_assets.py, do not edit.
+ */
+
+#ifndef __SMILE_MANIFEST_HPP_
+#define __SMILE_MANIFEST_HPP_
+
+#include <stdint.h>
+
+/* Slideshow images of the file system image, data bytes without the LVGL header */
+typedef struct {
+    const char *name;
+    uint16_t w;
+    uint16_t h;
+    uint16_t colors;
+    uint8_t bits;
+    uint32_t size;
+} smile_manifest_t;
+
+constexpr smile_manifest_t smile_manifest[] = {
+    { "image1.bin", 320, 210, 254, 8, 28909 },
+    { "image2.bin", 320, 210, 241, 8, 27175 },
+    { "image3.bin", 320, 210, 235, 8, 15480 },
+    { "image4.bin", 320, 210, 250, 8, 27345 },
+    { "image5.bin", 320, 210, 239, 8, 23635 },
+    { "image6.bin", 320, 210, 238, 8, 22067 },
+    { "image7.bin", 320, 210, 254, 8, 26474 },
+    { "image8.bin", 320, 210, 253, 8, 33688 },
+    { "image9.bin", 320, 210, 253, 8, 31058 },
+    { "image10.bin", 320, 210, 251, 8, 33886 },
+    { "image11.bin", 320, 210, 254, 8, 33791 },
+    { "image12.bin", 320, 210, 248, 8, 27438 },
+    { "image13.bin", 320, 210, 255, 8, 26817 },
+    { "image14.bin", 320, 210, 254, 8, 29270 },
+    { "image15.bin", 320, 210, 255, 8, 40939 },
+    { "image16.bin", 320, 210, 255, 8, 34247 },
+    { "image17.bin", 320, 210, 256, 8, 34413 },
+    { "image18.bin", 320, 210, 254, 8, 38386 },
+    { "image19.bin", 320, 210, 245, 8, 36454 },
+    { "image20.bin", 320, 210, 253, 8, 28426 },
+    { "image21.bin", 320, 210, 255, 8, 35166 },
+    { "image22.bin", 184, 208, 240, 8, 17537 },
+    { "image23.bin", 207, 207, 255, 8, 21893 },
+    { "image24.bin", 312, 208, 253, 8, 27282 },
+    { "image25.bin", 320, 203, 254, 8, 33318 },
+    { "image26.bin", 256, 208, 254, 8, 35007 },
+};
+
+constexpr uint32_t SMILE_MANIFEST_COUNT = 26;
+constexpr uint32_t SMILE_MANIFEST_MAX_SIZE = 40939;
+constexpr uint32_t SMILE_MANIFEST_TOTAL_SIZE = 770101;
+
+#endif /* __SMILE_MANIFEST_HPP_ */
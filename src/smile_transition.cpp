@@ -0,0 +1,337 @@
+/*
+ *  smile_transition.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "smile_transition.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define TRANSITION_ONE 1024          /* Progress of a finished transition */
+#define TRANSITION_COLS ((LV_HOR_RES_MAX + SMILE_TRANSITION_TILE - 1) / SMILE_TRANSITION_TILE)
+#define TRANSITION_ROWS ((LV_VER_RES_MAX + SMILE_TRANSITION_TILE - 1) / SMILE_TRANSITION_TILE)
+#define TRANSITION_TILES (TRANSITION_COLS * TRANSITION_ROWS)
+
+/* Tiles are ranked over the largest grid, so every tile is shown at the end
+ * whatever the object size. Beyond this many per frame the whole area is
+ * invalidated at once. */
+#define TRANSITION_TILE_AREAS 16
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static lv_obj_t *transition_obj = NULL;
+static lv_timer_t *transition_timer = NULL;
+static const lv_img_dsc_t *transition_from = NULL;
+static const lv_img_dsc_t *transition_to = NULL;
+static bool transition_forward = true;
+static uint32_t transition_start_ms = 0;
+static uint32_t transition_progress = TRANSITION_ONE;    /* Of the last frame drawn */
+static uint8_t transition_rank[TRANSITION_TILES];        /* Order in which dissolve tiles appear */
+
+/* Statistics of the running transition */
+static uint32_t transition_frames = 0;
+static uint32_t transition_cost_us = 0;
+static uint32_t transition_max_us = 0;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static void transition_draw_cb(lv_event_t *e);
+static void transition_frame_cb(lv_timer_t *timer);
+
+/******************************************************************************/
+
+/*!
+ * @brief  Tiles of the object area in columns and rows
+ */
+static void transition_grid(const lv_area_t *area, uint32_t *cols, uint32_t *rows) {
+    *cols = (lv_area_get_width(area) + SMILE_TRANSITION_TILE - 1) / SMILE_TRANSITION_TILE;
+    *rows = (lv_area_get_height(area) + SMILE_TRANSITION_TILE - 1) / SMILE_TRANSITION_TILE;
+}
+
+/*!
+ * @brief  Screen area of a tile, clipped to the object area
+ */
+static void transition_tile_area(const lv_area_t *area, uint32_t cols, uint32_t tile, lv_area_t *out) {
+    out->x1 = area->x1 + (tile % cols) * SMILE_TRANSITION_TILE;
+    out->y1 = area->y1 + (tile / cols) * SMILE_TRANSITION_TILE;
+    out->x2 = LV_MIN(out->x1 + SMILE_TRANSITION_TILE - 1, area->x2);
+    out->y2 = LV_MIN(out->y1 + SMILE_TRANSITION_TILE - 1, area->y2);
+}
+
+/*!
+ * @brief  Draw an image aligned to the bottom middle and moved by dx, only
+ *         within region. Without an image the background shows through.
+ */
+static void transition_draw(lv_draw_ctx_t *draw_ctx, const lv_area_t *area, const lv_img_dsc_t *image,
+                            lv_coord_t dx, const lv_area_t *region) {
+    lv_area_t coords;
+    lv_area_t clip;
+
+    if ((image == NULL) || !_lv_area_intersect(&clip, region, draw_ctx->clip_area)) {
+        return;
+    }
+
+    coords.x1 = area->x1 + (lv_area_get_width(area) - (lv_coord_t)image->header.w) / 2 + dx;
+    coords.y1 = area->y2 + 1 - image->header.h;
+    coords.x2 = coords.x1 + image->header.w - 1;
+    coords.y2 = area->y2;
+
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+    const lv_area_t *clip_ori = draw_ctx->clip_area;
+    draw_ctx->clip_area = &clip;
+    lv_draw_img(draw_ctx, &dsc, &coords, image);
+    draw_ctx->clip_area = clip_ori;
+}
+
+/*!
+ * @brief  Draw the part of the frame LVGL asks for, each pixel from one image only
+ */
+static void transition_draw_cb(lv_event_t *e) {
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    uint32_t progress = transition_progress;
+    lv_area_t area;
+    lv_area_t region;
+
+    lv_obj_get_coords(transition_obj, &area);
+    lv_coord_t w = lv_area_get_width(&area);
+
+    if ((progress >= TRANSITION_ONE) || (SMILE_TRANSITION == SMILE_TRANSITION_NONE)) {
+        transition_draw(draw_ctx, &area, transition_to, 0, &area);
+        return;
+    }
+
+    switch (SMILE_TRANSITION) {
+        case SMILE_TRANSITION_SLIDE: {
+            /* The new image pushes the old one out, both move by the same offset */
+            lv_coord_t offset = progress * w / TRANSITION_ONE;
+            lv_coord_t dir = transition_forward ? -1 : 1;
+            transition_draw(draw_ctx, &area, transition_from, dir * offset, &area);
+            transition_draw(draw_ctx, &area, transition_to, dir * (offset - w), &area);
+            break;
+        }
+
+        case SMILE_TRANSITION_WIPE: {
+            lv_coord_t edge = progress * w / TRANSITION_ONE;
+            region = area;
+            if (transition_forward) {
+                region.x2 = area.x1 + edge - 1;
+                transition_draw(draw_ctx, &area, transition_to, 0, &region);
+                region.x1 = area.x1 + edge;
+                region.x2 = area.x2;
+            }
+            else {
+                region.x1 = area.x2 - edge + 1;
+                transition_draw(draw_ctx, &area, transition_to, 0, &region);
+                region.x1 = area.x1;
+                region.x2 = area.x2 - edge;
+            }
+            transition_draw(draw_ctx, &area, transition_from, 0, &region);
+            break;
+        }
+
+        case SMILE_TRANSITION_DISSOLVE: {
+            uint32_t cols;
+            uint32_t rows;
+            transition_grid(&area, &cols, &rows);
+            uint32_t shown = progress * TRANSITION_TILES / TRANSITION_ONE;
+            for (uint32_t tile = 0; tile < cols * rows; tile++) {
+                transition_tile_area(&area, cols, tile, &region);
+                if (_lv_area_is_on(&region, draw_ctx->clip_area)) {
+                    const lv_img_dsc_t *image = (transition_rank[tile] < shown) ? transition_to : transition_from;
+                    transition_draw(draw_ctx, &area, image, 0, &region);
+                }
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+/*!
+ * @brief  Invalidate what changes between two progress values and nothing else
+ */
+static void transition_invalidate(uint32_t from, uint32_t to) {
+    lv_area_t area;
+    lv_area_t region;
+
+    if (from == to) {
+        return;
+    }
+
+    lv_obj_get_coords(transition_obj, &area);
+    lv_coord_t w = lv_area_get_width(&area);
+
+    switch (SMILE_TRANSITION) {
+        case SMILE_TRANSITION_WIPE: {
+            lv_coord_t edge_from = from * w / TRANSITION_ONE;
+            lv_coord_t edge_to = to * w / TRANSITION_ONE;
+            if (edge_from == edge_to) {
+                return;
+            }
+            region = area;
+            region.x1 = transition_forward ? area.x1 + edge_from : area.x2 - edge_to + 1;
+            region.x2 = transition_forward ? area.x1 + edge_to - 1 : area.x2 - edge_from;
+            lv_obj_invalidate_area(transition_obj, &region);
+            break;
+        }
+
+        case SMILE_TRANSITION_DISSOLVE: {
+            uint32_t cols;
+            uint32_t rows;
+            transition_grid(&area, &cols, &rows);
+            uint32_t shown_from = from * TRANSITION_TILES / TRANSITION_ONE;
+            uint32_t shown_to = to * TRANSITION_TILES / TRANSITION_ONE;
+            if (shown_to - shown_from > TRANSITION_TILE_AREAS) {
+                lv_obj_invalidate(transition_obj);
+                break;
+            }
+            for (uint32_t tile = 0; tile < cols * rows; tile++) {
+                if ((transition_rank[tile] >= shown_from) && (transition_rank[tile] < shown_to)) {
+                    transition_tile_area(&area, cols, tile, &region);
+                    lv_obj_invalidate_area(transition_obj, &region);
+                }
+            }
+            break;
+        }
+
+        case SMILE_TRANSITION_SLIDE:
+        default:
+            lv_obj_invalidate(transition_obj);
+            break;
+    }
+}
+
+/*!
+ * @brief  Draw the next frame where the clock says the transition should be,
+ *         frames are dropped when they cost more than the budget
+ */
+static void transition_frame_cb(lv_timer_t *timer) {
+    uint32_t start_us = micros();
+    uint32_t elapsed = lv_tick_elaps(transition_start_ms);
+    uint32_t progress = (elapsed >= SMILE_TRANSITION_MS) ? TRANSITION_ONE : elapsed * TRANSITION_ONE / SMILE_TRANSITION_MS;
+
+    transition_invalidate(transition_progress, progress);
+    transition_progress = progress;
+    lv_refr_now(NULL);
+
+    uint32_t cost = micros() - start_us;
+    transition_frames++;
+    transition_cost_us += cost;
+    if (cost > transition_max_us) {
+        transition_max_us = cost;
+    }
+
+    uint32_t period = cost / (SMILE_TRANSITION_BUDGET * 10);
+    lv_timer_set_period(timer, (period > SMILE_TRANSITION_FRAME_MS) ? period : SMILE_TRANSITION_FRAME_MS);
+
+    if (progress >= TRANSITION_ONE) {
+        lv_timer_pause(timer);
+        Serial.printf("Transition: %u frames in %u ms (%u fps), %u us avg %u us max per frame\r\n",
+                      transition_frames, elapsed, elapsed ? transition_frames * 1000 / elapsed : 0,
+                      transition_cost_us / transition_frames, transition_max_us);
+    }
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Create the object drawing the slideshow
+ */
+lv_obj_t *smile_transition_create(lv_obj_t *parent) {
+    transition_obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(transition_obj);
+    lv_obj_set_size(transition_obj, LV_PCT(100), LV_PCT(100));
+    lv_obj_clear_flag(transition_obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(transition_obj, transition_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    /* Dissolve order, shuffled once so tiles appear scattered */
+    uint32_t seed = 0x2545F491;
+    for (uint32_t i = 0; i < TRANSITION_TILES; i++) {
+        transition_rank[i] = i;
+    }
+    for (uint32_t i = TRANSITION_TILES - 1; i > 0; i--) {
+        seed = seed * 1664525 + 1013904223;
+        uint32_t j = (seed >> 8) % (i + 1);
+        uint8_t rank = transition_rank[i];
+        transition_rank[i] = transition_rank[j];
+        transition_rank[j] = rank;
+    }
+
+    transition_timer = lv_timer_create(transition_frame_cb, SMILE_TRANSITION_FRAME_MS, NULL);
+    lv_timer_pause(transition_timer);
+    return transition_obj;
+}
+
+/*!
+ * @brief  Move from the image shown to another one
+ */
+void smile_transition_start(const lv_img_dsc_t *image, bool forward) {
+    if (image == transition_to) {
+        return;
+    }
+
+    transition_from = transition_to;
+    transition_to = image;
+    transition_forward = forward;
+
+    if (SMILE_TRANSITION == SMILE_TRANSITION_NONE) {
+        transition_progress = TRANSITION_ONE;
+        lv_obj_invalidate(transition_obj);
+        return;
+    }
+
+    /* A running transition jumps to its end, the new one starts from there */
+    if (transition_progress < TRANSITION_ONE) {
+        lv_obj_invalidate(transition_obj);
+    }
+    transition_progress = 0;
+    transition_start_ms = lv_tick_get();
+    transition_frames = 0;
+    transition_cost_us = 0;
+    transition_max_us = 0;
+    lv_timer_set_period(transition_timer, SMILE_TRANSITION_FRAME_MS);
+    lv_timer_resume(transition_timer);
+    lv_timer_ready(transition_timer);
+}
+
+/*!
+ * @brief  Check if a transition is running
+ */
+bool smile_transition_running(void) {
+    return transition_progress < TRANSITION_ONE;
+}
+
+/*!
+ * @brief  Stop drawing any image
+ */
+void smile_transition_clear(void) {
+    lv_timer_pause(transition_timer);
+    transition_from = NULL;
+    transition_to = NULL;
+    transition_progress = TRANSITION_ONE;
+    lv_obj_invalidate(transition_obj);
+}
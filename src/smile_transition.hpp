@@ -0,0 +1,100 @@
+/*
+ *  smile_transition.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef __SMILE_TRANSITION_HPP_
+#define __SMILE_TRANSITION_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+enum {
+    SMILE_TRANSITION_NONE = 0,
+    SMILE_TRANSITION_SLIDE,          /* Whole area moves, every pixel is sent each frame */
+    SMILE_TRANSITION_WIPE,           /* Only the strip the edge crossed is sent */
+    SMILE_TRANSITION_DISSOLVE,       /* Only the tiles revealed are sent */
+};
+
+/* Transition between slideshow images and its length */
+#ifndef SMILE_TRANSITION
+#define SMILE_TRANSITION SMILE_TRANSITION_SLIDE
+#endif
+#ifndef SMILE_TRANSITION_MS
+#define SMILE_TRANSITION_MS 400
+#endif
+
+/* Frame period aimed at, stretched while frames cost more than the budget */
+#ifndef SMILE_TRANSITION_FRAME_MS
+#define SMILE_TRANSITION_FRAME_MS 33
+#endif
+#ifndef SMILE_TRANSITION_BUDGET
+#define SMILE_TRANSITION_BUDGET 75   /* Percent of the GUI core for rendering and flushing */
+#endif
+
+/* Dissolve tile side in pixels */
+#define SMILE_TRANSITION_TILE 32
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Create the object drawing the slideshow, it fills its parent and
+ *         shows images aligned to its bottom middle. Call from the GUI task.
+ * @param  Parent object
+ * @retval Object
+ */
+lv_obj_t *smile_transition_create(lv_obj_t *parent);
+
+/*!
+ * @brief  Move from the image shown to another one. A transition still
+ *         running is cut short and the new one starts from its target.
+ *         Both images must stay valid until the next start or a clear.
+ * @param  Image to show, and true when going to the next image
+ * @retval None
+ */
+void smile_transition_start(const lv_img_dsc_t *image, bool forward);
+
+/*!
+ * @brief  Check if a transition is running, the image shown before is drawn until it ends
+ * @param  None
+ * @retval True while running
+ */
+bool smile_transition_running(void);
+
+/*!
+ * @brief  Stop drawing any image, before their memory is released
+ * @param  None
+ * @retval None
+ */
+void smile_transition_clear(void);
+
+/******************************************************************************/
+
+#endif /* __SMILE_TRANSITION_HPP_ */
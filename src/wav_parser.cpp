@@ -0,0 +1,333 @@
+/*
+ *  wav_parser.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "wav_parser.hpp"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+enum {
+    ST_RIFF = 0,                 /* Collecting "RIFF" size "WAVE" */
+    ST_CHUNK,                    /* Collecting a chunk header */
+    ST_FMT,                      /* Collecting the fmt chunk */
+    ST_FACT,                     /* Collecting the fact chunk */
+    ST_SKIP,                     /* Discarding chunk payload and padding */
+    ST_DONE,
+    ST_ERROR,
+};
+
+#define MAX_CHANNELS 8
+#define FMT_EXTENSIBLE_LEN 40        /* fmt chunk of WAVE_FORMAT_EXTENSIBLE */
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/* KSDATAFORMAT_SUBTYPE_xxx GUID after the leading format tag */
+static const uint8_t subformat_guid_tail[14] = {
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71
+};
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+const int16_t wav_ms_adpcm_coefs[WAV_MS_ADPCM_COEFS][2] = {
+    { 256, 0 }, { 512, -256 }, { 0, 0 }, { 192, 64 }, { 240, 0 }, { 460, -208 }, { 392, -232 }
+};
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static inline uint16_t rd16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/*!
+ * @brief  Start collecting a fixed number of bytes
+ */
+static void parser_collect(wav_parser_t *parser, uint8_t state, uint8_t want) {
+    parser->state = state;
+    parser->buf_len = 0;
+    parser->buf_want = want;
+}
+
+/*!
+ * @brief  Check the block layout of an ADPCM fmt chunk, decoders rely on it
+ */
+static bool parser_parse_adpcm(wav_parser_t *parser) {
+    const uint8_t *fmt = parser->buf;
+    wav_info_t *info = &parser->info;
+    uint32_t channels = info->channels;
+    uint32_t align = info->block_align;
+
+    /* Only the plain tags, WAVE_FORMAT_EXTENSIBLE has no samples per block */
+    if ((rd16(fmt + 0) != info->format) || (parser->buf_len < 20) || (rd16(fmt + 16) < 2) || (info->bits != 4)) {
+        return false;
+    }
+    info->block_frames = rd16(fmt + 18);
+
+    /* IMA: a 4 byte header per channel, then 4 byte groups of 8 samples per channel */
+    if (info->format == WAV_FORMAT_IMA_ADPCM) {
+        return (align > 4 * channels) && (align % (4 * channels) == 0) &&
+               (info->block_frames == (align - 4 * channels) * 2 / channels + 1);
+    }
+
+    /* MS: a 7 byte header per channel holding two samples, then interleaved nibbles */
+    if ((align <= 7 * channels) || (info->block_frames != (align - 7 * channels) * 2 / channels + 2) ||
+        (parser->buf_len < 22 + 4 * WAV_MS_ADPCM_COEFS) || (rd16(fmt + 20) < WAV_MS_ADPCM_COEFS)) {
+        return false;
+    }
+
+    /* Every encoder writes the standard table, decoders use it directly */
+    for (int i = 0; i < WAV_MS_ADPCM_COEFS; i++) {
+        if (((int16_t)rd16(fmt + 22 + 4 * i) != wav_ms_adpcm_coefs[i][0]) ||
+            ((int16_t)rd16(fmt + 24 + 4 * i) != wav_ms_adpcm_coefs[i][1])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * @brief  Decode the collected fmt chunk
+ */
+static bool parser_parse_fmt(wav_parser_t *parser) {
+    const uint8_t *fmt = parser->buf;
+    wav_info_t *info = &parser->info;
+
+    if (parser->buf_len < 16) {
+        return false;
+    }
+
+    info->format = rd16(fmt + 0);
+    info->channels = rd16(fmt + 2);
+    info->sample_rate = rd32(fmt + 4);
+    info->byte_rate = rd32(fmt + 8);
+    info->block_align = rd16(fmt + 12);
+    info->bits = rd16(fmt + 14);
+    info->valid_bits = info->bits;
+    info->block_frames = 1;
+
+    if (info->format == WAV_FORMAT_EXTENSIBLE) {
+        if ((parser->buf_len < FMT_EXTENSIBLE_LEN) || (rd16(fmt + 16) < 22) ||
+            memcmp(fmt + 26, subformat_guid_tail, sizeof(subformat_guid_tail))) {
+            return false;
+        }
+
+        if (rd16(fmt + 18) != 0) {
+            info->valid_bits = rd16(fmt + 18);
+        }
+        info->format = rd16(fmt + 24);
+    }
+
+    if ((info->channels == 0) || (info->channels > MAX_CHANNELS) ||
+        (info->sample_rate == 0) || (info->block_align == 0) ||
+        (info->valid_bits > info->bits)) {
+        return false;
+    }
+
+    /* Uncompressed frames must be exactly channels * sample bytes */
+    if ((info->format == WAV_FORMAT_PCM) || (info->format == WAV_FORMAT_FLOAT)) {
+        if ((info->bits == 0) || (info->bits & 7) ||
+            (info->block_align != info->channels * (info->bits >> 3))) {
+            return false;
+        }
+    }
+    else if ((info->format == WAV_FORMAT_IMA_ADPCM) || (info->format == WAV_FORMAT_MS_ADPCM)) {
+        return parser_parse_adpcm(parser);
+    }
+
+    return true;
+}
+
+/*!
+ * @brief  Dispatch on a complete chunk header
+ */
+static bool parser_parse_chunk(wav_parser_t *parser) {
+    uint32_t size = rd32(parser->buf + 4);
+    uint64_t padded = (uint64_t)size + (size & 1);
+    uint64_t end = (uint64_t)parser->offset + padded;
+
+    memcpy(parser->chunk_id, parser->buf, 4);
+
+    if (!memcmp(parser->chunk_id, "data", 4)) {
+        wav_info_t *info = &parser->info;
+        if (!parser->have_fmt) {
+            return false;
+        }
+
+        /* Streamed or truncated files can declare more than the RIFF holds,
+         * a data header past its end holds nothing */
+        if (end > parser->riff_end) {
+            size = (parser->offset < parser->riff_end) ? parser->riff_end - parser->offset : 0;
+        }
+
+        info->data_offset = parser->offset;
+        info->data_size = size - size % info->block_align;
+        parser->state = ST_DONE;
+        return true;
+    }
+
+    /* Anything else must stay inside the RIFF payload */
+    if (end > parser->riff_end) {
+        return false;
+    }
+
+    if (!memcmp(parser->chunk_id, "fmt ", 4)) {
+        uint8_t want = size < WAV_FMT_MAX ? size : WAV_FMT_MAX;
+        parser->chunk_left = padded - want;
+        parser_collect(parser, ST_FMT, want);
+    }
+    else if (!memcmp(parser->chunk_id, "fact", 4) && (size >= 4)) {
+        parser->chunk_left = padded - 4;
+        parser_collect(parser, ST_FACT, 4);
+    }
+    else {
+        /* LIST, cue, id3, JUNK, PAD ... */
+        parser->chunk_left = padded;
+        parser->state = ST_SKIP;
+    }
+
+    return true;
+}
+
+/*!
+ * @brief  Act on a complete collect buffer
+ */
+static bool parser_complete(wav_parser_t *parser) {
+    switch (parser->state) {
+        case ST_RIFF: {
+            uint32_t riff_size = rd32(parser->buf + 4);
+            if (memcmp(parser->buf, "RIFF", 4) || memcmp(parser->buf + 8, "WAVE", 4)) {
+                return false;
+            }
+
+            /* Writers that stream leave the size at 0 or 0xFFFFFFFF */
+            parser->riff_end = ((riff_size < 4) || (riff_size > 0xFFFFFFFFu - 8)) ? 0xFFFFFFFFu : riff_size + 8;
+            parser_collect(parser, ST_CHUNK, 8);
+            return true;
+        }
+
+        case ST_CHUNK:
+            return parser_parse_chunk(parser);
+
+        case ST_FMT:
+            if (!parser_parse_fmt(parser)) {
+                return false;
+            }
+            parser->have_fmt = true;
+            parser->state = ST_SKIP;
+            return true;
+
+        case ST_FACT:
+            parser->info.fact_frames = rd32(parser->buf);
+            parser->state = ST_SKIP;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Reset parser to the start of a stream
+ */
+void wav_parser_init(wav_parser_t *parser) {
+    memset(parser, 0, sizeof(wav_parser_t));
+    parser_collect(parser, ST_RIFF, 12);
+}
+
+/*!
+ * @brief  Feed the next slice of the stream, of any length
+ */
+wav_parse_result_t wav_parser_feed(wav_parser_t *parser, const uint8_t *data, size_t len, size_t *consumed) {
+    size_t pos = 0;
+
+    while ((parser->state != ST_DONE) && (parser->state != ST_ERROR)) {
+        size_t n;
+
+        if (parser->state == ST_SKIP) {
+            n = len - pos;
+            if (n > parser->chunk_left) {
+                n = parser->chunk_left;
+            }
+
+            pos += n;
+            parser->offset += n;
+            parser->chunk_left -= n;
+            if (parser->chunk_left > 0) {
+                break;
+            }
+
+            parser_collect(parser, ST_CHUNK, 8);
+            continue;
+        }
+
+        n = parser->buf_want - parser->buf_len;
+        if (n > len - pos) {
+            n = len - pos;
+        }
+
+        memcpy(parser->buf + parser->buf_len, data + pos, n);
+        parser->buf_len += n;
+        parser->offset += n;
+        pos += n;
+        if (parser->buf_len < parser->buf_want) {
+            break;
+        }
+
+        if (!parser_complete(parser)) {
+            parser->state = ST_ERROR;
+        }
+    }
+
+    if (consumed != NULL) {
+        *consumed = pos;
+    }
+
+    if (parser->state == ST_DONE) {
+        return WAV_PARSE_DONE;
+    }
+
+    return (parser->state == ST_ERROR) ? WAV_PARSE_ERROR : WAV_PARSE_NEED_MORE;
+}
+
+/*!
+ * @brief  Take the bytes the parser would discard next
+ */
+uint32_t wav_parser_skip(wav_parser_t *parser, uint32_t min_len) {
+    uint32_t len = parser->chunk_left;
+
+    if ((parser->state != ST_SKIP) || (len == 0) || (len < min_len)) {
+        return 0;
+    }
+
+    parser->offset += len;
+    parser_collect(parser, ST_CHUNK, 8);
+    parser->chunk_left = 0;
+    return len;
+}
@@ -0,0 +1,134 @@
+/*
+ *  wav_parser.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef __WAV_PARSER_HPP_
+#define __WAV_PARSER_HPP_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Format tags, WAVE_FORMAT_EXTENSIBLE is resolved to its sub format */
+#define WAV_FORMAT_PCM        0x0001
+#define WAV_FORMAT_MS_ADPCM   0x0002
+#define WAV_FORMAT_FLOAT      0x0003
+#define WAV_FORMAT_IMA_ADPCM  0x0011
+#define WAV_FORMAT_FLAC       0xF1AC    /* Native FLAC file, not inside a RIFF */
+#define WAV_FORMAT_EXTENSIBLE 0xFFFE
+
+/* Bytes of the fmt chunk kept by the parser, up to the MS ADPCM coefficients */
+#define WAV_FMT_MAX 50
+
+/* Predictor pairs every MS ADPCM file declares */
+#define WAV_MS_ADPCM_COEFS 7
+
+typedef enum {
+    WAV_PARSE_NEED_MORE = 0,     /* Feed more bytes */
+    WAV_PARSE_DONE,              /* Data chunk found, info is valid */
+    WAV_PARSE_ERROR,             /* Not a usable RIFF/WAVE stream */
+} wav_parse_result_t;
+
+/* Stream description returned by the parser */
+typedef struct {
+    uint32_t sample_rate;
+    uint32_t byte_rate;
+    uint32_t data_offset;        /* File offset of the first sample */
+    uint32_t data_size;          /* Bytes of samples, whole frames only */
+    uint32_t fact_frames;        /* Frames from the fact chunk, 0 if absent */
+    uint16_t format;             /* WAV_FORMAT_xxx */
+    uint16_t channels;
+    uint16_t block_align;        /* Bytes per frame, or per compressed block */
+    uint16_t block_frames;       /* Frames per block, 1 if uncompressed */
+    uint16_t bits;               /* Container bits per sample */
+    uint16_t valid_bits;         /* Significant bits per sample */
+} wav_info_t;
+
+/* Incremental parser state, needs no allocation */
+typedef struct {
+    wav_info_t info;
+    uint32_t offset;             /* Stream bytes consumed so far */
+    uint32_t riff_end;           /* Offset just past the RIFF payload */
+    uint32_t chunk_left;         /* Bytes left to collect or skip in the current chunk */
+    uint8_t chunk_id[4];
+    uint8_t buf[WAV_FMT_MAX];    /* Collected header bytes */
+    uint8_t buf_len;
+    uint8_t buf_want;
+    uint8_t state;
+    bool have_fmt;
+} wav_parser_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/* MS ADPCM predictor coefficients, Q8 */
+extern const int16_t wav_ms_adpcm_coefs[WAV_MS_ADPCM_COEFS][2];
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Reset parser to the start of a stream
+ * @param  Parser
+ * @retval None
+ */
+void wav_parser_init(wav_parser_t *parser);
+
+/*!
+ * @brief  Feed the next slice of the stream, of any length
+ * @param  Parser, data, length and number of bytes used by the parser.
+ *         On WAV_PARSE_DONE the bytes after consumed are the first samples.
+ * @retval Parse result
+ */
+wav_parse_result_t wav_parser_feed(wav_parser_t *parser, const uint8_t *data, size_t len, size_t *consumed);
+
+/*!
+ * @brief  Take the bytes the parser would discard next so the caller can
+ *         seek over them instead of reading
+ * @param  Parser and minimum length worth a seek
+ * @retval Bytes to seek forward, 0 if below min_len
+ */
+uint32_t wav_parser_skip(wav_parser_t *parser, uint32_t min_len);
+
+/*!
+ * @brief  Frames in the data chunk, compressed streams pad their last block
+ *         and give the real length in the fact chunk
+ * @param  Stream description
+ * @retval Frame count
+ */
+static inline uint32_t wav_frames(const wav_info_t *info) {
+    if (info->block_align == 0) {
+        return 0;
+    }
+
+    uint32_t frames = info->data_size / info->block_align * info->block_frames;
+    if ((info->block_frames > 1) && (info->fact_frames > 0) && (info->fact_frames < frames)) {
+        frames = info->fact_frames;
+    }
+
+    return frames;
+}
+
+/******************************************************************************/
+
+#endif /* __WAV_PARSER_HPP_ */
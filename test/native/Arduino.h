@@ -0,0 +1,116 @@
+/*
+ *  Arduino.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  What the hardware independent modules use of the Arduino core and
+ *  FreeRTOS, for the native test environment. Tasks run to completion
+ *  when they are created, delays return at once.
+ */
+
+#ifndef _NATIVE_ARDUINO_H_
+#define _NATIVE_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <chrono>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef void *TaskHandle_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define IRAM_ATTR
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+static inline size_t strlcpy(char *dst, const char *src, size_t size) {
+    size_t len = strlen(src);
+
+    if (size > 0) {
+        size_t n = (len < size - 1) ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#endif
+
+static inline uint32_t micros(void) {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+static inline uint32_t millis(void) {
+    return micros() / 1000;
+}
+
+static inline void delay(uint32_t ms) {
+}
+
+static inline void yield(void) {
+}
+
+static inline void vTaskDelay(TickType_t ticks) {
+}
+
+static inline void vTaskDelete(TaskHandle_t task) {
+}
+
+static inline BaseType_t xTaskCreatePinnedToCore(void (*fn)(void *), const char *name, uint32_t stack, void *arg,
+                                                 UBaseType_t priority, TaskHandle_t *handle, BaseType_t core) {
+    fn(arg);
+    return pdPASS;
+}
+
+/* Logging is quiet unless a test wants to see it */
+class HardwareSerial {
+public:
+    bool echo = false;
+
+    int printf(const char *format, ...) {
+        va_list args;
+        va_start(args, format);
+        int len = echo ? vprintf(format, args) : 0;
+        va_end(args);
+        return len;
+    }
+
+    void println(const char *text = "") {
+        if (echo) {
+            puts(text);
+        }
+    }
+};
+
+inline HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getCycleCount(void) {
+        return micros() * 240;
+    }
+
+    uint32_t getFreeHeap(void) {
+        return 0;
+    }
+
+    uint32_t getMinFreeHeap(void) {
+        return 0;
+    }
+};
+
+inline EspClass ESP;
+
+#endif /* _NATIVE_ARDUINO_H_ */
@@ -0,0 +1,193 @@
+/*
+ *  FS.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  In-memory file system for the native test environment. Files live in
+ *  native_files by full path, a directory is every path below it. The
+ *  calls a card would serve are counted in native_fs_stats.
+ */
+
+#ifndef _NATIVE_FS_H_
+#define _NATIVE_FS_H_
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+
+enum SeekMode {
+    SeekSet = 0,
+    SeekCur,
+    SeekEnd,
+};
+
+typedef struct {
+    uint32_t opens;
+    uint32_t dir_entries;        /* Entries returned by openNextFile() */
+    uint32_t reads;
+    uint64_t read_bytes;
+    uint32_t seeks;
+    uint64_t write_bytes;
+} native_fs_stats_t;
+
+inline std::map<std::string, std::vector<uint8_t>> native_files;
+inline native_fs_stats_t native_fs_stats;
+
+class File {
+public:
+    File() {}
+
+    File(const std::string &path, bool dir) : path_(path), open_(true), dir_(dir) {
+        next_ = native_files.lower_bound(path + "/");
+    }
+
+    operator bool() const {
+        return open_;
+    }
+
+    bool isDirectory(void) {
+        return dir_;
+    }
+
+    const char *name(void) const {
+        size_t slash = path_.rfind('/');
+        return path_.c_str() + ((slash == std::string::npos) ? 0 : slash + 1);
+    }
+
+    const char *path(void) const {
+        return path_.c_str();
+    }
+
+    size_t size(void) const {
+        return dir_ ? 0 : data().size();
+    }
+
+    size_t position(void) const {
+        return pos_;
+    }
+
+    int available(void) {
+        return size() - pos_;
+    }
+
+    size_t read(uint8_t *buf, size_t len) {
+        if (!open_ || dir_ || (pos_ >= size())) {
+            return 0;
+        }
+
+        len = (len < size() - pos_) ? len : size() - pos_;
+        memcpy(buf, data().data() + pos_, len);
+        pos_ += len;
+        native_fs_stats.reads++;
+        native_fs_stats.read_bytes += len;
+        return len;
+    }
+
+    size_t write(const uint8_t *buf, size_t len) {
+        if (!open_ || dir_) {
+            return 0;
+        }
+
+        std::vector<uint8_t> &file = native_files[path_];
+        file.insert(file.end(), buf, buf + len);
+        native_fs_stats.write_bytes += len;
+        return len;
+    }
+
+    bool seek(uint32_t offset, SeekMode mode = SeekSet) {
+        size_t base = (mode == SeekSet) ? 0 : (mode == SeekCur) ? pos_ : size();
+        if (!open_ || dir_ || (base + offset > size())) {
+            return false;
+        }
+
+        pos_ = base + offset;
+        native_fs_stats.seeks++;
+        return true;
+    }
+
+    File openNextFile(const char *mode = FILE_READ) {
+        std::string prefix = path_ + "/";
+
+        while ((next_ != native_files.end()) && !next_->first.compare(0, prefix.size(), prefix)) {
+            const std::string &path = (next_++)->first;
+            if (path.find('/', prefix.size()) == std::string::npos) {
+                native_fs_stats.dir_entries++;
+                return File(path, false);
+            }
+        }
+        return File();
+    }
+
+    void flush(void) {
+    }
+
+    void close(void) {
+        open_ = false;
+    }
+
+private:
+    const std::vector<uint8_t> &data(void) const {
+        static const std::vector<uint8_t> empty;
+        auto file = native_files.find(path_);
+        return (file == native_files.end()) ? empty : file->second;
+    }
+
+    std::string path_;
+    std::map<std::string, std::vector<uint8_t>>::iterator next_;
+    size_t pos_ = 0;
+    bool open_ = false;
+    bool dir_ = false;
+};
+
+class FS {
+public:
+    File open(const char *path, const char *mode = FILE_READ, bool create = false) {
+        std::string name(path);
+
+        native_fs_stats.opens++;
+        if (!strcmp(mode, FILE_WRITE)) {
+            native_files[name].clear();
+            return File(name, false);
+        }
+        if (native_files.count(name)) {
+            return File(name, false);
+        }
+
+        /* A directory exists while something is below it */
+        auto below = native_files.lower_bound(name + "/");
+        if ((below != native_files.end()) && !below->first.compare(0, name.size() + 1, name + "/")) {
+            return File(name, true);
+        }
+        return File();
+    }
+
+    bool exists(const char *path) {
+        return native_files.count(path) > 0;
+    }
+
+    bool remove(const char *path) {
+        return native_files.erase(path) > 0;
+    }
+
+    bool rename(const char *from, const char *to) {
+        auto file = native_files.find(from);
+        if (file == native_files.end()) {
+            return false;
+        }
+
+        native_files[to] = std::move(file->second);
+        native_files.erase(from);
+        return true;
+    }
+};
+
+namespace fs {
+using ::FS;
+using ::File;
+}
+
+#endif /* _NATIVE_FS_H_ */
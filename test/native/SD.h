@@ -0,0 +1,21 @@
+/*
+ *  SD.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _NATIVE_SD_H_
+#define _NATIVE_SD_H_
+
+#include <FS.h>
+
+class SDFS : public FS {
+public:
+    bool begin(void) {
+        return true;
+    }
+};
+
+inline SDFS SD;
+
+#endif /* _NATIVE_SD_H_ */
@@ -0,0 +1,195 @@
+/*
+ *  test_main.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  Block ring on the host: a producer and a consumer thread hammer it to
+ *  check the hand-over, then a simulated card with jittery read latency
+ *  feeds the speaker through the ring and, for comparison, the way audio
+ *  was played before the reader task: read a block, then queue it.
+ */
+
+#include <unity.h>
+#include <thread>
+#include "audio_normalize.hpp"
+#include "audio_ring.hpp"
+
+#define TEST_THREAD_BLOCKS 2000000
+#define TEST_SIM_BLOCKS 4000         /* About 46 s of audio */
+#define TEST_SPEAKER_QUEUE 2         /* Blocks the speaker holds, as playback_wait_slot() allows */
+#define TEST_TICK_US 100
+
+/* Simulated card: a read mostly costs a few ms, now and then the card stalls
+ * for longer than the speaker queue plays but well within the ring */
+#define TEST_READ_MIN_US 1500
+#define TEST_READ_SPAN_US 1500
+#define TEST_STALL_PERCENT 3
+#define TEST_STALL_MIN_US 20000
+#define TEST_STALL_SPAN_US 20000
+
+#define TEST_BLOCK_US ((uint64_t)(AUDIO_BLOCK_SIZE / 2) * 1000000 / AUDIO_OUTPUT_RATE)
+
+static audio_ring_t ring;
+static uint32_t test_seed;
+
+static uint32_t test_random(uint32_t range) {
+    test_seed = test_seed * 1664525 + 1013904223;
+    return (test_seed >> 8) % range;
+}
+
+/* Time the next block read takes */
+static uint32_t test_read_us(void) {
+    uint32_t us = TEST_READ_MIN_US + test_random(TEST_READ_SPAN_US);
+
+    if (test_random(100) < TEST_STALL_PERCENT) {
+        us += TEST_STALL_MIN_US + test_random(TEST_STALL_SPAN_US);
+    }
+    return us;
+}
+
+/* Speaker holding submitted blocks, each plays for one block time */
+typedef struct {
+    uint64_t end_us;             /* When the last submitted block is done */
+    uint32_t queued;
+    uint32_t underruns;
+    bool started;
+} test_speaker_t;
+
+static void speaker_submit(test_speaker_t *speaker, uint64_t now) {
+    if (speaker->end_us < now) {
+        /* Ran dry while playing */
+        if (speaker->started) {
+            speaker->underruns++;
+        }
+        speaker->end_us = now;
+    }
+    speaker->end_us += TEST_BLOCK_US;
+    speaker->queued++;
+    speaker->started = true;
+}
+
+/* Blocks still queued at now, the oldest end first */
+static uint32_t speaker_queued(const test_speaker_t *speaker, uint64_t now) {
+    if (speaker->end_us <= now) {
+        return 0;
+    }
+
+    uint32_t left = (speaker->end_us - now + TEST_BLOCK_US - 1) / TEST_BLOCK_US;
+    return (left < speaker->queued) ? left : speaker->queued;
+}
+
+void setUp(void) {
+    test_seed = 1;
+    audio_ring_init(&ring);
+}
+
+void tearDown(void) {
+}
+
+static void test_ring_threads(void) {
+    uint32_t bad = 0;
+
+    std::thread producer([] {
+        for (uint32_t seq = 0; seq < TEST_THREAD_BLOCKS; seq++) {
+            audio_block_t *block;
+            while ((block = audio_ring_write_acquire(&ring)) == NULL) {
+                std::this_thread::yield();
+            }
+            block->frame = seq;
+            memset(block->data, seq & 0xFF, 64);
+            block->data[AUDIO_BLOCK_SIZE - 1] = seq & 0xFF;
+            audio_ring_write_commit(&ring);
+        }
+    });
+
+    /* Hold up to a few blocks like the play task does while the speaker has them */
+    for (uint32_t seq = 0; seq < TEST_THREAD_BLOCKS; seq++) {
+        audio_block_t *block;
+        while ((block = audio_ring_read_acquire(&ring)) == NULL) {
+            std::this_thread::yield();
+        }
+        if ((block->frame != seq) || (block->data[0] != (seq & 0xFF)) || (block->data[63] != (seq & 0xFF)) ||
+            (block->data[AUDIO_BLOCK_SIZE - 1] != (seq & 0xFF))) {
+            bad++;
+        }
+        if (audio_ring_in_flight(&ring) > (seq % 4)) {
+            audio_ring_release(&ring);
+        }
+    }
+    producer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, bad);
+    TEST_ASSERT_EQUAL_UINT32(0, audio_ring_available(&ring));
+}
+
+static uint32_t test_play_decoupled(void) {
+    test_speaker_t speaker = { 0, 0, 0, false };
+    audio_block_t *reading = NULL;
+    uint64_t read_done = 0;
+    uint32_t produced = 0;
+    uint32_t played = 0;
+    uint32_t order_errors = 0;
+
+    for (uint64_t now = 0; played < TEST_SIM_BLOCKS; now += TEST_TICK_US) {
+        /* Reader task: fill the next free block, the read takes the card's time */
+        if ((reading != NULL) && (now >= read_done)) {
+            audio_ring_write_commit(&ring);
+            reading = NULL;
+        }
+        if ((reading == NULL) && (produced < TEST_SIM_BLOCKS) && ((reading = audio_ring_write_acquire(&ring)) != NULL)) {
+            reading->frame = produced++;
+            read_done = now + test_read_us();
+        }
+
+        /* Play task: blocks the speaker finished go back, new ones are queued */
+        speaker.queued = speaker_queued(&speaker, now);
+        while (audio_ring_in_flight(&ring) > speaker.queued) {
+            audio_ring_release(&ring);
+        }
+        audio_block_t *block;
+        while ((speaker.queued < TEST_SPEAKER_QUEUE) && ((block = audio_ring_read_acquire(&ring)) != NULL)) {
+            order_errors += (block->frame != played);
+            speaker_submit(&speaker, now);
+            played++;
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, order_errors);
+    return speaker.underruns;
+}
+
+static uint32_t test_play_inline(void) {
+    test_speaker_t speaker = { 0, 0, 0, false };
+    uint64_t now = 0;
+
+    /* Read a block, wait for a free speaker slot, queue it, all on one task */
+    for (uint32_t played = 0; played < TEST_SIM_BLOCKS; played++) {
+        now += test_read_us();
+        while ((speaker.queued = speaker_queued(&speaker, now)) >= TEST_SPEAKER_QUEUE) {
+            now += TEST_TICK_US;
+        }
+        speaker_submit(&speaker, now);
+    }
+
+    return speaker.underruns;
+}
+
+static void test_ring_jitter(void) {
+    uint32_t decoupled = test_play_decoupled();
+    test_seed = 1;
+    uint32_t inline_reads = test_play_inline();
+
+    char line[100];
+    snprintf(line, sizeof(line), "underruns over %u blocks: %u through the ring, %u reading inline",
+             TEST_SIM_BLOCKS, (unsigned)decoupled, (unsigned)inline_reads);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_EQUAL_UINT32(0, decoupled);
+    TEST_ASSERT_TRUE(inline_reads > 0);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_ring_threads);
+    RUN_TEST(test_ring_jitter);
+    return UNITY_END();
+}
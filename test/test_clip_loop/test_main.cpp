@@ -0,0 +1,162 @@
+/*
+ *  test_main.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  Looping clips on the host: a clip is cached from the card once, then
+ *  the mixer loops it across many blocks. The output must repeat the clip
+ *  sample for sample, with no step at the seam larger than the clip's own.
+ */
+
+#include <unity.h>
+#include <math.h>
+#include <vector>
+#include <SD.h>
+#include "audio_mixer.hpp"
+#include "clip_cache.hpp"
+
+#define TEST_BLOCKS 200
+#define TEST_BLOCK_FRAMES (AUDIO_BLOCK_SIZE / 2)
+
+static std::vector<int16_t> output;
+
+static void put16(std::vector<uint8_t> *out, uint32_t value) {
+    out->push_back(value);
+    out->push_back(value >> 8);
+}
+
+static void put32(std::vector<uint8_t> *out, uint32_t value) {
+    put16(out, value);
+    put16(out, value >> 16);
+}
+
+/* WAV file holding whole periods of a sine, so the loop itself is seamless */
+static void test_make_clip(const char *path, uint32_t rate, uint32_t frames, uint32_t periods, uint16_t channels, uint16_t bits) {
+    std::vector<uint8_t> wav;
+    uint32_t align = channels * (bits >> 3);
+
+    wav.insert(wav.end(), { 'R', 'I', 'F', 'F' });
+    put32(&wav, 36 + frames * align);
+    wav.insert(wav.end(), { 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ' });
+    put32(&wav, 16);
+    put16(&wav, WAV_FORMAT_PCM);
+    put16(&wav, channels);
+    put32(&wav, rate);
+    put32(&wav, rate * align);
+    put16(&wav, align);
+    put16(&wav, bits);
+    wav.insert(wav.end(), { 'd', 'a', 't', 'a' });
+    put32(&wav, frames * align);
+
+    for (uint32_t i = 0; i < frames; i++) {
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            double value = sin(2 * M_PI * periods * i / frames + ch);
+            if (bits == 16) {
+                put16(&wav, (int16_t)lrint(value * 20000));
+            }
+            else {
+                wav.push_back(128 + lrint(value * 100));
+            }
+        }
+    }
+    native_files[path] = wav;
+}
+
+/* Loop a clip through the mixer into silent 16-bit mono blocks */
+static void test_render(const audio_clip_t *clip) {
+    audio_block_t block;
+
+    output.clear();
+    TEST_ASSERT_TRUE(audio_mixer_play(clip, AUDIO_MIXER_UNITY, true) >= 0);
+    for (uint32_t n = 0; n < TEST_BLOCKS; n++) {
+        memset(block.data, 0, AUDIO_BLOCK_SIZE);
+        block.len = AUDIO_BLOCK_SIZE;
+        block.sample_rate = AUDIO_MIXER_RATE;
+        block.channels = 1;
+        block.bits = 16;
+        audio_mixer_render(&block);
+        output.insert(output.end(), (int16_t *)block.data, (int16_t *)block.data + TEST_BLOCK_FRAMES);
+    }
+    audio_mixer_stop_clip(clip);
+}
+
+/* Largest step between neighbours, at the seams and elsewhere */
+static void test_steps(uint32_t period, int32_t *seam, int32_t *inside) {
+    *seam = 0;
+    *inside = 0;
+    for (size_t i = 1; i < output.size(); i++) {
+        int32_t step = abs(output[i] - output[i - 1]);
+        int32_t *max = (i % period == 0) ? seam : inside;
+        *max = (step > *max) ? step : *max;
+    }
+}
+
+void setUp(void) {
+    native_files.clear();
+}
+
+void tearDown(void) {
+}
+
+static void test_loop_cached(void) {
+    test_make_clip("/loop.wav", AUDIO_MIXER_RATE, 1000, 10, 1, 16);
+
+    const audio_clip_t *clip = clip_cache_get("/loop.wav");
+    TEST_ASSERT_NOT_NULL(clip);
+    TEST_ASSERT_EQUAL_UINT32(1000, clip->frames);
+
+    /* Replays come from RAM */
+    memset(&native_fs_stats, 0, sizeof(native_fs_stats));
+    TEST_ASSERT_TRUE(clip_cache_get("/loop.wav") == clip);
+    TEST_ASSERT_EQUAL_UINT32(0, native_fs_stats.opens);
+
+    /* At the clip's rate the output is the clip, over and over */
+    test_render(clip);
+    const int16_t *samples = (const int16_t *)clip->data;
+    for (size_t i = 0; i < output.size(); i++) {
+        TEST_ASSERT_EQUAL_INT16(samples[i % clip->frames], output[i]);
+    }
+}
+
+static void test_loop_resampled(void) {
+    test_make_clip("/half.wav", AUDIO_MIXER_RATE / 2, 500, 5, 1, 16);
+    const audio_clip_t *clip = clip_cache_get("/half.wav");
+    TEST_ASSERT_NOT_NULL(clip);
+
+    /* The last frame interpolates into the first, every loop lands on the same phase */
+    test_render(clip);
+    for (size_t i = 1000; i < output.size(); i++) {
+        TEST_ASSERT_EQUAL_INT16(output[i - 1000], output[i]);
+    }
+
+    int32_t seam, inside;
+    test_steps(1000, &seam, &inside);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(inside, seam);
+}
+
+static void test_loop_8bit_stereo(void) {
+    test_make_clip("/stereo8.wav", AUDIO_MIXER_RATE, 441, 3, 2, 8);
+    const audio_clip_t *clip = clip_cache_get("/stereo8.wav");
+    TEST_ASSERT_NOT_NULL(clip);
+
+    /* Both channels are averaged into the mono block */
+    test_render(clip);
+    for (size_t i = 0; i < output.size(); i++) {
+        uint32_t frame = i % clip->frames;
+        int32_t left = ((int32_t)clip->data[2 * frame] - 128) << 8;
+        int32_t right = ((int32_t)clip->data[2 * frame + 1] - 128) << 8;
+        TEST_ASSERT_EQUAL_INT16((left + right) >> 1, output[i]);
+    }
+
+    int32_t seam, inside;
+    test_steps(clip->frames, &seam, &inside);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(inside, seam);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_loop_cached);
+    RUN_TEST(test_loop_resampled);
+    RUN_TEST(test_loop_8bit_stereo);
+    return UNITY_END();
+}
@@ -0,0 +1,184 @@
+/*
+ *  test_main.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  Crossfade on the host: a fade of the current track into the next is
+ *  rendered block by block. The gains must run from one track to the other
+ *  without a step back, hold the sum of their powers, and the mix must not
+ *  depend on how the fade is split into blocks.
+ */
+
+#include <unity.h>
+#include <math.h>
+#include <vector>
+#include "audio_crossfade.hpp"
+
+#define TEST_BLOCK_FRAMES 512
+#define TEST_LEVEL 16000
+#define TEST_FULL 32767
+
+static uint32_t test_seed = 1;
+
+static uint32_t test_random(void) {
+    test_seed = test_seed * 1664525 + 1013904223;
+    return test_seed >> 8;
+}
+
+/* Render a fade of len frames between two constant tracks, blocks of random length */
+static std::vector<int16_t> test_render(uint32_t len, uint32_t frames, int16_t current, int16_t next,
+                                        int32_t current_scale, int32_t next_scale, bool random_blocks) {
+    audio_crossfade_t fade = { len, 0 };
+    std::vector<int16_t> output;
+    std::vector<int16_t> in;
+
+    while (output.size() < frames) {
+        uint32_t count = random_blocks ? 1 + test_random() % TEST_BLOCK_FRAMES : TEST_BLOCK_FRAMES;
+        if (count > frames - output.size()) {
+            count = frames - output.size();
+        }
+        std::vector<int16_t> out(count, current);
+        in.assign(count, next);
+        TEST_ASSERT_EQUAL_UINT32(count, audio_crossfade_mix(&fade, out.data(), count, current_scale,
+                                                            in.data(), count, next_scale));
+        output.insert(output.end(), out.begin(), out.end());
+    }
+    return output;
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/* Gains of the whole fade: endpoints, direction and equal power */
+static void test_gain_curve(void) {
+    const uint32_t lengths[] = { 1, 2, 7, 256, 441, 4410, 88200 };
+
+    for (uint32_t len : lengths) {
+        int32_t last_out = TEST_FULL + 1;
+        int32_t last_in = -1;
+
+        for (uint32_t pos = 0; pos < len; pos++) {
+            int32_t out_gain, in_gain;
+            audio_crossfade_gains(pos, len, &out_gain, &in_gain);
+
+            if (pos == 0) {
+                TEST_ASSERT_EQUAL_INT32(TEST_FULL, out_gain);
+                TEST_ASSERT_EQUAL_INT32(0, in_gain);
+            }
+            TEST_ASSERT_LESS_OR_EQUAL_INT32(last_out, out_gain);
+            TEST_ASSERT_GREATER_OR_EQUAL_INT32(last_in, in_gain);
+            TEST_ASSERT_GREATER_OR_EQUAL_INT32(0, out_gain);
+            TEST_ASSERT_LESS_OR_EQUAL_INT32(TEST_FULL, in_gain);
+            last_out = out_gain;
+            last_in = in_gain;
+
+            /* Power of both tracks stays within 0.05 dB of one track at full gain */
+            double power = ((double)out_gain * out_gain + (double)in_gain * in_gain) / ((double)TEST_FULL * TEST_FULL);
+            TEST_ASSERT_FLOAT_WITHIN(0.012, 1.0, power);
+
+            /* The curve follows the quarter sine */
+            double expect = sin(M_PI / 2 * pos / len) * TEST_FULL;
+            TEST_ASSERT_INT32_WITHIN(2, lrint(expect), in_gain);
+        }
+
+        /* The last frame of a long fade leaves the current track all but silent */
+        if (len >= 256) {
+            int32_t out_gain, in_gain;
+            audio_crossfade_gains(len - 1, len, &out_gain, &in_gain);
+            TEST_ASSERT_LESS_OR_EQUAL_INT32(TEST_FULL * 2 / 256 + 1, out_gain);
+        }
+    }
+}
+
+/* Each track alone through the mix gives its gain, the current one is silenced after the fade */
+static void test_render_curve(void) {
+    const uint32_t len = 3000;
+    const uint32_t frames = len + 700;
+
+    std::vector<int16_t> fading_out = test_render(len, frames, TEST_LEVEL, 0, TEST_FULL + 1, TEST_FULL + 1, false);
+    std::vector<int16_t> fading_in = test_render(len, frames, 0, TEST_LEVEL, TEST_FULL + 1, TEST_FULL + 1, false);
+
+    for (uint32_t i = 0; i < frames; i++) {
+        int32_t out_gain = 0;
+        int32_t in_gain = TEST_FULL;
+        if (i < len) {
+            audio_crossfade_gains(i, len, &out_gain, &in_gain);
+        }
+        TEST_ASSERT_INT32_WITHIN(1, (TEST_LEVEL * out_gain) >> 15, fading_out[i]);
+        TEST_ASSERT_INT32_WITHIN(1, (TEST_LEVEL * in_gain) >> 15, fading_in[i]);
+
+        /* Uncorrelated tracks keep their loudness through the fade */
+        double power = ((double)fading_out[i] * fading_out[i] + (double)fading_in[i] * fading_in[i]) /
+                       ((double)TEST_LEVEL * TEST_LEVEL);
+        TEST_ASSERT_FLOAT_WITHIN(0.02, 1.0, power);
+    }
+    TEST_ASSERT_EQUAL_INT16(0, fading_out[len]);
+    TEST_ASSERT_EQUAL_INT16(0, fading_out[frames - 1]);
+}
+
+/* Splitting the fade into blocks of any length gives the same mix */
+static void test_render_blocks(void) {
+    const uint32_t len = 5000;
+    std::vector<int16_t> whole = test_render(len, len + 100, TEST_LEVEL, -TEST_LEVEL / 2, 30000, 20000, false);
+
+    for (int run = 0; run < 20; run++) {
+        std::vector<int16_t> split = test_render(len, len + 100, TEST_LEVEL, -TEST_LEVEL / 2, 30000, 20000, true);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(whole.data(), split.data(), whole.size());
+    }
+}
+
+/* Track scales, clipping and the next track outlasting the current block */
+static void test_mix_edges(void) {
+    int16_t out[TEST_BLOCK_FRAMES];
+    int16_t in[TEST_BLOCK_FRAMES];
+
+    /* Half way, two full scale tracks in phase add up past full scale and clip */
+    audio_crossfade_t fade = { 2 * TEST_BLOCK_FRAMES, TEST_BLOCK_FRAMES };
+    for (int i = 0; i < TEST_BLOCK_FRAMES; i++) {
+        out[i] = INT16_MAX;
+        in[i] = INT16_MAX;
+    }
+    audio_crossfade_mix(&fade, out, TEST_BLOCK_FRAMES, TEST_FULL + 1, in, TEST_BLOCK_FRAMES, TEST_FULL + 1);
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(2 * TEST_BLOCK_FRAMES, fade.pos);
+
+    /* The quieter track is scaled down to the shared block gain */
+    fade = { 2 * TEST_BLOCK_FRAMES, 0 };
+    for (int i = 0; i < TEST_BLOCK_FRAMES; i++) {
+        out[i] = 0;
+        in[i] = TEST_LEVEL;
+    }
+    audio_crossfade_mix(&fade, out, TEST_BLOCK_FRAMES, TEST_FULL + 1, in, TEST_BLOCK_FRAMES, 16384);
+    for (int i = 0; i < TEST_BLOCK_FRAMES; i++) {
+        int32_t out_gain, in_gain;
+        audio_crossfade_gains(i, 2 * TEST_BLOCK_FRAMES, &out_gain, &in_gain);
+        TEST_ASSERT_INT32_WITHIN(1, (TEST_LEVEL / 2 * in_gain) >> 15, out[i]);
+    }
+
+    /* The current track ends inside the block, the next plays on at full gain */
+    fade = { 4 * TEST_BLOCK_FRAMES, 0 };
+    for (int i = 0; i < TEST_BLOCK_FRAMES; i++) {
+        out[i] = TEST_LEVEL;
+        in[i] = -TEST_LEVEL;
+    }
+    uint32_t total = audio_crossfade_mix(&fade, out, 100, TEST_FULL + 1, in, TEST_BLOCK_FRAMES, TEST_FULL + 1);
+    TEST_ASSERT_EQUAL_UINT32(TEST_BLOCK_FRAMES, total);
+    TEST_ASSERT_EQUAL_UINT32(100, fade.pos);
+    for (int i = 100; i < TEST_BLOCK_FRAMES; i++) {
+        TEST_ASSERT_INT32_WITHIN(1, -TEST_LEVEL, out[i]);
+    }
+}
+
+int main(int argc, char **argv) {
+    audio_crossfade_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_gain_curve);
+    RUN_TEST(test_render_curve);
+    RUN_TEST(test_render_blocks);
+    RUN_TEST(test_mix_edges);
+    return UNITY_END();
+}
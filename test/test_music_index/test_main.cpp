@@ -0,0 +1,164 @@
+/*
+ *  test_main.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  Music index on the host: boot once without an index, which scans the
+ *  directory and parses every header, then boot again from the index the
+ *  first boot wrote. Card operations and host time of both are compared
+ *  for 100, 1,000 and 10,000 synthetic tracks.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <SD.h>
+#include "audio_reader.hpp"
+#include "music_library.hpp"
+
+#define TEST_RATE 8000
+#define TEST_FRAMES 256
+
+typedef struct {
+    native_fs_stats_t stats;
+    double ms;
+} test_cost_t;
+
+static std::chrono::steady_clock::time_point test_start;
+static test_cost_t test_build;
+static bool test_built;
+
+static double test_elapsed_ms(void) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - test_start).count();
+}
+
+static void test_begin(void) {
+    memset(&native_fs_stats, 0, sizeof(native_fs_stats));
+    test_start = std::chrono::steady_clock::now();
+}
+
+static void put16(uint8_t *p, uint32_t value) {
+    p[0] = value;
+    p[1] = value >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t value) {
+    put16(p, value);
+    put16(p + 2, value >> 16);
+}
+
+/* Short 16-bit mono tracks, names differ between runs so no record is reused */
+static void test_make_tracks(uint32_t count) {
+    std::vector<uint8_t> wav(44 + TEST_FRAMES * 2);
+
+    memcpy(&wav[0], "RIFF", 4);
+    put32(&wav[4], wav.size() - 8);
+    memcpy(&wav[8], "WAVEfmt ", 8);
+    put32(&wav[16], 16);
+    put16(&wav[20], 1);
+    put16(&wav[22], 1);
+    put32(&wav[24], TEST_RATE);
+    put32(&wav[28], TEST_RATE * 2);
+    put16(&wav[32], 2);
+    put16(&wav[34], 16);
+    memcpy(&wav[36], "data", 4);
+    put32(&wav[40], TEST_FRAMES * 2);
+    for (uint32_t i = 0; i < TEST_FRAMES; i++) {
+        put16(&wav[44 + 2 * i], (i & 16) ? 3000 : -3000);
+    }
+
+    native_files.clear();
+    for (uint32_t i = 0; i < count; i++) {
+        char path[64];
+        snprintf(path, sizeof(path), MUSIC_DIR "/n%u_track_%05u.wav", count, i);
+        native_files[path] = wav;
+    }
+}
+
+/* Refresh task callback: the first call is the rebuilt index, the audio task takes it at once */
+static void test_on_change(void) {
+    if (!test_built) {
+        test_build.stats = native_fs_stats;
+        test_build.ms = test_elapsed_ms();
+        test_built = true;
+    }
+    music_library_apply();
+}
+
+static void test_compare(uint32_t count) {
+    test_cost_t index;
+    char line[160];
+
+    test_make_tracks(count);
+
+    /* First boot, no index: the refresh task scans and parses every file */
+    test_begin();
+    test_built = false;
+    TEST_ASSERT_FALSE(music_library_load());
+    music_library_refresh(test_on_change);
+    TEST_ASSERT_TRUE(test_built);
+    TEST_ASSERT_EQUAL_UINT32(count, music_library_count());
+    TEST_ASSERT_TRUE(native_files.count(MUSIC_INDEX_PATH) > 0);
+
+    /* Second boot, one sequential read of the index */
+    test_begin();
+    TEST_ASSERT_TRUE(music_library_load());
+    index.stats = native_fs_stats;
+    index.ms = test_elapsed_ms();
+    TEST_ASSERT_EQUAL_UINT32(count, music_library_count());
+    TEST_ASSERT_EQUAL_UINT32(1, index.stats.opens);
+    TEST_ASSERT_EQUAL_UINT32(0, index.stats.dir_entries);
+    TEST_ASSERT_EQUAL_UINT32(native_files[MUSIC_INDEX_PATH].size(), index.stats.read_bytes);
+
+    char path[AUDIO_PATH_MAX];
+    snprintf(line, sizeof(line), MUSIC_DIR "/n%u_track_%05u.wav", count, count - 1);
+    TEST_ASSERT_TRUE(music_library_path(count - 1, path, sizeof(path)) > 0);
+    TEST_ASSERT_EQUAL_STRING(line, path);
+    TEST_ASSERT_EQUAL_UINT32(TEST_FRAMES * 1000 / TEST_RATE, music_library_track(count - 1)->duration_ms);
+
+    snprintf(line, sizeof(line), "%5u tracks  scan: %u opens, %u entries, %u reads, %.2f ms  index: %u open, %u reads, %u bytes, %.3f ms",
+             count, test_build.stats.opens, test_build.stats.dir_entries, test_build.stats.reads, test_build.ms,
+             index.stats.opens, index.stats.reads, (unsigned)index.stats.read_bytes, index.ms);
+    TEST_MESSAGE(line);
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+static void test_index_100(void) {
+    test_compare(100);
+}
+
+static void test_index_1000(void) {
+    test_compare(1000);
+}
+
+static void test_index_10000(void) {
+    test_compare(10000);
+}
+
+static void test_index_damaged(void) {
+    test_make_tracks(100);
+    test_built = false;
+    music_library_refresh(test_on_change);
+    TEST_ASSERT_TRUE(test_built);
+
+    /* A flipped bit fails the CRC, a short file fails the size check */
+    native_files[MUSIC_INDEX_PATH][100] ^= 0x10;
+    TEST_ASSERT_FALSE(music_library_load());
+    native_files[MUSIC_INDEX_PATH][100] ^= 0x10;
+    TEST_ASSERT_TRUE(music_library_load());
+    native_files[MUSIC_INDEX_PATH].pop_back();
+    TEST_ASSERT_FALSE(music_library_load());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_index_100);
+    RUN_TEST(test_index_1000);
+    RUN_TEST(test_index_10000);
+    RUN_TEST(test_index_damaged);
+    return UNITY_END();
+}
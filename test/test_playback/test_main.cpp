@@ -0,0 +1,269 @@
+/*
+ *  test_main.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  Pause and resume on the host: blocks go through the ring to a modelled
+ *  speaker, a pause fades out what it holds and playback resumes from the
+ *  position the cut reports. Every source frame must be heard exactly once.
+ */
+
+#include <unity.h>
+#include "app_config.hpp"
+#include "audio_ring.hpp"
+#include "audio_fade.hpp"
+
+#define TEST_LEVEL 16384             /* Stays above zero through the whole fade */
+#define TEST_IN_FLIGHT 3             /* Blocks the speaker holds at once */
+
+/* One stream played through the ring and the speaker model */
+typedef struct {
+    audio_ring_t ring;
+    uint32_t sample_rate;
+    uint32_t source_rate;
+    uint16_t speed;
+    uint16_t track_id;
+    uint32_t next;               /* Source frame the producer reads next */
+    uint32_t total;              /* Source frames of the track, the last block may pass it */
+    uint32_t now_us;
+    uint32_t end_us;             /* When the speaker runs out of submitted frames */
+    uint32_t heard;              /* Source frame after the last one heard */
+    uint32_t gaps;               /* Heard ranges not starting where the last ended */
+} test_stream_t;
+
+static test_stream_t stream;
+static uint32_t test_seed;
+
+static uint32_t test_random(uint32_t range) {
+    test_seed = test_seed * 1664525 + 1013904223;
+    return (test_seed >> 8) % range;
+}
+
+static void test_open(uint32_t sample_rate, uint32_t source_rate, uint16_t speed, uint32_t total) {
+    audio_ring_init(&stream.ring);
+    stream.sample_rate = sample_rate;
+    stream.source_rate = source_rate;
+    stream.speed = speed;
+    stream.track_id = 1;
+    stream.next = 0;
+    stream.total = total;
+    stream.now_us = 0;
+    stream.end_us = 0;
+    stream.heard = 0;
+    stream.gaps = 0;
+}
+
+static uint32_t test_frames(const audio_block_t *block) {
+    return block->len >> 1;
+}
+
+/* Fill every free block from the current source position */
+static void test_produce(void) {
+    audio_block_t *block;
+
+    while ((stream.next < stream.total) && ((block = audio_ring_write_acquire(&stream.ring)) != NULL)) {
+        int16_t *samples = (int16_t *)block->data;
+        for (uint32_t i = 0; i < (AUDIO_BLOCK_SIZE >> 1); i++) {
+            samples[i] = TEST_LEVEL;
+        }
+        block->len = AUDIO_BLOCK_SIZE;
+        block->sample_rate = stream.sample_rate;
+        block->source_rate = stream.source_rate;
+        block->speed = stream.speed;
+        block->frame = stream.next;
+        block->track_id = stream.track_id;
+        block->channels = 1;
+        block->bits = 16;
+        block->flags = 0;
+        stream.next = audio_block_frame(block, test_frames(block));
+        audio_ring_write_commit(&stream.ring);
+    }
+}
+
+/* Submit blocks back to back like the play task does, up to the speaker queue */
+static void test_submit(void) {
+    audio_block_t *block;
+
+    while ((audio_ring_in_flight(&stream.ring) < TEST_IN_FLIGHT) && ((block = audio_ring_read_acquire(&stream.ring)) != NULL)) {
+        if (block->track_id != stream.track_id) {
+            continue;
+        }
+        if ((int32_t)(stream.end_us - stream.now_us) < 0) {
+            stream.end_us = stream.now_us;
+        }
+        block->start_us = stream.end_us;
+        stream.end_us += (uint64_t)test_frames(block) * 1000000 / block->sample_rate;
+        block->submitted = true;
+    }
+}
+
+/* Account the frames of the oldest block that reached the speaker output and release it */
+static void test_release(void) {
+    audio_block_t *block = audio_ring_oldest(&stream.ring);
+    const int16_t *samples = (const int16_t *)block->data;
+    uint32_t count = 0;
+
+    if (block->submitted && (block->track_id == stream.track_id)) {
+        while ((count < test_frames(block)) && (samples[count] != 0)) {
+            count++;
+        }
+        for (uint32_t i = count; i < test_frames(block); i++) {
+            TEST_ASSERT_EQUAL_INT16(0, samples[i]);
+        }
+
+        if (count > 0) {
+            if (block->frame != stream.heard) {
+                stream.gaps++;
+            }
+            stream.heard = audio_block_frame(block, count);
+        }
+    }
+    audio_ring_release(&stream.ring);
+}
+
+/* Let time pass, blocks played to the end go back to the producer */
+static void test_advance(uint32_t us) {
+    audio_block_t *block;
+
+    stream.now_us += us;
+    while ((block = audio_ring_oldest(&stream.ring)) != NULL) {
+        uint32_t end = block->start_us + (uint64_t)test_frames(block) * 1000000 / block->sample_rate;
+        if (!block->submitted || ((int32_t)(stream.now_us - end) < 0)) {
+            break;
+        }
+        test_release();
+    }
+}
+
+/* Fade out, drop everything queued and reopen the track where the output stopped */
+static void test_pause_resume(void) {
+    audio_fade_t fade = { stream.now_us, 0, 0, false };
+    uint32_t position = audio_fade_cut(&stream.ring, stream.track_id, stream.heard, &fade);
+
+    while (audio_ring_oldest(&stream.ring) != NULL) {
+        test_release();
+    }
+    while (audio_ring_read_acquire(&stream.ring) != NULL) {
+        audio_ring_release(&stream.ring);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(stream.heard, position);
+    stream.track_id++;
+    stream.next = position;
+    stream.end_us = stream.now_us;
+}
+
+/* Play a track with pauses at random times, every frame must be heard once and in order */
+static void test_run(uint32_t pauses) {
+    uint32_t block_us = (uint64_t)(AUDIO_BLOCK_SIZE >> 1) * 1000000 / stream.sample_rate;
+
+    while ((stream.heard < stream.total) || (audio_ring_oldest(&stream.ring) != NULL)) {
+        test_produce();
+        test_submit();
+        test_advance(1 + test_random(block_us));
+        if ((pauses > 0) && (test_random(4) == 0)) {
+            test_pause_resume();
+            pauses--;
+        }
+        if ((stream.next >= stream.total) && (audio_ring_available(&stream.ring) == 0)) {
+            test_advance(block_us * TEST_IN_FLIGHT);
+            if (audio_ring_oldest(&stream.ring) == NULL) {
+                break;
+            }
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, pauses);
+    TEST_ASSERT_EQUAL_UINT32(0, stream.gaps);
+    TEST_ASSERT_EQUAL_UINT32(stream.next, stream.heard);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stream.total, stream.heard);
+}
+
+void setUp(void) {
+    test_seed = 12345;
+}
+
+void tearDown(void) {
+}
+
+static void test_ring_order(void) {
+    audio_ring_t *ring = &stream.ring;
+
+    audio_ring_init(ring);
+    TEST_ASSERT_NULL(audio_ring_read_acquire(ring));
+    for (uint32_t i = 0; i < AUDIO_RING_BLOCKS; i++) {
+        audio_block_t *block = audio_ring_write_acquire(ring);
+        TEST_ASSERT_NOT_NULL(block);
+        block->frame = i;
+        audio_ring_write_commit(ring);
+    }
+    TEST_ASSERT_NULL(audio_ring_write_acquire(ring));
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_RING_BLOCKS, audio_ring_available(ring));
+
+    for (uint32_t i = 0; i < AUDIO_RING_BLOCKS; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, audio_ring_read_acquire(ring)->frame);
+    }
+    TEST_ASSERT_EQUAL_UINT32(AUDIO_RING_BLOCKS, audio_ring_in_flight(ring));
+    TEST_ASSERT_EQUAL_UINT32(2, audio_ring_acquired(ring, 2)->frame);
+    TEST_ASSERT_NULL(audio_ring_acquired(ring, AUDIO_RING_BLOCKS));
+
+    /* Blocks go back oldest first, only then can the producer have them */
+    TEST_ASSERT_NULL(audio_ring_write_acquire(ring));
+    audio_ring_release(ring);
+    TEST_ASSERT_EQUAL_UINT32(1, audio_ring_oldest(ring)->frame);
+    TEST_ASSERT_NOT_NULL(audio_ring_write_acquire(ring));
+}
+
+static void test_cut_mid_block(void) {
+    test_open(8000, 0, 0, 100000);
+    test_produce();
+    test_submit();
+    test_advance(10000);
+
+    /* 80 frames played, the fade adds its ramp and silences the rest */
+    audio_fade_t fade = { stream.now_us, 0, 0, false };
+    uint32_t position = audio_fade_cut(&stream.ring, stream.track_id, 0, &fade);
+    TEST_ASSERT_TRUE(fade.fading);
+    TEST_ASSERT_EQUAL_UINT32(0, fade.left);
+    TEST_ASSERT_EQUAL_UINT32(80 + 8000 * AUDIO_FADE_MS / 1000, position);
+    for (uint32_t i = 1; i < TEST_IN_FLIGHT; i++) {
+        const int16_t *samples = (const int16_t *)audio_ring_acquired(&stream.ring, i)->data;
+        TEST_ASSERT_EQUAL_INT16(0, samples[0]);
+    }
+}
+
+static void test_cut_nothing_submitted(void) {
+    test_open(8000, 0, 0, 100000);
+    test_produce();
+
+    /* Nothing of the track reached the speaker, the position stays */
+    audio_fade_t fade = { stream.now_us, 0, 0, false };
+    TEST_ASSERT_EQUAL_UINT32(4321, audio_fade_cut(&stream.ring, stream.track_id, 4321, &fade));
+    TEST_ASSERT_FALSE(fade.fading);
+}
+
+static void test_pause_resume_plain(void) {
+    test_open(44100, 0, 0, 441000);
+    test_run(40);
+}
+
+static void test_pause_resume_resampled(void) {
+    test_open(48000, 44100, 0, 441000);
+    test_run(40);
+}
+
+static void test_pause_resume_speed(void) {
+    test_open(48000, 22050, 150, 220500);
+    test_run(40);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_ring_order);
+    RUN_TEST(test_cut_mid_block);
+    RUN_TEST(test_cut_nothing_submitted);
+    RUN_TEST(test_pause_resume_plain);
+    RUN_TEST(test_pause_resume_resampled);
+    RUN_TEST(test_pause_resume_speed);
+    return UNITY_END();
+}
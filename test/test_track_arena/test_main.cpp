@@ -0,0 +1,183 @@
+/*
+ *  test_main.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  Track name arena on the host against the layout it replaced, a vector
+ *  of one heap string per track and a path string built for every track
+ *  played. Reports bytes per track, heap allocations and peak heap, and
+ *  times path construction.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <new>
+#include <string>
+#include <vector>
+#include <SD.h>
+#include "audio_reader.hpp"
+#include "music_library.hpp"
+
+#define TEST_TRACKS 5000
+
+/* Heap use through operator new, what the string layout allocates with */
+static size_t heap_now;
+static size_t heap_peak;
+static uint32_t heap_allocs;
+
+void *operator new(size_t size) {
+    size_t *block = (size_t *)malloc(size + sizeof(size_t));
+    if (block == NULL) {
+        throw std::bad_alloc();
+    }
+
+    block[0] = size;
+    heap_now += size;
+    heap_peak = (heap_now > heap_peak) ? heap_now : heap_peak;
+    heap_allocs++;
+    return block + 1;
+}
+
+/* The block came from malloc() in operator new, GCC cannot see that */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete(void *ptr) noexcept {
+    if (ptr != NULL) {
+        size_t *block = (size_t *)ptr - 1;
+        heap_now -= block[0];
+        free(block);
+    }
+}
+#pragma GCC diagnostic pop
+
+void operator delete(void *ptr, size_t size) noexcept {
+    operator delete(ptr);
+}
+
+static void heap_reset(void) {
+    heap_peak = heap_now;
+    heap_allocs = 0;
+}
+
+static void put16(uint8_t *p, uint32_t value) {
+    p[0] = value;
+    p[1] = value >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t value) {
+    put16(p, value);
+    put16(p + 2, value >> 16);
+}
+
+/* Names as a card of ripped albums has them */
+static std::string test_name(uint32_t i) {
+    char name[96];
+    snprintf(name, sizeof(name), "%02u - Artist %u - Some Track Title %u.wav", i % 20 + 1, i / 20, i);
+    return name;
+}
+
+static void test_on_change(void) {
+    music_library_apply();
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+static void test_arena_vs_strings(void) {
+    std::vector<uint8_t> wav(44 + 512);
+    char line[160];
+
+    memcpy(&wav[0], "RIFF", 4);
+    put32(&wav[4], wav.size() - 8);
+    memcpy(&wav[8], "WAVEfmt ", 8);
+    put32(&wav[16], 16);
+    put16(&wav[20], 1);
+    put16(&wav[22], 1);
+    put32(&wav[24], 8000);
+    put32(&wav[28], 16000);
+    put16(&wav[32], 2);
+    put16(&wav[34], 16);
+    memcpy(&wav[36], "data", 4);
+    put32(&wav[40], 512);
+
+    native_files.clear();
+    size_t name_bytes = 0;
+    for (uint32_t i = 0; i < TEST_TRACKS; i++) {
+        native_files[MUSIC_DIR "/" + test_name(i)] = wav;
+        name_bytes += test_name(i).size();
+    }
+    music_library_refresh(test_on_change);
+    TEST_ASSERT_EQUAL_UINT32(TEST_TRACKS, music_library_count());
+
+    /* Arena: one allocation of records, offsets and the string pool */
+    music_index_header_t header;
+    memcpy(&header, native_files[MUSIC_INDEX_PATH].data(), sizeof(header));
+    size_t arena_names = header.pool_size + header.track_count * header.offset_size;
+
+    /* Strings: the names as the old playlist held them, in directory order */
+    heap_reset();
+    size_t before = heap_now;
+    std::vector<std::string> *names = new std::vector<std::string>();
+    for (uint32_t i = 0; i < music_library_count(); i++) {
+        names->push_back(music_library_name(i));
+    }
+    size_t string_bytes = heap_now - before + sizeof(*names);
+    size_t string_peak = heap_peak - before;
+    uint32_t string_allocs = heap_allocs;
+
+    snprintf(line, sizeof(line), "%u tracks, %.1f name bytes each: arena %.1f bytes per name in 1 allocation, "
+             "strings %.1f bytes per name in %u allocations, peak %u bytes",
+             TEST_TRACKS, (double)name_bytes / TEST_TRACKS, (double)arena_names / TEST_TRACKS,
+             (double)string_bytes / TEST_TRACKS, string_allocs, (unsigned)string_peak);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_TRUE(arena_names < string_bytes);
+
+    /* Paths of every track, into a stack buffer or as a new string */
+    char path[AUDIO_PATH_MAX];
+    size_t total = 0;
+    heap_reset();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < TEST_TRACKS; i++) {
+        total += music_library_path(i, path, sizeof(path));
+    }
+    double arena_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    TEST_ASSERT_EQUAL_UINT32(0, heap_allocs);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < TEST_TRACKS; i++) {
+        std::string full = std::string(MUSIC_DIR "/") + (*names)[i];
+        total -= full.size();
+    }
+    double string_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    TEST_ASSERT_EQUAL_UINT32(0, total);
+
+    snprintf(line, sizeof(line), "path of every track: arena %.1f ns each, no allocation; strings %.1f ns each, %u allocations",
+             arena_us * 1000 / TEST_TRACKS, string_us * 1000 / TEST_TRACKS, heap_allocs);
+    TEST_MESSAGE(line);
+    delete names;
+}
+
+static void test_arena_lookup(void) {
+    char path[AUDIO_PATH_MAX];
+    uint32_t count = music_library_count();
+
+    /* Every name comes back intact, short buffers and bad indexes are refused */
+    for (uint32_t i = 0; i < count; i++) {
+        std::string name = music_library_name(i);
+        TEST_ASSERT_TRUE(native_files.count(MUSIC_DIR "/" + name) > 0);
+        TEST_ASSERT_EQUAL_UINT32(sizeof(MUSIC_DIR) + name.size(), music_library_path(i, path, sizeof(path)));
+        TEST_ASSERT_EQUAL_UINT32(0, music_library_path(i, path, sizeof(MUSIC_DIR) + name.size()));
+    }
+    TEST_ASSERT_NULL(music_library_name(count));
+    TEST_ASSERT_EQUAL_UINT32(0, music_library_path(count, path, sizeof(path)));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_arena_vs_strings);
+    RUN_TEST(test_arena_lookup);
+    return UNITY_END();
+}
@@ -0,0 +1,331 @@
+/*
+ *  test_main.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  WAV parser on the host: a corpus of valid and malformed headers fed in
+ *  slices of every size, a mutation fuzzer over that corpus and a throughput
+ *  benchmark. A bad header must end in an error, never in a hang or a read
+ *  past the slice it was given.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <vector>
+#include "wav_parser.hpp"
+
+#define TEST_FUZZ_RUNS 200000
+#define TEST_BENCH_BYTES (64u << 20)
+
+typedef std::vector<uint8_t> bytes_t;
+
+/* One corpus file and what it must parse to */
+typedef struct {
+    const char *name;
+    bytes_t data;
+    wav_parse_result_t result;
+    uint16_t format;
+    uint16_t bits;
+    uint32_t data_size;          /* The samples end the file */
+} test_file_t;
+
+static std::vector<test_file_t> corpus;
+static uint32_t test_seed;
+
+static uint32_t test_random(uint32_t range) {
+    test_seed = test_seed * 1664525 + 1013904223;
+    return (test_seed >> 8) % range;
+}
+
+static void put16(bytes_t *out, uint32_t value) {
+    out->push_back(value);
+    out->push_back(value >> 8);
+}
+
+static void put32(bytes_t *out, uint32_t value) {
+    put16(out, value);
+    put16(out, value >> 16);
+}
+
+static void put_chunk(bytes_t *out, const char *id, const bytes_t &payload) {
+    out->insert(out->end(), id, id + 4);
+    put32(out, payload.size());
+    out->insert(out->end(), payload.begin(), payload.end());
+    if (payload.size() & 1) {
+        out->push_back(0);
+    }
+}
+
+static bytes_t make_fmt(uint16_t format, uint16_t channels, uint32_t rate, uint16_t bits) {
+    bytes_t fmt;
+    uint16_t align = channels * (bits >> 3);
+
+    put16(&fmt, format);
+    put16(&fmt, channels);
+    put32(&fmt, rate);
+    put32(&fmt, rate * align);
+    put16(&fmt, align);
+    put16(&fmt, bits);
+    return fmt;
+}
+
+static bytes_t make_extensible(uint16_t sub_format, uint16_t channels, uint32_t rate, uint16_t bits, uint16_t valid_bits) {
+    static const uint8_t tail[14] = { 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 };
+    bytes_t fmt = make_fmt(WAV_FORMAT_EXTENSIBLE, channels, rate, bits);
+
+    put16(&fmt, 22);
+    put16(&fmt, valid_bits);
+    put32(&fmt, 3);
+    put16(&fmt, sub_format);
+    fmt.insert(fmt.end(), tail, tail + sizeof(tail));
+    return fmt;
+}
+
+static bytes_t make_ima(uint16_t channels, uint32_t rate, uint16_t align) {
+    bytes_t fmt;
+
+    put16(&fmt, WAV_FORMAT_IMA_ADPCM);
+    put16(&fmt, channels);
+    put32(&fmt, rate);
+    put32(&fmt, rate * align / ((align - 4 * channels) * 2 / channels + 1));
+    put16(&fmt, align);
+    put16(&fmt, 4);
+    put16(&fmt, 2);
+    put16(&fmt, (align - 4 * channels) * 2 / channels + 1);
+    return fmt;
+}
+
+static bytes_t make_ms_adpcm(uint16_t channels, uint32_t rate, uint16_t align) {
+    bytes_t fmt;
+
+    put16(&fmt, WAV_FORMAT_MS_ADPCM);
+    put16(&fmt, channels);
+    put32(&fmt, rate);
+    put32(&fmt, rate * align / ((align - 7 * channels) * 2 / channels + 2));
+    put16(&fmt, align);
+    put16(&fmt, 4);
+    put16(&fmt, 4 + 4 * WAV_MS_ADPCM_COEFS);
+    put16(&fmt, (align - 7 * channels) * 2 / channels + 2);
+    put16(&fmt, WAV_MS_ADPCM_COEFS);
+    for (int i = 0; i < WAV_MS_ADPCM_COEFS; i++) {
+        put16(&fmt, wav_ms_adpcm_coefs[i][0]);
+        put16(&fmt, wav_ms_adpcm_coefs[i][1]);
+    }
+    return fmt;
+}
+
+/* RIFF file of the given chunks and samples, riff_size 0 writes the real size */
+static bytes_t make_wav(const std::vector<std::pair<const char *, bytes_t>> &chunks, uint32_t samples, uint32_t riff_size) {
+    bytes_t out;
+    bytes_t body;
+
+    for (const auto &chunk : chunks) {
+        put_chunk(&body, chunk.first, chunk.second);
+    }
+    body.insert(body.end(), { 'd', 'a', 't', 'a' });
+    put32(&body, samples);
+    body.resize(body.size() + samples, 0x55);
+
+    out.insert(out.end(), { 'R', 'I', 'F', 'F' });
+    put32(&out, riff_size ? riff_size : body.size() + 4);
+    out.insert(out.end(), { 'W', 'A', 'V', 'E' });
+    out.insert(out.end(), body.begin(), body.end());
+    return out;
+}
+
+static void add_file(const char *name, const bytes_t &data, wav_parse_result_t result, uint16_t format, uint16_t bits, uint32_t data_size) {
+    corpus.push_back({ name, data, result, format, bits, data_size });
+}
+
+static void build_corpus(void) {
+    bytes_t odd_list(7, 'x');
+    bytes_t fact;
+    bytes_t cue;
+
+    put32(&fact, 1000);
+    put32(&cue, 0);
+    corpus.clear();
+
+    bytes_t pcm16 = make_wav({ { "fmt ", make_fmt(WAV_FORMAT_PCM, 1, 44100, 16) } }, 4000, 0);
+    bytes_t chunks = make_wav({ { "LIST", odd_list }, { "fmt ", make_fmt(WAV_FORMAT_PCM, 2, 48000, 16) }, { "fact", fact }, { "cue ", cue } }, 4000, 0);
+    bytes_t ext24 = make_wav({ { "fmt ", make_extensible(WAV_FORMAT_PCM, 2, 96000, 24, 24) } }, 6000, 0);
+    bytes_t int32 = make_wav({ { "fmt ", make_fmt(WAV_FORMAT_PCM, 1, 44100, 32) } }, 4000, 0);
+    bytes_t float32 = make_wav({ { "fmt ", make_fmt(WAV_FORMAT_FLOAT, 2, 44100, 32) } }, 4000, 0);
+    bytes_t ima = make_wav({ { "fmt ", make_ima(1, 22050, 256) }, { "fact", fact } }, 1024, 0);
+    bytes_t ms = make_wav({ { "fmt ", make_ms_adpcm(2, 22050, 512) } }, 2048, 0);
+    bytes_t streamed = make_wav({ { "fmt ", make_fmt(WAV_FORMAT_PCM, 1, 8000, 8) } }, 999, 0xFFFFFFFF);
+
+    add_file("pcm16", pcm16, WAV_PARSE_DONE, WAV_FORMAT_PCM, 16, 4000);
+    add_file("odd LIST, fact, cue", chunks, WAV_PARSE_DONE, WAV_FORMAT_PCM, 16, 4000);
+    add_file("extensible 24-bit", ext24, WAV_PARSE_DONE, WAV_FORMAT_PCM, 24, 6000);
+    add_file("32-bit int", int32, WAV_PARSE_DONE, WAV_FORMAT_PCM, 32, 4000);
+    add_file("32-bit float", float32, WAV_PARSE_DONE, WAV_FORMAT_FLOAT, 32, 4000);
+    add_file("IMA ADPCM", ima, WAV_PARSE_DONE, WAV_FORMAT_IMA_ADPCM, 4, 1024);
+    add_file("MS ADPCM", ms, WAV_PARSE_DONE, WAV_FORMAT_MS_ADPCM, 4, 2048);
+    add_file("streamed 8-bit", streamed, WAV_PARSE_DONE, WAV_FORMAT_PCM, 8, 999);
+
+    /* Malformed */
+    bytes_t bad = pcm16;
+    bad[0] = 'X';
+    add_file("not RIFF", bad, WAV_PARSE_ERROR, 0, 0, 0);
+    bad = pcm16;
+    bad[22] = 0;
+    add_file("no channels", bad, WAV_PARSE_ERROR, 0, 0, 0);
+    bad = make_wav({ { "LIST", bytes_t(100, 0) } }, 16, 40);
+    add_file("chunk past RIFF end", bad, WAV_PARSE_ERROR, 0, 0, 0);
+    bad = make_wav({}, 16, 0);
+    add_file("data before fmt", bad, WAV_PARSE_ERROR, 0, 0, 0);
+    bad = make_wav({ { "fmt ", make_fmt(WAV_FORMAT_PCM, 1, 44100, 12) } }, 16, 0);
+    add_file("12-bit container", bad, WAV_PARSE_ERROR, 0, 0, 0);
+    bad = pcm16;
+    bad.resize(30);
+    add_file("truncated header", bad, WAV_PARSE_NEED_MORE, 0, 0, 0);
+}
+
+/* Feed a buffer in slices of at most step bytes until the parser decides */
+static wav_parse_result_t test_parse(const uint8_t *data, size_t len, size_t step, wav_parser_t *parser, size_t *used) {
+    wav_parse_result_t result = WAV_PARSE_NEED_MORE;
+    size_t pos = 0;
+
+    wav_parser_init(parser);
+    while ((pos < len) && (result == WAV_PARSE_NEED_MORE)) {
+        size_t n = (len - pos < step) ? len - pos : step;
+        size_t consumed = 0;
+        result = wav_parser_feed(parser, data + pos, n, &consumed);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(n, consumed);
+        TEST_ASSERT_TRUE((result != WAV_PARSE_NEED_MORE) || (consumed == n));
+        pos += consumed;
+    }
+
+    *used = pos;
+    return result;
+}
+
+void setUp(void) {
+    test_seed = 2026;
+    if (corpus.empty()) {
+        build_corpus();
+    }
+}
+
+void tearDown(void) {
+}
+
+static void test_corpus(void) {
+    static const size_t steps[] = { 1, 3, 7, 8, 13, 512, 1u << 20 };
+
+    for (const test_file_t &file : corpus) {
+        for (size_t step : steps) {
+            wav_parser_t parser;
+            size_t used;
+            wav_parse_result_t result = test_parse(file.data.data(), file.data.size(), step, &parser, &used);
+
+            TEST_ASSERT_EQUAL_INT_MESSAGE(file.result, result, file.name);
+            if (result != WAV_PARSE_DONE) {
+                continue;
+            }
+            TEST_ASSERT_EQUAL_UINT16(file.format, parser.info.format);
+            TEST_ASSERT_EQUAL_UINT16(file.bits, parser.info.bits);
+            TEST_ASSERT_EQUAL_UINT32(file.data_size, parser.info.data_size);
+            TEST_ASSERT_EQUAL_UINT32(file.data.size() - file.data_size, parser.info.data_offset);
+            TEST_ASSERT_EQUAL_UINT32(parser.info.data_offset, used);
+        }
+    }
+}
+
+static void test_skip(void) {
+    const test_file_t &file = corpus[1];
+    wav_parser_t parser;
+    size_t pos = 0;
+    size_t consumed;
+    uint32_t skipped = 0;
+
+    /* The LIST payload is skipped by seeking instead of reading it */
+    wav_parser_init(&parser);
+    TEST_ASSERT_EQUAL_INT(WAV_PARSE_NEED_MORE, wav_parser_feed(&parser, file.data.data(), 20, &consumed));
+    pos += consumed;
+    skipped = wav_parser_skip(&parser, 4);
+    TEST_ASSERT_EQUAL_UINT32(8, skipped);
+    pos += skipped;
+    TEST_ASSERT_EQUAL_INT(WAV_PARSE_DONE, wav_parser_feed(&parser, file.data.data() + pos, file.data.size() - pos, &consumed));
+    TEST_ASSERT_EQUAL_UINT32(file.data.size() - 4000, parser.info.data_offset);
+    TEST_ASSERT_EQUAL_UINT32(0, wav_parser_skip(&parser, 0));
+}
+
+static void test_fuzz(void) {
+    uint32_t done = 0;
+
+    for (uint32_t run = 0; run < TEST_FUZZ_RUNS; run++) {
+        bytes_t data = corpus[test_random(corpus.size())].data;
+        if (data.size() > 200) {
+            data.resize(200);
+        }
+
+        /* Flip, overwrite and cut bytes, most land in the headers */
+        uint32_t edits = 1 + test_random(8);
+        for (uint32_t i = 0; i < edits; i++) {
+            uint32_t at = test_random(data.size());
+            data[at] = test_random(3) ? test_random(256) : data[at] ^ (1 << test_random(8));
+        }
+        if (test_random(4) == 0) {
+            data.resize(test_random(data.size()));
+        }
+
+        /* The answer may not depend on how the stream is sliced */
+        wav_parser_t whole;
+        wav_parser_t bytewise;
+        size_t used_whole;
+        size_t used_bytewise;
+        wav_parse_result_t result = test_parse(data.data(), data.size(), data.size() + 1, &whole, &used_whole);
+        TEST_ASSERT_EQUAL_INT(result, test_parse(data.data(), data.size(), 1 + test_random(16), &bytewise, &used_bytewise));
+        TEST_ASSERT_EQUAL_UINT32(used_whole, used_bytewise);
+        if (result != WAV_PARSE_DONE) {
+            continue;
+        }
+
+        /* What the decoders rely on */
+        const wav_info_t *info = &whole.info;
+        TEST_ASSERT_EQUAL_MEMORY(info, &bytewise.info, sizeof(wav_info_t));
+        TEST_ASSERT_EQUAL_UINT32(used_whole, info->data_offset);
+        TEST_ASSERT_TRUE((info->channels > 0) && (info->block_align > 0) && (info->sample_rate > 0));
+        TEST_ASSERT_EQUAL_UINT32(0, info->data_size % info->block_align);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(info->bits, info->valid_bits);
+        done++;
+    }
+
+    char line[80];
+    snprintf(line, sizeof(line), "%u runs, %u parsed to the data chunk", TEST_FUZZ_RUNS, (unsigned)done);
+    TEST_MESSAGE(line);
+}
+
+static void test_benchmark(void) {
+    uint64_t bytes = 0;
+    uint32_t files = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    /* Headers only, the parser stops at the data chunk */
+    while (bytes < TEST_BENCH_BYTES) {
+        for (const test_file_t &file : corpus) {
+            wav_parser_t parser;
+            size_t used;
+            wav_parser_init(&parser);
+            wav_parser_feed(&parser, file.data.data(), file.data.size(), &used);
+            bytes += used;
+            files++;
+        }
+    }
+
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    char line[100];
+    snprintf(line, sizeof(line), "%.0f headers/s, %.1f MB/s of header bytes", files / s, bytes / s / 1e6);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_corpus);
+    RUN_TEST(test_skip);
+    RUN_TEST(test_fuzz);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+#
+#  image_lz.py
+#
+#  Created on: Oct 17, 2026
+#
+# Compress LVGL LV_IMG_CF_INDEXED_8BIT C arrays for the image_lz decoder.
+#
+# The image keeps its palette and is cut into bands of lines. Each band is an
+# LZ4 style block of its palette indices: a token with 4 bits of literal
+# length and 4 bits of match length, extra length bytes while 255, the
+# literals, a 16-bit little endian match offset and extra match length bytes.
+# The last sequence of a band has literals only. Indices narrower than a byte
+# are packed first pixel in the high bits, every line starting on a byte.
+#
+# Image data, all little endian:
+#   uint32  magic "ILZ8"
+#   uint16  palette entries
+#   uint8   lines per band
+#   uint8   bits per index, 1, 2, 4 or 8
+#   palette entries of 4 bytes, blue green red alpha
+#   uint32  offset of every band from the first one, and one past the last
+#   bands
+#
+# Usage: tools/image_lz.py [--band LINES] [--bin DIR] src/images/image1.c [...]
+# Files are rewritten in place, files already compressed are left as they are.
+# With --bin they are left untouched and written to DIR as LVGL binary images
+# instead, a 4-byte lv_img_header_t followed by the data. The slideshow images
+# of /smiles are built from their sources by smile_assets.py.
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+MAGIC = b'ILZ8'
+MIN_MATCH = 4
+MAX_OFFSET = 0xFFFF
+CHAIN = 64                   # Candidates tried per position
+CF = 'LV_IMG_CF_USER_ENCODED_0'
+
+
+def parse(text):
+    """Palette, indices and header fields of an LVGL indexed C array"""
+    name = re.search(r'const lv_img_dsc_t (\w+) = \{', text).group(1)
+    cf = re.search(r'\.header\.cf = (\w+)', text).group(1)
+    w = int(re.search(r'\.header\.w = (\d+)', text).group(1))
+    h = int(re.search(r'\.header\.h = (\d+)', text).group(1))
+    body = text[text.index('_map[] = {') + 10:text.index('};')]
+    body = re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+    data = bytes(int(x, 16) for x in re.findall(r'0x([0-9a-fA-F]{1,2})', body))
+    return name, cf, w, h, data
+
+
+def compress(src):
+    """One band as LZ4 style sequences, greedy with a one step lazy match"""
+    n = len(src)
+    out = bytearray()
+    head = {}
+    prev = [-1] * n
+
+    def insert(p):
+        if p + MIN_MATCH <= n:
+            key = src[p:p + MIN_MATCH]
+            prev[p] = head.get(key, -1)
+            head[key] = p
+
+    def find(p):
+        best, offset = 0, 0
+        if p + MIN_MATCH > n:
+            return best, offset
+        c = head.get(src[p:p + MIN_MATCH], -1)
+        for _ in range(CHAIN):
+            if c < 0 or p - c > MAX_OFFSET:
+                break
+            length = MIN_MATCH
+            while p + length < n and src[c + length] == src[p + length]:
+                length += 1
+            if length > best:
+                best, offset = length, p - c
+            c = prev[c]
+        return best, offset
+
+    def length_bytes(value):
+        while value >= 255:
+            out.append(255)
+            value -= 255
+        out.append(value)
+
+    def emit(literals, match, offset):
+        lit = len(literals)
+        extra = match - MIN_MATCH
+        out.append((min(lit, 15) << 4) | (min(extra, 15) if match else 0))
+        if lit >= 15:
+            length_bytes(lit - 15)
+        out.extend(literals)
+        if match:
+            out.extend(struct.pack('<H', offset))
+            if extra >= 15:
+                length_bytes(extra - 15)
+
+    i = start = 0
+    while i < n:
+        length, offset = find(i)
+        insert(i)
+        if length < MIN_MATCH:
+            i += 1
+            continue
+
+        # A longer match one byte later is worth a literal
+        later, later_offset = find(i + 1)
+        if later > length + 1:
+            i += 1
+            insert(i)
+            length, offset = later, later_offset
+
+        emit(src[start:i], length, offset)
+        for p in range(i + 1, i + length):
+            insert(p)
+        i += length
+        start = i
+    emit(src[start:n], 0, 0)
+    return bytes(out)
+
+
+def decompress(src, size):
+    """Reference decoder, checks every band the converter writes"""
+    out = bytearray()
+    i = 0
+    while i < len(src):
+        token = src[i]
+        i += 1
+        length = token >> 4
+        if length == 15:
+            while True:
+                length += src[i]
+                i += 1
+                if src[i - 1] != 255:
+                    break
+        out += src[i:i + length]
+        i += length
+        if i >= len(src):
+            break
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+        length = (token & 15) + MIN_MATCH
+        if (token & 15) == 15:
+            while True:
+                length += src[i]
+                i += 1
+                if src[i - 1] != 255:
+                    break
+        for _ in range(length):
+            out.append(out[-offset])
+    assert len(out) == size
+    return bytes(out)
+
+
+def pack(indices, w, h, bits):
+    """Lines of indices packed bits wide, first pixel in the high bits"""
+    if bits == 8:
+        return bytes(indices)
+    per_byte = 8 // bits
+    stride = (w + per_byte - 1) // per_byte
+    out = bytearray(stride * h)
+    for y in range(h):
+        for x in range(w):
+            out[y * stride + x // per_byte] |= indices[y * w + x] << (8 - bits - (x % per_byte) * bits)
+    return bytes(out)
+
+
+def encode(palette, indices, w, h, band, bits=8):
+    """Header, palette, band offsets and bands of one image"""
+    colors = len(palette) // 4
+    assert colors <= 1 << bits
+    stride = (w * bits + 7) // 8
+    packed_lines = pack(indices, w, h, bits)
+    bands = []
+    for y in range(0, h, band):
+        raw = packed_lines[y * stride:min(h, y + band) * stride]
+        packed = compress(raw)
+        assert decompress(packed, len(raw)) == raw
+        bands.append(packed)
+
+    offsets = [0]
+    for packed in bands:
+        offsets.append(offsets[-1] + len(packed))
+    return (MAGIC + struct.pack('<HBB', colors, band, bits) + palette +
+            struct.pack('<%dI' % len(offsets), *offsets) + b''.join(bands)), len(bands)
+
+
+def hex_line(data):
+    return '  ' + ''.join('0x%02x, ' % b for b in data).rstrip() + '\n'
+
+
+def write(path, name, w, h, data, colors, bands):
+    attr = 'LV_ATTRIBUTE_IMG_' + name.upper()
+    pos = 8 + colors * 4
+    offsets = struct.unpack_from('<%dI' % (bands + 1), data, pos)
+    start = pos + (bands + 1) * 4
+
+    with open(path, 'w', newline='\n') as f:
+        f.write('#ifdef __has_include\n'
+                '    #if __has_include("lvgl.h")\n'
+                '        #ifndef LV_LVGL_H_INCLUDE_SIMPLE\n'
+                '            #define LV_LVGL_H_INCLUDE_SIMPLE\n'
+                '        #endif\n'
+                '    #endif\n'
+                '#endif\n\n'
+                '#if defined(LV_LVGL_H_INCLUDE_SIMPLE)\n'
+                '    #include "lvgl.h"\n'
+                '#else\n'
+                '    #include "lvgl/lvgl.h"\n'
+                '#endif\n\n\n'
+                '#ifndef LV_ATTRIBUTE_MEM_ALIGN\n'
+                '#define LV_ATTRIBUTE_MEM_ALIGN\n'
+                '#endif\n\n'
+                '#ifndef %s\n'
+                '#define %s\n'
+                '#endif\n\n' % (attr, attr))
+        f.write('/* Generated by tools/image_lz.py, %u colors in bands of %u lines */\n' % (colors, data[6]))
+        f.write('const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST %s uint8_t %s_map[] = {\n' % (attr, name))
+        f.write(hex_line(data[:8]).rstrip() + ' \t/*Header*/\n')
+        for i in range(colors):
+            f.write(hex_line(data[8 + i * 4:12 + i * 4]).rstrip() + ' \t/*Color of index %d*/\n' % i)
+        for i in range(0, bands + 1, 8):
+            f.write(hex_line(data[pos + i * 4:pos + min(bands + 1, i + 8) * 4]).rstrip() + ' \t/*Band offsets*/\n')
+        for i in range(bands):
+            f.write(hex_line(data[start + offsets[i]:start + offsets[i + 1]]))
+        f.write('};\n\n')
+        f.write('const lv_img_dsc_t %s = {\n'
+                '  .header.cf = %s,\n'
+                '  .header.always_zero = 0,\n'
+                '  .header.reserved = 0,\n'
+                '  .header.w = %u,\n'
+                '  .header.h = %u,\n'
+                '  .data_size = %u,\n'
+                '  .data = %s_map,\n'
+                '};\n' % (name, CF, w, h, len(data), name))
+
+
+def write_bin(path, w, h, data):
+    header = 24 | (w << 10) | (h << 21)      # cf LV_IMG_CF_USER_ENCODED_0
+    with open(path, 'wb') as f:
+        f.write(struct.pack('<I', header) + data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compress LVGL indexed 8-bit images for the image_lz decoder')
+    parser.add_argument('--band', type=int, default=8, help='lines per band, at most IMAGE_LZ_BAND_LINES of the firmware')
+    parser.add_argument('--bin', metavar='DIR', help='write LVGL binary images to DIR instead of rewriting the sources')
+    parser.add_argument('files', nargs='+')
+    args = parser.parse_args()
+    if not 1 <= args.band <= 255:
+        parser.error('--band must be 1 to 255')
+    if args.bin:
+        os.makedirs(args.bin, exist_ok=True)
+
+    raw_total = packed_total = 0
+    for path in args.files:
+        with open(path) as f:
+            name, cf, w, h, data = parse(f.read())
+        if cf == CF:
+            if args.bin:
+                write_bin(os.path.join(args.bin, name + '.bin'), w, h, data)
+                print('%s: already compressed, %u bytes' % (path, len(data)))
+            else:
+                print('%s: already compressed' % path)
+            continue
+        if cf != 'LV_IMG_CF_INDEXED_8BIT' or len(data) != 1024 + w * h:
+            sys.exit('%s: only LV_IMG_CF_INDEXED_8BIT images are supported' % path)
+        if any(data[i] != 0xFF for i in range(3, 1024, 4)):
+            sys.exit('%s: the decoder draws opaque images only' % path)
+
+        packed, bands = encode(data[:1024], data[1024:], w, h, args.band)
+        if args.bin:
+            write_bin(os.path.join(args.bin, name + '.bin'), w, h, packed)
+        else:
+            write(path, name, w, h, packed, 256, bands)
+        raw_total += len(data)
+        packed_total += len(packed)
+        print('%s: %u -> %u bytes, %.2fx' % (path, len(data), len(packed), len(data) / len(packed)))
+
+    if packed_total:
+        print('Total: %u -> %u bytes, %.2fx' % (raw_total, packed_total, raw_total / packed_total))
+
+
+if __name__ == '__main__':
+    main()
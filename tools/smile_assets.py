@@ -0,0 +1,357 @@
+#!/usr/bin/env python3
+#
+#  smile_assets.py
+#
+#  Created on: Oct 17, 2026
+#
+# Build the slideshow images from their sources.
+#
+# Every PNG or JPEG of the source directory becomes an LVGL binary image of
+# the output directory, compressed for the image_lz decoder (see image_lz.py),
+# and the manifest header lists them for the firmware. Per image:
+#
+#   - colours the RGB565 display shows the same are merged, which changes
+#     nothing on screen
+#   - up to 256 colours are kept exactly, more are quantized by median cut
+#   - the palette holds the colours used only, and indices are packed 1, 2 or 4
+#     bits wide when few colours allow it and it compresses smaller
+#
+# Identical palettes and bands across images are reported, each image stays a
+# file of its own as the slideshow reads one at a time. The sizes of every
+# image are printed against the plain LVGL indexed 8-bit image and the
+# previous build, and nothing is written when the total exceeds the budget.
+#
+# PNG is read without any dependency, JPEG needs Pillow. Images must be
+# opaque. Output files without a source are removed.
+#
+# Usage: tools/smile_assets.py [--src DIR] [--out DIR] [--manifest FILE]
+#                              [--budget BYTES] [--colors N] [--band LINES]
+
+import argparse
+import collections
+import glob
+import os
+import re
+import struct
+import sys
+import zlib
+
+import image_lz
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, 'assets', 'smiles')
+OUT = os.path.join(ROOT, 'data', 'smiles')
+MANIFEST = os.path.join(ROOT, 'src', 'smile_manifest.hpp')
+BUDGET = 1024 * 1024         # Bytes of SPIFFS left to the slideshow
+NAME_MAX = 32                # SMILE_NAME_MAX of the firmware, terminator included
+MAX_WIDTH = 320              # IMAGE_LZ_MAX_WIDTH of the firmware
+MAX_HEIGHT = 2047            # lv_img_header_t height field
+
+
+def read_png(path):
+    """Width, height and RGBA bytes of a non-interlaced PNG"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('not a PNG file')
+
+    pos = 8
+    idat = bytearray()
+    plte = b''
+    trns = None
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            w, h, depth, ctype, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'PLTE':
+            plte = body
+        elif kind == b'tRNS':
+            trns = body
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+    if interlace:
+        raise ValueError('interlaced PNG is not supported')
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    bpp = max(1, channels * depth // 8)
+    stride = (w * channels * depth + 7) // 8
+    raw = zlib.decompress(bytes(idat))
+    lines = []
+    prev = bytearray(stride)
+    for y in range(h):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 255
+            elif kind == 2:
+                line[i] = (line[i] + b) & 255
+            elif kind == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 255
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 255
+        lines.append(line)
+        prev = line
+
+    out = bytearray()
+    for line in lines:
+        if depth == 16:
+            samples = line[0::2]
+        elif depth == 8:
+            samples = line
+        else:
+            per_byte = 8 // depth
+            samples = [(line[x // per_byte] >> (8 - depth - (x % per_byte) * depth)) & ((1 << depth) - 1)
+                       for x in range(w * channels)]
+        for x in range(w):
+            s = samples[x * channels:(x + 1) * channels]
+            if ctype == 3:
+                i = s[0]
+                alpha = trns[i] if trns is not None and i < len(trns) else 255
+                out += plte[i * 3:i * 3 + 3] + bytes([alpha])
+            elif ctype in (0, 4):
+                grey = s[0] * 255 // ((1 << depth) - 1) if depth < 8 else s[0]
+                out += bytes([grey, grey, grey, s[1] if ctype == 4 else 255])
+            else:
+                out += bytes(s[:3]) + bytes([s[3] if ctype == 6 else 255])
+    return w, h, bytes(out)
+
+
+def read_jpeg(path):
+    """Width, height and RGBA bytes of a JPEG, through Pillow"""
+    try:
+        from PIL import Image
+    except ImportError:
+        raise ValueError('JPEG sources need Pillow, pip install pillow')
+    with Image.open(path) as image:
+        rgba = image.convert('RGBA')
+        return rgba.width, rgba.height, rgba.tobytes()
+
+
+def rgb565(r, g, b):
+    """Color as the display shows it, the RGB565 code"""
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def median_cut(counts, colors):
+    """Palette of at most colors entries for the colours counted"""
+    boxes = [list(counts.items())]
+    while len(boxes) < colors:
+        # Split the box with the widest channel range, weighted by its pixels
+        best, best_score = None, 0
+        for i, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            spread = max(max(c[0][k] for c in box) - min(c[0][k] for c in box) for k in range(3))
+            score = spread * sum(c[1] for c in box)
+            if score > best_score:
+                best, best_score = i, score
+        if best is None:
+            break
+        box = boxes.pop(best)
+        k = max(range(3), key=lambda k: max(c[0][k] for c in box) - min(c[0][k] for c in box))
+        box.sort(key=lambda c: (c[0][k], c[0]))
+        half, total = 0, sum(c[1] for c in box) / 2
+        for cut, c in enumerate(box):
+            half += c[1]
+            if half >= total:
+                break
+        cut = min(max(cut, 0), len(box) - 2) + 1
+        boxes += [box[:cut], box[cut:]]
+
+    palette = []
+    for box in boxes:
+        n = sum(c[1] for c in box)
+        palette.append(tuple((sum(c[0][k] * c[1] for c in box) + n // 2) // n for k in range(3)))
+    return palette
+
+
+def quantize(w, h, rgba, colors):
+    """Palette of RGB tuples, indices, and colours before any quantization"""
+    pixels = [rgba[i:i + 3] for i in range(0, w * h * 4, 4)]
+    if any(rgba[i] != 255 for i in range(3, w * h * 4, 4)):
+        raise ValueError('the decoder draws opaque images only')
+
+    # One colour per RGB565 code, the most used RGB888 of the code
+    counts = collections.Counter(pixels)
+    shades = {}
+    for color, n in sorted(counts.items()):
+        code = rgb565(*color)
+        if code not in shades or n > counts[shades[code]]:
+            shades[code] = color
+    merged = collections.Counter()
+    for color, n in counts.items():
+        merged[shades[rgb565(*color)]] += n
+    found = len(merged)
+
+    if found > colors:
+        palette = median_cut({tuple(c): n for c, n in merged.items()}, colors)
+        nearest = {}
+        for color in merged:
+            nearest[color] = min(range(len(palette)),
+                                 key=lambda i: sum((color[k] - palette[i][k]) ** 2 for k in range(3)))
+        merged = collections.Counter()
+        for color, n in counts.items():
+            merged[palette[nearest[shades[rgb565(*color)]]]] += n
+        mapping = {color: palette[nearest[shades[rgb565(*color)]]] for color in counts}
+    else:
+        mapping = {color: shades[rgb565(*color)] for color in counts}
+
+    # Most used first, ties by colour so the build is reproducible
+    palette = sorted(merged, key=lambda c: (-merged[c], tuple(c)))
+    position = {bytes(c): i for i, c in enumerate(palette)}
+    index = {color: position[bytes(mapping[color])] for color in counts}
+    return palette, bytes(index[p] for p in pixels), found
+
+
+def build(path, args):
+    """Smallest image_lz data of a source image with what it is made of"""
+    if path.lower().endswith('.png'):
+        w, h, rgba = read_png(path)
+    else:
+        w, h, rgba = read_jpeg(path)
+    if not (0 < w <= MAX_WIDTH and 0 < h <= MAX_HEIGHT):
+        raise ValueError('%ux%u does not fit the decoder, %u pixels wide at most' % (w, h, MAX_WIDTH))
+
+    palette, indices, found = quantize(w, h, rgba, args.colors)
+    lv_palette = b''.join(bytes([b, g, r, 255]) for r, g, b in palette)
+    best = None
+    for bits in (1, 2, 4, 8):
+        if len(palette) <= 1 << bits:
+            data, bands = image_lz.encode(lv_palette, indices, w, h, args.band, bits)
+            if best is None or len(data) < len(best[0]):
+                best = (data, bits)
+
+    data, bits = best
+    colors = len(palette)
+    offsets_at = 8 + colors * 4
+    count = (h + args.band - 1) // args.band
+    offsets = struct.unpack_from('<%dI' % (count + 1), data, offsets_at)
+    start = offsets_at + (count + 1) * 4
+    blocks = [data[start + offsets[i]:start + offsets[i + 1]] for i in range(count)]
+    return {'w': w, 'h': h, 'data': data, 'bits': bits, 'colors': colors, 'found': found,
+            'palette': lv_palette, 'blocks': blocks}
+
+
+def natural_key(name):
+    return [int(part) if part.isdigit() else part.lower() for part in re.split(r'(\d+)', name)]
+
+
+def write_manifest(path, assets):
+    largest = max((len(a['data']) for a in assets.values()), default=0)
+    with open(path, 'w', newline='\n') as f:
+        f.write('/*\n'
+                ' *  smile_manifest.hpp\n'
+                ' *\n'
+                ' *  Generated by tools/smile_assets.py, do not edit.\n'
+                ' */\n\n'
+                '#ifndef __SMILE_MANIFEST_HPP_\n'
+                '#define __SMILE_MANIFEST_HPP_\n\n'
+                '#include <stdint.h>\n\n'
+                '/* Slideshow images of the file system image, data bytes without the LVGL header */\n'
+                'typedef struct {\n'
+                '    const char *name;\n'
+                '    uint16_t w;\n'
+                '    uint16_t h;\n'
+                '    uint16_t colors;\n'
+                '    uint8_t bits;\n'
+                '    uint32_t size;\n'
+                '} smile_manifest_t;\n\n'
+                'constexpr smile_manifest_t smile_manifest[] = {\n')
+        for name, a in assets.items():
+            f.write('    { "%s", %u, %u, %u, %u, %u },\n' % (name, a['w'], a['h'], a['colors'], a['bits'], len(a['data'])))
+        f.write('};\n\n'
+                'constexpr uint32_t SMILE_MANIFEST_COUNT = %u;\n'
+                'constexpr uint32_t SMILE_MANIFEST_MAX_SIZE = %u;\n'
+                'constexpr uint32_t SMILE_MANIFEST_TOTAL_SIZE = %u;\n\n'
+                '#endif /* __SMILE_MANIFEST_HPP_ */\n'
+                % (len(assets), largest, sum(len(a['data']) for a in assets.values())))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Build the slideshow images and their manifest')
+    parser.add_argument('--src', default=SRC, help='source PNG and JPEG images')
+    parser.add_argument('--out', default=OUT, help='LVGL binary images for the file system image')
+    parser.add_argument('--manifest', default=MANIFEST, help='generated manifest header')
+    parser.add_argument('--budget', type=int, default=BUDGET, help='most bytes all images may take')
+    parser.add_argument('--colors', type=int, default=256, help='colours per image, more are quantized')
+    parser.add_argument('--band', type=int, default=8, help='lines per band, at most IMAGE_LZ_BAND_LINES of the firmware')
+    args = parser.parse_args()
+    if not 2 <= args.colors <= 256:
+        parser.error('--colors must be 2 to 256')
+    if not 1 <= args.band <= 255:
+        parser.error('--band must be 1 to 255')
+
+    sources = [p for p in glob.glob(os.path.join(args.src, '*'))
+               if os.path.splitext(p)[1].lower() in ('.png', '.jpg', '.jpeg')]
+    sources.sort(key=lambda p: natural_key(os.path.basename(p)))
+    if not sources:
+        sys.exit('%s: no PNG or JPEG images' % args.src)
+
+    assets = collections.OrderedDict()
+    failed = False
+    for path in sources:
+        name = os.path.splitext(os.path.basename(path))[0] + '.bin'
+        if len(name) >= NAME_MAX or name in assets:
+            print('%s: %s is too long or used twice' % (path, name))
+            failed = True
+            continue
+        try:
+            assets[name] = build(path, args)
+        except (ValueError, KeyError, zlib.error, struct.error) as e:
+            print('%s: %s' % (path, e))
+            failed = True
+    if failed:
+        sys.exit(1)
+
+    # Sizes against the plain indexed image and the previous build
+    print('%-14s %9s %7s %4s %8s %8s %8s %8s' % ('image', 'size', 'colors', 'bits', 'bytes', 'indexed', 'saved', 'change'))
+    raw_total = total = old_total = 0
+    for name, a in assets.items():
+        raw = 4 + 1024 + a['w'] * a['h']
+        size = 4 + len(a['data'])
+        old_path = os.path.join(args.out, name)
+        old = os.path.getsize(old_path) if os.path.exists(old_path) else 0
+        colors = '%u' % a['colors'] if a['found'] == a['colors'] else '%u>%u' % (a['found'], a['colors'])
+        print('%-14s %4ux%-4u %7s %4u %8u %8u %8d %+8d' % (name, a['w'], a['h'], colors, a['bits'], size, raw,
+                                                         raw - size, size - old))
+        raw_total += raw
+        total += size
+        old_total += old
+    print('%-14s %9s %7s %4s %8u %8u %8d %+8d' % ('total', '', '', '', total, raw_total, raw_total - total,
+                                                   total - old_total))
+
+    # What sharing between images would save
+    palettes = collections.Counter(a['palette'] for a in assets.values())
+    blocks = collections.Counter(block for a in assets.values() for block in a['blocks'])
+    print('Shared: %u of %u palettes, %u of %u bands, %u bytes' % (
+        sum(n - 1 for n in palettes.values()), len(assets),
+        sum(n - 1 for n in blocks.values()), sum(blocks.values()),
+        sum((n - 1) * len(k) for k, n in list(palettes.items()) + list(blocks.items()))))
+
+    if total > args.budget:
+        sys.exit('Images take %u bytes, over the budget of %u by %u, nothing written' % (
+            total, args.budget, total - args.budget))
+    print('Budget: %u of %u bytes, %u left' % (total, args.budget, args.budget - total))
+
+    os.makedirs(args.out, exist_ok=True)
+    for name, a in assets.items():
+        image_lz.write_bin(os.path.join(args.out, name), a['w'], a['h'], a['data'])
+    for path in glob.glob(os.path.join(args.out, '*.bin')):
+        if os.path.basename(path) not in assets:
+            print('%s: no source, removed' % path)
+            os.remove(path)
+    write_manifest(args.manifest, assets)
+
+
+if __name__ == '__main__':
+    main()
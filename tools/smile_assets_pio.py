@@ -0,0 +1,26 @@
+#
+#  smile_assets_pio.py
+#
+#  Created on: Oct 17, 2026
+#
+# PlatformIO pre script: rebuild the slideshow images and their manifest with
+# smile_assets.py when a source or the tools changed, and stop the build when
+# the images exceed their flash budget.
+
+import glob
+import os
+import subprocess
+import sys
+
+Import('env')  # noqa: F821
+
+root = env.subst('$PROJECT_DIR')  # noqa: F821
+tools = os.path.join(root, 'tools')
+manifest = os.path.join(root, 'src', 'smile_manifest.hpp')
+inputs = glob.glob(os.path.join(root, 'assets', 'smiles', '*')) + [
+    os.path.join(tools, 'smile_assets.py'), os.path.join(tools, 'image_lz.py')]
+
+if not os.path.exists(manifest) or max(os.path.getmtime(p) for p in inputs) > os.path.getmtime(manifest):
+    print('Building slideshow images')
+    if subprocess.call([sys.executable, os.path.join(tools, 'smile_assets.py')], cwd=root) != 0:
+        env.Exit(1)  # noqa: F821